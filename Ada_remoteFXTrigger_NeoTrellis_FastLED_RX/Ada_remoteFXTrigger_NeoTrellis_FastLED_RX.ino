@@ -25,12 +25,13 @@ CRGBArray<NUM_LEDS> leds;
 
 /********** NeoPixel Setup *************/
 
-#define UPDATES_PER_SECOND 100
+// Effects are drawn on a fixed clock, independent of when packets arrive.
+// 40 frames per second matches the old 25 ms per-frame delay.
+#define UPDATES_PER_SECOND 40
 CRGBPalette16 currentPalette( CRGB::Black);
 CRGBPalette16 targetPalette( PartyColors_p );
 TBlendType    currentBlending;
 
-int SPEEDO = 25;          
 int STEPS = 20;         
 int HUE = 200;    // starting color          
 int SATURATION = 255;          
@@ -70,8 +71,58 @@ int glitter = 0;
 // Singleton instance of the radio driver
 RH_RF69 rf69(RFM69_CS, RFM69_INT);
 
-
-bool oldState = HIGH;
+// Set to 1 to answer each button press with "Button #<letter>"
+#define SEND_REPLY 0
+
+/************ Button Commands ***************/
+
+typedef void (*Effect)();
+
+// What each letter from the button box does. -1 leaves that setting as it
+// was, and a NULL effect keeps the current animation running.
+typedef struct {
+  char    key;
+  int16_t hue, saturation, brightness, steps;
+  Effect  effect;
+} Command;
+
+const Command commands[] = {
+  { 'A',   0, 255, 200, -1, Solid },         // red
+  { 'B',  40, 255, 200, -1, Solid },         // gold
+  { 'C', 100, 255, 200, -1, Solid },         // green
+  { 'D', 140, 255, 200, -1, Solid },         // blue
+  { 'E', 180, 255, 200, -1, Solid },         // purple
+  { 'F', 220, 255, 200, -1, Solid },         // pink
+  { 'G',   0,   0, 200, -1, Solid },         // white
+  { 'H',   0,  -1,   0, -1, Solid },         // off
+  { 'I',   0, 255, 200, -1, Gradient },      // red
+  { 'J',  40, 255, 200, -1, Gradient },      // gold
+  { 'K', 100, 255, 200, -1, Gradient },      // green
+  { 'L', 140, 255, 200, -1, Gradient },      // blue
+  { 'M', 180, 255, 200, -1, Gradient },      // purple
+  { 'N', 220, 255, 200, -1, Gradient },      // pink
+  { 'O', 160,  50, 200, -1, Gradient },      // white
+  { 'P',  -1, 255, 200, -1, Rainbow_Fade },  // rainbow fade
+  { 'Q',  -1, 255, 200,  4, Rainbow },       // rainbow 2
+  { 'R',  -1, 255, 200, 20, Rainbow },       // rainbow 3
+  { 'Z',  -1,  -1, 200, -1, NULL },          // full brightness
+};
+
+Effect effect = Gradient;  // Animation currently running
+
+// Packets picked up from the radio but not yet acted on. RH_RF69 reads
+// each packet out of the radio in its own interrupt handler and holds
+// one at a time, so it's emptied into here on every pass through loop().
+#define QUEUE_SIZE 8
+
+struct {
+  char     key;
+  uint32_t arrived;  // micros() when picked up
+} queue[QUEUE_SIZE];
+uint8_t queueHead = 0, queueCount = 0;
+
+// Time from a packet being picked up to the LEDs showing its effect
+uint32_t latencyCount = 0, latencySum = 0, latencyMax = 0, dropped = 0;
 
 
 void setup() {
@@ -117,185 +168,94 @@ void setup() {
   Serial.print("RFM69 radio @");  Serial.print((int)RF69_FREQ);  Serial.println(" MHz");
 
   delay(500);
-  Gradient();  //So the lights come un upon startup, even if the trigger box is off
+  renderFrame();  //So the lights come un upon startup, even if the trigger box is off
 }
 
-  void loop(){
-  
-   
-  
-  if (rf69.waitAvailableTimeout(1000)) {
-    // Should be a message for us now   
-    uint8_t buf[RH_RF69_MAX_MESSAGE_LEN];
-    uint8_t len = sizeof(buf);
-    
-    if (! rf69.recv(buf, &len)) {
-      Serial.println("Receive failed");
-      return;
-    }
-    
-    //digitalWrite(LED, HIGH);
-   
-    //rf69.printBuffer("Received: ", buf, len);
-    //buf[len] = 0;
-    
-    //Serial.print("Got: "); Serial.println((char*)buf);
-    //Serial.print("RSSI: "); Serial.println(rf69.lastRssi(), DEC);
-
-    
-    char radiopacket[20] = "Button #";//prep reply message to send
-
-    
-
-    if (buf[0]=='A'){ //the letter sent from the button
-      ledMode(0);
-        radiopacket[8] = 'A';   
-    }
-     else if (buf[0]=='B'){ //the letter sent from the button
-      ledMode(1);
-      radiopacket[8] = 'B';    
-    }
-    
-     else if (buf[0]=='C'){ //the letter sent from the button
-      ledMode(2);
-       radiopacket[8] = 'C';    
-    }
+void loop() {
+  static uint32_t lastFrame = 0;
 
-     else if (buf[0]=='D'){ //the letter sent from the button
-      ledMode(3);
-      radiopacket[8] = 'D';    
-    }
-         else if (buf[0]=='E'){ //the letter sent from the button
-      ledMode(4);
-      radiopacket[8] = 'E';    
-    }
-    
-     else if (buf[0]=='F'){ //the letter sent from the button
-      ledMode(5);
-       radiopacket[8] = 'F';    
-    }
+  receivePackets();
 
-     else if (buf[0]=='G'){ //the letter sent from the button
-      ledMode(6);
-      radiopacket[8] = 'G';
-          
-    } 
-     else if (buf[0]=='H'){ //the letter sent from the button
-      ledMode(7);
-      radiopacket[8] = 'H';    
+  if (queueCount) {
+    // Act on everything that came in, then show it straight away rather
+    // than waiting for the next frame
+    uint8_t n = queueCount;
+    while (queueCount) {
+      runCommand(queue[queueHead].key);
+      queueHead = (queueHead + 1) % QUEUE_SIZE;
+      queueCount--;
     }
-    
-     else if (buf[0]=='I'){ //the letter sent from the button
-      ledMode(8);
-       radiopacket[8] = 'I';    
+    lastFrame = millis();
+    renderFrame();
+    uint32_t now = micros();
+    for (uint8_t i = 0; i < n; i++) {
+      uint32_t latency = now - queue[(queueHead + QUEUE_SIZE - n + i) % QUEUE_SIZE].arrived;
+      latencySum += latency;
+      if (latency > latencyMax) latencyMax = latency;
+      if ((++latencyCount % 16) == 0) printLatency();
     }
-
-     else if (buf[0]=='J'){ //the letter sent from the button
-      ledMode(9);
-      radiopacket[8] = 'J';    
-    }     
-     else if (buf[0]=='K'){ //the letter sent from the button
-      ledMode(10);
-      radiopacket[8] = 'K';    
-    }
-    
-     else if (buf[0]=='L'){ //the letter sent from the button
-      ledMode(11);
-       radiopacket[8] = 'L';    
+  } else if (millis() - lastFrame >= 1000 / UPDATES_PER_SECOND) {
+    lastFrame += 1000 / UPDATES_PER_SECOND;
+    if (millis() - lastFrame >= 1000 / UPDATES_PER_SECOND) {
+      lastFrame = millis(); // Fell behind, don't try to catch up
     }
+    renderFrame();
+  }
+}
 
-     else if (buf[0]=='M'){ //the letter sent from the button
-      ledMode(12);
-      radiopacket[8] = 'M';    
-    }
-     else if (buf[0]=='N'){ //the letter sent from the button
-      ledMode(13);
-      radiopacket[8] = 'N';    
-    }
-     else if (buf[0]=='O'){ //the letter sent from the button
-      ledMode(14);
-      radiopacket[8] = 'O';    
-    }
-     else if (buf[0]=='P'){ //the letter sent from the button
-      ledMode(15);
-      radiopacket[8] = 'P';    
-    }
-         else if (buf[0]=='Q'){ //the letter sent from the button
-      ledMode(16);
-      radiopacket[8] = 'Q';    
-    }
-         else if (buf[0]=='R'){ //the letter sent from the button
-      ledMode(17);
-      radiopacket[8] = 'R';    
-    }
-             else if (buf[0]=='S'){ //the letter sent from the button
-      ledMode(18);
-      radiopacket[8] = 'S';    
-    }
-         else if (buf[0]=='T'){ //the letter sent from the button
-      ledMode(19);
-      radiopacket[8] = 'T';    
+void receivePackets() {
+  while (rf69.available()) {
+    uint8_t buf[RH_RF69_MAX_MESSAGE_LEN];
+    uint8_t len = sizeof(buf);
+
+    if (! rf69.recv(buf, &len) || len == 0) {
+      Serial.println("Receive failed");
+      continue;
     }
-         else if (buf[0]=='Z'){ //the letter sent from the button
-      ledMode(20);
-      radiopacket[8] = 'Z';    
+    if (queueCount == QUEUE_SIZE) {
+      dropped++;
+      continue;
     }
-
-
-  /*   radiopacket[9] = 0;
-
+    uint8_t tail = (queueHead + queueCount) % QUEUE_SIZE;
+    queue[tail].key = buf[0];  // the letter sent from the button
+    queue[tail].arrived = micros();
+    queueCount++;
+
+#if SEND_REPLY
+    char radiopacket[20] = "Button #";
+    radiopacket[8] = buf[0];
+    radiopacket[9] = 0;
     Serial.print("Sending "); Serial.println(radiopacket);
     rf69.send((uint8_t *)radiopacket, strlen(radiopacket));
-    rf69.waitPacketSent();  */
-
-    digitalWrite(LED, LOW);
+    rf69.waitPacketSent();
+#endif
   }
+}
 
+void runCommand(char key) {
+  for (uint8_t i = 0; i < sizeof(commands) / sizeof(commands[0]); i++) {
+    const Command &c = commands[i];
+    if (c.key != key) continue;
+    if (c.hue >= 0)        HUE = c.hue;
+    if (c.saturation >= 0) SATURATION = c.saturation;
+    if (c.brightness >= 0) BRIGHTNESS = c.brightness;
+    if (c.steps >= 0)      STEPS = c.steps;
+    if (c.effect)          effect = c.effect;
+    return;
+  }
 }
 
+// Draw one frame of the current effect
+void renderFrame() {
+  effect();
+  FastLED.show();
+}
 
-void ledMode(int i) {
-  switch(i){
-    case 0: HUE=0; SATURATION=255; BRIGHTNESS=200; Solid();    // red
-            break;
-    case 1: HUE=40; SATURATION=255; BRIGHTNESS=200; Solid();    // gold
-            break;
-    case 2: HUE=100; SATURATION=255; BRIGHTNESS=200; Solid();    // green
-            break;
-    case 3: HUE=140; SATURATION=255; BRIGHTNESS=200; Solid();    // Blue   
-            break;
-    case 4: HUE=180; SATURATION=255; BRIGHTNESS=200; Solid();    // purple
-            break;
-    case 5: HUE=220; SATURATION=255; BRIGHTNESS=200; Solid();    // pink
-            break;
-    case 6: HUE=0; SATURATION=0; BRIGHTNESS=200; Solid();    // white
-            break;
-    case 7: HUE=0; BRIGHTNESS=0; Solid();    // off
-            break;
-    case 8: HUE=0; SATURATION=255; BRIGHTNESS=200; Gradient();    // red
-            break;
-    case 9: HUE=40; SATURATION=255; BRIGHTNESS=200; Gradient();    // gold
-            break;
-    case 10: HUE=100; SATURATION=255; BRIGHTNESS=200; Gradient();    // green
-            break;
-    case 11: HUE=140; SATURATION=255; BRIGHTNESS=200; Gradient();    // blue
-            break;
-    case 12:HUE=180; SATURATION=255; BRIGHTNESS=200; Gradient();    // purple
-            break;
-    case 13:HUE=220; SATURATION=255; BRIGHTNESS=200; Gradient();    // pink
-            break;
-    case 14:HUE=160; SATURATION=50; BRIGHTNESS=200; Gradient();    // white
-            break;
-    case 15:SATURATION=255; BRIGHTNESS=200; Rainbow_Fade();    // rainbow fade
-            break;
-    case 16:STEPS=4; SATURATION=255; BRIGHTNESS=200; Rainbow();   //rainbow 2
-            break;
-    case 17:STEPS=20; BRIGHTNESS=200; SATURATION=255; Rainbow();    // rainbow 3
-            break;
-    case 20:BRIGHTNESS=200;
-            break;
-            
-  }
+void printLatency() {
+  Serial.print("Commands: ");    Serial.print(latencyCount);
+  Serial.print(" latency avg "); Serial.print(latencySum / latencyCount);
+  Serial.print(" max ");         Serial.print(latencyMax);
+  Serial.print(" us, dropped "); Serial.println(dropped);
 }
 
 // GRADIENT --------------------------------------------------------------
@@ -306,17 +266,12 @@ void Gradient()
   static uint8_t startIndex = 0;
   startIndex = startIndex + 1;  // motion speed
   FillLEDsFromPaletteColors( startIndex);
-  FastLED.show();
-  FastLED.delay(SPEEDO);
 }
 
 // SOLID ----------------------------------------------------
 void Solid()
 {
    fill_solid(leds, NUM_LEDS, CHSV(HUE, SATURATION, BRIGHTNESS)); 
-   FastLED.show(); 
-   delay(20); 
-
 }
 
 // RAINBOW --------------------------------------------------
@@ -329,9 +284,6 @@ void Rainbow()
   startIndex = startIndex + 1; 
 
   FillLEDsFromPaletteColors( startIndex);
-    
-  FastLED.show();
-  FastLED.delay(SPEEDO);  
 }
 // RAINBOW FADE --------------------------------------------------
 void Rainbow_Fade() {                         //-m2-FADE ALL LEDS THROUGH HSV RAINBOW
@@ -340,8 +292,6 @@ void Rainbow_Fade() {                         //-m2-FADE ALL LEDS THROUGH HSV RA
     for(int idex = 0 ; idex < NUM_LEDS; idex++ ) {
       leds[idex] = CHSV(HUE, SATURATION, BRIGHTNESS);
     }
-    LEDS.show();    
-    delay(SPEEDO);
 }
 
 
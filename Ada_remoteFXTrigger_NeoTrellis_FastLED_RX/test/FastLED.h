@@ -0,0 +1,72 @@
+// FastLED and Arduino stand-ins for radio_test.cpp. Time is simulated:
+// fakeMicros only moves when the test, delay() or show() moves it.
+#pragma once
+#include <stdint.h>
+#include <string.h>
+#include <stdio.h>
+#include <deque>
+
+typedef uint8_t byte;
+extern uint64_t fakeMicros;
+inline uint32_t micros() { return (uint32_t)fakeMicros; }
+inline uint32_t millis() { return (uint32_t)(fakeMicros / 1000); }
+inline void delay(uint32_t ms) { fakeMicros += ms * 1000ULL; }
+inline void pinMode(int, int) { }
+inline void digitalWrite(int, int) { }
+#define OUTPUT 1
+#define HIGH   1
+#define LOW    0
+#define DEC    10
+
+struct SerialT {                   // Output dropped; the test prints its own
+  template <class T> void print(T) { }
+  template <class T> void print(T, int) { }
+  template <class T> void println(T) { }
+};
+extern SerialT Serial;
+
+struct CHSV {
+  uint8_t h, s, v;
+  CHSV(int h, int s, int v) : h(h), s(s), v(v) { }
+};
+struct CRGB {
+  uint8_t r, g, b;
+  enum { Black = 0 };
+  CRGB() : r(0), g(0), b(0) { }
+  CRGB(int) : r(0), g(0), b(0) { }
+  CRGB(const CHSV &c) : r(c.h), g(c.s), b(c.v) { }
+};
+struct CRGBPalette16 {
+  CRGB e[16];
+  CRGBPalette16() { }
+  CRGBPalette16(int) { }
+  CRGBPalette16(CRGB a, CRGB b, CRGB c, CRGB d, CRGB e1, CRGB f, CRGB g, CRGB h,
+                CRGB i, CRGB j, CRGB k, CRGB l, CRGB m, CRGB n, CRGB o, CRGB p) {
+    CRGB x[16] = { a, b, c, d, e1, f, g, h, i, j, k, l, m, n, o, p };
+    memcpy(e, x, sizeof e);
+  }
+};
+static const int PartyColors_p = 1, RainbowColors_p = 2;
+typedef int TBlendType;
+template <int N> struct CRGBArray {
+  CRGB d[N];
+  CRGB &operator[](int i) { return d[i]; }
+  operator CRGB *() { return d; }
+};
+inline CRGB ColorFromPalette(const CRGBPalette16 &p, uint8_t i, uint8_t, TBlendType) {
+  return p.e[i >> 4];
+}
+inline void fill_solid(CRGB *l, int n, CRGB c) { for (int i = 0; i < n; i++) l[i] = c; }
+
+struct Ctl { Ctl &setCorrection(int) { return *this; } };
+struct FastLEDT {
+  int shows = 0;
+  void show() { fakeMicros += 600; shows++; }    // 20 pixels plus latch
+  void setBrightness(int) { }
+  void delay(int ms) { fakeMicros += ms * 1000ULL; }
+  template <int T, int P, int O, class L> Ctl addLeds(L, int) { return Ctl(); }
+};
+extern FastLEDT FastLED;
+#define WS2812B         0
+#define GRB             0
+#define TypicalLEDStrip 0
@@ -0,0 +1 @@
+// Empty: the sketch includes it but the test needs nothing from it
@@ -0,0 +1,61 @@
+// Host test for the remoteFXTrigger receiver sketch. Runs on a PC, not
+// the board; the headers next to this file stand in for FastLED, RadioHead
+// and Arduino, with simulated time.
+//
+// Sends bursts of 3 button packets 2 ms apart every 300 ms for 10 seconds
+// and counts frames drawn, packets the radio lost because one was still
+// waiting to be read, and the time from a packet's pickup to show().
+//
+//   g++ -O2 -I. -o radio_test radio_test.cpp
+//   ./radio_test
+//
+// Exits nonzero if a packet is lost or the frame rate falls below
+// UPDATES_PER_SECOND. To measure an older version of the sketch, build
+// with -DSKETCH='"old.ino"' -DOLD_SKETCH (it only reports).
+
+#include "FastLED.h"
+#include "RH_RF69.h"
+
+uint64_t fakeMicros = 0;
+SerialT Serial;
+FastLEDT FastLED;
+std::deque<Pkt> air;
+
+// What the Arduino IDE would generate, for this and the older sketch
+void Solid(); void Gradient(); void Rainbow(); void Rainbow_Fade();
+void renderFrame(); void receivePackets(); void runCommand(char);
+void printLatency(); void ledMode(int);
+void SetupGradientPalette(); void FillLEDsFromPaletteColors(uint8_t);
+#define LEDS FastLED
+#define ARDUINO_SAMD_FEATHER_M0     // pick a board's radio pins
+
+#ifndef SKETCH
+#define SKETCH "../Ada_remoteFXTrigger_NeoTrellis_FastLED_RX.ino"
+#endif
+#include SKETCH
+
+int main(void) {
+  setup();
+  const char *keys = "ABCIJKPQRZH";
+  int k = 0, sent = 0;
+  for (uint64_t t = 4000000; t < 14000000; t += 300000) {
+    for (int i = 0; i < 3; i++, sent++) air.push_back({ t + i * 2000, keys[k++ % 11] });
+  }
+
+  int frames0 = FastLED.shows;
+  uint64_t t0 = fakeMicros;
+  while (fakeMicros < 15000000) {
+    loop();
+    fakeMicros += 50;                       // the rest of a loop() pass
+  }
+  double secs = (fakeMicros - t0) / 1e6;
+  double fps = (FastLED.shows - frames0) / secs;
+  printf("%d packets: %.1f fps, %d lost in the radio\n", sent, fps, rf69.lost);
+#ifdef OLD_SKETCH
+  return 0;
+#else
+  printf("%u commands run, pickup to show() avg %u us, max %u us, %u dropped\n",
+         latencyCount, latencySum / latencyCount, latencyMax, dropped);
+  return (rf69.lost || dropped || fps < UPDATES_PER_SECOND) ? 1 : 0;
+#endif
+}
@@ -0,0 +1,158 @@
+// Host test for ByteRing.h (the same file in both streaming mp3 players).
+// Runs on a PC, not the board.
+//
+// A producer thread and a consumer thread pass a pseudo-random stream
+// through a ByteRing<8192>, in random chunks of 1-1500 bytes in (one
+// network read) and 1-2304 bytes out (one decoder frame), half of them
+// through write()/read() and half through the span calls. Every byte is
+// checked, and the watermark callbacks must fire. For comparison the same
+// stream then goes through the old way: a byte at a time, with the other
+// side locked out.
+//
+//   g++ -O2 -pthread -o bytering_test bytering_test.cpp
+//   ./bytering_test
+//
+// To look for races, build with -fsanitize=thread -DTOTAL_MIB=16. Exits
+// nonzero on failure.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <thread>
+#include <mutex>
+#include <atomic>
+#include <chrono>
+#include <deque>
+#include "streaming_nativemp3_player/ByteRing.h"
+
+#ifndef TOTAL_MIB
+#define TOTAL_MIB 256
+#endif
+
+static const uint64_t TOTAL = (uint64_t)TOTAL_MIB << 20;
+
+static ByteRing<8192> ring;
+static std::atomic<long> highs(0), lows(0);
+static void onHigh() { highs++; }
+static void onLow() { lows++; }
+
+static inline uint8_t streamByte(uint64_t i) {
+  return (uint8_t)((i * 2654435761u) >> 13) ^ (uint8_t)(i >> 20);
+}
+
+static double seconds(std::chrono::steady_clock::time_point since) {
+  return std::chrono::duration<double>(std::chrono::steady_clock::now() - since).count();
+}
+
+static void produce() {
+  uint8_t  tmp[1500];
+  uint64_t pos = 0;
+  unsigned seed = 1;
+  while (pos < TOTAL) {
+    unsigned want = 1 + rand_r(&seed) % sizeof tmp;
+    if (want > TOTAL - pos) want = TOTAL - pos;
+    ring_index_t n;
+    if (seed & 1) {
+      for (unsigned i = 0; i < want; i++) tmp[i] = streamByte(pos + i);
+      n = ring.write(tmp, want);
+    } else {
+      uint8_t *p = ring.writeSpan(&n);
+      if (n > want) n = want;
+      for (unsigned i = 0; i < n; i++) p[i] = streamByte(pos + i);
+      ring.commitWrite(n);
+    }
+    if (!n) std::this_thread::yield();
+    pos += n;
+  }
+}
+
+// Bytes that didn't match the stream
+static uint64_t consume() {
+  uint8_t  tmp[2304];
+  uint64_t pos = 0, bad = 0;
+  unsigned seed = 2;
+  while (pos < TOTAL) {
+    unsigned want = 1 + rand_r(&seed) % sizeof tmp;
+    ring_index_t n;
+    if (seed & 1) {
+      n = ring.read(tmp, want);
+      for (unsigned i = 0; i < n; i++) bad += (tmp[i] != streamByte(pos + i));
+    } else {
+      const uint8_t *p = ring.readSpan(&n);
+      if (n > want) n = want;
+      for (unsigned i = 0; i < n; i++) bad += (p[i] != streamByte(pos + i));
+      ring.commitRead(n);
+    }
+    if (!n) std::this_thread::yield();
+    pos += n;
+  }
+  return bad;
+}
+
+// The old way, a sixteenth as much: push() and shift() a byte at a time
+// with the other side locked out
+static uint64_t lockedBytes(double *secs) {
+  const uint64_t total = TOTAL >> 4;
+  std::deque<uint8_t> q;
+  std::mutex m;
+  std::chrono::steady_clock::time_point t0 = std::chrono::steady_clock::now();
+  std::thread producer([&] {
+    uint64_t pos = 0;
+    unsigned seed = 1;
+    while (pos < total) {
+      unsigned want = 1 + rand_r(&seed) % 1500;
+      if (want > total - pos) want = total - pos;
+      {
+        std::lock_guard<std::mutex> g(m);
+        if (want > 8000 - q.size()) want = 8000 - q.size();
+        for (unsigned i = 0; i < want; i++) q.push_back(streamByte(pos + i));
+      }
+      if (!want) std::this_thread::yield();
+      pos += want;
+    }
+  });
+  uint64_t pos = 0, bad = 0;
+  unsigned seed = 2;
+  while (pos < total) {
+    unsigned n = 1 + rand_r(&seed) % 2304;
+    {
+      std::lock_guard<std::mutex> g(m);
+      if (n > q.size()) n = q.size();
+      for (unsigned i = 0; i < n; i++) {
+        bad += (q.front() != streamByte(pos + i));
+        q.pop_front();
+      }
+    }
+    if (!n) std::this_thread::yield();
+    pos += n;
+  }
+  producer.join();
+  *secs = seconds(t0);
+  return bad;
+}
+
+static int failures = 0;
+
+static void check(bool ok, const char *what) {
+  if (!ok) { printf("FAIL: %s\n", what); failures++; }
+}
+
+int main(void) {
+  ring.setWatermarks(128, onLow, 6000, onHigh);
+  std::chrono::steady_clock::time_point t0 = std::chrono::steady_clock::now();
+  std::thread producer(produce);
+  uint64_t bad = consume();
+  producer.join();
+  double s = seconds(t0);
+  printf("ByteRing:          %4u MiB in %5.2f s = %4.0f MB/s, %llu bad bytes, "
+         "%ld high / %ld low watermark calls\n", TOTAL_MIB, s, TOTAL / s / 1e6,
+         (unsigned long long)bad, highs.load(), lows.load());
+  check(bad == 0, "every byte through the ring");
+  check(ring.size() == 0, "ring empty at the end");
+  check(highs > 0 && lows > 0, "watermark callbacks");
+
+  bad = lockedBytes(&s);
+  printf("locked push/shift: %4u MiB in %5.2f s = %4.0f MB/s, %llu bad bytes\n",
+         TOTAL_MIB / 16, s, (TOTAL >> 4) / s / 1e6, (unsigned long long)bad);
+
+  return failures ? 1 : 0;
+}
@@ -0,0 +1,128 @@
+// Single-producer, single-consumer byte ring
+//
+// One side only writes (the loop reading WiFi) and the other only reads
+// (the decoder, even from an interrupt), so neither needs interrupts off:
+// each index is changed by one side only, and moved on only after the
+// bytes it covers. Bytes go in and out with memcpy, at most two spans per
+// call -- or with writeSpan()/readSpan() a network read can land straight
+// in the ring and the decoder can take data straight out of it.
+//
+// Watermarks: onHigh() runs, on the writing side, when a write fills the
+// ring to 'high' bytes or more; onLow() runs, on the reading side, when a
+// read takes it down to 'low' bytes or fewer.
+
+#ifndef BYTE_RING_H
+#define BYTE_RING_H
+
+#include <stdint.h>
+#include <string.h>
+
+#if defined(__AVR__)
+  typedef uint8_t ring_index_t;  // AVR loads and stores one byte atomically
+  #define RING_LOAD(p)     ({ ring_index_t v_ = *(volatile ring_index_t *)(p); \
+                              asm volatile("" ::: "memory"); v_; })
+  #define RING_STORE(p, v) do { asm volatile("" ::: "memory"); \
+                              *(volatile ring_index_t *)(p) = (v); } while(0)
+#else
+  typedef uint32_t ring_index_t;
+  #define RING_LOAD(p)     __atomic_load_n(p, __ATOMIC_ACQUIRE)
+  #define RING_STORE(p, v) __atomic_store_n(p, v, __ATOMIC_RELEASE)
+#endif
+
+template <ring_index_t SIZE>
+class ByteRing {
+  static_assert((SIZE & (SIZE - 1)) == 0, "ByteRing size must be a power of 2");
+  static_assert(SIZE <= (ring_index_t)~(ring_index_t)0 / 2 + 1, "ByteRing too big for its index");
+
+ public:
+  typedef void (*Callback)(void);
+
+  ByteRing() : head(0), tail(0), low(0), high(SIZE), onLow(NULL), onHigh(NULL) {}
+
+  void setWatermarks(ring_index_t lowMark, Callback lowFn,
+                     ring_index_t highMark, Callback highFn) {
+    low = lowMark;
+    onLow = lowFn;
+    high = highMark;
+    onHigh = highFn;
+  }
+
+  // Bytes waiting to be read, and room left to write
+  ring_index_t size() const {
+    return (ring_index_t)(RING_LOAD(&head) - RING_LOAD(&tail));
+  }
+  ring_index_t available() const { return SIZE - size(); }
+
+  // Writing side: the free space at the write position, as one contiguous
+  // span of *n bytes. Fill some of it, then commitWrite() that many.
+  uint8_t *writeSpan(ring_index_t *n) {
+    ring_index_t h = head;
+    ring_index_t room = SIZE - (ring_index_t)(h - RING_LOAD(&tail));
+    ring_index_t run = SIZE - (h & (SIZE - 1));
+    *n = (room < run) ? room : run;
+    return &data[h & (SIZE - 1)];
+  }
+
+  void commitWrite(ring_index_t n) {
+    ring_index_t h = head + n;
+    RING_STORE(&head, h);
+    if (onHigh) {
+      ring_index_t fill = h - RING_LOAD(&tail);
+      if ((fill >= high) && ((fill < n) || (ring_index_t)(fill - n) < high)) onHigh();
+    }
+  }
+
+  // Writing side: copy in as much of src as fits; returns bytes written
+  ring_index_t write(const uint8_t *src, ring_index_t n) {
+    ring_index_t h = head;
+    ring_index_t room = SIZE - (ring_index_t)(h - RING_LOAD(&tail));
+    if (n > room) n = room;
+    ring_index_t off = h & (SIZE - 1);
+    ring_index_t first = (n < SIZE - off) ? n : SIZE - off;
+    memcpy(&data[off], src, first);
+    memcpy(data, src + first, n - first);  // any part that wraps
+    commitWrite(n);
+    return n;
+  }
+
+  // Reading side: the bytes waiting at the read position, as one
+  // contiguous span of *n bytes. Use some of them, then commitRead().
+  const uint8_t *readSpan(ring_index_t *n) {
+    ring_index_t t = tail;
+    ring_index_t fill = (ring_index_t)(RING_LOAD(&head) - t);
+    ring_index_t run = SIZE - (t & (SIZE - 1));
+    *n = (fill < run) ? fill : run;
+    return &data[t & (SIZE - 1)];
+  }
+
+  void commitRead(ring_index_t n) {
+    ring_index_t t = tail + n;
+    RING_STORE(&tail, t);
+    if (onLow) {
+      ring_index_t fill = RING_LOAD(&head) - t;
+      if ((fill <= low) && (fill + n > low)) onLow();
+    }
+  }
+
+  // Reading side: copy out up to n bytes; returns bytes read
+  ring_index_t read(uint8_t *dst, ring_index_t n) {
+    ring_index_t t = tail;
+    ring_index_t fill = (ring_index_t)(RING_LOAD(&head) - t);
+    if (n > fill) n = fill;
+    ring_index_t off = t & (SIZE - 1);
+    ring_index_t first = (n < SIZE - off) ? n : SIZE - off;
+    memcpy(dst, &data[off], first);
+    memcpy(dst + first, data, n - first);
+    commitRead(n);
+    return n;
+  }
+
+ private:
+  uint8_t data[SIZE];
+  ring_index_t head;                // bytes ever written; changed by writer only
+  ring_index_t tail;                // bytes ever read; changed by reader only
+  ring_index_t low, high;
+  Callback onLow, onHigh;
+};
+
+#endif // BYTE_RING_H
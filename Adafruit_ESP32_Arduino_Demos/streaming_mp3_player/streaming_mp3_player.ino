@@ -3,8 +3,8 @@
 #include <SPI.h>
 #include <Adafruit_VS1053.h>
 #include <WiFiNINA.h>
-#include <CircularBuffer.h>
 #include "arduino_secrets.h" 
+#include "ByteRing.h"
 
 ///////please enter your sensitive data in the Secret tab/arduino_secrets.h
 char ssid[] = SECRET_SSID;        // your network SSID (name)
@@ -79,12 +79,12 @@ WiFiClient client;
 int lastvol = 20;
 
 #if defined (__AVR__)
-  #define BUFFER_SIZE 128
+  #define BUFFER_SIZE 128     // must be a power of 2
 #else
-  #define BUFFER_SIZE 1500
+  #define BUFFER_SIZE 2048
 #endif
 
-CircularBuffer<uint8_t, BUFFER_SIZE> buffer;
+ByteRing<BUFFER_SIZE> buffer;
   
 void setup() {
   Serial.begin(115200);
@@ -143,32 +143,33 @@ void loop() {
 #endif
 
   // Prioritize reading data from the ESP32 into the buffer (it sometimes stalls)
-  while (client.available() && buffer.available()) {
-    uint8_t minibuff[BUFFER_SIZE];
-
-    int bytesread = client.read(minibuff, buffer.available());
+  // Reads land straight in the free space of the ring, up to two per pass
+  // when the free space wraps around the end
+  for (uint8_t i=0; i<2 && client.available(); i++) {
+    ring_index_t room;
+    uint8_t *span = buffer.writeSpan(&room);
+    if (!room) break;
+
+    int bytesread = client.read(span, room);
 #if defined(DEBUG)
     Serial.print(F("Client read: ")); Serial.println(bytesread);
 #endif
-    for (int i=0; i<bytesread; i++) {
-      buffer.push(minibuff[i]);      // push every byte we read
-    }
+    if (bytesread <= 0) break;
+    buffer.commitWrite(bytesread);
   }
 
   // OK if we can't buffer more, see if we should play!
   if (musicPlayer.readyForData() && (buffer.size() > 0)) {
-    //wants more data! check we have something available from the stream
-    uint8_t mp3buff[32];   // vs1053 likes 32 bytes at a time
-
-    int byteswrite = min(32, buffer.size());
+    //wants more data! send it straight from the ring
+    ring_index_t byteswrite;
+    const uint8_t *mp3buff = buffer.readSpan(&byteswrite);
+    if (byteswrite > 32) byteswrite = 32;   // vs1053 likes 32 bytes at a time
 #if defined(DEBUG)
     Serial.print(F("MP3 write: ")); Serial.println(byteswrite);
 #endif
 
     // push to mp3
-    for (int i=0; i<byteswrite; i++) {
-      mp3buff[i] = buffer.shift();      // push every byte we read
-    }
-    musicPlayer.playData(mp3buff, byteswrite);
+    musicPlayer.playData((uint8_t *)mp3buff, byteswrite);
+    buffer.commitRead(byteswrite);
   }
 }
@@ -4,11 +4,11 @@
 
 #include <SPI.h>
 #include <WiFiNINA.h>
-#include <CircularBuffer.h>  // From Agileware
 #include <Adafruit_MP3.h>
 #include <Adafruit_GFX.h>
 #include <Adafruit_ILI9341.h>
 #include "arduino_secrets.h" 
+#include "ByteRing.h"
 
 ///////please enter your sensitive data in the Secret tab/arduino_secrets.h
 char ssid[] = SECRET_SSID;        // your network SSID (name)
@@ -36,11 +36,58 @@ String host, path;
 int port = 80;
 
 Adafruit_MP3 player;  // The MP3 player
-#define BUFFER_SIZE 8000     // we need a lot of buffer to keep from underruns! but not too big?
-CircularBuffer<uint8_t, BUFFER_SIZE> buffer;
+#define BUFFER_SIZE 16384    // we need a lot of buffer to keep from underruns! (power of 2)
+#define RESUME_LEVEL 6000    // start playing once this much is buffered, until we know better
+#define MIN_RESUME_LEVEL 2048
+#define MAX_RESUME_LEVEL (BUFFER_SIZE - 2048)
+#define UNDERRUN_LEVEL 128   // stop and rebuffer when down to this
+ByteRing<BUFFER_SIZE> buffer;
 bool paused = true;
+bool started = false;        // has played since power up
+volatile bool rebuffer = false;
 float gain = 1;
 
+// Stream connection: reconnects in the background if it drops, asking to
+// carry on where it left off if the server takes Range requests (files do,
+// live radio doesn't -- that just picks up wherever the broadcast is now)
+#define RECONNECT_MIN 500    // ms before first retry, doubling up to...
+#define RECONNECT_MAX 8000
+enum { STREAM_IDLE, STREAM_HEADERS, STREAM_BODY };
+uint8_t streamState = STREAM_IDLE;
+uint32_t nextConnect = 0, reconnectDelay = RECONNECT_MIN;
+uint32_t streamOffset = 0;   // body bytes of a file so far, for Range
+uint32_t streamLength = 0;   // whole file, if the server said
+uint32_t skipBytes = 0;      // server ignored Range, drop what we had
+bool resumable = false;      // server has a length and takes Range
+char headerLine[100];
+uint8_t headerLen = 0;
+int httpStatus = 0;
+
+// ICY (shoutcast) metadata: with "Icy-MetaData: 1" the server puts song
+// titles every metaInt bytes of audio, a length byte (x16) then the text.
+// They're cut out before the audio goes into the buffer.
+uint32_t metaInt = 0, audioLeft = 0;
+int metaLeft = -1;           // -1 = the next byte is the length byte
+char metaText[81];
+uint8_t metaTextLen = 0;
+
+// Jitter buffer: rather than always restarting at 6000 bytes, the resume
+// level follows how the network behaves. Every STATS_MS we compare what
+// arrived with what the decoder takes (bitrate, measured while playing).
+// Windows that come up short add to a running shortfall -- the stall we'd
+// have ridden out from the buffer -- and the worst recent shortfall, plus
+// half a second, is the level to rebuffer to.
+#define STATS_MS 250
+#define STATUS_MS 10000      // print counters this often
+uint32_t resumeLevel = RESUME_LEVEL;
+uint32_t arrived = 0;        // body bytes in the current window
+volatile uint32_t consumed = 0;  // bytes taken by the decoder, ever
+uint32_t lastConsumed = 0;
+uint32_t byteRate = 0;       // bytes/second the stream plays at
+int32_t shortfall = 0, worstShortfall = 0;
+uint32_t lastStats = 0, lastStatus = 0;
+uint32_t underruns = 0, rebuffers = 0, reconnects = 0, decodeErrors = 0;
+
 void setup() {
   Serial.begin(115200);
   //while (!Serial);
@@ -97,6 +144,9 @@ void setup() {
   //do this when more data is required
   player.setBufferCallback(getMoreData);
 
+  // resume once resumeLevel bytes are in, pause if down to UNDERRUN_LEVEL
+  buffer.setWatermarks(UNDERRUN_LEVEL, bufferEmptied, resumeLevel, bufferFilled);
+
   analogWrite(A0, 2048);
   player.play();
   player.pause();
@@ -112,34 +162,55 @@ void setup() {
   Serial.println("WiFi connected");  
   Serial.println("IP address: ");  Serial.println(WiFi.localIP());
 
-  connectStream();
+  nextConnect = millis();  // loop() connects to the stream
 }
 
 
-void connectStream(void) {
+// WiFi calls like connect() can block for seconds, spinning in delay(),
+// which calls yield() -- so keep the decoder going from there
+void yield() {
+  static bool busy = false;
+  if (busy) return;
+  busy = true;
+  player.tick();
+  busy = false;
+}
+
+
+bool connectStream(void) {
   client.stop();
   /************************* INITIALIZE STREAM */
   Serial.print("Connecting to ");  Serial.println(host);
   
   if (!client.connect(host.c_str(), port)) {
     Serial.println("Connection failed");
-    while (1);
+    return false;
   }
   
   // We now create a URI for the request
   Serial.print("Requesting URL: "); Serial.println(path);
   
   // This will send the request to the server
-  client.print(String("GET ") + path + " HTTP/1.1\r\n" +
-               "Host: " + host + "\r\n" + 
-               "Connection: close\r\n\r\n");
+  String request = String("GET ") + path + " HTTP/1.1\r\n" +
+                   "Host: " + host + "\r\n" +
+                   "Icy-MetaData: 1\r\n";
+  if (resumable && streamOffset) {
+    Serial.print("Resuming at byte "); Serial.println(streamOffset);
+    request += String("Range: bytes=") + streamOffset + "-\r\n";
+  }
+  client.print(request + "Connection: close\r\n\r\n");
+
+  streamState = STREAM_HEADERS;
+  headerLen = 0;
+  httpStatus = 0;
+  skipBytes = 0;
+  metaInt = 0;
+  metaLeft = -1;
+  return true;
 }
 
 
 void loop() {
-  if (!client.connected()) {
-    connectStream();
-  }
 #ifdef DEBUG_OUTPUT
   Serial.print("Client Avail: "); Serial.print(client.available());
   Serial.print("\tBuffer Avail: "); Serial.println(buffer.available());
@@ -148,27 +219,66 @@ void loop() {
 
   if (ret != 0) {   // some error, best to pause & rebuffer
     Serial.print("MP3 error: "); Serial.println(ret);
-    player.pause(); paused = true;
+    decodeErrors++;
+    rebuffer = true;
   }
-  if ( paused && (buffer.size() > 6000)) {  // buffered, restart!
-    player.resume(); paused = false;
+  if (rebuffer) {
+    rebuffer = false;
+    if (!paused) {
+      player.pause(); paused = true;
+      rebuffers++;
+    }
+    if (buffer.size() >= resumeLevel) {  // already plenty, go again
+      bufferFilled();
+    }
   }
 
-  // Prioritize reading data from the ESP32 into the buffer (it sometimes stalls)
-  if (client.available() && buffer.available()) {
-   
-    uint8_t minibuff[BUFFER_SIZE];
+  readStream();
+  updateStats();
+}
 
-    int bytesread = client.read(minibuff, buffer.available());
+
+// Keep the buffer filled from the stream, reconnecting if it dropped
+void readStream() {
+  if (!client.connected() && !client.available()) {
+    if (streamState != STREAM_IDLE) {
+      if (streamLength && streamOffset >= streamLength) {
+        Serial.println("End of stream, starting over");
+        streamOffset = 0;
+      } else {
+        Serial.println("Stream dropped");
+      }
+      streamState = STREAM_IDLE;
+      retryLater();
+    }
+    if ((int32_t)(millis() - nextConnect) < 0) return;
+    if (connectStream()) {
+      reconnects += started;
+    } else {
+      retryLater();
+    }
+    return;
+  }
+
+  if (streamState == STREAM_HEADERS) {
+    readHeaders();
+    return;
+  }
+
+  // Prioritize reading data from the ESP32 into the buffer (it sometimes stalls)
+  // Reads land straight in the free space of the ring; no interrupts off,
+  // the decoder can keep taking data while we add it
+  ring_index_t room;
+  uint8_t *span = buffer.writeSpan(&room);
+  if (client.available() && room) {
+    int bytesread = client.read(span, room);
 #ifdef DEBUG_OUTPUT
     Serial.print("Client read: "); Serial.print(bytesread);
 #endif
-
-    noInterrupts();
-    for (int i=0; i<bytesread; i++) {
-      buffer.push(minibuff[i]);      // push every byte we read
+    if (bytesread > 0) {
+      arrived += bytesread;
+      buffer.commitWrite(takeBody(span, bytesread));  // may call bufferFilled()
     }
-    interrupts();
 #ifdef DEBUG_OUTPUT
     Serial.println(" OK");
 #endif
@@ -176,6 +286,182 @@ void loop() {
 }
 
 
+// Back off a little more each time the stream fails, until it works again
+void retryLater() {
+  nextConnect = millis() + reconnectDelay;
+  reconnectDelay = min(reconnectDelay * 2, (uint32_t)RECONNECT_MAX);
+}
+
+
+// Read the HTTP response headers a few bytes at a time. Never more than the
+// ring has room for: whatever follows the headers is counted as played
+// from streamOffset once it's read, so it must all go in.
+void readHeaders() {
+  uint8_t chunk[64];
+  int want = min(client.available(), (int)sizeof(chunk));
+  want = min(want, (int)buffer.available());
+  if (want <= 0) return;
+  int n = client.read(chunk, want);
+  for (int i = 0; i < n; i++) {
+    char c = chunk[i];
+    if (c == '\r') continue;
+    if (c != '\n') {
+      if (headerLen < sizeof(headerLine) - 1) headerLine[headerLen++] = c;
+      continue;
+    }
+    headerLine[headerLen] = 0;
+    headerLen = 0;
+    if (headerLine[0]) {
+      headerReceived(headerLine);
+      continue;
+    }
+
+    // Blank line, headers done
+    Serial.print("HTTP status "); Serial.println(httpStatus);
+    if (httpStatus == 416) {  // asked for past the end, so it's finished
+      streamOffset = 0;
+    }
+    if (httpStatus != 200 && httpStatus != 206) {
+      client.stop();  // try again later
+      return;
+    }
+    reconnectDelay = RECONNECT_MIN;
+    skipBytes = 0;
+    if (httpStatus == 200) {
+      skipBytes = resumable ? streamOffset : 0;  // Range ignored, or live
+      if (!resumable) streamOffset = 0;
+    }
+    audioLeft = metaInt;
+    streamState = STREAM_BODY;
+    // anything after the headers is the start of the stream
+    int rest = takeBody(chunk + i + 1, n - i - 1);
+    arrived += n - i - 1;
+    buffer.write(chunk + i + 1, rest);  // fits, see above
+    return;
+  }
+}
+
+void headerReceived(char *line) {
+  Serial.println(line);
+  if (!strncmp(line, "HTTP/", 5) || !strncmp(line, "ICY ", 4)) {
+    char *space = strchr(line, ' ');
+    httpStatus = space ? atoi(space + 1) : 0;
+    resumable = false;
+    streamLength = 0;
+  } else if (!strncasecmp(line, "icy-metaint:", 12)) {
+    metaInt = atol(line + 12);
+  } else if (!strncasecmp(line, "Accept-Ranges: bytes", 20)) {
+    resumable = true;
+  } else if (!strncasecmp(line, "Content-Range:", 14)) {
+    resumable = true;
+    char *slash = strchr(line, '/');    // bytes first-last/total
+    if (slash) streamLength = atol(slash + 1);
+  } else if (!strncasecmp(line, "Content-Length:", 15) && httpStatus == 200) {
+    streamLength = atol(line + 15);
+  }
+}
+
+// Body bytes just read in place at p: cut out ICY metadata, and any bytes
+// being skipped, moving the audio down. Returns the audio bytes left.
+int takeBody(uint8_t *p, int n) {
+  int out = 0, i = 0;
+  while (i < n) {
+    if (metaInt && !audioLeft) {  // in a metadata block
+      if (metaLeft < 0) {
+        metaLeft = p[i++] * 16;
+        metaTextLen = 0;
+      } else {
+        int k = min(metaLeft, n - i);
+        for (int j = 0; j < k; j++) {
+          if (metaTextLen < sizeof(metaText) - 1) metaText[metaTextLen++] = p[i + j];
+        }
+        i += k;
+        metaLeft -= k;
+      }
+      if (!metaLeft) {
+        metaText[metaTextLen] = 0;
+        if (metaTextLen) Serial.println(metaText);  // StreamTitle='...';
+        metaLeft = -1;
+        audioLeft = metaInt;
+      }
+      continue;
+    }
+
+    int k = n - i;
+    if (metaInt && (uint32_t)k > audioLeft) k = audioLeft;
+    if (metaInt) audioLeft -= k;
+    if (skipBytes) {
+      int skip = min((uint32_t)k, skipBytes);
+      skipBytes -= skip;
+      i += skip;
+      k -= skip;
+    }
+    if (out != i) memmove(p + out, p + i, k);
+    out += k;
+    i += k;
+    streamOffset += k;
+  }
+  return out;
+}
+
+
+// Measure the stream, size the jitter buffer, and now and then print how
+// it's going
+void updateStats() {
+  uint32_t now = millis();
+  if (now - lastStats < STATS_MS) return;
+  lastStats = now;
+
+  uint32_t used = consumed - lastConsumed;
+  lastConsumed = consumed;
+  if (!paused && used) {
+    uint32_t rate = used * (1000 / STATS_MS);
+    byteRate = byteRate ? byteRate + ((int32_t)(rate - byteRate) / 8) : rate;
+  }
+  if (byteRate) {
+    shortfall += (int32_t)(byteRate / (1000 / STATS_MS)) - (int32_t)arrived;
+    if (shortfall < 0) shortfall = 0;
+    worstShortfall -= worstShortfall / 64;  // forget old stalls, slowly
+    if (shortfall > worstShortfall) worstShortfall = shortfall;
+    resumeLevel = worstShortfall + byteRate / 2;
+    resumeLevel = constrain(resumeLevel, MIN_RESUME_LEVEL, MAX_RESUME_LEVEL);
+    buffer.setWatermarks(UNDERRUN_LEVEL, bufferEmptied, resumeLevel, bufferFilled);
+  }
+  arrived = 0;
+
+  // the level may have dropped below what's buffered, or the buffer filled
+  if (paused && (buffer.size() >= resumeLevel || !buffer.available())) {
+    bufferFilled();
+  }
+
+  if (now - lastStatus >= STATUS_MS) {
+    lastStatus = now;
+    Serial.print("Buffer "); Serial.print(buffer.size());
+    Serial.print("/"); Serial.print(resumeLevel);
+    Serial.print(" rate "); Serial.print(byteRate);
+    Serial.print(" B/s, underruns "); Serial.print(underruns);
+    Serial.print(", rebuffers "); Serial.print(rebuffers);
+    Serial.print(", reconnects "); Serial.print(reconnects);
+    Serial.print(", MP3 errors "); Serial.println(decodeErrors);
+  }
+}
+
+
+// buffer watermarks: filled is called from loop() as data comes in,
+// emptied from getMoreData() as the decoder takes it
+void bufferFilled() {
+  if (paused) {  // buffered, restart!
+    player.resume(); paused = false;
+    started = true;
+  }
+}
+
+void bufferEmptied() {
+  if (!paused) underruns++;
+  rebuffer = true;  // loop() pauses until we're back to resumeLevel
+}
+
+
 void writeDacs(int16_t l, int16_t r){
   uint16_t val = map(l, -32768, 32767, 0, 4095 * gain);
   analogWrite(A0, val);
@@ -194,8 +480,7 @@ int getMoreData(uint8_t *writeHere, int thisManyBytes){
   if (toWrite < 128) {
     return 0;    // we'll try again later!
   }
-  for (int i=0; i<toWrite; i++) {
-    writeHere[i] = buffer.shift();
-  }
+  toWrite = buffer.read(writeHere, toWrite);
+  consumed += toWrite;
   return toWrite;
 }
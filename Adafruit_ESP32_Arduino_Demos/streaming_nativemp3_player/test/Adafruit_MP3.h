@@ -0,0 +1,48 @@
+// A stand-in for Adafruit_MP3: no decoding, it just plays through its
+// input buffer at a steady byteRate while playing, as a decoder would for
+// a constant bitrate stream, topping it up from the buffer callback when
+// it's half empty, and keeps every byte it got. If the input runs dry,
+// that time is lost, as it is on the DAC.
+#pragma once
+#include <vector>
+#include "Arduino.h"
+
+class Adafruit_MP3 {
+ public:
+  uint32_t byteRate = 16000;
+  std::vector<uint8_t> played;  // Every byte taken, in order
+  uint32_t starved = 0;         // Ticks that ran out of input
+
+  void begin() { }
+  void setSampleReadyCallback(void (*fn)(int16_t, int16_t)) { sampleReady = fn; }
+  void setBufferCallback(int (*fn)(uint8_t *, int)) { bufferCallback = fn; }
+  void play() { playing = true; last = millis(); }
+  void pause() { playing = false; }
+  void resume() { playing = true; last = millis(); }
+
+  int tick() {
+    unsigned long now = millis();
+    if (!playing) return 0;
+    uint32_t due = (now - last) * byteRate / 1000;
+    last += due * 1000 / byteRate;
+    if (due > have) starved++;
+    have -= min(due, have);
+    if (have < sizeof(in) / 2) {
+      int n = bufferCallback(in, sizeof(in) - have);
+      if (n > 0) {
+        played.insert(played.end(), in, in + n);
+        have += n;
+        sampleReady(0, 0);
+      }
+    }
+    return 0;
+  }
+
+ private:
+  void (*sampleReady)(int16_t, int16_t) = NULL;
+  int (*bufferCallback)(uint8_t *, int) = NULL;
+  bool playing = false;
+  unsigned long last = 0;
+  uint8_t in[2048];
+  uint32_t have = 0;  // Bytes in the input buffer, not yet played
+};
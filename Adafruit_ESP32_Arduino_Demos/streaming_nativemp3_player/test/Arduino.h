@@ -0,0 +1,88 @@
+// Just enough of Arduino for streaming_nativemp3_player.ino on a PC, in
+// real time: millis() is the wall clock, delay() sleeps in small steps
+// calling yield() as the SAMD core does, and Serial keeps everything
+// printed so the test can look through it.
+#pragma once
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <time.h>
+#include <string>
+#include <type_traits>
+
+typedef uint8_t byte;
+typedef bool    boolean;
+
+#define A0 14
+
+#define min(a, b) ((a) < (b) ? (a) : (b))
+#define constrain(x, lo, hi) ((x) < (lo) ? (lo) : ((x) > (hi) ? (hi) : (x)))
+
+static inline long map(long x, long inMin, long inMax, long outMin, long outMax) {
+  return (x - inMin) * (outMax - outMin) / (inMax - inMin) + outMin;
+}
+
+static inline void analogWrite(int, int) { }
+
+static inline unsigned long millis() {
+  static struct timespec start;
+  struct timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  if (!start.tv_sec) start = now;
+  return (now.tv_sec - start.tv_sec) * 1000 + (now.tv_nsec - start.tv_nsec) / 1000000;
+}
+
+void yield();
+
+static inline void delay(unsigned long ms) {
+  unsigned long start = millis();
+  do {
+    yield();
+    struct timespec step = { 0, 1000000 };
+    nanosleep(&step, NULL);
+  } while (millis() - start < ms);
+}
+
+class String {
+ public:
+  String() { }
+  String(const char *s) : s(s) { }
+  String(const std::string &s) : s(s) { }
+  template <class N, class = typename std::enable_if<std::is_arithmetic<N>::value>::type>
+  String(N n) : s(std::to_string(n)) { }
+
+  const char *c_str() const { return s.c_str(); }
+  unsigned length() const { return s.size(); }
+  bool startsWith(const String &p) const { return s.compare(0, p.s.size(), p.s) == 0; }
+  int indexOf(char c) const {
+    size_t i = s.find(c);
+    return (i == std::string::npos) ? -1 : (int)i;
+  }
+  String substring(unsigned from) const { return (from < s.size()) ? s.substr(from) : ""; }
+  String substring(unsigned from, unsigned to) const {
+    return (from < s.size()) ? s.substr(from, to - from) : "";
+  }
+  long toInt() const { return atol(s.c_str()); }
+  String &operator+=(const String &t) { s += t.s; return *this; }
+  friend String operator+(String a, const String &b) { return a += b; }
+
+ private:
+  std::string s;
+};
+
+class SerialPort {
+ public:
+  std::string log;  // Everything printed
+
+  void begin(long) { }
+  template <class T> void print(const T &x) {
+    log += String(x).c_str();
+#ifdef ECHO_SERIAL
+    fputs(String(x).c_str(), stdout);
+#endif
+  }
+  template <class T> void println(const T &x) { print(x); print("\n"); }
+};
+static SerialPort Serial;
@@ -0,0 +1,2 @@
+// Nothing the sketch uses
+#pragma once
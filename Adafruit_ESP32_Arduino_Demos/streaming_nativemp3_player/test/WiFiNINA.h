@@ -0,0 +1,68 @@
+// WiFiNINA on a PC: the network is always up, and WiFiClient is a plain
+// TCP socket, never blocking on reads like the ESP32 co-processor.
+#pragma once
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/ioctl.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include "Arduino.h"
+
+#define WL_CONNECTED 3
+
+class WiFiClass {
+ public:
+  int begin(const char *, const char *) { return WL_CONNECTED; }
+  int status() { return WL_CONNECTED; }
+  const char *localIP() { return "127.0.0.1"; }
+};
+static WiFiClass WiFi;
+
+class WiFiClient {
+ public:
+  ~WiFiClient() { stop(); }
+
+  int connect(const char *host, uint16_t port) {
+    stop();
+    struct sockaddr_in addr = {};
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(port);
+    if (inet_pton(AF_INET, host, &addr.sin_addr) != 1) return 0;
+    fd = socket(AF_INET, SOCK_STREAM, 0);
+    if ((fd < 0) || ::connect(fd, (struct sockaddr *)&addr, sizeof(addr))) {
+      stop();
+      return 0;
+    }
+    return 1;
+  }
+
+  size_t print(const String &s) {
+    return (fd < 0) ? 0 : send(fd, s.c_str(), s.length(), MSG_NOSIGNAL);
+  }
+
+  // Open until the server has hung up and everything it sent is read
+  uint8_t connected() {
+    if (fd < 0) return 0;
+    char c;
+    return recv(fd, &c, 1, MSG_PEEK | MSG_DONTWAIT) != 0;
+  }
+
+  int available() {
+    int n = 0;
+    if ((fd < 0) || ioctl(fd, FIONREAD, &n)) return 0;
+    return n;
+  }
+
+  int read(uint8_t *buf, size_t size) {
+    if (fd < 0) return -1;
+    return recv(fd, buf, size, MSG_DONTWAIT);
+  }
+
+  void stop() {
+    if (fd >= 0) close(fd);
+    fd = -1;
+  }
+
+ private:
+  int fd = -1;
+};
@@ -0,0 +1,174 @@
+"""
+A stand-in radio station and podcast host for streaming_test.cpp, with
+the faults a real one over WiFi has.
+
+    GET /file?length=400000&rate=32000&metaint=8000&drop=30000
+    GET /live?rate=16000&metaint=8000&drop=30000
+    GET /file?length=400000&rate=20000&stall=60000&stallms=3000
+
+/file is a file 'length' bytes long. It takes Range requests (206, or 416
+past the end), unless ranges=0: then it still says Accept-Ranges but sends
+the whole file every time. /live is a broadcast that never ends, has no
+ranges, and starts each connection wherever the broadcast has got to.
+
+The body goes out at 'rate' bytes a second. With 'metaint', and the
+request asking for it, an ICY metadata block follows every 'metaint'
+bytes of audio, counted from the start of each connection: now a
+StreamTitle, now an empty one. 'drop' hangs up after that many bytes of
+body, metadata included, so it can cut a block in half; with 'drops', only
+on that many of the first connections to the URL. The first connection
+to reach audio byte 'stall' sends nothing for 'stallms' milliseconds.
+
+The audio is a count: 4 bytes for each word number, 7 bits a byte, most
+significant first, each with the top bit set. Text can't pass for it, and
+where a byte sits in the stream can be worked out from the bytes.
+
+Usage:
+    python3 stream_server.py [port]
+
+Port 0 (the default) picks a free one. The port is printed on the first
+line of output once the server is listening.
+"""
+
+import sys
+import threading
+import time
+from http.server import BaseHTTPRequestHandler, ThreadingHTTPServer
+from urllib.parse import urlsplit, parse_qs
+
+START = time.monotonic()
+CONNECTIONS = {}  # Connections to each URL, and whether one has stalled
+LOCK = threading.Lock()
+
+
+def audio(start, count):
+    """Audio bytes start..start+count"""
+    out = bytearray()
+    for pos in range(start, start + count):
+        word, byte = divmod(pos, 4)
+        out.append(0x80 | ((word >> (7 * (3 - byte))) & 0x7F))
+    return bytes(out)
+
+
+def metadata(block):
+    """The ICY metadata block after the given audio block: a length byte
+    (in 16s) and the text, zero padded"""
+    if block % 3 == 2:
+        return b'\x00'
+    text = f"StreamTitle='Test tone {block}';".encode()
+    text += b'\x00' * (-len(text) % 16)
+    return bytes([len(text) // 16]) + text
+
+
+class Handler(BaseHTTPRequestHandler):
+    def log_message(self, *args):
+        pass
+
+    def do_GET(self):
+        url = urlsplit(self.path)
+        args = {k: int(v[0]) for k, v in parse_qs(url.query).items()}
+        rate = args.get('rate', 16000)
+        metaint = args.get('metaint', 0) if self.headers.get('Icy-MetaData') == '1' else 0
+        if url.path == '/live':
+            start = int((time.monotonic() - START) * rate)
+            end = None
+            self.send_response(200)
+        elif url.path == '/file':
+            length = args.get('length', 100000)
+            start = 0
+            ranged = self.headers.get('Range', '')
+            if args.get('ranges', 1) and ranged.startswith('bytes='):
+                start = int(ranged[6:].split('-')[0])
+            if start >= length:
+                self.send_response(416)
+                self.send_header('Content-Range', f'bytes */{length}')
+                self.end_headers()
+                return
+            end = length
+            if start:
+                self.send_response(206)
+                self.send_header('Content-Range', f'bytes {start}-{length - 1}/{length}')
+            else:
+                self.send_response(200)
+                if not metaint:  # Not counting the metadata, so leave it out
+                    self.send_header('Content-Length', str(length))
+            self.send_header('Accept-Ranges', 'bytes')
+        else:
+            self.send_error(404)
+            return
+        self.send_header('Content-Type', 'audio/mpeg')
+        if metaint:
+            self.send_header('icy-metaint', str(metaint))
+        self.end_headers()
+        self.wfile.flush()
+        self.send_body(start, end, rate, metaint, args)
+
+    def faults(self, args):
+        """Where this connection drops (0 for never), and the record of
+        connections to the URL"""
+        with LOCK:
+            seen = CONNECTIONS.setdefault(self.path, [0, False])
+            seen[0] += 1
+            if seen[0] > args.get('drops', seen[0]):
+                return 0, seen
+        return args.get('drop', 0), seen
+
+    @staticmethod
+    def stall(pos, args, seen):
+        """Sleep for 'stallms' if this is the first connection to the URL
+        to get past audio byte 'stall'. Returns whether it slept."""
+        if not 0 <= args.get('stall', -1) < pos:
+            return False
+        with LOCK:
+            first = not seen[1]
+            seen[1] = True
+        if first:
+            time.sleep(args.get('stallms', 0) / 1000)
+        return first
+
+    def send_body(self, pos, end, rate, metaint, args):
+        """Audio from pos to end (None for never), with metadata every
+        metaint bytes, at rate bytes a second"""
+        sent = in_block = block = 0
+        drop, seen = self.faults(args)
+        next_send = time.monotonic()
+        while end is None or pos < end:
+            chunk = rate // 50
+            if end is not None:
+                chunk = min(chunk, end - pos)
+            if metaint:
+                chunk = min(chunk, metaint - in_block)
+            body = audio(pos, chunk)
+            pos += chunk
+            in_block += chunk
+            if metaint and in_block == metaint:
+                body += metadata(block)
+                block += 1
+                in_block = 0
+            if drop and sent + len(body) >= drop:
+                self.wfile.write(body[:drop - sent])
+                return
+            self.wfile.write(body)
+            self.wfile.flush()
+            sent += len(body)
+            if self.stall(pos, args, seen):
+                next_send = time.monotonic()
+            next_send += chunk / rate
+            time.sleep(max(0, next_send - time.monotonic()))
+
+
+class Server(ThreadingHTTPServer):
+    def handle_error(self, request, client_address):
+        pass    # The player hangs up on a stream when it reconnects
+
+
+def main():
+    """Command-line entry point."""
+    port = int(sys.argv[1]) if len(sys.argv) > 1 else 0
+    server = Server(('127.0.0.1', port), Handler)
+    print(server.server_address[1], flush=True)
+    server.serve_forever()
+
+
+if __name__ == '__main__':
+    main()
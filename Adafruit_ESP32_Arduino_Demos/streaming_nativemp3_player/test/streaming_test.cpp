@@ -0,0 +1,222 @@
+// Host test for the stream handling in streaming_nativemp3_player.ino.
+// Runs on a PC, not the board; the headers next to this file stand in for
+// the libraries, with WiFiClient a real socket and the MP3 decoder taking
+// bytes at a steady 16000 a second (128 kbps) without decoding them.
+//
+// stream_server.py is started as the radio station, and the sketch plays
+// from it for a few seconds at a time, a fresh copy for each case:
+//
+//  - a file with ICY metadata, the connection dropped every 50000 bytes
+//    (cutting metadata blocks in half): the sketch must reconnect with a
+//    Range, and what the decoder gets must be exactly the file, no
+//    metadata, nothing lost or repeated
+//  - the same with a server that ignores Range, sending the whole file
+//    again: the bytes already played must be skipped
+//  - a live stream with metadata and drops: there's no going back, but
+//    what the decoder gets must be audio, in as many unbroken runs as
+//    there were connections
+//  - a file that stalls for 3 seconds, longer than the buffer lasts: the
+//    sketch must count an underrun, raise its resume level, and carry on
+//    without reconnecting or losing a byte
+//
+//   g++ -O2 -Wall -Wextra -I. -o streaming_test streaming_test.cpp
+//   ./streaming_test
+//
+// Add -DECHO_SERIAL to see what the sketch prints. Needs python3 on the
+// path. Exits nonzero on failure.
+
+#include <signal.h>
+#include <sys/wait.h>
+#include <vector>
+#include "Arduino.h"
+#include "WiFiNINA.h"
+#include "Adafruit_MP3.h"
+
+int serverPort;
+
+// What the Arduino IDE would generate
+void yield();
+bool connectStream(void);
+void readStream();
+void retryLater();
+void readHeaders();
+void headerReceived(char *line);
+int takeBody(uint8_t *p, int n);
+void updateStats();
+void bufferFilled();
+void bufferEmptied();
+void writeDacs(int16_t l, int16_t r);
+int getMoreData(uint8_t *writeHere, int thisManyBytes);
+
+// writeDacs() ignores the right channel; min() compares int with uint32_t
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#include "../streaming_nativemp3_player.ino"
+#pragma GCC diagnostic pop
+
+static int failures = 0;
+
+static void check(bool ok, const char *what) {
+  if (!ok) { printf("FAIL: %s\n", what); failures++; }
+}
+
+// Audio byte 'pos' of stream_server.py's count
+static uint8_t audioAt(uint64_t pos) {
+  uint64_t word = pos / 4;
+  return 0x80 | ((word >> (7 * (3 - pos % 4))) & 0x7F);
+}
+
+static bool exactFile(const std::vector<uint8_t> &v) {
+  for (size_t i = 0; i < v.size(); i++) {
+    if (v[i] != audioAt(i)) return false;
+  }
+  return true;
+}
+
+// Unbroken runs of the count in v. A run is found from 4 bytes that make a
+// word and the 8 after following on; bytes that start no run are 'junk'.
+static int countRuns(const std::vector<uint8_t> &v, int *junk) {
+  int runs = 0;
+  *junk = 0;
+  size_t i = 0;
+  while (i < v.size()) {
+    uint64_t pos = 0;
+    bool found = false;
+    for (int a = 0; (a < 4) && !found && (i + a + 4 <= v.size()); a++) {
+      uint64_t word = 0;
+      for (int k = 0; k < 4; k++) word = (word << 7) | (v[i + a + k] & 0x7F);
+      if (word * 4 < (uint64_t)a) continue;
+      pos = word * 4 - a;
+      size_t k = 0;
+      while ((k < 12) && (i + k < v.size()) && (v[i + k] == audioAt(pos + k))) k++;
+      found = (k == 12) || (i + k == v.size());
+    }
+    if (!found) {
+      (*junk)++;
+      i++;
+      continue;
+    }
+    runs++;
+    while ((i < v.size()) && (v[i] == audioAt(pos))) {
+      i++;
+      pos++;
+    }
+  }
+  return runs;
+}
+
+static int count(const std::string &s, const char *what) {
+  int n = 0;
+  for (size_t i = s.find(what); i != std::string::npos; i = s.find(what, i + 1)) n++;
+  return n;
+}
+
+static bool allAudio(const std::vector<uint8_t> &v) {
+  for (uint8_t b : v) {
+    if (!(b & 0x80)) return false;
+  }
+  return true;
+}
+
+enum { FILE_DROPS, NO_RANGES, LIVE, STALL };
+
+// Run a fresh copy of the sketch against one URL for 'seconds', in a child
+// process, and check what came of it there
+static void play(int which, const char *name, const char *query, int seconds) {
+  fflush(stdout);
+  pid_t pid = fork();
+  if (pid != 0) {
+    int status = 0;
+    waitpid(pid, &status, 0);
+    check(WIFEXITED(status) && !WEXITSTATUS(status), name);
+    return;
+  }
+
+  failures = 0;  // This case's own
+  static char url[160];
+  snprintf(url, sizeof(url), "http://127.0.0.1:%d%s", serverPort, query);
+  stream = url;
+  setup();
+  unsigned long start = millis();
+  while (millis() - start < seconds * 1000UL) {
+    loop();
+    struct timespec step = { 0, 200000 };  // SPI transfers, on the board
+    nanosleep(&step, NULL);
+  }
+
+  const std::vector<uint8_t> &played = player.played;
+  int titles = count(Serial.log, "StreamTitle='Test tone ");
+  int junk = 0, runs = countRuns(played, &junk);
+  printf("%-22s %7zu %6u %6u %6u %7u %6d %5d\n", name, played.size(), reconnects,
+         underruns, rebuffers, resumeLevel, titles, runs);
+
+  check(allAudio(played), "no metadata or headers reach the decoder");
+  check(played.size() > (seconds - 2) * player.byteRate / 2, "plays most of the time");
+  switch (which) {
+    case FILE_DROPS:
+      check(exactFile(played), "file played exactly, across reconnects");
+      check(reconnects >= 2, "reconnected after drops");
+      check(count(Serial.log, "HTTP status 206") == (int)reconnects, "every reconnect resumes with a Range");
+      check(titles >= 3, "titles read from the metadata");
+      break;
+    case NO_RANGES:
+      check(exactFile(played), "file played exactly with Range ignored");
+      check(reconnects >= 2, "reconnected after drops");
+      break;
+    case LIVE:
+      check(reconnects >= 2, "reconnected after drops");
+      check(!count(Serial.log, "Resuming at byte"), "no Range asked of a live stream");
+      check(runs <= (int)reconnects + 1, "unbroken between reconnects");
+      check(junk < 8, "nothing but the count");
+      check(titles >= 3, "titles read from the metadata");
+      break;
+    case STALL:
+      check(exactFile(played), "file played exactly after a stall");
+      check(underruns >= 1, "stall counted as an underrun");
+      check(reconnects == 0, "a stall isn't a reconnect");
+      check(resumeLevel > RESUME_LEVEL, "resume level raised after a stall");
+      check(played.size() > 3 * player.byteRate, "playing again after the stall");
+      break;
+  }
+  fflush(stdout);
+  _exit(failures);
+}
+
+// Start stream_server.py and read back the port it's listening on
+static pid_t startServer() {
+  int fds[2];
+  if (pipe(fds)) return -1;
+  pid_t pid = fork();
+  if (pid == 0) {
+    dup2(fds[1], 1);
+    close(fds[0]);
+    execlp("python3", "python3", "stream_server.py", "0", (char *)NULL);
+    _exit(127);
+  }
+  close(fds[1]);
+  FILE *f = fdopen(fds[0], "r");
+  if (fscanf(f, "%d", &serverPort) != 1) serverPort = 0;
+  fclose(f);
+  return pid;
+}
+
+int main(void) {
+  pid_t server = startServer();
+  if (!serverPort) {
+    printf("couldn't start stream_server.py\n");
+    return 1;
+  }
+
+  printf("case                     played reconn underr rebuf  resume titles  runs\n");
+  play(FILE_DROPS, "file, drops", "/file?length=2000000&rate=40000&metaint=7000&drop=50000", 6);
+  play(NO_RANGES, "file, Range ignored",
+       "/file?length=2000000&rate=40000&metaint=7000&drop=50000&drops=2&ranges=0", 6);
+  play(LIVE, "live, drops", "/live?rate=16000&metaint=7000&drop=40000", 6);
+  play(STALL, "file, 3 s stall", "/file?length=2000000&rate=24000&stall=40000&stallms=3000", 8);
+
+  kill(server, SIGTERM);
+  waitpid(server, NULL, 0);
+  printf("%s\n", failures ? "FAILED" : "stream survived drops, metadata and stalls");
+  return failures ? 1 : 0;
+}
@@ -49,7 +49,7 @@ http://www.adafruit.com/products/14
  #include <NewSoftSerial.h>
 #endif
 #include <Adafruit_VC0706.h> // Serial JPEG camera library
-#include <SD.h>              // SD card library
+#include <SdFat.h>           // SD card library (SD.h can't pre-allocate)
 #include <RTClib.h>          // Realtime clock library
 #include <Wire.h>            // Also needed for RTC
 
@@ -77,13 +77,29 @@ PROGMEM byte sleepTab[] = {
 // Sparkfun SD shield: pin 8
 #define chipSel 10
 
+// Pictures are copied to the card a whole 512-byte sector at a time. Each
+// sector is read from the camera in two requests: a short lead-in, asked
+// for just before the previous sector is written so that it arrives in
+// the serial receive buffer during the write, then the rest in one go.
+// The lead-in and the 10 bytes framing it must fit in that buffer.
+#define SECTOR_SIZE 512
+#ifndef SERIAL_RX_BUFFER_SIZE
+#define SERIAL_RX_BUFFER_SIZE 64
+#endif
+#define LEAD_CHUNK  (SERIAL_RX_BUFFER_SIZE - 16) // 10 for framing, 6 spare
+#define CAM_TIMEOUT 200  // ms to wait for camera data
+#define LOG_TIMES   1    // 1 = log capture-to-disk time per image to TIMES.TXT
+
+SdFat           SD;
 RTC_DS1307      clock;
 Adafruit_VC0706 cam = Adafruit_VC0706(&Serial);
 char            directory[] = "DCIM/CANON999", // Emulate Canon folder layout
                 filename[]  = "DCIM/CANON999/IMG_0000.JPG";
 byte            sleepPos; // Current "throb" table position
 int             imgNum      = 0;
-const int       minFileSize = 20 * 1024; // Eye-Fi requires minimum file size
+const uint32_t  minFileSize = 20 * 1024; // Eye-Fi requires minimum file size
+uint32_t        camBaud     = 38400;
+byte            sector[SECTOR_SIZE];
 
 // -------------------------------------------------------------------------
 
@@ -108,7 +124,9 @@ void setup() {
   SdFile::dateTimeCallback(dateTime); // Register timestamp callback
   if(!clock.isrunning()) error(75);   // Init clock; error = hyper flash
   if(!SD.begin(chipSel)) error(250);  // Init SD card; error = quick flash
-  if(!cam.begin())       error(1000); // Init camera; error = slow flash
+  // Init camera; error = slow flash.  After a reset of the Arduino alone
+  // the camera may still be at the faster rate set below.
+  if(!cam.begin() && !camAt(115200) && !camAt(57600)) error(1000);
 
   // Un-comment this line if using an Eye-Fi X2 card:
   // SD.enableCRC(true);
@@ -117,6 +135,7 @@ void setup() {
   if(!SD.exists(directory) && !SD.mkdir(directory)) error(1);
 
   delay(1000); // Need to pause a moment before camera accepts commands
+  fastestBaud();                    // 3x quicker transfers at 115200
   cam.setImageSize(VC0706_640x480); // Let's use the largest image size
 
   // Set up LED "sleep throb" using Timer1 interrupt:
@@ -144,6 +163,7 @@ void loop() {
 
   delay(500); // Pause half a sec between motion sense & capture
  
+  uint32_t startTime = millis();
   if(!cam.takePicture()) {
     // Failed to take picture.  Show RED (+GREEN above) for 5 sec:
     digitalWrite(RED_LED, HIGH);
@@ -152,8 +172,8 @@ void loop() {
     return; // Resume motion detection
   }
 
-  File imgFile = SD.open(filename, FILE_WRITE);
-  if(imgFile == NULL) {
+  File imgFile = SD.open(filename, O_RDWR | O_CREAT | O_TRUNC);
+  if(!imgFile) {
     // Couldn't open file.  Show RED (no GREEN) for 5 sec:
     digitalWrite(GREEN_LED, LOW);
     digitalWrite(RED_LED  , HIGH);
@@ -162,29 +182,121 @@ void loop() {
     return; // Resume motion detection
   }
 
-  uint16_t jpegLen = cam.frameLength();
-  uint16_t bytesRemaining;
-  uint8_t  b, *ptr;
+  // Pad file to minimum Eye-Fi file size if required, and reserve the
+  // space up front as one run of clusters, so writing it never stops to
+  // search the FAT.  Not fatal if that fails; it just grows as usual.
+  uint32_t jpegLen = cam.frameLength();
+  uint32_t fileLen = max(jpegLen, minFileSize);
+  imgFile.preAllocate(fileLen);
 
-  // Transfer data from camera to SD file:
-  for(bytesRemaining = jpegLen; bytesRemaining ; bytesRemaining -= b) {
-    b   = min(32, bytesRemaining); // Max of 32 bytes at a time
-    ptr = cam.readPicture(b);      // From camera
-    imgFile.write(ptr, b);         // To SD card
-    digitalWrite(GREEN_LED, (bytesRemaining & 256) ? HIGH : LOW);
+  bool saved = savePicture(imgFile, jpegLen, fileLen);
+  imgFile.close();
+  if(!saved) {
+    // Lost the camera or the card mid-picture.  Show RED (+GREEN) for 5 sec:
+    SD.remove(filename);
+    digitalWrite(RED_LED, HIGH);
+    delay(5000);
+    digitalWrite(RED_LED, LOW);
+    while(Serial.available()) Serial.read(); // Drop anything left over
+    return; // Resume motion detection
   }
 
-  // Pad file to minimum Eye-Fi file size if required:
-  if(jpegLen < minFileSize) {
-    for(bytesRemaining  = minFileSize - jpegLen; bytesRemaining ;
-        bytesRemaining -= b) {
-      b = min(32, bytesRemaining); // Max of 32 bytes at a time
-      imgFile.write(ptr, b);       // Just repeat last data, it's ignored
-      digitalWrite(GREEN_LED, (bytesRemaining & 256) ? HIGH : LOW);
+#if LOG_TIMES
+  File times = SD.open("TIMES.TXT", O_WRONLY | O_CREAT | O_APPEND);
+  if(times) {
+    times.print(&filename[14]);      // IMG_nnnn.JPG
+    times.print(' ');
+    times.print(jpegLen);
+    times.print(F(" bytes "));
+    times.print(millis() - startTime);
+    times.print(F(" ms "));
+    times.print(camBaud);
+    times.println(F(" baud"));
+    times.close();
+  }
+#endif
+}
+
+
+// Transfer data from camera to SD file, a sector at a time (see
+// LEAD_CHUNK above).  Bytes past the end of the JPEG, up to fileLen,
+// are written as zeros; they're ignored.  Returns false on a camera
+// timeout or a failed write.
+bool savePicture(File &imgFile, uint32_t jpegLen, uint32_t fileLen) {
+  uint32_t pos, next, len, got, lead;
+
+  lead = min((uint32_t)LEAD_CHUNK, jpegLen);
+  if(lead) requestPicture(0, lead);
+  for(pos = 0; pos < fileLen; pos = next) {
+    next = pos + SECTOR_SIZE;
+    len  = min((uint32_t)SECTOR_SIZE, fileLen - pos);      // This sector...
+    got  = (pos < jpegLen) ? min(len, jpegLen - pos) : 0; // ...of which JPEG
+    if(lead && !receivePicture(sector, lead)) return false;
+    if(got > lead) {
+      requestPicture(pos + lead, got - lead);
+      if(!receivePicture(&sector[lead], got - lead)) return false;
     }
+    memset(&sector[got], 0, len - got);
+
+    // Start the next sector coming while this one is written
+    lead = (next < jpegLen) ? min((uint32_t)LEAD_CHUNK, jpegLen - next) : 0;
+    if(lead) requestPicture(next, lead);
+    if(imgFile.write(sector, len) != len) return false;
+    digitalWrite(GREEN_LED, (pos & 1024) ? HIGH : LOW);
   }
+  return true;
+}
 
-  imgFile.close();
+
+// Ask the camera for 'n' bytes of the picture from 'addr' on.  This is
+// the library's readPicture() without the wait, so the answer can come
+// in while we do something else; receivePicture() collects it.
+void requestPicture(uint32_t addr, uint32_t n) {
+  byte cmd[] = { 0x56, 0, 0x32, 0x0C, 0, 0x0A,
+                 (byte)(addr >> 24), (byte)(addr >> 16),
+                 (byte)(addr >>  8), (byte)addr,
+                 (byte)(n >> 24), (byte)(n >> 16), (byte)(n >> 8), (byte)n,
+                 0, 10 };          // Delay before sending, 0.01 ms units
+  Serial.write(cmd, sizeof(cmd));
+}
+
+// The answer to requestPicture(): a 5 byte header, the data, and the
+// header again
+bool receivePicture(byte *dst, uint32_t n) {
+  byte head[5];
+
+  Serial.setTimeout(CAM_TIMEOUT);
+  if((Serial.readBytes(head, 5) != 5) || (head[0] != 0x76) ||
+     (head[2] != 0x32) || head[3]) return false;
+  if(Serial.readBytes(dst, n) != n) return false;
+  return (Serial.readBytes(head, 5) == 5) && (head[0] == 0x76);
+}
+
+
+// Move the camera to the fastest serial rate that works, 115200 or
+// 57600, leaving it at 38400 if neither does.  Each request is
+// answered at the old rate, then both ends switch.
+void fastestBaud(void) {
+  if(tryBaud(cam.setBaud115200(), 115200)) return;
+  tryBaud(cam.setBaud57600(), 57600);
+}
+
+bool tryBaud(char *reply, uint32_t baud) {
+  if(!reply) return false;       // Not taken; still at the old rate
+  delay(100);
+  if(camAt(baud)) return true;
+  cam.setBaud38400();            // Can't hear it there; go back
+  delay(100);
+  camAt(38400);
+  return false;
+}
+
+// Talk to the camera at 'baud'; true if it answers
+bool camAt(uint32_t baud) {
+  Serial.begin(baud);
+  if(!cam.getVersion()) return false;
+  camBaud = baud;
+  return true;
 }
 
 
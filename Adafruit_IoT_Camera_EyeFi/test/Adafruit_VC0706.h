@@ -0,0 +1,46 @@
+// The VC0706 library's blocking command/response calls, each taking as
+// long as its bytes would on the wire. The picture itself comes from the
+// test's takePicture().
+#pragma once
+#include "Arduino.h"
+
+#define VC0706_640x480 0
+
+class Adafruit_VC0706 {
+ public:
+  uint8_t  buf[101];
+  uint16_t frameptr;
+
+  Adafruit_VC0706(HardwareSerial *) : frameptr(0) { }
+
+  boolean begin(uint16_t baud = 38400) { Serial.begin(baud); return reset(); }
+  boolean reset() { return command(5, 5); }
+  char *getVersion() { return command(5, 16) ? (char *)buf : 0; }
+  char *setBaud115200() { return setBaud(115200); }
+  char *setBaud57600() { return setBaud(57600); }
+  char *setBaud38400() { return setBaud(38400); }
+  boolean setImageSize(uint8_t) { return command(9, 5); }
+  boolean resumeVideo() { return command(5, 5); }
+  boolean setMotionDetect(boolean) { return command(7, 5); }
+  boolean motionDetected() { fakeMicros += 2000000; return true; }
+  boolean takePicture();
+  uint32_t frameLength() { command(5, 9); return line.image->size(); }
+
+ private:
+  // 'out' bytes sent, 'in' bytes back; false at the wrong baud rate
+  bool command(int out, int in) {
+    if (line.hostBaud != line.camBaud) {
+      fakeMicros += 200000;
+      return false;
+    }
+    fakeMicros = line.transmit(out) + line.latency + (uint64_t)(in * line.bitTime());
+    return true;
+  }
+
+  // Answered at the old rate, then the camera switches
+  char *setBaud(uint32_t baud) {
+    if (!command(9, 5) || (baud > line.maxBaud)) return 0;
+    line.camBaud = baud;
+    return (char *)buf;
+  }
+};
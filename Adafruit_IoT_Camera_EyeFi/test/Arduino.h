@@ -0,0 +1,151 @@
+// Just enough of Arduino for Adafruit_EyeFi.ino on a PC, with a virtual
+// clock. Serial is the camera's UART: bytes come in at the camera's baud
+// rate into a 64-byte receive buffer like the AVR core's, and any that
+// arrive while it's full are counted as lost.
+#pragma once
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+#include <deque>
+#include <utility>
+
+#define ARDUINO 10819
+
+typedef uint8_t byte;
+typedef bool    boolean;
+
+#define PROGMEM
+#define F(s) (s)
+#define pgm_read_byte(p) (*(const uint8_t *)(p))
+#define HIGH   1
+#define LOW    0
+#define OUTPUT 1
+#define INPUT  0
+#define _BV(b) (1 << (b))
+#define ISR(v, ...) void v(void)
+
+static uint8_t  TCCR1A, TCCR1B, TIMSK1, TIFR1;
+static uint16_t ICR1;
+enum { WGM11, WGM12, WGM13, CS10, CS11, TOIE1, TOV1 };
+static inline void sei() { }
+static inline void pinMode(int, int) { }
+static inline void digitalWrite(int, int) { }
+static inline void analogWrite(int, int) { }
+
+template <class A, class B> static A min(A a, B b) { return (a < (A)b) ? a : (A)b; }
+template <class A, class B> static A max(A a, B b) { return (a > (A)b) ? a : (A)b; }
+
+extern uint64_t fakeMicros;
+static inline uint32_t millis() { return fakeMicros / 1000; }
+static inline void delay(uint32_t ms) { fakeMicros += ms * 1000ULL; }
+
+// The camera end of the serial line
+struct CameraLine {
+  uint32_t hostBaud, camBaud, maxBaud;     // maxBaud: fastest the camera takes
+  uint64_t txFreeAt, camFreeAt;
+  std::deque<std::pair<uint64_t, uint8_t> > inFlight; // Arrival time, byte
+  std::deque<uint8_t> rx;                  // The host's receive buffer
+  std::vector<uint8_t> cmd;
+  const std::vector<uint8_t> *image;
+  uint32_t lost, latency;
+  int      answers;                        // Picture reads left to answer; -1 all
+
+  CameraLine() : hostBaud(9600), camBaud(38400), maxBaud(115200), txFreeAt(0),
+    camFreeAt(0), image(0), lost(0), latency(1000), answers(-1) { }
+
+  double bitTime() const { return 10e6 / camBaud; } // 10 bits a byte, in us
+
+  // Move whatever has arrived by now into the receive buffer
+  void pump() {
+    while (!inFlight.empty() && (inFlight.front().first <= fakeMicros)) {
+      if (rx.size() < 64) rx.push_back(inFlight.front().second);
+      else lost++;
+      inFlight.pop_front();
+    }
+  }
+
+  void send(const std::vector<uint8_t> &bytes, uint64_t start) {
+    double t = max((double)start, (double)camFreeAt);
+    for (size_t i = 0; i < bytes.size(); i++) {
+      t += bitTime();
+      inFlight.push_back(std::make_pair((uint64_t)t, bytes[i]));
+    }
+    camFreeAt = t;
+  }
+
+  // The time the camera has 'n' more bytes from the host
+  uint64_t transmit(int n) {
+    txFreeAt = max(fakeMicros, txFreeAt) + (uint64_t)(n * bitTime());
+    return txFreeAt;
+  }
+
+  // A byte from the host. Picture reads (0x32) are answered after the
+  // camera's latency, until 'answers' runs out; the library's own commands
+  // are modelled in Adafruit_VC0706.h.
+  void receive(uint8_t c) {
+    if (hostBaud != camBaud) {             // Garbled at the wrong rate
+      cmd.clear();
+      return;
+    }
+    cmd.push_back(c);
+    uint64_t at = transmit(1);
+    if (cmd.size() < 16) return;
+    const uint8_t *q = &cmd[0];
+    if ((q[0] == 0x56) && (q[2] == 0x32) && answers) {
+      if (answers > 0) answers--;
+      uint32_t addr = (uint32_t)q[6] << 24 | q[7] << 16 | q[8] << 8 | q[9];
+      uint32_t n    = (uint32_t)q[10] << 24 | q[11] << 16 | q[12] << 8 | q[13];
+      static const uint8_t head[] = { 0x76, 0, 0x32, 0, 0 };
+      std::vector<uint8_t> r(head, head + 5);
+      for (uint32_t i = 0; i < n; i++)
+        r.push_back((addr + i < image->size()) ? (*image)[addr + i] : 0);
+      r.insert(r.end(), head, head + 5);
+      send(r, at + latency + 100);
+    }
+    cmd.clear();
+  }
+};
+extern CameraLine line;
+
+struct HardwareSerial {
+  unsigned long timeout;
+
+  HardwareSerial() : timeout(1000) { }
+  void begin(uint32_t baud) { line.hostBaud = baud; line.rx.clear(); }
+  int available() { line.pump(); return line.rx.size(); }
+  int read() {
+    line.pump();
+    if (line.rx.empty()) return -1;
+    int c = line.rx.front();
+    line.rx.pop_front();
+    return c;
+  }
+  void setTimeout(unsigned long ms) { timeout = ms; }
+  size_t readBytes(uint8_t *buf, size_t n) {
+    size_t   got  = 0;
+    uint64_t last = fakeMicros;
+    while (got < n) {
+      line.pump();
+      if (!line.rx.empty()) {
+        buf[got++] = line.rx.front();
+        line.rx.pop_front();
+        last = fakeMicros += 4;
+      } else if (line.inFlight.empty() ||
+                 (line.inFlight.front().first > last + timeout * 1000)) {
+        fakeMicros = last + timeout * 1000;
+        break;
+      } else {
+        fakeMicros = max(fakeMicros, line.inFlight.front().first);
+      }
+    }
+    return got;
+  }
+  size_t write(uint8_t c) { line.receive(c); return 1; }
+  size_t write(const uint8_t *p, size_t n) {
+    for (size_t i = 0; i < n; i++) write(p[i]);
+    return n;
+  }
+};
+extern HardwareSerial Serial;
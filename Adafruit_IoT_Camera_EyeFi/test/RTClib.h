@@ -0,0 +1,19 @@
+// A clock that's always running and always says the same thing
+#pragma once
+
+class DateTime {
+ public:
+  int year() { return 2026; }
+  int month() { return 1; }
+  int day() { return 1; }
+  int hour() { return 0; }
+  int minute() { return 0; }
+  int second() { return 0; }
+};
+
+class RTC_DS1307 {
+ public:
+  void begin() { }
+  bool isrunning() { return true; }
+  DateTime now() { return DateTime(); }
+};
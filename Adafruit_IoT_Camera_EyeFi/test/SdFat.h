@@ -0,0 +1,94 @@
+// SdFat on a PC: files are kept in memory, and each 512-byte block
+// written costs the virtual clock what it would on a card, with the odd
+// long busy spell. Writing a whole aligned block skips the block cache.
+#pragma once
+#include <string>
+#include <map>
+#include "Arduino.h"
+
+#define BLOCK_WRITE_US 2500
+#define BLOCK_READ_US  800
+#define CLUSTER_SIZE   32768
+#define FAT_DATE(y, m, d) ((((y) - 1980) << 9) | ((m) << 5) | (d))
+#define FAT_TIME(h, m, s) (((h) << 11) | ((m) << 5) | ((s) >> 1))
+
+enum { O_RDWR = 1, O_CREAT = 2, O_TRUNC = 4, O_WRONLY = 8, O_APPEND = 16 };
+
+extern std::map<std::string, std::vector<uint8_t> > card;
+extern uint32_t blockWrites, busySpells;
+void fileClosed(const std::string &name);
+
+static void writeBlock() {
+  blockWrites++;
+  fakeMicros += BLOCK_WRITE_US;
+  if (rand() % 50 == 0) {
+    fakeMicros += 40000;
+    busySpells++;
+  }
+}
+
+class File {
+ public:
+  File() : data(0), pos(0), allocated(0) { }
+  File(const char *n, std::vector<uint8_t> *d, uint32_t at) : name(n), data(d),
+    pos(at), allocated((at + CLUSTER_SIZE - 1) / CLUSTER_SIZE * CLUSTER_SIZE) { }
+  operator bool() const { return data != 0; }
+
+  size_t write(const uint8_t *p, size_t n) {
+    fakeMicros += 30;
+    while (allocated < pos + n) {          // Find a free cluster in the FAT
+      fakeMicros += BLOCK_READ_US + 2 * BLOCK_WRITE_US;
+      allocated  += CLUSTER_SIZE;
+    }
+    bool direct = ((pos % 512) == 0) && (n == 512);
+    if (!direct) fakeMicros += n / 2;      // Copied into the block cache
+    for (size_t i = 0; i < n; i++) {
+      if (pos < data->size()) (*data)[pos] = p[i];
+      else data->push_back(p[i]);
+      if ((++pos % 512 == 0) && !direct) writeBlock();
+    }
+    if (direct) writeBlock();
+    return n;
+  }
+  bool preAllocate(uint32_t n) {
+    fakeMicros += 2 * BLOCK_READ_US + 2 * BLOCK_WRITE_US;
+    allocated   = (n + CLUSTER_SIZE - 1) / CLUSTER_SIZE * CLUSTER_SIZE;
+    return true;
+  }
+  void print(const char *s) { write((const uint8_t *)s, strlen(s)); }
+  void print(char c) { write((const uint8_t *)&c, 1); }
+  void print(unsigned long v) { print(std::to_string(v).c_str()); }
+  void print(uint32_t v) { print((unsigned long)v); }
+  void println(const char *s) { print(s); print('\n'); }
+  void close() {
+    if (!data) return;
+    if (pos % 512) writeBlock();           // The last, partial block
+    fakeMicros += BLOCK_READ_US + BLOCK_WRITE_US; // Directory entry
+    data = 0;
+    fileClosed(name);
+  }
+
+ private:
+  std::string           name;
+  std::vector<uint8_t> *data;
+  uint32_t              pos, allocated;
+};
+
+class SdFat {
+ public:
+  bool begin(int) { return true; }
+  bool exists(const char *name) { return card.count(name) != 0; }
+  bool mkdir(const char *name) { card[name]; return true; }
+  bool remove(const char *name) { return card.erase(name) != 0; }
+  File open(const char *name, int mode) {
+    std::vector<uint8_t> *d = &card[name];
+    if (mode & O_TRUNC) d->clear();
+    fakeMicros += BLOCK_READ_US;
+    return File(name, d, (mode & O_APPEND) ? d->size() : 0);
+  }
+};
+
+class SdFile {
+ public:
+  static void dateTimeCallback(void (*)(uint16_t *, uint16_t *)) { }
+};
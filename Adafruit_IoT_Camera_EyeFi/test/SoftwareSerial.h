@@ -0,0 +1,2 @@
+// Only included for the VC0706 library's sake; nothing needed here
+#pragma once
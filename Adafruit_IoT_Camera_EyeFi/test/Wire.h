@@ -0,0 +1,8 @@
+#pragma once
+
+class TwoWire {
+ public:
+  void begin() { }
+};
+
+static TwoWire Wire;
@@ -0,0 +1,122 @@
+// Host test for Adafruit_EyeFi. Runs on a PC, not the board; the headers
+// next to this file stand in for Arduino, the camera, SdFat and RTClib,
+// with a virtual clock charged what the serial line and the card would
+// take.
+//
+// The camera is moved to the fastest rate it takes, then "sees motion"
+// six times, with pictures from 12 KB up to 60 KB. Every file on the card
+// must match its picture (padded to the Eye-Fi minimum), no byte may be
+// lost to a full receive buffer, and each picture must reach the card in
+// not much more than its time on the wire. Then the camera goes quiet
+// partway through a picture: the sketch must give up on it, remove the
+// file and go on to the next. All this with the camera taking up to
+// 115200, 57600 and only 38400 baud.
+//
+//   g++ -O2 -I. -o eyefi_test eyefi_test.cpp
+//   ./eyefi_test
+//
+// Exits nonzero on failure.
+
+#include <algorithm>
+#include "Arduino.h"
+#include "SdFat.h"
+
+uint64_t       fakeMicros = 0;
+CameraLine     line;
+HardwareSerial Serial;
+std::map<std::string, std::vector<uint8_t> > card;
+uint32_t       blockWrites = 0, busySpells = 0;
+
+// What the Arduino IDE would generate
+void error(int time);
+void nextFilename(void);
+void dateTime(uint16_t *date, uint16_t *time);
+bool savePicture(File &imgFile, uint32_t jpegLen, uint32_t fileLen);
+void requestPicture(uint32_t addr, uint32_t n);
+bool receivePicture(byte *dst, uint32_t n);
+void fastestBaud(void);
+bool tryBaud(char *reply, uint32_t baud);
+bool camAt(uint32_t baud);
+
+#include "../Adafruit_EyeFi/Adafruit_EyeFi.ino"
+
+static int failures = 0;
+
+static void check(bool ok, const char *what) {
+  if (!ok) { printf("FAIL: %s\n", what); failures++; }
+}
+
+static std::vector<uint8_t> picture;
+static uint64_t shotAt;
+static int      shots, good;
+static double   seconds, wireSeconds;
+
+// A random JPEG, ending in FF D9
+boolean Adafruit_VC0706::takePicture() {
+  static const uint32_t sizes[] = { 48213, 52904, 12077, 61440, 39999, 40960 };
+  picture.resize(sizes[shots++ % 6]);
+  for (size_t i = 0; i < picture.size(); i++) picture[i] = rand();
+  picture[picture.size() - 2] = 0xFF;
+  picture[picture.size() - 1] = 0xD9;
+  line.image = &picture;
+  frameptr   = 0;
+  shotAt     = fakeMicros;
+  fakeMicros += 150000;                    // Capturing the frame
+  return command(5, 5);
+}
+
+void fileClosed(const std::string &name) {
+  if (name.find("IMG_") == std::string::npos) return;
+  const std::vector<uint8_t> &f = card[name];
+  size_t want = max(picture.size(), (size_t)minFileSize);
+  good    += (f.size() == want) && !memcmp(&f[0], &picture[0], picture.size());
+  seconds += (fakeMicros - shotAt) / 1e6;
+  wireSeconds += picture.size() * 10.0 / line.camBaud;
+}
+
+static int pictureFiles() {
+  int n = 0;
+  for (std::map<std::string, std::vector<uint8_t> >::iterator i = card.begin();
+       i != card.end(); ++i) n += (i->first.find("IMG_") != std::string::npos);
+  return n;
+}
+
+static void run(uint32_t maxBaud) {
+  fakeMicros = blockWrites = busySpells = 0;
+  line  = CameraLine();
+  line.maxBaud = maxBaud;
+  card.clear();
+  shots = good = 0;
+  seconds = wireSeconds = 0;
+  imgNum  = 0;
+  camBaud = 38400;
+  srand(7);
+
+  setup();
+  uint32_t expect = (maxBaud >= 115200) ? 115200 : (maxBaud >= 57600) ? 57600 : 38400;
+  check(camBaud == expect && line.camBaud == expect, "fastest rate the camera takes");
+  for (int i = 0; i < 6; i++) loop();
+  printf("up to %6u baud: %d/6 pictures OK, %.2f s each, %.2fx their time on "
+         "the wire, %u bytes lost, %u block writes\n", maxBaud, good,
+         seconds / 6, seconds / wireSeconds, line.lost, blockWrites);
+  check(good == 6, "every picture on the card");
+  check(line.lost == 0, "no bytes lost to a full receive buffer");
+  check(seconds < 1.3 * wireSeconds, "pictures saved at close to wire speed");
+  std::vector<uint8_t> &times = card["TIMES.TXT"];
+  check(std::count(times.begin(), times.end(), '\n') == 6, "TIMES.TXT has each picture");
+
+  // The camera stops answering partway through the next picture
+  line.answers = 40;
+  loop();
+  check(good == 6 && pictureFiles() == 6, "half a picture removed");
+  line.answers = -1;
+  loop();
+  check(good == 7 && pictureFiles() == 7, "next picture after a camera timeout");
+}
+
+int main(void) {
+  run(115200);
+  run(57600);
+  run(38400);
+  return failures ? 1 : 0;
+}
@@ -0,0 +1,205 @@
+#pragma once
+#include <string.h>
+
+// Dirty-region refreshes for Adafruit_EPD displays
+//
+// Wraps any Adafruit_EPD panel class. display() hashes the finished
+// framebuffer -- in RAM or in the SPI SRAM, whichever the panel uses -- an
+// EPD_TILE x EPD_TILE tile at a time, and compares the tile hashes with
+// those of the frame last sent to the panel:
+//
+//  - nothing changed: the refresh (up to ~15 seconds on a tri-color
+//    panel) is skipped
+//  - some tiles changed and partial refresh is on: only the bounding
+//    rectangle of the changed tiles is refreshed, through the library's
+//    displayPartial(x1, y1, x2, y2) if the installed Adafruit_EPD has one
+//  - otherwise, when the change covers more than half the screen, and
+//    after every 'fullEvery' partial refreshes (to clear the ghosting they
+//    leave): a normal full refresh
+//
+//   DiffEPD<Adafruit_IL91874> gfx(264, 176, EPD_DC, ...); // was Adafruit_IL91874
+//
+// Hashing the finished buffer rather than the drawing calls means any way
+// of drawing counts (fillRect, clearBuffer, pixels drawn twice). Tri-color
+// panels can't refresh part of the screen, so for those the saving comes
+// from skipping redraws that came out identical. The state is small enough
+// for RTC_DATA_ATTR, so it can survive deep sleep with setState().
+
+#define EPD_TILE      16  // Tile size, pixels (a multiple of 8)
+#define EPD_MAX_TILES 512 // Enough for 400x300
+
+typedef struct {
+  uint32_t tiles[EPD_MAX_TILES]; // Hash of each tile as last displayed
+  uint16_t numTiles;             // 0 if the panel contents are unknown
+  uint8_t  sinceFull;            // Partial refreshes since the last full one
+  uint32_t fullRefreshes;
+  uint32_t partialRefreshes;
+  uint32_t skippedRefreshes;
+  uint32_t fullMillis;           // Duration of the last full refresh
+  uint32_t savedMillis;          // Refresh time saved by partial/skipped
+} EPDDiffState;
+
+// Rectangle that changed in the last display(), corners inclusive, in
+// drawing (rotated) coordinates; x2 < x1 if nothing changed
+typedef struct {
+  int16_t x1, y1, x2, y2;
+} EPDRect;
+
+// Use displayPartial() if this version of Adafruit_EPD provides it
+template <class T>
+static auto epdPartial(T &epd, int16_t x1, int16_t y1, int16_t x2, int16_t y2, int)
+    -> decltype(epd.displayPartial(x1, y1, x2, y2), bool()) {
+  epd.displayPartial(x1, y1, x2, y2);
+  return true;
+}
+template <class T>
+static bool epdPartial(T &, int16_t, int16_t, int16_t, int16_t, long) {
+  return false;
+}
+
+// Adafruit_EPD keeps its SRAM as an object in older releases and as a
+// pointer in newer ones
+template <class S> static S &epdSram(S &sram) { return sram; }
+template <class S> static S &epdSram(S *sram) { return *sram; }
+
+template <class EPD>
+class DiffEPD : public EPD {
+ public:
+  using EPD::EPD;
+
+  // Allow partial refreshes (monochrome panels only), forcing a full
+  // refresh after every 'fullEvery' of them
+  void setPartial(bool enable, uint8_t fullEvery = 10) {
+    partialEnabled = enable;
+    this->fullEvery = fullEvery;
+  }
+
+  // Keep comparison state and counters somewhere else, e.g. RTC_DATA_ATTR
+  void setState(EPDDiffState *s) { state = s; }
+  const EPDDiffState &stats() { return *state; }
+  const EPDRect &lastChange() { return changed; }
+
+  // Make the next display() a full refresh
+  void invalidate() { state->numTiles = 0; }
+
+  void display() {
+    uint16_t numTiles = hashTiles();
+    bool     known = numTiles && (state->numTiles == numTiles);
+
+    // Bounding box of the changed tiles, in tiles
+    int16_t tx1 = across, ty1 = down, tx2 = -1, ty2 = -1;
+    for (uint16_t t = 0; t < numTiles; t++) {
+      if (known && (frame[t] == state->tiles[t])) continue;
+      int16_t tx = t % across, ty = t / across;
+      if (tx < tx1) tx1 = tx;
+      if (tx > tx2) tx2 = tx;
+      if (ty < ty1) ty1 = ty;
+      if (ty > ty2) ty2 = ty;
+    }
+    changed = tileRect(tx1, ty1, tx2, ty2);
+
+    if (known && (tx2 < 0)) {
+      state->skippedRefreshes++;
+      state->savedMillis += state->fullMillis;
+      return;
+    }
+
+    uint32_t start = millis();
+    bool small = (uint32_t)(tx2 - tx1 + 1) * (ty2 - ty1 + 1) * 2 <= numTiles;
+    if (known && partialEnabled && small && (state->sinceFull < fullEvery) &&
+        epdPartial(*this, changed.x1, changed.y1, changed.x2, changed.y2, 0)) {
+      uint32_t took = millis() - start;
+      if (took < state->fullMillis) state->savedMillis += state->fullMillis - took;
+      state->partialRefreshes++;
+      state->sinceFull++;
+    } else {
+      EPD::display();
+      state->fullMillis = millis() - start;
+      state->fullRefreshes++;
+      state->sinceFull = 0;
+    }
+    memcpy(state->tiles, frame, numTiles * sizeof(frame[0]));
+    state->numTiles = numTiles;
+  }
+
+  template <class P>
+  void printStats(P &out) {
+    out.print("refreshes: ");
+    out.print(state->fullRefreshes);
+    out.print(" full, ");
+    out.print(state->partialRefreshes);
+    out.print(" partial, ");
+    out.print(state->skippedRefreshes);
+    out.print(" skipped, ");
+    out.print(state->savedMillis / 1000);
+    out.println(" s saved");
+  }
+
+ private:
+  EPDDiffState  localState = {};
+  EPDDiffState *state = &localState;
+  bool          partialEnabled = false;
+  uint8_t       fullEvery = 10;
+  uint32_t      frame[EPD_MAX_TILES];  // Tile hashes of the buffer now
+  int16_t       across, down;          // Tiles, in the panel's own layout
+  uint16_t      lineBytes;             // Bytes per column of the buffer
+  EPDRect       changed;
+
+  // The buffers are laid out as Adafruit_EPD::drawPixel() addresses them:
+  // a column of the panel's own (unrotated) height rounded up to 8 bits,
+  // for each x from WIDTH - 1 down to 0, 8 rows a byte. Returns the number
+  // of tiles, or 0 if there are too many to track.
+  uint16_t hashTiles() {
+    lineBytes = (this->HEIGHT + 7) / 8;
+    across = (this->WIDTH + EPD_TILE - 1) / EPD_TILE;
+    down = (lineBytes * 8 + EPD_TILE - 1) / EPD_TILE;
+    uint16_t numTiles = across * down;
+    if (numTiles > EPD_MAX_TILES) return 0;
+    for (uint16_t t = 0; t < numTiles; t++) frame[t] = 2166136261UL;
+    hashBuffer(this->buffer1, this->buffer1_addr, this->buffer1_size);
+    hashBuffer(this->buffer2, this->buffer2_addr, this->buffer2_size);
+    return numTiles;
+  }
+
+  // FNV-1a of each tile's bytes, in buffer order
+  void hashBuffer(const uint8_t *buf, uint16_t addr, uint32_t size) {
+    uint8_t chunk[64];
+    for (uint32_t i = 0; i < size; i += sizeof(chunk)) {
+      uint16_t n = (size - i < sizeof(chunk)) ? size - i : sizeof(chunk);
+      const uint8_t *p = chunk;
+      if (this->use_sram) {
+        epdSram(this->sram).read(addr + i, chunk, n);
+      } else if (buf) {
+        p = buf + i;
+      } else {
+        return;
+      }
+      for (uint16_t j = 0; j < n; j++) {
+        uint32_t line = (i + j) / lineBytes, byte = (i + j) % lineBytes;
+        if (line >= (uint32_t)this->WIDTH) return;
+        uint16_t t = (byte * 8 / EPD_TILE) * across + (this->WIDTH - 1 - line) / EPD_TILE;
+        frame[t] = (frame[t] ^ p[j]) * 16777619UL;
+      }
+    }
+  }
+
+  // Tiles tx1..tx2, ty1..ty2 as a rectangle in drawing coordinates
+  EPDRect tileRect(int16_t tx1, int16_t ty1, int16_t tx2, int16_t ty2) {
+    EPDRect r = { 0, 0, -1, -1 };
+    if (tx2 < 0) return r;
+    int16_t w = this->WIDTH, h = this->HEIGHT;
+    int16_t x1 = tx1 * EPD_TILE, x2 = tx2 * EPD_TILE + EPD_TILE - 1;
+    int16_t y1 = ty1 * EPD_TILE, y2 = ty2 * EPD_TILE + EPD_TILE - 1;
+    if (x2 >= w) x2 = w - 1;
+    if (y2 >= h) y2 = h - 1;  // Past HEIGHT is padding, never drawn
+    // Undo drawPixel()'s rotation
+    switch (this->getRotation()) {
+      case 0: r = { x1, y1, x2, y2 }; break;
+      case 1: r = { y1, (int16_t)(w - 1 - x2), y2, (int16_t)(w - 1 - x1) }; break;
+      case 2: r = { (int16_t)(w - 1 - x2), (int16_t)(h - 1 - y2),
+                    (int16_t)(w - 1 - x1), (int16_t)(h - 1 - y1) }; break;
+      case 3: r = { (int16_t)(h - 1 - y2), x1, (int16_t)(h - 1 - y1), x2 }; break;
+    }
+    return r;
+  }
+};
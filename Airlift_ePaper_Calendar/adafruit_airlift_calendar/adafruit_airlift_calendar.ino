@@ -17,6 +17,7 @@
 #include <Adafruit_GFX.h>    // Core graphics library
 #include <Adafruit_EPD.h>
 #include <Adafruit_NeoPixel.h>
+#include "DiffEPD.h"
 
 #include <Fonts/FreeSans9pt7b.h>
 #include <Fonts/FreeSansBold9pt7b.h>
@@ -56,8 +57,9 @@ const char *aio_key = AIO_KEY;
 
 #define NEOPIXELPIN   40
 
-/* This isfor the 2.7" tricolor EPD */
-Adafruit_IL91874 gfx(264, 176 ,EPD_DC, EPD_RESET, EPD_CS, SRAM_CS, EPD_BUSY);
+/* This isfor the 2.7" tricolor EPD. The hourly redraw usually comes out
+   identical, and DiffEPD skips the panel refresh when it does */
+DiffEPD<Adafruit_IL91874> gfx(264, 176 ,EPD_DC, EPD_RESET, EPD_CS, SRAM_CS, EPD_BUSY);
 
 WiFiSSLClient client;
 
@@ -213,6 +215,7 @@ void drawCalendar(struct tm * today, struct tm * pickdate)
   }
   gfx.display();
   Serial.println("display update completed");
+  gfx.printStats(Serial);
   gfx.powerDown();
   neopixel.setPixelColor(0, neopixel.Color(0, 0, 0));
   neopixel.show(); 
@@ -62,6 +62,38 @@
 // Note 2: LOW_SPEED will alow you only to erase the chip and burn the fuses! It
 // will fail if you try to program the target uC this way!
 
+
+// FAST PAGED PROGRAMMING
+//
+// The serial port runs at BAUDRATE, 19200 like the Arduino IDE's "Arduino as
+// ISP" programmer. Set it to 115200 for about 2.5x faster programming, and
+// give avrdude the same rate, e.g.
+//   avrdude -cstk500v1 -b115200 -P ... -patmega328p -Uflash:w:firmware.hex:i
+//
+// Page writes are buffered: the whole page is received into a page buffer
+// first, then loaded into the target a word at a time with the SPI bytes
+// queued back to back (load instructions have no reply to wait for), taking
+// in serial data between words. Instead of fixed delays, the target is asked
+// if it has finished a write (RDY/BSY polling). A write the target never
+// reports finished is answered with STK_FAILED in the next reply that would
+// have been STK_OK, as the page's own reply may already have gone out.
+//
+// Uncomment DOUBLE_BUFFER for two page buffers: STK_OK for a page goes back
+// to the host as soon as the page is received, and the host's next
+// STK_SET_ADDR and STK_PROG_PAGE are answered while the page before is
+// still being written, so the serial link and the target are both kept
+// busy; a failed write is reported one or two requests later. Without it,
+// each page is answered only after it has been loaded into the target.
+//
+// Pages up to 256 bytes (ATmega1284/2560) are supported.
+//
+// FAST_SPI runs SPI at 1 MHz instead of 125 KHz. The target must be clocked
+// at 8 MHz or more (not the 1 MHz a new chip ships with) for this to work.
+
+#define BAUDRATE 19200
+//#define DOUBLE_BUFFER
+//#define FAST_SPI
+
 //#define LOW_SPEED
 #ifdef LOW_SPEED
 #define EXTRA_SPI_DELAY 125
@@ -122,15 +154,44 @@ int error=0;
 int pmode=0;
 // address for reading and writing, set by STK_SET_ADDR command
 int _addr;
-byte _buffer[256]; // serial port buffer
-int pBuffer = 0;  // buffer pointer
-int iBuffer = 0;  // buffer index
+#define RX_SIZE 512 // serial port buffer size (power of 2): one full page
+                    // request plus the start of the next
+byte _buffer[RX_SIZE]; // serial port buffer
+unsigned int pBuffer = 0;  // buffer pointer
+unsigned int iBuffer = 0;  // buffer index
+unsigned int reqEnd = 0;   // end of last complete request
+int reqCount = 0;          // bytes of the request now arriving
+int minL = 0;              // ...and its minimum length
+byte avrch = 0;            // ...and command
 byte buff[256];  // temporary buffer
 boolean EOP_SEEN = false;
+boolean spi_busy = false;    // spi_queue() byte still shifting out
+boolean target_busy = false; // target is writing flash or EEPROM
+unsigned long busy_since;    // ...since this time
+boolean write_failed = false; // a write timed out, not yet reported
+
+#ifdef DOUBLE_BUFFER
+#define PAGES 2
+byte buff2[256]; // second page buffer
+#else
+#define PAGES 1
+#endif
+// page writes not yet finished, oldest first
+typedef struct pagewrite {
+  byte *data;    // buff or buff2
+  int length;
+  int pos;       // bytes written so far
+  int addr;      // word address of the next byte
+  int page;      // flash page being loaded
+  char memtype;  // 'F' or 'E'
+}
+pagewrite;
+pagewrite writes[PAGES];
+byte nwrites = 0;
 
 void setup() {
 
-  Serial.begin(19200);
+  Serial.begin(BAUDRATE);
   pinMode(PIEZO, OUTPUT);
   beep(1700, 40);
   EOP_SEEN = false;
@@ -188,31 +249,73 @@ parameter param;
 //  delay(20);
 //}
   
-void getEOP() {
-  int minL = 0;
-  byte avrch = 0;
-  byte bl = 0;
-  while (!EOP_SEEN) {
-    while (Serial.available()>0) {
-      byte ch = Serial.read();
-      _buffer[iBuffer] = ch;
-      iBuffer = (++iBuffer)%256;  // increment and wrap
-      if (iBuffer == 1)  avrch = ch;  // save command
-      if ((avrch == STK_PROG_PAGE) && (iBuffer==3)) {
-        minL = 256*_buffer[1] + _buffer[2] + 4;
-      }
-      if ((iBuffer>minL) && (ch == CRC_EOP)) {
-        EOP_SEEN = true;
-      }
+// bytes before CRC_EOP in each request, so a 0x20 in the data isn't
+// mistaken for the end (STK_PROG_PAGE is worked out from its length)
+int request_length(byte cmd) {
+  switch (cmd) {
+    case STK_GET_PARM:     return 2;
+    case STK_SET_PARM:     return 21;
+    case STK_SET_PARM_EXT: return 6;
+    case STK_SET_ADDR:     return 3;
+    case STK_UNIVERSAL:    return 5;
+    case STK_PROG_FLASH:   return 3;
+    case STK_PROG_DATA:    return 2;
+    case STK_READ_PAGE:    return 4;
+    default:               return 0;
+  }
+}
+
+// move whatever has arrived at the serial port into _buffer, noting when
+// a complete request is in. Also called while waiting on the target, so
+// with DOUBLE_BUFFER the next request comes in during a page write.
+void serial_poll() {
+  while (!EOP_SEEN && (Serial.available()>0)) {
+    byte ch = Serial.read();
+    _buffer[iBuffer] = ch;
+    iBuffer = (iBuffer + 1) & (RX_SIZE - 1);  // increment and wrap
+    reqCount++;
+    if (reqCount == 1) {  // save command
+      avrch = ch;
+      minL = request_length(ch);
     }
-    if (!EOP_SEEN) {
+    if ((avrch == STK_PROG_PAGE) && (reqCount == 3)) {
+      minL = 256*_buffer[(iBuffer - 2) & (RX_SIZE - 1)] + ch + 4;
+    }
+    if ((reqCount>minL) && (ch == CRC_EOP)) {
+      EOP_SEEN = true;
+      reqEnd = iBuffer;
+      reqCount = 0;
+    }
+  }
+}
+
+// requests that don't need the target can be answered while page writes
+// are still going on; anything else waits for them to finish
+boolean can_handle() {
+  if (!nwrites) return true;
+  byte cmd = _buffer[pBuffer];
+  if (cmd == STK_SET_ADDR) return true;
+  if (cmd == STK_PROG_PAGE) return nwrites < PAGES;
+  return false;
+}
+
+void getEOP() {
+  unsigned long idle = millis();
+  while (!(EOP_SEEN && can_handle())) {
+    serial_poll();
+    if (nwrites) {
+      write_step();  // get on with the page write meanwhile
+    } else if (!EOP_SEEN) {
 //      heartbeat(); // light the heartbeat LED
-      if (bl == 100) {
-        pulse(LED_ERR,1,10);  // blink the red LED
-        bl = 0;
+      // blink the red LED about once a second; not with pulse(), which
+      // would leave the serial port unread for too long at high baud rates
+      unsigned long now = millis();
+      if (now - idle >= 1000) {
+        digitalWrite(LED_ERR, HIGH);
+        idle = now;
+      } else if (now - idle >= 10) {
+        digitalWrite(LED_ERR, error ? HIGH : LOW);
       }
-      bl++;
-      delay(10);
     }
   }
 }
@@ -251,8 +354,9 @@ void loop(void) {
   if (EOP_SEEN) {
     digitalWrite(LED_PMODE, HIGH);
     EOP_SEEN = false;
+    unsigned int end = reqEnd;
     avrisp();
-    iBuffer = pBuffer = 0;  // restart buffer
+    pBuffer = end;  // next request starts here, even if this one was bad
   }
   
 }
@@ -265,7 +369,7 @@ byte getch() {
     return -1;
   }
   byte ch = _buffer[pBuffer];  // get next char
-  pBuffer = (++pBuffer)%256;  // increment and wrap
+  pBuffer = (pBuffer + 1) & (RX_SIZE - 1);  // increment and wrap
   return ch;
 }
 
@@ -292,12 +396,18 @@ void pulse(int pin, int times) {
 
 void spi_init() {
   byte x;
-  SPCR = 0x53;
+#ifdef FAST_SPI
+  SPCR = 0x51;  // clock/16, 1 MHz
+#else
+  SPCR = 0x53;  // clock/128, 125 KHz
+#endif
 #ifdef LOW_SPEED
 SPCR=SPCR|B00000011;
 #endif
   x=SPSR;
   x=SPDR;
+  spi_busy = false;
+  target_busy = false;
 }
 
 void spi_wait() {
@@ -306,8 +416,29 @@ void spi_wait() {
   while (!(SPSR & (1 << SPIF)));
 }
 
+// wait for a byte started by spi_queue(), taking in serial data meanwhile
+void spi_flush() {
+  if (spi_busy) {
+    while (!(SPSR & (1 << SPIF))) serial_poll();
+    spi_busy = false;
+  }
+}
+
+// start a byte shifting out and return without waiting for it (the reply
+// is lost), so the next byte is ready to go as soon as this one is done
+void spi_queue(byte b) {
+#ifdef LOW_SPEED
+  spi_send(b);
+#else
+  spi_flush();
+  SPDR=b;
+  spi_busy = true;
+#endif
+}
+
 byte spi_send(byte b) {
   byte reply;
+  spi_flush();
 #ifdef LOW_SPEED
     cli();
     CLKPR=B10000000;
@@ -326,8 +457,33 @@ byte spi_send(byte b) {
     return reply;
 }
 
+// has the target finished its last write? Asks it (RDY/BSY polling) if
+// it supports that, otherwise allows the longest write time
+boolean target_ready() {
+  if (!target_busy) return true;
+  if (param.polling) {
+    spi_send(0xF0);
+    spi_send(0x00);
+    spi_send(0x00);
+    if (!(spi_send(0x00) & 1)) target_busy = false;
+  }
+  if (target_busy && (millis() - busy_since >= 45)) {
+    target_busy = false;
+    if (param.polling) {  // never finished
+      error++;
+      write_failed = true;
+    }
+  }
+  return !target_busy;
+}
+
+void wait_ready() {
+  while (!target_ready()) serial_poll();
+}
+
 byte spi_transaction(byte a, byte b, byte c, byte d) {
   byte n;
+  wait_ready();
   spi_send(a); 
   n=spi_send(b);
   //if (n != a) error = -1;
@@ -335,11 +491,18 @@ byte spi_transaction(byte a, byte b, byte c, byte d) {
   return spi_send(d);
 }
 
+// STK_OK, or STK_FAILED once after a write failed
+byte write_status() {
+  if (!write_failed) return STK_OK;
+  write_failed = false;
+  return STK_FAILED;
+}
+
 void replyOK() {
 //  if (EOP_SEEN == true) {
   if (CRC_EOP == getch()) {  // EOP should be next char
     Serial.write(STK_INSYNC);
-    Serial.write(STK_OK);
+    Serial.write(write_status());
   } 
   else {
     pulse(LED_ERR, 2);
@@ -424,6 +587,7 @@ void start_pmode() {
 }
 
 void end_pmode() {
+  wait_ready();  // let a last page finish writing
   pinMode(MISO, INPUT);
   pinMode(MOSI, INPUT);
   pinMode(SCK, INPUT);
@@ -442,11 +606,17 @@ void universal() {
   breply(ch);
 }
 
+// load instructions have no reply, so these bytes are queued back to back
 void flash(byte hilo, int addr, byte data) {
-  spi_transaction(0x40+8*hilo, addr>>8 & 0xFF, addr & 0xFF, data);
+  spi_queue(0x40+8*hilo);
+  spi_queue(addr>>8 & 0xFF);
+  spi_queue(addr & 0xFF);
+  spi_queue(data);
 }
 void commit(int addr) {
   spi_transaction(0x4C, (addr >> 8) & 0xFF, addr & 0xFF, 0);
+  target_busy = true;  // the next spi_transaction() waits for the write
+  busy_since = millis();
 }
 
 //#define _current_page(x) (here & 0xFFFFE0)
@@ -457,59 +627,78 @@ int current_page(int addr) {
   if (param.pagesize == 256) return addr & 0xFFFFFF80;
   return addr;
 }
-byte write_flash(int length) {
-  if (param.pagesize < 1) {
-    return STK_FAILED;
-  }
-  //if (param.pagesize != 64) return STK_FAILED;
-  int page = current_page(_addr);
-  int x = 0;
-  while (x < length) {
-    if (page != current_page(_addr)) {
-      commit(page);
-      page = current_page(_addr);
-    }
-    flash(LOW, _addr, buff[x++]);
-    flash(HIGH, _addr, buff[x++]);
-    _addr++;
-  }
-  commit(page);
-  return STK_OK;
+void queue_write(byte *data, int length, char memtype) {
+  pagewrite *w = &writes[nwrites++];
+  w->data = data;
+  w->length = length;
+  w->pos = 0;
+  w->addr = _addr;
+  w->page = current_page(_addr);
+  w->memtype = memtype;
+  if (memtype == 'F') _addr += length / 2;
 }
 
-byte write_eeprom(int length) {
-  // here is a word address, so we use here*2
-  // this writes byte-by-byte,
-  // page writing may be faster (4 bytes at a time)
-  for (int x = 0; x < length; x++) {
-    spi_transaction(0xC0, 0x00, _addr*2+x, buff[x]);
-    delay(45);
+// do the next small piece of the oldest page write: load one word into the
+// target's page buffer, commit a page, or write one EEPROM byte. Returns
+// straight away if the target is still busy, so the serial port can be
+// kept up with in between.
+void write_step() {
+  pagewrite *w = &writes[0];
+  if (!target_ready()) return;
+  if (w->memtype == 'F') {
+    if ((w->pos < w->length) && (w->page == current_page(w->addr))) {
+      flash(LOW, w->addr, w->data[w->pos++]);
+      flash(HIGH, w->addr, w->data[w->pos++]);
+      w->addr++;
+      return;
+    }
+    commit(w->page);  // page buffer full, or end of the data
+    w->page = current_page(w->addr);
   } 
-  return STK_OK;
+  else {
+    // here is a word address, so we use here*2
+    // this writes byte-by-byte,
+    // page writing may be faster (4 bytes at a time)
+    int ee = w->addr*2+w->pos;
+    spi_transaction(0xC0, (ee >> 8) & 0xFF, ee & 0xFF, w->data[w->pos++]);
+    target_busy = true;  // polled before the next byte, instead of delay(45)
+    busy_since = millis();
+  }
+  if (w->pos < w->length) return;
+  // this one's done, start on the next
+  if (--nwrites) writes[0] = writes[PAGES - 1];
 }
 
 void program_page() {
   byte result = STK_FAILED;
   int length = 256 * getch() + getch();
-  if (length > 256) {
+  if (length > (int)sizeof(buff)) {
       Serial.write(STK_FAILED);
       error++;
       return;
   }
   char memtype = (char)getch();
-//  for (int x = 0; x < length; x++) {
-//    buff[x] = getch();
-//  }
-  readbytes(length);
+  // into whichever page buffer isn't being written to the target
+  byte *data = buff;
+#ifdef DOUBLE_BUFFER
+  if (nwrites && (writes[0].data == buff)) data = buff2;
+#endif
+  for (int x = 0; x < length; x++) {
+    data[x] = getch();
+  }
   if (CRC_EOP == getch()) {
     Serial.write(STK_INSYNC);
-    switch (memtype) {
-      case 'E':
-        result = (byte)write_eeprom(length);
-        break;
-      case 'F':
-        result = (byte)write_flash(length);
-        break;
+    if ((memtype == 'E') || ((memtype == 'F') && (param.pagesize >= 1))) {
+      queue_write(data, length, memtype);
+#ifdef DOUBLE_BUFFER
+      // answer now; loop() writes the page while the next one comes in,
+      // and a failure is reported in a later reply
+      Serial.write(write_status());
+      return;
+#else
+      while (nwrites) write_step();
+      result = write_status();
+#endif
     }
     Serial.write(result);
     if (result != STK_OK) {
@@ -543,7 +732,8 @@ char flash_read_page(int length) {
 char eeprom_read_page(int length) {
   // here again we have a word address
   for (int x = 0; x < length; x++) {
-    byte ee = spi_transaction(0xA0, 0x00, _addr*2+x, 0xFF);
+    int addr = _addr*2+x;
+    byte ee = spi_transaction(0xA0, (addr >> 8) & 0xFF, addr & 0xFF, 0xFF);
     Serial.write( ee);
   }
   return STK_OK;
@@ -586,7 +776,7 @@ void read_signature() {
 ////////////////////////////////////
 ////////////////////////////////////
 
-int avrisp() { 
+void avrisp() { 
   byte data, low, high;
   byte avrch = getch();
   switch (avrch) {
@@ -0,0 +1,146 @@
+// Just enough of Arduino and the ATmega328 for ArduinoISP.ino on a PC, on
+// a simulated clock: every call is charged roughly what it takes on a
+// 16 MHz Uno, the SPI registers talk to the simulated target in
+// isp_test.cpp, and Serial is a UART at the set baud rate with the
+// 64-byte receive buffer of the Arduino core.
+#pragma once
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <deque>
+
+typedef uint8_t byte;
+typedef bool    boolean;
+
+#define HIGH   1
+#define LOW    0
+#define INPUT  0
+#define OUTPUT 1
+
+#define A0   14
+#define A3   17
+#define SS   10
+#define MOSI 11
+#define MISO 12
+#define SCK  13
+
+#define B00000011 3
+#define B10000000 0x80
+#define SPIF   7
+#define WGM11  1
+#define WGM12  3
+#define WGM13  4
+#define COM1A1 7
+#define CS10   0
+#define _BV(b) (1 << (b))
+
+// The simulated clock, in microseconds, and what happens as it moves on
+static double nowMicros = 0;
+void simulate();
+static inline void spend(double us) { nowMicros += us; }
+
+// The target's side of the SPI bus; one byte in, one byte out
+uint8_t targetTransfer(uint8_t b);
+
+static inline void cli() { }
+static inline void sei() { }
+
+static inline void pinMode(int, int) { spend(4); }
+static inline void digitalWrite(int, int) { spend(4); }
+static inline void delayMicroseconds(unsigned us) { spend(us); }
+static inline void delay(unsigned long ms) {
+  spend(ms * 1000.0);
+  simulate();
+}
+static inline unsigned long millis() {
+  spend(1);
+  return (unsigned long)(nowMicros / 1000);
+}
+
+// SPCR picks the SPI clock, SPDR starts a byte, SPSR says when it's done
+struct SPIControl {
+  uint8_t v = 0;
+  SPIControl &operator=(int x) { v = x; return *this; }
+  operator uint8_t() const { return v; }
+  double byteMicros() const {
+    static const int divider[4] = { 4, 16, 64, 128 };
+    return 8.0 * divider[v & 3] / 16;
+  }
+};
+static SPIControl SPCR;
+static double     spiDone;
+static uint8_t    spiReply;
+
+struct SPIStatus {
+  operator uint8_t() {
+    spend(0.25);
+    return (nowMicros >= spiDone) ? (1 << SPIF) : 0;
+  }
+};
+struct SPIData {
+  SPIData &operator=(uint8_t b) {
+    spend(0.25);
+    spiReply = targetTransfer(b);
+    spiDone  = nowMicros + SPCR.byteMicros();
+    return *this;
+  }
+  operator uint8_t() { return spiReply; }
+};
+static SPIStatus SPSR;
+static SPIData   SPDR;
+
+struct Register {
+  Register &operator=(int) { return *this; }
+};
+static Register OCR1A, ICR1, TCCR1A, TCCR1B;
+static Register CLKPR __attribute__((unused));  // LOW_SPEED only
+
+// What the sketch sends goes to hostReceive() as each byte finishes
+// going out on the wire
+void hostReceive(uint8_t b, double when);
+
+class SerialPort {
+ public:
+  long baud = 0;
+  std::deque<uint8_t> rx;  // The core's 64-byte receive buffer
+  int overflows = 0;
+
+  double byteMicros() { return 10e6 / baud; }
+  void begin(long b) { baud = b; }
+  int available() {
+    spend(1);
+    simulate();
+    return rx.size();
+  }
+  int read() {
+    spend(1);
+    if (rx.empty()) return -1;
+    int c = rx.front();
+    rx.pop_front();
+    return c;
+  }
+  // Waits only when the 64-byte transmit buffer is full
+  size_t write(uint8_t b) {
+    spend(2);
+    while (!txDone.empty() && (txDone.front() <= nowMicros)) txDone.pop_front();
+    if (txDone.size() >= 64) {
+      nowMicros = txDone.front();
+      txDone.pop_front();
+    }
+    txFree = ((txFree > nowMicros) ? txFree : nowMicros) + byteMicros();
+    txDone.push_back(txFree);
+    hostReceive(b, txFree);
+    return 1;
+  }
+  size_t write(const char *s) {
+    size_t n = 0;
+    while (*s) n += write((uint8_t)*s++);
+    return n;
+  }
+
+ private:
+  double txFree = 0;
+  std::deque<double> txDone;
+};
+static SerialPort Serial;
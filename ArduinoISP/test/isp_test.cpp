@@ -0,0 +1,330 @@
+// Host test and throughput benchmark for ArduinoISP.ino. Runs on a PC, not
+// the board; Arduino.h next to this file stands in for the core and the
+// ATmega328's SPI and UART, on a simulated clock.
+//
+// The sketch talks STK500v1 over the simulated serial link to a host that
+// sends requests the way avrdude does, each one after the reply to the
+// last plus a millisecond of USB-serial turnaround. On the SPI side is a
+// simulated target: a flash page buffer, page writes that take 4.5 ms,
+// EEPROM bytes 3.6 ms, and RDY/BSY polling. Each session enters
+// programming mode, reads the signature, erases the chip, writes a random
+// 32 KB image a page at a time, reads it back, writes and reads 256 bytes
+// of EEPROM and leaves programming mode. The target must end up holding
+// the image, every reply must be in sync and OK, no instruction may reach
+// the target while it's still writing, and the 64-byte serial receive
+// buffer must never overflow. That's done for 64, 128 and 256-byte pages
+// at 19200 and 115200 baud, and the write and read rates are printed in
+// KB/s next to what the serial link alone would allow. Then a page write
+// that never finishes must be answered with STK_FAILED, once.
+//
+//   g++ -O2 -I. -o isp_test isp_test.cpp
+//   ./isp_test
+//
+// Add -DDOUBLE_BUFFER for the double-buffered sketch. Exits nonzero on
+// failure.
+
+#include <vector>
+#include "Arduino.h"
+
+// What the Arduino IDE would generate
+void getEOP();
+void serial_poll();
+boolean can_handle();
+int request_length(byte cmd);
+byte getch();
+void readbytes(int n);
+void pulse(int pin, int times, int ptime);
+void pulse(int pin, int times);
+void spi_init();
+void spi_wait();
+void spi_flush();
+void spi_queue(byte b);
+byte spi_send(byte b);
+boolean target_ready();
+void wait_ready();
+byte spi_transaction(byte a, byte b, byte c, byte d);
+byte write_status();
+void replyOK();
+void breply(byte b);
+void get_parameter(byte c);
+void set_parameters();
+void start_pmode();
+void end_pmode();
+void universal();
+void flash(byte hilo, int addr, byte data);
+void commit(int addr);
+int current_page(int addr);
+void write_step();
+void program_page();
+byte flash_read(byte hilo, int addr);
+char flash_read_page(int length);
+char eeprom_read_page(int length);
+void read_page();
+void read_signature();
+void avrisp();
+void beep(int tone, long duration);
+
+// The sketch sets a few variables it never reads
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-but-set-variable"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#include "../ArduinoISP/ArduinoISP.ino"
+#pragma GCC diagnostic pop
+
+static int failures = 0;
+
+static void check(bool ok, const char *what) {
+  if (!ok && (failures++ < 10)) printf("FAIL: %s\n", what);
+}
+
+// An ATmega as seen over ISP, 4 bytes an instruction
+struct Target {
+  int     pageWords;
+  int     stuckPage;   // This page write takes 100 ms, past the sketch's limit
+  int     pageWrites;
+  int     violations;  // Instructions other than polls while still writing
+  double  busyUntil;
+  uint8_t cmd[4];
+  int     n;
+  std::vector<uint8_t> flash, eeprom, pageBuffer;
+
+  void reset(int words) {
+    pageWords = words;
+    stuckPage = -1;
+    pageWrites = violations = n = 0;
+    busyUntil = 0;
+    flash.assign(64 * 1024, 0x00);
+    eeprom.assign(1024, 0x00);
+    pageBuffer.assign(512, 0xFF);
+  }
+
+  bool busy() { return nowMicros < busyUntil; }
+
+  uint8_t transfer(uint8_t b) {
+    uint8_t reply = 0;
+    unsigned w = (cmd[1] << 8) | cmd[2];
+    if ((n == 2) && (cmd[0] == 0xAC) && (cmd[1] == 0x53)) reply = 0x53;  // In sync
+    if (n == 3) {
+      switch (cmd[0]) {
+        case 0x20: reply = flash[(w * 2) % flash.size()]; break;
+        case 0x28: reply = flash[(w * 2 + 1) % flash.size()]; break;
+        case 0xA0: reply = eeprom[w % eeprom.size()]; break;
+        case 0xF0: reply = busy(); break;
+        case 0x30: reply = "\x1e\x95\x0f"[cmd[2] % 3]; break;  // ATmega328P
+      }
+    }
+    cmd[n++] = b;
+    if (n < 4) return reply;
+    n = 0;
+    w = (cmd[1] << 8) | cmd[2];
+    if ((cmd[0] != 0xF0) && busy()) violations++;
+    switch (cmd[0]) {
+      case 0x40: pageBuffer[(w % pageWords) * 2] = cmd[3]; break;
+      case 0x48: pageBuffer[(w % pageWords) * 2 + 1] = cmd[3]; break;
+      case 0x4C:
+        memcpy(&flash[(w / pageWords) * pageWords * 2], &pageBuffer[0], pageWords * 2);
+        pageBuffer.assign(512, 0xFF);
+        busyUntil = nowMicros + ((pageWrites == stuckPage) ? 100000 : 4500);
+        pageWrites++;
+        break;
+      case 0xC0:
+        eeprom[w % eeprom.size()] = cmd[3];
+        busyUntil = nowMicros + 3600;
+        break;
+      case 0xAC:
+        if (cmd[1] == 0x80) {  // Chip erase
+          flash.assign(flash.size(), 0xFF);
+          eeprom.assign(eeprom.size(), 0xFF);
+          busyUntil = nowMicros + 9000;
+        }
+        break;
+    }
+    return reply;
+  }
+};
+
+static Target target;
+
+uint8_t targetTransfer(uint8_t b) { return target.transfer(b); }
+
+// avrdude's side: requests, each sent once the reply to the one before is in
+struct Request {
+  std::vector<uint8_t> bytes;
+  size_t replyLength;
+  int    phase;  // 0 setup, 1 write flash, 2 read flash, 3 EEPROM
+  double pause;  // Before the next request, as avrdude waits out a chip erase
+};
+
+struct Host {
+  std::vector<Request> requests;
+  size_t  next;           // Request to send next
+  bool    waiting;        // For the reply to requests[next - 1]
+  double  sendAt;         // When the next request goes out
+  std::deque<std::pair<double, uint8_t> > wire;  // Bytes on their way to the sketch
+  std::vector<uint8_t> reply, readBack, signature;
+  int     badReplies, failedReplies;
+  double  phaseStart[4], phaseEnd[4];
+  double  turnaround;
+
+  void reset() {
+    requests.clear();
+    wire.clear();
+    readBack.clear();
+    signature.clear();
+    next = 0;
+    waiting = false;
+    sendAt = 0;
+    badReplies = failedReplies = 0;
+    turnaround = 1000;
+    for (int i = 0; i < 4; i++) phaseStart[i] = phaseEnd[i] = 0;
+  }
+
+  void add(std::vector<uint8_t> bytes, size_t replyLength, int phase, double pause = 0) {
+    bytes.push_back(CRC_EOP);
+    Request r = { bytes, replyLength, phase, pause };
+    requests.push_back(r);
+  }
+};
+
+static Host host;
+
+struct Finished { };
+
+// Bytes from the host reach the serial receive buffer as they arrive
+void simulate() {
+  while (!host.wire.empty() && (host.wire.front().first <= nowMicros)) {
+    if (Serial.rx.size() >= 64) Serial.overflows++;
+    else Serial.rx.push_back(host.wire.front().second);
+    host.wire.pop_front();
+  }
+  if (host.waiting && (nowMicros > host.sendAt + 2e6)) throw Finished();  // Stuck
+  if (host.waiting || (nowMicros < host.sendAt)) return;
+  if (host.next == host.requests.size()) throw Finished();
+  Request &r = host.requests[host.next++];
+  double   t = host.sendAt;
+  for (size_t i = 0; i < r.bytes.size(); i++) {
+    t += Serial.byteMicros();
+    host.wire.push_back(std::make_pair(t, r.bytes[i]));
+  }
+  if (!host.phaseStart[r.phase]) host.phaseStart[r.phase] = host.sendAt;
+  host.reply.clear();
+  host.waiting = true;
+}
+
+void hostReceive(uint8_t b, double when) {
+  if (!host.waiting) {
+    host.badReplies++;  // Not asked for
+    return;
+  }
+  Request &r = host.requests[host.next - 1];
+  host.reply.push_back(b);
+  if (host.reply.size() < r.replyLength) return;
+  if ((host.reply[0] != STK_INSYNC) || (host.reply.back() != STK_OK)) {
+    if (host.reply.back() == STK_FAILED) host.failedReplies++;
+    else host.badReplies++;
+  }
+  if (r.bytes[0] == STK_READ_PAGE) {
+    host.readBack.insert(host.readBack.end(), host.reply.begin() + 1, host.reply.end() - 1);
+  }
+  if (r.bytes[0] == STK_READ_SIGN) host.signature.assign(host.reply.begin() + 1, host.reply.end() - 1);
+  host.phaseEnd[r.phase] = when;
+  host.sendAt = when + host.turnaround + r.pause;
+  host.waiting = false;
+}
+
+struct Result {
+  double writeKBs, readKBs, linkKBs;
+  bool   flashRight, readRight, eepromRight;
+};
+
+static Result session(long baud, int pageBytes, int stuckPage = -1) {
+  std::vector<uint8_t> image(32 * 1024), ee(256);
+  for (size_t i = 0; i < image.size(); i++) image[i] = rand();
+  for (size_t i = 0; i < ee.size(); i++) ee[i] = rand();
+
+  host.reset();
+  host.add({ STK_GET_SYNC }, 2, 0);
+  host.add({ STK_GET_SIGNON }, 9, 0);
+  host.add({ STK_SET_PARM, 0x86, 0, 0, 1, 1, 1, 1, 3, 0xFF, 0xFF, 0xFF, 0xFF,
+             (uint8_t)(pageBytes >> 8), (uint8_t)pageBytes, 4, 0, 0, 0, 0x80, 0 }, 2, 0);
+  host.add({ STK_SET_PARM_EXT, 0x05, 4, 0xD7, 0xC2, 0 }, 2, 0);
+  host.add({ STK_PMODE_START }, 2, 0);
+  host.add({ STK_READ_SIGN }, 5, 0);
+  host.add({ STK_UNIVERSAL, 0xAC, 0x80, 0, 0 }, 3, 0, 9000);
+  for (size_t a = 0; a < image.size(); a += pageBytes) {
+    host.add({ STK_SET_ADDR, (uint8_t)(a / 2), (uint8_t)(a / 2 >> 8) }, 2, 1);
+    std::vector<uint8_t> page = { STK_PROG_PAGE, (uint8_t)(pageBytes >> 8), (uint8_t)pageBytes, 'F' };
+    page.insert(page.end(), image.begin() + a, image.begin() + a + pageBytes);
+    host.add(page, 2, 1);
+  }
+  for (size_t a = 0; a < image.size(); a += pageBytes) {
+    host.add({ STK_SET_ADDR, (uint8_t)(a / 2), (uint8_t)(a / 2 >> 8) }, 2, 2);
+    host.add({ STK_READ_PAGE, (uint8_t)(pageBytes >> 8), (uint8_t)pageBytes, 'F' }, pageBytes + 2, 2);
+  }
+  for (size_t a = 0; a < ee.size(); a += 128) {
+    host.add({ STK_SET_ADDR, (uint8_t)(a / 2), 0 }, 2, 3);
+    std::vector<uint8_t> page = { STK_PROG_PAGE, 0, 128, 'E' };
+    page.insert(page.end(), ee.begin() + a, ee.begin() + a + 128);
+    host.add(page, 2, 3);
+  }
+  host.add({ STK_PMODE_END }, 2, 3);
+
+  target.reset(pageBytes / 2);
+  target.stuckPage = stuckPage;
+  nowMicros = 0;
+  Serial = SerialPort();
+  setup();
+  check(Serial.baud == BAUDRATE, "sketch opens the serial port at BAUDRATE");
+  Serial.baud = baud;
+  try {
+    for (;;) loop();
+  } catch (Finished &) { }
+
+  check(host.next == host.requests.size() && !host.waiting, "every request answered");
+  check(host.signature == std::vector<uint8_t>({ 0x1E, 0x95, 0x0F }), "signature read");
+  Result r;
+  double write = host.phaseEnd[1] - host.phaseStart[1], read = host.phaseEnd[2] - host.phaseStart[2];
+  r.writeKBs = image.size() / 1.024 / write * 1000;
+  r.readKBs  = image.size() / 1.024 / read * 1000;
+  // Set address and program page requests and replies, and two turnarounds
+  double page = (pageBytes + 5 + 4 + 2 + 2) * 10e6 / baud + 2 * host.turnaround;
+  r.linkKBs = pageBytes / 1.024 / page * 1000;
+  r.flashRight  = !memcmp(&target.flash[0], &image[0], image.size());
+  r.readRight   = host.readBack == image;
+  r.eepromRight = !memcmp(&target.eeprom[0], &ee[0], ee.size());
+  return r;
+}
+
+int main(void) {
+  srand(1);
+  printf("   baud  page  write KB/s  read KB/s  serial link alone\n");
+  const long baud[] = { 19200, 115200 };
+  const int  pages[] = { 64, 128, 256 };
+  for (int p = 0; p < 3; p++) {
+    double slower = 0;
+    for (int b = 0; b < 2; b++) {
+      Result r = session(baud[b], pages[p]);
+      printf("%7ld %5d %11.2f %10.2f %12.2f KB/s\n", baud[b], pages[p], r.writeKBs,
+             r.readKBs, r.linkKBs);
+      check(r.flashRight, "flash written");
+      check(r.readRight, "flash read back");
+      check(r.eepromRight, "EEPROM written");
+      check(!host.badReplies && !host.failedReplies, "every reply in sync and OK");
+      check(!target.violations, "nothing sent to the target while it's writing");
+      check(!Serial.overflows, "serial receive buffer never overflows");
+      check(r.writeKBs > slower, "faster at 115200");
+      slower = r.writeKBs;
+    }
+  }
+
+  // Page write 50 never reports finished
+  Result r = session(115200, 128, 50);
+  check(host.failedReplies == 1, "a write that never finishes answered STK_FAILED once");
+  check(!host.badReplies, "and every other reply in sync");
+  check(r.readRight, "the rest written");
+  printf("page write 50 stuck: %d STK_FAILED repl%s\n", host.failedReplies,
+         (host.failedReplies == 1) ? "y" : "ies");
+
+  printf("%s\n", failures ? "FAILED" : "every image written and read back");
+  return failures ? 1 : 0;
+}
@@ -0,0 +1 @@
+// Nothing needed from here; SS, MOSI, MISO and SCK are in Arduino.h
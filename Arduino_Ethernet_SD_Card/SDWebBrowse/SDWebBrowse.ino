@@ -90,162 +90,449 @@ void setup() {
   server.begin();
 }
 
-void ListFiles(EthernetClient client, uint8_t flags, File dir) {
-  client.println("<ul>");
-  while (true) {
-    File entry = dir.openNextFile();
-   
-    // done if past last used entry
-     if (! entry) {
-       // no more files
-       break;
-     }
+/************ CONNECTION STUFF ************/
+// Each browser connection gets a slot. loop() gives every slot one turn --
+// whatever request bytes have arrived, one sector of a file, or a buffer
+// full of a directory listing -- so a big download doesn't hold up a
+// directory listing or another download.
+#if defined(__AVR__)
+  #define MAX_CLIENTS 2     // RAM is tight
+#else
+  #define MAX_CLIENTS 4
+  #define DIR_INDEX_SIZE 16384  // see DIRECTORY INDEX below
+#endif
+#define STREAM_BUF 512      // one SD sector; aligned reads skip the SD cache
+#define PATH_LEN   40       // longest file path we'll look up
+#define LINE_LEN   (PATH_LEN + 16)  // the request line; other headers are cut short
+#define REQUEST_TIMEOUT 5000  // ms to wait for a whole request
+#define LIST_ENTRY_MAX 56   // longest listing line: two 8.3 names and the HTML
+#define CLOSE_DELAY 1       // ms the browser gets to take the last data
+
+enum { CONN_FREE, CONN_REQUEST, CONN_SEND, CONN_LIST, CONN_CLOSE };
 
-    // print any indent spaces
-    client.print("<li><a href=\"");
-    client.print(entry.name());
-    if (entry.isDirectory()) {
-       client.println("/");
+struct Connection {
+  EthernetClient client;
+  uint8_t  state;
+  char     path[PATH_LEN];
+  char     line[LINE_LEN];
+  uint8_t  lineLen;
+  bool     gotRequestLine, isGet, pathTooLong;
+  bool     hasRange, suffixRange, rangeHasEnd;
+  uint32_t rangeFirst, rangeLast;  // as sent: "bytes=first-last" or "bytes=-last"
+  File     file;                   // file being sent, or directory being listed
+  uint32_t remaining;              // bytes of file left to send
+  bool     listHeader;             // listing's headers not sent yet
+#ifdef DIR_INDEX_SIZE
+  bool     fromIndex;              // listing from dirIndex rather than the card
+  uint16_t indexPos;
+#endif
+  uint16_t toBoundary;             // bytes to the next sector boundary
+  unsigned long started;           // request start, or when closing began
+};
+
+Connection conns[MAX_CLIENTS];
+uint8_t buffer[STREAM_BUF];        // shared: request bytes, headers, file data
+
+// Declared here so the IDE's own prototypes don't come before Connection
+void startConnection(Connection &c, EthernetClient &client);
+void endConnection(Connection &c);
+void closeConnection(Connection &c);
+void readRequest(Connection &c);
+void parseRequestLine(Connection &c, char *line);
+void parseRange(Connection &c, char *value);
+void notFound(Connection &c);
+void startResponse(Connection &c);
+void sendChunk(Connection &c);
+void sendListing(Connection &c);
+bool nextListEntry(Connection &c, char *name, bool *isDir);
+
+/************ DIRECTORY INDEX ************/
+// The names in the last directory listed, so listing it again needn't open
+// every entry on the card. Each entry is a length byte, with INDEX_DIR set
+// for a directory, then the 8.3 name. A directory too big for it is listed
+// from the card every time.
+//
+// Not on AVR: with the SD library's block cache, the shared buffer and the
+// client slots, a 2 KB board has too little RAM left for the stack as it
+// is, and an index that small only holds about 20 names anyway.
+#ifdef DIR_INDEX_SIZE
+#define INDEX_DIR 0x80
+
+uint8_t  dirIndex[DIR_INDEX_SIZE];
+uint16_t dirIndexLen;
+char     dirIndexPath[PATH_LEN];
+bool     dirIndexReady;
+Connection *dirIndexOwner;         // connection filling it in, if any
+uint8_t  dirIndexReaders;          // connections listing from it
+#endif
+
+// Anything that writes to the card must call this so the next listing
+// comes from the card again. (This sketch only reads; a new card means a
+// reset, which empties the index anyway.)
+void dirIndexInvalidate() {
+#ifdef DIR_INDEX_SIZE
+  dirIndexReady = false;
+  dirIndexOwner = NULL;
+#endif
+}
+
+void loop()
+{
+  // Hand each new connection a free slot
+  EthernetClient client = server.accept();
+  if (client) {
+    uint8_t i;
+    for (i = 0; i < MAX_CLIENTS && conns[i].state != CONN_FREE; i++);
+    if (i < MAX_CLIENTS) {
+      startConnection(conns[i], client);
+    } else {
+      client.println("HTTP/1.1 503 Service Unavailable");
+      client.println("Connection: close");
+      client.println();
+      client.stop();
     }
-    client.print("\">");
-    
-    // print file name with possible blank fill
-    client.print(entry.name());
-    if (entry.isDirectory()) {
-       client.println("/");
+  }
+
+  for (uint8_t i = 0; i < MAX_CLIENTS; i++) {
+    Connection &c = conns[i];
+    if (c.state == CONN_REQUEST) {
+      readRequest(c);
+    } else if (c.state == CONN_SEND) {
+      sendChunk(c);
+    } else if (c.state == CONN_LIST) {
+      sendListing(c);
+    } else if (c.state == CONN_CLOSE) {
+      closeConnection(c);
     }
-        
-    client.print("</a>");
-/*
-    // print modify date/time if requested
-    if (flags & LS_DATE) {
-       dir.printFatDate(p.lastWriteDate);
-       client.print(' ');
-       dir.printFatTime(p.lastWriteTime);
+  }
+}
+
+void startConnection(Connection &c, EthernetClient &client) {
+  c.client = client;
+  c.state = CONN_REQUEST;
+  c.path[0] = 0;
+  c.lineLen = 0;
+  c.gotRequestLine = c.isGet = c.pathTooLong = false;
+  c.hasRange = false;
+  c.started = millis();
+}
+
+void endConnection(Connection &c) {
+  if (c.file) {
+    c.file.close();
+  }
+#ifdef DIR_INDEX_SIZE
+  if (c.state == CONN_LIST && c.fromIndex) {
+    dirIndexReaders--;
+  }
+  if (dirIndexOwner == &c) {  // didn't get to the end
+    dirIndexOwner = NULL;
+  }
+#endif
+  // give the web browser time to receive the data; the socket is closed
+  // on a later turn instead of waiting here and holding up the others
+  c.started = millis();
+  c.state = CONN_CLOSE;
+}
+
+void closeConnection(Connection &c) {
+  if ((millis() - c.started) <= CLOSE_DELAY) return;
+  c.client.stop();
+  c.state = CONN_FREE;
+}
+
+// Take whatever has arrived in one read and split it into header lines
+void readRequest(Connection &c) {
+  int avail = c.client.available();
+  if (avail <= 0) {
+    if (!c.client.connected() || (millis() - c.started) > REQUEST_TIMEOUT) {
+      endConnection(c);
     }
-    // print size if requested
-    if (!DIR_IS_SUBDIR(&p) && (flags & LS_SIZE)) {
-      client.print(' ');
-      client.print(p.fileSize);
+    return;
+  }
+  int n = c.client.read(buffer, min(avail, STREAM_BUF));
+  for (int i = 0; i < n; i++) {
+    char ch = buffer[i];
+    if (ch == '\r') continue;
+    if (ch != '\n') {
+      // too long for the buffer? keep the start, it's all we look at
+      if (c.lineLen < LINE_LEN - 1) {
+        c.line[c.lineLen++] = ch;
+      }
+      continue;
+    }
+    c.line[c.lineLen] = 0;
+    c.lineLen = 0;
+    if (c.line[0] == 0) {
+      // an http request ends with a blank line
+      if (c.gotRequestLine) {
+        startResponse(c);
+        return;
+      }
+      continue;
+    }
+    if (!c.gotRequestLine) {
+      parseRequestLine(c, c.line);
+    } else if (strncasecmp(c.line, "Range:", 6) == 0) {
+      parseRange(c, c.line + 6);
     }
-    */
-    client.println("</li>");
-    entry.close();
   }
-  client.println("</ul>");
 }
 
-// How big our line buffer should be. 100 is plenty!
-#define BUFSIZ 100
+void parseRequestLine(Connection &c, char *line) {
+  // Print it out for debugging
+  Serial.println(line);
+  c.gotRequestLine = true;
 
-void loop()
-{
-  char clientline[BUFSIZ];
-  char name[17];
-  int index = 0;
-  
-  EthernetClient client = server.available();
-  if (client) {
-    // an http request ends with a blank line
-    boolean current_line_is_blank = true;
-    
-    // reset the input buffer
-    index = 0;
-    
-    while (client.connected()) {
-      if (client.available()) {
-        char c = client.read();
-        
-        // If it isn't a new line, add the character to the buffer
-        if (c != '\n' && c != '\r') {
-          clientline[index] = c;
-          index++;
-          // are we too big for the buffer? start tossing out data
-          if (index >= BUFSIZ) 
-            index = BUFSIZ -1;
-          
-          // continue to read more data!
-          continue;
-        }
-        
-        // got a \n or \r new line, which means the string is done
-        clientline[index] = 0;
-        
-        // Print it out for debugging
-        Serial.println(clientline);
-        
-        // Look for substring such as a request to get the file
-        if (strstr(clientline, "GET /") != 0) {
-          // this time no space after the /, so a sub-file!
-          char *filename;
-          
-          filename = clientline + 5; // look after the "GET /" (5 chars)  *******
-          // a little trick, look for the " HTTP/1.1" string and 
-          // turn the first character of the substring into a 0 to clear it out.
-          (strstr(clientline, " HTTP"))[0] = 0;
- 
-          if(filename[strlen(filename)-1] == '/') {  // Trim a directory filename
-            filename[strlen(filename)-1] = 0;        //  as Open throws error with trailing /
-          }
-          
-          Serial.print(F("Web request for: ")); Serial.println(filename);  // print the file we want
-
-          File file = SD.open(filename, O_READ);
-          if ( file == 0 ) {  // Opening the file with return code of 0 is an error in SDFile.open
-            client.println("HTTP/1.1 404 Not Found");
-            client.println("Content-Type: text/html");
-            client.println();
-            client.println("<h2>File Not Found!</h2>");
-            client.println("<br><h3>Couldn't open the File!</h3>");
-            break; 
-          }
-          
-          Serial.println("File Opened!");
-                    
-          client.println("HTTP/1.1 200 OK");
-          if (file.isDirectory()) {
-            Serial.println("is a directory");
-            //file.close();
-            client.println("Content-Type: text/html");
-            client.println();
-            client.print("<h2>Files in /");
-            client.print(filename); 
-            client.println(":</h2>");
-            ListFiles(client,LS_SIZE,file);  
-            file.close();                   
-          } else { // Any non-directory clicked, server will send file to client for download
-            client.println("Content-Type: application/octet-stream");
-            client.println();
-          
-            char file_buffer[16];
-            int avail;
-            while (avail = file.available()) {
-              int to_read = min(avail, 16);
-              if (to_read != file.read(file_buffer, to_read)) {
-                break;
-              }
-              // uncomment the serial to debug (slow!)
-              //Serial.write((char)c);
-              client.write(file_buffer, to_read);
-            }
-            file.close();
-          }
-        } else {
-          // everything else is a 404
-          client.println("HTTP/1.1 404 Not Found");
-          client.println("Content-Type: text/html");
-          client.println();
-          client.println("<h2>File Not Found!</h2>");
-        }
-        break;
+  // Look for a request to get a file, such as "GET /DIR/FILE.TXT HTTP/1.1"
+  if (strncmp(line, "GET /", 5) != 0) return;
+  c.isGet = true;
+  char *filename = line + 5; // look after the "GET /" (5 chars)
+  char *end = strchr(filename, ' ');
+  if (!end) {  // cut short by LINE_LEN, or not HTTP/1.x
+    c.pathTooLong = true;
+    return;
+  }
+  *end = 0;
+  if (filename[0] && filename[strlen(filename)-1] == '/') {  // Trim a directory filename
+    filename[strlen(filename)-1] = 0;                         //  as Open throws error with trailing /
+  }
+  if (strlen(filename) >= PATH_LEN) {
+    c.pathTooLong = true;
+    return;
+  }
+  strcpy(c.path, filename);
+}
+
+// "Range: bytes=first-last", "bytes=first-" or "bytes=-suffix". Several
+// ranges at once aren't supported; the whole file is sent instead.
+void parseRange(Connection &c, char *value) {
+  while (*value == ' ') value++;
+  if (strncmp(value, "bytes=", 6) != 0 || strchr(value, ',')) return;
+  value += 6;
+  char *dash = strchr(value, '-');
+  if (!dash) return;
+  c.suffixRange = (dash == value);
+  c.rangeFirst = strtoul(value, NULL, 10);
+  c.rangeHasEnd = isdigit(dash[1]);
+  c.rangeLast = strtoul(dash + 1, NULL, 10);
+  c.hasRange = c.suffixRange ? c.rangeHasEnd : isdigit(value[0]);
+}
+
+void notFound(Connection &c) {
+  int n = snprintf_P((char *)buffer, STREAM_BUF, PSTR(
+    "HTTP/1.1 404 Not Found\r\n"
+    "Content-Type: text/html\r\n"
+    "Connection: close\r\n"
+    "\r\n"
+    "<h2>File Not Found!</h2>\r\n"));
+  c.client.write(buffer, n);
+}
+
+void startResponse(Connection &c) {
+  if (!c.isGet || c.pathTooLong) {
+    // everything else is a 404
+    notFound(c);
+    endConnection(c);
+    return;
+  }
+
+  Serial.print(F("Web request for: ")); Serial.println(c.path);  // print the file we want
+
+  File file = SD.open(c.path[0] ? c.path : "/", O_READ);
+  if ( file == 0 ) {  // Opening the file with return code of 0 is an error in SDFile.open
+    notFound(c);
+    endConnection(c);
+    return;
+  }
+
+  if (file.isDirectory()) {
+    Serial.println("is a directory");
+    c.listHeader = true;
+    c.file = file;
+#ifdef DIR_INDEX_SIZE
+    c.fromIndex = false;
+    if (dirIndexReady && strcmp(dirIndexPath, c.path) == 0) {
+      c.file.close();
+      c.fromIndex = true;
+      c.indexPos = 0;
+      dirIndexReaders++;
+    } else if (!dirIndexOwner && !dirIndexReaders) {
+      // Index this directory as it's listed, unless the index is in use
+      dirIndexReady = false;
+      dirIndexOwner = &c;
+      dirIndexLen = 0;
+      strcpy(dirIndexPath, c.path);
+    }
+#endif
+    c.state = CONN_LIST;
+    return;
+  }
+
+  // Any non-directory clicked, server will send file to client for
+  // download, all of it or the part asked for with Range
+  uint32_t size = file.size();
+  uint32_t first = 0, last = size - 1;
+  if (c.hasRange) {
+    if (c.suffixRange) {
+      first = (c.rangeLast < size) ? size - c.rangeLast : 0;
+    } else {
+      first = c.rangeFirst;
+      if (c.rangeHasEnd && c.rangeLast < last) last = c.rangeLast;
+    }
+    if (size == 0 || first > last || (c.suffixRange && c.rangeLast == 0)) {
+      int n = snprintf_P((char *)buffer, STREAM_BUF, PSTR(
+        "HTTP/1.1 416 Range Not Satisfiable\r\n"
+        "Content-Range: bytes */%lu\r\n"
+        "Connection: close\r\n"
+        "\r\n"), (unsigned long)size);
+      c.client.write(buffer, n);
+      file.close();
+      endConnection(c);
+      return;
+    }
+  }
+  c.remaining = size ? last - first + 1 : 0;
+
+  int n;
+  if (c.hasRange) {
+    n = snprintf_P((char *)buffer, STREAM_BUF, PSTR(
+      "HTTP/1.1 206 Partial Content\r\n"
+      "Content-Range: bytes %lu-%lu/%lu\r\n"),
+      (unsigned long)first, (unsigned long)last, (unsigned long)size);
+  } else {
+    n = snprintf_P((char *)buffer, STREAM_BUF, PSTR("HTTP/1.1 200 OK\r\n"));
+  }
+  n += snprintf_P((char *)buffer + n, STREAM_BUF - n, PSTR(
+    "Content-Type: application/octet-stream\r\n"
+    "Content-Length: %lu\r\n"
+    "Accept-Ranges: bytes\r\n"
+    "Connection: close\r\n"
+    "\r\n"), (unsigned long)c.remaining);
+  c.client.write(buffer, n);
+
+  if (first && !file.seek(first)) {
+    file.close();
+    endConnection(c);
+    return;
+  }
+  c.file = file;
+  c.toBoundary = STREAM_BUF - (first % STREAM_BUF);
+  c.state = CONN_SEND;
+}
+
+// Send the next piece of the file, up to the end of the current sector so
+// that every read after the first is a whole aligned sector, read by the
+// SD library straight into our buffer. If the socket hasn't room for it
+// yet, wait for a later turn rather than stall the other connections.
+void sendChunk(Connection &c) {
+  if (!c.remaining) {
+    endConnection(c);
+    return;
+  }
+  if (!c.client.connected()) {  // browser gave up or paused a download
+    endConnection(c);
+    return;
+  }
+  uint16_t n = c.toBoundary;
+  if (n > c.remaining) n = c.remaining;
+  if (c.client.availableForWrite() < n) return;
+
+  if (c.file.read(buffer, n) != n) {
+    endConnection(c);
+    return;
+  }
+  // uncomment the serial to debug (slow!)
+  //Serial.write(buffer, n);
+  c.client.write(buffer, n);
+  c.remaining -= n;
+  c.toBoundary = STREAM_BUF;
+}
+
+// Send the next part of a directory listing: as many entries as fit in
+// one buffer, so the socket gets a few full packets rather than a packet
+// per print()
+void sendListing(Connection &c) {
+  if (!c.client.connected()) {
+    endConnection(c);
+    return;
+  }
+  if (c.client.availableForWrite() < STREAM_BUF) return;
+
+  char *out = (char *)buffer;
+  int n = 0;
+  if (c.listHeader) {
+    n = snprintf_P(out, STREAM_BUF, PSTR(
+      "HTTP/1.1 200 OK\r\n"
+      "Content-Type: text/html\r\n"
+      "Connection: close\r\n"
+      "\r\n"
+      "<h2>Files in /%s:</h2>\r\n"
+      "<ul>\r\n"), c.path);
+    c.listHeader = false;
+  }
+
+  char name[13];
+  bool isDir;
+  while (n <= STREAM_BUF - LIST_ENTRY_MAX) {
+    if (!nextListEntry(c, name, &isDir)) {
+      n += snprintf_P(out + n, STREAM_BUF - n, PSTR("</ul>\r\n"));
+      c.client.write(buffer, n);
+#ifdef DIR_INDEX_SIZE
+      if (dirIndexOwner == &c) {
+        dirIndexReady = true;
+        dirIndexOwner = NULL;
       }
+#endif
+      endConnection(c);
+      return;
     }
-    // give the web browser time to receive the data
-    delay(1);
-    client.stop();
+    const char *slash = isDir ? "/" : "";
+    n += snprintf_P(out + n, STREAM_BUF - n,
+      PSTR("<li><a href=\"%s%s\">%s%s</a></li>\r\n"), name, slash, name, slash);
   }
+  c.client.write(buffer, n);
 }
 
+// Next name in the directory being listed, from the index or the card
+bool nextListEntry(Connection &c, char *name, bool *isDir) {
+#ifdef DIR_INDEX_SIZE
+  uint8_t len;
+  if (c.fromIndex) {
+    if (c.indexPos >= dirIndexLen) return false;
+    len = dirIndex[c.indexPos] & ~INDEX_DIR;
+    *isDir = dirIndex[c.indexPos] & INDEX_DIR;
+    memcpy(name, &dirIndex[c.indexPos + 1], len);
+    name[len] = 0;
+    c.indexPos += len + 1;
+    return true;
+  }
+#endif
+
+  File entry = c.file.openNextFile();
+  // done if past last used entry
+  if (! entry) {
+    return false;
+  }
+  strncpy(name, entry.name(), 12);
+  name[12] = 0;
+  *isDir = entry.isDirectory();
+  entry.close();
+
+#ifdef DIR_INDEX_SIZE
+  if (dirIndexOwner == &c) {
+    len = strlen(name);
+    if (dirIndexLen + len + 1 > DIR_INDEX_SIZE) {
+      dirIndexOwner = NULL;  // too big, leave it on the card
+    } else {
+      dirIndex[dirIndexLen] = len | (*isDir ? INDEX_DIR : 0);
+      memcpy(&dirIndex[dirIndexLen + 1], name, len);
+      dirIndexLen += len + 1;
+    }
+  }
+#endif
+  return true;
+}
 
 void printDirectory(File dir, int numTabs) {
    while(true) {
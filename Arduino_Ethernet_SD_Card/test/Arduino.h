@@ -0,0 +1,37 @@
+// Just enough of Arduino for SDWebBrowse.ino on a PC, with a virtual
+// clock: the SD and Ethernet stand-ins add what each call would cost on a
+// 16 MHz AVR to 'fakeMicros' instead of taking any real time.
+#pragma once
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <ctype.h>
+
+typedef uint8_t byte;
+typedef bool    boolean;
+
+#define PSTR(s) (s)
+#define F(s) (s)
+#define snprintf_P snprintf
+#define DEC 10
+
+extern double fakeMicros;
+extern long   delays;          // delay() calls, which stall every connection
+
+static unsigned long millis() { return (unsigned long)(fakeMicros / 1000); }
+static void delay(unsigned long ms) { fakeMicros += ms * 1000.0; delays++; }
+
+template <class A, class B> static A min(A a, B b) { return (a < (A)b) ? a : (A)b; }
+
+struct SerialStub {
+  void begin(long) { }
+  operator bool() { return true; }
+  template <class T> void print(T) { }
+  template <class T> void print(T, int) { }
+  template <class T> void println(T) { }
+  template <class T> void println(T, int) { }
+  void println() { }
+};
+extern SerialStub Serial;
@@ -0,0 +1,118 @@
+// Ethernet library stand-in for sdwebbrowse_test.cpp: each Sock is one
+// browser connection. Its 2 KB transmit buffer drains at 10 Mbit/s, and
+// each call is charged what it would cost over SPI to a W5500.
+#pragma once
+#include <string>
+#include <vector>
+#include "Arduino.h"
+
+#define COST_W5_REG   6.0   // one register access over SPI, us
+#define COST_W5_BYTE  1.2   // per payload byte over SPI, with loop overhead
+#define COST_W5_SEND 40.0   // SEND command and wait for SEND_OK
+#define LINK_RATE    1.25   // bytes/us out of a socket's transmit buffer
+#define TX_SIZE      2048
+
+extern double ethWrites;
+
+struct Sock {
+  std::string rx, got;       // what the browser sent, and what it received
+  size_t rxPos;
+  double txLevel, lastDrain;
+  bool   accepted, closed, peerGone;
+  double tConnect, tDone;
+  Sock() : rxPos(0), txLevel(0), lastDrain(0), accepted(false), closed(false),
+           peerGone(false), tConnect(0), tDone(-1) { }
+
+  void drain() {
+    txLevel -= (fakeMicros - lastDrain) * LINK_RATE;
+    if (txLevel < 0) txLevel = 0;
+    lastDrain = fakeMicros;
+  }
+};
+extern std::vector<Sock *> socks;
+
+struct IPAddress { };
+
+class EthernetClient {
+ public:
+  Sock *s;
+
+  EthernetClient() : s(0) { }
+  EthernetClient(Sock *x) : s(x) { }
+  operator bool() { return s != 0; }
+  uint8_t connected() {
+    fakeMicros += COST_W5_REG;
+    return s && !s->closed && !s->peerGone;
+  }
+  int available() {
+    fakeMicros += 2 * COST_W5_REG;
+    return s->rx.size() - s->rxPos;
+  }
+  int read(uint8_t *buf, size_t n) {
+    fakeMicros += 5 * COST_W5_REG + n * COST_W5_BYTE;
+    if (n > s->rx.size() - s->rxPos) n = s->rx.size() - s->rxPos;
+    memcpy(buf, &s->rx[s->rxPos], n);
+    s->rxPos += n;
+    return n;
+  }
+  int availableForWrite() {
+    fakeMicros += 2 * COST_W5_REG;
+    s->drain();
+    return TX_SIZE - (int)s->txLevel;
+  }
+  // Like the library, waits for room and writes what fits
+  size_t write(const uint8_t *buf, size_t n) {
+    for (size_t done = 0; done < n; ) {
+      fakeMicros += 2 * COST_W5_REG;
+      s->drain();
+      size_t room = TX_SIZE - (size_t)s->txLevel;
+      if (!room) {
+        fakeMicros += 10;
+        continue;
+      }
+      size_t k = (room < n - done) ? room : n - done;
+      fakeMicros += 4 * COST_W5_REG + k * COST_W5_BYTE + COST_W5_SEND;
+      ethWrites++;
+      s->got.append((const char *)buf + done, k);
+      s->txLevel += k;
+      done += k;
+    }
+    return n;
+  }
+  void print(const char *t) { write((const uint8_t *)t, strlen(t)); }
+  void println(const char *t) { print(t); print("\r\n"); }
+  void println() { print("\r\n"); }
+  void stop() {
+    fakeMicros += 4 * COST_W5_REG;
+    if (s && !s->closed) {
+      s->closed = true;
+      s->tDone = fakeMicros;
+    }
+  }
+};
+
+class EthernetServer {
+ public:
+  EthernetServer(int) { }
+  void begin() { }
+  EthernetClient accept() {
+    fakeMicros += 8 * COST_W5_REG;
+    for (size_t i = 0; i < socks.size(); i++) {
+      Sock *s = socks[i];
+      if (!s->accepted && s->tConnect <= fakeMicros) {
+        s->accepted = true;
+        return EthernetClient(s);
+      }
+    }
+    return EthernetClient();
+  }
+};
+
+struct EthernetClass {
+  void init(int) { }
+  void begin(byte *, byte *) { }
+  IPAddress localIP() { return IPAddress(); }
+};
+extern EthernetClass Ethernet;
+
+template <> inline void SerialStub::println<IPAddress>(IPAddress) { }
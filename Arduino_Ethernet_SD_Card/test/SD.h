@@ -0,0 +1,120 @@
+// SD library stand-in for sdwebbrowse_test.cpp: the card is a directory on
+// the PC. Reads are charged like the SD library's: a whole aligned 512 B
+// block goes straight to the caller, anything else comes through its one
+// block cache, fetching the block first if it isn't the cached one.
+#pragma once
+#include <dirent.h>
+#include <sys/stat.h>
+#include <string>
+#include "Arduino.h"
+
+#define O_READ 1
+
+#define COST_SD_CALL    15.0   // File::read() call overhead, us
+#define COST_SD_COPY     0.3   // per byte copied out of the block cache
+#define COST_SD_BLOCK  800.0   // fetch one 512 B block from the card
+#define COST_SD_OPEN  2000.0   // SD.open() walking the path
+#define COST_SD_ENTRY  250.0   // openNextFile(): read the entry, open it
+
+extern std::string cardRoot;
+extern double sdBlocks, sdReads;
+
+struct FileImpl {
+  std::string path, name;
+  bool        dir;
+  FILE       *f;
+  DIR        *d;
+  uint32_t    size, pos;
+  int64_t     cached;          // block in the SD library's cache, or -1
+};
+
+class File {
+ public:
+  FileImpl *p;
+
+  File() : p(0) { }
+  File(FileImpl *i) : p(i) { }
+  operator bool() const { return p != 0; }
+  bool operator==(int) const { return p == 0; }
+  const char *name() { return p->name.c_str(); }
+  bool isDirectory() { return p->dir; }
+  uint32_t size() { return p->size; }
+  int available() { fakeMicros += 4; return p->size - p->pos; }
+
+  bool seek(uint32_t pos) {
+    fakeMicros += 30;
+    if (pos > p->size) return false;
+    p->pos = pos;
+    return true;
+  }
+
+  int read(void *buf, uint16_t n) {
+    fakeMicros += COST_SD_CALL;
+    sdReads++;
+    if (n > p->size - p->pos) n = p->size - p->pos;
+    for (uint32_t pos = p->pos, left = n; left; ) {
+      uint32_t block = pos / 512, k = 512 - pos % 512;
+      if (k > left) k = left;
+      if (k == 512) {
+        fakeMicros += COST_SD_BLOCK;
+        sdBlocks++;
+        p->cached = -1;
+      } else {
+        if (p->cached != (int64_t)block) {
+          fakeMicros += COST_SD_BLOCK;
+          sdBlocks++;
+          p->cached = block;
+        }
+        fakeMicros += k * COST_SD_COPY;
+      }
+      pos  += k;
+      left -= k;
+    }
+    fseek(p->f, p->pos, SEEK_SET);
+    size_t got = fread(buf, 1, n, p->f);
+    p->pos += got;
+    return got;
+  }
+
+  File openNextFile() {
+    fakeMicros += COST_SD_ENTRY;
+    struct dirent *e;
+    while ((e = readdir(p->d))) {
+      if (e->d_name[0] != '.') return openPath(p->path + "/" + e->d_name, e->d_name);
+    }
+    return File();
+  }
+
+  void close() {
+    if (!p) return;
+    if (p->f) fclose(p->f);
+    if (p->d) closedir(p->d);
+    delete p;
+    p = 0;
+  }
+
+  static File openPath(const std::string &full, const std::string &name) {
+    struct stat st;
+    if (stat(full.c_str(), &st)) return File();
+    FileImpl *i = new FileImpl;
+    i->path   = full;
+    i->name   = name;
+    i->dir    = S_ISDIR(st.st_mode);
+    i->f      = i->dir ? 0 : fopen(full.c_str(), "rb");
+    i->d      = i->dir ? opendir(full.c_str()) : 0;
+    i->size   = st.st_size;
+    i->pos    = 0;
+    i->cached = -1;
+    return File(i);
+  }
+};
+
+struct SDClass {
+  bool begin(int) { return true; }
+  File open(const char *path, int = O_READ) {
+    fakeMicros += COST_SD_OPEN;
+    std::string p = (path[0] == '/') ? path + 1 : path;
+    return File::openPath(cardRoot + (p.empty() ? "" : "/" + p), p);
+  }
+};
+extern SDClass SD;
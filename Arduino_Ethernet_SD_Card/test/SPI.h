@@ -0,0 +1,3 @@
+// Nothing from SPI is used directly; the SD and Ethernet stand-ins cover it
+#pragma once
+#include "Arduino.h"
@@ -0,0 +1,284 @@
+// Host test for SDWebBrowse. Runs on a PC, not the board; the headers next
+// to this file stand in for Arduino, SD and Ethernet, with a virtual clock
+// charged what each call would cost on a 16 MHz AVR with a W5500 shield.
+//
+// Builds a card in a temporary directory, then sends the sketch browser
+// requests: whole downloads, Range requests (fixed edge cases and random
+// ones), a download cut off and resumed, directory listings of 10, 100 and
+// 1000 entries listed three times each, listings at the same time, and a
+// listing asked for during two downloads. Every body is compared with the
+// card, and nothing may call delay() once the sketch is serving.
+//
+//   g++ -O2 -I. -o sdwebbrowse_test sdwebbrowse_test.cpp
+//   ./sdwebbrowse_test
+//
+// Add -D__AVR__ to build it with the sketch's AVR settings: two client
+// slots, so a third browser at once gets a 503. Exits nonzero on failure.
+
+#include <stdlib.h>
+#include <unistd.h>
+#include <utility>
+#include "SPI.h"
+#include "SD.h"
+#include "Ethernet.h"
+
+double      fakeMicros = 0;
+long        delays = 0;
+SerialStub  Serial;
+std::string cardRoot;
+double      sdBlocks = 0, sdReads = 0, ethWrites = 0;
+SDClass     SD;
+std::vector<Sock *> socks;
+EthernetClass Ethernet;
+
+// What the Arduino IDE would generate
+void printDirectory(File dir, int numTabs);
+
+#include "../SDWebBrowse/SDWebBrowse.ino"
+
+static int failures = 0;
+
+static void check(bool ok, const char *what) {
+  if (!ok) { printf("FAIL: %s\n", what); failures++; }
+}
+
+/************ THE CARD ************/
+static void writeFile(const std::string &path, const std::string &data) {
+  FILE *f = fopen((cardRoot + "/" + path).c_str(), "wb");
+  fwrite(data.data(), 1, data.size(), f);
+  fclose(f);
+}
+
+static void makeDir(const std::string &path) {
+  mkdir((cardRoot + "/" + path).c_str(), 0755);
+}
+
+static std::string big;          // BIG.BIN, 1 MB
+
+static void makeCard() {
+  char tmpl[] = "/tmp/sdwebbrowse.XXXXXX";
+  cardRoot = mkdtemp(tmpl);
+  srand(42);
+  for (int i = 0; i < 1048576; i++) big += (char)rand();
+  writeFile("BIG.BIN", big);
+  writeFile("EMPTY.TXT", "");
+  writeFile("SMALL.BIN", big.substr(0, 3000));
+  for (int i = 1; i <= 10; i++) {
+    char name[16];
+    sprintf(name, "F%d.TXT", i);
+    writeFile(name, std::to_string(i) + "\n");
+  }
+  makeDir("SUBDIR");
+  writeFile("SUBDIR/A.TXT", "a\n");
+  for (int n = 10; n <= 1000; n *= 10) {
+    std::string dir = "D" + std::to_string(n);
+    makeDir(dir);
+    for (int i = 1; i <= n; i++) {
+      char name[16];
+      sprintf(name, "/F%04d.TXT", i);
+      writeFile(dir + name, "x\n");
+    }
+  }
+  makeDir("D100/SUB");
+}
+
+static void removeCard() {
+  std::string cmd = "rm -rf '" + cardRoot + "'";
+  if (system(cmd.c_str())) printf("couldn't remove %s\n", cardRoot.c_str());
+}
+
+/************ THE BROWSERS ************/
+struct Send { double at; Sock *s; std::string data; };
+static std::vector<Send> sends;
+
+// A browser connects at time 'at' and its request arrives in two pieces
+static Sock *connectAt(double at, const std::string &request) {
+  Sock *s = new Sock;
+  s->tConnect = s->lastDrain = at;
+  size_t half = request.size() / 2;
+  Send a = { at, s, request.substr(0, half) }, b = { at + 300, s, request.substr(half) };
+  sends.push_back(a);
+  sends.push_back(b);
+  socks.push_back(s);
+  return s;
+}
+
+static std::string get(const std::string &path, const std::string &extra = "") {
+  return "GET /" + path + " HTTP/1.1\r\nHost: x\r\n"
+         "User-Agent: test/1.0 with a header line longer than the line buffer\r\n" +
+         extra + "\r\n";
+}
+
+// Run loop() until every browser has its answer and the connection closed.
+// 'cut' goes away once it has 'cutAt' bytes.
+static void run(Sock *cut = 0, size_t cutAt = 0) {
+  double until = fakeMicros + 120e6;
+  while (fakeMicros < until) {
+    bool busy = false;
+    for (size_t i = 0; i < sends.size(); i++) {
+      if (!sends[i].s) continue;
+      busy = true;
+      if (sends[i].at <= fakeMicros) {
+        sends[i].s->rx += sends[i].data;
+        sends[i].s = 0;
+      }
+    }
+    loop();
+    fakeMicros += 5;  // the rest of a loop() pass
+    if (cut && (cut->got.size() >= cutAt)) cut->peerGone = true;
+    for (size_t i = 0; i < socks.size(); i++) busy |= !socks[i]->closed;
+    if (!busy) return;
+  }
+  check(false, "every connection closed");
+}
+
+static std::string body(Sock *s, std::string *head = 0) {
+  size_t end = s->got.find("\r\n\r\n");
+  if (end == std::string::npos) return "";
+  if (head) *head = s->got.substr(0, end);
+  return s->got.substr(end + 4);
+}
+
+static bool has(const std::string &text, const std::string &what) {
+  return text.find(what) != std::string::npos;
+}
+
+static double ms(Sock *s) { return (s->tDone - s->tConnect) / 1000; }
+
+/************ THE TESTS ************/
+static void download() {
+  double blocks = sdBlocks, reads = sdReads, writes = ethWrites;
+  Sock *s = connectAt(fakeMicros, get("BIG.BIN"));
+  run();
+  check(body(s) == big, "1 MB download");
+  double secs = ms(s) / 1000;
+  printf("1 MB download: %.2f s, %.1f KB/s, %.0f SD block fetches, "
+         "%.0f SD reads, %.0f socket writes\n", secs, 1024 / secs,
+         sdBlocks - blocks, sdReads - reads, ethWrites - writes);
+}
+
+static void ranges() {
+  static const struct { const char *range; int code; long first, last; } fixed[] = {
+    { "bytes=0-0",          206, 0,       0 },
+    { "bytes=511-512",      206, 511,     512 },
+    { "bytes=1048000-",     206, 1048000, 1048575 },
+    { "bytes=-100",         206, 1048476, 1048575 },
+    { "bytes=-2000000",     206, 0,       1048575 },
+    { "bytes=1048576-",     416, 0,       0 },
+    { "bytes=10-5",         416, 0,       0 },
+    { "bytes=0-10,20-30",   200, 0,       1048575 },  // several: whole file
+    { "bytes=100-99999999", 206, 100,     1048575 },
+    { "items=0-5",          200, 0,       1048575 },
+  };
+  int good = 0;
+  for (size_t i = 0; i < sizeof fixed / sizeof fixed[0]; i++) {
+    Sock *s = connectAt(fakeMicros, get("BIG.BIN", std::string("range: ") + fixed[i].range + "\r\n"));
+    run();
+    std::string head, b = body(s, &head);
+    std::string want = big.substr(fixed[i].first, fixed[i].last - fixed[i].first + 1);
+    char range[64];
+    sprintf(range, "Content-Range: bytes %ld-%ld/1048576", fixed[i].first, fixed[i].last);
+    bool ok = (head.size() > 9) && (atoi(head.c_str() + 9) == fixed[i].code);
+    if (fixed[i].code != 416) {
+      ok &= (b == want) && has(head, "Content-Length: " + std::to_string(b.size()));
+    }
+    if (fixed[i].code == 206) ok &= has(head, range);
+    if (!ok) printf("  %s\n", fixed[i].range);
+    check(ok, "Range edge case");
+    good += ok;
+  }
+
+  srand(43);
+  for (int i = 0; i < 40; i++) {
+    long first = rand() % big.size(), last = first + rand() % 5000;
+    if (last >= (long)big.size()) last = big.size() - 1;
+    std::string range = "Range: bytes=" + std::to_string(first) + "-" + std::to_string(last) + "\r\n";
+    Sock *s = connectAt(fakeMicros, get("BIG.BIN", range));
+    run();
+    bool ok = (body(s) == big.substr(first, last - first + 1));
+    check(ok, "random Range");
+    good += ok;
+  }
+
+  std::string head;
+  Sock *e = connectAt(fakeMicros, get("EMPTY.TXT"));
+  Sock *n = connectAt(fakeMicros, get("NOPE.TXT"));
+  run();
+  Sock *l = connectAt(fakeMicros, get(std::string(60, 'A')));
+  run();
+  check(body(e, &head).empty() && has(head, "Content-Length: 0"), "empty file");
+  check(has(n->got, " 404 "), "404 for a missing file");
+  check(has(l->got, " 404 "), "404 for an over-long path");
+  printf("%d Range requests OK\n", good);
+}
+
+static void resume() {
+  Sock *s = connectAt(fakeMicros, get("BIG.BIN"));
+  run(s, 300000);
+  std::string part = body(s);
+  Sock *r = connectAt(fakeMicros, get("BIG.BIN", "Range: bytes=" + std::to_string(part.size()) + "-\r\n"));
+  run();
+  check(part.size() < big.size() && part + body(r) == big, "resumed download");
+  printf("download cut off after %u bytes and resumed\n", (unsigned)part.size());
+}
+
+static void listings() {
+  for (int n = 10; n <= 1000; n *= 10) {
+    std::string dir = "D" + std::to_string(n) + "/", first;
+    for (int k = 0; k < 3; k++) {
+      double writes = ethWrites;
+      Sock *s = connectAt(fakeMicros, get(dir));
+      run();
+      std::string b = body(s);
+      bool all = true;
+      for (int i = 1; i <= n; i++) {
+        char name[16];
+        sprintf(name, "F%04d.TXT", i);
+        all &= has(b, name);
+      }
+      check(all, "every name listed");
+      if (k == 0) first = b;
+      else check(b == first, "listing the same each time");
+      printf("%4d entries, %s: %7.1f ms, %4.0f socket writes\n", n,
+             k ? "again" : "first", ms(s), ethWrites - writes);
+    }
+  }
+
+  // Two directories at once, and the first again while it's being listed
+  // (or turned away, with only two client slots)
+  Sock *a = connectAt(fakeMicros, get("D1000/"));
+  Sock *b = connectAt(fakeMicros + 100, get("D100/"));
+  Sock *c = connectAt(fakeMicros + 200, get("D1000/"));
+  run();
+  check(has(body(a), "F1000.TXT"), "directory listed");
+  check(has(body(b), "F0100.TXT") && has(body(b), "SUB/"), "other directory listed meanwhile");
+  if (MAX_CLIENTS > 2) check(body(c) == body(a), "same directory listed twice at once");
+  else check(has(c->got, " 503 "), "503 with every slot busy");
+  printf("listings at once: %.1f, %.1f, %.1f ms\n", ms(a), ms(b), ms(c));
+}
+
+static void parallel() {
+  Sock *a = connectAt(fakeMicros, get("BIG.BIN"));
+  Sock *b = connectAt(fakeMicros + 1000, get("BIG.BIN", "Range: bytes=524288-\r\n"));
+  Sock *l = connectAt(fakeMicros + 50000, get(""));
+  run();
+  check(body(a) == big && body(b) == big.substr(524288), "downloads at once");
+  if (MAX_CLIENTS > 2) check(has(body(l), "F10.TXT") && has(body(l), "SUBDIR/"), "listing during downloads");
+  else check(has(l->got, " 503 "), "503 with every slot busy");
+  printf("listing during two downloads: %.1f ms; downloads took %.0f and %.0f ms\n",
+         ms(l), ms(a), ms(b));
+}
+
+int main(void) {
+  makeCard();
+  setup();
+  delays = 0;
+  download();
+  ranges();
+  resume();
+  listings();
+  parallel();
+  check(delays == 0, "no delay() while serving");
+  removeCard();
+  return failures ? 1 : 0;
+}
@@ -78,6 +78,7 @@
     #define FACTORYRESET_ENABLE     1
 
     #define PIN                     6   // Which pin on the Arduino is connected to the NeoPixels?
+    #define FRAME_MS                500 // Time each snowflake shows in animation 1
 
 // Example for NeoPixel 8x8 Matrix.  In this application we'd like to use it 
 // with the back text positioned along the bottom edge.
@@ -118,13 +119,11 @@ void error(const __FlashStringHelper*err) {
 }
 
 // function prototypes over in packetparser.cpp
-uint8_t readPacket(Adafruit_BLE *ble, uint16_t timeout);
+void setPacketCallback(void (*callback)(uint8_t *packet, uint8_t len));
+void pollPackets(Adafruit_BLE *ble);
 float parsefloat(uint8_t *buffer);
 void printHex(const uint8_t * data, const uint32_t numBytes);
 
-// the packet buffer
-extern uint8_t packetbuffer[];
-
 
 /**************************************************************************/
 /*!
@@ -140,6 +139,7 @@ extern uint8_t packetbuffer[];
     uint8_t blue = 100;
     
     uint8_t animationState = 1;
+    boolean redraw = true; // Set when color or animation changes
 
 void setup(void)
 {
@@ -197,6 +197,7 @@ void setup(void)
 
   // Set Bluefruit to DATA mode
   Serial.println( F("Switching to DATA mode!") );
+  setPacketCallback(handlePacket);
   ble.setMode(BLUEFRUIT_MODE_DATA);
 
   Serial.println(F("***********************"));
@@ -205,24 +206,18 @@ void setup(void)
 
 /**************************************************************************/
 /*!
-    @brief  Constantly poll for new command or response data
+    @brief  Called from pollPackets() with each valid controller packet
 */
 /**************************************************************************/
-void loop(void)
+void handlePacket(uint8_t *packet, uint8_t len)
 {
-  
-  /* Wait for new data to arrive */
-  uint8_t len = readPacket(&ble, BLE_READPACKET_TIMEOUT);
-  //if (len == 0) return;
-
-  /* Got a packet! */
-  // printHex(packetbuffer, len);
+  // printHex(packet, len);
 
   // Color
-  if (packetbuffer[1] == 'C') {
-    red = packetbuffer[2];
-    green = packetbuffer[3];
-    blue = packetbuffer[4];
+  if (packet[1] == 'C') {
+    red = packet[2];
+    green = packet[3];
+    blue = packet[4];
     Serial.print ("RGB #");
     if (red < 0x10) Serial.print("0");
     Serial.print(red, HEX);
@@ -233,10 +228,10 @@ void loop(void)
   }
 
   // Buttons
-  if (packetbuffer[1] == 'B') {
+  if (packet[1] == 'B') {
  
-    uint8_t buttnum = packetbuffer[2] - '0';
-    boolean pressed = packetbuffer[3] - '0';
+    uint8_t buttnum = packet[2] - '0';
+    boolean pressed = packet[3] - '0';
     Serial.print ("Button "); Serial.print(buttnum);
     animationState = buttnum;
     if (pressed) {
@@ -245,53 +240,63 @@ void loop(void)
       Serial.println(" released");
     }
   }
-    
-      if (animationState == 1){ // animate through all the snowflakes
-        matrix.fillScreen(0);
-        showAllSnowflakes(matrix.Color(red, green, blue));
-        matrix.show(); // This sends the updated pixel colors to the hardware.
-      }
-  
-      if (animationState == 2){
-        matrix.fillScreen(0);
-        SnowFlake2(matrix.Color(red, green, blue));
-        matrix.show(); // This sends the updated pixel colors to the hardware.
-      }
 
-      if (animationState == 3){
-        matrix.fillScreen(0);
-        SnowFlake3(matrix.Color(red, green, blue));
-        matrix.show(); // This sends the updated pixel colors to the hardware.
-      }
-  
-      if (animationState == 4){ 
-        matrix.fillScreen(0);
-        SnowFlake4(matrix.Color(red, green, blue));
-        matrix.show(); // This sends the updated pixel colors to the hardware.
-      }
-      
-      if (animationState == 5){
-        matrix.fillScreen(0);
-        SnowFlake5(matrix.Color(red, green, blue));
-        matrix.show(); // This sends the updated pixel colors to the hardware.
-      }
-      if (animationState == 6){
-        matrix.fillScreen(0);
-        SnowFlake6(matrix.Color(red, green, blue));
-        matrix.show(); // This sends the updated pixel colors to the hardware.
-      }
-      if (animationState == 7){
-        matrix.fillScreen(0);
-        SnowFlake7(matrix.Color(red, green, blue));
-        matrix.show(); // This sends the updated pixel colors to the hardware.
-      }
-      if (animationState == 8){
-        matrix.fillScreen(0);
-        SnowFlake8(matrix.Color(red, green, blue));
-        matrix.show(); // This sends the updated pixel colors to the hardware.
-      }
-  
+  redraw = true;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Constantly poll for new command or response data
+*/
+/**************************************************************************/
+void loop(void)
+{
+  /* Handle whatever has arrived; never waits, so animation keeps going */
+  pollPackets(&ble);
+
+  // Snowflakes shown in turn by animation 1, one every FRAME_MS
+  static void (* const sequence[])(uint32_t) = {
+    SnowFlake1, SnowFlake5, SnowFlake2, SnowFlake8, SnowFlake3, SnowFlake9,
+    SnowFlake4, SnowFlake10, SnowFlake6, SnowFlake11, SnowFlake7, SnowFlake11 };
+  static uint32_t lastFrame = 0;
+  static uint8_t  frame = 0;
+
+  if ((animationState == 1) && ((millis() - lastFrame) >= FRAME_MS)) {
+    lastFrame = millis();
+    if (++frame >= sizeof(sequence) / sizeof(sequence[0])) frame = 0;
+    redraw = true;
+  }
 
+  if (!redraw) return;
+  redraw = false;
+
+  uint32_t c = matrix.Color(red, green, blue);
+  matrix.fillScreen(0);
+  if (animationState == 1){ // animate through all the snowflakes
+    sequence[frame](c);
+  }
+  if (animationState == 2){
+    SnowFlake2(c);
+  }
+  if (animationState == 3){
+    SnowFlake3(c);
+  }
+  if (animationState == 4){
+    SnowFlake4(c);
+  }
+  if (animationState == 5){
+    SnowFlake5(c);
+  }
+  if (animationState == 6){
+    SnowFlake6(c);
+  }
+  if (animationState == 7){
+    SnowFlake7(c);
+  }
+  if (animationState == 8){
+    SnowFlake8(c);
+  }
+  matrix.show(); // This sends the updated pixel colors to the hardware.
 }
 
 void SnowFlake1(uint32_t c){
@@ -21,10 +21,37 @@
 //    READ_BUFSIZE            Size of the read buffer for incoming packets
 #define READ_BUFSIZE                    (20)
 
+//    PACKET_RING_SIZE        Bytes queued between feedPacket() and
+//                            servicePackets(), must be a power of two
+//                            and larger than the longest packet
+#define PACKET_RING_SIZE                (64)
+#define PACKET_RING_MASK                (PACKET_RING_SIZE - 1)
 
-/* Buffer to hold incoming characters */
+
+/* Buffer to hold the most recent valid packet */
 uint8_t packetbuffer[READ_BUFSIZE+1];
 
+/* Packets that failed their checksum, had an unknown type or overflowed */
+uint32_t packetErrors = 0;
+
+/* Total packet length (including '!', type and checksum) for each type */
+static const struct {
+  char    type;
+  uint8_t len;
+} packetLengths[] = {
+  { 'A', PACKET_ACC_LEN      },
+  { 'G', PACKET_GYRO_LEN     },
+  { 'M', PACKET_MAG_LEN      },
+  { 'Q', PACKET_QUAT_LEN     },
+  { 'B', PACKET_BUTTON_LEN   },
+  { 'C', PACKET_COLOR_LEN    },
+  { 'L', PACKET_LOCATION_LEN },
+};
+
+static uint8_t          ring[PACKET_RING_SIZE];
+static volatile uint8_t ringHead = 0, ringTail = 0;
+static void           (*packetCallback)(uint8_t *packet, uint8_t len) = NULL;
+
 /**************************************************************************/
 /*!
     @brief  Casts the four bytes at the specified address to a float
@@ -70,70 +97,106 @@ void printHex(const uint8_t * data, const uint32_t numBytes)
 
 /**************************************************************************/
 /*!
-    @brief  Waits for incoming data and parses it
+    @brief  Sets the function called with each valid packet
+    @param  callback  Called as callback(packetbuffer, len) from
+                      servicePackets() or pollPackets()
 */
 /**************************************************************************/
-uint8_t readPacket(Adafruit_BLE *ble, uint16_t timeout) 
+void setPacketCallback(void (*callback)(uint8_t *packet, uint8_t len))
 {
-  uint16_t origtimeout = timeout, replyidx = 0;
-
-  memset(packetbuffer, 0, READ_BUFSIZE);
-
-  while (timeout--) {
-    if (replyidx >= 20) break;
-    if ((packetbuffer[1] == 'A') && (replyidx == PACKET_ACC_LEN))
-      break;
-    if ((packetbuffer[1] == 'G') && (replyidx == PACKET_GYRO_LEN))
-      break;
-    if ((packetbuffer[1] == 'M') && (replyidx == PACKET_MAG_LEN))
-      break;
-    if ((packetbuffer[1] == 'Q') && (replyidx == PACKET_QUAT_LEN))
-      break;
-    if ((packetbuffer[1] == 'B') && (replyidx == PACKET_BUTTON_LEN))
-      break;
-    if ((packetbuffer[1] == 'C') && (replyidx == PACKET_COLOR_LEN))
-      break;
-    if ((packetbuffer[1] == 'L') && (replyidx == PACKET_LOCATION_LEN))
-      break;
-
-    while (ble->available()) {
-      char c =  ble->read();
-      if (c == '!') {
-        replyidx = 0;
+  packetCallback = callback;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Queues one received byte for parsing. Doesn't parse anything
+            itself, so it's safe to call from a UART interrupt.
+    @return false if the ring buffer is full and the byte was dropped
+*/
+/**************************************************************************/
+bool feedPacket(uint8_t c)
+{
+  uint8_t next = (ringHead + 1) & PACKET_RING_MASK;
+  if (next == ringTail) {
+    packetErrors++;
+    return false;
+  }
+  ring[ringHead] = c;
+  ringHead = next;
+  return true;
+}
+
+/* Length of a packet with the given type byte, 0 if unknown */
+static uint8_t packetLength(uint8_t type)
+{
+  for (uint8_t i=0; i<sizeof(packetLengths)/sizeof(packetLengths[0]); i++) {
+    if (packetLengths[i].type == type) return packetLengths[i].len;
+  }
+  return 0;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Parses whatever bytes have been queued, calling the packet
+            callback for each valid packet. Never waits for more data;
+            a partial packet stays queued until the rest arrives.
+
+            Bytes are only removed from the queue once a packet checks
+            out. A bad checksum or unknown type drops just the '!' and
+            resumes searching from the next byte, so a corrupt or
+            truncated packet can't swallow a good one that follows it.
+*/
+/**************************************************************************/
+void servicePackets(void)
+{
+  for (;;) {
+    uint8_t tail  = ringTail;
+    uint8_t avail = (ringHead - tail) & PACKET_RING_MASK;
+
+    // Skip to start of packet
+    while (avail && (ring[tail] != '!')) {
+      tail = (tail + 1) & PACKET_RING_MASK;
+      avail--;
+    }
+    ringTail = tail;
+    if (avail < 2) return;
+
+    uint8_t len = packetLength(ring[(tail + 1) & PACKET_RING_MASK]);
+    if (len) {
+      if (avail < len) return; // Rest of packet not here yet
+
+      // Copy out and check checksum
+      uint8_t xsum = 0;
+      for (uint8_t i=0; i<len; i++) {
+        packetbuffer[i] = ring[(tail + i) & PACKET_RING_MASK];
+        if (i < len-1) xsum += packetbuffer[i];
+      }
+      packetbuffer[len] = 0;  // null term
+      if ((uint8_t)~xsum == packetbuffer[len-1]) {
+        ringTail = (tail + len) & PACKET_RING_MASK;
+        if (packetCallback) packetCallback(packetbuffer, len);
+        continue;
       }
-      packetbuffer[replyidx] = c;
-      replyidx++;
-      timeout = origtimeout;
     }
-    
-    if (timeout == 0) break;
-    delay(1);
-  }
 
-  packetbuffer[replyidx] = 0;  // null term
-
-  if (!replyidx)  // no data or timeout 
-    return 0;
-  if (packetbuffer[0] != '!')  // doesn't start with '!' packet beginning
-    return 0;
-  
-  // check checksum!
-  uint8_t xsum = 0;
-  uint8_t checksum = packetbuffer[replyidx-1];
-  
-  for (uint8_t i=0; i<replyidx-1; i++) {
-    xsum += packetbuffer[i];
+    // Unknown type or checksum mismatch, resync at next '!'
+    packetErrors++;
+    ringTail = (tail + 1) & PACKET_RING_MASK;
   }
-  xsum = ~xsum;
+}
 
-  // Throw an error message if the checksum's don't match
-  if (xsum != checksum)
-  {
-    Serial.print("Checksum mismatch in packet : ");
-    printHex(packetbuffer, replyidx+1);
-    return 0;
+/**************************************************************************/
+/*!
+    @brief  Moves whatever the BLE module has received into the queue
+            and parses it. Call every pass through loop(); returns
+            immediately if nothing has arrived.
+*/
+/**************************************************************************/
+void pollPackets(Adafruit_BLE *ble)
+{
+  // Only read what fits so nothing is lost; the rest waits in the module
+  while (((ringTail - ringHead - 1) & PACKET_RING_MASK) && ble->available()) {
+    feedPacket(ble->read());
   }
-  
-  // checksum passed!
-  return replyidx;
+  servicePackets();
 }
@@ -0,0 +1,12 @@
+// Adafruit_BLE stand-in: reads from a block of memory
+#ifndef ADAFRUIT_BLE_H
+#define ADAFRUIT_BLE_H
+
+class Adafruit_BLE {
+ public:
+  const uint8_t *p, *end;
+  int available() { return end - p; }
+  int read() { return *p++; }
+};
+
+#endif
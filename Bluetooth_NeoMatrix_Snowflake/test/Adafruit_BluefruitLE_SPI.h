@@ -0,0 +1 @@
+// Empty: nothing from Adafruit_BluefruitLE_SPI.h is used by packetParser.cpp
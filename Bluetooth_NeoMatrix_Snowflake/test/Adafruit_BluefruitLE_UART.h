@@ -0,0 +1 @@
+// Empty: nothing from Adafruit_BluefruitLE_UART.h is used by packetParser.cpp
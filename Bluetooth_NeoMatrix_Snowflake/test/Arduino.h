@@ -0,0 +1,20 @@
+// Just enough of Arduino.h for packetParser.cpp on a PC
+#ifndef ARDUINO_H
+#define ARDUINO_H
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stddef.h>
+
+#define F(x) x
+#define HEX 16
+
+struct SerialStub {
+  template <class T> void print(T) { }
+  template <class T> void print(T, int) { }
+  void println() { }
+  template <class T> void println(T) { }
+};
+static SerialStub Serial;
+
+#endif
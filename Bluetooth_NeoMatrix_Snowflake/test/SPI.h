@@ -0,0 +1 @@
+// Empty: nothing from SPI.h is used by packetParser.cpp
@@ -0,0 +1 @@
+// Empty: nothing from SoftwareSerial.h is used by packetParser.cpp
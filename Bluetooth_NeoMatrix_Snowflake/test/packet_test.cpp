@@ -0,0 +1,103 @@
+// Host test for packetParser.cpp (the same file is in both snowflake
+// sketches and in Feather_Holiday_Lights). Runs on a PC, not the board;
+// the headers next to this file stand in for the Arduino and BLE ones.
+//
+// Replays Bluefruit LE Connect packet streams through pollPackets() in
+// chunks of various sizes: clean streams, streams with truncated,
+// bad-checksum, unknown-type and garbage sections mixed in (every good
+// packet must still come out, in order), and a megabyte of '!'-heavy
+// random bytes. Then times a stream of 100000 packets.
+//
+//   g++ -O2 -I. -o packet_test packet_test.cpp
+//   ./packet_test
+//
+// Exits nonzero on failure.
+
+#include <stdlib.h>
+#include <time.h>
+#include <string>
+#include <vector>
+#include "../feather_neomatrix_bluetooth_snowflake/packetParser.cpp"
+
+static std::vector<std::string> got;
+static int failures = 0;
+
+static void check(bool ok, const char *what) {
+  if (!ok) {
+    printf("FAIL: %s\n", what);
+    failures++;
+  }
+}
+
+static void received(uint8_t *packet, uint8_t len) {
+  got.push_back(std::string((char *)packet, len));
+}
+
+// '!', type, body and checksum, as the app sends it
+static std::string packet(char type, const std::string &body) {
+  std::string s = std::string("!") + type + body;
+  uint8_t sum = 0;
+  for (size_t i = 0; i < s.size(); i++) sum += (uint8_t)s[i];
+  return s + (char)(uint8_t)~sum;
+}
+
+// Hand 's' to the parser 'chunk' bytes at a time, as if that's how the
+// BLE module had them ready
+static void replay(const std::string &s, size_t chunk) {
+  Adafruit_BLE ble;
+  for (size_t i = 0; i < s.size(); i += chunk) {
+    size_t n = (s.size() - i < chunk) ? s.size() - i : chunk;
+    ble.p   = (const uint8_t *)s.data() + i;
+    ble.end = ble.p + n;
+    while (ble.available()) pollPackets(&ble);
+  }
+}
+
+int main(void) {
+  setPacketCallback(received);
+  std::string color  = packet('C', "\x21\x21\x10");
+  std::string button = packet('B', "51");
+  std::string quat   = packet('Q', std::string(16, '!'));
+  std::string accel  = packet('A', std::string(12, 7));
+
+  static const size_t chunks[] = { 1, 3, 7, 64, 1000 };
+  for (unsigned c = 0; c < sizeof chunks / sizeof chunks[0]; c++) {
+    got.clear();
+    packetErrors = 0;
+    replay(color + button + quat + accel + color, chunks[c]);
+    check(got.size() == 5 && got[0] == color && got[1] == button &&
+          got[2] == quat && got[3] == accel && got[4] == color &&
+          !packetErrors, "clean stream");
+  }
+
+  got.clear();
+  packetErrors = 0;
+  std::string corrupt = color;
+  corrupt[3] ^= 1;
+  replay(std::string("!Q\x01\x02") + color + "xx!" + corrupt + "!Z" + button +
+         "garbage!" + accel, 5);
+  printf("damaged stream: %u good packets, %u errors\n",
+         (unsigned)got.size(), (unsigned)packetErrors);
+  check(got.size() == 3 && got[0] == color && got[1] == button &&
+        got[2] == accel, "good packets recovered from damaged stream");
+
+  srand(31);
+  std::string fuzz;
+  for (int i = 0; i < 1000000; i++) fuzz += (char)((rand() % 4 == 0) ? '!' : rand());
+  got.clear();
+  replay(fuzz, 17);
+  printf("fuzz: %u packets passed their checksum in 1MB of random bytes\n",
+         (unsigned)got.size());
+
+  std::string big;
+  for (int i = 0; i < 100000; i++) big += (i % 3 == 0) ? color : (i % 3 == 1) ? button : accel;
+  got.clear();
+  clock_t t0 = clock();
+  replay(big, 20);
+  double s = (double)(clock() - t0) / CLOCKS_PER_SEC;
+  printf("throughput: %u packets, %.1f MB/s, %.0f packets/s\n",
+         (unsigned)got.size(), big.size() / s / 1e6, got.size() / s);
+  check(got.size() == 100000, "all packets of a long stream");
+
+  return failures ? 1 : 0;
+}
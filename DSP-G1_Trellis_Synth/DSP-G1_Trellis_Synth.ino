@@ -1,5 +1,6 @@
 #include <MIDI.h>
 #include "Adafruit_Trellis.h"
+#include "MidiScheduler.h"
 //use Trellis 0-11 and 16-27 as input for notes.
 //use Trellis 12-15 and 28-31 for input to modes, sequencer, patches
 //six potentiometers as CC value input
@@ -7,7 +8,14 @@
 
 //John Park for Adafruit Industries
 
-MIDI_CREATE_DEFAULT_INSTANCE();
+//same port as MIDI_CREATE_DEFAULT_INSTANCE(), but with running status on:
+//a message of the same kind as the one before leaves out the status byte
+struct MidiSettings : public midi::DefaultSettings {
+  static const bool UseRunningStatus = true;
+};
+MIDI_CREATE_CUSTOM_INSTANCE(HardwareSerial, SERIAL_PORT_HARDWARE, MIDI, MidiSettings);
+MidiScheduler midiOut; //notes go out at once, CCs merged and paced; see MidiScheduler.h
+#define MIDI_STATS_MS 5000 //how often to print MIDI link use to Serial, 0 for never
 Adafruit_Trellis matrix0 = Adafruit_Trellis(); //left Trellis
 Adafruit_Trellis matrix1 = Adafruit_Trellis(); //right Trellis
 Adafruit_TrellisSet trellis =  Adafruit_TrellisSet(&matrix0, &matrix1);
@@ -133,6 +141,9 @@ int CC5_value;
 
 int CC_read[4] ;
 
+//Smoothed knob readings, in 1/16ths, so noise doesn't send CCs
+int knobSmooth[6] = {-1, -1, -1, -1, -1, -1};
+
 //Store previous values to enable hysteresis and pick-up mode for knobs
 int CC_bank0_lastValue[6] = {32, 32, 32, 32, 32, 32};
 int CC_bank1_lastValue[6] = {32, 32, 32, 32, 32, 32};
@@ -178,33 +189,55 @@ void setup() {
   }
 
   MIDI.begin(1);
+  midiBegin(&midiOut, 1, midiSend, micros());
 
   //All notes off MIDI panic if reset
   for(int n=0; n<128; n++){
-    MIDI.sendNoteOff(n, 127, 1);  //DC Filter cutoff
+    midiNoteOff(&midiOut, n, micros());
   }
 
 /////////////DSP-G1 CC Parameter Settings Defaults (to be changed with knobs)
-  MIDI.sendControlChange( 7, 119, 1);   //volume
-  MIDI.sendControlChange( 1, 24, 1);   //LFO mod 24
-  MIDI.sendControlChange(16,  6, 1);   //LFO rate 12
-  MIDI.sendControlChange(20,  0, 1);    //LFO waveform 0-63 sine, 64-127 S/H
-  MIDI.sendControlChange(74, 80, 1);  //DC Filter cutoff
-  MIDI.sendControlChange(71, 70, 1);   //DC Filter resonance
-  MIDI.sendControlChange(82, 32, 1);   //DC Filter envelope Attack
-  MIDI.sendControlChange(83, 38, 1);   //DC Filter envelope Decay
-  MIDI.sendControlChange(28, 64, 1);   //DC Filter envelope Sustain
-  MIDI.sendControlChange(29, 32, 1);   //DC Filter envelope Release
-  MIDI.sendControlChange(81, 57, 1);   //DC Filter envelope modulation
-  MIDI.sendControlChange(76, 100, 1);  //DC Oscillator waveform* 100
-  MIDI.sendControlChange( 4,  0, 1);   //DC Oscillator wrap
-  MIDI.sendControlChange(21,  0, 1);    //DC Oscillator range
-  MIDI.sendControlChange(93,  0, 1);    //DC Oscillator detune
-  MIDI.sendControlChange(73,  0, 1);   //DC Oscillator envelope Attack
-  MIDI.sendControlChange(75, 12, 1);   //DC Oscillator envelope Decay
-  MIDI.sendControlChange(31, 60, 1);   //DC Oscillator envelope Sustain
-  MIDI.sendControlChange(72, 80, 1);   //DC Oscillator envelope Release
+  midiCC(&midiOut,  7, 119);   //volume
+  midiCC(&midiOut,  1, 24);   //LFO mod 24
+  midiCC(&midiOut, 16,  6);   //LFO rate 12
+  midiCC(&midiOut, 20,  0);    //LFO waveform 0-63 sine, 64-127 S/H
+  midiCC(&midiOut, 74, 80);  //DC Filter cutoff
+  midiCC(&midiOut, 71, 70);   //DC Filter resonance
+  midiCC(&midiOut, 82, 32);   //DC Filter envelope Attack
+  midiCC(&midiOut, 83, 38);   //DC Filter envelope Decay
+  midiCC(&midiOut, 28, 64);   //DC Filter envelope Sustain
+  midiCC(&midiOut, 29, 32);   //DC Filter envelope Release
+  midiCC(&midiOut, 81, 57);   //DC Filter envelope modulation
+  midiCC(&midiOut, 76, 100);  //DC Oscillator waveform* 100
+  midiCC(&midiOut,  4,  0);   //DC Oscillator wrap
+  midiCC(&midiOut, 21,  0);    //DC Oscillator range
+  midiCC(&midiOut, 93,  0);    //DC Oscillator detune
+  midiCC(&midiOut, 73,  0);   //DC Oscillator envelope Attack
+  midiCC(&midiOut, 75, 12);   //DC Oscillator envelope Decay
+  midiCC(&midiOut, 31, 60);   //DC Oscillator envelope Sustain
+  midiCC(&midiOut, 72, 80);   //DC Oscillator envelope Release
 /*Wavforms: 0 tri, 25 squarish, 50 pulse, 75 other squarish, 100 saw      */
+  while (midiCCPending(&midiOut)) midiPoll(&midiOut, micros());
+  midiStatsReset(&midiOut, micros());
+}
+
+//MidiScheduler output: one message, through the MIDI library
+void midiSend(uint8_t status, uint8_t data1, uint8_t data2){
+  if ((status & 0xF0) == MIDI_CONTROL_CHANGE){
+    MIDI.sendControlChange(data1, data2, (status & 0x0F) + 1);
+  }
+  else {
+    MIDI.sendNoteOn(data1, data2, (status & 0x0F) + 1);
+  }
+}
+
+//Read a knob, each read moving half way to the new value
+int readKnob(int k){
+  int AnalogPin[6] = {A0, A1, A2, A3, A4, A5};
+  int raw = analogRead(AnalogPin[k]) * 16;
+  if (knobSmooth[k] < 0) knobSmooth[k] = raw;
+  else knobSmooth[k] += (raw - knobSmooth[k]) / 2;
+  return knobSmooth[k] / 16;
 }
 
 void loop(){
@@ -234,6 +267,8 @@ void loop(){
     for (b=0;b<6;b++){currentBank[b] = 4;}
   }
 
+  midiPoll(&midiOut, micros()); //knob CCs go out during the delay
+
   //Trellis MIDI out Keyboard
   delay(30); // 30ms delay is required, dont remove me!
 
@@ -246,7 +281,7 @@ void loop(){
           // Serial.print("logical pad: "); Serial.println(p);
           if(p<24){ //it's a MIDI note pad, play a note
             int padNote = logicalPads[i];
-            MIDI.sendNoteOn((scalesMatrix[scaleMode][padNoteMap[padNote]] + transpose[octave]), 127, 1);
+            midiNoteOn(&midiOut, (scalesMatrix[scaleMode][padNoteMap[padNote]] + transpose[octave]), 127, micros());
             //uncomment for debugging:
             /*
             Serial.print("v"); Serial.println(p); //print which button pressed
@@ -278,7 +313,7 @@ void loop(){
           //Serial.print("logical pad: "); Serial.println(p);
           if(p<24){ //it's a MIDI note pad, play a note
             int padNote=logicalPads[i];
-            MIDI.sendNoteOff((scalesMatrix[scaleMode][padNoteMap[padNote]] + transpose[octave]), 127, 1);
+            midiNoteOff(&midiOut, (scalesMatrix[scaleMode][padNoteMap[padNote]] + transpose[octave]), micros());
             //Serial.print("^"); Serial.println(p);
             for (uint8_t i=0; i<numKeys; i++) {
                trellis.clrLED(i);
@@ -316,19 +351,22 @@ void loop(){
             //Serial.print("pad note: "); Serial.println(padNote);
             //Serial.print("v"); Serial.println(i);
             if (trellis.isLED(i)){ // Alternate the button
-              MIDI.sendNoteOff((scalesMatrix[scaleMode][padNoteMap[padNote]] + transpose[octave]), 127, 1);
+              midiNoteOff(&midiOut, (scalesMatrix[scaleMode][padNoteMap[padNote]] + transpose[octave]), micros());
               trellis.clrLED(i);
             }
             else{
-              MIDI.sendNoteOn((scalesMatrix[scaleMode][padNoteMap[padNote]] + transpose[octave]), 127, 1);
+              midiNoteOn(&midiOut, (scalesMatrix[scaleMode][padNoteMap[padNote]] + transpose[octave]), 127, micros());
               trellis.setLED(i);
             }
           }
           else if (i==31){ // last button on bottom row swaps hold modes
             holdMode = !holdMode;
             lastHoldMode = holdMode;
-            for(int n=0; n<128; n++){
-              MIDI.sendNoteOff(n, 127, 1);  //DC Filter cutoff
+            for (uint8_t j=0; j<numKeys; j++) { //turn off notes still latched on
+              int q = logicalPads[j];
+              if (q<24 && trellis.isLED(j)) {
+                midiNoteOff(&midiOut, scalesMatrix[scaleMode][padNoteMap[q]] + transpose[octave], micros());
+              }
             }
             for (uint8_t j=0; j<24; j++) { //clear all note pads
               trellis.clrLED(j);
@@ -355,10 +393,34 @@ void loop(){
     }
     trellis.writeDisplay();
   }
+
+  midiPoll(&midiOut, micros());
+#if MIDI_STATS_MS
+  static uint32_t lastStats = 0;
+  if (millis() - lastStats >= MIDI_STATS_MS) {
+    lastStats = millis();
+    printMidiStats();
+  }
+#endif
+}
+
+void printMidiStats(){
+  Serial.print("MIDI link "); Serial.print(midiUtilization(&midiOut, micros()));
+  Serial.print("% busy, "); Serial.print(midiOut.bytes);
+  Serial.print(" bytes in "); Serial.print(midiOut.messages);
+  Serial.print(" messages; notes "); Serial.print(midiOut.notes);
+  if (midiOut.notes) {
+    Serial.print(" waited for the link avg "); Serial.print(midiOut.noteWaitUsSum / midiOut.notes / 1000.0, 2);
+    Serial.print(" ms, max "); Serial.print(midiOut.noteWaitUsMax / 1000.0, 2);
+    Serial.print(" ms");
+  }
+  Serial.print("; CCs "); Serial.print(midiOut.ccSent);
+  Serial.print(" sent, "); Serial.print(midiOut.ccMerged);
+  Serial.println(" merged");
+  midiStatsReset(&midiOut, micros());
 }
 
 void read_CC_Knobs(int CC_bank){
-  int AnalogPin[6] = {A0, A1, A2, A3, A4, A5}; //define the analog pins
   int CCKnob[6] = {0, 1, 2, 3, 4, 5}; //define knobs
   // choose which CC numbers are on each knob per bank
   // definitions are at bottom of code
@@ -433,7 +495,7 @@ void read_CC_Knobs(int CC_bank){
         //digitalWrite(LED, LOW);
         //is different than the last bank for the current knob:
        //read CC values from potentiometers
-        CC_read[CC_bank] = analogRead(AnalogPin[k]);
+        CC_read[CC_bank] = readKnob(k);
         CC_bank0_value[k] = map(CC_read[CC_bank], 0, 1023, 0, 127); // remap range to 0-127
         //check against last read when we were on this bank, only send CC if value
         //of knob is withing a certain delta of the last value
@@ -447,13 +509,13 @@ void read_CC_Knobs(int CC_bank){
       }
       else if(currentBank[k] == lastBank[k]){
         //read CC values from potentiometers
-        CC_read[CC_bank] = analogRead(AnalogPin[k]);
+        CC_read[CC_bank] = readKnob(k);
         CC_bank0_value[k] = map(CC_read[CC_bank], 0, 1023, 0, 127); // remap range to 0-127
         //check against last read, only send CC if value has changed since last read by a certain delta
         if((abs(CC_bank0_lastValue[k] - CC_bank0_value[k])) > 3){ //hysteresis for spinning knob too fast
           Serial.print("\nCC_bank0_value for knob: "); Serial.print(k); Serial.print("\t"); Serial.println(CC_bank0_value[k]);
           Serial.print("CC_bank0_lastValue for knob: "); Serial.print(k); Serial.print("\t"); Serial.println(CC_bank0_lastValue[k]);
-          MIDI.sendControlChange(CCNumber[k], CC_bank0_value[k], 1);
+          midiCC(&midiOut, CCNumber[k], CC_bank0_value[k]);
           //Serial.print("CC number: "); Serial.println(CCNumber[k]);
           CC_bank0_lastValue[k] = CC_bank0_value[k];
           lastBank[k] = 0;
@@ -466,7 +528,7 @@ void read_CC_Knobs(int CC_bank){
     for(int k=0; k<6; k++){ //loop through each of six pots
       if(currentBank[k] != lastBank[k]){
        //read CC values from potentiometers
-        CC_read[CC_bank] = analogRead(AnalogPin[k]);
+        CC_read[CC_bank] = readKnob(k);
         CC_bank1_value[k] = map(CC_read[CC_bank], 0, 1023, 0, 127); // remap range to 0-127
         //check against last read when we were on this bank, only send CC if value
         //of knob is withing a certain delta of the last value
@@ -479,13 +541,13 @@ void read_CC_Knobs(int CC_bank){
       }
       else if(currentBank[k] == lastBank[k]){
         //read CC values from potentiometers
-          CC_read[CC_bank] = analogRead(AnalogPin[k]);
+          CC_read[CC_bank] = readKnob(k);
           CC_bank1_value[k] = map(CC_read[CC_bank], 0, 1023, 0, 127); // remap range to 0-127
           //check against last read, only send CC if value has changed since last read by a certain delta
         if((abs(CC_bank1_lastValue[k] - CC_bank1_value[k])) > 3){ //hysteresis for spinning knob too fast
           Serial.print("\nCC_bank1_value for knob: "); Serial.print(k); Serial.print("\t"); Serial.println(CC_bank1_value[k]);
           Serial.print("CC_bank1_lastValue for knob: "); Serial.print(k); Serial.print("\t"); Serial.println(CC_bank1_lastValue[k]);
-          MIDI.sendControlChange(CCNumber[k], CC_bank1_value[k], 1);
+          midiCC(&midiOut, CCNumber[k], CC_bank1_value[k]);
           //Serial.print("CC number: "); Serial.println(CCNumber[k]);
           CC_bank1_lastValue[k] = CC_bank1_value[k];
           lastBank[k] = 1;
@@ -497,7 +559,7 @@ void read_CC_Knobs(int CC_bank){
     for(int k=0; k<6; k++){ //loop through each of six pots
       if(currentBank[k] != lastBank[k]){
         //read CC values from potentiometers
-        CC_read[CC_bank] = analogRead(AnalogPin[k]);
+        CC_read[CC_bank] = readKnob(k);
         CC_bank2_value[k] = map(CC_read[CC_bank], 0, 1023, 0, 127); // remap range to 0-127
         //check against last read when we were on this bank, only send CC if value
         //of knob is withing a certain delta of the last value
@@ -510,13 +572,13 @@ void read_CC_Knobs(int CC_bank){
       }
       else if(currentBank[k] == lastBank[k]){
         //read CC values from potentiometers
-          CC_read[CC_bank] = analogRead(AnalogPin[k]);
+          CC_read[CC_bank] = readKnob(k);
           CC_bank2_value[k] = map(CC_read[CC_bank], 0, 1023, 0, 127); // remap range to 0-127
           //check against last read, only send CC if value has changed since last read by a certain delta
         if((abs(CC_bank2_lastValue[k] - CC_bank2_value[k])) > 3){ //hysteresis for spinning knob too fast
           Serial.print("\nCC_bank2_value for knob: "); Serial.print(k); Serial.print("\t"); Serial.println(CC_bank2_value[k]);
           Serial.print("CC_bank2_lastValue for knob: "); Serial.print(k); Serial.print("\t"); Serial.println(CC_bank2_lastValue[k]);
-          MIDI.sendControlChange(CCNumber[k], CC_bank2_value[k], 1);
+          midiCC(&midiOut, CCNumber[k], CC_bank2_value[k]);
           //Serial.print("CC number: "); Serial.println(CCNumber[k]);
           CC_bank2_lastValue[k] = CC_bank2_value[k];
           lastBank[k] = 2;
@@ -528,7 +590,7 @@ void read_CC_Knobs(int CC_bank){
     for(int k=0; k<6; k++){ //loop through each of six pots
       if(currentBank[k] != lastBank[k]){
        //read CC values from potentiometers
-        CC_read[CC_bank] = analogRead(AnalogPin[k]);
+        CC_read[CC_bank] = readKnob(k);
         CC_bank3_value[k] = map(CC_read[CC_bank], 0, 1023, 0, 127); // remap range to 0-127
         //check against last read when we were on this bank, only send CC if value
         //of knob is withing a certain delta of the last value
@@ -541,13 +603,13 @@ void read_CC_Knobs(int CC_bank){
       }
       else if(currentBank[k] == lastBank[k]){
         //read CC values from potentiometers
-          CC_read[CC_bank] = analogRead(AnalogPin[k]);
+          CC_read[CC_bank] = readKnob(k);
           CC_bank3_value[k] = map(CC_read[CC_bank], 0, 1023, 0, 127); // remap range to 0-127
           //check against last read, only send CC if value has changed since last read by a certain delta
         if((abs(CC_bank3_lastValue[k] - CC_bank3_value[k])) > 3){ //hysteresis for spinning knob too fast
           Serial.print("\nCC_bank3_value for knob: "); Serial.print(k); Serial.print("\t"); Serial.println(CC_bank3_value[k]);
           Serial.print("CC_bank3_lastValue for knob: "); Serial.print(k); Serial.print("\t"); Serial.println(CC_bank3_lastValue[k]);
-          MIDI.sendControlChange(CCNumber[k], CC_bank3_value[k], 1);
+          midiCC(&midiOut, CCNumber[k], CC_bank3_value[k]);
           //Serial.print("CC number: "); Serial.println(CCNumber[k]);
           CC_bank3_lastValue[k] = CC_bank3_value[k];
           lastBank[k] = 3;
@@ -0,0 +1,145 @@
+// MIDI output scheduling for the DSP-G1 Trellis synth
+//
+// DIN MIDI runs at 31250 baud, about a message a millisecond. Sending each
+// default setting and knob change the moment it happens piles bytes up in
+// the UART ahead of any note played meanwhile. Instead:
+//
+//  - Notes go out straight away.
+//  - Control changes wait in a table, one per controller; a newer value
+//    for a controller replaces one not sent yet. midiPoll() sends them a
+//    few at a time, only while the link has less than MIDI_CC_BACKLOG_US
+//    of bytes still to go, so a note never waits behind more than that.
+//  - Note offs go as note on with velocity 0. With running status (set
+//    in the sketch's MIDI settings) a message of the same kind as the one
+//    before it is then 2 bytes, not 3.
+//
+// To pace itself the scheduler keeps its own account of when the bytes
+// written so far will be on the wire, which also gives how busy the link
+// has been and how long each note waited for it, from midiNoteOn() or
+// midiNoteOff() to its last byte on the wire. That's only the link's part
+// of a note's latency: the loop's delay and key scan before the sketch
+// sees a press aren't counted. Nothing here touches the serial port --
+// the send() function passed in does -- so the same code can run on a PC.
+
+#ifndef MIDI_SCHEDULER_H
+#define MIDI_SCHEDULER_H
+
+#include <stdint.h>
+
+#define MIDI_US_PER_BYTE    320     // 10 bits at 31250 baud
+#ifndef MIDI_CC_BACKLOG_US
+#define MIDI_CC_BACKLOG_US  5000    // about 7 CCs; well inside a 64 byte UART buffer
+#endif
+
+#define MIDI_NOTE_ON        0x90
+#define MIDI_CONTROL_CHANGE 0xB0
+
+typedef void (*MidiSend)(uint8_t status, uint8_t data1, uint8_t data2);
+
+typedef struct {
+  MidiSend send;
+  uint8_t  channel;                 // 1-16
+  uint8_t  lastStatus;              // for running status, 0 = none yet
+  uint32_t busyUntil;               // micros() when the link goes idle
+  uint8_t  ccValue[128];
+  uint8_t  ccPending[16];           // bit per controller
+  uint8_t  ccNext;                  // where the next scan for pending starts
+  // Since midiStatsReset()
+  uint32_t since, busyUs, bytes, messages;
+  uint32_t notes, noteWaitUsSum, noteWaitUsMax; // call to last byte sent
+  uint32_t ccSent, ccMerged;
+} MidiScheduler;
+
+static void midiStatsReset(MidiScheduler *m, uint32_t now) {
+  m->since = now;
+  m->busyUs = m->bytes = m->messages = 0;
+  m->notes = m->noteWaitUsSum = m->noteWaitUsMax = 0;
+  m->ccSent = m->ccMerged = 0;
+}
+
+static void midiBegin(MidiScheduler *m, uint8_t channel, MidiSend send,
+                      uint32_t now) {
+  m->send = send;
+  m->channel = channel;
+  m->lastStatus = 0;
+  m->busyUntil = now;
+  m->ccNext = 0;
+  for (uint8_t i = 0; i < 16; i++) m->ccPending[i] = 0;
+  midiStatsReset(m, now);
+}
+
+// Write one message; returns when its last byte will be on the wire
+static uint32_t midiWrite(MidiScheduler *m, uint8_t kind, uint8_t data1,
+                          uint8_t data2, uint32_t now) {
+  uint8_t status = kind | (m->channel - 1);
+  uint8_t n = (status == m->lastStatus) ? 2 : 3;
+  m->lastStatus = status;
+  m->send(status, data1, data2);
+
+  uint32_t start = ((int32_t)(m->busyUntil - now) > 0) ? m->busyUntil : now;
+  m->busyUntil = start + n * MIDI_US_PER_BYTE;
+  m->busyUs += n * MIDI_US_PER_BYTE;
+  m->bytes += n;
+  m->messages++;
+  return m->busyUntil;
+}
+
+static void midiNote(MidiScheduler *m, uint8_t note, uint8_t velocity,
+                     uint32_t now) {
+  uint32_t wait = midiWrite(m, MIDI_NOTE_ON, note, velocity, now) - now;
+  m->notes++;
+  m->noteWaitUsSum += wait;
+  if (wait > m->noteWaitUsMax) m->noteWaitUsMax = wait;
+}
+
+static void midiNoteOn(MidiScheduler *m, uint8_t note, uint8_t velocity,
+                       uint32_t now) {
+  midiNote(m, note, velocity, now);
+}
+
+static void midiNoteOff(MidiScheduler *m, uint8_t note, uint32_t now) {
+  midiNote(m, note, 0, now);
+}
+
+// Set a controller; it goes out from midiPoll()
+static void midiCC(MidiScheduler *m, uint8_t cc, uint8_t value) {
+  uint8_t bit = 1 << (cc & 7);
+  if (m->ccPending[cc >> 3] & bit) m->ccMerged++;
+  m->ccPending[cc >> 3] |= bit;
+  m->ccValue[cc] = value;
+}
+
+static bool midiCCPending(MidiScheduler *m) {
+  for (uint8_t i = 0; i < 16; i++) if (m->ccPending[i]) return true;
+  return false;
+}
+
+// Send waiting control changes while the link isn't backed up, taking
+// controllers round from where the last call stopped so none is starved
+static void midiPoll(MidiScheduler *m, uint32_t now) {
+  uint8_t first = m->ccNext;
+  for (uint8_t i = 0; i < 128; i++) {
+    if ((int32_t)(m->busyUntil - now) >= MIDI_CC_BACKLOG_US) return;
+    uint8_t cc = (first + i) & 127;
+    uint8_t bit = 1 << (cc & 7);
+    if (!(m->ccPending[cc >> 3] & bit)) continue;
+    m->ccPending[cc >> 3] &= ~bit;
+    m->ccNext = (cc + 1) & 127;
+    midiWrite(m, MIDI_CONTROL_CHANGE, cc, m->ccValue[cc], now);
+    m->ccSent++;
+  }
+}
+
+// Percent of the time since midiStatsReset() the link was sending
+static uint8_t midiUtilization(MidiScheduler *m, uint32_t now) {
+  uint32_t elapsed = now - m->since;
+  if (!elapsed) return 0;
+  uint32_t busy = m->busyUs;
+  if ((int32_t)(m->busyUntil - now) > 0) {          // some not sent yet
+    uint32_t ahead = m->busyUntil - now;
+    busy = (busy > ahead) ? busy - ahead : 0;
+  }
+  return (uint64_t)busy * 100 / elapsed;
+}
+
+#endif // MIDI_SCHEDULER_H
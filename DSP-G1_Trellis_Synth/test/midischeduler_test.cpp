@@ -0,0 +1,249 @@
+// Host test for MidiScheduler.h. Runs on a PC, not the board.
+//
+// The sketch's MIDI traffic -- the setup() panic and CC defaults, then 20 s
+// of knob sweeps on six controllers and chords of 1-4 pads -- goes over a
+// simulated 31250 baud UART with a 64 byte transmit buffer that blocks
+// when full, once sent straight to the MIDI library as the sketch used to
+// and once through the scheduler. A receiver at the other end parses the
+// bytes, and must end up with every controller at its last value and the
+// right notes sounding. With the scheduler the link must be less busy and
+// notes must wait less for it, and the scheduler's own figures for both
+// must agree with when the bytes really went out. Runs with the sketch's
+// 30 ms loop, and with 5 and 1 ms loops to load the link.
+//
+//   g++ -O2 -o midischeduler_test midischeduler_test.cpp
+//   ./midischeduler_test
+//
+// Exits nonzero on failure.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <deque>
+#include <vector>
+#include <map>
+#include <utility>
+#include <algorithm>
+#include "../MidiScheduler.h"
+
+/************ THE UART ************/
+static uint64_t now;                       // micros()
+static std::deque<uint64_t> txDone;        // When each buffered byte is sent
+static uint64_t lineFree, busyUs, blockedUs;
+static std::vector<uint8_t> wire;
+static int  lastStatus;                    // The library's running status
+static bool runningStatus;
+
+static void drain() {
+  while (!txDone.empty() && (txDone.front() <= now)) txDone.pop_front();
+}
+
+static void uartWrite(uint8_t b) {
+  drain();
+  if (txDone.size() >= 64) {               // Serial.write() blocks
+    blockedUs += txDone.front() - now;
+    now = txDone.front();
+    drain();
+  }
+  lineFree = std::max(lineFree, now) + MIDI_US_PER_BYTE;
+  busyUs  += MIDI_US_PER_BYTE;
+  txDone.push_back(lineFree);
+  wire.push_back(b);
+}
+
+// The MIDI library's send()
+static void midiSend(uint8_t status, uint8_t data1, uint8_t data2) {
+  if (!runningStatus || (status != lastStatus)) uartWrite(status);
+  lastStatus = status;
+  uartWrite(data1);
+  uartWrite(data2);
+}
+
+/************ THE RECEIVER ************/
+struct Synth {
+  std::map<int, int>  cc;
+  std::map<int, bool> on;
+};
+
+static Synth receive() {
+  Synth s;
+  int   status = 0;
+  std::vector<int> data;
+  for (size_t i = 0; i < wire.size(); i++) {
+    if (wire[i] & 0x80) {
+      status = wire[i];
+      data.clear();
+      continue;
+    }
+    data.push_back(wire[i]);
+    if (data.size() < 2) continue;
+    if ((status & 0xF0) == MIDI_CONTROL_CHANGE) s.cc[data[0]] = data[1];
+    else if ((status & 0xF0) == MIDI_NOTE_ON) s.on[data[0]] = (data[1] != 0);
+    else if ((status & 0xF0) == 0x80) s.on[data[0]] = false;
+    data.clear();
+  }
+  return s;
+}
+
+/************ THE SKETCH ************/
+typedef struct {
+  double setupMs, busyPct, waitAvgMs, waitP99Ms, waitMaxMs;
+  long   bytes, notes;
+  bool   stateOK;
+  double statAvgMs, statMaxMs, statBusyPct; // The scheduler's own figures
+} Result;
+
+static MidiScheduler sched;
+static bool useSched;
+static std::vector<double> waits;          // ms from each note call to its last byte
+static std::map<int, int>  wantCC;
+static std::map<int, bool> wantOn;
+
+static void note(int n, bool on) {
+  uint64_t t0 = now;
+  if (!useSched) midiSend(on ? MIDI_NOTE_ON : 0x80, n, 127);
+  else if (on) midiNoteOn(&sched, n, 127, now);
+  else midiNoteOff(&sched, n, now);
+  waits.push_back((lineFree - t0) / 1000.0);  // Its last byte is the last one sent
+  wantOn[n] = on;
+}
+
+static void cc(int c, int v) {
+  if (useSched) midiCC(&sched, c, v);
+  else midiSend(MIDI_CONTROL_CHANGE, c, v);
+  wantCC[c] = v;
+}
+
+static Result run(bool scheduled, int loopMs) {
+  static const int defaults[][2] = {
+    { 7, 119 }, { 1, 24 }, { 16, 6 }, { 20, 0 }, { 74, 80 }, { 71, 70 },
+    { 82, 32 }, { 83, 38 }, { 28, 64 }, { 29, 32 }, { 81, 57 }, { 76, 100 },
+    { 4, 0 }, { 21, 0 }, { 93, 0 }, { 73, 0 }, { 75, 12 }, { 31, 60 }, { 72, 80 }
+  };
+  static const int knobCC[6] = { 71, 74, 21, 93, 4, 76 };
+  Result r = {};
+
+  now = lineFree = busyUs = blockedUs = 0;
+  txDone.clear();
+  wire.clear();
+  waits.clear();
+  wantCC.clear();
+  wantOn.clear();
+  lastStatus    = -1;
+  useSched      = scheduled;
+  runningStatus = scheduled;
+  srand(42);
+
+  // setup()
+  if (useSched) midiBegin(&sched, 1, midiSend, now);
+  for (int n = 0; n < 128; n++) note(n, false);
+  for (size_t i = 0; i < sizeof defaults / sizeof defaults[0]; i++) cc(defaults[i][0], defaults[i][1]);
+  if (useSched) {
+    while (midiCCPending(&sched)) {
+      midiPoll(&sched, now);
+      now += 10;
+    }
+    midiStatsReset(&sched, now);
+  }
+  r.setupMs = std::max(now, lineFree) / 1000.0;
+  waits.clear();
+  busyUs = 0;
+
+  // loop(): each knob turned now and then, sweeping for a while; pads
+  // held for 50-450 ms
+  double   knob[6] = { 0 }, speed[6] = { 0 };
+  int      sent[6] = { -100, -100, -100, -100, -100, -100 };
+  std::vector<std::pair<uint64_t, int> > held;
+  uint64_t start = now, end = now + 20000000;
+  while (now < end) {
+    for (int k = 0; k < 6; k++) {
+      if ((speed[k] == 0) && (rand() % 100 < 3)) {
+        speed[k] = ((rand() % 2) ? 1 : -1) * (0.05 + rand() % 100 / 400.0);
+      } else if (rand() % 100 < 2) {
+        speed[k] = 0;
+      }
+      knob[k] = std::min(127.0, std::max(0.0, knob[k] + speed[k] * loopMs));
+      if (abs((int)knob[k] - sent[k]) > 3) cc(knobCC[k], sent[k] = (int)knob[k]);
+    }
+    if (useSched) midiPoll(&sched, now);
+    now += loopMs * 1000;                  // The loop's delay()
+    for (size_t i = 0; i < held.size(); ) {
+      if (held[i].first > now) {
+        i++;
+        continue;
+      }
+      note(held[i].second, false);
+      held.erase(held.begin() + i);
+    }
+    if (rand() % 100 < 15) {
+      for (int i = 1 + rand() % 4; i > 0; i--) {
+        int n = 12 + rand() % 36;
+        note(n, true);
+        held.push_back(std::make_pair(now + 50000 + rand() % 400000, n));
+      }
+    }
+    if (useSched) midiPoll(&sched, now);
+  }
+  if (useSched) {
+    r.statAvgMs = sched.noteWaitUsSum / 1000.0 / sched.notes;
+    r.statMaxMs = sched.noteWaitUsMax / 1000.0;
+    r.statBusyPct = midiUtilization(&sched, now);
+  }
+  r.busyPct = 100.0 * busyUs / (end - start);
+  for (size_t i = 0; i < held.size(); i++) note(held[i].second, false);
+  while (useSched && midiCCPending(&sched)) {
+    midiPoll(&sched, now);
+    now += 100;
+  }
+
+  Synth s = receive();
+  r.stateOK = true;
+  for (std::map<int, int>::iterator i = wantCC.begin(); i != wantCC.end(); ++i) {
+    r.stateOK &= s.cc.count(i->first) && (s.cc[i->first] == i->second);
+  }
+  for (std::map<int, bool>::iterator i = wantOn.begin(); i != wantOn.end(); ++i) {
+    r.stateOK &= (s.on[i->first] == i->second);
+  }
+  r.notes = waits.size() - held.size();
+  waits.resize(r.notes);                   // Leave out the last note offs
+  std::sort(waits.begin(), waits.end());
+  for (size_t i = 0; i < waits.size(); i++) r.waitAvgMs += waits[i] / waits.size();
+  r.waitP99Ms = waits[waits.size() * 99 / 100];
+  r.waitMaxMs = waits.back();
+  r.bytes     = wire.size();
+  return r;
+}
+
+static int failures = 0;
+
+static void check(bool ok, const char *what) {
+  if (!ok) { printf("FAIL: %s\n", what); failures++; }
+}
+
+static void print(const char *how, const Result &r) {
+  printf("  %-9s setup %5.1f ms, link %4.1f%% busy, %5ld bytes, %4ld notes waited "
+         "avg %.2f ms, p99 %5.2f, max %5.2f; blocked %3.0f ms; receiver %s\n",
+         how, r.setupMs, r.busyPct, r.bytes, r.notes, r.waitAvgMs, r.waitP99Ms,
+         r.waitMaxMs, blockedUs / 1000.0, r.stateOK ? "matches" : "WRONG");
+}
+
+int main(void) {
+  static const int loops[] = { 30, 5, 1 };
+  for (size_t i = 0; i < sizeof loops / sizeof loops[0]; i++) {
+    printf("%d ms loop:\n", loops[i]);
+    Result d = run(false, loops[i]);
+    print("direct:", d);
+    Result s = run(true, loops[i]);
+    print("scheduler:", s);
+    printf("  scheduler's own figures: link %.0f%% busy, notes waited avg %.2f ms, "
+           "max %.2f ms\n", s.statBusyPct, s.statAvgMs, s.statMaxMs);
+    check(d.stateOK && s.stateOK, "receiver ends up with every CC and note");
+    check(s.setupMs < d.setupMs, "setup on the wire sooner");
+    check(s.busyPct < d.busyPct, "link less busy");
+    check(s.waitP99Ms < d.waitP99Ms && s.waitMaxMs <= d.waitMaxMs, "notes wait less");
+    check(fabs(s.statAvgMs - s.waitAvgMs) < 0.01 && fabs(s.statMaxMs - s.waitMaxMs) < 0.01,
+          "scheduler's note wait figures right");
+    check(fabs(s.statBusyPct - s.busyPct) <= 1, "scheduler's link use right");
+  }
+  return failures ? 1 : 0;
+}
@@ -0,0 +1,249 @@
+#include <stdlib.h>
+#include <string.h>
+#include "JsonStream.h"
+
+JsonStream::JsonStream(Callback callback, void *context)
+{
+  this->callback = callback;
+  this->context = context;
+  reset();
+}
+
+void JsonStream::reset()
+{
+  arrays = 0;
+  depth = 0;
+  length = 0;
+  state = VALUE;
+}
+
+void JsonStream::put(char c)
+{
+  if (length < JSON_VALUE_LEN - 1) {
+    value[length++] = c;
+  }
+}
+
+// Append a \uXXXX escape as UTF-8
+void JsonStream::putUnicode(uint16_t u)
+{
+  if (u < 0x80) {
+    put(u);
+  } else if (u < 0x800) {
+    put(0xC0 | (u >> 6));
+    put(0x80 | (u & 0x3F));
+  } else {
+    put(0xE0 | (u >> 12));
+    put(0x80 | ((u >> 6) & 0x3F));
+    put(0x80 | (u & 0x3F));
+  }
+}
+
+void JsonStream::push(bool array)
+{
+  if (depth >= 32) {
+    state = FAILED;
+    return;
+  }
+  if (array) {
+    arrays |= 1UL << depth;
+  } else {
+    arrays &= ~(1UL << depth);
+  }
+  if (depth < JSON_MAX_DEPTH) {
+    path[depth].key[0] = 0;
+    path[depth].index = 0;
+  }
+  depth++;
+  state = array ? VALUE : KEY;
+}
+
+bool JsonStream::pop(bool array)
+{
+  if (!depth || isArray() != array) {
+    state = FAILED;
+    return false;
+  }
+  depth--;
+  state = depth ? NEXT : DONE;
+  return depth != 0;
+}
+
+void JsonStream::emit()
+{
+  value[length] = 0;
+  if (depth <= JSON_MAX_DEPTH) {
+    callback(*this, value, context);
+  }
+  state = depth ? NEXT : DONE;
+}
+
+bool JsonStream::feed(char c)
+{
+  switch (state) {
+    case STRING:
+      if (c == '"') {
+        if (inKey) {
+          if (depth <= JSON_MAX_DEPTH) {
+            uint8_t n = length < JSON_KEY_LEN - 1 ? length : JSON_KEY_LEN - 1;
+            memcpy(path[depth - 1].key, value, n);
+            path[depth - 1].key[n] = 0;
+          }
+          state = COLON;
+        } else {
+          emit();
+        }
+      } else if (c == '\\') {
+        state = ESCAPE;
+      } else {
+        put(c);
+      }
+      return state != DONE;
+
+    case ESCAPE:
+      state = STRING;
+      switch (c) {
+        case 'b': put('\b'); break;
+        case 'f': put('\f'); break;
+        case 'n': put('\n'); break;
+        case 'r': put('\r'); break;
+        case 't': put('\t'); break;
+        case 'u': unicode = 0; hexDigits = 0; state = UNICODE; break;
+        default:  put(c); break; // \" \\ \/
+      }
+      return true;
+
+    case UNICODE:
+      if (c >= '0' && c <= '9') unicode = (unicode << 4) | (c - '0');
+      else if (c >= 'a' && c <= 'f') unicode = (unicode << 4) | (c - 'a' + 10);
+      else if (c >= 'A' && c <= 'F') unicode = (unicode << 4) | (c - 'A' + 10);
+      else {
+        state = FAILED;
+        return false;
+      }
+      if (++hexDigits == 4) {
+        putUnicode(unicode);
+        state = STRING;
+      }
+      return true;
+
+    case LITERAL:
+      if (c != ',' && c != '}' && c != ']' && c != ' ' && c != '\t' && c != '\r' && c != '\n') {
+        put(c);
+        return true;
+      }
+      emit();
+      break; // Delimiter is handled below
+
+    case DONE:
+    case FAILED:
+      return false;
+  }
+
+  if (c == ' ' || c == '\t' || c == '\r' || c == '\n') {
+    return state != DONE;
+  }
+
+  switch (state) {
+    case VALUE:
+      length = 0;
+      if (c == '{') {
+        push(false);
+      } else if (c == '[') {
+        push(true);
+      } else if (c == ']') { // Empty array
+        pop(true);
+      } else if (c == '"') {
+        inKey = false;
+        state = STRING;
+      } else if (c == '}' || c == ',' || c == ':') {
+        state = FAILED;
+      } else {
+        put(c);
+        state = LITERAL;
+      }
+      break;
+
+    case KEY:
+      if (c == '"') {
+        length = 0;
+        inKey = true;
+        state = STRING;
+      } else if (c == '}') { // Empty object
+        pop(false);
+      } else {
+        state = FAILED;
+      }
+      break;
+
+    case COLON:
+      state = (c == ':') ? VALUE : FAILED;
+      break;
+
+    case NEXT:
+      if (c == ',') {
+        if (isArray()) {
+          if (depth <= JSON_MAX_DEPTH) path[depth - 1].index++;
+          state = VALUE;
+        } else {
+          state = KEY;
+        }
+      } else if (c == '}' || c == ']') {
+        pop(c == ']');
+      } else {
+        state = FAILED;
+      }
+      break;
+
+    default:
+      state = FAILED;
+      break;
+  }
+  return state != DONE && state != FAILED;
+}
+
+// True if the n characters at p are all digits and spell out index.
+// "main" or "" in an array's place isn't element 0.
+static bool isIndex(const char *p, size_t n, int16_t index)
+{
+  if (n == 0 || n > 5) {
+    return false;
+  }
+  long value = 0;
+  for (size_t i = 0; i < n; i++) {
+    if (p[i] < '0' || p[i] > '9') {
+      return false;
+    }
+    value = value * 10 + (p[i] - '0');
+  }
+  return value == index;
+}
+
+bool JsonStream::is(const char *p)
+{
+  for (uint8_t level = 0; level < depth; level++) {
+    if (level >= JSON_MAX_DEPTH || !*p) {
+      return false;
+    }
+    const char *end = strchr(p, '.');
+    size_t n = end ? (size_t)(end - p) : strlen(p);
+    if (arrays & (1UL << level)) {
+      if (!(n == 1 && *p == '*') && !isIndex(p, n, path[level].index)) {
+        return false;
+      }
+    } else if (strlen(path[level].key) != n || strncmp(path[level].key, p, n)) {
+      return false;
+    }
+    p += n;
+    if (*p == '.') p++;
+  }
+  return *p == 0;
+}
+
+int JsonStream::index(uint8_t level)
+{
+  if (level >= depth || level >= JSON_MAX_DEPTH || !(arrays & (1UL << level))) {
+    return -1;
+  }
+  return path[level].index;
+}
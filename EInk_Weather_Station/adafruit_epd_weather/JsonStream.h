@@ -0,0 +1,66 @@
+#pragma once
+#include <stdint.h>
+
+// Streaming JSON reader. Characters are fed in one at a time as they come
+// off the network; the only thing held in memory is the key path down to
+// the current value and the value itself, so RAM use doesn't depend on the
+// size of the document. Each scalar (string, number, true, false, null) is
+// handed to a callback, which uses is() to pick out the fields it wants:
+//
+//   void onValue(JsonStream &json, const char *value, void *context) {
+//     if (json.is("main.temp")) temp = atof(value);
+//     if (json.is("list.*.dt")) times[json.index(1)] = atol(value);
+//   }
+//
+// Keys and values longer than JSON_KEY_LEN / JSON_VALUE_LEN are truncated,
+// and values nested deeper than JSON_MAX_DEPTH are skipped.
+
+#define JSON_MAX_DEPTH  6   // Levels of key path tracked
+#define JSON_KEY_LEN    16  // Including terminator
+#define JSON_VALUE_LEN  48  // Including terminator
+
+class JsonStream {
+  public:
+    typedef void (*Callback)(JsonStream &json, const char *value, void *context);
+
+    JsonStream(Callback callback, void *context);
+
+    void reset();
+    // Returns false once the document is complete or found to be invalid
+    bool feed(char c);
+    bool done() { return state == DONE; }
+    bool failed() { return state == FAILED; }
+
+    // True if the current value is at the given dot-separated path, e.g.
+    // "weather.0.main". "*" matches any array index.
+    bool is(const char *path);
+    // Array index at the given level of the current path, e.g. index(1)
+    // at "list.3.dt" is 3
+    int index(uint8_t level);
+
+  private:
+    enum { VALUE, KEY, COLON, STRING, ESCAPE, UNICODE, LITERAL, NEXT, DONE, FAILED };
+
+    struct {
+      char    key[JSON_KEY_LEN];
+      int16_t index;
+    } path[JSON_MAX_DEPTH];
+    uint32_t arrays;     // Bit per nesting level, set for arrays
+    uint8_t  depth;      // Containers currently open
+    uint8_t  state;
+    bool     inKey;      // STRING state is reading a key, not a value
+    char     value[JSON_VALUE_LEN];
+    uint8_t  length;
+    uint16_t unicode;    // \uXXXX escape being read
+    uint8_t  hexDigits;
+
+    Callback callback;
+    void    *context;
+
+    bool isArray() { return depth && (arrays & (1UL << (depth - 1))); }
+    void put(char c);
+    void putUnicode(uint16_t u);
+    void push(bool array);
+    bool pop(bool array);
+    void emit();
+};
@@ -97,87 +97,191 @@ String AirliftOpenWeatherMap::getMeteoconIcon(String icon) {
 
 }
 
-bool AirliftOpenWeatherMap::updateCurrent(OpenWeatherMapCurrentData &data, String json)
+// Give up if the server goes quiet for this long mid-response
+#define OWM_TIMEOUT 10000
+
+// Fields shared by every response
+struct ResponseContext {
+  int code;          // "cod", a number or a string depending on the call
+  char message[48];  // "message", set on errors
+};
+
+struct CurrentContext : ResponseContext {
+  OpenWeatherMapCurrentData *data;
+};
+
+struct ForecastContext : ResponseContext {
+  OpenWeatherMapForecastData *data;
+  int count;
+  int step;
+};
+
+static void copyString(char *dest, size_t size, const char *src)
+{
+  strncpy(dest, src, size - 1);
+  dest[size - 1] = 0;
+}
+#define COPY(field) copyString(field, sizeof(field), value)
+
+static bool responseValue(JsonStream &json, const char *value, ResponseContext *ctx)
+{
+  if (json.is("cod")) {
+    ctx->code = atoi(value);
+  } else if (json.is("message")) {
+    COPY(ctx->message);
+  } else {
+    return false;
+  }
+  return true;
+}
+
+static void currentValue(JsonStream &json, const char *value, void *context)
+{
+  CurrentContext *ctx = (CurrentContext *)context;
+  OpenWeatherMapCurrentData &data = *ctx->data;
+
+  if (responseValue(json, value, ctx)) return;
+
+  if (json.is("coord.lon")) data.lon = atof(value);
+  else if (json.is("coord.lat")) data.lat = atof(value);
+  else if (json.is("weather.0.id")) data.weatherId = atoi(value);
+  else if (json.is("weather.0.main")) COPY(data.main);
+  else if (json.is("weather.0.description")) COPY(data.description);
+  else if (json.is("weather.0.icon")) COPY(data.icon);
+  else if (json.is("main.temp")) data.temp = atof(value);
+  else if (json.is("main.pressure")) data.pressure = atoi(value);
+  else if (json.is("main.humidity")) data.humidity = atoi(value);
+  else if (json.is("main.temp_min")) data.tempMin = atof(value);
+  else if (json.is("main.temp_max")) data.tempMax = atof(value);
+  else if (json.is("visibility")) data.visibility = atol(value);
+  else if (json.is("wind.speed")) data.windSpeed = atof(value);
+  else if (json.is("wind.deg")) data.windDeg = atof(value);
+  else if (json.is("clouds.all")) data.clouds = atoi(value);
+  else if (json.is("dt")) data.observationTime = atol(value);
+  else if (json.is("sys.country")) COPY(data.country);
+  else if (json.is("sys.sunrise")) data.sunrise = atol(value);
+  else if (json.is("sys.sunset")) data.sunset = atol(value);
+  else if (json.is("name")) COPY(data.cityName);
+  else if (json.is("timezone")) data.timezone = atol(value);
+}
+
+static void forecastValue(JsonStream &json, const char *value, void *context)
+{
+  ForecastContext *ctx = (ForecastContext *)context;
+
+  if (responseValue(json, value, ctx)) return;
+
+  // Only "list" entries 0, step, 2*step... up to count are kept
+  int item = json.index(1);
+  if (item < 0 || item % ctx->step || item / ctx->step >= ctx->count) return;
+  OpenWeatherMapForecastData &data = ctx->data[item / ctx->step];
+
+  if (json.is("list.*.dt")) data.observationTime = atol(value);
+  else if (json.is("list.*.main.temp")) data.temp = atof(value);
+  else if (json.is("list.*.main.temp_min")) data.tempMin = atof(value);
+  else if (json.is("list.*.main.temp_max")) data.tempMax = atof(value);
+  else if (json.is("list.*.main.pressure")) data.pressure = atof(value);
+  else if (json.is("list.*.main.sea_level")) data.pressureSeaLevel = atof(value);
+  else if (json.is("list.*.main.grnd_level")) data.pressureGroundLevel = atof(value);
+  else if (json.is("list.*.main.humidity")) data.humidity = atoi(value);
+  else if (json.is("list.*.weather.0.id")) data.weatherId = atoi(value);
+  else if (json.is("list.*.weather.0.main")) COPY(data.main);
+  else if (json.is("list.*.weather.0.description")) COPY(data.description);
+  else if (json.is("list.*.weather.0.icon")) COPY(data.icon);
+  else if (json.is("list.*.clouds.all")) data.clouds = atoi(value);
+  else if (json.is("list.*.wind.speed")) data.windSpeed = atof(value);
+  else if (json.is("list.*.wind.deg")) data.windDeg = atof(value);
+  else if (json.is("list.*.rain.3h")) data.rain = atof(value);
+  else if (json.is("list.*.dt_txt")) COPY(data.observationTimeText);
+}
+
+// Feed the response body to the parser a chunk at a time as it arrives
+bool AirliftOpenWeatherMap::readJson(Client &client, JsonStream &json)
+{
+  uint8_t chunk[64];
+  uint32_t bytes = 0;
+  uint32_t start = millis();
+  uint32_t lastData = start;
+
+  while (!json.done() && !json.failed()) {
+    int n = client.read(chunk, sizeof(chunk));
+    if (n > 0) {
+      for (int i = 0; i < n && json.feed(chunk[i]); i++);
+      bytes += n;
+      lastData = millis();
+    } else if (!client.connected() || (millis() - lastData > OWM_TIMEOUT)) {
+      break;
+    }
+  }
+  Serial->println(String("parsed ") + bytes + " bytes in " + (millis() - start) + " ms");
+
+  if (!json.done()) {
+    Serial->println(json.failed() ? "JSON parse error" : "JSON response incomplete");
+    setError(json.failed() ? "JSON parse error" : "JSON response incomplete");
+    return false;
+  }
+  return true;
+}
+
+bool AirliftOpenWeatherMap::updateCurrent(OpenWeatherMapCurrentData &data, Client &client)
 {
   Serial->println("updateCurrent()");
-  DynamicJsonDocument doc(2000);
-  //StaticJsonDocument<2000> doc;
-
-  DeserializationError error = deserializeJson(doc, json);
-  if (error) {
-    Serial->println(String("deserializeJson() failed: ") + (const char *)error.c_str());
-    Serial->println(json);
-    setError(String("deserializeJson() failed: ") + error.c_str());
+
+  // Parse into a copy so a bad response leaves 'data' untouched
+  OpenWeatherMapCurrentData current;
+  memset(&current, 0, sizeof(current));
+  CurrentContext ctx;
+  ctx.code = 0;
+  ctx.message[0] = 0;
+  ctx.data = &current;
+
+  JsonStream json(currentValue, &ctx);
+  if (!readJson(client, json)) {
     return false;
   }
 
-  int code = (int) doc["cod"];
-  if(code != 200)
+  if(ctx.code != 200)
   {
-    Serial->println(String("OpenWeatherMap error: ") + (const char *)doc["message"]);
-    setError(String("OpenWeatherMap error: ") + (const char *)doc["message"]);
+    Serial->println(String("OpenWeatherMap error: ") + ctx.message);
+    setError(String("OpenWeatherMap error: ") + ctx.message);
     return false;
   }
-  
-  data.lat = (float) doc["coord"]["lat"];
-  data.lon = (float) doc["coord"]["lon"];
-  
-  data.main = (const char*) doc["weather"][0]["main"];  
-  data.description = (const char*) doc["weather"][0]["description"];
-  data.icon = (const char*) doc["weather"][0]["icon"];
-  
-  data.cityName = (const char*) doc["name"];
-  data.visibility = (uint16_t) doc["visibility"];
-  data.timezone = (time_t) doc["timezone"];
-  
-  data.country = (const char*) doc["sys"]["country"];
-  data.observationTime = (time_t) doc["dt"];
-  data.sunrise = (time_t) doc["sys"]["sunrise"];
-  data.sunset = (time_t) doc["sys"]["sunset"];
-  
-  data.temp = (float) doc["main"]["temp"];
-  data.pressure = (uint16_t) doc["main"]["pressure"];
-  data.humidity = (uint8_t) doc["main"]["humidity"];
-  data.tempMin = (float) doc["main"]["temp_min"];
-  data.tempMax = (float) doc["main"]["temp_max"];
-
-  data.windSpeed = (float) doc["wind"]["speed"];
-  data.windDeg = (float) doc["wind"]["deg"];
+
+  data = current;
   return true;
 }
 
-bool AirliftOpenWeatherMap::updateForecast(OpenWeatherMapForecastData &data, String json, int day)
+bool AirliftOpenWeatherMap::updateForecast(OpenWeatherMapForecastData data[], int count, int step, Client &client)
 {
   Serial->println("updateForecast()");
-  DynamicJsonDocument doc(5000);
-  //StaticJsonDocument<5000> doc;
-
-  DeserializationError error = deserializeJson(doc, json);
-  if (error) {
-    Serial->println(String("deserializeJson() failed: ") + (const char *)error.c_str());
-    Serial->println(json);
-    setError(String("deserializeJson() failed: ") + error.c_str());
+
+  if (count > OWM_MAX_FORECASTS) {
+    setError("Too many forecasts asked for");
     return false;
   }
 
-  int code = (int) doc["cod"];
-  if(code != 200)
-  {
-    Serial->println(String("OpenWeatherMap error: ") + (const char *)doc["message"]);
-    setError(String("OpenWeatherMap error: ") + (const char *)doc["message"]);
+  // Parse into a copy so a bad response leaves 'data' untouched
+  OpenWeatherMapForecastData forecast[OWM_MAX_FORECASTS];
+  memset(forecast, 0, count * sizeof(OpenWeatherMapForecastData));
+  ForecastContext ctx;
+  ctx.code = 0;
+  ctx.message[0] = 0;
+  ctx.data = forecast;
+  ctx.count = count;
+  ctx.step = step;
+
+  JsonStream json(forecastValue, &ctx);
+  if (!readJson(client, json)) {
     return false;
   }
 
-  data.observationTime = (time_t) doc["list"][day]["dt"];
-
-  data.temp = (float) doc["list"][day]["main"]["temp"];
-  data.pressure = (uint16_t) doc["list"][day]["main"]["pressure"];
-  data.humidity = (uint8_t) doc["list"][day]["main"]["humidity"];
-  data.tempMin = (float) doc["list"][day]["main"]["temp_min"];
-  data.tempMax = (float) doc["list"][day]["main"]["temp_max"];
+  if(ctx.code != 200)
+  {
+    Serial->println(String("OpenWeatherMap error: ") + ctx.message);
+    setError(String("OpenWeatherMap error: ") + ctx.message);
+    return false;
+  }
 
-  data.main = (const char*) doc["list"][day]["weather"][0]["main"];  
-  data.description = (const char*) doc["list"][day]["weather"][0]["description"];
-  data.icon = (const char*) doc["list"][day]["weather"][0]["icon"];
+  memcpy(data, forecast, count * sizeof(OpenWeatherMapForecastData));
   return true;
 }
@@ -1,6 +1,8 @@
 #pragma once
+#include <Arduino.h>
+#include <Client.h>
 #include "secrets.h"
-#include <ArduinoJson.h>          //https://github.com/bblanchon/ArduinoJson
+#include "JsonStream.h"
 
 typedef struct OpenWeatherMapCurrentData {
   // "lon": 8.54,
@@ -10,12 +12,11 @@ typedef struct OpenWeatherMapCurrentData {
   // "id": 521,
   uint16_t weatherId;
   // "main": "Rain",
-  String main;
+  char main[16];
   // "description": "shower rain",
-  String description;
+  char description[32];
   // "icon": "09d"
-  String icon;
-  String iconMeteoCon;
+  char icon[4];
   // "temp": 290.56,
   float temp;
   // "pressure": 1013,
@@ -37,13 +38,13 @@ typedef struct OpenWeatherMapCurrentData {
   // "dt": 1527015000,
   time_t observationTime;
   // "country": "CH",
-  String country;
+  char country[4];
   // "sunrise": 1526960448,
   time_t sunrise;
   // "sunset": 1527015901
   time_t sunset;
   // "name": "Zurich",
-  String cityName;
+  char cityName[32];
   time_t timezone;
 } OpenWeatherMapCurrentData;
 
@@ -70,12 +71,11 @@ typedef struct OpenWeatherMapForecastData {
   //   "id":802,
   uint16_t weatherId;
   //   "main":"Clouds",
-  String main;
+  char main[16];
   //   "description":"scattered clouds",
-  String description;
+  char description[32];
   //   "icon":"03d"
-  String icon;
-  String iconMeteoCon;
+  char icon[4];
   // }],"clouds":{"all":44},
   uint8_t clouds;
   // "wind":{
@@ -87,27 +87,32 @@ typedef struct OpenWeatherMapForecastData {
   float rain;
   // },"sys":{"pod":"d"}
   // dt_txt: "2018-05-23 09:00:00"
-  String observationTimeText;
+  char observationTimeText[20];
 
 } OpenWeatherMapForecastData;
 
+// Most forecast entries updateForecast() fills at once; it parses into a
+// copy of this many on the stack
+#define OWM_MAX_FORECASTS 5
+
 class AirliftOpenWeatherMap{
   private:
     Stream *Serial;
-    String currentKey;
-    String currentParent;
-    //OpenWeatherMapCurrentData *data;
-    uint8_t weatherItemCounter = 0;
     bool metric = true;
     String language;
     String _error;
 
+    bool readJson(Client &client, JsonStream &json);
+
   public:
     AirliftOpenWeatherMap(Stream *serial){Serial = serial;};
     String buildUrlCurrent(String appId, String locationParameter);
     String buildUrlForecast(String appId, String locationParameter);
-    bool updateCurrent(OpenWeatherMapCurrentData &data,String json);
-    bool updateForecast(OpenWeatherMapForecastData &data,String json, int day = 0);
+    // Parse a response straight off the connection, body next to be read
+    bool updateCurrent(OpenWeatherMapCurrentData &data, Client &client);
+    // Fill data[0..count-1] from forecast list entries 0, step, 2*step...
+    // count is at most OWM_MAX_FORECASTS
+    bool updateForecast(OpenWeatherMapForecastData data[], int count, int step, Client &client);
 
     void setMetric(bool metric) {this->metric = metric;}
     bool isMetric() { return metric; }
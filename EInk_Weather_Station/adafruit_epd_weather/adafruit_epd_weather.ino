@@ -2,12 +2,12 @@
 #include <Adafruit_GFX.h>    // Core graphics library
 #include <Adafruit_EPD.h>
 #include <Adafruit_NeoPixel.h>
-#include <ArduinoJson.h>        //https://github.com/bblanchon/ArduinoJson
 #include <SPI.h>
 #include <WiFiNINA.h>
 
 #include "secrets.h"
 #include "OpenWeatherMap.h"
+#include "DiffEPD.h"
 
 #include "Fonts/meteocons48pt7b.h"
 #include "Fonts/meteocons24pt7b.h"
@@ -31,8 +31,10 @@
 
 #define NEOPIXELPIN   40
 
-// This is for the 2.7" tricolor EPD
-Adafruit_IL91874 gfx(264, 176 ,EPD_DC, EPD_RESET, EPD_CS, SRAM_CS, EPD_BUSY);
+// This is for the 2.7" tricolor EPD. Tri-color panels can't do partial
+// refreshes, but DiffEPD skips the ~15 second refresh when a redraw comes
+// out the same as what's already on screen
+DiffEPD<Adafruit_IL91874> gfx(264, 176 ,EPD_DC, EPD_RESET, EPD_CS, SRAM_CS, EPD_BUSY);
 
 AirliftOpenWeatherMap owclient(&Serial);
 OpenWeatherMapCurrentData owcdata;
@@ -139,82 +141,41 @@ bool wifi_connect(){
   return true;
 }
 
-void wget(String &url, int port, char *buff)
+// Send a GET request and skip the response headers, leaving the body on
+// 'client' to be parsed as it arrives
+bool wget(String &url, int port, WiFiClient &client)
 {
   int pos1 = url.indexOf("/",0);
   int pos2 = url.indexOf("/",8);
   String host = url.substring(pos1+2,pos2);
   String path = url.substring(pos2);
   Serial.println("to wget(" + host + "," + path + "," + port + ")");
-  wget(host, path, port, buff);
+  return wget(host, path, port, client);
 }
 
-void wget(String &host, String &path, int port, char *buff)
+bool wget(String &host, String &path, int port, WiFiClient &client)
 {
-  //WiFiSSLClient client;
-  WiFiClient client;
-
-  neopixel.setPixelColor(0, neopixel.Color(0, 0, 255));
-  neopixel.show();
   client.stop();
-  if (client.connect(host.c_str(), port)) {
-    Serial.println("connected to server");
-    // Make a HTTP request:
-    client.println(String("GET ") + path + String(" HTTP/1.0"));
-    client.println("Host: " + host);
-    client.println("Connection: close");
-    client.println();
-
-    uint32_t bytes = 0;
-    int capturepos = 0;
-    bool capture = false;
-    int linelength = 0;
-    char lastc = '\0';
-    while(true) 
-    {
-      while (client.available()) {
-        char c = client.read();
-        //Serial.print(c);
-        if((c == '\n') && (lastc == '\r'))
-        {
-          if(linelength == 0)
-          {
-            capture = true;
-          }
-          linelength = 0;
-        }
-        else if(capture)
-        {
-          buff[capturepos++] = c;
-          //Serial.write(c);
-        }
-        else
-        {
-          if((c != '\n') && (c != '\r'))
-            linelength++;
-        }
-        lastc = c;
-        bytes++;
-      }
-    
-      // if the server's disconnected, stop the client:
-      if (!client.connected()) {
-        //Serial.println();
-        Serial.println("disconnecting from server.");
-        client.stop();
-        buff[capturepos] = '\0';
-        Serial.println("captured " + String(capturepos) + " bytes");
-        break;
-      }
-    }
-  }
-  else
-  {
+  if (!client.connect(host.c_str(), port)) {
     Serial.println("problem connecting to " + host + ":" + String(port));
-    buff[0] = '\0';
+    owclient.setError("Can not get weather data, press reset to restart");
+    return false;
   }
-  neopixel.setPixelColor(0, neopixel.Color(0, 0, 0));
-  neopixel.show(); 
+  Serial.println("connected to server");
+  // Make a HTTP request:
+  client.println(String("GET ") + path + String(" HTTP/1.0"));
+  client.println("Host: " + host);
+  client.println("Connection: close");
+  client.println();
+
+  char endOfHeaders[] = "\r\n\r\n";
+  if (!client.find(endOfHeaders)) {
+    Serial.println("no response from " + host);
+    owclient.setError("Can not get weather data, press reset to restart");
+    client.stop();
+    return false;
+  }
+  return true;
 }
 
 int getStringLength(String s)
@@ -555,7 +516,6 @@ void setup() {
 }
 
 void loop() {
-  char data[4000];
   static uint32_t timer = millis();
   static uint8_t lastbutton = 1;
   static bool firsttime = true;
@@ -579,25 +539,16 @@ void loop() {
         while(1);      
       }
     }
+    WiFiClient client;
+    neopixel.setPixelColor(0, neopixel.Color(0, 0, 255));
+    neopixel.show();
+
     String urlc = owclient.buildUrlCurrent(OWM_KEY,OWM_LOCATION);
     Serial.println(urlc);
     retry = 6;
-    do
-    {
-      retry--;
-      wget(urlc,80,data);
-      if(strlen(data) == 0 && retry < 0)
-      {
-        displayError("Can not get weather data, press reset to restart");
-        while(1);      
-      }
-    }
-    while(strlen(data) == 0);
-    Serial.println("data retrieved:");
-    Serial.println(data);
-    retry = 6;
-    while(!owclient.updateCurrent(owcdata,data))
+    while(!wget(urlc,80,client) || !owclient.updateCurrent(owcdata,client))
     {
+      client.stop();
       retry--;
       if(retry < 0)
       {
@@ -606,27 +557,19 @@ void loop() {
       }
       delay(5000);
     }
+    client.stop();
   
     String urlf = owclient.buildUrlForecast(OWM_KEY,OWM_LOCATION);
     Serial.println(urlf);
-    wget(urlf,80,data);
-    Serial.println("data retrieved:");
-    Serial.println(data);
-    if(!owclient.updateForecast(owfdata[0],data,0))
-    {
-      displayError(owclient.getError());
-      while(1);
-    }
-    if(!owclient.updateForecast(owfdata[1],data,2))
-    {
-      displayError(owclient.getError());
-      while(1);
-    }
-    if(!owclient.updateForecast(owfdata[2],data,4))
+    // forecast entries are 3 hours apart, keep every other one
+    if(!wget(urlf,80,client) || !owclient.updateForecast(owfdata,3,2,client))
     {
       displayError(owclient.getError());
       while(1);
     }
+    client.stop();
+    neopixel.setPixelColor(0, neopixel.Color(0, 0, 0));
+    neopixel.show();
 
     switch(lastbutton)
     {
@@ -640,6 +583,7 @@ void loop() {
         displaySunMoon(owcdata);
         break;
     }
+    gfx.printStats(Serial);
   }
 
   if (button == 0) {
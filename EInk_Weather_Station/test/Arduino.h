@@ -0,0 +1,41 @@
+// Just enough of Arduino for OpenWeatherMap.cpp on a PC: String over
+// std::string, a Stream that prints nothing, and a real millis()
+#pragma once
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <string>
+#include <chrono>
+
+class String {
+ public:
+  String() { }
+  String(const char *c) : s(c ? c : "") { }
+  String(const std::string &x) : s(x) { }
+  String(int v) : s(std::to_string(v)) { }
+  String(unsigned v) : s(std::to_string(v)) { }
+  String(long v) : s(std::to_string(v)) { }
+  String(unsigned long v) : s(std::to_string(v)) { }
+  const char *c_str() const { return s.c_str(); }
+  bool operator==(const char *c) const { return s == c; }
+  friend String operator+(const String &a, const String &b) { return String(a.s + b.s); }
+  friend String operator+(const String &a, const char *b) { return String(a.s + b); }
+  friend String operator+(const char *a, const String &b) { return String(a + b.s); }
+  friend String operator+(const String &a, int b) { return a + String(b); }
+  friend String operator+(const String &a, unsigned b) { return a + String(b); }
+  friend String operator+(const String &a, unsigned long b) { return a + String(b); }
+ private:
+  std::string s;
+};
+
+class Stream {
+ public:
+  void println(const String &) { }
+};
+
+static inline uint32_t millis() {
+  return std::chrono::duration_cast<std::chrono::milliseconds>(
+    std::chrono::steady_clock::now().time_since_epoch()).count();
+}
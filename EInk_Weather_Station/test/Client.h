@@ -0,0 +1,9 @@
+#pragma once
+#include "Arduino.h"
+
+class Client {
+ public:
+  virtual ~Client() { }
+  virtual int     read(uint8_t *buf, size_t size) = 0;
+  virtual uint8_t connected() = 0;
+};
@@ -0,0 +1,66 @@
+"""
+Serves the saved OpenWeatherMap responses in responses/ for owm_test.cpp,
+the way a slow or flaky connection would deliver them.
+
+    GET /forecast40.json?chunk=100&gap=5&drop=4000
+
+sends the file 'chunk' bytes at a time with 'gap' milliseconds between
+chunks, and hangs up after 'drop' bytes of body if that's given.
+
+Usage:
+    python3 owm_server.py [port]
+
+Port 0 (the default) picks a free one. The port is printed on the first
+line of output once the server is listening.
+"""
+
+import os
+import sys
+import time
+from http.server import BaseHTTPRequestHandler, ThreadingHTTPServer
+from urllib.parse import urlsplit, parse_qs
+
+RESPONSES = os.path.join(os.path.dirname(os.path.abspath(__file__)), 'responses')
+
+
+class Handler(BaseHTTPRequestHandler):
+    def log_message(self, *args):
+        pass
+
+    def do_GET(self):
+        url = urlsplit(self.path)
+        args = {k: int(v[0]) for k, v in parse_qs(url.query).items()}
+        try:
+            with open(os.path.join(RESPONSES, os.path.basename(url.path)), 'rb') as infile:
+                body = infile.read()
+        except OSError:
+            self.send_error(404)
+            return
+        self.send_response(200)
+        self.send_header('Content-Type', 'application/json; charset=utf-8')
+        self.send_header('Content-Length', str(len(body)))
+        self.end_headers()
+        self.wfile.flush()
+        body = body[:args.get('drop', len(body))]
+        chunk = args.get('chunk', len(body)) or 1
+        for start in range(0, len(body), chunk):
+            self.wfile.write(body[start:start + chunk])
+            self.wfile.flush()
+            time.sleep(args.get('gap', 0) / 1000)
+
+
+class Server(ThreadingHTTPServer):
+    def handle_error(self, request, client_address):
+        pass    # The client may hang up early on purpose
+
+
+def main():
+    """Command-line entry point."""
+    port = int(sys.argv[1]) if len(sys.argv) > 1 else 0
+    server = Server(('127.0.0.1', port), Handler)
+    print(server.server_address[1], flush=True)
+    server.serve_forever()
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,207 @@
+// Host test for adafruit_epd_weather/OpenWeatherMap.cpp and JsonStream.cpp.
+// Runs on a PC, not the board; Arduino.h and Client.h next to this file
+// stand in for the Arduino core.
+//
+// owm_server.py serves the saved responses in responses/ over a real
+// socket: current weather, a 6-entry and a 40-entry (about 16 KB)
+// forecast, and the error OpenWeatherMap sends for an unknown city. Each
+// is parsed straight off the socket, whole, a byte at a time and in
+// pieces with pauses between, and the fields are checked. An error reply
+// or a connection that drops partway must fail and leave the previous
+// data as it was. Heap use is counted throughout and its peak reported
+// for each response; it must stay under 256 bytes (what's left is the
+// Strings logged).
+//
+//   g++ -O2 -I. -o owm_test owm_test.cpp
+//   ./owm_test
+//
+// Needs python3 on the path. Exits nonzero on failure.
+
+#include <math.h>
+#include <new>
+#include <signal.h>
+#include <unistd.h>
+#include <arpa/inet.h>
+#include <sys/socket.h>
+#include <sys/wait.h>
+#include "../adafruit_epd_weather/OpenWeatherMap.cpp"
+#include "../adafruit_epd_weather/JsonStream.cpp"
+
+// Every new and delete counted
+static size_t heapNow = 0, heapPeak = 0;
+
+void *operator new(size_t n) {
+  size_t *p = (size_t *)malloc(n + 16);
+  if (!p) throw std::bad_alloc();
+  *p = n;
+  heapNow += n;
+  if (heapNow > heapPeak) heapPeak = heapNow;
+  return (char *)p + 16;
+}
+
+void operator delete(void *q) noexcept {
+  if (!q) return;
+  size_t *p = (size_t *)((char *)q - 16);
+  heapNow -= *p;
+  free(p);
+}
+
+void operator delete(void *q, size_t) noexcept { operator delete(q); }
+
+static int failures = 0;
+
+static void check(bool ok, const char *what) {
+  if (!ok) { printf("FAIL: %s\n", what); failures++; }
+}
+
+static int serverPort;
+
+// A connection to owm_server.py, past the headers as wget() leaves it
+class SockClient : public Client {
+ public:
+  SockClient() : fd(-1), eof(false) { }
+  ~SockClient() { stop(); }
+
+  bool get(const char *path) {
+    stop();
+    fd = socket(AF_INET, SOCK_STREAM, 0);
+    sockaddr_in a;
+    memset(&a, 0, sizeof a);
+    a.sin_family = AF_INET;
+    a.sin_port   = htons(serverPort);
+    inet_pton(AF_INET, "127.0.0.1", &a.sin_addr);
+    if (connect(fd, (sockaddr *)&a, sizeof a)) return false;
+    char req[128];
+    int  n = snprintf(req, sizeof req, "GET /%s HTTP/1.0\r\nHost: localhost\r\n\r\n", path);
+    send(fd, req, n, 0);
+    const char *end = "\r\n\r\n";
+    int  k = 0;
+    char c;
+    while ((k < 4) && (recv(fd, &c, 1, 0) == 1)) k = (c == end[k]) ? k + 1 : (c == '\r');
+    return k == 4;
+  }
+
+  int read(uint8_t *b, size_t n) {
+    ssize_t r = recv(fd, b, n, MSG_DONTWAIT);
+    if (r == 0) eof = true;
+    return (r > 0) ? r : 0;
+  }
+  uint8_t connected() { return (fd >= 0) && !eof; }
+
+  void stop() {
+    if (fd >= 0) close(fd);
+    fd  = -1;
+    eof = false;
+  }
+
+ private:
+  int  fd;
+  bool eof;
+};
+
+static bool near(float a, float b) { return fabs(a - b) < 0.001; }
+
+// Start owm_server.py and read back the port it's listening on
+static pid_t startServer() {
+  int fds[2];
+  if (pipe(fds)) return -1;
+  pid_t pid = fork();
+  if (pid == 0) {
+    dup2(fds[1], 1);
+    close(fds[0]);
+    execlp("python3", "python3", "owm_server.py", "0", (char *)NULL);
+    _exit(127);
+  }
+  close(fds[1]);
+  FILE *f = fdopen(fds[0], "r");
+  if (fscanf(f, "%d", &serverPort) != 1) serverPort = 0;
+  fclose(f);
+  return pid;
+}
+
+static Stream                     quiet;
+static AirliftOpenWeatherMap      owm(&quiet);
+static SockClient                 client;
+static OpenWeatherMapCurrentData  current;
+static OpenWeatherMapForecastData forecast[3];
+
+static bool fetchCurrent(const char *path) {
+  if (!client.get(path)) return false;
+  heapNow = heapPeak = 0;
+  bool ok = owm.updateCurrent(current, client);
+  printf("  %-42s %-5s heap peak %3u B\n", path, ok ? "ok" : "fail", (unsigned)heapPeak);
+  check(heapPeak < 256, "heap under 256 bytes");
+  return ok;
+}
+
+static bool fetchForecast(const char *path) {
+  if (!client.get(path)) return false;
+  heapNow = heapPeak = 0;
+  bool ok = owm.updateForecast(forecast, 3, 2, client);
+  printf("  %-42s %-5s heap peak %3u B\n", path, ok ? "ok" : "fail", (unsigned)heapPeak);
+  check(heapPeak < 256, "heap under 256 bytes");
+  return ok;
+}
+
+static bool forecastRight() {
+  return (forecast[0].observationTime == 1634569200) &&
+         (forecast[1].observationTime == 1634590800) &&
+         (forecast[2].observationTime == 1634612400) &&
+         !strcmp(forecast[0].main, "Clear") && !strcmp(forecast[0].icon, "01d") &&
+         !strcmp(forecast[1].description, "pluie mod\xc3\xa9r\xc3\xa9" "e") &&
+         !strcmp(forecast[1].observationTimeText, "2021-10-18 06:00:00") &&
+         near(forecast[1].temp, 57) && (forecast[1].humidity == 72) &&
+         near(forecast[2].windSpeed, 1.77) && near(forecast[2].rain, 0.055) &&
+         (forecast[2].clouds == 44);
+}
+
+int main(void) {
+  pid_t server = startServer();
+  if (!serverPort) {
+    printf("couldn't start owm_server.py\n");
+    return 1;
+  }
+
+  printf("current weather:\n");
+  check(fetchCurrent("current.json"), "current weather");
+  check(!strcmp(current.cityName, "New York") && !strcmp(current.country, "US") &&
+        !strcmp(current.description, "light rain") && !strcmp(current.icon, "10d") &&
+        near(current.temp, 57.2) && (current.humidity == 82) && (current.pressure == 1012) &&
+        (current.sunrise == 1634555312) && (current.timezone == -14400),
+        "current weather fields");
+  OpenWeatherMapCurrentData saved = current;
+  check(!fetchCurrent("error.json"), "unknown city fails");
+  check(owm.getError() == "OpenWeatherMap error: city not found", "error message");
+  check(!memcmp(&saved, &current, sizeof saved), "error leaves current weather");
+  check(!fetchCurrent("current.json?drop=300"), "cut-off current weather fails");
+  check(!memcmp(&saved, &current, sizeof saved), "cut-off leaves current weather");
+
+  printf("forecast:\n");
+  const char *good[] = {
+    "forecast6.json", "forecast40.json", "forecast40.json?chunk=1",
+    "forecast40.json?chunk=1000&gap=20", "forecast6.json?chunk=61&gap=1",
+  };
+  for (unsigned i = 0; i < sizeof good / sizeof good[0]; i++) {
+    memset(forecast, 0xAA, sizeof forecast);
+    check(fetchForecast(good[i]), good[i]);
+    check(forecastRight(), "forecast fields");
+  }
+  OpenWeatherMapForecastData savedForecast[3];
+  memcpy(savedForecast, forecast, sizeof forecast);
+  check(!fetchForecast("error.json"), "unknown city fails");
+  check(!memcmp(savedForecast, forecast, sizeof forecast), "error leaves the forecast");
+  check(!fetchForecast("forecast40.json?chunk=500&gap=5&drop=6000"), "cut-off forecast fails");
+  check(!memcmp(savedForecast, forecast, sizeof forecast), "cut-off leaves the forecast");
+  OpenWeatherMapForecastData many[OWM_MAX_FORECASTS + 1];
+  check(!owm.updateForecast(many, OWM_MAX_FORECASTS + 1, 1, client), "too many forecasts");
+
+  printf("parser state %u bytes; on the stack, %u for a current weather copy and %u "
+         "for %d forecasts\n", (unsigned)sizeof(JsonStream),
+         (unsigned)sizeof(OpenWeatherMapCurrentData),
+         (unsigned)sizeof(OpenWeatherMapForecastData) * OWM_MAX_FORECASTS, OWM_MAX_FORECASTS);
+
+  kill(server, SIGTERM);
+  waitpid(server, NULL, 0);
+  printf("%s\n", failures ? "FAILED" : "every response parsed right");
+  return failures ? 1 : 0;
+}
@@ -37,11 +37,11 @@ int r = 255;
 int g = 0;
 int b = 0;
 
-// Function prototypes and data over in packetparser.cpp
-uint8_t readPacket(Adafruit_BLE *ble, uint16_t timeout);
+// Function prototypes over in packetparser.cpp
+void setPacketCallback(void (*callback)(uint8_t *packet, uint8_t len));
+void pollPackets(Adafruit_BLE *ble);
 float parsefloat(uint8_t *buffer);
 void printHex(const uint8_t * data, const uint32_t numBytes);
-extern uint8_t packetbuffer[];
 
 
 void setup(void)
@@ -71,6 +71,7 @@ void setup(void)
     animatePixels(strip, r, g, b, ANIMATION_PERIOD_MS);
     delay(50);
   }
+  setPacketCallback(handlePacket);
   ble.setMode(BLUEFRUIT_MODE_DATA);
 }
 
@@ -79,16 +80,19 @@ void loop(void)
   // Animate the pixels.
   animatePixels(strip, r, g, b, ANIMATION_PERIOD_MS);
   
-  // Grab a BLE controller packet if available.
-  uint8_t len = readPacket(&ble, BLE_READPACKET_TIMEOUT);
-  if (len == 0) return;
+  // Handle any BLE controller packets that have arrived.  This never waits
+  // for data, so the animation keeps its timing.
+  pollPackets(&ble);
+}
 
+void handlePacket(uint8_t *packet, uint8_t len) {
+  // Called by pollPackets() with each complete packet that passed its checksum.
   // Parse a color packet.
-  if (packetbuffer[1] == 'C') {
+  if (packet[1] == 'C') {
     // Grab the RGB values from the packet and change the light color.
-    r = packetbuffer[2];
-    g = packetbuffer[3];
-    b = packetbuffer[4];
+    r = packet[2];
+    g = packet[3];
+    b = packet[4];
     // Print out the color that was received too:
     Serial.print ("RGB #");
     if (r < 0x10) Serial.print("0");
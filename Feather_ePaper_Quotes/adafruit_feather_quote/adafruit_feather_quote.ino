@@ -20,6 +20,7 @@
 #include <ArduinoJson.h>     //https://github.com/bblanchon/ArduinoJson
 #include <Adafruit_EPD.h>
 #include "secrets.h"
+#include "DiffEPD.h"
 
 // define the # of seconds to sleep before waking up and getting a new quote
 #define SLEEP 3600 // 1 hour in seconds
@@ -59,10 +60,19 @@ const GFXfont *smallfont = NULL;
 #define EPD_RESET   -1 // can set to -1 and share with microcontroller Reset!
 #define EPD_BUSY    -1 // can set to -1 to not use a pin (will wait a fixed delay)
 
-// Uncomment the following line if you are using 2.13" tricolor 212*104 EPD
-//Adafruit_IL0373 epd(212, 104 ,EPD_DC, EPD_RESET, EPD_CS, SRAM_CS, EPD_BUSY);
-// Uncomment the following line if you are using 2.13" monochrome 250*122 EPD
-Adafruit_SSD1675 epd(250, 122, EPD_DC, EPD_RESET, EPD_CS, SRAM_CS, EPD_BUSY);
+// Uncomment the following lines if you are using 2.13" tricolor 212*104 EPD
+//DiffEPD<Adafruit_IL0373> epd(212, 104 ,EPD_DC, EPD_RESET, EPD_CS, SRAM_CS, EPD_BUSY);
+//#define EPD_PARTIAL false // tricolor panels can't do partial refreshes
+// Uncomment the following lines if you are using 2.13" monochrome 250*122 EPD
+DiffEPD<Adafruit_SSD1675> epd(250, 122, EPD_DC, EPD_RESET, EPD_CS, SRAM_CS, EPD_BUSY);
+#define EPD_PARTIAL true
+
+// Full refresh after this many partial ones, to clear any ghosting
+#define EPD_FULL_EVERY 12
+
+// What's on the panel survives deep sleep, so does the record of it; a
+// wake-up that fetches the same quote doesn't refresh the panel
+RTC_DATA_ATTR EPDDiffState refreshState;
 
 // get string length in pixels
 // set text font prior to calling this
@@ -348,6 +358,8 @@ void setup() {
   digitalWrite(LEDPIN, LEDPINON);
 
   epd.begin();
+  epd.setState(&refreshState);
+  epd.setPartial(EPD_PARTIAL, EPD_FULL_EVERY);
   Serial.println("ePaper display initialized");
   epd.clearBuffer();
   epd.setTextWrap(false);
@@ -378,6 +390,7 @@ void setup() {
   printOther("adafruit.com/quotes");
   
   epd.display();
+  epd.printStats(Serial);
   Serial.println("done, going to sleep...");
   // power down ePaper display
   epd.powerDown();
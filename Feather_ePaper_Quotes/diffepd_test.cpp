@@ -0,0 +1,359 @@
+// Host test for adafruit_feather_quote/DiffEPD.h. Runs on a PC, not the
+// board; FakeEPD below stands in for Adafruit_EPD, with its buffers in RAM
+// or in the SPI SRAM, laid out and addressed by drawPixel() the way
+// Adafruit_EPD does, and a copy of what the panel shows.
+//
+// A scene of rectangles is redrawn from scratch every frame and displayed:
+// sometimes unchanged, mostly with one small rectangle moved or recoloured,
+// now and then all new. After every display() the panel must show exactly
+// the framebuffer, so a partial refresh that missed a changed pixel fails.
+// The refreshed rectangle must also stay within a tile of the pixels that
+// actually changed, an unchanged frame must be skipped and a small change
+// must get a partial refresh, with a full one after every 'fullEvery'. That
+// is run for both panel sizes in use, every rotation, buffers in RAM and in
+// SRAM. Then: a panel class without displayPartial() gets full refreshes,
+// invalidate() forces one, and the state carries over a reboot. The
+// calendar and weather station copies of DiffEPD.h must match this one.
+//
+//   g++ -O2 -o diffepd_test diffepd_test.cpp
+//   ./diffepd_test
+//
+// Exits nonzero on failure.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <vector>
+
+static uint32_t now;
+static uint32_t millis() { return now; }
+
+#include "adafruit_feather_quote/DiffEPD.h"
+
+#define EPD_WHITE 0
+#define EPD_BLACK 1
+#define EPD_RED   2
+
+static int failures = 0;
+
+static void check(bool ok, const char *what) {
+  if (!ok && (failures++ < 10)) printf("FAIL: %s\n", what);
+}
+
+static uint8_t sramMem[65536];
+
+class Sram {
+ public:
+  void read(uint16_t addr, uint8_t *buf, uint16_t n) { memcpy(buf, sramMem + addr, n); }
+  uint8_t *mem = sramMem;
+};
+
+static Sram sramChip;
+template <class S> static S theSram();
+template <> Sram theSram<Sram>() { return sramChip; }
+template <> Sram *theSram<Sram *>() { return &sramChip; }
+
+// Adafruit_EPD as far as DiffEPD sees it. S is Sram or Sram *, as the
+// library has had it both ways.
+template <class S>
+class FakeEPD {
+ public:
+  FakeEPD(int w, int h) : WIDTH(w), HEIGHT(h), _HEIGHT((h + 7) / 8 * 8) {
+    buffer1_size = buffer2_size = WIDTH * _HEIGHT / 8;
+    buffer1_addr = 0;
+    buffer2_addr = buffer1_size;
+    buffer1 = new uint8_t[buffer1_size];
+    buffer2 = new uint8_t[buffer2_size];
+    shown[0].assign(buffer1_size, 0);
+    shown[1].assign(buffer2_size, 0);
+  }
+  ~FakeEPD() {
+    delete[] buffer1;
+    delete[] buffer2;
+  }
+
+  void setRotation(uint8_t r) { rotation = r; }
+  uint8_t getRotation() { return rotation; }
+  int16_t width() { return (rotation & 1) ? HEIGHT : WIDTH; }
+  int16_t height() { return (rotation & 1) ? WIDTH : HEIGHT; }
+
+  void useSram(bool on) { use_sram = on; }
+
+  void clearBuffer() {
+    memset(&plane(0, 0), 0, buffer1_size);
+    memset(&plane(1, 0), 0, buffer2_size);
+  }
+
+  void drawPixel(int16_t x, int16_t y, uint16_t color) {
+    if ((x < 0) || (x >= width()) || (y < 0) || (y >= height())) return;
+    uint32_t addr;
+    uint8_t  bit;
+    where(x, y, &addr, &bit);
+    plane(0, addr) = (color == EPD_BLACK) ? (plane(0, addr) | bit) : (plane(0, addr) & ~bit);
+    plane(1, addr) = (color == EPD_RED) ? (plane(1, addr) | bit) : (plane(1, addr) & ~bit);
+  }
+
+  void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+    for (int16_t i = x; i < x + w; i++) {
+      for (int16_t j = y; j < y + h; j++) drawPixel(i, j, color);
+    }
+  }
+
+  void display() {
+    for (uint32_t i = 0; i < buffer1_size; i++) shown[0][i] = plane(0, i);
+    for (uint32_t i = 0; i < buffer2_size; i++) shown[1][i] = plane(1, i);
+    now += 2000;
+  }
+
+  // Framebuffer pixel, and what the panel shows there
+  uint8_t pixel(int16_t x, int16_t y, bool onPanel = false) {
+    uint32_t addr;
+    uint8_t  bit;
+    where(x, y, &addr, &bit);
+    uint8_t b0 = onPanel ? shown[0][addr] : plane(0, addr);
+    uint8_t b1 = onPanel ? shown[1][addr] : plane(1, addr);
+    return ((b0 & bit) ? 1 : 0) | ((b1 & bit) ? 2 : 0);
+  }
+
+ protected:
+  // Copy one pixel from the framebuffer to the panel
+  void show(int16_t x, int16_t y) {
+    uint32_t addr;
+    uint8_t  bit;
+    where(x, y, &addr, &bit);
+    for (int p = 0; p < 2; p++) shown[p][addr] = (shown[p][addr] & ~bit) | (plane(p, addr) & bit);
+  }
+
+  const int16_t WIDTH, HEIGHT, _HEIGHT;
+  uint8_t *buffer1, *buffer2;
+  uint32_t buffer1_size, buffer2_size;
+  uint16_t buffer1_addr, buffer2_addr;
+  bool     use_sram = false;
+  S        sram = theSram<S>();
+
+ private:
+  uint8_t rotation = 0;
+  std::vector<uint8_t> shown[2];
+
+  uint8_t &plane(int p, uint32_t i) {
+    if (use_sram) return epdSram(sram).mem[(p ? buffer2_addr : buffer1_addr) + i];
+    return (p ? buffer2 : buffer1)[i];
+  }
+
+  // As Adafruit_EPD::drawPixel() does it
+  void where(int16_t x, int16_t y, uint32_t *addr, uint8_t *bit) {
+    int16_t t;
+    switch (rotation) {
+      case 1: t = x; x = y; y = t; x = WIDTH - x - 1; break;
+      case 2: x = WIDTH - x - 1; y = HEIGHT - y - 1; break;
+      case 3: t = x; x = y; y = t; y = HEIGHT - y - 1; break;
+    }
+    *addr = ((uint32_t)(WIDTH - 1 - x) * _HEIGHT + y) / 8;
+    *bit  = 1 << (7 - y % 8);
+  }
+};
+
+// A panel whose library has displayPartial(), corners inclusive
+template <class S>
+class PartialEPD : public FakeEPD<S> {
+ public:
+  PartialEPD(int w, int h) : FakeEPD<S>(w, h) { }
+  void displayPartial(int16_t x1, int16_t y1, int16_t x2, int16_t y2) {
+    for (int16_t x = x1; x <= x2; x++) {
+      for (int16_t y = y1; y <= y2; y++) this->show(x, y);
+    }
+    now += 300;
+  }
+};
+
+struct Box {
+  int16_t x, y, w, h;
+  uint8_t color;
+};
+
+static Box randomBox(int16_t w, int16_t h) {
+  Box b = { (int16_t)(rand() % w), (int16_t)(rand() % h), (int16_t)(1 + rand() % 12),
+            (int16_t)(1 + rand() % 12), (uint8_t)(1 + rand() % 2) };
+  return b;
+}
+
+template <class P>
+static void drawScene(P &epd, const std::vector<Box> &scene) {
+  epd.clearBuffer();
+  for (size_t i = 0; i < scene.size(); i++) {
+    epd.fillRect(scene[i].x, scene[i].y, scene[i].w, scene[i].h, scene[i].color);
+  }
+}
+
+// Pixels that differ between the framebuffer and the panel; x2 < x1 if none
+template <class P>
+static EPDRect pixelDiff(P &epd) {
+  EPDRect r = { epd.width(), epd.height(), -1, -1 };
+  for (int16_t x = 0; x < epd.width(); x++) {
+    for (int16_t y = 0; y < epd.height(); y++) {
+      if (epd.pixel(x, y) == epd.pixel(x, y, true)) continue;
+      if (x < r.x1) r.x1 = x;
+      if (x > r.x2) r.x2 = x;
+      if (y < r.y1) r.y1 = y;
+      if (y > r.y2) r.y2 = y;
+    }
+  }
+  return r;
+}
+
+template <class P>
+static bool panelShowsBuffer(P &epd) {
+  EPDRect d = pixelDiff(epd);
+  return d.x2 < d.x1;
+}
+
+static double worstSlack;
+
+// Random frames on one panel, with a line of what they took
+template <class S>
+static void randomFrames(int w, int h, uint8_t rotation, bool useSram, const char *name) {
+  const uint8_t fullEvery = 5;
+  DiffEPD<PartialEPD<S> > epd(w, h);
+  epd.setRotation(rotation);
+  epd.useSram(useSram);
+  epd.setPartial(true, fullEvery);
+
+  std::vector<Box> scene;
+  for (int i = 0; i < 20; i++) scene.push_back(randomBox(epd.width(), epd.height()));
+  drawScene(epd, scene);
+  epd.display();
+  check(epd.stats().fullRefreshes == 1, "first frame is a full refresh");
+
+  uint32_t partials = 0, smallFulls = 0, since = 0;
+  double   area = 0;
+  for (int frame = 0; frame < 300; frame++) {
+    int r = rand() % 100;
+    if (r < 25) {
+      // Same scene, drawn again
+    } else if (r < 90) {
+      Box &b = scene[rand() % scene.size()];
+      if (rand() % 2) b.color = 3 - b.color;
+      else b.x += rand() % 5 - 2, b.y += rand() % 5 - 2;
+    } else {
+      for (size_t i = 0; i < scene.size(); i++) scene[i] = randomBox(epd.width(), epd.height());
+    }
+    drawScene(epd, scene);
+
+    EPDRect  diff = pixelDiff(epd);
+    EPDDiffState before = epd.stats();
+    epd.display();
+    const EPDDiffState &after = epd.stats();
+    const EPDRect &rect = epd.lastChange();
+
+    check(panelShowsBuffer(epd), "panel shows the framebuffer after display()");
+    bool changed = diff.x2 >= diff.x1;
+    if (!changed) {
+      check(after.skippedRefreshes == before.skippedRefreshes + 1, "unchanged frame skipped");
+      continue;
+    }
+    // The refreshed rectangle covers every changed pixel, and no more than
+    // rounding out to tiles adds
+    check((rect.x1 <= diff.x1) && (rect.y1 <= diff.y1) && (rect.x2 >= diff.x2) &&
+          (rect.y2 >= diff.y2), "changed rectangle covers the changed pixels");
+    int16_t slack = diff.x1 - rect.x1;
+    if (diff.y1 - rect.y1 > slack) slack = diff.y1 - rect.y1;
+    if (rect.x2 - diff.x2 > slack) slack = rect.x2 - diff.x2;
+    if (rect.y2 - diff.y2 > slack) slack = rect.y2 - diff.y2;
+    check(slack < EPD_TILE, "changed rectangle within a tile of the changed pixels");
+    if (slack > worstSlack) worstSlack = slack;
+
+    bool small = (diff.x2 - diff.x1 < 2 * EPD_TILE) && (diff.y2 - diff.y1 < 2 * EPD_TILE);
+    if (after.partialRefreshes > before.partialRefreshes) {
+      partials++;
+      since++;
+      check(since <= fullEvery, "no more than fullEvery partial refreshes in a row");
+      area += (rect.x2 - rect.x1 + 1.0) * (rect.y2 - rect.y1 + 1.0) / (w * h);
+    } else {
+      check(after.fullRefreshes == before.fullRefreshes + 1, "changed frame refreshed");
+      if (small) {
+        check(since == fullEvery, "small change is a partial refresh unless one is due");
+        smallFulls++;
+      }
+      since = 0;
+    }
+  }
+  const EPDDiffState &s = epd.stats();
+  printf("%3dx%-3d rot %d %-12s %4u %7u %7u %13.1f%% %11u\n", w, h, rotation, name,
+         (unsigned)s.fullRefreshes, (unsigned)s.partialRefreshes,
+         (unsigned)s.skippedRefreshes, partials ? 100 * area / partials : 0.0,
+         (unsigned)smallFulls);
+}
+
+// Whether two files have the same contents
+static bool sameFile(const char *a, const char *b) {
+  FILE *fa = fopen(a, "rb"), *fb = fopen(b, "rb");
+  bool  same = fa && fb;
+  while (same) {
+    int ca = fgetc(fa), cb = fgetc(fb);
+    same = (ca == cb);
+    if (ca == EOF) break;
+  }
+  if (fa) fclose(fa);
+  if (fb) fclose(fb);
+  return same;
+}
+
+int main(void) {
+  srand(1);
+  printf("panel           buffers     full partial skipped  partial area  forced full\n");
+  const int sizes[][2] = { { 250, 122 }, { 264, 176 } };
+  for (int i = 0; i < 2; i++) {
+    for (uint8_t rot = 0; rot < 4; rot++) {
+      randomFrames<Sram>(sizes[i][0], sizes[i][1], rot, false, "RAM");
+      randomFrames<Sram>(sizes[i][0], sizes[i][1], rot, true, "SRAM");
+      randomFrames<Sram *>(sizes[i][0], sizes[i][1], rot, true, "SRAM pointer");
+    }
+  }
+  printf("refreshed rectangle at most %.0f pixels past the changed ones\n", worstSlack);
+
+  // No displayPartial() in this library: changes get full refreshes
+  std::vector<Box> scene(1, randomBox(200, 100));
+  DiffEPD<FakeEPD<Sram> > full(250, 122);
+  full.setPartial(true, 5);
+  drawScene(full, scene);
+  full.display();
+  scene[0].x++;
+  drawScene(full, scene);
+  full.display();
+  check(panelShowsBuffer(full), "full refresh without displayPartial()");
+  check((full.stats().fullRefreshes == 2) && (full.stats().partialRefreshes == 0),
+        "no displayPartial(), no partial refresh");
+  full.invalidate();
+  full.display();
+  check(full.stats().fullRefreshes == 3, "invalidate() forces a full refresh");
+
+  // Deep sleep: the state survives, the object and its buffers don't
+  EPDDiffState kept = {};
+  {
+    DiffEPD<PartialEPD<Sram> > before(250, 122);
+    before.setState(&kept);
+    before.setPartial(true, 5);
+    drawScene(before, scene);
+    before.display();
+  }
+  DiffEPD<PartialEPD<Sram> > after(250, 122);
+  after.setState(&kept);
+  after.setPartial(true, 5);
+  drawScene(after, scene);
+  after.display();
+  check(kept.skippedRefreshes == 1, "same frame after a reboot skipped");
+  scene[0].y++;
+  drawScene(after, scene);
+  after.display();
+  check(kept.partialRefreshes == 1, "small change after a reboot is partial");
+
+  check(sameFile("adafruit_feather_quote/DiffEPD.h",
+                 "../Airlift_ePaper_Calendar/adafruit_airlift_calendar/DiffEPD.h") &&
+        sameFile("adafruit_feather_quote/DiffEPD.h",
+                 "../EInk_Weather_Station/adafruit_epd_weather/DiffEPD.h"),
+        "calendar and weather station DiffEPD.h the same as this one");
+
+  printf("%s\n", failures ? "FAILED" : "every changed pixel refreshed");
+  return failures ? 1 : 0;
+}
@@ -27,22 +27,11 @@ NewSoftSerial mySerial = NewSoftSerial(2, 3);
 #define GPSRATE 4800
 //#define GPSRATE 38400
 
-// The buffer size that will hold a GPS sentence. They tend to be 80 characters long
-// so 90 is plenty.
-#define BUFFSIZ 90 // plenty big
+// Sentences are parsed a character at a time as they arrive (see nmea.h),
+// so there's no line buffer to fill and re-scan.
+#include "nmea.h"
 
-
-// global variables
-char buffer[BUFFSIZ];        // string buffer for the sentence
-char *parseptr;              // a character pointer for parsing
-char buffidx;                // an indexer into the buffer
-
-// The time, date, location data, etc.
-uint8_t hour, minute, second, year, month, date;
-uint32_t latitude, longitude, trackangle;
-uint8_t groundspeed;
-char latdir, longdir;
-char status;
+NmeaParser gps;
 
 void setup() 
 { 
@@ -65,136 +54,45 @@ void setup()
    digitalWrite(powerpin, LOW);         // pull low to turn on!
 } 
  
-uint32_t parsedecimal(char *str) {
-  uint32_t d = 0;
-  
-  while (str[0] != 0) {
-   if ((str[0] > '9') || (str[0] < '0'))
-     return d;
-   d *= 10;
-   d += str[0] - '0';
-   str++;
-  }
-  return d;
+// Print a 1/10000 arc-minute angle as degrees, minutes, seconds
+void printAngle(int32_t a, char pos, char neg) {
+  Serial.print((a < 0) ? neg : pos);
+  if (a < 0) a = -a;
+  uint32_t frac = a % 10000;              // 1/10000 minute
+  Serial.print(a / 600000, DEC); Serial.print("* ");
+  Serial.print((a / 10000) % 60, DEC); Serial.print('\''); Serial.print(' ');
+  Serial.print(frac * 6 / 1000, DEC); Serial.print('.');
+  uint8_t hundredths = (frac * 6 / 10) % 100;
+  if (hundredths < 10) Serial.print('0');
+  Serial.print(hundredths, DEC); Serial.println('"');
 }
 
-void readline(void) {
-  char c;
-  
-  buffidx = 0; // start at begninning
-  while (1) {
-      c=mySerial.read();
-      if (c == -1)
-        continue;
-      Serial.print(c);
-      if (c == '\n')
-        continue;
-      if ((buffidx == BUFFSIZ-1) || (c == '\r')) {
-        buffer[buffidx] = 0;
-        return;
-      }
-      buffer[buffidx++]= c;
-  }
-}
- 
 void loop() 
 { 
-  uint32_t tmp;
-  
-  Serial.print("\n\rRead: ");
-  readline();
-  
-  // check if $GPRMC (global positioning fixed data)
-  if (strncmp(buffer, "$GPRMC",6) == 0) {
-    
-    // hhmmss time data
-    parseptr = buffer+7;
-    tmp = parsedecimal(parseptr); 
-    hour = tmp / 10000;
-    minute = (tmp / 100) % 100;
-    second = tmp % 100;
-    
-    parseptr = strchr(parseptr, ',') + 1;
-    status = parseptr[0];
-    parseptr += 2;
-    
-    // grab latitude & long data
-    // latitude
-    latitude = parsedecimal(parseptr);
-    if (latitude != 0) {
-      latitude *= 10000;
-      parseptr = strchr(parseptr, '.')+1;
-      latitude += parsedecimal(parseptr);
-    }
-    parseptr = strchr(parseptr, ',') + 1;
-    // read latitude N/S data
-    if (parseptr[0] != ',') {
-      latdir = parseptr[0];
-    }
-    
-    //Serial.println(latdir);
-    
-    // longitude
-    parseptr = strchr(parseptr, ',')+1;
-    longitude = parsedecimal(parseptr);
-    if (longitude != 0) {
-      longitude *= 10000;
-      parseptr = strchr(parseptr, '.')+1;
-      longitude += parsedecimal(parseptr);
-    }
-    parseptr = strchr(parseptr, ',')+1;
-    // read longitude E/W data
-    if (parseptr[0] != ',') {
-      longdir = parseptr[0];
-    }
-    
-
-    // groundspeed
-    parseptr = strchr(parseptr, ',')+1;
-    groundspeed = parsedecimal(parseptr);
-
-    // track angle
-    parseptr = strchr(parseptr, ',')+1;
-    trackangle = parsedecimal(parseptr);
+  int c = mySerial.read();
+  if (c < 0) return;
+  Serial.print((char)c);
 
-
-    // date
-    parseptr = strchr(parseptr, ',')+1;
-    tmp = parsedecimal(parseptr); 
-    date = tmp / 10000;
-    month = (tmp / 100) % 100;
-    year = tmp % 100;
-    
+  // check if $GPRMC (global positioning fixed data)
+  if (gps.feed(c) == NMEA_RMC) {
+    uint32_t time = gps.rmc.time / 1000; // hhmmss
     Serial.print("\n\tTime: ");
-    Serial.print(hour, DEC); Serial.print(':');
-    Serial.print(minute, DEC); Serial.print(':');
-    Serial.println(second, DEC);
+    Serial.print(time / 10000, DEC); Serial.print(':');
+    Serial.print((time / 100) % 100, DEC); Serial.print(':');
+    Serial.println(time % 100, DEC);
     Serial.print("\tDate: ");
-    Serial.print(month, DEC); Serial.print('/');
-    Serial.print(date, DEC); Serial.print('/');
-    Serial.println(year, DEC);
-    
-    Serial.print("\tLat: "); 
-    if (latdir == 'N')
-       Serial.print('+');
-    else if (latdir == 'S')
-       Serial.print('-');
+    Serial.print((gps.rmc.date / 100) % 100, DEC); Serial.print('/');
+    Serial.print(gps.rmc.date / 10000, DEC); Serial.print('/');
+    Serial.println(gps.rmc.date % 100, DEC);
 
-    Serial.print(latitude/1000000, DEC); Serial.print("* ");
-    Serial.print((latitude/10000)%100, DEC); Serial.print('\''); Serial.print(' ');
-    Serial.print((latitude%10000)*6/1000, DEC); Serial.print('.');
-    Serial.print(((latitude%10000)*6/10)%100, DEC); Serial.println('"');
-   
+    Serial.print("\tLat: ");
+    printAngle(gps.rmc.lat, '+', '-');
     Serial.print("\tLong: ");
-    if (longdir == 'E')
-       Serial.print('+');
-    else if (longdir == 'W')
-       Serial.print('-');
-    Serial.print(longitude/1000000, DEC); Serial.print("* ");
-    Serial.print((longitude/10000)%100, DEC); Serial.print('\''); Serial.print(' ');
-    Serial.print((longitude%10000)*6/1000, DEC); Serial.print('.');
-    Serial.print(((longitude%10000)*6/10)%100, DEC); Serial.println('"');
-   
+    printAngle(gps.rmc.lon, '+', '-');
+    Serial.print("\tSpeed: ");
+    Serial.print(gps.rmc.speed / 100, DEC);
+    Serial.println(" knots");
+    Serial.print("\tSentences good/bad: ");
+    Serial.print(gps.good); Serial.print('/'); Serial.println(gps.bad);
   }
-  //Serial.println(buffer);
 }
@@ -0,0 +1,231 @@
+// Streaming NMEA parser
+//
+// Feed it one character at a time, straight from a UART interrupt or a
+// ring buffer, and it verifies the checksum and pulls RMC and GGA fields
+// into fixed-point structs as the bytes arrive. There's no sentence
+// buffer, no strstr/strchr rescans and no floating point; the whole
+// parser, including both result structs, is about 100 bytes of RAM.
+//
+//   NmeaParser gps;
+//   ...
+//   if (gps.feed(c) == NMEA_RMC) {
+//     // gps.rmc holds the sentence that just passed its checksum
+//   }
+//
+// A sentence's fields are only copied to rmc/gga after the checksum
+// matches, so a corrupt sentence never overwrites good data. When feed()
+// is called from an interrupt, read rmc/gga with interrupts disabled.
+
+#ifndef _NMEA_H_
+#define _NMEA_H_
+
+#include <stdint.h>
+#include <string.h>
+
+// feed() return values
+enum {
+  NMEA_NONE = 0, // Mid-sentence, or between sentences
+  NMEA_RMC,      // Valid $xxRMC sentence; 'rmc' updated
+  NMEA_GGA,      // Valid $xxGGA sentence; 'gga' updated
+  NMEA_OTHER,    // Valid sentence of some other type
+  NMEA_BAD       // Checksum mismatch, missing checksum or overlong
+};
+
+typedef struct {
+  uint32_t time;   // hhmmss * 1000 + milliseconds, UTC
+  uint32_t date;   // ddmmyy
+  int32_t  lat;    // 1/10000 arc-minute, + north
+  int32_t  lon;    // 1/10000 arc-minute, + east
+  uint16_t speed;  // 1/100 knot
+  uint16_t course; // 1/100 degree
+  bool     fix;    // Status 'A' (active) vs 'V' (void)
+} NmeaRMC;
+
+typedef struct {
+  uint32_t time;       // hhmmss * 1000 + milliseconds, UTC
+  int32_t  lat;        // 1/10000 arc-minute, + north
+  int32_t  lon;        // 1/10000 arc-minute, + east
+  int32_t  altitude;   // 1/10 meter above mean sea level
+  uint16_t hdop;       // 1/100
+  uint8_t  quality;    // 0 = no fix, 1 = GPS, 2 = DGPS, ...
+  uint8_t  satellites; // Satellites in use
+} NmeaGGA;
+
+#define NMEA_MAX_LENGTH 82 // Per NMEA 0183, including '$' and CR/LF
+
+class NmeaParser {
+ public:
+  NmeaRMC  rmc;
+  NmeaGGA  gga;
+  uint32_t good, bad; // Sentence counters
+
+  NmeaParser() : good(0), bad(0), state(IDLE) {
+    memset(&rmc, 0, sizeof rmc);
+    memset(&gga, 0, sizeof gga);
+  }
+
+  uint8_t feed(char c) {
+    if (c == '$') { // Start of sentence, always; resyncs after garbage
+      state    = BODY;
+      sum      = 0;
+      length   = 1;
+      field    = 0;
+      type     = NMEA_OTHER;
+      id       = 0;
+      startField();
+      return NMEA_NONE;
+    }
+    if (state == IDLE) return NMEA_NONE;
+    if (++length > NMEA_MAX_LENGTH) return fail();
+
+    switch (state) {
+     case BODY:
+      if (c == '*') {
+        endField();
+        state = CHECK_HI;
+      } else if ((c == '\r') || (c == '\n')) {
+        return fail(); // No checksum
+      } else {
+        sum ^= c;
+        if (c == ',') {
+          endField();
+          field++;
+          startField();
+        } else {
+          fieldChar(c);
+        }
+      }
+      return NMEA_NONE;
+     case CHECK_HI:
+      if (hex(c) > 15) return fail();
+      sum  ^= hex(c) << 4;
+      state = CHECK_LO;
+      return NMEA_NONE;
+     default: // CHECK_LO
+      state = IDLE;
+      if ((hex(c) > 15) || (sum != hex(c))) return fail();
+      good++;
+      if (type == NMEA_RMC) rmc = work.rmc;
+      else if (type == NMEA_GGA) gga = work.gga;
+      return type;
+    }
+  }
+
+ private:
+  enum { IDLE, BODY, CHECK_HI, CHECK_LO };
+
+  union {          // Fields being collected; copied out on good checksum
+    NmeaRMC rmc;
+    NmeaGGA gga;
+  } work;
+  int32_t  value;  // Numeric accumulator for current field
+  uint32_t id;     // Last 3 characters of sentence ID, packed
+  uint8_t  state, sum, length, field, type;
+  uint8_t  decimals; // Fraction digits still wanted in current field
+  char     first;    // First character of current field
+  bool     frac, negative;
+
+  uint8_t fail(void) {
+    state = IDLE;
+    bad++;
+    return NMEA_BAD;
+  }
+
+  static uint8_t hex(char c) {
+    if ((c >= '0') && (c <= '9')) return c - '0';
+    if ((c >= 'A') && (c <= 'F')) return c - 'A' + 10;
+    return 0xFF; // Not a hex digit
+  }
+
+  // Fraction digits kept for each numeric field (time 3, lat/lon 4, ...)
+  uint8_t wantDecimals(void) const {
+    if (type == NMEA_RMC) {
+      static const uint8_t d[] = { 0, 3, 0, 4, 0, 4, 0, 2, 2, 0 };
+      return (field < sizeof d) ? d[field] : 0;
+    } else if (type == NMEA_GGA) {
+      static const uint8_t d[] = { 0, 3, 4, 0, 4, 0, 0, 0, 2, 1 };
+      return (field < sizeof d) ? d[field] : 0;
+    }
+    return 0;
+  }
+
+  void startField(void) {
+    value    = 0;
+    frac     = false;
+    negative = false;
+    first    = 0;
+    decimals = wantDecimals();
+  }
+
+  void fieldChar(char c) {
+    if (!first) first = c;
+    if (field == 0) { // Sentence ID: keep last three chars (talker varies)
+      id = (id << 8) | (uint8_t)c;
+    } else if ((c >= '0') && (c <= '9')) {
+      if (frac) {
+        if (!decimals) return; // Excess precision
+        decimals--;
+      }
+      value = value * 10 + (c - '0');
+    } else if (c == '.') {
+      frac = true;
+    } else if (c == '-') {
+      negative = true;
+    }
+  }
+
+  // Scale accumulated value up to the field's full decimal count
+  int32_t fixed(void) {
+    while (decimals--) value *= 10;
+    return negative ? -value : value;
+  }
+
+  // ddmm.mmmm (as integer * 10000) to 1/10000 arc-minutes
+  int32_t angle(void) {
+    int32_t v = fixed();
+    return (v / 1000000) * 600000 + (v % 1000000);
+  }
+
+  void endField(void) {
+    if (field == 0) {
+      id &= 0xFFFFFF;
+      if (id == (((uint32_t)'R' << 16) | ('M' << 8) | 'C')) {
+        type = NMEA_RMC;
+        memset(&work.rmc, 0, sizeof work.rmc);
+      } else if (id == (((uint32_t)'G' << 16) | ('G' << 8) | 'A')) {
+        type = NMEA_GGA;
+        memset(&work.gga, 0, sizeof work.gga);
+      }
+      return;
+    }
+    if (type == NMEA_RMC) {
+      NmeaRMC &r = work.rmc;
+      switch (field) {
+       case 1: r.time   = fixed();                    break;
+       case 2: r.fix    = (first == 'A');             break;
+       case 3: r.lat    = angle();                    break;
+       case 4: if (first == 'S') r.lat = -r.lat;      break;
+       case 5: r.lon    = angle();                    break;
+       case 6: if (first == 'W') r.lon = -r.lon;      break;
+       case 7: r.speed  = fixed();                    break;
+       case 8: r.course = fixed();                    break;
+       case 9: r.date   = fixed();                    break;
+      }
+    } else if (type == NMEA_GGA) {
+      NmeaGGA &g = work.gga;
+      switch (field) {
+       case 1: g.time       = fixed();                break;
+       case 2: g.lat        = angle();                break;
+       case 3: if (first == 'S') g.lat = -g.lat;      break;
+       case 4: g.lon        = angle();                break;
+       case 5: if (first == 'W') g.lon = -g.lon;      break;
+       case 6: g.quality    = fixed();                break;
+       case 7: g.satellites = fixed();                break;
+       case 8: g.hdop       = fixed();                break;
+       case 9: g.altitude   = fixed();                break;
+      }
+    }
+  }
+};
+
+#endif // _NMEA_H_
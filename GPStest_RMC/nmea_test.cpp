@@ -0,0 +1,232 @@
+// Host test for GPStest_RMC/nmea.h (SD_Basic_GPS_Logger has a copy of
+// the same file). Runs on a PC, not the board.
+//
+// Checks the fields pulled from known RMC and GGA sentences, that
+// sentences with a wrong, missing or non-hex checksum are rejected without
+// touching the last good fix, and that every single-character corruption
+// of a good sentence is caught unless it happens to keep the checksum
+// right (compared against an independent checksum).
+//
+// Then it times the parser on a recorded NMEA log -- the file named on the
+// command line, or else a one-second burst from a typical receiver built
+// in below -- in sentences per second, next to the old way of buffering a
+// line, re-scanning it for the checksum and hopping between fields with
+// strchr().
+//
+//   g++ -O2 -o nmea_test nmea_test.cpp
+//   ./nmea_test [log.nmea]
+//
+// Exits nonzero on failure.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <vector>
+#include "GPStest_RMC/nmea.h"
+
+static int failures = 0;
+
+static void check(bool ok, const char *what, const char *s) {
+  if (!ok) {
+    printf("FAIL: %s: %s", what, s);
+    failures++;
+  }
+}
+
+// Feed a string, returning the first result other than NMEA_NONE
+static uint8_t feed(NmeaParser &p, const char *s) {
+  uint8_t r = NMEA_NONE;
+  for (; *s; s++) {
+    r = p.feed(*s);
+    if (r != NMEA_NONE) break;
+  }
+  return r;
+}
+
+// What the result should be, worked out the slow way. The parser gives
+// its answer at the second checksum digit; anything after that is the
+// next sentence's business.
+static bool checksumOk(const char *s) {
+  const char *star = strchr(s, '*');
+  if ((s[0] != '$') || !star || !star[1] || !star[2]) return false;
+  if (star + 3 - s > NMEA_MAX_LENGTH) return false;
+  for (const char *c = s + 1; c < star + 3; c++) {
+    if ((*c == '$') || (*c == '\r') || (*c == '\n')) return false;
+  }
+  uint8_t sum = 0;
+  for (const char *c = s + 1; c < star; c++) sum ^= *c;
+  char want[3];
+  sprintf(want, "%02X", sum);
+  return (star[1] == want[0]) && (star[2] == want[1]);
+}
+
+static const char *RMC =
+  "$GPRMC,194509.000,A,4042.6142,N,07400.4168,W,2.03,221.11,160412,,,A*77\r\n";
+static const char *GGA =
+  "$GPGGA,123519,4807.038,N,01131.000,E,1,08,0.9,545.4,M,46.9,M,,*47\r\n";
+
+// One second of output from a receiver at 1 Hz with all sentences on
+static const char *EPOCH =
+  "$GPGGA,194509.000,4042.6142,N,07400.4168,W,1,07,1.05,12.3,M,-34.2,M,,*6E\r\n"
+  "$GPGSA,A,3,21,29,26,15,18,05,24,,,,,,1.34,1.05,0.83*09\r\n"
+  "$GPGSV,3,1,11,21,72,311,34,29,56,062,31,26,49,243,28,15,41,115,33*75\r\n"
+  "$GPGSV,3,2,11,18,33,047,24,05,29,176,30,24,16,288,22,02,10,033,*79\r\n"
+  "$GPGSV,3,3,11,16,07,225,,10,04,321,,12,01,158,*47\r\n"
+  "$GPRMC,194509.000,A,4042.6142,N,07400.4168,W,2.03,221.11,160412,,,A*77\r\n"
+  "$GPVTG,221.11,T,,M,2.03,N,3.77,K,A*3E\r\n";
+
+static volatile uint32_t sink;
+
+static uint32_t parsedecimal(const char *str) {
+  uint32_t d = 0;
+  while ((*str >= '0') && (*str <= '9')) d = d * 10 + (*str++ - '0');
+  return d;
+}
+
+// What the sketches did before nmea.h: collect a line, then check it and
+// pick the RMC fields out of it. Returns the number of good sentences.
+static long oldWay(const char *log, size_t n) {
+  char buffer[90];
+  int  idx = 0;
+  long good = 0;
+  for (size_t i = 0; i < n; i++) {
+    char c = log[i];
+    if (c == '\n') continue;
+    if ((idx < (int)sizeof(buffer) - 1) && (c != '\r')) {
+      buffer[idx++] = c;
+      continue;
+    }
+    buffer[idx] = 0;
+    idx = 0;
+    char *star = strchr(buffer, '*');
+    if ((buffer[0] != '$') || !star) continue;
+    uint8_t sum = 0;
+    for (char *b = buffer + 1; b < star; b++) sum ^= *b;
+    if (strtol(star + 1, NULL, 16) != sum) continue;
+    good++;
+    if (strncmp(buffer, "$GPRMC", 6)) continue;
+    char *q = buffer + 7;
+    uint32_t time = parsedecimal(q);
+    q = strchr(q, ',') + 1;
+    uint32_t lat = parsedecimal(q + 2) * 10000;
+    q = strchr(q, '.') + 1;
+    lat += parsedecimal(q);
+    q = strchr(strchr(q, ',') + 1, ',') + 1;
+    uint32_t lon = parsedecimal(q) * 10000;
+    q = strchr(q, '.') + 1;
+    lon += parsedecimal(q);
+    q = strchr(strchr(q, ',') + 1, ',') + 1;
+    uint32_t speed = parsedecimal(q);
+    for (int f = 0; f < 3; f++) q = strchr(q, ',') + 1;
+    sink = time + lat + lon + speed + parsedecimal(q);
+  }
+  return good;
+}
+
+// Sentences per second through nmea.h and the old way
+static void throughput(const std::vector<char> &log, bool clean) {
+  long sentences = 0;
+  for (size_t i = 0; i < log.size(); i++) sentences += (log[i] == '$');
+
+  NmeaParser q;
+  long    rounds = 0;
+  clock_t start = clock();
+  do {
+    for (size_t i = 0; i < log.size(); i++) sink = q.feed(log[i]);
+    rounds++;
+  } while (clock() - start < CLOCKS_PER_SEC / 2);
+  double newRate = (double)sentences * rounds * CLOCKS_PER_SEC / (clock() - start);
+  if (clean) {
+    check(q.good == (uint32_t)(sentences * rounds) && !q.bad, "every logged sentence good",
+          "built-in log\n");
+  }
+
+  long oldGood = 0, oldRounds = 0;
+  start = clock();
+  do {
+    oldGood = oldWay(&log[0], log.size());
+    oldRounds++;
+  } while (clock() - start < CLOCKS_PER_SEC / 2);
+  double oldRate = (double)sentences * oldRounds * CLOCKS_PER_SEC / (clock() - start);
+
+  printf("%ld sentences, %ld good: %.2fM sentences/s (%.1f MB/s); old way, RMC "
+         "fields only: %.2fM/s, %ld good\n", sentences, (long)(q.good / rounds),
+         newRate / 1e6, newRate * log.size() / sentences / 1e6, oldRate / 1e6, oldGood);
+}
+
+int main(int argc, char **argv) {
+  NmeaParser p;
+
+  check(feed(p, RMC) == NMEA_RMC, "good RMC", RMC);
+  check(p.rmc.time == 194509000 && p.rmc.date == 160412 && p.rmc.fix &&
+        p.rmc.lat == 40 * 600000 + 426142 && p.rmc.lon == -(74 * 600000 + 4168) &&
+        p.rmc.speed == 203 && p.rmc.course == 22111, "RMC fields", RMC);
+  check(feed(p, GGA) == NMEA_GGA, "good GGA", GGA);
+  check(p.gga.time == 123519000 && p.gga.lat == 48 * 600000 + 70380 &&
+        p.gga.lon == 11 * 600000 + 310000 && p.gga.altitude == 5454 &&
+        p.gga.hdop == 90 && p.gga.quality == 1 && p.gga.satellites == 8,
+        "GGA fields", GGA);
+
+  // Each of these must come back NMEA_BAD and leave rmc alone
+  char overlong[120];
+  sprintf(overlong, "%.*s,0123456789*00\r\n", 68, RMC);
+  const char *bad[] = {
+    "$GPRMC,194509.000,A,4042.6142,N,07400.4168,W,2.03,221.11,160412,,,A*78\r\n",
+    "$GPRMC,194509.000,A,4042.6142,N,07400.4168,W,2.03,221.11,160412,,,A*7\r\n",
+    "$GPRMC,194509.000,A,4042.6142,N,07400.4168,W,2.03,221.11,160412,,,A\r\n",
+    "$GPRMC,194509.000,A,4042.6142,N,07400.4168,W,2.03,221.11,160412,,,A*7g\r\n",
+    "$GPRMC,194509.000,A,4042.6142,N,07400.4168,W,2.03,221.11,160412,,,A*G7\r\n",
+    overlong,
+    "$O*BZ\r\n",   // sum 0xFF: a non-hex low digit used to match hex()'s 0xFF
+    "$O*ZF\r\n",
+    "$O*B\r\n",
+  };
+  NmeaRMC saved = p.rmc;
+  for (unsigned i = 0; i < sizeof bad / sizeof bad[0]; i++) {
+    check(feed(p, bad[i]) == NMEA_BAD, "rejected", bad[i]);
+    check(!memcmp(&saved, &p.rmc, sizeof saved), "last good fix kept", bad[i]);
+  }
+  check(feed(p, RMC) == NMEA_RMC, "good RMC after bad ones", RMC);
+
+  // Every single-character corruption of the good sentences
+  static const char *good[] = { RMC, GGA };
+  const char alphabet[] = "0123456789ABCDEFabcdefGPRMCZ$*,.-\r\n \xff";
+  long tried = 0, slipped = 0;
+  for (unsigned g = 0; g < 2; g++) {
+    size_t n = strlen(good[g]);
+    for (size_t i = 0; i < n; i++) {
+      for (const char *a = alphabet; *a; a++) {
+        char s[100];
+        strcpy(s, good[g]);
+        if (s[i] == *a) continue;
+        s[i] = *a;
+        NmeaParser q;
+        uint8_t r = feed(q, s);
+        bool valid = (r == NMEA_RMC) || (r == NMEA_GGA) || (r == NMEA_OTHER);
+        tried++;
+        if (valid) slipped++;
+        check(valid == checksumOk(s), "corrupted sentence", s);
+      }
+    }
+  }
+  printf("%ld corrupted sentences, %ld still had a valid checksum\n",
+         tried, slipped);
+
+  std::vector<char> log;
+  if (argc > 1) {
+    FILE *f = fopen(argv[1], "rb");
+    if (!f) {
+      printf("can't open %s\n", argv[1]);
+      return 1;
+    }
+    int c;
+    while ((c = fgetc(f)) != EOF) log.push_back(c);
+    fclose(f);
+  } else {
+    for (int i = 0; i < 1000; i++) log.insert(log.end(), EPOCH, EPOCH + strlen(EPOCH));
+  }
+  throughput(log, argc < 2);
+
+  return failures ? 1 : 0;
+}
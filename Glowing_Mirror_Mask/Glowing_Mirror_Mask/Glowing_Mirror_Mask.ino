@@ -7,6 +7,7 @@
 #include <Adafruit_ST7735.h>
 #include <Adafruit_NeoPixel.h>
 #include <FastLED.h>
+#include "PaletteWaves.h"
 
 // Enable ONE of these lines to select an animation,
 // others MUST be commented out!
@@ -32,12 +33,31 @@ uint8_t updates_per_second = 30;
 CRGBPalette16 currentPalette;
 TBlendType    currentBlending;
 
+// Color waves with an ever-changing, widely-varying set of parameters,
+// drawn from a color palette (see PaletteWaves.h)
+PaletteWaves waves;
+
 Adafruit_ST7735 tft = Adafruit_ST7735(TFT_CS,  TFT_DC, TFT_RST);
 
+// The animation headers hold only the pixels that change from frame to
+// frame (see frames2spans.py). They're sent a run at a time with DMA, and
+// the next run is started from loop(), so the LED strip gets drawn and
+// shown on its own clock in between instead of after a blocking transfer.
+int16_t  imgX, imgY;         // Top left of the animation on screen
+uint8_t  frameNum = 0;       // Frame on screen, or being sent
+uint32_t spanPos, spanEnd;   // Next run to send, end of this frame's runs
+bool     sending = false;    // Frame transfer in progress
+uint32_t frameTime, ledTime; // millis() at last TFT and LED frame
+
+// Frame rates and the share of loop() time with nothing to do
+uint32_t statsTime, tftFrames = 0, ledFrames = 0, idleMicros = 0;
+
 void setup(void) {
   tft.initR(INITR_144GREENTAB);
   tft.setRotation(2);  // change between 0-3 to set the rotation of the image on the screen 
   tft.fillScreen(0);  // screen background brightness
+  imgX = (tft.width()  - IMG_WIDTH ) / 2;
+  imgY = (tft.height() - IMG_HEIGHT) / 2;
 
   pinMode(TFT_BACKLIGHT, OUTPUT);
   digitalWrite(TFT_BACKLIGHT, HIGH);
@@ -52,83 +72,79 @@ FastLED.setBrightness(brightness);
   //currentPalette = RainbowStripeColors_p;
   //currentPalette = ForestColors_p;
   //currentPalette = OceanColors_p;
-}
 
-uint8_t frameNum = 0;
+  // Draw the first frame in full, then animate from there
+  startFrame(IMG_FRAMES);
+  while(sending) sendNextRun();
+  frameTime = ledTime = statsTime = millis();
+}
 
 void loop() {
-    tft.startWrite();
-  tft.setAddrWindow(
-    (tft.width()  - IMG_WIDTH ) / 2,
-    (tft.height() - IMG_HEIGHT) / 2,
-    IMG_WIDTH, IMG_HEIGHT);
-  tft.writePixels((uint16_t *)frames[frameNum], IMG_WIDTH * IMG_HEIGHT);
-  tft.endWrite();
-  delay(IMG_DELAY);
-  if(++frameNum >= IMG_FRAMES) frameNum = 0;
-
-  colorwaves( leds, NUM_LEDS, currentPalette);
-
-  FastLED.show();
+  uint32_t start = micros();
+  uint32_t now = millis();
+  bool     busy = false;
+
+  if(!sending && (now - frameTime >= IMG_DELAY)) {
+    frameTime = now;
+    if(++frameNum >= IMG_FRAMES) frameNum = 0;
+    startFrame(frameNum);
+  }
+  if(sending && !tft.dmaBusy()) {
+    sendNextRun();
+    busy = true;
+  }
+
+  // LEDs on their own clock. Only between runs, so the strip's bit timing
+  // isn't competing with a DMA transfer for the bus.
+  if((now - ledTime >= 1000 / updates_per_second) && !tft.dmaBusy()) {
+    ledTime = now;
+    waves.draw( leds, NUM_LEDS, currentPalette);
+    FastLED.show();
+    ledFrames++;
+    busy = true;
+  }
+
+  if(!busy) idleMicros += micros() - start;
+
+  if(now - statsTime >= 5000) {
+    uint32_t elapsed = now - statsTime;
+    Serial.print("TFT fps: ");    Serial.print(tftFrames * 1000.0 / elapsed);
+    Serial.print("  LED fps: ");  Serial.print(ledFrames * 1000.0 / elapsed);
+    Serial.print("  CPU idle: "); Serial.print(idleMicros / (elapsed * 10.0));
+    Serial.println("%");
+    statsTime = now;
+    tftFrames = ledFrames = idleMicros = 0;
+  }
 }
 
+// Begin sending run list 'list' from the animation header
+void startFrame(uint8_t list) {
+  spanPos = frameSpans[list];
+  spanEnd = frameSpans[list + 1];
+  tft.startWrite();
+  sending = true;
+}
 
-void FillLEDsFromPaletteColors(uint8_t colorIndex) {
-  for (int i = 0; i < NUM_LEDS; i++) {
-    leds[i] = ColorFromPalette( currentPalette, colorIndex, brightness, currentBlending);
-    colorIndex += indexinc;
+// Start the DMA transfer of the next run, or finish the frame
+void sendNextRun() {
+  tft.dmaWait(); // Wraps up the previous run's transfer
+  if(spanPos >= spanEnd) {
+    tft.endWrite();
+    sending = false;
+    tftFrames++;
+    return;
   }
+  uint16_t xy  = spans[spanPos];
+  uint16_t len = spans[spanPos + 1];
+  tft.setAddrWindow(imgX + (xy & 0xFF), imgY + (xy >> 8), len, 1);
+  tft.writePixels((uint16_t *)&spans[spanPos + 2], len, false, true);
+  spanPos += 2 + len;
 }
 
-// This function draws color waves with an ever-changing,
-// widely-varying set of parameters, using a color palette.
-void colorwaves( CRGB* ledarray, uint16_t numleds, CRGBPalette16& palette) 
-{
-  static uint16_t sPseudotime = 0;
-  static uint16_t sLastMillis = 0;
-  static uint16_t sHue16 = 0;
- 
-  uint8_t sat8 = beatsin88( 87, 220, 250);
-  uint8_t brightdepth = beatsin88( 341, 96, 224);
-  uint16_t brightnessthetainc16 = beatsin88( 203, (25 * 256), (40 * 256));
-  uint8_t msmultiplier = beatsin88(147, 23, 60);
 
-  uint16_t hue16 = sHue16;//gHue * 256;
-  uint16_t hueinc16 = beatsin88(113, 300, 1500);
-  
-  uint16_t ms = millis();
-  uint16_t deltams = ms - sLastMillis ;
-  sLastMillis  = ms;
-  sPseudotime += deltams * msmultiplier;
-  sHue16 += deltams * beatsin88( 400, 5,9);
-  uint16_t brightnesstheta16 = sPseudotime;
-  
-  for( uint16_t i = 0 ; i < numleds; i++) {
-    hue16 += hueinc16;
-    uint8_t hue8 = hue16 / 256;
-    uint16_t h16_128 = hue16 >> 7;
-    if( h16_128 & 0x100) {
-      hue8 = 255 - (h16_128 >> 1);
-    } else {
-      hue8 = h16_128 >> 1;
-    }
-
-    brightnesstheta16  += brightnessthetainc16;
-    uint16_t b16 = sin16( brightnesstheta16  ) + 32768;
-
-    uint16_t bri16 = (uint32_t)((uint32_t)b16 * (uint32_t)b16) / 65536;
-    uint8_t bri8 = (uint32_t)(((uint32_t)bri16) * brightdepth) / 65536;
-    bri8 += (255 - brightdepth);
-    
-    uint8_t index = hue8;
-    //index = triwave8( index);
-    index = scale8( index, 240);
-
-    CRGB newcolor = ColorFromPalette( palette, index, bri8);
-
-    uint16_t pixelnumber = i;
-    pixelnumber = (numleds-1) - pixelnumber;
-    
-    nblend( ledarray[pixelnumber], newcolor, 128);
+void FillLEDsFromPaletteColors(uint8_t colorIndex) {
+  for (int i = 0; i < NUM_LEDS; i++) {
+    leds[i] = ColorFromPalette( currentPalette, colorIndex, brightness, currentBlending);
+    colorIndex += indexinc;
   }
 }
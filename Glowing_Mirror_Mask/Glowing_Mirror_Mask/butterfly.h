@@ -3,8461 +3,5260 @@
 #define IMG_FRAMES 7
 #define IMG_DELAY  50
 
-const uint16_t frames[IMG_FRAMES][IMG_WIDTH * IMG_HEIGHT] = {
-  { 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6AA3, 0x9CE5, 0xCD85,
-    0x9CE5, 0x6CA6, 0x1842, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2042, 0x9AA3,
-    0x9CE5, 0xD585, 0x9CE5, 0x6AA3, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x64A6, 0xA6A7, 0xCF26,
-    0xCF26, 0xFF25, 0xCE86, 0xD686, 0xA2A3, 0x3242, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3242, 0x9AA3, 0xCC64,
-    0xF565, 0xFE65, 0xFE65, 0xFE85, 0xD565, 0x64A6, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xAEC7, 0xA6A7, 0xD726,
-    0xCF26, 0xF725, 0xCF26, 0xFF25, 0xF725, 0xF725, 0xFE65, 0xFE65,
-    0xCB84, 0x1842, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x1842, 0xA2A3, 0xFC85, 0xFC65, 0xFD85,
-    0xF565, 0xFD85, 0xFD65, 0xFE85, 0xF665, 0xF725, 0xFE65, 0xCE66,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8667, 0xD726, 0xCF26,
-    0xCF26, 0xF725, 0xFF25, 0xF725, 0xF725, 0xF725, 0xFF25, 0xF725,
-    0xFE65, 0xFE65, 0xFD85, 0xFD65, 0x3242, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x5084, 0xF365, 0xF365, 0xFC65, 0xF485, 0xFC65,
-    0xF485, 0xFD65, 0xFD85, 0xFD65, 0xF565, 0xFE65, 0xFE65, 0xFF25,
-    0xFE85, 0xCD65, 0x0000, 0x0000, 0x0000, 0x3222, 0xA6C7, 0xD726,
-    0xCF26, 0xF725, 0xCF26, 0xFF25, 0xF725, 0xF725, 0xFE65, 0xFE65,
-    0xFE65, 0xFE65, 0xF565, 0xFD85, 0xFD65, 0xFD85, 0xCC64, 0x62A3,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x90C4, 0xE9C5, 0xF285, 0xEA85, 0xF365, 0xFB65, 0xF365,
-    0xF365, 0xFC65, 0xF485, 0xFD65, 0xFD85, 0xFD65, 0xF585, 0xFE65,
-    0xFE65, 0xFE65, 0xF665, 0x1842, 0x0000, 0x0000, 0x64A6, 0xCF26,
-    0xCF26, 0xF725, 0xD666, 0xF725, 0xF725, 0xFF25, 0xF725, 0xF725,
-    0xF665, 0xFE85, 0xFD65, 0xFD85, 0xF565, 0xFD85, 0xFC65, 0xF485,
-    0xFB65, 0xFC85, 0x62A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x90C4, 0xE1C5, 0xE9C5, 0xF265, 0xE9C5, 0xEA85, 0xF265, 0xF365,
-    0xF365, 0xFC85, 0xF365, 0xF465, 0xFC85, 0xFD65, 0xF585, 0xFD65,
-    0xFD65, 0xFE65, 0xFE85, 0xFF25, 0x9AA3, 0x0000, 0x0000, 0xAEC7,
-    0xCF26, 0xFF25, 0xCD65, 0x0000, 0x9CE5, 0xF725, 0xFE65, 0xF725,
-    0xFE65, 0xFE65, 0xFD65, 0xFD85, 0xFD65, 0xF585, 0xFC65, 0xF485,
-    0xF365, 0xFB65, 0xF365, 0xF365, 0xF265, 0x62A3, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x90C4,
-    0xE906, 0xE165, 0xE165, 0xE9C5, 0xE9C5, 0xE9C5, 0xE9C5, 0xEA85,
-    0xF265, 0xF365, 0xF365, 0xF365, 0xF365, 0xFC85, 0xFC65, 0xF585,
-    0xFD65, 0x62A3, 0x0000, 0xFE85, 0xFE65, 0xCD65, 0x0000, 0x62A3,
-    0xD686, 0xF725, 0xF725, 0xFF25, 0x64A6, 0xCC64, 0xCD65, 0xF725,
-    0xFE85, 0xD464, 0x1842, 0xFD85, 0x62A3, 0xCC64, 0xF485, 0xFC65,
-    0xF365, 0xFC85, 0xF365, 0xF365, 0xF265, 0xF285, 0xE9C5, 0xCA64,
-    0x5084, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x90E4, 0xE108,
-    0xE906, 0xE165, 0xE106, 0xE165, 0xE145, 0xE9C5, 0xE9C5, 0xEA65,
-    0xE9C5, 0xF285, 0xEA65, 0xF285, 0xCB84, 0x62A3, 0xF365, 0xFC65,
-    0xFC85, 0xFD65, 0x62A3, 0x62A3, 0xFD65, 0xFE65, 0xD686, 0x62A3,
-    0x62A3, 0xD726, 0xCF26, 0xFF25, 0xF725, 0xF725, 0xD686, 0x0000,
-    0xCC64, 0xFE65, 0x62A3, 0x0000, 0x9AA3, 0x9AA3, 0x0000, 0x62A3,
-    0xFB65, 0xFB65, 0xEA85, 0xF285, 0xEA65, 0xF285, 0xE9C5, 0xE9C5,
-    0xE1A6, 0xE9C5, 0xC165, 0x5084, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5884, 0xC88A, 0xE8C8,
-    0xE0C8, 0xE0E7, 0xE0E7, 0xE906, 0xE106, 0xE165, 0xC185, 0xE945,
-    0xE1A6, 0xE9C5, 0x1842, 0x0000, 0xC185, 0x62A3, 0x0000, 0xCB84,
-    0xFB65, 0x9AC3, 0x5884, 0xFD85, 0xFD65, 0xFD85, 0xFD65, 0xFE85,
-    0x62A3, 0x9CE5, 0xD746, 0xF725, 0xF725, 0xF725, 0x0000, 0x3222,
-    0xFE65, 0xFE65, 0xFE65, 0xFD85, 0x0000, 0x3242, 0xCB84, 0x0000,
-    0x0000, 0xF365, 0xFB65, 0xF365, 0x90C4, 0xCA84, 0xE9C5, 0xE9C5,
-    0xE1A6, 0xE9C5, 0xE145, 0xE165, 0xE926, 0xE906, 0x1842, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x5884, 0xE0AA, 0xE0A8, 0xE0AA,
-    0xE8C8, 0xE0E7, 0xE0E7, 0xE0E7, 0xE8E7, 0xE906, 0x90E4, 0x90C4,
-    0xE165, 0xE9C5, 0xC965, 0x0000, 0x5884, 0xCA64, 0x0000, 0x1842,
-    0xF365, 0xFC65, 0xF365, 0xD484, 0x1842, 0x9AA3, 0xF565, 0xFE85,
-    0xFD65, 0xCC64, 0x9CE5, 0xF725, 0xFF25, 0xF725, 0xF725, 0x9CE5,
-    0x0000, 0x3222, 0xFD65, 0xFE85, 0xFD65, 0xFD65, 0xCB84, 0xFC85,
-    0x9AA3, 0x0000, 0x9AA3, 0x90E4, 0xF285, 0xF265, 0x5084, 0x90C4,
-    0xE965, 0xE9C5, 0xE145, 0xE965, 0xE106, 0xE106, 0xE0E7, 0xE8E7,
-    0xC0C6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x1842, 0xC8AA, 0xE8AC, 0xE0AA, 0xE0AA,
-    0xE0C8, 0xE8AA, 0xE0A8, 0xE0C8, 0xE0A8, 0xE8E7, 0x5084, 0x90E4,
-    0xE906, 0x90E4, 0x5884, 0x98C4, 0x0000, 0xC185, 0xC165, 0x98E4,
-    0xF285, 0xF365, 0xF365, 0xFB65, 0x0000, 0x0000, 0xCB84, 0xFD65,
-    0xF585, 0xFE65, 0x9CE5, 0xA6C7, 0xF725, 0xFF25, 0xF725, 0xF725,
-    0xD686, 0x64A6, 0x62A3, 0xCD65, 0xFD85, 0xFD65, 0xF485, 0xFC65,
-    0xFC85, 0xFC85, 0x90C4, 0x62A3, 0x0000, 0xCA64, 0xE9C5, 0xE9C5,
-    0x0000, 0x5884, 0xE165, 0xE165, 0xE106, 0xE906, 0xE0E7, 0xE0E7,
-    0xE0C8, 0xE8A8, 0xE8C8, 0x5884, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x588B, 0xE0AC, 0xE0AC, 0xE0AC, 0xE8AC,
-    0xE0AA, 0xE108, 0xE0AA, 0xE0AA, 0xE8C8, 0xE8E7, 0x1842, 0x5884,
-    0xE0E7, 0xE906, 0x5884, 0x5884, 0x5884, 0x5064, 0xE1C5, 0xE9C5,
-    0xE9C5, 0xF285, 0xEA85, 0xFB65, 0xCA64, 0x9AA3, 0x62A3, 0xFC65,
-    0xF485, 0xFD65, 0xFD85, 0xCC64, 0x9CE5, 0xFF25, 0xF725, 0xF725,
-    0xFE65, 0xFE65, 0xCD65, 0xCC64, 0xCD85, 0xFD65, 0x9AA3, 0x62A3,
-    0x6AA3, 0xFB65, 0xF365, 0xF365, 0xF285, 0x0000, 0xC165, 0x90E4,
-    0x90C4, 0xE9A6, 0x90E4, 0xC185, 0x1842, 0xE906, 0xE8E7, 0xE0E7,
-    0xE8C8, 0xE0A8, 0xE0C8, 0xE0AA, 0xE8AA, 0x986B, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x988B, 0xE8AC, 0xE0AE, 0xE0AC, 0xE8AC,
-    0xE0AC, 0xE0AC, 0xE0AA, 0xE8AA, 0x986B, 0x90E4, 0xC0C6, 0x90C4,
-    0xE8C8, 0xC0C6, 0x90C4, 0x5884, 0x0000, 0xE965, 0xE145, 0xE965,
-    0xC165, 0x90E4, 0x5884, 0xCA64, 0xF285, 0xCA64, 0xCA64, 0xF365,
-    0xFC65, 0xF485, 0xFC65, 0xFD85, 0xCB84, 0x64A6, 0xF725, 0xF725,
-    0xF725, 0xFF25, 0xFE65, 0x3242, 0x62A3, 0xFD65, 0xD585, 0x9AC3,
-    0x9AA3, 0x9AC3, 0xFB65, 0xCA64, 0x5064, 0xF285, 0xE9C5, 0xE9C5,
-    0x90E4, 0x0000, 0xC165, 0xE965, 0xC0C6, 0x5884, 0xC0C6, 0x1842,
-    0x90C4, 0xE8AA, 0xE0C8, 0xE0AA, 0xE0AA, 0xE8AC, 0xE0AA, 0xC88A,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0xC8AE, 0xE0AE, 0xE8AE, 0xE0AE, 0xE0AE,
-    0xE0AC, 0xE8AE, 0xE8AC, 0x986B, 0x5884, 0xC0C6, 0x1842, 0xE0C8,
-    0xE8C8, 0xE0E7, 0x0000, 0xC0C6, 0xC0C6, 0xE106, 0xE906, 0x90E4,
-    0xC965, 0xC185, 0x5884, 0x5084, 0xC165, 0xF265, 0xF285, 0x5884,
-    0x9AA3, 0xF485, 0xFC65, 0xF585, 0xFC65, 0x62A3, 0x1842, 0xD686,
-    0xFF25, 0xFF25, 0xFE65, 0xFE65, 0x9AA3, 0x0000, 0xF465, 0xFC85,
-    0x0000, 0x0000, 0x0000, 0x5064, 0x90E4, 0x0000, 0x98C4, 0xC185,
-    0xE9C5, 0xE945, 0x0000, 0x0000, 0xE106, 0xE126, 0xE8E7, 0xE0E7,
-    0xE0C8, 0xE0E7, 0xE8A8, 0xE0AA, 0xE0AA, 0xE0AC, 0xE8AA, 0xE0AC,
-    0xE0AC, 0xC8AE, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0xC88E, 0xE8AE, 0xE0B0, 0xE0AE, 0xE0AE,
-    0xE8AE, 0xE0AE, 0xE0AC, 0xE0AC, 0xC88A, 0xE8AC, 0xE0AA, 0xE0AA,
-    0xE0AA, 0xE8C8, 0x0000, 0x0000, 0xC88A, 0xE0E7, 0xC0C6, 0x90E4,
-    0x0000, 0x90E4, 0x0000, 0x0000, 0x0000, 0x5884, 0xE9C5, 0xCA64,
-    0x0000, 0xFB65, 0xF365, 0xFC85, 0xF465, 0xCC84, 0x0000, 0x0000,
-    0x62A3, 0xF725, 0xF665, 0xFE65, 0xFE85, 0xFD65, 0x0000, 0xFD85,
-    0xFC85, 0x9AA3, 0x9AA3, 0xCA64, 0xCA64, 0xF285, 0xC185, 0xCA64,
-    0x1842, 0xE145, 0xE965, 0xC0C6, 0x0000, 0xC0C6, 0xE0E7, 0xE0E7,
-    0xE8C8, 0xC0C6, 0xC0C6, 0xC88A, 0x986B, 0xE0AC, 0xE0AC, 0xE8AC,
-    0xE0AC, 0xE0AE, 0xE8AE, 0xC8AE, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0xC8B1, 0xE0B0, 0xE0B0, 0xE0B0, 0xE0B0,
-    0xE0AE, 0xE0B0, 0xE8AE, 0xC88E, 0xC8AE, 0xE0AE, 0xC8AE, 0xE8AC,
-    0xE0AA, 0xE108, 0x0000, 0x0000, 0xC88A, 0xE908, 0x90C4, 0x98E4,
-    0x90C4, 0x90E4, 0xC8C6, 0x90C4, 0x98E4, 0x62A3, 0x5064, 0xF285,
-    0xC165, 0x0000, 0xF365, 0xFB65, 0xF365, 0xFC85, 0x3222, 0x0000,
-    0x0000, 0x0000, 0xD565, 0xFE65, 0xFE65, 0xFE65, 0xF565, 0xFD85,
-    0xFC65, 0xF485, 0xF365, 0xF365, 0x5864, 0x5884, 0xCA64, 0xE9C5,
-    0x90E4, 0x90C4, 0x5884, 0xC985, 0xE906, 0x90E4, 0x1842, 0xE8E7,
-    0xE0A8, 0xE8C8, 0x5084, 0x0000, 0x0000, 0x0000, 0x0000, 0xC88A,
-    0xE8AC, 0xE0AE, 0xE0AC, 0xE8AE, 0xE0AE, 0xC8AE, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x5084, 0x1842, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x2042, 0x5884, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0xD08E, 0xC8B1, 0xE8B0, 0xE0B0, 0xE0B0,
-    0xE0B0, 0xE0B0, 0xC8AE, 0x0000, 0x0000, 0x0000, 0x0000, 0x90C4,
-    0xE8AC, 0xE0AC, 0x988B, 0x0000, 0xC88A, 0xE8AA, 0xC0C6, 0x5084,
-    0x98E4, 0xC0C6, 0xE8E7, 0xE106, 0x5084, 0x98E4, 0xE945, 0xE9C5,
-    0xE9C5, 0xEA85, 0xE9C5, 0xEA85, 0xF265, 0xF365, 0xCB84, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x62A3, 0xF665, 0xFE85, 0xFD65, 0xFD85,
-    0xFC85, 0xCB84, 0x90C4, 0x9AA3, 0xF285, 0xCB84, 0xF285, 0x62A3,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x90C4, 0xE0E7, 0xE8E7,
-    0xE0C8, 0x90C4, 0x0000, 0xE8AA, 0xC0C6, 0x0000, 0x0000, 0x0000,
-    0x0000, 0xE0AC, 0xC8AE, 0xC88E, 0xE8AE, 0xE0B0, 0xE0B0, 0xB0D1,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xC8B1, 0xA8B1, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0xB0D1, 0xA8B1, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0xB0D1, 0xC8B1, 0xE0B0, 0xE0B0, 0xE0B0,
-    0xC8B1, 0xE0B0, 0xC8AE, 0x0000, 0x0000, 0x0000, 0x0000, 0xC88A,
-    0xE0AE, 0x0000, 0xC8AA, 0xE8AC, 0xC88A, 0xE8AC, 0x5884, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x5884, 0x90E4, 0xD127, 0xE106, 0xE945,
-    0x90E4, 0x90C4, 0xE1A6, 0xF285, 0xEA65, 0xFB65, 0xF365, 0x3242,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCD65, 0xFD65, 0xFD85,
-    0xFC65, 0x9AA3, 0x0000, 0x0000, 0x0000, 0x0000, 0x1842, 0xF285,
-    0xE1A6, 0x1842, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xC8C6,
-    0xE8C8, 0xE0A8, 0x988B, 0x0000, 0x0000, 0xC88A, 0xC88A, 0x0000,
-    0x0000, 0x0000, 0x1842, 0xD0AE, 0x988B, 0xA06B, 0xE0AE, 0xE0B0,
-    0xE0B0, 0x988B, 0x0000, 0x0000, 0x0000, 0x0000, 0x5884, 0xD0B1,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA8B1, 0x1842, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x608B, 0xD0B1, 0xC8B1, 0xC8B1, 0xD0B1,
-    0xA8D1, 0xC8B1, 0xA06B, 0x0000, 0x0000, 0x0000, 0x0000, 0xC8AE,
-    0xE8AE, 0x1842, 0x0000, 0xC88E, 0xE8AC, 0xE0AC, 0x90E4, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE8E7, 0xE0E7, 0x5084,
-    0x0000, 0x0000, 0x0000, 0x0000, 0xC965, 0xF285, 0xF285, 0xCA64,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3222, 0xFE65,
-    0xFD85, 0xFD85, 0x9AA3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0xCA64, 0xE9C5, 0x5084, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0xE108, 0xE0C8, 0xE8AA, 0x5084, 0x0000, 0x0000, 0xC88A,
-    0xE8AC, 0x5884, 0x0000, 0x0000, 0x0000, 0xC8AE, 0xD08E, 0x5884,
-    0xC8AE, 0xE0B0, 0xE0B0, 0x608B, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x986B, 0xA08B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x588B, 0xA06B, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x588B, 0xB0D1, 0xC8B1, 0xC8B1, 0xC88E,
-    0xA08B, 0xC8B1, 0xB0B1, 0x0000, 0x0000, 0x0000, 0x5084, 0xE0B0,
-    0xD0AE, 0x0000, 0x0000, 0x986B, 0xE0AE, 0xE8AE, 0xD0AE, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x1842, 0xE108, 0x90C4, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9AA3, 0xEA85, 0xF265,
-    0x1842, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0xD585, 0xFD65, 0xFC85, 0xCB84, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x1842, 0x90C4, 0x90C4, 0xE965, 0xE945, 0x5084, 0x0000, 0x0000,
-    0x1842, 0x2042, 0xC0C6, 0xE8AA, 0xE0AA, 0xE8AA, 0x1842, 0x0000,
-    0x0000, 0x588B, 0xD0AE, 0x986B, 0x0000, 0x0000, 0x0000, 0xA08B,
-    0xC8B1, 0x588B, 0xA06B, 0xC8B1, 0xC8B1, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x608B, 0x608B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x588B, 0x190B,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x90D1, 0xB0D1, 0xB0D1, 0x986B,
-    0xA08B, 0xC8B1, 0x986B, 0x0000, 0x0000, 0x0000, 0xA08B, 0xC8B1,
-    0x5884, 0x0000, 0x0000, 0x5884, 0xE8AE, 0xE0AE, 0xE0AC, 0x90C4,
-    0x0000, 0x1842, 0x0000, 0x0000, 0x5884, 0xE8AA, 0xE8C8, 0xC0C6,
-    0x90C4, 0x1842, 0x0000, 0x0000, 0x0000, 0x0000, 0xC985, 0xE9C5,
-    0xE9C5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0xFD85, 0xFC65, 0xF485, 0xFB65, 0x0000, 0x0000, 0x0000,
-    0x5884, 0x6AA3, 0x5884, 0x1842, 0x0000, 0xC185, 0xE126, 0xE906,
-    0xE0E7, 0xE108, 0xE0C8, 0xC88A, 0xC88A, 0xE0AC, 0xE8AA, 0xE0AC,
-    0xA08B, 0x0000, 0x986B, 0xE0AE, 0xE0AE, 0xE8B0, 0x988B, 0x0000,
-    0x0000, 0x608B, 0xC8B1, 0xC88E, 0xA08B, 0xD0B1, 0x90D1, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x78F1, 0x1842, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x190B, 0x6111,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x78D1, 0xB0D1, 0x90D1, 0x78F1,
-    0x88D1, 0xB0D1, 0x608B, 0x0000, 0x0000, 0x986B, 0xC8B1, 0xE0B0,
-    0xD0B1, 0x1842, 0x0000, 0xC8AE, 0xE0B0, 0xE0B0, 0xE0AE, 0xE8AE,
-    0xC88E, 0xE0AE, 0xE0AC, 0xE8AC, 0xC8AE, 0xE8AC, 0x986B, 0x0000,
-    0x98E4, 0xC0C6, 0xC0C6, 0x5084, 0x0000, 0x0000, 0x0000, 0xE9C5,
-    0xE9C5, 0x9AA3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x9AA3, 0xF485, 0xFC65, 0xF485, 0x1842, 0x0000,
-    0x98C4, 0x9AA3, 0x0000, 0x0000, 0x0000, 0x0000, 0x90E4, 0xE906,
-    0xE8E7, 0xE0E7, 0xE0C8, 0xE0A8, 0xC88A, 0x90E4, 0x0000, 0x5884,
-    0xC88A, 0xE8AE, 0xE0AC, 0xE8AE, 0x588B, 0x1842, 0xD0AE, 0xE0B0,
-    0xE0B0, 0x988B, 0x0000, 0x0000, 0xD08E, 0xC8B1, 0xA8D1, 0xB0B1,
-    0x588B, 0x0000, 0x0000, 0x0000, 0x608B, 0x78F1, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x608B,
-    0x190B, 0x0000, 0x0000, 0x0000, 0x210B, 0x90D1, 0x78F1, 0x90D1,
-    0x90D1, 0x88F1, 0x0000, 0x0000, 0x608B, 0xB0D1, 0xA8B1, 0xC8AE,
-    0x5884, 0xD0B1, 0xC8B1, 0xE0B0, 0xE0B0, 0xE0B0, 0x986B, 0x98E4,
-    0x986B, 0xE8AE, 0xE0AC, 0xE8AE, 0xE0AC, 0xE0AC, 0xE0AA, 0x5884,
-    0x0000, 0x0000, 0x0000, 0x5884, 0x90E4, 0x5884, 0x0000, 0x98C4,
-    0xE965, 0xE9C5, 0x90C4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x62A3, 0xFC65, 0xFC85, 0xFB65, 0x6AA3,
-    0x1842, 0xCA64, 0x0000, 0x0000, 0x0000, 0x0000, 0x90E4, 0xE106,
-    0xE0E7, 0xE8E7, 0x90E4, 0xE0A8, 0xE0C8, 0xE108, 0xE8AA, 0xC88A,
-    0x0000, 0x0000, 0x1842, 0xE8AE, 0xE8AE, 0x90E4, 0x0000, 0x0000,
-    0x5884, 0xE0B0, 0xC8B1, 0xE0B0, 0xA06B, 0x90E4, 0xA8D1, 0xD0B1,
-    0x90D1, 0xB0B1, 0x1842, 0x0000, 0x0000, 0x2042, 0x608B, 0x1842,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x210B,
-    0x608B, 0x0000, 0x0000, 0x0000, 0x1842, 0x78F1, 0x78D1, 0x78F1,
-    0x78D1, 0x78F1, 0x1842, 0x78F1, 0x90D1, 0xB0B1, 0xA8D1, 0xA06B,
-    0x0000, 0x0000, 0x988B, 0xE0B0, 0xC8B1, 0x5884, 0x0000, 0x0000,
-    0x988B, 0xE0B0, 0xE0AE, 0xE8AE, 0xE0AC, 0xC88A, 0xE0AC, 0xE0AC,
-    0xE8AA, 0x0000, 0x0000, 0x0000, 0x0000, 0x5884, 0x90E4, 0x0000,
-    0xC0C6, 0xE9A6, 0xE9C5, 0x5084, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x1842, 0xFC85, 0xF365, 0xFB65,
-    0xCA64, 0x9AA3, 0x5084, 0x0000, 0x0000, 0x0000, 0x0000, 0xE906,
-    0xE108, 0xE0E7, 0x90E4, 0xC0C6, 0x0000, 0x5884, 0xE8AA, 0xE0AC,
-    0xE8AC, 0xE0AC, 0x1842, 0x0000, 0x5884, 0xE0B0, 0xE8AE, 0xC88E,
-    0x0000, 0x0000, 0x0000, 0xC8B1, 0xC8B1, 0xC8B1, 0xA08B, 0xA8B1,
-    0xB0D1, 0x88D1, 0x608B, 0x78F1, 0x0000, 0x0000, 0x0000, 0x608B,
-    0x190B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x190B, 0x608B, 0x0000, 0x0000, 0x0000, 0x6911, 0x6111, 0x608B,
-    0x6111, 0x78D1, 0x78F1, 0x78D1, 0x90D1, 0x90F1, 0x90D1, 0x1842,
-    0x0000, 0x0000, 0xA08B, 0xC8B1, 0xC8B1, 0x608B, 0x0000, 0x1842,
-    0xE8B0, 0xE0B0, 0xE8AE, 0xE0B0, 0x5084, 0x608B, 0x988B, 0xD08E,
-    0xE0AC, 0xE8AC, 0x988B, 0x0000, 0x0000, 0x0000, 0x0000, 0x90C4,
-    0x5884, 0xE906, 0xE126, 0xE165, 0x1842, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFC65, 0xFC85,
-    0xF365, 0xFB65, 0xD284, 0x1842, 0x0000, 0x0000, 0x0000, 0x5084,
-    0xE106, 0xE106, 0xE8E7, 0xC8C6, 0x1842, 0x0000, 0x0000, 0x5084,
-    0xE8AC, 0xE0AE, 0xE0AC, 0xE8AE, 0x5884, 0x5884, 0xE0B0, 0xE0B0,
-    0xE0B0, 0xE0B0, 0xC8AE, 0x5884, 0x0000, 0xD0B1, 0xB0D1, 0x1842,
-    0x0000, 0x88D1, 0x90F1, 0x90D1, 0x78F1, 0x608B, 0x0000, 0x0000,
-    0x2042, 0x4931, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x5151, 0x1842, 0x0000, 0x0000, 0x608B, 0x4931, 0x4951,
-    0x6111, 0x6911, 0x6111, 0x210B, 0x190B, 0x88D1, 0x78D1, 0x0000,
-    0x0000, 0x78F1, 0xB0B1, 0xA8D1, 0xB0B1, 0xC8B1, 0x0000, 0x608B,
-    0xC8B1, 0xE0B0, 0xE0B0, 0xE8B0, 0x1842, 0x0000, 0x0000, 0x988B,
-    0xC8AE, 0xE0AE, 0xE8AC, 0xE8AC, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x5084, 0xE106, 0xE106, 0xE965, 0xE945, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF365,
-    0xF365, 0xF365, 0xF285, 0xEA65, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0xE106, 0xE8E7, 0xE0E7, 0xE0C8, 0x986B, 0x1842, 0x0000,
-    0x0000, 0x5884, 0xE8AC, 0xE8AE, 0xE0AE, 0xE0B0, 0xC8AE, 0xE0B0,
-    0xC88E, 0x988B, 0xD0B1, 0xC8B1, 0xC8B1, 0xD0B1, 0xA8B1, 0xB0D1,
-    0x88D1, 0x0000, 0x0000, 0x1842, 0x78F1, 0x78D1, 0x6911, 0x0000,
-    0x0000, 0x0000, 0x190B, 0x210B, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x190B, 0x210B, 0x0000, 0x0000, 0x0000, 0x4931, 0x4951,
-    0x5131, 0x6111, 0x2042, 0x0000, 0x0000, 0x78F1, 0x6111, 0x6111,
-    0x608B, 0x90D1, 0x90F1, 0x90D1, 0x588B, 0xB0D1, 0xB0D1, 0xA8B1,
-    0xC8B1, 0xE8B0, 0xC8B1, 0xE0B0, 0x1842, 0x0000, 0x0000, 0x1842,
-    0xA08B, 0xE8AE, 0xE0AC, 0xE8AC, 0xC88A, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x5084, 0xE8E7, 0xE106, 0xE126, 0xE906, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0xCB84, 0xFC85, 0xF365, 0xFB65, 0xE9C5, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x90E4, 0xE108, 0xE0A8, 0xE0AA, 0xE8AA, 0xE0AA,
-    0xD0AE, 0xC88A, 0x5084, 0xE0AC, 0xE8AE, 0xE0B0, 0xE0AE, 0xE0B0,
-    0xE0B0, 0xE0B0, 0xE0B0, 0xE0B0, 0xD0B1, 0xC8B1, 0xA8D1, 0xB0B1,
-    0xB0D1, 0xB0B1, 0x608B, 0x0000, 0x0000, 0x1842, 0x78F1, 0x6111,
-    0x608B, 0x0000, 0x0000, 0x210B, 0x190B, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x210B, 0x210B, 0x0000, 0x0000, 0x190B, 0x5151,
-    0x4931, 0x4951, 0x0000, 0x0000, 0x0000, 0x4931, 0x6111, 0x6111,
-    0x6111, 0x78D1, 0x78F1, 0x90F1, 0x90D1, 0xA8B1, 0xB0D1, 0xA8B1,
-    0xB0D1, 0xC8B1, 0xC8B1, 0xE0B0, 0xA06B, 0x0000, 0x588B, 0xC8AE,
-    0xE0AE, 0xE0B0, 0xE0AE, 0xE8AE, 0xE8AC, 0x5884, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x5084, 0xE108, 0xE0E7, 0xE165, 0xC0C6, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x9AA3, 0xF365, 0xF365, 0xF285, 0xEA65, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0xE0E7, 0xE8A8, 0xE0C8, 0xE0A8, 0xE0AA,
-    0xE8AA, 0xE0AC, 0xE0AC, 0xE0AC, 0xE8AC, 0xE0AE, 0xE0AE, 0xE0B0,
-    0xE0B0, 0xE0B0, 0xC8B1, 0xE0B0, 0xC8B1, 0xC8B1, 0xB0D1, 0xA8B1,
-    0xB0D1, 0xA8B1, 0x90D1, 0x90F1, 0x1842, 0x0000, 0x0000, 0x6111,
-    0x4931, 0x4951, 0x2042, 0x0000, 0x0000, 0x4931, 0x2042, 0x0000,
-    0x0000, 0x0000, 0x1842, 0x210B, 0x0000, 0x0000, 0x2042, 0x3191,
-    0x2991, 0x3191, 0x190B, 0x0000, 0x0000, 0x210B, 0x4951, 0x4931,
-    0x5151, 0x6111, 0x6911, 0x78F1, 0x78D1, 0x90D1, 0x90F1, 0xA8D1,
-    0xB0B1, 0xA8D1, 0xB0B1, 0xC8B1, 0xC8B1, 0xE0B0, 0xC8B1, 0xE8B0,
-    0xE0B0, 0xE0B0, 0xE0AE, 0xE0AE, 0xE8AC, 0xE0AC, 0x90E4, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x90C4, 0xE8C8, 0xE0E7, 0xE108, 0x90C4,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x5064, 0xF365, 0xF285, 0xF285, 0xE9C5, 0x90C4,
-    0x0000, 0x0000, 0x0000, 0x90E4, 0xE8E7, 0xC0C6, 0x0000, 0x90C4,
-    0x988B, 0xE0AA, 0xE8AC, 0xE0AC, 0xE0AC, 0xE0AE, 0xE8AE, 0xE0B0,
-    0xE0B0, 0xE0B0, 0xE0B0, 0xC8B1, 0xB0B1, 0xC8AE, 0xB0B1, 0xA8D1,
-    0xB0B1, 0xB0D1, 0x90F1, 0x90D1, 0x78D1, 0x78F1, 0x0000, 0x0000,
-    0x4951, 0x608B, 0x1842, 0x5131, 0x0000, 0x0000, 0x190B, 0x3191,
-    0x0000, 0x0000, 0x0000, 0x3191, 0x190B, 0x0000, 0x0000, 0x3191,
-    0x3191, 0x0000, 0x3191, 0x3191, 0x0000, 0x190B, 0x5151, 0x4931,
-    0x4931, 0x6111, 0x6111, 0x6111, 0x6111, 0x78F1, 0x78F1, 0x90D1,
-    0x90D1, 0xA8D1, 0xB0B1, 0xC8B1, 0xA8D1, 0xC8B1, 0xC8B1, 0xE0B0,
-    0xE0B0, 0xE0B0, 0xE0B0, 0xE8AE, 0x5884, 0x90E4, 0xE0AC, 0xE8AC,
-    0x0000, 0x0000, 0x0000, 0x0000, 0xC0C6, 0xE108, 0xE0E7, 0xE906,
-    0x5884, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x1842, 0xFA85, 0xF285, 0xE9C5, 0xE9C5,
-    0xE1A6, 0x90C4, 0x0000, 0x0000, 0x90E4, 0xE8E7, 0x1842, 0x0000,
-    0x0000, 0x0000, 0x986B, 0xE8AC, 0xE8AC, 0xC88A, 0xC8AA, 0xC8AE,
-    0x986B, 0x988B, 0x1842, 0x2042, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x1842, 0x78D1, 0x78F1, 0x78D1, 0x6911, 0x6111,
-    0x210B, 0x4931, 0x0000, 0x0000, 0x3191, 0x190B, 0x0000, 0x0000,
-    0x210B, 0x1842, 0x0000, 0x2042, 0x210B, 0x0000, 0x0000, 0x190B,
-    0x3191, 0x3191, 0x0000, 0x190B, 0x3191, 0x2042, 0x3191, 0x3191,
-    0x2991, 0x4951, 0x210B, 0x190B, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x5884, 0x2042, 0x608B, 0xA08B, 0xA8B1, 0xB0D1, 0xC8B1,
-    0xC88E, 0xE8B0, 0xE0B0, 0x988B, 0x0000, 0x0000, 0x0000, 0x986B,
-    0xE8AC, 0x5084, 0x0000, 0x0000, 0x98E4, 0xE8A8, 0xE0C8, 0xE0E7,
-    0xE8E7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF365, 0xEA65, 0xF285,
-    0xE9C5, 0xE9C5, 0xE165, 0xE145, 0xC0C6, 0xD127, 0xE8E7, 0xE0C8,
-    0xC8AA, 0xE0AA, 0xE0AA, 0xE8AC, 0xE0AC, 0xE8AE, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x608B, 0x6111,
-    0x6111, 0x6911, 0x4931, 0x2042, 0x0000, 0x4931, 0x3191, 0x0000,
-    0x0000, 0x0A0E, 0x210B, 0x0000, 0x190B, 0x09EE, 0x0000, 0x0000,
-    0x21F2, 0x1A53, 0x2042, 0x0000, 0x1842, 0x2212, 0x3191, 0x2212,
-    0x3191, 0x5131, 0x1842, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x588B, 0xE0B0, 0xE0B0, 0xE0B0, 0xE0B0, 0x988B, 0xC88E,
-    0xE8AE, 0xE8AE, 0x988B, 0x986B, 0xE0AA, 0xE0AA, 0xE8C8, 0xE0A8,
-    0xE0C8, 0xE106, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xC165, 0xF285,
-    0xE9C5, 0xE9C5, 0xE145, 0xE165, 0xE106, 0xE106, 0xE8E7, 0xE0C8,
-    0xE0C8, 0xE0AA, 0xE8A8, 0xE0AA, 0xE0AA, 0xE0AC, 0xE8AC, 0x988B,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x4931, 0x4931, 0x4951, 0x3191, 0x0000, 0x1842, 0x3191,
-    0x1842, 0x0000, 0x0000, 0x2212, 0x2212, 0x21F2, 0x0000, 0x0000,
-    0x2042, 0x1A53, 0x2212, 0x0000, 0x0000, 0x2212, 0x21F2, 0x2212,
-    0x3191, 0x1842, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0xB0B1, 0xE8B0, 0xC8B1, 0xE0B0, 0xE8AE, 0xE0B0,
-    0xE0AE, 0xE0AE, 0xE8AC, 0xE0AC, 0xE0AA, 0xE0AC, 0xE8C8, 0xE0AA,
-    0xE0A8, 0xE0E7, 0x90E4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x62A3,
-    0xF265, 0xEA85, 0xE9C5, 0xE9C5, 0xE165, 0xE145, 0xE8E7, 0xE0E7,
-    0xE0C8, 0xE0C8, 0xC88A, 0xE8AA, 0xE0AA, 0xE8AC, 0x988B, 0xE0AE,
-    0xE8AE, 0x608B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x608B, 0x3191, 0x4931, 0x3191, 0x0000,
-    0x3191, 0x2212, 0x0000, 0x09EE, 0x1A53, 0x1AB4, 0x1A53, 0x09EE,
-    0x0000, 0x1A53, 0x12D4, 0x09EE, 0x0000, 0x1AB4, 0x1A53, 0x1A53,
-    0x190B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x588B, 0xD0B1, 0xC8B1, 0x70D1, 0xE0B0, 0xE0B0,
-    0xE8AE, 0xE0AE, 0xE0AE, 0xE0AE, 0xE8AC, 0xE0AC, 0xE0AA, 0xE0AA,
-    0xE8C8, 0xE0AA, 0xE8A8, 0x5884, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x1842, 0xF285, 0xE9C5, 0xE9C5, 0xE145, 0xE145, 0xE108, 0xE8E7,
-    0xE0C8, 0xE0A8, 0x5084, 0x0000, 0x5884, 0xE8AC, 0xE8AC, 0xE0AC,
-    0xE0AE, 0xE0AE, 0xC8AE, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x190B, 0x3191, 0x3191,
-    0x09EE, 0x1842, 0x2212, 0x2042, 0x210B, 0x12B4, 0x12B4, 0x1AB4,
-    0x210B, 0x1842, 0x1AB4, 0x12B4, 0x0000, 0x1AB4, 0x12B4, 0x1AB4,
-    0x190B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x2042, 0xD0B1, 0xC8B1, 0xD0B1, 0xA8B1, 0xE0B0,
-    0xC8B1, 0x5884, 0x1842, 0xD0AE, 0xE8AE, 0xE0AE, 0xE8AC, 0xE0AC,
-    0xE0AA, 0xE0AA, 0xE8A8, 0xE0C8, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0xE9C5, 0xE9C5, 0xE1A6, 0xE1C6, 0xE106, 0xE906,
-    0xE0E7, 0xE108, 0xE0C8, 0xE8A8, 0x90E4, 0xE108, 0xE0AC, 0xE0AE,
-    0xE8AC, 0xE8AE, 0x986B, 0x988B, 0xE88E, 0x2042, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3191,
-    0x2212, 0x2212, 0x09EE, 0x120E, 0x09EE, 0x190B, 0x1AB4, 0x1356,
-    0x12B4, 0x2042, 0x1A53, 0x0B56, 0x2042, 0x0B33, 0x0B56, 0x1356,
-    0x210B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1842, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x1842, 0xB0B1, 0x588B, 0xD0B1, 0xC8B1, 0xE0B0,
-    0xE0B0, 0xE0B0, 0x988B, 0x986B, 0xE8AE, 0xE0AE, 0xE0AE, 0xE0AE,
-    0xE8AC, 0xE108, 0xE0AA, 0xE0AA, 0xC0C6, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x90E4, 0xE9C5, 0xE9C5, 0xE165, 0xE106,
-    0xC0C6, 0x5884, 0xE8C8, 0xE0A8, 0xE0C8, 0xE0AA, 0xE8AA, 0xE0AC,
-    0xE0AC, 0xE0AE, 0xE8AE, 0x986B, 0x988B, 0xE0B0, 0xB0B1, 0x5084,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1842, 0x3191,
-    0x3191, 0x2212, 0x2212, 0x09EE, 0x1A53, 0x1AB4, 0x0000, 0x12B4,
-    0x1356, 0x0B33, 0x0000, 0x0B56, 0x1356, 0x09EE, 0x1356, 0x1356,
-    0x1356, 0x12B4, 0x09EE, 0x2042, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x2042, 0x90F1, 0x90D1, 0x588B, 0xA08B, 0xC8B1,
-    0xC8B1, 0xE8B0, 0xE0B0, 0xE0B0, 0xE0AE, 0xE0B0, 0xE0AE, 0xE8AC,
-    0x5084, 0xE8AC, 0xE0AA, 0xE0AA, 0xE8C8, 0x5084, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE9C5, 0xE965, 0xE165,
-    0xE906, 0x90C4, 0x5884, 0x90E4, 0xC0C6, 0xE0AA, 0xE8AA, 0xE0AC,
-    0xE0AC, 0xE0AE, 0xE8AE, 0xE0AE, 0xE0AE, 0xE8B0, 0xD08E, 0x1842,
-    0x988B, 0xA06B, 0x2042, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x1842, 0x210B, 0x4931, 0x3191, 0x2991,
-    0x3191, 0x2212, 0x2212, 0x2042, 0x09EE, 0x1AB4, 0x12B4, 0x0B33,
-    0x1356, 0x0BF8, 0x1356, 0x0B56, 0x0BD8, 0x0BF8, 0x0BF8, 0x2042,
-    0x09EE, 0x0BD8, 0x1356, 0x1356, 0x12B4, 0x1AD4, 0x09EE, 0x1842,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x608B, 0x78D1, 0x190B, 0xB0D1, 0xA8B1, 0xC8B1,
-    0xC8B1, 0xE0B0, 0xC8B1, 0xE0B0, 0xE0B0, 0xE0B0, 0xE8AE, 0xE0AE,
-    0xA08B, 0x5884, 0x986B, 0xE0AC, 0xE0AA, 0xE8AA, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5084, 0xE945,
-    0xE106, 0xE126, 0xC0C6, 0x5084, 0x0000, 0x5884, 0xE8C8, 0xE8AA,
-    0xC88A, 0xE0AC, 0xE0AC, 0xC88A, 0x0000, 0xE0B0, 0xE0AE, 0x988B,
-    0x0000, 0x1842, 0xD0AE, 0xD0B1, 0xA8B1, 0xB0D1, 0x986B, 0x90D1,
-    0x588B, 0x608B, 0x608B, 0x6111, 0x4951, 0x4931, 0x210B, 0x190B,
-    0x0000, 0x210B, 0x2212, 0x1A53, 0x09EE, 0x12D4, 0x1AB4, 0x09EE,
-    0x1AB4, 0x0BF8, 0x0B56, 0x0BD8, 0x0BF8, 0x0B33, 0x0B33, 0x0BD8,
-    0x0B33, 0x09EE, 0x1356, 0x0BF8, 0x1842, 0x210B, 0x09EE, 0x1AD4,
-    0x1A53, 0x1A53, 0x190B, 0x210B, 0x2042, 0x1842, 0x2042, 0x190B,
-    0x210B, 0x4931, 0x6911, 0x6111, 0x0000, 0x0000, 0xA08B, 0xA8B1,
-    0xB0D1, 0x588B, 0xB0B1, 0xE0B0, 0xE0B0, 0xE0B0, 0xE8AE, 0xE0AE,
-    0x0000, 0x5084, 0x5884, 0xC88A, 0xE8AA, 0xE8AA, 0x5084, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0xC0C6, 0xE165, 0xE126, 0xE906, 0xC0C6, 0x90C4, 0xE0C8, 0xE8AA,
-    0xC88A, 0x5884, 0xE8AC, 0xE8AE, 0x1842, 0x0000, 0x5084, 0xE0B0,
-    0xD0AE, 0xC88E, 0xC8B1, 0xD0B1, 0x988B, 0xA8B1, 0xB0D1, 0xB0D1,
-    0x90D1, 0x90F1, 0x608B, 0x190B, 0x5131, 0x4931, 0x0000, 0x0000,
-    0x0000, 0x1842, 0x3191, 0x1A53, 0x1A53, 0x1AB4, 0x12B4, 0x210B,
-    0x0000, 0x1356, 0x0BF8, 0x0BD8, 0x0BD8, 0x0479, 0x0B33, 0x0000,
-    0x0B33, 0x0499, 0x0BD8, 0x0BF8, 0x0BF8, 0x09EE, 0x0000, 0x0000,
-    0x0000, 0x09EE, 0x1A53, 0x2212, 0x210B, 0x2212, 0x3191, 0x4931,
-    0x2991, 0x6911, 0x4951, 0x6111, 0x6111, 0x90D1, 0x5884, 0x90D1,
-    0xB0D1, 0x1842, 0x0000, 0x588B, 0xC8B1, 0xE8B0, 0x588B, 0xE0B0,
-    0xE8AE, 0xC88E, 0x1842, 0xC8AE, 0xE8AC, 0xE8AC, 0x988B, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x5084, 0xE906, 0xE8E7, 0xE0E7, 0xE0C8, 0xE0A8,
-    0x988B, 0x5884, 0xC88A, 0xE8AC, 0x988B, 0x0000, 0x0000, 0x1842,
-    0xE8AE, 0xE0B0, 0xC8B1, 0xD0B1, 0x1842, 0x0000, 0xB0B1, 0x988B,
-    0x608B, 0x90D1, 0x78F1, 0x6111, 0x1842, 0x4931, 0x0000, 0x0000,
-    0x0000, 0x3191, 0x3191, 0x2212, 0x2212, 0x12B4, 0x1AB4, 0x190B,
-    0x0000, 0x0000, 0x1356, 0x0BD8, 0x0BD8, 0x0C99, 0x0BD8, 0x0479,
-    0x0000, 0x0000, 0x0BD8, 0x0C99, 0x0BD8, 0x0BD8, 0x0B56, 0x1356,
-    0x2042, 0x0000, 0x0000, 0x09EE, 0x0A0E, 0x210B, 0x3191, 0x3191,
-    0x2991, 0x0000, 0x4931, 0x608B, 0x0000, 0x6911, 0x78F1, 0x90D1,
-    0x90D1, 0xA8D1, 0x0000, 0x0000, 0x0000, 0xB0D1, 0xC8B1, 0x986B,
-    0x608B, 0xE0B0, 0xE8AE, 0xE0AE, 0xE0AC, 0xE8AC, 0x5084, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5084, 0x90E4, 0xE8C8,
-    0xC88A, 0xC88A, 0x988B, 0xE0AC, 0xE8AC, 0xA06B, 0x2042, 0x1842,
-    0x1842, 0xE0B0, 0xE8B0, 0x988B, 0x0000, 0x0000, 0x5884, 0xB0D1,
-    0x588B, 0x0000, 0x90D1, 0x78F1, 0x6911, 0x6111, 0x2042, 0x0000,
-    0x0000, 0x4931, 0x3191, 0x1842, 0x2042, 0x1AB4, 0x1A53, 0x1A53,
-    0x0000, 0x0000, 0x190B, 0x0BD8, 0x0BD8, 0x0C79, 0x0479, 0x0C79,
-    0x0479, 0x0000, 0x0000, 0x210B, 0x0479, 0x0C99, 0x0BF8, 0x0000,
-    0x09EE, 0x1356, 0x190B, 0x0000, 0x0000, 0x21F2, 0x2212, 0x2212,
-    0x3191, 0x210B, 0x0000, 0x4951, 0x4931, 0x0000, 0x0000, 0x1842,
-    0x78D1, 0xB0D1, 0x90D1, 0x0000, 0x0000, 0x0000, 0x588B, 0xE0B0,
-    0xC8AE, 0xD08E, 0x988B, 0xD08E, 0x988B, 0x5884, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x1842, 0x2042, 0x5884, 0x608B, 0xA06B, 0x988B, 0xD08E,
-    0x988B, 0xC88E, 0xE8AE, 0xC8B1, 0x1842, 0x608B, 0x0000, 0xA08B,
-    0xA8B1, 0x90D1, 0x0000, 0x588B, 0x78F1, 0x78F1, 0x4931, 0x608B,
-    0x0000, 0x4931, 0x210B, 0x0000, 0x0000, 0x190B, 0x2212, 0x1AB4,
-    0x0000, 0x0000, 0x0000, 0x190B, 0x0BF8, 0x0C79, 0x0479, 0x0C79,
-    0x0479, 0x0C79, 0x0000, 0x0000, 0x0000, 0x0B33, 0x0479, 0x0C79,
-    0x1842, 0x0000, 0x2042, 0x0B33, 0x190B, 0x2042, 0x2212, 0x21F2,
-    0x3191, 0x3191, 0x0000, 0x0000, 0x4931, 0x6111, 0x2042, 0x608B,
-    0x1842, 0x608B, 0x90F1, 0x90D1, 0x608B, 0x588B, 0x608B, 0xA08B,
-    0x588B, 0xA08B, 0x1842, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x1842, 0x1842, 0x0000, 0x0000, 0xD08E, 0x588B, 0xA08B,
-    0xA8B1, 0xD0B1, 0xB0D1, 0x78D1, 0x1842, 0x78F1, 0x6111, 0x6911,
-    0x4951, 0x4931, 0x210B, 0x0000, 0x0000, 0x0000, 0x21F2, 0x1AB4,
-    0x190B, 0x0000, 0x0000, 0x0000, 0x210B, 0x0479, 0x0C79, 0x0479,
-    0x0C79, 0x0479, 0x0C79, 0x0000, 0x0000, 0x0000, 0x0000, 0x0479,
-    0x0C79, 0x0B33, 0x0000, 0x0000, 0x0000, 0x0333, 0x1AB4, 0x12B4,
-    0x2212, 0x2212, 0x210B, 0x190B, 0x3191, 0x4951, 0x4931, 0x6911,
-    0x210B, 0x4931, 0x0000, 0x0000, 0x0000, 0x1842, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x2042, 0xE8AE, 0xC8B1, 0xB0D1,
-    0xA8B1, 0xC8B1, 0xB0D1, 0xA8B1, 0x90D1, 0x90F1, 0x6111, 0x6111,
-    0x4931, 0x4951, 0x3191, 0x3191, 0x0000, 0x0000, 0x190B, 0x2212,
-    0x1A53, 0x0000, 0x0000, 0x0000, 0x0000, 0x210B, 0x0BD8, 0x0499,
-    0x0C79, 0x0479, 0x0C79, 0x0BD8, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x09EE, 0x0499, 0x0BD8, 0x2042, 0x0000, 0x210B, 0x12B4, 0x12B4,
-    0x1A53, 0x2212, 0x3191, 0x3191, 0x3191, 0x4931, 0x3191, 0x4931,
-    0x4931, 0x4951, 0x6911, 0x78F1, 0x1842, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x986B, 0xE0B0, 0xE0B0, 0xE0B0,
-    0xC8B1, 0xC8B1, 0xB0D1, 0xB0B1, 0x588B, 0x78F1, 0x90D1, 0x78F1,
-    0x6911, 0x6111, 0x5151, 0x4931, 0x3191, 0x4931, 0x190B, 0x2212,
-    0x21F2, 0x210B, 0x0000, 0x0000, 0x0000, 0x0000, 0x210B, 0x0499,
-    0x0BD8, 0x0C79, 0x0479, 0x0C79, 0x0333, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0BD8, 0x0C79, 0x0333, 0x3A42, 0x1356, 0x1356,
-    0x12B4, 0x12B4, 0x2212, 0x2212, 0x3191, 0x3191, 0x3191, 0x4931,
-    0x4931, 0x6111, 0x6111, 0x78F1, 0x78D1, 0xB0D1, 0xA06B, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x5884, 0xE8AE, 0xE0B0, 0xE0B0, 0xE0B0,
-    0xC8B1, 0xC8B1, 0xD0B1, 0xC8B1, 0x988B, 0x0000, 0x90D1, 0x78F1,
-    0x608B, 0x78D1, 0x588B, 0x4931, 0x4951, 0x4931, 0x3191, 0x3191,
-    0x3191, 0x3191, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x190B,
-    0x0BF8, 0x0C99, 0x0479, 0x0C79, 0x0479, 0x0BD8, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x2042, 0x0BD8, 0x0BF8, 0x0B56, 0x1356,
-    0x1AB4, 0x12B4, 0x09EE, 0x2212, 0x09EE, 0x3191, 0x3191, 0x0000,
-    0x210B, 0x6111, 0x4931, 0x6911, 0x78F1, 0x90D1, 0x90F1, 0xA8D1,
-    0xB0B1, 0x588B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0xC8AE, 0xE8AE, 0xE0B0, 0xE0B0, 0xE0B0,
-    0xE0B0, 0xE0B0, 0xC8B1, 0xD0B1, 0x608B, 0x588B, 0x90D1, 0xB0D1,
-    0x608B, 0x78F1, 0x6111, 0x2042, 0x4931, 0x4951, 0x3191, 0x4931,
-    0x3191, 0x2212, 0x2042, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x09EE, 0x0BD8, 0x0BD8, 0x0479, 0x0C79, 0x0499, 0x0B33, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1356, 0x1356, 0x0B56,
-    0x1AB4, 0x1356, 0x12B4, 0x0000, 0x09EE, 0x2212, 0x210B, 0x4951,
-    0x2991, 0x608B, 0x608B, 0x6111, 0x6111, 0x90D1, 0x88D1, 0xB0D1,
-    0xA8B1, 0xD0B1, 0xC8B1, 0xB0D1, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x1842, 0xE8AC, 0xE0AC, 0xE0AE, 0xE8AE, 0xE0B0,
-    0xC88E, 0xE0B0, 0xC8B1, 0x988B, 0xC8B1, 0xB0B1, 0x988B, 0x608B,
-    0x78D1, 0x608B, 0x6111, 0x78F1, 0x0000, 0x4931, 0x4931, 0x4951,
-    0x3191, 0x3191, 0x3191, 0x2212, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x09EE, 0x0B56, 0x0BF8, 0x0BD8, 0x0C99, 0x0BD8, 0x0333,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x09EE, 0x1356, 0x1356,
-    0x1356, 0x1356, 0x12B4, 0x1A53, 0x0000, 0x210B, 0x3191, 0x190B,
-    0x210B, 0x4931, 0x210B, 0x608B, 0x6111, 0x6111, 0x608B, 0x90F1,
-    0x988B, 0xB0B1, 0xB0D1, 0xC8B1, 0xC8B1, 0xC8B1, 0x1842, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x90E4, 0xE0AC, 0xE0AC, 0xE8AE, 0xE0AE, 0xE0AE,
-    0xE8AE, 0xC8B1, 0xE0B0, 0xB0B1, 0x988B, 0xC8B1, 0xB0B1, 0xB0D1,
-    0x608B, 0x90D1, 0x190B, 0x78F1, 0x6111, 0x6911, 0x4951, 0x4931,
-    0x3191, 0x4931, 0x2042, 0x2212, 0x2212, 0x3191, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x09EE, 0x0BD8, 0x0BF8, 0x0BD8, 0x0BD8, 0x0C79,
-    0x0333, 0x0000, 0x0000, 0x0000, 0x0000, 0x3A42, 0x0BF8, 0x0BD8,
-    0x0A0E, 0x09EE, 0x1AB4, 0x1AB4, 0x1A53, 0x09EE, 0x2212, 0x2212,
-    0x190B, 0x5131, 0x190B, 0x5131, 0x190B, 0x6111, 0x78F1, 0x608B,
-    0x78F1, 0x588B, 0x90D1, 0xC8B1, 0xB0B1, 0xC8B1, 0xC8B1, 0xE8B0,
-    0x608B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x986B, 0xE8AA, 0xE8AA, 0xE0AC, 0xE0AC, 0xE0AE,
-    0xE8AE, 0xE0B0, 0xE0AE, 0xE0B0, 0x1842, 0x1842, 0xD0B1, 0xB0D1,
-    0x0000, 0xA8B1, 0x90D1, 0x588B, 0x78F1, 0x78F1, 0x6111, 0x6911,
-    0x4931, 0x4931, 0x0000, 0x0000, 0x190B, 0x2212, 0x2212, 0x2042,
-    0x0000, 0x0000, 0x0000, 0x09EE, 0x1356, 0x0BF8, 0x1356, 0x0BD8,
-    0x0BF8, 0x0333, 0x0000, 0x0000, 0x0000, 0x0000, 0x0B33, 0x0BD8,
-    0x1AB4, 0x0000, 0x0000, 0x09EE, 0x1A73, 0x1A53, 0x2212, 0x21F2,
-    0x3191, 0x3191, 0x190B, 0x4931, 0x2042, 0x0000, 0x6911, 0x78F1,
-    0x0000, 0x608B, 0x90D1, 0xA8D1, 0xB0D1, 0xC8B1, 0xC8B1, 0xE0B0,
-    0xE0B0, 0xE0B0, 0x986B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0xC88A, 0xE8AA, 0xE0AA, 0xE0AC, 0xE0AC, 0xE8AE,
-    0xE0AE, 0xE0B0, 0xE0AE, 0xE0B0, 0xE0B0, 0xE8B0, 0x988B, 0xC8B1,
-    0xD0B1, 0x988B, 0x90D1, 0xA8D1, 0x90D1, 0x90D1, 0x78F1, 0x78F1,
-    0x6911, 0x4931, 0x5131, 0x190B, 0x0000, 0x0000, 0x210B, 0x2212,
-    0x09EE, 0x0000, 0x0000, 0x0000, 0x1A53, 0x1356, 0x1356, 0x0BF8,
-    0x0B56, 0x0BF8, 0x0B33, 0x0000, 0x0000, 0x0000, 0x09EE, 0x0BD8,
-    0x1356, 0x0000, 0x0000, 0x0000, 0x09EE, 0x1A53, 0x2212, 0x2212,
-    0x3191, 0x2212, 0x3191, 0x4931, 0x4931, 0x190B, 0x608B, 0x78F1,
-    0x608B, 0x588B, 0x90D1, 0xB0D1, 0xA8B1, 0xC8B1, 0xC8B1, 0xE8B0,
-    0xC8B1, 0xE0B0, 0xE0B0, 0xE0B0, 0xB0D1, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0xC0C6, 0xE0C8, 0xE0A8, 0xE0AA, 0xE8AA, 0xE0AC,
-    0xE0AC, 0xE0AC, 0x988B, 0xE8AE, 0xE0AE, 0xE0B0, 0xE0B0, 0xE0B0,
-    0xC8B1, 0xC8B1, 0xB0B1, 0xA8D1, 0x90D1, 0x90D1, 0x78F1, 0x78F1,
-    0x6111, 0x6111, 0x4931, 0x4931, 0x3191, 0x0000, 0x0000, 0x0000,
-    0x3191, 0x2212, 0x0000, 0x0000, 0x09EE, 0x0A0E, 0x12B4, 0x1356,
-    0x1356, 0x1356, 0x12B4, 0x09EE, 0x09EE, 0x0000, 0x0000, 0x1356,
-    0x1356, 0x210B, 0x0000, 0x0000, 0x190B, 0x1A73, 0x09EE, 0x2212,
-    0x3191, 0x3191, 0x3191, 0x3191, 0x3191, 0x4931, 0x4931, 0x6911,
-    0x6111, 0x78F1, 0x78F1, 0x90D1, 0x90D1, 0xA8D1, 0xB0D1, 0xC8B1,
-    0xC8B1, 0xE8B0, 0xE0B0, 0xE0B0, 0xE0AE, 0xE0B0, 0x986B, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0xC0C6, 0xE0E7, 0xE8A8, 0xE0AA, 0xE0AA, 0xE0AC,
-    0xE8AC, 0xE8AE, 0x588B, 0x0000, 0x988B, 0xE0B0, 0xE0B0, 0xE8B0,
-    0xC8B1, 0xC8B1, 0xB0D1, 0x88D1, 0xB0B1, 0xB0D1, 0x90F1, 0x90D1,
-    0x78F1, 0x0000, 0x190B, 0x6911, 0x190B, 0x4931, 0x3191, 0x0000,
-    0x0000, 0x210B, 0x2212, 0x09EE, 0x2042, 0x21F2, 0x0000, 0x12B4,
-    0x1AB4, 0x1356, 0x12B4, 0x0B33, 0x0000, 0x0333, 0x0000, 0x210B,
-    0x1AB4, 0x0333, 0x0000, 0x0000, 0x2042, 0x12B4, 0x2212, 0x2212,
-    0x3191, 0x0000, 0x210B, 0x4951, 0x3191, 0x4931, 0x4931, 0x6111,
-    0x6111, 0x78F1, 0x78F1, 0x88D1, 0x90D1, 0xB0D1, 0xA8B1, 0x588B,
-    0x0000, 0xE0B0, 0xE0B0, 0xE0B0, 0xE0B0, 0xE0B0, 0xE8AE, 0xE8AE,
-    0x988B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x5084, 0xE8E7, 0xE0C8, 0xE8A8, 0xE0C8, 0xE0AA,
-    0xE0AA, 0xE8AC, 0xE0AC, 0xC88A, 0x0000, 0x0000, 0xC8AE, 0xA8B1,
-    0x0000, 0x0000, 0x608B, 0xC8B1, 0xB0D1, 0xC8B1, 0xA8B1, 0xB0D1,
-    0x90D1, 0x190B, 0x0000, 0x0000, 0x190B, 0x210B, 0x0000, 0x4931,
-    0x210B, 0x0000, 0x0000, 0x3191, 0x2991, 0x3191, 0x1842, 0x0000,
-    0x1A73, 0x1AB4, 0x12B4, 0x1AB4, 0x1A53, 0x0000, 0x210B, 0x190B,
-    0x09EE, 0x1AB4, 0x2042, 0x0000, 0x1842, 0x1A53, 0x210B, 0x0000,
-    0x190B, 0x2042, 0x0000, 0x0000, 0x3191, 0x4931, 0x4951, 0x6911,
-    0x6111, 0x78F1, 0x1842, 0x0000, 0x2042, 0x78D1, 0xB0D1, 0x1842,
-    0x0000, 0x98C4, 0xD0B1, 0xE0B0, 0xE0B0, 0xE0B0, 0xE8AE, 0xE0AE,
-    0xE0AE, 0xE0AE, 0x5884, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0xE906, 0xE0E7, 0xE108, 0xE0A8, 0xE0AA,
-    0xE8AA, 0xE108, 0xE0AA, 0xE0AC, 0xE8AC, 0x608B, 0x1842, 0xE8B0,
-    0x988B, 0x0000, 0x0000, 0x986B, 0xD0B1, 0xC8B1, 0xC8B1, 0xB0D1,
-    0x90D1, 0xB0D1, 0x0000, 0x0000, 0x0000, 0x608B, 0x4931, 0x0000,
-    0x0000, 0x4931, 0x3191, 0x0000, 0x3191, 0x2212, 0x2212, 0x0000,
-    0x0000, 0x1A53, 0x1A53, 0x12B4, 0x1A53, 0x1A53, 0x0000, 0x210B,
-    0x1A53, 0x12B4, 0x1AB4, 0x1842, 0x210B, 0x1A53, 0x190B, 0x0000,
-    0x210B, 0x3191, 0x0000, 0x0000, 0x0000, 0x4951, 0x4931, 0x6111,
-    0x6111, 0x78D1, 0x78F1, 0x78D1, 0x0000, 0x0000, 0x608B, 0xC8B1,
-    0x5884, 0x0000, 0xC8AE, 0xE0B0, 0xE0B0, 0xE0B0, 0xE0B0, 0xE0B0,
-    0xE0AE, 0xE0AE, 0xE0AC, 0xE8AC, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x5084, 0xE926, 0xE106, 0xE0E7, 0xE8C8,
-    0xE0C8, 0xE0AA, 0xE0A8, 0xE8AA, 0xE0AA, 0xE0AC, 0xC8AE, 0x986B,
-    0xE8AE, 0xE0AE, 0x0000, 0x0000, 0xA8D1, 0xE8B0, 0xC8B1, 0xC8B1,
-    0x986B, 0x1842, 0x90D1, 0x2042, 0x0000, 0x0000, 0x0000, 0x4951,
-    0x190B, 0x0000, 0x0000, 0x5131, 0x3191, 0x3191, 0x2991, 0x3191,
-    0x0000, 0x0000, 0x0A0E, 0x2212, 0x21F2, 0x1A53, 0x09EE, 0x0000,
-    0x0000, 0x2212, 0x2212, 0x1A53, 0x2212, 0x21F2, 0x2042, 0x0000,
-    0x0000, 0x3191, 0x0000, 0x0000, 0x0000, 0x0000, 0x4931, 0x190B,
-    0x0000, 0x6911, 0x6111, 0x78F1, 0x90D1, 0x608B, 0x0000, 0xB0D1,
-    0xA8D1, 0xA06B, 0x988B, 0xE0B0, 0xC8B1, 0xE8B0, 0xE0AE, 0xE0B0,
-    0xE0AE, 0xE8AE, 0xE0AC, 0xE0AC, 0xE0AA, 0x1842, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x1842, 0xE165, 0xE906, 0xE108,
-    0xE0C8, 0xE0A8, 0xE0C8, 0xE8AA, 0xE0AA, 0xA06B, 0x988B, 0xE0AE,
-    0xC88A, 0xA08B, 0xE8AE, 0x1842, 0x5084, 0xE0B0, 0xE0B0, 0xE8B0,
-    0xC8B1, 0xC8B1, 0xB0B1, 0xA8D1, 0x608B, 0x608B, 0x608B, 0x608B,
-    0x6111, 0x6911, 0x1842, 0x0000, 0x0000, 0x606B, 0x2991, 0x3191,
-    0x2042, 0x0000, 0x0000, 0x2212, 0x2212, 0x21F2, 0x2212, 0x2212,
-    0x0000, 0x0000, 0x190B, 0x21F2, 0x2212, 0x2212, 0x0000, 0x0000,
-    0x0000, 0x3191, 0x3191, 0x2042, 0x1842, 0x210B, 0x1842, 0x6111,
-    0x608B, 0x6111, 0x6111, 0x78D1, 0x78F1, 0xB0D1, 0x90D1, 0x5884,
-    0xA8D1, 0x90D1, 0x588B, 0xE8B0, 0xC8B1, 0x986B, 0xE0B0, 0xE0B0,
-    0xE0AE, 0xE0B0, 0xE0AE, 0xE8AE, 0xE8AC, 0xE8AC, 0x1842, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1842, 0xE906, 0xE906,
-    0xE0E7, 0xE0E7, 0xE8C8, 0xE0C8, 0xE0A8, 0xC0C6, 0x1842, 0x0000,
-    0xE8AC, 0xE0AE, 0xE8AE, 0xE0AE, 0xC8AE, 0xE0B0, 0xE0B0, 0xE0B0,
-    0x588B, 0x0000, 0xB0B1, 0xC8B1, 0x988B, 0x608B, 0x1842, 0x608B,
-    0x608B, 0x78D1, 0x6111, 0x6911, 0x4931, 0x1842, 0x0000, 0x4951,
-    0x3191, 0x0000, 0x0000, 0x0000, 0x3191, 0x2212, 0x3191, 0x2212,
-    0x09EE, 0x0000, 0x0000, 0x0000, 0x3191, 0x2212, 0x1842, 0x0000,
-    0x210B, 0x3191, 0x3191, 0x3191, 0x190B, 0x4931, 0x210B, 0x4931,
-    0x4931, 0x6911, 0x6111, 0x1842, 0x0000, 0x90F1, 0x90D1, 0xB0D1,
-    0xB0D1, 0xC8B1, 0xB0B1, 0xC8B1, 0xC8B1, 0x608B, 0x0000, 0x988B,
-    0xE8AE, 0xE0B0, 0xE0AE, 0xE8AE, 0xE0AC, 0xE0AC, 0xE0AA, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE165,
-    0xE126, 0xE106, 0xE8E7, 0xE0E7, 0xE0A8, 0xE8AA, 0x5884, 0x90E4,
-    0xC88A, 0xE0AE, 0xE0AC, 0xE8AE, 0xE0AE, 0xE0B0, 0xE0B0, 0xE0B0,
-    0xE8B0, 0x588B, 0xA08B, 0x986B, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x608B, 0x78F1, 0x608B, 0x6111, 0x6111, 0x6911,
-    0x4951, 0x4931, 0x0000, 0x0000, 0x0000, 0x4951, 0x3191, 0x3191,
-    0x3191, 0x2991, 0x0000, 0x0000, 0x0000, 0x3191, 0x3191, 0x3191,
-    0x3191, 0x4931, 0x210B, 0x4951, 0x3191, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x1842, 0x608B, 0x190B, 0x0000, 0x90D1, 0xA8B1,
-    0xB0D1, 0xC8B1, 0xC8B1, 0xC8B1, 0xC8B1, 0xE8B0, 0x986B, 0x608B,
-    0x1842, 0xE0B0, 0xE0AE, 0xE8AE, 0xE0AC, 0xE0AE, 0xE0AC, 0xE8AC,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0xC165, 0xE965, 0xE108, 0xE0E7, 0xE0A8, 0xE8C8, 0xE0A8, 0xC0C6,
-    0x988B, 0xE8AC, 0xE0AC, 0xE0AC, 0xE0AC, 0xE8AE, 0xE0AE, 0xE0B0,
-    0xA8B1, 0xC8B1, 0xC8B1, 0x98E4, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x78D1, 0x78F1, 0x0000, 0x0000, 0x1842,
-    0x608B, 0x6111, 0x1842, 0x0000, 0x0000, 0x0000, 0x210B, 0x3191,
-    0x3191, 0x3191, 0x190B, 0x0000, 0x0000, 0x0000, 0x210B, 0x3191,
-    0x190B, 0x2042, 0x0000, 0x0000, 0x190B, 0x4931, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x210B, 0x90D1, 0xB0D1,
-    0x988B, 0xB0B1, 0xB0D1, 0xC8B1, 0xC8B1, 0xE0B0, 0xC8B1, 0xE8B0,
-    0xC88E, 0x90E4, 0xE8AE, 0xE0AE, 0xE0AC, 0xE8AC, 0xE0AC, 0xE0AC,
-    0xC88A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0xC185, 0xE165, 0xE106, 0xE8E7, 0xE108, 0xE0A8, 0xE0C8,
-    0xE0A8, 0xE8AC, 0xE0AA, 0xE8AC, 0x90E4, 0xC88E, 0xE0AE, 0xE0AE,
-    0xE8AE, 0xD0AE, 0x986B, 0xE0B0, 0xB0D1, 0x608B, 0x1842, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x90D1, 0x78F1, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x210B, 0x210B, 0x0000, 0x0000, 0x0000, 0x4951,
-    0x3191, 0x4931, 0x3191, 0x4951, 0x0000, 0x0000, 0x0000, 0x190B,
-    0x210B, 0x0000, 0x0000, 0x0000, 0x0000, 0x4931, 0x5131, 0x1842,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x1842, 0x78F1, 0x90D1, 0xA8D1,
-    0x90D1, 0x608B, 0xA8D1, 0xD0B1, 0xC8B1, 0xE0B0, 0xA8D1, 0xC8B1,
-    0xE0B0, 0xE0B0, 0xE0AE, 0xE8AE, 0xE0AE, 0xE0AE, 0xE0AC, 0xE8AC,
-    0xE0AA, 0xC88A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x90C4, 0xE965, 0xE106, 0xE906, 0xE0E7, 0xE0E7,
-    0xE0C8, 0xE8AA, 0xE0C8, 0xE0AA, 0x986B, 0x0000, 0x90E4, 0xE8AE,
-    0xE8AE, 0xE0B0, 0xE0AE, 0xA8B1, 0x0000, 0x988B, 0xB0B1, 0xC8B1,
-    0xC8B1, 0xD0B1, 0xA8D1, 0xB0B1, 0x88D1, 0xB0D1, 0x190B, 0x0000,
-    0x0000, 0x0000, 0x1842, 0x6911, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x190B, 0x5131, 0x4951, 0x4931, 0x210B, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x4951, 0x2042, 0x0000, 0x0000, 0x0000, 0x190B, 0x6911,
-    0x608B, 0x6111, 0x6111, 0x78F1, 0x78D1, 0x78F1, 0x90D1, 0x78F1,
-    0x0000, 0x608B, 0xB0B1, 0xC8B1, 0xC8B1, 0xE0B0, 0x988B, 0x0000,
-    0x608B, 0xE8B0, 0xE0AE, 0xE0AE, 0xE8AE, 0xE0AE, 0xE0AC, 0xE0AC,
-    0xE8AA, 0xE0AA, 0x5084, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x90E4, 0xE145, 0xE965, 0xE126, 0xE106,
-    0xE0E7, 0xE108, 0xE8A8, 0xE0AA, 0xE8AA, 0xD127, 0xC8AE, 0xE0AC,
-    0xE0AC, 0xE0AE, 0xE8AE, 0xE8B0, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x1842, 0x78D1, 0x988B, 0xA06B, 0xA8D1, 0xC8B1, 0x90D1, 0xA08B,
-    0x0000, 0x0000, 0x1842, 0x90F1, 0x608B, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x4931, 0x6911, 0x4951, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x4931, 0x6911, 0x1842, 0x0000, 0x0000, 0x4951,
-    0x4931, 0x78D1, 0x78F1, 0x78D1, 0x608B, 0x608B, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0xC8B1, 0xC8B1, 0xC8B1, 0xE0B0, 0xE0B0,
-    0xC8AE, 0xC88E, 0xE0B0, 0xE0B0, 0xE8AE, 0xE0AE, 0xE0AC, 0xE0AC,
-    0xE8AC, 0xE0AC, 0xE8AA, 0x5884, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x5884, 0xE1A6, 0xE906, 0xE126,
-    0xE108, 0xE0E7, 0xE8C8, 0xE0A8, 0xE0C8, 0xE0AA, 0xE8AA, 0xE0AC,
-    0xE0AC, 0xE0AC, 0xE8AC, 0xE0AE, 0x90C4, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x588B, 0x608B, 0xB0D1,
-    0x588B, 0x0000, 0x1842, 0x90D1, 0x90D1, 0x2042, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x1842, 0x210B, 0x1842, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x2042, 0x6911, 0x6111, 0x1842, 0x0000,
-    0x608B, 0x6911, 0x78F1, 0x1842, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x5884, 0xD0B1, 0xC8B1, 0xE8B0,
-    0xE0B0, 0xE0B0, 0xE0AE, 0xE0B0, 0xE0AE, 0xE8AE, 0xE0AC, 0xE0AC,
-    0xE0AC, 0xE8AC, 0xE0AA, 0xE0AA, 0x1842, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1842, 0xE1A6, 0xE965,
-    0xE106, 0xE106, 0xE0E7, 0xE8E7, 0xC0C6, 0xC0C6, 0xE0C8, 0xE0AA,
-    0xC0C6, 0xE0AC, 0xE8AC, 0xE8AE, 0xE8AC, 0x1842, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x986B, 0x608B, 0x588B,
-    0xB0D1, 0x90D1, 0x988B, 0xB0D1, 0x88D1, 0x90D1, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x78F1, 0x78D1, 0x78F1,
-    0x608B, 0x90D1, 0x78F1, 0x588B, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xC88E, 0xE0B0,
-    0xE0B0, 0xE0B0, 0xE0B0, 0xE0B0, 0xE0AE, 0xE8AE, 0xE0AC, 0xE0AE,
-    0xE0AC, 0xE8AC, 0xE0AA, 0xE8AA, 0xE8C8, 0x1842, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE9C5,
-    0xE965, 0xE165, 0xE106, 0xE106, 0x5884, 0x0000, 0x0000, 0xE8C8,
-    0x90E4, 0x0000, 0x0000, 0x588B, 0xE8AC, 0xE0AE, 0x986B, 0xD0AE,
-    0x986B, 0x988B, 0x5884, 0x1842, 0x0000, 0x0000, 0x608B, 0xA06B,
-    0xD0B1, 0xC8B1, 0xA8D1, 0xB0B1, 0xA8D1, 0xB0B1, 0x588B, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1842, 0x78F1,
-    0x78D1, 0x90D1, 0x78F1, 0x90D1, 0x608B, 0x1842, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x608B, 0xA08B, 0xB0D1, 0x588B, 0xD0B1,
-    0xE0B0, 0x986B, 0x1842, 0x0000, 0x5884, 0xE8AE, 0x5884, 0x0000,
-    0x608B, 0xE8AC, 0xE0AA, 0xE0AA, 0xE8C8, 0xE0A8, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0xC165, 0xE9C5, 0xE165, 0xE145, 0xC0C6, 0x0000, 0x0000, 0x0000,
-    0xE8C8, 0xE8AA, 0x1842, 0x986B, 0xE0AA, 0xE8AC, 0xE0AC, 0xE0AE,
-    0xE0AE, 0xE0B0, 0xE8AE, 0xE0B0, 0xE0B0, 0xE0B0, 0xE0AE, 0xE8AE,
-    0xC8B1, 0xE0B0, 0xC8B1, 0xC8B1, 0xB0D1, 0xA8B1, 0xA08B, 0x608B,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x608B,
-    0x1842, 0x78F1, 0x90D1, 0xA8D1, 0x90D1, 0xA8D1, 0x90D1, 0x90D1,
-    0x988B, 0xB0B1, 0xA8D1, 0xD0B1, 0xC8B1, 0xE0B0, 0xE0B0, 0xE0B0,
-    0xE0B0, 0xE0B0, 0xC88E, 0x98E4, 0x0000, 0x986B, 0xE8AE, 0x5084,
-    0x0000, 0x0000, 0x90E4, 0xE8AC, 0xE0AA, 0xE0AA, 0xC0C6, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0xC185, 0xE1A6, 0xE965, 0xE145, 0x90E4, 0x0000, 0x0000,
-    0x0000, 0x90C4, 0xE8C8, 0xE8AA, 0xE0AA, 0xE0AA, 0xE0AA, 0xE8AC,
-    0xE0AC, 0xE0AE, 0xE0AC, 0xE8AE, 0xE0AE, 0xE0B0, 0xE0AE, 0xE0B0,
-    0xE0B0, 0xE0B0, 0xC8B1, 0xC8B1, 0xC8B1, 0xD0B1, 0x1842, 0x90D1,
-    0x1842, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x2042, 0xA08B, 0x0000, 0xA8B1, 0x90D1, 0xA8D1, 0xB0D1, 0xA8B1,
-    0xB0D1, 0xC8B1, 0xB0B1, 0xC8B1, 0xC8B1, 0xE0B0, 0xC8B1, 0xE8B0,
-    0xE0B0, 0xE0B0, 0xE0AE, 0xE0B0, 0xE0AE, 0xE8AE, 0xE0AC, 0xC8AE,
-    0x0000, 0x0000, 0x0000, 0x1842, 0xE8AA, 0xE0AA, 0xE8A8, 0x90E4,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x5084, 0xE9C5, 0xE9A6, 0xE9C5, 0x5884, 0x0000,
-    0x0000, 0x0000, 0x1842, 0xE0C8, 0xE0A8, 0xE8AA, 0xE0AA, 0xE8AA,
-    0x5884, 0x5084, 0xE0AC, 0xE8AE, 0xE0AE, 0xE0B0, 0xE0AE, 0xE0B0,
-    0xE8AE, 0xE0B0, 0xE0B0, 0xE0B0, 0xE0B0, 0xE0B0, 0x608B, 0x988B,
-    0xB0D1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x90D1, 0x608B, 0x1842, 0xC8B1, 0xB0B1, 0xC8B1,
-    0xA8D1, 0xD0B1, 0xC8B1, 0xC8B1, 0xC8B1, 0xE0B0, 0xE0B0, 0xE0B0,
-    0xE0B0, 0xB0B1, 0x988B, 0xE0B0, 0xE0AE, 0xE0B0, 0xE0AE, 0xE8AE,
-    0x90C4, 0x0000, 0x0000, 0x0000, 0x0000, 0xE0AA, 0xE8C8, 0xE8A8,
-    0x5084, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x1842, 0xF1C5, 0xE9C5, 0xE165, 0x5084,
-    0x0000, 0x0000, 0x0000, 0xA06B, 0xE8C8, 0xE0A8, 0xC88A, 0x5084,
-    0x0000, 0x0000, 0x608B, 0xE8AC, 0xE0AC, 0xE0AE, 0xC8AE, 0xE8AE,
-    0x988B, 0xE8AE, 0xE0AE, 0xE0B0, 0xC88E, 0xE0B0, 0xC8B1, 0x0000,
-    0x988B, 0xA06B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x988B, 0x986B, 0x0000, 0xB0D1, 0xC8B1,
-    0xB0B1, 0xC8B1, 0xC8B1, 0xD0B1, 0x988B, 0xE0B0, 0xC8B1, 0xE8B0,
-    0xE0B0, 0xE0B0, 0x986B, 0x0000, 0x0000, 0x588B, 0xD0AE, 0xE8AE,
-    0xE0AC, 0xC88E, 0x0000, 0x0000, 0x0000, 0x1842, 0xE8C8, 0xE0A8,
-    0xE8C8, 0x1842, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF285, 0xE9C5, 0xE9C5,
-    0x5084, 0x0000, 0x0000, 0x0000, 0xC0C6, 0xE108, 0xE8A8, 0xC0C6,
-    0x0000, 0x0000, 0x5884, 0xE0AC, 0xE0AC, 0xE8AC, 0x5884, 0x5084,
-    0xE8AE, 0xE0AE, 0xE8AE, 0xC8AE, 0x0000, 0x90C4, 0xE8B0, 0x988B,
-    0x608B, 0xE8B0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x1842, 0xD0AE, 0x1842, 0x588B,
-    0xD0B1, 0x90D1, 0x1842, 0xC8B1, 0xC8B1, 0xE0B0, 0xE8B0, 0x986B,
-    0x5884, 0xE0B0, 0xE0B0, 0xE0B0, 0x608B, 0x0000, 0x0000, 0x90E4,
-    0xE0AC, 0xE0AC, 0xE8AA, 0x0000, 0x0000, 0x0000, 0x1842, 0xE0E7,
-    0xE8A8, 0xE108, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xC165, 0xF285,
-    0xE9C5, 0x90C4, 0x0000, 0x0000, 0x0000, 0xC0C6, 0xE0E7, 0xE0E7,
-    0xC0C6, 0x5084, 0x5884, 0xE8AA, 0xE8AA, 0xE0AC, 0x5084, 0x0000,
-    0xA08B, 0xE0AE, 0xE8AC, 0x5084, 0x0000, 0x608B, 0xE8AE, 0xE0B0,
-    0xC88E, 0xE0B0, 0x988B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x986B, 0xD0B1,
-    0xA8D1, 0xE0B0, 0xC8B1, 0x5884, 0x0000, 0x5884, 0xD0B1, 0xE0B0,
-    0x986B, 0x0000, 0x608B, 0xE8AE, 0xE0AE, 0xE0AE, 0x1842, 0x5884,
-    0xC88A, 0xE8AA, 0xE0AA, 0xC8AA, 0x0000, 0x0000, 0x0000, 0x5884,
-    0x988B, 0xE8E7, 0x90C4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x62A3,
-    0xF285, 0x62A3, 0x5884, 0x5884, 0x0000, 0x0000, 0x0000, 0xE126,
-    0xE0E7, 0xC88A, 0xC0C6, 0xE0A8, 0xE8C8, 0xE8AA, 0x5884, 0x0000,
-    0x1842, 0xE0AC, 0xE8AC, 0x0000, 0x0000, 0x986B, 0xE0AE, 0xE0B0,
-    0xD0AE, 0x588B, 0xD08E, 0x608B, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x588B,
-    0xD0B1, 0x988B, 0xC88E, 0xE0B0, 0xE0B0, 0x588B, 0x0000, 0x0000,
-    0xE8AE, 0xE8B0, 0x1842, 0x0000, 0x5084, 0xE8AE, 0xE0AE, 0xE8AE,
-    0x988B, 0x986B, 0xE0AC, 0xE8AC, 0x5884, 0x0000, 0x0000, 0x0000,
-    0x5884, 0xC0C6, 0xE8E7, 0x90E4, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x1842, 0xF285, 0xC965, 0x1842, 0x98C4, 0x0000, 0x0000, 0x0000,
-    0x5884, 0xE906, 0xE0E7, 0xE0E7, 0xE8C8, 0xE0E7, 0x5084, 0x98E4,
-    0xC88A, 0xE8AC, 0xE0AA, 0xE0AC, 0x5084, 0xC88A, 0xE8AC, 0xE8AE,
-    0x1842, 0x0000, 0xC8AE, 0xE8AE, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0xE0B0, 0xC8AE, 0x0000, 0x1842, 0xE8B0, 0xE0AE, 0xC88E,
-    0x0000, 0xE8AE, 0xE0AE, 0xE0AE, 0x988B, 0x0000, 0x1842, 0xD08E,
-    0xE8AC, 0xE0AC, 0xE0AA, 0xE8AA, 0xC88A, 0x0000, 0x0000, 0x0000,
-    0x5084, 0x5884, 0xC0C6, 0xE926, 0x1842, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0xF285, 0xF265, 0x1842, 0x3242, 0xC985, 0x90C4,
-    0x0000, 0xC185, 0xE126, 0xE106, 0xE0E7, 0xE108, 0xC88A, 0xE8AA,
-    0xE0C8, 0xE8AA, 0xC0C6, 0x0000, 0x986B, 0xE0AC, 0xE8AC, 0x988B,
-    0x0000, 0x0000, 0xE8AE, 0xE8AE, 0x1842, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x1842, 0xE0B0, 0xC88E, 0x0000, 0x0000, 0x988B,
-    0xE8AE, 0xE0B0, 0xE8AE, 0x1842, 0x988B, 0xE0AE, 0xE8AC, 0xE0AC,
-    0xC88A, 0xE0AC, 0xE0AA, 0xE8AC, 0xE8AA, 0xC88A, 0x0000, 0x1842,
-    0x5884, 0x98E4, 0x1842, 0xE126, 0xE906, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0xCA64, 0xF265, 0x9AA3, 0x0000, 0x5884,
-    0x90E4, 0xE9A6, 0xE165, 0x1842, 0x0000, 0x5884, 0x0000, 0xC8C6,
-    0xE0A8, 0xE8C8, 0x90C4, 0x0000, 0x0000, 0x988B, 0xC88A, 0x1842,
-    0x0000, 0x2042, 0xE8AC, 0xE0AE, 0x588B, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x5884, 0xD0AE, 0xC88E, 0x0000,
-    0x0000, 0x1842, 0xD0AE, 0xC88A, 0x0000, 0x0000, 0x608B, 0xE8AC,
-    0xE0AC, 0xE0AA, 0x1842, 0x1842, 0x0000, 0x2042, 0xE8C8, 0xE8A8,
-    0x90E4, 0x5084, 0x0000, 0x5884, 0xE906, 0xC0C6, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x5084, 0xFB65, 0xCA64, 0x0000,
-    0x0000, 0x5884, 0xE9C5, 0x5084, 0x0000, 0x0000, 0x0000, 0x0000,
-    0xE8E7, 0xE0E7, 0xC0C6, 0x0000, 0x0000, 0xE0C8, 0xC88A, 0x0000,
-    0x0000, 0x0000, 0xC8AE, 0xE8AA, 0xC88E, 0xA08B, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xC8AE, 0xC88A, 0x986B,
-    0xD0AE, 0x1842, 0x0000, 0x0000, 0xC88A, 0xC8AE, 0x0000, 0x0000,
-    0xC88A, 0xE0AC, 0xE8AA, 0x0000, 0x0000, 0x0000, 0x0000, 0x5884,
-    0xE8C8, 0x90C4, 0x0000, 0x0000, 0x5084, 0xE965, 0x5884, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFB65, 0xF365,
-    0x0000, 0x9AA3, 0xE9C5, 0x5084, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x98E4, 0xE906, 0xE0E7, 0x5084, 0x0000, 0xE8C8, 0x986B, 0x0000,
-    0x0000, 0x0000, 0xA08B, 0xC88E, 0xE8AA, 0xE0AC, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE0AE,
-    0xC88A, 0x988B, 0x988B, 0x1842, 0x0000, 0x0000, 0xD08A, 0xC88A,
-    0x0000, 0x5884, 0xE8AA, 0xE0AA, 0x90E4, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x5884, 0xE8E7, 0x90E4, 0x0000, 0xC165, 0xE965, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCB84,
-    0xF365, 0xFB65, 0xF285, 0xCA64, 0x1842, 0x0000, 0x0000, 0x0000,
-    0x0000, 0xE165, 0xE926, 0xE906, 0x1842, 0xD127, 0xC0C6, 0x0000,
-    0x0000, 0x0000, 0x986B, 0xE0AA, 0xE8AA, 0xE108, 0x90E4, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x90C4, 0xE8AE, 0xC8AE, 0xC8AE, 0xC88A, 0x0000, 0x0000, 0x0000,
-    0xC8AA, 0xC88A, 0x0000, 0xE0AA, 0xE8C8, 0xE8AA, 0x5084, 0x0000,
-    0x0000, 0x0000, 0x0000, 0xC0C6, 0xE106, 0xC165, 0xE965, 0xC165,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x5064, 0xFB65, 0xF285, 0x5084, 0xCA64, 0xF285, 0xC165, 0x90C4,
-    0x98E4, 0xE9C5, 0xC165, 0x0000, 0xD127, 0xE906, 0x90E4, 0x0000,
-    0x0000, 0x0000, 0x5884, 0xE8C8, 0xE0A8, 0xE0AA, 0xC88A, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0xC8AA, 0xE8AC, 0xE0AA, 0xE0AC, 0x5084, 0x0000,
-    0x0000, 0x0000, 0x98E4, 0xE8A8, 0xE0C8, 0x5084, 0x98C4, 0xE8C8,
-    0x90C4, 0x5884, 0x5884, 0xE906, 0xC0C6, 0x1842, 0xC0C6, 0xE965,
-    0x5084, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0xF365, 0xFB65, 0x98E4, 0xCB84, 0x90C4, 0x9AC3,
-    0x5884, 0xCA64, 0xE9C5, 0x0000, 0x1842, 0xE165, 0xE906, 0xE106,
-    0xC0C6, 0xC0C6, 0xC0C6, 0xE0E7, 0xE0C8, 0xE8A8, 0xE8C8, 0x5084,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x90C4, 0xE8AA, 0xE0AC, 0xE0AA, 0xE8AA,
-    0x988B, 0xC0C6, 0xA06B, 0x988B, 0xE0A8, 0xE0C8, 0xC0C6, 0x0000,
-    0xE0E7, 0xE926, 0x5884, 0xC0C6, 0xC0C6, 0xE106, 0x90E4, 0xE9C5,
-    0xE9A6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0xCB84, 0xCB84, 0x0000, 0x90C4, 0x1842,
-    0x5884, 0xF285, 0xE9C5, 0x5884, 0x0000, 0xE9A6, 0xE165, 0xE145,
-    0xE906, 0xE126, 0xE108, 0xE108, 0xE0E7, 0xE0E7, 0xE8C8, 0xC0C6,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xC88A, 0xE0AA, 0xE0AA,
-    0xE0C8, 0xE8AA, 0xE0A8, 0xE0C8, 0xE0A8, 0xE8C8, 0xE0A8, 0xE0E7,
-    0x0000, 0x1842, 0xE108, 0xD927, 0x5084, 0x5884, 0x5884, 0x1842,
-    0xF1C5, 0xC185, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x5084, 0xFC85, 0xCA64, 0xCB84,
-    0x9AA3, 0xF365, 0xF285, 0xCA64, 0x0000, 0xCA64, 0xE9C5, 0x90C4,
-    0x5884, 0x98E4, 0x5084, 0xE165, 0xE906, 0xE106, 0xE8E7, 0xE908,
-    0x1842, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1842, 0xE0AA,
-    0xE0C8, 0xE0AA, 0xE8A8, 0xE8C8, 0x90C4, 0x98E4, 0x90C4, 0x90E4,
-    0xE0E7, 0xC0C6, 0x0000, 0xC165, 0xE965, 0xE9A6, 0x5084, 0xC965,
-    0xE9C5, 0xF285, 0x1842, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCB84, 0xFC85,
-    0xFB65, 0xF365, 0xF265, 0x1842, 0x5884, 0x9AA3, 0xE9C5, 0xC185,
-    0x90C4, 0x98E4, 0xE945, 0xE165, 0xE145, 0xE965, 0xE106, 0xE106,
-    0x5084, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x5884, 0xE8C8, 0xE8C8, 0xE0A8, 0xE0C8, 0xE0E7, 0xE8E7, 0x90C4,
-    0x5084, 0xE906, 0xE926, 0x90E4, 0x90C4, 0x5884, 0xC0C6, 0xE9C5,
-    0xE9C5, 0xF285, 0xC165, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3222,
-    0xFC85, 0xFC65, 0x62A3, 0x6AA3, 0x1842, 0xCB84, 0xF285, 0x5884,
-    0x5084, 0xEA85, 0xE9C5, 0xE9C5, 0xE1A6, 0xE9C5, 0xE965, 0xE165,
-    0xC0C6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0xC0C6, 0xE0E7, 0xE0E7, 0xE906, 0xE0E7, 0xE126,
-    0xE106, 0xE945, 0x98E4, 0x1842, 0xE945, 0xE9C5, 0x5884, 0x5084,
-    0x90C4, 0xF285, 0xF285, 0x1842, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0xCC84, 0xFC65, 0x0000, 0x90C4, 0x9AC3, 0xFB65, 0xF285,
-    0x90C4, 0xF285, 0xEA65, 0xF285, 0xE9C5, 0xE1C5, 0xE1A6, 0xE9C5,
-    0xC165, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0xC0C6, 0xE106, 0xE108, 0xE926,
-    0xE106, 0xE165, 0xE106, 0xE965, 0x5084, 0xC185, 0xE9A6, 0x90E4,
-    0x5884, 0x5884, 0xF285, 0x9AA3, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0xFD85, 0xCB84, 0xCB84, 0xFC85, 0xCB84,
-    0x9AA3, 0xF365, 0xFB65, 0xF365, 0xEA65, 0xF285, 0xEA65, 0xF285,
-    0xE9C5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xC0C6, 0xE165,
-    0xE145, 0xE165, 0xE165, 0xE9C5, 0xE1A6, 0xE9C5, 0xC165, 0xCA64,
-    0xE9C5, 0xF265, 0xEA85, 0xFB65, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x62A3, 0xFD65, 0xF485, 0xFC65,
-    0xF365, 0xFC85, 0xF365, 0xF365, 0xF265, 0xF365, 0xEA85, 0xF265,
-    0xE9C5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x5084, 0xE945, 0xE165, 0xE9C5, 0xE9C5, 0xE9C5, 0xE1A6, 0xEA85,
-    0xE1A6, 0xF285, 0xEA85, 0xF365, 0x5864, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9AA3, 0xF585,
-    0xFC65, 0xFD85, 0xF465, 0xFC85, 0xF365, 0xFC85, 0xF365, 0xFB65,
-    0x9AA3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x5084, 0xE9C5, 0xE9C5, 0xEA65, 0xE9C5, 0xEA85,
-    0xF265, 0xF365, 0xF285, 0xFB65, 0x90E4, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x62A3, 0xFD85, 0xFC65, 0xFC85, 0xF465, 0xFC85, 0xF365, 0xF365,
-    0x5064, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x1842, 0xD264, 0xE9C5, 0xF285,
-    0xF285, 0xF365, 0xF265, 0xF365, 0x5084, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x1842, 0xCC84, 0xCC64, 0xD484, 0xCB84, 0x3222,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3242,
-    0xC165, 0xCB84, 0xF285, 0xD264, 0x1842, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000 },
-  { 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x34C8, 0x6CA6, 0x6E28,
-    0x9CE5, 0x9CE5, 0x3222, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6AA3, 0xD585,
-    0xD686, 0xCF26, 0xA6A7, 0x64A6, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6CA6, 0x4DA8, 0x6E28,
-    0x6608, 0x8667, 0x8667, 0xAEC7, 0x9CE5, 0x3242, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6AA3, 0xCD65, 0xF725,
-    0xF725, 0xF725, 0xD726, 0xCF26, 0xD726, 0x9CE5, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4DA8, 0x55A8, 0x6E08,
-    0x6E28, 0x8667, 0x8667, 0xA6A7, 0xA6C7, 0xD726, 0xCF26, 0xCF26,
-    0xCD65, 0x3222, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x3A42, 0xCC64, 0xFE85, 0xFE65, 0xF725,
-    0xFF25, 0xF725, 0xF725, 0xF725, 0xD726, 0xCF26, 0xCF26, 0xCF26,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x55A8, 0x4DA8, 0x6E08,
-    0x6628, 0x8667, 0x8667, 0xA6A7, 0xA6C7, 0xD726, 0xCF26, 0xF725,
-    0xCF26, 0xFF25, 0xF725, 0xF745, 0x9AA3, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x9AA3, 0xFD85, 0xFD65, 0xF665, 0xFE65, 0xFE65,
-    0xFE65, 0xF725, 0xFF25, 0xF725, 0xF725, 0xF725, 0xD726, 0xF725,
-    0xCF26, 0xD666, 0x0000, 0x0000, 0x0000, 0x3222, 0x2D69, 0x55A8,
-    0x6E28, 0x8667, 0x8667, 0xA6A7, 0xAEC7, 0xCF26, 0xA6A7, 0xD726,
-    0xCF26, 0xF725, 0xFF25, 0xF725, 0xF725, 0xF725, 0xFE65, 0xCC64,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0xCB84, 0xFB65, 0xF485, 0xFC65, 0xFD85, 0xF565, 0xFE85,
-    0xFD65, 0xFE65, 0xF665, 0xF725, 0xF725, 0xFF25, 0xF725, 0xF725,
-    0xCF26, 0xD726, 0xA6C7, 0x3222, 0x0000, 0x0000, 0x6CA6, 0x6628,
-    0x6E08, 0x8667, 0x8667, 0xA6C7, 0xA6A7, 0xCF26, 0xD726, 0xCF26,
-    0xCF26, 0xF725, 0xFF25, 0xF725, 0xF725, 0xF725, 0xFE65, 0xF665,
-    0xFE65, 0xFE85, 0xCC64, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0xCA64, 0xF365, 0xF365, 0xFC85, 0xF465, 0xFD85, 0xFC65, 0xF585,
-    0xFD65, 0xFE65, 0xFE65, 0xFE65, 0xFE65, 0xF725, 0xF725, 0xF725,
-    0xFF25, 0xF725, 0xCF26, 0xD726, 0x9CE5, 0x0000, 0x1822, 0x6E28,
-    0x4DA8, 0x8E67, 0x8667, 0x0000, 0xA6C7, 0xD726, 0xA6A7, 0xCF26,
-    0xD726, 0xF725, 0xF725, 0xF725, 0xFF25, 0xF725, 0xFE65, 0xFE65,
-    0xFD65, 0xF685, 0xFD65, 0xFD65, 0xF485, 0xCB84, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xC165,
-    0xF285, 0xF265, 0xEA85, 0xF365, 0xF365, 0xFC65, 0xF365, 0xFC85,
-    0xF465, 0xFD85, 0xFD65, 0xFE85, 0xF565, 0xFE65, 0xFE65, 0xF725,
-    0xF725, 0xCC64, 0x0000, 0xF725, 0xCF46, 0xD726, 0x1822, 0x34C8,
-    0x6E28, 0x8667, 0x8667, 0xA6A7, 0x9CE5, 0xA6C7, 0xD666, 0xCF26,
-    0xCF26, 0xFE85, 0x3222, 0xF725, 0xCC64, 0xFE65, 0xFE65, 0xFE65,
-    0xF665, 0xFE85, 0xFD65, 0xFD85, 0xF465, 0xFD85, 0xF465, 0xFC85,
-    0x9AA3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xC0C6, 0xE9C5,
-    0xE9C5, 0xEA85, 0xF265, 0xEA85, 0xF265, 0xF365, 0xF365, 0xFC85,
-    0xF465, 0xFD85, 0xF465, 0xFD85, 0xFD65, 0x9CE5, 0xFE65, 0xFE65,
-    0xFE65, 0xF725, 0xCC64, 0x9CE5, 0xFF25, 0xF725, 0xD746, 0x64A6,
-    0x6CA6, 0x6608, 0x6E28, 0x8667, 0x8667, 0xA6A7, 0xAEC7, 0x0000,
-    0xD666, 0xF725, 0xCD65, 0x0000, 0xFD85, 0xCD65, 0x0000, 0x9CE5,
-    0xFD85, 0xFE65, 0xFD65, 0xFD85, 0xF465, 0xFC85, 0xF365, 0xF365,
-    0xF365, 0xFB65, 0xEA65, 0x90C4, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x90E4, 0xE906, 0xE965,
-    0xE145, 0xE9C5, 0xE1A6, 0xE9C5, 0xE9C5, 0xEA85, 0xF285, 0xF365,
-    0xF365, 0xFC85, 0x5064, 0x0000, 0xCB84, 0xCB84, 0x0000, 0xFD85,
-    0xFD85, 0xCC64, 0x9AA3, 0xF745, 0xF725, 0xFF25, 0xCF26, 0xF725,
-    0x9CE5, 0x6628, 0x6E08, 0x8667, 0x8667, 0xA6C7, 0x0000, 0x62A3,
-    0xD726, 0xF725, 0xF725, 0xF725, 0x0000, 0x3242, 0xFD65, 0x0000,
-    0x0000, 0xFE65, 0xFD85, 0xF565, 0xCB84, 0xFC85, 0xF465, 0xFC85,
-    0xF365, 0xF365, 0xF265, 0xF285, 0xE9C5, 0xF285, 0x5884, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x5084, 0xE126, 0xE108, 0xE106,
-    0xE906, 0xE165, 0xE145, 0xE1C5, 0xE9C5, 0xF285, 0xE9C5, 0x9AA3,
-    0xF265, 0xF365, 0xF285, 0x0000, 0x90C4, 0xFC85, 0x0000, 0x1842,
-    0xFD65, 0xFE65, 0xFE65, 0xFE65, 0x1842, 0xCD65, 0xFF25, 0xF725,
-    0xF725, 0xD686, 0x9CE5, 0x8667, 0x8667, 0xAEA7, 0xA6C7, 0xA6A7,
-    0x0000, 0x6AA3, 0xD726, 0xF725, 0xF725, 0xF725, 0xD686, 0xFE65,
-    0xCC64, 0x0000, 0xCC64, 0x9AA3, 0xFC85, 0xF485, 0x9AA3, 0xCA64,
-    0xFB65, 0xF365, 0xF285, 0xEA65, 0xE9C5, 0xE9C5, 0xE145, 0xE1A6,
-    0xE126, 0x1842, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x1842, 0xE8C8, 0xE8E7, 0xE0A8, 0xE8E7,
-    0xE0E7, 0xE106, 0xE126, 0xE965, 0xE145, 0xE9C5, 0xC0C6, 0xC185,
-    0xE9C5, 0xCA64, 0xC165, 0xCA64, 0x0000, 0xF365, 0xCB84, 0xCB84,
-    0xFC85, 0xFD85, 0xF565, 0xFD85, 0x0000, 0x0000, 0xCD65, 0xF725,
-    0xF725, 0xFF25, 0xCE86, 0x8667, 0x8667, 0xA6A7, 0xA6C7, 0xCF26,
-    0xD726, 0xCC64, 0x64A6, 0xF725, 0xFF25, 0xF725, 0xF725, 0xF725,
-    0xFE65, 0xFE85, 0x9AA3, 0xCB84, 0x0000, 0xF485, 0xFC65, 0xF485,
-    0x0000, 0x9AA3, 0xF285, 0xEA65, 0xE9C5, 0xEA85, 0xE9C5, 0xE9C5,
-    0xE965, 0xE165, 0xE906, 0x90C4, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x988B, 0xE0A8, 0xE8AA, 0xE0C8, 0xE0A8,
-    0xE0C8, 0xE108, 0xE8E7, 0xE126, 0xE906, 0xE945, 0x1842, 0x5084,
-    0xE9A6, 0xF285, 0x90E4, 0x98C4, 0x90E4, 0x9AA3, 0xF365, 0xF465,
-    0xFC85, 0xF565, 0xFC85, 0xFD65, 0xFC85, 0xCC64, 0xCB84, 0xF725,
-    0xF725, 0xF725, 0xFF25, 0xF725, 0x9CE5, 0xA6C7, 0xAEA7, 0xA6C7,
-    0xD726, 0xCF26, 0xCE66, 0xD686, 0xF725, 0xF725, 0xCC64, 0x9AA3,
-    0xCC84, 0xFE65, 0xFD65, 0xFD85, 0xFC65, 0x0000, 0xCB84, 0xCA64,
-    0xEA85, 0xF365, 0xCA64, 0xF265, 0x1842, 0xE9C5, 0xE945, 0xE165,
-    0xE145, 0xE165, 0xE108, 0xE8E7, 0xE0E7, 0xC88A, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0xC8AE, 0xE0AA, 0xE8AA, 0xE0A8, 0xE0AA,
-    0xE0C8, 0xE8A8, 0xE0C8, 0xE0E7, 0xC0C6, 0xC0C6, 0xE0E7, 0xC0C6,
-    0xE945, 0xE165, 0xC165, 0xC185, 0x1842, 0xF285, 0xF265, 0xF365,
-    0xF285, 0x9AA3, 0x90C4, 0xFC85, 0xFC85, 0xFD65, 0xF485, 0xFE65,
-    0xFE65, 0xF725, 0xFE65, 0xF725, 0xFD65, 0x9CE5, 0xA6A7, 0xCF26,
-    0xA6C7, 0xD726, 0xCF26, 0x6AA3, 0x9CE5, 0xF725, 0xF725, 0xCD85,
-    0xCC64, 0xCC84, 0xFD65, 0xFD85, 0x62A3, 0xFD65, 0xF485, 0xFC65,
-    0xCA64, 0x0000, 0xEA85, 0xF285, 0xE9C5, 0x90C4, 0xE965, 0x1842,
-    0xC165, 0xE965, 0xE126, 0xE106, 0xE0E7, 0xE8E7, 0xE0A8, 0xE0C8,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0xE0AC, 0xE8AC, 0xE0AC, 0xE0AA, 0xE0AC,
-    0xE8AA, 0xE0AA, 0xE0C8, 0xC88A, 0xC0C6, 0xE8E7, 0x5084, 0xE108,
-    0xE906, 0xE165, 0x0000, 0xE145, 0xE145, 0xE9C5, 0xE9C5, 0xCA64,
-    0xF285, 0xCB84, 0xC185, 0x9AA3, 0xF365, 0xFD65, 0xFD85, 0x62A3,
-    0xCC64, 0xFE65, 0xFE65, 0xF725, 0xF665, 0xCC84, 0x1842, 0xAEC7,
-    0xA6A7, 0xD726, 0xCF26, 0xFF25, 0xCD65, 0x0000, 0xF725, 0xF725,
-    0x0000, 0x0000, 0x0000, 0x62A3, 0xCB84, 0x0000, 0xCB84, 0xFB65,
-    0xFB65, 0xF365, 0x0000, 0x0000, 0xE9C5, 0xE9C5, 0xE145, 0xE165,
-    0xE106, 0xE106, 0xE8E7, 0xE0E7, 0xE0E7, 0xE0E7, 0xE8C8, 0xE0C8,
-    0xE0A8, 0xE0AA, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0xE8AE, 0xE0AC, 0xE0AE, 0xE0AC, 0xE8AC,
-    0xE0AA, 0xE0AC, 0xE0AA, 0xE8AA, 0xE0C8, 0xE0AA, 0xE0A8, 0xE8C8,
-    0xE0E7, 0xE108, 0x0000, 0x0000, 0xE106, 0xE165, 0xE945, 0xC185,
-    0x0000, 0xCA64, 0x0000, 0x0000, 0x0000, 0x62A3, 0xFC85, 0xFC65,
-    0x0000, 0xF585, 0xFD65, 0xFE85, 0xFE65, 0xF665, 0x1822, 0x0000,
-    0x64A6, 0xCF26, 0xCF26, 0xF725, 0xFF25, 0xF725, 0x0000, 0xF725,
-    0xF685, 0xFD65, 0xCC84, 0xFD65, 0xFC85, 0xFD65, 0xCB84, 0xFC85,
-    0x5084, 0xF365, 0xEA85, 0xCA64, 0x0000, 0xE1A6, 0xE9C5, 0xE9C5,
-    0xE965, 0xE106, 0xD127, 0xD127, 0xE8C8, 0xE108, 0xE0A8, 0xE0AA,
-    0xE0AA, 0xE108, 0xE8AA, 0xE0AC, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0xE0B0, 0xE0AE, 0xE0AE, 0xE8AE, 0xE0AE,
-    0xE0AC, 0xE0AE, 0xE8AC, 0xE0AC, 0xE0AA, 0xE108, 0xE0AA, 0xE8AA,
-    0xE0C8, 0xE108, 0x0000, 0x0000, 0xE108, 0xE945, 0xC0C6, 0xC185,
-    0xC165, 0x9AC3, 0xE9C5, 0xCA64, 0xCA64, 0x9AA3, 0x9AA3, 0xFC85,
-    0xF365, 0x0000, 0xFD65, 0xFE65, 0xFE65, 0xFE85, 0x9AA3, 0x0000,
-    0x0000, 0x0000, 0xD666, 0xD726, 0xCF26, 0xF725, 0xF725, 0xFF25,
-    0xFE65, 0xFE65, 0xF565, 0xFD85, 0x9AA3, 0x9AA3, 0xFC85, 0xFC85,
-    0xCA64, 0x9AA3, 0x90C4, 0xF285, 0xE9C5, 0xC165, 0x1842, 0xE965,
-    0xE145, 0xE106, 0x90E4, 0x0000, 0x0000, 0x0000, 0x0000, 0xE8AA,
-    0xE0C8, 0xE0AA, 0xE8AA, 0xE0AC, 0xE0AC, 0xE0AC, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x986B, 0x608B, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x608B, 0x988B, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0xE8B0, 0xE0AE, 0xE0B0, 0xE0AE, 0xE8AE,
-    0xE0AE, 0xE0AE, 0xC88E, 0x0000, 0x0000, 0x0000, 0x0000, 0xC0C6,
-    0xE8C8, 0xE0AA, 0xC88A, 0x0000, 0xE0C8, 0xE0E7, 0xE8E7, 0x90C4,
-    0xC0C6, 0xE165, 0xE945, 0xE9C5, 0x90E4, 0xCA64, 0xF285, 0xF365,
-    0xF365, 0xFC65, 0xF485, 0xFD65, 0xFD85, 0xF665, 0xFD65, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x64A6, 0xCF26, 0xF725, 0xF725, 0xF725,
-    0xFE65, 0xFE85, 0x9AA3, 0xCC64, 0xFD85, 0xF565, 0xFC85, 0xCB84,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xC185, 0xE9C5, 0xE1A6,
-    0xE965, 0xC0C6, 0x0000, 0xE108, 0xE8A8, 0x0000, 0x0000, 0x0000,
-    0x1842, 0xE0AC, 0xE0AC, 0xE0AC, 0xE8AC, 0xE0AE, 0xE0AC, 0xE8AC,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE0B0, 0xE0B0, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0xC8B1, 0xE0B0, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0xE0B0, 0xE0B0, 0xE0B0, 0xE0B0, 0xE0B0,
-    0xE0AE, 0xE0B0, 0xE0AE, 0x0000, 0x0000, 0x0000, 0x0000, 0xE0AC,
-    0xE8AA, 0x0000, 0xE0AA, 0xE0AA, 0xE0C8, 0xE8E7, 0x5884, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x90C4, 0xC165, 0xCA64, 0xF285, 0xEA65,
-    0xF285, 0xCA64, 0xF365, 0xF465, 0xFC85, 0xFD65, 0xFD85, 0x62A3,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFF25, 0xF725, 0xFF25,
-    0xF725, 0xCD65, 0x0000, 0x0000, 0x0000, 0x0000, 0x90C4, 0xFC85,
-    0xFB65, 0x5084, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE945,
-    0xE165, 0xE145, 0xE8E7, 0x0000, 0x0000, 0xE0C8, 0xE0A8, 0x0000,
-    0x0000, 0x0000, 0x5084, 0xE8AC, 0xC8AE, 0xC88A, 0xE8AC, 0xE0AE,
-    0xE0AE, 0xC8AE, 0x0000, 0x0000, 0x0000, 0x0000, 0x986B, 0xE8B0,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x1842, 0xD0B1, 0x588B, 0x0000,
-    0x0000, 0x0000, 0x0000, 0xB0D1, 0xE0B0, 0xE0B0, 0xE0B0, 0xE0B0,
-    0xE8AE, 0xE0B0, 0xC88E, 0x0000, 0x0000, 0x0000, 0x0000, 0xE0AC,
-    0xE0AC, 0x5884, 0x0000, 0xE8AA, 0xE0C8, 0xE0AA, 0xC0C6, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE9C5, 0xE9C5, 0xC165,
-    0x0000, 0x0000, 0x0000, 0x0000, 0xF365, 0xFC85, 0xF485, 0xFC65,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9AA3, 0xF725,
-    0xF725, 0xF725, 0xCD65, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0xFC85, 0xFB65, 0x62A3, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0xE165, 0xE126, 0xE906, 0x90C4, 0x0000, 0x0000, 0xE0AA,
-    0xE8AA, 0x988B, 0x0000, 0x0000, 0x0000, 0xE0AE, 0xE8AE, 0x90C4,
-    0xE0AE, 0xE0B0, 0xE8B0, 0x988B, 0x0000, 0x0000, 0x0000, 0x0000,
-    0xC88E, 0xB0D1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA8B1, 0xB0D1, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x986B, 0xC8B1, 0xE0B0, 0xE0B0, 0xE8B0,
-    0xC8AE, 0xE0B0, 0xE0B0, 0x0000, 0x0000, 0x0000, 0x988B, 0xE0AE,
-    0xE0AE, 0x0000, 0x0000, 0xC88A, 0xE8AA, 0xE108, 0xE8AA, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x5084, 0xE145, 0xC165, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF365, 0xFC85, 0xFD65,
-    0x3242, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0xFF45, 0xF725, 0xFE65, 0xFE65, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x5064, 0xCA64, 0xCA64, 0xFB65, 0xF285, 0x5084, 0x0000, 0x0000,
-    0x1842, 0x2042, 0xD927, 0xE106, 0xE8E7, 0xE0E7, 0x5084, 0x0000,
-    0x0000, 0xA08B, 0xE0AA, 0xE8AA, 0x0000, 0x0000, 0x0000, 0xC88E,
-    0xE0AE, 0x988B, 0xC88E, 0xE8B0, 0xE0B0, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x988B, 0xA8B1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA08B, 0x588B,
-    0x0000, 0x0000, 0x0000, 0x0000, 0xB0B1, 0xC8B1, 0xC8B1, 0xD0AE,
-    0xC88E, 0xE0B0, 0xC8B1, 0x0000, 0x0000, 0x0000, 0xC8AE, 0xE8B0,
-    0x90C4, 0x0000, 0x0000, 0x988B, 0xE8AC, 0xE0AC, 0xE8AA, 0xC88A,
-    0x0000, 0x5084, 0x0000, 0x0000, 0x90E4, 0xE906, 0xE906, 0xE126,
-    0xC0C6, 0x1842, 0x0000, 0x0000, 0x0000, 0x0000, 0xFB65, 0xFC85,
-    0xF485, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0xF725, 0xF725, 0xFF25, 0xFE85, 0x0000, 0x0000, 0x0000,
-    0x9AC3, 0xCB84, 0x98C4, 0x5084, 0x0000, 0xEA85, 0xE9C5, 0xE9C5,
-    0xE145, 0xE165, 0xE926, 0xE106, 0xE0E7, 0xE108, 0xE0C8, 0xE8AA,
-    0xC88A, 0x0000, 0xE0AA, 0xE0AC, 0xE0AC, 0xE8AE, 0xD08E, 0x0000,
-    0x0000, 0x988B, 0xE0B0, 0xE0B0, 0xC8B1, 0xE0B0, 0xC8B1, 0x0000,
-    0x0000, 0x0000, 0x0000, 0xB0D1, 0x608B, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x588B, 0x90D1,
-    0x0000, 0x0000, 0x0000, 0x0000, 0xB0B1, 0xC8B1, 0xA8D1, 0xB0B1,
-    0xC8B1, 0xD0B1, 0x988B, 0x0000, 0x0000, 0xC88E, 0xE0B0, 0xE0B0,
-    0xE0B0, 0x588B, 0x0000, 0xE8AE, 0xE0AE, 0xE0AE, 0xE0AC, 0xE8AC,
-    0xE0AA, 0xE0AC, 0xE0AA, 0xE8AA, 0xE0C8, 0xE108, 0xC88A, 0x0000,
-    0xC0C6, 0xE165, 0xE945, 0x5884, 0x0000, 0x0000, 0x1842, 0xF365,
-    0xF365, 0xFC65, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0xCD65, 0xFF25, 0xFE65, 0xFE65, 0x90C4, 0x0000,
-    0xCB84, 0xF365, 0x0000, 0x0000, 0x0000, 0x0000, 0xE1A6, 0xE9C5,
-    0xE165, 0xE945, 0xE106, 0xE126, 0xE0E7, 0xC0C6, 0x0000, 0x90E4,
-    0xE8A8, 0xE0AA, 0xE8AA, 0xE0AC, 0x988B, 0x1842, 0xE8AC, 0xE8AE,
-    0xE0AE, 0xC88E, 0x0000, 0x0000, 0xE0B0, 0xE0B0, 0xC8B1, 0xC8B1,
-    0x988B, 0x0000, 0x0000, 0x0000, 0xA06B, 0xA8D1, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x90D1,
-    0x608B, 0x0000, 0x0000, 0x0000, 0x988B, 0xB0B1, 0xA8D1, 0xB0B1,
-    0xA8D1, 0xD0B1, 0x0000, 0x0000, 0x986B, 0xE0B0, 0xC8B1, 0xE8B0,
-    0x988B, 0xE0B0, 0xE8AE, 0xE0B0, 0xE0AE, 0xE0AE, 0xC88E, 0xC88A,
-    0xC8AA, 0xE8AC, 0xE0AA, 0xE0AA, 0xE0C8, 0xE8A8, 0xE0C8, 0x90C4,
-    0x0000, 0x0000, 0x0000, 0x5884, 0xC185, 0x5884, 0x0000, 0xC165,
-    0xF285, 0xFB65, 0xCA64, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0xCC64, 0xFE65, 0xFE65, 0xFE85, 0x9CE5,
-    0x5084, 0xFC85, 0x0000, 0x0000, 0x0000, 0x0000, 0xC165, 0xEA85,
-    0xE9C5, 0xE9C5, 0xC0C6, 0xE106, 0xE0E7, 0xE108, 0xE8C8, 0xE8A8,
-    0x0000, 0x0000, 0x1842, 0xE0AC, 0xE8AC, 0x988B, 0x0000, 0x0000,
-    0x986B, 0xE0B0, 0xE0B0, 0xE8B0, 0xC8AE, 0xA8D1, 0xC8B1, 0xE8B0,
-    0xC8B1, 0xD0B1, 0x608B, 0x0000, 0x0000, 0x1842, 0x90D1, 0x608B,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x608B,
-    0x78D1, 0x0000, 0x0000, 0x0000, 0x1842, 0xA8D1, 0x90D1, 0xA8D1,
-    0x90D1, 0xB0D1, 0x1842, 0xB0B1, 0xA8D1, 0xD0B1, 0xC8B1, 0xA8B1,
-    0x0000, 0x0000, 0xC8AE, 0xE0B0, 0xE8B0, 0x588B, 0x0000, 0x0000,
-    0xC88E, 0xE0AE, 0xE8AC, 0xE0AC, 0xE0AA, 0xE0AA, 0xE8C8, 0xE0A8,
-    0xE8C8, 0x0000, 0x0000, 0x0000, 0x0000, 0x90C4, 0xC185, 0x0000,
-    0xE9C5, 0xF365, 0xF365, 0x9AA3, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x62A3, 0xFE65, 0xFD65, 0xFD85,
-    0xFC65, 0xCC84, 0x9AA3, 0x0000, 0x0000, 0x0000, 0x0000, 0xF285,
-    0xE9C5, 0xE1C5, 0xC165, 0xE106, 0x0000, 0x90E4, 0xE8A8, 0xE0C8,
-    0xE8A8, 0xE0AA, 0x5084, 0x0000, 0x608B, 0xE8AC, 0xE0AC, 0xE0AE,
-    0x0000, 0x0000, 0x0000, 0xE0B0, 0xE0B0, 0xE0B0, 0xC8B1, 0xC8B1,
-    0xD0B1, 0xC8B1, 0x988B, 0xB0B1, 0x0000, 0x0000, 0x0000, 0x78F1,
-    0x588B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x608B, 0x6111, 0x0000, 0x0000, 0x0000, 0x78D1, 0x78F1, 0x78D1,
-    0x90D1, 0x90F1, 0x90D1, 0xA8D1, 0xB0D1, 0xA8B1, 0xB0D1, 0x1842,
-    0x0000, 0x0000, 0xD0B1, 0xE0B0, 0xE0B0, 0x986B, 0x0000, 0x5884,
-    0xE8AE, 0xE0AE, 0xE8AC, 0xE0AC, 0x988B, 0x986B, 0xC88A, 0xE8AA,
-    0xE0C8, 0xE8C8, 0xC0C6, 0x0000, 0x0000, 0x0000, 0x0000, 0xC165,
-    0x90E4, 0xF285, 0xF265, 0xF365, 0x5084, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFE65, 0xFE85,
-    0xFD65, 0xFD85, 0xFC85, 0x1842, 0x0000, 0x0000, 0x0000, 0x5084,
-    0xE9C5, 0xE9C5, 0xE145, 0xE965, 0x5884, 0x0000, 0x0000, 0x90C4,
-    0xE0C8, 0xE0AA, 0xE8AA, 0xE8AC, 0x90C4, 0x90E4, 0xE0AC, 0xE0AE,
-    0xE8AE, 0xE0B0, 0xE0B0, 0x608B, 0x1842, 0xE8B0, 0xC8B1, 0x608B,
-    0x0000, 0xC8B1, 0xA8B1, 0xB0D1, 0x90D1, 0x78F1, 0x0000, 0x0000,
-    0x2042, 0x78D1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x1842, 0x6911, 0x1842, 0x0000, 0x0000, 0x6111, 0x78F1, 0x78D1,
-    0x78F1, 0x90D1, 0x78F1, 0x608B, 0x986B, 0xB0D1, 0xB0B1, 0x0000,
-    0x1842, 0xC8B1, 0xC8B1, 0xD0B1, 0xC8B1, 0xE0B0, 0x0000, 0x988B,
-    0xE0B0, 0xE0B0, 0xE0AE, 0xE8AE, 0x5084, 0x0000, 0x0000, 0xC88A,
-    0xE8AA, 0xE0AA, 0xE0C8, 0xE0E7, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x90C4, 0xE9C5, 0xE9C5, 0xF265, 0xF285, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFE65,
-    0xFD65, 0xF565, 0xFC85, 0xF465, 0x1842, 0x0000, 0x0000, 0x0000,
-    0x0000, 0xE9C5, 0xE945, 0xE165, 0xE106, 0xE8E7, 0x1842, 0x0000,
-    0x0000, 0x90E4, 0xE8A8, 0xE0AA, 0xE8AA, 0xE0AC, 0xE0AC, 0xE0AE,
-    0xE8AE, 0xC8AE, 0xE0AE, 0xE0B0, 0xE0B0, 0xE0B0, 0xC8B1, 0xC8B1,
-    0xB0B1, 0x0000, 0x0000, 0x588B, 0x90D1, 0xB0D1, 0x88D1, 0x0000,
-    0x0000, 0x0000, 0x608B, 0x4951, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x4931, 0x608B, 0x0000, 0x0000, 0x0000, 0x4951, 0x6111,
-    0x6911, 0x78F1, 0x190B, 0x0000, 0x0000, 0x90D1, 0x90D1, 0x90F1,
-    0x90D1, 0xA8D1, 0xB0D1, 0xC8B1, 0x986B, 0xD0B1, 0xC8B1, 0xC8B1,
-    0xE8B0, 0xE0B0, 0xE0AE, 0xE0B0, 0x1842, 0x0000, 0x0000, 0x1842,
-    0xD0AE, 0xE8AC, 0xE0A8, 0xE8AA, 0xE0C8, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x90C4, 0xE965, 0xE9C5, 0xE9C5, 0xEA85, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0xFD65, 0xFE85, 0xFD65, 0xF585, 0xFC85, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0xC165, 0xE9C5, 0xE165, 0xE945, 0xE108, 0xE0E7,
-    0xE8C8, 0xE108, 0x90E4, 0xE0AC, 0xE0AA, 0xE0AC, 0xE8AC, 0xE0AE,
-    0xE0AE, 0xE0B0, 0xE0B0, 0xE0B0, 0xE0B0, 0xE8B0, 0xC8B1, 0xC8B1,
-    0xC8B1, 0xD0B1, 0x90D1, 0x0000, 0x0000, 0x588B, 0x90F1, 0x90D1,
-    0x6911, 0x0000, 0x0000, 0x608B, 0x4951, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x4931, 0x608B, 0x0000, 0x0000, 0x4951, 0x6111,
-    0x4931, 0x6111, 0x0000, 0x0000, 0x0000, 0x78D1, 0x78F1, 0x90F1,
-    0x88D1, 0xB0D1, 0x90D1, 0xA8B1, 0xB0D1, 0xC8B1, 0xC8B1, 0xC8B1,
-    0xC8B1, 0xE0B0, 0xE0B0, 0xE8B0, 0xC88E, 0x0000, 0x988B, 0xE0AE,
-    0xE0AC, 0xE8AC, 0xE0AA, 0xE0AC, 0xE8A8, 0x988B, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x90C4, 0xE9C5, 0xE9C5, 0xEA65, 0xCA64, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0xF465, 0xFD85, 0xFD65, 0xF485, 0xFC65, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0xE9C5, 0xE145, 0xE165, 0xE108, 0xE0E7,
-    0xE0A8, 0xE0C8, 0xE8A8, 0xE0AA, 0xE0AA, 0xE0AC, 0xE8AC, 0xE0AE,
-    0xE0AE, 0xE0AE, 0xE8AE, 0xE0B0, 0xE0B0, 0xE0B0, 0xC8B1, 0xC8B1,
-    0xC8B1, 0xC8B1, 0xB0D1, 0xA8B1, 0x1842, 0x0000, 0x0000, 0x78F1,
-    0x78D1, 0x6911, 0x1842, 0x0000, 0x0000, 0x4931, 0x210B, 0x0000,
-    0x0000, 0x0000, 0x190B, 0x5151, 0x0000, 0x0000, 0x1842, 0x5131,
-    0x3191, 0x4951, 0x190B, 0x0000, 0x0000, 0x5131, 0x6111, 0x6911,
-    0x78F1, 0x78F1, 0x78D1, 0x90D1, 0x90F1, 0xA8D1, 0xB0B1, 0xC8B1,
-    0xC8B1, 0xC8B1, 0xD0B1, 0xE0B0, 0xE0B0, 0xE0B0, 0xE0AE, 0xE8AE,
-    0xE0AE, 0xE0AE, 0xE0AC, 0xE8AC, 0xE0AA, 0xE0AA, 0xC0C6, 0x0000,
-    0x0000, 0x0000, 0x0000, 0xC185, 0xE945, 0xE9C5, 0xE9C5, 0xC185,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x9AA3, 0xFD65, 0xF485, 0xFC65, 0xFC85, 0xCA64,
-    0x0000, 0x0000, 0x0000, 0xC185, 0xE165, 0xE106, 0x0000, 0xC0C6,
-    0xE0A8, 0xE108, 0xE8C8, 0xE0AA, 0xE0AA, 0xE0AC, 0xE8AC, 0xE0AE,
-    0xE0AE, 0xE0B0, 0xE0AE, 0xE0B0, 0xE8AE, 0xE0B0, 0xC8B1, 0xD0B1,
-    0xC8B1, 0xC8B1, 0xB0B1, 0xA8D1, 0x90D1, 0xB0D1, 0x0000, 0x0000,
-    0x78F1, 0x6111, 0x210B, 0x6111, 0x0000, 0x0000, 0x210B, 0x4931,
-    0x0000, 0x0000, 0x0000, 0x3191, 0x190B, 0x0000, 0x0000, 0x4951,
-    0x3191, 0x0000, 0x3191, 0x4931, 0x0000, 0x608B, 0x4931, 0x6111,
-    0x6111, 0x78F1, 0x78F1, 0x90D1, 0x78F1, 0x90D1, 0x88D1, 0xB0D1,
-    0xA8B1, 0xD0B1, 0xC8B1, 0xE0B0, 0xC8B1, 0xE0B0, 0xE0B0, 0xE0B0,
-    0xE0AE, 0xE0B0, 0xE0AE, 0xE8AE, 0x988B, 0xC0C6, 0xE0AA, 0xE8AA,
-    0x1842, 0x0000, 0x0000, 0x0000, 0xE106, 0xE965, 0xE145, 0xE9C5,
-    0x5084, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x5084, 0xFD85, 0xFD85, 0xFC65, 0xFC85,
-    0xF365, 0xCA64, 0x0000, 0x0000, 0xC165, 0xE9C5, 0x5084, 0x0000,
-    0x0000, 0x0000, 0xC88A, 0xE8C8, 0xE0AA, 0xE8AC, 0xE0AA, 0xE0AC,
-    0xC88E, 0xC8AE, 0x5884, 0x1842, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x5884, 0xB0B1, 0x90D1, 0x90F1, 0x78F1, 0x78D1,
-    0x588B, 0x6111, 0x0000, 0x0000, 0x4931, 0x608B, 0x0000, 0x0000,
-    0x3191, 0x190B, 0x0000, 0x210B, 0x3191, 0x0000, 0x0000, 0x190B,
-    0x3191, 0x3191, 0x0000, 0x3191, 0x3191, 0x190B, 0x3191, 0x4951,
-    0x4931, 0x6911, 0x4951, 0x608B, 0x1842, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x608B, 0x608B, 0x90D1, 0xB0D1, 0xC8B1, 0xD0B1, 0xE0B0,
-    0xE0B0, 0xE0B0, 0xE0AE, 0xC8AE, 0x0000, 0x0000, 0x0000, 0xE8AA,
-    0xE0A8, 0x90E4, 0x0000, 0x0000, 0xC0C6, 0xE906, 0xE106, 0xE165,
-    0xE9C5, 0x1842, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFD85, 0xF465, 0xFC85,
-    0xF365, 0xF365, 0xF265, 0xEA85, 0xE9C5, 0xE9C5, 0xE165, 0xE165,
-    0xE906, 0xE106, 0xE0C8, 0xE0A8, 0xE8C8, 0xE908, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1842, 0x78F1, 0x90D1,
-    0x78D1, 0x78F1, 0x6911, 0x1842, 0x0000, 0x4951, 0x3191, 0x0000,
-    0x0000, 0x3191, 0x3191, 0x0000, 0x09EE, 0x3191, 0x0000, 0x0000,
-    0x21F2, 0x2212, 0x210B, 0x0000, 0x190B, 0x2212, 0x3191, 0x4951,
-    0x3191, 0x4931, 0x2042, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x1842, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x988B, 0xE0B0, 0xE0B0, 0xE0AE, 0xE0AE, 0xE0AC, 0xE8AC,
-    0xE0AA, 0xE108, 0xC88A, 0xE0A8, 0xE0C8, 0xE926, 0xE106, 0xE145,
-    0xE965, 0xE9C5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCC64, 0xFC85,
-    0xF365, 0xF365, 0xF265, 0xEA85, 0xE9C5, 0xE9C5, 0xE145, 0xE145,
-    0xE106, 0xE126, 0xE8C8, 0xE0A8, 0xE0C8, 0xE0AA, 0xE8AA, 0xE0AA,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x6111, 0x4931, 0x4931, 0x4951, 0x0000, 0x190B, 0x3191,
-    0x210B, 0x0000, 0x1842, 0x2212, 0x2212, 0x21F2, 0x0000, 0x0000,
-    0x210B, 0x2212, 0x2212, 0x0000, 0x1842, 0x21F2, 0x3191, 0x3191,
-    0x3191, 0x190B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0xD0B1, 0xE8B0, 0xE0AE, 0xE8AE, 0xE0AC, 0xE0AE,
-    0xE0AC, 0xE8AC, 0xE0AA, 0xE0AA, 0xE0C8, 0xE8A8, 0xE0C8, 0xE106,
-    0xE106, 0xE965, 0xC185, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCB84,
-    0xF485, 0xFC65, 0xF365, 0xF365, 0xF285, 0xEA85, 0xE9C5, 0xE9C5,
-    0xE165, 0xE106, 0xE8E7, 0xE0E7, 0xE0C8, 0xE0AA, 0xC88A, 0xE8AC,
-    0xE8AC, 0xA08B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x4931, 0x4931, 0x4931, 0x3191, 0x0000,
-    0x2991, 0x2212, 0x0000, 0x3191, 0x2212, 0x1A53, 0x21F2, 0x3191,
-    0x0000, 0x12B4, 0x1A53, 0x2212, 0x0000, 0x1A53, 0x2212, 0x2212,
-    0x09EE, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0xA8B1, 0xE0B0, 0xE0B0, 0xC8B1, 0xE8AE, 0xE0AE,
-    0xE0AC, 0xE0AE, 0xE8AC, 0xE0AC, 0xE0AA, 0xE0AA, 0xE8C8, 0xE0E7,
-    0xE0E7, 0xE145, 0xE965, 0x90C4, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x1842, 0xFC65, 0xFB65, 0xF365, 0xF285, 0xEA65, 0xE9C5, 0xE9C5,
-    0xE145, 0xE165, 0x90C4, 0x0000, 0x90E4, 0xE8A8, 0xE0C8, 0xE8AA,
-    0xE0AA, 0xE0AC, 0xE0AC, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4931, 0x2991, 0x3191,
-    0x3191, 0x190B, 0x3191, 0x2042, 0x09EE, 0x1A73, 0x1A53, 0x12B4,
-    0x09EE, 0x2042, 0x1A53, 0x12B4, 0x0000, 0x1AB4, 0x1A53, 0x1A53,
-    0x210B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x5884, 0xE8B0, 0xE0B0, 0xE0B0, 0xE0AE, 0xE0B0,
-    0xE0AE, 0x988B, 0x1842, 0xE8AC, 0xE8AA, 0xE0AA, 0xE8A8, 0xE0C8,
-    0xE0A8, 0xE108, 0xE108, 0xE165, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0xF485, 0xFC65, 0xF365, 0xF365, 0xF285, 0xF285,
-    0xE1C6, 0xE1A6, 0xE165, 0xE106, 0xC0C6, 0xE108, 0xE8C8, 0xE0AA,
-    0xE0AA, 0xE8AC, 0xC88A, 0xC8AE, 0xE8AE, 0x2042, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4931,
-    0x2991, 0x21F2, 0x3191, 0x2212, 0x1A53, 0x3A42, 0x1AB4, 0x12B4,
-    0x1AB4, 0x190B, 0x1AB4, 0x0B56, 0x210B, 0x1356, 0x12B4, 0x1AB4,
-    0x09EE, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1842, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x608B, 0xC8B1, 0xA8D1, 0xE0B0, 0xE0B0, 0xE0B0,
-    0xE0AE, 0xE8B0, 0xC88E, 0xC8AE, 0xE0AC, 0xE0AC, 0xE0AA, 0xE8AA,
-    0xE0C8, 0xE108, 0xE0E7, 0xE106, 0xE906, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0xCA64, 0xF365, 0xFB65, 0xEA65, 0xF285,
-    0xE9C5, 0xC0C6, 0xE145, 0xE106, 0xE0E7, 0xE0E7, 0xE8C8, 0xE0A8,
-    0xE0C8, 0xE0AA, 0xE8AA, 0xE0AC, 0xC88E, 0xE0AE, 0xC8B1, 0x988B,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1842, 0x3191,
-    0x3191, 0x2212, 0x3191, 0x21F2, 0x2212, 0x12B4, 0x2042, 0x12B4,
-    0x1AB4, 0x0B56, 0x0000, 0x1356, 0x1356, 0x0B33, 0x12B4, 0x1356,
-    0x12B4, 0x1AB4, 0x1A53, 0x210B, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x608B, 0xB0B1, 0xA8D1, 0x986B, 0xD0B1, 0xE0B0,
-    0xE0B0, 0xE0B0, 0xE8AE, 0xE0AE, 0xE0AC, 0xE0AC, 0xE8AA, 0xE0AA,
-    0x988B, 0xE8A8, 0xE0C8, 0xE0E7, 0xE0E7, 0xC0C6, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFC65, 0xF365, 0xF285,
-    0xE9C5, 0xC185, 0x90C4, 0xC185, 0xE126, 0xE906, 0xE0E7, 0xE0A8,
-    0xE0C8, 0xE8AA, 0xE0AA, 0xE0AC, 0xE0AC, 0xE8AE, 0xE8AE, 0x1842,
-    0xD08E, 0xD0AE, 0x5884, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x1842, 0x608B, 0x4951, 0x4931, 0x4931,
-    0x3191, 0x2212, 0x21F2, 0x2042, 0x2212, 0x1AB4, 0x12B4, 0x1356,
-    0x12B4, 0x1356, 0x1356, 0x0BF8, 0x1356, 0x0BD8, 0x0B56, 0x2042,
-    0x12B4, 0x1356, 0x1356, 0x1356, 0x12B4, 0x1AB4, 0x2212, 0x1842,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x1842, 0x78D1, 0xB0D1, 0x588B, 0xC8B1, 0xC8B1, 0xE0B0,
-    0xE0B0, 0xE0B0, 0xE0B0, 0xE0B0, 0xE8AE, 0xE0AE, 0xE0AC, 0xE0AC,
-    0xE8AA, 0x5884, 0xE0A8, 0xE0C8, 0xE0E7, 0xE906, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9AA3, 0xF365,
-    0xF285, 0xF285, 0xE145, 0x90C4, 0x0000, 0xC0C6, 0xE0E7, 0xE8E7,
-    0xE0C8, 0xE0AA, 0xE0AA, 0xE8AA, 0x0000, 0xE0AE, 0xE0AC, 0xC88E,
-    0x0000, 0x1842, 0xE8B0, 0xE0B0, 0xC8B1, 0xC8B1, 0xB0D1, 0xA8B1,
-    0x90D1, 0x78F1, 0x78F1, 0x78D1, 0x6111, 0x6111, 0x4931, 0x4951,
-    0x0000, 0x3191, 0x3191, 0x2212, 0x2212, 0x12B4, 0x1A53, 0x1A53,
-    0x12B4, 0x1356, 0x1356, 0x0BD8, 0x0BD8, 0x0BF8, 0x1356, 0x0BD8,
-    0x0B56, 0x0B33, 0x1356, 0x1356, 0x190B, 0x210B, 0x1A53, 0x1A53,
-    0x2212, 0x2212, 0x09EE, 0x3191, 0x2042, 0x190B, 0x2042, 0x4931,
-    0x608B, 0x78F1, 0x78D1, 0x90D1, 0x0000, 0x0000, 0xB0D1, 0xC8B1,
-    0xC8B1, 0xA08B, 0xE0B0, 0xE0B0, 0xE0AE, 0xE8AE, 0xE0AC, 0xE0AC,
-    0x0000, 0x90C4, 0x988B, 0xE8A8, 0xE8C8, 0xE0E7, 0x90C4, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0xF285, 0xF365, 0xE9C5, 0xE9C5, 0xE165, 0xC0C6, 0xE126, 0xE906,
-    0xE0A8, 0x988B, 0xE8AA, 0xE8AA, 0x5084, 0x0000, 0x986B, 0xE8AE,
-    0xE0AE, 0xE0B0, 0xE0B0, 0xE0B0, 0xC8B1, 0xE8B0, 0xC8B1, 0xC8B1,
-    0xB0D1, 0xA8B1, 0x78F1, 0x608B, 0x6911, 0x6111, 0x0000, 0x0000,
-    0x0000, 0x2042, 0x3191, 0x21F2, 0x2212, 0x12B4, 0x1AD4, 0x09EE,
-    0x0000, 0x1356, 0x0B56, 0x0BD8, 0x0BD8, 0x0C99, 0x0BD8, 0x0000,
-    0x0BD8, 0x0499, 0x0BD8, 0x0BD8, 0x1356, 0x0B33, 0x0000, 0x0000,
-    0x0000, 0x1A53, 0x2212, 0x2212, 0x190B, 0x4951, 0x3191, 0x4931,
-    0x4931, 0x6111, 0x78F1, 0x90F1, 0x90D1, 0xB0B1, 0x988B, 0xC8B1,
-    0xD0B1, 0x588B, 0x0000, 0x608B, 0xE0B0, 0xE0B0, 0x986B, 0xE0AE,
-    0xE0AC, 0xE8AC, 0x5884, 0xE0AC, 0xE0C8, 0xE0A8, 0xE8C8, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x90C4, 0xE9C5, 0xE9C5, 0xE145, 0xE106, 0xE126,
-    0xC0C6, 0x90E4, 0xC88A, 0xE8AA, 0xC88A, 0x0000, 0x0000, 0x1842,
-    0xE8AE, 0xE0AE, 0xE0AE, 0xE0B0, 0x1842, 0x0000, 0xD0B1, 0xA8D1,
-    0xA08B, 0xA8B1, 0x90D1, 0x90F1, 0x588B, 0x6111, 0x0000, 0x0000,
-    0x0000, 0x3191, 0x3191, 0x2991, 0x3191, 0x1A53, 0x2212, 0x09EE,
-    0x0000, 0x0000, 0x1356, 0x0BF8, 0x0BD8, 0x0499, 0x0BD8, 0x0C79,
-    0x0000, 0x0000, 0x0BD8, 0x0499, 0x0BD8, 0x0BD8, 0x1356, 0x1356,
-    0x190B, 0x0000, 0x0000, 0x2212, 0x2212, 0x09EE, 0x3191, 0x3191,
-    0x3191, 0x0000, 0x4931, 0x6911, 0x0000, 0x90D1, 0x90F1, 0xA8D1,
-    0xB0B1, 0xC8B1, 0x0000, 0x0000, 0x0000, 0xE0B0, 0xE8AE, 0xC8AE,
-    0x986B, 0xE8AE, 0xE0AC, 0xE0AC, 0xE8AA, 0xE0AA, 0x90E4, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x90C4, 0xC185, 0xE965,
-    0xE108, 0xE108, 0xC88A, 0xE0A8, 0xE8C8, 0xC88A, 0x5884, 0x5884,
-    0x5084, 0xE0AE, 0xE8AE, 0xD0AE, 0x0000, 0x0000, 0x588B, 0xC8B1,
-    0x90D1, 0x0000, 0xB0D1, 0xA8D1, 0x90D1, 0x90D1, 0x2042, 0x0000,
-    0x0000, 0x4931, 0x3191, 0x2042, 0x1842, 0x2212, 0x2212, 0x1AB4,
-    0x0000, 0x0000, 0x09EE, 0x0BF8, 0x0BD8, 0x0C79, 0x0479, 0x0C79,
-    0x0479, 0x0000, 0x0000, 0x3A22, 0x0479, 0x0C99, 0x0BD8, 0x0000,
-    0x12D4, 0x1356, 0x09EE, 0x0000, 0x0000, 0x2212, 0x2991, 0x3191,
-    0x3191, 0x4931, 0x0000, 0x6111, 0x6911, 0x0000, 0x0000, 0x1842,
-    0x90D1, 0xC8B1, 0xC8B1, 0x0000, 0x0000, 0x0000, 0xC8AE, 0xE0B0,
-    0xE0AE, 0xE0AE, 0xE8AC, 0xE0AC, 0xE8AA, 0x986B, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x1842, 0x5884, 0x98E4, 0xC0C6, 0xC88A, 0xC88A, 0xE8AA,
-    0xC8AE, 0xE0AC, 0xE8AE, 0xE0AE, 0x5084, 0xB0D1, 0x0000, 0xC8B1,
-    0xC8B1, 0xD0B1, 0x0000, 0x986B, 0x90D1, 0x90F1, 0x78F1, 0x6111,
-    0x1842, 0x4931, 0x210B, 0x0000, 0x0000, 0x3191, 0x2212, 0x1A53,
-    0x0000, 0x0000, 0x0000, 0x09EE, 0x0BF8, 0x0479, 0x0BD8, 0x0499,
-    0x0C79, 0x0479, 0x0000, 0x0000, 0x0000, 0x0BD8, 0x0BD8, 0x0BF8,
-    0x210B, 0x0000, 0x210B, 0x12B4, 0x09EE, 0x2042, 0x2212, 0x2212,
-    0x3191, 0x3191, 0x0000, 0x0000, 0x4931, 0x6111, 0x608B, 0x6111,
-    0x190B, 0x78D1, 0xB0D1, 0xD0B1, 0x986B, 0xB0D1, 0x986B, 0xD0AE,
-    0x986B, 0xD0AE, 0x5084, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x2042, 0x1842, 0x0000, 0x1842, 0xE0B0, 0xA06B, 0xC8AE,
-    0xC8B1, 0xC8B1, 0xD0B1, 0xA8B1, 0x608B, 0xB0D1, 0x90D1, 0x78F1,
-    0x6111, 0x6911, 0x606B, 0x0000, 0x0000, 0x0000, 0x2212, 0x1A53,
-    0x0A0E, 0x0000, 0x0000, 0x0000, 0x09EE, 0x0BD8, 0x0BD8, 0x0479,
-    0x0C79, 0x0479, 0x0C79, 0x0000, 0x0000, 0x0000, 0x0000, 0x0499,
-    0x0BD8, 0x0BF8, 0x0000, 0x0000, 0x0000, 0x1AB4, 0x1A53, 0x1A53,
-    0x3191, 0x2212, 0x190B, 0x4931, 0x4931, 0x6911, 0x6111, 0x78F1,
-    0x608B, 0x90D1, 0x1842, 0x0000, 0x0000, 0x608B, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x5884, 0xE8B0, 0xE0AE, 0xE0B0,
-    0xE0B0, 0xE0B0, 0xC8B1, 0xC8B1, 0xB0D1, 0xA8B1, 0x90D1, 0x90F1,
-    0x78F1, 0x6111, 0x4931, 0x4931, 0x0000, 0x0000, 0x190B, 0x2212,
-    0x2212, 0x0000, 0x0000, 0x0000, 0x0000, 0x09EE, 0x0BF8, 0x0C79,
-    0x0C79, 0x0479, 0x0C79, 0x0479, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0B33, 0x0479, 0x0BD8, 0x2042, 0x0000, 0x09EE, 0x1A73, 0x1A53,
-    0x2212, 0x21F2, 0x3191, 0x3191, 0x3191, 0x4931, 0x4951, 0x6911,
-    0x78F1, 0x78D1, 0x90D1, 0xA8D1, 0x1842, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0xC88E, 0xE0AE, 0xE8AE, 0xE0B0,
-    0xE0B0, 0xE0B0, 0xC8B1, 0xD0B1, 0x988B, 0xA8B1, 0xB0D1, 0x90D1,
-    0x78F1, 0x78F1, 0x6111, 0x6911, 0x4931, 0x5151, 0x190B, 0x3191,
-    0x3191, 0x3191, 0x0000, 0x0000, 0x0000, 0x0000, 0x09EE, 0x0BD8,
-    0x0BD8, 0x0479, 0x0C79, 0x0479, 0x0C99, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0BD8, 0x0BF8, 0x1356, 0x0333, 0x1AB4, 0x12B4,
-    0x1A53, 0x1A53, 0x2212, 0x3191, 0x3191, 0x4931, 0x4931, 0x6111,
-    0x6111, 0x78F1, 0x90F1, 0x88D1, 0x90D1, 0xD0B1, 0xB0D1, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x988B, 0xE8AC, 0xE0AE, 0xE8AE, 0xE0AE,
-    0xE0AE, 0xE0B0, 0xC8B1, 0xE0B0, 0xA8B1, 0x0000, 0xB0D1, 0xA8B1,
-    0x90D1, 0x90F1, 0x6111, 0x6111, 0x4931, 0x4951, 0x3191, 0x3191,
-    0x3191, 0x2212, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x09EE,
-    0x0BF8, 0x0479, 0x0BD8, 0x0499, 0x0C79, 0x0479, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x210B, 0x0BD8, 0x0BD8, 0x12B4, 0x1AB4,
-    0x1A53, 0x1A53, 0x2212, 0x2212, 0x3191, 0x3191, 0x3191, 0x1842,
-    0x210B, 0x60F1, 0x78F1, 0x90D1, 0x90D1, 0xB0D1, 0xA8D1, 0xC8B1,
-    0xD0B1, 0x986B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0xE0AC, 0xE0AA, 0xE8AE, 0xE0AC, 0xE0AE,
-    0xE8AE, 0xE0B0, 0xE0B0, 0xE0B0, 0xA8B1, 0xB0D1, 0xA8B1, 0xD0B1,
-    0x78F1, 0xB0D1, 0x90D1, 0x1842, 0x6111, 0x6911, 0x4931, 0x4931,
-    0x3191, 0x2212, 0x210B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x12B4, 0x0BF8, 0x0BD8, 0x0C79, 0x0479, 0x0C79, 0x0479, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0BF8, 0x1356, 0x1356,
-    0x12B4, 0x12B4, 0x1A53, 0x0000, 0x3191, 0x2212, 0x3191, 0x4931,
-    0x4951, 0x4931, 0x6111, 0x78F1, 0x90D1, 0xB0B1, 0xA8D1, 0xC8B1,
-    0xC8B1, 0xE8B0, 0xC8B1, 0xE0B0, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x5084, 0xE8AA, 0xE8AA, 0xE0AC, 0xE0AC, 0xE0AE,
-    0xE8AE, 0xE0AE, 0xE0AE, 0xC8AE, 0xE0B0, 0xE0B0, 0xC8B1, 0xB0B1,
-    0xA8D1, 0x78D1, 0x90D1, 0x90F1, 0x0000, 0x6111, 0x4931, 0x4951,
-    0x3191, 0x4931, 0x3191, 0x2991, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0B33, 0x0B56, 0x0BF8, 0x0BF8, 0x0C79, 0x0BD8, 0x0BF8,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0B33, 0x0B56, 0x1356,
-    0x1AB4, 0x12B4, 0x2212, 0x21F2, 0x0000, 0x3191, 0x3191, 0x3191,
-    0x3191, 0x4931, 0x4951, 0x6111, 0x78F1, 0x90D1, 0x90D1, 0xB0D1,
-    0xA8D1, 0xD0B1, 0xC8B1, 0xE0B0, 0xE0B0, 0xE0B0, 0x1842, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0xC0C6, 0xE8A8, 0xE0C8, 0xE0AC, 0xE0AA, 0xE8AC,
-    0xE0AC, 0xE0AE, 0xE8AE, 0xE0B0, 0xC8B1, 0xE0B0, 0xC8B1, 0xD0B1,
-    0xA8B1, 0xD0B1, 0x588B, 0xB0D1, 0x90F1, 0x90D1, 0x6111, 0x6911,
-    0x4931, 0x4931, 0x190B, 0x3191, 0x3191, 0x2212, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x1AB4, 0x1356, 0x0B56, 0x0BF8, 0x0BD8, 0x0C79,
-    0x0BD8, 0x0000, 0x0000, 0x0000, 0x0000, 0x3242, 0x1356, 0x1356,
-    0x1A53, 0x0B33, 0x12B4, 0x1A53, 0x2212, 0x2991, 0x3191, 0x3191,
-    0x3191, 0x4951, 0x4931, 0x6111, 0x6111, 0x90F1, 0x90D1, 0x78D1,
-    0xA8D1, 0x78D1, 0xB0D1, 0xC8B1, 0xC8B1, 0xE0B0, 0xE0B0, 0xE0B0,
-    0xA06B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0xC0C6, 0xE0E7, 0xE0C8, 0xE0AA, 0xE8AA, 0xE0AC,
-    0xE0AC, 0xE0AE, 0xE8AC, 0xE0AE, 0x5084, 0x5884, 0xE8B0, 0xE0B0,
-    0x0000, 0xC8B1, 0xA8B1, 0x90D1, 0x90F1, 0x88D1, 0x78F1, 0x78F1,
-    0x6111, 0x6111, 0x0000, 0x0000, 0x210B, 0x3191, 0x2991, 0x210B,
-    0x0000, 0x0000, 0x0000, 0x12B4, 0x12B4, 0x1356, 0x1356, 0x0BD8,
-    0x0BF8, 0x0BD8, 0x0000, 0x0000, 0x0000, 0x0000, 0x1356, 0x0B56,
-    0x1AB4, 0x0000, 0x0000, 0x1A53, 0x2212, 0x2212, 0x3191, 0x3191,
-    0x3191, 0x4931, 0x4931, 0x6111, 0x210B, 0x0000, 0x78F1, 0x90D1,
-    0x0000, 0x90D1, 0xA8D1, 0xD0B1, 0xC8B1, 0xE0B0, 0xE0B0, 0xE0B0,
-    0xE8AE, 0xE0AE, 0xC8AE, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0xE906, 0xE106, 0xE0E7, 0xE108, 0xE0C8, 0xE8AA,
-    0xE0AA, 0xE0AC, 0xE0AC, 0xE8AE, 0xE0AE, 0xE0B0, 0xC8B1, 0xE0B0,
-    0xE8B0, 0xC88E, 0xC8B1, 0xC8B1, 0xB0D1, 0xA8D1, 0x90D1, 0x90D1,
-    0x78F1, 0x78D1, 0x6911, 0x190B, 0x0000, 0x0000, 0x3191, 0x2212,
-    0x3191, 0x0000, 0x0000, 0x0000, 0x1AB4, 0x1356, 0x0B56, 0x1356,
-    0x1356, 0x0BD8, 0x1356, 0x0000, 0x0000, 0x0000, 0x09EE, 0x1356,
-    0x12B4, 0x0000, 0x0000, 0x0000, 0x2212, 0x1A53, 0x2212, 0x2212,
-    0x3191, 0x4931, 0x4951, 0x6111, 0x6111, 0x608B, 0x6111, 0x90D1,
-    0x78D1, 0x78F1, 0xA8B1, 0xC8B1, 0xC8B1, 0xE0B0, 0xE0B0, 0xE0B0,
-    0xE0B0, 0xE0B0, 0xE0AE, 0xE8AE, 0xE0AC, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0xD127, 0xE126, 0xE0E7, 0xE8E7, 0xE0C8, 0xE0A8,
-    0xE0C8, 0xE8AC, 0xC88E, 0xE0AC, 0xE0AC, 0xE8AE, 0xE0AE, 0xE0B0,
-    0xE0B0, 0xE0B0, 0xC8B1, 0xC8B1, 0xA8D1, 0xB0B1, 0x90D1, 0x88F1,
-    0x90D1, 0x78F1, 0x6111, 0x6111, 0x4931, 0x0000, 0x0000, 0x0000,
-    0x3191, 0x2212, 0x1842, 0x0000, 0x2212, 0x1A53, 0x1A53, 0x1AB4,
-    0x12B4, 0x1356, 0x1AB4, 0x0333, 0x1AB4, 0x0000, 0x0000, 0x1356,
-    0x12B4, 0x09EE, 0x0000, 0x0000, 0x09EE, 0x2212, 0x3191, 0x3191,
-    0x3191, 0x3191, 0x3191, 0x4931, 0x4951, 0x6911, 0x6111, 0x78F1,
-    0x90D1, 0xB0D1, 0x88D1, 0xB0D1, 0xA8B1, 0xD0B1, 0xC8B1, 0xE0B0,
-    0xE0B0, 0xE0B0, 0xE8AE, 0xE0AE, 0xE0AC, 0xE0AC, 0xC8AE, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0xE165, 0xE965, 0xE106, 0xE106, 0xE0E7, 0xE8E7,
-    0xE0C8, 0xE8AA, 0x986B, 0x0000, 0xC8AE, 0xE0AE, 0xE0AE, 0xE8AE,
-    0xE0AE, 0xE0B0, 0xE8AE, 0xC8B1, 0xC8B1, 0xC8B1, 0xB0B1, 0xB0D1,
-    0x90D1, 0x0000, 0x6111, 0x78F1, 0x6111, 0x6911, 0x4931, 0x0000,
-    0x0000, 0x2991, 0x3191, 0x3191, 0x2042, 0x2212, 0x0000, 0x12B4,
-    0x1A53, 0x1AB4, 0x12B4, 0x1356, 0x0000, 0x0B33, 0x0000, 0x09EE,
-    0x1AB4, 0x12B4, 0x0000, 0x0000, 0x190B, 0x1A53, 0x2212, 0x2212,
-    0x3191, 0x0000, 0x3191, 0x4931, 0x4931, 0x6111, 0x6111, 0x78F1,
-    0x78F1, 0x90D1, 0x90D1, 0xA8D1, 0xB0B1, 0xC8B1, 0xD0B1, 0x988B,
-    0x1842, 0xE0B0, 0xE0B0, 0xE0AE, 0xE8AE, 0xE0AE, 0xE0AC, 0xE8AC,
-    0xC88A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x90C4, 0xE9C5, 0xE165, 0xE945, 0xE108, 0xE0E7,
-    0xE0C8, 0xE0A8, 0xE8C8, 0xE0AA, 0x0000, 0x0000, 0xE0AC, 0xE0AC,
-    0x0000, 0x0000, 0x986B, 0xE8B0, 0xC8B1, 0xE0B0, 0xC8B1, 0xC8B1,
-    0xB0D1, 0x588B, 0x0000, 0x0000, 0x6111, 0x608B, 0x0000, 0x6111,
-    0x4931, 0x0000, 0x0000, 0x3191, 0x3191, 0x2212, 0x190B, 0x0000,
-    0x2212, 0x1A53, 0x1A53, 0x1AB4, 0x1A53, 0x0000, 0x09EE, 0x09EE,
-    0x1A53, 0x1AB4, 0x190B, 0x0000, 0x210B, 0x2212, 0x210B, 0x0000,
-    0x3191, 0x1842, 0x0000, 0x0000, 0x4931, 0x6911, 0x6111, 0x78F1,
-    0x78D1, 0x90D1, 0x608B, 0x0000, 0x1842, 0xB0D1, 0xD0B1, 0x1842,
-    0x0000, 0xD0AE, 0xE0AE, 0xE0B0, 0xE8AE, 0xE0AE, 0xE0AC, 0xE0AC,
-    0xE8AA, 0xE0AA, 0x90C4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0xEA85, 0xE9C5, 0xE9C5, 0xE945, 0xE165,
-    0xE0E7, 0xE108, 0xE0A8, 0xE8AA, 0xE0AA, 0xA08B, 0x5084, 0xE8AE,
-    0xC88E, 0x0000, 0x0000, 0xC8AE, 0xE0B0, 0xE0B0, 0xE0B0, 0xE0B0,
-    0xD0B1, 0xD0B1, 0x1842, 0x0000, 0x0000, 0x608B, 0x78F1, 0x0000,
-    0x0000, 0x6111, 0x4931, 0x0000, 0x3191, 0x4931, 0x3191, 0x0000,
-    0x0000, 0x2212, 0x21F2, 0x1A53, 0x2212, 0x1A53, 0x0000, 0x210B,
-    0x1A53, 0x1AB4, 0x1A53, 0x1842, 0x210B, 0x2212, 0x190B, 0x0000,
-    0x3191, 0x4931, 0x0000, 0x0000, 0x0000, 0x6111, 0x6111, 0x78F1,
-    0x78F1, 0x90D1, 0x90D1, 0xA8D1, 0x0000, 0x0000, 0x90D1, 0xE0B0,
-    0x988B, 0x0000, 0xE0B0, 0xE0B0, 0xE0AE, 0xE0AE, 0xE8AE, 0xE0AE,
-    0xE0AC, 0xE108, 0xE0AA, 0xE8AA, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x5084, 0xE9C5, 0xE9C5, 0xE145, 0xE965,
-    0xE106, 0xE106, 0xE0C8, 0xE8C8, 0xE0A8, 0xE0AA, 0xE0AA, 0xC88A,
-    0xE8AC, 0xE0AE, 0x0000, 0x0000, 0xE0AE, 0xE0B0, 0xE0B0, 0xE0B0,
-    0xC8AE, 0x1842, 0xB0D1, 0x608B, 0x0000, 0x0000, 0x0000, 0x78D1,
-    0x6111, 0x0000, 0x0000, 0x4931, 0x4951, 0x4931, 0x3191, 0x3191,
-    0x0000, 0x0000, 0x3191, 0x2212, 0x2991, 0x2212, 0x2212, 0x0000,
-    0x0000, 0x21F2, 0x2212, 0x2212, 0x3191, 0x21F2, 0x190B, 0x0000,
-    0x0000, 0x3191, 0x2042, 0x0000, 0x0000, 0x0000, 0x4931, 0x4951,
-    0x2042, 0x90D1, 0x90F1, 0x90D1, 0xA8D1, 0xA08B, 0x0000, 0xC8B1,
-    0xC8B1, 0xC88E, 0xD0AE, 0xE0B0, 0xE0AE, 0xE8AE, 0xE0AC, 0xE0AE,
-    0xE0AC, 0xE8AC, 0xE0AA, 0xE0AA, 0xE0A8, 0x5884, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x5064, 0xEA85, 0xE9C5, 0xE9C5,
-    0xE165, 0xE965, 0xE106, 0xE108, 0xE0A8, 0xC0C6, 0xE0C8, 0xE8AA,
-    0xE0AA, 0xE8AA, 0xE8AC, 0x1842, 0x986B, 0xE0B0, 0xE0B0, 0xE0B0,
-    0xE0B0, 0xE0B0, 0xC8B1, 0xD0B1, 0xB0D1, 0x78F1, 0x90D1, 0x78D1,
-    0x78F1, 0x90F1, 0x190B, 0x0000, 0x0000, 0x5131, 0x4931, 0x4931,
-    0x190B, 0x0000, 0x0000, 0x3191, 0x3191, 0x2212, 0x3191, 0x2212,
-    0x0000, 0x0000, 0x09EE, 0x2212, 0x3191, 0x2212, 0x0000, 0x0000,
-    0x0000, 0x4931, 0x3191, 0x210B, 0x190B, 0x608B, 0x190B, 0x6111,
-    0x6111, 0x90F1, 0x90D1, 0xA8D1, 0x90D1, 0xB0B1, 0xA8D1, 0x608B,
-    0xC8B1, 0xD0B1, 0x986B, 0xE0B0, 0xE0B0, 0xC8B1, 0xE0AE, 0xE0AE,
-    0xE0AC, 0xE8AC, 0xE0AA, 0xE0AA, 0xE0C8, 0xE8AA, 0x5884, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5884, 0xF285, 0xF285,
-    0xE9C5, 0xE9C5, 0xE106, 0xE106, 0xE0E7, 0xE0E7, 0x5884, 0x0000,
-    0xE8C8, 0xE0AC, 0xE0AA, 0xE0AC, 0xE8AC, 0xE0AE, 0xE0AE, 0xE0B0,
-    0x986B, 0x0000, 0xC8B1, 0xE8B0, 0xA8D1, 0x78D1, 0x588B, 0x78F1,
-    0xA06B, 0x90D1, 0x78F1, 0x78F1, 0x6111, 0x190B, 0x0000, 0x6111,
-    0x4931, 0x2042, 0x0000, 0x0000, 0x3191, 0x3191, 0x2991, 0x3191,
-    0x3191, 0x0000, 0x0000, 0x0000, 0x3191, 0x2991, 0x2042, 0x0000,
-    0x190B, 0x4931, 0x3191, 0x4951, 0x5131, 0x4951, 0x608B, 0x6111,
-    0x6911, 0x78F1, 0x78D1, 0x1842, 0x0000, 0xB0D1, 0xB0B1, 0xC8B1,
-    0xC8B1, 0xE8B0, 0xC8B1, 0xE0B0, 0xE0B0, 0x988B, 0x0000, 0xC88E,
-    0xE8AC, 0xE0AC, 0xE8AA, 0xE0AA, 0xE0C8, 0xE0AA, 0xE8A8, 0x1842,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xEA85,
-    0xE9C5, 0xF285, 0xE1A6, 0xE965, 0xE126, 0xE906, 0x90C4, 0xC0C6,
-    0xE0C8, 0xE0AA, 0xE0AA, 0xE8AC, 0xE0AC, 0xE0AE, 0xE0AE, 0xE8AE,
-    0xE0AE, 0xA06B, 0xC8B1, 0xC8AE, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x78F1, 0x90D1, 0x78F1, 0x90D1, 0x78D1, 0x78F1,
-    0x6111, 0x6911, 0x0000, 0x0000, 0x0000, 0x4951, 0x3191, 0x4931,
-    0x3191, 0x4951, 0x0000, 0x0000, 0x0000, 0x4931, 0x3191, 0x4951,
-    0x3191, 0x5131, 0x190B, 0x5151, 0x4931, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x190B, 0x78D1, 0x608B, 0x1842, 0xB0D1, 0xC8B1,
-    0xC8B1, 0xE0B0, 0xE0B0, 0xE0B0, 0xE0B0, 0xE0B0, 0xC8B1, 0xA06B,
-    0x5084, 0xE0AE, 0xE8AC, 0xE0AC, 0xE0AA, 0xE0AA, 0xE8C8, 0xE108,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0xEA65, 0xF285, 0xE9C5, 0xE9C5, 0xE145, 0xE145, 0xE108, 0xE0E7,
-    0xC0C6, 0xE0C8, 0xE0A8, 0xE8AA, 0xE0AA, 0xE0AC, 0xE0AC, 0xE8AE,
-    0xC8AE, 0xE0AE, 0xE0AE, 0xC88E, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0xB0D1, 0x88D1, 0x0000, 0x0000, 0x1842,
-    0x6911, 0x78F1, 0x608B, 0x0000, 0x0000, 0x0000, 0x4931, 0x4931,
-    0x3191, 0x4951, 0x3191, 0x0000, 0x0000, 0x0000, 0x190B, 0x4931,
-    0x3191, 0x210B, 0x0000, 0x0000, 0x4951, 0x6911, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x608B, 0xA8D1, 0xD0B1,
-    0xA8B1, 0xC8B1, 0xD0B1, 0xE0B0, 0xE0B0, 0xE0B0, 0xE0AE, 0xE8AE,
-    0xE0AE, 0xC88A, 0xE0AC, 0xE0AC, 0xE8AA, 0xE0AA, 0xE0C8, 0xE0C8,
-    0xE8A8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0xF365, 0xEA85, 0xEA85, 0xE9C5, 0xE9C5, 0xE945, 0xE165,
-    0xE0E7, 0xE108, 0xE0A8, 0xE8AA, 0xC0C6, 0xE0AC, 0xE0AA, 0xE0AC,
-    0xE8AC, 0xE0AC, 0xC8AE, 0xE0B0, 0xE8AE, 0xA06B, 0x1842, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0xA8D1, 0xB0D1, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x608B, 0x608B, 0x0000, 0x0000, 0x0000, 0x6111,
-    0x4931, 0x6911, 0x4951, 0x5131, 0x0000, 0x0000, 0x0000, 0x4951,
-    0x4931, 0x0000, 0x0000, 0x0000, 0x0000, 0x6111, 0x6911, 0x1842,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x1842, 0xB0B1, 0xA8D1, 0xC8B1,
-    0xB0B1, 0x78F1, 0xC8B1, 0xE0B0, 0xE0B0, 0xE0B0, 0xE0AE, 0xE0B0,
-    0xE0AE, 0xE0AE, 0xE8AC, 0xE0AC, 0xE0AA, 0xE0AC, 0xE8AA, 0xE0A8,
-    0xE0C8, 0xD127, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0xCA64, 0xF265, 0xE9C5, 0xE9C5, 0xE145, 0xE165,
-    0xE106, 0xE106, 0xE8E7, 0xE0E7, 0xC8AA, 0x0000, 0xC88A, 0xE0AA,
-    0xE0AA, 0xE8AC, 0xE0AC, 0xE0AE, 0x0000, 0xC8AE, 0xC8B1, 0xE0B0,
-    0xE0B0, 0xE0B0, 0xC8B1, 0xD0B1, 0xC8B1, 0xC8B1, 0x988B, 0x0000,
-    0x0000, 0x0000, 0x608B, 0x90D1, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x608B, 0x6111, 0x4931, 0x6111, 0x608B, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x6111, 0x190B, 0x0000, 0x0000, 0x0000, 0x6911, 0x78F1,
-    0x78F1, 0x90D1, 0x90D1, 0x90F1, 0x90D1, 0xA8D1, 0xB0D1, 0xA8B1,
-    0x0000, 0x90D1, 0xC8B1, 0xE0B0, 0xE0B0, 0xE0B0, 0xC8AE, 0x0000,
-    0xA08B, 0xE0AE, 0xE8AC, 0xE0AC, 0xE0AA, 0xE0AC, 0xE8A8, 0xE0AA,
-    0xE0C8, 0xE0E7, 0x90C4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0xCA64, 0xEA65, 0xF285, 0xE9C5, 0xE9C5,
-    0xE165, 0xE165, 0xE106, 0xE906, 0xE0E7, 0xE108, 0xE0C8, 0xE0AA,
-    0xE8AA, 0xE0AC, 0xE8AC, 0xE8AE, 0x1842, 0x0000, 0x0000, 0x0000,
-    0x588B, 0xD0B1, 0xC88E, 0xC8AE, 0xC8B1, 0xE0B0, 0xD0B1, 0xB0B1,
-    0x0000, 0x0000, 0x1842, 0xB0D1, 0x90D1, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x78F1, 0x78D1, 0x6111, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x6111, 0x78F1, 0x1842, 0x0000, 0x0000, 0x78D1,
-    0x78F1, 0x90F1, 0x90D1, 0xB0B1, 0x78F1, 0x78D1, 0x1842, 0x0000,
-    0x0000, 0x0000, 0x0000, 0xE0B0, 0xE0B0, 0xE0B0, 0xE0B0, 0xE0B0,
-    0xE0AE, 0xE0AE, 0xE0AE, 0xE8AE, 0xE0AC, 0xE0AC, 0xE0AA, 0xE8AA,
-    0xE0C8, 0xE108, 0xE8E7, 0x5884, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x90C4, 0xFB65, 0xEA85, 0xF285,
-    0xE9C5, 0xE9C5, 0xE145, 0xE145, 0xE106, 0xE0E7, 0xE0C8, 0xE8C8,
-    0xE0A8, 0xE0AA, 0xE0AA, 0xE8AC, 0xC88A, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x988B, 0x988B, 0xC8B1,
-    0xB0B1, 0x0000, 0x588B, 0xB0D1, 0xB0B1, 0x588B, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x190B, 0x608B, 0x2042, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x608B, 0x78F1, 0x78D1, 0x1842, 0x0000,
-    0x78F1, 0x90D1, 0x90D1, 0x608B, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x988B, 0xE8B0, 0xE0AE, 0xE0B0,
-    0xE8AE, 0xE0AE, 0xE0AC, 0xE0AC, 0xE8AC, 0xE0AC, 0xE0AA, 0xE0AA,
-    0xE8C8, 0xE0A8, 0xE0C8, 0xE0E7, 0x5884, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3242, 0xFB65, 0xF365,
-    0xEA85, 0xEA85, 0xE9C5, 0xE9C5, 0xE906, 0xE106, 0xE108, 0xE0E7,
-    0xE0C8, 0xE8AA, 0xE0A8, 0xE8AA, 0xE8AA, 0x1842, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xC8AE, 0xB0B1, 0x988B,
-    0xC8B1, 0xC8B1, 0xB0B1, 0xC8B1, 0xB0D1, 0xC8B1, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x90F1, 0x88D1, 0x90D1,
-    0x78F1, 0xB0D1, 0x88D1, 0x90D1, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE0B0, 0xE0B0,
-    0xE0AE, 0xE0AE, 0xE0AE, 0xE8AE, 0xE0AC, 0xE0AC, 0xE0AA, 0xE8AA,
-    0xE0C8, 0xE0AA, 0xE0A8, 0xE8E7, 0xE8E7, 0x1842, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF365,
-    0xF265, 0xF285, 0xE9C5, 0xE1C5, 0x90C4, 0x0000, 0x0000, 0xE906,
-    0xC0C6, 0x0000, 0x0000, 0xC0C6, 0xE0C8, 0xE0AA, 0xC88E, 0xE8AC,
-    0xE0AC, 0xC8AE, 0x986B, 0x5884, 0x0000, 0x0000, 0x988B, 0xD0B1,
-    0xE0B0, 0xE0B0, 0xC8B1, 0xC8B1, 0xD0B1, 0xC8B1, 0x986B, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x608B, 0x90D1,
-    0x90F1, 0xA8D1, 0xB0B1, 0xA8D1, 0x90D1, 0x5884, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x1842, 0xA08B, 0xC88E, 0xE8AE, 0xA8D1, 0xE0B0,
-    0xE8AE, 0xC88E, 0x1842, 0x0000, 0x608B, 0xE8AC, 0x588B, 0x0000,
-    0x988B, 0xE8A8, 0xE0C8, 0xE8E7, 0xE0E7, 0xE106, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0xF365, 0xF365, 0xF285, 0xEA85, 0xE9C5, 0x0000, 0x0000, 0x0000,
-    0xE106, 0xE906, 0x5884, 0xC0C6, 0xE0C8, 0xE0AA, 0xE0AA, 0xE8AC,
-    0xE0AA, 0xE0AC, 0xE0AC, 0xE8AE, 0xE0AE, 0xE0AE, 0xE8AE, 0xE0B0,
-    0xE0B0, 0xE0B0, 0xE0B0, 0xE0B0, 0xC8B1, 0xC8B1, 0xB0B1, 0xB0D1,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x78D1,
-    0x1842, 0xB0D1, 0xA8B1, 0xC8B1, 0xB0D1, 0xC8B1, 0xC8B1, 0xD0B1,
-    0xC88E, 0xC8B1, 0xE0B0, 0xE0B0, 0xE0B0, 0xE0B0, 0xE0B0, 0xE0B0,
-    0xE0AE, 0xE0AE, 0xE8AE, 0x988B, 0x0000, 0xC88E, 0xE8AA, 0x988B,
-    0x0000, 0x0000, 0xC0C6, 0xE0E7, 0xE0E7, 0xE926, 0xE106, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0xF365, 0xFB65, 0xF365, 0xF285, 0xE1A6, 0x0000, 0x0000,
-    0x0000, 0xC165, 0xE106, 0xE126, 0xE8E7, 0xE0E7, 0xE0C8, 0xE0A8,
-    0xE8C8, 0xE0AA, 0xE0AA, 0xE0AC, 0xE8AC, 0xE0AE, 0xE0AC, 0xE0AE,
-    0xE8AE, 0xE0B0, 0xE0AE, 0xE0B0, 0xE0B0, 0xE0B0, 0x588B, 0xC8B1,
-    0x1842, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x608B, 0xB0B1, 0x0000, 0xD0B1, 0xA8D1, 0xC8B1, 0xD0B1, 0xC8B1,
-    0xC8B1, 0xE0B0, 0xC8B1, 0xE8B0, 0xE0B0, 0xE0B0, 0xE0AE, 0xE0B0,
-    0xE0AE, 0xE8AE, 0xE0AC, 0xE0AE, 0xE0AC, 0xE8AC, 0xE0AA, 0xE0AA,
-    0x0000, 0x0000, 0x0000, 0x1842, 0xE8E7, 0xE106, 0xE906, 0xC0C6,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x9AA3, 0xFC85, 0xF365, 0xFB65, 0xC165, 0x0000,
-    0x0000, 0x0000, 0x5084, 0xE965, 0xE126, 0xE106, 0xE0E7, 0xE8E7,
-    0x98C4, 0x90E4, 0xE0AA, 0xE0AC, 0xE0AA, 0xE8AC, 0xE0AC, 0xE0AE,
-    0xE0AE, 0xE8AE, 0xE0AE, 0xE0B0, 0xE0AE, 0xE8B0, 0x986B, 0xC8B1,
-    0xE0B0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0xD0B1, 0x988B, 0x608B, 0xC8B1, 0xC8B1, 0xE0B0,
-    0xC8B1, 0xE0B0, 0xE0B0, 0xE0B0, 0xE0B0, 0xE0B0, 0xE0B0, 0xE0B0,
-    0xE0AE, 0xE8AE, 0xC8AE, 0xE0AE, 0xE0AC, 0xE8AC, 0xE0AA, 0xE0AC,
-    0xC0C6, 0x0000, 0x0000, 0x0000, 0x0000, 0xE106, 0xE906, 0xE165,
-    0x90E4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x5084, 0xFB65, 0xFB65, 0xEA85, 0xC165,
-    0x0000, 0x0000, 0x0000, 0xE906, 0xE165, 0xE165, 0xE108, 0x90C4,
-    0x0000, 0x0000, 0x988B, 0xE8AA, 0xE8A8, 0xE0AA, 0xE0AA, 0xE0AC,
-    0xC8AE, 0xE8AE, 0xE0AC, 0xE0AE, 0xE8AE, 0xE0B0, 0xE0AE, 0x0000,
-    0xC8B1, 0xC88E, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0xA8D1, 0xB0B1, 0x0000, 0xC8B1, 0xE0B0,
-    0xC8B1, 0xE8B0, 0xE0B0, 0xE0B0, 0xC8AE, 0xE0B0, 0xE0AE, 0xE8AE,
-    0xE0AE, 0xE0AE, 0xC88E, 0x0000, 0x0000, 0x988B, 0xE8AA, 0xE0AA,
-    0xE8A8, 0xE0AA, 0x0000, 0x0000, 0x0000, 0x5084, 0xE108, 0xE965,
-    0xE145, 0x1842, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFC85, 0xF365, 0xFB65,
-    0x90E4, 0x0000, 0x0000, 0x0000, 0xE1A6, 0xE9C5, 0xE165, 0xE906,
-    0x0000, 0x0000, 0x90C4, 0xE0E7, 0xE0C8, 0xE8AA, 0x98C4, 0x90E4,
-    0xE0AA, 0xE0AC, 0xE0AC, 0xE8AE, 0x0000, 0xC88E, 0xE0AE, 0xE8AE,
-    0x988B, 0xE8B0, 0x2042, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x1842, 0xE8B0, 0x1842, 0x986B,
-    0xE0B0, 0xC8B1, 0x1842, 0xE0B0, 0xE0B0, 0xE0B0, 0xE8AE, 0xC8AE,
-    0x986B, 0xE8AE, 0xE0AE, 0xE8AE, 0x988B, 0x0000, 0x0000, 0x986B,
-    0xE0AA, 0xE8AA, 0xE8C8, 0x0000, 0x0000, 0x0000, 0x1842, 0xE145,
-    0xE965, 0xE9C5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCB84, 0xF485,
-    0xF365, 0x9AA3, 0x0000, 0x0000, 0x0000, 0xE9A6, 0xE165, 0xE145,
-    0xE906, 0x90E4, 0x5084, 0xE8E7, 0xE8C8, 0xE0A8, 0x988B, 0x0000,
-    0xC88A, 0xE8AA, 0xE0AA, 0x5084, 0x0000, 0xA08B, 0xE0AC, 0xE8AE,
-    0xE0AE, 0xE0AE, 0xC88E, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xC8B1, 0xE0B0,
-    0xE8AE, 0xE0B0, 0xE0AE, 0x588B, 0x0000, 0x608B, 0xE8AE, 0xE0AE,
-    0xC8AE, 0x0000, 0x986B, 0xE8AC, 0xE0AC, 0xE8AC, 0x1842, 0x90E4,
-    0xE8A8, 0xE0AA, 0xE8C8, 0xE0A8, 0x0000, 0x0000, 0x0000, 0x90E4,
-    0xD127, 0xE945, 0xC185, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCB84,
-    0xFC85, 0xCA64, 0x9AC3, 0x90E4, 0x0000, 0x0000, 0x0000, 0xE9C5,
-    0xE1A6, 0xE165, 0xE906, 0xE165, 0xE106, 0xE906, 0x98E4, 0x0000,
-    0x5084, 0xE0AA, 0xE8AA, 0x0000, 0x0000, 0xC88E, 0xE0AC, 0xE0AC,
-    0xE8AC, 0x988B, 0xE8AE, 0x986B, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x988B,
-    0xE0B0, 0xC8B1, 0xE8AE, 0xE0B0, 0xE0AE, 0x986B, 0x0000, 0x0000,
-    0xE8AE, 0xE8AE, 0x1842, 0x0000, 0x90E4, 0xE0AC, 0xE8AA, 0xE0AA,
-    0xC88A, 0xE0C8, 0xE0A8, 0xE8E7, 0x98E4, 0x0000, 0x0000, 0x0000,
-    0x90C4, 0xE165, 0xE9C5, 0xC165, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x5064, 0xFD85, 0xFB65, 0x5084, 0xCA64, 0x0000, 0x0000, 0x0000,
-    0xC965, 0xE9C5, 0xE165, 0xE945, 0xE106, 0xE126, 0x90E4, 0xC0C6,
-    0xE8A8, 0xE0E7, 0xE0C8, 0xE8A8, 0x988B, 0xE0AA, 0xE8AA, 0xE0AC,
-    0x5084, 0x0000, 0xE8AC, 0xE0AC, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0xE0B0, 0xE8AE, 0x0000, 0x588B, 0xE8AE, 0xE0AE, 0xE0AC,
-    0x0000, 0xE0AE, 0xE8AC, 0xE0AC, 0xC88E, 0x0000, 0x5084, 0xE8AA,
-    0xE8C8, 0xE0A8, 0xE0C8, 0xE0E7, 0xE8A8, 0x0000, 0x0000, 0x0000,
-    0x90E4, 0x90C4, 0xC185, 0xE9C5, 0x1842, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0xFD65, 0xFD85, 0x5084, 0x9AA3, 0xF365, 0xF285,
-    0x0000, 0xEA85, 0xE9C5, 0xE9C5, 0xE1A6, 0xE9C5, 0xE165, 0xE965,
-    0xE106, 0xE126, 0xE0E7, 0x0000, 0xC88A, 0xE8AA, 0xE0C8, 0xC88A,
-    0x0000, 0x0000, 0xE0AA, 0xE8AC, 0x5884, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x5084, 0xE8AE, 0xE0AE, 0x0000, 0x0000, 0xE0AA,
-    0xE0AC, 0xE8AE, 0xE8AC, 0x5084, 0xC88A, 0xE108, 0xE0AA, 0xE0AA,
-    0xE8C8, 0xE0AA, 0xE0A8, 0xE0E7, 0xE8E7, 0xE108, 0x0000, 0x5884,
-    0x98E4, 0xC165, 0x1842, 0xE9C5, 0xF1C5, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0xFC85, 0xFC65, 0xF365, 0x0000, 0x9AA3,
-    0xF285, 0xF365, 0xEA85, 0x5064, 0x0000, 0x98E4, 0x0000, 0xE945,
-    0xE165, 0xE145, 0xC0C6, 0x0000, 0x0000, 0xC88A, 0xE8C8, 0x5084,
-    0x0000, 0x5884, 0xE8C8, 0xE0AA, 0x986B, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x988B, 0xE8AE, 0xE8AC, 0x0000,
-    0x0000, 0x5084, 0xE8AA, 0xE0AA, 0x0000, 0x0000, 0xC88A, 0xE0AA,
-    0xE8C8, 0xE0A8, 0x5084, 0x5884, 0x0000, 0x1842, 0xE908, 0xE906,
-    0xC0C6, 0x90E4, 0x0000, 0x5884, 0xE9C5, 0xCA64, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x9AA3, 0xFD65, 0xFC85, 0x0000,
-    0x0000, 0x9AC3, 0xF365, 0x9AA3, 0x0000, 0x0000, 0x0000, 0x0000,
-    0xE165, 0xE9C5, 0xE165, 0x0000, 0x0000, 0xE906, 0xE8E7, 0x0000,
-    0x0000, 0x1842, 0xE0A8, 0xE0AA, 0xE0C8, 0xC8AA, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE8AC, 0xE0AC, 0xC88A,
-    0xE8AC, 0x5084, 0x0000, 0x0000, 0xE0AA, 0xE8AC, 0x0000, 0x0000,
-    0xE0A8, 0xE0E7, 0xE8C8, 0x0000, 0x0000, 0x0000, 0x0000, 0x90C4,
-    0xE965, 0xC165, 0x0000, 0x0000, 0x90C4, 0xF285, 0x90E4, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFD85, 0xFD85,
-    0x0000, 0xF465, 0xF365, 0x90C4, 0x0000, 0x0000, 0x0000, 0x0000,
-    0xC985, 0xE9C5, 0xE145, 0x90E4, 0x0000, 0xE945, 0xC0C6, 0x0000,
-    0x0000, 0x0000, 0xC88A, 0xE0C8, 0xE0C8, 0xE8A8, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE0AC,
-    0xE0AA, 0xC88A, 0xC8AE, 0x1842, 0x0000, 0x0000, 0xE8C8, 0xE8A8,
-    0x0000, 0x5084, 0xE8C8, 0xE0E7, 0xC0C6, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x90C4, 0xE965, 0xC165, 0x0000, 0xF285, 0xEA85, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFD65,
-    0xFD85, 0xFD65, 0xFC85, 0xFC85, 0x5064, 0x0000, 0x0000, 0x0000,
-    0x0000, 0xEA85, 0xF265, 0xF285, 0x5084, 0xE9C5, 0xE165, 0x0000,
-    0x0000, 0x0000, 0xE8E7, 0xE126, 0xE0E7, 0xE108, 0xC0C6, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0xC88A, 0xE108, 0xE0AA, 0xE8AA, 0xE0A8, 0x0000, 0x0000, 0x0000,
-    0xE0C8, 0xE108, 0x0000, 0xE108, 0xE0E7, 0xE945, 0x90C4, 0x0000,
-    0x0000, 0x0000, 0x0000, 0xE1C5, 0xE9C5, 0xF285, 0xF265, 0xF365,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x9AA3, 0xFE85, 0xF565, 0x9AA3, 0xFC85, 0xFC85, 0xCB84, 0xCA64,
-    0xCA64, 0xF365, 0xEA65, 0x0000, 0xE9C5, 0xE9C5, 0xC165, 0x0000,
-    0x0000, 0x0000, 0x90E4, 0xE906, 0xE106, 0xE126, 0xE0E7, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0xE8C8, 0xE0A8, 0xE0C8, 0xE0A8, 0x988B, 0x0000,
-    0x0000, 0x0000, 0xC0C6, 0xE108, 0xE906, 0x90E4, 0xC0C6, 0xE945,
-    0xC0C6, 0x90E4, 0x90C4, 0xE9C5, 0xE9C5, 0x1842, 0xCA64, 0xFB65,
-    0x90E4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0xFE65, 0xFD85, 0xCB84, 0xFD85, 0xCB84, 0xF365,
-    0x9AA3, 0xFC85, 0xFB65, 0x0000, 0x5064, 0xF365, 0xF285, 0xEA85,
-    0xE9C5, 0xE9C5, 0xE145, 0xE165, 0xE945, 0xE165, 0xE906, 0x90E4,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0xC0C6, 0xE0A8, 0xE0E7, 0xE0C8, 0xE8E7,
-    0xE0C8, 0xD127, 0xC0C6, 0xD127, 0xE906, 0xE165, 0xE106, 0x0000,
-    0xE145, 0xE9C5, 0x90C4, 0xE9C5, 0xE9C5, 0xF285, 0xCA64, 0xF365,
-    0xFB65, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0xF665, 0xFD65, 0x0000, 0x9AA3, 0x3242,
-    0x9AA3, 0xFC85, 0xFB65, 0x62A3, 0x0000, 0xF365, 0xF285, 0xF265,
-    0xEA85, 0xF265, 0xE9C5, 0xE1C5, 0xE145, 0xE9C5, 0xE165, 0xE145,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE8E7, 0xE0C8, 0xE0E7,
-    0xE0E7, 0xE906, 0xE108, 0xE106, 0xE126, 0xE165, 0xE945, 0xE1A6,
-    0x0000, 0x5084, 0xE9C5, 0xCA84, 0xC165, 0x98E4, 0x90C4, 0x5884,
-    0xFB65, 0xF365, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x62A3, 0xFE65, 0xFD85, 0xFD65,
-    0xCC84, 0xF565, 0xFC85, 0xF465, 0x0000, 0xFC85, 0xFB65, 0xCA64,
-    0xC185, 0xCA64, 0xC165, 0xEA85, 0xE9C5, 0xF285, 0xE9C5, 0xF1C5,
-    0x1842, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5084, 0xE106,
-    0xE106, 0xE965, 0xE106, 0xE165, 0xC0C6, 0xC0C6, 0xC165, 0xC165,
-    0xE9C5, 0xE9C5, 0x0000, 0xEA85, 0xF285, 0xFB65, 0x90C4, 0xF365,
-    0xFB65, 0xFC85, 0x1842, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFD65, 0xFE85,
-    0xF565, 0xFE65, 0xFD65, 0x5084, 0x9AA3, 0xFC85, 0xFC85, 0xF365,
-    0xCA64, 0xCA64, 0xF265, 0xF365, 0xF285, 0xEA65, 0xE9C5, 0xE9C5,
-    0x90C4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0xC0C6, 0xE165, 0xE106, 0xE965, 0xE145, 0xE9C5, 0xE165, 0xC165,
-    0x90E4, 0xE9C5, 0xE9C5, 0xC165, 0xC185, 0x90C4, 0xF285, 0xFB65,
-    0xF365, 0xFC85, 0xCB84, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x62A3,
-    0xFE85, 0xFF25, 0xCC84, 0x9AA3, 0x5084, 0xFD65, 0xFD85, 0x9AC3,
-    0x90C4, 0xFC65, 0xF365, 0xFC85, 0xF365, 0xF365, 0xF265, 0xEA85,
-    0xE9C5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0xE165, 0xE9C5, 0xE145, 0xE9C5, 0xE1C5, 0xE9C5,
-    0xE9C5, 0xF285, 0xC965, 0x5084, 0xF285, 0xFB65, 0x90C4, 0x62A3,
-    0xCA64, 0xF465, 0xFC85, 0x3222, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0xFE65, 0xFE65, 0x0000, 0x9CE5, 0xCC64, 0xFD65, 0xFD85,
-    0x9AA3, 0xFD85, 0xF465, 0xFC85, 0xF365, 0xFC65, 0xF365, 0xF365,
-    0xF285, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0xE1A6, 0xE9C5, 0xE9C5, 0xEA85,
-    0xE9C5, 0xEA65, 0xF285, 0xEA65, 0x90C4, 0xCB84, 0xFB65, 0xCA64,
-    0x90E4, 0x9AA3, 0xFC85, 0xFC85, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x1842, 0xF725, 0xFE65, 0xFE65, 0xF665, 0xFE65,
-    0xCC64, 0xFE85, 0xFD65, 0xF585, 0xFC65, 0xFD85, 0xF465, 0xFC85,
-    0xF365, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE9C5, 0xEA65,
-    0xF285, 0xF365, 0xF265, 0xF365, 0xF365, 0xFC85, 0xF365, 0xF465,
-    0xFC85, 0xF465, 0xFC85, 0xF565, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0xCB84, 0xFF25, 0xFE65, 0xFE65,
-    0xF665, 0xFE65, 0xFD65, 0xFD85, 0xF565, 0xFD85, 0xFC65, 0xF485,
-    0xFC65, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0xC165, 0xF365, 0xF285, 0xF365, 0xF365, 0xF365, 0xF365, 0xFC85,
-    0xF365, 0xFC65, 0xF485, 0xFD65, 0x62A3, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCD65, 0xF725,
-    0xFE65, 0xF725, 0xFE65, 0xFE85, 0xF565, 0xFE65, 0xFD85, 0xFD65,
-    0xFC85, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x90C4, 0xF365, 0xF365, 0xFC85, 0xF465, 0xFC85,
-    0xF465, 0xFD85, 0xFD65, 0xFD85, 0xCB84, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x9CE5, 0xF725, 0xFE65, 0xF725, 0xFE65, 0xFE65, 0xFD65, 0xFD85,
-    0x62A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x5064, 0xFC85, 0xFC85, 0xFC65,
-    0xF485, 0xFD65, 0xFD85, 0xFD65, 0x9AA3, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x3222, 0xFE65, 0xFE65, 0xFE85, 0xFD85, 0x9AA3,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9AA3,
-    0xCC84, 0xFD65, 0xFD85, 0xCD85, 0x5084, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000 },
-  { 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x34C8, 0x152A, 0x150A,
-    0x152A, 0x34C8, 0x3A22, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3A42, 0x4DA8,
-    0x2D49, 0x2D69, 0x3CC8, 0x34C8, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3CC8, 0x04EA, 0x04EA,
-    0x04EA, 0x04EA, 0x04EA, 0x2D69, 0x34C8, 0x3222, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x62A3, 0x6CA6, 0x55A8,
-    0x152A, 0x04EA, 0x04EA, 0x04EA, 0x150A, 0x55A8, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x150A, 0x04EA, 0x04EA,
-    0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x152A,
-    0x3CC8, 0x3222, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x3A42, 0x9CE5, 0x6E28, 0x2D49, 0x2D49,
-    0x152A, 0x150A, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x2D69,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x150A, 0x04EA, 0x04EA,
-    0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA,
-    0x04EA, 0x04EA, 0x04EA, 0x2D49, 0x64A6, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x9CE5, 0xAEC7, 0x8667, 0x8667, 0x6E08, 0x6E28,
-    0x4DA8, 0x55A8, 0x2D69, 0x150A, 0x04EA, 0x04EA, 0x04EA, 0x04EA,
-    0x04EA, 0x55A8, 0x0000, 0x0000, 0x0000, 0x3A42, 0x04EA, 0x04EA,
-    0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA,
-    0x04EA, 0x04EA, 0x04EA, 0x150A, 0x152A, 0x2D49, 0x2D69, 0xA4E5,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0xCD65, 0xA6C7, 0xA6C7, 0xAEA7, 0xA6C7, 0x8667, 0x8667,
-    0x6E08, 0x4DA8, 0x2D49, 0x2D69, 0x150A, 0x152A, 0x04EA, 0x04EA,
-    0x04EA, 0x04EA, 0x04EA, 0x3A22, 0x0000, 0x0000, 0x150A, 0x04EA,
-    0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA,
-    0x04EA, 0x04EA, 0x04EA, 0x152A, 0x150A, 0x55A8, 0x4DA8, 0x6E08,
-    0x6628, 0x8667, 0x9CE5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0xCD65, 0xFF25, 0xCF26, 0xCF26, 0xCF26, 0xD726, 0xA6C7, 0xAEA7,
-    0x8667, 0x8667, 0x6E28, 0x6E28, 0x4DA8, 0x55A8, 0x2D49, 0x0D2A,
-    0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x6CA6, 0x0000, 0x1842, 0x152A,
-    0x04EA, 0x04EA, 0x150A, 0x0000, 0x2D69, 0x04EA, 0x04EA, 0x04EA,
-    0x04EA, 0x04EA, 0x04EA, 0x150A, 0x152A, 0x2D49, 0x3569, 0x55A8,
-    0x6E28, 0x8667, 0x8667, 0xA6A7, 0xA6C7, 0xD565, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFC65,
-    0xFE85, 0xF725, 0xF725, 0xF725, 0xCF26, 0xFF25, 0xCF26, 0xCF26,
-    0xA6A7, 0xA6C7, 0x8667, 0x8667, 0x6E08, 0x6E28, 0x2D49, 0x2D49,
-    0x152A, 0x6CA6, 0x0000, 0x04EA, 0x04EA, 0x2D49, 0x1842, 0x34C8,
-    0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x3CC8, 0x4DA8, 0x2D49, 0x04EA,
-    0x04EA, 0x55A8, 0x3242, 0x2D49, 0x6CA6, 0x6E08, 0x4DA8, 0x6E28,
-    0x6608, 0x8667, 0x8667, 0xA6C7, 0xA6A7, 0xD726, 0xCF46, 0xF725,
-    0xCC64, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF365, 0xFE65,
-    0xFE65, 0xF725, 0xF725, 0xFF25, 0xF725, 0xF725, 0xF725, 0xFF25,
-    0xCF26, 0xD726, 0xA6A7, 0xA6C7, 0x8667, 0x9CE5, 0x6E08, 0x6E28,
-    0x55A8, 0x4DA8, 0x64A6, 0x6CA6, 0x04EA, 0x04EA, 0x152A, 0x6CA6,
-    0x152A, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x150A, 0x04EA, 0x0000,
-    0x2D69, 0x04EA, 0x3CC8, 0x0000, 0x6CA6, 0x6E28, 0x0000, 0x9CE5,
-    0x6E08, 0x8667, 0x8667, 0xA6C7, 0xA6A7, 0xD726, 0xCF26, 0xD726,
-    0xCF26, 0xF725, 0xFE65, 0xCB84, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCA64, 0xFC65, 0xFD85,
-    0xF565, 0xFE85, 0xFE65, 0xFE65, 0xF665, 0xF725, 0xFE65, 0xF725,
-    0xCF26, 0xFF25, 0x62A3, 0x0000, 0xCD65, 0xCD65, 0x0000, 0x8667,
-    0x6E28, 0x6E28, 0x9AA3, 0x2D49, 0x152A, 0x150A, 0x04EA, 0x04EA,
-    0x6CA6, 0x2D69, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x0000, 0x3CC8,
-    0x04EA, 0x04EA, 0x04EA, 0x2D49, 0x0000, 0x3222, 0x6E28, 0x0000,
-    0x0000, 0x8667, 0x8667, 0xA6A7, 0x9CE5, 0xCF26, 0xCF26, 0xF725,
-    0xFF25, 0xF725, 0xF725, 0xF725, 0xFE65, 0xFE85, 0x9AC3, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x90C4, 0xFC65, 0xF485, 0xFC65,
-    0xF485, 0xFD65, 0xFD65, 0xFE65, 0xFE85, 0xF725, 0xFD65, 0xCD65,
-    0xF725, 0xFF25, 0xFE85, 0x0000, 0xCB64, 0xD686, 0x0000, 0x1842,
-    0x8667, 0x8667, 0x6E08, 0x6E28, 0x1842, 0x6E28, 0x150A, 0x152A,
-    0x04EA, 0x4DA8, 0x150A, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x55A8,
-    0x0000, 0x6AA3, 0x04EA, 0x0D2A, 0x150A, 0x2D69, 0x55A8, 0x4DA8,
-    0xA4E5, 0x0000, 0x9CE5, 0x9CE5, 0xAEC7, 0xCF26, 0xCC64, 0xCD65,
-    0xD746, 0xF725, 0xF725, 0xFF25, 0xFE65, 0xFE65, 0xF565, 0xFE65,
-    0xFC65, 0x1842, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x1842, 0xF285, 0xFB65, 0xF365, 0xF365,
-    0xF365, 0xFC65, 0xFC85, 0xF565, 0xFD85, 0xFE65, 0xF365, 0xFC65,
-    0xF685, 0xFD65, 0xCC64, 0xFD85, 0x0000, 0xFE65, 0xCE86, 0xCD65,
-    0xA6C7, 0xA6A7, 0x8667, 0x8667, 0x0000, 0x0000, 0x64A6, 0x2D49,
-    0x152A, 0x150A, 0x34C8, 0x2D69, 0x04EA, 0x04EA, 0x04EA, 0x04EA,
-    0x150A, 0x55A8, 0x6CA6, 0x2D69, 0x150A, 0x2D69, 0x2D49, 0x55A8,
-    0x4DA8, 0x8667, 0x9CE5, 0x9CE5, 0x0000, 0xCF26, 0xCF26, 0xFF25,
-    0x0000, 0x9CE5, 0xF725, 0xF725, 0xFE65, 0xF725, 0xF665, 0xFE65,
-    0xFD85, 0xFD65, 0xF485, 0xCA64, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0xC165, 0xE9C5, 0xF285, 0xEA65, 0xFB65,
-    0xF365, 0xF485, 0xFC65, 0xF485, 0xFC65, 0xFD85, 0x5864, 0x62A3,
-    0xFE85, 0xFF25, 0x9AC3, 0x9AA3, 0xCB64, 0x9CE5, 0xF725, 0xFF25,
-    0xCF26, 0xD726, 0xA6C7, 0xA6A7, 0x8667, 0xA6C7, 0xA4E5, 0x55A8,
-    0x2D69, 0x2D49, 0x152A, 0x55A8, 0x2D49, 0x04EA, 0x04EA, 0x04EA,
-    0x04EA, 0x04EA, 0x152A, 0x55A8, 0x150A, 0x2D69, 0x6CA6, 0x64A6,
-    0x9CE5, 0x8667, 0x6E28, 0xAEA7, 0xA6C7, 0x0000, 0xD666, 0xCC64,
-    0xCE86, 0xFF25, 0xCE86, 0xFE65, 0x5064, 0xFE85, 0xFD65, 0xFD65,
-    0xFD85, 0xFD65, 0xFC85, 0xF465, 0xF365, 0xF285, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0xE0E8, 0xE165, 0xE9C5, 0xE9C5, 0xEA85,
-    0xF265, 0xEA85, 0xF265, 0xF365, 0xEA85, 0xCA64, 0xF365, 0xFB65,
-    0xFD65, 0xCD85, 0xCC64, 0xF365, 0x1842, 0xFF25, 0xF725, 0xF725,
-    0xD686, 0xCC64, 0x9AA3, 0xCE86, 0xA6C7, 0xA6C7, 0x9CE5, 0x6E08,
-    0x4DA8, 0x55A8, 0x2D49, 0x152A, 0x34C8, 0x4DA8, 0x04EA, 0x04EA,
-    0x04EA, 0x04EA, 0x04EA, 0x34C8, 0x6CA6, 0x2D49, 0x2D49, 0x6E28,
-    0x9CE5, 0x8667, 0x8667, 0xA6C7, 0x9AA3, 0xCF26, 0xD726, 0xF725,
-    0xCD65, 0x0000, 0xFE85, 0xF725, 0xFD65, 0xCA64, 0xFD85, 0x1842,
-    0xCC64, 0xFD85, 0xF465, 0xFC85, 0xF365, 0xF365, 0xF285, 0xEA85,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0xE906, 0xE106, 0xE165, 0xE145, 0xE9C5,
-    0xE9C5, 0xEA85, 0xF285, 0xE1A6, 0xE1A6, 0xF285, 0x90C4, 0xFC65,
-    0xF485, 0xFD65, 0x0000, 0xF485, 0xFD65, 0xFE65, 0xFE65, 0xFD65,
-    0xFE65, 0xFE85, 0xCC64, 0x9CE5, 0xCE66, 0xD726, 0xA6C7, 0x6AA3,
-    0x9CE5, 0x6E28, 0x55A8, 0x4DA8, 0x2D49, 0xA4E5, 0x3A42, 0x2D49,
-    0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x6CA6, 0x0000, 0x152A, 0x4DA8,
-    0x0000, 0x0000, 0x0000, 0xA2A3, 0x8667, 0x0000, 0xCD85, 0xD686,
-    0xCF26, 0xFF25, 0x0000, 0x0000, 0xFE65, 0xFE65, 0xF565, 0xFD65,
-    0xFD85, 0xF465, 0xFC85, 0xF465, 0xF365, 0xFB65, 0xEA85, 0xF265,
-    0xE9C5, 0xE9C5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0xE108, 0xE0E7, 0xE106, 0xE106, 0xE165,
-    0xE165, 0xE9C5, 0xE1A6, 0xE9C5, 0xE1A6, 0xF285, 0xF285, 0xF365,
-    0xF365, 0xFC85, 0x0000, 0x0000, 0xF465, 0xFE85, 0xFD65, 0xCC64,
-    0x0000, 0xF585, 0x0000, 0x0000, 0x0000, 0x9CE5, 0xA6C7, 0xD666,
-    0x0000, 0xA6C7, 0x6608, 0x6E28, 0x4DA8, 0x6E08, 0x1842, 0x0000,
-    0x34C8, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x2D49, 0x0000, 0x2D49,
-    0x55A8, 0x8667, 0x9CE5, 0xA6C7, 0xA6A7, 0xCF46, 0xCD65, 0xFF25,
-    0x62A3, 0xF725, 0xF725, 0xFE65, 0x0000, 0xF565, 0xFE65, 0xFE85,
-    0xFD65, 0xF485, 0xFB65, 0xF365, 0xEA65, 0xF365, 0xF285, 0xEA85,
-    0xE9C5, 0xF285, 0xE9C5, 0xE1A6, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0xE0AA, 0xE0C8, 0xE108, 0xE8E7, 0xE106,
-    0xE106, 0xE165, 0xE965, 0xE1A6, 0xE145, 0xE1C5, 0xE9C5, 0xF265,
-    0xF285, 0xF365, 0x0000, 0x0000, 0xF465, 0xFD85, 0xCB84, 0xF365,
-    0xFC65, 0xCB84, 0xF665, 0xFD85, 0xFD65, 0xCC84, 0xCC64, 0xD726,
-    0xD666, 0x0000, 0xA6C7, 0x8667, 0x6E08, 0x6E28, 0x6CA6, 0x0000,
-    0x0000, 0x0000, 0x152A, 0x04EA, 0x04EA, 0x150A, 0x152A, 0x2D49,
-    0x3569, 0x55A8, 0x4DA8, 0x8667, 0xA2A3, 0x9CE5, 0xA6C7, 0xD726,
-    0xCD65, 0xCC84, 0xCC64, 0xFE85, 0xFE65, 0xFC65, 0x5064, 0xFD85,
-    0xFD85, 0xFC65, 0xCA64, 0x0000, 0x0000, 0x0000, 0x0000, 0xEA85,
-    0xE9C5, 0xE9C5, 0xE145, 0xE145, 0xE106, 0xE108, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0xC8AA, 0x90E4, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0xA06B, 0xC88A, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0xE0AA, 0xE8C8, 0xE0C8, 0xE0A8, 0xE0C8,
-    0xE8A8, 0xE0E7, 0xE0C8, 0x0000, 0x0000, 0x0000, 0x0000, 0xD127,
-    0xE9C5, 0xF285, 0xE1A6, 0x0000, 0xF365, 0xFC85, 0xF365, 0xCA64,
-    0xFC65, 0xF585, 0xFD65, 0xFE85, 0xCB64, 0xFD85, 0xF725, 0xF725,
-    0xCF26, 0xCF26, 0xA6C7, 0xA6A7, 0x8667, 0x8667, 0x9CE5, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x6CA6, 0x04EA, 0x04EA, 0x152A, 0x2D49,
-    0x2D49, 0x6628, 0x6CA6, 0x8667, 0x8667, 0xA6A7, 0xA6C7, 0xCD85,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCD65, 0xFE65, 0xF585,
-    0xFD65, 0xCB84, 0x0000, 0xFC85, 0xF285, 0x0000, 0x0000, 0x0000,
-    0x1842, 0xE9C5, 0xE145, 0xE165, 0xE926, 0xE106, 0xE0E7, 0xE108,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE0AC, 0xE8AC, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0xE0AC, 0xE0AE, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0xE0AC, 0xE8AA, 0xE0AC, 0xE0AA, 0xE0AA,
-    0xE8A8, 0xE0C8, 0xE0C8, 0x0000, 0x0000, 0x0000, 0x0000, 0xE106,
-    0xE945, 0x0000, 0xE1A6, 0xEA85, 0xF285, 0xFB65, 0x90C4, 0x0000,
-    0x0000, 0x0000, 0x1842, 0x9AA3, 0xFD65, 0xFE65, 0xFE85, 0xF725,
-    0xFD65, 0xCD65, 0xD686, 0xD726, 0xA6A7, 0xA6C7, 0x8667, 0x6CA6,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2D49, 0x04EA, 0x152A,
-    0x2D49, 0x6E28, 0x0000, 0x0000, 0x0000, 0x0000, 0x6AA3, 0xD726,
-    0xCF26, 0x3222, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFC85,
-    0xFD65, 0xFD85, 0xF365, 0x0000, 0x0000, 0xF365, 0xF265, 0x0000,
-    0x0000, 0x0000, 0x5084, 0xE945, 0xE108, 0xD127, 0xE8E7, 0xE0E7,
-    0xE0C8, 0xE0AA, 0x0000, 0x0000, 0x0000, 0x0000, 0x986B, 0xE8AC,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x1842, 0xE8AE, 0x988B, 0x0000,
-    0x0000, 0x0000, 0x0000, 0xC88E, 0xE8AC, 0xE0AC, 0xE8AA, 0xE0AA,
-    0xE0AA, 0xE0AA, 0xE8AA, 0x0000, 0x0000, 0x0000, 0x0000, 0xE108,
-    0xE106, 0x5084, 0x0000, 0xE9C5, 0xE9C5, 0xF285, 0xE1A6, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFE85, 0xFE85, 0xCC64,
-    0x0000, 0x0000, 0x0000, 0x0000, 0xCE86, 0xCF26, 0xA6A7, 0xA6C7,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x34C8, 0x152A,
-    0x150A, 0x4DA8, 0x6628, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0xFF25, 0xF725, 0x9AA3, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0xF585, 0xFC65, 0xFC85, 0xC165, 0x0000, 0x0000, 0xF285,
-    0xE9C5, 0x988B, 0x0000, 0x0000, 0x1842, 0xE108, 0xE8AA, 0x986B,
-    0xE0C8, 0xE8AA, 0xE0AA, 0x986B, 0x0000, 0x0000, 0x0000, 0x0000,
-    0xE8AE, 0xC8AE, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD0B1, 0xC8B1, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x986B, 0xE0AE, 0xE0AE, 0xE8AC, 0xE0AE,
-    0xE0AC, 0xE0AC, 0xE8AC, 0x0000, 0x0000, 0x0000, 0x988B, 0xE108,
-    0xE0A8, 0x0000, 0x0000, 0xE108, 0xE165, 0xE9C5, 0xE9C5, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x90C4, 0xFD65, 0xCC64, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFE65, 0xD726, 0xCF26,
-    0x6AA3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x150A, 0x2D69, 0x2D49, 0x6E28, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x5864, 0xD585, 0xD585, 0xF725, 0xFF25, 0x9AA3, 0x0000, 0x0000,
-    0x5084, 0x5884, 0xFB65, 0xFC85, 0xF365, 0xF365, 0x90C4, 0x0000,
-    0x0000, 0xC965, 0xE165, 0xE108, 0x0000, 0x0000, 0x0000, 0xE8AA,
-    0xE0A8, 0xC88A, 0xC8AE, 0xE0AA, 0xE8AA, 0x0000, 0x0000, 0x0000,
-    0x0000, 0xA8D1, 0xC88E, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xC8AE, 0x986B,
-    0x0000, 0x0000, 0x0000, 0x1842, 0xE8AE, 0xE8AE, 0xE8AE, 0xE0AE,
-    0xC8AE, 0xE0AE, 0xE8AC, 0x0000, 0x0000, 0x0000, 0xC88A, 0xE0AA,
-    0x988B, 0x0000, 0x0000, 0xC0C6, 0xE906, 0xE165, 0xE145, 0xD127,
-    0x0000, 0x5884, 0x1842, 0x0000, 0xC985, 0xFC85, 0xFC65, 0xF485,
-    0xF365, 0x5064, 0x0000, 0x0000, 0x0000, 0x0000, 0xD686, 0xD746,
-    0xA6A7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x4DA8, 0x2D49, 0x4DA8, 0x6E28, 0x0000, 0x0000, 0x0000,
-    0x9CE5, 0xCD85, 0xCB84, 0x3222, 0x0000, 0xFE65, 0xFE65, 0xF665,
-    0xFD85, 0xFD65, 0xF485, 0xFC65, 0xF365, 0xF365, 0xF285, 0xF285,
-    0xE1C6, 0x0000, 0xE106, 0xE165, 0xE906, 0xE106, 0xE0C8, 0x0000,
-    0x0000, 0xC88A, 0xE0AA, 0xE8AC, 0xE0AC, 0xE0AC, 0xE0AC, 0x0000,
-    0x0000, 0x0000, 0x0000, 0xE8AE, 0xA08B, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x986B, 0xC8B1,
-    0x0000, 0x0000, 0x0000, 0x0000, 0xE0B0, 0xE0B0, 0xE0B0, 0xE0B0,
-    0xE0AE, 0xE0B0, 0xC8AE, 0x0000, 0x0000, 0xE0AC, 0xE8AC, 0xE0AC,
-    0xE8AA, 0x588B, 0x0000, 0xE0AA, 0xE0E7, 0xE926, 0xE106, 0xE145,
-    0xE145, 0xE9C5, 0xE9C5, 0xEA85, 0xF265, 0xF365, 0xFB65, 0x0000,
-    0xCB84, 0xFD85, 0xFD85, 0x9AA3, 0x0000, 0x0000, 0x1822, 0xF725,
-    0xD726, 0xCE86, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x6CA6, 0x4DA8, 0x55A8, 0x6E28, 0x6AA3, 0x0000,
-    0xCD65, 0xD686, 0x0000, 0x0000, 0x0000, 0x0000, 0xFD65, 0xFE65,
-    0xFD65, 0xF585, 0xFC65, 0xF485, 0xF365, 0xCA64, 0x1842, 0xC965,
-    0xE1A6, 0xE9C5, 0xE965, 0xE145, 0xC88A, 0x5084, 0xE8C8, 0xE0C8,
-    0xE8A8, 0xE0AC, 0x0000, 0x0000, 0xE0AC, 0xE0AC, 0xE8AC, 0xE0AE,
-    0xC8AE, 0x0000, 0x0000, 0x0000, 0xA8B1, 0xC8B1, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD0B1,
-    0x988B, 0x0000, 0x0000, 0x0000, 0xB0B1, 0xE0B0, 0xE0B0, 0xE0B0,
-    0xE0B0, 0xE0B0, 0x0000, 0x0000, 0xC8AE, 0xE8AE, 0xE0AC, 0xE0AC,
-    0x986B, 0xE8AC, 0xE0AA, 0xE0AA, 0xE8C8, 0xE0A8, 0xE0C8, 0xE0A8,
-    0xD127, 0xE965, 0xE145, 0xE9C5, 0xE9C5, 0xEA85, 0xF285, 0xC165,
-    0x0000, 0x0000, 0x0000, 0x9AA3, 0xFC85, 0x62A3, 0x0000, 0xCC84,
-    0xF725, 0xF725, 0xCD65, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x9CE5, 0x4DA8, 0x6E28, 0x6E28, 0xCD65,
-    0x3222, 0xCE86, 0x0000, 0x0000, 0x0000, 0x0000, 0xFC65, 0xF725,
-    0xFE85, 0xF565, 0xCB84, 0xFC85, 0xF465, 0xFC85, 0xFB65, 0xF285,
-    0x0000, 0x0000, 0x1842, 0xE165, 0xE906, 0xC88A, 0x0000, 0x0000,
-    0x988B, 0xE0AA, 0xE0AA, 0xE0AC, 0xE8AC, 0xC88E, 0xE0AE, 0xE0AE,
-    0xE8AE, 0xE8B0, 0x608B, 0x0000, 0x0000, 0x1842, 0xC8B1, 0x608B,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x588B,
-    0xB0D1, 0x0000, 0x0000, 0x0000, 0x1842, 0xE8B0, 0xC8B1, 0xE0B0,
-    0xE0B0, 0xE0B0, 0x1842, 0xE0B0, 0xE0B0, 0xE0B0, 0xE8AE, 0xC8B1,
-    0x0000, 0x0000, 0xE0AC, 0xE0AC, 0xE8AA, 0x988B, 0x0000, 0x0000,
-    0xE0AA, 0xE106, 0xE906, 0xE165, 0xE145, 0xE1A6, 0xF285, 0xF365,
-    0xF365, 0x0000, 0x0000, 0x0000, 0x0000, 0xCB84, 0xFC65, 0x0000,
-    0xFE65, 0xF725, 0xFF25, 0xCC84, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x6AA3, 0x4DA8, 0x4DA8, 0x8E67,
-    0x8667, 0xA6A7, 0x9CE5, 0x0000, 0x0000, 0x0000, 0x0000, 0xFE65,
-    0xFE65, 0xFE65, 0xCC64, 0xFC85, 0x0000, 0xC165, 0xF365, 0xFB65,
-    0xEA85, 0xE9C5, 0x5064, 0x0000, 0x98E4, 0xE906, 0xE0E7, 0xE0AA,
-    0x0000, 0x0000, 0x0000, 0xE0AC, 0xE8AC, 0xE0AC, 0xC8AE, 0xE0AE,
-    0xE8AE, 0xE0B0, 0xC8B1, 0xE0B0, 0x0000, 0x0000, 0x0000, 0xA8B1,
-    0xA8D1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x90D1, 0x90D1, 0x0000, 0x0000, 0x0000, 0xC8B1, 0xB0D1, 0xA8D1,
-    0xC8B1, 0xE8B0, 0xC8B1, 0xE0B0, 0xE0B0, 0xE0B0, 0xE0AE, 0x5884,
-    0x0000, 0x1842, 0xD08E, 0xE8AC, 0xE0AC, 0xC88A, 0x0000, 0x588B,
-    0xE8C8, 0xE0E7, 0xE0E7, 0xE906, 0xC0C6, 0xC0C6, 0xE108, 0xE9C5,
-    0xEA85, 0xF365, 0xF285, 0x0000, 0x0000, 0x0000, 0x0000, 0xF485,
-    0xCB84, 0xFE65, 0xF725, 0xF725, 0x5864, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4DA8, 0x6E28,
-    0x8667, 0xA6A7, 0xA6C7, 0x3222, 0x0000, 0x0000, 0x0000, 0x62A3,
-    0xFE65, 0xFE85, 0xFD65, 0xFC85, 0x5084, 0x0000, 0x0000, 0xC165,
-    0xF285, 0xF285, 0xE9C5, 0xE9C5, 0xC0C6, 0x986B, 0xE0E7, 0xE108,
-    0xE0C8, 0xE0AA, 0xE8AA, 0xA06B, 0x1842, 0xE0AE, 0xE8AE, 0x608B,
-    0x1842, 0xE0B0, 0xE0B0, 0xE0B0, 0xC8B1, 0xB0D1, 0x0000, 0x0000,
-    0x608B, 0xD0B1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x1842, 0xB0D1, 0x1842, 0x0000, 0x0000, 0x90D1, 0xA8B1, 0xB0D1,
-    0xA8B1, 0xC8B1, 0xD0B1, 0x78F1, 0xA8B1, 0xE0B0, 0xE0B0, 0x0000,
-    0x1842, 0xE0B0, 0xE8AE, 0xE0AE, 0xE0AC, 0xE8AE, 0x0000, 0x988B,
-    0xE0AA, 0xE0AA, 0xE8A8, 0xE8E7, 0x5084, 0x0000, 0x0000, 0xD127,
-    0xE1A6, 0xF285, 0xEA65, 0xF365, 0x0000, 0x0000, 0x0000, 0x0000,
-    0xCB84, 0xFE65, 0xFE65, 0xFF25, 0xF745, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6E08,
-    0x6E28, 0xA6A7, 0xA6C7, 0xD726, 0x1822, 0x0000, 0x0000, 0x0000,
-    0x0000, 0xFE85, 0xFD65, 0xFD65, 0xFC85, 0xF365, 0x5064, 0x0000,
-    0x0000, 0xC985, 0xE9C5, 0xE9C5, 0xE145, 0xE106, 0xE8E7, 0xE0E7,
-    0xE0C8, 0xE0AA, 0xE8C8, 0xE0AA, 0xE0AC, 0xE0AE, 0xE8AC, 0xE0AE,
-    0xE0AE, 0x0000, 0x0000, 0x588B, 0xE8B0, 0xE0B0, 0xC8B1, 0x0000,
-    0x0000, 0x0000, 0x88D1, 0x78F1, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x78D1, 0x78F1, 0x0000, 0x0000, 0x0000, 0x90D1, 0xB0D1,
-    0xA8B1, 0xB0D1, 0x588B, 0x0000, 0x0000, 0xD0B1, 0xC8B1, 0xC8B1,
-    0xC8B1, 0xE8B0, 0xE0AE, 0xE0B0, 0xC88E, 0xE8AE, 0xE0AC, 0xE0AE,
-    0xE0AC, 0xE8AC, 0xE0C8, 0xE0A8, 0x5084, 0x0000, 0x0000, 0x1842,
-    0xE908, 0xE9C5, 0xE9C5, 0xF285, 0xF285, 0x0000, 0x0000, 0x0000,
-    0x0000, 0xCA64, 0xF565, 0xFE85, 0xFE65, 0xF725, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x6628, 0x8667, 0xA6A7, 0xCF26, 0xCF46, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0xFC65, 0xFE65, 0xF585, 0xFD65, 0xFC85, 0xF465,
-    0xF285, 0xEA85, 0xC0C6, 0xE9C5, 0xE145, 0xE965, 0xE106, 0xE108,
-    0xE0C8, 0xE0AA, 0xE8AA, 0xE0AC, 0xE0AC, 0xE0AE, 0xE8AE, 0xE0AE,
-    0xE0AE, 0xE8B0, 0xC8B1, 0x0000, 0x0000, 0x608B, 0xC8B1, 0xC8B1,
-    0xB0B1, 0x0000, 0x0000, 0x78F1, 0x90D1, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x78F1, 0x4931, 0x0000, 0x0000, 0x78F1, 0x88F1,
-    0x90D1, 0xB0B1, 0x0000, 0x0000, 0x0000, 0xA8D1, 0xB0D1, 0xC8B1,
-    0xC8B1, 0xE0B0, 0xE0B0, 0xE0B0, 0xE0B0, 0xE0B0, 0xE0AE, 0xE0AE,
-    0xE0AC, 0xE8AE, 0xE0AC, 0xE0AC, 0xE0AA, 0x0000, 0xC88A, 0xE108,
-    0xE906, 0xE165, 0xE145, 0xE9C5, 0xE9C5, 0x9AA3, 0x0000, 0x0000,
-    0x0000, 0x0000, 0xCB84, 0xFE65, 0xFE65, 0xF725, 0xCE66, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x8667, 0x8667, 0xA6A7, 0xAEC7, 0xCF26, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0xFE65, 0xFD65, 0xFD65, 0xFC85, 0xF465,
-    0xF365, 0xF365, 0xE9C5, 0xE9C5, 0xE145, 0xE165, 0xE906, 0xE108,
-    0xE0C8, 0xE0A8, 0xE0C8, 0xE8AA, 0xE0AA, 0xE0AC, 0xE0AC, 0xE8AE,
-    0xE0AE, 0xE0B0, 0xE0AE, 0xE0B0, 0x588B, 0x0000, 0x0000, 0xD0B1,
-    0xA8B1, 0xB0D1, 0x190B, 0x0000, 0x0000, 0x78D1, 0x190B, 0x0000,
-    0x0000, 0x0000, 0x210B, 0x6111, 0x0000, 0x0000, 0x210B, 0x78F1,
-    0x78D1, 0x78F1, 0x6111, 0x0000, 0x0000, 0x78D1, 0x90D1, 0xB0D1,
-    0xA8D1, 0xD0B1, 0xC8B1, 0xC8B1, 0xC8B1, 0xE8B0, 0xE0AE, 0xE0B0,
-    0xE0AE, 0xE8AE, 0xE0AC, 0xE0AC, 0xE0AA, 0xE8AA, 0xE0A8, 0xE0C8,
-    0xE0A8, 0xE906, 0xE126, 0xE165, 0xE145, 0xE9C5, 0xE1A6, 0x0000,
-    0x0000, 0x0000, 0x0000, 0xFB85, 0xFD85, 0xF665, 0xFE65, 0xFC65,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x6CA6, 0xA6A7, 0xA6C7, 0xCF26, 0xCF26, 0xCD85,
-    0x0000, 0x0000, 0x0000, 0xF465, 0xFD85, 0xFC65, 0x0000, 0xCA64,
-    0xF365, 0xF365, 0xF285, 0xEA85, 0xE9C5, 0xE9C5, 0xE126, 0xE106,
-    0xE8E7, 0xE0E7, 0xE0A8, 0xE0AA, 0xE8AC, 0xE0AE, 0xE0AC, 0xE0AE,
-    0xE8AE, 0xE0B0, 0xE0B0, 0xE0B0, 0xE0B0, 0xE8B0, 0x1842, 0x0000,
-    0xA8D1, 0x90F1, 0x608B, 0x90D1, 0x0000, 0x0000, 0x4951, 0x6911,
-    0x0000, 0x0000, 0x0000, 0x6111, 0x4931, 0x0000, 0x0000, 0x6111,
-    0x6911, 0x0000, 0x6111, 0x78F1, 0x0000, 0x4931, 0x88F1, 0x90D1,
-    0x90D1, 0xA8D1, 0xB0B1, 0xC8B1, 0xC8B1, 0xE0B0, 0xE0B0, 0xE0B0,
-    0xE0B0, 0xE0B0, 0xE0AE, 0xE0AE, 0xE8AC, 0xE0AC, 0xE0AA, 0xE0AA,
-    0xE8C8, 0xE0E7, 0xE0E7, 0xE106, 0xC0C6, 0xD127, 0xE9C5, 0xF265,
-    0x1842, 0x0000, 0x0000, 0x0000, 0xFC85, 0xFD65, 0xF665, 0xFE85,
-    0x9AA3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x3222, 0x8667, 0xAEC7, 0xA6C7, 0xD726,
-    0xCF26, 0xFD65, 0x0000, 0x0000, 0xFC65, 0xF685, 0xC165, 0x0000,
-    0x0000, 0x0000, 0xE1A6, 0xF285, 0xE9C5, 0xE1A6, 0xE108, 0xE108,
-    0xE0A8, 0xC88A, 0x90E4, 0x1842, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x608B, 0xE8B0, 0xE0B0, 0xE0B0, 0xC8B1, 0xC8B1,
-    0x90D1, 0xB0D1, 0x0000, 0x0000, 0x78F1, 0x4931, 0x0000, 0x0000,
-    0x4931, 0x190B, 0x0000, 0x210B, 0x4951, 0x0000, 0x0000, 0x190B,
-    0x5131, 0x4951, 0x0000, 0x4931, 0x6911, 0x608B, 0x6111, 0x78F1,
-    0x78F1, 0x90D1, 0x90D1, 0x78F1, 0x1842, 0x0000, 0x0000, 0x0000,
-    0x1842, 0xA08B, 0xA06B, 0xC8B1, 0xC8B1, 0xE8AE, 0xE0AC, 0xE8AC,
-    0xE0AA, 0xE0AA, 0xE0C8, 0xE8A8, 0x0000, 0x0000, 0x0000, 0xE1A6,
-    0xE9C5, 0x90E4, 0x0000, 0x0000, 0xF285, 0xF485, 0xFC65, 0xFD85,
-    0xF665, 0x1842, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA6A7, 0xA6C7, 0xD726,
-    0xCF26, 0xF725, 0xF725, 0xF725, 0xFD65, 0xFE85, 0xF565, 0xFD85,
-    0xFC65, 0xF485, 0xFB65, 0xF365, 0xF285, 0xE9C5, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1842, 0xB0B1, 0xC8B1,
-    0xB0D1, 0xB0D1, 0x90D1, 0x1842, 0x0000, 0x78F1, 0x6911, 0x0000,
-    0x0000, 0x4931, 0x3191, 0x0000, 0x3191, 0x4951, 0x0000, 0x0000,
-    0x3191, 0x4931, 0x190B, 0x0000, 0x210B, 0x6111, 0x6111, 0x6111,
-    0x6911, 0x78F1, 0x190B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x1842, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0xC88A, 0xE0AA, 0xE8AA, 0xE0A8, 0xE108, 0xE108, 0xE165,
-    0xE145, 0xF285, 0xE1A6, 0xF265, 0xF365, 0xF485, 0xFC65, 0xFD85,
-    0xFD65, 0xFE65, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCD65, 0xD746,
-    0xCF26, 0xF725, 0xCF26, 0xFF25, 0xFE65, 0xFE65, 0xF565, 0xFD65,
-    0xFC85, 0xF465, 0xF365, 0xF365, 0xF285, 0xF265, 0xE145, 0xE108,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0xA8D1, 0x88D1, 0x90D1, 0x78F1, 0x0000, 0x190B, 0x6911,
-    0x190B, 0x0000, 0x2042, 0x3191, 0x2991, 0x3191, 0x1842, 0x0000,
-    0x210B, 0x3191, 0x3191, 0x0000, 0x1842, 0x4931, 0x3191, 0x4951,
-    0x5131, 0x190B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0xE8AA, 0xE8AA, 0xE8C8, 0xE0C8, 0xE0A8, 0xE0E7,
-    0xE906, 0xE165, 0xE165, 0xF285, 0xEA65, 0xF365, 0xFB65, 0xF485,
-    0xFC65, 0xFD85, 0xCC64, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCD65,
-    0xA6C7, 0xF725, 0xF725, 0xFF25, 0xF725, 0xF725, 0xF665, 0xFE65,
-    0xFD85, 0xFC65, 0xF365, 0xF365, 0xEA85, 0xF285, 0xE1A6, 0xE9C5,
-    0xE965, 0xA06B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x78F1, 0x78D1, 0x78F1, 0x6111, 0x0000,
-    0x4931, 0x4931, 0x0000, 0x3191, 0x3191, 0x3191, 0x2991, 0x2212,
-    0x0000, 0x2212, 0x3191, 0x2212, 0x0000, 0x3191, 0x3191, 0x4931,
-    0x2991, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0xC88E, 0xE0AC, 0xE0AA, 0xE8AC, 0xE0C8, 0xE0E7,
-    0xE0E7, 0xE106, 0xE145, 0xE9C5, 0xE9C5, 0xF285, 0xEA65, 0xF365,
-    0xFC85, 0xFD65, 0xF585, 0xCB84, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x5864, 0xD746, 0xCF26, 0xF725, 0xFF25, 0xF725, 0xFE65, 0xFE65,
-    0xFD65, 0xF585, 0xCA64, 0x0000, 0xC165, 0xFB65, 0xE9C5, 0xE9C5,
-    0xE145, 0xE165, 0xE0E7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6111, 0x6111, 0x6111,
-    0x4931, 0x190B, 0x3191, 0x2042, 0x3191, 0x2212, 0x2991, 0x2212,
-    0x21F2, 0x2042, 0x2212, 0x2212, 0x0000, 0x21F2, 0x3191, 0x2991,
-    0x09EE, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x2042, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x608B, 0xE8AE, 0xE0AC, 0xE8AC, 0xE0AA, 0xE0AA,
-    0xE0C8, 0x988B, 0x5884, 0xE945, 0xE165, 0xE9C5, 0xE9C5, 0xF285,
-    0xF365, 0xF465, 0xFC85, 0xFD65, 0x1842, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0xD666, 0xF725, 0xF725, 0xF725, 0xF725, 0xF725,
-    0xFE65, 0xFE85, 0xFD65, 0xF485, 0xF265, 0xF365, 0xEA85, 0xF285,
-    0xE9C5, 0xE9A6, 0xE108, 0xE108, 0xE8C8, 0x1842, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6911,
-    0x4931, 0x4931, 0x3191, 0x2212, 0x3191, 0x3242, 0x21F2, 0x1A53,
-    0x2212, 0x3A42, 0x1A53, 0x12B4, 0x210B, 0x12B4, 0x21F2, 0x1A53,
-    0x2212, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1842, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x608B, 0xE0B0, 0xC8AE, 0xE0AE, 0xE0AC, 0xE0AC,
-    0xE8C8, 0xE108, 0xE0AA, 0xD127, 0xE106, 0xE1A6, 0xE9C5, 0xF265,
-    0xEA85, 0xFB65, 0xF365, 0xF465, 0xFC85, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0xCD65, 0xCF46, 0xFF25, 0xF725, 0xF725,
-    0xFD65, 0xCB84, 0xFD65, 0xFD85, 0xF465, 0xF365, 0xF285, 0xF265,
-    0xE9C5, 0xE1C5, 0xE145, 0xE108, 0xE0C8, 0xE8E7, 0xE0A8, 0xC88A,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x190B, 0x6111,
-    0x4951, 0x4931, 0x3191, 0x3191, 0x3191, 0x2212, 0x1842, 0x1A53,
-    0x1A53, 0x12B4, 0x2042, 0x12B4, 0x1AB4, 0x12B4, 0x1A53, 0x1AB4,
-    0x1A53, 0x1A53, 0x2212, 0x210B, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0xA06B, 0xE0B0, 0xE0AE, 0xA8D1, 0xD08E, 0xE0AC,
-    0xE8AA, 0xE0AA, 0xE0C8, 0xE0A8, 0xE8E7, 0xE106, 0xE165, 0xE1A6,
-    0xD127, 0xF285, 0xF285, 0xF365, 0xFC85, 0xCA64, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF725, 0xF725, 0xF725,
-    0xFE85, 0xCC84, 0x9AA3, 0xF365, 0xFC65, 0xFC85, 0xF365, 0xF365,
-    0xEA65, 0xF285, 0xE165, 0xE965, 0xE106, 0xE108, 0xE8A8, 0x1842,
-    0xE8AA, 0xE8AC, 0x608B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x1842, 0x78F1, 0x90D1, 0x78F1, 0x6111,
-    0x5131, 0x4931, 0x3191, 0x190B, 0x3191, 0x2212, 0x2212, 0x1AB4,
-    0x1A53, 0x12B4, 0x1AB4, 0x0B56, 0x1AB4, 0x1356, 0x0B56, 0x210B,
-    0x12B4, 0x12B4, 0x1A53, 0x1A53, 0x21F2, 0x2212, 0x3191, 0x210B,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x1842, 0xA8D1, 0xE0B0, 0xA8B1, 0xE0B0, 0xE8AE, 0xE0AE,
-    0xE0AC, 0xE0AC, 0xE8AA, 0xE0AA, 0xE0C8, 0xE108, 0xE106, 0xE965,
-    0xE906, 0x90E4, 0xE1A6, 0xF365, 0xF365, 0xF465, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCC64, 0xF725,
-    0xFF25, 0xF725, 0xFD65, 0xCA64, 0x0000, 0xCA64, 0xF365, 0xF365,
-    0xF285, 0xF265, 0xE9C5, 0xE145, 0x1842, 0xE106, 0xE8C8, 0xE0AA,
-    0x0000, 0x5084, 0xE8AA, 0xE0AC, 0xE8AE, 0xE0B0, 0xE0AE, 0xE0B0,
-    0xC8B1, 0xA8D1, 0xB0B1, 0xA8D1, 0xB0B1, 0x88D1, 0x78F1, 0x6111,
-    0x0000, 0x4931, 0x3191, 0x3191, 0x3191, 0x2212, 0x2212, 0x1A53,
-    0x12B4, 0x12B4, 0x1AB4, 0x0B56, 0x1356, 0x1356, 0x1356, 0x0B56,
-    0x1356, 0x1356, 0x12B4, 0x1AB4, 0x210B, 0x09EE, 0x2212, 0x2212,
-    0x3191, 0x3191, 0x2991, 0x4931, 0x210B, 0x190B, 0x210B, 0x78D1,
-    0x78F1, 0xB0B1, 0xB0D1, 0xC8B1, 0x0000, 0x0000, 0xE8AE, 0xE0AE,
-    0xE0AE, 0x986B, 0xE8AA, 0xE0AA, 0xE8C8, 0xE0A8, 0xE0C8, 0xE106,
-    0x0000, 0x988B, 0xC965, 0xE9C5, 0xF285, 0xF365, 0xE1A6, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0xFE65, 0xF725, 0xFE65, 0xFE65, 0xFD85, 0xCB84, 0xF465, 0xFC85,
-    0xF365, 0x9AA3, 0xF285, 0xE9C5, 0x5884, 0x0000, 0xC0C6, 0xE0E7,
-    0xE0C8, 0xE108, 0xE0AA, 0xE8AC, 0xE0AC, 0xE0AE, 0xE8AE, 0xE0B0,
-    0xE0B0, 0xE0B0, 0xB0B1, 0x78F1, 0xB0D1, 0x90D1, 0x0000, 0x0000,
-    0x0000, 0x1842, 0x5131, 0x4931, 0x3191, 0x2212, 0x2212, 0x09EE,
-    0x0000, 0x1356, 0x0B56, 0x1356, 0x1356, 0x0BF8, 0x0BD8, 0x0000,
-    0x0BF8, 0x0BD8, 0x1356, 0x0B56, 0x1AB4, 0x0333, 0x0000, 0x0000,
-    0x0000, 0x2212, 0x3191, 0x4951, 0x3191, 0x6111, 0x6111, 0x90D1,
-    0x88D1, 0xB0D1, 0xA8B1, 0xD0B1, 0xC8B1, 0xE0B0, 0xA8D1, 0xE0B0,
-    0xE8AE, 0x588B, 0x0000, 0x988B, 0xE8AA, 0xE0AA, 0xC88A, 0xE0E7,
-    0xE8E7, 0xE1A6, 0x90C4, 0xE9C5, 0xEA85, 0xF365, 0xF285, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0xCB84, 0xF665, 0xFE65, 0xFD65, 0xF485, 0xFC65,
-    0xF365, 0x90C4, 0xF285, 0xF285, 0xE0E8, 0x0000, 0x0000, 0x5084,
-    0xE8C8, 0xE0A8, 0xE0C8, 0xE0AA, 0x5884, 0x0000, 0xE8AE, 0xE0AE,
-    0xC88E, 0xE0B0, 0xC8B1, 0xC8B1, 0x988B, 0xB0B1, 0x0000, 0x0000,
-    0x0000, 0x6111, 0x4931, 0x4951, 0x3191, 0x3191, 0x3191, 0x2212,
-    0x0000, 0x1842, 0x12B4, 0x1356, 0x1356, 0x0BD8, 0x0BF8, 0x0479,
-    0x0000, 0x0000, 0x0BD8, 0x0BF8, 0x1356, 0x1356, 0x12B4, 0x1AB4,
-    0x210B, 0x0000, 0x0000, 0x3191, 0x2991, 0x3191, 0x4931, 0x6911,
-    0x78F1, 0x0000, 0x90D1, 0xA8D1, 0x0000, 0xD0B1, 0xC8B1, 0xE0B0,
-    0xE8AE, 0xE0B0, 0x0000, 0x0000, 0x0000, 0xE0AC, 0xE0A8, 0xE0AA,
-    0xC88A, 0xE926, 0xE106, 0xE165, 0xE9C5, 0xF285, 0x986B, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9AA3, 0xF485, 0xFD65,
-    0xFB65, 0xF365, 0xEA85, 0xF285, 0xE9C5, 0xD927, 0x90C4, 0x5884,
-    0x5084, 0xE8E7, 0xE0C8, 0xE8AC, 0x0000, 0x0000, 0x986B, 0xE0AE,
-    0xC8AE, 0x0000, 0xE0B0, 0xE8B0, 0xC8B1, 0xD0B1, 0x608B, 0x0000,
-    0x1842, 0x78F1, 0x6911, 0x1842, 0x210B, 0x4931, 0x3191, 0x2212,
-    0x0000, 0x0000, 0x09EE, 0x1356, 0x1356, 0x0BD8, 0x0BD8, 0x0479,
-    0x0C99, 0x0000, 0x0000, 0x09EE, 0x0BF8, 0x0BD8, 0x1356, 0x0000,
-    0x12B4, 0x1AB4, 0x2212, 0x0000, 0x0000, 0x4951, 0x4931, 0x6111,
-    0x6111, 0x6111, 0x0000, 0xB0B1, 0xA8D1, 0x0000, 0x0000, 0x1842,
-    0xE0B0, 0xE0B0, 0xE8AE, 0x0000, 0x0000, 0x0000, 0xC88E, 0xE0AA,
-    0xE0C8, 0xE108, 0xE108, 0xE906, 0xE108, 0x988B, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x1842, 0x98C4, 0xC185, 0xE9A6, 0xE1A6, 0xD127, 0xE965,
-    0xE108, 0xE108, 0xE0C8, 0xE0AA, 0x5084, 0xD08E, 0x0000, 0xE8AE,
-    0xE0AE, 0xE0B0, 0x0000, 0xA8D1, 0xC8B1, 0xC8B1, 0xB0B1, 0x90D1,
-    0x1842, 0x90F1, 0x4931, 0x0000, 0x0000, 0x3191, 0x2991, 0x3191,
-    0x0000, 0x0000, 0x0000, 0x1A73, 0x0B56, 0x0BD8, 0x0BF8, 0x0C79,
-    0x0479, 0x0C79, 0x0000, 0x0000, 0x0000, 0x0479, 0x0BD8, 0x0BF8,
-    0x09EE, 0x0000, 0x210B, 0x1A53, 0x09EE, 0x2042, 0x3191, 0x4951,
-    0x4931, 0x6911, 0x0000, 0x0000, 0x90F1, 0xB0D1, 0x986B, 0xB0D1,
-    0x588B, 0xD08E, 0xE0AE, 0xE0B0, 0xC8AE, 0xC88E, 0xD0AE, 0xC88E,
-    0xC88A, 0xC8AE, 0x5884, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x2042, 0x1842, 0x0000, 0x1842, 0xE108, 0xC88E, 0xE0AC,
-    0xE8AC, 0xE0B0, 0xE0B0, 0xE0B0, 0x988B, 0xE0B0, 0xD0B1, 0xC8B1,
-    0xA8B1, 0xB0D1, 0x6911, 0x0000, 0x0000, 0x0000, 0x3191, 0x3191,
-    0x3191, 0x0000, 0x0000, 0x0000, 0x09EE, 0x0BF8, 0x0BD8, 0x0479,
-    0x0C79, 0x0479, 0x0C79, 0x0000, 0x0000, 0x0000, 0x0000, 0x0479,
-    0x0BF8, 0x0BD8, 0x0000, 0x0000, 0x0000, 0x1A73, 0x2991, 0x3191,
-    0x3191, 0x6111, 0x4931, 0x4931, 0x78F1, 0xB0B1, 0xA8D1, 0xB0D1,
-    0x90D1, 0xD0B1, 0x1842, 0x0000, 0x0000, 0x608B, 0x1842, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x5884, 0xE8AA, 0xE8C8, 0xE0AC,
-    0xE0AC, 0xE8AE, 0xE0AE, 0xE0B0, 0xE0B0, 0xE0B0, 0xC8B1, 0xC8B1,
-    0xA8B1, 0xB0D1, 0x90D1, 0x78F1, 0x0000, 0x0000, 0x2991, 0x4931,
-    0x3191, 0x0000, 0x0000, 0x0000, 0x0000, 0x1A53, 0x0B56, 0x0BF8,
-    0x0BD8, 0x0C99, 0x0479, 0x0C79, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0333, 0x0BD8, 0x1356, 0x210B, 0x0000, 0x09EE, 0x2212, 0x2212,
-    0x3191, 0x4931, 0x4931, 0x6911, 0x6111, 0x90D1, 0x90F1, 0xB0D1,
-    0xA8B1, 0xB0D1, 0xC8B1, 0xE0B0, 0x5884, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0xE8C8, 0xE108, 0xE0A8, 0xE0AA,
-    0xE0AA, 0xE8AC, 0xE0AC, 0xE8AE, 0xC8AE, 0xE0B0, 0xE0B0, 0xE0B0,
-    0xC8B1, 0xD0B1, 0xB0D1, 0x90D1, 0x78D1, 0x78F1, 0x4951, 0x4931,
-    0x3191, 0x3191, 0x0000, 0x0000, 0x0000, 0x0000, 0x09EE, 0x0BF8,
-    0x0BD8, 0x0479, 0x0C79, 0x0479, 0x0C79, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0BF8, 0x0BD8, 0x1356, 0x0333, 0x1A53, 0x2212,
-    0x3191, 0x2991, 0x3191, 0x4931, 0x6111, 0x78F1, 0x78F1, 0x90D1,
-    0xA8B1, 0xD0B1, 0xC8B1, 0xE0B0, 0xE0B0, 0xE0B0, 0xC8B1, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0xC0C6, 0xE106, 0xE108, 0xE0C8, 0xE0A8,
-    0xE8C8, 0xE0AC, 0xE0AC, 0xE0AE, 0xC8B1, 0x0000, 0xE8AE, 0xE0B0,
-    0xC8B1, 0xC8B1, 0xA8B1, 0xB0D1, 0x90D1, 0x88D1, 0x6111, 0x6111,
-    0x4951, 0x4931, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0A0E,
-    0x1356, 0x0BD8, 0x0BF8, 0x0C79, 0x0479, 0x0C79, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x09EE, 0x1356, 0x1356, 0x1A53, 0x1A53,
-    0x2212, 0x2212, 0x3191, 0x4931, 0x4931, 0x6911, 0x6111, 0x1842,
-    0x6911, 0xB0D1, 0xA8B1, 0xD0B1, 0xC8B1, 0xE0B0, 0xE8AE, 0xE0B0,
-    0xE0AE, 0x988B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0xE1A6, 0xE145, 0xE965, 0xE0E7, 0xE0E7,
-    0xE0A8, 0xE8AA, 0xE0AA, 0xE8AC, 0xC8AE, 0xC88E, 0xE0AE, 0xE0B0,
-    0xB0D1, 0xE0B0, 0xD0B1, 0x1842, 0x90D1, 0xB0D1, 0x78D1, 0x78F1,
-    0x6111, 0x6911, 0x190B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x1AB4, 0x1356, 0x0B56, 0x0BD8, 0x0BD8, 0x0C79, 0x0479, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1356, 0x1AB4, 0x12B4,
-    0x2212, 0x2212, 0x2991, 0x0000, 0x3191, 0x6111, 0x4931, 0x78F1,
-    0x78F1, 0x90D1, 0x90D1, 0xC8B1, 0xC8B1, 0xE0B0, 0xE0B0, 0xE0B0,
-    0xE0AE, 0xE0AE, 0xE0AC, 0xE8AE, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x5084, 0xF285, 0xE9C5, 0xE965, 0xE106, 0xE0E7,
-    0xE0C8, 0xE8A8, 0xE0C8, 0xE0AC, 0xE0AC, 0xE8AE, 0xE0AE, 0xC8B1,
-    0xE0B0, 0xA8B1, 0xC8B1, 0xD0B1, 0x0000, 0xA8D1, 0x90D1, 0x90D1,
-    0x78F1, 0x6111, 0x4931, 0x4951, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x12B4, 0x12B4, 0x1356, 0x1356, 0x0BF8, 0x0BD8, 0x0BF8,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0B33, 0x12B4, 0x1AB4,
-    0x1A53, 0x2212, 0x3191, 0x3191, 0x0000, 0x4931, 0x4931, 0x4931,
-    0x6911, 0x78F1, 0x90D1, 0x90F1, 0xA8D1, 0xC8B1, 0xD0B1, 0xE0B0,
-    0xC8B1, 0xE0B0, 0xE8AE, 0xE0AC, 0xE0AC, 0xE0AC, 0x5884, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0xCA64, 0xF365, 0xE9C5, 0xE9C5, 0xE145, 0xE165,
-    0xE8E7, 0xE108, 0xE0A8, 0xE0AC, 0xE0AA, 0xE8AC, 0xE0AC, 0xE8AE,
-    0xC8B1, 0xE0B0, 0x988B, 0xE0B0, 0xD0B1, 0xC8B1, 0xA8B1, 0xB0D1,
-    0x90D1, 0x78F1, 0x608B, 0x6911, 0x4951, 0x4931, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x1AB4, 0x12B4, 0x1AB4, 0x0B56, 0x1356, 0x0BD8,
-    0x0BF8, 0x0000, 0x0000, 0x0000, 0x0000, 0x09EE, 0x1356, 0x12B4,
-    0x1A53, 0x1A53, 0x2212, 0x2212, 0x3191, 0x4931, 0x4931, 0x6111,
-    0x6111, 0x78F1, 0x78D1, 0xB0D1, 0x90D1, 0xC8B1, 0xC8B1, 0xC8B1,
-    0xE0B0, 0xC8AE, 0xE0AE, 0xE8AE, 0xE0AC, 0xE0AC, 0xE0AA, 0xE8AA,
-    0xC88A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0xF365, 0xF365, 0xF285, 0xF285, 0xE9C5, 0xE145,
-    0xE106, 0xE106, 0xE0C8, 0xE0C8, 0x90C4, 0x608B, 0xE8AA, 0xE0AE,
-    0x0000, 0xE0B0, 0xE0AE, 0xC8B1, 0xE0B0, 0xE0B0, 0xB0D1, 0xA8B1,
-    0xB0D1, 0x88D1, 0x0000, 0x0000, 0x4931, 0x6111, 0x3191, 0x190B,
-    0x0000, 0x0000, 0x0000, 0x1A73, 0x1A53, 0x1AB4, 0x12B4, 0x1356,
-    0x1356, 0x0BD8, 0x0000, 0x0000, 0x0000, 0x0000, 0x12B4, 0x1AB4,
-    0x12B4, 0x0000, 0x0000, 0x2212, 0x3191, 0x4931, 0x3191, 0x4931,
-    0x6911, 0x78F1, 0x78F1, 0x90D1, 0x78F1, 0x0000, 0xB0B1, 0xC8B1,
-    0x0000, 0xC8B1, 0xE8AE, 0xE0AE, 0xE8AC, 0xE0AC, 0xE0AA, 0xE0AA,
-    0xE8C8, 0xE0A8, 0xE0C8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0xF485, 0xFC65, 0xF365, 0xF365, 0xF285, 0xEA85,
-    0xE945, 0xE165, 0xE106, 0xE108, 0xE0C8, 0xE8AA, 0xE0AC, 0xE0AC,
-    0xE0AC, 0xE0B0, 0xE8AE, 0xE0B0, 0xE0B0, 0xE0B0, 0xC8B1, 0xD0B1,
-    0xA8B1, 0xB0D1, 0x90F1, 0x608B, 0x0000, 0x0000, 0x4931, 0x4931,
-    0x3191, 0x0000, 0x0000, 0x0000, 0x2212, 0x1AB4, 0x12B4, 0x1AB4,
-    0x12B4, 0x1356, 0x1356, 0x0000, 0x0000, 0x0000, 0x12B4, 0x12B4,
-    0x1A53, 0x0000, 0x0000, 0x0000, 0x3191, 0x2212, 0x4931, 0x4951,
-    0x4931, 0x78D1, 0x78F1, 0x90F1, 0x90D1, 0x78D1, 0xA8D1, 0xD0B1,
-    0xA8B1, 0xA8D1, 0xE0B0, 0xE0B0, 0xE0AE, 0xE8AE, 0xE0AC, 0xE0AC,
-    0xE0AA, 0xE8AA, 0xE0A8, 0xE108, 0xE108, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0xFC65, 0xFD85, 0xF465, 0xF365, 0xF285, 0xEA65,
-    0xE9C5, 0xE9C5, 0xE108, 0xE106, 0xE0E7, 0xE0E7, 0xE8C8, 0xE0AA,
-    0xE0AA, 0xE0AC, 0xE8AC, 0xE0AE, 0xE0AE, 0xE0B0, 0xE0B0, 0xE0B0,
-    0xC8B1, 0xC8B1, 0xB0B1, 0xA8D1, 0x90D1, 0x0000, 0x0000, 0x0000,
-    0x4931, 0x4951, 0x1842, 0x0000, 0x3191, 0x2212, 0x2212, 0x1A53,
-    0x1A53, 0x12B4, 0x1A53, 0x1AB4, 0x12B4, 0x0000, 0x0000, 0x1AB4,
-    0x1A53, 0x09EE, 0x0000, 0x0000, 0x3191, 0x3191, 0x3191, 0x4931,
-    0x4931, 0x6911, 0x6111, 0x78F1, 0x90D1, 0xB0D1, 0xA8D1, 0xC8B1,
-    0xD0B1, 0xE0B0, 0xE0B0, 0xE0B0, 0xE0AE, 0xE8AE, 0xE0AC, 0xE0AC,
-    0xE0AA, 0xE8AA, 0xE0A8, 0xE0C8, 0xE0E7, 0xE906, 0xE108, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0xFD65, 0xF585, 0xFC65, 0xFC85, 0xF365, 0xF365,
-    0xEA85, 0xF285, 0xD127, 0x0000, 0xE108, 0xE906, 0xE0E7, 0xE0A8,
-    0xE0C8, 0xE8AC, 0xE0AC, 0xE0AE, 0xE8AE, 0xE0B0, 0xE0B0, 0xE0B0,
-    0xC8B1, 0x0000, 0x90F1, 0xC8B1, 0x90D1, 0xB0B1, 0x78F1, 0x0000,
-    0x0000, 0x5151, 0x4931, 0x4931, 0x210B, 0x2212, 0x0000, 0x21F2,
-    0x2212, 0x1A53, 0x2212, 0x12B4, 0x0000, 0x1AB4, 0x0000, 0x09EE,
-    0x2212, 0x1A53, 0x0000, 0x0000, 0x190B, 0x3191, 0x3191, 0x4951,
-    0x4931, 0x0000, 0x4931, 0x78F1, 0x90D1, 0xA8D1, 0xB0B1, 0xC8B1,
-    0xC8B1, 0xC8B1, 0xE0B0, 0xE0B0, 0xE0AE, 0xE0B0, 0xE8AE, 0xC8AE,
-    0x1842, 0xE8AC, 0xE0AA, 0xE0A8, 0xE0C8, 0xE926, 0xE106, 0xE145,
-    0xE165, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0xCB84, 0xFE85, 0xFD65, 0xF565, 0xFC85, 0xF465,
-    0xF365, 0xFB65, 0xE9C5, 0xE1A6, 0x0000, 0x0000, 0xE0E7, 0xE0AA,
-    0x0000, 0x0000, 0xC88A, 0xE0AC, 0xE8AC, 0xE0AE, 0xE0AE, 0xE0B0,
-    0xE0B0, 0x988B, 0x0000, 0x0000, 0xB0D1, 0x78D1, 0x0000, 0x88D1,
-    0x78F1, 0x0000, 0x1842, 0x6911, 0x4931, 0x4951, 0x210B, 0x0000,
-    0x3191, 0x2212, 0x2991, 0x2212, 0x21F2, 0x0000, 0x2212, 0x3191,
-    0x2212, 0x21F2, 0x190B, 0x0000, 0x210B, 0x3191, 0x190B, 0x0000,
-    0x5131, 0x1842, 0x0000, 0x0000, 0x78F1, 0x90D1, 0x90F1, 0xB0D1,
-    0xB0B1, 0xC8B1, 0x988B, 0x0000, 0x5884, 0xE8AE, 0xE8AE, 0x5084,
-    0x0000, 0xC88E, 0xE8AA, 0xE0AA, 0xE8C8, 0xE0E7, 0xE0E7, 0xE145,
-    0xE965, 0xE9C5, 0xC165, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0xF725, 0xFE65, 0xF685, 0xFD65, 0xFD85,
-    0xF465, 0xFC85, 0xEA65, 0xF285, 0xE9C5, 0xC985, 0x588B, 0xE106,
-    0xE8AA, 0x0000, 0x0000, 0xC8AE, 0xE0AA, 0xE0AC, 0xE0AC, 0xE8AE,
-    0xE0AE, 0xE8B0, 0x1842, 0x0000, 0x0000, 0x78D1, 0xB0D1, 0x0000,
-    0x0000, 0x90D1, 0x78F1, 0x0000, 0x6111, 0x6911, 0x4951, 0x0000,
-    0x0000, 0x4931, 0x3191, 0x2991, 0x3191, 0x21F2, 0x0000, 0x210B,
-    0x2991, 0x2212, 0x3191, 0x2042, 0x0A0E, 0x4931, 0x210B, 0x0000,
-    0x4951, 0x4931, 0x0000, 0x0000, 0x0000, 0x88D1, 0xB0D1, 0xA8B1,
-    0xB0D1, 0xC8B1, 0xC8B1, 0xE0B0, 0x0000, 0x0000, 0xC88E, 0xE8AE,
-    0x988B, 0x0000, 0xE0AC, 0xE0AA, 0xE8C8, 0xE108, 0xE0E7, 0xE106,
-    0xE145, 0xE9C5, 0xE9C5, 0xEA85, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x9AA3, 0xFE65, 0xFE65, 0xFD65, 0xFD85,
-    0xF465, 0xFC85, 0xF365, 0xF365, 0xF265, 0xEA85, 0xE145, 0xD127,
-    0xE906, 0xE108, 0x0000, 0x0000, 0xE0AA, 0xE0AA, 0xE0AA, 0xE8AC,
-    0xC8AE, 0x1842, 0xE8AE, 0x588B, 0x0000, 0x0000, 0x0000, 0xC8B1,
-    0x90D1, 0x0000, 0x0000, 0x90D1, 0x78F1, 0x78F1, 0x6111, 0x4931,
-    0x0000, 0x0000, 0x3191, 0x4931, 0x3191, 0x2991, 0x3191, 0x0000,
-    0x0000, 0x3191, 0x3191, 0x2991, 0x3191, 0x4951, 0x210B, 0x0000,
-    0x0000, 0x6111, 0x1842, 0x0000, 0x0000, 0x0000, 0x90D1, 0x90F1,
-    0x2042, 0xD0B1, 0xC8B1, 0xE0B0, 0xE0B0, 0xA8D1, 0x0000, 0xE8AE,
-    0xE0AC, 0xC88E, 0xC8AE, 0xE8AA, 0xE0A8, 0xE8C8, 0xE0A8, 0xE0E7,
-    0xE106, 0xE965, 0xE165, 0xF285, 0xEA65, 0x90C4, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x9AA3, 0xF725, 0xFE65, 0xFE85,
-    0xFD65, 0xF585, 0xFC65, 0xFC85, 0xF365, 0xCA84, 0xE1A6, 0xE9C5,
-    0xE165, 0xE108, 0xE906, 0x5884, 0x986B, 0xE0AA, 0xE0AA, 0xE8AC,
-    0xE0AC, 0xE0AE, 0xE8AE, 0xE0B0, 0xC8B1, 0xB0D1, 0xC8B1, 0xA8B1,
-    0xD0B1, 0xC8B1, 0x608B, 0x0000, 0x0000, 0x78F1, 0x78D1, 0x78F1,
-    0x608B, 0x0000, 0x0000, 0x5151, 0x4931, 0x4951, 0x4931, 0x4951,
-    0x0000, 0x0000, 0x3191, 0x5131, 0x4951, 0x4931, 0x0000, 0x0000,
-    0x0000, 0x6111, 0x6111, 0x608B, 0x588B, 0x608B, 0x608B, 0xA8B1,
-    0xB0D1, 0xC8B1, 0xC8B1, 0xE0B0, 0xE0B0, 0xE0B0, 0xE0B0, 0x986B,
-    0xE0AE, 0xE8AE, 0xC8AE, 0xE0AC, 0xE0AA, 0xE8AC, 0xE0C8, 0xE0E7,
-    0xE106, 0xE145, 0xE165, 0xE9C5, 0xE9C5, 0xFB65, 0x5884, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3222, 0xFE85, 0xF725,
-    0xFE65, 0xFE65, 0xFC65, 0xF465, 0xF365, 0xF365, 0x5884, 0x0000,
-    0xE9C5, 0xE9C5, 0xE145, 0xE106, 0xE8E7, 0xE108, 0xE0C8, 0xE0AA,
-    0xC88A, 0x0000, 0xE0AC, 0xE8AE, 0xC8AE, 0xC8AE, 0x986B, 0xC8AE,
-    0xB0B1, 0xC8B1, 0xC8B1, 0xD0B1, 0xA8D1, 0x608B, 0x0000, 0x90D1,
-    0x78F1, 0x1842, 0x0000, 0x0000, 0x6111, 0x6111, 0x4931, 0x4931,
-    0x5151, 0x0000, 0x0000, 0x0000, 0x4931, 0x6911, 0x190B, 0x0000,
-    0x4951, 0x6911, 0x6111, 0x78F1, 0x78D1, 0x90D1, 0x78F1, 0x90D1,
-    0xB0D1, 0xC8B1, 0xC8B1, 0x1842, 0x0000, 0xE8B0, 0xE8AE, 0xE0B0,
-    0xE0AE, 0xE0AE, 0xE0AC, 0xE8AC, 0xE0AA, 0x988B, 0x0000, 0xE8AA,
-    0xE0E7, 0xE106, 0xE165, 0xE9C5, 0xE9C5, 0xF285, 0xEA65, 0x1842,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF725,
-    0xFE65, 0xF725, 0xF685, 0xFD65, 0xFC85, 0xF485, 0xC165, 0xCA64,
-    0xF285, 0xEA85, 0xE9C5, 0xE9C5, 0xE106, 0xE906, 0xE0E7, 0xE0E7,
-    0xE0C8, 0xC88A, 0xE8AC, 0xE0AC, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0xB0D1, 0xE0B0, 0xA8B1, 0xD0B1, 0xA8D1, 0xB0D1,
-    0x90D1, 0x90D1, 0x0000, 0x0000, 0x0000, 0x78F1, 0x6111, 0x6111,
-    0x6111, 0x6911, 0x0000, 0x0000, 0x0000, 0x6111, 0x6111, 0x6111,
-    0x6911, 0x78F1, 0x4931, 0x78D1, 0x78F1, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x588B, 0xD0B1, 0x988B, 0x1842, 0xE0B0, 0xE0B0,
-    0xE0AE, 0xE8AE, 0xE0AC, 0xE0AC, 0xE0AA, 0xE108, 0xE8AA, 0xC88A,
-    0x90E4, 0xE106, 0xE145, 0xE9C5, 0xE9C5, 0xEA65, 0xF285, 0xFB65,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0xFE65, 0xF725, 0xFE65, 0xFE65, 0xFD65, 0xFD65, 0xF485, 0xF365,
-    0xF265, 0xF365, 0xE9C5, 0xE9C5, 0xE145, 0xE165, 0xE106, 0xE108,
-    0xE0C8, 0xE8AA, 0xE0A8, 0xC8AE, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0xE0B0, 0xC8B1, 0x0000, 0x0000, 0x5884,
-    0xA8B1, 0xB0D1, 0x78D1, 0x0000, 0x0000, 0x0000, 0x78F1, 0x78D1,
-    0x78F1, 0x78D1, 0x6111, 0x0000, 0x0000, 0x0000, 0x4931, 0x78F1,
-    0x6111, 0x190B, 0x0000, 0x0000, 0x78F1, 0x90D1, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA08B, 0xE8AE, 0xE0B0,
-    0xC8B1, 0xE8AE, 0xE0AC, 0xE0AC, 0xE0AA, 0xE8AA, 0xE0A8, 0xE0C8,
-    0xE0A8, 0xD127, 0xE906, 0xE165, 0xE165, 0xE9C5, 0xE9C5, 0xF285,
-    0xEA65, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0xF725, 0xF725, 0xF725, 0xFE65, 0xFE65, 0xFD85, 0xF565,
-    0xFC85, 0xFC65, 0xF365, 0xEA85, 0xD127, 0xE9C5, 0xE965, 0xE165,
-    0xE106, 0xE108, 0xE0AA, 0xE8C8, 0xE8AA, 0xC88A, 0x5084, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0xE0B0, 0xE0B0, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x90D1, 0x78F1, 0x0000, 0x0000, 0x0000, 0x90F1,
-    0x90D1, 0x88F1, 0x90D1, 0x78D1, 0x0000, 0x0000, 0x0000, 0x6111,
-    0x78F1, 0x0000, 0x0000, 0x0000, 0x0000, 0xB0B1, 0xB0D1, 0x1842,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x588B, 0xE0B0, 0xE0B0, 0xE0B0,
-    0xE8AE, 0xC88E, 0xE0AC, 0xE0AC, 0xE8AA, 0xE0AC, 0xE0AA, 0xE0AA,
-    0xE8C8, 0xE108, 0xE106, 0xE165, 0xE145, 0xE9C5, 0xE9C5, 0xEA65,
-    0xF285, 0xF365, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0xCD65, 0xF725, 0xFE85, 0xFE65, 0xFD65, 0xFD65,
-    0xF485, 0xFC65, 0xF365, 0xF365, 0xF285, 0x0000, 0xD127, 0xE9C5,
-    0xE145, 0xE106, 0xE0E7, 0xE108, 0x0000, 0xE8AA, 0xE0AA, 0xE0AA,
-    0xE0AC, 0xE8AE, 0xE0AC, 0xE0AE, 0xE0AE, 0xE0B0, 0xA8D1, 0x0000,
-    0x0000, 0x0000, 0xA06B, 0xC8B1, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x90D1, 0xA8D1, 0x90D1, 0x90F1, 0x78F1, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x88D1, 0x608B, 0x0000, 0x0000, 0x0000, 0x90D1, 0xC8B1,
-    0xB0D1, 0xC8B1, 0xC8B1, 0xE0B0, 0xC8B1, 0xE8B0, 0xE0AE, 0xE0B0,
-    0x0000, 0xC8AE, 0xE8AC, 0xE0AC, 0xE0AC, 0xE0AC, 0xE8AA, 0x0000,
-    0xC88A, 0xE0E7, 0xE0E7, 0xE106, 0xE965, 0xE9C5, 0xE9C5, 0xEA85,
-    0xEA85, 0xF365, 0xC165, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0xCD65, 0xF725, 0xF725, 0xFE65, 0xFE85,
-    0xFD65, 0xF585, 0xFC65, 0xFC85, 0xF365, 0xF365, 0xEA65, 0xF285,
-    0xE9C5, 0xE9C5, 0xE165, 0xE906, 0x1842, 0x0000, 0x0000, 0x0000,
-    0x988B, 0xE8AC, 0xC88E, 0xE0AE, 0xE0AE, 0xE8AE, 0xE0AE, 0xD0B1,
-    0x0000, 0x0000, 0x588B, 0xE0B0, 0xD0B1, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0xA8D1, 0xB0B1, 0xA8D1, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x90D1, 0xB0D1, 0x1842, 0x0000, 0x0000, 0xB0B1,
-    0xA8D1, 0xE0B0, 0xC8B1, 0xE0B0, 0xB0B1, 0xB0D1, 0x1842, 0x0000,
-    0x0000, 0x0000, 0x0000, 0xE0AE, 0xE0AC, 0xE0AC, 0xE8AA, 0xE0AA,
-    0xE0C8, 0xE108, 0xE0E7, 0xE106, 0xE145, 0xE9C5, 0xE9C5, 0xF265,
-    0xEA85, 0xFB65, 0xFB65, 0x62A3, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x9AA3, 0xF725, 0xFF25, 0xF725,
-    0xFE85, 0xFE65, 0xFD65, 0xF565, 0xFC85, 0xF465, 0xF365, 0xFB65,
-    0xEA85, 0xF265, 0xE145, 0xE165, 0xE0A8, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xC8AE, 0xC88E, 0xE8AE,
-    0xC8AE, 0x0000, 0x986B, 0xE8B0, 0xE0B0, 0x988B, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x588B, 0x90D1, 0x608B, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x988B, 0xB0B1, 0xC8B1, 0x1842, 0x0000,
-    0xD0B1, 0xD0B1, 0xC8B1, 0x988B, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0xA06B, 0xE0AC, 0xE8AA, 0xE0AA,
-    0xE0C8, 0xE0E7, 0xE8E7, 0xE106, 0xE106, 0xE165, 0xE965, 0xE9C5,
-    0xEA85, 0xF365, 0xF365, 0xFC65, 0x5084, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3222, 0xF725, 0xF725,
-    0xF725, 0xF725, 0xFE65, 0xFE85, 0xF465, 0xFC85, 0xF465, 0xFC85,
-    0xF265, 0xF365, 0xF285, 0xE9C5, 0xE965, 0x1842, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xC88E, 0xC8AE, 0x986B,
-    0xE0AC, 0xE8AE, 0xC8AE, 0xE0B0, 0xE0AE, 0xE8B0, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xC8B1, 0xC8B1, 0xE0B0,
-    0xA8B1, 0xE0B0, 0xE0B0, 0xC8B1, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE8AA, 0xE0AA,
-    0xE0C8, 0xE108, 0xE0E7, 0xE926, 0xE106, 0xE145, 0xE1A6, 0xE9C5,
-    0xF285, 0xF365, 0xF365, 0xFC65, 0xFC85, 0x5884, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFF25,
-    0xF725, 0xF725, 0xFE65, 0xFE65, 0xCB84, 0x0000, 0x0000, 0xFC65,
-    0xEA85, 0x0000, 0x0000, 0xD127, 0xE9C5, 0xE9C5, 0xE0E8, 0xE165,
-    0xE108, 0xE108, 0x986B, 0x608B, 0x0000, 0x0000, 0xC88A, 0xE8AC,
-    0xE0AC, 0xE0AC, 0xE0AC, 0xE8AE, 0xE0AE, 0xE0AE, 0xC8AE, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x988B, 0xD0B1,
-    0xE0B0, 0xE0B0, 0xE0B0, 0xE0B0, 0xC8B1, 0x588B, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x1842, 0xA06B, 0xD0AE, 0xE8AC, 0xC88E, 0xE0AA,
-    0xE0C8, 0xE8AA, 0x5084, 0x0000, 0x90C4, 0xE965, 0x90C4, 0x0000,
-    0xD927, 0xF285, 0xEA85, 0xF365, 0xFB65, 0xF465, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0xD686, 0xF725, 0xF725, 0xF725, 0xFE65, 0x0000, 0x0000, 0x0000,
-    0xFC85, 0xFC85, 0x5064, 0xEA85, 0xF265, 0xEA85, 0xE9C5, 0xE9C5,
-    0xE165, 0xE965, 0xE106, 0xE106, 0xE0E7, 0xE108, 0xE8C8, 0xE0AA,
-    0xE0AA, 0xE108, 0xE0AC, 0xE8AC, 0xE0AC, 0xE0AE, 0xE8AE, 0xC8B1,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xB0B1,
-    0x588B, 0xE0B0, 0xE0B0, 0xE0B0, 0xE0B0, 0xE0B0, 0xE0AE, 0xE0B0,
-    0xE0AE, 0xE8AE, 0xE0AC, 0xE0AC, 0xE0AC, 0xE108, 0xE8AA, 0xE0AA,
-    0xE0C8, 0xE108, 0xE0C8, 0xC88A, 0x0000, 0xE108, 0xE145, 0xC0C6,
-    0x0000, 0x0000, 0xE9C5, 0xFB65, 0xF365, 0xF465, 0xFC85, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0xCE66, 0xCF26, 0xFF25, 0xF725, 0xFD65, 0x0000, 0x0000,
-    0x0000, 0xF365, 0xFC85, 0xF465, 0xF365, 0xFB65, 0xEA85, 0xF265,
-    0xE9C5, 0xE9C5, 0xE145, 0xE165, 0xE106, 0xE106, 0xE0C8, 0xE8C8,
-    0xE0A8, 0xE0AA, 0xE0C8, 0xE8AA, 0xE0AA, 0xE0AC, 0x986B, 0xE8AE,
-    0x5084, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0xA08B, 0xC8B1, 0x0000, 0xE0B0, 0xE8AE, 0xE0AE, 0xE0AE, 0xE0AE,
-    0xE8AC, 0xE0AE, 0xE0AC, 0xE0AC, 0xE8AA, 0xE0AA, 0xE0A8, 0xE0AA,
-    0xE8C8, 0xE0E7, 0xE0A8, 0xE0E7, 0xE906, 0xE165, 0xE165, 0xE1A6,
-    0x0000, 0x0000, 0x0000, 0x5884, 0xFB65, 0xF485, 0xFC85, 0xF365,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x9CE5, 0xF725, 0xF725, 0xFF25, 0xCC84, 0x0000,
-    0x0000, 0x0000, 0x90C4, 0xF585, 0xFC65, 0xFC85, 0xF365, 0xFB65,
-    0x988B, 0x90C4, 0xE9C5, 0xE9C5, 0xE165, 0xE165, 0xE106, 0xE906,
-    0xE0E7, 0xE108, 0xE0C8, 0xE0AA, 0xE8AA, 0xE0AC, 0xC88E, 0xE0AC,
-    0xE8AC, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0xE8AE, 0x988B, 0x986B, 0xE0AE, 0xE0AE, 0xE8AE,
-    0xE0AC, 0xE0AE, 0xE0AC, 0xE8AC, 0xE0AA, 0xE0AC, 0xE0AA, 0xE8AA,
-    0xE0C8, 0xE108, 0xE0AA, 0xE126, 0xE906, 0xE145, 0xE145, 0xE9C5,
-    0xD127, 0x0000, 0x0000, 0x0000, 0x0000, 0xF485, 0xFC65, 0xFD85,
-    0x9AA3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x3222, 0xD746, 0xF725, 0xD726, 0xCC64,
-    0x0000, 0x0000, 0x0000, 0xFC65, 0xF585, 0xFD65, 0xFC85, 0x9AA3,
-    0x0000, 0x0000, 0xD127, 0xF285, 0xE9C5, 0xE1C5, 0xE145, 0xE145,
-    0xE108, 0xE906, 0xE0E7, 0xE0E7, 0xE0AA, 0xE8C8, 0xE0C8, 0x0000,
-    0xE0AA, 0xE0AC, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0xE8AE, 0xC88E, 0x0000, 0xE0AC, 0xE0AC,
-    0xE8AC, 0xE0AC, 0xE0AA, 0xE0AC, 0xE8AC, 0xE0AA, 0xE0C8, 0xE0A8,
-    0xE8C8, 0xE0E7, 0xE0A8, 0x0000, 0x0000, 0xC0C6, 0xE165, 0xE9C5,
-    0xE9C5, 0xF285, 0x0000, 0x0000, 0x0000, 0x5064, 0xFC85, 0xFD85,
-    0xFD65, 0x1842, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCF26, 0xCF46, 0xF725,
-    0xCB84, 0x0000, 0x0000, 0x0000, 0xFD65, 0xFE65, 0xFD85, 0xFC85,
-    0x0000, 0x0000, 0xC165, 0xF365, 0xF265, 0xF285, 0x90E4, 0x986B,
-    0xE165, 0xE165, 0xE906, 0xE108, 0x0000, 0xD127, 0xE8C8, 0xE108,
-    0xC88A, 0xE8AA, 0x1842, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x5084, 0xE8AE, 0x5884, 0xC88E,
-    0xE0AC, 0xE8AC, 0x1842, 0xE0AC, 0xE0AA, 0xE8AA, 0xE0C8, 0xE0AC,
-    0xC0C6, 0xE108, 0xE0E7, 0xE106, 0xC0C6, 0x0000, 0x0000, 0xD127,
-    0xE9C5, 0xF265, 0xF285, 0x0000, 0x0000, 0x0000, 0x5084, 0xFD65,
-    0xFD65, 0xFE85, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCD65, 0xCF26,
-    0xD726, 0xCC64, 0x0000, 0x0000, 0x0000, 0xFD85, 0xFD65, 0xF585,
-    0xFC65, 0xCA64, 0xC165, 0xFC85, 0xF365, 0xF365, 0xC165, 0x0000,
-    0xE1A6, 0xE9C5, 0xE165, 0x90E4, 0x0000, 0xC0C6, 0xE8E7, 0xE0E7,
-    0xE8A8, 0xE0C8, 0xE0A8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE0AC, 0xE8AC,
-    0xE0AA, 0xE0AA, 0xE0AA, 0x988B, 0x0000, 0xA06B, 0xE0C8, 0xE8A8,
-    0xC88A, 0x0000, 0xC8AA, 0xE106, 0xE126, 0xE165, 0x1842, 0x98C4,
-    0xE9A6, 0xF285, 0xEA85, 0xF365, 0x0000, 0x0000, 0x0000, 0x9AA3,
-    0xFC85, 0xFE85, 0xF465, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD565,
-    0xA6C7, 0xCD85, 0xCC84, 0x9AA3, 0x0000, 0x0000, 0x1822, 0xFE65,
-    0xFE85, 0xF565, 0xFC85, 0xFD65, 0xFC85, 0xFC85, 0x90C4, 0x0000,
-    0x5084, 0xF285, 0xE9C5, 0x0000, 0x0000, 0xE108, 0xE145, 0xE165,
-    0xE108, 0xC0C6, 0xE0C8, 0xC0C6, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xC88A,
-    0xE8AA, 0xE0AC, 0xE0AA, 0xE0AA, 0xE8C8, 0xC88A, 0x0000, 0x0000,
-    0xE0E7, 0xE906, 0x1842, 0x0000, 0x988B, 0xE9C5, 0xE1A6, 0xE9C5,
-    0xE1A6, 0xCA64, 0xF285, 0xF365, 0xE1A6, 0x0000, 0x0000, 0x0000,
-    0xCB84, 0xFD65, 0xFE85, 0xCC64, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x62A3, 0xD726, 0xCE86, 0x62A3, 0xD565, 0x0000, 0x0000, 0x0000,
-    0xCC64, 0xFE85, 0xFD65, 0xFD65, 0xFD85, 0xF465, 0xCA64, 0xF285,
-    0xF365, 0xF365, 0xF265, 0xEA85, 0xC165, 0xE9C5, 0xE1A6, 0xE165,
-    0x90C4, 0x0000, 0xE108, 0xE906, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0xE0AA, 0xE8C8, 0x0000, 0x90E4, 0xE0E7, 0xE8A8, 0xE108,
-    0x0000, 0xE106, 0xE126, 0xE165, 0xE108, 0x0000, 0x588B, 0xE9C5,
-    0xE9C5, 0xF285, 0xF265, 0xF365, 0xF365, 0x0000, 0x0000, 0x0000,
-    0xCA64, 0xCB84, 0xCD85, 0xFE65, 0x5064, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0xA6C7, 0xD726, 0x62A3, 0x9CE5, 0xF665, 0xFD65,
-    0x0000, 0xFE65, 0xFE65, 0xF665, 0xFE65, 0xFE85, 0xFD65, 0xF585,
-    0xFC65, 0xFC85, 0xF365, 0x0000, 0xEA85, 0xF365, 0xF285, 0xE1A6,
-    0x0000, 0x0000, 0xE945, 0xE965, 0x90C4, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x5084, 0xE8E7, 0xE0C8, 0x0000, 0x0000, 0xE108,
-    0xE106, 0xE165, 0xE906, 0x5084, 0xE108, 0xE9C5, 0xE9C5, 0xEA65,
-    0xE9C5, 0xF365, 0xF285, 0xF365, 0xFB65, 0xFC85, 0x0000, 0x5084,
-    0xCA64, 0xFB65, 0x5864, 0xFE65, 0xFE85, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0xCD65, 0xA6C7, 0xA6A7, 0x0000, 0xD464,
-    0xCE86, 0xFF25, 0xF725, 0x62A3, 0x0000, 0x9AA3, 0x0000, 0xFC85,
-    0xFD65, 0xFD85, 0xCB84, 0x0000, 0x0000, 0xF265, 0xEA85, 0x5064,
-    0x0000, 0x5884, 0xE9C5, 0xE9C5, 0xD127, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0xC0C6, 0xE108, 0xE8E7, 0x1842,
-    0x0000, 0x5884, 0xE108, 0xE965, 0x0000, 0x0000, 0xD127, 0xF285,
-    0xEA65, 0xF285, 0x90C4, 0x90C4, 0x0000, 0x5884, 0xFC85, 0xFD85,
-    0xCB84, 0xCA64, 0x0000, 0x9AA3, 0xFE85, 0xFD65, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0xCB64, 0xA6C7, 0xA6C7, 0x0000,
-    0x0000, 0x9CE5, 0xF725, 0x9CE5, 0x0000, 0x0000, 0x0000, 0x0000,
-    0xFD65, 0xFE65, 0xF585, 0x0000, 0x0000, 0xFC65, 0xFB65, 0x0000,
-    0x0000, 0x1842, 0xEA85, 0xF285, 0xE9C5, 0xE1C6, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE108, 0xE108, 0xD127,
-    0xE906, 0x5084, 0x0000, 0x0000, 0xE1A6, 0xE9C5, 0x0000, 0x0000,
-    0xF285, 0xF365, 0xFB65, 0x0000, 0x0000, 0x0000, 0x0000, 0x9AA3,
-    0xF565, 0xFC85, 0x0000, 0x0000, 0xCC64, 0xF725, 0xCB84, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8667, 0xA6C7,
-    0x0000, 0xD686, 0xD726, 0x9AA3, 0x0000, 0x0000, 0x0000, 0x0000,
-    0xFC65, 0xFE85, 0xF565, 0xCA64, 0x0000, 0xFD65, 0xF365, 0x0000,
-    0x0000, 0x0000, 0xF285, 0xF365, 0xF265, 0xEA85, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1842, 0xE945,
-    0xE145, 0xD127, 0xE965, 0x5084, 0x0000, 0x0000, 0xE9A6, 0xF285,
-    0x0000, 0x90C4, 0xF365, 0xF365, 0xF285, 0x0000, 0x0000, 0x0000,
-    0x0000, 0xCB84, 0xFD85, 0xF465, 0x0000, 0xFE85, 0xF725, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8667,
-    0x8667, 0xA6A7, 0xA6C7, 0xD686, 0x6AA3, 0x0000, 0x0000, 0x0000,
-    0x1822, 0xF725, 0xFE65, 0xFE85, 0x90C4, 0xF665, 0xFC85, 0x0000,
-    0x0000, 0x0000, 0xF365, 0xFC85, 0xF365, 0xFB65, 0xE1A6, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0xD127, 0xEA65, 0xE9C5, 0xF285, 0xE1A6, 0x0000, 0x0000, 0x0000,
-    0xEA85, 0xF365, 0x0000, 0xFC65, 0xF485, 0xFD65, 0xC165, 0x0000,
-    0x0000, 0x0000, 0x0000, 0xFE65, 0xFE65, 0xFE65, 0xF725, 0xFE65,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x64A6, 0x8667, 0x8667, 0x9CE5, 0xAEC7, 0xD726, 0xCE66, 0xCD65,
-    0xFC85, 0xF725, 0xFE65, 0x0000, 0xFE65, 0xFE65, 0xCC64, 0x0000,
-    0x0000, 0x0000, 0xEA85, 0xFC65, 0xF485, 0xFC65, 0xF365, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0xE1A6, 0xF285, 0xEA85, 0xF265, 0xE1A6, 0x0000,
-    0x0000, 0x0000, 0xF285, 0xF485, 0xFC65, 0xCA64, 0xCB84, 0xF585,
-    0xCB84, 0xCB84, 0xCB84, 0xFE65, 0xFE65, 0x5064, 0xFE85, 0xF725,
-    0x9AA3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x6E08, 0x8667, 0x9CE5, 0xA6C7, 0xCD65, 0xCE86,
-    0xCB84, 0xFF25, 0xF725, 0x0000, 0x62A3, 0xF725, 0xF725, 0xFE65,
-    0xFD85, 0xFD65, 0xF585, 0xFD65, 0xFD85, 0xFD65, 0xF485, 0xCA64,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0xE1A6, 0xF285, 0xF365, 0xFB65, 0xF365,
-    0xEA65, 0xFB65, 0xF365, 0xF365, 0xF485, 0xFD65, 0xFC85, 0x0000,
-    0xF565, 0xFE85, 0x9AA3, 0xFD65, 0xFE65, 0xFF25, 0xCD65, 0xF725,
-    0xD746, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x6E28, 0x6E08, 0x0000, 0x9CE5, 0x62A3,
-    0x9CE5, 0xD726, 0xD726, 0x9AA3, 0x0000, 0xF725, 0xF725, 0xFF25,
-    0xF725, 0xFE85, 0xFE65, 0xFE65, 0xF565, 0xFE65, 0xFD65, 0xF485,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF365, 0xFB65, 0xF465,
-    0xF365, 0xFC85, 0xFC65, 0xF485, 0xFC65, 0xF585, 0xFD65, 0xFE85,
-    0x0000, 0x62A3, 0xFE65, 0xFE65, 0xCC64, 0x9AA3, 0xCB84, 0x3242,
-    0xCF26, 0xD686, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x6AA3, 0x6E08, 0x8667, 0x8667,
-    0x8667, 0xA6C7, 0xA6A7, 0xCE86, 0x0000, 0xF725, 0xCF26, 0xFD85,
-    0xCC64, 0xFD85, 0xCC64, 0xF725, 0xFE65, 0xF725, 0xFE65, 0xFE85,
-    0x5884, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x90C4, 0xF465,
-    0xFC85, 0xFD65, 0xF485, 0xFD65, 0xF365, 0xCB84, 0xFC85, 0xCC64,
-    0xF665, 0xFD65, 0x0000, 0xFE85, 0xFF25, 0xF725, 0xCB64, 0xFE65,
-    0xCF46, 0xFF25, 0x5064, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4DA8, 0x6E28,
-    0x6E08, 0x8667, 0x8667, 0x3222, 0x9CE5, 0xD686, 0xA6C7, 0xD666,
-    0xCD65, 0xCD85, 0xD726, 0xF725, 0xF725, 0xFF25, 0xFE65, 0xFE65,
-    0xCB84, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0xCB84, 0xF565, 0xFC85, 0xFD65, 0xF585, 0xFE65, 0xFD65, 0xF365,
-    0xCB84, 0xFE85, 0xFE65, 0xCC64, 0xCD65, 0xCB84, 0xCE86, 0xF725,
-    0xCF26, 0xD726, 0xCE86, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x34C8,
-    0x2D49, 0x6E28, 0x9CE5, 0x9CE5, 0x6AA3, 0xA6A7, 0xA6C7, 0x9CE5,
-    0x9AA3, 0xCF26, 0xD746, 0xF725, 0xF725, 0xF725, 0xF725, 0xF725,
-    0xFD65, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0xFC65, 0xF685, 0xFD65, 0xFE65, 0xFE65, 0xFE65,
-    0xFE65, 0xF725, 0xFC85, 0x62A3, 0xF725, 0xFF25, 0xCB84, 0x9AA3,
-    0xCD65, 0xCF26, 0xD726, 0x62A3, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x55A8, 0x2D49, 0x0000, 0xA4E5, 0x8667, 0x6628, 0xAEC7,
-    0x9CE5, 0xA6A7, 0xA6C7, 0xD726, 0xCF26, 0xFF25, 0xCF26, 0xF725,
-    0xFE65, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0xFD65, 0xFE65, 0xFE65, 0xF725,
-    0xFE65, 0xF725, 0xF725, 0xF725, 0x9AA3, 0xFE85, 0xCF26, 0xCD65,
-    0xCB84, 0x9CE5, 0xA6C7, 0xAEA7, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x2042, 0x2D49, 0x4DA8, 0x8667, 0x6E08, 0x8667,
-    0x9CE5, 0xA6C7, 0xAEA7, 0xA6C7, 0xA6A7, 0xCF26, 0xCF26, 0xCF26,
-    0xCF26, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFE65, 0xFF25,
-    0xF725, 0xF725, 0xF725, 0xFF25, 0xF725, 0xF725, 0xD686, 0xCF26,
-    0xCF26, 0xD726, 0xA6A7, 0xA6C7, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x6CA6, 0x2D69, 0x2D49, 0x4DA8,
-    0x55A8, 0x6E28, 0x6E28, 0x8667, 0x8667, 0xA6A7, 0xA6C7, 0xA6A7,
-    0xAEC7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0xFC65, 0xF725, 0xCF26, 0xF725, 0xD726, 0xF725, 0xCF26, 0xCF26,
-    0xD686, 0xCF26, 0xA6A7, 0xA6C7, 0x9AA3, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x55A8, 0x2D49,
-    0x2D49, 0x4DA8, 0x4DA8, 0x6E28, 0x6E08, 0x8667, 0x8667, 0xA6C7,
-    0xCD85, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0xCB64, 0xF725, 0xCF26, 0xF725, 0xD726, 0xCF26,
-    0xA6C7, 0xD726, 0xA6A7, 0xAEC7, 0x9CE5, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x6CA6, 0x2D69, 0x2D49, 0x55A8, 0x4DA8, 0x6E28, 0x55A8, 0x8667,
-    0x6AA3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x62A3, 0xD726, 0xA6C7, 0xCF26,
-    0xA6A7, 0xA6C7, 0x8667, 0x8667, 0x6CA6, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x3A22, 0x4DA8, 0x4DA8, 0x6E08, 0x6E28, 0x64A6,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9CE5,
-    0xD565, 0xA6C7, 0xA6A7, 0xAEC7, 0x3222, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000 },
-  { 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x34C8, 0x04EA, 0x04EA,
-    0x04EA, 0x34C8, 0x3A42, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3A22, 0x34C8,
-    0x04EA, 0x152A, 0x04EA, 0x34C8, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3CC8, 0x04EA, 0x04EA,
-    0x04EA, 0x04EA, 0x04EA, 0x152A, 0x150A, 0x34C8, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3CC8, 0x3CC8, 0x152A,
-    0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x2D49, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x04EA, 0x04EA, 0x04EA,
-    0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA,
-    0x150A, 0x3242, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x3A22, 0x34C8, 0x04EA, 0x04EA, 0x04EA,
-    0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x150A, 0x04EA, 0x04EA,
-    0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA,
-    0x04EA, 0x04EA, 0x04EA, 0x152A, 0x34C8, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x6CA6, 0x150A, 0x04EA, 0x04EA, 0x04EA, 0x04EA,
-    0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA,
-    0x04EA, 0x152A, 0x0000, 0x0000, 0x0000, 0x04EA, 0x04EA, 0x04EA,
-    0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA,
-    0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x3CC8,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x4DA8, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA,
-    0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA,
-    0x04EA, 0x04EA, 0x04EA, 0x3A42, 0x0000, 0x0000, 0x04EA, 0x04EA,
-    0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA,
-    0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA,
-    0x04EA, 0x04EA, 0x34C8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x6CA6, 0x2D49, 0x152A, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA,
-    0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA,
-    0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x150A, 0x0000, 0x09EE, 0x04EA,
-    0x04EA, 0x04EA, 0x04EA, 0x0000, 0x152A, 0x04EA, 0x04EA, 0x04EA,
-    0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA,
-    0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x55A8, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9CE5,
-    0x55A8, 0x4DA8, 0x2D69, 0x150A, 0x152A, 0x04EA, 0x04EA, 0x04EA,
-    0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA,
-    0x04EA, 0x3CC8, 0x0000, 0x04EA, 0x04EA, 0x150A, 0x1842, 0x3CC8,
-    0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x150A, 0x2D69, 0x150A, 0x04EA,
-    0x04EA, 0x34C8, 0x3A42, 0x04EA, 0x34C8, 0x2D49, 0x04EA, 0x04EA,
-    0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x152A,
-    0x64A6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD565, 0x8667,
-    0x6E08, 0x6E28, 0x4DA8, 0x55A8, 0x2D69, 0x2D49, 0x152A, 0x150A,
-    0x04EA, 0x04EA, 0x152A, 0x2D49, 0x04EA, 0x6CA6, 0x04EA, 0x04EA,
-    0x04EA, 0x152A, 0x3CC8, 0x34C8, 0x04EA, 0x04EA, 0x04EA, 0x3CC8,
-    0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x0000,
-    0x04EA, 0x04EA, 0x152A, 0x0000, 0x150A, 0x2D69, 0x0000, 0x2D49,
-    0x04EA, 0x04EA, 0x04EA, 0x152A, 0x04EA, 0x04EA, 0x04EA, 0x04EA,
-    0x150A, 0x2D69, 0x3549, 0xA4E5, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCC84, 0xA6C7, 0xA6A7,
-    0xA6C7, 0xAEA7, 0x6628, 0x6E08, 0x4DA8, 0x55A8, 0x2D49, 0x2D69,
-    0x150A, 0x152A, 0x6AA3, 0x0000, 0x34C8, 0x55A8, 0x0000, 0x150A,
-    0x04EA, 0x2D69, 0x34C8, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA,
-    0x150A, 0x152A, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x0000, 0x34C8,
-    0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x0000, 0x3A22, 0x152A, 0x0000,
-    0x0000, 0x150A, 0x04EA, 0x152A, 0x6CA6, 0x150A, 0x04EA, 0x152A,
-    0x150A, 0x2D69, 0x2D49, 0x4DA8, 0x4DA8, 0x8687, 0x9AA3, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0xCB64, 0xF725, 0xD726, 0xCF26,
-    0xCF26, 0xD726, 0xA6C7, 0xAEA7, 0x8667, 0x8667, 0x6E28, 0x6E28,
-    0x2D49, 0x2D69, 0x2D49, 0x0000, 0x6CA6, 0x2D69, 0x0000, 0x2042,
-    0x04EA, 0x04EA, 0x04EA, 0x150A, 0x1842, 0x55A8, 0x04EA, 0x04EA,
-    0x04EA, 0x152A, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x150A,
-    0x0000, 0x34C8, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA,
-    0x3CC8, 0x0000, 0x152A, 0x6CA6, 0x04EA, 0x04EA, 0x6CA6, 0x64A6,
-    0x150A, 0x2D69, 0x2D49, 0x55A8, 0x4DA8, 0x8667, 0x8667, 0xAEC7,
-    0xA6C7, 0x1822, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x5884, 0xFE85, 0xFF25, 0xFF25, 0xF725,
-    0xCF26, 0xF725, 0xD726, 0xCF26, 0xA6A7, 0xA6C7, 0x9CE5, 0x8667,
-    0x4DA8, 0x6E08, 0x6CA6, 0x6E28, 0x0000, 0x2D49, 0x0D0A, 0x55A8,
-    0x04EA, 0x04EA, 0x04EA, 0x152A, 0x0000, 0x0000, 0x150A, 0x04EA,
-    0x04EA, 0x04EA, 0x04EA, 0x150A, 0x04EA, 0x04EA, 0x04EA, 0x04EA,
-    0x04EA, 0x2D69, 0x34C8, 0x150A, 0x04EA, 0x04EA, 0x04EA, 0x04EA,
-    0x04EA, 0x04EA, 0x6CA6, 0x4DA8, 0x0000, 0x2D69, 0x04EA, 0x150A,
-    0x0000, 0xA4E5, 0x2D49, 0x4DA8, 0x6628, 0x8667, 0x8667, 0xA6A7,
-    0xA6C7, 0xD726, 0xCF26, 0xCC64, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0xF365, 0xFE65, 0xF725, 0xFE65, 0xF725,
-    0xF725, 0xFF25, 0xF725, 0xF725, 0xD726, 0xD746, 0x3242, 0x9AA3,
-    0x8667, 0x8667, 0x64A6, 0x6CA6, 0x6CA6, 0x9CE5, 0x150A, 0x152A,
-    0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x150A, 0x55A8, 0x34C8, 0x04EA,
-    0x04EA, 0x04EA, 0x04EA, 0x152A, 0x04EA, 0x04EA, 0x04EA, 0x04EA,
-    0x04EA, 0x04EA, 0x04EA, 0x152A, 0x04EA, 0x04EA, 0x150A, 0x3CC8,
-    0x34C8, 0x152A, 0x04EA, 0x04EA, 0x04EA, 0x0000, 0x150A, 0x6CA6,
-    0x34C8, 0x2D69, 0x6CA6, 0x6E28, 0x5864, 0x8667, 0x8667, 0xAEC7,
-    0xA6C7, 0xD726, 0xCF26, 0xF725, 0xFF25, 0xFD65, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0xF465, 0xFD85, 0xFD65, 0xFD85, 0xF665,
-    0xFE65, 0xF725, 0xFE65, 0xF725, 0xCE86, 0xCD65, 0xD686, 0xCD65,
-    0xA6C7, 0xA6A7, 0x9CE5, 0xA4E5, 0x5864, 0x4DA8, 0x2D69, 0x2D69,
-    0x34C8, 0x6CA6, 0x6AA3, 0x150A, 0x04EA, 0x2D69, 0x150A, 0x04EA,
-    0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x152A, 0x3CC8, 0x04EA, 0x04EA,
-    0x04EA, 0x04EA, 0x04EA, 0x34C8, 0x3CC8, 0x04EA, 0x04EA, 0x2D49,
-    0x34C8, 0x55A8, 0x04EA, 0x2D69, 0x6CA6, 0x04EA, 0x04EA, 0x0D0A,
-    0x6CA6, 0x0000, 0x55A8, 0x4DA8, 0x6628, 0x9CE5, 0xD585, 0x5864,
-    0xA6A7, 0xCF26, 0xCF26, 0xF725, 0xFF25, 0xF725, 0xF725, 0xF685,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0xFC65, 0xF485, 0xFD65, 0xFD85, 0xFD65,
-    0xF565, 0xFE65, 0xFE85, 0xF465, 0xFC65, 0xFE85, 0x9AA3, 0xFF25,
-    0xCF26, 0xD726, 0x0000, 0xA6A7, 0x8667, 0x8667, 0x6E28, 0x6E28,
-    0x2D49, 0x4DA8, 0x6CA6, 0x6CA6, 0x2D69, 0x04EA, 0x04EA, 0x34C8,
-    0x2D49, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x6CA6, 0x3242, 0x04EA,
-    0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x150A, 0x0000, 0x04EA, 0x04EA,
-    0x0000, 0x0000, 0x0000, 0x3CC8, 0x34C8, 0x0000, 0x3CC8, 0x2D69,
-    0x150A, 0x2D69, 0x0000, 0x0000, 0x55A8, 0x8667, 0x8667, 0xAEC7,
-    0xA6A7, 0xD726, 0xCF26, 0xF725, 0xF725, 0xFF25, 0xFE65, 0xFE65,
-    0xF665, 0xFD65, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0xF365, 0xF365, 0xFC85, 0xF365, 0xFC65,
-    0xF485, 0xFD65, 0xFD85, 0xFE65, 0xF565, 0xFE85, 0xFE65, 0xF725,
-    0xF725, 0xF725, 0x0000, 0x0000, 0xA6A7, 0xA6C7, 0x8667, 0x8667,
-    0x0000, 0x6E08, 0x0000, 0x0000, 0x0000, 0x64A6, 0x04EA, 0x150A,
-    0x0000, 0x152A, 0x04EA, 0x04EA, 0x04EA, 0x150A, 0x1842, 0x0000,
-    0x34C8, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x150A, 0x0000, 0x04EA,
-    0x04EA, 0x3569, 0x2D49, 0x2D69, 0x34C8, 0x2D49, 0x2D69, 0x2D49,
-    0x6AA3, 0x55A8, 0x2D49, 0x6628, 0x0000, 0xA6A7, 0x8667, 0xA6C7,
-    0xA6A7, 0xFE65, 0xCE86, 0xFE65, 0xFE65, 0xFF25, 0xF725, 0xF725,
-    0xF665, 0xFE65, 0xFD85, 0xF465, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0xF285, 0xF265, 0xF365, 0xF365, 0xF365,
-    0xF365, 0xFC85, 0xF465, 0xFC85, 0xF465, 0xFE65, 0xFE65, 0xFE65,
-    0xF725, 0xFF25, 0x0000, 0x0000, 0xCF26, 0xCF26, 0xD585, 0xCD65,
-    0x8667, 0x9CE5, 0x6E08, 0x6E28, 0x6CA6, 0x9CE5, 0x6CA6, 0x04EA,
-    0x2D69, 0x0000, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x3CC8, 0x0000,
-    0x0000, 0x0000, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA,
-    0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x3CC8, 0x6CA6, 0x04EA, 0x152A,
-    0x6CA6, 0x64A6, 0x6CA6, 0x4DA8, 0x4DA8, 0x8667, 0x5864, 0xAEC7,
-    0xA6C7, 0xD726, 0xCC64, 0x0000, 0x0000, 0x0000, 0x0000, 0xFE85,
-    0xFD65, 0xFD65, 0xF485, 0xFC65, 0xF485, 0xF365, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0xD127, 0x90C4, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0xA06B, 0xC88A, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0xE1C6, 0xE9C5, 0xE9C5, 0xE9C5, 0xEA85,
-    0xF285, 0xF365, 0xF265, 0x0000, 0x0000, 0x0000, 0x0000, 0xF365,
-    0xFD85, 0xF665, 0xFD65, 0x0000, 0xFE85, 0xF725, 0xCE66, 0xCC64,
-    0xA6C7, 0xA6C7, 0x8667, 0x6E08, 0x64A6, 0x6E28, 0x2D49, 0x150A,
-    0x04EA, 0x04EA, 0x152A, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x3CC8, 0x04EA, 0x04EA, 0x04EA, 0x04EA,
-    0x04EA, 0x2D69, 0x34C8, 0x55A8, 0x04EA, 0x0D0A, 0x04EA, 0x4DA8,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD565, 0x8667, 0xA6C7,
-    0xA6C7, 0xCD65, 0x0000, 0xFF25, 0xFE85, 0x0000, 0x0000, 0x0000,
-    0x5064, 0xF585, 0xFC65, 0xF485, 0xFC65, 0xFC85, 0xF365, 0xF285,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE1C6, 0xE106, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0xE0C8, 0xE108, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0xE106, 0xE965, 0xE1A6, 0xE145, 0xE1C5,
-    0xE9C5, 0xF265, 0xEA85, 0x0000, 0x0000, 0x0000, 0x0000, 0xFC65,
-    0xFD85, 0x0000, 0xF565, 0xFE65, 0xFE65, 0xFF45, 0xA2A3, 0x0000,
-    0x0000, 0x0000, 0x1842, 0x6CA6, 0x8667, 0x8667, 0x55A8, 0x4DA8,
-    0x4DA8, 0xA4E5, 0x150A, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x34C8,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x150A, 0x04EA, 0x04EA,
-    0x04EA, 0x2D69, 0x0000, 0x0000, 0x0000, 0x0000, 0x6AA3, 0x150A,
-    0x152A, 0x3222, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xAEC7,
-    0xA6C7, 0xD726, 0xD666, 0x0000, 0x0000, 0xFE65, 0xFE65, 0x1842,
-    0x0000, 0x0000, 0x90C4, 0xFC85, 0xF365, 0xF265, 0xF285, 0xEA65,
-    0xF285, 0xE1A6, 0x0000, 0x0000, 0x0000, 0x0000, 0xC88A, 0xE106,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x1842, 0xE8C8, 0x988B, 0x0000,
-    0x0000, 0x0000, 0x0000, 0xE8AC, 0xE0E7, 0xE106, 0xE106, 0xE965,
-    0xE108, 0xE9C5, 0xE165, 0x0000, 0x0000, 0x0000, 0x0000, 0xF365,
-    0xF365, 0x90C4, 0x0000, 0xFD85, 0xFD85, 0xFE65, 0xFD65, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA6C7, 0x6628, 0x9CE5,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x34C8, 0x04EA, 0x04EA, 0x2D49,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3CC8, 0x04EA,
-    0x04EA, 0x04EA, 0x2D69, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x2D49, 0x150A, 0x64A6, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0xCF26, 0xCF46, 0xF725, 0xCB84, 0x0000, 0x0000, 0xFD65,
-    0xFD85, 0xCA64, 0x0000, 0x0000, 0x1842, 0xF365, 0xF285, 0xC165,
-    0xE9C5, 0xEA85, 0xE9C5, 0xC0C6, 0x0000, 0x0000, 0x0000, 0x0000,
-    0xE8AA, 0xD127, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE108, 0xE0AC, 0x0000,
-    0x0000, 0x0000, 0x0000, 0xC88A, 0xE0C8, 0xE108, 0xE8E7, 0xE108,
-    0xE108, 0xE165, 0xE106, 0x0000, 0x0000, 0x0000, 0xC165, 0xF365,
-    0xF265, 0x0000, 0x0000, 0xF365, 0xFD65, 0xFE85, 0xFD65, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x9AA3, 0xD746, 0xD565, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4DA8, 0x04EA, 0x04EA,
-    0x6AA3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x04EA, 0x04EA, 0x04EA, 0x150A, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x3242, 0x6CA6, 0x34C8, 0x2D49, 0x2D69, 0xA2A3, 0x0000, 0x0000,
-    0x98C4, 0x3242, 0xD686, 0xFF25, 0xF725, 0xF725, 0x9AA3, 0x0000,
-    0x0000, 0xCB84, 0xFC85, 0xFB65, 0x0000, 0x0000, 0x0000, 0xE9C5,
-    0xE9C5, 0xD127, 0xE0E8, 0xE165, 0xE106, 0x0000, 0x0000, 0x0000,
-    0x0000, 0xC8AE, 0xE0AA, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xC88E, 0x988B,
-    0x0000, 0x0000, 0x0000, 0x1842, 0xE8A8, 0xE8AA, 0xE8C8, 0xE0AA,
-    0xE0A8, 0xE0E7, 0xE8C8, 0x0000, 0x0000, 0x0000, 0xE108, 0xE9C5,
-    0xC165, 0x0000, 0x0000, 0xE1A6, 0xF385, 0xFC85, 0xF465, 0xF365,
-    0x0000, 0x62A3, 0x1842, 0x0000, 0xD384, 0xFF25, 0xCF46, 0xCE66,
-    0xCD65, 0x3242, 0x0000, 0x0000, 0x0000, 0x0000, 0x150A, 0x04EA,
-    0x04EA, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0D0A, 0x04EA, 0x04EA, 0x04EA, 0x0000, 0x0000, 0x0000,
-    0x6CA6, 0x4DA8, 0x6CA6, 0x3222, 0x0000, 0x6E28, 0x6608, 0x8667,
-    0x8667, 0xD726, 0xCF26, 0xCF46, 0xF725, 0xFF25, 0xF725, 0xF725,
-    0xF465, 0x0000, 0xFC85, 0xF485, 0xF365, 0xFC85, 0xE9A6, 0x0000,
-    0x0000, 0xD127, 0xE145, 0xE165, 0xE108, 0xE106, 0xE8C8, 0x0000,
-    0x0000, 0x0000, 0x0000, 0xE8AC, 0x986B, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA8D1, 0xE0AE,
-    0x0000, 0x0000, 0x0000, 0x0000, 0xE0AC, 0xE8AC, 0xE0AA, 0xE0AC,
-    0xE0AA, 0xE8AA, 0xE0AA, 0x0000, 0x0000, 0xE108, 0xE106, 0xE165,
-    0xE945, 0x90C4, 0x0000, 0xEA85, 0xF265, 0xF485, 0xFC65, 0xF485,
-    0xFC65, 0xFE65, 0xFE65, 0xF725, 0xFE65, 0xF725, 0xD686, 0x0000,
-    0xCD65, 0xD686, 0xA6C7, 0xA2A3, 0x0000, 0x0000, 0x2042, 0x2D49,
-    0x04EA, 0x2D69, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x152A, 0x04EA, 0x04EA, 0x04EA, 0x6AA3, 0x0000,
-    0x34C8, 0x55A8, 0x0000, 0x0000, 0x0000, 0x0000, 0x9CE5, 0x6E28,
-    0x8667, 0xA6A7, 0xAEC7, 0xCF26, 0xD666, 0xCD65, 0x1842, 0xCB84,
-    0xFD85, 0xFE65, 0xFC65, 0xFC85, 0xEA65, 0x5084, 0xF285, 0xF265,
-    0xE9C5, 0xE1A6, 0x0000, 0x0000, 0xE106, 0xE926, 0xE0C8, 0xE0A8,
-    0xC8AE, 0x0000, 0x0000, 0x0000, 0xC88E, 0xE8AE, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE0AE,
-    0xC8AE, 0x0000, 0x0000, 0x0000, 0xC88E, 0xE8AE, 0xE0AC, 0xE0AC,
-    0xE8AA, 0xE0AC, 0x0000, 0x0000, 0xC8AE, 0xE0A8, 0xE8C8, 0xE108,
-    0xC88A, 0xE165, 0xE145, 0xE9C5, 0xE9C5, 0xEA85, 0xF285, 0xEA65,
-    0xF285, 0xF465, 0xFC85, 0xFE65, 0xF665, 0xF725, 0xF725, 0xCB84,
-    0x0000, 0x0000, 0x0000, 0x9AA3, 0x9CE5, 0xA2A3, 0x0000, 0x9CE5,
-    0x0D2A, 0x152A, 0x3CC8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x4DA8, 0x04EA, 0x04EA, 0x04EA, 0x55A8,
-    0x3222, 0x2D49, 0x0000, 0x0000, 0x0000, 0x0000, 0x9CE5, 0x6E28,
-    0x8667, 0xA6C7, 0xCD65, 0xCF26, 0xD726, 0xF725, 0xF725, 0xFE85,
-    0x0000, 0x0000, 0x5064, 0xFD85, 0xFC85, 0xCA64, 0x0000, 0x0000,
-    0xC165, 0xE9C5, 0xE165, 0xE145, 0xE108, 0xE108, 0xE8E7, 0xE0C8,
-    0xE8AA, 0xE108, 0x986B, 0x0000, 0x0000, 0x5884, 0xE0AE, 0xA08B,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x78D1,
-    0xC8B1, 0x0000, 0x0000, 0x0000, 0x588B, 0xE0B0, 0xE0AE, 0xE8AE,
-    0xE0AC, 0xE8AE, 0x5084, 0xE0AC, 0xE8AA, 0xE0AA, 0xE0C8, 0xE108,
-    0x0000, 0x0000, 0xE108, 0xE145, 0xE965, 0x986B, 0x0000, 0x0000,
-    0xEA65, 0xFC85, 0xF465, 0xFD85, 0xFD65, 0xFD65, 0xFE85, 0xF725,
-    0xFF25, 0x0000, 0x0000, 0x0000, 0x0000, 0xCC64, 0x8667, 0x0000,
-    0x6E28, 0x55A8, 0x0D0A, 0x6CA6, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x6AA3, 0x04EA, 0x04EA, 0x04EA,
-    0x152A, 0x4DA8, 0x6CA6, 0x0000, 0x0000, 0x0000, 0x0000, 0x6E28,
-    0x6E08, 0xA6C7, 0xCD65, 0xD686, 0x0000, 0xCB64, 0xF725, 0xFF25,
-    0xFE85, 0xFE65, 0x90C4, 0x0000, 0xD127, 0xFC65, 0xEA85, 0xF265,
-    0x1842, 0x0000, 0x0000, 0xE945, 0xE106, 0xE0E7, 0xE0C8, 0xE8C8,
-    0xE0A8, 0xE0AA, 0xE0AC, 0xE8AC, 0x0000, 0x0000, 0x0000, 0xC8B1,
-    0xC8AE, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0xC8B1, 0xC8B1, 0x0000, 0x0000, 0x0000, 0xE0B0, 0xE8AE, 0xC8B1,
-    0xE0AE, 0xE8AE, 0xE0AC, 0xE0AE, 0xE0AC, 0xE8AC, 0xE0AA, 0x5084,
-    0x0000, 0x1842, 0xE8A8, 0xE8E7, 0xE106, 0xD127, 0x0000, 0x90E4,
-    0xE9C5, 0xF285, 0xF285, 0xF365, 0xCA64, 0xF265, 0xF485, 0xFD65,
-    0xFE85, 0xF725, 0xFD65, 0x0000, 0x0000, 0x0000, 0x0000, 0xCD65,
-    0x9CE5, 0x6628, 0x2D49, 0x2D69, 0x3A22, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x04EA, 0x04EA,
-    0x04EA, 0x04EA, 0x150A, 0x3222, 0x0000, 0x0000, 0x0000, 0x62A3,
-    0x6E28, 0x8667, 0xA6A7, 0xCE86, 0x62A3, 0x0000, 0x0000, 0xCB84,
-    0xFE65, 0xFE65, 0xFD85, 0xFD85, 0xCA64, 0x9AA3, 0xF365, 0xEA65,
-    0xF285, 0xEA85, 0xE945, 0xA08B, 0x1842, 0xE106, 0xE8C8, 0x986B,
-    0x1842, 0xE8AC, 0xE0AA, 0xE0AC, 0xE8AC, 0xC8B1, 0x0000, 0x0000,
-    0x608B, 0xE8B0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x1842, 0xC8B1, 0x588B, 0x0000, 0x0000, 0xC8B1, 0xE0B0, 0xE0B0,
-    0xE0B0, 0xE0B0, 0xE8AE, 0xA8D1, 0xC88E, 0xE8AE, 0xE8AC, 0x0000,
-    0x1842, 0xE0AC, 0xE0AA, 0xE0C8, 0xE8C8, 0xE106, 0x0000, 0xC0C6,
-    0xE145, 0xEA65, 0xF285, 0xFB65, 0x90C4, 0x0000, 0x0000, 0xF365,
-    0xFD65, 0xFE65, 0xFE65, 0xF725, 0x0000, 0x0000, 0x0000, 0x0000,
-    0xA4E5, 0x8667, 0x6E28, 0x4DA8, 0x2D69, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x152A,
-    0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x2042, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x8667, 0x8667, 0xAEC7, 0xA6A7, 0xD686, 0x90C4, 0x0000,
-    0x0000, 0xCB84, 0xFD65, 0xFD85, 0xFC65, 0xF485, 0xF365, 0xFB65,
-    0xEA65, 0xE1A6, 0xE965, 0xE145, 0xE106, 0xE108, 0xE0C8, 0xE8C8,
-    0xE0AA, 0x0000, 0x0000, 0x986B, 0xE8AC, 0xE0AE, 0xE0AE, 0x0000,
-    0x0000, 0x0000, 0xC8B1, 0xA8D1, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0xB0B1, 0xA8D1, 0x0000, 0x0000, 0x0000, 0xD0B1, 0xE0B0,
-    0xC8B1, 0xE0B0, 0x986B, 0x0000, 0x1842, 0xE8B0, 0xE8AE, 0xE0AE,
-    0xE0AE, 0xE8AC, 0xE0AA, 0xE0AA, 0xE0AA, 0xE8C8, 0xE0A8, 0xE108,
-    0xE106, 0xE165, 0xE965, 0xE9C5, 0x5084, 0x0000, 0x0000, 0x5884,
-    0xFB65, 0xFD85, 0xF565, 0xFE85, 0xFE65, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x9CE5, 0x8667, 0x6608, 0x4DA8, 0x4DA8, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x150A, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x8667, 0xA6A7, 0xA6C7, 0xCF26, 0xF725, 0xF725,
-    0xFF25, 0xCE86, 0xCB84, 0xF565, 0xFD85, 0xFD65, 0xF365, 0xF365,
-    0xF285, 0xEA85, 0xE9C5, 0xE965, 0xE106, 0xE106, 0xE0E7, 0xE8C8,
-    0xE0A8, 0xE108, 0xE8AC, 0x0000, 0x0000, 0x988B, 0xE0AE, 0xE0B0,
-    0xD0B1, 0x0000, 0x0000, 0x88D1, 0xD0B1, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0xA8D1, 0x78D1, 0x0000, 0x0000, 0xB0D1, 0xC8B1,
-    0xC8B1, 0xC8B1, 0x0000, 0x0000, 0x0000, 0xE0B0, 0xE0B0, 0xE0B0,
-    0xE0AE, 0xE0AE, 0xE8AE, 0xE0AC, 0xE0AC, 0xE108, 0xE0AA, 0xE8A8,
-    0xE0C8, 0xE126, 0xE106, 0xE945, 0xE145, 0x0000, 0xD127, 0xF365,
-    0xF365, 0xFD85, 0xFD65, 0xFE65, 0xFE65, 0xCB84, 0x0000, 0x0000,
-    0x0000, 0x0000, 0xCC64, 0xAEC7, 0x8667, 0x6E08, 0x6E28, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x2D69, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x8667, 0xAEC7, 0xD726, 0xCF26, 0xF725,
-    0xF725, 0xFF25, 0xFE65, 0xFE65, 0xF565, 0xFC65, 0xF365, 0xF365,
-    0xF285, 0xEA65, 0xE1A6, 0xE965, 0xE106, 0xE106, 0xE0C8, 0xE8C8,
-    0xE0A8, 0xE0AA, 0xE0AA, 0xE8AC, 0x988B, 0x0000, 0x0000, 0xE0B0,
-    0xE0B0, 0xE0B0, 0x588B, 0x0000, 0x0000, 0xB0B1, 0x588B, 0x0000,
-    0x0000, 0x0000, 0x78F1, 0x90D1, 0x0000, 0x0000, 0x608B, 0xB0D1,
-    0xA8B1, 0xB0D1, 0x88D1, 0x0000, 0x0000, 0xB0D1, 0xC8B1, 0xE0B0,
-    0xE0B0, 0xE0B0, 0xE8AE, 0xE0AE, 0xE0AC, 0xE8AC, 0xE0AA, 0xE0AA,
-    0xE0A8, 0xE8C8, 0xE0A8, 0xE106, 0xE126, 0xE965, 0xE1A6, 0xF285,
-    0xEA85, 0xF365, 0xF365, 0xFC65, 0xFD85, 0xFE65, 0xF465, 0x0000,
-    0x0000, 0x0000, 0x0000, 0xCE86, 0xA6C7, 0x8667, 0x6E08, 0x9CE5,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x6CA6, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x4DA8,
-    0x0000, 0x0000, 0x0000, 0xCD65, 0x8667, 0xCE86, 0x0000, 0xCD65,
-    0xFE65, 0xF725, 0xFE65, 0xF665, 0xFD85, 0xFD65, 0xF485, 0xFC65,
-    0xEA85, 0xF285, 0xE9C5, 0xE9C5, 0xE108, 0xE106, 0xE0E7, 0xE0AA,
-    0xE8C8, 0xE0AC, 0xE0AA, 0xE0AC, 0xE8AC, 0xE8AE, 0x1842, 0x0000,
-    0xE0B0, 0xD0B1, 0x988B, 0xC8B1, 0x0000, 0x0000, 0x90D1, 0xA8D1,
-    0x0000, 0x0000, 0x0000, 0x90D1, 0x6111, 0x0000, 0x0000, 0x90F1,
-    0x90D1, 0x0000, 0xA8B1, 0xB0D1, 0x0000, 0x90D1, 0xC8B1, 0xC8B1,
-    0xC8B1, 0xE0B0, 0xE0B0, 0xE0B0, 0xE0AE, 0xE0B0, 0xE0AE, 0xE8AC,
-    0xE0AA, 0xE0AC, 0xE0C8, 0xE8E7, 0xE0E7, 0xE106, 0xE145, 0xE9C5,
-    0xE9C5, 0xEA85, 0xFB65, 0xF365, 0xCA64, 0xCB84, 0xFD65, 0xFE85,
-    0x5864, 0x0000, 0x0000, 0x0000, 0xCE66, 0xD746, 0x8667, 0x8667,
-    0x9AA3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x3242, 0x04EA, 0x04EA, 0x04EA, 0x04EA,
-    0x150A, 0x6E28, 0x0000, 0x0000, 0x8667, 0xAEC7, 0x9AA3, 0x0000,
-    0x0000, 0x0000, 0xFD65, 0xFE85, 0xFD65, 0xFC65, 0xF365, 0xF365,
-    0xF285, 0xE1A6, 0x986B, 0x5084, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0xA08B, 0xE8AC, 0xE0AC, 0xE0AE, 0xE0AE, 0xE0B0,
-    0xA8B1, 0xE8B0, 0x0000, 0x0000, 0xA8D1, 0x78D1, 0x0000, 0x0000,
-    0x78F1, 0x588B, 0x0000, 0x608B, 0x6111, 0x0000, 0x0000, 0x4931,
-    0x78F1, 0x78D1, 0x0000, 0x78F1, 0x90D1, 0x608B, 0xB0D1, 0xA8B1,
-    0xB0D1, 0xC8B1, 0xC8B1, 0x90D1, 0x1842, 0x0000, 0x0000, 0x0000,
-    0x2042, 0xD0AE, 0xC88A, 0xE0AC, 0xE8AA, 0xE0C8, 0xE0E7, 0xE106,
-    0xE965, 0xE9C5, 0xE9C5, 0xE1A6, 0x0000, 0x0000, 0x0000, 0xF485,
-    0xFD85, 0xCA64, 0x0000, 0x0000, 0xFD65, 0xCF46, 0xA6A7, 0xA6C7,
-    0x8667, 0x1822, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x152A, 0x04EA, 0x04EA,
-    0x04EA, 0x2D49, 0x2D49, 0x4DA8, 0x6E28, 0xA6A7, 0xA6C7, 0xCF26,
-    0xCF26, 0xF725, 0xFF25, 0xF725, 0xFE65, 0xFE85, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1842, 0xC8B1, 0xE0B0,
-    0xE0B0, 0xE8B0, 0xD0B1, 0x1842, 0x0000, 0xC8B1, 0xB0B1, 0x0000,
-    0x0000, 0x78F1, 0x6111, 0x0000, 0x4931, 0x6911, 0x0000, 0x0000,
-    0x6111, 0x78F1, 0x2991, 0x0000, 0x4951, 0x90D1, 0x90D1, 0xA8D1,
-    0xB0B1, 0xB0D1, 0x608B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x1842, 0x1842, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0xD127, 0xE145, 0xF265, 0xF285, 0xF365, 0xF365, 0xF465,
-    0xFD65, 0xFE85, 0xFD65, 0xFD65, 0xF725, 0xF725, 0xD726, 0xCF26,
-    0xAEC7, 0xA6C7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x150A, 0x04EA,
-    0x04EA, 0x152A, 0x150A, 0x55A8, 0x55A8, 0x8667, 0x8667, 0xA6C7,
-    0xD726, 0xF725, 0xFF25, 0xF725, 0xFE65, 0xFE65, 0xFD65, 0xF485,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x1842, 0xE090, 0xC8B1, 0xD0B1, 0xA8D1, 0x0000, 0x608B, 0x90D1,
-    0x588B, 0x0000, 0x1842, 0x6911, 0x4931, 0x6111, 0x2042, 0x0000,
-    0x190B, 0x6911, 0x4951, 0x0000, 0x1842, 0x6911, 0x6111, 0x78F1,
-    0x78D1, 0x608B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0xE908, 0xE165, 0xE9C5, 0xF285, 0xEA65, 0xF365,
-    0xFC85, 0xFD65, 0xFD85, 0xF665, 0xFE65, 0xF725, 0xF725, 0xF725,
-    0xD726, 0xA6C7, 0x9CE5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4DA8,
-    0x04EA, 0x04EA, 0x152A, 0x2D49, 0x2D49, 0x6E28, 0x8667, 0xA6A7,
-    0xA6C7, 0xF725, 0xFE65, 0xF725, 0xF725, 0xFE65, 0xF485, 0xFD65,
-    0xFC85, 0x9AC3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0xB0B1, 0xB0D1, 0xB0D1, 0x90D1, 0x0000,
-    0x78D1, 0x78F1, 0x0000, 0x4951, 0x4931, 0x4951, 0x4931, 0x3191,
-    0x0000, 0x4951, 0x4931, 0x3191, 0x0000, 0x4951, 0x4931, 0x6111,
-    0x4951, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0xE0AA, 0xE906, 0xE106, 0xE1A6, 0xE9C5, 0xEA85,
-    0xF365, 0xFC65, 0xF485, 0xFD65, 0xFD65, 0xFF25, 0xF725, 0xF725,
-    0xCF26, 0xD726, 0xA6C7, 0xCC64, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x3A22, 0x04EA, 0x04EA, 0x152A, 0x2D49, 0x55A8, 0x6E28, 0x8667,
-    0xA6C7, 0xD726, 0xCD65, 0x0000, 0xCB84, 0xF725, 0xFE65, 0xFD65,
-    0xFC85, 0xF465, 0xF365, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x90D1, 0x88D1, 0x90F1,
-    0x78F1, 0x608B, 0x6111, 0x190B, 0x3191, 0x4931, 0x3191, 0x3191,
-    0x3191, 0x1842, 0x3191, 0x3191, 0x0000, 0x3191, 0x2991, 0x4931,
-    0x3191, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x2042, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0xA08B, 0xE0E7, 0xE8E7, 0xE165, 0xE106, 0xE9C5,
-    0xF285, 0xC165, 0x5084, 0xFC85, 0xFC85, 0xFE65, 0xF665, 0xF725,
-    0xF725, 0xFF25, 0xCF26, 0xCF26, 0x1842, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x150A, 0x152A, 0x150A, 0x55A8, 0x4DA8, 0x6608,
-    0x8667, 0xCF26, 0xCF46, 0xF725, 0xFD65, 0xF725, 0xFE65, 0xFE65,
-    0xFD85, 0xFD65, 0xF365, 0xF285, 0xF285, 0x5884, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x90D1,
-    0x78F1, 0x78F1, 0x4931, 0x5151, 0x4931, 0x190B, 0x3191, 0x3191,
-    0x3191, 0x190B, 0x21F2, 0x2212, 0x210B, 0x2212, 0x2991, 0x3191,
-    0x3191, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1842, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x988B, 0xE0AA, 0xE8AA, 0xE108, 0xE106, 0xE145,
-    0xE9C5, 0xEA85, 0xE1A6, 0xF265, 0xF485, 0xFD65, 0xFD65, 0xFE65,
-    0xFE65, 0xF725, 0xF725, 0xFF25, 0xD686, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x6CA6, 0x04EA, 0x2D69, 0x2D49, 0x4DA8,
-    0x6E28, 0xD464, 0xA6C7, 0xCF26, 0xD726, 0xF725, 0xFE65, 0xFE65,
-    0xFD65, 0xF585, 0xFC65, 0xF365, 0xF285, 0xEA65, 0xE1A6, 0xC185,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x588B, 0x90D1,
-    0x78F1, 0x78D1, 0x4931, 0x4951, 0x3191, 0x4931, 0x2042, 0x3191,
-    0x2991, 0x2212, 0x2042, 0x2212, 0x2212, 0x1A53, 0x21F2, 0x2212,
-    0x3191, 0x2212, 0x2991, 0x210B, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0xB0B1, 0xE8AA, 0xE0A8, 0xC8AE, 0xE0A8, 0xE906,
-    0xE126, 0xE9C5, 0xE9C5, 0xEA85, 0xF365, 0xFC85, 0xF465, 0xFD85,
-    0xF365, 0xF725, 0xFE65, 0xF725, 0xCF26, 0xCD65, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x150A, 0x2D69, 0x4DA8,
-    0x4DA8, 0xD565, 0xCB84, 0xCD65, 0xCE86, 0xF725, 0xF725, 0xF725,
-    0xFE65, 0xFE65, 0xFD85, 0xF465, 0xFB65, 0xFB65, 0xF285, 0x1842,
-    0xE108, 0xE108, 0x988B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x608B, 0xA8B1, 0xD0B1, 0xA8D1, 0xB0D1,
-    0x90D1, 0x90F1, 0x6111, 0x210B, 0x3191, 0x4931, 0x3191, 0x21F2,
-    0x2212, 0x1A53, 0x1A53, 0x12B4, 0x1A53, 0x1AB4, 0x12B4, 0x190B,
-    0x1A53, 0x1A53, 0x2212, 0x2212, 0x3191, 0x4931, 0x3191, 0x210B,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x1842, 0xC8B1, 0xE0AE, 0xC88E, 0xE0AC, 0xE8C8, 0xE0E7,
-    0xE0E7, 0xE145, 0xE145, 0xF285, 0xF265, 0xF365, 0xF365, 0xFC85,
-    0xFC65, 0x62A3, 0xFD85, 0xF725, 0xF725, 0xFF25, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6CA6, 0x2D69,
-    0x2D49, 0x6E28, 0x8667, 0x9CE5, 0x0000, 0xFC65, 0xD746, 0xF725,
-    0xFE65, 0xFE65, 0xFD65, 0xF465, 0x1842, 0xFC85, 0xF265, 0xE1A6,
-    0x0000, 0x5084, 0xE908, 0xE0E7, 0xE8C8, 0xE0AA, 0xE0AA, 0xE0AC,
-    0xE8AE, 0xE0AE, 0xC8B1, 0xE0B0, 0xC8B1, 0xC8B1, 0xB0B1, 0x88D1,
-    0x0000, 0x6111, 0x6111, 0x6911, 0x2991, 0x4951, 0x3191, 0x2212,
-    0x2212, 0x1A53, 0x1A53, 0x12B4, 0x1AB4, 0x1356, 0x12B4, 0x1356,
-    0x12B4, 0x1356, 0x1A53, 0x1A53, 0x09EE, 0x09EE, 0x3191, 0x5131,
-    0x4951, 0x6911, 0x4931, 0x6111, 0x190B, 0x608B, 0x608B, 0xB0D1,
-    0xB0D1, 0xE0B0, 0xE8AE, 0xE0AE, 0x0000, 0x0000, 0xE0AA, 0xE0AA,
-    0xE8A8, 0xC88A, 0xE108, 0xE165, 0xE9C5, 0xEA85, 0xF285, 0xF365,
-    0x0000, 0xCA64, 0xCB84, 0xFD65, 0xFE85, 0xF725, 0xCC64, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x55A8, 0x4DA8, 0x6628, 0x8667, 0xA6C7, 0xCD65, 0xCF26, 0xF725,
-    0xFE65, 0xCB84, 0xFE65, 0xFE85, 0x90E4, 0x0000, 0xE1A6, 0xF365,
-    0xE9C5, 0xE9C5, 0xE965, 0xE106, 0xE0C8, 0xE108, 0xE0AA, 0xE8AC,
-    0xE0AC, 0xE8AE, 0xC8B1, 0x88D1, 0xE8B0, 0xD0B1, 0x0000, 0x0000,
-    0x0000, 0x190B, 0x78F1, 0x6911, 0x4931, 0x4931, 0x3191, 0x3191,
-    0x0000, 0x12B4, 0x1AB4, 0x1356, 0x0B56, 0x1356, 0x1356, 0x0000,
-    0x1356, 0x0B56, 0x1356, 0x1356, 0x12B4, 0x1AD4, 0x0000, 0x0000,
-    0x0000, 0x4931, 0x4951, 0x6111, 0x4931, 0x90D1, 0xA8D1, 0xC8B1,
-    0xC8B1, 0xE0B0, 0xE0B0, 0xE0B0, 0xE0AE, 0xE8AE, 0xC88E, 0xE0AC,
-    0xE8C8, 0x588B, 0x0000, 0xC0C6, 0xE145, 0xE9C5, 0xD127, 0xFB65,
-    0xF365, 0xFC85, 0x986B, 0xF565, 0xFE65, 0xF725, 0xFE65, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x6CA6, 0x6E08, 0x8667, 0xA6C7, 0xA6A7, 0xD726,
-    0xCE86, 0xCB64, 0xFD85, 0xFE65, 0xFC65, 0x0000, 0x0000, 0x5084,
-    0xF285, 0xF265, 0xE145, 0xE165, 0x5084, 0x0000, 0xE8A8, 0xE8AA,
-    0xC8AE, 0xE0AC, 0xE0AC, 0xE0B0, 0xA8B1, 0xD0B1, 0x0000, 0x0000,
-    0x0000, 0x88D1, 0x78F1, 0x78F1, 0x4931, 0x4931, 0x3191, 0x3191,
-    0x0000, 0x1842, 0x1A73, 0x1AB4, 0x0B56, 0x1356, 0x1356, 0x0BD8,
-    0x0000, 0x0000, 0x1356, 0x0B56, 0x1356, 0x1AB4, 0x1A53, 0x1A53,
-    0x190B, 0x0000, 0x0000, 0x5131, 0x4951, 0x4931, 0x78F1, 0xB0D1,
-    0xB0B1, 0x0000, 0xC8B1, 0xD0B1, 0x0000, 0xE0B0, 0xE0AC, 0xE8AC,
-    0xE0AA, 0xE0AA, 0x0000, 0x0000, 0x0000, 0xE165, 0xE945, 0xE1A6,
-    0xE1C6, 0xF365, 0xFB65, 0xFD85, 0xF585, 0xFE65, 0xCB84, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x64A6, 0xCD65, 0xD726,
-    0xCE66, 0xF685, 0xFD65, 0xF725, 0xFE85, 0xFB65, 0x98C4, 0x5884,
-    0x588B, 0xF385, 0xE9C5, 0xE1A6, 0x0000, 0x0000, 0xC88A, 0xE0C8,
-    0xE8AA, 0x0000, 0xE0AC, 0xE0AE, 0xE8AE, 0xE0B0, 0x608B, 0x0000,
-    0x1842, 0xB0D1, 0x90D1, 0x210B, 0x190B, 0x6911, 0x4951, 0x5131,
-    0x0000, 0x0000, 0x09EE, 0x12B4, 0x1AB4, 0x0BF8, 0x0BD8, 0x0479,
-    0x0C79, 0x0000, 0x0000, 0x0B33, 0x0BF8, 0x0BD8, 0x0B56, 0x0000,
-    0x1A53, 0x2212, 0x2212, 0x0000, 0x0000, 0x6111, 0x6111, 0x90D1,
-    0x88F1, 0x90D1, 0x0000, 0xC8B1, 0xE8B0, 0x0000, 0x0000, 0x5084,
-    0xE0AC, 0xE0AC, 0xE0AA, 0x0000, 0x0000, 0x0000, 0xE0E8, 0xE9C5,
-    0xE9C5, 0xEA85, 0xF265, 0xF485, 0xFC65, 0xCA64, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x1842, 0xA2A3, 0xCB84, 0xFC85, 0xFC85, 0xF365, 0xFC65,
-    0xF365, 0xF365, 0xF285, 0xE9C5, 0x586B, 0xD127, 0x0000, 0xE0AA,
-    0xE8C8, 0xE0AC, 0x0000, 0xC88E, 0xE0AE, 0xE0B0, 0xE0B0, 0xC8B1,
-    0x1842, 0xD0B1, 0x90D1, 0x0000, 0x0000, 0x4951, 0x4931, 0x4951,
-    0x1842, 0x0000, 0x0000, 0x1A53, 0x1AB4, 0x1356, 0x0B56, 0x0BF8,
-    0x0C79, 0x0479, 0x0000, 0x0000, 0x0000, 0x0C79, 0x1356, 0x0B56,
-    0x09EE, 0x0000, 0x210B, 0x2212, 0x3191, 0x2042, 0x4931, 0x6111,
-    0x78F1, 0x90D1, 0x0000, 0x0000, 0xD0B1, 0xE0B0, 0xA8D1, 0xD0B1,
-    0x986B, 0xE8AE, 0xE0AA, 0xE0AA, 0xC8AE, 0xE8AC, 0xE0AA, 0xE108,
-    0xD127, 0xE1A6, 0x90E4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x1842, 0x5884, 0x0000, 0x1842, 0xE1A6, 0xD127, 0xE108,
-    0xE8C8, 0xE0AA, 0xE0AA, 0xE8AC, 0x988B, 0xE0AE, 0xE0B0, 0xE0B0,
-    0xE0B0, 0xE8B0, 0x90D1, 0x0000, 0x0000, 0x0000, 0x6111, 0x6911,
-    0x3191, 0x0000, 0x0000, 0x0000, 0x1A53, 0x0B56, 0x1356, 0x0BD8,
-    0x0C79, 0x0479, 0x0C79, 0x0000, 0x0000, 0x0000, 0x0000, 0x0BF8,
-    0x0B56, 0x1356, 0x0000, 0x0000, 0x0000, 0x3191, 0x4951, 0x6111,
-    0x6111, 0x90D1, 0x6111, 0x78D1, 0xA8D1, 0xE0B0, 0xE0B0, 0xE0B0,
-    0xC88E, 0xE8B0, 0x2042, 0x0000, 0x0000, 0x608B, 0x1842, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x608B, 0xF285, 0xE945, 0xE106,
-    0xE8E7, 0xE0E7, 0xE0C8, 0xE0AA, 0xE8AA, 0xE0AE, 0xE0AE, 0xE0B0,
-    0xE0B0, 0xE0B0, 0xC8B1, 0xA8D1, 0x0000, 0x0000, 0x6111, 0x6111,
-    0x4931, 0x0000, 0x0000, 0x0000, 0x0000, 0x1A53, 0x1AB4, 0x0B56,
-    0x0BF8, 0x0C79, 0x0479, 0x0C79, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0B33, 0x0B56, 0x1AB4, 0x210B, 0x0000, 0x09EE, 0x3191, 0x4931,
-    0x4951, 0x6911, 0x78F1, 0x90D1, 0xA8D1, 0xD0B1, 0xC8B1, 0xE0B0,
-    0xE0B0, 0xE0B0, 0xE8AE, 0xE0AE, 0x5084, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0xF285, 0xF365, 0xE9C5, 0xE9C5,
-    0xE126, 0xE106, 0xE8E7, 0xE0A8, 0xC8AE, 0xE0AC, 0xE8AC, 0xE0AE,
-    0xE0AE, 0xE0B0, 0xE8B0, 0xC8B1, 0xA8B1, 0xB0D1, 0x6911, 0x78F1,
-    0x6111, 0x5131, 0x0000, 0x0000, 0x0000, 0x0000, 0x1A53, 0x0B56,
-    0x1356, 0x0BD8, 0x0C79, 0x0479, 0x0C79, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0B56, 0x1356, 0x12B4, 0x1A53, 0x3191, 0x3191,
-    0x2991, 0x6111, 0x6111, 0x78F1, 0x90D1, 0xB0D1, 0xA8B1, 0xC8B1,
-    0xE0B0, 0xE0B0, 0xE0AE, 0xE0AE, 0xE8AC, 0xE0AC, 0xE8AC, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0xCA64, 0xF365, 0xF365, 0xF285, 0xEA65,
-    0xE145, 0xE165, 0xE8E7, 0xE0E7, 0xE0AA, 0x0000, 0xE0AA, 0xE8AE,
-    0xE0AE, 0xE0B0, 0xC8B1, 0xE0B0, 0xC8B1, 0xC8B1, 0xB0B1, 0x88D1,
-    0x78F1, 0x6111, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1A53,
-    0x12B4, 0x1356, 0x1356, 0x0BF8, 0x0479, 0x0C79, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x09EE, 0x12B4, 0x1AB4, 0x2212, 0x2212,
-    0x3191, 0x4931, 0x4931, 0x6911, 0x78F1, 0x90D1, 0xB0D1, 0x1842,
-    0xB0B1, 0xE0B0, 0xE0B0, 0xE0B0, 0xE8AE, 0xE0AE, 0xE0AA, 0xE0AA,
-    0xE8C8, 0xC88A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0xFD85, 0xF465, 0xFC85, 0xF365, 0xF365,
-    0xE9C5, 0xE9C5, 0xE165, 0xE906, 0xE0AA, 0xE108, 0xE0AA, 0xE8AC,
-    0xC8AE, 0xE0AE, 0xE8AE, 0x1842, 0xC8B1, 0xE8B0, 0xC8B1, 0xB0D1,
-    0x90D1, 0x90D1, 0x608B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x1A53, 0x12B4, 0x1356, 0x0BF8, 0x0BD8, 0x0479, 0x0C79, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0B56, 0x1A53, 0x2212,
-    0x3191, 0x4951, 0x4931, 0x0000, 0x6111, 0x90F1, 0x90D1, 0xA8B1,
-    0xB0D1, 0xC8B1, 0xC8B1, 0xE0B0, 0xE0AE, 0xE0AE, 0xE0AC, 0xE8AC,
-    0xE0AA, 0xE0AA, 0xE0E7, 0xE108, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0xC165, 0xFE85, 0xFD65, 0xF565, 0xF365, 0xFB65,
-    0xEA85, 0xF265, 0xE145, 0xE108, 0xE106, 0xE0E7, 0xE8C8, 0xE0AC,
-    0xE0AA, 0xC8AE, 0xE8AC, 0xE0AE, 0x0000, 0xC8B1, 0xC8B1, 0xC8B1,
-    0xB0B1, 0xA8D1, 0x78D1, 0x78F1, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x1A53, 0x1A53, 0x12B4, 0x0B56, 0x1356, 0x1356, 0x0BD8,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0B33, 0x1A53, 0x2212,
-    0x3191, 0x3191, 0x2991, 0x4931, 0x0000, 0x6911, 0x78F1, 0x90D1,
-    0xB0D1, 0xC8B1, 0xC8B1, 0xC8B1, 0xE8AE, 0xE0B0, 0xC8B1, 0xE8AC,
-    0xE0AA, 0xE0AA, 0xE0A8, 0xE8E7, 0xE106, 0xE165, 0x5084, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0xCD65, 0xF725, 0xFE65, 0xFE65, 0xFD85, 0xF485,
-    0xFB65, 0xF365, 0xF285, 0xE1A6, 0xE108, 0xE106, 0xE0E7, 0xE0C8,
-    0xE8AA, 0xE0AC, 0xA8D1, 0xE8AE, 0xE0AE, 0xE0B0, 0xE0B0, 0xE0B0,
-    0xD0B1, 0xC8B1, 0x6111, 0x90D1, 0x78D1, 0x6911, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x2212, 0x1A53, 0x1A53, 0x1356, 0x1356, 0x0B56,
-    0x1356, 0x0000, 0x0000, 0x0000, 0x0000, 0x09EE, 0x12B4, 0x1A53,
-    0x2212, 0x2212, 0x3191, 0x4931, 0x4931, 0x6111, 0x78F1, 0x90F1,
-    0x90D1, 0xA8B1, 0xB0D1, 0xE0B0, 0xC8B1, 0xE0B0, 0xE0AE, 0xE0AE,
-    0xE8AC, 0xC88E, 0xE0AA, 0xE0C8, 0xE0E7, 0xE906, 0xE165, 0xE9C5,
-    0xD927, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0xCE86, 0xF725, 0xFE65, 0xFE65, 0xFD65, 0xFD85,
-    0xF465, 0xFC85, 0xEA65, 0xF285, 0x90C4, 0x90C4, 0xE906, 0xE108,
-    0x0000, 0xE0AA, 0xE0AA, 0xE8AC, 0xE0AC, 0xE0AE, 0xE0AE, 0xE0B0,
-    0xC8B1, 0xC8B1, 0x0000, 0x0000, 0x6111, 0x90F1, 0x6111, 0x190B,
-    0x0000, 0x0000, 0x0000, 0x2212, 0x2212, 0x1A53, 0x1A53, 0x1AB4,
-    0x12B4, 0x1356, 0x0000, 0x0000, 0x0000, 0x0000, 0x1A53, 0x1A53,
-    0x21F2, 0x0000, 0x0000, 0x3191, 0x4931, 0x6911, 0x6111, 0x90F1,
-    0x90D1, 0xB0D1, 0xA8D1, 0xC8B1, 0xB0B1, 0x0000, 0xE8AE, 0xE0AE,
-    0x0000, 0xE0AE, 0xE0AA, 0xE8AA, 0xE0C8, 0xE108, 0xE106, 0xE165,
-    0xE9C5, 0xF285, 0xEA65, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0xD726, 0xF725, 0xF725, 0xF725, 0xFE65, 0xF665,
-    0xFD85, 0xFD65, 0xF365, 0xF365, 0xF285, 0xF285, 0xE145, 0xE165,
-    0xE0E7, 0xE108, 0xE8AA, 0xE0AA, 0xE0AC, 0xE0AE, 0xE8AE, 0xE0B0,
-    0xE0B0, 0xE0B0, 0xD0B1, 0x78D1, 0x0000, 0x0000, 0x78F1, 0x78D1,
-    0x6111, 0x0000, 0x0000, 0x0000, 0x3191, 0x2212, 0x21F2, 0x1A53,
-    0x1A53, 0x1AB4, 0x12B4, 0x0000, 0x0000, 0x0000, 0x1A53, 0x1A53,
-    0x2212, 0x0000, 0x0000, 0x0000, 0x3191, 0x6111, 0x6111, 0x78F1,
-    0x88D1, 0xB0D1, 0xA8D1, 0xD0B1, 0xC8B1, 0x90D1, 0xC8B1, 0xE0B0,
-    0xC88E, 0xC8AE, 0xE0AC, 0xE0AA, 0xE8A8, 0xE108, 0xE0E7, 0xE165,
-    0xE145, 0xF265, 0xEA85, 0xFB65, 0xF365, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0xA6C7, 0xCF26, 0xCF26, 0xFF25, 0xFE65, 0xFE65,
-    0xF565, 0xFD65, 0xF365, 0xFC85, 0xF365, 0xF265, 0xE9C5, 0xE1C5,
-    0xE106, 0xE106, 0xE8C8, 0xE0C8, 0xE0A8, 0xE0AC, 0xE8AC, 0xE0AE,
-    0xE0AE, 0xE0B0, 0xE0B0, 0xE0B0, 0xC8B1, 0x0000, 0x0000, 0x0000,
-    0x78F1, 0x78D1, 0x1842, 0x0000, 0x3191, 0x3191, 0x2991, 0x3191,
-    0x3191, 0x2212, 0x2212, 0x1A53, 0x1A53, 0x0000, 0x0000, 0x21F2,
-    0x3191, 0x2991, 0x0000, 0x0000, 0x3191, 0x6111, 0x4931, 0x78F1,
-    0x78F1, 0x90D1, 0x90D1, 0xD0B1, 0xC8B1, 0xE0B0, 0xE0B0, 0xE0B0,
-    0xE8AE, 0xE0AE, 0xE0AC, 0xE8AA, 0xE0C8, 0xE0C8, 0xE0A8, 0xE906,
-    0xE126, 0xE9C5, 0xE9C5, 0xEA85, 0xF365, 0xFC85, 0xF365, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0xCD65, 0xA6C7, 0xCF26, 0xF725, 0xF725, 0xF725,
-    0xFE65, 0xFE65, 0xF365, 0x0000, 0xF365, 0xFC85, 0xEA85, 0xF285,
-    0xE1A6, 0xE945, 0xE108, 0xE108, 0xE0C8, 0xE0AA, 0xE0AA, 0xE8AC,
-    0xE0AC, 0x0000, 0xC88E, 0xE8B0, 0xC8B1, 0xE0B0, 0xB0D1, 0x0000,
-    0x0000, 0x78D1, 0x78F1, 0x6111, 0x210B, 0x4951, 0x0000, 0x4931,
-    0x3191, 0x3191, 0x2991, 0x21F2, 0x0000, 0x2212, 0x0000, 0x3191,
-    0x3191, 0x2212, 0x0000, 0x0000, 0x3191, 0x6111, 0x6111, 0x78D1,
-    0x78F1, 0x0000, 0x88D1, 0xC8B1, 0xC8B1, 0xE0B0, 0xE0B0, 0xE0B0,
-    0xE8AE, 0xE0B0, 0xE0AC, 0xE0AC, 0xE0AA, 0xE8AA, 0xE0C8, 0xD08E,
-    0x1842, 0xE145, 0xE9C5, 0xEA85, 0xF265, 0xF485, 0xFC65, 0xF585,
-    0xFC65, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x9CE5, 0x8667, 0xAEC7, 0xCF26, 0xD726, 0xF725,
-    0xF725, 0xF725, 0xFE65, 0xFD65, 0x0000, 0x0000, 0xF365, 0xF265,
-    0x0000, 0x0000, 0xE0AC, 0xE145, 0xE8E7, 0xE0E7, 0xE0C8, 0xE0AA,
-    0xE8AA, 0x986B, 0x0000, 0x0000, 0xC8B1, 0xA8D1, 0x0000, 0xD0B1,
-    0xA8B1, 0x0000, 0x1842, 0x90D1, 0x78F1, 0x6111, 0x3191, 0x0000,
-    0x4931, 0x4951, 0x3191, 0x3191, 0x3191, 0x0000, 0x3191, 0x2991,
-    0x3191, 0x4931, 0x210B, 0x0000, 0x190B, 0x6911, 0x3191, 0x0000,
-    0x6111, 0x190B, 0x0000, 0x2042, 0xB0D1, 0xC8B1, 0xD0B1, 0xE0B0,
-    0xE0AE, 0xE8AE, 0xA8D1, 0x0000, 0x588B, 0xE8AC, 0xE0A8, 0x5884,
-    0x0000, 0xD127, 0xE965, 0xE9C5, 0xEA85, 0xF365, 0xFB65, 0xF465,
-    0xFC85, 0xFE65, 0xCB84, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x6E08, 0x8667, 0xA6C7, 0xA6A7, 0xCF46,
-    0xF725, 0xF725, 0xFF25, 0xF725, 0xFD85, 0xCB84, 0x90C4, 0xF465,
-    0xF285, 0x0000, 0x0000, 0xE108, 0xE165, 0xE106, 0xE8E7, 0xE0C8,
-    0xE8AA, 0xE108, 0x1842, 0x0000, 0x0000, 0xB0B1, 0xE0B0, 0x0000,
-    0x0000, 0xC8B1, 0xB0D1, 0x0000, 0x90F1, 0x90D1, 0x78F1, 0x0000,
-    0x0000, 0x6111, 0x5131, 0x4951, 0x4931, 0x4951, 0x0000, 0x210B,
-    0x3191, 0x4931, 0x4951, 0x1842, 0x3191, 0x6111, 0x4931, 0x0000,
-    0x6111, 0x90D1, 0x0000, 0x0000, 0x0000, 0xC8B1, 0xC8B1, 0xE0B0,
-    0xE0B0, 0xE0B0, 0xE0AE, 0xE8AE, 0x0000, 0x0000, 0xC8AE, 0xE0C8,
-    0xC88A, 0x0000, 0xE145, 0xE9C5, 0xE9C5, 0xF365, 0xF365, 0xFC65,
-    0xF485, 0xFD65, 0xFE65, 0xF665, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x9AA3, 0x4DA8, 0x8E67, 0x8667, 0xA6C7,
-    0xD726, 0xF725, 0xF725, 0xFF25, 0xFE65, 0xFE65, 0xF565, 0xF365,
-    0xFB65, 0xF365, 0x0000, 0x0000, 0xE1A6, 0xE165, 0xE906, 0xE0E7,
-    0xE0C8, 0x5084, 0xE8AA, 0x986B, 0x0000, 0x0000, 0x0000, 0xE8B0,
-    0xC8B1, 0x0000, 0x0000, 0xC8B1, 0xA8D1, 0xB0B1, 0x90D1, 0x88F1,
-    0x0000, 0x0000, 0x6111, 0x6111, 0x4931, 0x6911, 0x4951, 0x0000,
-    0x0000, 0x4931, 0x4951, 0x6911, 0x4931, 0x6111, 0x210B, 0x0000,
-    0x0000, 0x90F1, 0x190B, 0x0000, 0x0000, 0x0000, 0xD0B1, 0xC8B1,
-    0x1842, 0xE8B0, 0xE8AE, 0xE0AE, 0xE0AC, 0xC8AE, 0x0000, 0xE8AA,
-    0xE0A8, 0xD127, 0xE108, 0xE965, 0xE9C5, 0xEA85, 0xF265, 0xF365,
-    0xF485, 0xFD65, 0xFD85, 0xFE65, 0xF665, 0x62A3, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x9AA3, 0x6E28, 0x6608, 0x8667,
-    0xA6C7, 0xD726, 0xCF26, 0xF725, 0xF725, 0xF485, 0xFD65, 0xFE65,
-    0xFC85, 0xF365, 0xFB65, 0x5084, 0xC165, 0xF285, 0xE165, 0xE145,
-    0xE108, 0xE108, 0xE8C8, 0xE0AA, 0xE0AC, 0xC88E, 0xE8AE, 0xC8B1,
-    0xE0AE, 0xE8B0, 0x988B, 0x0000, 0x0000, 0xB0B1, 0xA8D1, 0xB0B1,
-    0x78F1, 0x0000, 0x0000, 0x90D1, 0x78F1, 0x78F1, 0x6111, 0x6111,
-    0x0000, 0x0000, 0x4931, 0x78D1, 0x6111, 0x78F1, 0x0000, 0x0000,
-    0x0000, 0x90D1, 0xB0D1, 0x588B, 0x78D1, 0x78F1, 0x90D1, 0xE0B0,
-    0xC8B1, 0xE0B0, 0xE0AE, 0xE0AE, 0xE8AC, 0xE0AC, 0xE8AA, 0x988B,
-    0xE0A8, 0xE108, 0xC8AE, 0xE145, 0xE965, 0xE1A6, 0xEA65, 0xFB65,
-    0xF365, 0xF485, 0xFD65, 0xFE65, 0xFE65, 0xFF25, 0x62A3, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3222, 0x2D69, 0x6E28,
-    0x8667, 0xAEA7, 0xA6C7, 0xD726, 0xCF26, 0xFE65, 0x90C4, 0x0000,
-    0xFD65, 0xFD85, 0xFC65, 0xF485, 0xF365, 0xF265, 0xE9C5, 0xE9C5,
-    0xE0AC, 0x0000, 0xE0E7, 0xE0E7, 0xE0AA, 0xC88E, 0xC88A, 0xC8AE,
-    0xD0AE, 0xE0AE, 0xE8AE, 0xE0B0, 0xE0B0, 0x986B, 0x1842, 0xD0B1,
-    0xA8D1, 0x1842, 0x0000, 0x0000, 0x90D1, 0x90D1, 0x78F1, 0x90D1,
-    0x78F1, 0x0000, 0x0000, 0x1842, 0x78F1, 0x90D1, 0x608B, 0x0000,
-    0x78F1, 0x90D1, 0xB0D1, 0xA8B1, 0xB0D1, 0xC8B1, 0xA8B1, 0xD0B1,
-    0xE0B0, 0xE0B0, 0xE0AE, 0x5884, 0x0000, 0xE8AC, 0xE0AA, 0xE0AA,
-    0xE0C8, 0xE8E7, 0xE0E7, 0xE106, 0xE165, 0xC165, 0x0000, 0xF285,
-    0xF365, 0xFC85, 0xFC65, 0xF585, 0xFD65, 0xFE85, 0xFE65, 0x1822,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4DA8,
-    0x4DA8, 0x8667, 0x8667, 0xD726, 0xCF26, 0xF725, 0xCB84, 0xCD65,
-    0xFE65, 0xF685, 0xFD65, 0xFD85, 0xF465, 0xFC85, 0xF365, 0xF285,
-    0xE9C5, 0xD127, 0xE108, 0xE108, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0xC8B1, 0xE8AE, 0xC8B1, 0xE0B0, 0xE0B0, 0xE0B0,
-    0xC8B1, 0xD0B1, 0x0000, 0x0000, 0x0000, 0xA8B1, 0xB0D1, 0xA8D1,
-    0x90D1, 0x90F1, 0x0000, 0x0000, 0x0000, 0x88D1, 0x90D1, 0xB0D1,
-    0xA8B1, 0xB0D1, 0x88D1, 0xD0B1, 0xA8D1, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x608B, 0xE0B0, 0xC88E, 0x1842, 0xE8AC, 0xE0AA,
-    0xE0C8, 0xE108, 0xE0E7, 0xE906, 0xE165, 0xE9C5, 0xE1C6, 0xE1A6,
-    0x986B, 0xFC65, 0xF485, 0xFD65, 0xFD65, 0xFE65, 0xFE85, 0xF725,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x2D49, 0x4DA8, 0x6E28, 0x8667, 0xAEC7, 0xD726, 0xCF26, 0xFE65,
-    0xFD65, 0xF725, 0xFE65, 0xFE65, 0xF565, 0xFC85, 0xF365, 0xF365,
-    0xF265, 0xEA85, 0xE1A6, 0xE108, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0xE8AC, 0xE0AC, 0x0000, 0x0000, 0x588B,
-    0xC8B1, 0xE8B0, 0xA8B1, 0x0000, 0x0000, 0x0000, 0xA8D1, 0xB0B1,
-    0xA8D1, 0xB0B1, 0x90D1, 0x0000, 0x0000, 0x0000, 0x88F1, 0xB0D1,
-    0xA8B1, 0x608B, 0x0000, 0x0000, 0xB0D1, 0xC8B1, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x986B, 0xE8AA, 0xE0AA,
-    0xE8AA, 0xE0C8, 0xE0A8, 0xE106, 0xE926, 0xE165, 0xE1A6, 0xF285,
-    0xEA85, 0xF265, 0xF365, 0xFC85, 0xF565, 0xFE85, 0xFE65, 0xF725,
-    0xFE65, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x4DA8, 0x4DA8, 0x6E08, 0x8667, 0xA6C7, 0xA6A7, 0xCF26,
-    0xD746, 0xF725, 0xF725, 0xF725, 0xF465, 0xFD85, 0xFD65, 0xFC85,
-    0xF365, 0xEA65, 0xF285, 0xEA85, 0xE945, 0xD927, 0x5084, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0xE0AA, 0xE8AE, 0x0000, 0x0000,
-    0x0000, 0x0000, 0xC8AE, 0xB0B1, 0x0000, 0x0000, 0x0000, 0xC8B1,
-    0xC8B1, 0xC8B1, 0xD0B1, 0xA8D1, 0x0000, 0x0000, 0x0000, 0x90D1,
-    0xA8D1, 0x0000, 0x0000, 0x0000, 0x0000, 0xC8B1, 0xE8B0, 0x608B,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x588B, 0xE0AE, 0xE0AC, 0xE0AC,
-    0xE8AA, 0xC8AE, 0xE0E7, 0xE106, 0xE906, 0xE165, 0xE145, 0xEA65,
-    0xF285, 0xF365, 0xF365, 0xFC65, 0xF465, 0xFE65, 0xFE65, 0xF725,
-    0xF725, 0xFE65, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x6CA6, 0x4DA8, 0x55A8, 0x8667, 0x8667, 0xA6C7,
-    0xAEA7, 0xF725, 0xD726, 0xF725, 0xFD65, 0x0000, 0xCC84, 0xFD65,
-    0xF485, 0xFC65, 0xF365, 0xF285, 0x0000, 0xE1A6, 0xE145, 0xE165,
-    0xE106, 0xE108, 0xE8C8, 0xE0A8, 0xE0C8, 0xE0AA, 0xC88E, 0x0000,
-    0x0000, 0x0000, 0x988B, 0xE8B0, 0x0000, 0x0000, 0x0000, 0x0000,
-    0xA8B1, 0xE0B0, 0xC8B1, 0xD0B1, 0xA8D1, 0x0000, 0x0000, 0x0000,
-    0x0000, 0xC8B1, 0x90D1, 0x0000, 0x0000, 0x0000, 0xC8B1, 0xE8B0,
-    0xC8B1, 0xE0B0, 0xE0AE, 0xE8AE, 0xE0AC, 0xE0AC, 0xE0AA, 0xE8AC,
-    0x0000, 0xE0AA, 0xE0C8, 0xE0E7, 0xE906, 0xE165, 0xE108, 0x0000,
-    0xD127, 0xF365, 0xFB65, 0xF485, 0xFC65, 0xFD85, 0xF565, 0xFE85,
-    0xFE65, 0xF725, 0xCB64, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x6E28, 0x2D49, 0x4DA8, 0x6628, 0x8667,
-    0xA6A7, 0xCF26, 0xD726, 0xF725, 0xF725, 0xF725, 0xFE65, 0xFE85,
-    0xFD65, 0xFD85, 0xFC65, 0xFC85, 0x1842, 0x0000, 0x0000, 0x0000,
-    0x988B, 0xE1A6, 0xD127, 0xE108, 0xE0C8, 0xE0AA, 0xE8AA, 0xE8AC,
-    0x0000, 0x0000, 0x588B, 0xE0AE, 0xE0AE, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0xE0B0, 0xE0B0, 0xE8B0, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0xC8B1, 0xE0B0, 0x5084, 0x0000, 0x0000, 0xE0B0,
-    0xE8AE, 0xE0B0, 0xE0AE, 0xE8AE, 0xC88E, 0xC8AE, 0x1842, 0x0000,
-    0x0000, 0x0000, 0x0000, 0xE108, 0xE926, 0xE1A6, 0xE145, 0xE1C5,
-    0xE9C5, 0xF265, 0xF365, 0xFC85, 0xF465, 0xFD85, 0xFD65, 0xFE65,
-    0xFE65, 0xF725, 0xF745, 0x9AA3, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0xA2A3, 0x2D49, 0x2D69, 0x55A8,
-    0x6E28, 0xA6A7, 0xA6C7, 0xD726, 0xCF26, 0xFF25, 0xF725, 0xF725,
-    0xFE65, 0xFE65, 0xFD65, 0xFD65, 0xCB84, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE0AC, 0xC88A, 0xE0C8,
-    0xE0AA, 0x0000, 0xC88A, 0xE0AC, 0xE8AC, 0x988B, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x588B, 0xD08E, 0x588B, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x90D1, 0xE8AE, 0xE0B0, 0x588B, 0x0000,
-    0xE8AE, 0xE0AE, 0xE0AC, 0x988B, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0xC88A, 0xE965, 0xE165, 0xE9C5,
-    0xE9C5, 0xF285, 0xEA65, 0xF365, 0xFC85, 0xFD65, 0xF585, 0xFE65,
-    0xFE65, 0xF725, 0xF725, 0xF725, 0x62A3, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3A42, 0x150A, 0x2D49,
-    0x4DA8, 0x6E28, 0x8667, 0xA6A7, 0xA6C7, 0xCE66, 0xCF26, 0xF725,
-    0xFE65, 0xF725, 0xFE65, 0xFE85, 0xFD85, 0x1842, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE108, 0xE8AA, 0xC88A,
-    0xE0C8, 0xE108, 0xE0AA, 0xE0AA, 0xE8AA, 0xE0AC, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE0B0, 0xE0AE, 0xE8AE,
-    0xC8B1, 0xE0AE, 0xE0AE, 0xE0AE, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE145, 0xE9C5,
-    0xE9C5, 0xF365, 0xF365, 0xFC65, 0xF485, 0xFD65, 0xFD65, 0xFE65,
-    0xFE65, 0xF725, 0xF725, 0xFF25, 0xD746, 0x3222, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x150A,
-    0x152A, 0x4DA8, 0x55A8, 0x6E28, 0x9CE5, 0x0000, 0x1822, 0xD746,
-    0xFD65, 0x0000, 0x0000, 0xFC65, 0xFE85, 0xFE65, 0xFC65, 0xF465,
-    0xF365, 0xF285, 0xD127, 0x90C4, 0x0000, 0x0000, 0xD127, 0xE108,
-    0xE906, 0xE106, 0xE0C8, 0xE8C8, 0xE0A8, 0xE0AA, 0xE0AA, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xC8AE, 0xE8AE,
-    0xE0AC, 0xE0AE, 0xE8AC, 0xE0AC, 0xE0AC, 0x588B, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x5884, 0xC88A, 0xE108, 0xE965, 0xD127, 0xE9C5,
-    0xE9C5, 0xE1A6, 0x588B, 0x0000, 0xC985, 0xFD85, 0xCA64, 0x0000,
-    0xCC64, 0xF725, 0xF725, 0xF725, 0xD746, 0xCF26, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x3549, 0x2D69, 0x2D49, 0x4DA8, 0x6608, 0x0000, 0x0000, 0x0000,
-    0xCF46, 0xF725, 0x62A3, 0xFD65, 0xFE65, 0xF725, 0xFE65, 0xFE65,
-    0xF585, 0xFD65, 0xFC85, 0xF365, 0xEA85, 0xF365, 0xE9C5, 0xE9C5,
-    0xE945, 0xE165, 0xE126, 0xE106, 0xE8E7, 0xE108, 0xE0AA, 0xE8AC,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xC8AE,
-    0x588B, 0xE0AE, 0xE8AC, 0xE0AC, 0xE0AA, 0xE108, 0xE0AA, 0xE8AC,
-    0xE0AA, 0xE108, 0xE0E7, 0xE106, 0xE906, 0xE165, 0xE145, 0xE9C5,
-    0xE9C5, 0xF365, 0xEA65, 0xCA64, 0x0000, 0xFB65, 0xFD85, 0xCA64,
-    0x0000, 0x0000, 0xCD65, 0xF725, 0xF725, 0xFF25, 0xCE66, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x55A8, 0x04EA, 0x2D69, 0x2D49, 0x6E28, 0x0000, 0x0000,
-    0x0000, 0xAEC7, 0xCF26, 0xFF25, 0xF725, 0xF725, 0xFE65, 0xFE65,
-    0xFD65, 0xFD65, 0xF485, 0xFC65, 0xF365, 0xF365, 0xF285, 0xEA65,
-    0xE9C5, 0xE9C5, 0xE145, 0xE165, 0xE106, 0xE106, 0x988B, 0xE8C8,
-    0x5084, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0xA06B, 0xE8AC, 0x0000, 0xE0AA, 0xE0C8, 0xE0AA, 0xE8A8, 0xE0C8,
-    0xE0A8, 0xE0E7, 0xE8E7, 0xE106, 0xE126, 0xE165, 0xE945, 0xE9C5,
-    0xE9C5, 0xEA85, 0xEA85, 0xF365, 0xFB65, 0xF465, 0xFC85, 0xFD65,
-    0x0000, 0x0000, 0x0000, 0x5084, 0xF725, 0xFF25, 0xCF46, 0xCD65,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x6CA6, 0x152A, 0x150A, 0x2D69, 0x9CE5, 0x0000,
-    0x0000, 0x0000, 0x9AA3, 0xCF26, 0xCF26, 0xFF25, 0xF725, 0xF725,
-    0xCB84, 0x9AA3, 0xFE85, 0xF565, 0xFC85, 0xFD65, 0xF485, 0xF365,
-    0xF265, 0xF365, 0xF285, 0xF285, 0xE1A6, 0xE9C5, 0xD127, 0xE108,
-    0xE108, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0xE0AA, 0xD0AE, 0x986B, 0xE0AA, 0xE0C8, 0xE0E7,
-    0xE8E7, 0xE126, 0xE106, 0xE145, 0xE145, 0xE9C5, 0xE9C5, 0xEA85,
-    0xF265, 0xEA85, 0xF265, 0xF365, 0xF365, 0xFD85, 0xFD65, 0xFD85,
-    0xCC64, 0x0000, 0x0000, 0x0000, 0x0000, 0xF725, 0xD726, 0xCF26,
-    0xCB84, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x3222, 0x04EA, 0x152A, 0x150A, 0x9CE5,
-    0x0000, 0x0000, 0x0000, 0xAEC7, 0xA6C7, 0xD726, 0xCF26, 0xCC64,
-    0x0000, 0x0000, 0xCC64, 0xFE85, 0xFD65, 0xFD65, 0xF485, 0xFC65,
-    0xF365, 0xF365, 0xF285, 0xEA65, 0xE1A6, 0xF285, 0xE9C5, 0x0000,
-    0xE108, 0xE108, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0xE0AA, 0xE0AA, 0x0000, 0xE0A8, 0xE8E7,
-    0xE0E7, 0xE106, 0xE126, 0xE965, 0xE108, 0xE9C5, 0xE9C5, 0xEA85,
-    0xEA65, 0xF365, 0xF285, 0x0000, 0x0000, 0xCA64, 0xFC65, 0xF585,
-    0xFD65, 0xFE85, 0x0000, 0x0000, 0x0000, 0x62A3, 0xCF26, 0xCF26,
-    0xA6A7, 0x5864, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x152A, 0x04EA, 0x150A,
-    0x64A6, 0x0000, 0x0000, 0x0000, 0x8667, 0xA6A7, 0xA6C7, 0xCE86,
-    0x0000, 0x0000, 0xCB64, 0xF725, 0xFE85, 0xF725, 0xCA64, 0xCA64,
-    0xFD65, 0xFD85, 0xFC85, 0xF365, 0x0000, 0xCA64, 0xF285, 0xE9C5,
-    0xD127, 0xF1C5, 0x1842, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x5084, 0xE908, 0x5084, 0xC88A,
-    0xE906, 0xE108, 0x5084, 0xE165, 0xE145, 0xE9C5, 0xE9C5, 0xE9A6,
-    0xD127, 0xF365, 0xF365, 0xF485, 0xF265, 0x0000, 0x0000, 0xCB84,
-    0xFD65, 0xFF25, 0xFE85, 0x0000, 0x0000, 0x0000, 0x3222, 0xCF26,
-    0xAEC7, 0xA6C7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x150A, 0x04EA,
-    0x04EA, 0x6CA6, 0x0000, 0x0000, 0x0000, 0x8667, 0x8667, 0xA6C7,
-    0xA6C7, 0xD464, 0xCB84, 0xF725, 0xF725, 0xFF25, 0xCC64, 0x0000,
-    0xFC85, 0xF565, 0xFC85, 0xC165, 0x0000, 0xCA64, 0xF365, 0xF365,
-    0xF285, 0xF265, 0xE1A6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE108, 0xE165,
-    0xE108, 0xE145, 0xE165, 0xC0C6, 0x0000, 0xC0C6, 0xE9C5, 0xF285,
-    0xE1A6, 0x0000, 0xF285, 0xF465, 0xFC85, 0xF565, 0x5084, 0xCA64,
-    0xFD85, 0xFE65, 0xFE65, 0xFE65, 0x0000, 0x0000, 0x0000, 0x9CE5,
-    0xA6C7, 0xA6A7, 0x9CE5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4DA8,
-    0x04EA, 0x4DA8, 0x6CA6, 0x9AA3, 0x0000, 0x0000, 0x1822, 0x8667,
-    0x8667, 0xD686, 0xCE66, 0xCF26, 0xD746, 0xF725, 0xCB84, 0x0000,
-    0x90C4, 0xF725, 0xFE65, 0x0000, 0x0000, 0xF365, 0xFC85, 0xF465,
-    0xFB65, 0xCA64, 0xF285, 0xD127, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD127,
-    0xE165, 0xE1A6, 0xE1A6, 0xE9C5, 0xE9C5, 0xD127, 0x0000, 0x0000,
-    0xF285, 0xFB65, 0x5084, 0x0000, 0xCA64, 0xF565, 0xFD65, 0xFE85,
-    0xFC65, 0xFD85, 0xF725, 0xF725, 0xCC64, 0x0000, 0x0000, 0x0000,
-    0xD565, 0xD686, 0x8667, 0x9CE5, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x3A42, 0x04EA, 0x152A, 0x6AA3, 0x64A6, 0x0000, 0x0000, 0x0000,
-    0x9CE5, 0x8667, 0x8667, 0xAEC7, 0xA6A7, 0xD726, 0xCC64, 0xCD85,
-    0xFE65, 0xF725, 0xFE65, 0xFE65, 0xCB84, 0xFD65, 0xFD85, 0xF565,
-    0xC165, 0x0000, 0xFB65, 0xF365, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0xE9C5, 0xE1A6, 0x0000, 0x988B, 0xF285, 0xF285, 0xEA65,
-    0x0000, 0xF365, 0xF365, 0xFC85, 0xF365, 0x0000, 0x986B, 0xFD85,
-    0xFE65, 0xF725, 0xFE65, 0xF725, 0xFE65, 0x0000, 0x0000, 0x0000,
-    0xCC64, 0xCC84, 0x8667, 0x8667, 0x5064, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x04EA, 0x04EA, 0x62A3, 0x6CA6, 0x2D49, 0x6E08,
-    0x0000, 0x8667, 0x6628, 0x8667, 0x8667, 0xA6A7, 0xD686, 0xCF26,
-    0xCF26, 0xF725, 0xFE65, 0x0000, 0xFD65, 0xF725, 0xFE85, 0xF465,
-    0x0000, 0x0000, 0xFD85, 0xFD85, 0xA06B, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x90C4, 0xF365, 0xEA85, 0x0000, 0x0000, 0xFB65,
-    0xF365, 0xFC65, 0xFC85, 0x5064, 0xF365, 0xFE85, 0xF565, 0xFE65,
-    0xFD85, 0xFF25, 0xF725, 0xF725, 0xF725, 0xFF25, 0x0000, 0x62A3,
-    0xCC64, 0xD585, 0x5884, 0x8667, 0x6E28, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x2D69, 0x04EA, 0x4DA8, 0x0000, 0x6CA6,
-    0x34C8, 0x2D49, 0x2D69, 0x6AA3, 0x0000, 0xA2A3, 0x0000, 0xA6C7,
-    0xAEC7, 0xCF26, 0xCD65, 0x0000, 0x0000, 0xFD65, 0xFE85, 0x62A3,
-    0x0000, 0x3222, 0xFD65, 0xFD85, 0xCB84, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0xE9A6, 0xF365, 0xFB65, 0x1842,
-    0x0000, 0x90C4, 0xFC85, 0xFC85, 0x0000, 0x0000, 0xCC64, 0xFE85,
-    0xFE65, 0xF665, 0x9AA3, 0x9AA3, 0x0000, 0x3242, 0xD726, 0xCF26,
-    0xCD65, 0x9CE5, 0x0000, 0xA2A3, 0x4DA8, 0x6E28, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x34C8, 0x04EA, 0x0D2A, 0x0000,
-    0x0000, 0x6CA6, 0x150A, 0x9CE5, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x8667, 0xA6A7, 0xA6C7, 0x0000, 0x0000, 0xF725, 0xFE65, 0x0000,
-    0x0000, 0x1842, 0xFE65, 0xFE65, 0xFD85, 0xF465, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFB65, 0xF365, 0xF365,
-    0xFC85, 0x62A3, 0x0000, 0x0000, 0xF465, 0xFD65, 0x0000, 0x0000,
-    0xFE65, 0xFF25, 0xFF25, 0x0000, 0x0000, 0x0000, 0x0000, 0x9CE5,
-    0xA6C7, 0xCD85, 0x0000, 0x0000, 0xA4E5, 0x4DA8, 0x64A6, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x04EA, 0x04EA,
-    0x0000, 0x2D49, 0x04EA, 0x6CA6, 0x0000, 0x0000, 0x0000, 0x0000,
-    0xA4E5, 0x8667, 0x8667, 0x9CE5, 0x0000, 0xD746, 0xCE66, 0x0000,
-    0x0000, 0x0000, 0xFD65, 0xF725, 0xFE85, 0xF725, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1822, 0xFD85,
-    0xFC65, 0xCC84, 0xFC65, 0x5084, 0x0000, 0x0000, 0xFD85, 0xFE65,
-    0x0000, 0x9AA3, 0xFF25, 0xF725, 0xCD85, 0x0000, 0x0000, 0x0000,
-    0x0000, 0xCC64, 0x8667, 0x8667, 0x0000, 0x6E28, 0x2D49, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2D69,
-    0x04EA, 0x150A, 0x152A, 0x2D49, 0x6AA3, 0x0000, 0x0000, 0x0000,
-    0x1842, 0x4DA8, 0x6E28, 0x8667, 0x9AA3, 0xA6A7, 0xA6C7, 0x0000,
-    0x0000, 0x0000, 0xD686, 0xF725, 0xF725, 0xF725, 0xF465, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0xCC64, 0xFE85, 0xFD65, 0xFE65, 0xFD65, 0x0000, 0x0000, 0x0000,
-    0xFE65, 0xF725, 0x0000, 0xF725, 0xCF46, 0xFF25, 0xCB64, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x8E67, 0x4DA8, 0x6E28, 0x2D69, 0x4DA8,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x3CC8, 0x04EA, 0x04EA, 0x6CA6, 0x150A, 0x04EA, 0x152A, 0x4DA8,
-    0x6CA6, 0x2D49, 0x2D69, 0x0000, 0x55A8, 0x6E28, 0x9CE5, 0x0000,
-    0x0000, 0x0000, 0xCC64, 0xD726, 0xCF26, 0xF725, 0xD686, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0xFD65, 0xFE65, 0xFE65, 0xF725, 0xF465, 0x0000,
-    0x0000, 0x0000, 0xFD85, 0xF725, 0xCF26, 0xCC64, 0xCD85, 0xA6C7,
-    0xD565, 0x9CE5, 0x9CE5, 0x6E28, 0x6608, 0x3222, 0x2D69, 0x2D49,
-    0xA2A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x04EA, 0x152A, 0x34C8, 0x150A, 0x6CA6, 0x4DA8,
-    0x6CA6, 0x152A, 0x0D0A, 0x0000, 0x6AA3, 0x55A8, 0x4DA8, 0x6E08,
-    0x8667, 0xA6C7, 0xA6A7, 0xA6C7, 0xA6A7, 0xCF26, 0xCF46, 0xCC64,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0xFC65, 0xF725, 0xFF25, 0xF725, 0xF725,
-    0xFE65, 0xFE65, 0xCE86, 0xD666, 0xCF26, 0xCF26, 0xD686, 0x0000,
-    0xA6C7, 0x8667, 0xA2A3, 0x8667, 0x6608, 0x6E28, 0xA4E5, 0x2D69,
-    0x152A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x150A, 0x04EA, 0x0000, 0x34C8, 0x6AA3,
-    0x6CA6, 0x152A, 0x04EA, 0x6CA6, 0x0000, 0x2D49, 0x2D69, 0x4DA8,
-    0x55A8, 0x6E28, 0x6E08, 0x8667, 0x8667, 0xA6C7, 0xA6A7, 0xD686,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF725, 0xFF25, 0xF725,
-    0xCF26, 0xF725, 0xD726, 0xCF26, 0xA6A7, 0xCF26, 0xA6C7, 0xA6A7,
-    0x0000, 0xA2A3, 0x6628, 0x6E28, 0x9CE5, 0x6CA6, 0x64A6, 0x3222,
-    0x150A, 0x55A8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x6AA3, 0x04EA, 0x2D69, 0x2D49,
-    0x2D69, 0x150A, 0x04EA, 0x2D69, 0x0000, 0x2D49, 0x150A, 0x6E28,
-    0x64A6, 0x6E08, 0x9CE5, 0x6E28, 0x6E28, 0x8667, 0x8667, 0xA6C7,
-    0x5864, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9AA3, 0xF725,
-    0xCF26, 0xF725, 0xD726, 0xCF46, 0xCD65, 0xCC84, 0xD565, 0xCD65,
-    0x8667, 0xAEC7, 0x0000, 0x6E28, 0x4DA8, 0x4DA8, 0x6CA6, 0x55A8,
-    0x04EA, 0x150A, 0x3242, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x04EA, 0x04EA,
-    0x04EA, 0x04EA, 0x04EA, 0x3A22, 0x6CA6, 0x2D69, 0x04EA, 0x2D49,
-    0x34C8, 0x6CA6, 0x152A, 0x2D49, 0x2D69, 0x55A8, 0x4DA8, 0x6E28,
-    0xA4E5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0xCD65, 0xD726, 0xA6C7, 0xA6A7, 0xA6C7, 0xA6A7, 0x8667, 0x9CE5,
-    0x9CE5, 0x6E28, 0x4DA8, 0xA4E5, 0x64A6, 0x6CA6, 0x2D49, 0x150A,
-    0x04EA, 0x04EA, 0x34C8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x34C8,
-    0x04EA, 0x04EA, 0x34C8, 0x6CA6, 0x6AA3, 0x0D2A, 0x04EA, 0x6CA6,
-    0x6AA3, 0x04EA, 0x04EA, 0x150A, 0x152A, 0x2D49, 0x2D49, 0x4DA8,
-    0x6E28, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0xA6A7, 0xA6C7, 0x8667, 0xAEA7, 0x8667, 0x8667,
-    0x6628, 0x6E28, 0x9CE5, 0x6AA3, 0x2D49, 0x2D69, 0x6CA6, 0x62A3,
-    0x6CA6, 0x04EA, 0x04EA, 0x6AA3, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x150A, 0x04EA, 0x0000, 0x3CC8, 0x4DA8, 0x04EA, 0x152A,
-    0x6CA6, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x150A,
-    0x2D69, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x8667, 0x8667, 0x6E28, 0x6E08,
-    0x4DA8, 0x55A8, 0x2D49, 0x2D69, 0xA2A3, 0x4DA8, 0x04EA, 0x4DA8,
-    0x6CA6, 0x6CA6, 0x04EA, 0x2D69, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x2042, 0x04EA, 0x150A, 0x2D69, 0x04EA, 0x150A,
-    0x34C8, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA,
-    0x150A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6E28, 0x4DA8,
-    0x55A8, 0x55A8, 0x2D69, 0x2D49, 0x152A, 0x150A, 0x2D69, 0x2D49,
-    0x04EA, 0x152A, 0x04EA, 0x150A, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x34C8, 0x04EA, 0x04EA, 0x04EA,
-    0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA,
-    0x152A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x6CA6, 0x2D49, 0x152A, 0x150A, 0x152A, 0x150A, 0x04EA, 0x04EA,
-    0x152A, 0x04EA, 0x04EA, 0x04EA, 0x3CC8, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x34C8, 0x04EA,
-    0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA,
-    0x2D69, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x6CA6, 0x150A, 0x04EA, 0x04EA, 0x04EA, 0x04EA,
-    0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x34C8, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x3CC8, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x150A,
-    0x6AA3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x6AA3, 0x0D2A, 0x04EA, 0x04EA,
-    0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x34C8, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x3222, 0x3CC8, 0x04EA, 0x152A, 0x34C8, 0x6CA6,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6CA6,
-    0x2D49, 0x2D69, 0x150A, 0x2D69, 0x3A22, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000 },
-  { 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x34C8, 0x152A, 0x150A,
-    0x152A, 0x34C8, 0x3A22, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3A42, 0x4DA8,
-    0x2D49, 0x2D69, 0x3CC8, 0x34C8, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3CC8, 0x04EA, 0x04EA,
-    0x04EA, 0x04EA, 0x04EA, 0x2D69, 0x34C8, 0x3222, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x62A3, 0x6CA6, 0x55A8,
-    0x152A, 0x04EA, 0x04EA, 0x04EA, 0x150A, 0x55A8, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x150A, 0x04EA, 0x04EA,
-    0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x152A,
-    0x3CC8, 0x3222, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x3A42, 0x9CE5, 0x6E28, 0x2D49, 0x2D49,
-    0x152A, 0x150A, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x2D69,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x150A, 0x04EA, 0x04EA,
-    0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA,
-    0x04EA, 0x04EA, 0x04EA, 0x2D49, 0x64A6, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x9CE5, 0xAEC7, 0x8667, 0x8667, 0x6E08, 0x6E28,
-    0x4DA8, 0x55A8, 0x2D69, 0x150A, 0x04EA, 0x04EA, 0x04EA, 0x04EA,
-    0x04EA, 0x55A8, 0x0000, 0x0000, 0x0000, 0x3A42, 0x04EA, 0x04EA,
-    0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA,
-    0x04EA, 0x04EA, 0x04EA, 0x150A, 0x152A, 0x2D49, 0x2D69, 0xA4E5,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0xCD65, 0xA6C7, 0xA6C7, 0xAEA7, 0xA6C7, 0x8667, 0x8667,
-    0x6E08, 0x4DA8, 0x2D49, 0x2D69, 0x150A, 0x152A, 0x04EA, 0x04EA,
-    0x04EA, 0x04EA, 0x04EA, 0x3A22, 0x0000, 0x0000, 0x150A, 0x04EA,
-    0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA,
-    0x04EA, 0x04EA, 0x04EA, 0x152A, 0x150A, 0x55A8, 0x4DA8, 0x6E08,
-    0x6628, 0x8667, 0x9CE5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0xCD65, 0xFF25, 0xCF26, 0xCF26, 0xCF26, 0xD726, 0xA6C7, 0xAEA7,
-    0x8667, 0x8667, 0x6E28, 0x6E28, 0x4DA8, 0x55A8, 0x2D49, 0x0D2A,
-    0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x6CA6, 0x0000, 0x1842, 0x152A,
-    0x04EA, 0x04EA, 0x150A, 0x0000, 0x2D69, 0x04EA, 0x04EA, 0x04EA,
-    0x04EA, 0x04EA, 0x04EA, 0x150A, 0x152A, 0x2D49, 0x3569, 0x55A8,
-    0x6E28, 0x8667, 0x8667, 0xA6A7, 0xA6C7, 0xD565, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFC65,
-    0xFE85, 0xF725, 0xF725, 0xF725, 0xCF26, 0xFF25, 0xCF26, 0xCF26,
-    0xA6A7, 0xA6C7, 0x8667, 0x8667, 0x6E08, 0x6E28, 0x2D49, 0x2D49,
-    0x152A, 0x6CA6, 0x0000, 0x04EA, 0x04EA, 0x2D49, 0x1842, 0x34C8,
-    0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x3CC8, 0x4DA8, 0x2D49, 0x04EA,
-    0x04EA, 0x55A8, 0x3242, 0x2D49, 0x6CA6, 0x6E08, 0x4DA8, 0x6E28,
-    0x6608, 0x8667, 0x8667, 0xA6C7, 0xA6A7, 0xD726, 0xCF46, 0xF725,
-    0xCC64, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF365, 0xFE65,
-    0xFE65, 0xF725, 0xF725, 0xFF25, 0xF725, 0xF725, 0xF725, 0xFF25,
-    0xCF26, 0xD726, 0xA6A7, 0xA6C7, 0x8667, 0x9CE5, 0x6E08, 0x6E28,
-    0x55A8, 0x4DA8, 0x64A6, 0x6CA6, 0x04EA, 0x04EA, 0x152A, 0x6CA6,
-    0x152A, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x150A, 0x04EA, 0x0000,
-    0x2D69, 0x04EA, 0x3CC8, 0x0000, 0x6CA6, 0x6E28, 0x0000, 0x9CE5,
-    0x6E08, 0x8667, 0x8667, 0xA6C7, 0xA6A7, 0xD726, 0xCF26, 0xD726,
-    0xCF26, 0xF725, 0xFE65, 0xCB84, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCA64, 0xFC65, 0xFD85,
-    0xF565, 0xFE85, 0xFE65, 0xFE65, 0xF665, 0xF725, 0xFE65, 0xF725,
-    0xCF26, 0xFF25, 0x62A3, 0x0000, 0xCD65, 0xCD65, 0x0000, 0x8667,
-    0x6E28, 0x6E28, 0x9AA3, 0x2D49, 0x152A, 0x150A, 0x04EA, 0x04EA,
-    0x6CA6, 0x2D69, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x0000, 0x3CC8,
-    0x04EA, 0x04EA, 0x04EA, 0x2D49, 0x0000, 0x3222, 0x6E28, 0x0000,
-    0x0000, 0x8667, 0x8667, 0xA6A7, 0x9CE5, 0xCF26, 0xCF26, 0xF725,
-    0xFF25, 0xF725, 0xF725, 0xF725, 0xFE65, 0xFE85, 0x9AC3, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x90C4, 0xFC65, 0xF485, 0xFC65,
-    0xF485, 0xFD65, 0xFD65, 0xFE65, 0xFE85, 0xF725, 0xFD65, 0xCD65,
-    0xF725, 0xFF25, 0xFE85, 0x0000, 0xCB64, 0xD686, 0x0000, 0x1842,
-    0x8667, 0x8667, 0x6E08, 0x6E28, 0x1842, 0x6E28, 0x150A, 0x152A,
-    0x04EA, 0x4DA8, 0x150A, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x55A8,
-    0x0000, 0x6AA3, 0x04EA, 0x0D2A, 0x150A, 0x2D69, 0x55A8, 0x4DA8,
-    0xA4E5, 0x0000, 0x9CE5, 0x9CE5, 0xAEC7, 0xCF26, 0xCC64, 0xCD65,
-    0xD746, 0xF725, 0xF725, 0xFF25, 0xFE65, 0xFE65, 0xF565, 0xFE65,
-    0xFC65, 0x1842, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x1842, 0xF285, 0xFB65, 0xF365, 0xF365,
-    0xF365, 0xFC65, 0xFC85, 0xF565, 0xFD85, 0xFE65, 0xF365, 0xFC65,
-    0xF685, 0xFD65, 0xCC64, 0xFD85, 0x0000, 0xFE65, 0xCE86, 0xCD65,
-    0xA6C7, 0xA6A7, 0x8667, 0x8667, 0x0000, 0x0000, 0x64A6, 0x2D49,
-    0x152A, 0x150A, 0x34C8, 0x2D69, 0x04EA, 0x04EA, 0x04EA, 0x04EA,
-    0x150A, 0x55A8, 0x6CA6, 0x2D69, 0x150A, 0x2D69, 0x2D49, 0x55A8,
-    0x4DA8, 0x8667, 0x9CE5, 0x9CE5, 0x0000, 0xCF26, 0xCF26, 0xFF25,
-    0x0000, 0x9CE5, 0xF725, 0xF725, 0xFE65, 0xF725, 0xF665, 0xFE65,
-    0xFD85, 0xFD65, 0xF485, 0xCA64, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0xC165, 0xE9C5, 0xF285, 0xEA65, 0xFB65,
-    0xF365, 0xF485, 0xFC65, 0xF485, 0xFC65, 0xFD85, 0x5864, 0x62A3,
-    0xFE85, 0xFF25, 0x9AC3, 0x9AA3, 0xCB64, 0x9CE5, 0xF725, 0xFF25,
-    0xCF26, 0xD726, 0xA6C7, 0xA6A7, 0x8667, 0xA6C7, 0xA4E5, 0x55A8,
-    0x2D69, 0x2D49, 0x152A, 0x55A8, 0x2D49, 0x04EA, 0x04EA, 0x04EA,
-    0x04EA, 0x04EA, 0x152A, 0x55A8, 0x150A, 0x2D69, 0x6CA6, 0x64A6,
-    0x9CE5, 0x8667, 0x6E28, 0xAEA7, 0xA6C7, 0x0000, 0xD666, 0xCC64,
-    0xCE86, 0xFF25, 0xCE86, 0xFE65, 0x5064, 0xFE85, 0xFD65, 0xFD65,
-    0xFD85, 0xFD65, 0xFC85, 0xF465, 0xF365, 0xF285, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0xE0E8, 0xE165, 0xE9C5, 0xE9C5, 0xEA85,
-    0xF265, 0xEA85, 0xF265, 0xF365, 0xEA85, 0xCA64, 0xF365, 0xFB65,
-    0xFD65, 0xCD85, 0xCC64, 0xF365, 0x1842, 0xFF25, 0xF725, 0xF725,
-    0xD686, 0xCC64, 0x9AA3, 0xCE86, 0xA6C7, 0xA6C7, 0x9CE5, 0x6E08,
-    0x4DA8, 0x55A8, 0x2D49, 0x152A, 0x34C8, 0x4DA8, 0x04EA, 0x04EA,
-    0x04EA, 0x04EA, 0x04EA, 0x34C8, 0x6CA6, 0x2D49, 0x2D49, 0x6E28,
-    0x9CE5, 0x8667, 0x8667, 0xA6C7, 0x9AA3, 0xCF26, 0xD726, 0xF725,
-    0xCD65, 0x0000, 0xFE85, 0xF725, 0xFD65, 0xCA64, 0xFD85, 0x1842,
-    0xCC64, 0xFD85, 0xF465, 0xFC85, 0xF365, 0xF365, 0xF285, 0xEA85,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0xE906, 0xE106, 0xE165, 0xE145, 0xE9C5,
-    0xE9C5, 0xEA85, 0xF285, 0xE1A6, 0xE1A6, 0xF285, 0x90C4, 0xFC65,
-    0xF485, 0xFD65, 0x0000, 0xF485, 0xFD65, 0xFE65, 0xFE65, 0xFD65,
-    0xFE65, 0xFE85, 0xCC64, 0x9CE5, 0xCE66, 0xD726, 0xA6C7, 0x6AA3,
-    0x9CE5, 0x6E28, 0x55A8, 0x4DA8, 0x2D49, 0xA4E5, 0x3A42, 0x2D49,
-    0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x6CA6, 0x0000, 0x152A, 0x4DA8,
-    0x0000, 0x0000, 0x0000, 0xA2A3, 0x8667, 0x0000, 0xCD85, 0xD686,
-    0xCF26, 0xFF25, 0x0000, 0x0000, 0xFE65, 0xFE65, 0xF565, 0xFD65,
-    0xFD85, 0xF465, 0xFC85, 0xF465, 0xF365, 0xFB65, 0xEA85, 0xF265,
-    0xE9C5, 0xE9C5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0xE108, 0xE0E7, 0xE106, 0xE106, 0xE165,
-    0xE165, 0xE9C5, 0xE1A6, 0xE9C5, 0xE1A6, 0xF285, 0xF285, 0xF365,
-    0xF365, 0xFC85, 0x0000, 0x0000, 0xF465, 0xFE85, 0xFD65, 0xCC64,
-    0x0000, 0xF585, 0x0000, 0x0000, 0x0000, 0x9CE5, 0xA6C7, 0xD666,
-    0x0000, 0xA6C7, 0x6608, 0x6E28, 0x4DA8, 0x6E08, 0x1842, 0x0000,
-    0x34C8, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x2D49, 0x0000, 0x2D49,
-    0x55A8, 0x8667, 0x9CE5, 0xA6C7, 0xA6A7, 0xCF46, 0xCD65, 0xFF25,
-    0x62A3, 0xF725, 0xF725, 0xFE65, 0x0000, 0xF565, 0xFE65, 0xFE85,
-    0xFD65, 0xF485, 0xFB65, 0xF365, 0xEA65, 0xF365, 0xF285, 0xEA85,
-    0xE9C5, 0xF285, 0xE9C5, 0xE1A6, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0xE0AA, 0xE0C8, 0xE108, 0xE8E7, 0xE106,
-    0xE106, 0xE165, 0xE965, 0xE1A6, 0xE145, 0xE1C5, 0xE9C5, 0xF265,
-    0xF285, 0xF365, 0x0000, 0x0000, 0xF465, 0xFD85, 0xCB84, 0xF365,
-    0xFC65, 0xCB84, 0xF665, 0xFD85, 0xFD65, 0xCC84, 0xCC64, 0xD726,
-    0xD666, 0x0000, 0xA6C7, 0x8667, 0x6E08, 0x6E28, 0x6CA6, 0x0000,
-    0x0000, 0x0000, 0x152A, 0x04EA, 0x04EA, 0x150A, 0x152A, 0x2D49,
-    0x3569, 0x55A8, 0x4DA8, 0x8667, 0xA2A3, 0x9CE5, 0xA6C7, 0xD726,
-    0xCD65, 0xCC84, 0xCC64, 0xFE85, 0xFE65, 0xFC65, 0x5064, 0xFD85,
-    0xFD85, 0xFC65, 0xCA64, 0x0000, 0x0000, 0x0000, 0x0000, 0xEA85,
-    0xE9C5, 0xE9C5, 0xE145, 0xE145, 0xE106, 0xE108, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0xC8AA, 0x90E4, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0xA06B, 0xC88A, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0xE0AA, 0xE8C8, 0xE0C8, 0xE0A8, 0xE0C8,
-    0xE8A8, 0xE0E7, 0xE0C8, 0x0000, 0x0000, 0x0000, 0x0000, 0xD127,
-    0xE9C5, 0xF285, 0xE1A6, 0x0000, 0xF365, 0xFC85, 0xF365, 0xCA64,
-    0xFC65, 0xF585, 0xFD65, 0xFE85, 0xCB64, 0xFD85, 0xF725, 0xF725,
-    0xCF26, 0xCF26, 0xA6C7, 0xA6A7, 0x8667, 0x8667, 0x9CE5, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x6CA6, 0x04EA, 0x04EA, 0x152A, 0x2D49,
-    0x2D49, 0x6628, 0x6CA6, 0x8667, 0x8667, 0xA6A7, 0xA6C7, 0xCD85,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCD65, 0xFE65, 0xF585,
-    0xFD65, 0xCB84, 0x0000, 0xFC85, 0xF285, 0x0000, 0x0000, 0x0000,
-    0x1842, 0xE9C5, 0xE145, 0xE165, 0xE926, 0xE106, 0xE0E7, 0xE108,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE0AC, 0xE8AC, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0xE0AC, 0xE0AE, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0xE0AC, 0xE8AA, 0xE0AC, 0xE0AA, 0xE0AA,
-    0xE8A8, 0xE0C8, 0xE0C8, 0x0000, 0x0000, 0x0000, 0x0000, 0xE106,
-    0xE945, 0x0000, 0xE1A6, 0xEA85, 0xF285, 0xFB65, 0x90C4, 0x0000,
-    0x0000, 0x0000, 0x1842, 0x9AA3, 0xFD65, 0xFE65, 0xFE85, 0xF725,
-    0xFD65, 0xCD65, 0xD686, 0xD726, 0xA6A7, 0xA6C7, 0x8667, 0x6CA6,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2D49, 0x04EA, 0x152A,
-    0x2D49, 0x6E28, 0x0000, 0x0000, 0x0000, 0x0000, 0x6AA3, 0xD726,
-    0xCF26, 0x3222, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFC85,
-    0xFD65, 0xFD85, 0xF365, 0x0000, 0x0000, 0xF365, 0xF265, 0x0000,
-    0x0000, 0x0000, 0x5084, 0xE945, 0xE108, 0xD127, 0xE8E7, 0xE0E7,
-    0xE0C8, 0xE0AA, 0x0000, 0x0000, 0x0000, 0x0000, 0x986B, 0xE8AC,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x1842, 0xE8AE, 0x988B, 0x0000,
-    0x0000, 0x0000, 0x0000, 0xC88E, 0xE8AC, 0xE0AC, 0xE8AA, 0xE0AA,
-    0xE0AA, 0xE0AA, 0xE8AA, 0x0000, 0x0000, 0x0000, 0x0000, 0xE108,
-    0xE106, 0x5084, 0x0000, 0xE9C5, 0xE9C5, 0xF285, 0xE1A6, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFE85, 0xFE85, 0xCC64,
-    0x0000, 0x0000, 0x0000, 0x0000, 0xCE86, 0xCF26, 0xA6A7, 0xA6C7,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x34C8, 0x152A,
-    0x150A, 0x4DA8, 0x6628, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0xFF25, 0xF725, 0x9AA3, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0xF585, 0xFC65, 0xFC85, 0xC165, 0x0000, 0x0000, 0xF285,
-    0xE9C5, 0x988B, 0x0000, 0x0000, 0x1842, 0xE108, 0xE8AA, 0x986B,
-    0xE0C8, 0xE8AA, 0xE0AA, 0x986B, 0x0000, 0x0000, 0x0000, 0x0000,
-    0xE8AE, 0xC8AE, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD0B1, 0xC8B1, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x986B, 0xE0AE, 0xE0AE, 0xE8AC, 0xE0AE,
-    0xE0AC, 0xE0AC, 0xE8AC, 0x0000, 0x0000, 0x0000, 0x988B, 0xE108,
-    0xE0A8, 0x0000, 0x0000, 0xE108, 0xE165, 0xE9C5, 0xE9C5, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x90C4, 0xFD65, 0xCC64, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFE65, 0xD726, 0xCF26,
-    0x6AA3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x150A, 0x2D69, 0x2D49, 0x6E28, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x5864, 0xD585, 0xD585, 0xF725, 0xFF25, 0x9AA3, 0x0000, 0x0000,
-    0x5084, 0x5884, 0xFB65, 0xFC85, 0xF365, 0xF365, 0x90C4, 0x0000,
-    0x0000, 0xC965, 0xE165, 0xE108, 0x0000, 0x0000, 0x0000, 0xE8AA,
-    0xE0A8, 0xC88A, 0xC8AE, 0xE0AA, 0xE8AA, 0x0000, 0x0000, 0x0000,
-    0x0000, 0xA8D1, 0xC88E, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xC8AE, 0x986B,
-    0x0000, 0x0000, 0x0000, 0x1842, 0xE8AE, 0xE8AE, 0xE8AE, 0xE0AE,
-    0xC8AE, 0xE0AE, 0xE8AC, 0x0000, 0x0000, 0x0000, 0xC88A, 0xE0AA,
-    0x988B, 0x0000, 0x0000, 0xC0C6, 0xE906, 0xE165, 0xE145, 0xD127,
-    0x0000, 0x5884, 0x1842, 0x0000, 0xC985, 0xFC85, 0xFC65, 0xF485,
-    0xF365, 0x5064, 0x0000, 0x0000, 0x0000, 0x0000, 0xD686, 0xD746,
-    0xA6A7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x4DA8, 0x2D49, 0x4DA8, 0x6E28, 0x0000, 0x0000, 0x0000,
-    0x9CE5, 0xCD85, 0xCB84, 0x3222, 0x0000, 0xFE65, 0xFE65, 0xF665,
-    0xFD85, 0xFD65, 0xF485, 0xFC65, 0xF365, 0xF365, 0xF285, 0xF285,
-    0xE1C6, 0x0000, 0xE106, 0xE165, 0xE906, 0xE106, 0xE0C8, 0x0000,
-    0x0000, 0xC88A, 0xE0AA, 0xE8AC, 0xE0AC, 0xE0AC, 0xE0AC, 0x0000,
-    0x0000, 0x0000, 0x0000, 0xE8AE, 0xA08B, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x986B, 0xC8B1,
-    0x0000, 0x0000, 0x0000, 0x0000, 0xE0B0, 0xE0B0, 0xE0B0, 0xE0B0,
-    0xE0AE, 0xE0B0, 0xC8AE, 0x0000, 0x0000, 0xE0AC, 0xE8AC, 0xE0AC,
-    0xE8AA, 0x588B, 0x0000, 0xE0AA, 0xE0E7, 0xE926, 0xE106, 0xE145,
-    0xE145, 0xE9C5, 0xE9C5, 0xEA85, 0xF265, 0xF365, 0xFB65, 0x0000,
-    0xCB84, 0xFD85, 0xFD85, 0x9AA3, 0x0000, 0x0000, 0x1822, 0xF725,
-    0xD726, 0xCE86, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x6CA6, 0x4DA8, 0x55A8, 0x6E28, 0x6AA3, 0x0000,
-    0xCD65, 0xD686, 0x0000, 0x0000, 0x0000, 0x0000, 0xFD65, 0xFE65,
-    0xFD65, 0xF585, 0xFC65, 0xF485, 0xF365, 0xCA64, 0x1842, 0xC965,
-    0xE1A6, 0xE9C5, 0xE965, 0xE145, 0xC88A, 0x5084, 0xE8C8, 0xE0C8,
-    0xE8A8, 0xE0AC, 0x0000, 0x0000, 0xE0AC, 0xE0AC, 0xE8AC, 0xE0AE,
-    0xC8AE, 0x0000, 0x0000, 0x0000, 0xA8B1, 0xC8B1, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD0B1,
-    0x988B, 0x0000, 0x0000, 0x0000, 0xB0B1, 0xE0B0, 0xE0B0, 0xE0B0,
-    0xE0B0, 0xE0B0, 0x0000, 0x0000, 0xC8AE, 0xE8AE, 0xE0AC, 0xE0AC,
-    0x986B, 0xE8AC, 0xE0AA, 0xE0AA, 0xE8C8, 0xE0A8, 0xE0C8, 0xE0A8,
-    0xD127, 0xE965, 0xE145, 0xE9C5, 0xE9C5, 0xEA85, 0xF285, 0xC165,
-    0x0000, 0x0000, 0x0000, 0x9AA3, 0xFC85, 0x62A3, 0x0000, 0xCC84,
-    0xF725, 0xF725, 0xCD65, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x9CE5, 0x4DA8, 0x6E28, 0x6E28, 0xCD65,
-    0x3222, 0xCE86, 0x0000, 0x0000, 0x0000, 0x0000, 0xFC65, 0xF725,
-    0xFE85, 0xF565, 0xCB84, 0xFC85, 0xF465, 0xFC85, 0xFB65, 0xF285,
-    0x0000, 0x0000, 0x1842, 0xE165, 0xE906, 0xC88A, 0x0000, 0x0000,
-    0x988B, 0xE0AA, 0xE0AA, 0xE0AC, 0xE8AC, 0xC88E, 0xE0AE, 0xE0AE,
-    0xE8AE, 0xE8B0, 0x608B, 0x0000, 0x0000, 0x1842, 0xC8B1, 0x608B,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x588B,
-    0xB0D1, 0x0000, 0x0000, 0x0000, 0x1842, 0xE8B0, 0xC8B1, 0xE0B0,
-    0xE0B0, 0xE0B0, 0x1842, 0xE0B0, 0xE0B0, 0xE0B0, 0xE8AE, 0xC8B1,
-    0x0000, 0x0000, 0xE0AC, 0xE0AC, 0xE8AA, 0x988B, 0x0000, 0x0000,
-    0xE0AA, 0xE106, 0xE906, 0xE165, 0xE145, 0xE1A6, 0xF285, 0xF365,
-    0xF365, 0x0000, 0x0000, 0x0000, 0x0000, 0xCB84, 0xFC65, 0x0000,
-    0xFE65, 0xF725, 0xFF25, 0xCC84, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x6AA3, 0x4DA8, 0x4DA8, 0x8E67,
-    0x8667, 0xA6A7, 0x9CE5, 0x0000, 0x0000, 0x0000, 0x0000, 0xFE65,
-    0xFE65, 0xFE65, 0xCC64, 0xFC85, 0x0000, 0xC165, 0xF365, 0xFB65,
-    0xEA85, 0xE9C5, 0x5064, 0x0000, 0x98E4, 0xE906, 0xE0E7, 0xE0AA,
-    0x0000, 0x0000, 0x0000, 0xE0AC, 0xE8AC, 0xE0AC, 0xC8AE, 0xE0AE,
-    0xE8AE, 0xE0B0, 0xC8B1, 0xE0B0, 0x0000, 0x0000, 0x0000, 0xA8B1,
-    0xA8D1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x90D1, 0x90D1, 0x0000, 0x0000, 0x0000, 0xC8B1, 0xB0D1, 0xA8D1,
-    0xC8B1, 0xE8B0, 0xC8B1, 0xE0B0, 0xE0B0, 0xE0B0, 0xE0AE, 0x5884,
-    0x0000, 0x1842, 0xD08E, 0xE8AC, 0xE0AC, 0xC88A, 0x0000, 0x588B,
-    0xE8C8, 0xE0E7, 0xE0E7, 0xE906, 0xC0C6, 0xC0C6, 0xE108, 0xE9C5,
-    0xEA85, 0xF365, 0xF285, 0x0000, 0x0000, 0x0000, 0x0000, 0xF485,
-    0xCB84, 0xFE65, 0xF725, 0xF725, 0x5864, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4DA8, 0x6E28,
-    0x8667, 0xA6A7, 0xA6C7, 0x3222, 0x0000, 0x0000, 0x0000, 0x62A3,
-    0xFE65, 0xFE85, 0xFD65, 0xFC85, 0x5084, 0x0000, 0x0000, 0xC165,
-    0xF285, 0xF285, 0xE9C5, 0xE9C5, 0xC0C6, 0x986B, 0xE0E7, 0xE108,
-    0xE0C8, 0xE0AA, 0xE8AA, 0xA06B, 0x1842, 0xE0AE, 0xE8AE, 0x608B,
-    0x1842, 0xE0B0, 0xE0B0, 0xE0B0, 0xC8B1, 0xB0D1, 0x0000, 0x0000,
-    0x608B, 0xD0B1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x1842, 0xB0D1, 0x1842, 0x0000, 0x0000, 0x90D1, 0xA8B1, 0xB0D1,
-    0xA8B1, 0xC8B1, 0xD0B1, 0x78F1, 0xA8B1, 0xE0B0, 0xE0B0, 0x0000,
-    0x1842, 0xE0B0, 0xE8AE, 0xE0AE, 0xE0AC, 0xE8AE, 0x0000, 0x988B,
-    0xE0AA, 0xE0AA, 0xE8A8, 0xE8E7, 0x5084, 0x0000, 0x0000, 0xD127,
-    0xE1A6, 0xF285, 0xEA65, 0xF365, 0x0000, 0x0000, 0x0000, 0x0000,
-    0xCB84, 0xFE65, 0xFE65, 0xFF25, 0xF745, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6E08,
-    0x6E28, 0xA6A7, 0xA6C7, 0xD726, 0x1822, 0x0000, 0x0000, 0x0000,
-    0x0000, 0xFE85, 0xFD65, 0xFD65, 0xFC85, 0xF365, 0x5064, 0x0000,
-    0x0000, 0xC985, 0xE9C5, 0xE9C5, 0xE145, 0xE106, 0xE8E7, 0xE0E7,
-    0xE0C8, 0xE0AA, 0xE8C8, 0xE0AA, 0xE0AC, 0xE0AE, 0xE8AC, 0xE0AE,
-    0xE0AE, 0x0000, 0x0000, 0x588B, 0xE8B0, 0xE0B0, 0xC8B1, 0x0000,
-    0x0000, 0x0000, 0x88D1, 0x78F1, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x78D1, 0x78F1, 0x0000, 0x0000, 0x0000, 0x90D1, 0xB0D1,
-    0xA8B1, 0xB0D1, 0x588B, 0x0000, 0x0000, 0xD0B1, 0xC8B1, 0xC8B1,
-    0xC8B1, 0xE8B0, 0xE0AE, 0xE0B0, 0xC88E, 0xE8AE, 0xE0AC, 0xE0AE,
-    0xE0AC, 0xE8AC, 0xE0C8, 0xE0A8, 0x5084, 0x0000, 0x0000, 0x1842,
-    0xE908, 0xE9C5, 0xE9C5, 0xF285, 0xF285, 0x0000, 0x0000, 0x0000,
-    0x0000, 0xCA64, 0xF565, 0xFE85, 0xFE65, 0xF725, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x6628, 0x8667, 0xA6A7, 0xCF26, 0xCF46, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0xFC65, 0xFE65, 0xF585, 0xFD65, 0xFC85, 0xF465,
-    0xF285, 0xEA85, 0xC0C6, 0xE9C5, 0xE145, 0xE965, 0xE106, 0xE108,
-    0xE0C8, 0xE0AA, 0xE8AA, 0xE0AC, 0xE0AC, 0xE0AE, 0xE8AE, 0xE0AE,
-    0xE0AE, 0xE8B0, 0xC8B1, 0x0000, 0x0000, 0x608B, 0xC8B1, 0xC8B1,
-    0xB0B1, 0x0000, 0x0000, 0x78F1, 0x90D1, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x78F1, 0x4931, 0x0000, 0x0000, 0x78F1, 0x88F1,
-    0x90D1, 0xB0B1, 0x0000, 0x0000, 0x0000, 0xA8D1, 0xB0D1, 0xC8B1,
-    0xC8B1, 0xE0B0, 0xE0B0, 0xE0B0, 0xE0B0, 0xE0B0, 0xE0AE, 0xE0AE,
-    0xE0AC, 0xE8AE, 0xE0AC, 0xE0AC, 0xE0AA, 0x0000, 0xC88A, 0xE108,
-    0xE906, 0xE165, 0xE145, 0xE9C5, 0xE9C5, 0x9AA3, 0x0000, 0x0000,
-    0x0000, 0x0000, 0xCB84, 0xFE65, 0xFE65, 0xF725, 0xCE66, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x8667, 0x8667, 0xA6A7, 0xAEC7, 0xCF26, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0xFE65, 0xFD65, 0xFD65, 0xFC85, 0xF465,
-    0xF365, 0xF365, 0xE9C5, 0xE9C5, 0xE145, 0xE165, 0xE906, 0xE108,
-    0xE0C8, 0xE0A8, 0xE0C8, 0xE8AA, 0xE0AA, 0xE0AC, 0xE0AC, 0xE8AE,
-    0xE0AE, 0xE0B0, 0xE0AE, 0xE0B0, 0x588B, 0x0000, 0x0000, 0xD0B1,
-    0xA8B1, 0xB0D1, 0x190B, 0x0000, 0x0000, 0x78D1, 0x190B, 0x0000,
-    0x0000, 0x0000, 0x210B, 0x6111, 0x0000, 0x0000, 0x210B, 0x78F1,
-    0x78D1, 0x78F1, 0x6111, 0x0000, 0x0000, 0x78D1, 0x90D1, 0xB0D1,
-    0xA8D1, 0xD0B1, 0xC8B1, 0xC8B1, 0xC8B1, 0xE8B0, 0xE0AE, 0xE0B0,
-    0xE0AE, 0xE8AE, 0xE0AC, 0xE0AC, 0xE0AA, 0xE8AA, 0xE0A8, 0xE0C8,
-    0xE0A8, 0xE906, 0xE126, 0xE165, 0xE145, 0xE9C5, 0xE1A6, 0x0000,
-    0x0000, 0x0000, 0x0000, 0xFB85, 0xFD85, 0xF665, 0xFE65, 0xFC65,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x6CA6, 0xA6A7, 0xA6C7, 0xCF26, 0xCF26, 0xCD85,
-    0x0000, 0x0000, 0x0000, 0xF465, 0xFD85, 0xFC65, 0x0000, 0xCA64,
-    0xF365, 0xF365, 0xF285, 0xEA85, 0xE9C5, 0xE9C5, 0xE126, 0xE106,
-    0xE8E7, 0xE0E7, 0xE0A8, 0xE0AA, 0xE8AC, 0xE0AE, 0xE0AC, 0xE0AE,
-    0xE8AE, 0xE0B0, 0xE0B0, 0xE0B0, 0xE0B0, 0xE8B0, 0x1842, 0x0000,
-    0xA8D1, 0x90F1, 0x608B, 0x90D1, 0x0000, 0x0000, 0x4951, 0x6911,
-    0x0000, 0x0000, 0x0000, 0x6111, 0x4931, 0x0000, 0x0000, 0x6111,
-    0x6911, 0x0000, 0x6111, 0x78F1, 0x0000, 0x4931, 0x88F1, 0x90D1,
-    0x90D1, 0xA8D1, 0xB0B1, 0xC8B1, 0xC8B1, 0xE0B0, 0xE0B0, 0xE0B0,
-    0xE0B0, 0xE0B0, 0xE0AE, 0xE0AE, 0xE8AC, 0xE0AC, 0xE0AA, 0xE0AA,
-    0xE8C8, 0xE0E7, 0xE0E7, 0xE106, 0xC0C6, 0xD127, 0xE9C5, 0xF265,
-    0x1842, 0x0000, 0x0000, 0x0000, 0xFC85, 0xFD65, 0xF665, 0xFE85,
-    0x9AA3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x3222, 0x8667, 0xAEC7, 0xA6C7, 0xD726,
-    0xCF26, 0xFD65, 0x0000, 0x0000, 0xFC65, 0xF685, 0xC165, 0x0000,
-    0x0000, 0x0000, 0xE1A6, 0xF285, 0xE9C5, 0xE1A6, 0xE108, 0xE108,
-    0xE0A8, 0xC88A, 0x90E4, 0x1842, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x608B, 0xE8B0, 0xE0B0, 0xE0B0, 0xC8B1, 0xC8B1,
-    0x90D1, 0xB0D1, 0x0000, 0x0000, 0x78F1, 0x4931, 0x0000, 0x0000,
-    0x4931, 0x190B, 0x0000, 0x210B, 0x4951, 0x0000, 0x0000, 0x190B,
-    0x5131, 0x4951, 0x0000, 0x4931, 0x6911, 0x608B, 0x6111, 0x78F1,
-    0x78F1, 0x90D1, 0x90D1, 0x78F1, 0x1842, 0x0000, 0x0000, 0x0000,
-    0x1842, 0xA08B, 0xA06B, 0xC8B1, 0xC8B1, 0xE8AE, 0xE0AC, 0xE8AC,
-    0xE0AA, 0xE0AA, 0xE0C8, 0xE8A8, 0x0000, 0x0000, 0x0000, 0xE1A6,
-    0xE9C5, 0x90E4, 0x0000, 0x0000, 0xF285, 0xF485, 0xFC65, 0xFD85,
-    0xF665, 0x1842, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA6A7, 0xA6C7, 0xD726,
-    0xCF26, 0xF725, 0xF725, 0xF725, 0xFD65, 0xFE85, 0xF565, 0xFD85,
-    0xFC65, 0xF485, 0xFB65, 0xF365, 0xF285, 0xE9C5, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1842, 0xB0B1, 0xC8B1,
-    0xB0D1, 0xB0D1, 0x90D1, 0x1842, 0x0000, 0x78F1, 0x6911, 0x0000,
-    0x0000, 0x4931, 0x3191, 0x0000, 0x3191, 0x4951, 0x0000, 0x0000,
-    0x3191, 0x4931, 0x190B, 0x0000, 0x210B, 0x6111, 0x6111, 0x6111,
-    0x6911, 0x78F1, 0x190B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x1842, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0xC88A, 0xE0AA, 0xE8AA, 0xE0A8, 0xE108, 0xE108, 0xE165,
-    0xE145, 0xF285, 0xE1A6, 0xF265, 0xF365, 0xF485, 0xFC65, 0xFD85,
-    0xFD65, 0xFE65, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCD65, 0xD746,
-    0xCF26, 0xF725, 0xCF26, 0xFF25, 0xFE65, 0xFE65, 0xF565, 0xFD65,
-    0xFC85, 0xF465, 0xF365, 0xF365, 0xF285, 0xF265, 0xE145, 0xE108,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0xA8D1, 0x88D1, 0x90D1, 0x78F1, 0x0000, 0x190B, 0x6911,
-    0x190B, 0x0000, 0x2042, 0x3191, 0x2991, 0x3191, 0x1842, 0x0000,
-    0x210B, 0x3191, 0x3191, 0x0000, 0x1842, 0x4931, 0x3191, 0x4951,
-    0x5131, 0x190B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0xE8AA, 0xE8AA, 0xE8C8, 0xE0C8, 0xE0A8, 0xE0E7,
-    0xE906, 0xE165, 0xE165, 0xF285, 0xEA65, 0xF365, 0xFB65, 0xF485,
-    0xFC65, 0xFD85, 0xCC64, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCD65,
-    0xA6C7, 0xF725, 0xF725, 0xFF25, 0xF725, 0xF725, 0xF665, 0xFE65,
-    0xFD85, 0xFC65, 0xF365, 0xF365, 0xEA85, 0xF285, 0xE1A6, 0xE9C5,
-    0xE965, 0xA06B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x78F1, 0x78D1, 0x78F1, 0x6111, 0x0000,
-    0x4931, 0x4931, 0x0000, 0x3191, 0x3191, 0x3191, 0x2991, 0x2212,
-    0x0000, 0x2212, 0x3191, 0x2212, 0x0000, 0x3191, 0x3191, 0x4931,
-    0x2991, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0xC88E, 0xE0AC, 0xE0AA, 0xE8AC, 0xE0C8, 0xE0E7,
-    0xE0E7, 0xE106, 0xE145, 0xE9C5, 0xE9C5, 0xF285, 0xEA65, 0xF365,
-    0xFC85, 0xFD65, 0xF585, 0xCB84, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x5864, 0xD746, 0xCF26, 0xF725, 0xFF25, 0xF725, 0xFE65, 0xFE65,
-    0xFD65, 0xF585, 0xCA64, 0x0000, 0xC165, 0xFB65, 0xE9C5, 0xE9C5,
-    0xE145, 0xE165, 0xE0E7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6111, 0x6111, 0x6111,
-    0x4931, 0x190B, 0x3191, 0x2042, 0x3191, 0x2212, 0x2991, 0x2212,
-    0x21F2, 0x2042, 0x2212, 0x2212, 0x0000, 0x21F2, 0x3191, 0x2991,
-    0x09EE, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x2042, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x608B, 0xE8AE, 0xE0AC, 0xE8AC, 0xE0AA, 0xE0AA,
-    0xE0C8, 0x988B, 0x5884, 0xE945, 0xE165, 0xE9C5, 0xE9C5, 0xF285,
-    0xF365, 0xF465, 0xFC85, 0xFD65, 0x1842, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0xD666, 0xF725, 0xF725, 0xF725, 0xF725, 0xF725,
-    0xFE65, 0xFE85, 0xFD65, 0xF485, 0xF265, 0xF365, 0xEA85, 0xF285,
-    0xE9C5, 0xE9A6, 0xE108, 0xE108, 0xE8C8, 0x1842, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6911,
-    0x4931, 0x4931, 0x3191, 0x2212, 0x3191, 0x3242, 0x21F2, 0x1A53,
-    0x2212, 0x3A42, 0x1A53, 0x12B4, 0x210B, 0x12B4, 0x21F2, 0x1A53,
-    0x2212, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1842, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x608B, 0xE0B0, 0xC8AE, 0xE0AE, 0xE0AC, 0xE0AC,
-    0xE8C8, 0xE108, 0xE0AA, 0xD127, 0xE106, 0xE1A6, 0xE9C5, 0xF265,
-    0xEA85, 0xFB65, 0xF365, 0xF465, 0xFC85, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0xCD65, 0xCF46, 0xFF25, 0xF725, 0xF725,
-    0xFD65, 0xCB84, 0xFD65, 0xFD85, 0xF465, 0xF365, 0xF285, 0xF265,
-    0xE9C5, 0xE1C5, 0xE145, 0xE108, 0xE0C8, 0xE8E7, 0xE0A8, 0xC88A,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x190B, 0x6111,
-    0x4951, 0x4931, 0x3191, 0x3191, 0x3191, 0x2212, 0x1842, 0x1A53,
-    0x1A53, 0x12B4, 0x2042, 0x12B4, 0x1AB4, 0x12B4, 0x1A53, 0x1AB4,
-    0x1A53, 0x1A53, 0x2212, 0x210B, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0xA06B, 0xE0B0, 0xE0AE, 0xA8D1, 0xD08E, 0xE0AC,
-    0xE8AA, 0xE0AA, 0xE0C8, 0xE0A8, 0xE8E7, 0xE106, 0xE165, 0xE1A6,
-    0xD127, 0xF285, 0xF285, 0xF365, 0xFC85, 0xCA64, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF725, 0xF725, 0xF725,
-    0xFE85, 0xCC84, 0x9AA3, 0xF365, 0xFC65, 0xFC85, 0xF365, 0xF365,
-    0xEA65, 0xF285, 0xE165, 0xE965, 0xE106, 0xE108, 0xE8A8, 0x1842,
-    0xE8AA, 0xE8AC, 0x608B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x1842, 0x78F1, 0x90D1, 0x78F1, 0x6111,
-    0x5131, 0x4931, 0x3191, 0x190B, 0x3191, 0x2212, 0x2212, 0x1AB4,
-    0x1A53, 0x12B4, 0x1AB4, 0x0B56, 0x1AB4, 0x1356, 0x0B56, 0x210B,
-    0x12B4, 0x12B4, 0x1A53, 0x1A53, 0x21F2, 0x2212, 0x3191, 0x210B,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x1842, 0xA8D1, 0xE0B0, 0xA8B1, 0xE0B0, 0xE8AE, 0xE0AE,
-    0xE0AC, 0xE0AC, 0xE8AA, 0xE0AA, 0xE0C8, 0xE108, 0xE106, 0xE965,
-    0xE906, 0x90E4, 0xE1A6, 0xF365, 0xF365, 0xF465, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCC64, 0xF725,
-    0xFF25, 0xF725, 0xFD65, 0xCA64, 0x0000, 0xCA64, 0xF365, 0xF365,
-    0xF285, 0xF265, 0xE9C5, 0xE145, 0x1842, 0xE106, 0xE8C8, 0xE0AA,
-    0x0000, 0x5084, 0xE8AA, 0xE0AC, 0xE8AE, 0xE0B0, 0xE0AE, 0xE0B0,
-    0xC8B1, 0xA8D1, 0xB0B1, 0xA8D1, 0xB0B1, 0x88D1, 0x78F1, 0x6111,
-    0x0000, 0x4931, 0x3191, 0x3191, 0x3191, 0x2212, 0x2212, 0x1A53,
-    0x12B4, 0x12B4, 0x1AB4, 0x0B56, 0x1356, 0x1356, 0x1356, 0x0B56,
-    0x1356, 0x1356, 0x12B4, 0x1AB4, 0x210B, 0x09EE, 0x2212, 0x2212,
-    0x3191, 0x3191, 0x2991, 0x4931, 0x210B, 0x190B, 0x210B, 0x78D1,
-    0x78F1, 0xB0B1, 0xB0D1, 0xC8B1, 0x0000, 0x0000, 0xE8AE, 0xE0AE,
-    0xE0AE, 0x986B, 0xE8AA, 0xE0AA, 0xE8C8, 0xE0A8, 0xE0C8, 0xE106,
-    0x0000, 0x988B, 0xC965, 0xE9C5, 0xF285, 0xF365, 0xE1A6, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0xFE65, 0xF725, 0xFE65, 0xFE65, 0xFD85, 0xCB84, 0xF465, 0xFC85,
-    0xF365, 0x9AA3, 0xF285, 0xE9C5, 0x5884, 0x0000, 0xC0C6, 0xE0E7,
-    0xE0C8, 0xE108, 0xE0AA, 0xE8AC, 0xE0AC, 0xE0AE, 0xE8AE, 0xE0B0,
-    0xE0B0, 0xE0B0, 0xB0B1, 0x78F1, 0xB0D1, 0x90D1, 0x0000, 0x0000,
-    0x0000, 0x1842, 0x5131, 0x4931, 0x3191, 0x2212, 0x2212, 0x09EE,
-    0x0000, 0x1356, 0x0B56, 0x1356, 0x1356, 0x0BF8, 0x0BD8, 0x0000,
-    0x0BF8, 0x0BD8, 0x1356, 0x0B56, 0x1AB4, 0x0333, 0x0000, 0x0000,
-    0x0000, 0x2212, 0x3191, 0x4951, 0x3191, 0x6111, 0x6111, 0x90D1,
-    0x88D1, 0xB0D1, 0xA8B1, 0xD0B1, 0xC8B1, 0xE0B0, 0xA8D1, 0xE0B0,
-    0xE8AE, 0x588B, 0x0000, 0x988B, 0xE8AA, 0xE0AA, 0xC88A, 0xE0E7,
-    0xE8E7, 0xE1A6, 0x90C4, 0xE9C5, 0xEA85, 0xF365, 0xF285, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0xCB84, 0xF665, 0xFE65, 0xFD65, 0xF485, 0xFC65,
-    0xF365, 0x90C4, 0xF285, 0xF285, 0xE0E8, 0x0000, 0x0000, 0x5084,
-    0xE8C8, 0xE0A8, 0xE0C8, 0xE0AA, 0x5884, 0x0000, 0xE8AE, 0xE0AE,
-    0xC88E, 0xE0B0, 0xC8B1, 0xC8B1, 0x988B, 0xB0B1, 0x0000, 0x0000,
-    0x0000, 0x6111, 0x4931, 0x4951, 0x3191, 0x3191, 0x3191, 0x2212,
-    0x0000, 0x1842, 0x12B4, 0x1356, 0x1356, 0x0BD8, 0x0BF8, 0x0479,
-    0x0000, 0x0000, 0x0BD8, 0x0BF8, 0x1356, 0x1356, 0x12B4, 0x1AB4,
-    0x210B, 0x0000, 0x0000, 0x3191, 0x2991, 0x3191, 0x4931, 0x6911,
-    0x78F1, 0x0000, 0x90D1, 0xA8D1, 0x0000, 0xD0B1, 0xC8B1, 0xE0B0,
-    0xE8AE, 0xE0B0, 0x0000, 0x0000, 0x0000, 0xE0AC, 0xE0A8, 0xE0AA,
-    0xC88A, 0xE926, 0xE106, 0xE165, 0xE9C5, 0xF285, 0x986B, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9AA3, 0xF485, 0xFD65,
-    0xFB65, 0xF365, 0xEA85, 0xF285, 0xE9C5, 0xD927, 0x90C4, 0x5884,
-    0x5084, 0xE8E7, 0xE0C8, 0xE8AC, 0x0000, 0x0000, 0x986B, 0xE0AE,
-    0xC8AE, 0x0000, 0xE0B0, 0xE8B0, 0xC8B1, 0xD0B1, 0x608B, 0x0000,
-    0x1842, 0x78F1, 0x6911, 0x1842, 0x210B, 0x4931, 0x3191, 0x2212,
-    0x0000, 0x0000, 0x09EE, 0x1356, 0x1356, 0x0BD8, 0x0BD8, 0x0479,
-    0x0C99, 0x0000, 0x0000, 0x09EE, 0x0BF8, 0x0BD8, 0x1356, 0x0000,
-    0x12B4, 0x1AB4, 0x2212, 0x0000, 0x0000, 0x4951, 0x4931, 0x6111,
-    0x6111, 0x6111, 0x0000, 0xB0B1, 0xA8D1, 0x0000, 0x0000, 0x1842,
-    0xE0B0, 0xE0B0, 0xE8AE, 0x0000, 0x0000, 0x0000, 0xC88E, 0xE0AA,
-    0xE0C8, 0xE108, 0xE108, 0xE906, 0xE108, 0x988B, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x1842, 0x98C4, 0xC185, 0xE9A6, 0xE1A6, 0xD127, 0xE965,
-    0xE108, 0xE108, 0xE0C8, 0xE0AA, 0x5084, 0xD08E, 0x0000, 0xE8AE,
-    0xE0AE, 0xE0B0, 0x0000, 0xA8D1, 0xC8B1, 0xC8B1, 0xB0B1, 0x90D1,
-    0x1842, 0x90F1, 0x4931, 0x0000, 0x0000, 0x3191, 0x2991, 0x3191,
-    0x0000, 0x0000, 0x0000, 0x1A73, 0x0B56, 0x0BD8, 0x0BF8, 0x0C79,
-    0x0479, 0x0C79, 0x0000, 0x0000, 0x0000, 0x0479, 0x0BD8, 0x0BF8,
-    0x09EE, 0x0000, 0x210B, 0x1A53, 0x09EE, 0x2042, 0x3191, 0x4951,
-    0x4931, 0x6911, 0x0000, 0x0000, 0x90F1, 0xB0D1, 0x986B, 0xB0D1,
-    0x588B, 0xD08E, 0xE0AE, 0xE0B0, 0xC8AE, 0xC88E, 0xD0AE, 0xC88E,
-    0xC88A, 0xC8AE, 0x5884, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x2042, 0x1842, 0x0000, 0x1842, 0xE108, 0xC88E, 0xE0AC,
-    0xE8AC, 0xE0B0, 0xE0B0, 0xE0B0, 0x988B, 0xE0B0, 0xD0B1, 0xC8B1,
-    0xA8B1, 0xB0D1, 0x6911, 0x0000, 0x0000, 0x0000, 0x3191, 0x3191,
-    0x3191, 0x0000, 0x0000, 0x0000, 0x09EE, 0x0BF8, 0x0BD8, 0x0479,
-    0x0C79, 0x0479, 0x0C79, 0x0000, 0x0000, 0x0000, 0x0000, 0x0479,
-    0x0BF8, 0x0BD8, 0x0000, 0x0000, 0x0000, 0x1A73, 0x2991, 0x3191,
-    0x3191, 0x6111, 0x4931, 0x4931, 0x78F1, 0xB0B1, 0xA8D1, 0xB0D1,
-    0x90D1, 0xD0B1, 0x1842, 0x0000, 0x0000, 0x608B, 0x1842, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x5884, 0xE8AA, 0xE8C8, 0xE0AC,
-    0xE0AC, 0xE8AE, 0xE0AE, 0xE0B0, 0xE0B0, 0xE0B0, 0xC8B1, 0xC8B1,
-    0xA8B1, 0xB0D1, 0x90D1, 0x78F1, 0x0000, 0x0000, 0x2991, 0x4931,
-    0x3191, 0x0000, 0x0000, 0x0000, 0x0000, 0x1A53, 0x0B56, 0x0BF8,
-    0x0BD8, 0x0C99, 0x0479, 0x0C79, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0333, 0x0BD8, 0x1356, 0x210B, 0x0000, 0x09EE, 0x2212, 0x2212,
-    0x3191, 0x4931, 0x4931, 0x6911, 0x6111, 0x90D1, 0x90F1, 0xB0D1,
-    0xA8B1, 0xB0D1, 0xC8B1, 0xE0B0, 0x5884, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0xE8C8, 0xE108, 0xE0A8, 0xE0AA,
-    0xE0AA, 0xE8AC, 0xE0AC, 0xE8AE, 0xC8AE, 0xE0B0, 0xE0B0, 0xE0B0,
-    0xC8B1, 0xD0B1, 0xB0D1, 0x90D1, 0x78D1, 0x78F1, 0x4951, 0x4931,
-    0x3191, 0x3191, 0x0000, 0x0000, 0x0000, 0x0000, 0x09EE, 0x0BF8,
-    0x0BD8, 0x0479, 0x0C79, 0x0479, 0x0C79, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0BF8, 0x0BD8, 0x1356, 0x0333, 0x1A53, 0x2212,
-    0x3191, 0x2991, 0x3191, 0x4931, 0x6111, 0x78F1, 0x78F1, 0x90D1,
-    0xA8B1, 0xD0B1, 0xC8B1, 0xE0B0, 0xE0B0, 0xE0B0, 0xC8B1, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0xC0C6, 0xE106, 0xE108, 0xE0C8, 0xE0A8,
-    0xE8C8, 0xE0AC, 0xE0AC, 0xE0AE, 0xC8B1, 0x0000, 0xE8AE, 0xE0B0,
-    0xC8B1, 0xC8B1, 0xA8B1, 0xB0D1, 0x90D1, 0x88D1, 0x6111, 0x6111,
-    0x4951, 0x4931, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0A0E,
-    0x1356, 0x0BD8, 0x0BF8, 0x0C79, 0x0479, 0x0C79, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x09EE, 0x1356, 0x1356, 0x1A53, 0x1A53,
-    0x2212, 0x2212, 0x3191, 0x4931, 0x4931, 0x6911, 0x6111, 0x1842,
-    0x6911, 0xB0D1, 0xA8B1, 0xD0B1, 0xC8B1, 0xE0B0, 0xE8AE, 0xE0B0,
-    0xE0AE, 0x988B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0xE1A6, 0xE145, 0xE965, 0xE0E7, 0xE0E7,
-    0xE0A8, 0xE8AA, 0xE0AA, 0xE8AC, 0xC8AE, 0xC88E, 0xE0AE, 0xE0B0,
-    0xB0D1, 0xE0B0, 0xD0B1, 0x1842, 0x90D1, 0xB0D1, 0x78D1, 0x78F1,
-    0x6111, 0x6911, 0x190B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x1AB4, 0x1356, 0x0B56, 0x0BD8, 0x0BD8, 0x0C79, 0x0479, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1356, 0x1AB4, 0x12B4,
-    0x2212, 0x2212, 0x2991, 0x0000, 0x3191, 0x6111, 0x4931, 0x78F1,
-    0x78F1, 0x90D1, 0x90D1, 0xC8B1, 0xC8B1, 0xE0B0, 0xE0B0, 0xE0B0,
-    0xE0AE, 0xE0AE, 0xE0AC, 0xE8AE, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x5084, 0xF285, 0xE9C5, 0xE965, 0xE106, 0xE0E7,
-    0xE0C8, 0xE8A8, 0xE0C8, 0xE0AC, 0xE0AC, 0xE8AE, 0xE0AE, 0xC8B1,
-    0xE0B0, 0xA8B1, 0xC8B1, 0xD0B1, 0x0000, 0xA8D1, 0x90D1, 0x90D1,
-    0x78F1, 0x6111, 0x4931, 0x4951, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x12B4, 0x12B4, 0x1356, 0x1356, 0x0BF8, 0x0BD8, 0x0BF8,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0B33, 0x12B4, 0x1AB4,
-    0x1A53, 0x2212, 0x3191, 0x3191, 0x0000, 0x4931, 0x4931, 0x4931,
-    0x6911, 0x78F1, 0x90D1, 0x90F1, 0xA8D1, 0xC8B1, 0xD0B1, 0xE0B0,
-    0xC8B1, 0xE0B0, 0xE8AE, 0xE0AC, 0xE0AC, 0xE0AC, 0x5884, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0xCA64, 0xF365, 0xE9C5, 0xE9C5, 0xE145, 0xE165,
-    0xE8E7, 0xE108, 0xE0A8, 0xE0AC, 0xE0AA, 0xE8AC, 0xE0AC, 0xE8AE,
-    0xC8B1, 0xE0B0, 0x988B, 0xE0B0, 0xD0B1, 0xC8B1, 0xA8B1, 0xB0D1,
-    0x90D1, 0x78F1, 0x608B, 0x6911, 0x4951, 0x4931, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x1AB4, 0x12B4, 0x1AB4, 0x0B56, 0x1356, 0x0BD8,
-    0x0BF8, 0x0000, 0x0000, 0x0000, 0x0000, 0x09EE, 0x1356, 0x12B4,
-    0x1A53, 0x1A53, 0x2212, 0x2212, 0x3191, 0x4931, 0x4931, 0x6111,
-    0x6111, 0x78F1, 0x78D1, 0xB0D1, 0x90D1, 0xC8B1, 0xC8B1, 0xC8B1,
-    0xE0B0, 0xC8AE, 0xE0AE, 0xE8AE, 0xE0AC, 0xE0AC, 0xE0AA, 0xE8AA,
-    0xC88A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0xF365, 0xF365, 0xF285, 0xF285, 0xE9C5, 0xE145,
-    0xE106, 0xE106, 0xE0C8, 0xE0C8, 0x90C4, 0x608B, 0xE8AA, 0xE0AE,
-    0x0000, 0xE0B0, 0xE0AE, 0xC8B1, 0xE0B0, 0xE0B0, 0xB0D1, 0xA8B1,
-    0xB0D1, 0x88D1, 0x0000, 0x0000, 0x4931, 0x6111, 0x3191, 0x190B,
-    0x0000, 0x0000, 0x0000, 0x1A73, 0x1A53, 0x1AB4, 0x12B4, 0x1356,
-    0x1356, 0x0BD8, 0x0000, 0x0000, 0x0000, 0x0000, 0x12B4, 0x1AB4,
-    0x12B4, 0x0000, 0x0000, 0x2212, 0x3191, 0x4931, 0x3191, 0x4931,
-    0x6911, 0x78F1, 0x78F1, 0x90D1, 0x78F1, 0x0000, 0xB0B1, 0xC8B1,
-    0x0000, 0xC8B1, 0xE8AE, 0xE0AE, 0xE8AC, 0xE0AC, 0xE0AA, 0xE0AA,
-    0xE8C8, 0xE0A8, 0xE0C8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0xF485, 0xFC65, 0xF365, 0xF365, 0xF285, 0xEA85,
-    0xE945, 0xE165, 0xE106, 0xE108, 0xE0C8, 0xE8AA, 0xE0AC, 0xE0AC,
-    0xE0AC, 0xE0B0, 0xE8AE, 0xE0B0, 0xE0B0, 0xE0B0, 0xC8B1, 0xD0B1,
-    0xA8B1, 0xB0D1, 0x90F1, 0x608B, 0x0000, 0x0000, 0x4931, 0x4931,
-    0x3191, 0x0000, 0x0000, 0x0000, 0x2212, 0x1AB4, 0x12B4, 0x1AB4,
-    0x12B4, 0x1356, 0x1356, 0x0000, 0x0000, 0x0000, 0x12B4, 0x12B4,
-    0x1A53, 0x0000, 0x0000, 0x0000, 0x3191, 0x2212, 0x4931, 0x4951,
-    0x4931, 0x78D1, 0x78F1, 0x90F1, 0x90D1, 0x78D1, 0xA8D1, 0xD0B1,
-    0xA8B1, 0xA8D1, 0xE0B0, 0xE0B0, 0xE0AE, 0xE8AE, 0xE0AC, 0xE0AC,
-    0xE0AA, 0xE8AA, 0xE0A8, 0xE108, 0xE108, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0xFC65, 0xFD85, 0xF465, 0xF365, 0xF285, 0xEA65,
-    0xE9C5, 0xE9C5, 0xE108, 0xE106, 0xE0E7, 0xE0E7, 0xE8C8, 0xE0AA,
-    0xE0AA, 0xE0AC, 0xE8AC, 0xE0AE, 0xE0AE, 0xE0B0, 0xE0B0, 0xE0B0,
-    0xC8B1, 0xC8B1, 0xB0B1, 0xA8D1, 0x90D1, 0x0000, 0x0000, 0x0000,
-    0x4931, 0x4951, 0x1842, 0x0000, 0x3191, 0x2212, 0x2212, 0x1A53,
-    0x1A53, 0x12B4, 0x1A53, 0x1AB4, 0x12B4, 0x0000, 0x0000, 0x1AB4,
-    0x1A53, 0x09EE, 0x0000, 0x0000, 0x3191, 0x3191, 0x3191, 0x4931,
-    0x4931, 0x6911, 0x6111, 0x78F1, 0x90D1, 0xB0D1, 0xA8D1, 0xC8B1,
-    0xD0B1, 0xE0B0, 0xE0B0, 0xE0B0, 0xE0AE, 0xE8AE, 0xE0AC, 0xE0AC,
-    0xE0AA, 0xE8AA, 0xE0A8, 0xE0C8, 0xE0E7, 0xE906, 0xE108, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0xFD65, 0xF585, 0xFC65, 0xFC85, 0xF365, 0xF365,
-    0xEA85, 0xF285, 0xD127, 0x0000, 0xE108, 0xE906, 0xE0E7, 0xE0A8,
-    0xE0C8, 0xE8AC, 0xE0AC, 0xE0AE, 0xE8AE, 0xE0B0, 0xE0B0, 0xE0B0,
-    0xC8B1, 0x0000, 0x90F1, 0xC8B1, 0x90D1, 0xB0B1, 0x78F1, 0x0000,
-    0x0000, 0x5151, 0x4931, 0x4931, 0x210B, 0x2212, 0x0000, 0x21F2,
-    0x2212, 0x1A53, 0x2212, 0x12B4, 0x0000, 0x1AB4, 0x0000, 0x09EE,
-    0x2212, 0x1A53, 0x0000, 0x0000, 0x190B, 0x3191, 0x3191, 0x4951,
-    0x4931, 0x0000, 0x4931, 0x78F1, 0x90D1, 0xA8D1, 0xB0B1, 0xC8B1,
-    0xC8B1, 0xC8B1, 0xE0B0, 0xE0B0, 0xE0AE, 0xE0B0, 0xE8AE, 0xC8AE,
-    0x1842, 0xE8AC, 0xE0AA, 0xE0A8, 0xE0C8, 0xE926, 0xE106, 0xE145,
-    0xE165, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0xCB84, 0xFE85, 0xFD65, 0xF565, 0xFC85, 0xF465,
-    0xF365, 0xFB65, 0xE9C5, 0xE1A6, 0x0000, 0x0000, 0xE0E7, 0xE0AA,
-    0x0000, 0x0000, 0xC88A, 0xE0AC, 0xE8AC, 0xE0AE, 0xE0AE, 0xE0B0,
-    0xE0B0, 0x988B, 0x0000, 0x0000, 0xB0D1, 0x78D1, 0x0000, 0x88D1,
-    0x78F1, 0x0000, 0x1842, 0x6911, 0x4931, 0x4951, 0x210B, 0x0000,
-    0x3191, 0x2212, 0x2991, 0x2212, 0x21F2, 0x0000, 0x2212, 0x3191,
-    0x2212, 0x21F2, 0x190B, 0x0000, 0x210B, 0x3191, 0x190B, 0x0000,
-    0x5131, 0x1842, 0x0000, 0x0000, 0x78F1, 0x90D1, 0x90F1, 0xB0D1,
-    0xB0B1, 0xC8B1, 0x988B, 0x0000, 0x5884, 0xE8AE, 0xE8AE, 0x5084,
-    0x0000, 0xC88E, 0xE8AA, 0xE0AA, 0xE8C8, 0xE0E7, 0xE0E7, 0xE145,
-    0xE965, 0xE9C5, 0xC165, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0xF725, 0xFE65, 0xF685, 0xFD65, 0xFD85,
-    0xF465, 0xFC85, 0xEA65, 0xF285, 0xE9C5, 0xC985, 0x588B, 0xE106,
-    0xE8AA, 0x0000, 0x0000, 0xC8AE, 0xE0AA, 0xE0AC, 0xE0AC, 0xE8AE,
-    0xE0AE, 0xE8B0, 0x1842, 0x0000, 0x0000, 0x78D1, 0xB0D1, 0x0000,
-    0x0000, 0x90D1, 0x78F1, 0x0000, 0x6111, 0x6911, 0x4951, 0x0000,
-    0x0000, 0x4931, 0x3191, 0x2991, 0x3191, 0x21F2, 0x0000, 0x210B,
-    0x2991, 0x2212, 0x3191, 0x2042, 0x0A0E, 0x4931, 0x210B, 0x0000,
-    0x4951, 0x4931, 0x0000, 0x0000, 0x0000, 0x88D1, 0xB0D1, 0xA8B1,
-    0xB0D1, 0xC8B1, 0xC8B1, 0xE0B0, 0x0000, 0x0000, 0xC88E, 0xE8AE,
-    0x988B, 0x0000, 0xE0AC, 0xE0AA, 0xE8C8, 0xE108, 0xE0E7, 0xE106,
-    0xE145, 0xE9C5, 0xE9C5, 0xEA85, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x9AA3, 0xFE65, 0xFE65, 0xFD65, 0xFD85,
-    0xF465, 0xFC85, 0xF365, 0xF365, 0xF265, 0xEA85, 0xE145, 0xD127,
-    0xE906, 0xE108, 0x0000, 0x0000, 0xE0AA, 0xE0AA, 0xE0AA, 0xE8AC,
-    0xC8AE, 0x1842, 0xE8AE, 0x588B, 0x0000, 0x0000, 0x0000, 0xC8B1,
-    0x90D1, 0x0000, 0x0000, 0x90D1, 0x78F1, 0x78F1, 0x6111, 0x4931,
-    0x0000, 0x0000, 0x3191, 0x4931, 0x3191, 0x2991, 0x3191, 0x0000,
-    0x0000, 0x3191, 0x3191, 0x2991, 0x3191, 0x4951, 0x210B, 0x0000,
-    0x0000, 0x6111, 0x1842, 0x0000, 0x0000, 0x0000, 0x90D1, 0x90F1,
-    0x2042, 0xD0B1, 0xC8B1, 0xE0B0, 0xE0B0, 0xA8D1, 0x0000, 0xE8AE,
-    0xE0AC, 0xC88E, 0xC8AE, 0xE8AA, 0xE0A8, 0xE8C8, 0xE0A8, 0xE0E7,
-    0xE106, 0xE965, 0xE165, 0xF285, 0xEA65, 0x90C4, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x9AA3, 0xF725, 0xFE65, 0xFE85,
-    0xFD65, 0xF585, 0xFC65, 0xFC85, 0xF365, 0xCA84, 0xE1A6, 0xE9C5,
-    0xE165, 0xE108, 0xE906, 0x5884, 0x986B, 0xE0AA, 0xE0AA, 0xE8AC,
-    0xE0AC, 0xE0AE, 0xE8AE, 0xE0B0, 0xC8B1, 0xB0D1, 0xC8B1, 0xA8B1,
-    0xD0B1, 0xC8B1, 0x608B, 0x0000, 0x0000, 0x78F1, 0x78D1, 0x78F1,
-    0x608B, 0x0000, 0x0000, 0x5151, 0x4931, 0x4951, 0x4931, 0x4951,
-    0x0000, 0x0000, 0x3191, 0x5131, 0x4951, 0x4931, 0x0000, 0x0000,
-    0x0000, 0x6111, 0x6111, 0x608B, 0x588B, 0x608B, 0x608B, 0xA8B1,
-    0xB0D1, 0xC8B1, 0xC8B1, 0xE0B0, 0xE0B0, 0xE0B0, 0xE0B0, 0x986B,
-    0xE0AE, 0xE8AE, 0xC8AE, 0xE0AC, 0xE0AA, 0xE8AC, 0xE0C8, 0xE0E7,
-    0xE106, 0xE145, 0xE165, 0xE9C5, 0xE9C5, 0xFB65, 0x5884, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3222, 0xFE85, 0xF725,
-    0xFE65, 0xFE65, 0xFC65, 0xF465, 0xF365, 0xF365, 0x5884, 0x0000,
-    0xE9C5, 0xE9C5, 0xE145, 0xE106, 0xE8E7, 0xE108, 0xE0C8, 0xE0AA,
-    0xC88A, 0x0000, 0xE0AC, 0xE8AE, 0xC8AE, 0xC8AE, 0x986B, 0xC8AE,
-    0xB0B1, 0xC8B1, 0xC8B1, 0xD0B1, 0xA8D1, 0x608B, 0x0000, 0x90D1,
-    0x78F1, 0x1842, 0x0000, 0x0000, 0x6111, 0x6111, 0x4931, 0x4931,
-    0x5151, 0x0000, 0x0000, 0x0000, 0x4931, 0x6911, 0x190B, 0x0000,
-    0x4951, 0x6911, 0x6111, 0x78F1, 0x78D1, 0x90D1, 0x78F1, 0x90D1,
-    0xB0D1, 0xC8B1, 0xC8B1, 0x1842, 0x0000, 0xE8B0, 0xE8AE, 0xE0B0,
-    0xE0AE, 0xE0AE, 0xE0AC, 0xE8AC, 0xE0AA, 0x988B, 0x0000, 0xE8AA,
-    0xE0E7, 0xE106, 0xE165, 0xE9C5, 0xE9C5, 0xF285, 0xEA65, 0x1842,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF725,
-    0xFE65, 0xF725, 0xF685, 0xFD65, 0xFC85, 0xF485, 0xC165, 0xCA64,
-    0xF285, 0xEA85, 0xE9C5, 0xE9C5, 0xE106, 0xE906, 0xE0E7, 0xE0E7,
-    0xE0C8, 0xC88A, 0xE8AC, 0xE0AC, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0xB0D1, 0xE0B0, 0xA8B1, 0xD0B1, 0xA8D1, 0xB0D1,
-    0x90D1, 0x90D1, 0x0000, 0x0000, 0x0000, 0x78F1, 0x6111, 0x6111,
-    0x6111, 0x6911, 0x0000, 0x0000, 0x0000, 0x6111, 0x6111, 0x6111,
-    0x6911, 0x78F1, 0x4931, 0x78D1, 0x78F1, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x588B, 0xD0B1, 0x988B, 0x1842, 0xE0B0, 0xE0B0,
-    0xE0AE, 0xE8AE, 0xE0AC, 0xE0AC, 0xE0AA, 0xE108, 0xE8AA, 0xC88A,
-    0x90E4, 0xE106, 0xE145, 0xE9C5, 0xE9C5, 0xEA65, 0xF285, 0xFB65,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0xFE65, 0xF725, 0xFE65, 0xFE65, 0xFD65, 0xFD65, 0xF485, 0xF365,
-    0xF265, 0xF365, 0xE9C5, 0xE9C5, 0xE145, 0xE165, 0xE106, 0xE108,
-    0xE0C8, 0xE8AA, 0xE0A8, 0xC8AE, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0xE0B0, 0xC8B1, 0x0000, 0x0000, 0x5884,
-    0xA8B1, 0xB0D1, 0x78D1, 0x0000, 0x0000, 0x0000, 0x78F1, 0x78D1,
-    0x78F1, 0x78D1, 0x6111, 0x0000, 0x0000, 0x0000, 0x4931, 0x78F1,
-    0x6111, 0x190B, 0x0000, 0x0000, 0x78F1, 0x90D1, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA08B, 0xE8AE, 0xE0B0,
-    0xC8B1, 0xE8AE, 0xE0AC, 0xE0AC, 0xE0AA, 0xE8AA, 0xE0A8, 0xE0C8,
-    0xE0A8, 0xD127, 0xE906, 0xE165, 0xE165, 0xE9C5, 0xE9C5, 0xF285,
-    0xEA65, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0xF725, 0xF725, 0xF725, 0xFE65, 0xFE65, 0xFD85, 0xF565,
-    0xFC85, 0xFC65, 0xF365, 0xEA85, 0xD127, 0xE9C5, 0xE965, 0xE165,
-    0xE106, 0xE108, 0xE0AA, 0xE8C8, 0xE8AA, 0xC88A, 0x5084, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0xE0B0, 0xE0B0, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x90D1, 0x78F1, 0x0000, 0x0000, 0x0000, 0x90F1,
-    0x90D1, 0x88F1, 0x90D1, 0x78D1, 0x0000, 0x0000, 0x0000, 0x6111,
-    0x78F1, 0x0000, 0x0000, 0x0000, 0x0000, 0xB0B1, 0xB0D1, 0x1842,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x588B, 0xE0B0, 0xE0B0, 0xE0B0,
-    0xE8AE, 0xC88E, 0xE0AC, 0xE0AC, 0xE8AA, 0xE0AC, 0xE0AA, 0xE0AA,
-    0xE8C8, 0xE108, 0xE106, 0xE165, 0xE145, 0xE9C5, 0xE9C5, 0xEA65,
-    0xF285, 0xF365, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0xCD65, 0xF725, 0xFE85, 0xFE65, 0xFD65, 0xFD65,
-    0xF485, 0xFC65, 0xF365, 0xF365, 0xF285, 0x0000, 0xD127, 0xE9C5,
-    0xE145, 0xE106, 0xE0E7, 0xE108, 0x0000, 0xE8AA, 0xE0AA, 0xE0AA,
-    0xE0AC, 0xE8AE, 0xE0AC, 0xE0AE, 0xE0AE, 0xE0B0, 0xA8D1, 0x0000,
-    0x0000, 0x0000, 0xA06B, 0xC8B1, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x90D1, 0xA8D1, 0x90D1, 0x90F1, 0x78F1, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x88D1, 0x608B, 0x0000, 0x0000, 0x0000, 0x90D1, 0xC8B1,
-    0xB0D1, 0xC8B1, 0xC8B1, 0xE0B0, 0xC8B1, 0xE8B0, 0xE0AE, 0xE0B0,
-    0x0000, 0xC8AE, 0xE8AC, 0xE0AC, 0xE0AC, 0xE0AC, 0xE8AA, 0x0000,
-    0xC88A, 0xE0E7, 0xE0E7, 0xE106, 0xE965, 0xE9C5, 0xE9C5, 0xEA85,
-    0xEA85, 0xF365, 0xC165, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0xCD65, 0xF725, 0xF725, 0xFE65, 0xFE85,
-    0xFD65, 0xF585, 0xFC65, 0xFC85, 0xF365, 0xF365, 0xEA65, 0xF285,
-    0xE9C5, 0xE9C5, 0xE165, 0xE906, 0x1842, 0x0000, 0x0000, 0x0000,
-    0x988B, 0xE8AC, 0xC88E, 0xE0AE, 0xE0AE, 0xE8AE, 0xE0AE, 0xD0B1,
-    0x0000, 0x0000, 0x588B, 0xE0B0, 0xD0B1, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0xA8D1, 0xB0B1, 0xA8D1, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x90D1, 0xB0D1, 0x1842, 0x0000, 0x0000, 0xB0B1,
-    0xA8D1, 0xE0B0, 0xC8B1, 0xE0B0, 0xB0B1, 0xB0D1, 0x1842, 0x0000,
-    0x0000, 0x0000, 0x0000, 0xE0AE, 0xE0AC, 0xE0AC, 0xE8AA, 0xE0AA,
-    0xE0C8, 0xE108, 0xE0E7, 0xE106, 0xE145, 0xE9C5, 0xE9C5, 0xF265,
-    0xEA85, 0xFB65, 0xFB65, 0x62A3, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x9AA3, 0xF725, 0xFF25, 0xF725,
-    0xFE85, 0xFE65, 0xFD65, 0xF565, 0xFC85, 0xF465, 0xF365, 0xFB65,
-    0xEA85, 0xF265, 0xE145, 0xE165, 0xE0A8, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xC8AE, 0xC88E, 0xE8AE,
-    0xC8AE, 0x0000, 0x986B, 0xE8B0, 0xE0B0, 0x988B, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x588B, 0x90D1, 0x608B, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x988B, 0xB0B1, 0xC8B1, 0x1842, 0x0000,
-    0xD0B1, 0xD0B1, 0xC8B1, 0x988B, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0xA06B, 0xE0AC, 0xE8AA, 0xE0AA,
-    0xE0C8, 0xE0E7, 0xE8E7, 0xE106, 0xE106, 0xE165, 0xE965, 0xE9C5,
-    0xEA85, 0xF365, 0xF365, 0xFC65, 0x5084, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3222, 0xF725, 0xF725,
-    0xF725, 0xF725, 0xFE65, 0xFE85, 0xF465, 0xFC85, 0xF465, 0xFC85,
-    0xF265, 0xF365, 0xF285, 0xE9C5, 0xE965, 0x1842, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xC88E, 0xC8AE, 0x986B,
-    0xE0AC, 0xE8AE, 0xC8AE, 0xE0B0, 0xE0AE, 0xE8B0, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xC8B1, 0xC8B1, 0xE0B0,
-    0xA8B1, 0xE0B0, 0xE0B0, 0xC8B1, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE8AA, 0xE0AA,
-    0xE0C8, 0xE108, 0xE0E7, 0xE926, 0xE106, 0xE145, 0xE1A6, 0xE9C5,
-    0xF285, 0xF365, 0xF365, 0xFC65, 0xFC85, 0x5884, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFF25,
-    0xF725, 0xF725, 0xFE65, 0xFE65, 0xCB84, 0x0000, 0x0000, 0xFC65,
-    0xEA85, 0x0000, 0x0000, 0xD127, 0xE9C5, 0xE9C5, 0xE0E8, 0xE165,
-    0xE108, 0xE108, 0x986B, 0x608B, 0x0000, 0x0000, 0xC88A, 0xE8AC,
-    0xE0AC, 0xE0AC, 0xE0AC, 0xE8AE, 0xE0AE, 0xE0AE, 0xC8AE, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x988B, 0xD0B1,
-    0xE0B0, 0xE0B0, 0xE0B0, 0xE0B0, 0xC8B1, 0x588B, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x1842, 0xA06B, 0xD0AE, 0xE8AC, 0xC88E, 0xE0AA,
-    0xE0C8, 0xE8AA, 0x5084, 0x0000, 0x90C4, 0xE965, 0x90C4, 0x0000,
-    0xD927, 0xF285, 0xEA85, 0xF365, 0xFB65, 0xF465, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0xD686, 0xF725, 0xF725, 0xF725, 0xFE65, 0x0000, 0x0000, 0x0000,
-    0xFC85, 0xFC85, 0x5064, 0xEA85, 0xF265, 0xEA85, 0xE9C5, 0xE9C5,
-    0xE165, 0xE965, 0xE106, 0xE106, 0xE0E7, 0xE108, 0xE8C8, 0xE0AA,
-    0xE0AA, 0xE108, 0xE0AC, 0xE8AC, 0xE0AC, 0xE0AE, 0xE8AE, 0xC8B1,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xB0B1,
-    0x588B, 0xE0B0, 0xE0B0, 0xE0B0, 0xE0B0, 0xE0B0, 0xE0AE, 0xE0B0,
-    0xE0AE, 0xE8AE, 0xE0AC, 0xE0AC, 0xE0AC, 0xE108, 0xE8AA, 0xE0AA,
-    0xE0C8, 0xE108, 0xE0C8, 0xC88A, 0x0000, 0xE108, 0xE145, 0xC0C6,
-    0x0000, 0x0000, 0xE9C5, 0xFB65, 0xF365, 0xF465, 0xFC85, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0xCE66, 0xCF26, 0xFF25, 0xF725, 0xFD65, 0x0000, 0x0000,
-    0x0000, 0xF365, 0xFC85, 0xF465, 0xF365, 0xFB65, 0xEA85, 0xF265,
-    0xE9C5, 0xE9C5, 0xE145, 0xE165, 0xE106, 0xE106, 0xE0C8, 0xE8C8,
-    0xE0A8, 0xE0AA, 0xE0C8, 0xE8AA, 0xE0AA, 0xE0AC, 0x986B, 0xE8AE,
-    0x5084, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0xA08B, 0xC8B1, 0x0000, 0xE0B0, 0xE8AE, 0xE0AE, 0xE0AE, 0xE0AE,
-    0xE8AC, 0xE0AE, 0xE0AC, 0xE0AC, 0xE8AA, 0xE0AA, 0xE0A8, 0xE0AA,
-    0xE8C8, 0xE0E7, 0xE0A8, 0xE0E7, 0xE906, 0xE165, 0xE165, 0xE1A6,
-    0x0000, 0x0000, 0x0000, 0x5884, 0xFB65, 0xF485, 0xFC85, 0xF365,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x9CE5, 0xF725, 0xF725, 0xFF25, 0xCC84, 0x0000,
-    0x0000, 0x0000, 0x90C4, 0xF585, 0xFC65, 0xFC85, 0xF365, 0xFB65,
-    0x988B, 0x90C4, 0xE9C5, 0xE9C5, 0xE165, 0xE165, 0xE106, 0xE906,
-    0xE0E7, 0xE108, 0xE0C8, 0xE0AA, 0xE8AA, 0xE0AC, 0xC88E, 0xE0AC,
-    0xE8AC, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0xE8AE, 0x988B, 0x986B, 0xE0AE, 0xE0AE, 0xE8AE,
-    0xE0AC, 0xE0AE, 0xE0AC, 0xE8AC, 0xE0AA, 0xE0AC, 0xE0AA, 0xE8AA,
-    0xE0C8, 0xE108, 0xE0AA, 0xE126, 0xE906, 0xE145, 0xE145, 0xE9C5,
-    0xD127, 0x0000, 0x0000, 0x0000, 0x0000, 0xF485, 0xFC65, 0xFD85,
-    0x9AA3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x3222, 0xD746, 0xF725, 0xD726, 0xCC64,
-    0x0000, 0x0000, 0x0000, 0xFC65, 0xF585, 0xFD65, 0xFC85, 0x9AA3,
-    0x0000, 0x0000, 0xD127, 0xF285, 0xE9C5, 0xE1C5, 0xE145, 0xE145,
-    0xE108, 0xE906, 0xE0E7, 0xE0E7, 0xE0AA, 0xE8C8, 0xE0C8, 0x0000,
-    0xE0AA, 0xE0AC, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0xE8AE, 0xC88E, 0x0000, 0xE0AC, 0xE0AC,
-    0xE8AC, 0xE0AC, 0xE0AA, 0xE0AC, 0xE8AC, 0xE0AA, 0xE0C8, 0xE0A8,
-    0xE8C8, 0xE0E7, 0xE0A8, 0x0000, 0x0000, 0xC0C6, 0xE165, 0xE9C5,
-    0xE9C5, 0xF285, 0x0000, 0x0000, 0x0000, 0x5064, 0xFC85, 0xFD85,
-    0xFD65, 0x1842, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCF26, 0xCF46, 0xF725,
-    0xCB84, 0x0000, 0x0000, 0x0000, 0xFD65, 0xFE65, 0xFD85, 0xFC85,
-    0x0000, 0x0000, 0xC165, 0xF365, 0xF265, 0xF285, 0x90E4, 0x986B,
-    0xE165, 0xE165, 0xE906, 0xE108, 0x0000, 0xD127, 0xE8C8, 0xE108,
-    0xC88A, 0xE8AA, 0x1842, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x5084, 0xE8AE, 0x5884, 0xC88E,
-    0xE0AC, 0xE8AC, 0x1842, 0xE0AC, 0xE0AA, 0xE8AA, 0xE0C8, 0xE0AC,
-    0xC0C6, 0xE108, 0xE0E7, 0xE106, 0xC0C6, 0x0000, 0x0000, 0xD127,
-    0xE9C5, 0xF265, 0xF285, 0x0000, 0x0000, 0x0000, 0x5084, 0xFD65,
-    0xFD65, 0xFE85, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCD65, 0xCF26,
-    0xD726, 0xCC64, 0x0000, 0x0000, 0x0000, 0xFD85, 0xFD65, 0xF585,
-    0xFC65, 0xCA64, 0xC165, 0xFC85, 0xF365, 0xF365, 0xC165, 0x0000,
-    0xE1A6, 0xE9C5, 0xE165, 0x90E4, 0x0000, 0xC0C6, 0xE8E7, 0xE0E7,
-    0xE8A8, 0xE0C8, 0xE0A8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE0AC, 0xE8AC,
-    0xE0AA, 0xE0AA, 0xE0AA, 0x988B, 0x0000, 0xA06B, 0xE0C8, 0xE8A8,
-    0xC88A, 0x0000, 0xC8AA, 0xE106, 0xE126, 0xE165, 0x1842, 0x98C4,
-    0xE9A6, 0xF285, 0xEA85, 0xF365, 0x0000, 0x0000, 0x0000, 0x9AA3,
-    0xFC85, 0xFE85, 0xF465, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD565,
-    0xA6C7, 0xCD85, 0xCC84, 0x9AA3, 0x0000, 0x0000, 0x1822, 0xFE65,
-    0xFE85, 0xF565, 0xFC85, 0xFD65, 0xFC85, 0xFC85, 0x90C4, 0x0000,
-    0x5084, 0xF285, 0xE9C5, 0x0000, 0x0000, 0xE108, 0xE145, 0xE165,
-    0xE108, 0xC0C6, 0xE0C8, 0xC0C6, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xC88A,
-    0xE8AA, 0xE0AC, 0xE0AA, 0xE0AA, 0xE8C8, 0xC88A, 0x0000, 0x0000,
-    0xE0E7, 0xE906, 0x1842, 0x0000, 0x988B, 0xE9C5, 0xE1A6, 0xE9C5,
-    0xE1A6, 0xCA64, 0xF285, 0xF365, 0xE1A6, 0x0000, 0x0000, 0x0000,
-    0xCB84, 0xFD65, 0xFE85, 0xCC64, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x62A3, 0xD726, 0xCE86, 0x62A3, 0xD565, 0x0000, 0x0000, 0x0000,
-    0xCC64, 0xFE85, 0xFD65, 0xFD65, 0xFD85, 0xF465, 0xCA64, 0xF285,
-    0xF365, 0xF365, 0xF265, 0xEA85, 0xC165, 0xE9C5, 0xE1A6, 0xE165,
-    0x90C4, 0x0000, 0xE108, 0xE906, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0xE0AA, 0xE8C8, 0x0000, 0x90E4, 0xE0E7, 0xE8A8, 0xE108,
-    0x0000, 0xE106, 0xE126, 0xE165, 0xE108, 0x0000, 0x588B, 0xE9C5,
-    0xE9C5, 0xF285, 0xF265, 0xF365, 0xF365, 0x0000, 0x0000, 0x0000,
-    0xCA64, 0xCB84, 0xCD85, 0xFE65, 0x5064, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0xA6C7, 0xD726, 0x62A3, 0x9CE5, 0xF665, 0xFD65,
-    0x0000, 0xFE65, 0xFE65, 0xF665, 0xFE65, 0xFE85, 0xFD65, 0xF585,
-    0xFC65, 0xFC85, 0xF365, 0x0000, 0xEA85, 0xF365, 0xF285, 0xE1A6,
-    0x0000, 0x0000, 0xE945, 0xE965, 0x90C4, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x5084, 0xE8E7, 0xE0C8, 0x0000, 0x0000, 0xE108,
-    0xE106, 0xE165, 0xE906, 0x5084, 0xE108, 0xE9C5, 0xE9C5, 0xEA65,
-    0xE9C5, 0xF365, 0xF285, 0xF365, 0xFB65, 0xFC85, 0x0000, 0x5084,
-    0xCA64, 0xFB65, 0x5864, 0xFE65, 0xFE85, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0xCD65, 0xA6C7, 0xA6A7, 0x0000, 0xD464,
-    0xCE86, 0xFF25, 0xF725, 0x62A3, 0x0000, 0x9AA3, 0x0000, 0xFC85,
-    0xFD65, 0xFD85, 0xCB84, 0x0000, 0x0000, 0xF265, 0xEA85, 0x5064,
-    0x0000, 0x5884, 0xE9C5, 0xE9C5, 0xD127, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0xC0C6, 0xE108, 0xE8E7, 0x1842,
-    0x0000, 0x5884, 0xE108, 0xE965, 0x0000, 0x0000, 0xD127, 0xF285,
-    0xEA65, 0xF285, 0x90C4, 0x90C4, 0x0000, 0x5884, 0xFC85, 0xFD85,
-    0xCB84, 0xCA64, 0x0000, 0x9AA3, 0xFE85, 0xFD65, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0xCB64, 0xA6C7, 0xA6C7, 0x0000,
-    0x0000, 0x9CE5, 0xF725, 0x9CE5, 0x0000, 0x0000, 0x0000, 0x0000,
-    0xFD65, 0xFE65, 0xF585, 0x0000, 0x0000, 0xFC65, 0xFB65, 0x0000,
-    0x0000, 0x1842, 0xEA85, 0xF285, 0xE9C5, 0xE1C6, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE108, 0xE108, 0xD127,
-    0xE906, 0x5084, 0x0000, 0x0000, 0xE1A6, 0xE9C5, 0x0000, 0x0000,
-    0xF285, 0xF365, 0xFB65, 0x0000, 0x0000, 0x0000, 0x0000, 0x9AA3,
-    0xF565, 0xFC85, 0x0000, 0x0000, 0xCC64, 0xF725, 0xCB84, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8667, 0xA6C7,
-    0x0000, 0xD686, 0xD726, 0x9AA3, 0x0000, 0x0000, 0x0000, 0x0000,
-    0xFC65, 0xFE85, 0xF565, 0xCA64, 0x0000, 0xFD65, 0xF365, 0x0000,
-    0x0000, 0x0000, 0xF285, 0xF365, 0xF265, 0xEA85, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1842, 0xE945,
-    0xE145, 0xD127, 0xE965, 0x5084, 0x0000, 0x0000, 0xE9A6, 0xF285,
-    0x0000, 0x90C4, 0xF365, 0xF365, 0xF285, 0x0000, 0x0000, 0x0000,
-    0x0000, 0xCB84, 0xFD85, 0xF465, 0x0000, 0xFE85, 0xF725, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8667,
-    0x8667, 0xA6A7, 0xA6C7, 0xD686, 0x6AA3, 0x0000, 0x0000, 0x0000,
-    0x1822, 0xF725, 0xFE65, 0xFE85, 0x90C4, 0xF665, 0xFC85, 0x0000,
-    0x0000, 0x0000, 0xF365, 0xFC85, 0xF365, 0xFB65, 0xE1A6, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0xD127, 0xEA65, 0xE9C5, 0xF285, 0xE1A6, 0x0000, 0x0000, 0x0000,
-    0xEA85, 0xF365, 0x0000, 0xFC65, 0xF485, 0xFD65, 0xC165, 0x0000,
-    0x0000, 0x0000, 0x0000, 0xFE65, 0xFE65, 0xFE65, 0xF725, 0xFE65,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x64A6, 0x8667, 0x8667, 0x9CE5, 0xAEC7, 0xD726, 0xCE66, 0xCD65,
-    0xFC85, 0xF725, 0xFE65, 0x0000, 0xFE65, 0xFE65, 0xCC64, 0x0000,
-    0x0000, 0x0000, 0xEA85, 0xFC65, 0xF485, 0xFC65, 0xF365, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0xE1A6, 0xF285, 0xEA85, 0xF265, 0xE1A6, 0x0000,
-    0x0000, 0x0000, 0xF285, 0xF485, 0xFC65, 0xCA64, 0xCB84, 0xF585,
-    0xCB84, 0xCB84, 0xCB84, 0xFE65, 0xFE65, 0x5064, 0xFE85, 0xF725,
-    0x9AA3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x6E08, 0x8667, 0x9CE5, 0xA6C7, 0xCD65, 0xCE86,
-    0xCB84, 0xFF25, 0xF725, 0x0000, 0x62A3, 0xF725, 0xF725, 0xFE65,
-    0xFD85, 0xFD65, 0xF585, 0xFD65, 0xFD85, 0xFD65, 0xF485, 0xCA64,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0xE1A6, 0xF285, 0xF365, 0xFB65, 0xF365,
-    0xEA65, 0xFB65, 0xF365, 0xF365, 0xF485, 0xFD65, 0xFC85, 0x0000,
-    0xF565, 0xFE85, 0x9AA3, 0xFD65, 0xFE65, 0xFF25, 0xCD65, 0xF725,
-    0xD746, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x6E28, 0x6E08, 0x0000, 0x9CE5, 0x62A3,
-    0x9CE5, 0xD726, 0xD726, 0x9AA3, 0x0000, 0xF725, 0xF725, 0xFF25,
-    0xF725, 0xFE85, 0xFE65, 0xFE65, 0xF565, 0xFE65, 0xFD65, 0xF485,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF365, 0xFB65, 0xF465,
-    0xF365, 0xFC85, 0xFC65, 0xF485, 0xFC65, 0xF585, 0xFD65, 0xFE85,
-    0x0000, 0x62A3, 0xFE65, 0xFE65, 0xCC64, 0x9AA3, 0xCB84, 0x3242,
-    0xCF26, 0xD686, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x6AA3, 0x6E08, 0x8667, 0x8667,
-    0x8667, 0xA6C7, 0xA6A7, 0xCE86, 0x0000, 0xF725, 0xCF26, 0xFD85,
-    0xCC64, 0xFD85, 0xCC64, 0xF725, 0xFE65, 0xF725, 0xFE65, 0xFE85,
-    0x5884, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x90C4, 0xF465,
-    0xFC85, 0xFD65, 0xF485, 0xFD65, 0xF365, 0xCB84, 0xFC85, 0xCC64,
-    0xF665, 0xFD65, 0x0000, 0xFE85, 0xFF25, 0xF725, 0xCB64, 0xFE65,
-    0xCF46, 0xFF25, 0x5064, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4DA8, 0x6E28,
-    0x6E08, 0x8667, 0x8667, 0x3222, 0x9CE5, 0xD686, 0xA6C7, 0xD666,
-    0xCD65, 0xCD85, 0xD726, 0xF725, 0xF725, 0xFF25, 0xFE65, 0xFE65,
-    0xCB84, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0xCB84, 0xF565, 0xFC85, 0xFD65, 0xF585, 0xFE65, 0xFD65, 0xF365,
-    0xCB84, 0xFE85, 0xFE65, 0xCC64, 0xCD65, 0xCB84, 0xCE86, 0xF725,
-    0xCF26, 0xD726, 0xCE86, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x34C8,
-    0x2D49, 0x6E28, 0x9CE5, 0x9CE5, 0x6AA3, 0xA6A7, 0xA6C7, 0x9CE5,
-    0x9AA3, 0xCF26, 0xD746, 0xF725, 0xF725, 0xF725, 0xF725, 0xF725,
-    0xFD65, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0xFC65, 0xF685, 0xFD65, 0xFE65, 0xFE65, 0xFE65,
-    0xFE65, 0xF725, 0xFC85, 0x62A3, 0xF725, 0xFF25, 0xCB84, 0x9AA3,
-    0xCD65, 0xCF26, 0xD726, 0x62A3, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x55A8, 0x2D49, 0x0000, 0xA4E5, 0x8667, 0x6628, 0xAEC7,
-    0x9CE5, 0xA6A7, 0xA6C7, 0xD726, 0xCF26, 0xFF25, 0xCF26, 0xF725,
-    0xFE65, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0xFD65, 0xFE65, 0xFE65, 0xF725,
-    0xFE65, 0xF725, 0xF725, 0xF725, 0x9AA3, 0xFE85, 0xCF26, 0xCD65,
-    0xCB84, 0x9CE5, 0xA6C7, 0xAEA7, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x2042, 0x2D49, 0x4DA8, 0x8667, 0x6E08, 0x8667,
-    0x9CE5, 0xA6C7, 0xAEA7, 0xA6C7, 0xA6A7, 0xCF26, 0xCF26, 0xCF26,
-    0xCF26, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFE65, 0xFF25,
-    0xF725, 0xF725, 0xF725, 0xFF25, 0xF725, 0xF725, 0xD686, 0xCF26,
-    0xCF26, 0xD726, 0xA6A7, 0xA6C7, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x6CA6, 0x2D69, 0x2D49, 0x4DA8,
-    0x55A8, 0x6E28, 0x6E28, 0x8667, 0x8667, 0xA6A7, 0xA6C7, 0xA6A7,
-    0xAEC7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0xFC65, 0xF725, 0xCF26, 0xF725, 0xD726, 0xF725, 0xCF26, 0xCF26,
-    0xD686, 0xCF26, 0xA6A7, 0xA6C7, 0x9AA3, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x55A8, 0x2D49,
-    0x2D49, 0x4DA8, 0x4DA8, 0x6E28, 0x6E08, 0x8667, 0x8667, 0xA6C7,
-    0xCD85, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0xCB64, 0xF725, 0xCF26, 0xF725, 0xD726, 0xCF26,
-    0xA6C7, 0xD726, 0xA6A7, 0xAEC7, 0x9CE5, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x6CA6, 0x2D69, 0x2D49, 0x55A8, 0x4DA8, 0x6E28, 0x55A8, 0x8667,
-    0x6AA3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x62A3, 0xD726, 0xA6C7, 0xCF26,
-    0xA6A7, 0xA6C7, 0x8667, 0x8667, 0x6CA6, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x3A22, 0x4DA8, 0x4DA8, 0x6E08, 0x6E28, 0x64A6,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9CE5,
-    0xD565, 0xA6C7, 0xA6A7, 0xAEC7, 0x3222, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000 },
-  { 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x34C8, 0x6CA6, 0x6E28,
-    0x9CE5, 0x9CE5, 0x3222, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6AA3, 0xD585,
-    0xD686, 0xCF26, 0xA6A7, 0x64A6, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6CA6, 0x4DA8, 0x6E28,
-    0x6608, 0x8667, 0x8667, 0xAEC7, 0x9CE5, 0x3242, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6AA3, 0xCD65, 0xF725,
-    0xF725, 0xF725, 0xD726, 0xCF26, 0xD726, 0x9CE5, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4DA8, 0x55A8, 0x6E08,
-    0x6E28, 0x8667, 0x8667, 0xA6A7, 0xA6C7, 0xD726, 0xCF26, 0xCF26,
-    0xCD65, 0x3222, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x3A42, 0xCC64, 0xFE85, 0xFE65, 0xF725,
-    0xFF25, 0xF725, 0xF725, 0xF725, 0xD726, 0xCF26, 0xCF26, 0xCF26,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x55A8, 0x4DA8, 0x6E08,
-    0x6628, 0x8667, 0x8667, 0xA6A7, 0xA6C7, 0xD726, 0xCF26, 0xF725,
-    0xCF26, 0xFF25, 0xF725, 0xF745, 0x9AA3, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x9AA3, 0xFD85, 0xFD65, 0xF665, 0xFE65, 0xFE65,
-    0xFE65, 0xF725, 0xFF25, 0xF725, 0xF725, 0xF725, 0xD726, 0xF725,
-    0xCF26, 0xD666, 0x0000, 0x0000, 0x0000, 0x3222, 0x2D69, 0x55A8,
-    0x6E28, 0x8667, 0x8667, 0xA6A7, 0xAEC7, 0xCF26, 0xA6A7, 0xD726,
-    0xCF26, 0xF725, 0xFF25, 0xF725, 0xF725, 0xF725, 0xFE65, 0xCC64,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0xCB84, 0xFB65, 0xF485, 0xFC65, 0xFD85, 0xF565, 0xFE85,
-    0xFD65, 0xFE65, 0xF665, 0xF725, 0xF725, 0xFF25, 0xF725, 0xF725,
-    0xCF26, 0xD726, 0xA6C7, 0x3222, 0x0000, 0x0000, 0x6CA6, 0x6628,
-    0x6E08, 0x8667, 0x8667, 0xA6C7, 0xA6A7, 0xCF26, 0xD726, 0xCF26,
-    0xCF26, 0xF725, 0xFF25, 0xF725, 0xF725, 0xF725, 0xFE65, 0xF665,
-    0xFE65, 0xFE85, 0xCC64, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0xCA64, 0xF365, 0xF365, 0xFC85, 0xF465, 0xFD85, 0xFC65, 0xF585,
-    0xFD65, 0xFE65, 0xFE65, 0xFE65, 0xFE65, 0xF725, 0xF725, 0xF725,
-    0xFF25, 0xF725, 0xCF26, 0xD726, 0x9CE5, 0x0000, 0x1822, 0x6E28,
-    0x4DA8, 0x8E67, 0x8667, 0x0000, 0xA6C7, 0xD726, 0xA6A7, 0xCF26,
-    0xD726, 0xF725, 0xF725, 0xF725, 0xFF25, 0xF725, 0xFE65, 0xFE65,
-    0xFD65, 0xF685, 0xFD65, 0xFD65, 0xF485, 0xCB84, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xC165,
-    0xF285, 0xF265, 0xEA85, 0xF365, 0xF365, 0xFC65, 0xF365, 0xFC85,
-    0xF465, 0xFD85, 0xFD65, 0xFE85, 0xF565, 0xFE65, 0xFE65, 0xF725,
-    0xF725, 0xCC64, 0x0000, 0xF725, 0xCF46, 0xD726, 0x1822, 0x34C8,
-    0x6E28, 0x8667, 0x8667, 0xA6A7, 0x9CE5, 0xA6C7, 0xD666, 0xCF26,
-    0xCF26, 0xFE85, 0x3222, 0xF725, 0xCC64, 0xFE65, 0xFE65, 0xFE65,
-    0xF665, 0xFE85, 0xFD65, 0xFD85, 0xF465, 0xFD85, 0xF465, 0xFC85,
-    0x9AA3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xC0C6, 0xE9C5,
-    0xE9C5, 0xEA85, 0xF265, 0xEA85, 0xF265, 0xF365, 0xF365, 0xFC85,
-    0xF465, 0xFD85, 0xF465, 0xFD85, 0xFD65, 0x9CE5, 0xFE65, 0xFE65,
-    0xFE65, 0xF725, 0xCC64, 0x9CE5, 0xFF25, 0xF725, 0xD746, 0x64A6,
-    0x6CA6, 0x6608, 0x6E28, 0x8667, 0x8667, 0xA6A7, 0xAEC7, 0x0000,
-    0xD666, 0xF725, 0xCD65, 0x0000, 0xFD85, 0xCD65, 0x0000, 0x9CE5,
-    0xFD85, 0xFE65, 0xFD65, 0xFD85, 0xF465, 0xFC85, 0xF365, 0xF365,
-    0xF365, 0xFB65, 0xEA65, 0x90C4, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x90E4, 0xE906, 0xE965,
-    0xE145, 0xE9C5, 0xE1A6, 0xE9C5, 0xE9C5, 0xEA85, 0xF285, 0xF365,
-    0xF365, 0xFC85, 0x5064, 0x0000, 0xCB84, 0xCB84, 0x0000, 0xFD85,
-    0xFD85, 0xCC64, 0x9AA3, 0xF745, 0xF725, 0xFF25, 0xCF26, 0xF725,
-    0x9CE5, 0x6628, 0x6E08, 0x8667, 0x8667, 0xA6C7, 0x0000, 0x62A3,
-    0xD726, 0xF725, 0xF725, 0xF725, 0x0000, 0x3242, 0xFD65, 0x0000,
-    0x0000, 0xFE65, 0xFD85, 0xF565, 0xCB84, 0xFC85, 0xF465, 0xFC85,
-    0xF365, 0xF365, 0xF265, 0xF285, 0xE9C5, 0xF285, 0x5884, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x5084, 0xE126, 0xE108, 0xE106,
-    0xE906, 0xE165, 0xE145, 0xE1C5, 0xE9C5, 0xF285, 0xE9C5, 0x9AA3,
-    0xF265, 0xF365, 0xF285, 0x0000, 0x90C4, 0xFC85, 0x0000, 0x1842,
-    0xFD65, 0xFE65, 0xFE65, 0xFE65, 0x1842, 0xCD65, 0xFF25, 0xF725,
-    0xF725, 0xD686, 0x9CE5, 0x8667, 0x8667, 0xAEA7, 0xA6C7, 0xA6A7,
-    0x0000, 0x6AA3, 0xD726, 0xF725, 0xF725, 0xF725, 0xD686, 0xFE65,
-    0xCC64, 0x0000, 0xCC64, 0x9AA3, 0xFC85, 0xF485, 0x9AA3, 0xCA64,
-    0xFB65, 0xF365, 0xF285, 0xEA65, 0xE9C5, 0xE9C5, 0xE145, 0xE1A6,
-    0xE126, 0x1842, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x1842, 0xE8C8, 0xE8E7, 0xE0A8, 0xE8E7,
-    0xE0E7, 0xE106, 0xE126, 0xE965, 0xE145, 0xE9C5, 0xC0C6, 0xC185,
-    0xE9C5, 0xCA64, 0xC165, 0xCA64, 0x0000, 0xF365, 0xCB84, 0xCB84,
-    0xFC85, 0xFD85, 0xF565, 0xFD85, 0x0000, 0x0000, 0xCD65, 0xF725,
-    0xF725, 0xFF25, 0xCE86, 0x8667, 0x8667, 0xA6A7, 0xA6C7, 0xCF26,
-    0xD726, 0xCC64, 0x64A6, 0xF725, 0xFF25, 0xF725, 0xF725, 0xF725,
-    0xFE65, 0xFE85, 0x9AA3, 0xCB84, 0x0000, 0xF485, 0xFC65, 0xF485,
-    0x0000, 0x9AA3, 0xF285, 0xEA65, 0xE9C5, 0xEA85, 0xE9C5, 0xE9C5,
-    0xE965, 0xE165, 0xE906, 0x90C4, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x988B, 0xE0A8, 0xE8AA, 0xE0C8, 0xE0A8,
-    0xE0C8, 0xE108, 0xE8E7, 0xE126, 0xE906, 0xE945, 0x1842, 0x5084,
-    0xE9A6, 0xF285, 0x90E4, 0x98C4, 0x90E4, 0x9AA3, 0xF365, 0xF465,
-    0xFC85, 0xF565, 0xFC85, 0xFD65, 0xFC85, 0xCC64, 0xCB84, 0xF725,
-    0xF725, 0xF725, 0xFF25, 0xF725, 0x9CE5, 0xA6C7, 0xAEA7, 0xA6C7,
-    0xD726, 0xCF26, 0xCE66, 0xD686, 0xF725, 0xF725, 0xCC64, 0x9AA3,
-    0xCC84, 0xFE65, 0xFD65, 0xFD85, 0xFC65, 0x0000, 0xCB84, 0xCA64,
-    0xEA85, 0xF365, 0xCA64, 0xF265, 0x1842, 0xE9C5, 0xE945, 0xE165,
-    0xE145, 0xE165, 0xE108, 0xE8E7, 0xE0E7, 0xC88A, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0xC8AE, 0xE0AA, 0xE8AA, 0xE0A8, 0xE0AA,
-    0xE0C8, 0xE8A8, 0xE0C8, 0xE0E7, 0xC0C6, 0xC0C6, 0xE0E7, 0xC0C6,
-    0xE945, 0xE165, 0xC165, 0xC185, 0x1842, 0xF285, 0xF265, 0xF365,
-    0xF285, 0x9AA3, 0x90C4, 0xFC85, 0xFC85, 0xFD65, 0xF485, 0xFE65,
-    0xFE65, 0xF725, 0xFE65, 0xF725, 0xFD65, 0x9CE5, 0xA6A7, 0xCF26,
-    0xA6C7, 0xD726, 0xCF26, 0x6AA3, 0x9CE5, 0xF725, 0xF725, 0xCD85,
-    0xCC64, 0xCC84, 0xFD65, 0xFD85, 0x62A3, 0xFD65, 0xF485, 0xFC65,
-    0xCA64, 0x0000, 0xEA85, 0xF285, 0xE9C5, 0x90C4, 0xE965, 0x1842,
-    0xC165, 0xE965, 0xE126, 0xE106, 0xE0E7, 0xE8E7, 0xE0A8, 0xE0C8,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0xE0AC, 0xE8AC, 0xE0AC, 0xE0AA, 0xE0AC,
-    0xE8AA, 0xE0AA, 0xE0C8, 0xC88A, 0xC0C6, 0xE8E7, 0x5084, 0xE108,
-    0xE906, 0xE165, 0x0000, 0xE145, 0xE145, 0xE9C5, 0xE9C5, 0xCA64,
-    0xF285, 0xCB84, 0xC185, 0x9AA3, 0xF365, 0xFD65, 0xFD85, 0x62A3,
-    0xCC64, 0xFE65, 0xFE65, 0xF725, 0xF665, 0xCC84, 0x1842, 0xAEC7,
-    0xA6A7, 0xD726, 0xCF26, 0xFF25, 0xCD65, 0x0000, 0xF725, 0xF725,
-    0x0000, 0x0000, 0x0000, 0x62A3, 0xCB84, 0x0000, 0xCB84, 0xFB65,
-    0xFB65, 0xF365, 0x0000, 0x0000, 0xE9C5, 0xE9C5, 0xE145, 0xE165,
-    0xE106, 0xE106, 0xE8E7, 0xE0E7, 0xE0E7, 0xE0E7, 0xE8C8, 0xE0C8,
-    0xE0A8, 0xE0AA, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0xE8AE, 0xE0AC, 0xE0AE, 0xE0AC, 0xE8AC,
-    0xE0AA, 0xE0AC, 0xE0AA, 0xE8AA, 0xE0C8, 0xE0AA, 0xE0A8, 0xE8C8,
-    0xE0E7, 0xE108, 0x0000, 0x0000, 0xE106, 0xE165, 0xE945, 0xC185,
-    0x0000, 0xCA64, 0x0000, 0x0000, 0x0000, 0x62A3, 0xFC85, 0xFC65,
-    0x0000, 0xF585, 0xFD65, 0xFE85, 0xFE65, 0xF665, 0x1822, 0x0000,
-    0x64A6, 0xCF26, 0xCF26, 0xF725, 0xFF25, 0xF725, 0x0000, 0xF725,
-    0xF685, 0xFD65, 0xCC84, 0xFD65, 0xFC85, 0xFD65, 0xCB84, 0xFC85,
-    0x5084, 0xF365, 0xEA85, 0xCA64, 0x0000, 0xE1A6, 0xE9C5, 0xE9C5,
-    0xE965, 0xE106, 0xD127, 0xD127, 0xE8C8, 0xE108, 0xE0A8, 0xE0AA,
-    0xE0AA, 0xE108, 0xE8AA, 0xE0AC, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0xE0B0, 0xE0AE, 0xE0AE, 0xE8AE, 0xE0AE,
-    0xE0AC, 0xE0AE, 0xE8AC, 0xE0AC, 0xE0AA, 0xE108, 0xE0AA, 0xE8AA,
-    0xE0C8, 0xE108, 0x0000, 0x0000, 0xE108, 0xE945, 0xC0C6, 0xC185,
-    0xC165, 0x9AC3, 0xE9C5, 0xCA64, 0xCA64, 0x9AA3, 0x9AA3, 0xFC85,
-    0xF365, 0x0000, 0xFD65, 0xFE65, 0xFE65, 0xFE85, 0x9AA3, 0x0000,
-    0x0000, 0x0000, 0xD666, 0xD726, 0xCF26, 0xF725, 0xF725, 0xFF25,
-    0xFE65, 0xFE65, 0xF565, 0xFD85, 0x9AA3, 0x9AA3, 0xFC85, 0xFC85,
-    0xCA64, 0x9AA3, 0x90C4, 0xF285, 0xE9C5, 0xC165, 0x1842, 0xE965,
-    0xE145, 0xE106, 0x90E4, 0x0000, 0x0000, 0x0000, 0x0000, 0xE8AA,
-    0xE0C8, 0xE0AA, 0xE8AA, 0xE0AC, 0xE0AC, 0xE0AC, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x986B, 0x608B, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x608B, 0x988B, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0xE8B0, 0xE0AE, 0xE0B0, 0xE0AE, 0xE8AE,
-    0xE0AE, 0xE0AE, 0xC88E, 0x0000, 0x0000, 0x0000, 0x0000, 0xC0C6,
-    0xE8C8, 0xE0AA, 0xC88A, 0x0000, 0xE0C8, 0xE0E7, 0xE8E7, 0x90C4,
-    0xC0C6, 0xE165, 0xE945, 0xE9C5, 0x90E4, 0xCA64, 0xF285, 0xF365,
-    0xF365, 0xFC65, 0xF485, 0xFD65, 0xFD85, 0xF665, 0xFD65, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x64A6, 0xCF26, 0xF725, 0xF725, 0xF725,
-    0xFE65, 0xFE85, 0x9AA3, 0xCC64, 0xFD85, 0xF565, 0xFC85, 0xCB84,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xC185, 0xE9C5, 0xE1A6,
-    0xE965, 0xC0C6, 0x0000, 0xE108, 0xE8A8, 0x0000, 0x0000, 0x0000,
-    0x1842, 0xE0AC, 0xE0AC, 0xE0AC, 0xE8AC, 0xE0AE, 0xE0AC, 0xE8AC,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE0B0, 0xE0B0, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0xC8B1, 0xE0B0, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0xE0B0, 0xE0B0, 0xE0B0, 0xE0B0, 0xE0B0,
-    0xE0AE, 0xE0B0, 0xE0AE, 0x0000, 0x0000, 0x0000, 0x0000, 0xE0AC,
-    0xE8AA, 0x0000, 0xE0AA, 0xE0AA, 0xE0C8, 0xE8E7, 0x5884, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x90C4, 0xC165, 0xCA64, 0xF285, 0xEA65,
-    0xF285, 0xCA64, 0xF365, 0xF465, 0xFC85, 0xFD65, 0xFD85, 0x62A3,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFF25, 0xF725, 0xFF25,
-    0xF725, 0xCD65, 0x0000, 0x0000, 0x0000, 0x0000, 0x90C4, 0xFC85,
-    0xFB65, 0x5084, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE945,
-    0xE165, 0xE145, 0xE8E7, 0x0000, 0x0000, 0xE0C8, 0xE0A8, 0x0000,
-    0x0000, 0x0000, 0x5084, 0xE8AC, 0xC8AE, 0xC88A, 0xE8AC, 0xE0AE,
-    0xE0AE, 0xC8AE, 0x0000, 0x0000, 0x0000, 0x0000, 0x986B, 0xE8B0,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x1842, 0xD0B1, 0x588B, 0x0000,
-    0x0000, 0x0000, 0x0000, 0xB0D1, 0xE0B0, 0xE0B0, 0xE0B0, 0xE0B0,
-    0xE8AE, 0xE0B0, 0xC88E, 0x0000, 0x0000, 0x0000, 0x0000, 0xE0AC,
-    0xE0AC, 0x5884, 0x0000, 0xE8AA, 0xE0C8, 0xE0AA, 0xC0C6, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE9C5, 0xE9C5, 0xC165,
-    0x0000, 0x0000, 0x0000, 0x0000, 0xF365, 0xFC85, 0xF485, 0xFC65,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9AA3, 0xF725,
-    0xF725, 0xF725, 0xCD65, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0xFC85, 0xFB65, 0x62A3, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0xE165, 0xE126, 0xE906, 0x90C4, 0x0000, 0x0000, 0xE0AA,
-    0xE8AA, 0x988B, 0x0000, 0x0000, 0x0000, 0xE0AE, 0xE8AE, 0x90C4,
-    0xE0AE, 0xE0B0, 0xE8B0, 0x988B, 0x0000, 0x0000, 0x0000, 0x0000,
-    0xC88E, 0xB0D1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA8B1, 0xB0D1, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x986B, 0xC8B1, 0xE0B0, 0xE0B0, 0xE8B0,
-    0xC8AE, 0xE0B0, 0xE0B0, 0x0000, 0x0000, 0x0000, 0x988B, 0xE0AE,
-    0xE0AE, 0x0000, 0x0000, 0xC88A, 0xE8AA, 0xE108, 0xE8AA, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x5084, 0xE145, 0xC165, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF365, 0xFC85, 0xFD65,
-    0x3242, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0xFF45, 0xF725, 0xFE65, 0xFE65, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x5064, 0xCA64, 0xCA64, 0xFB65, 0xF285, 0x5084, 0x0000, 0x0000,
-    0x1842, 0x2042, 0xD927, 0xE106, 0xE8E7, 0xE0E7, 0x5084, 0x0000,
-    0x0000, 0xA08B, 0xE0AA, 0xE8AA, 0x0000, 0x0000, 0x0000, 0xC88E,
-    0xE0AE, 0x988B, 0xC88E, 0xE8B0, 0xE0B0, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x988B, 0xA8B1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA08B, 0x588B,
-    0x0000, 0x0000, 0x0000, 0x0000, 0xB0B1, 0xC8B1, 0xC8B1, 0xD0AE,
-    0xC88E, 0xE0B0, 0xC8B1, 0x0000, 0x0000, 0x0000, 0xC8AE, 0xE8B0,
-    0x90C4, 0x0000, 0x0000, 0x988B, 0xE8AC, 0xE0AC, 0xE8AA, 0xC88A,
-    0x0000, 0x5084, 0x0000, 0x0000, 0x90E4, 0xE906, 0xE906, 0xE126,
-    0xC0C6, 0x1842, 0x0000, 0x0000, 0x0000, 0x0000, 0xFB65, 0xFC85,
-    0xF485, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0xF725, 0xF725, 0xFF25, 0xFE85, 0x0000, 0x0000, 0x0000,
-    0x9AC3, 0xCB84, 0x98C4, 0x5084, 0x0000, 0xEA85, 0xE9C5, 0xE9C5,
-    0xE145, 0xE165, 0xE926, 0xE106, 0xE0E7, 0xE108, 0xE0C8, 0xE8AA,
-    0xC88A, 0x0000, 0xE0AA, 0xE0AC, 0xE0AC, 0xE8AE, 0xD08E, 0x0000,
-    0x0000, 0x988B, 0xE0B0, 0xE0B0, 0xC8B1, 0xE0B0, 0xC8B1, 0x0000,
-    0x0000, 0x0000, 0x0000, 0xB0D1, 0x608B, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x588B, 0x90D1,
-    0x0000, 0x0000, 0x0000, 0x0000, 0xB0B1, 0xC8B1, 0xA8D1, 0xB0B1,
-    0xC8B1, 0xD0B1, 0x988B, 0x0000, 0x0000, 0xC88E, 0xE0B0, 0xE0B0,
-    0xE0B0, 0x588B, 0x0000, 0xE8AE, 0xE0AE, 0xE0AE, 0xE0AC, 0xE8AC,
-    0xE0AA, 0xE0AC, 0xE0AA, 0xE8AA, 0xE0C8, 0xE108, 0xC88A, 0x0000,
-    0xC0C6, 0xE165, 0xE945, 0x5884, 0x0000, 0x0000, 0x1842, 0xF365,
-    0xF365, 0xFC65, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0xCD65, 0xFF25, 0xFE65, 0xFE65, 0x90C4, 0x0000,
-    0xCB84, 0xF365, 0x0000, 0x0000, 0x0000, 0x0000, 0xE1A6, 0xE9C5,
-    0xE165, 0xE945, 0xE106, 0xE126, 0xE0E7, 0xC0C6, 0x0000, 0x90E4,
-    0xE8A8, 0xE0AA, 0xE8AA, 0xE0AC, 0x988B, 0x1842, 0xE8AC, 0xE8AE,
-    0xE0AE, 0xC88E, 0x0000, 0x0000, 0xE0B0, 0xE0B0, 0xC8B1, 0xC8B1,
-    0x988B, 0x0000, 0x0000, 0x0000, 0xA06B, 0xA8D1, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x90D1,
-    0x608B, 0x0000, 0x0000, 0x0000, 0x988B, 0xB0B1, 0xA8D1, 0xB0B1,
-    0xA8D1, 0xD0B1, 0x0000, 0x0000, 0x986B, 0xE0B0, 0xC8B1, 0xE8B0,
-    0x988B, 0xE0B0, 0xE8AE, 0xE0B0, 0xE0AE, 0xE0AE, 0xC88E, 0xC88A,
-    0xC8AA, 0xE8AC, 0xE0AA, 0xE0AA, 0xE0C8, 0xE8A8, 0xE0C8, 0x90C4,
-    0x0000, 0x0000, 0x0000, 0x5884, 0xC185, 0x5884, 0x0000, 0xC165,
-    0xF285, 0xFB65, 0xCA64, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0xCC64, 0xFE65, 0xFE65, 0xFE85, 0x9CE5,
-    0x5084, 0xFC85, 0x0000, 0x0000, 0x0000, 0x0000, 0xC165, 0xEA85,
-    0xE9C5, 0xE9C5, 0xC0C6, 0xE106, 0xE0E7, 0xE108, 0xE8C8, 0xE8A8,
-    0x0000, 0x0000, 0x1842, 0xE0AC, 0xE8AC, 0x988B, 0x0000, 0x0000,
-    0x986B, 0xE0B0, 0xE0B0, 0xE8B0, 0xC8AE, 0xA8D1, 0xC8B1, 0xE8B0,
-    0xC8B1, 0xD0B1, 0x608B, 0x0000, 0x0000, 0x1842, 0x90D1, 0x608B,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x608B,
-    0x78D1, 0x0000, 0x0000, 0x0000, 0x1842, 0xA8D1, 0x90D1, 0xA8D1,
-    0x90D1, 0xB0D1, 0x1842, 0xB0B1, 0xA8D1, 0xD0B1, 0xC8B1, 0xA8B1,
-    0x0000, 0x0000, 0xC8AE, 0xE0B0, 0xE8B0, 0x588B, 0x0000, 0x0000,
-    0xC88E, 0xE0AE, 0xE8AC, 0xE0AC, 0xE0AA, 0xE0AA, 0xE8C8, 0xE0A8,
-    0xE8C8, 0x0000, 0x0000, 0x0000, 0x0000, 0x90C4, 0xC185, 0x0000,
-    0xE9C5, 0xF365, 0xF365, 0x9AA3, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x62A3, 0xFE65, 0xFD65, 0xFD85,
-    0xFC65, 0xCC84, 0x9AA3, 0x0000, 0x0000, 0x0000, 0x0000, 0xF285,
-    0xE9C5, 0xE1C5, 0xC165, 0xE106, 0x0000, 0x90E4, 0xE8A8, 0xE0C8,
-    0xE8A8, 0xE0AA, 0x5084, 0x0000, 0x608B, 0xE8AC, 0xE0AC, 0xE0AE,
-    0x0000, 0x0000, 0x0000, 0xE0B0, 0xE0B0, 0xE0B0, 0xC8B1, 0xC8B1,
-    0xD0B1, 0xC8B1, 0x988B, 0xB0B1, 0x0000, 0x0000, 0x0000, 0x78F1,
-    0x588B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x608B, 0x6111, 0x0000, 0x0000, 0x0000, 0x78D1, 0x78F1, 0x78D1,
-    0x90D1, 0x90F1, 0x90D1, 0xA8D1, 0xB0D1, 0xA8B1, 0xB0D1, 0x1842,
-    0x0000, 0x0000, 0xD0B1, 0xE0B0, 0xE0B0, 0x986B, 0x0000, 0x5884,
-    0xE8AE, 0xE0AE, 0xE8AC, 0xE0AC, 0x988B, 0x986B, 0xC88A, 0xE8AA,
-    0xE0C8, 0xE8C8, 0xC0C6, 0x0000, 0x0000, 0x0000, 0x0000, 0xC165,
-    0x90E4, 0xF285, 0xF265, 0xF365, 0x5084, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFE65, 0xFE85,
-    0xFD65, 0xFD85, 0xFC85, 0x1842, 0x0000, 0x0000, 0x0000, 0x5084,
-    0xE9C5, 0xE9C5, 0xE145, 0xE965, 0x5884, 0x0000, 0x0000, 0x90C4,
-    0xE0C8, 0xE0AA, 0xE8AA, 0xE8AC, 0x90C4, 0x90E4, 0xE0AC, 0xE0AE,
-    0xE8AE, 0xE0B0, 0xE0B0, 0x608B, 0x1842, 0xE8B0, 0xC8B1, 0x608B,
-    0x0000, 0xC8B1, 0xA8B1, 0xB0D1, 0x90D1, 0x78F1, 0x0000, 0x0000,
-    0x2042, 0x78D1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x1842, 0x6911, 0x1842, 0x0000, 0x0000, 0x6111, 0x78F1, 0x78D1,
-    0x78F1, 0x90D1, 0x78F1, 0x608B, 0x986B, 0xB0D1, 0xB0B1, 0x0000,
-    0x1842, 0xC8B1, 0xC8B1, 0xD0B1, 0xC8B1, 0xE0B0, 0x0000, 0x988B,
-    0xE0B0, 0xE0B0, 0xE0AE, 0xE8AE, 0x5084, 0x0000, 0x0000, 0xC88A,
-    0xE8AA, 0xE0AA, 0xE0C8, 0xE0E7, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x90C4, 0xE9C5, 0xE9C5, 0xF265, 0xF285, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFE65,
-    0xFD65, 0xF565, 0xFC85, 0xF465, 0x1842, 0x0000, 0x0000, 0x0000,
-    0x0000, 0xE9C5, 0xE945, 0xE165, 0xE106, 0xE8E7, 0x1842, 0x0000,
-    0x0000, 0x90E4, 0xE8A8, 0xE0AA, 0xE8AA, 0xE0AC, 0xE0AC, 0xE0AE,
-    0xE8AE, 0xC8AE, 0xE0AE, 0xE0B0, 0xE0B0, 0xE0B0, 0xC8B1, 0xC8B1,
-    0xB0B1, 0x0000, 0x0000, 0x588B, 0x90D1, 0xB0D1, 0x88D1, 0x0000,
-    0x0000, 0x0000, 0x608B, 0x4951, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x4931, 0x608B, 0x0000, 0x0000, 0x0000, 0x4951, 0x6111,
-    0x6911, 0x78F1, 0x190B, 0x0000, 0x0000, 0x90D1, 0x90D1, 0x90F1,
-    0x90D1, 0xA8D1, 0xB0D1, 0xC8B1, 0x986B, 0xD0B1, 0xC8B1, 0xC8B1,
-    0xE8B0, 0xE0B0, 0xE0AE, 0xE0B0, 0x1842, 0x0000, 0x0000, 0x1842,
-    0xD0AE, 0xE8AC, 0xE0A8, 0xE8AA, 0xE0C8, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x90C4, 0xE965, 0xE9C5, 0xE9C5, 0xEA85, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0xFD65, 0xFE85, 0xFD65, 0xF585, 0xFC85, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0xC165, 0xE9C5, 0xE165, 0xE945, 0xE108, 0xE0E7,
-    0xE8C8, 0xE108, 0x90E4, 0xE0AC, 0xE0AA, 0xE0AC, 0xE8AC, 0xE0AE,
-    0xE0AE, 0xE0B0, 0xE0B0, 0xE0B0, 0xE0B0, 0xE8B0, 0xC8B1, 0xC8B1,
-    0xC8B1, 0xD0B1, 0x90D1, 0x0000, 0x0000, 0x588B, 0x90F1, 0x90D1,
-    0x6911, 0x0000, 0x0000, 0x608B, 0x4951, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x4931, 0x608B, 0x0000, 0x0000, 0x4951, 0x6111,
-    0x4931, 0x6111, 0x0000, 0x0000, 0x0000, 0x78D1, 0x78F1, 0x90F1,
-    0x88D1, 0xB0D1, 0x90D1, 0xA8B1, 0xB0D1, 0xC8B1, 0xC8B1, 0xC8B1,
-    0xC8B1, 0xE0B0, 0xE0B0, 0xE8B0, 0xC88E, 0x0000, 0x988B, 0xE0AE,
-    0xE0AC, 0xE8AC, 0xE0AA, 0xE0AC, 0xE8A8, 0x988B, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x90C4, 0xE9C5, 0xE9C5, 0xEA65, 0xCA64, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0xF465, 0xFD85, 0xFD65, 0xF485, 0xFC65, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0xE9C5, 0xE145, 0xE165, 0xE108, 0xE0E7,
-    0xE0A8, 0xE0C8, 0xE8A8, 0xE0AA, 0xE0AA, 0xE0AC, 0xE8AC, 0xE0AE,
-    0xE0AE, 0xE0AE, 0xE8AE, 0xE0B0, 0xE0B0, 0xE0B0, 0xC8B1, 0xC8B1,
-    0xC8B1, 0xC8B1, 0xB0D1, 0xA8B1, 0x1842, 0x0000, 0x0000, 0x78F1,
-    0x78D1, 0x6911, 0x1842, 0x0000, 0x0000, 0x4931, 0x210B, 0x0000,
-    0x0000, 0x0000, 0x190B, 0x5151, 0x0000, 0x0000, 0x1842, 0x5131,
-    0x3191, 0x4951, 0x190B, 0x0000, 0x0000, 0x5131, 0x6111, 0x6911,
-    0x78F1, 0x78F1, 0x78D1, 0x90D1, 0x90F1, 0xA8D1, 0xB0B1, 0xC8B1,
-    0xC8B1, 0xC8B1, 0xD0B1, 0xE0B0, 0xE0B0, 0xE0B0, 0xE0AE, 0xE8AE,
-    0xE0AE, 0xE0AE, 0xE0AC, 0xE8AC, 0xE0AA, 0xE0AA, 0xC0C6, 0x0000,
-    0x0000, 0x0000, 0x0000, 0xC185, 0xE945, 0xE9C5, 0xE9C5, 0xC185,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x9AA3, 0xFD65, 0xF485, 0xFC65, 0xFC85, 0xCA64,
-    0x0000, 0x0000, 0x0000, 0xC185, 0xE165, 0xE106, 0x0000, 0xC0C6,
-    0xE0A8, 0xE108, 0xE8C8, 0xE0AA, 0xE0AA, 0xE0AC, 0xE8AC, 0xE0AE,
-    0xE0AE, 0xE0B0, 0xE0AE, 0xE0B0, 0xE8AE, 0xE0B0, 0xC8B1, 0xD0B1,
-    0xC8B1, 0xC8B1, 0xB0B1, 0xA8D1, 0x90D1, 0xB0D1, 0x0000, 0x0000,
-    0x78F1, 0x6111, 0x210B, 0x6111, 0x0000, 0x0000, 0x210B, 0x4931,
-    0x0000, 0x0000, 0x0000, 0x3191, 0x190B, 0x0000, 0x0000, 0x4951,
-    0x3191, 0x0000, 0x3191, 0x4931, 0x0000, 0x608B, 0x4931, 0x6111,
-    0x6111, 0x78F1, 0x78F1, 0x90D1, 0x78F1, 0x90D1, 0x88D1, 0xB0D1,
-    0xA8B1, 0xD0B1, 0xC8B1, 0xE0B0, 0xC8B1, 0xE0B0, 0xE0B0, 0xE0B0,
-    0xE0AE, 0xE0B0, 0xE0AE, 0xE8AE, 0x988B, 0xC0C6, 0xE0AA, 0xE8AA,
-    0x1842, 0x0000, 0x0000, 0x0000, 0xE106, 0xE965, 0xE145, 0xE9C5,
-    0x5084, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x5084, 0xFD85, 0xFD85, 0xFC65, 0xFC85,
-    0xF365, 0xCA64, 0x0000, 0x0000, 0xC165, 0xE9C5, 0x5084, 0x0000,
-    0x0000, 0x0000, 0xC88A, 0xE8C8, 0xE0AA, 0xE8AC, 0xE0AA, 0xE0AC,
-    0xC88E, 0xC8AE, 0x5884, 0x1842, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x5884, 0xB0B1, 0x90D1, 0x90F1, 0x78F1, 0x78D1,
-    0x588B, 0x6111, 0x0000, 0x0000, 0x4931, 0x608B, 0x0000, 0x0000,
-    0x3191, 0x190B, 0x0000, 0x210B, 0x3191, 0x0000, 0x0000, 0x190B,
-    0x3191, 0x3191, 0x0000, 0x3191, 0x3191, 0x190B, 0x3191, 0x4951,
-    0x4931, 0x6911, 0x4951, 0x608B, 0x1842, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x608B, 0x608B, 0x90D1, 0xB0D1, 0xC8B1, 0xD0B1, 0xE0B0,
-    0xE0B0, 0xE0B0, 0xE0AE, 0xC8AE, 0x0000, 0x0000, 0x0000, 0xE8AA,
-    0xE0A8, 0x90E4, 0x0000, 0x0000, 0xC0C6, 0xE906, 0xE106, 0xE165,
-    0xE9C5, 0x1842, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFD85, 0xF465, 0xFC85,
-    0xF365, 0xF365, 0xF265, 0xEA85, 0xE9C5, 0xE9C5, 0xE165, 0xE165,
-    0xE906, 0xE106, 0xE0C8, 0xE0A8, 0xE8C8, 0xE908, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1842, 0x78F1, 0x90D1,
-    0x78D1, 0x78F1, 0x6911, 0x1842, 0x0000, 0x4951, 0x3191, 0x0000,
-    0x0000, 0x3191, 0x3191, 0x0000, 0x09EE, 0x3191, 0x0000, 0x0000,
-    0x21F2, 0x2212, 0x210B, 0x0000, 0x190B, 0x2212, 0x3191, 0x4951,
-    0x3191, 0x4931, 0x2042, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x1842, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x988B, 0xE0B0, 0xE0B0, 0xE0AE, 0xE0AE, 0xE0AC, 0xE8AC,
-    0xE0AA, 0xE108, 0xC88A, 0xE0A8, 0xE0C8, 0xE926, 0xE106, 0xE145,
-    0xE965, 0xE9C5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCC64, 0xFC85,
-    0xF365, 0xF365, 0xF265, 0xEA85, 0xE9C5, 0xE9C5, 0xE145, 0xE145,
-    0xE106, 0xE126, 0xE8C8, 0xE0A8, 0xE0C8, 0xE0AA, 0xE8AA, 0xE0AA,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x6111, 0x4931, 0x4931, 0x4951, 0x0000, 0x190B, 0x3191,
-    0x210B, 0x0000, 0x1842, 0x2212, 0x2212, 0x21F2, 0x0000, 0x0000,
-    0x210B, 0x2212, 0x2212, 0x0000, 0x1842, 0x21F2, 0x3191, 0x3191,
-    0x3191, 0x190B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0xD0B1, 0xE8B0, 0xE0AE, 0xE8AE, 0xE0AC, 0xE0AE,
-    0xE0AC, 0xE8AC, 0xE0AA, 0xE0AA, 0xE0C8, 0xE8A8, 0xE0C8, 0xE106,
-    0xE106, 0xE965, 0xC185, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCB84,
-    0xF485, 0xFC65, 0xF365, 0xF365, 0xF285, 0xEA85, 0xE9C5, 0xE9C5,
-    0xE165, 0xE106, 0xE8E7, 0xE0E7, 0xE0C8, 0xE0AA, 0xC88A, 0xE8AC,
-    0xE8AC, 0xA08B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x4931, 0x4931, 0x4931, 0x3191, 0x0000,
-    0x2991, 0x2212, 0x0000, 0x3191, 0x2212, 0x1A53, 0x21F2, 0x3191,
-    0x0000, 0x12B4, 0x1A53, 0x2212, 0x0000, 0x1A53, 0x2212, 0x2212,
-    0x09EE, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0xA8B1, 0xE0B0, 0xE0B0, 0xC8B1, 0xE8AE, 0xE0AE,
-    0xE0AC, 0xE0AE, 0xE8AC, 0xE0AC, 0xE0AA, 0xE0AA, 0xE8C8, 0xE0E7,
-    0xE0E7, 0xE145, 0xE965, 0x90C4, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x1842, 0xFC65, 0xFB65, 0xF365, 0xF285, 0xEA65, 0xE9C5, 0xE9C5,
-    0xE145, 0xE165, 0x90C4, 0x0000, 0x90E4, 0xE8A8, 0xE0C8, 0xE8AA,
-    0xE0AA, 0xE0AC, 0xE0AC, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4931, 0x2991, 0x3191,
-    0x3191, 0x190B, 0x3191, 0x2042, 0x09EE, 0x1A73, 0x1A53, 0x12B4,
-    0x09EE, 0x2042, 0x1A53, 0x12B4, 0x0000, 0x1AB4, 0x1A53, 0x1A53,
-    0x210B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x5884, 0xE8B0, 0xE0B0, 0xE0B0, 0xE0AE, 0xE0B0,
-    0xE0AE, 0x988B, 0x1842, 0xE8AC, 0xE8AA, 0xE0AA, 0xE8A8, 0xE0C8,
-    0xE0A8, 0xE108, 0xE108, 0xE165, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0xF485, 0xFC65, 0xF365, 0xF365, 0xF285, 0xF285,
-    0xE1C6, 0xE1A6, 0xE165, 0xE106, 0xC0C6, 0xE108, 0xE8C8, 0xE0AA,
-    0xE0AA, 0xE8AC, 0xC88A, 0xC8AE, 0xE8AE, 0x2042, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4931,
-    0x2991, 0x21F2, 0x3191, 0x2212, 0x1A53, 0x3A42, 0x1AB4, 0x12B4,
-    0x1AB4, 0x190B, 0x1AB4, 0x0B56, 0x210B, 0x1356, 0x12B4, 0x1AB4,
-    0x09EE, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1842, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x608B, 0xC8B1, 0xA8D1, 0xE0B0, 0xE0B0, 0xE0B0,
-    0xE0AE, 0xE8B0, 0xC88E, 0xC8AE, 0xE0AC, 0xE0AC, 0xE0AA, 0xE8AA,
-    0xE0C8, 0xE108, 0xE0E7, 0xE106, 0xE906, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0xCA64, 0xF365, 0xFB65, 0xEA65, 0xF285,
-    0xE9C5, 0xC0C6, 0xE145, 0xE106, 0xE0E7, 0xE0E7, 0xE8C8, 0xE0A8,
-    0xE0C8, 0xE0AA, 0xE8AA, 0xE0AC, 0xC88E, 0xE0AE, 0xC8B1, 0x988B,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1842, 0x3191,
-    0x3191, 0x2212, 0x3191, 0x21F2, 0x2212, 0x12B4, 0x2042, 0x12B4,
-    0x1AB4, 0x0B56, 0x0000, 0x1356, 0x1356, 0x0B33, 0x12B4, 0x1356,
-    0x12B4, 0x1AB4, 0x1A53, 0x210B, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x608B, 0xB0B1, 0xA8D1, 0x986B, 0xD0B1, 0xE0B0,
-    0xE0B0, 0xE0B0, 0xE8AE, 0xE0AE, 0xE0AC, 0xE0AC, 0xE8AA, 0xE0AA,
-    0x988B, 0xE8A8, 0xE0C8, 0xE0E7, 0xE0E7, 0xC0C6, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFC65, 0xF365, 0xF285,
-    0xE9C5, 0xC185, 0x90C4, 0xC185, 0xE126, 0xE906, 0xE0E7, 0xE0A8,
-    0xE0C8, 0xE8AA, 0xE0AA, 0xE0AC, 0xE0AC, 0xE8AE, 0xE8AE, 0x1842,
-    0xD08E, 0xD0AE, 0x5884, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x1842, 0x608B, 0x4951, 0x4931, 0x4931,
-    0x3191, 0x2212, 0x21F2, 0x2042, 0x2212, 0x1AB4, 0x12B4, 0x1356,
-    0x12B4, 0x1356, 0x1356, 0x0BF8, 0x1356, 0x0BD8, 0x0B56, 0x2042,
-    0x12B4, 0x1356, 0x1356, 0x1356, 0x12B4, 0x1AB4, 0x2212, 0x1842,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x1842, 0x78D1, 0xB0D1, 0x588B, 0xC8B1, 0xC8B1, 0xE0B0,
-    0xE0B0, 0xE0B0, 0xE0B0, 0xE0B0, 0xE8AE, 0xE0AE, 0xE0AC, 0xE0AC,
-    0xE8AA, 0x5884, 0xE0A8, 0xE0C8, 0xE0E7, 0xE906, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9AA3, 0xF365,
-    0xF285, 0xF285, 0xE145, 0x90C4, 0x0000, 0xC0C6, 0xE0E7, 0xE8E7,
-    0xE0C8, 0xE0AA, 0xE0AA, 0xE8AA, 0x0000, 0xE0AE, 0xE0AC, 0xC88E,
-    0x0000, 0x1842, 0xE8B0, 0xE0B0, 0xC8B1, 0xC8B1, 0xB0D1, 0xA8B1,
-    0x90D1, 0x78F1, 0x78F1, 0x78D1, 0x6111, 0x6111, 0x4931, 0x4951,
-    0x0000, 0x3191, 0x3191, 0x2212, 0x2212, 0x12B4, 0x1A53, 0x1A53,
-    0x12B4, 0x1356, 0x1356, 0x0BD8, 0x0BD8, 0x0BF8, 0x1356, 0x0BD8,
-    0x0B56, 0x0B33, 0x1356, 0x1356, 0x190B, 0x210B, 0x1A53, 0x1A53,
-    0x2212, 0x2212, 0x09EE, 0x3191, 0x2042, 0x190B, 0x2042, 0x4931,
-    0x608B, 0x78F1, 0x78D1, 0x90D1, 0x0000, 0x0000, 0xB0D1, 0xC8B1,
-    0xC8B1, 0xA08B, 0xE0B0, 0xE0B0, 0xE0AE, 0xE8AE, 0xE0AC, 0xE0AC,
-    0x0000, 0x90C4, 0x988B, 0xE8A8, 0xE8C8, 0xE0E7, 0x90C4, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0xF285, 0xF365, 0xE9C5, 0xE9C5, 0xE165, 0xC0C6, 0xE126, 0xE906,
-    0xE0A8, 0x988B, 0xE8AA, 0xE8AA, 0x5084, 0x0000, 0x986B, 0xE8AE,
-    0xE0AE, 0xE0B0, 0xE0B0, 0xE0B0, 0xC8B1, 0xE8B0, 0xC8B1, 0xC8B1,
-    0xB0D1, 0xA8B1, 0x78F1, 0x608B, 0x6911, 0x6111, 0x0000, 0x0000,
-    0x0000, 0x2042, 0x3191, 0x21F2, 0x2212, 0x12B4, 0x1AD4, 0x09EE,
-    0x0000, 0x1356, 0x0B56, 0x0BD8, 0x0BD8, 0x0C99, 0x0BD8, 0x0000,
-    0x0BD8, 0x0499, 0x0BD8, 0x0BD8, 0x1356, 0x0B33, 0x0000, 0x0000,
-    0x0000, 0x1A53, 0x2212, 0x2212, 0x190B, 0x4951, 0x3191, 0x4931,
-    0x4931, 0x6111, 0x78F1, 0x90F1, 0x90D1, 0xB0B1, 0x988B, 0xC8B1,
-    0xD0B1, 0x588B, 0x0000, 0x608B, 0xE0B0, 0xE0B0, 0x986B, 0xE0AE,
-    0xE0AC, 0xE8AC, 0x5884, 0xE0AC, 0xE0C8, 0xE0A8, 0xE8C8, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x90C4, 0xE9C5, 0xE9C5, 0xE145, 0xE106, 0xE126,
-    0xC0C6, 0x90E4, 0xC88A, 0xE8AA, 0xC88A, 0x0000, 0x0000, 0x1842,
-    0xE8AE, 0xE0AE, 0xE0AE, 0xE0B0, 0x1842, 0x0000, 0xD0B1, 0xA8D1,
-    0xA08B, 0xA8B1, 0x90D1, 0x90F1, 0x588B, 0x6111, 0x0000, 0x0000,
-    0x0000, 0x3191, 0x3191, 0x2991, 0x3191, 0x1A53, 0x2212, 0x09EE,
-    0x0000, 0x0000, 0x1356, 0x0BF8, 0x0BD8, 0x0499, 0x0BD8, 0x0C79,
-    0x0000, 0x0000, 0x0BD8, 0x0499, 0x0BD8, 0x0BD8, 0x1356, 0x1356,
-    0x190B, 0x0000, 0x0000, 0x2212, 0x2212, 0x09EE, 0x3191, 0x3191,
-    0x3191, 0x0000, 0x4931, 0x6911, 0x0000, 0x90D1, 0x90F1, 0xA8D1,
-    0xB0B1, 0xC8B1, 0x0000, 0x0000, 0x0000, 0xE0B0, 0xE8AE, 0xC8AE,
-    0x986B, 0xE8AE, 0xE0AC, 0xE0AC, 0xE8AA, 0xE0AA, 0x90E4, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x90C4, 0xC185, 0xE965,
-    0xE108, 0xE108, 0xC88A, 0xE0A8, 0xE8C8, 0xC88A, 0x5884, 0x5884,
-    0x5084, 0xE0AE, 0xE8AE, 0xD0AE, 0x0000, 0x0000, 0x588B, 0xC8B1,
-    0x90D1, 0x0000, 0xB0D1, 0xA8D1, 0x90D1, 0x90D1, 0x2042, 0x0000,
-    0x0000, 0x4931, 0x3191, 0x2042, 0x1842, 0x2212, 0x2212, 0x1AB4,
-    0x0000, 0x0000, 0x09EE, 0x0BF8, 0x0BD8, 0x0C79, 0x0479, 0x0C79,
-    0x0479, 0x0000, 0x0000, 0x3A22, 0x0479, 0x0C99, 0x0BD8, 0x0000,
-    0x12D4, 0x1356, 0x09EE, 0x0000, 0x0000, 0x2212, 0x2991, 0x3191,
-    0x3191, 0x4931, 0x0000, 0x6111, 0x6911, 0x0000, 0x0000, 0x1842,
-    0x90D1, 0xC8B1, 0xC8B1, 0x0000, 0x0000, 0x0000, 0xC8AE, 0xE0B0,
-    0xE0AE, 0xE0AE, 0xE8AC, 0xE0AC, 0xE8AA, 0x986B, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x1842, 0x5884, 0x98E4, 0xC0C6, 0xC88A, 0xC88A, 0xE8AA,
-    0xC8AE, 0xE0AC, 0xE8AE, 0xE0AE, 0x5084, 0xB0D1, 0x0000, 0xC8B1,
-    0xC8B1, 0xD0B1, 0x0000, 0x986B, 0x90D1, 0x90F1, 0x78F1, 0x6111,
-    0x1842, 0x4931, 0x210B, 0x0000, 0x0000, 0x3191, 0x2212, 0x1A53,
-    0x0000, 0x0000, 0x0000, 0x09EE, 0x0BF8, 0x0479, 0x0BD8, 0x0499,
-    0x0C79, 0x0479, 0x0000, 0x0000, 0x0000, 0x0BD8, 0x0BD8, 0x0BF8,
-    0x210B, 0x0000, 0x210B, 0x12B4, 0x09EE, 0x2042, 0x2212, 0x2212,
-    0x3191, 0x3191, 0x0000, 0x0000, 0x4931, 0x6111, 0x608B, 0x6111,
-    0x190B, 0x78D1, 0xB0D1, 0xD0B1, 0x986B, 0xB0D1, 0x986B, 0xD0AE,
-    0x986B, 0xD0AE, 0x5084, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x2042, 0x1842, 0x0000, 0x1842, 0xE0B0, 0xA06B, 0xC8AE,
-    0xC8B1, 0xC8B1, 0xD0B1, 0xA8B1, 0x608B, 0xB0D1, 0x90D1, 0x78F1,
-    0x6111, 0x6911, 0x606B, 0x0000, 0x0000, 0x0000, 0x2212, 0x1A53,
-    0x0A0E, 0x0000, 0x0000, 0x0000, 0x09EE, 0x0BD8, 0x0BD8, 0x0479,
-    0x0C79, 0x0479, 0x0C79, 0x0000, 0x0000, 0x0000, 0x0000, 0x0499,
-    0x0BD8, 0x0BF8, 0x0000, 0x0000, 0x0000, 0x1AB4, 0x1A53, 0x1A53,
-    0x3191, 0x2212, 0x190B, 0x4931, 0x4931, 0x6911, 0x6111, 0x78F1,
-    0x608B, 0x90D1, 0x1842, 0x0000, 0x0000, 0x608B, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x5884, 0xE8B0, 0xE0AE, 0xE0B0,
-    0xE0B0, 0xE0B0, 0xC8B1, 0xC8B1, 0xB0D1, 0xA8B1, 0x90D1, 0x90F1,
-    0x78F1, 0x6111, 0x4931, 0x4931, 0x0000, 0x0000, 0x190B, 0x2212,
-    0x2212, 0x0000, 0x0000, 0x0000, 0x0000, 0x09EE, 0x0BF8, 0x0C79,
-    0x0C79, 0x0479, 0x0C79, 0x0479, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0B33, 0x0479, 0x0BD8, 0x2042, 0x0000, 0x09EE, 0x1A73, 0x1A53,
-    0x2212, 0x21F2, 0x3191, 0x3191, 0x3191, 0x4931, 0x4951, 0x6911,
-    0x78F1, 0x78D1, 0x90D1, 0xA8D1, 0x1842, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0xC88E, 0xE0AE, 0xE8AE, 0xE0B0,
-    0xE0B0, 0xE0B0, 0xC8B1, 0xD0B1, 0x988B, 0xA8B1, 0xB0D1, 0x90D1,
-    0x78F1, 0x78F1, 0x6111, 0x6911, 0x4931, 0x5151, 0x190B, 0x3191,
-    0x3191, 0x3191, 0x0000, 0x0000, 0x0000, 0x0000, 0x09EE, 0x0BD8,
-    0x0BD8, 0x0479, 0x0C79, 0x0479, 0x0C99, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0BD8, 0x0BF8, 0x1356, 0x0333, 0x1AB4, 0x12B4,
-    0x1A53, 0x1A53, 0x2212, 0x3191, 0x3191, 0x4931, 0x4931, 0x6111,
-    0x6111, 0x78F1, 0x90F1, 0x88D1, 0x90D1, 0xD0B1, 0xB0D1, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x988B, 0xE8AC, 0xE0AE, 0xE8AE, 0xE0AE,
-    0xE0AE, 0xE0B0, 0xC8B1, 0xE0B0, 0xA8B1, 0x0000, 0xB0D1, 0xA8B1,
-    0x90D1, 0x90F1, 0x6111, 0x6111, 0x4931, 0x4951, 0x3191, 0x3191,
-    0x3191, 0x2212, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x09EE,
-    0x0BF8, 0x0479, 0x0BD8, 0x0499, 0x0C79, 0x0479, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x210B, 0x0BD8, 0x0BD8, 0x12B4, 0x1AB4,
-    0x1A53, 0x1A53, 0x2212, 0x2212, 0x3191, 0x3191, 0x3191, 0x1842,
-    0x210B, 0x60F1, 0x78F1, 0x90D1, 0x90D1, 0xB0D1, 0xA8D1, 0xC8B1,
-    0xD0B1, 0x986B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0xE0AC, 0xE0AA, 0xE8AE, 0xE0AC, 0xE0AE,
-    0xE8AE, 0xE0B0, 0xE0B0, 0xE0B0, 0xA8B1, 0xB0D1, 0xA8B1, 0xD0B1,
-    0x78F1, 0xB0D1, 0x90D1, 0x1842, 0x6111, 0x6911, 0x4931, 0x4931,
-    0x3191, 0x2212, 0x210B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x12B4, 0x0BF8, 0x0BD8, 0x0C79, 0x0479, 0x0C79, 0x0479, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0BF8, 0x1356, 0x1356,
-    0x12B4, 0x12B4, 0x1A53, 0x0000, 0x3191, 0x2212, 0x3191, 0x4931,
-    0x4951, 0x4931, 0x6111, 0x78F1, 0x90D1, 0xB0B1, 0xA8D1, 0xC8B1,
-    0xC8B1, 0xE8B0, 0xC8B1, 0xE0B0, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x5084, 0xE8AA, 0xE8AA, 0xE0AC, 0xE0AC, 0xE0AE,
-    0xE8AE, 0xE0AE, 0xE0AE, 0xC8AE, 0xE0B0, 0xE0B0, 0xC8B1, 0xB0B1,
-    0xA8D1, 0x78D1, 0x90D1, 0x90F1, 0x0000, 0x6111, 0x4931, 0x4951,
-    0x3191, 0x4931, 0x3191, 0x2991, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0B33, 0x0B56, 0x0BF8, 0x0BF8, 0x0C79, 0x0BD8, 0x0BF8,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0B33, 0x0B56, 0x1356,
-    0x1AB4, 0x12B4, 0x2212, 0x21F2, 0x0000, 0x3191, 0x3191, 0x3191,
-    0x3191, 0x4931, 0x4951, 0x6111, 0x78F1, 0x90D1, 0x90D1, 0xB0D1,
-    0xA8D1, 0xD0B1, 0xC8B1, 0xE0B0, 0xE0B0, 0xE0B0, 0x1842, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0xC0C6, 0xE8A8, 0xE0C8, 0xE0AC, 0xE0AA, 0xE8AC,
-    0xE0AC, 0xE0AE, 0xE8AE, 0xE0B0, 0xC8B1, 0xE0B0, 0xC8B1, 0xD0B1,
-    0xA8B1, 0xD0B1, 0x588B, 0xB0D1, 0x90F1, 0x90D1, 0x6111, 0x6911,
-    0x4931, 0x4931, 0x190B, 0x3191, 0x3191, 0x2212, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x1AB4, 0x1356, 0x0B56, 0x0BF8, 0x0BD8, 0x0C79,
-    0x0BD8, 0x0000, 0x0000, 0x0000, 0x0000, 0x3242, 0x1356, 0x1356,
-    0x1A53, 0x0B33, 0x12B4, 0x1A53, 0x2212, 0x2991, 0x3191, 0x3191,
-    0x3191, 0x4951, 0x4931, 0x6111, 0x6111, 0x90F1, 0x90D1, 0x78D1,
-    0xA8D1, 0x78D1, 0xB0D1, 0xC8B1, 0xC8B1, 0xE0B0, 0xE0B0, 0xE0B0,
-    0xA06B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0xC0C6, 0xE0E7, 0xE0C8, 0xE0AA, 0xE8AA, 0xE0AC,
-    0xE0AC, 0xE0AE, 0xE8AC, 0xE0AE, 0x5084, 0x5884, 0xE8B0, 0xE0B0,
-    0x0000, 0xC8B1, 0xA8B1, 0x90D1, 0x90F1, 0x88D1, 0x78F1, 0x78F1,
-    0x6111, 0x6111, 0x0000, 0x0000, 0x210B, 0x3191, 0x2991, 0x210B,
-    0x0000, 0x0000, 0x0000, 0x12B4, 0x12B4, 0x1356, 0x1356, 0x0BD8,
-    0x0BF8, 0x0BD8, 0x0000, 0x0000, 0x0000, 0x0000, 0x1356, 0x0B56,
-    0x1AB4, 0x0000, 0x0000, 0x1A53, 0x2212, 0x2212, 0x3191, 0x3191,
-    0x3191, 0x4931, 0x4931, 0x6111, 0x210B, 0x0000, 0x78F1, 0x90D1,
-    0x0000, 0x90D1, 0xA8D1, 0xD0B1, 0xC8B1, 0xE0B0, 0xE0B0, 0xE0B0,
-    0xE8AE, 0xE0AE, 0xC8AE, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0xE906, 0xE106, 0xE0E7, 0xE108, 0xE0C8, 0xE8AA,
-    0xE0AA, 0xE0AC, 0xE0AC, 0xE8AE, 0xE0AE, 0xE0B0, 0xC8B1, 0xE0B0,
-    0xE8B0, 0xC88E, 0xC8B1, 0xC8B1, 0xB0D1, 0xA8D1, 0x90D1, 0x90D1,
-    0x78F1, 0x78D1, 0x6911, 0x190B, 0x0000, 0x0000, 0x3191, 0x2212,
-    0x3191, 0x0000, 0x0000, 0x0000, 0x1AB4, 0x1356, 0x0B56, 0x1356,
-    0x1356, 0x0BD8, 0x1356, 0x0000, 0x0000, 0x0000, 0x09EE, 0x1356,
-    0x12B4, 0x0000, 0x0000, 0x0000, 0x2212, 0x1A53, 0x2212, 0x2212,
-    0x3191, 0x4931, 0x4951, 0x6111, 0x6111, 0x608B, 0x6111, 0x90D1,
-    0x78D1, 0x78F1, 0xA8B1, 0xC8B1, 0xC8B1, 0xE0B0, 0xE0B0, 0xE0B0,
-    0xE0B0, 0xE0B0, 0xE0AE, 0xE8AE, 0xE0AC, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0xD127, 0xE126, 0xE0E7, 0xE8E7, 0xE0C8, 0xE0A8,
-    0xE0C8, 0xE8AC, 0xC88E, 0xE0AC, 0xE0AC, 0xE8AE, 0xE0AE, 0xE0B0,
-    0xE0B0, 0xE0B0, 0xC8B1, 0xC8B1, 0xA8D1, 0xB0B1, 0x90D1, 0x88F1,
-    0x90D1, 0x78F1, 0x6111, 0x6111, 0x4931, 0x0000, 0x0000, 0x0000,
-    0x3191, 0x2212, 0x1842, 0x0000, 0x2212, 0x1A53, 0x1A53, 0x1AB4,
-    0x12B4, 0x1356, 0x1AB4, 0x0333, 0x1AB4, 0x0000, 0x0000, 0x1356,
-    0x12B4, 0x09EE, 0x0000, 0x0000, 0x09EE, 0x2212, 0x3191, 0x3191,
-    0x3191, 0x3191, 0x3191, 0x4931, 0x4951, 0x6911, 0x6111, 0x78F1,
-    0x90D1, 0xB0D1, 0x88D1, 0xB0D1, 0xA8B1, 0xD0B1, 0xC8B1, 0xE0B0,
-    0xE0B0, 0xE0B0, 0xE8AE, 0xE0AE, 0xE0AC, 0xE0AC, 0xC8AE, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0xE165, 0xE965, 0xE106, 0xE106, 0xE0E7, 0xE8E7,
-    0xE0C8, 0xE8AA, 0x986B, 0x0000, 0xC8AE, 0xE0AE, 0xE0AE, 0xE8AE,
-    0xE0AE, 0xE0B0, 0xE8AE, 0xC8B1, 0xC8B1, 0xC8B1, 0xB0B1, 0xB0D1,
-    0x90D1, 0x0000, 0x6111, 0x78F1, 0x6111, 0x6911, 0x4931, 0x0000,
-    0x0000, 0x2991, 0x3191, 0x3191, 0x2042, 0x2212, 0x0000, 0x12B4,
-    0x1A53, 0x1AB4, 0x12B4, 0x1356, 0x0000, 0x0B33, 0x0000, 0x09EE,
-    0x1AB4, 0x12B4, 0x0000, 0x0000, 0x190B, 0x1A53, 0x2212, 0x2212,
-    0x3191, 0x0000, 0x3191, 0x4931, 0x4931, 0x6111, 0x6111, 0x78F1,
-    0x78F1, 0x90D1, 0x90D1, 0xA8D1, 0xB0B1, 0xC8B1, 0xD0B1, 0x988B,
-    0x1842, 0xE0B0, 0xE0B0, 0xE0AE, 0xE8AE, 0xE0AE, 0xE0AC, 0xE8AC,
-    0xC88A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x90C4, 0xE9C5, 0xE165, 0xE945, 0xE108, 0xE0E7,
-    0xE0C8, 0xE0A8, 0xE8C8, 0xE0AA, 0x0000, 0x0000, 0xE0AC, 0xE0AC,
-    0x0000, 0x0000, 0x986B, 0xE8B0, 0xC8B1, 0xE0B0, 0xC8B1, 0xC8B1,
-    0xB0D1, 0x588B, 0x0000, 0x0000, 0x6111, 0x608B, 0x0000, 0x6111,
-    0x4931, 0x0000, 0x0000, 0x3191, 0x3191, 0x2212, 0x190B, 0x0000,
-    0x2212, 0x1A53, 0x1A53, 0x1AB4, 0x1A53, 0x0000, 0x09EE, 0x09EE,
-    0x1A53, 0x1AB4, 0x190B, 0x0000, 0x210B, 0x2212, 0x210B, 0x0000,
-    0x3191, 0x1842, 0x0000, 0x0000, 0x4931, 0x6911, 0x6111, 0x78F1,
-    0x78D1, 0x90D1, 0x608B, 0x0000, 0x1842, 0xB0D1, 0xD0B1, 0x1842,
-    0x0000, 0xD0AE, 0xE0AE, 0xE0B0, 0xE8AE, 0xE0AE, 0xE0AC, 0xE0AC,
-    0xE8AA, 0xE0AA, 0x90C4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0xEA85, 0xE9C5, 0xE9C5, 0xE945, 0xE165,
-    0xE0E7, 0xE108, 0xE0A8, 0xE8AA, 0xE0AA, 0xA08B, 0x5084, 0xE8AE,
-    0xC88E, 0x0000, 0x0000, 0xC8AE, 0xE0B0, 0xE0B0, 0xE0B0, 0xE0B0,
-    0xD0B1, 0xD0B1, 0x1842, 0x0000, 0x0000, 0x608B, 0x78F1, 0x0000,
-    0x0000, 0x6111, 0x4931, 0x0000, 0x3191, 0x4931, 0x3191, 0x0000,
-    0x0000, 0x2212, 0x21F2, 0x1A53, 0x2212, 0x1A53, 0x0000, 0x210B,
-    0x1A53, 0x1AB4, 0x1A53, 0x1842, 0x210B, 0x2212, 0x190B, 0x0000,
-    0x3191, 0x4931, 0x0000, 0x0000, 0x0000, 0x6111, 0x6111, 0x78F1,
-    0x78F1, 0x90D1, 0x90D1, 0xA8D1, 0x0000, 0x0000, 0x90D1, 0xE0B0,
-    0x988B, 0x0000, 0xE0B0, 0xE0B0, 0xE0AE, 0xE0AE, 0xE8AE, 0xE0AE,
-    0xE0AC, 0xE108, 0xE0AA, 0xE8AA, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x5084, 0xE9C5, 0xE9C5, 0xE145, 0xE965,
-    0xE106, 0xE106, 0xE0C8, 0xE8C8, 0xE0A8, 0xE0AA, 0xE0AA, 0xC88A,
-    0xE8AC, 0xE0AE, 0x0000, 0x0000, 0xE0AE, 0xE0B0, 0xE0B0, 0xE0B0,
-    0xC8AE, 0x1842, 0xB0D1, 0x608B, 0x0000, 0x0000, 0x0000, 0x78D1,
-    0x6111, 0x0000, 0x0000, 0x4931, 0x4951, 0x4931, 0x3191, 0x3191,
-    0x0000, 0x0000, 0x3191, 0x2212, 0x2991, 0x2212, 0x2212, 0x0000,
-    0x0000, 0x21F2, 0x2212, 0x2212, 0x3191, 0x21F2, 0x190B, 0x0000,
-    0x0000, 0x3191, 0x2042, 0x0000, 0x0000, 0x0000, 0x4931, 0x4951,
-    0x2042, 0x90D1, 0x90F1, 0x90D1, 0xA8D1, 0xA08B, 0x0000, 0xC8B1,
-    0xC8B1, 0xC88E, 0xD0AE, 0xE0B0, 0xE0AE, 0xE8AE, 0xE0AC, 0xE0AE,
-    0xE0AC, 0xE8AC, 0xE0AA, 0xE0AA, 0xE0A8, 0x5884, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x5064, 0xEA85, 0xE9C5, 0xE9C5,
-    0xE165, 0xE965, 0xE106, 0xE108, 0xE0A8, 0xC0C6, 0xE0C8, 0xE8AA,
-    0xE0AA, 0xE8AA, 0xE8AC, 0x1842, 0x986B, 0xE0B0, 0xE0B0, 0xE0B0,
-    0xE0B0, 0xE0B0, 0xC8B1, 0xD0B1, 0xB0D1, 0x78F1, 0x90D1, 0x78D1,
-    0x78F1, 0x90F1, 0x190B, 0x0000, 0x0000, 0x5131, 0x4931, 0x4931,
-    0x190B, 0x0000, 0x0000, 0x3191, 0x3191, 0x2212, 0x3191, 0x2212,
-    0x0000, 0x0000, 0x09EE, 0x2212, 0x3191, 0x2212, 0x0000, 0x0000,
-    0x0000, 0x4931, 0x3191, 0x210B, 0x190B, 0x608B, 0x190B, 0x6111,
-    0x6111, 0x90F1, 0x90D1, 0xA8D1, 0x90D1, 0xB0B1, 0xA8D1, 0x608B,
-    0xC8B1, 0xD0B1, 0x986B, 0xE0B0, 0xE0B0, 0xC8B1, 0xE0AE, 0xE0AE,
-    0xE0AC, 0xE8AC, 0xE0AA, 0xE0AA, 0xE0C8, 0xE8AA, 0x5884, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5884, 0xF285, 0xF285,
-    0xE9C5, 0xE9C5, 0xE106, 0xE106, 0xE0E7, 0xE0E7, 0x5884, 0x0000,
-    0xE8C8, 0xE0AC, 0xE0AA, 0xE0AC, 0xE8AC, 0xE0AE, 0xE0AE, 0xE0B0,
-    0x986B, 0x0000, 0xC8B1, 0xE8B0, 0xA8D1, 0x78D1, 0x588B, 0x78F1,
-    0xA06B, 0x90D1, 0x78F1, 0x78F1, 0x6111, 0x190B, 0x0000, 0x6111,
-    0x4931, 0x2042, 0x0000, 0x0000, 0x3191, 0x3191, 0x2991, 0x3191,
-    0x3191, 0x0000, 0x0000, 0x0000, 0x3191, 0x2991, 0x2042, 0x0000,
-    0x190B, 0x4931, 0x3191, 0x4951, 0x5131, 0x4951, 0x608B, 0x6111,
-    0x6911, 0x78F1, 0x78D1, 0x1842, 0x0000, 0xB0D1, 0xB0B1, 0xC8B1,
-    0xC8B1, 0xE8B0, 0xC8B1, 0xE0B0, 0xE0B0, 0x988B, 0x0000, 0xC88E,
-    0xE8AC, 0xE0AC, 0xE8AA, 0xE0AA, 0xE0C8, 0xE0AA, 0xE8A8, 0x1842,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xEA85,
-    0xE9C5, 0xF285, 0xE1A6, 0xE965, 0xE126, 0xE906, 0x90C4, 0xC0C6,
-    0xE0C8, 0xE0AA, 0xE0AA, 0xE8AC, 0xE0AC, 0xE0AE, 0xE0AE, 0xE8AE,
-    0xE0AE, 0xA06B, 0xC8B1, 0xC8AE, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x78F1, 0x90D1, 0x78F1, 0x90D1, 0x78D1, 0x78F1,
-    0x6111, 0x6911, 0x0000, 0x0000, 0x0000, 0x4951, 0x3191, 0x4931,
-    0x3191, 0x4951, 0x0000, 0x0000, 0x0000, 0x4931, 0x3191, 0x4951,
-    0x3191, 0x5131, 0x190B, 0x5151, 0x4931, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x190B, 0x78D1, 0x608B, 0x1842, 0xB0D1, 0xC8B1,
-    0xC8B1, 0xE0B0, 0xE0B0, 0xE0B0, 0xE0B0, 0xE0B0, 0xC8B1, 0xA06B,
-    0x5084, 0xE0AE, 0xE8AC, 0xE0AC, 0xE0AA, 0xE0AA, 0xE8C8, 0xE108,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0xEA65, 0xF285, 0xE9C5, 0xE9C5, 0xE145, 0xE145, 0xE108, 0xE0E7,
-    0xC0C6, 0xE0C8, 0xE0A8, 0xE8AA, 0xE0AA, 0xE0AC, 0xE0AC, 0xE8AE,
-    0xC8AE, 0xE0AE, 0xE0AE, 0xC88E, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0xB0D1, 0x88D1, 0x0000, 0x0000, 0x1842,
-    0x6911, 0x78F1, 0x608B, 0x0000, 0x0000, 0x0000, 0x4931, 0x4931,
-    0x3191, 0x4951, 0x3191, 0x0000, 0x0000, 0x0000, 0x190B, 0x4931,
-    0x3191, 0x210B, 0x0000, 0x0000, 0x4951, 0x6911, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x608B, 0xA8D1, 0xD0B1,
-    0xA8B1, 0xC8B1, 0xD0B1, 0xE0B0, 0xE0B0, 0xE0B0, 0xE0AE, 0xE8AE,
-    0xE0AE, 0xC88A, 0xE0AC, 0xE0AC, 0xE8AA, 0xE0AA, 0xE0C8, 0xE0C8,
-    0xE8A8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0xF365, 0xEA85, 0xEA85, 0xE9C5, 0xE9C5, 0xE945, 0xE165,
-    0xE0E7, 0xE108, 0xE0A8, 0xE8AA, 0xC0C6, 0xE0AC, 0xE0AA, 0xE0AC,
-    0xE8AC, 0xE0AC, 0xC8AE, 0xE0B0, 0xE8AE, 0xA06B, 0x1842, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0xA8D1, 0xB0D1, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x608B, 0x608B, 0x0000, 0x0000, 0x0000, 0x6111,
-    0x4931, 0x6911, 0x4951, 0x5131, 0x0000, 0x0000, 0x0000, 0x4951,
-    0x4931, 0x0000, 0x0000, 0x0000, 0x0000, 0x6111, 0x6911, 0x1842,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x1842, 0xB0B1, 0xA8D1, 0xC8B1,
-    0xB0B1, 0x78F1, 0xC8B1, 0xE0B0, 0xE0B0, 0xE0B0, 0xE0AE, 0xE0B0,
-    0xE0AE, 0xE0AE, 0xE8AC, 0xE0AC, 0xE0AA, 0xE0AC, 0xE8AA, 0xE0A8,
-    0xE0C8, 0xD127, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0xCA64, 0xF265, 0xE9C5, 0xE9C5, 0xE145, 0xE165,
-    0xE106, 0xE106, 0xE8E7, 0xE0E7, 0xC8AA, 0x0000, 0xC88A, 0xE0AA,
-    0xE0AA, 0xE8AC, 0xE0AC, 0xE0AE, 0x0000, 0xC8AE, 0xC8B1, 0xE0B0,
-    0xE0B0, 0xE0B0, 0xC8B1, 0xD0B1, 0xC8B1, 0xC8B1, 0x988B, 0x0000,
-    0x0000, 0x0000, 0x608B, 0x90D1, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x608B, 0x6111, 0x4931, 0x6111, 0x608B, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x6111, 0x190B, 0x0000, 0x0000, 0x0000, 0x6911, 0x78F1,
-    0x78F1, 0x90D1, 0x90D1, 0x90F1, 0x90D1, 0xA8D1, 0xB0D1, 0xA8B1,
-    0x0000, 0x90D1, 0xC8B1, 0xE0B0, 0xE0B0, 0xE0B0, 0xC8AE, 0x0000,
-    0xA08B, 0xE0AE, 0xE8AC, 0xE0AC, 0xE0AA, 0xE0AC, 0xE8A8, 0xE0AA,
-    0xE0C8, 0xE0E7, 0x90C4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0xCA64, 0xEA65, 0xF285, 0xE9C5, 0xE9C5,
-    0xE165, 0xE165, 0xE106, 0xE906, 0xE0E7, 0xE108, 0xE0C8, 0xE0AA,
-    0xE8AA, 0xE0AC, 0xE8AC, 0xE8AE, 0x1842, 0x0000, 0x0000, 0x0000,
-    0x588B, 0xD0B1, 0xC88E, 0xC8AE, 0xC8B1, 0xE0B0, 0xD0B1, 0xB0B1,
-    0x0000, 0x0000, 0x1842, 0xB0D1, 0x90D1, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x78F1, 0x78D1, 0x6111, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x6111, 0x78F1, 0x1842, 0x0000, 0x0000, 0x78D1,
-    0x78F1, 0x90F1, 0x90D1, 0xB0B1, 0x78F1, 0x78D1, 0x1842, 0x0000,
-    0x0000, 0x0000, 0x0000, 0xE0B0, 0xE0B0, 0xE0B0, 0xE0B0, 0xE0B0,
-    0xE0AE, 0xE0AE, 0xE0AE, 0xE8AE, 0xE0AC, 0xE0AC, 0xE0AA, 0xE8AA,
-    0xE0C8, 0xE108, 0xE8E7, 0x5884, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x90C4, 0xFB65, 0xEA85, 0xF285,
-    0xE9C5, 0xE9C5, 0xE145, 0xE145, 0xE106, 0xE0E7, 0xE0C8, 0xE8C8,
-    0xE0A8, 0xE0AA, 0xE0AA, 0xE8AC, 0xC88A, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x988B, 0x988B, 0xC8B1,
-    0xB0B1, 0x0000, 0x588B, 0xB0D1, 0xB0B1, 0x588B, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x190B, 0x608B, 0x2042, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x608B, 0x78F1, 0x78D1, 0x1842, 0x0000,
-    0x78F1, 0x90D1, 0x90D1, 0x608B, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x988B, 0xE8B0, 0xE0AE, 0xE0B0,
-    0xE8AE, 0xE0AE, 0xE0AC, 0xE0AC, 0xE8AC, 0xE0AC, 0xE0AA, 0xE0AA,
-    0xE8C8, 0xE0A8, 0xE0C8, 0xE0E7, 0x5884, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3242, 0xFB65, 0xF365,
-    0xEA85, 0xEA85, 0xE9C5, 0xE9C5, 0xE906, 0xE106, 0xE108, 0xE0E7,
-    0xE0C8, 0xE8AA, 0xE0A8, 0xE8AA, 0xE8AA, 0x1842, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xC8AE, 0xB0B1, 0x988B,
-    0xC8B1, 0xC8B1, 0xB0B1, 0xC8B1, 0xB0D1, 0xC8B1, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x90F1, 0x88D1, 0x90D1,
-    0x78F1, 0xB0D1, 0x88D1, 0x90D1, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE0B0, 0xE0B0,
-    0xE0AE, 0xE0AE, 0xE0AE, 0xE8AE, 0xE0AC, 0xE0AC, 0xE0AA, 0xE8AA,
-    0xE0C8, 0xE0AA, 0xE0A8, 0xE8E7, 0xE8E7, 0x1842, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF365,
-    0xF265, 0xF285, 0xE9C5, 0xE1C5, 0x90C4, 0x0000, 0x0000, 0xE906,
-    0xC0C6, 0x0000, 0x0000, 0xC0C6, 0xE0C8, 0xE0AA, 0xC88E, 0xE8AC,
-    0xE0AC, 0xC8AE, 0x986B, 0x5884, 0x0000, 0x0000, 0x988B, 0xD0B1,
-    0xE0B0, 0xE0B0, 0xC8B1, 0xC8B1, 0xD0B1, 0xC8B1, 0x986B, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x608B, 0x90D1,
-    0x90F1, 0xA8D1, 0xB0B1, 0xA8D1, 0x90D1, 0x5884, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x1842, 0xA08B, 0xC88E, 0xE8AE, 0xA8D1, 0xE0B0,
-    0xE8AE, 0xC88E, 0x1842, 0x0000, 0x608B, 0xE8AC, 0x588B, 0x0000,
-    0x988B, 0xE8A8, 0xE0C8, 0xE8E7, 0xE0E7, 0xE106, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0xF365, 0xF365, 0xF285, 0xEA85, 0xE9C5, 0x0000, 0x0000, 0x0000,
-    0xE106, 0xE906, 0x5884, 0xC0C6, 0xE0C8, 0xE0AA, 0xE0AA, 0xE8AC,
-    0xE0AA, 0xE0AC, 0xE0AC, 0xE8AE, 0xE0AE, 0xE0AE, 0xE8AE, 0xE0B0,
-    0xE0B0, 0xE0B0, 0xE0B0, 0xE0B0, 0xC8B1, 0xC8B1, 0xB0B1, 0xB0D1,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x78D1,
-    0x1842, 0xB0D1, 0xA8B1, 0xC8B1, 0xB0D1, 0xC8B1, 0xC8B1, 0xD0B1,
-    0xC88E, 0xC8B1, 0xE0B0, 0xE0B0, 0xE0B0, 0xE0B0, 0xE0B0, 0xE0B0,
-    0xE0AE, 0xE0AE, 0xE8AE, 0x988B, 0x0000, 0xC88E, 0xE8AA, 0x988B,
-    0x0000, 0x0000, 0xC0C6, 0xE0E7, 0xE0E7, 0xE926, 0xE106, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0xF365, 0xFB65, 0xF365, 0xF285, 0xE1A6, 0x0000, 0x0000,
-    0x0000, 0xC165, 0xE106, 0xE126, 0xE8E7, 0xE0E7, 0xE0C8, 0xE0A8,
-    0xE8C8, 0xE0AA, 0xE0AA, 0xE0AC, 0xE8AC, 0xE0AE, 0xE0AC, 0xE0AE,
-    0xE8AE, 0xE0B0, 0xE0AE, 0xE0B0, 0xE0B0, 0xE0B0, 0x588B, 0xC8B1,
-    0x1842, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x608B, 0xB0B1, 0x0000, 0xD0B1, 0xA8D1, 0xC8B1, 0xD0B1, 0xC8B1,
-    0xC8B1, 0xE0B0, 0xC8B1, 0xE8B0, 0xE0B0, 0xE0B0, 0xE0AE, 0xE0B0,
-    0xE0AE, 0xE8AE, 0xE0AC, 0xE0AE, 0xE0AC, 0xE8AC, 0xE0AA, 0xE0AA,
-    0x0000, 0x0000, 0x0000, 0x1842, 0xE8E7, 0xE106, 0xE906, 0xC0C6,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x9AA3, 0xFC85, 0xF365, 0xFB65, 0xC165, 0x0000,
-    0x0000, 0x0000, 0x5084, 0xE965, 0xE126, 0xE106, 0xE0E7, 0xE8E7,
-    0x98C4, 0x90E4, 0xE0AA, 0xE0AC, 0xE0AA, 0xE8AC, 0xE0AC, 0xE0AE,
-    0xE0AE, 0xE8AE, 0xE0AE, 0xE0B0, 0xE0AE, 0xE8B0, 0x986B, 0xC8B1,
-    0xE0B0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0xD0B1, 0x988B, 0x608B, 0xC8B1, 0xC8B1, 0xE0B0,
-    0xC8B1, 0xE0B0, 0xE0B0, 0xE0B0, 0xE0B0, 0xE0B0, 0xE0B0, 0xE0B0,
-    0xE0AE, 0xE8AE, 0xC8AE, 0xE0AE, 0xE0AC, 0xE8AC, 0xE0AA, 0xE0AC,
-    0xC0C6, 0x0000, 0x0000, 0x0000, 0x0000, 0xE106, 0xE906, 0xE165,
-    0x90E4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x5084, 0xFB65, 0xFB65, 0xEA85, 0xC165,
-    0x0000, 0x0000, 0x0000, 0xE906, 0xE165, 0xE165, 0xE108, 0x90C4,
-    0x0000, 0x0000, 0x988B, 0xE8AA, 0xE8A8, 0xE0AA, 0xE0AA, 0xE0AC,
-    0xC8AE, 0xE8AE, 0xE0AC, 0xE0AE, 0xE8AE, 0xE0B0, 0xE0AE, 0x0000,
-    0xC8B1, 0xC88E, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0xA8D1, 0xB0B1, 0x0000, 0xC8B1, 0xE0B0,
-    0xC8B1, 0xE8B0, 0xE0B0, 0xE0B0, 0xC8AE, 0xE0B0, 0xE0AE, 0xE8AE,
-    0xE0AE, 0xE0AE, 0xC88E, 0x0000, 0x0000, 0x988B, 0xE8AA, 0xE0AA,
-    0xE8A8, 0xE0AA, 0x0000, 0x0000, 0x0000, 0x5084, 0xE108, 0xE965,
-    0xE145, 0x1842, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFC85, 0xF365, 0xFB65,
-    0x90E4, 0x0000, 0x0000, 0x0000, 0xE1A6, 0xE9C5, 0xE165, 0xE906,
-    0x0000, 0x0000, 0x90C4, 0xE0E7, 0xE0C8, 0xE8AA, 0x98C4, 0x90E4,
-    0xE0AA, 0xE0AC, 0xE0AC, 0xE8AE, 0x0000, 0xC88E, 0xE0AE, 0xE8AE,
-    0x988B, 0xE8B0, 0x2042, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x1842, 0xE8B0, 0x1842, 0x986B,
-    0xE0B0, 0xC8B1, 0x1842, 0xE0B0, 0xE0B0, 0xE0B0, 0xE8AE, 0xC8AE,
-    0x986B, 0xE8AE, 0xE0AE, 0xE8AE, 0x988B, 0x0000, 0x0000, 0x986B,
-    0xE0AA, 0xE8AA, 0xE8C8, 0x0000, 0x0000, 0x0000, 0x1842, 0xE145,
-    0xE965, 0xE9C5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCB84, 0xF485,
-    0xF365, 0x9AA3, 0x0000, 0x0000, 0x0000, 0xE9A6, 0xE165, 0xE145,
-    0xE906, 0x90E4, 0x5084, 0xE8E7, 0xE8C8, 0xE0A8, 0x988B, 0x0000,
-    0xC88A, 0xE8AA, 0xE0AA, 0x5084, 0x0000, 0xA08B, 0xE0AC, 0xE8AE,
-    0xE0AE, 0xE0AE, 0xC88E, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xC8B1, 0xE0B0,
-    0xE8AE, 0xE0B0, 0xE0AE, 0x588B, 0x0000, 0x608B, 0xE8AE, 0xE0AE,
-    0xC8AE, 0x0000, 0x986B, 0xE8AC, 0xE0AC, 0xE8AC, 0x1842, 0x90E4,
-    0xE8A8, 0xE0AA, 0xE8C8, 0xE0A8, 0x0000, 0x0000, 0x0000, 0x90E4,
-    0xD127, 0xE945, 0xC185, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCB84,
-    0xFC85, 0xCA64, 0x9AC3, 0x90E4, 0x0000, 0x0000, 0x0000, 0xE9C5,
-    0xE1A6, 0xE165, 0xE906, 0xE165, 0xE106, 0xE906, 0x98E4, 0x0000,
-    0x5084, 0xE0AA, 0xE8AA, 0x0000, 0x0000, 0xC88E, 0xE0AC, 0xE0AC,
-    0xE8AC, 0x988B, 0xE8AE, 0x986B, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x988B,
-    0xE0B0, 0xC8B1, 0xE8AE, 0xE0B0, 0xE0AE, 0x986B, 0x0000, 0x0000,
-    0xE8AE, 0xE8AE, 0x1842, 0x0000, 0x90E4, 0xE0AC, 0xE8AA, 0xE0AA,
-    0xC88A, 0xE0C8, 0xE0A8, 0xE8E7, 0x98E4, 0x0000, 0x0000, 0x0000,
-    0x90C4, 0xE165, 0xE9C5, 0xC165, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x5064, 0xFD85, 0xFB65, 0x5084, 0xCA64, 0x0000, 0x0000, 0x0000,
-    0xC965, 0xE9C5, 0xE165, 0xE945, 0xE106, 0xE126, 0x90E4, 0xC0C6,
-    0xE8A8, 0xE0E7, 0xE0C8, 0xE8A8, 0x988B, 0xE0AA, 0xE8AA, 0xE0AC,
-    0x5084, 0x0000, 0xE8AC, 0xE0AC, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0xE0B0, 0xE8AE, 0x0000, 0x588B, 0xE8AE, 0xE0AE, 0xE0AC,
-    0x0000, 0xE0AE, 0xE8AC, 0xE0AC, 0xC88E, 0x0000, 0x5084, 0xE8AA,
-    0xE8C8, 0xE0A8, 0xE0C8, 0xE0E7, 0xE8A8, 0x0000, 0x0000, 0x0000,
-    0x90E4, 0x90C4, 0xC185, 0xE9C5, 0x1842, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0xFD65, 0xFD85, 0x5084, 0x9AA3, 0xF365, 0xF285,
-    0x0000, 0xEA85, 0xE9C5, 0xE9C5, 0xE1A6, 0xE9C5, 0xE165, 0xE965,
-    0xE106, 0xE126, 0xE0E7, 0x0000, 0xC88A, 0xE8AA, 0xE0C8, 0xC88A,
-    0x0000, 0x0000, 0xE0AA, 0xE8AC, 0x5884, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x5084, 0xE8AE, 0xE0AE, 0x0000, 0x0000, 0xE0AA,
-    0xE0AC, 0xE8AE, 0xE8AC, 0x5084, 0xC88A, 0xE108, 0xE0AA, 0xE0AA,
-    0xE8C8, 0xE0AA, 0xE0A8, 0xE0E7, 0xE8E7, 0xE108, 0x0000, 0x5884,
-    0x98E4, 0xC165, 0x1842, 0xE9C5, 0xF1C5, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0xFC85, 0xFC65, 0xF365, 0x0000, 0x9AA3,
-    0xF285, 0xF365, 0xEA85, 0x5064, 0x0000, 0x98E4, 0x0000, 0xE945,
-    0xE165, 0xE145, 0xC0C6, 0x0000, 0x0000, 0xC88A, 0xE8C8, 0x5084,
-    0x0000, 0x5884, 0xE8C8, 0xE0AA, 0x986B, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x988B, 0xE8AE, 0xE8AC, 0x0000,
-    0x0000, 0x5084, 0xE8AA, 0xE0AA, 0x0000, 0x0000, 0xC88A, 0xE0AA,
-    0xE8C8, 0xE0A8, 0x5084, 0x5884, 0x0000, 0x1842, 0xE908, 0xE906,
-    0xC0C6, 0x90E4, 0x0000, 0x5884, 0xE9C5, 0xCA64, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x9AA3, 0xFD65, 0xFC85, 0x0000,
-    0x0000, 0x9AC3, 0xF365, 0x9AA3, 0x0000, 0x0000, 0x0000, 0x0000,
-    0xE165, 0xE9C5, 0xE165, 0x0000, 0x0000, 0xE906, 0xE8E7, 0x0000,
-    0x0000, 0x1842, 0xE0A8, 0xE0AA, 0xE0C8, 0xC8AA, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE8AC, 0xE0AC, 0xC88A,
-    0xE8AC, 0x5084, 0x0000, 0x0000, 0xE0AA, 0xE8AC, 0x0000, 0x0000,
-    0xE0A8, 0xE0E7, 0xE8C8, 0x0000, 0x0000, 0x0000, 0x0000, 0x90C4,
-    0xE965, 0xC165, 0x0000, 0x0000, 0x90C4, 0xF285, 0x90E4, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFD85, 0xFD85,
-    0x0000, 0xF465, 0xF365, 0x90C4, 0x0000, 0x0000, 0x0000, 0x0000,
-    0xC985, 0xE9C5, 0xE145, 0x90E4, 0x0000, 0xE945, 0xC0C6, 0x0000,
-    0x0000, 0x0000, 0xC88A, 0xE0C8, 0xE0C8, 0xE8A8, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE0AC,
-    0xE0AA, 0xC88A, 0xC8AE, 0x1842, 0x0000, 0x0000, 0xE8C8, 0xE8A8,
-    0x0000, 0x5084, 0xE8C8, 0xE0E7, 0xC0C6, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x90C4, 0xE965, 0xC165, 0x0000, 0xF285, 0xEA85, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFD65,
-    0xFD85, 0xFD65, 0xFC85, 0xFC85, 0x5064, 0x0000, 0x0000, 0x0000,
-    0x0000, 0xEA85, 0xF265, 0xF285, 0x5084, 0xE9C5, 0xE165, 0x0000,
-    0x0000, 0x0000, 0xE8E7, 0xE126, 0xE0E7, 0xE108, 0xC0C6, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0xC88A, 0xE108, 0xE0AA, 0xE8AA, 0xE0A8, 0x0000, 0x0000, 0x0000,
-    0xE0C8, 0xE108, 0x0000, 0xE108, 0xE0E7, 0xE945, 0x90C4, 0x0000,
-    0x0000, 0x0000, 0x0000, 0xE1C5, 0xE9C5, 0xF285, 0xF265, 0xF365,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x9AA3, 0xFE85, 0xF565, 0x9AA3, 0xFC85, 0xFC85, 0xCB84, 0xCA64,
-    0xCA64, 0xF365, 0xEA65, 0x0000, 0xE9C5, 0xE9C5, 0xC165, 0x0000,
-    0x0000, 0x0000, 0x90E4, 0xE906, 0xE106, 0xE126, 0xE0E7, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0xE8C8, 0xE0A8, 0xE0C8, 0xE0A8, 0x988B, 0x0000,
-    0x0000, 0x0000, 0xC0C6, 0xE108, 0xE906, 0x90E4, 0xC0C6, 0xE945,
-    0xC0C6, 0x90E4, 0x90C4, 0xE9C5, 0xE9C5, 0x1842, 0xCA64, 0xFB65,
-    0x90E4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0xFE65, 0xFD85, 0xCB84, 0xFD85, 0xCB84, 0xF365,
-    0x9AA3, 0xFC85, 0xFB65, 0x0000, 0x5064, 0xF365, 0xF285, 0xEA85,
-    0xE9C5, 0xE9C5, 0xE145, 0xE165, 0xE945, 0xE165, 0xE906, 0x90E4,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0xC0C6, 0xE0A8, 0xE0E7, 0xE0C8, 0xE8E7,
-    0xE0C8, 0xD127, 0xC0C6, 0xD127, 0xE906, 0xE165, 0xE106, 0x0000,
-    0xE145, 0xE9C5, 0x90C4, 0xE9C5, 0xE9C5, 0xF285, 0xCA64, 0xF365,
-    0xFB65, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0xF665, 0xFD65, 0x0000, 0x9AA3, 0x3242,
-    0x9AA3, 0xFC85, 0xFB65, 0x62A3, 0x0000, 0xF365, 0xF285, 0xF265,
-    0xEA85, 0xF265, 0xE9C5, 0xE1C5, 0xE145, 0xE9C5, 0xE165, 0xE145,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE8E7, 0xE0C8, 0xE0E7,
-    0xE0E7, 0xE906, 0xE108, 0xE106, 0xE126, 0xE165, 0xE945, 0xE1A6,
-    0x0000, 0x5084, 0xE9C5, 0xCA84, 0xC165, 0x98E4, 0x90C4, 0x5884,
-    0xFB65, 0xF365, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x62A3, 0xFE65, 0xFD85, 0xFD65,
-    0xCC84, 0xF565, 0xFC85, 0xF465, 0x0000, 0xFC85, 0xFB65, 0xCA64,
-    0xC185, 0xCA64, 0xC165, 0xEA85, 0xE9C5, 0xF285, 0xE9C5, 0xF1C5,
-    0x1842, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5084, 0xE106,
-    0xE106, 0xE965, 0xE106, 0xE165, 0xC0C6, 0xC0C6, 0xC165, 0xC165,
-    0xE9C5, 0xE9C5, 0x0000, 0xEA85, 0xF285, 0xFB65, 0x90C4, 0xF365,
-    0xFB65, 0xFC85, 0x1842, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFD65, 0xFE85,
-    0xF565, 0xFE65, 0xFD65, 0x5084, 0x9AA3, 0xFC85, 0xFC85, 0xF365,
-    0xCA64, 0xCA64, 0xF265, 0xF365, 0xF285, 0xEA65, 0xE9C5, 0xE9C5,
-    0x90C4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0xC0C6, 0xE165, 0xE106, 0xE965, 0xE145, 0xE9C5, 0xE165, 0xC165,
-    0x90E4, 0xE9C5, 0xE9C5, 0xC165, 0xC185, 0x90C4, 0xF285, 0xFB65,
-    0xF365, 0xFC85, 0xCB84, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x62A3,
-    0xFE85, 0xFF25, 0xCC84, 0x9AA3, 0x5084, 0xFD65, 0xFD85, 0x9AC3,
-    0x90C4, 0xFC65, 0xF365, 0xFC85, 0xF365, 0xF365, 0xF265, 0xEA85,
-    0xE9C5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0xE165, 0xE9C5, 0xE145, 0xE9C5, 0xE1C5, 0xE9C5,
-    0xE9C5, 0xF285, 0xC965, 0x5084, 0xF285, 0xFB65, 0x90C4, 0x62A3,
-    0xCA64, 0xF465, 0xFC85, 0x3222, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0xFE65, 0xFE65, 0x0000, 0x9CE5, 0xCC64, 0xFD65, 0xFD85,
-    0x9AA3, 0xFD85, 0xF465, 0xFC85, 0xF365, 0xFC65, 0xF365, 0xF365,
-    0xF285, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0xE1A6, 0xE9C5, 0xE9C5, 0xEA85,
-    0xE9C5, 0xEA65, 0xF285, 0xEA65, 0x90C4, 0xCB84, 0xFB65, 0xCA64,
-    0x90E4, 0x9AA3, 0xFC85, 0xFC85, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x1842, 0xF725, 0xFE65, 0xFE65, 0xF665, 0xFE65,
-    0xCC64, 0xFE85, 0xFD65, 0xF585, 0xFC65, 0xFD85, 0xF465, 0xFC85,
-    0xF365, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE9C5, 0xEA65,
-    0xF285, 0xF365, 0xF265, 0xF365, 0xF365, 0xFC85, 0xF365, 0xF465,
-    0xFC85, 0xF465, 0xFC85, 0xF565, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0xCB84, 0xFF25, 0xFE65, 0xFE65,
-    0xF665, 0xFE65, 0xFD65, 0xFD85, 0xF565, 0xFD85, 0xFC65, 0xF485,
-    0xFC65, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0xC165, 0xF365, 0xF285, 0xF365, 0xF365, 0xF365, 0xF365, 0xFC85,
-    0xF365, 0xFC65, 0xF485, 0xFD65, 0x62A3, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCD65, 0xF725,
-    0xFE65, 0xF725, 0xFE65, 0xFE85, 0xF565, 0xFE65, 0xFD85, 0xFD65,
-    0xFC85, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x90C4, 0xF365, 0xF365, 0xFC85, 0xF465, 0xFC85,
-    0xF465, 0xFD85, 0xFD65, 0xFD85, 0xCB84, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x9CE5, 0xF725, 0xFE65, 0xF725, 0xFE65, 0xFE65, 0xFD65, 0xFD85,
-    0x62A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x5064, 0xFC85, 0xFC85, 0xFC65,
-    0xF485, 0xFD65, 0xFD85, 0xFD65, 0x9AA3, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x3222, 0xFE65, 0xFE65, 0xFE85, 0xFD85, 0x9AA3,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9AA3,
-    0xCC84, 0xFD65, 0xFD85, 0xCD85, 0x5084, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000 },
-  { 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6AA3, 0x9CE5, 0xCD85,
-    0x9CE5, 0x6CA6, 0x1842, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2042, 0x9AA3,
-    0x9CE5, 0xD585, 0x9CE5, 0x6AA3, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x64A6, 0xA6A7, 0xCF26,
-    0xCF26, 0xFF25, 0xCE86, 0xD686, 0xA2A3, 0x3242, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3242, 0x9AA3, 0xCC64,
-    0xF565, 0xFE65, 0xFE65, 0xFE85, 0xD565, 0x64A6, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xAEC7, 0xA6A7, 0xD726,
-    0xCF26, 0xF725, 0xCF26, 0xFF25, 0xF725, 0xF725, 0xFE65, 0xFE65,
-    0xCB84, 0x1842, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x1842, 0xA2A3, 0xFC85, 0xFC65, 0xFD85,
-    0xF565, 0xFD85, 0xFD65, 0xFE85, 0xF665, 0xF725, 0xFE65, 0xCE66,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8667, 0xD726, 0xCF26,
-    0xCF26, 0xF725, 0xFF25, 0xF725, 0xF725, 0xF725, 0xFF25, 0xF725,
-    0xFE65, 0xFE65, 0xFD85, 0xFD65, 0x3242, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x5084, 0xF365, 0xF365, 0xFC65, 0xF485, 0xFC65,
-    0xF485, 0xFD65, 0xFD85, 0xFD65, 0xF565, 0xFE65, 0xFE65, 0xFF25,
-    0xFE85, 0xCD65, 0x0000, 0x0000, 0x0000, 0x3222, 0xA6C7, 0xD726,
-    0xCF26, 0xF725, 0xCF26, 0xFF25, 0xF725, 0xF725, 0xFE65, 0xFE65,
-    0xFE65, 0xFE65, 0xF565, 0xFD85, 0xFD65, 0xFD85, 0xCC64, 0x62A3,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x90C4, 0xE9C5, 0xF285, 0xEA85, 0xF365, 0xFB65, 0xF365,
-    0xF365, 0xFC65, 0xF485, 0xFD65, 0xFD85, 0xFD65, 0xF585, 0xFE65,
-    0xFE65, 0xFE65, 0xF665, 0x1842, 0x0000, 0x0000, 0x64A6, 0xCF26,
-    0xCF26, 0xF725, 0xD666, 0xF725, 0xF725, 0xFF25, 0xF725, 0xF725,
-    0xF665, 0xFE85, 0xFD65, 0xFD85, 0xF565, 0xFD85, 0xFC65, 0xF485,
-    0xFB65, 0xFC85, 0x62A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x90C4, 0xE1C5, 0xE9C5, 0xF265, 0xE9C5, 0xEA85, 0xF265, 0xF365,
-    0xF365, 0xFC85, 0xF365, 0xF465, 0xFC85, 0xFD65, 0xF585, 0xFD65,
-    0xFD65, 0xFE65, 0xFE85, 0xFF25, 0x9AA3, 0x0000, 0x0000, 0xAEC7,
-    0xCF26, 0xFF25, 0xCD65, 0x0000, 0x9CE5, 0xF725, 0xFE65, 0xF725,
-    0xFE65, 0xFE65, 0xFD65, 0xFD85, 0xFD65, 0xF585, 0xFC65, 0xF485,
-    0xF365, 0xFB65, 0xF365, 0xF365, 0xF265, 0x62A3, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x90C4,
-    0xE906, 0xE165, 0xE165, 0xE9C5, 0xE9C5, 0xE9C5, 0xE9C5, 0xEA85,
-    0xF265, 0xF365, 0xF365, 0xF365, 0xF365, 0xFC85, 0xFC65, 0xF585,
-    0xFD65, 0x62A3, 0x0000, 0xFE85, 0xFE65, 0xCD65, 0x0000, 0x62A3,
-    0xD686, 0xF725, 0xF725, 0xFF25, 0x64A6, 0xCC64, 0xCD65, 0xF725,
-    0xFE85, 0xD464, 0x1842, 0xFD85, 0x62A3, 0xCC64, 0xF485, 0xFC65,
-    0xF365, 0xFC85, 0xF365, 0xF365, 0xF265, 0xF285, 0xE9C5, 0xCA64,
-    0x5084, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x90E4, 0xE108,
-    0xE906, 0xE165, 0xE106, 0xE165, 0xE145, 0xE9C5, 0xE9C5, 0xEA65,
-    0xE9C5, 0xF285, 0xEA65, 0xF285, 0xCB84, 0x62A3, 0xF365, 0xFC65,
-    0xFC85, 0xFD65, 0x62A3, 0x62A3, 0xFD65, 0xFE65, 0xD686, 0x62A3,
-    0x62A3, 0xD726, 0xCF26, 0xFF25, 0xF725, 0xF725, 0xD686, 0x0000,
-    0xCC64, 0xFE65, 0x62A3, 0x0000, 0x9AA3, 0x9AA3, 0x0000, 0x62A3,
-    0xFB65, 0xFB65, 0xEA85, 0xF285, 0xEA65, 0xF285, 0xE9C5, 0xE9C5,
-    0xE1A6, 0xE9C5, 0xC165, 0x5084, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5884, 0xC88A, 0xE8C8,
-    0xE0C8, 0xE0E7, 0xE0E7, 0xE906, 0xE106, 0xE165, 0xC185, 0xE945,
-    0xE1A6, 0xE9C5, 0x1842, 0x0000, 0xC185, 0x62A3, 0x0000, 0xCB84,
-    0xFB65, 0x9AC3, 0x5884, 0xFD85, 0xFD65, 0xFD85, 0xFD65, 0xFE85,
-    0x62A3, 0x9CE5, 0xD746, 0xF725, 0xF725, 0xF725, 0x0000, 0x3222,
-    0xFE65, 0xFE65, 0xFE65, 0xFD85, 0x0000, 0x3242, 0xCB84, 0x0000,
-    0x0000, 0xF365, 0xFB65, 0xF365, 0x90C4, 0xCA84, 0xE9C5, 0xE9C5,
-    0xE1A6, 0xE9C5, 0xE145, 0xE165, 0xE926, 0xE906, 0x1842, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x5884, 0xE0AA, 0xE0A8, 0xE0AA,
-    0xE8C8, 0xE0E7, 0xE0E7, 0xE0E7, 0xE8E7, 0xE906, 0x90E4, 0x90C4,
-    0xE165, 0xE9C5, 0xC965, 0x0000, 0x5884, 0xCA64, 0x0000, 0x1842,
-    0xF365, 0xFC65, 0xF365, 0xD484, 0x1842, 0x9AA3, 0xF565, 0xFE85,
-    0xFD65, 0xCC64, 0x9CE5, 0xF725, 0xFF25, 0xF725, 0xF725, 0x9CE5,
-    0x0000, 0x3222, 0xFD65, 0xFE85, 0xFD65, 0xFD65, 0xCB84, 0xFC85,
-    0x9AA3, 0x0000, 0x9AA3, 0x90E4, 0xF285, 0xF265, 0x5084, 0x90C4,
-    0xE965, 0xE9C5, 0xE145, 0xE965, 0xE106, 0xE106, 0xE0E7, 0xE8E7,
-    0xC0C6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x1842, 0xC8AA, 0xE8AC, 0xE0AA, 0xE0AA,
-    0xE0C8, 0xE8AA, 0xE0A8, 0xE0C8, 0xE0A8, 0xE8E7, 0x5084, 0x90E4,
-    0xE906, 0x90E4, 0x5884, 0x98C4, 0x0000, 0xC185, 0xC165, 0x98E4,
-    0xF285, 0xF365, 0xF365, 0xFB65, 0x0000, 0x0000, 0xCB84, 0xFD65,
-    0xF585, 0xFE65, 0x9CE5, 0xA6C7, 0xF725, 0xFF25, 0xF725, 0xF725,
-    0xD686, 0x64A6, 0x62A3, 0xCD65, 0xFD85, 0xFD65, 0xF485, 0xFC65,
-    0xFC85, 0xFC85, 0x90C4, 0x62A3, 0x0000, 0xCA64, 0xE9C5, 0xE9C5,
-    0x0000, 0x5884, 0xE165, 0xE165, 0xE106, 0xE906, 0xE0E7, 0xE0E7,
-    0xE0C8, 0xE8A8, 0xE8C8, 0x5884, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x588B, 0xE0AC, 0xE0AC, 0xE0AC, 0xE8AC,
-    0xE0AA, 0xE108, 0xE0AA, 0xE0AA, 0xE8C8, 0xE8E7, 0x1842, 0x5884,
-    0xE0E7, 0xE906, 0x5884, 0x5884, 0x5884, 0x5064, 0xE1C5, 0xE9C5,
-    0xE9C5, 0xF285, 0xEA85, 0xFB65, 0xCA64, 0x9AA3, 0x62A3, 0xFC65,
-    0xF485, 0xFD65, 0xFD85, 0xCC64, 0x9CE5, 0xFF25, 0xF725, 0xF725,
-    0xFE65, 0xFE65, 0xCD65, 0xCC64, 0xCD85, 0xFD65, 0x9AA3, 0x62A3,
-    0x6AA3, 0xFB65, 0xF365, 0xF365, 0xF285, 0x0000, 0xC165, 0x90E4,
-    0x90C4, 0xE9A6, 0x90E4, 0xC185, 0x1842, 0xE906, 0xE8E7, 0xE0E7,
-    0xE8C8, 0xE0A8, 0xE0C8, 0xE0AA, 0xE8AA, 0x986B, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x988B, 0xE8AC, 0xE0AE, 0xE0AC, 0xE8AC,
-    0xE0AC, 0xE0AC, 0xE0AA, 0xE8AA, 0x986B, 0x90E4, 0xC0C6, 0x90C4,
-    0xE8C8, 0xC0C6, 0x90C4, 0x5884, 0x0000, 0xE965, 0xE145, 0xE965,
-    0xC165, 0x90E4, 0x5884, 0xCA64, 0xF285, 0xCA64, 0xCA64, 0xF365,
-    0xFC65, 0xF485, 0xFC65, 0xFD85, 0xCB84, 0x64A6, 0xF725, 0xF725,
-    0xF725, 0xFF25, 0xFE65, 0x3242, 0x62A3, 0xFD65, 0xD585, 0x9AC3,
-    0x9AA3, 0x9AC3, 0xFB65, 0xCA64, 0x5064, 0xF285, 0xE9C5, 0xE9C5,
-    0x90E4, 0x0000, 0xC165, 0xE965, 0xC0C6, 0x5884, 0xC0C6, 0x1842,
-    0x90C4, 0xE8AA, 0xE0C8, 0xE0AA, 0xE0AA, 0xE8AC, 0xE0AA, 0xC88A,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0xC8AE, 0xE0AE, 0xE8AE, 0xE0AE, 0xE0AE,
-    0xE0AC, 0xE8AE, 0xE8AC, 0x986B, 0x5884, 0xC0C6, 0x1842, 0xE0C8,
-    0xE8C8, 0xE0E7, 0x0000, 0xC0C6, 0xC0C6, 0xE106, 0xE906, 0x90E4,
-    0xC965, 0xC185, 0x5884, 0x5084, 0xC165, 0xF265, 0xF285, 0x5884,
-    0x9AA3, 0xF485, 0xFC65, 0xF585, 0xFC65, 0x62A3, 0x1842, 0xD686,
-    0xFF25, 0xFF25, 0xFE65, 0xFE65, 0x9AA3, 0x0000, 0xF465, 0xFC85,
-    0x0000, 0x0000, 0x0000, 0x5064, 0x90E4, 0x0000, 0x98C4, 0xC185,
-    0xE9C5, 0xE945, 0x0000, 0x0000, 0xE106, 0xE126, 0xE8E7, 0xE0E7,
-    0xE0C8, 0xE0E7, 0xE8A8, 0xE0AA, 0xE0AA, 0xE0AC, 0xE8AA, 0xE0AC,
-    0xE0AC, 0xC8AE, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0xC88E, 0xE8AE, 0xE0B0, 0xE0AE, 0xE0AE,
-    0xE8AE, 0xE0AE, 0xE0AC, 0xE0AC, 0xC88A, 0xE8AC, 0xE0AA, 0xE0AA,
-    0xE0AA, 0xE8C8, 0x0000, 0x0000, 0xC88A, 0xE0E7, 0xC0C6, 0x90E4,
-    0x0000, 0x90E4, 0x0000, 0x0000, 0x0000, 0x5884, 0xE9C5, 0xCA64,
-    0x0000, 0xFB65, 0xF365, 0xFC85, 0xF465, 0xCC84, 0x0000, 0x0000,
-    0x62A3, 0xF725, 0xF665, 0xFE65, 0xFE85, 0xFD65, 0x0000, 0xFD85,
-    0xFC85, 0x9AA3, 0x9AA3, 0xCA64, 0xCA64, 0xF285, 0xC185, 0xCA64,
-    0x1842, 0xE145, 0xE965, 0xC0C6, 0x0000, 0xC0C6, 0xE0E7, 0xE0E7,
-    0xE8C8, 0xC0C6, 0xC0C6, 0xC88A, 0x986B, 0xE0AC, 0xE0AC, 0xE8AC,
-    0xE0AC, 0xE0AE, 0xE8AE, 0xC8AE, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0xC8B1, 0xE0B0, 0xE0B0, 0xE0B0, 0xE0B0,
-    0xE0AE, 0xE0B0, 0xE8AE, 0xC88E, 0xC8AE, 0xE0AE, 0xC8AE, 0xE8AC,
-    0xE0AA, 0xE108, 0x0000, 0x0000, 0xC88A, 0xE908, 0x90C4, 0x98E4,
-    0x90C4, 0x90E4, 0xC8C6, 0x90C4, 0x98E4, 0x62A3, 0x5064, 0xF285,
-    0xC165, 0x0000, 0xF365, 0xFB65, 0xF365, 0xFC85, 0x3222, 0x0000,
-    0x0000, 0x0000, 0xD565, 0xFE65, 0xFE65, 0xFE65, 0xF565, 0xFD85,
-    0xFC65, 0xF485, 0xF365, 0xF365, 0x5864, 0x5884, 0xCA64, 0xE9C5,
-    0x90E4, 0x90C4, 0x5884, 0xC985, 0xE906, 0x90E4, 0x1842, 0xE8E7,
-    0xE0A8, 0xE8C8, 0x5084, 0x0000, 0x0000, 0x0000, 0x0000, 0xC88A,
-    0xE8AC, 0xE0AE, 0xE0AC, 0xE8AE, 0xE0AE, 0xC8AE, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x5084, 0x1842, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x2042, 0x5884, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0xD08E, 0xC8B1, 0xE8B0, 0xE0B0, 0xE0B0,
-    0xE0B0, 0xE0B0, 0xC8AE, 0x0000, 0x0000, 0x0000, 0x0000, 0x90C4,
-    0xE8AC, 0xE0AC, 0x988B, 0x0000, 0xC88A, 0xE8AA, 0xC0C6, 0x5084,
-    0x98E4, 0xC0C6, 0xE8E7, 0xE106, 0x5084, 0x98E4, 0xE945, 0xE9C5,
-    0xE9C5, 0xEA85, 0xE9C5, 0xEA85, 0xF265, 0xF365, 0xCB84, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x62A3, 0xF665, 0xFE85, 0xFD65, 0xFD85,
-    0xFC85, 0xCB84, 0x90C4, 0x9AA3, 0xF285, 0xCB84, 0xF285, 0x62A3,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x90C4, 0xE0E7, 0xE8E7,
-    0xE0C8, 0x90C4, 0x0000, 0xE8AA, 0xC0C6, 0x0000, 0x0000, 0x0000,
-    0x0000, 0xE0AC, 0xC8AE, 0xC88E, 0xE8AE, 0xE0B0, 0xE0B0, 0xB0D1,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xC8B1, 0xA8B1, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0xB0D1, 0xA8B1, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0xB0D1, 0xC8B1, 0xE0B0, 0xE0B0, 0xE0B0,
-    0xC8B1, 0xE0B0, 0xC8AE, 0x0000, 0x0000, 0x0000, 0x0000, 0xC88A,
-    0xE0AE, 0x0000, 0xC8AA, 0xE8AC, 0xC88A, 0xE8AC, 0x5884, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x5884, 0x90E4, 0xD127, 0xE106, 0xE945,
-    0x90E4, 0x90C4, 0xE1A6, 0xF285, 0xEA65, 0xFB65, 0xF365, 0x3242,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCD65, 0xFD65, 0xFD85,
-    0xFC65, 0x9AA3, 0x0000, 0x0000, 0x0000, 0x0000, 0x1842, 0xF285,
-    0xE1A6, 0x1842, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xC8C6,
-    0xE8C8, 0xE0A8, 0x988B, 0x0000, 0x0000, 0xC88A, 0xC88A, 0x0000,
-    0x0000, 0x0000, 0x1842, 0xD0AE, 0x988B, 0xA06B, 0xE0AE, 0xE0B0,
-    0xE0B0, 0x988B, 0x0000, 0x0000, 0x0000, 0x0000, 0x5884, 0xD0B1,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA8B1, 0x1842, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x608B, 0xD0B1, 0xC8B1, 0xC8B1, 0xD0B1,
-    0xA8D1, 0xC8B1, 0xA06B, 0x0000, 0x0000, 0x0000, 0x0000, 0xC8AE,
-    0xE8AE, 0x1842, 0x0000, 0xC88E, 0xE8AC, 0xE0AC, 0x90E4, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE8E7, 0xE0E7, 0x5084,
-    0x0000, 0x0000, 0x0000, 0x0000, 0xC965, 0xF285, 0xF285, 0xCA64,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3222, 0xFE65,
-    0xFD85, 0xFD85, 0x9AA3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0xCA64, 0xE9C5, 0x5084, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0xE108, 0xE0C8, 0xE8AA, 0x5084, 0x0000, 0x0000, 0xC88A,
-    0xE8AC, 0x5884, 0x0000, 0x0000, 0x0000, 0xC8AE, 0xD08E, 0x5884,
-    0xC8AE, 0xE0B0, 0xE0B0, 0x608B, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x986B, 0xA08B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x588B, 0xA06B, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x588B, 0xB0D1, 0xC8B1, 0xC8B1, 0xC88E,
-    0xA08B, 0xC8B1, 0xB0B1, 0x0000, 0x0000, 0x0000, 0x5084, 0xE0B0,
-    0xD0AE, 0x0000, 0x0000, 0x986B, 0xE0AE, 0xE8AE, 0xD0AE, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x1842, 0xE108, 0x90C4, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9AA3, 0xEA85, 0xF265,
-    0x1842, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0xD585, 0xFD65, 0xFC85, 0xCB84, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x1842, 0x90C4, 0x90C4, 0xE965, 0xE945, 0x5084, 0x0000, 0x0000,
-    0x1842, 0x2042, 0xC0C6, 0xE8AA, 0xE0AA, 0xE8AA, 0x1842, 0x0000,
-    0x0000, 0x588B, 0xD0AE, 0x986B, 0x0000, 0x0000, 0x0000, 0xA08B,
-    0xC8B1, 0x588B, 0xA06B, 0xC8B1, 0xC8B1, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x608B, 0x608B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x588B, 0x190B,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x90D1, 0xB0D1, 0xB0D1, 0x986B,
-    0xA08B, 0xC8B1, 0x986B, 0x0000, 0x0000, 0x0000, 0xA08B, 0xC8B1,
-    0x5884, 0x0000, 0x0000, 0x5884, 0xE8AE, 0xE0AE, 0xE0AC, 0x90C4,
-    0x0000, 0x1842, 0x0000, 0x0000, 0x5884, 0xE8AA, 0xE8C8, 0xC0C6,
-    0x90C4, 0x1842, 0x0000, 0x0000, 0x0000, 0x0000, 0xC985, 0xE9C5,
-    0xE9C5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0xFD85, 0xFC65, 0xF485, 0xFB65, 0x0000, 0x0000, 0x0000,
-    0x5884, 0x6AA3, 0x5884, 0x1842, 0x0000, 0xC185, 0xE126, 0xE906,
-    0xE0E7, 0xE108, 0xE0C8, 0xC88A, 0xC88A, 0xE0AC, 0xE8AA, 0xE0AC,
-    0xA08B, 0x0000, 0x986B, 0xE0AE, 0xE0AE, 0xE8B0, 0x988B, 0x0000,
-    0x0000, 0x608B, 0xC8B1, 0xC88E, 0xA08B, 0xD0B1, 0x90D1, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x78F1, 0x1842, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x190B, 0x6111,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x78D1, 0xB0D1, 0x90D1, 0x78F1,
-    0x88D1, 0xB0D1, 0x608B, 0x0000, 0x0000, 0x986B, 0xC8B1, 0xE0B0,
-    0xD0B1, 0x1842, 0x0000, 0xC8AE, 0xE0B0, 0xE0B0, 0xE0AE, 0xE8AE,
-    0xC88E, 0xE0AE, 0xE0AC, 0xE8AC, 0xC8AE, 0xE8AC, 0x986B, 0x0000,
-    0x98E4, 0xC0C6, 0xC0C6, 0x5084, 0x0000, 0x0000, 0x0000, 0xE9C5,
-    0xE9C5, 0x9AA3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x9AA3, 0xF485, 0xFC65, 0xF485, 0x1842, 0x0000,
-    0x98C4, 0x9AA3, 0x0000, 0x0000, 0x0000, 0x0000, 0x90E4, 0xE906,
-    0xE8E7, 0xE0E7, 0xE0C8, 0xE0A8, 0xC88A, 0x90E4, 0x0000, 0x5884,
-    0xC88A, 0xE8AE, 0xE0AC, 0xE8AE, 0x588B, 0x1842, 0xD0AE, 0xE0B0,
-    0xE0B0, 0x988B, 0x0000, 0x0000, 0xD08E, 0xC8B1, 0xA8D1, 0xB0B1,
-    0x588B, 0x0000, 0x0000, 0x0000, 0x608B, 0x78F1, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x608B,
-    0x190B, 0x0000, 0x0000, 0x0000, 0x210B, 0x90D1, 0x78F1, 0x90D1,
-    0x90D1, 0x88F1, 0x0000, 0x0000, 0x608B, 0xB0D1, 0xA8B1, 0xC8AE,
-    0x5884, 0xD0B1, 0xC8B1, 0xE0B0, 0xE0B0, 0xE0B0, 0x986B, 0x98E4,
-    0x986B, 0xE8AE, 0xE0AC, 0xE8AE, 0xE0AC, 0xE0AC, 0xE0AA, 0x5884,
-    0x0000, 0x0000, 0x0000, 0x5884, 0x90E4, 0x5884, 0x0000, 0x98C4,
-    0xE965, 0xE9C5, 0x90C4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x62A3, 0xFC65, 0xFC85, 0xFB65, 0x6AA3,
-    0x1842, 0xCA64, 0x0000, 0x0000, 0x0000, 0x0000, 0x90E4, 0xE106,
-    0xE0E7, 0xE8E7, 0x90E4, 0xE0A8, 0xE0C8, 0xE108, 0xE8AA, 0xC88A,
-    0x0000, 0x0000, 0x1842, 0xE8AE, 0xE8AE, 0x90E4, 0x0000, 0x0000,
-    0x5884, 0xE0B0, 0xC8B1, 0xE0B0, 0xA06B, 0x90E4, 0xA8D1, 0xD0B1,
-    0x90D1, 0xB0B1, 0x1842, 0x0000, 0x0000, 0x2042, 0x608B, 0x1842,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x210B,
-    0x608B, 0x0000, 0x0000, 0x0000, 0x1842, 0x78F1, 0x78D1, 0x78F1,
-    0x78D1, 0x78F1, 0x1842, 0x78F1, 0x90D1, 0xB0B1, 0xA8D1, 0xA06B,
-    0x0000, 0x0000, 0x988B, 0xE0B0, 0xC8B1, 0x5884, 0x0000, 0x0000,
-    0x988B, 0xE0B0, 0xE0AE, 0xE8AE, 0xE0AC, 0xC88A, 0xE0AC, 0xE0AC,
-    0xE8AA, 0x0000, 0x0000, 0x0000, 0x0000, 0x5884, 0x90E4, 0x0000,
-    0xC0C6, 0xE9A6, 0xE9C5, 0x5084, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x1842, 0xFC85, 0xF365, 0xFB65,
-    0xCA64, 0x9AA3, 0x5084, 0x0000, 0x0000, 0x0000, 0x0000, 0xE906,
-    0xE108, 0xE0E7, 0x90E4, 0xC0C6, 0x0000, 0x5884, 0xE8AA, 0xE0AC,
-    0xE8AC, 0xE0AC, 0x1842, 0x0000, 0x5884, 0xE0B0, 0xE8AE, 0xC88E,
-    0x0000, 0x0000, 0x0000, 0xC8B1, 0xC8B1, 0xC8B1, 0xA08B, 0xA8B1,
-    0xB0D1, 0x88D1, 0x608B, 0x78F1, 0x0000, 0x0000, 0x0000, 0x608B,
-    0x190B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x190B, 0x608B, 0x0000, 0x0000, 0x0000, 0x6911, 0x6111, 0x608B,
-    0x6111, 0x78D1, 0x78F1, 0x78D1, 0x90D1, 0x90F1, 0x90D1, 0x1842,
-    0x0000, 0x0000, 0xA08B, 0xC8B1, 0xC8B1, 0x608B, 0x0000, 0x1842,
-    0xE8B0, 0xE0B0, 0xE8AE, 0xE0B0, 0x5084, 0x608B, 0x988B, 0xD08E,
-    0xE0AC, 0xE8AC, 0x988B, 0x0000, 0x0000, 0x0000, 0x0000, 0x90C4,
-    0x5884, 0xE906, 0xE126, 0xE165, 0x1842, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFC65, 0xFC85,
-    0xF365, 0xFB65, 0xD284, 0x1842, 0x0000, 0x0000, 0x0000, 0x5084,
-    0xE106, 0xE106, 0xE8E7, 0xC8C6, 0x1842, 0x0000, 0x0000, 0x5084,
-    0xE8AC, 0xE0AE, 0xE0AC, 0xE8AE, 0x5884, 0x5884, 0xE0B0, 0xE0B0,
-    0xE0B0, 0xE0B0, 0xC8AE, 0x5884, 0x0000, 0xD0B1, 0xB0D1, 0x1842,
-    0x0000, 0x88D1, 0x90F1, 0x90D1, 0x78F1, 0x608B, 0x0000, 0x0000,
-    0x2042, 0x4931, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x5151, 0x1842, 0x0000, 0x0000, 0x608B, 0x4931, 0x4951,
-    0x6111, 0x6911, 0x6111, 0x210B, 0x190B, 0x88D1, 0x78D1, 0x0000,
-    0x0000, 0x78F1, 0xB0B1, 0xA8D1, 0xB0B1, 0xC8B1, 0x0000, 0x608B,
-    0xC8B1, 0xE0B0, 0xE0B0, 0xE8B0, 0x1842, 0x0000, 0x0000, 0x988B,
-    0xC8AE, 0xE0AE, 0xE8AC, 0xE8AC, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x5084, 0xE106, 0xE106, 0xE965, 0xE945, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF365,
-    0xF365, 0xF365, 0xF285, 0xEA65, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0xE106, 0xE8E7, 0xE0E7, 0xE0C8, 0x986B, 0x1842, 0x0000,
-    0x0000, 0x5884, 0xE8AC, 0xE8AE, 0xE0AE, 0xE0B0, 0xC8AE, 0xE0B0,
-    0xC88E, 0x988B, 0xD0B1, 0xC8B1, 0xC8B1, 0xD0B1, 0xA8B1, 0xB0D1,
-    0x88D1, 0x0000, 0x0000, 0x1842, 0x78F1, 0x78D1, 0x6911, 0x0000,
-    0x0000, 0x0000, 0x190B, 0x210B, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x190B, 0x210B, 0x0000, 0x0000, 0x0000, 0x4931, 0x4951,
-    0x5131, 0x6111, 0x2042, 0x0000, 0x0000, 0x78F1, 0x6111, 0x6111,
-    0x608B, 0x90D1, 0x90F1, 0x90D1, 0x588B, 0xB0D1, 0xB0D1, 0xA8B1,
-    0xC8B1, 0xE8B0, 0xC8B1, 0xE0B0, 0x1842, 0x0000, 0x0000, 0x1842,
-    0xA08B, 0xE8AE, 0xE0AC, 0xE8AC, 0xC88A, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x5084, 0xE8E7, 0xE106, 0xE126, 0xE906, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0xCB84, 0xFC85, 0xF365, 0xFB65, 0xE9C5, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x90E4, 0xE108, 0xE0A8, 0xE0AA, 0xE8AA, 0xE0AA,
-    0xD0AE, 0xC88A, 0x5084, 0xE0AC, 0xE8AE, 0xE0B0, 0xE0AE, 0xE0B0,
-    0xE0B0, 0xE0B0, 0xE0B0, 0xE0B0, 0xD0B1, 0xC8B1, 0xA8D1, 0xB0B1,
-    0xB0D1, 0xB0B1, 0x608B, 0x0000, 0x0000, 0x1842, 0x78F1, 0x6111,
-    0x608B, 0x0000, 0x0000, 0x210B, 0x190B, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x210B, 0x210B, 0x0000, 0x0000, 0x190B, 0x5151,
-    0x4931, 0x4951, 0x0000, 0x0000, 0x0000, 0x4931, 0x6111, 0x6111,
-    0x6111, 0x78D1, 0x78F1, 0x90F1, 0x90D1, 0xA8B1, 0xB0D1, 0xA8B1,
-    0xB0D1, 0xC8B1, 0xC8B1, 0xE0B0, 0xA06B, 0x0000, 0x588B, 0xC8AE,
-    0xE0AE, 0xE0B0, 0xE0AE, 0xE8AE, 0xE8AC, 0x5884, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x5084, 0xE108, 0xE0E7, 0xE165, 0xC0C6, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x9AA3, 0xF365, 0xF365, 0xF285, 0xEA65, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0xE0E7, 0xE8A8, 0xE0C8, 0xE0A8, 0xE0AA,
-    0xE8AA, 0xE0AC, 0xE0AC, 0xE0AC, 0xE8AC, 0xE0AE, 0xE0AE, 0xE0B0,
-    0xE0B0, 0xE0B0, 0xC8B1, 0xE0B0, 0xC8B1, 0xC8B1, 0xB0D1, 0xA8B1,
-    0xB0D1, 0xA8B1, 0x90D1, 0x90F1, 0x1842, 0x0000, 0x0000, 0x6111,
-    0x4931, 0x4951, 0x2042, 0x0000, 0x0000, 0x4931, 0x2042, 0x0000,
-    0x0000, 0x0000, 0x1842, 0x210B, 0x0000, 0x0000, 0x2042, 0x3191,
-    0x2991, 0x3191, 0x190B, 0x0000, 0x0000, 0x210B, 0x4951, 0x4931,
-    0x5151, 0x6111, 0x6911, 0x78F1, 0x78D1, 0x90D1, 0x90F1, 0xA8D1,
-    0xB0B1, 0xA8D1, 0xB0B1, 0xC8B1, 0xC8B1, 0xE0B0, 0xC8B1, 0xE8B0,
-    0xE0B0, 0xE0B0, 0xE0AE, 0xE0AE, 0xE8AC, 0xE0AC, 0x90E4, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x90C4, 0xE8C8, 0xE0E7, 0xE108, 0x90C4,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x5064, 0xF365, 0xF285, 0xF285, 0xE9C5, 0x90C4,
-    0x0000, 0x0000, 0x0000, 0x90E4, 0xE8E7, 0xC0C6, 0x0000, 0x90C4,
-    0x988B, 0xE0AA, 0xE8AC, 0xE0AC, 0xE0AC, 0xE0AE, 0xE8AE, 0xE0B0,
-    0xE0B0, 0xE0B0, 0xE0B0, 0xC8B1, 0xB0B1, 0xC8AE, 0xB0B1, 0xA8D1,
-    0xB0B1, 0xB0D1, 0x90F1, 0x90D1, 0x78D1, 0x78F1, 0x0000, 0x0000,
-    0x4951, 0x608B, 0x1842, 0x5131, 0x0000, 0x0000, 0x190B, 0x3191,
-    0x0000, 0x0000, 0x0000, 0x3191, 0x190B, 0x0000, 0x0000, 0x3191,
-    0x3191, 0x0000, 0x3191, 0x3191, 0x0000, 0x190B, 0x5151, 0x4931,
-    0x4931, 0x6111, 0x6111, 0x6111, 0x6111, 0x78F1, 0x78F1, 0x90D1,
-    0x90D1, 0xA8D1, 0xB0B1, 0xC8B1, 0xA8D1, 0xC8B1, 0xC8B1, 0xE0B0,
-    0xE0B0, 0xE0B0, 0xE0B0, 0xE8AE, 0x5884, 0x90E4, 0xE0AC, 0xE8AC,
-    0x0000, 0x0000, 0x0000, 0x0000, 0xC0C6, 0xE108, 0xE0E7, 0xE906,
-    0x5884, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x1842, 0xFA85, 0xF285, 0xE9C5, 0xE9C5,
-    0xE1A6, 0x90C4, 0x0000, 0x0000, 0x90E4, 0xE8E7, 0x1842, 0x0000,
-    0x0000, 0x0000, 0x986B, 0xE8AC, 0xE8AC, 0xC88A, 0xC8AA, 0xC8AE,
-    0x986B, 0x988B, 0x1842, 0x2042, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x1842, 0x78D1, 0x78F1, 0x78D1, 0x6911, 0x6111,
-    0x210B, 0x4931, 0x0000, 0x0000, 0x3191, 0x190B, 0x0000, 0x0000,
-    0x210B, 0x1842, 0x0000, 0x2042, 0x210B, 0x0000, 0x0000, 0x190B,
-    0x3191, 0x3191, 0x0000, 0x190B, 0x3191, 0x2042, 0x3191, 0x3191,
-    0x2991, 0x4951, 0x210B, 0x190B, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x5884, 0x2042, 0x608B, 0xA08B, 0xA8B1, 0xB0D1, 0xC8B1,
-    0xC88E, 0xE8B0, 0xE0B0, 0x988B, 0x0000, 0x0000, 0x0000, 0x986B,
-    0xE8AC, 0x5084, 0x0000, 0x0000, 0x98E4, 0xE8A8, 0xE0C8, 0xE0E7,
-    0xE8E7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF365, 0xEA65, 0xF285,
-    0xE9C5, 0xE9C5, 0xE165, 0xE145, 0xC0C6, 0xD127, 0xE8E7, 0xE0C8,
-    0xC8AA, 0xE0AA, 0xE0AA, 0xE8AC, 0xE0AC, 0xE8AE, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x608B, 0x6111,
-    0x6111, 0x6911, 0x4931, 0x2042, 0x0000, 0x4931, 0x3191, 0x0000,
-    0x0000, 0x0A0E, 0x210B, 0x0000, 0x190B, 0x09EE, 0x0000, 0x0000,
-    0x21F2, 0x1A53, 0x2042, 0x0000, 0x1842, 0x2212, 0x3191, 0x2212,
-    0x3191, 0x5131, 0x1842, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x588B, 0xE0B0, 0xE0B0, 0xE0B0, 0xE0B0, 0x988B, 0xC88E,
-    0xE8AE, 0xE8AE, 0x988B, 0x986B, 0xE0AA, 0xE0AA, 0xE8C8, 0xE0A8,
-    0xE0C8, 0xE106, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xC165, 0xF285,
-    0xE9C5, 0xE9C5, 0xE145, 0xE165, 0xE106, 0xE106, 0xE8E7, 0xE0C8,
-    0xE0C8, 0xE0AA, 0xE8A8, 0xE0AA, 0xE0AA, 0xE0AC, 0xE8AC, 0x988B,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x4931, 0x4931, 0x4951, 0x3191, 0x0000, 0x1842, 0x3191,
-    0x1842, 0x0000, 0x0000, 0x2212, 0x2212, 0x21F2, 0x0000, 0x0000,
-    0x2042, 0x1A53, 0x2212, 0x0000, 0x0000, 0x2212, 0x21F2, 0x2212,
-    0x3191, 0x1842, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0xB0B1, 0xE8B0, 0xC8B1, 0xE0B0, 0xE8AE, 0xE0B0,
-    0xE0AE, 0xE0AE, 0xE8AC, 0xE0AC, 0xE0AA, 0xE0AC, 0xE8C8, 0xE0AA,
-    0xE0A8, 0xE0E7, 0x90E4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x62A3,
-    0xF265, 0xEA85, 0xE9C5, 0xE9C5, 0xE165, 0xE145, 0xE8E7, 0xE0E7,
-    0xE0C8, 0xE0C8, 0xC88A, 0xE8AA, 0xE0AA, 0xE8AC, 0x988B, 0xE0AE,
-    0xE8AE, 0x608B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x608B, 0x3191, 0x4931, 0x3191, 0x0000,
-    0x3191, 0x2212, 0x0000, 0x09EE, 0x1A53, 0x1AB4, 0x1A53, 0x09EE,
-    0x0000, 0x1A53, 0x12D4, 0x09EE, 0x0000, 0x1AB4, 0x1A53, 0x1A53,
-    0x190B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x588B, 0xD0B1, 0xC8B1, 0x70D1, 0xE0B0, 0xE0B0,
-    0xE8AE, 0xE0AE, 0xE0AE, 0xE0AE, 0xE8AC, 0xE0AC, 0xE0AA, 0xE0AA,
-    0xE8C8, 0xE0AA, 0xE8A8, 0x5884, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x1842, 0xF285, 0xE9C5, 0xE9C5, 0xE145, 0xE145, 0xE108, 0xE8E7,
-    0xE0C8, 0xE0A8, 0x5084, 0x0000, 0x5884, 0xE8AC, 0xE8AC, 0xE0AC,
-    0xE0AE, 0xE0AE, 0xC8AE, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x190B, 0x3191, 0x3191,
-    0x09EE, 0x1842, 0x2212, 0x2042, 0x210B, 0x12B4, 0x12B4, 0x1AB4,
-    0x210B, 0x1842, 0x1AB4, 0x12B4, 0x0000, 0x1AB4, 0x12B4, 0x1AB4,
-    0x190B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x2042, 0xD0B1, 0xC8B1, 0xD0B1, 0xA8B1, 0xE0B0,
-    0xC8B1, 0x5884, 0x1842, 0xD0AE, 0xE8AE, 0xE0AE, 0xE8AC, 0xE0AC,
-    0xE0AA, 0xE0AA, 0xE8A8, 0xE0C8, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0xE9C5, 0xE9C5, 0xE1A6, 0xE1C6, 0xE106, 0xE906,
-    0xE0E7, 0xE108, 0xE0C8, 0xE8A8, 0x90E4, 0xE108, 0xE0AC, 0xE0AE,
-    0xE8AC, 0xE8AE, 0x986B, 0x988B, 0xE88E, 0x2042, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3191,
-    0x2212, 0x2212, 0x09EE, 0x120E, 0x09EE, 0x190B, 0x1AB4, 0x1356,
-    0x12B4, 0x2042, 0x1A53, 0x0B56, 0x2042, 0x0B33, 0x0B56, 0x1356,
-    0x210B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1842, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x1842, 0xB0B1, 0x588B, 0xD0B1, 0xC8B1, 0xE0B0,
-    0xE0B0, 0xE0B0, 0x988B, 0x986B, 0xE8AE, 0xE0AE, 0xE0AE, 0xE0AE,
-    0xE8AC, 0xE108, 0xE0AA, 0xE0AA, 0xC0C6, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x90E4, 0xE9C5, 0xE9C5, 0xE165, 0xE106,
-    0xC0C6, 0x5884, 0xE8C8, 0xE0A8, 0xE0C8, 0xE0AA, 0xE8AA, 0xE0AC,
-    0xE0AC, 0xE0AE, 0xE8AE, 0x986B, 0x988B, 0xE0B0, 0xB0B1, 0x5084,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1842, 0x3191,
-    0x3191, 0x2212, 0x2212, 0x09EE, 0x1A53, 0x1AB4, 0x0000, 0x12B4,
-    0x1356, 0x0B33, 0x0000, 0x0B56, 0x1356, 0x09EE, 0x1356, 0x1356,
-    0x1356, 0x12B4, 0x09EE, 0x2042, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x2042, 0x90F1, 0x90D1, 0x588B, 0xA08B, 0xC8B1,
-    0xC8B1, 0xE8B0, 0xE0B0, 0xE0B0, 0xE0AE, 0xE0B0, 0xE0AE, 0xE8AC,
-    0x5084, 0xE8AC, 0xE0AA, 0xE0AA, 0xE8C8, 0x5084, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE9C5, 0xE965, 0xE165,
-    0xE906, 0x90C4, 0x5884, 0x90E4, 0xC0C6, 0xE0AA, 0xE8AA, 0xE0AC,
-    0xE0AC, 0xE0AE, 0xE8AE, 0xE0AE, 0xE0AE, 0xE8B0, 0xD08E, 0x1842,
-    0x988B, 0xA06B, 0x2042, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x1842, 0x210B, 0x4931, 0x3191, 0x2991,
-    0x3191, 0x2212, 0x2212, 0x2042, 0x09EE, 0x1AB4, 0x12B4, 0x0B33,
-    0x1356, 0x0BF8, 0x1356, 0x0B56, 0x0BD8, 0x0BF8, 0x0BF8, 0x2042,
-    0x09EE, 0x0BD8, 0x1356, 0x1356, 0x12B4, 0x1AD4, 0x09EE, 0x1842,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x608B, 0x78D1, 0x190B, 0xB0D1, 0xA8B1, 0xC8B1,
-    0xC8B1, 0xE0B0, 0xC8B1, 0xE0B0, 0xE0B0, 0xE0B0, 0xE8AE, 0xE0AE,
-    0xA08B, 0x5884, 0x986B, 0xE0AC, 0xE0AA, 0xE8AA, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5084, 0xE945,
-    0xE106, 0xE126, 0xC0C6, 0x5084, 0x0000, 0x5884, 0xE8C8, 0xE8AA,
-    0xC88A, 0xE0AC, 0xE0AC, 0xC88A, 0x0000, 0xE0B0, 0xE0AE, 0x988B,
-    0x0000, 0x1842, 0xD0AE, 0xD0B1, 0xA8B1, 0xB0D1, 0x986B, 0x90D1,
-    0x588B, 0x608B, 0x608B, 0x6111, 0x4951, 0x4931, 0x210B, 0x190B,
-    0x0000, 0x210B, 0x2212, 0x1A53, 0x09EE, 0x12D4, 0x1AB4, 0x09EE,
-    0x1AB4, 0x0BF8, 0x0B56, 0x0BD8, 0x0BF8, 0x0B33, 0x0B33, 0x0BD8,
-    0x0B33, 0x09EE, 0x1356, 0x0BF8, 0x1842, 0x210B, 0x09EE, 0x1AD4,
-    0x1A53, 0x1A53, 0x190B, 0x210B, 0x2042, 0x1842, 0x2042, 0x190B,
-    0x210B, 0x4931, 0x6911, 0x6111, 0x0000, 0x0000, 0xA08B, 0xA8B1,
-    0xB0D1, 0x588B, 0xB0B1, 0xE0B0, 0xE0B0, 0xE0B0, 0xE8AE, 0xE0AE,
-    0x0000, 0x5084, 0x5884, 0xC88A, 0xE8AA, 0xE8AA, 0x5084, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0xC0C6, 0xE165, 0xE126, 0xE906, 0xC0C6, 0x90C4, 0xE0C8, 0xE8AA,
-    0xC88A, 0x5884, 0xE8AC, 0xE8AE, 0x1842, 0x0000, 0x5084, 0xE0B0,
-    0xD0AE, 0xC88E, 0xC8B1, 0xD0B1, 0x988B, 0xA8B1, 0xB0D1, 0xB0D1,
-    0x90D1, 0x90F1, 0x608B, 0x190B, 0x5131, 0x4931, 0x0000, 0x0000,
-    0x0000, 0x1842, 0x3191, 0x1A53, 0x1A53, 0x1AB4, 0x12B4, 0x210B,
-    0x0000, 0x1356, 0x0BF8, 0x0BD8, 0x0BD8, 0x0479, 0x0B33, 0x0000,
-    0x0B33, 0x0499, 0x0BD8, 0x0BF8, 0x0BF8, 0x09EE, 0x0000, 0x0000,
-    0x0000, 0x09EE, 0x1A53, 0x2212, 0x210B, 0x2212, 0x3191, 0x4931,
-    0x2991, 0x6911, 0x4951, 0x6111, 0x6111, 0x90D1, 0x5884, 0x90D1,
-    0xB0D1, 0x1842, 0x0000, 0x588B, 0xC8B1, 0xE8B0, 0x588B, 0xE0B0,
-    0xE8AE, 0xC88E, 0x1842, 0xC8AE, 0xE8AC, 0xE8AC, 0x988B, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x5084, 0xE906, 0xE8E7, 0xE0E7, 0xE0C8, 0xE0A8,
-    0x988B, 0x5884, 0xC88A, 0xE8AC, 0x988B, 0x0000, 0x0000, 0x1842,
-    0xE8AE, 0xE0B0, 0xC8B1, 0xD0B1, 0x1842, 0x0000, 0xB0B1, 0x988B,
-    0x608B, 0x90D1, 0x78F1, 0x6111, 0x1842, 0x4931, 0x0000, 0x0000,
-    0x0000, 0x3191, 0x3191, 0x2212, 0x2212, 0x12B4, 0x1AB4, 0x190B,
-    0x0000, 0x0000, 0x1356, 0x0BD8, 0x0BD8, 0x0C99, 0x0BD8, 0x0479,
-    0x0000, 0x0000, 0x0BD8, 0x0C99, 0x0BD8, 0x0BD8, 0x0B56, 0x1356,
-    0x2042, 0x0000, 0x0000, 0x09EE, 0x0A0E, 0x210B, 0x3191, 0x3191,
-    0x2991, 0x0000, 0x4931, 0x608B, 0x0000, 0x6911, 0x78F1, 0x90D1,
-    0x90D1, 0xA8D1, 0x0000, 0x0000, 0x0000, 0xB0D1, 0xC8B1, 0x986B,
-    0x608B, 0xE0B0, 0xE8AE, 0xE0AE, 0xE0AC, 0xE8AC, 0x5084, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5084, 0x90E4, 0xE8C8,
-    0xC88A, 0xC88A, 0x988B, 0xE0AC, 0xE8AC, 0xA06B, 0x2042, 0x1842,
-    0x1842, 0xE0B0, 0xE8B0, 0x988B, 0x0000, 0x0000, 0x5884, 0xB0D1,
-    0x588B, 0x0000, 0x90D1, 0x78F1, 0x6911, 0x6111, 0x2042, 0x0000,
-    0x0000, 0x4931, 0x3191, 0x1842, 0x2042, 0x1AB4, 0x1A53, 0x1A53,
-    0x0000, 0x0000, 0x190B, 0x0BD8, 0x0BD8, 0x0C79, 0x0479, 0x0C79,
-    0x0479, 0x0000, 0x0000, 0x210B, 0x0479, 0x0C99, 0x0BF8, 0x0000,
-    0x09EE, 0x1356, 0x190B, 0x0000, 0x0000, 0x21F2, 0x2212, 0x2212,
-    0x3191, 0x210B, 0x0000, 0x4951, 0x4931, 0x0000, 0x0000, 0x1842,
-    0x78D1, 0xB0D1, 0x90D1, 0x0000, 0x0000, 0x0000, 0x588B, 0xE0B0,
-    0xC8AE, 0xD08E, 0x988B, 0xD08E, 0x988B, 0x5884, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x1842, 0x2042, 0x5884, 0x608B, 0xA06B, 0x988B, 0xD08E,
-    0x988B, 0xC88E, 0xE8AE, 0xC8B1, 0x1842, 0x608B, 0x0000, 0xA08B,
-    0xA8B1, 0x90D1, 0x0000, 0x588B, 0x78F1, 0x78F1, 0x4931, 0x608B,
-    0x0000, 0x4931, 0x210B, 0x0000, 0x0000, 0x190B, 0x2212, 0x1AB4,
-    0x0000, 0x0000, 0x0000, 0x190B, 0x0BF8, 0x0C79, 0x0479, 0x0C79,
-    0x0479, 0x0C79, 0x0000, 0x0000, 0x0000, 0x0B33, 0x0479, 0x0C79,
-    0x1842, 0x0000, 0x2042, 0x0B33, 0x190B, 0x2042, 0x2212, 0x21F2,
-    0x3191, 0x3191, 0x0000, 0x0000, 0x4931, 0x6111, 0x2042, 0x608B,
-    0x1842, 0x608B, 0x90F1, 0x90D1, 0x608B, 0x588B, 0x608B, 0xA08B,
-    0x588B, 0xA08B, 0x1842, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x1842, 0x1842, 0x0000, 0x0000, 0xD08E, 0x588B, 0xA08B,
-    0xA8B1, 0xD0B1, 0xB0D1, 0x78D1, 0x1842, 0x78F1, 0x6111, 0x6911,
-    0x4951, 0x4931, 0x210B, 0x0000, 0x0000, 0x0000, 0x21F2, 0x1AB4,
-    0x190B, 0x0000, 0x0000, 0x0000, 0x210B, 0x0479, 0x0C79, 0x0479,
-    0x0C79, 0x0479, 0x0C79, 0x0000, 0x0000, 0x0000, 0x0000, 0x0479,
-    0x0C79, 0x0B33, 0x0000, 0x0000, 0x0000, 0x0333, 0x1AB4, 0x12B4,
-    0x2212, 0x2212, 0x210B, 0x190B, 0x3191, 0x4951, 0x4931, 0x6911,
-    0x210B, 0x4931, 0x0000, 0x0000, 0x0000, 0x1842, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x2042, 0xE8AE, 0xC8B1, 0xB0D1,
-    0xA8B1, 0xC8B1, 0xB0D1, 0xA8B1, 0x90D1, 0x90F1, 0x6111, 0x6111,
-    0x4931, 0x4951, 0x3191, 0x3191, 0x0000, 0x0000, 0x190B, 0x2212,
-    0x1A53, 0x0000, 0x0000, 0x0000, 0x0000, 0x210B, 0x0BD8, 0x0499,
-    0x0C79, 0x0479, 0x0C79, 0x0BD8, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x09EE, 0x0499, 0x0BD8, 0x2042, 0x0000, 0x210B, 0x12B4, 0x12B4,
-    0x1A53, 0x2212, 0x3191, 0x3191, 0x3191, 0x4931, 0x3191, 0x4931,
-    0x4931, 0x4951, 0x6911, 0x78F1, 0x1842, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x986B, 0xE0B0, 0xE0B0, 0xE0B0,
-    0xC8B1, 0xC8B1, 0xB0D1, 0xB0B1, 0x588B, 0x78F1, 0x90D1, 0x78F1,
-    0x6911, 0x6111, 0x5151, 0x4931, 0x3191, 0x4931, 0x190B, 0x2212,
-    0x21F2, 0x210B, 0x0000, 0x0000, 0x0000, 0x0000, 0x210B, 0x0499,
-    0x0BD8, 0x0C79, 0x0479, 0x0C79, 0x0333, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0BD8, 0x0C79, 0x0333, 0x3A42, 0x1356, 0x1356,
-    0x12B4, 0x12B4, 0x2212, 0x2212, 0x3191, 0x3191, 0x3191, 0x4931,
-    0x4931, 0x6111, 0x6111, 0x78F1, 0x78D1, 0xB0D1, 0xA06B, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x5884, 0xE8AE, 0xE0B0, 0xE0B0, 0xE0B0,
-    0xC8B1, 0xC8B1, 0xD0B1, 0xC8B1, 0x988B, 0x0000, 0x90D1, 0x78F1,
-    0x608B, 0x78D1, 0x588B, 0x4931, 0x4951, 0x4931, 0x3191, 0x3191,
-    0x3191, 0x3191, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x190B,
-    0x0BF8, 0x0C99, 0x0479, 0x0C79, 0x0479, 0x0BD8, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x2042, 0x0BD8, 0x0BF8, 0x0B56, 0x1356,
-    0x1AB4, 0x12B4, 0x09EE, 0x2212, 0x09EE, 0x3191, 0x3191, 0x0000,
-    0x210B, 0x6111, 0x4931, 0x6911, 0x78F1, 0x90D1, 0x90F1, 0xA8D1,
-    0xB0B1, 0x588B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0xC8AE, 0xE8AE, 0xE0B0, 0xE0B0, 0xE0B0,
-    0xE0B0, 0xE0B0, 0xC8B1, 0xD0B1, 0x608B, 0x588B, 0x90D1, 0xB0D1,
-    0x608B, 0x78F1, 0x6111, 0x2042, 0x4931, 0x4951, 0x3191, 0x4931,
-    0x3191, 0x2212, 0x2042, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x09EE, 0x0BD8, 0x0BD8, 0x0479, 0x0C79, 0x0499, 0x0B33, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1356, 0x1356, 0x0B56,
-    0x1AB4, 0x1356, 0x12B4, 0x0000, 0x09EE, 0x2212, 0x210B, 0x4951,
-    0x2991, 0x608B, 0x608B, 0x6111, 0x6111, 0x90D1, 0x88D1, 0xB0D1,
-    0xA8B1, 0xD0B1, 0xC8B1, 0xB0D1, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x1842, 0xE8AC, 0xE0AC, 0xE0AE, 0xE8AE, 0xE0B0,
-    0xC88E, 0xE0B0, 0xC8B1, 0x988B, 0xC8B1, 0xB0B1, 0x988B, 0x608B,
-    0x78D1, 0x608B, 0x6111, 0x78F1, 0x0000, 0x4931, 0x4931, 0x4951,
-    0x3191, 0x3191, 0x3191, 0x2212, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x09EE, 0x0B56, 0x0BF8, 0x0BD8, 0x0C99, 0x0BD8, 0x0333,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x09EE, 0x1356, 0x1356,
-    0x1356, 0x1356, 0x12B4, 0x1A53, 0x0000, 0x210B, 0x3191, 0x190B,
-    0x210B, 0x4931, 0x210B, 0x608B, 0x6111, 0x6111, 0x608B, 0x90F1,
-    0x988B, 0xB0B1, 0xB0D1, 0xC8B1, 0xC8B1, 0xC8B1, 0x1842, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x90E4, 0xE0AC, 0xE0AC, 0xE8AE, 0xE0AE, 0xE0AE,
-    0xE8AE, 0xC8B1, 0xE0B0, 0xB0B1, 0x988B, 0xC8B1, 0xB0B1, 0xB0D1,
-    0x608B, 0x90D1, 0x190B, 0x78F1, 0x6111, 0x6911, 0x4951, 0x4931,
-    0x3191, 0x4931, 0x2042, 0x2212, 0x2212, 0x3191, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x09EE, 0x0BD8, 0x0BF8, 0x0BD8, 0x0BD8, 0x0C79,
-    0x0333, 0x0000, 0x0000, 0x0000, 0x0000, 0x3A42, 0x0BF8, 0x0BD8,
-    0x0A0E, 0x09EE, 0x1AB4, 0x1AB4, 0x1A53, 0x09EE, 0x2212, 0x2212,
-    0x190B, 0x5131, 0x190B, 0x5131, 0x190B, 0x6111, 0x78F1, 0x608B,
-    0x78F1, 0x588B, 0x90D1, 0xC8B1, 0xB0B1, 0xC8B1, 0xC8B1, 0xE8B0,
-    0x608B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x986B, 0xE8AA, 0xE8AA, 0xE0AC, 0xE0AC, 0xE0AE,
-    0xE8AE, 0xE0B0, 0xE0AE, 0xE0B0, 0x1842, 0x1842, 0xD0B1, 0xB0D1,
-    0x0000, 0xA8B1, 0x90D1, 0x588B, 0x78F1, 0x78F1, 0x6111, 0x6911,
-    0x4931, 0x4931, 0x0000, 0x0000, 0x190B, 0x2212, 0x2212, 0x2042,
-    0x0000, 0x0000, 0x0000, 0x09EE, 0x1356, 0x0BF8, 0x1356, 0x0BD8,
-    0x0BF8, 0x0333, 0x0000, 0x0000, 0x0000, 0x0000, 0x0B33, 0x0BD8,
-    0x1AB4, 0x0000, 0x0000, 0x09EE, 0x1A73, 0x1A53, 0x2212, 0x21F2,
-    0x3191, 0x3191, 0x190B, 0x4931, 0x2042, 0x0000, 0x6911, 0x78F1,
-    0x0000, 0x608B, 0x90D1, 0xA8D1, 0xB0D1, 0xC8B1, 0xC8B1, 0xE0B0,
-    0xE0B0, 0xE0B0, 0x986B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0xC88A, 0xE8AA, 0xE0AA, 0xE0AC, 0xE0AC, 0xE8AE,
-    0xE0AE, 0xE0B0, 0xE0AE, 0xE0B0, 0xE0B0, 0xE8B0, 0x988B, 0xC8B1,
-    0xD0B1, 0x988B, 0x90D1, 0xA8D1, 0x90D1, 0x90D1, 0x78F1, 0x78F1,
-    0x6911, 0x4931, 0x5131, 0x190B, 0x0000, 0x0000, 0x210B, 0x2212,
-    0x09EE, 0x0000, 0x0000, 0x0000, 0x1A53, 0x1356, 0x1356, 0x0BF8,
-    0x0B56, 0x0BF8, 0x0B33, 0x0000, 0x0000, 0x0000, 0x09EE, 0x0BD8,
-    0x1356, 0x0000, 0x0000, 0x0000, 0x09EE, 0x1A53, 0x2212, 0x2212,
-    0x3191, 0x2212, 0x3191, 0x4931, 0x4931, 0x190B, 0x608B, 0x78F1,
-    0x608B, 0x588B, 0x90D1, 0xB0D1, 0xA8B1, 0xC8B1, 0xC8B1, 0xE8B0,
-    0xC8B1, 0xE0B0, 0xE0B0, 0xE0B0, 0xB0D1, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0xC0C6, 0xE0C8, 0xE0A8, 0xE0AA, 0xE8AA, 0xE0AC,
-    0xE0AC, 0xE0AC, 0x988B, 0xE8AE, 0xE0AE, 0xE0B0, 0xE0B0, 0xE0B0,
-    0xC8B1, 0xC8B1, 0xB0B1, 0xA8D1, 0x90D1, 0x90D1, 0x78F1, 0x78F1,
-    0x6111, 0x6111, 0x4931, 0x4931, 0x3191, 0x0000, 0x0000, 0x0000,
-    0x3191, 0x2212, 0x0000, 0x0000, 0x09EE, 0x0A0E, 0x12B4, 0x1356,
-    0x1356, 0x1356, 0x12B4, 0x09EE, 0x09EE, 0x0000, 0x0000, 0x1356,
-    0x1356, 0x210B, 0x0000, 0x0000, 0x190B, 0x1A73, 0x09EE, 0x2212,
-    0x3191, 0x3191, 0x3191, 0x3191, 0x3191, 0x4931, 0x4931, 0x6911,
-    0x6111, 0x78F1, 0x78F1, 0x90D1, 0x90D1, 0xA8D1, 0xB0D1, 0xC8B1,
-    0xC8B1, 0xE8B0, 0xE0B0, 0xE0B0, 0xE0AE, 0xE0B0, 0x986B, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0xC0C6, 0xE0E7, 0xE8A8, 0xE0AA, 0xE0AA, 0xE0AC,
-    0xE8AC, 0xE8AE, 0x588B, 0x0000, 0x988B, 0xE0B0, 0xE0B0, 0xE8B0,
-    0xC8B1, 0xC8B1, 0xB0D1, 0x88D1, 0xB0B1, 0xB0D1, 0x90F1, 0x90D1,
-    0x78F1, 0x0000, 0x190B, 0x6911, 0x190B, 0x4931, 0x3191, 0x0000,
-    0x0000, 0x210B, 0x2212, 0x09EE, 0x2042, 0x21F2, 0x0000, 0x12B4,
-    0x1AB4, 0x1356, 0x12B4, 0x0B33, 0x0000, 0x0333, 0x0000, 0x210B,
-    0x1AB4, 0x0333, 0x0000, 0x0000, 0x2042, 0x12B4, 0x2212, 0x2212,
-    0x3191, 0x0000, 0x210B, 0x4951, 0x3191, 0x4931, 0x4931, 0x6111,
-    0x6111, 0x78F1, 0x78F1, 0x88D1, 0x90D1, 0xB0D1, 0xA8B1, 0x588B,
-    0x0000, 0xE0B0, 0xE0B0, 0xE0B0, 0xE0B0, 0xE0B0, 0xE8AE, 0xE8AE,
-    0x988B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x5084, 0xE8E7, 0xE0C8, 0xE8A8, 0xE0C8, 0xE0AA,
-    0xE0AA, 0xE8AC, 0xE0AC, 0xC88A, 0x0000, 0x0000, 0xC8AE, 0xA8B1,
-    0x0000, 0x0000, 0x608B, 0xC8B1, 0xB0D1, 0xC8B1, 0xA8B1, 0xB0D1,
-    0x90D1, 0x190B, 0x0000, 0x0000, 0x190B, 0x210B, 0x0000, 0x4931,
-    0x210B, 0x0000, 0x0000, 0x3191, 0x2991, 0x3191, 0x1842, 0x0000,
-    0x1A73, 0x1AB4, 0x12B4, 0x1AB4, 0x1A53, 0x0000, 0x210B, 0x190B,
-    0x09EE, 0x1AB4, 0x2042, 0x0000, 0x1842, 0x1A53, 0x210B, 0x0000,
-    0x190B, 0x2042, 0x0000, 0x0000, 0x3191, 0x4931, 0x4951, 0x6911,
-    0x6111, 0x78F1, 0x1842, 0x0000, 0x2042, 0x78D1, 0xB0D1, 0x1842,
-    0x0000, 0x98C4, 0xD0B1, 0xE0B0, 0xE0B0, 0xE0B0, 0xE8AE, 0xE0AE,
-    0xE0AE, 0xE0AE, 0x5884, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0xE906, 0xE0E7, 0xE108, 0xE0A8, 0xE0AA,
-    0xE8AA, 0xE108, 0xE0AA, 0xE0AC, 0xE8AC, 0x608B, 0x1842, 0xE8B0,
-    0x988B, 0x0000, 0x0000, 0x986B, 0xD0B1, 0xC8B1, 0xC8B1, 0xB0D1,
-    0x90D1, 0xB0D1, 0x0000, 0x0000, 0x0000, 0x608B, 0x4931, 0x0000,
-    0x0000, 0x4931, 0x3191, 0x0000, 0x3191, 0x2212, 0x2212, 0x0000,
-    0x0000, 0x1A53, 0x1A53, 0x12B4, 0x1A53, 0x1A53, 0x0000, 0x210B,
-    0x1A53, 0x12B4, 0x1AB4, 0x1842, 0x210B, 0x1A53, 0x190B, 0x0000,
-    0x210B, 0x3191, 0x0000, 0x0000, 0x0000, 0x4951, 0x4931, 0x6111,
-    0x6111, 0x78D1, 0x78F1, 0x78D1, 0x0000, 0x0000, 0x608B, 0xC8B1,
-    0x5884, 0x0000, 0xC8AE, 0xE0B0, 0xE0B0, 0xE0B0, 0xE0B0, 0xE0B0,
-    0xE0AE, 0xE0AE, 0xE0AC, 0xE8AC, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x5084, 0xE926, 0xE106, 0xE0E7, 0xE8C8,
-    0xE0C8, 0xE0AA, 0xE0A8, 0xE8AA, 0xE0AA, 0xE0AC, 0xC8AE, 0x986B,
-    0xE8AE, 0xE0AE, 0x0000, 0x0000, 0xA8D1, 0xE8B0, 0xC8B1, 0xC8B1,
-    0x986B, 0x1842, 0x90D1, 0x2042, 0x0000, 0x0000, 0x0000, 0x4951,
-    0x190B, 0x0000, 0x0000, 0x5131, 0x3191, 0x3191, 0x2991, 0x3191,
-    0x0000, 0x0000, 0x0A0E, 0x2212, 0x21F2, 0x1A53, 0x09EE, 0x0000,
-    0x0000, 0x2212, 0x2212, 0x1A53, 0x2212, 0x21F2, 0x2042, 0x0000,
-    0x0000, 0x3191, 0x0000, 0x0000, 0x0000, 0x0000, 0x4931, 0x190B,
-    0x0000, 0x6911, 0x6111, 0x78F1, 0x90D1, 0x608B, 0x0000, 0xB0D1,
-    0xA8D1, 0xA06B, 0x988B, 0xE0B0, 0xC8B1, 0xE8B0, 0xE0AE, 0xE0B0,
-    0xE0AE, 0xE8AE, 0xE0AC, 0xE0AC, 0xE0AA, 0x1842, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x1842, 0xE165, 0xE906, 0xE108,
-    0xE0C8, 0xE0A8, 0xE0C8, 0xE8AA, 0xE0AA, 0xA06B, 0x988B, 0xE0AE,
-    0xC88A, 0xA08B, 0xE8AE, 0x1842, 0x5084, 0xE0B0, 0xE0B0, 0xE8B0,
-    0xC8B1, 0xC8B1, 0xB0B1, 0xA8D1, 0x608B, 0x608B, 0x608B, 0x608B,
-    0x6111, 0x6911, 0x1842, 0x0000, 0x0000, 0x606B, 0x2991, 0x3191,
-    0x2042, 0x0000, 0x0000, 0x2212, 0x2212, 0x21F2, 0x2212, 0x2212,
-    0x0000, 0x0000, 0x190B, 0x21F2, 0x2212, 0x2212, 0x0000, 0x0000,
-    0x0000, 0x3191, 0x3191, 0x2042, 0x1842, 0x210B, 0x1842, 0x6111,
-    0x608B, 0x6111, 0x6111, 0x78D1, 0x78F1, 0xB0D1, 0x90D1, 0x5884,
-    0xA8D1, 0x90D1, 0x588B, 0xE8B0, 0xC8B1, 0x986B, 0xE0B0, 0xE0B0,
-    0xE0AE, 0xE0B0, 0xE0AE, 0xE8AE, 0xE8AC, 0xE8AC, 0x1842, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1842, 0xE906, 0xE906,
-    0xE0E7, 0xE0E7, 0xE8C8, 0xE0C8, 0xE0A8, 0xC0C6, 0x1842, 0x0000,
-    0xE8AC, 0xE0AE, 0xE8AE, 0xE0AE, 0xC8AE, 0xE0B0, 0xE0B0, 0xE0B0,
-    0x588B, 0x0000, 0xB0B1, 0xC8B1, 0x988B, 0x608B, 0x1842, 0x608B,
-    0x608B, 0x78D1, 0x6111, 0x6911, 0x4931, 0x1842, 0x0000, 0x4951,
-    0x3191, 0x0000, 0x0000, 0x0000, 0x3191, 0x2212, 0x3191, 0x2212,
-    0x09EE, 0x0000, 0x0000, 0x0000, 0x3191, 0x2212, 0x1842, 0x0000,
-    0x210B, 0x3191, 0x3191, 0x3191, 0x190B, 0x4931, 0x210B, 0x4931,
-    0x4931, 0x6911, 0x6111, 0x1842, 0x0000, 0x90F1, 0x90D1, 0xB0D1,
-    0xB0D1, 0xC8B1, 0xB0B1, 0xC8B1, 0xC8B1, 0x608B, 0x0000, 0x988B,
-    0xE8AE, 0xE0B0, 0xE0AE, 0xE8AE, 0xE0AC, 0xE0AC, 0xE0AA, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE165,
-    0xE126, 0xE106, 0xE8E7, 0xE0E7, 0xE0A8, 0xE8AA, 0x5884, 0x90E4,
-    0xC88A, 0xE0AE, 0xE0AC, 0xE8AE, 0xE0AE, 0xE0B0, 0xE0B0, 0xE0B0,
-    0xE8B0, 0x588B, 0xA08B, 0x986B, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x608B, 0x78F1, 0x608B, 0x6111, 0x6111, 0x6911,
-    0x4951, 0x4931, 0x0000, 0x0000, 0x0000, 0x4951, 0x3191, 0x3191,
-    0x3191, 0x2991, 0x0000, 0x0000, 0x0000, 0x3191, 0x3191, 0x3191,
-    0x3191, 0x4931, 0x210B, 0x4951, 0x3191, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x1842, 0x608B, 0x190B, 0x0000, 0x90D1, 0xA8B1,
-    0xB0D1, 0xC8B1, 0xC8B1, 0xC8B1, 0xC8B1, 0xE8B0, 0x986B, 0x608B,
-    0x1842, 0xE0B0, 0xE0AE, 0xE8AE, 0xE0AC, 0xE0AE, 0xE0AC, 0xE8AC,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0xC165, 0xE965, 0xE108, 0xE0E7, 0xE0A8, 0xE8C8, 0xE0A8, 0xC0C6,
-    0x988B, 0xE8AC, 0xE0AC, 0xE0AC, 0xE0AC, 0xE8AE, 0xE0AE, 0xE0B0,
-    0xA8B1, 0xC8B1, 0xC8B1, 0x98E4, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x78D1, 0x78F1, 0x0000, 0x0000, 0x1842,
-    0x608B, 0x6111, 0x1842, 0x0000, 0x0000, 0x0000, 0x210B, 0x3191,
-    0x3191, 0x3191, 0x190B, 0x0000, 0x0000, 0x0000, 0x210B, 0x3191,
-    0x190B, 0x2042, 0x0000, 0x0000, 0x190B, 0x4931, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x210B, 0x90D1, 0xB0D1,
-    0x988B, 0xB0B1, 0xB0D1, 0xC8B1, 0xC8B1, 0xE0B0, 0xC8B1, 0xE8B0,
-    0xC88E, 0x90E4, 0xE8AE, 0xE0AE, 0xE0AC, 0xE8AC, 0xE0AC, 0xE0AC,
-    0xC88A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0xC185, 0xE165, 0xE106, 0xE8E7, 0xE108, 0xE0A8, 0xE0C8,
-    0xE0A8, 0xE8AC, 0xE0AA, 0xE8AC, 0x90E4, 0xC88E, 0xE0AE, 0xE0AE,
-    0xE8AE, 0xD0AE, 0x986B, 0xE0B0, 0xB0D1, 0x608B, 0x1842, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x90D1, 0x78F1, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x210B, 0x210B, 0x0000, 0x0000, 0x0000, 0x4951,
-    0x3191, 0x4931, 0x3191, 0x4951, 0x0000, 0x0000, 0x0000, 0x190B,
-    0x210B, 0x0000, 0x0000, 0x0000, 0x0000, 0x4931, 0x5131, 0x1842,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x1842, 0x78F1, 0x90D1, 0xA8D1,
-    0x90D1, 0x608B, 0xA8D1, 0xD0B1, 0xC8B1, 0xE0B0, 0xA8D1, 0xC8B1,
-    0xE0B0, 0xE0B0, 0xE0AE, 0xE8AE, 0xE0AE, 0xE0AE, 0xE0AC, 0xE8AC,
-    0xE0AA, 0xC88A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x90C4, 0xE965, 0xE106, 0xE906, 0xE0E7, 0xE0E7,
-    0xE0C8, 0xE8AA, 0xE0C8, 0xE0AA, 0x986B, 0x0000, 0x90E4, 0xE8AE,
-    0xE8AE, 0xE0B0, 0xE0AE, 0xA8B1, 0x0000, 0x988B, 0xB0B1, 0xC8B1,
-    0xC8B1, 0xD0B1, 0xA8D1, 0xB0B1, 0x88D1, 0xB0D1, 0x190B, 0x0000,
-    0x0000, 0x0000, 0x1842, 0x6911, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x190B, 0x5131, 0x4951, 0x4931, 0x210B, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x4951, 0x2042, 0x0000, 0x0000, 0x0000, 0x190B, 0x6911,
-    0x608B, 0x6111, 0x6111, 0x78F1, 0x78D1, 0x78F1, 0x90D1, 0x78F1,
-    0x0000, 0x608B, 0xB0B1, 0xC8B1, 0xC8B1, 0xE0B0, 0x988B, 0x0000,
-    0x608B, 0xE8B0, 0xE0AE, 0xE0AE, 0xE8AE, 0xE0AE, 0xE0AC, 0xE0AC,
-    0xE8AA, 0xE0AA, 0x5084, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x90E4, 0xE145, 0xE965, 0xE126, 0xE106,
-    0xE0E7, 0xE108, 0xE8A8, 0xE0AA, 0xE8AA, 0xD127, 0xC8AE, 0xE0AC,
-    0xE0AC, 0xE0AE, 0xE8AE, 0xE8B0, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x1842, 0x78D1, 0x988B, 0xA06B, 0xA8D1, 0xC8B1, 0x90D1, 0xA08B,
-    0x0000, 0x0000, 0x1842, 0x90F1, 0x608B, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x4931, 0x6911, 0x4951, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x4931, 0x6911, 0x1842, 0x0000, 0x0000, 0x4951,
-    0x4931, 0x78D1, 0x78F1, 0x78D1, 0x608B, 0x608B, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0xC8B1, 0xC8B1, 0xC8B1, 0xE0B0, 0xE0B0,
-    0xC8AE, 0xC88E, 0xE0B0, 0xE0B0, 0xE8AE, 0xE0AE, 0xE0AC, 0xE0AC,
-    0xE8AC, 0xE0AC, 0xE8AA, 0x5884, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x5884, 0xE1A6, 0xE906, 0xE126,
-    0xE108, 0xE0E7, 0xE8C8, 0xE0A8, 0xE0C8, 0xE0AA, 0xE8AA, 0xE0AC,
-    0xE0AC, 0xE0AC, 0xE8AC, 0xE0AE, 0x90C4, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x588B, 0x608B, 0xB0D1,
-    0x588B, 0x0000, 0x1842, 0x90D1, 0x90D1, 0x2042, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x1842, 0x210B, 0x1842, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x2042, 0x6911, 0x6111, 0x1842, 0x0000,
-    0x608B, 0x6911, 0x78F1, 0x1842, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x5884, 0xD0B1, 0xC8B1, 0xE8B0,
-    0xE0B0, 0xE0B0, 0xE0AE, 0xE0B0, 0xE0AE, 0xE8AE, 0xE0AC, 0xE0AC,
-    0xE0AC, 0xE8AC, 0xE0AA, 0xE0AA, 0x1842, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1842, 0xE1A6, 0xE965,
-    0xE106, 0xE106, 0xE0E7, 0xE8E7, 0xC0C6, 0xC0C6, 0xE0C8, 0xE0AA,
-    0xC0C6, 0xE0AC, 0xE8AC, 0xE8AE, 0xE8AC, 0x1842, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x986B, 0x608B, 0x588B,
-    0xB0D1, 0x90D1, 0x988B, 0xB0D1, 0x88D1, 0x90D1, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x78F1, 0x78D1, 0x78F1,
-    0x608B, 0x90D1, 0x78F1, 0x588B, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xC88E, 0xE0B0,
-    0xE0B0, 0xE0B0, 0xE0B0, 0xE0B0, 0xE0AE, 0xE8AE, 0xE0AC, 0xE0AE,
-    0xE0AC, 0xE8AC, 0xE0AA, 0xE8AA, 0xE8C8, 0x1842, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE9C5,
-    0xE965, 0xE165, 0xE106, 0xE106, 0x5884, 0x0000, 0x0000, 0xE8C8,
-    0x90E4, 0x0000, 0x0000, 0x588B, 0xE8AC, 0xE0AE, 0x986B, 0xD0AE,
-    0x986B, 0x988B, 0x5884, 0x1842, 0x0000, 0x0000, 0x608B, 0xA06B,
-    0xD0B1, 0xC8B1, 0xA8D1, 0xB0B1, 0xA8D1, 0xB0B1, 0x588B, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1842, 0x78F1,
-    0x78D1, 0x90D1, 0x78F1, 0x90D1, 0x608B, 0x1842, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x608B, 0xA08B, 0xB0D1, 0x588B, 0xD0B1,
-    0xE0B0, 0x986B, 0x1842, 0x0000, 0x5884, 0xE8AE, 0x5884, 0x0000,
-    0x608B, 0xE8AC, 0xE0AA, 0xE0AA, 0xE8C8, 0xE0A8, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0xC165, 0xE9C5, 0xE165, 0xE145, 0xC0C6, 0x0000, 0x0000, 0x0000,
-    0xE8C8, 0xE8AA, 0x1842, 0x986B, 0xE0AA, 0xE8AC, 0xE0AC, 0xE0AE,
-    0xE0AE, 0xE0B0, 0xE8AE, 0xE0B0, 0xE0B0, 0xE0B0, 0xE0AE, 0xE8AE,
-    0xC8B1, 0xE0B0, 0xC8B1, 0xC8B1, 0xB0D1, 0xA8B1, 0xA08B, 0x608B,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x608B,
-    0x1842, 0x78F1, 0x90D1, 0xA8D1, 0x90D1, 0xA8D1, 0x90D1, 0x90D1,
-    0x988B, 0xB0B1, 0xA8D1, 0xD0B1, 0xC8B1, 0xE0B0, 0xE0B0, 0xE0B0,
-    0xE0B0, 0xE0B0, 0xC88E, 0x98E4, 0x0000, 0x986B, 0xE8AE, 0x5084,
-    0x0000, 0x0000, 0x90E4, 0xE8AC, 0xE0AA, 0xE0AA, 0xC0C6, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0xC185, 0xE1A6, 0xE965, 0xE145, 0x90E4, 0x0000, 0x0000,
-    0x0000, 0x90C4, 0xE8C8, 0xE8AA, 0xE0AA, 0xE0AA, 0xE0AA, 0xE8AC,
-    0xE0AC, 0xE0AE, 0xE0AC, 0xE8AE, 0xE0AE, 0xE0B0, 0xE0AE, 0xE0B0,
-    0xE0B0, 0xE0B0, 0xC8B1, 0xC8B1, 0xC8B1, 0xD0B1, 0x1842, 0x90D1,
-    0x1842, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x2042, 0xA08B, 0x0000, 0xA8B1, 0x90D1, 0xA8D1, 0xB0D1, 0xA8B1,
-    0xB0D1, 0xC8B1, 0xB0B1, 0xC8B1, 0xC8B1, 0xE0B0, 0xC8B1, 0xE8B0,
-    0xE0B0, 0xE0B0, 0xE0AE, 0xE0B0, 0xE0AE, 0xE8AE, 0xE0AC, 0xC8AE,
-    0x0000, 0x0000, 0x0000, 0x1842, 0xE8AA, 0xE0AA, 0xE8A8, 0x90E4,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x5084, 0xE9C5, 0xE9A6, 0xE9C5, 0x5884, 0x0000,
-    0x0000, 0x0000, 0x1842, 0xE0C8, 0xE0A8, 0xE8AA, 0xE0AA, 0xE8AA,
-    0x5884, 0x5084, 0xE0AC, 0xE8AE, 0xE0AE, 0xE0B0, 0xE0AE, 0xE0B0,
-    0xE8AE, 0xE0B0, 0xE0B0, 0xE0B0, 0xE0B0, 0xE0B0, 0x608B, 0x988B,
-    0xB0D1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x90D1, 0x608B, 0x1842, 0xC8B1, 0xB0B1, 0xC8B1,
-    0xA8D1, 0xD0B1, 0xC8B1, 0xC8B1, 0xC8B1, 0xE0B0, 0xE0B0, 0xE0B0,
-    0xE0B0, 0xB0B1, 0x988B, 0xE0B0, 0xE0AE, 0xE0B0, 0xE0AE, 0xE8AE,
-    0x90C4, 0x0000, 0x0000, 0x0000, 0x0000, 0xE0AA, 0xE8C8, 0xE8A8,
-    0x5084, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x1842, 0xF1C5, 0xE9C5, 0xE165, 0x5084,
-    0x0000, 0x0000, 0x0000, 0xA06B, 0xE8C8, 0xE0A8, 0xC88A, 0x5084,
-    0x0000, 0x0000, 0x608B, 0xE8AC, 0xE0AC, 0xE0AE, 0xC8AE, 0xE8AE,
-    0x988B, 0xE8AE, 0xE0AE, 0xE0B0, 0xC88E, 0xE0B0, 0xC8B1, 0x0000,
-    0x988B, 0xA06B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x988B, 0x986B, 0x0000, 0xB0D1, 0xC8B1,
-    0xB0B1, 0xC8B1, 0xC8B1, 0xD0B1, 0x988B, 0xE0B0, 0xC8B1, 0xE8B0,
-    0xE0B0, 0xE0B0, 0x986B, 0x0000, 0x0000, 0x588B, 0xD0AE, 0xE8AE,
-    0xE0AC, 0xC88E, 0x0000, 0x0000, 0x0000, 0x1842, 0xE8C8, 0xE0A8,
-    0xE8C8, 0x1842, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF285, 0xE9C5, 0xE9C5,
-    0x5084, 0x0000, 0x0000, 0x0000, 0xC0C6, 0xE108, 0xE8A8, 0xC0C6,
-    0x0000, 0x0000, 0x5884, 0xE0AC, 0xE0AC, 0xE8AC, 0x5884, 0x5084,
-    0xE8AE, 0xE0AE, 0xE8AE, 0xC8AE, 0x0000, 0x90C4, 0xE8B0, 0x988B,
-    0x608B, 0xE8B0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x1842, 0xD0AE, 0x1842, 0x588B,
-    0xD0B1, 0x90D1, 0x1842, 0xC8B1, 0xC8B1, 0xE0B0, 0xE8B0, 0x986B,
-    0x5884, 0xE0B0, 0xE0B0, 0xE0B0, 0x608B, 0x0000, 0x0000, 0x90E4,
-    0xE0AC, 0xE0AC, 0xE8AA, 0x0000, 0x0000, 0x0000, 0x1842, 0xE0E7,
-    0xE8A8, 0xE108, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xC165, 0xF285,
-    0xE9C5, 0x90C4, 0x0000, 0x0000, 0x0000, 0xC0C6, 0xE0E7, 0xE0E7,
-    0xC0C6, 0x5084, 0x5884, 0xE8AA, 0xE8AA, 0xE0AC, 0x5084, 0x0000,
-    0xA08B, 0xE0AE, 0xE8AC, 0x5084, 0x0000, 0x608B, 0xE8AE, 0xE0B0,
-    0xC88E, 0xE0B0, 0x988B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x986B, 0xD0B1,
-    0xA8D1, 0xE0B0, 0xC8B1, 0x5884, 0x0000, 0x5884, 0xD0B1, 0xE0B0,
-    0x986B, 0x0000, 0x608B, 0xE8AE, 0xE0AE, 0xE0AE, 0x1842, 0x5884,
-    0xC88A, 0xE8AA, 0xE0AA, 0xC8AA, 0x0000, 0x0000, 0x0000, 0x5884,
-    0x988B, 0xE8E7, 0x90C4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x62A3,
-    0xF285, 0x62A3, 0x5884, 0x5884, 0x0000, 0x0000, 0x0000, 0xE126,
-    0xE0E7, 0xC88A, 0xC0C6, 0xE0A8, 0xE8C8, 0xE8AA, 0x5884, 0x0000,
-    0x1842, 0xE0AC, 0xE8AC, 0x0000, 0x0000, 0x986B, 0xE0AE, 0xE0B0,
-    0xD0AE, 0x588B, 0xD08E, 0x608B, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x588B,
-    0xD0B1, 0x988B, 0xC88E, 0xE0B0, 0xE0B0, 0x588B, 0x0000, 0x0000,
-    0xE8AE, 0xE8B0, 0x1842, 0x0000, 0x5084, 0xE8AE, 0xE0AE, 0xE8AE,
-    0x988B, 0x986B, 0xE0AC, 0xE8AC, 0x5884, 0x0000, 0x0000, 0x0000,
-    0x5884, 0xC0C6, 0xE8E7, 0x90E4, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x1842, 0xF285, 0xC965, 0x1842, 0x98C4, 0x0000, 0x0000, 0x0000,
-    0x5884, 0xE906, 0xE0E7, 0xE0E7, 0xE8C8, 0xE0E7, 0x5084, 0x98E4,
-    0xC88A, 0xE8AC, 0xE0AA, 0xE0AC, 0x5084, 0xC88A, 0xE8AC, 0xE8AE,
-    0x1842, 0x0000, 0xC8AE, 0xE8AE, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0xE0B0, 0xC8AE, 0x0000, 0x1842, 0xE8B0, 0xE0AE, 0xC88E,
-    0x0000, 0xE8AE, 0xE0AE, 0xE0AE, 0x988B, 0x0000, 0x1842, 0xD08E,
-    0xE8AC, 0xE0AC, 0xE0AA, 0xE8AA, 0xC88A, 0x0000, 0x0000, 0x0000,
-    0x5084, 0x5884, 0xC0C6, 0xE926, 0x1842, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0xF285, 0xF265, 0x1842, 0x3242, 0xC985, 0x90C4,
-    0x0000, 0xC185, 0xE126, 0xE106, 0xE0E7, 0xE108, 0xC88A, 0xE8AA,
-    0xE0C8, 0xE8AA, 0xC0C6, 0x0000, 0x986B, 0xE0AC, 0xE8AC, 0x988B,
-    0x0000, 0x0000, 0xE8AE, 0xE8AE, 0x1842, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x1842, 0xE0B0, 0xC88E, 0x0000, 0x0000, 0x988B,
-    0xE8AE, 0xE0B0, 0xE8AE, 0x1842, 0x988B, 0xE0AE, 0xE8AC, 0xE0AC,
-    0xC88A, 0xE0AC, 0xE0AA, 0xE8AC, 0xE8AA, 0xC88A, 0x0000, 0x1842,
-    0x5884, 0x98E4, 0x1842, 0xE126, 0xE906, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0xCA64, 0xF265, 0x9AA3, 0x0000, 0x5884,
-    0x90E4, 0xE9A6, 0xE165, 0x1842, 0x0000, 0x5884, 0x0000, 0xC8C6,
-    0xE0A8, 0xE8C8, 0x90C4, 0x0000, 0x0000, 0x988B, 0xC88A, 0x1842,
-    0x0000, 0x2042, 0xE8AC, 0xE0AE, 0x588B, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x5884, 0xD0AE, 0xC88E, 0x0000,
-    0x0000, 0x1842, 0xD0AE, 0xC88A, 0x0000, 0x0000, 0x608B, 0xE8AC,
-    0xE0AC, 0xE0AA, 0x1842, 0x1842, 0x0000, 0x2042, 0xE8C8, 0xE8A8,
-    0x90E4, 0x5084, 0x0000, 0x5884, 0xE906, 0xC0C6, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x5084, 0xFB65, 0xCA64, 0x0000,
-    0x0000, 0x5884, 0xE9C5, 0x5084, 0x0000, 0x0000, 0x0000, 0x0000,
-    0xE8E7, 0xE0E7, 0xC0C6, 0x0000, 0x0000, 0xE0C8, 0xC88A, 0x0000,
-    0x0000, 0x0000, 0xC8AE, 0xE8AA, 0xC88E, 0xA08B, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xC8AE, 0xC88A, 0x986B,
-    0xD0AE, 0x1842, 0x0000, 0x0000, 0xC88A, 0xC8AE, 0x0000, 0x0000,
-    0xC88A, 0xE0AC, 0xE8AA, 0x0000, 0x0000, 0x0000, 0x0000, 0x5884,
-    0xE8C8, 0x90C4, 0x0000, 0x0000, 0x5084, 0xE965, 0x5884, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFB65, 0xF365,
-    0x0000, 0x9AA3, 0xE9C5, 0x5084, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x98E4, 0xE906, 0xE0E7, 0x5084, 0x0000, 0xE8C8, 0x986B, 0x0000,
-    0x0000, 0x0000, 0xA08B, 0xC88E, 0xE8AA, 0xE0AC, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE0AE,
-    0xC88A, 0x988B, 0x988B, 0x1842, 0x0000, 0x0000, 0xD08A, 0xC88A,
-    0x0000, 0x5884, 0xE8AA, 0xE0AA, 0x90E4, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x5884, 0xE8E7, 0x90E4, 0x0000, 0xC165, 0xE965, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCB84,
-    0xF365, 0xFB65, 0xF285, 0xCA64, 0x1842, 0x0000, 0x0000, 0x0000,
-    0x0000, 0xE165, 0xE926, 0xE906, 0x1842, 0xD127, 0xC0C6, 0x0000,
-    0x0000, 0x0000, 0x986B, 0xE0AA, 0xE8AA, 0xE108, 0x90E4, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x90C4, 0xE8AE, 0xC8AE, 0xC8AE, 0xC88A, 0x0000, 0x0000, 0x0000,
-    0xC8AA, 0xC88A, 0x0000, 0xE0AA, 0xE8C8, 0xE8AA, 0x5084, 0x0000,
-    0x0000, 0x0000, 0x0000, 0xC0C6, 0xE106, 0xC165, 0xE965, 0xC165,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x5064, 0xFB65, 0xF285, 0x5084, 0xCA64, 0xF285, 0xC165, 0x90C4,
-    0x98E4, 0xE9C5, 0xC165, 0x0000, 0xD127, 0xE906, 0x90E4, 0x0000,
-    0x0000, 0x0000, 0x5884, 0xE8C8, 0xE0A8, 0xE0AA, 0xC88A, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0xC8AA, 0xE8AC, 0xE0AA, 0xE0AC, 0x5084, 0x0000,
-    0x0000, 0x0000, 0x98E4, 0xE8A8, 0xE0C8, 0x5084, 0x98C4, 0xE8C8,
-    0x90C4, 0x5884, 0x5884, 0xE906, 0xC0C6, 0x1842, 0xC0C6, 0xE965,
-    0x5084, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0xF365, 0xFB65, 0x98E4, 0xCB84, 0x90C4, 0x9AC3,
-    0x5884, 0xCA64, 0xE9C5, 0x0000, 0x1842, 0xE165, 0xE906, 0xE106,
-    0xC0C6, 0xC0C6, 0xC0C6, 0xE0E7, 0xE0C8, 0xE8A8, 0xE8C8, 0x5084,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x90C4, 0xE8AA, 0xE0AC, 0xE0AA, 0xE8AA,
-    0x988B, 0xC0C6, 0xA06B, 0x988B, 0xE0A8, 0xE0C8, 0xC0C6, 0x0000,
-    0xE0E7, 0xE926, 0x5884, 0xC0C6, 0xC0C6, 0xE106, 0x90E4, 0xE9C5,
-    0xE9A6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0xCB84, 0xCB84, 0x0000, 0x90C4, 0x1842,
-    0x5884, 0xF285, 0xE9C5, 0x5884, 0x0000, 0xE9A6, 0xE165, 0xE145,
-    0xE906, 0xE126, 0xE108, 0xE108, 0xE0E7, 0xE0E7, 0xE8C8, 0xC0C6,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xC88A, 0xE0AA, 0xE0AA,
-    0xE0C8, 0xE8AA, 0xE0A8, 0xE0C8, 0xE0A8, 0xE8C8, 0xE0A8, 0xE0E7,
-    0x0000, 0x1842, 0xE108, 0xD927, 0x5084, 0x5884, 0x5884, 0x1842,
-    0xF1C5, 0xC185, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x5084, 0xFC85, 0xCA64, 0xCB84,
-    0x9AA3, 0xF365, 0xF285, 0xCA64, 0x0000, 0xCA64, 0xE9C5, 0x90C4,
-    0x5884, 0x98E4, 0x5084, 0xE165, 0xE906, 0xE106, 0xE8E7, 0xE908,
-    0x1842, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1842, 0xE0AA,
-    0xE0C8, 0xE0AA, 0xE8A8, 0xE8C8, 0x90C4, 0x98E4, 0x90C4, 0x90E4,
-    0xE0E7, 0xC0C6, 0x0000, 0xC165, 0xE965, 0xE9A6, 0x5084, 0xC965,
-    0xE9C5, 0xF285, 0x1842, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCB84, 0xFC85,
-    0xFB65, 0xF365, 0xF265, 0x1842, 0x5884, 0x9AA3, 0xE9C5, 0xC185,
-    0x90C4, 0x98E4, 0xE945, 0xE165, 0xE145, 0xE965, 0xE106, 0xE106,
-    0x5084, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x5884, 0xE8C8, 0xE8C8, 0xE0A8, 0xE0C8, 0xE0E7, 0xE8E7, 0x90C4,
-    0x5084, 0xE906, 0xE926, 0x90E4, 0x90C4, 0x5884, 0xC0C6, 0xE9C5,
-    0xE9C5, 0xF285, 0xC165, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3222,
-    0xFC85, 0xFC65, 0x62A3, 0x6AA3, 0x1842, 0xCB84, 0xF285, 0x5884,
-    0x5084, 0xEA85, 0xE9C5, 0xE9C5, 0xE1A6, 0xE9C5, 0xE965, 0xE165,
-    0xC0C6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0xC0C6, 0xE0E7, 0xE0E7, 0xE906, 0xE0E7, 0xE126,
-    0xE106, 0xE945, 0x98E4, 0x1842, 0xE945, 0xE9C5, 0x5884, 0x5084,
-    0x90C4, 0xF285, 0xF285, 0x1842, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0xCC84, 0xFC65, 0x0000, 0x90C4, 0x9AC3, 0xFB65, 0xF285,
-    0x90C4, 0xF285, 0xEA65, 0xF285, 0xE9C5, 0xE1C5, 0xE1A6, 0xE9C5,
-    0xC165, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0xC0C6, 0xE106, 0xE108, 0xE926,
-    0xE106, 0xE165, 0xE106, 0xE965, 0x5084, 0xC185, 0xE9A6, 0x90E4,
-    0x5884, 0x5884, 0xF285, 0x9AA3, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0xFD85, 0xCB84, 0xCB84, 0xFC85, 0xCB84,
-    0x9AA3, 0xF365, 0xFB65, 0xF365, 0xEA65, 0xF285, 0xEA65, 0xF285,
-    0xE9C5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xC0C6, 0xE165,
-    0xE145, 0xE165, 0xE165, 0xE9C5, 0xE1A6, 0xE9C5, 0xC165, 0xCA64,
-    0xE9C5, 0xF265, 0xEA85, 0xFB65, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x62A3, 0xFD65, 0xF485, 0xFC65,
-    0xF365, 0xFC85, 0xF365, 0xF365, 0xF265, 0xF365, 0xEA85, 0xF265,
-    0xE9C5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x5084, 0xE945, 0xE165, 0xE9C5, 0xE9C5, 0xE9C5, 0xE1A6, 0xEA85,
-    0xE1A6, 0xF285, 0xEA85, 0xF365, 0x5864, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9AA3, 0xF585,
-    0xFC65, 0xFD85, 0xF465, 0xFC85, 0xF365, 0xFC85, 0xF365, 0xFB65,
-    0x9AA3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x5084, 0xE9C5, 0xE9C5, 0xEA65, 0xE9C5, 0xEA85,
-    0xF265, 0xF365, 0xF285, 0xFB65, 0x90E4, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x62A3, 0xFD85, 0xFC65, 0xFC85, 0xF465, 0xFC85, 0xF365, 0xF365,
-    0x5064, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x1842, 0xD264, 0xE9C5, 0xF285,
-    0xF285, 0xF365, 0xF265, 0xF365, 0x5084, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x1842, 0xCC84, 0xCC64, 0xD484, 0xCB84, 0x3222,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3242,
-    0xC165, 0xCB84, 0xF285, 0xD264, 0x1842, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000 } };
+// Generated by frames2spans.py. Each frame is stored as the runs of pixels
+// that changed since the frame before: (y << 8) | x, length, then that
+// many big-endian RGB565 pixels. Runs frameSpans[N] up to frameSpans[N + 1]
+// turn frame N-1 into frame N (frame 0 follows the last frame), and the
+// list at frameSpans[IMG_FRAMES] draws frame 0 onto a black screen.
+const uint32_t frameSpans[IMG_FRAMES + 2] = {
+  0, 0, 6002, 12028, 17957, 23886, 29912, 35914, 41982 };
 
+const uint16_t spans[] = {
+  0x0005, 0x0006, 0xC834, 0xA66C, 0x286E, 0xE59C, 0xE59C, 0x2232,
+  0x005E, 0x0006, 0xA36A, 0x85D5, 0x86D6, 0x26CF, 0xA7A6, 0xA664,
+  0x0104, 0x0008, 0xA66C, 0xA84D, 0x286E, 0x0866, 0x6786, 0x6786,
+  0xC7AE, 0xE59C, 0x015C, 0x0009, 0xA36A, 0x65CD, 0x25F7, 0x25F7,
+  0x25F7, 0x26D7, 0x26CF, 0x26D7, 0xE59C, 0x0203, 0x000D, 0xA84D,
+  0xA855, 0x086E, 0x286E, 0x6786, 0x6786, 0xA7A6, 0xC7A6, 0x26D7,
+  0x26CF, 0x26CF, 0x65CD, 0x2232, 0x0259, 0x000D, 0x423A, 0x64CC,
+  0x85FE, 0x65FE, 0x25F7, 0x25FF, 0x25F7, 0x25F7, 0x25F7, 0x26D7,
+  0x26CF, 0x26CF, 0x26CF, 0x0302, 0x0010, 0xA855, 0xA84D, 0x086E,
+  0x2866, 0x6786, 0x6786, 0xA7A6, 0xC7A6, 0x26D7, 0x26CF, 0x25F7,
+  0x26CF, 0x25FF, 0x25F7, 0x45F7, 0xA39A, 0x0357, 0x0010, 0xA39A,
+  0x85FD, 0x65FD, 0x65F6, 0x65FE, 0x65FE, 0x65FE, 0x25F7, 0x25FF,
+  0x25F7, 0x25F7, 0x25F7, 0x26D7, 0x25F7, 0x26CF, 0x66D6, 0x0402,
+  0x0012, 0x692D, 0xA855, 0x286E, 0x6786, 0x6786, 0xA7A6, 0xC7AE,
+  0x26CF, 0xA7A6, 0x26D7, 0x26CF, 0x25F7, 0x25FF, 0x25F7, 0x25F7,
+  0x25F7, 0x65FE, 0x64CC, 0x0455, 0x0013, 0x84CB, 0x65FB, 0x85F4,
+  0x65FC, 0x85FD, 0x65F5, 0x85FE, 0x65FD, 0x65FE, 0x65F6, 0x25F7,
+  0x25F7, 0x25FF, 0x25F7, 0x25F7, 0x26CF, 0x26D7, 0xC7A6, 0x2232,
+  0x0501, 0x0015, 0xA66C, 0x2866, 0x086E, 0x6786, 0x6786, 0xC7A6,
+  0xA7A6, 0x26CF, 0x26D7, 0x26CF, 0x26CF, 0x25F7, 0x25FF, 0x25F7,
+  0x25F7, 0x25F7, 0x65FE, 0x65F6, 0x65FE, 0x85FE, 0x64CC, 0x0553,
+  0x0015, 0x64CA, 0x65F3, 0x65F3, 0x85FC, 0x65F4, 0x85FD, 0x65FC,
+  0x85F5, 0x65FD, 0x65FE, 0x65FE, 0x65FE, 0x65FE, 0x25F7, 0x25F7,
+  0x25F7, 0x25FF, 0x25F7, 0x26CF, 0x26D7, 0xE59C, 0x0600, 0x0018,
+  0x2218, 0x286E, 0xA84D, 0x678E, 0x6786, 0x0000, 0xC7A6, 0x26D7,
+  0xA7A6, 0x26CF, 0x26D7, 0x25F7, 0x25F7, 0x25F7, 0x25FF, 0x25F7,
+  0x65FE, 0x65FE, 0x65FD, 0x85F6, 0x65FD, 0x65FD, 0x85F4, 0x84CB,
+  0x0651, 0x0018, 0x65C1, 0x85F2, 0x65F2, 0x85EA, 0x65F3, 0x65F3,
+  0x65FC, 0x65F3, 0x85FC, 0x65F4, 0x85FD, 0x65FD, 0x85FE, 0x65F5,
+  0x65FE, 0x65FE, 0x25F7, 0x25F7, 0x64CC, 0x0000, 0x25F7, 0x46CF,
+  0x26D7, 0x2218, 0x0700, 0x001A, 0xC834, 0x286E, 0x6786, 0x6786,
+  0xA7A6, 0xE59C, 0xC7A6, 0x66D6, 0x26CF, 0x26CF, 0x85FE, 0x2232,
+  0x25F7, 0x64CC, 0x65FE, 0x65FE, 0x65FE, 0x65F6, 0x85FE, 0x65FD,
+  0x85FD, 0x65F4, 0x85FD, 0x65F4, 0x85FC, 0xA39A, 0x074F, 0x001A,
+  0xC6C0, 0xC5E9, 0xC5E9, 0x85EA, 0x65F2, 0x85EA, 0x65F2, 0x65F3,
+  0x65F3, 0x85FC, 0x65F4, 0x85FD, 0x65F4, 0x85FD, 0x65FD, 0xE59C,
+  0x65FE, 0x65FE, 0x65FE, 0x25F7, 0x64CC, 0xE59C, 0x25FF, 0x25F7,
+  0x46D7, 0xA664, 0x0800, 0x001C, 0xA66C, 0x0866, 0x286E, 0x6786,
+  0x6786, 0xA7A6, 0xC7AE, 0x0000, 0x66D6, 0x25F7, 0x65CD, 0x0000,
+  0x85FD, 0x65CD, 0x0000, 0xE59C, 0x85FD, 0x65FE, 0x65FD, 0x85FD,
+  0x65F4, 0x85FC, 0x65F3, 0x65F3, 0x65F3, 0x65FB, 0x65EA, 0xC490,
+  0x084D, 0x001C, 0xE490, 0x06E9, 0x65E9, 0x45E1, 0xC5E9, 0xA6E1,
+  0xC5E9, 0xC5E9, 0x85EA, 0x85F2, 0x65F3, 0x65F3, 0x85FC, 0x6450,
+  0x0000, 0x84CB, 0x84CB, 0x0000, 0x85FD, 0x85FD, 0x64CC, 0xA39A,
+  0x45F7, 0x25F7, 0x25FF, 0x26CF, 0x25F7, 0xE59C, 0x0900, 0x001E,
+  0x2866, 0x086E, 0x6786, 0x6786, 0xC7A6, 0x0000, 0xA362, 0x26D7,
+  0x25F7, 0x25F7, 0x25F7, 0x0000, 0x4232, 0x65FD, 0x0000, 0x0000,
+  0x65FE, 0x85FD, 0x65F5, 0x84CB, 0x85FC, 0x65F4, 0x85FC, 0x65F3,
+  0x65F3, 0x65F2, 0x85F2, 0xC5E9, 0x85F2, 0x8458, 0x094B, 0x001E,
+  0x8450, 0x26E1, 0x08E1, 0x06E1, 0x06E9, 0x65E1, 0x45E1, 0xC5E1,
+  0xC5E9, 0x85F2, 0xC5E9, 0xA39A, 0x65F2, 0x65F3, 0x85F2, 0x0000,
+  0xC490, 0x85FC, 0x0000, 0x4218, 0x65FD, 0x65FE, 0x65FE, 0x65FE,
+  0x4218, 0x65CD, 0x25FF, 0x25F7, 0x25F7, 0x86D6, 0x0A01, 0x001F,
+  0x6786, 0x6786, 0xA7AE, 0xC7A6, 0xA7A6, 0x0000, 0xA36A, 0x26D7,
+  0x25F7, 0x25F7, 0x25F7, 0x86D6, 0x65FE, 0x64CC, 0x0000, 0x64CC,
+  0xA39A, 0x85FC, 0x85F4, 0xA39A, 0x64CA, 0x65FB, 0x65F3, 0x85F2,
+  0x65EA, 0xC5E9, 0xC5E9, 0x45E1, 0xA6E1, 0x26E1, 0x4218, 0x0A4A,
+  0x001F, 0xC8E8, 0xE7E8, 0xA8E0, 0xE7E8, 0xE7E0, 0x06E1, 0x26E1,
+  0x65E9, 0x45E1, 0xC5E9, 0xC6C0, 0x85C1, 0xC5E9, 0x64CA, 0x65C1,
+  0x64CA, 0x0000, 0x65F3, 0x84CB, 0x84CB, 0x85FC, 0x85FD, 0x65F5,
+  0x85FD, 0x0000, 0x0000, 0x65CD, 0x25F7, 0x25F7, 0x25FF, 0x86CE,
+  0x0B00, 0x0021, 0x6786, 0x6786, 0xA7A6, 0xC7A6, 0x26CF, 0x26D7,
+  0x64CC, 0xA664, 0x25F7, 0x25FF, 0x25F7, 0x25F7, 0x25F7, 0x65FE,
+  0x85FE, 0xA39A, 0x84CB, 0x0000, 0x85F4, 0x65FC, 0x85F4, 0x0000,
+  0xA39A, 0x85F2, 0x65EA, 0xC5E9, 0x85EA, 0xC5E9, 0xC5E9, 0x65E9,
+  0x65E1, 0x06E9, 0xC490, 0x0B48, 0x0021, 0x8B98, 0xA8E0, 0xAAE8,
+  0xC8E0, 0xA8E0, 0xC8E0, 0x08E1, 0xE7E8, 0x26E1, 0x06E9, 0x45E9,
+  0x4218, 0x8450, 0xA6E9, 0x85F2, 0xE490, 0xC498, 0xE490, 0xA39A,
+  0x65F3, 0x65F4, 0x85FC, 0x65F5, 0x85FC, 0x65FD, 0x85FC, 0x64CC,
+  0x84CB, 0x25F7, 0x25F7, 0x25F7, 0x25FF, 0x25F7, 0x0C01, 0x0021,
+  0xC7A6, 0xA7AE, 0xC7A6, 0x26D7, 0x26CF, 0x66CE, 0x86D6, 0x25F7,
+  0x25F7, 0x64CC, 0xA39A, 0x84CC, 0x65FE, 0x65FD, 0x85FD, 0x65FC,
+  0x0000, 0x84CB, 0x64CA, 0x85EA, 0x65F3, 0x64CA, 0x65F2, 0x4218,
+  0xC5E9, 0x45E9, 0x65E1, 0x45E1, 0x65E1, 0x08E1, 0xE7E8, 0xE7E0,
+  0x8AC8, 0x0C47, 0x0022, 0xAEC8, 0xAAE0, 0xAAE8, 0xA8E0, 0xAAE0,
+  0xC8E0, 0xA8E8, 0xC8E0, 0xE7E0, 0xC6C0, 0xC6C0, 0xE7E0, 0xC6C0,
+  0x45E9, 0x65E1, 0x65C1, 0x85C1, 0x4218, 0x85F2, 0x65F2, 0x65F3,
+  0x85F2, 0xA39A, 0xC490, 0x85FC, 0x85FC, 0x65FD, 0x85F4, 0x65FE,
+  0x65FE, 0x25F7, 0x65FE, 0x25F7, 0x65FD, 0x0D00, 0x0023, 0xE59C,
+  0xA7A6, 0x26CF, 0xC7A6, 0x26D7, 0x26CF, 0xA36A, 0xE59C, 0x25F7,
+  0x25F7, 0x85CD, 0x64CC, 0x84CC, 0x65FD, 0x85FD, 0xA362, 0x65FD,
+  0x85F4, 0x65FC, 0x64CA, 0x0000, 0x85EA, 0x85F2, 0xC5E9, 0xC490,
+  0x65E9, 0x4218, 0x65C1, 0x65E9, 0x26E1, 0x06E1, 0xE7E0, 0xE7E8,
+  0xA8E0, 0xC8E0, 0x0D46, 0x0023, 0xACE0, 0xACE8, 0xACE0, 0xAAE0,
+  0xACE0, 0xAAE8, 0xAAE0, 0xC8E0, 0x8AC8, 0xC6C0, 0xE7E8, 0x8450,
+  0x08E1, 0x06E9, 0x65E1, 0x0000, 0x45E1, 0x45E1, 0xC5E9, 0xC5E9,
+  0x64CA, 0x85F2, 0x84CB, 0x85C1, 0xA39A, 0x65F3, 0x65FD, 0x85FD,
+  0xA362, 0x64CC, 0x65FE, 0x65FE, 0x25F7, 0x65F6, 0x84CC, 0x0E01,
+  0x0023, 0xC7AE, 0xA7A6, 0x26D7, 0x26CF, 0x25FF, 0x65CD, 0x0000,
+  0x25F7, 0x25F7, 0x0000, 0x0000, 0x0000, 0xA362, 0x84CB, 0x0000,
+  0x84CB, 0x65FB, 0x65FB, 0x65F3, 0x0000, 0x0000, 0xC5E9, 0xC5E9,
+  0x45E1, 0x65E1, 0x06E1, 0x06E1, 0xE7E8, 0xE7E0, 0xE7E0, 0xE7E0,
+  0xC8E8, 0xC8E0, 0xA8E0, 0xAAE0, 0x0E45, 0x0024, 0xAEE8, 0xACE0,
+  0xAEE0, 0xACE0, 0xACE8, 0xAAE0, 0xACE0, 0xAAE0, 0xAAE8, 0xC8E0,
+  0xAAE0, 0xA8E0, 0xC8E8, 0xE7E0, 0x08E1, 0x0000, 0x0000, 0x06E1,
+  0x65E1, 0x45E9, 0x85C1, 0x0000, 0x64CA, 0x0000, 0x0000, 0x0000,
+  0xA362, 0x85FC, 0x65FC, 0x0000, 0x85F5, 0x65FD, 0x85FE, 0x65FE,
+  0x65F6, 0x2218, 0x0F01, 0x0024, 0xA664, 0x26CF, 0x26CF, 0x25F7,
+  0x25FF, 0x25F7, 0x0000, 0x25F7, 0x85F6, 0x65FD, 0x84CC, 0x65FD,
+  0x85FC, 0x65FD, 0x84CB, 0x85FC, 0x8450, 0x65F3, 0x85EA, 0x64CA,
+  0x0000, 0xA6E1, 0xC5E9, 0xC5E9, 0x65E9, 0x06E1, 0x27D1, 0x27D1,
+  0xC8E8, 0x08E1, 0xA8E0, 0xAAE0, 0xAAE0, 0x08E1, 0xAAE8, 0xACE0,
+  0x0F44, 0x0024, 0xB0E0, 0xAEE0, 0xAEE0, 0xAEE8, 0xAEE0, 0xACE0,
+  0xAEE0, 0xACE8, 0xACE0, 0xAAE0, 0x08E1, 0xAAE0, 0xAAE8, 0xC8E0,
+  0x08E1, 0x0000, 0x0000, 0x08E1, 0x45E9, 0xC6C0, 0x85C1, 0x65C1,
+  0xC39A, 0xC5E9, 0x64CA, 0x64CA, 0xA39A, 0xA39A, 0x85FC, 0x65F3,
+  0x0000, 0x65FD, 0x65FE, 0x65FE, 0x85FE, 0xA39A, 0x1002, 0x0024,
+  0x66D6, 0x26D7, 0x26CF, 0x25F7, 0x25F7, 0x25FF, 0x65FE, 0x65FE,
+  0x65F5, 0x85FD, 0xA39A, 0xA39A, 0x85FC, 0x85FC, 0x64CA, 0xA39A,
+  0xC490, 0x85F2, 0xC5E9, 0x65C1, 0x4218, 0x65E9, 0x45E1, 0x06E1,
+  0xE490, 0x0000, 0x0000, 0x0000, 0x0000, 0xAAE8, 0xC8E0, 0xAAE0,
+  0xAAE8, 0xACE0, 0xACE0, 0xACE0, 0x102C, 0x0002, 0x6B98, 0x8B60,
+  0x103B, 0x0002, 0x8B60, 0x8B98, 0x1043, 0x0024, 0xB0E8, 0xAEE0,
+  0xB0E0, 0xAEE0, 0xAEE8, 0xAEE0, 0xAEE0, 0x8EC8, 0x0000, 0x0000,
+  0x0000, 0x0000, 0xC6C0, 0xC8E8, 0xAAE0, 0x8AC8, 0x0000, 0xC8E0,
+  0xE7E0, 0xE7E8, 0xC490, 0xC6C0, 0x65E1, 0x45E9, 0xC5E9, 0xE490,
+  0x64CA, 0x85F2, 0x65F3, 0x65F3, 0x65FC, 0x85F4, 0x65FD, 0x85FD,
+  0x65F6, 0x65FD, 0x1102, 0x000D, 0xA664, 0x26CF, 0x25F7, 0x25F7,
+  0x25F7, 0x65FE, 0x85FE, 0xA39A, 0x64CC, 0x85FD, 0x65F5, 0x85FC,
+  0x84CB, 0x1114, 0x0013, 0x85C1, 0xC5E9, 0xA6E1, 0x65E9, 0xC6C0,
+  0x0000, 0x08E1, 0xA8E8, 0x0000, 0x0000, 0x0000, 0x4218, 0xACE0,
+  0xACE0, 0xACE0, 0xACE8, 0xAEE0, 0xACE0, 0xACE8, 0x112C, 0x0002,
+  0xB0E0, 0xB0E0, 0x113B, 0x0002, 0xB1C8, 0xB0E0, 0x1142, 0x0013,
+  0xB0E0, 0xB0E0, 0xB0E0, 0xB0E0, 0xB0E0, 0xAEE0, 0xB0E0, 0xAEE0,
+  0x0000, 0x0000, 0x0000, 0x0000, 0xACE0, 0xAAE8, 0x0000, 0xAAE0,
+  0xAAE0, 0xC8E0, 0xE7E8, 0x115A, 0x000D, 0xC490, 0x65C1, 0x64CA,
+  0x85F2, 0x65EA, 0x85F2, 0x64CA, 0x65F3, 0x65F4, 0x85FC, 0x65FD,
+  0x85FD, 0xA362, 0x1203, 0x000D, 0x25FF, 0x25F7, 0x25FF, 0x25F7,
+  0x65CD, 0x0000, 0x0000, 0x0000, 0x0000, 0xC490, 0x85FC, 0x65FB,
+  0x8450, 0x1215, 0x0019, 0x45E9, 0x65E1, 0x45E1, 0xE7E8, 0x0000,
+  0x0000, 0xC8E0, 0xA8E0, 0x0000, 0x0000, 0x0000, 0x8450, 0xACE8,
+  0xAEC8, 0x8AC8, 0xACE8, 0xAEE0, 0xAEE0, 0xAEC8, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x6B98, 0xB0E8, 0x123A, 0x001B, 0x4218, 0xB1D0,
+  0x8B58, 0x0000, 0x0000, 0x0000, 0x0000, 0xD1B0, 0xB0E0, 0xB0E0,
+  0xB0E0, 0xB0E0, 0xAEE8, 0xB0E0, 0x8EC8, 0x0000, 0x0000, 0x0000,
+  0x0000, 0xACE0, 0xACE0, 0x8458, 0x0000, 0xAAE8, 0xC8E0, 0xAAE0,
+  0xC6C0, 0x125B, 0x000B, 0xC5E9, 0xC5E9, 0x65C1, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x65F3, 0x85FC, 0x85F4, 0x65FC, 0x1303, 0x0005,
+  0xA39A, 0x25F7, 0x25F7, 0x25F7, 0x65CD, 0x130E, 0x0003, 0x85FC,
+  0x65FB, 0xA362, 0x1316, 0x0019, 0x65E1, 0x26E1, 0x06E9, 0xC490,
+  0x0000, 0x0000, 0xAAE0, 0xAAE8, 0x8B98, 0x0000, 0x0000, 0x0000,
+  0xAEE0, 0xAEE8, 0xC490, 0xAEE0, 0xB0E0, 0xB0E8, 0x8B98, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x8EC8, 0xD1B0, 0x133A, 0x001A, 0xB1A8,
+  0xD1B0, 0x0000, 0x0000, 0x0000, 0x0000, 0x6B98, 0xB1C8, 0xB0E0,
+  0xB0E0, 0xB0E8, 0xAEC8, 0xB0E0, 0xB0E0, 0x0000, 0x0000, 0x0000,
+  0x8B98, 0xAEE0, 0xAEE0, 0x0000, 0x0000, 0x8AC8, 0xAAE8, 0x08E1,
+  0xAAE8, 0x1359, 0x0003, 0x8450, 0x45E1, 0x65C1, 0x1362, 0x0004,
+  0x65F3, 0x85FC, 0x65FD, 0x4232, 0x1404, 0x000D, 0x45FF, 0x25F7,
+  0x65FE, 0x65FE, 0x0000, 0x0000, 0x0000, 0x0000, 0x6450, 0x64CA,
+  0x64CA, 0x65FB, 0x85F2, 0x1416, 0x0019, 0x27D9, 0x06E1, 0xE7E8,
+  0xE7E0, 0x8450, 0x0000, 0x0000, 0x8BA0, 0xAAE0, 0xAAE8, 0x0000,
+  0x0000, 0x0000, 0x8EC8, 0xAEE0, 0x8B98, 0x8EC8, 0xB0E8, 0xB0E0,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x8B98, 0xB1A8, 0x143A, 0x0023,
+  0x8BA0, 0x8B58, 0x0000, 0x0000, 0x0000, 0x0000, 0xB1B0, 0xB1C8,
+  0xB1C8, 0xAED0, 0x8EC8, 0xB0E0, 0xB1C8, 0x0000, 0x0000, 0x0000,
+  0xAEC8, 0xB0E8, 0xC490, 0x0000, 0x0000, 0x8B98, 0xACE8, 0xACE0,
+  0xAAE8, 0x8AC8, 0x0000, 0x8450, 0x0000, 0x0000, 0xE490, 0x06E9,
+  0x06E9, 0x26E1, 0xC6C0, 0x1462, 0x0003, 0x65FB, 0x85FC, 0x85F4,
+  0x1504, 0x002C, 0x25F7, 0x25F7, 0x25FF, 0x85FE, 0x0000, 0x0000,
+  0x0000, 0xC39A, 0x84CB, 0xC498, 0x8450, 0x0000, 0x85EA, 0xC5E9,
+  0xC5E9, 0x45E1, 0x65E1, 0x26E9, 0x06E1, 0xE7E0, 0x08E1, 0xC8E0,
+  0xAAE8, 0x8AC8, 0x0000, 0xAAE0, 0xACE0, 0xACE0, 0xAEE8, 0x8ED0,
+  0x0000, 0x0000, 0x8B98, 0xB0E0, 0xB0E0, 0xB1C8, 0xB0E0, 0xB1C8,
+  0x0000, 0x0000, 0x0000, 0x0000, 0xD1B0, 0x8B60, 0x1539, 0x002C,
+  0x8B58, 0xD190, 0x0000, 0x0000, 0x0000, 0x0000, 0xB1B0, 0xB1C8,
+  0xD1A8, 0xB1B0, 0xB1C8, 0xB1D0, 0x8B98, 0x0000, 0x0000, 0x8EC8,
+  0xB0E0, 0xB0E0, 0xB0E0, 0x8B58, 0x0000, 0xAEE8, 0xAEE0, 0xAEE0,
+  0xACE0, 0xACE8, 0xAAE0, 0xACE0, 0xAAE0, 0xAAE8, 0xC8E0, 0x08E1,
+  0x8AC8, 0x0000, 0xC6C0, 0x65E1, 0x45E9, 0x8458, 0x0000, 0x0000,
+  0x4218, 0x65F3, 0x65F3, 0x65FC, 0x1604, 0x002C, 0x65CD, 0x25FF,
+  0x65FE, 0x65FE, 0xC490, 0x0000, 0x84CB, 0x65F3, 0x0000, 0x0000,
+  0x0000, 0x0000, 0xA6E1, 0xC5E9, 0x65E1, 0x45E9, 0x06E1, 0x26E1,
+  0xE7E0, 0xC6C0, 0x0000, 0xE490, 0xA8E8, 0xAAE0, 0xAAE8, 0xACE0,
+  0x8B98, 0x4218, 0xACE8, 0xAEE8, 0xAEE0, 0x8EC8, 0x0000, 0x0000,
+  0xB0E0, 0xB0E0, 0xB1C8, 0xB1C8, 0x8B98, 0x0000, 0x0000, 0x0000,
+  0x6BA0, 0xD1A8, 0x1639, 0x002C, 0xD190, 0x8B60, 0x0000, 0x0000,
+  0x0000, 0x8B98, 0xB1B0, 0xD1A8, 0xB1B0, 0xD1A8, 0xB1D0, 0x0000,
+  0x0000, 0x6B98, 0xB0E0, 0xB1C8, 0xB0E8, 0x8B98, 0xB0E0, 0xAEE8,
+  0xB0E0, 0xAEE0, 0xAEE0, 0x8EC8, 0x8AC8, 0xAAC8, 0xACE8, 0xAAE0,
+  0xAAE0, 0xC8E0, 0xA8E8, 0xC8E0, 0xC490, 0x0000, 0x0000, 0x0000,
+  0x8458, 0x85C1, 0x8458, 0x0000, 0x65C1, 0x85F2, 0x65FB, 0x64CA,
+  0x1704, 0x002D, 0x64CC, 0x65FE, 0x65FE, 0x85FE, 0xE59C, 0x8450,
+  0x85FC, 0x0000, 0x0000, 0x0000, 0x0000, 0x65C1, 0x85EA, 0xC5E9,
+  0xC5E9, 0xC6C0, 0x06E1, 0xE7E0, 0x08E1, 0xC8E8, 0xA8E8, 0x0000,
+  0x0000, 0x4218, 0xACE0, 0xACE8, 0x8B98, 0x0000, 0x0000, 0x6B98,
+  0xB0E0, 0xB0E0, 0xB0E8, 0xAEC8, 0xD1A8, 0xB1C8, 0xB0E8, 0xB1C8,
+  0xB1D0, 0x8B60, 0x0000, 0x0000, 0x4218, 0xD190, 0x8B60, 0x1738,
+  0x002D, 0x8B60, 0xD178, 0x0000, 0x0000, 0x0000, 0x4218, 0xD1A8,
+  0xD190, 0xD1A8, 0xD190, 0xD1B0, 0x4218, 0xB1B0, 0xD1A8, 0xB1D0,
+  0xB1C8, 0xB1A8, 0x0000, 0x0000, 0xAEC8, 0xB0E0, 0xB0E8, 0x8B58,
+  0x0000, 0x0000, 0x8EC8, 0xAEE0, 0xACE8, 0xACE0, 0xAAE0, 0xAAE0,
+  0xC8E8, 0xA8E0, 0xC8E8, 0x0000, 0x0000, 0x0000, 0x0000, 0xC490,
+  0x85C1, 0x0000, 0xC5E9, 0x65F3, 0x65F3, 0xA39A, 0x1804, 0x002D,
+  0xA362, 0x65FE, 0x65FD, 0x85FD, 0x65FC, 0x84CC, 0xA39A, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x85F2, 0xC5E9, 0xC5E1, 0x65C1, 0x06E1,
+  0x0000, 0xE490, 0xA8E8, 0xC8E0, 0xA8E8, 0xAAE0, 0x8450, 0x0000,
+  0x8B60, 0xACE8, 0xACE0, 0xAEE0, 0x0000, 0x0000, 0x0000, 0xB0E0,
+  0xB0E0, 0xB0E0, 0xB1C8, 0xB1C8, 0xB1D0, 0xB1C8, 0x8B98, 0xB1B0,
+  0x0000, 0x0000, 0x0000, 0xF178, 0x8B58, 0x1838, 0x002D, 0x8B60,
+  0x1161, 0x0000, 0x0000, 0x0000, 0xD178, 0xF178, 0xD178, 0xD190,
+  0xF190, 0xD190, 0xD1A8, 0xD1B0, 0xB1A8, 0xD1B0, 0x4218, 0x0000,
+  0x0000, 0xB1D0, 0xB0E0, 0xB0E0, 0x6B98, 0x0000, 0x8458, 0xAEE8,
+  0xAEE0, 0xACE8, 0xACE0, 0x8B98, 0x6B98, 0x8AC8, 0xAAE8, 0xC8E0,
+  0xC8E8, 0xC6C0, 0x0000, 0x0000, 0x0000, 0x0000, 0x65C1, 0xE490,
+  0x85F2, 0x65F2, 0x65F3, 0x8450, 0x1905, 0x0005, 0x65FE, 0x85FE,
+  0x65FD, 0x85FD, 0x85FC, 0x190F, 0x0022, 0xC5E9, 0xC5E9, 0x45E1,
+  0x65E9, 0x8458, 0x0000, 0x0000, 0xC490, 0xC8E0, 0xAAE0, 0xAAE8,
+  0xACE8, 0xC490, 0xE490, 0xACE0, 0xAEE0, 0xAEE8, 0xB0E0, 0xB0E0,
+  0x8B60, 0x4218, 0xB0E8, 0xB1C8, 0x8B60, 0x0000, 0xB1C8, 0xB1A8,
+  0xD1B0, 0xD190, 0xF178, 0x0000, 0x0000, 0x4220, 0xD178, 0x1937,
+  0x002D, 0x4218, 0x1169, 0x4218, 0x0000, 0x0000, 0x1161, 0xF178,
+  0xD178, 0xF178, 0xD190, 0xF178, 0x8B60, 0x6B98, 0xD1B0, 0xB1B0,
+  0x0000, 0x4218, 0xB1C8, 0xB1C8, 0xB1D0, 0xB1C8, 0xB0E0, 0x0000,
+  0x8B98, 0xB0E0, 0xB0E0, 0xAEE0, 0xAEE8, 0x8450, 0x0000, 0x0000,
+  0x8AC8, 0xAAE8, 0xAAE0, 0xC8E0, 0xE7E0, 0x0000, 0x0000, 0x0000,
+  0x0000, 0xC490, 0xC5E9, 0xC5E9, 0x65F2, 0x85F2, 0x1A05, 0x002D,
+  0x65FE, 0x65FD, 0x65F5, 0x85FC, 0x65F4, 0x4218, 0x0000, 0x0000,
+  0x0000, 0x0000, 0xC5E9, 0x45E9, 0x65E1, 0x06E1, 0xE7E8, 0x4218,
+  0x0000, 0x0000, 0xE490, 0xA8E8, 0xAAE0, 0xAAE8, 0xACE0, 0xACE0,
+  0xAEE0, 0xAEE8, 0xAEC8, 0xAEE0, 0xB0E0, 0xB0E0, 0xB0E0, 0xB1C8,
+  0xB1C8, 0xB1B0, 0x0000, 0x0000, 0x8B58, 0xD190, 0xD1B0, 0xD188,
+  0x0000, 0x0000, 0x0000, 0x8B60, 0x5149, 0x1A37, 0x001A, 0x3149,
+  0x8B60, 0x0000, 0x0000, 0x0000, 0x5149, 0x1161, 0x1169, 0xF178,
+  0x0B19, 0x0000, 0x0000, 0xD190, 0xD190, 0xF190, 0xD190, 0xD1A8,
+  0xD1B0, 0xB1C8, 0x6B98, 0xB1D0, 0xB1C8, 0xB1C8, 0xB0E8, 0xB0E0,
+  0xAEE0, 0x1A56, 0x000E, 0xAED0, 0xACE8, 0xA8E0, 0xAAE8, 0xC8E0,
+  0x0000, 0x0000, 0x0000, 0x0000, 0xC490, 0x65E9, 0xC5E9, 0xC5E9,
+  0x85EA, 0x1B05, 0x0005, 0x65FD, 0x85FE, 0x65FD, 0x85F5, 0x85FC,
+  0x1B0F, 0x0023, 0x65C1, 0xC5E9, 0x65E1, 0x45E9, 0x08E1, 0xE7E0,
+  0xC8E8, 0x08E1, 0xE490, 0xACE0, 0xAAE0, 0xACE0, 0xACE8, 0xAEE0,
+  0xAEE0, 0xB0E0, 0xB0E0, 0xB0E0, 0xB0E0, 0xB0E8, 0xB1C8, 0xB1C8,
+  0xB1C8, 0xB1D0, 0xD190, 0x0000, 0x0000, 0x8B58, 0xF190, 0xD190,
+  0x1169, 0x0000, 0x0000, 0x8B60, 0x5149, 0x1B37, 0x002D, 0x3149,
+  0x8B60, 0x0000, 0x0000, 0x5149, 0x1161, 0x3149, 0x1161, 0x0000,
+  0x0000, 0x0000, 0xD178, 0xF178, 0xF190, 0xD188, 0xD1B0, 0xD190,
+  0xB1A8, 0xD1B0, 0xB1C8, 0xB1C8, 0xB1C8, 0xB1C8, 0xB0E0, 0xB0E0,
+  0xB0E8, 0x8EC8, 0x0000, 0x8B98, 0xAEE0, 0xACE0, 0xACE8, 0xAAE0,
+  0xACE0, 0xA8E8, 0x8B98, 0x0000, 0x0000, 0x0000, 0x0000, 0xC490,
+  0xC5E9, 0xC5E9, 0x65EA, 0x64CA, 0x1C05, 0x0005, 0x65F4, 0x85FD,
+  0x65FD, 0x85F4, 0x65FC, 0x1C0F, 0x0055, 0xC5E9, 0x45E1, 0x65E1,
+  0x08E1, 0xE7E0, 0xA8E0, 0xC8E0, 0xA8E8, 0xAAE0, 0xAAE0, 0xACE0,
+  0xACE8, 0xAEE0, 0xAEE0, 0xAEE0, 0xAEE8, 0xB0E0, 0xB0E0, 0xB0E0,
+  0xB1C8, 0xB1C8, 0xB1C8, 0xB1C8, 0xD1B0, 0xB1A8, 0x4218, 0x0000,
+  0x0000, 0xF178, 0xD178, 0x1169, 0x4218, 0x0000, 0x0000, 0x3149,
+  0x0B21, 0x0000, 0x0000, 0x0000, 0x0B19, 0x5151, 0x0000, 0x0000,
+  0x4218, 0x3151, 0x9131, 0x5149, 0x0B19, 0x0000, 0x0000, 0x3151,
+  0x1161, 0x1169, 0xF178, 0xF178, 0xD178, 0xD190, 0xF190, 0xD1A8,
+  0xB1B0, 0xB1C8, 0xB1C8, 0xB1C8, 0xB1D0, 0xB0E0, 0xB0E0, 0xB0E0,
+  0xAEE0, 0xAEE8, 0xAEE0, 0xAEE0, 0xACE0, 0xACE8, 0xAAE0, 0xAAE0,
+  0xC6C0, 0x0000, 0x0000, 0x0000, 0x0000, 0x85C1, 0x45E9, 0xC5E9,
+  0xC5E9, 0x85C1, 0x1D05, 0x002E, 0xA39A, 0x65FD, 0x85F4, 0x65FC,
+  0x85FC, 0x64CA, 0x0000, 0x0000, 0x0000, 0x85C1, 0x65E1, 0x06E1,
+  0x0000, 0xC6C0, 0xA8E0, 0x08E1, 0xC8E8, 0xAAE0, 0xAAE0, 0xACE0,
+  0xACE8, 0xAEE0, 0xAEE0, 0xB0E0, 0xAEE0, 0xB0E0, 0xAEE8, 0xB0E0,
+  0xB1C8, 0xB1D0, 0xB1C8, 0xB1C8, 0xB1B0, 0xD1A8, 0xD190, 0xD1B0,
+  0x0000, 0x0000, 0xF178, 0x1161, 0x0B21, 0x1161, 0x0000, 0x0000,
+  0x0B21, 0x3149, 0x1D3A, 0x002A, 0x5149, 0x9131, 0x0000, 0x9131,
+  0x3149, 0x0000, 0x8B60, 0x3149, 0x1161, 0x1161, 0xF178, 0xF178,
+  0xD190, 0xF178, 0xD190, 0xD188, 0xD1B0, 0xB1A8, 0xB1D0, 0xB1C8,
+  0xB0E0, 0xB1C8, 0xB0E0, 0xB0E0, 0xB0E0, 0xAEE0, 0xB0E0, 0xAEE0,
+  0xAEE8, 0x8B98, 0xC6C0, 0xAAE0, 0xAAE8, 0x4218, 0x0000, 0x0000,
+  0x0000, 0x06E1, 0x65E9, 0x45E1, 0xC5E9, 0x8450, 0x1E05, 0x0019,
+  0x8450, 0x85FD, 0x85FD, 0x65FC, 0x85FC, 0x65F3, 0x64CA, 0x0000,
+  0x0000, 0x65C1, 0xC5E9, 0x8450, 0x0000, 0x0000, 0x0000, 0x8AC8,
+  0xC8E8, 0xAAE0, 0xACE8, 0xAAE0, 0xACE0, 0x8EC8, 0xAEC8, 0x8458,
+  0x4218, 0x1E24, 0x0013, 0x8458, 0xB1B0, 0xD190, 0xF190, 0xF178,
+  0xD178, 0x8B58, 0x1161, 0x0000, 0x0000, 0x3149, 0x8B60, 0x0000,
+  0x0000, 0x9131, 0x0B19, 0x0000, 0x0B21, 0x9131, 0x1E3D, 0x0027,
+  0x9131, 0x9131, 0x0B19, 0x9131, 0x5149, 0x3149, 0x1169, 0x5149,
+  0x8B60, 0x4218, 0x0000, 0x0000, 0x0000, 0x0000, 0x8B60, 0x8B60,
+  0xD190, 0xD1B0, 0xB1C8, 0xB1D0, 0xB0E0, 0xB0E0, 0xB0E0, 0xAEE0,
+  0xAEC8, 0x0000, 0x0000, 0x0000, 0xAAE8, 0xA8E0, 0xE490, 0x0000,
+  0x0000, 0xC6C0, 0x06E9, 0x06E1, 0x65E1, 0xC5E9, 0x4218, 0x1F06,
+  0x0011, 0x85FD, 0x65F4, 0x85FC, 0x65F3, 0x65F3, 0x65F2, 0x85EA,
+  0xC5E9, 0xC5E9, 0x65E1, 0x65E1, 0x06E9, 0x06E1, 0xC8E0, 0xA8E0,
+  0xC8E8, 0x08E9, 0x1F26, 0x001E, 0x4218, 0xF178, 0xD190, 0xD178,
+  0xF178, 0x1169, 0x4218, 0x0000, 0x5149, 0x9131, 0x0000, 0x0000,
+  0x9131, 0x9131, 0x0000, 0xEE09, 0x9131, 0x0000, 0x0000, 0xF221,
+  0x1222, 0x0B21, 0x0000, 0x0B19, 0x1222, 0x9131, 0x5149, 0x9131,
+  0x3149, 0x4220, 0x1F4A, 0x0001, 0x4218, 0x1F52, 0x0011, 0x8B98,
+  0xB0E0, 0xB0E0, 0xAEE0, 0xAEE0, 0xACE0, 0xACE8, 0xAAE0, 0x08E1,
+  0x8AC8, 0xA8E0, 0xC8E0, 0x26E9, 0x06E1, 0x45E1, 0x65E9, 0xC5E9,
+  0x2006, 0x0012, 0x64CC, 0x85FC, 0x65F3, 0x65F3, 0x65F2, 0x85EA,
+  0xC5E9, 0xC5E9, 0x45E1, 0x45E1, 0x06E1, 0x26E1, 0xC8E8, 0xA8E0,
+  0xC8E0, 0xAAE0, 0xAAE8, 0xAAE0, 0x2029, 0x000A, 0x1161, 0x3149,
+  0x3149, 0x5149, 0x0000, 0x0B19, 0x9131, 0x0B21, 0x0000, 0x4218,
+  0x2038, 0x000A, 0x0B21, 0x1222, 0x1222, 0x0000, 0x4218, 0xF221,
+  0x9131, 0x9131, 0x9131, 0x0B19, 0x2052, 0x0011, 0xB1D0, 0xB0E8,
+  0xAEE0, 0xAEE8, 0xACE0, 0xAEE0, 0xACE0, 0xACE8, 0xAAE0, 0xAAE0,
+  0xC8E0, 0xA8E8, 0xC8E0, 0x06E1, 0x06E1, 0x65E9, 0x85C1, 0x2106,
+  0x0013, 0x84CB, 0x85F4, 0x65FC, 0x65F3, 0x65F3, 0x85F2, 0x85EA,
+  0xC5E9, 0xC5E9, 0x65E1, 0x06E1, 0xE7E8, 0xE7E0, 0xC8E0, 0xAAE0,
+  0x8AC8, 0xACE8, 0xACE8, 0x8BA0, 0x212A, 0x0016, 0x3149, 0x3149,
+  0x3149, 0x9131, 0x0000, 0x9129, 0x1222, 0x0000, 0x9131, 0x1222,
+  0x531A, 0xF221, 0x9131, 0x0000, 0xB412, 0x531A, 0x1222, 0x0000,
+  0x531A, 0x1222, 0x1222, 0xEE09, 0x2151, 0x0012, 0xB1A8, 0xB0E0,
+  0xB0E0, 0xB1C8, 0xAEE8, 0xAEE0, 0xACE0, 0xAEE0, 0xACE8, 0xACE0,
+  0xAAE0, 0xAAE0, 0xC8E8, 0xE7E0, 0xE7E0, 0x45E1, 0x65E9, 0xC490,
+  0x2207, 0x0012, 0x65FC, 0x65FB, 0x65F3, 0x85F2, 0x65EA, 0xC5E9,
+  0xC5E9, 0x45E1, 0x65E1, 0xC490, 0x0000, 0xE490, 0xA8E8, 0xC8E0,
+  0xAAE8, 0xAAE0, 0xACE0, 0xACE0, 0x222B, 0x0014, 0x3149, 0x9129,
+  0x9131, 0x9131, 0x0B19, 0x9131, 0x4220, 0xEE09, 0x731A, 0x531A,
+  0xB412, 0xEE09, 0x4220, 0x531A, 0xB412, 0x0000, 0xB41A, 0x531A,
+  0x531A, 0x0B21, 0x2250, 0x0012, 0x8458, 0xB0E8, 0xB0E0, 0xB0E0,
+  0xAEE0, 0xB0E0, 0xAEE0, 0x8B98, 0x4218, 0xACE8, 0xAAE8, 0xAAE0,
+  0xA8E8, 0xC8E0, 0xA8E0, 0x08E1, 0x08E1, 0x65E1, 0x2307, 0x0013,
+  0x85F4, 0x65FC, 0x65F3, 0x65F3, 0x85F2, 0x85F2, 0xC6E1, 0xA6E1,
+  0x65E1, 0x06E1, 0xC6C0, 0x08E1, 0xC8E8, 0xAAE0, 0xAAE0, 0xACE8,
+  0x8AC8, 0xAEC8, 0xAEE8, 0x232C, 0x0012, 0x3149, 0x9129, 0xF221,
+  0x9131, 0x1222, 0x531A, 0x423A, 0xB41A, 0xB412, 0xB41A, 0x0B19,
+  0xB41A, 0x560B, 0x0B21, 0x5613, 0xB412, 0xB41A, 0xEE09, 0x234F,
+  0x0013, 0x8B60, 0xB1C8, 0xD1A8, 0xB0E0, 0xB0E0, 0xB0E0, 0xAEE0,
+  0xB0E8, 0x8EC8, 0xAEC8, 0xACE0, 0xACE0, 0xAAE0, 0xAAE8, 0xC8E0,
+  0x08E1, 0xE7E0, 0x06E1, 0x06E9, 0x2407, 0x0015, 0x64CA, 0x65F3,
+  0x65FB, 0x65EA, 0x85F2, 0xC5E9, 0xC6C0, 0x45E1, 0x06E1, 0xE7E0,
+  0xE7E0, 0xC8E8, 0xA8E0, 0xC8E0, 0xAAE0, 0xAAE8, 0xACE0, 0x8EC8,
+  0xAEE0, 0xB1C8, 0x8B98, 0x242E, 0x0012, 0x9131, 0xF221, 0x1222,
+  0xB412, 0x4220, 0xB412, 0xB41A, 0x560B, 0x0000, 0x5613, 0x5613,
+  0x330B, 0xB412, 0x5613, 0xB412, 0xB41A, 0x531A, 0x0B21, 0x244E,
+  0x0014, 0x8B60, 0xB1B0, 0xD1A8, 0x6B98, 0xB1D0, 0xB0E0, 0xB0E0,
+  0xB0E0, 0xAEE8, 0xAEE0, 0xACE0, 0xACE0, 0xAAE8, 0xAAE0, 0x8B98,
+  0xA8E8, 0xC8E0, 0xE7E0, 0xE7E0, 0xC6C0, 0x2508, 0x0016, 0x65FC,
+  0x65F3, 0x85F2, 0xC5E9, 0x85C1, 0xC490, 0x85C1, 0x26E1, 0x06E9,
+  0xE7E0, 0xA8E0, 0xC8E0, 0xAAE8, 0xAAE0, 0xACE0, 0xACE0, 0xAEE8,
+  0xAEE8, 0x4218, 0x8ED0, 0xAED0, 0x8458, 0x2527, 0x001B, 0x8B60,
+  0x5149, 0x3149, 0x3149, 0x9131, 0x1222, 0xF221, 0x4220, 0x1222,
+  0xB41A, 0xB412, 0x5613, 0xB412, 0x5613, 0x5613, 0xF80B, 0x5613,
+  0xD80B, 0x560B, 0x4220, 0xB412, 0x5613, 0x5613, 0x5613, 0xB412,
+  0xB41A, 0x1222, 0x254C, 0x0015, 0x4218, 0xD178, 0xD1B0, 0x8B58,
+  0xB1C8, 0xB1C8, 0xB0E0, 0xB0E0, 0xB0E0, 0xB0E0, 0xB0E0, 0xAEE8,
+  0xAEE0, 0xACE0, 0xACE0, 0xAAE8, 0x8458, 0xA8E0, 0xC8E0, 0xE7E0,
+  0x06E9, 0x2608, 0x0059, 0xA39A, 0x65F3, 0x85F2, 0x85F2, 0x45E1,
+  0xC490, 0x0000, 0xC6C0, 0xE7E0, 0xE7E8, 0xC8E0, 0xAAE0, 0xAAE0,
+  0xAAE8, 0x0000, 0xAEE0, 0xACE0, 0x8EC8, 0x0000, 0x4218, 0xB0E8,
+  0xB0E0, 0xB1C8, 0xB1C8, 0xD1B0, 0xB1A8, 0xD190, 0xF178, 0xF178,
+  0xD178, 0x1161, 0x1161, 0x3149, 0x5149, 0x0000, 0x9131, 0x9131,
+  0x1222, 0x1222, 0xB412, 0x531A, 0x531A, 0xB412, 0x5613, 0x5613,
+  0xD80B, 0xD80B, 0xF80B, 0x5613, 0xD80B, 0x560B, 0x330B, 0x5613,
+  0x5613, 0x0B19, 0x0B21, 0x531A, 0x531A, 0x1222, 0x1222, 0xEE09,
+  0x9131, 0x4220, 0x0B19, 0x4220, 0x3149, 0x8B60, 0xF178, 0xD178,
+  0xD190, 0x0000, 0x0000, 0xD1B0, 0xB1C8, 0xB1C8, 0x8BA0, 0xB0E0,
+  0xB0E0, 0xAEE0, 0xAEE8, 0xACE0, 0xACE0, 0x0000, 0xC490, 0x8B98,
+  0xA8E8, 0xC8E8, 0xE7E0, 0xC490, 0x2709, 0x0057, 0x85F2, 0x65F3,
+  0xC5E9, 0xC5E9, 0x65E1, 0xC6C0, 0x26E1, 0x06E9, 0xA8E0, 0x8B98,
+  0xAAE8, 0xAAE8, 0x8450, 0x0000, 0x6B98, 0xAEE8, 0xAEE0, 0xB0E0,
+  0xB0E0, 0xB0E0, 0xB1C8, 0xB0E8, 0xB1C8, 0xB1C8, 0xD1B0, 0xB1A8,
+  0xF178, 0x8B60, 0x1169, 0x1161, 0x0000, 0x0000, 0x0000, 0x4220,
+  0x9131, 0xF221, 0x1222, 0xB412, 0xD41A, 0xEE09, 0x0000, 0x5613,
+  0x560B, 0xD80B, 0xD80B, 0x990C, 0xD80B, 0x0000, 0xD80B, 0x9904,
+  0xD80B, 0xD80B, 0x5613, 0x330B, 0x0000, 0x0000, 0x0000, 0x531A,
+  0x1222, 0x1222, 0x0B19, 0x5149, 0x9131, 0x3149, 0x3149, 0x1161,
+  0xF178, 0xF190, 0xD190, 0xB1B0, 0x8B98, 0xB1C8, 0xB1D0, 0x8B58,
+  0x0000, 0x8B60, 0xB0E0, 0xB0E0, 0x6B98, 0xAEE0, 0xACE0, 0xACE8,
+  0x8458, 0xACE0, 0xC8E0, 0xA8E0, 0xC8E8, 0x280A, 0x001C, 0xC490,
+  0xC5E9, 0xC5E9, 0x45E1, 0x06E1, 0x26E1, 0xC6C0, 0xE490, 0x8AC8,
+  0xAAE8, 0x8AC8, 0x0000, 0x0000, 0x4218, 0xAEE8, 0xAEE0, 0xAEE0,
+  0xB0E0, 0x4218, 0x0000, 0xB1D0, 0xD1A8, 0x8BA0, 0xB1A8, 0xD190,
+  0xF190, 0x8B58, 0x1161, 0x282B, 0x0034, 0x9129, 0x9131, 0x531A,
+  0x1222, 0xEE09, 0x0000, 0x0000, 0x5613, 0xF80B, 0xD80B, 0x9904,
+  0xD80B, 0x790C, 0x0000, 0x0000, 0xD80B, 0x9904, 0xD80B, 0xD80B,
+  0x5613, 0x5613, 0x0B19, 0x0000, 0x0000, 0x1222, 0x1222, 0xEE09,
+  0x9131, 0x9131, 0x9131, 0x0000, 0x3149, 0x1169, 0x0000, 0xD190,
+  0xF190, 0xD1A8, 0xB1B0, 0xB1C8, 0x0000, 0x0000, 0x0000, 0xB0E0,
+  0xAEE8, 0xAEC8, 0x6B98, 0xAEE8, 0xACE0, 0xACE0, 0xAAE8, 0xAAE0,
+  0xE490, 0x290C, 0x0019, 0xC490, 0x85C1, 0x65E9, 0x08E1, 0x08E1,
+  0x8AC8, 0xA8E0, 0xC8E8, 0x8AC8, 0x8458, 0x8458, 0x8450, 0xAEE0,
+  0xAEE8, 0xAED0, 0x0000, 0x0000, 0x8B58, 0xB1C8, 0xD190, 0x0000,
+  0xD1B0, 0xD1A8, 0xD190, 0xD190, 0x292A, 0x0009, 0x4220, 0x4218,
+  0x1222, 0x1222, 0xB41A, 0x0000, 0x0000, 0xEE09, 0xF80B, 0x293A,
+  0x0023, 0x223A, 0x7904, 0x990C, 0xD80B, 0x0000, 0xD412, 0x5613,
+  0xEE09, 0x0000, 0x0000, 0x1222, 0x9129, 0x9131, 0x9131, 0x3149,
+  0x0000, 0x1161, 0x1169, 0x0000, 0x0000, 0x4218, 0xD190, 0xB1C8,
+  0xB1C8, 0x0000, 0x0000, 0x0000, 0xAEC8, 0xB0E0, 0xAEE0, 0xAEE0,
+  0xACE8, 0xACE0, 0xAAE8, 0x6B98, 0x2A10, 0x0036, 0x8458, 0xE498,
+  0xC6C0, 0x8AC8, 0x8AC8, 0xAAE8, 0xAEC8, 0xACE0, 0xAEE8, 0xAEE0,
+  0x8450, 0xD1B0, 0x0000, 0xB1C8, 0xB1C8, 0xB1D0, 0x0000, 0x6B98,
+  0xD190, 0xF190, 0xF178, 0x1161, 0x4218, 0x3149, 0x0B21, 0x0000,
+  0x0000, 0x9131, 0x1222, 0x531A, 0x0000, 0x0000, 0x0000, 0xEE09,
+  0xF80B, 0x7904, 0xD80B, 0x9904, 0x790C, 0x7904, 0x0000, 0x0000,
+  0x0000, 0xD80B, 0xD80B, 0xF80B, 0x0B21, 0x0000, 0x0B21, 0xB412,
+  0xEE09, 0x4220, 0x1222, 0x1222, 0x2A4C, 0x000D, 0x8B60, 0x1161,
+  0x0B19, 0xD178, 0xD1B0, 0xB1D0, 0x6B98, 0xD1B0, 0x6B98, 0xAED0,
+  0x6B98, 0xAED0, 0x8450, 0x2B16, 0x001E, 0x4220, 0x4218, 0x0000,
+  0x4218, 0xB0E0, 0x6BA0, 0xAEC8, 0xB1C8, 0xB1C8, 0xB1D0, 0xB1A8,
+  0x8B60, 0xD1B0, 0xD190, 0xF178, 0x1161, 0x1169, 0x6B60, 0x0000,
+  0x0000, 0x0000, 0x1222, 0x531A, 0x0E0A, 0x0000, 0x0000, 0x0000,
+  0xEE09, 0xD80B, 0xD80B, 0x2B3C, 0x0017, 0x9904, 0xD80B, 0xF80B,
+  0x0000, 0x0000, 0x0000, 0xB41A, 0x531A, 0x531A, 0x9131, 0x1222,
+  0x0B19, 0x3149, 0x3149, 0x1169, 0x1161, 0xF178, 0x8B60, 0xD190,
+  0x4218, 0x0000, 0x0000, 0x8B60, 0x2C18, 0x0038, 0x8458, 0xB0E8,
+  0xAEE0, 0xB0E0, 0xB0E0, 0xB0E0, 0xB1C8, 0xB1C8, 0xD1B0, 0xB1A8,
+  0xD190, 0xF190, 0xF178, 0x1161, 0x3149, 0x3149, 0x0000, 0x0000,
+  0x0B19, 0x1222, 0x1222, 0x0000, 0x0000, 0x0000, 0x0000, 0xEE09,
+  0xF80B, 0x790C, 0x790C, 0x7904, 0x790C, 0x7904, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x330B, 0x7904, 0xD80B, 0x4220, 0x0000, 0xEE09,
+  0x731A, 0x531A, 0x1222, 0xF221, 0x9131, 0x9131, 0x9131, 0x3149,
+  0x5149, 0x1169, 0xF178, 0xD178, 0xD190, 0xD1A8, 0x2D17, 0x0021,
+  0x8EC8, 0xAEE0, 0xAEE8, 0xB0E0, 0xB0E0, 0xB0E0, 0xB1C8, 0xB1D0,
+  0x8B98, 0xB1A8, 0xD1B0, 0xD190, 0xF178, 0xF178, 0x1161, 0x1169,
+  0x3149, 0x5151, 0x0B19, 0x9131, 0x9131, 0x9131, 0x0000, 0x0000,
+  0x0000, 0x0000, 0xEE09, 0xD80B, 0xD80B, 0x7904, 0x790C, 0x7904,
+  0x990C, 0x2D3E, 0x0014, 0xF80B, 0x5613, 0x3303, 0xB41A, 0xB412,
+  0x531A, 0x531A, 0x1222, 0x9131, 0x9131, 0x3149, 0x3149, 0x1161,
+  0x1161, 0xF178, 0xF190, 0xD188, 0xD190, 0xB1D0, 0xD1B0, 0x2E15,
+  0x0017, 0x8B98, 0xACE8, 0xAEE0, 0xAEE8, 0xAEE0, 0xAEE0, 0xB0E0,
+  0xB1C8, 0xB0E0, 0xB1A8, 0x0000, 0xD1B0, 0xB1A8, 0xD190, 0xF190,
+  0x1161, 0x1161, 0x3149, 0x5149, 0x9131, 0x9131, 0x9131, 0x1222,
+  0x2E31, 0x0007, 0xEE09, 0xF80B, 0x7904, 0xD80B, 0x9904, 0x790C,
+  0x7904, 0x2E3D, 0x0017, 0x0B21, 0xD80B, 0xD80B, 0xB412, 0xB41A,
+  0x531A, 0x531A, 0x1222, 0x1222, 0x9131, 0x9131, 0x9131, 0x4218,
+  0x0B21, 0xF160, 0xF178, 0xD190, 0xD190, 0xD1B0, 0xD1A8, 0xB1C8,
+  0xB1D0, 0x6B98, 0x2F14, 0x0018, 0xACE0, 0xAAE0, 0xAEE8, 0xACE0,
+  0xAEE0, 0xAEE8, 0xB0E0, 0xB0E0, 0xB0E0, 0xB1A8, 0xD1B0, 0xB1A8,
+  0xB1D0, 0xF178, 0xD1B0, 0xD190, 0x4218, 0x1161, 0x1169, 0x3149,
+  0x3149, 0x9131, 0x1222, 0x0B21, 0x2F31, 0x0007, 0xB412, 0xF80B,
+  0xD80B, 0x790C, 0x7904, 0x790C, 0x7904, 0x2F3E, 0x0017, 0xF80B,
+  0x5613, 0x5613, 0xB412, 0xB412, 0x531A, 0x0000, 0x9131, 0x1222,
+  0x9131, 0x3149, 0x5149, 0x3149, 0x1161, 0xF178, 0xD190, 0xB1B0,
+  0xD1A8, 0xB1C8, 0xB1C8, 0xB0E8, 0xB1C8, 0xB0E0, 0x3012, 0x001A,
+  0x8450, 0xAAE8, 0xAAE8, 0xACE0, 0xACE0, 0xAEE0, 0xAEE8, 0xAEE0,
+  0xAEE0, 0xAEC8, 0xB0E0, 0xB0E0, 0xB1C8, 0xB1B0, 0xD1A8, 0xD178,
+  0xD190, 0xF190, 0x0000, 0x1161, 0x3149, 0x5149, 0x9131, 0x3149,
+  0x9131, 0x9129, 0x3031, 0x0007, 0x330B, 0x560B, 0xF80B, 0xF80B,
+  0x790C, 0xD80B, 0xF80B, 0x303D, 0x0019, 0x330B, 0x560B, 0x5613,
+  0xB41A, 0xB412, 0x1222, 0xF221, 0x0000, 0x9131, 0x9131, 0x9131,
+  0x9131, 0x3149, 0x5149, 0x1161, 0xF178, 0xD190, 0xD190, 0xD1B0,
+  0xD1A8, 0xB1D0, 0xB1C8, 0xB0E0, 0xB0E0, 0xB0E0, 0x3111, 0x0047,
+  0xC6C0, 0xA8E8, 0xC8E0, 0xACE0, 0xAAE0, 0xACE8, 0xACE0, 0xAEE0,
+  0xAEE8, 0xB0E0, 0xB1C8, 0xB0E0, 0xB1C8, 0xB1D0, 0xB1A8, 0xB1D0,
+  0x8B58, 0xD1B0, 0xF190, 0xD190, 0x1161, 0x1169, 0x3149, 0x3149,
+  0x0B19, 0x9131, 0x9131, 0x1222, 0x0000, 0x0000, 0x0000, 0x0000,
+  0xB41A, 0x5613, 0x560B, 0xF80B, 0xD80B, 0x790C, 0xD80B, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x4232, 0x5613, 0x5613, 0x531A, 0x330B,
+  0xB412, 0x531A, 0x1222, 0x9129, 0x9131, 0x9131, 0x9131, 0x5149,
+  0x3149, 0x1161, 0x1161, 0xF190, 0xD190, 0xD178, 0xD1A8, 0xD178,
+  0xD1B0, 0xB1C8, 0xB1C8, 0xB0E0, 0xB0E0, 0xB0E0, 0x6BA0, 0x3210,
+  0x0049, 0xC6C0, 0xE7E0, 0xC8E0, 0xAAE0, 0xAAE8, 0xACE0, 0xACE0,
+  0xAEE0, 0xACE8, 0xAEE0, 0x8450, 0x8458, 0xB0E8, 0xB0E0, 0x0000,
+  0xB1C8, 0xB1A8, 0xD190, 0xF190, 0xD188, 0xF178, 0xF178, 0x1161,
+  0x1161, 0x0000, 0x0000, 0x0B21, 0x9131, 0x9129, 0x0B21, 0x0000,
+  0x0000, 0x0000, 0xB412, 0xB412, 0x5613, 0x5613, 0xD80B, 0xF80B,
+  0xD80B, 0x0000, 0x0000, 0x0000, 0x0000, 0x5613, 0x560B, 0xB41A,
+  0x0000, 0x0000, 0x531A, 0x1222, 0x1222, 0x9131, 0x9131, 0x9131,
+  0x3149, 0x3149, 0x1161, 0x0B21, 0x0000, 0xF178, 0xD190, 0x0000,
+  0xD190, 0xD1A8, 0xB1D0, 0xB1C8, 0xB0E0, 0xB0E0, 0xB0E0, 0xAEE8,
+  0xAEE0, 0xAEC8, 0x330F, 0x004B, 0x06E9, 0x06E1, 0xE7E0, 0x08E1,
+  0xC8E0, 0xAAE8, 0xAAE0, 0xACE0, 0xACE0, 0xAEE8, 0xAEE0, 0xB0E0,
+  0xB1C8, 0xB0E0, 0xB0E8, 0x8EC8, 0xB1C8, 0xB1C8, 0xD1B0, 0xD1A8,
+  0xD190, 0xD190, 0xF178, 0xD178, 0x1169, 0x0B19, 0x0000, 0x0000,
+  0x9131, 0x1222, 0x9131, 0x0000, 0x0000, 0x0000, 0xB41A, 0x5613,
+  0x560B, 0x5613, 0x5613, 0xD80B, 0x5613, 0x0000, 0x0000, 0x0000,
+  0xEE09, 0x5613, 0xB412, 0x0000, 0x0000, 0x0000, 0x1222, 0x531A,
+  0x1222, 0x1222, 0x9131, 0x3149, 0x5149, 0x1161, 0x1161, 0x8B60,
+  0x1161, 0xD190, 0xD178, 0xF178, 0xB1A8, 0xB1C8, 0xB1C8, 0xB0E0,
+  0xB0E0, 0xB0E0, 0xB0E0, 0xB0E0, 0xAEE0, 0xAEE8, 0xACE0, 0x340E,
+  0x001B, 0x27D1, 0x26E1, 0xE7E0, 0xE7E8, 0xC8E0, 0xA8E0, 0xC8E0,
+  0xACE8, 0x8EC8, 0xACE0, 0xACE0, 0xAEE8, 0xAEE0, 0xB0E0, 0xB0E0,
+  0xB0E0, 0xB1C8, 0xB1C8, 0xD1A8, 0xB1B0, 0xD190, 0xF188, 0xD190,
+  0xF178, 0x1161, 0x1161, 0x3149, 0x342E, 0x002D, 0x4218, 0x0000,
+  0x1222, 0x531A, 0x531A, 0xB41A, 0xB412, 0x5613, 0xB41A, 0x3303,
+  0xB41A, 0x0000, 0x0000, 0x5613, 0xB412, 0xEE09, 0x0000, 0x0000,
+  0xEE09, 0x1222, 0x9131, 0x9131, 0x9131, 0x9131, 0x9131, 0x3149,
+  0x5149, 0x1169, 0x1161, 0xF178, 0xD190, 0xD1B0, 0xD188, 0xD1B0,
+  0xB1A8, 0xB1D0, 0xB1C8, 0xB0E0, 0xB0E0, 0xB0E0, 0xAEE8, 0xAEE0,
+  0xACE0, 0xACE0, 0xAEC8, 0x350D, 0x004F, 0x65E1, 0x65E9, 0x06E1,
+  0x06E1, 0xE7E0, 0xE7E8, 0xC8E0, 0xAAE8, 0x6B98, 0x0000, 0xAEC8,
+  0xAEE0, 0xAEE0, 0xAEE8, 0xAEE0, 0xB0E0, 0xAEE8, 0xB1C8, 0xB1C8,
+  0xB1C8, 0xB1B0, 0xD1B0, 0xD190, 0x0000, 0x1161, 0xF178, 0x1161,
+  0x1169, 0x3149, 0x0000, 0x0000, 0x9129, 0x9131, 0x9131, 0x4220,
+  0x1222, 0x0000, 0xB412, 0x531A, 0xB41A, 0xB412, 0x5613, 0x0000,
+  0x330B, 0x0000, 0xEE09, 0xB41A, 0xB412, 0x0000, 0x0000, 0x0B19,
+  0x531A, 0x1222, 0x1222, 0x9131, 0x0000, 0x9131, 0x3149, 0x3149,
+  0x1161, 0x1161, 0xF178, 0xF178, 0xD190, 0xD190, 0xD1A8, 0xB1B0,
+  0xB1C8, 0xB1D0, 0x8B98, 0x4218, 0xB0E0, 0xB0E0, 0xAEE0, 0xAEE8,
+  0xAEE0, 0xACE0, 0xACE8, 0x8AC8, 0x360C, 0x0051, 0xC490, 0xC5E9,
+  0x65E1, 0x45E9, 0x08E1, 0xE7E0, 0xC8E0, 0xA8E0, 0xC8E8, 0xAAE0,
+  0x0000, 0x0000, 0xACE0, 0xACE0, 0x0000, 0x0000, 0x6B98, 0xB0E8,
+  0xB1C8, 0xB0E0, 0xB1C8, 0xB1C8, 0xD1B0, 0x8B58, 0x0000, 0x0000,
+  0x1161, 0x8B60, 0x0000, 0x1161, 0x3149, 0x0000, 0x0000, 0x9131,
+  0x9131, 0x1222, 0x0B19, 0x0000, 0x1222, 0x531A, 0x531A, 0xB41A,
+  0x531A, 0x0000, 0xEE09, 0xEE09, 0x531A, 0xB41A, 0x0B19, 0x0000,
+  0x0B21, 0x1222, 0x0B21, 0x0000, 0x9131, 0x4218, 0x0000, 0x0000,
+  0x3149, 0x1169, 0x1161, 0xF178, 0xD178, 0xD190, 0x8B60, 0x0000,
+  0x4218, 0xD1B0, 0xB1D0, 0x4218, 0x0000, 0xAED0, 0xAEE0, 0xB0E0,
+  0xAEE8, 0xAEE0, 0xACE0, 0xACE0, 0xAAE8, 0xAAE0, 0xC490, 0x370C,
+  0x0051, 0x85EA, 0xC5E9, 0xC5E9, 0x45E9, 0x65E1, 0xE7E0, 0x08E1,
+  0xA8E0, 0xAAE8, 0xAAE0, 0x8BA0, 0x8450, 0xAEE8, 0x8EC8, 0x0000,
+  0x0000, 0xAEC8, 0xB0E0, 0xB0E0, 0xB0E0, 0xB0E0, 0xB1D0, 0xB1D0,
+  0x4218, 0x0000, 0x0000, 0x8B60, 0xF178, 0x0000, 0x0000, 0x1161,
+  0x3149, 0x0000, 0x9131, 0x3149, 0x9131, 0x0000, 0x0000, 0x1222,
+  0xF221, 0x531A, 0x1222, 0x531A, 0x0000, 0x0B21, 0x531A, 0xB41A,
+  0x531A, 0x4218, 0x0B21, 0x1222, 0x0B19, 0x0000, 0x9131, 0x3149,
+  0x0000, 0x0000, 0x0000, 0x1161, 0x1161, 0xF178, 0xF178, 0xD190,
+  0xD190, 0xD1A8, 0x0000, 0x0000, 0xD190, 0xB0E0, 0x8B98, 0x0000,
+  0xB0E0, 0xB0E0, 0xAEE0, 0xAEE0, 0xAEE8, 0xAEE0, 0xACE0, 0x08E1,
+  0xAAE0, 0xAAE8, 0x380C, 0x0052, 0xC5E9, 0xC5E9, 0x45E1, 0x65E9,
+  0x06E1, 0x06E1, 0xC8E0, 0xC8E8, 0xA8E0, 0xAAE0, 0xAAE0, 0x8AC8,
+  0xACE8, 0xAEE0, 0x0000, 0x0000, 0xAEE0, 0xB0E0, 0xB0E0, 0xB0E0,
+  0xAEC8, 0x4218, 0xD1B0, 0x8B60, 0x0000, 0x0000, 0x0000, 0xD178,
+  0x1161, 0x0000, 0x0000, 0x3149, 0x5149, 0x3149, 0x9131, 0x9131,
+  0x0000, 0x0000, 0x9131, 0x1222, 0x9129, 0x1222, 0x1222, 0x0000,
+  0x0000, 0xF221, 0x1222, 0x1222, 0x9131, 0xF221, 0x0B19, 0x0000,
+  0x0000, 0x9131, 0x4220, 0x0000, 0x0000, 0x0000, 0x3149, 0x5149,
+  0x4220, 0xD190, 0xF190, 0xD190, 0xD1A8, 0x8BA0, 0x0000, 0xB1C8,
+  0xB1C8, 0x8EC8, 0xAED0, 0xB0E0, 0xAEE0, 0xAEE8, 0xACE0, 0xAEE0,
+  0xACE0, 0xACE8, 0xAAE0, 0xAAE0, 0xA8E0, 0x8458, 0x390B, 0x0053,
+  0x6450, 0x85EA, 0xC5E9, 0xC5E9, 0x65E1, 0x65E9, 0x06E1, 0x08E1,
+  0xA8E0, 0xC6C0, 0xC8E0, 0xAAE8, 0xAAE0, 0xAAE8, 0xACE8, 0x4218,
+  0x6B98, 0xB0E0, 0xB0E0, 0xB0E0, 0xB0E0, 0xB0E0, 0xB1C8, 0xB1D0,
+  0xD1B0, 0xF178, 0xD190, 0xD178, 0xF178, 0xF190, 0x0B19, 0x0000,
+  0x0000, 0x3151, 0x3149, 0x3149, 0x0B19, 0x0000, 0x0000, 0x9131,
+  0x9131, 0x1222, 0x9131, 0x1222, 0x0000, 0x0000, 0xEE09, 0x1222,
+  0x9131, 0x1222, 0x0000, 0x0000, 0x0000, 0x3149, 0x9131, 0x0B21,
+  0x0B19, 0x8B60, 0x0B19, 0x1161, 0x1161, 0xF190, 0xD190, 0xD1A8,
+  0xD190, 0xB1B0, 0xD1A8, 0x8B60, 0xB1C8, 0xB1D0, 0x6B98, 0xB0E0,
+  0xB0E0, 0xB1C8, 0xAEE0, 0xAEE0, 0xACE0, 0xACE8, 0xAAE0, 0xAAE0,
+  0xC8E0, 0xAAE8, 0x8458, 0x3A0B, 0x0053, 0x8458, 0x85F2, 0x85F2,
+  0xC5E9, 0xC5E9, 0x06E1, 0x06E1, 0xE7E0, 0xE7E0, 0x8458, 0x0000,
+  0xC8E8, 0xACE0, 0xAAE0, 0xACE0, 0xACE8, 0xAEE0, 0xAEE0, 0xB0E0,
+  0x6B98, 0x0000, 0xB1C8, 0xB0E8, 0xD1A8, 0xD178, 0x8B58, 0xF178,
+  0x6BA0, 0xD190, 0xF178, 0xF178, 0x1161, 0x0B19, 0x0000, 0x1161,
+  0x3149, 0x4220, 0x0000, 0x0000, 0x9131, 0x9131, 0x9129, 0x9131,
+  0x9131, 0x0000, 0x0000, 0x0000, 0x9131, 0x9129, 0x4220, 0x0000,
+  0x0B19, 0x3149, 0x9131, 0x5149, 0x3151, 0x5149, 0x8B60, 0x1161,
+  0x1169, 0xF178, 0xD178, 0x4218, 0x0000, 0xD1B0, 0xB1B0, 0xB1C8,
+  0xB1C8, 0xB0E8, 0xB1C8, 0xB0E0, 0xB0E0, 0x8B98, 0x0000, 0x8EC8,
+  0xACE8, 0xACE0, 0xAAE8, 0xAAE0, 0xC8E0, 0xAAE0, 0xA8E8, 0x4218,
+  0x3B0C, 0x0015, 0x85EA, 0xC5E9, 0x85F2, 0xA6E1, 0x65E9, 0x26E1,
+  0x06E9, 0xC490, 0xC6C0, 0xC8E0, 0xAAE0, 0xAAE0, 0xACE8, 0xACE0,
+  0xAEE0, 0xAEE0, 0xAEE8, 0xAEE0, 0x6BA0, 0xB1C8, 0xAEC8, 0x3B27,
+  0x0008, 0xF178, 0xD190, 0xF178, 0xD190, 0xD178, 0xF178, 0x1161,
+  0x1169, 0x3B34, 0x000E, 0x3149, 0x9131, 0x5149, 0x0000, 0x0000,
+  0x0000, 0x3149, 0x9131, 0x5149, 0x9131, 0x3151, 0x0B19, 0x5151,
+  0x3149, 0x3B47, 0x0016, 0x0B19, 0xD178, 0x8B60, 0x4218, 0xD1B0,
+  0xB1C8, 0xB1C8, 0xB0E0, 0xB0E0, 0xB0E0, 0xB0E0, 0xB0E0, 0xB1C8,
+  0x6BA0, 0x8450, 0xAEE0, 0xACE8, 0xACE0, 0xAAE0, 0xAAE0, 0xC8E8,
+  0x08E1, 0x3C0C, 0x0014, 0x65EA, 0x85F2, 0xC5E9, 0xC5E9, 0x45E1,
+  0x45E1, 0x08E1, 0xE7E0, 0xC6C0, 0xC8E0, 0xA8E0, 0xAAE8, 0xAAE0,
+  0xACE0, 0xACE0, 0xAEE8, 0xAEC8, 0xAEE0, 0xAEE0, 0x8EC8, 0x3C27,
+  0x001B, 0xD1B0, 0xD188, 0x0000, 0x0000, 0x4218, 0x1169, 0xF178,
+  0x8B60, 0x0000, 0x0000, 0x0000, 0x3149, 0x3149, 0x9131, 0x5149,
+  0x9131, 0x0000, 0x0000, 0x0000, 0x0B19, 0x3149, 0x9131, 0x0B21,
+  0x0000, 0x0000, 0x5149, 0x1169, 0x3C49, 0x0014, 0x8B60, 0xD1A8,
+  0xB1D0, 0xB1A8, 0xB1C8, 0xB1D0, 0xB0E0, 0xB0E0, 0xB0E0, 0xAEE0,
+  0xAEE8, 0xAEE0, 0x8AC8, 0xACE0, 0xACE0, 0xAAE8, 0xAAE0, 0xC8E0,
+  0xC8E0, 0xA8E8, 0x3D0C, 0x0015, 0x65F3, 0x85EA, 0x85EA, 0xC5E9,
+  0xC5E9, 0x45E9, 0x65E1, 0xE7E0, 0x08E1, 0xA8E0, 0xAAE8, 0xC6C0,
+  0xACE0, 0xAAE0, 0xACE0, 0xACE8, 0xACE0, 0xAEC8, 0xB0E0, 0xAEE8,
+  0x6BA0, 0x3D27, 0x001B, 0xD1A8, 0xD1B0, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x8B60, 0x8B60, 0x0000, 0x0000, 0x0000, 0x1161, 0x3149,
+  0x1169, 0x5149, 0x3151, 0x0000, 0x0000, 0x0000, 0x5149, 0x3149,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x1161, 0x1169, 0x3D48, 0x0015,
+  0xB1B0, 0xD1A8, 0xB1C8, 0xB1B0, 0xF178, 0xB1C8, 0xB0E0, 0xB0E0,
+  0xB0E0, 0xAEE0, 0xB0E0, 0xAEE0, 0xAEE0, 0xACE8, 0xACE0, 0xAAE0,
+  0xACE0, 0xAAE8, 0xA8E0, 0xC8E0, 0x27D1, 0x3E0C, 0x0051, 0x64CA,
+  0x65F2, 0xC5E9, 0xC5E9, 0x45E1, 0x65E1, 0x06E1, 0x06E1, 0xE7E8,
+  0xE7E0, 0xAAC8, 0x0000, 0x8AC8, 0xAAE0, 0xAAE0, 0xACE8, 0xACE0,
+  0xAEE0, 0x0000, 0xAEC8, 0xB1C8, 0xB0E0, 0xB0E0, 0xB0E0, 0xB1C8,
+  0xB1D0, 0xB1C8, 0xB1C8, 0x8B98, 0x0000, 0x0000, 0x0000, 0x8B60,
+  0xD190, 0x0000, 0x0000, 0x0000, 0x0000, 0x8B60, 0x1161, 0x3149,
+  0x1161, 0x8B60, 0x0000, 0x0000, 0x0000, 0x0000, 0x1161, 0x0B19,
+  0x0000, 0x0000, 0x0000, 0x1169, 0xF178, 0xF178, 0xD190, 0xD190,
+  0xF190, 0xD190, 0xD1A8, 0xD1B0, 0xB1A8, 0x0000, 0xD190, 0xB1C8,
+  0xB0E0, 0xB0E0, 0xB0E0, 0xAEC8, 0x0000, 0x8BA0, 0xAEE0, 0xACE8,
+  0xACE0, 0xAAE0, 0xACE0, 0xA8E8, 0xAAE0, 0xC8E0, 0xE7E0, 0xC490,
+  0x3F0C, 0x0022, 0x64CA, 0x65EA, 0x85F2, 0xC5E9, 0xC5E9, 0x65E1,
+  0x65E1, 0x06E1, 0x06E9, 0xE7E0, 0x08E1, 0xC8E0, 0xAAE0, 0xAAE8,
+  0xACE0, 0xACE8, 0xAEE8, 0x4218, 0x0000, 0x0000, 0x0000, 0x8B58,
+  0xB1D0, 0x8EC8, 0xAEC8, 0xB1C8, 0xB0E0, 0xB1D0, 0xB1B0, 0x0000,
+  0x0000, 0x4218, 0xD1B0, 0xD190, 0x3F33, 0x0003, 0xF178, 0xD178,
+  0x1161, 0x3F3B, 0x0021, 0x1161, 0xF178, 0x4218, 0x0000, 0x0000,
+  0xD178, 0xF178, 0xF190, 0xD190, 0xB1B0, 0xF178, 0xD178, 0x4218,
+  0x0000, 0x0000, 0x0000, 0x0000, 0xB0E0, 0xB0E0, 0xB0E0, 0xB0E0,
+  0xB0E0, 0xAEE0, 0xAEE0, 0xAEE0, 0xAEE8, 0xACE0, 0xACE0, 0xAAE0,
+  0xAAE8, 0xC8E0, 0x08E1, 0xE7E8, 0x400C, 0x0011, 0xC490, 0x65FB,
+  0x85EA, 0x85F2, 0xC5E9, 0xC5E9, 0x45E1, 0x45E1, 0x06E1, 0xE7E0,
+  0xC8E0, 0xC8E8, 0xA8E0, 0xAAE0, 0xAAE0, 0xACE8, 0x8AC8, 0x4025,
+  0x0009, 0x8B98, 0x8B98, 0xB1C8, 0xB1B0, 0x0000, 0x8B58, 0xD1B0,
+  0xB1B0, 0x8B58, 0x4033, 0x0003, 0x0B19, 0x8B60, 0x4220, 0x403B,
+  0x0009, 0x8B60, 0xF178, 0xD178, 0x4218, 0x0000, 0xF178, 0xD190,
+  0xD190, 0x8B60, 0x404C, 0x0011, 0x8B98, 0xB0E8, 0xAEE0, 0xB0E0,
+  0xAEE8, 0xAEE0, 0xACE0, 0xACE0, 0xACE8, 0xACE0, 0xAAE0, 0xAAE0,
+  0xC8E8, 0xA8E0, 0xC8E0, 0xE7E0, 0x8458, 0x410C, 0x0010, 0x4232,
+  0x65FB, 0x65F3, 0x85EA, 0x85EA, 0xC5E9, 0xC5E9, 0x06E9, 0x06E1,
+  0x08E1, 0xE7E0, 0xC8E0, 0xAAE8, 0xA8E0, 0xAAE8, 0xAAE8, 0x4124,
+  0x0009, 0xAEC8, 0xB1B0, 0x8B98, 0xB1C8, 0xB1C8, 0xB1B0, 0xB1C8,
+  0xD1B0, 0xB1C8, 0x413C, 0x0007, 0xF190, 0xD188, 0xD190, 0xF178,
+  0xD1B0, 0xD188, 0xD190, 0x414D, 0x000F, 0xB0E0, 0xB0E0, 0xAEE0,
+  0xAEE0, 0xAEE0, 0xAEE8, 0xACE0, 0xACE0, 0xAAE0, 0xAAE8, 0xC8E0,
+  0xAAE0, 0xA8E0, 0xE7E8, 0xE7E8, 0x420D, 0x0020, 0x65F3, 0x65F2,
+  0x85F2, 0xC5E9, 0xC5E1, 0xC490, 0x0000, 0x0000, 0x06E9, 0xC6C0,
+  0x0000, 0x0000, 0xC6C0, 0xC8E0, 0xAAE0, 0x8EC8, 0xACE8, 0xACE0,
+  0xAEC8, 0x6B98, 0x8458, 0x0000, 0x0000, 0x8B98, 0xB1D0, 0xB0E0,
+  0xB0E0, 0xB1C8, 0xB1C8, 0xB1D0, 0xB1C8, 0x6B98, 0x423C, 0x0020,
+  0x8B60, 0xD190, 0xF190, 0xD1A8, 0xB1B0, 0xD1A8, 0xD190, 0x8458,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x4218, 0x8BA0, 0x8EC8, 0xAEE8,
+  0xD1A8, 0xB0E0, 0xAEE8, 0x8EC8, 0x4218, 0x0000, 0x8B60, 0xACE8,
+  0x8B58, 0x0000, 0x8B98, 0xA8E8, 0xC8E0, 0xE7E8, 0xE7E0, 0x06E1,
+  0x430D, 0x0020, 0x65F3, 0x65F3, 0x85F2, 0x85EA, 0xC5E9, 0x0000,
+  0x0000, 0x0000, 0x06E1, 0x06E9, 0x8458, 0xC6C0, 0xC8E0, 0xAAE0,
+  0xAAE0, 0xACE8, 0xAAE0, 0xACE0, 0xACE0, 0xAEE8, 0xAEE0, 0xAEE0,
+  0xAEE8, 0xB0E0, 0xB0E0, 0xB0E0, 0xB0E0, 0xB0E0, 0xB1C8, 0xB1C8,
+  0xB1B0, 0xD1B0, 0x433C, 0x0020, 0xD178, 0x4218, 0xD1B0, 0xB1A8,
+  0xB1C8, 0xD1B0, 0xB1C8, 0xB1C8, 0xB1D0, 0x8EC8, 0xB1C8, 0xB0E0,
+  0xB0E0, 0xB0E0, 0xB0E0, 0xB0E0, 0xB0E0, 0xAEE0, 0xAEE0, 0xAEE8,
+  0x8B98, 0x0000, 0x8EC8, 0xAAE8, 0x8B98, 0x0000, 0x0000, 0xC6C0,
+  0xE7E0, 0xE7E0, 0x26E9, 0x06E1, 0x440D, 0x001F, 0x65F3, 0x65FB,
+  0x65F3, 0x85F2, 0xA6E1, 0x0000, 0x0000, 0x0000, 0x65C1, 0x06E1,
+  0x26E1, 0xE7E8, 0xE7E0, 0xC8E0, 0xA8E0, 0xC8E8, 0xAAE0, 0xAAE0,
+  0xACE0, 0xACE8, 0xAEE0, 0xACE0, 0xAEE0, 0xAEE8, 0xB0E0, 0xAEE0,
+  0xB0E0, 0xB0E0, 0xB0E0, 0x8B58, 0xB1C8, 0x443C, 0x0020, 0x8B60,
+  0xB1B0, 0x0000, 0xB1D0, 0xD1A8, 0xB1C8, 0xB1D0, 0xB1C8, 0xB1C8,
+  0xB0E0, 0xB1C8, 0xB0E8, 0xB0E0, 0xB0E0, 0xAEE0, 0xB0E0, 0xAEE0,
+  0xAEE8, 0xACE0, 0xAEE0, 0xACE0, 0xACE8, 0xAAE0, 0xAAE0, 0x0000,
+  0x0000, 0x0000, 0x4218, 0xE7E8, 0x06E1, 0x06E9, 0xC6C0, 0x450D,
+  0x001F, 0xA39A, 0x85FC, 0x65F3, 0x65FB, 0x65C1, 0x0000, 0x0000,
+  0x0000, 0x8450, 0x65E9, 0x26E1, 0x06E1, 0xE7E0, 0xE7E8, 0xC498,
+  0xE490, 0xAAE0, 0xACE0, 0xAAE0, 0xACE8, 0xACE0, 0xAEE0, 0xAEE0,
+  0xAEE8, 0xAEE0, 0xB0E0, 0xAEE0, 0xB0E8, 0x6B98, 0xB1C8, 0xB0E0,
+  0x453D, 0x001F, 0xB1D0, 0x8B98, 0x8B60, 0xB1C8, 0xB1C8, 0xB0E0,
+  0xB1C8, 0xB0E0, 0xB0E0, 0xB0E0, 0xB0E0, 0xB0E0, 0xB0E0, 0xB0E0,
+  0xAEE0, 0xAEE8, 0xAEC8, 0xAEE0, 0xACE0, 0xACE8, 0xAAE0, 0xACE0,
+  0xC6C0, 0x0000, 0x0000, 0x0000, 0x0000, 0x06E1, 0x06E9, 0x65E1,
+  0xE490, 0x460D, 0x001F, 0x8450, 0x65FB, 0x65FB, 0x85EA, 0x65C1,
+  0x0000, 0x0000, 0x0000, 0x06E9, 0x65E1, 0x65E1, 0x08E1, 0xC490,
+  0x0000, 0x0000, 0x8B98, 0xAAE8, 0xA8E8, 0xAAE0, 0xAAE0, 0xACE0,
+  0xAEC8, 0xAEE8, 0xACE0, 0xAEE0, 0xAEE8, 0xB0E0, 0xAEE0, 0x0000,
+  0xB1C8, 0x8EC8, 0x463D, 0x001E, 0xD1A8, 0xB1B0, 0x0000, 0xB1C8,
+  0xB0E0, 0xB1C8, 0xB0E8, 0xB0E0, 0xB0E0, 0xAEC8, 0xB0E0, 0xAEE0,
+  0xAEE8, 0xAEE0, 0xAEE0, 0x8EC8, 0x0000, 0x0000, 0x8B98, 0xAAE8,
+  0xAAE0, 0xA8E8, 0xAAE0, 0x0000, 0x0000, 0x0000, 0x8450, 0x08E1,
+  0x65E9, 0x45E1, 0x470E, 0x001E, 0x85FC, 0x65F3, 0x65FB, 0xE490,
+  0x0000, 0x0000, 0x0000, 0xA6E1, 0xC5E9, 0x65E1, 0x06E9, 0x0000,
+  0x0000, 0xC490, 0xE7E0, 0xC8E0, 0xAAE8, 0xC498, 0xE490, 0xAAE0,
+  0xACE0, 0xACE0, 0xAEE8, 0x0000, 0x8EC8, 0xAEE0, 0xAEE8, 0x8B98,
+  0xB0E8, 0x4220, 0x473E, 0x001D, 0xB0E8, 0x4218, 0x6B98, 0xB0E0,
+  0xB1C8, 0x4218, 0xB0E0, 0xB0E0, 0xB0E0, 0xAEE8, 0xAEC8, 0x6B98,
+  0xAEE8, 0xAEE0, 0xAEE8, 0x8B98, 0x0000, 0x0000, 0x6B98, 0xAAE0,
+  0xAAE8, 0xC8E8, 0x0000, 0x0000, 0x0000, 0x4218, 0x45E1, 0x65E9,
+  0xC5E9, 0x480E, 0x001D, 0x84CB, 0x85F4, 0x65F3, 0xA39A, 0x0000,
+  0x0000, 0x0000, 0xA6E9, 0x65E1, 0x45E1, 0x06E9, 0xE490, 0x8450,
+  0xE7E8, 0xC8E8, 0xA8E0, 0x8B98, 0x0000, 0x8AC8, 0xAAE8, 0xAAE0,
+  0x8450, 0x0000, 0x8BA0, 0xACE0, 0xAEE8, 0xAEE0, 0xAEE0, 0x8EC8,
+  0x483E, 0x001D, 0xB1C8, 0xB0E0, 0xAEE8, 0xB0E0, 0xAEE0, 0x8B58,
+  0x0000, 0x8B60, 0xAEE8, 0xAEE0, 0xAEC8, 0x0000, 0x6B98, 0xACE8,
+  0xACE0, 0xACE8, 0x4218, 0xE490, 0xA8E8, 0xAAE0, 0xC8E8, 0xA8E0,
+  0x0000, 0x0000, 0x0000, 0xE490, 0x27D1, 0x45E9, 0x85C1, 0x490E,
+  0x001D, 0x84CB, 0x85FC, 0x64CA, 0xC39A, 0xE490, 0x0000, 0x0000,
+  0x0000, 0xC5E9, 0xA6E1, 0x65E1, 0x06E9, 0x65E1, 0x06E1, 0x06E9,
+  0xE498, 0x0000, 0x8450, 0xAAE0, 0xAAE8, 0x0000, 0x0000, 0x8EC8,
+  0xACE0, 0xACE0, 0xACE8, 0x8B98, 0xAEE8, 0x6B98, 0x493E, 0x001D,
+  0x8B98, 0xB0E0, 0xB1C8, 0xAEE8, 0xB0E0, 0xAEE0, 0x6B98, 0x0000,
+  0x0000, 0xAEE8, 0xAEE8, 0x4218, 0x0000, 0xE490, 0xACE0, 0xAAE8,
+  0xAAE0, 0x8AC8, 0xC8E0, 0xA8E0, 0xE7E8, 0xE498, 0x0000, 0x0000,
+  0x0000, 0xC490, 0x65E1, 0xC5E9, 0x65C1, 0x4A0E, 0x001C, 0x6450,
+  0x85FD, 0x65FB, 0x8450, 0x64CA, 0x0000, 0x0000, 0x0000, 0x65C9,
+  0xC5E9, 0x65E1, 0x45E9, 0x06E1, 0x26E1, 0xE490, 0xC6C0, 0xA8E8,
+  0xE7E0, 0xC8E0, 0xA8E8, 0x8B98, 0xAAE0, 0xAAE8, 0xACE0, 0x8450,
+  0x0000, 0xACE8, 0xACE0, 0x4A40, 0x001A, 0xAEE8, 0x0000, 0x8B58,
+  0xAEE8, 0xAEE0, 0xACE0, 0x0000, 0xAEE0, 0xACE8, 0xACE0, 0x8EC8,
+  0x0000, 0x8450, 0xAAE8, 0xC8E8, 0xA8E0, 0xC8E0, 0xE7E0, 0xA8E8,
+  0x0000, 0x0000, 0x0000, 0xE490, 0xC490, 0x85C1, 0xC5E9, 0x4B0F,
+  0x001B, 0x65FD, 0x85FD, 0x8450, 0xA39A, 0x65F3, 0x85F2, 0x0000,
+  0x85EA, 0xC5E9, 0xC5E9, 0xA6E1, 0xC5E9, 0x65E1, 0x65E9, 0x06E1,
+  0x26E1, 0xE7E0, 0x0000, 0x8AC8, 0xAAE8, 0xC8E0, 0x8AC8, 0x0000,
+  0x0000, 0xAAE0, 0xACE8, 0x8458, 0x4B3F, 0x001B, 0x8450, 0xAEE8,
+  0xAEE0, 0x0000, 0x0000, 0xAAE0, 0xACE0, 0xAEE8, 0xACE8, 0x8450,
+  0x8AC8, 0x08E1, 0xAAE0, 0xAAE0, 0xC8E8, 0xAAE0, 0xA8E0, 0xE7E0,
+  0xE7E8, 0x08E1, 0x0000, 0x8458, 0xE498, 0x65C1, 0x4218, 0xC5E9,
+  0xC5F1, 0x4C0F, 0x001A, 0x85FC, 0x65FC, 0x65F3, 0x0000, 0xA39A,
+  0x85F2, 0x65F3, 0x85EA, 0x6450, 0x0000, 0xE498, 0x0000, 0x45E9,
+  0x65E1, 0x45E1, 0xC6C0, 0x0000, 0x0000, 0x8AC8, 0xC8E8, 0x8450,
+  0x0000, 0x8458, 0xC8E8, 0xAAE0, 0x6B98, 0x4C40, 0x001A, 0x8B98,
+  0xAEE8, 0xACE8, 0x0000, 0x0000, 0x8450, 0xAAE8, 0xAAE0, 0x0000,
+  0x0000, 0x8AC8, 0xAAE0, 0xC8E8, 0xA8E0, 0x8450, 0x8458, 0x0000,
+  0x4218, 0x08E9, 0x06E9, 0xC6C0, 0xE490, 0x0000, 0x8458, 0xC5E9,
+  0x64CA, 0x4D0F, 0x001A, 0xA39A, 0x65FD, 0x85FC, 0x0000, 0x0000,
+  0xC39A, 0x65F3, 0xA39A, 0x0000, 0x0000, 0x0000, 0x0000, 0x65E1,
+  0xC5E9, 0x65E1, 0x0000, 0x0000, 0x06E9, 0xE7E8, 0x0000, 0x0000,
+  0x4218, 0xA8E0, 0xAAE0, 0xC8E0, 0xAAC8, 0x4D40, 0x001A, 0xACE8,
+  0xACE0, 0x8AC8, 0xACE8, 0x8450, 0x0000, 0x0000, 0xAAE0, 0xACE8,
+  0x0000, 0x0000, 0xA8E0, 0xE7E0, 0xC8E8, 0x0000, 0x0000, 0x0000,
+  0x0000, 0xC490, 0x65E9, 0x65C1, 0x0000, 0x0000, 0xC490, 0x85F2,
+  0xE490, 0x4E10, 0x0018, 0x85FD, 0x85FD, 0x0000, 0x65F4, 0x65F3,
+  0xC490, 0x0000, 0x0000, 0x0000, 0x0000, 0x85C9, 0xC5E9, 0x45E1,
+  0xE490, 0x0000, 0x45E9, 0xC6C0, 0x0000, 0x0000, 0x0000, 0x8AC8,
+  0xC8E0, 0xC8E0, 0xA8E8, 0x4E41, 0x0018, 0xACE0, 0xAAE0, 0x8AC8,
+  0xAEC8, 0x4218, 0x0000, 0x0000, 0xC8E8, 0xA8E8, 0x0000, 0x8450,
+  0xC8E8, 0xE7E0, 0xC6C0, 0x0000, 0x0000, 0x0000, 0x0000, 0xC490,
+  0x65E9, 0x65C1, 0x0000, 0x85F2, 0x85EA, 0x4F10, 0x0018, 0x65FD,
+  0x85FD, 0x65FD, 0x85FC, 0x85FC, 0x6450, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x85EA, 0x65F2, 0x85F2, 0x8450, 0xC5E9, 0x65E1, 0x0000,
+  0x0000, 0x0000, 0xE7E8, 0x26E1, 0xE7E0, 0x08E1, 0xC6C0, 0x4F41,
+  0x0018, 0x8AC8, 0x08E1, 0xAAE0, 0xAAE8, 0xA8E0, 0x0000, 0x0000,
+  0x0000, 0xC8E0, 0x08E1, 0x0000, 0x08E1, 0xE7E0, 0x45E9, 0xC490,
+  0x0000, 0x0000, 0x0000, 0x0000, 0xC5E1, 0xC5E9, 0x85F2, 0x65F2,
+  0x65F3, 0x5010, 0x0017, 0xA39A, 0x85FE, 0x65F5, 0xA39A, 0x85FC,
+  0x85FC, 0x84CB, 0x64CA, 0x64CA, 0x65F3, 0x65EA, 0x0000, 0xC5E9,
+  0xC5E9, 0x65C1, 0x0000, 0x0000, 0x0000, 0xE490, 0x06E9, 0x06E1,
+  0x26E1, 0xE7E0, 0x5042, 0x0017, 0xC8E8, 0xA8E0, 0xC8E0, 0xA8E0,
+  0x8B98, 0x0000, 0x0000, 0x0000, 0xC6C0, 0x08E1, 0x06E9, 0xE490,
+  0xC6C0, 0x45E9, 0xC6C0, 0xE490, 0xC490, 0xC5E9, 0xC5E9, 0x4218,
+  0x64CA, 0x65FB, 0xE490, 0x5111, 0x0016, 0x65FE, 0x85FD, 0x84CB,
+  0x85FD, 0x84CB, 0x65F3, 0xA39A, 0x85FC, 0x65FB, 0x0000, 0x6450,
+  0x65F3, 0x85F2, 0x85EA, 0xC5E9, 0xC5E9, 0x45E1, 0x65E1, 0x45E9,
+  0x65E1, 0x06E9, 0xE490, 0x5142, 0x0016, 0xC6C0, 0xA8E0, 0xE7E0,
+  0xC8E0, 0xE7E8, 0xC8E0, 0x27D1, 0xC6C0, 0x27D1, 0x06E9, 0x65E1,
+  0x06E1, 0x0000, 0x45E1, 0xC5E9, 0xC490, 0xC5E9, 0xC5E9, 0x85F2,
+  0x64CA, 0x65F3, 0x65FB, 0x5211, 0x0015, 0x65F6, 0x65FD, 0x0000,
+  0xA39A, 0x4232, 0xA39A, 0x85FC, 0x65FB, 0xA362, 0x0000, 0x65F3,
+  0x85F2, 0x65F2, 0x85EA, 0x65F2, 0xC5E9, 0xC5E1, 0x45E1, 0xC5E9,
+  0x65E1, 0x45E1, 0x5243, 0x0015, 0xE7E8, 0xC8E0, 0xE7E0, 0xE7E0,
+  0x06E9, 0x08E1, 0x06E1, 0x26E1, 0x65E1, 0x45E9, 0xA6E1, 0x0000,
+  0x8450, 0xC5E9, 0x84CA, 0x65C1, 0xE498, 0xC490, 0x8458, 0x65FB,
+  0x65F3, 0x5311, 0x0014, 0xA362, 0x65FE, 0x85FD, 0x65FD, 0x84CC,
+  0x65F5, 0x85FC, 0x65F4, 0x0000, 0x85FC, 0x65FB, 0x64CA, 0x85C1,
+  0x64CA, 0x65C1, 0x85EA, 0xC5E9, 0x85F2, 0xC5E9, 0xC5F1, 0x5343,
+  0x0014, 0x8450, 0x06E1, 0x06E1, 0x65E9, 0x06E1, 0x65E1, 0xC6C0,
+  0xC6C0, 0x65C1, 0x65C1, 0xC5E9, 0xC5E9, 0x0000, 0x85EA, 0x85F2,
+  0x65FB, 0xC490, 0x65F3, 0x65FB, 0x85FC, 0x5412, 0x0013, 0x65FD,
+  0x85FE, 0x65F5, 0x65FE, 0x65FD, 0x8450, 0xA39A, 0x85FC, 0x85FC,
+  0x65F3, 0x64CA, 0x64CA, 0x65F2, 0x65F3, 0x85F2, 0x65EA, 0xC5E9,
+  0xC5E9, 0xC490, 0x5444, 0x0013, 0xC6C0, 0x65E1, 0x06E1, 0x65E9,
+  0x45E1, 0xC5E9, 0x65E1, 0x65C1, 0xE490, 0xC5E9, 0xC5E9, 0x65C1,
+  0x85C1, 0xC490, 0x85F2, 0x65FB, 0x65F3, 0x85FC, 0x84CB, 0x5512,
+  0x0012, 0xA362, 0x85FE, 0x25FF, 0x84CC, 0xA39A, 0x8450, 0x65FD,
+  0x85FD, 0xC39A, 0xC490, 0x65FC, 0x65F3, 0x85FC, 0x65F3, 0x65F3,
+  0x65F2, 0x85EA, 0xC5E9, 0x5545, 0x0012, 0x65E1, 0xC5E9, 0x45E1,
+  0xC5E9, 0xC5E1, 0xC5E9, 0xC5E9, 0x85F2, 0x65C9, 0x8450, 0x85F2,
+  0x65FB, 0xC490, 0xA362, 0x64CA, 0x65F4, 0x85FC, 0x2232, 0x5613,
+  0x0010, 0x65FE, 0x65FE, 0x0000, 0xE59C, 0x64CC, 0x65FD, 0x85FD,
+  0xA39A, 0x85FD, 0x65F4, 0x85FC, 0x65F3, 0x65FC, 0x65F3, 0x65F3,
+  0x85F2, 0x5646, 0x0010, 0xA6E1, 0xC5E9, 0xC5E9, 0x85EA, 0xC5E9,
+  0x65EA, 0x85F2, 0x65EA, 0xC490, 0x84CB, 0x65FB, 0x64CA, 0xE490,
+  0xA39A, 0x85FC, 0x85FC, 0x5713, 0x000F, 0x4218, 0x25F7, 0x65FE,
+  0x65FE, 0x65F6, 0x65FE, 0x64CC, 0x85FE, 0x65FD, 0x85F5, 0x65FC,
+  0x85FD, 0x65F4, 0x85FC, 0x65F3, 0x5747, 0x000E, 0xC5E9, 0x65EA,
+  0x85F2, 0x65F3, 0x65F2, 0x65F3, 0x65F3, 0x85FC, 0x65F3, 0x65F4,
+  0x85FC, 0x65F4, 0x85FC, 0x65F5, 0x5814, 0x000D, 0x84CB, 0x25FF,
+  0x65FE, 0x65FE, 0x65F6, 0x65FE, 0x65FD, 0x85FD, 0x65F5, 0x85FD,
+  0x65FC, 0x85F4, 0x65FC, 0x5848, 0x000D, 0x65C1, 0x65F3, 0x85F2,
+  0x65F3, 0x65F3, 0x65F3, 0x65F3, 0x85FC, 0x65F3, 0x65FC, 0x85F4,
+  0x65FD, 0xA362, 0x5915, 0x000B, 0x65CD, 0x25F7, 0x65FE, 0x25F7,
+  0x65FE, 0x85FE, 0x65F5, 0x65FE, 0x85FD, 0x65FD, 0x85FC, 0x5949,
+  0x000B, 0xC490, 0x65F3, 0x65F3, 0x85FC, 0x65F4, 0x85FC, 0x65F4,
+  0x85FD, 0x65FD, 0x85FD, 0x84CB, 0x5A16, 0x0009, 0xE59C, 0x25F7,
+  0x65FE, 0x25F7, 0x65FE, 0x65FE, 0x65FD, 0x85FD, 0xA362, 0x5A4A,
+  0x0009, 0x6450, 0x85FC, 0x85FC, 0x65FC, 0x85F4, 0x65FD, 0x85FD,
+  0x65FD, 0xA39A, 0x5B17, 0x0006, 0x2232, 0x65FE, 0x65FE, 0x85FE,
+  0x85FD, 0xA39A, 0x5B4C, 0x0006, 0xA39A, 0x84CC, 0x65FD, 0x85FD,
+  0x85CD, 0x8450, 0x0006, 0x0005, 0x2A15, 0x0A15, 0x2A15, 0xC834,
+  0x223A, 0x005E, 0x0006, 0x423A, 0xA84D, 0x492D, 0x692D, 0xC83C,
+  0xC834, 0x0104, 0x0009, 0xC83C, 0xEA04, 0xEA04, 0xEA04, 0xEA04,
+  0xEA04, 0x692D, 0xC834, 0x2232, 0x015C, 0x0009, 0xA362, 0xA66C,
+  0xA855, 0x2A15, 0xEA04, 0xEA04, 0xEA04, 0x0A15, 0xA855, 0x0203,
+  0x000C, 0x0A15, 0xEA04, 0xEA04, 0xEA04, 0xEA04, 0xEA04, 0xEA04,
+  0xEA04, 0xEA04, 0xEA04, 0x2A15, 0xC83C, 0x025A, 0x000C, 0xE59C,
+  0x286E, 0x492D, 0x492D, 0x2A15, 0x0A15, 0xEA04, 0xEA04, 0xEA04,
+  0xEA04, 0xEA04, 0x692D, 0x0302, 0x0010, 0x0A15, 0xEA04, 0xEA04,
+  0xEA04, 0xEA04, 0xEA04, 0xEA04, 0xEA04, 0xEA04, 0xEA04, 0xEA04,
+  0xEA04, 0xEA04, 0xEA04, 0x492D, 0xA664, 0x0357, 0x0010, 0xE59C,
+  0xC7AE, 0x6786, 0x6786, 0x086E, 0x286E, 0xA84D, 0xA855, 0x692D,
+  0x0A15, 0xEA04, 0xEA04, 0xEA04, 0xEA04, 0xEA04, 0xA855, 0x0401,
+  0x0013, 0x423A, 0xEA04, 0xEA04, 0xEA04, 0xEA04, 0xEA04, 0xEA04,
+  0xEA04, 0xEA04, 0xEA04, 0xEA04, 0xEA04, 0xEA04, 0xEA04, 0x0A15,
+  0x2A15, 0x492D, 0x692D, 0xE5A4, 0x0455, 0x0013, 0x65CD, 0xC7A6,
+  0xC7A6, 0xA7AE, 0xC7A6, 0x6786, 0x6786, 0x086E, 0xA84D, 0x492D,
+  0x692D, 0x0A15, 0x2A15, 0xEA04, 0xEA04, 0xEA04, 0xEA04, 0xEA04,
+  0x223A, 0x0501, 0x0015, 0x0A15, 0xEA04, 0xEA04, 0xEA04, 0xEA04,
+  0xEA04, 0xEA04, 0xEA04, 0xEA04, 0xEA04, 0xEA04, 0xEA04, 0xEA04,
+  0x2A15, 0x0A15, 0xA855, 0xA84D, 0x086E, 0x2866, 0x6786, 0xE59C,
+  0x0553, 0x0015, 0x65CD, 0x25FF, 0x26CF, 0x26CF, 0x26CF, 0x26D7,
+  0xC7A6, 0xA7AE, 0x6786, 0x6786, 0x286E, 0x286E, 0xA84D, 0xA855,
+  0x492D, 0x2A0D, 0xEA04, 0xEA04, 0xEA04, 0xEA04, 0xA66C, 0x0600,
+  0x0018, 0x4218, 0x2A15, 0xEA04, 0xEA04, 0x0A15, 0x0000, 0x692D,
+  0xEA04, 0xEA04, 0xEA04, 0xEA04, 0xEA04, 0xEA04, 0x0A15, 0x2A15,
+  0x492D, 0x6935, 0xA855, 0x286E, 0x6786, 0x6786, 0xA7A6, 0xC7A6,
+  0x65D5, 0x0651, 0x0018, 0x65FC, 0x85FE, 0x25F7, 0x25F7, 0x25F7,
+  0x26CF, 0x25FF, 0x26CF, 0x26CF, 0xA7A6, 0xC7A6, 0x6786, 0x6786,
+  0x086E, 0x286E, 0x492D, 0x492D, 0x2A15, 0xA66C, 0x0000, 0xEA04,
+  0xEA04, 0x492D, 0x4218, 0x0701, 0x0019, 0xEA04, 0xEA04, 0xEA04,
+  0xEA04, 0xC83C, 0xA84D, 0x492D, 0xEA04, 0xEA04, 0xA855, 0x4232,
+  0x492D, 0xA66C, 0x086E, 0xA84D, 0x286E, 0x0866, 0x6786, 0x6786,
+  0xC7A6, 0xA7A6, 0x26D7, 0x46CF, 0x25F7, 0x64CC, 0x074F, 0x001A,
+  0x65F3, 0x65FE, 0x65FE, 0x25F7, 0x25F7, 0x25FF, 0x25F7, 0x25F7,
+  0x25F7, 0x25FF, 0x26CF, 0x26D7, 0xA7A6, 0xC7A6, 0x6786, 0xE59C,
+  0x086E, 0x286E, 0xA855, 0xA84D, 0xA664, 0xA66C, 0xEA04, 0xEA04,
+  0x2A15, 0xA66C, 0x0800, 0x001C, 0x2A15, 0xEA04, 0xEA04, 0xEA04,
+  0xEA04, 0x0A15, 0xEA04, 0x0000, 0x692D, 0xEA04, 0xC83C, 0x0000,
+  0xA66C, 0x286E, 0x0000, 0xE59C, 0x086E, 0x6786, 0x6786, 0xC7A6,
+  0xA7A6, 0x26D7, 0x26CF, 0x26D7, 0x26CF, 0x25F7, 0x65FE, 0x84CB,
+  0x084D, 0x001C, 0x64CA, 0x65FC, 0x85FD, 0x65F5, 0x85FE, 0x65FE,
+  0x65FE, 0x65F6, 0x25F7, 0x65FE, 0x25F7, 0x26CF, 0x25FF, 0xA362,
+  0x0000, 0x65CD, 0x65CD, 0x0000, 0x6786, 0x286E, 0x286E, 0xA39A,
+  0x492D, 0x2A15, 0x0A15, 0xEA04, 0xEA04, 0xA66C, 0x0900, 0x001E,
+  0x692D, 0xEA04, 0xEA04, 0xEA04, 0xEA04, 0x0000, 0xC83C, 0xEA04,
+  0xEA04, 0xEA04, 0x492D, 0x0000, 0x2232, 0x286E, 0x0000, 0x0000,
+  0x6786, 0x6786, 0xA7A6, 0xE59C, 0x26CF, 0x26CF, 0x25F7, 0x25FF,
+  0x25F7, 0x25F7, 0x25F7, 0x65FE, 0x85FE, 0xC39A, 0x094B, 0x001E,
+  0xC490, 0x65FC, 0x85F4, 0x65FC, 0x85F4, 0x65FD, 0x65FD, 0x65FE,
+  0x85FE, 0x25F7, 0x65FD, 0x65CD, 0x25F7, 0x25FF, 0x85FE, 0x0000,
+  0x64CB, 0x86D6, 0x0000, 0x4218, 0x6786, 0x6786, 0x086E, 0x286E,
+  0x4218, 0x286E, 0x0A15, 0x2A15, 0xEA04, 0xA84D, 0x0A00, 0x001F,
+  0x0A15, 0xEA04, 0xEA04, 0xEA04, 0xEA04, 0xA855, 0x0000, 0xA36A,
+  0xEA04, 0x2A0D, 0x0A15, 0x692D, 0xA855, 0xA84D, 0xE5A4, 0x0000,
+  0xE59C, 0xE59C, 0xC7AE, 0x26CF, 0x64CC, 0x65CD, 0x46D7, 0x25F7,
+  0x25F7, 0x25FF, 0x65FE, 0x65FE, 0x65F5, 0x65FE, 0x65FC, 0x0A4A,
+  0x001F, 0x85F2, 0x65FB, 0x65F3, 0x65F3, 0x65F3, 0x65FC, 0x85FC,
+  0x65F5, 0x85FD, 0x65FE, 0x65F3, 0x65FC, 0x85F6, 0x65FD, 0x64CC,
+  0x85FD, 0x0000, 0x65FE, 0x86CE, 0x65CD, 0xC7A6, 0xA7A6, 0x6786,
+  0x6786, 0x0000, 0x0000, 0xA664, 0x492D, 0x2A15, 0x0A15, 0xC834,
+  0x0B00, 0x0021, 0x692D, 0xEA04, 0xEA04, 0xEA04, 0xEA04, 0x0A15,
+  0xA855, 0xA66C, 0x692D, 0x0A15, 0x692D, 0x492D, 0xA855, 0xA84D,
+  0x6786, 0xE59C, 0xE59C, 0x0000, 0x26CF, 0x26CF, 0x25FF, 0x0000,
+  0xE59C, 0x25F7, 0x25F7, 0x65FE, 0x25F7, 0x65F6, 0x65FE, 0x85FD,
+  0x65FD, 0x85F4, 0x64CA, 0x0B48, 0x0021, 0x65C1, 0xC5E9, 0x85F2,
+  0x65EA, 0x65FB, 0x65F3, 0x85F4, 0x65FC, 0x85F4, 0x65FC, 0x85FD,
+  0x6458, 0xA362, 0x85FE, 0x25FF, 0xC39A, 0xA39A, 0x64CB, 0xE59C,
+  0x25F7, 0x25FF, 0x26CF, 0x26D7, 0xC7A6, 0xA7A6, 0x6786, 0xC7A6,
+  0xE5A4, 0xA855, 0x692D, 0x492D, 0x2A15, 0xA855, 0x0C00, 0x0022,
+  0x492D, 0xEA04, 0xEA04, 0xEA04, 0xEA04, 0xEA04, 0x2A15, 0xA855,
+  0x0A15, 0x692D, 0xA66C, 0xA664, 0xE59C, 0x6786, 0x286E, 0xA7AE,
+  0xC7A6, 0x0000, 0x66D6, 0x64CC, 0x86CE, 0x25FF, 0x86CE, 0x65FE,
+  0x6450, 0x85FE, 0x65FD, 0x65FD, 0x85FD, 0x65FD, 0x85FC, 0x65F4,
+  0x65F3, 0x85F2, 0x0C47, 0x0022, 0xE8E0, 0x65E1, 0xC5E9, 0xC5E9,
+  0x85EA, 0x65F2, 0x85EA, 0x65F2, 0x65F3, 0x85EA, 0x64CA, 0x65F3,
+  0x65FB, 0x65FD, 0x85CD, 0x64CC, 0x65F3, 0x4218, 0x25FF, 0x25F7,
+  0x25F7, 0x86D6, 0x64CC, 0xA39A, 0x86CE, 0xC7A6, 0xC7A6, 0xE59C,
+  0x086E, 0xA84D, 0xA855, 0x492D, 0x2A15, 0xC834, 0x0D00, 0x0023,
+  0xA84D, 0xEA04, 0xEA04, 0xEA04, 0xEA04, 0xEA04, 0xC834, 0xA66C,
+  0x492D, 0x492D, 0x286E, 0xE59C, 0x6786, 0x6786, 0xC7A6, 0xA39A,
+  0x26CF, 0x26D7, 0x25F7, 0x65CD, 0x0000, 0x85FE, 0x25F7, 0x65FD,
+  0x64CA, 0x85FD, 0x4218, 0x64CC, 0x85FD, 0x65F4, 0x85FC, 0x65F3,
+  0x65F3, 0x85F2, 0x85EA, 0x0D46, 0x0023, 0x06E9, 0x06E1, 0x65E1,
+  0x45E1, 0xC5E9, 0xC5E9, 0x85EA, 0x85F2, 0xA6E1, 0xA6E1, 0x85F2,
+  0xC490, 0x65FC, 0x85F4, 0x65FD, 0x0000, 0x85F4, 0x65FD, 0x65FE,
+  0x65FE, 0x65FD, 0x65FE, 0x85FE, 0x64CC, 0xE59C, 0x66CE, 0x26D7,
+  0xC7A6, 0xA36A, 0xE59C, 0x286E, 0xA855, 0xA84D, 0x492D, 0xE5A4,
+  0x0E00, 0x0024, 0x423A, 0x492D, 0xEA04, 0xEA04, 0xEA04, 0xEA04,
+  0xA66C, 0x0000, 0x2A15, 0xA84D, 0x0000, 0x0000, 0x0000, 0xA3A2,
+  0x6786, 0x0000, 0x85CD, 0x86D6, 0x26CF, 0x25FF, 0x0000, 0x0000,
+  0x65FE, 0x65FE, 0x65F5, 0x65FD, 0x85FD, 0x65F4, 0x85FC, 0x65F4,
+  0x65F3, 0x65FB, 0x85EA, 0x65F2, 0xC5E9, 0xC5E9, 0x0E45, 0x0024,
+  0x08E1, 0xE7E0, 0x06E1, 0x06E1, 0x65E1, 0x65E1, 0xC5E9, 0xA6E1,
+  0xC5E9, 0xA6E1, 0x85F2, 0x85F2, 0x65F3, 0x65F3, 0x85FC, 0x0000,
+  0x0000, 0x65F4, 0x85FE, 0x65FD, 0x64CC, 0x0000, 0x85F5, 0x0000,
+  0x0000, 0x0000, 0xE59C, 0xC7A6, 0x66D6, 0x0000, 0xC7A6, 0x0866,
+  0x286E, 0xA84D, 0x086E, 0x4218, 0x0F01, 0x0024, 0xC834, 0xEA04,
+  0xEA04, 0xEA04, 0xEA04, 0x492D, 0x0000, 0x492D, 0xA855, 0x6786,
+  0xE59C, 0xC7A6, 0xA7A6, 0x46CF, 0x65CD, 0x25FF, 0xA362, 0x25F7,
+  0x25F7, 0x65FE, 0x0000, 0x65F5, 0x65FE, 0x85FE, 0x65FD, 0x85F4,
+  0x65FB, 0x65F3, 0x65EA, 0x65F3, 0x85F2, 0x85EA, 0xC5E9, 0x85F2,
+  0xC5E9, 0xA6E1, 0x0F44, 0x0024, 0xAAE0, 0xC8E0, 0x08E1, 0xE7E8,
+  0x06E1, 0x06E1, 0x65E1, 0x65E9, 0xA6E1, 0x45E1, 0xC5E1, 0xC5E9,
+  0x65F2, 0x85F2, 0x65F3, 0x0000, 0x0000, 0x65F4, 0x85FD, 0x84CB,
+  0x65F3, 0x65FC, 0x84CB, 0x65F6, 0x85FD, 0x65FD, 0x84CC, 0x64CC,
+  0x26D7, 0x66D6, 0x0000, 0xC7A6, 0x6786, 0x086E, 0x286E, 0xA66C,
+  0x1002, 0x0024, 0x2A15, 0xEA04, 0xEA04, 0x0A15, 0x2A15, 0x492D,
+  0x6935, 0xA855, 0xA84D, 0x6786, 0xA3A2, 0xE59C, 0xC7A6, 0x26D7,
+  0x65CD, 0x84CC, 0x64CC, 0x85FE, 0x65FE, 0x65FC, 0x6450, 0x85FD,
+  0x85FD, 0x65FC, 0x64CA, 0x0000, 0x0000, 0x0000, 0x0000, 0x85EA,
+  0xC5E9, 0xC5E9, 0x45E1, 0x45E1, 0x06E1, 0x08E1, 0x102C, 0x0002,
+  0xAAC8, 0xE490, 0x103B, 0x0002, 0x6BA0, 0x8AC8, 0x1043, 0x0024,
+  0xAAE0, 0xC8E8, 0xC8E0, 0xA8E0, 0xC8E0, 0xA8E8, 0xE7E0, 0xC8E0,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x27D1, 0xC5E9, 0x85F2, 0xA6E1,
+  0x0000, 0x65F3, 0x85FC, 0x65F3, 0x64CA, 0x65FC, 0x85F5, 0x65FD,
+  0x85FE, 0x64CB, 0x85FD, 0x25F7, 0x25F7, 0x26CF, 0x26CF, 0xC7A6,
+  0xA7A6, 0x6786, 0x6786, 0xE59C, 0x1102, 0x000D, 0xA66C, 0xEA04,
+  0xEA04, 0x2A15, 0x492D, 0x492D, 0x2866, 0xA66C, 0x6786, 0x6786,
+  0xA7A6, 0xC7A6, 0x85CD, 0x1114, 0x0013, 0x65CD, 0x65FE, 0x85F5,
+  0x65FD, 0x84CB, 0x0000, 0x85FC, 0x85F2, 0x0000, 0x0000, 0x0000,
+  0x4218, 0xC5E9, 0x45E1, 0x65E1, 0x26E9, 0x06E1, 0xE7E0, 0x08E1,
+  0x112C, 0x0002, 0xACE0, 0xACE8, 0x113B, 0x0002, 0xACE0, 0xAEE0,
+  0x1142, 0x0025, 0xACE0, 0xAAE8, 0xACE0, 0xAAE0, 0xAAE0, 0xA8E8,
+  0xC8E0, 0xC8E0, 0x0000, 0x0000, 0x0000, 0x0000, 0x06E1, 0x45E9,
+  0x0000, 0xA6E1, 0x85EA, 0x85F2, 0x65FB, 0xC490, 0x0000, 0x0000,
+  0x0000, 0x4218, 0xA39A, 0x65FD, 0x65FE, 0x85FE, 0x25F7, 0x65FD,
+  0x65CD, 0x86D6, 0x26D7, 0xA7A6, 0xC7A6, 0x6786, 0xA66C, 0x1203,
+  0x000D, 0x492D, 0xEA04, 0x2A15, 0x492D, 0x286E, 0x0000, 0x0000,
+  0x0000, 0x0000, 0xA36A, 0x26D7, 0x26CF, 0x2232, 0x1215, 0x0013,
+  0x85FC, 0x65FD, 0x85FD, 0x65F3, 0x0000, 0x0000, 0x65F3, 0x65F2,
+  0x0000, 0x0000, 0x0000, 0x8450, 0x45E9, 0x08E1, 0x27D1, 0xE7E8,
+  0xE7E0, 0xC8E0, 0xAAE0, 0x122D, 0x0001, 0xACE8, 0x123B, 0x001A,
+  0xAEE8, 0x8B98, 0x0000, 0x0000, 0x0000, 0x0000, 0x8EC8, 0xACE8,
+  0xACE0, 0xAAE8, 0xAAE0, 0xAAE0, 0xAAE0, 0xAAE8, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x08E1, 0x06E1, 0x8450, 0x0000, 0xC5E9, 0xC5E9,
+  0x85F2, 0xA6E1, 0x125B, 0x000B, 0x85FE, 0x85FE, 0x64CC, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x86CE, 0x26CF, 0xA7A6, 0xC7A6, 0x1303,
+  0x0005, 0xC834, 0x2A15, 0x0A15, 0xA84D, 0x2866, 0x130E, 0x0003,
+  0x25FF, 0x25F7, 0xA39A, 0x1316, 0x0019, 0x85F5, 0x65FC, 0x85FC,
+  0x65C1, 0x0000, 0x0000, 0x85F2, 0xC5E9, 0x8B98, 0x0000, 0x0000,
+  0x4218, 0x08E1, 0xAAE8, 0x6B98, 0xC8E0, 0xAAE8, 0xAAE0, 0x6B98,
+  0x0000, 0x0000, 0x0000, 0x0000, 0xAEE8, 0xAEC8, 0x133A, 0x0002,
+  0xB1D0, 0xB1C8, 0x1341, 0x0013, 0xAEE0, 0xAEE0, 0xACE8, 0xAEE0,
+  0xACE0, 0xACE0, 0xACE8, 0x0000, 0x0000, 0x0000, 0x8B98, 0x08E1,
+  0xA8E0, 0x0000, 0x0000, 0x08E1, 0x65E1, 0xC5E9, 0xC5E9, 0x1359,
+  0x0003, 0xC490, 0x65FD, 0x64CC, 0x1362, 0x0004, 0x65FE, 0x26D7,
+  0x26CF, 0xA36A, 0x1404, 0x002B, 0x0A15, 0x692D, 0x492D, 0x286E,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x6458, 0x85D5, 0x85D5, 0x25F7,
+  0x25FF, 0xA39A, 0x0000, 0x0000, 0x8450, 0x8458, 0x65FB, 0x85FC,
+  0x65F3, 0x65F3, 0xC490, 0x0000, 0x0000, 0x65C9, 0x65E1, 0x08E1,
+  0x0000, 0x0000, 0x0000, 0xAAE8, 0xA8E0, 0x8AC8, 0xAEC8, 0xAAE0,
+  0xAAE8, 0x0000, 0x0000, 0x0000, 0x0000, 0xD1A8, 0x8EC8, 0x143A,
+  0x002B, 0xAEC8, 0x6B98, 0x0000, 0x0000, 0x0000, 0x4218, 0xAEE8,
+  0xAEE8, 0xAEE8, 0xAEE0, 0xAEC8, 0xAEE0, 0xACE8, 0x0000, 0x0000,
+  0x0000, 0x8AC8, 0xAAE0, 0x8B98, 0x0000, 0x0000, 0xC6C0, 0x06E9,
+  0x65E1, 0x45E1, 0x27D1, 0x0000, 0x8458, 0x4218, 0x0000, 0x85C9,
+  0x85FC, 0x65FC, 0x85F4, 0x65F3, 0x6450, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x86D6, 0x46D7, 0xA7A6, 0x1504, 0x002C, 0xA84D, 0x492D,
+  0xA84D, 0x286E, 0x0000, 0x0000, 0x0000, 0xE59C, 0x85CD, 0x84CB,
+  0x2232, 0x0000, 0x65FE, 0x65FE, 0x65F6, 0x85FD, 0x65FD, 0x85F4,
+  0x65FC, 0x65F3, 0x65F3, 0x85F2, 0x85F2, 0xC6E1, 0x0000, 0x06E1,
+  0x65E1, 0x06E9, 0x06E1, 0xC8E0, 0x0000, 0x0000, 0x8AC8, 0xAAE0,
+  0xACE8, 0xACE0, 0xACE0, 0xACE0, 0x0000, 0x0000, 0x0000, 0x0000,
+  0xAEE8, 0x8BA0, 0x1539, 0x002C, 0x6B98, 0xB1C8, 0x0000, 0x0000,
+  0x0000, 0x0000, 0xB0E0, 0xB0E0, 0xB0E0, 0xB0E0, 0xAEE0, 0xB0E0,
+  0xAEC8, 0x0000, 0x0000, 0xACE0, 0xACE8, 0xACE0, 0xAAE8, 0x8B58,
+  0x0000, 0xAAE0, 0xE7E0, 0x26E9, 0x06E1, 0x45E1, 0x45E1, 0xC5E9,
+  0xC5E9, 0x85EA, 0x65F2, 0x65F3, 0x65FB, 0x0000, 0x84CB, 0x85FD,
+  0x85FD, 0xA39A, 0x0000, 0x0000, 0x2218, 0x25F7, 0x26D7, 0x86CE,
+  0x1604, 0x002C, 0xA66C, 0xA84D, 0xA855, 0x286E, 0xA36A, 0x0000,
+  0x65CD, 0x86D6, 0x0000, 0x0000, 0x0000, 0x0000, 0x65FD, 0x65FE,
+  0x65FD, 0x85F5, 0x65FC, 0x85F4, 0x65F3, 0x64CA, 0x4218, 0x65C9,
+  0xA6E1, 0xC5E9, 0x65E9, 0x45E1, 0x8AC8, 0x8450, 0xC8E8, 0xC8E0,
+  0xA8E8, 0xACE0, 0x0000, 0x0000, 0xACE0, 0xACE0, 0xACE8, 0xAEE0,
+  0xAEC8, 0x0000, 0x0000, 0x0000, 0xB1A8, 0xB1C8, 0x1639, 0x002C,
+  0xB1D0, 0x8B98, 0x0000, 0x0000, 0x0000, 0xB1B0, 0xB0E0, 0xB0E0,
+  0xB0E0, 0xB0E0, 0xB0E0, 0x0000, 0x0000, 0xAEC8, 0xAEE8, 0xACE0,
+  0xACE0, 0x6B98, 0xACE8, 0xAAE0, 0xAAE0, 0xC8E8, 0xA8E0, 0xC8E0,
+  0xA8E0, 0x27D1, 0x65E9, 0x45E1, 0xC5E9, 0xC5E9, 0x85EA, 0x85F2,
+  0x65C1, 0x0000, 0x0000, 0x0000, 0xA39A, 0x85FC, 0xA362, 0x0000,
+  0x84CC, 0x25F7, 0x25F7, 0x65CD, 0x1704, 0x002C, 0xE59C, 0xA84D,
+  0x286E, 0x286E, 0x65CD, 0x2232, 0x86CE, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x65FC, 0x25F7, 0x85FE, 0x65F5, 0x84CB, 0x85FC, 0x65F4,
+  0x85FC, 0x65FB, 0x85F2, 0x0000, 0x0000, 0x4218, 0x65E1, 0x06E9,
+  0x8AC8, 0x0000, 0x0000, 0x8B98, 0xAAE0, 0xAAE0, 0xACE0, 0xACE8,
+  0x8EC8, 0xAEE0, 0xAEE0, 0xAEE8, 0xB0E8, 0x8B60, 0x0000, 0x0000,
+  0x4218, 0xB1C8, 0x1738, 0x002D, 0x8B58, 0xD1B0, 0x0000, 0x0000,
+  0x0000, 0x4218, 0xB0E8, 0xB1C8, 0xB0E0, 0xB0E0, 0xB0E0, 0x4218,
+  0xB0E0, 0xB0E0, 0xB0E0, 0xAEE8, 0xB1C8, 0x0000, 0x0000, 0xACE0,
+  0xACE0, 0xAAE8, 0x8B98, 0x0000, 0x0000, 0xAAE0, 0x06E1, 0x06E9,
+  0x65E1, 0x45E1, 0xA6E1, 0x85F2, 0x65F3, 0x65F3, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x84CB, 0x65FC, 0x0000, 0x65FE, 0x25F7, 0x25FF,
+  0x84CC, 0x1804, 0x002D, 0xA36A, 0xA84D, 0xA84D, 0x678E, 0x6786,
+  0xA7A6, 0xE59C, 0x0000, 0x0000, 0x0000, 0x0000, 0x65FE, 0x65FE,
+  0x65FE, 0x64CC, 0x85FC, 0x0000, 0x65C1, 0x65F3, 0x65FB, 0x85EA,
+  0xC5E9, 0x6450, 0x0000, 0xE498, 0x06E9, 0xE7E0, 0xAAE0, 0x0000,
+  0x0000, 0x0000, 0xACE0, 0xACE8, 0xACE0, 0xAEC8, 0xAEE0, 0xAEE8,
+  0xB0E0, 0xB1C8, 0xB0E0, 0x0000, 0x0000, 0x0000, 0xB1A8, 0xD1A8,
+  0x1838, 0x002D, 0xD190, 0xD190, 0x0000, 0x0000, 0x0000, 0xB1C8,
+  0xD1B0, 0xD1A8, 0xB1C8, 0xB0E8, 0xB1C8, 0xB0E0, 0xB0E0, 0xB0E0,
+  0xAEE0, 0x8458, 0x0000, 0x4218, 0x8ED0, 0xACE8, 0xACE0, 0x8AC8,
+  0x0000, 0x8B58, 0xC8E8, 0xE7E0, 0xE7E0, 0x06E9, 0xC6C0, 0xC6C0,
+  0x08E1, 0xC5E9, 0x85EA, 0x65F3, 0x85F2, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x85F4, 0x84CB, 0x65FE, 0x25F7, 0x25F7, 0x6458, 0x1905,
+  0x002C, 0xA84D, 0x286E, 0x6786, 0xA7A6, 0xC7A6, 0x2232, 0x0000,
+  0x0000, 0x0000, 0xA362, 0x65FE, 0x85FE, 0x65FD, 0x85FC, 0x8450,
+  0x0000, 0x0000, 0x65C1, 0x85F2, 0x85F2, 0xC5E9, 0xC5E9, 0xC6C0,
+  0x6B98, 0xE7E0, 0x08E1, 0xC8E0, 0xAAE0, 0xAAE8, 0x6BA0, 0x4218,
+  0xAEE0, 0xAEE8, 0x8B60, 0x4218, 0xB0E0, 0xB0E0, 0xB0E0, 0xB1C8,
+  0xD1B0, 0x0000, 0x0000, 0x8B60, 0xB1D0, 0x1938, 0x002C, 0xD1B0,
+  0x4218, 0x0000, 0x0000, 0xD190, 0xB1A8, 0xD1B0, 0xB1A8, 0xB1C8,
+  0xB1D0, 0xF178, 0xB1A8, 0xB0E0, 0xB0E0, 0x0000, 0x4218, 0xB0E0,
+  0xAEE8, 0xAEE0, 0xACE0, 0xAEE8, 0x0000, 0x8B98, 0xAAE0, 0xAAE0,
+  0xA8E8, 0xE7E8, 0x8450, 0x0000, 0x0000, 0x27D1, 0xA6E1, 0x85F2,
+  0x65EA, 0x65F3, 0x0000, 0x0000, 0x0000, 0x0000, 0x84CB, 0x65FE,
+  0x65FE, 0x25FF, 0x45F7, 0x1A05, 0x002D, 0x086E, 0x286E, 0xA7A6,
+  0xC7A6, 0x26D7, 0x2218, 0x0000, 0x0000, 0x0000, 0x0000, 0x85FE,
+  0x65FD, 0x65FD, 0x85FC, 0x65F3, 0x6450, 0x0000, 0x0000, 0x85C9,
+  0xC5E9, 0xC5E9, 0x45E1, 0x06E1, 0xE7E8, 0xE7E0, 0xC8E0, 0xAAE0,
+  0xC8E8, 0xAAE0, 0xACE0, 0xAEE0, 0xACE8, 0xAEE0, 0xAEE0, 0x0000,
+  0x0000, 0x8B58, 0xB0E8, 0xB0E0, 0xB1C8, 0x0000, 0x0000, 0x0000,
+  0xD188, 0xF178, 0x1A37, 0x002D, 0xD178, 0xF178, 0x0000, 0x0000,
+  0x0000, 0xD190, 0xD1B0, 0xB1A8, 0xD1B0, 0x8B58, 0x0000, 0x0000,
+  0xB1D0, 0xB1C8, 0xB1C8, 0xB1C8, 0xB0E8, 0xAEE0, 0xB0E0, 0x8EC8,
+  0xAEE8, 0xACE0, 0xAEE0, 0xACE0, 0xACE8, 0xC8E0, 0xA8E0, 0x8450,
+  0x0000, 0x0000, 0x4218, 0x08E9, 0xC5E9, 0xC5E9, 0x85F2, 0x85F2,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x64CA, 0x65F5, 0x85FE, 0x65FE,
+  0x25F7, 0x1B05, 0x0005, 0x2866, 0x6786, 0xA7A6, 0x26CF, 0x46CF,
+  0x1B0F, 0x0023, 0x65FC, 0x65FE, 0x85F5, 0x65FD, 0x85FC, 0x65F4,
+  0x85F2, 0x85EA, 0xC6C0, 0xC5E9, 0x45E1, 0x65E9, 0x06E1, 0x08E1,
+  0xC8E0, 0xAAE0, 0xAAE8, 0xACE0, 0xACE0, 0xAEE0, 0xAEE8, 0xAEE0,
+  0xAEE0, 0xB0E8, 0xB1C8, 0x0000, 0x0000, 0x8B60, 0xB1C8, 0xB1C8,
+  0xB1B0, 0x0000, 0x0000, 0xF178, 0xD190, 0x1B37, 0x002D, 0xF178,
+  0x3149, 0x0000, 0x0000, 0xF178, 0xF188, 0xD190, 0xB1B0, 0x0000,
+  0x0000, 0x0000, 0xD1A8, 0xD1B0, 0xB1C8, 0xB1C8, 0xB0E0, 0xB0E0,
+  0xB0E0, 0xB0E0, 0xB0E0, 0xAEE0, 0xAEE0, 0xACE0, 0xAEE8, 0xACE0,
+  0xACE0, 0xAAE0, 0x0000, 0x8AC8, 0x08E1, 0x06E9, 0x65E1, 0x45E1,
+  0xC5E9, 0xC5E9, 0xA39A, 0x0000, 0x0000, 0x0000, 0x0000, 0x84CB,
+  0x65FE, 0x65FE, 0x25F7, 0x66CE, 0x1C05, 0x0005, 0x6786, 0x6786,
+  0xA7A6, 0xC7AE, 0x26CF, 0x1C0F, 0x0055, 0x65FE, 0x65FD, 0x65FD,
+  0x85FC, 0x65F4, 0x65F3, 0x65F3, 0xC5E9, 0xC5E9, 0x45E1, 0x65E1,
+  0x06E9, 0x08E1, 0xC8E0, 0xA8E0, 0xC8E0, 0xAAE8, 0xAAE0, 0xACE0,
+  0xACE0, 0xAEE8, 0xAEE0, 0xB0E0, 0xAEE0, 0xB0E0, 0x8B58, 0x0000,
+  0x0000, 0xB1D0, 0xB1A8, 0xD1B0, 0x0B19, 0x0000, 0x0000, 0xD178,
+  0x0B19, 0x0000, 0x0000, 0x0000, 0x0B21, 0x1161, 0x0000, 0x0000,
+  0x0B21, 0xF178, 0xD178, 0xF178, 0x1161, 0x0000, 0x0000, 0xD178,
+  0xD190, 0xD1B0, 0xD1A8, 0xB1D0, 0xB1C8, 0xB1C8, 0xB1C8, 0xB0E8,
+  0xAEE0, 0xB0E0, 0xAEE0, 0xAEE8, 0xACE0, 0xACE0, 0xAAE0, 0xAAE8,
+  0xA8E0, 0xC8E0, 0xA8E0, 0x06E9, 0x26E1, 0x65E1, 0x45E1, 0xC5E9,
+  0xA6E1, 0x0000, 0x0000, 0x0000, 0x0000, 0x85FB, 0x85FD, 0x65F6,
+  0x65FE, 0x65FC, 0x1D05, 0x005F, 0xA66C, 0xA7A6, 0xC7A6, 0x26CF,
+  0x26CF, 0x85CD, 0x0000, 0x0000, 0x0000, 0x65F4, 0x85FD, 0x65FC,
+  0x0000, 0x64CA, 0x65F3, 0x65F3, 0x85F2, 0x85EA, 0xC5E9, 0xC5E9,
+  0x26E1, 0x06E1, 0xE7E8, 0xE7E0, 0xA8E0, 0xAAE0, 0xACE8, 0xAEE0,
+  0xACE0, 0xAEE0, 0xAEE8, 0xB0E0, 0xB0E0, 0xB0E0, 0xB0E0, 0xB0E8,
+  0x4218, 0x0000, 0xD1A8, 0xF190, 0x8B60, 0xD190, 0x0000, 0x0000,
+  0x5149, 0x1169, 0x0000, 0x0000, 0x0000, 0x1161, 0x3149, 0x0000,
+  0x0000, 0x1161, 0x1169, 0x0000, 0x1161, 0xF178, 0x0000, 0x3149,
+  0xF188, 0xD190, 0xD190, 0xD1A8, 0xB1B0, 0xB1C8, 0xB1C8, 0xB0E0,
+  0xB0E0, 0xB0E0, 0xB0E0, 0xB0E0, 0xAEE0, 0xAEE0, 0xACE8, 0xACE0,
+  0xAAE0, 0xAAE0, 0xC8E8, 0xE7E0, 0xE7E0, 0x06E1, 0xC6C0, 0x27D1,
+  0xC5E9, 0x65F2, 0x4218, 0x0000, 0x0000, 0x0000, 0x85FC, 0x65FD,
+  0x65F6, 0x85FE, 0xA39A, 0x1E05, 0x0018, 0x2232, 0x6786, 0xC7AE,
+  0xC7A6, 0x26D7, 0x26CF, 0x65FD, 0x0000, 0x0000, 0x65FC, 0x85F6,
+  0x65C1, 0x0000, 0x0000, 0x0000, 0xA6E1, 0x85F2, 0xC5E9, 0xA6E1,
+  0x08E1, 0x08E1, 0xA8E0, 0x8AC8, 0xE490, 0x1E24, 0x003F, 0x8B60,
+  0xB0E8, 0xB0E0, 0xB0E0, 0xB1C8, 0xB1C8, 0xD190, 0xD1B0, 0x0000,
+  0x0000, 0xF178, 0x3149, 0x0000, 0x0000, 0x3149, 0x0B19, 0x0000,
+  0x0B21, 0x5149, 0x0000, 0x0000, 0x0B19, 0x3151, 0x5149, 0x0000,
+  0x3149, 0x1169, 0x8B60, 0x1161, 0xF178, 0xF178, 0xD190, 0xD190,
+  0xF178, 0x4218, 0x0000, 0x0000, 0x0000, 0x4218, 0x8BA0, 0x6BA0,
+  0xB1C8, 0xB1C8, 0xAEE8, 0xACE0, 0xACE8, 0xAAE0, 0xAAE0, 0xC8E0,
+  0xA8E8, 0x0000, 0x0000, 0x0000, 0xA6E1, 0xC5E9, 0xE490, 0x0000,
+  0x0000, 0x85F2, 0x85F4, 0x65FC, 0x85FD, 0x65F6, 0x1F06, 0x0011,
+  0xA7A6, 0xC7A6, 0x26D7, 0x26CF, 0x25F7, 0x25F7, 0x25F7, 0x65FD,
+  0x85FE, 0x65F5, 0x85FD, 0x65FC, 0x85F4, 0x65FB, 0x65F3, 0x85F2,
+  0xC5E9, 0x1F27, 0x001D, 0xB1B0, 0xB1C8, 0xD1B0, 0xD1B0, 0xD190,
+  0x4218, 0x0000, 0xF178, 0x1169, 0x0000, 0x0000, 0x3149, 0x9131,
+  0x0000, 0x9131, 0x5149, 0x0000, 0x0000, 0x9131, 0x3149, 0x0B19,
+  0x0000, 0x0B21, 0x1161, 0x1161, 0x1161, 0x1169, 0xF178, 0x0B19,
+  0x1F52, 0x0011, 0x8AC8, 0xAAE0, 0xAAE8, 0xA8E0, 0x08E1, 0x08E1,
+  0x65E1, 0x45E1, 0x85F2, 0xA6E1, 0x65F2, 0x65F3, 0x85F4, 0x65FC,
+  0x85FD, 0x65FD, 0x65FE, 0x2006, 0x0012, 0x65CD, 0x46D7, 0x26CF,
+  0x25F7, 0x26CF, 0x25FF, 0x65FE, 0x65FE, 0x65F5, 0x65FD, 0x85FC,
+  0x65F4, 0x65F3, 0x65F3, 0x85F2, 0x65F2, 0x45E1, 0x08E1, 0x2029,
+  0x0018, 0xD1A8, 0xD188, 0xD190, 0xF178, 0x0000, 0x0B19, 0x1169,
+  0x0B19, 0x0000, 0x4220, 0x9131, 0x9129, 0x9131, 0x4218, 0x0000,
+  0x0B21, 0x9131, 0x9131, 0x0000, 0x4218, 0x3149, 0x9131, 0x5149,
+  0x3151, 0x2052, 0x0011, 0xAAE8, 0xAAE8, 0xC8E8, 0xC8E0, 0xA8E0,
+  0xE7E0, 0x06E9, 0x65E1, 0x65E1, 0x85F2, 0x65EA, 0x65F3, 0x65FB,
+  0x85F4, 0x65FC, 0x85FD, 0x64CC, 0x2106, 0x0013, 0x65CD, 0xC7A6,
+  0x25F7, 0x25F7, 0x25FF, 0x25F7, 0x25F7, 0x65F6, 0x65FE, 0x85FD,
+  0x65FC, 0x65F3, 0x65F3, 0x85EA, 0x85F2, 0xA6E1, 0xC5E9, 0x65E9,
+  0x6BA0, 0x212A, 0x0016, 0xF178, 0xD178, 0xF178, 0x1161, 0x0000,
+  0x3149, 0x3149, 0x0000, 0x9131, 0x9131, 0x9131, 0x9129, 0x1222,
+  0x0000, 0x1222, 0x9131, 0x1222, 0x0000, 0x9131, 0x9131, 0x3149,
+  0x9129, 0x2151, 0x0012, 0x8EC8, 0xACE0, 0xAAE0, 0xACE8, 0xC8E0,
+  0xE7E0, 0xE7E0, 0x06E1, 0x45E1, 0xC5E9, 0xC5E9, 0x85F2, 0x65EA,
+  0x65F3, 0x85FC, 0x65FD, 0x85F5, 0x84CB, 0x2206, 0x0013, 0x6458,
+  0x46D7, 0x26CF, 0x25F7, 0x25FF, 0x25F7, 0x65FE, 0x65FE, 0x65FD,
+  0x85F5, 0x64CA, 0x0000, 0x65C1, 0x65FB, 0xC5E9, 0xC5E9, 0x45E1,
+  0x65E1, 0xE7E0, 0x222B, 0x0014, 0x1161, 0x1161, 0x1161, 0x3149,
+  0x0B19, 0x9131, 0x4220, 0x9131, 0x1222, 0x9129, 0x1222, 0xF221,
+  0x4220, 0x1222, 0x1222, 0x0000, 0xF221, 0x9131, 0x9129, 0xEE09,
+  0x2249, 0x0001, 0x4220, 0x2250, 0x0013, 0x8B60, 0xAEE8, 0xACE0,
+  0xACE8, 0xAAE0, 0xAAE0, 0xC8E0, 0x8B98, 0x8458, 0x45E9, 0x65E1,
+  0xC5E9, 0xC5E9, 0x85F2, 0x65F3, 0x65F4, 0x85FC, 0x65FD, 0x4218,
+  0x2307, 0x0014, 0x66D6, 0x25F7, 0x25F7, 0x25F7, 0x25F7, 0x25F7,
+  0x65FE, 0x85FE, 0x65FD, 0x85F4, 0x65F2, 0x65F3, 0x85EA, 0x85F2,
+  0xC5E9, 0xA6E9, 0x08E1, 0x08E1, 0xC8E8, 0x4218, 0x232C, 0x0012,
+  0x1169, 0x3149, 0x3149, 0x9131, 0x1222, 0x9131, 0x4232, 0xF221,
+  0x531A, 0x1222, 0x423A, 0x531A, 0xB412, 0x0B21, 0xB412, 0xF221,
+  0x531A, 0x1222, 0x2350, 0x0012, 0xB0E0, 0xAEC8, 0xAEE0, 0xACE0,
+  0xACE0, 0xC8E8, 0x08E1, 0xAAE0, 0x27D1, 0x06E1, 0xA6E1, 0xC5E9,
+  0x65F2, 0x85EA, 0x65FB, 0x65F3, 0x65F4, 0x85FC, 0x2407, 0x0015,
+  0x65CD, 0x46CF, 0x25FF, 0x25F7, 0x25F7, 0x65FD, 0x84CB, 0x65FD,
+  0x85FD, 0x65F4, 0x65F3, 0x85F2, 0x65F2, 0xC5E9, 0xC5E1, 0x45E1,
+  0x08E1, 0xC8E0, 0xE7E8, 0xA8E0, 0x8AC8, 0x242A, 0x0015, 0x0B19,
+  0x1161, 0x5149, 0x3149, 0x9131, 0x9131, 0x9131, 0x1222, 0x4218,
+  0x531A, 0x531A, 0xB412, 0x4220, 0xB412, 0xB41A, 0xB412, 0x531A,
+  0xB41A, 0x531A, 0x531A, 0x1222, 0x244E, 0x0014, 0x6BA0, 0xB0E0,
+  0xAEE0, 0xD1A8, 0x8ED0, 0xACE0, 0xAAE8, 0xAAE0, 0xC8E0, 0xA8E0,
+  0xE7E8, 0x06E1, 0x65E1, 0xA6E1, 0x27D1, 0x85F2, 0x85F2, 0x65F3,
+  0x85FC, 0x64CA, 0x2508, 0x0016, 0x25F7, 0x25F7, 0x25F7, 0x85FE,
+  0x84CC, 0xA39A, 0x65F3, 0x65FC, 0x85FC, 0x65F3, 0x65F3, 0x65EA,
+  0x85F2, 0x65E1, 0x65E9, 0x06E1, 0x08E1, 0xA8E8, 0x4218, 0xAAE8,
+  0xACE8, 0x8B60, 0x2527, 0x001C, 0xF178, 0xD190, 0xF178, 0x1161,
+  0x3151, 0x3149, 0x9131, 0x0B19, 0x9131, 0x1222, 0x1222, 0xB41A,
+  0x531A, 0xB412, 0xB41A, 0x560B, 0xB41A, 0x5613, 0x560B, 0x0B21,
+  0xB412, 0xB412, 0x531A, 0x531A, 0xF221, 0x1222, 0x9131, 0x0B21,
+  0x254D, 0x0014, 0xD1A8, 0xB0E0, 0xB1A8, 0xB0E0, 0xAEE8, 0xAEE0,
+  0xACE0, 0xACE0, 0xAAE8, 0xAAE0, 0xC8E0, 0x08E1, 0x06E1, 0x65E9,
+  0x06E9, 0xE490, 0xA6E1, 0x65F3, 0x65F3, 0x65F4, 0x2608, 0x0059,
+  0x64CC, 0x25F7, 0x25FF, 0x25F7, 0x65FD, 0x64CA, 0x0000, 0x64CA,
+  0x65F3, 0x65F3, 0x85F2, 0x65F2, 0xC5E9, 0x45E1, 0x4218, 0x06E1,
+  0xC8E8, 0xAAE0, 0x0000, 0x8450, 0xAAE8, 0xACE0, 0xAEE8, 0xB0E0,
+  0xAEE0, 0xB0E0, 0xB1C8, 0xD1A8, 0xB1B0, 0xD1A8, 0xB1B0, 0xD188,
+  0xF178, 0x1161, 0x0000, 0x3149, 0x9131, 0x9131, 0x9131, 0x1222,
+  0x1222, 0x531A, 0xB412, 0xB412, 0xB41A, 0x560B, 0x5613, 0x5613,
+  0x5613, 0x560B, 0x5613, 0x5613, 0xB412, 0xB41A, 0x0B21, 0xEE09,
+  0x1222, 0x1222, 0x9131, 0x9131, 0x9129, 0x3149, 0x0B21, 0x0B19,
+  0x0B21, 0xD178, 0xF178, 0xB1B0, 0xD1B0, 0xB1C8, 0x0000, 0x0000,
+  0xAEE8, 0xAEE0, 0xAEE0, 0x6B98, 0xAAE8, 0xAAE0, 0xC8E8, 0xA8E0,
+  0xC8E0, 0x06E1, 0x0000, 0x8B98, 0x65C9, 0xC5E9, 0x85F2, 0x65F3,
+  0xA6E1, 0x2709, 0x0057, 0x65FE, 0x25F7, 0x65FE, 0x65FE, 0x85FD,
+  0x84CB, 0x65F4, 0x85FC, 0x65F3, 0xA39A, 0x85F2, 0xC5E9, 0x8458,
+  0x0000, 0xC6C0, 0xE7E0, 0xC8E0, 0x08E1, 0xAAE0, 0xACE8, 0xACE0,
+  0xAEE0, 0xAEE8, 0xB0E0, 0xB0E0, 0xB0E0, 0xB1B0, 0xF178, 0xD1B0,
+  0xD190, 0x0000, 0x0000, 0x0000, 0x4218, 0x3151, 0x3149, 0x9131,
+  0x1222, 0x1222, 0xEE09, 0x0000, 0x5613, 0x560B, 0x5613, 0x5613,
+  0xF80B, 0xD80B, 0x0000, 0xF80B, 0xD80B, 0x5613, 0x560B, 0xB41A,
+  0x3303, 0x0000, 0x0000, 0x0000, 0x1222, 0x9131, 0x5149, 0x9131,
+  0x1161, 0x1161, 0xD190, 0xD188, 0xD1B0, 0xB1A8, 0xB1D0, 0xB1C8,
+  0xB0E0, 0xD1A8, 0xB0E0, 0xAEE8, 0x8B58, 0x0000, 0x8B98, 0xAAE8,
+  0xAAE0, 0x8AC8, 0xE7E0, 0xE7E8, 0xA6E1, 0xC490, 0xC5E9, 0x85EA,
+  0x65F3, 0x85F2, 0x280A, 0x0055, 0x84CB, 0x65F6, 0x65FE, 0x65FD,
+  0x85F4, 0x65FC, 0x65F3, 0xC490, 0x85F2, 0x85F2, 0xE8E0, 0x0000,
+  0x0000, 0x8450, 0xC8E8, 0xA8E0, 0xC8E0, 0xAAE0, 0x8458, 0x0000,
+  0xAEE8, 0xAEE0, 0x8EC8, 0xB0E0, 0xB1C8, 0xB1C8, 0x8B98, 0xB1B0,
+  0x0000, 0x0000, 0x0000, 0x1161, 0x3149, 0x5149, 0x9131, 0x9131,
+  0x9131, 0x1222, 0x0000, 0x4218, 0xB412, 0x5613, 0x5613, 0xD80B,
+  0xF80B, 0x7904, 0x0000, 0x0000, 0xD80B, 0xF80B, 0x5613, 0x5613,
+  0xB412, 0xB41A, 0x0B21, 0x0000, 0x0000, 0x9131, 0x9129, 0x9131,
+  0x3149, 0x1169, 0xF178, 0x0000, 0xD190, 0xD1A8, 0x0000, 0xB1D0,
+  0xB1C8, 0xB0E0, 0xAEE8, 0xB0E0, 0x0000, 0x0000, 0x0000, 0xACE0,
+  0xA8E0, 0xAAE0, 0x8AC8, 0x26E9, 0x06E1, 0x65E1, 0xC5E9, 0x85F2,
+  0x6B98, 0x290C, 0x0051, 0xA39A, 0x85F4, 0x65FD, 0x65FB, 0x65F3,
+  0x85EA, 0x85F2, 0xC5E9, 0x27D9, 0xC490, 0x8458, 0x8450, 0xE7E8,
+  0xC8E0, 0xACE8, 0x0000, 0x0000, 0x6B98, 0xAEE0, 0xAEC8, 0x0000,
+  0xB0E0, 0xB0E8, 0xB1C8, 0xB1D0, 0x8B60, 0x0000, 0x4218, 0xF178,
+  0x1169, 0x4218, 0x0B21, 0x3149, 0x9131, 0x1222, 0x0000, 0x0000,
+  0xEE09, 0x5613, 0x5613, 0xD80B, 0xD80B, 0x7904, 0x990C, 0x0000,
+  0x0000, 0xEE09, 0xF80B, 0xD80B, 0x5613, 0x0000, 0xB412, 0xB41A,
+  0x1222, 0x0000, 0x0000, 0x5149, 0x3149, 0x1161, 0x1161, 0x1161,
+  0x0000, 0xB1B0, 0xD1A8, 0x0000, 0x0000, 0x4218, 0xB0E0, 0xB0E0,
+  0xAEE8, 0x0000, 0x0000, 0x0000, 0x8EC8, 0xAAE0, 0xC8E0, 0x08E1,
+  0x08E1, 0x06E9, 0x08E1, 0x8B98, 0x2A10, 0x0049, 0xC498, 0x85C1,
+  0xA6E9, 0xA6E1, 0x27D1, 0x65E9, 0x08E1, 0x08E1, 0xC8E0, 0xAAE0,
+  0x8450, 0x8ED0, 0x0000, 0xAEE8, 0xAEE0, 0xB0E0, 0x0000, 0xD1A8,
+  0xB1C8, 0xB1C8, 0xB1B0, 0xD190, 0x4218, 0xF190, 0x3149, 0x0000,
+  0x0000, 0x9131, 0x9129, 0x9131, 0x0000, 0x0000, 0x0000, 0x731A,
+  0x560B, 0xD80B, 0xF80B, 0x790C, 0x7904, 0x790C, 0x0000, 0x0000,
+  0x0000, 0x7904, 0xD80B, 0xF80B, 0xEE09, 0x0000, 0x0B21, 0x531A,
+  0xEE09, 0x4220, 0x9131, 0x5149, 0x3149, 0x1169, 0x0000, 0x0000,
+  0xF190, 0xD1B0, 0x6B98, 0xD1B0, 0x8B58, 0x8ED0, 0xAEE0, 0xB0E0,
+  0xAEC8, 0x8EC8, 0xAED0, 0x8EC8, 0x8AC8, 0xAEC8, 0x8458, 0x2B1A,
+  0x0019, 0x08E1, 0x8EC8, 0xACE0, 0xACE8, 0xB0E0, 0xB0E0, 0xB0E0,
+  0x8B98, 0xB0E0, 0xB1D0, 0xB1C8, 0xB1A8, 0xD1B0, 0x1169, 0x0000,
+  0x0000, 0x0000, 0x9131, 0x9131, 0x9131, 0x0000, 0x0000, 0x0000,
+  0xEE09, 0xF80B, 0x2B3C, 0x0018, 0x7904, 0xF80B, 0xD80B, 0x0000,
+  0x0000, 0x0000, 0x731A, 0x9129, 0x9131, 0x9131, 0x1161, 0x3149,
+  0x3149, 0xF178, 0xB1B0, 0xD1A8, 0xD1B0, 0xD190, 0xB1D0, 0x4218,
+  0x0000, 0x0000, 0x8B60, 0x4218, 0x2C19, 0x0038, 0xAAE8, 0xC8E8,
+  0xACE0, 0xACE0, 0xAEE8, 0xAEE0, 0xB0E0, 0xB0E0, 0xB0E0, 0xB1C8,
+  0xB1C8, 0xB1A8, 0xD1B0, 0xD190, 0xF178, 0x0000, 0x0000, 0x9129,
+  0x3149, 0x9131, 0x0000, 0x0000, 0x0000, 0x0000, 0x531A, 0x560B,
+  0xF80B, 0xD80B, 0x990C, 0x7904, 0x790C, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x3303, 0xD80B, 0x5613, 0x0B21, 0x0000, 0xEE09, 0x1222,
+  0x1222, 0x9131, 0x3149, 0x3149, 0x1169, 0x1161, 0xD190, 0xF190,
+  0xD1B0, 0xB1A8, 0xD1B0, 0xB1C8, 0xB0E0, 0x8458, 0x2D17, 0x0014,
+  0xC8E8, 0x08E1, 0xA8E0, 0xAAE0, 0xAAE0, 0xACE8, 0xACE0, 0xAEE8,
+  0xAEC8, 0xB0E0, 0xB0E0, 0xB0E0, 0xB1C8, 0xB1D0, 0xD1B0, 0xD190,
+  0xD178, 0xF178, 0x5149, 0x3149, 0x2D32, 0x0006, 0xF80B, 0xD80B,
+  0x7904, 0x790C, 0x7904, 0x790C, 0x2D3D, 0x0015, 0xF80B, 0xD80B,
+  0x5613, 0x3303, 0x531A, 0x1222, 0x9131, 0x9129, 0x9131, 0x3149,
+  0x1161, 0xF178, 0xF178, 0xD190, 0xB1A8, 0xB1D0, 0xB1C8, 0xB0E0,
+  0xB0E0, 0xB0E0, 0xB1C8, 0x2E15, 0x0017, 0xC6C0, 0x06E1, 0x08E1,
+  0xC8E0, 0xA8E0, 0xC8E8, 0xACE0, 0xACE0, 0xAEE0, 0xB1C8, 0x0000,
+  0xAEE8, 0xB0E0, 0xB1C8, 0xB1C8, 0xB1A8, 0xD1B0, 0xD190, 0xD188,
+  0x1161, 0x1161, 0x5149, 0x3149, 0x2E31, 0x0007, 0x0E0A, 0x5613,
+  0xD80B, 0xF80B, 0x790C, 0x7904, 0x790C, 0x2E3D, 0x0017, 0xEE09,
+  0x5613, 0x5613, 0x531A, 0x531A, 0x1222, 0x1222, 0x9131, 0x3149,
+  0x3149, 0x1169, 0x1161, 0x4218, 0x1169, 0xD1B0, 0xB1A8, 0xB1D0,
+  0xB1C8, 0xB0E0, 0xAEE8, 0xB0E0, 0xAEE0, 0x8B98, 0x2F14, 0x0018,
+  0xA6E1, 0x45E1, 0x65E9, 0xE7E0, 0xE7E0, 0xA8E0, 0xAAE8, 0xAAE0,
+  0xACE8, 0xAEC8, 0x8EC8, 0xAEE0, 0xB0E0, 0xD1B0, 0xB0E0, 0xB1D0,
+  0x4218, 0xD190, 0xD1B0, 0xD178, 0xF178, 0x1161, 0x1169, 0x0B19,
+  0x2F31, 0x0005, 0xB41A, 0x5613, 0x560B, 0xD80B, 0xD80B, 0x2F3E,
+  0x0017, 0x5613, 0xB41A, 0xB412, 0x1222, 0x1222, 0x9129, 0x0000,
+  0x9131, 0x1161, 0x3149, 0xF178, 0xF178, 0xD190, 0xD190, 0xB1C8,
+  0xB1C8, 0xB0E0, 0xB0E0, 0xB0E0, 0xAEE0, 0xAEE0, 0xACE0, 0xAEE8,
+  0x3013, 0x0019, 0x85F2, 0xC5E9, 0x65E9, 0x06E1, 0xE7E0, 0xC8E0,
+  0xA8E8, 0xC8E0, 0xACE0, 0xACE0, 0xAEE8, 0xAEE0, 0xB1C8, 0xB0E0,
+  0xB1A8, 0xB1C8, 0xB1D0, 0x0000, 0xD1A8, 0xD190, 0xD190, 0xF178,
+  0x1161, 0x3149, 0x5149, 0x3031, 0x0005, 0xB412, 0xB412, 0x5613,
+  0x5613, 0xF80B, 0x303E, 0x0019, 0xB412, 0xB41A, 0x531A, 0x1222,
+  0x9131, 0x9131, 0x0000, 0x3149, 0x3149, 0x3149, 0x1169, 0xF178,
+  0xD190, 0xF190, 0xD1A8, 0xB1C8, 0xB1D0, 0xB0E0, 0xB1C8, 0xB0E0,
+  0xAEE8, 0xACE0, 0xACE0, 0xACE0, 0x8458, 0x3111, 0x001C, 0x64CA,
+  0x65F3, 0xC5E9, 0xC5E9, 0x45E1, 0x65E1, 0xE7E8, 0x08E1, 0xA8E0,
+  0xACE0, 0xAAE0, 0xACE8, 0xACE0, 0xAEE8, 0xB1C8, 0xB0E0, 0x8B98,
+  0xB0E0, 0xB1D0, 0xB1C8, 0xB1A8, 0xD1B0, 0xD190, 0xF178, 0x8B60,
+  0x1169, 0x5149, 0x3149, 0x3132, 0x0026, 0xB412, 0xB41A, 0x560B,
+  0x5613, 0xD80B, 0xF80B, 0x0000, 0x0000, 0x0000, 0x0000, 0xEE09,
+  0x5613, 0xB412, 0x531A, 0x531A, 0x1222, 0x1222, 0x9131, 0x3149,
+  0x3149, 0x1161, 0x1161, 0xF178, 0xD178, 0xD1B0, 0xD190, 0xB1C8,
+  0xB1C8, 0xB1C8, 0xB0E0, 0xAEC8, 0xAEE0, 0xAEE8, 0xACE0, 0xACE0,
+  0xAAE0, 0xAAE8, 0x8AC8, 0x3210, 0x0027, 0x65F3, 0x65F3, 0x85F2,
+  0x85F2, 0xC5E9, 0x45E1, 0x06E1, 0x06E1, 0xC8E0, 0xC8E0, 0xC490,
+  0x8B60, 0xAAE8, 0xAEE0, 0x0000, 0xB0E0, 0xAEE0, 0xB1C8, 0xB0E0,
+  0xB0E0, 0xD1B0, 0xB1A8, 0xD1B0, 0xD188, 0x0000, 0x0000, 0x3149,
+  0x1161, 0x9131, 0x0B19, 0x0000, 0x0000, 0x0000, 0x731A, 0x531A,
+  0xB41A, 0xB412, 0x5613, 0x5613, 0x323C, 0x001D, 0xB412, 0xB41A,
+  0xB412, 0x0000, 0x0000, 0x1222, 0x9131, 0x3149, 0x9131, 0x3149,
+  0x1169, 0xF178, 0xF178, 0xD190, 0xF178, 0x0000, 0xB1B0, 0xB1C8,
+  0x0000, 0xB1C8, 0xAEE8, 0xAEE0, 0xACE8, 0xACE0, 0xAAE0, 0xAAE0,
+  0xC8E8, 0xA8E0, 0xC8E0, 0x330F, 0x004B, 0x85F4, 0x65FC, 0x65F3,
+  0x65F3, 0x85F2, 0x85EA, 0x45E9, 0x65E1, 0x06E1, 0x08E1, 0xC8E0,
+  0xAAE8, 0xACE0, 0xACE0, 0xACE0, 0xB0E0, 0xAEE8, 0xB0E0, 0xB0E0,
+  0xB0E0, 0xB1C8, 0xB1D0, 0xB1A8, 0xD1B0, 0xF190, 0x8B60, 0x0000,
+  0x0000, 0x3149, 0x3149, 0x9131, 0x0000, 0x0000, 0x0000, 0x1222,
+  0xB41A, 0xB412, 0xB41A, 0xB412, 0x5613, 0x5613, 0x0000, 0x0000,
+  0x0000, 0xB412, 0xB412, 0x531A, 0x0000, 0x0000, 0x0000, 0x9131,
+  0x1222, 0x3149, 0x5149, 0x3149, 0xD178, 0xF178, 0xF190, 0xD190,
+  0xD178, 0xD1A8, 0xB1D0, 0xB1A8, 0xD1A8, 0xB0E0, 0xB0E0, 0xAEE0,
+  0xAEE8, 0xACE0, 0xACE0, 0xAAE0, 0xAAE8, 0xA8E0, 0x08E1, 0x08E1,
+  0x340E, 0x004D, 0x65FC, 0x85FD, 0x65F4, 0x65F3, 0x85F2, 0x65EA,
+  0xC5E9, 0xC5E9, 0x08E1, 0x06E1, 0xE7E0, 0xE7E0, 0xC8E8, 0xAAE0,
+  0xAAE0, 0xACE0, 0xACE8, 0xAEE0, 0xAEE0, 0xB0E0, 0xB0E0, 0xB0E0,
+  0xB1C8, 0xB1C8, 0xB1B0, 0xD1A8, 0xD190, 0x0000, 0x0000, 0x0000,
+  0x3149, 0x5149, 0x4218, 0x0000, 0x9131, 0x1222, 0x1222, 0x531A,
+  0x531A, 0xB412, 0x531A, 0xB41A, 0xB412, 0x0000, 0x0000, 0xB41A,
+  0x531A, 0xEE09, 0x0000, 0x0000, 0x9131, 0x9131, 0x9131, 0x3149,
+  0x3149, 0x1169, 0x1161, 0xF178, 0xD190, 0xD1B0, 0xD1A8, 0xB1C8,
+  0xB1D0, 0xB0E0, 0xB0E0, 0xB0E0, 0xAEE0, 0xAEE8, 0xACE0, 0xACE0,
+  0xAAE0, 0xAAE8, 0xA8E0, 0xC8E0, 0xE7E0, 0x06E9, 0x08E1, 0x350D,
+  0x004F, 0x65FD, 0x85F5, 0x65FC, 0x85FC, 0x65F3, 0x65F3, 0x85EA,
+  0x85F2, 0x27D1, 0x0000, 0x08E1, 0x06E9, 0xE7E0, 0xA8E0, 0xC8E0,
+  0xACE8, 0xACE0, 0xAEE0, 0xAEE8, 0xB0E0, 0xB0E0, 0xB0E0, 0xB1C8,
+  0x0000, 0xF190, 0xB1C8, 0xD190, 0xB1B0, 0xF178, 0x0000, 0x0000,
+  0x5151, 0x3149, 0x3149, 0x0B21, 0x1222, 0x0000, 0xF221, 0x1222,
+  0x531A, 0x1222, 0xB412, 0x0000, 0xB41A, 0x0000, 0xEE09, 0x1222,
+  0x531A, 0x0000, 0x0000, 0x0B19, 0x9131, 0x9131, 0x5149, 0x3149,
+  0x0000, 0x3149, 0xF178, 0xD190, 0xD1A8, 0xB1B0, 0xB1C8, 0xB1C8,
+  0xB1C8, 0xB0E0, 0xB0E0, 0xAEE0, 0xB0E0, 0xAEE8, 0xAEC8, 0x4218,
+  0xACE8, 0xAAE0, 0xA8E0, 0xC8E0, 0x26E9, 0x06E1, 0x45E1, 0x65E1,
+  0x360C, 0x0051, 0x84CB, 0x85FE, 0x65FD, 0x65F5, 0x85FC, 0x65F4,
+  0x65F3, 0x65FB, 0xC5E9, 0xA6E1, 0x0000, 0x0000, 0xE7E0, 0xAAE0,
+  0x0000, 0x0000, 0x8AC8, 0xACE0, 0xACE8, 0xAEE0, 0xAEE0, 0xB0E0,
+  0xB0E0, 0x8B98, 0x0000, 0x0000, 0xD1B0, 0xD178, 0x0000, 0xD188,
+  0xF178, 0x0000, 0x4218, 0x1169, 0x3149, 0x5149, 0x0B21, 0x0000,
+  0x9131, 0x1222, 0x9129, 0x1222, 0xF221, 0x0000, 0x1222, 0x9131,
+  0x1222, 0xF221, 0x0B19, 0x0000, 0x0B21, 0x9131, 0x0B19, 0x0000,
+  0x3151, 0x4218, 0x0000, 0x0000, 0xF178, 0xD190, 0xF190, 0xD1B0,
+  0xB1B0, 0xB1C8, 0x8B98, 0x0000, 0x8458, 0xAEE8, 0xAEE8, 0x8450,
+  0x0000, 0x8EC8, 0xAAE8, 0xAAE0, 0xC8E8, 0xE7E0, 0xE7E0, 0x45E1,
+  0x65E9, 0xC5E9, 0x65C1, 0x370C, 0x0051, 0x25F7, 0x65FE, 0x85F6,
+  0x65FD, 0x85FD, 0x65F4, 0x85FC, 0x65EA, 0x85F2, 0xC5E9, 0x85C9,
+  0x8B58, 0x06E1, 0xAAE8, 0x0000, 0x0000, 0xAEC8, 0xAAE0, 0xACE0,
+  0xACE0, 0xAEE8, 0xAEE0, 0xB0E8, 0x4218, 0x0000, 0x0000, 0xD178,
+  0xD1B0, 0x0000, 0x0000, 0xD190, 0xF178, 0x0000, 0x1161, 0x1169,
+  0x5149, 0x0000, 0x0000, 0x3149, 0x9131, 0x9129, 0x9131, 0xF221,
+  0x0000, 0x0B21, 0x9129, 0x1222, 0x9131, 0x4220, 0x0E0A, 0x3149,
+  0x0B21, 0x0000, 0x5149, 0x3149, 0x0000, 0x0000, 0x0000, 0xD188,
+  0xD1B0, 0xB1A8, 0xD1B0, 0xB1C8, 0xB1C8, 0xB0E0, 0x0000, 0x0000,
+  0x8EC8, 0xAEE8, 0x8B98, 0x0000, 0xACE0, 0xAAE0, 0xC8E8, 0x08E1,
+  0xE7E0, 0x06E1, 0x45E1, 0xC5E9, 0xC5E9, 0x85EA, 0x380B, 0x0053,
+  0xA39A, 0x65FE, 0x65FE, 0x65FD, 0x85FD, 0x65F4, 0x85FC, 0x65F3,
+  0x65F3, 0x65F2, 0x85EA, 0x45E1, 0x27D1, 0x06E9, 0x08E1, 0x0000,
+  0x0000, 0xAAE0, 0xAAE0, 0xAAE0, 0xACE8, 0xAEC8, 0x4218, 0xAEE8,
+  0x8B58, 0x0000, 0x0000, 0x0000, 0xB1C8, 0xD190, 0x0000, 0x0000,
+  0xD190, 0xF178, 0xF178, 0x1161, 0x3149, 0x0000, 0x0000, 0x9131,
+  0x3149, 0x9131, 0x9129, 0x9131, 0x0000, 0x0000, 0x9131, 0x9131,
+  0x9129, 0x9131, 0x5149, 0x0B21, 0x0000, 0x0000, 0x1161, 0x4218,
+  0x0000, 0x0000, 0x0000, 0xD190, 0xF190, 0x4220, 0xB1D0, 0xB1C8,
+  0xB0E0, 0xB0E0, 0xD1A8, 0x0000, 0xAEE8, 0xACE0, 0x8EC8, 0xAEC8,
+  0xAAE8, 0xA8E0, 0xC8E8, 0xA8E0, 0xE7E0, 0x06E1, 0x65E9, 0x65E1,
+  0x85F2, 0x65EA, 0xC490, 0x390B, 0x0052, 0xA39A, 0x25F7, 0x65FE,
+  0x85FE, 0x65FD, 0x85F5, 0x65FC, 0x85FC, 0x65F3, 0x84CA, 0xA6E1,
+  0xC5E9, 0x65E1, 0x08E1, 0x06E9, 0x8458, 0x6B98, 0xAAE0, 0xAAE0,
+  0xACE8, 0xACE0, 0xAEE0, 0xAEE8, 0xB0E0, 0xB1C8, 0xD1B0, 0xB1C8,
+  0xB1A8, 0xB1D0, 0xB1C8, 0x8B60, 0x0000, 0x0000, 0xF178, 0xD178,
+  0xF178, 0x8B60, 0x0000, 0x0000, 0x5151, 0x3149, 0x5149, 0x3149,
+  0x5149, 0x0000, 0x0000, 0x9131, 0x3151, 0x5149, 0x3149, 0x0000,
+  0x0000, 0x0000, 0x1161, 0x1161, 0x8B60, 0x8B58, 0x8B60, 0x8B60,
+  0xB1A8, 0xD1B0, 0xB1C8, 0xB1C8, 0xB0E0, 0xB0E0, 0xB0E0, 0xB0E0,
+  0x6B98, 0xAEE0, 0xAEE8, 0xAEC8, 0xACE0, 0xAAE0, 0xACE8, 0xC8E0,
+  0xE7E0, 0x06E1, 0x45E1, 0x65E1, 0xC5E9, 0xC5E9, 0x65FB, 0x3A0B,
+  0x0052, 0x2232, 0x85FE, 0x25F7, 0x65FE, 0x65FE, 0x65FC, 0x65F4,
+  0x65F3, 0x65F3, 0x8458, 0x0000, 0xC5E9, 0xC5E9, 0x45E1, 0x06E1,
+  0xE7E8, 0x08E1, 0xC8E0, 0xAAE0, 0x8AC8, 0x0000, 0xACE0, 0xAEE8,
+  0xAEC8, 0xAEC8, 0x6B98, 0xAEC8, 0xB1B0, 0xB1C8, 0xB1C8, 0xB1D0,
+  0xD1A8, 0x8B60, 0x0000, 0xD190, 0xF178, 0x4218, 0x0000, 0x0000,
+  0x1161, 0x1161, 0x3149, 0x3149, 0x5151, 0x0000, 0x0000, 0x0000,
+  0x3149, 0x1169, 0x0B19, 0x0000, 0x5149, 0x1169, 0x1161, 0xF178,
+  0xD178, 0xD190, 0xF178, 0xD190, 0xD1B0, 0xB1C8, 0xB1C8, 0x4218,
+  0x0000, 0xB0E8, 0xAEE8, 0xB0E0, 0xAEE0, 0xAEE0, 0xACE0, 0xACE8,
+  0xAAE0, 0x8B98, 0x0000, 0xAAE8, 0xE7E0, 0x06E1, 0x65E1, 0xC5E9,
+  0xC5E9, 0x85F2, 0x65EA, 0x3B0C, 0x0015, 0x25F7, 0x65FE, 0x25F7,
+  0x85F6, 0x65FD, 0x85FC, 0x85F4, 0x65C1, 0x64CA, 0x85F2, 0x85EA,
+  0xC5E9, 0xC5E9, 0x06E1, 0x06E9, 0xE7E0, 0xE7E0, 0xC8E0, 0x8AC8,
+  0xACE8, 0xACE0, 0x3B27, 0x001B, 0xD1B0, 0xB0E0, 0xB1A8, 0xB1D0,
+  0xD1A8, 0xD1B0, 0xD190, 0xD190, 0x0000, 0x0000, 0x0000, 0xF178,
+  0x1161, 0x1161, 0x1161, 0x1169, 0x0000, 0x0000, 0x0000, 0x1161,
+  0x1161, 0x1161, 0x1169, 0xF178, 0x3149, 0xD178, 0xF178, 0x3B47,
+  0x0016, 0x8B58, 0xB1D0, 0x8B98, 0x4218, 0xB0E0, 0xB0E0, 0xAEE0,
+  0xAEE8, 0xACE0, 0xACE0, 0xAAE0, 0x08E1, 0xAAE8, 0x8AC8, 0xE490,
+  0x06E1, 0x45E1, 0xC5E9, 0xC5E9, 0x65EA, 0x85F2, 0x65FB, 0x3C0C,
+  0x0014, 0x65FE, 0x25F7, 0x65FE, 0x65FE, 0x65FD, 0x65FD, 0x85F4,
+  0x65F3, 0x65F2, 0x65F3, 0xC5E9, 0xC5E9, 0x45E1, 0x65E1, 0x06E1,
+  0x08E1, 0xC8E0, 0xAAE8, 0xA8E0, 0xAEC8, 0x3C27, 0x001B, 0xB0E0,
+  0xB1C8, 0x0000, 0x0000, 0x8458, 0xB1A8, 0xD1B0, 0xD178, 0x0000,
+  0x0000, 0x0000, 0xF178, 0xD178, 0xF178, 0xD178, 0x1161, 0x0000,
+  0x0000, 0x0000, 0x3149, 0xF178, 0x1161, 0x0B19, 0x0000, 0x0000,
+  0xF178, 0xD190, 0x3C49, 0x0014, 0x8BA0, 0xAEE8, 0xB0E0, 0xB1C8,
+  0xAEE8, 0xACE0, 0xACE0, 0xAAE0, 0xAAE8, 0xA8E0, 0xC8E0, 0xA8E0,
+  0x27D1, 0x06E9, 0x65E1, 0x65E1, 0xC5E9, 0xC5E9, 0x85F2, 0x65EA,
+  0x3D0C, 0x0016, 0x25F7, 0x25F7, 0x25F7, 0x65FE, 0x65FE, 0x85FD,
+  0x65F5, 0x85FC, 0x65FC, 0x65F3, 0x85EA, 0x27D1, 0xC5E9, 0x65E9,
+  0x65E1, 0x06E1, 0x08E1, 0xAAE0, 0xC8E8, 0xAAE8, 0x8AC8, 0x8450,
+  0x3D27, 0x001B, 0xB0E0, 0xB0E0, 0x0000, 0x0000, 0x0000, 0x0000,
+  0xD190, 0xF178, 0x0000, 0x0000, 0x0000, 0xF190, 0xD190, 0xF188,
+  0xD190, 0xD178, 0x0000, 0x0000, 0x0000, 0x1161, 0xF178, 0x0000,
+  0x0000, 0x0000, 0x0000, 0xB1B0, 0xD1B0, 0x3D47, 0x0016, 0x8B58,
+  0xB0E0, 0xB0E0, 0xB0E0, 0xAEE8, 0x8EC8, 0xACE0, 0xACE0, 0xAAE8,
+  0xACE0, 0xAAE0, 0xAAE0, 0xC8E8, 0x08E1, 0x06E1, 0x65E1, 0x45E1,
+  0xC5E9, 0xC5E9, 0x65EA, 0x85F2, 0x65F3, 0x3E0C, 0x0051, 0x65CD,
+  0x25F7, 0x85FE, 0x65FE, 0x65FD, 0x65FD, 0x85F4, 0x65FC, 0x65F3,
+  0x65F3, 0x85F2, 0x0000, 0x27D1, 0xC5E9, 0x45E1, 0x06E1, 0xE7E0,
+  0x08E1, 0x0000, 0xAAE8, 0xAAE0, 0xAAE0, 0xACE0, 0xAEE8, 0xACE0,
+  0xAEE0, 0xAEE0, 0xB0E0, 0xD1A8, 0x0000, 0x0000, 0x0000, 0x6BA0,
+  0xB1C8, 0x0000, 0x0000, 0x0000, 0x0000, 0xD190, 0xD1A8, 0xD190,
+  0xF190, 0xF178, 0x0000, 0x0000, 0x0000, 0x0000, 0xD188, 0x8B60,
+  0x0000, 0x0000, 0x0000, 0xD190, 0xB1C8, 0xD1B0, 0xB1C8, 0xB1C8,
+  0xB0E0, 0xB1C8, 0xB0E8, 0xAEE0, 0xB0E0, 0x0000, 0xAEC8, 0xACE8,
+  0xACE0, 0xACE0, 0xACE0, 0xAAE8, 0x0000, 0x8AC8, 0xE7E0, 0xE7E0,
+  0x06E1, 0x65E9, 0xC5E9, 0xC5E9, 0x85EA, 0x85EA, 0x65F3, 0x65C1,
+  0x3F0C, 0x0022, 0x65CD, 0x25F7, 0x25F7, 0x65FE, 0x85FE, 0x65FD,
+  0x85F5, 0x65FC, 0x85FC, 0x65F3, 0x65F3, 0x65EA, 0x85F2, 0xC5E9,
+  0xC5E9, 0x65E1, 0x06E9, 0x4218, 0x0000, 0x0000, 0x0000, 0x8B98,
+  0xACE8, 0x8EC8, 0xAEE0, 0xAEE0, 0xAEE8, 0xAEE0, 0xB1D0, 0x0000,
+  0x0000, 0x8B58, 0xB0E0, 0xB1D0, 0x3F33, 0x0003, 0xD1A8, 0xB1B0,
+  0xD1A8, 0x3F3B, 0x000C, 0xD190, 0xD1B0, 0x4218, 0x0000, 0x0000,
+  0xB1B0, 0xD1A8, 0xB0E0, 0xB1C8, 0xB0E0, 0xB1B0, 0xD1B0, 0x3F4C,
+  0x0011, 0xAEE0, 0xACE0, 0xACE0, 0xAAE8, 0xAAE0, 0xC8E0, 0x08E1,
+  0xE7E0, 0x06E1, 0x45E1, 0xC5E9, 0xC5E9, 0x65F2, 0x85EA, 0x65FB,
+  0x65FB, 0xA362, 0x400C, 0x0011, 0xA39A, 0x25F7, 0x25FF, 0x25F7,
+  0x85FE, 0x65FE, 0x65FD, 0x65F5, 0x85FC, 0x65F4, 0x65F3, 0x65FB,
+  0x85EA, 0x65F2, 0x45E1, 0x65E1, 0xA8E0, 0x4025, 0x0009, 0xAEC8,
+  0x8EC8, 0xAEE8, 0xAEC8, 0x0000, 0x6B98, 0xB0E8, 0xB0E0, 0x8B98,
+  0x4033, 0x0003, 0x8B58, 0xD190, 0x8B60, 0x403B, 0x0009, 0x8B98,
+  0xB1B0, 0xB1C8, 0x4218, 0x0000, 0xB1D0, 0xB1D0, 0xB1C8, 0x8B98,
+  0x404C, 0x0011, 0x6BA0, 0xACE0, 0xAAE8, 0xAAE0, 0xC8E0, 0xE7E0,
+  0xE7E8, 0x06E1, 0x06E1, 0x65E1, 0x65E9, 0xC5E9, 0x85EA, 0x65F3,
+  0x65F3, 0x65FC, 0x8450, 0x410C, 0x0010, 0x2232, 0x25F7, 0x25F7,
+  0x25F7, 0x25F7, 0x65FE, 0x85FE, 0x65F4, 0x85FC, 0x65F4, 0x85FC,
+  0x65F2, 0x65F3, 0x85F2, 0xC5E9, 0x65E9, 0x4124, 0x0009, 0x8EC8,
+  0xAEC8, 0x6B98, 0xACE0, 0xAEE8, 0xAEC8, 0xB0E0, 0xAEE0, 0xB0E8,
+  0x413C, 0x0007, 0xB1C8, 0xB1C8, 0xB0E0, 0xB1A8, 0xB0E0, 0xB0E0,
+  0xB1C8, 0x414D, 0x0010, 0xAAE8, 0xAAE0, 0xC8E0, 0x08E1, 0xE7E0,
+  0x26E9, 0x06E1, 0x45E1, 0xA6E1, 0xC5E9, 0x85F2, 0x65F3, 0x65F3,
+  0x65FC, 0x85FC, 0x8458, 0x420D, 0x0020, 0x25FF, 0x25F7, 0x25F7,
+  0x65FE, 0x65FE, 0x84CB, 0x0000, 0x0000, 0x65FC, 0x85EA, 0x0000,
+  0x0000, 0x27D1, 0xC5E9, 0xC5E9, 0xE8E0, 0x65E1, 0x08E1, 0x08E1,
+  0x6B98, 0x8B60, 0x0000, 0x0000, 0x8AC8, 0xACE8, 0xACE0, 0xACE0,
+  0xACE0, 0xAEE8, 0xAEE0, 0xAEE0, 0xAEC8, 0x423C, 0x0008, 0x8B98,
+  0xB1D0, 0xB0E0, 0xB0E0, 0xB0E0, 0xB0E0, 0xB1C8, 0x8B58, 0x4249,
+  0x0013, 0x6BA0, 0xAED0, 0xACE8, 0x8EC8, 0xAAE0, 0xC8E0, 0xAAE8,
+  0x8450, 0x0000, 0xC490, 0x65E9, 0xC490, 0x0000, 0x27D9, 0x85F2,
+  0x85EA, 0x65F3, 0x65FB, 0x65F4, 0x430D, 0x0020, 0x86D6, 0x25F7,
+  0x25F7, 0x25F7, 0x65FE, 0x0000, 0x0000, 0x0000, 0x85FC, 0x85FC,
+  0x6450, 0x85EA, 0x65F2, 0x85EA, 0xC5E9, 0xC5E9, 0x65E1, 0x65E9,
+  0x06E1, 0x06E1, 0xE7E0, 0x08E1, 0xC8E8, 0xAAE0, 0xAAE0, 0x08E1,
+  0xACE0, 0xACE8, 0xACE0, 0xAEE0, 0xAEE8, 0xB1C8, 0x433C, 0x0020,
+  0xB1B0, 0x8B58, 0xB0E0, 0xB0E0, 0xB0E0, 0xB0E0, 0xB0E0, 0xAEE0,
+  0xB0E0, 0xAEE0, 0xAEE8, 0xACE0, 0xACE0, 0xACE0, 0x08E1, 0xAAE8,
+  0xAAE0, 0xC8E0, 0x08E1, 0xC8E0, 0x8AC8, 0x0000, 0x08E1, 0x45E1,
+  0xC6C0, 0x0000, 0x0000, 0xC5E9, 0x65FB, 0x65F3, 0x65F4, 0x85FC,
+  0x440D, 0x0020, 0x66CE, 0x26CF, 0x25FF, 0x25F7, 0x65FD, 0x0000,
+  0x0000, 0x0000, 0x65F3, 0x85FC, 0x65F4, 0x65F3, 0x65FB, 0x85EA,
+  0x65F2, 0xC5E9, 0xC5E9, 0x45E1, 0x65E1, 0x06E1, 0x06E1, 0xC8E0,
+  0xC8E8, 0xA8E0, 0xAAE0, 0xC8E0, 0xAAE8, 0xAAE0, 0xACE0, 0x6B98,
+  0xAEE8, 0x8450, 0x443C, 0x0020, 0x8BA0, 0xB1C8, 0x0000, 0xB0E0,
+  0xAEE8, 0xAEE0, 0xAEE0, 0xAEE0, 0xACE8, 0xAEE0, 0xACE0, 0xACE0,
+  0xAAE8, 0xAAE0, 0xA8E0, 0xAAE0, 0xC8E8, 0xE7E0, 0xA8E0, 0xE7E0,
+  0x06E9, 0x65E1, 0x65E1, 0xA6E1, 0x0000, 0x0000, 0x0000, 0x8458,
+  0x65FB, 0x85F4, 0x85FC, 0x65F3, 0x450D, 0x001F, 0xE59C, 0x25F7,
+  0x25F7, 0x25FF, 0x84CC, 0x0000, 0x0000, 0x0000, 0xC490, 0x85F5,
+  0x65FC, 0x85FC, 0x65F3, 0x65FB, 0x8B98, 0xC490, 0xC5E9, 0xC5E9,
+  0x65E1, 0x65E1, 0x06E1, 0x06E9, 0xE7E0, 0x08E1, 0xC8E0, 0xAAE0,
+  0xAAE8, 0xACE0, 0x8EC8, 0xACE0, 0xACE8, 0x453D, 0x001F, 0xAEE8,
+  0x8B98, 0x6B98, 0xAEE0, 0xAEE0, 0xAEE8, 0xACE0, 0xAEE0, 0xACE0,
+  0xACE8, 0xAAE0, 0xACE0, 0xAAE0, 0xAAE8, 0xC8E0, 0x08E1, 0xAAE0,
+  0x26E1, 0x06E9, 0x45E1, 0x45E1, 0xC5E9, 0x27D1, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x85F4, 0x65FC, 0x85FD, 0xA39A, 0x460D, 0x001F,
+  0x2232, 0x46D7, 0x25F7, 0x26D7, 0x64CC, 0x0000, 0x0000, 0x0000,
+  0x65FC, 0x85F5, 0x65FD, 0x85FC, 0xA39A, 0x0000, 0x0000, 0x27D1,
+  0x85F2, 0xC5E9, 0xC5E1, 0x45E1, 0x45E1, 0x08E1, 0x06E9, 0xE7E0,
+  0xE7E0, 0xAAE0, 0xC8E8, 0xC8E0, 0x0000, 0xAAE0, 0xACE0, 0x463D,
+  0x001E, 0xAEE8, 0x8EC8, 0x0000, 0xACE0, 0xACE0, 0xACE8, 0xACE0,
+  0xAAE0, 0xACE0, 0xACE8, 0xAAE0, 0xC8E0, 0xA8E0, 0xC8E8, 0xE7E0,
+  0xA8E0, 0x0000, 0x0000, 0xC6C0, 0x65E1, 0xC5E9, 0xC5E9, 0x85F2,
+  0x0000, 0x0000, 0x0000, 0x6450, 0x85FC, 0x85FD, 0x65FD, 0x470E,
+  0x001E, 0x26CF, 0x46CF, 0x25F7, 0x84CB, 0x0000, 0x0000, 0x0000,
+  0x65FD, 0x65FE, 0x85FD, 0x85FC, 0x0000, 0x0000, 0x65C1, 0x65F3,
+  0x65F2, 0x85F2, 0xE490, 0x6B98, 0x65E1, 0x65E1, 0x06E9, 0x08E1,
+  0x0000, 0x27D1, 0xC8E8, 0x08E1, 0x8AC8, 0xAAE8, 0x4218, 0x473D,
+  0x001E, 0x8450, 0xAEE8, 0x8458, 0x8EC8, 0xACE0, 0xACE8, 0x4218,
+  0xACE0, 0xAAE0, 0xAAE8, 0xC8E0, 0xACE0, 0xC6C0, 0x08E1, 0xE7E0,
+  0x06E1, 0xC6C0, 0x0000, 0x0000, 0x27D1, 0xC5E9, 0x65F2, 0x85F2,
+  0x0000, 0x0000, 0x0000, 0x8450, 0x65FD, 0x65FD, 0x85FE, 0x480E,
+  0x001D, 0x65CD, 0x26CF, 0x26D7, 0x64CC, 0x0000, 0x0000, 0x0000,
+  0x85FD, 0x65FD, 0x85F5, 0x65FC, 0x64CA, 0x65C1, 0x85FC, 0x65F3,
+  0x65F3, 0x65C1, 0x0000, 0xA6E1, 0xC5E9, 0x65E1, 0xE490, 0x0000,
+  0xC6C0, 0xE7E8, 0xE7E0, 0xA8E8, 0xC8E0, 0xA8E0, 0x483E, 0x001D,
+  0xACE0, 0xACE8, 0xAAE0, 0xAAE0, 0xAAE0, 0x8B98, 0x0000, 0x6BA0,
+  0xC8E0, 0xA8E8, 0x8AC8, 0x0000, 0xAAC8, 0x06E1, 0x26E1, 0x65E1,
+  0x4218, 0xC498, 0xA6E9, 0x85F2, 0x85EA, 0x65F3, 0x0000, 0x0000,
+  0x0000, 0xA39A, 0x85FC, 0x85FE, 0x65F4, 0x490E, 0x001D, 0x65D5,
+  0xC7A6, 0x85CD, 0x84CC, 0xA39A, 0x0000, 0x0000, 0x2218, 0x65FE,
+  0x85FE, 0x65F5, 0x85FC, 0x65FD, 0x85FC, 0x85FC, 0xC490, 0x0000,
+  0x8450, 0x85F2, 0xC5E9, 0x0000, 0x0000, 0x08E1, 0x45E1, 0x65E1,
+  0x08E1, 0xC6C0, 0xC8E0, 0xC6C0, 0x493E, 0x001D, 0x8AC8, 0xAAE8,
+  0xACE0, 0xAAE0, 0xAAE0, 0xC8E8, 0x8AC8, 0x0000, 0x0000, 0xE7E0,
+  0x06E9, 0x4218, 0x0000, 0x8B98, 0xC5E9, 0xA6E1, 0xC5E9, 0xA6E1,
+  0x64CA, 0x85F2, 0x65F3, 0xA6E1, 0x0000, 0x0000, 0x0000, 0x84CB,
+  0x65FD, 0x85FE, 0x64CC, 0x4A0E, 0x001C, 0xA362, 0x26D7, 0x86CE,
+  0xA362, 0x65D5, 0x0000, 0x0000, 0x0000, 0x64CC, 0x85FE, 0x65FD,
+  0x65FD, 0x85FD, 0x65F4, 0x64CA, 0x85F2, 0x65F3, 0x65F3, 0x65F2,
+  0x85EA, 0x65C1, 0xC5E9, 0xA6E1, 0x65E1, 0xC490, 0x0000, 0x08E1,
+  0x06E9, 0x4A3F, 0x001C, 0xAAE0, 0xC8E8, 0x0000, 0xE490, 0xE7E0,
+  0xA8E8, 0x08E1, 0x0000, 0x06E1, 0x26E1, 0x65E1, 0x08E1, 0x0000,
+  0x8B58, 0xC5E9, 0xC5E9, 0x85F2, 0x65F2, 0x65F3, 0x65F3, 0x0000,
+  0x0000, 0x0000, 0x64CA, 0x84CB, 0x85CD, 0x65FE, 0x6450, 0x4B0F,
+  0x001B, 0xC7A6, 0x26D7, 0xA362, 0xE59C, 0x65F6, 0x65FD, 0x0000,
+  0x65FE, 0x65FE, 0x65F6, 0x65FE, 0x85FE, 0x65FD, 0x85F5, 0x65FC,
+  0x85FC, 0x65F3, 0x0000, 0x85EA, 0x65F3, 0x85F2, 0xA6E1, 0x0000,
+  0x0000, 0x45E9, 0x65E9, 0xC490, 0x4B40, 0x001A, 0xE7E8, 0xC8E0,
+  0x0000, 0x0000, 0x08E1, 0x06E1, 0x65E1, 0x06E9, 0x8450, 0x08E1,
+  0xC5E9, 0xC5E9, 0x65EA, 0xC5E9, 0x65F3, 0x85F2, 0x65F3, 0x65FB,
+  0x85FC, 0x0000, 0x8450, 0x64CA, 0x65FB, 0x6458, 0x65FE, 0x85FE,
+  0x4C0F, 0x001A, 0x65CD, 0xC7A6, 0xA7A6, 0x0000, 0x64D4, 0x86CE,
+  0x25FF, 0x25F7, 0xA362, 0x0000, 0xA39A, 0x0000, 0x85FC, 0x65FD,
+  0x85FD, 0x84CB, 0x0000, 0x0000, 0x65F2, 0x85EA, 0x6450, 0x0000,
+  0x8458, 0xC5E9, 0xC5E9, 0x27D1, 0x4C40, 0x001A, 0xC6C0, 0x08E1,
+  0xE7E8, 0x4218, 0x0000, 0x8458, 0x08E1, 0x65E9, 0x0000, 0x0000,
+  0x27D1, 0x85F2, 0x65EA, 0x85F2, 0xC490, 0xC490, 0x0000, 0x8458,
+  0x85FC, 0x85FD, 0x84CB, 0x64CA, 0x0000, 0xA39A, 0x85FE, 0x65FD,
+  0x4D0F, 0x001A, 0x64CB, 0xC7A6, 0xC7A6, 0x0000, 0x0000, 0xE59C,
+  0x25F7, 0xE59C, 0x0000, 0x0000, 0x0000, 0x0000, 0x65FD, 0x65FE,
+  0x85F5, 0x0000, 0x0000, 0x65FC, 0x65FB, 0x0000, 0x0000, 0x4218,
+  0x85EA, 0x85F2, 0xC5E9, 0xC6E1, 0x4D40, 0x001A, 0x08E1, 0x08E1,
+  0x27D1, 0x06E9, 0x8450, 0x0000, 0x0000, 0xA6E1, 0xC5E9, 0x0000,
+  0x0000, 0x85F2, 0x65F3, 0x65FB, 0x0000, 0x0000, 0x0000, 0x0000,
+  0xA39A, 0x65F5, 0x85FC, 0x0000, 0x0000, 0x64CC, 0x25F7, 0x84CB,
+  0x4E10, 0x0018, 0x6786, 0xC7A6, 0x0000, 0x86D6, 0x26D7, 0xA39A,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x65FC, 0x85FE, 0x65F5, 0x64CA,
+  0x0000, 0x65FD, 0x65F3, 0x0000, 0x0000, 0x0000, 0x85F2, 0x65F3,
+  0x65F2, 0x85EA, 0x4E40, 0x0019, 0x4218, 0x45E9, 0x45E1, 0x27D1,
+  0x65E9, 0x8450, 0x0000, 0x0000, 0xA6E9, 0x85F2, 0x0000, 0xC490,
+  0x65F3, 0x65F3, 0x85F2, 0x0000, 0x0000, 0x0000, 0x0000, 0x84CB,
+  0x85FD, 0x65F4, 0x0000, 0x85FE, 0x25F7, 0x4F10, 0x0018, 0x6786,
+  0x6786, 0xA7A6, 0xC7A6, 0x86D6, 0xA36A, 0x0000, 0x0000, 0x0000,
+  0x2218, 0x25F7, 0x65FE, 0x85FE, 0xC490, 0x65F6, 0x85FC, 0x0000,
+  0x0000, 0x0000, 0x65F3, 0x85FC, 0x65F3, 0x65FB, 0xA6E1, 0x4F41,
+  0x0018, 0x27D1, 0x65EA, 0xC5E9, 0x85F2, 0xA6E1, 0x0000, 0x0000,
+  0x0000, 0x85EA, 0x65F3, 0x0000, 0x65FC, 0x85F4, 0x65FD, 0x65C1,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x65FE, 0x65FE, 0x65FE, 0x25F7,
+  0x65FE, 0x5010, 0x0017, 0xA664, 0x6786, 0x6786, 0xE59C, 0xC7AE,
+  0x26D7, 0x66CE, 0x65CD, 0x85FC, 0x25F7, 0x65FE, 0x0000, 0x65FE,
+  0x65FE, 0x64CC, 0x0000, 0x0000, 0x0000, 0x85EA, 0x65FC, 0x85F4,
+  0x65FC, 0x65F3, 0x5042, 0x0017, 0xA6E1, 0x85F2, 0x85EA, 0x65F2,
+  0xA6E1, 0x0000, 0x0000, 0x0000, 0x85F2, 0x85F4, 0x65FC, 0x64CA,
+  0x84CB, 0x85F5, 0x84CB, 0x84CB, 0x84CB, 0x65FE, 0x65FE, 0x6450,
+  0x85FE, 0x25F7, 0xA39A, 0x5111, 0x0016, 0x086E, 0x6786, 0xE59C,
+  0xC7A6, 0x65CD, 0x86CE, 0x84CB, 0x25FF, 0x25F7, 0x0000, 0xA362,
+  0x25F7, 0x25F7, 0x65FE, 0x85FD, 0x65FD, 0x85F5, 0x65FD, 0x85FD,
+  0x65FD, 0x85F4, 0x64CA, 0x5142, 0x0016, 0xA6E1, 0x85F2, 0x65F3,
+  0x65FB, 0x65F3, 0x65EA, 0x65FB, 0x65F3, 0x65F3, 0x85F4, 0x65FD,
+  0x85FC, 0x0000, 0x65F5, 0x85FE, 0xA39A, 0x65FD, 0x65FE, 0x25FF,
+  0x65CD, 0x25F7, 0x46D7, 0x5211, 0x0015, 0x286E, 0x086E, 0x0000,
+  0xE59C, 0xA362, 0xE59C, 0x26D7, 0x26D7, 0xA39A, 0x0000, 0x25F7,
+  0x25F7, 0x25FF, 0x25F7, 0x85FE, 0x65FE, 0x65FE, 0x65F5, 0x65FE,
+  0x65FD, 0x85F4, 0x5243, 0x0015, 0x65F3, 0x65FB, 0x65F4, 0x65F3,
+  0x85FC, 0x65FC, 0x85F4, 0x65FC, 0x85F5, 0x65FD, 0x85FE, 0x0000,
+  0xA362, 0x65FE, 0x65FE, 0x64CC, 0xA39A, 0x84CB, 0x4232, 0x26CF,
+  0x86D6, 0x5311, 0x0015, 0xA36A, 0x086E, 0x6786, 0x6786, 0x6786,
+  0xC7A6, 0xA7A6, 0x86CE, 0x0000, 0x25F7, 0x26CF, 0x85FD, 0x64CC,
+  0x85FD, 0x64CC, 0x25F7, 0x65FE, 0x25F7, 0x65FE, 0x85FE, 0x8458,
+  0x5343, 0x0015, 0xC490, 0x65F4, 0x85FC, 0x65FD, 0x85F4, 0x65FD,
+  0x65F3, 0x84CB, 0x85FC, 0x64CC, 0x65F6, 0x65FD, 0x0000, 0x85FE,
+  0x25FF, 0x25F7, 0x64CB, 0x65FE, 0x46CF, 0x25FF, 0x6450, 0x5412,
+  0x0013, 0xA84D, 0x286E, 0x086E, 0x6786, 0x6786, 0x2232, 0xE59C,
+  0x86D6, 0xC7A6, 0x66D6, 0x65CD, 0x85CD, 0x26D7, 0x25F7, 0x25F7,
+  0x25FF, 0x65FE, 0x65FE, 0x84CB, 0x5444, 0x0013, 0x84CB, 0x65F5,
+  0x85FC, 0x65FD, 0x85F5, 0x65FE, 0x65FD, 0x65F3, 0x84CB, 0x85FE,
+  0x65FE, 0x64CC, 0x65CD, 0x84CB, 0x86CE, 0x25F7, 0x26CF, 0x26D7,
+  0x86CE, 0x5512, 0x0012, 0xC834, 0x492D, 0x286E, 0xE59C, 0xE59C,
+  0xA36A, 0xA7A6, 0xC7A6, 0xE59C, 0xA39A, 0x26CF, 0x46D7, 0x25F7,
+  0x25F7, 0x25F7, 0x25F7, 0x25F7, 0x65FD, 0x5545, 0x0012, 0x65FC,
+  0x85F6, 0x65FD, 0x65FE, 0x65FE, 0x65FE, 0x65FE, 0x25F7, 0x85FC,
+  0xA362, 0x25F7, 0x25FF, 0x84CB, 0xA39A, 0x65CD, 0x26CF, 0x26D7,
+  0xA362, 0x5613, 0x0010, 0xA855, 0x492D, 0x0000, 0xE5A4, 0x6786,
+  0x2866, 0xC7AE, 0xE59C, 0xA7A6, 0xC7A6, 0x26D7, 0x26CF, 0x25FF,
+  0x26CF, 0x25F7, 0x65FE, 0x5646, 0x0010, 0x65FD, 0x65FE, 0x65FE,
+  0x25F7, 0x65FE, 0x25F7, 0x25F7, 0x25F7, 0xA39A, 0x85FE, 0x26CF,
+  0x65CD, 0x84CB, 0xE59C, 0xC7A6, 0xA7AE, 0x5713, 0x000F, 0x4220,
+  0x492D, 0xA84D, 0x6786, 0x086E, 0x6786, 0xE59C, 0xC7A6, 0xA7AE,
+  0xC7A6, 0xA7A6, 0x26CF, 0x26CF, 0x26CF, 0x26CF, 0x5747, 0x000E,
+  0x65FE, 0x25FF, 0x25F7, 0x25F7, 0x25F7, 0x25FF, 0x25F7, 0x25F7,
+  0x86D6, 0x26CF, 0x26CF, 0x26D7, 0xA7A6, 0xC7A6, 0x5814, 0x000D,
+  0xA66C, 0x692D, 0x492D, 0xA84D, 0xA855, 0x286E, 0x286E, 0x6786,
+  0x6786, 0xA7A6, 0xC7A6, 0xA7A6, 0xC7AE, 0x5848, 0x000D, 0x65FC,
+  0x25F7, 0x26CF, 0x25F7, 0x26D7, 0x25F7, 0x26CF, 0x26CF, 0x86D6,
+  0x26CF, 0xA7A6, 0xC7A6, 0xA39A, 0x5915, 0x000B, 0xA855, 0x492D,
+  0x492D, 0xA84D, 0xA84D, 0x286E, 0x086E, 0x6786, 0x6786, 0xC7A6,
+  0x85CD, 0x5949, 0x000B, 0x64CB, 0x25F7, 0x26CF, 0x25F7, 0x26D7,
+  0x26CF, 0xC7A6, 0x26D7, 0xA7A6, 0xC7AE, 0xE59C, 0x5A16, 0x0009,
+  0xA66C, 0x692D, 0x492D, 0xA855, 0xA84D, 0x286E, 0xA855, 0x6786,
+  0xA36A, 0x5A4A, 0x0009, 0xA362, 0x26D7, 0xC7A6, 0x26CF, 0xA7A6,
+  0xC7A6, 0x6786, 0x6786, 0xA66C, 0x5B17, 0x0006, 0x223A, 0xA84D,
+  0xA84D, 0x086E, 0x286E, 0xA664, 0x5B4C, 0x0006, 0xE59C, 0x65D5,
+  0xC7A6, 0xA7A6, 0xC7AE, 0x2232, 0x0006, 0x0005, 0xEA04, 0xEA04,
+  0xEA04, 0xC834, 0x423A, 0x005E, 0x0005, 0x223A, 0xC834, 0xEA04,
+  0x2A15, 0xEA04, 0x010A, 0x0003, 0x2A15, 0x0A15, 0xC834, 0x015C,
+  0x0009, 0xC83C, 0xC83C, 0x2A15, 0xEA04, 0xEA04, 0xEA04, 0xEA04,
+  0xEA04, 0x492D, 0x0203, 0x0001, 0xEA04, 0x020D, 0x0003, 0xEA04,
+  0x0A15, 0x4232, 0x0259, 0x0007, 0x223A, 0xC834, 0xEA04, 0xEA04,
+  0xEA04, 0xEA04, 0xEA04, 0x0265, 0x0001, 0xEA04, 0x0310, 0x0002,
+  0x2A15, 0xC834, 0x0357, 0x000A, 0xA66C, 0x0A15, 0xEA04, 0xEA04,
+  0xEA04, 0xEA04, 0xEA04, 0xEA04, 0xEA04, 0xEA04, 0x0366, 0x0001,
+  0x2A15, 0x0401, 0x0001, 0xEA04, 0x040F, 0x0005, 0xEA04, 0xEA04,
+  0xEA04, 0xEA04, 0xC83C, 0x0455, 0x000D, 0xA84D, 0xEA04, 0xEA04,
+  0xEA04, 0xEA04, 0xEA04, 0xEA04, 0xEA04, 0xEA04, 0xEA04, 0xEA04,
+  0xEA04, 0xEA04, 0x0467, 0x0001, 0x423A, 0x0501, 0x0001, 0xEA04,
+  0x050E, 0x0008, 0xEA04, 0xEA04, 0xEA04, 0xEA04, 0xEA04, 0xEA04,
+  0xEA04, 0xC834, 0x0553, 0x0015, 0xA66C, 0x492D, 0x2A15, 0xEA04,
+  0xEA04, 0xEA04, 0xEA04, 0xEA04, 0xEA04, 0xEA04, 0xEA04, 0xEA04,
+  0xEA04, 0xEA04, 0xEA04, 0xEA04, 0xEA04, 0xEA04, 0xEA04, 0xEA04,
+  0x0A15, 0x0600, 0x0007, 0xEE09, 0xEA04, 0xEA04, 0xEA04, 0xEA04,
+  0x0000, 0x2A15, 0x060D, 0x000B, 0xEA04, 0xEA04, 0xEA04, 0xEA04,
+  0xEA04, 0xEA04, 0xEA04, 0xEA04, 0xEA04, 0xEA04, 0xA855, 0x0651,
+  0x0017, 0xE59C, 0xA855, 0xA84D, 0x692D, 0x0A15, 0x2A15, 0xEA04,
+  0xEA04, 0xEA04, 0xEA04, 0xEA04, 0xEA04, 0xEA04, 0xEA04, 0xEA04,
+  0xEA04, 0xEA04, 0xEA04, 0xC83C, 0x0000, 0xEA04, 0xEA04, 0x0A15,
+  0x0700, 0x001A, 0xC83C, 0xEA04, 0xEA04, 0xEA04, 0xEA04, 0x0A15,
+  0x692D, 0x0A15, 0xEA04, 0xEA04, 0xC834, 0x423A, 0xEA04, 0xC834,
+  0x492D, 0xEA04, 0xEA04, 0xEA04, 0xEA04, 0xEA04, 0xEA04, 0xEA04,
+  0xEA04, 0xEA04, 0x2A15, 0xA664, 0x074F, 0x001A, 0x65D5, 0x6786,
+  0x086E, 0x286E, 0xA84D, 0xA855, 0x692D, 0x492D, 0x2A15, 0x0A15,
+  0xEA04, 0xEA04, 0x2A15, 0x492D, 0xEA04, 0xA66C, 0xEA04, 0xEA04,
+  0xEA04, 0x2A15, 0xC83C, 0xC834, 0xEA04, 0xEA04, 0xEA04, 0xC83C,
+  0x0800, 0x001C, 0xEA04, 0xEA04, 0xEA04, 0xEA04, 0xEA04, 0xEA04,
+  0xEA04, 0x0000, 0xEA04, 0xEA04, 0x2A15, 0x0000, 0x0A15, 0x692D,
+  0x0000, 0x492D, 0xEA04, 0xEA04, 0xEA04, 0x2A15, 0xEA04, 0xEA04,
+  0xEA04, 0xEA04, 0x0A15, 0x692D, 0x4935, 0xE5A4, 0x084D, 0x001C,
+  0x84CC, 0xC7A6, 0xA7A6, 0xC7A6, 0xA7AE, 0x2866, 0x086E, 0xA84D,
+  0xA855, 0x492D, 0x692D, 0x0A15, 0x2A15, 0xA36A, 0x0000, 0xC834,
+  0xA855, 0x0000, 0x0A15, 0xEA04, 0x692D, 0xC834, 0xEA04, 0xEA04,
+  0xEA04, 0xEA04, 0xEA04, 0x0A15, 0x0900, 0x0001, 0x2A15, 0x0906,
+  0x0018, 0xC834, 0xEA04, 0xEA04, 0xEA04, 0xEA04, 0x0000, 0x223A,
+  0x2A15, 0x0000, 0x0000, 0x0A15, 0xEA04, 0x2A15, 0xA66C, 0x0A15,
+  0xEA04, 0x2A15, 0x0A15, 0x692D, 0x492D, 0xA84D, 0xA84D, 0x8786,
+  0xA39A, 0x094B, 0x001E, 0x64CB, 0x25F7, 0x26D7, 0x26CF, 0x26CF,
+  0x26D7, 0xC7A6, 0xA7AE, 0x6786, 0x6786, 0x286E, 0x286E, 0x492D,
+  0x692D, 0x492D, 0x0000, 0xA66C, 0x692D, 0x0000, 0x4220, 0xEA04,
+  0xEA04, 0xEA04, 0x0A15, 0x4218, 0xA855, 0xEA04, 0xEA04, 0xEA04,
+  0x2A15, 0x0A00, 0x0020, 0xEA04, 0xEA04, 0xEA04, 0xEA04, 0xEA04,
+  0x0A15, 0x0000, 0xC834, 0xEA04, 0xEA04, 0xEA04, 0xEA04, 0xEA04,
+  0xEA04, 0xC83C, 0x0000, 0x2A15, 0xA66C, 0xEA04, 0xEA04, 0xA66C,
+  0xA664, 0x0A15, 0x692D, 0x492D, 0xA855, 0xA84D, 0x6786, 0x6786,
+  0xC7AE, 0xC7A6, 0x2218, 0x0A49, 0x0020, 0x8458, 0x85FE, 0x25FF,
+  0x25FF, 0x25F7, 0x26CF, 0x25F7, 0x26D7, 0x26CF, 0xA7A6, 0xC7A6,
+  0xE59C, 0x6786, 0xA84D, 0x086E, 0xA66C, 0x286E, 0x0000, 0x492D,
+  0x0A0D, 0xA855, 0xEA04, 0xEA04, 0xEA04, 0x2A15, 0x0000, 0x0000,
+  0x0A15, 0xEA04, 0xEA04, 0xEA04, 0xEA04, 0x0B00, 0x0021, 0x0A15,
+  0xEA04, 0xEA04, 0xEA04, 0xEA04, 0xEA04, 0x692D, 0xC834, 0x0A15,
+  0xEA04, 0xEA04, 0xEA04, 0xEA04, 0xEA04, 0xEA04, 0xA66C, 0xA84D,
+  0x0000, 0x692D, 0xEA04, 0x0A15, 0x0000, 0xE5A4, 0x492D, 0xA84D,
+  0x2866, 0x6786, 0x6786, 0xA7A6, 0xC7A6, 0x26D7, 0x26CF, 0x64CC,
+  0x0B48, 0x0021, 0x65F3, 0x65FE, 0x25F7, 0x65FE, 0x25F7, 0x25F7,
+  0x25FF, 0x25F7, 0x25F7, 0x26D7, 0x46D7, 0x4232, 0xA39A, 0x6786,
+  0x6786, 0xA664, 0xA66C, 0xA66C, 0xE59C, 0x0A15, 0x2A15, 0xEA04,
+  0xEA04, 0xEA04, 0xEA04, 0x0A15, 0xA855, 0xC834, 0xEA04, 0xEA04,
+  0xEA04, 0xEA04, 0x2A15, 0x0C00, 0x0001, 0xEA04, 0x0C06, 0x001C,
+  0xEA04, 0x2A15, 0xEA04, 0xEA04, 0x0A15, 0xC83C, 0xC834, 0x2A15,
+  0xEA04, 0xEA04, 0xEA04, 0x0000, 0x0A15, 0xA66C, 0xC834, 0x692D,
+  0xA66C, 0x286E, 0x6458, 0x6786, 0x6786, 0xC7AE, 0xC7A6, 0x26D7,
+  0x26CF, 0x25F7, 0x25FF, 0x65FD, 0x0C47, 0x0022, 0x65F4, 0x85FD,
+  0x65FD, 0x85FD, 0x65F6, 0x65FE, 0x25F7, 0x65FE, 0x25F7, 0x86CE,
+  0x65CD, 0x86D6, 0x65CD, 0xC7A6, 0xA7A6, 0xE59C, 0xE5A4, 0x6458,
+  0xA84D, 0x692D, 0x692D, 0xC834, 0xA66C, 0xA36A, 0x0A15, 0xEA04,
+  0x692D, 0x0A15, 0xEA04, 0xEA04, 0xEA04, 0xEA04, 0xEA04, 0x2A15,
+  0x0D00, 0x0001, 0xC83C, 0x0D07, 0x001C, 0xC83C, 0xEA04, 0xEA04,
+  0x492D, 0xC834, 0xA855, 0xEA04, 0x692D, 0xA66C, 0xEA04, 0xEA04,
+  0x0A0D, 0xA66C, 0x0000, 0xA855, 0xA84D, 0x2866, 0xE59C, 0x85D5,
+  0x6458, 0xA7A6, 0x26CF, 0x26CF, 0x25F7, 0x25FF, 0x25F7, 0x25F7,
+  0x85F6, 0x0D46, 0x0023, 0x65FC, 0x85F4, 0x65FD, 0x85FD, 0x65FD,
+  0x65F5, 0x65FE, 0x85FE, 0x65F4, 0x65FC, 0x85FE, 0xA39A, 0x25FF,
+  0x26CF, 0x26D7, 0x0000, 0xA7A6, 0x6786, 0x6786, 0x286E, 0x286E,
+  0x492D, 0xA84D, 0xA66C, 0xA66C, 0x692D, 0xEA04, 0xEA04, 0xC834,
+  0x492D, 0xEA04, 0xEA04, 0xEA04, 0xEA04, 0xA66C, 0x0E00, 0x0024,
+  0x4232, 0xEA04, 0xEA04, 0xEA04, 0xEA04, 0xEA04, 0x0A15, 0x0000,
+  0xEA04, 0xEA04, 0x0000, 0x0000, 0x0000, 0xC83C, 0xC834, 0x0000,
+  0xC83C, 0x692D, 0x0A15, 0x692D, 0x0000, 0x0000, 0xA855, 0x6786,
+  0x6786, 0xC7AE, 0xA7A6, 0x26D7, 0x26CF, 0x25F7, 0x25F7, 0x25FF,
+  0x65FE, 0x65FE, 0x65F6, 0x65FD, 0x0E45, 0x0023, 0x65F3, 0x65F3,
+  0x85FC, 0x65F3, 0x65FC, 0x85F4, 0x65FD, 0x85FD, 0x65FE, 0x65F5,
+  0x85FE, 0x65FE, 0x25F7, 0x25F7, 0x25F7, 0x0000, 0x0000, 0xA7A6,
+  0xC7A6, 0x6786, 0x6786, 0x0000, 0x086E, 0x0000, 0x0000, 0x0000,
+  0xA664, 0xEA04, 0x0A15, 0x0000, 0x2A15, 0xEA04, 0xEA04, 0xEA04,
+  0x0A15, 0x0F06, 0x001F, 0x0A15, 0x0000, 0xEA04, 0xEA04, 0x6935,
+  0x492D, 0x692D, 0xC834, 0x492D, 0x692D, 0x492D, 0xA36A, 0xA855,
+  0x492D, 0x2866, 0x0000, 0xA7A6, 0x6786, 0xC7A6, 0xA7A6, 0x65FE,
+  0x86CE, 0x65FE, 0x65FE, 0x25FF, 0x25F7, 0x25F7, 0x65F6, 0x65FE,
+  0x85FD, 0x65F4, 0x0F44, 0x0024, 0x85F2, 0x65F2, 0x65F3, 0x65F3,
+  0x65F3, 0x65F3, 0x85FC, 0x65F4, 0x85FC, 0x65F4, 0x65FE, 0x65FE,
+  0x65FE, 0x25F7, 0x25FF, 0x0000, 0x0000, 0x26CF, 0x26CF, 0x85D5,
+  0x65CD, 0x6786, 0xE59C, 0x086E, 0x286E, 0xA66C, 0xE59C, 0xA66C,
+  0xEA04, 0x692D, 0x0000, 0xEA04, 0xEA04, 0xEA04, 0xEA04, 0xC83C,
+  0x1002, 0x0024, 0xEA04, 0xEA04, 0xEA04, 0xEA04, 0xEA04, 0xEA04,
+  0xEA04, 0xEA04, 0xEA04, 0xEA04, 0xC83C, 0xA66C, 0xEA04, 0x2A15,
+  0xA66C, 0xA664, 0xA66C, 0xA84D, 0xA84D, 0x6786, 0x6458, 0xC7AE,
+  0xC7A6, 0x26D7, 0x64CC, 0x0000, 0x0000, 0x0000, 0x0000, 0x85FE,
+  0x65FD, 0x65FD, 0x85F4, 0x65FC, 0x85F4, 0x65F3, 0x102C, 0x0002,
+  0x27D1, 0xC490, 0x1043, 0x0024, 0xC6E1, 0xC5E9, 0xC5E9, 0xC5E9,
+  0x85EA, 0x85F2, 0x65F3, 0x65F2, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x65F3, 0x85FD, 0x65F6, 0x65FD, 0x0000, 0x85FE, 0x25F7, 0x66CE,
+  0x64CC, 0xC7A6, 0xC7A6, 0x6786, 0x086E, 0xA664, 0x286E, 0x492D,
+  0x0A15, 0xEA04, 0xEA04, 0x2A15, 0xEA04, 0xEA04, 0xEA04, 0xEA04,
+  0x1102, 0x000D, 0xC83C, 0xEA04, 0xEA04, 0xEA04, 0xEA04, 0xEA04,
+  0x692D, 0xC834, 0xA855, 0xEA04, 0x0A0D, 0xEA04, 0xA84D, 0x1114,
+  0x0013, 0x65D5, 0x6786, 0xC7A6, 0xC7A6, 0x65CD, 0x0000, 0x25FF,
+  0x85FE, 0x0000, 0x0000, 0x0000, 0x6450, 0x85F5, 0x65FC, 0x85F4,
+  0x65FC, 0x85FC, 0x65F3, 0x85F2, 0x112C, 0x0002, 0xC6E1, 0x06E1,
+  0x113B, 0x0002, 0xC8E0, 0x08E1, 0x1142, 0x0025, 0x06E1, 0x65E9,
+  0xA6E1, 0x45E1, 0xC5E1, 0xC5E9, 0x65F2, 0x85EA, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x65FC, 0x85FD, 0x0000, 0x65F5, 0x65FE, 0x65FE,
+  0x45FF, 0xA3A2, 0x0000, 0x0000, 0x0000, 0x4218, 0xA66C, 0x6786,
+  0x6786, 0xA855, 0xA84D, 0xA84D, 0xE5A4, 0x0A15, 0xEA04, 0xEA04,
+  0xEA04, 0xEA04, 0xC834, 0x1203, 0x0005, 0x0A15, 0xEA04, 0xEA04,
+  0xEA04, 0x692D, 0x120D, 0x0002, 0x0A15, 0x2A15, 0x1215, 0x0019,
+  0xC7AE, 0xC7A6, 0x26D7, 0x66D6, 0x0000, 0x0000, 0x65FE, 0x65FE,
+  0x4218, 0x0000, 0x0000, 0xC490, 0x85FC, 0x65F3, 0x65F2, 0x85F2,
+  0x65EA, 0x85F2, 0xA6E1, 0x0000, 0x0000, 0x0000, 0x0000, 0x8AC8,
+  0x06E1, 0x123B, 0x0001, 0xC8E8, 0x1241, 0x0014, 0xACE8, 0xE7E0,
+  0x06E1, 0x06E1, 0x65E9, 0x08E1, 0xC5E9, 0x65E1, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x65F3, 0x65F3, 0xC490, 0x0000, 0x85FD, 0x85FD,
+  0x65FE, 0x65FD, 0x125B, 0x000B, 0xC7A6, 0x2866, 0xE59C, 0x0000,
+  0x0000, 0x0000, 0x0000, 0xC834, 0xEA04, 0xEA04, 0x492D, 0x1303,
+  0x0005, 0xC83C, 0xEA04, 0xEA04, 0xEA04, 0x692D, 0x130E, 0x0003,
+  0x492D, 0x0A15, 0xA664, 0x1316, 0x0019, 0x26CF, 0x46CF, 0x25F7,
+  0x84CB, 0x0000, 0x0000, 0x65FD, 0x85FD, 0x64CA, 0x0000, 0x0000,
+  0x4218, 0x65F3, 0x85F2, 0x65C1, 0xC5E9, 0x85EA, 0xC5E9, 0xC6C0,
+  0x0000, 0x0000, 0x0000, 0x0000, 0xAAE8, 0x27D1, 0x133A, 0x001A,
+  0x08E1, 0xACE0, 0x0000, 0x0000, 0x0000, 0x0000, 0x8AC8, 0xC8E0,
+  0x08E1, 0xE7E8, 0x08E1, 0x08E1, 0x65E1, 0x06E1, 0x0000, 0x0000,
+  0x0000, 0x65C1, 0x65F3, 0x65F2, 0x0000, 0x0000, 0x65F3, 0x65FD,
+  0x85FE, 0x65FD, 0x1359, 0x0003, 0xA39A, 0x46D7, 0x65D5, 0x1362,
+  0x0003, 0xA84D, 0xEA04, 0xEA04, 0x1404, 0x002B, 0xEA04, 0xEA04,
+  0xEA04, 0x0A15, 0x0000, 0x0000, 0x0000, 0x0000, 0x4232, 0xA66C,
+  0xC834, 0x492D, 0x692D, 0xA3A2, 0x0000, 0x0000, 0xC498, 0x4232,
+  0x86D6, 0x25FF, 0x25F7, 0x25F7, 0xA39A, 0x0000, 0x0000, 0x84CB,
+  0x85FC, 0x65FB, 0x0000, 0x0000, 0x0000, 0xC5E9, 0xC5E9, 0x27D1,
+  0xE8E0, 0x65E1, 0x06E1, 0x0000, 0x0000, 0x0000, 0x0000, 0xAEC8,
+  0xAAE0, 0x143A, 0x002B, 0x8EC8, 0x8B98, 0x0000, 0x0000, 0x0000,
+  0x4218, 0xA8E8, 0xAAE8, 0xC8E8, 0xAAE0, 0xA8E0, 0xE7E0, 0xC8E8,
+  0x0000, 0x0000, 0x0000, 0x08E1, 0xC5E9, 0x65C1, 0x0000, 0x0000,
+  0xA6E1, 0x85F3, 0x85FC, 0x65F4, 0x65F3, 0x0000, 0xA362, 0x4218,
+  0x0000, 0x84D3, 0x25FF, 0x46CF, 0x66CE, 0x65CD, 0x4232, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0A15, 0xEA04, 0xEA04, 0x1504, 0x002C,
+  0x0A0D, 0xEA04, 0xEA04, 0xEA04, 0x0000, 0x0000, 0x0000, 0xA66C,
+  0xA84D, 0xA66C, 0x2232, 0x0000, 0x286E, 0x0866, 0x6786, 0x6786,
+  0x26D7, 0x26CF, 0x46CF, 0x25F7, 0x25FF, 0x25F7, 0x25F7, 0x65F4,
+  0x0000, 0x85FC, 0x85F4, 0x65F3, 0x85FC, 0xA6E9, 0x0000, 0x0000,
+  0x27D1, 0x45E1, 0x65E1, 0x08E1, 0x06E1, 0xC8E8, 0x0000, 0x0000,
+  0x0000, 0x0000, 0xACE8, 0x6B98, 0x1539, 0x002C, 0xD1A8, 0xAEE0,
+  0x0000, 0x0000, 0x0000, 0x0000, 0xACE0, 0xACE8, 0xAAE0, 0xACE0,
+  0xAAE0, 0xAAE8, 0xAAE0, 0x0000, 0x0000, 0x08E1, 0x06E1, 0x65E1,
+  0x45E9, 0xC490, 0x0000, 0x85EA, 0x65F2, 0x85F4, 0x65FC, 0x85F4,
+  0x65FC, 0x65FE, 0x65FE, 0x25F7, 0x65FE, 0x25F7, 0x86D6, 0x0000,
+  0x65CD, 0x86D6, 0xC7A6, 0xA3A2, 0x0000, 0x0000, 0x4220, 0x492D,
+  0xEA04, 0x692D, 0x1604, 0x002C, 0x2A15, 0xEA04, 0xEA04, 0xEA04,
+  0xA36A, 0x0000, 0xC834, 0xA855, 0x0000, 0x0000, 0x0000, 0x0000,
+  0xE59C, 0x286E, 0x6786, 0xA7A6, 0xC7AE, 0x26CF, 0x66D6, 0x65CD,
+  0x4218, 0x84CB, 0x85FD, 0x65FE, 0x65FC, 0x85FC, 0x65EA, 0x8450,
+  0x85F2, 0x65F2, 0xC5E9, 0xA6E1, 0x0000, 0x0000, 0x06E1, 0x26E9,
+  0xC8E0, 0xA8E0, 0xAEC8, 0x0000, 0x0000, 0x0000, 0x8EC8, 0xAEE8,
+  0x1639, 0x002C, 0xAEE0, 0xAEC8, 0x0000, 0x0000, 0x0000, 0x8EC8,
+  0xAEE8, 0xACE0, 0xACE0, 0xAAE8, 0xACE0, 0x0000, 0x0000, 0xAEC8,
+  0xA8E0, 0xC8E8, 0x08E1, 0x8AC8, 0x65E1, 0x45E1, 0xC5E9, 0xC5E9,
+  0x85EA, 0x85F2, 0x65EA, 0x85F2, 0x65F4, 0x85FC, 0x65FE, 0x65F6,
+  0x25F7, 0x25F7, 0x84CB, 0x0000, 0x0000, 0x0000, 0xA39A, 0xE59C,
+  0xA3A2, 0x0000, 0xE59C, 0x2A0D, 0x2A15, 0xC83C, 0x1704, 0x002D,
+  0xA84D, 0xEA04, 0xEA04, 0xEA04, 0xA855, 0x2232, 0x492D, 0x0000,
+  0x0000, 0x0000, 0x0000, 0xE59C, 0x286E, 0x6786, 0xC7A6, 0x65CD,
+  0x26CF, 0x26D7, 0x25F7, 0x25F7, 0x85FE, 0x0000, 0x0000, 0x6450,
+  0x85FD, 0x85FC, 0x64CA, 0x0000, 0x0000, 0x65C1, 0xC5E9, 0x65E1,
+  0x45E1, 0x08E1, 0x08E1, 0xE7E8, 0xC8E0, 0xAAE8, 0x08E1, 0x6B98,
+  0x0000, 0x0000, 0x8458, 0xAEE0, 0x8BA0, 0x1738, 0x002D, 0xD178,
+  0xB1C8, 0x0000, 0x0000, 0x0000, 0x8B58, 0xB0E0, 0xAEE0, 0xAEE8,
+  0xACE0, 0xAEE8, 0x8450, 0xACE0, 0xAAE8, 0xAAE0, 0xC8E0, 0x08E1,
+  0x0000, 0x0000, 0x08E1, 0x45E1, 0x65E9, 0x6B98, 0x0000, 0x0000,
+  0x65EA, 0x85FC, 0x65F4, 0x85FD, 0x65FD, 0x65FD, 0x85FE, 0x25F7,
+  0x25FF, 0x0000, 0x0000, 0x0000, 0x0000, 0x64CC, 0x6786, 0x0000,
+  0x286E, 0xA855, 0x0A0D, 0xA66C, 0x1805, 0x002C, 0xEA04, 0xEA04,
+  0xEA04, 0x2A15, 0xA84D, 0xA66C, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x286E, 0x086E, 0xC7A6, 0x65CD, 0x86D6, 0x0000, 0x64CB, 0x25F7,
+  0x25FF, 0x85FE, 0x65FE, 0xC490, 0x0000, 0x27D1, 0x65FC, 0x85EA,
+  0x65F2, 0x4218, 0x0000, 0x0000, 0x45E9, 0x06E1, 0xE7E0, 0xC8E0,
+  0xC8E8, 0xA8E0, 0xAAE0, 0xACE0, 0xACE8, 0x0000, 0x0000, 0x0000,
+  0xB1C8, 0xAEC8, 0x1838, 0x002D, 0xB1C8, 0xB1C8, 0x0000, 0x0000,
+  0x0000, 0xB0E0, 0xAEE8, 0xB1C8, 0xAEE0, 0xAEE8, 0xACE0, 0xAEE0,
+  0xACE0, 0xACE8, 0xAAE0, 0x8450, 0x0000, 0x4218, 0xA8E8, 0xE7E8,
+  0x06E1, 0x27D1, 0x0000, 0xE490, 0xC5E9, 0x85F2, 0x85F2, 0x65F3,
+  0x64CA, 0x65F2, 0x85F4, 0x65FD, 0x85FE, 0x25F7, 0x65FD, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x65CD, 0xE59C, 0x2866, 0x492D, 0x692D,
+  0x223A, 0x1905, 0x0005, 0xEA04, 0xEA04, 0xEA04, 0xEA04, 0x0A15,
+  0x190F, 0x0022, 0x286E, 0x6786, 0xA7A6, 0x86CE, 0xA362, 0x0000,
+  0x0000, 0x84CB, 0x65FE, 0x65FE, 0x85FD, 0x85FD, 0x64CA, 0xA39A,
+  0x65F3, 0x65EA, 0x85F2, 0x85EA, 0x45E9, 0x8BA0, 0x4218, 0x06E1,
+  0xC8E8, 0x6B98, 0x4218, 0xACE8, 0xAAE0, 0xACE0, 0xACE8, 0xB1C8,
+  0x0000, 0x0000, 0x8B60, 0xB0E8, 0x1938, 0x002C, 0xB1C8, 0x8B58,
+  0x0000, 0x0000, 0xB1C8, 0xB0E0, 0xB0E0, 0xB0E0, 0xB0E0, 0xAEE8,
+  0xD1A8, 0x8EC8, 0xAEE8, 0xACE8, 0x0000, 0x4218, 0xACE0, 0xAAE0,
+  0xC8E0, 0xC8E8, 0x06E1, 0x0000, 0xC6C0, 0x45E1, 0x65EA, 0x85F2,
+  0x65FB, 0xC490, 0x0000, 0x0000, 0x65F3, 0x65FD, 0x65FE, 0x65FE,
+  0x25F7, 0x0000, 0x0000, 0x0000, 0x0000, 0xE5A4, 0x6786, 0x286E,
+  0xA84D, 0x692D, 0x1A05, 0x002D, 0x2A15, 0xEA04, 0xEA04, 0xEA04,
+  0xEA04, 0x4220, 0x0000, 0x0000, 0x0000, 0x0000, 0x6786, 0x6786,
+  0xC7AE, 0xA7A6, 0x86D6, 0xC490, 0x0000, 0x0000, 0x84CB, 0x65FD,
+  0x85FD, 0x65FC, 0x85F4, 0x65F3, 0x65FB, 0x65EA, 0xA6E1, 0x65E9,
+  0x45E1, 0x06E1, 0x08E1, 0xC8E0, 0xC8E8, 0xAAE0, 0x0000, 0x0000,
+  0x6B98, 0xACE8, 0xAEE0, 0xAEE0, 0x0000, 0x0000, 0x0000, 0xB1C8,
+  0xD1A8, 0x1A37, 0x002D, 0xB1B0, 0xD1A8, 0x0000, 0x0000, 0x0000,
+  0xB1D0, 0xB0E0, 0xB1C8, 0xB0E0, 0x6B98, 0x0000, 0x4218, 0xB0E8,
+  0xAEE8, 0xAEE0, 0xAEE0, 0xACE8, 0xAAE0, 0xAAE0, 0xAAE0, 0xC8E8,
+  0xA8E0, 0x08E1, 0x06E1, 0x65E1, 0x65E9, 0xC5E9, 0x8450, 0x0000,
+  0x0000, 0x8458, 0x65FB, 0x85FD, 0x65F5, 0x85FE, 0x65FE, 0x0000,
+  0x0000, 0x0000, 0x0000, 0xE59C, 0x6786, 0x0866, 0xA84D, 0xA84D,
+  0x1B05, 0x0005, 0x0A15, 0xEA04, 0xEA04, 0xEA04, 0xEA04, 0x1B0F,
+  0x0023, 0x6786, 0xA7A6, 0xC7A6, 0x26CF, 0x25F7, 0x25F7, 0x25FF,
+  0x86CE, 0x84CB, 0x65F5, 0x85FD, 0x65FD, 0x65F3, 0x65F3, 0x85F2,
+  0x85EA, 0xC5E9, 0x65E9, 0x06E1, 0x06E1, 0xE7E0, 0xC8E8, 0xA8E0,
+  0x08E1, 0xACE8, 0x0000, 0x0000, 0x8B98, 0xAEE0, 0xB0E0, 0xB1D0,
+  0x0000, 0x0000, 0xD188, 0xB1D0, 0x1B37, 0x002D, 0xD1A8, 0xD178,
+  0x0000, 0x0000, 0xD1B0, 0xB1C8, 0xB1C8, 0xB1C8, 0x0000, 0x0000,
+  0x0000, 0xB0E0, 0xB0E0, 0xB0E0, 0xAEE0, 0xAEE0, 0xAEE8, 0xACE0,
+  0xACE0, 0x08E1, 0xAAE0, 0xA8E8, 0xC8E0, 0x26E1, 0x06E1, 0x45E9,
+  0x45E1, 0x0000, 0x27D1, 0x65F3, 0x65F3, 0x85FD, 0x65FD, 0x65FE,
+  0x65FE, 0x84CB, 0x0000, 0x0000, 0x0000, 0x0000, 0x64CC, 0xC7AE,
+  0x6786, 0x086E, 0x286E, 0x1C05, 0x0005, 0x692D, 0xEA04, 0xEA04,
+  0xEA04, 0xEA04, 0x1C0F, 0x0055, 0x6786, 0xC7AE, 0x26D7, 0x26CF,
+  0x25F7, 0x25F7, 0x25FF, 0x65FE, 0x65FE, 0x65F5, 0x65FC, 0x65F3,
+  0x65F3, 0x85F2, 0x65EA, 0xA6E1, 0x65E9, 0x06E1, 0x06E1, 0xC8E0,
+  0xC8E8, 0xA8E0, 0xAAE0, 0xAAE0, 0xACE8, 0x8B98, 0x0000, 0x0000,
+  0xB0E0, 0xB0E0, 0xB0E0, 0x8B58, 0x0000, 0x0000, 0xB1B0, 0x8B58,
+  0x0000, 0x0000, 0x0000, 0xF178, 0xD190, 0x0000, 0x0000, 0x8B60,
+  0xD1B0, 0xB1A8, 0xD1B0, 0xD188, 0x0000, 0x0000, 0xD1B0, 0xB1C8,
+  0xB0E0, 0xB0E0, 0xB0E0, 0xAEE8, 0xAEE0, 0xACE0, 0xACE8, 0xAAE0,
+  0xAAE0, 0xA8E0, 0xC8E8, 0xA8E0, 0x06E1, 0x26E1, 0x65E9, 0xA6E1,
+  0x85F2, 0x85EA, 0x65F3, 0x65F3, 0x65FC, 0x85FD, 0x65FE, 0x65F4,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x86CE, 0xC7A6, 0x6786, 0x086E,
+  0xE59C, 0x1D06, 0x005D, 0xEA04, 0xEA04, 0xEA04, 0xEA04, 0xA84D,
+  0x0000, 0x0000, 0x0000, 0x65CD, 0x6786, 0x86CE, 0x0000, 0x65CD,
+  0x65FE, 0x25F7, 0x65FE, 0x65F6, 0x85FD, 0x65FD, 0x85F4, 0x65FC,
+  0x85EA, 0x85F2, 0xC5E9, 0xC5E9, 0x08E1, 0x06E1, 0xE7E0, 0xAAE0,
+  0xC8E8, 0xACE0, 0xAAE0, 0xACE0, 0xACE8, 0xAEE8, 0x4218, 0x0000,
+  0xB0E0, 0xB1D0, 0x8B98, 0xB1C8, 0x0000, 0x0000, 0xD190, 0xD1A8,
+  0x0000, 0x0000, 0x0000, 0xD190, 0x1161, 0x0000, 0x0000, 0xF190,
+  0xD190, 0x0000, 0xB1A8, 0xD1B0, 0x0000, 0xD190, 0xB1C8, 0xB1C8,
+  0xB1C8, 0xB0E0, 0xB0E0, 0xB0E0, 0xAEE0, 0xB0E0, 0xAEE0, 0xACE8,
+  0xAAE0, 0xACE0, 0xC8E0, 0xE7E8, 0xE7E0, 0x06E1, 0x45E1, 0xC5E9,
+  0xC5E9, 0x85EA, 0x65FB, 0x65F3, 0x64CA, 0x84CB, 0x65FD, 0x85FE,
+  0x6458, 0x0000, 0x0000, 0x0000, 0x66CE, 0x46D7, 0x6786, 0x6786,
+  0x1E05, 0x0019, 0x4232, 0xEA04, 0xEA04, 0xEA04, 0xEA04, 0x0A15,
+  0x286E, 0x0000, 0x0000, 0x6786, 0xC7AE, 0xA39A, 0x0000, 0x0000,
+  0x0000, 0x65FD, 0x85FE, 0x65FD, 0x65FC, 0x65F3, 0x65F3, 0x85F2,
+  0xA6E1, 0x6B98, 0x8450, 0x1E24, 0x0040, 0x8BA0, 0xACE8, 0xACE0,
+  0xAEE0, 0xAEE0, 0xB0E0, 0xB1A8, 0xB0E8, 0x0000, 0x0000, 0xD1A8,
+  0xD178, 0x0000, 0x0000, 0xF178, 0x8B58, 0x0000, 0x8B60, 0x1161,
+  0x0000, 0x0000, 0x3149, 0xF178, 0xD178, 0x0000, 0xF178, 0xD190,
+  0x8B60, 0xD1B0, 0xB1A8, 0xD1B0, 0xB1C8, 0xB1C8, 0xD190, 0x4218,
+  0x0000, 0x0000, 0x0000, 0x4220, 0xAED0, 0x8AC8, 0xACE0, 0xAAE8,
+  0xC8E0, 0xE7E0, 0x06E1, 0x65E9, 0xC5E9, 0xC5E9, 0xA6E1, 0x0000,
+  0x0000, 0x0000, 0x85F4, 0x85FD, 0x64CA, 0x0000, 0x0000, 0x65FD,
+  0x46CF, 0xA7A6, 0xC7A6, 0x6786, 0x2218, 0x1F06, 0x0011, 0x2A15,
+  0xEA04, 0xEA04, 0xEA04, 0x492D, 0x492D, 0xA84D, 0x286E, 0xA7A6,
+  0xC7A6, 0x26CF, 0x26CF, 0x25F7, 0x25FF, 0x25F7, 0x65FE, 0x85FE,
+  0x1F27, 0x001D, 0xB1C8, 0xB0E0, 0xB0E0, 0xB0E8, 0xB1D0, 0x4218,
+  0x0000, 0xB1C8, 0xB1B0, 0x0000, 0x0000, 0xF178, 0x1161, 0x0000,
+  0x3149, 0x1169, 0x0000, 0x0000, 0x1161, 0xF178, 0x9129, 0x0000,
+  0x5149, 0xD190, 0xD190, 0xD1A8, 0xB1B0, 0xD1B0, 0x8B60, 0x1F4B,
+  0x0001, 0x4218, 0x1F52, 0x0011, 0x27D1, 0x45E1, 0x65F2, 0x85F2,
+  0x65F3, 0x65F3, 0x65F4, 0x65FD, 0x85FE, 0x65FD, 0x65FD, 0x25F7,
+  0x25F7, 0x26D7, 0x26CF, 0xC7AE, 0xC7A6, 0x2006, 0x0012, 0x0A15,
+  0xEA04, 0xEA04, 0x2A15, 0x0A15, 0xA855, 0xA855, 0x6786, 0x6786,
+  0xC7A6, 0x26D7, 0x25F7, 0x25FF, 0x25F7, 0x65FE, 0x65FE, 0x65FD,
+  0x85F4, 0x2028, 0x001A, 0x4218, 0x90E0, 0xB1C8, 0xB1D0, 0xD1A8,
+  0x0000, 0x8B60, 0xD190, 0x8B58, 0x0000, 0x4218, 0x1169, 0x3149,
+  0x1161, 0x4220, 0x0000, 0x0B19, 0x1169, 0x5149, 0x0000, 0x4218,
+  0x1169, 0x1161, 0xF178, 0xD178, 0x8B60, 0x2052, 0x0011, 0x08E9,
+  0x65E1, 0xC5E9, 0x85F2, 0x65EA, 0x65F3, 0x85FC, 0x65FD, 0x85FD,
+  0x65F6, 0x65FE, 0x25F7, 0x25F7, 0x25F7, 0x26D7, 0xC7A6, 0xE59C,
+  0x2106, 0x0013, 0xA84D, 0xEA04, 0xEA04, 0x2A15, 0x492D, 0x492D,
+  0x286E, 0x6786, 0xA7A6, 0xC7A6, 0x25F7, 0x65FE, 0x25F7, 0x25F7,
+  0x65FE, 0x85F4, 0x65FD, 0x85FC, 0xC39A, 0x212A, 0x0016, 0xB1B0,
+  0xD1B0, 0xD1B0, 0xD190, 0x0000, 0xD178, 0xF178, 0x0000, 0x5149,
+  0x3149, 0x5149, 0x3149, 0x9131, 0x0000, 0x5149, 0x3149, 0x9131,
+  0x0000, 0x5149, 0x3149, 0x1161, 0x5149, 0x2151, 0x0012, 0xAAE0,
+  0x06E9, 0x06E1, 0xA6E1, 0xC5E9, 0x85EA, 0x65F3, 0x65FC, 0x85F4,
+  0x65FD, 0x65FD, 0x25FF, 0x25F7, 0x25F7, 0x26CF, 0x26D7, 0xC7A6,
+  0x64CC, 0x2206, 0x0013, 0x223A, 0xEA04, 0xEA04, 0x2A15, 0x492D,
+  0xA855, 0x286E, 0x6786, 0xC7A6, 0x26D7, 0x65CD, 0x0000, 0x84CB,
+  0x25F7, 0x65FE, 0x65FD, 0x85FC, 0x65F4, 0x65F3, 0x222B, 0x0014,
+  0xD190, 0xD188, 0xF190, 0xF178, 0x8B60, 0x1161, 0x0B19, 0x9131,
+  0x3149, 0x9131, 0x9131, 0x9131, 0x4218, 0x9131, 0x9131, 0x0000,
+  0x9131, 0x9129, 0x3149, 0x9131, 0x2250, 0x0012, 0x8BA0, 0xE7E0,
+  0xE7E8, 0x65E1, 0x06E1, 0xC5E9, 0x85F2, 0x65C1, 0x8450, 0x85FC,
+  0x85FC, 0x65FE, 0x65F6, 0x25F7, 0x25F7, 0x25FF, 0x26CF, 0x26CF,
+  0x2307, 0x0014, 0x0A15, 0x2A15, 0x0A15, 0xA855, 0xA84D, 0x0866,
+  0x6786, 0x26CF, 0x46CF, 0x25F7, 0x65FD, 0x25F7, 0x65FE, 0x65FE,
+  0x85FD, 0x65FD, 0x65F3, 0x85F2, 0x85F2, 0x8458, 0x232C, 0x0012,
+  0xD190, 0xF178, 0xF178, 0x3149, 0x5151, 0x3149, 0x0B19, 0x9131,
+  0x9131, 0x9131, 0x0B19, 0xF221, 0x1222, 0x0B21, 0x1222, 0x9129,
+  0x9131, 0x9131, 0x234F, 0x0013, 0x8B98, 0xAAE0, 0xAAE8, 0x08E1,
+  0x06E1, 0x45E1, 0xC5E9, 0x85EA, 0xA6E1, 0x65F2, 0x85F4, 0x65FD,
+  0x65FD, 0x65FE, 0x65FE, 0x25F7, 0x25F7, 0x25FF, 0x86D6, 0x2407,
+  0x0015, 0xA66C, 0xEA04, 0x692D, 0x492D, 0xA84D, 0x286E, 0x64D4,
+  0xC7A6, 0x26CF, 0x26D7, 0x25F7, 0x65FE, 0x65FE, 0x65FD, 0x85F5,
+  0x65FC, 0x65F3, 0x85F2, 0x65EA, 0xA6E1, 0x85C1, 0x242A, 0x0015,
+  0x8B58, 0xD190, 0xF178, 0xD178, 0x3149, 0x5149, 0x9131, 0x3149,
+  0x4220, 0x9131, 0x9129, 0x1222, 0x4220, 0x1222, 0x1222, 0x531A,
+  0xF221, 0x1222, 0x9131, 0x1222, 0x9129, 0x244E, 0x0014, 0xB1B0,
+  0xAAE8, 0xA8E0, 0xAEC8, 0xA8E0, 0x06E9, 0x26E1, 0xC5E9, 0xC5E9,
+  0x85EA, 0x65F3, 0x85FC, 0x65F4, 0x85FD, 0x65F3, 0x25F7, 0x65FE,
+  0x25F7, 0x26CF, 0x65CD, 0x2508, 0x0016, 0x0A15, 0x692D, 0xA84D,
+  0xA84D, 0x65D5, 0x84CB, 0x65CD, 0x86CE, 0x25F7, 0x25F7, 0x25F7,
+  0x65FE, 0x65FE, 0x85FD, 0x65F4, 0x65FB, 0x65FB, 0x85F2, 0x4218,
+  0x08E1, 0x08E1, 0x8B98, 0x2526, 0x001B, 0x8B60, 0xB1A8, 0xB1D0,
+  0xD1A8, 0xD1B0, 0xD190, 0xF190, 0x1161, 0x0B21, 0x9131, 0x3149,
+  0x9131, 0xF221, 0x1222, 0x531A, 0x531A, 0xB412, 0x531A, 0xB41A,
+  0xB412, 0x0B19, 0x531A, 0x531A, 0x1222, 0x1222, 0x9131, 0x3149,
+  0x254D, 0x0014, 0xB1C8, 0xAEE0, 0x8EC8, 0xACE0, 0xC8E8, 0xE7E0,
+  0xE7E0, 0x45E1, 0x45E1, 0x85F2, 0x65F2, 0x65F3, 0x65F3, 0x85FC,
+  0x65FC, 0xA362, 0x85FD, 0x25F7, 0x25F7, 0x25FF, 0x2608, 0x0059,
+  0xA66C, 0x692D, 0x492D, 0x286E, 0x6786, 0xE59C, 0x0000, 0x65FC,
+  0x46D7, 0x25F7, 0x65FE, 0x65FE, 0x65FD, 0x65F4, 0x4218, 0x85FC,
+  0x65F2, 0xA6E1, 0x0000, 0x8450, 0x08E9, 0xE7E0, 0xC8E8, 0xAAE0,
+  0xAAE0, 0xACE0, 0xAEE8, 0xAEE0, 0xB1C8, 0xB0E0, 0xB1C8, 0xB1C8,
+  0xB1B0, 0xD188, 0x0000, 0x1161, 0x1161, 0x1169, 0x9129, 0x5149,
+  0x9131, 0x1222, 0x1222, 0x531A, 0x531A, 0xB412, 0xB41A, 0x5613,
+  0xB412, 0x5613, 0xB412, 0x5613, 0x531A, 0x531A, 0xEE09, 0xEE09,
+  0x9131, 0x3151, 0x5149, 0x1169, 0x3149, 0x1161, 0x0B19, 0x8B60,
+  0x8B60, 0xD1B0, 0xD1B0, 0xB0E0, 0xAEE8, 0xAEE0, 0x0000, 0x0000,
+  0xAAE0, 0xAAE0, 0xA8E8, 0x8AC8, 0x08E1, 0x65E1, 0xC5E9, 0x85EA,
+  0x85F2, 0x65F3, 0x0000, 0x64CA, 0x84CB, 0x65FD, 0x85FE, 0x25F7,
+  0x64CC, 0x2709, 0x0057, 0xA855, 0xA84D, 0x2866, 0x6786, 0xC7A6,
+  0x65CD, 0x26CF, 0x25F7, 0x65FE, 0x84CB, 0x65FE, 0x85FE, 0xE490,
+  0x0000, 0xA6E1, 0x65F3, 0xC5E9, 0xC5E9, 0x65E9, 0x06E1, 0xC8E0,
+  0x08E1, 0xAAE0, 0xACE8, 0xACE0, 0xAEE8, 0xB1C8, 0xD188, 0xB0E8,
+  0xB1D0, 0x0000, 0x0000, 0x0000, 0x0B19, 0xF178, 0x1169, 0x3149,
+  0x3149, 0x9131, 0x9131, 0x0000, 0xB412, 0xB41A, 0x5613, 0x560B,
+  0x5613, 0x5613, 0x0000, 0x5613, 0x560B, 0x5613, 0x5613, 0xB412,
+  0xD41A, 0x0000, 0x0000, 0x0000, 0x3149, 0x5149, 0x1161, 0x3149,
+  0xD190, 0xD1A8, 0xB1C8, 0xB1C8, 0xB0E0, 0xB0E0, 0xB0E0, 0xAEE0,
+  0xAEE8, 0x8EC8, 0xACE0, 0xC8E8, 0x8B58, 0x0000, 0xC6C0, 0x45E1,
+  0xC5E9, 0x27D1, 0x65FB, 0x65F3, 0x85FC, 0x6B98, 0x65F5, 0x65FE,
+  0x25F7, 0x65FE, 0x280A, 0x0055, 0xA66C, 0x086E, 0x6786, 0xC7A6,
+  0xA7A6, 0x26D7, 0x86CE, 0x64CB, 0x85FD, 0x65FE, 0x65FC, 0x0000,
+  0x0000, 0x8450, 0x85F2, 0x65F2, 0x45E1, 0x65E1, 0x8450, 0x0000,
+  0xA8E8, 0xAAE8, 0xAEC8, 0xACE0, 0xACE0, 0xB0E0, 0xB1A8, 0xB1D0,
+  0x0000, 0x0000, 0x0000, 0xD188, 0xF178, 0xF178, 0x3149, 0x3149,
+  0x9131, 0x9131, 0x0000, 0x4218, 0x731A, 0xB41A, 0x560B, 0x5613,
+  0x5613, 0xD80B, 0x0000, 0x0000, 0x5613, 0x560B, 0x5613, 0xB41A,
+  0x531A, 0x531A, 0x0B19, 0x0000, 0x0000, 0x3151, 0x5149, 0x3149,
+  0xF178, 0xD1B0, 0xB1B0, 0x0000, 0xB1C8, 0xB1D0, 0x0000, 0xB0E0,
+  0xACE0, 0xACE8, 0xAAE0, 0xAAE0, 0x0000, 0x0000, 0x0000, 0x65E1,
+  0x45E9, 0xA6E1, 0xC6E1, 0x65F3, 0x65FB, 0x85FD, 0x85F5, 0x65FE,
+  0x84CB, 0x290C, 0x0051, 0xA664, 0x65CD, 0x26D7, 0x66CE, 0x85F6,
+  0x65FD, 0x25F7, 0x85FE, 0x65FB, 0xC498, 0x8458, 0x8B58, 0x85F3,
+  0xC5E9, 0xA6E1, 0x0000, 0x0000, 0x8AC8, 0xC8E0, 0xAAE8, 0x0000,
+  0xACE0, 0xAEE0, 0xAEE8, 0xB0E0, 0x8B60, 0x0000, 0x4218, 0xD1B0,
+  0xD190, 0x0B21, 0x0B19, 0x1169, 0x5149, 0x3151, 0x0000, 0x0000,
+  0xEE09, 0xB412, 0xB41A, 0xF80B, 0xD80B, 0x7904, 0x790C, 0x0000,
+  0x0000, 0x330B, 0xF80B, 0xD80B, 0x560B, 0x0000, 0x531A, 0x1222,
+  0x1222, 0x0000, 0x0000, 0x1161, 0x1161, 0xD190, 0xF188, 0xD190,
+  0x0000, 0xB1C8, 0xB0E8, 0x0000, 0x0000, 0x8450, 0xACE0, 0xACE0,
+  0xAAE0, 0x0000, 0x0000, 0x0000, 0xE8E0, 0xC5E9, 0xC5E9, 0x85EA,
+  0x65F2, 0x85F4, 0x65FC, 0x64CA, 0x2A10, 0x0049, 0xA3A2, 0x84CB,
+  0x85FC, 0x85FC, 0x65F3, 0x65FC, 0x65F3, 0x65F3, 0x85F2, 0xC5E9,
+  0x6B58, 0x27D1, 0x0000, 0xAAE0, 0xC8E8, 0xACE0, 0x0000, 0x8EC8,
+  0xAEE0, 0xB0E0, 0xB0E0, 0xB1C8, 0x4218, 0xB1D0, 0xD190, 0x0000,
+  0x0000, 0x5149, 0x3149, 0x5149, 0x4218, 0x0000, 0x0000, 0x531A,
+  0xB41A, 0x5613, 0x560B, 0xF80B, 0x790C, 0x7904, 0x0000, 0x0000,
+  0x0000, 0x790C, 0x5613, 0x560B, 0xEE09, 0x0000, 0x0B21, 0x1222,
+  0x9131, 0x4220, 0x3149, 0x1161, 0xF178, 0xD190, 0x0000, 0x0000,
+  0xB1D0, 0xB0E0, 0xD1A8, 0xB1D0, 0x6B98, 0xAEE8, 0xAAE0, 0xAAE0,
+  0xAEC8, 0xACE8, 0xAAE0, 0x08E1, 0x27D1, 0xA6E1, 0xE490, 0x2B16,
+  0x001F, 0x4218, 0x8458, 0x0000, 0x4218, 0xA6E1, 0x27D1, 0x08E1,
+  0xC8E8, 0xAAE0, 0xAAE0, 0xACE8, 0x8B98, 0xAEE0, 0xB0E0, 0xB0E0,
+  0xB0E0, 0xB0E8, 0xD190, 0x0000, 0x0000, 0x0000, 0x1161, 0x1169,
+  0x9131, 0x0000, 0x0000, 0x0000, 0x531A, 0x560B, 0x5613, 0xD80B,
+  0x2B3C, 0x0014, 0xF80B, 0x560B, 0x5613, 0x0000, 0x0000, 0x0000,
+  0x9131, 0x5149, 0x1161, 0x1161, 0xD190, 0x1161, 0xD178, 0xD1A8,
+  0xB0E0, 0xB0E0, 0xB0E0, 0x8EC8, 0xB0E8, 0x4220, 0x2C18, 0x0015,
+  0x8B60, 0x85F2, 0x45E9, 0x06E1, 0xE7E8, 0xE7E0, 0xC8E0, 0xAAE0,
+  0xAAE8, 0xAEE0, 0xAEE0, 0xB0E0, 0xB0E0, 0xB0E0, 0xB1C8, 0xD1A8,
+  0x0000, 0x0000, 0x1161, 0x1161, 0x3149, 0x2C32, 0x0004, 0xB41A,
+  0x560B, 0xF80B, 0x790C, 0x2C3C, 0x0015, 0x330B, 0x560B, 0xB41A,
+  0x0B21, 0x0000, 0xEE09, 0x9131, 0x3149, 0x5149, 0x1169, 0xF178,
+  0xD190, 0xD1A8, 0xB1D0, 0xB1C8, 0xB0E0, 0xB0E0, 0xB0E0, 0xAEE8,
+  0xAEE0, 0x8450, 0x2D17, 0x001E, 0x85F2, 0x65F3, 0xC5E9, 0xC5E9,
+  0x26E1, 0x06E1, 0xE7E8, 0xA8E0, 0xAEC8, 0xACE0, 0xACE8, 0xAEE0,
+  0xAEE0, 0xB0E0, 0xB0E8, 0xB1C8, 0xB1A8, 0xD1B0, 0x1169, 0xF178,
+  0x1161, 0x3151, 0x0000, 0x0000, 0x0000, 0x0000, 0x531A, 0x560B,
+  0x5613, 0xD80B, 0x2D3D, 0x0015, 0x560B, 0x5613, 0xB412, 0x531A,
+  0x9131, 0x9131, 0x9129, 0x1161, 0x1161, 0xF178, 0xD190, 0xD1B0,
+  0xB1A8, 0xB1C8, 0xB0E0, 0xB0E0, 0xAEE0, 0xAEE0, 0xACE8, 0xACE0,
+  0xACE8, 0x2E15, 0x0017, 0x64CA, 0x65F3, 0x65F3, 0x85F2, 0x65EA,
+  0x45E1, 0x65E1, 0xE7E8, 0xE7E0, 0xAAE0, 0x0000, 0xAAE0, 0xAEE8,
+  0xAEE0, 0xB0E0, 0xB1C8, 0xB0E0, 0xB1C8, 0xB1C8, 0xB1B0, 0xD188,
+  0xF178, 0x1161, 0x2E31, 0x0005, 0x531A, 0xB412, 0x5613, 0x5613,
+  0xF80B, 0x2E3E, 0x0016, 0xB412, 0xB41A, 0x1222, 0x1222, 0x9131,
+  0x3149, 0x3149, 0x1169, 0xF178, 0xD190, 0xD1B0, 0x4218, 0xB1B0,
+  0xB0E0, 0xB0E0, 0xB0E0, 0xAEE8, 0xAEE0, 0xAAE0, 0xAAE0, 0xC8E8,
+  0x8AC8, 0x2F14, 0x0018, 0x85FD, 0x65F4, 0x85FC, 0x65F3, 0x65F3,
+  0xC5E9, 0xC5E9, 0x65E1, 0x06E9, 0xAAE0, 0x08E1, 0xAAE0, 0xACE8,
+  0xAEC8, 0xAEE0, 0xAEE8, 0x4218, 0xB1C8, 0xB0E8, 0xB1C8, 0xD1B0,
+  0xD190, 0xD190, 0x8B60, 0x2F31, 0x0007, 0x531A, 0xB412, 0x5613,
+  0xF80B, 0xD80B, 0x7904, 0x790C, 0x2F3E, 0x0017, 0x560B, 0x531A,
+  0x1222, 0x9131, 0x5149, 0x3149, 0x0000, 0x1161, 0xF190, 0xD190,
+  0xB1A8, 0xD1B0, 0xB1C8, 0xB1C8, 0xB0E0, 0xAEE0, 0xAEE0, 0xACE0,
+  0xACE8, 0xAAE0, 0xAAE0, 0xE7E0, 0x08E1, 0x3012, 0x001A, 0x65C1,
+  0x85FE, 0x65FD, 0x65F5, 0x65F3, 0x65FB, 0x85EA, 0x65F2, 0x45E1,
+  0x08E1, 0x06E1, 0xE7E0, 0xC8E8, 0xACE0, 0xAAE0, 0xAEC8, 0xACE8,
+  0xAEE0, 0x0000, 0xB1C8, 0xB1C8, 0xB1C8, 0xB1B0, 0xD1A8, 0xD178,
+  0xF178, 0x3031, 0x0007, 0x531A, 0x531A, 0xB412, 0x560B, 0x5613,
+  0x5613, 0xD80B, 0x303E, 0x0019, 0x531A, 0x1222, 0x9131, 0x9131,
+  0x9129, 0x3149, 0x0000, 0x1169, 0xF178, 0xD190, 0xD1B0, 0xB1C8,
+  0xB1C8, 0xB1C8, 0xAEE8, 0xB0E0, 0xB1C8, 0xACE8, 0xAAE0, 0xAAE0,
+  0xA8E0, 0xE7E8, 0x06E1, 0x65E1, 0x8450, 0x3111, 0x0027, 0x65CD,
+  0x25F7, 0x65FE, 0x65FE, 0x85FD, 0x85F4, 0x65FB, 0x65F3, 0x85F2,
+  0xA6E1, 0x08E1, 0x06E1, 0xE7E0, 0xC8E0, 0xAAE8, 0xACE0, 0xD1A8,
+  0xAEE8, 0xAEE0, 0xB0E0, 0xB0E0, 0xB0E0, 0xB1D0, 0xB1C8, 0x1161,
+  0xD190, 0xD178, 0x1169, 0x0000, 0x0000, 0x0000, 0x0000, 0x1222,
+  0x531A, 0x531A, 0x5613, 0x5613, 0x560B, 0x5613, 0x313D, 0x001B,
+  0xB412, 0x531A, 0x1222, 0x1222, 0x9131, 0x3149, 0x3149, 0x1161,
+  0xF178, 0xF190, 0xD190, 0xB1A8, 0xD1B0, 0xB0E0, 0xB1C8, 0xB0E0,
+  0xAEE0, 0xAEE0, 0xACE8, 0x8EC8, 0xAAE0, 0xC8E0, 0xE7E0, 0x06E9,
+  0x65E1, 0xC5E9, 0x27D9, 0x3210, 0x0049, 0x86CE, 0x25F7, 0x65FE,
+  0x65FE, 0x65FD, 0x85FD, 0x65F4, 0x85FC, 0x65EA, 0x85F2, 0xC490,
+  0xC490, 0x06E9, 0x08E1, 0x0000, 0xAAE0, 0xAAE0, 0xACE8, 0xACE0,
+  0xAEE0, 0xAEE0, 0xB0E0, 0xB1C8, 0xB1C8, 0x0000, 0x0000, 0x1161,
+  0xF190, 0x1161, 0x0B19, 0x0000, 0x0000, 0x0000, 0x1222, 0x1222,
+  0x531A, 0x531A, 0xB41A, 0xB412, 0x5613, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x531A, 0x531A, 0xF221, 0x0000, 0x0000, 0x9131, 0x3149,
+  0x1169, 0x1161, 0xF190, 0xD190, 0xD1B0, 0xD1A8, 0xB1C8, 0xB1B0,
+  0x0000, 0xAEE8, 0xAEE0, 0x0000, 0xAEE0, 0xAAE0, 0xAAE8, 0xC8E0,
+  0x08E1, 0x06E1, 0x65E1, 0xC5E9, 0x85F2, 0x65EA, 0x330F, 0x004B,
+  0x26D7, 0x25F7, 0x25F7, 0x25F7, 0x65FE, 0x65F6, 0x85FD, 0x65FD,
+  0x65F3, 0x65F3, 0x85F2, 0x85F2, 0x45E1, 0x65E1, 0xE7E0, 0x08E1,
+  0xAAE8, 0xAAE0, 0xACE0, 0xAEE0, 0xAEE8, 0xB0E0, 0xB0E0, 0xB0E0,
+  0xB1D0, 0xD178, 0x0000, 0x0000, 0xF178, 0xD178, 0x1161, 0x0000,
+  0x0000, 0x0000, 0x9131, 0x1222, 0xF221, 0x531A, 0x531A, 0xB41A,
+  0xB412, 0x0000, 0x0000, 0x0000, 0x531A, 0x531A, 0x1222, 0x0000,
+  0x0000, 0x0000, 0x9131, 0x1161, 0x1161, 0xF178, 0xD188, 0xD1B0,
+  0xD1A8, 0xB1D0, 0xB1C8, 0xD190, 0xB1C8, 0xB0E0, 0x8EC8, 0xAEC8,
+  0xACE0, 0xAAE0, 0xA8E8, 0x08E1, 0xE7E0, 0x65E1, 0x45E1, 0x65F2,
+  0x85EA, 0x65FB, 0x65F3, 0x340E, 0x004D, 0xC7A6, 0x26CF, 0x26CF,
+  0x25FF, 0x65FE, 0x65FE, 0x65F5, 0x65FD, 0x65F3, 0x85FC, 0x65F3,
+  0x65F2, 0xC5E9, 0xC5E1, 0x06E1, 0x06E1, 0xC8E8, 0xC8E0, 0xA8E0,
+  0xACE0, 0xACE8, 0xAEE0, 0xAEE0, 0xB0E0, 0xB0E0, 0xB0E0, 0xB1C8,
+  0x0000, 0x0000, 0x0000, 0xF178, 0xD178, 0x4218, 0x0000, 0x9131,
+  0x9131, 0x9129, 0x9131, 0x9131, 0x1222, 0x1222, 0x531A, 0x531A,
+  0x0000, 0x0000, 0xF221, 0x9131, 0x9129, 0x0000, 0x0000, 0x9131,
+  0x1161, 0x3149, 0xF178, 0xF178, 0xD190, 0xD190, 0xB1D0, 0xB1C8,
+  0xB0E0, 0xB0E0, 0xB0E0, 0xAEE8, 0xAEE0, 0xACE0, 0xAAE8, 0xC8E0,
+  0xC8E0, 0xA8E0, 0x06E9, 0x26E1, 0xC5E9, 0xC5E9, 0x85EA, 0x65F3,
+  0x85FC, 0x65F3, 0x350D, 0x004F, 0x65CD, 0xC7A6, 0x26CF, 0x25F7,
+  0x25F7, 0x25F7, 0x65FE, 0x65FE, 0x65F3, 0x0000, 0x65F3, 0x85FC,
+  0x85EA, 0x85F2, 0xA6E1, 0x45E9, 0x08E1, 0x08E1, 0xC8E0, 0xAAE0,
+  0xAAE0, 0xACE8, 0xACE0, 0x0000, 0x8EC8, 0xB0E8, 0xB1C8, 0xB0E0,
+  0xD1B0, 0x0000, 0x0000, 0xD178, 0xF178, 0x1161, 0x0B21, 0x5149,
+  0x0000, 0x3149, 0x9131, 0x9131, 0x9129, 0xF221, 0x0000, 0x1222,
+  0x0000, 0x9131, 0x9131, 0x1222, 0x0000, 0x0000, 0x9131, 0x1161,
+  0x1161, 0xD178, 0xF178, 0x0000, 0xD188, 0xB1C8, 0xB1C8, 0xB0E0,
+  0xB0E0, 0xB0E0, 0xAEE8, 0xB0E0, 0xACE0, 0xACE0, 0xAAE0, 0xAAE8,
+  0xC8E0, 0x8ED0, 0x4218, 0x45E1, 0xC5E9, 0x85EA, 0x65F2, 0x85F4,
+  0x65FC, 0x85F5, 0x65FC, 0x360C, 0x0051, 0xE59C, 0x6786, 0xC7AE,
+  0x26CF, 0x26D7, 0x25F7, 0x25F7, 0x25F7, 0x65FE, 0x65FD, 0x0000,
+  0x0000, 0x65F3, 0x65F2, 0x0000, 0x0000, 0xACE0, 0x45E1, 0xE7E8,
+  0xE7E0, 0xC8E0, 0xAAE0, 0xAAE8, 0x6B98, 0x0000, 0x0000, 0xB1C8,
+  0xD1A8, 0x0000, 0xB1D0, 0xB1A8, 0x0000, 0x4218, 0xD190, 0xF178,
+  0x1161, 0x9131, 0x0000, 0x3149, 0x5149, 0x9131, 0x9131, 0x9131,
+  0x0000, 0x9131, 0x9129, 0x9131, 0x3149, 0x0B21, 0x0000, 0x0B19,
+  0x1169, 0x9131, 0x0000, 0x1161, 0x0B19, 0x0000, 0x4220, 0xD1B0,
+  0xB1C8, 0xB1D0, 0xB0E0, 0xAEE0, 0xAEE8, 0xD1A8, 0x0000, 0x8B58,
+  0xACE8, 0xA8E0, 0x8458, 0x0000, 0x27D1, 0x65E9, 0xC5E9, 0x85EA,
+  0x65F3, 0x65FB, 0x65F4, 0x85FC, 0x65FE, 0x84CB, 0x370C, 0x0051,
+  0x086E, 0x6786, 0xC7A6, 0xA7A6, 0x46CF, 0x25F7, 0x25F7, 0x25FF,
+  0x25F7, 0x85FD, 0x84CB, 0xC490, 0x65F4, 0x85F2, 0x0000, 0x0000,
+  0x08E1, 0x65E1, 0x06E1, 0xE7E8, 0xC8E0, 0xAAE8, 0x08E1, 0x4218,
+  0x0000, 0x0000, 0xB1B0, 0xB0E0, 0x0000, 0x0000, 0xB1C8, 0xD1B0,
+  0x0000, 0xF190, 0xD190, 0xF178, 0x0000, 0x0000, 0x1161, 0x3151,
+  0x5149, 0x3149, 0x5149, 0x0000, 0x0B21, 0x9131, 0x3149, 0x5149,
+  0x4218, 0x9131, 0x1161, 0x3149, 0x0000, 0x1161, 0xD190, 0x0000,
+  0x0000, 0x0000, 0xB1C8, 0xB1C8, 0xB0E0, 0xB0E0, 0xB0E0, 0xAEE0,
+  0xAEE8, 0x0000, 0x0000, 0xAEC8, 0xC8E0, 0x8AC8, 0x0000, 0x45E1,
+  0xC5E9, 0xC5E9, 0x65F3, 0x65F3, 0x65FC, 0x85F4, 0x65FD, 0x65FE,
+  0x65F6, 0x380C, 0x0052, 0xA84D, 0x678E, 0x6786, 0xC7A6, 0x26D7,
+  0x25F7, 0x25F7, 0x25FF, 0x65FE, 0x65FE, 0x65F5, 0x65F3, 0x65FB,
+  0x65F3, 0x0000, 0x0000, 0xA6E1, 0x65E1, 0x06E9, 0xE7E0, 0xC8E0,
+  0x8450, 0xAAE8, 0x6B98, 0x0000, 0x0000, 0x0000, 0xB0E8, 0xB1C8,
+  0x0000, 0x0000, 0xB1C8, 0xD1A8, 0xB1B0, 0xD190, 0xF188, 0x0000,
+  0x0000, 0x1161, 0x1161, 0x3149, 0x1169, 0x5149, 0x0000, 0x0000,
+  0x3149, 0x5149, 0x1169, 0x3149, 0x1161, 0x0B21, 0x0000, 0x0000,
+  0xF190, 0x0B19, 0x0000, 0x0000, 0x0000, 0xB1D0, 0xB1C8, 0x4218,
+  0xB0E8, 0xAEE8, 0xAEE0, 0xACE0, 0xAEC8, 0x0000, 0xAAE8, 0xA8E0,
+  0x27D1, 0x08E1, 0x65E9, 0xC5E9, 0x85EA, 0x65F2, 0x65F3, 0x85F4,
+  0x65FD, 0x85FD, 0x65FE, 0x65F6, 0xA362, 0x390C, 0x0052, 0x286E,
+  0x0866, 0x6786, 0xC7A6, 0x26D7, 0x26CF, 0x25F7, 0x25F7, 0x85F4,
+  0x65FD, 0x65FE, 0x85FC, 0x65F3, 0x65FB, 0x8450, 0x65C1, 0x85F2,
+  0x65E1, 0x45E1, 0x08E1, 0x08E1, 0xC8E8, 0xAAE0, 0xACE0, 0x8EC8,
+  0xAEE8, 0xB1C8, 0xAEE0, 0xB0E8, 0x8B98, 0x0000, 0x0000, 0xB1B0,
+  0xD1A8, 0xB1B0, 0xF178, 0x0000, 0x0000, 0xD190, 0xF178, 0xF178,
+  0x1161, 0x1161, 0x0000, 0x0000, 0x3149, 0xD178, 0x1161, 0xF178,
+  0x0000, 0x0000, 0x0000, 0xD190, 0xD1B0, 0x8B58, 0xD178, 0xF178,
+  0xD190, 0xB0E0, 0xB1C8, 0xB0E0, 0xAEE0, 0xAEE0, 0xACE8, 0xACE0,
+  0xAAE8, 0x8B98, 0xA8E0, 0x08E1, 0xAEC8, 0x45E1, 0x65E9, 0xA6E1,
+  0x65EA, 0x65FB, 0x65F3, 0x85F4, 0x65FD, 0x65FE, 0x65FE, 0x25FF,
+  0xA362, 0x3A0C, 0x0052, 0x692D, 0x286E, 0x6786, 0xA7AE, 0xC7A6,
+  0x26D7, 0x26CF, 0x65FE, 0xC490, 0x0000, 0x65FD, 0x85FD, 0x65FC,
+  0x85F4, 0x65F3, 0x65F2, 0xC5E9, 0xC5E9, 0xACE0, 0x0000, 0xE7E0,
+  0xE7E0, 0xAAE0, 0x8EC8, 0x8AC8, 0xAEC8, 0xAED0, 0xAEE0, 0xAEE8,
+  0xB0E0, 0xB0E0, 0x6B98, 0x4218, 0xB1D0, 0xD1A8, 0x4218, 0x0000,
+  0x0000, 0xD190, 0xD190, 0xF178, 0xD190, 0xF178, 0x0000, 0x0000,
+  0x4218, 0xF178, 0xD190, 0x8B60, 0x0000, 0xF178, 0xD190, 0xD1B0,
+  0xB1A8, 0xD1B0, 0xB1C8, 0xB1A8, 0xB1D0, 0xB0E0, 0xB0E0, 0xAEE0,
+  0x8458, 0x0000, 0xACE8, 0xAAE0, 0xAAE0, 0xC8E0, 0xE7E8, 0xE7E0,
+  0x06E1, 0x65E1, 0x65C1, 0x0000, 0x85F2, 0x65F3, 0x85FC, 0x65FC,
+  0x85F5, 0x65FD, 0x85FE, 0x65FE, 0x2218, 0x3B0C, 0x0015, 0xA84D,
+  0xA84D, 0x6786, 0x6786, 0x26D7, 0x26CF, 0x25F7, 0x84CB, 0x65CD,
+  0x65FE, 0x85F6, 0x65FD, 0x85FD, 0x65F4, 0x85FC, 0x65F3, 0x85F2,
+  0xC5E9, 0x27D1, 0x08E1, 0x08E1, 0x3B27, 0x001B, 0xB1C8, 0xAEE8,
+  0xB1C8, 0xB0E0, 0xB0E0, 0xB0E0, 0xB1C8, 0xB1D0, 0x0000, 0x0000,
+  0x0000, 0xB1A8, 0xD1B0, 0xD1A8, 0xD190, 0xF190, 0x0000, 0x0000,
+  0x0000, 0xD188, 0xD190, 0xD1B0, 0xB1A8, 0xD1B0, 0xD188, 0xB1D0,
+  0xD1A8, 0x3B47, 0x0016, 0x8B60, 0xB0E0, 0x8EC8, 0x4218, 0xACE8,
+  0xAAE0, 0xC8E0, 0x08E1, 0xE7E0, 0x06E9, 0x65E1, 0xC5E9, 0xC6E1,
+  0xA6E1, 0x6B98, 0x65FC, 0x85F4, 0x65FD, 0x65FD, 0x65FE, 0x85FE,
+  0x25F7, 0x3C0C, 0x0014, 0x492D, 0xA84D, 0x286E, 0x6786, 0xC7AE,
+  0x26D7, 0x26CF, 0x65FE, 0x65FD, 0x25F7, 0x65FE, 0x65FE, 0x65F5,
+  0x85FC, 0x65F3, 0x65F3, 0x65F2, 0x85EA, 0xA6E1, 0x08E1, 0x3C27,
+  0x001B, 0xACE8, 0xACE0, 0x0000, 0x0000, 0x8B58, 0xB1C8, 0xB0E8,
+  0xB1A8, 0x0000, 0x0000, 0x0000, 0xD1A8, 0xB1B0, 0xD1A8, 0xB1B0,
+  0xD190, 0x0000, 0x0000, 0x0000, 0xF188, 0xD1B0, 0xB1A8, 0x8B60,
+  0x0000, 0x0000, 0xD1B0, 0xB1C8, 0x3C49, 0x0014, 0x6B98, 0xAAE8,
+  0xAAE0, 0xAAE8, 0xC8E0, 0xA8E0, 0x06E1, 0x26E9, 0x65E1, 0xA6E1,
+  0x85F2, 0x85EA, 0x65F2, 0x65F3, 0x85FC, 0x65F5, 0x85FE, 0x65FE,
+  0x25F7, 0x65FE, 0x3D0C, 0x0015, 0xA84D, 0xA84D, 0x086E, 0x6786,
+  0xC7A6, 0xA7A6, 0x26CF, 0x46D7, 0x25F7, 0x25F7, 0x25F7, 0x65F4,
+  0x85FD, 0x65FD, 0x85FC, 0x65F3, 0x65EA, 0x85F2, 0x85EA, 0x45E9,
+  0x27D9, 0x3D27, 0x001C, 0xAAE0, 0xAEE8, 0x0000, 0x0000, 0x0000,
+  0x0000, 0xAEC8, 0xB1B0, 0x0000, 0x0000, 0x0000, 0xB1C8, 0xB1C8,
+  0xB1C8, 0xB1D0, 0xD1A8, 0x0000, 0x0000, 0x0000, 0xD190, 0xD1A8,
+  0x0000, 0x0000, 0x0000, 0x0000, 0xB1C8, 0xB0E8, 0x8B60, 0x3D48,
+  0x0015, 0xAEE0, 0xACE0, 0xACE0, 0xAAE8, 0xAEC8, 0xE7E0, 0x06E1,
+  0x06E9, 0x65E1, 0x45E1, 0x65EA, 0x85F2, 0x65F3, 0x65F3, 0x65FC,
+  0x65F4, 0x65FE, 0x65FE, 0x25F7, 0x25F7, 0x65FE, 0x3E0C, 0x0051,
+  0xA66C, 0xA84D, 0xA855, 0x6786, 0x6786, 0xC7A6, 0xA7AE, 0x25F7,
+  0x26D7, 0x25F7, 0x65FD, 0x0000, 0x84CC, 0x65FD, 0x85F4, 0x65FC,
+  0x65F3, 0x85F2, 0x0000, 0xA6E1, 0x45E1, 0x65E1, 0x06E1, 0x08E1,
+  0xC8E8, 0xA8E0, 0xC8E0, 0xAAE0, 0x8EC8, 0x0000, 0x0000, 0x0000,
+  0x8B98, 0xB0E8, 0x0000, 0x0000, 0x0000, 0x0000, 0xB1A8, 0xB0E0,
+  0xB1C8, 0xB1D0, 0xD1A8, 0x0000, 0x0000, 0x0000, 0x0000, 0xB1C8,
+  0xD190, 0x0000, 0x0000, 0x0000, 0xB1C8, 0xB0E8, 0xB1C8, 0xB0E0,
+  0xAEE0, 0xAEE8, 0xACE0, 0xACE0, 0xAAE0, 0xACE8, 0x0000, 0xAAE0,
+  0xC8E0, 0xE7E0, 0x06E9, 0x65E1, 0x08E1, 0x0000, 0x27D1, 0x65F3,
+  0x65FB, 0x85F4, 0x65FC, 0x85FD, 0x65F5, 0x85FE, 0x65FE, 0x25F7,
+  0x64CB, 0x3F0C, 0x0011, 0x286E, 0x492D, 0xA84D, 0x2866, 0x6786,
+  0xA7A6, 0x26CF, 0x26D7, 0x25F7, 0x25F7, 0x25F7, 0x65FE, 0x85FE,
+  0x65FD, 0x85FD, 0x65FC, 0x85FC, 0x3F22, 0x000C, 0xA6E1, 0x27D1,
+  0x08E1, 0xC8E0, 0xAAE0, 0xAAE8, 0xACE8, 0x0000, 0x0000, 0x8B58,
+  0xAEE0, 0xAEE0, 0x3F33, 0x0003, 0xB0E0, 0xB0E0, 0xB0E8, 0x3F3B,
+  0x000C, 0xB1C8, 0xB0E0, 0x8450, 0x0000, 0x0000, 0xB0E0, 0xAEE8,
+  0xB0E0, 0xAEE0, 0xAEE8, 0x8EC8, 0xAEC8, 0x3F4C, 0x0011, 0x08E1,
+  0x26E9, 0xA6E1, 0x45E1, 0xC5E1, 0xC5E9, 0x65F2, 0x65F3, 0x85FC,
+  0x65F4, 0x85FD, 0x65FD, 0x65FE, 0x65FE, 0x25F7, 0x45F7, 0xA39A,
+  0x400C, 0x0011, 0xA3A2, 0x492D, 0x692D, 0xA855, 0x286E, 0xA7A6,
+  0xC7A6, 0x26D7, 0x26CF, 0x25FF, 0x25F7, 0x25F7, 0x65FE, 0x65FE,
+  0x65FD, 0x65FD, 0x84CB, 0x4025, 0x0008, 0xACE0, 0x8AC8, 0xC8E0,
+  0xAAE0, 0x0000, 0x8AC8, 0xACE0, 0xACE8, 0x4034, 0x0002, 0x8ED0,
+  0x8B58, 0x403B, 0x0008, 0xD190, 0xAEE8, 0xB0E0, 0x8B58, 0x0000,
+  0xAEE8, 0xAEE0, 0xACE0, 0x404C, 0x0011, 0x8AC8, 0x65E9, 0x65E1,
+  0xC5E9, 0xC5E9, 0x85F2, 0x65EA, 0x65F3, 0x85FC, 0x65FD, 0x85F5,
+  0x65FE, 0x65FE, 0x25F7, 0x25F7, 0x25F7, 0xA362, 0x410C, 0x0010,
+  0x423A, 0x0A15, 0x492D, 0xA84D, 0x286E, 0x6786, 0xA7A6, 0xC7A6,
+  0x66CE, 0x26CF, 0x25F7, 0x65FE, 0x25F7, 0x65FE, 0x85FE, 0x85FD,
+  0x4124, 0x0009, 0x08E1, 0xAAE8, 0x8AC8, 0xC8E0, 0x08E1, 0xAAE0,
+  0xAAE0, 0xAAE8, 0xACE0, 0x413C, 0x0007, 0xB0E0, 0xAEE0, 0xAEE8,
+  0xB1C8, 0xAEE0, 0xAEE0, 0xAEE0, 0x414D, 0x0010, 0x45E1, 0xC5E9,
+  0xC5E9, 0x65F3, 0x65F3, 0x65FC, 0x85F4, 0x65FD, 0x65FD, 0x65FE,
+  0x65FE, 0x25F7, 0x25F7, 0x25FF, 0x46D7, 0x2232, 0x420D, 0x0020,
+  0x0A15, 0x2A15, 0xA84D, 0xA855, 0x286E, 0xE59C, 0x0000, 0x2218,
+  0x46D7, 0x65FD, 0x0000, 0x0000, 0x65FC, 0x85FE, 0x65FE, 0x65FC,
+  0x65F4, 0x65F3, 0x85F2, 0x27D1, 0xC490, 0x0000, 0x0000, 0x27D1,
+  0x08E1, 0x06E9, 0x06E1, 0xC8E0, 0xC8E8, 0xA8E0, 0xAAE0, 0xAAE0,
+  0x423C, 0x0007, 0xAEC8, 0xAEE8, 0xACE0, 0xAEE0, 0xACE8, 0xACE0,
+  0xACE0, 0x4248, 0x0014, 0x8458, 0x8AC8, 0x08E1, 0x65E9, 0x27D1,
+  0xC5E9, 0xC5E9, 0xA6E1, 0x8B58, 0x0000, 0x85C9, 0x85FD, 0x64CA,
+  0x0000, 0x64CC, 0x25F7, 0x25F7, 0x25F7, 0x46D7, 0x26CF, 0x430D,
+  0x0020, 0x4935, 0x692D, 0x492D, 0xA84D, 0x0866, 0x0000, 0x0000,
+  0x0000, 0x46CF, 0x25F7, 0xA362, 0x65FD, 0x65FE, 0x25F7, 0x65FE,
+  0x65FE, 0x85F5, 0x65FD, 0x85FC, 0x65F3, 0x85EA, 0x65F3, 0xC5E9,
+  0xC5E9, 0x45E9, 0x65E1, 0x26E1, 0x06E1, 0xE7E8, 0x08E1, 0xAAE0,
+  0xACE8, 0x433C, 0x0020, 0xAEC8, 0x8B58, 0xAEE0, 0xACE8, 0xACE0,
+  0xAAE0, 0x08E1, 0xAAE0, 0xACE8, 0xAAE0, 0x08E1, 0xE7E0, 0x06E1,
+  0x06E9, 0x65E1, 0x45E1, 0xC5E9, 0xC5E9, 0x65F3, 0x65EA, 0x64CA,
+  0x0000, 0x65FB, 0x85FD, 0x64CA, 0x0000, 0x0000, 0x65CD, 0x25F7,
+  0x25F7, 0x25FF, 0x66CE, 0x440D, 0x001F, 0xA855, 0xEA04, 0x692D,
+  0x492D, 0x286E, 0x0000, 0x0000, 0x0000, 0xC7AE, 0x26CF, 0x25FF,
+  0x25F7, 0x25F7, 0x65FE, 0x65FE, 0x65FD, 0x65FD, 0x85F4, 0x65FC,
+  0x65F3, 0x65F3, 0x85F2, 0x65EA, 0xC5E9, 0xC5E9, 0x45E1, 0x65E1,
+  0x06E1, 0x06E1, 0x8B98, 0xC8E8, 0x443C, 0x0020, 0x6BA0, 0xACE8,
+  0x0000, 0xAAE0, 0xC8E0, 0xAAE0, 0xA8E8, 0xC8E0, 0xA8E0, 0xE7E0,
+  0xE7E8, 0x06E1, 0x26E1, 0x65E1, 0x45E9, 0xC5E9, 0xC5E9, 0x85EA,
+  0x85EA, 0x65F3, 0x65FB, 0x65F4, 0x85FC, 0x65FD, 0x0000, 0x0000,
+  0x0000, 0x8450, 0x25F7, 0x25FF, 0x46CF, 0x65CD, 0x450D, 0x001F,
+  0xA66C, 0x2A15, 0x0A15, 0x692D, 0xE59C, 0x0000, 0x0000, 0x0000,
+  0xA39A, 0x26CF, 0x26CF, 0x25FF, 0x25F7, 0x25F7, 0x84CB, 0xA39A,
+  0x85FE, 0x65F5, 0x85FC, 0x65FD, 0x85F4, 0x65F3, 0x65F2, 0x65F3,
+  0x85F2, 0x85F2, 0xA6E1, 0xC5E9, 0x27D1, 0x08E1, 0x08E1, 0x453D,
+  0x001F, 0xAAE0, 0xAED0, 0x6B98, 0xAAE0, 0xC8E0, 0xE7E0, 0xE7E8,
+  0x26E1, 0x06E1, 0x45E1, 0x45E1, 0xC5E9, 0xC5E9, 0x85EA, 0x65F2,
+  0x85EA, 0x65F2, 0x65F3, 0x65F3, 0x85FD, 0x65FD, 0x85FD, 0x64CC,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x25F7, 0x26D7, 0x26CF, 0x84CB,
+  0x460E, 0x001E, 0xEA04, 0x2A15, 0x0A15, 0xE59C, 0x0000, 0x0000,
+  0x0000, 0xC7AE, 0xC7A6, 0x26D7, 0x26CF, 0x64CC, 0x0000, 0x0000,
+  0x64CC, 0x85FE, 0x65FD, 0x65FD, 0x85F4, 0x65FC, 0x65F3, 0x65F3,
+  0x85F2, 0x65EA, 0xA6E1, 0x85F2, 0xC5E9, 0x0000, 0x08E1, 0x08E1,
+  0x463D, 0x001F, 0xAAE0, 0xAAE0, 0x0000, 0xA8E0, 0xE7E8, 0xE7E0,
+  0x06E1, 0x26E1, 0x65E9, 0x08E1, 0xC5E9, 0xC5E9, 0x85EA, 0x65EA,
+  0x65F3, 0x85F2, 0x0000, 0x0000, 0x64CA, 0x65FC, 0x85F5, 0x65FD,
+  0x85FE, 0x0000, 0x0000, 0x0000, 0xA362, 0x26CF, 0x26CF, 0xA7A6,
+  0x6458, 0x470E, 0x001D, 0x2A15, 0xEA04, 0x0A15, 0xA664, 0x0000,
+  0x0000, 0x0000, 0x6786, 0xA7A6, 0xC7A6, 0x86CE, 0x0000, 0x0000,
+  0x64CB, 0x25F7, 0x85FE, 0x25F7, 0x64CA, 0x64CA, 0x65FD, 0x85FD,
+  0x85FC, 0x65F3, 0x0000, 0x64CA, 0x85F2, 0xC5E9, 0x27D1, 0xC5F1,
+  0x473E, 0x001D, 0x08E9, 0x8450, 0x8AC8, 0x06E9, 0x08E1, 0x8450,
+  0x65E1, 0x45E1, 0xC5E9, 0xC5E9, 0xA6E9, 0x27D1, 0x65F3, 0x65F3,
+  0x85F4, 0x65F2, 0x0000, 0x0000, 0x84CB, 0x65FD, 0x25FF, 0x85FE,
+  0x0000, 0x0000, 0x0000, 0x2232, 0x26CF, 0xC7AE, 0xC7A6, 0x480E,
+  0x001D, 0x0A15, 0xEA04, 0xEA04, 0xA66C, 0x0000, 0x0000, 0x0000,
+  0x6786, 0x6786, 0xC7A6, 0xC7A6, 0x64D4, 0x84CB, 0x25F7, 0x25F7,
+  0x25FF, 0x64CC, 0x0000, 0x85FC, 0x65F5, 0x85FC, 0x65C1, 0x0000,
+  0x64CA, 0x65F3, 0x65F3, 0x85F2, 0x65F2, 0xA6E1, 0x483E, 0x001D,
+  0x08E1, 0x65E1, 0x08E1, 0x45E1, 0x65E1, 0xC6C0, 0x0000, 0xC6C0,
+  0xC5E9, 0x85F2, 0xA6E1, 0x0000, 0x85F2, 0x65F4, 0x85FC, 0x65F5,
+  0x8450, 0x64CA, 0x85FD, 0x65FE, 0x65FE, 0x65FE, 0x0000, 0x0000,
+  0x0000, 0xE59C, 0xC7A6, 0xA7A6, 0xE59C, 0x490E, 0x001D, 0xA84D,
+  0xEA04, 0xA84D, 0xA66C, 0xA39A, 0x0000, 0x0000, 0x2218, 0x6786,
+  0x6786, 0x86D6, 0x66CE, 0x26CF, 0x46D7, 0x25F7, 0x84CB, 0x0000,
+  0xC490, 0x25F7, 0x65FE, 0x0000, 0x0000, 0x65F3, 0x85FC, 0x65F4,
+  0x65FB, 0x64CA, 0x85F2, 0x27D1, 0x493E, 0x001D, 0x27D1, 0x65E1,
+  0xA6E1, 0xA6E1, 0xC5E9, 0xC5E9, 0x27D1, 0x0000, 0x0000, 0x85F2,
+  0x65FB, 0x8450, 0x0000, 0x64CA, 0x65F5, 0x65FD, 0x85FE, 0x65FC,
+  0x85FD, 0x25F7, 0x25F7, 0x64CC, 0x0000, 0x0000, 0x0000, 0x65D5,
+  0x86D6, 0x6786, 0xE59C, 0x4A0E, 0x001C, 0x423A, 0xEA04, 0x2A15,
+  0xA36A, 0xA664, 0x0000, 0x0000, 0x0000, 0xE59C, 0x6786, 0x6786,
+  0xC7AE, 0xA7A6, 0x26D7, 0x64CC, 0x85CD, 0x65FE, 0x25F7, 0x65FE,
+  0x65FE, 0x84CB, 0x65FD, 0x85FD, 0x65F5, 0x65C1, 0x0000, 0x65FB,
+  0x65F3, 0x4A3F, 0x001B, 0xC5E9, 0xA6E1, 0x0000, 0x8B98, 0x85F2,
+  0x85F2, 0x65EA, 0x0000, 0x65F3, 0x65F3, 0x85FC, 0x65F3, 0x0000,
+  0x6B98, 0x85FD, 0x65FE, 0x25F7, 0x65FE, 0x25F7, 0x65FE, 0x0000,
+  0x0000, 0x0000, 0x64CC, 0x84CC, 0x6786, 0x6786, 0x4B0F, 0x001B,
+  0xEA04, 0xEA04, 0xA362, 0xA66C, 0x492D, 0x086E, 0x0000, 0x6786,
+  0x2866, 0x6786, 0x6786, 0xA7A6, 0x86D6, 0x26CF, 0x26CF, 0x25F7,
+  0x65FE, 0x0000, 0x65FD, 0x25F7, 0x85FE, 0x65F4, 0x0000, 0x0000,
+  0x85FD, 0x85FD, 0x6BA0, 0x4B3F, 0x001B, 0xC490, 0x65F3, 0x85EA,
+  0x0000, 0x0000, 0x65FB, 0x65F3, 0x65FC, 0x85FC, 0x6450, 0x65F3,
+  0x85FE, 0x65F5, 0x65FE, 0x85FD, 0x25FF, 0x25F7, 0x25F7, 0x25F7,
+  0x25FF, 0x0000, 0xA362, 0x64CC, 0x85D5, 0x8458, 0x6786, 0x286E,
+  0x4C0F, 0x001A, 0x692D, 0xEA04, 0xA84D, 0x0000, 0xA66C, 0xC834,
+  0x492D, 0x692D, 0xA36A, 0x0000, 0xA3A2, 0x0000, 0xC7A6, 0xC7AE,
+  0x26CF, 0x65CD, 0x0000, 0x0000, 0x65FD, 0x85FE, 0xA362, 0x0000,
+  0x2232, 0x65FD, 0x85FD, 0x84CB, 0x4C40, 0x001A, 0xA6E9, 0x65F3,
+  0x65FB, 0x4218, 0x0000, 0xC490, 0x85FC, 0x85FC, 0x0000, 0x0000,
+  0x64CC, 0x85FE, 0x65FE, 0x65F6, 0xA39A, 0xA39A, 0x0000, 0x4232,
+  0x26D7, 0x26CF, 0x65CD, 0xE59C, 0x0000, 0xA3A2, 0xA84D, 0x286E,
+  0x4D0F, 0x0007, 0xC834, 0xEA04, 0x2A0D, 0x0000, 0x0000, 0xA66C,
+  0x0A15, 0x4D1B, 0x000E, 0x6786, 0xA7A6, 0xC7A6, 0x0000, 0x0000,
+  0x25F7, 0x65FE, 0x0000, 0x0000, 0x4218, 0x65FE, 0x65FE, 0x85FD,
+  0x65F4, 0x4D40, 0x001A, 0x65FB, 0x65F3, 0x65F3, 0x85FC, 0xA362,
+  0x0000, 0x0000, 0x65F4, 0x65FD, 0x0000, 0x0000, 0x65FE, 0x25FF,
+  0x25FF, 0x0000, 0x0000, 0x0000, 0x0000, 0xE59C, 0xC7A6, 0x85CD,
+  0x0000, 0x0000, 0xE5A4, 0xA84D, 0xA664, 0x4E10, 0x0018, 0xEA04,
+  0xEA04, 0x0000, 0x492D, 0xEA04, 0xA66C, 0x0000, 0x0000, 0x0000,
+  0x0000, 0xE5A4, 0x6786, 0x6786, 0xE59C, 0x0000, 0x46D7, 0x66CE,
+  0x0000, 0x0000, 0x0000, 0x65FD, 0x25F7, 0x85FE, 0x25F7, 0x4E40,
+  0x0019, 0x2218, 0x85FD, 0x65FC, 0x84CC, 0x65FC, 0x8450, 0x0000,
+  0x0000, 0x85FD, 0x65FE, 0x0000, 0xA39A, 0x25FF, 0x25F7, 0x85CD,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x64CC, 0x6786, 0x6786, 0x0000,
+  0x286E, 0x492D, 0x4F10, 0x0018, 0x692D, 0xEA04, 0x0A15, 0x2A15,
+  0x492D, 0xA36A, 0x0000, 0x0000, 0x0000, 0x4218, 0xA84D, 0x286E,
+  0x6786, 0xA39A, 0xA7A6, 0xC7A6, 0x0000, 0x0000, 0x0000, 0x86D6,
+  0x25F7, 0x25F7, 0x25F7, 0x65F4, 0x4F41, 0x0018, 0x64CC, 0x85FE,
+  0x65FD, 0x65FE, 0x65FD, 0x0000, 0x0000, 0x0000, 0x65FE, 0x25F7,
+  0x0000, 0x25F7, 0x46CF, 0x25FF, 0x64CB, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x678E, 0xA84D, 0x286E, 0x692D, 0xA84D, 0x5010, 0x0017,
+  0xC83C, 0xEA04, 0xEA04, 0xA66C, 0x0A15, 0xEA04, 0x2A15, 0xA84D,
+  0xA66C, 0x492D, 0x692D, 0x0000, 0xA855, 0x286E, 0xE59C, 0x0000,
+  0x0000, 0x0000, 0x64CC, 0x26D7, 0x26CF, 0x25F7, 0x86D6, 0x5042,
+  0x0017, 0x65FD, 0x65FE, 0x65FE, 0x25F7, 0x65F4, 0x0000, 0x0000,
+  0x0000, 0x85FD, 0x25F7, 0x26CF, 0x64CC, 0x85CD, 0xC7A6, 0x65D5,
+  0xE59C, 0xE59C, 0x286E, 0x0866, 0x2232, 0x692D, 0x492D, 0xA3A2,
+  0x5111, 0x0016, 0xEA04, 0x2A15, 0xC834, 0x0A15, 0xA66C, 0xA84D,
+  0xA66C, 0x2A15, 0x0A0D, 0x0000, 0xA36A, 0xA855, 0xA84D, 0x086E,
+  0x6786, 0xC7A6, 0xA7A6, 0xC7A6, 0xA7A6, 0x26CF, 0x46CF, 0x64CC,
+  0x5142, 0x0016, 0x65FC, 0x25F7, 0x25FF, 0x25F7, 0x25F7, 0x65FE,
+  0x65FE, 0x86CE, 0x66D6, 0x26CF, 0x26CF, 0x86D6, 0x0000, 0xC7A6,
+  0x6786, 0xA3A2, 0x6786, 0x0866, 0x286E, 0xE5A4, 0x692D, 0x2A15,
+  0x5211, 0x0015, 0x0A15, 0xEA04, 0x0000, 0xC834, 0xA36A, 0xA66C,
+  0x2A15, 0xEA04, 0xA66C, 0x0000, 0x492D, 0x692D, 0xA84D, 0xA855,
+  0x286E, 0x086E, 0x6786, 0x6786, 0xC7A6, 0xA7A6, 0x86D6, 0x5243,
+  0x0015, 0x25F7, 0x25FF, 0x25F7, 0x26CF, 0x25F7, 0x26D7, 0x26CF,
+  0xA7A6, 0x26CF, 0xC7A6, 0xA7A6, 0x0000, 0xA3A2, 0x2866, 0x286E,
+  0xE59C, 0xA66C, 0xA664, 0x2232, 0x0A15, 0xA855, 0x5312, 0x0014,
+  0xEA04, 0x692D, 0x492D, 0x692D, 0x0A15, 0xEA04, 0x692D, 0x0000,
+  0x492D, 0x0A15, 0x286E, 0xA664, 0x086E, 0xE59C, 0x286E, 0x286E,
+  0x6786, 0x6786, 0xC7A6, 0x6458, 0x5343, 0x0015, 0xA39A, 0x25F7,
+  0x26CF, 0x25F7, 0x26D7, 0x46CF, 0x65CD, 0x84CC, 0x65D5, 0x65CD,
+  0x6786, 0xC7AE, 0x0000, 0x286E, 0xA84D, 0xA84D, 0xA66C, 0xA855,
+  0xEA04, 0x0A15, 0x4232, 0x5412, 0x0013, 0xEA04, 0xEA04, 0xEA04,
+  0xEA04, 0xEA04, 0x223A, 0xA66C, 0x692D, 0xEA04, 0x492D, 0xC834,
+  0xA66C, 0x2A15, 0x492D, 0x692D, 0xA855, 0xA84D, 0x286E, 0xE5A4,
+  0x5444, 0x0013, 0x65CD, 0x26D7, 0xC7A6, 0xA7A6, 0xC7A6, 0xA7A6,
+  0x6786, 0xE59C, 0xE59C, 0x286E, 0xA84D, 0xE5A4, 0xA664, 0xA66C,
+  0x492D, 0x0A15, 0xEA04, 0xEA04, 0xC834, 0x5513, 0x0011, 0xEA04,
+  0xEA04, 0xC834, 0xA66C, 0xA36A, 0x2A0D, 0xEA04, 0xA66C, 0xA36A,
+  0xEA04, 0xEA04, 0x0A15, 0x2A15, 0x492D, 0x492D, 0xA84D, 0x286E,
+  0x5545, 0x0012, 0xA7A6, 0xC7A6, 0x6786, 0xA7AE, 0x6786, 0x6786,
+  0x2866, 0x286E, 0xE59C, 0xA36A, 0x492D, 0x692D, 0xA66C, 0xA362,
+  0xA66C, 0xEA04, 0xEA04, 0xA36A, 0x5613, 0x0010, 0x0A15, 0xEA04,
+  0x0000, 0xC83C, 0xA84D, 0xEA04, 0x2A15, 0xA66C, 0xEA04, 0xEA04,
+  0xEA04, 0xEA04, 0xEA04, 0xEA04, 0x0A15, 0x692D, 0x5646, 0x0010,
+  0x6786, 0x6786, 0x286E, 0x086E, 0xA84D, 0xA855, 0x492D, 0x692D,
+  0xA3A2, 0xA84D, 0xEA04, 0xA84D, 0xA66C, 0xA66C, 0xEA04, 0x692D,
+  0x5714, 0x000E, 0xEA04, 0x0A15, 0x692D, 0xEA04, 0x0A15, 0xC834,
+  0xEA04, 0xEA04, 0xEA04, 0xEA04, 0xEA04, 0xEA04, 0xEA04, 0x0A15,
+  0x5747, 0x000E, 0x286E, 0xA84D, 0xA855, 0xA855, 0x692D, 0x492D,
+  0x2A15, 0x0A15, 0x692D, 0x492D, 0xEA04, 0x2A15, 0xEA04, 0x0A15,
+  0x5814, 0x000D, 0xC834, 0xEA04, 0xEA04, 0xEA04, 0xEA04, 0xEA04,
+  0xEA04, 0xEA04, 0xEA04, 0xEA04, 0xEA04, 0xEA04, 0x2A15, 0x5848,
+  0x000D, 0xA66C, 0x492D, 0x2A15, 0x0A15, 0x2A15, 0x0A15, 0xEA04,
+  0xEA04, 0x2A15, 0xEA04, 0xEA04, 0xEA04, 0xC83C, 0x5915, 0x000B,
+  0xC834, 0xEA04, 0xEA04, 0xEA04, 0xEA04, 0xEA04, 0xEA04, 0xEA04,
+  0xEA04, 0xEA04, 0x692D, 0x5949, 0x000B, 0xA66C, 0x0A15, 0xEA04,
+  0xEA04, 0xEA04, 0xEA04, 0xEA04, 0xEA04, 0xEA04, 0xEA04, 0xC834,
+  0x5A16, 0x0008, 0xC83C, 0xEA04, 0xEA04, 0xEA04, 0xEA04, 0xEA04,
+  0xEA04, 0x0A15, 0x5A4A, 0x0009, 0xA36A, 0x2A0D, 0xEA04, 0xEA04,
+  0xEA04, 0xEA04, 0xEA04, 0xEA04, 0xC834, 0x5B17, 0x0006, 0x2232,
+  0xC83C, 0xEA04, 0x2A15, 0xC834, 0xA66C, 0x5B4C, 0x0006, 0xA66C,
+  0x492D, 0x692D, 0x0A15, 0x692D, 0x223A, 0x0006, 0x0005, 0x2A15,
+  0x0A15, 0x2A15, 0xC834, 0x223A, 0x005E, 0x0005, 0x423A, 0xA84D,
+  0x492D, 0x692D, 0xC83C, 0x010A, 0x0003, 0x692D, 0xC834, 0x2232,
+  0x015C, 0x0009, 0xA362, 0xA66C, 0xA855, 0x2A15, 0xEA04, 0xEA04,
+  0xEA04, 0x0A15, 0xA855, 0x0203, 0x0001, 0x0A15, 0x020D, 0x0003,
+  0x2A15, 0xC83C, 0x2232, 0x0259, 0x0007, 0x423A, 0xE59C, 0x286E,
+  0x492D, 0x492D, 0x2A15, 0x0A15, 0x0265, 0x0001, 0x692D, 0x0310,
+  0x0002, 0x492D, 0xA664, 0x0357, 0x000A, 0xE59C, 0xC7AE, 0x6786,
+  0x6786, 0x086E, 0x286E, 0xA84D, 0xA855, 0x692D, 0x0A15, 0x0366,
+  0x0001, 0xA855, 0x0401, 0x0001, 0x423A, 0x040F, 0x0005, 0x0A15,
+  0x2A15, 0x492D, 0x692D, 0xE5A4, 0x0455, 0x000D, 0x65CD, 0xC7A6,
+  0xC7A6, 0xA7AE, 0xC7A6, 0x6786, 0x6786, 0x086E, 0xA84D, 0x492D,
+  0x692D, 0x0A15, 0x2A15, 0x0467, 0x0001, 0x223A, 0x0501, 0x0001,
+  0x0A15, 0x050E, 0x0008, 0x2A15, 0x0A15, 0xA855, 0xA84D, 0x086E,
+  0x2866, 0x6786, 0xE59C, 0x0553, 0x0015, 0x65CD, 0x25FF, 0x26CF,
+  0x26CF, 0x26CF, 0x26D7, 0xC7A6, 0xA7AE, 0x6786, 0x6786, 0x286E,
+  0x286E, 0xA84D, 0xA855, 0x492D, 0x2A0D, 0xEA04, 0xEA04, 0xEA04,
+  0xEA04, 0xA66C, 0x0600, 0x0007, 0x4218, 0x2A15, 0xEA04, 0xEA04,
+  0x0A15, 0x0000, 0x692D, 0x060D, 0x000B, 0x0A15, 0x2A15, 0x492D,
+  0x6935, 0xA855, 0x286E, 0x6786, 0x6786, 0xA7A6, 0xC7A6, 0x65D5,
+  0x0651, 0x0017, 0x65FC, 0x85FE, 0x25F7, 0x25F7, 0x25F7, 0x26CF,
+  0x25FF, 0x26CF, 0x26CF, 0xA7A6, 0xC7A6, 0x6786, 0x6786, 0x086E,
+  0x286E, 0x492D, 0x492D, 0x2A15, 0xA66C, 0x0000, 0xEA04, 0xEA04,
+  0x492D, 0x0700, 0x001A, 0xC834, 0xEA04, 0xEA04, 0xEA04, 0xEA04,
+  0xC83C, 0xA84D, 0x492D, 0xEA04, 0xEA04, 0xA855, 0x4232, 0x492D,
+  0xA66C, 0x086E, 0xA84D, 0x286E, 0x0866, 0x6786, 0x6786, 0xC7A6,
+  0xA7A6, 0x26D7, 0x46CF, 0x25F7, 0x64CC, 0x074F, 0x001A, 0x65F3,
+  0x65FE, 0x65FE, 0x25F7, 0x25F7, 0x25FF, 0x25F7, 0x25F7, 0x25F7,
+  0x25FF, 0x26CF, 0x26D7, 0xA7A6, 0xC7A6, 0x6786, 0xE59C, 0x086E,
+  0x286E, 0xA855, 0xA84D, 0xA664, 0xA66C, 0xEA04, 0xEA04, 0x2A15,
+  0xA66C, 0x0800, 0x001C, 0x2A15, 0xEA04, 0xEA04, 0xEA04, 0xEA04,
+  0x0A15, 0xEA04, 0x0000, 0x692D, 0xEA04, 0xC83C, 0x0000, 0xA66C,
+  0x286E, 0x0000, 0xE59C, 0x086E, 0x6786, 0x6786, 0xC7A6, 0xA7A6,
+  0x26D7, 0x26CF, 0x26D7, 0x26CF, 0x25F7, 0x65FE, 0x84CB, 0x084D,
+  0x001C, 0x64CA, 0x65FC, 0x85FD, 0x65F5, 0x85FE, 0x65FE, 0x65FE,
+  0x65F6, 0x25F7, 0x65FE, 0x25F7, 0x26CF, 0x25FF, 0xA362, 0x0000,
+  0x65CD, 0x65CD, 0x0000, 0x6786, 0x286E, 0x286E, 0xA39A, 0x492D,
+  0x2A15, 0x0A15, 0xEA04, 0xEA04, 0xA66C, 0x0900, 0x0001, 0x692D,
+  0x0906, 0x0018, 0xC83C, 0xEA04, 0xEA04, 0xEA04, 0x492D, 0x0000,
+  0x2232, 0x286E, 0x0000, 0x0000, 0x6786, 0x6786, 0xA7A6, 0xE59C,
+  0x26CF, 0x26CF, 0x25F7, 0x25FF, 0x25F7, 0x25F7, 0x25F7, 0x65FE,
+  0x85FE, 0xC39A, 0x094B, 0x001E, 0xC490, 0x65FC, 0x85F4, 0x65FC,
+  0x85F4, 0x65FD, 0x65FD, 0x65FE, 0x85FE, 0x25F7, 0x65FD, 0x65CD,
+  0x25F7, 0x25FF, 0x85FE, 0x0000, 0x64CB, 0x86D6, 0x0000, 0x4218,
+  0x6786, 0x6786, 0x086E, 0x286E, 0x4218, 0x286E, 0x0A15, 0x2A15,
+  0xEA04, 0xA84D, 0x0A00, 0x0020, 0x0A15, 0xEA04, 0xEA04, 0xEA04,
+  0xEA04, 0xA855, 0x0000, 0xA36A, 0xEA04, 0x2A0D, 0x0A15, 0x692D,
+  0xA855, 0xA84D, 0xE5A4, 0x0000, 0xE59C, 0xE59C, 0xC7AE, 0x26CF,
+  0x64CC, 0x65CD, 0x46D7, 0x25F7, 0x25F7, 0x25FF, 0x65FE, 0x65FE,
+  0x65F5, 0x65FE, 0x65FC, 0x4218, 0x0A49, 0x0020, 0x4218, 0x85F2,
+  0x65FB, 0x65F3, 0x65F3, 0x65F3, 0x65FC, 0x85FC, 0x65F5, 0x85FD,
+  0x65FE, 0x65F3, 0x65FC, 0x85F6, 0x65FD, 0x64CC, 0x85FD, 0x0000,
+  0x65FE, 0x86CE, 0x65CD, 0xC7A6, 0xA7A6, 0x6786, 0x6786, 0x0000,
+  0x0000, 0xA664, 0x492D, 0x2A15, 0x0A15, 0xC834, 0x0B00, 0x0021,
+  0x692D, 0xEA04, 0xEA04, 0xEA04, 0xEA04, 0x0A15, 0xA855, 0xA66C,
+  0x692D, 0x0A15, 0x692D, 0x492D, 0xA855, 0xA84D, 0x6786, 0xE59C,
+  0xE59C, 0x0000, 0x26CF, 0x26CF, 0x25FF, 0x0000, 0xE59C, 0x25F7,
+  0x25F7, 0x65FE, 0x25F7, 0x65F6, 0x65FE, 0x85FD, 0x65FD, 0x85F4,
+  0x64CA, 0x0B48, 0x0021, 0x65C1, 0xC5E9, 0x85F2, 0x65EA, 0x65FB,
+  0x65F3, 0x85F4, 0x65FC, 0x85F4, 0x65FC, 0x85FD, 0x6458, 0xA362,
+  0x85FE, 0x25FF, 0xC39A, 0xA39A, 0x64CB, 0xE59C, 0x25F7, 0x25FF,
+  0x26CF, 0x26D7, 0xC7A6, 0xA7A6, 0x6786, 0xC7A6, 0xE5A4, 0xA855,
+  0x692D, 0x492D, 0x2A15, 0xA855, 0x0C00, 0x0001, 0x492D, 0x0C06,
+  0x001C, 0x2A15, 0xA855, 0x0A15, 0x692D, 0xA66C, 0xA664, 0xE59C,
+  0x6786, 0x286E, 0xA7AE, 0xC7A6, 0x0000, 0x66D6, 0x64CC, 0x86CE,
+  0x25FF, 0x86CE, 0x65FE, 0x6450, 0x85FE, 0x65FD, 0x65FD, 0x85FD,
+  0x65FD, 0x85FC, 0x65F4, 0x65F3, 0x85F2, 0x0C47, 0x0022, 0xE8E0,
+  0x65E1, 0xC5E9, 0xC5E9, 0x85EA, 0x65F2, 0x85EA, 0x65F2, 0x65F3,
+  0x85EA, 0x64CA, 0x65F3, 0x65FB, 0x65FD, 0x85CD, 0x64CC, 0x65F3,
+  0x4218, 0x25FF, 0x25F7, 0x25F7, 0x86D6, 0x64CC, 0xA39A, 0x86CE,
+  0xC7A6, 0xC7A6, 0xE59C, 0x086E, 0xA84D, 0xA855, 0x492D, 0x2A15,
+  0xC834, 0x0D00, 0x0001, 0xA84D, 0x0D07, 0x001C, 0xA66C, 0x492D,
+  0x492D, 0x286E, 0xE59C, 0x6786, 0x6786, 0xC7A6, 0xA39A, 0x26CF,
+  0x26D7, 0x25F7, 0x65CD, 0x0000, 0x85FE, 0x25F7, 0x65FD, 0x64CA,
+  0x85FD, 0x4218, 0x64CC, 0x85FD, 0x65F4, 0x85FC, 0x65F3, 0x65F3,
+  0x85F2, 0x85EA, 0x0D46, 0x0023, 0x06E9, 0x06E1, 0x65E1, 0x45E1,
+  0xC5E9, 0xC5E9, 0x85EA, 0x85F2, 0xA6E1, 0xA6E1, 0x85F2, 0xC490,
+  0x65FC, 0x85F4, 0x65FD, 0x0000, 0x85F4, 0x65FD, 0x65FE, 0x65FE,
+  0x65FD, 0x65FE, 0x85FE, 0x64CC, 0xE59C, 0x66CE, 0x26D7, 0xC7A6,
+  0xA36A, 0xE59C, 0x286E, 0xA855, 0xA84D, 0x492D, 0xE5A4, 0x0E00,
+  0x0024, 0x423A, 0x492D, 0xEA04, 0xEA04, 0xEA04, 0xEA04, 0xA66C,
+  0x0000, 0x2A15, 0xA84D, 0x0000, 0x0000, 0x0000, 0xA3A2, 0x6786,
+  0x0000, 0x85CD, 0x86D6, 0x26CF, 0x25FF, 0x0000, 0x0000, 0x65FE,
+  0x65FE, 0x65F5, 0x65FD, 0x85FD, 0x65F4, 0x85FC, 0x65F4, 0x65F3,
+  0x65FB, 0x85EA, 0x65F2, 0xC5E9, 0xC5E9, 0x0E45, 0x0023, 0x08E1,
+  0xE7E0, 0x06E1, 0x06E1, 0x65E1, 0x65E1, 0xC5E9, 0xA6E1, 0xC5E9,
+  0xA6E1, 0x85F2, 0x85F2, 0x65F3, 0x65F3, 0x85FC, 0x0000, 0x0000,
+  0x65F4, 0x85FE, 0x65FD, 0x64CC, 0x0000, 0x85F5, 0x0000, 0x0000,
+  0x0000, 0xE59C, 0xC7A6, 0x66D6, 0x0000, 0xC7A6, 0x0866, 0x286E,
+  0xA84D, 0x086E, 0x0F06, 0x001F, 0x492D, 0x0000, 0x492D, 0xA855,
+  0x6786, 0xE59C, 0xC7A6, 0xA7A6, 0x46CF, 0x65CD, 0x25FF, 0xA362,
+  0x25F7, 0x25F7, 0x65FE, 0x0000, 0x65F5, 0x65FE, 0x85FE, 0x65FD,
+  0x85F4, 0x65FB, 0x65F3, 0x65EA, 0x65F3, 0x85F2, 0x85EA, 0xC5E9,
+  0x85F2, 0xC5E9, 0xA6E1, 0x0F44, 0x0024, 0xAAE0, 0xC8E0, 0x08E1,
+  0xE7E8, 0x06E1, 0x06E1, 0x65E1, 0x65E9, 0xA6E1, 0x45E1, 0xC5E1,
+  0xC5E9, 0x65F2, 0x85F2, 0x65F3, 0x0000, 0x0000, 0x65F4, 0x85FD,
+  0x84CB, 0x65F3, 0x65FC, 0x84CB, 0x65F6, 0x85FD, 0x65FD, 0x84CC,
+  0x64CC, 0x26D7, 0x66D6, 0x0000, 0xC7A6, 0x6786, 0x086E, 0x286E,
+  0xA66C, 0x1002, 0x0024, 0x2A15, 0xEA04, 0xEA04, 0x0A15, 0x2A15,
+  0x492D, 0x6935, 0xA855, 0xA84D, 0x6786, 0xA3A2, 0xE59C, 0xC7A6,
+  0x26D7, 0x65CD, 0x84CC, 0x64CC, 0x85FE, 0x65FE, 0x65FC, 0x6450,
+  0x85FD, 0x85FD, 0x65FC, 0x64CA, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x85EA, 0xC5E9, 0xC5E9, 0x45E1, 0x45E1, 0x06E1, 0x08E1, 0x102C,
+  0x0002, 0xAAC8, 0xE490, 0x1043, 0x0024, 0xAAE0, 0xC8E8, 0xC8E0,
+  0xA8E0, 0xC8E0, 0xA8E8, 0xE7E0, 0xC8E0, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x27D1, 0xC5E9, 0x85F2, 0xA6E1, 0x0000, 0x65F3, 0x85FC,
+  0x65F3, 0x64CA, 0x65FC, 0x85F5, 0x65FD, 0x85FE, 0x64CB, 0x85FD,
+  0x25F7, 0x25F7, 0x26CF, 0x26CF, 0xC7A6, 0xA7A6, 0x6786, 0x6786,
+  0xE59C, 0x1102, 0x000D, 0xA66C, 0xEA04, 0xEA04, 0x2A15, 0x492D,
+  0x492D, 0x2866, 0xA66C, 0x6786, 0x6786, 0xA7A6, 0xC7A6, 0x85CD,
+  0x1114, 0x0013, 0x65CD, 0x65FE, 0x85F5, 0x65FD, 0x84CB, 0x0000,
+  0x85FC, 0x85F2, 0x0000, 0x0000, 0x0000, 0x4218, 0xC5E9, 0x45E1,
+  0x65E1, 0x26E9, 0x06E1, 0xE7E0, 0x08E1, 0x112C, 0x0002, 0xACE0,
+  0xACE8, 0x113B, 0x0002, 0xACE0, 0xAEE0, 0x1142, 0x0025, 0xACE0,
+  0xAAE8, 0xACE0, 0xAAE0, 0xAAE0, 0xA8E8, 0xC8E0, 0xC8E0, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x06E1, 0x45E9, 0x0000, 0xA6E1, 0x85EA,
+  0x85F2, 0x65FB, 0xC490, 0x0000, 0x0000, 0x0000, 0x4218, 0xA39A,
+  0x65FD, 0x65FE, 0x85FE, 0x25F7, 0x65FD, 0x65CD, 0x86D6, 0x26D7,
+  0xA7A6, 0xC7A6, 0x6786, 0xA66C, 0x1203, 0x0005, 0x492D, 0xEA04,
+  0x2A15, 0x492D, 0x286E, 0x120D, 0x0002, 0x26D7, 0x26CF, 0x1215,
+  0x0019, 0x85FC, 0x65FD, 0x85FD, 0x65F3, 0x0000, 0x0000, 0x65F3,
+  0x65F2, 0x0000, 0x0000, 0x0000, 0x8450, 0x45E9, 0x08E1, 0x27D1,
+  0xE7E8, 0xE7E0, 0xC8E0, 0xAAE0, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x6B98, 0xACE8, 0x123B, 0x0001, 0xAEE8, 0x1241, 0x0014, 0x8EC8,
+  0xACE8, 0xACE0, 0xAAE8, 0xAAE0, 0xAAE0, 0xAAE0, 0xAAE8, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x08E1, 0x06E1, 0x8450, 0x0000, 0xC5E9,
+  0xC5E9, 0x85F2, 0xA6E1, 0x125B, 0x000B, 0x85FE, 0x85FE, 0x64CC,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x86CE, 0x26CF, 0xA7A6, 0xC7A6,
+  0x1303, 0x0005, 0xC834, 0x2A15, 0x0A15, 0xA84D, 0x2866, 0x130E,
+  0x0003, 0x25FF, 0x25F7, 0xA39A, 0x1316, 0x0019, 0x85F5, 0x65FC,
+  0x85FC, 0x65C1, 0x0000, 0x0000, 0x85F2, 0xC5E9, 0x8B98, 0x0000,
+  0x0000, 0x4218, 0x08E1, 0xAAE8, 0x6B98, 0xC8E0, 0xAAE8, 0xAAE0,
+  0x6B98, 0x0000, 0x0000, 0x0000, 0x0000, 0xAEE8, 0xAEC8, 0x133A,
+  0x001A, 0xB1D0, 0xB1C8, 0x0000, 0x0000, 0x0000, 0x0000, 0x6B98,
+  0xAEE0, 0xAEE0, 0xACE8, 0xAEE0, 0xACE0, 0xACE0, 0xACE8, 0x0000,
+  0x0000, 0x0000, 0x8B98, 0x08E1, 0xA8E0, 0x0000, 0x0000, 0x08E1,
+  0x65E1, 0xC5E9, 0xC5E9, 0x1359, 0x0003, 0xC490, 0x65FD, 0x64CC,
+  0x1362, 0x0003, 0x65FE, 0x26D7, 0x26CF, 0x1404, 0x002B, 0x0A15,
+  0x692D, 0x492D, 0x286E, 0x0000, 0x0000, 0x0000, 0x0000, 0x6458,
+  0x85D5, 0x85D5, 0x25F7, 0x25FF, 0xA39A, 0x0000, 0x0000, 0x8450,
+  0x8458, 0x65FB, 0x85FC, 0x65F3, 0x65F3, 0xC490, 0x0000, 0x0000,
+  0x65C9, 0x65E1, 0x08E1, 0x0000, 0x0000, 0x0000, 0xAAE8, 0xA8E0,
+  0x8AC8, 0xAEC8, 0xAAE0, 0xAAE8, 0x0000, 0x0000, 0x0000, 0x0000,
+  0xD1A8, 0x8EC8, 0x143A, 0x002B, 0xAEC8, 0x6B98, 0x0000, 0x0000,
+  0x0000, 0x4218, 0xAEE8, 0xAEE8, 0xAEE8, 0xAEE0, 0xAEC8, 0xAEE0,
+  0xACE8, 0x0000, 0x0000, 0x0000, 0x8AC8, 0xAAE0, 0x8B98, 0x0000,
+  0x0000, 0xC6C0, 0x06E9, 0x65E1, 0x45E1, 0x27D1, 0x0000, 0x8458,
+  0x4218, 0x0000, 0x85C9, 0x85FC, 0x65FC, 0x85F4, 0x65F3, 0x6450,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x86D6, 0x46D7, 0xA7A6, 0x1504,
+  0x002C, 0xA84D, 0x492D, 0xA84D, 0x286E, 0x0000, 0x0000, 0x0000,
+  0xE59C, 0x85CD, 0x84CB, 0x2232, 0x0000, 0x65FE, 0x65FE, 0x65F6,
+  0x85FD, 0x65FD, 0x85F4, 0x65FC, 0x65F3, 0x65F3, 0x85F2, 0x85F2,
+  0xC6E1, 0x0000, 0x06E1, 0x65E1, 0x06E9, 0x06E1, 0xC8E0, 0x0000,
+  0x0000, 0x8AC8, 0xAAE0, 0xACE8, 0xACE0, 0xACE0, 0xACE0, 0x0000,
+  0x0000, 0x0000, 0x0000, 0xAEE8, 0x8BA0, 0x1539, 0x002C, 0x6B98,
+  0xB1C8, 0x0000, 0x0000, 0x0000, 0x0000, 0xB0E0, 0xB0E0, 0xB0E0,
+  0xB0E0, 0xAEE0, 0xB0E0, 0xAEC8, 0x0000, 0x0000, 0xACE0, 0xACE8,
+  0xACE0, 0xAAE8, 0x8B58, 0x0000, 0xAAE0, 0xE7E0, 0x26E9, 0x06E1,
+  0x45E1, 0x45E1, 0xC5E9, 0xC5E9, 0x85EA, 0x65F2, 0x65F3, 0x65FB,
+  0x0000, 0x84CB, 0x85FD, 0x85FD, 0xA39A, 0x0000, 0x0000, 0x2218,
+  0x25F7, 0x26D7, 0x86CE, 0x1604, 0x002C, 0xA66C, 0xA84D, 0xA855,
+  0x286E, 0xA36A, 0x0000, 0x65CD, 0x86D6, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x65FD, 0x65FE, 0x65FD, 0x85F5, 0x65FC, 0x85F4, 0x65F3,
+  0x64CA, 0x4218, 0x65C9, 0xA6E1, 0xC5E9, 0x65E9, 0x45E1, 0x8AC8,
+  0x8450, 0xC8E8, 0xC8E0, 0xA8E8, 0xACE0, 0x0000, 0x0000, 0xACE0,
+  0xACE0, 0xACE8, 0xAEE0, 0xAEC8, 0x0000, 0x0000, 0x0000, 0xB1A8,
+  0xB1C8, 0x1639, 0x002C, 0xB1D0, 0x8B98, 0x0000, 0x0000, 0x0000,
+  0xB1B0, 0xB0E0, 0xB0E0, 0xB0E0, 0xB0E0, 0xB0E0, 0x0000, 0x0000,
+  0xAEC8, 0xAEE8, 0xACE0, 0xACE0, 0x6B98, 0xACE8, 0xAAE0, 0xAAE0,
+  0xC8E8, 0xA8E0, 0xC8E0, 0xA8E0, 0x27D1, 0x65E9, 0x45E1, 0xC5E9,
+  0xC5E9, 0x85EA, 0x85F2, 0x65C1, 0x0000, 0x0000, 0x0000, 0xA39A,
+  0x85FC, 0xA362, 0x0000, 0x84CC, 0x25F7, 0x25F7, 0x65CD, 0x1704,
+  0x002D, 0xE59C, 0xA84D, 0x286E, 0x286E, 0x65CD, 0x2232, 0x86CE,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x65FC, 0x25F7, 0x85FE, 0x65F5,
+  0x84CB, 0x85FC, 0x65F4, 0x85FC, 0x65FB, 0x85F2, 0x0000, 0x0000,
+  0x4218, 0x65E1, 0x06E9, 0x8AC8, 0x0000, 0x0000, 0x8B98, 0xAAE0,
+  0xAAE0, 0xACE0, 0xACE8, 0x8EC8, 0xAEE0, 0xAEE0, 0xAEE8, 0xB0E8,
+  0x8B60, 0x0000, 0x0000, 0x4218, 0xB1C8, 0x8B60, 0x1738, 0x002D,
+  0x8B58, 0xD1B0, 0x0000, 0x0000, 0x0000, 0x4218, 0xB0E8, 0xB1C8,
+  0xB0E0, 0xB0E0, 0xB0E0, 0x4218, 0xB0E0, 0xB0E0, 0xB0E0, 0xAEE8,
+  0xB1C8, 0x0000, 0x0000, 0xACE0, 0xACE0, 0xAAE8, 0x8B98, 0x0000,
+  0x0000, 0xAAE0, 0x06E1, 0x06E9, 0x65E1, 0x45E1, 0xA6E1, 0x85F2,
+  0x65F3, 0x65F3, 0x0000, 0x0000, 0x0000, 0x0000, 0x84CB, 0x65FC,
+  0x0000, 0x65FE, 0x25F7, 0x25FF, 0x84CC, 0x1805, 0x002C, 0xA84D,
+  0xA84D, 0x678E, 0x6786, 0xA7A6, 0xE59C, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x65FE, 0x65FE, 0x65FE, 0x64CC, 0x85FC, 0x0000, 0x65C1,
+  0x65F3, 0x65FB, 0x85EA, 0xC5E9, 0x6450, 0x0000, 0xE498, 0x06E9,
+  0xE7E0, 0xAAE0, 0x0000, 0x0000, 0x0000, 0xACE0, 0xACE8, 0xACE0,
+  0xAEC8, 0xAEE0, 0xAEE8, 0xB0E0, 0xB1C8, 0xB0E0, 0x0000, 0x0000,
+  0x0000, 0xB1A8, 0xD1A8, 0x1838, 0x002D, 0xD190, 0xD190, 0x0000,
+  0x0000, 0x0000, 0xB1C8, 0xD1B0, 0xD1A8, 0xB1C8, 0xB0E8, 0xB1C8,
+  0xB0E0, 0xB0E0, 0xB0E0, 0xAEE0, 0x8458, 0x0000, 0x4218, 0x8ED0,
+  0xACE8, 0xACE0, 0x8AC8, 0x0000, 0x8B58, 0xC8E8, 0xE7E0, 0xE7E0,
+  0x06E9, 0xC6C0, 0xC6C0, 0x08E1, 0xC5E9, 0x85EA, 0x65F3, 0x85F2,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x85F4, 0x84CB, 0x65FE, 0x25F7,
+  0x25F7, 0x6458, 0x1905, 0x0005, 0xA84D, 0x286E, 0x6786, 0xA7A6,
+  0xC7A6, 0x190F, 0x0022, 0x65FE, 0x85FE, 0x65FD, 0x85FC, 0x8450,
+  0x0000, 0x0000, 0x65C1, 0x85F2, 0x85F2, 0xC5E9, 0xC5E9, 0xC6C0,
+  0x6B98, 0xE7E0, 0x08E1, 0xC8E0, 0xAAE0, 0xAAE8, 0x6BA0, 0x4218,
+  0xAEE0, 0xAEE8, 0x8B60, 0x4218, 0xB0E0, 0xB0E0, 0xB0E0, 0xB1C8,
+  0xD1B0, 0x0000, 0x0000, 0x8B60, 0xB1D0, 0x1938, 0x002C, 0xD1B0,
+  0x4218, 0x0000, 0x0000, 0xD190, 0xB1A8, 0xD1B0, 0xB1A8, 0xB1C8,
+  0xB1D0, 0xF178, 0xB1A8, 0xB0E0, 0xB0E0, 0x0000, 0x4218, 0xB0E0,
+  0xAEE8, 0xAEE0, 0xACE0, 0xAEE8, 0x0000, 0x8B98, 0xAAE0, 0xAAE0,
+  0xA8E8, 0xE7E8, 0x8450, 0x0000, 0x0000, 0x27D1, 0xA6E1, 0x85F2,
+  0x65EA, 0x65F3, 0x0000, 0x0000, 0x0000, 0x0000, 0x84CB, 0x65FE,
+  0x65FE, 0x25FF, 0x45F7, 0x1A05, 0x002D, 0x086E, 0x286E, 0xA7A6,
+  0xC7A6, 0x26D7, 0x2218, 0x0000, 0x0000, 0x0000, 0x0000, 0x85FE,
+  0x65FD, 0x65FD, 0x85FC, 0x65F3, 0x6450, 0x0000, 0x0000, 0x85C9,
+  0xC5E9, 0xC5E9, 0x45E1, 0x06E1, 0xE7E8, 0xE7E0, 0xC8E0, 0xAAE0,
+  0xC8E8, 0xAAE0, 0xACE0, 0xAEE0, 0xACE8, 0xAEE0, 0xAEE0, 0x0000,
+  0x0000, 0x8B58, 0xB0E8, 0xB0E0, 0xB1C8, 0x0000, 0x0000, 0x0000,
+  0xD188, 0xF178, 0x1A37, 0x002D, 0xD178, 0xF178, 0x0000, 0x0000,
+  0x0000, 0xD190, 0xD1B0, 0xB1A8, 0xD1B0, 0x8B58, 0x0000, 0x0000,
+  0xB1D0, 0xB1C8, 0xB1C8, 0xB1C8, 0xB0E8, 0xAEE0, 0xB0E0, 0x8EC8,
+  0xAEE8, 0xACE0, 0xAEE0, 0xACE0, 0xACE8, 0xC8E0, 0xA8E0, 0x8450,
+  0x0000, 0x0000, 0x4218, 0x08E9, 0xC5E9, 0xC5E9, 0x85F2, 0x85F2,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x64CA, 0x65F5, 0x85FE, 0x65FE,
+  0x25F7, 0x1B05, 0x0005, 0x2866, 0x6786, 0xA7A6, 0x26CF, 0x46CF,
+  0x1B0F, 0x0023, 0x65FC, 0x65FE, 0x85F5, 0x65FD, 0x85FC, 0x65F4,
+  0x85F2, 0x85EA, 0xC6C0, 0xC5E9, 0x45E1, 0x65E9, 0x06E1, 0x08E1,
+  0xC8E0, 0xAAE0, 0xAAE8, 0xACE0, 0xACE0, 0xAEE0, 0xAEE8, 0xAEE0,
+  0xAEE0, 0xB0E8, 0xB1C8, 0x0000, 0x0000, 0x8B60, 0xB1C8, 0xB1C8,
+  0xB1B0, 0x0000, 0x0000, 0xF178, 0xD190, 0x1B37, 0x002D, 0xF178,
+  0x3149, 0x0000, 0x0000, 0xF178, 0xF188, 0xD190, 0xB1B0, 0x0000,
+  0x0000, 0x0000, 0xD1A8, 0xD1B0, 0xB1C8, 0xB1C8, 0xB0E0, 0xB0E0,
+  0xB0E0, 0xB0E0, 0xB0E0, 0xAEE0, 0xAEE0, 0xACE0, 0xAEE8, 0xACE0,
+  0xACE0, 0xAAE0, 0x0000, 0x8AC8, 0x08E1, 0x06E9, 0x65E1, 0x45E1,
+  0xC5E9, 0xC5E9, 0xA39A, 0x0000, 0x0000, 0x0000, 0x0000, 0x84CB,
+  0x65FE, 0x65FE, 0x25F7, 0x66CE, 0x1C05, 0x0005, 0x6786, 0x6786,
+  0xA7A6, 0xC7AE, 0x26CF, 0x1C0F, 0x0055, 0x65FE, 0x65FD, 0x65FD,
+  0x85FC, 0x65F4, 0x65F3, 0x65F3, 0xC5E9, 0xC5E9, 0x45E1, 0x65E1,
+  0x06E9, 0x08E1, 0xC8E0, 0xA8E0, 0xC8E0, 0xAAE8, 0xAAE0, 0xACE0,
+  0xACE0, 0xAEE8, 0xAEE0, 0xB0E0, 0xAEE0, 0xB0E0, 0x8B58, 0x0000,
+  0x0000, 0xB1D0, 0xB1A8, 0xD1B0, 0x0B19, 0x0000, 0x0000, 0xD178,
+  0x0B19, 0x0000, 0x0000, 0x0000, 0x0B21, 0x1161, 0x0000, 0x0000,
+  0x0B21, 0xF178, 0xD178, 0xF178, 0x1161, 0x0000, 0x0000, 0xD178,
+  0xD190, 0xD1B0, 0xD1A8, 0xB1D0, 0xB1C8, 0xB1C8, 0xB1C8, 0xB0E8,
+  0xAEE0, 0xB0E0, 0xAEE0, 0xAEE8, 0xACE0, 0xACE0, 0xAAE0, 0xAAE8,
+  0xA8E0, 0xC8E0, 0xA8E0, 0x06E9, 0x26E1, 0x65E1, 0x45E1, 0xC5E9,
+  0xA6E1, 0x0000, 0x0000, 0x0000, 0x0000, 0x85FB, 0x85FD, 0x65F6,
+  0x65FE, 0x65FC, 0x1D06, 0x005D, 0xA7A6, 0xC7A6, 0x26CF, 0x26CF,
+  0x85CD, 0x0000, 0x0000, 0x0000, 0x65F4, 0x85FD, 0x65FC, 0x0000,
+  0x64CA, 0x65F3, 0x65F3, 0x85F2, 0x85EA, 0xC5E9, 0xC5E9, 0x26E1,
+  0x06E1, 0xE7E8, 0xE7E0, 0xA8E0, 0xAAE0, 0xACE8, 0xAEE0, 0xACE0,
+  0xAEE0, 0xAEE8, 0xB0E0, 0xB0E0, 0xB0E0, 0xB0E0, 0xB0E8, 0x4218,
+  0x0000, 0xD1A8, 0xF190, 0x8B60, 0xD190, 0x0000, 0x0000, 0x5149,
+  0x1169, 0x0000, 0x0000, 0x0000, 0x1161, 0x3149, 0x0000, 0x0000,
+  0x1161, 0x1169, 0x0000, 0x1161, 0xF178, 0x0000, 0x3149, 0xF188,
+  0xD190, 0xD190, 0xD1A8, 0xB1B0, 0xB1C8, 0xB1C8, 0xB0E0, 0xB0E0,
+  0xB0E0, 0xB0E0, 0xB0E0, 0xAEE0, 0xAEE0, 0xACE8, 0xACE0, 0xAAE0,
+  0xAAE0, 0xC8E8, 0xE7E0, 0xE7E0, 0x06E1, 0xC6C0, 0x27D1, 0xC5E9,
+  0x65F2, 0x4218, 0x0000, 0x0000, 0x0000, 0x85FC, 0x65FD, 0x65F6,
+  0x85FE, 0x1E05, 0x0019, 0x2232, 0x6786, 0xC7AE, 0xC7A6, 0x26D7,
+  0x26CF, 0x65FD, 0x0000, 0x0000, 0x65FC, 0x85F6, 0x65C1, 0x0000,
+  0x0000, 0x0000, 0xA6E1, 0x85F2, 0xC5E9, 0xA6E1, 0x08E1, 0x08E1,
+  0xA8E0, 0x8AC8, 0xE490, 0x4218, 0x1E24, 0x0040, 0x8B60, 0xB0E8,
+  0xB0E0, 0xB0E0, 0xB1C8, 0xB1C8, 0xD190, 0xD1B0, 0x0000, 0x0000,
+  0xF178, 0x3149, 0x0000, 0x0000, 0x3149, 0x0B19, 0x0000, 0x0B21,
+  0x5149, 0x0000, 0x0000, 0x0B19, 0x3151, 0x5149, 0x0000, 0x3149,
+  0x1169, 0x8B60, 0x1161, 0xF178, 0xF178, 0xD190, 0xD190, 0xF178,
+  0x4218, 0x0000, 0x0000, 0x0000, 0x4218, 0x8BA0, 0x6BA0, 0xB1C8,
+  0xB1C8, 0xAEE8, 0xACE0, 0xACE8, 0xAAE0, 0xAAE0, 0xC8E0, 0xA8E8,
+  0x0000, 0x0000, 0x0000, 0xA6E1, 0xC5E9, 0xE490, 0x0000, 0x0000,
+  0x85F2, 0x85F4, 0x65FC, 0x85FD, 0x65F6, 0x4218, 0x1F06, 0x0011,
+  0xA7A6, 0xC7A6, 0x26D7, 0x26CF, 0x25F7, 0x25F7, 0x25F7, 0x65FD,
+  0x85FE, 0x65F5, 0x85FD, 0x65FC, 0x85F4, 0x65FB, 0x65F3, 0x85F2,
+  0xC5E9, 0x1F27, 0x001D, 0xB1B0, 0xB1C8, 0xD1B0, 0xD1B0, 0xD190,
+  0x4218, 0x0000, 0xF178, 0x1169, 0x0000, 0x0000, 0x3149, 0x9131,
+  0x0000, 0x9131, 0x5149, 0x0000, 0x0000, 0x9131, 0x3149, 0x0B19,
+  0x0000, 0x0B21, 0x1161, 0x1161, 0x1161, 0x1169, 0xF178, 0x0B19,
+  0x1F4B, 0x0001, 0x0000, 0x1F52, 0x0011, 0x8AC8, 0xAAE0, 0xAAE8,
+  0xA8E0, 0x08E1, 0x08E1, 0x65E1, 0x45E1, 0x85F2, 0xA6E1, 0x65F2,
+  0x65F3, 0x85F4, 0x65FC, 0x85FD, 0x65FD, 0x65FE, 0x2006, 0x0012,
+  0x65CD, 0x46D7, 0x26CF, 0x25F7, 0x26CF, 0x25FF, 0x65FE, 0x65FE,
+  0x65F5, 0x65FD, 0x85FC, 0x65F4, 0x65F3, 0x65F3, 0x85F2, 0x65F2,
+  0x45E1, 0x08E1, 0x2028, 0x001A, 0x0000, 0xD1A8, 0xD188, 0xD190,
+  0xF178, 0x0000, 0x0B19, 0x1169, 0x0B19, 0x0000, 0x4220, 0x9131,
+  0x9129, 0x9131, 0x4218, 0x0000, 0x0B21, 0x9131, 0x9131, 0x0000,
+  0x4218, 0x3149, 0x9131, 0x5149, 0x3151, 0x0B19, 0x2052, 0x0011,
+  0xAAE8, 0xAAE8, 0xC8E8, 0xC8E0, 0xA8E0, 0xE7E0, 0x06E9, 0x65E1,
+  0x65E1, 0x85F2, 0x65EA, 0x65F3, 0x65FB, 0x85F4, 0x65FC, 0x85FD,
+  0x64CC, 0x2106, 0x0013, 0x65CD, 0xC7A6, 0x25F7, 0x25F7, 0x25FF,
+  0x25F7, 0x25F7, 0x65F6, 0x65FE, 0x85FD, 0x65FC, 0x65F3, 0x65F3,
+  0x85EA, 0x85F2, 0xA6E1, 0xC5E9, 0x65E9, 0x6BA0, 0x212A, 0x0016,
+  0xF178, 0xD178, 0xF178, 0x1161, 0x0000, 0x3149, 0x3149, 0x0000,
+  0x9131, 0x9131, 0x9131, 0x9129, 0x1222, 0x0000, 0x1222, 0x9131,
+  0x1222, 0x0000, 0x9131, 0x9131, 0x3149, 0x9129, 0x2151, 0x0012,
+  0x8EC8, 0xACE0, 0xAAE0, 0xACE8, 0xC8E0, 0xE7E0, 0xE7E0, 0x06E1,
+  0x45E1, 0xC5E9, 0xC5E9, 0x85F2, 0x65EA, 0x65F3, 0x85FC, 0x65FD,
+  0x85F5, 0x84CB, 0x2206, 0x0013, 0x6458, 0x46D7, 0x26CF, 0x25F7,
+  0x25FF, 0x25F7, 0x65FE, 0x65FE, 0x65FD, 0x85F5, 0x64CA, 0x0000,
+  0x65C1, 0x65FB, 0xC5E9, 0xC5E9, 0x45E1, 0x65E1, 0xE7E0, 0x222B,
+  0x0014, 0x1161, 0x1161, 0x1161, 0x3149, 0x0B19, 0x9131, 0x4220,
+  0x9131, 0x1222, 0x9129, 0x1222, 0xF221, 0x4220, 0x1222, 0x1222,
+  0x0000, 0xF221, 0x9131, 0x9129, 0xEE09, 0x2250, 0x0012, 0x8B60,
+  0xAEE8, 0xACE0, 0xACE8, 0xAAE0, 0xAAE0, 0xC8E0, 0x8B98, 0x8458,
+  0x45E9, 0x65E1, 0xC5E9, 0xC5E9, 0x85F2, 0x65F3, 0x65F4, 0x85FC,
+  0x65FD, 0x2307, 0x0014, 0x66D6, 0x25F7, 0x25F7, 0x25F7, 0x25F7,
+  0x25F7, 0x65FE, 0x85FE, 0x65FD, 0x85F4, 0x65F2, 0x65F3, 0x85EA,
+  0x85F2, 0xC5E9, 0xA6E9, 0x08E1, 0x08E1, 0xC8E8, 0x4218, 0x232C,
+  0x0012, 0x1169, 0x3149, 0x3149, 0x9131, 0x1222, 0x9131, 0x4232,
+  0xF221, 0x531A, 0x1222, 0x423A, 0x531A, 0xB412, 0x0B21, 0xB412,
+  0xF221, 0x531A, 0x1222, 0x234F, 0x0013, 0x8B60, 0xB0E0, 0xAEC8,
+  0xAEE0, 0xACE0, 0xACE0, 0xC8E8, 0x08E1, 0xAAE0, 0x27D1, 0x06E1,
+  0xA6E1, 0xC5E9, 0x65F2, 0x85EA, 0x65FB, 0x65F3, 0x65F4, 0x85FC,
+  0x2407, 0x0015, 0x65CD, 0x46CF, 0x25FF, 0x25F7, 0x25F7, 0x65FD,
+  0x84CB, 0x65FD, 0x85FD, 0x65F4, 0x65F3, 0x85F2, 0x65F2, 0xC5E9,
+  0xC5E1, 0x45E1, 0x08E1, 0xC8E0, 0xE7E8, 0xA8E0, 0x8AC8, 0x242A,
+  0x0015, 0x0B19, 0x1161, 0x5149, 0x3149, 0x9131, 0x9131, 0x9131,
+  0x1222, 0x4218, 0x531A, 0x531A, 0xB412, 0x4220, 0xB412, 0xB41A,
+  0xB412, 0x531A, 0xB41A, 0x531A, 0x531A, 0x1222, 0x244E, 0x0014,
+  0x6BA0, 0xB0E0, 0xAEE0, 0xD1A8, 0x8ED0, 0xACE0, 0xAAE8, 0xAAE0,
+  0xC8E0, 0xA8E0, 0xE7E8, 0x06E1, 0x65E1, 0xA6E1, 0x27D1, 0x85F2,
+  0x85F2, 0x65F3, 0x85FC, 0x64CA, 0x2508, 0x0016, 0x25F7, 0x25F7,
+  0x25F7, 0x85FE, 0x84CC, 0xA39A, 0x65F3, 0x65FC, 0x85FC, 0x65F3,
+  0x65F3, 0x65EA, 0x85F2, 0x65E1, 0x65E9, 0x06E1, 0x08E1, 0xA8E8,
+  0x4218, 0xAAE8, 0xACE8, 0x8B60, 0x2526, 0x001B, 0x4218, 0xF178,
+  0xD190, 0xF178, 0x1161, 0x3151, 0x3149, 0x9131, 0x0B19, 0x9131,
+  0x1222, 0x1222, 0xB41A, 0x531A, 0xB412, 0xB41A, 0x560B, 0xB41A,
+  0x5613, 0x560B, 0x0B21, 0xB412, 0xB412, 0x531A, 0x531A, 0xF221,
+  0x1222, 0x254D, 0x0014, 0xD1A8, 0xB0E0, 0xB1A8, 0xB0E0, 0xAEE8,
+  0xAEE0, 0xACE0, 0xACE0, 0xAAE8, 0xAAE0, 0xC8E0, 0x08E1, 0x06E1,
+  0x65E9, 0x06E9, 0xE490, 0xA6E1, 0x65F3, 0x65F3, 0x65F4, 0x2608,
+  0x0059, 0x64CC, 0x25F7, 0x25FF, 0x25F7, 0x65FD, 0x64CA, 0x0000,
+  0x64CA, 0x65F3, 0x65F3, 0x85F2, 0x65F2, 0xC5E9, 0x45E1, 0x4218,
+  0x06E1, 0xC8E8, 0xAAE0, 0x0000, 0x8450, 0xAAE8, 0xACE0, 0xAEE8,
+  0xB0E0, 0xAEE0, 0xB0E0, 0xB1C8, 0xD1A8, 0xB1B0, 0xD1A8, 0xB1B0,
+  0xD188, 0xF178, 0x1161, 0x0000, 0x3149, 0x9131, 0x9131, 0x9131,
+  0x1222, 0x1222, 0x531A, 0xB412, 0xB412, 0xB41A, 0x560B, 0x5613,
+  0x5613, 0x5613, 0x560B, 0x5613, 0x5613, 0xB412, 0xB41A, 0x0B21,
+  0xEE09, 0x1222, 0x1222, 0x9131, 0x9131, 0x9129, 0x3149, 0x0B21,
+  0x0B19, 0x0B21, 0xD178, 0xF178, 0xB1B0, 0xD1B0, 0xB1C8, 0x0000,
+  0x0000, 0xAEE8, 0xAEE0, 0xAEE0, 0x6B98, 0xAAE8, 0xAAE0, 0xC8E8,
+  0xA8E0, 0xC8E0, 0x06E1, 0x0000, 0x8B98, 0x65C9, 0xC5E9, 0x85F2,
+  0x65F3, 0xA6E1, 0x2709, 0x0057, 0x65FE, 0x25F7, 0x65FE, 0x65FE,
+  0x85FD, 0x84CB, 0x65F4, 0x85FC, 0x65F3, 0xA39A, 0x85F2, 0xC5E9,
+  0x8458, 0x0000, 0xC6C0, 0xE7E0, 0xC8E0, 0x08E1, 0xAAE0, 0xACE8,
+  0xACE0, 0xAEE0, 0xAEE8, 0xB0E0, 0xB0E0, 0xB0E0, 0xB1B0, 0xF178,
+  0xD1B0, 0xD190, 0x0000, 0x0000, 0x0000, 0x4218, 0x3151, 0x3149,
+  0x9131, 0x1222, 0x1222, 0xEE09, 0x0000, 0x5613, 0x560B, 0x5613,
+  0x5613, 0xF80B, 0xD80B, 0x0000, 0xF80B, 0xD80B, 0x5613, 0x560B,
+  0xB41A, 0x3303, 0x0000, 0x0000, 0x0000, 0x1222, 0x9131, 0x5149,
+  0x9131, 0x1161, 0x1161, 0xD190, 0xD188, 0xD1B0, 0xB1A8, 0xB1D0,
+  0xB1C8, 0xB0E0, 0xD1A8, 0xB0E0, 0xAEE8, 0x8B58, 0x0000, 0x8B98,
+  0xAAE8, 0xAAE0, 0x8AC8, 0xE7E0, 0xE7E8, 0xA6E1, 0xC490, 0xC5E9,
+  0x85EA, 0x65F3, 0x85F2, 0x280A, 0x0055, 0x84CB, 0x65F6, 0x65FE,
+  0x65FD, 0x85F4, 0x65FC, 0x65F3, 0xC490, 0x85F2, 0x85F2, 0xE8E0,
+  0x0000, 0x0000, 0x8450, 0xC8E8, 0xA8E0, 0xC8E0, 0xAAE0, 0x8458,
+  0x0000, 0xAEE8, 0xAEE0, 0x8EC8, 0xB0E0, 0xB1C8, 0xB1C8, 0x8B98,
+  0xB1B0, 0x0000, 0x0000, 0x0000, 0x1161, 0x3149, 0x5149, 0x9131,
+  0x9131, 0x9131, 0x1222, 0x0000, 0x4218, 0xB412, 0x5613, 0x5613,
+  0xD80B, 0xF80B, 0x7904, 0x0000, 0x0000, 0xD80B, 0xF80B, 0x5613,
+  0x5613, 0xB412, 0xB41A, 0x0B21, 0x0000, 0x0000, 0x9131, 0x9129,
+  0x9131, 0x3149, 0x1169, 0xF178, 0x0000, 0xD190, 0xD1A8, 0x0000,
+  0xB1D0, 0xB1C8, 0xB0E0, 0xAEE8, 0xB0E0, 0x0000, 0x0000, 0x0000,
+  0xACE0, 0xA8E0, 0xAAE0, 0x8AC8, 0x26E9, 0x06E1, 0x65E1, 0xC5E9,
+  0x85F2, 0x6B98, 0x290C, 0x0051, 0xA39A, 0x85F4, 0x65FD, 0x65FB,
+  0x65F3, 0x85EA, 0x85F2, 0xC5E9, 0x27D9, 0xC490, 0x8458, 0x8450,
+  0xE7E8, 0xC8E0, 0xACE8, 0x0000, 0x0000, 0x6B98, 0xAEE0, 0xAEC8,
+  0x0000, 0xB0E0, 0xB0E8, 0xB1C8, 0xB1D0, 0x8B60, 0x0000, 0x4218,
+  0xF178, 0x1169, 0x4218, 0x0B21, 0x3149, 0x9131, 0x1222, 0x0000,
+  0x0000, 0xEE09, 0x5613, 0x5613, 0xD80B, 0xD80B, 0x7904, 0x990C,
+  0x0000, 0x0000, 0xEE09, 0xF80B, 0xD80B, 0x5613, 0x0000, 0xB412,
+  0xB41A, 0x1222, 0x0000, 0x0000, 0x5149, 0x3149, 0x1161, 0x1161,
+  0x1161, 0x0000, 0xB1B0, 0xD1A8, 0x0000, 0x0000, 0x4218, 0xB0E0,
+  0xB0E0, 0xAEE8, 0x0000, 0x0000, 0x0000, 0x8EC8, 0xAAE0, 0xC8E0,
+  0x08E1, 0x08E1, 0x06E9, 0x08E1, 0x8B98, 0x2A10, 0x0049, 0xC498,
+  0x85C1, 0xA6E9, 0xA6E1, 0x27D1, 0x65E9, 0x08E1, 0x08E1, 0xC8E0,
+  0xAAE0, 0x8450, 0x8ED0, 0x0000, 0xAEE8, 0xAEE0, 0xB0E0, 0x0000,
+  0xD1A8, 0xB1C8, 0xB1C8, 0xB1B0, 0xD190, 0x4218, 0xF190, 0x3149,
+  0x0000, 0x0000, 0x9131, 0x9129, 0x9131, 0x0000, 0x0000, 0x0000,
+  0x731A, 0x560B, 0xD80B, 0xF80B, 0x790C, 0x7904, 0x790C, 0x0000,
+  0x0000, 0x0000, 0x7904, 0xD80B, 0xF80B, 0xEE09, 0x0000, 0x0B21,
+  0x531A, 0xEE09, 0x4220, 0x9131, 0x5149, 0x3149, 0x1169, 0x0000,
+  0x0000, 0xF190, 0xD1B0, 0x6B98, 0xD1B0, 0x8B58, 0x8ED0, 0xAEE0,
+  0xB0E0, 0xAEC8, 0x8EC8, 0xAED0, 0x8EC8, 0x8AC8, 0xAEC8, 0x8458,
+  0x2B16, 0x001F, 0x4220, 0x4218, 0x0000, 0x4218, 0x08E1, 0x8EC8,
+  0xACE0, 0xACE8, 0xB0E0, 0xB0E0, 0xB0E0, 0x8B98, 0xB0E0, 0xB1D0,
+  0xB1C8, 0xB1A8, 0xD1B0, 0x1169, 0x0000, 0x0000, 0x0000, 0x9131,
+  0x9131, 0x9131, 0x0000, 0x0000, 0x0000, 0xEE09, 0xF80B, 0xD80B,
+  0x7904, 0x2B3C, 0x0014, 0x7904, 0xF80B, 0xD80B, 0x0000, 0x0000,
+  0x0000, 0x731A, 0x9129, 0x9131, 0x9131, 0x1161, 0x3149, 0x3149,
+  0xF178, 0xB1B0, 0xD1A8, 0xD1B0, 0xD190, 0xB1D0, 0x4218, 0x2C18,
+  0x0015, 0x8458, 0xAAE8, 0xC8E8, 0xACE0, 0xACE0, 0xAEE8, 0xAEE0,
+  0xB0E0, 0xB0E0, 0xB0E0, 0xB1C8, 0xB1C8, 0xB1A8, 0xD1B0, 0xD190,
+  0xF178, 0x0000, 0x0000, 0x9129, 0x3149, 0x9131, 0x2C32, 0x0004,
+  0x560B, 0xF80B, 0xD80B, 0x990C, 0x2C3C, 0x0015, 0x3303, 0xD80B,
+  0x5613, 0x0B21, 0x0000, 0xEE09, 0x1222, 0x1222, 0x9131, 0x3149,
+  0x3149, 0x1169, 0x1161, 0xD190, 0xF190, 0xD1B0, 0xB1A8, 0xD1B0,
+  0xB1C8, 0xB0E0, 0x8458, 0x2D17, 0x001E, 0xC8E8, 0x08E1, 0xA8E0,
+  0xAAE0, 0xAAE0, 0xACE8, 0xACE0, 0xAEE8, 0xAEC8, 0xB0E0, 0xB0E0,
+  0xB0E0, 0xB1C8, 0xB1D0, 0xD1B0, 0xD190, 0xD178, 0xF178, 0x5149,
+  0x3149, 0x9131, 0x9131, 0x0000, 0x0000, 0x0000, 0x0000, 0xEE09,
+  0xF80B, 0xD80B, 0x7904, 0x2D3D, 0x0015, 0xF80B, 0xD80B, 0x5613,
+  0x3303, 0x531A, 0x1222, 0x9131, 0x9129, 0x9131, 0x3149, 0x1161,
+  0xF178, 0xF178, 0xD190, 0xB1A8, 0xB1D0, 0xB1C8, 0xB0E0, 0xB0E0,
+  0xB0E0, 0xB1C8, 0x2E15, 0x0017, 0xC6C0, 0x06E1, 0x08E1, 0xC8E0,
+  0xA8E0, 0xC8E8, 0xACE0, 0xACE0, 0xAEE0, 0xB1C8, 0x0000, 0xAEE8,
+  0xB0E0, 0xB1C8, 0xB1C8, 0xB1A8, 0xD1B0, 0xD190, 0xD188, 0x1161,
+  0x1161, 0x5149, 0x3149, 0x2E31, 0x0005, 0x0E0A, 0x5613, 0xD80B,
+  0xF80B, 0x790C, 0x2E3E, 0x0016, 0x5613, 0x5613, 0x531A, 0x531A,
+  0x1222, 0x1222, 0x9131, 0x3149, 0x3149, 0x1169, 0x1161, 0x4218,
+  0x1169, 0xD1B0, 0xB1A8, 0xB1D0, 0xB1C8, 0xB0E0, 0xAEE8, 0xB0E0,
+  0xAEE0, 0x8B98, 0x2F14, 0x0018, 0xA6E1, 0x45E1, 0x65E9, 0xE7E0,
+  0xE7E0, 0xA8E0, 0xAAE8, 0xAAE0, 0xACE8, 0xAEC8, 0x8EC8, 0xAEE0,
+  0xB0E0, 0xD1B0, 0xB0E0, 0xB1D0, 0x4218, 0xD190, 0xD1B0, 0xD178,
+  0xF178, 0x1161, 0x1169, 0x0B19, 0x2F31, 0x0007, 0xB41A, 0x5613,
+  0x560B, 0xD80B, 0xD80B, 0x790C, 0x7904, 0x2F3E, 0x0017, 0x5613,
+  0xB41A, 0xB412, 0x1222, 0x1222, 0x9129, 0x0000, 0x9131, 0x1161,
+  0x3149, 0xF178, 0xF178, 0xD190, 0xD190, 0xB1C8, 0xB1C8, 0xB0E0,
+  0xB0E0, 0xB0E0, 0xAEE0, 0xAEE0, 0xACE0, 0xAEE8, 0x3012, 0x001A,
+  0x8450, 0x85F2, 0xC5E9, 0x65E9, 0x06E1, 0xE7E0, 0xC8E0, 0xA8E8,
+  0xC8E0, 0xACE0, 0xACE0, 0xAEE8, 0xAEE0, 0xB1C8, 0xB0E0, 0xB1A8,
+  0xB1C8, 0xB1D0, 0x0000, 0xD1A8, 0xD190, 0xD190, 0xF178, 0x1161,
+  0x3149, 0x5149, 0x3031, 0x0007, 0xB412, 0xB412, 0x5613, 0x5613,
+  0xF80B, 0xD80B, 0xF80B, 0x303E, 0x0019, 0xB412, 0xB41A, 0x531A,
+  0x1222, 0x9131, 0x9131, 0x0000, 0x3149, 0x3149, 0x3149, 0x1169,
+  0xF178, 0xD190, 0xF190, 0xD1A8, 0xB1C8, 0xB1D0, 0xB0E0, 0xB1C8,
+  0xB0E0, 0xAEE8, 0xACE0, 0xACE0, 0xACE0, 0x8458, 0x3111, 0x0027,
+  0x64CA, 0x65F3, 0xC5E9, 0xC5E9, 0x45E1, 0x65E1, 0xE7E8, 0x08E1,
+  0xA8E0, 0xACE0, 0xAAE0, 0xACE8, 0xACE0, 0xAEE8, 0xB1C8, 0xB0E0,
+  0x8B98, 0xB0E0, 0xB1D0, 0xB1C8, 0xB1A8, 0xD1B0, 0xD190, 0xF178,
+  0x8B60, 0x1169, 0x5149, 0x3149, 0x0000, 0x0000, 0x0000, 0x0000,
+  0xB41A, 0xB412, 0xB41A, 0x560B, 0x5613, 0xD80B, 0xF80B, 0x313D,
+  0x001B, 0x5613, 0xB412, 0x531A, 0x531A, 0x1222, 0x1222, 0x9131,
+  0x3149, 0x3149, 0x1161, 0x1161, 0xF178, 0xD178, 0xD1B0, 0xD190,
+  0xB1C8, 0xB1C8, 0xB1C8, 0xB0E0, 0xAEC8, 0xAEE0, 0xAEE8, 0xACE0,
+  0xACE0, 0xAAE0, 0xAAE8, 0x8AC8, 0x3210, 0x0049, 0x65F3, 0x65F3,
+  0x85F2, 0x85F2, 0xC5E9, 0x45E1, 0x06E1, 0x06E1, 0xC8E0, 0xC8E0,
+  0xC490, 0x8B60, 0xAAE8, 0xAEE0, 0x0000, 0xB0E0, 0xAEE0, 0xB1C8,
+  0xB0E0, 0xB0E0, 0xD1B0, 0xB1A8, 0xD1B0, 0xD188, 0x0000, 0x0000,
+  0x3149, 0x1161, 0x9131, 0x0B19, 0x0000, 0x0000, 0x0000, 0x731A,
+  0x531A, 0xB41A, 0xB412, 0x5613, 0x5613, 0xD80B, 0x0000, 0x0000,
+  0x0000, 0x0000, 0xB412, 0xB41A, 0xB412, 0x0000, 0x0000, 0x1222,
+  0x9131, 0x3149, 0x9131, 0x3149, 0x1169, 0xF178, 0xF178, 0xD190,
+  0xF178, 0x0000, 0xB1B0, 0xB1C8, 0x0000, 0xB1C8, 0xAEE8, 0xAEE0,
+  0xACE8, 0xACE0, 0xAAE0, 0xAAE0, 0xC8E8, 0xA8E0, 0xC8E0, 0x330F,
+  0x004B, 0x85F4, 0x65FC, 0x65F3, 0x65F3, 0x85F2, 0x85EA, 0x45E9,
+  0x65E1, 0x06E1, 0x08E1, 0xC8E0, 0xAAE8, 0xACE0, 0xACE0, 0xACE0,
+  0xB0E0, 0xAEE8, 0xB0E0, 0xB0E0, 0xB0E0, 0xB1C8, 0xB1D0, 0xB1A8,
+  0xD1B0, 0xF190, 0x8B60, 0x0000, 0x0000, 0x3149, 0x3149, 0x9131,
+  0x0000, 0x0000, 0x0000, 0x1222, 0xB41A, 0xB412, 0xB41A, 0xB412,
+  0x5613, 0x5613, 0x0000, 0x0000, 0x0000, 0xB412, 0xB412, 0x531A,
+  0x0000, 0x0000, 0x0000, 0x9131, 0x1222, 0x3149, 0x5149, 0x3149,
+  0xD178, 0xF178, 0xF190, 0xD190, 0xD178, 0xD1A8, 0xB1D0, 0xB1A8,
+  0xD1A8, 0xB0E0, 0xB0E0, 0xAEE0, 0xAEE8, 0xACE0, 0xACE0, 0xAAE0,
+  0xAAE8, 0xA8E0, 0x08E1, 0x08E1, 0x340E, 0x004D, 0x65FC, 0x85FD,
+  0x65F4, 0x65F3, 0x85F2, 0x65EA, 0xC5E9, 0xC5E9, 0x08E1, 0x06E1,
+  0xE7E0, 0xE7E0, 0xC8E8, 0xAAE0, 0xAAE0, 0xACE0, 0xACE8, 0xAEE0,
+  0xAEE0, 0xB0E0, 0xB0E0, 0xB0E0, 0xB1C8, 0xB1C8, 0xB1B0, 0xD1A8,
+  0xD190, 0x0000, 0x0000, 0x0000, 0x3149, 0x5149, 0x4218, 0x0000,
+  0x9131, 0x1222, 0x1222, 0x531A, 0x531A, 0xB412, 0x531A, 0xB41A,
+  0xB412, 0x0000, 0x0000, 0xB41A, 0x531A, 0xEE09, 0x0000, 0x0000,
+  0x9131, 0x9131, 0x9131, 0x3149, 0x3149, 0x1169, 0x1161, 0xF178,
+  0xD190, 0xD1B0, 0xD1A8, 0xB1C8, 0xB1D0, 0xB0E0, 0xB0E0, 0xB0E0,
+  0xAEE0, 0xAEE8, 0xACE0, 0xACE0, 0xAAE0, 0xAAE8, 0xA8E0, 0xC8E0,
+  0xE7E0, 0x06E9, 0x08E1, 0x350D, 0x004F, 0x65FD, 0x85F5, 0x65FC,
+  0x85FC, 0x65F3, 0x65F3, 0x85EA, 0x85F2, 0x27D1, 0x0000, 0x08E1,
+  0x06E9, 0xE7E0, 0xA8E0, 0xC8E0, 0xACE8, 0xACE0, 0xAEE0, 0xAEE8,
+  0xB0E0, 0xB0E0, 0xB0E0, 0xB1C8, 0x0000, 0xF190, 0xB1C8, 0xD190,
+  0xB1B0, 0xF178, 0x0000, 0x0000, 0x5151, 0x3149, 0x3149, 0x0B21,
+  0x1222, 0x0000, 0xF221, 0x1222, 0x531A, 0x1222, 0xB412, 0x0000,
+  0xB41A, 0x0000, 0xEE09, 0x1222, 0x531A, 0x0000, 0x0000, 0x0B19,
+  0x9131, 0x9131, 0x5149, 0x3149, 0x0000, 0x3149, 0xF178, 0xD190,
+  0xD1A8, 0xB1B0, 0xB1C8, 0xB1C8, 0xB1C8, 0xB0E0, 0xB0E0, 0xAEE0,
+  0xB0E0, 0xAEE8, 0xAEC8, 0x4218, 0xACE8, 0xAAE0, 0xA8E0, 0xC8E0,
+  0x26E9, 0x06E1, 0x45E1, 0x65E1, 0x360C, 0x0051, 0x84CB, 0x85FE,
+  0x65FD, 0x65F5, 0x85FC, 0x65F4, 0x65F3, 0x65FB, 0xC5E9, 0xA6E1,
+  0x0000, 0x0000, 0xE7E0, 0xAAE0, 0x0000, 0x0000, 0x8AC8, 0xACE0,
+  0xACE8, 0xAEE0, 0xAEE0, 0xB0E0, 0xB0E0, 0x8B98, 0x0000, 0x0000,
+  0xD1B0, 0xD178, 0x0000, 0xD188, 0xF178, 0x0000, 0x4218, 0x1169,
+  0x3149, 0x5149, 0x0B21, 0x0000, 0x9131, 0x1222, 0x9129, 0x1222,
+  0xF221, 0x0000, 0x1222, 0x9131, 0x1222, 0xF221, 0x0B19, 0x0000,
+  0x0B21, 0x9131, 0x0B19, 0x0000, 0x3151, 0x4218, 0x0000, 0x0000,
+  0xF178, 0xD190, 0xF190, 0xD1B0, 0xB1B0, 0xB1C8, 0x8B98, 0x0000,
+  0x8458, 0xAEE8, 0xAEE8, 0x8450, 0x0000, 0x8EC8, 0xAAE8, 0xAAE0,
+  0xC8E8, 0xE7E0, 0xE7E0, 0x45E1, 0x65E9, 0xC5E9, 0x65C1, 0x370C,
+  0x0051, 0x25F7, 0x65FE, 0x85F6, 0x65FD, 0x85FD, 0x65F4, 0x85FC,
+  0x65EA, 0x85F2, 0xC5E9, 0x85C9, 0x8B58, 0x06E1, 0xAAE8, 0x0000,
+  0x0000, 0xAEC8, 0xAAE0, 0xACE0, 0xACE0, 0xAEE8, 0xAEE0, 0xB0E8,
+  0x4218, 0x0000, 0x0000, 0xD178, 0xD1B0, 0x0000, 0x0000, 0xD190,
+  0xF178, 0x0000, 0x1161, 0x1169, 0x5149, 0x0000, 0x0000, 0x3149,
+  0x9131, 0x9129, 0x9131, 0xF221, 0x0000, 0x0B21, 0x9129, 0x1222,
+  0x9131, 0x4220, 0x0E0A, 0x3149, 0x0B21, 0x0000, 0x5149, 0x3149,
+  0x0000, 0x0000, 0x0000, 0xD188, 0xD1B0, 0xB1A8, 0xD1B0, 0xB1C8,
+  0xB1C8, 0xB0E0, 0x0000, 0x0000, 0x8EC8, 0xAEE8, 0x8B98, 0x0000,
+  0xACE0, 0xAAE0, 0xC8E8, 0x08E1, 0xE7E0, 0x06E1, 0x45E1, 0xC5E9,
+  0xC5E9, 0x85EA, 0x380C, 0x0052, 0x65FE, 0x65FE, 0x65FD, 0x85FD,
+  0x65F4, 0x85FC, 0x65F3, 0x65F3, 0x65F2, 0x85EA, 0x45E1, 0x27D1,
+  0x06E9, 0x08E1, 0x0000, 0x0000, 0xAAE0, 0xAAE0, 0xAAE0, 0xACE8,
+  0xAEC8, 0x4218, 0xAEE8, 0x8B58, 0x0000, 0x0000, 0x0000, 0xB1C8,
+  0xD190, 0x0000, 0x0000, 0xD190, 0xF178, 0xF178, 0x1161, 0x3149,
+  0x0000, 0x0000, 0x9131, 0x3149, 0x9131, 0x9129, 0x9131, 0x0000,
+  0x0000, 0x9131, 0x9131, 0x9129, 0x9131, 0x5149, 0x0B21, 0x0000,
+  0x0000, 0x1161, 0x4218, 0x0000, 0x0000, 0x0000, 0xD190, 0xF190,
+  0x4220, 0xB1D0, 0xB1C8, 0xB0E0, 0xB0E0, 0xD1A8, 0x0000, 0xAEE8,
+  0xACE0, 0x8EC8, 0xAEC8, 0xAAE8, 0xA8E0, 0xC8E8, 0xA8E0, 0xE7E0,
+  0x06E1, 0x65E9, 0x65E1, 0x85F2, 0x65EA, 0xC490, 0x390C, 0x0052,
+  0x25F7, 0x65FE, 0x85FE, 0x65FD, 0x85F5, 0x65FC, 0x85FC, 0x65F3,
+  0x84CA, 0xA6E1, 0xC5E9, 0x65E1, 0x08E1, 0x06E9, 0x8458, 0x6B98,
+  0xAAE0, 0xAAE0, 0xACE8, 0xACE0, 0xAEE0, 0xAEE8, 0xB0E0, 0xB1C8,
+  0xD1B0, 0xB1C8, 0xB1A8, 0xB1D0, 0xB1C8, 0x8B60, 0x0000, 0x0000,
+  0xF178, 0xD178, 0xF178, 0x8B60, 0x0000, 0x0000, 0x5151, 0x3149,
+  0x5149, 0x3149, 0x5149, 0x0000, 0x0000, 0x9131, 0x3151, 0x5149,
+  0x3149, 0x0000, 0x0000, 0x0000, 0x1161, 0x1161, 0x8B60, 0x8B58,
+  0x8B60, 0x8B60, 0xB1A8, 0xD1B0, 0xB1C8, 0xB1C8, 0xB0E0, 0xB0E0,
+  0xB0E0, 0xB0E0, 0x6B98, 0xAEE0, 0xAEE8, 0xAEC8, 0xACE0, 0xAAE0,
+  0xACE8, 0xC8E0, 0xE7E0, 0x06E1, 0x45E1, 0x65E1, 0xC5E9, 0xC5E9,
+  0x65FB, 0x8458, 0x3A0C, 0x0052, 0x85FE, 0x25F7, 0x65FE, 0x65FE,
+  0x65FC, 0x65F4, 0x65F3, 0x65F3, 0x8458, 0x0000, 0xC5E9, 0xC5E9,
+  0x45E1, 0x06E1, 0xE7E8, 0x08E1, 0xC8E0, 0xAAE0, 0x8AC8, 0x0000,
+  0xACE0, 0xAEE8, 0xAEC8, 0xAEC8, 0x6B98, 0xAEC8, 0xB1B0, 0xB1C8,
+  0xB1C8, 0xB1D0, 0xD1A8, 0x8B60, 0x0000, 0xD190, 0xF178, 0x4218,
+  0x0000, 0x0000, 0x1161, 0x1161, 0x3149, 0x3149, 0x5151, 0x0000,
+  0x0000, 0x0000, 0x3149, 0x1169, 0x0B19, 0x0000, 0x5149, 0x1169,
+  0x1161, 0xF178, 0xD178, 0xD190, 0xF178, 0xD190, 0xD1B0, 0xB1C8,
+  0xB1C8, 0x4218, 0x0000, 0xB0E8, 0xAEE8, 0xB0E0, 0xAEE0, 0xAEE0,
+  0xACE0, 0xACE8, 0xAAE0, 0x8B98, 0x0000, 0xAAE8, 0xE7E0, 0x06E1,
+  0x65E1, 0xC5E9, 0xC5E9, 0x85F2, 0x65EA, 0x4218, 0x3B0C, 0x0015,
+  0x25F7, 0x65FE, 0x25F7, 0x85F6, 0x65FD, 0x85FC, 0x85F4, 0x65C1,
+  0x64CA, 0x85F2, 0x85EA, 0xC5E9, 0xC5E9, 0x06E1, 0x06E9, 0xE7E0,
+  0xE7E0, 0xC8E0, 0x8AC8, 0xACE8, 0xACE0, 0x3B27, 0x001B, 0xD1B0,
+  0xB0E0, 0xB1A8, 0xB1D0, 0xD1A8, 0xD1B0, 0xD190, 0xD190, 0x0000,
+  0x0000, 0x0000, 0xF178, 0x1161, 0x1161, 0x1161, 0x1169, 0x0000,
+  0x0000, 0x0000, 0x1161, 0x1161, 0x1161, 0x1169, 0xF178, 0x3149,
+  0xD178, 0xF178, 0x3B47, 0x0016, 0x8B58, 0xB1D0, 0x8B98, 0x4218,
+  0xB0E0, 0xB0E0, 0xAEE0, 0xAEE8, 0xACE0, 0xACE0, 0xAAE0, 0x08E1,
+  0xAAE8, 0x8AC8, 0xE490, 0x06E1, 0x45E1, 0xC5E9, 0xC5E9, 0x65EA,
+  0x85F2, 0x65FB, 0x3C0C, 0x0014, 0x65FE, 0x25F7, 0x65FE, 0x65FE,
+  0x65FD, 0x65FD, 0x85F4, 0x65F3, 0x65F2, 0x65F3, 0xC5E9, 0xC5E9,
+  0x45E1, 0x65E1, 0x06E1, 0x08E1, 0xC8E0, 0xAAE8, 0xA8E0, 0xAEC8,
+  0x3C27, 0x001B, 0xB0E0, 0xB1C8, 0x0000, 0x0000, 0x8458, 0xB1A8,
+  0xD1B0, 0xD178, 0x0000, 0x0000, 0x0000, 0xF178, 0xD178, 0xF178,
+  0xD178, 0x1161, 0x0000, 0x0000, 0x0000, 0x3149, 0xF178, 0x1161,
+  0x0B19, 0x0000, 0x0000, 0xF178, 0xD190, 0x3C49, 0x0014, 0x8BA0,
+  0xAEE8, 0xB0E0, 0xB1C8, 0xAEE8, 0xACE0, 0xACE0, 0xAAE0, 0xAAE8,
+  0xA8E0, 0xC8E0, 0xA8E0, 0x27D1, 0x06E9, 0x65E1, 0x65E1, 0xC5E9,
+  0xC5E9, 0x85F2, 0x65EA, 0x3D0C, 0x0015, 0x25F7, 0x25F7, 0x25F7,
+  0x65FE, 0x65FE, 0x85FD, 0x65F5, 0x85FC, 0x65FC, 0x65F3, 0x85EA,
+  0x27D1, 0xC5E9, 0x65E9, 0x65E1, 0x06E1, 0x08E1, 0xAAE0, 0xC8E8,
+  0xAAE8, 0x8AC8, 0x3D27, 0x001C, 0xB0E0, 0xB0E0, 0x0000, 0x0000,
+  0x0000, 0x0000, 0xD190, 0xF178, 0x0000, 0x0000, 0x0000, 0xF190,
+  0xD190, 0xF188, 0xD190, 0xD178, 0x0000, 0x0000, 0x0000, 0x1161,
+  0xF178, 0x0000, 0x0000, 0x0000, 0x0000, 0xB1B0, 0xD1B0, 0x4218,
+  0x3D48, 0x0015, 0xB0E0, 0xB0E0, 0xB0E0, 0xAEE8, 0x8EC8, 0xACE0,
+  0xACE0, 0xAAE8, 0xACE0, 0xAAE0, 0xAAE0, 0xC8E8, 0x08E1, 0x06E1,
+  0x65E1, 0x45E1, 0xC5E9, 0xC5E9, 0x65EA, 0x85F2, 0x65F3, 0x3E0C,
+  0x0051, 0x65CD, 0x25F7, 0x85FE, 0x65FE, 0x65FD, 0x65FD, 0x85F4,
+  0x65FC, 0x65F3, 0x65F3, 0x85F2, 0x0000, 0x27D1, 0xC5E9, 0x45E1,
+  0x06E1, 0xE7E0, 0x08E1, 0x0000, 0xAAE8, 0xAAE0, 0xAAE0, 0xACE0,
+  0xAEE8, 0xACE0, 0xAEE0, 0xAEE0, 0xB0E0, 0xD1A8, 0x0000, 0x0000,
+  0x0000, 0x6BA0, 0xB1C8, 0x0000, 0x0000, 0x0000, 0x0000, 0xD190,
+  0xD1A8, 0xD190, 0xF190, 0xF178, 0x0000, 0x0000, 0x0000, 0x0000,
+  0xD188, 0x8B60, 0x0000, 0x0000, 0x0000, 0xD190, 0xB1C8, 0xD1B0,
+  0xB1C8, 0xB1C8, 0xB0E0, 0xB1C8, 0xB0E8, 0xAEE0, 0xB0E0, 0x0000,
+  0xAEC8, 0xACE8, 0xACE0, 0xACE0, 0xACE0, 0xAAE8, 0x0000, 0x8AC8,
+  0xE7E0, 0xE7E0, 0x06E1, 0x65E9, 0xC5E9, 0xC5E9, 0x85EA, 0x85EA,
+  0x65F3, 0x65C1, 0x3F0C, 0x0011, 0x65CD, 0x25F7, 0x25F7, 0x65FE,
+  0x85FE, 0x65FD, 0x85F5, 0x65FC, 0x85FC, 0x65F3, 0x65F3, 0x65EA,
+  0x85F2, 0xC5E9, 0xC5E9, 0x65E1, 0x06E9, 0x3F22, 0x000C, 0xACE8,
+  0x8EC8, 0xAEE0, 0xAEE0, 0xAEE8, 0xAEE0, 0xB1D0, 0x0000, 0x0000,
+  0x8B58, 0xB0E0, 0xB1D0, 0x3F33, 0x0003, 0xD1A8, 0xB1B0, 0xD1A8,
+  0x3F3B, 0x000C, 0xD190, 0xD1B0, 0x4218, 0x0000, 0x0000, 0xB1B0,
+  0xD1A8, 0xB0E0, 0xB1C8, 0xB0E0, 0xB1B0, 0xD1B0, 0x3F4C, 0x0011,
+  0xAEE0, 0xACE0, 0xACE0, 0xAAE8, 0xAAE0, 0xC8E0, 0x08E1, 0xE7E0,
+  0x06E1, 0x45E1, 0xC5E9, 0xC5E9, 0x65F2, 0x85EA, 0x65FB, 0x65FB,
+  0xA362, 0x400C, 0x0011, 0xA39A, 0x25F7, 0x25FF, 0x25F7, 0x85FE,
+  0x65FE, 0x65FD, 0x65F5, 0x85FC, 0x65F4, 0x65F3, 0x65FB, 0x85EA,
+  0x65F2, 0x45E1, 0x65E1, 0xA8E0, 0x4025, 0x0008, 0xAEC8, 0x8EC8,
+  0xAEE8, 0xAEC8, 0x0000, 0x6B98, 0xB0E8, 0xB0E0, 0x4034, 0x0002,
+  0xD190, 0x8B60, 0x403B, 0x0008, 0x8B98, 0xB1B0, 0xB1C8, 0x4218,
+  0x0000, 0xB1D0, 0xB1D0, 0xB1C8, 0x404C, 0x0011, 0x6BA0, 0xACE0,
+  0xAAE8, 0xAAE0, 0xC8E0, 0xE7E0, 0xE7E8, 0x06E1, 0x06E1, 0x65E1,
+  0x65E9, 0xC5E9, 0x85EA, 0x65F3, 0x65F3, 0x65FC, 0x8450, 0x410C,
+  0x0010, 0x2232, 0x25F7, 0x25F7, 0x25F7, 0x25F7, 0x65FE, 0x85FE,
+  0x65F4, 0x85FC, 0x65F4, 0x85FC, 0x65F2, 0x65F3, 0x85F2, 0xC5E9,
+  0x65E9, 0x4124, 0x0009, 0x8EC8, 0xAEC8, 0x6B98, 0xACE0, 0xAEE8,
+  0xAEC8, 0xB0E0, 0xAEE0, 0xB0E8, 0x413C, 0x0007, 0xB1C8, 0xB1C8,
+  0xB0E0, 0xB1A8, 0xB0E0, 0xB0E0, 0xB1C8, 0x414D, 0x0010, 0xAAE8,
+  0xAAE0, 0xC8E0, 0x08E1, 0xE7E0, 0x26E9, 0x06E1, 0x45E1, 0xA6E1,
+  0xC5E9, 0x85F2, 0x65F3, 0x65F3, 0x65FC, 0x85FC, 0x8458, 0x420D,
+  0x0020, 0x25FF, 0x25F7, 0x25F7, 0x65FE, 0x65FE, 0x84CB, 0x0000,
+  0x0000, 0x65FC, 0x85EA, 0x0000, 0x0000, 0x27D1, 0xC5E9, 0xC5E9,
+  0xE8E0, 0x65E1, 0x08E1, 0x08E1, 0x6B98, 0x8B60, 0x0000, 0x0000,
+  0x8AC8, 0xACE8, 0xACE0, 0xACE0, 0xACE0, 0xAEE8, 0xAEE0, 0xAEE0,
+  0xAEC8, 0x423C, 0x0007, 0x8B98, 0xB1D0, 0xB0E0, 0xB0E0, 0xB0E0,
+  0xB0E0, 0xB1C8, 0x4248, 0x0014, 0x4218, 0x6BA0, 0xAED0, 0xACE8,
+  0x8EC8, 0xAAE0, 0xC8E0, 0xAAE8, 0x8450, 0x0000, 0xC490, 0x65E9,
+  0xC490, 0x0000, 0x27D9, 0x85F2, 0x85EA, 0x65F3, 0x65FB, 0x65F4,
+  0x430D, 0x0020, 0x86D6, 0x25F7, 0x25F7, 0x25F7, 0x65FE, 0x0000,
+  0x0000, 0x0000, 0x85FC, 0x85FC, 0x6450, 0x85EA, 0x65F2, 0x85EA,
+  0xC5E9, 0xC5E9, 0x65E1, 0x65E9, 0x06E1, 0x06E1, 0xE7E0, 0x08E1,
+  0xC8E8, 0xAAE0, 0xAAE0, 0x08E1, 0xACE0, 0xACE8, 0xACE0, 0xAEE0,
+  0xAEE8, 0xB1C8, 0x433C, 0x0020, 0xB1B0, 0x8B58, 0xB0E0, 0xB0E0,
+  0xB0E0, 0xB0E0, 0xB0E0, 0xAEE0, 0xB0E0, 0xAEE0, 0xAEE8, 0xACE0,
+  0xACE0, 0xACE0, 0x08E1, 0xAAE8, 0xAAE0, 0xC8E0, 0x08E1, 0xC8E0,
+  0x8AC8, 0x0000, 0x08E1, 0x45E1, 0xC6C0, 0x0000, 0x0000, 0xC5E9,
+  0x65FB, 0x65F3, 0x65F4, 0x85FC, 0x440D, 0x001F, 0x66CE, 0x26CF,
+  0x25FF, 0x25F7, 0x65FD, 0x0000, 0x0000, 0x0000, 0x65F3, 0x85FC,
+  0x65F4, 0x65F3, 0x65FB, 0x85EA, 0x65F2, 0xC5E9, 0xC5E9, 0x45E1,
+  0x65E1, 0x06E1, 0x06E1, 0xC8E0, 0xC8E8, 0xA8E0, 0xAAE0, 0xC8E0,
+  0xAAE8, 0xAAE0, 0xACE0, 0x6B98, 0xAEE8, 0x443C, 0x0020, 0x8BA0,
+  0xB1C8, 0x0000, 0xB0E0, 0xAEE8, 0xAEE0, 0xAEE0, 0xAEE0, 0xACE8,
+  0xAEE0, 0xACE0, 0xACE0, 0xAAE8, 0xAAE0, 0xA8E0, 0xAAE0, 0xC8E8,
+  0xE7E0, 0xA8E0, 0xE7E0, 0x06E9, 0x65E1, 0x65E1, 0xA6E1, 0x0000,
+  0x0000, 0x0000, 0x8458, 0x65FB, 0x85F4, 0x85FC, 0x65F3, 0x450D,
+  0x001F, 0xE59C, 0x25F7, 0x25F7, 0x25FF, 0x84CC, 0x0000, 0x0000,
+  0x0000, 0xC490, 0x85F5, 0x65FC, 0x85FC, 0x65F3, 0x65FB, 0x8B98,
+  0xC490, 0xC5E9, 0xC5E9, 0x65E1, 0x65E1, 0x06E1, 0x06E9, 0xE7E0,
+  0x08E1, 0xC8E0, 0xAAE0, 0xAAE8, 0xACE0, 0x8EC8, 0xACE0, 0xACE8,
+  0x453D, 0x001F, 0xAEE8, 0x8B98, 0x6B98, 0xAEE0, 0xAEE0, 0xAEE8,
+  0xACE0, 0xAEE0, 0xACE0, 0xACE8, 0xAAE0, 0xACE0, 0xAAE0, 0xAAE8,
+  0xC8E0, 0x08E1, 0xAAE0, 0x26E1, 0x06E9, 0x45E1, 0x45E1, 0xC5E9,
+  0x27D1, 0x0000, 0x0000, 0x0000, 0x0000, 0x85F4, 0x65FC, 0x85FD,
+  0xA39A, 0x460E, 0x001E, 0x46D7, 0x25F7, 0x26D7, 0x64CC, 0x0000,
+  0x0000, 0x0000, 0x65FC, 0x85F5, 0x65FD, 0x85FC, 0xA39A, 0x0000,
+  0x0000, 0x27D1, 0x85F2, 0xC5E9, 0xC5E1, 0x45E1, 0x45E1, 0x08E1,
+  0x06E9, 0xE7E0, 0xE7E0, 0xAAE0, 0xC8E8, 0xC8E0, 0x0000, 0xAAE0,
+  0xACE0, 0x463D, 0x001F, 0xAEE8, 0x8EC8, 0x0000, 0xACE0, 0xACE0,
+  0xACE8, 0xACE0, 0xAAE0, 0xACE0, 0xACE8, 0xAAE0, 0xC8E0, 0xA8E0,
+  0xC8E8, 0xE7E0, 0xA8E0, 0x0000, 0x0000, 0xC6C0, 0x65E1, 0xC5E9,
+  0xC5E9, 0x85F2, 0x0000, 0x0000, 0x0000, 0x6450, 0x85FC, 0x85FD,
+  0x65FD, 0x4218, 0x470E, 0x001D, 0x26CF, 0x46CF, 0x25F7, 0x84CB,
+  0x0000, 0x0000, 0x0000, 0x65FD, 0x65FE, 0x85FD, 0x85FC, 0x0000,
+  0x0000, 0x65C1, 0x65F3, 0x65F2, 0x85F2, 0xE490, 0x6B98, 0x65E1,
+  0x65E1, 0x06E9, 0x08E1, 0x0000, 0x27D1, 0xC8E8, 0x08E1, 0x8AC8,
+  0xAAE8, 0x473E, 0x001D, 0xAEE8, 0x8458, 0x8EC8, 0xACE0, 0xACE8,
+  0x4218, 0xACE0, 0xAAE0, 0xAAE8, 0xC8E0, 0xACE0, 0xC6C0, 0x08E1,
+  0xE7E0, 0x06E1, 0xC6C0, 0x0000, 0x0000, 0x27D1, 0xC5E9, 0x65F2,
+  0x85F2, 0x0000, 0x0000, 0x0000, 0x8450, 0x65FD, 0x65FD, 0x85FE,
+  0x480E, 0x001D, 0x65CD, 0x26CF, 0x26D7, 0x64CC, 0x0000, 0x0000,
+  0x0000, 0x85FD, 0x65FD, 0x85F5, 0x65FC, 0x64CA, 0x65C1, 0x85FC,
+  0x65F3, 0x65F3, 0x65C1, 0x0000, 0xA6E1, 0xC5E9, 0x65E1, 0xE490,
+  0x0000, 0xC6C0, 0xE7E8, 0xE7E0, 0xA8E8, 0xC8E0, 0xA8E0, 0x483E,
+  0x001D, 0xACE0, 0xACE8, 0xAAE0, 0xAAE0, 0xAAE0, 0x8B98, 0x0000,
+  0x6BA0, 0xC8E0, 0xA8E8, 0x8AC8, 0x0000, 0xAAC8, 0x06E1, 0x26E1,
+  0x65E1, 0x4218, 0xC498, 0xA6E9, 0x85F2, 0x85EA, 0x65F3, 0x0000,
+  0x0000, 0x0000, 0xA39A, 0x85FC, 0x85FE, 0x65F4, 0x490E, 0x001D,
+  0x65D5, 0xC7A6, 0x85CD, 0x84CC, 0xA39A, 0x0000, 0x0000, 0x2218,
+  0x65FE, 0x85FE, 0x65F5, 0x85FC, 0x65FD, 0x85FC, 0x85FC, 0xC490,
+  0x0000, 0x8450, 0x85F2, 0xC5E9, 0x0000, 0x0000, 0x08E1, 0x45E1,
+  0x65E1, 0x08E1, 0xC6C0, 0xC8E0, 0xC6C0, 0x493E, 0x001D, 0x8AC8,
+  0xAAE8, 0xACE0, 0xAAE0, 0xAAE0, 0xC8E8, 0x8AC8, 0x0000, 0x0000,
+  0xE7E0, 0x06E9, 0x4218, 0x0000, 0x8B98, 0xC5E9, 0xA6E1, 0xC5E9,
+  0xA6E1, 0x64CA, 0x85F2, 0x65F3, 0xA6E1, 0x0000, 0x0000, 0x0000,
+  0x84CB, 0x65FD, 0x85FE, 0x64CC, 0x4A0E, 0x001C, 0xA362, 0x26D7,
+  0x86CE, 0xA362, 0x65D5, 0x0000, 0x0000, 0x0000, 0x64CC, 0x85FE,
+  0x65FD, 0x65FD, 0x85FD, 0x65F4, 0x64CA, 0x85F2, 0x65F3, 0x65F3,
+  0x65F2, 0x85EA, 0x65C1, 0xC5E9, 0xA6E1, 0x65E1, 0xC490, 0x0000,
+  0x08E1, 0x06E9, 0x4A3F, 0x001B, 0xAAE0, 0xC8E8, 0x0000, 0xE490,
+  0xE7E0, 0xA8E8, 0x08E1, 0x0000, 0x06E1, 0x26E1, 0x65E1, 0x08E1,
+  0x0000, 0x8B58, 0xC5E9, 0xC5E9, 0x85F2, 0x65F2, 0x65F3, 0x65F3,
+  0x0000, 0x0000, 0x0000, 0x64CA, 0x84CB, 0x85CD, 0x65FE, 0x4B0F,
+  0x001B, 0xC7A6, 0x26D7, 0xA362, 0xE59C, 0x65F6, 0x65FD, 0x0000,
+  0x65FE, 0x65FE, 0x65F6, 0x65FE, 0x85FE, 0x65FD, 0x85F5, 0x65FC,
+  0x85FC, 0x65F3, 0x0000, 0x85EA, 0x65F3, 0x85F2, 0xA6E1, 0x0000,
+  0x0000, 0x45E9, 0x65E9, 0xC490, 0x4B3F, 0x001B, 0x8450, 0xE7E8,
+  0xC8E0, 0x0000, 0x0000, 0x08E1, 0x06E1, 0x65E1, 0x06E9, 0x8450,
+  0x08E1, 0xC5E9, 0xC5E9, 0x65EA, 0xC5E9, 0x65F3, 0x85F2, 0x65F3,
+  0x65FB, 0x85FC, 0x0000, 0x8450, 0x64CA, 0x65FB, 0x6458, 0x65FE,
+  0x85FE, 0x4C0F, 0x001A, 0x65CD, 0xC7A6, 0xA7A6, 0x0000, 0x64D4,
+  0x86CE, 0x25FF, 0x25F7, 0xA362, 0x0000, 0xA39A, 0x0000, 0x85FC,
+  0x65FD, 0x85FD, 0x84CB, 0x0000, 0x0000, 0x65F2, 0x85EA, 0x6450,
+  0x0000, 0x8458, 0xC5E9, 0xC5E9, 0x27D1, 0x4C40, 0x001A, 0xC6C0,
+  0x08E1, 0xE7E8, 0x4218, 0x0000, 0x8458, 0x08E1, 0x65E9, 0x0000,
+  0x0000, 0x27D1, 0x85F2, 0x65EA, 0x85F2, 0xC490, 0xC490, 0x0000,
+  0x8458, 0x85FC, 0x85FD, 0x84CB, 0x64CA, 0x0000, 0xA39A, 0x85FE,
+  0x65FD, 0x4D0F, 0x0007, 0x64CB, 0xC7A6, 0xC7A6, 0x0000, 0x0000,
+  0xE59C, 0x25F7, 0x4D1B, 0x000E, 0x65FD, 0x65FE, 0x85F5, 0x0000,
+  0x0000, 0x65FC, 0x65FB, 0x0000, 0x0000, 0x4218, 0x85EA, 0x85F2,
+  0xC5E9, 0xC6E1, 0x4D40, 0x001A, 0x08E1, 0x08E1, 0x27D1, 0x06E9,
+  0x8450, 0x0000, 0x0000, 0xA6E1, 0xC5E9, 0x0000, 0x0000, 0x85F2,
+  0x65F3, 0x65FB, 0x0000, 0x0000, 0x0000, 0x0000, 0xA39A, 0x65F5,
+  0x85FC, 0x0000, 0x0000, 0x64CC, 0x25F7, 0x84CB, 0x4E10, 0x0018,
+  0x6786, 0xC7A6, 0x0000, 0x86D6, 0x26D7, 0xA39A, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x65FC, 0x85FE, 0x65F5, 0x64CA, 0x0000, 0x65FD,
+  0x65F3, 0x0000, 0x0000, 0x0000, 0x85F2, 0x65F3, 0x65F2, 0x85EA,
+  0x4E40, 0x0019, 0x4218, 0x45E9, 0x45E1, 0x27D1, 0x65E9, 0x8450,
+  0x0000, 0x0000, 0xA6E9, 0x85F2, 0x0000, 0xC490, 0x65F3, 0x65F3,
+  0x85F2, 0x0000, 0x0000, 0x0000, 0x0000, 0x84CB, 0x85FD, 0x65F4,
+  0x0000, 0x85FE, 0x25F7, 0x4F10, 0x0018, 0x6786, 0x6786, 0xA7A6,
+  0xC7A6, 0x86D6, 0xA36A, 0x0000, 0x0000, 0x0000, 0x2218, 0x25F7,
+  0x65FE, 0x85FE, 0xC490, 0x65F6, 0x85FC, 0x0000, 0x0000, 0x0000,
+  0x65F3, 0x85FC, 0x65F3, 0x65FB, 0xA6E1, 0x4F41, 0x0018, 0x27D1,
+  0x65EA, 0xC5E9, 0x85F2, 0xA6E1, 0x0000, 0x0000, 0x0000, 0x85EA,
+  0x65F3, 0x0000, 0x65FC, 0x85F4, 0x65FD, 0x65C1, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x65FE, 0x65FE, 0x65FE, 0x25F7, 0x65FE, 0x5010,
+  0x0017, 0xA664, 0x6786, 0x6786, 0xE59C, 0xC7AE, 0x26D7, 0x66CE,
+  0x65CD, 0x85FC, 0x25F7, 0x65FE, 0x0000, 0x65FE, 0x65FE, 0x64CC,
+  0x0000, 0x0000, 0x0000, 0x85EA, 0x65FC, 0x85F4, 0x65FC, 0x65F3,
+  0x5042, 0x0017, 0xA6E1, 0x85F2, 0x85EA, 0x65F2, 0xA6E1, 0x0000,
+  0x0000, 0x0000, 0x85F2, 0x85F4, 0x65FC, 0x64CA, 0x84CB, 0x85F5,
+  0x84CB, 0x84CB, 0x84CB, 0x65FE, 0x65FE, 0x6450, 0x85FE, 0x25F7,
+  0xA39A, 0x5111, 0x0016, 0x086E, 0x6786, 0xE59C, 0xC7A6, 0x65CD,
+  0x86CE, 0x84CB, 0x25FF, 0x25F7, 0x0000, 0xA362, 0x25F7, 0x25F7,
+  0x65FE, 0x85FD, 0x65FD, 0x85F5, 0x65FD, 0x85FD, 0x65FD, 0x85F4,
+  0x64CA, 0x5142, 0x0016, 0xA6E1, 0x85F2, 0x65F3, 0x65FB, 0x65F3,
+  0x65EA, 0x65FB, 0x65F3, 0x65F3, 0x85F4, 0x65FD, 0x85FC, 0x0000,
+  0x65F5, 0x85FE, 0xA39A, 0x65FD, 0x65FE, 0x25FF, 0x65CD, 0x25F7,
+  0x46D7, 0x5211, 0x0015, 0x286E, 0x086E, 0x0000, 0xE59C, 0xA362,
+  0xE59C, 0x26D7, 0x26D7, 0xA39A, 0x0000, 0x25F7, 0x25F7, 0x25FF,
+  0x25F7, 0x85FE, 0x65FE, 0x65FE, 0x65F5, 0x65FE, 0x65FD, 0x85F4,
+  0x5243, 0x0015, 0x65F3, 0x65FB, 0x65F4, 0x65F3, 0x85FC, 0x65FC,
+  0x85F4, 0x65FC, 0x85F5, 0x65FD, 0x85FE, 0x0000, 0xA362, 0x65FE,
+  0x65FE, 0x64CC, 0xA39A, 0x84CB, 0x4232, 0x26CF, 0x86D6, 0x5312,
+  0x0014, 0x086E, 0x6786, 0x6786, 0x6786, 0xC7A6, 0xA7A6, 0x86CE,
+  0x0000, 0x25F7, 0x26CF, 0x85FD, 0x64CC, 0x85FD, 0x64CC, 0x25F7,
+  0x65FE, 0x25F7, 0x65FE, 0x85FE, 0x8458, 0x5343, 0x0015, 0xC490,
+  0x65F4, 0x85FC, 0x65FD, 0x85F4, 0x65FD, 0x65F3, 0x84CB, 0x85FC,
+  0x64CC, 0x65F6, 0x65FD, 0x0000, 0x85FE, 0x25FF, 0x25F7, 0x64CB,
+  0x65FE, 0x46CF, 0x25FF, 0x6450, 0x5412, 0x0013, 0xA84D, 0x286E,
+  0x086E, 0x6786, 0x6786, 0x2232, 0xE59C, 0x86D6, 0xC7A6, 0x66D6,
+  0x65CD, 0x85CD, 0x26D7, 0x25F7, 0x25F7, 0x25FF, 0x65FE, 0x65FE,
+  0x84CB, 0x5444, 0x0013, 0x84CB, 0x65F5, 0x85FC, 0x65FD, 0x85F5,
+  0x65FE, 0x65FD, 0x65F3, 0x84CB, 0x85FE, 0x65FE, 0x64CC, 0x65CD,
+  0x84CB, 0x86CE, 0x25F7, 0x26CF, 0x26D7, 0x86CE, 0x5513, 0x0011,
+  0x492D, 0x286E, 0xE59C, 0xE59C, 0xA36A, 0xA7A6, 0xC7A6, 0xE59C,
+  0xA39A, 0x26CF, 0x46D7, 0x25F7, 0x25F7, 0x25F7, 0x25F7, 0x25F7,
+  0x65FD, 0x5545, 0x0012, 0x65FC, 0x85F6, 0x65FD, 0x65FE, 0x65FE,
+  0x65FE, 0x65FE, 0x25F7, 0x85FC, 0xA362, 0x25F7, 0x25FF, 0x84CB,
+  0xA39A, 0x65CD, 0x26CF, 0x26D7, 0xA362, 0x5613, 0x0010, 0xA855,
+  0x492D, 0x0000, 0xE5A4, 0x6786, 0x2866, 0xC7AE, 0xE59C, 0xA7A6,
+  0xC7A6, 0x26D7, 0x26CF, 0x25FF, 0x26CF, 0x25F7, 0x65FE, 0x5646,
+  0x0010, 0x65FD, 0x65FE, 0x65FE, 0x25F7, 0x65FE, 0x25F7, 0x25F7,
+  0x25F7, 0xA39A, 0x85FE, 0x26CF, 0x65CD, 0x84CB, 0xE59C, 0xC7A6,
+  0xA7AE, 0x5714, 0x000E, 0x492D, 0xA84D, 0x6786, 0x086E, 0x6786,
+  0xE59C, 0xC7A6, 0xA7AE, 0xC7A6, 0xA7A6, 0x26CF, 0x26CF, 0x26CF,
+  0x26CF, 0x5747, 0x000E, 0x65FE, 0x25FF, 0x25F7, 0x25F7, 0x25F7,
+  0x25FF, 0x25F7, 0x25F7, 0x86D6, 0x26CF, 0x26CF, 0x26D7, 0xA7A6,
+  0xC7A6, 0x5814, 0x000D, 0xA66C, 0x692D, 0x492D, 0xA84D, 0xA855,
+  0x286E, 0x286E, 0x6786, 0x6786, 0xA7A6, 0xC7A6, 0xA7A6, 0xC7AE,
+  0x5848, 0x000D, 0x65FC, 0x25F7, 0x26CF, 0x25F7, 0x26D7, 0x25F7,
+  0x26CF, 0x26CF, 0x86D6, 0x26CF, 0xA7A6, 0xC7A6, 0xA39A, 0x5915,
+  0x000B, 0xA855, 0x492D, 0x492D, 0xA84D, 0xA84D, 0x286E, 0x086E,
+  0x6786, 0x6786, 0xC7A6, 0x85CD, 0x5949, 0x000B, 0x64CB, 0x25F7,
+  0x26CF, 0x25F7, 0x26D7, 0x26CF, 0xC7A6, 0x26D7, 0xA7A6, 0xC7AE,
+  0xE59C, 0x5A16, 0x0008, 0xA66C, 0x692D, 0x492D, 0xA855, 0xA84D,
+  0x286E, 0xA855, 0x6786, 0x5A4A, 0x0009, 0xA362, 0x26D7, 0xC7A6,
+  0x26CF, 0xA7A6, 0xC7A6, 0x6786, 0x6786, 0xA66C, 0x5B17, 0x0006,
+  0x223A, 0xA84D, 0xA84D, 0x086E, 0x286E, 0xA664, 0x5B4C, 0x0006,
+  0xE59C, 0x65D5, 0xC7A6, 0xA7A6, 0xC7AE, 0x2232, 0x0006, 0x0005,
+  0xA66C, 0x286E, 0xE59C, 0xE59C, 0x2232, 0x005E, 0x0006, 0xA36A,
+  0x85D5, 0x86D6, 0x26CF, 0xA7A6, 0xA664, 0x0104, 0x0009, 0xA66C,
+  0xA84D, 0x286E, 0x0866, 0x6786, 0x6786, 0xC7AE, 0xE59C, 0x4232,
+  0x015C, 0x0009, 0xA36A, 0x65CD, 0x25F7, 0x25F7, 0x25F7, 0x26D7,
+  0x26CF, 0x26D7, 0xE59C, 0x0203, 0x000C, 0xA84D, 0xA855, 0x086E,
+  0x286E, 0x6786, 0x6786, 0xA7A6, 0xC7A6, 0x26D7, 0x26CF, 0x26CF,
+  0x65CD, 0x025A, 0x000C, 0x64CC, 0x85FE, 0x65FE, 0x25F7, 0x25FF,
+  0x25F7, 0x25F7, 0x25F7, 0x26D7, 0x26CF, 0x26CF, 0x26CF, 0x0302,
+  0x0010, 0xA855, 0xA84D, 0x086E, 0x2866, 0x6786, 0x6786, 0xA7A6,
+  0xC7A6, 0x26D7, 0x26CF, 0x25F7, 0x26CF, 0x25FF, 0x25F7, 0x45F7,
+  0xA39A, 0x0357, 0x0010, 0xA39A, 0x85FD, 0x65FD, 0x65F6, 0x65FE,
+  0x65FE, 0x65FE, 0x25F7, 0x25FF, 0x25F7, 0x25F7, 0x25F7, 0x26D7,
+  0x25F7, 0x26CF, 0x66D6, 0x0401, 0x0013, 0x2232, 0x692D, 0xA855,
+  0x286E, 0x6786, 0x6786, 0xA7A6, 0xC7AE, 0x26CF, 0xA7A6, 0x26D7,
+  0x26CF, 0x25F7, 0x25FF, 0x25F7, 0x25F7, 0x25F7, 0x65FE, 0x64CC,
+  0x0455, 0x0013, 0x84CB, 0x65FB, 0x85F4, 0x65FC, 0x85FD, 0x65F5,
+  0x85FE, 0x65FD, 0x65FE, 0x65F6, 0x25F7, 0x25F7, 0x25FF, 0x25F7,
+  0x25F7, 0x26CF, 0x26D7, 0xC7A6, 0x2232, 0x0501, 0x0015, 0xA66C,
+  0x2866, 0x086E, 0x6786, 0x6786, 0xC7A6, 0xA7A6, 0x26CF, 0x26D7,
+  0x26CF, 0x26CF, 0x25F7, 0x25FF, 0x25F7, 0x25F7, 0x25F7, 0x65FE,
+  0x65F6, 0x65FE, 0x85FE, 0x64CC, 0x0553, 0x0015, 0x64CA, 0x65F3,
+  0x65F3, 0x85FC, 0x65F4, 0x85FD, 0x65FC, 0x85F5, 0x65FD, 0x65FE,
+  0x65FE, 0x65FE, 0x65FE, 0x25F7, 0x25F7, 0x25F7, 0x25FF, 0x25F7,
+  0x26CF, 0x26D7, 0xE59C, 0x0600, 0x0018, 0x2218, 0x286E, 0xA84D,
+  0x678E, 0x6786, 0x0000, 0xC7A6, 0x26D7, 0xA7A6, 0x26CF, 0x26D7,
+  0x25F7, 0x25F7, 0x25F7, 0x25FF, 0x25F7, 0x65FE, 0x65FE, 0x65FD,
+  0x85F6, 0x65FD, 0x65FD, 0x85F4, 0x84CB, 0x0651, 0x0018, 0x65C1,
+  0x85F2, 0x65F2, 0x85EA, 0x65F3, 0x65F3, 0x65FC, 0x65F3, 0x85FC,
+  0x65F4, 0x85FD, 0x65FD, 0x85FE, 0x65F5, 0x65FE, 0x65FE, 0x25F7,
+  0x25F7, 0x64CC, 0x0000, 0x25F7, 0x46CF, 0x26D7, 0x2218, 0x0701,
+  0x0019, 0x286E, 0x6786, 0x6786, 0xA7A6, 0xE59C, 0xC7A6, 0x66D6,
+  0x26CF, 0x26CF, 0x85FE, 0x2232, 0x25F7, 0x64CC, 0x65FE, 0x65FE,
+  0x65FE, 0x65F6, 0x85FE, 0x65FD, 0x85FD, 0x65F4, 0x85FD, 0x65F4,
+  0x85FC, 0xA39A, 0x074F, 0x001A, 0xC6C0, 0xC5E9, 0xC5E9, 0x85EA,
+  0x65F2, 0x85EA, 0x65F2, 0x65F3, 0x65F3, 0x85FC, 0x65F4, 0x85FD,
+  0x65F4, 0x85FD, 0x65FD, 0xE59C, 0x65FE, 0x65FE, 0x65FE, 0x25F7,
+  0x64CC, 0xE59C, 0x25FF, 0x25F7, 0x46D7, 0xA664, 0x0800, 0x001C,
+  0xA66C, 0x0866, 0x286E, 0x6786, 0x6786, 0xA7A6, 0xC7AE, 0x0000,
+  0x66D6, 0x25F7, 0x65CD, 0x0000, 0x85FD, 0x65CD, 0x0000, 0xE59C,
+  0x85FD, 0x65FE, 0x65FD, 0x85FD, 0x65F4, 0x85FC, 0x65F3, 0x65F3,
+  0x65F3, 0x65FB, 0x65EA, 0xC490, 0x084D, 0x001C, 0xE490, 0x06E9,
+  0x65E9, 0x45E1, 0xC5E9, 0xA6E1, 0xC5E9, 0xC5E9, 0x85EA, 0x85F2,
+  0x65F3, 0x65F3, 0x85FC, 0x6450, 0x0000, 0x84CB, 0x84CB, 0x0000,
+  0x85FD, 0x85FD, 0x64CC, 0xA39A, 0x45F7, 0x25F7, 0x25FF, 0x26CF,
+  0x25F7, 0xE59C, 0x0900, 0x001E, 0x2866, 0x086E, 0x6786, 0x6786,
+  0xC7A6, 0x0000, 0xA362, 0x26D7, 0x25F7, 0x25F7, 0x25F7, 0x0000,
+  0x4232, 0x65FD, 0x0000, 0x0000, 0x65FE, 0x85FD, 0x65F5, 0x84CB,
+  0x85FC, 0x65F4, 0x85FC, 0x65F3, 0x65F3, 0x65F2, 0x85F2, 0xC5E9,
+  0x85F2, 0x8458, 0x094B, 0x001E, 0x8450, 0x26E1, 0x08E1, 0x06E1,
+  0x06E9, 0x65E1, 0x45E1, 0xC5E1, 0xC5E9, 0x85F2, 0xC5E9, 0xA39A,
+  0x65F2, 0x65F3, 0x85F2, 0x0000, 0xC490, 0x85FC, 0x0000, 0x4218,
+  0x65FD, 0x65FE, 0x65FE, 0x65FE, 0x4218, 0x65CD, 0x25FF, 0x25F7,
+  0x25F7, 0x86D6, 0x0A00, 0x001F, 0xE59C, 0x6786, 0x6786, 0xA7AE,
+  0xC7A6, 0xA7A6, 0x0000, 0xA36A, 0x26D7, 0x25F7, 0x25F7, 0x25F7,
+  0x86D6, 0x65FE, 0x64CC, 0x0000, 0x64CC, 0xA39A, 0x85FC, 0x85F4,
+  0xA39A, 0x64CA, 0x65FB, 0x65F3, 0x85F2, 0x65EA, 0xC5E9, 0xC5E9,
+  0x45E1, 0xA6E1, 0x26E1, 0x0A4A, 0x001F, 0xC8E8, 0xE7E8, 0xA8E0,
+  0xE7E8, 0xE7E0, 0x06E1, 0x26E1, 0x65E9, 0x45E1, 0xC5E9, 0xC6C0,
+  0x85C1, 0xC5E9, 0x64CA, 0x65C1, 0x64CA, 0x0000, 0x65F3, 0x84CB,
+  0x84CB, 0x85FC, 0x85FD, 0x65F5, 0x85FD, 0x0000, 0x0000, 0x65CD,
+  0x25F7, 0x25F7, 0x25FF, 0x86CE, 0x0B00, 0x0021, 0x6786, 0x6786,
+  0xA7A6, 0xC7A6, 0x26CF, 0x26D7, 0x64CC, 0xA664, 0x25F7, 0x25FF,
+  0x25F7, 0x25F7, 0x25F7, 0x65FE, 0x85FE, 0xA39A, 0x84CB, 0x0000,
+  0x85F4, 0x65FC, 0x85F4, 0x0000, 0xA39A, 0x85F2, 0x65EA, 0xC5E9,
+  0x85EA, 0xC5E9, 0xC5E9, 0x65E9, 0x65E1, 0x06E9, 0xC490, 0x0B48,
+  0x0021, 0x8B98, 0xA8E0, 0xAAE8, 0xC8E0, 0xA8E0, 0xC8E0, 0x08E1,
+  0xE7E8, 0x26E1, 0x06E9, 0x45E9, 0x4218, 0x8450, 0xA6E9, 0x85F2,
+  0xE490, 0xC498, 0xE490, 0xA39A, 0x65F3, 0x65F4, 0x85FC, 0x65F5,
+  0x85FC, 0x65FD, 0x85FC, 0x64CC, 0x84CB, 0x25F7, 0x25F7, 0x25F7,
+  0x25FF, 0x25F7, 0x0C00, 0x0022, 0xE59C, 0xC7A6, 0xA7AE, 0xC7A6,
+  0x26D7, 0x26CF, 0x66CE, 0x86D6, 0x25F7, 0x25F7, 0x64CC, 0xA39A,
+  0x84CC, 0x65FE, 0x65FD, 0x85FD, 0x65FC, 0x0000, 0x84CB, 0x64CA,
+  0x85EA, 0x65F3, 0x64CA, 0x65F2, 0x4218, 0xC5E9, 0x45E9, 0x65E1,
+  0x45E1, 0x65E1, 0x08E1, 0xE7E8, 0xE7E0, 0x8AC8, 0x0C47, 0x0022,
+  0xAEC8, 0xAAE0, 0xAAE8, 0xA8E0, 0xAAE0, 0xC8E0, 0xA8E8, 0xC8E0,
+  0xE7E0, 0xC6C0, 0xC6C0, 0xE7E0, 0xC6C0, 0x45E9, 0x65E1, 0x65C1,
+  0x85C1, 0x4218, 0x85F2, 0x65F2, 0x65F3, 0x85F2, 0xA39A, 0xC490,
+  0x85FC, 0x85FC, 0x65FD, 0x85F4, 0x65FE, 0x65FE, 0x25F7, 0x65FE,
+  0x25F7, 0x65FD, 0x0D00, 0x0023, 0xE59C, 0xA7A6, 0x26CF, 0xC7A6,
+  0x26D7, 0x26CF, 0xA36A, 0xE59C, 0x25F7, 0x25F7, 0x85CD, 0x64CC,
+  0x84CC, 0x65FD, 0x85FD, 0xA362, 0x65FD, 0x85F4, 0x65FC, 0x64CA,
+  0x0000, 0x85EA, 0x85F2, 0xC5E9, 0xC490, 0x65E9, 0x4218, 0x65C1,
+  0x65E9, 0x26E1, 0x06E1, 0xE7E0, 0xE7E8, 0xA8E0, 0xC8E0, 0x0D46,
+  0x0023, 0xACE0, 0xACE8, 0xACE0, 0xAAE0, 0xACE0, 0xAAE8, 0xAAE0,
+  0xC8E0, 0x8AC8, 0xC6C0, 0xE7E8, 0x8450, 0x08E1, 0x06E9, 0x65E1,
+  0x0000, 0x45E1, 0x45E1, 0xC5E9, 0xC5E9, 0x64CA, 0x85F2, 0x84CB,
+  0x85C1, 0xA39A, 0x65F3, 0x65FD, 0x85FD, 0xA362, 0x64CC, 0x65FE,
+  0x65FE, 0x25F7, 0x65F6, 0x84CC, 0x0E00, 0x0024, 0x4218, 0xC7AE,
+  0xA7A6, 0x26D7, 0x26CF, 0x25FF, 0x65CD, 0x0000, 0x25F7, 0x25F7,
+  0x0000, 0x0000, 0x0000, 0xA362, 0x84CB, 0x0000, 0x84CB, 0x65FB,
+  0x65FB, 0x65F3, 0x0000, 0x0000, 0xC5E9, 0xC5E9, 0x45E1, 0x65E1,
+  0x06E1, 0x06E1, 0xE7E8, 0xE7E0, 0xE7E0, 0xE7E0, 0xC8E8, 0xC8E0,
+  0xA8E0, 0xAAE0, 0x0E45, 0x0024, 0xAEE8, 0xACE0, 0xAEE0, 0xACE0,
+  0xACE8, 0xAAE0, 0xACE0, 0xAAE0, 0xAAE8, 0xC8E0, 0xAAE0, 0xA8E0,
+  0xC8E8, 0xE7E0, 0x08E1, 0x0000, 0x0000, 0x06E1, 0x65E1, 0x45E9,
+  0x85C1, 0x0000, 0x64CA, 0x0000, 0x0000, 0x0000, 0xA362, 0x85FC,
+  0x65FC, 0x0000, 0x85F5, 0x65FD, 0x85FE, 0x65FE, 0x65F6, 0x2218,
+  0x0F01, 0x0024, 0xA664, 0x26CF, 0x26CF, 0x25F7, 0x25FF, 0x25F7,
+  0x0000, 0x25F7, 0x85F6, 0x65FD, 0x84CC, 0x65FD, 0x85FC, 0x65FD,
+  0x84CB, 0x85FC, 0x8450, 0x65F3, 0x85EA, 0x64CA, 0x0000, 0xA6E1,
+  0xC5E9, 0xC5E9, 0x65E9, 0x06E1, 0x27D1, 0x27D1, 0xC8E8, 0x08E1,
+  0xA8E0, 0xAAE0, 0xAAE0, 0x08E1, 0xAAE8, 0xACE0, 0x0F44, 0x0024,
+  0xB0E0, 0xAEE0, 0xAEE0, 0xAEE8, 0xAEE0, 0xACE0, 0xAEE0, 0xACE8,
+  0xACE0, 0xAAE0, 0x08E1, 0xAAE0, 0xAAE8, 0xC8E0, 0x08E1, 0x0000,
+  0x0000, 0x08E1, 0x45E9, 0xC6C0, 0x85C1, 0x65C1, 0xC39A, 0xC5E9,
+  0x64CA, 0x64CA, 0xA39A, 0xA39A, 0x85FC, 0x65F3, 0x0000, 0x65FD,
+  0x65FE, 0x65FE, 0x85FE, 0xA39A, 0x1002, 0x0024, 0x66D6, 0x26D7,
+  0x26CF, 0x25F7, 0x25F7, 0x25FF, 0x65FE, 0x65FE, 0x65F5, 0x85FD,
+  0xA39A, 0xA39A, 0x85FC, 0x85FC, 0x64CA, 0xA39A, 0xC490, 0x85F2,
+  0xC5E9, 0x65C1, 0x4218, 0x65E9, 0x45E1, 0x06E1, 0xE490, 0x0000,
+  0x0000, 0x0000, 0x0000, 0xAAE8, 0xC8E0, 0xAAE0, 0xAAE8, 0xACE0,
+  0xACE0, 0xACE0, 0x102C, 0x0002, 0x6B98, 0x8B60, 0x103B, 0x0002,
+  0x8B60, 0x8B98, 0x1043, 0x0024, 0xB0E8, 0xAEE0, 0xB0E0, 0xAEE0,
+  0xAEE8, 0xAEE0, 0xAEE0, 0x8EC8, 0x0000, 0x0000, 0x0000, 0x0000,
+  0xC6C0, 0xC8E8, 0xAAE0, 0x8AC8, 0x0000, 0xC8E0, 0xE7E0, 0xE7E8,
+  0xC490, 0xC6C0, 0x65E1, 0x45E9, 0xC5E9, 0xE490, 0x64CA, 0x85F2,
+  0x65F3, 0x65F3, 0x65FC, 0x85F4, 0x65FD, 0x85FD, 0x65F6, 0x65FD,
+  0x1102, 0x000D, 0xA664, 0x26CF, 0x25F7, 0x25F7, 0x25F7, 0x65FE,
+  0x85FE, 0xA39A, 0x64CC, 0x85FD, 0x65F5, 0x85FC, 0x84CB, 0x1114,
+  0x0013, 0x85C1, 0xC5E9, 0xA6E1, 0x65E9, 0xC6C0, 0x0000, 0x08E1,
+  0xA8E8, 0x0000, 0x0000, 0x0000, 0x4218, 0xACE0, 0xACE0, 0xACE0,
+  0xACE8, 0xAEE0, 0xACE0, 0xACE8, 0x112C, 0x0002, 0xB0E0, 0xB0E0,
+  0x113B, 0x0002, 0xB1C8, 0xB0E0, 0x1142, 0x0025, 0xB0E0, 0xB0E0,
+  0xB0E0, 0xB0E0, 0xB0E0, 0xAEE0, 0xB0E0, 0xAEE0, 0x0000, 0x0000,
+  0x0000, 0x0000, 0xACE0, 0xAAE8, 0x0000, 0xAAE0, 0xAAE0, 0xC8E0,
+  0xE7E8, 0x8458, 0x0000, 0x0000, 0x0000, 0x0000, 0xC490, 0x65C1,
+  0x64CA, 0x85F2, 0x65EA, 0x85F2, 0x64CA, 0x65F3, 0x65F4, 0x85FC,
+  0x65FD, 0x85FD, 0xA362, 0x1203, 0x000D, 0x25FF, 0x25F7, 0x25FF,
+  0x25F7, 0x65CD, 0x0000, 0x0000, 0x0000, 0x0000, 0xC490, 0x85FC,
+  0x65FB, 0x8450, 0x1215, 0x0013, 0x45E9, 0x65E1, 0x45E1, 0xE7E8,
+  0x0000, 0x0000, 0xC8E0, 0xA8E0, 0x0000, 0x0000, 0x0000, 0x8450,
+  0xACE8, 0xAEC8, 0x8AC8, 0xACE8, 0xAEE0, 0xAEE0, 0xAEC8, 0x122D,
+  0x0001, 0xB0E8, 0x123B, 0x001A, 0xB1D0, 0x8B58, 0x0000, 0x0000,
+  0x0000, 0x0000, 0xD1B0, 0xB0E0, 0xB0E0, 0xB0E0, 0xB0E0, 0xAEE8,
+  0xB0E0, 0x8EC8, 0x0000, 0x0000, 0x0000, 0x0000, 0xACE0, 0xACE0,
+  0x8458, 0x0000, 0xAAE8, 0xC8E0, 0xAAE0, 0xC6C0, 0x125B, 0x000B,
+  0xC5E9, 0xC5E9, 0x65C1, 0x0000, 0x0000, 0x0000, 0x0000, 0x65F3,
+  0x85FC, 0x85F4, 0x65FC, 0x1303, 0x0005, 0xA39A, 0x25F7, 0x25F7,
+  0x25F7, 0x65CD, 0x130E, 0x0003, 0x85FC, 0x65FB, 0xA362, 0x1316,
+  0x0019, 0x65E1, 0x26E1, 0x06E9, 0xC490, 0x0000, 0x0000, 0xAAE0,
+  0xAAE8, 0x8B98, 0x0000, 0x0000, 0x0000, 0xAEE0, 0xAEE8, 0xC490,
+  0xAEE0, 0xB0E0, 0xB0E8, 0x8B98, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x8EC8, 0xD1B0, 0x133A, 0x0002, 0xB1A8, 0xD1B0, 0x1341, 0x0013,
+  0xB1C8, 0xB0E0, 0xB0E0, 0xB0E8, 0xAEC8, 0xB0E0, 0xB0E0, 0x0000,
+  0x0000, 0x0000, 0x8B98, 0xAEE0, 0xAEE0, 0x0000, 0x0000, 0x8AC8,
+  0xAAE8, 0x08E1, 0xAAE8, 0x1359, 0x0003, 0x8450, 0x45E1, 0x65C1,
+  0x1362, 0x0004, 0x65F3, 0x85FC, 0x65FD, 0x4232, 0x1404, 0x002B,
+  0x45FF, 0x25F7, 0x65FE, 0x65FE, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x6450, 0x64CA, 0x64CA, 0x65FB, 0x85F2, 0x8450, 0x0000, 0x0000,
+  0x4218, 0x4220, 0x27D9, 0x06E1, 0xE7E8, 0xE7E0, 0x8450, 0x0000,
+  0x0000, 0x8BA0, 0xAAE0, 0xAAE8, 0x0000, 0x0000, 0x0000, 0x8EC8,
+  0xAEE0, 0x8B98, 0x8EC8, 0xB0E8, 0xB0E0, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x8B98, 0xB1A8, 0x143A, 0x002B, 0x8BA0, 0x8B58, 0x0000,
+  0x0000, 0x0000, 0x0000, 0xB1B0, 0xB1C8, 0xB1C8, 0xAED0, 0x8EC8,
+  0xB0E0, 0xB1C8, 0x0000, 0x0000, 0x0000, 0xAEC8, 0xB0E8, 0xC490,
+  0x0000, 0x0000, 0x8B98, 0xACE8, 0xACE0, 0xAAE8, 0x8AC8, 0x0000,
+  0x8450, 0x0000, 0x0000, 0xE490, 0x06E9, 0x06E9, 0x26E1, 0xC6C0,
+  0x4218, 0x0000, 0x0000, 0x0000, 0x0000, 0x65FB, 0x85FC, 0x85F4,
+  0x1504, 0x002C, 0x25F7, 0x25F7, 0x25FF, 0x85FE, 0x0000, 0x0000,
+  0x0000, 0xC39A, 0x84CB, 0xC498, 0x8450, 0x0000, 0x85EA, 0xC5E9,
+  0xC5E9, 0x45E1, 0x65E1, 0x26E9, 0x06E1, 0xE7E0, 0x08E1, 0xC8E0,
+  0xAAE8, 0x8AC8, 0x0000, 0xAAE0, 0xACE0, 0xACE0, 0xAEE8, 0x8ED0,
+  0x0000, 0x0000, 0x8B98, 0xB0E0, 0xB0E0, 0xB1C8, 0xB0E0, 0xB1C8,
+  0x0000, 0x0000, 0x0000, 0x0000, 0xD1B0, 0x8B60, 0x1539, 0x002C,
+  0x8B58, 0xD190, 0x0000, 0x0000, 0x0000, 0x0000, 0xB1B0, 0xB1C8,
+  0xD1A8, 0xB1B0, 0xB1C8, 0xB1D0, 0x8B98, 0x0000, 0x0000, 0x8EC8,
+  0xB0E0, 0xB0E0, 0xB0E0, 0x8B58, 0x0000, 0xAEE8, 0xAEE0, 0xAEE0,
+  0xACE0, 0xACE8, 0xAAE0, 0xACE0, 0xAAE0, 0xAAE8, 0xC8E0, 0x08E1,
+  0x8AC8, 0x0000, 0xC6C0, 0x65E1, 0x45E9, 0x8458, 0x0000, 0x0000,
+  0x4218, 0x65F3, 0x65F3, 0x65FC, 0x1604, 0x002C, 0x65CD, 0x25FF,
+  0x65FE, 0x65FE, 0xC490, 0x0000, 0x84CB, 0x65F3, 0x0000, 0x0000,
+  0x0000, 0x0000, 0xA6E1, 0xC5E9, 0x65E1, 0x45E9, 0x06E1, 0x26E1,
+  0xE7E0, 0xC6C0, 0x0000, 0xE490, 0xA8E8, 0xAAE0, 0xAAE8, 0xACE0,
+  0x8B98, 0x4218, 0xACE8, 0xAEE8, 0xAEE0, 0x8EC8, 0x0000, 0x0000,
+  0xB0E0, 0xB0E0, 0xB1C8, 0xB1C8, 0x8B98, 0x0000, 0x0000, 0x0000,
+  0x6BA0, 0xD1A8, 0x1639, 0x002C, 0xD190, 0x8B60, 0x0000, 0x0000,
+  0x0000, 0x8B98, 0xB1B0, 0xD1A8, 0xB1B0, 0xD1A8, 0xB1D0, 0x0000,
+  0x0000, 0x6B98, 0xB0E0, 0xB1C8, 0xB0E8, 0x8B98, 0xB0E0, 0xAEE8,
+  0xB0E0, 0xAEE0, 0xAEE0, 0x8EC8, 0x8AC8, 0xAAC8, 0xACE8, 0xAAE0,
+  0xAAE0, 0xC8E0, 0xA8E8, 0xC8E0, 0xC490, 0x0000, 0x0000, 0x0000,
+  0x8458, 0x85C1, 0x8458, 0x0000, 0x65C1, 0x85F2, 0x65FB, 0x64CA,
+  0x1704, 0x002C, 0x64CC, 0x65FE, 0x65FE, 0x85FE, 0xE59C, 0x8450,
+  0x85FC, 0x0000, 0x0000, 0x0000, 0x0000, 0x65C1, 0x85EA, 0xC5E9,
+  0xC5E9, 0xC6C0, 0x06E1, 0xE7E0, 0x08E1, 0xC8E8, 0xA8E8, 0x0000,
+  0x0000, 0x4218, 0xACE0, 0xACE8, 0x8B98, 0x0000, 0x0000, 0x6B98,
+  0xB0E0, 0xB0E0, 0xB0E8, 0xAEC8, 0xD1A8, 0xB1C8, 0xB0E8, 0xB1C8,
+  0xB1D0, 0x8B60, 0x0000, 0x0000, 0x4218, 0xD190, 0x1738, 0x002D,
+  0x8B60, 0xD178, 0x0000, 0x0000, 0x0000, 0x4218, 0xD1A8, 0xD190,
+  0xD1A8, 0xD190, 0xD1B0, 0x4218, 0xB1B0, 0xD1A8, 0xB1D0, 0xB1C8,
+  0xB1A8, 0x0000, 0x0000, 0xAEC8, 0xB0E0, 0xB0E8, 0x8B58, 0x0000,
+  0x0000, 0x8EC8, 0xAEE0, 0xACE8, 0xACE0, 0xAAE0, 0xAAE0, 0xC8E8,
+  0xA8E0, 0xC8E8, 0x0000, 0x0000, 0x0000, 0x0000, 0xC490, 0x85C1,
+  0x0000, 0xC5E9, 0x65F3, 0x65F3, 0xA39A, 0x1804, 0x002D, 0xA362,
+  0x65FE, 0x65FD, 0x85FD, 0x65FC, 0x84CC, 0xA39A, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x85F2, 0xC5E9, 0xC5E1, 0x65C1, 0x06E1, 0x0000,
+  0xE490, 0xA8E8, 0xC8E0, 0xA8E8, 0xAAE0, 0x8450, 0x0000, 0x8B60,
+  0xACE8, 0xACE0, 0xAEE0, 0x0000, 0x0000, 0x0000, 0xB0E0, 0xB0E0,
+  0xB0E0, 0xB1C8, 0xB1C8, 0xB1D0, 0xB1C8, 0x8B98, 0xB1B0, 0x0000,
+  0x0000, 0x0000, 0xF178, 0x8B58, 0x1838, 0x002D, 0x8B60, 0x1161,
+  0x0000, 0x0000, 0x0000, 0xD178, 0xF178, 0xD178, 0xD190, 0xF190,
+  0xD190, 0xD1A8, 0xD1B0, 0xB1A8, 0xD1B0, 0x4218, 0x0000, 0x0000,
+  0xB1D0, 0xB0E0, 0xB0E0, 0x6B98, 0x0000, 0x8458, 0xAEE8, 0xAEE0,
+  0xACE8, 0xACE0, 0x8B98, 0x6B98, 0x8AC8, 0xAAE8, 0xC8E0, 0xC8E8,
+  0xC6C0, 0x0000, 0x0000, 0x0000, 0x0000, 0x65C1, 0xE490, 0x85F2,
+  0x65F2, 0x65F3, 0x8450, 0x1905, 0x002C, 0x65FE, 0x85FE, 0x65FD,
+  0x85FD, 0x85FC, 0x4218, 0x0000, 0x0000, 0x0000, 0x8450, 0xC5E9,
+  0xC5E9, 0x45E1, 0x65E9, 0x8458, 0x0000, 0x0000, 0xC490, 0xC8E0,
+  0xAAE0, 0xAAE8, 0xACE8, 0xC490, 0xE490, 0xACE0, 0xAEE0, 0xAEE8,
+  0xB0E0, 0xB0E0, 0x8B60, 0x4218, 0xB0E8, 0xB1C8, 0x8B60, 0x0000,
+  0xB1C8, 0xB1A8, 0xD1B0, 0xD190, 0xF178, 0x0000, 0x0000, 0x4220,
+  0xD178, 0x1938, 0x002C, 0x1169, 0x4218, 0x0000, 0x0000, 0x1161,
+  0xF178, 0xD178, 0xF178, 0xD190, 0xF178, 0x8B60, 0x6B98, 0xD1B0,
+  0xB1B0, 0x0000, 0x4218, 0xB1C8, 0xB1C8, 0xB1D0, 0xB1C8, 0xB0E0,
+  0x0000, 0x8B98, 0xB0E0, 0xB0E0, 0xAEE0, 0xAEE8, 0x8450, 0x0000,
+  0x0000, 0x8AC8, 0xAAE8, 0xAAE0, 0xC8E0, 0xE7E0, 0x0000, 0x0000,
+  0x0000, 0x0000, 0xC490, 0xC5E9, 0xC5E9, 0x65F2, 0x85F2, 0x1A05,
+  0x002D, 0x65FE, 0x65FD, 0x65F5, 0x85FC, 0x65F4, 0x4218, 0x0000,
+  0x0000, 0x0000, 0x0000, 0xC5E9, 0x45E9, 0x65E1, 0x06E1, 0xE7E8,
+  0x4218, 0x0000, 0x0000, 0xE490, 0xA8E8, 0xAAE0, 0xAAE8, 0xACE0,
+  0xACE0, 0xAEE0, 0xAEE8, 0xAEC8, 0xAEE0, 0xB0E0, 0xB0E0, 0xB0E0,
+  0xB1C8, 0xB1C8, 0xB1B0, 0x0000, 0x0000, 0x8B58, 0xD190, 0xD1B0,
+  0xD188, 0x0000, 0x0000, 0x0000, 0x8B60, 0x5149, 0x1A37, 0x002D,
+  0x3149, 0x8B60, 0x0000, 0x0000, 0x0000, 0x5149, 0x1161, 0x1169,
+  0xF178, 0x0B19, 0x0000, 0x0000, 0xD190, 0xD190, 0xF190, 0xD190,
+  0xD1A8, 0xD1B0, 0xB1C8, 0x6B98, 0xB1D0, 0xB1C8, 0xB1C8, 0xB0E8,
+  0xB0E0, 0xAEE0, 0xB0E0, 0x4218, 0x0000, 0x0000, 0x4218, 0xAED0,
+  0xACE8, 0xA8E0, 0xAAE8, 0xC8E0, 0x0000, 0x0000, 0x0000, 0x0000,
+  0xC490, 0x65E9, 0xC5E9, 0xC5E9, 0x85EA, 0x1B05, 0x0005, 0x65FD,
+  0x85FE, 0x65FD, 0x85F5, 0x85FC, 0x1B0F, 0x0023, 0x65C1, 0xC5E9,
+  0x65E1, 0x45E9, 0x08E1, 0xE7E0, 0xC8E8, 0x08E1, 0xE490, 0xACE0,
+  0xAAE0, 0xACE0, 0xACE8, 0xAEE0, 0xAEE0, 0xB0E0, 0xB0E0, 0xB0E0,
+  0xB0E0, 0xB0E8, 0xB1C8, 0xB1C8, 0xB1C8, 0xB1D0, 0xD190, 0x0000,
+  0x0000, 0x8B58, 0xF190, 0xD190, 0x1169, 0x0000, 0x0000, 0x8B60,
+  0x5149, 0x1B37, 0x002D, 0x3149, 0x8B60, 0x0000, 0x0000, 0x5149,
+  0x1161, 0x3149, 0x1161, 0x0000, 0x0000, 0x0000, 0xD178, 0xF178,
+  0xF190, 0xD188, 0xD1B0, 0xD190, 0xB1A8, 0xD1B0, 0xB1C8, 0xB1C8,
+  0xB1C8, 0xB1C8, 0xB0E0, 0xB0E0, 0xB0E8, 0x8EC8, 0x0000, 0x8B98,
+  0xAEE0, 0xACE0, 0xACE8, 0xAAE0, 0xACE0, 0xA8E8, 0x8B98, 0x0000,
+  0x0000, 0x0000, 0x0000, 0xC490, 0xC5E9, 0xC5E9, 0x65EA, 0x64CA,
+  0x1C05, 0x0005, 0x65F4, 0x85FD, 0x65FD, 0x85F4, 0x65FC, 0x1C0F,
+  0x0055, 0xC5E9, 0x45E1, 0x65E1, 0x08E1, 0xE7E0, 0xA8E0, 0xC8E0,
+  0xA8E8, 0xAAE0, 0xAAE0, 0xACE0, 0xACE8, 0xAEE0, 0xAEE0, 0xAEE0,
+  0xAEE8, 0xB0E0, 0xB0E0, 0xB0E0, 0xB1C8, 0xB1C8, 0xB1C8, 0xB1C8,
+  0xD1B0, 0xB1A8, 0x4218, 0x0000, 0x0000, 0xF178, 0xD178, 0x1169,
+  0x4218, 0x0000, 0x0000, 0x3149, 0x0B21, 0x0000, 0x0000, 0x0000,
+  0x0B19, 0x5151, 0x0000, 0x0000, 0x4218, 0x3151, 0x9131, 0x5149,
+  0x0B19, 0x0000, 0x0000, 0x3151, 0x1161, 0x1169, 0xF178, 0xF178,
+  0xD178, 0xD190, 0xF190, 0xD1A8, 0xB1B0, 0xB1C8, 0xB1C8, 0xB1C8,
+  0xB1D0, 0xB0E0, 0xB0E0, 0xB0E0, 0xAEE0, 0xAEE8, 0xAEE0, 0xAEE0,
+  0xACE0, 0xACE8, 0xAAE0, 0xAAE0, 0xC6C0, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x85C1, 0x45E9, 0xC5E9, 0xC5E9, 0x85C1, 0x1D05, 0x005F,
+  0xA39A, 0x65FD, 0x85F4, 0x65FC, 0x85FC, 0x64CA, 0x0000, 0x0000,
+  0x0000, 0x85C1, 0x65E1, 0x06E1, 0x0000, 0xC6C0, 0xA8E0, 0x08E1,
+  0xC8E8, 0xAAE0, 0xAAE0, 0xACE0, 0xACE8, 0xAEE0, 0xAEE0, 0xB0E0,
+  0xAEE0, 0xB0E0, 0xAEE8, 0xB0E0, 0xB1C8, 0xB1D0, 0xB1C8, 0xB1C8,
+  0xB1B0, 0xD1A8, 0xD190, 0xD1B0, 0x0000, 0x0000, 0xF178, 0x1161,
+  0x0B21, 0x1161, 0x0000, 0x0000, 0x0B21, 0x3149, 0x0000, 0x0000,
+  0x0000, 0x9131, 0x0B19, 0x0000, 0x0000, 0x5149, 0x9131, 0x0000,
+  0x9131, 0x3149, 0x0000, 0x8B60, 0x3149, 0x1161, 0x1161, 0xF178,
+  0xF178, 0xD190, 0xF178, 0xD190, 0xD188, 0xD1B0, 0xB1A8, 0xB1D0,
+  0xB1C8, 0xB0E0, 0xB1C8, 0xB0E0, 0xB0E0, 0xB0E0, 0xAEE0, 0xB0E0,
+  0xAEE0, 0xAEE8, 0x8B98, 0xC6C0, 0xAAE0, 0xAAE8, 0x4218, 0x0000,
+  0x0000, 0x0000, 0x06E1, 0x65E9, 0x45E1, 0xC5E9, 0x8450, 0x1E05,
+  0x0018, 0x8450, 0x85FD, 0x85FD, 0x65FC, 0x85FC, 0x65F3, 0x64CA,
+  0x0000, 0x0000, 0x65C1, 0xC5E9, 0x8450, 0x0000, 0x0000, 0x0000,
+  0x8AC8, 0xC8E8, 0xAAE0, 0xACE8, 0xAAE0, 0xACE0, 0x8EC8, 0xAEC8,
+  0x8458, 0x1E24, 0x003F, 0x8458, 0xB1B0, 0xD190, 0xF190, 0xF178,
+  0xD178, 0x8B58, 0x1161, 0x0000, 0x0000, 0x3149, 0x8B60, 0x0000,
+  0x0000, 0x9131, 0x0B19, 0x0000, 0x0B21, 0x9131, 0x0000, 0x0000,
+  0x0B19, 0x9131, 0x9131, 0x0000, 0x9131, 0x9131, 0x0B19, 0x9131,
+  0x5149, 0x3149, 0x1169, 0x5149, 0x8B60, 0x4218, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x8B60, 0x8B60, 0xD190, 0xD1B0, 0xB1C8, 0xB1D0,
+  0xB0E0, 0xB0E0, 0xB0E0, 0xAEE0, 0xAEC8, 0x0000, 0x0000, 0x0000,
+  0xAAE8, 0xA8E0, 0xE490, 0x0000, 0x0000, 0xC6C0, 0x06E9, 0x06E1,
+  0x65E1, 0xC5E9, 0x1F06, 0x0011, 0x85FD, 0x65F4, 0x85FC, 0x65F3,
+  0x65F3, 0x65F2, 0x85EA, 0xC5E9, 0xC5E9, 0x65E1, 0x65E1, 0x06E9,
+  0x06E1, 0xC8E0, 0xA8E0, 0xC8E8, 0x08E9, 0x1F27, 0x001D, 0xF178,
+  0xD190, 0xD178, 0xF178, 0x1169, 0x4218, 0x0000, 0x5149, 0x9131,
+  0x0000, 0x0000, 0x9131, 0x9131, 0x0000, 0xEE09, 0x9131, 0x0000,
+  0x0000, 0xF221, 0x1222, 0x0B21, 0x0000, 0x0B19, 0x1222, 0x9131,
+  0x5149, 0x9131, 0x3149, 0x4220, 0x1F52, 0x0011, 0x8B98, 0xB0E0,
+  0xB0E0, 0xAEE0, 0xAEE0, 0xACE0, 0xACE8, 0xAAE0, 0x08E1, 0x8AC8,
+  0xA8E0, 0xC8E0, 0x26E9, 0x06E1, 0x45E1, 0x65E9, 0xC5E9, 0x2006,
+  0x0012, 0x64CC, 0x85FC, 0x65F3, 0x65F3, 0x65F2, 0x85EA, 0xC5E9,
+  0xC5E9, 0x45E1, 0x45E1, 0x06E1, 0x26E1, 0xC8E8, 0xA8E0, 0xC8E0,
+  0xAAE0, 0xAAE8, 0xAAE0, 0x2029, 0x0018, 0x1161, 0x3149, 0x3149,
+  0x5149, 0x0000, 0x0B19, 0x9131, 0x0B21, 0x0000, 0x4218, 0x1222,
+  0x1222, 0xF221, 0x0000, 0x0000, 0x0B21, 0x1222, 0x1222, 0x0000,
+  0x4218, 0xF221, 0x9131, 0x9131, 0x9131, 0x2052, 0x0011, 0xB1D0,
+  0xB0E8, 0xAEE0, 0xAEE8, 0xACE0, 0xAEE0, 0xACE0, 0xACE8, 0xAAE0,
+  0xAAE0, 0xC8E0, 0xA8E8, 0xC8E0, 0x06E1, 0x06E1, 0x65E9, 0x85C1,
+  0x2106, 0x0013, 0x84CB, 0x85F4, 0x65FC, 0x65F3, 0x65F3, 0x85F2,
+  0x85EA, 0xC5E9, 0xC5E9, 0x65E1, 0x06E1, 0xE7E8, 0xE7E0, 0xC8E0,
+  0xAAE0, 0x8AC8, 0xACE8, 0xACE8, 0x8BA0, 0x212A, 0x0016, 0x3149,
+  0x3149, 0x3149, 0x9131, 0x0000, 0x9129, 0x1222, 0x0000, 0x9131,
+  0x1222, 0x531A, 0xF221, 0x9131, 0x0000, 0xB412, 0x531A, 0x1222,
+  0x0000, 0x531A, 0x1222, 0x1222, 0xEE09, 0x2151, 0x0012, 0xB1A8,
+  0xB0E0, 0xB0E0, 0xB1C8, 0xAEE8, 0xAEE0, 0xACE0, 0xAEE0, 0xACE8,
+  0xACE0, 0xAAE0, 0xAAE0, 0xC8E8, 0xE7E0, 0xE7E0, 0x45E1, 0x65E9,
+  0xC490, 0x2206, 0x0013, 0x4218, 0x65FC, 0x65FB, 0x65F3, 0x85F2,
+  0x65EA, 0xC5E9, 0xC5E9, 0x45E1, 0x65E1, 0xC490, 0x0000, 0xE490,
+  0xA8E8, 0xC8E0, 0xAAE8, 0xAAE0, 0xACE0, 0xACE0, 0x222B, 0x0014,
+  0x3149, 0x9129, 0x9131, 0x9131, 0x0B19, 0x9131, 0x4220, 0xEE09,
+  0x731A, 0x531A, 0xB412, 0xEE09, 0x4220, 0x531A, 0xB412, 0x0000,
+  0xB41A, 0x531A, 0x531A, 0x0B21, 0x2249, 0x0001, 0x0000, 0x2250,
+  0x0013, 0x8458, 0xB0E8, 0xB0E0, 0xB0E0, 0xAEE0, 0xB0E0, 0xAEE0,
+  0x8B98, 0x4218, 0xACE8, 0xAAE8, 0xAAE0, 0xA8E8, 0xC8E0, 0xA8E0,
+  0x08E1, 0x08E1, 0x65E1, 0x0000, 0x2307, 0x0014, 0x85F4, 0x65FC,
+  0x65F3, 0x65F3, 0x85F2, 0x85F2, 0xC6E1, 0xA6E1, 0x65E1, 0x06E1,
+  0xC6C0, 0x08E1, 0xC8E8, 0xAAE0, 0xAAE0, 0xACE8, 0x8AC8, 0xAEC8,
+  0xAEE8, 0x4220, 0x232C, 0x0012, 0x3149, 0x9129, 0xF221, 0x9131,
+  0x1222, 0x531A, 0x423A, 0xB41A, 0xB412, 0xB41A, 0x0B19, 0xB41A,
+  0x560B, 0x0B21, 0x5613, 0xB412, 0xB41A, 0xEE09, 0x2350, 0x0012,
+  0xB1C8, 0xD1A8, 0xB0E0, 0xB0E0, 0xB0E0, 0xAEE0, 0xB0E8, 0x8EC8,
+  0xAEC8, 0xACE0, 0xACE0, 0xAAE0, 0xAAE8, 0xC8E0, 0x08E1, 0xE7E0,
+  0x06E1, 0x06E9, 0x2407, 0x0015, 0x64CA, 0x65F3, 0x65FB, 0x65EA,
+  0x85F2, 0xC5E9, 0xC6C0, 0x45E1, 0x06E1, 0xE7E0, 0xE7E0, 0xC8E8,
+  0xA8E0, 0xC8E0, 0xAAE0, 0xAAE8, 0xACE0, 0x8EC8, 0xAEE0, 0xB1C8,
+  0x8B98, 0x242A, 0x0015, 0x4218, 0x9131, 0x9131, 0x1222, 0x9131,
+  0xF221, 0x1222, 0xB412, 0x4220, 0xB412, 0xB41A, 0x560B, 0x0000,
+  0x5613, 0x5613, 0x330B, 0xB412, 0x5613, 0xB412, 0xB41A, 0x531A,
+  0x244E, 0x0014, 0x8B60, 0xB1B0, 0xD1A8, 0x6B98, 0xB1D0, 0xB0E0,
+  0xB0E0, 0xB0E0, 0xAEE8, 0xAEE0, 0xACE0, 0xACE0, 0xAAE8, 0xAAE0,
+  0x8B98, 0xA8E8, 0xC8E0, 0xE7E0, 0xE7E0, 0xC6C0, 0x2508, 0x0016,
+  0x65FC, 0x65F3, 0x85F2, 0xC5E9, 0x85C1, 0xC490, 0x85C1, 0x26E1,
+  0x06E9, 0xE7E0, 0xA8E0, 0xC8E0, 0xAAE8, 0xAAE0, 0xACE0, 0xACE0,
+  0xAEE8, 0xAEE8, 0x4218, 0x8ED0, 0xAED0, 0x8458, 0x2527, 0x001C,
+  0x8B60, 0x5149, 0x3149, 0x3149, 0x9131, 0x1222, 0xF221, 0x4220,
+  0x1222, 0xB41A, 0xB412, 0x5613, 0xB412, 0x5613, 0x5613, 0xF80B,
+  0x5613, 0xD80B, 0x560B, 0x4220, 0xB412, 0x5613, 0x5613, 0x5613,
+  0xB412, 0xB41A, 0x1222, 0x4218, 0x254D, 0x0014, 0xD178, 0xD1B0,
+  0x8B58, 0xB1C8, 0xB1C8, 0xB0E0, 0xB0E0, 0xB0E0, 0xB0E0, 0xB0E0,
+  0xAEE8, 0xAEE0, 0xACE0, 0xACE0, 0xAAE8, 0x8458, 0xA8E0, 0xC8E0,
+  0xE7E0, 0x06E9, 0x2608, 0x0059, 0xA39A, 0x65F3, 0x85F2, 0x85F2,
+  0x45E1, 0xC490, 0x0000, 0xC6C0, 0xE7E0, 0xE7E8, 0xC8E0, 0xAAE0,
+  0xAAE0, 0xAAE8, 0x0000, 0xAEE0, 0xACE0, 0x8EC8, 0x0000, 0x4218,
+  0xB0E8, 0xB0E0, 0xB1C8, 0xB1C8, 0xD1B0, 0xB1A8, 0xD190, 0xF178,
+  0xF178, 0xD178, 0x1161, 0x1161, 0x3149, 0x5149, 0x0000, 0x9131,
+  0x9131, 0x1222, 0x1222, 0xB412, 0x531A, 0x531A, 0xB412, 0x5613,
+  0x5613, 0xD80B, 0xD80B, 0xF80B, 0x5613, 0xD80B, 0x560B, 0x330B,
+  0x5613, 0x5613, 0x0B19, 0x0B21, 0x531A, 0x531A, 0x1222, 0x1222,
+  0xEE09, 0x9131, 0x4220, 0x0B19, 0x4220, 0x3149, 0x8B60, 0xF178,
+  0xD178, 0xD190, 0x0000, 0x0000, 0xD1B0, 0xB1C8, 0xB1C8, 0x8BA0,
+  0xB0E0, 0xB0E0, 0xAEE0, 0xAEE8, 0xACE0, 0xACE0, 0x0000, 0xC490,
+  0x8B98, 0xA8E8, 0xC8E8, 0xE7E0, 0xC490, 0x2709, 0x0057, 0x85F2,
+  0x65F3, 0xC5E9, 0xC5E9, 0x65E1, 0xC6C0, 0x26E1, 0x06E9, 0xA8E0,
+  0x8B98, 0xAAE8, 0xAAE8, 0x8450, 0x0000, 0x6B98, 0xAEE8, 0xAEE0,
+  0xB0E0, 0xB0E0, 0xB0E0, 0xB1C8, 0xB0E8, 0xB1C8, 0xB1C8, 0xD1B0,
+  0xB1A8, 0xF178, 0x8B60, 0x1169, 0x1161, 0x0000, 0x0000, 0x0000,
+  0x4220, 0x9131, 0xF221, 0x1222, 0xB412, 0xD41A, 0xEE09, 0x0000,
+  0x5613, 0x560B, 0xD80B, 0xD80B, 0x990C, 0xD80B, 0x0000, 0xD80B,
+  0x9904, 0xD80B, 0xD80B, 0x5613, 0x330B, 0x0000, 0x0000, 0x0000,
+  0x531A, 0x1222, 0x1222, 0x0B19, 0x5149, 0x9131, 0x3149, 0x3149,
+  0x1161, 0xF178, 0xF190, 0xD190, 0xB1B0, 0x8B98, 0xB1C8, 0xB1D0,
+  0x8B58, 0x0000, 0x8B60, 0xB0E0, 0xB0E0, 0x6B98, 0xAEE0, 0xACE0,
+  0xACE8, 0x8458, 0xACE0, 0xC8E0, 0xA8E0, 0xC8E8, 0x280A, 0x0055,
+  0xC490, 0xC5E9, 0xC5E9, 0x45E1, 0x06E1, 0x26E1, 0xC6C0, 0xE490,
+  0x8AC8, 0xAAE8, 0x8AC8, 0x0000, 0x0000, 0x4218, 0xAEE8, 0xAEE0,
+  0xAEE0, 0xB0E0, 0x4218, 0x0000, 0xB1D0, 0xD1A8, 0x8BA0, 0xB1A8,
+  0xD190, 0xF190, 0x8B58, 0x1161, 0x0000, 0x0000, 0x0000, 0x9131,
+  0x9131, 0x9129, 0x9131, 0x531A, 0x1222, 0xEE09, 0x0000, 0x0000,
+  0x5613, 0xF80B, 0xD80B, 0x9904, 0xD80B, 0x790C, 0x0000, 0x0000,
+  0xD80B, 0x9904, 0xD80B, 0xD80B, 0x5613, 0x5613, 0x0B19, 0x0000,
+  0x0000, 0x1222, 0x1222, 0xEE09, 0x9131, 0x9131, 0x9131, 0x0000,
+  0x3149, 0x1169, 0x0000, 0xD190, 0xF190, 0xD1A8, 0xB1B0, 0xB1C8,
+  0x0000, 0x0000, 0x0000, 0xB0E0, 0xAEE8, 0xAEC8, 0x6B98, 0xAEE8,
+  0xACE0, 0xACE0, 0xAAE8, 0xAAE0, 0xE490, 0x290C, 0x0051, 0xC490,
+  0x85C1, 0x65E9, 0x08E1, 0x08E1, 0x8AC8, 0xA8E0, 0xC8E8, 0x8AC8,
+  0x8458, 0x8458, 0x8450, 0xAEE0, 0xAEE8, 0xAED0, 0x0000, 0x0000,
+  0x8B58, 0xB1C8, 0xD190, 0x0000, 0xD1B0, 0xD1A8, 0xD190, 0xD190,
+  0x4220, 0x0000, 0x0000, 0x3149, 0x9131, 0x4220, 0x4218, 0x1222,
+  0x1222, 0xB41A, 0x0000, 0x0000, 0xEE09, 0xF80B, 0xD80B, 0x790C,
+  0x7904, 0x790C, 0x7904, 0x0000, 0x0000, 0x223A, 0x7904, 0x990C,
+  0xD80B, 0x0000, 0xD412, 0x5613, 0xEE09, 0x0000, 0x0000, 0x1222,
+  0x9129, 0x9131, 0x9131, 0x3149, 0x0000, 0x1161, 0x1169, 0x0000,
+  0x0000, 0x4218, 0xD190, 0xB1C8, 0xB1C8, 0x0000, 0x0000, 0x0000,
+  0xAEC8, 0xB0E0, 0xAEE0, 0xAEE0, 0xACE8, 0xACE0, 0xAAE8, 0x6B98,
+  0x2A10, 0x0049, 0x8458, 0xE498, 0xC6C0, 0x8AC8, 0x8AC8, 0xAAE8,
+  0xAEC8, 0xACE0, 0xAEE8, 0xAEE0, 0x8450, 0xD1B0, 0x0000, 0xB1C8,
+  0xB1C8, 0xB1D0, 0x0000, 0x6B98, 0xD190, 0xF190, 0xF178, 0x1161,
+  0x4218, 0x3149, 0x0B21, 0x0000, 0x0000, 0x9131, 0x1222, 0x531A,
+  0x0000, 0x0000, 0x0000, 0xEE09, 0xF80B, 0x7904, 0xD80B, 0x9904,
+  0x790C, 0x7904, 0x0000, 0x0000, 0x0000, 0xD80B, 0xD80B, 0xF80B,
+  0x0B21, 0x0000, 0x0B21, 0xB412, 0xEE09, 0x4220, 0x1222, 0x1222,
+  0x9131, 0x9131, 0x0000, 0x0000, 0x3149, 0x1161, 0x8B60, 0x1161,
+  0x0B19, 0xD178, 0xD1B0, 0xB1D0, 0x6B98, 0xD1B0, 0x6B98, 0xAED0,
+  0x6B98, 0xAED0, 0x8450, 0x2B1A, 0x0019, 0xB0E0, 0x6BA0, 0xAEC8,
+  0xB1C8, 0xB1C8, 0xB1D0, 0xB1A8, 0x8B60, 0xD1B0, 0xD190, 0xF178,
+  0x1161, 0x1169, 0x6B60, 0x0000, 0x0000, 0x0000, 0x1222, 0x531A,
+  0x0E0A, 0x0000, 0x0000, 0x0000, 0xEE09, 0xD80B, 0x2B3C, 0x0018,
+  0x9904, 0xD80B, 0xF80B, 0x0000, 0x0000, 0x0000, 0xB41A, 0x531A,
+  0x531A, 0x9131, 0x1222, 0x0B19, 0x3149, 0x3149, 0x1169, 0x1161,
+  0xF178, 0x8B60, 0xD190, 0x4218, 0x0000, 0x0000, 0x8B60, 0x0000,
+  0x2C19, 0x0038, 0xB0E8, 0xAEE0, 0xB0E0, 0xB0E0, 0xB0E0, 0xB1C8,
+  0xB1C8, 0xD1B0, 0xB1A8, 0xD190, 0xF190, 0xF178, 0x1161, 0x3149,
+  0x3149, 0x0000, 0x0000, 0x0B19, 0x1222, 0x1222, 0x0000, 0x0000,
+  0x0000, 0x0000, 0xEE09, 0xF80B, 0x790C, 0x790C, 0x7904, 0x790C,
+  0x7904, 0x0000, 0x0000, 0x0000, 0x0000, 0x330B, 0x7904, 0xD80B,
+  0x4220, 0x0000, 0xEE09, 0x731A, 0x531A, 0x1222, 0xF221, 0x9131,
+  0x9131, 0x9131, 0x3149, 0x5149, 0x1169, 0xF178, 0xD178, 0xD190,
+  0xD1A8, 0x4218, 0x2D17, 0x0014, 0x8EC8, 0xAEE0, 0xAEE8, 0xB0E0,
+  0xB0E0, 0xB0E0, 0xB1C8, 0xB1D0, 0x8B98, 0xB1A8, 0xD1B0, 0xD190,
+  0xF178, 0xF178, 0x1161, 0x1169, 0x3149, 0x5151, 0x0B19, 0x9131,
+  0x2D32, 0x0006, 0xD80B, 0xD80B, 0x7904, 0x790C, 0x7904, 0x990C,
+  0x2D3D, 0x0015, 0xD80B, 0xF80B, 0x5613, 0x3303, 0xB41A, 0xB412,
+  0x531A, 0x531A, 0x1222, 0x9131, 0x9131, 0x3149, 0x3149, 0x1161,
+  0x1161, 0xF178, 0xF190, 0xD188, 0xD190, 0xB1D0, 0xD1B0, 0x2E15,
+  0x0017, 0x8B98, 0xACE8, 0xAEE0, 0xAEE8, 0xAEE0, 0xAEE0, 0xB0E0,
+  0xB1C8, 0xB0E0, 0xB1A8, 0x0000, 0xD1B0, 0xB1A8, 0xD190, 0xF190,
+  0x1161, 0x1161, 0x3149, 0x5149, 0x9131, 0x9131, 0x9131, 0x1222,
+  0x2E31, 0x0007, 0xEE09, 0xF80B, 0x7904, 0xD80B, 0x9904, 0x790C,
+  0x7904, 0x2E3D, 0x0017, 0x0B21, 0xD80B, 0xD80B, 0xB412, 0xB41A,
+  0x531A, 0x531A, 0x1222, 0x1222, 0x9131, 0x9131, 0x9131, 0x4218,
+  0x0B21, 0xF160, 0xF178, 0xD190, 0xD190, 0xD1B0, 0xD1A8, 0xB1C8,
+  0xB1D0, 0x6B98, 0x2F14, 0x0018, 0xACE0, 0xAAE0, 0xAEE8, 0xACE0,
+  0xAEE0, 0xAEE8, 0xB0E0, 0xB0E0, 0xB0E0, 0xB1A8, 0xD1B0, 0xB1A8,
+  0xB1D0, 0xF178, 0xD1B0, 0xD190, 0x4218, 0x1161, 0x1169, 0x3149,
+  0x3149, 0x9131, 0x1222, 0x0B21, 0x2F31, 0x0005, 0xB412, 0xF80B,
+  0xD80B, 0x790C, 0x7904, 0x2F3E, 0x0017, 0xF80B, 0x5613, 0x5613,
+  0xB412, 0xB412, 0x531A, 0x0000, 0x9131, 0x1222, 0x9131, 0x3149,
+  0x5149, 0x3149, 0x1161, 0xF178, 0xD190, 0xB1B0, 0xD1A8, 0xB1C8,
+  0xB1C8, 0xB0E8, 0xB1C8, 0xB0E0, 0x3013, 0x0019, 0xAAE8, 0xAAE8,
+  0xACE0, 0xACE0, 0xAEE0, 0xAEE8, 0xAEE0, 0xAEE0, 0xAEC8, 0xB0E0,
+  0xB0E0, 0xB1C8, 0xB1B0, 0xD1A8, 0xD178, 0xD190, 0xF190, 0x0000,
+  0x1161, 0x3149, 0x5149, 0x9131, 0x3149, 0x9131, 0x9129, 0x3031,
+  0x0005, 0x330B, 0x560B, 0xF80B, 0xF80B, 0x790C, 0x303E, 0x0019,
+  0x560B, 0x5613, 0xB41A, 0xB412, 0x1222, 0xF221, 0x0000, 0x9131,
+  0x9131, 0x9131, 0x9131, 0x3149, 0x5149, 0x1161, 0xF178, 0xD190,
+  0xD190, 0xD1B0, 0xD1A8, 0xB1D0, 0xB1C8, 0xB0E0, 0xB0E0, 0xB0E0,
+  0x4218, 0x3111, 0x001C, 0xC6C0, 0xA8E8, 0xC8E0, 0xACE0, 0xAAE0,
+  0xACE8, 0xACE0, 0xAEE0, 0xAEE8, 0xB0E0, 0xB1C8, 0xB0E0, 0xB1C8,
+  0xB1D0, 0xB1A8, 0xB1D0, 0x8B58, 0xD1B0, 0xF190, 0xD190, 0x1161,
+  0x1169, 0x3149, 0x3149, 0x0B19, 0x9131, 0x9131, 0x1222, 0x3132,
+  0x0026, 0x5613, 0x560B, 0xF80B, 0xD80B, 0x790C, 0xD80B, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x4232, 0x5613, 0x5613, 0x531A, 0x330B,
+  0xB412, 0x531A, 0x1222, 0x9129, 0x9131, 0x9131, 0x9131, 0x5149,
+  0x3149, 0x1161, 0x1161, 0xF190, 0xD190, 0xD178, 0xD1A8, 0xD178,
+  0xD1B0, 0xB1C8, 0xB1C8, 0xB0E0, 0xB0E0, 0xB0E0, 0x6BA0, 0x3210,
+  0x0027, 0xC6C0, 0xE7E0, 0xC8E0, 0xAAE0, 0xAAE8, 0xACE0, 0xACE0,
+  0xAEE0, 0xACE8, 0xAEE0, 0x8450, 0x8458, 0xB0E8, 0xB0E0, 0x0000,
+  0xB1C8, 0xB1A8, 0xD190, 0xF190, 0xD188, 0xF178, 0xF178, 0x1161,
+  0x1161, 0x0000, 0x0000, 0x0B21, 0x9131, 0x9129, 0x0B21, 0x0000,
+  0x0000, 0x0000, 0xB412, 0xB412, 0x5613, 0x5613, 0xD80B, 0xF80B,
+  0x323C, 0x001D, 0x5613, 0x560B, 0xB41A, 0x0000, 0x0000, 0x531A,
+  0x1222, 0x1222, 0x9131, 0x9131, 0x9131, 0x3149, 0x3149, 0x1161,
+  0x0B21, 0x0000, 0xF178, 0xD190, 0x0000, 0xD190, 0xD1A8, 0xB1D0,
+  0xB1C8, 0xB0E0, 0xB0E0, 0xB0E0, 0xAEE8, 0xAEE0, 0xAEC8, 0x330F,
+  0x004B, 0x06E9, 0x06E1, 0xE7E0, 0x08E1, 0xC8E0, 0xAAE8, 0xAAE0,
+  0xACE0, 0xACE0, 0xAEE8, 0xAEE0, 0xB0E0, 0xB1C8, 0xB0E0, 0xB0E8,
+  0x8EC8, 0xB1C8, 0xB1C8, 0xD1B0, 0xD1A8, 0xD190, 0xD190, 0xF178,
+  0xD178, 0x1169, 0x0B19, 0x0000, 0x0000, 0x9131, 0x1222, 0x9131,
+  0x0000, 0x0000, 0x0000, 0xB41A, 0x5613, 0x560B, 0x5613, 0x5613,
+  0xD80B, 0x5613, 0x0000, 0x0000, 0x0000, 0xEE09, 0x5613, 0xB412,
+  0x0000, 0x0000, 0x0000, 0x1222, 0x531A, 0x1222, 0x1222, 0x9131,
+  0x3149, 0x5149, 0x1161, 0x1161, 0x8B60, 0x1161, 0xD190, 0xD178,
+  0xF178, 0xB1A8, 0xB1C8, 0xB1C8, 0xB0E0, 0xB0E0, 0xB0E0, 0xB0E0,
+  0xB0E0, 0xAEE0, 0xAEE8, 0xACE0, 0x340E, 0x004D, 0x27D1, 0x26E1,
+  0xE7E0, 0xE7E8, 0xC8E0, 0xA8E0, 0xC8E0, 0xACE8, 0x8EC8, 0xACE0,
+  0xACE0, 0xAEE8, 0xAEE0, 0xB0E0, 0xB0E0, 0xB0E0, 0xB1C8, 0xB1C8,
+  0xD1A8, 0xB1B0, 0xD190, 0xF188, 0xD190, 0xF178, 0x1161, 0x1161,
+  0x3149, 0x0000, 0x0000, 0x0000, 0x9131, 0x1222, 0x4218, 0x0000,
+  0x1222, 0x531A, 0x531A, 0xB41A, 0xB412, 0x5613, 0xB41A, 0x3303,
+  0xB41A, 0x0000, 0x0000, 0x5613, 0xB412, 0xEE09, 0x0000, 0x0000,
+  0xEE09, 0x1222, 0x9131, 0x9131, 0x9131, 0x9131, 0x9131, 0x3149,
+  0x5149, 0x1169, 0x1161, 0xF178, 0xD190, 0xD1B0, 0xD188, 0xD1B0,
+  0xB1A8, 0xB1D0, 0xB1C8, 0xB0E0, 0xB0E0, 0xB0E0, 0xAEE8, 0xAEE0,
+  0xACE0, 0xACE0, 0xAEC8, 0x350D, 0x004F, 0x65E1, 0x65E9, 0x06E1,
+  0x06E1, 0xE7E0, 0xE7E8, 0xC8E0, 0xAAE8, 0x6B98, 0x0000, 0xAEC8,
+  0xAEE0, 0xAEE0, 0xAEE8, 0xAEE0, 0xB0E0, 0xAEE8, 0xB1C8, 0xB1C8,
+  0xB1C8, 0xB1B0, 0xD1B0, 0xD190, 0x0000, 0x1161, 0xF178, 0x1161,
+  0x1169, 0x3149, 0x0000, 0x0000, 0x9129, 0x9131, 0x9131, 0x4220,
+  0x1222, 0x0000, 0xB412, 0x531A, 0xB41A, 0xB412, 0x5613, 0x0000,
+  0x330B, 0x0000, 0xEE09, 0xB41A, 0xB412, 0x0000, 0x0000, 0x0B19,
+  0x531A, 0x1222, 0x1222, 0x9131, 0x0000, 0x9131, 0x3149, 0x3149,
+  0x1161, 0x1161, 0xF178, 0xF178, 0xD190, 0xD190, 0xD1A8, 0xB1B0,
+  0xB1C8, 0xB1D0, 0x8B98, 0x4218, 0xB0E0, 0xB0E0, 0xAEE0, 0xAEE8,
+  0xAEE0, 0xACE0, 0xACE8, 0x8AC8, 0x360C, 0x0051, 0xC490, 0xC5E9,
+  0x65E1, 0x45E9, 0x08E1, 0xE7E0, 0xC8E0, 0xA8E0, 0xC8E8, 0xAAE0,
+  0x0000, 0x0000, 0xACE0, 0xACE0, 0x0000, 0x0000, 0x6B98, 0xB0E8,
+  0xB1C8, 0xB0E0, 0xB1C8, 0xB1C8, 0xD1B0, 0x8B58, 0x0000, 0x0000,
+  0x1161, 0x8B60, 0x0000, 0x1161, 0x3149, 0x0000, 0x0000, 0x9131,
+  0x9131, 0x1222, 0x0B19, 0x0000, 0x1222, 0x531A, 0x531A, 0xB41A,
+  0x531A, 0x0000, 0xEE09, 0xEE09, 0x531A, 0xB41A, 0x0B19, 0x0000,
+  0x0B21, 0x1222, 0x0B21, 0x0000, 0x9131, 0x4218, 0x0000, 0x0000,
+  0x3149, 0x1169, 0x1161, 0xF178, 0xD178, 0xD190, 0x8B60, 0x0000,
+  0x4218, 0xD1B0, 0xB1D0, 0x4218, 0x0000, 0xAED0, 0xAEE0, 0xB0E0,
+  0xAEE8, 0xAEE0, 0xACE0, 0xACE0, 0xAAE8, 0xAAE0, 0xC490, 0x370C,
+  0x0051, 0x85EA, 0xC5E9, 0xC5E9, 0x45E9, 0x65E1, 0xE7E0, 0x08E1,
+  0xA8E0, 0xAAE8, 0xAAE0, 0x8BA0, 0x8450, 0xAEE8, 0x8EC8, 0x0000,
+  0x0000, 0xAEC8, 0xB0E0, 0xB0E0, 0xB0E0, 0xB0E0, 0xB1D0, 0xB1D0,
+  0x4218, 0x0000, 0x0000, 0x8B60, 0xF178, 0x0000, 0x0000, 0x1161,
+  0x3149, 0x0000, 0x9131, 0x3149, 0x9131, 0x0000, 0x0000, 0x1222,
+  0xF221, 0x531A, 0x1222, 0x531A, 0x0000, 0x0B21, 0x531A, 0xB41A,
+  0x531A, 0x4218, 0x0B21, 0x1222, 0x0B19, 0x0000, 0x9131, 0x3149,
+  0x0000, 0x0000, 0x0000, 0x1161, 0x1161, 0xF178, 0xF178, 0xD190,
+  0xD190, 0xD1A8, 0x0000, 0x0000, 0xD190, 0xB0E0, 0x8B98, 0x0000,
+  0xB0E0, 0xB0E0, 0xAEE0, 0xAEE0, 0xAEE8, 0xAEE0, 0xACE0, 0x08E1,
+  0xAAE0, 0xAAE8, 0x380B, 0x0053, 0x8450, 0xC5E9, 0xC5E9, 0x45E1,
+  0x65E9, 0x06E1, 0x06E1, 0xC8E0, 0xC8E8, 0xA8E0, 0xAAE0, 0xAAE0,
+  0x8AC8, 0xACE8, 0xAEE0, 0x0000, 0x0000, 0xAEE0, 0xB0E0, 0xB0E0,
+  0xB0E0, 0xAEC8, 0x4218, 0xD1B0, 0x8B60, 0x0000, 0x0000, 0x0000,
+  0xD178, 0x1161, 0x0000, 0x0000, 0x3149, 0x5149, 0x3149, 0x9131,
+  0x9131, 0x0000, 0x0000, 0x9131, 0x1222, 0x9129, 0x1222, 0x1222,
+  0x0000, 0x0000, 0xF221, 0x1222, 0x1222, 0x9131, 0xF221, 0x0B19,
+  0x0000, 0x0000, 0x9131, 0x4220, 0x0000, 0x0000, 0x0000, 0x3149,
+  0x5149, 0x4220, 0xD190, 0xF190, 0xD190, 0xD1A8, 0x8BA0, 0x0000,
+  0xB1C8, 0xB1C8, 0x8EC8, 0xAED0, 0xB0E0, 0xAEE0, 0xAEE8, 0xACE0,
+  0xAEE0, 0xACE0, 0xACE8, 0xAAE0, 0xAAE0, 0xA8E0, 0x8458, 0x390B,
+  0x0052, 0x6450, 0x85EA, 0xC5E9, 0xC5E9, 0x65E1, 0x65E9, 0x06E1,
+  0x08E1, 0xA8E0, 0xC6C0, 0xC8E0, 0xAAE8, 0xAAE0, 0xAAE8, 0xACE8,
+  0x4218, 0x6B98, 0xB0E0, 0xB0E0, 0xB0E0, 0xB0E0, 0xB0E0, 0xB1C8,
+  0xB1D0, 0xD1B0, 0xF178, 0xD190, 0xD178, 0xF178, 0xF190, 0x0B19,
+  0x0000, 0x0000, 0x3151, 0x3149, 0x3149, 0x0B19, 0x0000, 0x0000,
+  0x9131, 0x9131, 0x1222, 0x9131, 0x1222, 0x0000, 0x0000, 0xEE09,
+  0x1222, 0x9131, 0x1222, 0x0000, 0x0000, 0x0000, 0x3149, 0x9131,
+  0x0B21, 0x0B19, 0x8B60, 0x0B19, 0x1161, 0x1161, 0xF190, 0xD190,
+  0xD1A8, 0xD190, 0xB1B0, 0xD1A8, 0x8B60, 0xB1C8, 0xB1D0, 0x6B98,
+  0xB0E0, 0xB0E0, 0xB1C8, 0xAEE0, 0xAEE0, 0xACE0, 0xACE8, 0xAAE0,
+  0xAAE0, 0xC8E0, 0xAAE8, 0x3A0B, 0x0052, 0x8458, 0x85F2, 0x85F2,
+  0xC5E9, 0xC5E9, 0x06E1, 0x06E1, 0xE7E0, 0xE7E0, 0x8458, 0x0000,
+  0xC8E8, 0xACE0, 0xAAE0, 0xACE0, 0xACE8, 0xAEE0, 0xAEE0, 0xB0E0,
+  0x6B98, 0x0000, 0xB1C8, 0xB0E8, 0xD1A8, 0xD178, 0x8B58, 0xF178,
+  0x6BA0, 0xD190, 0xF178, 0xF178, 0x1161, 0x0B19, 0x0000, 0x1161,
+  0x3149, 0x4220, 0x0000, 0x0000, 0x9131, 0x9131, 0x9129, 0x9131,
+  0x9131, 0x0000, 0x0000, 0x0000, 0x9131, 0x9129, 0x4220, 0x0000,
+  0x0B19, 0x3149, 0x9131, 0x5149, 0x3151, 0x5149, 0x8B60, 0x1161,
+  0x1169, 0xF178, 0xD178, 0x4218, 0x0000, 0xD1B0, 0xB1B0, 0xB1C8,
+  0xB1C8, 0xB0E8, 0xB1C8, 0xB0E0, 0xB0E0, 0x8B98, 0x0000, 0x8EC8,
+  0xACE8, 0xACE0, 0xAAE8, 0xAAE0, 0xC8E0, 0xAAE0, 0xA8E8, 0x3B0C,
+  0x0015, 0x85EA, 0xC5E9, 0x85F2, 0xA6E1, 0x65E9, 0x26E1, 0x06E9,
+  0xC490, 0xC6C0, 0xC8E0, 0xAAE0, 0xAAE0, 0xACE8, 0xACE0, 0xAEE0,
+  0xAEE0, 0xAEE8, 0xAEE0, 0x6BA0, 0xB1C8, 0xAEC8, 0x3B27, 0x001B,
+  0xF178, 0xD190, 0xF178, 0xD190, 0xD178, 0xF178, 0x1161, 0x1169,
+  0x0000, 0x0000, 0x0000, 0x5149, 0x9131, 0x3149, 0x9131, 0x5149,
+  0x0000, 0x0000, 0x0000, 0x3149, 0x9131, 0x5149, 0x9131, 0x3151,
+  0x0B19, 0x5151, 0x3149, 0x3B47, 0x0016, 0x0B19, 0xD178, 0x8B60,
+  0x4218, 0xD1B0, 0xB1C8, 0xB1C8, 0xB0E0, 0xB0E0, 0xB0E0, 0xB0E0,
+  0xB0E0, 0xB1C8, 0x6BA0, 0x8450, 0xAEE0, 0xACE8, 0xACE0, 0xAAE0,
+  0xAAE0, 0xC8E8, 0x08E1, 0x3C0C, 0x0014, 0x65EA, 0x85F2, 0xC5E9,
+  0xC5E9, 0x45E1, 0x45E1, 0x08E1, 0xE7E0, 0xC6C0, 0xC8E0, 0xA8E0,
+  0xAAE8, 0xAAE0, 0xACE0, 0xACE0, 0xAEE8, 0xAEC8, 0xAEE0, 0xAEE0,
+  0x8EC8, 0x3C27, 0x001B, 0xD1B0, 0xD188, 0x0000, 0x0000, 0x4218,
+  0x1169, 0xF178, 0x8B60, 0x0000, 0x0000, 0x0000, 0x3149, 0x3149,
+  0x9131, 0x5149, 0x9131, 0x0000, 0x0000, 0x0000, 0x0B19, 0x3149,
+  0x9131, 0x0B21, 0x0000, 0x0000, 0x5149, 0x1169, 0x3C49, 0x0014,
+  0x8B60, 0xD1A8, 0xB1D0, 0xB1A8, 0xB1C8, 0xB1D0, 0xB0E0, 0xB0E0,
+  0xB0E0, 0xAEE0, 0xAEE8, 0xAEE0, 0x8AC8, 0xACE0, 0xACE0, 0xAAE8,
+  0xAAE0, 0xC8E0, 0xC8E0, 0xA8E8, 0x3D0C, 0x0016, 0x65F3, 0x85EA,
+  0x85EA, 0xC5E9, 0xC5E9, 0x45E9, 0x65E1, 0xE7E0, 0x08E1, 0xA8E0,
+  0xAAE8, 0xC6C0, 0xACE0, 0xAAE0, 0xACE0, 0xACE8, 0xACE0, 0xAEC8,
+  0xB0E0, 0xAEE8, 0x6BA0, 0x4218, 0x3D27, 0x001B, 0xD1A8, 0xD1B0,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x8B60, 0x8B60, 0x0000, 0x0000,
+  0x0000, 0x1161, 0x3149, 0x1169, 0x5149, 0x3151, 0x0000, 0x0000,
+  0x0000, 0x5149, 0x3149, 0x0000, 0x0000, 0x0000, 0x0000, 0x1161,
+  0x1169, 0x3D47, 0x0016, 0x4218, 0xB1B0, 0xD1A8, 0xB1C8, 0xB1B0,
+  0xF178, 0xB1C8, 0xB0E0, 0xB0E0, 0xB0E0, 0xAEE0, 0xB0E0, 0xAEE0,
+  0xAEE0, 0xACE8, 0xACE0, 0xAAE0, 0xACE0, 0xAAE8, 0xA8E0, 0xC8E0,
+  0x27D1, 0x3E0C, 0x0051, 0x64CA, 0x65F2, 0xC5E9, 0xC5E9, 0x45E1,
+  0x65E1, 0x06E1, 0x06E1, 0xE7E8, 0xE7E0, 0xAAC8, 0x0000, 0x8AC8,
+  0xAAE0, 0xAAE0, 0xACE8, 0xACE0, 0xAEE0, 0x0000, 0xAEC8, 0xB1C8,
+  0xB0E0, 0xB0E0, 0xB0E0, 0xB1C8, 0xB1D0, 0xB1C8, 0xB1C8, 0x8B98,
+  0x0000, 0x0000, 0x0000, 0x8B60, 0xD190, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x8B60, 0x1161, 0x3149, 0x1161, 0x8B60, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x1161, 0x0B19, 0x0000, 0x0000, 0x0000, 0x1169,
+  0xF178, 0xF178, 0xD190, 0xD190, 0xF190, 0xD190, 0xD1A8, 0xD1B0,
+  0xB1A8, 0x0000, 0xD190, 0xB1C8, 0xB0E0, 0xB0E0, 0xB0E0, 0xAEC8,
+  0x0000, 0x8BA0, 0xAEE0, 0xACE8, 0xACE0, 0xAAE0, 0xACE0, 0xA8E8,
+  0xAAE0, 0xC8E0, 0xE7E0, 0xC490, 0x3F0C, 0x0022, 0x64CA, 0x65EA,
+  0x85F2, 0xC5E9, 0xC5E9, 0x65E1, 0x65E1, 0x06E1, 0x06E9, 0xE7E0,
+  0x08E1, 0xC8E0, 0xAAE0, 0xAAE8, 0xACE0, 0xACE8, 0xAEE8, 0x4218,
+  0x0000, 0x0000, 0x0000, 0x8B58, 0xB1D0, 0x8EC8, 0xAEC8, 0xB1C8,
+  0xB0E0, 0xB1D0, 0xB1B0, 0x0000, 0x0000, 0x4218, 0xD1B0, 0xD190,
+  0x3F33, 0x0003, 0xF178, 0xD178, 0x1161, 0x3F3B, 0x000C, 0x1161,
+  0xF178, 0x4218, 0x0000, 0x0000, 0xD178, 0xF178, 0xF190, 0xD190,
+  0xB1B0, 0xF178, 0xD178, 0x3F4C, 0x0011, 0xB0E0, 0xB0E0, 0xB0E0,
+  0xB0E0, 0xB0E0, 0xAEE0, 0xAEE0, 0xAEE0, 0xAEE8, 0xACE0, 0xACE0,
+  0xAAE0, 0xAAE8, 0xC8E0, 0x08E1, 0xE7E8, 0x8458, 0x400C, 0x0011,
+  0xC490, 0x65FB, 0x85EA, 0x85F2, 0xC5E9, 0xC5E9, 0x45E1, 0x45E1,
+  0x06E1, 0xE7E0, 0xC8E0, 0xC8E8, 0xA8E0, 0xAAE0, 0xAAE0, 0xACE8,
+  0x8AC8, 0x4025, 0x0009, 0x8B98, 0x8B98, 0xB1C8, 0xB1B0, 0x0000,
+  0x8B58, 0xD1B0, 0xB1B0, 0x8B58, 0x4033, 0x0003, 0x0B19, 0x8B60,
+  0x4220, 0x403B, 0x0009, 0x8B60, 0xF178, 0xD178, 0x4218, 0x0000,
+  0xF178, 0xD190, 0xD190, 0x8B60, 0x404C, 0x0011, 0x8B98, 0xB0E8,
+  0xAEE0, 0xB0E0, 0xAEE8, 0xAEE0, 0xACE0, 0xACE0, 0xACE8, 0xACE0,
+  0xAAE0, 0xAAE0, 0xC8E8, 0xA8E0, 0xC8E0, 0xE7E0, 0x8458, 0x410C,
+  0x0010, 0x4232, 0x65FB, 0x65F3, 0x85EA, 0x85EA, 0xC5E9, 0xC5E9,
+  0x06E9, 0x06E1, 0x08E1, 0xE7E0, 0xC8E0, 0xAAE8, 0xA8E0, 0xAAE8,
+  0xAAE8, 0x4124, 0x0009, 0xAEC8, 0xB1B0, 0x8B98, 0xB1C8, 0xB1C8,
+  0xB1B0, 0xB1C8, 0xD1B0, 0xB1C8, 0x413C, 0x0007, 0xF190, 0xD188,
+  0xD190, 0xF178, 0xD1B0, 0xD188, 0xD190, 0x414D, 0x0010, 0xB0E0,
+  0xB0E0, 0xAEE0, 0xAEE0, 0xAEE0, 0xAEE8, 0xACE0, 0xACE0, 0xAAE0,
+  0xAAE8, 0xC8E0, 0xAAE0, 0xA8E0, 0xE7E8, 0xE7E8, 0x4218, 0x420D,
+  0x0020, 0x65F3, 0x65F2, 0x85F2, 0xC5E9, 0xC5E1, 0xC490, 0x0000,
+  0x0000, 0x06E9, 0xC6C0, 0x0000, 0x0000, 0xC6C0, 0xC8E0, 0xAAE0,
+  0x8EC8, 0xACE8, 0xACE0, 0xAEC8, 0x6B98, 0x8458, 0x0000, 0x0000,
+  0x8B98, 0xB1D0, 0xB0E0, 0xB0E0, 0xB1C8, 0xB1C8, 0xB1D0, 0xB1C8,
+  0x6B98, 0x423C, 0x0008, 0x8B60, 0xD190, 0xF190, 0xD1A8, 0xB1B0,
+  0xD1A8, 0xD190, 0x8458, 0x4249, 0x0013, 0x8BA0, 0x8EC8, 0xAEE8,
+  0xD1A8, 0xB0E0, 0xAEE8, 0x8EC8, 0x4218, 0x0000, 0x8B60, 0xACE8,
+  0x8B58, 0x0000, 0x8B98, 0xA8E8, 0xC8E0, 0xE7E8, 0xE7E0, 0x06E1,
+  0x430D, 0x0020, 0x65F3, 0x65F3, 0x85F2, 0x85EA, 0xC5E9, 0x0000,
+  0x0000, 0x0000, 0x06E1, 0x06E9, 0x8458, 0xC6C0, 0xC8E0, 0xAAE0,
+  0xAAE0, 0xACE8, 0xAAE0, 0xACE0, 0xACE0, 0xAEE8, 0xAEE0, 0xAEE0,
+  0xAEE8, 0xB0E0, 0xB0E0, 0xB0E0, 0xB0E0, 0xB0E0, 0xB1C8, 0xB1C8,
+  0xB1B0, 0xD1B0, 0x433C, 0x0020, 0xD178, 0x4218, 0xD1B0, 0xB1A8,
+  0xB1C8, 0xD1B0, 0xB1C8, 0xB1C8, 0xB1D0, 0x8EC8, 0xB1C8, 0xB0E0,
+  0xB0E0, 0xB0E0, 0xB0E0, 0xB0E0, 0xB0E0, 0xAEE0, 0xAEE0, 0xAEE8,
+  0x8B98, 0x0000, 0x8EC8, 0xAAE8, 0x8B98, 0x0000, 0x0000, 0xC6C0,
+  0xE7E0, 0xE7E0, 0x26E9, 0x06E1, 0x440D, 0x0020, 0x65F3, 0x65FB,
+  0x65F3, 0x85F2, 0xA6E1, 0x0000, 0x0000, 0x0000, 0x65C1, 0x06E1,
+  0x26E1, 0xE7E8, 0xE7E0, 0xC8E0, 0xA8E0, 0xC8E8, 0xAAE0, 0xAAE0,
+  0xACE0, 0xACE8, 0xAEE0, 0xACE0, 0xAEE0, 0xAEE8, 0xB0E0, 0xAEE0,
+  0xB0E0, 0xB0E0, 0xB0E0, 0x8B58, 0xB1C8, 0x4218, 0x443C, 0x0020,
+  0x8B60, 0xB1B0, 0x0000, 0xB1D0, 0xD1A8, 0xB1C8, 0xB1D0, 0xB1C8,
+  0xB1C8, 0xB0E0, 0xB1C8, 0xB0E8, 0xB0E0, 0xB0E0, 0xAEE0, 0xB0E0,
+  0xAEE0, 0xAEE8, 0xACE0, 0xAEE0, 0xACE0, 0xACE8, 0xAAE0, 0xAAE0,
+  0x0000, 0x0000, 0x0000, 0x4218, 0xE7E8, 0x06E1, 0x06E9, 0xC6C0,
+  0x450D, 0x001F, 0xA39A, 0x85FC, 0x65F3, 0x65FB, 0x65C1, 0x0000,
+  0x0000, 0x0000, 0x8450, 0x65E9, 0x26E1, 0x06E1, 0xE7E0, 0xE7E8,
+  0xC498, 0xE490, 0xAAE0, 0xACE0, 0xAAE0, 0xACE8, 0xACE0, 0xAEE0,
+  0xAEE0, 0xAEE8, 0xAEE0, 0xB0E0, 0xAEE0, 0xB0E8, 0x6B98, 0xB1C8,
+  0xB0E0, 0x453D, 0x001F, 0xB1D0, 0x8B98, 0x8B60, 0xB1C8, 0xB1C8,
+  0xB0E0, 0xB1C8, 0xB0E0, 0xB0E0, 0xB0E0, 0xB0E0, 0xB0E0, 0xB0E0,
+  0xB0E0, 0xAEE0, 0xAEE8, 0xAEC8, 0xAEE0, 0xACE0, 0xACE8, 0xAAE0,
+  0xACE0, 0xC6C0, 0x0000, 0x0000, 0x0000, 0x0000, 0x06E1, 0x06E9,
+  0x65E1, 0xE490, 0x460D, 0x001F, 0x8450, 0x65FB, 0x65FB, 0x85EA,
+  0x65C1, 0x0000, 0x0000, 0x0000, 0x06E9, 0x65E1, 0x65E1, 0x08E1,
+  0xC490, 0x0000, 0x0000, 0x8B98, 0xAAE8, 0xA8E8, 0xAAE0, 0xAAE0,
+  0xACE0, 0xAEC8, 0xAEE8, 0xACE0, 0xAEE0, 0xAEE8, 0xB0E0, 0xAEE0,
+  0x0000, 0xB1C8, 0x8EC8, 0x463D, 0x001E, 0xD1A8, 0xB1B0, 0x0000,
+  0xB1C8, 0xB0E0, 0xB1C8, 0xB0E8, 0xB0E0, 0xB0E0, 0xAEC8, 0xB0E0,
+  0xAEE0, 0xAEE8, 0xAEE0, 0xAEE0, 0x8EC8, 0x0000, 0x0000, 0x8B98,
+  0xAAE8, 0xAAE0, 0xA8E8, 0xAAE0, 0x0000, 0x0000, 0x0000, 0x8450,
+  0x08E1, 0x65E9, 0x45E1, 0x470E, 0x001E, 0x85FC, 0x65F3, 0x65FB,
+  0xE490, 0x0000, 0x0000, 0x0000, 0xA6E1, 0xC5E9, 0x65E1, 0x06E9,
+  0x0000, 0x0000, 0xC490, 0xE7E0, 0xC8E0, 0xAAE8, 0xC498, 0xE490,
+  0xAAE0, 0xACE0, 0xACE0, 0xAEE8, 0x0000, 0x8EC8, 0xAEE0, 0xAEE8,
+  0x8B98, 0xB0E8, 0x4220, 0x473D, 0x001E, 0x4218, 0xB0E8, 0x4218,
+  0x6B98, 0xB0E0, 0xB1C8, 0x4218, 0xB0E0, 0xB0E0, 0xB0E0, 0xAEE8,
+  0xAEC8, 0x6B98, 0xAEE8, 0xAEE0, 0xAEE8, 0x8B98, 0x0000, 0x0000,
+  0x6B98, 0xAAE0, 0xAAE8, 0xC8E8, 0x0000, 0x0000, 0x0000, 0x4218,
+  0x45E1, 0x65E9, 0xC5E9, 0x480E, 0x001D, 0x84CB, 0x85F4, 0x65F3,
+  0xA39A, 0x0000, 0x0000, 0x0000, 0xA6E9, 0x65E1, 0x45E1, 0x06E9,
+  0xE490, 0x8450, 0xE7E8, 0xC8E8, 0xA8E0, 0x8B98, 0x0000, 0x8AC8,
+  0xAAE8, 0xAAE0, 0x8450, 0x0000, 0x8BA0, 0xACE0, 0xAEE8, 0xAEE0,
+  0xAEE0, 0x8EC8, 0x483E, 0x001D, 0xB1C8, 0xB0E0, 0xAEE8, 0xB0E0,
+  0xAEE0, 0x8B58, 0x0000, 0x8B60, 0xAEE8, 0xAEE0, 0xAEC8, 0x0000,
+  0x6B98, 0xACE8, 0xACE0, 0xACE8, 0x4218, 0xE490, 0xA8E8, 0xAAE0,
+  0xC8E8, 0xA8E0, 0x0000, 0x0000, 0x0000, 0xE490, 0x27D1, 0x45E9,
+  0x85C1, 0x490E, 0x001D, 0x84CB, 0x85FC, 0x64CA, 0xC39A, 0xE490,
+  0x0000, 0x0000, 0x0000, 0xC5E9, 0xA6E1, 0x65E1, 0x06E9, 0x65E1,
+  0x06E1, 0x06E9, 0xE498, 0x0000, 0x8450, 0xAAE0, 0xAAE8, 0x0000,
+  0x0000, 0x8EC8, 0xACE0, 0xACE0, 0xACE8, 0x8B98, 0xAEE8, 0x6B98,
+  0x493E, 0x001D, 0x8B98, 0xB0E0, 0xB1C8, 0xAEE8, 0xB0E0, 0xAEE0,
+  0x6B98, 0x0000, 0x0000, 0xAEE8, 0xAEE8, 0x4218, 0x0000, 0xE490,
+  0xACE0, 0xAAE8, 0xAAE0, 0x8AC8, 0xC8E0, 0xA8E0, 0xE7E8, 0xE498,
+  0x0000, 0x0000, 0x0000, 0xC490, 0x65E1, 0xC5E9, 0x65C1, 0x4A0E,
+  0x001C, 0x6450, 0x85FD, 0x65FB, 0x8450, 0x64CA, 0x0000, 0x0000,
+  0x0000, 0x65C9, 0xC5E9, 0x65E1, 0x45E9, 0x06E1, 0x26E1, 0xE490,
+  0xC6C0, 0xA8E8, 0xE7E0, 0xC8E0, 0xA8E8, 0x8B98, 0xAAE0, 0xAAE8,
+  0xACE0, 0x8450, 0x0000, 0xACE8, 0xACE0, 0x4A3F, 0x001C, 0xB0E0,
+  0xAEE8, 0x0000, 0x8B58, 0xAEE8, 0xAEE0, 0xACE0, 0x0000, 0xAEE0,
+  0xACE8, 0xACE0, 0x8EC8, 0x0000, 0x8450, 0xAAE8, 0xC8E8, 0xA8E0,
+  0xC8E0, 0xE7E0, 0xA8E8, 0x0000, 0x0000, 0x0000, 0xE490, 0xC490,
+  0x85C1, 0xC5E9, 0x4218, 0x4B0F, 0x001B, 0x65FD, 0x85FD, 0x8450,
+  0xA39A, 0x65F3, 0x85F2, 0x0000, 0x85EA, 0xC5E9, 0xC5E9, 0xA6E1,
+  0xC5E9, 0x65E1, 0x65E9, 0x06E1, 0x26E1, 0xE7E0, 0x0000, 0x8AC8,
+  0xAAE8, 0xC8E0, 0x8AC8, 0x0000, 0x0000, 0xAAE0, 0xACE8, 0x8458,
+  0x4B40, 0x001A, 0xAEE8, 0xAEE0, 0x0000, 0x0000, 0xAAE0, 0xACE0,
+  0xAEE8, 0xACE8, 0x8450, 0x8AC8, 0x08E1, 0xAAE0, 0xAAE0, 0xC8E8,
+  0xAAE0, 0xA8E0, 0xE7E0, 0xE7E8, 0x08E1, 0x0000, 0x8458, 0xE498,
+  0x65C1, 0x4218, 0xC5E9, 0xC5F1, 0x4C0F, 0x001A, 0x85FC, 0x65FC,
+  0x65F3, 0x0000, 0xA39A, 0x85F2, 0x65F3, 0x85EA, 0x6450, 0x0000,
+  0xE498, 0x0000, 0x45E9, 0x65E1, 0x45E1, 0xC6C0, 0x0000, 0x0000,
+  0x8AC8, 0xC8E8, 0x8450, 0x0000, 0x8458, 0xC8E8, 0xAAE0, 0x6B98,
+  0x4C40, 0x001A, 0x8B98, 0xAEE8, 0xACE8, 0x0000, 0x0000, 0x8450,
+  0xAAE8, 0xAAE0, 0x0000, 0x0000, 0x8AC8, 0xAAE0, 0xC8E8, 0xA8E0,
+  0x8450, 0x8458, 0x0000, 0x4218, 0x08E9, 0x06E9, 0xC6C0, 0xE490,
+  0x0000, 0x8458, 0xC5E9, 0x64CA, 0x4D0F, 0x001A, 0xA39A, 0x65FD,
+  0x85FC, 0x0000, 0x0000, 0xC39A, 0x65F3, 0xA39A, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x65E1, 0xC5E9, 0x65E1, 0x0000, 0x0000, 0x06E9,
+  0xE7E8, 0x0000, 0x0000, 0x4218, 0xA8E0, 0xAAE0, 0xC8E0, 0xAAC8,
+  0x4D40, 0x001A, 0xACE8, 0xACE0, 0x8AC8, 0xACE8, 0x8450, 0x0000,
+  0x0000, 0xAAE0, 0xACE8, 0x0000, 0x0000, 0xA8E0, 0xE7E0, 0xC8E8,
+  0x0000, 0x0000, 0x0000, 0x0000, 0xC490, 0x65E9, 0x65C1, 0x0000,
+  0x0000, 0xC490, 0x85F2, 0xE490, 0x4E10, 0x0018, 0x85FD, 0x85FD,
+  0x0000, 0x65F4, 0x65F3, 0xC490, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x85C9, 0xC5E9, 0x45E1, 0xE490, 0x0000, 0x45E9, 0xC6C0, 0x0000,
+  0x0000, 0x0000, 0x8AC8, 0xC8E0, 0xC8E0, 0xA8E8, 0x4E40, 0x0019,
+  0x0000, 0xACE0, 0xAAE0, 0x8AC8, 0xAEC8, 0x4218, 0x0000, 0x0000,
+  0xC8E8, 0xA8E8, 0x0000, 0x8450, 0xC8E8, 0xE7E0, 0xC6C0, 0x0000,
+  0x0000, 0x0000, 0x0000, 0xC490, 0x65E9, 0x65C1, 0x0000, 0x85F2,
+  0x85EA, 0x4F10, 0x0018, 0x65FD, 0x85FD, 0x65FD, 0x85FC, 0x85FC,
+  0x6450, 0x0000, 0x0000, 0x0000, 0x0000, 0x85EA, 0x65F2, 0x85F2,
+  0x8450, 0xC5E9, 0x65E1, 0x0000, 0x0000, 0x0000, 0xE7E8, 0x26E1,
+  0xE7E0, 0x08E1, 0xC6C0, 0x4F41, 0x0018, 0x8AC8, 0x08E1, 0xAAE0,
+  0xAAE8, 0xA8E0, 0x0000, 0x0000, 0x0000, 0xC8E0, 0x08E1, 0x0000,
+  0x08E1, 0xE7E0, 0x45E9, 0xC490, 0x0000, 0x0000, 0x0000, 0x0000,
+  0xC5E1, 0xC5E9, 0x85F2, 0x65F2, 0x65F3, 0x5010, 0x0017, 0xA39A,
+  0x85FE, 0x65F5, 0xA39A, 0x85FC, 0x85FC, 0x84CB, 0x64CA, 0x64CA,
+  0x65F3, 0x65EA, 0x0000, 0xC5E9, 0xC5E9, 0x65C1, 0x0000, 0x0000,
+  0x0000, 0xE490, 0x06E9, 0x06E1, 0x26E1, 0xE7E0, 0x5042, 0x0017,
+  0xC8E8, 0xA8E0, 0xC8E0, 0xA8E0, 0x8B98, 0x0000, 0x0000, 0x0000,
+  0xC6C0, 0x08E1, 0x06E9, 0xE490, 0xC6C0, 0x45E9, 0xC6C0, 0xE490,
+  0xC490, 0xC5E9, 0xC5E9, 0x4218, 0x64CA, 0x65FB, 0xE490, 0x5111,
+  0x0016, 0x65FE, 0x85FD, 0x84CB, 0x85FD, 0x84CB, 0x65F3, 0xA39A,
+  0x85FC, 0x65FB, 0x0000, 0x6450, 0x65F3, 0x85F2, 0x85EA, 0xC5E9,
+  0xC5E9, 0x45E1, 0x65E1, 0x45E9, 0x65E1, 0x06E9, 0xE490, 0x5142,
+  0x0016, 0xC6C0, 0xA8E0, 0xE7E0, 0xC8E0, 0xE7E8, 0xC8E0, 0x27D1,
+  0xC6C0, 0x27D1, 0x06E9, 0x65E1, 0x06E1, 0x0000, 0x45E1, 0xC5E9,
+  0xC490, 0xC5E9, 0xC5E9, 0x85F2, 0x64CA, 0x65F3, 0x65FB, 0x5211,
+  0x0015, 0x65F6, 0x65FD, 0x0000, 0xA39A, 0x4232, 0xA39A, 0x85FC,
+  0x65FB, 0xA362, 0x0000, 0x65F3, 0x85F2, 0x65F2, 0x85EA, 0x65F2,
+  0xC5E9, 0xC5E1, 0x45E1, 0xC5E9, 0x65E1, 0x45E1, 0x5243, 0x0015,
+  0xE7E8, 0xC8E0, 0xE7E0, 0xE7E0, 0x06E9, 0x08E1, 0x06E1, 0x26E1,
+  0x65E1, 0x45E9, 0xA6E1, 0x0000, 0x8450, 0xC5E9, 0x84CA, 0x65C1,
+  0xE498, 0xC490, 0x8458, 0x65FB, 0x65F3, 0x5311, 0x0015, 0xA362,
+  0x65FE, 0x85FD, 0x65FD, 0x84CC, 0x65F5, 0x85FC, 0x65F4, 0x0000,
+  0x85FC, 0x65FB, 0x64CA, 0x85C1, 0x64CA, 0x65C1, 0x85EA, 0xC5E9,
+  0x85F2, 0xC5E9, 0xC5F1, 0x4218, 0x5343, 0x0015, 0x8450, 0x06E1,
+  0x06E1, 0x65E9, 0x06E1, 0x65E1, 0xC6C0, 0xC6C0, 0x65C1, 0x65C1,
+  0xC5E9, 0xC5E9, 0x0000, 0x85EA, 0x85F2, 0x65FB, 0xC490, 0x65F3,
+  0x65FB, 0x85FC, 0x4218, 0x5412, 0x0013, 0x65FD, 0x85FE, 0x65F5,
+  0x65FE, 0x65FD, 0x8450, 0xA39A, 0x85FC, 0x85FC, 0x65F3, 0x64CA,
+  0x64CA, 0x65F2, 0x65F3, 0x85F2, 0x65EA, 0xC5E9, 0xC5E9, 0xC490,
+  0x5444, 0x0013, 0xC6C0, 0x65E1, 0x06E1, 0x65E9, 0x45E1, 0xC5E9,
+  0x65E1, 0x65C1, 0xE490, 0xC5E9, 0xC5E9, 0x65C1, 0x85C1, 0xC490,
+  0x85F2, 0x65FB, 0x65F3, 0x85FC, 0x84CB, 0x5512, 0x0012, 0xA362,
+  0x85FE, 0x25FF, 0x84CC, 0xA39A, 0x8450, 0x65FD, 0x85FD, 0xC39A,
+  0xC490, 0x65FC, 0x65F3, 0x85FC, 0x65F3, 0x65F3, 0x65F2, 0x85EA,
+  0xC5E9, 0x5545, 0x0012, 0x65E1, 0xC5E9, 0x45E1, 0xC5E9, 0xC5E1,
+  0xC5E9, 0xC5E9, 0x85F2, 0x65C9, 0x8450, 0x85F2, 0x65FB, 0xC490,
+  0xA362, 0x64CA, 0x65F4, 0x85FC, 0x2232, 0x5613, 0x0010, 0x65FE,
+  0x65FE, 0x0000, 0xE59C, 0x64CC, 0x65FD, 0x85FD, 0xA39A, 0x85FD,
+  0x65F4, 0x85FC, 0x65F3, 0x65FC, 0x65F3, 0x65F3, 0x85F2, 0x5646,
+  0x0010, 0xA6E1, 0xC5E9, 0xC5E9, 0x85EA, 0xC5E9, 0x65EA, 0x85F2,
+  0x65EA, 0xC490, 0x84CB, 0x65FB, 0x64CA, 0xE490, 0xA39A, 0x85FC,
+  0x85FC, 0x5713, 0x000F, 0x4218, 0x25F7, 0x65FE, 0x65FE, 0x65F6,
+  0x65FE, 0x64CC, 0x85FE, 0x65FD, 0x85F5, 0x65FC, 0x85FD, 0x65F4,
+  0x85FC, 0x65F3, 0x5747, 0x000E, 0xC5E9, 0x65EA, 0x85F2, 0x65F3,
+  0x65F2, 0x65F3, 0x65F3, 0x85FC, 0x65F3, 0x65F4, 0x85FC, 0x65F4,
+  0x85FC, 0x65F5, 0x5814, 0x000D, 0x84CB, 0x25FF, 0x65FE, 0x65FE,
+  0x65F6, 0x65FE, 0x65FD, 0x85FD, 0x65F5, 0x85FD, 0x65FC, 0x85F4,
+  0x65FC, 0x5848, 0x000D, 0x65C1, 0x65F3, 0x85F2, 0x65F3, 0x65F3,
+  0x65F3, 0x65F3, 0x85FC, 0x65F3, 0x65FC, 0x85F4, 0x65FD, 0xA362,
+  0x5915, 0x000B, 0x65CD, 0x25F7, 0x65FE, 0x25F7, 0x65FE, 0x85FE,
+  0x65F5, 0x65FE, 0x85FD, 0x65FD, 0x85FC, 0x5949, 0x000B, 0xC490,
+  0x65F3, 0x65F3, 0x85FC, 0x65F4, 0x85FC, 0x65F4, 0x85FD, 0x65FD,
+  0x85FD, 0x84CB, 0x5A16, 0x0009, 0xE59C, 0x25F7, 0x65FE, 0x25F7,
+  0x65FE, 0x65FE, 0x65FD, 0x85FD, 0xA362, 0x5A4A, 0x0009, 0x6450,
+  0x85FC, 0x85FC, 0x65FC, 0x85F4, 0x65FD, 0x85FD, 0x65FD, 0xA39A,
+  0x5B17, 0x0006, 0x2232, 0x65FE, 0x65FE, 0x85FE, 0x85FD, 0xA39A,
+  0x5B4C, 0x0006, 0xA39A, 0x84CC, 0x65FD, 0x85FD, 0x85CD, 0x8450,
+  0x0005, 0x0006, 0xA36A, 0xE59C, 0x85CD, 0xE59C, 0xA66C, 0x4218,
+  0x005E, 0x0006, 0x4220, 0xA39A, 0xE59C, 0x85D5, 0xE59C, 0xA36A,
+  0x0104, 0x0008, 0xA664, 0xA7A6, 0x26CF, 0x26CF, 0x25FF, 0x86CE,
+  0x86D6, 0xA3A2, 0x015C, 0x0009, 0x4232, 0xA39A, 0x64CC, 0x65F5,
+  0x65FE, 0x65FE, 0x85FE, 0x65D5, 0xA664, 0x0203, 0x000D, 0xC7AE,
+  0xA7A6, 0x26D7, 0x26CF, 0x25F7, 0x26CF, 0x25FF, 0x25F7, 0x25F7,
+  0x65FE, 0x65FE, 0x84CB, 0x4218, 0x0259, 0x000D, 0x4218, 0xA3A2,
+  0x85FC, 0x65FC, 0x85FD, 0x65F5, 0x85FD, 0x65FD, 0x85FE, 0x65F6,
+  0x25F7, 0x65FE, 0x66CE, 0x0302, 0x0010, 0x6786, 0x26D7, 0x26CF,
+  0x26CF, 0x25F7, 0x25FF, 0x25F7, 0x25F7, 0x25F7, 0x25FF, 0x25F7,
+  0x65FE, 0x65FE, 0x85FD, 0x65FD, 0x4232, 0x0357, 0x0010, 0x8450,
+  0x65F3, 0x65F3, 0x65FC, 0x85F4, 0x65FC, 0x85F4, 0x65FD, 0x85FD,
+  0x65FD, 0x65F5, 0x65FE, 0x65FE, 0x25FF, 0x85FE, 0x65CD, 0x0402,
+  0x0012, 0xC7A6, 0x26D7, 0x26CF, 0x25F7, 0x26CF, 0x25FF, 0x25F7,
+  0x25F7, 0x65FE, 0x65FE, 0x65FE, 0x65FE, 0x65F5, 0x85FD, 0x65FD,
+  0x85FD, 0x64CC, 0xA362, 0x0455, 0x0013, 0xC490, 0xC5E9, 0x85F2,
+  0x85EA, 0x65F3, 0x65FB, 0x65F3, 0x65F3, 0x65FC, 0x85F4, 0x65FD,
+  0x85FD, 0x65FD, 0x85F5, 0x65FE, 0x65FE, 0x65FE, 0x65F6, 0x4218,
+  0x0501, 0x0015, 0xA664, 0x26CF, 0x26CF, 0x25F7, 0x66D6, 0x25F7,
+  0x25F7, 0x25FF, 0x25F7, 0x25F7, 0x65F6, 0x85FE, 0x65FD, 0x85FD,
+  0x65F5, 0x85FD, 0x65FC, 0x85F4, 0x65FB, 0x85FC, 0xA362, 0x0553,
+  0x0015, 0xC490, 0xC5E1, 0xC5E9, 0x65F2, 0xC5E9, 0x85EA, 0x65F2,
+  0x65F3, 0x65F3, 0x85FC, 0x65F3, 0x65F4, 0x85FC, 0x65FD, 0x85F5,
+  0x65FD, 0x65FD, 0x65FE, 0x85FE, 0x25FF, 0xA39A, 0x0600, 0x0018,
+  0x0000, 0xC7AE, 0x26CF, 0x25FF, 0x65CD, 0x0000, 0xE59C, 0x25F7,
+  0x65FE, 0x25F7, 0x65FE, 0x65FE, 0x65FD, 0x85FD, 0x65FD, 0x85F5,
+  0x65FC, 0x85F4, 0x65F3, 0x65FB, 0x65F3, 0x65F3, 0x65F2, 0xA362,
+  0x0651, 0x0018, 0xC490, 0x06E9, 0x65E1, 0x65E1, 0xC5E9, 0xC5E9,
+  0xC5E9, 0xC5E9, 0x85EA, 0x65F2, 0x65F3, 0x65F3, 0x65F3, 0x65F3,
+  0x85FC, 0x65FC, 0x85F5, 0x65FD, 0xA362, 0x0000, 0x85FE, 0x65FE,
+  0x65CD, 0x0000, 0x0700, 0x001A, 0xA362, 0x86D6, 0x25F7, 0x25F7,
+  0x25FF, 0xA664, 0x64CC, 0x65CD, 0x25F7, 0x85FE, 0x64D4, 0x4218,
+  0x85FD, 0xA362, 0x64CC, 0x85F4, 0x65FC, 0x65F3, 0x85FC, 0x65F3,
+  0x65F3, 0x65F2, 0x85F2, 0xC5E9, 0x64CA, 0x8450, 0x074F, 0x001A,
+  0xE490, 0x08E1, 0x06E9, 0x65E1, 0x06E1, 0x65E1, 0x45E1, 0xC5E9,
+  0xC5E9, 0x65EA, 0xC5E9, 0x85F2, 0x65EA, 0x85F2, 0x84CB, 0xA362,
+  0x65F3, 0x65FC, 0x85FC, 0x65FD, 0xA362, 0xA362, 0x65FD, 0x65FE,
+  0x86D6, 0xA362, 0x0800, 0x001C, 0xA362, 0x26D7, 0x26CF, 0x25FF,
+  0x25F7, 0x25F7, 0x86D6, 0x0000, 0x64CC, 0x65FE, 0xA362, 0x0000,
+  0xA39A, 0xA39A, 0x0000, 0xA362, 0x65FB, 0x65FB, 0x85EA, 0x85F2,
+  0x65EA, 0x85F2, 0xC5E9, 0xC5E9, 0xA6E1, 0xC5E9, 0x65C1, 0x8450,
+  0x084D, 0x001C, 0x8458, 0x8AC8, 0xC8E8, 0xC8E0, 0xE7E0, 0xE7E0,
+  0x06E9, 0x06E1, 0x65E1, 0x85C1, 0x45E9, 0xA6E1, 0xC5E9, 0x4218,
+  0x0000, 0x85C1, 0xA362, 0x0000, 0x84CB, 0x65FB, 0xC39A, 0x8458,
+  0x85FD, 0x65FD, 0x85FD, 0x65FD, 0x85FE, 0xA362, 0x0900, 0x001E,
+  0xE59C, 0x46D7, 0x25F7, 0x25F7, 0x25F7, 0x0000, 0x2232, 0x65FE,
+  0x65FE, 0x65FE, 0x85FD, 0x0000, 0x4232, 0x84CB, 0x0000, 0x0000,
+  0x65F3, 0x65FB, 0x65F3, 0xC490, 0x84CA, 0xC5E9, 0xC5E9, 0xA6E1,
+  0xC5E9, 0x45E1, 0x65E1, 0x26E9, 0x06E9, 0x4218, 0x094B, 0x001E,
+  0x8458, 0xAAE0, 0xA8E0, 0xAAE0, 0xC8E8, 0xE7E0, 0xE7E0, 0xE7E0,
+  0xE7E8, 0x06E9, 0xE490, 0xC490, 0x65E1, 0xC5E9, 0x65C9, 0x0000,
+  0x8458, 0x64CA, 0x0000, 0x4218, 0x65F3, 0x65FC, 0x65F3, 0x84D4,
+  0x4218, 0xA39A, 0x65F5, 0x85FE, 0x65FD, 0x64CC, 0x0A01, 0x001F,
+  0x25F7, 0x25FF, 0x25F7, 0x25F7, 0xE59C, 0x0000, 0x2232, 0x65FD,
+  0x85FE, 0x65FD, 0x65FD, 0x84CB, 0x85FC, 0xA39A, 0x0000, 0xA39A,
+  0xE490, 0x85F2, 0x65F2, 0x8450, 0xC490, 0x65E9, 0xC5E9, 0x45E1,
+  0x65E9, 0x06E1, 0x06E1, 0xE7E0, 0xE7E8, 0xC6C0, 0x0000, 0x0A4A,
+  0x001F, 0xAAC8, 0xACE8, 0xAAE0, 0xAAE0, 0xC8E0, 0xAAE8, 0xA8E0,
+  0xC8E0, 0xA8E0, 0xE7E8, 0x8450, 0xE490, 0x06E9, 0xE490, 0x8458,
+  0xC498, 0x0000, 0x85C1, 0x65C1, 0xE498, 0x85F2, 0x65F3, 0x65F3,
+  0x65FB, 0x0000, 0x0000, 0x84CB, 0x65FD, 0x85F5, 0x65FE, 0xE59C,
+  0x0B00, 0x0021, 0xC7A6, 0x25F7, 0x25FF, 0x25F7, 0x25F7, 0x86D6,
+  0xA664, 0xA362, 0x65CD, 0x85FD, 0x65FD, 0x85F4, 0x65FC, 0x85FC,
+  0x85FC, 0xC490, 0xA362, 0x0000, 0x64CA, 0xC5E9, 0xC5E9, 0x0000,
+  0x8458, 0x65E1, 0x65E1, 0x06E1, 0x06E9, 0xE7E0, 0xE7E0, 0xC8E0,
+  0xA8E8, 0xC8E8, 0x8458, 0x0B48, 0x0021, 0x8B58, 0xACE0, 0xACE0,
+  0xACE0, 0xACE8, 0xAAE0, 0x08E1, 0xAAE0, 0xAAE0, 0xC8E8, 0xE7E8,
+  0x4218, 0x8458, 0xE7E0, 0x06E9, 0x8458, 0x8458, 0x8458, 0x6450,
+  0xC5E1, 0xC5E9, 0xC5E9, 0x85F2, 0x85EA, 0x65FB, 0x64CA, 0xA39A,
+  0xA362, 0x65FC, 0x85F4, 0x65FD, 0x85FD, 0x64CC, 0x0C01, 0x0021,
+  0x25FF, 0x25F7, 0x25F7, 0x65FE, 0x65FE, 0x65CD, 0x64CC, 0x85CD,
+  0x65FD, 0xA39A, 0xA362, 0xA36A, 0x65FB, 0x65F3, 0x65F3, 0x85F2,
+  0x0000, 0x65C1, 0xE490, 0xC490, 0xA6E9, 0xE490, 0x85C1, 0x4218,
+  0x06E9, 0xE7E8, 0xE7E0, 0xC8E8, 0xA8E0, 0xC8E0, 0xAAE0, 0xAAE8,
+  0x6B98, 0x0C47, 0x0022, 0x8B98, 0xACE8, 0xAEE0, 0xACE0, 0xACE8,
+  0xACE0, 0xACE0, 0xAAE0, 0xAAE8, 0x6B98, 0xE490, 0xC6C0, 0xC490,
+  0xC8E8, 0xC6C0, 0xC490, 0x8458, 0x0000, 0x65E9, 0x45E1, 0x65E9,
+  0x65C1, 0xE490, 0x8458, 0x64CA, 0x85F2, 0x64CA, 0x64CA, 0x65F3,
+  0x65FC, 0x85F4, 0x65FC, 0x85FD, 0x84CB, 0x0D00, 0x0023, 0xA664,
+  0x25F7, 0x25F7, 0x25F7, 0x25FF, 0x65FE, 0x4232, 0xA362, 0x65FD,
+  0x85D5, 0xC39A, 0xA39A, 0xC39A, 0x65FB, 0x64CA, 0x6450, 0x85F2,
+  0xC5E9, 0xC5E9, 0xE490, 0x0000, 0x65C1, 0x65E9, 0xC6C0, 0x8458,
+  0xC6C0, 0x4218, 0xC490, 0xAAE8, 0xC8E0, 0xAAE0, 0xAAE0, 0xACE8,
+  0xAAE0, 0x8AC8, 0x0D46, 0x0023, 0xAEC8, 0xAEE0, 0xAEE8, 0xAEE0,
+  0xAEE0, 0xACE0, 0xAEE8, 0xACE8, 0x6B98, 0x8458, 0xC6C0, 0x4218,
+  0xC8E0, 0xC8E8, 0xE7E0, 0x0000, 0xC6C0, 0xC6C0, 0x06E1, 0x06E9,
+  0xE490, 0x65C9, 0x85C1, 0x8458, 0x8450, 0x65C1, 0x65F2, 0x85F2,
+  0x8458, 0xA39A, 0x85F4, 0x65FC, 0x85F5, 0x65FC, 0xA362, 0x0E01,
+  0x0023, 0x86D6, 0x25FF, 0x25FF, 0x65FE, 0x65FE, 0xA39A, 0x0000,
+  0x65F4, 0x85FC, 0x0000, 0x0000, 0x0000, 0x6450, 0xE490, 0x0000,
+  0xC498, 0x85C1, 0xC5E9, 0x45E9, 0x0000, 0x0000, 0x06E1, 0x26E1,
+  0xE7E8, 0xE7E0, 0xC8E0, 0xE7E0, 0xA8E8, 0xAAE0, 0xAAE0, 0xACE0,
+  0xAAE8, 0xACE0, 0xACE0, 0xAEC8, 0x0E45, 0x0024, 0x8EC8, 0xAEE8,
+  0xB0E0, 0xAEE0, 0xAEE0, 0xAEE8, 0xAEE0, 0xACE0, 0xACE0, 0x8AC8,
+  0xACE8, 0xAAE0, 0xAAE0, 0xAAE0, 0xC8E8, 0x0000, 0x0000, 0x8AC8,
+  0xE7E0, 0xC6C0, 0xE490, 0x0000, 0xE490, 0x0000, 0x0000, 0x0000,
+  0x8458, 0xC5E9, 0x64CA, 0x0000, 0x65FB, 0x65F3, 0x85FC, 0x65F4,
+  0x84CC, 0x0000, 0x0F01, 0x0024, 0xA362, 0x25F7, 0x65F6, 0x65FE,
+  0x85FE, 0x65FD, 0x0000, 0x85FD, 0x85FC, 0xA39A, 0xA39A, 0x64CA,
+  0x64CA, 0x85F2, 0x85C1, 0x64CA, 0x4218, 0x45E1, 0x65E9, 0xC6C0,
+  0x0000, 0xC6C0, 0xE7E0, 0xE7E0, 0xC8E8, 0xC6C0, 0xC6C0, 0x8AC8,
+  0x6B98, 0xACE0, 0xACE0, 0xACE8, 0xACE0, 0xAEE0, 0xAEE8, 0xAEC8,
+  0x0F44, 0x0024, 0xB1C8, 0xB0E0, 0xB0E0, 0xB0E0, 0xB0E0, 0xAEE0,
+  0xB0E0, 0xAEE8, 0x8EC8, 0xAEC8, 0xAEE0, 0xAEC8, 0xACE8, 0xAAE0,
+  0x08E1, 0x0000, 0x0000, 0x8AC8, 0x08E9, 0xC490, 0xE498, 0xC490,
+  0xE490, 0xC6C8, 0xC490, 0xE498, 0xA362, 0x6450, 0x85F2, 0x65C1,
+  0x0000, 0x65F3, 0x65FB, 0x65F3, 0x85FC, 0x2232, 0x1002, 0x0024,
+  0x65D5, 0x65FE, 0x65FE, 0x65FE, 0x65F5, 0x85FD, 0x65FC, 0x85F4,
+  0x65F3, 0x65F3, 0x6458, 0x8458, 0x64CA, 0xC5E9, 0xE490, 0xC490,
+  0x8458, 0x85C9, 0x06E9, 0xE490, 0x4218, 0xE7E8, 0xA8E0, 0xC8E8,
+  0x8450, 0x0000, 0x0000, 0x0000, 0x0000, 0x8AC8, 0xACE8, 0xAEE0,
+  0xACE0, 0xAEE8, 0xAEE0, 0xAEC8, 0x102C, 0x0002, 0x8450, 0x4218,
+  0x103B, 0x0002, 0x4220, 0x8458, 0x1043, 0x0024, 0x8ED0, 0xB1C8,
+  0xB0E8, 0xB0E0, 0xB0E0, 0xB0E0, 0xB0E0, 0xAEC8, 0x0000, 0x0000,
+  0x0000, 0x0000, 0xC490, 0xACE8, 0xACE0, 0x8B98, 0x0000, 0x8AC8,
+  0xAAE8, 0xC6C0, 0x8450, 0xE498, 0xC6C0, 0xE7E8, 0x06E1, 0x8450,
+  0xE498, 0x45E9, 0xC5E9, 0xC5E9, 0x85EA, 0xC5E9, 0x85EA, 0x65F2,
+  0x65F3, 0x84CB, 0x1102, 0x000D, 0xA362, 0x65F6, 0x85FE, 0x65FD,
+  0x85FD, 0x85FC, 0x84CB, 0xC490, 0xA39A, 0x85F2, 0x84CB, 0x85F2,
+  0xA362, 0x1114, 0x0013, 0xC490, 0xE7E0, 0xE7E8, 0xC8E0, 0xC490,
+  0x0000, 0xAAE8, 0xC6C0, 0x0000, 0x0000, 0x0000, 0x0000, 0xACE0,
+  0xAEC8, 0x8EC8, 0xAEE8, 0xB0E0, 0xB0E0, 0xD1B0, 0x112C, 0x0002,
+  0xB1C8, 0xB1A8, 0x113B, 0x0002, 0xD1B0, 0xB1A8, 0x1142, 0x0013,
+  0xD1B0, 0xB1C8, 0xB0E0, 0xB0E0, 0xB0E0, 0xB1C8, 0xB0E0, 0xAEC8,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x8AC8, 0xAEE0, 0x0000, 0xAAC8,
+  0xACE8, 0x8AC8, 0xACE8, 0x115A, 0x000D, 0x8458, 0xE490, 0x27D1,
+  0x06E1, 0x45E9, 0xE490, 0xC490, 0xA6E1, 0x85F2, 0x65EA, 0x65FB,
+  0x65F3, 0x4232, 0x1203, 0x000D, 0x65CD, 0x65FD, 0x85FD, 0x65FC,
+  0xA39A, 0x0000, 0x0000, 0x0000, 0x0000, 0x4218, 0x85F2, 0xA6E1,
+  0x4218, 0x1215, 0x0019, 0xC6C8, 0xC8E8, 0xA8E0, 0x8B98, 0x0000,
+  0x0000, 0x8AC8, 0x8AC8, 0x0000, 0x0000, 0x0000, 0x4218, 0xAED0,
+  0x8B98, 0x6BA0, 0xAEE0, 0xB0E0, 0xB0E0, 0x8B98, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x8458, 0xB1D0, 0x123A, 0x001B, 0x0000, 0xB1A8,
+  0x4218, 0x0000, 0x0000, 0x0000, 0x0000, 0x8B60, 0xB1D0, 0xB1C8,
+  0xB1C8, 0xB1D0, 0xD1A8, 0xB1C8, 0x6BA0, 0x0000, 0x0000, 0x0000,
+  0x0000, 0xAEC8, 0xAEE8, 0x4218, 0x0000, 0x8EC8, 0xACE8, 0xACE0,
+  0xE490, 0x125B, 0x000B, 0xE7E8, 0xE7E0, 0x8450, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x65C9, 0x85F2, 0x85F2, 0x64CA, 0x1303, 0x0005,
+  0x2232, 0x65FE, 0x85FD, 0x85FD, 0xA39A, 0x130E, 0x0003, 0x64CA,
+  0xC5E9, 0x8450, 0x1316, 0x0019, 0x08E1, 0xC8E0, 0xAAE8, 0x8450,
+  0x0000, 0x0000, 0x8AC8, 0xACE8, 0x8458, 0x0000, 0x0000, 0x0000,
+  0xAEC8, 0x8ED0, 0x8458, 0xAEC8, 0xB0E0, 0xB0E0, 0x8B60, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x6B98, 0x8BA0, 0x133A, 0x001A, 0x8B58,
+  0x6BA0, 0x0000, 0x0000, 0x0000, 0x0000, 0x8B58, 0xD1B0, 0xB1C8,
+  0xB1C8, 0x8EC8, 0x8BA0, 0xB1C8, 0xB1B0, 0x0000, 0x0000, 0x0000,
+  0x8450, 0xB0E0, 0xAED0, 0x0000, 0x0000, 0x6B98, 0xAEE0, 0xAEE8,
+  0xAED0, 0x1359, 0x0003, 0x4218, 0x08E1, 0xC490, 0x1362, 0x0004,
+  0xA39A, 0x85EA, 0x65F2, 0x4218, 0x1404, 0x000D, 0x85D5, 0x65FD,
+  0x85FC, 0x84CB, 0x0000, 0x0000, 0x0000, 0x0000, 0x4218, 0xC490,
+  0xC490, 0x65E9, 0x45E9, 0x1416, 0x0019, 0xC6C0, 0xAAE8, 0xAAE0,
+  0xAAE8, 0x4218, 0x0000, 0x0000, 0x8B58, 0xAED0, 0x6B98, 0x0000,
+  0x0000, 0x0000, 0x8BA0, 0xB1C8, 0x8B58, 0x6BA0, 0xB1C8, 0xB1C8,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x8B60, 0x8B60, 0x143A, 0x0023,
+  0x8B58, 0x0B19, 0x0000, 0x0000, 0x0000, 0x0000, 0xD190, 0xD1B0,
+  0xD1B0, 0x6B98, 0x8BA0, 0xB1C8, 0x6B98, 0x0000, 0x0000, 0x0000,
+  0x8BA0, 0xB1C8, 0x8458, 0x0000, 0x0000, 0x8458, 0xAEE8, 0xAEE0,
+  0xACE0, 0xC490, 0x0000, 0x4218, 0x0000, 0x0000, 0x8458, 0xAAE8,
+  0xC8E8, 0xC6C0, 0xC490, 0x1462, 0x0003, 0x85C9, 0xC5E9, 0xC5E9,
+  0x1504, 0x002C, 0x85FD, 0x65FC, 0x85F4, 0x65FB, 0x0000, 0x0000,
+  0x0000, 0x8458, 0xA36A, 0x8458, 0x4218, 0x0000, 0x85C1, 0x26E1,
+  0x06E9, 0xE7E0, 0x08E1, 0xC8E0, 0x8AC8, 0x8AC8, 0xACE0, 0xAAE8,
+  0xACE0, 0x8BA0, 0x0000, 0x6B98, 0xAEE0, 0xAEE0, 0xB0E8, 0x8B98,
+  0x0000, 0x0000, 0x8B60, 0xB1C8, 0x8EC8, 0x8BA0, 0xB1D0, 0xD190,
+  0x0000, 0x0000, 0x0000, 0x0000, 0xF178, 0x4218, 0x1539, 0x002C,
+  0x0B19, 0x1161, 0x0000, 0x0000, 0x0000, 0x0000, 0xD178, 0xD1B0,
+  0xD190, 0xF178, 0xD188, 0xD1B0, 0x8B60, 0x0000, 0x0000, 0x6B98,
+  0xB1C8, 0xB0E0, 0xB1D0, 0x4218, 0x0000, 0xAEC8, 0xB0E0, 0xB0E0,
+  0xAEE0, 0xAEE8, 0x8EC8, 0xAEE0, 0xACE0, 0xACE8, 0xAEC8, 0xACE8,
+  0x6B98, 0x0000, 0xE498, 0xC6C0, 0xC6C0, 0x8450, 0x0000, 0x0000,
+  0x0000, 0xC5E9, 0xC5E9, 0xA39A, 0x1604, 0x002C, 0xA39A, 0x85F4,
+  0x65FC, 0x85F4, 0x4218, 0x0000, 0xC498, 0xA39A, 0x0000, 0x0000,
+  0x0000, 0x0000, 0xE490, 0x06E9, 0xE7E8, 0xE7E0, 0xC8E0, 0xA8E0,
+  0x8AC8, 0xE490, 0x0000, 0x8458, 0x8AC8, 0xAEE8, 0xACE0, 0xAEE8,
+  0x8B58, 0x4218, 0xAED0, 0xB0E0, 0xB0E0, 0x8B98, 0x0000, 0x0000,
+  0x8ED0, 0xB1C8, 0xD1A8, 0xB1B0, 0x8B58, 0x0000, 0x0000, 0x0000,
+  0x8B60, 0xF178, 0x1639, 0x002C, 0x8B60, 0x0B19, 0x0000, 0x0000,
+  0x0000, 0x0B21, 0xD190, 0xF178, 0xD190, 0xD190, 0xF188, 0x0000,
+  0x0000, 0x8B60, 0xD1B0, 0xB1A8, 0xAEC8, 0x8458, 0xB1D0, 0xB1C8,
+  0xB0E0, 0xB0E0, 0xB0E0, 0x6B98, 0xE498, 0x6B98, 0xAEE8, 0xACE0,
+  0xAEE8, 0xACE0, 0xACE0, 0xAAE0, 0x8458, 0x0000, 0x0000, 0x0000,
+  0x8458, 0xE490, 0x8458, 0x0000, 0xC498, 0x65E9, 0xC5E9, 0xC490,
+  0x1704, 0x002D, 0xA362, 0x65FC, 0x85FC, 0x65FB, 0xA36A, 0x4218,
+  0x64CA, 0x0000, 0x0000, 0x0000, 0x0000, 0xE490, 0x06E1, 0xE7E0,
+  0xE7E8, 0xE490, 0xA8E0, 0xC8E0, 0x08E1, 0xAAE8, 0x8AC8, 0x0000,
+  0x0000, 0x4218, 0xAEE8, 0xAEE8, 0xE490, 0x0000, 0x0000, 0x8458,
+  0xB0E0, 0xB1C8, 0xB0E0, 0x6BA0, 0xE490, 0xD1A8, 0xB1D0, 0xD190,
+  0xB1B0, 0x4218, 0x0000, 0x0000, 0x4220, 0x8B60, 0x4218, 0x1738,
+  0x002D, 0x0B21, 0x8B60, 0x0000, 0x0000, 0x0000, 0x4218, 0xF178,
+  0xD178, 0xF178, 0xD178, 0xF178, 0x4218, 0xF178, 0xD190, 0xB1B0,
+  0xD1A8, 0x6BA0, 0x0000, 0x0000, 0x8B98, 0xB0E0, 0xB1C8, 0x8458,
+  0x0000, 0x0000, 0x8B98, 0xB0E0, 0xAEE0, 0xAEE8, 0xACE0, 0x8AC8,
+  0xACE0, 0xACE0, 0xAAE8, 0x0000, 0x0000, 0x0000, 0x0000, 0x8458,
+  0xE490, 0x0000, 0xC6C0, 0xA6E9, 0xC5E9, 0x8450, 0x1804, 0x002D,
+  0x4218, 0x85FC, 0x65F3, 0x65FB, 0x64CA, 0xA39A, 0x8450, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x06E9, 0x08E1, 0xE7E0, 0xE490, 0xC6C0,
+  0x0000, 0x8458, 0xAAE8, 0xACE0, 0xACE8, 0xACE0, 0x4218, 0x0000,
+  0x8458, 0xB0E0, 0xAEE8, 0x8EC8, 0x0000, 0x0000, 0x0000, 0xB1C8,
+  0xB1C8, 0xB1C8, 0x8BA0, 0xB1A8, 0xD1B0, 0xD188, 0x8B60, 0xF178,
+  0x0000, 0x0000, 0x0000, 0x8B60, 0x0B19, 0x1838, 0x002D, 0x0B19,
+  0x8B60, 0x0000, 0x0000, 0x0000, 0x1169, 0x1161, 0x8B60, 0x1161,
+  0xD178, 0xF178, 0xD178, 0xD190, 0xF190, 0xD190, 0x4218, 0x0000,
+  0x0000, 0x8BA0, 0xB1C8, 0xB1C8, 0x8B60, 0x0000, 0x4218, 0xB0E8,
+  0xB0E0, 0xAEE8, 0xB0E0, 0x8450, 0x8B60, 0x8B98, 0x8ED0, 0xACE0,
+  0xACE8, 0x8B98, 0x0000, 0x0000, 0x0000, 0x0000, 0xC490, 0x8458,
+  0x06E9, 0x26E1, 0x65E1, 0x4218, 0x1905, 0x0005, 0x65FC, 0x85FC,
+  0x65F3, 0x65FB, 0x84D2, 0x190F, 0x0022, 0x06E1, 0x06E1, 0xE7E8,
+  0xC6C8, 0x4218, 0x0000, 0x0000, 0x8450, 0xACE8, 0xAEE0, 0xACE0,
+  0xAEE8, 0x8458, 0x8458, 0xB0E0, 0xB0E0, 0xB0E0, 0xB0E0, 0xAEC8,
+  0x8458, 0x0000, 0xB1D0, 0xD1B0, 0x4218, 0x0000, 0xD188, 0xF190,
+  0xD190, 0xF178, 0x8B60, 0x0000, 0x0000, 0x4220, 0x3149, 0x1937,
+  0x002D, 0x0000, 0x5151, 0x4218, 0x0000, 0x0000, 0x8B60, 0x3149,
+  0x5149, 0x1161, 0x1169, 0x1161, 0x0B21, 0x0B19, 0xD188, 0xD178,
+  0x0000, 0x0000, 0xF178, 0xB1B0, 0xD1A8, 0xB1B0, 0xB1C8, 0x0000,
+  0x8B60, 0xB1C8, 0xB0E0, 0xB0E0, 0xB0E8, 0x4218, 0x0000, 0x0000,
+  0x8B98, 0xAEC8, 0xAEE0, 0xACE8, 0xACE8, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x8450, 0x06E1, 0x06E1, 0x65E9, 0x45E9, 0x1A05, 0x002D,
+  0x65F3, 0x65F3, 0x65F3, 0x85F2, 0x65EA, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x06E1, 0xE7E8, 0xE7E0, 0xC8E0, 0x6B98, 0x4218,
+  0x0000, 0x0000, 0x8458, 0xACE8, 0xAEE8, 0xAEE0, 0xB0E0, 0xAEC8,
+  0xB0E0, 0x8EC8, 0x8B98, 0xB1D0, 0xB1C8, 0xB1C8, 0xB1D0, 0xB1A8,
+  0xD1B0, 0xD188, 0x0000, 0x0000, 0x4218, 0xF178, 0xD178, 0x1169,
+  0x0000, 0x0000, 0x0000, 0x0B19, 0x0B21, 0x1A37, 0x001A, 0x0B19,
+  0x0B21, 0x0000, 0x0000, 0x0000, 0x3149, 0x5149, 0x3151, 0x1161,
+  0x4220, 0x0000, 0x0000, 0xF178, 0x1161, 0x1161, 0x8B60, 0xD190,
+  0xF190, 0xD190, 0x8B58, 0xD1B0, 0xD1B0, 0xB1A8, 0xB1C8, 0xB0E8,
+  0xB1C8, 0x1A56, 0x000E, 0x8BA0, 0xAEE8, 0xACE0, 0xACE8, 0x8AC8,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x8450, 0xE7E8, 0x06E1, 0x26E1,
+  0x06E9, 0x1B05, 0x0005, 0x84CB, 0x85FC, 0x65F3, 0x65FB, 0xC5E9,
+  0x1B0F, 0x0023, 0xE490, 0x08E1, 0xA8E0, 0xAAE0, 0xAAE8, 0xAAE0,
+  0xAED0, 0x8AC8, 0x8450, 0xACE0, 0xAEE8, 0xB0E0, 0xAEE0, 0xB0E0,
+  0xB0E0, 0xB0E0, 0xB0E0, 0xB0E0, 0xB1D0, 0xB1C8, 0xD1A8, 0xB1B0,
+  0xD1B0, 0xB1B0, 0x8B60, 0x0000, 0x0000, 0x4218, 0xF178, 0x1161,
+  0x8B60, 0x0000, 0x0000, 0x0B21, 0x0B19, 0x1B37, 0x002D, 0x0B21,
+  0x0B21, 0x0000, 0x0000, 0x0B19, 0x5151, 0x3149, 0x5149, 0x0000,
+  0x0000, 0x0000, 0x3149, 0x1161, 0x1161, 0x1161, 0xD178, 0xF178,
+  0xF190, 0xD190, 0xB1A8, 0xD1B0, 0xB1A8, 0xD1B0, 0xB1C8, 0xB1C8,
+  0xB0E0, 0x6BA0, 0x0000, 0x8B58, 0xAEC8, 0xAEE0, 0xB0E0, 0xAEE0,
+  0xAEE8, 0xACE8, 0x8458, 0x0000, 0x0000, 0x0000, 0x0000, 0x8450,
+  0x08E1, 0xE7E0, 0x65E1, 0xC6C0, 0x1C05, 0x0005, 0xA39A, 0x65F3,
+  0x65F3, 0x85F2, 0x65EA, 0x1C0F, 0x0055, 0xE7E0, 0xA8E8, 0xC8E0,
+  0xA8E0, 0xAAE0, 0xAAE8, 0xACE0, 0xACE0, 0xACE0, 0xACE8, 0xAEE0,
+  0xAEE0, 0xB0E0, 0xB0E0, 0xB0E0, 0xB1C8, 0xB0E0, 0xB1C8, 0xB1C8,
+  0xD1B0, 0xB1A8, 0xD1B0, 0xB1A8, 0xD190, 0xF190, 0x4218, 0x0000,
+  0x0000, 0x1161, 0x3149, 0x5149, 0x4220, 0x0000, 0x0000, 0x3149,
+  0x4220, 0x0000, 0x0000, 0x0000, 0x4218, 0x0B21, 0x0000, 0x0000,
+  0x4220, 0x9131, 0x9129, 0x9131, 0x0B19, 0x0000, 0x0000, 0x0B21,
+  0x5149, 0x3149, 0x5151, 0x1161, 0x1169, 0xF178, 0xD178, 0xD190,
+  0xF190, 0xD1A8, 0xB1B0, 0xD1A8, 0xB1B0, 0xB1C8, 0xB1C8, 0xB0E0,
+  0xB1C8, 0xB0E8, 0xB0E0, 0xB0E0, 0xAEE0, 0xAEE0, 0xACE8, 0xACE0,
+  0xE490, 0x0000, 0x0000, 0x0000, 0x0000, 0xC490, 0xC8E8, 0xE7E0,
+  0x08E1, 0xC490, 0x1D05, 0x002E, 0x6450, 0x65F3, 0x85F2, 0x85F2,
+  0xC5E9, 0xC490, 0x0000, 0x0000, 0x0000, 0xE490, 0xE7E8, 0xC6C0,
+  0x0000, 0xC490, 0x8B98, 0xAAE0, 0xACE8, 0xACE0, 0xACE0, 0xAEE0,
+  0xAEE8, 0xB0E0, 0xB0E0, 0xB0E0, 0xB0E0, 0xB1C8, 0xB1B0, 0xAEC8,
+  0xB1B0, 0xD1A8, 0xB1B0, 0xD1B0, 0xF190, 0xD190, 0xD178, 0xF178,
+  0x0000, 0x0000, 0x5149, 0x8B60, 0x4218, 0x3151, 0x0000, 0x0000,
+  0x0B19, 0x9131, 0x1D3A, 0x002A, 0x9131, 0x9131, 0x0000, 0x9131,
+  0x9131, 0x0000, 0x0B19, 0x5151, 0x3149, 0x3149, 0x1161, 0x1161,
+  0x1161, 0x1161, 0xF178, 0xF178, 0xD190, 0xD190, 0xD1A8, 0xB1B0,
+  0xB1C8, 0xD1A8, 0xB1C8, 0xB1C8, 0xB0E0, 0xB0E0, 0xB0E0, 0xB0E0,
+  0xAEE8, 0x8458, 0xE490, 0xACE0, 0xACE8, 0x0000, 0x0000, 0x0000,
+  0x0000, 0xC6C0, 0x08E1, 0xE7E0, 0x06E9, 0x8458, 0x1E05, 0x0019,
+  0x4218, 0x85FA, 0x85F2, 0xC5E9, 0xC5E9, 0xA6E1, 0xC490, 0x0000,
+  0x0000, 0xE490, 0xE7E8, 0x4218, 0x0000, 0x0000, 0x0000, 0x6B98,
+  0xACE8, 0xACE8, 0x8AC8, 0xAAC8, 0xAEC8, 0x6B98, 0x8B98, 0x4218,
+  0x4220, 0x1E24, 0x0013, 0x4218, 0xD178, 0xF178, 0xD178, 0x1169,
+  0x1161, 0x0B21, 0x3149, 0x0000, 0x0000, 0x9131, 0x0B19, 0x0000,
+  0x0000, 0x0B21, 0x4218, 0x0000, 0x4220, 0x0B21, 0x1E3D, 0x0027,
+  0x0B19, 0x9131, 0x4220, 0x9131, 0x9131, 0x9129, 0x5149, 0x0B21,
+  0x0B19, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8458, 0x4220,
+  0x8B60, 0x8BA0, 0xB1A8, 0xD1B0, 0xB1C8, 0x8EC8, 0xB0E8, 0xB0E0,
+  0x8B98, 0x0000, 0x0000, 0x0000, 0x6B98, 0xACE8, 0x8450, 0x0000,
+  0x0000, 0xE498, 0xA8E8, 0xC8E0, 0xE7E0, 0xE7E8, 0x0000, 0x1F06,
+  0x0011, 0x65F3, 0x65EA, 0x85F2, 0xC5E9, 0xC5E9, 0x65E1, 0x45E1,
+  0xC6C0, 0x27D1, 0xE7E8, 0xC8E0, 0xAAC8, 0xAAE0, 0xAAE0, 0xACE8,
+  0xACE0, 0xAEE8, 0x1F26, 0x001E, 0x0000, 0x8B60, 0x1161, 0x1161,
+  0x1169, 0x3149, 0x4220, 0x0000, 0x3149, 0x9131, 0x0000, 0x0000,
+  0x0E0A, 0x0B21, 0x0000, 0x0B19, 0xEE09, 0x0000, 0x0000, 0xF221,
+  0x531A, 0x4220, 0x0000, 0x4218, 0x1222, 0x9131, 0x1222, 0x9131,
+  0x3151, 0x4218, 0x1F4A, 0x0001, 0x0000, 0x1F52, 0x0011, 0x8B58,
+  0xB0E0, 0xB0E0, 0xB0E0, 0xB0E0, 0x8B98, 0x8EC8, 0xAEE8, 0xAEE8,
+  0x8B98, 0x6B98, 0xAAE0, 0xAAE0, 0xC8E8, 0xA8E0, 0xC8E0, 0x06E1,
+  0x2006, 0x0012, 0x65C1, 0x85F2, 0xC5E9, 0xC5E9, 0x45E1, 0x65E1,
+  0x06E1, 0x06E1, 0xE7E8, 0xC8E0, 0xC8E0, 0xAAE0, 0xA8E8, 0xAAE0,
+  0xAAE0, 0xACE0, 0xACE8, 0x8B98, 0x2029, 0x000A, 0x3149, 0x3149,
+  0x5149, 0x9131, 0x0000, 0x4218, 0x9131, 0x4218, 0x0000, 0x0000,
+  0x2038, 0x000A, 0x4220, 0x531A, 0x1222, 0x0000, 0x0000, 0x1222,
+  0xF221, 0x1222, 0x9131, 0x4218, 0x2052, 0x0011, 0xB1B0, 0xB0E8,
+  0xB1C8, 0xB0E0, 0xAEE8, 0xB0E0, 0xAEE0, 0xAEE0, 0xACE8, 0xACE0,
+  0xAAE0, 0xACE0, 0xC8E8, 0xAAE0, 0xA8E0, 0xE7E0, 0xE490, 0x2106,
+  0x0013, 0xA362, 0x65F2, 0x85EA, 0xC5E9, 0xC5E9, 0x65E1, 0x45E1,
+  0xE7E8, 0xE7E0, 0xC8E0, 0xC8E0, 0x8AC8, 0xAAE8, 0xAAE0, 0xACE8,
+  0x8B98, 0xAEE0, 0xAEE8, 0x8B60, 0x212A, 0x0016, 0x8B60, 0x9131,
+  0x3149, 0x9131, 0x0000, 0x9131, 0x1222, 0x0000, 0xEE09, 0x531A,
+  0xB41A, 0x531A, 0xEE09, 0x0000, 0x531A, 0xD412, 0xEE09, 0x0000,
+  0xB41A, 0x531A, 0x531A, 0x0B19, 0x2151, 0x0012, 0x8B58, 0xB1D0,
+  0xB1C8, 0xD170, 0xB0E0, 0xB0E0, 0xAEE8, 0xAEE0, 0xAEE0, 0xAEE0,
+  0xACE8, 0xACE0, 0xAAE0, 0xAAE0, 0xC8E8, 0xAAE0, 0xA8E8, 0x8458,
+  0x2207, 0x0012, 0x85F2, 0xC5E9, 0xC5E9, 0x45E1, 0x45E1, 0x08E1,
+  0xE7E8, 0xC8E0, 0xA8E0, 0x8450, 0x0000, 0x8458, 0xACE8, 0xACE8,
+  0xACE0, 0xAEE0, 0xAEE0, 0xAEC8, 0x222B, 0x0014, 0x0B19, 0x9131,
+  0x9131, 0xEE09, 0x4218, 0x1222, 0x4220, 0x0B21, 0xB412, 0xB412,
+  0xB41A, 0x0B21, 0x4218, 0xB41A, 0xB412, 0x0000, 0xB41A, 0xB412,
+  0xB41A, 0x0B19, 0x2250, 0x0012, 0x4220, 0xB1D0, 0xB1C8, 0xB1D0,
+  0xB1A8, 0xB0E0, 0xB1C8, 0x8458, 0x4218, 0xAED0, 0xAEE8, 0xAEE0,
+  0xACE8, 0xACE0, 0xAAE0, 0xAAE0, 0xA8E8, 0xC8E0, 0x2307, 0x0013,
+  0xC5E9, 0xC5E9, 0xA6E1, 0xC6E1, 0x06E1, 0x06E9, 0xE7E0, 0x08E1,
+  0xC8E0, 0xA8E8, 0xE490, 0x08E1, 0xACE0, 0xAEE0, 0xACE8, 0xAEE8,
+  0x6B98, 0x8B98, 0x8EE8, 0x232C, 0x0012, 0x9131, 0x1222, 0x1222,
+  0xEE09, 0x0E12, 0xEE09, 0x0B19, 0xB41A, 0x5613, 0xB412, 0x4220,
+  0x531A, 0x560B, 0x4220, 0x330B, 0x560B, 0x5613, 0x0B21, 0x234F,
+  0x0013, 0x4218, 0xB1B0, 0x8B58, 0xB1D0, 0xB1C8, 0xB0E0, 0xB0E0,
+  0xB0E0, 0x8B98, 0x6B98, 0xAEE8, 0xAEE0, 0xAEE0, 0xAEE0, 0xACE8,
+  0x08E1, 0xAAE0, 0xAAE0, 0xC6C0, 0x2407, 0x0015, 0xE490, 0xC5E9,
+  0xC5E9, 0x65E1, 0x06E1, 0xC6C0, 0x8458, 0xC8E8, 0xA8E0, 0xC8E0,
+  0xAAE0, 0xAAE8, 0xACE0, 0xACE0, 0xAEE0, 0xAEE8, 0x6B98, 0x8B98,
+  0xB0E0, 0xB1B0, 0x8450, 0x242E, 0x0012, 0x1222, 0xEE09, 0x531A,
+  0xB41A, 0x0000, 0xB412, 0x5613, 0x330B, 0x0000, 0x560B, 0x5613,
+  0xEE09, 0x5613, 0x5613, 0x5613, 0xB412, 0xEE09, 0x4220, 0x244E,
+  0x0014, 0x4220, 0xF190, 0xD190, 0x8B58, 0x8BA0, 0xB1C8, 0xB1C8,
+  0xB0E8, 0xB0E0, 0xB0E0, 0xAEE0, 0xB0E0, 0xAEE0, 0xACE8, 0x8450,
+  0xACE8, 0xAAE0, 0xAAE0, 0xC8E8, 0x8450, 0x2508, 0x0016, 0xC5E9,
+  0x65E9, 0x65E1, 0x06E9, 0xC490, 0x8458, 0xE490, 0xC6C0, 0xAAE0,
+  0xAAE8, 0xACE0, 0xACE0, 0xAEE0, 0xAEE8, 0xAEE0, 0xAEE0, 0xB0E8,
+  0x8ED0, 0x4218, 0x8B98, 0x6BA0, 0x4220, 0x2527, 0x001B, 0x0B21,
+  0x3149, 0x9131, 0x9129, 0x9131, 0x1222, 0x1222, 0x4220, 0xEE09,
+  0xB41A, 0xB412, 0x330B, 0x5613, 0xF80B, 0x5613, 0x560B, 0xD80B,
+  0xF80B, 0xF80B, 0x4220, 0xEE09, 0xD80B, 0x5613, 0x5613, 0xB412,
+  0xD41A, 0xEE09, 0x254C, 0x0015, 0x0000, 0x8B60, 0xD178, 0x0B19,
+  0xD1B0, 0xB1A8, 0xB1C8, 0xB1C8, 0xB0E0, 0xB1C8, 0xB0E0, 0xB0E0,
+  0xB0E0, 0xAEE8, 0xAEE0, 0x8BA0, 0x8458, 0x6B98, 0xACE0, 0xAAE0,
+  0xAAE8, 0x2608, 0x0059, 0x8450, 0x45E9, 0x06E1, 0x26E1, 0xC6C0,
+  0x8450, 0x0000, 0x8458, 0xC8E8, 0xAAE8, 0x8AC8, 0xACE0, 0xACE0,
+  0x8AC8, 0x0000, 0xB0E0, 0xAEE0, 0x8B98, 0x0000, 0x4218, 0xAED0,
+  0xB1D0, 0xB1A8, 0xD1B0, 0x6B98, 0xD190, 0x8B58, 0x8B60, 0x8B60,
+  0x1161, 0x5149, 0x3149, 0x0B21, 0x0B19, 0x0000, 0x0B21, 0x1222,
+  0x531A, 0xEE09, 0xD412, 0xB41A, 0xEE09, 0xB41A, 0xF80B, 0x560B,
+  0xD80B, 0xF80B, 0x330B, 0x330B, 0xD80B, 0x330B, 0xEE09, 0x5613,
+  0xF80B, 0x4218, 0x0B21, 0xEE09, 0xD41A, 0x531A, 0x531A, 0x0B19,
+  0x0B21, 0x4220, 0x4218, 0x4220, 0x0B19, 0x0B21, 0x3149, 0x1169,
+  0x1161, 0x0000, 0x0000, 0x8BA0, 0xB1A8, 0xD1B0, 0x8B58, 0xB1B0,
+  0xB0E0, 0xB0E0, 0xB0E0, 0xAEE8, 0xAEE0, 0x0000, 0x8450, 0x8458,
+  0x8AC8, 0xAAE8, 0xAAE8, 0x8450, 0x2709, 0x0057, 0xC6C0, 0x65E1,
+  0x26E1, 0x06E9, 0xC6C0, 0xC490, 0xC8E0, 0xAAE8, 0x8AC8, 0x8458,
+  0xACE8, 0xAEE8, 0x4218, 0x0000, 0x8450, 0xB0E0, 0xAED0, 0x8EC8,
+  0xB1C8, 0xB1D0, 0x8B98, 0xB1A8, 0xD1B0, 0xD1B0, 0xD190, 0xF190,
+  0x8B60, 0x0B19, 0x3151, 0x3149, 0x0000, 0x0000, 0x0000, 0x4218,
+  0x9131, 0x531A, 0x531A, 0xB41A, 0xB412, 0x0B21, 0x0000, 0x5613,
+  0xF80B, 0xD80B, 0xD80B, 0x7904, 0x330B, 0x0000, 0x330B, 0x9904,
+  0xD80B, 0xF80B, 0xF80B, 0xEE09, 0x0000, 0x0000, 0x0000, 0xEE09,
+  0x531A, 0x1222, 0x0B21, 0x1222, 0x9131, 0x3149, 0x9129, 0x1169,
+  0x5149, 0x1161, 0x1161, 0xD190, 0x8458, 0xD190, 0xD1B0, 0x4218,
+  0x0000, 0x8B58, 0xB1C8, 0xB0E8, 0x8B58, 0xB0E0, 0xAEE8, 0x8EC8,
+  0x4218, 0xAEC8, 0xACE8, 0xACE8, 0x8B98, 0x280A, 0x001C, 0x8450,
+  0x06E9, 0xE7E8, 0xE7E0, 0xC8E0, 0xA8E0, 0x8B98, 0x8458, 0x8AC8,
+  0xACE8, 0x8B98, 0x0000, 0x0000, 0x4218, 0xAEE8, 0xB0E0, 0xB1C8,
+  0xB1D0, 0x4218, 0x0000, 0xB1B0, 0x8B98, 0x8B60, 0xD190, 0xF178,
+  0x1161, 0x4218, 0x3149, 0x282B, 0x0034, 0x1222, 0x1222, 0xB412,
+  0xB41A, 0x0B19, 0x0000, 0x0000, 0x5613, 0xD80B, 0xD80B, 0x990C,
+  0xD80B, 0x7904, 0x0000, 0x0000, 0xD80B, 0x990C, 0xD80B, 0xD80B,
+  0x560B, 0x5613, 0x4220, 0x0000, 0x0000, 0xEE09, 0x0E0A, 0x0B21,
+  0x9131, 0x9131, 0x9129, 0x0000, 0x3149, 0x8B60, 0x0000, 0x1169,
+  0xF178, 0xD190, 0xD190, 0xD1A8, 0x0000, 0x0000, 0x0000, 0xD1B0,
+  0xB1C8, 0x6B98, 0x8B60, 0xB0E0, 0xAEE8, 0xAEE0, 0xACE0, 0xACE8,
+  0x8450, 0x290C, 0x0019, 0x8450, 0xE490, 0xC8E8, 0x8AC8, 0x8AC8,
+  0x8B98, 0xACE0, 0xACE8, 0x6BA0, 0x4220, 0x4218, 0x4218, 0xB0E0,
+  0xB0E8, 0x8B98, 0x0000, 0x0000, 0x8458, 0xD1B0, 0x8B58, 0x0000,
+  0xD190, 0xF178, 0x1169, 0x1161, 0x292A, 0x0009, 0x4218, 0x4220,
+  0xB41A, 0x531A, 0x531A, 0x0000, 0x0000, 0x0B19, 0xD80B, 0x293A,
+  0x0023, 0x0B21, 0x7904, 0x990C, 0xF80B, 0x0000, 0xEE09, 0x5613,
+  0x0B19, 0x0000, 0x0000, 0xF221, 0x1222, 0x1222, 0x9131, 0x0B21,
+  0x0000, 0x5149, 0x3149, 0x0000, 0x0000, 0x4218, 0xD178, 0xD1B0,
+  0xD190, 0x0000, 0x0000, 0x0000, 0x8B58, 0xB0E0, 0xAEC8, 0x8ED0,
+  0x8B98, 0x8ED0, 0x8B98, 0x8458, 0x2A10, 0x0036, 0x4220, 0x8458,
+  0x8B60, 0x6BA0, 0x8B98, 0x8ED0, 0x8B98, 0x8EC8, 0xAEE8, 0xB1C8,
+  0x4218, 0x8B60, 0x0000, 0x8BA0, 0xB1A8, 0xD190, 0x0000, 0x8B58,
+  0xF178, 0xF178, 0x3149, 0x8B60, 0x0000, 0x3149, 0x0B21, 0x0000,
+  0x0000, 0x0B19, 0x1222, 0xB41A, 0x0000, 0x0000, 0x0000, 0x0B19,
+  0xF80B, 0x790C, 0x7904, 0x790C, 0x7904, 0x790C, 0x0000, 0x0000,
+  0x0000, 0x330B, 0x7904, 0x790C, 0x4218, 0x0000, 0x4220, 0x330B,
+  0x0B19, 0x4220, 0x1222, 0xF221, 0x2A4C, 0x000D, 0x4220, 0x8B60,
+  0x4218, 0x8B60, 0xF190, 0xD190, 0x8B60, 0x8B58, 0x8B60, 0x8BA0,
+  0x8B58, 0x8BA0, 0x4218, 0x2B16, 0x001E, 0x4218, 0x4218, 0x0000,
+  0x0000, 0x8ED0, 0x8B58, 0x8BA0, 0xB1A8, 0xB1D0, 0xD1B0, 0xD178,
+  0x4218, 0xF178, 0x1161, 0x1169, 0x5149, 0x3149, 0x0B21, 0x0000,
+  0x0000, 0x0000, 0xF221, 0xB41A, 0x0B19, 0x0000, 0x0000, 0x0000,
+  0x0B21, 0x7904, 0x790C, 0x2B3C, 0x0017, 0x7904, 0x790C, 0x330B,
+  0x0000, 0x0000, 0x0000, 0x3303, 0xB41A, 0xB412, 0x1222, 0x1222,
+  0x0B21, 0x0B19, 0x9131, 0x5149, 0x3149, 0x1169, 0x0B21, 0x3149,
+  0x0000, 0x0000, 0x0000, 0x4218, 0x2C18, 0x0038, 0x4220, 0xAEE8,
+  0xB1C8, 0xD1B0, 0xB1A8, 0xB1C8, 0xD1B0, 0xB1A8, 0xD190, 0xF190,
+  0x1161, 0x1161, 0x3149, 0x5149, 0x9131, 0x9131, 0x0000, 0x0000,
+  0x0B19, 0x1222, 0x531A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0B21,
+  0xD80B, 0x9904, 0x790C, 0x7904, 0x790C, 0xD80B, 0x0000, 0x0000,
+  0x0000, 0x0000, 0xEE09, 0x9904, 0xD80B, 0x4220, 0x0000, 0x0B21,
+  0xB412, 0xB412, 0x531A, 0x1222, 0x9131, 0x9131, 0x9131, 0x3149,
+  0x9131, 0x3149, 0x3149, 0x5149, 0x1169, 0xF178, 0x2D17, 0x0021,
+  0x6B98, 0xB0E0, 0xB0E0, 0xB0E0, 0xB1C8, 0xB1C8, 0xD1B0, 0xB1B0,
+  0x8B58, 0xF178, 0xD190, 0xF178, 0x1169, 0x1161, 0x5151, 0x3149,
+  0x9131, 0x3149, 0x0B19, 0x1222, 0xF221, 0x0B21, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0B21, 0x9904, 0xD80B, 0x790C, 0x7904, 0x790C,
+  0x3303, 0x2D3E, 0x0014, 0x790C, 0x3303, 0x423A, 0x5613, 0x5613,
+  0xB412, 0xB412, 0x1222, 0x1222, 0x9131, 0x9131, 0x9131, 0x3149,
+  0x3149, 0x1161, 0x1161, 0xF178, 0xD178, 0xD1B0, 0x6BA0, 0x2E15,
+  0x0017, 0x8458, 0xAEE8, 0xB0E0, 0xB0E0, 0xB0E0, 0xB1C8, 0xB1C8,
+  0xB1D0, 0xB1C8, 0x8B98, 0x0000, 0xD190, 0xF178, 0x8B60, 0xD178,
+  0x8B58, 0x3149, 0x5149, 0x3149, 0x9131, 0x9131, 0x9131, 0x9131,
+  0x2E31, 0x0007, 0x0B19, 0xF80B, 0x990C, 0x7904, 0x790C, 0x7904,
+  0xD80B, 0x2E3D, 0x0017, 0x4220, 0xD80B, 0xF80B, 0x560B, 0x5613,
+  0xB41A, 0xB412, 0xEE09, 0x1222, 0xEE09, 0x9131, 0x9131, 0x0000,
+  0x0B21, 0x1161, 0x3149, 0x1169, 0xF178, 0xD190, 0xF190, 0xD1A8,
+  0xB1B0, 0x8B58, 0x2F14, 0x0018, 0xAEC8, 0xAEE8, 0xB0E0, 0xB0E0,
+  0xB0E0, 0xB0E0, 0xB0E0, 0xB1C8, 0xB1D0, 0x8B60, 0x8B58, 0xD190,
+  0xD1B0, 0x8B60, 0xF178, 0x1161, 0x4220, 0x3149, 0x5149, 0x9131,
+  0x3149, 0x9131, 0x1222, 0x4220, 0x2F31, 0x0007, 0xEE09, 0xD80B,
+  0xD80B, 0x7904, 0x790C, 0x9904, 0x330B, 0x2F3E, 0x0017, 0x5613,
+  0x5613, 0x560B, 0xB41A, 0x5613, 0xB412, 0x0000, 0xEE09, 0x1222,
+  0x0B21, 0x5149, 0x9129, 0x8B60, 0x8B60, 0x1161, 0x1161, 0xD190,
+  0xD188, 0xD1B0, 0xB1A8, 0xB1D0, 0xB1C8, 0xD1B0, 0x3012, 0x001A,
+  0x4218, 0xACE8, 0xACE0, 0xAEE0, 0xAEE8, 0xB0E0, 0x8EC8, 0xB0E0,
+  0xB1C8, 0x8B98, 0xB1C8, 0xB1B0, 0x8B98, 0x8B60, 0xD178, 0x8B60,
+  0x1161, 0xF178, 0x0000, 0x3149, 0x3149, 0x5149, 0x9131, 0x9131,
+  0x9131, 0x1222, 0x3031, 0x0007, 0xEE09, 0x560B, 0xF80B, 0xD80B,
+  0x990C, 0xD80B, 0x3303, 0x303D, 0x0019, 0xEE09, 0x5613, 0x5613,
+  0x5613, 0x5613, 0xB412, 0x531A, 0x0000, 0x0B21, 0x9131, 0x0B19,
+  0x0B21, 0x3149, 0x0B21, 0x8B60, 0x1161, 0x1161, 0x8B60, 0xF190,
+  0x8B98, 0xB1B0, 0xD1B0, 0xB1C8, 0xB1C8, 0xB1C8, 0x3111, 0x0047,
+  0xE490, 0xACE0, 0xACE0, 0xAEE8, 0xAEE0, 0xAEE0, 0xAEE8, 0xB1C8,
+  0xB0E0, 0xB1B0, 0x8B98, 0xB1C8, 0xB1B0, 0xD1B0, 0x8B60, 0xD190,
+  0x0B19, 0xF178, 0x1161, 0x1169, 0x5149, 0x3149, 0x9131, 0x3149,
+  0x4220, 0x1222, 0x1222, 0x9131, 0x0000, 0x0000, 0x0000, 0x0000,
+  0xEE09, 0xD80B, 0xF80B, 0xD80B, 0xD80B, 0x790C, 0x3303, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x423A, 0xF80B, 0xD80B, 0x0E0A, 0xEE09,
+  0xB41A, 0xB41A, 0x531A, 0xEE09, 0x1222, 0x1222, 0x0B19, 0x3151,
+  0x0B19, 0x3151, 0x0B19, 0x1161, 0xF178, 0x8B60, 0xF178, 0x8B58,
+  0xD190, 0xB1C8, 0xB1B0, 0xB1C8, 0xB1C8, 0xB0E8, 0x8B60, 0x3210,
+  0x0049, 0x6B98, 0xAAE8, 0xAAE8, 0xACE0, 0xACE0, 0xAEE0, 0xAEE8,
+  0xB0E0, 0xAEE0, 0xB0E0, 0x4218, 0x4218, 0xB1D0, 0xD1B0, 0x0000,
+  0xB1A8, 0xD190, 0x8B58, 0xF178, 0xF178, 0x1161, 0x1169, 0x3149,
+  0x3149, 0x0000, 0x0000, 0x0B19, 0x1222, 0x1222, 0x4220, 0x0000,
+  0x0000, 0x0000, 0xEE09, 0x5613, 0xF80B, 0x5613, 0xD80B, 0xF80B,
+  0x3303, 0x0000, 0x0000, 0x0000, 0x0000, 0x330B, 0xD80B, 0xB41A,
+  0x0000, 0x0000, 0xEE09, 0x731A, 0x531A, 0x1222, 0xF221, 0x9131,
+  0x9131, 0x0B19, 0x3149, 0x4220, 0x0000, 0x1169, 0xF178, 0x0000,
+  0x8B60, 0xD190, 0xD1A8, 0xD1B0, 0xB1C8, 0xB1C8, 0xB0E0, 0xB0E0,
+  0xB0E0, 0x6B98, 0x330F, 0x004B, 0x8AC8, 0xAAE8, 0xAAE0, 0xACE0,
+  0xACE0, 0xAEE8, 0xAEE0, 0xB0E0, 0xAEE0, 0xB0E0, 0xB0E0, 0xB0E8,
+  0x8B98, 0xB1C8, 0xB1D0, 0x8B98, 0xD190, 0xD1A8, 0xD190, 0xD190,
+  0xF178, 0xF178, 0x1169, 0x3149, 0x3151, 0x0B19, 0x0000, 0x0000,
+  0x0B21, 0x1222, 0xEE09, 0x0000, 0x0000, 0x0000, 0x531A, 0x5613,
+  0x5613, 0xF80B, 0x560B, 0xF80B, 0x330B, 0x0000, 0x0000, 0x0000,
+  0xEE09, 0xD80B, 0x5613, 0x0000, 0x0000, 0x0000, 0xEE09, 0x531A,
+  0x1222, 0x1222, 0x9131, 0x1222, 0x9131, 0x3149, 0x3149, 0x0B19,
+  0x8B60, 0xF178, 0x8B60, 0x8B58, 0xD190, 0xD1B0, 0xB1A8, 0xB1C8,
+  0xB1C8, 0xB0E8, 0xB1C8, 0xB0E0, 0xB0E0, 0xB0E0, 0xD1B0, 0x340E,
+  0x001B, 0xC6C0, 0xC8E0, 0xA8E0, 0xAAE0, 0xAAE8, 0xACE0, 0xACE0,
+  0xACE0, 0x8B98, 0xAEE8, 0xAEE0, 0xB0E0, 0xB0E0, 0xB0E0, 0xB1C8,
+  0xB1C8, 0xB1B0, 0xD1A8, 0xD190, 0xD190, 0xF178, 0xF178, 0x1161,
+  0x1161, 0x3149, 0x3149, 0x9131, 0x342E, 0x002D, 0x0000, 0x0000,
+  0xEE09, 0x0E0A, 0xB412, 0x5613, 0x5613, 0x5613, 0xB412, 0xEE09,
+  0xEE09, 0x0000, 0x0000, 0x5613, 0x5613, 0x0B21, 0x0000, 0x0000,
+  0x0B19, 0x731A, 0xEE09, 0x1222, 0x9131, 0x9131, 0x9131, 0x9131,
+  0x9131, 0x3149, 0x3149, 0x1169, 0x1161, 0xF178, 0xF178, 0xD190,
+  0xD190, 0xD1A8, 0xD1B0, 0xB1C8, 0xB1C8, 0xB0E8, 0xB0E0, 0xB0E0,
+  0xAEE0, 0xB0E0, 0x6B98, 0x350D, 0x004F, 0xC6C0, 0xE7E0, 0xA8E8,
+  0xAAE0, 0xAAE0, 0xACE0, 0xACE8, 0xAEE8, 0x8B58, 0x0000, 0x8B98,
+  0xB0E0, 0xB0E0, 0xB0E8, 0xB1C8, 0xB1C8, 0xD1B0, 0xD188, 0xB1B0,
+  0xD1B0, 0xF190, 0xD190, 0xF178, 0x0000, 0x0B19, 0x1169, 0x0B19,
+  0x3149, 0x9131, 0x0000, 0x0000, 0x0B21, 0x1222, 0xEE09, 0x4220,
+  0xF221, 0x0000, 0xB412, 0xB41A, 0x5613, 0xB412, 0x330B, 0x0000,
+  0x3303, 0x0000, 0x0B21, 0xB41A, 0x3303, 0x0000, 0x0000, 0x4220,
+  0xB412, 0x1222, 0x1222, 0x9131, 0x0000, 0x0B21, 0x5149, 0x9131,
+  0x3149, 0x3149, 0x1161, 0x1161, 0xF178, 0xF178, 0xD188, 0xD190,
+  0xD1B0, 0xB1A8, 0x8B58, 0x0000, 0xB0E0, 0xB0E0, 0xB0E0, 0xB0E0,
+  0xB0E0, 0xAEE8, 0xAEE8, 0x8B98, 0x360C, 0x0051, 0x8450, 0xE7E8,
+  0xC8E0, 0xA8E8, 0xC8E0, 0xAAE0, 0xAAE0, 0xACE8, 0xACE0, 0x8AC8,
+  0x0000, 0x0000, 0xAEC8, 0xB1A8, 0x0000, 0x0000, 0x8B60, 0xB1C8,
+  0xD1B0, 0xB1C8, 0xB1A8, 0xD1B0, 0xD190, 0x0B19, 0x0000, 0x0000,
+  0x0B19, 0x0B21, 0x0000, 0x3149, 0x0B21, 0x0000, 0x0000, 0x9131,
+  0x9129, 0x9131, 0x4218, 0x0000, 0x731A, 0xB41A, 0xB412, 0xB41A,
+  0x531A, 0x0000, 0x0B21, 0x0B19, 0xEE09, 0xB41A, 0x4220, 0x0000,
+  0x4218, 0x531A, 0x0B21, 0x0000, 0x0B19, 0x4220, 0x0000, 0x0000,
+  0x9131, 0x3149, 0x5149, 0x1169, 0x1161, 0xF178, 0x4218, 0x0000,
+  0x4220, 0xD178, 0xD1B0, 0x4218, 0x0000, 0xC498, 0xB1D0, 0xB0E0,
+  0xB0E0, 0xB0E0, 0xAEE8, 0xAEE0, 0xAEE0, 0xAEE0, 0x8458, 0x370C,
+  0x0051, 0x06E9, 0xE7E0, 0x08E1, 0xA8E0, 0xAAE0, 0xAAE8, 0x08E1,
+  0xAAE0, 0xACE0, 0xACE8, 0x8B60, 0x4218, 0xB0E8, 0x8B98, 0x0000,
+  0x0000, 0x6B98, 0xB1D0, 0xB1C8, 0xB1C8, 0xD1B0, 0xD190, 0xD1B0,
+  0x0000, 0x0000, 0x0000, 0x8B60, 0x3149, 0x0000, 0x0000, 0x3149,
+  0x9131, 0x0000, 0x9131, 0x1222, 0x1222, 0x0000, 0x0000, 0x531A,
+  0x531A, 0xB412, 0x531A, 0x531A, 0x0000, 0x0B21, 0x531A, 0xB412,
+  0xB41A, 0x4218, 0x0B21, 0x531A, 0x0B19, 0x0000, 0x0B21, 0x9131,
+  0x0000, 0x0000, 0x0000, 0x5149, 0x3149, 0x1161, 0x1161, 0xD178,
+  0xF178, 0xD178, 0x0000, 0x0000, 0x8B60, 0xB1C8, 0x8458, 0x0000,
+  0xAEC8, 0xB0E0, 0xB0E0, 0xB0E0, 0xB0E0, 0xB0E0, 0xAEE0, 0xAEE0,
+  0xACE0, 0xACE8, 0x380C, 0x0052, 0x26E9, 0x06E1, 0xE7E0, 0xC8E8,
+  0xC8E0, 0xAAE0, 0xA8E0, 0xAAE8, 0xAAE0, 0xACE0, 0xAEC8, 0x6B98,
+  0xAEE8, 0xAEE0, 0x0000, 0x0000, 0xD1A8, 0xB0E8, 0xB1C8, 0xB1C8,
+  0x6B98, 0x4218, 0xD190, 0x4220, 0x0000, 0x0000, 0x0000, 0x5149,
+  0x0B19, 0x0000, 0x0000, 0x3151, 0x9131, 0x9131, 0x9129, 0x9131,
+  0x0000, 0x0000, 0x0E0A, 0x1222, 0xF221, 0x531A, 0xEE09, 0x0000,
+  0x0000, 0x1222, 0x1222, 0x531A, 0x1222, 0xF221, 0x4220, 0x0000,
+  0x0000, 0x9131, 0x0000, 0x0000, 0x0000, 0x0000, 0x3149, 0x0B19,
+  0x0000, 0x1169, 0x1161, 0xF178, 0xD190, 0x8B60, 0x0000, 0xD1B0,
+  0xD1A8, 0x6BA0, 0x8B98, 0xB0E0, 0xB1C8, 0xB0E8, 0xAEE0, 0xB0E0,
+  0xAEE0, 0xAEE8, 0xACE0, 0xACE0, 0xAAE0, 0x4218, 0x390B, 0x0053,
+  0x4218, 0x65E1, 0x06E9, 0x08E1, 0xC8E0, 0xA8E0, 0xC8E0, 0xAAE8,
+  0xAAE0, 0x6BA0, 0x8B98, 0xAEE0, 0x8AC8, 0x8BA0, 0xAEE8, 0x4218,
+  0x8450, 0xB0E0, 0xB0E0, 0xB0E8, 0xB1C8, 0xB1C8, 0xB1B0, 0xD1A8,
+  0x8B60, 0x8B60, 0x8B60, 0x8B60, 0x1161, 0x1169, 0x4218, 0x0000,
+  0x0000, 0x6B60, 0x9129, 0x9131, 0x4220, 0x0000, 0x0000, 0x1222,
+  0x1222, 0xF221, 0x1222, 0x1222, 0x0000, 0x0000, 0x0B19, 0xF221,
+  0x1222, 0x1222, 0x0000, 0x0000, 0x0000, 0x9131, 0x9131, 0x4220,
+  0x4218, 0x0B21, 0x4218, 0x1161, 0x8B60, 0x1161, 0x1161, 0xD178,
+  0xF178, 0xD1B0, 0xD190, 0x8458, 0xD1A8, 0xD190, 0x8B58, 0xB0E8,
+  0xB1C8, 0x6B98, 0xB0E0, 0xB0E0, 0xAEE0, 0xB0E0, 0xAEE0, 0xAEE8,
+  0xACE8, 0xACE8, 0x4218, 0x3A0B, 0x0053, 0x4218, 0x06E9, 0x06E9,
+  0xE7E0, 0xE7E0, 0xC8E8, 0xC8E0, 0xA8E0, 0xC6C0, 0x4218, 0x0000,
+  0xACE8, 0xAEE0, 0xAEE8, 0xAEE0, 0xAEC8, 0xB0E0, 0xB0E0, 0xB0E0,
+  0x8B58, 0x0000, 0xB1B0, 0xB1C8, 0x8B98, 0x8B60, 0x4218, 0x8B60,
+  0x8B60, 0xD178, 0x1161, 0x1169, 0x3149, 0x4218, 0x0000, 0x5149,
+  0x9131, 0x0000, 0x0000, 0x0000, 0x9131, 0x1222, 0x9131, 0x1222,
+  0xEE09, 0x0000, 0x0000, 0x0000, 0x9131, 0x1222, 0x4218, 0x0000,
+  0x0B21, 0x9131, 0x9131, 0x9131, 0x0B19, 0x3149, 0x0B21, 0x3149,
+  0x3149, 0x1169, 0x1161, 0x4218, 0x0000, 0xF190, 0xD190, 0xD1B0,
+  0xD1B0, 0xB1C8, 0xB1B0, 0xB1C8, 0xB1C8, 0x8B60, 0x0000, 0x8B98,
+  0xAEE8, 0xB0E0, 0xAEE0, 0xAEE8, 0xACE0, 0xACE0, 0xAAE0, 0x0000,
+  0x3B0C, 0x0015, 0x65E1, 0x26E1, 0x06E1, 0xE7E8, 0xE7E0, 0xA8E0,
+  0xAAE8, 0x8458, 0xE490, 0x8AC8, 0xAEE0, 0xACE0, 0xAEE8, 0xAEE0,
+  0xB0E0, 0xB0E0, 0xB0E0, 0xB0E8, 0x8B58, 0x8BA0, 0x6B98, 0x3B27,
+  0x0008, 0x8B60, 0xF178, 0x8B60, 0x1161, 0x1161, 0x1169, 0x5149,
+  0x3149, 0x3B34, 0x000E, 0x9131, 0x9131, 0x9129, 0x0000, 0x0000,
+  0x0000, 0x9131, 0x9131, 0x9131, 0x9131, 0x3149, 0x0B21, 0x5149,
+  0x9131, 0x3B47, 0x0016, 0x4218, 0x8B60, 0x0B19, 0x0000, 0xD190,
+  0xB1A8, 0xD1B0, 0xB1C8, 0xB1C8, 0xB1C8, 0xB1C8, 0xB0E8, 0x6B98,
+  0x8B60, 0x4218, 0xB0E0, 0xAEE0, 0xAEE8, 0xACE0, 0xAEE0, 0xACE0,
+  0xACE8, 0x3C0C, 0x0014, 0x65C1, 0x65E9, 0x08E1, 0xE7E0, 0xA8E0,
+  0xC8E8, 0xA8E0, 0xC6C0, 0x8B98, 0xACE8, 0xACE0, 0xACE0, 0xACE0,
+  0xAEE8, 0xAEE0, 0xB0E0, 0xB1A8, 0xB1C8, 0xB1C8, 0xE498, 0x3C27,
+  0x001B, 0xD178, 0xF178, 0x0000, 0x0000, 0x4218, 0x8B60, 0x1161,
+  0x4218, 0x0000, 0x0000, 0x0000, 0x0B21, 0x9131, 0x9131, 0x9131,
+  0x0B19, 0x0000, 0x0000, 0x0000, 0x0B21, 0x9131, 0x0B19, 0x4220,
+  0x0000, 0x0000, 0x0B19, 0x3149, 0x3C49, 0x0014, 0x0B21, 0xD190,
+  0xD1B0, 0x8B98, 0xB1B0, 0xD1B0, 0xB1C8, 0xB1C8, 0xB0E0, 0xB1C8,
+  0xB0E8, 0x8EC8, 0xE490, 0xAEE8, 0xAEE0, 0xACE0, 0xACE8, 0xACE0,
+  0xACE0, 0x8AC8, 0x3D0C, 0x0015, 0x85C1, 0x65E1, 0x06E1, 0xE7E8,
+  0x08E1, 0xA8E0, 0xC8E0, 0xA8E0, 0xACE8, 0xAAE0, 0xACE8, 0xE490,
+  0x8EC8, 0xAEE0, 0xAEE0, 0xAEE8, 0xAED0, 0x6B98, 0xB0E0, 0xD1B0,
+  0x8B60, 0x3D27, 0x001B, 0xD190, 0xF178, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0B21, 0x0B21, 0x0000, 0x0000, 0x0000, 0x5149, 0x9131,
+  0x3149, 0x9131, 0x5149, 0x0000, 0x0000, 0x0000, 0x0B19, 0x0B21,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x3149, 0x3151, 0x3D48, 0x0015,
+  0xF178, 0xD190, 0xD1A8, 0xD190, 0x8B60, 0xD1A8, 0xB1D0, 0xB1C8,
+  0xB0E0, 0xD1A8, 0xB1C8, 0xB0E0, 0xB0E0, 0xAEE0, 0xAEE8, 0xAEE0,
+  0xAEE0, 0xACE0, 0xACE8, 0xAAE0, 0x8AC8, 0x3E0C, 0x0051, 0xC490,
+  0x65E9, 0x06E1, 0x06E9, 0xE7E0, 0xE7E0, 0xC8E0, 0xAAE8, 0xC8E0,
+  0xAAE0, 0x6B98, 0x0000, 0xE490, 0xAEE8, 0xAEE8, 0xB0E0, 0xAEE0,
+  0xB1A8, 0x0000, 0x8B98, 0xB1B0, 0xB1C8, 0xB1C8, 0xB1D0, 0xD1A8,
+  0xB1B0, 0xD188, 0xD1B0, 0x0B19, 0x0000, 0x0000, 0x0000, 0x4218,
+  0x1169, 0x0000, 0x0000, 0x0000, 0x0000, 0x0B19, 0x3151, 0x5149,
+  0x3149, 0x0B21, 0x0000, 0x0000, 0x0000, 0x0000, 0x5149, 0x4220,
+  0x0000, 0x0000, 0x0000, 0x0B19, 0x1169, 0x8B60, 0x1161, 0x1161,
+  0xF178, 0xD178, 0xF178, 0xD190, 0xF178, 0x0000, 0x8B60, 0xB1B0,
+  0xB1C8, 0xB1C8, 0xB0E0, 0x8B98, 0x0000, 0x8B60, 0xB0E8, 0xAEE0,
+  0xAEE0, 0xAEE8, 0xAEE0, 0xACE0, 0xACE0, 0xAAE8, 0xAAE0, 0x8450,
+  0x3F0C, 0x0022, 0xE490, 0x45E1, 0x65E9, 0x26E1, 0x06E1, 0xE7E0,
+  0x08E1, 0xA8E8, 0xAAE0, 0xAAE8, 0x27D1, 0xAEC8, 0xACE0, 0xACE0,
+  0xAEE0, 0xAEE8, 0xB0E8, 0x0000, 0x0000, 0x0000, 0x0000, 0x4218,
+  0xD178, 0x8B98, 0x6BA0, 0xD1A8, 0xB1C8, 0xD190, 0x8BA0, 0x0000,
+  0x0000, 0x4218, 0xF190, 0x8B60, 0x3F33, 0x0003, 0x3149, 0x1169,
+  0x5149, 0x3F3B, 0x0021, 0x3149, 0x1169, 0x4218, 0x0000, 0x0000,
+  0x5149, 0x3149, 0xD178, 0xF178, 0xD178, 0x8B60, 0x8B60, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0xB1C8, 0xB1C8, 0xB1C8, 0xB0E0,
+  0xB0E0, 0xAEC8, 0x8EC8, 0xB0E0, 0xB0E0, 0xAEE8, 0xAEE0, 0xACE0,
+  0xACE0, 0xACE8, 0xACE0, 0xAAE8, 0x400C, 0x0011, 0x8458, 0xA6E1,
+  0x06E9, 0x26E1, 0x08E1, 0xE7E0, 0xC8E8, 0xA8E0, 0xC8E0, 0xAAE0,
+  0xAAE8, 0xACE0, 0xACE0, 0xACE0, 0xACE8, 0xAEE0, 0xC490, 0x4025,
+  0x0009, 0x8B58, 0x8B60, 0xD1B0, 0x8B58, 0x0000, 0x4218, 0xD190,
+  0xD190, 0x4220, 0x4033, 0x0003, 0x4218, 0x0B21, 0x4218, 0x403B,
+  0x0009, 0x4220, 0x1169, 0x1161, 0x4218, 0x0000, 0x8B60, 0x1169,
+  0xF178, 0x4218, 0x404C, 0x0011, 0x8458, 0xB1D0, 0xB1C8, 0xB0E8,
+  0xB0E0, 0xB0E0, 0xAEE0, 0xB0E0, 0xAEE0, 0xAEE8, 0xACE0, 0xACE0,
+  0xACE0, 0xACE8, 0xAAE0, 0xAAE0, 0x4218, 0x410C, 0x0010, 0x4218,
+  0xA6E1, 0x65E9, 0x06E1, 0x06E1, 0xE7E0, 0xE7E8, 0xC6C0, 0xC6C0,
+  0xC8E0, 0xAAE0, 0xC6C0, 0xACE0, 0xACE8, 0xAEE8, 0xACE8, 0x4124,
+  0x0009, 0x6B98, 0x8B60, 0x8B58, 0xD1B0, 0xD190, 0x8B98, 0xD1B0,
+  0xD188, 0xD190, 0x413C, 0x0007, 0xF178, 0xD178, 0xF178, 0x8B60,
+  0xD190, 0xF178, 0x8B58, 0x414D, 0x000F, 0x8EC8, 0xB0E0, 0xB0E0,
+  0xB0E0, 0xB0E0, 0xB0E0, 0xAEE0, 0xAEE8, 0xACE0, 0xAEE0, 0xACE0,
+  0xACE8, 0xAAE0, 0xAAE8, 0xC8E8, 0x420D, 0x0020, 0xC5E9, 0x65E9,
+  0x65E1, 0x06E1, 0x06E1, 0x8458, 0x0000, 0x0000, 0xC8E8, 0xE490,
+  0x0000, 0x0000, 0x8B58, 0xACE8, 0xAEE0, 0x6B98, 0xAED0, 0x6B98,
+  0x8B98, 0x8458, 0x4218, 0x0000, 0x0000, 0x8B60, 0x6BA0, 0xB1D0,
+  0xB1C8, 0xD1A8, 0xB1B0, 0xD1A8, 0xB1B0, 0x8B58, 0x423C, 0x0020,
+  0x4218, 0xF178, 0xD178, 0xD190, 0xF178, 0xD190, 0x8B60, 0x4218,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8B60, 0x8BA0, 0xD1B0,
+  0x8B58, 0xB1D0, 0xB0E0, 0x6B98, 0x4218, 0x0000, 0x8458, 0xAEE8,
+  0x8458, 0x0000, 0x8B60, 0xACE8, 0xAAE0, 0xAAE0, 0xC8E8, 0xA8E0,
+  0x430D, 0x0020, 0x65C1, 0xC5E9, 0x65E1, 0x45E1, 0xC6C0, 0x0000,
+  0x0000, 0x0000, 0xC8E8, 0xAAE8, 0x4218, 0x6B98, 0xAAE0, 0xACE8,
+  0xACE0, 0xAEE0, 0xAEE0, 0xB0E0, 0xAEE8, 0xB0E0, 0xB0E0, 0xB0E0,
+  0xAEE0, 0xAEE8, 0xB1C8, 0xB0E0, 0xB1C8, 0xB1C8, 0xD1B0, 0xB1A8,
+  0x8BA0, 0x8B60, 0x433C, 0x0020, 0x8B60, 0x4218, 0xF178, 0xD190,
+  0xD1A8, 0xD190, 0xD1A8, 0xD190, 0xD190, 0x8B98, 0xB1B0, 0xD1A8,
+  0xB1D0, 0xB1C8, 0xB0E0, 0xB0E0, 0xB0E0, 0xB0E0, 0xB0E0, 0x8EC8,
+  0xE498, 0x0000, 0x6B98, 0xAEE8, 0x8450, 0x0000, 0x0000, 0xE490,
+  0xACE8, 0xAAE0, 0xAAE0, 0xC6C0, 0x440D, 0x001F, 0x85C1, 0xA6E1,
+  0x65E9, 0x45E1, 0xE490, 0x0000, 0x0000, 0x0000, 0xC490, 0xC8E8,
+  0xAAE8, 0xAAE0, 0xAAE0, 0xAAE0, 0xACE8, 0xACE0, 0xAEE0, 0xACE0,
+  0xAEE8, 0xAEE0, 0xB0E0, 0xAEE0, 0xB0E0, 0xB0E0, 0xB0E0, 0xB1C8,
+  0xB1C8, 0xB1C8, 0xB1D0, 0x4218, 0xD190, 0x443C, 0x0020, 0x4220,
+  0x8BA0, 0x0000, 0xB1A8, 0xD190, 0xD1A8, 0xD1B0, 0xB1A8, 0xD1B0,
+  0xB1C8, 0xB1B0, 0xB1C8, 0xB1C8, 0xB0E0, 0xB1C8, 0xB0E8, 0xB0E0,
+  0xB0E0, 0xAEE0, 0xB0E0, 0xAEE0, 0xAEE8, 0xACE0, 0xAEC8, 0x0000,
+  0x0000, 0x0000, 0x4218, 0xAAE8, 0xAAE0, 0xA8E8, 0xE490, 0x450D,
+  0x001F, 0x8450, 0xC5E9, 0xA6E9, 0xC5E9, 0x8458, 0x0000, 0x0000,
+  0x0000, 0x4218, 0xC8E0, 0xA8E0, 0xAAE8, 0xAAE0, 0xAAE8, 0x8458,
+  0x8450, 0xACE0, 0xAEE8, 0xAEE0, 0xB0E0, 0xAEE0, 0xB0E0, 0xAEE8,
+  0xB0E0, 0xB0E0, 0xB0E0, 0xB0E0, 0xB0E0, 0x8B60, 0x8B98, 0xD1B0,
+  0x453D, 0x001F, 0xD190, 0x8B60, 0x4218, 0xB1C8, 0xB1B0, 0xB1C8,
+  0xD1A8, 0xB1D0, 0xB1C8, 0xB1C8, 0xB1C8, 0xB0E0, 0xB0E0, 0xB0E0,
+  0xB0E0, 0xB1B0, 0x8B98, 0xB0E0, 0xAEE0, 0xB0E0, 0xAEE0, 0xAEE8,
+  0xC490, 0x0000, 0x0000, 0x0000, 0x0000, 0xAAE0, 0xC8E8, 0xA8E8,
+  0x8450, 0x460D, 0x001F, 0x4218, 0xC5F1, 0xC5E9, 0x65E1, 0x8450,
+  0x0000, 0x0000, 0x0000, 0x6BA0, 0xC8E8, 0xA8E0, 0x8AC8, 0x8450,
+  0x0000, 0x0000, 0x8B60, 0xACE8, 0xACE0, 0xAEE0, 0xAEC8, 0xAEE8,
+  0x8B98, 0xAEE8, 0xAEE0, 0xB0E0, 0x8EC8, 0xB0E0, 0xB1C8, 0x0000,
+  0x8B98, 0x6BA0, 0x463D, 0x001E, 0x8B98, 0x6B98, 0x0000, 0xD1B0,
+  0xB1C8, 0xB1B0, 0xB1C8, 0xB1C8, 0xB1D0, 0x8B98, 0xB0E0, 0xB1C8,
+  0xB0E8, 0xB0E0, 0xB0E0, 0x6B98, 0x0000, 0x0000, 0x8B58, 0xAED0,
+  0xAEE8, 0xACE0, 0x8EC8, 0x0000, 0x0000, 0x0000, 0x4218, 0xC8E8,
+  0xA8E0, 0xC8E8, 0x470E, 0x001E, 0x85F2, 0xC5E9, 0xC5E9, 0x8450,
+  0x0000, 0x0000, 0x0000, 0xC6C0, 0x08E1, 0xA8E8, 0xC6C0, 0x0000,
+  0x0000, 0x8458, 0xACE0, 0xACE0, 0xACE8, 0x8458, 0x8450, 0xAEE8,
+  0xAEE0, 0xAEE8, 0xAEC8, 0x0000, 0xC490, 0xB0E8, 0x8B98, 0x8B60,
+  0xB0E8, 0x0000, 0x473E, 0x001D, 0xAED0, 0x4218, 0x8B58, 0xB1D0,
+  0xD190, 0x4218, 0xB1C8, 0xB1C8, 0xB0E0, 0xB0E8, 0x6B98, 0x8458,
+  0xB0E0, 0xB0E0, 0xB0E0, 0x8B60, 0x0000, 0x0000, 0xE490, 0xACE0,
+  0xACE0, 0xAAE8, 0x0000, 0x0000, 0x0000, 0x4218, 0xE7E0, 0xA8E8,
+  0x08E1, 0x480E, 0x001D, 0x65C1, 0x85F2, 0xC5E9, 0xC490, 0x0000,
+  0x0000, 0x0000, 0xC6C0, 0xE7E0, 0xE7E0, 0xC6C0, 0x8450, 0x8458,
+  0xAAE8, 0xAAE8, 0xACE0, 0x8450, 0x0000, 0x8BA0, 0xAEE0, 0xACE8,
+  0x8450, 0x0000, 0x8B60, 0xAEE8, 0xB0E0, 0x8EC8, 0xB0E0, 0x8B98,
+  0x483E, 0x001D, 0x6B98, 0xB1D0, 0xD1A8, 0xB0E0, 0xB1C8, 0x8458,
+  0x0000, 0x8458, 0xB1D0, 0xB0E0, 0x6B98, 0x0000, 0x8B60, 0xAEE8,
+  0xAEE0, 0xAEE0, 0x4218, 0x8458, 0x8AC8, 0xAAE8, 0xAAE0, 0xAAC8,
+  0x0000, 0x0000, 0x0000, 0x8458, 0x8B98, 0xE7E8, 0xC490, 0x490E,
+  0x001D, 0xA362, 0x85F2, 0xA362, 0x8458, 0x8458, 0x0000, 0x0000,
+  0x0000, 0x26E1, 0xE7E0, 0x8AC8, 0xC6C0, 0xA8E0, 0xC8E8, 0xAAE8,
+  0x8458, 0x0000, 0x4218, 0xACE0, 0xACE8, 0x0000, 0x0000, 0x6B98,
+  0xAEE0, 0xB0E0, 0xAED0, 0x8B58, 0x8ED0, 0x8B60, 0x493E, 0x001D,
+  0x8B58, 0xB1D0, 0x8B98, 0x8EC8, 0xB0E0, 0xB0E0, 0x8B58, 0x0000,
+  0x0000, 0xAEE8, 0xB0E8, 0x4218, 0x0000, 0x8450, 0xAEE8, 0xAEE0,
+  0xAEE8, 0x8B98, 0x6B98, 0xACE0, 0xACE8, 0x8458, 0x0000, 0x0000,
+  0x0000, 0x8458, 0xC6C0, 0xE7E8, 0xE490, 0x4A0E, 0x001C, 0x4218,
+  0x85F2, 0x65C9, 0x4218, 0xC498, 0x0000, 0x0000, 0x0000, 0x8458,
+  0x06E9, 0xE7E0, 0xE7E0, 0xC8E8, 0xE7E0, 0x8450, 0xE498, 0x8AC8,
+  0xACE8, 0xAAE0, 0xACE0, 0x8450, 0x8AC8, 0xACE8, 0xAEE8, 0x4218,
+  0x0000, 0xAEC8, 0xAEE8, 0x4A40, 0x001A, 0xAEC8, 0x0000, 0x4218,
+  0xB0E8, 0xAEE0, 0x8EC8, 0x0000, 0xAEE8, 0xAEE0, 0xAEE0, 0x8B98,
+  0x0000, 0x4218, 0x8ED0, 0xACE8, 0xACE0, 0xAAE0, 0xAAE8, 0x8AC8,
+  0x0000, 0x0000, 0x0000, 0x8450, 0x8458, 0xC6C0, 0x26E9, 0x4B0F,
+  0x001B, 0x85F2, 0x65F2, 0x4218, 0x4232, 0x85C9, 0xC490, 0x0000,
+  0x85C1, 0x26E1, 0x06E1, 0xE7E0, 0x08E1, 0x8AC8, 0xAAE8, 0xC8E0,
+  0xAAE8, 0xC6C0, 0x0000, 0x6B98, 0xACE0, 0xACE8, 0x8B98, 0x0000,
+  0x0000, 0xAEE8, 0xAEE8, 0x4218, 0x4B3F, 0x001B, 0x4218, 0xB0E0,
+  0x8EC8, 0x0000, 0x0000, 0x8B98, 0xAEE8, 0xB0E0, 0xAEE8, 0x4218,
+  0x8B98, 0xAEE0, 0xACE8, 0xACE0, 0x8AC8, 0xACE0, 0xAAE0, 0xACE8,
+  0xAAE8, 0x8AC8, 0x0000, 0x4218, 0x8458, 0xE498, 0x4218, 0x26E1,
+  0x06E9, 0x4C0F, 0x001A, 0x64CA, 0x65F2, 0xA39A, 0x0000, 0x8458,
+  0xE490, 0xA6E9, 0x65E1, 0x4218, 0x0000, 0x8458, 0x0000, 0xC6C8,
+  0xA8E0, 0xC8E8, 0xC490, 0x0000, 0x0000, 0x8B98, 0x8AC8, 0x4218,
+  0x0000, 0x4220, 0xACE8, 0xAEE0, 0x8B58, 0x4C40, 0x001A, 0x8458,
+  0xAED0, 0x8EC8, 0x0000, 0x0000, 0x4218, 0xAED0, 0x8AC8, 0x0000,
+  0x0000, 0x8B60, 0xACE8, 0xACE0, 0xAAE0, 0x4218, 0x4218, 0x0000,
+  0x4220, 0xC8E8, 0xA8E8, 0xE490, 0x8450, 0x0000, 0x8458, 0x06E9,
+  0xC6C0, 0x4D0F, 0x001A, 0x8450, 0x65FB, 0x64CA, 0x0000, 0x0000,
+  0x8458, 0xC5E9, 0x8450, 0x0000, 0x0000, 0x0000, 0x0000, 0xE7E8,
+  0xE7E0, 0xC6C0, 0x0000, 0x0000, 0xC8E0, 0x8AC8, 0x0000, 0x0000,
+  0x0000, 0xAEC8, 0xAAE8, 0x8EC8, 0x8BA0, 0x4D40, 0x001A, 0xAEC8,
+  0x8AC8, 0x6B98, 0xAED0, 0x4218, 0x0000, 0x0000, 0x8AC8, 0xAEC8,
+  0x0000, 0x0000, 0x8AC8, 0xACE0, 0xAAE8, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x8458, 0xC8E8, 0xC490, 0x0000, 0x0000, 0x8450, 0x65E9,
+  0x8458, 0x4E10, 0x0018, 0x65FB, 0x65F3, 0x0000, 0xA39A, 0xC5E9,
+  0x8450, 0x0000, 0x0000, 0x0000, 0x0000, 0xE498, 0x06E9, 0xE7E0,
+  0x8450, 0x0000, 0xC8E8, 0x6B98, 0x0000, 0x0000, 0x0000, 0x8BA0,
+  0x8EC8, 0xAAE8, 0xACE0, 0x4E41, 0x0018, 0xAEE0, 0x8AC8, 0x8B98,
+  0x8B98, 0x4218, 0x0000, 0x0000, 0x8AD0, 0x8AC8, 0x0000, 0x8458,
+  0xAAE8, 0xAAE0, 0xE490, 0x0000, 0x0000, 0x0000, 0x0000, 0x8458,
+  0xE7E8, 0xE490, 0x0000, 0x65C1, 0x65E9, 0x4F10, 0x0018, 0x84CB,
+  0x65F3, 0x65FB, 0x85F2, 0x64CA, 0x4218, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x65E1, 0x26E9, 0x06E9, 0x4218, 0x27D1, 0xC6C0, 0x0000,
+  0x0000, 0x0000, 0x6B98, 0xAAE0, 0xAAE8, 0x08E1, 0xE490, 0x4F41,
+  0x0018, 0xC490, 0xAEE8, 0xAEC8, 0xAEC8, 0x8AC8, 0x0000, 0x0000,
+  0x0000, 0xAAC8, 0x8AC8, 0x0000, 0xAAE0, 0xC8E8, 0xAAE8, 0x8450,
+  0x0000, 0x0000, 0x0000, 0x0000, 0xC6C0, 0x06E1, 0x65C1, 0x65E9,
+  0x65C1, 0x5010, 0x0017, 0x6450, 0x65FB, 0x85F2, 0x8450, 0x64CA,
+  0x85F2, 0x65C1, 0xC490, 0xE498, 0xC5E9, 0x65C1, 0x0000, 0x27D1,
+  0x06E9, 0xE490, 0x0000, 0x0000, 0x0000, 0x8458, 0xC8E8, 0xA8E0,
+  0xAAE0, 0x8AC8, 0x5042, 0x0017, 0xAAC8, 0xACE8, 0xAAE0, 0xACE0,
+  0x8450, 0x0000, 0x0000, 0x0000, 0xE498, 0xA8E8, 0xC8E0, 0x8450,
+  0xC498, 0xC8E8, 0xC490, 0x8458, 0x8458, 0x06E9, 0xC6C0, 0x4218,
+  0xC6C0, 0x65E9, 0x8450, 0x5111, 0x0016, 0x65F3, 0x65FB, 0xE498,
+  0x84CB, 0xC490, 0xC39A, 0x8458, 0x64CA, 0xC5E9, 0x0000, 0x4218,
+  0x65E1, 0x06E9, 0x06E1, 0xC6C0, 0xC6C0, 0xC6C0, 0xE7E0, 0xC8E0,
+  0xA8E8, 0xC8E8, 0x8450, 0x5142, 0x0016, 0xC490, 0xAAE8, 0xACE0,
+  0xAAE0, 0xAAE8, 0x8B98, 0xC6C0, 0x6BA0, 0x8B98, 0xA8E0, 0xC8E0,
+  0xC6C0, 0x0000, 0xE7E0, 0x26E9, 0x8458, 0xC6C0, 0xC6C0, 0x06E1,
+  0xE490, 0xC5E9, 0xA6E9, 0x5211, 0x0015, 0x84CB, 0x84CB, 0x0000,
+  0xC490, 0x4218, 0x8458, 0x85F2, 0xC5E9, 0x8458, 0x0000, 0xA6E9,
+  0x65E1, 0x45E1, 0x06E9, 0x26E1, 0x08E1, 0x08E1, 0xE7E0, 0xE7E0,
+  0xC8E8, 0xC6C0, 0x5243, 0x0015, 0x8AC8, 0xAAE0, 0xAAE0, 0xC8E0,
+  0xAAE8, 0xA8E0, 0xC8E0, 0xA8E0, 0xC8E8, 0xA8E0, 0xE7E0, 0x0000,
+  0x4218, 0x08E1, 0x27D9, 0x8450, 0x8458, 0x8458, 0x4218, 0xC5F1,
+  0x85C1, 0x5311, 0x0014, 0x8450, 0x85FC, 0x64CA, 0x84CB, 0xA39A,
+  0x65F3, 0x85F2, 0x64CA, 0x0000, 0x64CA, 0xC5E9, 0xC490, 0x8458,
+  0xE498, 0x8450, 0x65E1, 0x06E9, 0x06E1, 0xE7E8, 0x08E9, 0x5343,
+  0x0014, 0x4218, 0xAAE0, 0xC8E0, 0xAAE0, 0xA8E8, 0xC8E8, 0xC490,
+  0xE498, 0xC490, 0xE490, 0xE7E0, 0xC6C0, 0x0000, 0x65C1, 0x65E9,
+  0xA6E9, 0x8450, 0x65C9, 0xC5E9, 0x85F2, 0x5412, 0x0013, 0x84CB,
+  0x85FC, 0x65FB, 0x65F3, 0x65F2, 0x4218, 0x8458, 0xA39A, 0xC5E9,
+  0x85C1, 0xC490, 0xE498, 0x45E9, 0x65E1, 0x45E1, 0x65E9, 0x06E1,
+  0x06E1, 0x8450, 0x5444, 0x0013, 0x8458, 0xC8E8, 0xC8E8, 0xA8E0,
+  0xC8E0, 0xE7E0, 0xE7E8, 0xC490, 0x8450, 0x06E9, 0x26E9, 0xE490,
+  0xC490, 0x8458, 0xC6C0, 0xC5E9, 0xC5E9, 0x85F2, 0x65C1, 0x5512,
+  0x0012, 0x2232, 0x85FC, 0x65FC, 0xA362, 0xA36A, 0x4218, 0x84CB,
+  0x85F2, 0x8458, 0x8450, 0x85EA, 0xC5E9, 0xC5E9, 0xA6E1, 0xC5E9,
+  0x65E9, 0x65E1, 0xC6C0, 0x5545, 0x0012, 0xC6C0, 0xE7E0, 0xE7E0,
+  0x06E9, 0xE7E0, 0x26E1, 0x06E1, 0x45E9, 0xE498, 0x4218, 0x45E9,
+  0xC5E9, 0x8458, 0x8450, 0xC490, 0x85F2, 0x85F2, 0x4218, 0x5613,
+  0x0010, 0x84CC, 0x65FC, 0x0000, 0xC490, 0xC39A, 0x65FB, 0x85F2,
+  0xC490, 0x85F2, 0x65EA, 0x85F2, 0xC5E9, 0xC5E1, 0xA6E1, 0xC5E9,
+  0x65C1, 0x5646, 0x0010, 0xC6C0, 0x06E1, 0x08E1, 0x26E9, 0x06E1,
+  0x65E1, 0x06E1, 0x65E9, 0x8450, 0x85C1, 0xA6E9, 0xE490, 0x8458,
+  0x8458, 0x85F2, 0xA39A, 0x5713, 0x000F, 0x0000, 0x85FD, 0x84CB,
+  0x84CB, 0x85FC, 0x84CB, 0xA39A, 0x65F3, 0x65FB, 0x65F3, 0x65EA,
+  0x85F2, 0x65EA, 0x85F2, 0xC5E9, 0x5747, 0x000E, 0xC6C0, 0x65E1,
+  0x45E1, 0x65E1, 0x65E1, 0xC5E9, 0xA6E1, 0xC5E9, 0x65C1, 0x64CA,
+  0xC5E9, 0x65F2, 0x85EA, 0x65FB, 0x5814, 0x000D, 0xA362, 0x65FD,
+  0x85F4, 0x65FC, 0x65F3, 0x85FC, 0x65F3, 0x65F3, 0x65F2, 0x65F3,
+  0x85EA, 0x65F2, 0xC5E9, 0x5848, 0x000D, 0x8450, 0x45E9, 0x65E1,
+  0xC5E9, 0xC5E9, 0xC5E9, 0xA6E1, 0x85EA, 0xA6E1, 0x85F2, 0x85EA,
+  0x65F3, 0x6458, 0x5915, 0x000B, 0xA39A, 0x85F5, 0x65FC, 0x85FD,
+  0x65F4, 0x85FC, 0x65F3, 0x85FC, 0x65F3, 0x65FB, 0xA39A, 0x5949,
+  0x000B, 0x8450, 0xC5E9, 0xC5E9, 0x65EA, 0xC5E9, 0x85EA, 0x65F2,
+  0x65F3, 0x85F2, 0x65FB, 0xE490, 0x5A16, 0x0009, 0xA362, 0x85FD,
+  0x65FC, 0x85FC, 0x65F4, 0x85FC, 0x65F3, 0x65F3, 0x6450, 0x5A4A,
+  0x0009, 0x4218, 0x64D2, 0xC5E9, 0x85F2, 0x85F2, 0x65F3, 0x65F2,
+  0x65F3, 0x8450, 0x5B17, 0x0006, 0x4218, 0x84CC, 0x64CC, 0x84D4,
+  0x84CB, 0x2232, 0x5B4C, 0x0006, 0x4232, 0x65C1, 0x84CB, 0x85F2,
+  0x64D2, 0x4218, 0x0005, 0x0006, 0xA36A, 0xE59C, 0x85CD, 0xE59C,
+  0xA66C, 0x4218, 0x005E, 0x0006, 0x4220, 0xA39A, 0xE59C, 0x85D5,
+  0xE59C, 0xA36A, 0x0104, 0x0009, 0xA664, 0xA7A6, 0x26CF, 0x26CF,
+  0x25FF, 0x86CE, 0x86D6, 0xA3A2, 0x4232, 0x015C, 0x0009, 0x4232,
+  0xA39A, 0x64CC, 0x65F5, 0x65FE, 0x65FE, 0x85FE, 0x65D5, 0xA664,
+  0x0203, 0x000D, 0xC7AE, 0xA7A6, 0x26D7, 0x26CF, 0x25F7, 0x26CF,
+  0x25FF, 0x25F7, 0x25F7, 0x65FE, 0x65FE, 0x84CB, 0x4218, 0x0259,
+  0x000D, 0x4218, 0xA3A2, 0x85FC, 0x65FC, 0x85FD, 0x65F5, 0x85FD,
+  0x65FD, 0x85FE, 0x65F6, 0x25F7, 0x65FE, 0x66CE, 0x0302, 0x0010,
+  0x6786, 0x26D7, 0x26CF, 0x26CF, 0x25F7, 0x25FF, 0x25F7, 0x25F7,
+  0x25F7, 0x25FF, 0x25F7, 0x65FE, 0x65FE, 0x85FD, 0x65FD, 0x4232,
+  0x0357, 0x0010, 0x8450, 0x65F3, 0x65F3, 0x65FC, 0x85F4, 0x65FC,
+  0x85F4, 0x65FD, 0x85FD, 0x65FD, 0x65F5, 0x65FE, 0x65FE, 0x25FF,
+  0x85FE, 0x65CD, 0x0401, 0x0013, 0x2232, 0xC7A6, 0x26D7, 0x26CF,
+  0x25F7, 0x26CF, 0x25FF, 0x25F7, 0x25F7, 0x65FE, 0x65FE, 0x65FE,
+  0x65FE, 0x65F5, 0x85FD, 0x65FD, 0x85FD, 0x64CC, 0xA362, 0x0455,
+  0x0013, 0xC490, 0xC5E9, 0x85F2, 0x85EA, 0x65F3, 0x65FB, 0x65F3,
+  0x65F3, 0x65FC, 0x85F4, 0x65FD, 0x85FD, 0x65FD, 0x85F5, 0x65FE,
+  0x65FE, 0x65FE, 0x65F6, 0x4218, 0x0501, 0x0015, 0xA664, 0x26CF,
+  0x26CF, 0x25F7, 0x66D6, 0x25F7, 0x25F7, 0x25FF, 0x25F7, 0x25F7,
+  0x65F6, 0x85FE, 0x65FD, 0x85FD, 0x65F5, 0x85FD, 0x65FC, 0x85F4,
+  0x65FB, 0x85FC, 0xA362, 0x0553, 0x0015, 0xC490, 0xC5E1, 0xC5E9,
+  0x65F2, 0xC5E9, 0x85EA, 0x65F2, 0x65F3, 0x65F3, 0x85FC, 0x65F3,
+  0x65F4, 0x85FC, 0x65FD, 0x85F5, 0x65FD, 0x65FD, 0x65FE, 0x85FE,
+  0x25FF, 0xA39A, 0x0601, 0x0017, 0xC7AE, 0x26CF, 0x25FF, 0x65CD,
+  0x0000, 0xE59C, 0x25F7, 0x65FE, 0x25F7, 0x65FE, 0x65FE, 0x65FD,
+  0x85FD, 0x65FD, 0x85F5, 0x65FC, 0x85F4, 0x65F3, 0x65FB, 0x65F3,
+  0x65F3, 0x65F2, 0xA362, 0x0651, 0x0017, 0xC490, 0x06E9, 0x65E1,
+  0x65E1, 0xC5E9, 0xC5E9, 0xC5E9, 0xC5E9, 0x85EA, 0x65F2, 0x65F3,
+  0x65F3, 0x65F3, 0x65F3, 0x85FC, 0x65FC, 0x85F5, 0x65FD, 0xA362,
+  0x0000, 0x85FE, 0x65FE, 0x65CD, 0x0700, 0x001A, 0xA362, 0x86D6,
+  0x25F7, 0x25F7, 0x25FF, 0xA664, 0x64CC, 0x65CD, 0x25F7, 0x85FE,
+  0x64D4, 0x4218, 0x85FD, 0xA362, 0x64CC, 0x85F4, 0x65FC, 0x65F3,
+  0x85FC, 0x65F3, 0x65F3, 0x65F2, 0x85F2, 0xC5E9, 0x64CA, 0x8450,
+  0x074F, 0x001A, 0xE490, 0x08E1, 0x06E9, 0x65E1, 0x06E1, 0x65E1,
+  0x45E1, 0xC5E9, 0xC5E9, 0x65EA, 0xC5E9, 0x85F2, 0x65EA, 0x85F2,
+  0x84CB, 0xA362, 0x65F3, 0x65FC, 0x85FC, 0x65FD, 0xA362, 0xA362,
+  0x65FD, 0x65FE, 0x86D6, 0xA362, 0x0800, 0x001C, 0xA362, 0x26D7,
+  0x26CF, 0x25FF, 0x25F7, 0x25F7, 0x86D6, 0x0000, 0x64CC, 0x65FE,
+  0xA362, 0x0000, 0xA39A, 0xA39A, 0x0000, 0xA362, 0x65FB, 0x65FB,
+  0x85EA, 0x85F2, 0x65EA, 0x85F2, 0xC5E9, 0xC5E9, 0xA6E1, 0xC5E9,
+  0x65C1, 0x8450, 0x084D, 0x001C, 0x8458, 0x8AC8, 0xC8E8, 0xC8E0,
+  0xE7E0, 0xE7E0, 0x06E9, 0x06E1, 0x65E1, 0x85C1, 0x45E9, 0xA6E1,
+  0xC5E9, 0x4218, 0x0000, 0x85C1, 0xA362, 0x0000, 0x84CB, 0x65FB,
+  0xC39A, 0x8458, 0x85FD, 0x65FD, 0x85FD, 0x65FD, 0x85FE, 0xA362,
+  0x0900, 0x001E, 0xE59C, 0x46D7, 0x25F7, 0x25F7, 0x25F7, 0x0000,
+  0x2232, 0x65FE, 0x65FE, 0x65FE, 0x85FD, 0x0000, 0x4232, 0x84CB,
+  0x0000, 0x0000, 0x65F3, 0x65FB, 0x65F3, 0xC490, 0x84CA, 0xC5E9,
+  0xC5E9, 0xA6E1, 0xC5E9, 0x45E1, 0x65E1, 0x26E9, 0x06E9, 0x4218,
+  0x094B, 0x001E, 0x8458, 0xAAE0, 0xA8E0, 0xAAE0, 0xC8E8, 0xE7E0,
+  0xE7E0, 0xE7E0, 0xE7E8, 0x06E9, 0xE490, 0xC490, 0x65E1, 0xC5E9,
+  0x65C9, 0x0000, 0x8458, 0x64CA, 0x0000, 0x4218, 0x65F3, 0x65FC,
+  0x65F3, 0x84D4, 0x4218, 0xA39A, 0x65F5, 0x85FE, 0x65FD, 0x64CC,
+  0x0A00, 0x001F, 0xE59C, 0x25F7, 0x25FF, 0x25F7, 0x25F7, 0xE59C,
+  0x0000, 0x2232, 0x65FD, 0x85FE, 0x65FD, 0x65FD, 0x84CB, 0x85FC,
+  0xA39A, 0x0000, 0xA39A, 0xE490, 0x85F2, 0x65F2, 0x8450, 0xC490,
+  0x65E9, 0xC5E9, 0x45E1, 0x65E9, 0x06E1, 0x06E1, 0xE7E0, 0xE7E8,
+  0xC6C0, 0x0A49, 0x0020, 0x4218, 0xAAC8, 0xACE8, 0xAAE0, 0xAAE0,
+  0xC8E0, 0xAAE8, 0xA8E0, 0xC8E0, 0xA8E0, 0xE7E8, 0x8450, 0xE490,
+  0x06E9, 0xE490, 0x8458, 0xC498, 0x0000, 0x85C1, 0x65C1, 0xE498,
+  0x85F2, 0x65F3, 0x65F3, 0x65FB, 0x0000, 0x0000, 0x84CB, 0x65FD,
+  0x85F5, 0x65FE, 0xE59C, 0x0B00, 0x0021, 0xC7A6, 0x25F7, 0x25FF,
+  0x25F7, 0x25F7, 0x86D6, 0xA664, 0xA362, 0x65CD, 0x85FD, 0x65FD,
+  0x85F4, 0x65FC, 0x85FC, 0x85FC, 0xC490, 0xA362, 0x0000, 0x64CA,
+  0xC5E9, 0xC5E9, 0x0000, 0x8458, 0x65E1, 0x65E1, 0x06E1, 0x06E9,
+  0xE7E0, 0xE7E0, 0xC8E0, 0xA8E8, 0xC8E8, 0x8458, 0x0B48, 0x0021,
+  0x8B58, 0xACE0, 0xACE0, 0xACE0, 0xACE8, 0xAAE0, 0x08E1, 0xAAE0,
+  0xAAE0, 0xC8E8, 0xE7E8, 0x4218, 0x8458, 0xE7E0, 0x06E9, 0x8458,
+  0x8458, 0x8458, 0x6450, 0xC5E1, 0xC5E9, 0xC5E9, 0x85F2, 0x85EA,
+  0x65FB, 0x64CA, 0xA39A, 0xA362, 0x65FC, 0x85F4, 0x65FD, 0x85FD,
+  0x64CC, 0x0C00, 0x0022, 0xE59C, 0x25FF, 0x25F7, 0x25F7, 0x65FE,
+  0x65FE, 0x65CD, 0x64CC, 0x85CD, 0x65FD, 0xA39A, 0xA362, 0xA36A,
+  0x65FB, 0x65F3, 0x65F3, 0x85F2, 0x0000, 0x65C1, 0xE490, 0xC490,
+  0xA6E9, 0xE490, 0x85C1, 0x4218, 0x06E9, 0xE7E8, 0xE7E0, 0xC8E8,
+  0xA8E0, 0xC8E0, 0xAAE0, 0xAAE8, 0x6B98, 0x0C47, 0x0022, 0x8B98,
+  0xACE8, 0xAEE0, 0xACE0, 0xACE8, 0xACE0, 0xACE0, 0xAAE0, 0xAAE8,
+  0x6B98, 0xE490, 0xC6C0, 0xC490, 0xC8E8, 0xC6C0, 0xC490, 0x8458,
+  0x0000, 0x65E9, 0x45E1, 0x65E9, 0x65C1, 0xE490, 0x8458, 0x64CA,
+  0x85F2, 0x64CA, 0x64CA, 0x65F3, 0x65FC, 0x85F4, 0x65FC, 0x85FD,
+  0x84CB, 0x0D00, 0x0023, 0xA664, 0x25F7, 0x25F7, 0x25F7, 0x25FF,
+  0x65FE, 0x4232, 0xA362, 0x65FD, 0x85D5, 0xC39A, 0xA39A, 0xC39A,
+  0x65FB, 0x64CA, 0x6450, 0x85F2, 0xC5E9, 0xC5E9, 0xE490, 0x0000,
+  0x65C1, 0x65E9, 0xC6C0, 0x8458, 0xC6C0, 0x4218, 0xC490, 0xAAE8,
+  0xC8E0, 0xAAE0, 0xAAE0, 0xACE8, 0xAAE0, 0x8AC8, 0x0D46, 0x0023,
+  0xAEC8, 0xAEE0, 0xAEE8, 0xAEE0, 0xAEE0, 0xACE0, 0xAEE8, 0xACE8,
+  0x6B98, 0x8458, 0xC6C0, 0x4218, 0xC8E0, 0xC8E8, 0xE7E0, 0x0000,
+  0xC6C0, 0xC6C0, 0x06E1, 0x06E9, 0xE490, 0x65C9, 0x85C1, 0x8458,
+  0x8450, 0x65C1, 0x65F2, 0x85F2, 0x8458, 0xA39A, 0x85F4, 0x65FC,
+  0x85F5, 0x65FC, 0xA362, 0x0E00, 0x0024, 0x4218, 0x86D6, 0x25FF,
+  0x25FF, 0x65FE, 0x65FE, 0xA39A, 0x0000, 0x65F4, 0x85FC, 0x0000,
+  0x0000, 0x0000, 0x6450, 0xE490, 0x0000, 0xC498, 0x85C1, 0xC5E9,
+  0x45E9, 0x0000, 0x0000, 0x06E1, 0x26E1, 0xE7E8, 0xE7E0, 0xC8E0,
+  0xE7E0, 0xA8E8, 0xAAE0, 0xAAE0, 0xACE0, 0xAAE8, 0xACE0, 0xACE0,
+  0xAEC8, 0x0E45, 0x0023, 0x8EC8, 0xAEE8, 0xB0E0, 0xAEE0, 0xAEE0,
+  0xAEE8, 0xAEE0, 0xACE0, 0xACE0, 0x8AC8, 0xACE8, 0xAAE0, 0xAAE0,
+  0xAAE0, 0xC8E8, 0x0000, 0x0000, 0x8AC8, 0xE7E0, 0xC6C0, 0xE490,
+  0x0000, 0xE490, 0x0000, 0x0000, 0x0000, 0x8458, 0xC5E9, 0x64CA,
+  0x0000, 0x65FB, 0x65F3, 0x85FC, 0x65F4, 0x84CC, 0x0F01, 0x0024,
+  0xA362, 0x25F7, 0x65F6, 0x65FE, 0x85FE, 0x65FD, 0x0000, 0x85FD,
+  0x85FC, 0xA39A, 0xA39A, 0x64CA, 0x64CA, 0x85F2, 0x85C1, 0x64CA,
+  0x4218, 0x45E1, 0x65E9, 0xC6C0, 0x0000, 0xC6C0, 0xE7E0, 0xE7E0,
+  0xC8E8, 0xC6C0, 0xC6C0, 0x8AC8, 0x6B98, 0xACE0, 0xACE0, 0xACE8,
+  0xACE0, 0xAEE0, 0xAEE8, 0xAEC8, 0x0F44, 0x0024, 0xB1C8, 0xB0E0,
+  0xB0E0, 0xB0E0, 0xB0E0, 0xAEE0, 0xB0E0, 0xAEE8, 0x8EC8, 0xAEC8,
+  0xAEE0, 0xAEC8, 0xACE8, 0xAAE0, 0x08E1, 0x0000, 0x0000, 0x8AC8,
+  0x08E9, 0xC490, 0xE498, 0xC490, 0xE490, 0xC6C8, 0xC490, 0xE498,
+  0xA362, 0x6450, 0x85F2, 0x65C1, 0x0000, 0x65F3, 0x65FB, 0x65F3,
+  0x85FC, 0x2232, 0x1002, 0x0024, 0x65D5, 0x65FE, 0x65FE, 0x65FE,
+  0x65F5, 0x85FD, 0x65FC, 0x85F4, 0x65F3, 0x65F3, 0x6458, 0x8458,
+  0x64CA, 0xC5E9, 0xE490, 0xC490, 0x8458, 0x85C9, 0x06E9, 0xE490,
+  0x4218, 0xE7E8, 0xA8E0, 0xC8E8, 0x8450, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x8AC8, 0xACE8, 0xAEE0, 0xACE0, 0xAEE8, 0xAEE0, 0xAEC8,
+  0x102C, 0x0002, 0x8450, 0x4218, 0x103B, 0x0002, 0x4220, 0x8458,
+  0x1043, 0x0024, 0x8ED0, 0xB1C8, 0xB0E8, 0xB0E0, 0xB0E0, 0xB0E0,
+  0xB0E0, 0xAEC8, 0x0000, 0x0000, 0x0000, 0x0000, 0xC490, 0xACE8,
+  0xACE0, 0x8B98, 0x0000, 0x8AC8, 0xAAE8, 0xC6C0, 0x8450, 0xE498,
+  0xC6C0, 0xE7E8, 0x06E1, 0x8450, 0xE498, 0x45E9, 0xC5E9, 0xC5E9,
+  0x85EA, 0xC5E9, 0x85EA, 0x65F2, 0x65F3, 0x84CB, 0x1102, 0x000D,
+  0xA362, 0x65F6, 0x85FE, 0x65FD, 0x85FD, 0x85FC, 0x84CB, 0xC490,
+  0xA39A, 0x85F2, 0x84CB, 0x85F2, 0xA362, 0x1114, 0x0013, 0xC490,
+  0xE7E0, 0xE7E8, 0xC8E0, 0xC490, 0x0000, 0xAAE8, 0xC6C0, 0x0000,
+  0x0000, 0x0000, 0x0000, 0xACE0, 0xAEC8, 0x8EC8, 0xAEE8, 0xB0E0,
+  0xB0E0, 0xD1B0, 0x112C, 0x0002, 0xB1C8, 0xB1A8, 0x113B, 0x0002,
+  0xD1B0, 0xB1A8, 0x1142, 0x0025, 0xD1B0, 0xB1C8, 0xB0E0, 0xB0E0,
+  0xB0E0, 0xB1C8, 0xB0E0, 0xAEC8, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x8AC8, 0xAEE0, 0x0000, 0xAAC8, 0xACE8, 0x8AC8, 0xACE8, 0x8458,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x8458, 0xE490, 0x27D1, 0x06E1,
+  0x45E9, 0xE490, 0xC490, 0xA6E1, 0x85F2, 0x65EA, 0x65FB, 0x65F3,
+  0x4232, 0x1203, 0x000D, 0x65CD, 0x65FD, 0x85FD, 0x65FC, 0xA39A,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x4218, 0x85F2, 0xA6E1, 0x4218,
+  0x1215, 0x0019, 0xC6C8, 0xC8E8, 0xA8E0, 0x8B98, 0x0000, 0x0000,
+  0x8AC8, 0x8AC8, 0x0000, 0x0000, 0x0000, 0x4218, 0xAED0, 0x8B98,
+  0x6BA0, 0xAEE0, 0xB0E0, 0xB0E0, 0x8B98, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x8458, 0xB1D0, 0x123B, 0x001A, 0xB1A8, 0x4218, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x8B60, 0xB1D0, 0xB1C8, 0xB1C8, 0xB1D0,
+  0xD1A8, 0xB1C8, 0x6BA0, 0x0000, 0x0000, 0x0000, 0x0000, 0xAEC8,
+  0xAEE8, 0x4218, 0x0000, 0x8EC8, 0xACE8, 0xACE0, 0xE490, 0x125B,
+  0x000B, 0xE7E8, 0xE7E0, 0x8450, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x65C9, 0x85F2, 0x85F2, 0x64CA, 0x1303, 0x0005, 0x2232, 0x65FE,
+  0x85FD, 0x85FD, 0xA39A, 0x130E, 0x0003, 0x64CA, 0xC5E9, 0x8450,
+  0x1316, 0x0019, 0x08E1, 0xC8E0, 0xAAE8, 0x8450, 0x0000, 0x0000,
+  0x8AC8, 0xACE8, 0x8458, 0x0000, 0x0000, 0x0000, 0xAEC8, 0x8ED0,
+  0x8458, 0xAEC8, 0xB0E0, 0xB0E0, 0x8B60, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x6B98, 0x8BA0, 0x133A, 0x001A, 0x8B58, 0x6BA0, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x8B58, 0xD1B0, 0xB1C8, 0xB1C8, 0x8EC8,
+  0x8BA0, 0xB1C8, 0xB1B0, 0x0000, 0x0000, 0x0000, 0x8450, 0xB0E0,
+  0xAED0, 0x0000, 0x0000, 0x6B98, 0xAEE0, 0xAEE8, 0xAED0, 0x1359,
+  0x0003, 0x4218, 0x08E1, 0xC490, 0x1362, 0x0004, 0xA39A, 0x85EA,
+  0x65F2, 0x4218, 0x1404, 0x002B, 0x85D5, 0x65FD, 0x85FC, 0x84CB,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x4218, 0xC490, 0xC490, 0x65E9,
+  0x45E9, 0x8450, 0x0000, 0x0000, 0x4218, 0x4220, 0xC6C0, 0xAAE8,
+  0xAAE0, 0xAAE8, 0x4218, 0x0000, 0x0000, 0x8B58, 0xAED0, 0x6B98,
+  0x0000, 0x0000, 0x0000, 0x8BA0, 0xB1C8, 0x8B58, 0x6BA0, 0xB1C8,
+  0xB1C8, 0x0000, 0x0000, 0x0000, 0x0000, 0x8B60, 0x8B60, 0x143A,
+  0x002B, 0x8B58, 0x0B19, 0x0000, 0x0000, 0x0000, 0x0000, 0xD190,
+  0xD1B0, 0xD1B0, 0x6B98, 0x8BA0, 0xB1C8, 0x6B98, 0x0000, 0x0000,
+  0x0000, 0x8BA0, 0xB1C8, 0x8458, 0x0000, 0x0000, 0x8458, 0xAEE8,
+  0xAEE0, 0xACE0, 0xC490, 0x0000, 0x4218, 0x0000, 0x0000, 0x8458,
+  0xAAE8, 0xC8E8, 0xC6C0, 0xC490, 0x4218, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x85C9, 0xC5E9, 0xC5E9, 0x1504, 0x002C, 0x85FD, 0x65FC,
+  0x85F4, 0x65FB, 0x0000, 0x0000, 0x0000, 0x8458, 0xA36A, 0x8458,
+  0x4218, 0x0000, 0x85C1, 0x26E1, 0x06E9, 0xE7E0, 0x08E1, 0xC8E0,
+  0x8AC8, 0x8AC8, 0xACE0, 0xAAE8, 0xACE0, 0x8BA0, 0x0000, 0x6B98,
+  0xAEE0, 0xAEE0, 0xB0E8, 0x8B98, 0x0000, 0x0000, 0x8B60, 0xB1C8,
+  0x8EC8, 0x8BA0, 0xB1D0, 0xD190, 0x0000, 0x0000, 0x0000, 0x0000,
+  0xF178, 0x4218, 0x1539, 0x002C, 0x0B19, 0x1161, 0x0000, 0x0000,
+  0x0000, 0x0000, 0xD178, 0xD1B0, 0xD190, 0xF178, 0xD188, 0xD1B0,
+  0x8B60, 0x0000, 0x0000, 0x6B98, 0xB1C8, 0xB0E0, 0xB1D0, 0x4218,
+  0x0000, 0xAEC8, 0xB0E0, 0xB0E0, 0xAEE0, 0xAEE8, 0x8EC8, 0xAEE0,
+  0xACE0, 0xACE8, 0xAEC8, 0xACE8, 0x6B98, 0x0000, 0xE498, 0xC6C0,
+  0xC6C0, 0x8450, 0x0000, 0x0000, 0x0000, 0xC5E9, 0xC5E9, 0xA39A,
+  0x1604, 0x002C, 0xA39A, 0x85F4, 0x65FC, 0x85F4, 0x4218, 0x0000,
+  0xC498, 0xA39A, 0x0000, 0x0000, 0x0000, 0x0000, 0xE490, 0x06E9,
+  0xE7E8, 0xE7E0, 0xC8E0, 0xA8E0, 0x8AC8, 0xE490, 0x0000, 0x8458,
+  0x8AC8, 0xAEE8, 0xACE0, 0xAEE8, 0x8B58, 0x4218, 0xAED0, 0xB0E0,
+  0xB0E0, 0x8B98, 0x0000, 0x0000, 0x8ED0, 0xB1C8, 0xD1A8, 0xB1B0,
+  0x8B58, 0x0000, 0x0000, 0x0000, 0x8B60, 0xF178, 0x1639, 0x002C,
+  0x8B60, 0x0B19, 0x0000, 0x0000, 0x0000, 0x0B21, 0xD190, 0xF178,
+  0xD190, 0xD190, 0xF188, 0x0000, 0x0000, 0x8B60, 0xD1B0, 0xB1A8,
+  0xAEC8, 0x8458, 0xB1D0, 0xB1C8, 0xB0E0, 0xB0E0, 0xB0E0, 0x6B98,
+  0xE498, 0x6B98, 0xAEE8, 0xACE0, 0xAEE8, 0xACE0, 0xACE0, 0xAAE0,
+  0x8458, 0x0000, 0x0000, 0x0000, 0x8458, 0xE490, 0x8458, 0x0000,
+  0xC498, 0x65E9, 0xC5E9, 0xC490, 0x1704, 0x002D, 0xA362, 0x65FC,
+  0x85FC, 0x65FB, 0xA36A, 0x4218, 0x64CA, 0x0000, 0x0000, 0x0000,
+  0x0000, 0xE490, 0x06E1, 0xE7E0, 0xE7E8, 0xE490, 0xA8E0, 0xC8E0,
+  0x08E1, 0xAAE8, 0x8AC8, 0x0000, 0x0000, 0x4218, 0xAEE8, 0xAEE8,
+  0xE490, 0x0000, 0x0000, 0x8458, 0xB0E0, 0xB1C8, 0xB0E0, 0x6BA0,
+  0xE490, 0xD1A8, 0xB1D0, 0xD190, 0xB1B0, 0x4218, 0x0000, 0x0000,
+  0x4220, 0x8B60, 0x4218, 0x1738, 0x002D, 0x0B21, 0x8B60, 0x0000,
+  0x0000, 0x0000, 0x4218, 0xF178, 0xD178, 0xF178, 0xD178, 0xF178,
+  0x4218, 0xF178, 0xD190, 0xB1B0, 0xD1A8, 0x6BA0, 0x0000, 0x0000,
+  0x8B98, 0xB0E0, 0xB1C8, 0x8458, 0x0000, 0x0000, 0x8B98, 0xB0E0,
+  0xAEE0, 0xAEE8, 0xACE0, 0x8AC8, 0xACE0, 0xACE0, 0xAAE8, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x8458, 0xE490, 0x0000, 0xC6C0, 0xA6E9,
+  0xC5E9, 0x8450, 0x1804, 0x002D, 0x4218, 0x85FC, 0x65F3, 0x65FB,
+  0x64CA, 0xA39A, 0x8450, 0x0000, 0x0000, 0x0000, 0x0000, 0x06E9,
+  0x08E1, 0xE7E0, 0xE490, 0xC6C0, 0x0000, 0x8458, 0xAAE8, 0xACE0,
+  0xACE8, 0xACE0, 0x4218, 0x0000, 0x8458, 0xB0E0, 0xAEE8, 0x8EC8,
+  0x0000, 0x0000, 0x0000, 0xB1C8, 0xB1C8, 0xB1C8, 0x8BA0, 0xB1A8,
+  0xD1B0, 0xD188, 0x8B60, 0xF178, 0x0000, 0x0000, 0x0000, 0x8B60,
+  0x0B19, 0x1838, 0x002D, 0x0B19, 0x8B60, 0x0000, 0x0000, 0x0000,
+  0x1169, 0x1161, 0x8B60, 0x1161, 0xD178, 0xF178, 0xD178, 0xD190,
+  0xF190, 0xD190, 0x4218, 0x0000, 0x0000, 0x8BA0, 0xB1C8, 0xB1C8,
+  0x8B60, 0x0000, 0x4218, 0xB0E8, 0xB0E0, 0xAEE8, 0xB0E0, 0x8450,
+  0x8B60, 0x8B98, 0x8ED0, 0xACE0, 0xACE8, 0x8B98, 0x0000, 0x0000,
+  0x0000, 0x0000, 0xC490, 0x8458, 0x06E9, 0x26E1, 0x65E1, 0x4218,
+  0x1905, 0x002C, 0x65FC, 0x85FC, 0x65F3, 0x65FB, 0x84D2, 0x4218,
+  0x0000, 0x0000, 0x0000, 0x8450, 0x06E1, 0x06E1, 0xE7E8, 0xC6C8,
+  0x4218, 0x0000, 0x0000, 0x8450, 0xACE8, 0xAEE0, 0xACE0, 0xAEE8,
+  0x8458, 0x8458, 0xB0E0, 0xB0E0, 0xB0E0, 0xB0E0, 0xAEC8, 0x8458,
+  0x0000, 0xB1D0, 0xD1B0, 0x4218, 0x0000, 0xD188, 0xF190, 0xD190,
+  0xF178, 0x8B60, 0x0000, 0x0000, 0x4220, 0x3149, 0x1938, 0x002C,
+  0x5151, 0x4218, 0x0000, 0x0000, 0x8B60, 0x3149, 0x5149, 0x1161,
+  0x1169, 0x1161, 0x0B21, 0x0B19, 0xD188, 0xD178, 0x0000, 0x0000,
+  0xF178, 0xB1B0, 0xD1A8, 0xB1B0, 0xB1C8, 0x0000, 0x8B60, 0xB1C8,
+  0xB0E0, 0xB0E0, 0xB0E8, 0x4218, 0x0000, 0x0000, 0x8B98, 0xAEC8,
+  0xAEE0, 0xACE8, 0xACE8, 0x0000, 0x0000, 0x0000, 0x0000, 0x8450,
+  0x06E1, 0x06E1, 0x65E9, 0x45E9, 0x1A05, 0x0005, 0x65F3, 0x65F3,
+  0x65F3, 0x85F2, 0x65EA, 0x1A0F, 0x0023, 0x06E1, 0xE7E8, 0xE7E0,
+  0xC8E0, 0x6B98, 0x4218, 0x0000, 0x0000, 0x8458, 0xACE8, 0xAEE8,
+  0xAEE0, 0xB0E0, 0xAEC8, 0xB0E0, 0x8EC8, 0x8B98, 0xB1D0, 0xB1C8,
+  0xB1C8, 0xB1D0, 0xB1A8, 0xD1B0, 0xD188, 0x0000, 0x0000, 0x4218,
+  0xF178, 0xD178, 0x1169, 0x0000, 0x0000, 0x0000, 0x0B19, 0x0B21,
+  0x1A37, 0x002D, 0x0B19, 0x0B21, 0x0000, 0x0000, 0x0000, 0x3149,
+  0x5149, 0x3151, 0x1161, 0x4220, 0x0000, 0x0000, 0xF178, 0x1161,
+  0x1161, 0x8B60, 0xD190, 0xF190, 0xD190, 0x8B58, 0xD1B0, 0xD1B0,
+  0xB1A8, 0xB1C8, 0xB0E8, 0xB1C8, 0xB0E0, 0x4218, 0x0000, 0x0000,
+  0x4218, 0x8BA0, 0xAEE8, 0xACE0, 0xACE8, 0x8AC8, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x8450, 0xE7E8, 0x06E1, 0x26E1, 0x06E9, 0x1B05,
+  0x0005, 0x84CB, 0x85FC, 0x65F3, 0x65FB, 0xC5E9, 0x1B0F, 0x0023,
+  0xE490, 0x08E1, 0xA8E0, 0xAAE0, 0xAAE8, 0xAAE0, 0xAED0, 0x8AC8,
+  0x8450, 0xACE0, 0xAEE8, 0xB0E0, 0xAEE0, 0xB0E0, 0xB0E0, 0xB0E0,
+  0xB0E0, 0xB0E0, 0xB1D0, 0xB1C8, 0xD1A8, 0xB1B0, 0xD1B0, 0xB1B0,
+  0x8B60, 0x0000, 0x0000, 0x4218, 0xF178, 0x1161, 0x8B60, 0x0000,
+  0x0000, 0x0B21, 0x0B19, 0x1B37, 0x002D, 0x0B21, 0x0B21, 0x0000,
+  0x0000, 0x0B19, 0x5151, 0x3149, 0x5149, 0x0000, 0x0000, 0x0000,
+  0x3149, 0x1161, 0x1161, 0x1161, 0xD178, 0xF178, 0xF190, 0xD190,
+  0xB1A8, 0xD1B0, 0xB1A8, 0xD1B0, 0xB1C8, 0xB1C8, 0xB0E0, 0x6BA0,
+  0x0000, 0x8B58, 0xAEC8, 0xAEE0, 0xB0E0, 0xAEE0, 0xAEE8, 0xACE8,
+  0x8458, 0x0000, 0x0000, 0x0000, 0x0000, 0x8450, 0x08E1, 0xE7E0,
+  0x65E1, 0xC6C0, 0x1C05, 0x0005, 0xA39A, 0x65F3, 0x65F3, 0x85F2,
+  0x65EA, 0x1C0F, 0x0055, 0xE7E0, 0xA8E8, 0xC8E0, 0xA8E0, 0xAAE0,
+  0xAAE8, 0xACE0, 0xACE0, 0xACE0, 0xACE8, 0xAEE0, 0xAEE0, 0xB0E0,
+  0xB0E0, 0xB0E0, 0xB1C8, 0xB0E0, 0xB1C8, 0xB1C8, 0xD1B0, 0xB1A8,
+  0xD1B0, 0xB1A8, 0xD190, 0xF190, 0x4218, 0x0000, 0x0000, 0x1161,
+  0x3149, 0x5149, 0x4220, 0x0000, 0x0000, 0x3149, 0x4220, 0x0000,
+  0x0000, 0x0000, 0x4218, 0x0B21, 0x0000, 0x0000, 0x4220, 0x9131,
+  0x9129, 0x9131, 0x0B19, 0x0000, 0x0000, 0x0B21, 0x5149, 0x3149,
+  0x5151, 0x1161, 0x1169, 0xF178, 0xD178, 0xD190, 0xF190, 0xD1A8,
+  0xB1B0, 0xD1A8, 0xB1B0, 0xB1C8, 0xB1C8, 0xB0E0, 0xB1C8, 0xB0E8,
+  0xB0E0, 0xB0E0, 0xAEE0, 0xAEE0, 0xACE8, 0xACE0, 0xE490, 0x0000,
+  0x0000, 0x0000, 0x0000, 0xC490, 0xC8E8, 0xE7E0, 0x08E1, 0xC490,
+  0x1D05, 0x005F, 0x6450, 0x65F3, 0x85F2, 0x85F2, 0xC5E9, 0xC490,
+  0x0000, 0x0000, 0x0000, 0xE490, 0xE7E8, 0xC6C0, 0x0000, 0xC490,
+  0x8B98, 0xAAE0, 0xACE8, 0xACE0, 0xACE0, 0xAEE0, 0xAEE8, 0xB0E0,
+  0xB0E0, 0xB0E0, 0xB0E0, 0xB1C8, 0xB1B0, 0xAEC8, 0xB1B0, 0xD1A8,
+  0xB1B0, 0xD1B0, 0xF190, 0xD190, 0xD178, 0xF178, 0x0000, 0x0000,
+  0x5149, 0x8B60, 0x4218, 0x3151, 0x0000, 0x0000, 0x0B19, 0x9131,
+  0x0000, 0x0000, 0x0000, 0x9131, 0x0B19, 0x0000, 0x0000, 0x9131,
+  0x9131, 0x0000, 0x9131, 0x9131, 0x0000, 0x0B19, 0x5151, 0x3149,
+  0x3149, 0x1161, 0x1161, 0x1161, 0x1161, 0xF178, 0xF178, 0xD190,
+  0xD190, 0xD1A8, 0xB1B0, 0xB1C8, 0xD1A8, 0xB1C8, 0xB1C8, 0xB0E0,
+  0xB0E0, 0xB0E0, 0xB0E0, 0xAEE8, 0x8458, 0xE490, 0xACE0, 0xACE8,
+  0x0000, 0x0000, 0x0000, 0x0000, 0xC6C0, 0x08E1, 0xE7E0, 0x06E9,
+  0x8458, 0x1E05, 0x0019, 0x4218, 0x85FA, 0x85F2, 0xC5E9, 0xC5E9,
+  0xA6E1, 0xC490, 0x0000, 0x0000, 0xE490, 0xE7E8, 0x4218, 0x0000,
+  0x0000, 0x0000, 0x6B98, 0xACE8, 0xACE8, 0x8AC8, 0xAAC8, 0xAEC8,
+  0x6B98, 0x8B98, 0x4218, 0x4220, 0x1E24, 0x0022, 0x4218, 0xD178,
+  0xF178, 0xD178, 0x1169, 0x1161, 0x0B21, 0x3149, 0x0000, 0x0000,
+  0x9131, 0x0B19, 0x0000, 0x0000, 0x0B21, 0x4218, 0x0000, 0x4220,
+  0x0B21, 0x0000, 0x0000, 0x0B19, 0x9131, 0x9131, 0x0000, 0x0B19,
+  0x9131, 0x4220, 0x9131, 0x9131, 0x9129, 0x5149, 0x0B21, 0x0B19,
+  0x1E4B, 0x0018, 0x8458, 0x4220, 0x8B60, 0x8BA0, 0xB1A8, 0xD1B0,
+  0xB1C8, 0x8EC8, 0xB0E8, 0xB0E0, 0x8B98, 0x0000, 0x0000, 0x0000,
+  0x6B98, 0xACE8, 0x8450, 0x0000, 0x0000, 0xE498, 0xA8E8, 0xC8E0,
+  0xE7E0, 0xE7E8, 0x1F06, 0x0011, 0x65F3, 0x65EA, 0x85F2, 0xC5E9,
+  0xC5E9, 0x65E1, 0x45E1, 0xC6C0, 0x27D1, 0xE7E8, 0xC8E0, 0xAAC8,
+  0xAAE0, 0xAAE0, 0xACE8, 0xACE0, 0xAEE8, 0x1F27, 0x001D, 0x8B60,
+  0x1161, 0x1161, 0x1169, 0x3149, 0x4220, 0x0000, 0x3149, 0x9131,
+  0x0000, 0x0000, 0x0E0A, 0x0B21, 0x0000, 0x0B19, 0xEE09, 0x0000,
+  0x0000, 0xF221, 0x531A, 0x4220, 0x0000, 0x4218, 0x1222, 0x9131,
+  0x1222, 0x9131, 0x3151, 0x4218, 0x1F52, 0x0011, 0x8B58, 0xB0E0,
+  0xB0E0, 0xB0E0, 0xB0E0, 0x8B98, 0x8EC8, 0xAEE8, 0xAEE8, 0x8B98,
+  0x6B98, 0xAAE0, 0xAAE0, 0xC8E8, 0xA8E0, 0xC8E0, 0x06E1, 0x2006,
+  0x0012, 0x65C1, 0x85F2, 0xC5E9, 0xC5E9, 0x45E1, 0x65E1, 0x06E1,
+  0x06E1, 0xE7E8, 0xC8E0, 0xC8E0, 0xAAE0, 0xA8E8, 0xAAE0, 0xAAE0,
+  0xACE0, 0xACE8, 0x8B98, 0x2029, 0x0019, 0x3149, 0x3149, 0x5149,
+  0x9131, 0x0000, 0x4218, 0x9131, 0x4218, 0x0000, 0x0000, 0x1222,
+  0x1222, 0xF221, 0x0000, 0x0000, 0x4220, 0x531A, 0x1222, 0x0000,
+  0x0000, 0x1222, 0xF221, 0x1222, 0x9131, 0x4218, 0x2052, 0x0011,
+  0xB1B0, 0xB0E8, 0xB1C8, 0xB0E0, 0xAEE8, 0xB0E0, 0xAEE0, 0xAEE0,
+  0xACE8, 0xACE0, 0xAAE0, 0xACE0, 0xC8E8, 0xAAE0, 0xA8E0, 0xE7E0,
+  0xE490, 0x2106, 0x0013, 0xA362, 0x65F2, 0x85EA, 0xC5E9, 0xC5E9,
+  0x65E1, 0x45E1, 0xE7E8, 0xE7E0, 0xC8E0, 0xC8E0, 0x8AC8, 0xAAE8,
+  0xAAE0, 0xACE8, 0x8B98, 0xAEE0, 0xAEE8, 0x8B60, 0x212A, 0x0016,
+  0x8B60, 0x9131, 0x3149, 0x9131, 0x0000, 0x9131, 0x1222, 0x0000,
+  0xEE09, 0x531A, 0xB41A, 0x531A, 0xEE09, 0x0000, 0x531A, 0xD412,
+  0xEE09, 0x0000, 0xB41A, 0x531A, 0x531A, 0x0B19, 0x2151, 0x0012,
+  0x8B58, 0xB1D0, 0xB1C8, 0xD170, 0xB0E0, 0xB0E0, 0xAEE8, 0xAEE0,
+  0xAEE0, 0xAEE0, 0xACE8, 0xACE0, 0xAAE0, 0xAAE0, 0xC8E8, 0xAAE0,
+  0xA8E8, 0x8458, 0x2206, 0x0013, 0x4218, 0x85F2, 0xC5E9, 0xC5E9,
+  0x45E1, 0x45E1, 0x08E1, 0xE7E8, 0xC8E0, 0xA8E0, 0x8450, 0x0000,
+  0x8458, 0xACE8, 0xACE8, 0xACE0, 0xAEE0, 0xAEE0, 0xAEC8, 0x222B,
+  0x0014, 0x0B19, 0x9131, 0x9131, 0xEE09, 0x4218, 0x1222, 0x4220,
+  0x0B21, 0xB412, 0xB412, 0xB41A, 0x0B21, 0x4218, 0xB41A, 0xB412,
+  0x0000, 0xB41A, 0xB412, 0xB41A, 0x0B19, 0x2250, 0x0012, 0x4220,
+  0xB1D0, 0xB1C8, 0xB1D0, 0xB1A8, 0xB0E0, 0xB1C8, 0x8458, 0x4218,
+  0xAED0, 0xAEE8, 0xAEE0, 0xACE8, 0xACE0, 0xAAE0, 0xAAE0, 0xA8E8,
+  0xC8E0, 0x2307, 0x0014, 0xC5E9, 0xC5E9, 0xA6E1, 0xC6E1, 0x06E1,
+  0x06E9, 0xE7E0, 0x08E1, 0xC8E0, 0xA8E8, 0xE490, 0x08E1, 0xACE0,
+  0xAEE0, 0xACE8, 0xAEE8, 0x6B98, 0x8B98, 0x8EE8, 0x4220, 0x232C,
+  0x0012, 0x9131, 0x1222, 0x1222, 0xEE09, 0x0E12, 0xEE09, 0x0B19,
+  0xB41A, 0x5613, 0xB412, 0x4220, 0x531A, 0x560B, 0x4220, 0x330B,
+  0x560B, 0x5613, 0x0B21, 0x234A, 0x0018, 0x4218, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x4218, 0xB1B0, 0x8B58, 0xB1D0, 0xB1C8, 0xB0E0,
+  0xB0E0, 0xB0E0, 0x8B98, 0x6B98, 0xAEE8, 0xAEE0, 0xAEE0, 0xAEE0,
+  0xACE8, 0x08E1, 0xAAE0, 0xAAE0, 0xC6C0, 0x2407, 0x0015, 0xE490,
+  0xC5E9, 0xC5E9, 0x65E1, 0x06E1, 0xC6C0, 0x8458, 0xC8E8, 0xA8E0,
+  0xC8E0, 0xAAE0, 0xAAE8, 0xACE0, 0xACE0, 0xAEE0, 0xAEE8, 0x6B98,
+  0x8B98, 0xB0E0, 0xB1B0, 0x8450, 0x242A, 0x0016, 0x4218, 0x9131,
+  0x9131, 0x1222, 0x1222, 0xEE09, 0x531A, 0xB41A, 0x0000, 0xB412,
+  0x5613, 0x330B, 0x0000, 0x560B, 0x5613, 0xEE09, 0x5613, 0x5613,
+  0x5613, 0xB412, 0xEE09, 0x4220, 0x244E, 0x0014, 0x4220, 0xF190,
+  0xD190, 0x8B58, 0x8BA0, 0xB1C8, 0xB1C8, 0xB0E8, 0xB0E0, 0xB0E0,
+  0xAEE0, 0xB0E0, 0xAEE0, 0xACE8, 0x8450, 0xACE8, 0xAAE0, 0xAAE0,
+  0xC8E8, 0x8450, 0x2508, 0x0016, 0xC5E9, 0x65E9, 0x65E1, 0x06E9,
+  0xC490, 0x8458, 0xE490, 0xC6C0, 0xAAE0, 0xAAE8, 0xACE0, 0xACE0,
+  0xAEE0, 0xAEE8, 0xAEE0, 0xAEE0, 0xB0E8, 0x8ED0, 0x4218, 0x8B98,
+  0x6BA0, 0x4220, 0x2526, 0x001D, 0x4218, 0x0B21, 0x3149, 0x9131,
+  0x9129, 0x9131, 0x1222, 0x1222, 0x4220, 0xEE09, 0xB41A, 0xB412,
+  0x330B, 0x5613, 0xF80B, 0x5613, 0x560B, 0xD80B, 0xF80B, 0xF80B,
+  0x4220, 0xEE09, 0xD80B, 0x5613, 0x5613, 0xB412, 0xD41A, 0xEE09,
+  0x4218, 0x254D, 0x0014, 0x8B60, 0xD178, 0x0B19, 0xD1B0, 0xB1A8,
+  0xB1C8, 0xB1C8, 0xB0E0, 0xB1C8, 0xB0E0, 0xB0E0, 0xB0E0, 0xAEE8,
+  0xAEE0, 0x8BA0, 0x8458, 0x6B98, 0xACE0, 0xAAE0, 0xAAE8, 0x2608,
+  0x0059, 0x8450, 0x45E9, 0x06E1, 0x26E1, 0xC6C0, 0x8450, 0x0000,
+  0x8458, 0xC8E8, 0xAAE8, 0x8AC8, 0xACE0, 0xACE0, 0x8AC8, 0x0000,
+  0xB0E0, 0xAEE0, 0x8B98, 0x0000, 0x4218, 0xAED0, 0xB1D0, 0xB1A8,
+  0xD1B0, 0x6B98, 0xD190, 0x8B58, 0x8B60, 0x8B60, 0x1161, 0x5149,
+  0x3149, 0x0B21, 0x0B19, 0x0000, 0x0B21, 0x1222, 0x531A, 0xEE09,
+  0xD412, 0xB41A, 0xEE09, 0xB41A, 0xF80B, 0x560B, 0xD80B, 0xF80B,
+  0x330B, 0x330B, 0xD80B, 0x330B, 0xEE09, 0x5613, 0xF80B, 0x4218,
+  0x0B21, 0xEE09, 0xD41A, 0x531A, 0x531A, 0x0B19, 0x0B21, 0x4220,
+  0x4218, 0x4220, 0x0B19, 0x0B21, 0x3149, 0x1169, 0x1161, 0x0000,
+  0x0000, 0x8BA0, 0xB1A8, 0xD1B0, 0x8B58, 0xB1B0, 0xB0E0, 0xB0E0,
+  0xB0E0, 0xAEE8, 0xAEE0, 0x0000, 0x8450, 0x8458, 0x8AC8, 0xAAE8,
+  0xAAE8, 0x8450, 0x2709, 0x0057, 0xC6C0, 0x65E1, 0x26E1, 0x06E9,
+  0xC6C0, 0xC490, 0xC8E0, 0xAAE8, 0x8AC8, 0x8458, 0xACE8, 0xAEE8,
+  0x4218, 0x0000, 0x8450, 0xB0E0, 0xAED0, 0x8EC8, 0xB1C8, 0xB1D0,
+  0x8B98, 0xB1A8, 0xD1B0, 0xD1B0, 0xD190, 0xF190, 0x8B60, 0x0B19,
+  0x3151, 0x3149, 0x0000, 0x0000, 0x0000, 0x4218, 0x9131, 0x531A,
+  0x531A, 0xB41A, 0xB412, 0x0B21, 0x0000, 0x5613, 0xF80B, 0xD80B,
+  0xD80B, 0x7904, 0x330B, 0x0000, 0x330B, 0x9904, 0xD80B, 0xF80B,
+  0xF80B, 0xEE09, 0x0000, 0x0000, 0x0000, 0xEE09, 0x531A, 0x1222,
+  0x0B21, 0x1222, 0x9131, 0x3149, 0x9129, 0x1169, 0x5149, 0x1161,
+  0x1161, 0xD190, 0x8458, 0xD190, 0xD1B0, 0x4218, 0x0000, 0x8B58,
+  0xB1C8, 0xB0E8, 0x8B58, 0xB0E0, 0xAEE8, 0x8EC8, 0x4218, 0xAEC8,
+  0xACE8, 0xACE8, 0x8B98, 0x280A, 0x0055, 0x8450, 0x06E9, 0xE7E8,
+  0xE7E0, 0xC8E0, 0xA8E0, 0x8B98, 0x8458, 0x8AC8, 0xACE8, 0x8B98,
+  0x0000, 0x0000, 0x4218, 0xAEE8, 0xB0E0, 0xB1C8, 0xB1D0, 0x4218,
+  0x0000, 0xB1B0, 0x8B98, 0x8B60, 0xD190, 0xF178, 0x1161, 0x4218,
+  0x3149, 0x0000, 0x0000, 0x0000, 0x9131, 0x9131, 0x1222, 0x1222,
+  0xB412, 0xB41A, 0x0B19, 0x0000, 0x0000, 0x5613, 0xD80B, 0xD80B,
+  0x990C, 0xD80B, 0x7904, 0x0000, 0x0000, 0xD80B, 0x990C, 0xD80B,
+  0xD80B, 0x560B, 0x5613, 0x4220, 0x0000, 0x0000, 0xEE09, 0x0E0A,
+  0x0B21, 0x9131, 0x9131, 0x9129, 0x0000, 0x3149, 0x8B60, 0x0000,
+  0x1169, 0xF178, 0xD190, 0xD190, 0xD1A8, 0x0000, 0x0000, 0x0000,
+  0xD1B0, 0xB1C8, 0x6B98, 0x8B60, 0xB0E0, 0xAEE8, 0xAEE0, 0xACE0,
+  0xACE8, 0x8450, 0x290C, 0x0051, 0x8450, 0xE490, 0xC8E8, 0x8AC8,
+  0x8AC8, 0x8B98, 0xACE0, 0xACE8, 0x6BA0, 0x4220, 0x4218, 0x4218,
+  0xB0E0, 0xB0E8, 0x8B98, 0x0000, 0x0000, 0x8458, 0xD1B0, 0x8B58,
+  0x0000, 0xD190, 0xF178, 0x1169, 0x1161, 0x4220, 0x0000, 0x0000,
+  0x3149, 0x9131, 0x4218, 0x4220, 0xB41A, 0x531A, 0x531A, 0x0000,
+  0x0000, 0x0B19, 0xD80B, 0xD80B, 0x790C, 0x7904, 0x790C, 0x7904,
+  0x0000, 0x0000, 0x0B21, 0x7904, 0x990C, 0xF80B, 0x0000, 0xEE09,
+  0x5613, 0x0B19, 0x0000, 0x0000, 0xF221, 0x1222, 0x1222, 0x9131,
+  0x0B21, 0x0000, 0x5149, 0x3149, 0x0000, 0x0000, 0x4218, 0xD178,
+  0xD1B0, 0xD190, 0x0000, 0x0000, 0x0000, 0x8B58, 0xB0E0, 0xAEC8,
+  0x8ED0, 0x8B98, 0x8ED0, 0x8B98, 0x8458, 0x2A0F, 0x004A, 0x4218,
+  0x4220, 0x8458, 0x8B60, 0x6BA0, 0x8B98, 0x8ED0, 0x8B98, 0x8EC8,
+  0xAEE8, 0xB1C8, 0x4218, 0x8B60, 0x0000, 0x8BA0, 0xB1A8, 0xD190,
+  0x0000, 0x8B58, 0xF178, 0xF178, 0x3149, 0x8B60, 0x0000, 0x3149,
+  0x0B21, 0x0000, 0x0000, 0x0B19, 0x1222, 0xB41A, 0x0000, 0x0000,
+  0x0000, 0x0B19, 0xF80B, 0x790C, 0x7904, 0x790C, 0x7904, 0x790C,
+  0x0000, 0x0000, 0x0000, 0x330B, 0x7904, 0x790C, 0x4218, 0x0000,
+  0x4220, 0x330B, 0x0B19, 0x4220, 0x1222, 0xF221, 0x9131, 0x9131,
+  0x0000, 0x0000, 0x3149, 0x1161, 0x4220, 0x8B60, 0x4218, 0x8B60,
+  0xF190, 0xD190, 0x8B60, 0x8B58, 0x8B60, 0x8BA0, 0x8B58, 0x8BA0,
+  0x4218, 0x2B16, 0x003D, 0x4218, 0x4218, 0x0000, 0x0000, 0x8ED0,
+  0x8B58, 0x8BA0, 0xB1A8, 0xB1D0, 0xD1B0, 0xD178, 0x4218, 0xF178,
+  0x1161, 0x1169, 0x5149, 0x3149, 0x0B21, 0x0000, 0x0000, 0x0000,
+  0xF221, 0xB41A, 0x0B19, 0x0000, 0x0000, 0x0000, 0x0B21, 0x7904,
+  0x790C, 0x7904, 0x790C, 0x7904, 0x790C, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x7904, 0x790C, 0x330B, 0x0000, 0x0000, 0x0000, 0x3303,
+  0xB41A, 0xB412, 0x1222, 0x1222, 0x0B21, 0x0B19, 0x9131, 0x5149,
+  0x3149, 0x1169, 0x0B21, 0x3149, 0x0000, 0x0000, 0x0000, 0x4218,
+  0x2C18, 0x0039, 0x4220, 0xAEE8, 0xB1C8, 0xD1B0, 0xB1A8, 0xB1C8,
+  0xD1B0, 0xB1A8, 0xD190, 0xF190, 0x1161, 0x1161, 0x3149, 0x5149,
+  0x9131, 0x9131, 0x0000, 0x0000, 0x0B19, 0x1222, 0x531A, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0B21, 0xD80B, 0x9904, 0x790C, 0x7904,
+  0x790C, 0xD80B, 0x0000, 0x0000, 0x0000, 0x0000, 0xEE09, 0x9904,
+  0xD80B, 0x4220, 0x0000, 0x0B21, 0xB412, 0xB412, 0x531A, 0x1222,
+  0x9131, 0x9131, 0x9131, 0x3149, 0x9131, 0x3149, 0x3149, 0x5149,
+  0x1169, 0xF178, 0x4218, 0x2D17, 0x0021, 0x6B98, 0xB0E0, 0xB0E0,
+  0xB0E0, 0xB1C8, 0xB1C8, 0xD1B0, 0xB1B0, 0x8B58, 0xF178, 0xD190,
+  0xF178, 0x1169, 0x1161, 0x5151, 0x3149, 0x9131, 0x3149, 0x0B19,
+  0x1222, 0xF221, 0x0B21, 0x0000, 0x0000, 0x0000, 0x0000, 0x0B21,
+  0x9904, 0xD80B, 0x790C, 0x7904, 0x790C, 0x3303, 0x2D3D, 0x0015,
+  0xD80B, 0x790C, 0x3303, 0x423A, 0x5613, 0x5613, 0xB412, 0xB412,
+  0x1222, 0x1222, 0x9131, 0x9131, 0x9131, 0x3149, 0x3149, 0x1161,
+  0x1161, 0xF178, 0xD178, 0xD1B0, 0x6BA0, 0x2E15, 0x0017, 0x8458,
+  0xAEE8, 0xB0E0, 0xB0E0, 0xB0E0, 0xB1C8, 0xB1C8, 0xB1D0, 0xB1C8,
+  0x8B98, 0x0000, 0xD190, 0xF178, 0x8B60, 0xD178, 0x8B58, 0x3149,
+  0x5149, 0x3149, 0x9131, 0x9131, 0x9131, 0x9131, 0x2E31, 0x0007,
+  0x0B19, 0xF80B, 0x990C, 0x7904, 0x790C, 0x7904, 0xD80B, 0x2E3D,
+  0x0017, 0x4220, 0xD80B, 0xF80B, 0x560B, 0x5613, 0xB41A, 0xB412,
+  0xEE09, 0x1222, 0xEE09, 0x9131, 0x9131, 0x0000, 0x0B21, 0x1161,
+  0x3149, 0x1169, 0xF178, 0xD190, 0xF190, 0xD1A8, 0xB1B0, 0x8B58,
+  0x2F14, 0x0018, 0xAEC8, 0xAEE8, 0xB0E0, 0xB0E0, 0xB0E0, 0xB0E0,
+  0xB0E0, 0xB1C8, 0xB1D0, 0x8B60, 0x8B58, 0xD190, 0xD1B0, 0x8B60,
+  0xF178, 0x1161, 0x4220, 0x3149, 0x5149, 0x9131, 0x3149, 0x9131,
+  0x1222, 0x4220, 0x2F31, 0x0007, 0xEE09, 0xD80B, 0xD80B, 0x7904,
+  0x790C, 0x9904, 0x330B, 0x2F3E, 0x0017, 0x5613, 0x5613, 0x560B,
+  0xB41A, 0x5613, 0xB412, 0x0000, 0xEE09, 0x1222, 0x0B21, 0x5149,
+  0x9129, 0x8B60, 0x8B60, 0x1161, 0x1161, 0xD190, 0xD188, 0xD1B0,
+  0xB1A8, 0xB1D0, 0xB1C8, 0xD1B0, 0x3012, 0x001A, 0x4218, 0xACE8,
+  0xACE0, 0xAEE0, 0xAEE8, 0xB0E0, 0x8EC8, 0xB0E0, 0xB1C8, 0x8B98,
+  0xB1C8, 0xB1B0, 0x8B98, 0x8B60, 0xD178, 0x8B60, 0x1161, 0xF178,
+  0x0000, 0x3149, 0x3149, 0x5149, 0x9131, 0x9131, 0x9131, 0x1222,
+  0x3031, 0x0007, 0xEE09, 0x560B, 0xF80B, 0xD80B, 0x990C, 0xD80B,
+  0x3303, 0x303D, 0x001A, 0xEE09, 0x5613, 0x5613, 0x5613, 0x5613,
+  0xB412, 0x531A, 0x0000, 0x0B21, 0x9131, 0x0B19, 0x0B21, 0x3149,
+  0x0B21, 0x8B60, 0x1161, 0x1161, 0x8B60, 0xF190, 0x8B98, 0xB1B0,
+  0xD1B0, 0xB1C8, 0xB1C8, 0xB1C8, 0x4218, 0x3111, 0x0047, 0xE490,
+  0xACE0, 0xACE0, 0xAEE8, 0xAEE0, 0xAEE0, 0xAEE8, 0xB1C8, 0xB0E0,
+  0xB1B0, 0x8B98, 0xB1C8, 0xB1B0, 0xD1B0, 0x8B60, 0xD190, 0x0B19,
+  0xF178, 0x1161, 0x1169, 0x5149, 0x3149, 0x9131, 0x3149, 0x4220,
+  0x1222, 0x1222, 0x9131, 0x0000, 0x0000, 0x0000, 0x0000, 0xEE09,
+  0xD80B, 0xF80B, 0xD80B, 0xD80B, 0x790C, 0x3303, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x423A, 0xF80B, 0xD80B, 0x0E0A, 0xEE09, 0xB41A,
+  0xB41A, 0x531A, 0xEE09, 0x1222, 0x1222, 0x0B19, 0x3151, 0x0B19,
+  0x3151, 0x0B19, 0x1161, 0xF178, 0x8B60, 0xF178, 0x8B58, 0xD190,
+  0xB1C8, 0xB1B0, 0xB1C8, 0xB1C8, 0xB0E8, 0x8B60, 0x3210, 0x0049,
+  0x6B98, 0xAAE8, 0xAAE8, 0xACE0, 0xACE0, 0xAEE0, 0xAEE8, 0xB0E0,
+  0xAEE0, 0xB0E0, 0x4218, 0x4218, 0xB1D0, 0xD1B0, 0x0000, 0xB1A8,
+  0xD190, 0x8B58, 0xF178, 0xF178, 0x1161, 0x1169, 0x3149, 0x3149,
+  0x0000, 0x0000, 0x0B19, 0x1222, 0x1222, 0x4220, 0x0000, 0x0000,
+  0x0000, 0xEE09, 0x5613, 0xF80B, 0x5613, 0xD80B, 0xF80B, 0x3303,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x330B, 0xD80B, 0xB41A, 0x0000,
+  0x0000, 0xEE09, 0x731A, 0x531A, 0x1222, 0xF221, 0x9131, 0x9131,
+  0x0B19, 0x3149, 0x4220, 0x0000, 0x1169, 0xF178, 0x0000, 0x8B60,
+  0xD190, 0xD1A8, 0xD1B0, 0xB1C8, 0xB1C8, 0xB0E0, 0xB0E0, 0xB0E0,
+  0x6B98, 0x330F, 0x004B, 0x8AC8, 0xAAE8, 0xAAE0, 0xACE0, 0xACE0,
+  0xAEE8, 0xAEE0, 0xB0E0, 0xAEE0, 0xB0E0, 0xB0E0, 0xB0E8, 0x8B98,
+  0xB1C8, 0xB1D0, 0x8B98, 0xD190, 0xD1A8, 0xD190, 0xD190, 0xF178,
+  0xF178, 0x1169, 0x3149, 0x3151, 0x0B19, 0x0000, 0x0000, 0x0B21,
+  0x1222, 0xEE09, 0x0000, 0x0000, 0x0000, 0x531A, 0x5613, 0x5613,
+  0xF80B, 0x560B, 0xF80B, 0x330B, 0x0000, 0x0000, 0x0000, 0xEE09,
+  0xD80B, 0x5613, 0x0000, 0x0000, 0x0000, 0xEE09, 0x531A, 0x1222,
+  0x1222, 0x9131, 0x1222, 0x9131, 0x3149, 0x3149, 0x0B19, 0x8B60,
+  0xF178, 0x8B60, 0x8B58, 0xD190, 0xD1B0, 0xB1A8, 0xB1C8, 0xB1C8,
+  0xB0E8, 0xB1C8, 0xB0E0, 0xB0E0, 0xB0E0, 0xD1B0, 0x340E, 0x004D,
+  0xC6C0, 0xC8E0, 0xA8E0, 0xAAE0, 0xAAE8, 0xACE0, 0xACE0, 0xACE0,
+  0x8B98, 0xAEE8, 0xAEE0, 0xB0E0, 0xB0E0, 0xB0E0, 0xB1C8, 0xB1C8,
+  0xB1B0, 0xD1A8, 0xD190, 0xD190, 0xF178, 0xF178, 0x1161, 0x1161,
+  0x3149, 0x3149, 0x9131, 0x0000, 0x0000, 0x0000, 0x9131, 0x1222,
+  0x0000, 0x0000, 0xEE09, 0x0E0A, 0xB412, 0x5613, 0x5613, 0x5613,
+  0xB412, 0xEE09, 0xEE09, 0x0000, 0x0000, 0x5613, 0x5613, 0x0B21,
+  0x0000, 0x0000, 0x0B19, 0x731A, 0xEE09, 0x1222, 0x9131, 0x9131,
+  0x9131, 0x9131, 0x9131, 0x3149, 0x3149, 0x1169, 0x1161, 0xF178,
+  0xF178, 0xD190, 0xD190, 0xD1A8, 0xD1B0, 0xB1C8, 0xB1C8, 0xB0E8,
+  0xB0E0, 0xB0E0, 0xAEE0, 0xB0E0, 0x6B98, 0x350D, 0x004F, 0xC6C0,
+  0xE7E0, 0xA8E8, 0xAAE0, 0xAAE0, 0xACE0, 0xACE8, 0xAEE8, 0x8B58,
+  0x0000, 0x8B98, 0xB0E0, 0xB0E0, 0xB0E8, 0xB1C8, 0xB1C8, 0xD1B0,
+  0xD188, 0xB1B0, 0xD1B0, 0xF190, 0xD190, 0xF178, 0x0000, 0x0B19,
+  0x1169, 0x0B19, 0x3149, 0x9131, 0x0000, 0x0000, 0x0B21, 0x1222,
+  0xEE09, 0x4220, 0xF221, 0x0000, 0xB412, 0xB41A, 0x5613, 0xB412,
+  0x330B, 0x0000, 0x3303, 0x0000, 0x0B21, 0xB41A, 0x3303, 0x0000,
+  0x0000, 0x4220, 0xB412, 0x1222, 0x1222, 0x9131, 0x0000, 0x0B21,
+  0x5149, 0x9131, 0x3149, 0x3149, 0x1161, 0x1161, 0xF178, 0xF178,
+  0xD188, 0xD190, 0xD1B0, 0xB1A8, 0x8B58, 0x0000, 0xB0E0, 0xB0E0,
+  0xB0E0, 0xB0E0, 0xB0E0, 0xAEE8, 0xAEE8, 0x8B98, 0x360C, 0x0051,
+  0x8450, 0xE7E8, 0xC8E0, 0xA8E8, 0xC8E0, 0xAAE0, 0xAAE0, 0xACE8,
+  0xACE0, 0x8AC8, 0x0000, 0x0000, 0xAEC8, 0xB1A8, 0x0000, 0x0000,
+  0x8B60, 0xB1C8, 0xD1B0, 0xB1C8, 0xB1A8, 0xD1B0, 0xD190, 0x0B19,
+  0x0000, 0x0000, 0x0B19, 0x0B21, 0x0000, 0x3149, 0x0B21, 0x0000,
+  0x0000, 0x9131, 0x9129, 0x9131, 0x4218, 0x0000, 0x731A, 0xB41A,
+  0xB412, 0xB41A, 0x531A, 0x0000, 0x0B21, 0x0B19, 0xEE09, 0xB41A,
+  0x4220, 0x0000, 0x4218, 0x531A, 0x0B21, 0x0000, 0x0B19, 0x4220,
+  0x0000, 0x0000, 0x9131, 0x3149, 0x5149, 0x1169, 0x1161, 0xF178,
+  0x4218, 0x0000, 0x4220, 0xD178, 0xD1B0, 0x4218, 0x0000, 0xC498,
+  0xB1D0, 0xB0E0, 0xB0E0, 0xB0E0, 0xAEE8, 0xAEE0, 0xAEE0, 0xAEE0,
+  0x8458, 0x370C, 0x0051, 0x06E9, 0xE7E0, 0x08E1, 0xA8E0, 0xAAE0,
+  0xAAE8, 0x08E1, 0xAAE0, 0xACE0, 0xACE8, 0x8B60, 0x4218, 0xB0E8,
+  0x8B98, 0x0000, 0x0000, 0x6B98, 0xB1D0, 0xB1C8, 0xB1C8, 0xD1B0,
+  0xD190, 0xD1B0, 0x0000, 0x0000, 0x0000, 0x8B60, 0x3149, 0x0000,
+  0x0000, 0x3149, 0x9131, 0x0000, 0x9131, 0x1222, 0x1222, 0x0000,
+  0x0000, 0x531A, 0x531A, 0xB412, 0x531A, 0x531A, 0x0000, 0x0B21,
+  0x531A, 0xB412, 0xB41A, 0x4218, 0x0B21, 0x531A, 0x0B19, 0x0000,
+  0x0B21, 0x9131, 0x0000, 0x0000, 0x0000, 0x5149, 0x3149, 0x1161,
+  0x1161, 0xD178, 0xF178, 0xD178, 0x0000, 0x0000, 0x8B60, 0xB1C8,
+  0x8458, 0x0000, 0xAEC8, 0xB0E0, 0xB0E0, 0xB0E0, 0xB0E0, 0xB0E0,
+  0xAEE0, 0xAEE0, 0xACE0, 0xACE8, 0x380B, 0x0053, 0x8450, 0x26E9,
+  0x06E1, 0xE7E0, 0xC8E8, 0xC8E0, 0xAAE0, 0xA8E0, 0xAAE8, 0xAAE0,
+  0xACE0, 0xAEC8, 0x6B98, 0xAEE8, 0xAEE0, 0x0000, 0x0000, 0xD1A8,
+  0xB0E8, 0xB1C8, 0xB1C8, 0x6B98, 0x4218, 0xD190, 0x4220, 0x0000,
+  0x0000, 0x0000, 0x5149, 0x0B19, 0x0000, 0x0000, 0x3151, 0x9131,
+  0x9131, 0x9129, 0x9131, 0x0000, 0x0000, 0x0E0A, 0x1222, 0xF221,
+  0x531A, 0xEE09, 0x0000, 0x0000, 0x1222, 0x1222, 0x531A, 0x1222,
+  0xF221, 0x4220, 0x0000, 0x0000, 0x9131, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x3149, 0x0B19, 0x0000, 0x1169, 0x1161, 0xF178, 0xD190,
+  0x8B60, 0x0000, 0xD1B0, 0xD1A8, 0x6BA0, 0x8B98, 0xB0E0, 0xB1C8,
+  0xB0E8, 0xAEE0, 0xB0E0, 0xAEE0, 0xAEE8, 0xACE0, 0xACE0, 0xAAE0,
+  0x4218, 0x390B, 0x0053, 0x4218, 0x65E1, 0x06E9, 0x08E1, 0xC8E0,
+  0xA8E0, 0xC8E0, 0xAAE8, 0xAAE0, 0x6BA0, 0x8B98, 0xAEE0, 0x8AC8,
+  0x8BA0, 0xAEE8, 0x4218, 0x8450, 0xB0E0, 0xB0E0, 0xB0E8, 0xB1C8,
+  0xB1C8, 0xB1B0, 0xD1A8, 0x8B60, 0x8B60, 0x8B60, 0x8B60, 0x1161,
+  0x1169, 0x4218, 0x0000, 0x0000, 0x6B60, 0x9129, 0x9131, 0x4220,
+  0x0000, 0x0000, 0x1222, 0x1222, 0xF221, 0x1222, 0x1222, 0x0000,
+  0x0000, 0x0B19, 0xF221, 0x1222, 0x1222, 0x0000, 0x0000, 0x0000,
+  0x9131, 0x9131, 0x4220, 0x4218, 0x0B21, 0x4218, 0x1161, 0x8B60,
+  0x1161, 0x1161, 0xD178, 0xF178, 0xD1B0, 0xD190, 0x8458, 0xD1A8,
+  0xD190, 0x8B58, 0xB0E8, 0xB1C8, 0x6B98, 0xB0E0, 0xB0E0, 0xAEE0,
+  0xB0E0, 0xAEE0, 0xAEE8, 0xACE8, 0xACE8, 0x4218, 0x3A0B, 0x0052,
+  0x4218, 0x06E9, 0x06E9, 0xE7E0, 0xE7E0, 0xC8E8, 0xC8E0, 0xA8E0,
+  0xC6C0, 0x4218, 0x0000, 0xACE8, 0xAEE0, 0xAEE8, 0xAEE0, 0xAEC8,
+  0xB0E0, 0xB0E0, 0xB0E0, 0x8B58, 0x0000, 0xB1B0, 0xB1C8, 0x8B98,
+  0x8B60, 0x4218, 0x8B60, 0x8B60, 0xD178, 0x1161, 0x1169, 0x3149,
+  0x4218, 0x0000, 0x5149, 0x9131, 0x0000, 0x0000, 0x0000, 0x9131,
+  0x1222, 0x9131, 0x1222, 0xEE09, 0x0000, 0x0000, 0x0000, 0x9131,
+  0x1222, 0x4218, 0x0000, 0x0B21, 0x9131, 0x9131, 0x9131, 0x0B19,
+  0x3149, 0x0B21, 0x3149, 0x3149, 0x1169, 0x1161, 0x4218, 0x0000,
+  0xF190, 0xD190, 0xD1B0, 0xD1B0, 0xB1C8, 0xB1B0, 0xB1C8, 0xB1C8,
+  0x8B60, 0x0000, 0x8B98, 0xAEE8, 0xB0E0, 0xAEE0, 0xAEE8, 0xACE0,
+  0xACE0, 0xAAE0, 0x3B0C, 0x0015, 0x65E1, 0x26E1, 0x06E1, 0xE7E8,
+  0xE7E0, 0xA8E0, 0xAAE8, 0x8458, 0xE490, 0x8AC8, 0xAEE0, 0xACE0,
+  0xAEE8, 0xAEE0, 0xB0E0, 0xB0E0, 0xB0E0, 0xB0E8, 0x8B58, 0x8BA0,
+  0x6B98, 0x3B27, 0x001B, 0x8B60, 0xF178, 0x8B60, 0x1161, 0x1161,
+  0x1169, 0x5149, 0x3149, 0x0000, 0x0000, 0x0000, 0x5149, 0x9131,
+  0x9131, 0x9131, 0x9129, 0x0000, 0x0000, 0x0000, 0x9131, 0x9131,
+  0x9131, 0x9131, 0x3149, 0x0B21, 0x5149, 0x9131, 0x3B47, 0x0016,
+  0x4218, 0x8B60, 0x0B19, 0x0000, 0xD190, 0xB1A8, 0xD1B0, 0xB1C8,
+  0xB1C8, 0xB1C8, 0xB1C8, 0xB0E8, 0x6B98, 0x8B60, 0x4218, 0xB0E0,
+  0xAEE0, 0xAEE8, 0xACE0, 0xAEE0, 0xACE0, 0xACE8, 0x3C0C, 0x0014,
+  0x65C1, 0x65E9, 0x08E1, 0xE7E0, 0xA8E0, 0xC8E8, 0xA8E0, 0xC6C0,
+  0x8B98, 0xACE8, 0xACE0, 0xACE0, 0xACE0, 0xAEE8, 0xAEE0, 0xB0E0,
+  0xB1A8, 0xB1C8, 0xB1C8, 0xE498, 0x3C27, 0x001B, 0xD178, 0xF178,
+  0x0000, 0x0000, 0x4218, 0x8B60, 0x1161, 0x4218, 0x0000, 0x0000,
+  0x0000, 0x0B21, 0x9131, 0x9131, 0x9131, 0x0B19, 0x0000, 0x0000,
+  0x0000, 0x0B21, 0x9131, 0x0B19, 0x4220, 0x0000, 0x0000, 0x0B19,
+  0x3149, 0x3C49, 0x0014, 0x0B21, 0xD190, 0xD1B0, 0x8B98, 0xB1B0,
+  0xD1B0, 0xB1C8, 0xB1C8, 0xB0E0, 0xB1C8, 0xB0E8, 0x8EC8, 0xE490,
+  0xAEE8, 0xAEE0, 0xACE0, 0xACE8, 0xACE0, 0xACE0, 0x8AC8, 0x3D0C,
+  0x0016, 0x85C1, 0x65E1, 0x06E1, 0xE7E8, 0x08E1, 0xA8E0, 0xC8E0,
+  0xA8E0, 0xACE8, 0xAAE0, 0xACE8, 0xE490, 0x8EC8, 0xAEE0, 0xAEE0,
+  0xAEE8, 0xAED0, 0x6B98, 0xB0E0, 0xD1B0, 0x8B60, 0x4218, 0x3D27,
+  0x0036, 0xD190, 0xF178, 0x0000, 0x0000, 0x0000, 0x0000, 0x0B21,
+  0x0B21, 0x0000, 0x0000, 0x0000, 0x5149, 0x9131, 0x3149, 0x9131,
+  0x5149, 0x0000, 0x0000, 0x0000, 0x0B19, 0x0B21, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x3149, 0x3151, 0x4218, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x4218, 0xF178, 0xD190, 0xD1A8, 0xD190, 0x8B60, 0xD1A8,
+  0xB1D0, 0xB1C8, 0xB0E0, 0xD1A8, 0xB1C8, 0xB0E0, 0xB0E0, 0xAEE0,
+  0xAEE8, 0xAEE0, 0xAEE0, 0xACE0, 0xACE8, 0xAAE0, 0x8AC8, 0x3E0C,
+  0x0051, 0xC490, 0x65E9, 0x06E1, 0x06E9, 0xE7E0, 0xE7E0, 0xC8E0,
+  0xAAE8, 0xC8E0, 0xAAE0, 0x6B98, 0x0000, 0xE490, 0xAEE8, 0xAEE8,
+  0xB0E0, 0xAEE0, 0xB1A8, 0x0000, 0x8B98, 0xB1B0, 0xB1C8, 0xB1C8,
+  0xB1D0, 0xD1A8, 0xB1B0, 0xD188, 0xD1B0, 0x0B19, 0x0000, 0x0000,
+  0x0000, 0x4218, 0x1169, 0x0000, 0x0000, 0x0000, 0x0000, 0x0B19,
+  0x3151, 0x5149, 0x3149, 0x0B21, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x5149, 0x4220, 0x0000, 0x0000, 0x0000, 0x0B19, 0x1169, 0x8B60,
+  0x1161, 0x1161, 0xF178, 0xD178, 0xF178, 0xD190, 0xF178, 0x0000,
+  0x8B60, 0xB1B0, 0xB1C8, 0xB1C8, 0xB0E0, 0x8B98, 0x0000, 0x8B60,
+  0xB0E8, 0xAEE0, 0xAEE0, 0xAEE8, 0xAEE0, 0xACE0, 0xACE0, 0xAAE8,
+  0xAAE0, 0x8450, 0x3F0C, 0x0022, 0xE490, 0x45E1, 0x65E9, 0x26E1,
+  0x06E1, 0xE7E0, 0x08E1, 0xA8E8, 0xAAE0, 0xAAE8, 0x27D1, 0xAEC8,
+  0xACE0, 0xACE0, 0xAEE0, 0xAEE8, 0xB0E8, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x4218, 0xD178, 0x8B98, 0x6BA0, 0xD1A8, 0xB1C8, 0xD190,
+  0x8BA0, 0x0000, 0x0000, 0x4218, 0xF190, 0x8B60, 0x3F33, 0x0003,
+  0x3149, 0x1169, 0x5149, 0x3F3B, 0x000C, 0x3149, 0x1169, 0x4218,
+  0x0000, 0x0000, 0x5149, 0x3149, 0xD178, 0xF178, 0xD178, 0x8B60,
+  0x8B60, 0x3F4C, 0x0011, 0xB1C8, 0xB1C8, 0xB1C8, 0xB0E0, 0xB0E0,
+  0xAEC8, 0x8EC8, 0xB0E0, 0xB0E0, 0xAEE8, 0xAEE0, 0xACE0, 0xACE0,
+  0xACE8, 0xACE0, 0xAAE8, 0x8458, 0x400C, 0x0011, 0x8458, 0xA6E1,
+  0x06E9, 0x26E1, 0x08E1, 0xE7E0, 0xC8E8, 0xA8E0, 0xC8E0, 0xAAE0,
+  0xAAE8, 0xACE0, 0xACE0, 0xACE0, 0xACE8, 0xAEE0, 0xC490, 0x4025,
+  0x0009, 0x8B58, 0x8B60, 0xD1B0, 0x8B58, 0x0000, 0x4218, 0xD190,
+  0xD190, 0x4220, 0x4033, 0x0003, 0x4218, 0x0B21, 0x4218, 0x403B,
+  0x0009, 0x4220, 0x1169, 0x1161, 0x4218, 0x0000, 0x8B60, 0x1169,
+  0xF178, 0x4218, 0x404C, 0x0011, 0x8458, 0xB1D0, 0xB1C8, 0xB0E8,
+  0xB0E0, 0xB0E0, 0xAEE0, 0xB0E0, 0xAEE0, 0xAEE8, 0xACE0, 0xACE0,
+  0xACE0, 0xACE8, 0xAAE0, 0xAAE0, 0x4218, 0x410C, 0x0011, 0x4218,
+  0xA6E1, 0x65E9, 0x06E1, 0x06E1, 0xE7E0, 0xE7E8, 0xC6C0, 0xC6C0,
+  0xC8E0, 0xAAE0, 0xC6C0, 0xACE0, 0xACE8, 0xAEE8, 0xACE8, 0x4218,
+  0x4124, 0x0009, 0x6B98, 0x8B60, 0x8B58, 0xD1B0, 0xD190, 0x8B98,
+  0xD1B0, 0xD188, 0xD190, 0x413C, 0x0007, 0xF178, 0xD178, 0xF178,
+  0x8B60, 0xD190, 0xF178, 0x8B58, 0x414D, 0x0010, 0x8EC8, 0xB0E0,
+  0xB0E0, 0xB0E0, 0xB0E0, 0xB0E0, 0xAEE0, 0xAEE8, 0xACE0, 0xAEE0,
+  0xACE0, 0xACE8, 0xAAE0, 0xAAE8, 0xC8E8, 0x4218, 0x420D, 0x0020,
+  0xC5E9, 0x65E9, 0x65E1, 0x06E1, 0x06E1, 0x8458, 0x0000, 0x0000,
+  0xC8E8, 0xE490, 0x0000, 0x0000, 0x8B58, 0xACE8, 0xAEE0, 0x6B98,
+  0xAED0, 0x6B98, 0x8B98, 0x8458, 0x4218, 0x0000, 0x0000, 0x8B60,
+  0x6BA0, 0xB1D0, 0xB1C8, 0xD1A8, 0xB1B0, 0xD1A8, 0xB1B0, 0x8B58,
+  0x423C, 0x0008, 0x4218, 0xF178, 0xD178, 0xD190, 0xF178, 0xD190,
+  0x8B60, 0x4218, 0x4249, 0x0013, 0x8B60, 0x8BA0, 0xD1B0, 0x8B58,
+  0xB1D0, 0xB0E0, 0x6B98, 0x4218, 0x0000, 0x8458, 0xAEE8, 0x8458,
+  0x0000, 0x8B60, 0xACE8, 0xAAE0, 0xAAE0, 0xC8E8, 0xA8E0, 0x430D,
+  0x0020, 0x65C1, 0xC5E9, 0x65E1, 0x45E1, 0xC6C0, 0x0000, 0x0000,
+  0x0000, 0xC8E8, 0xAAE8, 0x4218, 0x6B98, 0xAAE0, 0xACE8, 0xACE0,
+  0xAEE0, 0xAEE0, 0xB0E0, 0xAEE8, 0xB0E0, 0xB0E0, 0xB0E0, 0xAEE0,
+  0xAEE8, 0xB1C8, 0xB0E0, 0xB1C8, 0xB1C8, 0xD1B0, 0xB1A8, 0x8BA0,
+  0x8B60, 0x433C, 0x0020, 0x8B60, 0x4218, 0xF178, 0xD190, 0xD1A8,
+  0xD190, 0xD1A8, 0xD190, 0xD190, 0x8B98, 0xB1B0, 0xD1A8, 0xB1D0,
+  0xB1C8, 0xB0E0, 0xB0E0, 0xB0E0, 0xB0E0, 0xB0E0, 0x8EC8, 0xE498,
+  0x0000, 0x6B98, 0xAEE8, 0x8450, 0x0000, 0x0000, 0xE490, 0xACE8,
+  0xAAE0, 0xAAE0, 0xC6C0, 0x440D, 0x0020, 0x85C1, 0xA6E1, 0x65E9,
+  0x45E1, 0xE490, 0x0000, 0x0000, 0x0000, 0xC490, 0xC8E8, 0xAAE8,
+  0xAAE0, 0xAAE0, 0xAAE0, 0xACE8, 0xACE0, 0xAEE0, 0xACE0, 0xAEE8,
+  0xAEE0, 0xB0E0, 0xAEE0, 0xB0E0, 0xB0E0, 0xB0E0, 0xB1C8, 0xB1C8,
+  0xB1C8, 0xB1D0, 0x4218, 0xD190, 0x4218, 0x443C, 0x0020, 0x4220,
+  0x8BA0, 0x0000, 0xB1A8, 0xD190, 0xD1A8, 0xD1B0, 0xB1A8, 0xD1B0,
+  0xB1C8, 0xB1B0, 0xB1C8, 0xB1C8, 0xB0E0, 0xB1C8, 0xB0E8, 0xB0E0,
+  0xB0E0, 0xAEE0, 0xB0E0, 0xAEE0, 0xAEE8, 0xACE0, 0xAEC8, 0x0000,
+  0x0000, 0x0000, 0x4218, 0xAAE8, 0xAAE0, 0xA8E8, 0xE490, 0x450D,
+  0x001F, 0x8450, 0xC5E9, 0xA6E9, 0xC5E9, 0x8458, 0x0000, 0x0000,
+  0x0000, 0x4218, 0xC8E0, 0xA8E0, 0xAAE8, 0xAAE0, 0xAAE8, 0x8458,
+  0x8450, 0xACE0, 0xAEE8, 0xAEE0, 0xB0E0, 0xAEE0, 0xB0E0, 0xAEE8,
+  0xB0E0, 0xB0E0, 0xB0E0, 0xB0E0, 0xB0E0, 0x8B60, 0x8B98, 0xD1B0,
+  0x453D, 0x001F, 0xD190, 0x8B60, 0x4218, 0xB1C8, 0xB1B0, 0xB1C8,
+  0xD1A8, 0xB1D0, 0xB1C8, 0xB1C8, 0xB1C8, 0xB0E0, 0xB0E0, 0xB0E0,
+  0xB0E0, 0xB1B0, 0x8B98, 0xB0E0, 0xAEE0, 0xB0E0, 0xAEE0, 0xAEE8,
+  0xC490, 0x0000, 0x0000, 0x0000, 0x0000, 0xAAE0, 0xC8E8, 0xA8E8,
+  0x8450, 0x460D, 0x001F, 0x4218, 0xC5F1, 0xC5E9, 0x65E1, 0x8450,
+  0x0000, 0x0000, 0x0000, 0x6BA0, 0xC8E8, 0xA8E0, 0x8AC8, 0x8450,
+  0x0000, 0x0000, 0x8B60, 0xACE8, 0xACE0, 0xAEE0, 0xAEC8, 0xAEE8,
+  0x8B98, 0xAEE8, 0xAEE0, 0xB0E0, 0x8EC8, 0xB0E0, 0xB1C8, 0x0000,
+  0x8B98, 0x6BA0, 0x463D, 0x001F, 0x8B98, 0x6B98, 0x0000, 0xD1B0,
+  0xB1C8, 0xB1B0, 0xB1C8, 0xB1C8, 0xB1D0, 0x8B98, 0xB0E0, 0xB1C8,
+  0xB0E8, 0xB0E0, 0xB0E0, 0x6B98, 0x0000, 0x0000, 0x8B58, 0xAED0,
+  0xAEE8, 0xACE0, 0x8EC8, 0x0000, 0x0000, 0x0000, 0x4218, 0xC8E8,
+  0xA8E0, 0xC8E8, 0x4218, 0x470E, 0x001D, 0x85F2, 0xC5E9, 0xC5E9,
+  0x8450, 0x0000, 0x0000, 0x0000, 0xC6C0, 0x08E1, 0xA8E8, 0xC6C0,
+  0x0000, 0x0000, 0x8458, 0xACE0, 0xACE0, 0xACE8, 0x8458, 0x8450,
+  0xAEE8, 0xAEE0, 0xAEE8, 0xAEC8, 0x0000, 0xC490, 0xB0E8, 0x8B98,
+  0x8B60, 0xB0E8, 0x473D, 0x001E, 0x4218, 0xAED0, 0x4218, 0x8B58,
+  0xB1D0, 0xD190, 0x4218, 0xB1C8, 0xB1C8, 0xB0E0, 0xB0E8, 0x6B98,
+  0x8458, 0xB0E0, 0xB0E0, 0xB0E0, 0x8B60, 0x0000, 0x0000, 0xE490,
+  0xACE0, 0xACE0, 0xAAE8, 0x0000, 0x0000, 0x0000, 0x4218, 0xE7E0,
+  0xA8E8, 0x08E1, 0x480E, 0x001D, 0x65C1, 0x85F2, 0xC5E9, 0xC490,
+  0x0000, 0x0000, 0x0000, 0xC6C0, 0xE7E0, 0xE7E0, 0xC6C0, 0x8450,
+  0x8458, 0xAAE8, 0xAAE8, 0xACE0, 0x8450, 0x0000, 0x8BA0, 0xAEE0,
+  0xACE8, 0x8450, 0x0000, 0x8B60, 0xAEE8, 0xB0E0, 0x8EC8, 0xB0E0,
+  0x8B98, 0x483E, 0x001D, 0x6B98, 0xB1D0, 0xD1A8, 0xB0E0, 0xB1C8,
+  0x8458, 0x0000, 0x8458, 0xB1D0, 0xB0E0, 0x6B98, 0x0000, 0x8B60,
+  0xAEE8, 0xAEE0, 0xAEE0, 0x4218, 0x8458, 0x8AC8, 0xAAE8, 0xAAE0,
+  0xAAC8, 0x0000, 0x0000, 0x0000, 0x8458, 0x8B98, 0xE7E8, 0xC490,
+  0x490E, 0x001D, 0xA362, 0x85F2, 0xA362, 0x8458, 0x8458, 0x0000,
+  0x0000, 0x0000, 0x26E1, 0xE7E0, 0x8AC8, 0xC6C0, 0xA8E0, 0xC8E8,
+  0xAAE8, 0x8458, 0x0000, 0x4218, 0xACE0, 0xACE8, 0x0000, 0x0000,
+  0x6B98, 0xAEE0, 0xB0E0, 0xAED0, 0x8B58, 0x8ED0, 0x8B60, 0x493E,
+  0x001D, 0x8B58, 0xB1D0, 0x8B98, 0x8EC8, 0xB0E0, 0xB0E0, 0x8B58,
+  0x0000, 0x0000, 0xAEE8, 0xB0E8, 0x4218, 0x0000, 0x8450, 0xAEE8,
+  0xAEE0, 0xAEE8, 0x8B98, 0x6B98, 0xACE0, 0xACE8, 0x8458, 0x0000,
+  0x0000, 0x0000, 0x8458, 0xC6C0, 0xE7E8, 0xE490, 0x4A0E, 0x001C,
+  0x4218, 0x85F2, 0x65C9, 0x4218, 0xC498, 0x0000, 0x0000, 0x0000,
+  0x8458, 0x06E9, 0xE7E0, 0xE7E0, 0xC8E8, 0xE7E0, 0x8450, 0xE498,
+  0x8AC8, 0xACE8, 0xAAE0, 0xACE0, 0x8450, 0x8AC8, 0xACE8, 0xAEE8,
+  0x4218, 0x0000, 0xAEC8, 0xAEE8, 0x4A3F, 0x001C, 0xB0E0, 0xAEC8,
+  0x0000, 0x4218, 0xB0E8, 0xAEE0, 0x8EC8, 0x0000, 0xAEE8, 0xAEE0,
+  0xAEE0, 0x8B98, 0x0000, 0x4218, 0x8ED0, 0xACE8, 0xACE0, 0xAAE0,
+  0xAAE8, 0x8AC8, 0x0000, 0x0000, 0x0000, 0x8450, 0x8458, 0xC6C0,
+  0x26E9, 0x4218, 0x4B0F, 0x001B, 0x85F2, 0x65F2, 0x4218, 0x4232,
+  0x85C9, 0xC490, 0x0000, 0x85C1, 0x26E1, 0x06E1, 0xE7E0, 0x08E1,
+  0x8AC8, 0xAAE8, 0xC8E0, 0xAAE8, 0xC6C0, 0x0000, 0x6B98, 0xACE0,
+  0xACE8, 0x8B98, 0x0000, 0x0000, 0xAEE8, 0xAEE8, 0x4218, 0x4B3F,
+  0x001B, 0x4218, 0xB0E0, 0x8EC8, 0x0000, 0x0000, 0x8B98, 0xAEE8,
+  0xB0E0, 0xAEE8, 0x4218, 0x8B98, 0xAEE0, 0xACE8, 0xACE0, 0x8AC8,
+  0xACE0, 0xAAE0, 0xACE8, 0xAAE8, 0x8AC8, 0x0000, 0x4218, 0x8458,
+  0xE498, 0x4218, 0x26E1, 0x06E9, 0x4C0F, 0x001A, 0x64CA, 0x65F2,
+  0xA39A, 0x0000, 0x8458, 0xE490, 0xA6E9, 0x65E1, 0x4218, 0x0000,
+  0x8458, 0x0000, 0xC6C8, 0xA8E0, 0xC8E8, 0xC490, 0x0000, 0x0000,
+  0x8B98, 0x8AC8, 0x4218, 0x0000, 0x4220, 0xACE8, 0xAEE0, 0x8B58,
+  0x4C40, 0x001A, 0x8458, 0xAED0, 0x8EC8, 0x0000, 0x0000, 0x4218,
+  0xAED0, 0x8AC8, 0x0000, 0x0000, 0x8B60, 0xACE8, 0xACE0, 0xAAE0,
+  0x4218, 0x4218, 0x0000, 0x4220, 0xC8E8, 0xA8E8, 0xE490, 0x8450,
+  0x0000, 0x8458, 0x06E9, 0xC6C0, 0x4D0F, 0x001A, 0x8450, 0x65FB,
+  0x64CA, 0x0000, 0x0000, 0x8458, 0xC5E9, 0x8450, 0x0000, 0x0000,
+  0x0000, 0x0000, 0xE7E8, 0xE7E0, 0xC6C0, 0x0000, 0x0000, 0xC8E0,
+  0x8AC8, 0x0000, 0x0000, 0x0000, 0xAEC8, 0xAAE8, 0x8EC8, 0x8BA0,
+  0x4D40, 0x001A, 0xAEC8, 0x8AC8, 0x6B98, 0xAED0, 0x4218, 0x0000,
+  0x0000, 0x8AC8, 0xAEC8, 0x0000, 0x0000, 0x8AC8, 0xACE0, 0xAAE8,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x8458, 0xC8E8, 0xC490, 0x0000,
+  0x0000, 0x8450, 0x65E9, 0x8458, 0x4E10, 0x0018, 0x65FB, 0x65F3,
+  0x0000, 0xA39A, 0xC5E9, 0x8450, 0x0000, 0x0000, 0x0000, 0x0000,
+  0xE498, 0x06E9, 0xE7E0, 0x8450, 0x0000, 0xC8E8, 0x6B98, 0x0000,
+  0x0000, 0x0000, 0x8BA0, 0x8EC8, 0xAAE8, 0xACE0, 0x4E41, 0x0018,
+  0xAEE0, 0x8AC8, 0x8B98, 0x8B98, 0x4218, 0x0000, 0x0000, 0x8AD0,
+  0x8AC8, 0x0000, 0x8458, 0xAAE8, 0xAAE0, 0xE490, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x8458, 0xE7E8, 0xE490, 0x0000, 0x65C1, 0x65E9,
+  0x4F10, 0x0018, 0x84CB, 0x65F3, 0x65FB, 0x85F2, 0x64CA, 0x4218,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x65E1, 0x26E9, 0x06E9, 0x4218,
+  0x27D1, 0xC6C0, 0x0000, 0x0000, 0x0000, 0x6B98, 0xAAE0, 0xAAE8,
+  0x08E1, 0xE490, 0x4F41, 0x0018, 0xC490, 0xAEE8, 0xAEC8, 0xAEC8,
+  0x8AC8, 0x0000, 0x0000, 0x0000, 0xAAC8, 0x8AC8, 0x0000, 0xAAE0,
+  0xC8E8, 0xAAE8, 0x8450, 0x0000, 0x0000, 0x0000, 0x0000, 0xC6C0,
+  0x06E1, 0x65C1, 0x65E9, 0x65C1, 0x5010, 0x0017, 0x6450, 0x65FB,
+  0x85F2, 0x8450, 0x64CA, 0x85F2, 0x65C1, 0xC490, 0xE498, 0xC5E9,
+  0x65C1, 0x0000, 0x27D1, 0x06E9, 0xE490, 0x0000, 0x0000, 0x0000,
+  0x8458, 0xC8E8, 0xA8E0, 0xAAE0, 0x8AC8, 0x5042, 0x0017, 0xAAC8,
+  0xACE8, 0xAAE0, 0xACE0, 0x8450, 0x0000, 0x0000, 0x0000, 0xE498,
+  0xA8E8, 0xC8E0, 0x8450, 0xC498, 0xC8E8, 0xC490, 0x8458, 0x8458,
+  0x06E9, 0xC6C0, 0x4218, 0xC6C0, 0x65E9, 0x8450, 0x5111, 0x0016,
+  0x65F3, 0x65FB, 0xE498, 0x84CB, 0xC490, 0xC39A, 0x8458, 0x64CA,
+  0xC5E9, 0x0000, 0x4218, 0x65E1, 0x06E9, 0x06E1, 0xC6C0, 0xC6C0,
+  0xC6C0, 0xE7E0, 0xC8E0, 0xA8E8, 0xC8E8, 0x8450, 0x5142, 0x0016,
+  0xC490, 0xAAE8, 0xACE0, 0xAAE0, 0xAAE8, 0x8B98, 0xC6C0, 0x6BA0,
+  0x8B98, 0xA8E0, 0xC8E0, 0xC6C0, 0x0000, 0xE7E0, 0x26E9, 0x8458,
+  0xC6C0, 0xC6C0, 0x06E1, 0xE490, 0xC5E9, 0xA6E9, 0x5211, 0x0015,
+  0x84CB, 0x84CB, 0x0000, 0xC490, 0x4218, 0x8458, 0x85F2, 0xC5E9,
+  0x8458, 0x0000, 0xA6E9, 0x65E1, 0x45E1, 0x06E9, 0x26E1, 0x08E1,
+  0x08E1, 0xE7E0, 0xE7E0, 0xC8E8, 0xC6C0, 0x5243, 0x0015, 0x8AC8,
+  0xAAE0, 0xAAE0, 0xC8E0, 0xAAE8, 0xA8E0, 0xC8E0, 0xA8E0, 0xC8E8,
+  0xA8E0, 0xE7E0, 0x0000, 0x4218, 0x08E1, 0x27D9, 0x8450, 0x8458,
+  0x8458, 0x4218, 0xC5F1, 0x85C1, 0x5311, 0x0015, 0x8450, 0x85FC,
+  0x64CA, 0x84CB, 0xA39A, 0x65F3, 0x85F2, 0x64CA, 0x0000, 0x64CA,
+  0xC5E9, 0xC490, 0x8458, 0xE498, 0x8450, 0x65E1, 0x06E9, 0x06E1,
+  0xE7E8, 0x08E9, 0x4218, 0x5343, 0x0015, 0x4218, 0xAAE0, 0xC8E0,
+  0xAAE0, 0xA8E8, 0xC8E8, 0xC490, 0xE498, 0xC490, 0xE490, 0xE7E0,
+  0xC6C0, 0x0000, 0x65C1, 0x65E9, 0xA6E9, 0x8450, 0x65C9, 0xC5E9,
+  0x85F2, 0x4218, 0x5412, 0x0013, 0x84CB, 0x85FC, 0x65FB, 0x65F3,
+  0x65F2, 0x4218, 0x8458, 0xA39A, 0xC5E9, 0x85C1, 0xC490, 0xE498,
+  0x45E9, 0x65E1, 0x45E1, 0x65E9, 0x06E1, 0x06E1, 0x8450, 0x5444,
+  0x0013, 0x8458, 0xC8E8, 0xC8E8, 0xA8E0, 0xC8E0, 0xE7E0, 0xE7E8,
+  0xC490, 0x8450, 0x06E9, 0x26E9, 0xE490, 0xC490, 0x8458, 0xC6C0,
+  0xC5E9, 0xC5E9, 0x85F2, 0x65C1, 0x5512, 0x0012, 0x2232, 0x85FC,
+  0x65FC, 0xA362, 0xA36A, 0x4218, 0x84CB, 0x85F2, 0x8458, 0x8450,
+  0x85EA, 0xC5E9, 0xC5E9, 0xA6E1, 0xC5E9, 0x65E9, 0x65E1, 0xC6C0,
+  0x5545, 0x0012, 0xC6C0, 0xE7E0, 0xE7E0, 0x06E9, 0xE7E0, 0x26E1,
+  0x06E1, 0x45E9, 0xE498, 0x4218, 0x45E9, 0xC5E9, 0x8458, 0x8450,
+  0xC490, 0x85F2, 0x85F2, 0x4218, 0x5613, 0x0010, 0x84CC, 0x65FC,
+  0x0000, 0xC490, 0xC39A, 0x65FB, 0x85F2, 0xC490, 0x85F2, 0x65EA,
+  0x85F2, 0xC5E9, 0xC5E1, 0xA6E1, 0xC5E9, 0x65C1, 0x5646, 0x0010,
+  0xC6C0, 0x06E1, 0x08E1, 0x26E9, 0x06E1, 0x65E1, 0x06E1, 0x65E9,
+  0x8450, 0x85C1, 0xA6E9, 0xE490, 0x8458, 0x8458, 0x85F2, 0xA39A,
+  0x5714, 0x000E, 0x85FD, 0x84CB, 0x84CB, 0x85FC, 0x84CB, 0xA39A,
+  0x65F3, 0x65FB, 0x65F3, 0x65EA, 0x85F2, 0x65EA, 0x85F2, 0xC5E9,
+  0x5747, 0x000E, 0xC6C0, 0x65E1, 0x45E1, 0x65E1, 0x65E1, 0xC5E9,
+  0xA6E1, 0xC5E9, 0x65C1, 0x64CA, 0xC5E9, 0x65F2, 0x85EA, 0x65FB,
+  0x5814, 0x000D, 0xA362, 0x65FD, 0x85F4, 0x65FC, 0x65F3, 0x85FC,
+  0x65F3, 0x65F3, 0x65F2, 0x65F3, 0x85EA, 0x65F2, 0xC5E9, 0x5848,
+  0x000D, 0x8450, 0x45E9, 0x65E1, 0xC5E9, 0xC5E9, 0xC5E9, 0xA6E1,
+  0x85EA, 0xA6E1, 0x85F2, 0x85EA, 0x65F3, 0x6458, 0x5915, 0x000B,
+  0xA39A, 0x85F5, 0x65FC, 0x85FD, 0x65F4, 0x85FC, 0x65F3, 0x85FC,
+  0x65F3, 0x65FB, 0xA39A, 0x5949, 0x000B, 0x8450, 0xC5E9, 0xC5E9,
+  0x65EA, 0xC5E9, 0x85EA, 0x65F2, 0x65F3, 0x85F2, 0x65FB, 0xE490,
+  0x5A16, 0x0009, 0xA362, 0x85FD, 0x65FC, 0x85FC, 0x65F4, 0x85FC,
+  0x65F3, 0x65F3, 0x6450, 0x5A4A, 0x0009, 0x4218, 0x64D2, 0xC5E9,
+  0x85F2, 0x85F2, 0x65F3, 0x65F2, 0x65F3, 0x8450, 0x5B17, 0x0006,
+  0x4218, 0x84CC, 0x64CC, 0x84D4, 0x84CB, 0x2232, 0x5B4C, 0x0006,
+  0x4232, 0x65C1, 0x84CB, 0x85F2, 0x64D2, 0x4218 };
@@ -6,6148 +6,4465 @@
 #define IMG_FRAMES 8
 #define IMG_DELAY  20
 
-const uint16_t frames[IMG_FRAMES][IMG_WIDTH * IMG_HEIGHT] = {
-  { 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x1020,
-    0x69A1, 0x9202, 0x2880, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xAA62,
-    0xDAE2, 0xE2E2, 0xD2A2, 0x2081, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x69A1, 0xE2E2,
-    0xDAE2, 0xDAE2, 0xDAE2, 0x8A02, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0xD2A2, 0xDAE2,
-    0xDAE2, 0xDAE2, 0xE2E2, 0xDAA2, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4121, 0xE2E2, 0xDAE2,
-    0xDAE2, 0xDAE2, 0xE2E2, 0xDAE2, 0x1041, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x61A1, 0xE2E2, 0xDAE2,
-    0xDAE2, 0xDAE2, 0xE2E2, 0xAA82, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x89E2, 0xE2E2, 0xDAE2,
-    0xDAE2, 0xDAE2, 0xD2A2, 0x1881, 0x0020, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xAA82, 0xE2E2, 0xDAE2,
-    0xDAE2, 0xDAA2, 0x2061, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xAA82, 0xDAE2, 0xDAE2,
-    0xDAE2, 0x5141, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x89E2, 0xE323, 0xE323,
-    0xCB22, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7A21, 0xE323, 0xDB23,
-    0x61A1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x61A1, 0xE323, 0xE361,
-    0x28A0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x40E2, 0xDB61, 0xC322,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1041, 0xE361, 0xAA82,
-    0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCB22, 0x8A82,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9282, 0x7A21,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x69C1, 0x7A21,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x28A0, 0x69C1,
-    0x0000, 0x0000, 0x0000, 0x7A21, 0xAA82, 0x2061, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5941,
-    0x0000, 0x0000, 0x18A1, 0xEBC1, 0xE361, 0x7221, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1861,
-    0x0000, 0x0000, 0x4121, 0xE3C1, 0xEBC1, 0xC302, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0000,
-    0x0020, 0x0000, 0x5161, 0xEBC1, 0xE3C1, 0xE361, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0020, 0x0000, 0x0020, 0x0000, 0x0020, 0x0000, 0x0020,
-    0x0000, 0x0000, 0x5141, 0xE3C1, 0xE3C1, 0xDB61, 0x0020, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0000, 0x0020, 0x0000,
-    0x0000, 0x0020, 0x5941, 0xEBC1, 0xE3C1, 0xC302, 0x0000, 0x0020,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0020, 0x0000, 0x0020, 0x0000, 0x0020, 0x0000, 0x0020, 0x0000,
-    0x0000, 0x0000, 0x4121, 0xE3C1, 0xE3C1, 0x9282, 0x0020, 0x0000,
-    0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0020, 0x0000, 0x0020, 0x0800, 0x0820, 0x0000, 0x0820, 0x0000,
-    0x0820, 0x0000, 0x1020, 0xEBC1, 0xE3C1, 0x5141, 0x0000, 0x0020,
-    0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,
-    0x0800, 0x0020, 0x0000, 0x0020, 0x0000, 0x0820, 0x0800, 0x0820,
-    0x0000, 0x0820, 0x0000, 0x4921, 0x69C1, 0x0020, 0x0800, 0x0020,
-    0x0000, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020,
-    0x0000, 0x0820, 0x0800, 0x0820, 0x0000, 0x0820, 0x0800, 0x0020,
-    0x0800, 0x0820, 0x0800, 0x0020, 0x0800, 0x0820, 0x0800, 0x0020,
-    0x0000, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000,
-    0x0020, 0x0800, 0x0020, 0x0800, 0x0820, 0x0800, 0x0020, 0x0800,
-    0x0820, 0x0800, 0x0020, 0x0800, 0x0820, 0x0800, 0x0820, 0x0000,
-    0x0820, 0x0000, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0000,
-    0x0820, 0x0800, 0x0820, 0x0800, 0x0820, 0x0820, 0x0000, 0x0820,
-    0x0820, 0x0820, 0x0820, 0x1020, 0x0820, 0x0800, 0x0820, 0x0800,
-    0x0020, 0x0000, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0000, 0x0020,
-    0x0800, 0x0820, 0x0800, 0x0820, 0x0800, 0x0820, 0x0820, 0x0820,
-    0x1020, 0x1020, 0x1020, 0x0820, 0x0820, 0x0820, 0x0820, 0x0000,
-    0x0820, 0x0800, 0x0820, 0x0000, 0x0020, 0x0000, 0x0020, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0820, 0x0800,
-    0x0820, 0x0000, 0x0820, 0x0820, 0x0820, 0x1020, 0x1020, 0x1020,
-    0x1020, 0x28A0, 0x1020, 0x1020, 0x1020, 0x1020, 0x0820, 0x0800,
-    0x0820, 0x0800, 0x0020, 0x0800, 0x0020, 0x0000, 0x0020, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0800, 0x0820,
-    0x0800, 0x0800, 0x0820, 0x1020, 0x1020, 0x1020, 0x1020, 0x1020,
-    0x1020, 0x7A21, 0x1841, 0x1020, 0x1020, 0x1020, 0x1020, 0x0820,
-    0x0820, 0x0020, 0x0800, 0x0820, 0x0800, 0x0020, 0x0000, 0x0020,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0800, 0x0820, 0x0800,
-    0x0820, 0x0820, 0x1020, 0x1020, 0x1020, 0x1020, 0x1841, 0x1041,
-    0x1841, 0x7A21, 0x69A1, 0x1841, 0x1020, 0x1020, 0x1020, 0x1020,
-    0x0820, 0x0800, 0x0820, 0x0000, 0x0820, 0x0000, 0x0020, 0x0000,
-    0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0020, 0x0000, 0x0820, 0x0000, 0x0820, 0x0800,
-    0x0820, 0x1020, 0x1020, 0x1020, 0x1020, 0x1841, 0x1841, 0x1041,
-    0x1841, 0x7A21, 0xB322, 0x1841, 0x1841, 0x1041, 0x1020, 0x1020,
-    0x1020, 0x0820, 0x0800, 0x0820, 0x0800, 0x0820, 0x0000, 0x0020,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0020, 0x0000, 0x0820, 0x0800, 0x0020, 0x0820,
-    0x0820, 0x1020, 0x1020, 0x1841, 0x1841, 0x1841, 0x1841, 0x1041,
-    0x1841, 0x82A1, 0xEC61, 0x2881, 0x1041, 0x1841, 0x1841, 0x1020,
-    0x1020, 0x1020, 0x0820, 0x0800, 0x0820, 0x0000, 0x0020, 0x0000,
-    0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0020, 0x0000, 0x0020, 0x0000, 0x0020, 0x0800, 0x0800, 0x0820,
-    0x1020, 0x1020, 0x1841, 0x1841, 0x1041, 0x2061, 0x2061, 0x1861,
-    0x1861, 0x9282, 0xEC81, 0x69A1, 0x2061, 0x1041, 0x1841, 0x1841,
-    0x1020, 0x1020, 0x0820, 0x0820, 0x0820, 0x0800, 0x0820, 0x0000,
-    0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0020, 0x0800, 0x0820, 0x0800, 0x0020, 0x0820, 0x1020,
-    0x1020, 0x1841, 0x1841, 0x1841, 0x1861, 0x2061, 0x2061, 0x1861,
-    0x2081, 0xA2E1, 0xECA1, 0x9AE1, 0x1841, 0x1861, 0x1841, 0x1841,
-    0x1841, 0x1020, 0x1020, 0x0820, 0x0800, 0x0820, 0x0000, 0x0020,
-    0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,
-    0x0000, 0x0020, 0x0800, 0x0020, 0x0800, 0x0820, 0x1020, 0x1020,
-    0x1841, 0x1841, 0x1041, 0x2061, 0x2061, 0x1861, 0x2061, 0x2081,
-    0x2061, 0xAB61, 0xECA1, 0xE441, 0x2081, 0x1861, 0x2061, 0x1841,
-    0x1841, 0x1041, 0x1020, 0x1020, 0x0820, 0x0800, 0x0820, 0x0800,
-    0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0020, 0x0000, 0x0820, 0x0800, 0x0020, 0x0820, 0x1020, 0x1020,
-    0x1841, 0x1841, 0x2061, 0x1861, 0x2081, 0x6A01, 0x38E2, 0x28A1,
-    0x2881, 0xCBA2, 0xF4C1, 0xF4C1, 0x5141, 0x2081, 0x1861, 0x1861,
-    0x1841, 0x1841, 0x1041, 0x1020, 0x0820, 0x0800, 0x0800, 0x0820,
-    0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0020, 0x0800, 0x0020, 0x0800, 0x0820, 0x1020, 0x1020, 0x1841,
-    0x1841, 0x1861, 0x2061, 0x2061, 0x61A1, 0xF4E1, 0x9AE1, 0x2881,
-    0x2081, 0xDC41, 0xF4C1, 0xF4C1, 0x9AE1, 0x2881, 0x2081, 0x1861,
-    0x2061, 0x1841, 0x1841, 0x1020, 0x0820, 0x0820, 0x0800, 0x0020,
-    0x0800, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000,
-    0x0020, 0x0000, 0x0820, 0x0800, 0x0820, 0x1020, 0x1020, 0x1841,
-    0x2061, 0x1861, 0x2081, 0x2881, 0xBC02, 0xF4C1, 0xDC21, 0x28A1,
-    0x30C1, 0xF4E1, 0xF4C1, 0xECC1, 0xCC01, 0x2081, 0x2061, 0x2081,
-    0x2061, 0x1861, 0x1841, 0x1020, 0x1020, 0x0820, 0x0800, 0x0800,
-    0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,
-    0x0000, 0x0020, 0x0800, 0x0820, 0x1020, 0x1020, 0x1841, 0x1841,
-    0x1861, 0x2061, 0x2061, 0x4121, 0xECC1, 0xF4C1, 0xF502, 0x4962,
-    0x4962, 0xF502, 0xF4C1, 0xF522, 0xECA1, 0x30A1, 0x2881, 0x2081,
-    0x2881, 0x1861, 0x1841, 0x1841, 0x1020, 0x1020, 0x0820, 0x0800,
-    0x0820, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000,
-    0x0820, 0x0000, 0x0820, 0x0820, 0x1020, 0x1020, 0x1841, 0x2061,
-    0x1861, 0x2881, 0x2881, 0x9AE1, 0xF522, 0xF502, 0xF502, 0x7242,
-    0x8281, 0xF502, 0xF502, 0xF502, 0xF521, 0x3102, 0x28A1, 0x28A1,
-    0x2061, 0x2061, 0x1861, 0x1841, 0x1020, 0x1020, 0x0820, 0x0800,
-    0x0020, 0x0800, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,
-    0x0000, 0x0820, 0x0800, 0x0820, 0x1020, 0x1841, 0x1841, 0x1861,
-    0x2061, 0x28A1, 0x28A1, 0xD4A3, 0xF521, 0xF501, 0xF521, 0xBBE2,
-    0xC401, 0xF521, 0xF521, 0xF521, 0xF521, 0x5162, 0x30C1, 0x30A1,
-    0x2881, 0x2081, 0x2061, 0x1041, 0x1841, 0x1020, 0x0820, 0x0820,
-    0x0800, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0800,
-    0x0820, 0x0800, 0x0020, 0x0820, 0x1020, 0x1841, 0x2061, 0x1861,
-    0x2881, 0x2881, 0x7A42, 0xF521, 0xF521, 0xF542, 0xF542, 0xF542,
-    0xED42, 0xF542, 0xF542, 0xF542, 0xED21, 0x6201, 0x30C2, 0x30C1,
-    0x28A1, 0x2061, 0x2081, 0x2061, 0x1041, 0x1020, 0x1020, 0x0820,
-    0x0800, 0x0800, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000,
-    0x0020, 0x0800, 0x0820, 0x1020, 0x1841, 0x1841, 0x1861, 0x2061,
-    0x28A1, 0x30C2, 0xD4C3, 0xF542, 0xF542, 0xF542, 0xED42, 0xF542,
-    0xF542, 0xF542, 0xF542, 0xF542, 0xF542, 0x7A62, 0x38E2, 0x30C1,
-    0x28A1, 0x2881, 0x2881, 0x1861, 0x1841, 0x1020, 0x1020, 0x0820,
-    0x0820, 0x0800, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0820,
-    0x0800, 0x0820, 0x0820, 0x1020, 0x1841, 0x1861, 0x2061, 0x2081,
-    0x2881, 0xB381, 0xF542, 0xF542, 0xF542, 0xF542, 0xF582, 0xF582,
-    0xF562, 0xED82, 0xF562, 0xF582, 0xED42, 0x7A81, 0x3902, 0x30E2,
-    0x30C1, 0x2881, 0x2081, 0x2061, 0x2061, 0x1041, 0x1020, 0x0820,
-    0x0800, 0x0800, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020,
-    0x0800, 0x0820, 0x1020, 0x1020, 0x1841, 0x1861, 0x2061, 0x2881,
-    0x6201, 0xED42, 0xF542, 0xF582, 0xED62, 0xF582, 0xF562, 0xF582,
-    0xF5A2, 0xF5A2, 0xF562, 0xF582, 0xFD82, 0x8323, 0x3922, 0x38E2,
-    0x30C1, 0x28A1, 0x2881, 0x2881, 0x1861, 0x1841, 0x1020, 0x1020,
-    0x0820, 0x0820, 0x0800, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0800,
-    0x0820, 0x0820, 0x1020, 0x1841, 0x1841, 0x2061, 0x2081, 0x28A1,
-    0xDCE1, 0xF542, 0xF582, 0xF582, 0xF562, 0xF5A2, 0xF5A2, 0xF5A2,
-    0xF5A2, 0xF5A2, 0xF5A2, 0xF5A2, 0xF5A2, 0x9323, 0x4122, 0x3902,
-    0x30E2, 0x30C1, 0x28A1, 0x2061, 0x2061, 0x1041, 0x1841, 0x1020,
-    0x0820, 0x0800, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0820,
-    0x0800, 0x0820, 0x1020, 0x1041, 0x2061, 0x1861, 0x2081, 0x6201,
-    0xF542, 0xF562, 0xF582, 0xF582, 0xF5A2, 0xF5A2, 0xF5C3, 0xF5C3,
-    0xF5C3, 0xF5C3, 0xF5C3, 0xF5C3, 0xF5A2, 0x9B23, 0x4942, 0x3922,
-    0x38E2, 0x30C1, 0x28A1, 0x2881, 0x1861, 0x1841, 0x1841, 0x1020,
-    0x0820, 0x0800, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0800,
-    0x0820, 0x0820, 0x1020, 0x1841, 0x2061, 0x2081, 0x2881, 0x9B81,
-    0xF582, 0xF582, 0xF5A2, 0xF5A2, 0xF604, 0xFDE4, 0xF5E3, 0xF5E3,
-    0xF5E3, 0xF5E3, 0xF5E3, 0xF5E3, 0xF5C3, 0x9323, 0x4962, 0x4122,
-    0x3902, 0x38E2, 0x28A1, 0x28A1, 0x2081, 0x2061, 0x1841, 0x1020,
-    0x0820, 0x0800, 0x0800, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0800,
-    0x0820, 0x0820, 0x1020, 0x1841, 0x1861, 0x2061, 0x2881, 0xB3E2,
-    0xF582, 0xF5A2, 0xF5A2, 0xF5C3, 0xF6A7, 0xFEE8, 0xFDE4, 0xF603,
-    0xF603, 0xF603, 0xF603, 0xF5E3, 0xF5E3, 0x9B81, 0x5162, 0x4122,
-    0x4142, 0x38E2, 0x30C1, 0x2881, 0x2881, 0x1861, 0x1841, 0x1020,
-    0x1020, 0x0820, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0800, 0x0820,
-    0x0820, 0x1020, 0x1020, 0x1841, 0x2061, 0x2081, 0x28A1, 0xCCA1,
-    0xFDA2, 0xF5A2, 0xF5C2, 0xF604, 0xFF08, 0xFF29, 0xF685, 0xF623,
-    0xF603, 0xFE23, 0xF603, 0xF603, 0xF5E3, 0xAC43, 0x51A2, 0x4962,
-    0x4122, 0x3902, 0x30C1, 0x30C1, 0x2081, 0x2061, 0x1041, 0x1020,
-    0x1020, 0x0820, 0x0800, 0x0800, 0x0020, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0800,
-    0x0820, 0x1020, 0x1841, 0x1841, 0x1861, 0x2881, 0x28A1, 0xDD02,
-    0xF5A2, 0xF5C2, 0xF5E2, 0xF6A7, 0xF708, 0xFF09, 0xFEA7, 0xF643,
-    0xF643, 0xF643, 0xFE03, 0xF623, 0xF603, 0xE5C2, 0x59A2, 0x4962,
-    0x4942, 0x3922, 0x38E2, 0x28A1, 0x2081, 0x2061, 0x1841, 0x1841,
-    0x1020, 0x0820, 0x0800, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0800, 0x0820,
-    0x0820, 0x1020, 0x1841, 0x1041, 0x2881, 0x2881, 0x30C1, 0xF582,
-    0xF5C2, 0xF5C2, 0xFE66, 0xFF08, 0xFF09, 0xF729, 0xF6A7, 0xF664,
-    0xFE44, 0xF664, 0xF643, 0xF644, 0xFE23, 0xF5E3, 0xAC43, 0x51A2,
-    0x4122, 0x3902, 0x38E2, 0x28C1, 0x28A1, 0x2061, 0x2061, 0x1041,
-    0x1020, 0x0820, 0x0800, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0800,
-    0x0820, 0x1020, 0x1841, 0x1861, 0x82A1, 0x4122, 0x3102, 0xF5C2,
-    0xF5E2, 0xF5E2, 0xFEE8, 0xF729, 0xFF09, 0xFF29, 0xFEE8, 0xF644,
-    0xF664, 0xF685, 0xFF08, 0xFF09, 0xF685, 0xF623, 0xFE03, 0x9BC3,
-    0x5162, 0x4142, 0x38E2, 0x30C1, 0x2881, 0x2081, 0x2061, 0x1841,
-    0x1020, 0x0820, 0x0820, 0x0800, 0x0020, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0820, 0x0800,
-    0x0820, 0x1020, 0x1841, 0x4981, 0xF5C2, 0xCCA1, 0x4121, 0xF5C2,
-    0xF5E2, 0xF602, 0xFF08, 0xFF09, 0xFF29, 0xFF09, 0xFF69, 0xF6A7,
-    0xF707, 0xFF69, 0xFF49, 0xFF69, 0xF6E8, 0xF643, 0xF623, 0xF603,
-    0x72A3, 0x4122, 0x3902, 0x30C1, 0x28A1, 0x2061, 0x2061, 0x1041,
-    0x1020, 0x0820, 0x0800, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0820, 0x0800,
-    0x0820, 0x1020, 0x1021, 0x4121, 0xD4E1, 0x9B81, 0x4161, 0xF5E2,
-    0xF602, 0xF602, 0xF6A7, 0xFF09, 0xF729, 0xFF49, 0xFF69, 0xFF49,
-    0xF769, 0xFF49, 0xFF69, 0xFF49, 0xFF69, 0xF684, 0xF643, 0xFE23,
-    0xE5A2, 0x59C2, 0x3902, 0x38E2, 0x28A1, 0x2081, 0x2061, 0x1041,
-    0x1020, 0x0820, 0x0800, 0x0820, 0x0800, 0x0020, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0800, 0x0820,
-    0x1020, 0x1020, 0x1841, 0x2061, 0x2081, 0x28A1, 0x5162, 0xFE02,
-    0xF602, 0xF602, 0xF685, 0xFF29, 0xFF49, 0xFF69, 0xFF49, 0xF769,
-    0xFF49, 0xFEE5, 0xF707, 0xFF69, 0xFF49, 0xF6A7, 0xF643, 0xF623,
-    0xF623, 0x9BA3, 0x3902, 0x30E2, 0x30A1, 0x2081, 0x2061, 0x1041,
-    0x1020, 0x0820, 0x0800, 0x0800, 0x0020, 0x0000, 0x0020, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0800, 0x0800,
-    0x1020, 0x1020, 0x1041, 0x2061, 0x28A1, 0x28A1, 0x4161, 0xF602,
-    0xF602, 0xF623, 0xF643, 0xF6E8, 0xFF69, 0xFF49, 0xFF69, 0xFF49,
-    0xF705, 0xF6C5, 0xFEE5, 0xFF69, 0xF749, 0xFF07, 0xFE64, 0xF643,
-    0xFE23, 0xE5C2, 0x4142, 0x38E2, 0x28A1, 0x2881, 0x1861, 0x1841,
-    0x1020, 0x1020, 0x0800, 0x0820, 0x0800, 0x0020, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0800, 0x0820, 0x0800,
-    0x1020, 0x1020, 0x1041, 0x2061, 0x28A1, 0x30C1, 0x3902, 0xFE22,
-    0xF623, 0xFE23, 0xF643, 0xF685, 0xFF49, 0xFF69, 0xFF49, 0xFF48,
-    0xF705, 0xF705, 0xFEE5, 0xFF49, 0xFF69, 0xF6E8, 0xF664, 0xF643,
-    0xF623, 0xFE03, 0x6201, 0x30C2, 0x28A1, 0x2081, 0x2061, 0x1041,
-    0x1020, 0x1020, 0x0800, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0800, 0x0800,
-    0x0820, 0x1020, 0x1841, 0x1861, 0x28A1, 0x30C1, 0x30C2, 0xE5A2,
-    0xF622, 0xF643, 0xF644, 0xF664, 0xF727, 0xFF49, 0xFF69, 0xFF47,
-    0xF705, 0xFF05, 0xF705, 0xFF49, 0xFF69, 0xF6E8, 0xFE83, 0xF664,
-    0xF643, 0xFE42, 0x7282, 0x38E2, 0x28A1, 0x2881, 0x1861, 0x1841,
-    0x1020, 0x1020, 0x0820, 0x0800, 0x0820, 0x0000, 0x0020, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0800, 0x0820, 0x0820,
-    0x1020, 0x1841, 0x1841, 0x1861, 0x28A1, 0x30C1, 0x38E2, 0xB443,
-    0xFE43, 0xF643, 0xF664, 0xFE84, 0xF6A4, 0xFF47, 0xFF89, 0xFF47,
-    0xF745, 0xFF45, 0xF705, 0xFF49, 0xFF49, 0xFF27, 0xF684, 0xF664,
-    0xF643, 0xF643, 0x6203, 0x30C2, 0x30C1, 0x2081, 0x2061, 0x1041,
-    0x1020, 0x1020, 0x0800, 0x0800, 0x0020, 0x0000, 0x0020, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0800, 0x0820,
-    0x1020, 0x1841, 0x1841, 0x1861, 0x2881, 0x30C1, 0x30E2, 0x6203,
-    0xF622, 0xF643, 0xF664, 0xF684, 0xFEA4, 0xF6C4, 0xFF48, 0xF748,
-    0xFF25, 0xFF45, 0xF726, 0xFF49, 0xFF48, 0xF6A4, 0xFE84, 0xF664,
-    0xFE43, 0xE622, 0x4122, 0x38E2, 0x30C1, 0x28A1, 0x2061, 0x1041,
-    0x1841, 0x1020, 0x1020, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0800, 0x0820, 0x0820,
-    0x1020, 0x1841, 0x1841, 0x2061, 0x28A1, 0x30C1, 0x30E2, 0x4922,
-    0xC4C2, 0xF663, 0xF683, 0xF684, 0xFEA4, 0xF6E5, 0xFF05, 0xFF47,
-    0xF745, 0xFF25, 0xFF47, 0xFF48, 0xF6E5, 0xF6A4, 0xF684, 0xFE63,
-    0xF664, 0xAC23, 0x4122, 0x30E2, 0x30C1, 0x2061, 0x2061, 0x1041,
-    0x1841, 0x1020, 0x0820, 0x0800, 0x0020, 0x0000, 0x0020, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0800, 0x0800, 0x0820,
-    0x1020, 0x1841, 0x1041, 0x2061, 0x28A1, 0x30C1, 0x30C2, 0x4122,
-    0x6201, 0xEE43, 0xF663, 0xF684, 0xFEC4, 0xF6E5, 0xFF05, 0xF725,
-    0xFF45, 0xFF25, 0xFF45, 0xF705, 0xFEE5, 0xF6C4, 0xFE84, 0xF683,
-    0xF643, 0x59A2, 0x4142, 0x38E2, 0x30C1, 0x28A1, 0x2061, 0x1041,
-    0x1020, 0x1020, 0x0800, 0x0820, 0x0800, 0x0020, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0800, 0x0820, 0x0820,
-    0x0820, 0x1841, 0x1041, 0x2061, 0x28A1, 0x30C1, 0x38E2, 0x4122,
-    0x5162, 0x8323, 0xF683, 0xFEA4, 0xF6C4, 0xFEE5, 0xF705, 0xFF45,
-    0xFF25, 0xFF45, 0xF725, 0xFF05, 0xF6E5, 0xF6A4, 0xFEA4, 0xEE63,
-    0x8303, 0x4962, 0x3902, 0x30E2, 0x30A1, 0x28A1, 0x1861, 0x1841,
-    0x1020, 0x1020, 0x0800, 0x0800, 0x0020, 0x0000, 0x0020, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0800, 0x0820,
-    0x1020, 0x1841, 0x1841, 0x1861, 0x28A1, 0x30C1, 0x38E2, 0x4122,
-    0x4962, 0x51A2, 0xAC23, 0xFEA4, 0xF6C4, 0xFEE5, 0xF705, 0xFF25,
-    0xF745, 0xFF25, 0xFF05, 0xF705, 0xFEE5, 0xFEC4, 0xFEC4, 0x9BC3,
-    0x51C2, 0x5162, 0x3922, 0x38E2, 0x30A1, 0x2081, 0x2061, 0x1041,
-    0x1020, 0x1020, 0x0800, 0x0820, 0x0800, 0x0020, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x0800, 0x0820,
-    0x1020, 0x1020, 0x1041, 0x2061, 0x28A1, 0x30C1, 0x4981, 0x4122,
-    0x5162, 0x51C2, 0x7282, 0xFEC3, 0xFEE4, 0xFF04, 0xF705, 0xFF06,
-    0xF726, 0xFF25, 0xF705, 0xFF04, 0xF6C5, 0xFEC4, 0xCD43, 0x6223,
-    0x51A2, 0x4962, 0x3902, 0x38E2, 0x28A1, 0x2081, 0x2061, 0x1041,
-    0x1020, 0x1020, 0x0800, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0800,
-    0x1020, 0x1020, 0x1841, 0x2061, 0x2081, 0x30C2, 0xE622, 0x4122,
-    0x4962, 0x51A2, 0x72A3, 0xFEC3, 0xF6C4, 0xFF04, 0xF705, 0xFF05,
-    0xF74C, 0xFF06, 0xF705, 0xFF04, 0xFEE5, 0xFEE4, 0x9BC3, 0x6223,
-    0x59C2, 0x5162, 0x3902, 0x38E2, 0x28A1, 0x2081, 0x2061, 0x1841,
-    0x1020, 0x0820, 0x0820, 0x0800, 0x0820, 0x0000, 0x0020, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0820, 0x0800,
-    0x1020, 0x1020, 0x1841, 0x2061, 0x2081, 0x6221, 0xFE82, 0x6201,
-    0x4962, 0x6223, 0xE5C2, 0xFEC3, 0xFF04, 0xFF04, 0xF705, 0xF705,
-    0xFFB0, 0xFF4A, 0xF705, 0xFF04, 0xFEE4, 0xF6C4, 0x8303, 0x6223,
-    0x51A2, 0x4122, 0x3902, 0x30E2, 0x30C1, 0x2081, 0x2061, 0x1041,
-    0x1020, 0x0820, 0x0800, 0x0800, 0x0020, 0x0000, 0x0020, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0820, 0x0800,
-    0x0820, 0x1020, 0x1041, 0x1861, 0x2061, 0x8B21, 0xF682, 0x8B83,
-    0x72A3, 0xF663, 0xFEC3, 0xF6C4, 0xF704, 0xFF04, 0xFF05, 0xF705,
-    0xF74C, 0xFF94, 0xFF48, 0xFF05, 0xFF04, 0xFEE4, 0x8B83, 0x51A2,
-    0x59C2, 0x4942, 0x3902, 0x30C1, 0x2881, 0x2081, 0x2061, 0x1041,
-    0x1020, 0x0820, 0x0820, 0x0800, 0x0820, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0800, 0x0820,
-    0x0820, 0x1020, 0x1841, 0x2061, 0x2081, 0xC4C2, 0xF682, 0xCD63,
-    0xE602, 0xF6C3, 0xFEC3, 0xF6C4, 0xFEC4, 0xFF04, 0xF705, 0xF705,
-    0xFF4C, 0xFF94, 0xFF53, 0xF705, 0xFEE4, 0xF6C4, 0xB503, 0x51A2,
-    0x4983, 0x4122, 0x3902, 0x30C1, 0x28A1, 0x2081, 0x2061, 0x1041,
-    0x1020, 0x0820, 0x0800, 0x0800, 0x0020, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0800,
-    0x0820, 0x1020, 0x1841, 0x1861, 0x2061, 0xDE02, 0xF6A2, 0xFEA2,
-    0xF6C3, 0xFEC3, 0xF6C4, 0xF704, 0xFF04, 0xFF05, 0xF705, 0xF705,
-    0xFF4C, 0xFF94, 0xFF94, 0xF74C, 0xFF04, 0xFF04, 0xFEE4, 0x7AC3,
-    0x4983, 0x4142, 0x3902, 0x30C1, 0x28A1, 0x2081, 0x2061, 0x1841,
-    0x1020, 0x0820, 0x0800, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0820, 0x0800,
-    0x0820, 0x1020, 0x1041, 0x2061, 0x4142, 0xFEC2, 0xFEC2, 0xFEC3,
-    0xF6C3, 0xFEC4, 0xF704, 0xFF04, 0xF705, 0xFF05, 0xF705, 0xFF06,
-    0xFF4C, 0xFF94, 0xF7B4, 0xFF94, 0xF726, 0xFF04, 0xF6E4, 0xD603,
-    0x51A2, 0x4122, 0x3902, 0x30C1, 0x2881, 0x2081, 0x2061, 0x1041,
-    0x1020, 0x0820, 0x0800, 0x0800, 0x0020, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0820, 0x0800,
-    0x0820, 0x1020, 0x1041, 0x1841, 0x6A82, 0xF6A2, 0xFEA2, 0xF6C3,
-    0xF6C3, 0xFF04, 0xFEE4, 0xF705, 0xFF05, 0xF705, 0xF726, 0xFF06,
-    0xF74E, 0xFFB4, 0xFF94, 0xFF94, 0xF74E, 0xFEE4, 0xF704, 0xFF04,
-    0xD563, 0x59C2, 0x3902, 0x38E2, 0x28A1, 0x2081, 0x2061, 0x1020,
-    0x1020, 0x0820, 0x0800, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0820,
-    0x1020, 0x1020, 0x1841, 0x2081, 0xAC63, 0xFEC2, 0xFEC3, 0xF6C3,
-    0xFF04, 0xFF04, 0xF6E4, 0xF705, 0xFF26, 0xFF06, 0xF726, 0xFF06,
-    0xFFB0, 0xF794, 0xFFB4, 0xFF94, 0xFFB4, 0xF726, 0xF6E4, 0xFF04,
-    0xF6E4, 0xD603, 0x51A2, 0x30C2, 0x2881, 0x2081, 0x2061, 0x1041,
-    0x1020, 0x0820, 0x0800, 0x0800, 0x0020, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0800,
-    0x1020, 0x1841, 0x1861, 0x1861, 0xDE02, 0xFEC3, 0xF704, 0xFEE4,
-    0xF704, 0xFEE4, 0xF705, 0xFF26, 0xF706, 0xFF26, 0xF726, 0xFF47,
-    0xF794, 0xFFB4, 0xFF94, 0xFFB4, 0xFF94, 0xFF4A, 0xF705, 0xF704,
-    0xFF04, 0xFF04, 0xE622, 0x59C1, 0x30A1, 0x18A1, 0x2061, 0x1841,
-    0x1020, 0x0820, 0x0800, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0820, 0x0820,
-    0x1020, 0x1080, 0x2081, 0x4981, 0xFEE3, 0xFF23, 0xFF04, 0xF6E4,
-    0xFF04, 0xF705, 0xFF06, 0xF726, 0xFF46, 0xFF46, 0xF747, 0xFFAF,
-    0xFF95, 0xFF95, 0xFFB5, 0xF795, 0xFFB5, 0xFF8D, 0xF705, 0xF705,
-    0xFF04, 0xFEE4, 0xF703, 0xDE02, 0x28C1, 0x1881, 0x1861, 0x1841,
-    0x1020, 0x0820, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0800, 0x0820,
-    0x1020, 0x0860, 0x1881, 0x8303, 0xFF23, 0xF703, 0xF6E4, 0xFF04,
-    0xF705, 0xFF06, 0xF726, 0xFF46, 0xFF47, 0xF76A, 0xFFB0, 0xFF95,
-    0xFFB5, 0xF795, 0xFFB5, 0xFF95, 0xFF95, 0xFFB0, 0xF726, 0xFF25,
-    0xF704, 0xFF04, 0xFF23, 0xFF23, 0x8323, 0x2081, 0x2061, 0x1841,
-    0x1020, 0x0820, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0820, 0x0820,
-    0x1841, 0x18A0, 0x1881, 0xBD23, 0xFF23, 0xFF23, 0xFF03, 0xFF45,
-    0xF745, 0xFF46, 0xFF4A, 0xFFB0, 0xFF95, 0xF7B5, 0xFF95, 0xFFB5,
-    0xFF95, 0xF7B5, 0xFF95, 0xFFB5, 0xFF95, 0xF7B0, 0xFF46, 0xF726,
-    0xFF45, 0xFF44, 0xF703, 0xF703, 0xCD63, 0x18A1, 0x2081, 0x1041,
-    0x1020, 0x0820, 0x0800, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x0020, 0x0840,
-    0x1080, 0x1080, 0x18C1, 0xE683, 0xF723, 0xF703, 0xF725, 0xFF45,
-    0xFF47, 0xF7B0, 0xFF95, 0xFFD5, 0xFF96, 0xFFB6, 0xFF96, 0xFFB6,
-    0xFF96, 0xFFB6, 0xFFB5, 0xFFB6, 0xFF95, 0xFFB0, 0xFF46, 0xF746,
-    0xFF45, 0xFF44, 0xF744, 0xFF23, 0xF703, 0x28E1, 0x2081, 0x1841,
-    0x1020, 0x0820, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0840, 0x0840,
-    0x1080, 0x2081, 0x3982, 0xFF23, 0xFF23, 0xFF44, 0xFF45, 0xFF46,
-    0xFFB0, 0xFFB5, 0xFFD5, 0xFFB5, 0xFFD6, 0xFFB6, 0xFFD6, 0xFFB6,
-    0xFFD6, 0xFFB6, 0xFFD6, 0xFFB6, 0xFFD5, 0xFFB0, 0xF747, 0xFF46,
-    0xFF46, 0xF725, 0xFF44, 0xF703, 0xFF23, 0x39C2, 0x1881, 0x1080,
-    0x0840, 0x0820, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x0020, 0x0820, 0x1080,
-    0x1080, 0x20C1, 0x6303, 0xF703, 0xF744, 0xFF44, 0xF745, 0xFFB0,
-    0xFFB4, 0xFFD5, 0xFF96, 0xFFD6, 0xFFB6, 0xFFD7, 0xFFB7, 0xFFD7,
-    0xFFB7, 0xFFD7, 0xFFB7, 0xFFD6, 0xFFD6, 0xFFB0, 0xFF48, 0xF747,
-    0xFF46, 0xFF45, 0xF744, 0xFF44, 0xFF23, 0x62A3, 0x20A1, 0x18A0,
-    0x0840, 0x0840, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0820, 0x0860, 0x1080,
-    0x18A0, 0x20C1, 0x9C43, 0xFF44, 0xFF44, 0xFF45, 0xF74A, 0xFFD5,
-    0xFFD5, 0xFFB6, 0xFFD6, 0xFFB7, 0xFFD7, 0xFFD7, 0xFFD7, 0xFFD8,
-    0xFFD8, 0xFFD8, 0xFFB7, 0xFFD7, 0xFFB6, 0xFFB0, 0xFF89, 0xF748,
-    0xFF47, 0xFF46, 0xF745, 0xFF44, 0xF744, 0x7364, 0x18A1, 0x18A0,
-    0x1060, 0x0040, 0x0020, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0840, 0x0840, 0x1060,
-    0x18A0, 0x18A1, 0xBDA5, 0xFF44, 0xF744, 0xFF65, 0xFFB0, 0xFFD5,
-    0xFFB5, 0xFFD6, 0xFFD7, 0xF7D7, 0xFFD8, 0xFFD8, 0xFFD8, 0xFFF8,
-    0xFFD8, 0xFFD8, 0xFFD8, 0xFFD7, 0xFFD7, 0xFFAF, 0xFF89, 0xFF88,
-    0xF788, 0xFF86, 0xFF65, 0xFF44, 0xFF44, 0x9C43, 0x20C1, 0x18A0,
-    0x1080, 0x0840, 0x0820, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0840, 0x0840, 0x1080,
-    0x18A0, 0x20C1, 0xEEA3, 0xFF44, 0xFF45, 0xF766, 0xFFD4, 0xFFD5,
-    0xFFB6, 0xFFD6, 0xF7D7, 0xFFD8, 0xFFD8, 0xFFD8, 0xFFD9, 0xFFD9,
-    0xFFF9, 0xFFD9, 0xFFD8, 0xFFD8, 0xFFD7, 0xFF8D, 0xFFAA, 0xF789,
-    0xFF88, 0xFF66, 0xF765, 0xFF65, 0xFF44, 0x9CC4, 0x18A1, 0x18A0,
-    0x1060, 0x0840, 0x0840, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0020, 0x0820, 0x0040, 0x1060, 0x1060,
-    0x18C1, 0x2922, 0xFF44, 0xF744, 0xFF65, 0xF78B, 0xFFB5, 0xFFD6,
-    0xFFB6, 0xFFD7, 0xFFD8, 0xFFD8, 0xFFF9, 0xFFDA, 0xFFFA, 0xFFDA,
-    0xFFFA, 0xFFDA, 0xFFB6, 0xFFD4, 0xFFB0, 0xFF8D, 0xF78C, 0xFFAA,
-    0xFF89, 0xFF88, 0xFF66, 0xFF85, 0xFF44, 0xC5C5, 0x20C1, 0x2081,
-    0x1080, 0x0840, 0x0840, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0020, 0x0820, 0x0020, 0x0840, 0x1080, 0x18A0,
-    0x20C1, 0x41E2, 0xFF64, 0xFF65, 0xFF86, 0xFF8D, 0xFFD5, 0xFFB6,
-    0xFFD7, 0xFFD7, 0xFFD8, 0xFFD9, 0xFFFA, 0xFFDB, 0xFFFB, 0xFFDB,
-    0xFFFB, 0xFFDB, 0xFFD6, 0xFFB2, 0xFFB0, 0xFFAF, 0xF78C, 0xFFAB,
-    0xFF89, 0xF788, 0xFF66, 0xFF86, 0xFF65, 0xD603, 0x20E1, 0x1080,
-    0x0880, 0x0840, 0x0840, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0020, 0x0820, 0x0840, 0x1080, 0x1080,
-    0x20C1, 0x4A62, 0xF765, 0xFF65, 0xFF66, 0xF7B0, 0xFFB6, 0xFFD6,
-    0xFFD7, 0xFFD8, 0xFFD9, 0xFFFA, 0xFFDB, 0xFFDC, 0xFFFC, 0xFFFD,
-    0xFFFD, 0xFFFC, 0xFFD7, 0xFFB2, 0xFFB0, 0xFFAF, 0xF78D, 0xFFAB,
-    0xFF8A, 0xFF89, 0xF787, 0xFF86, 0xFF65, 0xEEC5, 0x2901, 0x18A0,
-    0x1080, 0x0840, 0x0840, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0020, 0x0820, 0x0840, 0x0840, 0x1080, 0x18A0,
-    0x20C1, 0x62A3, 0xFF85, 0xFF66, 0xFF87, 0xFFB0, 0xFFD6, 0xFFD7,
-    0xFFD7, 0xFFD8, 0xFFD9, 0xFFFA, 0xFFDB, 0xFFFC, 0xFFFD, 0xFFFE,
-    0xFFFE, 0xFFFD, 0xFFD9, 0xF7D4, 0xFFB2, 0xFFB0, 0xFFCD, 0xF78C,
-    0xFF8A, 0xFF89, 0xF788, 0xFF86, 0xFF65, 0xF745, 0x20E1, 0x1080,
-    0x0880, 0x0840, 0x0840, 0x0020, 0x0820, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0020, 0x0840, 0x0840, 0x1060, 0x18A0,
-    0x18C1, 0x6303, 0xFF65, 0xFF66, 0xF787, 0xFFB0, 0xFFB6, 0xFFD7,
-    0xFFD7, 0xFFF8, 0xFFD9, 0xFFDA, 0xFFFC, 0xFFFD, 0xFFFE, 0xFFFE,
-    0xFFFE, 0xFFFD, 0xFFDB, 0xFFD5, 0xF7D2, 0xFFB0, 0xFFAF, 0xFF8C,
-    0xFF8B, 0xFF89, 0xFF88, 0xFF86, 0xFF66, 0xFF85, 0x3962, 0x20C1,
-    0x1080, 0x0840, 0x0840, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0020, 0x0020, 0x0840, 0x0840, 0x1080, 0x18A0,
-    0x20C1, 0x6B23, 0xFF86, 0xFF66, 0xFF88, 0xFFB0, 0xFFD6, 0xFFD7,
-    0xFFD7, 0xFFD8, 0xFFD9, 0xFFFB, 0xFFFC, 0xFFFD, 0xFFFE, 0xFFFE,
-    0xFFFE, 0xFFFD, 0xFFDC, 0xFFD5, 0xFFB2, 0xFFB0, 0xFFAF, 0xF78C,
-    0xFF8B, 0xFF89, 0xF788, 0xFF87, 0xFF86, 0xFF65, 0x39C2, 0x18C1,
-    0x1060, 0x0840, 0x0840, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0020, 0x0840, 0x0840, 0x1060, 0x18A0,
-    0x18A1, 0x5AA3, 0xFF66, 0xF787, 0xFF88, 0xFFAF, 0xFFD6, 0xFFD7,
-    0xF7D7, 0xFFD8, 0xFFF9, 0xFFDA, 0xFFDB, 0xFFFD, 0xFFFE, 0xFFFE,
-    0xFFFE, 0xFFFD, 0xFFFC, 0xFFD7, 0xFFB2, 0xFFB0, 0xFFAF, 0xFF8C,
-    0xFFAB, 0xFF8A, 0xFF88, 0xFF87, 0xFF86, 0xFF86, 0x5262, 0x18A0,
-    0x1080, 0x0840, 0x0840, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0020, 0x0020, 0x0840, 0x0840, 0x1080, 0x18A0,
-    0x20C1, 0x5262, 0xFF86, 0xFF87, 0xFF88, 0xFFAF, 0xFFD6, 0xFFD7,
-    0xFFD7, 0xFFD8, 0xFFD9, 0xFFFA, 0xFFDB, 0xFFFC, 0xFFFD, 0xFFFD,
-    0xFFFD, 0xFFFC, 0xFFDB, 0xFFD9, 0xFFD2, 0xFFB0, 0xFFAF, 0xFF8C,
-    0xFF8B, 0xF7AA, 0xFF88, 0xFF87, 0xF766, 0xFF86, 0x4A42, 0x10A0,
-    0x1060, 0x0840, 0x0840, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0020, 0x0840, 0x0840, 0x1080, 0x18A0,
-    0x18C1, 0x39C2, 0xFF66, 0xFF87, 0xF788, 0xFFAC, 0xFFD6, 0xFFD7,
-    0xFFD7, 0xFFD8, 0xFFF9, 0xFFDA, 0xFFFA, 0xFFDB, 0xFFDC, 0xFFFC,
-    0xFFFC, 0xFFDB, 0xFFFB, 0xFFDA, 0xF7D4, 0xFFAF, 0xFFAD, 0xFFCC,
-    0xFF8B, 0xFFAA, 0xFF88, 0xFF87, 0xFF87, 0xFF86, 0x5262, 0x18A0,
-    0x1080, 0x0840, 0x0840, 0x0820, 0x0020, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0020, 0x0820, 0x0840, 0x1080, 0x1060,
-    0x20C1, 0x2101, 0xF767, 0xFF87, 0xFFA8, 0xFFAA, 0xFFD6, 0xFFB7,
-    0xFFD7, 0xFFD8, 0xFFD8, 0xFFD9, 0xFFFA, 0xFFDA, 0xFFFB, 0xFFDB,
-    0xFFFB, 0xFFDA, 0xFFFA, 0xFFD9, 0xFFD7, 0xF7AF, 0xFFCD, 0xFFAC,
-    0xFFAB, 0xF78A, 0xFFA8, 0xFF88, 0xF787, 0xFF86, 0x39C2, 0x10A0,
-    0x1060, 0x0840, 0x0840, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0840, 0x0840, 0x1060,
-    0x10A0, 0x18A1, 0xC606, 0xFF87, 0xFFA8, 0xF7A8, 0xFFD4, 0xFFF6,
-    0xFFD7, 0xFFD7, 0xFFD8, 0xFFF9, 0xFFD9, 0xFFF9, 0xFFDA, 0xFFFA,
-    0xFFDA, 0xFFFA, 0xFFD9, 0xFFF9, 0xFFD8, 0xF7AF, 0xFFCD, 0xFFAC,
-    0xFF8A, 0xFFC9, 0xFFA8, 0xFFA7, 0xFF87, 0xFFA7, 0x3122, 0x10A0,
-    0x1080, 0x0820, 0x0840, 0x0820, 0x0020, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x0840, 0x0840, 0x1080,
-    0x18A0, 0x20C1, 0x9465, 0xFFA7, 0xFFA8, 0xFFA8, 0xFFB0, 0xFFD6,
-    0xFFF7, 0xFFD7, 0xFFD8, 0xFFD8, 0xFFD8, 0xFFF9, 0xFFD9, 0xFFF9,
-    0xFFD9, 0xFFF9, 0xFFD9, 0xFFF8, 0xFFD8, 0xF7B2, 0xFFCC, 0xFF8B,
-    0xFFAA, 0xF7C9, 0xFFA8, 0xFFA7, 0xF787, 0xE6E7, 0x1080, 0x1060,
-    0x0840, 0x0840, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0840, 0x0840, 0x1060,
-    0x18A0, 0x18C1, 0x4A42, 0xFF87, 0xF7A8, 0xFFA8, 0xFFAF, 0xFFF6,
-    0xFFD7, 0xF7F7, 0xFFD7, 0xFFD8, 0xFFD8, 0xFFF8, 0xFFD8, 0xFFF8,
-    0xFFD9, 0xFFF8, 0xFFD8, 0xFFF8, 0xFFD7, 0xFFD2, 0xFFAC, 0xFFCB,
-    0xFFAA, 0xFF89, 0xFFA8, 0xFFA7, 0xFF87, 0xB565, 0x18A0, 0x1080,
-    0x0840, 0x0840, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0820, 0x0840, 0x0840,
-    0x1080, 0x18A0, 0x20C1, 0xE6E6, 0xFFA8, 0xFFA8, 0xFFAA, 0xFFD6,
-    0xFFF6, 0xFFD6, 0xFFF7, 0xFFD7, 0xFFF8, 0xFFD8, 0xFFF8, 0xFFD8,
-    0xFFF8, 0xFFD8, 0xFFF8, 0xFFD7, 0xFFF7, 0xFFD4, 0xF7CB, 0xFF8A,
-    0xFFC9, 0xFFA8, 0xF7A8, 0xFFA8, 0xFF87, 0x6303, 0x1080, 0x1060,
-    0x0840, 0x0840, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0840, 0x0840,
-    0x1060, 0x18A0, 0x18A1, 0x8C45, 0xF7A8, 0xFFA8, 0xFFC9, 0xFFD2,
-    0xFFD6, 0xFFF6, 0xF7D7, 0xFFF7, 0xFFD7, 0xFFD7, 0xFFD5, 0xFFB0,
-    0xFFF7, 0xFFD7, 0xF7F7, 0xFFD7, 0xFFD7, 0xFFD5, 0xFF8A, 0xF7CA,
-    0xFFC9, 0xFFA8, 0xFFA8, 0xFFC7, 0xF747, 0x20C1, 0x1080, 0x0840,
-    0x0840, 0x0820, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x0840, 0x0840,
-    0x0840, 0x1080, 0x18A0, 0x3162, 0xF768, 0xFFA8, 0xFFC9, 0xFFAD,
-    0xFFF6, 0xFFD6, 0xFFF6, 0xFFD6, 0xFFF7, 0xFFD6, 0xFFCD, 0xFFAD,
-    0xFFB0, 0xF7F7, 0xFFD7, 0xFFF7, 0xFFD6, 0xFFD4, 0xF7CA, 0xFFC9,
-    0xFFA9, 0xFFA8, 0xF7A8, 0xFFA8, 0x9CA4, 0x1080, 0x1080, 0x0840,
-    0x0840, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0840,
-    0x0840, 0x1060, 0x18A0, 0x1080, 0x8C45, 0xF7A8, 0xFFC9, 0xFFA9,
-    0xFFD4, 0xFFF6, 0xFFD6, 0xFFF6, 0xFFD6, 0xFFAF, 0xFFAC, 0xC626,
-    0xDECB, 0xFFF6, 0xF7D7, 0xFFF6, 0xFFD6, 0xFFB2, 0xFFCA, 0xFFC9,
-    0xFFC9, 0xFFA8, 0xFFA8, 0xF768, 0x3122, 0x1080, 0x0840, 0x0840,
-    0x0020, 0x0820, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0820,
-    0x0840, 0x0840, 0x1080, 0x18A0, 0x2901, 0xD668, 0xFFC9, 0xFFC9,
-    0xFFAD, 0xFFF6, 0xFFD6, 0xFFF6, 0xFFD6, 0xFFCC, 0xEF4A, 0x5224,
-    0x9465, 0xFFB0, 0xFFD6, 0xFFF6, 0xFFD6, 0xFFAF, 0xFFC9, 0xF7C9,
-    0xFFA9, 0xFFC9, 0xFFA8, 0x7BC4, 0x0860, 0x0840, 0x0840, 0x0840,
-    0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,
-    0x0840, 0x0860, 0x0840, 0x1060, 0x10A0, 0x39C2, 0xE708, 0xFFC9,
-    0xFFC9, 0xFFB2, 0xFFF6, 0xFFD6, 0xFFD4, 0xFFCB, 0xAD69, 0x39E2,
-    0x6303, 0xFFCB, 0xFFB2, 0xFFF6, 0xFFB2, 0xFFCA, 0xFFA9, 0xFFC9,
-    0xFFC9, 0xFFC9, 0xB565, 0x18A0, 0x1080, 0x0840, 0x0840, 0x0820,
-    0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820,
-    0x0020, 0x0840, 0x0840, 0x1080, 0x1080, 0x18A0, 0x5262, 0xFFA8,
-    0xFFC9, 0xFFC9, 0xFFB0, 0xFFB4, 0xFFAC, 0xFFCA, 0x7BC4, 0x3162,
-    0x3982, 0xFFAA, 0xFFEA, 0xFFCB, 0xFFCA, 0xFFC9, 0xFFA9, 0xFFC9,
-    0xF7A9, 0xB545, 0x1080, 0x0880, 0x0840, 0x0840, 0x0020, 0x0820,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0820, 0x0020, 0x0840, 0x0840, 0x1060, 0x1080, 0x1080, 0x5A83,
-    0xEF68, 0xFFCA, 0xFFCA, 0xFFCA, 0xFFCA, 0xFFEA, 0x5262, 0x2922,
-    0x2902, 0xDEC8, 0xF7CA, 0xFFCA, 0xFFCA, 0xFFCA, 0xFFC9, 0xFFA9,
-    0x9465, 0x18A0, 0x1080, 0x0840, 0x0820, 0x0840, 0x0020, 0x0020,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,
-    0x0000, 0x0020, 0x0820, 0x0840, 0x0840, 0x1080, 0x1080, 0x18A0,
-    0x5262, 0xFFA9, 0xFFCA, 0xFFCA, 0xFFCA, 0xF7A9, 0x20E1, 0x2101,
-    0x2101, 0xB565, 0xFFCA, 0xFFCA, 0xFFCA, 0xFFC9, 0xDEC8, 0x4A42,
-    0x0860, 0x1080, 0x0840, 0x0840, 0x0020, 0x0820, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0820, 0x0020, 0x0840, 0x0860, 0x0840, 0x1060,
-    0x1060, 0x39C2, 0xD668, 0xFFCA, 0xFFEA, 0xB545, 0x18C1, 0x20C1,
-    0x20C1, 0x5AA3, 0xFFCA, 0xF7A9, 0xC5A5, 0x6B23, 0x18A0, 0x1080,
-    0x0860, 0x0840, 0x0820, 0x0840, 0x0820, 0x0020, 0x0020, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0020, 0x0020, 0x0820, 0x0840, 0x0820, 0x0840,
-    0x0860, 0x1080, 0x18A0, 0x83C4, 0xA4C4, 0x2922, 0x18A0, 0x10A0,
-    0x18A0, 0x18A0, 0x41E2, 0x2101, 0x1060, 0x1080, 0x1060, 0x0840,
-    0x0840, 0x0840, 0x0820, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0820, 0x0020, 0x0840,
-    0x0840, 0x0840, 0x0840, 0x1080, 0x1060, 0x1080, 0x1060, 0x1080,
-    0x1060, 0x1080, 0x1060, 0x1080, 0x0860, 0x0840, 0x0820, 0x0840,
-    0x0840, 0x0020, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0820, 0x0020,
-    0x0820, 0x0840, 0x0820, 0x0840, 0x0840, 0x0840, 0x0860, 0x0840,
-    0x0860, 0x1040, 0x0860, 0x0840, 0x0840, 0x0840, 0x0020, 0x0820,
-    0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820,
-    0x0020, 0x0820, 0x0020, 0x0020, 0x0840, 0x0820, 0x0040, 0x0820,
-    0x0840, 0x0820, 0x0840, 0x0020, 0x0820, 0x0020, 0x0820, 0x0020,
-    0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,
-    0x0000, 0x0020, 0x0000, 0x0020, 0x0820, 0x0020, 0x0820, 0x0020,
-    0x0820, 0x0020, 0x0820, 0x0020, 0x0820, 0x0020, 0x0000, 0x0020,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0000, 0x0020, 0x0000,
-    0x0020, 0x0000, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 },
-  { 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0800, 0x0020,
-    0x0020, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x69A1, 0xD2A2, 0xD282,
-    0xD2A2, 0xDAA2, 0x69C1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0xD2A2, 0xD2A2, 0xD282,
-    0xD2A2, 0xD282, 0xD2A2, 0x1021, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x91E2, 0xD2A2, 0xD282,
-    0xD2A2, 0xD282, 0xDAA2, 0x28A0, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1861, 0xB282, 0xD2A2,
-    0xD282, 0xD2A2, 0xD282, 0x2880, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2880,
-    0x30C1, 0xD2A2, 0xB282, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,
-    0x2081, 0xB262, 0x1861, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x4102, 0x1020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000,
-    0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020,
-    0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0000, 0x0820,
-    0x0000, 0x0020, 0x0000, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0800, 0x0020, 0x0000,
-    0x0020, 0x0800, 0x0020, 0x0000, 0x0020, 0x0000, 0x0020, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0020, 0x0800, 0x0020,
-    0x0800, 0x0020, 0x0800, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0020, 0x0000, 0x0020, 0x0800, 0x0820, 0x0020, 0x0800, 0x0820,
-    0x0000, 0x0820, 0x0000, 0x0820, 0x0000, 0x0020, 0x0000, 0x0020,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,
-    0x0000, 0x0020, 0x0800, 0x0020, 0x0800, 0x0820, 0x0000, 0x0820,
-    0x0800, 0x0820, 0x0800, 0x0820, 0x0800, 0x0020, 0x0000, 0x0020,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0020, 0x0800, 0x0020, 0x0800, 0x0820, 0x0800, 0x0020, 0x0800,
-    0x0820, 0x0820, 0x0800, 0x0820, 0x91E2, 0x30C1, 0x0020, 0x0000,
-    0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,
-    0x0000, 0x0020, 0x0800, 0x0800, 0x0820, 0x1020, 0x0820, 0x0820,
-    0x0820, 0x0820, 0x0820, 0x1041, 0xE323, 0xB282, 0x0820, 0x0000,
-    0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0820,
-    0x0800, 0x0820, 0x0000, 0x0820, 0x0820, 0x1020, 0x1020, 0x1020,
-    0x1020, 0x1020, 0x1020, 0x2881, 0xE361, 0xE323, 0x0000, 0x0020,
-    0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000,
-    0x0820, 0x0800, 0x0820, 0x0820, 0x1020, 0x1020, 0x1020, 0x1020,
-    0x1020, 0x1020, 0x1020, 0x0820, 0xC322, 0xE361, 0x0820, 0x0800,
-    0x0820, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0820,
-    0x0800, 0x0820, 0x0820, 0x1020, 0x1020, 0x1841, 0x1841, 0x1841,
-    0x1041, 0x1841, 0x1841, 0x1020, 0x69C1, 0x9282, 0x0820, 0x0000,
-    0x0820, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0800,
-    0x1020, 0x0820, 0x1020, 0x1020, 0x1041, 0x1841, 0x1841, 0x1841,
-    0x1041, 0x1841, 0x1841, 0x1841, 0x1020, 0x1020, 0x0820, 0x0020,
-    0x0800, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0800, 0x0820,
-    0x0820, 0x1020, 0x1020, 0x1841, 0x1841, 0x1841, 0x1861, 0x2061,
-    0x2061, 0x1861, 0x2061, 0x1041, 0x1841, 0x1020, 0x1020, 0x0820,
-    0x0800, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0820, 0x0800, 0x0800,
-    0x0820, 0x1020, 0x1041, 0x1841, 0x2061, 0x1861, 0x2061, 0x2081,
-    0x2081, 0x2061, 0x1861, 0x2061, 0x1841, 0x1841, 0x1020, 0x0820,
-    0x0000, 0x0820, 0x0800, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0820, 0x0820,
-    0x1020, 0x1020, 0x1841, 0x2061, 0x1861, 0x2881, 0x2061, 0x2081,
-    0x2881, 0x2081, 0x2861, 0x1861, 0x2061, 0x1841, 0x1041, 0x1020,
-    0x0820, 0x0800, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x0800, 0x0820, 0x0820,
-    0x1020, 0x1041, 0x2061, 0x2061, 0x2061, 0x2081, 0x28A1, 0x5141,
-    0x69A1, 0x28A1, 0x2061, 0x2081, 0x2061, 0x2061, 0x1041, 0x1020,
-    0x0820, 0x0820, 0x0800, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0020, 0x0000, 0x0820, 0x0800, 0x0820, 0x1020,
-    0x1041, 0x1841, 0x2061, 0x2081, 0x28A1, 0x2881, 0x30A1, 0xB322,
-    0x4962, 0x30C1, 0x28A1, 0x28A1, 0x2081, 0x2061, 0x1041, 0x1841,
-    0x1020, 0x0820, 0x0800, 0x0800, 0x0020, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0020, 0x0000, 0x0820, 0x0800, 0x0820, 0x1020,
-    0x1841, 0x1861, 0x2061, 0x28A1, 0x30A1, 0x30C1, 0x51C2, 0xCBA2,
-    0x38E2, 0x30C1, 0x28A1, 0x30A1, 0x28A1, 0x2081, 0x2061, 0x1841,
-    0x1020, 0x0820, 0x0800, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0020, 0x0800, 0x0820, 0x1020, 0x1020,
-    0x1841, 0x2061, 0x2081, 0x28A1, 0x30C1, 0x38E2, 0xB322, 0x9AE1,
-    0x3902, 0x38E2, 0x30E2, 0x30A1, 0x28A1, 0x2081, 0x2061, 0x1041,
-    0x1020, 0x0820, 0x0820, 0x0800, 0x0000, 0x0020, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0020, 0x0000, 0x0800, 0x0820, 0x1020, 0x1841,
-    0x2061, 0x2081, 0x28A1, 0x28A1, 0x30E2, 0x69A1, 0xEC23, 0x6A21,
-    0x3922, 0x3902, 0x38E2, 0x30E2, 0x30A1, 0x28A1, 0x2081, 0x2061,
-    0x1841, 0x1020, 0x0820, 0x0800, 0x0020, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0820, 0x0800, 0x1020, 0x1020, 0x1041,
-    0x2061, 0x2081, 0x30A1, 0x30C1, 0x3922, 0xCBA2, 0xEC23, 0x4122,
-    0x4142, 0x4122, 0x3902, 0x38E2, 0x30C1, 0x28C1, 0x2081, 0x2061,
-    0x1841, 0x1020, 0x0820, 0x0800, 0x0000, 0x0020, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0020, 0x0000, 0x0020, 0x0800, 0x1020, 0x1841, 0x2061,
-    0x2061, 0x28A1, 0x30C1, 0x30C2, 0x7242, 0xEC63, 0xB381, 0x4962,
-    0x5162, 0x5162, 0x4142, 0x3902, 0x38E2, 0x30C1, 0x28A1, 0x2061,
-    0x1041, 0x1841, 0x0820, 0x0820, 0x0800, 0x0020, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0020, 0x0800, 0x0820, 0x1020, 0x1841, 0x2061,
-    0x2081, 0x28A1, 0x38E2, 0x3922, 0xE441, 0xEC63, 0x9323, 0x51A2,
-    0x59C2, 0x4983, 0x4962, 0x4142, 0x3902, 0x38E2, 0x30A1, 0x2081,
-    0x1861, 0x1841, 0x1020, 0x0820, 0x0800, 0x0020, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0020, 0x0800, 0x0820, 0x1020, 0x1041, 0x2061,
-    0x2881, 0x30C1, 0x30E2, 0x8A82, 0xEC63, 0xF4C2, 0x9B23, 0x51A2,
-    0x59C2, 0x51C2, 0x9B23, 0x5162, 0x3902, 0x38E2, 0x30C1, 0x28A1,
-    0x1861, 0x1841, 0x1020, 0x0820, 0x0800, 0x0020, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0020, 0x0000, 0x0820, 0x0800, 0x0820, 0x1020, 0x2061, 0x2081,
-    0x28A1, 0x38E2, 0x5162, 0xEC63, 0xF4C2, 0xECC2, 0x9303, 0x6223,
-    0x6223, 0x6223, 0xECA2, 0xAB61, 0x4122, 0x3902, 0x30C1, 0x28A1,
-    0x1861, 0x1841, 0x1020, 0x0820, 0x0800, 0x0020, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0020, 0x0800, 0x0800, 0x0820, 0x1041, 0x2061, 0x2081,
-    0x28A1, 0x30E2, 0xB302, 0xECC2, 0xF4C2, 0xED03, 0xECA2, 0x72C3,
-    0x6223, 0x9323, 0xF503, 0xF4C2, 0x9B23, 0x3902, 0x38E2, 0x2881,
-    0x2081, 0x1841, 0x1020, 0x0820, 0x0820, 0x0800, 0x0020, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0020, 0x0000, 0x0820, 0x0800, 0x1020, 0x1041, 0x2061, 0x28A1,
-    0x30C1, 0x5162, 0xECA2, 0xECC2, 0xF503, 0xED03, 0xF503, 0xED44,
-    0xDD02, 0xF503, 0xED03, 0xF4C2, 0xECC2, 0x7A81, 0x30C2, 0x28A1,
-    0x2081, 0x2061, 0x1841, 0x1020, 0x0800, 0x0020, 0x0000, 0x0020,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0020, 0x0000, 0x0800, 0x1020, 0x1841, 0x1861, 0x28A1,
-    0x28A1, 0xAB61, 0xECC2, 0xF4C2, 0xED03, 0xF503, 0xED44, 0xED44,
-    0xF543, 0xF543, 0xF503, 0xED03, 0xF4C2, 0xECA2, 0x4962, 0x30C1,
-    0x28A1, 0x2061, 0x1841, 0x1020, 0x0820, 0x0000, 0x0020, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0020, 0x0000, 0x0820, 0x0820, 0x1020, 0x1841, 0x2061, 0x28A1,
-    0x4962, 0xECA2, 0xF4C2, 0xED03, 0xF503, 0xF543, 0xF583, 0xF583,
-    0xED83, 0xF583, 0xF543, 0xED03, 0xED03, 0xF4C2, 0xC382, 0x30C1,
-    0x2881, 0x1861, 0x1041, 0x1020, 0x0820, 0x0800, 0x0020, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0020, 0x0000, 0x0800, 0x0820, 0x1020, 0x1841, 0x1861, 0x2081,
-    0x9AE1, 0xECA2, 0xF4C2, 0xED03, 0xED43, 0xF583, 0xF5A3, 0xF605,
-    0xF605, 0xF583, 0xF583, 0xF543, 0xED03, 0xF4C2, 0xF4C2, 0x6A01,
-    0x28A1, 0x1861, 0x1841, 0x1020, 0x1020, 0x0820, 0x0000, 0x0020,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0020, 0x0800, 0x0820, 0x1020, 0x1841, 0x2081, 0x30C1,
-    0xE441, 0xF4C2, 0xED03, 0xF503, 0xF543, 0xF583, 0xF5C4, 0xF6A9,
-    0xF729, 0xF646, 0xF583, 0xF543, 0xED03, 0xECC2, 0xF4A2, 0xAB61,
-    0x2081, 0x2081, 0x1041, 0x1020, 0x0820, 0x0800, 0x0000, 0x0020,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0020, 0x0800, 0x0820, 0x1020, 0x1861, 0x2061, 0x7201,
-    0xECA2, 0xF4C2, 0xED03, 0xF543, 0xF583, 0xF5C4, 0xF6C9, 0xF729,
-    0xFF09, 0xFF29, 0xF646, 0xF563, 0xF543, 0xED03, 0xF4C2, 0xECA1,
-    0x38E2, 0x2081, 0x1841, 0x1020, 0x0820, 0x0800, 0x0820, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0020, 0x0000, 0x0820, 0x1020, 0x1020, 0x2061, 0x2081, 0xB381,
-    0xF4C2, 0xECC1, 0xF503, 0xF543, 0xF5A3, 0xF708, 0xFF09, 0xFF29,
-    0xF709, 0xFF29, 0xFF09, 0xF605, 0xF543, 0xED02, 0xECC2, 0xF4C1,
-    0x61A1, 0x2061, 0x1041, 0x1020, 0x0820, 0x0800, 0x0000, 0x0020,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0020, 0x0800, 0x0820, 0x1041, 0x1861, 0x30A1, 0xE4A1,
-    0xECC1, 0xF502, 0xF502, 0xF543, 0xF5E5, 0xF729, 0xFF09, 0xFF69,
-    0xFF49, 0xF729, 0xFF29, 0xF646, 0xF543, 0xF502, 0xF4C1, 0xF4E1,
-    0x9282, 0x2081, 0x1841, 0x1020, 0x0820, 0x0800, 0x0020, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0020, 0x0000, 0x0820, 0x1020, 0x1841, 0x1861, 0x69A1, 0xF4E1,
-    0xF4C1, 0xF502, 0xF502, 0xF563, 0xF6A7, 0xFF29, 0xFF49, 0xFF6A,
-    0xF749, 0xFF29, 0xFF09, 0xF6C9, 0xF543, 0xF502, 0xED02, 0xF4C1,
-    0x9AE1, 0x1861, 0x1041, 0x1020, 0x0820, 0x0800, 0x0020, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0020, 0x0000, 0x1020, 0x1841, 0x1841, 0x8A82, 0xECC1,
-    0xF4C1, 0xED02, 0xF542, 0xF5C4, 0xFEE8, 0xF729, 0xFF49, 0xFF69,
-    0xFF49, 0xF769, 0xFF09, 0xFF08, 0xF583, 0xF521, 0xF502, 0xF4C1,
-    0x9AE1, 0x2081, 0x1841, 0x1020, 0x0820, 0x0820, 0x0800, 0x0020,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0020, 0x0000, 0x0820, 0x1020, 0x1841, 0x2061, 0xB381, 0xF4C1,
-    0xECC1, 0xF502, 0xF563, 0xF6A7, 0xFF08, 0xF709, 0xFF69, 0xFF48,
-    0xF6E5, 0xF769, 0xFF09, 0xFF08, 0xF583, 0xED42, 0xF502, 0xECC1,
-    0x9AE1, 0x2061, 0x1021, 0x1020, 0x0820, 0x0000, 0x0020, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0020, 0x0800, 0x0820, 0x1041, 0x1841, 0xDC21, 0xECC1,
-    0xF502, 0xED02, 0xF646, 0xFF08, 0xF6E8, 0xFF29, 0xFF49, 0xFF27,
-    0xF684, 0xF6E8, 0xFF29, 0xFF08, 0xF5A3, 0xF542, 0xF502, 0xF4C1,
-    0x9AE1, 0x2081, 0x1841, 0x1020, 0x0820, 0x0820, 0x0800, 0x0020,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0020, 0x0000, 0x0820, 0x0820, 0x1841, 0x2881, 0xF4C1, 0xF4C1,
-    0xF502, 0xF563, 0xF6A9, 0xFEE8, 0xF708, 0xFF09, 0xFF29, 0xF685,
-    0xF684, 0xF664, 0xFEE8, 0xF6E8, 0xF5A3, 0xF543, 0xF502, 0xF502,
-    0x8A82, 0x2061, 0x1041, 0x1020, 0x0820, 0x0000, 0x0020, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0020, 0x0000, 0x0800, 0x0820, 0x1041, 0x30C2, 0xF4C1, 0xECC1,
-    0xF502, 0xF542, 0xF6A7, 0xF708, 0xFEE8, 0xFF09, 0xF685, 0xF684,
-    0xFE64, 0xF644, 0xF666, 0xF708, 0xF583, 0xF543, 0xF521, 0xF522,
-    0x8281, 0x2881, 0x1841, 0x1020, 0x0820, 0x0820, 0x0000, 0x0020,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0020, 0x0800, 0x0820, 0x1841, 0x4921, 0xF4E1, 0xF502,
-    0xF502, 0xF521, 0xF5C4, 0xF708, 0xFF09, 0xF6A7, 0xF624, 0xF664,
-    0xF644, 0xF624, 0xFDE4, 0xFEE8, 0xF583, 0xED43, 0xF521, 0xF502,
-    0x7A81, 0x2061, 0x1041, 0x1020, 0x0820, 0x0800, 0x0020, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0020, 0x0000, 0x0800, 0x0820, 0x0820, 0x4161, 0xECC1, 0xF502,
-    0xF502, 0xF542, 0xF583, 0xF6A9, 0xFEE8, 0xF646, 0xF624, 0xF625,
-    0xF645, 0xF624, 0xF5E3, 0xF6A7, 0xF583, 0xF543, 0xF521, 0xF522,
-    0x8281, 0x2081, 0x1841, 0x1020, 0x0820, 0x0820, 0x0000, 0x0020,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0020, 0x0800, 0x0820, 0x1020, 0x4981, 0xFD22, 0xF502,
-    0xF521, 0xF542, 0xF543, 0xF646, 0xF708, 0xF666, 0xF5E4, 0xF624,
-    0xF624, 0xF5E4, 0xF624, 0xFEA7, 0xF563, 0xF543, 0xED42, 0xF521,
-    0x7242, 0x2061, 0x1041, 0x1020, 0x0820, 0x0800, 0x0000, 0x0020,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0020, 0x0000, 0x0800, 0x0820, 0x0820, 0x3101, 0xF501, 0xED02,
-    0xF521, 0xF542, 0xF543, 0xF5C4, 0xFEE8, 0xF666, 0xF604, 0xF5E4,
-    0xFE04, 0xF5E4, 0xF6A7, 0xF666, 0xF583, 0xF563, 0xF542, 0xF521,
-    0x69C1, 0x2061, 0x1841, 0x1020, 0x0820, 0x0800, 0x0020, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0020, 0x0800, 0x0820, 0x1020, 0x2081, 0xFD21, 0xF521,
-    0xF542, 0xF542, 0xF583, 0xF5A3, 0xF6A7, 0xF666, 0xF5E4, 0xF604,
-    0xF5E4, 0xFE04, 0xF6A7, 0xF5C4, 0xF5A3, 0xF543, 0xF542, 0xF542,
-    0x4962, 0x1841, 0x1041, 0x1020, 0x0800, 0x0020, 0x0000, 0x0020,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0020, 0x0000, 0x0800, 0x0820, 0x1020, 0x1041, 0xD4A3, 0xED21,
-    0xF542, 0xF543, 0xF583, 0xF583, 0xF645, 0xF6A7, 0xFE04, 0xF5E4,
-    0xF604, 0xF604, 0xF5C3, 0xF5C3, 0xF5A3, 0xF583, 0xF543, 0xFD62,
-    0x38E2, 0x1861, 0x1841, 0x1020, 0x0820, 0x0800, 0x0020, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0020, 0x0000, 0x0820, 0x1020, 0x2061, 0xB381, 0xF562,
-    0xF542, 0xF543, 0xF583, 0xF5A3, 0xF5C3, 0xF6A9, 0xF604, 0xF5E4,
-    0xFE04, 0xF5E4, 0xF5C4, 0xF5A3, 0xF5A3, 0xF582, 0xF542, 0xD4A3,
-    0x2081, 0x1861, 0x1841, 0x1020, 0x0800, 0x0000, 0x0020, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0020, 0x0000, 0x0820, 0x1020, 0x1841, 0x7A81, 0xF542,
-    0xF542, 0xF582, 0xF583, 0xF5A3, 0xF5A3, 0xF645, 0xF604, 0xF5E4,
-    0xF604, 0xF5E3, 0xF5C3, 0xF5A3, 0xF5A3, 0xF562, 0xFD82, 0xBC02,
-    0x28A1, 0x2061, 0x1841, 0x1020, 0x0820, 0x0820, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0020, 0x0000, 0x0820, 0x0820, 0x1020, 0x1841, 0x3902, 0xF562,
-    0xF582, 0xF582, 0xF5A3, 0xF5A3, 0xF5C3, 0xF5C3, 0xF5E3, 0xFDE4,
-    0xF604, 0xF5E3, 0xF5C3, 0xF5A3, 0xF5A3, 0xF583, 0xF562, 0x7A81,
-    0x2081, 0x1861, 0x1841, 0x1020, 0x0800, 0x0020, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0020, 0x0000, 0x0800, 0x0820, 0x1020, 0x1041, 0x1861, 0xBBE2,
-    0xF582, 0xF562, 0xF5A3, 0xF5A3, 0xF5C3, 0xF5C3, 0xF5C4, 0xF604,
-    0xFDE4, 0xF5E3, 0xF5C3, 0xF5C3, 0xF5A3, 0xF582, 0xF563, 0x4142,
-    0x28A1, 0x2061, 0x1841, 0x1020, 0x0800, 0x0820, 0x0000, 0x0020,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0820, 0x0800, 0x0820, 0x1020, 0x2061, 0x2081, 0x5162,
-    0xF582, 0xF582, 0xF5A3, 0xF5C3, 0xF5C3, 0xF5C4, 0xF604, 0xFDE4,
-    0xF604, 0xF5E3, 0xF5C3, 0xDD02, 0x9323, 0x7242, 0x4122, 0x30C1,
-    0x2881, 0x2061, 0x1041, 0x1020, 0x0800, 0x0820, 0x0000, 0x0020,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,
-    0x0000, 0x0020, 0x0800, 0x0820, 0x1020, 0x1861, 0x2061, 0x28A1,
-    0x7A81, 0x9B81, 0x8303, 0xED84, 0xF5C3, 0xF5E3, 0xF5E4, 0xF604,
-    0xFE04, 0xF604, 0xF5E3, 0x9B23, 0x5162, 0x4102, 0x40E2, 0x30C1,
-    0x28A1, 0x1861, 0x1841, 0x1020, 0x1020, 0x0800, 0x0020, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0020, 0x0800, 0x0820, 0x0820, 0x1020, 0x2061, 0x2081, 0x2881,
-    0x30C1, 0x40E2, 0x4142, 0x9B23, 0xFDE3, 0xF5E3, 0xF604, 0xF604,
-    0xF604, 0xFDE4, 0xF5E3, 0x61A1, 0x4962, 0x40E2, 0x40E2, 0x30C1,
-    0x28A1, 0x1861, 0x1841, 0x1020, 0x0820, 0x0000, 0x0020, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0020, 0x0000, 0x0800, 0x1020, 0x1020, 0x1861, 0x2081, 0x28A1,
-    0x30C1, 0x40E2, 0x4122, 0x4942, 0xED84, 0xF604, 0xFDE4, 0xF604,
-    0xF604, 0xFE04, 0xDCC3, 0x4962, 0x5162, 0x40E2, 0x40E2, 0x30C1,
-    0x28A1, 0x1861, 0x1841, 0x1020, 0x0820, 0x0820, 0x0800, 0x0020,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,
-    0x0000, 0x0820, 0x0800, 0x1020, 0x1841, 0x1861, 0x2881, 0x28A1,
-    0x38E2, 0x4102, 0x4142, 0x5162, 0xCCA4, 0xFE04, 0xF5E4, 0xF604,
-    0xFDE4, 0xF604, 0xAC43, 0x4942, 0x4962, 0x40E2, 0x40E2, 0x30C1,
-    0x28A1, 0x1861, 0x1841, 0x1020, 0x0820, 0x0800, 0x0020, 0x0000,
-    0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000,
-    0x0020, 0x0000, 0x0800, 0x1020, 0x1841, 0x2061, 0x2081, 0x28C1,
-    0x38E2, 0x40E2, 0x4122, 0x4962, 0x9BA3, 0xF604, 0xF5E4, 0xF604,
-    0xFE04, 0xF604, 0xD4A4, 0x4962, 0x5162, 0x40E2, 0x40E2, 0x30C1,
-    0x28A1, 0x1861, 0x1841, 0x1020, 0x0820, 0x0820, 0x0800, 0x0020,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,
-    0x0800, 0x0820, 0x0820, 0x1020, 0x1841, 0x2061, 0x2081, 0x30A1,
-    0x30E2, 0x40E2, 0x4142, 0x5162, 0x9BC3, 0xFE04, 0xF624, 0xF624,
-    0xF624, 0xFDE4, 0xF5E4, 0x9323, 0x4962, 0x4122, 0x40E2, 0x30C1,
-    0x28A1, 0x2061, 0x2061, 0x1041, 0x1020, 0x0800, 0x0020, 0x0000,
-    0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,
-    0x0800, 0x0800, 0x0820, 0x1020, 0x1841, 0x1861, 0x2081, 0x30A1,
-    0x30E2, 0x40E2, 0x5162, 0x4962, 0x9BA3, 0xF623, 0xF604, 0xF624,
-    0xF604, 0xF624, 0xF623, 0xF603, 0x59C2, 0x4142, 0x40E2, 0x30C1,
-    0x2881, 0x2081, 0x2061, 0x1041, 0x1020, 0x0820, 0x0820, 0x0800,
-    0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000,
-    0x0820, 0x0800, 0x1020, 0x1020, 0x1841, 0x1861, 0x28A1, 0x30C1,
-    0x38E2, 0x4942, 0x4962, 0x5162, 0xAC43, 0xFE43, 0xF643, 0xFE43,
-    0xF664, 0xF643, 0xF623, 0xFE23, 0x9303, 0x4122, 0x40E2, 0x30E2,
-    0x28A1, 0x2061, 0x2061, 0x1041, 0x1020, 0x0820, 0x0800, 0x0820,
-    0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,
-    0x0800, 0x0800, 0x1020, 0x1841, 0x1861, 0x2081, 0x28A1, 0x30C1,
-    0x40E2, 0x4122, 0x5162, 0x51A2, 0xCD43, 0xF644, 0xF664, 0xF644,
-    0xFE64, 0xF664, 0xF643, 0xF663, 0xC4C2, 0x5162, 0x40E2, 0x38E2,
-    0x28A1, 0x2081, 0x2061, 0x1841, 0x1020, 0x0820, 0x0820, 0x0000,
-    0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0820,
-    0x0800, 0x0820, 0x1020, 0x1041, 0x2061, 0x2081, 0x28A1, 0x38E2,
-    0x40E2, 0x4142, 0x5162, 0x51A2, 0xF603, 0xF664, 0xFE64, 0xF664,
-    0xF644, 0xF664, 0xFE44, 0xF643, 0xEDE3, 0x4962, 0x4122, 0x30E2,
-    0x30C1, 0x2061, 0x2061, 0x1841, 0x1020, 0x0820, 0x0800, 0x0020,
-    0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020,
-    0x0800, 0x0820, 0x1020, 0x1841, 0x2061, 0x2081, 0x28A1, 0x38E2,
-    0x3902, 0x4962, 0x51A2, 0x8303, 0xF644, 0xF664, 0xFE84, 0xF684,
-    0xF684, 0xFE44, 0xF664, 0xF664, 0xFE64, 0x59C2, 0x4122, 0x38E2,
-    0x30C1, 0x28A1, 0x2061, 0x1041, 0x1020, 0x0820, 0x0820, 0x0800,
-    0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0800,
-    0x0820, 0x0820, 0x1020, 0x1841, 0x2061, 0x2081, 0x28A1, 0x38E2,
-    0x3902, 0x5162, 0x59C2, 0xC4C2, 0xF6A4, 0xF684, 0xFE84, 0xF684,
-    0xF684, 0xF684, 0xFE84, 0xF663, 0xF664, 0x72A3, 0x4122, 0x3902,
-    0x30C1, 0x28A1, 0x51C1, 0x2881, 0x1041, 0x1020, 0x0820, 0x0800,
-    0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000,
-    0x0800, 0x0820, 0x1020, 0x1841, 0x1861, 0x28A1, 0x30C1, 0x3902,
-    0x4122, 0x4962, 0x7242, 0xF663, 0xFE84, 0xF684, 0xF684, 0xF6A4,
-    0xFEA4, 0xF684, 0xF684, 0xFE84, 0xFE64, 0x8B83, 0x4142, 0x3902,
-    0x38E2, 0x28A1, 0x6A82, 0xA3C3, 0x1841, 0x1020, 0x0820, 0x0820,
-    0x0800, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x0000, 0x0820,
-    0x0800, 0x0820, 0x1020, 0x1841, 0x1861, 0x59C1, 0xB463, 0xC4C2,
-    0x8303, 0x51A2, 0xAC43, 0xFEA4, 0xF684, 0xF6A4, 0xFEA4, 0xF6C4,
-    0xFEC4, 0xF6C4, 0xF6A4, 0xFE84, 0xF684, 0xAC43, 0x4962, 0x4122,
-    0x30E2, 0x30A1, 0x9B81, 0xF602, 0x1861, 0x1020, 0x0820, 0x0800,
-    0x0800, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x0800,
-    0x0820, 0x1020, 0x1041, 0x1021, 0x2881, 0xDDA2, 0xFE62, 0xF642,
-    0xF683, 0xCD43, 0xF663, 0xF684, 0xF6A4, 0xFEC4, 0xF6C5, 0xFEE5,
-    0xF6C5, 0xFEE5, 0xF6A4, 0xF6A4, 0xFEA4, 0xC4C2, 0x5162, 0x4142,
-    0x3902, 0x28A1, 0xCD63, 0xFE42, 0x4981, 0x1020, 0x0820, 0x0800,
-    0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0800, 0x0820,
-    0x0820, 0x1020, 0x1041, 0x2061, 0x59C1, 0xFE62, 0xF662, 0xF662,
-    0xFE83, 0xF663, 0xF684, 0xFEA4, 0xF6C4, 0xFEE5, 0xF6C5, 0xFF09,
-    0xF705, 0xFEE5, 0xFEE5, 0xF6C4, 0xF6A4, 0xE5A2, 0x51A2, 0x4942,
-    0x3902, 0x51C1, 0xFE62, 0xFE62, 0x6A82, 0x0820, 0x0800, 0x0800,
-    0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0800,
-    0x0820, 0x1020, 0x1841, 0x1841, 0x6A82, 0xF642, 0xFE42, 0xF682,
-    0xF683, 0xF684, 0xF6A4, 0xFEC4, 0xF6E5, 0xFF05, 0xF707, 0xFFB0,
-    0xFF06, 0xF705, 0xF705, 0xFEE5, 0xFEC4, 0xFEA4, 0x6223, 0x4183,
-    0x4122, 0xAC43, 0xFE62, 0xFE62, 0x8B41, 0x1841, 0x1020, 0x0800,
-    0x0820, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0800,
-    0x1020, 0x1020, 0x1841, 0x1861, 0x72A2, 0xFE62, 0xFE82, 0xF682,
-    0xF683, 0xFEA4, 0xF6C4, 0xFEE5, 0xF705, 0xFF05, 0xF72E, 0xFFB2,
-    0xFF26, 0xF726, 0xF705, 0xFEC5, 0xFEE5, 0xF6C4, 0x8B63, 0x51A2,
-    0x6223, 0xF662, 0xFE82, 0xF662, 0xAC43, 0x1021, 0x1020, 0x0820,
-    0x0000, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0800, 0x0800,
-    0x0820, 0x1020, 0x1041, 0x1861, 0x6201, 0xF682, 0xF682, 0xFEA2,
-    0xF6A4, 0xF6A4, 0xFEC4, 0xF705, 0xF705, 0xFF47, 0xFFB4, 0xFF94,
-    0xF747, 0xFF06, 0xFF26, 0xF705, 0xFEC5, 0xFEE5, 0xD603, 0x72C3,
-    0xDE02, 0xFE82, 0xF682, 0xF6A2, 0xC4C2, 0x2061, 0x1841, 0x0820,
-    0x0800, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0820, 0x0800,
-    0x0820, 0x1020, 0x1841, 0x1861, 0x4981, 0xFEA2, 0xFEC2, 0xFEC3,
-    0xF6C3, 0xFEC4, 0xF6E5, 0xFF05, 0xF726, 0xFF4C, 0xFF95, 0xFFD4,
-    0xF78C, 0xFF46, 0xFF46, 0xF706, 0xFF05, 0xF6E5, 0xFEC5, 0xF6C4,
-    0xF6A4, 0xFEA2, 0xF682, 0xF682, 0xBCC2, 0x1881, 0x1021, 0x1020,
-    0x0800, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0800,
-    0x0820, 0x1020, 0x1861, 0x2061, 0x30A1, 0xEE43, 0xF6A2, 0xFEC3,
-    0xF6C4, 0xFEC5, 0xF705, 0xF726, 0xFF06, 0xF7AF, 0xFFD5, 0xFFB5,
-    0xFFD4, 0xFF69, 0xFF47, 0xF707, 0xFF26, 0xF705, 0xF6E5, 0xFEE5,
-    0xF6C4, 0xFEC3, 0xF6C2, 0xFEC2, 0xD563, 0x2081, 0x1080, 0x0840,
-    0x0820, 0x0820, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0800, 0x0820,
-    0x0820, 0x1841, 0x2061, 0x2081, 0x28E1, 0xC4C2, 0xFEC3, 0xFEC3,
-    0xF6C4, 0xFF05, 0xF705, 0xFF26, 0xFF46, 0xFFAF, 0xFFD5, 0xFFB5,
-    0xFFD5, 0xF7B2, 0xFF48, 0xFF47, 0xF707, 0xFF27, 0xF726, 0xFEC5,
-    0xF6E5, 0xF6C4, 0xFEC3, 0xF6A2, 0xCD43, 0x18C1, 0x1881, 0x1841,
-    0x0820, 0x0820, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0800,
-    0x1020, 0x1841, 0x1861, 0x2881, 0x28C1, 0x72A3, 0xFEC3, 0xF6C4,
-    0xFEE4, 0xF705, 0xFF26, 0xF747, 0xFF47, 0xFFAF, 0xFFB5, 0xFFD5,
-    0xFFB6, 0xFFD5, 0xFFD2, 0xF749, 0xFF47, 0xFF27, 0xF707, 0xFF06,
-    0xF705, 0xFEE5, 0xF6E4, 0xFEC3, 0xDE03, 0x28E1, 0x2081, 0x1080,
-    0x0840, 0x0840, 0x0820, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0800, 0x0820,
-    0x1020, 0x1841, 0x2061, 0x28A1, 0x30E2, 0x4922, 0xE622, 0xFF04,
-    0xF705, 0xFF26, 0xFF06, 0xF74A, 0xFF48, 0xFFB0, 0xFFD5, 0xFFD6,
-    0xFFB6, 0xFFD5, 0xFFB5, 0xFFB0, 0xF748, 0xFF48, 0xFF07, 0xF727,
-    0xFF26, 0xF705, 0xFEE4, 0xF6C4, 0xD603, 0x20C1, 0x18C1, 0x1880,
-    0x1080, 0x0840, 0x0020, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0800,
-    0x1020, 0x1841, 0x18A1, 0x30A1, 0x3101, 0x4122, 0x72A3, 0xD603,
-    0xF705, 0xFF26, 0xF747, 0xFFB0, 0xFF48, 0xFFB2, 0xFFB6, 0xFFD6,
-    0xFFB6, 0xFFD6, 0xFFB6, 0xFFD6, 0xFFB0, 0xF748, 0xFF48, 0xFF27,
-    0xF707, 0xFF05, 0xF705, 0xFF04, 0xDE03, 0x3122, 0x20C1, 0x18A0,
-    0x1080, 0x0840, 0x0840, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0800, 0x0820,
-    0x1020, 0x1841, 0x20A1, 0x28E1, 0x3902, 0x49A3, 0x59C2, 0x6284,
-    0xFF26, 0xFF46, 0xFF6A, 0xFF94, 0xFF6A, 0xFFD6, 0xFFB6, 0xFFD6,
-    0xFFB7, 0xFFD7, 0xFFB7, 0xFFD6, 0xFFB6, 0xFF4C, 0xF749, 0xFF48,
-    0xFF27, 0xF707, 0xF705, 0xFF05, 0xE6A3, 0x2902, 0x2101, 0x18C1,
-    0x18A0, 0x1060, 0x0840, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0800, 0x0820,
-    0x1020, 0x1861, 0x20A1, 0x28E1, 0x3902, 0x4183, 0x49E3, 0x8363,
-    0xFF26, 0xFF47, 0xF74C, 0xFFD5, 0xFF94, 0xFFB6, 0xFFD7, 0xFFB7,
-    0xFFD7, 0xF7D7, 0xFFD7, 0xFFD7, 0xFFD7, 0xFF94, 0xFF6A, 0xFF49,
-    0xF748, 0xFF27, 0xFF26, 0xFF05, 0xFF04, 0x5262, 0x2101, 0x20C1,
-    0x18A0, 0x1080, 0x0840, 0x0840, 0x0820, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0820, 0x0820,
-    0x1841, 0x2081, 0x18A1, 0x28E1, 0x3962, 0x4983, 0x5244, 0xB565,
-    0xFF46, 0xFF48, 0xFF8D, 0xFFB6, 0xFFD6, 0xFFB7, 0xFFD7, 0xFFD7,
-    0xFFD7, 0xFFD8, 0xFFD8, 0xFFD7, 0xFFD7, 0xF7B7, 0xFFB0, 0xFF4A,
-    0xF769, 0xFF48, 0xFF07, 0xF726, 0xF705, 0xA4A4, 0x2922, 0x20E1,
-    0x18A0, 0x1080, 0x0840, 0x0840, 0x0020, 0x0020, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x0820,
-    0x1080, 0x1881, 0x20C1, 0x28E1, 0x3162, 0x4183, 0x5204, 0xEEC5,
-    0xFF47, 0xFF48, 0xF78D, 0xFFD6, 0xFFB7, 0xFFD7, 0xFFD8, 0xFFD8,
-    0xFFD8, 0xFFD8, 0xFFD8, 0xFFD8, 0xFFD8, 0xFFD7, 0xFFD6, 0xFF6A,
-    0xFF4A, 0xF748, 0xFF47, 0xFF26, 0xFF26, 0xF724, 0x41E2, 0x2101,
-    0x20C1, 0x18A0, 0x1080, 0x0840, 0x0840, 0x0820, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x0820,
-    0x1841, 0x20A1, 0x18C1, 0x3122, 0x3982, 0x49A3, 0x8B83, 0xFF66,
-    0xFF48, 0xFF69, 0xFF8C, 0xFFD7, 0xFFD7, 0xFFD7, 0xFFD8, 0xFFD8,
-    0xFFD9, 0xFFD9, 0xFFF9, 0xFFD9, 0xFFD8, 0xFFD8, 0xFFD7, 0xF78D,
-    0xFF6A, 0xFF49, 0xFF48, 0xF747, 0xFF45, 0xFF44, 0x7BC4, 0x2922,
-    0x18C1, 0x1880, 0x1080, 0x0840, 0x0840, 0x0020, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0820,
-    0x1080, 0x2081, 0x28E1, 0x2922, 0x3982, 0x41E3, 0xB545, 0xFF47,
-    0xF748, 0xFF49, 0xFF8C, 0xFFD7, 0xFFD7, 0xFFD8, 0xFFF9, 0xFFD9,
-    0xFFFA, 0xFFDA, 0xFFFA, 0xFFDA, 0xFFF9, 0xFFD9, 0xFFD7, 0xF78D,
-    0xFF8C, 0xFF4A, 0xFF69, 0xFF47, 0xFF46, 0xFF45, 0xC5C5, 0x3122,
-    0x20C1, 0x18A0, 0x1080, 0x0840, 0x0840, 0x0020, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0820, 0x0820,
-    0x1080, 0x18A0, 0x28E1, 0x3122, 0x3982, 0x5A44, 0xF745, 0xFF47,
-    0xFF48, 0xFF49, 0xF78C, 0xFFD7, 0xFFD8, 0xFFD8, 0xFFF9, 0xFFDA,
-    0xFFFB, 0xFFDB, 0xFFFB, 0xFFDB, 0xFFFA, 0xFFD9, 0xFFD5, 0xFFAF,
-    0xFF8C, 0xFF8B, 0xF769, 0xFF48, 0xFF46, 0xF745, 0xEEC3, 0x2902,
-    0x2101, 0x20C1, 0x18A0, 0x1060, 0x0040, 0x0020, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0840,
-    0x1080, 0x1881, 0x28C1, 0x2922, 0x3982, 0xB503, 0xFF46, 0xFF47,
-    0xF788, 0xFFAA, 0xFF8D, 0xF7D7, 0xFFD8, 0xFFF9, 0xFFDA, 0xFFDB,
-    0xFFFC, 0xFFDC, 0xFFFC, 0xFFFC, 0xFFDB, 0xFFDA, 0xFFD5, 0xFFAF,
-    0xFF8D, 0xFF8C, 0xFF69, 0xFF48, 0xFF47, 0xFF45, 0xFF44, 0x3162,
-    0x2901, 0x20C1, 0x18A0, 0x1080, 0x0840, 0x0020, 0x0820, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0800, 0x0020, 0x1060,
-    0x1080, 0x2081, 0x28E1, 0x2922, 0x62A3, 0xF745, 0xFF86, 0xFF88,
-    0xFF89, 0xFFAA, 0xFFAF, 0xFFD8, 0xFFD8, 0xFFD9, 0xFFFA, 0xFFFC,
-    0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFDC, 0xFFDB, 0xFFD7, 0xFFB0,
-    0xF78D, 0xFF8C, 0xFF89, 0xF788, 0xF766, 0xFF65, 0xFF44, 0x3142,
-    0x2101, 0x18C1, 0x18A0, 0x1060, 0x0840, 0x0840, 0x0020, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0820, 0x0020, 0x0840,
-    0x1080, 0x1881, 0x28C1, 0x2922, 0xC5A5, 0xF765, 0xFF86, 0xFF88,
-    0xF789, 0xFF8B, 0xFFB0, 0xFFD8, 0xFFF9, 0xFFDA, 0xFFDB, 0xFFFC,
-    0xFFFD, 0xFFFE, 0xFFFE, 0xFFFE, 0xFFFD, 0xFFFB, 0xFFDA, 0xFFD2,
-    0xFFAF, 0xF78C, 0xFF8A, 0xFF89, 0xF787, 0xFF46, 0xFF45, 0x3162,
-    0x2901, 0x20C1, 0x18A0, 0x1080, 0x0840, 0x0840, 0x0020, 0x0020,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0820, 0x0860,
-    0x1080, 0x2081, 0x28E1, 0x3982, 0xFF64, 0xFF85, 0xFF66, 0xFF88,
-    0xFF89, 0xFFAB, 0xFFB2, 0xFFD8, 0xFFF9, 0xFFDA, 0xFFFB, 0xFFFC,
-    0xFFFE, 0xFFFE, 0xFFFE, 0xFFFE, 0xFFFD, 0xFFDB, 0xFFDA, 0xFFD5,
-    0xFFAF, 0xF78C, 0xFF8B, 0xFF89, 0xF788, 0xFF86, 0xE6A5, 0x3142,
-    0x2101, 0x18C1, 0x18A0, 0x1060, 0x0840, 0x0840, 0x0020, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0840,
-    0x1080, 0x10A0, 0x28C1, 0x6B64, 0xFF65, 0xFF65, 0xFF86, 0xF788,
-    0xFF89, 0xFF8B, 0xFFD6, 0xFFD8, 0xFFD9, 0xFFFA, 0xFFDB, 0xFFFC,
-    0xFFFE, 0xFFFE, 0xFFFE, 0xFFFE, 0xFFFD, 0xFFDB, 0xFFFA, 0xFFD8,
-    0xFFB0, 0xF78C, 0xFF8B, 0xFF89, 0xFF88, 0xFF86, 0xCE26, 0x3962,
-    0x2101, 0x20C1, 0x18A0, 0x1080, 0x0840, 0x0840, 0x0820, 0x0020,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0820, 0x0840,
-    0x1080, 0x18A0, 0x28E1, 0xBD03, 0xFF85, 0xFF86, 0xF766, 0xFF88,
-    0xFF89, 0xFFAF, 0xFFD7, 0xFFD8, 0xFFD8, 0xFFDA, 0xFFFB, 0xFFFC,
-    0xFFFD, 0xFFFD, 0xFFFE, 0xFFFD, 0xFFDC, 0xFFDB, 0xFFFA, 0xFFD9,
-    0xFFD5, 0xF78C, 0xFF8B, 0xFF89, 0xFF88, 0xF786, 0xB545, 0x3162,
-    0x20E1, 0x18C1, 0x18A0, 0x1080, 0x0840, 0x0840, 0x0020, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020,
-    0x1080, 0x1080, 0x18A1, 0xD603, 0xFF65, 0xFF86, 0xFF87, 0xF788,
-    0xFF8A, 0xFFB5, 0xFFD7, 0xFFD8, 0xFFF8, 0xFFD9, 0xFFFA, 0xFFDB,
-    0xFFDC, 0xFFFC, 0xFFDC, 0xFFFC, 0xFFFB, 0xFFDA, 0xFFF9, 0xFFD8,
-    0xFFD8, 0xFFAF, 0xFF8B, 0xFF89, 0xFF88, 0xFF86, 0x9465, 0x3122,
-    0x2101, 0x20C1, 0x18A0, 0x1080, 0x0840, 0x0020, 0x0820, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0820, 0x0840,
-    0x0840, 0x18A0, 0x20C1, 0xF745, 0xFF85, 0xFF66, 0xFF87, 0xFF88,
-    0xFFB0, 0xFFD6, 0xFFD7, 0xFFD7, 0xFFD8, 0xFFD9, 0xFFDA, 0xFFFA,
-    0xFFDB, 0xFFFB, 0xFFDB, 0xFFFB, 0xFFDB, 0xFFFA, 0xFFD9, 0xFFF8,
-    0xFFD7, 0xF7B2, 0xFFAA, 0xFF89, 0xF788, 0xFF87, 0x7364, 0x2922,
-    0x20E1, 0x18A0, 0x1080, 0x1060, 0x0040, 0x0020, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0840,
-    0x0840, 0x0860, 0x2922, 0xFF65, 0xFF65, 0xF766, 0xFF87, 0xFF88,
-    0xFFB2, 0xFFD6, 0xFFD7, 0xFFD7, 0xFFD8, 0xFFD8, 0xFFD9, 0xFFFA,
-    0xFFDA, 0xFFFA, 0xFFDA, 0xFFFA, 0xFFDA, 0xFFD9, 0xFFD8, 0xFFD8,
-    0xFFD7, 0xFFD6, 0xFFAA, 0xFF89, 0xFF88, 0xFF86, 0x5262, 0x2922,
-    0x20C1, 0x18A0, 0x1080, 0x0840, 0x0840, 0x0820, 0x0020, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0840,
-    0x0840, 0x1080, 0x4182, 0xFF85, 0xFF85, 0xFF66, 0xFF87, 0xFF88,
-    0xFFD5, 0xFFD6, 0xFFB7, 0xFFD7, 0xFFD7, 0xFFD8, 0xFFD8, 0xFFD9,
-    0xFFF9, 0xFFD9, 0xFFF9, 0xFFD9, 0xFFF9, 0xFFD8, 0xFFD8, 0xFFD7,
-    0xFFD7, 0xFFB6, 0xFF8B, 0xF788, 0xFF88, 0xF766, 0x3162, 0x20E1,
-    0x18C1, 0x18A0, 0x1080, 0x0840, 0x0840, 0x0020, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020,
-    0x0840, 0x0860, 0x39C2, 0xFF65, 0xFF65, 0xFF66, 0xF787, 0xFF88,
-    0xFFD5, 0xFFB6, 0xFFD6, 0xFFD7, 0xFFD7, 0xFFD8, 0xFFD8, 0xFFF8,
-    0xFFD8, 0xFFF9, 0xFFD9, 0xFFD8, 0xFFD8, 0xFFD8, 0xFFD7, 0xFFD7,
-    0xFFD7, 0xFFD6, 0xFF8A, 0xFF88, 0xFFA7, 0xCE26, 0x2922, 0x2901,
-    0x20C1, 0x18A0, 0x1080, 0x0840, 0x0840, 0x0020, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820,
-    0x0840, 0x0840, 0x3962, 0xFF85, 0xFF85, 0xFF66, 0xFF87, 0xFF89,
-    0xFFD6, 0xFFD6, 0xFFD6, 0xFFD7, 0xFFD7, 0xFFD7, 0xF7D7, 0xFFD8,
-    0xFFD8, 0xFFD8, 0xFFD8, 0xFFD8, 0xFFD8, 0xFFD7, 0xFFD7, 0xFFD7,
-    0xFFB6, 0xFFD5, 0xFF89, 0xF788, 0xFF87, 0x9CA4, 0x20E1, 0x20C1,
-    0x10A0, 0x1060, 0x0840, 0x0840, 0x0020, 0x0820, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,
-    0x0020, 0x0840, 0x18C1, 0xFF65, 0xFF66, 0xF766, 0xFF87, 0xFF88,
-    0xFFD5, 0xFFB5, 0xFFD6, 0xFFB6, 0xFFD6, 0xF7D7, 0xFFD7, 0xFFD7,
-    0xFFD7, 0xF7D7, 0xFFD7, 0xFFD7, 0xFFD7, 0xFFD7, 0xFFB7, 0xFFD6,
-    0xFFD6, 0xFFB2, 0xFFA8, 0xFF88, 0xFFA7, 0x6B23, 0x2901, 0x20C1,
-    0x18A0, 0x1080, 0x0840, 0x0840, 0x0020, 0x0000, 0x0020, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0820,
-    0x0020, 0x0840, 0x0840, 0xF745, 0xFF86, 0xFF87, 0xFF87, 0xFF87,
-    0xFFD4, 0xFFB5, 0xFFD5, 0xFFB6, 0xFFD6, 0xFFD6, 0xFFD7, 0xFFF7,
-    0xFFD7, 0xF7D7, 0xFFD7, 0xFFF7, 0xFFD7, 0xFFD7, 0xFFD6, 0xFFD6,
-    0xFFD6, 0xF7AF, 0xFF88, 0xFF87, 0xF767, 0x2902, 0x18C1, 0x10A0,
-    0x1060, 0x1080, 0x0820, 0x0840, 0x0020, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0020, 0x0020, 0x0840, 0xC626, 0xFF66, 0xF787, 0xFF87, 0xFF87,
-    0xF7B2, 0xFFD5, 0xFFB5, 0xFFD6, 0xFFD6, 0xFFD6, 0xFFB6, 0xFFD6,
-    0xFFF7, 0xFFD7, 0xFFD7, 0xFFD7, 0xFFD6, 0xFFD6, 0xFFB6, 0xFFD6,
-    0xFFD6, 0xFF8B, 0xFFA8, 0xFFA7, 0xCE26, 0x20C1, 0x18A0, 0x18A0,
-    0x1080, 0x0840, 0x0840, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0020, 0x0820, 0x0840, 0xA4C4, 0xFF87, 0xFF87, 0xFF87, 0xFF87,
-    0xFFB0, 0xFFD5, 0xFFD5, 0xFFB6, 0xFFD6, 0xFFD6, 0xFFD6, 0xFFF6,
-    0xFFD6, 0xFFF6, 0xFFD6, 0xFFF6, 0xFFD6, 0xFFF6, 0xFFD6, 0xFFD6,
-    0xFFB2, 0xFFA8, 0xF7A7, 0xFF87, 0x7BC4, 0x18C1, 0x18A0, 0x1060,
-    0x0840, 0x0840, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0020, 0x0000, 0x5AA3, 0xF787, 0xFF87, 0xFF87, 0xFFA7,
-    0xFFAD, 0xFFD5, 0xFFB5, 0xFFD6, 0xFFD6, 0xFFD6, 0xFFF6, 0xFFD6,
-    0xFFF6, 0xFFD6, 0xFFF6, 0xFFD6, 0xFFF6, 0xFFD6, 0xFFB6, 0xFFD6,
-    0xFFCD, 0xFFA8, 0xFFA7, 0xFFC7, 0x41E2, 0x18A0, 0x1060, 0x1080,
-    0x0840, 0x0840, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0820, 0x0020, 0x18A0, 0xFF86, 0xFF87, 0xFFA7, 0xFFA7,
-    0xFFA8, 0xFFD4, 0xFFD5, 0xFFD6, 0xFFD6, 0xFFB6, 0xF7D4, 0xFFCB,
-    0xFFB0, 0xFFB6, 0xFFD6, 0xFFB6, 0xFFD6, 0xFFB6, 0xFFD6, 0xFFB4,
-    0xF7A8, 0xFFA8, 0xFFA7, 0xC626, 0x1080, 0x0860, 0x1060, 0x0840,
-    0x0840, 0x0020, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0020, 0x8C65, 0xFF87, 0xF7A7, 0xFFA7,
-    0xFFA7, 0xFFAD, 0xFFB5, 0xFFD5, 0xFFF6, 0xFFD6, 0xF7AD, 0xFFC9,
-    0xFFC9, 0xFFB2, 0xFFB6, 0xFFD6, 0xFFB6, 0xFFD5, 0xFFF6, 0xFFAD,
-    0xFFA8, 0xFFA7, 0xFFC7, 0x7B84, 0x1060, 0x1080, 0x0840, 0x0840,
-    0x0820, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0020, 0x0020, 0x2901, 0xF767, 0xFFA7, 0xFFA7,
-    0xFFA7, 0xFFA8, 0xFFB0, 0xFFD5, 0xFFD5, 0xFFB2, 0xF7C9, 0xFFA8,
-    0xFFA9, 0xFFAC, 0xFFD6, 0xFFD6, 0xFFF6, 0xFFD6, 0xF7D2, 0xFFA8,
-    0xFFA8, 0xFFA8, 0xEF47, 0x18A1, 0x0860, 0x0840, 0x0840, 0x0040,
-    0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4A42, 0xF787, 0xFFA7,
-    0xFFA7, 0xF7A8, 0xFFA8, 0xFFCB, 0xFFAD, 0xFFC9, 0xF788, 0x83C4,
-    0xE728, 0xFFA9, 0xFFD5, 0xFFF6, 0xFFD6, 0xFFD5, 0xFFCB, 0xFFA8,
-    0xFFA8, 0xFFC8, 0x7B64, 0x1080, 0x0840, 0x0840, 0x0020, 0x0820,
-    0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0020, 0x6B23, 0xFFC7,
-    0xFFA8, 0xFFA8, 0xFFA8, 0xFFA8, 0xFFA8, 0xFFA8, 0xB545, 0x18C1,
-    0x7364, 0xFFC8, 0xFFB2, 0xFFF6, 0xFFD6, 0xFFAF, 0xFFA8, 0xFFA8,
-    0xFFA8, 0xCE68, 0x0860, 0x0840, 0x0020, 0x0020, 0x0820, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0000, 0x5242,
-    0xE728, 0xFFA8, 0xFFA8, 0xFFA8, 0xFFA8, 0xFFC8, 0x5262, 0x10A0,
-    0x18A1, 0xE728, 0xFFAF, 0xFFD6, 0xF7B0, 0xFFC9, 0xFFA8, 0xFFA8,
-    0xFFA8, 0x41E2, 0x0840, 0x0840, 0x0820, 0x0020, 0x0000, 0x0020,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000,
-    0x2901, 0xCE46, 0xFFA8, 0xFFC9, 0xFFC9, 0xE708, 0x0860, 0x1060,
-    0x1060, 0xA4C4, 0xFFC9, 0xFFCA, 0xFFC9, 0xFFC9, 0xFFA9, 0xF788,
-    0x6303, 0x0020, 0x0020, 0x0020, 0x0820, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0020, 0x0020, 0x5AA3, 0xD668, 0xFFC9, 0xA4C4, 0x0840, 0x0840,
-    0x0840, 0x4A42, 0xFFC9, 0xFFA9, 0xFFC9, 0xFFC9, 0xFFA8, 0x6B23,
-    0x0840, 0x0820, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,
-    0x0000, 0x0020, 0x0820, 0x0840, 0x5262, 0x41E2, 0x0820, 0x0040,
-    0x0820, 0x0840, 0xD688, 0xFFC9, 0xFFC9, 0xC5A5, 0x3142, 0x0020,
-    0x0020, 0x0000, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0020, 0x0000, 0x0020, 0x0000, 0x0020, 0x0820, 0x0020, 0x0820,
-    0x0020, 0x0820, 0x1080, 0x3982, 0x20C1, 0x0020, 0x0820, 0x0020,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0020, 0x0000, 0x0020, 0x0000, 0x0020, 0x0800, 0x0020,
-    0x0000, 0x0020, 0x0800, 0x0020, 0x0820, 0x0000, 0x0020, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0000, 0x0020, 0x0000,
-    0x0020, 0x0000, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0000,
-    0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 },
-  { 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x28A1,
-    0x28A0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x40E2, 0xD2A2,
-    0xDAA2, 0x1841, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xAA82, 0xD2A2,
-    0xD282, 0x61A1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x69A1, 0xD2A2,
-    0xD2A2, 0x91E2, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x28A0,
-    0x4121, 0x1020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000,
-    0x0020, 0x0000, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000,
-    0x0020, 0x0000, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0000, 0x0020,
-    0x0800, 0x0820, 0x0000, 0x0020, 0x0000, 0x0020, 0x0000, 0x0020,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0800, 0x0020,
-    0x0800, 0x0020, 0x0800, 0x0020, 0x0800, 0x0020, 0x0800, 0x0020,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0020, 0x0000, 0x0820, 0x0800, 0x0020, 0x0800, 0x0820,
-    0x0800, 0x0020, 0x0800, 0x0820, 0x0800, 0x0020, 0x0800, 0x0020,
-    0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0020, 0x0000, 0x0020, 0x0800, 0x0020, 0x0800, 0x0820, 0x1020,
-    0x0820, 0x0820, 0x0820, 0x0820, 0x0800, 0x0820, 0x0000, 0x0820,
-    0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0020, 0x0800, 0x0820, 0x0000, 0x0820, 0x1020, 0x1020,
-    0x1020, 0x1020, 0x1020, 0x1020, 0x0820, 0x1020, 0x0820, 0x0000,
-    0x0820, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0020, 0x0800, 0x0820, 0x0820, 0x0820, 0x1020, 0x1020, 0x1841,
-    0x1041, 0x1841, 0x1841, 0x1020, 0x1020, 0x1020, 0x0820, 0x0800,
-    0x0820, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000,
-    0x0020, 0x0800, 0x0820, 0x0820, 0x1020, 0x1841, 0x1841, 0x7A21,
-    0x9282, 0x69A1, 0x1861, 0x1041, 0x1841, 0x1020, 0x1020, 0x0820,
-    0x0800, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000,
-    0x0020, 0x0800, 0x0820, 0x1020, 0x1841, 0x1841, 0x1861, 0x2061,
-    0xB322, 0xE3C1, 0xBB22, 0x2081, 0x2061, 0x1041, 0x1020, 0x1020,
-    0x0820, 0x0800, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0800,
-    0x0820, 0x0820, 0x1020, 0x1841, 0x1841, 0x2061, 0x2081, 0x2061,
-    0x40E2, 0xEBE3, 0xE3E3, 0xAA62, 0x1861, 0x2061, 0x1041, 0x1020,
-    0x1020, 0x0800, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000,
-    0x0800, 0x1020, 0x1020, 0x1041, 0x2061, 0x2081, 0x2881, 0x20A1,
-    0x28A1, 0xCBA2, 0xEC23, 0xEC23, 0x69A1, 0x2081, 0x2061, 0x1841,
-    0x1020, 0x0820, 0x0820, 0x0800, 0x0020, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0820,
-    0x1020, 0x1020, 0x1841, 0x1861, 0x2881, 0x2881, 0x28A1, 0x30C1,
-    0x38E2, 0xB322, 0xEC43, 0xEC23, 0xCBA2, 0x28A1, 0x1861, 0x2061,
-    0x1041, 0x1020, 0x0800, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x0800,
-    0x1020, 0x1041, 0x1841, 0x2061, 0x28A1, 0x30C1, 0x30E2, 0x3902,
-    0x3902, 0xB322, 0xEC23, 0xEC23, 0xEC23, 0x7A21, 0x2081, 0x2061,
-    0x1841, 0x1020, 0x0820, 0x0820, 0x0800, 0x0020, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0820, 0x0820,
-    0x1020, 0x1841, 0x1861, 0x28A1, 0x30A1, 0x38E2, 0x3902, 0x4142,
-    0x4942, 0xCBA2, 0xEC63, 0xEC63, 0xEC23, 0xCB82, 0x28A1, 0x2081,
-    0x1861, 0x1841, 0x1020, 0x0800, 0x0000, 0x0020, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0800, 0x0820,
-    0x1020, 0x1841, 0x2081, 0x28A1, 0x30C1, 0x3902, 0x4122, 0x4962,
-    0x4962, 0xEC23, 0xEC63, 0xEC63, 0xF463, 0xEC43, 0x69A1, 0x28A1,
-    0x1861, 0x1841, 0x1020, 0x0820, 0x0800, 0x0020, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x0800, 0x1020,
-    0x1041, 0x2061, 0x2081, 0x30C1, 0x38E2, 0x4142, 0x5162, 0x59A2,
-    0x6223, 0xF4C2, 0xECC2, 0xECC2, 0xEC63, 0xEC63, 0xB302, 0x28A1,
-    0x2081, 0x1041, 0x1020, 0x0820, 0x0800, 0x0000, 0x0020, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0800, 0x1020,
-    0x1041, 0x2061, 0x28A1, 0x38E2, 0x3902, 0x4962, 0x51A2, 0x6223,
-    0x9323, 0xF503, 0xED03, 0xECC4, 0xF4C2, 0xEC83, 0xEC23, 0x38E2,
-    0x2881, 0x1861, 0x1841, 0x0820, 0x0800, 0x0820, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x0820, 0x1020,
-    0x1841, 0x2881, 0x28A1, 0x38E2, 0x4142, 0x59A2, 0x6223, 0x6223,
-    0xDCC3, 0xF503, 0xF503, 0xED03, 0xECC2, 0xF4C2, 0xEC63, 0x61A1,
-    0x2881, 0x1861, 0x1041, 0x1020, 0x0800, 0x0800, 0x0020, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0800, 0x0820, 0x1020,
-    0x2061, 0x2081, 0x30C1, 0x3902, 0x4962, 0x51A2, 0x6223, 0x9303,
-    0xF544, 0xED44, 0xF583, 0xF646, 0xED03, 0xF4C2, 0xF4C2, 0x9B01,
-    0x30A1, 0x2081, 0x1841, 0x1020, 0x0800, 0x0020, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x0820, 0x1841,
-    0x1861, 0x28A1, 0x30C1, 0x4922, 0x5162, 0x6223, 0x6A82, 0xDCC3,
-    0xF583, 0xF5C4, 0xF605, 0xFEC9, 0xF605, 0xED03, 0xECA2, 0xCB82,
-    0x28A1, 0x2081, 0x1041, 0x1020, 0x0820, 0x0800, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0800, 0x0820, 0x1041,
-    0x2061, 0x2881, 0x30E2, 0x4142, 0x51A2, 0x6223, 0xBBE2, 0xF5C4,
-    0xF5C4, 0xF5E5, 0xF6C9, 0xFEC9, 0xF6A9, 0xED03, 0xF4C2, 0xECA2,
-    0x30C1, 0x2881, 0x1841, 0x1020, 0x0820, 0x0000, 0x0020, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0020, 0x0800, 0x0820, 0x1020, 0x1041,
-    0x2061, 0x28A1, 0x38E2, 0x4142, 0x6223, 0xDCC3, 0xF583, 0xF5C4,
-    0xFE24, 0xFF08, 0xF709, 0xF6C9, 0xFEC9, 0xF5C4, 0xECC2, 0xECA2,
-    0x4962, 0x2061, 0x1861, 0x1020, 0x0820, 0x0800, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0800, 0x1020, 0x1841,
-    0x2081, 0x28C1, 0x3902, 0x51A2, 0xD4A3, 0xF543, 0xF5A3, 0xF604,
-    0xF6E8, 0xFF6A, 0xFF09, 0xFF29, 0xF6C9, 0xF646, 0xF503, 0xF4C2,
-    0x7A21, 0x28A1, 0x2061, 0x1020, 0x0820, 0x0800, 0x0020, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x0800, 0x1020, 0x1041,
-    0x2881, 0x28A1, 0x3922, 0xCC21, 0xF503, 0xF543, 0xF5C4, 0xFE66,
-    0xFF6A, 0xFF4A, 0xF729, 0xFF09, 0xF6C9, 0xF6A9, 0xF503, 0xECA2,
-    0x9AE1, 0x2081, 0x1861, 0x1841, 0x0820, 0x0800, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0800, 0x1020, 0x1841,
-    0x2061, 0x28A1, 0x7242, 0xECC2, 0xED03, 0xF543, 0xF5C4, 0xF6A7,
-    0xFF4A, 0xFF6A, 0xFF09, 0xF6A9, 0xF6C9, 0xF6A9, 0xF543, 0xF4C2,
-    0xB381, 0x28A1, 0x2061, 0x1841, 0x0820, 0x0800, 0x0020, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0020, 0x0800, 0x0820, 0x1020, 0x1041,
-    0x2081, 0x30A1, 0xCC21, 0xF502, 0xF502, 0xF543, 0xF5C4, 0xF6C7,
-    0xFF4A, 0xFF08, 0xF645, 0xF5E4, 0xF646, 0xF6C9, 0xF583, 0xECC1,
-    0xCB82, 0x2081, 0x1861, 0x1841, 0x0820, 0x0800, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0020, 0x0800, 0x0000, 0x1020, 0x1041,
-    0x2081, 0x5141, 0xF4C1, 0xED02, 0xF543, 0xF543, 0xF5C3, 0xF604,
-    0xF685, 0xF645, 0xF624, 0xF5E3, 0xF5A3, 0xFEA7, 0xF5C4, 0xF4C1,
-    0xCC21, 0x28A1, 0x2061, 0x1841, 0x0820, 0x0800, 0x0020, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x1020, 0x1841,
-    0x2081, 0x9282, 0xF4C1, 0xF502, 0xF563, 0xF543, 0xF5A3, 0xF604,
-    0xF624, 0xF624, 0xF5E4, 0xF5C3, 0xF583, 0xF583, 0xF5E5, 0xECC1,
-    0xC401, 0x2881, 0x1861, 0x1841, 0x0820, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0800, 0x1020, 0x1041,
-    0x2061, 0xAB81, 0xECC1, 0xF502, 0xED02, 0xF543, 0xF583, 0xF5C3,
-    0xFDE4, 0xF604, 0xF5E3, 0xF5A3, 0xF583, 0xF563, 0xF543, 0xF502,
-    0xCC21, 0x28A1, 0x1861, 0x1841, 0x0820, 0x0800, 0x0820, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0020, 0x0800, 0x0820, 0x1020, 0x1041,
-    0x2061, 0xCC21, 0xF4C1, 0xF502, 0xF502, 0xF543, 0xF583, 0xF5A3,
-    0xF5C3, 0xF5C4, 0xF5C3, 0xF5A3, 0xF583, 0xED63, 0xF502, 0xF502,
-    0xB3E2, 0x2061, 0x1861, 0x1841, 0x0820, 0x0000, 0x0820, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0800, 0x1020, 0x1041,
-    0x1841, 0xC401, 0xF4C1, 0xED02, 0xF502, 0xF563, 0xF583, 0xDCA3,
-    0xAC43, 0x9BC3, 0x9323, 0xBC02, 0xF543, 0xF563, 0xF502, 0xF502,
-    0xB381, 0x2081, 0x2061, 0x1841, 0x0820, 0x0800, 0x0020, 0x0000,
-    0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0020, 0x0800, 0x0820, 0x1020, 0x1841,
-    0x2061, 0xCC21, 0xF4C1, 0xF502, 0xF502, 0xED43, 0xAB81, 0x6223,
-    0x7242, 0x7242, 0x7A42, 0x9B23, 0xF543, 0xF542, 0xF502, 0xF502,
-    0x7A81, 0x2081, 0x1041, 0x1020, 0x0820, 0x0000, 0x0800, 0x0020,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0020, 0x0000, 0x0020, 0x0000, 0x0800, 0x1020, 0x1041,
-    0x1861, 0xAB61, 0xF502, 0xF502, 0xF502, 0xD462, 0x51A2, 0x6223,
-    0x6223, 0x6223, 0x6223, 0x9323, 0xF543, 0xF542, 0xF502, 0xFD22,
-    0x4121, 0x2081, 0x1841, 0x1020, 0x0820, 0x0800, 0x0020, 0x0000,
-    0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0020, 0x0000, 0x0820, 0x0800, 0x1020, 0x1841,
-    0x1861, 0x7A62, 0xF502, 0xF502, 0xF502, 0x7A81, 0x5162, 0x51C2,
-    0x59A2, 0x51C2, 0x59A2, 0x9323, 0xF563, 0xF542, 0xF502, 0xAB81,
-    0x2881, 0x2061, 0x1041, 0x1020, 0x0820, 0x0800, 0x0820, 0x0000,
-    0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0020, 0x0000, 0x0020, 0x0800, 0x0820, 0x1020, 0x1841,
-    0x1861, 0x30C2, 0xECA1, 0xF502, 0xDCC3, 0x4122, 0x4962, 0x59C2,
-    0x51A2, 0x59C2, 0x51A2, 0xAB61, 0xF563, 0xF542, 0xDCC3, 0x4122,
-    0x28A1, 0x2881, 0x1041, 0x1020, 0x0820, 0x0800, 0x0820, 0x0000,
-    0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0020, 0x0000, 0x0820, 0x0800, 0x0820, 0x1020, 0x1041,
-    0x2061, 0x2081, 0x6A21, 0xBC02, 0x69A1, 0x40E2, 0x4962, 0x4962,
-    0x5162, 0x4962, 0x5162, 0xBC02, 0xF563, 0xF503, 0x51A2, 0x30C1,
-    0x2881, 0x2081, 0x1041, 0x1020, 0x0820, 0x0800, 0x0800, 0x0020,
-    0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0020, 0x0000, 0x0020, 0x0800, 0x0800, 0x0820, 0x1020, 0x1841,
-    0x1861, 0x2081, 0x28A1, 0x30C1, 0x40E2, 0x40E2, 0x4142, 0x6201,
-    0x69A1, 0x4962, 0x4962, 0xDCC3, 0xF503, 0x7A62, 0x30E2, 0x30A1,
-    0x2881, 0x2081, 0x1841, 0x1020, 0x1020, 0x0820, 0x0820, 0x0800,
-    0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0020, 0x0000, 0x0820, 0x0800, 0x0820, 0x0820, 0x1020, 0x1841,
-    0x1861, 0x2881, 0x2881, 0x30C1, 0x38E2, 0x40E2, 0x4142, 0xBC02,
-    0x4962, 0x5162, 0x51A2, 0xE522, 0x6201, 0x40E2, 0x30E2, 0x30C1,
-    0x28A1, 0x2061, 0x1041, 0x1841, 0x1020, 0x0820, 0x0800, 0x0820,
-    0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,
-    0x0000, 0x0020, 0x0000, 0x0800, 0x0820, 0x0820, 0x1020, 0x1841,
-    0x2061, 0x2081, 0x28A1, 0x30C1, 0x30E2, 0x40E2, 0x51A2, 0xF563,
-    0x5162, 0x4122, 0x51C2, 0x5162, 0x4102, 0x40E2, 0x30C1, 0x28A1,
-    0x28A1, 0x2081, 0x2061, 0x1841, 0x1020, 0x0820, 0x0800, 0x0820,
-    0x0800, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0020, 0x0800, 0x0820, 0x0800, 0x0820, 0x1020, 0x1020, 0x1841,
-    0x1861, 0x2881, 0x28A1, 0x30C1, 0x38E2, 0x40E2, 0xAB81, 0xF582,
-    0x6223, 0x4122, 0x4122, 0x40E2, 0x4102, 0x40E2, 0x30C1, 0x28C1,
-    0x28A1, 0x2061, 0x1861, 0x1841, 0x1020, 0x1020, 0x0820, 0x0800,
-    0x0820, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0020, 0x0000, 0x0820, 0x0800, 0x0820, 0x1020, 0x1841, 0x1041,
-    0x2061, 0x2061, 0x28A1, 0x30C1, 0x30E2, 0x4122, 0xE542, 0xF582,
-    0x9B23, 0x4122, 0x4142, 0x4102, 0x40E2, 0x4102, 0x38E2, 0x28A1,
-    0x2881, 0x2081, 0x2061, 0x1841, 0x1020, 0x1020, 0x0820, 0x0820,
-    0x0800, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000,
-    0x0020, 0x0800, 0x0820, 0x0820, 0x1020, 0x1020, 0x1841, 0x2061,
-    0x1861, 0x28A1, 0x2881, 0x30C1, 0x38E2, 0x9B23, 0xF582, 0xF5A3,
-    0xE522, 0x4962, 0x4122, 0x4122, 0x40E2, 0x4102, 0x30E2, 0x28A1,
-    0x28A1, 0x2081, 0x2061, 0x1841, 0x1041, 0x1020, 0x1020, 0x0800,
-    0x0800, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000,
-    0x0020, 0x0800, 0x0800, 0x0820, 0x1020, 0x1841, 0x1041, 0x2061,
-    0x2081, 0x28A1, 0x28A1, 0x30C1, 0x38E2, 0xE522, 0xF5A2, 0xF5A2,
-    0xF5A2, 0x9B81, 0x4922, 0x4142, 0x4142, 0x40E2, 0x38E2, 0x30C1,
-    0x2881, 0x2081, 0x2081, 0x2061, 0x1841, 0x1020, 0x1020, 0x0820,
-    0x0800, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,
-    0x0800, 0x0820, 0x0820, 0x0820, 0x1020, 0x1841, 0x1841, 0x1861,
-    0x2881, 0x2881, 0x30C1, 0x38E2, 0x6221, 0xFDA2, 0xF5A2, 0xF5A2,
-    0xF5C3, 0xF5A2, 0x8B21, 0x4122, 0x4142, 0x40E2, 0x30E2, 0x30C1,
-    0x28A1, 0x28A1, 0x2081, 0x2061, 0x1841, 0x1041, 0x1020, 0x0820,
-    0x0800, 0x0800, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000,
-    0x0820, 0x0800, 0x0820, 0x1020, 0x1020, 0x1841, 0x1861, 0x2061,
-    0x28A1, 0x30A1, 0x30C1, 0x30E2, 0xBBE2, 0xF5C2, 0xF5C3, 0xF5E2,
-    0xF5E3, 0xF5E2, 0xF5E2, 0xBC02, 0x5162, 0x4942, 0x3902, 0x38E2,
-    0x30C1, 0x28A1, 0x2081, 0x1861, 0x2061, 0x1841, 0x1020, 0x0820,
-    0x0800, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000,
-    0x0020, 0x0800, 0x0820, 0x1020, 0x1841, 0x1841, 0x2061, 0x2081,
-    0x28A1, 0x30C1, 0x38E2, 0x3902, 0xE562, 0xF5C2, 0xF5E2, 0xFDE3,
-    0xF5E3, 0xF5E3, 0xF5E3, 0xF5E3, 0xDD02, 0x4962, 0x3902, 0x30E2,
-    0x30C1, 0x30A1, 0x28A1, 0x2081, 0x2061, 0x1041, 0x1020, 0x0820,
-    0x0820, 0x0800, 0x0800, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000,
-    0x0020, 0x0800, 0x0820, 0x1020, 0x1841, 0x1041, 0x2061, 0x2081,
-    0x30A1, 0x30C1, 0x30C2, 0x6201, 0xF5E2, 0xF5E2, 0xF5E2, 0xF603,
-    0xF603, 0xF5E3, 0xF603, 0xF603, 0xF602, 0xA3C3, 0x4142, 0x3902,
-    0x38E2, 0x30C1, 0x28A1, 0x2081, 0x2061, 0x1841, 0x1041, 0x1020,
-    0x0820, 0x0800, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0800, 0x0820,
-    0x0800, 0x0020, 0x0820, 0x1020, 0x1841, 0x2061, 0x2081, 0x2881,
-    0x30A1, 0x30E2, 0x3922, 0x9321, 0xF602, 0xF602, 0xFE02, 0xF603,
-    0xF603, 0xF5E3, 0xF603, 0xF603, 0xF602, 0xBCA2, 0x4122, 0x3902,
-    0x30E2, 0x30C1, 0x30A1, 0x2081, 0x2061, 0x1041, 0x1841, 0x1020,
-    0x0820, 0x0800, 0x0000, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000,
-    0x0800, 0x1020, 0x0820, 0x1020, 0x1041, 0x2061, 0x2081, 0x28A1,
-    0x30C1, 0x38E2, 0x3902, 0xAC23, 0xF603, 0xF602, 0xF603, 0xF623,
-    0xF603, 0xFE23, 0xF623, 0xF623, 0xFE02, 0x9BC3, 0x5162, 0x4142,
-    0x3902, 0x38E2, 0x9B81, 0x6221, 0x2881, 0x1861, 0x1841, 0x1020,
-    0x0820, 0x0800, 0x0820, 0x0000, 0x0820, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0820,
-    0x0800, 0x0820, 0x1020, 0x1841, 0x1041, 0x2061, 0x59C1, 0x6221,
-    0x38E2, 0x3902, 0x4142, 0xC4C2, 0xFE23, 0xF623, 0xF643, 0xF643,
-    0xFE43, 0xF643, 0xF643, 0xF622, 0xEE03, 0x6203, 0x4962, 0x4122,
-    0x3902, 0x72A2, 0xF5E2, 0x8B21, 0x2061, 0x1861, 0x1841, 0x1020,
-    0x1020, 0x0820, 0x0800, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0800,
-    0x0800, 0x0820, 0x1020, 0x1041, 0x1861, 0xAC43, 0xF5E2, 0xF5E2,
-    0xC4C2, 0x4122, 0x4122, 0xBCA2, 0xFE03, 0xF643, 0xF643, 0xF643,
-    0xFE64, 0xF664, 0xF664, 0xFE43, 0x8B83, 0x59C2, 0x51A2, 0x4962,
-    0x4122, 0x8B21, 0xFE02, 0x7282, 0x2081, 0x2061, 0x1041, 0x1020,
-    0x1020, 0x0820, 0x0820, 0x0800, 0x0020, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0800,
-    0x0820, 0x0820, 0x1020, 0x1841, 0x59C1, 0xF602, 0xF602, 0xF602,
-    0xF5E2, 0x9B81, 0x4962, 0xB443, 0xF643, 0xFE43, 0xF664, 0xF664,
-    0xF644, 0xFE64, 0xF644, 0xCD43, 0x6223, 0x6223, 0x51A2, 0x4962,
-    0x4122, 0x8323, 0xFE02, 0x51C1, 0x2881, 0x1861, 0x2061, 0x1841,
-    0x1020, 0x0820, 0x0800, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0820,
-    0x0800, 0x0820, 0x0820, 0x1021, 0x8B21, 0xF5E2, 0xF602, 0xF5E2,
-    0xFE02, 0xCD63, 0x4962, 0x8303, 0xF643, 0xFE44, 0xF664, 0xF683,
-    0xF684, 0xF684, 0xFEA4, 0xA3C3, 0x6223, 0x6223, 0x51A2, 0x59C2,
-    0x4962, 0x51A2, 0xE5A2, 0x38E2, 0x28A1, 0x2081, 0x2061, 0x1841,
-    0x1020, 0x0820, 0x0800, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0800,
-    0x1020, 0x1020, 0x1841, 0x1041, 0x9B81, 0xFE02, 0xF642, 0xF622,
-    0xF642, 0xE542, 0x4942, 0x51A2, 0xB443, 0xFE83, 0xF6A4, 0xF684,
-    0xFE84, 0xF684, 0xF684, 0xAC43, 0x6A82, 0x6203, 0x6223, 0x51A2,
-    0x5162, 0x4142, 0x3902, 0x30C1, 0x28A1, 0x2061, 0x2061, 0x1041,
-    0x1020, 0x0820, 0x0800, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0800,
-    0x0800, 0x1020, 0x1041, 0x1041, 0x9B61, 0xF622, 0xF622, 0xF622,
-    0xF642, 0xD563, 0x51A2, 0x6223, 0x72C3, 0xF684, 0xF684, 0xF6A4,
-    0xFEA4, 0xF6A4, 0xF6A4, 0xFEA4, 0xD563, 0x8323, 0x6223, 0x51C2,
-    0x4983, 0x4942, 0x3902, 0x30E2, 0x30A1, 0x2081, 0x2061, 0x1841,
-    0x1020, 0x0820, 0x0820, 0x0800, 0x0020, 0x0000, 0x0020, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0800, 0x0820,
-    0x0820, 0x1020, 0x1841, 0x1841, 0x8B21, 0xFE42, 0xCD63, 0xBCA2,
-    0xFE43, 0xAC43, 0x51A2, 0x6223, 0x9BC3, 0xFEA4, 0xFEA4, 0xF6C4,
-    0xFEE5, 0xF6C5, 0xFEC4, 0xF6C4, 0xF6A4, 0xFE84, 0xDDA2, 0xAC43,
-    0x8303, 0x4962, 0x3902, 0x38E2, 0x28A1, 0x2081, 0x2061, 0x1041,
-    0x1020, 0x0820, 0x0800, 0x0800, 0x0020, 0x0000, 0x0020, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0800, 0x0800,
-    0x0820, 0x1020, 0x1841, 0x1861, 0x6A82, 0xBCC2, 0x3902, 0x8303,
-    0xFE62, 0x8B21, 0x51A2, 0x6223, 0xCD43, 0xF6A4, 0xFEC4, 0xF6C5,
-    0xFF05, 0xF705, 0xFEE5, 0xF6C5, 0xFEC4, 0xF6A4, 0xF684, 0xFE83,
-    0xF683, 0xF643, 0xB443, 0x4142, 0x30A1, 0x28A1, 0x1861, 0x1841,
-    0x1841, 0x1020, 0x0820, 0x0820, 0x0800, 0x0020, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0820, 0x0800,
-    0x0820, 0x1020, 0x1841, 0x2061, 0x38E2, 0x30C1, 0x38E2, 0xC4C2,
-    0xEE43, 0x6201, 0x6223, 0x72C3, 0xFEA4, 0xFEC4, 0xFEE5, 0xF705,
-    0xF705, 0xFF05, 0xF705, 0xFF05, 0xFEE5, 0xF6C4, 0xF6A4, 0xF684,
-    0xFE63, 0xF683, 0xF642, 0xCD43, 0x3101, 0x2881, 0x1861, 0x1841,
-    0x1841, 0x1020, 0x0800, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0820, 0x0800,
-    0x0820, 0x1020, 0x1841, 0x1861, 0x2061, 0x28A1, 0x4122, 0xF643,
-    0xBCC2, 0x51A2, 0x6223, 0xCD43, 0xFEC4, 0xF6C5, 0xFF05, 0xF726,
-    0xFF06, 0xF726, 0xFF06, 0xF705, 0xFF05, 0xF6E5, 0xFEC4, 0xF6A4,
-    0xF683, 0xFE83, 0xF682, 0xFE62, 0x9B81, 0x2881, 0x2081, 0x2061,
-    0x1841, 0x1020, 0x0820, 0x0800, 0x0020, 0x0000, 0x0020, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0820, 0x0800,
-    0x0820, 0x1020, 0x1841, 0x2061, 0x28A1, 0x30C1, 0x8B21, 0xD563,
-    0x6223, 0x51A2, 0x8B83, 0xFEC4, 0xFEE5, 0xF705, 0xFF05, 0xF726,
-    0xFF46, 0xFF47, 0xFF46, 0xF706, 0xF705, 0xFF05, 0xFEE5, 0xF6A4,
-    0xF6A4, 0xF663, 0xF682, 0xF682, 0xE5A2, 0x28A1, 0x2061, 0x1861,
-    0x1841, 0x1020, 0x0820, 0x0800, 0x0000, 0x0020, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0820, 0x0800,
-    0x1020, 0x1020, 0x1041, 0x2061, 0x28A1, 0x38E2, 0x6223, 0x4183,
-    0x51A2, 0x6203, 0xDE02, 0xFEE5, 0xF6C5, 0xFF26, 0xF706, 0xFF46,
-    0xFF8D, 0xFFAF, 0xF746, 0xFF46, 0xFF26, 0xF705, 0xFEE5, 0xF6C4,
-    0xFEA4, 0xF6A4, 0xF683, 0xFE82, 0xFE82, 0x6221, 0x2081, 0x2061,
-    0x1841, 0x1020, 0x0820, 0x0800, 0x0820, 0x0000, 0x0020, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0800, 0x0820,
-    0x1020, 0x1041, 0x2061, 0x2081, 0x30A1, 0x30E2, 0x4942, 0x4983,
-    0x51C2, 0xD563, 0xFEE5, 0xFEE5, 0xF705, 0xFF06, 0xF746, 0xFF4A,
-    0xFFD4, 0xFFD4, 0xF78C, 0xFF46, 0xFF06, 0xF726, 0xF705, 0xFEC5,
-    0xF6C4, 0xFEA4, 0xF6A2, 0xF6C2, 0xF682, 0x9B61, 0x2061, 0x1861,
-    0x1041, 0x1020, 0x0820, 0x0800, 0x0820, 0x0000, 0x0020, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0000, 0x0800,
-    0x1020, 0x1041, 0x2061, 0x2081, 0x30C1, 0x3902, 0x4122, 0x4183,
-    0xAC43, 0xFEC5, 0xF6E5, 0xFF05, 0xF726, 0xFF46, 0xF747, 0xFFB2,
-    0xFFB5, 0xFFD5, 0xFFB4, 0xFF8D, 0xFF47, 0xF726, 0xFF05, 0xF6C5,
-    0xFEE5, 0xF6C4, 0xFEC3, 0xFEC2, 0xF682, 0xC4C2, 0x28A1, 0x1861,
-    0x1841, 0x1020, 0x0820, 0x0820, 0x0800, 0x0020, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0820, 0x0820,
-    0x1020, 0x1841, 0x2081, 0x28A1, 0x30C1, 0x3902, 0x49A3, 0xB443,
-    0xFEE4, 0xFEE5, 0xF705, 0xFF26, 0xF707, 0xFF47, 0xFFAF, 0xFFD5,
-    0xFFB5, 0xFFD5, 0xFFB5, 0xFFD5, 0xFF94, 0xFFB0, 0xF707, 0xF705,
-    0xFF05, 0xF6E5, 0xF6A4, 0xFEC3, 0xF6A2, 0xCD63, 0x2881, 0x1841,
-    0x1041, 0x1020, 0x0820, 0x0800, 0x0820, 0x0000, 0x0020, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0800, 0x0820,
-    0x1020, 0x1041, 0x20A1, 0x28A1, 0x30C2, 0x6223, 0xCD43, 0xF6C4,
-    0xFEC5, 0xF705, 0xFF26, 0xF727, 0xFF47, 0xFF4A, 0xFFB5, 0xFFD5,
-    0xFFB5, 0xFFD5, 0xFFB5, 0xFFD5, 0xF7B5, 0xFF95, 0xFFD2, 0xFF07,
-    0xF705, 0xFEE5, 0xF6C4, 0xFEC3, 0xFEC2, 0xE5A2, 0x28E1, 0x2081,
-    0x1841, 0x1020, 0x0820, 0x0820, 0x0800, 0x0020, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0820, 0x0820,
-    0x1020, 0x2061, 0x2081, 0x28E1, 0x59C1, 0xF683, 0xFEE4, 0xF6E5,
-    0xFF05, 0xF726, 0xFF07, 0xFF47, 0xF749, 0xFFB4, 0xFFD5, 0xFFB5,
-    0xFFD6, 0xFFB5, 0xFFD5, 0xFFB5, 0xFFD5, 0xFF95, 0xFF95, 0xF74E,
-    0xFF26, 0xF705, 0xFEE4, 0xF6C4, 0xF6C3, 0xE602, 0x20C1, 0x1881,
-    0x2061, 0x1041, 0x1020, 0x0800, 0x0020, 0x0000, 0x0020, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0820, 0x1020,
-    0x1841, 0x1881, 0x18C1, 0x28C1, 0xCD43, 0xF6C4, 0xFEE4, 0xF705,
-    0xFF26, 0xF707, 0xFF47, 0xF748, 0xFFB0, 0xFFB6, 0xFFB6, 0xFFD6,
-    0xFFB6, 0xFFD6, 0xFFB6, 0xFFD6, 0xFFD5, 0xFF95, 0xFFB5, 0xFF94,
-    0xF727, 0xFF05, 0xF705, 0xFF04, 0xFEC3, 0xDE03, 0x28E1, 0x18A1,
-    0x2081, 0x1841, 0x1020, 0x0820, 0x0800, 0x0020, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0820, 0x0820, 0x1020,
-    0x1841, 0x2081, 0x20C1, 0x59C1, 0xFEE3, 0xFF04, 0xF705, 0xFF26,
-    0xF707, 0xFF47, 0xFF48, 0xFF8D, 0xFFD6, 0xFFD6, 0xFFB6, 0xFFD7,
-    0xFFB7, 0xFFD7, 0xFFB7, 0xFFD6, 0xFFB6, 0xFFB6, 0xFF96, 0xFF95,
-    0xF74E, 0xF726, 0xFF05, 0xF6E4, 0xFF04, 0xCD43, 0x20C1, 0x18C1,
-    0x2081, 0x1041, 0x1020, 0x0820, 0x0800, 0x0020, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0820, 0x1020,
-    0x1080, 0x1881, 0x20C1, 0x9423, 0xFF04, 0xFEE4, 0xF705, 0xF726,
-    0xFF27, 0xFF48, 0xF74A, 0xFFB5, 0xFFD6, 0xFFB7, 0xFFD7, 0xFFB7,
-    0xFFD7, 0xFFD7, 0xFFD7, 0xFFB7, 0xFFD7, 0xFFB6, 0xFFB6, 0xFFB6,
-    0xFF94, 0xF727, 0xFF26, 0xFF05, 0xFF04, 0xB503, 0x3122, 0x28E1,
-    0x20A1, 0x1841, 0x0840, 0x0820, 0x0820, 0x0000, 0x0020, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x0820, 0x0840,
-    0x18A0, 0x20A1, 0x28E1, 0xDE03, 0xFF04, 0xF705, 0xFF26, 0xFF26,
-    0xF747, 0xFF48, 0xFFB0, 0xFFB6, 0xFFD7, 0xFFB7, 0xFFD7, 0xFFD8,
-    0xFFD8, 0xFFD8, 0xFFD7, 0xF7D7, 0xFFD7, 0xFFB7, 0xFFD6, 0xFF96,
-    0xFF95, 0xFF69, 0xF726, 0xF705, 0xFEE4, 0x8B63, 0x3101, 0x28E1,
-    0x1881, 0x1080, 0x1020, 0x0820, 0x0800, 0x0020, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0820, 0x0820, 0x0840,
-    0x1080, 0x18C1, 0x3982, 0xF703, 0xFF04, 0xF705, 0xFF26, 0xFF47,
-    0xF748, 0xFF4A, 0xFFB6, 0xFFD7, 0xFFB7, 0xFFD8, 0xFFD8, 0xFFD8,
-    0xFFD8, 0xFFD8, 0xFFD8, 0xFFD8, 0xFFD8, 0xFFD7, 0xFFB6, 0xFFD6,
-    0xFFD5, 0xFF4A, 0xFF46, 0xFF26, 0xFF25, 0x6223, 0x3921, 0x28E1,
-    0x20C1, 0x18A0, 0x0840, 0x0840, 0x0000, 0x0020, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0820, 0x0860, 0x1080,
-    0x18A0, 0x20C1, 0x62A3, 0xFF23, 0xFF44, 0xFF26, 0xF746, 0xFF48,
-    0xFF49, 0xFF8D, 0xFFD7, 0xFFD7, 0xFFD8, 0xFFD8, 0xFFD8, 0xFFD9,
-    0xFFD9, 0xFFF9, 0xFFD9, 0xFFD8, 0xFFD8, 0xFFD7, 0xFFD7, 0xFFD6,
-    0xFFB6, 0xF74C, 0xFF47, 0xFF46, 0xEEC5, 0x4183, 0x3162, 0x28C1,
-    0x18C1, 0x18A0, 0x1841, 0x0840, 0x0020, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0020, 0x0820, 0x0020, 0x0840, 0x1060,
-    0x18A0, 0x18C1, 0x7BC4, 0xF703, 0xFF44, 0xF745, 0xFF47, 0xFF48,
-    0xF749, 0xFFB0, 0xFFD7, 0xFFD8, 0xFFD8, 0xFFD9, 0xFFF9, 0xFFDA,
-    0xFFFA, 0xFFDA, 0xFFFA, 0xFFD9, 0xFFD8, 0xFFD8, 0xFFD7, 0xFFB7,
-    0xFFD6, 0xFF6A, 0xFF47, 0xFF66, 0xC5C5, 0x4983, 0x3962, 0x28E1,
-    0x20C1, 0x2081, 0x1080, 0x0820, 0x0020, 0x0020, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0840, 0x0840, 0x1080,
-    0x18A0, 0x28E1, 0x9C43, 0xFF44, 0xFF45, 0xFF46, 0xFF47, 0xFF48,
-    0xFF6A, 0xFFB0, 0xFFD7, 0xFFD8, 0xFFD9, 0xFFF9, 0xFFDA, 0xFFFB,
-    0xFFDB, 0xFFFB, 0xFFDA, 0xFFFA, 0xFFD9, 0xFFD8, 0xFFD8, 0xFFD7,
-    0xF7D4, 0xFF49, 0xFF48, 0xF746, 0xB503, 0x4183, 0x3162, 0x3122,
-    0x20C1, 0x1881, 0x1060, 0x0840, 0x0020, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0840, 0x0840, 0x1080,
-    0x1881, 0x20C1, 0xB4E3, 0xFF44, 0xF745, 0xFF46, 0xFF47, 0xFF69,
-    0xF74A, 0xFFB0, 0xFFD8, 0xFFD8, 0xFFF9, 0xFFDA, 0xFFDB, 0xFFFC,
-    0xFFDC, 0xFFFC, 0xFFFB, 0xFFDB, 0xFFFA, 0xFFD9, 0xFFD8, 0xFFD7,
-    0xFFD2, 0xFF89, 0xFF48, 0xFF67, 0x9465, 0x49E3, 0x3962, 0x2922,
-    0x20C1, 0x2081, 0x1080, 0x0820, 0x0840, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0020, 0x0820, 0x0840, 0x0840, 0x1080,
-    0x20C1, 0x2901, 0xB503, 0xFF44, 0xFF45, 0xFF46, 0xFF48, 0xFF89,
-    0xFFAB, 0xFFB0, 0xFFD8, 0xFFD9, 0xFFFA, 0xFFDB, 0xFFFC, 0xFFFD,
-    0xFFFD, 0xFFFD, 0xFFFD, 0xFFDB, 0xFFFA, 0xFFD9, 0xFFD8, 0xFFD8,
-    0xF7D2, 0xFF8A, 0xFF88, 0xF747, 0x9465, 0x41E3, 0x3162, 0x3122,
-    0x18C1, 0x2081, 0x1060, 0x0840, 0x0840, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0840, 0x0840, 0x1060,
-    0x20C1, 0x20E1, 0x9CC4, 0xFF44, 0xF765, 0xFF66, 0xFF88, 0xF789,
-    0xFFAB, 0xFFB0, 0xFFD8, 0xFFD9, 0xFFFA, 0xFFDB, 0xFFFD, 0xFFFE,
-    0xFFFE, 0xFFFE, 0xFFFD, 0xFFFC, 0xFFDB, 0xFFFA, 0xFFD8, 0xFFD8,
-    0xFFB2, 0xFFAA, 0xFF89, 0xFFA8, 0xA4C4, 0x49E3, 0x3962, 0x2922,
-    0x20C1, 0x18A0, 0x1060, 0x0840, 0x0020, 0x0020, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0840, 0x0840, 0x1080,
-    0x20C1, 0x2901, 0x9C43, 0xFF44, 0xFF65, 0xFF86, 0xFF88, 0xFF89,
-    0xF78B, 0xFFAF, 0xFFD8, 0xFFF9, 0xFFDA, 0xFFFC, 0xFFFD, 0xFFFE,
-    0xFFFE, 0xFFFE, 0xFFFD, 0xFFFC, 0xFFDB, 0xFFDA, 0xFFD8, 0xFFD8,
-    0xFFD4, 0xFF8A, 0xF789, 0xFF88, 0xDE45, 0x41E3, 0x3162, 0x3122,
-    0x18C1, 0x18A0, 0x1060, 0x0840, 0x0020, 0x0020, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0840, 0x0840, 0x1080,
-    0x20C1, 0x20E1, 0x6B64, 0xFF65, 0xFF65, 0xF766, 0xF788, 0xFFAA,
-    0xFF8B, 0xFF8D, 0xFFD8, 0xFFF9, 0xFFDA, 0xFFDC, 0xFFFD, 0xFFFE,
-    0xFFFE, 0xFFFE, 0xFFFD, 0xFFFC, 0xFFFB, 0xFFDA, 0xFFD8, 0xFFD8,
-    0xFFD6, 0xFF8B, 0xFF89, 0xFF88, 0xFF86, 0xA4C4, 0x3962, 0x2922,
-    0x20C1, 0x18A0, 0x1080, 0x0840, 0x0820, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0840, 0x0840, 0x1080,
-    0x20C1, 0x2901, 0x5262, 0xFF85, 0xFF86, 0xFF87, 0xFF88, 0xFF8A,
-    0xFFAB, 0xFFAD, 0xFFD8, 0xFFF9, 0xFFDA, 0xFFFB, 0xFFFC, 0xFFFD,
-    0xFFFE, 0xFFFD, 0xFFFD, 0xFFDC, 0xFFDB, 0xFFFA, 0xFFD8, 0xFFD8,
-    0xFFD7, 0xF78D, 0xFF89, 0xFF88, 0xF766, 0xFF65, 0x6303, 0x2101,
-    0x20C1, 0x10A0, 0x1060, 0x0840, 0x0020, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0840, 0x0840, 0x1080,
-    0x1080, 0x18C1, 0x3162, 0xFF65, 0xFF66, 0xFF87, 0xF788, 0xFFAA,
-    0xFF8B, 0xF7CD, 0xFFD8, 0xFFD8, 0xFFDA, 0xFFFB, 0xFFDB, 0xFFDC,
-    0xFFFD, 0xFFFD, 0xFFFC, 0xFFFB, 0xFFDA, 0xFFF9, 0xFFD8, 0xFFD8,
-    0xFFF7, 0xFFB0, 0xFF89, 0xFF88, 0xFF66, 0xFF86, 0x9C43, 0x2901,
-    0x18C1, 0x18A0, 0x1080, 0x0840, 0x0820, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x0840, 0x0840, 0x1080,
-    0x18A0, 0x20C1, 0x2101, 0xEEC5, 0xFF86, 0xFF87, 0xFF88, 0xFF89,
-    0xFF8B, 0xF78D, 0xFFD7, 0xFFD8, 0xFFF9, 0xFFDA, 0xFFFB, 0xFFDB,
-    0xFFFB, 0xFFDB, 0xFFFB, 0xFFDA, 0xFFF9, 0xFFD8, 0xFFD8, 0xFFF7,
-    0xFFD7, 0xFFB5, 0xFF8B, 0xF788, 0xFF86, 0xFF66, 0x9CC4, 0x20E1,
-    0x20C1, 0x10A0, 0x0840, 0x0840, 0x0020, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x0840, 0x1080,
-    0x1080, 0x18C1, 0x20E1, 0xCE26, 0xF786, 0xFF87, 0xFF88, 0xF789,
-    0xFF8B, 0xFFAF, 0xFFD7, 0xFFD8, 0xFFD8, 0xFFF9, 0xFFDA, 0xFFFA,
-    0xFFDB, 0xFFFA, 0xFFDA, 0xFFFA, 0xFFD9, 0xFFD8, 0xFFD8, 0xFFD7,
-    0xFFD6, 0xFFB6, 0xFFD4, 0xFF89, 0xFF86, 0xFF86, 0xA4C4, 0x2101,
-    0x2081, 0x1080, 0x1060, 0x0020, 0x0820, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0840, 0x0840,
-    0x18A0, 0x20C1, 0x2901, 0xB565, 0xFF86, 0xFF87, 0xFF88, 0xFF89,
-    0xFFAA, 0xFFB2, 0xF7D7, 0xFFD8, 0xFFD8, 0xFFF9, 0xFFD9, 0xFFF9,
-    0xFFDA, 0xFFFA, 0xFFD9, 0xFFF9, 0xFFD8, 0xFFD8, 0xFFD7, 0xFFD7,
-    0xFFB6, 0xFFD6, 0xFFB5, 0xFF8C, 0xF766, 0xFF86, 0x9423, 0x18C1,
-    0x1880, 0x1080, 0x0840, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0840, 0x0840,
-    0x1060, 0x10A0, 0x18A1, 0xA4C4, 0xF766, 0xFF87, 0xFF88, 0xF789,
-    0xFF8B, 0xFFD6, 0xFFD7, 0xFFD7, 0xFFD8, 0xFFD8, 0xFFD8, 0xFFF9,
-    0xFFD9, 0xFFD8, 0xFFD8, 0xFFF8, 0xFFD8, 0xFFD7, 0xFFD7, 0xFFB7,
-    0xFFD6, 0xFFB6, 0xFFD5, 0xFF8D, 0xFFA7, 0xFF86, 0x83C4, 0x20C1,
-    0x18A0, 0x1080, 0x0840, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0820, 0x0020, 0x0840,
-    0x1080, 0x18A0, 0x20C1, 0x9C43, 0xFF86, 0xFF87, 0xFF88, 0xFF88,
-    0xFFCD, 0xFFD6, 0xFFB6, 0xFFD7, 0xFFD7, 0xFFD8, 0xFFD8, 0xFFD8,
-    0xFFF8, 0xFFD8, 0xFFD8, 0xFFD8, 0xFFD7, 0xF7D7, 0xFFD7, 0xFFB6,
-    0xFFD6, 0xFFD5, 0xFFD5, 0xFF8C, 0xFF87, 0xF766, 0x5AA3, 0x1881,
-    0x1060, 0x0840, 0x0840, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0840,
-    0x0840, 0x0880, 0x1080, 0x7364, 0xFF86, 0xFF87, 0xF787, 0xFF88,
-    0xFFB0, 0xFFD6, 0xFFB6, 0xFFD6, 0xFFD7, 0xF7D7, 0xFFD7, 0xFFD7,
-    0xFFD7, 0xFFD7, 0xFFD7, 0xFFD7, 0xFFD7, 0xFFB7, 0xFFD6, 0xFFD6,
-    0xFFD6, 0xFFB5, 0xFFD5, 0xFF89, 0xFFA7, 0xFF86, 0x3162, 0x18A0,
-    0x1080, 0x1040, 0x0020, 0x0820, 0x0020, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x0840,
-    0x0840, 0x1080, 0x18A0, 0x62A3, 0xFF86, 0xFFA7, 0xFF87, 0xFF88,
-    0xFFB0, 0xFFD6, 0xFFB6, 0xFFD6, 0xFFB6, 0xFFD7, 0xFFD7, 0xFFD7,
-    0xF7D7, 0xFFD7, 0xFFD7, 0xFFF7, 0xF7D7, 0xFFD6, 0xFFD6, 0xFFF6,
-    0xFFD6, 0xFFB5, 0xFFB2, 0xFF87, 0xF787, 0xE6C6, 0x1881, 0x10A0,
-    0x0840, 0x0840, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,
-    0x0840, 0x0840, 0x0860, 0x39C2, 0xFF87, 0xF787, 0xFF87, 0xFF88,
-    0xFFB0, 0xFFD5, 0xFFB6, 0xFFD6, 0xFFB6, 0xFFD6, 0xFFD6, 0xFFD7,
-    0xFFD7, 0xFFD7, 0xFFD7, 0xFFD6, 0xFFD6, 0xFFD6, 0xFFB6, 0xFFD6,
-    0xFFB5, 0xFFD5, 0xFFCD, 0xFF87, 0xFF87, 0xA4C4, 0x18A0, 0x1080,
-    0x0840, 0x0840, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0820,
-    0x0020, 0x1040, 0x1080, 0x20C1, 0xFF86, 0xFF87, 0xFF87, 0xFFA7,
-    0xFFAF, 0xFFD5, 0xFFD5, 0xFFB6, 0xFFD6, 0xFFB6, 0xFFD6, 0xFFD6,
-    0xFFD6, 0xFFF6, 0xFFD6, 0xFFD6, 0xFFD6, 0xFFB6, 0xFFD6, 0xFFB5,
-    0xFFD5, 0xF7B4, 0xFF88, 0xFF87, 0xF787, 0x4A42, 0x1060, 0x0840,
-    0x0840, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,
-    0x0020, 0x0820, 0x0840, 0x0860, 0xC626, 0xFF87, 0xF7A7, 0xFFA7,
-    0xFFAB, 0xFFD6, 0xFFB5, 0xFFD6, 0xFFD6, 0xFFD6, 0xFFF6, 0xFFD6,
-    0xFFF6, 0xFFD6, 0xFFF6, 0xFFD6, 0xFFD6, 0xFFD5, 0xFFB5, 0xFFD5,
-    0xFFD5, 0xFFAD, 0xFFA7, 0xFFA7, 0xEEC6, 0x18A0, 0x1080, 0x0840,
-    0x0840, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0820, 0x0020, 0x0840, 0x0840, 0x9C65, 0xFFC7, 0xFFA7, 0xFFA7,
-    0xFFA8, 0xFFD4, 0xFFD6, 0xFFD5, 0xFFD6, 0xFFB6, 0xFFD5, 0xFFB2,
-    0xFFD4, 0xFFD6, 0xFFD6, 0xFFD6, 0xFFD6, 0xFFB6, 0xFFD6, 0xFFF6,
-    0xF7D4, 0xFFA8, 0xFFA7, 0xFFA7, 0x9423, 0x0860, 0x0840, 0x0020,
-    0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0020, 0x0800, 0x0020, 0x0840, 0x41E3, 0xFFA7, 0xF7A7, 0xFFA7,
-    0xFFA7, 0xFFAF, 0xFFF6, 0xFFD6, 0xFFD6, 0xFFD5, 0xF7AD, 0xFFC9,
-    0xFFAA, 0xFFB2, 0xFFB6, 0xFFD6, 0xFFB6, 0xFFD6, 0xFFB5, 0xFFD5,
-    0xFFCB, 0xFFA7, 0xFFC7, 0xF767, 0x2901, 0x0840, 0x0840, 0x0020,
-    0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0020, 0x0020, 0x0840, 0x0840, 0xEEE6, 0xFFA7, 0xFFA7,
-    0xFFA7, 0xFFC9, 0xFFD4, 0xFFD6, 0xFFD5, 0xF7B0, 0xFFA8, 0xEF48,
-    0xF788, 0xFFCB, 0xFFD4, 0xFFD6, 0xFFF6, 0xFFD6, 0xFFD5, 0xFFAF,
-    0xF7A8, 0xFFA7, 0xFFA7, 0x6B64, 0x0840, 0x0820, 0x0820, 0x0000,
-    0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x7364, 0xFFA7, 0xF7A7,
-    0xFFA7, 0xFFA8, 0xFFAF, 0xFFF6, 0xFFB2, 0xFFA9, 0xFFC9, 0x5AA3,
-    0xA4A4, 0xFFC9, 0xFFAC, 0xFFD5, 0xFFD5, 0xFFD6, 0xFFAF, 0xFFA8,
-    0xFFA8, 0xFFC8, 0x9465, 0x1080, 0x0840, 0x0840, 0x0000, 0x0020,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0020, 0x0020, 0x0020, 0x1040, 0xCE46, 0xFFA7,
-    0xFFA8, 0xFFA8, 0xFFA8, 0xFFCC, 0xFFC9, 0xFFA8, 0xC606, 0x20C1,
-    0x49E3, 0xFFC9, 0xFFC9, 0xFFCD, 0xFFB2, 0xFFCD, 0xFFA8, 0xF7A8,
-    0xFFA8, 0x9CA4, 0x0820, 0x0800, 0x0840, 0x0020, 0x0820, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x3182, 0xEF47,
-    0xFFA8, 0xFFA8, 0xFFA8, 0xFFA8, 0xFFA8, 0xFFC8, 0x83C4, 0x18C1,
-    0x18A1, 0xDEC8, 0xFFA8, 0xFFA8, 0xFFA8, 0xFFA8, 0xFFA8, 0xFFC8,
-    0x9465, 0x1060, 0x1020, 0x0840, 0x0820, 0x0020, 0x0000, 0x0020,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0840, 0x4182,
-    0xEF48, 0xFFC9, 0xFFC9, 0xFFA9, 0xFFC9, 0xFFA9, 0x2942, 0x1881,
-    0x2081, 0x9465, 0xFFC9, 0xFFC9, 0xFFC9, 0xFFC9, 0xF788, 0x7364,
-    0x0040, 0x0820, 0x0820, 0x0020, 0x0800, 0x0020, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0000, 0x0020,
-    0x2902, 0xC5A5, 0xFFC9, 0xFFC9, 0xFFC9, 0xCE26, 0x1041, 0x1841,
-    0x1021, 0x2902, 0xEF68, 0xFFC9, 0xFFC9, 0xCDC5, 0x39A2, 0x1020,
-    0x0820, 0x0020, 0x0820, 0x0000, 0x0020, 0x0000, 0x0020, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0800,
-    0x0820, 0x0020, 0x5262, 0xBD65, 0xDEC8, 0x5AA3, 0x1020, 0x1020,
-    0x1020, 0x1020, 0x41E2, 0x9465, 0x41C2, 0x0820, 0x0820, 0x0800,
-    0x0020, 0x0020, 0x0000, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000,
-    0x0020, 0x0000, 0x0820, 0x0800, 0x0820, 0x0820, 0x1020, 0x0820,
-    0x0820, 0x0820, 0x1020, 0x0820, 0x0820, 0x0820, 0x0800, 0x0020,
-    0x0800, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020,
-    0x0000, 0x0020, 0x0000, 0x0820, 0x0800, 0x0820, 0x0000, 0x0820,
-    0x0800, 0x0820, 0x0000, 0x0820, 0x0000, 0x0820, 0x0000, 0x0820,
-    0x0000, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,
-    0x0000, 0x0020, 0x0000, 0x0020, 0x0800, 0x0020, 0x0800, 0x0020,
-    0x0800, 0x0020, 0x0800, 0x0020, 0x0800, 0x0820, 0x0000, 0x0020,
-    0x0000, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0020, 0x0000, 0x0020, 0x0800, 0x0020, 0x0000, 0x0020, 0x0800,
-    0x0820, 0x0000, 0x0820, 0x0000, 0x0020, 0x0000, 0x0020, 0x0800,
-    0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0800, 0x0020, 0x0000,
-    0x0020, 0x0800, 0x0020, 0x0000, 0x0020, 0x0000, 0x0020, 0x0000,
-    0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0000, 0x0020, 0x0000,
-    0x0020, 0x0000, 0x0020, 0x0000, 0x0020, 0x0000, 0x0020, 0x0000,
-    0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0000, 0x0020, 0x0000,
-    0x0020, 0x0000, 0x0020, 0x0000, 0x0020, 0x0000, 0x0020, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000,
-    0x0020, 0x0000, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 },
-  { 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,
-    0x0000, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020,
-    0x0000, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0000, 0x0020,
-    0x0000, 0x0820, 0x0000, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0020, 0x0000, 0x0020, 0x0000, 0x0820, 0x0000, 0x0020,
-    0x0800, 0x0820, 0x0000, 0x0820, 0x0800, 0x0020, 0x0000, 0x0020,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0020, 0x0000, 0x0820, 0x0800, 0x0820, 0x0800,
-    0x0820, 0x0000, 0x0820, 0x0800, 0x0020, 0x0800, 0x0020, 0x0000,
-    0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0020, 0x0000, 0x0820, 0x0800, 0x1020, 0x0820,
-    0x0820, 0x0820, 0x0820, 0x0820, 0x0800, 0x0820, 0x0000, 0x0020,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,
-    0x0000, 0x0020, 0x0800, 0x0820, 0x0800, 0x0820, 0x0820, 0x1020,
-    0x0820, 0x0820, 0x0820, 0x1020, 0x0820, 0x0820, 0x0800, 0x0020,
-    0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0020, 0x0800, 0x0820, 0x0820, 0x0820, 0x1020, 0x1020, 0x1020,
-    0x1020, 0x1020, 0x1020, 0x1020, 0x0820, 0x0820, 0x0800, 0x0820,
-    0x0800, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000,
-    0x0820, 0x0800, 0x0820, 0x0820, 0x1020, 0x1020, 0x1041, 0x1841,
-    0x1841, 0x1841, 0x1041, 0x1841, 0x1020, 0x1020, 0x0820, 0x0800,
-    0x0820, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000,
-    0x0820, 0x0800, 0x0820, 0x1020, 0x1041, 0x1841, 0x1841, 0x1861,
-    0x2061, 0x2061, 0x1041, 0x1841, 0x1841, 0x1020, 0x1020, 0x0820,
-    0x0820, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820,
-    0x0800, 0x0820, 0x1020, 0x1841, 0x1841, 0x1861, 0x2061, 0x2081,
-    0x2081, 0x2861, 0x1861, 0x2061, 0x1841, 0x1041, 0x1020, 0x0820,
-    0x0800, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0800,
-    0x0820, 0x1020, 0x1020, 0x1041, 0x2061, 0x2061, 0x2081, 0x2881,
-    0x28A1, 0x2881, 0x2081, 0x28A1, 0x2061, 0x1841, 0x1841, 0x1020,
-    0x0820, 0x0800, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0800,
-    0x0820, 0x1020, 0x1841, 0x2061, 0x2081, 0x28A1, 0x2881, 0x30A1,
-    0x28C1, 0x5141, 0xB282, 0x5141, 0x2081, 0x1861, 0x1841, 0x1841,
-    0x1020, 0x0800, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0800,
-    0x1020, 0x1041, 0x2061, 0x2081, 0x28A1, 0x28A1, 0x30C1, 0x30E2,
-    0xAA62, 0xE383, 0xEB83, 0x38E2, 0x28A1, 0x2081, 0x2061, 0x1841,
-    0x1020, 0x0820, 0x0800, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0800, 0x0820,
-    0x1020, 0x1841, 0x2061, 0x2081, 0x28A1, 0x30C1, 0x3902, 0xBB22,
-    0xEBE3, 0xE3C3, 0xE383, 0x4142, 0x28A1, 0x28A1, 0x1861, 0x1841,
-    0x1041, 0x1020, 0x0800, 0x0800, 0x0020, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0800, 0x1020,
-    0x1020, 0x2061, 0x2061, 0x28A1, 0x30C1, 0x30E2, 0x8A82, 0xE3C3,
-    0xEBE3, 0xE3C3, 0xEBE3, 0x69C1, 0x38E2, 0x28A1, 0x2881, 0x1861,
-    0x1841, 0x1020, 0x0820, 0x0800, 0x0020, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0800, 0x0820, 0x1020,
-    0x1041, 0x2061, 0x2081, 0x30A1, 0x30E2, 0x5162, 0xEBE3, 0xEC24,
-    0xEC24, 0xE424, 0xEC24, 0x8A82, 0x3902, 0x28C1, 0x28A1, 0x2061,
-    0x1841, 0x1020, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0800, 0x0820, 0x1020,
-    0x1041, 0x2081, 0x2881, 0x30E2, 0x3902, 0xB322, 0xE424, 0xEC24,
-    0xEC24, 0xEC24, 0xEC24, 0xCBA2, 0x4142, 0x38E2, 0x28A1, 0x2081,
-    0x2061, 0x1841, 0x0820, 0x0820, 0x0800, 0x0020, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x0820, 0x1841,
-    0x2061, 0x2081, 0x30A1, 0x38E2, 0x6221, 0xEC24, 0xEC24, 0xEC84,
-    0xEC84, 0xEC84, 0xEC24, 0xE424, 0x51A2, 0x3902, 0x30C1, 0x28A1,
-    0x1861, 0x1841, 0x1020, 0x0800, 0x0020, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0800, 0x1020, 0x1841,
-    0x1861, 0x2881, 0x30C1, 0x3102, 0xCBA2, 0xEC24, 0xEC84, 0xEC84,
-    0xEC84, 0xEC84, 0xEC84, 0xEC63, 0x9282, 0x4942, 0x38E2, 0x2881,
-    0x2081, 0x1841, 0x1020, 0x0820, 0x0820, 0x0000, 0x0020, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0020, 0x0800, 0x0820, 0x1020, 0x1041,
-    0x2061, 0x28A1, 0x38E2, 0x7A42, 0xEC24, 0xEC84, 0xEC84, 0xECE4,
-    0xECE4, 0xF4C4, 0xECE4, 0xEC84, 0xCB82, 0x4122, 0x3902, 0x28A1,
-    0x2081, 0x1041, 0x1020, 0x0820, 0x0800, 0x0020, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0800, 0x1020, 0x1041,
-    0x2081, 0x28A1, 0x3902, 0xCB82, 0xEC63, 0xEC84, 0xECE4, 0xED25,
-    0xF505, 0xED05, 0xECE4, 0xF4E4, 0xEC63, 0x59C2, 0x4102, 0x30C1,
-    0x2081, 0x2061, 0x1020, 0x0820, 0x0820, 0x0000, 0x0020, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0020, 0x0800, 0x0820, 0x1020, 0x1841,
-    0x2881, 0x30C1, 0x69A1, 0xEC44, 0xEC84, 0xECE4, 0xF505, 0xED44,
-    0xF544, 0xED44, 0xF525, 0xECE4, 0xEC84, 0x7242, 0x4122, 0x30C2,
-    0x28A1, 0x2061, 0x1041, 0x0820, 0x0800, 0x0000, 0x0020, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0020, 0x0800, 0x0820, 0x1020, 0x1861,
-    0x2061, 0x30C1, 0x8A62, 0xEC63, 0xEC84, 0xECE4, 0xF544, 0xEDA6,
-    0xF5C4, 0xF5A6, 0xF544, 0xF525, 0xEC84, 0x9B23, 0x4142, 0x38E2,
-    0x28A1, 0x2061, 0x1841, 0x0820, 0x0800, 0x0020, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0020, 0x0000, 0x0820, 0x0820, 0x1841, 0x2061,
-    0x28A1, 0x30C1, 0xB322, 0xEC63, 0xF4E4, 0xED05, 0xF544, 0xF5C4,
-    0xF605, 0xF605, 0xED84, 0xED05, 0xECE4, 0xCB82, 0x4122, 0x30E2,
-    0x2881, 0x1861, 0x1841, 0x1020, 0x0800, 0x0020, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0020, 0x0000, 0x0800, 0x0820, 0x1841, 0x1861,
-    0x28A1, 0x30C2, 0xB322, 0xEC84, 0xECE4, 0xED05, 0xF5C4, 0xF5E5,
-    0xF645, 0xF5E5, 0xF5C4, 0xF544, 0xF4E4, 0xEC44, 0x4142, 0x38E2,
-    0x28A1, 0x2061, 0x1841, 0x1020, 0x0820, 0x0000, 0x0020, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0020, 0x0800, 0x0820, 0x1841, 0x2061,
-    0x28A1, 0x38E2, 0x9282, 0xECA4, 0xECE4, 0xF544, 0xF5C4, 0xF645,
-    0xF685, 0xF625, 0xF5C4, 0xF544, 0xECC4, 0xECC2, 0x51A2, 0x30C2,
-    0x30A1, 0x1861, 0x1841, 0x1020, 0x0820, 0x0000, 0x0020, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0020, 0x0000, 0x0800, 0x0820, 0x1841, 0x1861,
-    0x28A1, 0x30C2, 0x51A2, 0xEC84, 0xECE4, 0xF544, 0xF5A4, 0xF645,
-    0xF685, 0xF666, 0xF5C4, 0xF544, 0xF503, 0xF4C2, 0x6221, 0x38E2,
-    0x30C1, 0x1861, 0x1841, 0x0820, 0x0800, 0x0820, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0020, 0x0800, 0x0820, 0x1841, 0x2061,
-    0x28A1, 0x38E2, 0x4142, 0x9B23, 0xF4E4, 0xF544, 0xCCA4, 0x9CA4,
-    0xC5A5, 0xF645, 0xF5C4, 0xF544, 0xED03, 0xF4C2, 0x6201, 0x30C2,
-    0x28A1, 0x1861, 0x1841, 0x1020, 0x0820, 0x0000, 0x0020, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0020, 0x0800, 0x0820, 0x1841, 0x1861,
-    0x2881, 0x30C1, 0x4142, 0x51A2, 0xBBE2, 0xCCA4, 0x8B83, 0x9423,
-    0xA4C4, 0xDD85, 0xF5C4, 0xF564, 0xED03, 0xF4C2, 0x69A1, 0x38E2,
-    0x28A1, 0x2061, 0x1841, 0x1020, 0x0800, 0x0020, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0020, 0x0000, 0x0820, 0x0820, 0x1020, 0x2061,
-    0x28A1, 0x30C1, 0x3902, 0x5162, 0x6223, 0x7AC3, 0x8323, 0x8B83,
-    0x9C43, 0xAC43, 0xF583, 0xF544, 0xED03, 0xF4C2, 0x4942, 0x30E2,
-    0x2881, 0x1861, 0x1841, 0x0820, 0x0800, 0x0020, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0020, 0x0800, 0x0820, 0x1020, 0x1841,
-    0x2081, 0x30C1, 0x3902, 0x4962, 0x59A2, 0x6284, 0x72C3, 0x8B83,
-    0x8B83, 0x9BC3, 0xF583, 0xF543, 0xF503, 0xD462, 0x4122, 0x38E2,
-    0x28A1, 0x2061, 0x1841, 0x0820, 0x0820, 0x0000, 0x0020, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0020, 0x0000, 0x0820, 0x0820, 0x1020, 0x1841,
-    0x2081, 0x30A1, 0x3902, 0x5162, 0x51C2, 0x6223, 0x7AC3, 0x8323,
-    0x8323, 0x8303, 0xF544, 0xF503, 0xED03, 0x9323, 0x3902, 0x30C1,
-    0x2081, 0x2061, 0x1020, 0x0820, 0x0000, 0x0000, 0x0020, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0020, 0x0800, 0x0820, 0x1020, 0x1041,
-    0x2081, 0x30A1, 0x38E2, 0x4122, 0x51A2, 0x6223, 0x6223, 0x7AC3,
-    0x72C3, 0x72C3, 0xD4C3, 0xF503, 0xECA2, 0x5162, 0x3922, 0x30A1,
-    0x2081, 0x1841, 0x1020, 0x0820, 0x0800, 0x0020, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x0800, 0x1020, 0x1841,
-    0x1861, 0x28A1, 0x38E2, 0x3902, 0x5162, 0x59C2, 0x6223, 0x6223,
-    0x6284, 0x6223, 0xBC02, 0xECA2, 0x6223, 0x4122, 0x30E2, 0x30A1,
-    0x2081, 0x1841, 0x1020, 0x0820, 0x0000, 0x0000, 0x0020, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0800, 0x1020, 0x1841,
-    0x1861, 0x28A1, 0x30A1, 0x4962, 0x9323, 0xD462, 0x9B23, 0x6223,
-    0x6223, 0x6223, 0x6223, 0x6221, 0x5162, 0x3902, 0x30C1, 0x28A1,
-    0x2061, 0x1841, 0x1020, 0x0800, 0x0820, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0020, 0x0800, 0x0820, 0x1020, 0x1041,
-    0x2061, 0x28A1, 0x9282, 0xECA1, 0xF4C2, 0xECA2, 0xC401, 0x51A2,
-    0x51A2, 0x59C2, 0x51A2, 0x5162, 0x4142, 0x38E2, 0x30C1, 0x2061,
-    0x1861, 0x1841, 0x1020, 0x0800, 0x0020, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0020, 0x0800, 0x0800, 0x1020, 0x1041,
-    0x30E2, 0xC382, 0xEC81, 0xE4A1, 0xF4A2, 0xECC2, 0xECA2, 0x5162,
-    0x51C2, 0x5162, 0x4962, 0x4142, 0x40E2, 0x38E2, 0x30A1, 0x2081,
-    0x2061, 0x1020, 0x0820, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0020, 0x0000, 0x0820, 0x0800, 0x0820, 0x1861,
-    0xCC21, 0xEC61, 0xEC61, 0xECA1, 0xF4C2, 0xECA2, 0xE482, 0x4962,
-    0x4962, 0x5162, 0x4122, 0x4142, 0x38E2, 0x30C1, 0x2881, 0x2081,
-    0x1041, 0x1020, 0x0820, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0020, 0x0000, 0x0020, 0x0800, 0x0000, 0x0820, 0x7201,
-    0xEC61, 0xEC61, 0xECC1, 0xF4C1, 0xECC1, 0xF4C2, 0xB381, 0x4122,
-    0x4942, 0x4122, 0x4142, 0x4102, 0x38E2, 0x28A1, 0x2881, 0x1861,
-    0x1841, 0x1020, 0x0820, 0x0800, 0x0020, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0020, 0x0000, 0x0820, 0x0800, 0x0820, 0x1020, 0xB381,
-    0xEC61, 0xF4C1, 0xF646, 0xECC1, 0xF4C1, 0x9AE1, 0x38E2, 0x40E2,
-    0x3902, 0x40E2, 0x4102, 0x30E2, 0x30C1, 0x28A1, 0x2061, 0x2061,
-    0x1841, 0x1020, 0x0820, 0x0800, 0x0020, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0020, 0x0000, 0x0020, 0x0000, 0x0800, 0x0820, 0x0820, 0xAB61,
-    0xECA1, 0xF583, 0xF646, 0xF5C4, 0xF4C1, 0x7AA1, 0x4102, 0x40E2,
-    0x4102, 0x40E2, 0x38E2, 0x30C1, 0x28A1, 0x28A1, 0x2081, 0x2061,
-    0x1841, 0x1020, 0x0820, 0x0800, 0x0020, 0x0000, 0x0020, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0020, 0x0000, 0x0820, 0x0800, 0x0820, 0x0820, 0x1020, 0x69C1,
-    0xECA1, 0xFE05, 0xF646, 0xF646, 0xF4C1, 0x9AE1, 0x30C2, 0x30E2,
-    0x40E2, 0x30E2, 0x38E2, 0x30C1, 0x30C1, 0x2081, 0x1861, 0x1841,
-    0x1841, 0x1020, 0x0820, 0x0800, 0x0000, 0x0020, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,
-    0x0000, 0x0020, 0x0800, 0x0800, 0x0820, 0x0820, 0x1020, 0x1841,
-    0xE4A1, 0xF5E5, 0xFEC7, 0xF5C4, 0xF4C1, 0xD462, 0x38E2, 0x38E2,
-    0x30E2, 0x38E2, 0x30C1, 0x30A1, 0x2881, 0x2081, 0x2061, 0x1841,
-    0x1020, 0x1020, 0x0820, 0x0820, 0x0000, 0x0020, 0x0000, 0x0020,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000,
-    0x0820, 0x0000, 0x0820, 0x0820, 0x0820, 0x1020, 0x1020, 0x1841,
-    0xB381, 0xF502, 0xF5C4, 0xF502, 0xF502, 0xF4C1, 0x4962, 0x30E2,
-    0x30E2, 0x30C1, 0x30C1, 0x30A1, 0x28A1, 0x2061, 0x2061, 0x1041,
-    0x1020, 0x1020, 0x0820, 0x0800, 0x0820, 0x0000, 0x0020, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,
-    0x0800, 0x0020, 0x0800, 0x0820, 0x1020, 0x1020, 0x1041, 0x1041,
-    0x6201, 0xF4C1, 0xF4C1, 0xF502, 0xF502, 0xBC02, 0x7A21, 0x38E2,
-    0x38E2, 0x30C1, 0x30C1, 0x28A1, 0x2881, 0x2881, 0x1861, 0x1841,
-    0x1841, 0x1020, 0x0820, 0x0820, 0x0800, 0x0020, 0x0000, 0x0020,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020,
-    0x0800, 0x0820, 0x0820, 0x0820, 0x1020, 0x1020, 0x1841, 0x2061,
-    0x28A1, 0xECA1, 0xF502, 0xF502, 0xD442, 0x30C2, 0x30E2, 0x38E2,
-    0x30E2, 0x30C1, 0x30C1, 0x30A1, 0x28A1, 0x2081, 0x2061, 0x1861,
-    0x1841, 0x1020, 0x0820, 0x0800, 0x0800, 0x0020, 0x0000, 0x0020,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0000,
-    0x0820, 0x0800, 0x0820, 0x1020, 0x1020, 0x1841, 0x1841, 0x1861,
-    0x2061, 0x7A81, 0xF521, 0xF521, 0x7A42, 0x38E2, 0x30E2, 0x38E2,
-    0x38E2, 0x30C1, 0x30C1, 0x30A1, 0x28A1, 0x2061, 0x2081, 0x2061,
-    0x1041, 0x1020, 0x1020, 0x0820, 0x0820, 0x0800, 0x0820, 0x0000,
-    0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0820,
-    0x0800, 0x0820, 0x0820, 0x1020, 0x1841, 0x1841, 0x2061, 0x2081,
-    0x2081, 0x30A1, 0xBC02, 0xBC02, 0x30C2, 0x38E2, 0x38E2, 0x38E2,
-    0x30E2, 0x40E2, 0x30C1, 0x30C1, 0x30C1, 0x28A1, 0x2061, 0x1861,
-    0x1841, 0x1841, 0x1020, 0x0820, 0x0820, 0x0800, 0x0820, 0x0000,
-    0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0820,
-    0x0800, 0x0820, 0x1020, 0x1841, 0x1041, 0x2061, 0x2061, 0x2081,
-    0x28A1, 0x30A1, 0x30C1, 0x38E2, 0x30E2, 0x4102, 0x40E2, 0x3902,
-    0x40E2, 0x8281, 0xB381, 0x3922, 0x28A1, 0x2881, 0x2081, 0x2061,
-    0x2061, 0x1841, 0x1020, 0x0820, 0x0820, 0x0820, 0x0000, 0x0020,
-    0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0820, 0x0800,
-    0x0820, 0x1020, 0x1020, 0x1841, 0x2061, 0x1861, 0x2081, 0x28A1,
-    0x30A1, 0x30C1, 0x38E2, 0x3902, 0x3922, 0x3902, 0x4942, 0x4142,
-    0x3902, 0x6A21, 0xF542, 0xD4E1, 0x51A2, 0x28A1, 0x28A1, 0x2061,
-    0x2061, 0x1841, 0x1041, 0x1020, 0x0820, 0x1020, 0x0800, 0x0020,
-    0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0820, 0x0800,
-    0x0820, 0x1020, 0x1841, 0x1041, 0x2061, 0x2061, 0x28A1, 0x28C1,
-    0x30C1, 0x38E2, 0x4102, 0x3902, 0x4142, 0x4122, 0x4142, 0x4122,
-    0x4122, 0x6201, 0xF582, 0xF582, 0xF542, 0x7A42, 0x28A1, 0x2061,
-    0x2081, 0x2061, 0x1841, 0x1020, 0x0820, 0x0820, 0x0820, 0x0800,
-    0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0820, 0x0800, 0x0020,
-    0x0820, 0x1020, 0x1841, 0x1841, 0x2061, 0x2081, 0x2881, 0x30C1,
-    0x38E2, 0x3902, 0x3922, 0x4142, 0x4922, 0x4962, 0x5162, 0x4962,
-    0x5162, 0x9B23, 0xF5A2, 0xF5A2, 0xF582, 0xF582, 0x7242, 0x2881,
-    0x2061, 0x1861, 0x2061, 0x1041, 0x1020, 0x0820, 0x0800, 0x0820,
-    0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0800, 0x0800, 0x0820,
-    0x1020, 0x1020, 0x1041, 0x2061, 0x2081, 0x28A1, 0x28A1, 0x38E2,
-    0x38E2, 0x3902, 0x4142, 0x5162, 0x4962, 0x5162, 0x4962, 0x4962,
-    0x6201, 0xE542, 0xF5A2, 0xF5A2, 0xF5A2, 0xF5A2, 0xF582, 0x6A01,
-    0x2081, 0x2081, 0x2061, 0x1841, 0x1020, 0x0820, 0x0820, 0x0800,
-    0x0820, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0820, 0x0800, 0x0820,
-    0x1020, 0x1841, 0x1841, 0x1861, 0x2881, 0x28A1, 0x30C1, 0x38E2,
-    0x3902, 0x4142, 0x5162, 0x4962, 0x59A2, 0x51C2, 0x59A2, 0x8323,
-    0xE5A2, 0xF5E2, 0xF5C2, 0xF5C2, 0xF5C2, 0xF5A2, 0xF5A2, 0xE542,
-    0x4121, 0x2061, 0x1861, 0x1841, 0x1020, 0x1020, 0x0820, 0x0800,
-    0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0020, 0x0800, 0x0020, 0x0800, 0x0820,
-    0x1020, 0x3901, 0x1861, 0x2061, 0x28A1, 0x28C1, 0x38E2, 0x3902,
-    0x4122, 0x8303, 0xBCA2, 0xC4C2, 0xBCA2, 0xBCC2, 0xE5A2, 0xF5E3,
-    0xF603, 0xF603, 0xF5E2, 0xF5E2, 0xF5C2, 0xF5C2, 0xF5C2, 0xF5A2,
-    0xC402, 0x2081, 0x2061, 0x1041, 0x1841, 0x1020, 0x0820, 0x0820,
-    0x0800, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0020, 0x0800, 0x0820, 0x0820, 0x1020,
-    0x3921, 0x7282, 0x1861, 0x2061, 0x28A1, 0x30C1, 0x38E2, 0x3902,
-    0xB443, 0xF5E2, 0xFE03, 0xF603, 0xF603, 0xF623, 0xF603, 0xF623,
-    0xFE03, 0xF603, 0xF5E3, 0xF5E3, 0xF5E2, 0xF5E2, 0xF5C2, 0xF5C2,
-    0xF5A2, 0x51C1, 0x2061, 0x1861, 0x1841, 0x1020, 0x0820, 0x0800,
-    0x0000, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0800, 0x0820, 0x1020,
-    0x51C1, 0xE542, 0x6A21, 0x28C1, 0x30A1, 0x30E2, 0x3902, 0x9361,
-    0xF5E2, 0xF602, 0xF602, 0xFE23, 0xF603, 0xF643, 0xF643, 0xFE43,
-    0xF643, 0xF623, 0xF624, 0xF603, 0xF603, 0xF5E2, 0xF5E2, 0xF5C2,
-    0xFDC2, 0x9B81, 0x2081, 0x2061, 0x1841, 0x1020, 0x0820, 0x0800,
-    0x0020, 0x0800, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0020, 0x0000, 0x0820, 0x0800, 0x0820, 0x1020,
-    0x4921, 0xF5A1, 0xF5C2, 0xAC43, 0x30C1, 0x30E2, 0x59C1, 0xFDE2,
-    0xF622, 0xF623, 0xF623, 0xFE43, 0xF643, 0xF644, 0xF664, 0xFE44,
-    0xF664, 0xF6C9, 0xF643, 0xFE03, 0xF602, 0xF602, 0xF5E2, 0xF5E2,
-    0xF5C2, 0xCCA1, 0x1861, 0x1861, 0x1841, 0x1841, 0x1020, 0x0800,
-    0x0800, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0800, 0x0820, 0x1020,
-    0x1041, 0x7282, 0x7282, 0x2881, 0x30C1, 0x30E2, 0x9BA3, 0xF602,
-    0xF603, 0xF643, 0xF643, 0xFE64, 0xF644, 0xF683, 0xF663, 0xF6A7,
-    0xFF31, 0xF6C9, 0xFE64, 0xF643, 0xF623, 0xF623, 0xFE02, 0xF602,
-    0xF5E2, 0xCCA1, 0x2881, 0x2881, 0x1861, 0x1841, 0x1020, 0x0820,
-    0x0820, 0x0800, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0020, 0x0000, 0x0020, 0x0800, 0x0820, 0x0820, 0x1020,
-    0x1841, 0x2061, 0x2081, 0x2881, 0x30C1, 0x3902, 0xE5C2, 0xFE23,
-    0xF623, 0xFE43, 0xF664, 0xF644, 0xFEA9, 0xF6CD, 0xFF31, 0xFF53,
-    0xF733, 0xF684, 0xF664, 0xFE44, 0xF643, 0xF623, 0xF603, 0xF602,
-    0xF5E2, 0xAC43, 0x2881, 0x2061, 0x1861, 0x1841, 0x1020, 0x0820,
-    0x0800, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0020, 0x0000, 0x0020, 0x0800, 0x0800, 0x0820, 0x1020,
-    0x1041, 0x2061, 0x2081, 0x30A1, 0x30E2, 0x51A1, 0xF603, 0xF643,
-    0xFE43, 0xF664, 0xF684, 0xF72E, 0xFF74, 0xFF74, 0xF774, 0xFF74,
-    0xFEED, 0xF684, 0xFE84, 0xF644, 0xF664, 0xF643, 0xFE23, 0xF602,
-    0xFE22, 0x8B21, 0x2881, 0x2081, 0x2061, 0x1041, 0x1020, 0x0820,
-    0x0820, 0x0800, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0020, 0x0800, 0x0820, 0x0800, 0x1020, 0x1020,
-    0x1041, 0x2061, 0x28A1, 0x30A1, 0x30E2, 0x8323, 0xFE42, 0xFE43,
-    0xF664, 0xF664, 0xFF4E, 0xFF74, 0xFF74, 0xF774, 0xFF74, 0xFF74,
-    0xF6E8, 0xF6A4, 0xFE84, 0xF683, 0xF644, 0xF643, 0xF643, 0xF622,
-    0xF622, 0x6201, 0x28A1, 0x2081, 0x2061, 0x1041, 0x1020, 0x0820,
-    0x0800, 0x0800, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0020, 0x0000, 0x0820, 0x0800, 0x1020, 0x1020,
-    0x2061, 0x1861, 0x2881, 0x30C1, 0x30E2, 0x9BA3, 0xF643, 0xF643,
-    0xFE83, 0xF6C9, 0xF774, 0xFF74, 0xFF74, 0xF794, 0xFFB4, 0xFF74,
-    0xFEE8, 0xF6C4, 0xFEA4, 0xF684, 0xF683, 0xF663, 0xF643, 0xFE42,
-    0xE5C2, 0x38E2, 0x28A1, 0x2881, 0x1861, 0x1841, 0x1020, 0x0820,
-    0x0800, 0x0820, 0x0800, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0020, 0x0000, 0x0820, 0x0800, 0x0820, 0x1020, 0x1041,
-    0x1841, 0x2061, 0x28A1, 0x30C1, 0x38E2, 0xAC43, 0xFE63, 0xF664,
-    0xFE83, 0xFF31, 0xF774, 0xFF74, 0xFF74, 0xFF94, 0xFF94, 0xF7B4,
-    0xFF4C, 0xF6E5, 0xFEC4, 0xF6A4, 0xF663, 0xF683, 0xF643, 0xFE43,
-    0x9BA3, 0x30C2, 0x28A1, 0x2081, 0x2061, 0x1041, 0x1020, 0x1020,
-    0x0800, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0020, 0x0000, 0x0020, 0x0800, 0x0820, 0x1020, 0x1020,
-    0x2061, 0x2061, 0x28A1, 0x30A1, 0x3902, 0xAC43, 0xF643, 0xF663,
-    0xF684, 0xFF53, 0xF774, 0xFF74, 0xFFB4, 0xF794, 0xFFB4, 0xFF94,
-    0xFF94, 0xFF4C, 0xF6E5, 0xFEA4, 0xF684, 0xF683, 0xFE83, 0xF643,
-    0x49A3, 0x30E2, 0x30A1, 0x2081, 0x2061, 0x1841, 0x1020, 0x1020,
-    0x0800, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0020, 0x0800, 0x0820, 0x0820, 0x1020, 0x1020,
-    0x2061, 0x2081, 0x2881, 0x30C1, 0x3902, 0xA3C3, 0xFEA3, 0xF683,
-    0xF6A4, 0xFF53, 0xFF74, 0xFF94, 0xFF94, 0xF7B4, 0xFF94, 0xFFD4,
-    0xFF94, 0xF774, 0xFEE5, 0xF6C4, 0xF6A4, 0xF684, 0xFE83, 0xAC23,
-    0x4122, 0x30E2, 0x30C1, 0x2061, 0x1861, 0x1841, 0x1020, 0x1020,
-    0x0800, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0020, 0x0000, 0x0800, 0x0820, 0x1020, 0x1841,
-    0x1861, 0x2081, 0x2881, 0x30C1, 0x3902, 0x8B01, 0xF683, 0xF6A4,
-    0xFEA4, 0xF74E, 0xF774, 0xFF94, 0xFFB4, 0xFF94, 0xF794, 0xFFD4,
-    0xFFB4, 0xFF94, 0xF705, 0xFEE5, 0xFEC4, 0xF6A4, 0xFE83, 0x7282,
-    0x4142, 0x4102, 0x30C1, 0x28A1, 0x1861, 0x1841, 0x1020, 0x1020,
-    0x0820, 0x0800, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0020, 0x0000, 0x0820, 0x0800, 0x0820, 0x1020, 0x1841,
-    0x2061, 0x2081, 0x28A1, 0x38E2, 0x3902, 0x6223, 0xFEC2, 0xFEC4,
-    0xF6C4, 0xFEE5, 0xFF74, 0xFF94, 0xF794, 0xFFB4, 0xFFD4, 0xFFB4,
-    0xF794, 0xFFB0, 0xF705, 0xFEE5, 0xF6C4, 0xF6A4, 0xCD43, 0x51A2,
-    0x4122, 0x3902, 0x30C1, 0x28A1, 0x2061, 0x1041, 0x1020, 0x1020,
-    0x0800, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0020, 0x0000, 0x0820, 0x0800, 0x0820, 0x1020, 0x1841,
-    0x1861, 0x2081, 0x30A1, 0x38E2, 0x4122, 0x4161, 0xCD43, 0xF6A4,
-    0xF6C4, 0xFEE5, 0xF708, 0xFF94, 0xF7B4, 0xFF94, 0xFFB4, 0xFFD4,
-    0xFF94, 0xF74C, 0xFF26, 0xF705, 0xFEE5, 0xFEC4, 0x9C43, 0x59C2,
-    0x4142, 0x4102, 0x30C1, 0x2881, 0x2081, 0x1841, 0x1020, 0x1020,
-    0x0820, 0x0800, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0020, 0x0800, 0x0820, 0x0820, 0x1020, 0x1041,
-    0x2061, 0x2081, 0x30A1, 0x38E2, 0x4142, 0x4983, 0x8323, 0xFEE4,
-    0xFEE5, 0xF705, 0xFF05, 0xFF4A, 0xFF94, 0xFFB5, 0xF795, 0xFFD5,
-    0xFF95, 0xFF6A, 0xF726, 0xF705, 0xFEC5, 0xFEE5, 0x7B03, 0x51A2,
-    0x4983, 0x3902, 0x30E2, 0x30A1, 0x2081, 0x1841, 0x1020, 0x0820,
-    0x0800, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0020, 0x0000, 0x0820, 0x0800, 0x0820, 0x1020, 0x1041,
-    0x2061, 0x28A1, 0x30C1, 0x3902, 0x4122, 0x4183, 0x51A2, 0xB503,
-    0xFEC5, 0xF705, 0xFF26, 0xFF06, 0xF74E, 0xF7B5, 0xFF95, 0xFFD4,
-    0xFF94, 0xFF47, 0xF706, 0xFF26, 0xFF05, 0xFEE5, 0x8323, 0x51C2,
-    0x4983, 0x4942, 0x30E2, 0x30A1, 0x2081, 0x2061, 0x1020, 0x0820,
-    0x0820, 0x0800, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0020, 0x0800, 0x0820, 0x0820, 0x1020, 0x1041,
-    0x2061, 0x28A1, 0x30C1, 0x3902, 0x4981, 0x59C2, 0x6223, 0x72C3,
-    0xFF05, 0xFF26, 0xFF26, 0xFF47, 0xFF48, 0xFF94, 0xFFD5, 0xFFD5,
-    0xF7B2, 0xFF47, 0xF707, 0xFF26, 0xF726, 0xFF05, 0x8B63, 0x51A2,
-    0x4183, 0x4142, 0x3902, 0x30A1, 0x2081, 0x1861, 0x1841, 0x1020,
-    0x0800, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0020, 0x0800, 0x0820, 0x0820, 0x1020, 0x1841,
-    0x1881, 0x28A1, 0x38E2, 0x3902, 0x4983, 0x51A2, 0x5A23, 0x6284,
-    0xF6E5, 0xFF27, 0xF707, 0xFF47, 0xFF47, 0xF7B0, 0xFFB5, 0xFF95,
-    0xFFAF, 0xFF47, 0xF747, 0xFF27, 0xFF26, 0xFF05, 0xBD03, 0x5224,
-    0x59C2, 0x49A3, 0x3902, 0x30C1, 0x18A1, 0x2061, 0x1841, 0x1020,
-    0x0820, 0x0800, 0x0020, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0020, 0x0000, 0x0020, 0x0800, 0x0820, 0x1841, 0x1841,
-    0x20A1, 0x28E1, 0x30E2, 0x4942, 0x4983, 0x51C2, 0x6223, 0x7AC3,
-    0xFF26, 0xFF27, 0xFF47, 0xF748, 0xFF48, 0xFFAF, 0xFFB6, 0xFFB5,
-    0xFF8D, 0xF748, 0xFF48, 0xFF47, 0xF707, 0xFF26, 0xEEC5, 0x6264,
-    0x51A2, 0x4983, 0x3922, 0x28E1, 0x28A1, 0x1881, 0x1841, 0x1020,
-    0x0820, 0x0800, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0020, 0x0000, 0x0020, 0x0800, 0x0820, 0x1041, 0x2061,
-    0x1881, 0x28E1, 0x3921, 0x4122, 0x4983, 0x5224, 0x6284, 0x8C45,
-    0xFF27, 0xFF47, 0xF748, 0xFF48, 0xFF49, 0xFFB0, 0xFFB6, 0xFFB6,
-    0xF78D, 0xFF69, 0xFF48, 0xFF48, 0xF747, 0xFF07, 0xFF26, 0xA4C4,
-    0x4A03, 0x4983, 0x4942, 0x2922, 0x28E1, 0x2081, 0x1080, 0x1020,
-    0x0820, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0020, 0x0820, 0x1020, 0x1841, 0x2081,
-    0x20C1, 0x28E1, 0x3921, 0x3982, 0x4A03, 0x5224, 0x6A84, 0xE645,
-    0xFF47, 0xFF68, 0xF749, 0xFF69, 0xFF4A, 0xFFB5, 0xFFD6, 0xFFB6,
-    0xF78D, 0xFF4A, 0xFF69, 0xFF49, 0xF748, 0xFF47, 0xFF27, 0xEEC5,
-    0x72A3, 0x4183, 0x3982, 0x3921, 0x28E1, 0x1881, 0x18A0, 0x1020,
-    0x0820, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0820, 0x0020, 0x1020, 0x1841, 0x1881,
-    0x20C1, 0x28E1, 0x3162, 0x4983, 0x49E3, 0x5224, 0x8C45, 0xFF47,
-    0xF748, 0xFF69, 0xFF49, 0xF74A, 0xFFAF, 0xFFD7, 0xFFB7, 0xFFD7,
-    0xFFAF, 0xFF6A, 0xFF4A, 0xF769, 0xFF49, 0xFF48, 0xFF47, 0xFF26,
-    0xE6C5, 0x7AC3, 0x4983, 0x3921, 0x28E1, 0x18C1, 0x2081, 0x1841,
-    0x0840, 0x0820, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0020, 0x0800, 0x0840, 0x1020, 0x1080, 0x1881,
-    0x28E1, 0x3122, 0x3162, 0x4983, 0x5A44, 0x6284, 0xE6C6, 0xFF68,
-    0xFF49, 0xFF6A, 0xFF4A, 0xFF8D, 0xFFD6, 0xFFD7, 0xFFD7, 0xF7D7,
-    0xFFB2, 0xFF8C, 0xF78C, 0xFF6A, 0xFF49, 0xFF69, 0xF748, 0xFF47,
-    0xFF26, 0xF705, 0xC5A5, 0x3182, 0x28C1, 0x18C1, 0x2081, 0x1080,
-    0x0840, 0x0020, 0x0820, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0820, 0x0820, 0x0840, 0x1080, 0x18A1,
-    0x28E1, 0x3122, 0x3982, 0x4183, 0x5224, 0xC5A5, 0xF747, 0xFF49,
-    0xFF69, 0xF74A, 0xFFAF, 0xFFB7, 0xFFD8, 0xFFD8, 0xFFD8, 0xFFD8,
-    0xFFD6, 0xFF8D, 0xFF8D, 0xFF8C, 0xF76A, 0xFF49, 0xFF48, 0xFF47,
-    0xFF46, 0xFF45, 0xF745, 0x83E4, 0x3122, 0x28E1, 0x18A0, 0x1080,
-    0x0840, 0x0840, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0020, 0x0020, 0x0840, 0x0840, 0x18A0, 0x20C1,
-    0x28E1, 0x3122, 0x3982, 0x4A03, 0x83C4, 0xFF67, 0xFF48, 0xFF69,
-    0xFF4A, 0xFFAF, 0xFFD7, 0xFFD8, 0xFFD8, 0xFFD8, 0xFFD8, 0xFFD8,
-    0xFFD8, 0xFFB0, 0xFFAF, 0xF78D, 0xFF8C, 0xFF4A, 0xFF69, 0xF748,
-    0xFF47, 0xFF45, 0xFF25, 0xBDA5, 0x2922, 0x28C1, 0x1881, 0x1080,
-    0x0840, 0x0840, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0020, 0x0000, 0x0020, 0x0840, 0x0840, 0x18A0, 0x18C1,
-    0x28E1, 0x3162, 0x3982, 0x5224, 0xDEC6, 0xFF47, 0xFF69, 0xF78A,
-    0xFFAF, 0xFFD7, 0xFFD8, 0xFFD8, 0xFFD9, 0xFFF9, 0xFFD9, 0xFFFA,
-    0xFFD9, 0xFFD8, 0xFFB0, 0xFF8D, 0xFF8C, 0xF78C, 0xFF6A, 0xFF48,
-    0xFF47, 0xFF46, 0xFF45, 0xF724, 0x3962, 0x2101, 0x20C1, 0x18A0,
-    0x0840, 0x0840, 0x0820, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0020, 0x0820, 0x0840, 0x1060, 0x18A0, 0x18C1,
-    0x2901, 0x3162, 0x3982, 0x9465, 0xFF86, 0xFF48, 0xFF69, 0xFF8C,
-    0xFFD7, 0xFFD8, 0xFFD8, 0xFFD9, 0xFFDA, 0xFFFB, 0xFFDB, 0xFFFB,
-    0xFFDA, 0xFFFA, 0xFFD9, 0xFFD2, 0xFF8D, 0xF78C, 0xFF8A, 0xFF69,
-    0xFF48, 0xF766, 0xFF65, 0xFF44, 0x4A62, 0x20E1, 0x18C1, 0x18A0,
-    0x0840, 0x0840, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0020, 0x0000, 0x0820, 0x0840, 0x1080, 0x10A0, 0x20C1,
-    0x20E1, 0x3162, 0x49E3, 0xE705, 0xFF66, 0xFF88, 0xF78A, 0xFFD5,
-    0xFFD7, 0xFFD8, 0xFFF9, 0xFFDA, 0xFFFB, 0xFFDB, 0xFFDC, 0xFFFC,
-    0xFFFB, 0xFFDB, 0xFFDA, 0xFFD8, 0xFFD4, 0xFF8D, 0xFFAB, 0xFF89,
-    0xFF88, 0xFF66, 0xFF85, 0xFF44, 0x7384, 0x2101, 0x20C1, 0x18A0,
-    0x0840, 0x0840, 0x0820, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0020, 0x0820, 0x0860, 0x1080, 0x18A0, 0x20C1,
-    0x2101, 0x3962, 0x9C43, 0xFF86, 0xFF88, 0xFF89, 0xFFAF, 0xFFD7,
-    0xFFD8, 0xFFD8, 0xFFD9, 0xFFDB, 0xFFFC, 0xFFFC, 0xFFFD, 0xFFFD,
-    0xFFDC, 0xFFDB, 0xFFFA, 0xFFD9, 0xFFF8, 0xFFD4, 0xF78C, 0xFF8A,
-    0xFF89, 0xF766, 0xFF46, 0xF745, 0x9423, 0x20E1, 0x20C1, 0x10A0,
-    0x1060, 0x0840, 0x0020, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0020, 0x0020, 0x0820, 0x0840, 0x1060, 0x10A0, 0x20C1,
-    0x2101, 0x3142, 0xE6A5, 0xF766, 0xFF88, 0xFF89, 0xF7D4, 0xFFD7,
-    0xFFD8, 0xFFD9, 0xFFFA, 0xFFDB, 0xFFDC, 0xFFFD, 0xFFFE, 0xFFFE,
-    0xFFFD, 0xFFFC, 0xFFFB, 0xFFDA, 0xFFD8, 0xFFD7, 0xFF8D, 0xFFAA,
-    0xFF89, 0xFF88, 0xFF66, 0xFF85, 0xA4C4, 0x2901, 0x20C1, 0x18A0,
-    0x1080, 0x0840, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0820, 0x0020, 0x0860, 0x1080, 0x18A0, 0x20C1,
-    0x2901, 0x5262, 0xFF85, 0xFF66, 0xFF88, 0xFFAB, 0xFFD6, 0xFFD7,
-    0xFFD8, 0xFFD9, 0xFFDA, 0xFFFB, 0xFFFD, 0xFFFE, 0xFFFE, 0xFFFE,
-    0xFFFE, 0xFFFC, 0xFFDB, 0xFFDA, 0xFFF9, 0xFFD8, 0xFFB0, 0xFF8B,
-    0xFF89, 0xF788, 0xFF86, 0xFF65, 0xAD45, 0x20E1, 0x18C1, 0x18A0,
-    0x1080, 0x0820, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0020, 0x0020, 0x0020, 0x0840, 0x1060, 0x18A0, 0x20C1,
-    0x2101, 0x7BC4, 0xF766, 0xFF87, 0xFF88, 0xF78C, 0xFFD7, 0xFFD7,
-    0xFFD8, 0xFFD9, 0xFFFA, 0xFFDB, 0xFFFD, 0xFFFE, 0xFFFE, 0xFFFE,
-    0xFFFE, 0xFFFC, 0xFFDB, 0xFFFA, 0xFFD9, 0xFFD8, 0xFFD2, 0xFF8B,
-    0xFF89, 0xFF88, 0xFF87, 0xFF86, 0xC5C5, 0x2901, 0x18C1, 0x18A0,
-    0x1080, 0x0840, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0820, 0x0020, 0x0840, 0x1080, 0x18A0, 0x20C1,
-    0x2901, 0xA4C4, 0xFF86, 0xFF87, 0xFF88, 0xFF8B, 0xFFD7, 0xFFD7,
-    0xFFD8, 0xFFD9, 0xFFFA, 0xFFDB, 0xFFFC, 0xFFFD, 0xFFFE, 0xFFFE,
-    0xFFFD, 0xFFFC, 0xFFDB, 0xFFDA, 0xFFD8, 0xFFD8, 0xFFD2, 0xF78B,
-    0xFF89, 0xFF88, 0xF787, 0xFF86, 0xC5A5, 0x20E1, 0x18C1, 0x10A0,
-    0x1080, 0x0820, 0x0020, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0020, 0x0020, 0x0840, 0x1060, 0x18A0, 0x18C1,
-    0x2101, 0xAD45, 0xFF66, 0xFF87, 0xF789, 0xFF8A, 0xFFD5, 0xFFD7,
-    0xFFD8, 0xFFF9, 0xFFDA, 0xFFFA, 0xFFDB, 0xFFDC, 0xFFFD, 0xFFFD,
-    0xFFFC, 0xFFFB, 0xFFDA, 0xFFD9, 0xFFD8, 0xFFD8, 0xFFD4, 0xFFAB,
-    0xFF89, 0xFF88, 0xFF87, 0xFF86, 0xB565, 0x2901, 0x20C1, 0x1080,
-    0x0840, 0x0840, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0020, 0x0820, 0x0840, 0x0840, 0x1080, 0x20C1,
-    0x2101, 0xB565, 0xFF86, 0xFF87, 0xFF88, 0xFF8A, 0xFFB0, 0xFFF7,
-    0xFFD8, 0xFFD8, 0xFFD9, 0xFFFA, 0xFFDB, 0xFFFB, 0xFFDB, 0xFFFB,
-    0xFFDB, 0xFFFB, 0xFFDA, 0xFFF9, 0xFFD8, 0xFFD7, 0xFFD4, 0xFF8B,
-    0xF789, 0xFF88, 0xFF87, 0xF786, 0xA4A4, 0x18C1, 0x1080, 0x1080,
-    0x0840, 0x0840, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0020, 0x0000, 0x0020, 0x0840, 0x0840, 0x1060, 0x18A0,
-    0x18A1, 0xB503, 0xF787, 0xFF87, 0xFF88, 0xF7AA, 0xFFAC, 0xFFD7,
-    0xFFD7, 0xFFD8, 0xFFD8, 0xFFD9, 0xFFFA, 0xFFDA, 0xFFFB, 0xFFDB,
-    0xFFFA, 0xFFDA, 0xFFF9, 0xFFD8, 0xFFD8, 0xFFD7, 0xF7B2, 0xFFAA,
-    0xFF89, 0xFFA8, 0xFF87, 0xFF86, 0x9C43, 0x20C1, 0x18A0, 0x1080,
-    0x0840, 0x0840, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0020, 0x0840, 0x0840, 0x1080, 0x18A0,
-    0x20C1, 0x9465, 0xFFA7, 0xFF87, 0xFFA8, 0xFF89, 0xFF8A, 0xFFD4,
-    0xFFD7, 0xFFD8, 0xFFD8, 0xFFF9, 0xFFD9, 0xFFFA, 0xFFDA, 0xFFFA,
-    0xFFD9, 0xFFF9, 0xFFD8, 0xFFD8, 0xFFD7, 0xF7D7, 0xFFB2, 0xFFAA,
-    0xFF89, 0xF7A8, 0xFFA7, 0xFF87, 0x6303, 0x18C1, 0x1080, 0x1080,
-    0x0840, 0x0840, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0020, 0x0840, 0x0840, 0x1080, 0x1080,
-    0x18C1, 0x6303, 0xFF87, 0xFF87, 0xF7A8, 0xFF89, 0xFFAA, 0xFFAD,
-    0xF7F7, 0xFFD7, 0xFFD8, 0xFFD8, 0xFFF8, 0xFFD9, 0xFFF9, 0xFFD9,
-    0xFFF9, 0xFFD8, 0xFFF8, 0xFFD8, 0xFFD7, 0xFFD7, 0xFFB0, 0xFFAA,
-    0xFF89, 0xFFA8, 0xFFA7, 0xFFA7, 0x41E2, 0x18A0, 0x1060, 0x1080,
-    0x0840, 0x0020, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0820, 0x0020, 0x0840, 0x0840, 0x1080,
-    0x18A0, 0x3962, 0xFFA7, 0xFF87, 0xFFA8, 0xFFA8, 0xFF8A, 0xFFAB,
-    0xFFD4, 0xFFD7, 0xFFD7, 0xFFD8, 0xFFD8, 0xFFD8, 0xF7D4, 0xFFB0,
-    0xFFD5, 0xFFD8, 0xFFD8, 0xFFD7, 0xFFD7, 0xF7D7, 0xFFAF, 0xFFAA,
-    0xFFA8, 0xF7A8, 0xFFA7, 0xE707, 0x18A1, 0x1080, 0x1080, 0x0840,
-    0x0840, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0840, 0x0840, 0x1080,
-    0x1080, 0x18A1, 0xC626, 0xFFA7, 0xFFA8, 0xFFA8, 0xF7C9, 0xFF8A,
-    0xFFAF, 0xFFF7, 0xF7D7, 0xFFD7, 0xFFF8, 0xFFD6, 0xFFAF, 0xFFAF,
-    0xFFAF, 0xFFF6, 0xFFD7, 0xFFF7, 0xFFD6, 0xFFD6, 0xFFAF, 0xFFC9,
-    0xFFA8, 0xFFA8, 0xFFC7, 0xB565, 0x20C1, 0x18A0, 0x1080, 0x0840,
-    0x0840, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0840, 0x0840, 0x1060,
-    0x1080, 0x18A0, 0x6B23, 0xFFA7, 0xFFA8, 0xFFA8, 0xFFC9, 0xFFCA,
-    0xFFCB, 0xFFD4, 0xFFD6, 0xFFD7, 0xFFD7, 0xF7B0, 0xFFAD, 0xFFCD,
-    0xFFAD, 0xF7B0, 0xFFD7, 0xFFD7, 0xFFD6, 0xFFD6, 0xFFCC, 0xFFC9,
-    0xFFA8, 0xF7A8, 0xFFA7, 0x6303, 0x1080, 0x1060, 0x0840, 0x0840,
-    0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0840, 0x0840,
-    0x1080, 0x1080, 0x18A1, 0xC626, 0xFFA8, 0xFFA8, 0xFFA9, 0xF7C9,
-    0xFFAA, 0xFFAD, 0xFFD6, 0xFFD7, 0xFFD6, 0xFFAC, 0xFFCC, 0xAD49,
-    0xDECB, 0xF7CC, 0xFFB2, 0xFFF6, 0xFFD6, 0xFFD6, 0xFFC9, 0xFFC9,
-    0xFFA8, 0xFFA8, 0xEF07, 0x20C1, 0x1080, 0x1080, 0x0840, 0x0840,
-    0x0820, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0840, 0x0820,
-    0x0840, 0x1080, 0x18A0, 0x62A3, 0xFFC8, 0xFFA8, 0xFFC9, 0xFFC9,
-    0xFFA9, 0xFFCA, 0xFFB0, 0xFFD6, 0xFFD4, 0xF7CB, 0xDECB, 0x5224,
-    0x9445, 0xFFCB, 0xFFCB, 0xFFD2, 0xFFD6, 0xFFD2, 0xF7C9, 0xFFA9,
-    0xFFA8, 0xFFA8, 0x7BC4, 0x1080, 0x0880, 0x0840, 0x0840, 0x0020,
-    0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0840,
-    0x0840, 0x1080, 0x1060, 0x1080, 0xBDA5, 0xFFA8, 0xFFC9, 0xFFA9,
-    0xF7C9, 0xFFC9, 0xFFCB, 0xFFB0, 0xFFCD, 0xFFCB, 0xAD49, 0x49E3,
-    0x5224, 0xFFAA, 0xF7CA, 0xFFCB, 0xFFAF, 0xFFAD, 0xFFC9, 0xFFA8,
-    0xFFA8, 0xE6E6, 0x20C1, 0x1080, 0x1040, 0x0840, 0x0840, 0x0020,
-    0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0820,
-    0x0840, 0x0840, 0x1080, 0x18A0, 0x3162, 0xF768, 0xFFC9, 0xFFC9,
-    0xFFC9, 0xFFA9, 0xFFCA, 0xFFCA, 0xFFCA, 0xF7CA, 0x7BC4, 0x3982,
-    0x3982, 0xD668, 0xFFEA, 0xFFCA, 0xFFC9, 0xFFA9, 0xFFC9, 0xFFA9,
-    0xF7A8, 0x6303, 0x0860, 0x1060, 0x0840, 0x0840, 0x0020, 0x0820,
-    0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,
-    0x0840, 0x0840, 0x0840, 0x1060, 0x0860, 0x5AA3, 0xF788, 0xF7A9,
-    0xFFC9, 0xFFA9, 0xFFC9, 0xFFCA, 0xFFCA, 0xFFEA, 0x5262, 0x3162,
-    0x3142, 0xA4A4, 0xFFCA, 0xFFCA, 0xFFC9, 0xFFA9, 0xFFC9, 0xFFC9,
-    0xB565, 0x1080, 0x1080, 0x0840, 0x0840, 0x0820, 0x0020, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,
-    0x0820, 0x0840, 0x0820, 0x0840, 0x1080, 0x1080, 0x7364, 0xFFC9,
-    0xFFC9, 0xFFC9, 0xFFC9, 0xFFCA, 0xFFCA, 0xDEC8, 0x2902, 0x2922,
-    0x2922, 0x5262, 0xFFCA, 0xFFCA, 0xFFC9, 0xFFC9, 0xFFA9, 0xDEC8,
-    0x18A1, 0x1060, 0x0840, 0x0840, 0x0020, 0x0020, 0x0000, 0x0020,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0020, 0x0840, 0x0840, 0x0840, 0x1060, 0x0860, 0x6303,
-    0xE708, 0xFFC9, 0xFFCA, 0xFFEA, 0xFFA9, 0x7364, 0x2901, 0x18C1,
-    0x20C1, 0x18A1, 0xC606, 0xFFC9, 0xFFCA, 0xFFEA, 0xE6C8, 0x3162,
-    0x1080, 0x0840, 0x0840, 0x0840, 0x0820, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0020, 0x0000, 0x0820, 0x0840, 0x0840, 0x0840, 0x0840, 0x1080,
-    0x20C1, 0x7384, 0x9465, 0x6B03, 0x2101, 0x18A0, 0x18A0, 0x10A0,
-    0x18A0, 0x18A0, 0x41E2, 0xF7A9, 0xFFCA, 0xB545, 0x18C1, 0x0840,
-    0x0840, 0x0840, 0x0840, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0840, 0x0840, 0x0840,
-    0x0840, 0x1080, 0x1060, 0x1080, 0x1060, 0x18A0, 0x18A0, 0x18A0,
-    0x1080, 0x1060, 0x1080, 0x2922, 0x3122, 0x0860, 0x0840, 0x0820,
-    0x0840, 0x0820, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0020, 0x0000, 0x0820, 0x0020, 0x0820, 0x0840,
-    0x0840, 0x0840, 0x0840, 0x0860, 0x1080, 0x1060, 0x1080, 0x1060,
-    0x1080, 0x0840, 0x0840, 0x1060, 0x0840, 0x0840, 0x0840, 0x0820,
-    0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x0020,
-    0x0020, 0x0840, 0x0820, 0x0840, 0x0840, 0x0840, 0x0860, 0x0840,
-    0x0820, 0x0840, 0x0020, 0x0840, 0x0840, 0x0820, 0x0020, 0x0820,
-    0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020,
-    0x0820, 0x0020, 0x0820, 0x0020, 0x0840, 0x0840, 0x0820, 0x0840,
-    0x0020, 0x0020, 0x0820, 0x0020, 0x0820, 0x0020, 0x0000, 0x0020,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,
-    0x0000, 0x0020, 0x0020, 0x0820, 0x0020, 0x0820, 0x0020, 0x0820,
-    0x0020, 0x0820, 0x0020, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0000, 0x0020,
-    0x0000, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 },
-  { 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5141, 0x9202, 0x69A1,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x1861, 0xAA82, 0xDAE2, 0xDAE2, 0xE2E2,
-    0x69C1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x1020, 0xDAA2, 0xDAE2, 0xE2E2, 0xDAE2, 0xDAE2,
-    0xD282, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x69A1, 0xDAE2, 0xDAE2, 0xDAE2, 0xE2E2, 0xDAE2,
-    0xE2E2, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0xD2A2, 0xDAE2, 0xDAE2, 0xE2E2, 0xDAE2, 0xDAE2,
-    0xDAE2, 0x1861, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x1861, 0xE2E2, 0xDAE2, 0xDAE2, 0xDAE2, 0xD2A2, 0xDAE2,
-    0xE2E2, 0x2061, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x40E2, 0xDAE2, 0xDAE2, 0xAA82, 0x30C1, 0x0000, 0x1041,
-    0x91E2, 0x1020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x4121, 0xDAE2, 0xDAA2, 0x2061, 0x0020, 0x0000, 0x0000,
-    0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x40E2, 0xE323, 0x4121, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x1881, 0xAA82, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x30C1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x69A1,
-    0x8221, 0x28A0, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x69A1,
-    0xDB61, 0xE361, 0x4121, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3101,
-    0xDB61, 0xE361, 0xC322, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x1841,
-    0xE361, 0xE361, 0xDB61, 0x28A0, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0000, 0x0020, 0x0000,
-    0xE361, 0xDB61, 0xE361, 0x18A1, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0020, 0x0000, 0x0020, 0x0000, 0x0020, 0x0000, 0x0020, 0x0000,
-    0xCB22, 0xE3C1, 0xE361, 0x0020, 0x0000, 0x0000, 0x0020, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000,
-    0x0020, 0x0000, 0x0020, 0x0000, 0x0020, 0x0000, 0x0020, 0x0000,
-    0xAA62, 0xE3C1, 0x9282, 0x0820, 0x0000, 0x0020, 0x0000, 0x0020,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000,
-    0x0820, 0x0000, 0x0020, 0x0000, 0x0820, 0x0800, 0x0020, 0x0800,
-    0xB282, 0xE3C1, 0x4121, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020,
-    0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000,
-    0x0020, 0x0000, 0x0820, 0x0020, 0x0800, 0x0020, 0x0000, 0x0000,
-    0xAA82, 0xE361, 0x0820, 0x0800, 0x0820, 0x0000, 0x0020, 0x0000,
-    0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0000,
-    0x0820, 0x0800, 0x0020, 0x0820, 0x0800, 0x0820, 0x0000, 0x0820,
-    0xB322, 0x7A21, 0x0800, 0x0800, 0x0020, 0x0800, 0x0020, 0x0000,
-    0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0000, 0x0820,
-    0x0000, 0x0820, 0x0800, 0x0020, 0x0800, 0x0820, 0x0800, 0x0000,
-    0xCB22, 0x18A1, 0x0820, 0x0800, 0x0820, 0x0800, 0x0020, 0x0800,
-    0x0820, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0800, 0x0820,
-    0x0800, 0x28C1, 0x0820, 0x0800, 0x0820, 0x0820, 0x0820, 0x1020,
-    0x3922, 0x0820, 0x0820, 0x0800, 0x0820, 0x0800, 0x0820, 0x0800,
-    0x0020, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0800, 0x0020, 0x0800,
-    0x69A1, 0x7A21, 0x0820, 0x0820, 0x1020, 0x0820, 0x0820, 0x0820,
-    0x1020, 0x1020, 0x1020, 0x0820, 0x0820, 0x0020, 0x0800, 0x0820,
-    0x0800, 0x0820, 0x0000, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0020, 0x0000, 0x0020, 0x0000, 0x0820, 0x0800, 0x69C1,
-    0xEBC1, 0x1881, 0x0820, 0x1020, 0x1020, 0x1020, 0x1020, 0x1020,
-    0x1020, 0x1020, 0x1020, 0x1020, 0x0820, 0x0820, 0x0820, 0x0800,
-    0x0820, 0x0000, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x2880, 0xE3C1,
-    0xCB22, 0x1020, 0x1020, 0x1020, 0x1020, 0x1020, 0x1020, 0x1020,
-    0x1020, 0x1020, 0x1020, 0x1020, 0x1020, 0x0820, 0x0820, 0x0020,
-    0x0800, 0x0820, 0x0800, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0020, 0x0800, 0x0820, 0x0800, 0x0020, 0x69A1, 0xEC81,
-    0x9AE1, 0x1020, 0x1020, 0x1020, 0x1041, 0x1841, 0x1841, 0x2061,
-    0x1041, 0x1841, 0x1841, 0x1020, 0x1020, 0x1020, 0x0820, 0x0820,
-    0x0800, 0x0800, 0x0820, 0x0000, 0x0020, 0x0000, 0x0020, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0020, 0x0000, 0x0820, 0x0000, 0x0820, 0x5141, 0xEC61,
-    0xB322, 0x1020, 0x1020, 0x1841, 0x1841, 0x1041, 0x2081, 0x59C1,
-    0x1841, 0x1841, 0x1841, 0x1041, 0x1841, 0x1020, 0x1020, 0x0820,
-    0x0820, 0x0800, 0x0820, 0x0800, 0x0820, 0x0000, 0x0020, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,
-    0x0000, 0x0020, 0x0800, 0x0820, 0x0800, 0x0820, 0x1041, 0xE441,
-    0xCBA2, 0x1041, 0x1041, 0x1841, 0x1841, 0x2061, 0x9AE1, 0x5141,
-    0x1041, 0x1841, 0x1841, 0x1841, 0x1041, 0x1841, 0x1020, 0x1020,
-    0x1020, 0x0820, 0x0800, 0x0820, 0x0000, 0x0020, 0x0000, 0x0020,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,
-    0x0000, 0x0020, 0x0000, 0x0820, 0x0820, 0x0820, 0x1020, 0x61A1,
-    0xF461, 0x30C1, 0x1841, 0x1861, 0x1841, 0x7A21, 0xF481, 0x69A1,
-    0x1861, 0x2061, 0x1861, 0x2061, 0x1841, 0x1841, 0x1041, 0x1020,
-    0x1020, 0x0820, 0x0820, 0x0800, 0x0820, 0x0800, 0x0020, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000,
-    0x0020, 0x0800, 0x0820, 0x0800, 0x0820, 0x0820, 0x1020, 0x1841,
-    0x7A21, 0x9282, 0x1861, 0x2061, 0x5141, 0xEC81, 0xEC61, 0x9AE1,
-    0x2061, 0x2081, 0x2061, 0x1861, 0x2061, 0x1041, 0x1841, 0x1841,
-    0x1020, 0x1020, 0x0820, 0x0800, 0x0800, 0x0020, 0x0000, 0x0020,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,
-    0x0000, 0x0020, 0x0800, 0x0820, 0x0820, 0x1020, 0x1020, 0x1841,
-    0x1841, 0x1861, 0x1861, 0x28A1, 0xDC21, 0xECA1, 0xECA1, 0xEC61,
-    0x5162, 0x2061, 0x2081, 0x2881, 0x1861, 0x2061, 0x1841, 0x1041,
-    0x1841, 0x1020, 0x0820, 0x0820, 0x0800, 0x0820, 0x0800, 0x0020,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0800,
-    0x0820, 0x0000, 0x0820, 0x0820, 0x1020, 0x1020, 0x1841, 0x1841,
-    0x1861, 0x2061, 0x2081, 0xB381, 0xECA1, 0xEC81, 0xE4A1, 0xEC81,
-    0xEC61, 0x4962, 0x2081, 0x2061, 0x2081, 0x2061, 0x1861, 0x1841,
-    0x1841, 0x1020, 0x1020, 0x0820, 0x0800, 0x0800, 0x0020, 0x0000,
-    0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000,
-    0x0820, 0x0800, 0x0820, 0x0820, 0x1020, 0x1841, 0x1841, 0x1861,
-    0x1861, 0x2061, 0x7A01, 0xECC1, 0xF4C1, 0xECC1, 0xF4C1, 0xF4C1,
-    0xF4E1, 0xEC61, 0x6201, 0x28A1, 0x2881, 0x2081, 0x2061, 0x2061,
-    0x1041, 0x1841, 0x1020, 0x0820, 0x0820, 0x0820, 0x0800, 0x0820,
-    0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020,
-    0x0800, 0x0820, 0x0820, 0x1020, 0x1020, 0x1841, 0x1841, 0x2061,
-    0x2081, 0x4121, 0xECA1, 0xF4C1, 0xF4C1, 0xECC1, 0xF4C1, 0xECC1,
-    0xF4C1, 0xECC1, 0xF4C1, 0xAB61, 0x30E2, 0x2881, 0x2081, 0x1861,
-    0x2061, 0x1841, 0x1020, 0x1020, 0x0820, 0x0800, 0x0800, 0x0020,
-    0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020,
-    0x0800, 0x0800, 0x0820, 0x1020, 0x1841, 0x1841, 0x1861, 0x2081,
-    0x2081, 0xCC01, 0xECC1, 0xF4C1, 0xECC1, 0xF4C1, 0xECC1, 0xF4C1,
-    0xECC1, 0xF4C1, 0xECC1, 0xF4C1, 0xE441, 0x5141, 0x2081, 0x2881,
-    0x1861, 0x1841, 0x1841, 0x1020, 0x0820, 0x0820, 0x0800, 0x0820,
-    0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0800,
-    0x0820, 0x0820, 0x1020, 0x1020, 0x1841, 0x2061, 0x1861, 0x2081,
-    0x8281, 0xF4E1, 0xF4C1, 0xF502, 0xF502, 0xF502, 0xF543, 0xED02,
-    0xF502, 0xF502, 0xF502, 0xED02, 0xF502, 0xE4A1, 0x7242, 0x2061,
-    0x1861, 0x2061, 0x1841, 0x1020, 0x1020, 0x0820, 0x0800, 0x0000,
-    0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0800,
-    0x0800, 0x0820, 0x1020, 0x1841, 0x1041, 0x1861, 0x2061, 0x3902,
-    0xE4A1, 0xF502, 0xF502, 0xF502, 0xED01, 0xF583, 0xF6A7, 0xF645,
-    0xF543, 0xF521, 0xF501, 0xF521, 0xF502, 0xF502, 0xF522, 0x9AE1,
-    0x2081, 0x2061, 0x1841, 0x1841, 0x1020, 0x0820, 0x0800, 0x0820,
-    0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0800, 0x0820,
-    0x0800, 0x0820, 0x1020, 0x1841, 0x1861, 0x2061, 0x2081, 0xB381,
-    0xF521, 0xF521, 0xF501, 0xF521, 0xF501, 0xF5C4, 0xF6A7, 0xF6A7,
-    0xF6A7, 0xF5A3, 0xF542, 0xF521, 0xF501, 0xF521, 0xED01, 0xF502,
-    0x9AE1, 0x1841, 0x1861, 0x1841, 0x1020, 0x0820, 0x0800, 0x0820,
-    0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0800,
-    0x0820, 0x1020, 0x1020, 0x1841, 0x1861, 0x2061, 0x51C1, 0xED02,
-    0xF501, 0xF521, 0xF542, 0xED42, 0xF542, 0xF5E5, 0xFEA7, 0xF6A7,
-    0xF6A7, 0xF6A7, 0xF582, 0xF542, 0xF542, 0xF501, 0xF521, 0xF521,
-    0xF521, 0x7242, 0x2061, 0x1841, 0x1841, 0x1020, 0x0820, 0x0820,
-    0x0800, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0020, 0x0800, 0x0020, 0x0800, 0x0820,
-    0x0820, 0x1020, 0x1841, 0x1041, 0x2061, 0x2081, 0xC402, 0xF521,
-    0xF501, 0xF542, 0xF542, 0xED42, 0xF582, 0xF666, 0xFEE8, 0xF6E8,
-    0xFF08, 0xF6E8, 0xF645, 0xF542, 0xF542, 0xF542, 0xED42, 0xF501,
-    0xF521, 0xE481, 0x28A1, 0x1041, 0x1841, 0x1020, 0x0820, 0x0800,
-    0x0820, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0800, 0x0800,
-    0x0820, 0x1020, 0x1041, 0x1861, 0x2061, 0x51C1, 0xF501, 0xF542,
-    0xED42, 0xF582, 0xF562, 0xF582, 0xF5A3, 0xF6E8, 0xFF08, 0xF6E8,
-    0xFF08, 0xF6E8, 0xF666, 0xF562, 0xF582, 0xF582, 0xF542, 0xF542,
-    0xF542, 0xF521, 0x8B21, 0x2061, 0x1841, 0x1020, 0x0820, 0x0820,
-    0x0000, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0800, 0x0820, 0x0800,
-    0x1020, 0x1020, 0x1041, 0x2061, 0x2081, 0xCC21, 0xF542, 0xF542,
-    0xF582, 0xF562, 0xF582, 0xF5A2, 0xF645, 0xF6E8, 0xFEE8, 0xF708,
-    0xFEE8, 0xF708, 0xF645, 0xF582, 0xF5A2, 0xF582, 0xF562, 0xF542,
-    0xED42, 0xF542, 0xAB61, 0x1861, 0x1041, 0x1020, 0x1020, 0x0820,
-    0x0800, 0x0800, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0800, 0x0820,
-    0x1020, 0x1020, 0x1841, 0x1861, 0x4161, 0xF542, 0xED42, 0xF562,
-    0xF582, 0xF5A2, 0xF582, 0xF624, 0xF708, 0xFEE8, 0xF708, 0xFEE8,
-    0xF708, 0xFEE8, 0xF604, 0xF5A2, 0xF5A2, 0xF562, 0xF582, 0xF582,
-    0xF542, 0xF562, 0x9B81, 0x2061, 0x1841, 0x1041, 0x1020, 0x0820,
-    0x0800, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0800, 0x0820, 0x0820,
-    0x1020, 0x1841, 0x1841, 0x2061, 0x8B21, 0xF562, 0xF582, 0xF562,
-    0xF5A2, 0xF5A2, 0xF645, 0xFEE8, 0xF708, 0xFEE8, 0xFF29, 0xF709,
-    0xFF29, 0xFEE8, 0xF604, 0xF5E3, 0xF5C3, 0xF5A2, 0xF5A2, 0xF562,
-    0xF582, 0xED42, 0x4161, 0x2061, 0x1861, 0x1841, 0x1020, 0x0820,
-    0x0800, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0800, 0x0820,
-    0x1020, 0x1841, 0x1841, 0x2061, 0xC4A1, 0xF582, 0xF562, 0xF5A2,
-    0xF5A2, 0xF685, 0xF708, 0xFEE8, 0xF708, 0xFF09, 0xFF29, 0xFF09,
-    0xF729, 0xFF08, 0xF603, 0xF5E3, 0xF5E3, 0xFDC3, 0xF5A2, 0xF5A2,
-    0xF5A2, 0x9B81, 0x2881, 0x2881, 0x1861, 0x1841, 0x1020, 0x0820,
-    0x0820, 0x0800, 0x0020, 0x0800, 0x0020, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0020, 0x0000, 0x0820, 0x0800, 0x0820, 0x0820,
-    0x1020, 0x1841, 0x1861, 0x30A1, 0xFD82, 0xF5A1, 0xF5A2, 0xF5C2,
-    0xF604, 0xFF08, 0xF6E8, 0xFF29, 0xFF09, 0xFF29, 0xF709, 0xFF29,
-    0xFF09, 0xF708, 0xF623, 0xF5E3, 0xF603, 0xF5E2, 0xF5C2, 0xF5A2,
-    0xCCA1, 0x30C2, 0x2881, 0x2081, 0x1861, 0x1841, 0x1020, 0x1020,
-    0x0800, 0x0000, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0800, 0x0820, 0x0820,
-    0x1020, 0x1841, 0x1861, 0x4181, 0xF581, 0xF5A2, 0xF5C2, 0xF5A2,
-    0xF603, 0xF708, 0xFF09, 0xFF29, 0xF709, 0xFF29, 0xFF09, 0xFF29,
-    0xFF09, 0xF6A7, 0xF623, 0xFE23, 0xF603, 0xF5E2, 0xF5E2, 0xCCA1,
-    0x4942, 0x30C1, 0x28A1, 0x2881, 0x1861, 0x1841, 0x1020, 0x1020,
-    0x0800, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0020, 0x0000, 0x0820, 0x0800, 0x0820, 0x0820,
-    0x1020, 0x1841, 0x2061, 0x6A21, 0xF5A1, 0xF5C2, 0xF5C2, 0xF5E2,
-    0xF5E2, 0xF623, 0xFEA7, 0xFF29, 0xFF09, 0xF769, 0xFF49, 0xFF69,
-    0xFF49, 0xF6A7, 0xF664, 0xF643, 0xF623, 0xF5E3, 0xDD02, 0x51A2,
-    0x3902, 0x38E2, 0x28C1, 0x28A1, 0x2061, 0x1041, 0x1841, 0x1020,
-    0x0800, 0x0800, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0800, 0x0820, 0x1020,
-    0x1041, 0x1841, 0x1861, 0x51A1, 0xF5A2, 0xF5C2, 0xF5C2, 0xF5E2,
-    0xF602, 0xF5E3, 0xF623, 0xF664, 0xF685, 0xFF07, 0xFF48, 0xF769,
-    0xFF49, 0xFE84, 0xF664, 0xF643, 0xFE23, 0xD563, 0x6223, 0x4962,
-    0x4922, 0x30E2, 0x30C1, 0x28A1, 0x2061, 0x1841, 0x1841, 0x1020,
-    0x0820, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0020, 0x0000, 0x0820, 0x0800, 0x0820, 0x1020,
-    0x1841, 0x1841, 0x2081, 0x38E2, 0xFDC2, 0xF5C2, 0xF5E2, 0xF602,
-    0xF602, 0xF623, 0xF643, 0xFE64, 0xF684, 0xF684, 0xFE84, 0xF6C4,
-    0xFEE5, 0xF684, 0xF684, 0xF644, 0xE5A2, 0x6A82, 0x51A2, 0x4962,
-    0x4122, 0x38E2, 0x30C1, 0x2881, 0x2061, 0x1041, 0x1841, 0x1020,
-    0x0820, 0x0800, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0800, 0x0820, 0x1020,
-    0x1841, 0x1041, 0x2061, 0x2081, 0xCCA1, 0xF5E2, 0xF5E2, 0xF602,
-    0xFE23, 0xF643, 0xF644, 0xF683, 0xF684, 0xFEA4, 0xF6C4, 0xFEE5,
-    0xF6C4, 0xF6A4, 0xFE84, 0xF663, 0x8323, 0x6223, 0x59C2, 0x5162,
-    0x4142, 0x3902, 0x30C1, 0x2881, 0x2881, 0x1861, 0x1841, 0x1020,
-    0x0820, 0x0820, 0x0800, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0020, 0x0000, 0x0820, 0x0800, 0x0820, 0x1020,
-    0x1841, 0x1861, 0x2881, 0x28A1, 0x6201, 0xFE02, 0xF602, 0xF623,
-    0xFE23, 0xF643, 0xF664, 0xFE84, 0xF6A4, 0xF6C4, 0xFEC5, 0xF705,
-    0xFEE5, 0xF6C4, 0xFEA4, 0xCD43, 0x72A3, 0x6223, 0x51A2, 0x4983,
-    0x4142, 0x3902, 0x38E2, 0x28A1, 0x2081, 0x1861, 0x1841, 0x1020,
-    0x0820, 0x0800, 0x0800, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0020, 0x0000, 0x0820, 0x0800, 0x0820, 0x1020,
-    0x1041, 0x2061, 0x2061, 0x28A1, 0x28A1, 0x8303, 0xF602, 0xF622,
-    0xF643, 0xF644, 0xFE83, 0xF684, 0xF6A4, 0xFEC5, 0xF705, 0xFF05,
-    0xF705, 0xFEE5, 0xFEE4, 0x9BC3, 0x7AC3, 0x6223, 0x6223, 0x59C2,
-    0x4122, 0x4122, 0x8323, 0x28A1, 0x2081, 0x2061, 0x1841, 0x1020,
-    0x0820, 0x0800, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0820, 0x0820, 0x1020,
-    0x1841, 0x2061, 0x2081, 0x2881, 0x30C1, 0x3902, 0x59C2, 0x8B83,
-    0xAC43, 0xC4C2, 0xE5A2, 0xF6C4, 0xFEC4, 0xF705, 0xFF05, 0xFF45,
-    0xF705, 0xF705, 0xFEC4, 0x8B63, 0x72C3, 0x6223, 0x6223, 0x51A2,
-    0x4122, 0x59C1, 0xE5C2, 0x28A1, 0x2081, 0x2061, 0x1041, 0x1020,
-    0x0820, 0x0800, 0x0800, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0020, 0x0000, 0x0820, 0x0800, 0x0820, 0x1020,
-    0x1041, 0x2061, 0x2061, 0x28A1, 0x30C1, 0x3902, 0x4142, 0x59A2,
-    0x6223, 0x6A82, 0x72A3, 0xB503, 0xFEC5, 0xF705, 0xFF45, 0xF745,
-    0xFF45, 0xFF05, 0xFEE5, 0x8B83, 0x7AC3, 0x6A82, 0x6223, 0x59A2,
-    0x4142, 0x6201, 0xF622, 0x6A21, 0x2081, 0x2061, 0x1841, 0x1020,
-    0x0820, 0x0800, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0800, 0x0820, 0x1020,
-    0x1841, 0x2061, 0x2081, 0x28A1, 0x38E2, 0x3902, 0x4142, 0x59A2,
-    0x6223, 0x6A82, 0x7AC3, 0xAC43, 0xFEE5, 0xFF05, 0xFF45, 0xFF45,
-    0xFF45, 0xF705, 0xFEC5, 0x9423, 0x72C3, 0x6A82, 0x6223, 0x51A2,
-    0x4122, 0x8323, 0xFE22, 0x9BC3, 0x2061, 0x1861, 0x1841, 0x1020,
-    0x0820, 0x0800, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0800, 0x0820, 0x1020,
-    0x1841, 0x1861, 0x2081, 0x28A1, 0x38E2, 0x3902, 0x5162, 0x51A2,
-    0x6223, 0x6A82, 0x72A3, 0xB503, 0xFF05, 0xF706, 0xFF45, 0xFF46,
-    0xFF45, 0xF705, 0xFF05, 0xD563, 0x72C3, 0x7282, 0x6223, 0x51A2,
-    0x4962, 0x9BC3, 0xFE42, 0xE5A2, 0x2081, 0x2061, 0x1841, 0x1020,
-    0x0820, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0020, 0x0800, 0x0820, 0x0820, 0x1020,
-    0x1841, 0x2061, 0x2081, 0x2881, 0x38E2, 0x3902, 0x5162, 0x51C2,
-    0x6223, 0x7282, 0x72C3, 0xDE03, 0xFF05, 0xF726, 0xFF46, 0xFF46,
-    0xFF46, 0xF726, 0xF705, 0xFEE5, 0x9BA3, 0x6A82, 0x6223, 0x51A2,
-    0x5162, 0xC4C2, 0xF662, 0xF642, 0x30A1, 0x1861, 0x1041, 0x1020,
-    0x0820, 0x0800, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0020, 0x0800, 0x0800, 0x0820, 0x1020,
-    0x1041, 0x2061, 0x2081, 0x30A1, 0x30E2, 0x4142, 0x7282, 0x51A2,
-    0x6203, 0x6A82, 0x8303, 0xEEC5, 0xF705, 0xFF26, 0xFF46, 0xF746,
-    0xFF46, 0xFF06, 0xF705, 0xFEE5, 0xFEA4, 0x9BC3, 0x6223, 0x59A2,
-    0x51A2, 0xEE43, 0xF662, 0xFE62, 0x4981, 0x2061, 0x1841, 0x1020,
-    0x0820, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0020, 0x0000, 0x0820, 0x0000, 0x0820, 0x1020,
-    0x1841, 0x2061, 0x2081, 0x30A1, 0x30E2, 0xB463, 0x72C3, 0x59A2,
-    0x6223, 0x6284, 0xA3C3, 0xFF25, 0xF705, 0xFF26, 0xFF26, 0xF746,
-    0xFF4A, 0xFF26, 0xF705, 0xF705, 0xFEC5, 0xF6C4, 0xB503, 0x72A3,
-    0xC4C2, 0xF682, 0xFE82, 0xF662, 0x51A1, 0x1861, 0x1841, 0x1020,
-    0x0820, 0x0800, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0020, 0x0000, 0x0820, 0x0800, 0x0820, 0x1020,
-    0x1041, 0x2061, 0x2061, 0x28A1, 0x8323, 0xFE82, 0x51C2, 0x51A2,
-    0x6223, 0x72A3, 0xB503, 0xFF05, 0xF706, 0xFF26, 0xF726, 0xFF4A,
-    0xFFB0, 0xF706, 0xFF26, 0xF705, 0xFEC5, 0xF6E5, 0xFEC4, 0xF6A4,
-    0xFEA4, 0xF682, 0xF682, 0xFEA2, 0x59C1, 0x2061, 0x1041, 0x1020,
-    0x0820, 0x0800, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0820, 0x0820, 0x1020,
-    0x1841, 0x2061, 0x2081, 0x3901, 0xF643, 0xE602, 0x4183, 0x51C2,
-    0x6223, 0x72C3, 0xDE03, 0xFF05, 0xFF26, 0xF726, 0xFF46, 0xFF4C,
-    0xFF94, 0xF707, 0xF726, 0xFF05, 0xF705, 0xFEE5, 0xF6C4, 0xF6A4,
-    0xFEA4, 0xF6A2, 0xF682, 0xF682, 0x3101, 0x1841, 0x1841, 0x1020,
-    0x0820, 0x0800, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0800, 0x0820, 0x1020,
-    0x1841, 0x1861, 0x2881, 0x9381, 0xFE82, 0xD563, 0x51A2, 0x6223,
-    0x6284, 0x72C3, 0xF6E5, 0xF706, 0xFF26, 0xF746, 0xFF27, 0xF7B0,
-    0xFF95, 0xFF4A, 0xFF26, 0xF706, 0xFF05, 0xF705, 0xFEE5, 0xF6C4,
-    0xFEC3, 0xF6C2, 0xFEC2, 0xD563, 0x28A1, 0x2081, 0x1041, 0x1020,
-    0x0820, 0x0820, 0x0800, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0020, 0x0000, 0x0820, 0x0800, 0x0820, 0x1020,
-    0x1041, 0x20A1, 0x28A1, 0xE602, 0xFEC2, 0xBCC2, 0x51A2, 0x6223,
-    0x6A84, 0x9423, 0xFF26, 0xFF27, 0xFF07, 0xFF47, 0xF747, 0xFFB4,
-    0xFF95, 0xFFB0, 0xF727, 0xFF07, 0xF726, 0xF705, 0xFF05, 0xFEE5,
-    0xF6C4, 0xF6C3, 0xFEA2, 0x8321, 0x28A1, 0x1881, 0x1841, 0x1841,
-    0x0820, 0x0800, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0020, 0x0000, 0x0820, 0x0800, 0x0820, 0x1020,
-    0x1041, 0x1881, 0x51A1, 0xFEC2, 0xFEE3, 0xAC43, 0x51A2, 0x6223,
-    0x6264, 0xCE26, 0xF707, 0xFF27, 0xF747, 0xFF48, 0xFF4A, 0xF7B5,
-    0xFF95, 0xFFB4, 0xFF47, 0xF707, 0xFF07, 0xFF26, 0xF705, 0xF6E5,
-    0xFEE5, 0xFEC3, 0xE602, 0x4942, 0x28E1, 0x18A1, 0x2061, 0x1841,
-    0x1020, 0x0800, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0820, 0x1020, 0x1841,
-    0x2061, 0x1881, 0x72A2, 0xFEC2, 0xFEC3, 0x9423, 0x51A2, 0x6223,
-    0x8323, 0xFF26, 0xFF27, 0xFF47, 0xFF48, 0xF748, 0xFF8D, 0xFF95,
-    0xFFB5, 0xFF95, 0xF74C, 0xFF48, 0xFF47, 0xF748, 0xFF26, 0xF705,
-    0xFF05, 0xF704, 0x72A3, 0x3101, 0x28E1, 0x2081, 0x1881, 0x1841,
-    0x1020, 0x0820, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0820, 0x1020, 0x1841,
-    0x1881, 0x1881, 0x8303, 0xF6C3, 0xFF04, 0xB443, 0x5224, 0x6264,
-    0xB503, 0xF727, 0xFF47, 0xFF48, 0xFF49, 0xF769, 0xFFB2, 0xFFB6,
-    0xFFD6, 0xFFB6, 0xFFB2, 0xFF48, 0xF74C, 0xFF4C, 0xFF27, 0xF726,
-    0xFF05, 0xEEC5, 0x4983, 0x3162, 0x28E1, 0x20C1, 0x2081, 0x1080,
-    0x1020, 0x0840, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0020, 0x0820, 0x0840, 0x1020, 0x1060,
-    0x2081, 0x18C1, 0xBD23, 0xFF23, 0xFF04, 0xB503, 0x5224, 0x6264,
-    0xF6C5, 0xFF68, 0xFF48, 0xFF49, 0xFF6A, 0xF74A, 0xFFD5, 0xFFD6,
-    0xFFB6, 0xFFD6, 0xFFB6, 0xFFB0, 0xFFB6, 0xFF4C, 0xFF47, 0xF707,
-    0xFF26, 0xEEC5, 0x41C3, 0x3162, 0x2922, 0x28E1, 0x2081, 0x1080,
-    0x1020, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0820, 0x1020, 0x1080,
-    0x1881, 0x4A42, 0xF723, 0xFF03, 0xFF04, 0xDE45, 0x5224, 0xB503,
-    0xFF47, 0xFF48, 0xF749, 0xFF6A, 0xFF4A, 0xF7AF, 0xFFB7, 0xFFD7,
-    0xFFB7, 0xFFD7, 0xFFB7, 0xFFB6, 0xFFD6, 0xFF8D, 0xFF48, 0xFF47,
-    0xFF26, 0xFF26, 0x9C43, 0x39A2, 0x2922, 0x28E1, 0x20C1, 0x18A0,
-    0x0840, 0x0840, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0020, 0x0820, 0x0840, 0x1020, 0x1060,
-    0x2081, 0xA4C4, 0xFF23, 0xFF23, 0xF705, 0xFF26, 0xC5A5, 0xF747,
-    0xFF48, 0xFF69, 0xFF4A, 0xF76A, 0xFF8C, 0xFFD5, 0xFFD7, 0xFFD7,
-    0xFFD7, 0xF7D7, 0xFFB7, 0xFFD7, 0xFFB6, 0xFFB0, 0xFF49, 0xF748,
-    0xFF47, 0xFF45, 0xF6E5, 0x72C3, 0x3162, 0x28C1, 0x18C1, 0x18A0,
-    0x1041, 0x0840, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0840, 0x0840, 0x18A0,
-    0x18A1, 0xD603, 0xF703, 0xF703, 0xFF45, 0xFF46, 0xFF47, 0xF748,
-    0xFF69, 0xFF4A, 0xFF4A, 0xF78C, 0xFFB0, 0xFFD8, 0xFFD8, 0xFFD8,
-    0xFFD8, 0xFFD8, 0xFFD8, 0xFFD7, 0xFFD7, 0xFFD5, 0xFF8C, 0xF748,
-    0xFF47, 0xFF46, 0xFF45, 0xEEC5, 0x49E3, 0x3122, 0x20C1, 0x18A0,
-    0x1080, 0x0840, 0x0020, 0x0820, 0x0020, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0840, 0x0840, 0x18A0,
-    0x20C1, 0xDE23, 0xFF23, 0xFF44, 0xF745, 0xFF46, 0xFF47, 0xFF48,
-    0xF749, 0xFF4A, 0xFF8C, 0xFF8D, 0xFFD5, 0xFFD8, 0xFFD8, 0xFFD9,
-    0xFFF9, 0xFFD8, 0xFFD8, 0xFFD8, 0xFFD7, 0xFFD7, 0xFFB5, 0xF74A,
-    0xFF48, 0xFF47, 0xF745, 0xFF44, 0xC5A5, 0x2922, 0x20E1, 0x10A0,
-    0x1080, 0x0840, 0x0020, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0020, 0x0000, 0x0820, 0x0840, 0x1080, 0x1080,
-    0x18A1, 0xD603, 0xF703, 0xFF44, 0xF745, 0xFF46, 0xFF48, 0xFF69,
-    0xF74A, 0xFF8C, 0xFF8D, 0xF7B0, 0xFFF9, 0xFFD9, 0xFFFA, 0xFFDA,
-    0xFFFA, 0xFFDA, 0xFFD9, 0xFFD8, 0xFFD8, 0xFFD7, 0xFFD7, 0xFFD2,
-    0xFF48, 0xFF47, 0xFF46, 0xFF45, 0xFF44, 0x7384, 0x2901, 0x2081,
-    0x1080, 0x0840, 0x0840, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0020, 0x0820, 0x0860, 0x1080, 0x18A0,
-    0x20C1, 0xDE03, 0xFF44, 0xF744, 0xFF46, 0xFF86, 0xFF88, 0xF749,
-    0xFFAB, 0xFF8C, 0xFFAF, 0xFFD6, 0xFFD9, 0xFFDA, 0xFFFB, 0xFFDB,
-    0xFFFB, 0xFFDA, 0xFFFA, 0xFFD9, 0xFFD8, 0xFFD8, 0xFFD7, 0xFFD6,
-    0xFF8A, 0xF788, 0xFF66, 0xFF65, 0xF744, 0xE6A3, 0x20E1, 0x18C1,
-    0x1060, 0x0840, 0x0840, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0820, 0x0020, 0x0840, 0x1080, 0x1080,
-    0x18A1, 0xD603, 0xFF44, 0xF744, 0xFF46, 0xFF87, 0xF78C, 0xFFAA,
-    0xFF8C, 0xF78D, 0xFFB0, 0xFFD9, 0xFFFA, 0xFFDB, 0xFFDC, 0xFFFC,
-    0xFFDC, 0xFFFC, 0xFFFB, 0xFFDA, 0xFFD9, 0xFFD8, 0xFFD7, 0xFFD6,
-    0xFFB0, 0xFF88, 0xF766, 0xFF85, 0xFF44, 0xFF44, 0x41E2, 0x20C1,
-    0x1080, 0x0840, 0x0840, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0020, 0x0020, 0x0820, 0x0840, 0x1080, 0x18A0,
-    0x20C1, 0xC5C5, 0xFF44, 0xFF85, 0xFF66, 0xFF88, 0xFFD4, 0xFFB2,
-    0xF78C, 0xFFAF, 0xFFD4, 0xFFDA, 0xFFFB, 0xFFFC, 0xFFFD, 0xFFFD,
-    0xFFFD, 0xFFFD, 0xFFDC, 0xFFDA, 0xFFF9, 0xFFD8, 0xFFD7, 0xFFD7,
-    0xFFD5, 0xF789, 0xFF47, 0xFF66, 0xF765, 0xFF44, 0x6303, 0x18C1,
-    0x1880, 0x0840, 0x0840, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0840, 0x1080, 0x1880,
-    0x18C1, 0xAD45, 0xFF44, 0xF765, 0xF766, 0xFF8B, 0xFFD6, 0xFFB6,
-    0xFFD4, 0xF7B0, 0xFFD7, 0xFFFA, 0xFFDB, 0xFFFD, 0xFFFE, 0xFFFE,
-    0xFFFE, 0xFFFD, 0xFFFC, 0xFFDB, 0xFFDA, 0xFFD8, 0xFFD8, 0xFFD7,
-    0xFFD6, 0xFF8C, 0xFF88, 0xFF66, 0xFF85, 0xFF44, 0x83E4, 0x20C1,
-    0x18A0, 0x1060, 0x0840, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0020, 0x0820, 0x0020, 0x1040, 0x1080, 0x18A0,
-    0x20C1, 0xB503, 0xFF85, 0xFF86, 0xFF87, 0xFFAF, 0xFFD6, 0xFFB7,
-    0xFFD7, 0xFFD8, 0xFFD9, 0xFFFA, 0xFFDB, 0xFFFD, 0xFFFE, 0xFFFE,
-    0xFFFE, 0xFFFE, 0xFFFC, 0xFFDB, 0xFFFA, 0xFFD9, 0xFFD8, 0xFFD7,
-    0xFFD6, 0xFFAF, 0xF788, 0xFF66, 0xFF65, 0xFF65, 0x7BC4, 0x18C1,
-    0x10A0, 0x1060, 0x0840, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0020, 0x0840, 0x0840, 0x1060, 0x10A0,
-    0x18C1, 0x9423, 0xFF65, 0xFF66, 0xF787, 0xFFB0, 0xFFB6, 0xFFD7,
-    0xFFD7, 0xFFF8, 0xFFD9, 0xFFFA, 0xFFDB, 0xFFFD, 0xFFFE, 0xFFFE,
-    0xFFFE, 0xFFFD, 0xFFFC, 0xFFDB, 0xFFDA, 0xFFD8, 0xFFD8, 0xFFD7,
-    0xFFD6, 0xFFD2, 0xFF88, 0xFF87, 0xFF66, 0xFF85, 0x7384, 0x20C1,
-    0x1060, 0x1080, 0x0840, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0020, 0x0820, 0x0840, 0x0840, 0x1080, 0x18A0,
-    0x20C1, 0x83C4, 0xFF85, 0xFF86, 0xFF87, 0xFFB0, 0xFFD6, 0xFFB7,
-    0xFFD7, 0xFFD8, 0xFFD9, 0xFFFA, 0xFFDB, 0xFFFC, 0xFFFD, 0xFFFE,
-    0xFFFD, 0xFFFD, 0xFFFC, 0xFFDB, 0xFFDA, 0xFFD8, 0xFFD8, 0xFFD7,
-    0xFFD6, 0xF7D4, 0xFF88, 0xFF87, 0xF766, 0xFF65, 0x5AA3, 0x1080,
-    0x1060, 0x0840, 0x0840, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0020, 0x0020, 0x0820, 0x0840, 0x1060, 0x10A0,
-    0x18C1, 0x6303, 0xFF66, 0xFF66, 0xF787, 0xFFB0, 0xFFD6, 0xFFD6,
-    0xFFD7, 0xFFD8, 0xFFD8, 0xFFD9, 0xFFFA, 0xFFDB, 0xFFDC, 0xFFFD,
-    0xFFFC, 0xFFFC, 0xFFDB, 0xFFFA, 0xFFD9, 0xFFD8, 0xFFD8, 0xFFB7,
-    0xFFD6, 0xFFD4, 0xFFA8, 0xFF87, 0xFF66, 0xFF85, 0x41E2, 0x18A0,
-    0x1080, 0x0840, 0x0840, 0x0820, 0x0020, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0820, 0x0020, 0x0840, 0x0840, 0x1080,
-    0x20C1, 0x41E2, 0xFF86, 0xFFA7, 0xFF87, 0xFFAF, 0xFFD6, 0xFFB6,
-    0xFFD7, 0xFFD8, 0xFFD8, 0xFFD9, 0xFFFA, 0xFFDB, 0xFFFB, 0xFFDB,
-    0xFFFB, 0xFFDB, 0xFFFA, 0xFFD9, 0xFFF9, 0xFFD8, 0xFFD7, 0xFFD7,
-    0xFFB6, 0xFFD5, 0xFF88, 0xFF87, 0xFF66, 0xEF25, 0x20E1, 0x10A0,
-    0x1060, 0x0840, 0x0840, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0840, 0x0840, 0x1060,
-    0x10A0, 0x20E1, 0xF766, 0xFF87, 0xF788, 0xFFAD, 0xFFB6, 0xFFD6,
-    0xFFD7, 0xFFD7, 0xFFD8, 0xFFD8, 0xFFD9, 0xFFFA, 0xFFDA, 0xFFFA,
-    0xFFDA, 0xFFFA, 0xFFD9, 0xFFF9, 0xFFD8, 0xFFD8, 0xFFD7, 0xFFB7,
-    0xFFD6, 0xFFD2, 0xFF88, 0xFF87, 0xFF87, 0xC5C5, 0x20C1, 0x18A0,
-    0x1080, 0x0840, 0x0840, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0840, 0x0840, 0x1080,
-    0x18A0, 0x20C1, 0xCE26, 0xFFA7, 0xFFA7, 0xFF8B, 0xFFD6, 0xFFD6,
-    0xFFB7, 0xFFD7, 0xFFD8, 0xFFD8, 0xFFD8, 0xFFD9, 0xFFF9, 0xFFD9,
-    0xFFF9, 0xFFD9, 0xFFF9, 0xFFD8, 0xFFD8, 0xFFD7, 0xFFD7, 0xFFD6,
-    0xFFF6, 0xFFB0, 0xF7A8, 0xFF87, 0xFF87, 0x9423, 0x18C1, 0x1080,
-    0x1080, 0x0820, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0840, 0x0840, 0x1080,
-    0x1080, 0x18C1, 0x9445, 0xF787, 0xFFA7, 0xFFA8, 0xF7D4, 0xFFD6,
-    0xFFF6, 0xFFD7, 0xFFD7, 0xFFD8, 0xFFF8, 0xFFD8, 0xFFD9, 0xFFF9,
-    0xFFD9, 0xFFF9, 0xFFD8, 0xFFF8, 0xFFD8, 0xFFD7, 0xFFD7, 0xFFF6,
-    0xFFD6, 0xFFCD, 0xFFA8, 0xFFA7, 0xFFA7, 0x5262, 0x18A0, 0x1080,
-    0x0840, 0x0820, 0x0840, 0x0820, 0x0020, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x0020, 0x0840, 0x0840,
-    0x1080, 0x18A0, 0x5262, 0xFFA7, 0xFFA7, 0xFFA8, 0xFFB0, 0xFFD6,
-    0xFFF6, 0xFFD7, 0xFFF7, 0xFFD7, 0xFFD8, 0xFFD8, 0xFFD8, 0xFFD8,
-    0xFFF8, 0xFFD8, 0xFFD8, 0xFFF8, 0xFFD7, 0xFFD7, 0xFFF6, 0xFFD6,
-    0xFFD5, 0xFFC9, 0xF7A8, 0xFFA7, 0xEF47, 0x18A1, 0x1080, 0x1080,
-    0x0840, 0x0840, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0840, 0x0840,
-    0x0880, 0x1080, 0x18A1, 0xE707, 0xFFA7, 0xFFA8, 0xFFCC, 0xFFD6,
-    0xFFF6, 0xFFD6, 0xFFF6, 0xF7D7, 0xFFF7, 0xFFD7, 0xFFF8, 0xFFD7,
-    0xFFB0, 0xFFD5, 0xFFD7, 0xFFF7, 0xFFD7, 0xFFF6, 0xFFD6, 0xFFF6,
-    0xFFB0, 0xFFA8, 0xFFA8, 0xFFA7, 0xC5C5, 0x20C1, 0x1080, 0x1060,
-    0x0840, 0x0840, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x0820, 0x0840,
-    0x0840, 0x1080, 0x18A0, 0xA4C4, 0xFFC7, 0xFFA8, 0xFFCB, 0xFFD6,
-    0xFFD6, 0xFFD6, 0xFFF6, 0xFFD6, 0xFFD7, 0xFFD7, 0xFFF6, 0xFFAF,
-    0xFFAD, 0xFFD2, 0xFFD7, 0xF7F7, 0xFFD6, 0xFFF6, 0xFFD6, 0xFFD5,
-    0xFF8A, 0xFFA8, 0xFFA8, 0xF7A7, 0x7BC4, 0x10A0, 0x1060, 0x0840,
-    0x0840, 0x0020, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0840,
-    0x0840, 0x1080, 0x1080, 0x4A42, 0xFFA7, 0xFFA8, 0xF7C9, 0xFFD5,
-    0xFFD6, 0xFFF6, 0xFFD6, 0xFFF6, 0xFFD6, 0xFFD5, 0xFFAD, 0xFFCC,
-    0xFFAC, 0xF7AF, 0xFFB7, 0xFFD6, 0xFFF6, 0xFFD6, 0xFFD6, 0xFFAF,
-    0xFFC9, 0xFFA8, 0xFFC8, 0xEF07, 0x2901, 0x1080, 0x0840, 0x0820,
-    0x0840, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0820,
-    0x0840, 0x0840, 0x1080, 0x18A0, 0xE6E6, 0xFFA8, 0xFFA8, 0xFFD2,
-    0xFFD6, 0xFFF6, 0xFFD6, 0xFFF6, 0xFFD4, 0xFFAC, 0xFFCB, 0xCE68,
-    0xFFCB, 0xFFAC, 0xFFD6, 0xFFF6, 0xFFD6, 0xFFF6, 0xFFB2, 0xF7C9,
-    0xFFA8, 0xFFA8, 0xFFA8, 0x6B64, 0x1080, 0x1080, 0x0840, 0x0840,
-    0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,
-    0x0020, 0x0840, 0x0840, 0x0860, 0x7364, 0xFFA8, 0xF7A8, 0xFFCB,
-    0xFFD5, 0xFFD6, 0xFFD5, 0xFFB0, 0xFFCB, 0xFFCB, 0xD668, 0x41C3,
-    0xCE68, 0xFFCB, 0xFFD4, 0xFFD6, 0xFFD6, 0xFFD4, 0xFFCA, 0xFFA9,
-    0xFFC9, 0xFFC8, 0xCE26, 0x18A0, 0x1080, 0x0840, 0x0840, 0x0820,
-    0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0820,
-    0x0020, 0x0840, 0x0840, 0x1080, 0x18A0, 0xE6C8, 0xFFC9, 0xFFC9,
-    0xFFCA, 0xFFCB, 0xFFCA, 0xFFCA, 0xFFCA, 0xF7CA, 0xAD49, 0x3982,
-    0x83C4, 0xFFEB, 0xFFCD, 0xFFD6, 0xFFD2, 0xFFCB, 0xF7C9, 0xFFA9,
-    0xFFC9, 0xEF48, 0x2902, 0x0860, 0x0840, 0x0840, 0x0840, 0x0020,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0020, 0x0020, 0x0840, 0x0840, 0x0860, 0x4A62, 0xF788, 0xFFA9,
-    0xFFC9, 0xFFC9, 0xFFCA, 0xFFCA, 0xFFCA, 0xFFEA, 0x83C4, 0x3162,
-    0x39C2, 0xF789, 0xFFCA, 0xFFCA, 0xFFCA, 0xFFCA, 0xFFC9, 0xFFC9,
-    0xFFC9, 0x62A3, 0x1080, 0x0860, 0x0840, 0x0840, 0x0020, 0x0000,
-    0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,
-    0x0000, 0x0820, 0x0020, 0x0840, 0x0840, 0x1080, 0x9C65, 0xFFC9,
-    0xFFC9, 0xFFC9, 0xFFA9, 0xFFCA, 0xFFCA, 0xFFCA, 0x5AA3, 0x2902,
-    0x2922, 0xCE26, 0xFFCA, 0xFFCA, 0xFFCA, 0xFFC9, 0xFFC9, 0xF7A9,
-    0x7BC4, 0x0860, 0x0840, 0x0840, 0x0820, 0x0020, 0x0820, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0020, 0x0040, 0x0840, 0x0840, 0x1080, 0xAD45,
-    0xFFC9, 0xFFCA, 0xFFCA, 0xFFCA, 0xFFCA, 0xEF28, 0x2101, 0x20C1,
-    0x18C1, 0x7364, 0xFFCA, 0xFFCA, 0xFFCA, 0xFFCA, 0xFFC9, 0x83E4,
-    0x1080, 0x0840, 0x0840, 0x0840, 0x0820, 0x0020, 0x0020, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0020, 0x0000, 0x0820, 0x0020, 0x0840, 0x0840, 0x1080,
-    0x9C65, 0xF76A, 0xFFCA, 0xFFCA, 0xE728, 0x41E3, 0x1080, 0x18A0,
-    0x18A0, 0x20C1, 0xCE26, 0xFFEA, 0xFFCA, 0xCE68, 0x49C3, 0x0840,
-    0x0840, 0x0040, 0x0840, 0x0020, 0x0820, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0020, 0x0820, 0x0840,
-    0x0840, 0x1080, 0x3962, 0x3982, 0x10A0, 0x1080, 0x1060, 0x1080,
-    0x1060, 0x1080, 0x18A0, 0x41E2, 0x3962, 0x1080, 0x0840, 0x0020,
-    0x0840, 0x0840, 0x0820, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x0020, 0x0820,
-    0x0840, 0x0840, 0x0820, 0x0840, 0x0860, 0x0840, 0x0860, 0x0840,
-    0x1060, 0x0840, 0x0860, 0x0840, 0x1060, 0x0840, 0x0820, 0x0040,
-    0x0020, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,
-    0x0820, 0x0020, 0x0020, 0x0840, 0x0820, 0x0040, 0x0820, 0x0840,
-    0x0820, 0x0040, 0x0820, 0x0840, 0x0840, 0x0820, 0x0020, 0x0820,
-    0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000,
-    0x0020, 0x0000, 0x0820, 0x0020, 0x0820, 0x0020, 0x0820, 0x0020,
-    0x0820, 0x0020, 0x0820, 0x0020, 0x0820, 0x0020, 0x0020, 0x0000,
-    0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0020, 0x0000, 0x0820, 0x0020, 0x0820, 0x0020,
-    0x0820, 0x0020, 0x0820, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0000,
-    0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 },
-  { 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x1861, 0x91E2, 0x1041, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0820, 0xAA62, 0xD2A2, 0x5961, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x4121, 0xDAA2, 0xD2A2, 0x89E2, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x4121, 0xD2A2, 0x91E2, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x91E2, 0x8A02, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2061, 0x5141, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000,
-    0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000,
-    0x0020, 0x0000, 0x0020, 0x0000, 0x0020, 0x0000, 0x0020, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0000, 0x0020, 0x0800,
-    0x0020, 0x0000, 0x0020, 0x0000, 0x0020, 0x0000, 0x0020, 0x0000,
-    0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0000, 0x0820, 0x0800,
-    0x0020, 0x0000, 0x0020, 0x0800, 0x0020, 0x0000, 0x0020, 0x0000,
-    0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,
-    0x0000, 0x0020, 0x0000, 0x0020, 0x0000, 0x0820, 0x0000, 0x0820,
-    0x0000, 0x0820, 0x0000, 0x0820, 0x0000, 0x0820, 0x0800, 0x0020,
-    0x0000, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000,
-    0x0020, 0x0800, 0x0820, 0x0000, 0x0820, 0x0000, 0x0820, 0x0800,
-    0x0820, 0x0800, 0x0020, 0x0800, 0x0820, 0x0800, 0x0020, 0x0000,
-    0x0820, 0x0000, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020,
-    0x0000, 0x0020, 0x0800, 0x0020, 0x0800, 0x0820, 0x0800, 0x0820,
-    0x0820, 0x0820, 0x0820, 0x0800, 0x0820, 0x0000, 0x0820, 0x0800,
-    0x0820, 0x0800, 0x0020, 0x0000, 0x0820, 0x0000, 0x0020, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0800,
-    0x0820, 0x0800, 0x0020, 0x0800, 0x0820, 0x0820, 0x0820, 0x0820,
-    0x0820, 0x1020, 0x0820, 0x0820, 0x0820, 0x1020, 0x0820, 0x0800,
-    0x0820, 0x0800, 0x0020, 0x0000, 0x0020, 0x0000, 0x0020, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0000,
-    0x0820, 0x0800, 0x0820, 0x0820, 0x0820, 0x1020, 0x1020, 0x1020,
-    0x1020, 0x1020, 0x1020, 0x1020, 0x1020, 0x1020, 0x0820, 0x0820,
-    0x0820, 0x0800, 0x0820, 0x0000, 0x0820, 0x0000, 0x0820, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0820, 0x0800, 0x0820,
-    0x0820, 0x0820, 0x0820, 0x1020, 0x1020, 0x1020, 0x1020, 0x1841,
-    0x1841, 0x1041, 0x1841, 0x1841, 0x1841, 0x1020, 0x1020, 0x1020,
-    0x0820, 0x0820, 0x0800, 0x0820, 0x0000, 0x0820, 0x0000, 0x0020,
-    0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0820, 0x0800, 0x0820,
-    0x0820, 0x0820, 0x1020, 0x1020, 0x1841, 0x1841, 0x1841, 0x1041,
-    0x1841, 0x1841, 0x1841, 0x1041, 0x1841, 0x1841, 0x1841, 0x1020,
-    0x1020, 0x1020, 0x0820, 0x0820, 0x0820, 0x0800, 0x0020, 0x0000,
-    0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0020, 0x0000, 0x0020, 0x0800, 0x0820, 0x0800, 0x0820,
-    0x1020, 0x1020, 0x1020, 0x1041, 0x1841, 0x1841, 0x2061, 0x1861,
-    0x2061, 0x1861, 0x2061, 0x2061, 0x1861, 0x1841, 0x1841, 0x1041,
-    0x1841, 0x1020, 0x1020, 0x0820, 0x0820, 0x0820, 0x0800, 0x0020,
-    0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0020, 0x0000, 0x0020, 0x0800, 0x0820, 0x0820, 0x0820,
-    0x1020, 0x1841, 0x1841, 0x1841, 0x1861, 0x2061, 0x1861, 0x30A1,
-    0x38E2, 0x2881, 0x2081, 0x2081, 0x2061, 0x1861, 0x2061, 0x1841,
-    0x1841, 0x1041, 0x1020, 0x1020, 0x0820, 0x0800, 0x0820, 0x0800,
-    0x0020, 0x0800, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0020, 0x0000, 0x0820, 0x0800, 0x0820, 0x0820, 0x1020,
-    0x1841, 0x1841, 0x1041, 0x2061, 0x2081, 0x69A1, 0xCB22, 0xE383,
-    0xE383, 0xDB23, 0xAA82, 0x5141, 0x2081, 0x2061, 0x2081, 0x2061,
-    0x1861, 0x1841, 0x1841, 0x1020, 0x1020, 0x0820, 0x0800, 0x0800,
-    0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0020, 0x0000, 0x0820, 0x0800, 0x0820, 0x1020, 0x1020,
-    0x1841, 0x1041, 0x1861, 0x5141, 0xBB22, 0xE383, 0xE383, 0xE383,
-    0xE383, 0xE383, 0xE383, 0xE383, 0x9282, 0x30A1, 0x2081, 0x2081,
-    0x2061, 0x1861, 0x1841, 0x1841, 0x1020, 0x1020, 0x0820, 0x0800,
-    0x0820, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,
-    0x0000, 0x0820, 0x0800, 0x0820, 0x0820, 0x1020, 0x1020, 0x1841,
-    0x1041, 0x2061, 0x2081, 0x7A21, 0xEB83, 0xE383, 0xE383, 0xE383,
-    0xE383, 0xE383, 0xDB83, 0xE383, 0xE383, 0xAA62, 0x28A1, 0x20A1,
-    0x2061, 0x2081, 0x2061, 0x1041, 0x1841, 0x1020, 0x0820, 0x0820,
-    0x0800, 0x0800, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,
-    0x0000, 0x0820, 0x0800, 0x0800, 0x0820, 0x1020, 0x1041, 0x1841,
-    0x1861, 0x2081, 0x2081, 0x28A1, 0xE383, 0xE383, 0xE383, 0xE3C3,
-    0xE3E3, 0xEBC3, 0xE3E3, 0xE3C3, 0xEBE3, 0xE383, 0xAA82, 0x30A1,
-    0x2881, 0x2081, 0x2061, 0x1861, 0x1841, 0x1020, 0x1020, 0x0820,
-    0x0820, 0x0800, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,
-    0x0000, 0x0820, 0x0800, 0x0820, 0x1020, 0x1020, 0x1841, 0x1861,
-    0x2881, 0x28A1, 0x2881, 0x30C1, 0xC322, 0xEBC3, 0xE3E3, 0xEBC3,
-    0xE3E3, 0xE3C3, 0xE3E3, 0xEBC3, 0xE3E3, 0xE3C3, 0xE3E3, 0x7A21,
-    0x28A1, 0x2881, 0x2081, 0x2061, 0x1041, 0x1841, 0x1020, 0x0820,
-    0x0820, 0x0800, 0x0800, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000,
-    0x0820, 0x0000, 0x0820, 0x0820, 0x1020, 0x1841, 0x1861, 0x69A1,
-    0x38E2, 0x2881, 0x30C1, 0x30E2, 0xB322, 0xE3E3, 0xE3C3, 0xE424,
-    0xEC84, 0xEC24, 0xE424, 0xEC24, 0xEBE3, 0xE3C3, 0xE3E3, 0xEB83,
-    0x4121, 0x30A1, 0x28A1, 0x2081, 0x2061, 0x1041, 0x1020, 0x1020,
-    0x0820, 0x0800, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,
-    0x0000, 0x0820, 0x0820, 0x1020, 0x1020, 0x1841, 0x38E2, 0xE383,
-    0x69A1, 0x28C1, 0x38E2, 0x3921, 0xCBA2, 0xEC24, 0xEC24, 0xEC84,
-    0xF648, 0xEC84, 0xE424, 0xEC24, 0xE424, 0xEC24, 0xE424, 0xE3C3,
-    0xC302, 0x30E2, 0x28A1, 0x2081, 0x2061, 0x1861, 0x1841, 0x1020,
-    0x0820, 0x0800, 0x0800, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000,
-    0x0020, 0x0800, 0x0820, 0x1020, 0x1841, 0x1861, 0x89E2, 0xEBE3,
-    0x5141, 0x30C1, 0x30E2, 0x4122, 0xE3C3, 0xEC24, 0xE424, 0xECC6,
-    0xF628, 0xF5E8, 0xEC84, 0xEC63, 0xE424, 0xEC24, 0xEC24, 0xEC24,
-    0xEC23, 0x7A21, 0x30C1, 0x28A1, 0x2081, 0x2061, 0x1041, 0x1020,
-    0x1020, 0x0800, 0x0820, 0x0800, 0x0020, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0800,
-    0x0820, 0x0800, 0x1020, 0x1020, 0x1041, 0x2061, 0xCB22, 0xC322,
-    0x30C1, 0x30E2, 0x3902, 0x6A21, 0xEC24, 0xEC24, 0xEC63, 0xECE4,
-    0xF6A9, 0xF6A9, 0xF628, 0xECC4, 0xEC84, 0xEC63, 0xEC24, 0xEC24,
-    0xE423, 0xE3C3, 0x4962, 0x28A1, 0x2081, 0x2061, 0x1861, 0x1020,
-    0x1020, 0x0820, 0x0800, 0x0800, 0x0020, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020,
-    0x0800, 0x0820, 0x1020, 0x1020, 0x1041, 0x2881, 0xCBA2, 0x40E2,
-    0x30C1, 0x3902, 0x4122, 0x9AE1, 0xEC63, 0xEC84, 0xEC84, 0xED05,
-    0xF6A9, 0xF689, 0xFEA9, 0xF648, 0xED25, 0xEC84, 0xEC63, 0xEC63,
-    0xEC23, 0xEC23, 0xC322, 0x30C1, 0x2881, 0x2081, 0x2061, 0x1841,
-    0x1020, 0x0820, 0x0820, 0x0800, 0x0020, 0x0000, 0x0020, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0800,
-    0x0820, 0x0820, 0x1020, 0x1841, 0x1041, 0x2061, 0x28A1, 0x30A1,
-    0x30E2, 0x3902, 0x5162, 0xEC43, 0xEC84, 0xEC84, 0xF4E4, 0xED05,
-    0xFEA9, 0xF6A9, 0xF6A9, 0xF689, 0xFEA9, 0xF5C8, 0xED05, 0xEC63,
-    0xEC63, 0xE423, 0xEC23, 0x7201, 0x2881, 0x2081, 0x1861, 0x1841,
-    0x1020, 0x0820, 0x0800, 0x0800, 0x0020, 0x0000, 0x0020, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0820,
-    0x0800, 0x0820, 0x1020, 0x1041, 0x2061, 0x2061, 0x28A1, 0x30C1,
-    0x30E2, 0x4122, 0x9262, 0xEC84, 0xEC84, 0xECE4, 0xECC4, 0xF5A6,
-    0xF689, 0xF6A9, 0xF689, 0xFEA9, 0xF689, 0xF6A9, 0xF6A9, 0xF5A6,
-    0xEC63, 0xEC83, 0xEC23, 0xEBC3, 0x38E2, 0x2081, 0x2061, 0x1841,
-    0x1020, 0x1020, 0x0820, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0820,
-    0x0800, 0x0820, 0x1020, 0x1041, 0x2061, 0x2081, 0x30A1, 0x38E2,
-    0x3922, 0x5162, 0xEC23, 0xECA4, 0xECE4, 0xECC4, 0xF544, 0xF6C9,
-    0xFEC9, 0xF6C9, 0xF6C9, 0xF6C9, 0xFEC9, 0xF6A9, 0xF6A9, 0xF689,
-    0xECC4, 0xEC63, 0xEC63, 0xEC23, 0x7A01, 0x2081, 0x2081, 0x1841,
-    0x1041, 0x1020, 0x0820, 0x0800, 0x0800, 0x0020, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0800,
-    0x0800, 0x0820, 0x1020, 0x1841, 0x1861, 0x28A1, 0x30A1, 0x30E2,
-    0x3102, 0xB322, 0xEC84, 0xF4A2, 0xECE4, 0xED05, 0xF689, 0xFEC9,
-    0xF6C9, 0xF6C9, 0xF6C9, 0xFEC9, 0xF6C9, 0xF6C9, 0xF6A9, 0xFEA9,
-    0xF5A6, 0xEC63, 0xEC63, 0xEC23, 0xCBA2, 0x28A1, 0x2081, 0x2061,
-    0x1841, 0x1020, 0x0820, 0x0800, 0x0820, 0x0000, 0x0020, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0820,
-    0x0800, 0x1020, 0x1020, 0x1841, 0x2061, 0x28A1, 0x28A1, 0x38E2,
-    0x7A62, 0xEC63, 0xF4C2, 0xECE4, 0xED05, 0xF5A6, 0xF6C9, 0xFEC9,
-    0xFF29, 0xF709, 0xFF29, 0xF6A9, 0xF646, 0xF689, 0xFEA9, 0xF689,
-    0xF628, 0xEC84, 0xEC63, 0xEC63, 0xE423, 0x28A1, 0x2061, 0x1861,
-    0x1841, 0x1020, 0x0820, 0x0800, 0x0820, 0x0000, 0x0020, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0800,
-    0x0820, 0x1020, 0x1841, 0x1041, 0x2061, 0x28A1, 0x28A1, 0x4122,
-    0xEC23, 0xEC63, 0xECC2, 0xECC4, 0xF505, 0xF6A9, 0xF6C9, 0xFF29,
-    0xFF09, 0xF6A7, 0xF645, 0xF5E5, 0xF5C4, 0xF5C4, 0xF689, 0xF6A9,
-    0xFEA9, 0xECC2, 0xEC63, 0xF463, 0xEC43, 0x28A1, 0x2081, 0x2061,
-    0x1841, 0x1020, 0x1020, 0x0800, 0x0820, 0x0000, 0x0020, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0800, 0x0820,
-    0x0820, 0x1020, 0x1841, 0x2061, 0x2081, 0x2881, 0x30C1, 0x9AE1,
-    0xF483, 0xECC2, 0xF4A2, 0xED03, 0xF583, 0xF6C9, 0xF6C9, 0xFEA9,
-    0xF666, 0xF685, 0xF646, 0xF624, 0xF5A4, 0xF5C4, 0xF646, 0xFEA9,
-    0xF6A9, 0xECC4, 0xECA2, 0xEC63, 0xDC21, 0x2081, 0x2081, 0x2061,
-    0x1041, 0x1020, 0x1020, 0x0800, 0x0000, 0x0020, 0x0000, 0x0020,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0800,
-    0x0820, 0x1020, 0x1841, 0x1861, 0x2081, 0x2881, 0x30C2, 0xEC23,
-    0xEC63, 0xECC2, 0xECA2, 0xF503, 0xF5E5, 0xF6C9, 0xF646, 0xF624,
-    0xF685, 0xFE85, 0xF685, 0xF645, 0xF5E4, 0xF5C4, 0xF5C4, 0xF689,
-    0xF6A9, 0xF503, 0xF4C2, 0xEC83, 0xB381, 0x28A1, 0x2081, 0x2061,
-    0x1841, 0x1020, 0x1020, 0x0800, 0x0820, 0x0000, 0x0020, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0820, 0x0800,
-    0x0820, 0x1020, 0x1841, 0x2061, 0x2081, 0x28A1, 0x69A1, 0xEC83,
-    0xEC82, 0xECC2, 0xF503, 0xED03, 0xF646, 0xF5C4, 0xF5C4, 0xF624,
-    0xF685, 0xE6A5, 0xDE45, 0xFE45, 0xF5E4, 0xF5C4, 0xF583, 0xF628,
-    0xF6A9, 0xF503, 0xECA2, 0xE482, 0x8A82, 0x28A1, 0x2081, 0x2061,
-    0x1041, 0x1020, 0x1020, 0x0800, 0x0000, 0x0020, 0x0000, 0x0020,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0800,
-    0x0820, 0x1020, 0x1841, 0x1861, 0x2081, 0x2881, 0x8A62, 0xEC63,
-    0xECC2, 0xF4A2, 0xED03, 0xED03, 0xF583, 0xF583, 0xF5C4, 0xEE03,
-    0xB503, 0xB545, 0xB503, 0xA4C4, 0xDD85, 0xF5C4, 0xF583, 0xF5C4,
-    0xF6A9, 0xF503, 0xECC2, 0xF4C2, 0x69C1, 0x30A1, 0x2081, 0x2061,
-    0x1841, 0x1020, 0x1020, 0x0800, 0x0820, 0x0000, 0x0020, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0800,
-    0x1020, 0x1020, 0x1841, 0x1041, 0x2061, 0x28A1, 0xB381, 0xECA2,
-    0xECC2, 0xECA2, 0xF503, 0xED03, 0xF543, 0xF583, 0xED84, 0xAC43,
-    0x9443, 0xA4C4, 0xA4A4, 0x9423, 0x9BC3, 0xED84, 0xF583, 0xF563,
-    0xF605, 0xED03, 0xF4A2, 0xDC21, 0x30E2, 0x28A1, 0x2081, 0x1861,
-    0x1841, 0x1020, 0x0820, 0x0800, 0x0800, 0x0020, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0800,
-    0x0800, 0x1020, 0x1841, 0x1841, 0x1861, 0x2081, 0xCB82, 0xECC2,
-    0xECA2, 0xECC2, 0xF503, 0xF503, 0xF563, 0xF583, 0xAC43, 0x8B83,
-    0x9423, 0x9C43, 0x9423, 0x9BC3, 0x8B83, 0xBCC2, 0xF583, 0xF543,
-    0xED03, 0xF503, 0xF4C2, 0x9B01, 0x30C1, 0x30A1, 0x2081, 0x2061,
-    0x1841, 0x1020, 0x0820, 0x0800, 0x0820, 0x0000, 0x0020, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0820,
-    0x0800, 0x1020, 0x1020, 0x1041, 0x2061, 0x28A1, 0xCC21, 0xECA1,
-    0xF4A2, 0xECC2, 0xED03, 0xF503, 0xF543, 0xD4A3, 0x8323, 0x8B83,
-    0x8B83, 0x9BC3, 0x8B83, 0x8B83, 0x8303, 0xAC43, 0xF563, 0xF543,
-    0xF503, 0xED03, 0xECA1, 0x4962, 0x28A1, 0x28A1, 0x2061, 0x2061,
-    0x1041, 0x1020, 0x0820, 0x0800, 0x0820, 0x0000, 0x0020, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0800,
-    0x0800, 0x0820, 0x1020, 0x1841, 0x1861, 0x1861, 0xCBA2, 0xF4C1,
-    0xECC1, 0xF4C1, 0xF502, 0xF502, 0xF543, 0x8323, 0x72C3, 0x8303,
-    0x8323, 0x8B83, 0x8B83, 0x8303, 0x72C3, 0x9BC3, 0xF563, 0xF543,
-    0xF502, 0xF522, 0x9AE1, 0x38E2, 0x30C1, 0x2881, 0x2881, 0x1861,
-    0x1841, 0x1020, 0x0820, 0x0820, 0x0800, 0x0020, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0820,
-    0x0800, 0x0820, 0x1020, 0x1841, 0x1861, 0x2881, 0xB381, 0xF4C1,
-    0xECC1, 0xF4C1, 0xF502, 0xF502, 0xD4C3, 0x6223, 0x6A82, 0x72C3,
-    0x72C3, 0x8303, 0x8323, 0x7AC3, 0x72C3, 0x9B23, 0xF543, 0xF542,
-    0xF502, 0xD442, 0x4122, 0x30E2, 0x28A1, 0x28A1, 0x2061, 0x1041,
-    0x1841, 0x1020, 0x0820, 0x0800, 0x0020, 0x0000, 0x0020, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0820,
-    0x0800, 0x0820, 0x1020, 0x1841, 0x1041, 0x2061, 0x7A81, 0xECC1,
-    0xECC1, 0xF502, 0xF502, 0xF502, 0xB381, 0x6223, 0x6223, 0x7282,
-    0x72C3, 0x7AC3, 0x72C3, 0x6A82, 0x6284, 0x9B81, 0xF543, 0xF521,
-    0xF502, 0x6A21, 0x3902, 0x30C1, 0x28A1, 0x2081, 0x2061, 0x1841,
-    0x1020, 0x0820, 0x0800, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000,
-    0x0820, 0x0820, 0x1020, 0x1841, 0x1841, 0x2061, 0x4121, 0xF4E1,
-    0xF4C1, 0xF4C1, 0xF502, 0xED02, 0x9323, 0x51A2, 0x6223, 0x6223,
-    0x6223, 0x7A42, 0x6223, 0x6223, 0x6223, 0xAB81, 0xF542, 0xF521,
-    0x9303, 0x3902, 0x38E2, 0x30C1, 0x28A1, 0x2061, 0x1861, 0x1841,
-    0x1020, 0x0820, 0x0800, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020,
-    0x0800, 0x0820, 0x0820, 0x1020, 0x1841, 0x1861, 0x2061, 0x8A82,
-    0xF4C1, 0xECC1, 0xF502, 0xF502, 0x9B23, 0x59C2, 0x51A2, 0x6223,
-    0x6223, 0x6223, 0x6223, 0x6223, 0x51A2, 0xBC02, 0xF542, 0xB381,
-    0x4142, 0x3902, 0x30C1, 0x30A1, 0x2081, 0x2061, 0x1841, 0x1041,
-    0x1020, 0x0820, 0x0820, 0x0800, 0x0020, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0800,
-    0x0820, 0x0800, 0x0820, 0x1020, 0x1041, 0x1841, 0x2061, 0x28A1,
-    0xB381, 0xF4C1, 0xF502, 0xF502, 0xB402, 0x4962, 0x51A2, 0x59A2,
-    0x51C2, 0x59A2, 0x51C2, 0x59A2, 0x51C2, 0xDCC3, 0xD442, 0x4122,
-    0x3902, 0x38E2, 0x30C1, 0x28A1, 0x2061, 0x1861, 0x1841, 0x1020,
-    0x0820, 0x0820, 0x0800, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,
-    0x0800, 0x0800, 0x0820, 0x1020, 0x1841, 0x1041, 0x1861, 0x2081,
-    0x28A1, 0x9AE1, 0xF502, 0xF502, 0xF4C1, 0x5162, 0x4962, 0x5162,
-    0x4962, 0x59C2, 0x51A2, 0x5162, 0x51A2, 0xD462, 0x5162, 0x3922,
-    0x38E2, 0x30C1, 0x30A1, 0x28A1, 0x1861, 0x2061, 0x1841, 0x1020,
-    0x0820, 0x0800, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000,
-    0x0020, 0x0800, 0x0820, 0x0820, 0x1020, 0x1841, 0x2061, 0x2081,
-    0x2081, 0x30A1, 0x59C1, 0xD462, 0xF521, 0x9B61, 0x4122, 0x4962,
-    0x4962, 0x5162, 0x4962, 0x5162, 0x7242, 0x59C2, 0x3902, 0x30E2,
-    0x30C1, 0x30A1, 0x28A1, 0x2081, 0x2061, 0x1041, 0x1020, 0x1020,
-    0x0820, 0x0800, 0x0800, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,
-    0x0000, 0x0020, 0x0800, 0x0820, 0x1020, 0x1841, 0x1841, 0x1861,
-    0x2061, 0x28A1, 0x30A1, 0x30E2, 0x7A42, 0xBC02, 0x6201, 0x4942,
-    0x4122, 0x4142, 0x4122, 0x4942, 0x4142, 0x3902, 0x38E2, 0x38E2,
-    0x28A1, 0x28A1, 0x2081, 0x2061, 0x1841, 0x1841, 0x1020, 0x0820,
-    0x0000, 0x0820, 0x0800, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,
-    0x0800, 0x0820, 0x0800, 0x0020, 0x1020, 0x1020, 0x1841, 0x2061,
-    0x1861, 0x2081, 0x2881, 0x30A1, 0x30C1, 0x38E2, 0x4102, 0x40E2,
-    0x3922, 0x40E2, 0x4102, 0x38E2, 0x4102, 0x38E2, 0x30C1, 0x30C1,
-    0x28A1, 0x28A1, 0x2081, 0x2061, 0x1041, 0x1020, 0x1020, 0x0820,
-    0x0800, 0x0800, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0020, 0x0800, 0x0820, 0x0800, 0x0820, 0x1020, 0x1041, 0x1841,
-    0x2061, 0x2061, 0x28A1, 0x28C1, 0x30C1, 0x38E2, 0x38E2, 0x30E2,
-    0x40E2, 0x4102, 0x40E2, 0x30E2, 0x38E2, 0x30C1, 0x30C1, 0x30A1,
-    0x28A1, 0x2081, 0x2061, 0x1041, 0x1841, 0x1020, 0x1020, 0x0820,
-    0x0800, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,
-    0x0000, 0x0020, 0x0800, 0x0820, 0x0820, 0x1020, 0x1020, 0x1841,
-    0x2061, 0x2081, 0x2061, 0x28A1, 0x30A1, 0x30C1, 0x30C1, 0x30E2,
-    0x38E2, 0x38E2, 0x38E2, 0x30E2, 0x30C1, 0x30C1, 0x30A1, 0x28A1,
-    0x2081, 0x2061, 0x1861, 0x1841, 0x1020, 0x1020, 0x0820, 0x0800,
-    0x0000, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0020, 0x0000, 0x0020, 0x0800, 0x0820, 0x1020, 0x1020, 0x1841,
-    0x2061, 0x1861, 0x2061, 0x28A1, 0x28A1, 0x30A1, 0x30C1, 0x30C1,
-    0x30C1, 0x30C1, 0x30C1, 0x30C1, 0x30C1, 0x28A1, 0x2881, 0x4121,
-    0xD442, 0xCC21, 0x2081, 0x1841, 0x1020, 0x1020, 0x0820, 0x0000,
-    0x0820, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0020, 0x0800, 0x0820, 0x0820, 0x1020, 0x1020, 0x1841,
-    0x1841, 0x2061, 0x2081, 0x2061, 0x28A1, 0x6A01, 0xBC02, 0x51C1,
-    0x30C1, 0x30C1, 0x30C1, 0x30C1, 0x28A1, 0x28A1, 0x2881, 0x28A1,
-    0xCC01, 0xF542, 0x8281, 0x1041, 0x1020, 0x1020, 0x0800, 0x0020,
-    0x0800, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0020, 0x0000, 0x0820, 0x0800, 0x0820, 0x1020, 0x1020, 0x1041,
-    0x1841, 0x1861, 0x2061, 0x2061, 0xAB81, 0xF582, 0xFD82, 0x51C1,
-    0x30C1, 0x30C1, 0x30C1, 0x30C1, 0x30A1, 0x2881, 0x28A1, 0x2061,
-    0x4181, 0xF5A1, 0xC402, 0x1041, 0x1020, 0x0820, 0x0800, 0x0820,
-    0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0020, 0x0800, 0x0820, 0x0820, 0x1020, 0x1020, 0x1841,
-    0x1841, 0x2061, 0x2081, 0x8323, 0xF582, 0xF562, 0xF5A2, 0x4962,
-    0x30A1, 0x30C1, 0x30C1, 0x30C1, 0x28A1, 0x28A1, 0x28A1, 0x2061,
-    0x2061, 0xDCE1, 0xCCA1, 0x0820, 0x1020, 0x0820, 0x0800, 0x0000,
-    0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0020, 0x0000, 0x0820, 0x0800, 0x0820, 0x1020, 0x1020, 0x1041,
-    0x2061, 0x1861, 0x2881, 0xE542, 0xF5A2, 0xF5A2, 0xF5A2, 0x59C2,
-    0x30C1, 0x30C1, 0x30C1, 0x30C1, 0x30A1, 0x28A1, 0x2881, 0x2081,
-    0x1861, 0x9B81, 0xBC02, 0x1020, 0x1020, 0x0820, 0x0800, 0x0820,
-    0x0800, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,
-    0x0000, 0x0820, 0x0800, 0x0820, 0x0820, 0x1020, 0x1041, 0x1841,
-    0x2061, 0x2081, 0x4981, 0xFDC2, 0xF5C2, 0xF5C2, 0xF5C2, 0x6201,
-    0x30E2, 0x38E2, 0x30C1, 0x30C1, 0x30C1, 0x28A1, 0x28A1, 0x2081,
-    0x2061, 0x82A1, 0x8B21, 0x1020, 0x1020, 0x0820, 0x0800, 0x0000,
-    0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000,
-    0x0020, 0x0800, 0x0800, 0x0820, 0x1020, 0x1020, 0x1041, 0x2061,
-    0x2081, 0x2061, 0x6221, 0xF5C2, 0xF5C2, 0xF5C2, 0xF5C2, 0x82A1,
-    0x38E2, 0x30E2, 0x38E2, 0x38E2, 0x30C1, 0x28A1, 0x2881, 0x28A1,
-    0x2061, 0x6A21, 0x4121, 0x1841, 0x1020, 0x0820, 0x0820, 0x0800,
-    0x0020, 0x0800, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,
-    0x0800, 0x0820, 0x0800, 0x0820, 0x1020, 0x1041, 0x1841, 0x2061,
-    0x2081, 0x28A1, 0x7282, 0xF5E2, 0xF5E2, 0xF602, 0xF602, 0x9BA3,
-    0x3902, 0x3902, 0x4102, 0x40E2, 0x38E2, 0x30C1, 0x28C1, 0x28A1,
-    0x2061, 0x30A1, 0x1861, 0x1841, 0x1020, 0x1020, 0x0820, 0x0820,
-    0x0800, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020,
-    0x0000, 0x0800, 0x0820, 0x1020, 0x1841, 0x1841, 0x1861, 0x2081,
-    0x30C1, 0x3902, 0x8B21, 0xF602, 0xF602, 0xF602, 0xF602, 0xE5A2,
-    0x4942, 0x4122, 0x4142, 0x4942, 0x3902, 0x3922, 0x38E2, 0x28A1,
-    0x2881, 0x2081, 0x2061, 0x1841, 0x1020, 0x1020, 0x0820, 0x0820,
-    0x0800, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0800,
-    0x0820, 0x0800, 0x0820, 0x1020, 0x1841, 0x2061, 0x2081, 0x8B21,
-    0xE5C2, 0xF602, 0xF5E2, 0xFE23, 0xF623, 0xF603, 0xF643, 0xFE43,
-    0x8B21, 0x4183, 0x4962, 0x5162, 0x4122, 0x4122, 0x3902, 0x38E2,
-    0x30C1, 0x28A1, 0x2081, 0x2061, 0x1041, 0x1020, 0x0820, 0x0800,
-    0x0800, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0800,
-    0x0800, 0x0820, 0x1020, 0x1041, 0x2061, 0x1881, 0xAC43, 0xF5E2,
-    0xF622, 0xF642, 0xF622, 0xF643, 0xF643, 0xF643, 0xFE43, 0xF664,
-    0xF603, 0x72C3, 0x59C2, 0x51C2, 0x4983, 0x5162, 0x4142, 0x3902,
-    0x38E2, 0x30A1, 0x28A1, 0x1861, 0x1841, 0x1020, 0x0820, 0x0820,
-    0x0820, 0x0800, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0800,
-    0x0820, 0x0820, 0x1841, 0x1841, 0x2061, 0x8B41, 0xFE22, 0xF642,
-    0xF642, 0xF643, 0xF643, 0xF664, 0xFE85, 0xF6A7, 0xF663, 0xFE84,
-    0xF684, 0xF663, 0xBCA2, 0x8303, 0x6223, 0x6223, 0x6223, 0x6223,
-    0x3902, 0x30E2, 0x28A1, 0x2081, 0x2061, 0x1841, 0x1020, 0x0820,
-    0x0800, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0800,
-    0x0820, 0x1020, 0x1041, 0x2061, 0x4161, 0xF622, 0xF622, 0xF643,
-    0xF663, 0xF644, 0xF664, 0xF6A7, 0xFF33, 0xFF74, 0xF6C9, 0xF6A4,
-    0xF684, 0xFE84, 0xF684, 0xF684, 0xF684, 0xFE83, 0xF683, 0xFE64,
-    0xE602, 0x6A82, 0x30C1, 0x28A1, 0x2061, 0x1841, 0x1841, 0x1020,
-    0x0820, 0x0820, 0x0800, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x0800, 0x0820,
-    0x0820, 0x1041, 0x2061, 0x2081, 0xAC63, 0xFE62, 0xF662, 0xFE83,
-    0xF663, 0xF684, 0xFEA7, 0xFF53, 0xF774, 0xFF74, 0xF6CD, 0xFEE5,
-    0xFEC5, 0xF6E5, 0xFEC5, 0xF6A4, 0xF6A4, 0xF684, 0xF684, 0xFE83,
-    0xF663, 0xEE43, 0x6201, 0x28A1, 0x2061, 0x1861, 0x1841, 0x1020,
-    0x0820, 0x0800, 0x0800, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0800, 0x0820,
-    0x1020, 0x1841, 0x1881, 0x20C1, 0xF643, 0xF642, 0xF683, 0xF683,
-    0xF684, 0xF6A4, 0xFF31, 0xFF74, 0xF774, 0xFF74, 0xFF31, 0xF707,
-    0xF727, 0xF6E5, 0xFEC5, 0xF6E5, 0xFEC5, 0xFEC4, 0xF6A4, 0xF684,
-    0xF683, 0xFE83, 0xE5C2, 0x3901, 0x28A1, 0x2881, 0x1041, 0x1020,
-    0x0820, 0x0800, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x0800, 0x1020,
-    0x1041, 0x20A1, 0x1881, 0x6A21, 0xFEA2, 0xFE83, 0xF683, 0xF684,
-    0xF6A4, 0xFF09, 0xFF74, 0xFF74, 0xFF74, 0xFF95, 0xF7B5, 0xFF4C,
-    0xF707, 0xFF27, 0xF707, 0xFF27, 0xF707, 0xFEE5, 0xF6E5, 0xFEC4,
-    0xF6A4, 0xF684, 0xF682, 0x8B63, 0x28C1, 0x2081, 0x1861, 0x1841,
-    0x1020, 0x0820, 0x0000, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0800, 0x0820, 0x1020,
-    0x1041, 0x1881, 0x2881, 0x8B63, 0xF682, 0xF684, 0xF6A4, 0xFEC4,
-    0xF6C5, 0xFF53, 0xF774, 0xFFB5, 0xFF95, 0xFFB5, 0xFF95, 0xFF95,
-    0xF74E, 0xFF29, 0xF707, 0xFF27, 0xF707, 0xFF07, 0xF705, 0xFEE5,
-    0xF6C4, 0xFEA4, 0xFEA4, 0xE5A2, 0x30E2, 0x28A1, 0x20A1, 0x1841,
-    0x1020, 0x0820, 0x0800, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0840, 0x1020,
-    0x18A0, 0x2081, 0x28E1, 0xAC43, 0xFEC2, 0xFEC4, 0xF6C4, 0xFEE5,
-    0xF6E8, 0xFF95, 0xFFB5, 0xFF95, 0xFFB5, 0xFFB6, 0xFF96, 0xFFB6,
-    0xFF96, 0xF795, 0xFFB0, 0xF74E, 0xFF4A, 0xFF27, 0xF707, 0xF705,
-    0xFEE5, 0xF6C4, 0xFEA4, 0xF6A2, 0x6A82, 0x28A1, 0x1881, 0x2061,
-    0x1041, 0x0820, 0x0800, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0020, 0x0800, 0x0840, 0x0820, 0x1841,
-    0x1881, 0x18C1, 0x28C1, 0xAC23, 0xF6C3, 0xFEE5, 0xF6E5, 0xFF05,
-    0xF74C, 0xFF95, 0xFF95, 0xFFB6, 0xFF96, 0xFFD6, 0xFFB6, 0xFFD6,
-    0xFFB6, 0xFFD6, 0xFF96, 0xFFB6, 0xFFB6, 0xFFB0, 0xF6E8, 0xFF07,
-    0xF705, 0xFEE5, 0xFEE4, 0xFEC3, 0xAC43, 0x28E1, 0x28A1, 0x20A1,
-    0x1841, 0x1020, 0x0820, 0x0800, 0x0020, 0x0800, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0840, 0x1020, 0x1060,
-    0x2081, 0x28E1, 0x2922, 0x9C43, 0xFEE4, 0xFEE5, 0xF705, 0xFF07,
-    0xFF4C, 0xFFB6, 0xFFB6, 0xFF96, 0xFFD6, 0xFFB6, 0xFFD7, 0xFFB7,
-    0xFFD7, 0xFFB7, 0xFFD7, 0xFFB6, 0xFFB6, 0xFF96, 0xFF94, 0xF748,
-    0xFF27, 0xF705, 0xFEE5, 0xF6C4, 0xE602, 0x30C2, 0x2881, 0x1881,
-    0x1041, 0x1020, 0x0820, 0x0800, 0x0020, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0840, 0x0840, 0x18A0,
-    0x18C1, 0x28C1, 0x3101, 0x8303, 0xF6E5, 0xFF05, 0xF726, 0xFF07,
-    0xF74C, 0xFF96, 0xFFB6, 0xFFB7, 0xFFB7, 0xFFD7, 0xFFD7, 0xF7D7,
-    0xFFD7, 0xFFD7, 0xFFB7, 0xFFD7, 0xFFB6, 0xFFB6, 0xFFB5, 0xFFB0,
-    0xF707, 0xFF26, 0xF705, 0xFF04, 0xFEE3, 0x4981, 0x28E1, 0x2081,
-    0x2061, 0x1020, 0x0820, 0x0820, 0x0000, 0x0820, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x0820, 0x1841, 0x18A0,
-    0x20C1, 0x28E1, 0x3162, 0x5A44, 0xFF05, 0xFF26, 0xFF27, 0xFF48,
-    0xF74C, 0xFFB6, 0xFFB7, 0xFFB7, 0xFFD8, 0xFFD8, 0xFFD8, 0xFFD8,
-    0xFFD8, 0xFFD8, 0xFFD8, 0xFFD7, 0xFFD7, 0xFFD6, 0xFFB6, 0xFF95,
-    0xF769, 0xFF07, 0xF726, 0xFF04, 0xF6E4, 0x5AA3, 0x28C1, 0x1881,
-    0x2081, 0x1020, 0x0820, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0020, 0x0840, 0x0840, 0x1060, 0x18A0,
-    0x20C1, 0x2922, 0x3162, 0x4163, 0xDE45, 0xFF26, 0xFF47, 0xF769,
-    0xFF4A, 0xFFB6, 0xFFD7, 0xFFD8, 0xFFD8, 0xFFD8, 0xFFF9, 0xFFD9,
-    0xFFF9, 0xFFD9, 0xFFD8, 0xFFD8, 0xFFD7, 0xFFD7, 0xFFB6, 0xFFD5,
-    0xFF4C, 0xF747, 0xFF26, 0xFF05, 0xFF04, 0x6B23, 0x28E1, 0x20C1,
-    0x20A1, 0x1841, 0x0820, 0x0800, 0x0020, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0020, 0x0020, 0x0840, 0x0840, 0x1080, 0x18A0,
-    0x28E1, 0x3122, 0x3982, 0x49E3, 0xA4C4, 0xFF67, 0xFF48, 0xFF69,
-    0xFF4A, 0xFFB4, 0xFFD8, 0xFFD8, 0xFFD9, 0xFFF9, 0xFFDA, 0xFFFA,
-    0xFFDA, 0xFFF9, 0xFFD9, 0xFFD8, 0xFFD8, 0xFFD7, 0xFFD7, 0xFFD6,
-    0xFFB0, 0xF747, 0xFF46, 0xFF06, 0xF704, 0x7364, 0x2902, 0x18C1,
-    0x2081, 0x1041, 0x1020, 0x0800, 0x0020, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0020, 0x0840, 0x0840, 0x18A0, 0x20C1,
-    0x2101, 0x2922, 0x3982, 0x49E3, 0x6B07, 0xFF47, 0xFF69, 0xFF4A,
-    0xF78C, 0xFFB0, 0xFFD8, 0xFFF9, 0xFFD9, 0xFFFA, 0xFFDA, 0xFFFB,
-    0xFFDB, 0xFFFA, 0xFFDA, 0xFFF9, 0xFFD8, 0xFFD8, 0xFFB7, 0xFFD6,
-    0xFFD2, 0xFF48, 0xFF46, 0xFF45, 0xFF44, 0x7384, 0x3122, 0x28E1,
-    0x20A1, 0x1841, 0x0820, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0020, 0x0020, 0x0840, 0x0840, 0x18A0, 0x20C1,
-    0x2901, 0x3162, 0x3982, 0x4A03, 0x6A84, 0xD668, 0xFF69, 0xFF4A,
-    0xFF8C, 0xFFAF, 0xFFD8, 0xFFF9, 0xFFDA, 0xFFFB, 0xFFDB, 0xFFFC,
-    0xFFFC, 0xFFDB, 0xFFDA, 0xFFF9, 0xFFD9, 0xFFD8, 0xFFD7, 0xFFD7,
-    0xFFB0, 0xF748, 0xFF47, 0xFF46, 0xF744, 0x6303, 0x2922, 0x28C1,
-    0x1881, 0x1080, 0x1020, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0020, 0x0840, 0x0840, 0x18A0, 0x20C1,
-    0x2101, 0x3162, 0x4983, 0x5224, 0x6264, 0xA4C4, 0xF749, 0xFF8B,
-    0xFF8D, 0xFFAF, 0xFFD6, 0xFFFA, 0xFFDB, 0xFFDC, 0xFFFD, 0xFFFD,
-    0xFFFD, 0xFFFC, 0xFFFB, 0xFFDA, 0xFFF9, 0xFFD8, 0xF7D7, 0xFFD7,
-    0xFFB0, 0xFF88, 0xFF47, 0xFF46, 0xFF45, 0x62A3, 0x3122, 0x28E1,
-    0x2081, 0x1080, 0x1020, 0x0020, 0x0820, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0020, 0x0020, 0x0840, 0x0840, 0x18A0, 0x20C1,
-    0x2901, 0x3162, 0x4983, 0x5244, 0x6A84, 0x7307, 0xFF69, 0xFFAC,
-    0xFF8D, 0xFFB0, 0xFFD4, 0xFFDB, 0xFFFC, 0xFFFD, 0xFFFE, 0xFFFE,
-    0xFFFE, 0xFFFD, 0xFFDC, 0xFFDB, 0xFFF9, 0xFFD8, 0xFFD8, 0xFFD7,
-    0xFFAF, 0xF788, 0xFF88, 0xFF46, 0xFF45, 0x4163, 0x2922, 0x28E1,
-    0x1881, 0x1080, 0x1020, 0x0020, 0x0800, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0020, 0x0820, 0x1080, 0x10A0, 0x20C1,
-    0x2901, 0x3162, 0x41C2, 0x5224, 0x6284, 0x6B07, 0xDEC8, 0xFF8C,
-    0xF78D, 0xFFB0, 0xFFD2, 0xFFDB, 0xFFDC, 0xFFFD, 0xFFFE, 0xFFFE,
-    0xFFFE, 0xFFFD, 0xFFFC, 0xFFFB, 0xFFDA, 0xFFD8, 0xFFD7, 0xFFD7,
-    0xFF8B, 0xFF89, 0xFF88, 0xFF86, 0xEEC5, 0x39A2, 0x2922, 0x28E1,
-    0x2081, 0x1080, 0x1020, 0x0020, 0x0800, 0x0020, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0020, 0x0820, 0x0840, 0x1060, 0x18A0, 0x18C1,
-    0x2901, 0x3162, 0x3982, 0x4A03, 0x6A84, 0x7307, 0xD668, 0xFFAC,
-    0xFF8D, 0xFFB0, 0xFFB2, 0xFFFA, 0xFFFC, 0xFFFD, 0xFFFE, 0xFFFE,
-    0xFFFE, 0xFFFD, 0xFFDC, 0xFFDB, 0xFFFA, 0xFFD8, 0xFFD8, 0xFFD5,
-    0xFF8A, 0xFF89, 0xF788, 0xF766, 0xC5A5, 0x3182, 0x2922, 0x28E1,
-    0x2081, 0x1080, 0x0820, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0020, 0x0840, 0x0840, 0x18A0, 0x18C1,
-    0x2901, 0x3162, 0x3982, 0x49E3, 0x6A84, 0x6B07, 0xCE68, 0xF78C,
-    0xFFAD, 0xFFB0, 0xFFB2, 0xFFD8, 0xFFFC, 0xFFFD, 0xFFFE, 0xFFFE,
-    0xFFFE, 0xFFFD, 0xFFFC, 0xFFDB, 0xFFF9, 0xFFD8, 0xFFD8, 0xFFB0,
-    0xFFAB, 0xFF89, 0xFF88, 0xFF86, 0x9465, 0x3982, 0x3122, 0x18C1,
-    0x2081, 0x1080, 0x1020, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0020, 0x0820, 0x0840, 0x0840, 0x1080, 0x20C1,
-    0x2101, 0x3122, 0x3982, 0x49E3, 0x5A44, 0x7307, 0xF76A, 0xFFAC,
-    0xFFAD, 0xFFB0, 0xF7D2, 0xFFD8, 0xFFDB, 0xFFFC, 0xFFFD, 0xFFFD,
-    0xFFFD, 0xFFFC, 0xFFDB, 0xFFDA, 0xFFF9, 0xFFD8, 0xFFD8, 0xFF8D,
-    0xFF8B, 0xFF89, 0xF788, 0xFF87, 0x5AA3, 0x3162, 0x2922, 0x20C1,
-    0x1881, 0x1060, 0x0840, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0020, 0x0840, 0x0840, 0x1080, 0x20C1,
-    0x2901, 0x2922, 0x3982, 0x41E3, 0x6B07, 0xDEC8, 0xFFAA, 0xFF8C,
-    0xFFAD, 0xF7AF, 0xFFB0, 0xFFD8, 0xFFFB, 0xFFDB, 0xFFDC, 0xFFFC,
-    0xFFFC, 0xFFDB, 0xFFFB, 0xFFDA, 0xFFF9, 0xFFD8, 0xFFD4, 0xFF8C,
-    0xFFAB, 0xFF89, 0xFF88, 0xE707, 0x4983, 0x3962, 0x2101, 0x20C1,
-    0x18A0, 0x1080, 0x0840, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0020, 0x0840, 0x0840, 0x1080, 0x18A0,
-    0x20C1, 0x3122, 0x3162, 0x49E3, 0xCE46, 0xFF89, 0xFFAA, 0xFF8C,
-    0xFFAD, 0xFFAF, 0xFFD2, 0xFFD9, 0xFFFA, 0xFFDB, 0xFFFB, 0xFFDB,
-    0xFFFB, 0xFFDA, 0xFFFA, 0xFFD9, 0xFFD8, 0xFFD8, 0xFFB0, 0xF7CC,
-    0xFF8A, 0xFF89, 0xF788, 0xA4C4, 0x3982, 0x2922, 0x28C1, 0x18C1,
-    0x18A0, 0x1020, 0x0820, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0020, 0x0840, 0x0840, 0x1060, 0x18A0,
-    0x18C1, 0x2101, 0x3142, 0x5224, 0xFF88, 0xFF89, 0xF7AA, 0xFF8B,
-    0xFFCC, 0xFFB0, 0xF7D7, 0xFFD8, 0xFFD9, 0xFFFA, 0xFFDA, 0xFFFA,
-    0xFFDA, 0xFFFA, 0xFFD9, 0xFFD8, 0xFFD8, 0xFFD7, 0xFFCD, 0xFF8B,
-    0xFFAA, 0xFF89, 0xFFA8, 0x62A3, 0x3962, 0x2922, 0x28E1, 0x18A0,
-    0x1080, 0x0840, 0x0840, 0x0800, 0x0020, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0820, 0x0020, 0x0840, 0x0840, 0x1080,
-    0x20C1, 0x2901, 0x2922, 0x7B84, 0xFF88, 0xFF89, 0xFFAA, 0xFFAB,
-    0xFFB2, 0xFFD7, 0xFFD8, 0xFFD8, 0xFFF9, 0xFFD9, 0xFFF9, 0xFFD9,
-    0xFFF9, 0xFFD9, 0xFFF9, 0xFFD8, 0xFFD8, 0xFFD7, 0xF7CD, 0xFF8B,
-    0xFFAA, 0xFF89, 0xC626, 0x3162, 0x3162, 0x2901, 0x18C1, 0x2081,
-    0x1080, 0x0840, 0x0020, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0840, 0x0840, 0x1080,
-    0x1880, 0x18C1, 0x2922, 0x8C45, 0xFF88, 0xF789, 0xFF89, 0xFFB0,
-    0xFFD7, 0xFFD7, 0xFFD7, 0xFFD8, 0xFFF8, 0xFFD8, 0xFFF8, 0xFFD9,
-    0xFFF8, 0xFFD8, 0xFFF8, 0xFFD8, 0xFFD7, 0xFFD7, 0xFFD5, 0xFFAA,
-    0xFF8A, 0xFFC8, 0x7384, 0x39A2, 0x3122, 0x28E1, 0x20C1, 0x18A0,
-    0x0840, 0x0840, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x0020, 0x0860, 0x1080,
-    0x18A0, 0x20C1, 0x2901, 0x9C43, 0xFF88, 0xFF88, 0xFFAA, 0xFFD6,
-    0xFFB6, 0xFFD7, 0xFFD7, 0xFFF7, 0xFFD8, 0xFFD8, 0xFFF8, 0xFFD8,
-    0xFFF8, 0xFFD8, 0xFFF8, 0xFFD7, 0xFFD7, 0xFFD7, 0xFFD6, 0xF7AD,
-    0xFFC9, 0xC606, 0x3982, 0x3162, 0x2922, 0x20C1, 0x1880, 0x1080,
-    0x0840, 0x0840, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0840, 0x0840,
-    0x1080, 0x1080, 0x18C1, 0x7BC4, 0xFFA7, 0xFFA8, 0xF7CC, 0xFFD6,
-    0xFFD6, 0xFFD6, 0xFFF7, 0xFFD7, 0xFFD7, 0xFFD7, 0xFFF8, 0xFFB2,
-    0xFFD2, 0xFFD7, 0xFFF7, 0xFFD7, 0xFFF7, 0xFFD6, 0xFFD6, 0xFFB0,
-    0xFFC9, 0x9465, 0x3982, 0x2922, 0x28E1, 0x20C1, 0x18A0, 0x1080,
-    0x0860, 0x0820, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0820, 0x0840, 0x0840,
-    0x1080, 0x18A0, 0x20C1, 0x62A3, 0xFFC7, 0xFFA8, 0xFF8B, 0xFFF6,
-    0xFFD6, 0xFFF6, 0xFFD6, 0xFFF7, 0xFFD7, 0xFFF7, 0xF7D4, 0xFFAD,
-    0xFFAD, 0xFFD5, 0xFFD7, 0xF7F7, 0xFFD6, 0xFFF6, 0xFFD6, 0xFFB0,
-    0xFFC9, 0x6303, 0x3162, 0x20E1, 0x20C1, 0x10A0, 0x1080, 0x0840,
-    0x0840, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0840,
-    0x0840, 0x1080, 0x1080, 0x2902, 0xF788, 0xFFA8, 0xFFC9, 0xFFD4,
-    0xFFD6, 0xFFF6, 0xFFD6, 0xFFF6, 0xF7D7, 0xFFF6, 0xFFAD, 0xDECB,
-    0xFFAC, 0xFFAF, 0xFFD7, 0xFFF6, 0xFFD6, 0xFFF6, 0xFFF6, 0xFFAF,
-    0xFFC9, 0x62A3, 0x3122, 0x28E1, 0x20A1, 0x18A0, 0x0840, 0x0840,
-    0x0020, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0820,
-    0x0840, 0x0860, 0x1080, 0x18A0, 0xCE26, 0xFFA8, 0xFFA8, 0xFFB0,
-    0xFFD6, 0xFFD6, 0xFFF6, 0xFFD6, 0xFFF6, 0xFFB2, 0xEF6A, 0x6264,
-    0xEF2B, 0xFFCC, 0xFFD6, 0xFFF6, 0xFFD6, 0xFFF6, 0xFFD6, 0xFFCD,
-    0xFFC9, 0x4A42, 0x20E1, 0x18C1, 0x18A0, 0x1080, 0x0840, 0x0840,
-    0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x0020,
-    0x0840, 0x0840, 0x0880, 0x1080, 0x7BC4, 0xFFA8, 0xFFA8, 0xFFCB,
-    0xFFD5, 0xFFD6, 0xFFF6, 0xFFD6, 0xFFF6, 0xFFAC, 0xD668, 0x5224,
-    0xA4A4, 0xFFCB, 0xFFB0, 0xFFF6, 0xFFD6, 0xFFD6, 0xFFD5, 0xFFEA,
-    0xFFC9, 0x5262, 0x20C1, 0x18A0, 0x1080, 0x0840, 0x0840, 0x0020,
-    0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,
-    0x0820, 0x0840, 0x0840, 0x1080, 0x2901, 0xF768, 0xFFC9, 0xFFC9,
-    0xFFAF, 0xFFD6, 0xFFD6, 0xFFF6, 0xFFB2, 0xFFCB, 0xAD49, 0x4183,
-    0x6284, 0xFFEA, 0xFFCB, 0xFFF6, 0xFFD6, 0xFFF6, 0xFFB0, 0xFFC9,
-    0xFFA9, 0x39C2, 0x10A0, 0x1060, 0x0840, 0x0840, 0x0020, 0x0020,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0020, 0x0020, 0x0840, 0x0840, 0x0860, 0x7364, 0xFFA8, 0xF7A9,
-    0xFFC9, 0xFFD2, 0xFFD6, 0xFFF6, 0xFFAD, 0xFFCA, 0x9465, 0x3162,
-    0x3162, 0xDEC8, 0xFFCA, 0xFFAF, 0xFFD6, 0xFFD2, 0xFFCA, 0xFFC9,
-    0xF768, 0x20C1, 0x1060, 0x1080, 0x0840, 0x0020, 0x0820, 0x0000,
-    0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0020, 0x0820, 0x0020, 0x0840, 0x0840, 0x1080, 0xBD65, 0xFFC9,
-    0xFFC9, 0xFFCA, 0xFFAF, 0xFFAF, 0xFFCA, 0xF7CA, 0x7BC4, 0x2902,
-    0x2922, 0xB565, 0xFFCA, 0xFFCA, 0xFFCC, 0xFFCA, 0xFFC9, 0xFFA9,
-    0x7BC4, 0x0860, 0x0840, 0x0840, 0x0020, 0x0820, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0820, 0x0020, 0x0040, 0x0840, 0x18A1, 0xB545,
-    0xFFC9, 0xFFCA, 0xFFCA, 0xFFCA, 0xFFCA, 0xFFEA, 0x7384, 0x2901,
-    0x20E1, 0x6303, 0xFFCA, 0xFFCA, 0xFFCA, 0xFFEA, 0xFFC9, 0x83C4,
-    0x1080, 0x0840, 0x0840, 0x0840, 0x0020, 0x0000, 0x0020, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0020, 0x0820, 0x0840, 0x0840, 0x0860,
-    0x5262, 0xCDC5, 0xF7A9, 0xFFCA, 0xFFCA, 0xEF6A, 0x4A42, 0x20C1,
-    0x18C1, 0x20C1, 0xE6C8, 0xFFEA, 0xFFCA, 0xCE68, 0x39C2, 0x0840,
-    0x0840, 0x0840, 0x0820, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0820, 0x0020, 0x0840,
-    0x0860, 0x0840, 0x1060, 0x2101, 0x2901, 0x18A0, 0x10A0, 0x18A0,
-    0x18A0, 0x18A0, 0x2101, 0x62A3, 0x41E2, 0x1080, 0x0840, 0x0840,
-    0x0840, 0x0020, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0820, 0x0020,
-    0x0840, 0x0820, 0x1040, 0x0840, 0x0860, 0x0840, 0x1060, 0x0840,
-    0x0860, 0x0840, 0x1060, 0x0840, 0x0860, 0x0840, 0x0820, 0x0020,
-    0x0800, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020,
-    0x0820, 0x0000, 0x0020, 0x0840, 0x0820, 0x0840, 0x0020, 0x0840,
-    0x0820, 0x0840, 0x0020, 0x0840, 0x0840, 0x0820, 0x0020, 0x0820,
-    0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0020, 0x0820, 0x0020, 0x0820, 0x0020, 0x0800, 0x0020, 0x0820,
-    0x0020, 0x0820, 0x0020, 0x0820, 0x0020, 0x0000, 0x0020, 0x0000,
-    0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0000, 0x0020, 0x0820,
-    0x0020, 0x0000, 0x0020, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020,
-    0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 },
-  { 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0020, 0x5141, 0x0020, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0020, 0x40E2, 0xDAA2, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0xAA82, 0xD2A2, 0x0800, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0020, 0x91E2, 0xAA82, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0020, 0x0820, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0000, 0x0020,
-    0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0800, 0x0020, 0x0000,
-    0x0020, 0x0800, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,
-    0x0800, 0x0020, 0x0800, 0x0020, 0x0800, 0x0820, 0x0800, 0x0820,
-    0x0000, 0x0820, 0x0000, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020,
-    0x0000, 0x0820, 0x0800, 0x0820, 0x0820, 0x0820, 0x0820, 0x1020,
-    0x0820, 0x0820, 0x0000, 0x0820, 0x0800, 0x0820, 0x0000, 0x0020,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0800,
-    0x0020, 0x0800, 0x0820, 0x0820, 0x0820, 0x1020, 0x1020, 0x1020,
-    0x1020, 0x1020, 0x1020, 0x0820, 0x0820, 0x0000, 0x0020, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0800,
-    0x0820, 0x0820, 0x1020, 0x1020, 0x1841, 0x1841, 0x1041, 0x1841,
-    0x1841, 0x1841, 0x1020, 0x0820, 0x0820, 0x0800, 0x0820, 0x0000,
-    0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0820, 0x0800,
-    0x0820, 0x1020, 0x1841, 0x1041, 0x2061, 0x2061, 0x1861, 0x2061,
-    0x5161, 0x5141, 0x1841, 0x1020, 0x1020, 0x0820, 0x0820, 0x0000,
-    0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0800, 0x0800, 0x0820,
-    0x1020, 0x1041, 0x1841, 0x1861, 0x2081, 0x2081, 0x5141, 0xD2A2,
-    0xE2E2, 0x30A1, 0x2061, 0x1041, 0x1841, 0x1020, 0x1020, 0x0820,
-    0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0020, 0x0800, 0x0020, 0x0820, 0x1020,
-    0x1841, 0x2061, 0x1861, 0x2881, 0x2881, 0x91E2, 0xE343, 0xE323,
-    0xAA62, 0x20A1, 0x2061, 0x1861, 0x1841, 0x1841, 0x1020, 0x0820,
-    0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x0800, 0x0820, 0x1041,
-    0x2061, 0x1861, 0x2881, 0x28A1, 0x89E2, 0xDB23, 0xE323, 0xE343,
-    0x91E2, 0x30C1, 0x2881, 0x2881, 0x1861, 0x1841, 0x1020, 0x0820,
-    0x0820, 0x0800, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0020, 0x0000, 0x0820, 0x0820, 0x1020, 0x1841,
-    0x1861, 0x2881, 0x28A1, 0x69A1, 0xEB83, 0xE383, 0xE383, 0xE383,
-    0xAA82, 0x30E2, 0x28C1, 0x28A1, 0x2081, 0x2061, 0x1841, 0x1020,
-    0x0820, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0820, 0x0800, 0x0820, 0x1041, 0x1861,
-    0x2081, 0x28A1, 0x4962, 0xE383, 0xE383, 0xE383, 0xEBE3, 0xE383,
-    0xE383, 0x5162, 0x3902, 0x30C1, 0x2881, 0x2081, 0x2061, 0x1020,
-    0x0820, 0x0820, 0x0800, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0020, 0x0000, 0x0820, 0x1020, 0x1841, 0x2061,
-    0x28A1, 0x30C1, 0xB282, 0xE383, 0xE3C3, 0xF547, 0xECC6, 0xE3C3,
-    0xE3E3, 0xC302, 0x4962, 0x3902, 0x30C1, 0x28A1, 0x1861, 0x1841,
-    0x1020, 0x0800, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0020, 0x0000, 0x0800, 0x0820, 0x1841, 0x1861, 0x2081,
-    0x28A1, 0x3902, 0xE383, 0xE3C3, 0xECC6, 0xEDE8, 0xF5A6, 0xEC24,
-    0xE424, 0xEC24, 0xEBE3, 0xC302, 0xC322, 0x91E2, 0x2081, 0x1841,
-    0x1020, 0x0820, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0020, 0x0800, 0x1020, 0x1841, 0x2061, 0x28A1,
-    0x30E2, 0x7A21, 0xEBC3, 0xEC44, 0xF547, 0xF5E8, 0xEDC8, 0xED47,
-    0xEC84, 0xEC24, 0xEC24, 0xE3C3, 0xE383, 0xE383, 0xA262, 0x1861,
-    0x1041, 0x0820, 0x0800, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0020, 0x0800, 0x1020, 0x1841, 0x2081, 0x28A1,
-    0x30C2, 0x9AE1, 0xE424, 0xEC24, 0xED47, 0xF628, 0xF648, 0xF628,
-    0xF5E8, 0xED47, 0xECC6, 0xEC24, 0xE3E3, 0xE383, 0xEB83, 0x4121,
-    0x1841, 0x1020, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0020, 0x0800, 0x0820, 0x1020, 0x1041, 0x2081, 0x30A1,
-    0x3902, 0xBB22, 0xEC44, 0xEC84, 0xF5E8, 0xF648, 0xF628, 0xF648,
-    0xF628, 0xF648, 0xF5C8, 0xF5A6, 0xE3C3, 0xE383, 0xE383, 0x89E2,
-    0x1041, 0x0820, 0x0800, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0800, 0x0820, 0x1020, 0x1041, 0x2081, 0x30C1,
-    0x3102, 0xB302, 0xEC24, 0xECC6, 0xEDC8, 0xF648, 0xF5E5, 0xF5E8,
-    0xF628, 0xF648, 0xF5C8, 0xF5E8, 0xECC6, 0xEBE3, 0xE383, 0xC322,
-    0x1841, 0x1020, 0x0820, 0x0800, 0x0020, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0020, 0x0800, 0x0820, 0x1020, 0x2061, 0x28A1, 0x30C1,
-    0x4142, 0xB322, 0xF484, 0xECC6, 0xF5A6, 0xF5A6, 0xF646, 0xF605,
-    0xF5A6, 0xF5A6, 0xEDC8, 0xF5E8, 0xED47, 0xE3C3, 0xE383, 0xE383,
-    0x1841, 0x0820, 0x0800, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0820, 0x1020, 0x2061, 0x2081, 0x30C1,
-    0x3902, 0x9303, 0xEC84, 0xECE4, 0xED44, 0xF605, 0xF646, 0xF646,
-    0xF5A6, 0xED05, 0xF5A6, 0xF5E8, 0xF5A6, 0xE3E3, 0xE383, 0xE383,
-    0x38E2, 0x1020, 0x0820, 0x0800, 0x0020, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0020, 0x0800, 0x0820, 0x1020, 0x2061, 0x2081, 0x30C1,
-    0x4942, 0x9282, 0xEC84, 0xF4E4, 0xED44, 0xF5A6, 0xF646, 0xDD85,
-    0xCCA4, 0xF505, 0xECC6, 0xED47, 0xF5A6, 0xE3C3, 0xE3C3, 0xE383,
-    0x4121, 0x0820, 0x0800, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0800, 0x0820, 0x1020, 0x1861, 0x2081, 0x30C1,
-    0x3902, 0x51A2, 0xEC84, 0xECE4, 0xED05, 0xF5A6, 0xE5A5, 0x9423,
-    0x8B83, 0x9BC3, 0xEC84, 0xECA4, 0xF5A6, 0xE3C3, 0xEBE3, 0xE383,
-    0x4921, 0x1020, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0020, 0x0800, 0x0820, 0x1020, 0x1841, 0x2881, 0x30C1,
-    0x3902, 0x5162, 0xB381, 0xECE4, 0xF525, 0xED44, 0xAC43, 0x8B83,
-    0x8303, 0x72C3, 0xB381, 0xEC63, 0xEC84, 0xE3C3, 0xE3C3, 0xE383,
-    0x30E2, 0x1020, 0x0800, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0020, 0x0000, 0x0800, 0x1020, 0x1841, 0x2081, 0x30A1,
-    0x3902, 0x4962, 0x7242, 0xEC84, 0xECE4, 0xF505, 0x8323, 0x8303,
-    0x72C3, 0x7242, 0x7242, 0xEC24, 0xEC44, 0xE3C3, 0xEBE3, 0xE383,
-    0x2061, 0x1020, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0820, 0x0800, 0x1020, 0x1041, 0x2061, 0x28C1,
-    0x38E2, 0x4142, 0x5162, 0xB322, 0xF4E4, 0xCCA4, 0x72A3, 0x72C3,
-    0x7A42, 0x6223, 0x51A2, 0xCBA2, 0xEC24, 0xEBC3, 0xE3E3, 0xB322,
-    0x1041, 0x0820, 0x0800, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0800, 0x1020, 0x1841, 0x1861, 0x28A1,
-    0x30C1, 0x40E2, 0x4962, 0x51A2, 0xEC84, 0xB381, 0x6223, 0x6223,
-    0x6223, 0x51C2, 0x51A2, 0xB322, 0xEC23, 0xEBE3, 0xEBE3, 0x69A1,
-    0x1020, 0x0820, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0820, 0x0800, 0x1020, 0x1041, 0x2061, 0x28A1,
-    0x30C1, 0x40E2, 0x4142, 0x5162, 0xEC44, 0x7242, 0x6223, 0x6223,
-    0x51A2, 0x59A2, 0x4962, 0xB322, 0xEC23, 0xEC23, 0xDB61, 0x1861,
-    0x1020, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0020, 0x0800, 0x1020, 0x1841, 0x2061, 0x2081,
-    0x28A1, 0x38E2, 0x38E2, 0x69A1, 0xEC44, 0x51A2, 0x59C2, 0x51A2,
-    0x5162, 0x4962, 0x4142, 0x9AE1, 0xEC23, 0xEBE3, 0x5141, 0x1841,
-    0x1020, 0x0820, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0020, 0x0000, 0x0820, 0x0800, 0x1020, 0x1020, 0x1861, 0x2881,
-    0x28A1, 0x30C1, 0x40E2, 0x7A21, 0x9282, 0x4962, 0x4962, 0x5162,
-    0x4962, 0x4122, 0x40E2, 0xB322, 0xEC43, 0x9282, 0x1861, 0x1041,
-    0x1020, 0x0800, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0020, 0x0000, 0x0020, 0x0800, 0x0820, 0x1020, 0x1041, 0x2061,
-    0x28A1, 0x30C1, 0x30E2, 0x40E2, 0x40E2, 0x4142, 0x4122, 0x4142,
-    0x4142, 0x40E2, 0x40E2, 0xC322, 0xBB22, 0x28A1, 0x1861, 0x1841,
-    0x1020, 0x0800, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,
-    0x0000, 0x0820, 0x0800, 0x0820, 0x0820, 0x1020, 0x1041, 0x2061,
-    0x2081, 0x30A1, 0x30C1, 0x38E2, 0x40E2, 0x4102, 0x38E2, 0x4102,
-    0x40E2, 0x4102, 0x30C1, 0x9AE1, 0x28A1, 0x2061, 0x1041, 0x1020,
-    0x0820, 0x0800, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000,
-    0x0020, 0x0000, 0x0820, 0x0800, 0x0820, 0x1020, 0x1841, 0x2061,
-    0x2061, 0x28A1, 0x30C1, 0x30E2, 0x4102, 0x40E2, 0x3902, 0x40E2,
-    0x4102, 0x38E2, 0x30C1, 0x30A1, 0x2081, 0x2061, 0x1041, 0x1020,
-    0x0820, 0x0800, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,
-    0x0000, 0x0820, 0x0800, 0x0820, 0x1020, 0x1020, 0x1841, 0x2061,
-    0x2081, 0x28A1, 0x28A1, 0x30C1, 0x38E2, 0x40E2, 0x4102, 0x40E2,
-    0x30E2, 0x30C1, 0x30C1, 0x28A1, 0x2061, 0x1861, 0x1841, 0x1020,
-    0x0820, 0x0800, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,
-    0x0000, 0x0820, 0x0800, 0x0820, 0x1020, 0x1841, 0x1041, 0x2061,
-    0x2061, 0x28A1, 0x28C1, 0x30C1, 0x38E2, 0x38E2, 0x40E2, 0x30E2,
-    0x38E2, 0x30C1, 0x30A1, 0x28A1, 0x2081, 0x2061, 0x1041, 0x1020,
-    0x1020, 0x0820, 0x0800, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000,
-    0x0820, 0x0800, 0x0820, 0x1020, 0x1020, 0x1841, 0x1861, 0x2061,
-    0x2081, 0x28A1, 0x30C1, 0x5941, 0x4142, 0x38E2, 0x30E2, 0x38E2,
-    0x38E2, 0x30C1, 0x28A1, 0x28A1, 0x2061, 0x2061, 0x1841, 0x1041,
-    0x1020, 0x0820, 0x0800, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,
-    0x0800, 0x0800, 0x0820, 0x1020, 0x1841, 0x1041, 0x2061, 0x2081,
-    0x28A1, 0x28A1, 0x30A1, 0xCBA2, 0x4142, 0x38E2, 0x38E2, 0x38E2,
-    0x30E2, 0x30C1, 0x30A1, 0x28A1, 0x28A1, 0x2061, 0x1041, 0x1841,
-    0x1020, 0x0820, 0x0800, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0820,
-    0x0800, 0x0820, 0x0820, 0x1020, 0x1841, 0x1861, 0x2061, 0x2081,
-    0x28A1, 0x30A1, 0x7A21, 0xF4C2, 0x4122, 0x40E2, 0x38E2, 0x4102,
-    0x38E2, 0x30E2, 0x30C1, 0x30A1, 0x28A1, 0x2081, 0x2061, 0x1041,
-    0x1020, 0x0820, 0x0820, 0x0800, 0x0800, 0x0020, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020,
-    0x0800, 0x0820, 0x1020, 0x1020, 0x1841, 0x2061, 0x2061, 0x28A1,
-    0x28A1, 0x30E2, 0xDC41, 0xF4C2, 0x69A1, 0x3902, 0x4142, 0x4122,
-    0x3902, 0x30E2, 0x30C1, 0x30A1, 0x28A1, 0x2081, 0x2061, 0x1841,
-    0x1041, 0x1020, 0x0820, 0x0800, 0x0820, 0x0000, 0x0020, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0800,
-    0x0820, 0x0820, 0x1020, 0x1841, 0x1861, 0x2881, 0x2881, 0x28A1,
-    0x30C1, 0x7A21, 0xF4E1, 0xF4C1, 0x7A81, 0x4122, 0x4142, 0x4922,
-    0x4142, 0x3902, 0x38E2, 0x30C1, 0x28A1, 0x28A1, 0x2081, 0x2061,
-    0x1841, 0x1020, 0x1020, 0x0800, 0x0000, 0x0020, 0x0000, 0x0020,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020,
-    0x0800, 0x0820, 0x1020, 0x1841, 0x1861, 0x2061, 0x28A1, 0x30C1,
-    0x30C2, 0xBC02, 0xF4C1, 0xF502, 0xCC01, 0x5162, 0x4962, 0x4942,
-    0x4122, 0x4142, 0x3902, 0x38E2, 0x30C1, 0x28A1, 0x2881, 0x1861,
-    0x1841, 0x1841, 0x1020, 0x0800, 0x0820, 0x0000, 0x0020, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0820, 0x0800,
-    0x0820, 0x1020, 0x1020, 0x1841, 0x2061, 0x2081, 0x30A1, 0x30C1,
-    0x4962, 0xF522, 0xF502, 0xF502, 0xF502, 0x9323, 0x4962, 0x5162,
-    0x4962, 0x4122, 0x4942, 0x3902, 0x30C1, 0x28A1, 0x28A1, 0x2061,
-    0x1861, 0x1841, 0x1020, 0x0820, 0x0800, 0x0820, 0x0000, 0x0020,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0820, 0x0800,
-    0x0820, 0x1020, 0x1041, 0x2061, 0x2061, 0x28A1, 0x30C1, 0x30C2,
-    0x7242, 0xF502, 0xF502, 0xF521, 0xF542, 0xF542, 0xBC02, 0x7242,
-    0x5162, 0x4962, 0x4942, 0x3902, 0x38E2, 0x30C1, 0x2881, 0x2081,
-    0x2061, 0x1041, 0x1020, 0x0820, 0x0820, 0x0800, 0x0020, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0800, 0x0820,
-    0x0820, 0x1020, 0x1841, 0x1861, 0x2881, 0x2881, 0x30C1, 0x3902,
-    0x9B81, 0xF522, 0xF542, 0xF563, 0xF543, 0xF563, 0xF543, 0xF563,
-    0xDD02, 0x7B23, 0x4962, 0x4122, 0x3902, 0x30C1, 0x30A1, 0x2081,
-    0x2061, 0x1041, 0x1020, 0x1020, 0x0800, 0x0020, 0x0000, 0x0020,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0800, 0x0800,
-    0x0820, 0x1020, 0x1041, 0x2061, 0x28A1, 0x28A1, 0x30E2, 0x3902,
-    0xBC02, 0xF542, 0xED43, 0xF543, 0xF583, 0xF583, 0xF583, 0xF583,
-    0xF582, 0xF563, 0xBC02, 0x5162, 0x3902, 0x30E2, 0x7A42, 0x6221,
-    0x2061, 0x1841, 0x1841, 0x1020, 0x0820, 0x0800, 0x0020, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0820, 0x0800,
-    0x0820, 0x1841, 0x1041, 0x2061, 0x28A1, 0x30C1, 0x38E2, 0x4142,
-    0xD442, 0xF582, 0xF582, 0xF583, 0xF5A3, 0xF5A3, 0xF5A3, 0xF5A3,
-    0xF583, 0xF562, 0xF582, 0x9361, 0x4122, 0x3902, 0xB381, 0xC421,
-    0x2061, 0x1861, 0x1841, 0x1020, 0x0820, 0x0800, 0x0000, 0x0020,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0800, 0x0820,
-    0x1020, 0x1841, 0x1861, 0x2061, 0x28A1, 0x30C1, 0x3902, 0x4122,
-    0xD4A3, 0xF582, 0xF5A3, 0xF5A3, 0xF5C3, 0xF5C3, 0xF5C3, 0xF5C3,
-    0xF5A3, 0xF5A3, 0xF582, 0xF563, 0x59C2, 0x3902, 0x9B23, 0x9B81,
-    0x2081, 0x2061, 0x1841, 0x1020, 0x0820, 0x0800, 0x0020, 0x0000,
-    0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0820, 0x1020,
-    0x1020, 0x1841, 0x1861, 0x2881, 0x28A1, 0x38E2, 0x3902, 0x4942,
-    0xE522, 0xF5A3, 0xF5C3, 0xF5C3, 0xF5E3, 0xF5E3, 0xF5E3, 0xF5E3,
-    0xF5E3, 0xF5C3, 0xF5A3, 0xF582, 0xAB61, 0x3902, 0x4142, 0x30E2,
-    0x2881, 0x2061, 0x1041, 0x1020, 0x0820, 0x0800, 0x0820, 0x0000,
-    0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0800, 0x0820,
-    0x1020, 0x1841, 0x1861, 0x51C1, 0xBBE2, 0xB381, 0x4962, 0x4942,
-    0xD4E1, 0xF5A3, 0xF5E3, 0xF5E3, 0xF5E4, 0xFEA9, 0xF5E4, 0xF604,
-    0xF603, 0xF5E3, 0xF5C3, 0xF5A2, 0xE522, 0x4922, 0x30E2, 0x30C1,
-    0x28A1, 0x2061, 0x1841, 0x1020, 0x0820, 0x0820, 0x0800, 0x0020,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0820, 0x0800, 0x0820,
-    0x1020, 0x1841, 0x6A21, 0xF521, 0xF542, 0xF542, 0xBC02, 0x4962,
-    0xCCA1, 0xF5E3, 0xF5E3, 0xF603, 0xFEA9, 0xF6CD, 0xF643, 0xF623,
-    0xFE03, 0xF5E3, 0xF5E3, 0xF5A3, 0xF5A2, 0x4942, 0x3902, 0x30C1,
-    0x28A1, 0x1861, 0x1841, 0x1041, 0x0820, 0x0800, 0x0800, 0x0020,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0820, 0x0800, 0x0820,
-    0x0820, 0x28A1, 0xF501, 0xF542, 0xF542, 0xF582, 0xF582, 0x51A2,
-    0xAC43, 0xF5C3, 0xF603, 0xF603, 0xF6ED, 0xFF31, 0xFE64, 0xF664,
-    0xF643, 0xF603, 0xF5E3, 0xF5C3, 0xFDA2, 0x59C2, 0x3902, 0x30C1,
-    0x2881, 0x2081, 0x2061, 0x1841, 0x1020, 0x0820, 0x0820, 0x0000,
-    0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0800, 0x0820, 0x1020,
-    0x1041, 0x8B21, 0xFD62, 0xF542, 0xF582, 0xF562, 0xF5A2, 0x7B03,
-    0x9B81, 0xF603, 0xF623, 0xFE64, 0xFF31, 0xF733, 0xF684, 0xFE84,
-    0xF664, 0xF603, 0xF603, 0xF5C3, 0xF5C3, 0x51A2, 0x3902, 0x30E2,
-    0x30A1, 0x2081, 0x2061, 0x1041, 0x1020, 0x0820, 0x0800, 0x0020,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0800, 0x0820,
-    0x1021, 0xD4E1, 0xF581, 0xF562, 0xF582, 0xF5A2, 0xF5C2, 0xAC43,
-    0x72A3, 0xF623, 0xF643, 0xF644, 0xFF53, 0xFF74, 0xFEC5, 0xF684,
-    0xF664, 0xFE43, 0xF623, 0xF603, 0xE562, 0x5162, 0x3902, 0x38E2,
-    0x30A1, 0x2081, 0x2061, 0x1841, 0x1020, 0x0820, 0x0820, 0x0000,
-    0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0820, 0x0800, 0x1020,
-    0x3921, 0xF5A1, 0xF5A1, 0xF581, 0xF5A2, 0xF5C2, 0xF5C2, 0xBCC2,
-    0x6223, 0xCD63, 0xFE64, 0xF684, 0xFF33, 0xFF74, 0xFEE8, 0xF6A4,
-    0xF684, 0xF663, 0xF643, 0xF603, 0x9BA3, 0x4962, 0x4122, 0x30E2,
-    0x30A1, 0x2081, 0x2061, 0x1041, 0x1020, 0x0820, 0x0800, 0x0020,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0800, 0x0820,
-    0x6A82, 0xF581, 0xF5A1, 0xF581, 0xF5C2, 0xF5C2, 0xF5E2, 0xD4E1,
-    0x6203, 0xAC43, 0xF644, 0xF684, 0xFF31, 0xF774, 0xFF4C, 0xFEE5,
-    0xF6A4, 0xFE84, 0xF664, 0xFE23, 0x6A82, 0x5162, 0x4142, 0x38E2,
-    0x30A1, 0x2081, 0x2061, 0x1841, 0x1020, 0x0820, 0x0820, 0x0000,
-    0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0820, 0x0800, 0x1020,
-    0x8B41, 0xFDA1, 0xF581, 0xF5C2, 0xF5C2, 0xF5C2, 0x9BC3, 0xBCC2,
-    0x6A82, 0x8B83, 0xFE84, 0xFEC4, 0xFF4E, 0xFF94, 0xFFB0, 0xF6E5,
-    0xF6C4, 0xF684, 0xF664, 0xEDE3, 0x6203, 0x6223, 0x9BC3, 0x6A82,
-    0x30C1, 0x2881, 0x2061, 0x1041, 0x1020, 0x0820, 0x0800, 0x0020,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0800, 0x0800, 0x0820,
-    0x9381, 0xF5A1, 0xED81, 0x9BC3, 0xFDE2, 0x8323, 0x51A2, 0x8303,
-    0x6A82, 0x8303, 0xF684, 0xF6E5, 0xFF4A, 0xF7B4, 0xFF94, 0xFF07,
-    0xFEE5, 0xF684, 0xF684, 0xFE64, 0xAC43, 0xE5A2, 0xF602, 0xF5E2,
-    0xA3C3, 0x28A1, 0x1861, 0x1841, 0x1020, 0x0820, 0x0820, 0x0800,
-    0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0820, 0x0820, 0x1020,
-    0x9B81, 0xFDC2, 0x6221, 0x30C1, 0xAC43, 0x5162, 0x51A2, 0x6223,
-    0x7AC3, 0x8B83, 0xFEC4, 0xFEE5, 0xF707, 0xFFB4, 0xFF94, 0xF74C,
-    0xFEE5, 0xF6A4, 0xF684, 0xF664, 0xF643, 0xFE03, 0xF602, 0xF5E2,
-    0xF5E2, 0x8B21, 0x1841, 0x1041, 0x1020, 0x0820, 0x0800, 0x0020,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0800, 0x0820, 0x0820,
-    0x8B21, 0xED81, 0x2881, 0x38E2, 0x51C2, 0x4983, 0x51A2, 0x6223,
-    0x72C3, 0xAC23, 0xFEE5, 0xF6C5, 0xFF26, 0xF78D, 0xFFB4, 0xFF94,
-    0xF6E8, 0xFEE5, 0xF684, 0xFE84, 0xF664, 0xF643, 0xFE23, 0xF602,
-    0xF602, 0xFDC2, 0x4981, 0x1841, 0x1020, 0x0820, 0x0820, 0x0000,
-    0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0800, 0x0820, 0x1020,
-    0x6A21, 0xE562, 0x28A1, 0x38E2, 0x4122, 0x4983, 0x5244, 0x6A84,
-    0x72C3, 0xD563, 0xFEE5, 0xF6E5, 0xFF27, 0xF74A, 0xFFB4, 0xFF95,
-    0xFF53, 0xF6A7, 0xF6A4, 0xF684, 0xF664, 0xF643, 0xFE43, 0xF603,
-    0xF5E2, 0xF602, 0xCCA1, 0x1841, 0x0820, 0x0820, 0x0800, 0x0000,
-    0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0800, 0x0820, 0x1041,
-    0x20E1, 0xFDE2, 0x38E2, 0x3902, 0x4983, 0x51A2, 0x6223, 0x6284,
-    0x7B03, 0xF685, 0xF705, 0xFF07, 0xF727, 0xFF4A, 0xFFB5, 0xF795,
-    0xFF95, 0xFF31, 0xFEA7, 0xF685, 0xF684, 0xF685, 0xFEA9, 0xF642,
-    0xF622, 0xF622, 0xFE02, 0x59C1, 0x1020, 0x0820, 0x0800, 0x0020,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x0820, 0x1020, 0x1841,
-    0x2081, 0xC4C2, 0x51C1, 0x3902, 0x49A3, 0x59C2, 0x6223, 0x6284,
-    0xBD03, 0xFEC7, 0xF707, 0xFF27, 0xF707, 0xFF4E, 0xFF95, 0xFFB5,
-    0xF795, 0xFF74, 0xFF53, 0xF6A7, 0xF685, 0xF6ED, 0xFF33, 0xF6A7,
-    0xF622, 0xF622, 0xF622, 0x9BC3, 0x1021, 0x1020, 0x0800, 0x0020,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0820, 0x1020, 0x1080,
-    0x2081, 0x51C1, 0x8B83, 0x4122, 0x4983, 0x5A24, 0x6284, 0x72A3,
-    0xF666, 0xF6A7, 0xF708, 0xFEE8, 0xF708, 0xFF94, 0xFFB5, 0xF795,
-    0xFFB5, 0xFF95, 0xFF74, 0xFF74, 0xF72E, 0xFF53, 0xFF33, 0xFEED,
-    0xF643, 0xF642, 0xF622, 0xED62, 0x1841, 0x0860, 0x0820, 0x0800,
-    0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0840, 0x1020, 0x18A0,
-    0x2081, 0x28E1, 0x72A2, 0x3982, 0x51C2, 0x5A24, 0x6284, 0xC5C5,
-    0xFEA7, 0xFF08, 0xFEE8, 0xF729, 0xFF4C, 0xFFB6, 0xFF96, 0xFFB6,
-    0xFF95, 0xFF95, 0xFFB5, 0xF774, 0xFF74, 0xFF74, 0xF774, 0xFF4E,
-    0xF644, 0xF643, 0xF622, 0xF622, 0x18C1, 0x1020, 0x0800, 0x0000,
-    0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0820, 0x0020, 0x0820, 0x1080, 0x18A1,
-    0x20C1, 0x28E1, 0x3162, 0x4983, 0x49E3, 0x5224, 0x9423, 0xF6A7,
-    0xFEE8, 0xF708, 0xFF09, 0xFF09, 0xF774, 0xFFB6, 0xFF96, 0xFFB6,
-    0xFFB6, 0xFF95, 0xFFB5, 0xFF95, 0xF774, 0xFF74, 0xFF74, 0xFF4E,
-    0xF683, 0xF682, 0xFE62, 0xFE62, 0x4981, 0x1841, 0x0820, 0x0820,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0020, 0x0020, 0x0840, 0x0840, 0x1080, 0x2081,
-    0x28E1, 0x3122, 0x3162, 0x4983, 0x5244, 0x7B64, 0xFEC7, 0xFF08,
-    0xF6E8, 0xFF29, 0xFF09, 0xFF4C, 0xFFB7, 0xF7B7, 0xFFB7, 0xFFB6,
-    0xFFB6, 0xFF96, 0xFFB6, 0xFF95, 0xFF95, 0xF774, 0xFF74, 0xF74E,
-    0xF684, 0xFE83, 0xF642, 0xF642, 0x4161, 0x1080, 0x0820, 0x0820,
-    0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0020, 0x0840, 0x0840, 0x10A0, 0x20C1,
-    0x28E1, 0x2922, 0x3982, 0x49E3, 0x6264, 0xF666, 0xFF08, 0xF6E8,
-    0xFF29, 0xFF09, 0xF76A, 0xFF94, 0xFFB7, 0xF7B7, 0xFFB7, 0xFFB7,
-    0xFFB7, 0xFF96, 0xFFB6, 0xF7B5, 0xFF95, 0xFF74, 0xFF74, 0xFEED,
-    0xF684, 0xF683, 0xFE82, 0xFE82, 0x3962, 0x1080, 0x0840, 0x0840,
-    0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0820, 0x0020, 0x1060, 0x1080, 0x18A0, 0x20C1,
-    0x2101, 0x3962, 0x3982, 0x5224, 0xE665, 0xFF27, 0xFEE8, 0xFF29,
-    0xF709, 0xFF6A, 0xFF31, 0xFFB7, 0xF7D7, 0xFFB7, 0xFFB7, 0xFFB7,
-    0xF7B7, 0xFFB7, 0xFFB7, 0xFFB6, 0xFF95, 0xF795, 0xFF74, 0xF708,
-    0xF6A4, 0xFEA4, 0xF682, 0xF682, 0x18A1, 0x10A0, 0x0840, 0x0840,
-    0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0020, 0x0840, 0x0840, 0x1060, 0x18A0, 0x20C1,
-    0x2922, 0x3162, 0x49E3, 0xBDA5, 0xFF27, 0xF6E8, 0xFF29, 0xFF09,
-    0xFF4A, 0xF74C, 0xFFB7, 0xFFD8, 0xFFD8, 0xFFD8, 0xFFD8, 0xFFD8,
-    0xFFD8, 0xFFB7, 0xF7B7, 0xFFB6, 0xFFB6, 0xFF95, 0xFF4C, 0xFEC5,
-    0xF6E5, 0xFEA4, 0xF6C2, 0xD563, 0x20C1, 0x18A0, 0x1080, 0x0840,
-    0x0820, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0020, 0x0020, 0x0840, 0x0840, 0x1080, 0x18A0, 0x2901,
-    0x2922, 0x3982, 0x9C43, 0xFF05, 0xFF27, 0xF6E8, 0xFF29, 0xFF4A,
-    0xFF4C, 0xF774, 0xFFD8, 0xFFD8, 0xFFD8, 0xFFF9, 0xFFD8, 0xFFD8,
-    0xFFD8, 0xFFD8, 0xFFB7, 0xFFB7, 0xFFB6, 0xFF33, 0xF6E8, 0xFF27,
-    0xF6E5, 0xF6C4, 0xFEC3, 0x9423, 0x18A1, 0x18A0, 0x1060, 0x0840,
-    0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0020, 0x0020, 0x0820, 0x1080, 0x18A0, 0x20C1, 0x20E1,
-    0x2922, 0x41E3, 0xEEC5, 0xFF26, 0xF707, 0xFF29, 0xFF4A, 0xF74C,
-    0xFFB0, 0xFFD8, 0xFFD8, 0xFFF9, 0xFFDA, 0xFFFA, 0xFFDA, 0xFFFA,
-    0xFFD9, 0xFFD8, 0xFFD8, 0xFFB7, 0xFFB7, 0xF74E, 0xFEE8, 0xFF27,
-    0xF705, 0xFEE5, 0xFEE3, 0x49E3, 0x2901, 0x18A0, 0x1080, 0x0840,
-    0x0840, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0020, 0x0820, 0x0020, 0x0840, 0x1080, 0x18A0, 0x20C1, 0x2901,
-    0x3162, 0x6B23, 0xFF05, 0xFF27, 0xFF27, 0xFF09, 0xFF6A, 0xF74C,
-    0xFFB7, 0xFFD8, 0xFFD9, 0xFFFA, 0xFFDB, 0xFFFB, 0xFFDB, 0xFFFA,
-    0xFFDA, 0xFFF9, 0xFFD8, 0xFFD8, 0xFFB7, 0xF74E, 0xFF09, 0xFF07,
-    0xF726, 0xF705, 0xB503, 0x2902, 0x2101, 0x18A0, 0x1060, 0x0840,
-    0x0840, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0820, 0x0020, 0x0840, 0x1080, 0x18A0, 0x18C1, 0x28E1,
-    0x3162, 0x9423, 0xF705, 0xF727, 0xFF09, 0xFF6A, 0xF74C, 0xFFB2,
-    0xFFD8, 0xFFF9, 0xFFDA, 0xFFDB, 0xFFFC, 0xFFDC, 0xFFFC, 0xFFFB,
-    0xFFDB, 0xFFFA, 0xFFD8, 0xFFD8, 0xFFB7, 0xFFB0, 0xFF09, 0xF727,
-    0xFF26, 0xFF05, 0x62A3, 0x3122, 0x2101, 0x20C1, 0x1080, 0x0840,
-    0x0840, 0x0820, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0020, 0x0020, 0x0840, 0x0840, 0x1080, 0x18A0, 0x20C1, 0x2901,
-    0x3162, 0xA4C4, 0xFF26, 0xFF07, 0xFF48, 0xFF6A, 0xFF8D, 0xFFD7,
-    0xFFD8, 0xFFDA, 0xFFFB, 0xFFFC, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFDC,
-    0xFFDB, 0xFFFA, 0xFFD9, 0xFFD8, 0xFFD7, 0xF7B0, 0xFF69, 0xFF47,
-    0xF707, 0xC5A5, 0x3182, 0x2922, 0x2901, 0x18C1, 0x1080, 0x0840,
-    0x0840, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0020, 0x0840, 0x0840, 0x1080, 0x10A0, 0x20C1, 0x20E1,
-    0x3162, 0xAD45, 0xFF26, 0xFF47, 0xF748, 0xFF4A, 0xFFD2, 0xFFD8,
-    0xFFD8, 0xFFDA, 0xFFDB, 0xFFFC, 0xFFFE, 0xFFFE, 0xFFFE, 0xFFFD,
-    0xFFFC, 0xFFDA, 0xFFF9, 0xFFD8, 0xFFD7, 0xFFB0, 0xFF49, 0xFF68,
-    0xFF27, 0x9465, 0x3982, 0x2922, 0x2901, 0x20C1, 0x1080, 0x0840,
-    0x0840, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0820, 0x0840, 0x0840, 0x1080, 0x18A0, 0x20C1, 0x2101,
-    0x3962, 0xB565, 0xFF46, 0xFF47, 0xFF69, 0xFF6A, 0xFFD7, 0xFFD8,
-    0xFFD9, 0xFFDA, 0xFFFB, 0xFFFD, 0xFFFE, 0xFFFE, 0xFFFE, 0xFFFE,
-    0xFFFC, 0xFFDB, 0xFFD9, 0xFFD8, 0xFFD7, 0xFFD2, 0xF749, 0xFF48,
-    0xFF46, 0x7364, 0x3982, 0x2922, 0x2101, 0x20C1, 0x1080, 0x0840,
-    0x0840, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0020, 0x0840, 0x0840, 0x1080, 0x18A0, 0x18C1, 0x20E1,
-    0x3162, 0xB545, 0xF745, 0xFF47, 0xFF49, 0xFFB0, 0xFFD7, 0xFFD8,
-    0xFFD8, 0xFFDA, 0xFFDB, 0xFFFD, 0xFFFE, 0xFFFE, 0xFFFE, 0xFFFD,
-    0xFFFC, 0xFFFB, 0xFFD9, 0xFFD8, 0xFFD7, 0xFFD2, 0xFF49, 0xFF68,
-    0xFF46, 0x62C3, 0x3982, 0x2922, 0x2901, 0x18A0, 0x1080, 0x0840,
-    0x0840, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0820, 0x0840, 0x0840, 0x1080, 0x18A0, 0x20C1, 0x2101,
-    0x3962, 0xB503, 0xFF66, 0xFF47, 0xFF48, 0xFFB4, 0xFFD7, 0xFFD8,
-    0xFFD8, 0xFFD9, 0xFFDB, 0xFFFC, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFC,
-    0xFFDB, 0xFFDA, 0xFFF9, 0xFFD8, 0xFFD7, 0xFFB2, 0xFF69, 0xF748,
-    0xF766, 0x5224, 0x3982, 0x2922, 0x28E1, 0x10A0, 0x1080, 0x0840,
-    0x0840, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0020, 0x0840, 0x0840, 0x1080, 0x18A0, 0x20C1, 0x20E1,
-    0x2922, 0x9CA4, 0xFF65, 0xFF66, 0xFF48, 0xFFD4, 0xFFD6, 0xFFD7,
-    0xFFD8, 0xFFD9, 0xFFFA, 0xFFDB, 0xFFDC, 0xFFFC, 0xFFDC, 0xFFFC,
-    0xFFFB, 0xFFD9, 0xFFD8, 0xFFD8, 0xFFD7, 0xFF94, 0xFF89, 0xFF68,
-    0xFF86, 0x5224, 0x3962, 0x2922, 0x20C1, 0x18A0, 0x1080, 0x0840,
-    0x0840, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0020, 0x0820, 0x0840, 0x1080, 0x1060, 0x18A0, 0x2101,
-    0x3122, 0x83E4, 0xFF85, 0xFF66, 0xFF88, 0xFFD2, 0xFFD6, 0xFFB7,
-    0xFFD8, 0xFFD8, 0xFFD9, 0xFFFA, 0xFFDB, 0xFFFB, 0xFFDB, 0xFFFA,
-    0xFFDA, 0xFFF9, 0xFFD8, 0xFFD8, 0xFFD7, 0xFFB4, 0xF788, 0xFF87,
-    0xFF66, 0x5AA3, 0x3162, 0x20E1, 0x20C1, 0x18A0, 0x1080, 0x0840,
-    0x0840, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0020, 0x0840, 0x0840, 0x1080, 0x1080, 0x20C1,
-    0x2922, 0x6303, 0xFF65, 0xF766, 0xFF88, 0xFF8D, 0xFFD6, 0xFFD7,
-    0xFFD8, 0xFFD8, 0xFFD8, 0xFFD9, 0xFFFA, 0xFFDA, 0xFFFA, 0xFFD9,
-    0xFFD9, 0xFFD8, 0xFFD8, 0xFFD7, 0xFFD6, 0xFFD4, 0xFF88, 0xFF87,
-    0xFF86, 0x6B23, 0x2922, 0x2901, 0x20C1, 0x18A0, 0x1080, 0x0840,
-    0x0840, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0020, 0x0820, 0x0840, 0x0840, 0x1080, 0x18A0, 0x20C1,
-    0x2101, 0x41E2, 0xFF85, 0xFF66, 0xFF88, 0xFF89, 0xFFD5, 0xFFD7,
-    0xFFD7, 0xFFD8, 0xFFD8, 0xFFD8, 0xFFD8, 0xFFD9, 0xFFF9, 0xFFD9,
-    0xFFD8, 0xFFD8, 0xFFD7, 0xFFD7, 0xFFD6, 0xFFB4, 0xFF88, 0xF787,
-    0xFF66, 0x7364, 0x2922, 0x2101, 0x20C1, 0x10A0, 0x0840, 0x0840,
-    0x0020, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0020, 0x0840, 0x0840, 0x1080, 0x18A0, 0x18C1,
-    0x20E1, 0x2922, 0xE6A5, 0xFF66, 0xFF87, 0xF788, 0xFFB0, 0xFFB6,
-    0xFFD7, 0xFFD7, 0xFFD8, 0xFFD8, 0xFFD8, 0xFFF8, 0xFFD8, 0xFFD8,
-    0xFFD8, 0xFFD7, 0xFFB7, 0xFFD6, 0xFFB6, 0xFFD4, 0xFF88, 0xFF86,
-    0xFF86, 0x9C43, 0x2922, 0x20C1, 0x18A0, 0x1080, 0x0840, 0x0840,
-    0x0820, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0020, 0x0820, 0x0840, 0x0840, 0x1080, 0x18A0,
-    0x20C1, 0x2101, 0xB565, 0xFF86, 0xFF87, 0xFF88, 0xFF8B, 0xFFD6,
-    0xFFD6, 0xFFB7, 0xFFD7, 0xFFD7, 0xFFD7, 0xFFD8, 0xFFD7, 0xFFD7,
-    0xF7D7, 0xFFD7, 0xFFB6, 0xFFD6, 0xFFB6, 0xFFD4, 0xFF88, 0xF766,
-    0xFF66, 0xA4C4, 0x20E1, 0x18C1, 0x10A0, 0x1060, 0x0840, 0x0840,
-    0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0820, 0x0020, 0x0840, 0x0840, 0x1080, 0x10A0,
-    0x20C1, 0x20E1, 0x6B64, 0xFF66, 0xFF87, 0xFF88, 0xF788, 0xFFB0,
-    0xFFD6, 0xFFB6, 0xFFD7, 0xFFB7, 0xFFD7, 0xFFD2, 0xF7AD, 0xFFAC,
-    0xFFB0, 0xFFD6, 0xFFB6, 0xFFD6, 0xFFB6, 0xFFD4, 0xFF87, 0xFF86,
-    0xFF86, 0xB565, 0x20C1, 0x18A0, 0x1080, 0x0840, 0x0820, 0x0840,
-    0x0820, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0020, 0x0840, 0x0820, 0x1080, 0x1060,
-    0x18A0, 0x20C1, 0x3162, 0xFF66, 0xFFA7, 0xFF87, 0xFF88, 0xFF89,
-    0xFFD4, 0xFFB6, 0xFFD6, 0xFFB6, 0xF7B2, 0xFFAB, 0xFF8B, 0xFFAB,
-    0xF78B, 0xFF8D, 0xFFD6, 0xFFD5, 0xFFB5, 0xFFB2, 0xF787, 0xFF86,
-    0xFF66, 0xC5A5, 0x18C1, 0x10A0, 0x1060, 0x0840, 0x0840, 0x0020,
-    0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0840, 0x0840, 0x1080,
-    0x1080, 0x20C1, 0x18C1, 0xAD45, 0xFF86, 0xFF87, 0xF788, 0xFF88,
-    0xFFAC, 0xFFD5, 0xFFD6, 0xFFD6, 0xFF8C, 0xFF8A, 0xEF6A, 0x8C45,
-    0xFFAA, 0xFF89, 0xFFAD, 0xFFB5, 0xFFD5, 0xFFAF, 0xFF87, 0xFF86,
-    0xFF86, 0xCE26, 0x18A0, 0x1080, 0x0840, 0x0840, 0x0020, 0x0820,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0020, 0x0820, 0x0020, 0x0840, 0x0840,
-    0x1080, 0x18A0, 0x20C1, 0x62A3, 0xFFA7, 0xFF87, 0xFF87, 0xFF88,
-    0xFFA8, 0xFFAF, 0xFFD5, 0xFFB2, 0xFF89, 0xF789, 0xC5A5, 0x5224,
-    0xC5A5, 0xFF89, 0xFFC8, 0xFFAF, 0xF7D4, 0xFF89, 0xFF87, 0xF787,
-    0xFF66, 0xC626, 0x1080, 0x1060, 0x0840, 0x0840, 0x0020, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0840, 0x0840,
-    0x1060, 0x1080, 0x1880, 0x18C1, 0xDE45, 0xF787, 0xFF87, 0xFFA7,
-    0xF7A8, 0xFFA8, 0xFFD2, 0xFFAF, 0xFF89, 0xFF89, 0xA4C4, 0x49E3,
-    0x6B64, 0xFFA8, 0xFFA8, 0xF7A7, 0xFFA7, 0xFF87, 0xFF87, 0xFF87,
-    0xFF86, 0xCDC5, 0x1080, 0x0840, 0x0840, 0x0820, 0x0020, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0820, 0x0840,
-    0x0840, 0x1080, 0x1060, 0x18A0, 0x62A3, 0xFFA7, 0xFF87, 0xFFA7,
-    0xFFA7, 0xFFA8, 0xFFC9, 0xF78B, 0xFFA8, 0xFFA8, 0x8C65, 0x3982,
-    0x3982, 0xF768, 0xFFA8, 0xFFA7, 0xF787, 0xFF87, 0xFF87, 0xFF87,
-    0xF787, 0xA4C4, 0x0040, 0x0820, 0x0020, 0x0020, 0x0000, 0x0020,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x0020,
-    0x0840, 0x0840, 0x1080, 0x0860, 0x1080, 0x9465, 0xF787, 0xFFA7,
-    0xFFA7, 0xFFA8, 0xFFA8, 0xFFA8, 0xFFA8, 0xFFA8, 0x9465, 0x3162,
-    0x2902, 0xC626, 0xFF88, 0xFFA7, 0xFFA7, 0xFFA7, 0xFFA7, 0xFFA7,
-    0xFFA7, 0x5262, 0x0840, 0x0840, 0x0820, 0x0020, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020,
-    0x0840, 0x0840, 0x0840, 0x1080, 0x1060, 0x18A0, 0x9465, 0xFFC7,
-    0xFFA7, 0xFFA7, 0xFFA8, 0xFFA8, 0xFFA8, 0xFFA8, 0x7364, 0x20E1,
-    0x2101, 0xA4C4, 0xFFC7, 0xFFA7, 0xFFA7, 0xFFA7, 0xFFA7, 0xFFA7,
-    0x9CA4, 0x0840, 0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0020, 0x0840, 0x0840, 0x0840, 0x0840, 0x1080, 0x1060, 0x4A62,
-    0xBDA5, 0xF788, 0xFFA7, 0xFFA8, 0xFFC8, 0xFFA8, 0x41C2, 0x20C1,
-    0x18C1, 0x7364, 0xFFA7, 0xFFA7, 0xFFA7, 0xFFA7, 0xFFA7, 0x9C43,
-    0x0840, 0x0840, 0x0020, 0x0820, 0x0020, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0020, 0x0020, 0x0840, 0x0820, 0x0840, 0x0840, 0x1080, 0x1060,
-    0x1080, 0x3122, 0x6B23, 0x9465, 0x9445, 0x5AA3, 0x1880, 0x10A0,
-    0x18A0, 0x5262, 0xFFC7, 0xFFA7, 0xF747, 0xB545, 0x39E2, 0x0020,
-    0x0020, 0x0020, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0020, 0x0020, 0x0840, 0x0840, 0x0840, 0x0840,
-    0x1080, 0x1060, 0x1080, 0x1060, 0x1080, 0x1060, 0x1080, 0x1060,
-    0x1080, 0x1080, 0x18A0, 0x20C1, 0x1040, 0x0840, 0x0840, 0x0020,
-    0x0820, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0020, 0x0000, 0x0820, 0x0020, 0x0820, 0x0840, 0x0840,
-    0x0020, 0x0840, 0x0860, 0x1040, 0x0860, 0x0840, 0x0860, 0x1040,
-    0x0860, 0x0840, 0x0860, 0x0840, 0x0820, 0x0840, 0x0020, 0x0820,
-    0x0000, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x0020, 0x0820,
-    0x0020, 0x0840, 0x0020, 0x0840, 0x0820, 0x0840, 0x0020, 0x0840,
-    0x0820, 0x0840, 0x0840, 0x0020, 0x0820, 0x0020, 0x0000, 0x0020,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0020,
-    0x0820, 0x0020, 0x0820, 0x0020, 0x0820, 0x0020, 0x0820, 0x0020,
-    0x0820, 0x0020, 0x0820, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,
-    0x0000, 0x0020, 0x0820, 0x0020, 0x0820, 0x0020, 0x0820, 0x0020,
-    0x0820, 0x0000, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0000, 0x0020,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 },
-  { 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0000, 0x0020,
-    0x0000, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0820, 0x0000, 0x0020, 0x0000, 0x0820, 0x0800,
-    0x0020, 0x0000, 0x0020, 0x0000, 0x0020, 0x0000, 0x0020, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0020, 0x0000, 0x0820, 0x0000, 0x0820, 0x0000,
-    0x0820, 0x0000, 0x0820, 0x0000, 0x0820, 0x0800, 0x0020, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,
-    0x0000, 0x0020, 0x0800, 0x0820, 0x0000, 0x0820, 0x0800, 0x0820,
-    0x0000, 0x0820, 0x0800, 0x0820, 0x0020, 0x0000, 0x0020, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0020, 0x0000, 0x0820, 0x0800, 0x0820, 0x0820, 0x1020, 0x0820,
-    0x0820, 0x0820, 0x0820, 0x0820, 0x0820, 0x0800, 0x0820, 0x0000,
-    0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0800,
-    0x0820, 0x0000, 0x0820, 0x0820, 0x0820, 0x0820, 0x1020, 0x1020,
-    0x1020, 0x1020, 0x1020, 0x1020, 0x0820, 0x0800, 0x0820, 0x0000,
-    0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0800,
-    0x0020, 0x0800, 0x1020, 0x0820, 0x1020, 0x1020, 0x1020, 0x1020,
-    0x1841, 0x1020, 0x1020, 0x1020, 0x0820, 0x0820, 0x0820, 0x0000,
-    0x0820, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0820,
-    0x0800, 0x0820, 0x0820, 0x1020, 0x1841, 0x1041, 0x2061, 0xB282,
-    0xAA82, 0x38E2, 0x1841, 0x1020, 0x1020, 0x0820, 0x0820, 0x0800,
-    0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0800,
-    0x1020, 0x0820, 0x1020, 0x1041, 0x1841, 0x1861, 0x1861, 0xAA82,
-    0xE2E2, 0xDAA2, 0x1861, 0x1841, 0x1841, 0x1020, 0x0820, 0x0800,
-    0x0820, 0x0800, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0800, 0x0820,
-    0x0820, 0x1020, 0x1841, 0x1841, 0x1861, 0x2081, 0x20A1, 0xAA82,
-    0xE323, 0xE323, 0x5141, 0x1861, 0x1041, 0x1841, 0x1020, 0x0820,
-    0x0800, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0800, 0x0820, 0x0820,
-    0x0820, 0x1020, 0x1041, 0x2061, 0x2081, 0x1881, 0x30E2, 0xE323,
-    0xE323, 0xE323, 0x7A21, 0x18A1, 0x2061, 0x1841, 0x1020, 0x0820,
-    0x0820, 0x0800, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0800, 0x0820, 0x0820,
-    0x1020, 0x1041, 0x2061, 0x2081, 0x18A1, 0x28E1, 0x9282, 0xE323,
-    0xE323, 0xE323, 0x8A82, 0x1881, 0x18A1, 0x2061, 0x1041, 0x1020,
-    0x0820, 0x0800, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0800, 0x0820, 0x0820,
-    0x1020, 0x1841, 0x18A1, 0x1881, 0x28C1, 0x7221, 0xE383, 0xE383,
-    0xE383, 0xE383, 0xB282, 0x28E1, 0x20A1, 0x1881, 0x1841, 0x1020,
-    0x0820, 0x0820, 0x0800, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0820, 0x0820, 0x1020,
-    0x1841, 0x2061, 0x1881, 0x3921, 0xE323, 0xE383, 0xE383, 0xEBE3,
-    0xE3C3, 0xE383, 0x8A82, 0x28E1, 0x18C1, 0x1881, 0x2061, 0x1841,
-    0x0820, 0x0820, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0800, 0x0820, 0x1020,
-    0x1041, 0x20A1, 0x1881, 0x89E2, 0xE383, 0xE3E3, 0xE3C3, 0xE3E3,
-    0xEBC3, 0xE3E3, 0x9282, 0x3122, 0x28E1, 0x20A1, 0x1861, 0x1841,
-    0x1020, 0x0820, 0x0800, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0820, 0x1020, 0x1020,
-    0x1841, 0x1881, 0x20C1, 0xCB22, 0xEBE3, 0xE3C3, 0xEC44, 0xE424,
-    0xEC24, 0xE424, 0x6201, 0x3101, 0x28E1, 0x20C1, 0x1881, 0x1841,
-    0x1020, 0x0820, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0800, 0x0820, 0x1020,
-    0x1841, 0x1881, 0x18C1, 0xE383, 0xE3E3, 0xE3C3, 0xEC24, 0xEC63,
-    0xF463, 0xCBA2, 0x3982, 0x3921, 0x28E1, 0x20C1, 0x18A1, 0x1841,
-    0x1020, 0x0820, 0x0800, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0020, 0x0800, 0x0820, 0x0820, 0x1020,
-    0x1841, 0x2081, 0x38E2, 0xE383, 0xEBE3, 0xEC44, 0xE424, 0xEC84,
-    0xEC84, 0x8303, 0x4181, 0x3162, 0x28E1, 0x20C1, 0x1881, 0x1841,
-    0x1020, 0x0820, 0x0800, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x0800, 0x0820, 0x1020,
-    0x1041, 0x18A1, 0x3902, 0xEBC3, 0xE3C3, 0xEC24, 0xEC63, 0xECA4,
-    0xBC02, 0x5262, 0x4981, 0x3962, 0x28E1, 0x20C1, 0x1881, 0x1841,
-    0x1020, 0x0820, 0x0820, 0x0800, 0x0020, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0020, 0x0800, 0x0820, 0x0820, 0x1020,
-    0x1041, 0x2081, 0x3921, 0xEBE3, 0xE3C3, 0xEC44, 0xEC63, 0xD442,
-    0x4A62, 0x49E3, 0x3982, 0x3162, 0x28E1, 0x20C1, 0x2081, 0x1041,
-    0x1020, 0x0820, 0x0820, 0x0800, 0x0020, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x0800, 0x0820, 0x1020,
-    0x1861, 0x1881, 0x28E1, 0xE3E3, 0xE3C3, 0xEC23, 0xEC44, 0x7AC3,
-    0x49E3, 0x41E2, 0x3982, 0x3921, 0x28E1, 0x18C1, 0x20A1, 0x1841,
-    0x1020, 0x0820, 0x0800, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0820, 0x0820, 0x1020,
-    0x1841, 0x2081, 0x18A1, 0xEB83, 0xEBE3, 0xE423, 0xCBA2, 0x39C2,
-    0x41E2, 0x3982, 0x3162, 0x3122, 0x3921, 0x3121, 0x2081, 0x1041,
-    0x1020, 0x0820, 0x0800, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0800, 0x0820, 0x1020,
-    0x1841, 0x1861, 0x1881, 0xB322, 0xE3E3, 0xEC23, 0xBB22, 0x39A2,
-    0x3982, 0x3162, 0x3901, 0x6221, 0xE383, 0x69C1, 0x2061, 0x1841,
-    0x1020, 0x0820, 0x0800, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0820, 0x0800, 0x0820,
-    0x1020, 0x1841, 0x20A1, 0x69A1, 0xEBE3, 0xEC23, 0xB322, 0x3121,
-    0x3101, 0x3921, 0x3901, 0xE3C1, 0xEBC3, 0x7221, 0x1041, 0x1020,
-    0x0820, 0x0820, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x0800, 0x0820,
-    0x1020, 0x1041, 0x1881, 0x2881, 0xCBA2, 0xEBE3, 0xCBA2, 0x2922,
-    0x2922, 0x28E1, 0x61A1, 0xEBC3, 0xE3C1, 0xBB22, 0x1841, 0x1020,
-    0x0820, 0x0820, 0x0800, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0800, 0x0820, 0x0820,
-    0x1020, 0x1841, 0x1041, 0x2081, 0x69C1, 0xEBE3, 0xE3C3, 0x28E1,
-    0x28E1, 0x28E1, 0x7A21, 0xE3C1, 0xE3A1, 0xE3C1, 0x30A1, 0x0820,
-    0x0820, 0x0800, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0800, 0x0800,
-    0x0820, 0x1020, 0x1041, 0x2061, 0x1861, 0x8A82, 0xEBE3, 0x3921,
-    0x2081, 0x1881, 0x7201, 0xE3C1, 0xE3C1, 0xEBC1, 0x9282, 0x0820,
-    0x0800, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0820, 0x0800,
-    0x0820, 0x1020, 0x1020, 0x1841, 0x2061, 0x18A1, 0x69A1, 0x5161,
-    0x2081, 0x1861, 0x69C1, 0xEBC1, 0xE3C1, 0xE3A1, 0xE361, 0x0820,
-    0x0000, 0x0800, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0800,
-    0x0800, 0x0820, 0x1020, 0x1041, 0x1841, 0x2061, 0x1861, 0x2061,
-    0x1861, 0x1861, 0x2061, 0xE3C1, 0xE3A1, 0xE3C1, 0xEBC1, 0x3921,
-    0x0800, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0820,
-    0x0800, 0x0820, 0x0820, 0x1020, 0x1841, 0x1841, 0x1841, 0x2061,
-    0x1041, 0x1841, 0x1841, 0x7A21, 0xEBC1, 0xE3C1, 0xE3A1, 0x5141,
-    0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020,
-    0x0800, 0x0800, 0x0820, 0x1020, 0x1020, 0x1841, 0x1041, 0x1841,
-    0x1841, 0x1841, 0x1041, 0x1861, 0xDB61, 0xE3C1, 0xEBC1, 0x5941,
-    0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0800,
-    0x0820, 0x0800, 0x0820, 0x1020, 0x1020, 0x1020, 0x1020, 0x1041,
-    0x1841, 0x1841, 0x1020, 0x1020, 0x69C1, 0xEBC1, 0xE3C1, 0x28A1,
-    0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020,
-    0x0800, 0x0800, 0x0820, 0x1020, 0x1020, 0x1020, 0x1020, 0x1020,
-    0x1020, 0x1020, 0x1020, 0x1020, 0x0820, 0xCBA2, 0xEBC1, 0x1020,
-    0x0800, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0000, 0x0820,
-    0x0800, 0x0820, 0x0820, 0x0820, 0x1020, 0x1020, 0x1020, 0x1020,
-    0x1020, 0x1020, 0x1020, 0x1020, 0x1020, 0x9282, 0x9B01, 0x0020,
-    0x0000, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0800,
-    0x0820, 0x0820, 0x0820, 0x0820, 0x1020, 0x1020, 0x1020, 0x1020,
-    0x1020, 0x1020, 0x1020, 0x1020, 0x0820, 0x5141, 0x4921, 0x0820,
-    0x0800, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0020, 0x0800, 0x0820, 0x0000, 0x0820,
-    0x0800, 0x0820, 0x0820, 0x1020, 0x1020, 0x1020, 0x1020, 0x1841,
-    0x1841, 0x1020, 0x1020, 0x1020, 0x1020, 0x18A1, 0x0820, 0x0800,
-    0x0820, 0x0000, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0000, 0x0820, 0x0800,
-    0x0820, 0x0820, 0x1020, 0x1020, 0x1841, 0x1841, 0x1041, 0x1841,
-    0x1841, 0x1841, 0x1041, 0x1020, 0x1020, 0x1020, 0x0820, 0x0820,
-    0x0800, 0x0820, 0x0000, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0800, 0x0820, 0x0820,
-    0x0820, 0x1020, 0x1020, 0x2881, 0x7A21, 0x1821, 0x1041, 0x1841,
-    0x1841, 0x1841, 0x1041, 0x1841, 0x1020, 0x1020, 0x0820, 0x0820,
-    0x0800, 0x0820, 0x0800, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0020, 0x0000, 0x0020, 0x0800, 0x0820, 0x0800, 0x0820,
-    0x1020, 0x1020, 0x1041, 0x5141, 0xEC61, 0x7A21, 0x1841, 0x1841,
-    0x1841, 0x3922, 0x1841, 0x1041, 0x1841, 0x1020, 0x1020, 0x0820,
-    0x0820, 0x0800, 0x0820, 0x0800, 0x0020, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0020, 0x0000, 0x0820, 0x0800, 0x0820, 0x0820, 0x1020,
-    0x1020, 0x1841, 0x1041, 0x59C1, 0xEC61, 0xEC61, 0x28A1, 0x1861,
-    0x2061, 0x8281, 0x2081, 0x1041, 0x1841, 0x1841, 0x1020, 0x1020,
-    0x0820, 0x0800, 0x0800, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0020, 0x0000, 0x0020, 0x0800, 0x1020, 0x0820, 0x1020,
-    0x1041, 0x1841, 0x1041, 0x6201, 0xEC61, 0xEC81, 0x69A1, 0x2061,
-    0x2081, 0xA2E1, 0x38E2, 0x1861, 0x2061, 0x1841, 0x1041, 0x1020,
-    0x1020, 0x0820, 0x0820, 0x0800, 0x0820, 0x0000, 0x0020, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0020, 0x0000, 0x0820, 0x0800, 0x0820, 0x0820, 0x1020, 0x1841,
-    0x1841, 0x1041, 0x2061, 0x9B01, 0xECA1, 0xECA1, 0xAB61, 0x2061,
-    0x2061, 0xB381, 0x4121, 0x2061, 0x1861, 0x2061, 0x1041, 0x1841,
-    0x1020, 0x0820, 0x0820, 0x0800, 0x0820, 0x0000, 0x0020, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0020, 0x0000, 0x0820, 0x0800, 0x0820, 0x1020, 0x1020, 0x1841,
-    0x1041, 0x1861, 0x2061, 0xDC21, 0xECC1, 0xF4C1, 0xF4E1, 0x4981,
-    0x2081, 0xCC01, 0x5162, 0x2881, 0x2081, 0x1861, 0x2061, 0x1841,
-    0x1020, 0x1020, 0x0820, 0x0800, 0x0820, 0x0000, 0x0020, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0020, 0x0000, 0x0820, 0x0800, 0x0820, 0x1020, 0x1041, 0x1841,
-    0x2061, 0x1861, 0x7A21, 0xF4E1, 0xF4C1, 0xF4C1, 0xF4C1, 0xDC21,
-    0x6201, 0xE4A1, 0x61A1, 0x28A1, 0x2061, 0x2081, 0x2061, 0x1041,
-    0x1841, 0x1020, 0x0820, 0x0820, 0x0800, 0x0800, 0x0020, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0020, 0x0800, 0x0800, 0x0820, 0x0820, 0x1020, 0x1041, 0x2061,
-    0x1861, 0x28C1, 0xDC21, 0xF4C1, 0xECC1, 0xF4C1, 0xECC1, 0xF502,
-    0xF4C1, 0xF4E1, 0x7A42, 0x28A1, 0x28A1, 0x2881, 0x1861, 0x2061,
-    0x1841, 0x1020, 0x1020, 0x0820, 0x0800, 0x0020, 0x0000, 0x0020,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000,
-    0x0020, 0x0800, 0x0820, 0x0820, 0x1020, 0x1841, 0x1041, 0x2061,
-    0x28A1, 0xBC02, 0xF4C1, 0xF502, 0xF502, 0xF502, 0xF502, 0xF502,
-    0xF502, 0xED02, 0x9323, 0x30A1, 0x28A1, 0x28A1, 0x2081, 0x2061,
-    0x1041, 0x1841, 0x1020, 0x0820, 0x0800, 0x0000, 0x0020, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000,
-    0x0020, 0x0000, 0x0800, 0x0820, 0x1020, 0x1841, 0x1861, 0x1861,
-    0xAB61, 0xF502, 0xED02, 0xF501, 0xF521, 0xF501, 0xF521, 0xF501,
-    0xF521, 0xF521, 0xD462, 0x38E2, 0x30C1, 0x28A1, 0x2881, 0x2881,
-    0x1861, 0x1841, 0x1020, 0x0820, 0x0820, 0x0820, 0x0800, 0x0820,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,
-    0x0800, 0x0820, 0x0820, 0x1020, 0x1020, 0x1841, 0x2061, 0x9AE1,
-    0xF521, 0xF521, 0xF521, 0xF501, 0xF542, 0xF542, 0xF542, 0xED42,
-    0xF542, 0xF542, 0xF542, 0x4962, 0x30C2, 0x30C1, 0x28A1, 0x2061,
-    0x1861, 0x1841, 0x1841, 0x1020, 0x0820, 0x0800, 0x0020, 0x0000,
-    0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,
-    0x0800, 0x0800, 0x0820, 0x1020, 0x1041, 0x1041, 0x7A81, 0xF501,
-    0xED21, 0xF501, 0xF521, 0xF542, 0xED42, 0xF562, 0xF582, 0xF562,
-    0xF582, 0xF582, 0xF562, 0x9B23, 0x38E2, 0x30C1, 0x28A1, 0x2881,
-    0x2081, 0x2061, 0x1841, 0x1020, 0x0820, 0x0820, 0x0800, 0x0020,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000,
-    0x0820, 0x0800, 0x0820, 0x1020, 0x1841, 0x82A1, 0xF521, 0xF521,
-    0xF542, 0xF542, 0xF542, 0xF582, 0xED62, 0xF582, 0xF5A2, 0xF562,
-    0xF582, 0xED62, 0xF582, 0xDD02, 0x4122, 0x30E2, 0x30C1, 0x2881,
-    0x2081, 0x1861, 0x1841, 0x1020, 0x0820, 0x0800, 0x0800, 0x0020,
-    0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000,
-    0x0820, 0x0800, 0x0820, 0x1041, 0x4161, 0xED01, 0xF521, 0xF542,
-    0xED42, 0xF562, 0xF582, 0xF562, 0xF582, 0xF5A3, 0xF648, 0xF5A2,
-    0xF5A2, 0xF5A2, 0xF5A2, 0xF582, 0xC402, 0x3902, 0x38E2, 0x28A1,
-    0x2081, 0x2061, 0x1841, 0x1841, 0x1020, 0x0820, 0x0820, 0x0000,
-    0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020,
-    0x0800, 0x0820, 0x1020, 0x1841, 0xCC21, 0xF521, 0xF542, 0xF542,
-    0xF582, 0xF562, 0xF5A2, 0xF5A2, 0xF5A2, 0xF605, 0xFF31, 0xF5C3,
-    0xF5C3, 0xF5C3, 0xF5A2, 0xF5A2, 0xF5A2, 0x9361, 0x30E2, 0x30C1,
-    0x2881, 0x2081, 0x2061, 0x1041, 0x1020, 0x0820, 0x0800, 0x0800,
-    0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000,
-    0x0800, 0x0820, 0x0820, 0x4101, 0xF542, 0xED42, 0xF542, 0xF582,
-    0xF562, 0xF5A2, 0xF5A2, 0xF5C2, 0xF5C3, 0xF6CD, 0xFF53, 0xF648,
-    0xF5E3, 0xF5E3, 0xF5C3, 0xFDC3, 0xF5A2, 0xF582, 0x8B41, 0x30C1,
-    0x30A1, 0x2081, 0x2061, 0x1041, 0x1020, 0x0820, 0x0800, 0x0820,
-    0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0820,
-    0x0800, 0x0820, 0x1020, 0x82A1, 0xF562, 0xF582, 0xF562, 0xF582,
-    0xF5A2, 0xF5A2, 0xF5C2, 0xF5E3, 0xF5E4, 0xFF53, 0xFF53, 0xF6CD,
-    0xF603, 0xF5C3, 0xF5E3, 0xF5E2, 0xF5C2, 0xF5A2, 0xF5A2, 0x8B21,
-    0x28A1, 0x2881, 0x1861, 0x1841, 0x1020, 0x0820, 0x0800, 0x0020,
-    0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0800,
-    0x0000, 0x1020, 0x0820, 0xAB61, 0xF5A1, 0xF581, 0xF581, 0xF5A2,
-    0xF5A2, 0xF5C2, 0xF5E2, 0xF5E3, 0xF689, 0xF753, 0xFF33, 0xFF53,
-    0xF604, 0xF603, 0xF603, 0xF603, 0xFDE3, 0xF5C2, 0xF5C2, 0xF5A2,
-    0x82A1, 0x2881, 0x2081, 0x1841, 0x1020, 0x1020, 0x0820, 0x0800,
-    0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0820,
-    0x0800, 0x1020, 0x1041, 0xC402, 0xF5A1, 0xF5A1, 0xF5A2, 0xF5C2,
-    0xF5C2, 0xF5E2, 0xF5E2, 0xF603, 0xFF31, 0xF753, 0xFF33, 0xFF53,
-    0xF6C9, 0xF643, 0xF603, 0xF603, 0xF5E3, 0xF5E2, 0xF5C2, 0xF5C2,
-    0xF5A2, 0x6201, 0x2061, 0x1861, 0x1841, 0x1020, 0x0820, 0x0800,
-    0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0840,
-    0x8B21, 0xCCA1, 0x6A82, 0xB3E2, 0xF581, 0xF5A2, 0xF5C2, 0xF5C2,
-    0xF5E2, 0xF602, 0xF5E3, 0xF645, 0xFF33, 0xFF53, 0xF733, 0xFF53,
-    0xFF31, 0xF643, 0xFE43, 0xF603, 0xF603, 0xF602, 0xF5E2, 0xF5C2,
-    0xF5C2, 0xDCE1, 0x2081, 0x2061, 0x1841, 0x1020, 0x0820, 0x0820,
-    0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x9321,
-    0xF5A1, 0xF5A1, 0xCCA1, 0x8B21, 0xF5C2, 0xF5C2, 0xF5C2, 0xF5E2,
-    0xF5E2, 0xF602, 0xF623, 0xFEA9, 0xFF33, 0xF753, 0xFF33, 0xFF53,
-    0xFF33, 0xF685, 0xF664, 0xF643, 0xF603, 0xF602, 0xF5E2, 0xF5E2,
-    0xF5C2, 0xF5C2, 0x4121, 0x1841, 0x1841, 0x1020, 0x0820, 0x0800,
-    0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD4E1,
-    0xF581, 0xF5A1, 0xCCA1, 0x51A1, 0xF5C2, 0xF5C2, 0xF5E2, 0xF5E2,
-    0xF602, 0xF623, 0xF603, 0xF6ED, 0xFF33, 0xFF53, 0xFF74, 0xF774,
-    0xFF74, 0xFEA7, 0xF663, 0xF664, 0xFE43, 0xF623, 0xF602, 0xF602,
-    0xF5E2, 0xFDE2, 0x51C1, 0x2061, 0x1841, 0x1020, 0x0820, 0x0800,
-    0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0xED81,
-    0xF5A1, 0xF5A1, 0x9381, 0x2061, 0xE542, 0xF5E2, 0xF602, 0xF602,
-    0xF602, 0xF623, 0xF643, 0xFEED, 0xFF33, 0xFF74, 0xFF74, 0xF774,
-    0xFF74, 0xF6C9, 0xF684, 0xF664, 0xFE43, 0xF603, 0xF623, 0xF602,
-    0xF5E2, 0xF5E2, 0x3902, 0x1841, 0x1841, 0x1020, 0x0820, 0x0800,
-    0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0000, 0xED81,
-    0xFDC2, 0x8B21, 0x28A1, 0x1841, 0x8B21, 0xF5E2, 0xF5E2, 0xF602,
-    0xF623, 0xF643, 0xF644, 0xF74E, 0xFF53, 0xFF74, 0xF774, 0xFF94,
-    0xFF74, 0xFF09, 0xF684, 0xFE84, 0xF664, 0xF643, 0xFE23, 0xF602,
-    0xF602, 0xE542, 0x28A1, 0x2061, 0x1841, 0x1020, 0x1020, 0x0820,
-    0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0xCCC1,
-    0x9381, 0x0820, 0x1841, 0x2061, 0x30C1, 0xD563, 0xF602, 0xF642,
-    0xF643, 0xF643, 0xFE64, 0xF6CD, 0xFF74, 0xFF74, 0xFF94, 0xFFB4,
-    0xFF94, 0xF729, 0xF6A4, 0xF684, 0xF664, 0xFE44, 0xF643, 0xF623,
-    0xF602, 0x9B61, 0x2081, 0x1861, 0x1841, 0x1020, 0x1020, 0x0800,
-    0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x9B81,
-    0x8281, 0x1020, 0x1841, 0x1861, 0x2881, 0x4122, 0xCD63, 0xF622,
-    0xF643, 0xF644, 0xF683, 0xF6A7, 0xFF31, 0xF774, 0xFFB4, 0xFF94,
-    0xFFB4, 0xFF09, 0xF6C4, 0xFEA4, 0xF663, 0xF664, 0xFE43, 0xF642,
-    0xFE42, 0x4981, 0x28A1, 0x1861, 0x1841, 0x1020, 0x1020, 0x0800,
-    0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x4981,
-    0x9B81, 0x1020, 0x1041, 0x2061, 0x28A1, 0x30C1, 0x6223, 0xFE42,
-    0xF643, 0xFE83, 0xF684, 0xF6A4, 0xFEE5, 0xFF74, 0xFF94, 0xFF94,
-    0xF7B4, 0xFF26, 0xF6C5, 0xF6A4, 0xF684, 0xFE83, 0xF643, 0xF643,
-    0xBCA2, 0x30A1, 0x2881, 0x1861, 0x1841, 0x1020, 0x0820, 0x0800,
-    0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0000, 0x0820,
-    0xB443, 0x1020, 0x1841, 0x1861, 0x28A1, 0x30A1, 0x3902, 0xCD43,
-    0xF664, 0xF663, 0xFEA4, 0xF6C4, 0xF6E5, 0xFF4C, 0xFF94, 0xFFD4,
-    0xFFB0, 0xF705, 0xFEC5, 0xF6C4, 0xF684, 0xFE83, 0xF683, 0xFE43,
-    0x8323, 0x30C1, 0x28A1, 0x2061, 0x1841, 0x1020, 0x0820, 0x0820,
-    0x0800, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0820,
-    0x6A21, 0x28E1, 0x1041, 0x2061, 0x2881, 0x30C1, 0x3902, 0x9BC3,
-    0xFEA3, 0xFE84, 0xF6A4, 0xFEC4, 0xF705, 0xFF6A, 0xFF94, 0xFFB4,
-    0xFFAF, 0xF726, 0xF705, 0xFEC4, 0xF6A4, 0xF684, 0xF663, 0xF642,
-    0x4983, 0x30C1, 0x2881, 0x1861, 0x1041, 0x1020, 0x0820, 0x0800,
-    0x0820, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0820, 0x0000,
-    0x1020, 0x4981, 0x1841, 0x2061, 0x28A1, 0x30E2, 0x3902, 0x72A3,
-    0xFE63, 0xF6A4, 0xF6A4, 0xFEE5, 0xF705, 0xF729, 0xFF94, 0xFF94,
-    0xFF8D, 0xFF26, 0xF705, 0xFEE5, 0xF6C4, 0xFEA4, 0xFE83, 0xE622,
-    0x3902, 0x38E2, 0x2881, 0x2081, 0x1841, 0x1841, 0x0820, 0x0820,
-    0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0820,
-    0x0820, 0x2061, 0x1041, 0x2881, 0x28A1, 0x38E2, 0x4142, 0x6223,
-    0xFEC4, 0xFEA4, 0xFEC4, 0xF6E5, 0xFF05, 0xFF48, 0xFF94, 0xF794,
-    0xFFAF, 0xF726, 0xFF05, 0xF6E5, 0xFEC4, 0xF6A4, 0xF6A4, 0xCD43,
-    0x4122, 0x30C2, 0x28A1, 0x2061, 0x1841, 0x1020, 0x1020, 0x0800,
-    0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0800, 0x0800,
-    0x0820, 0x1020, 0x1041, 0x2081, 0x30A1, 0x30E2, 0x4122, 0x6203,
-    0xF6A4, 0xF6C4, 0xFEE5, 0xF6E5, 0xFF05, 0xF748, 0xFF94, 0xFF94,
-    0xFFB0, 0xF726, 0xFF05, 0xF705, 0xFEE5, 0xF6A4, 0xFEA4, 0xC4C2,
-    0x4142, 0x38E2, 0x30A1, 0x2081, 0x2061, 0x1020, 0x0820, 0x0820,
-    0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0800,
-    0x1020, 0x1841, 0x2061, 0x2081, 0x9B81, 0xAC43, 0x4142, 0x7282,
-    0xFEC3, 0xFEE4, 0xFEE5, 0xF705, 0xFF06, 0xF748, 0xFF94, 0xFFB4,
-    0xFF94, 0xF727, 0xFF26, 0xF705, 0xFEC5, 0xF6C4, 0xF6C3, 0xAC43,
-    0x4122, 0x3902, 0x28A1, 0x2081, 0x2061, 0x1020, 0x0820, 0x0800,
-    0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0800, 0x0820,
-    0x1020, 0x1041, 0x1861, 0x4161, 0xF682, 0xF682, 0x6223, 0xAC23,
-    0xF6C4, 0xFEE5, 0xF705, 0xFF06, 0xF726, 0xFF69, 0xFF94, 0xF7B4,
-    0xFF94, 0xFF4A, 0xFF26, 0xF706, 0xFF05, 0xF6E5, 0xFEE4, 0xC4C2,
-    0x4942, 0x3902, 0x30C1, 0x28A1, 0x2061, 0x1841, 0x0820, 0x0800,
-    0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0820, 0x0820,
-    0x1020, 0x1841, 0x1881, 0x5262, 0xFEC2, 0xFEC2, 0xFEC4, 0xF6C4,
-    0xFEE5, 0xF705, 0xFF05, 0xF706, 0xFF26, 0xFF8D, 0xFF95, 0xF795,
-    0xFFB5, 0xFFB2, 0xF726, 0xFF26, 0xF705, 0xF705, 0xFEC5, 0xB503,
-    0x4183, 0x3902, 0x30C1, 0x2881, 0x1881, 0x1841, 0x1020, 0x0820,
-    0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0840,
-    0x1020, 0x1080, 0x1881, 0x20C1, 0xCD43, 0xFEC3, 0xF6C4, 0xFEE4,
-    0xF705, 0xFF05, 0xF726, 0xFF27, 0xF749, 0xFFB5, 0xFF95, 0xF7B5,
-    0xFF95, 0xFF95, 0xFF4C, 0xF726, 0xFF26, 0xFF05, 0xFF04, 0xD603,
-    0x4983, 0x4142, 0x38E2, 0x28E1, 0x20A1, 0x1841, 0x1020, 0x0820,
-    0x0800, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x0020, 0x0840,
-    0x0840, 0x18A0, 0x20C1, 0x28E1, 0xA3C3, 0xFEE3, 0xFF04, 0xF705,
-    0xF705, 0xFF26, 0xFF07, 0xF748, 0xFFB4, 0xFF95, 0xFFB5, 0xFF95,
-    0xF7B5, 0xFF95, 0xFFB4, 0xF748, 0xFF07, 0xF726, 0xFF05, 0xEEC5,
-    0x51A2, 0x4122, 0x3101, 0x28E1, 0x2081, 0x1861, 0x1020, 0x0820,
-    0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x0840, 0x0840,
-    0x1080, 0x1881, 0x18C1, 0x28C1, 0x8363, 0xFF04, 0xFF05, 0xF705,
-    0xF726, 0xFF07, 0xF748, 0xFFD2, 0xFF95, 0xFF96, 0xFFB6, 0xFFB5,
-    0xFFB6, 0xFFB6, 0xFF95, 0xFFAF, 0xF707, 0xFF26, 0xFF26, 0xFF25,
-    0x8323, 0x4983, 0x3921, 0x28E1, 0x18C1, 0x2081, 0x1841, 0x0840,
-    0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0840, 0x0840,
-    0x1080, 0x2081, 0x28E1, 0x3122, 0xA4C4, 0xFF04, 0xFF05, 0xF726,
-    0xFF07, 0xFF47, 0xFFB0, 0xFFB6, 0xFFB6, 0xFF96, 0xFFD6, 0xFFB6,
-    0xFFD6, 0xFF96, 0xFFB6, 0xF795, 0xFF4A, 0xFF47, 0xF726, 0xFF26,
-    0xB4E3, 0x4183, 0x3162, 0x2922, 0x20C1, 0x1881, 0x1080, 0x0840,
-    0x0820, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0820, 0x1080,
-    0x18A0, 0x18C1, 0x28C1, 0x2902, 0xD603, 0xF705, 0xF706, 0xFF46,
-    0xFF47, 0xF7AF, 0xFFD5, 0xFFB6, 0xFFB6, 0xFFB6, 0xFFD6, 0xFFB7,
-    0xFFD6, 0xFFB6, 0xFFD6, 0xFFB6, 0xFFB2, 0xFF48, 0xFF47, 0xFF26,
-    0xFF05, 0x5244, 0x3962, 0x2922, 0x28E1, 0x2081, 0x1080, 0x0840,
-    0x0840, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x0840, 0x0840, 0x1080,
-    0x18A0, 0x20C1, 0x2922, 0x49E3, 0xF724, 0xFF45, 0xFF46, 0xFF47,
-    0xFF6C, 0xFFD5, 0xFFB6, 0xFFD6, 0xFFB7, 0xFFD7, 0xFFB7, 0xFFD7,
-    0xFFB7, 0xFFB7, 0xFFD7, 0xFFB6, 0xFFB6, 0xFF4A, 0xFF47, 0xF746,
-    0xFF45, 0x9423, 0x3982, 0x2922, 0x20E1, 0x20C1, 0x18A0, 0x0840,
-    0x0840, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0840, 0x0840, 0x1080,
-    0x2081, 0x20E1, 0x2922, 0x9423, 0xF725, 0xFF45, 0xFF46, 0xF748,
-    0xFF94, 0xFFD6, 0xFFB6, 0xFFD7, 0xFFD7, 0xFFD7, 0xFFD8, 0xF7D7,
-    0xFFD7, 0xFFD7, 0xFFB7, 0xFFD6, 0xFFD6, 0xFF8D, 0xFF48, 0xFF47,
-    0xFF46, 0xF705, 0x5A24, 0x3162, 0x2901, 0x20C1, 0x18A0, 0x1080,
-    0x0840, 0x0020, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0020, 0x0820, 0x0840, 0x1080, 0x18A0,
-    0x20C1, 0x2101, 0x3122, 0xE6A3, 0xFF45, 0xFF46, 0xFF47, 0xFFAF,
-    0xFFD6, 0xFFB6, 0xFFD7, 0xFFD7, 0xFFD8, 0xFFD8, 0xFFD8, 0xFFD8,
-    0xFFD8, 0xFFD8, 0xFFD8, 0xFFB7, 0xFFD6, 0xF74A, 0xFF49, 0xFF48,
-    0xFF46, 0xF745, 0xB545, 0x3162, 0x2922, 0x18C1, 0x1880, 0x1080,
-    0x0840, 0x0840, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0020, 0x0840, 0x0840, 0x1060, 0x18A0,
-    0x20C1, 0x20E1, 0x6303, 0xF744, 0xFF65, 0xF766, 0xF789, 0xFFD5,
-    0xFFB6, 0xFFD7, 0xFFD7, 0xFFD8, 0xFFD8, 0xFFF9, 0xFFD9, 0xFFF9,
-    0xFFD9, 0xFFD8, 0xFFD8, 0xFFD8, 0xFFB4, 0xFFAB, 0xFF89, 0xFF88,
-    0xFF47, 0xFF46, 0xFF45, 0x5262, 0x3122, 0x2101, 0x18A0, 0x1080,
-    0x0840, 0x0840, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0020, 0x0020, 0x0840, 0x0840, 0x1080, 0x18A0,
-    0x20C1, 0x3122, 0xB503, 0xFF45, 0xFF86, 0xFF87, 0xFFAF, 0xFFD6,
-    0xFFB7, 0xFFD7, 0xFFD8, 0xFFD8, 0xFFD9, 0xFFFA, 0xFFDA, 0xFFFA,
-    0xFFDA, 0xFFF9, 0xFFD9, 0xFFD8, 0xFFD5, 0xFF8C, 0xFF8A, 0xFF89,
-    0xF788, 0xFF86, 0xFF65, 0x9CA4, 0x2922, 0x20E1, 0x20C1, 0x1080,
-    0x0840, 0x0840, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0020, 0x0840, 0x0840, 0x1080, 0x1080,
-    0x18C1, 0x2922, 0xF704, 0xF765, 0xFF66, 0xFF88, 0xFFD4, 0xFFB6,
-    0xFFD7, 0xFFD8, 0xFFD8, 0xFFF9, 0xFFDA, 0xFFFB, 0xFFDB, 0xFFFB,
-    0xFFDB, 0xFFFA, 0xFFDA, 0xFFF9, 0xFFD8, 0xF78D, 0xFF8B, 0xFFAA,
-    0xFF88, 0xFF87, 0xFF86, 0xEEC5, 0x3162, 0x2901, 0x20C1, 0x18A0,
-    0x0840, 0x0840, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0820, 0x0840, 0x0840, 0x1080, 0x18A0,
-    0x2901, 0x5262, 0xFF85, 0xFF86, 0xF766, 0xFF8C, 0xFFD6, 0xFFB7,
-    0xFFD7, 0xFFD8, 0xFFF9, 0xFFDA, 0xFFFB, 0xFFFC, 0xFFDC, 0xFFFC,
-    0xFFDC, 0xFFDB, 0xFFFA, 0xFFD9, 0xFFF8, 0xFFB2, 0xFF8C, 0xFFAA,
-    0xFF89, 0xF788, 0xFF66, 0xFF65, 0x4A62, 0x20E1, 0x18C1, 0x18A0,
-    0x1080, 0x0820, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0020, 0x0840, 0x0840, 0x1060, 0x20C1,
-    0x2101, 0x6B64, 0xFF65, 0xFF66, 0xF788, 0xFFB0, 0xFFD6, 0xFFD7,
-    0xFFD8, 0xFFD8, 0xFFD9, 0xFFDA, 0xFFFC, 0xFFFD, 0xFFFD, 0xFFFE,
-    0xFFFD, 0xFFFC, 0xFFDB, 0xFFFA, 0xFFD9, 0xFFD7, 0xFF8D, 0xFFAB,
-    0xFF89, 0xFF88, 0xFF87, 0xFF85, 0x83C4, 0x2101, 0x20C1, 0x18A0,
-    0x1080, 0x0840, 0x0840, 0x0820, 0x0020, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0020, 0x0020, 0x0840, 0x0840, 0x1080, 0x18A0,
-    0x2901, 0x9C43, 0xFF86, 0xFF66, 0xFF88, 0xFFB0, 0xFFD6, 0xFFD7,
-    0xFFD8, 0xFFD8, 0xFFDA, 0xFFFB, 0xFFFC, 0xFFFD, 0xFFFE, 0xFFFE,
-    0xFFFE, 0xFFFD, 0xFFDB, 0xFFDA, 0xFFF9, 0xFFD8, 0xFFD4, 0xF78B,
-    0xFFAA, 0xFF89, 0xF787, 0xFF66, 0xB545, 0x2101, 0x18C1, 0x10A0,
-    0x1060, 0x0840, 0x0840, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x1080, 0x1060, 0x18C1,
-    0x20E1, 0xA4C4, 0xFF66, 0xF787, 0xFF88, 0xFFB0, 0xFFD6, 0xF7D7,
-    0xFFD8, 0xFFD9, 0xFFFA, 0xFFDB, 0xFFFD, 0xFFFE, 0xFFFE, 0xFFFE,
-    0xFFFE, 0xFFFD, 0xFFFB, 0xFFDA, 0xFFF9, 0xFFD8, 0xFFD7, 0xFFAF,
-    0xFFAA, 0xFF89, 0xFF88, 0xFF86, 0xE645, 0x2101, 0x20C1, 0x18A0,
-    0x1080, 0x0840, 0x0840, 0x0820, 0x0020, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0020, 0x0820, 0x0840, 0x1060, 0x1080, 0x20C1,
-    0x2101, 0xA4C4, 0xFF86, 0xFF87, 0xFF88, 0xFFAF, 0xFFD6, 0xFFD7,
-    0xFFD8, 0xFFD9, 0xFFDA, 0xFFFB, 0xFFFC, 0xFFFD, 0xFFFE, 0xFFFE,
-    0xFFFE, 0xFFFD, 0xFFDB, 0xFFDA, 0xFFF9, 0xFFD8, 0xFFD7, 0xFFD6,
-    0xFF8B, 0xFF89, 0xF788, 0xFF87, 0xEF25, 0x20E1, 0x18C1, 0x18A0,
-    0x1080, 0x0840, 0x0840, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0020, 0x0020, 0x0840, 0x0840, 0x1080, 0x10A0,
-    0x20E1, 0xA4A4, 0xFF87, 0xF788, 0xFF89, 0xFFAC, 0xFFD7, 0xF7D7,
-    0xFFD8, 0xFFF9, 0xFFD9, 0xFFDB, 0xFFFC, 0xFFFD, 0xFFFD, 0xFFFD,
-    0xFFFD, 0xFFFC, 0xFFDB, 0xFFFA, 0xFFD9, 0xFFD8, 0xFFD7, 0xFFF7,
-    0xFFB0, 0xFF89, 0xFF88, 0xFF87, 0xFF86, 0x3122, 0x20C1, 0x18A0,
-    0x1080, 0x0860, 0x0820, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0820, 0x0840, 0x0840, 0x1080, 0x18A0,
-    0x20C1, 0xA4C4, 0xFF87, 0xFFA7, 0xFFA8, 0xFFAA, 0xFFD6, 0xFFD7,
-    0xFFD8, 0xFFD8, 0xFFD9, 0xFFDA, 0xFFFB, 0xFFFC, 0xFFDC, 0xFFFD,
-    0xFFFC, 0xFFDB, 0xFFDA, 0xFFFA, 0xFFD9, 0xFFD8, 0xFFD7, 0xFFD7,
-    0xFFD6, 0xF78A, 0xFF88, 0xFF87, 0xF787, 0x3982, 0x18C1, 0x1880,
-    0x1080, 0x0840, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0020, 0x0840, 0x0840, 0x1080, 0x1880,
-    0x18C1, 0x7BC4, 0xF787, 0xFF88, 0xFFA8, 0xF78A, 0xFFD4, 0xFFD7,
-    0xFFD8, 0xFFF8, 0xFFD9, 0xFFFA, 0xFFDA, 0xFFFB, 0xFFDB, 0xFFFB,
-    0xFFDB, 0xFFFB, 0xFFDA, 0xFFF9, 0xFFD9, 0xFFD8, 0xFFD7, 0xFFF7,
-    0xFFD6, 0xFFCD, 0xFFA8, 0xFFA7, 0xFFA7, 0x4182, 0x18A0, 0x1080,
-    0x0840, 0x0840, 0x0020, 0x0820, 0x0020, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0820, 0x0840, 0x0840, 0x1080, 0x18A0,
-    0x20C1, 0x6B23, 0xFFA7, 0xFFA8, 0xFFA8, 0xFF8A, 0xFFB0, 0xFFF7,
-    0xF7D7, 0xFFD8, 0xFFD8, 0xFFF9, 0xFFDA, 0xFFFA, 0xFFD6, 0xFFB6,
-    0xFFDA, 0xFFFA, 0xFFD9, 0xFFF9, 0xFFD8, 0xFFD8, 0xFFD7, 0xFFF6,
-    0xFFD6, 0xFFCD, 0xFFA8, 0xF7A7, 0xFF87, 0x3182, 0x1080, 0x1080,
-    0x0840, 0x0840, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0840, 0x1060, 0x18A0,
-    0x18C1, 0x39C2, 0xF7A7, 0xFFA8, 0xFFA8, 0xFFAA, 0xF7AD, 0xFFF7,
-    0xFFD7, 0xFFF8, 0xFFD8, 0xFFF9, 0xFFD9, 0xFFD4, 0xF7B2, 0xFFB2,
-    0xFFD4, 0xFFF9, 0xFFD9, 0xFFF8, 0xFFD8, 0xFFF7, 0xFFD7, 0xFFF6,
-    0xFFD6, 0xFFCC, 0xFFA8, 0xFFA8, 0xFFC7, 0x3122, 0x18A0, 0x1080,
-    0x0840, 0x0840, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0020, 0x0820, 0x0020, 0x0840, 0x0840, 0x1080,
-    0x18A0, 0x20C1, 0xEF07, 0xFFA8, 0xFFA8, 0xFFAA, 0xFF8A, 0xFFD4,
-    0xFFD7, 0xFFF7, 0xFFD8, 0xFFF8, 0xFFD6, 0xF7B0, 0xFFB0, 0xFFB0,
-    0xFFB0, 0xF7D4, 0xFFD8, 0xFFF8, 0xFFD8, 0xFFF7, 0xFFD7, 0xFFF6,
-    0xFFD6, 0xFFAA, 0xFFA8, 0xF7A8, 0xF787, 0x18A1, 0x0860, 0x1060,
-    0x0840, 0x0840, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0840, 0x0840, 0x1060,
-    0x18A0, 0x18A1, 0x9CA4, 0xFFA8, 0xFFA8, 0xF7C9, 0xFFAA, 0xFFAD,
-    0xFFF7, 0xFFD7, 0xF7D7, 0xFFF8, 0xFFB0, 0xFFAF, 0xFFAF, 0xAD49,
-    0xF74E, 0xFFAF, 0xFFD7, 0xFFF8, 0xFFD7, 0xFFF7, 0xFFD6, 0xFFD6,
-    0xFFB0, 0xFFC9, 0xFFA8, 0xFFC8, 0xEF07, 0x18A0, 0x1080, 0x0840,
-    0x0840, 0x0020, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0820, 0x0840, 0x1060,
-    0x1080, 0x18A0, 0x49E3, 0xFFC8, 0xFFC9, 0xFFC9, 0xFFCA, 0xFFCB,
-    0xFFB4, 0xFFD7, 0xF7F7, 0xFFD4, 0xFFAD, 0xFFAD, 0xE72B, 0x6B07,
-    0xAD49, 0xFFCD, 0xFFD2, 0xFFD7, 0xFFF7, 0xFFD7, 0xFFF6, 0xFFD6,
-    0xF7CB, 0xFFC9, 0xFFA8, 0xFFA8, 0xC626, 0x1080, 0x0860, 0x0840,
-    0x0840, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0840, 0x0840,
-    0x1080, 0x1080, 0x18A1, 0xC626, 0xFFA9, 0xFFC9, 0xF7CA, 0xFFCB,
-    0xFFCD, 0xFFD7, 0xFFF7, 0xFFAD, 0xFFCD, 0xFFCD, 0xAD69, 0x7307,
-    0x6B07, 0xF78D, 0xFFAD, 0xFFF7, 0xFFD7, 0xFFF7, 0xFFD6, 0xFFB0,
-    0xFFA9, 0xFFC9, 0xFFA8, 0xFFC8, 0x9465, 0x1080, 0x0840, 0x0840,
-    0x0020, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x0020, 0x0840,
-    0x1080, 0x1060, 0x18A0, 0x62A3, 0xFFC9, 0xFFC9, 0xFFCA, 0xFFCA,
-    0xFFCB, 0xFFD2, 0xFFD4, 0xF7AC, 0xFFAC, 0xFFCC, 0x8C45, 0x6284,
-    0x6284, 0xE6CB, 0xFFCC, 0xFFD4, 0xFFD7, 0xFFD6, 0xFFF6, 0xFFCB,
-    0xF7CA, 0xFFC9, 0xFFA9, 0xF788, 0x3162, 0x0860, 0x0840, 0x0840,
-    0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0840,
-    0x0840, 0x1080, 0x10A0, 0x1080, 0xA4A4, 0xF7C9, 0xFFCA, 0xFFCA,
-    0xFFCB, 0xFFCB, 0xFFAD, 0xFFCB, 0xFFCC, 0xFFCC, 0x6284, 0x5224,
-    0x5224, 0xAD49, 0xFFCB, 0xFFB2, 0xFFF6, 0xFFD6, 0xFFCD, 0xFFCA,
-    0xFFCA, 0xFFC9, 0xFFC9, 0x83C4, 0x1080, 0x0840, 0x0840, 0x0820,
-    0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x0020,
-    0x0840, 0x0840, 0x1080, 0x18A0, 0x20C1, 0x7B84, 0xF76A, 0xFFCA,
-    0xFFCB, 0xFFCB, 0xFFCB, 0xF7CB, 0xFFCB, 0xE72B, 0x41E3, 0x49E3,
-    0x39E2, 0x9465, 0xFFCB, 0xFFCC, 0xFFB2, 0xFFCD, 0xFFCB, 0xFFCA,
-    0xFFCA, 0xFFC9, 0x9CA4, 0x0860, 0x0840, 0x0840, 0x0840, 0x0020,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,
-    0x0840, 0x0840, 0x0840, 0x1080, 0x18A0, 0x10A0, 0x3162, 0x7BC4,
-    0xDEC8, 0xFFCB, 0xFFCB, 0xFFCB, 0xFFCB, 0xB569, 0x39A2, 0x3982,
-    0x3982, 0x6303, 0xF7CB, 0xFFCB, 0xFFCB, 0xFFCB, 0xFFCA, 0xFFCA,
-    0xF76A, 0x7B84, 0x1060, 0x1080, 0x0840, 0x0840, 0x0020, 0x0820,
-    0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0820,
-    0x0020, 0x0840, 0x0840, 0x1040, 0x1080, 0x18A0, 0x18A0, 0x18C1,
-    0x20C1, 0x5262, 0xA4C4, 0xEF2B, 0xFFCB, 0x7364, 0x2922, 0x3162,
-    0x2922, 0x3962, 0xCE26, 0xFFCB, 0xFFCA, 0xFFCA, 0xEF6A, 0x9445,
-    0x20E1, 0x0880, 0x1060, 0x0840, 0x0840, 0x0020, 0x0820, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0020, 0x0840, 0x0860, 0x0840, 0x1060, 0x1080, 0x18A0,
-    0x18A0, 0x20C1, 0x18C1, 0x2901, 0x5262, 0x2922, 0x2901, 0x2101,
-    0x2901, 0x2101, 0x2101, 0x49E3, 0x62A3, 0x41E2, 0x20C1, 0x1080,
-    0x1060, 0x1080, 0x0840, 0x0840, 0x0820, 0x0020, 0x0020, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,
-    0x0000, 0x0020, 0x0820, 0x0840, 0x0840, 0x0840, 0x1080, 0x1060,
-    0x1080, 0x18A0, 0x18A0, 0x10A0, 0x20C1, 0x20C1, 0x20C1, 0x18C1,
-    0x20C1, 0x20C1, 0x20C1, 0x10A0, 0x18A0, 0x18A0, 0x1060, 0x1080,
-    0x0840, 0x0840, 0x0840, 0x0020, 0x0820, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0020, 0x0000, 0x0820, 0x0020, 0x0840, 0x0840, 0x0840,
-    0x1080, 0x1060, 0x1080, 0x18A0, 0x18A0, 0x10A0, 0x18A0, 0x18A0,
-    0x18A0, 0x10A0, 0x18A0, 0x1060, 0x1080, 0x1060, 0x1080, 0x0840,
-    0x0840, 0x0840, 0x0820, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0820, 0x0840, 0x0820,
-    0x0840, 0x0860, 0x1080, 0x1060, 0x1080, 0x1060, 0x1080, 0x1060,
-    0x1080, 0x1060, 0x1080, 0x1060, 0x0840, 0x0860, 0x0840, 0x0820,
-    0x0020, 0x0820, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x0020, 0x0020, 0x0840,
-    0x0820, 0x0840, 0x0860, 0x1040, 0x0860, 0x0840, 0x0860, 0x1040,
-    0x0860, 0x0840, 0x0860, 0x0840, 0x0820, 0x0840, 0x0840, 0x0020,
-    0x0820, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0820,
-    0x0020, 0x0820, 0x0840, 0x0840, 0x0020, 0x0840, 0x0820, 0x0840,
-    0x0020, 0x0840, 0x0820, 0x0840, 0x0020, 0x0020, 0x0820, 0x0000,
-    0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000,
-    0x0020, 0x0820, 0x0020, 0x0820, 0x0020, 0x0820, 0x0020, 0x0820,
-    0x0020, 0x0820, 0x0020, 0x0820, 0x0020, 0x0020, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0000, 0x0020,
-    0x0000, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0000,
-    0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 } };
+// Generated by frames2spans.py. Each frame is stored as the runs of pixels
+// that changed since the frame before: (y << 8) | x, length, then that
+// many big-endian RGB565 pixels. Runs frameSpans[N] up to frameSpans[N + 1]
+// turn frame N-1 into frame N (frame 0 follows the last frame), and the
+// list at frameSpans[IMG_FRAMES] draws frame 0 onto a black screen.
+const uint32_t frameSpans[IMG_FRAMES + 2] = {
+  0, 4062, 8255, 12306, 16283, 20170, 24077, 28078, 31853, 35619 };
+
+const uint16_t spans[] = {
+  0x0816, 0x0005, 0x2000, 0x2010, 0xA169, 0x0292, 0x8028, 0x0917,
+  0x0005, 0x62AA, 0xE2DA, 0xE2E2, 0xA2D2, 0x8120, 0x0A15, 0x0007,
+  0x2000, 0xA169, 0xE2E2, 0xE2DA, 0xE2DA, 0xE2DA, 0x028A, 0x0B15,
+  0x0007, 0x2008, 0xA2D2, 0xE2DA, 0xE2DA, 0xE2DA, 0xE2E2, 0xA2DA,
+  0x0C15, 0x0008, 0x2141, 0xE2E2, 0xE2DA, 0xE2DA, 0xE2DA, 0xE2E2,
+  0xE2DA, 0x4110, 0x0D15, 0x0007, 0xA161, 0xE2E2, 0xE2DA, 0xE2DA,
+  0xE2DA, 0xE2E2, 0x82AA, 0x0E15, 0x0008, 0xE289, 0xE2E2, 0xE2DA,
+  0xE2DA, 0xE2DA, 0xA2D2, 0x8118, 0x2000, 0x0F15, 0x0006, 0x82AA,
+  0xE2E2, 0xE2DA, 0xE2DA, 0xA2DA, 0x6120, 0x1015, 0x0006, 0x82AA,
+  0xE2DA, 0xE2DA, 0xE2DA, 0x4151, 0x0000, 0x1113, 0x0009, 0x0000,
+  0x0000, 0xE289, 0x23E3, 0x23E3, 0x22CB, 0x2000, 0x0000, 0x0000,
+  0x1212, 0x000D, 0x0000, 0x0000, 0x0000, 0x217A, 0x23E3, 0x23DB,
+  0xA161, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1312,
+  0x000D, 0x0000, 0x0000, 0x0000, 0xA161, 0x23E3, 0x61E3, 0xA028,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x140F, 0x0010,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE240, 0x61DB,
+  0x22C3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x1510, 0x0011, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4110,
+  0x61E3, 0x82AA, 0x2000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x160E, 0x0013, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x22CB, 0x828A, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x170E, 0x0015, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x8292, 0x217A, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x180D,
+  0x0016, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0xC169, 0x217A, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x190D,
+  0x0016, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0xA028, 0xC169, 0x0000, 0x0000, 0x0000, 0x217A,
+  0x82AA, 0x6120, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1A0D,
+  0x0017, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x4159, 0x0000, 0x0000, 0xA118, 0xC1EB,
+  0x61E3, 0x2172, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x1B0C, 0x0017, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6118, 0x0000, 0x0000,
+  0x2141, 0xC1E3, 0xC1EB, 0x02C3, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x1C0C, 0x0019, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x2000, 0x0000, 0x2000, 0x0000, 0x2000,
+  0x0000, 0x6151, 0xC1EB, 0xC1E3, 0x61E3, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x1D0C, 0x0018, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x2000, 0x0000, 0x2000, 0x0000, 0x2000,
+  0x0000, 0x2000, 0x0000, 0x0000, 0x4151, 0xC1E3, 0xC1E3, 0x61DB,
+  0x2000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1E0B, 0x001A,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2000,
+  0x0000, 0x2000, 0x0000, 0x2000, 0x0000, 0x0000, 0x2000, 0x4159,
+  0xC1EB, 0xC1E3, 0x02C3, 0x0000, 0x2000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x1F0C, 0x0018, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x2000, 0x0000, 0x2000, 0x0000, 0x2000, 0x0000, 0x2000, 0x0000,
+  0x0000, 0x0000, 0x2141, 0xC1E3, 0xC1E3, 0x8292, 0x2000, 0x0000,
+  0x2000, 0x0000, 0x2000, 0x0000, 0x200B, 0x001A, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x2000, 0x0000, 0x2000, 0x0008, 0x2008,
+  0x0000, 0x2008, 0x0000, 0x2008, 0x0000, 0x2010, 0xC1EB, 0xC1E3,
+  0x4151, 0x0000, 0x2000, 0x0000, 0x2000, 0x0000, 0x0000, 0x0000,
+  0x210C, 0x001A, 0x0000, 0x0000, 0x0000, 0x2000, 0x0008, 0x2000,
+  0x0000, 0x2000, 0x0000, 0x2008, 0x0008, 0x2008, 0x0000, 0x2008,
+  0x0000, 0x2149, 0xC169, 0x2000, 0x0008, 0x2000, 0x0000, 0x2000,
+  0x0000, 0x2000, 0x0000, 0x0000, 0x220B, 0x001B, 0x0000, 0x0000,
+  0x2000, 0x0000, 0x2000, 0x0000, 0x2008, 0x0008, 0x2008, 0x0000,
+  0x2008, 0x0008, 0x2000, 0x0008, 0x2008, 0x0008, 0x2000, 0x0008,
+  0x2008, 0x0008, 0x2000, 0x0000, 0x2000, 0x0000, 0x2000, 0x0000,
+  0x0000, 0x230C, 0x0018, 0x0000, 0x0000, 0x2000, 0x0000, 0x2000,
+  0x0008, 0x2000, 0x0008, 0x2008, 0x0008, 0x2000, 0x0008, 0x2008,
+  0x0008, 0x2000, 0x0008, 0x2008, 0x0008, 0x2008, 0x0000, 0x2008,
+  0x0000, 0x2008, 0x0000, 0x240B, 0x0019, 0x0000, 0x2000, 0x0000,
+  0x2000, 0x0000, 0x2008, 0x0008, 0x2008, 0x0008, 0x2008, 0x2008,
+  0x0000, 0x2008, 0x2008, 0x2008, 0x2008, 0x2010, 0x2008, 0x0008,
+  0x2008, 0x0008, 0x2000, 0x0000, 0x2008, 0x0000, 0x250B, 0x001C,
+  0x2000, 0x0000, 0x2000, 0x0000, 0x2000, 0x0008, 0x2008, 0x0008,
+  0x2008, 0x0008, 0x2008, 0x2008, 0x2008, 0x2010, 0x2010, 0x2010,
+  0x2008, 0x2008, 0x2008, 0x2008, 0x0000, 0x2008, 0x0008, 0x2008,
+  0x0000, 0x2000, 0x0000, 0x2000, 0x260B, 0x001C, 0x0000, 0x2000,
+  0x0000, 0x2008, 0x0008, 0x2008, 0x0000, 0x2008, 0x2008, 0x2008,
+  0x2010, 0x2010, 0x2010, 0x2010, 0xA028, 0x2010, 0x2010, 0x2010,
+  0x2010, 0x2008, 0x0008, 0x2008, 0x0008, 0x2000, 0x0008, 0x2000,
+  0x0000, 0x2000, 0x270B, 0x001D, 0x2000, 0x0000, 0x2000, 0x0008,
+  0x2008, 0x0008, 0x0008, 0x2008, 0x2010, 0x2010, 0x2010, 0x2010,
+  0x2010, 0x2010, 0x217A, 0x4118, 0x2010, 0x2010, 0x2010, 0x2010,
+  0x2008, 0x2008, 0x2000, 0x0008, 0x2008, 0x0008, 0x2000, 0x0000,
+  0x2000, 0x280A, 0x001F, 0x2000, 0x0000, 0x2000, 0x0008, 0x2008,
+  0x0008, 0x2008, 0x2008, 0x2010, 0x2010, 0x2010, 0x2010, 0x4118,
+  0x4110, 0x4118, 0x217A, 0xA169, 0x4118, 0x2010, 0x2010, 0x2010,
+  0x2010, 0x2008, 0x0008, 0x2008, 0x0000, 0x2008, 0x0000, 0x2000,
+  0x0000, 0x2000, 0x290A, 0x001E, 0x2000, 0x0000, 0x2008, 0x0000,
+  0x2008, 0x0008, 0x2008, 0x2010, 0x2010, 0x2010, 0x2010, 0x4118,
+  0x4118, 0x4110, 0x4118, 0x217A, 0x22B3, 0x4118, 0x4118, 0x4110,
+  0x2010, 0x2010, 0x2010, 0x2008, 0x0008, 0x2008, 0x0008, 0x2008,
+  0x0000, 0x2000, 0x2A0A, 0x001F, 0x2000, 0x0000, 0x2008, 0x0008,
+  0x2000, 0x2008, 0x2008, 0x2010, 0x2010, 0x4118, 0x4118, 0x4118,
+  0x4118, 0x4110, 0x4118, 0xA182, 0x61EC, 0x8128, 0x4110, 0x4118,
+  0x4118, 0x2010, 0x2010, 0x2010, 0x2008, 0x0008, 0x2008, 0x0000,
+  0x2000, 0x0000, 0x2000, 0x2B08, 0x0021, 0x2000, 0x0000, 0x2000,
+  0x0000, 0x2000, 0x0008, 0x0008, 0x2008, 0x2010, 0x2010, 0x4118,
+  0x4118, 0x4110, 0x6120, 0x6120, 0x6118, 0x6118, 0x8292, 0x81EC,
+  0xA169, 0x6120, 0x4110, 0x4118, 0x4118, 0x2010, 0x2010, 0x2008,
+  0x2008, 0x2008, 0x0008, 0x2008, 0x0000, 0x2000, 0x2C09, 0x0021,
+  0x2000, 0x0008, 0x2008, 0x0008, 0x2000, 0x2008, 0x2010, 0x2010,
+  0x4118, 0x4118, 0x4118, 0x6118, 0x6120, 0x6120, 0x6118, 0x8120,
+  0xE1A2, 0xA1EC, 0xE19A, 0x4118, 0x6118, 0x4118, 0x4118, 0x4118,
+  0x2010, 0x2010, 0x2008, 0x0008, 0x2008, 0x0000, 0x2000, 0x0000,
+  0x2000, 0x2D07, 0x0022, 0x2000, 0x0000, 0x2000, 0x0008, 0x2000,
+  0x0008, 0x2008, 0x2010, 0x2010, 0x4118, 0x4118, 0x4110, 0x6120,
+  0x6120, 0x6118, 0x6120, 0x8120, 0x6120, 0x61AB, 0xA1EC, 0x41E4,
+  0x8120, 0x6118, 0x6120, 0x4118, 0x4118, 0x4110, 0x2010, 0x2010,
+  0x2008, 0x0008, 0x2008, 0x0008, 0x2000, 0x2E08, 0x0022, 0x2000,
+  0x0000, 0x2008, 0x0008, 0x2000, 0x2008, 0x2010, 0x2010, 0x4118,
+  0x4118, 0x6120, 0x6118, 0x8120, 0x016A, 0xE238, 0xA128, 0x8128,
+  0xA2CB, 0xC1F4, 0xC1F4, 0x4151, 0x8120, 0x6118, 0x6118, 0x4118,
+  0x4118, 0x4110, 0x2010, 0x2008, 0x0008, 0x0008, 0x2008, 0x0000,
+  0x2000, 0x2F08, 0x0022, 0x2000, 0x0008, 0x2000, 0x0008, 0x2008,
+  0x2010, 0x2010, 0x4118, 0x4118, 0x6118, 0x6120, 0x6120, 0xA161,
+  0xE1F4, 0xE19A, 0x8128, 0x8120, 0x41DC, 0xC1F4, 0xC1F4, 0xE19A,
+  0x8128, 0x8120, 0x6118, 0x6120, 0x4118, 0x4118, 0x2010, 0x2008,
+  0x2008, 0x0008, 0x2000, 0x0008, 0x2000, 0x3006, 0x0025, 0x2000,
+  0x0000, 0x2000, 0x0000, 0x2008, 0x0008, 0x2008, 0x2010, 0x2010,
+  0x4118, 0x6120, 0x6118, 0x8120, 0x8128, 0x02BC, 0xC1F4, 0x21DC,
+  0xA128, 0xC130, 0xE1F4, 0xC1F4, 0xC1EC, 0x01CC, 0x8120, 0x6120,
+  0x8120, 0x6120, 0x6118, 0x4118, 0x2010, 0x2010, 0x2008, 0x0008,
+  0x0008, 0x2000, 0x0000, 0x2000, 0x3107, 0x0024, 0x2000, 0x0000,
+  0x2000, 0x0008, 0x2008, 0x2010, 0x2010, 0x4118, 0x4118, 0x6118,
+  0x6120, 0x6120, 0x2141, 0xC1EC, 0xC1F4, 0x02F5, 0x6249, 0x6249,
+  0x02F5, 0xC1F4, 0x22F5, 0xA1EC, 0xA130, 0x8128, 0x8120, 0x8128,
+  0x6118, 0x4118, 0x4118, 0x2010, 0x2010, 0x2008, 0x0008, 0x2008,
+  0x0000, 0x2000, 0x3206, 0x0025, 0x2000, 0x0000, 0x2008, 0x0000,
+  0x2008, 0x2008, 0x2010, 0x2010, 0x4118, 0x6120, 0x6118, 0x8128,
+  0x8128, 0xE19A, 0x22F5, 0x02F5, 0x02F5, 0x4272, 0x8182, 0x02F5,
+  0x02F5, 0x02F5, 0x21F5, 0x0231, 0xA128, 0xA128, 0x6120, 0x6120,
+  0x6118, 0x4118, 0x2010, 0x2010, 0x2008, 0x0008, 0x2000, 0x0008,
+  0x2000, 0x3307, 0x0025, 0x2000, 0x0000, 0x2008, 0x0008, 0x2008,
+  0x2010, 0x4118, 0x4118, 0x6118, 0x6120, 0xA128, 0xA128, 0xA3D4,
+  0x21F5, 0x01F5, 0x21F5, 0xE2BB, 0x01C4, 0x21F5, 0x21F5, 0x21F5,
+  0x21F5, 0x6251, 0xC130, 0xA130, 0x8128, 0x8120, 0x6120, 0x4110,
+  0x4118, 0x2010, 0x2008, 0x2008, 0x0008, 0x2008, 0x0000, 0x2000,
+  0x3406, 0x0025, 0x2000, 0x0008, 0x2008, 0x0008, 0x2000, 0x2008,
+  0x2010, 0x4118, 0x6120, 0x6118, 0x8128, 0x8128, 0x427A, 0x21F5,
+  0x21F5, 0x42F5, 0x42F5, 0x42F5, 0x42ED, 0x42F5, 0x42F5, 0x42F5,
+  0x21ED, 0x0162, 0xC230, 0xC130, 0xA128, 0x6120, 0x8120, 0x6120,
+  0x4110, 0x2010, 0x2010, 0x2008, 0x0008, 0x0008, 0x2000, 0x3506,
+  0x0027, 0x2000, 0x0000, 0x2000, 0x0008, 0x2008, 0x2010, 0x4118,
+  0x4118, 0x6118, 0x6120, 0xA128, 0xC230, 0xC3D4, 0x42F5, 0x42F5,
+  0x42F5, 0x42ED, 0x42F5, 0x42F5, 0x42F5, 0x42F5, 0x42F5, 0x42F5,
+  0x627A, 0xE238, 0xC130, 0xA128, 0x8128, 0x8128, 0x6118, 0x4118,
+  0x2010, 0x2010, 0x2008, 0x2008, 0x0008, 0x2000, 0x0000, 0x2000,
+  0x3605, 0x0028, 0x2000, 0x0000, 0x2008, 0x0008, 0x2008, 0x2008,
+  0x2010, 0x4118, 0x6118, 0x6120, 0x8120, 0x8128, 0x81B3, 0x42F5,
+  0x42F5, 0x42F5, 0x42F5, 0x82F5, 0x82F5, 0x62F5, 0x82ED, 0x62F5,
+  0x82F5, 0x42ED, 0x817A, 0x0239, 0xE230, 0xC130, 0x8128, 0x8120,
+  0x6120, 0x6120, 0x4110, 0x2010, 0x2008, 0x0008, 0x0008, 0x2000,
+  0x0000, 0x2000, 0x3705, 0x0027, 0x2000, 0x0000, 0x2000, 0x0008,
+  0x2008, 0x2010, 0x2010, 0x4118, 0x6118, 0x6120, 0x8128, 0x0162,
+  0x42ED, 0x42F5, 0x82F5, 0x62ED, 0x82F5, 0x62F5, 0x82F5, 0xA2F5,
+  0xA2F5, 0x62F5, 0x82F5, 0x82FD, 0x2383, 0x2239, 0xE238, 0xC130,
+  0xA128, 0x8128, 0x8128, 0x6118, 0x4118, 0x2010, 0x2010, 0x2008,
+  0x2008, 0x0008, 0x2000, 0x3806, 0x0027, 0x2000, 0x0008, 0x2008,
+  0x2008, 0x2010, 0x4118, 0x4118, 0x6120, 0x8120, 0xA128, 0xE1DC,
+  0x42F5, 0x82F5, 0x82F5, 0x62F5, 0xA2F5, 0xA2F5, 0xA2F5, 0xA2F5,
+  0xA2F5, 0xA2F5, 0xA2F5, 0xA2F5, 0x2393, 0x2241, 0x0239, 0xE230,
+  0xC130, 0xA128, 0x6120, 0x6120, 0x4110, 0x4118, 0x2010, 0x2008,
+  0x0008, 0x2008, 0x0000, 0x2000, 0x3905, 0x0028, 0x2000, 0x0000,
+  0x2008, 0x0008, 0x2008, 0x2010, 0x4110, 0x6120, 0x6118, 0x8120,
+  0x0162, 0x42F5, 0x62F5, 0x82F5, 0x82F5, 0xA2F5, 0xA2F5, 0xC3F5,
+  0xC3F5, 0xC3F5, 0xC3F5, 0xC3F5, 0xC3F5, 0xA2F5, 0x239B, 0x4249,
+  0x2239, 0xE238, 0xC130, 0xA128, 0x8128, 0x6118, 0x4118, 0x4118,
+  0x2010, 0x2008, 0x0008, 0x2008, 0x0000, 0x2000, 0x3A04, 0x002A,
+  0x2000, 0x0000, 0x2000, 0x0008, 0x2008, 0x2008, 0x2010, 0x4118,
+  0x6120, 0x8120, 0x8128, 0x819B, 0x82F5, 0x82F5, 0xA2F5, 0xA2F5,
+  0x04F6, 0xE4FD, 0xE3F5, 0xE3F5, 0xE3F5, 0xE3F5, 0xE3F5, 0xE3F5,
+  0xC3F5, 0x2393, 0x6249, 0x2241, 0x0239, 0xE238, 0xA128, 0xA128,
+  0x8120, 0x6120, 0x4118, 0x2010, 0x2008, 0x0008, 0x0008, 0x2000,
+  0x0000, 0x2000, 0x3B04, 0x0029, 0x2000, 0x0000, 0x2000, 0x0008,
+  0x2008, 0x2008, 0x2010, 0x4118, 0x6118, 0x6120, 0x8128, 0xE2B3,
+  0x82F5, 0xA2F5, 0xA2F5, 0xC3F5, 0xA7F6, 0xE8FE, 0xE4FD, 0x03F6,
+  0x03F6, 0x03F6, 0x03F6, 0xE3F5, 0xE3F5, 0x819B, 0x6251, 0x2241,
+  0x4241, 0xE238, 0xC130, 0x8128, 0x8128, 0x6118, 0x4118, 0x2010,
+  0x2010, 0x2008, 0x2008, 0x0000, 0x2000, 0x3C05, 0x0028, 0x2000,
+  0x0008, 0x2008, 0x2008, 0x2010, 0x2010, 0x4118, 0x6120, 0x8120,
+  0xA128, 0xA1CC, 0xA2FD, 0xA2F5, 0xC2F5, 0x04F6, 0x08FF, 0x29FF,
+  0x85F6, 0x23F6, 0x03F6, 0x23FE, 0x03F6, 0x03F6, 0xE3F5, 0x43AC,
+  0xA251, 0x6249, 0x2241, 0x0239, 0xC130, 0xC130, 0x8120, 0x6120,
+  0x4110, 0x2010, 0x2010, 0x2008, 0x0008, 0x0008, 0x2000, 0x3D04,
+  0x002A, 0x2000, 0x0000, 0x2000, 0x0008, 0x2008, 0x2010, 0x4118,
+  0x4118, 0x6118, 0x8128, 0xA128, 0x02DD, 0xA2F5, 0xC2F5, 0xE2F5,
+  0xA7F6, 0x08F7, 0x09FF, 0xA7FE, 0x43F6, 0x43F6, 0x43F6, 0x03FE,
+  0x23F6, 0x03F6, 0xC2E5, 0xA259, 0x6249, 0x4249, 0x2239, 0xE238,
+  0xA128, 0x8120, 0x6120, 0x4118, 0x4118, 0x2010, 0x2008, 0x0008,
+  0x2000, 0x0000, 0x2000, 0x3E05, 0x0029, 0x2000, 0x0008, 0x2008,
+  0x2008, 0x2010, 0x4118, 0x4110, 0x8128, 0x8128, 0xC130, 0x82F5,
+  0xC2F5, 0xC2F5, 0x66FE, 0x08FF, 0x09FF, 0x29F7, 0xA7F6, 0x64F6,
+  0x44FE, 0x64F6, 0x43F6, 0x44F6, 0x23FE, 0xE3F5, 0x43AC, 0xA251,
+  0x2241, 0x0239, 0xE238, 0xC128, 0xA128, 0x6120, 0x6120, 0x4110,
+  0x2010, 0x2008, 0x0008, 0x2008, 0x0000, 0x2000, 0x3F05, 0x0028,
+  0x2000, 0x0000, 0x0008, 0x2008, 0x2010, 0x4118, 0x6118, 0xA182,
+  0x2241, 0x0231, 0xC2F5, 0xE2F5, 0xE2F5, 0xE8FE, 0x29F7, 0x09FF,
+  0x29FF, 0xE8FE, 0x44F6, 0x64F6, 0x85F6, 0x08FF, 0x09FF, 0x85F6,
+  0x23F6, 0x03FE, 0xC39B, 0x6251, 0x4241, 0xE238, 0xC130, 0x8128,
+  0x8120, 0x6120, 0x4118, 0x2010, 0x2008, 0x2008, 0x0008, 0x2000,
+  0x4004, 0x002A, 0x2000, 0x0000, 0x2008, 0x0008, 0x2008, 0x2010,
+  0x4118, 0x8149, 0xC2F5, 0xA1CC, 0x2141, 0xC2F5, 0xE2F5, 0x02F6,
+  0x08FF, 0x09FF, 0x29FF, 0x09FF, 0x69FF, 0xA7F6, 0x07F7, 0x69FF,
+  0x49FF, 0x69FF, 0xE8F6, 0x43F6, 0x23F6, 0x03F6, 0xA372, 0x2241,
+  0x0239, 0xC130, 0xA128, 0x6120, 0x6120, 0x4110, 0x2010, 0x2008,
+  0x0008, 0x2008, 0x0000, 0x2000, 0x4104, 0x002A, 0x2000, 0x0000,
+  0x2008, 0x0008, 0x2008, 0x2010, 0x2110, 0x2141, 0xE1D4, 0x819B,
+  0x6141, 0xE2F5, 0x02F6, 0x02F6, 0xA7F6, 0x09FF, 0x29F7, 0x49FF,
+  0x69FF, 0x49FF, 0x69F7, 0x49FF, 0x69FF, 0x49FF, 0x69FF, 0x84F6,
+  0x43F6, 0x23FE, 0xA2E5, 0xC259, 0x0239, 0xE238, 0xA128, 0x8120,
+  0x6120, 0x4110, 0x2010, 0x2008, 0x0008, 0x2008, 0x0008, 0x2000,
+  0x4205, 0x002A, 0x2000, 0x0008, 0x2008, 0x2010, 0x2010, 0x4118,
+  0x6120, 0x8120, 0xA128, 0x6251, 0x02FE, 0x02F6, 0x02F6, 0x85F6,
+  0x29FF, 0x49FF, 0x69FF, 0x49FF, 0x69F7, 0x49FF, 0xE5FE, 0x07F7,
+  0x69FF, 0x49FF, 0xA7F6, 0x43F6, 0x23F6, 0x23F6, 0xA39B, 0x0239,
+  0xE230, 0xA130, 0x8120, 0x6120, 0x4110, 0x2010, 0x2008, 0x0008,
+  0x0008, 0x2000, 0x0000, 0x2000, 0x4305, 0x0029, 0x2000, 0x0008,
+  0x0008, 0x2010, 0x2010, 0x4110, 0x6120, 0xA128, 0xA128, 0x6141,
+  0x02F6, 0x02F6, 0x23F6, 0x43F6, 0xE8F6, 0x69FF, 0x49FF, 0x69FF,
+  0x49FF, 0x05F7, 0xC5F6, 0xE5FE, 0x69FF, 0x49F7, 0x07FF, 0x64FE,
+  0x43F6, 0x23FE, 0xC2E5, 0x4241, 0xE238, 0xA128, 0x8128, 0x6118,
+  0x4118, 0x2010, 0x2010, 0x0008, 0x2008, 0x0008, 0x2000, 0x4404,
+  0x002A, 0x2000, 0x0008, 0x2008, 0x0008, 0x2010, 0x2010, 0x4110,
+  0x6120, 0xA128, 0xC130, 0x0239, 0x22FE, 0x23F6, 0x23FE, 0x43F6,
+  0x85F6, 0x49FF, 0x69FF, 0x49FF, 0x48FF, 0x05F7, 0x05F7, 0xE5FE,
+  0x49FF, 0x69FF, 0xE8F6, 0x64F6, 0x43F6, 0x23F6, 0x03FE, 0x0162,
+  0xC230, 0xA128, 0x8120, 0x6120, 0x4110, 0x2010, 0x2010, 0x0008,
+  0x2008, 0x0000, 0x2000, 0x4505, 0x002A, 0x2000, 0x0008, 0x0008,
+  0x2008, 0x2010, 0x4118, 0x6118, 0xA128, 0xC130, 0xC230, 0xA2E5,
+  0x22F6, 0x43F6, 0x44F6, 0x64F6, 0x27F7, 0x49FF, 0x69FF, 0x47FF,
+  0x05F7, 0x05FF, 0x05F7, 0x49FF, 0x69FF, 0xE8F6, 0x83FE, 0x64F6,
+  0x43F6, 0x42FE, 0x8272, 0xE238, 0xA128, 0x8128, 0x6118, 0x4118,
+  0x2010, 0x2010, 0x2008, 0x0008, 0x2008, 0x0000, 0x2000, 0x4604,
+  0x002B, 0x2000, 0x0008, 0x2008, 0x2008, 0x2010, 0x4118, 0x4118,
+  0x6118, 0xA128, 0xC130, 0xE238, 0x43B4, 0x43FE, 0x43F6, 0x64F6,
+  0x84FE, 0xA4F6, 0x47FF, 0x89FF, 0x47FF, 0x45F7, 0x45FF, 0x05F7,
+  0x49FF, 0x49FF, 0x27FF, 0x84F6, 0x64F6, 0x43F6, 0x43F6, 0x0362,
+  0xC230, 0xC130, 0x8120, 0x6120, 0x4110, 0x2010, 0x2010, 0x0008,
+  0x0008, 0x2000, 0x0000, 0x2000, 0x4703, 0x002B, 0x2000, 0x0000,
+  0x2000, 0x0008, 0x2008, 0x2010, 0x4118, 0x4118, 0x6118, 0x8128,
+  0xC130, 0xE230, 0x0362, 0x22F6, 0x43F6, 0x64F6, 0x84F6, 0xA4FE,
+  0xC4F6, 0x48FF, 0x48F7, 0x25FF, 0x45FF, 0x26F7, 0x49FF, 0x48FF,
+  0xA4F6, 0x84FE, 0x64F6, 0x43FE, 0x22E6, 0x2241, 0xE238, 0xC130,
+  0xA128, 0x6120, 0x4110, 0x4118, 0x2010, 0x2010, 0x2008, 0x0000,
+  0x2000, 0x4804, 0x002B, 0x2000, 0x0008, 0x2008, 0x2008, 0x2010,
+  0x4118, 0x4118, 0x6120, 0xA128, 0xC130, 0xE230, 0x2249, 0xC2C4,
+  0x63F6, 0x83F6, 0x84F6, 0xA4FE, 0xE5F6, 0x05FF, 0x47FF, 0x45F7,
+  0x25FF, 0x47FF, 0x48FF, 0xE5F6, 0xA4F6, 0x84F6, 0x63FE, 0x64F6,
+  0x23AC, 0x2241, 0xE230, 0xC130, 0x6120, 0x6120, 0x4110, 0x4118,
+  0x2010, 0x2008, 0x0008, 0x2000, 0x0000, 0x2000, 0x4904, 0x002A,
+  0x2000, 0x0008, 0x0008, 0x2008, 0x2010, 0x4118, 0x4110, 0x6120,
+  0xA128, 0xC130, 0xC230, 0x2241, 0x0162, 0x43EE, 0x63F6, 0x84F6,
+  0xC4FE, 0xE5F6, 0x05FF, 0x25F7, 0x45FF, 0x25FF, 0x45FF, 0x05F7,
+  0xE5FE, 0xC4F6, 0x84FE, 0x83F6, 0x43F6, 0xA259, 0x4241, 0xE238,
+  0xC130, 0xA128, 0x6120, 0x4110, 0x2010, 0x2010, 0x0008, 0x2008,
+  0x0008, 0x2000, 0x4A05, 0x002A, 0x0008, 0x2008, 0x2008, 0x2008,
+  0x4118, 0x4110, 0x6120, 0xA128, 0xC130, 0xE238, 0x2241, 0x6251,
+  0x2383, 0x83F6, 0xA4FE, 0xC4F6, 0xE5FE, 0x05F7, 0x45FF, 0x25FF,
+  0x45FF, 0x25F7, 0x05FF, 0xE5F6, 0xA4F6, 0xA4FE, 0x63EE, 0x0383,
+  0x6249, 0x0239, 0xE230, 0xA130, 0xA128, 0x6118, 0x4118, 0x2010,
+  0x2010, 0x0008, 0x0008, 0x2000, 0x0000, 0x2000, 0x4B04, 0x002A,
+  0x2000, 0x0000, 0x0008, 0x2008, 0x2010, 0x4118, 0x4118, 0x6118,
+  0xA128, 0xC130, 0xE238, 0x2241, 0x6249, 0xA251, 0x23AC, 0xA4FE,
+  0xC4F6, 0xE5FE, 0x05F7, 0x25FF, 0x45F7, 0x25FF, 0x05FF, 0x05F7,
+  0xE5FE, 0xC4FE, 0xC4FE, 0xC39B, 0xC251, 0x6251, 0x2239, 0xE238,
+  0xA130, 0x8120, 0x6120, 0x4110, 0x2010, 0x2010, 0x0008, 0x2008,
+  0x0008, 0x2000, 0x4C04, 0x002A, 0x0000, 0x2008, 0x0008, 0x2008,
+  0x2010, 0x2010, 0x4110, 0x6120, 0xA128, 0xC130, 0x8149, 0x2241,
+  0x6251, 0xC251, 0x8272, 0xC3FE, 0xE4FE, 0x04FF, 0x05F7, 0x06FF,
+  0x26F7, 0x25FF, 0x05F7, 0x04FF, 0xC5F6, 0xC4FE, 0x43CD, 0x2362,
+  0xA251, 0x6249, 0x0239, 0xE238, 0xA128, 0x8120, 0x6120, 0x4110,
+  0x2010, 0x2010, 0x0008, 0x2008, 0x0000, 0x2000, 0x4D04, 0x002B,
+  0x0000, 0x2000, 0x0000, 0x0008, 0x2010, 0x2010, 0x4118, 0x6120,
+  0x8120, 0xC230, 0x22E6, 0x2241, 0x6249, 0xA251, 0xA372, 0xC3FE,
+  0xC4F6, 0x04FF, 0x05F7, 0x05FF, 0x4CF7, 0x06FF, 0x05F7, 0x04FF,
+  0xE5FE, 0xE4FE, 0xC39B, 0x2362, 0xC259, 0x6251, 0x0239, 0xE238,
+  0xA128, 0x8120, 0x6120, 0x4118, 0x2010, 0x2008, 0x2008, 0x0008,
+  0x2008, 0x0000, 0x2000, 0x4E04, 0x002B, 0x2000, 0x0000, 0x2008,
+  0x0008, 0x2010, 0x2010, 0x4118, 0x6120, 0x8120, 0x2162, 0x82FE,
+  0x0162, 0x6249, 0x2362, 0xC2E5, 0xC3FE, 0x04FF, 0x04FF, 0x05F7,
+  0x05F7, 0xB0FF, 0x4AFF, 0x05F7, 0x04FF, 0xE4FE, 0xC4F6, 0x0383,
+  0x2362, 0xA251, 0x2241, 0x0239, 0xE230, 0xC130, 0x8120, 0x6120,
+  0x4110, 0x2010, 0x2008, 0x0008, 0x0008, 0x2000, 0x0000, 0x2000,
+  0x4F04, 0x0029, 0x2000, 0x0000, 0x2008, 0x0008, 0x2008, 0x2010,
+  0x4110, 0x6118, 0x6120, 0x218B, 0x82F6, 0x838B, 0xA372, 0x63F6,
+  0xC3FE, 0xC4F6, 0x04F7, 0x04FF, 0x05FF, 0x05F7, 0x4CF7, 0x94FF,
+  0x48FF, 0x05FF, 0x04FF, 0xE4FE, 0x838B, 0xA251, 0xC259, 0x4249,
+  0x0239, 0xC130, 0x8128, 0x8120, 0x6120, 0x4110, 0x2010, 0x2008,
+  0x2008, 0x0008, 0x2008, 0x5004, 0x0029, 0x0000, 0x2000, 0x0008,
+  0x2008, 0x2008, 0x2010, 0x4118, 0x6120, 0x8120, 0xC2C4, 0x82F6,
+  0x63CD, 0x02E6, 0xC3F6, 0xC3FE, 0xC4F6, 0xC4FE, 0x04FF, 0x05F7,
+  0x05F7, 0x4CFF, 0x94FF, 0x53FF, 0x05F7, 0xE4FE, 0xC4F6, 0x03B5,
+  0xA251, 0x8349, 0x2241, 0x0239, 0xC130, 0xA128, 0x8120, 0x6120,
+  0x4110, 0x2010, 0x2008, 0x0008, 0x0008, 0x2000, 0x5104, 0x002A,
+  0x0000, 0x2000, 0x0000, 0x0008, 0x2008, 0x2010, 0x4118, 0x6118,
+  0x6120, 0x02DE, 0xA2F6, 0xA2FE, 0xC3F6, 0xC3FE, 0xC4F6, 0x04F7,
+  0x04FF, 0x05FF, 0x05F7, 0x05F7, 0x4CFF, 0x94FF, 0x94FF, 0x4CF7,
+  0x04FF, 0x04FF, 0xE4FE, 0xC37A, 0x8349, 0x4241, 0x0239, 0xC130,
+  0xA128, 0x8120, 0x6120, 0x4118, 0x2010, 0x2008, 0x0008, 0x2008,
+  0x0000, 0x2000, 0x5204, 0x0029, 0x2000, 0x0000, 0x2008, 0x0008,
+  0x2008, 0x2010, 0x4110, 0x6120, 0x4241, 0xC2FE, 0xC2FE, 0xC3FE,
+  0xC3F6, 0xC4FE, 0x04F7, 0x04FF, 0x05F7, 0x05FF, 0x05F7, 0x06FF,
+  0x4CFF, 0x94FF, 0xB4F7, 0x94FF, 0x26F7, 0x04FF, 0xE4F6, 0x03D6,
+  0xA251, 0x2241, 0x0239, 0xC130, 0x8128, 0x8120, 0x6120, 0x4110,
+  0x2010, 0x2008, 0x0008, 0x0008, 0x2000, 0x5307, 0x0027, 0x0008,
+  0x2008, 0x2010, 0x4110, 0x4118, 0x826A, 0xA2F6, 0xA2FE, 0xC3F6,
+  0xC3F6, 0x04FF, 0xE4FE, 0x05F7, 0x05FF, 0x05F7, 0x26F7, 0x06FF,
+  0x4EF7, 0xB4FF, 0x94FF, 0x94FF, 0x4EF7, 0xE4FE, 0x04F7, 0x04FF,
+  0x63D5, 0xC259, 0x0239, 0xE238, 0xA128, 0x8120, 0x6120, 0x2010,
+  0x2010, 0x2008, 0x0008, 0x2000, 0x0000, 0x2000, 0x5408, 0x0025,
+  0x2010, 0x2010, 0x4118, 0x8120, 0x63AC, 0xC2FE, 0xC3FE, 0xC3F6,
+  0x04FF, 0x04FF, 0xE4F6, 0x05F7, 0x26FF, 0x06FF, 0x26F7, 0x06FF,
+  0xB0FF, 0x94F7, 0xB4FF, 0x94FF, 0xB4FF, 0x26F7, 0xE4F6, 0x04FF,
+  0xE4F6, 0x03D6, 0xA251, 0xC230, 0x8128, 0x8120, 0x6120, 0x4110,
+  0x2010, 0x2008, 0x0008, 0x0008, 0x2000, 0x5506, 0x0028, 0x0000,
+  0x0008, 0x2010, 0x4118, 0x6118, 0x6118, 0x02DE, 0xC3FE, 0x04F7,
+  0xE4FE, 0x04F7, 0xE4FE, 0x05F7, 0x26FF, 0x06F7, 0x26FF, 0x26F7,
+  0x47FF, 0x94F7, 0xB4FF, 0x94FF, 0xB4FF, 0x94FF, 0x4AFF, 0x05F7,
+  0x04F7, 0x04FF, 0x04FF, 0x22E6, 0xC159, 0xA130, 0xA118, 0x6120,
+  0x4118, 0x2010, 0x2008, 0x0008, 0x2000, 0x0000, 0x2000, 0x5606,
+  0x0027, 0x2008, 0x2008, 0x2010, 0x8010, 0x8120, 0x8149, 0xE3FE,
+  0x23FF, 0x04FF, 0xE4F6, 0x04FF, 0x05F7, 0x06FF, 0x26F7, 0x46FF,
+  0x46FF, 0x47F7, 0xAFFF, 0x95FF, 0x95FF, 0xB5FF, 0x95F7, 0xB5FF,
+  0x8DFF, 0x05F7, 0x05F7, 0x04FF, 0xE4FE, 0x03F7, 0x02DE, 0xC128,
+  0x8118, 0x6118, 0x4118, 0x2010, 0x2008, 0x2008, 0x0000, 0x2000,
+  0x5709, 0x0024, 0x6008, 0x8118, 0x0383, 0x23FF, 0x03F7, 0xE4F6,
+  0x04FF, 0x05F7, 0x06FF, 0x26F7, 0x46FF, 0x47FF, 0x6AF7, 0xB0FF,
+  0x95FF, 0xB5FF, 0x95F7, 0xB5FF, 0x95FF, 0x95FF, 0xB0FF, 0x26F7,
+  0x25FF, 0x04F7, 0x04FF, 0x23FF, 0x23FF, 0x2383, 0x8120, 0x6120,
+  0x4118, 0x2010, 0x2008, 0x2008, 0x0000, 0x2000, 0x5808, 0x0024,
+  0x4118, 0xA018, 0x8118, 0x23BD, 0x23FF, 0x23FF, 0x03FF, 0x45FF,
+  0x45F7, 0x46FF, 0x4AFF, 0xB0FF, 0x95FF, 0xB5F7, 0x95FF, 0xB5FF,
+  0x95FF, 0xB5F7, 0x95FF, 0xB5FF, 0x95FF, 0xB0F7, 0x46FF, 0x26F7,
+  0x45FF, 0x44FF, 0x03F7, 0x03F7, 0x63CD, 0xA118, 0x8120, 0x4110,
+  0x2010, 0x2008, 0x0008, 0x2000, 0x5905, 0x0028, 0x2008, 0x2000,
+  0x4008, 0x8010, 0x8010, 0xC118, 0x83E6, 0x23F7, 0x03F7, 0x25F7,
+  0x45FF, 0x47FF, 0xB0F7, 0x95FF, 0xD5FF, 0x96FF, 0xB6FF, 0x96FF,
+  0xB6FF, 0x96FF, 0xB6FF, 0xB5FF, 0xB6FF, 0x95FF, 0xB0FF, 0x46FF,
+  0x46F7, 0x45FF, 0x44FF, 0x44F7, 0x23FF, 0x03F7, 0xE128, 0x8120,
+  0x4118, 0x2010, 0x2008, 0x2008, 0x0000, 0x2000, 0x5A04, 0x0029,
+  0x2000, 0x2000, 0x4008, 0x4008, 0x8010, 0x8120, 0x8239, 0x23FF,
+  0x23FF, 0x44FF, 0x45FF, 0x46FF, 0xB0FF, 0xB5FF, 0xD5FF, 0xB5FF,
+  0xD6FF, 0xB6FF, 0xD6FF, 0xB6FF, 0xD6FF, 0xB6FF, 0xD6FF, 0xB6FF,
+  0xD5FF, 0xB0FF, 0x47F7, 0x46FF, 0x46FF, 0x25F7, 0x44FF, 0x03F7,
+  0x23FF, 0xC239, 0x8118, 0x8010, 0x4008, 0x2008, 0x2000, 0x0000,
+  0x2000, 0x5B04, 0x0027, 0x2008, 0x2000, 0x2008, 0x8010, 0x8010,
+  0xC120, 0x0363, 0x03F7, 0x44F7, 0x44FF, 0x45F7, 0xB0FF, 0xB4FF,
+  0xD5FF, 0x96FF, 0xD6FF, 0xB6FF, 0xD7FF, 0xB7FF, 0xD7FF, 0xB7FF,
+  0xD7FF, 0xB7FF, 0xD6FF, 0xD6FF, 0xB0FF, 0x48FF, 0x47F7, 0x46FF,
+  0x45FF, 0x44F7, 0x44FF, 0x23FF, 0xA362, 0xA120, 0xA018, 0x4008,
+  0x4008, 0x2008, 0x5C05, 0x0027, 0x2008, 0x6008, 0x8010, 0xA018,
+  0xC120, 0x439C, 0x44FF, 0x44FF, 0x45FF, 0x4AF7, 0xD5FF, 0xD5FF,
+  0xB6FF, 0xD6FF, 0xB7FF, 0xD7FF, 0xD7FF, 0xD7FF, 0xD8FF, 0xD8FF,
+  0xD8FF, 0xB7FF, 0xD7FF, 0xB6FF, 0xB0FF, 0x89FF, 0x48F7, 0x47FF,
+  0x46FF, 0x45F7, 0x44FF, 0x44F7, 0x6473, 0xA118, 0xA018, 0x6010,
+  0x4000, 0x2000, 0x2008, 0x5D05, 0x0027, 0x4008, 0x4008, 0x6010,
+  0xA018, 0xA118, 0xA5BD, 0x44FF, 0x44F7, 0x65FF, 0xB0FF, 0xD5FF,
+  0xB5FF, 0xD6FF, 0xD7FF, 0xD7F7, 0xD8FF, 0xD8FF, 0xD8FF, 0xF8FF,
+  0xD8FF, 0xD8FF, 0xD8FF, 0xD7FF, 0xD7FF, 0xAFFF, 0x89FF, 0x88FF,
+  0x88F7, 0x86FF, 0x65FF, 0x44FF, 0x44FF, 0x439C, 0xC120, 0xA018,
+  0x8010, 0x4008, 0x2008, 0x2000, 0x5E02, 0x0003, 0x2000, 0x0000,
+  0x2000, 0x5E0A, 0x0022, 0xA3EE, 0x44FF, 0x45FF, 0x66F7, 0xD4FF,
+  0xD5FF, 0xB6FF, 0xD6FF, 0xD7F7, 0xD8FF, 0xD8FF, 0xD8FF, 0xD9FF,
+  0xD9FF, 0xF9FF, 0xD9FF, 0xD8FF, 0xD8FF, 0xD7FF, 0x8DFF, 0xAAFF,
+  0x89F7, 0x88FF, 0x66FF, 0x65F7, 0x65FF, 0x44FF, 0xC49C, 0xA118,
+  0xA018, 0x6010, 0x4008, 0x4008, 0x2000, 0x5F02, 0x002B, 0x0000,
+  0x2000, 0x2008, 0x4000, 0x6010, 0x6010, 0xC118, 0x2229, 0x44FF,
+  0x44F7, 0x65FF, 0x8BF7, 0xB5FF, 0xD6FF, 0xB6FF, 0xD7FF, 0xD8FF,
+  0xD8FF, 0xF9FF, 0xDAFF, 0xFAFF, 0xDAFF, 0xFAFF, 0xDAFF, 0xB6FF,
+  0xD4FF, 0xB0FF, 0x8DFF, 0x8CF7, 0xAAFF, 0x89FF, 0x88FF, 0x66FF,
+  0x85FF, 0x44FF, 0xC5C5, 0xC120, 0x8120, 0x8010, 0x4008, 0x4008,
+  0x2000, 0x2000, 0x6002, 0x002A, 0x2000, 0x2008, 0x2000, 0x4008,
+  0x8010, 0xA018, 0xC120, 0xE241, 0x64FF, 0x65FF, 0x86FF, 0x8DFF,
+  0xD5FF, 0xB6FF, 0xD7FF, 0xD7FF, 0xD8FF, 0xD9FF, 0xFAFF, 0xDBFF,
+  0xFBFF, 0xDBFF, 0xFBFF, 0xDBFF, 0xD6FF, 0xB2FF, 0xB0FF, 0xAFFF,
+  0x8CF7, 0xABFF, 0x89FF, 0x88F7, 0x66FF, 0x86FF, 0x65FF, 0x03D6,
+  0xE120, 0x8010, 0x8008, 0x4008, 0x4008, 0x2000, 0x6104, 0x0028,
+  0x2008, 0x4008, 0x8010, 0x8010, 0xC120, 0x624A, 0x65F7, 0x65FF,
+  0x66FF, 0xB0F7, 0xB6FF, 0xD6FF, 0xD7FF, 0xD8FF, 0xD9FF, 0xFAFF,
+  0xDBFF, 0xDCFF, 0xFCFF, 0xFDFF, 0xFDFF, 0xFCFF, 0xD7FF, 0xB2FF,
+  0xB0FF, 0xAFFF, 0x8DF7, 0xABFF, 0x8AFF, 0x89FF, 0x87F7, 0x86FF,
+  0x65FF, 0xC5EE, 0x0129, 0xA018, 0x8010, 0x4008, 0x4008, 0x2008,
+  0x6203, 0x0001, 0x2008, 0x6209, 0x0024, 0xA362, 0x85FF, 0x66FF,
+  0x87FF, 0xB0FF, 0xD6FF, 0xD7FF, 0xD7FF, 0xD8FF, 0xD9FF, 0xFAFF,
+  0xDBFF, 0xFCFF, 0xFDFF, 0xFEFF, 0xFEFF, 0xFDFF, 0xD9FF, 0xD4F7,
+  0xB2FF, 0xB0FF, 0xCDFF, 0x8CF7, 0x8AFF, 0x89FF, 0x88F7, 0x86FF,
+  0x65FF, 0x45F7, 0xE120, 0x8010, 0x8008, 0x4008, 0x4008, 0x2000,
+  0x2008, 0x6306, 0x0027, 0x6010, 0xA018, 0xC118, 0x0363, 0x65FF,
+  0x66FF, 0x87F7, 0xB0FF, 0xB6FF, 0xD7FF, 0xD7FF, 0xF8FF, 0xD9FF,
+  0xDAFF, 0xFCFF, 0xFDFF, 0xFEFF, 0xFEFF, 0xFEFF, 0xFDFF, 0xDBFF,
+  0xD5FF, 0xD2F7, 0xB0FF, 0xAFFF, 0x8CFF, 0x8BFF, 0x89FF, 0x88FF,
+  0x86FF, 0x66FF, 0x85FF, 0x6239, 0xC120, 0x8010, 0x4008, 0x4008,
+  0x2000, 0x0000, 0x6402, 0x0029, 0x2000, 0x2000, 0x4008, 0x4008,
+  0x8010, 0xA018, 0xC120, 0x236B, 0x86FF, 0x66FF, 0x88FF, 0xB0FF,
+  0xD6FF, 0xD7FF, 0xD7FF, 0xD8FF, 0xD9FF, 0xFBFF, 0xFCFF, 0xFDFF,
+  0xFEFF, 0xFEFF, 0xFEFF, 0xFDFF, 0xDCFF, 0xD5FF, 0xB2FF, 0xB0FF,
+  0xAFFF, 0x8CF7, 0x8BFF, 0x89FF, 0x88F7, 0x87FF, 0x86FF, 0x65FF,
+  0xC239, 0xC118, 0x6010, 0x4008, 0x4008, 0x6507, 0x0025, 0xA018,
+  0xA118, 0xA35A, 0x66FF, 0x87F7, 0x88FF, 0xAFFF, 0xD6FF, 0xD7FF,
+  0xD7F7, 0xD8FF, 0xF9FF, 0xDAFF, 0xDBFF, 0xFDFF, 0xFEFF, 0xFEFF,
+  0xFEFF, 0xFDFF, 0xFCFF, 0xD7FF, 0xB2FF, 0xB0FF, 0xAFFF, 0x8CFF,
+  0xABFF, 0x8AFF, 0x88FF, 0x87FF, 0x86FF, 0x86FF, 0x6252, 0xA018,
+  0x8010, 0x4008, 0x4008, 0x2000, 0x6608, 0x001F, 0xC120, 0x6252,
+  0x86FF, 0x87FF, 0x88FF, 0xAFFF, 0xD6FF, 0xD7FF, 0xD7FF, 0xD8FF,
+  0xD9FF, 0xFAFF, 0xDBFF, 0xFCFF, 0xFDFF, 0xFDFF, 0xFDFF, 0xFCFF,
+  0xDBFF, 0xD9FF, 0xD2FF, 0xB0FF, 0xAFFF, 0x8CFF, 0x8BFF, 0xAAF7,
+  0x88FF, 0x87FF, 0x66F7, 0x86FF, 0x424A, 0x6704, 0x0023, 0x4008,
+  0x4008, 0x8010, 0xA018, 0xC118, 0xC239, 0x66FF, 0x87FF, 0x88F7,
+  0xACFF, 0xD6FF, 0xD7FF, 0xD7FF, 0xD8FF, 0xF9FF, 0xDAFF, 0xFAFF,
+  0xDBFF, 0xDCFF, 0xFCFF, 0xFCFF, 0xDBFF, 0xFBFF, 0xDAFF, 0xD4F7,
+  0xAFFF, 0xADFF, 0xCCFF, 0x8BFF, 0xAAFF, 0x88FF, 0x87FF, 0x87FF,
+  0x86FF, 0x6252, 0x6802, 0x0027, 0x0000, 0x2000, 0x2008, 0x4008,
+  0x8010, 0x6010, 0xC120, 0x0121, 0x67F7, 0x87FF, 0xA8FF, 0xAAFF,
+  0xD6FF, 0xB7FF, 0xD7FF, 0xD8FF, 0xD8FF, 0xD9FF, 0xFAFF, 0xDAFF,
+  0xFBFF, 0xDBFF, 0xFBFF, 0xDAFF, 0xFAFF, 0xD9FF, 0xD7FF, 0xAFF7,
+  0xCDFF, 0xACFF, 0xABFF, 0x8AF7, 0xA8FF, 0x88FF, 0x87F7, 0x86FF,
+  0xC239, 0xA010, 0x6010, 0x6903, 0x002A, 0x0000, 0x2000, 0x4008,
+  0x4008, 0x6010, 0xA010, 0xA118, 0x06C6, 0x87FF, 0xA8FF, 0xA8F7,
+  0xD4FF, 0xF6FF, 0xD7FF, 0xD7FF, 0xD8FF, 0xF9FF, 0xD9FF, 0xF9FF,
+  0xDAFF, 0xFAFF, 0xDAFF, 0xFAFF, 0xD9FF, 0xF9FF, 0xD8FF, 0xAFF7,
+  0xCDFF, 0xACFF, 0x8AFF, 0xC9FF, 0xA8FF, 0xA7FF, 0x87FF, 0xA7FF,
+  0x2231, 0xA010, 0x8010, 0x2008, 0x4008, 0x2008, 0x2000, 0x6A03,
+  0x0029, 0x0000, 0x2008, 0x4008, 0x4008, 0x8010, 0xA018, 0xC120,
+  0x6594, 0xA7FF, 0xA8FF, 0xA8FF, 0xB0FF, 0xD6FF, 0xF7FF, 0xD7FF,
+  0xD8FF, 0xD8FF, 0xD8FF, 0xF9FF, 0xD9FF, 0xF9FF, 0xD9FF, 0xF9FF,
+  0xD9FF, 0xF8FF, 0xD8FF, 0xB2F7, 0xCCFF, 0x8BFF, 0xAAFF, 0xC9F7,
+  0xA8FF, 0xA7FF, 0x87F7, 0xE7E6, 0x8010, 0x6010, 0x4008, 0x4008,
+  0x2000, 0x0000, 0x6B03, 0x0023, 0x0000, 0x2000, 0x4008, 0x4008,
+  0x6010, 0xA018, 0xC118, 0x424A, 0x87FF, 0xA8F7, 0xA8FF, 0xAFFF,
+  0xF6FF, 0xD7FF, 0xF7F7, 0xD7FF, 0xD8FF, 0xD8FF, 0xF8FF, 0xD8FF,
+  0xF8FF, 0xD9FF, 0xF8FF, 0xD8FF, 0xF8FF, 0xD7FF, 0xD2FF, 0xACFF,
+  0xCBFF, 0xAAFF, 0x89FF, 0xA8FF, 0xA7FF, 0x87FF, 0x65B5, 0x6B2B,
+  0x0002, 0x2000, 0x0000, 0x6C03, 0x0025, 0x0000, 0x2000, 0x2008,
+  0x4008, 0x4008, 0x8010, 0xA018, 0xC120, 0xE6E6, 0xA8FF, 0xA8FF,
+  0xAAFF, 0xD6FF, 0xF6FF, 0xD6FF, 0xF7FF, 0xD7FF, 0xF8FF, 0xD8FF,
+  0xF8FF, 0xD8FF, 0xF8FF, 0xD8FF, 0xF8FF, 0xD7FF, 0xF7FF, 0xD4FF,
+  0xCBF7, 0x8AFF, 0xC9FF, 0xA8FF, 0xA8F7, 0xA8FF, 0x87FF, 0x0363,
+  0x8010, 0x6010, 0x6D03, 0x0029, 0x0000, 0x2000, 0x2000, 0x4008,
+  0x4008, 0x6010, 0xA018, 0xA118, 0x458C, 0xA8F7, 0xA8FF, 0xC9FF,
+  0xD2FF, 0xD6FF, 0xF6FF, 0xD7F7, 0xF7FF, 0xD7FF, 0xD7FF, 0xD5FF,
+  0xB0FF, 0xF7FF, 0xD7FF, 0xF7F7, 0xD7FF, 0xD7FF, 0xD5FF, 0x8AFF,
+  0xCAF7, 0xC9FF, 0xA8FF, 0xA8FF, 0xC7FF, 0x47F7, 0xC120, 0x8010,
+  0x4008, 0x4008, 0x2008, 0x2000, 0x2000, 0x6E02, 0x0029, 0x0000,
+  0x0000, 0x0000, 0x2008, 0x4008, 0x4008, 0x4008, 0x8010, 0xA018,
+  0x6231, 0x68F7, 0xA8FF, 0xC9FF, 0xADFF, 0xF6FF, 0xD6FF, 0xF6FF,
+  0xD6FF, 0xF7FF, 0xD6FF, 0xCDFF, 0xADFF, 0xB0FF, 0xF7F7, 0xD7FF,
+  0xF7FF, 0xD6FF, 0xD4FF, 0xCAF7, 0xC9FF, 0xA9FF, 0xA8FF, 0xA8F7,
+  0xA8FF, 0xA49C, 0x8010, 0x8010, 0x4008, 0x4008, 0x2000, 0x0000,
+  0x6F05, 0x0026, 0x0000, 0x2000, 0x4008, 0x4008, 0x6010, 0xA018,
+  0x8010, 0x458C, 0xA8F7, 0xC9FF, 0xA9FF, 0xD4FF, 0xF6FF, 0xD6FF,
+  0xF6FF, 0xD6FF, 0xAFFF, 0xACFF, 0x26C6, 0xCBDE, 0xF6FF, 0xD7F7,
+  0xF6FF, 0xD6FF, 0xB2FF, 0xCAFF, 0xC9FF, 0xC9FF, 0xA8FF, 0xA8FF,
+  0x68F7, 0x2231, 0x8010, 0x4008, 0x4008, 0x2000, 0x2008, 0x2000,
+  0x7003, 0x0027, 0x0000, 0x0000, 0x0000, 0x2000, 0x2008, 0x4008,
+  0x4008, 0x8010, 0xA018, 0x0129, 0x68D6, 0xC9FF, 0xC9FF, 0xADFF,
+  0xF6FF, 0xD6FF, 0xF6FF, 0xD6FF, 0xCCFF, 0x4AEF, 0x2452, 0x6594,
+  0xB0FF, 0xD6FF, 0xF6FF, 0xD6FF, 0xAFFF, 0xC9FF, 0xC9F7, 0xA9FF,
+  0xC9FF, 0xA8FF, 0xC47B, 0x6008, 0x4008, 0x4008, 0x4008, 0x2000,
+  0x0000, 0x7105, 0x0025, 0x0000, 0x0000, 0x2000, 0x4008, 0x6008,
+  0x4008, 0x6010, 0xA010, 0xC239, 0x08E7, 0xC9FF, 0xC9FF, 0xB2FF,
+  0xF6FF, 0xD6FF, 0xD4FF, 0xCBFF, 0x69AD, 0xE239, 0x0363, 0xCBFF,
+  0xB2FF, 0xF6FF, 0xB2FF, 0xCAFF, 0xA9FF, 0xC9FF, 0xC9FF, 0xC9FF,
+  0x65B5, 0xA018, 0x8010, 0x4008, 0x4008, 0x2008, 0x2000, 0x0000,
+  0x7205, 0x0024, 0x0000, 0x0000, 0x2008, 0x2000, 0x4008, 0x4008,
+  0x8010, 0x8010, 0xA018, 0x6252, 0xA8FF, 0xC9FF, 0xC9FF, 0xB0FF,
+  0xB4FF, 0xACFF, 0xCAFF, 0xC47B, 0x6231, 0x8239, 0xAAFF, 0xEAFF,
+  0xCBFF, 0xCAFF, 0xC9FF, 0xA9FF, 0xC9FF, 0xA9F7, 0x45B5, 0x8010,
+  0x8008, 0x4008, 0x4008, 0x2000, 0x2008, 0x0000, 0x7305, 0x0025,
+  0x0000, 0x0000, 0x0000, 0x2008, 0x2000, 0x4008, 0x4008, 0x6010,
+  0x8010, 0x8010, 0x835A, 0x68EF, 0xCAFF, 0xCAFF, 0xCAFF, 0xCAFF,
+  0xEAFF, 0x6252, 0x2229, 0x0229, 0xC8DE, 0xCAF7, 0xCAFF, 0xCAFF,
+  0xCAFF, 0xC9FF, 0xA9FF, 0x6594, 0xA018, 0x8010, 0x4008, 0x2008,
+  0x4008, 0x2000, 0x2000, 0x0000, 0x0000, 0x7406, 0x0022, 0x0000,
+  0x2000, 0x0000, 0x2000, 0x2008, 0x4008, 0x4008, 0x8010, 0x8010,
+  0xA018, 0x6252, 0xA9FF, 0xCAFF, 0xCAFF, 0xCAFF, 0xA9F7, 0xE120,
+  0x0121, 0x0121, 0x65B5, 0xCAFF, 0xCAFF, 0xCAFF, 0xC9FF, 0xC8DE,
+  0x424A, 0x6008, 0x8010, 0x4008, 0x4008, 0x2000, 0x2008, 0x0000,
+  0x0000, 0x7507, 0x0022, 0x0000, 0x0000, 0x0000, 0x2008, 0x2000,
+  0x4008, 0x6008, 0x4008, 0x6010, 0x6010, 0xC239, 0x68D6, 0xCAFF,
+  0xEAFF, 0x45B5, 0xC118, 0xC120, 0xC120, 0xA35A, 0xCAFF, 0xA9F7,
+  0xA5C5, 0x236B, 0xA018, 0x8010, 0x6008, 0x4008, 0x2008, 0x4008,
+  0x2008, 0x2000, 0x2000, 0x0000, 0x0000, 0x7606, 0x0021, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x2000, 0x2000, 0x2008, 0x4008, 0x2008,
+  0x4008, 0x6008, 0x8010, 0xA018, 0xC483, 0xC4A4, 0x2229, 0xA018,
+  0xA010, 0xA018, 0xA018, 0xE241, 0x0121, 0x6010, 0x8010, 0x6010,
+  0x4008, 0x4008, 0x4008, 0x2008, 0x2000, 0x2000, 0x0000, 0x0000,
+  0x7709, 0x001E, 0x0000, 0x0000, 0x0000, 0x2000, 0x2008, 0x2000,
+  0x4008, 0x4008, 0x4008, 0x4008, 0x8010, 0x6010, 0x8010, 0x6010,
+  0x8010, 0x6010, 0x8010, 0x6010, 0x8010, 0x6008, 0x4008, 0x2008,
+  0x4008, 0x4008, 0x2000, 0x2008, 0x0000, 0x2000, 0x0000, 0x0000,
+  0x7807, 0x001E, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x2000, 0x2008, 0x2000, 0x2008, 0x4008, 0x2008, 0x4008, 0x4008,
+  0x4008, 0x6008, 0x4008, 0x6008, 0x4010, 0x6008, 0x4008, 0x4008,
+  0x4008, 0x2000, 0x2008, 0x2000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x7909, 0x001D, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x2008, 0x2000, 0x2008, 0x2000, 0x2000, 0x4008, 0x2008, 0x4000,
+  0x2008, 0x4008, 0x2008, 0x4008, 0x2000, 0x2008, 0x2000, 0x2008,
+  0x2000, 0x0000, 0x2000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7A0B,
+  0x0018, 0x0000, 0x0000, 0x0000, 0x0000, 0x2000, 0x0000, 0x2000,
+  0x0000, 0x2000, 0x2008, 0x2000, 0x2008, 0x2000, 0x2008, 0x2000,
+  0x2008, 0x2000, 0x2008, 0x2000, 0x0000, 0x2000, 0x0000, 0x0000,
+  0x0000, 0x7B0C, 0x0017, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x2000, 0x0000, 0x2000, 0x0000, 0x2000, 0x0000, 0x2000,
+  0x0000, 0x2000, 0x0000, 0x2000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x7C0E, 0x0014, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x7D0E, 0x0010, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x7E13, 0x0009, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7F14, 0x0007, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0016, 0x0006,
+  0x0008, 0x2000, 0x2000, 0x2008, 0x0000, 0x2000, 0x0115, 0x0006,
+  0xA169, 0xA2D2, 0x82D2, 0xA2D2, 0xA2DA, 0xC169, 0x0214, 0x0008,
+  0x2008, 0xA2D2, 0xA2D2, 0x82D2, 0xA2D2, 0x82D2, 0xA2D2, 0x2110,
+  0x0315, 0x0007, 0xE291, 0xA2D2, 0x82D2, 0xA2D2, 0x82D2, 0xA2DA,
+  0xA028, 0x0415, 0x0007, 0x6118, 0x82B2, 0xA2D2, 0x82D2, 0xA2D2,
+  0x82D2, 0x8028, 0x0517, 0x0004, 0x8028, 0xC130, 0xA2D2, 0x82B2,
+  0x0617, 0x0004, 0x2000, 0x8120, 0x62B2, 0x6118, 0x0718, 0x0002,
+  0x0241, 0x2010, 0x0816, 0x0005, 0x0000, 0x0000, 0x2000, 0x0000,
+  0x0000, 0x0916, 0x0006, 0x2000, 0x0000, 0x2000, 0x0000, 0x0000,
+  0x0000, 0x0A16, 0x0006, 0x0000, 0x2000, 0x0000, 0x2000, 0x0000,
+  0x0000, 0x0B13, 0x000B, 0x2000, 0x0000, 0x2000, 0x0000, 0x2008,
+  0x0000, 0x2000, 0x0000, 0x2000, 0x0000, 0x2000, 0x0C12, 0x000D,
+  0x2000, 0x0000, 0x2000, 0x0008, 0x2000, 0x0000, 0x2000, 0x0008,
+  0x2000, 0x0000, 0x2000, 0x0000, 0x2000, 0x0D12, 0x000C, 0x2000,
+  0x0000, 0x2000, 0x2000, 0x0008, 0x2000, 0x0008, 0x2000, 0x0008,
+  0x2008, 0x0000, 0x2000, 0x0E10, 0x0010, 0x2000, 0x0000, 0x2000,
+  0x0008, 0x2008, 0x2000, 0x0008, 0x2008, 0x0000, 0x2008, 0x0000,
+  0x2008, 0x0000, 0x2000, 0x0000, 0x2000, 0x0F0F, 0x0011, 0x2000,
+  0x0000, 0x2000, 0x0008, 0x2000, 0x0008, 0x2008, 0x0000, 0x2008,
+  0x0008, 0x2008, 0x0008, 0x2008, 0x0008, 0x2000, 0x0000, 0x2000,
+  0x1010, 0x0011, 0x2000, 0x0008, 0x2000, 0x0008, 0x2008, 0x0008,
+  0x2000, 0x0008, 0x2008, 0x2008, 0x0008, 0x2008, 0xE291, 0xC130,
+  0x2000, 0x0000, 0x2000, 0x110F, 0x0012, 0x2000, 0x0000, 0x2000,
+  0x0008, 0x0008, 0x2008, 0x2010, 0x2008, 0x2008, 0x2008, 0x2008,
+  0x2008, 0x4110, 0x23E3, 0x82B2, 0x2008, 0x0000, 0x2000, 0x120D,
+  0x0015, 0x2000, 0x0000, 0x2008, 0x0008, 0x2008, 0x0000, 0x2008,
+  0x2008, 0x2010, 0x2010, 0x2010, 0x2010, 0x2010, 0x2010, 0x8128,
+  0x61E3, 0x23E3, 0x0000, 0x2000, 0x0000, 0x2000, 0x130E, 0x0015,
+  0x2000, 0x0000, 0x2008, 0x0008, 0x2008, 0x2008, 0x2010, 0x2010,
+  0x2010, 0x2010, 0x2010, 0x2010, 0x2010, 0x2008, 0x22C3, 0x61E3,
+  0x2008, 0x0008, 0x2008, 0x0000, 0x2000, 0x140D, 0x0016, 0x2000,
+  0x0000, 0x2008, 0x0008, 0x2008, 0x2008, 0x2010, 0x2010, 0x4118,
+  0x4118, 0x4118, 0x4110, 0x4118, 0x4118, 0x2010, 0xC169, 0x8292,
+  0x2008, 0x0000, 0x2008, 0x0000, 0x2000, 0x150C, 0x0018, 0x2000,
+  0x0000, 0x2000, 0x0008, 0x2010, 0x2008, 0x2010, 0x2010, 0x4110,
+  0x4118, 0x4118, 0x4118, 0x4110, 0x4118, 0x4118, 0x4118, 0x2010,
+  0x2010, 0x2008, 0x2000, 0x0008, 0x2008, 0x0000, 0x2000, 0x160D,
+  0x0017, 0x2000, 0x0008, 0x2008, 0x2008, 0x2010, 0x2010, 0x4118,
+  0x4118, 0x4118, 0x6118, 0x6120, 0x6120, 0x6118, 0x6120, 0x4110,
+  0x4118, 0x2010, 0x2010, 0x2008, 0x0008, 0x2008, 0x0000, 0x2000,
+  0x170B, 0x0019, 0x2000, 0x0000, 0x2008, 0x0008, 0x0008, 0x2008,
+  0x2010, 0x4110, 0x4118, 0x6120, 0x6118, 0x6120, 0x8120, 0x8120,
+  0x6120, 0x6118, 0x6120, 0x4118, 0x4118, 0x2010, 0x2008, 0x0000,
+  0x2008, 0x0008, 0x2000, 0x180C, 0x0019, 0x2000, 0x0000, 0x2008,
+  0x2008, 0x2010, 0x2010, 0x4118, 0x6120, 0x6118, 0x8128, 0x6120,
+  0x8120, 0x8128, 0x8120, 0x6128, 0x6118, 0x6120, 0x4118, 0x4110,
+  0x2010, 0x2008, 0x0008, 0x2008, 0x0000, 0x2000, 0x190C, 0x0018,
+  0x2008, 0x0008, 0x2008, 0x2008, 0x2010, 0x4110, 0x6120, 0x6120,
+  0x6120, 0x8120, 0xA128, 0x4151, 0xA169, 0xA128, 0x6120, 0x8120,
+  0x6120, 0x6120, 0x4110, 0x2010, 0x2008, 0x2008, 0x0008, 0x2000,
+  0x1A0A, 0x001B, 0x2000, 0x0000, 0x2008, 0x0008, 0x2008, 0x2010,
+  0x4110, 0x4118, 0x6120, 0x8120, 0xA128, 0x8128, 0xA130, 0x22B3,
+  0x6249, 0xC130, 0xA128, 0xA128, 0x8120, 0x6120, 0x4110, 0x4118,
+  0x2010, 0x2008, 0x0008, 0x0008, 0x2000, 0x1B0A, 0x001C, 0x2000,
+  0x0000, 0x2008, 0x0008, 0x2008, 0x2010, 0x4118, 0x6118, 0x6120,
+  0xA128, 0xA130, 0xC130, 0xC251, 0xA2CB, 0xE238, 0xC130, 0xA128,
+  0xA130, 0xA128, 0x8120, 0x6120, 0x4118, 0x2010, 0x2008, 0x0008,
+  0x2000, 0x0000, 0x2000, 0x1C0B, 0x001B, 0x2000, 0x0008, 0x2008,
+  0x2010, 0x2010, 0x4118, 0x6120, 0x8120, 0xA128, 0xC130, 0xE238,
+  0x22B3, 0xE19A, 0x0239, 0xE238, 0xE230, 0xA130, 0xA128, 0x8120,
+  0x6120, 0x4110, 0x2010, 0x2008, 0x2008, 0x0008, 0x0000, 0x2000,
+  0x1D0A, 0x001B, 0x2000, 0x0000, 0x0008, 0x2008, 0x2010, 0x4118,
+  0x6120, 0x8120, 0xA128, 0xA128, 0xE230, 0xA169, 0x23EC, 0x216A,
+  0x2239, 0x0239, 0xE238, 0xE230, 0xA130, 0xA128, 0x8120, 0x6120,
+  0x4118, 0x2010, 0x2008, 0x0008, 0x2000, 0x1E0B, 0x001B, 0x2008,
+  0x0008, 0x2010, 0x2010, 0x4110, 0x6120, 0x8120, 0xA130, 0xC130,
+  0x2239, 0xA2CB, 0x23EC, 0x2241, 0x4241, 0x2241, 0x0239, 0xE238,
+  0xC130, 0xC128, 0x8120, 0x6120, 0x4118, 0x2010, 0x2008, 0x0008,
+  0x0000, 0x2000, 0x1F09, 0x001D, 0x2000, 0x0000, 0x2000, 0x0008,
+  0x2010, 0x4118, 0x6120, 0x6120, 0xA128, 0xC130, 0xC230, 0x4272,
+  0x63EC, 0x81B3, 0x6249, 0x6251, 0x6251, 0x4241, 0x0239, 0xE238,
+  0xC130, 0xA128, 0x6120, 0x4110, 0x4118, 0x2008, 0x2008, 0x0008,
+  0x2000, 0x200A, 0x001C, 0x2000, 0x0008, 0x2008, 0x2010, 0x4118,
+  0x6120, 0x8120, 0xA128, 0xE238, 0x2239, 0x41E4, 0x63EC, 0x2393,
+  0xA251, 0xC259, 0x8349, 0x6249, 0x4241, 0x0239, 0xE238, 0xA130,
+  0x8120, 0x6118, 0x4118, 0x2010, 0x2008, 0x0008, 0x2000, 0x210A,
+  0x001C, 0x2000, 0x0008, 0x2008, 0x2010, 0x4110, 0x6120, 0x8128,
+  0xC130, 0xE230, 0x828A, 0x63EC, 0xC2F4, 0x239B, 0xA251, 0xC259,
+  0xC251, 0x239B, 0x6251, 0x0239, 0xE238, 0xC130, 0xA128, 0x6118,
+  0x4118, 0x2010, 0x2008, 0x0008, 0x2000, 0x2208, 0x001E, 0x2000,
+  0x0000, 0x2008, 0x0008, 0x2008, 0x2010, 0x6120, 0x8120, 0xA128,
+  0xE238, 0x6251, 0x63EC, 0xC2F4, 0xC2EC, 0x0393, 0x2362, 0x2362,
+  0x2362, 0xA2EC, 0x61AB, 0x2241, 0x0239, 0xC130, 0xA128, 0x6118,
+  0x4118, 0x2010, 0x2008, 0x0008, 0x2000, 0x2309, 0x001E, 0x2000,
+  0x0008, 0x0008, 0x2008, 0x4110, 0x6120, 0x8120, 0xA128, 0xE230,
+  0x02B3, 0xC2EC, 0xC2F4, 0x03ED, 0xA2EC, 0xC372, 0x2362, 0x2393,
+  0x03F5, 0xC2F4, 0x239B, 0x0239, 0xE238, 0x8128, 0x8120, 0x4118,
+  0x2010, 0x2008, 0x2008, 0x0008, 0x2000, 0x2408, 0x0020, 0x2000,
+  0x0000, 0x2008, 0x0008, 0x2010, 0x4110, 0x6120, 0xA128, 0xC130,
+  0x6251, 0xA2EC, 0xC2EC, 0x03F5, 0x03ED, 0x03F5, 0x44ED, 0x02DD,
+  0x03F5, 0x03ED, 0xC2F4, 0xC2EC, 0x817A, 0xC230, 0xA128, 0x8120,
+  0x6120, 0x4118, 0x2010, 0x0008, 0x2000, 0x0000, 0x2000, 0x2509,
+  0x001C, 0x2000, 0x0000, 0x0008, 0x2010, 0x4118, 0x6118, 0xA128,
+  0xA128, 0x61AB, 0xC2EC, 0xC2F4, 0x03ED, 0x03F5, 0x44ED, 0x44ED,
+  0x43F5, 0x43F5, 0x03F5, 0x03ED, 0xC2F4, 0xA2EC, 0x6249, 0xC130,
+  0xA128, 0x6120, 0x4118, 0x2010, 0x2008, 0x2608, 0x001E, 0x2000,
+  0x0000, 0x2008, 0x2008, 0x2010, 0x4118, 0x6120, 0xA128, 0x6249,
+  0xA2EC, 0xC2F4, 0x03ED, 0x03F5, 0x43F5, 0x83F5, 0x83F5, 0x83ED,
+  0x83F5, 0x43F5, 0x03ED, 0x03ED, 0xC2F4, 0x82C3, 0xC130, 0x8128,
+  0x6118, 0x4110, 0x2010, 0x2008, 0x0008, 0x2708, 0x001E, 0x2000,
+  0x0000, 0x0008, 0x2008, 0x2010, 0x4118, 0x6118, 0x8120, 0xE19A,
+  0xA2EC, 0xC2F4, 0x03ED, 0x43ED, 0x83F5, 0xA3F5, 0x05F6, 0x05F6,
+  0x83F5, 0x83F5, 0x43F5, 0x03ED, 0xC2F4, 0xC2F4, 0x016A, 0xA128,
+  0x6118, 0x4118, 0x2010, 0x2010, 0x2008, 0x2809, 0x0020, 0x2000,
+  0x0008, 0x2008, 0x2010, 0x4118, 0x8120, 0xC130, 0x41E4, 0xC2F4,
+  0x03ED, 0x03F5, 0x43F5, 0x83F5, 0xC4F5, 0xA9F6, 0x29F7, 0x46F6,
+  0x83F5, 0x43F5, 0x03ED, 0xC2EC, 0xA2F4, 0x61AB, 0x8120, 0x8120,
+  0x4110, 0x2010, 0x2008, 0x0008, 0x0000, 0x2000, 0x0000, 0x2909,
+  0x001F, 0x2000, 0x0008, 0x2008, 0x2010, 0x6118, 0x6120, 0x0172,
+  0xA2EC, 0xC2F4, 0x03ED, 0x43F5, 0x83F5, 0xC4F5, 0xC9F6, 0x29F7,
+  0x09FF, 0x29FF, 0x46F6, 0x63F5, 0x43F5, 0x03ED, 0xC2F4, 0xA1EC,
+  0xE238, 0x8120, 0x4118, 0x2010, 0x2008, 0x0008, 0x2008, 0x0000,
+  0x2A08, 0x0021, 0x2000, 0x0000, 0x2008, 0x2010, 0x2010, 0x6120,
+  0x8120, 0x81B3, 0xC2F4, 0xC1EC, 0x03F5, 0x43F5, 0xA3F5, 0x08F7,
+  0x09FF, 0x29FF, 0x09F7, 0x29FF, 0x09FF, 0x05F6, 0x43F5, 0x02ED,
+  0xC2EC, 0xC1F4, 0xA161, 0x6120, 0x4110, 0x2010, 0x2008, 0x0008,
+  0x0000, 0x2000, 0x0000, 0x2B08, 0x0021, 0x0000, 0x2000, 0x0008,
+  0x2008, 0x4110, 0x6118, 0xA130, 0xA1E4, 0xC1EC, 0x02F5, 0x02F5,
+  0x43F5, 0xE5F5, 0x29F7, 0x09FF, 0x69FF, 0x49FF, 0x29F7, 0x29FF,
+  0x46F6, 0x43F5, 0x02F5, 0xC1F4, 0xE1F4, 0x8292, 0x8120, 0x4118,
+  0x2010, 0x2008, 0x0008, 0x2000, 0x0000, 0x0000, 0x2C08, 0x0022,
+  0x2000, 0x0000, 0x2008, 0x2010, 0x4118, 0x6118, 0xA169, 0xE1F4,
+  0xC1F4, 0x02F5, 0x02F5, 0x63F5, 0xA7F6, 0x29FF, 0x49FF, 0x6AFF,
+  0x49F7, 0x29FF, 0x09FF, 0xC9F6, 0x43F5, 0x02F5, 0x02ED, 0xC1F4,
+  0xE19A, 0x6118, 0x4110, 0x2010, 0x2008, 0x0008, 0x2000, 0x0000,
+  0x0000, 0x0000, 0x2D07, 0x0022, 0x0000, 0x0000, 0x2000, 0x0000,
+  0x2010, 0x4118, 0x4118, 0x828A, 0xC1EC, 0xC1F4, 0x02ED, 0x42F5,
+  0xC4F5, 0xE8FE, 0x29F7, 0x49FF, 0x69FF, 0x49FF, 0x69F7, 0x09FF,
+  0x08FF, 0x83F5, 0x21F5, 0x02F5, 0xC1F4, 0xE19A, 0x8120, 0x4118,
+  0x2010, 0x2008, 0x2008, 0x0008, 0x2000, 0x0000, 0x2E0B, 0x001F,
+  0x2010, 0x4118, 0x6120, 0x81B3, 0xC1F4, 0xC1EC, 0x02F5, 0x63F5,
+  0xA7F6, 0x08FF, 0x09F7, 0x69FF, 0x48FF, 0xE5F6, 0x69F7, 0x09FF,
+  0x08FF, 0x83F5, 0x42ED, 0x02F5, 0xC1EC, 0xE19A, 0x6120, 0x2110,
+  0x2010, 0x2008, 0x0000, 0x2000, 0x0000, 0x0000, 0x0000, 0x2F08,
+  0x001A, 0x0000, 0x2000, 0x0008, 0x2008, 0x4110, 0x4118, 0x21DC,
+  0xC1EC, 0x02F5, 0x02ED, 0x46F6, 0x08FF, 0xE8F6, 0x29FF, 0x49FF,
+  0x27FF, 0x84F6, 0xE8F6, 0x29FF, 0x08FF, 0xA3F5, 0x42F5, 0x02F5,
+  0xC1F4, 0xE19A, 0x8120, 0x2F28, 0x0002, 0x0000, 0x0000, 0x3006,
+  0x0025, 0x0000, 0x0000, 0x2000, 0x0000, 0x2008, 0x2008, 0x4118,
+  0x8128, 0xC1F4, 0xC1F4, 0x02F5, 0x63F5, 0xA9F6, 0xE8FE, 0x08F7,
+  0x09FF, 0x29FF, 0x85F6, 0x84F6, 0x64F6, 0xE8FE, 0xE8F6, 0xA3F5,
+  0x43F5, 0x02F5, 0x02F5, 0x828A, 0x6120, 0x4110, 0x2010, 0x2008,
+  0x0000, 0x2000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3107, 0x0024,
+  0x0000, 0x2000, 0x0000, 0x0008, 0x2008, 0x4110, 0xC230, 0xC1F4,
+  0xC1EC, 0x02F5, 0x42F5, 0xA7F6, 0x08F7, 0xE8FE, 0x09FF, 0x85F6,
+  0x84F6, 0x64FE, 0x44F6, 0x66F6, 0x08F7, 0x83F5, 0x43F5, 0x21F5,
+  0x22F5, 0x8182, 0x8128, 0x4118, 0x2010, 0x2008, 0x2008, 0x0000,
+  0x2000, 0x0000, 0x0000, 0x0000, 0x3206, 0x0025, 0x0000, 0x0000,
+  0x0000, 0x2000, 0x0008, 0x2008, 0x4118, 0x2149, 0xE1F4, 0x02F5,
+  0x02F5, 0x21F5, 0xC4F5, 0x08F7, 0x09FF, 0xA7F6, 0x24F6, 0x64F6,
+  0x44F6, 0x24F6, 0xE4FD, 0xE8FE, 0x83F5, 0x43ED, 0x21F5, 0x02F5,
+  0x817A, 0x6120, 0x4110, 0x2010, 0x2008, 0x0008, 0x2000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x3307, 0x0025, 0x0000, 0x2000, 0x0000,
+  0x0008, 0x2008, 0x2008, 0x6141, 0xC1EC, 0x02F5, 0x02F5, 0x42F5,
+  0x83F5, 0xA9F6, 0xE8FE, 0x46F6, 0x24F6, 0x25F6, 0x45F6, 0x24F6,
+  0xE3F5, 0xA7F6, 0x83F5, 0x43F5, 0x21F5, 0x22F5, 0x8182, 0x8120,
+  0x4118, 0x2010, 0x2008, 0x2008, 0x0000, 0x2000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x3406, 0x0025, 0x0000, 0x0000, 0x0000, 0x2000,
+  0x0008, 0x2008, 0x2010, 0x8149, 0x22FD, 0x02F5, 0x21F5, 0x42F5,
+  0x43F5, 0x46F6, 0x08F7, 0x66F6, 0xE4F5, 0x24F6, 0x24F6, 0xE4F5,
+  0x24F6, 0xA7FE, 0x63F5, 0x43F5, 0x42ED, 0x21F5, 0x4272, 0x6120,
+  0x4110, 0x2010, 0x2008, 0x0008, 0x0000, 0x2000, 0x0000, 0x0000,
+  0x0000, 0x3506, 0x0027, 0x0000, 0x0000, 0x2000, 0x0000, 0x0008,
+  0x2008, 0x2008, 0x0131, 0x01F5, 0x02ED, 0x21F5, 0x42F5, 0x43F5,
+  0xC4F5, 0xE8FE, 0x66F6, 0x04F6, 0xE4F5, 0x04FE, 0xE4F5, 0xA7F6,
+  0x66F6, 0x83F5, 0x63F5, 0x42F5, 0x21F5, 0xC169, 0x6120, 0x4118,
+  0x2010, 0x2008, 0x0008, 0x2000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x3605, 0x0028, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x2000, 0x0008, 0x2008, 0x2010, 0x8120, 0x21FD, 0x21F5, 0x42F5,
+  0x42F5, 0x83F5, 0xA3F5, 0xA7F6, 0x66F6, 0xE4F5, 0x04F6, 0xE4F5,
+  0x04FE, 0xA7F6, 0xC4F5, 0xA3F5, 0x43F5, 0x42F5, 0x42F5, 0x6249,
+  0x4118, 0x4110, 0x2010, 0x0008, 0x2000, 0x0000, 0x2000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x3705, 0x0027, 0x0000, 0x0000,
+  0x0000, 0x2000, 0x0000, 0x0008, 0x2008, 0x2010, 0x4110, 0xA3D4,
+  0x21ED, 0x42F5, 0x43F5, 0x83F5, 0x83F5, 0x45F6, 0xA7F6, 0x04FE,
+  0xE4F5, 0x04F6, 0x04F6, 0xC3F5, 0xC3F5, 0xA3F5, 0x83F5, 0x43F5,
+  0x62FD, 0xE238, 0x6118, 0x4118, 0x2010, 0x2008, 0x0008, 0x2000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3806, 0x0027, 0x0000,
+  0x0000, 0x0000, 0x2000, 0x0000, 0x2008, 0x2010, 0x6120, 0x81B3,
+  0x62F5, 0x42F5, 0x43F5, 0x83F5, 0xA3F5, 0xC3F5, 0xA9F6, 0x04F6,
+  0xE4F5, 0x04FE, 0xE4F5, 0xC4F5, 0xA3F5, 0xA3F5, 0x82F5, 0x42F5,
+  0xA3D4, 0x8120, 0x6118, 0x4118, 0x2010, 0x0008, 0x0000, 0x2000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3905, 0x0028,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x2000, 0x0000, 0x2008, 0x2010,
+  0x4118, 0x817A, 0x42F5, 0x42F5, 0x82F5, 0x83F5, 0xA3F5, 0xA3F5,
+  0x45F6, 0x04F6, 0xE4F5, 0x04F6, 0xE3F5, 0xC3F5, 0xA3F5, 0xA3F5,
+  0x62F5, 0x82FD, 0x02BC, 0xA128, 0x6120, 0x4118, 0x2010, 0x2008,
+  0x2008, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x3A04, 0x002A, 0x0000, 0x0000, 0x0000, 0x0000, 0x2000, 0x0000,
+  0x2008, 0x2008, 0x2010, 0x4118, 0x0239, 0x62F5, 0x82F5, 0x82F5,
+  0xA3F5, 0xA3F5, 0xC3F5, 0xC3F5, 0xE3F5, 0xE4FD, 0x04F6, 0xE3F5,
+  0xC3F5, 0xA3F5, 0xA3F5, 0x83F5, 0x62F5, 0x817A, 0x8120, 0x6118,
+  0x4118, 0x2010, 0x0008, 0x2000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x3B04, 0x0029, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x2000, 0x0000, 0x0008, 0x2008, 0x2010, 0x4110,
+  0x6118, 0xE2BB, 0x82F5, 0x62F5, 0xA3F5, 0xA3F5, 0xC3F5, 0xC3F5,
+  0xC4F5, 0x04F6, 0xE4FD, 0xE3F5, 0xC3F5, 0xC3F5, 0xA3F5, 0x82F5,
+  0x63F5, 0x4241, 0xA128, 0x6120, 0x4118, 0x2010, 0x0008, 0x2008,
+  0x0000, 0x2000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3C05,
+  0x0028, 0x0000, 0x0000, 0x0000, 0x0000, 0x2008, 0x0008, 0x2008,
+  0x2010, 0x6120, 0x8120, 0x6251, 0x82F5, 0x82F5, 0xA3F5, 0xC3F5,
+  0xC3F5, 0xC4F5, 0x04F6, 0xE4FD, 0x04F6, 0xE3F5, 0xC3F5, 0x02DD,
+  0x2393, 0x4272, 0x2241, 0xC130, 0x8128, 0x6120, 0x4110, 0x2010,
+  0x0008, 0x2008, 0x0000, 0x2000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x3D04, 0x002A, 0x0000, 0x0000, 0x0000, 0x2000, 0x0000,
+  0x2000, 0x0008, 0x2008, 0x2010, 0x6118, 0x6120, 0xA128, 0x817A,
+  0x819B, 0x0383, 0x84ED, 0xC3F5, 0xE3F5, 0xE4F5, 0x04F6, 0x04FE,
+  0x04F6, 0xE3F5, 0x239B, 0x6251, 0x0241, 0xE240, 0xC130, 0xA128,
+  0x6118, 0x4118, 0x2010, 0x2010, 0x0008, 0x2000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3E05, 0x0029, 0x0000,
+  0x0000, 0x0000, 0x2000, 0x0008, 0x2008, 0x2008, 0x2010, 0x6120,
+  0x8120, 0x8128, 0xC130, 0xE240, 0x4241, 0x239B, 0xE3FD, 0xE3F5,
+  0x04F6, 0x04F6, 0x04F6, 0xE4FD, 0xE3F5, 0xA161, 0x6249, 0xE240,
+  0xE240, 0xC130, 0xA128, 0x6118, 0x4118, 0x2010, 0x2008, 0x0000,
+  0x2000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x3F05, 0x0028, 0x0000, 0x0000, 0x0000, 0x2000, 0x0000, 0x0008,
+  0x2010, 0x2010, 0x6118, 0x8120, 0xA128, 0xC130, 0xE240, 0x2241,
+  0x4249, 0x84ED, 0x04F6, 0xE4FD, 0x04F6, 0x04F6, 0x04FE, 0xC3DC,
+  0x6249, 0x6251, 0xE240, 0xE240, 0xC130, 0xA128, 0x6118, 0x4118,
+  0x2010, 0x2008, 0x2008, 0x0008, 0x2000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x4004, 0x002A, 0x0000, 0x0000, 0x0000, 0x2000,
+  0x0000, 0x2008, 0x0008, 0x2010, 0x4118, 0x6118, 0x8128, 0xA128,
+  0xE238, 0x0241, 0x4241, 0x6251, 0xA4CC, 0x04FE, 0xE4F5, 0x04F6,
+  0xE4FD, 0x04F6, 0x43AC, 0x4249, 0x6249, 0xE240, 0xE240, 0xC130,
+  0xA128, 0x6118, 0x4118, 0x2010, 0x2008, 0x0008, 0x2000, 0x0000,
+  0x2000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4104, 0x002A,
+  0x0000, 0x0000, 0x2000, 0x0000, 0x2000, 0x0000, 0x0008, 0x2010,
+  0x4118, 0x6120, 0x8120, 0xC128, 0xE238, 0xE240, 0x2241, 0x6249,
+  0xA39B, 0x04F6, 0xE4F5, 0x04F6, 0x04FE, 0x04F6, 0xA4D4, 0x6249,
+  0x6251, 0xE240, 0xE240, 0xC130, 0xA128, 0x6118, 0x4118, 0x2010,
+  0x2008, 0x2008, 0x0008, 0x2000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x4205, 0x002A, 0x0000, 0x0000, 0x2000, 0x0008,
+  0x2008, 0x2008, 0x2010, 0x4118, 0x6120, 0x8120, 0xA130, 0xE230,
+  0xE240, 0x4241, 0x6251, 0xC39B, 0x04FE, 0x24F6, 0x24F6, 0x24F6,
+  0xE4FD, 0xE4F5, 0x2393, 0x6249, 0x2241, 0xE240, 0xC130, 0xA128,
+  0x6120, 0x6120, 0x4110, 0x2010, 0x0008, 0x2000, 0x0000, 0x2000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4305, 0x0029,
+  0x0000, 0x0000, 0x2000, 0x0008, 0x0008, 0x2008, 0x2010, 0x4118,
+  0x6118, 0x8120, 0xA130, 0xE230, 0xE240, 0x6251, 0x6249, 0xA39B,
+  0x23F6, 0x04F6, 0x24F6, 0x04F6, 0x24F6, 0x23F6, 0x03F6, 0xC259,
+  0x4241, 0xE240, 0xC130, 0x8128, 0x8120, 0x6120, 0x4110, 0x2010,
+  0x2008, 0x2008, 0x0008, 0x2008, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x4404, 0x002A, 0x0000, 0x0000, 0x2000, 0x0000, 0x2008,
+  0x0008, 0x2010, 0x2010, 0x4118, 0x6118, 0xA128, 0xC130, 0xE238,
+  0x4249, 0x6249, 0x6251, 0x43AC, 0x43FE, 0x43F6, 0x43FE, 0x64F6,
+  0x43F6, 0x23F6, 0x23FE, 0x0393, 0x2241, 0xE240, 0xE230, 0xA128,
+  0x6120, 0x6120, 0x4110, 0x2010, 0x2008, 0x0008, 0x2008, 0x0000,
+  0x2000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4505, 0x002A, 0x0000,
+  0x0000, 0x2000, 0x0008, 0x0008, 0x2010, 0x4118, 0x6118, 0x8120,
+  0xA128, 0xC130, 0xE240, 0x2241, 0x6251, 0xA251, 0x43CD, 0x44F6,
+  0x64F6, 0x44F6, 0x64FE, 0x64F6, 0x43F6, 0x63F6, 0xC2C4, 0x6251,
+  0xE240, 0xE238, 0xA128, 0x8120, 0x6120, 0x4118, 0x2010, 0x2008,
+  0x2008, 0x0000, 0x2000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x4604, 0x002B, 0x0000, 0x2000, 0x0000, 0x2008, 0x0008,
+  0x2008, 0x2010, 0x4110, 0x6120, 0x8120, 0xA128, 0xE238, 0xE240,
+  0x4241, 0x6251, 0xA251, 0x03F6, 0x64F6, 0x64FE, 0x64F6, 0x44F6,
+  0x64F6, 0x44FE, 0x43F6, 0xE3ED, 0x6249, 0x2241, 0xE230, 0xC130,
+  0x6120, 0x6120, 0x4118, 0x2010, 0x2008, 0x0008, 0x2000, 0x0000,
+  0x2000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4703, 0x002B,
+  0x0000, 0x0000, 0x2000, 0x0000, 0x2000, 0x0008, 0x2008, 0x2010,
+  0x4118, 0x6120, 0x8120, 0xA128, 0xE238, 0x0239, 0x6249, 0xA251,
+  0x0383, 0x44F6, 0x64F6, 0x84FE, 0x84F6, 0x84F6, 0x44FE, 0x64F6,
+  0x64F6, 0x64FE, 0xC259, 0x2241, 0xE238, 0xC130, 0xA128, 0x6120,
+  0x4110, 0x2010, 0x2008, 0x2008, 0x0008, 0x2000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x4804, 0x002B, 0x0000, 0x0000, 0x2000,
+  0x0008, 0x2008, 0x2008, 0x2010, 0x4118, 0x6120, 0x8120, 0xA128,
+  0xE238, 0x0239, 0x6251, 0xC259, 0xC2C4, 0xA4F6, 0x84F6, 0x84FE,
+  0x84F6, 0x84F6, 0x84F6, 0x84FE, 0x63F6, 0x64F6, 0xA372, 0x2241,
+  0x0239, 0xC130, 0xA128, 0xC151, 0x8128, 0x4110, 0x2010, 0x2008,
+  0x0008, 0x2000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x4904, 0x002A, 0x0000, 0x0000, 0x2000, 0x0000, 0x0008, 0x2008,
+  0x2010, 0x4118, 0x6118, 0xA128, 0xC130, 0x0239, 0x2241, 0x6249,
+  0x4272, 0x63F6, 0x84FE, 0x84F6, 0x84F6, 0xA4F6, 0xA4FE, 0x84F6,
+  0x84F6, 0x84FE, 0x64FE, 0x838B, 0x4241, 0x0239, 0xE238, 0xA128,
+  0x826A, 0xC3A3, 0x4118, 0x2010, 0x2008, 0x2008, 0x0008, 0x2000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x4A04, 0x002B, 0x0000, 0x2008,
+  0x0000, 0x2008, 0x0008, 0x2008, 0x2010, 0x4118, 0x6118, 0xC159,
+  0x63B4, 0xC2C4, 0x0383, 0xA251, 0x43AC, 0xA4FE, 0x84F6, 0xA4F6,
+  0xA4FE, 0xC4F6, 0xC4FE, 0xC4F6, 0xA4F6, 0x84FE, 0x84F6, 0x43AC,
+  0x6249, 0x2241, 0xE230, 0xA130, 0x819B, 0x02F6, 0x6118, 0x2010,
+  0x2008, 0x0008, 0x0008, 0x2000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x4B04, 0x002A, 0x0000, 0x0000, 0x2008, 0x0008, 0x2008,
+  0x2010, 0x4110, 0x2110, 0x8128, 0xA2DD, 0x62FE, 0x42F6, 0x83F6,
+  0x43CD, 0x63F6, 0x84F6, 0xA4F6, 0xC4FE, 0xC5F6, 0xE5FE, 0xC5F6,
+  0xE5FE, 0xA4F6, 0xA4F6, 0xA4FE, 0xC2C4, 0x6251, 0x4241, 0x0239,
+  0xA128, 0x63CD, 0x42FE, 0x8149, 0x2010, 0x2008, 0x0008, 0x2008,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4C05, 0x0029, 0x2000,
+  0x0008, 0x2008, 0x2008, 0x2010, 0x4110, 0x6120, 0xC159, 0x62FE,
+  0x62F6, 0x62F6, 0x83FE, 0x63F6, 0x84F6, 0xA4FE, 0xC4F6, 0xE5FE,
+  0xC5F6, 0x09FF, 0x05F7, 0xE5FE, 0xE5FE, 0xC4F6, 0xA4F6, 0xA2E5,
+  0xA251, 0x4249, 0x0239, 0xC151, 0x62FE, 0x62FE, 0x826A, 0x2008,
+  0x0008, 0x0008, 0x2000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x4D05, 0x002A, 0x0000, 0x2000, 0x0008, 0x2008, 0x2010, 0x4118,
+  0x4118, 0x826A, 0x42F6, 0x42FE, 0x82F6, 0x83F6, 0x84F6, 0xA4F6,
+  0xC4FE, 0xE5F6, 0x05FF, 0x07F7, 0xB0FF, 0x06FF, 0x05F7, 0x05F7,
+  0xE5FE, 0xC4FE, 0xA4FE, 0x2362, 0x8341, 0x2241, 0x43AC, 0x62FE,
+  0x62FE, 0x418B, 0x4118, 0x2010, 0x0008, 0x2008, 0x0000, 0x2000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x4E06, 0x0029, 0x2000, 0x0008,
+  0x2010, 0x2010, 0x4118, 0x6118, 0xA272, 0x62FE, 0x82FE, 0x82F6,
+  0x83F6, 0xA4FE, 0xC4F6, 0xE5FE, 0x05F7, 0x05FF, 0x2EF7, 0xB2FF,
+  0x26FF, 0x26F7, 0x05F7, 0xC5FE, 0xE5FE, 0xC4F6, 0x638B, 0xA251,
+  0x2362, 0x62F6, 0x82FE, 0x62F6, 0x43AC, 0x2110, 0x2010, 0x2008,
+  0x0000, 0x0000, 0x2000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4F04,
+  0x0003, 0x0000, 0x2000, 0x0008, 0x4F0C, 0x0021, 0x0162, 0x82F6,
+  0x82F6, 0xA2FE, 0xA4F6, 0xA4F6, 0xC4FE, 0x05F7, 0x05F7, 0x47FF,
+  0xB4FF, 0x94FF, 0x47F7, 0x06FF, 0x26FF, 0x05F7, 0xC5FE, 0xE5FE,
+  0x03D6, 0xC372, 0x02DE, 0x82FE, 0x82F6, 0xA2F6, 0xC2C4, 0x6120,
+  0x4118, 0x2008, 0x0008, 0x2008, 0x0000, 0x0000, 0x0000, 0x5004,
+  0x0029, 0x2000, 0x0000, 0x2008, 0x0008, 0x2008, 0x2010, 0x4118,
+  0x6118, 0x8149, 0xA2FE, 0xC2FE, 0xC3FE, 0xC3F6, 0xC4FE, 0xE5F6,
+  0x05FF, 0x26F7, 0x4CFF, 0x95FF, 0xD4FF, 0x8CF7, 0x46FF, 0x46FF,
+  0x06F7, 0x05FF, 0xE5F6, 0xC5FE, 0xC4F6, 0xA4F6, 0xA2FE, 0x82F6,
+  0x82F6, 0xC2BC, 0x8118, 0x2110, 0x2010, 0x0008, 0x2000, 0x0000,
+  0x0000, 0x0000, 0x5104, 0x002A, 0x2000, 0x0000, 0x2000, 0x0008,
+  0x2008, 0x2010, 0x6118, 0x6120, 0xA130, 0x43EE, 0xA2F6, 0xC3FE,
+  0xC4F6, 0xC5FE, 0x05F7, 0x26F7, 0x06FF, 0xAFF7, 0xD5FF, 0xB5FF,
+  0xD4FF, 0x69FF, 0x47FF, 0x07F7, 0x26FF, 0x05F7, 0xE5F6, 0xE5FE,
+  0xC4F6, 0xC3FE, 0xC2F6, 0xC2FE, 0x63D5, 0x8120, 0x8010, 0x4008,
+  0x2008, 0x2008, 0x2000, 0x0000, 0x0000, 0x0000, 0x5204, 0x0029,
+  0x0000, 0x2000, 0x0008, 0x2008, 0x2008, 0x4118, 0x6120, 0x8120,
+  0xE128, 0xC2C4, 0xC3FE, 0xC3FE, 0xC4F6, 0x05FF, 0x05F7, 0x26FF,
+  0x46FF, 0xAFFF, 0xD5FF, 0xB5FF, 0xD5FF, 0xB2F7, 0x48FF, 0x47FF,
+  0x07F7, 0x27FF, 0x26F7, 0xC5FE, 0xE5F6, 0xC4F6, 0xC3FE, 0xA2F6,
+  0x43CD, 0xC118, 0x8118, 0x4118, 0x2008, 0x2008, 0x2000, 0x0000,
+  0x0000, 0x5306, 0x0028, 0x2000, 0x0008, 0x2010, 0x4118, 0x6118,
+  0x8128, 0xC128, 0xA372, 0xC3FE, 0xC4F6, 0xE4FE, 0x05F7, 0x26FF,
+  0x47F7, 0x47FF, 0xAFFF, 0xB5FF, 0xD5FF, 0xB6FF, 0xD5FF, 0xD2FF,
+  0x49F7, 0x47FF, 0x27FF, 0x07F7, 0x06FF, 0x05F7, 0xE5FE, 0xE4F6,
+  0xC3FE, 0x03DE, 0xE128, 0x8120, 0x8010, 0x4008, 0x4008, 0x2008,
+  0x2000, 0x0000, 0x0000, 0x5406, 0x0027, 0x0008, 0x2008, 0x2010,
+  0x4118, 0x6120, 0xA128, 0xE230, 0x2249, 0x22E6, 0x04FF, 0x05F7,
+  0x26FF, 0x06FF, 0x4AF7, 0x48FF, 0xB0FF, 0xD5FF, 0xD6FF, 0xB6FF,
+  0xD5FF, 0xB5FF, 0xB0FF, 0x48F7, 0x48FF, 0x07FF, 0x27F7, 0x26FF,
+  0x05F7, 0xE4FE, 0xC4F6, 0x03D6, 0xC120, 0xC118, 0x8018, 0x8010,
+  0x4008, 0x2000, 0x2008, 0x0000, 0x5504, 0x002A, 0x2000, 0x0000,
+  0x2000, 0x0008, 0x2010, 0x4118, 0xA118, 0xA130, 0x0131, 0x2241,
+  0xA372, 0x03D6, 0x05F7, 0x26FF, 0x47F7, 0xB0FF, 0x48FF, 0xB2FF,
+  0xB6FF, 0xD6FF, 0xB6FF, 0xD6FF, 0xB6FF, 0xD6FF, 0xB0FF, 0x48F7,
+  0x48FF, 0x27FF, 0x07F7, 0x05FF, 0x05F7, 0x04FF, 0x03DE, 0x2231,
+  0xC120, 0xA018, 0x8010, 0x4008, 0x4008, 0x2000, 0x2000, 0x0000,
+  0x5604, 0x0028, 0x0000, 0x2000, 0x0008, 0x2008, 0x2010, 0x4118,
+  0xA120, 0xE128, 0x0239, 0xA349, 0xC259, 0x8462, 0x26FF, 0x46FF,
+  0x6AFF, 0x94FF, 0x6AFF, 0xD6FF, 0xB6FF, 0xD6FF, 0xB7FF, 0xD7FF,
+  0xB7FF, 0xD6FF, 0xB6FF, 0x4CFF, 0x49F7, 0x48FF, 0x27FF, 0x07F7,
+  0x05F7, 0x05FF, 0xA3E6, 0x0229, 0x0121, 0xC118, 0xA018, 0x6010,
+  0x4008, 0x2000, 0x5709, 0x0024, 0x6118, 0xA120, 0xE128, 0x0239,
+  0x8341, 0xE349, 0x6383, 0x26FF, 0x47FF, 0x4CF7, 0xD5FF, 0x94FF,
+  0xB6FF, 0xD7FF, 0xB7FF, 0xD7FF, 0xD7F7, 0xD7FF, 0xD7FF, 0xD7FF,
+  0x94FF, 0x6AFF, 0x49FF, 0x48F7, 0x27FF, 0x26FF, 0x05FF, 0x04FF,
+  0x6252, 0x0121, 0xC120, 0xA018, 0x8010, 0x4008, 0x4008, 0x2008,
+  0x5809, 0x0025, 0x8120, 0xA118, 0xE128, 0x6239, 0x8349, 0x4452,
+  0x65B5, 0x46FF, 0x48FF, 0x8DFF, 0xB6FF, 0xD6FF, 0xB7FF, 0xD7FF,
+  0xD7FF, 0xD7FF, 0xD8FF, 0xD8FF, 0xD7FF, 0xD7FF, 0xB7F7, 0xB0FF,
+  0x4AFF, 0x69F7, 0x48FF, 0x07FF, 0x26F7, 0x05F7, 0xA4A4, 0x2229,
+  0xE120, 0xA018, 0x8010, 0x4008, 0x4008, 0x2000, 0x2000, 0x5905,
+  0x0029, 0x0000, 0x2008, 0x2008, 0x8010, 0x8118, 0xC120, 0xE128,
+  0x6231, 0x8341, 0x0452, 0xC5EE, 0x47FF, 0x48FF, 0x8DF7, 0xD6FF,
+  0xB7FF, 0xD7FF, 0xD8FF, 0xD8FF, 0xD8FF, 0xD8FF, 0xD8FF, 0xD8FF,
+  0xD8FF, 0xD7FF, 0xD6FF, 0x6AFF, 0x4AFF, 0x48F7, 0x47FF, 0x26FF,
+  0x26FF, 0x24F7, 0xE241, 0x0121, 0xC120, 0xA018, 0x8010, 0x4008,
+  0x4008, 0x2008, 0x5A04, 0x002A, 0x0000, 0x0000, 0x2008, 0x2008,
+  0x4118, 0xA120, 0xC118, 0x2231, 0x8239, 0xA349, 0x838B, 0x66FF,
+  0x48FF, 0x69FF, 0x8CFF, 0xD7FF, 0xD7FF, 0xD7FF, 0xD8FF, 0xD8FF,
+  0xD9FF, 0xD9FF, 0xF9FF, 0xD9FF, 0xD8FF, 0xD8FF, 0xD7FF, 0x8DF7,
+  0x6AFF, 0x49FF, 0x48FF, 0x47F7, 0x45FF, 0x44FF, 0xC47B, 0x2229,
+  0xC118, 0x8018, 0x8010, 0x4008, 0x4008, 0x2000, 0x5B04, 0x002A,
+  0x0000, 0x0000, 0x2000, 0x2008, 0x8010, 0x8120, 0xE128, 0x2229,
+  0x8239, 0xE341, 0x45B5, 0x47FF, 0x48F7, 0x49FF, 0x8CFF, 0xD7FF,
+  0xD7FF, 0xD8FF, 0xF9FF, 0xD9FF, 0xFAFF, 0xDAFF, 0xFAFF, 0xDAFF,
+  0xF9FF, 0xD9FF, 0xD7FF, 0x8DF7, 0x8CFF, 0x4AFF, 0x69FF, 0x47FF,
+  0x46FF, 0x45FF, 0xC5C5, 0x2231, 0xC120, 0xA018, 0x8010, 0x4008,
+  0x4008, 0x2000, 0x5C05, 0x0029, 0x0000, 0x2008, 0x2008, 0x8010,
+  0xA018, 0xE128, 0x2231, 0x8239, 0x445A, 0x45F7, 0x47FF, 0x48FF,
+  0x49FF, 0x8CF7, 0xD7FF, 0xD8FF, 0xD8FF, 0xF9FF, 0xDAFF, 0xFBFF,
+  0xDBFF, 0xFBFF, 0xDBFF, 0xFAFF, 0xD9FF, 0xD5FF, 0xAFFF, 0x8CFF,
+  0x8BFF, 0x69F7, 0x48FF, 0x46FF, 0x45F7, 0xC3EE, 0x0229, 0x0121,
+  0xC120, 0xA018, 0x6010, 0x4000, 0x2000, 0x5D04, 0x002B, 0x0000,
+  0x2000, 0x2000, 0x4008, 0x8010, 0x8118, 0xC128, 0x2229, 0x8239,
+  0x03B5, 0x46FF, 0x47FF, 0x88F7, 0xAAFF, 0x8DFF, 0xD7F7, 0xD8FF,
+  0xF9FF, 0xDAFF, 0xDBFF, 0xFCFF, 0xDCFF, 0xFCFF, 0xFCFF, 0xDBFF,
+  0xDAFF, 0xD5FF, 0xAFFF, 0x8DFF, 0x8CFF, 0x69FF, 0x48FF, 0x47FF,
+  0x45FF, 0x44FF, 0x6231, 0x0129, 0xC120, 0xA018, 0x8010, 0x4008,
+  0x2000, 0x2008, 0x5E02, 0x002D, 0x0000, 0x0000, 0x2000, 0x0008,
+  0x2000, 0x6010, 0x8010, 0x8120, 0xE128, 0x2229, 0xA362, 0x45F7,
+  0x86FF, 0x88FF, 0x89FF, 0xAAFF, 0xAFFF, 0xD8FF, 0xD8FF, 0xD9FF,
+  0xFAFF, 0xFCFF, 0xFDFF, 0xFDFF, 0xFDFF, 0xFDFF, 0xDCFF, 0xDBFF,
+  0xD7FF, 0xB0FF, 0x8DF7, 0x8CFF, 0x89FF, 0x88F7, 0x66F7, 0x65FF,
+  0x44FF, 0x4231, 0x0121, 0xC118, 0xA018, 0x6010, 0x4008, 0x4008,
+  0x2000, 0x5F03, 0x002D, 0x0000, 0x2000, 0x2008, 0x2000, 0x4008,
+  0x8010, 0x8118, 0xC128, 0x2229, 0xA5C5, 0x65F7, 0x86FF, 0x88FF,
+  0x89F7, 0x8BFF, 0xB0FF, 0xD8FF, 0xF9FF, 0xDAFF, 0xDBFF, 0xFCFF,
+  0xFDFF, 0xFEFF, 0xFEFF, 0xFEFF, 0xFDFF, 0xFBFF, 0xDAFF, 0xD2FF,
+  0xAFFF, 0x8CF7, 0x8AFF, 0x89FF, 0x87F7, 0x46FF, 0x45FF, 0x6231,
+  0x0129, 0xC120, 0xA018, 0x8010, 0x4008, 0x4008, 0x2000, 0x2000,
+  0x6002, 0x002D, 0x0000, 0x0000, 0x0000, 0x2000, 0x2008, 0x6008,
+  0x8010, 0x8120, 0xE128, 0x8239, 0x64FF, 0x85FF, 0x66FF, 0x88FF,
+  0x89FF, 0xABFF, 0xB2FF, 0xD8FF, 0xF9FF, 0xDAFF, 0xFBFF, 0xFCFF,
+  0xFEFF, 0xFEFF, 0xFEFF, 0xFEFF, 0xFDFF, 0xDBFF, 0xDAFF, 0xD5FF,
+  0xAFFF, 0x8CF7, 0x8BFF, 0x89FF, 0x88F7, 0x86FF, 0xA5E6, 0x4231,
+  0x0121, 0xC118, 0xA018, 0x6010, 0x4008, 0x4008, 0x2000, 0x6103,
+  0x002D, 0x0000, 0x0000, 0x0000, 0x2000, 0x4008, 0x8010, 0xA010,
+  0xC128, 0x646B, 0x65FF, 0x65FF, 0x86FF, 0x88F7, 0x89FF, 0x8BFF,
+  0xD6FF, 0xD8FF, 0xD9FF, 0xFAFF, 0xDBFF, 0xFCFF, 0xFEFF, 0xFEFF,
+  0xFEFF, 0xFEFF, 0xFDFF, 0xDBFF, 0xFAFF, 0xD8FF, 0xB0FF, 0x8CF7,
+  0x8BFF, 0x89FF, 0x88FF, 0x86FF, 0x26CE, 0x6239, 0x0121, 0xC120,
+  0xA018, 0x8010, 0x4008, 0x4008, 0x2008, 0x2000, 0x6202, 0x002D,
+  0x0000, 0x0000, 0x0000, 0x2000, 0x2008, 0x4008, 0x8010, 0xA018,
+  0xE128, 0x03BD, 0x85FF, 0x86FF, 0x66F7, 0x88FF, 0x89FF, 0xAFFF,
+  0xD7FF, 0xD8FF, 0xD8FF, 0xDAFF, 0xFBFF, 0xFCFF, 0xFDFF, 0xFDFF,
+  0xFEFF, 0xFDFF, 0xDCFF, 0xDBFF, 0xFAFF, 0xD9FF, 0xD5FF, 0x8CF7,
+  0x8BFF, 0x89FF, 0x88FF, 0x86F7, 0x45B5, 0x6231, 0xE120, 0xC118,
+  0xA018, 0x8010, 0x4008, 0x4008, 0x2000, 0x6303, 0x002C, 0x0000,
+  0x0000, 0x0000, 0x2000, 0x2000, 0x8010, 0x8010, 0xA118, 0x03D6,
+  0x65FF, 0x86FF, 0x87FF, 0x88F7, 0x8AFF, 0xB5FF, 0xD7FF, 0xD8FF,
+  0xF8FF, 0xD9FF, 0xFAFF, 0xDBFF, 0xDCFF, 0xFCFF, 0xDCFF, 0xFCFF,
+  0xFBFF, 0xDAFF, 0xF9FF, 0xD8FF, 0xD8FF, 0xAFFF, 0x8BFF, 0x89FF,
+  0x88FF, 0x86FF, 0x6594, 0x2231, 0x0121, 0xC120, 0xA018, 0x8010,
+  0x4008, 0x2000, 0x2008, 0x6402, 0x002C, 0x0000, 0x0000, 0x0000,
+  0x2000, 0x2008, 0x4008, 0x4008, 0xA018, 0xC120, 0x45F7, 0x85FF,
+  0x66FF, 0x87FF, 0x88FF, 0xB0FF, 0xD6FF, 0xD7FF, 0xD7FF, 0xD8FF,
+  0xD9FF, 0xDAFF, 0xFAFF, 0xDBFF, 0xFBFF, 0xDBFF, 0xFBFF, 0xDBFF,
+  0xFAFF, 0xD9FF, 0xF8FF, 0xD7FF, 0xB2F7, 0xAAFF, 0x89FF, 0x88F7,
+  0x87FF, 0x6473, 0x2229, 0xE120, 0xA018, 0x8010, 0x6010, 0x4000,
+  0x2000, 0x6503, 0x002C, 0x0000, 0x0000, 0x0000, 0x2000, 0x4008,
+  0x4008, 0x6008, 0x2229, 0x65FF, 0x65FF, 0x66F7, 0x87FF, 0x88FF,
+  0xB2FF, 0xD6FF, 0xD7FF, 0xD7FF, 0xD8FF, 0xD8FF, 0xD9FF, 0xFAFF,
+  0xDAFF, 0xFAFF, 0xDAFF, 0xFAFF, 0xDAFF, 0xD9FF, 0xD8FF, 0xD8FF,
+  0xD7FF, 0xD6FF, 0xAAFF, 0x89FF, 0x88FF, 0x86FF, 0x6252, 0x2229,
+  0xC120, 0xA018, 0x8010, 0x4008, 0x4008, 0x2008, 0x2000, 0x6602,
+  0x002C, 0x0000, 0x0000, 0x0000, 0x0000, 0x2000, 0x4008, 0x4008,
+  0x8010, 0x8241, 0x85FF, 0x85FF, 0x66FF, 0x87FF, 0x88FF, 0xD5FF,
+  0xD6FF, 0xB7FF, 0xD7FF, 0xD7FF, 0xD8FF, 0xD8FF, 0xD9FF, 0xF9FF,
+  0xD9FF, 0xF9FF, 0xD9FF, 0xF9FF, 0xD8FF, 0xD8FF, 0xD7FF, 0xD7FF,
+  0xB6FF, 0x8BFF, 0x88F7, 0x88FF, 0x66F7, 0x6231, 0xE120, 0xC118,
+  0xA018, 0x8010, 0x4008, 0x4008, 0x2000, 0x6703, 0x002B, 0x0000,
+  0x0000, 0x0000, 0x2000, 0x2000, 0x4008, 0x6008, 0xC239, 0x65FF,
+  0x65FF, 0x66FF, 0x87F7, 0x88FF, 0xD5FF, 0xB6FF, 0xD6FF, 0xD7FF,
+  0xD7FF, 0xD8FF, 0xD8FF, 0xF8FF, 0xD8FF, 0xF9FF, 0xD9FF, 0xD8FF,
+  0xD8FF, 0xD8FF, 0xD7FF, 0xD7FF, 0xD7FF, 0xD6FF, 0x8AFF, 0x88FF,
+  0xA7FF, 0x26CE, 0x2229, 0x0129, 0xC120, 0xA018, 0x8010, 0x4008,
+  0x4008, 0x2000, 0x6803, 0x002B, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x2008, 0x4008, 0x4008, 0x6239, 0x85FF, 0x85FF, 0x66FF, 0x87FF,
+  0x89FF, 0xD6FF, 0xD6FF, 0xD6FF, 0xD7FF, 0xD7FF, 0xD7FF, 0xD7F7,
+  0xD8FF, 0xD8FF, 0xD8FF, 0xD8FF, 0xD8FF, 0xD8FF, 0xD7FF, 0xD7FF,
+  0xD7FF, 0xB6FF, 0xD5FF, 0x89FF, 0x88F7, 0x87FF, 0xA49C, 0xE120,
+  0xC120, 0xA010, 0x6010, 0x4008, 0x4008, 0x2000, 0x2008, 0x6902,
+  0x002D, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2000, 0x2000,
+  0x4008, 0xC118, 0x65FF, 0x66FF, 0x66F7, 0x87FF, 0x88FF, 0xD5FF,
+  0xB5FF, 0xD6FF, 0xB6FF, 0xD6FF, 0xD7F7, 0xD7FF, 0xD7FF, 0xD7FF,
+  0xD7F7, 0xD7FF, 0xD7FF, 0xD7FF, 0xD7FF, 0xB7FF, 0xD6FF, 0xD6FF,
+  0xB2FF, 0xA8FF, 0x88FF, 0xA7FF, 0x236B, 0x0129, 0xC120, 0xA018,
+  0x8010, 0x4008, 0x4008, 0x2000, 0x0000, 0x2000, 0x6A04, 0x0029,
+  0x0000, 0x0000, 0x2000, 0x2008, 0x2000, 0x4008, 0x4008, 0x45F7,
+  0x86FF, 0x87FF, 0x87FF, 0x87FF, 0xD4FF, 0xB5FF, 0xD5FF, 0xB6FF,
+  0xD6FF, 0xD6FF, 0xD7FF, 0xF7FF, 0xD7FF, 0xD7F7, 0xD7FF, 0xF7FF,
+  0xD7FF, 0xD7FF, 0xD6FF, 0xD6FF, 0xD6FF, 0xAFF7, 0x88FF, 0x87FF,
+  0x67F7, 0x0229, 0xC118, 0xA010, 0x6010, 0x8010, 0x2008, 0x4008,
+  0x2000, 0x6B04, 0x0027, 0x0000, 0x0000, 0x0000, 0x0000, 0x2000,
+  0x2000, 0x4008, 0x26C6, 0x66FF, 0x87F7, 0x87FF, 0x87FF, 0xB2F7,
+  0xD5FF, 0xB5FF, 0xD6FF, 0xD6FF, 0xD6FF, 0xB6FF, 0xD6FF, 0xF7FF,
+  0xD7FF, 0xD7FF, 0xD7FF, 0xD6FF, 0xD6FF, 0xB6FF, 0xD6FF, 0xD6FF,
+  0x8BFF, 0xA8FF, 0xA7FF, 0x26CE, 0xC120, 0xA018, 0xA018, 0x8010,
+  0x4008, 0x4008, 0x6C04, 0x0023, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x2000, 0x2008, 0x4008, 0xC4A4, 0x87FF, 0x87FF, 0x87FF, 0x87FF,
+  0xB0FF, 0xD5FF, 0xD5FF, 0xB6FF, 0xD6FF, 0xD6FF, 0xD6FF, 0xF6FF,
+  0xD6FF, 0xF6FF, 0xD6FF, 0xF6FF, 0xD6FF, 0xF6FF, 0xD6FF, 0xD6FF,
+  0xB2FF, 0xA8FF, 0xA7F7, 0x87FF, 0xC47B, 0xC118, 0xA018, 0x6C2C,
+  0x0001, 0x2000, 0x6D04, 0x0026, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x2000, 0x0000, 0xA35A, 0x87F7, 0x87FF, 0x87FF, 0xA7FF,
+  0xADFF, 0xD5FF, 0xB5FF, 0xD6FF, 0xD6FF, 0xD6FF, 0xF6FF, 0xD6FF,
+  0xF6FF, 0xD6FF, 0xF6FF, 0xD6FF, 0xF6FF, 0xD6FF, 0xB6FF, 0xD6FF,
+  0xCDFF, 0xA8FF, 0xA7FF, 0xC7FF, 0xE241, 0xA018, 0x6010, 0x8010,
+  0x4008, 0x4008, 0x6E05, 0x0026, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x2008, 0x2000, 0xA018, 0x86FF, 0x87FF, 0xA7FF, 0xA7FF, 0xA8FF,
+  0xD4FF, 0xD5FF, 0xD6FF, 0xD6FF, 0xB6FF, 0xD4F7, 0xCBFF, 0xB0FF,
+  0xB6FF, 0xD6FF, 0xB6FF, 0xD6FF, 0xB6FF, 0xD6FF, 0xB4FF, 0xA8F7,
+  0xA8FF, 0xA7FF, 0x26C6, 0x8010, 0x6008, 0x6010, 0x4008, 0x4008,
+  0x2000, 0x2008, 0x6F04, 0x0026, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x2000, 0x658C, 0x87FF, 0xA7F7, 0xA7FF,
+  0xA7FF, 0xADFF, 0xB5FF, 0xD5FF, 0xF6FF, 0xD6FF, 0xADF7, 0xC9FF,
+  0xC9FF, 0xB2FF, 0xB6FF, 0xD6FF, 0xB6FF, 0xD5FF, 0xF6FF, 0xADFF,
+  0xA8FF, 0xA7FF, 0xC7FF, 0x847B, 0x6010, 0x8010, 0x4008, 0x4008,
+  0x2008, 0x2000, 0x7006, 0x0022, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x2000, 0x2000, 0x0129, 0x67F7, 0xA7FF, 0xA7FF, 0xA7FF, 0xA8FF,
+  0xB0FF, 0xD5FF, 0xD5FF, 0xB2FF, 0xC9F7, 0xA8FF, 0xA9FF, 0xACFF,
+  0xD6FF, 0xD6FF, 0xF6FF, 0xD6FF, 0xD2F7, 0xA8FF, 0xA8FF, 0xA8FF,
+  0x47EF, 0xA118, 0x6008, 0x4008, 0x4008, 0x4000, 0x7107, 0x0020,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2000, 0x424A, 0x87F7,
+  0xA7FF, 0xA7FF, 0xA8F7, 0xA8FF, 0xCBFF, 0xADFF, 0xC9FF, 0x88F7,
+  0xC483, 0x28E7, 0xA9FF, 0xD5FF, 0xF6FF, 0xD6FF, 0xD5FF, 0xCBFF,
+  0xA8FF, 0xA8FF, 0xC8FF, 0x647B, 0x8010, 0x4008, 0x4008, 0x2000,
+  0x7207, 0x0021, 0x0000, 0x0000, 0x0000, 0x0000, 0x2000, 0x2000,
+  0x2000, 0x236B, 0xC7FF, 0xA8FF, 0xA8FF, 0xA8FF, 0xA8FF, 0xA8FF,
+  0xA8FF, 0x45B5, 0xC118, 0x6473, 0xC8FF, 0xB2FF, 0xF6FF, 0xD6FF,
+  0xAFFF, 0xA8FF, 0xA8FF, 0xA8FF, 0x68CE, 0x6008, 0x4008, 0x2000,
+  0x2000, 0x2008, 0x0000, 0x7308, 0x001F, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x2000, 0x0000, 0x0000, 0x4252, 0x28E7, 0xA8FF, 0xA8FF,
+  0xA8FF, 0xA8FF, 0xC8FF, 0x6252, 0xA010, 0xA118, 0x28E7, 0xAFFF,
+  0xD6FF, 0xB0F7, 0xC9FF, 0xA8FF, 0xA8FF, 0xA8FF, 0xE241, 0x4008,
+  0x4008, 0x2008, 0x2000, 0x0000, 0x7407, 0x001F, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2000, 0x0000, 0x0129,
+  0x46CE, 0xA8FF, 0xC9FF, 0xC9FF, 0x08E7, 0x6008, 0x6010, 0x6010,
+  0xC4A4, 0xC9FF, 0xCAFF, 0xC9FF, 0xC9FF, 0xA9FF, 0x88F7, 0x0363,
+  0x2000, 0x2000, 0x2000, 0x2008, 0x0000, 0x750A, 0x001D, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2000, 0x2000, 0xA35A,
+  0x68D6, 0xC9FF, 0xC4A4, 0x4008, 0x4008, 0x4008, 0x424A, 0xC9FF,
+  0xA9FF, 0xC9FF, 0xC9FF, 0xA8FF, 0x236B, 0x4008, 0x2008, 0x2000,
+  0x0000, 0x2000, 0x0000, 0x0000, 0x760A, 0x001B, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x2000, 0x0000, 0x2000, 0x2008, 0x4008,
+  0x6252, 0xE241, 0x2008, 0x4000, 0x2008, 0x4008, 0x88D6, 0xC9FF,
+  0xC9FF, 0xA5C5, 0x4231, 0x2000, 0x2000, 0x0000, 0x0000, 0x2000,
+  0x0000, 0x770C, 0x0019, 0x0000, 0x0000, 0x0000, 0x0000, 0x2000,
+  0x0000, 0x2000, 0x0000, 0x2000, 0x2008, 0x2000, 0x2008, 0x2000,
+  0x2008, 0x8010, 0x8239, 0xC120, 0x2000, 0x2008, 0x2000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x780D, 0x0014, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x2000, 0x0000, 0x2000, 0x0000, 0x2000, 0x0008,
+  0x2000, 0x0000, 0x2000, 0x0008, 0x2000, 0x2008, 0x0000, 0x2000,
+  0x0000, 0x0000, 0x790F, 0x0013, 0x0000, 0x0000, 0x0000, 0x2000,
+  0x0000, 0x2000, 0x0000, 0x2000, 0x0000, 0x2000, 0x0000, 0x2000,
+  0x0000, 0x2000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7A0F,
+  0x0011, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2000, 0x0000,
+  0x2000, 0x0000, 0x2000, 0x0000, 0x2000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x7B12, 0x000B, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0016,
+  0x0006, 0x0000, 0xA128, 0xA028, 0x0000, 0x0000, 0x0000, 0x0115,
+  0x0006, 0x0000, 0xE240, 0xA2D2, 0xA2DA, 0x4118, 0x0000, 0x0214,
+  0x0008, 0x0000, 0x0000, 0x82AA, 0xA2D2, 0x82D2, 0xA161, 0x0000,
+  0x0000, 0x0315, 0x0007, 0x0000, 0xA169, 0xA2D2, 0xA2D2, 0xE291,
+  0x2000, 0x0000, 0x0415, 0x0007, 0x0000, 0x0000, 0xA028, 0x2141,
+  0x2010, 0x0000, 0x0000, 0x0517, 0x0004, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0617, 0x0004, 0x0000, 0x0000, 0x0000, 0x0000, 0x0718,
+  0x0002, 0x0000, 0x0000, 0x0818, 0x0001, 0x0000, 0x0916, 0x0003,
+  0x0000, 0x0000, 0x0000, 0x0A15, 0x0005, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0B13, 0x000B, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0C12,
+  0x000D, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0D12, 0x000C,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0E10, 0x0010, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0F0F, 0x0011,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x1010, 0x0011, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x110F, 0x0012, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x120D, 0x0015, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x2000, 0x0000, 0x2000, 0x0000, 0x2000,
+  0x0000, 0x2000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x130E,
+  0x0015, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x2000, 0x0000, 0x2000, 0x0000, 0x2000, 0x0000, 0x2000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x140D, 0x0016,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2000, 0x0000,
+  0x2000, 0x0000, 0x2000, 0x0008, 0x2008, 0x0000, 0x2000, 0x0000,
+  0x2000, 0x0000, 0x2000, 0x0000, 0x0000, 0x0000, 0x150C, 0x0018,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2000,
+  0x0000, 0x2000, 0x0008, 0x2000, 0x0008, 0x2000, 0x0008, 0x2000,
+  0x0008, 0x2000, 0x0008, 0x2000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x160D, 0x0017, 0x0000, 0x0000, 0x0000, 0x0000, 0x2000, 0x0000,
+  0x2008, 0x0008, 0x2000, 0x0008, 0x2008, 0x0008, 0x2000, 0x0008,
+  0x2008, 0x0008, 0x2000, 0x0008, 0x2000, 0x0000, 0x2000, 0x0000,
+  0x0000, 0x170B, 0x0019, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x2000, 0x0000, 0x2000, 0x0008, 0x2000, 0x0008, 0x2008, 0x2010,
+  0x2008, 0x2008, 0x2008, 0x2008, 0x0008, 0x2008, 0x0000, 0x2008,
+  0x0000, 0x2000, 0x0000, 0x0000, 0x180C, 0x0019, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x2000, 0x0008, 0x2008, 0x0000, 0x2008,
+  0x2010, 0x2010, 0x2010, 0x2010, 0x2010, 0x2010, 0x2008, 0x2010,
+  0x2008, 0x0000, 0x2008, 0x0000, 0x2000, 0x0000, 0x0000, 0x190C,
+  0x0018, 0x0000, 0x0000, 0x0000, 0x0000, 0x2000, 0x0008, 0x2008,
+  0x2008, 0x2008, 0x2010, 0x2010, 0x4118, 0x4110, 0x4118, 0x4118,
+  0x2010, 0x2010, 0x2010, 0x2008, 0x0008, 0x2008, 0x0000, 0x2000,
+  0x0000, 0x1A0A, 0x001B, 0x0000, 0x0000, 0x0000, 0x0000, 0x2000,
+  0x0000, 0x2000, 0x0008, 0x2008, 0x2008, 0x2010, 0x4118, 0x4118,
+  0x217A, 0x8292, 0xA169, 0x6118, 0x4110, 0x4118, 0x2010, 0x2010,
+  0x2008, 0x0008, 0x2008, 0x0000, 0x2000, 0x0000, 0x1B0A, 0x001C,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x2000, 0x0000, 0x2000, 0x0008,
+  0x2008, 0x2010, 0x4118, 0x4118, 0x6118, 0x6120, 0x22B3, 0xC1E3,
+  0x22BB, 0x8120, 0x6120, 0x4110, 0x2010, 0x2010, 0x2008, 0x0008,
+  0x2008, 0x0000, 0x0000, 0x0000, 0x1C0B, 0x001B, 0x0000, 0x0000,
+  0x0000, 0x2000, 0x0008, 0x2008, 0x2008, 0x2010, 0x4118, 0x4118,
+  0x6120, 0x8120, 0x6120, 0xE240, 0xE3EB, 0xE3E3, 0x62AA, 0x6118,
+  0x6120, 0x4110, 0x2010, 0x2010, 0x0008, 0x2000, 0x0000, 0x2000,
+  0x0000, 0x1D0A, 0x0018, 0x0000, 0x0000, 0x0000, 0x0000, 0x2000,
+  0x0000, 0x0008, 0x2010, 0x2010, 0x4110, 0x6120, 0x8120, 0x8128,
+  0xA120, 0xA128, 0xA2CB, 0x23EC, 0x23EC, 0xA169, 0x8120, 0x6120,
+  0x4118, 0x2010, 0x2008, 0x1E0B, 0x001B, 0x0000, 0x0000, 0x2000,
+  0x0000, 0x2008, 0x2010, 0x2010, 0x4118, 0x6118, 0x8128, 0x8128,
+  0xA128, 0xC130, 0xE238, 0x22B3, 0x43EC, 0x23EC, 0xA2CB, 0xA128,
+  0x6118, 0x6120, 0x4110, 0x2010, 0x0008, 0x0000, 0x2000, 0x0000,
+  0x1F09, 0x0019, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2008,
+  0x0008, 0x2010, 0x4110, 0x4118, 0x6120, 0xA128, 0xC130, 0xE230,
+  0x0239, 0x0239, 0x22B3, 0x23EC, 0x23EC, 0x23EC, 0x217A, 0x8120,
+  0x6120, 0x4118, 0x2010, 0x200A, 0x001B, 0x0000, 0x0000, 0x2000,
+  0x0000, 0x2008, 0x2008, 0x2010, 0x4118, 0x6118, 0xA128, 0xA130,
+  0xE238, 0x0239, 0x4241, 0x4249, 0xA2CB, 0x63EC, 0x63EC, 0x23EC,
+  0x82CB, 0xA128, 0x8120, 0x6118, 0x4118, 0x2010, 0x0008, 0x0000,
+  0x210A, 0x0015, 0x0000, 0x0000, 0x2000, 0x0000, 0x0008, 0x2008,
+  0x2010, 0x4118, 0x8120, 0xA128, 0xC130, 0x0239, 0x2241, 0x6249,
+  0x6249, 0x23EC, 0x63EC, 0x63EC, 0x63F4, 0x43EC, 0xA169, 0x2208,
+  0x001F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2008, 0x0008,
+  0x2010, 0x4110, 0x6120, 0x8120, 0xC130, 0xE238, 0x4241, 0x6251,
+  0xA259, 0x2362, 0xC2F4, 0xC2EC, 0xC2EC, 0x63EC, 0x63EC, 0x02B3,
+  0xA128, 0x8120, 0x4110, 0x2010, 0x2008, 0x0008, 0x0000, 0x2000,
+  0x2309, 0x001E, 0x0000, 0x0000, 0x0000, 0x2000, 0x0000, 0x0008,
+  0x2010, 0x4110, 0x6120, 0xA128, 0xE238, 0x0239, 0x6249, 0xA251,
+  0x2362, 0x2393, 0x03F5, 0x03ED, 0xC4EC, 0xC2F4, 0x83EC, 0x23EC,
+  0xE238, 0x8128, 0x6118, 0x4118, 0x2008, 0x0008, 0x2008, 0x0000,
+  0x2408, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2008,
+  0x2008, 0x2010, 0x4118, 0x8128, 0xA128, 0xE238, 0x4241, 0xA259,
+  0x2362, 0x2362, 0xC3DC, 0x03F5, 0x03F5, 0x03ED, 0xC2EC, 0xC2F4,
+  0x63EC, 0xA161, 0x8128, 0x6118, 0x4110, 0x2010, 0x0008, 0x0008,
+  0x2000, 0x0000, 0x2509, 0x001E, 0x0000, 0x0000, 0x0000, 0x2000,
+  0x0008, 0x2008, 0x2010, 0x6120, 0x8120, 0xC130, 0x0239, 0x6249,
+  0xA251, 0x2362, 0x0393, 0x44F5, 0x44ED, 0x83F5, 0x46F6, 0x03ED,
+  0xC2F4, 0xC2F4, 0x019B, 0xA130, 0x8120, 0x4118, 0x2010, 0x0008,
+  0x2000, 0x0000, 0x2608, 0x001F, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x2008, 0x2008, 0x4118, 0x6118, 0xA128, 0xC130, 0x2249,
+  0x6251, 0x2362, 0x826A, 0xC3DC, 0x83F5, 0xC4F5, 0x05F6, 0xC9FE,
+  0x05F6, 0x03ED, 0xA2EC, 0x82CB, 0xA128, 0x8120, 0x4110, 0x2010,
+  0x2008, 0x0008, 0x0000, 0x2708, 0x0020, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x2000, 0x0008, 0x2008, 0x4110, 0x6120, 0x8128, 0xE230,
+  0x4241, 0xA251, 0x2362, 0xE2BB, 0xC4F5, 0xC4F5, 0xE5F5, 0xC9F6,
+  0xC9FE, 0xA9F6, 0x03ED, 0xC2F4, 0xA2EC, 0xC130, 0x8128, 0x4118,
+  0x2010, 0x2008, 0x0000, 0x2000, 0x0000, 0x2809, 0x001F, 0x0000,
+  0x0000, 0x2000, 0x0008, 0x2008, 0x2010, 0x4110, 0x6120, 0xA128,
+  0xE238, 0x4241, 0x2362, 0xC3DC, 0x83F5, 0xC4F5, 0x24FE, 0x08FF,
+  0x09F7, 0xC9F6, 0xC9FE, 0xC4F5, 0xC2EC, 0xA2EC, 0x6249, 0x6120,
+  0x6118, 0x2010, 0x2008, 0x0008, 0x0000, 0x0000, 0x2909, 0x001E,
+  0x0000, 0x0000, 0x2000, 0x0000, 0x0008, 0x2010, 0x4118, 0x8120,
+  0xC128, 0x0239, 0xA251, 0xA3D4, 0x43F5, 0xA3F5, 0x04F6, 0xE8F6,
+  0x6AFF, 0x09FF, 0x29FF, 0xC9F6, 0x46F6, 0x03F5, 0xC2F4, 0x217A,
+  0xA128, 0x6120, 0x2010, 0x2008, 0x0008, 0x2000, 0x2A08, 0x0020,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x2008, 0x0008, 0x2010, 0x4110,
+  0x8128, 0xA128, 0x2239, 0x21CC, 0x03F5, 0x43F5, 0xC4F5, 0x66FE,
+  0x6AFF, 0x4AFF, 0x29F7, 0x09FF, 0xC9F6, 0xA9F6, 0x03F5, 0xA2EC,
+  0xE19A, 0x8120, 0x6118, 0x4118, 0x2008, 0x0008, 0x0000, 0x0000,
+  0x2B09, 0x001B, 0x0000, 0x0000, 0x0000, 0x2000, 0x0008, 0x2010,
+  0x4118, 0x6120, 0xA128, 0x4272, 0xC2EC, 0x03ED, 0x43F5, 0xC4F5,
+  0xA7F6, 0x4AFF, 0x6AFF, 0x09FF, 0xA9F6, 0xC9F6, 0xA9F6, 0x43F5,
+  0xC2F4, 0x81B3, 0xA128, 0x6120, 0x4118, 0x2C08, 0x001F, 0x0000,
+  0x0000, 0x0000, 0x2000, 0x0008, 0x2008, 0x2010, 0x4110, 0x8120,
+  0xA130, 0x21CC, 0x02F5, 0x02F5, 0x43F5, 0xC4F5, 0xC7F6, 0x4AFF,
+  0x08FF, 0x45F6, 0xE4F5, 0x46F6, 0xC9F6, 0x83F5, 0xC1EC, 0x82CB,
+  0x8120, 0x6118, 0x4118, 0x2008, 0x0008, 0x0000, 0x2D09, 0x001F,
+  0x0000, 0x0000, 0x2000, 0x0008, 0x0000, 0x2010, 0x4110, 0x8120,
+  0x4151, 0xC1F4, 0x02ED, 0x43F5, 0x43F5, 0xC3F5, 0x04F6, 0x85F6,
+  0x45F6, 0x24F6, 0xE3F5, 0xA3F5, 0xA7FE, 0xC4F5, 0xC1F4, 0x21CC,
+  0xA128, 0x6120, 0x4118, 0x2008, 0x0008, 0x2000, 0x0000, 0x2E08,
+  0x001F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2008, 0x2010,
+  0x4118, 0x8120, 0x8292, 0xC1F4, 0x02F5, 0x63F5, 0x43F5, 0xA3F5,
+  0x04F6, 0x24F6, 0x24F6, 0xE4F5, 0xC3F5, 0x83F5, 0x83F5, 0xE5F5,
+  0xC1EC, 0x01C4, 0x8128, 0x6118, 0x4118, 0x2008, 0x0000, 0x0000,
+  0x2F09, 0x001F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0008, 0x2010,
+  0x4110, 0x6120, 0x81AB, 0xC1EC, 0x02F5, 0x02ED, 0x43F5, 0x83F5,
+  0xC3F5, 0xE4FD, 0x04F6, 0xE3F5, 0xA3F5, 0x83F5, 0x63F5, 0x43F5,
+  0x02F5, 0x21CC, 0xA128, 0x6118, 0x4118, 0x2008, 0x0008, 0x2008,
+  0x0000, 0x3008, 0x001F, 0x0000, 0x0000, 0x0000, 0x2000, 0x0008,
+  0x2008, 0x2010, 0x4110, 0x6120, 0x21CC, 0xC1F4, 0x02F5, 0x02F5,
+  0x43F5, 0x83F5, 0xA3F5, 0xC3F5, 0xC4F5, 0xC3F5, 0xA3F5, 0x83F5,
+  0x63ED, 0x02F5, 0x02F5, 0xE2B3, 0x6120, 0x6118, 0x4118, 0x2008,
+  0x0000, 0x2008, 0x3108, 0x0021, 0x0000, 0x0000, 0x2000, 0x0000,
+  0x2000, 0x0008, 0x2010, 0x4110, 0x4118, 0x01C4, 0xC1F4, 0x02ED,
+  0x02F5, 0x63F5, 0x83F5, 0xA3DC, 0x43AC, 0xC39B, 0x2393, 0x02BC,
+  0x43F5, 0x63F5, 0x02F5, 0x02F5, 0x81B3, 0x8120, 0x6120, 0x4118,
+  0x2008, 0x0008, 0x2000, 0x0000, 0x2000, 0x3209, 0x001F, 0x0000,
+  0x0000, 0x2000, 0x0008, 0x2008, 0x2010, 0x4118, 0x6120, 0x21CC,
+  0xC1F4, 0x02F5, 0x02F5, 0x43ED, 0x81AB, 0x2362, 0x4272, 0x4272,
+  0x427A, 0x239B, 0x43F5, 0x42F5, 0x02F5, 0x02F5, 0x817A, 0x8120,
+  0x4110, 0x2010, 0x2008, 0x0000, 0x0008, 0x2000, 0x3308, 0x0021,
+  0x0000, 0x2000, 0x0000, 0x2000, 0x0000, 0x0008, 0x2010, 0x4110,
+  0x6118, 0x61AB, 0x02F5, 0x02F5, 0x02F5, 0x62D4, 0xA251, 0x2362,
+  0x2362, 0x2362, 0x2362, 0x2393, 0x43F5, 0x42F5, 0x02F5, 0x22FD,
+  0x2141, 0x8120, 0x4118, 0x2010, 0x2008, 0x0008, 0x2000, 0x0000,
+  0x2000, 0x3409, 0x0018, 0x0000, 0x2000, 0x0000, 0x2008, 0x0008,
+  0x2010, 0x4118, 0x6118, 0x627A, 0x02F5, 0x02F5, 0x02F5, 0x817A,
+  0x6251, 0xC251, 0xA259, 0xC251, 0xA259, 0x2393, 0x63F5, 0x42F5,
+  0x02F5, 0x81AB, 0x8128, 0x3426, 0x0003, 0x2008, 0x0000, 0x2000,
+  0x3508, 0x0021, 0x0000, 0x2000, 0x0000, 0x2000, 0x0008, 0x2008,
+  0x2010, 0x4118, 0x6118, 0xC230, 0xA1EC, 0x02F5, 0xC3DC, 0x2241,
+  0x6249, 0xC259, 0xA251, 0xC259, 0xA251, 0x61AB, 0x63F5, 0x42F5,
+  0xC3DC, 0x2241, 0xA128, 0x8128, 0x4110, 0x2010, 0x2008, 0x0008,
+  0x2008, 0x0000, 0x2000, 0x360A, 0x0020, 0x0000, 0x2008, 0x0008,
+  0x2008, 0x2010, 0x4110, 0x6120, 0x8120, 0x216A, 0x02BC, 0xA169,
+  0xE240, 0x6249, 0x6249, 0x6251, 0x6249, 0x6251, 0x02BC, 0x63F5,
+  0x03F5, 0xA251, 0xC130, 0x8128, 0x8120, 0x4110, 0x2010, 0x2008,
+  0x0008, 0x0008, 0x2000, 0x0000, 0x2000, 0x370A, 0x0021, 0x2000,
+  0x0008, 0x0008, 0x2008, 0x2010, 0x4118, 0x6118, 0x8120, 0xA128,
+  0xC130, 0xE240, 0xE240, 0x4241, 0x0162, 0xA169, 0x6249, 0x6249,
+  0xC3DC, 0x03F5, 0x627A, 0xE230, 0xA130, 0x8128, 0x8120, 0x4118,
+  0x2010, 0x2010, 0x2008, 0x2008, 0x0008, 0x2000, 0x0000, 0x2000,
+  0x3808, 0x0022, 0x2000, 0x0000, 0x2008, 0x0008, 0x2008, 0x2008,
+  0x2010, 0x4118, 0x6118, 0x8128, 0x8128, 0xC130, 0xE238, 0xE240,
+  0x4241, 0x02BC, 0x6249, 0x6251, 0xA251, 0x22E5, 0x0162, 0xE240,
+  0xE230, 0xC130, 0xA128, 0x6120, 0x4110, 0x4118, 0x2010, 0x2008,
+  0x0008, 0x2008, 0x0000, 0x2000, 0x3907, 0x0025, 0x2000, 0x0000,
+  0x2000, 0x0000, 0x0008, 0x2008, 0x2008, 0x2010, 0x4118, 0x6120,
+  0x8120, 0xA128, 0xC130, 0xE230, 0xE240, 0xA251, 0x63F5, 0x6251,
+  0x2241, 0xC251, 0x6251, 0x0241, 0xE240, 0xC130, 0xA128, 0xA128,
+  0x8120, 0x6120, 0x4118, 0x2010, 0x2008, 0x0008, 0x2008, 0x0008,
+  0x2000, 0x0000, 0x2000, 0x3A09, 0x0022, 0x0008, 0x2008, 0x0008,
+  0x2008, 0x2010, 0x2010, 0x4118, 0x6118, 0x8128, 0xA128, 0xC130,
+  0xE238, 0xE240, 0x81AB, 0x82F5, 0x2362, 0x2241, 0x2241, 0xE240,
+  0x0241, 0xE240, 0xC130, 0xC128, 0xA128, 0x6120, 0x6118, 0x4118,
+  0x2010, 0x2010, 0x2008, 0x0008, 0x2008, 0x0000, 0x2000, 0x3B0A,
+  0x0022, 0x2008, 0x0008, 0x2008, 0x2010, 0x4118, 0x4110, 0x6120,
+  0x6120, 0xA128, 0xC130, 0xE230, 0x2241, 0x42E5, 0x82F5, 0x239B,
+  0x2241, 0x4241, 0x0241, 0xE240, 0x0241, 0xE238, 0xA128, 0x8128,
+  0x8120, 0x6120, 0x4118, 0x2010, 0x2010, 0x2008, 0x2008, 0x0008,
+  0x2000, 0x0000, 0x2000, 0x3C06, 0x0026, 0x2000, 0x0000, 0x2000,
+  0x0008, 0x2008, 0x2008, 0x2010, 0x2010, 0x4118, 0x6120, 0x6118,
+  0xA128, 0x8128, 0xC130, 0xE238, 0x239B, 0x82F5, 0xA3F5, 0x22E5,
+  0x6249, 0x2241, 0x2241, 0xE240, 0x0241, 0xE230, 0xA128, 0xA128,
+  0x8120, 0x6120, 0x4118, 0x4110, 0x2010, 0x2010, 0x0008, 0x0008,
+  0x2000, 0x0000, 0x2000, 0x3D06, 0x0026, 0x2000, 0x0000, 0x2000,
+  0x0008, 0x0008, 0x2008, 0x2010, 0x4118, 0x4110, 0x6120, 0x8120,
+  0xA128, 0xA128, 0xC130, 0xE238, 0x22E5, 0xA2F5, 0xA2F5, 0xA2F5,
+  0x819B, 0x2249, 0x4241, 0x4241, 0xE240, 0xE238, 0xC130, 0x8128,
+  0x8120, 0x8120, 0x6120, 0x4118, 0x2010, 0x2010, 0x2008, 0x0008,
+  0x2008, 0x0000, 0x2000, 0x3E07, 0x0026, 0x2000, 0x0008, 0x2008,
+  0x2008, 0x2008, 0x2010, 0x4118, 0x4118, 0x6118, 0x8128, 0x8128,
+  0xC130, 0xE238, 0x2162, 0xA2FD, 0xA2F5, 0xA2F5, 0xC3F5, 0xA2F5,
+  0x218B, 0x2241, 0x4241, 0xE240, 0xE230, 0xC130, 0xA128, 0xA128,
+  0x8120, 0x6120, 0x4118, 0x4110, 0x2010, 0x2008, 0x0008, 0x0008,
+  0x2008, 0x0000, 0x2000, 0x3F06, 0x0026, 0x2000, 0x0000, 0x2008,
+  0x0008, 0x2008, 0x2010, 0x2010, 0x4118, 0x6118, 0x6120, 0xA128,
+  0xA130, 0xC130, 0xE230, 0xE2BB, 0xC2F5, 0xC3F5, 0xE2F5, 0xE3F5,
+  0xE2F5, 0xE2F5, 0x02BC, 0x6251, 0x4249, 0x0239, 0xE238, 0xC130,
+  0xA128, 0x8120, 0x6118, 0x6120, 0x4118, 0x2010, 0x2008, 0x0008,
+  0x2008, 0x0000, 0x2000, 0x4006, 0x0028, 0x2000, 0x0000, 0x2000,
+  0x0008, 0x2008, 0x2010, 0x4118, 0x4118, 0x6120, 0x8120, 0xA128,
+  0xC130, 0xE238, 0x0239, 0x62E5, 0xC2F5, 0xE2F5, 0xE3FD, 0xE3F5,
+  0xE3F5, 0xE3F5, 0xE3F5, 0x02DD, 0x6249, 0x0239, 0xE230, 0xC130,
+  0xA130, 0xA128, 0x8120, 0x6120, 0x4110, 0x2010, 0x2008, 0x2008,
+  0x0008, 0x0008, 0x2000, 0x0000, 0x2000, 0x4109, 0x0024, 0x0008,
+  0x2008, 0x2010, 0x4118, 0x4110, 0x6120, 0x8120, 0xA130, 0xC130,
+  0xC230, 0x0162, 0xE2F5, 0xE2F5, 0xE2F5, 0x03F6, 0x03F6, 0xE3F5,
+  0x03F6, 0x03F6, 0x02F6, 0xC3A3, 0x4241, 0x0239, 0xE238, 0xC130,
+  0xA128, 0x8120, 0x6120, 0x4118, 0x4110, 0x2010, 0x2008, 0x0008,
+  0x2008, 0x0000, 0x2000, 0x4205, 0x0005, 0x2000, 0x0008, 0x2008,
+  0x0008, 0x2000, 0x420F, 0x001F, 0x8128, 0xA130, 0xE230, 0x2239,
+  0x2193, 0x02F6, 0x02F6, 0x02FE, 0x03F6, 0x03F6, 0xE3F5, 0x03F6,
+  0x03F6, 0x02F6, 0xA2BC, 0x2241, 0x0239, 0xE230, 0xC130, 0xA130,
+  0x8120, 0x6120, 0x4110, 0x4118, 0x2010, 0x2008, 0x0008, 0x0000,
+  0x2000, 0x0000, 0x2000, 0x4306, 0x0027, 0x2000, 0x0000, 0x0008,
+  0x2010, 0x2008, 0x2010, 0x4110, 0x6120, 0x8120, 0xA128, 0xC130,
+  0xE238, 0x0239, 0x23AC, 0x03F6, 0x02F6, 0x03F6, 0x23F6, 0x03F6,
+  0x23FE, 0x23F6, 0x23F6, 0x02FE, 0xC39B, 0x6251, 0x4241, 0x0239,
+  0xE238, 0x819B, 0x2162, 0x8128, 0x6118, 0x4118, 0x2010, 0x2008,
+  0x0008, 0x2008, 0x0000, 0x2008, 0x4405, 0x0029, 0x2000, 0x0000,
+  0x2008, 0x0008, 0x2008, 0x2010, 0x4118, 0x4110, 0x6120, 0xC159,
+  0x2162, 0xE238, 0x0239, 0x4241, 0xC2C4, 0x23FE, 0x23F6, 0x43F6,
+  0x43F6, 0x43FE, 0x43F6, 0x43F6, 0x22F6, 0x03EE, 0x0362, 0x6249,
+  0x2241, 0x0239, 0xA272, 0xE2F5, 0x218B, 0x6120, 0x6118, 0x4118,
+  0x2010, 0x2010, 0x2008, 0x0008, 0x2008, 0x0000, 0x2000, 0x4506,
+  0x0027, 0x2000, 0x0008, 0x0008, 0x2008, 0x2010, 0x4110, 0x6118,
+  0x43AC, 0xE2F5, 0xE2F5, 0xC2C4, 0x2241, 0x2241, 0xA2BC, 0x03FE,
+  0x43F6, 0x43F6, 0x43F6, 0x64FE, 0x64F6, 0x64F6, 0x43FE, 0x838B,
+  0xC259, 0xA251, 0x6249, 0x2241, 0x218B, 0x02FE, 0x8272, 0x8120,
+  0x6120, 0x4110, 0x2010, 0x2010, 0x2008, 0x2008, 0x0008, 0x2000,
+  0x4604, 0x0029, 0x2000, 0x0000, 0x2000, 0x0008, 0x2008, 0x2008,
+  0x2010, 0x4118, 0xC159, 0x02F6, 0x02F6, 0x02F6, 0xE2F5, 0x819B,
+  0x6249, 0x43B4, 0x43F6, 0x43FE, 0x64F6, 0x64F6, 0x44F6, 0x64FE,
+  0x44F6, 0x43CD, 0x2362, 0x2362, 0xA251, 0x6249, 0x2241, 0x2383,
+  0x02FE, 0xC151, 0x8128, 0x6118, 0x6120, 0x4118, 0x2010, 0x2008,
+  0x0008, 0x0000, 0x2000, 0x4707, 0x0027, 0x2008, 0x0008, 0x2008,
+  0x2008, 0x2110, 0x218B, 0xE2F5, 0x02F6, 0xE2F5, 0x02FE, 0x63CD,
+  0x6249, 0x0383, 0x43F6, 0x44FE, 0x64F6, 0x83F6, 0x84F6, 0x84F6,
+  0xA4FE, 0xC3A3, 0x2362, 0x2362, 0xA251, 0xC259, 0x6249, 0xA251,
+  0xA2E5, 0xE238, 0xA128, 0x8120, 0x6120, 0x4118, 0x2010, 0x2008,
+  0x0008, 0x2008, 0x0000, 0x2000, 0x4804, 0x002A, 0x2000, 0x0000,
+  0x2000, 0x0008, 0x2010, 0x2010, 0x4118, 0x4110, 0x819B, 0x02FE,
+  0x42F6, 0x22F6, 0x42F6, 0x42E5, 0x4249, 0xA251, 0x43B4, 0x83FE,
+  0xA4F6, 0x84F6, 0x84FE, 0x84F6, 0x84F6, 0x43AC, 0x826A, 0x0362,
+  0x2362, 0xA251, 0x6251, 0x4241, 0x0239, 0xC130, 0xA128, 0x6120,
+  0x6120, 0x4110, 0x2010, 0x2008, 0x0008, 0x2008, 0x0000, 0x2000,
+  0x4904, 0x002B, 0x2000, 0x0000, 0x2000, 0x0008, 0x0008, 0x2010,
+  0x4110, 0x4110, 0x619B, 0x22F6, 0x22F6, 0x22F6, 0x42F6, 0x63D5,
+  0xA251, 0x2362, 0xC372, 0x84F6, 0x84F6, 0xA4F6, 0xA4FE, 0xA4F6,
+  0xA4F6, 0xA4FE, 0x63D5, 0x2383, 0x2362, 0xC251, 0x8349, 0x4249,
+  0x0239, 0xE230, 0xA130, 0x8120, 0x6120, 0x4118, 0x2010, 0x2008,
+  0x2008, 0x0008, 0x2000, 0x0000, 0x2000, 0x4A05, 0x002A, 0x2000,
+  0x0008, 0x2008, 0x2008, 0x2010, 0x4118, 0x4118, 0x218B, 0x42FE,
+  0x63CD, 0xA2BC, 0x43FE, 0x43AC, 0xA251, 0x2362, 0xC39B, 0xA4FE,
+  0xA4FE, 0xC4F6, 0xE5FE, 0xC5F6, 0xC4FE, 0xC4F6, 0xA4F6, 0x84FE,
+  0xA2DD, 0x43AC, 0x0383, 0x6249, 0x0239, 0xE238, 0xA128, 0x8120,
+  0x6120, 0x4110, 0x2010, 0x2008, 0x0008, 0x0008, 0x2000, 0x0000,
+  0x2000, 0x4B05, 0x0029, 0x2000, 0x0008, 0x0008, 0x2008, 0x2010,
+  0x4118, 0x6118, 0x826A, 0xC2BC, 0x0239, 0x0383, 0x62FE, 0x218B,
+  0xA251, 0x2362, 0x43CD, 0xA4F6, 0xC4FE, 0xC5F6, 0x05FF, 0x05F7,
+  0xE5FE, 0xC5F6, 0xC4FE, 0xA4F6, 0x84F6, 0x83FE, 0x83F6, 0x43F6,
+  0x43B4, 0x4241, 0xA130, 0xA128, 0x6118, 0x4118, 0x4118, 0x2010,
+  0x2008, 0x2008, 0x0008, 0x2000, 0x4C04, 0x002A, 0x2000, 0x0000,
+  0x2008, 0x0008, 0x2008, 0x2010, 0x4118, 0x6120, 0xE238, 0xC130,
+  0xE238, 0xC2C4, 0x43EE, 0x0162, 0x2362, 0xC372, 0xA4FE, 0xC4FE,
+  0xE5FE, 0x05F7, 0x05F7, 0x05FF, 0x05F7, 0x05FF, 0xE5FE, 0xC4F6,
+  0xA4F6, 0x84F6, 0x63FE, 0x83F6, 0x42F6, 0x43CD, 0x0131, 0x8128,
+  0x6118, 0x4118, 0x4118, 0x2010, 0x0008, 0x2008, 0x0000, 0x2000,
+  0x4D04, 0x002B, 0x2000, 0x0000, 0x2008, 0x0008, 0x2008, 0x2010,
+  0x4118, 0x6118, 0x6120, 0xA128, 0x2241, 0x43F6, 0xC2BC, 0xA251,
+  0x2362, 0x43CD, 0xC4FE, 0xC5F6, 0x05FF, 0x26F7, 0x06FF, 0x26F7,
+  0x06FF, 0x05F7, 0x05FF, 0xE5F6, 0xC4FE, 0xA4F6, 0x83F6, 0x83FE,
+  0x82F6, 0x62FE, 0x819B, 0x8128, 0x8120, 0x6120, 0x4118, 0x2010,
+  0x2008, 0x0008, 0x2000, 0x0000, 0x2000, 0x4E06, 0x0028, 0x2008,
+  0x0008, 0x2008, 0x2010, 0x4118, 0x6120, 0xA128, 0xC130, 0x218B,
+  0x63D5, 0x2362, 0xA251, 0x838B, 0xC4FE, 0xE5FE, 0x05F7, 0x05FF,
+  0x26F7, 0x46FF, 0x47FF, 0x46FF, 0x06F7, 0x05F7, 0x05FF, 0xE5FE,
+  0xA4F6, 0xA4F6, 0x63F6, 0x82F6, 0x82F6, 0xA2E5, 0xA128, 0x6120,
+  0x6118, 0x4118, 0x2010, 0x2008, 0x0008, 0x0000, 0x2000, 0x4F04,
+  0x002B, 0x2000, 0x0000, 0x2008, 0x0008, 0x2010, 0x2010, 0x4110,
+  0x6120, 0xA128, 0xE238, 0x2362, 0x8341, 0xA251, 0x0362, 0x02DE,
+  0xE5FE, 0xC5F6, 0x26FF, 0x06F7, 0x46FF, 0x8DFF, 0xAFFF, 0x46F7,
+  0x46FF, 0x26FF, 0x05F7, 0xE5FE, 0xC4F6, 0xA4FE, 0xA4F6, 0x83F6,
+  0x82FE, 0x82FE, 0x2162, 0x8120, 0x6120, 0x4118, 0x2010, 0x2008,
+  0x0008, 0x2008, 0x0000, 0x2000, 0x5003, 0x002C, 0x2000, 0x0000,
+  0x2000, 0x0008, 0x2008, 0x2010, 0x4110, 0x6120, 0x8120, 0xA130,
+  0xE230, 0x4249, 0x8349, 0xC251, 0x63D5, 0xE5FE, 0xE5FE, 0x05F7,
+  0x06FF, 0x46F7, 0x4AFF, 0xD4FF, 0xD4FF, 0x8CF7, 0x46FF, 0x06FF,
+  0x26F7, 0x05F7, 0xC5FE, 0xC4F6, 0xA4FE, 0xA2F6, 0xC2F6, 0x82F6,
+  0x619B, 0x6120, 0x6118, 0x4110, 0x2010, 0x2008, 0x0008, 0x2008,
+  0x0000, 0x2000, 0x5103, 0x002B, 0x2000, 0x0000, 0x2000, 0x0000,
+  0x0008, 0x2010, 0x4110, 0x6120, 0x8120, 0xC130, 0x0239, 0x2241,
+  0x8341, 0x43AC, 0xC5FE, 0xE5F6, 0x05FF, 0x26F7, 0x46FF, 0x47F7,
+  0xB2FF, 0xB5FF, 0xD5FF, 0xB4FF, 0x8DFF, 0x47FF, 0x26F7, 0x05FF,
+  0xC5F6, 0xE5FE, 0xC4F6, 0xC3FE, 0xC2FE, 0x82F6, 0xC2C4, 0xA128,
+  0x6118, 0x4118, 0x2010, 0x2008, 0x2008, 0x0008, 0x2000, 0x5204,
+  0x002B, 0x2000, 0x0000, 0x2008, 0x2008, 0x2010, 0x4118, 0x8120,
+  0xA128, 0xC130, 0x0239, 0xA349, 0x43B4, 0xE4FE, 0xE5FE, 0x05F7,
+  0x26FF, 0x07F7, 0x47FF, 0xAFFF, 0xD5FF, 0xB5FF, 0xD5FF, 0xB5FF,
+  0xD5FF, 0x94FF, 0xB0FF, 0x07F7, 0x05F7, 0x05FF, 0xE5F6, 0xA4F6,
+  0xC3FE, 0xA2F6, 0x63CD, 0x8128, 0x4118, 0x4110, 0x2010, 0x2008,
+  0x0008, 0x2008, 0x0000, 0x2000, 0x5303, 0x002B, 0x2000, 0x0000,
+  0x2000, 0x0008, 0x2008, 0x2010, 0x4110, 0xA120, 0xA128, 0xC230,
+  0x2362, 0x43CD, 0xC4F6, 0xC5FE, 0x05F7, 0x26FF, 0x27F7, 0x47FF,
+  0x4AFF, 0xB5FF, 0xD5FF, 0xB5FF, 0xD5FF, 0xB5FF, 0xD5FF, 0xB5F7,
+  0x95FF, 0xD2FF, 0x07FF, 0x05F7, 0xE5FE, 0xC4F6, 0xC3FE, 0xC2FE,
+  0xA2E5, 0xE128, 0x8120, 0x4118, 0x2010, 0x2008, 0x2008, 0x0008,
+  0x2000, 0x5404, 0x002B, 0x2000, 0x0000, 0x2008, 0x2008, 0x2010,
+  0x6120, 0x8120, 0xE128, 0xC159, 0x83F6, 0xE4FE, 0xE5F6, 0x05FF,
+  0x26F7, 0x07FF, 0x47FF, 0x49F7, 0xB4FF, 0xD5FF, 0xB5FF, 0xD6FF,
+  0xB5FF, 0xD5FF, 0xB5FF, 0xD5FF, 0x95FF, 0x95FF, 0x4EF7, 0x26FF,
+  0x05F7, 0xE4FE, 0xC4F6, 0xC3F6, 0x02E6, 0xC120, 0x8118, 0x6120,
+  0x4110, 0x2010, 0x0008, 0x2000, 0x0000, 0x2000, 0x5506, 0x0010,
+  0x2008, 0x2010, 0x4118, 0x8118, 0xC118, 0xC128, 0x43CD, 0xC4F6,
+  0xE4FE, 0x05F7, 0x26FF, 0x07F7, 0x47FF, 0x48F7, 0xB0FF, 0xB6FF,
+  0x551C, 0x0012, 0xD5FF, 0x95FF, 0xB5FF, 0x94FF, 0x27F7, 0x05FF,
+  0x05F7, 0x04FF, 0xC3FE, 0x03DE, 0xE128, 0xA118, 0x8120, 0x4118,
+  0x2010, 0x2008, 0x0008, 0x2000, 0x5603, 0x0015, 0x2000, 0x0000,
+  0x2008, 0x2008, 0x2010, 0x4118, 0x8120, 0xC120, 0xC159, 0xE3FE,
+  0x04FF, 0x05F7, 0x26FF, 0x07F7, 0x47FF, 0x48FF, 0x8DFF, 0xD6FF,
+  0xD6FF, 0xB6FF, 0xD7FF, 0x561D, 0x0011, 0xB6FF, 0x96FF, 0x95FF,
+  0x4EF7, 0x26F7, 0x05FF, 0xE4F6, 0x04FF, 0x43CD, 0xC120, 0xC118,
+  0x8120, 0x4110, 0x2010, 0x2008, 0x0008, 0x2000, 0x5704, 0x002B,
+  0x2000, 0x0000, 0x2008, 0x2010, 0x8010, 0x8118, 0xC120, 0x2394,
+  0x04FF, 0xE4FE, 0x05F7, 0x26F7, 0x27FF, 0x48FF, 0x4AF7, 0xB5FF,
+  0xD6FF, 0xB7FF, 0xD7FF, 0xB7FF, 0xD7FF, 0xD7FF, 0xD7FF, 0xB7FF,
+  0xD7FF, 0xB6FF, 0xB6FF, 0xB6FF, 0x94FF, 0x27F7, 0x26FF, 0x05FF,
+  0x04FF, 0x03B5, 0x2231, 0xE128, 0xA120, 0x4118, 0x4008, 0x2008,
+  0x2008, 0x0000, 0x2000, 0x5804, 0x0029, 0x0000, 0x2008, 0x2008,
+  0x4008, 0xA018, 0xA120, 0xE128, 0x03DE, 0x04FF, 0x05F7, 0x26FF,
+  0x26FF, 0x47F7, 0x48FF, 0xB0FF, 0xB6FF, 0xD7FF, 0xB7FF, 0xD7FF,
+  0xD8FF, 0xD8FF, 0xD8FF, 0xD7FF, 0xD7F7, 0xD7FF, 0xB7FF, 0xD6FF,
+  0x96FF, 0x95FF, 0x69FF, 0x26F7, 0x05F7, 0xE4FE, 0x638B, 0x0131,
+  0xE128, 0x8118, 0x8010, 0x2010, 0x2008, 0x0008, 0x5904, 0x0012,
+  0x2000, 0x2008, 0x2008, 0x4008, 0x8010, 0xC118, 0x8239, 0x03F7,
+  0x04FF, 0x05F7, 0x26FF, 0x47FF, 0x48F7, 0x4AFF, 0xB6FF, 0xD7FF,
+  0xB7FF, 0xD8FF, 0x591E, 0x0010, 0xB6FF, 0xD6FF, 0xD5FF, 0x4AFF,
+  0x46FF, 0x26FF, 0x25FF, 0x2362, 0x2139, 0xE128, 0xC120, 0xA018,
+  0x4008, 0x4008, 0x0000, 0x2000, 0x5A04, 0x002A, 0x2000, 0x2008,
+  0x6008, 0x8010, 0xA018, 0xC120, 0xA362, 0x23FF, 0x44FF, 0x26FF,
+  0x46F7, 0x48FF, 0x49FF, 0x8DFF, 0xD7FF, 0xD7FF, 0xD8FF, 0xD8FF,
+  0xD8FF, 0xD9FF, 0xD9FF, 0xF9FF, 0xD9FF, 0xD8FF, 0xD8FF, 0xD7FF,
+  0xD7FF, 0xD6FF, 0xB6FF, 0x4CF7, 0x47FF, 0x46FF, 0xC5EE, 0x8341,
+  0x6231, 0xC128, 0xC118, 0xA018, 0x4118, 0x4008, 0x2000, 0x0000,
+  0x5B03, 0x002A, 0x2000, 0x2008, 0x2000, 0x4008, 0x6010, 0xA018,
+  0xC118, 0xC47B, 0x03F7, 0x44FF, 0x45F7, 0x47FF, 0x48FF, 0x49F7,
+  0xB0FF, 0xD7FF, 0xD8FF, 0xD8FF, 0xD9FF, 0xF9FF, 0xDAFF, 0xFAFF,
+  0xDAFF, 0xFAFF, 0xD9FF, 0xD8FF, 0xD8FF, 0xD7FF, 0xB7FF, 0xD6FF,
+  0x6AFF, 0x47FF, 0x66FF, 0xC5C5, 0x8349, 0x6239, 0xE128, 0xC120,
+  0x8120, 0x8010, 0x2008, 0x2000, 0x5C05, 0x0029, 0x4008, 0x4008,
+  0x8010, 0xA018, 0xE128, 0x439C, 0x44FF, 0x45FF, 0x46FF, 0x47FF,
+  0x48FF, 0x6AFF, 0xB0FF, 0xD7FF, 0xD8FF, 0xD9FF, 0xF9FF, 0xDAFF,
+  0xFBFF, 0xDBFF, 0xFBFF, 0xDAFF, 0xFAFF, 0xD9FF, 0xD8FF, 0xD8FF,
+  0xD7FF, 0xD4F7, 0x49FF, 0x48FF, 0x46F7, 0x03B5, 0x8341, 0x6231,
+  0x2231, 0xC120, 0x8118, 0x6010, 0x4008, 0x2000, 0x0000, 0x5D04,
+  0x002B, 0x2000, 0x4008, 0x4008, 0x8010, 0x8118, 0xC120, 0xE3B4,
+  0x44FF, 0x45F7, 0x46FF, 0x47FF, 0x69FF, 0x4AF7, 0xB0FF, 0xD8FF,
+  0xD8FF, 0xF9FF, 0xDAFF, 0xDBFF, 0xFCFF, 0xDCFF, 0xFCFF, 0xFBFF,
+  0xDBFF, 0xFAFF, 0xD9FF, 0xD8FF, 0xD7FF, 0xD2FF, 0x89FF, 0x48FF,
+  0x67FF, 0x6594, 0xE349, 0x6239, 0x2229, 0xC120, 0x8120, 0x8010,
+  0x2008, 0x4008, 0x0000, 0x0000, 0x5E03, 0x002C, 0x2000, 0x2008,
+  0x4008, 0x4008, 0x8010, 0xC120, 0x0129, 0x03B5, 0x44FF, 0x45FF,
+  0x46FF, 0x48FF, 0x89FF, 0xABFF, 0xB0FF, 0xD8FF, 0xD9FF, 0xFAFF,
+  0xDBFF, 0xFCFF, 0xFDFF, 0xFDFF, 0xFDFF, 0xFDFF, 0xDBFF, 0xFAFF,
+  0xD9FF, 0xD8FF, 0xD8FF, 0xD2F7, 0x8AFF, 0x88FF, 0x47F7, 0x6594,
+  0xE341, 0x6231, 0x2231, 0xC118, 0x8120, 0x6010, 0x4008, 0x4008,
+  0x0000, 0x0000, 0x5F05, 0x002B, 0x4008, 0x4008, 0x6010, 0xC120,
+  0xE120, 0xC49C, 0x44FF, 0x65F7, 0x66FF, 0x88FF, 0x89F7, 0xABFF,
+  0xB0FF, 0xD8FF, 0xD9FF, 0xFAFF, 0xDBFF, 0xFDFF, 0xFEFF, 0xFEFF,
+  0xFEFF, 0xFDFF, 0xFCFF, 0xDBFF, 0xFAFF, 0xD8FF, 0xD8FF, 0xB2FF,
+  0xAAFF, 0x89FF, 0xA8FF, 0xC4A4, 0xE349, 0x6239, 0x2229, 0xC120,
+  0xA018, 0x6010, 0x4008, 0x2000, 0x2000, 0x0000, 0x0000, 0x6003,
+  0x002C, 0x2000, 0x2000, 0x4008, 0x4008, 0x8010, 0xC120, 0x0129,
+  0x439C, 0x44FF, 0x65FF, 0x86FF, 0x88FF, 0x89FF, 0x8BF7, 0xAFFF,
+  0xD8FF, 0xF9FF, 0xDAFF, 0xFCFF, 0xFDFF, 0xFEFF, 0xFEFF, 0xFEFF,
+  0xFDFF, 0xFCFF, 0xDBFF, 0xDAFF, 0xD8FF, 0xD8FF, 0xD4FF, 0x8AFF,
+  0x89F7, 0x88FF, 0x45DE, 0xE341, 0x6231, 0x2231, 0xC118, 0xA018,
+  0x6010, 0x4008, 0x2000, 0x2000, 0x0000, 0x6104, 0x002C, 0x2000,
+  0x4008, 0x4008, 0x8010, 0xC120, 0xE120, 0x646B, 0x65FF, 0x65FF,
+  0x66F7, 0x88F7, 0xAAFF, 0x8BFF, 0x8DFF, 0xD8FF, 0xF9FF, 0xDAFF,
+  0xDCFF, 0xFDFF, 0xFEFF, 0xFEFF, 0xFEFF, 0xFDFF, 0xFCFF, 0xFBFF,
+  0xDAFF, 0xD8FF, 0xD8FF, 0xD6FF, 0x8BFF, 0x89FF, 0x88FF, 0x86FF,
+  0xC4A4, 0x6239, 0x2229, 0xC120, 0xA018, 0x8010, 0x4008, 0x2008,
+  0x0000, 0x0000, 0x0000, 0x6204, 0x002B, 0x2000, 0x4008, 0x4008,
+  0x8010, 0xC120, 0x0129, 0x6252, 0x85FF, 0x86FF, 0x87FF, 0x88FF,
+  0x8AFF, 0xABFF, 0xADFF, 0xD8FF, 0xF9FF, 0xDAFF, 0xFBFF, 0xFCFF,
+  0xFDFF, 0xFEFF, 0xFDFF, 0xFDFF, 0xDCFF, 0xDBFF, 0xFAFF, 0xD8FF,
+  0xD8FF, 0xD7FF, 0x8DF7, 0x89FF, 0x88FF, 0x66F7, 0x65FF, 0x0363,
+  0x0121, 0xC120, 0xA010, 0x6010, 0x4008, 0x2000, 0x0000, 0x0000,
+  0x6304, 0x002B, 0x2000, 0x4008, 0x4008, 0x8010, 0x8010, 0xC118,
+  0x6231, 0x65FF, 0x66FF, 0x87FF, 0x88F7, 0xAAFF, 0x8BFF, 0xCDF7,
+  0xD8FF, 0xD8FF, 0xDAFF, 0xFBFF, 0xDBFF, 0xDCFF, 0xFDFF, 0xFDFF,
+  0xFCFF, 0xFBFF, 0xDAFF, 0xF9FF, 0xD8FF, 0xD8FF, 0xF7FF, 0xB0FF,
+  0x89FF, 0x88FF, 0x66FF, 0x86FF, 0x439C, 0x0129, 0xC118, 0xA018,
+  0x8010, 0x4008, 0x2008, 0x0000, 0x0000, 0x6404, 0x002A, 0x2008,
+  0x4008, 0x4008, 0x8010, 0xA018, 0xC120, 0x0121, 0xC5EE, 0x86FF,
+  0x87FF, 0x88FF, 0x89FF, 0x8BFF, 0x8DF7, 0xD7FF, 0xD8FF, 0xF9FF,
+  0xDAFF, 0xFBFF, 0xDBFF, 0xFBFF, 0xDBFF, 0xFBFF, 0xDAFF, 0xF9FF,
+  0xD8FF, 0xD8FF, 0xF7FF, 0xD7FF, 0xB5FF, 0x8BFF, 0x88F7, 0x86FF,
+  0x66FF, 0xC49C, 0xE120, 0xC120, 0xA010, 0x4008, 0x4008, 0x2000,
+  0x0000, 0x6505, 0x002A, 0x2008, 0x4008, 0x8010, 0x8010, 0xC118,
+  0xE120, 0x26CE, 0x86F7, 0x87FF, 0x88FF, 0x89F7, 0x8BFF, 0xAFFF,
+  0xD7FF, 0xD8FF, 0xD8FF, 0xF9FF, 0xDAFF, 0xFAFF, 0xDBFF, 0xFAFF,
+  0xDAFF, 0xFAFF, 0xD9FF, 0xD8FF, 0xD8FF, 0xD7FF, 0xD6FF, 0xB6FF,
+  0xD4FF, 0x89FF, 0x86FF, 0x86FF, 0xC4A4, 0x0121, 0x8120, 0x8010,
+  0x6010, 0x2000, 0x2008, 0x0000, 0x0000, 0x6604, 0x002A, 0x2000,
+  0x2000, 0x4008, 0x4008, 0xA018, 0xC120, 0x0129, 0x65B5, 0x86FF,
+  0x87FF, 0x88FF, 0x89FF, 0xAAFF, 0xB2FF, 0xD7F7, 0xD8FF, 0xD8FF,
+  0xF9FF, 0xD9FF, 0xF9FF, 0xDAFF, 0xFAFF, 0xD9FF, 0xF9FF, 0xD8FF,
+  0xD8FF, 0xD7FF, 0xD7FF, 0xB6FF, 0xD6FF, 0xB5FF, 0x8CFF, 0x66F7,
+  0x86FF, 0x2394, 0xC118, 0x8018, 0x8010, 0x4008, 0x2000, 0x2000,
+  0x0000, 0x6705, 0x0028, 0x2000, 0x4008, 0x4008, 0x6010, 0xA010,
+  0xA118, 0xC4A4, 0x66F7, 0x87FF, 0x88FF, 0x89F7, 0x8BFF, 0xD6FF,
+  0xD7FF, 0xD7FF, 0xD8FF, 0xD8FF, 0xD8FF, 0xF9FF, 0xD9FF, 0xD8FF,
+  0xD8FF, 0xF8FF, 0xD8FF, 0xD7FF, 0xD7FF, 0xB7FF, 0xD6FF, 0xB6FF,
+  0xD5FF, 0x8DFF, 0xA7FF, 0x86FF, 0xC483, 0xC120, 0xA018, 0x8010,
+  0x4008, 0x2008, 0x0000, 0x6804, 0x002A, 0x2000, 0x2008, 0x2000,
+  0x4008, 0x8010, 0xA018, 0xC120, 0x439C, 0x86FF, 0x87FF, 0x88FF,
+  0x88FF, 0xCDFF, 0xD6FF, 0xB6FF, 0xD7FF, 0xD7FF, 0xD8FF, 0xD8FF,
+  0xD8FF, 0xF8FF, 0xD8FF, 0xD8FF, 0xD8FF, 0xD7FF, 0xD7F7, 0xD7FF,
+  0xB6FF, 0xD6FF, 0xD5FF, 0xD5FF, 0x8CFF, 0x87FF, 0x66F7, 0xA35A,
+  0x8118, 0x6010, 0x4008, 0x4008, 0x2000, 0x0000, 0x0000, 0x6906,
+  0x0029, 0x2000, 0x4008, 0x4008, 0x8008, 0x8010, 0x6473, 0x86FF,
+  0x87FF, 0x87F7, 0x88FF, 0xB0FF, 0xD6FF, 0xB6FF, 0xD6FF, 0xD7FF,
+  0xD7F7, 0xD7FF, 0xD7FF, 0xD7FF, 0xD7FF, 0xD7FF, 0xD7FF, 0xD7FF,
+  0xB7FF, 0xD6FF, 0xD6FF, 0xD6FF, 0xB5FF, 0xD5FF, 0x89FF, 0xA7FF,
+  0x86FF, 0x6231, 0xA018, 0x8010, 0x4010, 0x2000, 0x2008, 0x2000,
+  0x0000, 0x0000, 0x6A06, 0x0027, 0x2008, 0x4008, 0x4008, 0x8010,
+  0xA018, 0xA362, 0x86FF, 0xA7FF, 0x87FF, 0x88FF, 0xB0FF, 0xD6FF,
+  0xB6FF, 0xD6FF, 0xB6FF, 0xD7FF, 0xD7FF, 0xD7FF, 0xD7F7, 0xD7FF,
+  0xD7FF, 0xF7FF, 0xD7F7, 0xD6FF, 0xD6FF, 0xF6FF, 0xD6FF, 0xB5FF,
+  0xB2FF, 0x87FF, 0x87F7, 0xC6E6, 0x8118, 0xA010, 0x4008, 0x4008,
+  0x2000, 0x2000, 0x0000, 0x6B07, 0x0025, 0x2000, 0x4008, 0x4008,
+  0x6008, 0xC239, 0x87FF, 0x87F7, 0x87FF, 0x88FF, 0xB0FF, 0xD5FF,
+  0xB6FF, 0xD6FF, 0xB6FF, 0xD6FF, 0xD6FF, 0xD7FF, 0xD7FF, 0xD7FF,
+  0xD7FF, 0xD6FF, 0xD6FF, 0xD6FF, 0xB6FF, 0xD6FF, 0xB5FF, 0xD5FF,
+  0xCDFF, 0x87FF, 0x87FF, 0xC4A4, 0xA018, 0x8010, 0x4008, 0x4008,
+  0x2008, 0x0000, 0x6C06, 0x0027, 0x2000, 0x2008, 0x2000, 0x4010,
+  0x8010, 0xC120, 0x86FF, 0x87FF, 0x87FF, 0xA7FF, 0xAFFF, 0xD5FF,
+  0xD5FF, 0xB6FF, 0xD6FF, 0xB6FF, 0xD6FF, 0xD6FF, 0xD6FF, 0xF6FF,
+  0xD6FF, 0xD6FF, 0xD6FF, 0xB6FF, 0xD6FF, 0xB5FF, 0xD5FF, 0xB4F7,
+  0x88FF, 0x87FF, 0x87F7, 0x424A, 0x6010, 0x4008, 0x4008, 0x2000,
+  0x0000, 0x2000, 0x0000, 0x6D07, 0x000B, 0x2000, 0x2000, 0x2008,
+  0x4008, 0x6008, 0x26C6, 0x87FF, 0xA7F7, 0xA7FF, 0xABFF, 0xD6FF,
+  0x6D1C, 0x0010, 0xD6FF, 0xD5FF, 0xB5FF, 0xD5FF, 0xD5FF, 0xADFF,
+  0xA7FF, 0xA7FF, 0xC6EE, 0xA018, 0x8010, 0x4008, 0x4008, 0x2000,
+  0x2000, 0x0000, 0x6E08, 0x0023, 0x2008, 0x2000, 0x4008, 0x4008,
+  0x659C, 0xC7FF, 0xA7FF, 0xA7FF, 0xA8FF, 0xD4FF, 0xD6FF, 0xD5FF,
+  0xD6FF, 0xB6FF, 0xD5FF, 0xB2FF, 0xD4FF, 0xD6FF, 0xD6FF, 0xD6FF,
+  0xD6FF, 0xB6FF, 0xD6FF, 0xF6FF, 0xD4F7, 0xA8FF, 0xA7FF, 0xA7FF,
+  0x2394, 0x6008, 0x4008, 0x2000, 0x2000, 0x0000, 0x2000, 0x6F08,
+  0x0023, 0x2000, 0x0008, 0x2000, 0x4008, 0xE341, 0xA7FF, 0xA7F7,
+  0xA7FF, 0xA7FF, 0xAFFF, 0xF6FF, 0xD6FF, 0xD6FF, 0xD5FF, 0xADF7,
+  0xC9FF, 0xAAFF, 0xB2FF, 0xB6FF, 0xD6FF, 0xB6FF, 0xD6FF, 0xB5FF,
+  0xD5FF, 0xCBFF, 0xA7FF, 0xC7FF, 0x67F7, 0x0129, 0x4008, 0x4008,
+  0x2000, 0x2008, 0x0000, 0x0000, 0x7009, 0x001F, 0x2000, 0x2000,
+  0x4008, 0x4008, 0xE6EE, 0xA7FF, 0xA7FF, 0xA7FF, 0xC9FF, 0xD4FF,
+  0xD6FF, 0xD5FF, 0xB0F7, 0xA8FF, 0x48EF, 0x88F7, 0xCBFF, 0xD4FF,
+  0xD6FF, 0xF6FF, 0xD6FF, 0xD5FF, 0xAFFF, 0xA8F7, 0xA7FF, 0xA7FF,
+  0x646B, 0x4008, 0x2008, 0x2008, 0x0000, 0x710B, 0x001E, 0x2000,
+  0x2000, 0x6473, 0xA7FF, 0xA7F7, 0xA7FF, 0xA8FF, 0xAFFF, 0xF6FF,
+  0xB2FF, 0xA9FF, 0xC9FF, 0xA35A, 0xA4A4, 0xC9FF, 0xACFF, 0xD5FF,
+  0xD5FF, 0xD6FF, 0xAFFF, 0xA8FF, 0xA8FF, 0xC8FF, 0x6594, 0x8010,
+  0x4008, 0x4008, 0x0000, 0x2000, 0x0000, 0x720A, 0x001B, 0x2000,
+  0x2000, 0x2000, 0x4010, 0x46CE, 0xA7FF, 0xA8FF, 0xA8FF, 0xA8FF,
+  0xCCFF, 0xC9FF, 0xA8FF, 0x06C6, 0xC120, 0xE349, 0xC9FF, 0xC9FF,
+  0xCDFF, 0xB2FF, 0xCDFF, 0xA8FF, 0xA8F7, 0xA8FF, 0xA49C, 0x2008,
+  0x0008, 0x4008, 0x730D, 0x0004, 0x2000, 0x8231, 0x47EF, 0xA8FF,
+  0x7316, 0x000D, 0xC483, 0xC118, 0xA118, 0xC8DE, 0xA8FF, 0xA8FF,
+  0xA8FF, 0xA8FF, 0xA8FF, 0xC8FF, 0x6594, 0x6010, 0x2010, 0x740B,
+  0x001B, 0x2000, 0x0000, 0x2000, 0x4008, 0x8241, 0x48EF, 0xC9FF,
+  0xC9FF, 0xA9FF, 0xC9FF, 0xA9FF, 0x4229, 0x8118, 0x8120, 0x6594,
+  0xC9FF, 0xC9FF, 0xC9FF, 0xC9FF, 0x88F7, 0x6473, 0x4000, 0x2008,
+  0x2008, 0x2000, 0x0008, 0x2000, 0x750C, 0x001B, 0x2000, 0x0000,
+  0x0000, 0x2000, 0x0229, 0xA5C5, 0xC9FF, 0xC9FF, 0xC9FF, 0x26CE,
+  0x4110, 0x4118, 0x2110, 0x0229, 0x68EF, 0xC9FF, 0xC9FF, 0xC5CD,
+  0xA239, 0x2010, 0x2008, 0x2000, 0x2008, 0x0000, 0x2000, 0x0000,
+  0x2000, 0x760E, 0x0018, 0x2000, 0x0008, 0x2008, 0x2000, 0x6252,
+  0x65BD, 0xC8DE, 0xA35A, 0x2010, 0x2010, 0x2010, 0x2010, 0xE241,
+  0x6594, 0xC241, 0x2008, 0x2008, 0x0008, 0x2000, 0x2000, 0x0000,
+  0x2000, 0x0000, 0x2000, 0x770E, 0x0016, 0x2000, 0x0000, 0x2000,
+  0x0000, 0x2008, 0x0008, 0x2008, 0x2008, 0x2010, 0x2008, 0x2008,
+  0x2008, 0x2010, 0x2008, 0x2008, 0x2008, 0x0008, 0x2000, 0x0008,
+  0x2008, 0x0000, 0x2000, 0x780D, 0x0017, 0x2000, 0x0000, 0x2000,
+  0x0000, 0x2000, 0x0000, 0x2008, 0x0008, 0x2008, 0x0000, 0x2008,
+  0x0008, 0x2008, 0x0000, 0x2008, 0x0000, 0x2008, 0x0000, 0x2008,
+  0x0000, 0x2000, 0x0000, 0x2000, 0x790F, 0x0015, 0x2000, 0x0000,
+  0x2000, 0x0000, 0x2000, 0x0008, 0x2000, 0x0008, 0x2000, 0x0008,
+  0x2000, 0x0008, 0x2000, 0x0008, 0x2008, 0x0000, 0x2000, 0x0000,
+  0x2000, 0x0000, 0x2000, 0x7A10, 0x0013, 0x2000, 0x0000, 0x2000,
+  0x0008, 0x2000, 0x0000, 0x2000, 0x0008, 0x2008, 0x0000, 0x2008,
+  0x0000, 0x2000, 0x0000, 0x2000, 0x0008, 0x2000, 0x0000, 0x2000,
+  0x7B12, 0x000F, 0x2000, 0x0000, 0x2000, 0x0008, 0x2000, 0x0000,
+  0x2000, 0x0008, 0x2000, 0x0000, 0x2000, 0x0000, 0x2000, 0x0000,
+  0x2000, 0x7C12, 0x000F, 0x2000, 0x0000, 0x2000, 0x0000, 0x2000,
+  0x0000, 0x2000, 0x0000, 0x2000, 0x0000, 0x2000, 0x0000, 0x2000,
+  0x0000, 0x2000, 0x7D12, 0x000D, 0x2000, 0x0000, 0x2000, 0x0000,
+  0x2000, 0x0000, 0x2000, 0x0000, 0x2000, 0x0000, 0x2000, 0x0000,
+  0x2000, 0x7E16, 0x0007, 0x2000, 0x0000, 0x2000, 0x0000, 0x2000,
+  0x0000, 0x2000, 0x0017, 0x0002, 0x0000, 0x0000, 0x0116, 0x0004,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0216, 0x0004, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0316, 0x0005, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0417, 0x0003, 0x0000, 0x0000, 0x0000, 0x0E17, 0x0005,
+  0x2000, 0x0000, 0x2000, 0x0000, 0x2000, 0x0F15, 0x0007, 0x2000,
+  0x0000, 0x2000, 0x0000, 0x2000, 0x0000, 0x2000, 0x1013, 0x000B,
+  0x2000, 0x0000, 0x2000, 0x0000, 0x2000, 0x0000, 0x2008, 0x0000,
+  0x2000, 0x0000, 0x2000, 0x1111, 0x000F, 0x2000, 0x0000, 0x2000,
+  0x0000, 0x2008, 0x0000, 0x2000, 0x0008, 0x2008, 0x0000, 0x2008,
+  0x0008, 0x2000, 0x0000, 0x2000, 0x1212, 0x000F, 0x2000, 0x0000,
+  0x2008, 0x0008, 0x2008, 0x0008, 0x2008, 0x0000, 0x2008, 0x0008,
+  0x2000, 0x0008, 0x2000, 0x0000, 0x2000, 0x1312, 0x000E, 0x2000,
+  0x0000, 0x2008, 0x0008, 0x2010, 0x2008, 0x2008, 0x2008, 0x2008,
+  0x2008, 0x0008, 0x2008, 0x0000, 0x2000, 0x140F, 0x0013, 0x2000,
+  0x0000, 0x2000, 0x0008, 0x2008, 0x0008, 0x2008, 0x2008, 0x2010,
+  0x2008, 0x2008, 0x2008, 0x2010, 0x2008, 0x2008, 0x0008, 0x2000,
+  0x0000, 0x2000, 0x1510, 0x0012, 0x2000, 0x0008, 0x2008, 0x2008,
+  0x2008, 0x2010, 0x2010, 0x2010, 0x2010, 0x2010, 0x2010, 0x2010,
+  0x2008, 0x2008, 0x0008, 0x2008, 0x0008, 0x2000, 0x160E, 0x0015,
+  0x2000, 0x0000, 0x2008, 0x0008, 0x2008, 0x2008, 0x2010, 0x2010,
+  0x4110, 0x4118, 0x4118, 0x4118, 0x4110, 0x4118, 0x2010, 0x2010,
+  0x2008, 0x0008, 0x2008, 0x0000, 0x2000, 0x170E, 0x0015, 0x2000,
+  0x0000, 0x2008, 0x0008, 0x2008, 0x2010, 0x4110, 0x4118, 0x4118,
+  0x6118, 0x6120, 0x6120, 0x4110, 0x4118, 0x4118, 0x2010, 0x2010,
+  0x2008, 0x2008, 0x0000, 0x2000, 0x180F, 0x0015, 0x2008, 0x0008,
+  0x2008, 0x2010, 0x4118, 0x4118, 0x6118, 0x6120, 0x8120, 0x8120,
+  0x6128, 0x6118, 0x6120, 0x4118, 0x4110, 0x2010, 0x2008, 0x0008,
+  0x2008, 0x0000, 0x2000, 0x190E, 0x0014, 0x2000, 0x0008, 0x2008,
+  0x2010, 0x2010, 0x4110, 0x6120, 0x6120, 0x8120, 0x8128, 0xA128,
+  0x8128, 0x8120, 0xA128, 0x6120, 0x4118, 0x4118, 0x2010, 0x2008,
+  0x0008, 0x1A0C, 0x0019, 0x2000, 0x0000, 0x2000, 0x0008, 0x2008,
+  0x2010, 0x4118, 0x6120, 0x8120, 0xA128, 0x8128, 0xA130, 0xC128,
+  0x4151, 0x82B2, 0x4151, 0x8120, 0x6118, 0x4118, 0x4118, 0x2010,
+  0x0008, 0x2000, 0x0000, 0x2000, 0x1B0D, 0x0017, 0x2000, 0x0000,
+  0x0008, 0x2010, 0x4110, 0x6120, 0x8120, 0xA128, 0xA128, 0xC130,
+  0xE230, 0x62AA, 0x83E3, 0x83EB, 0xE238, 0xA128, 0x8120, 0x6120,
+  0x4118, 0x2010, 0x2008, 0x0008, 0x2000, 0x1C0D, 0x0017, 0x2000,
+  0x0008, 0x2008, 0x2010, 0x4118, 0x6120, 0x8120, 0xA128, 0xC130,
+  0x0239, 0x22BB, 0xE3EB, 0xC3E3, 0x83E3, 0x4241, 0xA128, 0xA128,
+  0x6118, 0x4118, 0x4110, 0x2010, 0x0008, 0x0008, 0x1D0D, 0x0015,
+  0x2000, 0x0008, 0x2010, 0x2010, 0x6120, 0x6120, 0xA128, 0xC130,
+  0xE230, 0x828A, 0xC3E3, 0xE3EB, 0xC3E3, 0xE3EB, 0xC169, 0xE238,
+  0xA128, 0x8128, 0x6118, 0x4118, 0x2010, 0x1E0C, 0x0017, 0x2000,
+  0x0008, 0x2008, 0x2010, 0x4110, 0x6120, 0x8120, 0xA130, 0xE230,
+  0x6251, 0xE3EB, 0x24EC, 0x24EC, 0x24E4, 0x24EC, 0x828A, 0x0239,
+  0xC128, 0xA128, 0x6120, 0x4118, 0x2010, 0x2008, 0x1F0B, 0x0017,
+  0x2000, 0x0000, 0x0008, 0x2008, 0x2010, 0x4110, 0x8120, 0x8128,
+  0xE230, 0x0239, 0x22B3, 0x24E4, 0x24EC, 0x24EC, 0x24EC, 0x24EC,
+  0xA2CB, 0x4241, 0xE238, 0xA128, 0x8120, 0x6120, 0x4118, 0x200C,
+  0x001A, 0x0000, 0x2008, 0x2008, 0x4118, 0x6120, 0x8120, 0xA130,
+  0xE238, 0x2162, 0x24EC, 0x24EC, 0x84EC, 0x84EC, 0x84EC, 0x24EC,
+  0x24E4, 0xA251, 0x0239, 0xC130, 0xA128, 0x6118, 0x4118, 0x2010,
+  0x0008, 0x2000, 0x0000, 0x210D, 0x001A, 0x0008, 0x2010, 0x4118,
+  0x6118, 0x8128, 0xC130, 0x0231, 0xA2CB, 0x24EC, 0x84EC, 0x84EC,
+  0x84EC, 0x84EC, 0x84EC, 0x63EC, 0x8292, 0x4249, 0xE238, 0x8128,
+  0x8120, 0x4118, 0x2010, 0x2008, 0x2008, 0x0000, 0x2000, 0x220B,
+  0x0014, 0x2000, 0x0008, 0x2008, 0x2010, 0x4110, 0x6120, 0xA128,
+  0xE238, 0x427A, 0x24EC, 0x84EC, 0x84EC, 0xE4EC, 0xE4EC, 0xC4F4,
+  0xE4EC, 0x84EC, 0x82CB, 0x2241, 0x0239, 0x2225, 0x0002, 0x2000,
+  0x0000, 0x230B, 0x001C, 0x2000, 0x0000, 0x0008, 0x2010, 0x4110,
+  0x8120, 0xA128, 0x0239, 0x82CB, 0x63EC, 0x84EC, 0xE4EC, 0x25ED,
+  0x05F5, 0x05ED, 0xE4EC, 0xE4F4, 0x63EC, 0xC259, 0x0241, 0xC130,
+  0x8120, 0x6120, 0x2010, 0x2008, 0x2008, 0x0000, 0x2000, 0x240B,
+  0x001B, 0x2000, 0x0008, 0x2008, 0x2010, 0x4118, 0x8128, 0xC130,
+  0xA169, 0x44EC, 0x84EC, 0xE4EC, 0x05F5, 0x44ED, 0x44F5, 0x44ED,
+  0x25F5, 0xE4EC, 0x84EC, 0x4272, 0x2241, 0xC230, 0xA128, 0x6120,
+  0x4110, 0x2008, 0x0008, 0x0000, 0x250B, 0x0019, 0x2000, 0x0008,
+  0x2008, 0x2010, 0x6118, 0x6120, 0xC130, 0x628A, 0x63EC, 0x84EC,
+  0xE4EC, 0x44F5, 0xA6ED, 0xC4F5, 0xA6F5, 0x44F5, 0x25F5, 0x84EC,
+  0x239B, 0x4241, 0xE238, 0xA128, 0x6120, 0x4118, 0x2008, 0x260A,
+  0x001C, 0x2000, 0x0000, 0x2008, 0x2008, 0x4118, 0x6120, 0xA128,
+  0xC130, 0x22B3, 0x63EC, 0xE4F4, 0x05ED, 0x44F5, 0xC4F5, 0x05F6,
+  0x05F6, 0x84ED, 0x05ED, 0xE4EC, 0x82CB, 0x2241, 0xE230, 0x8128,
+  0x6118, 0x4118, 0x2010, 0x0008, 0x2000, 0x270A, 0x0018, 0x2000,
+  0x0000, 0x0008, 0x2008, 0x4118, 0x6118, 0xA128, 0xC230, 0x22B3,
+  0x84EC, 0xE4EC, 0x05ED, 0xC4F5, 0xE5F5, 0x45F6, 0xE5F5, 0xC4F5,
+  0x44F5, 0xE4F4, 0x44EC, 0x4241, 0xE238, 0xA128, 0x6120, 0x280E,
+  0x0019, 0x4118, 0x6120, 0xA128, 0xE238, 0x8292, 0xA4EC, 0xE4EC,
+  0x44F5, 0xC4F5, 0x45F6, 0x85F6, 0x25F6, 0xC4F5, 0x44F5, 0xC4EC,
+  0xC2EC, 0xA251, 0xC230, 0xA130, 0x6118, 0x4118, 0x2010, 0x2008,
+  0x0000, 0x2000, 0x290A, 0x001D, 0x2000, 0x0000, 0x0008, 0x2008,
+  0x4118, 0x6118, 0xA128, 0xC230, 0xA251, 0x84EC, 0xE4EC, 0x44F5,
+  0xA4F5, 0x45F6, 0x85F6, 0x66F6, 0xC4F5, 0x44F5, 0x03F5, 0xC2F4,
+  0x2162, 0xE238, 0xC130, 0x6118, 0x4118, 0x2008, 0x0008, 0x2008,
+  0x0000, 0x2A0B, 0x001C, 0x2000, 0x0008, 0x2008, 0x4118, 0x6120,
+  0xA128, 0xE238, 0x4241, 0x239B, 0xE4F4, 0x44F5, 0xA4CC, 0xA49C,
+  0xA5C5, 0x45F6, 0xC4F5, 0x44F5, 0x03ED, 0xC2F4, 0x0162, 0xC230,
+  0xA128, 0x6118, 0x4118, 0x2010, 0x2008, 0x0000, 0x2000, 0x2B0B,
+  0x001C, 0x2000, 0x0008, 0x2008, 0x4118, 0x6118, 0x8128, 0xC130,
+  0x4241, 0xA251, 0xE2BB, 0xA4CC, 0x838B, 0x2394, 0xC4A4, 0x85DD,
+  0xC4F5, 0x64F5, 0x03ED, 0xC2F4, 0xA169, 0xE238, 0xA128, 0x6120,
+  0x4118, 0x2010, 0x0008, 0x2000, 0x0000, 0x2C0A, 0x001C, 0x2000,
+  0x0000, 0x2008, 0x2008, 0x2010, 0x6120, 0xA128, 0xC130, 0x0239,
+  0x6251, 0x2362, 0xC37A, 0x2383, 0x838B, 0x439C, 0x43AC, 0x83F5,
+  0x44F5, 0x03ED, 0xC2F4, 0x4249, 0xE230, 0x8128, 0x6118, 0x4118,
+  0x2008, 0x0008, 0x2000, 0x2D0D, 0x0019, 0x2008, 0x2010, 0x4118,
+  0x8120, 0xC130, 0x0239, 0x6249, 0xA259, 0x8462, 0xC372, 0x838B,
+  0x838B, 0xC39B, 0x83F5, 0x43F5, 0x03F5, 0x62D4, 0x2241, 0xE238,
+  0xA128, 0x6120, 0x4118, 0x2008, 0x2008, 0x0000, 0x2E0A, 0x001D,
+  0x2000, 0x0000, 0x2008, 0x2008, 0x2010, 0x4118, 0x8120, 0xA130,
+  0x0239, 0x6251, 0xC251, 0x2362, 0xC37A, 0x2383, 0x2383, 0x0383,
+  0x44F5, 0x03F5, 0x03ED, 0x2393, 0x0239, 0xC130, 0x8120, 0x6120,
+  0x2010, 0x2008, 0x0000, 0x0000, 0x2000, 0x2F0B, 0x001C, 0x2000,
+  0x0008, 0x2008, 0x2010, 0x4110, 0x8120, 0xA130, 0xE238, 0x2241,
+  0xA251, 0x2362, 0x2362, 0xC37A, 0xC372, 0xC372, 0xC3D4, 0x03F5,
+  0xA2EC, 0x6251, 0x2239, 0xA130, 0x8120, 0x4118, 0x2010, 0x2008,
+  0x0008, 0x2000, 0x0000, 0x300B, 0x001C, 0x0000, 0x2008, 0x0008,
+  0x2010, 0x4118, 0x6118, 0xA128, 0xE238, 0x0239, 0x6251, 0xC259,
+  0x2362, 0x2362, 0x8462, 0x2362, 0x02BC, 0xA2EC, 0x2362, 0x2241,
+  0xE230, 0xA130, 0x8120, 0x4118, 0x2010, 0x2008, 0x0000, 0x0000,
+  0x2000, 0x310A, 0x001F, 0x0000, 0x2000, 0x0000, 0x0008, 0x2010,
+  0x4118, 0x6118, 0xA128, 0xA130, 0x6249, 0x2393, 0x62D4, 0x239B,
+  0x2362, 0x2362, 0x2362, 0x2362, 0x2162, 0x6251, 0x0239, 0xC130,
+  0xA128, 0x6120, 0x4118, 0x2010, 0x0008, 0x2008, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x320F, 0x0019, 0x4110, 0x6120, 0xA128, 0x8292,
+  0xA1EC, 0xC2F4, 0xA2EC, 0x01C4, 0xA251, 0xA251, 0xC259, 0xA251,
+  0x6251, 0x4241, 0xE238, 0xC130, 0x6120, 0x6118, 0x4118, 0x2010,
+  0x0008, 0x2000, 0x0000, 0x0000, 0x0000, 0x3309, 0x0020, 0x0000,
+  0x0000, 0x2000, 0x0008, 0x0008, 0x2010, 0x4110, 0xE230, 0x82C3,
+  0x81EC, 0xA1E4, 0xA2F4, 0xC2EC, 0xA2EC, 0x6251, 0xC251, 0x6251,
+  0x6249, 0x4241, 0xE240, 0xE238, 0xA130, 0x8120, 0x6120, 0x2010,
+  0x2008, 0x2008, 0x0000, 0x2000, 0x0000, 0x0000, 0x0000, 0x340E,
+  0x001B, 0x2008, 0x6118, 0x21CC, 0x61EC, 0x61EC, 0xA1EC, 0xC2F4,
+  0xA2EC, 0x82E4, 0x6249, 0x6249, 0x6251, 0x2241, 0x4241, 0xE238,
+  0xC130, 0x8128, 0x8120, 0x4110, 0x2010, 0x2008, 0x0008, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x350D, 0x001C, 0x0000, 0x2008,
+  0x0172, 0x61EC, 0x61EC, 0xC1EC, 0xC1F4, 0xC1EC, 0xC2F4, 0x81B3,
+  0x2241, 0x4249, 0x2241, 0x4241, 0x0241, 0xE238, 0xA128, 0x8128,
+  0x6118, 0x4118, 0x2010, 0x2008, 0x0008, 0x2000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x360F, 0x001B, 0x81B3, 0x61EC, 0xC1F4, 0x46F6,
+  0xC1EC, 0xC1F4, 0xE19A, 0xE238, 0xE240, 0x0239, 0xE240, 0x0241,
+  0xE230, 0xC130, 0xA128, 0x6120, 0x6120, 0x4118, 0x2010, 0x2008,
+  0x0008, 0x2000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x370B,
+  0x0020, 0x0000, 0x0008, 0x2008, 0x2008, 0x61AB, 0xA1EC, 0x83F5,
+  0x46F6, 0xC4F5, 0xC1F4, 0xA17A, 0x0241, 0xE240, 0x0241, 0xE240,
+  0xE238, 0xC130, 0xA128, 0xA128, 0x8120, 0x6120, 0x4118, 0x2010,
+  0x2008, 0x0008, 0x2000, 0x0000, 0x2000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x380F, 0x001B, 0xC169, 0xA1EC, 0x05FE, 0x46F6, 0x46F6,
+  0xC1F4, 0xE19A, 0xC230, 0xE230, 0xE240, 0xE230, 0xE238, 0xC130,
+  0xC130, 0x8120, 0x6118, 0x4118, 0x4118, 0x2010, 0x2008, 0x0008,
+  0x0000, 0x2000, 0x0000, 0x0000, 0x0000, 0x0000, 0x390A, 0x0001,
+  0x0008, 0x3910, 0x001C, 0xA1E4, 0xE5F5, 0xC7FE, 0xC4F5, 0xC1F4,
+  0x62D4, 0xE238, 0xE238, 0xE230, 0xE238, 0xC130, 0xA130, 0x8128,
+  0x8120, 0x6120, 0x4118, 0x2010, 0x2010, 0x2008, 0x2008, 0x0000,
+  0x2000, 0x0000, 0x2000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3A06,
+  0x0025, 0x2000, 0x0000, 0x2008, 0x0000, 0x2008, 0x2008, 0x2008,
+  0x2010, 0x2010, 0x4118, 0x81B3, 0x02F5, 0xC4F5, 0x02F5, 0x02F5,
+  0xC1F4, 0x6249, 0xE230, 0xE230, 0xC130, 0xC130, 0xA130, 0xA128,
+  0x6120, 0x6120, 0x4110, 0x2010, 0x2010, 0x2008, 0x0008, 0x2008,
+  0x0000, 0x2000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3B07, 0x0025,
+  0x2000, 0x0008, 0x2000, 0x0008, 0x2008, 0x2010, 0x2010, 0x4110,
+  0x4110, 0x0162, 0xC1F4, 0xC1F4, 0x02F5, 0x02F5, 0x02BC, 0x217A,
+  0xE238, 0xE238, 0xC130, 0xC130, 0xA128, 0x8128, 0x8128, 0x6118,
+  0x4118, 0x4118, 0x2010, 0x2008, 0x2008, 0x0008, 0x2000, 0x0000,
+  0x2000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3C05, 0x0005, 0x2000,
+  0x0000, 0x2000, 0x0008, 0x2008, 0x3C10, 0x001C, 0xA128, 0xA1EC,
+  0x02F5, 0x02F5, 0x42D4, 0xC230, 0xE230, 0xE238, 0xE230, 0xC130,
+  0xC130, 0xA130, 0xA128, 0x8120, 0x6120, 0x6118, 0x4118, 0x2010,
+  0x2008, 0x0008, 0x0008, 0x2000, 0x0000, 0x2000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x3D04, 0x0028, 0x2000, 0x0000, 0x2000, 0x0000,
+  0x2008, 0x0008, 0x2008, 0x2010, 0x2010, 0x4118, 0x4118, 0x6118,
+  0x6120, 0x817A, 0x21F5, 0x21F5, 0x427A, 0xE238, 0xE230, 0xE238,
+  0xE238, 0xC130, 0xC130, 0xA130, 0xA128, 0x6120, 0x8120, 0x6120,
+  0x4110, 0x2010, 0x2010, 0x2008, 0x2008, 0x0008, 0x2008, 0x0000,
+  0x2000, 0x0000, 0x0000, 0x0000, 0x3E05, 0x0028, 0x2000, 0x0000,
+  0x2008, 0x0008, 0x2008, 0x2008, 0x2010, 0x4118, 0x4118, 0x6120,
+  0x8120, 0x8120, 0xA130, 0x02BC, 0x02BC, 0xC230, 0xE238, 0xE238,
+  0xE238, 0xE230, 0xE240, 0xC130, 0xC130, 0xC130, 0xA128, 0x6120,
+  0x6118, 0x4118, 0x4118, 0x2010, 0x2008, 0x2008, 0x0008, 0x2008,
+  0x0000, 0x2000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3F05, 0x0027,
+  0x2000, 0x0000, 0x2008, 0x0008, 0x2008, 0x2010, 0x4118, 0x4110,
+  0x6120, 0x6120, 0x8120, 0xA128, 0xA130, 0xC130, 0xE238, 0xE230,
+  0x0241, 0xE240, 0x0239, 0xE240, 0x8182, 0x81B3, 0x2239, 0xA128,
+  0x8128, 0x8120, 0x6120, 0x6120, 0x4118, 0x2010, 0x2008, 0x2008,
+  0x2008, 0x0000, 0x2000, 0x0000, 0x2000, 0x0000, 0x0000, 0x4004,
+  0x002A, 0x2000, 0x0000, 0x2008, 0x0008, 0x2008, 0x2010, 0x2010,
+  0x4118, 0x6120, 0x6118, 0x8120, 0xA128, 0xA130, 0xC130, 0xE238,
+  0x0239, 0x2239, 0x0239, 0x4249, 0x4241, 0x0239, 0x216A, 0x42F5,
+  0xE1D4, 0xA251, 0xA128, 0xA128, 0x6120, 0x6120, 0x4118, 0x4110,
+  0x2010, 0x2008, 0x2010, 0x0008, 0x2000, 0x0000, 0x2000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x4104, 0x0029, 0x2000, 0x0000, 0x2008,
+  0x0008, 0x2008, 0x2010, 0x4118, 0x4110, 0x6120, 0x6120, 0xA128,
+  0xC128, 0xC130, 0xE238, 0x0241, 0x0239, 0x4241, 0x2241, 0x4241,
+  0x2241, 0x2241, 0x0162, 0x82F5, 0x82F5, 0x42F5, 0x427A, 0xA128,
+  0x6120, 0x8120, 0x6120, 0x4118, 0x2010, 0x2008, 0x2008, 0x2008,
+  0x0008, 0x2000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4203, 0x002B,
+  0x2000, 0x0000, 0x2008, 0x0008, 0x2000, 0x2008, 0x2010, 0x4118,
+  0x4118, 0x6120, 0x8120, 0x8128, 0xC130, 0xE238, 0x0239, 0x2239,
+  0x4241, 0x2249, 0x6249, 0x6251, 0x6249, 0x6251, 0x239B, 0xA2F5,
+  0xA2F5, 0x82F5, 0x82F5, 0x4272, 0x8128, 0x6120, 0x6118, 0x6120,
+  0x4110, 0x2010, 0x2008, 0x0008, 0x2008, 0x0000, 0x2000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x4304, 0x0029, 0x2000, 0x0008, 0x0008,
+  0x2008, 0x2010, 0x2010, 0x4110, 0x6120, 0x8120, 0xA128, 0xA128,
+  0xE238, 0xE238, 0x0239, 0x4241, 0x6251, 0x6249, 0x6251, 0x6249,
+  0x6249, 0x0162, 0x42E5, 0xA2F5, 0xA2F5, 0xA2F5, 0xA2F5, 0x82F5,
+  0x016A, 0x8120, 0x8120, 0x6120, 0x4118, 0x2010, 0x2008, 0x2008,
+  0x0008, 0x2008, 0x0000, 0x2000, 0x0000, 0x0000, 0x4403, 0x002B,
+  0x2000, 0x0000, 0x2008, 0x0008, 0x2008, 0x2010, 0x4118, 0x4118,
+  0x6118, 0x8128, 0xA128, 0xC130, 0xE238, 0x0239, 0x4241, 0x6251,
+  0x6249, 0xA259, 0xC251, 0xA259, 0x2383, 0xA2E5, 0xE2F5, 0xC2F5,
+  0xC2F5, 0xC2F5, 0xA2F5, 0xA2F5, 0x42E5, 0x2141, 0x6120, 0x6118,
+  0x4118, 0x2010, 0x2010, 0x2008, 0x0008, 0x2000, 0x0000, 0x2000,
+  0x0000, 0x0000, 0x0000, 0x4503, 0x002A, 0x2000, 0x0008, 0x2000,
+  0x0008, 0x2008, 0x2010, 0x0139, 0x6118, 0x6120, 0xA128, 0xC128,
+  0xE238, 0x0239, 0x2241, 0x0383, 0xA2BC, 0xC2C4, 0xA2BC, 0xC2BC,
+  0xA2E5, 0xE3F5, 0x03F6, 0x03F6, 0xE2F5, 0xE2F5, 0xC2F5, 0xC2F5,
+  0xC2F5, 0xA2F5, 0x02C4, 0x8120, 0x6120, 0x4110, 0x4118, 0x2010,
+  0x2008, 0x2008, 0x0008, 0x2000, 0x0000, 0x2000, 0x0000, 0x4603,
+  0x002A, 0x2000, 0x0008, 0x2008, 0x2008, 0x2010, 0x2139, 0x8272,
+  0x6118, 0x6120, 0xA128, 0xC130, 0xE238, 0x0239, 0x43B4, 0xE2F5,
+  0x03FE, 0x03F6, 0x03F6, 0x23F6, 0x03F6, 0x23F6, 0x03FE, 0x03F6,
+  0xE3F5, 0xE3F5, 0xE2F5, 0xE2F5, 0xC2F5, 0xC2F5, 0xA2F5, 0xC151,
+  0x6120, 0x6118, 0x4118, 0x2010, 0x2008, 0x0008, 0x0000, 0x2000,
+  0x0000, 0x2000, 0x0000, 0x4703, 0x002B, 0x2000, 0x0000, 0x0008,
+  0x2008, 0x2010, 0xC151, 0x42E5, 0x216A, 0xC128, 0xA130, 0xE230,
+  0x0239, 0x6193, 0xE2F5, 0x02F6, 0x02F6, 0x23FE, 0x03F6, 0x43F6,
+  0x43F6, 0x43FE, 0x43F6, 0x23F6, 0x24F6, 0x03F6, 0x03F6, 0xE2F5,
+  0xE2F5, 0xC2F5, 0xC2FD, 0x819B, 0x8120, 0x6120, 0x4118, 0x2010,
+  0x2008, 0x0008, 0x2000, 0x0008, 0x2000, 0x0000, 0x0000, 0x0000,
+  0x4802, 0x002C, 0x2000, 0x0000, 0x2008, 0x0008, 0x2008, 0x2010,
+  0x2149, 0xA1F5, 0xC2F5, 0x43AC, 0xC130, 0xE230, 0xC159, 0xE2FD,
+  0x22F6, 0x23F6, 0x23F6, 0x43FE, 0x43F6, 0x44F6, 0x64F6, 0x44FE,
+  0x64F6, 0xC9F6, 0x43F6, 0x03FE, 0x02F6, 0x02F6, 0xE2F5, 0xE2F5,
+  0xC2F5, 0xA1CC, 0x6118, 0x6118, 0x4118, 0x4118, 0x2010, 0x0008,
+  0x0008, 0x2000, 0x0000, 0x2000, 0x0000, 0x0000, 0x4902, 0x002D,
+  0x2000, 0x0000, 0x2000, 0x0008, 0x2008, 0x2010, 0x4110, 0x8272,
+  0x8272, 0x8128, 0xC130, 0xE230, 0xA39B, 0x02F6, 0x03F6, 0x43F6,
+  0x43F6, 0x64FE, 0x44F6, 0x83F6, 0x63F6, 0xA7F6, 0x31FF, 0xC9F6,
+  0x64FE, 0x43F6, 0x23F6, 0x23F6, 0x02FE, 0x02F6, 0xE2F5, 0xA1CC,
+  0x8128, 0x8128, 0x6118, 0x4118, 0x2010, 0x2008, 0x2008, 0x0008,
+  0x2000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4A01, 0x002E, 0x2000,
+  0x0000, 0x2000, 0x0008, 0x2008, 0x2008, 0x2010, 0x4118, 0x6120,
+  0x8120, 0x8128, 0xC130, 0x0239, 0xC2E5, 0x23FE, 0x23F6, 0x43FE,
+  0x64F6, 0x44F6, 0xA9FE, 0xCDF6, 0x31FF, 0x53FF, 0x33F7, 0x84F6,
+  0x64F6, 0x44FE, 0x43F6, 0x23F6, 0x03F6, 0x02F6, 0xE2F5, 0x43AC,
+  0x8128, 0x6120, 0x6118, 0x4118, 0x2010, 0x2008, 0x0008, 0x2008,
+  0x0000, 0x2000, 0x0000, 0x0000, 0x0000, 0x4B01, 0x002D, 0x2000,
+  0x0000, 0x2000, 0x0008, 0x0008, 0x2008, 0x2010, 0x4110, 0x6120,
+  0x8120, 0xA130, 0xE230, 0xA151, 0x03F6, 0x43F6, 0x43FE, 0x64F6,
+  0x84F6, 0x2EF7, 0x74FF, 0x74FF, 0x74F7, 0x74FF, 0xEDFE, 0x84F6,
+  0x84FE, 0x44F6, 0x64F6, 0x43F6, 0x23FE, 0x02F6, 0x22FE, 0x218B,
+  0x8128, 0x8120, 0x6120, 0x4110, 0x2010, 0x2008, 0x2008, 0x0008,
+  0x2000, 0x0000, 0x0000, 0x0000, 0x4C02, 0x002C, 0x2000, 0x0008,
+  0x2008, 0x0008, 0x2010, 0x2010, 0x4110, 0x6120, 0xA128, 0xA130,
+  0xE230, 0x2383, 0x42FE, 0x43FE, 0x64F6, 0x64F6, 0x4EFF, 0x74FF,
+  0x74FF, 0x74F7, 0x74FF, 0x74FF, 0xE8F6, 0xA4F6, 0x84FE, 0x83F6,
+  0x44F6, 0x43F6, 0x43F6, 0x22F6, 0x22F6, 0x0162, 0xA128, 0x8120,
+  0x6120, 0x4110, 0x2010, 0x2008, 0x0008, 0x0008, 0x2000, 0x0000,
+  0x0000, 0x0000, 0x4D02, 0x002D, 0x2000, 0x0000, 0x2008, 0x0008,
+  0x2010, 0x2010, 0x6120, 0x6118, 0x8128, 0xC130, 0xE230, 0xA39B,
+  0x43F6, 0x43F6, 0x83FE, 0xC9F6, 0x74F7, 0x74FF, 0x74FF, 0x94F7,
+  0xB4FF, 0x74FF, 0xE8FE, 0xC4F6, 0xA4FE, 0x84F6, 0x83F6, 0x63F6,
+  0x43F6, 0x42FE, 0xC2E5, 0xE238, 0xA128, 0x8128, 0x6118, 0x4118,
+  0x2010, 0x2008, 0x0008, 0x2008, 0x0008, 0x2000, 0x0000, 0x0000,
+  0x0000, 0x4E01, 0x002D, 0x2000, 0x0000, 0x2008, 0x0008, 0x2008,
+  0x2010, 0x4110, 0x4118, 0x6120, 0xA128, 0xC130, 0xE238, 0x43AC,
+  0x63FE, 0x64F6, 0x83FE, 0x31FF, 0x74F7, 0x74FF, 0x74FF, 0x94FF,
+  0x94FF, 0xB4F7, 0x4CFF, 0xE5F6, 0xC4FE, 0xA4F6, 0x63F6, 0x83F6,
+  0x43F6, 0x43FE, 0xA39B, 0xC230, 0xA128, 0x8120, 0x6120, 0x4110,
+  0x2010, 0x2010, 0x0008, 0x2008, 0x0000, 0x2000, 0x0000, 0x0000,
+  0x4F01, 0x002E, 0x2000, 0x0000, 0x2000, 0x0008, 0x2008, 0x2010,
+  0x2010, 0x6120, 0x6120, 0xA128, 0xA130, 0x0239, 0x43AC, 0x43F6,
+  0x63F6, 0x84F6, 0x53FF, 0x74F7, 0x74FF, 0xB4FF, 0x94F7, 0xB4FF,
+  0x94FF, 0x94FF, 0x4CFF, 0xE5F6, 0xA4FE, 0x84F6, 0x83F6, 0x83FE,
+  0x43F6, 0xA349, 0xE230, 0xA130, 0x8120, 0x6120, 0x4118, 0x2010,
+  0x2010, 0x0008, 0x2008, 0x0000, 0x2000, 0x0000, 0x0000, 0x0000,
+  0x5002, 0x002D, 0x2000, 0x0008, 0x2008, 0x2008, 0x2010, 0x2010,
+  0x6120, 0x8120, 0x8128, 0xC130, 0x0239, 0xC3A3, 0xA3FE, 0x83F6,
+  0xA4F6, 0x53FF, 0x74FF, 0x94FF, 0x94FF, 0xB4F7, 0x94FF, 0xD4FF,
+  0x94FF, 0x74F7, 0xE5FE, 0xC4F6, 0xA4F6, 0x84F6, 0x83FE, 0x23AC,
+  0x2241, 0xE230, 0xC130, 0x6120, 0x6118, 0x4118, 0x2010, 0x2010,
+  0x0008, 0x2008, 0x0000, 0x2000, 0x0000, 0x0000, 0x0000, 0x5102,
+  0x002C, 0x2000, 0x0000, 0x0008, 0x2008, 0x2010, 0x4118, 0x6118,
+  0x8120, 0x8128, 0xC130, 0x0239, 0x018B, 0x83F6, 0xA4F6, 0xA4FE,
+  0x4EF7, 0x74F7, 0x94FF, 0xB4FF, 0x94FF, 0x94F7, 0xD4FF, 0xB4FF,
+  0x94FF, 0x05F7, 0xE5FE, 0xC4FE, 0xA4F6, 0x83FE, 0x8272, 0x4241,
+  0x0241, 0xC130, 0xA128, 0x6118, 0x4118, 0x2010, 0x2010, 0x2008,
+  0x0008, 0x2000, 0x0000, 0x2000, 0x0000, 0x5201, 0x002E, 0x2000,
+  0x0000, 0x2008, 0x0008, 0x2008, 0x2010, 0x4118, 0x6120, 0x8120,
+  0xA128, 0xE238, 0x0239, 0x2362, 0xC2FE, 0xC4FE, 0xC4F6, 0xE5FE,
+  0x74FF, 0x94FF, 0x94F7, 0xB4FF, 0xD4FF, 0xB4FF, 0x94F7, 0xB0FF,
+  0x05F7, 0xE5FE, 0xC4F6, 0xA4F6, 0x43CD, 0xA251, 0x2241, 0x0239,
+  0xC130, 0xA128, 0x6120, 0x4110, 0x2010, 0x2010, 0x0008, 0x2008,
+  0x0000, 0x2000, 0x0000, 0x0000, 0x0000, 0x5301, 0x002D, 0x2000,
+  0x0000, 0x2008, 0x0008, 0x2008, 0x2010, 0x4118, 0x6118, 0x8120,
+  0xA130, 0xE238, 0x2241, 0x6141, 0x43CD, 0xA4F6, 0xC4F6, 0xE5FE,
+  0x08F7, 0x94FF, 0xB4F7, 0x94FF, 0xB4FF, 0xD4FF, 0x94FF, 0x4CF7,
+  0x26FF, 0x05F7, 0xE5FE, 0xC4FE, 0x439C, 0xC259, 0x4241, 0x0241,
+  0xC130, 0x8128, 0x8120, 0x4118, 0x2010, 0x2010, 0x2008, 0x0008,
+  0x2000, 0x0000, 0x2000, 0x0000, 0x5402, 0x002D, 0x2000, 0x0008,
+  0x2008, 0x2008, 0x2010, 0x4110, 0x6120, 0x8120, 0xA130, 0xE238,
+  0x4241, 0x8349, 0x2383, 0xE4FE, 0xE5FE, 0x05F7, 0x05FF, 0x4AFF,
+  0x94FF, 0xB5FF, 0x95F7, 0xD5FF, 0x95FF, 0x6AFF, 0x26F7, 0x05F7,
+  0xC5FE, 0xE5FE, 0x037B, 0xA251, 0x8349, 0x0239, 0xE230, 0xA130,
+  0x8120, 0x4118, 0x2010, 0x2008, 0x0008, 0x2008, 0x0000, 0x2000,
+  0x0000, 0x0000, 0x0000, 0x5501, 0x002D, 0x2000, 0x0000, 0x2008,
+  0x0008, 0x2008, 0x2010, 0x4110, 0x6120, 0xA128, 0xC130, 0x0239,
+  0x2241, 0x8341, 0xA251, 0x03B5, 0xC5FE, 0x05F7, 0x26FF, 0x06FF,
+  0x4EF7, 0xB5F7, 0x95FF, 0xD4FF, 0x94FF, 0x47FF, 0x06F7, 0x26FF,
+  0x05FF, 0xE5FE, 0x2383, 0xC251, 0x8349, 0x4249, 0xE230, 0xA130,
+  0x8120, 0x6120, 0x2010, 0x2008, 0x2008, 0x0008, 0x2000, 0x0000,
+  0x0000, 0x0000, 0x5602, 0x002C, 0x2000, 0x0008, 0x2008, 0x2008,
+  0x2010, 0x4110, 0x6120, 0xA128, 0xC130, 0x0239, 0x8149, 0xC259,
+  0x2362, 0xC372, 0x05FF, 0x26FF, 0x26FF, 0x47FF, 0x48FF, 0x94FF,
+  0xD5FF, 0xD5FF, 0xB2F7, 0x47FF, 0x07F7, 0x26FF, 0x26F7, 0x05FF,
+  0x638B, 0xA251, 0x8341, 0x4241, 0x0239, 0xA130, 0x8120, 0x6118,
+  0x4118, 0x2010, 0x0008, 0x2000, 0x0000, 0x2000, 0x0000, 0x0000,
+  0x5702, 0x002D, 0x2000, 0x0008, 0x2008, 0x2008, 0x2010, 0x4118,
+  0x8118, 0xA128, 0xE238, 0x0239, 0x8349, 0xA251, 0x235A, 0x8462,
+  0xE5F6, 0x27FF, 0x07F7, 0x47FF, 0x47FF, 0xB0F7, 0xB5FF, 0x95FF,
+  0xAFFF, 0x47FF, 0x47F7, 0x27FF, 0x26FF, 0x05FF, 0x03BD, 0x2452,
+  0xC259, 0xA349, 0x0239, 0xC130, 0xA118, 0x6120, 0x4118, 0x2010,
+  0x2008, 0x0008, 0x2000, 0x0008, 0x0000, 0x0000, 0x0000, 0x5801,
+  0x002D, 0x2000, 0x0000, 0x2000, 0x0008, 0x2008, 0x4118, 0x4118,
+  0xA120, 0xE128, 0xE230, 0x4249, 0x8349, 0xC251, 0x2362, 0xC37A,
+  0x26FF, 0x27FF, 0x47FF, 0x48F7, 0x48FF, 0xAFFF, 0xB6FF, 0xB5FF,
+  0x8DFF, 0x48F7, 0x48FF, 0x47FF, 0x07F7, 0x26FF, 0xC5EE, 0x6462,
+  0xA251, 0x8349, 0x2239, 0xE128, 0xA128, 0x8118, 0x4118, 0x2010,
+  0x2008, 0x0008, 0x2000, 0x0000, 0x0000, 0x0000, 0x5901, 0x002D,
+  0x2000, 0x0000, 0x2000, 0x0008, 0x2008, 0x4110, 0x6120, 0x8118,
+  0xE128, 0x2139, 0x2241, 0x8349, 0x2452, 0x8462, 0x458C, 0x27FF,
+  0x47FF, 0x48F7, 0x48FF, 0x49FF, 0xB0FF, 0xB6FF, 0xB6FF, 0x8DF7,
+  0x69FF, 0x48FF, 0x48FF, 0x47F7, 0x07FF, 0x26FF, 0xC4A4, 0x034A,
+  0x8349, 0x4249, 0x2229, 0xE128, 0x8120, 0x8010, 0x2010, 0x2008,
+  0x2008, 0x0000, 0x2000, 0x0000, 0x0000, 0x5A03, 0x002A, 0x2000,
+  0x2008, 0x2010, 0x4118, 0x8120, 0xC120, 0xE128, 0x2139, 0x8239,
+  0x034A, 0x2452, 0x846A, 0x45E6, 0x47FF, 0x68FF, 0x49F7, 0x69FF,
+  0x4AFF, 0xB5FF, 0xD6FF, 0xB6FF, 0x8DF7, 0x4AFF, 0x69FF, 0x49FF,
+  0x48F7, 0x47FF, 0x27FF, 0xC5EE, 0xA372, 0x8341, 0x8239, 0x2139,
+  0xE128, 0x8118, 0xA018, 0x2010, 0x2008, 0x2000, 0x2000, 0x0000,
+  0x0000, 0x5B03, 0x002B, 0x2008, 0x2000, 0x2010, 0x4118, 0x8118,
+  0xC120, 0xE128, 0x6231, 0x8349, 0xE349, 0x2452, 0x458C, 0x47FF,
+  0x48F7, 0x69FF, 0x49FF, 0x4AF7, 0xAFFF, 0xD7FF, 0xB7FF, 0xD7FF,
+  0xAFFF, 0x6AFF, 0x4AFF, 0x69F7, 0x49FF, 0x48FF, 0x47FF, 0x26FF,
+  0xC5E6, 0xC37A, 0x8349, 0x2139, 0xE128, 0xC118, 0x8120, 0x4118,
+  0x4008, 0x2008, 0x2000, 0x0000, 0x0000, 0x0000, 0x5C02, 0x002B,
+  0x2000, 0x0008, 0x4008, 0x2010, 0x8010, 0x8118, 0xE128, 0x2231,
+  0x6231, 0x8349, 0x445A, 0x8462, 0xC6E6, 0x68FF, 0x49FF, 0x6AFF,
+  0x4AFF, 0x8DFF, 0xD6FF, 0xD7FF, 0xD7FF, 0xD7F7, 0xB2FF, 0x8CFF,
+  0x8CF7, 0x6AFF, 0x49FF, 0x69FF, 0x48F7, 0x47FF, 0x26FF, 0x05F7,
+  0xA5C5, 0x8231, 0xC128, 0xC118, 0x8120, 0x8010, 0x4008, 0x2000,
+  0x2008, 0x2000, 0x0000, 0x5D03, 0x002A, 0x2008, 0x2008, 0x4008,
+  0x8010, 0xA118, 0xE128, 0x2231, 0x8239, 0x8341, 0x2452, 0xA5C5,
+  0x47F7, 0x49FF, 0x69FF, 0x4AF7, 0xAFFF, 0xB7FF, 0xD8FF, 0xD8FF,
+  0xD8FF, 0xD8FF, 0xD6FF, 0x8DFF, 0x8DFF, 0x8CFF, 0x6AF7, 0x49FF,
+  0x48FF, 0x47FF, 0x46FF, 0x45FF, 0x45F7, 0xE483, 0x2231, 0xE128,
+  0xA018, 0x8010, 0x4008, 0x4008, 0x2000, 0x0000, 0x0000, 0x5E02,
+  0x002B, 0x2000, 0x2000, 0x4008, 0x4008, 0xA018, 0xC120, 0xE128,
+  0x2231, 0x8239, 0x034A, 0xC483, 0x67FF, 0x48FF, 0x69FF, 0x4AFF,
+  0xAFFF, 0xD7FF, 0xD8FF, 0xD8FF, 0xD8FF, 0xD8FF, 0xD8FF, 0xD8FF,
+  0xB0FF, 0xAFFF, 0x8DF7, 0x8CFF, 0x4AFF, 0x69FF, 0x48F7, 0x47FF,
+  0x45FF, 0x25FF, 0xA5BD, 0x2229, 0xC128, 0x8118, 0x8010, 0x4008,
+  0x4008, 0x2000, 0x0000, 0x0000, 0x5F01, 0x002D, 0x2000, 0x0000,
+  0x2000, 0x4008, 0x4008, 0xA018, 0xC118, 0xE128, 0x6231, 0x8239,
+  0x2452, 0xC6DE, 0x47FF, 0x69FF, 0x8AF7, 0xAFFF, 0xD7FF, 0xD8FF,
+  0xD8FF, 0xD9FF, 0xF9FF, 0xD9FF, 0xFAFF, 0xD9FF, 0xD8FF, 0xB0FF,
+  0x8DFF, 0x8CFF, 0x8CF7, 0x6AFF, 0x48FF, 0x47FF, 0x46FF, 0x45FF,
+  0x24F7, 0x6239, 0x0121, 0xC120, 0xA018, 0x4008, 0x4008, 0x2008,
+  0x2000, 0x0000, 0x0000, 0x6002, 0x002C, 0x2000, 0x2008, 0x4008,
+  0x6010, 0xA018, 0xC118, 0x0129, 0x6231, 0x8239, 0x6594, 0x86FF,
+  0x48FF, 0x69FF, 0x8CFF, 0xD7FF, 0xD8FF, 0xD8FF, 0xD9FF, 0xDAFF,
+  0xFBFF, 0xDBFF, 0xFBFF, 0xDAFF, 0xFAFF, 0xD9FF, 0xD2FF, 0x8DFF,
+  0x8CF7, 0x8AFF, 0x69FF, 0x48FF, 0x66F7, 0x65FF, 0x44FF, 0x624A,
+  0xE120, 0xC118, 0xA018, 0x4008, 0x4008, 0x2000, 0x0000, 0x0000,
+  0x0000, 0x6101, 0x002C, 0x2000, 0x0000, 0x2008, 0x4008, 0x8010,
+  0xA010, 0xC120, 0xE120, 0x6231, 0xE349, 0x05E7, 0x66FF, 0x88FF,
+  0x8AF7, 0xD5FF, 0xD7FF, 0xD8FF, 0xF9FF, 0xDAFF, 0xFBFF, 0xDBFF,
+  0xDCFF, 0xFCFF, 0xFBFF, 0xDBFF, 0xDAFF, 0xD8FF, 0xD4FF, 0x8DFF,
+  0xABFF, 0x89FF, 0x88FF, 0x66FF, 0x85FF, 0x44FF, 0x8473, 0x0121,
+  0xC120, 0xA018, 0x4008, 0x4008, 0x2008, 0x2000, 0x0000, 0x6202,
+  0x002B, 0x2000, 0x2008, 0x6008, 0x8010, 0xA018, 0xC120, 0x0121,
+  0x6239, 0x439C, 0x86FF, 0x88FF, 0x89FF, 0xAFFF, 0xD7FF, 0xD8FF,
+  0xD8FF, 0xD9FF, 0xDBFF, 0xFCFF, 0xFCFF, 0xFDFF, 0xFDFF, 0xDCFF,
+  0xDBFF, 0xFAFF, 0xD9FF, 0xF8FF, 0xD4FF, 0x8CF7, 0x8AFF, 0x89FF,
+  0x66F7, 0x46FF, 0x45F7, 0x2394, 0xE120, 0xC120, 0xA010, 0x6010,
+  0x4008, 0x2000, 0x2008, 0x0000, 0x6301, 0x002C, 0x2000, 0x2000,
+  0x2008, 0x4008, 0x6010, 0xA010, 0xC120, 0x0121, 0x4231, 0xA5E6,
+  0x66F7, 0x88FF, 0x89FF, 0xD4F7, 0xD7FF, 0xD8FF, 0xD9FF, 0xFAFF,
+  0xDBFF, 0xDCFF, 0xFDFF, 0xFEFF, 0xFEFF, 0xFDFF, 0xFCFF, 0xFBFF,
+  0xDAFF, 0xD8FF, 0xD7FF, 0x8DFF, 0xAAFF, 0x89FF, 0x88FF, 0x66FF,
+  0x85FF, 0xC4A4, 0x0129, 0xC120, 0xA018, 0x8010, 0x4008, 0x2000,
+  0x0000, 0x0000, 0x6402, 0x002B, 0x2008, 0x2000, 0x6008, 0x8010,
+  0xA018, 0xC120, 0x0129, 0x6252, 0x85FF, 0x66FF, 0x88FF, 0xABFF,
+  0xD6FF, 0xD7FF, 0xD8FF, 0xD9FF, 0xDAFF, 0xFBFF, 0xFDFF, 0xFEFF,
+  0xFEFF, 0xFEFF, 0xFEFF, 0xFCFF, 0xDBFF, 0xDAFF, 0xF9FF, 0xD8FF,
+  0xB0FF, 0x8BFF, 0x89FF, 0x88F7, 0x86FF, 0x65FF, 0x45AD, 0xE120,
+  0xC118, 0xA018, 0x8010, 0x2008, 0x2000, 0x2000, 0x0000, 0x6501,
+  0x002C, 0x2000, 0x2000, 0x2000, 0x4008, 0x6010, 0xA018, 0xC120,
+  0x0121, 0xC47B, 0x66F7, 0x87FF, 0x88FF, 0x8CF7, 0xD7FF, 0xD7FF,
+  0xD8FF, 0xD9FF, 0xFAFF, 0xDBFF, 0xFDFF, 0xFEFF, 0xFEFF, 0xFEFF,
+  0xFEFF, 0xFCFF, 0xDBFF, 0xFAFF, 0xD9FF, 0xD8FF, 0xD2FF, 0x8BFF,
+  0x89FF, 0x88FF, 0x87FF, 0x86FF, 0xC5C5, 0x0129, 0xC118, 0xA018,
+  0x8010, 0x4008, 0x2008, 0x0000, 0x0000, 0x6602, 0x002B, 0x2008,
+  0x2000, 0x4008, 0x8010, 0xA018, 0xC120, 0x0129, 0xC4A4, 0x86FF,
+  0x87FF, 0x88FF, 0x8BFF, 0xD7FF, 0xD7FF, 0xD8FF, 0xD9FF, 0xFAFF,
+  0xDBFF, 0xFCFF, 0xFDFF, 0xFEFF, 0xFEFF, 0xFDFF, 0xFCFF, 0xDBFF,
+  0xDAFF, 0xD8FF, 0xD8FF, 0xD2FF, 0x8BF7, 0x89FF, 0x88FF, 0x87F7,
+  0x86FF, 0xA5C5, 0xE120, 0xC118, 0xA010, 0x8010, 0x2008, 0x2000,
+  0x2008, 0x0000, 0x6702, 0x002C, 0x2000, 0x2000, 0x4008, 0x6010,
+  0xA018, 0xC118, 0x0121, 0x45AD, 0x66FF, 0x87FF, 0x89F7, 0x8AFF,
+  0xD5FF, 0xD7FF, 0xD8FF, 0xF9FF, 0xDAFF, 0xFAFF, 0xDBFF, 0xDCFF,
+  0xFDFF, 0xFDFF, 0xFCFF, 0xFBFF, 0xDAFF, 0xD9FF, 0xD8FF, 0xD8FF,
+  0xD4FF, 0xABFF, 0x89FF, 0x88FF, 0x87FF, 0x86FF, 0x65B5, 0x0129,
+  0xC120, 0x8010, 0x4008, 0x4008, 0x2000, 0x0000, 0x0000, 0x0000,
+  0x6802, 0x002A, 0x2000, 0x2008, 0x4008, 0x4008, 0x8010, 0xC120,
+  0x0121, 0x65B5, 0x86FF, 0x87FF, 0x88FF, 0x8AFF, 0xB0FF, 0xF7FF,
+  0xD8FF, 0xD8FF, 0xD9FF, 0xFAFF, 0xDBFF, 0xFBFF, 0xDBFF, 0xFBFF,
+  0xDBFF, 0xFBFF, 0xDAFF, 0xF9FF, 0xD8FF, 0xD7FF, 0xD4FF, 0x8BFF,
+  0x89F7, 0x88FF, 0x87FF, 0x86F7, 0xA4A4, 0xC118, 0x8010, 0x8010,
+  0x4008, 0x4008, 0x2000, 0x0000, 0x6901, 0x002C, 0x2000, 0x0000,
+  0x2000, 0x4008, 0x4008, 0x6010, 0xA018, 0xA118, 0x03B5, 0x87F7,
+  0x87FF, 0x88FF, 0xAAF7, 0xACFF, 0xD7FF, 0xD7FF, 0xD8FF, 0xD8FF,
+  0xD9FF, 0xFAFF, 0xDAFF, 0xFBFF, 0xDBFF, 0xFAFF, 0xDAFF, 0xF9FF,
+  0xD8FF, 0xD8FF, 0xD7FF, 0xB2F7, 0xAAFF, 0x89FF, 0xA8FF, 0x87FF,
+  0x86FF, 0x439C, 0xC120, 0xA018, 0x8010, 0x4008, 0x4008, 0x2008,
+  0x0000, 0x0000, 0x6A03, 0x0029, 0x2000, 0x4008, 0x4008, 0x8010,
+  0xA018, 0xC120, 0x6594, 0xA7FF, 0x87FF, 0xA8FF, 0x89FF, 0x8AFF,
+  0xD4FF, 0xD7FF, 0xD8FF, 0xD8FF, 0xF9FF, 0xD9FF, 0xFAFF, 0xDAFF,
+  0xFAFF, 0xD9FF, 0xF9FF, 0xD8FF, 0xD8FF, 0xD7FF, 0xD7F7, 0xB2FF,
+  0xAAFF, 0x89FF, 0xA8F7, 0xA7FF, 0x87FF, 0x0363, 0xC118, 0x8010,
+  0x8010, 0x4008, 0x4008, 0x2000, 0x0000, 0x6B03, 0x0027, 0x2000,
+  0x4008, 0x4008, 0x8010, 0x8010, 0xC118, 0x0363, 0x87FF, 0x87FF,
+  0xA8F7, 0x89FF, 0xAAFF, 0xADFF, 0xF7F7, 0xD7FF, 0xD8FF, 0xD8FF,
+  0xF8FF, 0xD9FF, 0xF9FF, 0xD9FF, 0xF9FF, 0xD8FF, 0xF8FF, 0xD8FF,
+  0xD7FF, 0xD7FF, 0xB0FF, 0xAAFF, 0x89FF, 0xA8FF, 0xA7FF, 0xA7FF,
+  0xE241, 0xA018, 0x6010, 0x8010, 0x4008, 0x2000, 0x6C03, 0x0029,
+  0x2008, 0x2000, 0x4008, 0x4008, 0x8010, 0xA018, 0x6239, 0xA7FF,
+  0x87FF, 0xA8FF, 0xA8FF, 0x8AFF, 0xABFF, 0xD4FF, 0xD7FF, 0xD7FF,
+  0xD8FF, 0xD8FF, 0xD8FF, 0xD4F7, 0xB0FF, 0xD5FF, 0xD8FF, 0xD8FF,
+  0xD7FF, 0xD7FF, 0xD7F7, 0xAFFF, 0xAAFF, 0xA8FF, 0xA8F7, 0xA7FF,
+  0x07E7, 0xA118, 0x8010, 0x8010, 0x4008, 0x4008, 0x2000, 0x0000,
+  0x0000, 0x6D04, 0x0021, 0x2000, 0x4008, 0x4008, 0x8010, 0x8010,
+  0xA118, 0x26C6, 0xA7FF, 0xA8FF, 0xA8FF, 0xC9F7, 0x8AFF, 0xAFFF,
+  0xF7FF, 0xD7F7, 0xD7FF, 0xF8FF, 0xD6FF, 0xAFFF, 0xAFFF, 0xAFFF,
+  0xF6FF, 0xD7FF, 0xF7FF, 0xD6FF, 0xD6FF, 0xAFFF, 0xC9FF, 0xA8FF,
+  0xA8FF, 0xC7FF, 0x65B5, 0xC120, 0x6D2A, 0x0001, 0x0000, 0x6E04,
+  0x0027, 0x2000, 0x4008, 0x4008, 0x6010, 0x8010, 0xA018, 0x236B,
+  0xA7FF, 0xA8FF, 0xA8FF, 0xC9FF, 0xCAFF, 0xCBFF, 0xD4FF, 0xD6FF,
+  0xD7FF, 0xD7FF, 0xB0F7, 0xADFF, 0xCDFF, 0xADFF, 0xB0F7, 0xD7FF,
+  0xD7FF, 0xD6FF, 0xD6FF, 0xCCFF, 0xC9FF, 0xA8FF, 0xA8F7, 0xA7FF,
+  0x0363, 0x8010, 0x6010, 0x4008, 0x4008, 0x2000, 0x2000, 0x0000,
+  0x6F05, 0x0026, 0x2000, 0x4008, 0x4008, 0x8010, 0x8010, 0xA118,
+  0x26C6, 0xA8FF, 0xA8FF, 0xA9FF, 0xC9F7, 0xAAFF, 0xADFF, 0xD6FF,
+  0xD7FF, 0xD6FF, 0xACFF, 0xCCFF, 0x49AD, 0xCBDE, 0xCCF7, 0xB2FF,
+  0xF6FF, 0xD6FF, 0xD6FF, 0xC9FF, 0xC9FF, 0xA8FF, 0xA8FF, 0x07EF,
+  0xC120, 0x8010, 0x8010, 0x4008, 0x4008, 0x2008, 0x0000, 0x2000,
+  0x7004, 0x0025, 0x2000, 0x2000, 0x4008, 0x2008, 0x4008, 0x8010,
+  0xA018, 0xA362, 0xC8FF, 0xA8FF, 0xC9FF, 0xC9FF, 0xA9FF, 0xCAFF,
+  0xB0FF, 0xD6FF, 0xD4FF, 0xCBF7, 0xCBDE, 0x2452, 0x4594, 0xCBFF,
+  0xCBFF, 0xD2FF, 0xD6FF, 0xD2FF, 0xC9F7, 0xA9FF, 0xA8FF, 0xA8FF,
+  0xC47B, 0x8010, 0x8008, 0x4008, 0x4008, 0x2000, 0x2008, 0x7106,
+  0x0023, 0x2000, 0x4008, 0x4008, 0x8010, 0x6010, 0x8010, 0xA5BD,
+  0xA8FF, 0xC9FF, 0xA9FF, 0xC9F7, 0xC9FF, 0xCBFF, 0xB0FF, 0xCDFF,
+  0xCBFF, 0x49AD, 0xE349, 0x2452, 0xAAFF, 0xCAF7, 0xCBFF, 0xAFFF,
+  0xADFF, 0xC9FF, 0xA8FF, 0xA8FF, 0xE6E6, 0xC120, 0x8010, 0x4010,
+  0x4008, 0x4008, 0x2000, 0x2000, 0x7206, 0x0024, 0x2000, 0x2008,
+  0x4008, 0x4008, 0x8010, 0xA018, 0x6231, 0x68F7, 0xC9FF, 0xC9FF,
+  0xC9FF, 0xA9FF, 0xCAFF, 0xCAFF, 0xCAFF, 0xCAF7, 0xC47B, 0x8239,
+  0x8239, 0x68D6, 0xEAFF, 0xCAFF, 0xC9FF, 0xA9FF, 0xC9FF, 0xA9FF,
+  0xA8F7, 0x0363, 0x6008, 0x6010, 0x4008, 0x4008, 0x2000, 0x2008,
+  0x0000, 0x2000, 0x7307, 0x0021, 0x2000, 0x4008, 0x4008, 0x4008,
+  0x6010, 0x6008, 0xA35A, 0x88F7, 0xA9F7, 0xC9FF, 0xA9FF, 0xC9FF,
+  0xCAFF, 0xCAFF, 0xEAFF, 0x6252, 0x6231, 0x4231, 0xA4A4, 0xCAFF,
+  0xCAFF, 0xC9FF, 0xA9FF, 0xC9FF, 0xC9FF, 0x65B5, 0x8010, 0x8010,
+  0x4008, 0x4008, 0x2008, 0x2000, 0x0000, 0x7407, 0x0021, 0x2000,
+  0x2008, 0x4008, 0x2008, 0x4008, 0x8010, 0x8010, 0x6473, 0xC9FF,
+  0xC9FF, 0xC9FF, 0xC9FF, 0xCAFF, 0xCAFF, 0xC8DE, 0x0229, 0x2229,
+  0x2229, 0x6252, 0xCAFF, 0xCAFF, 0xC9FF, 0xC9FF, 0xA9FF, 0xC8DE,
+  0xA118, 0x6010, 0x4008, 0x4008, 0x2000, 0x2000, 0x0000, 0x2000,
+  0x7509, 0x001E, 0x2000, 0x4008, 0x4008, 0x4008, 0x6010, 0x6008,
+  0x0363, 0x08E7, 0xC9FF, 0xCAFF, 0xEAFF, 0xA9FF, 0x6473, 0x0129,
+  0xC118, 0xC120, 0xA118, 0x06C6, 0xC9FF, 0xCAFF, 0xEAFF, 0xC8E6,
+  0x6231, 0x8010, 0x4008, 0x4008, 0x4008, 0x2008, 0x0000, 0x0000,
+  0x7608, 0x001E, 0x2000, 0x0000, 0x2008, 0x4008, 0x4008, 0x4008,
+  0x4008, 0x8010, 0xC120, 0x8473, 0x6594, 0x036B, 0x0121, 0xA018,
+  0xA018, 0xA010, 0xA018, 0xA018, 0xE241, 0xA9F7, 0xCAFF, 0x45B5,
+  0xC118, 0x4008, 0x4008, 0x4008, 0x4008, 0x2000, 0x0000, 0x0000,
+  0x770B, 0x0018, 0x2000, 0x2000, 0x4008, 0x4008, 0x4008, 0x4008,
+  0x8010, 0x6010, 0x8010, 0x6010, 0xA018, 0xA018, 0xA018, 0x8010,
+  0x6010, 0x8010, 0x2229, 0x2231, 0x6008, 0x4008, 0x2008, 0x4008,
+  0x2008, 0x2000, 0x780A, 0x001A, 0x2000, 0x0000, 0x2008, 0x2000,
+  0x2008, 0x4008, 0x4008, 0x4008, 0x4008, 0x6008, 0x8010, 0x6010,
+  0x8010, 0x6010, 0x8010, 0x4008, 0x4008, 0x6010, 0x4008, 0x4008,
+  0x4008, 0x2008, 0x2000, 0x2000, 0x0000, 0x0000, 0x790E, 0x0016,
+  0x2008, 0x2000, 0x2000, 0x4008, 0x2008, 0x4008, 0x4008, 0x4008,
+  0x6008, 0x4008, 0x2008, 0x4008, 0x2000, 0x4008, 0x4008, 0x2008,
+  0x2000, 0x2008, 0x0000, 0x2000, 0x0000, 0x0000, 0x7A0D, 0x0016,
+  0x2000, 0x0000, 0x2000, 0x2008, 0x2000, 0x2008, 0x2000, 0x4008,
+  0x4008, 0x2008, 0x4008, 0x2000, 0x2000, 0x2008, 0x2000, 0x2008,
+  0x2000, 0x0000, 0x2000, 0x0000, 0x0000, 0x0000, 0x7B0F, 0x0012,
+  0x2000, 0x0000, 0x2000, 0x2000, 0x2008, 0x2000, 0x2008, 0x2000,
+  0x2008, 0x2000, 0x2008, 0x2000, 0x2008, 0x0000, 0x2000, 0x0000,
+  0x0000, 0x0000, 0x7C12, 0x000F, 0x0000, 0x2000, 0x0000, 0x2000,
+  0x0000, 0x2000, 0x0000, 0x2000, 0x0000, 0x2000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x7D12, 0x000D, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x7E16, 0x0007, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0E17, 0x0005, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0F15, 0x0007, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x1013, 0x000B, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x1111, 0x000F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x1212, 0x000F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x1312, 0x000E, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x140F, 0x0013, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1510,
+  0x0012, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x160E, 0x0015, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x4151, 0x0292, 0xA169, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x170E, 0x0015, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x6118, 0x82AA, 0xE2DA, 0xE2DA, 0xE2E2, 0xC169, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x180F, 0x0015, 0x0000, 0x0000, 0x0000, 0x2010, 0xA2DA,
+  0xE2DA, 0xE2E2, 0xE2DA, 0xE2DA, 0x82D2, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x190E, 0x0015, 0x0000, 0x0000, 0x0000, 0x0000, 0xA169, 0xE2DA,
+  0xE2DA, 0xE2DA, 0xE2E2, 0xE2DA, 0xE2E2, 0x2008, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1A0C,
+  0x0019, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA2D2,
+  0xE2DA, 0xE2DA, 0xE2E2, 0xE2DA, 0xE2DA, 0xE2DA, 0x6118, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x1B0D, 0x0017, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x6118, 0xE2E2, 0xE2DA, 0xE2DA, 0xE2DA, 0xA2D2, 0xE2DA, 0xE2E2,
+  0x6120, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x1C0D, 0x0018, 0x0000, 0x0000, 0x0000,
+  0x0000, 0xE240, 0xE2DA, 0xE2DA, 0x82AA, 0xC130, 0x0000, 0x4110,
+  0xE291, 0x2010, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1D0D, 0x0018, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x2141, 0xE2DA, 0xA2DA, 0x6120, 0x2000,
+  0x0000, 0x0000, 0x2000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1E0C,
+  0x0019, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE240, 0x23E3,
+  0x2141, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x1F0B, 0x001B, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x8118, 0x82AA, 0x2000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x200D,
+  0x0018, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xC130, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x210C, 0x001B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA169, 0x2182,
+  0xA028, 0x2000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x220B, 0x001B,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0xA169, 0x61DB, 0x61E3, 0x2141,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x230B, 0x001C, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0131, 0x61DB, 0x61E3, 0x22C3, 0x2000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x240B, 0x001C, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x2000, 0x0000, 0x2000, 0x4118,
+  0x61E3, 0x61E3, 0x61DB, 0xA028, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x250B,
+  0x001B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x2000, 0x0000, 0x2000, 0x0000, 0x2000, 0x0000, 0x61E3, 0x61DB,
+  0x61E3, 0xA118, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x260A, 0x001C, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x2000, 0x0000, 0x2000, 0x0000,
+  0x2000, 0x0000, 0x2000, 0x0000, 0x22CB, 0xC1E3, 0x61E3, 0x2000,
+  0x0000, 0x0000, 0x2000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x270A, 0x001D, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x2000, 0x0000, 0x2000, 0x0000, 0x2000, 0x0000, 0x2000, 0x0000,
+  0x2000, 0x0000, 0x62AA, 0xC1E3, 0x8292, 0x2008, 0x0000, 0x2000,
+  0x0000, 0x2000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x280B, 0x001C, 0x0000, 0x0000, 0x0000, 0x2000, 0x0000,
+  0x2008, 0x0000, 0x2000, 0x0000, 0x2008, 0x0008, 0x2000, 0x0008,
+  0x82B2, 0xC1E3, 0x2141, 0x0000, 0x0000, 0x2000, 0x0000, 0x2000,
+  0x0000, 0x2000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x290A,
+  0x001C, 0x0000, 0x0000, 0x0000, 0x0000, 0x2000, 0x0000, 0x2000,
+  0x0000, 0x2008, 0x2000, 0x0008, 0x2000, 0x0000, 0x0000, 0x82AA,
+  0x61E3, 0x2008, 0x0008, 0x2008, 0x0000, 0x2000, 0x0000, 0x2000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2A0B, 0x001C, 0x0000,
+  0x2000, 0x0000, 0x2000, 0x0000, 0x2008, 0x0008, 0x2000, 0x2008,
+  0x0008, 0x2008, 0x0000, 0x2008, 0x22B3, 0x217A, 0x0008, 0x0008,
+  0x2000, 0x0008, 0x2000, 0x0000, 0x2000, 0x0000, 0x2000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x2B0C, 0x001A, 0x0000, 0x2000, 0x0000,
+  0x2008, 0x0000, 0x2008, 0x0008, 0x2000, 0x0008, 0x2008, 0x0008,
+  0x0000, 0x22CB, 0xA118, 0x2008, 0x0008, 0x2008, 0x0008, 0x2000,
+  0x0008, 0x2008, 0x0000, 0x2000, 0x0000, 0x0000, 0x0000, 0x2C0A,
+  0x001C, 0x0000, 0x2000, 0x0000, 0x2000, 0x0008, 0x2008, 0x0008,
+  0xC128, 0x2008, 0x0008, 0x2008, 0x2008, 0x2008, 0x2010, 0x2239,
+  0x2008, 0x2008, 0x0008, 0x2008, 0x0008, 0x2008, 0x0008, 0x2000,
+  0x2000, 0x0000, 0x2000, 0x0000, 0x0000, 0x2D0A, 0x001D, 0x2000,
+  0x0000, 0x2000, 0x0008, 0x2000, 0x0008, 0xA169, 0x217A, 0x2008,
+  0x2008, 0x2010, 0x2008, 0x2008, 0x2008, 0x2010, 0x2010, 0x2010,
+  0x2008, 0x2008, 0x2000, 0x0008, 0x2008, 0x0008, 0x2008, 0x0000,
+  0x2000, 0x0000, 0x2000, 0x0000, 0x2E09, 0x001E, 0x2000, 0x0000,
+  0x2000, 0x0000, 0x2008, 0x0008, 0xC169, 0xC1EB, 0x8118, 0x2008,
+  0x2010, 0x2010, 0x2010, 0x2010, 0x2010, 0x2010, 0x2010, 0x2010,
+  0x2010, 0x2008, 0x2008, 0x2008, 0x0008, 0x2008, 0x0000, 0x2008,
+  0x0000, 0x2000, 0x0000, 0x0000, 0x2F09, 0x001C, 0x2000, 0x0000,
+  0x2000, 0x0000, 0x0000, 0x8028, 0xC1E3, 0x22CB, 0x2010, 0x2010,
+  0x2010, 0x2010, 0x2010, 0x2010, 0x2010, 0x2010, 0x2010, 0x2010,
+  0x2010, 0x2010, 0x2008, 0x2008, 0x2000, 0x0008, 0x2008, 0x0008,
+  0x2000, 0x0000, 0x3009, 0x001C, 0x2000, 0x0008, 0x2008, 0x0008,
+  0x2000, 0xA169, 0x81EC, 0xE19A, 0x2010, 0x2010, 0x2010, 0x4110,
+  0x4118, 0x4118, 0x6120, 0x4110, 0x4118, 0x4118, 0x2010, 0x2010,
+  0x2010, 0x2008, 0x2008, 0x0008, 0x0008, 0x2008, 0x0000, 0x2000,
+  0x3109, 0x001E, 0x2000, 0x0000, 0x2008, 0x0000, 0x2008, 0x4151,
+  0x61EC, 0x22B3, 0x2010, 0x2010, 0x4118, 0x4118, 0x4110, 0x8120,
+  0xC159, 0x4118, 0x4118, 0x4118, 0x4110, 0x4118, 0x2010, 0x2010,
+  0x2008, 0x2008, 0x0008, 0x2008, 0x0008, 0x2008, 0x0000, 0x2000,
+  0x3207, 0x0021, 0x2000, 0x0000, 0x2000, 0x0008, 0x2008, 0x0008,
+  0x2008, 0x4110, 0x41E4, 0xA2CB, 0x4110, 0x4110, 0x4118, 0x4118,
+  0x6120, 0xE19A, 0x4151, 0x4110, 0x4118, 0x4118, 0x4118, 0x4110,
+  0x4118, 0x2010, 0x2010, 0x2010, 0x2008, 0x0008, 0x2008, 0x0000,
+  0x2000, 0x0000, 0x2000, 0x3307, 0x0020, 0x2000, 0x0000, 0x2000,
+  0x0000, 0x2008, 0x2008, 0x2008, 0x2010, 0xA161, 0x61F4, 0xC130,
+  0x4118, 0x6118, 0x4118, 0x217A, 0x81F4, 0xA169, 0x6118, 0x6120,
+  0x6118, 0x6120, 0x4118, 0x4118, 0x4110, 0x2010, 0x2010, 0x2008,
+  0x2008, 0x0008, 0x2008, 0x0008, 0x2000, 0x3406, 0x0022, 0x2000,
+  0x0000, 0x2000, 0x0008, 0x2008, 0x0008, 0x2008, 0x2008, 0x2010,
+  0x4118, 0x217A, 0x8292, 0x6118, 0x6120, 0x4151, 0x81EC, 0x61EC,
+  0xE19A, 0x6120, 0x8120, 0x6120, 0x6118, 0x6120, 0x4110, 0x4118,
+  0x4118, 0x2010, 0x2010, 0x2008, 0x0008, 0x0008, 0x2000, 0x0000,
+  0x2000, 0x3507, 0x0021, 0x2000, 0x0000, 0x2000, 0x0008, 0x2008,
+  0x2008, 0x2010, 0x2010, 0x4118, 0x4118, 0x6118, 0x6118, 0xA128,
+  0x21DC, 0xA1EC, 0xA1EC, 0x61EC, 0x6251, 0x6120, 0x8120, 0x8128,
+  0x6118, 0x6120, 0x4118, 0x4110, 0x4118, 0x2010, 0x2008, 0x2008,
+  0x0008, 0x2008, 0x0008, 0x2000, 0x3606, 0x0023, 0x2000, 0x0008,
+  0x2008, 0x0000, 0x2008, 0x2008, 0x2010, 0x2010, 0x4118, 0x4118,
+  0x6118, 0x6120, 0x8120, 0x81B3, 0xA1EC, 0x81EC, 0xA1E4, 0x81EC,
+  0x61EC, 0x6249, 0x8120, 0x6120, 0x8120, 0x6120, 0x6118, 0x4118,
+  0x4118, 0x2010, 0x2010, 0x2008, 0x0008, 0x0008, 0x2000, 0x0000,
+  0x2000, 0x3706, 0x0024, 0x2000, 0x0000, 0x2008, 0x0008, 0x2008,
+  0x2008, 0x2010, 0x4118, 0x4118, 0x6118, 0x6118, 0x6120, 0x017A,
+  0xC1EC, 0xC1F4, 0xC1EC, 0xC1F4, 0xC1F4, 0xE1F4, 0x61EC, 0x0162,
+  0xA128, 0x8128, 0x8120, 0x6120, 0x6120, 0x4110, 0x4118, 0x2010,
+  0x2008, 0x2008, 0x2008, 0x0008, 0x2008, 0x0000, 0x2000, 0x3805,
+  0x0025, 0x2000, 0x0000, 0x2000, 0x0008, 0x2008, 0x2008, 0x2010,
+  0x2010, 0x4118, 0x4118, 0x6120, 0x8120, 0x2141, 0xA1EC, 0xC1F4,
+  0xC1F4, 0xC1EC, 0xC1F4, 0xC1EC, 0xC1F4, 0xC1EC, 0xC1F4, 0x61AB,
+  0xE230, 0x8128, 0x8120, 0x6118, 0x6120, 0x4118, 0x2010, 0x2010,
+  0x2008, 0x0008, 0x0008, 0x2000, 0x0000, 0x2000, 0x3905, 0x0025,
+  0x2000, 0x0000, 0x2000, 0x0008, 0x0008, 0x2008, 0x2010, 0x4118,
+  0x4118, 0x6118, 0x8120, 0x8120, 0x01CC, 0xC1EC, 0xC1F4, 0xC1EC,
+  0xC1F4, 0xC1EC, 0xC1F4, 0xC1EC, 0xC1F4, 0xC1EC, 0xC1F4, 0x41E4,
+  0x4151, 0x8120, 0x8128, 0x6118, 0x4118, 0x4118, 0x2010, 0x2008,
+  0x2008, 0x0008, 0x2008, 0x0000, 0x2000, 0x3A04, 0x0027, 0x2000,
+  0x0000, 0x2000, 0x0008, 0x2008, 0x2008, 0x2010, 0x2010, 0x4118,
+  0x6120, 0x6118, 0x8120, 0x8182, 0xE1F4, 0xC1F4, 0x02F5, 0x02F5,
+  0x02F5, 0x43F5, 0x02ED, 0x02F5, 0x02F5, 0x02F5, 0x02ED, 0x02F5,
+  0xA1E4, 0x4272, 0x6120, 0x6118, 0x6120, 0x4118, 0x2010, 0x2010,
+  0x2008, 0x0008, 0x0000, 0x2000, 0x0000, 0x2000, 0x3B04, 0x0026,
+  0x2000, 0x0000, 0x2000, 0x0008, 0x0008, 0x2008, 0x2010, 0x4118,
+  0x4110, 0x6118, 0x6120, 0x0239, 0xA1E4, 0x02F5, 0x02F5, 0x02F5,
+  0x01ED, 0x83F5, 0xA7F6, 0x45F6, 0x43F5, 0x21F5, 0x01F5, 0x21F5,
+  0x02F5, 0x02F5, 0x22F5, 0xE19A, 0x8120, 0x6120, 0x4118, 0x4118,
+  0x2010, 0x2008, 0x0008, 0x2008, 0x0000, 0x2000, 0x3C06, 0x0024,
+  0x0008, 0x2008, 0x0008, 0x2008, 0x2010, 0x4118, 0x6118, 0x6120,
+  0x8120, 0x81B3, 0x21F5, 0x21F5, 0x01F5, 0x21F5, 0x01F5, 0xC4F5,
+  0xA7F6, 0xA7F6, 0xA7F6, 0xA3F5, 0x42F5, 0x21F5, 0x01F5, 0x21F5,
+  0x01ED, 0x02F5, 0xE19A, 0x4118, 0x6118, 0x4118, 0x2010, 0x2008,
+  0x0008, 0x2008, 0x0000, 0x2000, 0x3D04, 0x0028, 0x0000, 0x2000,
+  0x0000, 0x0008, 0x2008, 0x2010, 0x2010, 0x4118, 0x6118, 0x6120,
+  0xC151, 0x02ED, 0x01F5, 0x21F5, 0x42F5, 0x42ED, 0x42F5, 0xE5F5,
+  0xA7FE, 0xA7F6, 0xA7F6, 0xA7F6, 0x82F5, 0x42F5, 0x42F5, 0x01F5,
+  0x21F5, 0x21F5, 0x21F5, 0x4272, 0x6120, 0x4118, 0x4118, 0x2010,
+  0x2008, 0x2008, 0x0008, 0x2000, 0x0000, 0x2000, 0x3E03, 0x0028,
+  0x2000, 0x0008, 0x2000, 0x0008, 0x2008, 0x2008, 0x2010, 0x4118,
+  0x4110, 0x6120, 0x8120, 0x02C4, 0x21F5, 0x01F5, 0x42F5, 0x42F5,
+  0x42ED, 0x82F5, 0x66F6, 0xE8FE, 0xE8F6, 0x08FF, 0xE8F6, 0x45F6,
+  0x42F5, 0x42F5, 0x42F5, 0x42ED, 0x01F5, 0x21F5, 0x81E4, 0xA128,
+  0x4110, 0x4118, 0x2010, 0x2008, 0x0008, 0x2008, 0x0000, 0x2000,
+  0x3F03, 0x0029, 0x2000, 0x0000, 0x2000, 0x0008, 0x0008, 0x2008,
+  0x2010, 0x4110, 0x6118, 0x6120, 0xC151, 0x01F5, 0x42F5, 0x42ED,
+  0x82F5, 0x62F5, 0x82F5, 0xA3F5, 0xE8F6, 0x08FF, 0xE8F6, 0x08FF,
+  0xE8F6, 0x66F6, 0x62F5, 0x82F5, 0x82F5, 0x42F5, 0x42F5, 0x42F5,
+  0x21F5, 0x218B, 0x6120, 0x4118, 0x2010, 0x2008, 0x2008, 0x0000,
+  0x2008, 0x0000, 0x2000, 0x4005, 0x0026, 0x0008, 0x2008, 0x0008,
+  0x2010, 0x2010, 0x4110, 0x6120, 0x8120, 0x21CC, 0x42F5, 0x42F5,
+  0x82F5, 0x62F5, 0x82F5, 0xA2F5, 0x45F6, 0xE8F6, 0xE8FE, 0x08F7,
+  0xE8FE, 0x08F7, 0x45F6, 0x82F5, 0xA2F5, 0x82F5, 0x62F5, 0x42F5,
+  0x42ED, 0x42F5, 0x61AB, 0x6118, 0x4110, 0x2010, 0x2010, 0x2008,
+  0x0008, 0x0008, 0x2000, 0x4103, 0x0029, 0x2000, 0x0000, 0x2000,
+  0x0008, 0x2008, 0x2010, 0x2010, 0x4118, 0x6118, 0x6141, 0x42F5,
+  0x42ED, 0x62F5, 0x82F5, 0xA2F5, 0x82F5, 0x24F6, 0x08F7, 0xE8FE,
+  0x08F7, 0xE8FE, 0x08F7, 0xE8FE, 0x04F6, 0xA2F5, 0xA2F5, 0x62F5,
+  0x82F5, 0x82F5, 0x42F5, 0x62F5, 0x819B, 0x6120, 0x4118, 0x4110,
+  0x2010, 0x2008, 0x0008, 0x2008, 0x0000, 0x2000, 0x4203, 0x0029,
+  0x0000, 0x2000, 0x0008, 0x2008, 0x2008, 0x2010, 0x4118, 0x4118,
+  0x6120, 0x218B, 0x62F5, 0x82F5, 0x62F5, 0xA2F5, 0xA2F5, 0x45F6,
+  0xE8FE, 0x08F7, 0xE8FE, 0x29FF, 0x09F7, 0x29FF, 0xE8FE, 0x04F6,
+  0xE3F5, 0xC3F5, 0xA2F5, 0xA2F5, 0x62F5, 0x82F5, 0x42ED, 0x6141,
+  0x6120, 0x6118, 0x4118, 0x2010, 0x2008, 0x0008, 0x2000, 0x0000,
+  0x2000, 0x4303, 0x002A, 0x2000, 0x0000, 0x2000, 0x0008, 0x2008,
+  0x2010, 0x4118, 0x4118, 0x6120, 0xA1C4, 0x82F5, 0x62F5, 0xA2F5,
+  0xA2F5, 0x85F6, 0x08F7, 0xE8FE, 0x08F7, 0x09FF, 0x29FF, 0x09FF,
+  0x29F7, 0x08FF, 0x03F6, 0xE3F5, 0xE3F5, 0xC3FD, 0xA2F5, 0xA2F5,
+  0xA2F5, 0x819B, 0x8128, 0x8128, 0x6118, 0x4118, 0x2010, 0x2008,
+  0x2008, 0x0008, 0x2000, 0x0008, 0x2000, 0x4402, 0x002B, 0x2000,
+  0x0000, 0x2008, 0x0008, 0x2008, 0x2008, 0x2010, 0x4118, 0x6118,
+  0xA130, 0x82FD, 0xA1F5, 0xA2F5, 0xC2F5, 0x04F6, 0x08FF, 0xE8F6,
+  0x29FF, 0x09FF, 0x29FF, 0x09F7, 0x29FF, 0x09FF, 0x08F7, 0x23F6,
+  0xE3F5, 0x03F6, 0xE2F5, 0xC2F5, 0xA2F5, 0xA1CC, 0xC230, 0x8128,
+  0x8120, 0x6118, 0x4118, 0x2010, 0x2010, 0x0008, 0x0000, 0x2008,
+  0x0000, 0x2000, 0x4504, 0x0026, 0x0000, 0x0008, 0x2008, 0x2008,
+  0x2010, 0x4118, 0x6118, 0x8141, 0x81F5, 0xA2F5, 0xC2F5, 0xA2F5,
+  0x03F6, 0x08F7, 0x09FF, 0x29FF, 0x09F7, 0x29FF, 0x09FF, 0x29FF,
+  0x09FF, 0xA7F6, 0x23F6, 0x23FE, 0x03F6, 0xE2F5, 0xE2F5, 0xA1CC,
+  0x4249, 0xC130, 0xA128, 0x8128, 0x6118, 0x4118, 0x2010, 0x2010,
+  0x0008, 0x2008, 0x4602, 0x002B, 0x2000, 0x0000, 0x2008, 0x0008,
+  0x2008, 0x2008, 0x2010, 0x4118, 0x6120, 0x216A, 0xA1F5, 0xC2F5,
+  0xC2F5, 0xE2F5, 0xE2F5, 0x23F6, 0xA7FE, 0x29FF, 0x09FF, 0x69F7,
+  0x49FF, 0x69FF, 0x49FF, 0xA7F6, 0x64F6, 0x43F6, 0x23F6, 0xE3F5,
+  0x02DD, 0xA251, 0x0239, 0xE238, 0xC128, 0xA128, 0x6120, 0x4110,
+  0x4118, 0x2010, 0x0008, 0x0008, 0x2000, 0x0000, 0x2000, 0x4708,
+  0x0024, 0x4110, 0x4118, 0x6118, 0xA151, 0xA2F5, 0xC2F5, 0xC2F5,
+  0xE2F5, 0x02F6, 0xE3F5, 0x23F6, 0x64F6, 0x85F6, 0x07FF, 0x48FF,
+  0x69F7, 0x49FF, 0x84FE, 0x64F6, 0x43F6, 0x23FE, 0x63D5, 0x2362,
+  0x6249, 0x2249, 0xE230, 0xC130, 0xA128, 0x6120, 0x4118, 0x4118,
+  0x2010, 0x2008, 0x2008, 0x0000, 0x2000, 0x4808, 0x0025, 0x4118,
+  0x4118, 0x8120, 0xE238, 0xC2FD, 0xC2F5, 0xE2F5, 0x02F6, 0x02F6,
+  0x23F6, 0x43F6, 0x64FE, 0x84F6, 0x84F6, 0x84FE, 0xC4F6, 0xE5FE,
+  0x84F6, 0x84F6, 0x44F6, 0xA2E5, 0x826A, 0xA251, 0x6249, 0x2241,
+  0xE238, 0xC130, 0x8128, 0x6120, 0x4110, 0x4118, 0x2010, 0x2008,
+  0x0008, 0x2000, 0x0000, 0x2000, 0x4902, 0x002A, 0x0000, 0x2000,
+  0x0000, 0x0008, 0x2008, 0x2010, 0x4118, 0x4110, 0x6120, 0x8120,
+  0xA1CC, 0xE2F5, 0xE2F5, 0x02F6, 0x23FE, 0x43F6, 0x44F6, 0x83F6,
+  0x84F6, 0xA4FE, 0xC4F6, 0xE5FE, 0xC4F6, 0xA4F6, 0x84FE, 0x63F6,
+  0x2383, 0x2362, 0xC259, 0x6251, 0x4241, 0x0239, 0xC130, 0x8128,
+  0x8128, 0x6118, 0x4118, 0x2010, 0x2008, 0x2008, 0x0008, 0x2000,
+  0x4A01, 0x002A, 0x0000, 0x2000, 0x0000, 0x2008, 0x0008, 0x2008,
+  0x2010, 0x4118, 0x6118, 0x8128, 0xA128, 0x0162, 0x02FE, 0x02F6,
+  0x23F6, 0x23FE, 0x43F6, 0x64F6, 0x84FE, 0xA4F6, 0xC4F6, 0xC5FE,
+  0x05F7, 0xE5FE, 0xC4F6, 0xA4FE, 0x43CD, 0xA372, 0x2362, 0xA251,
+  0x8349, 0x4241, 0x0239, 0xE238, 0xA128, 0x8120, 0x6118, 0x4118,
+  0x2010, 0x2008, 0x0008, 0x0008, 0x4B01, 0x0004, 0x0000, 0x2000,
+  0x0000, 0x2008, 0x4B0A, 0x0023, 0x6120, 0xA128, 0xA128, 0x0383,
+  0x02F6, 0x22F6, 0x43F6, 0x44F6, 0x83FE, 0x84F6, 0xA4F6, 0xC5FE,
+  0x05F7, 0x05FF, 0x05F7, 0xE5FE, 0xE4FE, 0xC39B, 0xC37A, 0x2362,
+  0x2362, 0xC259, 0x2241, 0x2241, 0x2383, 0xA128, 0x8120, 0x6120,
+  0x4118, 0x2010, 0x2008, 0x0008, 0x2000, 0x0000, 0x2000, 0x4C02,
+  0x002A, 0x0000, 0x2000, 0x0000, 0x2008, 0x2008, 0x2010, 0x4118,
+  0x6120, 0x8120, 0x8128, 0xC130, 0x0239, 0xC259, 0x838B, 0x43AC,
+  0xC2C4, 0xA2E5, 0xC4F6, 0xC4FE, 0x05F7, 0x05FF, 0x45FF, 0x05F7,
+  0x05F7, 0xC4FE, 0x638B, 0xC372, 0x2362, 0x2362, 0xA251, 0x2241,
+  0xC159, 0xC2E5, 0xA128, 0x8120, 0x6120, 0x4110, 0x2010, 0x2008,
+  0x0008, 0x0008, 0x2000, 0x4D06, 0x0027, 0x2008, 0x2010, 0x4110,
+  0x6120, 0x6120, 0xA128, 0xC130, 0x0239, 0x4241, 0xA259, 0x2362,
+  0x826A, 0xA372, 0x03B5, 0xC5FE, 0x05F7, 0x45FF, 0x45F7, 0x45FF,
+  0x05FF, 0xE5FE, 0x838B, 0xC37A, 0x826A, 0x2362, 0xA259, 0x4241,
+  0x0162, 0x22F6, 0x216A, 0x8120, 0x6120, 0x4118, 0x2010, 0x2008,
+  0x0008, 0x2000, 0x0000, 0x2000, 0x4E01, 0x002C, 0x0000, 0x0000,
+  0x2000, 0x2000, 0x0008, 0x2008, 0x2010, 0x4118, 0x6120, 0x8120,
+  0xA128, 0xE238, 0x0239, 0x4241, 0xA259, 0x2362, 0x826A, 0xC37A,
+  0x43AC, 0xE5FE, 0x05FF, 0x45FF, 0x45FF, 0x45FF, 0x05F7, 0xC5FE,
+  0x2394, 0xC372, 0x826A, 0x2362, 0xA251, 0x2241, 0x2383, 0x22FE,
+  0xC39B, 0x6120, 0x6118, 0x4118, 0x2010, 0x2008, 0x0008, 0x2008,
+  0x0000, 0x2000, 0x4F01, 0x0028, 0x0000, 0x2000, 0x0000, 0x2000,
+  0x0008, 0x2008, 0x2010, 0x4118, 0x6118, 0x8120, 0xA128, 0xE238,
+  0x0239, 0x6251, 0xA251, 0x2362, 0x826A, 0xA372, 0x03B5, 0x05FF,
+  0x06F7, 0x45FF, 0x46FF, 0x45FF, 0x05F7, 0x05FF, 0x63D5, 0xC372,
+  0x8272, 0x2362, 0xA251, 0x6249, 0xC39B, 0x42FE, 0xA2E5, 0x8120,
+  0x6120, 0x4118, 0x2010, 0x2008, 0x5002, 0x002B, 0x0000, 0x2000,
+  0x0008, 0x2008, 0x2008, 0x2010, 0x4118, 0x6120, 0x8120, 0x8128,
+  0xE238, 0x0239, 0x6251, 0xC251, 0x2362, 0x8272, 0xC372, 0x03DE,
+  0x05FF, 0x26F7, 0x46FF, 0x46FF, 0x46FF, 0x26F7, 0x05F7, 0xE5FE,
+  0xA39B, 0x826A, 0x2362, 0xA251, 0x6251, 0xC2C4, 0x62F6, 0x42F6,
+  0xA130, 0x6118, 0x4110, 0x2010, 0x2008, 0x0008, 0x2008, 0x0000,
+  0x2000, 0x5102, 0x002B, 0x0000, 0x2000, 0x0008, 0x0008, 0x2008,
+  0x2010, 0x4110, 0x6120, 0x8120, 0xA130, 0xE230, 0x4241, 0x8272,
+  0xA251, 0x0362, 0x826A, 0x0383, 0xC5EE, 0x05F7, 0x26FF, 0x46FF,
+  0x46F7, 0x46FF, 0x06FF, 0x05F7, 0xE5FE, 0xA4FE, 0xC39B, 0x2362,
+  0xA259, 0xA251, 0x43EE, 0x62F6, 0x62FE, 0x8149, 0x6120, 0x4118,
+  0x2010, 0x2008, 0x2008, 0x0000, 0x2000, 0x0000, 0x5201, 0x0029,
+  0x0000, 0x2000, 0x0000, 0x2008, 0x0000, 0x2008, 0x2010, 0x4118,
+  0x6120, 0x8120, 0xA130, 0xE230, 0x63B4, 0xC372, 0xA259, 0x2362,
+  0x8462, 0xC3A3, 0x25FF, 0x05F7, 0x26FF, 0x26FF, 0x46F7, 0x4AFF,
+  0x26FF, 0x05F7, 0x05F7, 0xC5FE, 0xC4F6, 0x03B5, 0xA372, 0xC2C4,
+  0x82F6, 0x82FE, 0x62F6, 0xA151, 0x6118, 0x4118, 0x2010, 0x2008,
+  0x0008, 0x5301, 0x002A, 0x0000, 0x2000, 0x0000, 0x2008, 0x0008,
+  0x2008, 0x2010, 0x4110, 0x6120, 0x6120, 0xA128, 0x2383, 0x82FE,
+  0xC251, 0xA251, 0x2362, 0xA372, 0x03B5, 0x05FF, 0x06F7, 0x26FF,
+  0x26F7, 0x4AFF, 0xB0FF, 0x06F7, 0x26FF, 0x05F7, 0xC5FE, 0xE5F6,
+  0xC4FE, 0xA4F6, 0xA4FE, 0x82F6, 0x82F6, 0xA2FE, 0xC159, 0x6120,
+  0x4110, 0x2010, 0x2008, 0x0008, 0x2008, 0x5402, 0x002B, 0x0000,
+  0x2000, 0x0000, 0x2008, 0x2008, 0x2010, 0x4118, 0x6120, 0x8120,
+  0x0139, 0x43F6, 0x02E6, 0x8341, 0xC251, 0x2362, 0xC372, 0x03DE,
+  0x05FF, 0x26FF, 0x26F7, 0x46FF, 0x4CFF, 0x94FF, 0x07F7, 0x26F7,
+  0x05FF, 0x05F7, 0xE5FE, 0xC4F6, 0xA4F6, 0xA4FE, 0xA2F6, 0x82F6,
+  0x82F6, 0x0131, 0x4118, 0x4118, 0x2010, 0x2008, 0x0008, 0x2000,
+  0x0000, 0x2000, 0x5501, 0x002B, 0x0000, 0x0000, 0x2000, 0x0000,
+  0x0008, 0x2008, 0x2010, 0x4118, 0x6118, 0x8128, 0x8193, 0x82FE,
+  0x63D5, 0xA251, 0x2362, 0x8462, 0xC372, 0xE5F6, 0x06F7, 0x26FF,
+  0x46F7, 0x27FF, 0xB0F7, 0x95FF, 0x4AFF, 0x26FF, 0x06F7, 0x05FF,
+  0x05F7, 0xE5FE, 0xC4F6, 0xC3FE, 0xC2F6, 0xC2FE, 0x63D5, 0xA128,
+  0x8120, 0x4110, 0x2010, 0x2008, 0x2008, 0x0008, 0x2000, 0x5603,
+  0x0027, 0x0000, 0x2008, 0x0008, 0x2008, 0x2010, 0x4110, 0xA120,
+  0xA128, 0x02E6, 0xC2FE, 0xC2BC, 0xA251, 0x2362, 0x846A, 0x2394,
+  0x26FF, 0x27FF, 0x07FF, 0x47FF, 0x47F7, 0xB4FF, 0x95FF, 0xB0FF,
+  0x27F7, 0x07FF, 0x26F7, 0x05F7, 0x05FF, 0xE5FE, 0xC4F6, 0xC3F6,
+  0xA2FE, 0x2183, 0xA128, 0x8118, 0x4118, 0x4118, 0x2008, 0x0008,
+  0x5703, 0x002A, 0x0000, 0x2008, 0x0008, 0x2008, 0x2010, 0x4110,
+  0x8118, 0xA151, 0xC2FE, 0xE3FE, 0x43AC, 0xA251, 0x2362, 0x6462,
+  0x26CE, 0x07F7, 0x27FF, 0x47F7, 0x48FF, 0x4AFF, 0xB5F7, 0x95FF,
+  0xB4FF, 0x47FF, 0x07F7, 0x07FF, 0x26FF, 0x05F7, 0xE5F6, 0xE5FE,
+  0xC3FE, 0x02E6, 0x4249, 0xE128, 0xA118, 0x6120, 0x4118, 0x2010,
+  0x0008, 0x2000, 0x0000, 0x2000, 0x5801, 0x002C, 0x0000, 0x0000,
+  0x2000, 0x0000, 0x2008, 0x2010, 0x4118, 0x6120, 0x8118, 0xA272,
+  0xC2FE, 0xC3FE, 0x2394, 0xA251, 0x2362, 0x2383, 0x26FF, 0x27FF,
+  0x47FF, 0x48FF, 0x48F7, 0x8DFF, 0x95FF, 0xB5FF, 0x95FF, 0x4CF7,
+  0x48FF, 0x47FF, 0x48F7, 0x26FF, 0x05F7, 0x05FF, 0x04F7, 0xA372,
+  0x0131, 0xE128, 0x8120, 0x8118, 0x4118, 0x2010, 0x2008, 0x2008,
+  0x0000, 0x2000, 0x5901, 0x0029, 0x0000, 0x0000, 0x2000, 0x0000,
+  0x2008, 0x2010, 0x4118, 0x8118, 0x8118, 0x0383, 0xC3F6, 0x04FF,
+  0x43B4, 0x2452, 0x6462, 0x03B5, 0x27F7, 0x47FF, 0x48FF, 0x49FF,
+  0x69F7, 0xB2FF, 0xB6FF, 0xD6FF, 0xB6FF, 0xB2FF, 0x48FF, 0x4CF7,
+  0x4CFF, 0x27FF, 0x26F7, 0x05FF, 0xC5EE, 0x8349, 0x6231, 0xE128,
+  0xC120, 0x8120, 0x8010, 0x2010, 0x4008, 0x5A05, 0x0027, 0x4008,
+  0x2010, 0x6010, 0x8120, 0xC118, 0x23BD, 0x23FF, 0x04FF, 0x03B5,
+  0x2452, 0x6462, 0xC5F6, 0x68FF, 0x48FF, 0x49FF, 0x6AFF, 0x4AF7,
+  0xD5FF, 0xD6FF, 0xB6FF, 0xD6FF, 0xB6FF, 0xB0FF, 0xB6FF, 0x4CFF,
+  0x47FF, 0x07F7, 0x26FF, 0xC5EE, 0xC341, 0x6231, 0x2229, 0xE128,
+  0x8120, 0x8010, 0x2010, 0x2008, 0x0000, 0x2000, 0x5B03, 0x0028,
+  0x0000, 0x2000, 0x2008, 0x2010, 0x8010, 0x8118, 0x424A, 0x23F7,
+  0x03FF, 0x04FF, 0x45DE, 0x2452, 0x03B5, 0x47FF, 0x48FF, 0x49F7,
+  0x6AFF, 0x4AFF, 0xAFF7, 0xB7FF, 0xD7FF, 0xB7FF, 0xD7FF, 0xB7FF,
+  0xB6FF, 0xD6FF, 0x8DFF, 0x48FF, 0x47FF, 0x26FF, 0x26FF, 0x439C,
+  0xA239, 0x2229, 0xE128, 0xC120, 0xA018, 0x4008, 0x4008, 0x2008,
+  0x5C02, 0x002A, 0x0000, 0x2000, 0x2008, 0x4008, 0x2010, 0x6010,
+  0x8120, 0xC4A4, 0x23FF, 0x23FF, 0x05F7, 0x26FF, 0xA5C5, 0x47F7,
+  0x48FF, 0x69FF, 0x4AFF, 0x6AF7, 0x8CFF, 0xD5FF, 0xD7FF, 0xD7FF,
+  0xD7FF, 0xD7F7, 0xB7FF, 0xD7FF, 0xB6FF, 0xB0FF, 0x49FF, 0x48F7,
+  0x47FF, 0x45FF, 0xE5F6, 0xC372, 0x6231, 0xC128, 0xC118, 0xA018,
+  0x4110, 0x4008, 0x2000, 0x0000, 0x5D03, 0x002A, 0x0000, 0x2000,
+  0x4008, 0x4008, 0xA018, 0xA118, 0x03D6, 0x03F7, 0x03F7, 0x45FF,
+  0x46FF, 0x47FF, 0x48F7, 0x69FF, 0x4AFF, 0x4AFF, 0x8CF7, 0xB0FF,
+  0xD8FF, 0xD8FF, 0xD8FF, 0xD8FF, 0xD8FF, 0xD8FF, 0xD7FF, 0xD7FF,
+  0xD5FF, 0x8CFF, 0x48F7, 0x47FF, 0x46FF, 0x45FF, 0xC5EE, 0xE349,
+  0x2231, 0xC120, 0xA018, 0x8010, 0x4008, 0x2000, 0x2008, 0x2000,
+  0x5E02, 0x002A, 0x0000, 0x0000, 0x2000, 0x4008, 0x4008, 0xA018,
+  0xC120, 0x23DE, 0x23FF, 0x44FF, 0x45F7, 0x46FF, 0x47FF, 0x48FF,
+  0x49F7, 0x4AFF, 0x8CFF, 0x8DFF, 0xD5FF, 0xD8FF, 0xD8FF, 0xD9FF,
+  0xF9FF, 0xD8FF, 0xD8FF, 0xD8FF, 0xD7FF, 0xD7FF, 0xB5FF, 0x4AF7,
+  0x48FF, 0x47FF, 0x45F7, 0x44FF, 0xA5C5, 0x2229, 0xE120, 0xA010,
+  0x8010, 0x4008, 0x2000, 0x2008, 0x5F01, 0x002C, 0x0000, 0x2000,
+  0x0000, 0x2008, 0x4008, 0x8010, 0x8010, 0xA118, 0x03D6, 0x03F7,
+  0x44FF, 0x45F7, 0x46FF, 0x48FF, 0x69FF, 0x4AF7, 0x8CFF, 0x8DFF,
+  0xB0F7, 0xF9FF, 0xD9FF, 0xFAFF, 0xDAFF, 0xFAFF, 0xDAFF, 0xD9FF,
+  0xD8FF, 0xD8FF, 0xD7FF, 0xD7FF, 0xD2FF, 0x48FF, 0x47FF, 0x46FF,
+  0x45FF, 0x44FF, 0x8473, 0x0129, 0x8120, 0x8010, 0x4008, 0x4008,
+  0x2000, 0x2000, 0x6002, 0x002A, 0x0000, 0x2000, 0x2008, 0x6008,
+  0x8010, 0xA018, 0xC120, 0x03DE, 0x44FF, 0x44F7, 0x46FF, 0x86FF,
+  0x88FF, 0x49F7, 0xABFF, 0x8CFF, 0xAFFF, 0xD6FF, 0xD9FF, 0xDAFF,
+  0xFBFF, 0xDBFF, 0xFBFF, 0xDAFF, 0xFAFF, 0xD9FF, 0xD8FF, 0xD8FF,
+  0xD7FF, 0xD6FF, 0x8AFF, 0x88F7, 0x66FF, 0x65FF, 0x44F7, 0xA3E6,
+  0xE120, 0xC118, 0x6010, 0x4008, 0x4008, 0x2000, 0x6101, 0x002C,
+  0x0000, 0x0000, 0x2008, 0x2000, 0x4008, 0x8010, 0x8010, 0xA118,
+  0x03D6, 0x44FF, 0x44F7, 0x46FF, 0x87FF, 0x8CF7, 0xAAFF, 0x8CFF,
+  0x8DF7, 0xB0FF, 0xD9FF, 0xFAFF, 0xDBFF, 0xDCFF, 0xFCFF, 0xDCFF,
+  0xFCFF, 0xFBFF, 0xDAFF, 0xD9FF, 0xD8FF, 0xD7FF, 0xD6FF, 0xB0FF,
+  0x88FF, 0x66F7, 0x85FF, 0x44FF, 0x44FF, 0xE241, 0xC120, 0x8010,
+  0x4008, 0x4008, 0x2000, 0x2000, 0x6203, 0x0029, 0x2000, 0x2008,
+  0x4008, 0x8010, 0xA018, 0xC120, 0xC5C5, 0x44FF, 0x85FF, 0x66FF,
+  0x88FF, 0xD4FF, 0xB2FF, 0x8CF7, 0xAFFF, 0xD4FF, 0xDAFF, 0xFBFF,
+  0xFCFF, 0xFDFF, 0xFDFF, 0xFDFF, 0xFDFF, 0xDCFF, 0xDAFF, 0xF9FF,
+  0xD8FF, 0xD7FF, 0xD7FF, 0xD5FF, 0x89F7, 0x47FF, 0x66FF, 0x65F7,
+  0x44FF, 0x0363, 0xC118, 0x8018, 0x4008, 0x4008, 0x2000, 0x6301,
+  0x002C, 0x0000, 0x0000, 0x2000, 0x2000, 0x4008, 0x8010, 0x8018,
+  0xC118, 0x45AD, 0x44FF, 0x65F7, 0x66F7, 0x8BFF, 0xD6FF, 0xB6FF,
+  0xD4FF, 0xB0F7, 0xD7FF, 0xFAFF, 0xDBFF, 0xFDFF, 0xFEFF, 0xFEFF,
+  0xFEFF, 0xFDFF, 0xFCFF, 0xDBFF, 0xDAFF, 0xD8FF, 0xD8FF, 0xD7FF,
+  0xD6FF, 0x8CFF, 0x88FF, 0x66FF, 0x85FF, 0x44FF, 0xE483, 0xC120,
+  0xA018, 0x6010, 0x4008, 0x2000, 0x2000, 0x6402, 0x0029, 0x2000,
+  0x2008, 0x2000, 0x4010, 0x8010, 0xA018, 0xC120, 0x03B5, 0x85FF,
+  0x86FF, 0x87FF, 0xAFFF, 0xD6FF, 0xB7FF, 0xD7FF, 0xD8FF, 0xD9FF,
+  0xFAFF, 0xDBFF, 0xFDFF, 0xFEFF, 0xFEFF, 0xFEFF, 0xFEFF, 0xFCFF,
+  0xDBFF, 0xFAFF, 0xD9FF, 0xD8FF, 0xD7FF, 0xD6FF, 0xAFFF, 0x88F7,
+  0x66FF, 0x65FF, 0x65FF, 0xC47B, 0xC118, 0xA010, 0x6010, 0x4008,
+  0x6501, 0x002B, 0x0000, 0x0000, 0x2000, 0x4008, 0x4008, 0x6010,
+  0xA010, 0xC118, 0x2394, 0x65FF, 0x66FF, 0x87F7, 0xB0FF, 0xB6FF,
+  0xD7FF, 0xD7FF, 0xF8FF, 0xD9FF, 0xFAFF, 0xDBFF, 0xFDFF, 0xFEFF,
+  0xFEFF, 0xFEFF, 0xFDFF, 0xFCFF, 0xDBFF, 0xDAFF, 0xD8FF, 0xD8FF,
+  0xD7FF, 0xD6FF, 0xD2FF, 0x88FF, 0x87FF, 0x66FF, 0x85FF, 0x8473,
+  0xC120, 0x6010, 0x8010, 0x4008, 0x2008, 0x6602, 0x002A, 0x2000,
+  0x2008, 0x4008, 0x4008, 0x8010, 0xA018, 0xC120, 0xC483, 0x85FF,
+  0x86FF, 0x87FF, 0xB0FF, 0xD6FF, 0xB7FF, 0xD7FF, 0xD8FF, 0xD9FF,
+  0xFAFF, 0xDBFF, 0xFCFF, 0xFDFF, 0xFEFF, 0xFDFF, 0xFDFF, 0xFCFF,
+  0xDBFF, 0xDAFF, 0xD8FF, 0xD8FF, 0xD7FF, 0xD6FF, 0xD4F7, 0x88FF,
+  0x87FF, 0x66F7, 0x65FF, 0xA35A, 0x8010, 0x6010, 0x4008, 0x4008,
+  0x2000, 0x6704, 0x0029, 0x2008, 0x4008, 0x6010, 0xA010, 0xC118,
+  0x0363, 0x66FF, 0x66FF, 0x87F7, 0xB0FF, 0xD6FF, 0xD6FF, 0xD7FF,
+  0xD8FF, 0xD8FF, 0xD9FF, 0xFAFF, 0xDBFF, 0xDCFF, 0xFDFF, 0xFCFF,
+  0xFCFF, 0xDBFF, 0xFAFF, 0xD9FF, 0xD8FF, 0xD8FF, 0xB7FF, 0xD6FF,
+  0xD4FF, 0xA8FF, 0x87FF, 0x66FF, 0x85FF, 0xE241, 0xA018, 0x8010,
+  0x4008, 0x4008, 0x2008, 0x2000, 0x6802, 0x002A, 0x0000, 0x2008,
+  0x2000, 0x4008, 0x4008, 0x8010, 0xC120, 0xE241, 0x86FF, 0xA7FF,
+  0x87FF, 0xAFFF, 0xD6FF, 0xB6FF, 0xD7FF, 0xD8FF, 0xD8FF, 0xD9FF,
+  0xFAFF, 0xDBFF, 0xFBFF, 0xDBFF, 0xFBFF, 0xDBFF, 0xFAFF, 0xD9FF,
+  0xF9FF, 0xD8FF, 0xD7FF, 0xD7FF, 0xB6FF, 0xD5FF, 0x88FF, 0x87FF,
+  0x66FF, 0x25EF, 0xE120, 0xA010, 0x6010, 0x4008, 0x4008, 0x2000,
+  0x6901, 0x002C, 0x0000, 0x2000, 0x0000, 0x2000, 0x4008, 0x4008,
+  0x6010, 0xA010, 0xE120, 0x66F7, 0x87FF, 0x88F7, 0xADFF, 0xB6FF,
+  0xD6FF, 0xD7FF, 0xD7FF, 0xD8FF, 0xD8FF, 0xD9FF, 0xFAFF, 0xDAFF,
+  0xFAFF, 0xDAFF, 0xFAFF, 0xD9FF, 0xF9FF, 0xD8FF, 0xD8FF, 0xD7FF,
+  0xB7FF, 0xD6FF, 0xD2FF, 0x88FF, 0x87FF, 0x87FF, 0xC5C5, 0xC120,
+  0xA018, 0x8010, 0x4008, 0x4008, 0x2000, 0x2000, 0x6A03, 0x0029,
+  0x0000, 0x2000, 0x4008, 0x4008, 0x8010, 0xA018, 0xC120, 0x26CE,
+  0xA7FF, 0xA7FF, 0x8BFF, 0xD6FF, 0xD6FF, 0xB7FF, 0xD7FF, 0xD8FF,
+  0xD8FF, 0xD8FF, 0xD9FF, 0xF9FF, 0xD9FF, 0xF9FF, 0xD9FF, 0xF9FF,
+  0xD8FF, 0xD8FF, 0xD7FF, 0xD7FF, 0xD6FF, 0xF6FF, 0xB0FF, 0xA8F7,
+  0x87FF, 0x87FF, 0x2394, 0xC118, 0x8010, 0x8010, 0x2008, 0x2000,
+  0x2000, 0x6B03, 0x002A, 0x0000, 0x2000, 0x4008, 0x4008, 0x8010,
+  0x8010, 0xC118, 0x4594, 0x87F7, 0xA7FF, 0xA8FF, 0xD4F7, 0xD6FF,
+  0xF6FF, 0xD7FF, 0xD7FF, 0xD8FF, 0xF8FF, 0xD8FF, 0xD9FF, 0xF9FF,
+  0xD9FF, 0xF9FF, 0xD8FF, 0xF8FF, 0xD8FF, 0xD7FF, 0xD7FF, 0xF6FF,
+  0xD6FF, 0xCDFF, 0xA8FF, 0xA7FF, 0xA7FF, 0x6252, 0xA018, 0x8010,
+  0x4008, 0x2008, 0x4008, 0x2008, 0x2000, 0x6C03, 0x0028, 0x0000,
+  0x2008, 0x2000, 0x4008, 0x4008, 0x8010, 0xA018, 0x6252, 0xA7FF,
+  0xA7FF, 0xA8FF, 0xB0FF, 0xD6FF, 0xF6FF, 0xD7FF, 0xF7FF, 0xD7FF,
+  0xD8FF, 0xD8FF, 0xD8FF, 0xD8FF, 0xF8FF, 0xD8FF, 0xD8FF, 0xF8FF,
+  0xD7FF, 0xD7FF, 0xF6FF, 0xD6FF, 0xD5FF, 0xC9FF, 0xA8F7, 0xA7FF,
+  0x47EF, 0xA118, 0x8010, 0x8010, 0x4008, 0x4008, 0x2000, 0x6D04,
+  0x0027, 0x0000, 0x2000, 0x4008, 0x4008, 0x8008, 0x8010, 0xA118,
+  0x07E7, 0xA7FF, 0xA8FF, 0xCCFF, 0xD6FF, 0xF6FF, 0xD6FF, 0xF6FF,
+  0xD7F7, 0xF7FF, 0xD7FF, 0xF8FF, 0xD7FF, 0xB0FF, 0xD5FF, 0xD7FF,
+  0xF7FF, 0xD7FF, 0xF6FF, 0xD6FF, 0xF6FF, 0xB0FF, 0xA8FF, 0xA8FF,
+  0xA7FF, 0xC5C5, 0xC120, 0x8010, 0x6010, 0x4008, 0x4008, 0x2000,
+  0x6E04, 0x0027, 0x0000, 0x2008, 0x2008, 0x4008, 0x4008, 0x8010,
+  0xA018, 0xC4A4, 0xC7FF, 0xA8FF, 0xCBFF, 0xD6FF, 0xD6FF, 0xD6FF,
+  0xF6FF, 0xD6FF, 0xD7FF, 0xD7FF, 0xF6FF, 0xAFFF, 0xADFF, 0xD2FF,
+  0xD7FF, 0xF7F7, 0xD6FF, 0xF6FF, 0xD6FF, 0xD5FF, 0x8AFF, 0xA8FF,
+  0xA8FF, 0xA7F7, 0xC47B, 0xA010, 0x6010, 0x4008, 0x4008, 0x2000,
+  0x2008, 0x6F05, 0x0025, 0x0000, 0x2000, 0x4008, 0x4008, 0x8010,
+  0x8010, 0x424A, 0xA7FF, 0xA8FF, 0xC9F7, 0xD5FF, 0xD6FF, 0xF6FF,
+  0xD6FF, 0xF6FF, 0xD6FF, 0xD5FF, 0xADFF, 0xCCFF, 0xACFF, 0xAFF7,
+  0xB7FF, 0xD6FF, 0xF6FF, 0xD6FF, 0xD6FF, 0xAFFF, 0xC9FF, 0xA8FF,
+  0xC8FF, 0x07EF, 0x0129, 0x8010, 0x4008, 0x2008, 0x4008, 0x2000,
+  0x7004, 0x0025, 0x0000, 0x0000, 0x2000, 0x2008, 0x4008, 0x4008,
+  0x8010, 0xA018, 0xE6E6, 0xA8FF, 0xA8FF, 0xD2FF, 0xD6FF, 0xF6FF,
+  0xD6FF, 0xF6FF, 0xD4FF, 0xACFF, 0xCBFF, 0x68CE, 0xCBFF, 0xACFF,
+  0xD6FF, 0xF6FF, 0xD6FF, 0xF6FF, 0xB2FF, 0xC9F7, 0xA8FF, 0xA8FF,
+  0xA8FF, 0x646B, 0x8010, 0x8010, 0x4008, 0x4008, 0x2000, 0x7106,
+  0x0022, 0x0000, 0x2000, 0x2000, 0x4008, 0x4008, 0x6008, 0x6473,
+  0xA8FF, 0xA8F7, 0xCBFF, 0xD5FF, 0xD6FF, 0xD5FF, 0xB0FF, 0xCBFF,
+  0xCBFF, 0x68D6, 0xC341, 0x68CE, 0xCBFF, 0xD4FF, 0xD6FF, 0xD6FF,
+  0xD4FF, 0xCAFF, 0xA9FF, 0xC9FF, 0xC8FF, 0x26CE, 0xA018, 0x8010,
+  0x4008, 0x4008, 0x2008, 0x7208, 0x0022, 0x2000, 0x4008, 0x4008,
+  0x8010, 0xA018, 0xC8E6, 0xC9FF, 0xC9FF, 0xCAFF, 0xCBFF, 0xCAFF,
+  0xCAFF, 0xCAFF, 0xCAF7, 0x49AD, 0x8239, 0xC483, 0xEBFF, 0xCDFF,
+  0xD6FF, 0xD2FF, 0xCBFF, 0xC9F7, 0xA9FF, 0xC9FF, 0x48EF, 0x0229,
+  0x6008, 0x4008, 0x4008, 0x4008, 0x2000, 0x0000, 0x0000, 0x7307,
+  0x0022, 0x0000, 0x2000, 0x2000, 0x4008, 0x4008, 0x6008, 0x624A,
+  0x88F7, 0xA9FF, 0xC9FF, 0xC9FF, 0xCAFF, 0xCAFF, 0xCAFF, 0xEAFF,
+  0xC483, 0x6231, 0xC239, 0x89F7, 0xCAFF, 0xCAFF, 0xCAFF, 0xCAFF,
+  0xC9FF, 0xC9FF, 0xC9FF, 0xA362, 0x8010, 0x6008, 0x4008, 0x4008,
+  0x2000, 0x0000, 0x2000, 0x7408, 0x0020, 0x0000, 0x2008, 0x2000,
+  0x4008, 0x4008, 0x8010, 0x659C, 0xC9FF, 0xC9FF, 0xC9FF, 0xA9FF,
+  0xCAFF, 0xCAFF, 0xCAFF, 0xA35A, 0x0229, 0x2229, 0x26CE, 0xCAFF,
+  0xCAFF, 0xCAFF, 0xC9FF, 0xC9FF, 0xA9F7, 0xC47B, 0x6008, 0x4008,
+  0x4008, 0x2008, 0x2000, 0x2008, 0x0000, 0x7509, 0x0017, 0x0000,
+  0x2000, 0x4000, 0x4008, 0x4008, 0x8010, 0x45AD, 0xC9FF, 0xCAFF,
+  0xCAFF, 0xCAFF, 0xCAFF, 0x28EF, 0x0121, 0xC120, 0xC118, 0x6473,
+  0xCAFF, 0xCAFF, 0xCAFF, 0xCAFF, 0xC9FF, 0xE483, 0x7525, 0x0002,
+  0x2000, 0x2000, 0x7608, 0x001D, 0x0000, 0x2000, 0x0000, 0x2008,
+  0x2000, 0x4008, 0x4008, 0x8010, 0x659C, 0x6AF7, 0xCAFF, 0xCAFF,
+  0x28E7, 0xE341, 0x8010, 0xA018, 0xA018, 0xC120, 0x26CE, 0xEAFF,
+  0xCAFF, 0x68CE, 0xC349, 0x4008, 0x4008, 0x4000, 0x4008, 0x2000,
+  0x2008, 0x770A, 0x001C, 0x2000, 0x0000, 0x2000, 0x2000, 0x2008,
+  0x4008, 0x4008, 0x8010, 0x6239, 0x8239, 0xA010, 0x8010, 0x6010,
+  0x8010, 0x6010, 0x8010, 0xA018, 0xE241, 0x6239, 0x8010, 0x4008,
+  0x2000, 0x4008, 0x4008, 0x2008, 0x2000, 0x0000, 0x2000, 0x780A,
+  0x0018, 0x0000, 0x0000, 0x0000, 0x2008, 0x2000, 0x2008, 0x4008,
+  0x4008, 0x2008, 0x4008, 0x6008, 0x4008, 0x6008, 0x4008, 0x6010,
+  0x4008, 0x6008, 0x4008, 0x6010, 0x4008, 0x2008, 0x4000, 0x2000,
+  0x2008, 0x790E, 0x000D, 0x0000, 0x2000, 0x2008, 0x2000, 0x2000,
+  0x4008, 0x2008, 0x4000, 0x2008, 0x4008, 0x2008, 0x4000, 0x2008,
+  0x7920, 0x0003, 0x2000, 0x0000, 0x2000, 0x7A0D, 0x000C, 0x0000,
+  0x2000, 0x0000, 0x2000, 0x0000, 0x2008, 0x2000, 0x2008, 0x2000,
+  0x2008, 0x2000, 0x2008, 0x7A1E, 0x0003, 0x2000, 0x0000, 0x2000,
+  0x7B0F, 0x000D, 0x0000, 0x0000, 0x0000, 0x2000, 0x0000, 0x2008,
+  0x2000, 0x2008, 0x2000, 0x2008, 0x2000, 0x2008, 0x2000, 0x7C13,
+  0x0009, 0x0000, 0x2000, 0x0000, 0x2000, 0x0000, 0x2000, 0x0000,
+  0x2000, 0x0000, 0x1014, 0x0003, 0x6118, 0xE291, 0x4110, 0x1113,
+  0x0004, 0x2008, 0x62AA, 0xA2D2, 0x6159, 0x1213, 0x0004, 0x2141,
+  0xA2DA, 0xA2D2, 0xE289, 0x1314, 0x0003, 0x2141, 0xA2D2, 0xE291,
+  0x1414, 0x0003, 0x2000, 0xE291, 0x028A, 0x1515, 0x0002, 0x6120,
+  0x4151, 0x1615, 0x0003, 0x0000, 0x2000, 0x0000, 0x1713, 0x0008,
+  0x0000, 0x0000, 0x0000, 0x2000, 0x0000, 0x2000, 0x0000, 0x2000,
+  0x1812, 0x000D, 0x0000, 0x0000, 0x0000, 0x0000, 0x2000, 0x0000,
+  0x2000, 0x0000, 0x2000, 0x0000, 0x2000, 0x0000, 0x2000, 0x1912,
+  0x000F, 0x2000, 0x0000, 0x2000, 0x0000, 0x2000, 0x0008, 0x2000,
+  0x0000, 0x2000, 0x0000, 0x2000, 0x0000, 0x2000, 0x0000, 0x2000,
+  0x1A12, 0x0011, 0x2000, 0x0000, 0x2000, 0x0000, 0x2008, 0x0008,
+  0x2000, 0x0000, 0x2000, 0x0008, 0x2000, 0x0000, 0x2000, 0x0000,
+  0x2000, 0x0000, 0x2000, 0x1B0F, 0x0015, 0x2000, 0x0000, 0x2000,
+  0x0000, 0x2000, 0x0000, 0x2008, 0x0000, 0x2008, 0x0000, 0x2008,
+  0x0000, 0x2008, 0x0000, 0x2008, 0x0008, 0x2000, 0x0000, 0x2008,
+  0x0000, 0x2000, 0x1C0E, 0x0017, 0x2000, 0x0000, 0x2000, 0x0008,
+  0x2008, 0x0000, 0x2008, 0x0000, 0x2008, 0x0008, 0x2008, 0x0008,
+  0x2000, 0x0008, 0x2008, 0x0008, 0x2000, 0x0000, 0x2008, 0x0000,
+  0x2000, 0x0000, 0x2000, 0x1D0D, 0x001A, 0x2000, 0x0000, 0x2000,
+  0x0000, 0x2000, 0x0008, 0x2000, 0x0008, 0x2008, 0x0008, 0x2008,
+  0x2008, 0x2008, 0x2008, 0x0008, 0x2008, 0x0000, 0x2008, 0x0008,
+  0x2008, 0x0008, 0x2000, 0x0000, 0x2008, 0x0000, 0x2000, 0x1E0C,
+  0x001B, 0x2000, 0x0000, 0x2000, 0x0008, 0x2008, 0x0008, 0x2000,
+  0x0008, 0x2008, 0x2008, 0x2008, 0x2008, 0x2008, 0x2010, 0x2008,
+  0x2008, 0x2008, 0x2010, 0x2008, 0x0008, 0x2008, 0x0008, 0x2000,
+  0x0000, 0x2000, 0x0000, 0x2000, 0x1F0C, 0x001B, 0x2000, 0x0000,
+  0x2000, 0x0000, 0x2008, 0x0008, 0x2008, 0x2008, 0x2008, 0x2010,
+  0x2010, 0x2010, 0x2010, 0x2010, 0x2010, 0x2010, 0x2010, 0x2010,
+  0x2008, 0x2008, 0x2008, 0x0008, 0x2008, 0x0000, 0x2008, 0x0000,
+  0x2008, 0x200B, 0x001F, 0x2000, 0x0000, 0x2008, 0x0008, 0x2008,
+  0x2008, 0x2008, 0x2008, 0x2010, 0x2010, 0x2010, 0x2010, 0x4118,
+  0x4118, 0x4110, 0x4118, 0x4118, 0x4118, 0x2010, 0x2010, 0x2010,
+  0x2008, 0x2008, 0x0008, 0x2008, 0x0000, 0x2008, 0x0000, 0x2000,
+  0x0000, 0x2000, 0x210B, 0x001E, 0x2000, 0x0000, 0x2008, 0x0008,
+  0x2008, 0x2008, 0x2008, 0x2010, 0x2010, 0x4118, 0x4118, 0x4118,
+  0x4110, 0x4118, 0x4118, 0x4118, 0x4110, 0x4118, 0x4118, 0x4118,
+  0x2010, 0x2010, 0x2010, 0x2008, 0x2008, 0x2008, 0x0008, 0x2000,
+  0x0000, 0x2000, 0x2209, 0x0021, 0x2000, 0x0000, 0x2000, 0x0008,
+  0x2008, 0x0008, 0x2008, 0x2010, 0x2010, 0x2010, 0x4110, 0x4118,
+  0x4118, 0x6120, 0x6118, 0x6120, 0x6118, 0x6120, 0x6120, 0x6118,
+  0x4118, 0x4118, 0x4110, 0x4118, 0x2010, 0x2010, 0x2008, 0x2008,
+  0x2008, 0x0008, 0x2000, 0x0000, 0x2000, 0x2309, 0x0022, 0x2000,
+  0x0000, 0x2000, 0x0008, 0x2008, 0x2008, 0x2008, 0x2010, 0x4118,
+  0x4118, 0x4118, 0x6118, 0x6120, 0x6118, 0xA130, 0xE238, 0x8128,
+  0x8120, 0x8120, 0x6120, 0x6118, 0x6120, 0x4118, 0x4118, 0x4110,
+  0x2010, 0x2010, 0x2008, 0x0008, 0x2008, 0x0008, 0x2000, 0x0008,
+  0x2000, 0x2409, 0x0022, 0x2000, 0x0000, 0x2008, 0x0008, 0x2008,
+  0x2008, 0x2010, 0x4118, 0x4118, 0x4110, 0x6120, 0x8120, 0xA169,
+  0x22CB, 0x83E3, 0x83E3, 0x23DB, 0x82AA, 0x4151, 0x8120, 0x6120,
+  0x8120, 0x6120, 0x6118, 0x4118, 0x4118, 0x2010, 0x2010, 0x2008,
+  0x0008, 0x0008, 0x2000, 0x0000, 0x2000, 0x2509, 0x0022, 0x2000,
+  0x0000, 0x2008, 0x0008, 0x2008, 0x2010, 0x2010, 0x4118, 0x4110,
+  0x6118, 0x4151, 0x22BB, 0x83E3, 0x83E3, 0x83E3, 0x83E3, 0x83E3,
+  0x83E3, 0x83E3, 0x8292, 0xA130, 0x8120, 0x8120, 0x6120, 0x6118,
+  0x4118, 0x4118, 0x2010, 0x2010, 0x2008, 0x0008, 0x2008, 0x0000,
+  0x2000, 0x2607, 0x0024, 0x2000, 0x0000, 0x2008, 0x0008, 0x2008,
+  0x2008, 0x2010, 0x2010, 0x4118, 0x4110, 0x6120, 0x8120, 0x217A,
+  0x83EB, 0x83E3, 0x83E3, 0x83E3, 0x83E3, 0x83E3, 0x83DB, 0x83E3,
+  0x83E3, 0x62AA, 0xA128, 0xA120, 0x6120, 0x8120, 0x6120, 0x4110,
+  0x4118, 0x2010, 0x2008, 0x2008, 0x0008, 0x0008, 0x2000, 0x2707,
+  0x0026, 0x2000, 0x0000, 0x2008, 0x0008, 0x0008, 0x2008, 0x2010,
+  0x4110, 0x4118, 0x6118, 0x8120, 0x8120, 0xA128, 0x83E3, 0x83E3,
+  0x83E3, 0xC3E3, 0xE3E3, 0xC3EB, 0xE3E3, 0xC3E3, 0xE3EB, 0x83E3,
+  0x82AA, 0xA130, 0x8128, 0x8120, 0x6120, 0x6118, 0x4118, 0x2010,
+  0x2010, 0x2008, 0x2008, 0x0008, 0x2000, 0x0000, 0x2000, 0x2807,
+  0x0027, 0x2000, 0x0000, 0x2008, 0x0008, 0x2008, 0x2010, 0x2010,
+  0x4118, 0x6118, 0x8128, 0xA128, 0x8128, 0xC130, 0x22C3, 0xC3EB,
+  0xE3E3, 0xC3EB, 0xE3E3, 0xC3E3, 0xE3E3, 0xC3EB, 0xE3E3, 0xC3E3,
+  0xE3E3, 0x217A, 0xA128, 0x8128, 0x8120, 0x6120, 0x4110, 0x4118,
+  0x2010, 0x2008, 0x2008, 0x0008, 0x0008, 0x2000, 0x0000, 0x2000,
+  0x2906, 0x0027, 0x2000, 0x0000, 0x2008, 0x0000, 0x2008, 0x2008,
+  0x2010, 0x4118, 0x6118, 0xA169, 0xE238, 0x8128, 0xC130, 0xE230,
+  0x22B3, 0xE3E3, 0xC3E3, 0x24E4, 0x84EC, 0x24EC, 0x24E4, 0x24EC,
+  0xE3EB, 0xC3E3, 0xE3E3, 0x83EB, 0x2141, 0xA130, 0xA128, 0x8120,
+  0x6120, 0x4110, 0x2010, 0x2010, 0x2008, 0x0008, 0x2008, 0x0000,
+  0x2000, 0x2A07, 0x0027, 0x2000, 0x0000, 0x2008, 0x2008, 0x2010,
+  0x2010, 0x4118, 0xE238, 0x83E3, 0xA169, 0xC128, 0xE238, 0x2139,
+  0xA2CB, 0x24EC, 0x24EC, 0x84EC, 0x48F6, 0x84EC, 0x24E4, 0x24EC,
+  0x24E4, 0x24EC, 0x24E4, 0xC3E3, 0x02C3, 0xE230, 0xA128, 0x8120,
+  0x6120, 0x6118, 0x4118, 0x2010, 0x2008, 0x0008, 0x0008, 0x2000,
+  0x0000, 0x2000, 0x2B06, 0x0027, 0x2000, 0x0000, 0x2000, 0x0008,
+  0x2008, 0x2010, 0x4118, 0x6118, 0xE289, 0xE3EB, 0x4151, 0xC130,
+  0xE230, 0x2241, 0xC3E3, 0x24EC, 0x24E4, 0xC6EC, 0x28F6, 0xE8F5,
+  0x84EC, 0x63EC, 0x24E4, 0x24EC, 0x24EC, 0x24EC, 0x23EC, 0x217A,
+  0xC130, 0xA128, 0x8120, 0x6120, 0x4110, 0x2010, 0x2010, 0x0008,
+  0x2008, 0x0008, 0x2000, 0x2C06, 0x0027, 0x2000, 0x0008, 0x2008,
+  0x0008, 0x2010, 0x2010, 0x4110, 0x6120, 0x22CB, 0x22C3, 0xC130,
+  0xE230, 0x0239, 0x216A, 0x24EC, 0x24EC, 0x63EC, 0xE4EC, 0xA9F6,
+  0xA9F6, 0x28F6, 0xC4EC, 0x84EC, 0x63EC, 0x24EC, 0x24EC, 0x23E4,
+  0xC3E3, 0x6249, 0xA128, 0x8120, 0x6120, 0x6118, 0x2010, 0x2010,
+  0x2008, 0x0008, 0x0008, 0x2000, 0x2D05, 0x002A, 0x2000, 0x0000,
+  0x2000, 0x0008, 0x2008, 0x2010, 0x2010, 0x4110, 0x8128, 0xA2CB,
+  0xE240, 0xC130, 0x0239, 0x2241, 0xE19A, 0x63EC, 0x84EC, 0x84EC,
+  0x05ED, 0xA9F6, 0x89F6, 0xA9FE, 0x48F6, 0x25ED, 0x84EC, 0x63EC,
+  0x63EC, 0x23EC, 0x23EC, 0x22C3, 0xC130, 0x8128, 0x8120, 0x6120,
+  0x4118, 0x2010, 0x2008, 0x2008, 0x0008, 0x2000, 0x0000, 0x2000,
+  0x2E06, 0x0029, 0x2000, 0x0008, 0x2008, 0x2008, 0x2010, 0x4118,
+  0x4110, 0x6120, 0xA128, 0xA130, 0xE230, 0x0239, 0x6251, 0x43EC,
+  0x84EC, 0x84EC, 0xE4F4, 0x05ED, 0xA9FE, 0xA9F6, 0xA9F6, 0x89F6,
+  0xA9FE, 0xC8F5, 0x05ED, 0x63EC, 0x63EC, 0x23E4, 0x23EC, 0x0172,
+  0x8128, 0x8120, 0x6118, 0x4118, 0x2010, 0x2008, 0x0008, 0x0008,
+  0x2000, 0x0000, 0x2000, 0x2F05, 0x0029, 0x2000, 0x0000, 0x2008,
+  0x0008, 0x2008, 0x2010, 0x4110, 0x6120, 0x6120, 0xA128, 0xC130,
+  0xE230, 0x2241, 0x6292, 0x84EC, 0x84EC, 0xE4EC, 0xC4EC, 0xA6F5,
+  0x89F6, 0xA9F6, 0x89F6, 0xA9FE, 0x89F6, 0xA9F6, 0xA9F6, 0xA6F5,
+  0x63EC, 0x83EC, 0x23EC, 0xC3EB, 0xE238, 0x8120, 0x6120, 0x4118,
+  0x2010, 0x2010, 0x2008, 0x2008, 0x0000, 0x2000, 0x3005, 0x0029,
+  0x2000, 0x0000, 0x2008, 0x0008, 0x2008, 0x2010, 0x4110, 0x6120,
+  0x8120, 0xA130, 0xE238, 0x2239, 0x6251, 0x23EC, 0xA4EC, 0xE4EC,
+  0xC4EC, 0x44F5, 0xC9F6, 0xC9FE, 0xC9F6, 0xC9F6, 0xC9F6, 0xC9FE,
+  0xA9F6, 0xA9F6, 0x89F6, 0xC4EC, 0x63EC, 0x63EC, 0x23EC, 0x017A,
+  0x8120, 0x8120, 0x4118, 0x4110, 0x2010, 0x2008, 0x0008, 0x0008,
+  0x2000, 0x3104, 0x002B, 0x2000, 0x0000, 0x2000, 0x0008, 0x0008,
+  0x2008, 0x2010, 0x4118, 0x6118, 0xA128, 0xA130, 0xE230, 0x0231,
+  0x22B3, 0x84EC, 0xA2F4, 0xE4EC, 0x05ED, 0x89F6, 0xC9FE, 0xC9F6,
+  0xC9F6, 0xC9F6, 0xC9FE, 0xC9F6, 0xC9F6, 0xA9F6, 0xA9FE, 0xA6F5,
+  0x63EC, 0x63EC, 0x23EC, 0xA2CB, 0xA128, 0x8120, 0x6120, 0x4118,
+  0x2010, 0x2008, 0x0008, 0x2008, 0x0000, 0x2000, 0x3205, 0x002A,
+  0x2000, 0x0000, 0x2008, 0x0008, 0x2010, 0x2010, 0x4118, 0x6120,
+  0xA128, 0xA128, 0xE238, 0x627A, 0x63EC, 0xC2F4, 0xE4EC, 0x05ED,
+  0xA6F5, 0xC9F6, 0xC9FE, 0x29FF, 0x09F7, 0x29FF, 0xA9F6, 0x46F6,
+  0x89F6, 0xA9FE, 0x89F6, 0x28F6, 0x84EC, 0x63EC, 0x63EC, 0x23E4,
+  0xA128, 0x6120, 0x6118, 0x4118, 0x2010, 0x2008, 0x0008, 0x2008,
+  0x0000, 0x2000, 0x3304, 0x002B, 0x2000, 0x0000, 0x2000, 0x0008,
+  0x2008, 0x2010, 0x4118, 0x4110, 0x6120, 0xA128, 0xA128, 0x2241,
+  0x23EC, 0x63EC, 0xC2EC, 0xC4EC, 0x05F5, 0xA9F6, 0xC9F6, 0x29FF,
+  0x09FF, 0xA7F6, 0x45F6, 0xE5F5, 0xC4F5, 0xC4F5, 0x89F6, 0xA9F6,
+  0xA9FE, 0xC2EC, 0x63EC, 0x63F4, 0x43EC, 0xA128, 0x8120, 0x6120,
+  0x4118, 0x2010, 0x2010, 0x0008, 0x2008, 0x0000, 0x2000, 0x3405,
+  0x002B, 0x2000, 0x0008, 0x2008, 0x2008, 0x2010, 0x4118, 0x6120,
+  0x8120, 0x8128, 0xC130, 0xE19A, 0x83F4, 0xC2EC, 0xA2F4, 0x03ED,
+  0x83F5, 0xC9F6, 0xC9F6, 0xA9FE, 0x66F6, 0x85F6, 0x46F6, 0x24F6,
+  0xA4F5, 0xC4F5, 0x46F6, 0xA9FE, 0xA9F6, 0xC4EC, 0xA2EC, 0x63EC,
+  0x21DC, 0x8120, 0x8120, 0x6120, 0x4110, 0x2010, 0x2010, 0x0008,
+  0x0000, 0x2000, 0x0000, 0x2000, 0x3505, 0x002A, 0x2000, 0x0000,
+  0x0008, 0x2008, 0x2010, 0x4118, 0x6118, 0x8120, 0x8128, 0xC230,
+  0x23EC, 0x63EC, 0xC2EC, 0xA2EC, 0x03F5, 0xE5F5, 0xC9F6, 0x46F6,
+  0x24F6, 0x85F6, 0x85FE, 0x85F6, 0x45F6, 0xE4F5, 0xC4F5, 0xC4F5,
+  0x89F6, 0xA9F6, 0x03F5, 0xC2F4, 0x83EC, 0x81B3, 0xA128, 0x8120,
+  0x6120, 0x4118, 0x2010, 0x2010, 0x0008, 0x2008, 0x0000, 0x2000,
+  0x3604, 0x002C, 0x2000, 0x0000, 0x2008, 0x0008, 0x2008, 0x2010,
+  0x4118, 0x6120, 0x8120, 0xA128, 0xA169, 0x83EC, 0x82EC, 0xC2EC,
+  0x03F5, 0x03ED, 0x46F6, 0xC4F5, 0xC4F5, 0x24F6, 0x85F6, 0xA5E6,
+  0x45DE, 0x45FE, 0xE4F5, 0xC4F5, 0x83F5, 0x28F6, 0xA9F6, 0x03F5,
+  0xA2EC, 0x82E4, 0x828A, 0xA128, 0x8120, 0x6120, 0x4110, 0x2010,
+  0x2010, 0x0008, 0x0000, 0x2000, 0x0000, 0x2000, 0x3705, 0x002A,
+  0x2000, 0x0000, 0x0008, 0x2008, 0x2010, 0x4118, 0x6118, 0x8120,
+  0x8128, 0x628A, 0x63EC, 0xC2EC, 0xA2F4, 0x03ED, 0x03ED, 0x83F5,
+  0x83F5, 0xC4F5, 0x03EE, 0x03B5, 0x45B5, 0x03B5, 0xC4A4, 0x85DD,
+  0xC4F5, 0x83F5, 0xC4F5, 0xA9F6, 0x03F5, 0xC2EC, 0xC2F4, 0xC169,
+  0xA130, 0x8120, 0x6120, 0x4118, 0x2010, 0x2010, 0x0008, 0x2008,
+  0x0000, 0x2000, 0x3804, 0x002A, 0x2000, 0x0000, 0x2000, 0x0008,
+  0x2010, 0x2010, 0x4118, 0x4110, 0x6120, 0xA128, 0x81B3, 0xA2EC,
+  0xC2EC, 0xA2EC, 0x03F5, 0x03ED, 0x43F5, 0x83F5, 0x84ED, 0x43AC,
+  0x4394, 0xC4A4, 0xA4A4, 0x2394, 0xC39B, 0x84ED, 0x83F5, 0x63F5,
+  0x05F6, 0x03ED, 0xA2F4, 0x21DC, 0xE230, 0xA128, 0x8120, 0x6118,
+  0x4118, 0x2010, 0x2008, 0x0008, 0x0008, 0x2000, 0x3904, 0x002B,
+  0x2000, 0x0000, 0x2000, 0x0008, 0x0008, 0x2010, 0x4118, 0x4118,
+  0x6118, 0x8120, 0x82CB, 0xC2EC, 0xA2EC, 0xC2EC, 0x03F5, 0x03F5,
+  0x63F5, 0x83F5, 0x43AC, 0x838B, 0x2394, 0x439C, 0x2394, 0xC39B,
+  0x838B, 0xC2BC, 0x83F5, 0x43F5, 0x03ED, 0x03F5, 0xC2F4, 0x019B,
+  0xC130, 0xA130, 0x8120, 0x6120, 0x4118, 0x2010, 0x2008, 0x0008,
+  0x2008, 0x0000, 0x2000, 0x3A04, 0x002B, 0x0000, 0x2000, 0x0000,
+  0x2008, 0x0008, 0x2010, 0x2010, 0x4110, 0x6120, 0xA128, 0x21CC,
+  0xA1EC, 0xA2F4, 0xC2EC, 0x03ED, 0x03F5, 0x43F5, 0xA3D4, 0x2383,
+  0x838B, 0x838B, 0xC39B, 0x838B, 0x838B, 0x0383, 0x43AC, 0x63F5,
+  0x43F5, 0x03F5, 0x03ED, 0xA1EC, 0x6249, 0xA128, 0xA128, 0x6120,
+  0x6120, 0x4110, 0x2010, 0x2008, 0x0008, 0x2008, 0x0000, 0x2000,
+  0x3B0C, 0x0022, 0x6118, 0x6118, 0xA2CB, 0xC1F4, 0xC1EC, 0xC1F4,
+  0x02F5, 0x02F5, 0x43F5, 0x2383, 0xC372, 0x0383, 0x2383, 0x838B,
+  0x838B, 0x0383, 0xC372, 0xC39B, 0x63F5, 0x43F5, 0x02F5, 0x22F5,
+  0xE19A, 0xE238, 0xC130, 0x8128, 0x8128, 0x6118, 0x4118, 0x2010,
+  0x2008, 0x2008, 0x0008, 0x2000, 0x3C06, 0x0001, 0x0000, 0x3C0D,
+  0x0022, 0x8128, 0x81B3, 0xC1F4, 0xC1EC, 0xC1F4, 0x02F5, 0x02F5,
+  0xC3D4, 0x2362, 0x826A, 0xC372, 0xC372, 0x0383, 0x2383, 0xC37A,
+  0xC372, 0x239B, 0x43F5, 0x42F5, 0x02F5, 0x42D4, 0x2241, 0xE230,
+  0xA128, 0xA128, 0x6120, 0x4110, 0x4118, 0x2010, 0x2008, 0x0008,
+  0x2000, 0x0000, 0x2000, 0x3D07, 0x0027, 0x2008, 0x0008, 0x2008,
+  0x2010, 0x4118, 0x4110, 0x6120, 0x817A, 0xC1EC, 0xC1EC, 0x02F5,
+  0x02F5, 0x02F5, 0x81B3, 0x2362, 0x2362, 0x8272, 0xC372, 0xC37A,
+  0xC372, 0x826A, 0x8462, 0x819B, 0x43F5, 0x21F5, 0x02F5, 0x216A,
+  0x0239, 0xC130, 0xA128, 0x8120, 0x6120, 0x4118, 0x2010, 0x2008,
+  0x0008, 0x2008, 0x0000, 0x2000, 0x3E03, 0x002B, 0x0000, 0x0000,
+  0x0000, 0x2000, 0x0000, 0x2008, 0x2008, 0x2010, 0x4118, 0x4118,
+  0x6120, 0x2141, 0xE1F4, 0xC1F4, 0xC1F4, 0x02F5, 0x02ED, 0x2393,
+  0xA251, 0x2362, 0x2362, 0x2362, 0x427A, 0x2362, 0x2362, 0x2362,
+  0x81AB, 0x42F5, 0x21F5, 0x0393, 0x0239, 0xE238, 0xC130, 0xA128,
+  0x6120, 0x6118, 0x4118, 0x2010, 0x2008, 0x0008, 0x2008, 0x0000,
+  0x2000, 0x3F03, 0x002A, 0x0000, 0x0000, 0x2000, 0x0000, 0x2000,
+  0x0008, 0x2008, 0x2008, 0x2010, 0x4118, 0x6118, 0x6120, 0x828A,
+  0xC1F4, 0xC1EC, 0x02F5, 0x02F5, 0x239B, 0xC259, 0xA251, 0x2362,
+  0x2362, 0x2362, 0x2362, 0x2362, 0xA251, 0x02BC, 0x42F5, 0x81B3,
+  0x4241, 0x0239, 0xC130, 0xA130, 0x8120, 0x6120, 0x4118, 0x4110,
+  0x2010, 0x2008, 0x2008, 0x0008, 0x2000, 0x4004, 0x002A, 0x0000,
+  0x0000, 0x2000, 0x0008, 0x2008, 0x0008, 0x2008, 0x2010, 0x4110,
+  0x4118, 0x6120, 0xA128, 0x81B3, 0xC1F4, 0x02F5, 0x02F5, 0x02B4,
+  0x6249, 0xA251, 0xA259, 0xC251, 0xA259, 0xC251, 0xA259, 0xC251,
+  0xC3DC, 0x42D4, 0x2241, 0x0239, 0xE238, 0xC130, 0xA128, 0x6120,
+  0x6118, 0x4118, 0x2010, 0x2008, 0x2008, 0x0008, 0x2008, 0x0000,
+  0x2000, 0x4103, 0x002A, 0x0000, 0x0000, 0x0000, 0x0000, 0x2000,
+  0x0008, 0x0008, 0x2008, 0x2010, 0x4118, 0x4110, 0x6118, 0x8120,
+  0xA128, 0xE19A, 0x02F5, 0x02F5, 0xC1F4, 0x6251, 0x6249, 0x6251,
+  0x6249, 0xC259, 0xA251, 0x6251, 0xA251, 0x62D4, 0x6251, 0x2239,
+  0xE238, 0xC130, 0xA130, 0xA128, 0x6118, 0x6120, 0x4118, 0x2010,
+  0x2008, 0x0008, 0x2008, 0x0000, 0x2000, 0x4204, 0x002A, 0x0000,
+  0x0000, 0x2000, 0x0000, 0x2000, 0x0008, 0x2008, 0x2008, 0x2010,
+  0x4118, 0x6120, 0x8120, 0x8120, 0xA130, 0xC159, 0x62D4, 0x21F5,
+  0x619B, 0x2241, 0x6249, 0x6249, 0x6251, 0x6249, 0x6251, 0x4272,
+  0xC259, 0x0239, 0xE230, 0xC130, 0xA130, 0xA128, 0x8120, 0x6120,
+  0x4110, 0x2010, 0x2010, 0x2008, 0x0008, 0x0008, 0x2000, 0x0000,
+  0x2000, 0x4303, 0x002A, 0x0000, 0x0000, 0x0000, 0x0000, 0x2000,
+  0x0000, 0x2000, 0x0008, 0x2008, 0x2010, 0x4118, 0x4118, 0x6118,
+  0x6120, 0xA128, 0xA130, 0xE230, 0x427A, 0x02BC, 0x0162, 0x4249,
+  0x2241, 0x4241, 0x2241, 0x4249, 0x4241, 0x0239, 0xE238, 0xE238,
+  0xA128, 0xA128, 0x8120, 0x6120, 0x4118, 0x4118, 0x2010, 0x2008,
+  0x0000, 0x2008, 0x0008, 0x2000, 0x0000, 0x4402, 0x002B, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x2000, 0x0008, 0x2008, 0x0008,
+  0x2000, 0x2010, 0x2010, 0x4118, 0x6120, 0x6118, 0x8120, 0x8128,
+  0xA130, 0xC130, 0xE238, 0x0241, 0xE240, 0x2239, 0xE240, 0x0241,
+  0xE238, 0x0241, 0xE238, 0xC130, 0xC130, 0xA128, 0xA128, 0x8120,
+  0x6120, 0x4110, 0x2010, 0x2010, 0x2008, 0x0008, 0x0008, 0x2000,
+  0x0000, 0x0000, 0x4503, 0x0025, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x2000, 0x0008, 0x2008, 0x0008, 0x2008, 0x2010, 0x4110,
+  0x4118, 0x6120, 0x6120, 0xA128, 0xC128, 0xC130, 0xE238, 0xE238,
+  0xE230, 0xE240, 0x0241, 0xE240, 0xE230, 0xE238, 0xC130, 0xC130,
+  0xA130, 0xA128, 0x8120, 0x6120, 0x4110, 0x4118, 0x2010, 0x2010,
+  0x2008, 0x4602, 0x002B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x2000, 0x0000, 0x2000, 0x0008, 0x2008, 0x2008, 0x2010, 0x2010,
+  0x4118, 0x6120, 0x8120, 0x6120, 0xA128, 0xA130, 0xC130, 0xC130,
+  0xE230, 0xE238, 0xE238, 0xE238, 0xE230, 0xC130, 0xC130, 0xA130,
+  0xA128, 0x8120, 0x6120, 0x6118, 0x4118, 0x2010, 0x2010, 0x2008,
+  0x0008, 0x0000, 0x2008, 0x0000, 0x2000, 0x0000, 0x4703, 0x0029,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2000, 0x0000, 0x2000,
+  0x0008, 0x2008, 0x2010, 0x2010, 0x4118, 0x6120, 0x6118, 0x6120,
+  0xA128, 0xA128, 0xA130, 0xC130, 0xC130, 0xC130, 0xC130, 0xC130,
+  0xC130, 0xC130, 0xA128, 0x8128, 0x2141, 0x42D4, 0x21CC, 0x8120,
+  0x4118, 0x2010, 0x2010, 0x2008, 0x0000, 0x2008, 0x0000, 0x2000,
+  0x0000, 0x4802, 0x002B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x2000, 0x0008, 0x2008, 0x2008, 0x2010, 0x2010,
+  0x4118, 0x4118, 0x6120, 0x8120, 0x6120, 0xA128, 0x016A, 0x02BC,
+  0xC151, 0xC130, 0xC130, 0xC130, 0xC130, 0xA128, 0xA128, 0x8128,
+  0xA128, 0x01CC, 0x42F5, 0x8182, 0x4110, 0x2010, 0x2010, 0x0008,
+  0x2000, 0x0008, 0x2000, 0x0000, 0x0000, 0x0000, 0x4903, 0x0029,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2000, 0x0000, 0x2008,
+  0x0008, 0x2008, 0x2010, 0x2010, 0x4110, 0x4118, 0x6118, 0x6120,
+  0x6120, 0x81AB, 0x82F5, 0x82FD, 0xC151, 0xC130, 0xC130, 0xC130,
+  0xC130, 0xA130, 0x8128, 0xA128, 0x6120, 0x8141, 0xA1F5, 0x02C4,
+  0x4110, 0x2010, 0x2008, 0x0008, 0x2008, 0x0000, 0x2000, 0x0000,
+  0x0000, 0x4A02, 0x002A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x2000, 0x0008, 0x2008, 0x2008, 0x2010, 0x2010,
+  0x4118, 0x4118, 0x6120, 0x8120, 0x2383, 0x82F5, 0x62F5, 0xA2F5,
+  0x6249, 0xA130, 0xC130, 0xC130, 0xC130, 0xA128, 0xA128, 0xA128,
+  0x6120, 0x6120, 0xE1DC, 0xA1CC, 0x2008, 0x2010, 0x2008, 0x0008,
+  0x0000, 0x2000, 0x0000, 0x0000, 0x0000, 0x4B02, 0x002B, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2000, 0x0000, 0x2008,
+  0x0008, 0x2008, 0x2010, 0x2010, 0x4110, 0x6120, 0x6118, 0x8128,
+  0x42E5, 0xA2F5, 0xA2F5, 0xA2F5, 0xC259, 0xC130, 0xC130, 0xC130,
+  0xC130, 0xA130, 0xA128, 0x8128, 0x8120, 0x6118, 0x819B, 0x02BC,
+  0x2010, 0x2010, 0x2008, 0x0008, 0x2008, 0x0008, 0x2000, 0x0000,
+  0x0000, 0x0000, 0x4C03, 0x0029, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x2000, 0x0000, 0x2008, 0x0008, 0x2008, 0x2008, 0x2010, 0x4110,
+  0x4118, 0x6120, 0x8120, 0x8149, 0xC2FD, 0xC2F5, 0xC2F5, 0xC2F5,
+  0x0162, 0xE230, 0xE238, 0xC130, 0xC130, 0xC130, 0xA128, 0xA128,
+  0x8120, 0x6120, 0xA182, 0x218B, 0x2010, 0x2010, 0x2008, 0x0008,
+  0x0000, 0x2000, 0x0000, 0x0000, 0x0000, 0x4D02, 0x002B, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x2000, 0x0000, 0x2000, 0x0008, 0x0008,
+  0x2008, 0x2010, 0x2010, 0x4110, 0x6120, 0x8120, 0x6120, 0x2162,
+  0xC2F5, 0xC2F5, 0xC2F5, 0xC2F5, 0xA182, 0xE238, 0xE230, 0xE238,
+  0xE238, 0xC130, 0xA128, 0x8128, 0xA128, 0x6120, 0x216A, 0x2141,
+  0x4118, 0x2010, 0x2008, 0x2008, 0x0008, 0x2000, 0x0008, 0x2000,
+  0x0000, 0x0000, 0x4E03, 0x002A, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x2000, 0x0008, 0x2008, 0x0008, 0x2008, 0x2010, 0x4110, 0x4118,
+  0x6120, 0x8120, 0xA128, 0x8272, 0xE2F5, 0xE2F5, 0x02F6, 0x02F6,
+  0xA39B, 0x0239, 0x0239, 0x0241, 0xE240, 0xE238, 0xC130, 0xC128,
+  0xA128, 0x6120, 0xA130, 0x6118, 0x4118, 0x2010, 0x2010, 0x2008,
+  0x2008, 0x0008, 0x2000, 0x0000, 0x0000, 0x0000, 0x4F02, 0x0028,
+  0x0000, 0x0000, 0x0000, 0x2000, 0x0000, 0x2000, 0x0000, 0x0008,
+  0x2008, 0x2010, 0x4118, 0x4118, 0x6118, 0x8120, 0xC130, 0x0239,
+  0x218B, 0x02F6, 0x02F6, 0x02F6, 0x02F6, 0xA2E5, 0x4249, 0x2241,
+  0x4241, 0x4249, 0x0239, 0x2239, 0xE238, 0xA128, 0x8128, 0x8120,
+  0x6120, 0x4118, 0x2010, 0x2010, 0x2008, 0x2008, 0x0008, 0x2000,
+  0x5003, 0x002A, 0x0000, 0x0000, 0x0000, 0x2000, 0x0008, 0x2008,
+  0x0008, 0x2008, 0x2010, 0x4118, 0x6120, 0x8120, 0x218B, 0xC2E5,
+  0x02F6, 0xE2F5, 0x23FE, 0x23F6, 0x03F6, 0x43F6, 0x43FE, 0x218B,
+  0x8341, 0x6249, 0x6251, 0x2241, 0x2241, 0x0239, 0xE238, 0xC130,
+  0xA128, 0x8120, 0x6120, 0x4110, 0x2010, 0x2008, 0x0008, 0x0008,
+  0x2000, 0x0000, 0x2000, 0x0000, 0x5103, 0x0029, 0x0000, 0x0000,
+  0x0000, 0x2000, 0x0008, 0x0008, 0x2008, 0x2010, 0x4110, 0x6120,
+  0x8118, 0x43AC, 0xE2F5, 0x22F6, 0x42F6, 0x22F6, 0x43F6, 0x43F6,
+  0x43F6, 0x43FE, 0x64F6, 0x03F6, 0xC372, 0xC259, 0xC251, 0x8349,
+  0x6251, 0x4241, 0x0239, 0xE238, 0xA130, 0xA128, 0x6118, 0x4118,
+  0x2010, 0x2008, 0x2008, 0x2008, 0x0008, 0x2000, 0x0000, 0x5202,
+  0x0028, 0x0000, 0x0000, 0x2000, 0x0000, 0x2000, 0x0008, 0x2008,
+  0x2008, 0x4118, 0x4118, 0x6120, 0x418B, 0x22FE, 0x42F6, 0x42F6,
+  0x43F6, 0x43F6, 0x64F6, 0x85FE, 0xA7F6, 0x63F6, 0x84FE, 0x84F6,
+  0x63F6, 0xA2BC, 0x0383, 0x2362, 0x2362, 0x2362, 0x2362, 0x0239,
+  0xE230, 0xA128, 0x8120, 0x6120, 0x4118, 0x2010, 0x2008, 0x0008,
+  0x2000, 0x5302, 0x002B, 0x0000, 0x0000, 0x2000, 0x0000, 0x2000,
+  0x0008, 0x2008, 0x2010, 0x4110, 0x6120, 0x6141, 0x22F6, 0x22F6,
+  0x43F6, 0x63F6, 0x44F6, 0x64F6, 0xA7F6, 0x33FF, 0x74FF, 0xC9F6,
+  0xA4F6, 0x84F6, 0x84FE, 0x84F6, 0x84F6, 0x84F6, 0x83FE, 0x83F6,
+  0x64FE, 0x02E6, 0x826A, 0xC130, 0xA128, 0x6120, 0x4118, 0x4118,
+  0x2010, 0x2008, 0x2008, 0x0008, 0x2000, 0x0000, 0x5403, 0x002A,
+  0x0000, 0x0000, 0x2008, 0x0008, 0x2008, 0x2008, 0x4110, 0x6120,
+  0x8120, 0x63AC, 0x62FE, 0x62F6, 0x83FE, 0x63F6, 0x84F6, 0xA7FE,
+  0x53FF, 0x74F7, 0x74FF, 0xCDF6, 0xE5FE, 0xC5FE, 0xE5F6, 0xC5FE,
+  0xA4F6, 0xA4F6, 0x84F6, 0x84F6, 0x83FE, 0x63F6, 0x43EE, 0x0162,
+  0xA128, 0x6120, 0x6118, 0x4118, 0x2010, 0x2008, 0x0008, 0x0008,
+  0x2000, 0x0000, 0x5503, 0x002A, 0x0000, 0x2000, 0x0000, 0x0008,
+  0x2008, 0x2010, 0x4118, 0x8118, 0xC120, 0x43F6, 0x42F6, 0x83F6,
+  0x83F6, 0x84F6, 0xA4F6, 0x31FF, 0x74FF, 0x74F7, 0x74FF, 0x31FF,
+  0x07F7, 0x27F7, 0xE5F6, 0xC5FE, 0xE5F6, 0xC5FE, 0xC4FE, 0xA4F6,
+  0x84F6, 0x83F6, 0x83FE, 0xC2E5, 0x0139, 0xA128, 0x8128, 0x4110,
+  0x2010, 0x2008, 0x0008, 0x2008, 0x0000, 0x2000, 0x5602, 0x002B,
+  0x0000, 0x0000, 0x0000, 0x2008, 0x0008, 0x2010, 0x4110, 0xA120,
+  0x8118, 0x216A, 0xA2FE, 0x83FE, 0x83F6, 0x84F6, 0xA4F6, 0x09FF,
+  0x74FF, 0x74FF, 0x74FF, 0x95FF, 0xB5F7, 0x4CFF, 0x07F7, 0x27FF,
+  0x07F7, 0x27FF, 0x07F7, 0xE5FE, 0xE5F6, 0xC4FE, 0xA4F6, 0x84F6,
+  0x82F6, 0x638B, 0xC128, 0x8120, 0x6118, 0x4118, 0x2010, 0x2008,
+  0x0000, 0x0000, 0x2000, 0x5702, 0x0003, 0x0000, 0x0000, 0x2000,
+  0x570A, 0x0024, 0x8128, 0x638B, 0x82F6, 0x84F6, 0xA4F6, 0xC4FE,
+  0xC5F6, 0x53FF, 0x74F7, 0xB5FF, 0x95FF, 0xB5FF, 0x95FF, 0x95FF,
+  0x4EF7, 0x29FF, 0x07F7, 0x27FF, 0x07F7, 0x07FF, 0x05F7, 0xE5FE,
+  0xC4F6, 0xA4FE, 0xA4FE, 0xA2E5, 0xE230, 0xA128, 0xA120, 0x4118,
+  0x2010, 0x2008, 0x0008, 0x2008, 0x0000, 0x2000, 0x5805, 0x0029,
+  0x2000, 0x4008, 0x2010, 0xA018, 0x8120, 0xE128, 0x43AC, 0xC2FE,
+  0xC4FE, 0xC4F6, 0xE5FE, 0xE8F6, 0x95FF, 0xB5FF, 0x95FF, 0xB5FF,
+  0xB6FF, 0x96FF, 0xB6FF, 0x96FF, 0x95F7, 0xB0FF, 0x4EF7, 0x4AFF,
+  0x27FF, 0x07F7, 0x05F7, 0xE5FE, 0xC4F6, 0xA4FE, 0xA2F6, 0x826A,
+  0xA128, 0x8118, 0x6120, 0x4110, 0x2008, 0x0008, 0x2000, 0x0000,
+  0x2000, 0x5904, 0x002A, 0x0008, 0x4008, 0x2008, 0x4118, 0x8118,
+  0xC118, 0xC128, 0x23AC, 0xC3F6, 0xE5FE, 0xE5F6, 0x05FF, 0x4CF7,
+  0x95FF, 0x95FF, 0xB6FF, 0x96FF, 0xD6FF, 0xB6FF, 0xD6FF, 0xB6FF,
+  0xD6FF, 0x96FF, 0xB6FF, 0xB6FF, 0xB0FF, 0xE8F6, 0x07FF, 0x05F7,
+  0xE5FE, 0xE4FE, 0xC3FE, 0x43AC, 0xE128, 0xA128, 0xA120, 0x4118,
+  0x2010, 0x2008, 0x0008, 0x2000, 0x0008, 0x5A03, 0x002A, 0x0000,
+  0x2000, 0x4008, 0x2010, 0x6010, 0x8120, 0xE128, 0x2229, 0x439C,
+  0xE4FE, 0xE5FE, 0x05F7, 0x07FF, 0x4CFF, 0xB6FF, 0xB6FF, 0x96FF,
+  0xD6FF, 0xB6FF, 0xD7FF, 0xB7FF, 0xD7FF, 0xB7FF, 0xD7FF, 0xB6FF,
+  0xB6FF, 0x96FF, 0x94FF, 0x48F7, 0x27FF, 0x05F7, 0xE5FE, 0xC4F6,
+  0x02E6, 0xC230, 0x8128, 0x8118, 0x4110, 0x2010, 0x2008, 0x0008,
+  0x2000, 0x5B03, 0x002B, 0x2000, 0x0000, 0x4008, 0x4008, 0xA018,
+  0xC118, 0xC128, 0x0131, 0x0383, 0xE5F6, 0x05FF, 0x26F7, 0x07FF,
+  0x4CF7, 0x96FF, 0xB6FF, 0xB7FF, 0xB7FF, 0xD7FF, 0xD7FF, 0xD7F7,
+  0xD7FF, 0xD7FF, 0xB7FF, 0xD7FF, 0xB6FF, 0xB6FF, 0xB5FF, 0xB0FF,
+  0x07F7, 0x26FF, 0x05F7, 0x04FF, 0xE3FE, 0x8149, 0xE128, 0x8120,
+  0x6120, 0x2010, 0x2008, 0x2008, 0x0000, 0x2008, 0x5C03, 0x002B,
+  0x0000, 0x2008, 0x2008, 0x4118, 0xA018, 0xC120, 0xE128, 0x6231,
+  0x445A, 0x05FF, 0x26FF, 0x27FF, 0x48FF, 0x4CF7, 0xB6FF, 0xB7FF,
+  0xB7FF, 0xD8FF, 0xD8FF, 0xD8FF, 0xD8FF, 0xD8FF, 0xD8FF, 0xD8FF,
+  0xD7FF, 0xD7FF, 0xD6FF, 0xB6FF, 0x95FF, 0x69F7, 0x07FF, 0x26F7,
+  0x04FF, 0xE4F6, 0xA35A, 0xC128, 0x8118, 0x8120, 0x2010, 0x2008,
+  0x2008, 0x0000, 0x2000, 0x5D03, 0x0029, 0x2000, 0x4008, 0x4008,
+  0x6010, 0xA018, 0xC120, 0x2229, 0x6231, 0x6341, 0x45DE, 0x26FF,
+  0x47FF, 0x69F7, 0x4AFF, 0xB6FF, 0xD7FF, 0xD8FF, 0xD8FF, 0xD8FF,
+  0xF9FF, 0xD9FF, 0xF9FF, 0xD9FF, 0xD8FF, 0xD8FF, 0xD7FF, 0xD7FF,
+  0xB6FF, 0xD5FF, 0x4CFF, 0x47F7, 0x26FF, 0x05FF, 0x04FF, 0x236B,
+  0xE128, 0xC120, 0xA120, 0x4118, 0x2008, 0x0008, 0x5E02, 0x002B,
+  0x2000, 0x2000, 0x4008, 0x4008, 0x8010, 0xA018, 0xE128, 0x2231,
+  0x8239, 0xE349, 0xC4A4, 0x67FF, 0x48FF, 0x69FF, 0x4AFF, 0xB4FF,
+  0xD8FF, 0xD8FF, 0xD9FF, 0xF9FF, 0xDAFF, 0xFAFF, 0xDAFF, 0xF9FF,
+  0xD9FF, 0xD8FF, 0xD8FF, 0xD7FF, 0xD7FF, 0xD6FF, 0xB0FF, 0x47F7,
+  0x46FF, 0x06FF, 0x04F7, 0x6473, 0x0229, 0xC118, 0x8120, 0x4110,
+  0x2010, 0x0008, 0x2000, 0x5F02, 0x002C, 0x0000, 0x2000, 0x4008,
+  0x4008, 0xA018, 0xC120, 0x0121, 0x2229, 0x8239, 0xE349, 0x076B,
+  0x47FF, 0x69FF, 0x4AFF, 0x8CF7, 0xB0FF, 0xD8FF, 0xF9FF, 0xD9FF,
+  0xFAFF, 0xDAFF, 0xFBFF, 0xDBFF, 0xFAFF, 0xDAFF, 0xF9FF, 0xD8FF,
+  0xD8FF, 0xB7FF, 0xD6FF, 0xD2FF, 0x48FF, 0x46FF, 0x45FF, 0x44FF,
+  0x8473, 0x2231, 0xE128, 0xA120, 0x4118, 0x2008, 0x2008, 0x0000,
+  0x2000, 0x6002, 0x002C, 0x2000, 0x2000, 0x4008, 0x4008, 0xA018,
+  0xC120, 0x0129, 0x6231, 0x8239, 0x034A, 0x846A, 0x68D6, 0x69FF,
+  0x4AFF, 0x8CFF, 0xAFFF, 0xD8FF, 0xF9FF, 0xDAFF, 0xFBFF, 0xDBFF,
+  0xFCFF, 0xFCFF, 0xDBFF, 0xDAFF, 0xF9FF, 0xD9FF, 0xD8FF, 0xD7FF,
+  0xD7FF, 0xB0FF, 0x48F7, 0x47FF, 0x46FF, 0x44F7, 0x0363, 0x2229,
+  0xC128, 0x8118, 0x8010, 0x2010, 0x2008, 0x0000, 0x2000, 0x6103,
+  0x002A, 0x2000, 0x4008, 0x4008, 0xA018, 0xC120, 0x0121, 0x6231,
+  0x8349, 0x2452, 0x6462, 0xC4A4, 0x49F7, 0x8BFF, 0x8DFF, 0xAFFF,
+  0xD6FF, 0xFAFF, 0xDBFF, 0xDCFF, 0xFDFF, 0xFDFF, 0xFDFF, 0xFCFF,
+  0xFBFF, 0xDAFF, 0xF9FF, 0xD8FF, 0xD7F7, 0xD7FF, 0xB0FF, 0x88FF,
+  0x47FF, 0x46FF, 0x45FF, 0xA362, 0x2231, 0xE128, 0x8120, 0x8010,
+  0x2010, 0x2000, 0x2008, 0x6204, 0x0029, 0x4008, 0x4008, 0xA018,
+  0xC120, 0x0129, 0x6231, 0x8349, 0x4452, 0x846A, 0x0773, 0x69FF,
+  0xACFF, 0x8DFF, 0xB0FF, 0xD4FF, 0xDBFF, 0xFCFF, 0xFDFF, 0xFEFF,
+  0xFEFF, 0xFEFF, 0xFDFF, 0xDCFF, 0xDBFF, 0xF9FF, 0xD8FF, 0xD8FF,
+  0xD7FF, 0xAFFF, 0x88F7, 0x88FF, 0x46FF, 0x45FF, 0x6341, 0x2229,
+  0xE128, 0x8118, 0x8010, 0x2010, 0x2000, 0x0008, 0x6304, 0x0011,
+  0x2008, 0x8010, 0xA010, 0xC120, 0x0129, 0x6231, 0xC241, 0x2452,
+  0x8462, 0x076B, 0xC8DE, 0x8CFF, 0x8DF7, 0xB0FF, 0xD2FF, 0xDBFF,
+  0xDCFF, 0x631B, 0x0013, 0xFBFF, 0xDAFF, 0xD8FF, 0xD7FF, 0xD7FF,
+  0x8BFF, 0x89FF, 0x88FF, 0x86FF, 0xC5EE, 0xA239, 0x2229, 0xE128,
+  0x8120, 0x8010, 0x2010, 0x2000, 0x0008, 0x2000, 0x6404, 0x0027,
+  0x4008, 0x6010, 0xA018, 0xC118, 0x0129, 0x6231, 0x8239, 0x034A,
+  0x846A, 0x0773, 0x68D6, 0xACFF, 0x8DFF, 0xB0FF, 0xB2FF, 0xFAFF,
+  0xFCFF, 0xFDFF, 0xFEFF, 0xFEFF, 0xFEFF, 0xFDFF, 0xDCFF, 0xDBFF,
+  0xFAFF, 0xD8FF, 0xD8FF, 0xD5FF, 0x8AFF, 0x89FF, 0x88F7, 0x66F7,
+  0xA5C5, 0x8231, 0x2229, 0xE128, 0x8120, 0x8010, 0x2008, 0x6506,
+  0x000F, 0xA018, 0xC118, 0x0129, 0x6231, 0x8239, 0xE349, 0x846A,
+  0x076B, 0x68CE, 0x8CF7, 0xADFF, 0xB0FF, 0xB2FF, 0xD8FF, 0xFCFF,
+  0x651C, 0x0011, 0xF9FF, 0xD8FF, 0xD8FF, 0xB0FF, 0xABFF, 0x89FF,
+  0x88FF, 0x86FF, 0x6594, 0x8239, 0x2231, 0xC118, 0x8120, 0x8010,
+  0x2010, 0x2000, 0x2000, 0x6607, 0x0023, 0xC120, 0x0121, 0x2231,
+  0x8239, 0xE349, 0x445A, 0x0773, 0x6AF7, 0xACFF, 0xADFF, 0xB0FF,
+  0xD2F7, 0xD8FF, 0xDBFF, 0xFCFF, 0xFDFF, 0xFDFF, 0xFDFF, 0xFCFF,
+  0xDBFF, 0xDAFF, 0xF9FF, 0xD8FF, 0xD8FF, 0x8DFF, 0x8BFF, 0x89FF,
+  0x88F7, 0x87FF, 0xA35A, 0x6231, 0x2229, 0xC120, 0x8118, 0x6010,
+  0x6702, 0x002B, 0x0000, 0x2000, 0x4008, 0x4008, 0x8010, 0xC120,
+  0x0129, 0x2229, 0x8239, 0xE341, 0x076B, 0xC8DE, 0xAAFF, 0x8CFF,
+  0xADFF, 0xAFF7, 0xB0FF, 0xD8FF, 0xFBFF, 0xDBFF, 0xDCFF, 0xFCFF,
+  0xFCFF, 0xDBFF, 0xFBFF, 0xDAFF, 0xF9FF, 0xD8FF, 0xD4FF, 0x8CFF,
+  0xABFF, 0x89FF, 0x88FF, 0x07E7, 0x8349, 0x6239, 0x0121, 0xC120,
+  0xA018, 0x8010, 0x4008, 0x2008, 0x0000, 0x6803, 0x0010, 0x2000,
+  0x4008, 0x4008, 0x8010, 0xA018, 0xC120, 0x2231, 0x6231, 0xE349,
+  0x46CE, 0x89FF, 0xAAFF, 0x8CFF, 0xADFF, 0xAFFF, 0xD2FF, 0x6819,
+  0x0012, 0xDAFF, 0xFAFF, 0xD9FF, 0xD8FF, 0xD8FF, 0xB0FF, 0xCCF7,
+  0x8AFF, 0x89FF, 0x88F7, 0xC4A4, 0x8239, 0x2229, 0xC128, 0xC118,
+  0xA018, 0x2010, 0x2008, 0x6902, 0x0011, 0x0000, 0x2000, 0x4008,
+  0x4008, 0x6010, 0xA018, 0xC118, 0x0121, 0x4231, 0x2452, 0x88FF,
+  0x89FF, 0xAAF7, 0x8BFF, 0xCCFF, 0xB0FF, 0xD7F7, 0x691B, 0x0011,
+  0xD8FF, 0xD8FF, 0xD7FF, 0xCDFF, 0x8BFF, 0xAAFF, 0x89FF, 0xA8FF,
+  0xA362, 0x6239, 0x2229, 0xE128, 0xA018, 0x8010, 0x4008, 0x4008,
+  0x0008, 0x6A03, 0x0012, 0x2008, 0x2000, 0x4008, 0x4008, 0x8010,
+  0xC120, 0x0129, 0x2229, 0x847B, 0x88FF, 0x89FF, 0xAAFF, 0xABFF,
+  0xB2FF, 0xD7FF, 0xD8FF, 0xD8FF, 0xF9FF, 0x6A1E, 0x000E, 0xCDF7,
+  0x8BFF, 0xAAFF, 0x89FF, 0x26C6, 0x6231, 0x6231, 0x0129, 0xC118,
+  0x8120, 0x8010, 0x4008, 0x2000, 0x2008, 0x6B08, 0x0009, 0x8018,
+  0xC118, 0x2229, 0x458C, 0x88FF, 0x89F7, 0x89FF, 0xB0FF, 0xD7FF,
+  0x6B16, 0x0017, 0xF8FF, 0xD9FF, 0xF8FF, 0xD8FF, 0xF8FF, 0xD8FF,
+  0xD7FF, 0xD7FF, 0xD5FF, 0xAAFF, 0x8AFF, 0xC8FF, 0x8473, 0xA239,
+  0x2231, 0xE128, 0xC120, 0xA018, 0x4008, 0x4008, 0x2000, 0x0000,
+  0x0000, 0x6C06, 0x0021, 0x6008, 0x8010, 0xA018, 0xC120, 0x0129,
+  0x439C, 0x88FF, 0x88FF, 0xAAFF, 0xD6FF, 0xB6FF, 0xD7FF, 0xD7FF,
+  0xF7FF, 0xD8FF, 0xD8FF, 0xF8FF, 0xD8FF, 0xF8FF, 0xD8FF, 0xF8FF,
+  0xD7FF, 0xD7FF, 0xD7FF, 0xD6FF, 0xADF7, 0xC9FF, 0x06C6, 0x8239,
+  0x6231, 0x2229, 0xC120, 0x8018, 0x6D08, 0x0022, 0x8010, 0x8010,
+  0xC118, 0xC47B, 0xA7FF, 0xA8FF, 0xCCF7, 0xD6FF, 0xD6FF, 0xD6FF,
+  0xF7FF, 0xD7FF, 0xD7FF, 0xD7FF, 0xF8FF, 0xB2FF, 0xD2FF, 0xD7FF,
+  0xF7FF, 0xD7FF, 0xF7FF, 0xD6FF, 0xD6FF, 0xB0FF, 0xC9FF, 0x6594,
+  0x8239, 0x2229, 0xE128, 0xC120, 0xA018, 0x8010, 0x6008, 0x2008,
+  0x6E04, 0x0016, 0x2000, 0x2008, 0x4008, 0x4008, 0x8010, 0xA018,
+  0xC120, 0xA362, 0xC7FF, 0xA8FF, 0x8BFF, 0xF6FF, 0xD6FF, 0xF6FF,
+  0xD6FF, 0xF7FF, 0xD7FF, 0xF7FF, 0xD4F7, 0xADFF, 0xADFF, 0xD5FF,
+  0x6E1F, 0x000C, 0xB0FF, 0xC9FF, 0x0363, 0x6231, 0xE120, 0xC120,
+  0xA010, 0x8010, 0x4008, 0x4008, 0x2000, 0x0000, 0x6F0B, 0x0020,
+  0x0229, 0x88F7, 0xA8FF, 0xC9FF, 0xD4FF, 0xD6FF, 0xF6FF, 0xD6FF,
+  0xF6FF, 0xD7F7, 0xF6FF, 0xADFF, 0xCBDE, 0xACFF, 0xAFFF, 0xD7FF,
+  0xF6FF, 0xD6FF, 0xF6FF, 0xF6FF, 0xAFFF, 0xC9FF, 0xA362, 0x2231,
+  0xE128, 0xA120, 0xA018, 0x4008, 0x4008, 0x2000, 0x2008, 0x0000,
+  0x7005, 0x0020, 0x2000, 0x2000, 0x2008, 0x4008, 0x6008, 0x8010,
+  0xA018, 0x26CE, 0xA8FF, 0xA8FF, 0xB0FF, 0xD6FF, 0xD6FF, 0xF6FF,
+  0xD6FF, 0xF6FF, 0xB2FF, 0x6AEF, 0x6462, 0x2BEF, 0xCCFF, 0xD6FF,
+  0xF6FF, 0xD6FF, 0xF6FF, 0xD6FF, 0xCDFF, 0xC9FF, 0x424A, 0xE120,
+  0xC118, 0xA018, 0x7106, 0x0023, 0x2008, 0x2000, 0x4008, 0x4008,
+  0x8008, 0x8010, 0xC47B, 0xA8FF, 0xA8FF, 0xCBFF, 0xD5FF, 0xD6FF,
+  0xF6FF, 0xD6FF, 0xF6FF, 0xACFF, 0x68D6, 0x2452, 0xA4A4, 0xCBFF,
+  0xB0FF, 0xF6FF, 0xD6FF, 0xD6FF, 0xD5FF, 0xEAFF, 0xC9FF, 0x6252,
+  0xC120, 0xA018, 0x8010, 0x4008, 0x4008, 0x2000, 0x2008, 0x7206,
+  0x0021, 0x0000, 0x2000, 0x2008, 0x4008, 0x4008, 0x8010, 0x0129,
+  0x68F7, 0xC9FF, 0xC9FF, 0xAFFF, 0xD6FF, 0xD6FF, 0xF6FF, 0xB2FF,
+  0xCBFF, 0x49AD, 0x8341, 0x8462, 0xEAFF, 0xCBFF, 0xF6FF, 0xD6FF,
+  0xF6FF, 0xB0FF, 0xC9FF, 0xA9FF, 0xC239, 0xA010, 0x6010, 0x4008,
+  0x4008, 0x2000, 0x730D, 0x001A, 0x6473, 0xA8FF, 0xA9F7, 0xC9FF,
+  0xD2FF, 0xD6FF, 0xF6FF, 0xADFF, 0xCAFF, 0x6594, 0x6231, 0x6231,
+  0xC8DE, 0xCAFF, 0xAFFF, 0xD6FF, 0xD2FF, 0xCAFF, 0xC9FF, 0x68F7,
+  0xC120, 0x6010, 0x8010, 0x4008, 0x2000, 0x2008, 0x7407, 0x0002,
+  0x0000, 0x2000, 0x740E, 0x0019, 0x65BD, 0xC9FF, 0xC9FF, 0xCAFF,
+  0xAFFF, 0xAFFF, 0xCAFF, 0xCAF7, 0xC47B, 0x0229, 0x2229, 0x65B5,
+  0xCAFF, 0xCAFF, 0xCCFF, 0xCAFF, 0xC9FF, 0xA9FF, 0xC47B, 0x6008,
+  0x4008, 0x4008, 0x2000, 0x2008, 0x0000, 0x750A, 0x0006, 0x2008,
+  0x2000, 0x4000, 0x4008, 0xA118, 0x45B5, 0x7515, 0x0011, 0xEAFF,
+  0x8473, 0x0129, 0xE120, 0x0363, 0xCAFF, 0xCAFF, 0xCAFF, 0xEAFF,
+  0xC9FF, 0xC483, 0x8010, 0x4008, 0x4008, 0x4008, 0x2000, 0x0000,
+  0x7609, 0x001C, 0x0000, 0x0000, 0x2000, 0x2008, 0x4008, 0x4008,
+  0x6008, 0x6252, 0xC5CD, 0xA9F7, 0xCAFF, 0xCAFF, 0x6AEF, 0x424A,
+  0xC120, 0xC118, 0xC120, 0xC8E6, 0xEAFF, 0xCAFF, 0x68CE, 0xC239,
+  0x4008, 0x4008, 0x4008, 0x2008, 0x2000, 0x2000, 0x770A, 0x001C,
+  0x0000, 0x0000, 0x2000, 0x2008, 0x2000, 0x4008, 0x6008, 0x4008,
+  0x6010, 0x0121, 0x0129, 0xA018, 0xA010, 0xA018, 0xA018, 0xA018,
+  0x0121, 0xA362, 0xE241, 0x8010, 0x4008, 0x4008, 0x4008, 0x2000,
+  0x2008, 0x0000, 0x2000, 0x0000, 0x780D, 0x0017, 0x2000, 0x2008,
+  0x2000, 0x4008, 0x2008, 0x4010, 0x4008, 0x6008, 0x4008, 0x6010,
+  0x4008, 0x6008, 0x4008, 0x6010, 0x4008, 0x6008, 0x4008, 0x2008,
+  0x2000, 0x0008, 0x2000, 0x0000, 0x2000, 0x790D, 0x000E, 0x2000,
+  0x0000, 0x2000, 0x2008, 0x0000, 0x2000, 0x4008, 0x2008, 0x4008,
+  0x2000, 0x4008, 0x2008, 0x4008, 0x2000, 0x7922, 0x0001, 0x0000,
+  0x7A0E, 0x0010, 0x0000, 0x0000, 0x2000, 0x2008, 0x2000, 0x2008,
+  0x2000, 0x0008, 0x2000, 0x2008, 0x2000, 0x2008, 0x2000, 0x2008,
+  0x2000, 0x0000, 0x7B14, 0x0008, 0x2000, 0x0000, 0x2000, 0x2008,
+  0x2000, 0x0000, 0x2000, 0x2008, 0x7C14, 0x0007, 0x0000, 0x2000,
+  0x0000, 0x2000, 0x0000, 0x2000, 0x0000, 0x0E13, 0x0003, 0x2000,
+  0x4151, 0x2000, 0x0F12, 0x0003, 0x2000, 0xE240, 0xA2DA, 0x1013,
+  0x0004, 0x82AA, 0xA2D2, 0x0008, 0x0000, 0x1112, 0x0005, 0x2000,
+  0xE291, 0x82AA, 0x0000, 0x0000, 0x1213, 0x0004, 0x2000, 0x2008,
+  0x0000, 0x0000, 0x1314, 0x0003, 0x0000, 0x0000, 0x0000, 0x1414,
+  0x0003, 0x0000, 0x0000, 0x0000, 0x1515, 0x0002, 0x0000, 0x0000,
+  0x1616, 0x0001, 0x0000, 0x1716, 0x0005, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x1816, 0x0009, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1912, 0x000F, 0x0000,
+  0x0000, 0x0000, 0x2000, 0x0000, 0x2000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1A12, 0x0011,
+  0x0000, 0x2000, 0x0000, 0x2000, 0x0000, 0x2000, 0x0000, 0x2000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x1B0F, 0x0015, 0x0000, 0x0000, 0x0000, 0x2000, 0x0000,
+  0x2000, 0x0008, 0x2000, 0x0000, 0x2000, 0x0008, 0x2000, 0x0000,
+  0x2000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x1C0E, 0x0017, 0x0000, 0x2000, 0x0008, 0x2000, 0x0008, 0x2000,
+  0x0008, 0x2008, 0x0008, 0x2008, 0x0000, 0x2008, 0x0000, 0x2000,
+  0x0000, 0x2000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x1D11, 0x0016, 0x2008, 0x0008, 0x2008, 0x2008, 0x2008,
+  0x2008, 0x2010, 0x2008, 0x2008, 0x0000, 0x2008, 0x0008, 0x2008,
+  0x0000, 0x2000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x1E0C, 0x001B, 0x0000, 0x0000, 0x2000, 0x0008, 0x2000,
+  0x0008, 0x2008, 0x2008, 0x2008, 0x2010, 0x2010, 0x2010, 0x2010,
+  0x2010, 0x2010, 0x2008, 0x2008, 0x0000, 0x2000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1F0C, 0x001B,
+  0x0000, 0x0000, 0x2000, 0x0008, 0x2008, 0x2008, 0x2010, 0x2010,
+  0x4118, 0x4118, 0x4110, 0x4118, 0x4118, 0x4118, 0x2010, 0x2008,
+  0x2008, 0x0008, 0x2008, 0x0000, 0x2000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x200B, 0x001F, 0x0000, 0x2000, 0x0000,
+  0x2008, 0x0008, 0x2008, 0x2010, 0x4118, 0x4110, 0x6120, 0x6120,
+  0x6118, 0x6120, 0x6151, 0x4151, 0x4118, 0x2010, 0x2010, 0x2008,
+  0x2008, 0x0000, 0x2000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x210B, 0x001E, 0x0000, 0x2000,
+  0x0008, 0x0008, 0x2008, 0x2010, 0x4110, 0x4118, 0x6118, 0x8120,
+  0x8120, 0x4151, 0xA2D2, 0xE2E2, 0xA130, 0x6120, 0x4110, 0x4118,
+  0x2010, 0x2010, 0x2008, 0x0000, 0x2000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x2209, 0x0021, 0x0000, 0x0000,
+  0x2000, 0x0008, 0x2000, 0x2008, 0x2010, 0x4118, 0x6120, 0x6118,
+  0x8128, 0x8128, 0xE291, 0x43E3, 0x23E3, 0x62AA, 0xA120, 0x6120,
+  0x6118, 0x4118, 0x4118, 0x2010, 0x2008, 0x0000, 0x2000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2309,
+  0x0022, 0x0000, 0x0000, 0x0000, 0x2008, 0x0008, 0x2008, 0x4110,
+  0x6120, 0x6118, 0x8128, 0xA128, 0xE289, 0x23DB, 0x23E3, 0x43E3,
+  0xE291, 0xC130, 0x8128, 0x8128, 0x6118, 0x4118, 0x2010, 0x2008,
+  0x2008, 0x0008, 0x2000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x2409, 0x0022, 0x0000, 0x2000, 0x0000,
+  0x2008, 0x2008, 0x2010, 0x4118, 0x6118, 0x8128, 0xA128, 0xA169,
+  0x83EB, 0x83E3, 0x83E3, 0x83E3, 0x82AA, 0xE230, 0xC128, 0xA128,
+  0x8120, 0x6120, 0x4118, 0x2010, 0x2008, 0x0000, 0x2000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2509,
+  0x0022, 0x0000, 0x0000, 0x2008, 0x0008, 0x2008, 0x4110, 0x6118,
+  0x8120, 0xA128, 0x6249, 0x83E3, 0x83E3, 0x83E3, 0xE3EB, 0x83E3,
+  0x83E3, 0x6251, 0x0239, 0xC130, 0x8128, 0x8120, 0x6120, 0x2010,
+  0x2008, 0x2008, 0x0008, 0x2000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x2607, 0x0024, 0x0000, 0x0000, 0x0000,
+  0x2000, 0x0000, 0x2008, 0x2010, 0x4118, 0x6120, 0xA128, 0xC130,
+  0x82B2, 0x83E3, 0xC3E3, 0x47F5, 0xC6EC, 0xC3E3, 0xE3E3, 0x02C3,
+  0x6249, 0x0239, 0xC130, 0xA128, 0x6118, 0x4118, 0x2010, 0x0008,
+  0x2000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x2707, 0x0026, 0x0000, 0x0000, 0x2000, 0x0000, 0x0008,
+  0x2008, 0x4118, 0x6118, 0x8120, 0xA128, 0x0239, 0x83E3, 0xC3E3,
+  0xC6EC, 0xE8ED, 0xA6F5, 0x24EC, 0x24E4, 0x24EC, 0xE3EB, 0x02C3,
+  0x22C3, 0xE291, 0x8120, 0x4118, 0x2010, 0x2008, 0x2008, 0x0000,
+  0x2000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x2807, 0x0027, 0x0000, 0x0000, 0x0000, 0x2000, 0x0008,
+  0x2010, 0x4118, 0x6120, 0xA128, 0xE230, 0x217A, 0xC3EB, 0x44EC,
+  0x47F5, 0xE8F5, 0xC8ED, 0x47ED, 0x84EC, 0x24EC, 0x24EC, 0xC3E3,
+  0x83E3, 0x83E3, 0x62A2, 0x6118, 0x4110, 0x2008, 0x0008, 0x2000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x2906, 0x0027, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x2000, 0x0008, 0x2010, 0x4118, 0x8120, 0xA128, 0xC230, 0xE19A,
+  0x24E4, 0x24EC, 0x47ED, 0x28F6, 0x48F6, 0x28F6, 0xE8F5, 0x47ED,
+  0xC6EC, 0x24EC, 0xE3E3, 0x83E3, 0x83EB, 0x2141, 0x4118, 0x2010,
+  0x2008, 0x0000, 0x2000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x2A07, 0x0027, 0x0000, 0x0000, 0x2000,
+  0x0008, 0x2008, 0x2010, 0x4110, 0x8120, 0xA130, 0x0239, 0x22BB,
+  0x44EC, 0x84EC, 0xE8F5, 0x48F6, 0x28F6, 0x48F6, 0x28F6, 0x48F6,
+  0xC8F5, 0xA6F5, 0xC3E3, 0x83E3, 0x83E3, 0xE289, 0x4110, 0x2008,
+  0x0008, 0x2000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x2B06, 0x0027, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0008, 0x2008, 0x2010, 0x4110, 0x8120, 0xC130,
+  0x0231, 0x02B3, 0x24EC, 0xC6EC, 0xC8ED, 0x48F6, 0xE5F5, 0xE8F5,
+  0x28F6, 0x48F6, 0xC8F5, 0xE8F5, 0xC6EC, 0xE3EB, 0x83E3, 0x22C3,
+  0x4118, 0x2010, 0x2008, 0x0008, 0x2000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2C06, 0x0027, 0x0000,
+  0x0000, 0x0000, 0x2000, 0x0008, 0x2008, 0x2010, 0x6120, 0xA128,
+  0xC130, 0x4241, 0x22B3, 0x84F4, 0xC6EC, 0xA6F5, 0xA6F5, 0x46F6,
+  0x05F6, 0xA6F5, 0xA6F5, 0xC8ED, 0xE8F5, 0x47ED, 0xC3E3, 0x83E3,
+  0x83E3, 0x4118, 0x2008, 0x0008, 0x2000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2D05, 0x002A,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2008, 0x2010,
+  0x6120, 0x8120, 0xC130, 0x0239, 0x0393, 0x84EC, 0xE4EC, 0x44ED,
+  0x05F6, 0x46F6, 0x46F6, 0xA6F5, 0x05ED, 0xA6F5, 0xE8F5, 0xA6F5,
+  0xE3E3, 0x83E3, 0x83E3, 0xE238, 0x2010, 0x2008, 0x0008, 0x2000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x2E06, 0x0029, 0x0000, 0x0000, 0x0000, 0x2000,
+  0x0008, 0x2008, 0x2010, 0x6120, 0x8120, 0xC130, 0x4249, 0x8292,
+  0x84EC, 0xE4F4, 0x44ED, 0xA6F5, 0x46F6, 0x85DD, 0xA4CC, 0x05F5,
+  0xC6EC, 0x47ED, 0xA6F5, 0xC3E3, 0xC3E3, 0x83E3, 0x2141, 0x2008,
+  0x0008, 0x2000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2F05, 0x0029, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0008, 0x2008, 0x2010, 0x6118,
+  0x8120, 0xC130, 0x0239, 0xA251, 0x84EC, 0xE4EC, 0x05ED, 0xA6F5,
+  0xA5E5, 0x2394, 0x838B, 0xC39B, 0x84EC, 0xA4EC, 0xA6F5, 0xC3E3,
+  0xE3EB, 0x83E3, 0x2149, 0x2010, 0x2008, 0x0000, 0x2000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x3005, 0x0029, 0x0000, 0x0000, 0x0000, 0x0000, 0x2000, 0x0008,
+  0x2008, 0x2010, 0x4118, 0x8128, 0xC130, 0x0239, 0x6251, 0x81B3,
+  0xE4EC, 0x25F5, 0x44ED, 0x43AC, 0x838B, 0x0383, 0xC372, 0x81B3,
+  0x63EC, 0x84EC, 0xC3E3, 0xC3E3, 0x83E3, 0xE230, 0x2010, 0x0008,
+  0x2000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x3104, 0x002B, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x2000, 0x0000, 0x0008, 0x2010, 0x4118, 0x8120,
+  0xA130, 0x0239, 0x6249, 0x4272, 0x84EC, 0xE4EC, 0x05F5, 0x2383,
+  0x0383, 0xC372, 0x4272, 0x4272, 0x24EC, 0x44EC, 0xC3E3, 0xE3EB,
+  0x83E3, 0x6120, 0x2010, 0x2008, 0x0000, 0x2000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x3205, 0x002A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2008,
+  0x0008, 0x2010, 0x4110, 0x6120, 0xC128, 0xE238, 0x4241, 0x6251,
+  0x22B3, 0xE4F4, 0xA4CC, 0xA372, 0xC372, 0x427A, 0x2362, 0xA251,
+  0xA2CB, 0x24EC, 0xC3EB, 0xE3E3, 0x22B3, 0x4110, 0x2008, 0x0008,
+  0x0000, 0x2000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x3304, 0x002B, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0008, 0x2010, 0x4118,
+  0x6118, 0xA128, 0xC130, 0xE240, 0x6249, 0xA251, 0x84EC, 0x81B3,
+  0x2362, 0x2362, 0x2362, 0xC251, 0xA251, 0x22B3, 0x23EC, 0xE3EB,
+  0xE3EB, 0xA169, 0x2010, 0x2008, 0x2000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x3405, 0x002B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x2008, 0x0008, 0x2010, 0x4110, 0x6120, 0xA128, 0xC130, 0xE240,
+  0x4241, 0x6251, 0x44EC, 0x4272, 0x2362, 0x2362, 0xA251, 0xA259,
+  0x6249, 0x22B3, 0x23EC, 0x23EC, 0x61DB, 0x6118, 0x2010, 0x2008,
+  0x0000, 0x2000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3505, 0x002A,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2000, 0x0008, 0x2010,
+  0x4118, 0x6120, 0x8120, 0xA128, 0xE238, 0xE238, 0xA169, 0x44EC,
+  0xA251, 0xC259, 0xA251, 0x6251, 0x6249, 0x4241, 0xE19A, 0x23EC,
+  0xE3EB, 0x4151, 0x4118, 0x2010, 0x2008, 0x2008, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x3604, 0x002C, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x2000, 0x0000, 0x2008, 0x0008, 0x2010, 0x2010, 0x6118, 0x8128,
+  0xA128, 0xC130, 0xE240, 0x217A, 0x8292, 0x6249, 0x6249, 0x6251,
+  0x6249, 0x2241, 0xE240, 0x22B3, 0x43EC, 0x8292, 0x6118, 0x4110,
+  0x2010, 0x0008, 0x0008, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x3705, 0x002A, 0x0000, 0x0000, 0x0000, 0x2000, 0x0000, 0x2000,
+  0x0008, 0x2008, 0x2010, 0x4110, 0x6120, 0xA128, 0xC130, 0xE230,
+  0xE240, 0xE240, 0x4241, 0x2241, 0x4241, 0x4241, 0xE240, 0xE240,
+  0x22C3, 0x22BB, 0xA128, 0x6118, 0x4118, 0x2010, 0x0008, 0x2000,
+  0x0000, 0x2000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x3804, 0x002A, 0x0000, 0x0000,
+  0x0000, 0x2000, 0x0000, 0x2008, 0x0008, 0x2008, 0x2008, 0x2010,
+  0x4110, 0x6120, 0x8120, 0xA130, 0xC130, 0xE238, 0xE240, 0x0241,
+  0xE238, 0x0241, 0xE240, 0x0241, 0xC130, 0xE19A, 0xA128, 0x6120,
+  0x4110, 0x2010, 0x2008, 0x0008, 0x2008, 0x0000, 0x2000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x3904, 0x002B, 0x0000, 0x0000, 0x2000, 0x0000, 0x2000, 0x0000,
+  0x2008, 0x0008, 0x2008, 0x2010, 0x4118, 0x6120, 0x6120, 0xA128,
+  0xC130, 0xE230, 0x0241, 0xE240, 0x0239, 0xE240, 0x0241, 0xE238,
+  0xC130, 0xA130, 0x8120, 0x6120, 0x4110, 0x2010, 0x2008, 0x0008,
+  0x2008, 0x0000, 0x2000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3A05, 0x002A, 0x0000,
+  0x0000, 0x2000, 0x0000, 0x2008, 0x0008, 0x2008, 0x2010, 0x2010,
+  0x4118, 0x6120, 0x8120, 0xA128, 0xA128, 0xC130, 0xE238, 0xE240,
+  0x0241, 0xE240, 0xE230, 0xC130, 0xC130, 0xA128, 0x6120, 0x6118,
+  0x4118, 0x2010, 0x2008, 0x0008, 0x2008, 0x0000, 0x2000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x3B04, 0x002A, 0x0000, 0x0000, 0x0000, 0x2000, 0x0000,
+  0x2008, 0x0008, 0x2008, 0x2010, 0x4118, 0x4110, 0x6120, 0x6120,
+  0xA128, 0xC128, 0xC130, 0xE238, 0xE238, 0xE240, 0xE230, 0xE238,
+  0xC130, 0xA130, 0xA128, 0x8120, 0x6120, 0x4110, 0x2010, 0x2010,
+  0x2008, 0x0008, 0x2008, 0x0000, 0x2000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3C05, 0x002A, 0x0000,
+  0x2000, 0x0000, 0x2008, 0x0008, 0x2008, 0x2010, 0x2010, 0x4118,
+  0x6118, 0x6120, 0x8120, 0xA128, 0xC130, 0x4159, 0x4241, 0xE238,
+  0xE230, 0xE238, 0xE238, 0xC130, 0xA128, 0xA128, 0x6120, 0x6120,
+  0x4118, 0x4110, 0x2010, 0x2008, 0x0008, 0x2008, 0x0000, 0x2000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x3D05, 0x0029, 0x0000, 0x0000, 0x2000, 0x0008, 0x0008,
+  0x2008, 0x2010, 0x4118, 0x4110, 0x6120, 0x8120, 0xA128, 0xA128,
+  0xA130, 0xA2CB, 0x4241, 0xE238, 0xE238, 0xE238, 0xE230, 0xC130,
+  0xA130, 0xA128, 0xA128, 0x6120, 0x4110, 0x4118, 0x2010, 0x2008,
+  0x0008, 0x2008, 0x0000, 0x2000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x3E05, 0x0029, 0x2000, 0x0000,
+  0x2008, 0x0008, 0x2008, 0x2008, 0x2010, 0x4118, 0x6118, 0x6120,
+  0x8120, 0xA128, 0xA130, 0x217A, 0xC2F4, 0x2241, 0xE240, 0xE238,
+  0x0241, 0xE238, 0xE230, 0xC130, 0xA130, 0xA128, 0x8120, 0x6120,
+  0x4110, 0x2010, 0x2008, 0x2008, 0x0008, 0x0008, 0x2000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3F0A,
+  0x0023, 0x2010, 0x2010, 0x4118, 0x6120, 0x6120, 0xA128, 0xA128,
+  0xE230, 0x41DC, 0xC2F4, 0xA169, 0x0239, 0x4241, 0x2241, 0x0239,
+  0xE230, 0xC130, 0xA130, 0xA128, 0x8120, 0x6120, 0x4118, 0x4110,
+  0x2010, 0x2008, 0x0008, 0x2008, 0x0000, 0x2000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x4009, 0x0025, 0x2008, 0x2010,
+  0x4118, 0x6118, 0x8128, 0x8128, 0xA128, 0xC130, 0x217A, 0xE1F4,
+  0xC1F4, 0x817A, 0x2241, 0x4241, 0x2249, 0x4241, 0x0239, 0xE238,
+  0xC130, 0xA128, 0xA128, 0x8120, 0x6120, 0x4118, 0x2010, 0x2010,
+  0x0008, 0x0000, 0x2000, 0x0000, 0x2000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x4105, 0x0028, 0x2000, 0x0000, 0x2000,
+  0x0008, 0x2008, 0x2010, 0x4118, 0x6118, 0x6120, 0xA128, 0xC130,
+  0xC230, 0x02BC, 0xC1F4, 0x02F5, 0x01CC, 0x6251, 0x6249, 0x4249,
+  0x2241, 0x4241, 0x0239, 0xE238, 0xC130, 0xA128, 0x8128, 0x6118,
+  0x4118, 0x4118, 0x2010, 0x0008, 0x2008, 0x0000, 0x2000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4204, 0x002A, 0x2000,
+  0x0000, 0x2008, 0x0008, 0x2008, 0x2010, 0x2010, 0x4118, 0x6120,
+  0x8120, 0xA130, 0xC130, 0x6249, 0x22F5, 0x02F5, 0x02F5, 0x02F5,
+  0x2393, 0x6249, 0x6251, 0x6249, 0x2241, 0x4249, 0x0239, 0xC130,
+  0xA128, 0xA128, 0x6120, 0x6118, 0x4118, 0x2010, 0x2008, 0x0008,
+  0x2008, 0x0000, 0x2000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x4304, 0x0028, 0x2000, 0x0000, 0x2008, 0x0008, 0x2008,
+  0x2010, 0x4110, 0x6120, 0x6120, 0xA128, 0xC130, 0xC230, 0x4272,
+  0x02F5, 0x02F5, 0x21F5, 0x42F5, 0x42F5, 0x02BC, 0x4272, 0x6251,
+  0x6249, 0x4249, 0x0239, 0xE238, 0xC130, 0x8128, 0x8120, 0x6120,
+  0x4110, 0x2010, 0x2008, 0x2008, 0x0008, 0x2000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x4405, 0x0026, 0x2000, 0x0008, 0x2008,
+  0x2008, 0x2010, 0x4118, 0x6118, 0x8128, 0x8128, 0xC130, 0x0239,
+  0x819B, 0x22F5, 0x42F5, 0x63F5, 0x43F5, 0x63F5, 0x43F5, 0x63F5,
+  0x02DD, 0x237B, 0x6249, 0x2241, 0x0239, 0xC130, 0xA130, 0x8120,
+  0x6120, 0x4110, 0x2010, 0x2010, 0x0008, 0x2000, 0x0000, 0x2000,
+  0x0000, 0x0000, 0x0000, 0x4505, 0x0027, 0x2000, 0x0008, 0x0008,
+  0x2008, 0x2010, 0x4110, 0x6120, 0xA128, 0xA128, 0xE230, 0x0239,
+  0x02BC, 0x42F5, 0x43ED, 0x43F5, 0x83F5, 0x83F5, 0x83F5, 0x83F5,
+  0x82F5, 0x63F5, 0x02BC, 0x6251, 0x0239, 0xE230, 0x427A, 0x2162,
+  0x6120, 0x4118, 0x4118, 0x2010, 0x2008, 0x0008, 0x2000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x4604, 0x0028, 0x2000, 0x0000,
+  0x2008, 0x0008, 0x2008, 0x4118, 0x4110, 0x6120, 0xA128, 0xC130,
+  0xE238, 0x4241, 0x42D4, 0x82F5, 0x82F5, 0x83F5, 0xA3F5, 0xA3F5,
+  0xA3F5, 0xA3F5, 0x83F5, 0x62F5, 0x82F5, 0x6193, 0x2241, 0x0239,
+  0x81B3, 0x21C4, 0x6120, 0x6118, 0x4118, 0x2010, 0x2008, 0x0008,
+  0x0000, 0x2000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4703, 0x0028,
+  0x2000, 0x0000, 0x2000, 0x0008, 0x2008, 0x2010, 0x4118, 0x6118,
+  0x6120, 0xA128, 0xC130, 0x0239, 0x2241, 0xA3D4, 0x82F5, 0xA3F5,
+  0xA3F5, 0xC3F5, 0xC3F5, 0xC3F5, 0xC3F5, 0xA3F5, 0xA3F5, 0x82F5,
+  0x63F5, 0xC259, 0x0239, 0x239B, 0x819B, 0x8120, 0x6120, 0x4118,
+  0x2010, 0x2008, 0x0008, 0x2000, 0x0000, 0x2000, 0x0000, 0x0000,
+  0x4804, 0x0026, 0x2000, 0x0000, 0x2008, 0x2010, 0x2010, 0x4118,
+  0x6118, 0x8128, 0xA128, 0xE238, 0x0239, 0x4249, 0x22E5, 0xA3F5,
+  0xC3F5, 0xC3F5, 0xE3F5, 0xE3F5, 0xE3F5, 0xE3F5, 0xE3F5, 0xC3F5,
+  0xA3F5, 0x82F5, 0x61AB, 0x0239, 0x4241, 0xE230, 0x8128, 0x6120,
+  0x4110, 0x2010, 0x2008, 0x0008, 0x2008, 0x0000, 0x2000, 0x0000,
+  0x4904, 0x0026, 0x2000, 0x0000, 0x0008, 0x2008, 0x2010, 0x4118,
+  0x6118, 0xC151, 0xE2BB, 0x81B3, 0x6249, 0x4249, 0xE1D4, 0xA3F5,
+  0xE3F5, 0xE3F5, 0xE4F5, 0xA9FE, 0xE4F5, 0x04F6, 0x03F6, 0xE3F5,
+  0xC3F5, 0xA2F5, 0x22E5, 0x2249, 0xE230, 0xC130, 0xA128, 0x6120,
+  0x4118, 0x2010, 0x2008, 0x2008, 0x0008, 0x2000, 0x0000, 0x0000,
+  0x4A03, 0x0026, 0x2000, 0x0000, 0x2008, 0x0008, 0x2008, 0x2010,
+  0x4118, 0x216A, 0x21F5, 0x42F5, 0x42F5, 0x02BC, 0x6249, 0xA1CC,
+  0xE3F5, 0xE3F5, 0x03F6, 0xA9FE, 0xCDF6, 0x43F6, 0x23F6, 0x03FE,
+  0xE3F5, 0xE3F5, 0xA3F5, 0xA2F5, 0x4249, 0x0239, 0xC130, 0xA128,
+  0x6118, 0x4118, 0x4110, 0x2008, 0x0008, 0x0008, 0x2000, 0x0000,
+  0x4B03, 0x0027, 0x2000, 0x0000, 0x2008, 0x0008, 0x2008, 0x2008,
+  0xA128, 0x01F5, 0x42F5, 0x42F5, 0x82F5, 0x82F5, 0xA251, 0x43AC,
+  0xC3F5, 0x03F6, 0x03F6, 0xEDF6, 0x31FF, 0x64FE, 0x64F6, 0x43F6,
+  0x03F6, 0xE3F5, 0xC3F5, 0xA2FD, 0xC259, 0x0239, 0xC130, 0x8128,
+  0x8120, 0x6120, 0x4118, 0x2010, 0x2008, 0x2008, 0x0000, 0x2000,
+  0x0000, 0x4C04, 0x0025, 0x2000, 0x0008, 0x2008, 0x2010, 0x4110,
+  0x218B, 0x62FD, 0x42F5, 0x82F5, 0x62F5, 0xA2F5, 0x037B, 0x819B,
+  0x03F6, 0x23F6, 0x64FE, 0x31FF, 0x33F7, 0x84F6, 0x84FE, 0x64F6,
+  0x03F6, 0x03F6, 0xC3F5, 0xC3F5, 0xA251, 0x0239, 0xE230, 0xA130,
+  0x8120, 0x6120, 0x4110, 0x2010, 0x2008, 0x0008, 0x2000, 0x0000,
+  0x4D05, 0x0026, 0x2000, 0x0008, 0x2008, 0x2110, 0xE1D4, 0x81F5,
+  0x62F5, 0x82F5, 0xA2F5, 0xC2F5, 0x43AC, 0xA372, 0x23F6, 0x43F6,
+  0x44F6, 0x53FF, 0x74FF, 0xC5FE, 0x84F6, 0x64F6, 0x43FE, 0x23F6,
+  0x03F6, 0x62E5, 0x6251, 0x0239, 0xE238, 0xA130, 0x8120, 0x6120,
+  0x4118, 0x2010, 0x2008, 0x2008, 0x0000, 0x2000, 0x0000, 0x0000,
+  0x4E03, 0x0027, 0x2000, 0x0000, 0x2008, 0x0008, 0x2010, 0x2139,
+  0xA1F5, 0xA1F5, 0x81F5, 0xA2F5, 0xC2F5, 0xC2F5, 0xC2BC, 0x2362,
+  0x63CD, 0x64FE, 0x84F6, 0x33FF, 0x74FF, 0xE8FE, 0xA4F6, 0x84F6,
+  0x63F6, 0x43F6, 0x03F6, 0xA39B, 0x6249, 0x2241, 0xE230, 0xA130,
+  0x8120, 0x6120, 0x4110, 0x2010, 0x2008, 0x0008, 0x2000, 0x0000,
+  0x0000, 0x4F04, 0x0028, 0x2000, 0x0000, 0x0008, 0x2008, 0x826A,
+  0x81F5, 0xA1F5, 0x81F5, 0xC2F5, 0xC2F5, 0xE2F5, 0xE1D4, 0x0362,
+  0x43AC, 0x44F6, 0x84F6, 0x31FF, 0x74F7, 0x4CFF, 0xE5FE, 0xA4F6,
+  0x84FE, 0x64F6, 0x23FE, 0x826A, 0x6251, 0x4241, 0xE238, 0xA130,
+  0x8120, 0x6120, 0x4118, 0x2010, 0x2008, 0x2008, 0x0000, 0x2000,
+  0x0000, 0x0000, 0x0000, 0x5003, 0x0029, 0x2000, 0x0000, 0x2008,
+  0x0008, 0x2010, 0x418B, 0xA1FD, 0x81F5, 0xC2F5, 0xC2F5, 0xC2F5,
+  0xC39B, 0xC2BC, 0x826A, 0x838B, 0x84FE, 0xC4FE, 0x4EFF, 0x94FF,
+  0xB0FF, 0xE5F6, 0xC4F6, 0x84F6, 0x64F6, 0xE3ED, 0x0362, 0x2362,
+  0xC39B, 0x826A, 0xC130, 0x8128, 0x6120, 0x4110, 0x2010, 0x2008,
+  0x0008, 0x2000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5102, 0x0029,
+  0x2000, 0x0000, 0x2000, 0x0008, 0x0008, 0x2008, 0x8193, 0xA1F5,
+  0x81ED, 0xC39B, 0xE2FD, 0x2383, 0xA251, 0x0383, 0x826A, 0x0383,
+  0x84F6, 0xE5F6, 0x4AFF, 0xB4F7, 0x94FF, 0x07FF, 0xE5FE, 0x84F6,
+  0x84F6, 0x64FE, 0x43AC, 0xA2E5, 0x02F6, 0xE2F5, 0xC3A3, 0xA128,
+  0x6118, 0x4118, 0x2010, 0x2008, 0x2008, 0x0008, 0x2000, 0x0000,
+  0x0000, 0x5203, 0x0029, 0x2000, 0x0000, 0x2008, 0x2008, 0x2010,
+  0x819B, 0xC2FD, 0x2162, 0xC130, 0x43AC, 0x6251, 0xA251, 0x2362,
+  0xC37A, 0x838B, 0xC4FE, 0xE5FE, 0x07F7, 0xB4FF, 0x94FF, 0x4CF7,
+  0xE5FE, 0xA4F6, 0x84F6, 0x64F6, 0x43F6, 0x03FE, 0x02F6, 0xE2F5,
+  0xE2F5, 0x218B, 0x4118, 0x4110, 0x2010, 0x2008, 0x0008, 0x2000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x5302, 0x002A, 0x2000, 0x0000,
+  0x2000, 0x0008, 0x2008, 0x2008, 0x218B, 0x81ED, 0x8128, 0xE238,
+  0xC251, 0x8349, 0xA251, 0x2362, 0xC372, 0x23AC, 0xE5FE, 0xC5F6,
+  0x26FF, 0x8DF7, 0xB4FF, 0x94FF, 0xE8F6, 0xE5FE, 0x84F6, 0x84FE,
+  0x64F6, 0x43F6, 0x23FE, 0x02F6, 0x02F6, 0xC2FD, 0x8149, 0x4118,
+  0x2010, 0x2008, 0x2008, 0x0000, 0x2000, 0x0000, 0x0000, 0x0000,
+  0x5404, 0x0028, 0x2000, 0x0008, 0x2008, 0x2010, 0x216A, 0x62E5,
+  0xA128, 0xE238, 0x2241, 0x8349, 0x4452, 0x846A, 0xC372, 0x63D5,
+  0xE5FE, 0xE5F6, 0x27FF, 0x4AF7, 0xB4FF, 0x95FF, 0x53FF, 0xA7F6,
+  0xA4F6, 0x84F6, 0x64F6, 0x43F6, 0x43FE, 0x03F6, 0xE2F5, 0x02F6,
+  0xA1CC, 0x4118, 0x2008, 0x2008, 0x0008, 0x0000, 0x2000, 0x0000,
+  0x0000, 0x0000, 0x5503, 0x002A, 0x2000, 0x0000, 0x0008, 0x2008,
+  0x4110, 0xE120, 0xE2FD, 0xE238, 0x0239, 0x8349, 0xA251, 0x2362,
+  0x8462, 0x037B, 0x85F6, 0x05F7, 0x07FF, 0x27F7, 0x4AFF, 0xB5FF,
+  0x95F7, 0x95FF, 0x31FF, 0xA7FE, 0x85F6, 0x84F6, 0x85F6, 0xA9FE,
+  0x42F6, 0x22F6, 0x22F6, 0x02FE, 0xC159, 0x2010, 0x2008, 0x0008,
+  0x2000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5604, 0x0029,
+  0x2008, 0x2008, 0x2010, 0x4118, 0x8120, 0xC2C4, 0xC151, 0x0239,
+  0xA349, 0xC259, 0x2362, 0x8462, 0x03BD, 0xC7FE, 0x07F7, 0x27FF,
+  0x07F7, 0x4EFF, 0x95FF, 0xB5FF, 0x95F7, 0x74FF, 0x53FF, 0xA7F6,
+  0x85F6, 0xEDF6, 0x33FF, 0xA7F6, 0x22F6, 0x22F6, 0x22F6, 0xC39B,
+  0x2110, 0x2010, 0x0008, 0x2000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x5703, 0x002B, 0x2000, 0x0000, 0x2008, 0x2010, 0x8010,
+  0x8120, 0xC151, 0x838B, 0x2241, 0x8349, 0x245A, 0x8462, 0xA372,
+  0x66F6, 0xA7F6, 0x08F7, 0xE8FE, 0x08F7, 0x94FF, 0xB5FF, 0x95F7,
+  0xB5FF, 0x95FF, 0x74FF, 0x74FF, 0x2EF7, 0x53FF, 0x33FF, 0xEDFE,
+  0x43F6, 0x42F6, 0x22F6, 0x62ED, 0x4118, 0x6008, 0x2008, 0x0008,
+  0x2000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5803, 0x002B,
+  0x0000, 0x2000, 0x4008, 0x2010, 0xA018, 0x8120, 0xE128, 0xA272,
+  0x8239, 0xC251, 0x245A, 0x8462, 0xC5C5, 0xA7FE, 0x08FF, 0xE8FE,
+  0x29F7, 0x4CFF, 0xB6FF, 0x96FF, 0xB6FF, 0x95FF, 0x95FF, 0xB5FF,
+  0x74F7, 0x74FF, 0x74FF, 0x74F7, 0x4EFF, 0x44F6, 0x43F6, 0x22F6,
+  0x22F6, 0xC118, 0x2010, 0x0008, 0x0000, 0x2000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x5903, 0x002B, 0x2008, 0x2000, 0x2008,
+  0x8010, 0xA118, 0xC120, 0xE128, 0x6231, 0x8349, 0xE349, 0x2452,
+  0x2394, 0xA7F6, 0xE8FE, 0x08F7, 0x09FF, 0x09FF, 0x74F7, 0xB6FF,
+  0x96FF, 0xB6FF, 0xB6FF, 0x95FF, 0xB5FF, 0x95FF, 0x74F7, 0x74FF,
+  0x74FF, 0x4EFF, 0x83F6, 0x82F6, 0x62FE, 0x62FE, 0x8149, 0x4118,
+  0x2008, 0x2008, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x5A02, 0x002B, 0x2000, 0x2000, 0x4008, 0x4008, 0x8010, 0x8120,
+  0xE128, 0x2231, 0x6231, 0x8349, 0x4452, 0x647B, 0xC7FE, 0x08FF,
+  0xE8F6, 0x29FF, 0x09FF, 0x4CFF, 0xB7FF, 0xB7F7, 0xB7FF, 0xB6FF,
+  0xB6FF, 0x96FF, 0xB6FF, 0x95FF, 0x95FF, 0x74F7, 0x74FF, 0x4EF7,
+  0x84F6, 0x83FE, 0x42F6, 0x42F6, 0x6141, 0x8010, 0x2008, 0x2008,
+  0x2000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5B04, 0x002A, 0x4008,
+  0x4008, 0xA010, 0xC120, 0xE128, 0x2229, 0x8239, 0xE349, 0x6462,
+  0x66F6, 0x08FF, 0xE8F6, 0x29FF, 0x09FF, 0x6AF7, 0x94FF, 0xB7FF,
+  0xB7F7, 0xB7FF, 0xB7FF, 0xB7FF, 0x96FF, 0xB6FF, 0xB5F7, 0x95FF,
+  0x74FF, 0x74FF, 0xEDFE, 0x84F6, 0x83F6, 0x82FE, 0x82FE, 0x6239,
+  0x8010, 0x4008, 0x4008, 0x2000, 0x2000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x5C02, 0x002C, 0x2008, 0x2000, 0x6010, 0x8010, 0xA018,
+  0xC120, 0x0121, 0x6239, 0x8239, 0x2452, 0x65E6, 0x27FF, 0xE8FE,
+  0x29FF, 0x09F7, 0x6AFF, 0x31FF, 0xB7FF, 0xD7F7, 0xB7FF, 0xB7FF,
+  0xB7FF, 0xB7F7, 0xB7FF, 0xB7FF, 0xB6FF, 0x95FF, 0x95F7, 0x74FF,
+  0x08F7, 0xA4F6, 0xA4FE, 0x82F6, 0x82F6, 0xA118, 0xA010, 0x4008,
+  0x4008, 0x2000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5D02,
+  0x002B, 0x2000, 0x4008, 0x4008, 0x6010, 0xA018, 0xC120, 0x2229,
+  0x6231, 0xE349, 0xA5BD, 0x27FF, 0xE8F6, 0x29FF, 0x09FF, 0x4AFF,
+  0x4CF7, 0xB7FF, 0xD8FF, 0xD8FF, 0xD8FF, 0xD8FF, 0xD8FF, 0xD8FF,
+  0xB7FF, 0xB7F7, 0xB6FF, 0xB6FF, 0x95FF, 0x4CFF, 0xC5FE, 0xE5F6,
+  0xA4FE, 0xC2F6, 0x63D5, 0xC120, 0xA018, 0x8010, 0x4008, 0x2008,
+  0x2000, 0x0000, 0x0000, 0x0000, 0x5E01, 0x002C, 0x2000, 0x2000,
+  0x4008, 0x4008, 0x8010, 0xA018, 0x0129, 0x2229, 0x8239, 0x439C,
+  0x05FF, 0x27FF, 0xE8F6, 0x29FF, 0x4AFF, 0x4CFF, 0x74F7, 0xD8FF,
+  0xD8FF, 0xD8FF, 0xF9FF, 0xD8FF, 0xD8FF, 0xD8FF, 0xD8FF, 0xB7FF,
+  0xB7FF, 0xB6FF, 0x33FF, 0xE8F6, 0x27FF, 0xE5F6, 0xC4F6, 0xC3FE,
+  0x2394, 0xA118, 0xA018, 0x6010, 0x4008, 0x2000, 0x2000, 0x2000,
+  0x0000, 0x0000, 0x5F01, 0x002D, 0x2000, 0x2000, 0x2008, 0x8010,
+  0xA018, 0xC120, 0xE120, 0x2229, 0xE341, 0xC5EE, 0x26FF, 0x07F7,
+  0x29FF, 0x4AFF, 0x4CF7, 0xB0FF, 0xD8FF, 0xD8FF, 0xF9FF, 0xDAFF,
+  0xFAFF, 0xDAFF, 0xFAFF, 0xD9FF, 0xD8FF, 0xD8FF, 0xB7FF, 0xB7FF,
+  0x4EF7, 0xE8FE, 0x27FF, 0x05F7, 0xE5FE, 0xE3FE, 0xE349, 0x0129,
+  0xA018, 0x8010, 0x4008, 0x4008, 0x2008, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x6000, 0x002E, 0x2000, 0x2008, 0x2000, 0x4008, 0x8010,
+  0xA018, 0xC120, 0x0129, 0x6231, 0x236B, 0x05FF, 0x27FF, 0x27FF,
+  0x09FF, 0x6AFF, 0x4CF7, 0xB7FF, 0xD8FF, 0xD9FF, 0xFAFF, 0xDBFF,
+  0xFBFF, 0xDBFF, 0xFAFF, 0xDAFF, 0xF9FF, 0xD8FF, 0xD8FF, 0xB7FF,
+  0x4EF7, 0x09FF, 0x07FF, 0x26F7, 0x05F7, 0x03B5, 0x0229, 0x0121,
+  0xA018, 0x6010, 0x4008, 0x4008, 0x2000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x6101, 0x002C, 0x2008, 0x2000, 0x4008, 0x8010, 0xA018,
+  0xC118, 0xE128, 0x6231, 0x2394, 0x05F7, 0x27F7, 0x09FF, 0x6AFF,
+  0x4CF7, 0xB2FF, 0xD8FF, 0xF9FF, 0xDAFF, 0xDBFF, 0xFCFF, 0xDCFF,
+  0xFCFF, 0xFBFF, 0xDBFF, 0xFAFF, 0xD8FF, 0xD8FF, 0xB7FF, 0xB0FF,
+  0x09FF, 0x27F7, 0x26FF, 0x05FF, 0xA362, 0x2231, 0x0121, 0xC120,
+  0x8010, 0x4008, 0x4008, 0x2008, 0x2000, 0x0000, 0x0000, 0x6200,
+  0x002D, 0x2000, 0x2000, 0x4008, 0x4008, 0x8010, 0xA018, 0xC120,
+  0x0129, 0x6231, 0xC4A4, 0x26FF, 0x07FF, 0x48FF, 0x6AFF, 0x8DFF,
+  0xD7FF, 0xD8FF, 0xDAFF, 0xFBFF, 0xFCFF, 0xFDFF, 0xFDFF, 0xFDFF,
+  0xDCFF, 0xDBFF, 0xFAFF, 0xD9FF, 0xD8FF, 0xD7FF, 0xB0F7, 0x69FF,
+  0x47FF, 0x07F7, 0xA5C5, 0x8231, 0x2229, 0x0129, 0xC118, 0x8010,
+  0x4008, 0x4008, 0x2000, 0x0000, 0x0000, 0x0000, 0x6301, 0x002D,
+  0x2000, 0x4008, 0x4008, 0x8010, 0xA010, 0xC120, 0xE120, 0x6231,
+  0x45AD, 0x26FF, 0x47FF, 0x48F7, 0x4AFF, 0xD2FF, 0xD8FF, 0xD8FF,
+  0xDAFF, 0xDBFF, 0xFCFF, 0xFEFF, 0xFEFF, 0xFEFF, 0xFDFF, 0xFCFF,
+  0xDAFF, 0xF9FF, 0xD8FF, 0xD7FF, 0xB0FF, 0x49FF, 0x68FF, 0x27FF,
+  0x6594, 0x8239, 0x2229, 0x0129, 0xC120, 0x8010, 0x4008, 0x4008,
+  0x2008, 0x0000, 0x0000, 0x0000, 0x0000, 0x6401, 0x002B, 0x2008,
+  0x4008, 0x4008, 0x8010, 0xA018, 0xC120, 0x0121, 0x6239, 0x65B5,
+  0x46FF, 0x47FF, 0x69FF, 0x6AFF, 0xD7FF, 0xD8FF, 0xD9FF, 0xDAFF,
+  0xFBFF, 0xFDFF, 0xFEFF, 0xFEFF, 0xFEFF, 0xFEFF, 0xFCFF, 0xDBFF,
+  0xD9FF, 0xD8FF, 0xD7FF, 0xD2FF, 0x49F7, 0x48FF, 0x46FF, 0x6473,
+  0x8239, 0x2229, 0x0121, 0xC120, 0x8010, 0x4008, 0x4008, 0x2000,
+  0x0000, 0x0000, 0x6501, 0x002C, 0x2000, 0x4008, 0x4008, 0x8010,
+  0xA018, 0xC118, 0xE120, 0x6231, 0x45B5, 0x45F7, 0x47FF, 0x49FF,
+  0xB0FF, 0xD7FF, 0xD8FF, 0xD8FF, 0xDAFF, 0xDBFF, 0xFDFF, 0xFEFF,
+  0xFEFF, 0xFEFF, 0xFDFF, 0xFCFF, 0xFBFF, 0xD9FF, 0xD8FF, 0xD7FF,
+  0xD2FF, 0x49FF, 0x68FF, 0x46FF, 0xC362, 0x8239, 0x2229, 0x0129,
+  0xA018, 0x8010, 0x4008, 0x4008, 0x2000, 0x0000, 0x0000, 0x0000,
+  0x6601, 0x002B, 0x2008, 0x4008, 0x4008, 0x8010, 0xA018, 0xC120,
+  0x0121, 0x6239, 0x03B5, 0x66FF, 0x47FF, 0x48FF, 0xB4FF, 0xD7FF,
+  0xD8FF, 0xD8FF, 0xD9FF, 0xDBFF, 0xFCFF, 0xFDFF, 0xFDFF, 0xFDFF,
+  0xFCFF, 0xDBFF, 0xDAFF, 0xF9FF, 0xD8FF, 0xD7FF, 0xB2FF, 0x69FF,
+  0x48F7, 0x66F7, 0x2452, 0x8239, 0x2229, 0xE128, 0xA010, 0x8010,
+  0x4008, 0x4008, 0x2000, 0x0000, 0x0000, 0x6701, 0x002B, 0x2000,
+  0x4008, 0x4008, 0x8010, 0xA018, 0xC120, 0xE120, 0x2229, 0xA49C,
+  0x65FF, 0x66FF, 0x48FF, 0xD4FF, 0xD6FF, 0xD7FF, 0xD8FF, 0xD9FF,
+  0xFAFF, 0xDBFF, 0xDCFF, 0xFCFF, 0xDCFF, 0xFCFF, 0xFBFF, 0xD9FF,
+  0xD8FF, 0xD8FF, 0xD7FF, 0x94FF, 0x89FF, 0x68FF, 0x86FF, 0x2452,
+  0x6239, 0x2229, 0xC120, 0xA018, 0x8010, 0x4008, 0x4008, 0x2008,
+  0x0000, 0x0000, 0x6801, 0x002B, 0x2000, 0x2008, 0x4008, 0x8010,
+  0x6010, 0xA018, 0x0121, 0x2231, 0xE483, 0x85FF, 0x66FF, 0x88FF,
+  0xD2FF, 0xD6FF, 0xB7FF, 0xD8FF, 0xD8FF, 0xD9FF, 0xFAFF, 0xDBFF,
+  0xFBFF, 0xDBFF, 0xFAFF, 0xDAFF, 0xF9FF, 0xD8FF, 0xD8FF, 0xD7FF,
+  0xB4FF, 0x88F7, 0x87FF, 0x66FF, 0xA35A, 0x6231, 0xE120, 0xC120,
+  0xA018, 0x8010, 0x4008, 0x4008, 0x2000, 0x0000, 0x0000, 0x6902,
+  0x002B, 0x2000, 0x4008, 0x4008, 0x8010, 0x8010, 0xC120, 0x2229,
+  0x0363, 0x65FF, 0x66F7, 0x88FF, 0x8DFF, 0xD6FF, 0xD7FF, 0xD8FF,
+  0xD8FF, 0xD8FF, 0xD9FF, 0xFAFF, 0xDAFF, 0xFAFF, 0xD9FF, 0xD9FF,
+  0xD8FF, 0xD8FF, 0xD7FF, 0xD6FF, 0xD4FF, 0x88FF, 0x87FF, 0x86FF,
+  0x236B, 0x2229, 0x0129, 0xC120, 0xA018, 0x8010, 0x4008, 0x4008,
+  0x2000, 0x0000, 0x0000, 0x0000, 0x6A01, 0x002B, 0x2000, 0x2008,
+  0x4008, 0x4008, 0x8010, 0xA018, 0xC120, 0x0121, 0xE241, 0x85FF,
+  0x66FF, 0x88FF, 0x89FF, 0xD5FF, 0xD7FF, 0xD7FF, 0xD8FF, 0xD8FF,
+  0xD8FF, 0xD8FF, 0xD9FF, 0xF9FF, 0xD9FF, 0xD8FF, 0xD8FF, 0xD7FF,
+  0xD7FF, 0xD6FF, 0xB4FF, 0x88FF, 0x87F7, 0x66FF, 0x6473, 0x2229,
+  0x0121, 0xC120, 0xA010, 0x4008, 0x4008, 0x2000, 0x2008, 0x0000,
+  0x0000, 0x6B02, 0x0029, 0x2000, 0x4008, 0x4008, 0x8010, 0xA018,
+  0xC118, 0xE120, 0x2229, 0xA5E6, 0x66FF, 0x87FF, 0x88F7, 0xB0FF,
+  0xB6FF, 0xD7FF, 0xD7FF, 0xD8FF, 0xD8FF, 0xD8FF, 0xF8FF, 0xD8FF,
+  0xD8FF, 0xD8FF, 0xD7FF, 0xB7FF, 0xD6FF, 0xB6FF, 0xD4FF, 0x88FF,
+  0x86FF, 0x86FF, 0x439C, 0x2229, 0xC120, 0xA018, 0x8010, 0x4008,
+  0x4008, 0x2008, 0x2000, 0x0000, 0x6C02, 0x0029, 0x2000, 0x2008,
+  0x4008, 0x4008, 0x8010, 0xA018, 0xC120, 0x0121, 0x65B5, 0x86FF,
+  0x87FF, 0x88FF, 0x8BFF, 0xD6FF, 0xD6FF, 0xB7FF, 0xD7FF, 0xD7FF,
+  0xD7FF, 0xD8FF, 0xD7FF, 0xD7FF, 0xD7F7, 0xD7FF, 0xB6FF, 0xD6FF,
+  0xB6FF, 0xD4FF, 0x88FF, 0x66F7, 0x66FF, 0xC4A4, 0xE120, 0xC118,
+  0xA010, 0x6010, 0x4008, 0x4008, 0x2000, 0x0000, 0x0000, 0x6D02,
+  0x0029, 0x2008, 0x2000, 0x4008, 0x4008, 0x8010, 0xA010, 0xC120,
+  0xE120, 0x646B, 0x66FF, 0x87FF, 0x88FF, 0x88F7, 0xB0FF, 0xD6FF,
+  0xB6FF, 0xD7FF, 0xB7FF, 0xD7FF, 0xD2FF, 0xADF7, 0xACFF, 0xB0FF,
+  0xD6FF, 0xB6FF, 0xD6FF, 0xB6FF, 0xD4FF, 0x87FF, 0x86FF, 0x86FF,
+  0x65B5, 0xC120, 0xA018, 0x8010, 0x4008, 0x2008, 0x4008, 0x2008,
+  0x2000, 0x0000, 0x6E03, 0x0027, 0x2000, 0x4008, 0x2008, 0x8010,
+  0x6010, 0xA018, 0xC120, 0x6231, 0x66FF, 0xA7FF, 0x87FF, 0x88FF,
+  0x89FF, 0xD4FF, 0xB6FF, 0xD6FF, 0xB6FF, 0xB2F7, 0xABFF, 0x8BFF,
+  0xABFF, 0x8BF7, 0x8DFF, 0xD6FF, 0xD5FF, 0xB5FF, 0xB2FF, 0x87F7,
+  0x86FF, 0x66FF, 0xA5C5, 0xC118, 0xA010, 0x6010, 0x4008, 0x4008,
+  0x2000, 0x2000, 0x0000, 0x6F04, 0x0026, 0x2000, 0x4008, 0x4008,
+  0x8010, 0x8010, 0xC120, 0xC118, 0x45AD, 0x86FF, 0x87FF, 0x88F7,
+  0x88FF, 0xACFF, 0xD5FF, 0xD6FF, 0xD6FF, 0x8CFF, 0x8AFF, 0x6AEF,
+  0x458C, 0xAAFF, 0x89FF, 0xADFF, 0xB5FF, 0xD5FF, 0xAFFF, 0x87FF,
+  0x86FF, 0x86FF, 0x26CE, 0xA018, 0x8010, 0x4008, 0x4008, 0x2000,
+  0x2008, 0x0000, 0x0000, 0x7003, 0x0026, 0x2000, 0x2008, 0x2000,
+  0x4008, 0x4008, 0x8010, 0xA018, 0xC120, 0xA362, 0xA7FF, 0x87FF,
+  0x87FF, 0x88FF, 0xA8FF, 0xAFFF, 0xD5FF, 0xB2FF, 0x89FF, 0x89F7,
+  0xA5C5, 0x2452, 0xA5C5, 0x89FF, 0xC8FF, 0xAFFF, 0xD4F7, 0x89FF,
+  0x87FF, 0x87F7, 0x66FF, 0x26C6, 0x8010, 0x6010, 0x4008, 0x4008,
+  0x2000, 0x0000, 0x0000, 0x7105, 0x0024, 0x2000, 0x4008, 0x4008,
+  0x6010, 0x8010, 0x8018, 0xC118, 0x45DE, 0x87F7, 0x87FF, 0xA7FF,
+  0xA8F7, 0xA8FF, 0xD2FF, 0xAFFF, 0x89FF, 0x89FF, 0xC4A4, 0xE349,
+  0x646B, 0xA8FF, 0xA8FF, 0xA7F7, 0xA7FF, 0x87FF, 0x87FF, 0x87FF,
+  0x86FF, 0xC5CD, 0x8010, 0x4008, 0x4008, 0x2008, 0x2000, 0x0000,
+  0x0000, 0x7204, 0x0023, 0x2000, 0x2000, 0x2008, 0x4008, 0x4008,
+  0x8010, 0x6010, 0xA018, 0xA362, 0xA7FF, 0x87FF, 0xA7FF, 0xA7FF,
+  0xA8FF, 0xC9FF, 0x8BF7, 0xA8FF, 0xA8FF, 0x658C, 0x8239, 0x8239,
+  0x68F7, 0xA8FF, 0xA7FF, 0x87F7, 0x87FF, 0x87FF, 0x87FF, 0x87F7,
+  0xC4A4, 0x4000, 0x2008, 0x2000, 0x2000, 0x0000, 0x7306, 0x0023,
+  0x2008, 0x2000, 0x4008, 0x4008, 0x8010, 0x6008, 0x8010, 0x6594,
+  0x87F7, 0xA7FF, 0xA7FF, 0xA8FF, 0xA8FF, 0xA8FF, 0xA8FF, 0xA8FF,
+  0x6594, 0x6231, 0x0229, 0x26C6, 0x88FF, 0xA7FF, 0xA7FF, 0xA7FF,
+  0xA7FF, 0xA7FF, 0xA7FF, 0x6252, 0x4008, 0x4008, 0x2008, 0x2000,
+  0x0000, 0x0000, 0x0000, 0x7405, 0x0021, 0x2000, 0x0000, 0x2000,
+  0x4008, 0x4008, 0x4008, 0x8010, 0x6010, 0xA018, 0x6594, 0xC7FF,
+  0xA7FF, 0xA7FF, 0xA8FF, 0xA8FF, 0xA8FF, 0xA8FF, 0x6473, 0xE120,
+  0x0121, 0xC4A4, 0xC7FF, 0xA7FF, 0xA7FF, 0xA7FF, 0xA7FF, 0xA7FF,
+  0xA49C, 0x4008, 0x2000, 0x2000, 0x2000, 0x0000, 0x7508, 0x001F,
+  0x2000, 0x4008, 0x4008, 0x4008, 0x4008, 0x8010, 0x6010, 0x624A,
+  0xA5BD, 0x88F7, 0xA7FF, 0xA8FF, 0xC8FF, 0xA8FF, 0xC241, 0xC120,
+  0xC118, 0x6473, 0xA7FF, 0xA7FF, 0xA7FF, 0xA7FF, 0xA7FF, 0x439C,
+  0x4008, 0x4008, 0x2000, 0x2008, 0x2000, 0x0000, 0x0000, 0x7608,
+  0x001D, 0x2000, 0x2000, 0x4008, 0x2008, 0x4008, 0x4008, 0x8010,
+  0x6010, 0x8010, 0x2231, 0x236B, 0x6594, 0x4594, 0xA35A, 0x8018,
+  0xA010, 0xA018, 0x6252, 0xC7FF, 0xA7FF, 0x47F7, 0x45B5, 0xE239,
+  0x2000, 0x2000, 0x2000, 0x2008, 0x0000, 0x0000, 0x770A, 0x001B,
+  0x2000, 0x2000, 0x4008, 0x4008, 0x4008, 0x4008, 0x8010, 0x6010,
+  0x8010, 0x6010, 0x8010, 0x6010, 0x8010, 0x6010, 0x8010, 0x8010,
+  0xA018, 0xC120, 0x4010, 0x4008, 0x4008, 0x2000, 0x2008, 0x2000,
+  0x2000, 0x0000, 0x0000, 0x7809, 0x001B, 0x2000, 0x0000, 0x2008,
+  0x2000, 0x2008, 0x4008, 0x4008, 0x2000, 0x4008, 0x6008, 0x4010,
+  0x6008, 0x4008, 0x6008, 0x4010, 0x6008, 0x4008, 0x6008, 0x4008,
+  0x2008, 0x4008, 0x2000, 0x2008, 0x0000, 0x0000, 0x2000, 0x0000,
+  0x790D, 0x0005, 0x2008, 0x2000, 0x2008, 0x2000, 0x4008, 0x791A,
+  0x0007, 0x4008, 0x2000, 0x2008, 0x2000, 0x0000, 0x2000, 0x0000,
+  0x7A0C, 0x0015, 0x2000, 0x0000, 0x2000, 0x2000, 0x2008, 0x2000,
+  0x2008, 0x2000, 0x2008, 0x2000, 0x2008, 0x2000, 0x2008, 0x2000,
+  0x2008, 0x2000, 0x0000, 0x2000, 0x0000, 0x0000, 0x0000, 0x7B0F,
+  0x000F, 0x2000, 0x0000, 0x2000, 0x2008, 0x2000, 0x2008, 0x2000,
+  0x2008, 0x2000, 0x2008, 0x0000, 0x2000, 0x0000, 0x2000, 0x0000,
+  0x7C13, 0x0001, 0x2000, 0x7C19, 0x0001, 0x0000, 0x0E13, 0x0003,
+  0x0000, 0x0000, 0x0000, 0x0F12, 0x0003, 0x0000, 0x0000, 0x0000,
+  0x1013, 0x0008, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2000,
+  0x0000, 0x2000, 0x1112, 0x000A, 0x0000, 0x2000, 0x0000, 0x2000,
+  0x0000, 0x2000, 0x0000, 0x2000, 0x0000, 0x2000, 0x1212, 0x000D,
+  0x2008, 0x0000, 0x2000, 0x0000, 0x2008, 0x0008, 0x2000, 0x0000,
+  0x2000, 0x0000, 0x2000, 0x0000, 0x2000, 0x1312, 0x000D, 0x2000,
+  0x0000, 0x2008, 0x0000, 0x2008, 0x0000, 0x2008, 0x0000, 0x2008,
+  0x0000, 0x2008, 0x0008, 0x2000, 0x140F, 0x0010, 0x2000, 0x0000,
+  0x2000, 0x0008, 0x2008, 0x0000, 0x2008, 0x0008, 0x2008, 0x0000,
+  0x2008, 0x0008, 0x2008, 0x2000, 0x0000, 0x2000, 0x1510, 0x0011,
+  0x2000, 0x0000, 0x2008, 0x0008, 0x2008, 0x2008, 0x2010, 0x2008,
+  0x2008, 0x2008, 0x2008, 0x2008, 0x2008, 0x0008, 0x2008, 0x0000,
+  0x2008, 0x160E, 0x0013, 0x2000, 0x0008, 0x2008, 0x0000, 0x2008,
+  0x2008, 0x2008, 0x2008, 0x2010, 0x2010, 0x2010, 0x2010, 0x2010,
+  0x2010, 0x2008, 0x0008, 0x2008, 0x0000, 0x2000, 0x170E, 0x0015,
+  0x2000, 0x0008, 0x2000, 0x0008, 0x2010, 0x2008, 0x2010, 0x2010,
+  0x2010, 0x2010, 0x4118, 0x2010, 0x2010, 0x2010, 0x2008, 0x2008,
+  0x2008, 0x0000, 0x2008, 0x0000, 0x2000, 0x180D, 0x0016, 0x2000,
+  0x0000, 0x2008, 0x0008, 0x2008, 0x2008, 0x2010, 0x4118, 0x4110,
+  0x6120, 0x82B2, 0x82AA, 0xE238, 0x4118, 0x2010, 0x2010, 0x2008,
+  0x2008, 0x0008, 0x2000, 0x0000, 0x2000, 0x190D, 0x0016, 0x2000,
+  0x0000, 0x0008, 0x2010, 0x2008, 0x2010, 0x4110, 0x4118, 0x6118,
+  0x6118, 0x82AA, 0xE2E2, 0xA2DA, 0x6118, 0x4118, 0x4118, 0x2010,
+  0x2008, 0x0008, 0x2008, 0x0008, 0x2000, 0x1A0D, 0x0017, 0x2000,
+  0x0008, 0x2008, 0x2008, 0x2010, 0x4118, 0x4118, 0x6118, 0x8120,
+  0xA120, 0x82AA, 0x23E3, 0x23E3, 0x4151, 0x6118, 0x4110, 0x4118,
+  0x2010, 0x2008, 0x0008, 0x2000, 0x0000, 0x2000, 0x1B0C, 0x0017,
+  0x2000, 0x0008, 0x2008, 0x2008, 0x2008, 0x2010, 0x4110, 0x6120,
+  0x8120, 0x8118, 0xE230, 0x23E3, 0x23E3, 0x23E3, 0x217A, 0xA118,
+  0x6120, 0x4118, 0x2010, 0x2008, 0x2008, 0x0008, 0x2008, 0x1C0C,
+  0x0019, 0x2000, 0x0008, 0x2008, 0x2008, 0x2010, 0x4110, 0x6120,
+  0x8120, 0xA118, 0xE128, 0x8292, 0x23E3, 0x23E3, 0x23E3, 0x828A,
+  0x8118, 0xA118, 0x6120, 0x4110, 0x2010, 0x2008, 0x0008, 0x2008,
+  0x0000, 0x2000, 0x1D0C, 0x0018, 0x2000, 0x0008, 0x2008, 0x2008,
+  0x2010, 0x4118, 0xA118, 0x8118, 0xC128, 0x2172, 0x83E3, 0x83E3,
+  0x83E3, 0x83E3, 0x82B2, 0xE128, 0xA120, 0x8118, 0x4118, 0x2010,
+  0x2008, 0x2008, 0x0008, 0x2000, 0x1E0B, 0x001A, 0x2000, 0x0000,
+  0x2008, 0x2008, 0x2010, 0x4118, 0x6120, 0x8118, 0x2139, 0x23E3,
+  0x83E3, 0x83E3, 0xE3EB, 0xC3E3, 0x83E3, 0x828A, 0xE128, 0xC118,
+  0x8118, 0x6120, 0x4118, 0x2008, 0x2008, 0x2008, 0x0000, 0x2000,
+  0x1F0C, 0x0018, 0x2000, 0x0008, 0x2008, 0x2010, 0x4110, 0xA120,
+  0x8118, 0xE289, 0x83E3, 0xE3E3, 0xC3E3, 0xE3E3, 0xC3EB, 0xE3E3,
+  0x8292, 0x2231, 0xE128, 0xA120, 0x6118, 0x4118, 0x2010, 0x2008,
+  0x0008, 0x2008, 0x200B, 0x001A, 0x2000, 0x0000, 0x2008, 0x2010,
+  0x2010, 0x4118, 0x8118, 0xC120, 0x22CB, 0xE3EB, 0xC3E3, 0x44EC,
+  0x24E4, 0x24EC, 0x24E4, 0x0162, 0x0131, 0xE128, 0xC120, 0x8118,
+  0x4118, 0x2010, 0x2008, 0x2008, 0x0000, 0x2000, 0x210E, 0x0018,
+  0x2008, 0x2010, 0x4118, 0x8118, 0xC118, 0x83E3, 0xE3E3, 0xC3E3,
+  0x24EC, 0x63EC, 0x63F4, 0xA2CB, 0x8239, 0x2139, 0xE128, 0xC120,
+  0xA118, 0x4118, 0x2010, 0x2008, 0x0008, 0x2008, 0x0000, 0x2000,
+  0x220D, 0x0019, 0x2008, 0x2008, 0x2010, 0x4118, 0x8120, 0xE238,
+  0x83E3, 0xE3EB, 0x44EC, 0x24E4, 0x84EC, 0x84EC, 0x0383, 0x8141,
+  0x6231, 0xE128, 0xC120, 0x8118, 0x4118, 0x2010, 0x2008, 0x0008,
+  0x2000, 0x0000, 0x2000, 0x230F, 0x0016, 0x2010, 0x4110, 0xA118,
+  0x0239, 0xC3EB, 0xC3E3, 0x24EC, 0x63EC, 0xA4EC, 0x02BC, 0x6252,
+  0x8149, 0x6239, 0xE128, 0xC120, 0x8118, 0x4118, 0x2010, 0x2008,
+  0x2008, 0x0008, 0x2000, 0x240A, 0x001B, 0x0000, 0x2000, 0x0008,
+  0x2008, 0x2008, 0x2010, 0x4110, 0x8120, 0x2139, 0xE3EB, 0xC3E3,
+  0x44EC, 0x63EC, 0x42D4, 0x624A, 0xE349, 0x8239, 0x6231, 0xE128,
+  0xC120, 0x8120, 0x4110, 0x2010, 0x2008, 0x2008, 0x0008, 0x2000,
+  0x250B, 0x001B, 0x0000, 0x2008, 0x0008, 0x2008, 0x2010, 0x6118,
+  0x8118, 0xE128, 0xE3E3, 0xC3E3, 0x23EC, 0x44EC, 0xC37A, 0xE349,
+  0xE241, 0x8239, 0x2139, 0xE128, 0xC118, 0xA120, 0x4118, 0x2010,
+  0x2008, 0x0008, 0x2000, 0x0000, 0x2000, 0x260A, 0x001C, 0x0000,
+  0x2000, 0x0000, 0x2008, 0x2008, 0x2010, 0x4118, 0x8120, 0xA118,
+  0x83EB, 0xE3EB, 0x23E4, 0xA2CB, 0xC239, 0xE241, 0x8239, 0x6231,
+  0x2231, 0x2139, 0x2131, 0x8120, 0x4110, 0x2010, 0x2008, 0x0008,
+  0x2008, 0x0000, 0x2000, 0x2709, 0x001C, 0x0000, 0x0000, 0x0000,
+  0x2000, 0x0008, 0x2008, 0x2010, 0x4118, 0x6118, 0x8118, 0x22B3,
+  0xE3E3, 0x23EC, 0x22BB, 0xA239, 0x8239, 0x6231, 0x0139, 0x2162,
+  0x83E3, 0xC169, 0x6120, 0x4118, 0x2010, 0x2008, 0x0008, 0x2000,
+  0x0000, 0x280A, 0x001A, 0x0000, 0x2000, 0x0000, 0x2008, 0x0008,
+  0x2008, 0x2010, 0x4118, 0xA120, 0xA169, 0xE3EB, 0x23EC, 0x22B3,
+  0x2131, 0x0131, 0x2139, 0x0139, 0xC1E3, 0xC3EB, 0x2172, 0x4110,
+  0x2010, 0x2008, 0x2008, 0x0008, 0x0000, 0x290A, 0x001B, 0x0000,
+  0x0000, 0x0000, 0x2008, 0x0008, 0x2008, 0x2010, 0x4110, 0x8118,
+  0x8128, 0xA2CB, 0xE3EB, 0xA2CB, 0x2229, 0x2229, 0xE128, 0xA161,
+  0xC3EB, 0xC1E3, 0x22BB, 0x4118, 0x2010, 0x2008, 0x2008, 0x0008,
+  0x2000, 0x0000, 0x2A09, 0x001B, 0x0000, 0x0000, 0x0000, 0x2000,
+  0x0008, 0x2008, 0x2008, 0x2010, 0x4118, 0x4110, 0x8120, 0xC169,
+  0xE3EB, 0xC3E3, 0xE128, 0xE128, 0xE128, 0x217A, 0xC1E3, 0xA1E3,
+  0xC1E3, 0xA130, 0x2008, 0x2008, 0x0008, 0x2008, 0x0000, 0x2B0A,
+  0x001B, 0x0000, 0x0000, 0x0000, 0x2000, 0x0008, 0x0008, 0x2008,
+  0x2010, 0x4110, 0x6120, 0x6118, 0x828A, 0xE3EB, 0x2139, 0x8120,
+  0x8118, 0x0172, 0xC1E3, 0xC1E3, 0xC1EB, 0x8292, 0x2008, 0x0008,
+  0x2008, 0x0000, 0x2000, 0x0000, 0x2C09, 0x001B, 0x0000, 0x0000,
+  0x0000, 0x2000, 0x0000, 0x2008, 0x0008, 0x2008, 0x2010, 0x2010,
+  0x4118, 0x6120, 0xA118, 0xA169, 0x6151, 0x8120, 0x6118, 0xC169,
+  0xC1EB, 0xC1E3, 0xA1E3, 0x61E3, 0x2008, 0x0000, 0x0008, 0x2000,
+  0x0000, 0x2D0B, 0x001A, 0x0000, 0x0000, 0x0000, 0x2000, 0x0008,
+  0x0008, 0x2008, 0x2010, 0x4110, 0x4118, 0x6120, 0x6118, 0x6120,
+  0x6118, 0x6118, 0x6120, 0xC1E3, 0xA1E3, 0xC1E3, 0xC1EB, 0x2139,
+  0x0008, 0x2000, 0x0000, 0x0000, 0x0000, 0x2E09, 0x001B, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x2000, 0x0000, 0x2008, 0x0008, 0x2008,
+  0x2008, 0x2010, 0x4118, 0x4118, 0x4118, 0x6120, 0x4110, 0x4118,
+  0x4118, 0x217A, 0xC1EB, 0xC1E3, 0xA1E3, 0x4151, 0x0000, 0x2000,
+  0x0000, 0x0000, 0x2F0A, 0x001B, 0x0000, 0x0000, 0x0000, 0x2000,
+  0x0000, 0x2000, 0x0008, 0x0008, 0x2008, 0x2010, 0x2010, 0x4118,
+  0x4110, 0x4118, 0x4118, 0x4118, 0x4110, 0x6118, 0x61DB, 0xC1E3,
+  0xC1EB, 0x4159, 0x2000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3009,
+  0x001B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2000, 0x0008,
+  0x2008, 0x0008, 0x2008, 0x2010, 0x2010, 0x2010, 0x2010, 0x4110,
+  0x4118, 0x4118, 0x2010, 0x2010, 0xC169, 0xC1EB, 0xC1E3, 0xA128,
+  0x0000, 0x2000, 0x0000, 0x0000, 0x3109, 0x001C, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x2000, 0x0000, 0x2000, 0x0008, 0x0008, 0x2008,
+  0x2010, 0x2010, 0x2010, 0x2010, 0x2010, 0x2010, 0x2010, 0x2010,
+  0x2010, 0x2008, 0xA2CB, 0xC1EB, 0x2010, 0x0008, 0x2000, 0x0000,
+  0x0000, 0x0000, 0x320A, 0x001B, 0x0000, 0x2000, 0x0000, 0x2000,
+  0x0000, 0x2008, 0x0008, 0x2008, 0x2008, 0x2008, 0x2010, 0x2010,
+  0x2010, 0x2010, 0x2010, 0x2010, 0x2010, 0x2010, 0x2010, 0x8292,
+  0x019B, 0x2000, 0x0000, 0x0000, 0x2000, 0x0000, 0x0000, 0x330B,
+  0x0019, 0x0000, 0x2000, 0x0000, 0x2000, 0x0008, 0x2008, 0x2008,
+  0x2008, 0x2008, 0x2010, 0x2010, 0x2010, 0x2010, 0x2010, 0x2010,
+  0x2010, 0x2010, 0x2008, 0x4151, 0x2149, 0x2008, 0x0008, 0x2000,
+  0x0000, 0x2000, 0x340A, 0x001B, 0x0000, 0x2000, 0x0008, 0x2008,
+  0x0000, 0x2008, 0x0008, 0x2008, 0x2008, 0x2010, 0x2010, 0x2010,
+  0x2010, 0x4118, 0x4118, 0x2010, 0x2010, 0x2010, 0x2010, 0xA118,
+  0x2008, 0x0008, 0x2008, 0x0000, 0x2000, 0x0000, 0x2000, 0x350B,
+  0x0019, 0x0000, 0x2000, 0x0000, 0x2008, 0x0008, 0x2008, 0x2008,
+  0x2010, 0x2010, 0x4118, 0x4118, 0x4110, 0x4118, 0x4118, 0x4118,
+  0x4110, 0x2010, 0x2010, 0x2010, 0x2008, 0x2008, 0x0008, 0x2008,
+  0x0000, 0x2008, 0x3608, 0x001E, 0x0000, 0x0000, 0x2000, 0x0000,
+  0x2000, 0x0008, 0x2008, 0x2008, 0x2008, 0x2010, 0x2010, 0x8128,
+  0x217A, 0x2118, 0x4110, 0x4118, 0x4118, 0x4118, 0x4110, 0x4118,
+  0x2010, 0x2010, 0x2008, 0x2008, 0x0008, 0x2008, 0x0008, 0x2000,
+  0x0000, 0x2000, 0x3708, 0x001C, 0x0000, 0x2000, 0x0000, 0x2000,
+  0x0008, 0x2008, 0x0008, 0x2008, 0x2010, 0x2010, 0x4110, 0x4151,
+  0x61EC, 0x217A, 0x4118, 0x4118, 0x4118, 0x2239, 0x4118, 0x4110,
+  0x4118, 0x2010, 0x2010, 0x2008, 0x2008, 0x0008, 0x2008, 0x0008,
+  0x3807, 0x001F, 0x0000, 0x0000, 0x2000, 0x0000, 0x2008, 0x0008,
+  0x2008, 0x2008, 0x2010, 0x2010, 0x4118, 0x4110, 0xC159, 0x61EC,
+  0x61EC, 0xA128, 0x6118, 0x6120, 0x8182, 0x8120, 0x4110, 0x4118,
+  0x4118, 0x2010, 0x2010, 0x2008, 0x0008, 0x0008, 0x2000, 0x0000,
+  0x2000, 0x3906, 0x0021, 0x0000, 0x0000, 0x0000, 0x2000, 0x0000,
+  0x2000, 0x0008, 0x2010, 0x2008, 0x2010, 0x4110, 0x4118, 0x4110,
+  0x0162, 0x61EC, 0x81EC, 0xA169, 0x6120, 0x8120, 0xE1A2, 0xE238,
+  0x6118, 0x6120, 0x4118, 0x4110, 0x2010, 0x2010, 0x2008, 0x2008,
+  0x0008, 0x2008, 0x0000, 0x2000, 0x3A07, 0x0020, 0x0000, 0x2000,
+  0x0000, 0x2008, 0x0008, 0x2008, 0x2008, 0x2010, 0x4118, 0x4118,
+  0x4110, 0x6120, 0x019B, 0xA1EC, 0xA1EC, 0x61AB, 0x6120, 0x6120,
+  0x81B3, 0x2141, 0x6120, 0x6118, 0x6120, 0x4110, 0x4118, 0x2010,
+  0x2008, 0x2008, 0x0008, 0x2008, 0x0000, 0x2000, 0x3B07, 0x0020,
+  0x0000, 0x2000, 0x0000, 0x2008, 0x0008, 0x2008, 0x2010, 0x2010,
+  0x4118, 0x4110, 0x6118, 0x6120, 0x21DC, 0xC1EC, 0xC1F4, 0xE1F4,
+  0x8149, 0x8120, 0x01CC, 0x6251, 0x8128, 0x8120, 0x6118, 0x6120,
+  0x4118, 0x2010, 0x2010, 0x2008, 0x0008, 0x2008, 0x0000, 0x2000,
+  0x3C06, 0x0021, 0x0000, 0x0000, 0x2000, 0x0000, 0x2008, 0x0008,
+  0x2008, 0x2010, 0x4110, 0x4118, 0x6120, 0x6118, 0x217A, 0xE1F4,
+  0xC1F4, 0xC1F4, 0xC1F4, 0x21DC, 0x0162, 0xA1E4, 0xA161, 0xA128,
+  0x6120, 0x8120, 0x6120, 0x4110, 0x4118, 0x2010, 0x2008, 0x2008,
+  0x0008, 0x0008, 0x2000, 0x3D07, 0x0021, 0x0000, 0x2000, 0x0008,
+  0x0008, 0x2008, 0x2008, 0x2010, 0x4110, 0x6120, 0x6118, 0xC128,
+  0x21DC, 0xC1F4, 0xC1EC, 0xC1F4, 0xC1EC, 0x02F5, 0xC1F4, 0xE1F4,
+  0x427A, 0xA128, 0xA128, 0x8128, 0x6118, 0x6120, 0x4118, 0x2010,
+  0x2010, 0x2008, 0x0008, 0x2000, 0x0000, 0x2000, 0x3E05, 0x0022,
+  0x0000, 0x2000, 0x0000, 0x2000, 0x0008, 0x2008, 0x2008, 0x2010,
+  0x4118, 0x4110, 0x6120, 0xA128, 0x02BC, 0xC1F4, 0x02F5, 0x02F5,
+  0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02ED, 0x2393, 0xA130, 0xA128,
+  0xA128, 0x8120, 0x6120, 0x4110, 0x4118, 0x2010, 0x2008, 0x0008,
+  0x0000, 0x2000, 0x3F05, 0x0023, 0x0000, 0x2000, 0x0000, 0x2000,
+  0x0000, 0x0008, 0x2008, 0x2010, 0x4118, 0x6118, 0x6118, 0x61AB,
+  0x02F5, 0x02ED, 0x01F5, 0x21F5, 0x01F5, 0x21F5, 0x01F5, 0x21F5,
+  0x21F5, 0x62D4, 0xE238, 0xC130, 0xA128, 0x8128, 0x8128, 0x6118,
+  0x4118, 0x2010, 0x2008, 0x2008, 0x2008, 0x0008, 0x2008, 0x4006,
+  0x0023, 0x0000, 0x2000, 0x0008, 0x2008, 0x2008, 0x2010, 0x2010,
+  0x4118, 0x6120, 0xE19A, 0x21F5, 0x21F5, 0x21F5, 0x01F5, 0x42F5,
+  0x42F5, 0x42F5, 0x42ED, 0x42F5, 0x42F5, 0x42F5, 0x6249, 0xC230,
+  0xC130, 0xA128, 0x6120, 0x6118, 0x4118, 0x4118, 0x2010, 0x2008,
+  0x0008, 0x2000, 0x0000, 0x2000, 0x4105, 0x0023, 0x0000, 0x0000,
+  0x2000, 0x0008, 0x0008, 0x2008, 0x2010, 0x4110, 0x4110, 0x817A,
+  0x01F5, 0x21ED, 0x01F5, 0x21F5, 0x42F5, 0x42ED, 0x62F5, 0x82F5,
+  0x62F5, 0x82F5, 0x82F5, 0x62F5, 0x239B, 0xE238, 0xC130, 0xA128,
+  0x8128, 0x8120, 0x6120, 0x4118, 0x2010, 0x2008, 0x2008, 0x0008,
+  0x2000, 0x4204, 0x0026, 0x0000, 0x0000, 0x2000, 0x0000, 0x2008,
+  0x0008, 0x2008, 0x2010, 0x4118, 0xA182, 0x21F5, 0x21F5, 0x42F5,
+  0x42F5, 0x42F5, 0x82F5, 0x62ED, 0x82F5, 0xA2F5, 0x62F5, 0x82F5,
+  0x62ED, 0x82F5, 0x02DD, 0x2241, 0xE230, 0xC130, 0x8128, 0x8120,
+  0x6118, 0x4118, 0x2010, 0x2008, 0x0008, 0x0008, 0x2000, 0x0000,
+  0x2000, 0x4304, 0x0025, 0x0000, 0x0000, 0x2000, 0x0000, 0x2008,
+  0x0008, 0x2008, 0x4110, 0x6141, 0x01ED, 0x21F5, 0x42F5, 0x42ED,
+  0x62F5, 0x82F5, 0x62F5, 0x82F5, 0xA3F5, 0x48F6, 0xA2F5, 0xA2F5,
+  0xA2F5, 0xA2F5, 0x82F5, 0x02C4, 0x0239, 0xE238, 0xA128, 0x8120,
+  0x6120, 0x4118, 0x4118, 0x2010, 0x2008, 0x2008, 0x0000, 0x2000,
+  0x4406, 0x0023, 0x0000, 0x2000, 0x0008, 0x2008, 0x2010, 0x4118,
+  0x21CC, 0x21F5, 0x42F5, 0x42F5, 0x82F5, 0x62F5, 0xA2F5, 0xA2F5,
+  0xA2F5, 0x05F6, 0x31FF, 0xC3F5, 0xC3F5, 0xC3F5, 0xA2F5, 0xA2F5,
+  0xA2F5, 0x6193, 0xE230, 0xC130, 0x8128, 0x8120, 0x6120, 0x4110,
+  0x2010, 0x2008, 0x0008, 0x0008, 0x2000, 0x4505, 0x0025, 0x0000,
+  0x2000, 0x0000, 0x0008, 0x2008, 0x2008, 0x0141, 0x42F5, 0x42ED,
+  0x42F5, 0x82F5, 0x62F5, 0xA2F5, 0xA2F5, 0xC2F5, 0xC3F5, 0xCDF6,
+  0x53FF, 0x48F6, 0xE3F5, 0xE3F5, 0xC3F5, 0xC3FD, 0xA2F5, 0x82F5,
+  0x418B, 0xC130, 0xA130, 0x8120, 0x6120, 0x4110, 0x2010, 0x2008,
+  0x0008, 0x2008, 0x0000, 0x2000, 0x4604, 0x0026, 0x0000, 0x2000,
+  0x0000, 0x2008, 0x0008, 0x2008, 0x2010, 0xA182, 0x62F5, 0x82F5,
+  0x62F5, 0x82F5, 0xA2F5, 0xA2F5, 0xC2F5, 0xE3F5, 0xE4F5, 0x53FF,
+  0x53FF, 0xCDF6, 0x03F6, 0xC3F5, 0xE3F5, 0xE2F5, 0xC2F5, 0xA2F5,
+  0xA2F5, 0x218B, 0xA128, 0x8128, 0x6118, 0x4118, 0x2010, 0x2008,
+  0x0008, 0x2000, 0x0000, 0x2000, 0x4703, 0x0025, 0x0000, 0x0000,
+  0x0000, 0x2000, 0x0008, 0x0000, 0x2010, 0x2008, 0x61AB, 0xA1F5,
+  0x81F5, 0x81F5, 0xA2F5, 0xA2F5, 0xC2F5, 0xE2F5, 0xE3F5, 0x89F6,
+  0x53F7, 0x33FF, 0x53FF, 0x04F6, 0x03F6, 0x03F6, 0x03F6, 0xE3FD,
+  0xC2F5, 0xC2F5, 0xA2F5, 0xA182, 0x8128, 0x8120, 0x4118, 0x2010,
+  0x2010, 0x2008, 0x0008, 0x4804, 0x0024, 0x0000, 0x2000, 0x0000,
+  0x2008, 0x0008, 0x2010, 0x4110, 0x02C4, 0xA1F5, 0xA1F5, 0xA2F5,
+  0xC2F5, 0xC2F5, 0xE2F5, 0xE2F5, 0x03F6, 0x31FF, 0x53F7, 0x33FF,
+  0x53FF, 0xC9F6, 0x43F6, 0x03F6, 0x03F6, 0xE3F5, 0xE2F5, 0xC2F5,
+  0xC2F5, 0xA2F5, 0x0162, 0x6120, 0x6118, 0x4118, 0x2010, 0x2008,
+  0x0008, 0x4904, 0x0026, 0x0000, 0x2000, 0x0000, 0x4008, 0x218B,
+  0xA1CC, 0x826A, 0xE2B3, 0x81F5, 0xA2F5, 0xC2F5, 0xC2F5, 0xE2F5,
+  0x02F6, 0xE3F5, 0x45F6, 0x33FF, 0x53FF, 0x33F7, 0x53FF, 0x31FF,
+  0x43F6, 0x43FE, 0x03F6, 0x03F6, 0x02F6, 0xE2F5, 0xC2F5, 0xC2F5,
+  0xE1DC, 0x8120, 0x6120, 0x4118, 0x2010, 0x2008, 0x2008, 0x0000,
+  0x2000, 0x4A03, 0x0026, 0x0000, 0x2000, 0x0000, 0x2000, 0x2193,
+  0xA1F5, 0xA1F5, 0xA1CC, 0x218B, 0xC2F5, 0xC2F5, 0xC2F5, 0xE2F5,
+  0xE2F5, 0x02F6, 0x23F6, 0xA9FE, 0x33FF, 0x53F7, 0x33FF, 0x53FF,
+  0x33FF, 0x85F6, 0x64F6, 0x43F6, 0x03F6, 0x02F6, 0xE2F5, 0xE2F5,
+  0xC2F5, 0xC2F5, 0x2141, 0x4118, 0x4118, 0x2010, 0x2008, 0x0008,
+  0x2000, 0x4B03, 0x0028, 0x0000, 0x0000, 0x0000, 0x0000, 0xE1D4,
+  0x81F5, 0xA1F5, 0xA1CC, 0xA151, 0xC2F5, 0xC2F5, 0xE2F5, 0xE2F5,
+  0x02F6, 0x23F6, 0x03F6, 0xEDF6, 0x33FF, 0x53FF, 0x74FF, 0x74F7,
+  0x74FF, 0xA7FE, 0x63F6, 0x64F6, 0x43FE, 0x23F6, 0x02F6, 0x02F6,
+  0xE2F5, 0xE2FD, 0xC151, 0x6120, 0x4118, 0x2010, 0x2008, 0x0008,
+  0x2000, 0x0000, 0x2000, 0x4C05, 0x0026, 0x0000, 0x2000, 0x81ED,
+  0xA1F5, 0xA1F5, 0x8193, 0x6120, 0x42E5, 0xE2F5, 0x02F6, 0x02F6,
+  0x02F6, 0x23F6, 0x43F6, 0xEDFE, 0x33FF, 0x74FF, 0x74FF, 0x74F7,
+  0x74FF, 0xC9F6, 0x84F6, 0x64F6, 0x43FE, 0x03F6, 0x23F6, 0x02F6,
+  0xE2F5, 0xE2F5, 0x0239, 0x4118, 0x4118, 0x2010, 0x2008, 0x0008,
+  0x2000, 0x0000, 0x2000, 0x4D04, 0x0026, 0x2000, 0x0000, 0x0000,
+  0x81ED, 0xC2FD, 0x218B, 0xA128, 0x4118, 0x218B, 0xE2F5, 0xE2F5,
+  0x02F6, 0x23F6, 0x43F6, 0x44F6, 0x4EF7, 0x53FF, 0x74FF, 0x74F7,
+  0x94FF, 0x74FF, 0x09FF, 0x84F6, 0x84FE, 0x64F6, 0x43F6, 0x23FE,
+  0x02F6, 0x02F6, 0x42E5, 0xA128, 0x6120, 0x4118, 0x2010, 0x2010,
+  0x2008, 0x0000, 0x2000, 0x4E03, 0x0027, 0x0000, 0x0000, 0x2000,
+  0x0000, 0xC1CC, 0x8193, 0x2008, 0x4118, 0x6120, 0xC130, 0x63D5,
+  0x02F6, 0x42F6, 0x43F6, 0x43F6, 0x64FE, 0xCDF6, 0x74FF, 0x74FF,
+  0x94FF, 0xB4FF, 0x94FF, 0x29F7, 0xA4F6, 0x84F6, 0x64F6, 0x44FE,
+  0x43F6, 0x23F6, 0x02F6, 0x619B, 0x8120, 0x6118, 0x4118, 0x2010,
+  0x2010, 0x0008, 0x0000, 0x2000, 0x4F04, 0x0027, 0x0000, 0x2000,
+  0x0000, 0x819B, 0x8182, 0x2010, 0x4118, 0x6118, 0x8128, 0x2241,
+  0x63CD, 0x22F6, 0x43F6, 0x44F6, 0x83F6, 0xA7F6, 0x31FF, 0x74F7,
+  0xB4FF, 0x94FF, 0xB4FF, 0x09FF, 0xC4F6, 0xA4FE, 0x63F6, 0x64F6,
+  0x43FE, 0x42F6, 0x42FE, 0x8149, 0xA128, 0x6118, 0x4118, 0x2010,
+  0x2010, 0x0008, 0x2000, 0x0000, 0x2000, 0x5003, 0x0028, 0x0000,
+  0x2000, 0x0000, 0x2000, 0x8149, 0x819B, 0x2010, 0x4110, 0x6120,
+  0xA128, 0xC130, 0x2362, 0x42FE, 0x43F6, 0x83FE, 0x84F6, 0xA4F6,
+  0xE5FE, 0x74FF, 0x94FF, 0x94FF, 0xB4F7, 0x26FF, 0xC5F6, 0xA4F6,
+  0x84F6, 0x83FE, 0x43F6, 0x43F6, 0xA2BC, 0xA130, 0x8128, 0x6118,
+  0x4118, 0x2010, 0x2008, 0x0008, 0x2000, 0x0000, 0x2000, 0x5102,
+  0x0028, 0x0000, 0x0000, 0x2000, 0x0000, 0x0000, 0x2008, 0x43B4,
+  0x2010, 0x4118, 0x6118, 0xA128, 0xA130, 0x0239, 0x43CD, 0x64F6,
+  0x63F6, 0xA4FE, 0xC4F6, 0xE5F6, 0x4CFF, 0x94FF, 0xD4FF, 0xB0FF,
+  0x05F7, 0xC5FE, 0xC4F6, 0x84F6, 0x83FE, 0x83F6, 0x43FE, 0x2383,
+  0xC130, 0xA128, 0x6120, 0x4118, 0x2010, 0x2008, 0x2008, 0x0008,
+  0x2000, 0x5203, 0x0028, 0x0000, 0x0000, 0x2000, 0x0000, 0x2008,
+  0x216A, 0xE128, 0x4110, 0x6120, 0x8128, 0xC130, 0x0239, 0xC39B,
+  0xA3FE, 0x84FE, 0xA4F6, 0xC4FE, 0x05F7, 0x6AFF, 0x94FF, 0xB4FF,
+  0xAFFF, 0x26F7, 0x05F7, 0xC4FE, 0xA4F6, 0x84F6, 0x63F6, 0x42F6,
+  0x8349, 0xC130, 0x8128, 0x6118, 0x4110, 0x2010, 0x2008, 0x0008,
+  0x2008, 0x0000, 0x2000, 0x5302, 0x0028, 0x0000, 0x0000, 0x2000,
+  0x0000, 0x2008, 0x0000, 0x2010, 0x8149, 0x4118, 0x6120, 0xA128,
+  0xE230, 0x0239, 0xA372, 0x63FE, 0xA4F6, 0xA4F6, 0xE5FE, 0x05F7,
+  0x29F7, 0x94FF, 0x94FF, 0x8DFF, 0x26FF, 0x05F7, 0xE5FE, 0xC4F6,
+  0xA4FE, 0x83FE, 0x22E6, 0x0239, 0xE238, 0x8128, 0x8120, 0x4118,
+  0x4118, 0x2008, 0x2008, 0x0000, 0x2000, 0x5404, 0x0027, 0x0000,
+  0x2000, 0x0000, 0x2008, 0x2008, 0x6120, 0x4110, 0x8128, 0xA128,
+  0xE238, 0x4241, 0x2362, 0xC4FE, 0xA4FE, 0xC4FE, 0xE5F6, 0x05FF,
+  0x48FF, 0x94FF, 0x94F7, 0xAFFF, 0x26F7, 0x05FF, 0xE5F6, 0xC4FE,
+  0xA4F6, 0xA4F6, 0x43CD, 0x2241, 0xC230, 0xA128, 0x6120, 0x4118,
+  0x2010, 0x2010, 0x0008, 0x2000, 0x0000, 0x2000, 0x5503, 0x0027,
+  0x0000, 0x0000, 0x2000, 0x0008, 0x0008, 0x2008, 0x2010, 0x4110,
+  0x8120, 0xA130, 0xE230, 0x2241, 0x0362, 0xA4F6, 0xC4F6, 0xE5FE,
+  0xE5F6, 0x05FF, 0x48F7, 0x94FF, 0x94FF, 0xB0FF, 0x26F7, 0x05FF,
+  0x05F7, 0xE5FE, 0xA4F6, 0xA4FE, 0xC2C4, 0x4241, 0xE238, 0xA130,
+  0x8120, 0x6120, 0x2010, 0x2008, 0x2008, 0x0000, 0x2000, 0x5604,
+  0x0026, 0x2000, 0x0000, 0x2000, 0x0008, 0x2010, 0x4118, 0x6120,
+  0x8120, 0x819B, 0x43AC, 0x4241, 0x8272, 0xC3FE, 0xE4FE, 0xE5FE,
+  0x05F7, 0x06FF, 0x48F7, 0x94FF, 0xB4FF, 0x94FF, 0x27F7, 0x26FF,
+  0x05F7, 0xC5FE, 0xC4F6, 0xC3F6, 0x43AC, 0x2241, 0x0239, 0xA128,
+  0x8120, 0x6120, 0x2010, 0x2008, 0x0008, 0x0000, 0x2000, 0x5703,
+  0x0028, 0x0000, 0x0000, 0x2000, 0x0008, 0x2008, 0x2010, 0x4110,
+  0x6118, 0x6141, 0x82F6, 0x82F6, 0x2362, 0x23AC, 0xC4F6, 0xE5FE,
+  0x05F7, 0x06FF, 0x26F7, 0x69FF, 0x94FF, 0xB4F7, 0x94FF, 0x4AFF,
+  0x26FF, 0x06F7, 0x05FF, 0xE5F6, 0xE4FE, 0xC2C4, 0x4249, 0x0239,
+  0xC130, 0xA128, 0x6120, 0x4118, 0x2008, 0x0008, 0x2000, 0x0000,
+  0x2000, 0x5805, 0x0023, 0x0000, 0x2008, 0x2008, 0x2010, 0x4118,
+  0x8118, 0x6252, 0xC2FE, 0xC2FE, 0xC4FE, 0xC4F6, 0xE5FE, 0x05F7,
+  0x05FF, 0x06F7, 0x26FF, 0x8DFF, 0x95FF, 0x95F7, 0xB5FF, 0xB2FF,
+  0x26F7, 0x26FF, 0x05F7, 0x05F7, 0xC5FE, 0x03B5, 0x8341, 0x0239,
+  0xC130, 0x8128, 0x8118, 0x4118, 0x2010, 0x2008, 0x5903, 0x0027,
+  0x0000, 0x0000, 0x0000, 0x2000, 0x4008, 0x2010, 0x8010, 0x8118,
+  0xC120, 0x43CD, 0xC3FE, 0xC4F6, 0xE4FE, 0x05F7, 0x05FF, 0x26F7,
+  0x27FF, 0x49F7, 0xB5FF, 0x95FF, 0xB5F7, 0x95FF, 0x95FF, 0x4CFF,
+  0x26F7, 0x26FF, 0x05FF, 0x04FF, 0x03D6, 0x8349, 0x4241, 0xE238,
+  0xE128, 0xA120, 0x4118, 0x2010, 0x2008, 0x0008, 0x2000, 0x5A02,
+  0x0027, 0x0000, 0x0000, 0x0000, 0x2008, 0x2000, 0x4008, 0x4008,
+  0xA018, 0xC120, 0xE128, 0xC3A3, 0xE3FE, 0x04FF, 0x05F7, 0x05F7,
+  0x26FF, 0x07FF, 0x48F7, 0xB4FF, 0x95FF, 0xB5FF, 0x95FF, 0xB5F7,
+  0x95FF, 0xB4FF, 0x48F7, 0x07FF, 0x26F7, 0x05FF, 0xC5EE, 0xA251,
+  0x2241, 0x0131, 0xE128, 0x8120, 0x6118, 0x2010, 0x2008, 0x2008,
+  0x5B03, 0x0026, 0x0000, 0x0000, 0x2008, 0x4008, 0x4008, 0x8010,
+  0x8118, 0xC118, 0xC128, 0x6383, 0x04FF, 0x05FF, 0x05F7, 0x26F7,
+  0x07FF, 0x48F7, 0xD2FF, 0x95FF, 0x96FF, 0xB6FF, 0xB5FF, 0xB6FF,
+  0xB6FF, 0x95FF, 0xAFFF, 0x07F7, 0x26FF, 0x26FF, 0x25FF, 0x2383,
+  0x8349, 0x2139, 0xE128, 0xC118, 0x8120, 0x4118, 0x4008, 0x0000,
+  0x5C02, 0x0028, 0x0000, 0x0000, 0x2000, 0x2000, 0x4008, 0x4008,
+  0x8010, 0x8120, 0xE128, 0x2231, 0xC4A4, 0x04FF, 0x05FF, 0x26F7,
+  0x07FF, 0x47FF, 0xB0FF, 0xB6FF, 0xB6FF, 0x96FF, 0xD6FF, 0xB6FF,
+  0xD6FF, 0x96FF, 0xB6FF, 0x95F7, 0x4AFF, 0x47FF, 0x26F7, 0x26FF,
+  0xE3B4, 0x8341, 0x6231, 0x2229, 0xC120, 0x8118, 0x8010, 0x4008,
+  0x2008, 0x2000, 0x5D02, 0x0028, 0x0000, 0x0000, 0x2000, 0x2000,
+  0x2008, 0x8010, 0xA018, 0xC118, 0xC128, 0x0229, 0x03D6, 0x05F7,
+  0x06F7, 0x46FF, 0x47FF, 0xAFF7, 0xD5FF, 0xB6FF, 0xB6FF, 0xB6FF,
+  0xD6FF, 0xB7FF, 0xD6FF, 0xB6FF, 0xD6FF, 0xB6FF, 0xB2FF, 0x48FF,
+  0x47FF, 0x26FF, 0x05FF, 0x4452, 0x6239, 0x2229, 0xE128, 0x8120,
+  0x8010, 0x4008, 0x4008, 0x2008, 0x5E01, 0x0028, 0x0000, 0x0000,
+  0x0000, 0x2008, 0x4008, 0x4008, 0x8010, 0xA018, 0xC120, 0x2229,
+  0xE349, 0x24F7, 0x45FF, 0x46FF, 0x47FF, 0x6CFF, 0xD5FF, 0xB6FF,
+  0xD6FF, 0xB7FF, 0xD7FF, 0xB7FF, 0xD7FF, 0xB7FF, 0xB7FF, 0xD7FF,
+  0xB6FF, 0xB6FF, 0x4AFF, 0x47FF, 0x46F7, 0x45FF, 0x2394, 0x8239,
+  0x2229, 0xE120, 0xC120, 0xA018, 0x4008, 0x4008, 0x5F01, 0x002A,
+  0x0000, 0x2000, 0x0000, 0x2000, 0x4008, 0x4008, 0x8010, 0x8120,
+  0xE120, 0x2229, 0x2394, 0x25F7, 0x45FF, 0x46FF, 0x48F7, 0x94FF,
+  0xD6FF, 0xB6FF, 0xD7FF, 0xD7FF, 0xD7FF, 0xD8FF, 0xD7F7, 0xD7FF,
+  0xD7FF, 0xB7FF, 0xD6FF, 0xD6FF, 0x8DFF, 0x48FF, 0x47FF, 0x46FF,
+  0x05F7, 0x245A, 0x6231, 0x0129, 0xC120, 0xA018, 0x8010, 0x4008,
+  0x2000, 0x2008, 0x6000, 0x002B, 0x0000, 0x0000, 0x0000, 0x2000,
+  0x2008, 0x4008, 0x8010, 0xA018, 0xC120, 0x0121, 0x2231, 0xA3E6,
+  0x45FF, 0x46FF, 0x47FF, 0xAFFF, 0xD6FF, 0xB6FF, 0xD7FF, 0xD7FF,
+  0xD8FF, 0xD8FF, 0xD8FF, 0xD8FF, 0xD8FF, 0xD8FF, 0xD8FF, 0xB7FF,
+  0xD6FF, 0x4AF7, 0x49FF, 0x48FF, 0x46FF, 0x45F7, 0x45B5, 0x6231,
+  0x2229, 0xC118, 0x8018, 0x8010, 0x4008, 0x4008, 0x2000, 0x6101,
+  0x002A, 0x0000, 0x0000, 0x2000, 0x4008, 0x4008, 0x6010, 0xA018,
+  0xC120, 0xE120, 0x0363, 0x44F7, 0x65FF, 0x66F7, 0x89F7, 0xD5FF,
+  0xB6FF, 0xD7FF, 0xD7FF, 0xD8FF, 0xD8FF, 0xF9FF, 0xD9FF, 0xF9FF,
+  0xD9FF, 0xD8FF, 0xD8FF, 0xD8FF, 0xB4FF, 0xABFF, 0x89FF, 0x88FF,
+  0x47FF, 0x46FF, 0x45FF, 0x6252, 0x2231, 0x0121, 0xA018, 0x8010,
+  0x4008, 0x4008, 0x2008, 0x6200, 0x002B, 0x0000, 0x0000, 0x2000,
+  0x2000, 0x4008, 0x4008, 0x8010, 0xA018, 0xC120, 0x2231, 0x03B5,
+  0x45FF, 0x86FF, 0x87FF, 0xAFFF, 0xD6FF, 0xB7FF, 0xD7FF, 0xD8FF,
+  0xD8FF, 0xD9FF, 0xFAFF, 0xDAFF, 0xFAFF, 0xDAFF, 0xF9FF, 0xD9FF,
+  0xD8FF, 0xD5FF, 0x8CFF, 0x8AFF, 0x89FF, 0x88F7, 0x86FF, 0x65FF,
+  0xA49C, 0x2229, 0xE120, 0xC120, 0x8010, 0x4008, 0x4008, 0x2000,
+  0x6301, 0x002C, 0x0000, 0x0000, 0x2000, 0x4008, 0x4008, 0x8010,
+  0x8010, 0xC118, 0x2229, 0x04F7, 0x65F7, 0x66FF, 0x88FF, 0xD4FF,
+  0xB6FF, 0xD7FF, 0xD8FF, 0xD8FF, 0xF9FF, 0xDAFF, 0xFBFF, 0xDBFF,
+  0xFBFF, 0xDBFF, 0xFAFF, 0xDAFF, 0xF9FF, 0xD8FF, 0x8DF7, 0x8BFF,
+  0xAAFF, 0x88FF, 0x87FF, 0x86FF, 0xC5EE, 0x6231, 0x0129, 0xC120,
+  0xA018, 0x4008, 0x4008, 0x2000, 0x0000, 0x2000, 0x6401, 0x002B,
+  0x0000, 0x0000, 0x2008, 0x4008, 0x4008, 0x8010, 0xA018, 0x0129,
+  0x6252, 0x85FF, 0x86FF, 0x66F7, 0x8CFF, 0xD6FF, 0xB7FF, 0xD7FF,
+  0xD8FF, 0xF9FF, 0xDAFF, 0xFBFF, 0xFCFF, 0xDCFF, 0xFCFF, 0xDCFF,
+  0xDBFF, 0xFAFF, 0xD9FF, 0xF8FF, 0xB2FF, 0x8CFF, 0xAAFF, 0x89FF,
+  0x88F7, 0x66FF, 0x65FF, 0x624A, 0xE120, 0xC118, 0xA018, 0x8010,
+  0x2008, 0x2000, 0x2000, 0x6501, 0x002C, 0x0000, 0x0000, 0x2000,
+  0x4008, 0x4008, 0x6010, 0xC120, 0x0121, 0x646B, 0x65FF, 0x66FF,
+  0x88F7, 0xB0FF, 0xD6FF, 0xD7FF, 0xD8FF, 0xD8FF, 0xD9FF, 0xDAFF,
+  0xFCFF, 0xFDFF, 0xFDFF, 0xFEFF, 0xFDFF, 0xFCFF, 0xDBFF, 0xFAFF,
+  0xD9FF, 0xD7FF, 0x8DFF, 0xABFF, 0x89FF, 0x88FF, 0x87FF, 0x85FF,
+  0xC483, 0x0121, 0xC120, 0xA018, 0x8010, 0x4008, 0x4008, 0x2008,
+  0x2000, 0x6601, 0x002B, 0x0000, 0x2000, 0x2000, 0x4008, 0x4008,
+  0x8010, 0xA018, 0x0129, 0x439C, 0x86FF, 0x66FF, 0x88FF, 0xB0FF,
+  0xD6FF, 0xD7FF, 0xD8FF, 0xD8FF, 0xDAFF, 0xFBFF, 0xFCFF, 0xFDFF,
+  0xFEFF, 0xFEFF, 0xFEFF, 0xFDFF, 0xDBFF, 0xDAFF, 0xF9FF, 0xD8FF,
+  0xD4FF, 0x8BF7, 0xAAFF, 0x89FF, 0x87F7, 0x66FF, 0x45B5, 0x0121,
+  0xC118, 0xA010, 0x6010, 0x4008, 0x4008, 0x2000, 0x6701, 0x002C,
+  0x0000, 0x0000, 0x2000, 0x2000, 0x8010, 0x6010, 0xC118, 0xE120,
+  0xC4A4, 0x66FF, 0x87F7, 0x88FF, 0xB0FF, 0xD6FF, 0xD7F7, 0xD8FF,
+  0xD9FF, 0xFAFF, 0xDBFF, 0xFDFF, 0xFEFF, 0xFEFF, 0xFEFF, 0xFEFF,
+  0xFDFF, 0xFBFF, 0xDAFF, 0xF9FF, 0xD8FF, 0xD7FF, 0xAFFF, 0xAAFF,
+  0x89FF, 0x88FF, 0x86FF, 0x45E6, 0x0121, 0xC120, 0xA018, 0x8010,
+  0x4008, 0x4008, 0x2008, 0x2000, 0x6801, 0x002B, 0x0000, 0x2000,
+  0x2008, 0x4008, 0x6010, 0x8010, 0xC120, 0x0121, 0xC4A4, 0x86FF,
+  0x87FF, 0x88FF, 0xAFFF, 0xD6FF, 0xD7FF, 0xD8FF, 0xD9FF, 0xDAFF,
+  0xFBFF, 0xFCFF, 0xFDFF, 0xFEFF, 0xFEFF, 0xFEFF, 0xFDFF, 0xDBFF,
+  0xDAFF, 0xF9FF, 0xD8FF, 0xD7FF, 0xD6FF, 0x8BFF, 0x89FF, 0x88F7,
+  0x87FF, 0x25EF, 0xE120, 0xC118, 0xA018, 0x8010, 0x4008, 0x4008,
+  0x2000, 0x6903, 0x0029, 0x2000, 0x4008, 0x4008, 0x8010, 0xA010,
+  0xE120, 0xA4A4, 0x87FF, 0x88F7, 0x89FF, 0xACFF, 0xD7FF, 0xD7F7,
+  0xD8FF, 0xF9FF, 0xD9FF, 0xDBFF, 0xFCFF, 0xFDFF, 0xFDFF, 0xFDFF,
+  0xFDFF, 0xFCFF, 0xDBFF, 0xFAFF, 0xD9FF, 0xD8FF, 0xD7FF, 0xF7FF,
+  0xB0FF, 0x89FF, 0x88FF, 0x87FF, 0x86FF, 0x2231, 0xC120, 0xA018,
+  0x8010, 0x6008, 0x2008, 0x2000, 0x6A01, 0x002B, 0x0000, 0x0000,
+  0x2008, 0x4008, 0x4008, 0x8010, 0xA018, 0xC120, 0xC4A4, 0x87FF,
+  0xA7FF, 0xA8FF, 0xAAFF, 0xD6FF, 0xD7FF, 0xD8FF, 0xD8FF, 0xD9FF,
+  0xDAFF, 0xFBFF, 0xFCFF, 0xDCFF, 0xFDFF, 0xFCFF, 0xDBFF, 0xDAFF,
+  0xFAFF, 0xD9FF, 0xD8FF, 0xD7FF, 0xD7FF, 0xD6FF, 0x8AF7, 0x88FF,
+  0x87FF, 0x87F7, 0x8239, 0xC118, 0x8018, 0x8010, 0x4008, 0x2000,
+  0x2000, 0x6B02, 0x002B, 0x0000, 0x2000, 0x4008, 0x4008, 0x8010,
+  0x8018, 0xC118, 0xC47B, 0x87F7, 0x88FF, 0xA8FF, 0x8AF7, 0xD4FF,
+  0xD7FF, 0xD8FF, 0xF8FF, 0xD9FF, 0xFAFF, 0xDAFF, 0xFBFF, 0xDBFF,
+  0xFBFF, 0xDBFF, 0xFBFF, 0xDAFF, 0xF9FF, 0xD9FF, 0xD8FF, 0xD7FF,
+  0xF7FF, 0xD6FF, 0xCDFF, 0xA8FF, 0xA7FF, 0xA7FF, 0x8241, 0xA018,
+  0x8010, 0x4008, 0x4008, 0x2000, 0x2008, 0x2000, 0x6C02, 0x0001,
+  0x0000, 0x6C09, 0x0022, 0x236B, 0xA7FF, 0xA8FF, 0xA8FF, 0x8AFF,
+  0xB0FF, 0xF7FF, 0xD7F7, 0xD8FF, 0xD8FF, 0xF9FF, 0xDAFF, 0xFAFF,
+  0xD6FF, 0xB6FF, 0xDAFF, 0xFAFF, 0xD9FF, 0xF9FF, 0xD8FF, 0xD8FF,
+  0xD7FF, 0xF6FF, 0xD6FF, 0xCDFF, 0xA8FF, 0xA7F7, 0x87FF, 0x8231,
+  0x8010, 0x8010, 0x4008, 0x4008, 0x2000, 0x6D02, 0x0029, 0x0000,
+  0x2000, 0x2000, 0x4008, 0x6010, 0xA018, 0xC118, 0xC239, 0xA7F7,
+  0xA8FF, 0xA8FF, 0xAAFF, 0xADF7, 0xF7FF, 0xD7FF, 0xF8FF, 0xD8FF,
+  0xF9FF, 0xD9FF, 0xD4FF, 0xB2F7, 0xB2FF, 0xD4FF, 0xF9FF, 0xD9FF,
+  0xF8FF, 0xD8FF, 0xF7FF, 0xD7FF, 0xF6FF, 0xD6FF, 0xCCFF, 0xA8FF,
+  0xA8FF, 0xC7FF, 0x2231, 0xA018, 0x8010, 0x4008, 0x4008, 0x2008,
+  0x6E02, 0x0029, 0x2000, 0x2008, 0x2000, 0x4008, 0x4008, 0x8010,
+  0xA018, 0xC120, 0x07EF, 0xA8FF, 0xA8FF, 0xAAFF, 0x8AFF, 0xD4FF,
+  0xD7FF, 0xF7FF, 0xD8FF, 0xF8FF, 0xD6FF, 0xB0F7, 0xB0FF, 0xB0FF,
+  0xB0FF, 0xD4F7, 0xD8FF, 0xF8FF, 0xD8FF, 0xF7FF, 0xD7FF, 0xF6FF,
+  0xD6FF, 0xAAFF, 0xA8FF, 0xA8F7, 0x87F7, 0xA118, 0x6008, 0x6010,
+  0x4008, 0x4008, 0x2000, 0x6F07, 0x0024, 0x6010, 0xA018, 0xA118,
+  0xA49C, 0xA8FF, 0xA8FF, 0xC9F7, 0xAAFF, 0xADFF, 0xF7FF, 0xD7FF,
+  0xD7F7, 0xF8FF, 0xB0FF, 0xAFFF, 0xAFFF, 0x49AD, 0x4EF7, 0xAFFF,
+  0xD7FF, 0xF8FF, 0xD7FF, 0xF7FF, 0xD6FF, 0xD6FF, 0xB0FF, 0xC9FF,
+  0xA8FF, 0xC8FF, 0x07EF, 0xA018, 0x8010, 0x4008, 0x4008, 0x2000,
+  0x2008, 0x7004, 0x0026, 0x2000, 0x2008, 0x4008, 0x6010, 0x8010,
+  0xA018, 0xE349, 0xC8FF, 0xC9FF, 0xC9FF, 0xCAFF, 0xCBFF, 0xB4FF,
+  0xD7FF, 0xF7F7, 0xD4FF, 0xADFF, 0xADFF, 0x2BE7, 0x076B, 0x49AD,
+  0xCDFF, 0xD2FF, 0xD7FF, 0xF7FF, 0xD7FF, 0xF6FF, 0xD6FF, 0xCBF7,
+  0xC9FF, 0xA8FF, 0xA8FF, 0x26C6, 0x8010, 0x6008, 0x4008, 0x4008,
+  0x2000, 0x7108, 0x0022, 0x8010, 0x8010, 0xA118, 0x26C6, 0xA9FF,
+  0xC9FF, 0xCAF7, 0xCBFF, 0xCDFF, 0xD7FF, 0xF7FF, 0xADFF, 0xCDFF,
+  0xCDFF, 0x69AD, 0x0773, 0x076B, 0x8DF7, 0xADFF, 0xF7FF, 0xD7FF,
+  0xF7FF, 0xD6FF, 0xB0FF, 0xA9FF, 0xC9FF, 0xA8FF, 0xC8FF, 0x6594,
+  0x8010, 0x4008, 0x4008, 0x2000, 0x2008, 0x7204, 0x0025, 0x0000,
+  0x2008, 0x2000, 0x4008, 0x8010, 0x6010, 0xA018, 0xA362, 0xC9FF,
+  0xC9FF, 0xCAFF, 0xCAFF, 0xCBFF, 0xD2FF, 0xD4FF, 0xACF7, 0xACFF,
+  0xCCFF, 0x458C, 0x8462, 0x8462, 0xCBE6, 0xCCFF, 0xD4FF, 0xD7FF,
+  0xD6FF, 0xF6FF, 0xCBFF, 0xCAF7, 0xC9FF, 0xA9FF, 0x88F7, 0x6231,
+  0x6008, 0x4008, 0x4008, 0x2000, 0x7305, 0x0025, 0x2000, 0x2000,
+  0x4008, 0x4008, 0x8010, 0xA010, 0x8010, 0xA4A4, 0xC9F7, 0xCAFF,
+  0xCAFF, 0xCBFF, 0xCBFF, 0xADFF, 0xCBFF, 0xCCFF, 0xCCFF, 0x8462,
+  0x2452, 0x2452, 0x49AD, 0xCBFF, 0xB2FF, 0xF6FF, 0xD6FF, 0xCDFF,
+  0xCAFF, 0xCAFF, 0xC9FF, 0xC9FF, 0xC483, 0x8010, 0x4008, 0x4008,
+  0x2008, 0x2000, 0x2000, 0x7405, 0x0023, 0x0000, 0x2008, 0x2000,
+  0x4008, 0x4008, 0x8010, 0xA018, 0xC120, 0x847B, 0x6AF7, 0xCAFF,
+  0xCBFF, 0xCBFF, 0xCBFF, 0xCBF7, 0xCBFF, 0x2BE7, 0xE341, 0xE349,
+  0xE239, 0x6594, 0xCBFF, 0xCCFF, 0xB2FF, 0xCDFF, 0xCBFF, 0xCAFF,
+  0xCAFF, 0xC9FF, 0xA49C, 0x6008, 0x4008, 0x4008, 0x4008, 0x2000,
+  0x7507, 0x0022, 0x2000, 0x4008, 0x4008, 0x4008, 0x8010, 0xA018,
+  0xA010, 0x6231, 0xC47B, 0xC8DE, 0xCBFF, 0xCBFF, 0xCBFF, 0xCBFF,
+  0x69B5, 0xA239, 0x8239, 0x8239, 0x0363, 0xCBF7, 0xCBFF, 0xCBFF,
+  0xCBFF, 0xCAFF, 0xCAFF, 0x6AF7, 0x847B, 0x6010, 0x8010, 0x4008,
+  0x4008, 0x2000, 0x2008, 0x2000, 0x7606, 0x0021, 0x2000, 0x2008,
+  0x2000, 0x4008, 0x4008, 0x4010, 0x8010, 0xA018, 0xA018, 0xC118,
+  0xC120, 0x6252, 0xC4A4, 0x2BEF, 0xCBFF, 0x6473, 0x2229, 0x6231,
+  0x2229, 0x6239, 0x26CE, 0xCBFF, 0xCAFF, 0xCAFF, 0x6AEF, 0x4594,
+  0xE120, 0x8008, 0x6010, 0x4008, 0x4008, 0x2000, 0x2008, 0x7709,
+  0x001E, 0x2000, 0x4008, 0x6008, 0x4008, 0x6010, 0x8010, 0xA018,
+  0xA018, 0xC120, 0xC118, 0x0129, 0x6252, 0x2229, 0x0129, 0x0121,
+  0x0129, 0x0121, 0x0121, 0xE349, 0xA362, 0xE241, 0xC120, 0x8010,
+  0x6010, 0x8010, 0x4008, 0x4008, 0x2008, 0x2000, 0x2000, 0x7807,
+  0x001E, 0x2000, 0x0000, 0x2000, 0x2008, 0x4008, 0x4008, 0x4008,
+  0x8010, 0x6010, 0x8010, 0xA018, 0xA018, 0xA010, 0xC120, 0xC120,
+  0xC120, 0xC118, 0xC120, 0xC120, 0xC120, 0xA010, 0xA018, 0xA018,
+  0x6010, 0x8010, 0x4008, 0x4008, 0x4008, 0x2000, 0x2008, 0x7909,
+  0x001D, 0x2000, 0x0000, 0x2008, 0x2000, 0x4008, 0x4008, 0x4008,
+  0x8010, 0x6010, 0x8010, 0xA018, 0xA018, 0xA010, 0xA018, 0xA018,
+  0xA018, 0xA010, 0xA018, 0x6010, 0x8010, 0x6010, 0x8010, 0x4008,
+  0x4008, 0x4008, 0x2008, 0x2000, 0x0000, 0x2000, 0x7A0B, 0x0018,
+  0x2000, 0x2000, 0x2008, 0x4008, 0x2008, 0x4008, 0x6008, 0x8010,
+  0x6010, 0x8010, 0x6010, 0x8010, 0x6010, 0x8010, 0x6010, 0x8010,
+  0x6010, 0x4008, 0x6008, 0x4008, 0x2008, 0x2000, 0x2008, 0x2000,
+  0x7B0C, 0x0017, 0x2008, 0x2000, 0x2000, 0x4008, 0x2008, 0x4008,
+  0x6008, 0x4010, 0x6008, 0x4008, 0x6008, 0x4010, 0x6008, 0x4008,
+  0x6008, 0x4008, 0x2008, 0x4008, 0x4008, 0x2000, 0x2008, 0x0000,
+  0x2000, 0x7C0E, 0x0014, 0x2000, 0x2008, 0x2000, 0x2008, 0x4008,
+  0x4008, 0x2000, 0x4008, 0x2008, 0x4008, 0x2000, 0x4008, 0x2008,
+  0x4008, 0x2000, 0x2000, 0x2008, 0x0000, 0x0000, 0x2000, 0x7D0E,
+  0x0010, 0x2000, 0x0000, 0x2000, 0x2008, 0x2000, 0x2008, 0x2000,
+  0x2008, 0x2000, 0x2008, 0x2000, 0x2008, 0x2000, 0x2008, 0x2000,
+  0x2000, 0x7E13, 0x0009, 0x2000, 0x0000, 0x2000, 0x0000, 0x2000,
+  0x0000, 0x2000, 0x0000, 0x2000, 0x7F14, 0x0007, 0x2000, 0x0000,
+  0x2000, 0x0000, 0x2000, 0x0000, 0x2000, 0x0816, 0x0005, 0x2000,
+  0x2010, 0xA169, 0x0292, 0x8028, 0x0917, 0x0005, 0x62AA, 0xE2DA,
+  0xE2E2, 0xA2D2, 0x8120, 0x0A15, 0x0007, 0x2000, 0xA169, 0xE2E2,
+  0xE2DA, 0xE2DA, 0xE2DA, 0x028A, 0x0B15, 0x0007, 0x2008, 0xA2D2,
+  0xE2DA, 0xE2DA, 0xE2DA, 0xE2E2, 0xA2DA, 0x0C15, 0x0008, 0x2141,
+  0xE2E2, 0xE2DA, 0xE2DA, 0xE2DA, 0xE2E2, 0xE2DA, 0x4110, 0x0D15,
+  0x0007, 0xA161, 0xE2E2, 0xE2DA, 0xE2DA, 0xE2DA, 0xE2E2, 0x82AA,
+  0x0E15, 0x0008, 0xE289, 0xE2E2, 0xE2DA, 0xE2DA, 0xE2DA, 0xA2D2,
+  0x8118, 0x2000, 0x0F15, 0x0006, 0x82AA, 0xE2E2, 0xE2DA, 0xE2DA,
+  0xA2DA, 0x6120, 0x1015, 0x0005, 0x82AA, 0xE2DA, 0xE2DA, 0xE2DA,
+  0x4151, 0x1115, 0x0005, 0xE289, 0x23E3, 0x23E3, 0x22CB, 0x2000,
+  0x1215, 0x0004, 0x217A, 0x23E3, 0x23DB, 0xA161, 0x1315, 0x0004,
+  0xA161, 0x23E3, 0x61E3, 0xA028, 0x1415, 0x0003, 0xE240, 0x61DB,
+  0x22C3, 0x1515, 0x0004, 0x4110, 0x61E3, 0x82AA, 0x2000, 0x1616,
+  0x0002, 0x22CB, 0x828A, 0x1716, 0x0002, 0x8292, 0x217A, 0x1816,
+  0x0002, 0xC169, 0x217A, 0x1916, 0x0008, 0xA028, 0xC169, 0x0000,
+  0x0000, 0x0000, 0x217A, 0x82AA, 0x6120, 0x1A17, 0x0007, 0x4159,
+  0x0000, 0x0000, 0xA118, 0xC1EB, 0x61E3, 0x2172, 0x1B17, 0x0007,
+  0x6118, 0x0000, 0x0000, 0x2141, 0xC1E3, 0xC1EB, 0x02C3, 0x1C14,
+  0x000A, 0x2000, 0x0000, 0x2000, 0x0000, 0x2000, 0x0000, 0x6151,
+  0xC1EB, 0xC1E3, 0x61E3, 0x1D11, 0x000E, 0x2000, 0x0000, 0x2000,
+  0x0000, 0x2000, 0x0000, 0x2000, 0x0000, 0x0000, 0x4151, 0xC1E3,
+  0xC1E3, 0x61DB, 0x2000, 0x1E12, 0x000E, 0x2000, 0x0000, 0x2000,
+  0x0000, 0x2000, 0x0000, 0x0000, 0x2000, 0x4159, 0xC1EB, 0xC1E3,
+  0x02C3, 0x0000, 0x2000, 0x1F10, 0x0013, 0x2000, 0x0000, 0x2000,
+  0x0000, 0x2000, 0x0000, 0x2000, 0x0000, 0x0000, 0x0000, 0x2141,
+  0xC1E3, 0xC1E3, 0x8292, 0x2000, 0x0000, 0x2000, 0x0000, 0x2000,
+  0x2010, 0x0012, 0x2000, 0x0000, 0x2000, 0x0008, 0x2008, 0x0000,
+  0x2008, 0x0000, 0x2008, 0x0000, 0x2010, 0xC1EB, 0xC1E3, 0x4151,
+  0x0000, 0x2000, 0x0000, 0x2000, 0x210F, 0x0015, 0x2000, 0x0008,
+  0x2000, 0x0000, 0x2000, 0x0000, 0x2008, 0x0008, 0x2008, 0x0000,
+  0x2008, 0x0000, 0x2149, 0xC169, 0x2000, 0x0008, 0x2000, 0x0000,
+  0x2000, 0x0000, 0x2000, 0x220D, 0x0017, 0x2000, 0x0000, 0x2000,
+  0x0000, 0x2008, 0x0008, 0x2008, 0x0000, 0x2008, 0x0008, 0x2000,
+  0x0008, 0x2008, 0x0008, 0x2000, 0x0008, 0x2008, 0x0008, 0x2000,
+  0x0000, 0x2000, 0x0000, 0x2000, 0x230E, 0x0017, 0x2000, 0x0000,
+  0x2000, 0x0008, 0x2000, 0x0008, 0x2008, 0x0008, 0x2000, 0x0008,
+  0x2008, 0x0008, 0x2000, 0x0008, 0x2008, 0x0008, 0x2008, 0x0000,
+  0x2008, 0x0000, 0x2008, 0x0000, 0x2000, 0x240C, 0x0019, 0x2000,
+  0x0000, 0x2000, 0x0000, 0x2008, 0x0008, 0x2008, 0x0008, 0x2008,
+  0x2008, 0x0000, 0x2008, 0x2008, 0x2008, 0x2008, 0x2010, 0x2008,
+  0x0008, 0x2008, 0x0008, 0x2000, 0x0000, 0x2008, 0x0000, 0x2000,
+  0x250B, 0x001C, 0x2000, 0x0000, 0x2000, 0x0000, 0x2000, 0x0008,
+  0x2008, 0x0008, 0x2008, 0x0008, 0x2008, 0x2008, 0x2008, 0x2010,
+  0x2010, 0x2010, 0x2008, 0x2008, 0x2008, 0x2008, 0x0000, 0x2008,
+  0x0008, 0x2008, 0x0000, 0x2000, 0x0000, 0x2000, 0x260C, 0x001B,
+  0x2000, 0x0000, 0x2008, 0x0008, 0x2008, 0x0000, 0x2008, 0x2008,
+  0x2008, 0x2010, 0x2010, 0x2010, 0x2010, 0xA028, 0x2010, 0x2010,
+  0x2010, 0x2010, 0x2008, 0x0008, 0x2008, 0x0008, 0x2000, 0x0008,
+  0x2000, 0x0000, 0x2000, 0x270B, 0x001D, 0x2000, 0x0000, 0x2000,
+  0x0008, 0x2008, 0x0008, 0x0008, 0x2008, 0x2010, 0x2010, 0x2010,
+  0x2010, 0x2010, 0x2010, 0x217A, 0x4118, 0x2010, 0x2010, 0x2010,
+  0x2010, 0x2008, 0x2008, 0x2000, 0x0008, 0x2008, 0x0008, 0x2000,
+  0x0000, 0x2000, 0x280A, 0x001F, 0x2000, 0x0000, 0x2000, 0x0008,
+  0x2008, 0x0008, 0x2008, 0x2008, 0x2010, 0x2010, 0x2010, 0x2010,
+  0x4118, 0x4110, 0x4118, 0x217A, 0xA169, 0x4118, 0x2010, 0x2010,
+  0x2010, 0x2010, 0x2008, 0x0008, 0x2008, 0x0000, 0x2008, 0x0000,
+  0x2000, 0x0000, 0x2000, 0x290A, 0x001E, 0x2000, 0x0000, 0x2008,
+  0x0000, 0x2008, 0x0008, 0x2008, 0x2010, 0x2010, 0x2010, 0x2010,
+  0x4118, 0x4118, 0x4110, 0x4118, 0x217A, 0x22B3, 0x4118, 0x4118,
+  0x4110, 0x2010, 0x2010, 0x2010, 0x2008, 0x0008, 0x2008, 0x0008,
+  0x2008, 0x0000, 0x2000, 0x2A0A, 0x001F, 0x2000, 0x0000, 0x2008,
+  0x0008, 0x2000, 0x2008, 0x2008, 0x2010, 0x2010, 0x4118, 0x4118,
+  0x4118, 0x4118, 0x4110, 0x4118, 0xA182, 0x61EC, 0x8128, 0x4110,
+  0x4118, 0x4118, 0x2010, 0x2010, 0x2010, 0x2008, 0x0008, 0x2008,
+  0x0000, 0x2000, 0x0000, 0x2000, 0x2B08, 0x0021, 0x2000, 0x0000,
+  0x2000, 0x0000, 0x2000, 0x0008, 0x0008, 0x2008, 0x2010, 0x2010,
+  0x4118, 0x4118, 0x4110, 0x6120, 0x6120, 0x6118, 0x6118, 0x8292,
+  0x81EC, 0xA169, 0x6120, 0x4110, 0x4118, 0x4118, 0x2010, 0x2010,
+  0x2008, 0x2008, 0x2008, 0x0008, 0x2008, 0x0000, 0x2000, 0x2C09,
+  0x0021, 0x2000, 0x0008, 0x2008, 0x0008, 0x2000, 0x2008, 0x2010,
+  0x2010, 0x4118, 0x4118, 0x4118, 0x6118, 0x6120, 0x6120, 0x6118,
+  0x8120, 0xE1A2, 0xA1EC, 0xE19A, 0x4118, 0x6118, 0x4118, 0x4118,
+  0x4118, 0x2010, 0x2010, 0x2008, 0x0008, 0x2008, 0x0000, 0x2000,
+  0x0000, 0x2000, 0x2D07, 0x0022, 0x2000, 0x0000, 0x2000, 0x0008,
+  0x2000, 0x0008, 0x2008, 0x2010, 0x2010, 0x4118, 0x4118, 0x4110,
+  0x6120, 0x6120, 0x6118, 0x6120, 0x8120, 0x6120, 0x61AB, 0xA1EC,
+  0x41E4, 0x8120, 0x6118, 0x6120, 0x4118, 0x4118, 0x4110, 0x2010,
+  0x2010, 0x2008, 0x0008, 0x2008, 0x0008, 0x2000, 0x2E08, 0x0022,
+  0x2000, 0x0000, 0x2008, 0x0008, 0x2000, 0x2008, 0x2010, 0x2010,
+  0x4118, 0x4118, 0x6120, 0x6118, 0x8120, 0x016A, 0xE238, 0xA128,
+  0x8128, 0xA2CB, 0xC1F4, 0xC1F4, 0x4151, 0x8120, 0x6118, 0x6118,
+  0x4118, 0x4118, 0x4110, 0x2010, 0x2008, 0x0008, 0x0008, 0x2008,
+  0x0000, 0x2000, 0x2F08, 0x0022, 0x2000, 0x0008, 0x2000, 0x0008,
+  0x2008, 0x2010, 0x2010, 0x4118, 0x4118, 0x6118, 0x6120, 0x6120,
+  0xA161, 0xE1F4, 0xE19A, 0x8128, 0x8120, 0x41DC, 0xC1F4, 0xC1F4,
+  0xE19A, 0x8128, 0x8120, 0x6118, 0x6120, 0x4118, 0x4118, 0x2010,
+  0x2008, 0x2008, 0x0008, 0x2000, 0x0008, 0x2000, 0x3006, 0x0025,
+  0x2000, 0x0000, 0x2000, 0x0000, 0x2008, 0x0008, 0x2008, 0x2010,
+  0x2010, 0x4118, 0x6120, 0x6118, 0x8120, 0x8128, 0x02BC, 0xC1F4,
+  0x21DC, 0xA128, 0xC130, 0xE1F4, 0xC1F4, 0xC1EC, 0x01CC, 0x8120,
+  0x6120, 0x8120, 0x6120, 0x6118, 0x4118, 0x2010, 0x2010, 0x2008,
+  0x0008, 0x0008, 0x2000, 0x0000, 0x2000, 0x3107, 0x0024, 0x2000,
+  0x0000, 0x2000, 0x0008, 0x2008, 0x2010, 0x2010, 0x4118, 0x4118,
+  0x6118, 0x6120, 0x6120, 0x2141, 0xC1EC, 0xC1F4, 0x02F5, 0x6249,
+  0x6249, 0x02F5, 0xC1F4, 0x22F5, 0xA1EC, 0xA130, 0x8128, 0x8120,
+  0x8128, 0x6118, 0x4118, 0x4118, 0x2010, 0x2010, 0x2008, 0x0008,
+  0x2008, 0x0000, 0x2000, 0x3206, 0x0025, 0x2000, 0x0000, 0x2008,
+  0x0000, 0x2008, 0x2008, 0x2010, 0x2010, 0x4118, 0x6120, 0x6118,
+  0x8128, 0x8128, 0xE19A, 0x22F5, 0x02F5, 0x02F5, 0x4272, 0x8182,
+  0x02F5, 0x02F5, 0x02F5, 0x21F5, 0x0231, 0xA128, 0xA128, 0x6120,
+  0x6120, 0x6118, 0x4118, 0x2010, 0x2010, 0x2008, 0x0008, 0x2000,
+  0x0008, 0x2000, 0x3307, 0x0025, 0x2000, 0x0000, 0x2008, 0x0008,
+  0x2008, 0x2010, 0x4118, 0x4118, 0x6118, 0x6120, 0xA128, 0xA128,
+  0xA3D4, 0x21F5, 0x01F5, 0x21F5, 0xE2BB, 0x01C4, 0x21F5, 0x21F5,
+  0x21F5, 0x21F5, 0x6251, 0xC130, 0xA130, 0x8128, 0x8120, 0x6120,
+  0x4110, 0x4118, 0x2010, 0x2008, 0x2008, 0x0008, 0x2008, 0x0000,
+  0x2000, 0x3406, 0x0025, 0x2000, 0x0008, 0x2008, 0x0008, 0x2000,
+  0x2008, 0x2010, 0x4118, 0x6120, 0x6118, 0x8128, 0x8128, 0x427A,
+  0x21F5, 0x21F5, 0x42F5, 0x42F5, 0x42F5, 0x42ED, 0x42F5, 0x42F5,
+  0x42F5, 0x21ED, 0x0162, 0xC230, 0xC130, 0xA128, 0x6120, 0x8120,
+  0x6120, 0x4110, 0x2010, 0x2010, 0x2008, 0x0008, 0x0008, 0x2000,
+  0x3506, 0x0027, 0x2000, 0x0000, 0x2000, 0x0008, 0x2008, 0x2010,
+  0x4118, 0x4118, 0x6118, 0x6120, 0xA128, 0xC230, 0xC3D4, 0x42F5,
+  0x42F5, 0x42F5, 0x42ED, 0x42F5, 0x42F5, 0x42F5, 0x42F5, 0x42F5,
+  0x42F5, 0x627A, 0xE238, 0xC130, 0xA128, 0x8128, 0x8128, 0x6118,
+  0x4118, 0x2010, 0x2010, 0x2008, 0x2008, 0x0008, 0x2000, 0x0000,
+  0x2000, 0x3605, 0x0028, 0x2000, 0x0000, 0x2008, 0x0008, 0x2008,
+  0x2008, 0x2010, 0x4118, 0x6118, 0x6120, 0x8120, 0x8128, 0x81B3,
+  0x42F5, 0x42F5, 0x42F5, 0x42F5, 0x82F5, 0x82F5, 0x62F5, 0x82ED,
+  0x62F5, 0x82F5, 0x42ED, 0x817A, 0x0239, 0xE230, 0xC130, 0x8128,
+  0x8120, 0x6120, 0x6120, 0x4110, 0x2010, 0x2008, 0x0008, 0x0008,
+  0x2000, 0x0000, 0x2000, 0x3705, 0x0027, 0x2000, 0x0000, 0x2000,
+  0x0008, 0x2008, 0x2010, 0x2010, 0x4118, 0x6118, 0x6120, 0x8128,
+  0x0162, 0x42ED, 0x42F5, 0x82F5, 0x62ED, 0x82F5, 0x62F5, 0x82F5,
+  0xA2F5, 0xA2F5, 0x62F5, 0x82F5, 0x82FD, 0x2383, 0x2239, 0xE238,
+  0xC130, 0xA128, 0x8128, 0x8128, 0x6118, 0x4118, 0x2010, 0x2010,
+  0x2008, 0x2008, 0x0008, 0x2000, 0x3806, 0x0027, 0x2000, 0x0008,
+  0x2008, 0x2008, 0x2010, 0x4118, 0x4118, 0x6120, 0x8120, 0xA128,
+  0xE1DC, 0x42F5, 0x82F5, 0x82F5, 0x62F5, 0xA2F5, 0xA2F5, 0xA2F5,
+  0xA2F5, 0xA2F5, 0xA2F5, 0xA2F5, 0xA2F5, 0x2393, 0x2241, 0x0239,
+  0xE230, 0xC130, 0xA128, 0x6120, 0x6120, 0x4110, 0x4118, 0x2010,
+  0x2008, 0x0008, 0x2008, 0x0000, 0x2000, 0x3905, 0x0028, 0x2000,
+  0x0000, 0x2008, 0x0008, 0x2008, 0x2010, 0x4110, 0x6120, 0x6118,
+  0x8120, 0x0162, 0x42F5, 0x62F5, 0x82F5, 0x82F5, 0xA2F5, 0xA2F5,
+  0xC3F5, 0xC3F5, 0xC3F5, 0xC3F5, 0xC3F5, 0xC3F5, 0xA2F5, 0x239B,
+  0x4249, 0x2239, 0xE238, 0xC130, 0xA128, 0x8128, 0x6118, 0x4118,
+  0x4118, 0x2010, 0x2008, 0x0008, 0x2008, 0x0000, 0x2000, 0x3A04,
+  0x002A, 0x2000, 0x0000, 0x2000, 0x0008, 0x2008, 0x2008, 0x2010,
+  0x4118, 0x6120, 0x8120, 0x8128, 0x819B, 0x82F5, 0x82F5, 0xA2F5,
+  0xA2F5, 0x04F6, 0xE4FD, 0xE3F5, 0xE3F5, 0xE3F5, 0xE3F5, 0xE3F5,
+  0xE3F5, 0xC3F5, 0x2393, 0x6249, 0x2241, 0x0239, 0xE238, 0xA128,
+  0xA128, 0x8120, 0x6120, 0x4118, 0x2010, 0x2008, 0x0008, 0x0008,
+  0x2000, 0x0000, 0x2000, 0x3B04, 0x0029, 0x2000, 0x0000, 0x2000,
+  0x0008, 0x2008, 0x2008, 0x2010, 0x4118, 0x6118, 0x6120, 0x8128,
+  0xE2B3, 0x82F5, 0xA2F5, 0xA2F5, 0xC3F5, 0xA7F6, 0xE8FE, 0xE4FD,
+  0x03F6, 0x03F6, 0x03F6, 0x03F6, 0xE3F5, 0xE3F5, 0x819B, 0x6251,
+  0x2241, 0x4241, 0xE238, 0xC130, 0x8128, 0x8128, 0x6118, 0x4118,
+  0x2010, 0x2010, 0x2008, 0x2008, 0x0000, 0x2000, 0x3C05, 0x0028,
+  0x2000, 0x0008, 0x2008, 0x2008, 0x2010, 0x2010, 0x4118, 0x6120,
+  0x8120, 0xA128, 0xA1CC, 0xA2FD, 0xA2F5, 0xC2F5, 0x04F6, 0x08FF,
+  0x29FF, 0x85F6, 0x23F6, 0x03F6, 0x23FE, 0x03F6, 0x03F6, 0xE3F5,
+  0x43AC, 0xA251, 0x6249, 0x2241, 0x0239, 0xC130, 0xC130, 0x8120,
+  0x6120, 0x4110, 0x2010, 0x2010, 0x2008, 0x0008, 0x0008, 0x2000,
+  0x3D04, 0x002A, 0x2000, 0x0000, 0x2000, 0x0008, 0x2008, 0x2010,
+  0x4118, 0x4118, 0x6118, 0x8128, 0xA128, 0x02DD, 0xA2F5, 0xC2F5,
+  0xE2F5, 0xA7F6, 0x08F7, 0x09FF, 0xA7FE, 0x43F6, 0x43F6, 0x43F6,
+  0x03FE, 0x23F6, 0x03F6, 0xC2E5, 0xA259, 0x6249, 0x4249, 0x2239,
+  0xE238, 0xA128, 0x8120, 0x6120, 0x4118, 0x4118, 0x2010, 0x2008,
+  0x0008, 0x2000, 0x0000, 0x2000, 0x3E05, 0x0029, 0x2000, 0x0008,
+  0x2008, 0x2008, 0x2010, 0x4118, 0x4110, 0x8128, 0x8128, 0xC130,
+  0x82F5, 0xC2F5, 0xC2F5, 0x66FE, 0x08FF, 0x09FF, 0x29F7, 0xA7F6,
+  0x64F6, 0x44FE, 0x64F6, 0x43F6, 0x44F6, 0x23FE, 0xE3F5, 0x43AC,
+  0xA251, 0x2241, 0x0239, 0xE238, 0xC128, 0xA128, 0x6120, 0x6120,
+  0x4110, 0x2010, 0x2008, 0x0008, 0x2008, 0x0000, 0x2000, 0x3F05,
+  0x0028, 0x2000, 0x0000, 0x0008, 0x2008, 0x2010, 0x4118, 0x6118,
+  0xA182, 0x2241, 0x0231, 0xC2F5, 0xE2F5, 0xE2F5, 0xE8FE, 0x29F7,
+  0x09FF, 0x29FF, 0xE8FE, 0x44F6, 0x64F6, 0x85F6, 0x08FF, 0x09FF,
+  0x85F6, 0x23F6, 0x03FE, 0xC39B, 0x6251, 0x4241, 0xE238, 0xC130,
+  0x8128, 0x8120, 0x6120, 0x4118, 0x2010, 0x2008, 0x2008, 0x0008,
+  0x2000, 0x4004, 0x002A, 0x2000, 0x0000, 0x2008, 0x0008, 0x2008,
+  0x2010, 0x4118, 0x8149, 0xC2F5, 0xA1CC, 0x2141, 0xC2F5, 0xE2F5,
+  0x02F6, 0x08FF, 0x09FF, 0x29FF, 0x09FF, 0x69FF, 0xA7F6, 0x07F7,
+  0x69FF, 0x49FF, 0x69FF, 0xE8F6, 0x43F6, 0x23F6, 0x03F6, 0xA372,
+  0x2241, 0x0239, 0xC130, 0xA128, 0x6120, 0x6120, 0x4110, 0x2010,
+  0x2008, 0x0008, 0x2008, 0x0000, 0x2000, 0x4104, 0x002A, 0x2000,
+  0x0000, 0x2008, 0x0008, 0x2008, 0x2010, 0x2110, 0x2141, 0xE1D4,
+  0x819B, 0x6141, 0xE2F5, 0x02F6, 0x02F6, 0xA7F6, 0x09FF, 0x29F7,
+  0x49FF, 0x69FF, 0x49FF, 0x69F7, 0x49FF, 0x69FF, 0x49FF, 0x69FF,
+  0x84F6, 0x43F6, 0x23FE, 0xA2E5, 0xC259, 0x0239, 0xE238, 0xA128,
+  0x8120, 0x6120, 0x4110, 0x2010, 0x2008, 0x0008, 0x2008, 0x0008,
+  0x2000, 0x4205, 0x002A, 0x2000, 0x0008, 0x2008, 0x2010, 0x2010,
+  0x4118, 0x6120, 0x8120, 0xA128, 0x6251, 0x02FE, 0x02F6, 0x02F6,
+  0x85F6, 0x29FF, 0x49FF, 0x69FF, 0x49FF, 0x69F7, 0x49FF, 0xE5FE,
+  0x07F7, 0x69FF, 0x49FF, 0xA7F6, 0x43F6, 0x23F6, 0x23F6, 0xA39B,
+  0x0239, 0xE230, 0xA130, 0x8120, 0x6120, 0x4110, 0x2010, 0x2008,
+  0x0008, 0x0008, 0x2000, 0x0000, 0x2000, 0x4305, 0x0029, 0x2000,
+  0x0008, 0x0008, 0x2010, 0x2010, 0x4110, 0x6120, 0xA128, 0xA128,
+  0x6141, 0x02F6, 0x02F6, 0x23F6, 0x43F6, 0xE8F6, 0x69FF, 0x49FF,
+  0x69FF, 0x49FF, 0x05F7, 0xC5F6, 0xE5FE, 0x69FF, 0x49F7, 0x07FF,
+  0x64FE, 0x43F6, 0x23FE, 0xC2E5, 0x4241, 0xE238, 0xA128, 0x8128,
+  0x6118, 0x4118, 0x2010, 0x2010, 0x0008, 0x2008, 0x0008, 0x2000,
+  0x4404, 0x002A, 0x2000, 0x0008, 0x2008, 0x0008, 0x2010, 0x2010,
+  0x4110, 0x6120, 0xA128, 0xC130, 0x0239, 0x22FE, 0x23F6, 0x23FE,
+  0x43F6, 0x85F6, 0x49FF, 0x69FF, 0x49FF, 0x48FF, 0x05F7, 0x05F7,
+  0xE5FE, 0x49FF, 0x69FF, 0xE8F6, 0x64F6, 0x43F6, 0x23F6, 0x03FE,
+  0x0162, 0xC230, 0xA128, 0x8120, 0x6120, 0x4110, 0x2010, 0x2010,
+  0x0008, 0x2008, 0x0000, 0x2000, 0x4505, 0x002A, 0x2000, 0x0008,
+  0x0008, 0x2008, 0x2010, 0x4118, 0x6118, 0xA128, 0xC130, 0xC230,
+  0xA2E5, 0x22F6, 0x43F6, 0x44F6, 0x64F6, 0x27F7, 0x49FF, 0x69FF,
+  0x47FF, 0x05F7, 0x05FF, 0x05F7, 0x49FF, 0x69FF, 0xE8F6, 0x83FE,
+  0x64F6, 0x43F6, 0x42FE, 0x8272, 0xE238, 0xA128, 0x8128, 0x6118,
+  0x4118, 0x2010, 0x2010, 0x2008, 0x0008, 0x2008, 0x0000, 0x2000,
+  0x4604, 0x002B, 0x2000, 0x0008, 0x2008, 0x2008, 0x2010, 0x4118,
+  0x4118, 0x6118, 0xA128, 0xC130, 0xE238, 0x43B4, 0x43FE, 0x43F6,
+  0x64F6, 0x84FE, 0xA4F6, 0x47FF, 0x89FF, 0x47FF, 0x45F7, 0x45FF,
+  0x05F7, 0x49FF, 0x49FF, 0x27FF, 0x84F6, 0x64F6, 0x43F6, 0x43F6,
+  0x0362, 0xC230, 0xC130, 0x8120, 0x6120, 0x4110, 0x2010, 0x2010,
+  0x0008, 0x0008, 0x2000, 0x0000, 0x2000, 0x4703, 0x002B, 0x2000,
+  0x0000, 0x2000, 0x0008, 0x2008, 0x2010, 0x4118, 0x4118, 0x6118,
+  0x8128, 0xC130, 0xE230, 0x0362, 0x22F6, 0x43F6, 0x64F6, 0x84F6,
+  0xA4FE, 0xC4F6, 0x48FF, 0x48F7, 0x25FF, 0x45FF, 0x26F7, 0x49FF,
+  0x48FF, 0xA4F6, 0x84FE, 0x64F6, 0x43FE, 0x22E6, 0x2241, 0xE238,
+  0xC130, 0xA128, 0x6120, 0x4110, 0x4118, 0x2010, 0x2010, 0x2008,
+  0x0000, 0x2000, 0x4804, 0x002B, 0x2000, 0x0008, 0x2008, 0x2008,
+  0x2010, 0x4118, 0x4118, 0x6120, 0xA128, 0xC130, 0xE230, 0x2249,
+  0xC2C4, 0x63F6, 0x83F6, 0x84F6, 0xA4FE, 0xE5F6, 0x05FF, 0x47FF,
+  0x45F7, 0x25FF, 0x47FF, 0x48FF, 0xE5F6, 0xA4F6, 0x84F6, 0x63FE,
+  0x64F6, 0x23AC, 0x2241, 0xE230, 0xC130, 0x6120, 0x6120, 0x4110,
+  0x4118, 0x2010, 0x2008, 0x0008, 0x2000, 0x0000, 0x2000, 0x4904,
+  0x002A, 0x2000, 0x0008, 0x0008, 0x2008, 0x2010, 0x4118, 0x4110,
+  0x6120, 0xA128, 0xC130, 0xC230, 0x2241, 0x0162, 0x43EE, 0x63F6,
+  0x84F6, 0xC4FE, 0xE5F6, 0x05FF, 0x25F7, 0x45FF, 0x25FF, 0x45FF,
+  0x05F7, 0xE5FE, 0xC4F6, 0x84FE, 0x83F6, 0x43F6, 0xA259, 0x4241,
+  0xE238, 0xC130, 0xA128, 0x6120, 0x4110, 0x2010, 0x2010, 0x0008,
+  0x2008, 0x0008, 0x2000, 0x4A04, 0x002B, 0x2000, 0x0008, 0x2008,
+  0x2008, 0x2008, 0x4118, 0x4110, 0x6120, 0xA128, 0xC130, 0xE238,
+  0x2241, 0x6251, 0x2383, 0x83F6, 0xA4FE, 0xC4F6, 0xE5FE, 0x05F7,
+  0x45FF, 0x25FF, 0x45FF, 0x25F7, 0x05FF, 0xE5F6, 0xA4F6, 0xA4FE,
+  0x63EE, 0x0383, 0x6249, 0x0239, 0xE230, 0xA130, 0xA128, 0x6118,
+  0x4118, 0x2010, 0x2010, 0x0008, 0x0008, 0x2000, 0x0000, 0x2000,
+  0x4B04, 0x002A, 0x2000, 0x0000, 0x0008, 0x2008, 0x2010, 0x4118,
+  0x4118, 0x6118, 0xA128, 0xC130, 0xE238, 0x2241, 0x6249, 0xA251,
+  0x23AC, 0xA4FE, 0xC4F6, 0xE5FE, 0x05F7, 0x25FF, 0x45F7, 0x25FF,
+  0x05FF, 0x05F7, 0xE5FE, 0xC4FE, 0xC4FE, 0xC39B, 0xC251, 0x6251,
+  0x2239, 0xE238, 0xA130, 0x8120, 0x6120, 0x4110, 0x2010, 0x2010,
+  0x0008, 0x2008, 0x0008, 0x2000, 0x4C05, 0x0029, 0x2008, 0x0008,
+  0x2008, 0x2010, 0x2010, 0x4110, 0x6120, 0xA128, 0xC130, 0x8149,
+  0x2241, 0x6251, 0xC251, 0x8272, 0xC3FE, 0xE4FE, 0x04FF, 0x05F7,
+  0x06FF, 0x26F7, 0x25FF, 0x05F7, 0x04FF, 0xC5F6, 0xC4FE, 0x43CD,
+  0x2362, 0xA251, 0x6249, 0x0239, 0xE238, 0xA128, 0x8120, 0x6120,
+  0x4110, 0x2010, 0x2010, 0x0008, 0x2008, 0x0000, 0x2000, 0x4D05,
+  0x002A, 0x2000, 0x0000, 0x0008, 0x2010, 0x2010, 0x4118, 0x6120,
+  0x8120, 0xC230, 0x22E6, 0x2241, 0x6249, 0xA251, 0xA372, 0xC3FE,
+  0xC4F6, 0x04FF, 0x05F7, 0x05FF, 0x4CF7, 0x06FF, 0x05F7, 0x04FF,
+  0xE5FE, 0xE4FE, 0xC39B, 0x2362, 0xC259, 0x6251, 0x0239, 0xE238,
+  0xA128, 0x8120, 0x6120, 0x4118, 0x2010, 0x2008, 0x2008, 0x0008,
+  0x2008, 0x0000, 0x2000, 0x4E04, 0x002B, 0x2000, 0x0000, 0x2008,
+  0x0008, 0x2010, 0x2010, 0x4118, 0x6120, 0x8120, 0x2162, 0x82FE,
+  0x0162, 0x6249, 0x2362, 0xC2E5, 0xC3FE, 0x04FF, 0x04FF, 0x05F7,
+  0x05F7, 0xB0FF, 0x4AFF, 0x05F7, 0x04FF, 0xE4FE, 0xC4F6, 0x0383,
+  0x2362, 0xA251, 0x2241, 0x0239, 0xE230, 0xC130, 0x8120, 0x6120,
+  0x4110, 0x2010, 0x2008, 0x0008, 0x0008, 0x2000, 0x0000, 0x2000,
+  0x4F04, 0x0029, 0x2000, 0x0000, 0x2008, 0x0008, 0x2008, 0x2010,
+  0x4110, 0x6118, 0x6120, 0x218B, 0x82F6, 0x838B, 0xA372, 0x63F6,
+  0xC3FE, 0xC4F6, 0x04F7, 0x04FF, 0x05FF, 0x05F7, 0x4CF7, 0x94FF,
+  0x48FF, 0x05FF, 0x04FF, 0xE4FE, 0x838B, 0xA251, 0xC259, 0x4249,
+  0x0239, 0xC130, 0x8128, 0x8120, 0x6120, 0x4110, 0x2010, 0x2008,
+  0x2008, 0x0008, 0x2008, 0x5005, 0x0028, 0x2000, 0x0008, 0x2008,
+  0x2008, 0x2010, 0x4118, 0x6120, 0x8120, 0xC2C4, 0x82F6, 0x63CD,
+  0x02E6, 0xC3F6, 0xC3FE, 0xC4F6, 0xC4FE, 0x04FF, 0x05F7, 0x05F7,
+  0x4CFF, 0x94FF, 0x53FF, 0x05F7, 0xE4FE, 0xC4F6, 0x03B5, 0xA251,
+  0x8349, 0x2241, 0x0239, 0xC130, 0xA128, 0x8120, 0x6120, 0x4110,
+  0x2010, 0x2008, 0x0008, 0x0008, 0x2000, 0x5105, 0x0029, 0x2000,
+  0x0000, 0x0008, 0x2008, 0x2010, 0x4118, 0x6118, 0x6120, 0x02DE,
+  0xA2F6, 0xA2FE, 0xC3F6, 0xC3FE, 0xC4F6, 0x04F7, 0x04FF, 0x05FF,
+  0x05F7, 0x05F7, 0x4CFF, 0x94FF, 0x94FF, 0x4CF7, 0x04FF, 0x04FF,
+  0xE4FE, 0xC37A, 0x8349, 0x4241, 0x0239, 0xC130, 0xA128, 0x8120,
+  0x6120, 0x4118, 0x2010, 0x2008, 0x0008, 0x2008, 0x0000, 0x2000,
+  0x5204, 0x0029, 0x2000, 0x0000, 0x2008, 0x0008, 0x2008, 0x2010,
+  0x4110, 0x6120, 0x4241, 0xC2FE, 0xC2FE, 0xC3FE, 0xC3F6, 0xC4FE,
+  0x04F7, 0x04FF, 0x05F7, 0x05FF, 0x05F7, 0x06FF, 0x4CFF, 0x94FF,
+  0xB4F7, 0x94FF, 0x26F7, 0x04FF, 0xE4F6, 0x03D6, 0xA251, 0x2241,
+  0x0239, 0xC130, 0x8128, 0x8120, 0x6120, 0x4110, 0x2010, 0x2008,
+  0x0008, 0x0008, 0x2000, 0x5304, 0x002A, 0x2000, 0x0000, 0x2008,
+  0x0008, 0x2008, 0x2010, 0x4110, 0x4118, 0x826A, 0xA2F6, 0xA2FE,
+  0xC3F6, 0xC3F6, 0x04FF, 0xE4FE, 0x05F7, 0x05FF, 0x05F7, 0x26F7,
+  0x06FF, 0x4EF7, 0xB4FF, 0x94FF, 0x94FF, 0x4EF7, 0xE4FE, 0x04F7,
+  0x04FF, 0x63D5, 0xC259, 0x0239, 0xE238, 0xA128, 0x8120, 0x6120,
+  0x2010, 0x2010, 0x2008, 0x0008, 0x2000, 0x0000, 0x2000, 0x5405,
+  0x0028, 0x2000, 0x0000, 0x2008, 0x2010, 0x2010, 0x4118, 0x8120,
+  0x63AC, 0xC2FE, 0xC3FE, 0xC3F6, 0x04FF, 0x04FF, 0xE4F6, 0x05F7,
+  0x26FF, 0x06FF, 0x26F7, 0x06FF, 0xB0FF, 0x94F7, 0xB4FF, 0x94FF,
+  0xB4FF, 0x26F7, 0xE4F6, 0x04FF, 0xE4F6, 0x03D6, 0xA251, 0xC230,
+  0x8128, 0x8120, 0x6120, 0x4110, 0x2010, 0x2008, 0x0008, 0x0008,
+  0x2000, 0x5505, 0x0029, 0x2000, 0x0000, 0x0008, 0x2010, 0x4118,
+  0x6118, 0x6118, 0x02DE, 0xC3FE, 0x04F7, 0xE4FE, 0x04F7, 0xE4FE,
+  0x05F7, 0x26FF, 0x06F7, 0x26FF, 0x26F7, 0x47FF, 0x94F7, 0xB4FF,
+  0x94FF, 0xB4FF, 0x94FF, 0x4AFF, 0x05F7, 0x04F7, 0x04FF, 0x04FF,
+  0x22E6, 0xC159, 0xA130, 0xA118, 0x6120, 0x4118, 0x2010, 0x2008,
+  0x0008, 0x2000, 0x0000, 0x2000, 0x5604, 0x0029, 0x2000, 0x0000,
+  0x2008, 0x2008, 0x2010, 0x8010, 0x8120, 0x8149, 0xE3FE, 0x23FF,
+  0x04FF, 0xE4F6, 0x04FF, 0x05F7, 0x06FF, 0x26F7, 0x46FF, 0x46FF,
+  0x47F7, 0xAFFF, 0x95FF, 0x95FF, 0xB5FF, 0x95F7, 0xB5FF, 0x8DFF,
+  0x05F7, 0x05F7, 0x04FF, 0xE4FE, 0x03F7, 0x02DE, 0xC128, 0x8118,
+  0x6118, 0x4118, 0x2010, 0x2008, 0x2008, 0x0000, 0x2000, 0x5705,
+  0x0028, 0x2000, 0x0008, 0x2008, 0x2010, 0x6008, 0x8118, 0x0383,
+  0x23FF, 0x03F7, 0xE4F6, 0x04FF, 0x05F7, 0x06FF, 0x26F7, 0x46FF,
+  0x47FF, 0x6AF7, 0xB0FF, 0x95FF, 0xB5FF, 0x95F7, 0xB5FF, 0x95FF,
+  0x95FF, 0xB0FF, 0x26F7, 0x25FF, 0x04F7, 0x04FF, 0x23FF, 0x23FF,
+  0x2383, 0x8120, 0x6120, 0x4118, 0x2010, 0x2008, 0x2008, 0x0000,
+  0x2000, 0x5804, 0x0028, 0x2000, 0x0000, 0x2008, 0x2008, 0x4118,
+  0xA018, 0x8118, 0x23BD, 0x23FF, 0x23FF, 0x03FF, 0x45FF, 0x45F7,
+  0x46FF, 0x4AFF, 0xB0FF, 0x95FF, 0xB5F7, 0x95FF, 0xB5FF, 0x95FF,
+  0xB5F7, 0x95FF, 0xB5FF, 0x95FF, 0xB0F7, 0x46FF, 0x26F7, 0x45FF,
+  0x44FF, 0x03F7, 0x03F7, 0x63CD, 0xA118, 0x8120, 0x4110, 0x2010,
+  0x2008, 0x0008, 0x2000, 0x5905, 0x0028, 0x2008, 0x2000, 0x4008,
+  0x8010, 0x8010, 0xC118, 0x83E6, 0x23F7, 0x03F7, 0x25F7, 0x45FF,
+  0x47FF, 0xB0F7, 0x95FF, 0xD5FF, 0x96FF, 0xB6FF, 0x96FF, 0xB6FF,
+  0x96FF, 0xB6FF, 0xB5FF, 0xB6FF, 0x95FF, 0xB0FF, 0x46FF, 0x46F7,
+  0x45FF, 0x44FF, 0x44F7, 0x23FF, 0x03F7, 0xE128, 0x8120, 0x4118,
+  0x2010, 0x2008, 0x2008, 0x0000, 0x2000, 0x5A04, 0x0029, 0x2000,
+  0x2000, 0x4008, 0x4008, 0x8010, 0x8120, 0x8239, 0x23FF, 0x23FF,
+  0x44FF, 0x45FF, 0x46FF, 0xB0FF, 0xB5FF, 0xD5FF, 0xB5FF, 0xD6FF,
+  0xB6FF, 0xD6FF, 0xB6FF, 0xD6FF, 0xB6FF, 0xD6FF, 0xB6FF, 0xD5FF,
+  0xB0FF, 0x47F7, 0x46FF, 0x46FF, 0x25F7, 0x44FF, 0x03F7, 0x23FF,
+  0xC239, 0x8118, 0x8010, 0x4008, 0x2008, 0x2000, 0x0000, 0x2000,
+  0x5B04, 0x0027, 0x2008, 0x2000, 0x2008, 0x8010, 0x8010, 0xC120,
+  0x0363, 0x03F7, 0x44F7, 0x44FF, 0x45F7, 0xB0FF, 0xB4FF, 0xD5FF,
+  0x96FF, 0xD6FF, 0xB6FF, 0xD7FF, 0xB7FF, 0xD7FF, 0xB7FF, 0xD7FF,
+  0xB7FF, 0xD6FF, 0xD6FF, 0xB0FF, 0x48FF, 0x47F7, 0x46FF, 0x45FF,
+  0x44F7, 0x44FF, 0x23FF, 0xA362, 0xA120, 0xA018, 0x4008, 0x4008,
+  0x2008, 0x5C04, 0x0028, 0x2000, 0x2008, 0x6008, 0x8010, 0xA018,
+  0xC120, 0x439C, 0x44FF, 0x44FF, 0x45FF, 0x4AF7, 0xD5FF, 0xD5FF,
+  0xB6FF, 0xD6FF, 0xB7FF, 0xD7FF, 0xD7FF, 0xD7FF, 0xD8FF, 0xD8FF,
+  0xD8FF, 0xB7FF, 0xD7FF, 0xB6FF, 0xB0FF, 0x89FF, 0x48F7, 0x47FF,
+  0x46FF, 0x45F7, 0x44FF, 0x44F7, 0x6473, 0xA118, 0xA018, 0x6010,
+  0x4000, 0x2000, 0x2008, 0x5D04, 0x0028, 0x2000, 0x4008, 0x4008,
+  0x6010, 0xA018, 0xA118, 0xA5BD, 0x44FF, 0x44F7, 0x65FF, 0xB0FF,
+  0xD5FF, 0xB5FF, 0xD6FF, 0xD7FF, 0xD7F7, 0xD8FF, 0xD8FF, 0xD8FF,
+  0xF8FF, 0xD8FF, 0xD8FF, 0xD8FF, 0xD7FF, 0xD7FF, 0xAFFF, 0x89FF,
+  0x88FF, 0x88F7, 0x86FF, 0x65FF, 0x44FF, 0x44FF, 0x439C, 0xC120,
+  0xA018, 0x8010, 0x4008, 0x2008, 0x2000, 0x5E02, 0x002A, 0x2000,
+  0x0000, 0x2000, 0x4008, 0x4008, 0x8010, 0xA018, 0xC120, 0xA3EE,
+  0x44FF, 0x45FF, 0x66F7, 0xD4FF, 0xD5FF, 0xB6FF, 0xD6FF, 0xD7F7,
+  0xD8FF, 0xD8FF, 0xD8FF, 0xD9FF, 0xD9FF, 0xF9FF, 0xD9FF, 0xD8FF,
+  0xD8FF, 0xD7FF, 0x8DFF, 0xAAFF, 0x89F7, 0x88FF, 0x66FF, 0x65F7,
+  0x65FF, 0x44FF, 0xC49C, 0xA118, 0xA018, 0x6010, 0x4008, 0x4008,
+  0x2000, 0x5F03, 0x002A, 0x2000, 0x2008, 0x4000, 0x6010, 0x6010,
+  0xC118, 0x2229, 0x44FF, 0x44F7, 0x65FF, 0x8BF7, 0xB5FF, 0xD6FF,
+  0xB6FF, 0xD7FF, 0xD8FF, 0xD8FF, 0xF9FF, 0xDAFF, 0xFAFF, 0xDAFF,
+  0xFAFF, 0xDAFF, 0xB6FF, 0xD4FF, 0xB0FF, 0x8DFF, 0x8CF7, 0xAAFF,
+  0x89FF, 0x88FF, 0x66FF, 0x85FF, 0x44FF, 0xC5C5, 0xC120, 0x8120,
+  0x8010, 0x4008, 0x4008, 0x2000, 0x2000, 0x6002, 0x002A, 0x2000,
+  0x2008, 0x2000, 0x4008, 0x8010, 0xA018, 0xC120, 0xE241, 0x64FF,
+  0x65FF, 0x86FF, 0x8DFF, 0xD5FF, 0xB6FF, 0xD7FF, 0xD7FF, 0xD8FF,
+  0xD9FF, 0xFAFF, 0xDBFF, 0xFBFF, 0xDBFF, 0xFBFF, 0xDBFF, 0xD6FF,
+  0xB2FF, 0xB0FF, 0xAFFF, 0x8CF7, 0xABFF, 0x89FF, 0x88F7, 0x66FF,
+  0x86FF, 0x65FF, 0x03D6, 0xE120, 0x8010, 0x8008, 0x4008, 0x4008,
+  0x2000, 0x6103, 0x0029, 0x2000, 0x2008, 0x4008, 0x8010, 0x8010,
+  0xC120, 0x624A, 0x65F7, 0x65FF, 0x66FF, 0xB0F7, 0xB6FF, 0xD6FF,
+  0xD7FF, 0xD8FF, 0xD9FF, 0xFAFF, 0xDBFF, 0xDCFF, 0xFCFF, 0xFDFF,
+  0xFDFF, 0xFCFF, 0xD7FF, 0xB2FF, 0xB0FF, 0xAFFF, 0x8DF7, 0xABFF,
+  0x8AFF, 0x89FF, 0x87F7, 0x86FF, 0x65FF, 0xC5EE, 0x0129, 0xA018,
+  0x8010, 0x4008, 0x4008, 0x2008, 0x6202, 0x002B, 0x2000, 0x2008,
+  0x4008, 0x4008, 0x8010, 0xA018, 0xC120, 0xA362, 0x85FF, 0x66FF,
+  0x87FF, 0xB0FF, 0xD6FF, 0xD7FF, 0xD7FF, 0xD8FF, 0xD9FF, 0xFAFF,
+  0xDBFF, 0xFCFF, 0xFDFF, 0xFEFF, 0xFEFF, 0xFDFF, 0xD9FF, 0xD4F7,
+  0xB2FF, 0xB0FF, 0xCDFF, 0x8CF7, 0x8AFF, 0x89FF, 0x88F7, 0x86FF,
+  0x65FF, 0x45F7, 0xE120, 0x8010, 0x8008, 0x4008, 0x4008, 0x2000,
+  0x2008, 0x6303, 0x0029, 0x2000, 0x4008, 0x4008, 0x6010, 0xA018,
+  0xC118, 0x0363, 0x65FF, 0x66FF, 0x87F7, 0xB0FF, 0xB6FF, 0xD7FF,
+  0xD7FF, 0xF8FF, 0xD9FF, 0xDAFF, 0xFCFF, 0xFDFF, 0xFEFF, 0xFEFF,
+  0xFEFF, 0xFDFF, 0xDBFF, 0xD5FF, 0xD2F7, 0xB0FF, 0xAFFF, 0x8CFF,
+  0x8BFF, 0x89FF, 0x88FF, 0x86FF, 0x66FF, 0x85FF, 0x6239, 0xC120,
+  0x8010, 0x4008, 0x4008, 0x2000, 0x6402, 0x002A, 0x2000, 0x2000,
+  0x4008, 0x4008, 0x8010, 0xA018, 0xC120, 0x236B, 0x86FF, 0x66FF,
+  0x88FF, 0xB0FF, 0xD6FF, 0xD7FF, 0xD7FF, 0xD8FF, 0xD9FF, 0xFBFF,
+  0xFCFF, 0xFDFF, 0xFEFF, 0xFEFF, 0xFEFF, 0xFDFF, 0xDCFF, 0xD5FF,
+  0xB2FF, 0xB0FF, 0xAFFF, 0x8CF7, 0x8BFF, 0x89FF, 0x88F7, 0x87FF,
+  0x86FF, 0x65FF, 0xC239, 0xC118, 0x6010, 0x4008, 0x4008, 0x2000,
+  0x6503, 0x002A, 0x2000, 0x4008, 0x4008, 0x6010, 0xA018, 0xA118,
+  0xA35A, 0x66FF, 0x87F7, 0x88FF, 0xAFFF, 0xD6FF, 0xD7FF, 0xD7F7,
+  0xD8FF, 0xF9FF, 0xDAFF, 0xDBFF, 0xFDFF, 0xFEFF, 0xFEFF, 0xFEFF,
+  0xFDFF, 0xFCFF, 0xD7FF, 0xB2FF, 0xB0FF, 0xAFFF, 0x8CFF, 0xABFF,
+  0x8AFF, 0x88FF, 0x87FF, 0x86FF, 0x86FF, 0x6252, 0xA018, 0x8010,
+  0x4008, 0x4008, 0x2000, 0x2000, 0x6602, 0x002A, 0x2000, 0x2000,
+  0x4008, 0x4008, 0x8010, 0xA018, 0xC120, 0x6252, 0x86FF, 0x87FF,
+  0x88FF, 0xAFFF, 0xD6FF, 0xD7FF, 0xD7FF, 0xD8FF, 0xD9FF, 0xFAFF,
+  0xDBFF, 0xFCFF, 0xFDFF, 0xFDFF, 0xFDFF, 0xFCFF, 0xDBFF, 0xD9FF,
+  0xD2FF, 0xB0FF, 0xAFFF, 0x8CFF, 0x8BFF, 0xAAF7, 0x88FF, 0x87FF,
+  0x66F7, 0x86FF, 0x424A, 0xA010, 0x6010, 0x4008, 0x4008, 0x2000,
+  0x6703, 0x002A, 0x2000, 0x4008, 0x4008, 0x8010, 0xA018, 0xC118,
+  0xC239, 0x66FF, 0x87FF, 0x88F7, 0xACFF, 0xD6FF, 0xD7FF, 0xD7FF,
+  0xD8FF, 0xF9FF, 0xDAFF, 0xFAFF, 0xDBFF, 0xDCFF, 0xFCFF, 0xFCFF,
+  0xDBFF, 0xFBFF, 0xDAFF, 0xD4F7, 0xAFFF, 0xADFF, 0xCCFF, 0x8BFF,
+  0xAAFF, 0x88FF, 0x87FF, 0x87FF, 0x86FF, 0x6252, 0xA018, 0x8010,
+  0x4008, 0x4008, 0x2008, 0x2000, 0x6803, 0x0029, 0x2000, 0x2008,
+  0x4008, 0x8010, 0x6010, 0xC120, 0x0121, 0x67F7, 0x87FF, 0xA8FF,
+  0xAAFF, 0xD6FF, 0xB7FF, 0xD7FF, 0xD8FF, 0xD8FF, 0xD9FF, 0xFAFF,
+  0xDAFF, 0xFBFF, 0xDBFF, 0xFBFF, 0xDAFF, 0xFAFF, 0xD9FF, 0xD7FF,
+  0xAFF7, 0xCDFF, 0xACFF, 0xABFF, 0x8AF7, 0xA8FF, 0x88FF, 0x87F7,
+  0x86FF, 0xC239, 0xA010, 0x6010, 0x4008, 0x4008, 0x2000, 0x6902,
+  0x002B, 0x2000, 0x0000, 0x2000, 0x4008, 0x4008, 0x6010, 0xA010,
+  0xA118, 0x06C6, 0x87FF, 0xA8FF, 0xA8F7, 0xD4FF, 0xF6FF, 0xD7FF,
+  0xD7FF, 0xD8FF, 0xF9FF, 0xD9FF, 0xF9FF, 0xDAFF, 0xFAFF, 0xDAFF,
+  0xFAFF, 0xD9FF, 0xF9FF, 0xD8FF, 0xAFF7, 0xCDFF, 0xACFF, 0x8AFF,
+  0xC9FF, 0xA8FF, 0xA7FF, 0x87FF, 0xA7FF, 0x2231, 0xA010, 0x8010,
+  0x2008, 0x4008, 0x2008, 0x2000, 0x6A04, 0x0027, 0x2008, 0x4008,
+  0x4008, 0x8010, 0xA018, 0xC120, 0x6594, 0xA7FF, 0xA8FF, 0xA8FF,
+  0xB0FF, 0xD6FF, 0xF7FF, 0xD7FF, 0xD8FF, 0xD8FF, 0xD8FF, 0xF9FF,
+  0xD9FF, 0xF9FF, 0xD9FF, 0xF9FF, 0xD9FF, 0xF8FF, 0xD8FF, 0xB2F7,
+  0xCCFF, 0x8BFF, 0xAAFF, 0xC9F7, 0xA8FF, 0xA7FF, 0x87F7, 0xE7E6,
+  0x8010, 0x6010, 0x4008, 0x4008, 0x2000, 0x6B04, 0x0028, 0x2000,
+  0x4008, 0x4008, 0x6010, 0xA018, 0xC118, 0x424A, 0x87FF, 0xA8F7,
+  0xA8FF, 0xAFFF, 0xF6FF, 0xD7FF, 0xF7F7, 0xD7FF, 0xD8FF, 0xD8FF,
+  0xF8FF, 0xD8FF, 0xF8FF, 0xD9FF, 0xF8FF, 0xD8FF, 0xF8FF, 0xD7FF,
+  0xD2FF, 0xACFF, 0xCBFF, 0xAAFF, 0x89FF, 0xA8FF, 0xA7FF, 0x87FF,
+  0x65B5, 0xA018, 0x8010, 0x4008, 0x4008, 0x2000, 0x2000, 0x6C04,
+  0x0027, 0x2000, 0x2008, 0x4008, 0x4008, 0x8010, 0xA018, 0xC120,
+  0xE6E6, 0xA8FF, 0xA8FF, 0xAAFF, 0xD6FF, 0xF6FF, 0xD6FF, 0xF7FF,
+  0xD7FF, 0xF8FF, 0xD8FF, 0xF8FF, 0xD8FF, 0xF8FF, 0xD8FF, 0xF8FF,
+  0xD7FF, 0xF7FF, 0xD4FF, 0xCBF7, 0x8AFF, 0xC9FF, 0xA8FF, 0xA8F7,
+  0xA8FF, 0x87FF, 0x0363, 0x8010, 0x6010, 0x4008, 0x4008, 0x2000,
+  0x6D04, 0x0028, 0x2000, 0x2000, 0x4008, 0x4008, 0x6010, 0xA018,
+  0xA118, 0x458C, 0xA8F7, 0xA8FF, 0xC9FF, 0xD2FF, 0xD6FF, 0xF6FF,
+  0xD7F7, 0xF7FF, 0xD7FF, 0xD7FF, 0xD5FF, 0xB0FF, 0xF7FF, 0xD7FF,
+  0xF7F7, 0xD7FF, 0xD7FF, 0xD5FF, 0x8AFF, 0xCAF7, 0xC9FF, 0xA8FF,
+  0xA8FF, 0xC7FF, 0x47F7, 0xC120, 0x8010, 0x4008, 0x4008, 0x2008,
+  0x2000, 0x2000, 0x6E05, 0x0025, 0x2008, 0x4008, 0x4008, 0x4008,
+  0x8010, 0xA018, 0x6231, 0x68F7, 0xA8FF, 0xC9FF, 0xADFF, 0xF6FF,
+  0xD6FF, 0xF6FF, 0xD6FF, 0xF7FF, 0xD6FF, 0xCDFF, 0xADFF, 0xB0FF,
+  0xF7F7, 0xD7FF, 0xF7FF, 0xD6FF, 0xD4FF, 0xCAF7, 0xC9FF, 0xA9FF,
+  0xA8FF, 0xA8F7, 0xA8FF, 0xA49C, 0x8010, 0x8010, 0x4008, 0x4008,
+  0x2000, 0x6F04, 0x0027, 0x2000, 0x0000, 0x2000, 0x4008, 0x4008,
+  0x6010, 0xA018, 0x8010, 0x458C, 0xA8F7, 0xC9FF, 0xA9FF, 0xD4FF,
+  0xF6FF, 0xD6FF, 0xF6FF, 0xD6FF, 0xAFFF, 0xACFF, 0x26C6, 0xCBDE,
+  0xF6FF, 0xD7F7, 0xF6FF, 0xD6FF, 0xB2FF, 0xCAFF, 0xC9FF, 0xC9FF,
+  0xA8FF, 0xA8FF, 0x68F7, 0x2231, 0x8010, 0x4008, 0x4008, 0x2000,
+  0x2008, 0x2000, 0x7006, 0x0023, 0x2000, 0x2008, 0x4008, 0x4008,
+  0x8010, 0xA018, 0x0129, 0x68D6, 0xC9FF, 0xC9FF, 0xADFF, 0xF6FF,
+  0xD6FF, 0xF6FF, 0xD6FF, 0xCCFF, 0x4AEF, 0x2452, 0x6594, 0xB0FF,
+  0xD6FF, 0xF6FF, 0xD6FF, 0xAFFF, 0xC9FF, 0xC9F7, 0xA9FF, 0xC9FF,
+  0xA8FF, 0xC47B, 0x6008, 0x4008, 0x4008, 0x4008, 0x2000, 0x7107,
+  0x0022, 0x2000, 0x4008, 0x6008, 0x4008, 0x6010, 0xA010, 0xC239,
+  0x08E7, 0xC9FF, 0xC9FF, 0xB2FF, 0xF6FF, 0xD6FF, 0xD4FF, 0xCBFF,
+  0x69AD, 0xE239, 0x0363, 0xCBFF, 0xB2FF, 0xF6FF, 0xB2FF, 0xCAFF,
+  0xA9FF, 0xC9FF, 0xC9FF, 0xC9FF, 0x65B5, 0xA018, 0x8010, 0x4008,
+  0x4008, 0x2008, 0x2000, 0x7207, 0x0021, 0x2008, 0x2000, 0x4008,
+  0x4008, 0x8010, 0x8010, 0xA018, 0x6252, 0xA8FF, 0xC9FF, 0xC9FF,
+  0xB0FF, 0xB4FF, 0xACFF, 0xCAFF, 0xC47B, 0x6231, 0x8239, 0xAAFF,
+  0xEAFF, 0xCBFF, 0xCAFF, 0xC9FF, 0xA9FF, 0xC9FF, 0xA9F7, 0x45B5,
+  0x8010, 0x8008, 0x4008, 0x4008, 0x2000, 0x2008, 0x7308, 0x0020,
+  0x2008, 0x2000, 0x4008, 0x4008, 0x6010, 0x8010, 0x8010, 0x835A,
+  0x68EF, 0xCAFF, 0xCAFF, 0xCAFF, 0xCAFF, 0xEAFF, 0x6252, 0x2229,
+  0x0229, 0xC8DE, 0xCAF7, 0xCAFF, 0xCAFF, 0xCAFF, 0xC9FF, 0xA9FF,
+  0x6594, 0xA018, 0x8010, 0x4008, 0x2008, 0x4008, 0x2000, 0x2000,
+  0x7407, 0x001F, 0x2000, 0x0000, 0x2000, 0x2008, 0x4008, 0x4008,
+  0x8010, 0x8010, 0xA018, 0x6252, 0xA9FF, 0xCAFF, 0xCAFF, 0xCAFF,
+  0xA9F7, 0xE120, 0x0121, 0x0121, 0x65B5, 0xCAFF, 0xCAFF, 0xCAFF,
+  0xC9FF, 0xC8DE, 0x424A, 0x6008, 0x8010, 0x4008, 0x4008, 0x2000,
+  0x2008, 0x750A, 0x001D, 0x2008, 0x2000, 0x4008, 0x6008, 0x4008,
+  0x6010, 0x6010, 0xC239, 0x68D6, 0xCAFF, 0xEAFF, 0x45B5, 0xC118,
+  0xC120, 0xC120, 0xA35A, 0xCAFF, 0xA9F7, 0xA5C5, 0x236B, 0xA018,
+  0x8010, 0x6008, 0x4008, 0x2008, 0x4008, 0x2008, 0x2000, 0x2000,
+  0x760A, 0x001B, 0x2000, 0x2000, 0x2008, 0x4008, 0x2008, 0x4008,
+  0x6008, 0x8010, 0xA018, 0xC483, 0xC4A4, 0x2229, 0xA018, 0xA010,
+  0xA018, 0xA018, 0xE241, 0x0121, 0x6010, 0x8010, 0x6010, 0x4008,
+  0x4008, 0x4008, 0x2008, 0x2000, 0x2000, 0x770C, 0x0019, 0x2000,
+  0x2008, 0x2000, 0x4008, 0x4008, 0x4008, 0x4008, 0x8010, 0x6010,
+  0x8010, 0x6010, 0x8010, 0x6010, 0x8010, 0x6010, 0x8010, 0x6008,
+  0x4008, 0x2008, 0x4008, 0x4008, 0x2000, 0x2008, 0x0000, 0x2000,
+  0x780D, 0x0014, 0x2000, 0x2008, 0x2000, 0x2008, 0x4008, 0x2008,
+  0x4008, 0x4008, 0x4008, 0x6008, 0x4008, 0x6008, 0x4010, 0x6008,
+  0x4008, 0x4008, 0x4008, 0x2000, 0x2008, 0x2000, 0x790F, 0x0013,
+  0x2008, 0x2000, 0x2008, 0x2000, 0x2000, 0x4008, 0x2008, 0x4000,
+  0x2008, 0x4008, 0x2008, 0x4008, 0x2000, 0x2008, 0x2000, 0x2008,
+  0x2000, 0x0000, 0x2000, 0x7A0F, 0x0011, 0x2000, 0x0000, 0x2000,
+  0x0000, 0x2000, 0x2008, 0x2000, 0x2008, 0x2000, 0x2008, 0x2000,
+  0x2008, 0x2000, 0x2008, 0x2000, 0x0000, 0x2000, 0x7B12, 0x000B,
+  0x2000, 0x0000, 0x2000, 0x0000, 0x2000, 0x0000, 0x2000, 0x0000,
+  0x2000, 0x0000, 0x2000 };
@@ -0,0 +1,8463 @@
+#define IMG_WIDTH  105
+#define IMG_HEIGHT 92
+#define IMG_FRAMES 7
+#define IMG_DELAY  50
+
+const uint16_t frames[IMG_FRAMES][IMG_WIDTH * IMG_HEIGHT] = {
+  { 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6AA3, 0x9CE5, 0xCD85,
+    0x9CE5, 0x6CA6, 0x1842, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2042, 0x9AA3,
+    0x9CE5, 0xD585, 0x9CE5, 0x6AA3, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x64A6, 0xA6A7, 0xCF26,
+    0xCF26, 0xFF25, 0xCE86, 0xD686, 0xA2A3, 0x3242, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3242, 0x9AA3, 0xCC64,
+    0xF565, 0xFE65, 0xFE65, 0xFE85, 0xD565, 0x64A6, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xAEC7, 0xA6A7, 0xD726,
+    0xCF26, 0xF725, 0xCF26, 0xFF25, 0xF725, 0xF725, 0xFE65, 0xFE65,
+    0xCB84, 0x1842, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x1842, 0xA2A3, 0xFC85, 0xFC65, 0xFD85,
+    0xF565, 0xFD85, 0xFD65, 0xFE85, 0xF665, 0xF725, 0xFE65, 0xCE66,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8667, 0xD726, 0xCF26,
+    0xCF26, 0xF725, 0xFF25, 0xF725, 0xF725, 0xF725, 0xFF25, 0xF725,
+    0xFE65, 0xFE65, 0xFD85, 0xFD65, 0x3242, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x5084, 0xF365, 0xF365, 0xFC65, 0xF485, 0xFC65,
+    0xF485, 0xFD65, 0xFD85, 0xFD65, 0xF565, 0xFE65, 0xFE65, 0xFF25,
+    0xFE85, 0xCD65, 0x0000, 0x0000, 0x0000, 0x3222, 0xA6C7, 0xD726,
+    0xCF26, 0xF725, 0xCF26, 0xFF25, 0xF725, 0xF725, 0xFE65, 0xFE65,
+    0xFE65, 0xFE65, 0xF565, 0xFD85, 0xFD65, 0xFD85, 0xCC64, 0x62A3,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x90C4, 0xE9C5, 0xF285, 0xEA85, 0xF365, 0xFB65, 0xF365,
+    0xF365, 0xFC65, 0xF485, 0xFD65, 0xFD85, 0xFD65, 0xF585, 0xFE65,
+    0xFE65, 0xFE65, 0xF665, 0x1842, 0x0000, 0x0000, 0x64A6, 0xCF26,
+    0xCF26, 0xF725, 0xD666, 0xF725, 0xF725, 0xFF25, 0xF725, 0xF725,
+    0xF665, 0xFE85, 0xFD65, 0xFD85, 0xF565, 0xFD85, 0xFC65, 0xF485,
+    0xFB65, 0xFC85, 0x62A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x90C4, 0xE1C5, 0xE9C5, 0xF265, 0xE9C5, 0xEA85, 0xF265, 0xF365,
+    0xF365, 0xFC85, 0xF365, 0xF465, 0xFC85, 0xFD65, 0xF585, 0xFD65,
+    0xFD65, 0xFE65, 0xFE85, 0xFF25, 0x9AA3, 0x0000, 0x0000, 0xAEC7,
+    0xCF26, 0xFF25, 0xCD65, 0x0000, 0x9CE5, 0xF725, 0xFE65, 0xF725,
+    0xFE65, 0xFE65, 0xFD65, 0xFD85, 0xFD65, 0xF585, 0xFC65, 0xF485,
+    0xF365, 0xFB65, 0xF365, 0xF365, 0xF265, 0x62A3, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x90C4,
+    0xE906, 0xE165, 0xE165, 0xE9C5, 0xE9C5, 0xE9C5, 0xE9C5, 0xEA85,
+    0xF265, 0xF365, 0xF365, 0xF365, 0xF365, 0xFC85, 0xFC65, 0xF585,
+    0xFD65, 0x62A3, 0x0000, 0xFE85, 0xFE65, 0xCD65, 0x0000, 0x62A3,
+    0xD686, 0xF725, 0xF725, 0xFF25, 0x64A6, 0xCC64, 0xCD65, 0xF725,
+    0xFE85, 0xD464, 0x1842, 0xFD85, 0x62A3, 0xCC64, 0xF485, 0xFC65,
+    0xF365, 0xFC85, 0xF365, 0xF365, 0xF265, 0xF285, 0xE9C5, 0xCA64,
+    0x5084, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x90E4, 0xE108,
+    0xE906, 0xE165, 0xE106, 0xE165, 0xE145, 0xE9C5, 0xE9C5, 0xEA65,
+    0xE9C5, 0xF285, 0xEA65, 0xF285, 0xCB84, 0x62A3, 0xF365, 0xFC65,
+    0xFC85, 0xFD65, 0x62A3, 0x62A3, 0xFD65, 0xFE65, 0xD686, 0x62A3,
+    0x62A3, 0xD726, 0xCF26, 0xFF25, 0xF725, 0xF725, 0xD686, 0x0000,
+    0xCC64, 0xFE65, 0x62A3, 0x0000, 0x9AA3, 0x9AA3, 0x0000, 0x62A3,
+    0xFB65, 0xFB65, 0xEA85, 0xF285, 0xEA65, 0xF285, 0xE9C5, 0xE9C5,
+    0xE1A6, 0xE9C5, 0xC165, 0x5084, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5884, 0xC88A, 0xE8C8,
+    0xE0C8, 0xE0E7, 0xE0E7, 0xE906, 0xE106, 0xE165, 0xC185, 0xE945,
+    0xE1A6, 0xE9C5, 0x1842, 0x0000, 0xC185, 0x62A3, 0x0000, 0xCB84,
+    0xFB65, 0x9AC3, 0x5884, 0xFD85, 0xFD65, 0xFD85, 0xFD65, 0xFE85,
+    0x62A3, 0x9CE5, 0xD746, 0xF725, 0xF725, 0xF725, 0x0000, 0x3222,
+    0xFE65, 0xFE65, 0xFE65, 0xFD85, 0x0000, 0x3242, 0xCB84, 0x0000,
+    0x0000, 0xF365, 0xFB65, 0xF365, 0x90C4, 0xCA84, 0xE9C5, 0xE9C5,
+    0xE1A6, 0xE9C5, 0xE145, 0xE165, 0xE926, 0xE906, 0x1842, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x5884, 0xE0AA, 0xE0A8, 0xE0AA,
+    0xE8C8, 0xE0E7, 0xE0E7, 0xE0E7, 0xE8E7, 0xE906, 0x90E4, 0x90C4,
+    0xE165, 0xE9C5, 0xC965, 0x0000, 0x5884, 0xCA64, 0x0000, 0x1842,
+    0xF365, 0xFC65, 0xF365, 0xD484, 0x1842, 0x9AA3, 0xF565, 0xFE85,
+    0xFD65, 0xCC64, 0x9CE5, 0xF725, 0xFF25, 0xF725, 0xF725, 0x9CE5,
+    0x0000, 0x3222, 0xFD65, 0xFE85, 0xFD65, 0xFD65, 0xCB84, 0xFC85,
+    0x9AA3, 0x0000, 0x9AA3, 0x90E4, 0xF285, 0xF265, 0x5084, 0x90C4,
+    0xE965, 0xE9C5, 0xE145, 0xE965, 0xE106, 0xE106, 0xE0E7, 0xE8E7,
+    0xC0C6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x1842, 0xC8AA, 0xE8AC, 0xE0AA, 0xE0AA,
+    0xE0C8, 0xE8AA, 0xE0A8, 0xE0C8, 0xE0A8, 0xE8E7, 0x5084, 0x90E4,
+    0xE906, 0x90E4, 0x5884, 0x98C4, 0x0000, 0xC185, 0xC165, 0x98E4,
+    0xF285, 0xF365, 0xF365, 0xFB65, 0x0000, 0x0000, 0xCB84, 0xFD65,
+    0xF585, 0xFE65, 0x9CE5, 0xA6C7, 0xF725, 0xFF25, 0xF725, 0xF725,
+    0xD686, 0x64A6, 0x62A3, 0xCD65, 0xFD85, 0xFD65, 0xF485, 0xFC65,
+    0xFC85, 0xFC85, 0x90C4, 0x62A3, 0x0000, 0xCA64, 0xE9C5, 0xE9C5,
+    0x0000, 0x5884, 0xE165, 0xE165, 0xE106, 0xE906, 0xE0E7, 0xE0E7,
+    0xE0C8, 0xE8A8, 0xE8C8, 0x5884, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x588B, 0xE0AC, 0xE0AC, 0xE0AC, 0xE8AC,
+    0xE0AA, 0xE108, 0xE0AA, 0xE0AA, 0xE8C8, 0xE8E7, 0x1842, 0x5884,
+    0xE0E7, 0xE906, 0x5884, 0x5884, 0x5884, 0x5064, 0xE1C5, 0xE9C5,
+    0xE9C5, 0xF285, 0xEA85, 0xFB65, 0xCA64, 0x9AA3, 0x62A3, 0xFC65,
+    0xF485, 0xFD65, 0xFD85, 0xCC64, 0x9CE5, 0xFF25, 0xF725, 0xF725,
+    0xFE65, 0xFE65, 0xCD65, 0xCC64, 0xCD85, 0xFD65, 0x9AA3, 0x62A3,
+    0x6AA3, 0xFB65, 0xF365, 0xF365, 0xF285, 0x0000, 0xC165, 0x90E4,
+    0x90C4, 0xE9A6, 0x90E4, 0xC185, 0x1842, 0xE906, 0xE8E7, 0xE0E7,
+    0xE8C8, 0xE0A8, 0xE0C8, 0xE0AA, 0xE8AA, 0x986B, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x988B, 0xE8AC, 0xE0AE, 0xE0AC, 0xE8AC,
+    0xE0AC, 0xE0AC, 0xE0AA, 0xE8AA, 0x986B, 0x90E4, 0xC0C6, 0x90C4,
+    0xE8C8, 0xC0C6, 0x90C4, 0x5884, 0x0000, 0xE965, 0xE145, 0xE965,
+    0xC165, 0x90E4, 0x5884, 0xCA64, 0xF285, 0xCA64, 0xCA64, 0xF365,
+    0xFC65, 0xF485, 0xFC65, 0xFD85, 0xCB84, 0x64A6, 0xF725, 0xF725,
+    0xF725, 0xFF25, 0xFE65, 0x3242, 0x62A3, 0xFD65, 0xD585, 0x9AC3,
+    0x9AA3, 0x9AC3, 0xFB65, 0xCA64, 0x5064, 0xF285, 0xE9C5, 0xE9C5,
+    0x90E4, 0x0000, 0xC165, 0xE965, 0xC0C6, 0x5884, 0xC0C6, 0x1842,
+    0x90C4, 0xE8AA, 0xE0C8, 0xE0AA, 0xE0AA, 0xE8AC, 0xE0AA, 0xC88A,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0xC8AE, 0xE0AE, 0xE8AE, 0xE0AE, 0xE0AE,
+    0xE0AC, 0xE8AE, 0xE8AC, 0x986B, 0x5884, 0xC0C6, 0x1842, 0xE0C8,
+    0xE8C8, 0xE0E7, 0x0000, 0xC0C6, 0xC0C6, 0xE106, 0xE906, 0x90E4,
+    0xC965, 0xC185, 0x5884, 0x5084, 0xC165, 0xF265, 0xF285, 0x5884,
+    0x9AA3, 0xF485, 0xFC65, 0xF585, 0xFC65, 0x62A3, 0x1842, 0xD686,
+    0xFF25, 0xFF25, 0xFE65, 0xFE65, 0x9AA3, 0x0000, 0xF465, 0xFC85,
+    0x0000, 0x0000, 0x0000, 0x5064, 0x90E4, 0x0000, 0x98C4, 0xC185,
+    0xE9C5, 0xE945, 0x0000, 0x0000, 0xE106, 0xE126, 0xE8E7, 0xE0E7,
+    0xE0C8, 0xE0E7, 0xE8A8, 0xE0AA, 0xE0AA, 0xE0AC, 0xE8AA, 0xE0AC,
+    0xE0AC, 0xC8AE, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0xC88E, 0xE8AE, 0xE0B0, 0xE0AE, 0xE0AE,
+    0xE8AE, 0xE0AE, 0xE0AC, 0xE0AC, 0xC88A, 0xE8AC, 0xE0AA, 0xE0AA,
+    0xE0AA, 0xE8C8, 0x0000, 0x0000, 0xC88A, 0xE0E7, 0xC0C6, 0x90E4,
+    0x0000, 0x90E4, 0x0000, 0x0000, 0x0000, 0x5884, 0xE9C5, 0xCA64,
+    0x0000, 0xFB65, 0xF365, 0xFC85, 0xF465, 0xCC84, 0x0000, 0x0000,
+    0x62A3, 0xF725, 0xF665, 0xFE65, 0xFE85, 0xFD65, 0x0000, 0xFD85,
+    0xFC85, 0x9AA3, 0x9AA3, 0xCA64, 0xCA64, 0xF285, 0xC185, 0xCA64,
+    0x1842, 0xE145, 0xE965, 0xC0C6, 0x0000, 0xC0C6, 0xE0E7, 0xE0E7,
+    0xE8C8, 0xC0C6, 0xC0C6, 0xC88A, 0x986B, 0xE0AC, 0xE0AC, 0xE8AC,
+    0xE0AC, 0xE0AE, 0xE8AE, 0xC8AE, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0xC8B1, 0xE0B0, 0xE0B0, 0xE0B0, 0xE0B0,
+    0xE0AE, 0xE0B0, 0xE8AE, 0xC88E, 0xC8AE, 0xE0AE, 0xC8AE, 0xE8AC,
+    0xE0AA, 0xE108, 0x0000, 0x0000, 0xC88A, 0xE908, 0x90C4, 0x98E4,
+    0x90C4, 0x90E4, 0xC8C6, 0x90C4, 0x98E4, 0x62A3, 0x5064, 0xF285,
+    0xC165, 0x0000, 0xF365, 0xFB65, 0xF365, 0xFC85, 0x3222, 0x0000,
+    0x0000, 0x0000, 0xD565, 0xFE65, 0xFE65, 0xFE65, 0xF565, 0xFD85,
+    0xFC65, 0xF485, 0xF365, 0xF365, 0x5864, 0x5884, 0xCA64, 0xE9C5,
+    0x90E4, 0x90C4, 0x5884, 0xC985, 0xE906, 0x90E4, 0x1842, 0xE8E7,
+    0xE0A8, 0xE8C8, 0x5084, 0x0000, 0x0000, 0x0000, 0x0000, 0xC88A,
+    0xE8AC, 0xE0AE, 0xE0AC, 0xE8AE, 0xE0AE, 0xC8AE, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x5084, 0x1842, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x2042, 0x5884, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0xD08E, 0xC8B1, 0xE8B0, 0xE0B0, 0xE0B0,
+    0xE0B0, 0xE0B0, 0xC8AE, 0x0000, 0x0000, 0x0000, 0x0000, 0x90C4,
+    0xE8AC, 0xE0AC, 0x988B, 0x0000, 0xC88A, 0xE8AA, 0xC0C6, 0x5084,
+    0x98E4, 0xC0C6, 0xE8E7, 0xE106, 0x5084, 0x98E4, 0xE945, 0xE9C5,
+    0xE9C5, 0xEA85, 0xE9C5, 0xEA85, 0xF265, 0xF365, 0xCB84, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x62A3, 0xF665, 0xFE85, 0xFD65, 0xFD85,
+    0xFC85, 0xCB84, 0x90C4, 0x9AA3, 0xF285, 0xCB84, 0xF285, 0x62A3,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x90C4, 0xE0E7, 0xE8E7,
+    0xE0C8, 0x90C4, 0x0000, 0xE8AA, 0xC0C6, 0x0000, 0x0000, 0x0000,
+    0x0000, 0xE0AC, 0xC8AE, 0xC88E, 0xE8AE, 0xE0B0, 0xE0B0, 0xB0D1,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xC8B1, 0xA8B1, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0xB0D1, 0xA8B1, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0xB0D1, 0xC8B1, 0xE0B0, 0xE0B0, 0xE0B0,
+    0xC8B1, 0xE0B0, 0xC8AE, 0x0000, 0x0000, 0x0000, 0x0000, 0xC88A,
+    0xE0AE, 0x0000, 0xC8AA, 0xE8AC, 0xC88A, 0xE8AC, 0x5884, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x5884, 0x90E4, 0xD127, 0xE106, 0xE945,
+    0x90E4, 0x90C4, 0xE1A6, 0xF285, 0xEA65, 0xFB65, 0xF365, 0x3242,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCD65, 0xFD65, 0xFD85,
+    0xFC65, 0x9AA3, 0x0000, 0x0000, 0x0000, 0x0000, 0x1842, 0xF285,
+    0xE1A6, 0x1842, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xC8C6,
+    0xE8C8, 0xE0A8, 0x988B, 0x0000, 0x0000, 0xC88A, 0xC88A, 0x0000,
+    0x0000, 0x0000, 0x1842, 0xD0AE, 0x988B, 0xA06B, 0xE0AE, 0xE0B0,
+    0xE0B0, 0x988B, 0x0000, 0x0000, 0x0000, 0x0000, 0x5884, 0xD0B1,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA8B1, 0x1842, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x608B, 0xD0B1, 0xC8B1, 0xC8B1, 0xD0B1,
+    0xA8D1, 0xC8B1, 0xA06B, 0x0000, 0x0000, 0x0000, 0x0000, 0xC8AE,
+    0xE8AE, 0x1842, 0x0000, 0xC88E, 0xE8AC, 0xE0AC, 0x90E4, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE8E7, 0xE0E7, 0x5084,
+    0x0000, 0x0000, 0x0000, 0x0000, 0xC965, 0xF285, 0xF285, 0xCA64,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3222, 0xFE65,
+    0xFD85, 0xFD85, 0x9AA3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0xCA64, 0xE9C5, 0x5084, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0xE108, 0xE0C8, 0xE8AA, 0x5084, 0x0000, 0x0000, 0xC88A,
+    0xE8AC, 0x5884, 0x0000, 0x0000, 0x0000, 0xC8AE, 0xD08E, 0x5884,
+    0xC8AE, 0xE0B0, 0xE0B0, 0x608B, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x986B, 0xA08B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x588B, 0xA06B, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x588B, 0xB0D1, 0xC8B1, 0xC8B1, 0xC88E,
+    0xA08B, 0xC8B1, 0xB0B1, 0x0000, 0x0000, 0x0000, 0x5084, 0xE0B0,
+    0xD0AE, 0x0000, 0x0000, 0x986B, 0xE0AE, 0xE8AE, 0xD0AE, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x1842, 0xE108, 0x90C4, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9AA3, 0xEA85, 0xF265,
+    0x1842, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0xD585, 0xFD65, 0xFC85, 0xCB84, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x1842, 0x90C4, 0x90C4, 0xE965, 0xE945, 0x5084, 0x0000, 0x0000,
+    0x1842, 0x2042, 0xC0C6, 0xE8AA, 0xE0AA, 0xE8AA, 0x1842, 0x0000,
+    0x0000, 0x588B, 0xD0AE, 0x986B, 0x0000, 0x0000, 0x0000, 0xA08B,
+    0xC8B1, 0x588B, 0xA06B, 0xC8B1, 0xC8B1, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x608B, 0x608B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x588B, 0x190B,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x90D1, 0xB0D1, 0xB0D1, 0x986B,
+    0xA08B, 0xC8B1, 0x986B, 0x0000, 0x0000, 0x0000, 0xA08B, 0xC8B1,
+    0x5884, 0x0000, 0x0000, 0x5884, 0xE8AE, 0xE0AE, 0xE0AC, 0x90C4,
+    0x0000, 0x1842, 0x0000, 0x0000, 0x5884, 0xE8AA, 0xE8C8, 0xC0C6,
+    0x90C4, 0x1842, 0x0000, 0x0000, 0x0000, 0x0000, 0xC985, 0xE9C5,
+    0xE9C5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0xFD85, 0xFC65, 0xF485, 0xFB65, 0x0000, 0x0000, 0x0000,
+    0x5884, 0x6AA3, 0x5884, 0x1842, 0x0000, 0xC185, 0xE126, 0xE906,
+    0xE0E7, 0xE108, 0xE0C8, 0xC88A, 0xC88A, 0xE0AC, 0xE8AA, 0xE0AC,
+    0xA08B, 0x0000, 0x986B, 0xE0AE, 0xE0AE, 0xE8B0, 0x988B, 0x0000,
+    0x0000, 0x608B, 0xC8B1, 0xC88E, 0xA08B, 0xD0B1, 0x90D1, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x78F1, 0x1842, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x190B, 0x6111,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x78D1, 0xB0D1, 0x90D1, 0x78F1,
+    0x88D1, 0xB0D1, 0x608B, 0x0000, 0x0000, 0x986B, 0xC8B1, 0xE0B0,
+    0xD0B1, 0x1842, 0x0000, 0xC8AE, 0xE0B0, 0xE0B0, 0xE0AE, 0xE8AE,
+    0xC88E, 0xE0AE, 0xE0AC, 0xE8AC, 0xC8AE, 0xE8AC, 0x986B, 0x0000,
+    0x98E4, 0xC0C6, 0xC0C6, 0x5084, 0x0000, 0x0000, 0x0000, 0xE9C5,
+    0xE9C5, 0x9AA3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x9AA3, 0xF485, 0xFC65, 0xF485, 0x1842, 0x0000,
+    0x98C4, 0x9AA3, 0x0000, 0x0000, 0x0000, 0x0000, 0x90E4, 0xE906,
+    0xE8E7, 0xE0E7, 0xE0C8, 0xE0A8, 0xC88A, 0x90E4, 0x0000, 0x5884,
+    0xC88A, 0xE8AE, 0xE0AC, 0xE8AE, 0x588B, 0x1842, 0xD0AE, 0xE0B0,
+    0xE0B0, 0x988B, 0x0000, 0x0000, 0xD08E, 0xC8B1, 0xA8D1, 0xB0B1,
+    0x588B, 0x0000, 0x0000, 0x0000, 0x608B, 0x78F1, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x608B,
+    0x190B, 0x0000, 0x0000, 0x0000, 0x210B, 0x90D1, 0x78F1, 0x90D1,
+    0x90D1, 0x88F1, 0x0000, 0x0000, 0x608B, 0xB0D1, 0xA8B1, 0xC8AE,
+    0x5884, 0xD0B1, 0xC8B1, 0xE0B0, 0xE0B0, 0xE0B0, 0x986B, 0x98E4,
+    0x986B, 0xE8AE, 0xE0AC, 0xE8AE, 0xE0AC, 0xE0AC, 0xE0AA, 0x5884,
+    0x0000, 0x0000, 0x0000, 0x5884, 0x90E4, 0x5884, 0x0000, 0x98C4,
+    0xE965, 0xE9C5, 0x90C4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x62A3, 0xFC65, 0xFC85, 0xFB65, 0x6AA3,
+    0x1842, 0xCA64, 0x0000, 0x0000, 0x0000, 0x0000, 0x90E4, 0xE106,
+    0xE0E7, 0xE8E7, 0x90E4, 0xE0A8, 0xE0C8, 0xE108, 0xE8AA, 0xC88A,
+    0x0000, 0x0000, 0x1842, 0xE8AE, 0xE8AE, 0x90E4, 0x0000, 0x0000,
+    0x5884, 0xE0B0, 0xC8B1, 0xE0B0, 0xA06B, 0x90E4, 0xA8D1, 0xD0B1,
+    0x90D1, 0xB0B1, 0x1842, 0x0000, 0x0000, 0x2042, 0x608B, 0x1842,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x210B,
+    0x608B, 0x0000, 0x0000, 0x0000, 0x1842, 0x78F1, 0x78D1, 0x78F1,
+    0x78D1, 0x78F1, 0x1842, 0x78F1, 0x90D1, 0xB0B1, 0xA8D1, 0xA06B,
+    0x0000, 0x0000, 0x988B, 0xE0B0, 0xC8B1, 0x5884, 0x0000, 0x0000,
+    0x988B, 0xE0B0, 0xE0AE, 0xE8AE, 0xE0AC, 0xC88A, 0xE0AC, 0xE0AC,
+    0xE8AA, 0x0000, 0x0000, 0x0000, 0x0000, 0x5884, 0x90E4, 0x0000,
+    0xC0C6, 0xE9A6, 0xE9C5, 0x5084, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x1842, 0xFC85, 0xF365, 0xFB65,
+    0xCA64, 0x9AA3, 0x5084, 0x0000, 0x0000, 0x0000, 0x0000, 0xE906,
+    0xE108, 0xE0E7, 0x90E4, 0xC0C6, 0x0000, 0x5884, 0xE8AA, 0xE0AC,
+    0xE8AC, 0xE0AC, 0x1842, 0x0000, 0x5884, 0xE0B0, 0xE8AE, 0xC88E,
+    0x0000, 0x0000, 0x0000, 0xC8B1, 0xC8B1, 0xC8B1, 0xA08B, 0xA8B1,
+    0xB0D1, 0x88D1, 0x608B, 0x78F1, 0x0000, 0x0000, 0x0000, 0x608B,
+    0x190B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x190B, 0x608B, 0x0000, 0x0000, 0x0000, 0x6911, 0x6111, 0x608B,
+    0x6111, 0x78D1, 0x78F1, 0x78D1, 0x90D1, 0x90F1, 0x90D1, 0x1842,
+    0x0000, 0x0000, 0xA08B, 0xC8B1, 0xC8B1, 0x608B, 0x0000, 0x1842,
+    0xE8B0, 0xE0B0, 0xE8AE, 0xE0B0, 0x5084, 0x608B, 0x988B, 0xD08E,
+    0xE0AC, 0xE8AC, 0x988B, 0x0000, 0x0000, 0x0000, 0x0000, 0x90C4,
+    0x5884, 0xE906, 0xE126, 0xE165, 0x1842, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFC65, 0xFC85,
+    0xF365, 0xFB65, 0xD284, 0x1842, 0x0000, 0x0000, 0x0000, 0x5084,
+    0xE106, 0xE106, 0xE8E7, 0xC8C6, 0x1842, 0x0000, 0x0000, 0x5084,
+    0xE8AC, 0xE0AE, 0xE0AC, 0xE8AE, 0x5884, 0x5884, 0xE0B0, 0xE0B0,
+    0xE0B0, 0xE0B0, 0xC8AE, 0x5884, 0x0000, 0xD0B1, 0xB0D1, 0x1842,
+    0x0000, 0x88D1, 0x90F1, 0x90D1, 0x78F1, 0x608B, 0x0000, 0x0000,
+    0x2042, 0x4931, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x5151, 0x1842, 0x0000, 0x0000, 0x608B, 0x4931, 0x4951,
+    0x6111, 0x6911, 0x6111, 0x210B, 0x190B, 0x88D1, 0x78D1, 0x0000,
+    0x0000, 0x78F1, 0xB0B1, 0xA8D1, 0xB0B1, 0xC8B1, 0x0000, 0x608B,
+    0xC8B1, 0xE0B0, 0xE0B0, 0xE8B0, 0x1842, 0x0000, 0x0000, 0x988B,
+    0xC8AE, 0xE0AE, 0xE8AC, 0xE8AC, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x5084, 0xE106, 0xE106, 0xE965, 0xE945, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF365,
+    0xF365, 0xF365, 0xF285, 0xEA65, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0xE106, 0xE8E7, 0xE0E7, 0xE0C8, 0x986B, 0x1842, 0x0000,
+    0x0000, 0x5884, 0xE8AC, 0xE8AE, 0xE0AE, 0xE0B0, 0xC8AE, 0xE0B0,
+    0xC88E, 0x988B, 0xD0B1, 0xC8B1, 0xC8B1, 0xD0B1, 0xA8B1, 0xB0D1,
+    0x88D1, 0x0000, 0x0000, 0x1842, 0x78F1, 0x78D1, 0x6911, 0x0000,
+    0x0000, 0x0000, 0x190B, 0x210B, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x190B, 0x210B, 0x0000, 0x0000, 0x0000, 0x4931, 0x4951,
+    0x5131, 0x6111, 0x2042, 0x0000, 0x0000, 0x78F1, 0x6111, 0x6111,
+    0x608B, 0x90D1, 0x90F1, 0x90D1, 0x588B, 0xB0D1, 0xB0D1, 0xA8B1,
+    0xC8B1, 0xE8B0, 0xC8B1, 0xE0B0, 0x1842, 0x0000, 0x0000, 0x1842,
+    0xA08B, 0xE8AE, 0xE0AC, 0xE8AC, 0xC88A, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x5084, 0xE8E7, 0xE106, 0xE126, 0xE906, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0xCB84, 0xFC85, 0xF365, 0xFB65, 0xE9C5, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x90E4, 0xE108, 0xE0A8, 0xE0AA, 0xE8AA, 0xE0AA,
+    0xD0AE, 0xC88A, 0x5084, 0xE0AC, 0xE8AE, 0xE0B0, 0xE0AE, 0xE0B0,
+    0xE0B0, 0xE0B0, 0xE0B0, 0xE0B0, 0xD0B1, 0xC8B1, 0xA8D1, 0xB0B1,
+    0xB0D1, 0xB0B1, 0x608B, 0x0000, 0x0000, 0x1842, 0x78F1, 0x6111,
+    0x608B, 0x0000, 0x0000, 0x210B, 0x190B, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x210B, 0x210B, 0x0000, 0x0000, 0x190B, 0x5151,
+    0x4931, 0x4951, 0x0000, 0x0000, 0x0000, 0x4931, 0x6111, 0x6111,
+    0x6111, 0x78D1, 0x78F1, 0x90F1, 0x90D1, 0xA8B1, 0xB0D1, 0xA8B1,
+    0xB0D1, 0xC8B1, 0xC8B1, 0xE0B0, 0xA06B, 0x0000, 0x588B, 0xC8AE,
+    0xE0AE, 0xE0B0, 0xE0AE, 0xE8AE, 0xE8AC, 0x5884, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x5084, 0xE108, 0xE0E7, 0xE165, 0xC0C6, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x9AA3, 0xF365, 0xF365, 0xF285, 0xEA65, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0xE0E7, 0xE8A8, 0xE0C8, 0xE0A8, 0xE0AA,
+    0xE8AA, 0xE0AC, 0xE0AC, 0xE0AC, 0xE8AC, 0xE0AE, 0xE0AE, 0xE0B0,
+    0xE0B0, 0xE0B0, 0xC8B1, 0xE0B0, 0xC8B1, 0xC8B1, 0xB0D1, 0xA8B1,
+    0xB0D1, 0xA8B1, 0x90D1, 0x90F1, 0x1842, 0x0000, 0x0000, 0x6111,
+    0x4931, 0x4951, 0x2042, 0x0000, 0x0000, 0x4931, 0x2042, 0x0000,
+    0x0000, 0x0000, 0x1842, 0x210B, 0x0000, 0x0000, 0x2042, 0x3191,
+    0x2991, 0x3191, 0x190B, 0x0000, 0x0000, 0x210B, 0x4951, 0x4931,
+    0x5151, 0x6111, 0x6911, 0x78F1, 0x78D1, 0x90D1, 0x90F1, 0xA8D1,
+    0xB0B1, 0xA8D1, 0xB0B1, 0xC8B1, 0xC8B1, 0xE0B0, 0xC8B1, 0xE8B0,
+    0xE0B0, 0xE0B0, 0xE0AE, 0xE0AE, 0xE8AC, 0xE0AC, 0x90E4, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x90C4, 0xE8C8, 0xE0E7, 0xE108, 0x90C4,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x5064, 0xF365, 0xF285, 0xF285, 0xE9C5, 0x90C4,
+    0x0000, 0x0000, 0x0000, 0x90E4, 0xE8E7, 0xC0C6, 0x0000, 0x90C4,
+    0x988B, 0xE0AA, 0xE8AC, 0xE0AC, 0xE0AC, 0xE0AE, 0xE8AE, 0xE0B0,
+    0xE0B0, 0xE0B0, 0xE0B0, 0xC8B1, 0xB0B1, 0xC8AE, 0xB0B1, 0xA8D1,
+    0xB0B1, 0xB0D1, 0x90F1, 0x90D1, 0x78D1, 0x78F1, 0x0000, 0x0000,
+    0x4951, 0x608B, 0x1842, 0x5131, 0x0000, 0x0000, 0x190B, 0x3191,
+    0x0000, 0x0000, 0x0000, 0x3191, 0x190B, 0x0000, 0x0000, 0x3191,
+    0x3191, 0x0000, 0x3191, 0x3191, 0x0000, 0x190B, 0x5151, 0x4931,
+    0x4931, 0x6111, 0x6111, 0x6111, 0x6111, 0x78F1, 0x78F1, 0x90D1,
+    0x90D1, 0xA8D1, 0xB0B1, 0xC8B1, 0xA8D1, 0xC8B1, 0xC8B1, 0xE0B0,
+    0xE0B0, 0xE0B0, 0xE0B0, 0xE8AE, 0x5884, 0x90E4, 0xE0AC, 0xE8AC,
+    0x0000, 0x0000, 0x0000, 0x0000, 0xC0C6, 0xE108, 0xE0E7, 0xE906,
+    0x5884, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x1842, 0xFA85, 0xF285, 0xE9C5, 0xE9C5,
+    0xE1A6, 0x90C4, 0x0000, 0x0000, 0x90E4, 0xE8E7, 0x1842, 0x0000,
+    0x0000, 0x0000, 0x986B, 0xE8AC, 0xE8AC, 0xC88A, 0xC8AA, 0xC8AE,
+    0x986B, 0x988B, 0x1842, 0x2042, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x1842, 0x78D1, 0x78F1, 0x78D1, 0x6911, 0x6111,
+    0x210B, 0x4931, 0x0000, 0x0000, 0x3191, 0x190B, 0x0000, 0x0000,
+    0x210B, 0x1842, 0x0000, 0x2042, 0x210B, 0x0000, 0x0000, 0x190B,
+    0x3191, 0x3191, 0x0000, 0x190B, 0x3191, 0x2042, 0x3191, 0x3191,
+    0x2991, 0x4951, 0x210B, 0x190B, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x5884, 0x2042, 0x608B, 0xA08B, 0xA8B1, 0xB0D1, 0xC8B1,
+    0xC88E, 0xE8B0, 0xE0B0, 0x988B, 0x0000, 0x0000, 0x0000, 0x986B,
+    0xE8AC, 0x5084, 0x0000, 0x0000, 0x98E4, 0xE8A8, 0xE0C8, 0xE0E7,
+    0xE8E7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF365, 0xEA65, 0xF285,
+    0xE9C5, 0xE9C5, 0xE165, 0xE145, 0xC0C6, 0xD127, 0xE8E7, 0xE0C8,
+    0xC8AA, 0xE0AA, 0xE0AA, 0xE8AC, 0xE0AC, 0xE8AE, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x608B, 0x6111,
+    0x6111, 0x6911, 0x4931, 0x2042, 0x0000, 0x4931, 0x3191, 0x0000,
+    0x0000, 0x0A0E, 0x210B, 0x0000, 0x190B, 0x09EE, 0x0000, 0x0000,
+    0x21F2, 0x1A53, 0x2042, 0x0000, 0x1842, 0x2212, 0x3191, 0x2212,
+    0x3191, 0x5131, 0x1842, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x588B, 0xE0B0, 0xE0B0, 0xE0B0, 0xE0B0, 0x988B, 0xC88E,
+    0xE8AE, 0xE8AE, 0x988B, 0x986B, 0xE0AA, 0xE0AA, 0xE8C8, 0xE0A8,
+    0xE0C8, 0xE106, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xC165, 0xF285,
+    0xE9C5, 0xE9C5, 0xE145, 0xE165, 0xE106, 0xE106, 0xE8E7, 0xE0C8,
+    0xE0C8, 0xE0AA, 0xE8A8, 0xE0AA, 0xE0AA, 0xE0AC, 0xE8AC, 0x988B,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x4931, 0x4931, 0x4951, 0x3191, 0x0000, 0x1842, 0x3191,
+    0x1842, 0x0000, 0x0000, 0x2212, 0x2212, 0x21F2, 0x0000, 0x0000,
+    0x2042, 0x1A53, 0x2212, 0x0000, 0x0000, 0x2212, 0x21F2, 0x2212,
+    0x3191, 0x1842, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0xB0B1, 0xE8B0, 0xC8B1, 0xE0B0, 0xE8AE, 0xE0B0,
+    0xE0AE, 0xE0AE, 0xE8AC, 0xE0AC, 0xE0AA, 0xE0AC, 0xE8C8, 0xE0AA,
+    0xE0A8, 0xE0E7, 0x90E4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x62A3,
+    0xF265, 0xEA85, 0xE9C5, 0xE9C5, 0xE165, 0xE145, 0xE8E7, 0xE0E7,
+    0xE0C8, 0xE0C8, 0xC88A, 0xE8AA, 0xE0AA, 0xE8AC, 0x988B, 0xE0AE,
+    0xE8AE, 0x608B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x608B, 0x3191, 0x4931, 0x3191, 0x0000,
+    0x3191, 0x2212, 0x0000, 0x09EE, 0x1A53, 0x1AB4, 0x1A53, 0x09EE,
+    0x0000, 0x1A53, 0x12D4, 0x09EE, 0x0000, 0x1AB4, 0x1A53, 0x1A53,
+    0x190B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x588B, 0xD0B1, 0xC8B1, 0x70D1, 0xE0B0, 0xE0B0,
+    0xE8AE, 0xE0AE, 0xE0AE, 0xE0AE, 0xE8AC, 0xE0AC, 0xE0AA, 0xE0AA,
+    0xE8C8, 0xE0AA, 0xE8A8, 0x5884, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x1842, 0xF285, 0xE9C5, 0xE9C5, 0xE145, 0xE145, 0xE108, 0xE8E7,
+    0xE0C8, 0xE0A8, 0x5084, 0x0000, 0x5884, 0xE8AC, 0xE8AC, 0xE0AC,
+    0xE0AE, 0xE0AE, 0xC8AE, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x190B, 0x3191, 0x3191,
+    0x09EE, 0x1842, 0x2212, 0x2042, 0x210B, 0x12B4, 0x12B4, 0x1AB4,
+    0x210B, 0x1842, 0x1AB4, 0x12B4, 0x0000, 0x1AB4, 0x12B4, 0x1AB4,
+    0x190B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x2042, 0xD0B1, 0xC8B1, 0xD0B1, 0xA8B1, 0xE0B0,
+    0xC8B1, 0x5884, 0x1842, 0xD0AE, 0xE8AE, 0xE0AE, 0xE8AC, 0xE0AC,
+    0xE0AA, 0xE0AA, 0xE8A8, 0xE0C8, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0xE9C5, 0xE9C5, 0xE1A6, 0xE1C6, 0xE106, 0xE906,
+    0xE0E7, 0xE108, 0xE0C8, 0xE8A8, 0x90E4, 0xE108, 0xE0AC, 0xE0AE,
+    0xE8AC, 0xE8AE, 0x986B, 0x988B, 0xE88E, 0x2042, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3191,
+    0x2212, 0x2212, 0x09EE, 0x120E, 0x09EE, 0x190B, 0x1AB4, 0x1356,
+    0x12B4, 0x2042, 0x1A53, 0x0B56, 0x2042, 0x0B33, 0x0B56, 0x1356,
+    0x210B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1842, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x1842, 0xB0B1, 0x588B, 0xD0B1, 0xC8B1, 0xE0B0,
+    0xE0B0, 0xE0B0, 0x988B, 0x986B, 0xE8AE, 0xE0AE, 0xE0AE, 0xE0AE,
+    0xE8AC, 0xE108, 0xE0AA, 0xE0AA, 0xC0C6, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x90E4, 0xE9C5, 0xE9C5, 0xE165, 0xE106,
+    0xC0C6, 0x5884, 0xE8C8, 0xE0A8, 0xE0C8, 0xE0AA, 0xE8AA, 0xE0AC,
+    0xE0AC, 0xE0AE, 0xE8AE, 0x986B, 0x988B, 0xE0B0, 0xB0B1, 0x5084,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1842, 0x3191,
+    0x3191, 0x2212, 0x2212, 0x09EE, 0x1A53, 0x1AB4, 0x0000, 0x12B4,
+    0x1356, 0x0B33, 0x0000, 0x0B56, 0x1356, 0x09EE, 0x1356, 0x1356,
+    0x1356, 0x12B4, 0x09EE, 0x2042, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x2042, 0x90F1, 0x90D1, 0x588B, 0xA08B, 0xC8B1,
+    0xC8B1, 0xE8B0, 0xE0B0, 0xE0B0, 0xE0AE, 0xE0B0, 0xE0AE, 0xE8AC,
+    0x5084, 0xE8AC, 0xE0AA, 0xE0AA, 0xE8C8, 0x5084, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE9C5, 0xE965, 0xE165,
+    0xE906, 0x90C4, 0x5884, 0x90E4, 0xC0C6, 0xE0AA, 0xE8AA, 0xE0AC,
+    0xE0AC, 0xE0AE, 0xE8AE, 0xE0AE, 0xE0AE, 0xE8B0, 0xD08E, 0x1842,
+    0x988B, 0xA06B, 0x2042, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x1842, 0x210B, 0x4931, 0x3191, 0x2991,
+    0x3191, 0x2212, 0x2212, 0x2042, 0x09EE, 0x1AB4, 0x12B4, 0x0B33,
+    0x1356, 0x0BF8, 0x1356, 0x0B56, 0x0BD8, 0x0BF8, 0x0BF8, 0x2042,
+    0x09EE, 0x0BD8, 0x1356, 0x1356, 0x12B4, 0x1AD4, 0x09EE, 0x1842,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x608B, 0x78D1, 0x190B, 0xB0D1, 0xA8B1, 0xC8B1,
+    0xC8B1, 0xE0B0, 0xC8B1, 0xE0B0, 0xE0B0, 0xE0B0, 0xE8AE, 0xE0AE,
+    0xA08B, 0x5884, 0x986B, 0xE0AC, 0xE0AA, 0xE8AA, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5084, 0xE945,
+    0xE106, 0xE126, 0xC0C6, 0x5084, 0x0000, 0x5884, 0xE8C8, 0xE8AA,
+    0xC88A, 0xE0AC, 0xE0AC, 0xC88A, 0x0000, 0xE0B0, 0xE0AE, 0x988B,
+    0x0000, 0x1842, 0xD0AE, 0xD0B1, 0xA8B1, 0xB0D1, 0x986B, 0x90D1,
+    0x588B, 0x608B, 0x608B, 0x6111, 0x4951, 0x4931, 0x210B, 0x190B,
+    0x0000, 0x210B, 0x2212, 0x1A53, 0x09EE, 0x12D4, 0x1AB4, 0x09EE,
+    0x1AB4, 0x0BF8, 0x0B56, 0x0BD8, 0x0BF8, 0x0B33, 0x0B33, 0x0BD8,
+    0x0B33, 0x09EE, 0x1356, 0x0BF8, 0x1842, 0x210B, 0x09EE, 0x1AD4,
+    0x1A53, 0x1A53, 0x190B, 0x210B, 0x2042, 0x1842, 0x2042, 0x190B,
+    0x210B, 0x4931, 0x6911, 0x6111, 0x0000, 0x0000, 0xA08B, 0xA8B1,
+    0xB0D1, 0x588B, 0xB0B1, 0xE0B0, 0xE0B0, 0xE0B0, 0xE8AE, 0xE0AE,
+    0x0000, 0x5084, 0x5884, 0xC88A, 0xE8AA, 0xE8AA, 0x5084, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0xC0C6, 0xE165, 0xE126, 0xE906, 0xC0C6, 0x90C4, 0xE0C8, 0xE8AA,
+    0xC88A, 0x5884, 0xE8AC, 0xE8AE, 0x1842, 0x0000, 0x5084, 0xE0B0,
+    0xD0AE, 0xC88E, 0xC8B1, 0xD0B1, 0x988B, 0xA8B1, 0xB0D1, 0xB0D1,
+    0x90D1, 0x90F1, 0x608B, 0x190B, 0x5131, 0x4931, 0x0000, 0x0000,
+    0x0000, 0x1842, 0x3191, 0x1A53, 0x1A53, 0x1AB4, 0x12B4, 0x210B,
+    0x0000, 0x1356, 0x0BF8, 0x0BD8, 0x0BD8, 0x0479, 0x0B33, 0x0000,
+    0x0B33, 0x0499, 0x0BD8, 0x0BF8, 0x0BF8, 0x09EE, 0x0000, 0x0000,
+    0x0000, 0x09EE, 0x1A53, 0x2212, 0x210B, 0x2212, 0x3191, 0x4931,
+    0x2991, 0x6911, 0x4951, 0x6111, 0x6111, 0x90D1, 0x5884, 0x90D1,
+    0xB0D1, 0x1842, 0x0000, 0x588B, 0xC8B1, 0xE8B0, 0x588B, 0xE0B0,
+    0xE8AE, 0xC88E, 0x1842, 0xC8AE, 0xE8AC, 0xE8AC, 0x988B, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x5084, 0xE906, 0xE8E7, 0xE0E7, 0xE0C8, 0xE0A8,
+    0x988B, 0x5884, 0xC88A, 0xE8AC, 0x988B, 0x0000, 0x0000, 0x1842,
+    0xE8AE, 0xE0B0, 0xC8B1, 0xD0B1, 0x1842, 0x0000, 0xB0B1, 0x988B,
+    0x608B, 0x90D1, 0x78F1, 0x6111, 0x1842, 0x4931, 0x0000, 0x0000,
+    0x0000, 0x3191, 0x3191, 0x2212, 0x2212, 0x12B4, 0x1AB4, 0x190B,
+    0x0000, 0x0000, 0x1356, 0x0BD8, 0x0BD8, 0x0C99, 0x0BD8, 0x0479,
+    0x0000, 0x0000, 0x0BD8, 0x0C99, 0x0BD8, 0x0BD8, 0x0B56, 0x1356,
+    0x2042, 0x0000, 0x0000, 0x09EE, 0x0A0E, 0x210B, 0x3191, 0x3191,
+    0x2991, 0x0000, 0x4931, 0x608B, 0x0000, 0x6911, 0x78F1, 0x90D1,
+    0x90D1, 0xA8D1, 0x0000, 0x0000, 0x0000, 0xB0D1, 0xC8B1, 0x986B,
+    0x608B, 0xE0B0, 0xE8AE, 0xE0AE, 0xE0AC, 0xE8AC, 0x5084, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5084, 0x90E4, 0xE8C8,
+    0xC88A, 0xC88A, 0x988B, 0xE0AC, 0xE8AC, 0xA06B, 0x2042, 0x1842,
+    0x1842, 0xE0B0, 0xE8B0, 0x988B, 0x0000, 0x0000, 0x5884, 0xB0D1,
+    0x588B, 0x0000, 0x90D1, 0x78F1, 0x6911, 0x6111, 0x2042, 0x0000,
+    0x0000, 0x4931, 0x3191, 0x1842, 0x2042, 0x1AB4, 0x1A53, 0x1A53,
+    0x0000, 0x0000, 0x190B, 0x0BD8, 0x0BD8, 0x0C79, 0x0479, 0x0C79,
+    0x0479, 0x0000, 0x0000, 0x210B, 0x0479, 0x0C99, 0x0BF8, 0x0000,
+    0x09EE, 0x1356, 0x190B, 0x0000, 0x0000, 0x21F2, 0x2212, 0x2212,
+    0x3191, 0x210B, 0x0000, 0x4951, 0x4931, 0x0000, 0x0000, 0x1842,
+    0x78D1, 0xB0D1, 0x90D1, 0x0000, 0x0000, 0x0000, 0x588B, 0xE0B0,
+    0xC8AE, 0xD08E, 0x988B, 0xD08E, 0x988B, 0x5884, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x1842, 0x2042, 0x5884, 0x608B, 0xA06B, 0x988B, 0xD08E,
+    0x988B, 0xC88E, 0xE8AE, 0xC8B1, 0x1842, 0x608B, 0x0000, 0xA08B,
+    0xA8B1, 0x90D1, 0x0000, 0x588B, 0x78F1, 0x78F1, 0x4931, 0x608B,
+    0x0000, 0x4931, 0x210B, 0x0000, 0x0000, 0x190B, 0x2212, 0x1AB4,
+    0x0000, 0x0000, 0x0000, 0x190B, 0x0BF8, 0x0C79, 0x0479, 0x0C79,
+    0x0479, 0x0C79, 0x0000, 0x0000, 0x0000, 0x0B33, 0x0479, 0x0C79,
+    0x1842, 0x0000, 0x2042, 0x0B33, 0x190B, 0x2042, 0x2212, 0x21F2,
+    0x3191, 0x3191, 0x0000, 0x0000, 0x4931, 0x6111, 0x2042, 0x608B,
+    0x1842, 0x608B, 0x90F1, 0x90D1, 0x608B, 0x588B, 0x608B, 0xA08B,
+    0x588B, 0xA08B, 0x1842, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x1842, 0x1842, 0x0000, 0x0000, 0xD08E, 0x588B, 0xA08B,
+    0xA8B1, 0xD0B1, 0xB0D1, 0x78D1, 0x1842, 0x78F1, 0x6111, 0x6911,
+    0x4951, 0x4931, 0x210B, 0x0000, 0x0000, 0x0000, 0x21F2, 0x1AB4,
+    0x190B, 0x0000, 0x0000, 0x0000, 0x210B, 0x0479, 0x0C79, 0x0479,
+    0x0C79, 0x0479, 0x0C79, 0x0000, 0x0000, 0x0000, 0x0000, 0x0479,
+    0x0C79, 0x0B33, 0x0000, 0x0000, 0x0000, 0x0333, 0x1AB4, 0x12B4,
+    0x2212, 0x2212, 0x210B, 0x190B, 0x3191, 0x4951, 0x4931, 0x6911,
+    0x210B, 0x4931, 0x0000, 0x0000, 0x0000, 0x1842, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x2042, 0xE8AE, 0xC8B1, 0xB0D1,
+    0xA8B1, 0xC8B1, 0xB0D1, 0xA8B1, 0x90D1, 0x90F1, 0x6111, 0x6111,
+    0x4931, 0x4951, 0x3191, 0x3191, 0x0000, 0x0000, 0x190B, 0x2212,
+    0x1A53, 0x0000, 0x0000, 0x0000, 0x0000, 0x210B, 0x0BD8, 0x0499,
+    0x0C79, 0x0479, 0x0C79, 0x0BD8, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x09EE, 0x0499, 0x0BD8, 0x2042, 0x0000, 0x210B, 0x12B4, 0x12B4,
+    0x1A53, 0x2212, 0x3191, 0x3191, 0x3191, 0x4931, 0x3191, 0x4931,
+    0x4931, 0x4951, 0x6911, 0x78F1, 0x1842, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x986B, 0xE0B0, 0xE0B0, 0xE0B0,
+    0xC8B1, 0xC8B1, 0xB0D1, 0xB0B1, 0x588B, 0x78F1, 0x90D1, 0x78F1,
+    0x6911, 0x6111, 0x5151, 0x4931, 0x3191, 0x4931, 0x190B, 0x2212,
+    0x21F2, 0x210B, 0x0000, 0x0000, 0x0000, 0x0000, 0x210B, 0x0499,
+    0x0BD8, 0x0C79, 0x0479, 0x0C79, 0x0333, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0BD8, 0x0C79, 0x0333, 0x3A42, 0x1356, 0x1356,
+    0x12B4, 0x12B4, 0x2212, 0x2212, 0x3191, 0x3191, 0x3191, 0x4931,
+    0x4931, 0x6111, 0x6111, 0x78F1, 0x78D1, 0xB0D1, 0xA06B, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x5884, 0xE8AE, 0xE0B0, 0xE0B0, 0xE0B0,
+    0xC8B1, 0xC8B1, 0xD0B1, 0xC8B1, 0x988B, 0x0000, 0x90D1, 0x78F1,
+    0x608B, 0x78D1, 0x588B, 0x4931, 0x4951, 0x4931, 0x3191, 0x3191,
+    0x3191, 0x3191, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x190B,
+    0x0BF8, 0x0C99, 0x0479, 0x0C79, 0x0479, 0x0BD8, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x2042, 0x0BD8, 0x0BF8, 0x0B56, 0x1356,
+    0x1AB4, 0x12B4, 0x09EE, 0x2212, 0x09EE, 0x3191, 0x3191, 0x0000,
+    0x210B, 0x6111, 0x4931, 0x6911, 0x78F1, 0x90D1, 0x90F1, 0xA8D1,
+    0xB0B1, 0x588B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0xC8AE, 0xE8AE, 0xE0B0, 0xE0B0, 0xE0B0,
+    0xE0B0, 0xE0B0, 0xC8B1, 0xD0B1, 0x608B, 0x588B, 0x90D1, 0xB0D1,
+    0x608B, 0x78F1, 0x6111, 0x2042, 0x4931, 0x4951, 0x3191, 0x4931,
+    0x3191, 0x2212, 0x2042, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x09EE, 0x0BD8, 0x0BD8, 0x0479, 0x0C79, 0x0499, 0x0B33, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1356, 0x1356, 0x0B56,
+    0x1AB4, 0x1356, 0x12B4, 0x0000, 0x09EE, 0x2212, 0x210B, 0x4951,
+    0x2991, 0x608B, 0x608B, 0x6111, 0x6111, 0x90D1, 0x88D1, 0xB0D1,
+    0xA8B1, 0xD0B1, 0xC8B1, 0xB0D1, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x1842, 0xE8AC, 0xE0AC, 0xE0AE, 0xE8AE, 0xE0B0,
+    0xC88E, 0xE0B0, 0xC8B1, 0x988B, 0xC8B1, 0xB0B1, 0x988B, 0x608B,
+    0x78D1, 0x608B, 0x6111, 0x78F1, 0x0000, 0x4931, 0x4931, 0x4951,
+    0x3191, 0x3191, 0x3191, 0x2212, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x09EE, 0x0B56, 0x0BF8, 0x0BD8, 0x0C99, 0x0BD8, 0x0333,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x09EE, 0x1356, 0x1356,
+    0x1356, 0x1356, 0x12B4, 0x1A53, 0x0000, 0x210B, 0x3191, 0x190B,
+    0x210B, 0x4931, 0x210B, 0x608B, 0x6111, 0x6111, 0x608B, 0x90F1,
+    0x988B, 0xB0B1, 0xB0D1, 0xC8B1, 0xC8B1, 0xC8B1, 0x1842, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x90E4, 0xE0AC, 0xE0AC, 0xE8AE, 0xE0AE, 0xE0AE,
+    0xE8AE, 0xC8B1, 0xE0B0, 0xB0B1, 0x988B, 0xC8B1, 0xB0B1, 0xB0D1,
+    0x608B, 0x90D1, 0x190B, 0x78F1, 0x6111, 0x6911, 0x4951, 0x4931,
+    0x3191, 0x4931, 0x2042, 0x2212, 0x2212, 0x3191, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x09EE, 0x0BD8, 0x0BF8, 0x0BD8, 0x0BD8, 0x0C79,
+    0x0333, 0x0000, 0x0000, 0x0000, 0x0000, 0x3A42, 0x0BF8, 0x0BD8,
+    0x0A0E, 0x09EE, 0x1AB4, 0x1AB4, 0x1A53, 0x09EE, 0x2212, 0x2212,
+    0x190B, 0x5131, 0x190B, 0x5131, 0x190B, 0x6111, 0x78F1, 0x608B,
+    0x78F1, 0x588B, 0x90D1, 0xC8B1, 0xB0B1, 0xC8B1, 0xC8B1, 0xE8B0,
+    0x608B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x986B, 0xE8AA, 0xE8AA, 0xE0AC, 0xE0AC, 0xE0AE,
+    0xE8AE, 0xE0B0, 0xE0AE, 0xE0B0, 0x1842, 0x1842, 0xD0B1, 0xB0D1,
+    0x0000, 0xA8B1, 0x90D1, 0x588B, 0x78F1, 0x78F1, 0x6111, 0x6911,
+    0x4931, 0x4931, 0x0000, 0x0000, 0x190B, 0x2212, 0x2212, 0x2042,
+    0x0000, 0x0000, 0x0000, 0x09EE, 0x1356, 0x0BF8, 0x1356, 0x0BD8,
+    0x0BF8, 0x0333, 0x0000, 0x0000, 0x0000, 0x0000, 0x0B33, 0x0BD8,
+    0x1AB4, 0x0000, 0x0000, 0x09EE, 0x1A73, 0x1A53, 0x2212, 0x21F2,
+    0x3191, 0x3191, 0x190B, 0x4931, 0x2042, 0x0000, 0x6911, 0x78F1,
+    0x0000, 0x608B, 0x90D1, 0xA8D1, 0xB0D1, 0xC8B1, 0xC8B1, 0xE0B0,
+    0xE0B0, 0xE0B0, 0x986B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0xC88A, 0xE8AA, 0xE0AA, 0xE0AC, 0xE0AC, 0xE8AE,
+    0xE0AE, 0xE0B0, 0xE0AE, 0xE0B0, 0xE0B0, 0xE8B0, 0x988B, 0xC8B1,
+    0xD0B1, 0x988B, 0x90D1, 0xA8D1, 0x90D1, 0x90D1, 0x78F1, 0x78F1,
+    0x6911, 0x4931, 0x5131, 0x190B, 0x0000, 0x0000, 0x210B, 0x2212,
+    0x09EE, 0x0000, 0x0000, 0x0000, 0x1A53, 0x1356, 0x1356, 0x0BF8,
+    0x0B56, 0x0BF8, 0x0B33, 0x0000, 0x0000, 0x0000, 0x09EE, 0x0BD8,
+    0x1356, 0x0000, 0x0000, 0x0000, 0x09EE, 0x1A53, 0x2212, 0x2212,
+    0x3191, 0x2212, 0x3191, 0x4931, 0x4931, 0x190B, 0x608B, 0x78F1,
+    0x608B, 0x588B, 0x90D1, 0xB0D1, 0xA8B1, 0xC8B1, 0xC8B1, 0xE8B0,
+    0xC8B1, 0xE0B0, 0xE0B0, 0xE0B0, 0xB0D1, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0xC0C6, 0xE0C8, 0xE0A8, 0xE0AA, 0xE8AA, 0xE0AC,
+    0xE0AC, 0xE0AC, 0x988B, 0xE8AE, 0xE0AE, 0xE0B0, 0xE0B0, 0xE0B0,
+    0xC8B1, 0xC8B1, 0xB0B1, 0xA8D1, 0x90D1, 0x90D1, 0x78F1, 0x78F1,
+    0x6111, 0x6111, 0x4931, 0x4931, 0x3191, 0x0000, 0x0000, 0x0000,
+    0x3191, 0x2212, 0x0000, 0x0000, 0x09EE, 0x0A0E, 0x12B4, 0x1356,
+    0x1356, 0x1356, 0x12B4, 0x09EE, 0x09EE, 0x0000, 0x0000, 0x1356,
+    0x1356, 0x210B, 0x0000, 0x0000, 0x190B, 0x1A73, 0x09EE, 0x2212,
+    0x3191, 0x3191, 0x3191, 0x3191, 0x3191, 0x4931, 0x4931, 0x6911,
+    0x6111, 0x78F1, 0x78F1, 0x90D1, 0x90D1, 0xA8D1, 0xB0D1, 0xC8B1,
+    0xC8B1, 0xE8B0, 0xE0B0, 0xE0B0, 0xE0AE, 0xE0B0, 0x986B, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0xC0C6, 0xE0E7, 0xE8A8, 0xE0AA, 0xE0AA, 0xE0AC,
+    0xE8AC, 0xE8AE, 0x588B, 0x0000, 0x988B, 0xE0B0, 0xE0B0, 0xE8B0,
+    0xC8B1, 0xC8B1, 0xB0D1, 0x88D1, 0xB0B1, 0xB0D1, 0x90F1, 0x90D1,
+    0x78F1, 0x0000, 0x190B, 0x6911, 0x190B, 0x4931, 0x3191, 0x0000,
+    0x0000, 0x210B, 0x2212, 0x09EE, 0x2042, 0x21F2, 0x0000, 0x12B4,
+    0x1AB4, 0x1356, 0x12B4, 0x0B33, 0x0000, 0x0333, 0x0000, 0x210B,
+    0x1AB4, 0x0333, 0x0000, 0x0000, 0x2042, 0x12B4, 0x2212, 0x2212,
+    0x3191, 0x0000, 0x210B, 0x4951, 0x3191, 0x4931, 0x4931, 0x6111,
+    0x6111, 0x78F1, 0x78F1, 0x88D1, 0x90D1, 0xB0D1, 0xA8B1, 0x588B,
+    0x0000, 0xE0B0, 0xE0B0, 0xE0B0, 0xE0B0, 0xE0B0, 0xE8AE, 0xE8AE,
+    0x988B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x5084, 0xE8E7, 0xE0C8, 0xE8A8, 0xE0C8, 0xE0AA,
+    0xE0AA, 0xE8AC, 0xE0AC, 0xC88A, 0x0000, 0x0000, 0xC8AE, 0xA8B1,
+    0x0000, 0x0000, 0x608B, 0xC8B1, 0xB0D1, 0xC8B1, 0xA8B1, 0xB0D1,
+    0x90D1, 0x190B, 0x0000, 0x0000, 0x190B, 0x210B, 0x0000, 0x4931,
+    0x210B, 0x0000, 0x0000, 0x3191, 0x2991, 0x3191, 0x1842, 0x0000,
+    0x1A73, 0x1AB4, 0x12B4, 0x1AB4, 0x1A53, 0x0000, 0x210B, 0x190B,
+    0x09EE, 0x1AB4, 0x2042, 0x0000, 0x1842, 0x1A53, 0x210B, 0x0000,
+    0x190B, 0x2042, 0x0000, 0x0000, 0x3191, 0x4931, 0x4951, 0x6911,
+    0x6111, 0x78F1, 0x1842, 0x0000, 0x2042, 0x78D1, 0xB0D1, 0x1842,
+    0x0000, 0x98C4, 0xD0B1, 0xE0B0, 0xE0B0, 0xE0B0, 0xE8AE, 0xE0AE,
+    0xE0AE, 0xE0AE, 0x5884, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0xE906, 0xE0E7, 0xE108, 0xE0A8, 0xE0AA,
+    0xE8AA, 0xE108, 0xE0AA, 0xE0AC, 0xE8AC, 0x608B, 0x1842, 0xE8B0,
+    0x988B, 0x0000, 0x0000, 0x986B, 0xD0B1, 0xC8B1, 0xC8B1, 0xB0D1,
+    0x90D1, 0xB0D1, 0x0000, 0x0000, 0x0000, 0x608B, 0x4931, 0x0000,
+    0x0000, 0x4931, 0x3191, 0x0000, 0x3191, 0x2212, 0x2212, 0x0000,
+    0x0000, 0x1A53, 0x1A53, 0x12B4, 0x1A53, 0x1A53, 0x0000, 0x210B,
+    0x1A53, 0x12B4, 0x1AB4, 0x1842, 0x210B, 0x1A53, 0x190B, 0x0000,
+    0x210B, 0x3191, 0x0000, 0x0000, 0x0000, 0x4951, 0x4931, 0x6111,
+    0x6111, 0x78D1, 0x78F1, 0x78D1, 0x0000, 0x0000, 0x608B, 0xC8B1,
+    0x5884, 0x0000, 0xC8AE, 0xE0B0, 0xE0B0, 0xE0B0, 0xE0B0, 0xE0B0,
+    0xE0AE, 0xE0AE, 0xE0AC, 0xE8AC, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x5084, 0xE926, 0xE106, 0xE0E7, 0xE8C8,
+    0xE0C8, 0xE0AA, 0xE0A8, 0xE8AA, 0xE0AA, 0xE0AC, 0xC8AE, 0x986B,
+    0xE8AE, 0xE0AE, 0x0000, 0x0000, 0xA8D1, 0xE8B0, 0xC8B1, 0xC8B1,
+    0x986B, 0x1842, 0x90D1, 0x2042, 0x0000, 0x0000, 0x0000, 0x4951,
+    0x190B, 0x0000, 0x0000, 0x5131, 0x3191, 0x3191, 0x2991, 0x3191,
+    0x0000, 0x0000, 0x0A0E, 0x2212, 0x21F2, 0x1A53, 0x09EE, 0x0000,
+    0x0000, 0x2212, 0x2212, 0x1A53, 0x2212, 0x21F2, 0x2042, 0x0000,
+    0x0000, 0x3191, 0x0000, 0x0000, 0x0000, 0x0000, 0x4931, 0x190B,
+    0x0000, 0x6911, 0x6111, 0x78F1, 0x90D1, 0x608B, 0x0000, 0xB0D1,
+    0xA8D1, 0xA06B, 0x988B, 0xE0B0, 0xC8B1, 0xE8B0, 0xE0AE, 0xE0B0,
+    0xE0AE, 0xE8AE, 0xE0AC, 0xE0AC, 0xE0AA, 0x1842, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x1842, 0xE165, 0xE906, 0xE108,
+    0xE0C8, 0xE0A8, 0xE0C8, 0xE8AA, 0xE0AA, 0xA06B, 0x988B, 0xE0AE,
+    0xC88A, 0xA08B, 0xE8AE, 0x1842, 0x5084, 0xE0B0, 0xE0B0, 0xE8B0,
+    0xC8B1, 0xC8B1, 0xB0B1, 0xA8D1, 0x608B, 0x608B, 0x608B, 0x608B,
+    0x6111, 0x6911, 0x1842, 0x0000, 0x0000, 0x606B, 0x2991, 0x3191,
+    0x2042, 0x0000, 0x0000, 0x2212, 0x2212, 0x21F2, 0x2212, 0x2212,
+    0x0000, 0x0000, 0x190B, 0x21F2, 0x2212, 0x2212, 0x0000, 0x0000,
+    0x0000, 0x3191, 0x3191, 0x2042, 0x1842, 0x210B, 0x1842, 0x6111,
+    0x608B, 0x6111, 0x6111, 0x78D1, 0x78F1, 0xB0D1, 0x90D1, 0x5884,
+    0xA8D1, 0x90D1, 0x588B, 0xE8B0, 0xC8B1, 0x986B, 0xE0B0, 0xE0B0,
+    0xE0AE, 0xE0B0, 0xE0AE, 0xE8AE, 0xE8AC, 0xE8AC, 0x1842, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1842, 0xE906, 0xE906,
+    0xE0E7, 0xE0E7, 0xE8C8, 0xE0C8, 0xE0A8, 0xC0C6, 0x1842, 0x0000,
+    0xE8AC, 0xE0AE, 0xE8AE, 0xE0AE, 0xC8AE, 0xE0B0, 0xE0B0, 0xE0B0,
+    0x588B, 0x0000, 0xB0B1, 0xC8B1, 0x988B, 0x608B, 0x1842, 0x608B,
+    0x608B, 0x78D1, 0x6111, 0x6911, 0x4931, 0x1842, 0x0000, 0x4951,
+    0x3191, 0x0000, 0x0000, 0x0000, 0x3191, 0x2212, 0x3191, 0x2212,
+    0x09EE, 0x0000, 0x0000, 0x0000, 0x3191, 0x2212, 0x1842, 0x0000,
+    0x210B, 0x3191, 0x3191, 0x3191, 0x190B, 0x4931, 0x210B, 0x4931,
+    0x4931, 0x6911, 0x6111, 0x1842, 0x0000, 0x90F1, 0x90D1, 0xB0D1,
+    0xB0D1, 0xC8B1, 0xB0B1, 0xC8B1, 0xC8B1, 0x608B, 0x0000, 0x988B,
+    0xE8AE, 0xE0B0, 0xE0AE, 0xE8AE, 0xE0AC, 0xE0AC, 0xE0AA, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE165,
+    0xE126, 0xE106, 0xE8E7, 0xE0E7, 0xE0A8, 0xE8AA, 0x5884, 0x90E4,
+    0xC88A, 0xE0AE, 0xE0AC, 0xE8AE, 0xE0AE, 0xE0B0, 0xE0B0, 0xE0B0,
+    0xE8B0, 0x588B, 0xA08B, 0x986B, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x608B, 0x78F1, 0x608B, 0x6111, 0x6111, 0x6911,
+    0x4951, 0x4931, 0x0000, 0x0000, 0x0000, 0x4951, 0x3191, 0x3191,
+    0x3191, 0x2991, 0x0000, 0x0000, 0x0000, 0x3191, 0x3191, 0x3191,
+    0x3191, 0x4931, 0x210B, 0x4951, 0x3191, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x1842, 0x608B, 0x190B, 0x0000, 0x90D1, 0xA8B1,
+    0xB0D1, 0xC8B1, 0xC8B1, 0xC8B1, 0xC8B1, 0xE8B0, 0x986B, 0x608B,
+    0x1842, 0xE0B0, 0xE0AE, 0xE8AE, 0xE0AC, 0xE0AE, 0xE0AC, 0xE8AC,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0xC165, 0xE965, 0xE108, 0xE0E7, 0xE0A8, 0xE8C8, 0xE0A8, 0xC0C6,
+    0x988B, 0xE8AC, 0xE0AC, 0xE0AC, 0xE0AC, 0xE8AE, 0xE0AE, 0xE0B0,
+    0xA8B1, 0xC8B1, 0xC8B1, 0x98E4, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x78D1, 0x78F1, 0x0000, 0x0000, 0x1842,
+    0x608B, 0x6111, 0x1842, 0x0000, 0x0000, 0x0000, 0x210B, 0x3191,
+    0x3191, 0x3191, 0x190B, 0x0000, 0x0000, 0x0000, 0x210B, 0x3191,
+    0x190B, 0x2042, 0x0000, 0x0000, 0x190B, 0x4931, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x210B, 0x90D1, 0xB0D1,
+    0x988B, 0xB0B1, 0xB0D1, 0xC8B1, 0xC8B1, 0xE0B0, 0xC8B1, 0xE8B0,
+    0xC88E, 0x90E4, 0xE8AE, 0xE0AE, 0xE0AC, 0xE8AC, 0xE0AC, 0xE0AC,
+    0xC88A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0xC185, 0xE165, 0xE106, 0xE8E7, 0xE108, 0xE0A8, 0xE0C8,
+    0xE0A8, 0xE8AC, 0xE0AA, 0xE8AC, 0x90E4, 0xC88E, 0xE0AE, 0xE0AE,
+    0xE8AE, 0xD0AE, 0x986B, 0xE0B0, 0xB0D1, 0x608B, 0x1842, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x90D1, 0x78F1, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x210B, 0x210B, 0x0000, 0x0000, 0x0000, 0x4951,
+    0x3191, 0x4931, 0x3191, 0x4951, 0x0000, 0x0000, 0x0000, 0x190B,
+    0x210B, 0x0000, 0x0000, 0x0000, 0x0000, 0x4931, 0x5131, 0x1842,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x1842, 0x78F1, 0x90D1, 0xA8D1,
+    0x90D1, 0x608B, 0xA8D1, 0xD0B1, 0xC8B1, 0xE0B0, 0xA8D1, 0xC8B1,
+    0xE0B0, 0xE0B0, 0xE0AE, 0xE8AE, 0xE0AE, 0xE0AE, 0xE0AC, 0xE8AC,
+    0xE0AA, 0xC88A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x90C4, 0xE965, 0xE106, 0xE906, 0xE0E7, 0xE0E7,
+    0xE0C8, 0xE8AA, 0xE0C8, 0xE0AA, 0x986B, 0x0000, 0x90E4, 0xE8AE,
+    0xE8AE, 0xE0B0, 0xE0AE, 0xA8B1, 0x0000, 0x988B, 0xB0B1, 0xC8B1,
+    0xC8B1, 0xD0B1, 0xA8D1, 0xB0B1, 0x88D1, 0xB0D1, 0x190B, 0x0000,
+    0x0000, 0x0000, 0x1842, 0x6911, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x190B, 0x5131, 0x4951, 0x4931, 0x210B, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x4951, 0x2042, 0x0000, 0x0000, 0x0000, 0x190B, 0x6911,
+    0x608B, 0x6111, 0x6111, 0x78F1, 0x78D1, 0x78F1, 0x90D1, 0x78F1,
+    0x0000, 0x608B, 0xB0B1, 0xC8B1, 0xC8B1, 0xE0B0, 0x988B, 0x0000,
+    0x608B, 0xE8B0, 0xE0AE, 0xE0AE, 0xE8AE, 0xE0AE, 0xE0AC, 0xE0AC,
+    0xE8AA, 0xE0AA, 0x5084, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x90E4, 0xE145, 0xE965, 0xE126, 0xE106,
+    0xE0E7, 0xE108, 0xE8A8, 0xE0AA, 0xE8AA, 0xD127, 0xC8AE, 0xE0AC,
+    0xE0AC, 0xE0AE, 0xE8AE, 0xE8B0, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x1842, 0x78D1, 0x988B, 0xA06B, 0xA8D1, 0xC8B1, 0x90D1, 0xA08B,
+    0x0000, 0x0000, 0x1842, 0x90F1, 0x608B, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x4931, 0x6911, 0x4951, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x4931, 0x6911, 0x1842, 0x0000, 0x0000, 0x4951,
+    0x4931, 0x78D1, 0x78F1, 0x78D1, 0x608B, 0x608B, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0xC8B1, 0xC8B1, 0xC8B1, 0xE0B0, 0xE0B0,
+    0xC8AE, 0xC88E, 0xE0B0, 0xE0B0, 0xE8AE, 0xE0AE, 0xE0AC, 0xE0AC,
+    0xE8AC, 0xE0AC, 0xE8AA, 0x5884, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x5884, 0xE1A6, 0xE906, 0xE126,
+    0xE108, 0xE0E7, 0xE8C8, 0xE0A8, 0xE0C8, 0xE0AA, 0xE8AA, 0xE0AC,
+    0xE0AC, 0xE0AC, 0xE8AC, 0xE0AE, 0x90C4, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x588B, 0x608B, 0xB0D1,
+    0x588B, 0x0000, 0x1842, 0x90D1, 0x90D1, 0x2042, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x1842, 0x210B, 0x1842, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x2042, 0x6911, 0x6111, 0x1842, 0x0000,
+    0x608B, 0x6911, 0x78F1, 0x1842, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x5884, 0xD0B1, 0xC8B1, 0xE8B0,
+    0xE0B0, 0xE0B0, 0xE0AE, 0xE0B0, 0xE0AE, 0xE8AE, 0xE0AC, 0xE0AC,
+    0xE0AC, 0xE8AC, 0xE0AA, 0xE0AA, 0x1842, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1842, 0xE1A6, 0xE965,
+    0xE106, 0xE106, 0xE0E7, 0xE8E7, 0xC0C6, 0xC0C6, 0xE0C8, 0xE0AA,
+    0xC0C6, 0xE0AC, 0xE8AC, 0xE8AE, 0xE8AC, 0x1842, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x986B, 0x608B, 0x588B,
+    0xB0D1, 0x90D1, 0x988B, 0xB0D1, 0x88D1, 0x90D1, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x78F1, 0x78D1, 0x78F1,
+    0x608B, 0x90D1, 0x78F1, 0x588B, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xC88E, 0xE0B0,
+    0xE0B0, 0xE0B0, 0xE0B0, 0xE0B0, 0xE0AE, 0xE8AE, 0xE0AC, 0xE0AE,
+    0xE0AC, 0xE8AC, 0xE0AA, 0xE8AA, 0xE8C8, 0x1842, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE9C5,
+    0xE965, 0xE165, 0xE106, 0xE106, 0x5884, 0x0000, 0x0000, 0xE8C8,
+    0x90E4, 0x0000, 0x0000, 0x588B, 0xE8AC, 0xE0AE, 0x986B, 0xD0AE,
+    0x986B, 0x988B, 0x5884, 0x1842, 0x0000, 0x0000, 0x608B, 0xA06B,
+    0xD0B1, 0xC8B1, 0xA8D1, 0xB0B1, 0xA8D1, 0xB0B1, 0x588B, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1842, 0x78F1,
+    0x78D1, 0x90D1, 0x78F1, 0x90D1, 0x608B, 0x1842, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x608B, 0xA08B, 0xB0D1, 0x588B, 0xD0B1,
+    0xE0B0, 0x986B, 0x1842, 0x0000, 0x5884, 0xE8AE, 0x5884, 0x0000,
+    0x608B, 0xE8AC, 0xE0AA, 0xE0AA, 0xE8C8, 0xE0A8, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0xC165, 0xE9C5, 0xE165, 0xE145, 0xC0C6, 0x0000, 0x0000, 0x0000,
+    0xE8C8, 0xE8AA, 0x1842, 0x986B, 0xE0AA, 0xE8AC, 0xE0AC, 0xE0AE,
+    0xE0AE, 0xE0B0, 0xE8AE, 0xE0B0, 0xE0B0, 0xE0B0, 0xE0AE, 0xE8AE,
+    0xC8B1, 0xE0B0, 0xC8B1, 0xC8B1, 0xB0D1, 0xA8B1, 0xA08B, 0x608B,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x608B,
+    0x1842, 0x78F1, 0x90D1, 0xA8D1, 0x90D1, 0xA8D1, 0x90D1, 0x90D1,
+    0x988B, 0xB0B1, 0xA8D1, 0xD0B1, 0xC8B1, 0xE0B0, 0xE0B0, 0xE0B0,
+    0xE0B0, 0xE0B0, 0xC88E, 0x98E4, 0x0000, 0x986B, 0xE8AE, 0x5084,
+    0x0000, 0x0000, 0x90E4, 0xE8AC, 0xE0AA, 0xE0AA, 0xC0C6, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0xC185, 0xE1A6, 0xE965, 0xE145, 0x90E4, 0x0000, 0x0000,
+    0x0000, 0x90C4, 0xE8C8, 0xE8AA, 0xE0AA, 0xE0AA, 0xE0AA, 0xE8AC,
+    0xE0AC, 0xE0AE, 0xE0AC, 0xE8AE, 0xE0AE, 0xE0B0, 0xE0AE, 0xE0B0,
+    0xE0B0, 0xE0B0, 0xC8B1, 0xC8B1, 0xC8B1, 0xD0B1, 0x1842, 0x90D1,
+    0x1842, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x2042, 0xA08B, 0x0000, 0xA8B1, 0x90D1, 0xA8D1, 0xB0D1, 0xA8B1,
+    0xB0D1, 0xC8B1, 0xB0B1, 0xC8B1, 0xC8B1, 0xE0B0, 0xC8B1, 0xE8B0,
+    0xE0B0, 0xE0B0, 0xE0AE, 0xE0B0, 0xE0AE, 0xE8AE, 0xE0AC, 0xC8AE,
+    0x0000, 0x0000, 0x0000, 0x1842, 0xE8AA, 0xE0AA, 0xE8A8, 0x90E4,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x5084, 0xE9C5, 0xE9A6, 0xE9C5, 0x5884, 0x0000,
+    0x0000, 0x0000, 0x1842, 0xE0C8, 0xE0A8, 0xE8AA, 0xE0AA, 0xE8AA,
+    0x5884, 0x5084, 0xE0AC, 0xE8AE, 0xE0AE, 0xE0B0, 0xE0AE, 0xE0B0,
+    0xE8AE, 0xE0B0, 0xE0B0, 0xE0B0, 0xE0B0, 0xE0B0, 0x608B, 0x988B,
+    0xB0D1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x90D1, 0x608B, 0x1842, 0xC8B1, 0xB0B1, 0xC8B1,
+    0xA8D1, 0xD0B1, 0xC8B1, 0xC8B1, 0xC8B1, 0xE0B0, 0xE0B0, 0xE0B0,
+    0xE0B0, 0xB0B1, 0x988B, 0xE0B0, 0xE0AE, 0xE0B0, 0xE0AE, 0xE8AE,
+    0x90C4, 0x0000, 0x0000, 0x0000, 0x0000, 0xE0AA, 0xE8C8, 0xE8A8,
+    0x5084, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x1842, 0xF1C5, 0xE9C5, 0xE165, 0x5084,
+    0x0000, 0x0000, 0x0000, 0xA06B, 0xE8C8, 0xE0A8, 0xC88A, 0x5084,
+    0x0000, 0x0000, 0x608B, 0xE8AC, 0xE0AC, 0xE0AE, 0xC8AE, 0xE8AE,
+    0x988B, 0xE8AE, 0xE0AE, 0xE0B0, 0xC88E, 0xE0B0, 0xC8B1, 0x0000,
+    0x988B, 0xA06B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x988B, 0x986B, 0x0000, 0xB0D1, 0xC8B1,
+    0xB0B1, 0xC8B1, 0xC8B1, 0xD0B1, 0x988B, 0xE0B0, 0xC8B1, 0xE8B0,
+    0xE0B0, 0xE0B0, 0x986B, 0x0000, 0x0000, 0x588B, 0xD0AE, 0xE8AE,
+    0xE0AC, 0xC88E, 0x0000, 0x0000, 0x0000, 0x1842, 0xE8C8, 0xE0A8,
+    0xE8C8, 0x1842, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF285, 0xE9C5, 0xE9C5,
+    0x5084, 0x0000, 0x0000, 0x0000, 0xC0C6, 0xE108, 0xE8A8, 0xC0C6,
+    0x0000, 0x0000, 0x5884, 0xE0AC, 0xE0AC, 0xE8AC, 0x5884, 0x5084,
+    0xE8AE, 0xE0AE, 0xE8AE, 0xC8AE, 0x0000, 0x90C4, 0xE8B0, 0x988B,
+    0x608B, 0xE8B0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x1842, 0xD0AE, 0x1842, 0x588B,
+    0xD0B1, 0x90D1, 0x1842, 0xC8B1, 0xC8B1, 0xE0B0, 0xE8B0, 0x986B,
+    0x5884, 0xE0B0, 0xE0B0, 0xE0B0, 0x608B, 0x0000, 0x0000, 0x90E4,
+    0xE0AC, 0xE0AC, 0xE8AA, 0x0000, 0x0000, 0x0000, 0x1842, 0xE0E7,
+    0xE8A8, 0xE108, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xC165, 0xF285,
+    0xE9C5, 0x90C4, 0x0000, 0x0000, 0x0000, 0xC0C6, 0xE0E7, 0xE0E7,
+    0xC0C6, 0x5084, 0x5884, 0xE8AA, 0xE8AA, 0xE0AC, 0x5084, 0x0000,
+    0xA08B, 0xE0AE, 0xE8AC, 0x5084, 0x0000, 0x608B, 0xE8AE, 0xE0B0,
+    0xC88E, 0xE0B0, 0x988B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x986B, 0xD0B1,
+    0xA8D1, 0xE0B0, 0xC8B1, 0x5884, 0x0000, 0x5884, 0xD0B1, 0xE0B0,
+    0x986B, 0x0000, 0x608B, 0xE8AE, 0xE0AE, 0xE0AE, 0x1842, 0x5884,
+    0xC88A, 0xE8AA, 0xE0AA, 0xC8AA, 0x0000, 0x0000, 0x0000, 0x5884,
+    0x988B, 0xE8E7, 0x90C4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x62A3,
+    0xF285, 0x62A3, 0x5884, 0x5884, 0x0000, 0x0000, 0x0000, 0xE126,
+    0xE0E7, 0xC88A, 0xC0C6, 0xE0A8, 0xE8C8, 0xE8AA, 0x5884, 0x0000,
+    0x1842, 0xE0AC, 0xE8AC, 0x0000, 0x0000, 0x986B, 0xE0AE, 0xE0B0,
+    0xD0AE, 0x588B, 0xD08E, 0x608B, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x588B,
+    0xD0B1, 0x988B, 0xC88E, 0xE0B0, 0xE0B0, 0x588B, 0x0000, 0x0000,
+    0xE8AE, 0xE8B0, 0x1842, 0x0000, 0x5084, 0xE8AE, 0xE0AE, 0xE8AE,
+    0x988B, 0x986B, 0xE0AC, 0xE8AC, 0x5884, 0x0000, 0x0000, 0x0000,
+    0x5884, 0xC0C6, 0xE8E7, 0x90E4, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x1842, 0xF285, 0xC965, 0x1842, 0x98C4, 0x0000, 0x0000, 0x0000,
+    0x5884, 0xE906, 0xE0E7, 0xE0E7, 0xE8C8, 0xE0E7, 0x5084, 0x98E4,
+    0xC88A, 0xE8AC, 0xE0AA, 0xE0AC, 0x5084, 0xC88A, 0xE8AC, 0xE8AE,
+    0x1842, 0x0000, 0xC8AE, 0xE8AE, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0xE0B0, 0xC8AE, 0x0000, 0x1842, 0xE8B0, 0xE0AE, 0xC88E,
+    0x0000, 0xE8AE, 0xE0AE, 0xE0AE, 0x988B, 0x0000, 0x1842, 0xD08E,
+    0xE8AC, 0xE0AC, 0xE0AA, 0xE8AA, 0xC88A, 0x0000, 0x0000, 0x0000,
+    0x5084, 0x5884, 0xC0C6, 0xE926, 0x1842, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0xF285, 0xF265, 0x1842, 0x3242, 0xC985, 0x90C4,
+    0x0000, 0xC185, 0xE126, 0xE106, 0xE0E7, 0xE108, 0xC88A, 0xE8AA,
+    0xE0C8, 0xE8AA, 0xC0C6, 0x0000, 0x986B, 0xE0AC, 0xE8AC, 0x988B,
+    0x0000, 0x0000, 0xE8AE, 0xE8AE, 0x1842, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x1842, 0xE0B0, 0xC88E, 0x0000, 0x0000, 0x988B,
+    0xE8AE, 0xE0B0, 0xE8AE, 0x1842, 0x988B, 0xE0AE, 0xE8AC, 0xE0AC,
+    0xC88A, 0xE0AC, 0xE0AA, 0xE8AC, 0xE8AA, 0xC88A, 0x0000, 0x1842,
+    0x5884, 0x98E4, 0x1842, 0xE126, 0xE906, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0xCA64, 0xF265, 0x9AA3, 0x0000, 0x5884,
+    0x90E4, 0xE9A6, 0xE165, 0x1842, 0x0000, 0x5884, 0x0000, 0xC8C6,
+    0xE0A8, 0xE8C8, 0x90C4, 0x0000, 0x0000, 0x988B, 0xC88A, 0x1842,
+    0x0000, 0x2042, 0xE8AC, 0xE0AE, 0x588B, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x5884, 0xD0AE, 0xC88E, 0x0000,
+    0x0000, 0x1842, 0xD0AE, 0xC88A, 0x0000, 0x0000, 0x608B, 0xE8AC,
+    0xE0AC, 0xE0AA, 0x1842, 0x1842, 0x0000, 0x2042, 0xE8C8, 0xE8A8,
+    0x90E4, 0x5084, 0x0000, 0x5884, 0xE906, 0xC0C6, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x5084, 0xFB65, 0xCA64, 0x0000,
+    0x0000, 0x5884, 0xE9C5, 0x5084, 0x0000, 0x0000, 0x0000, 0x0000,
+    0xE8E7, 0xE0E7, 0xC0C6, 0x0000, 0x0000, 0xE0C8, 0xC88A, 0x0000,
+    0x0000, 0x0000, 0xC8AE, 0xE8AA, 0xC88E, 0xA08B, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xC8AE, 0xC88A, 0x986B,
+    0xD0AE, 0x1842, 0x0000, 0x0000, 0xC88A, 0xC8AE, 0x0000, 0x0000,
+    0xC88A, 0xE0AC, 0xE8AA, 0x0000, 0x0000, 0x0000, 0x0000, 0x5884,
+    0xE8C8, 0x90C4, 0x0000, 0x0000, 0x5084, 0xE965, 0x5884, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFB65, 0xF365,
+    0x0000, 0x9AA3, 0xE9C5, 0x5084, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x98E4, 0xE906, 0xE0E7, 0x5084, 0x0000, 0xE8C8, 0x986B, 0x0000,
+    0x0000, 0x0000, 0xA08B, 0xC88E, 0xE8AA, 0xE0AC, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE0AE,
+    0xC88A, 0x988B, 0x988B, 0x1842, 0x0000, 0x0000, 0xD08A, 0xC88A,
+    0x0000, 0x5884, 0xE8AA, 0xE0AA, 0x90E4, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x5884, 0xE8E7, 0x90E4, 0x0000, 0xC165, 0xE965, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCB84,
+    0xF365, 0xFB65, 0xF285, 0xCA64, 0x1842, 0x0000, 0x0000, 0x0000,
+    0x0000, 0xE165, 0xE926, 0xE906, 0x1842, 0xD127, 0xC0C6, 0x0000,
+    0x0000, 0x0000, 0x986B, 0xE0AA, 0xE8AA, 0xE108, 0x90E4, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x90C4, 0xE8AE, 0xC8AE, 0xC8AE, 0xC88A, 0x0000, 0x0000, 0x0000,
+    0xC8AA, 0xC88A, 0x0000, 0xE0AA, 0xE8C8, 0xE8AA, 0x5084, 0x0000,
+    0x0000, 0x0000, 0x0000, 0xC0C6, 0xE106, 0xC165, 0xE965, 0xC165,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x5064, 0xFB65, 0xF285, 0x5084, 0xCA64, 0xF285, 0xC165, 0x90C4,
+    0x98E4, 0xE9C5, 0xC165, 0x0000, 0xD127, 0xE906, 0x90E4, 0x0000,
+    0x0000, 0x0000, 0x5884, 0xE8C8, 0xE0A8, 0xE0AA, 0xC88A, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0xC8AA, 0xE8AC, 0xE0AA, 0xE0AC, 0x5084, 0x0000,
+    0x0000, 0x0000, 0x98E4, 0xE8A8, 0xE0C8, 0x5084, 0x98C4, 0xE8C8,
+    0x90C4, 0x5884, 0x5884, 0xE906, 0xC0C6, 0x1842, 0xC0C6, 0xE965,
+    0x5084, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0xF365, 0xFB65, 0x98E4, 0xCB84, 0x90C4, 0x9AC3,
+    0x5884, 0xCA64, 0xE9C5, 0x0000, 0x1842, 0xE165, 0xE906, 0xE106,
+    0xC0C6, 0xC0C6, 0xC0C6, 0xE0E7, 0xE0C8, 0xE8A8, 0xE8C8, 0x5084,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x90C4, 0xE8AA, 0xE0AC, 0xE0AA, 0xE8AA,
+    0x988B, 0xC0C6, 0xA06B, 0x988B, 0xE0A8, 0xE0C8, 0xC0C6, 0x0000,
+    0xE0E7, 0xE926, 0x5884, 0xC0C6, 0xC0C6, 0xE106, 0x90E4, 0xE9C5,
+    0xE9A6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0xCB84, 0xCB84, 0x0000, 0x90C4, 0x1842,
+    0x5884, 0xF285, 0xE9C5, 0x5884, 0x0000, 0xE9A6, 0xE165, 0xE145,
+    0xE906, 0xE126, 0xE108, 0xE108, 0xE0E7, 0xE0E7, 0xE8C8, 0xC0C6,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xC88A, 0xE0AA, 0xE0AA,
+    0xE0C8, 0xE8AA, 0xE0A8, 0xE0C8, 0xE0A8, 0xE8C8, 0xE0A8, 0xE0E7,
+    0x0000, 0x1842, 0xE108, 0xD927, 0x5084, 0x5884, 0x5884, 0x1842,
+    0xF1C5, 0xC185, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x5084, 0xFC85, 0xCA64, 0xCB84,
+    0x9AA3, 0xF365, 0xF285, 0xCA64, 0x0000, 0xCA64, 0xE9C5, 0x90C4,
+    0x5884, 0x98E4, 0x5084, 0xE165, 0xE906, 0xE106, 0xE8E7, 0xE908,
+    0x1842, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1842, 0xE0AA,
+    0xE0C8, 0xE0AA, 0xE8A8, 0xE8C8, 0x90C4, 0x98E4, 0x90C4, 0x90E4,
+    0xE0E7, 0xC0C6, 0x0000, 0xC165, 0xE965, 0xE9A6, 0x5084, 0xC965,
+    0xE9C5, 0xF285, 0x1842, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCB84, 0xFC85,
+    0xFB65, 0xF365, 0xF265, 0x1842, 0x5884, 0x9AA3, 0xE9C5, 0xC185,
+    0x90C4, 0x98E4, 0xE945, 0xE165, 0xE145, 0xE965, 0xE106, 0xE106,
+    0x5084, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x5884, 0xE8C8, 0xE8C8, 0xE0A8, 0xE0C8, 0xE0E7, 0xE8E7, 0x90C4,
+    0x5084, 0xE906, 0xE926, 0x90E4, 0x90C4, 0x5884, 0xC0C6, 0xE9C5,
+    0xE9C5, 0xF285, 0xC165, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3222,
+    0xFC85, 0xFC65, 0x62A3, 0x6AA3, 0x1842, 0xCB84, 0xF285, 0x5884,
+    0x5084, 0xEA85, 0xE9C5, 0xE9C5, 0xE1A6, 0xE9C5, 0xE965, 0xE165,
+    0xC0C6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0xC0C6, 0xE0E7, 0xE0E7, 0xE906, 0xE0E7, 0xE126,
+    0xE106, 0xE945, 0x98E4, 0x1842, 0xE945, 0xE9C5, 0x5884, 0x5084,
+    0x90C4, 0xF285, 0xF285, 0x1842, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0xCC84, 0xFC65, 0x0000, 0x90C4, 0x9AC3, 0xFB65, 0xF285,
+    0x90C4, 0xF285, 0xEA65, 0xF285, 0xE9C5, 0xE1C5, 0xE1A6, 0xE9C5,
+    0xC165, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0xC0C6, 0xE106, 0xE108, 0xE926,
+    0xE106, 0xE165, 0xE106, 0xE965, 0x5084, 0xC185, 0xE9A6, 0x90E4,
+    0x5884, 0x5884, 0xF285, 0x9AA3, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0xFD85, 0xCB84, 0xCB84, 0xFC85, 0xCB84,
+    0x9AA3, 0xF365, 0xFB65, 0xF365, 0xEA65, 0xF285, 0xEA65, 0xF285,
+    0xE9C5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xC0C6, 0xE165,
+    0xE145, 0xE165, 0xE165, 0xE9C5, 0xE1A6, 0xE9C5, 0xC165, 0xCA64,
+    0xE9C5, 0xF265, 0xEA85, 0xFB65, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x62A3, 0xFD65, 0xF485, 0xFC65,
+    0xF365, 0xFC85, 0xF365, 0xF365, 0xF265, 0xF365, 0xEA85, 0xF265,
+    0xE9C5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x5084, 0xE945, 0xE165, 0xE9C5, 0xE9C5, 0xE9C5, 0xE1A6, 0xEA85,
+    0xE1A6, 0xF285, 0xEA85, 0xF365, 0x5864, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9AA3, 0xF585,
+    0xFC65, 0xFD85, 0xF465, 0xFC85, 0xF365, 0xFC85, 0xF365, 0xFB65,
+    0x9AA3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x5084, 0xE9C5, 0xE9C5, 0xEA65, 0xE9C5, 0xEA85,
+    0xF265, 0xF365, 0xF285, 0xFB65, 0x90E4, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x62A3, 0xFD85, 0xFC65, 0xFC85, 0xF465, 0xFC85, 0xF365, 0xF365,
+    0x5064, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x1842, 0xD264, 0xE9C5, 0xF285,
+    0xF285, 0xF365, 0xF265, 0xF365, 0x5084, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x1842, 0xCC84, 0xCC64, 0xD484, 0xCB84, 0x3222,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3242,
+    0xC165, 0xCB84, 0xF285, 0xD264, 0x1842, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000 },
+  { 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x34C8, 0x6CA6, 0x6E28,
+    0x9CE5, 0x9CE5, 0x3222, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6AA3, 0xD585,
+    0xD686, 0xCF26, 0xA6A7, 0x64A6, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6CA6, 0x4DA8, 0x6E28,
+    0x6608, 0x8667, 0x8667, 0xAEC7, 0x9CE5, 0x3242, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6AA3, 0xCD65, 0xF725,
+    0xF725, 0xF725, 0xD726, 0xCF26, 0xD726, 0x9CE5, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4DA8, 0x55A8, 0x6E08,
+    0x6E28, 0x8667, 0x8667, 0xA6A7, 0xA6C7, 0xD726, 0xCF26, 0xCF26,
+    0xCD65, 0x3222, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x3A42, 0xCC64, 0xFE85, 0xFE65, 0xF725,
+    0xFF25, 0xF725, 0xF725, 0xF725, 0xD726, 0xCF26, 0xCF26, 0xCF26,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x55A8, 0x4DA8, 0x6E08,
+    0x6628, 0x8667, 0x8667, 0xA6A7, 0xA6C7, 0xD726, 0xCF26, 0xF725,
+    0xCF26, 0xFF25, 0xF725, 0xF745, 0x9AA3, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x9AA3, 0xFD85, 0xFD65, 0xF665, 0xFE65, 0xFE65,
+    0xFE65, 0xF725, 0xFF25, 0xF725, 0xF725, 0xF725, 0xD726, 0xF725,
+    0xCF26, 0xD666, 0x0000, 0x0000, 0x0000, 0x3222, 0x2D69, 0x55A8,
+    0x6E28, 0x8667, 0x8667, 0xA6A7, 0xAEC7, 0xCF26, 0xA6A7, 0xD726,
+    0xCF26, 0xF725, 0xFF25, 0xF725, 0xF725, 0xF725, 0xFE65, 0xCC64,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0xCB84, 0xFB65, 0xF485, 0xFC65, 0xFD85, 0xF565, 0xFE85,
+    0xFD65, 0xFE65, 0xF665, 0xF725, 0xF725, 0xFF25, 0xF725, 0xF725,
+    0xCF26, 0xD726, 0xA6C7, 0x3222, 0x0000, 0x0000, 0x6CA6, 0x6628,
+    0x6E08, 0x8667, 0x8667, 0xA6C7, 0xA6A7, 0xCF26, 0xD726, 0xCF26,
+    0xCF26, 0xF725, 0xFF25, 0xF725, 0xF725, 0xF725, 0xFE65, 0xF665,
+    0xFE65, 0xFE85, 0xCC64, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0xCA64, 0xF365, 0xF365, 0xFC85, 0xF465, 0xFD85, 0xFC65, 0xF585,
+    0xFD65, 0xFE65, 0xFE65, 0xFE65, 0xFE65, 0xF725, 0xF725, 0xF725,
+    0xFF25, 0xF725, 0xCF26, 0xD726, 0x9CE5, 0x0000, 0x1822, 0x6E28,
+    0x4DA8, 0x8E67, 0x8667, 0x0000, 0xA6C7, 0xD726, 0xA6A7, 0xCF26,
+    0xD726, 0xF725, 0xF725, 0xF725, 0xFF25, 0xF725, 0xFE65, 0xFE65,
+    0xFD65, 0xF685, 0xFD65, 0xFD65, 0xF485, 0xCB84, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xC165,
+    0xF285, 0xF265, 0xEA85, 0xF365, 0xF365, 0xFC65, 0xF365, 0xFC85,
+    0xF465, 0xFD85, 0xFD65, 0xFE85, 0xF565, 0xFE65, 0xFE65, 0xF725,
+    0xF725, 0xCC64, 0x0000, 0xF725, 0xCF46, 0xD726, 0x1822, 0x34C8,
+    0x6E28, 0x8667, 0x8667, 0xA6A7, 0x9CE5, 0xA6C7, 0xD666, 0xCF26,
+    0xCF26, 0xFE85, 0x3222, 0xF725, 0xCC64, 0xFE65, 0xFE65, 0xFE65,
+    0xF665, 0xFE85, 0xFD65, 0xFD85, 0xF465, 0xFD85, 0xF465, 0xFC85,
+    0x9AA3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xC0C6, 0xE9C5,
+    0xE9C5, 0xEA85, 0xF265, 0xEA85, 0xF265, 0xF365, 0xF365, 0xFC85,
+    0xF465, 0xFD85, 0xF465, 0xFD85, 0xFD65, 0x9CE5, 0xFE65, 0xFE65,
+    0xFE65, 0xF725, 0xCC64, 0x9CE5, 0xFF25, 0xF725, 0xD746, 0x64A6,
+    0x6CA6, 0x6608, 0x6E28, 0x8667, 0x8667, 0xA6A7, 0xAEC7, 0x0000,
+    0xD666, 0xF725, 0xCD65, 0x0000, 0xFD85, 0xCD65, 0x0000, 0x9CE5,
+    0xFD85, 0xFE65, 0xFD65, 0xFD85, 0xF465, 0xFC85, 0xF365, 0xF365,
+    0xF365, 0xFB65, 0xEA65, 0x90C4, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x90E4, 0xE906, 0xE965,
+    0xE145, 0xE9C5, 0xE1A6, 0xE9C5, 0xE9C5, 0xEA85, 0xF285, 0xF365,
+    0xF365, 0xFC85, 0x5064, 0x0000, 0xCB84, 0xCB84, 0x0000, 0xFD85,
+    0xFD85, 0xCC64, 0x9AA3, 0xF745, 0xF725, 0xFF25, 0xCF26, 0xF725,
+    0x9CE5, 0x6628, 0x6E08, 0x8667, 0x8667, 0xA6C7, 0x0000, 0x62A3,
+    0xD726, 0xF725, 0xF725, 0xF725, 0x0000, 0x3242, 0xFD65, 0x0000,
+    0x0000, 0xFE65, 0xFD85, 0xF565, 0xCB84, 0xFC85, 0xF465, 0xFC85,
+    0xF365, 0xF365, 0xF265, 0xF285, 0xE9C5, 0xF285, 0x5884, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x5084, 0xE126, 0xE108, 0xE106,
+    0xE906, 0xE165, 0xE145, 0xE1C5, 0xE9C5, 0xF285, 0xE9C5, 0x9AA3,
+    0xF265, 0xF365, 0xF285, 0x0000, 0x90C4, 0xFC85, 0x0000, 0x1842,
+    0xFD65, 0xFE65, 0xFE65, 0xFE65, 0x1842, 0xCD65, 0xFF25, 0xF725,
+    0xF725, 0xD686, 0x9CE5, 0x8667, 0x8667, 0xAEA7, 0xA6C7, 0xA6A7,
+    0x0000, 0x6AA3, 0xD726, 0xF725, 0xF725, 0xF725, 0xD686, 0xFE65,
+    0xCC64, 0x0000, 0xCC64, 0x9AA3, 0xFC85, 0xF485, 0x9AA3, 0xCA64,
+    0xFB65, 0xF365, 0xF285, 0xEA65, 0xE9C5, 0xE9C5, 0xE145, 0xE1A6,
+    0xE126, 0x1842, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x1842, 0xE8C8, 0xE8E7, 0xE0A8, 0xE8E7,
+    0xE0E7, 0xE106, 0xE126, 0xE965, 0xE145, 0xE9C5, 0xC0C6, 0xC185,
+    0xE9C5, 0xCA64, 0xC165, 0xCA64, 0x0000, 0xF365, 0xCB84, 0xCB84,
+    0xFC85, 0xFD85, 0xF565, 0xFD85, 0x0000, 0x0000, 0xCD65, 0xF725,
+    0xF725, 0xFF25, 0xCE86, 0x8667, 0x8667, 0xA6A7, 0xA6C7, 0xCF26,
+    0xD726, 0xCC64, 0x64A6, 0xF725, 0xFF25, 0xF725, 0xF725, 0xF725,
+    0xFE65, 0xFE85, 0x9AA3, 0xCB84, 0x0000, 0xF485, 0xFC65, 0xF485,
+    0x0000, 0x9AA3, 0xF285, 0xEA65, 0xE9C5, 0xEA85, 0xE9C5, 0xE9C5,
+    0xE965, 0xE165, 0xE906, 0x90C4, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x988B, 0xE0A8, 0xE8AA, 0xE0C8, 0xE0A8,
+    0xE0C8, 0xE108, 0xE8E7, 0xE126, 0xE906, 0xE945, 0x1842, 0x5084,
+    0xE9A6, 0xF285, 0x90E4, 0x98C4, 0x90E4, 0x9AA3, 0xF365, 0xF465,
+    0xFC85, 0xF565, 0xFC85, 0xFD65, 0xFC85, 0xCC64, 0xCB84, 0xF725,
+    0xF725, 0xF725, 0xFF25, 0xF725, 0x9CE5, 0xA6C7, 0xAEA7, 0xA6C7,
+    0xD726, 0xCF26, 0xCE66, 0xD686, 0xF725, 0xF725, 0xCC64, 0x9AA3,
+    0xCC84, 0xFE65, 0xFD65, 0xFD85, 0xFC65, 0x0000, 0xCB84, 0xCA64,
+    0xEA85, 0xF365, 0xCA64, 0xF265, 0x1842, 0xE9C5, 0xE945, 0xE165,
+    0xE145, 0xE165, 0xE108, 0xE8E7, 0xE0E7, 0xC88A, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0xC8AE, 0xE0AA, 0xE8AA, 0xE0A8, 0xE0AA,
+    0xE0C8, 0xE8A8, 0xE0C8, 0xE0E7, 0xC0C6, 0xC0C6, 0xE0E7, 0xC0C6,
+    0xE945, 0xE165, 0xC165, 0xC185, 0x1842, 0xF285, 0xF265, 0xF365,
+    0xF285, 0x9AA3, 0x90C4, 0xFC85, 0xFC85, 0xFD65, 0xF485, 0xFE65,
+    0xFE65, 0xF725, 0xFE65, 0xF725, 0xFD65, 0x9CE5, 0xA6A7, 0xCF26,
+    0xA6C7, 0xD726, 0xCF26, 0x6AA3, 0x9CE5, 0xF725, 0xF725, 0xCD85,
+    0xCC64, 0xCC84, 0xFD65, 0xFD85, 0x62A3, 0xFD65, 0xF485, 0xFC65,
+    0xCA64, 0x0000, 0xEA85, 0xF285, 0xE9C5, 0x90C4, 0xE965, 0x1842,
+    0xC165, 0xE965, 0xE126, 0xE106, 0xE0E7, 0xE8E7, 0xE0A8, 0xE0C8,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0xE0AC, 0xE8AC, 0xE0AC, 0xE0AA, 0xE0AC,
+    0xE8AA, 0xE0AA, 0xE0C8, 0xC88A, 0xC0C6, 0xE8E7, 0x5084, 0xE108,
+    0xE906, 0xE165, 0x0000, 0xE145, 0xE145, 0xE9C5, 0xE9C5, 0xCA64,
+    0xF285, 0xCB84, 0xC185, 0x9AA3, 0xF365, 0xFD65, 0xFD85, 0x62A3,
+    0xCC64, 0xFE65, 0xFE65, 0xF725, 0xF665, 0xCC84, 0x1842, 0xAEC7,
+    0xA6A7, 0xD726, 0xCF26, 0xFF25, 0xCD65, 0x0000, 0xF725, 0xF725,
+    0x0000, 0x0000, 0x0000, 0x62A3, 0xCB84, 0x0000, 0xCB84, 0xFB65,
+    0xFB65, 0xF365, 0x0000, 0x0000, 0xE9C5, 0xE9C5, 0xE145, 0xE165,
+    0xE106, 0xE106, 0xE8E7, 0xE0E7, 0xE0E7, 0xE0E7, 0xE8C8, 0xE0C8,
+    0xE0A8, 0xE0AA, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0xE8AE, 0xE0AC, 0xE0AE, 0xE0AC, 0xE8AC,
+    0xE0AA, 0xE0AC, 0xE0AA, 0xE8AA, 0xE0C8, 0xE0AA, 0xE0A8, 0xE8C8,
+    0xE0E7, 0xE108, 0x0000, 0x0000, 0xE106, 0xE165, 0xE945, 0xC185,
+    0x0000, 0xCA64, 0x0000, 0x0000, 0x0000, 0x62A3, 0xFC85, 0xFC65,
+    0x0000, 0xF585, 0xFD65, 0xFE85, 0xFE65, 0xF665, 0x1822, 0x0000,
+    0x64A6, 0xCF26, 0xCF26, 0xF725, 0xFF25, 0xF725, 0x0000, 0xF725,
+    0xF685, 0xFD65, 0xCC84, 0xFD65, 0xFC85, 0xFD65, 0xCB84, 0xFC85,
+    0x5084, 0xF365, 0xEA85, 0xCA64, 0x0000, 0xE1A6, 0xE9C5, 0xE9C5,
+    0xE965, 0xE106, 0xD127, 0xD127, 0xE8C8, 0xE108, 0xE0A8, 0xE0AA,
+    0xE0AA, 0xE108, 0xE8AA, 0xE0AC, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0xE0B0, 0xE0AE, 0xE0AE, 0xE8AE, 0xE0AE,
+    0xE0AC, 0xE0AE, 0xE8AC, 0xE0AC, 0xE0AA, 0xE108, 0xE0AA, 0xE8AA,
+    0xE0C8, 0xE108, 0x0000, 0x0000, 0xE108, 0xE945, 0xC0C6, 0xC185,
+    0xC165, 0x9AC3, 0xE9C5, 0xCA64, 0xCA64, 0x9AA3, 0x9AA3, 0xFC85,
+    0xF365, 0x0000, 0xFD65, 0xFE65, 0xFE65, 0xFE85, 0x9AA3, 0x0000,
+    0x0000, 0x0000, 0xD666, 0xD726, 0xCF26, 0xF725, 0xF725, 0xFF25,
+    0xFE65, 0xFE65, 0xF565, 0xFD85, 0x9AA3, 0x9AA3, 0xFC85, 0xFC85,
+    0xCA64, 0x9AA3, 0x90C4, 0xF285, 0xE9C5, 0xC165, 0x1842, 0xE965,
+    0xE145, 0xE106, 0x90E4, 0x0000, 0x0000, 0x0000, 0x0000, 0xE8AA,
+    0xE0C8, 0xE0AA, 0xE8AA, 0xE0AC, 0xE0AC, 0xE0AC, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x986B, 0x608B, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x608B, 0x988B, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0xE8B0, 0xE0AE, 0xE0B0, 0xE0AE, 0xE8AE,
+    0xE0AE, 0xE0AE, 0xC88E, 0x0000, 0x0000, 0x0000, 0x0000, 0xC0C6,
+    0xE8C8, 0xE0AA, 0xC88A, 0x0000, 0xE0C8, 0xE0E7, 0xE8E7, 0x90C4,
+    0xC0C6, 0xE165, 0xE945, 0xE9C5, 0x90E4, 0xCA64, 0xF285, 0xF365,
+    0xF365, 0xFC65, 0xF485, 0xFD65, 0xFD85, 0xF665, 0xFD65, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x64A6, 0xCF26, 0xF725, 0xF725, 0xF725,
+    0xFE65, 0xFE85, 0x9AA3, 0xCC64, 0xFD85, 0xF565, 0xFC85, 0xCB84,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xC185, 0xE9C5, 0xE1A6,
+    0xE965, 0xC0C6, 0x0000, 0xE108, 0xE8A8, 0x0000, 0x0000, 0x0000,
+    0x1842, 0xE0AC, 0xE0AC, 0xE0AC, 0xE8AC, 0xE0AE, 0xE0AC, 0xE8AC,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE0B0, 0xE0B0, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0xC8B1, 0xE0B0, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0xE0B0, 0xE0B0, 0xE0B0, 0xE0B0, 0xE0B0,
+    0xE0AE, 0xE0B0, 0xE0AE, 0x0000, 0x0000, 0x0000, 0x0000, 0xE0AC,
+    0xE8AA, 0x0000, 0xE0AA, 0xE0AA, 0xE0C8, 0xE8E7, 0x5884, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x90C4, 0xC165, 0xCA64, 0xF285, 0xEA65,
+    0xF285, 0xCA64, 0xF365, 0xF465, 0xFC85, 0xFD65, 0xFD85, 0x62A3,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFF25, 0xF725, 0xFF25,
+    0xF725, 0xCD65, 0x0000, 0x0000, 0x0000, 0x0000, 0x90C4, 0xFC85,
+    0xFB65, 0x5084, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE945,
+    0xE165, 0xE145, 0xE8E7, 0x0000, 0x0000, 0xE0C8, 0xE0A8, 0x0000,
+    0x0000, 0x0000, 0x5084, 0xE8AC, 0xC8AE, 0xC88A, 0xE8AC, 0xE0AE,
+    0xE0AE, 0xC8AE, 0x0000, 0x0000, 0x0000, 0x0000, 0x986B, 0xE8B0,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x1842, 0xD0B1, 0x588B, 0x0000,
+    0x0000, 0x0000, 0x0000, 0xB0D1, 0xE0B0, 0xE0B0, 0xE0B0, 0xE0B0,
+    0xE8AE, 0xE0B0, 0xC88E, 0x0000, 0x0000, 0x0000, 0x0000, 0xE0AC,
+    0xE0AC, 0x5884, 0x0000, 0xE8AA, 0xE0C8, 0xE0AA, 0xC0C6, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE9C5, 0xE9C5, 0xC165,
+    0x0000, 0x0000, 0x0000, 0x0000, 0xF365, 0xFC85, 0xF485, 0xFC65,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9AA3, 0xF725,
+    0xF725, 0xF725, 0xCD65, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0xFC85, 0xFB65, 0x62A3, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0xE165, 0xE126, 0xE906, 0x90C4, 0x0000, 0x0000, 0xE0AA,
+    0xE8AA, 0x988B, 0x0000, 0x0000, 0x0000, 0xE0AE, 0xE8AE, 0x90C4,
+    0xE0AE, 0xE0B0, 0xE8B0, 0x988B, 0x0000, 0x0000, 0x0000, 0x0000,
+    0xC88E, 0xB0D1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA8B1, 0xB0D1, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x986B, 0xC8B1, 0xE0B0, 0xE0B0, 0xE8B0,
+    0xC8AE, 0xE0B0, 0xE0B0, 0x0000, 0x0000, 0x0000, 0x988B, 0xE0AE,
+    0xE0AE, 0x0000, 0x0000, 0xC88A, 0xE8AA, 0xE108, 0xE8AA, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x5084, 0xE145, 0xC165, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF365, 0xFC85, 0xFD65,
+    0x3242, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0xFF45, 0xF725, 0xFE65, 0xFE65, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x5064, 0xCA64, 0xCA64, 0xFB65, 0xF285, 0x5084, 0x0000, 0x0000,
+    0x1842, 0x2042, 0xD927, 0xE106, 0xE8E7, 0xE0E7, 0x5084, 0x0000,
+    0x0000, 0xA08B, 0xE0AA, 0xE8AA, 0x0000, 0x0000, 0x0000, 0xC88E,
+    0xE0AE, 0x988B, 0xC88E, 0xE8B0, 0xE0B0, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x988B, 0xA8B1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA08B, 0x588B,
+    0x0000, 0x0000, 0x0000, 0x0000, 0xB0B1, 0xC8B1, 0xC8B1, 0xD0AE,
+    0xC88E, 0xE0B0, 0xC8B1, 0x0000, 0x0000, 0x0000, 0xC8AE, 0xE8B0,
+    0x90C4, 0x0000, 0x0000, 0x988B, 0xE8AC, 0xE0AC, 0xE8AA, 0xC88A,
+    0x0000, 0x5084, 0x0000, 0x0000, 0x90E4, 0xE906, 0xE906, 0xE126,
+    0xC0C6, 0x1842, 0x0000, 0x0000, 0x0000, 0x0000, 0xFB65, 0xFC85,
+    0xF485, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0xF725, 0xF725, 0xFF25, 0xFE85, 0x0000, 0x0000, 0x0000,
+    0x9AC3, 0xCB84, 0x98C4, 0x5084, 0x0000, 0xEA85, 0xE9C5, 0xE9C5,
+    0xE145, 0xE165, 0xE926, 0xE106, 0xE0E7, 0xE108, 0xE0C8, 0xE8AA,
+    0xC88A, 0x0000, 0xE0AA, 0xE0AC, 0xE0AC, 0xE8AE, 0xD08E, 0x0000,
+    0x0000, 0x988B, 0xE0B0, 0xE0B0, 0xC8B1, 0xE0B0, 0xC8B1, 0x0000,
+    0x0000, 0x0000, 0x0000, 0xB0D1, 0x608B, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x588B, 0x90D1,
+    0x0000, 0x0000, 0x0000, 0x0000, 0xB0B1, 0xC8B1, 0xA8D1, 0xB0B1,
+    0xC8B1, 0xD0B1, 0x988B, 0x0000, 0x0000, 0xC88E, 0xE0B0, 0xE0B0,
+    0xE0B0, 0x588B, 0x0000, 0xE8AE, 0xE0AE, 0xE0AE, 0xE0AC, 0xE8AC,
+    0xE0AA, 0xE0AC, 0xE0AA, 0xE8AA, 0xE0C8, 0xE108, 0xC88A, 0x0000,
+    0xC0C6, 0xE165, 0xE945, 0x5884, 0x0000, 0x0000, 0x1842, 0xF365,
+    0xF365, 0xFC65, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0xCD65, 0xFF25, 0xFE65, 0xFE65, 0x90C4, 0x0000,
+    0xCB84, 0xF365, 0x0000, 0x0000, 0x0000, 0x0000, 0xE1A6, 0xE9C5,
+    0xE165, 0xE945, 0xE106, 0xE126, 0xE0E7, 0xC0C6, 0x0000, 0x90E4,
+    0xE8A8, 0xE0AA, 0xE8AA, 0xE0AC, 0x988B, 0x1842, 0xE8AC, 0xE8AE,
+    0xE0AE, 0xC88E, 0x0000, 0x0000, 0xE0B0, 0xE0B0, 0xC8B1, 0xC8B1,
+    0x988B, 0x0000, 0x0000, 0x0000, 0xA06B, 0xA8D1, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x90D1,
+    0x608B, 0x0000, 0x0000, 0x0000, 0x988B, 0xB0B1, 0xA8D1, 0xB0B1,
+    0xA8D1, 0xD0B1, 0x0000, 0x0000, 0x986B, 0xE0B0, 0xC8B1, 0xE8B0,
+    0x988B, 0xE0B0, 0xE8AE, 0xE0B0, 0xE0AE, 0xE0AE, 0xC88E, 0xC88A,
+    0xC8AA, 0xE8AC, 0xE0AA, 0xE0AA, 0xE0C8, 0xE8A8, 0xE0C8, 0x90C4,
+    0x0000, 0x0000, 0x0000, 0x5884, 0xC185, 0x5884, 0x0000, 0xC165,
+    0xF285, 0xFB65, 0xCA64, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0xCC64, 0xFE65, 0xFE65, 0xFE85, 0x9CE5,
+    0x5084, 0xFC85, 0x0000, 0x0000, 0x0000, 0x0000, 0xC165, 0xEA85,
+    0xE9C5, 0xE9C5, 0xC0C6, 0xE106, 0xE0E7, 0xE108, 0xE8C8, 0xE8A8,
+    0x0000, 0x0000, 0x1842, 0xE0AC, 0xE8AC, 0x988B, 0x0000, 0x0000,
+    0x986B, 0xE0B0, 0xE0B0, 0xE8B0, 0xC8AE, 0xA8D1, 0xC8B1, 0xE8B0,
+    0xC8B1, 0xD0B1, 0x608B, 0x0000, 0x0000, 0x1842, 0x90D1, 0x608B,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x608B,
+    0x78D1, 0x0000, 0x0000, 0x0000, 0x1842, 0xA8D1, 0x90D1, 0xA8D1,
+    0x90D1, 0xB0D1, 0x1842, 0xB0B1, 0xA8D1, 0xD0B1, 0xC8B1, 0xA8B1,
+    0x0000, 0x0000, 0xC8AE, 0xE0B0, 0xE8B0, 0x588B, 0x0000, 0x0000,
+    0xC88E, 0xE0AE, 0xE8AC, 0xE0AC, 0xE0AA, 0xE0AA, 0xE8C8, 0xE0A8,
+    0xE8C8, 0x0000, 0x0000, 0x0000, 0x0000, 0x90C4, 0xC185, 0x0000,
+    0xE9C5, 0xF365, 0xF365, 0x9AA3, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x62A3, 0xFE65, 0xFD65, 0xFD85,
+    0xFC65, 0xCC84, 0x9AA3, 0x0000, 0x0000, 0x0000, 0x0000, 0xF285,
+    0xE9C5, 0xE1C5, 0xC165, 0xE106, 0x0000, 0x90E4, 0xE8A8, 0xE0C8,
+    0xE8A8, 0xE0AA, 0x5084, 0x0000, 0x608B, 0xE8AC, 0xE0AC, 0xE0AE,
+    0x0000, 0x0000, 0x0000, 0xE0B0, 0xE0B0, 0xE0B0, 0xC8B1, 0xC8B1,
+    0xD0B1, 0xC8B1, 0x988B, 0xB0B1, 0x0000, 0x0000, 0x0000, 0x78F1,
+    0x588B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x608B, 0x6111, 0x0000, 0x0000, 0x0000, 0x78D1, 0x78F1, 0x78D1,
+    0x90D1, 0x90F1, 0x90D1, 0xA8D1, 0xB0D1, 0xA8B1, 0xB0D1, 0x1842,
+    0x0000, 0x0000, 0xD0B1, 0xE0B0, 0xE0B0, 0x986B, 0x0000, 0x5884,
+    0xE8AE, 0xE0AE, 0xE8AC, 0xE0AC, 0x988B, 0x986B, 0xC88A, 0xE8AA,
+    0xE0C8, 0xE8C8, 0xC0C6, 0x0000, 0x0000, 0x0000, 0x0000, 0xC165,
+    0x90E4, 0xF285, 0xF265, 0xF365, 0x5084, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFE65, 0xFE85,
+    0xFD65, 0xFD85, 0xFC85, 0x1842, 0x0000, 0x0000, 0x0000, 0x5084,
+    0xE9C5, 0xE9C5, 0xE145, 0xE965, 0x5884, 0x0000, 0x0000, 0x90C4,
+    0xE0C8, 0xE0AA, 0xE8AA, 0xE8AC, 0x90C4, 0x90E4, 0xE0AC, 0xE0AE,
+    0xE8AE, 0xE0B0, 0xE0B0, 0x608B, 0x1842, 0xE8B0, 0xC8B1, 0x608B,
+    0x0000, 0xC8B1, 0xA8B1, 0xB0D1, 0x90D1, 0x78F1, 0x0000, 0x0000,
+    0x2042, 0x78D1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x1842, 0x6911, 0x1842, 0x0000, 0x0000, 0x6111, 0x78F1, 0x78D1,
+    0x78F1, 0x90D1, 0x78F1, 0x608B, 0x986B, 0xB0D1, 0xB0B1, 0x0000,
+    0x1842, 0xC8B1, 0xC8B1, 0xD0B1, 0xC8B1, 0xE0B0, 0x0000, 0x988B,
+    0xE0B0, 0xE0B0, 0xE0AE, 0xE8AE, 0x5084, 0x0000, 0x0000, 0xC88A,
+    0xE8AA, 0xE0AA, 0xE0C8, 0xE0E7, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x90C4, 0xE9C5, 0xE9C5, 0xF265, 0xF285, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFE65,
+    0xFD65, 0xF565, 0xFC85, 0xF465, 0x1842, 0x0000, 0x0000, 0x0000,
+    0x0000, 0xE9C5, 0xE945, 0xE165, 0xE106, 0xE8E7, 0x1842, 0x0000,
+    0x0000, 0x90E4, 0xE8A8, 0xE0AA, 0xE8AA, 0xE0AC, 0xE0AC, 0xE0AE,
+    0xE8AE, 0xC8AE, 0xE0AE, 0xE0B0, 0xE0B0, 0xE0B0, 0xC8B1, 0xC8B1,
+    0xB0B1, 0x0000, 0x0000, 0x588B, 0x90D1, 0xB0D1, 0x88D1, 0x0000,
+    0x0000, 0x0000, 0x608B, 0x4951, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x4931, 0x608B, 0x0000, 0x0000, 0x0000, 0x4951, 0x6111,
+    0x6911, 0x78F1, 0x190B, 0x0000, 0x0000, 0x90D1, 0x90D1, 0x90F1,
+    0x90D1, 0xA8D1, 0xB0D1, 0xC8B1, 0x986B, 0xD0B1, 0xC8B1, 0xC8B1,
+    0xE8B0, 0xE0B0, 0xE0AE, 0xE0B0, 0x1842, 0x0000, 0x0000, 0x1842,
+    0xD0AE, 0xE8AC, 0xE0A8, 0xE8AA, 0xE0C8, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x90C4, 0xE965, 0xE9C5, 0xE9C5, 0xEA85, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0xFD65, 0xFE85, 0xFD65, 0xF585, 0xFC85, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0xC165, 0xE9C5, 0xE165, 0xE945, 0xE108, 0xE0E7,
+    0xE8C8, 0xE108, 0x90E4, 0xE0AC, 0xE0AA, 0xE0AC, 0xE8AC, 0xE0AE,
+    0xE0AE, 0xE0B0, 0xE0B0, 0xE0B0, 0xE0B0, 0xE8B0, 0xC8B1, 0xC8B1,
+    0xC8B1, 0xD0B1, 0x90D1, 0x0000, 0x0000, 0x588B, 0x90F1, 0x90D1,
+    0x6911, 0x0000, 0x0000, 0x608B, 0x4951, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x4931, 0x608B, 0x0000, 0x0000, 0x4951, 0x6111,
+    0x4931, 0x6111, 0x0000, 0x0000, 0x0000, 0x78D1, 0x78F1, 0x90F1,
+    0x88D1, 0xB0D1, 0x90D1, 0xA8B1, 0xB0D1, 0xC8B1, 0xC8B1, 0xC8B1,
+    0xC8B1, 0xE0B0, 0xE0B0, 0xE8B0, 0xC88E, 0x0000, 0x988B, 0xE0AE,
+    0xE0AC, 0xE8AC, 0xE0AA, 0xE0AC, 0xE8A8, 0x988B, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x90C4, 0xE9C5, 0xE9C5, 0xEA65, 0xCA64, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0xF465, 0xFD85, 0xFD65, 0xF485, 0xFC65, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0xE9C5, 0xE145, 0xE165, 0xE108, 0xE0E7,
+    0xE0A8, 0xE0C8, 0xE8A8, 0xE0AA, 0xE0AA, 0xE0AC, 0xE8AC, 0xE0AE,
+    0xE0AE, 0xE0AE, 0xE8AE, 0xE0B0, 0xE0B0, 0xE0B0, 0xC8B1, 0xC8B1,
+    0xC8B1, 0xC8B1, 0xB0D1, 0xA8B1, 0x1842, 0x0000, 0x0000, 0x78F1,
+    0x78D1, 0x6911, 0x1842, 0x0000, 0x0000, 0x4931, 0x210B, 0x0000,
+    0x0000, 0x0000, 0x190B, 0x5151, 0x0000, 0x0000, 0x1842, 0x5131,
+    0x3191, 0x4951, 0x190B, 0x0000, 0x0000, 0x5131, 0x6111, 0x6911,
+    0x78F1, 0x78F1, 0x78D1, 0x90D1, 0x90F1, 0xA8D1, 0xB0B1, 0xC8B1,
+    0xC8B1, 0xC8B1, 0xD0B1, 0xE0B0, 0xE0B0, 0xE0B0, 0xE0AE, 0xE8AE,
+    0xE0AE, 0xE0AE, 0xE0AC, 0xE8AC, 0xE0AA, 0xE0AA, 0xC0C6, 0x0000,
+    0x0000, 0x0000, 0x0000, 0xC185, 0xE945, 0xE9C5, 0xE9C5, 0xC185,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x9AA3, 0xFD65, 0xF485, 0xFC65, 0xFC85, 0xCA64,
+    0x0000, 0x0000, 0x0000, 0xC185, 0xE165, 0xE106, 0x0000, 0xC0C6,
+    0xE0A8, 0xE108, 0xE8C8, 0xE0AA, 0xE0AA, 0xE0AC, 0xE8AC, 0xE0AE,
+    0xE0AE, 0xE0B0, 0xE0AE, 0xE0B0, 0xE8AE, 0xE0B0, 0xC8B1, 0xD0B1,
+    0xC8B1, 0xC8B1, 0xB0B1, 0xA8D1, 0x90D1, 0xB0D1, 0x0000, 0x0000,
+    0x78F1, 0x6111, 0x210B, 0x6111, 0x0000, 0x0000, 0x210B, 0x4931,
+    0x0000, 0x0000, 0x0000, 0x3191, 0x190B, 0x0000, 0x0000, 0x4951,
+    0x3191, 0x0000, 0x3191, 0x4931, 0x0000, 0x608B, 0x4931, 0x6111,
+    0x6111, 0x78F1, 0x78F1, 0x90D1, 0x78F1, 0x90D1, 0x88D1, 0xB0D1,
+    0xA8B1, 0xD0B1, 0xC8B1, 0xE0B0, 0xC8B1, 0xE0B0, 0xE0B0, 0xE0B0,
+    0xE0AE, 0xE0B0, 0xE0AE, 0xE8AE, 0x988B, 0xC0C6, 0xE0AA, 0xE8AA,
+    0x1842, 0x0000, 0x0000, 0x0000, 0xE106, 0xE965, 0xE145, 0xE9C5,
+    0x5084, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x5084, 0xFD85, 0xFD85, 0xFC65, 0xFC85,
+    0xF365, 0xCA64, 0x0000, 0x0000, 0xC165, 0xE9C5, 0x5084, 0x0000,
+    0x0000, 0x0000, 0xC88A, 0xE8C8, 0xE0AA, 0xE8AC, 0xE0AA, 0xE0AC,
+    0xC88E, 0xC8AE, 0x5884, 0x1842, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x5884, 0xB0B1, 0x90D1, 0x90F1, 0x78F1, 0x78D1,
+    0x588B, 0x6111, 0x0000, 0x0000, 0x4931, 0x608B, 0x0000, 0x0000,
+    0x3191, 0x190B, 0x0000, 0x210B, 0x3191, 0x0000, 0x0000, 0x190B,
+    0x3191, 0x3191, 0x0000, 0x3191, 0x3191, 0x190B, 0x3191, 0x4951,
+    0x4931, 0x6911, 0x4951, 0x608B, 0x1842, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x608B, 0x608B, 0x90D1, 0xB0D1, 0xC8B1, 0xD0B1, 0xE0B0,
+    0xE0B0, 0xE0B0, 0xE0AE, 0xC8AE, 0x0000, 0x0000, 0x0000, 0xE8AA,
+    0xE0A8, 0x90E4, 0x0000, 0x0000, 0xC0C6, 0xE906, 0xE106, 0xE165,
+    0xE9C5, 0x1842, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFD85, 0xF465, 0xFC85,
+    0xF365, 0xF365, 0xF265, 0xEA85, 0xE9C5, 0xE9C5, 0xE165, 0xE165,
+    0xE906, 0xE106, 0xE0C8, 0xE0A8, 0xE8C8, 0xE908, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1842, 0x78F1, 0x90D1,
+    0x78D1, 0x78F1, 0x6911, 0x1842, 0x0000, 0x4951, 0x3191, 0x0000,
+    0x0000, 0x3191, 0x3191, 0x0000, 0x09EE, 0x3191, 0x0000, 0x0000,
+    0x21F2, 0x2212, 0x210B, 0x0000, 0x190B, 0x2212, 0x3191, 0x4951,
+    0x3191, 0x4931, 0x2042, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x1842, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x988B, 0xE0B0, 0xE0B0, 0xE0AE, 0xE0AE, 0xE0AC, 0xE8AC,
+    0xE0AA, 0xE108, 0xC88A, 0xE0A8, 0xE0C8, 0xE926, 0xE106, 0xE145,
+    0xE965, 0xE9C5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCC64, 0xFC85,
+    0xF365, 0xF365, 0xF265, 0xEA85, 0xE9C5, 0xE9C5, 0xE145, 0xE145,
+    0xE106, 0xE126, 0xE8C8, 0xE0A8, 0xE0C8, 0xE0AA, 0xE8AA, 0xE0AA,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x6111, 0x4931, 0x4931, 0x4951, 0x0000, 0x190B, 0x3191,
+    0x210B, 0x0000, 0x1842, 0x2212, 0x2212, 0x21F2, 0x0000, 0x0000,
+    0x210B, 0x2212, 0x2212, 0x0000, 0x1842, 0x21F2, 0x3191, 0x3191,
+    0x3191, 0x190B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0xD0B1, 0xE8B0, 0xE0AE, 0xE8AE, 0xE0AC, 0xE0AE,
+    0xE0AC, 0xE8AC, 0xE0AA, 0xE0AA, 0xE0C8, 0xE8A8, 0xE0C8, 0xE106,
+    0xE106, 0xE965, 0xC185, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCB84,
+    0xF485, 0xFC65, 0xF365, 0xF365, 0xF285, 0xEA85, 0xE9C5, 0xE9C5,
+    0xE165, 0xE106, 0xE8E7, 0xE0E7, 0xE0C8, 0xE0AA, 0xC88A, 0xE8AC,
+    0xE8AC, 0xA08B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x4931, 0x4931, 0x4931, 0x3191, 0x0000,
+    0x2991, 0x2212, 0x0000, 0x3191, 0x2212, 0x1A53, 0x21F2, 0x3191,
+    0x0000, 0x12B4, 0x1A53, 0x2212, 0x0000, 0x1A53, 0x2212, 0x2212,
+    0x09EE, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0xA8B1, 0xE0B0, 0xE0B0, 0xC8B1, 0xE8AE, 0xE0AE,
+    0xE0AC, 0xE0AE, 0xE8AC, 0xE0AC, 0xE0AA, 0xE0AA, 0xE8C8, 0xE0E7,
+    0xE0E7, 0xE145, 0xE965, 0x90C4, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x1842, 0xFC65, 0xFB65, 0xF365, 0xF285, 0xEA65, 0xE9C5, 0xE9C5,
+    0xE145, 0xE165, 0x90C4, 0x0000, 0x90E4, 0xE8A8, 0xE0C8, 0xE8AA,
+    0xE0AA, 0xE0AC, 0xE0AC, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4931, 0x2991, 0x3191,
+    0x3191, 0x190B, 0x3191, 0x2042, 0x09EE, 0x1A73, 0x1A53, 0x12B4,
+    0x09EE, 0x2042, 0x1A53, 0x12B4, 0x0000, 0x1AB4, 0x1A53, 0x1A53,
+    0x210B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x5884, 0xE8B0, 0xE0B0, 0xE0B0, 0xE0AE, 0xE0B0,
+    0xE0AE, 0x988B, 0x1842, 0xE8AC, 0xE8AA, 0xE0AA, 0xE8A8, 0xE0C8,
+    0xE0A8, 0xE108, 0xE108, 0xE165, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0xF485, 0xFC65, 0xF365, 0xF365, 0xF285, 0xF285,
+    0xE1C6, 0xE1A6, 0xE165, 0xE106, 0xC0C6, 0xE108, 0xE8C8, 0xE0AA,
+    0xE0AA, 0xE8AC, 0xC88A, 0xC8AE, 0xE8AE, 0x2042, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4931,
+    0x2991, 0x21F2, 0x3191, 0x2212, 0x1A53, 0x3A42, 0x1AB4, 0x12B4,
+    0x1AB4, 0x190B, 0x1AB4, 0x0B56, 0x210B, 0x1356, 0x12B4, 0x1AB4,
+    0x09EE, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1842, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x608B, 0xC8B1, 0xA8D1, 0xE0B0, 0xE0B0, 0xE0B0,
+    0xE0AE, 0xE8B0, 0xC88E, 0xC8AE, 0xE0AC, 0xE0AC, 0xE0AA, 0xE8AA,
+    0xE0C8, 0xE108, 0xE0E7, 0xE106, 0xE906, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0xCA64, 0xF365, 0xFB65, 0xEA65, 0xF285,
+    0xE9C5, 0xC0C6, 0xE145, 0xE106, 0xE0E7, 0xE0E7, 0xE8C8, 0xE0A8,
+    0xE0C8, 0xE0AA, 0xE8AA, 0xE0AC, 0xC88E, 0xE0AE, 0xC8B1, 0x988B,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1842, 0x3191,
+    0x3191, 0x2212, 0x3191, 0x21F2, 0x2212, 0x12B4, 0x2042, 0x12B4,
+    0x1AB4, 0x0B56, 0x0000, 0x1356, 0x1356, 0x0B33, 0x12B4, 0x1356,
+    0x12B4, 0x1AB4, 0x1A53, 0x210B, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x608B, 0xB0B1, 0xA8D1, 0x986B, 0xD0B1, 0xE0B0,
+    0xE0B0, 0xE0B0, 0xE8AE, 0xE0AE, 0xE0AC, 0xE0AC, 0xE8AA, 0xE0AA,
+    0x988B, 0xE8A8, 0xE0C8, 0xE0E7, 0xE0E7, 0xC0C6, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFC65, 0xF365, 0xF285,
+    0xE9C5, 0xC185, 0x90C4, 0xC185, 0xE126, 0xE906, 0xE0E7, 0xE0A8,
+    0xE0C8, 0xE8AA, 0xE0AA, 0xE0AC, 0xE0AC, 0xE8AE, 0xE8AE, 0x1842,
+    0xD08E, 0xD0AE, 0x5884, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x1842, 0x608B, 0x4951, 0x4931, 0x4931,
+    0x3191, 0x2212, 0x21F2, 0x2042, 0x2212, 0x1AB4, 0x12B4, 0x1356,
+    0x12B4, 0x1356, 0x1356, 0x0BF8, 0x1356, 0x0BD8, 0x0B56, 0x2042,
+    0x12B4, 0x1356, 0x1356, 0x1356, 0x12B4, 0x1AB4, 0x2212, 0x1842,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x1842, 0x78D1, 0xB0D1, 0x588B, 0xC8B1, 0xC8B1, 0xE0B0,
+    0xE0B0, 0xE0B0, 0xE0B0, 0xE0B0, 0xE8AE, 0xE0AE, 0xE0AC, 0xE0AC,
+    0xE8AA, 0x5884, 0xE0A8, 0xE0C8, 0xE0E7, 0xE906, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9AA3, 0xF365,
+    0xF285, 0xF285, 0xE145, 0x90C4, 0x0000, 0xC0C6, 0xE0E7, 0xE8E7,
+    0xE0C8, 0xE0AA, 0xE0AA, 0xE8AA, 0x0000, 0xE0AE, 0xE0AC, 0xC88E,
+    0x0000, 0x1842, 0xE8B0, 0xE0B0, 0xC8B1, 0xC8B1, 0xB0D1, 0xA8B1,
+    0x90D1, 0x78F1, 0x78F1, 0x78D1, 0x6111, 0x6111, 0x4931, 0x4951,
+    0x0000, 0x3191, 0x3191, 0x2212, 0x2212, 0x12B4, 0x1A53, 0x1A53,
+    0x12B4, 0x1356, 0x1356, 0x0BD8, 0x0BD8, 0x0BF8, 0x1356, 0x0BD8,
+    0x0B56, 0x0B33, 0x1356, 0x1356, 0x190B, 0x210B, 0x1A53, 0x1A53,
+    0x2212, 0x2212, 0x09EE, 0x3191, 0x2042, 0x190B, 0x2042, 0x4931,
+    0x608B, 0x78F1, 0x78D1, 0x90D1, 0x0000, 0x0000, 0xB0D1, 0xC8B1,
+    0xC8B1, 0xA08B, 0xE0B0, 0xE0B0, 0xE0AE, 0xE8AE, 0xE0AC, 0xE0AC,
+    0x0000, 0x90C4, 0x988B, 0xE8A8, 0xE8C8, 0xE0E7, 0x90C4, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0xF285, 0xF365, 0xE9C5, 0xE9C5, 0xE165, 0xC0C6, 0xE126, 0xE906,
+    0xE0A8, 0x988B, 0xE8AA, 0xE8AA, 0x5084, 0x0000, 0x986B, 0xE8AE,
+    0xE0AE, 0xE0B0, 0xE0B0, 0xE0B0, 0xC8B1, 0xE8B0, 0xC8B1, 0xC8B1,
+    0xB0D1, 0xA8B1, 0x78F1, 0x608B, 0x6911, 0x6111, 0x0000, 0x0000,
+    0x0000, 0x2042, 0x3191, 0x21F2, 0x2212, 0x12B4, 0x1AD4, 0x09EE,
+    0x0000, 0x1356, 0x0B56, 0x0BD8, 0x0BD8, 0x0C99, 0x0BD8, 0x0000,
+    0x0BD8, 0x0499, 0x0BD8, 0x0BD8, 0x1356, 0x0B33, 0x0000, 0x0000,
+    0x0000, 0x1A53, 0x2212, 0x2212, 0x190B, 0x4951, 0x3191, 0x4931,
+    0x4931, 0x6111, 0x78F1, 0x90F1, 0x90D1, 0xB0B1, 0x988B, 0xC8B1,
+    0xD0B1, 0x588B, 0x0000, 0x608B, 0xE0B0, 0xE0B0, 0x986B, 0xE0AE,
+    0xE0AC, 0xE8AC, 0x5884, 0xE0AC, 0xE0C8, 0xE0A8, 0xE8C8, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x90C4, 0xE9C5, 0xE9C5, 0xE145, 0xE106, 0xE126,
+    0xC0C6, 0x90E4, 0xC88A, 0xE8AA, 0xC88A, 0x0000, 0x0000, 0x1842,
+    0xE8AE, 0xE0AE, 0xE0AE, 0xE0B0, 0x1842, 0x0000, 0xD0B1, 0xA8D1,
+    0xA08B, 0xA8B1, 0x90D1, 0x90F1, 0x588B, 0x6111, 0x0000, 0x0000,
+    0x0000, 0x3191, 0x3191, 0x2991, 0x3191, 0x1A53, 0x2212, 0x09EE,
+    0x0000, 0x0000, 0x1356, 0x0BF8, 0x0BD8, 0x0499, 0x0BD8, 0x0C79,
+    0x0000, 0x0000, 0x0BD8, 0x0499, 0x0BD8, 0x0BD8, 0x1356, 0x1356,
+    0x190B, 0x0000, 0x0000, 0x2212, 0x2212, 0x09EE, 0x3191, 0x3191,
+    0x3191, 0x0000, 0x4931, 0x6911, 0x0000, 0x90D1, 0x90F1, 0xA8D1,
+    0xB0B1, 0xC8B1, 0x0000, 0x0000, 0x0000, 0xE0B0, 0xE8AE, 0xC8AE,
+    0x986B, 0xE8AE, 0xE0AC, 0xE0AC, 0xE8AA, 0xE0AA, 0x90E4, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x90C4, 0xC185, 0xE965,
+    0xE108, 0xE108, 0xC88A, 0xE0A8, 0xE8C8, 0xC88A, 0x5884, 0x5884,
+    0x5084, 0xE0AE, 0xE8AE, 0xD0AE, 0x0000, 0x0000, 0x588B, 0xC8B1,
+    0x90D1, 0x0000, 0xB0D1, 0xA8D1, 0x90D1, 0x90D1, 0x2042, 0x0000,
+    0x0000, 0x4931, 0x3191, 0x2042, 0x1842, 0x2212, 0x2212, 0x1AB4,
+    0x0000, 0x0000, 0x09EE, 0x0BF8, 0x0BD8, 0x0C79, 0x0479, 0x0C79,
+    0x0479, 0x0000, 0x0000, 0x3A22, 0x0479, 0x0C99, 0x0BD8, 0x0000,
+    0x12D4, 0x1356, 0x09EE, 0x0000, 0x0000, 0x2212, 0x2991, 0x3191,
+    0x3191, 0x4931, 0x0000, 0x6111, 0x6911, 0x0000, 0x0000, 0x1842,
+    0x90D1, 0xC8B1, 0xC8B1, 0x0000, 0x0000, 0x0000, 0xC8AE, 0xE0B0,
+    0xE0AE, 0xE0AE, 0xE8AC, 0xE0AC, 0xE8AA, 0x986B, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x1842, 0x5884, 0x98E4, 0xC0C6, 0xC88A, 0xC88A, 0xE8AA,
+    0xC8AE, 0xE0AC, 0xE8AE, 0xE0AE, 0x5084, 0xB0D1, 0x0000, 0xC8B1,
+    0xC8B1, 0xD0B1, 0x0000, 0x986B, 0x90D1, 0x90F1, 0x78F1, 0x6111,
+    0x1842, 0x4931, 0x210B, 0x0000, 0x0000, 0x3191, 0x2212, 0x1A53,
+    0x0000, 0x0000, 0x0000, 0x09EE, 0x0BF8, 0x0479, 0x0BD8, 0x0499,
+    0x0C79, 0x0479, 0x0000, 0x0000, 0x0000, 0x0BD8, 0x0BD8, 0x0BF8,
+    0x210B, 0x0000, 0x210B, 0x12B4, 0x09EE, 0x2042, 0x2212, 0x2212,
+    0x3191, 0x3191, 0x0000, 0x0000, 0x4931, 0x6111, 0x608B, 0x6111,
+    0x190B, 0x78D1, 0xB0D1, 0xD0B1, 0x986B, 0xB0D1, 0x986B, 0xD0AE,
+    0x986B, 0xD0AE, 0x5084, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x2042, 0x1842, 0x0000, 0x1842, 0xE0B0, 0xA06B, 0xC8AE,
+    0xC8B1, 0xC8B1, 0xD0B1, 0xA8B1, 0x608B, 0xB0D1, 0x90D1, 0x78F1,
+    0x6111, 0x6911, 0x606B, 0x0000, 0x0000, 0x0000, 0x2212, 0x1A53,
+    0x0A0E, 0x0000, 0x0000, 0x0000, 0x09EE, 0x0BD8, 0x0BD8, 0x0479,
+    0x0C79, 0x0479, 0x0C79, 0x0000, 0x0000, 0x0000, 0x0000, 0x0499,
+    0x0BD8, 0x0BF8, 0x0000, 0x0000, 0x0000, 0x1AB4, 0x1A53, 0x1A53,
+    0x3191, 0x2212, 0x190B, 0x4931, 0x4931, 0x6911, 0x6111, 0x78F1,
+    0x608B, 0x90D1, 0x1842, 0x0000, 0x0000, 0x608B, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x5884, 0xE8B0, 0xE0AE, 0xE0B0,
+    0xE0B0, 0xE0B0, 0xC8B1, 0xC8B1, 0xB0D1, 0xA8B1, 0x90D1, 0x90F1,
+    0x78F1, 0x6111, 0x4931, 0x4931, 0x0000, 0x0000, 0x190B, 0x2212,
+    0x2212, 0x0000, 0x0000, 0x0000, 0x0000, 0x09EE, 0x0BF8, 0x0C79,
+    0x0C79, 0x0479, 0x0C79, 0x0479, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0B33, 0x0479, 0x0BD8, 0x2042, 0x0000, 0x09EE, 0x1A73, 0x1A53,
+    0x2212, 0x21F2, 0x3191, 0x3191, 0x3191, 0x4931, 0x4951, 0x6911,
+    0x78F1, 0x78D1, 0x90D1, 0xA8D1, 0x1842, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0xC88E, 0xE0AE, 0xE8AE, 0xE0B0,
+    0xE0B0, 0xE0B0, 0xC8B1, 0xD0B1, 0x988B, 0xA8B1, 0xB0D1, 0x90D1,
+    0x78F1, 0x78F1, 0x6111, 0x6911, 0x4931, 0x5151, 0x190B, 0x3191,
+    0x3191, 0x3191, 0x0000, 0x0000, 0x0000, 0x0000, 0x09EE, 0x0BD8,
+    0x0BD8, 0x0479, 0x0C79, 0x0479, 0x0C99, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0BD8, 0x0BF8, 0x1356, 0x0333, 0x1AB4, 0x12B4,
+    0x1A53, 0x1A53, 0x2212, 0x3191, 0x3191, 0x4931, 0x4931, 0x6111,
+    0x6111, 0x78F1, 0x90F1, 0x88D1, 0x90D1, 0xD0B1, 0xB0D1, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x988B, 0xE8AC, 0xE0AE, 0xE8AE, 0xE0AE,
+    0xE0AE, 0xE0B0, 0xC8B1, 0xE0B0, 0xA8B1, 0x0000, 0xB0D1, 0xA8B1,
+    0x90D1, 0x90F1, 0x6111, 0x6111, 0x4931, 0x4951, 0x3191, 0x3191,
+    0x3191, 0x2212, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x09EE,
+    0x0BF8, 0x0479, 0x0BD8, 0x0499, 0x0C79, 0x0479, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x210B, 0x0BD8, 0x0BD8, 0x12B4, 0x1AB4,
+    0x1A53, 0x1A53, 0x2212, 0x2212, 0x3191, 0x3191, 0x3191, 0x1842,
+    0x210B, 0x60F1, 0x78F1, 0x90D1, 0x90D1, 0xB0D1, 0xA8D1, 0xC8B1,
+    0xD0B1, 0x986B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0xE0AC, 0xE0AA, 0xE8AE, 0xE0AC, 0xE0AE,
+    0xE8AE, 0xE0B0, 0xE0B0, 0xE0B0, 0xA8B1, 0xB0D1, 0xA8B1, 0xD0B1,
+    0x78F1, 0xB0D1, 0x90D1, 0x1842, 0x6111, 0x6911, 0x4931, 0x4931,
+    0x3191, 0x2212, 0x210B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x12B4, 0x0BF8, 0x0BD8, 0x0C79, 0x0479, 0x0C79, 0x0479, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0BF8, 0x1356, 0x1356,
+    0x12B4, 0x12B4, 0x1A53, 0x0000, 0x3191, 0x2212, 0x3191, 0x4931,
+    0x4951, 0x4931, 0x6111, 0x78F1, 0x90D1, 0xB0B1, 0xA8D1, 0xC8B1,
+    0xC8B1, 0xE8B0, 0xC8B1, 0xE0B0, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x5084, 0xE8AA, 0xE8AA, 0xE0AC, 0xE0AC, 0xE0AE,
+    0xE8AE, 0xE0AE, 0xE0AE, 0xC8AE, 0xE0B0, 0xE0B0, 0xC8B1, 0xB0B1,
+    0xA8D1, 0x78D1, 0x90D1, 0x90F1, 0x0000, 0x6111, 0x4931, 0x4951,
+    0x3191, 0x4931, 0x3191, 0x2991, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0B33, 0x0B56, 0x0BF8, 0x0BF8, 0x0C79, 0x0BD8, 0x0BF8,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0B33, 0x0B56, 0x1356,
+    0x1AB4, 0x12B4, 0x2212, 0x21F2, 0x0000, 0x3191, 0x3191, 0x3191,
+    0x3191, 0x4931, 0x4951, 0x6111, 0x78F1, 0x90D1, 0x90D1, 0xB0D1,
+    0xA8D1, 0xD0B1, 0xC8B1, 0xE0B0, 0xE0B0, 0xE0B0, 0x1842, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0xC0C6, 0xE8A8, 0xE0C8, 0xE0AC, 0xE0AA, 0xE8AC,
+    0xE0AC, 0xE0AE, 0xE8AE, 0xE0B0, 0xC8B1, 0xE0B0, 0xC8B1, 0xD0B1,
+    0xA8B1, 0xD0B1, 0x588B, 0xB0D1, 0x90F1, 0x90D1, 0x6111, 0x6911,
+    0x4931, 0x4931, 0x190B, 0x3191, 0x3191, 0x2212, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x1AB4, 0x1356, 0x0B56, 0x0BF8, 0x0BD8, 0x0C79,
+    0x0BD8, 0x0000, 0x0000, 0x0000, 0x0000, 0x3242, 0x1356, 0x1356,
+    0x1A53, 0x0B33, 0x12B4, 0x1A53, 0x2212, 0x2991, 0x3191, 0x3191,
+    0x3191, 0x4951, 0x4931, 0x6111, 0x6111, 0x90F1, 0x90D1, 0x78D1,
+    0xA8D1, 0x78D1, 0xB0D1, 0xC8B1, 0xC8B1, 0xE0B0, 0xE0B0, 0xE0B0,
+    0xA06B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0xC0C6, 0xE0E7, 0xE0C8, 0xE0AA, 0xE8AA, 0xE0AC,
+    0xE0AC, 0xE0AE, 0xE8AC, 0xE0AE, 0x5084, 0x5884, 0xE8B0, 0xE0B0,
+    0x0000, 0xC8B1, 0xA8B1, 0x90D1, 0x90F1, 0x88D1, 0x78F1, 0x78F1,
+    0x6111, 0x6111, 0x0000, 0x0000, 0x210B, 0x3191, 0x2991, 0x210B,
+    0x0000, 0x0000, 0x0000, 0x12B4, 0x12B4, 0x1356, 0x1356, 0x0BD8,
+    0x0BF8, 0x0BD8, 0x0000, 0x0000, 0x0000, 0x0000, 0x1356, 0x0B56,
+    0x1AB4, 0x0000, 0x0000, 0x1A53, 0x2212, 0x2212, 0x3191, 0x3191,
+    0x3191, 0x4931, 0x4931, 0x6111, 0x210B, 0x0000, 0x78F1, 0x90D1,
+    0x0000, 0x90D1, 0xA8D1, 0xD0B1, 0xC8B1, 0xE0B0, 0xE0B0, 0xE0B0,
+    0xE8AE, 0xE0AE, 0xC8AE, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0xE906, 0xE106, 0xE0E7, 0xE108, 0xE0C8, 0xE8AA,
+    0xE0AA, 0xE0AC, 0xE0AC, 0xE8AE, 0xE0AE, 0xE0B0, 0xC8B1, 0xE0B0,
+    0xE8B0, 0xC88E, 0xC8B1, 0xC8B1, 0xB0D1, 0xA8D1, 0x90D1, 0x90D1,
+    0x78F1, 0x78D1, 0x6911, 0x190B, 0x0000, 0x0000, 0x3191, 0x2212,
+    0x3191, 0x0000, 0x0000, 0x0000, 0x1AB4, 0x1356, 0x0B56, 0x1356,
+    0x1356, 0x0BD8, 0x1356, 0x0000, 0x0000, 0x0000, 0x09EE, 0x1356,
+    0x12B4, 0x0000, 0x0000, 0x0000, 0x2212, 0x1A53, 0x2212, 0x2212,
+    0x3191, 0x4931, 0x4951, 0x6111, 0x6111, 0x608B, 0x6111, 0x90D1,
+    0x78D1, 0x78F1, 0xA8B1, 0xC8B1, 0xC8B1, 0xE0B0, 0xE0B0, 0xE0B0,
+    0xE0B0, 0xE0B0, 0xE0AE, 0xE8AE, 0xE0AC, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0xD127, 0xE126, 0xE0E7, 0xE8E7, 0xE0C8, 0xE0A8,
+    0xE0C8, 0xE8AC, 0xC88E, 0xE0AC, 0xE0AC, 0xE8AE, 0xE0AE, 0xE0B0,
+    0xE0B0, 0xE0B0, 0xC8B1, 0xC8B1, 0xA8D1, 0xB0B1, 0x90D1, 0x88F1,
+    0x90D1, 0x78F1, 0x6111, 0x6111, 0x4931, 0x0000, 0x0000, 0x0000,
+    0x3191, 0x2212, 0x1842, 0x0000, 0x2212, 0x1A53, 0x1A53, 0x1AB4,
+    0x12B4, 0x1356, 0x1AB4, 0x0333, 0x1AB4, 0x0000, 0x0000, 0x1356,
+    0x12B4, 0x09EE, 0x0000, 0x0000, 0x09EE, 0x2212, 0x3191, 0x3191,
+    0x3191, 0x3191, 0x3191, 0x4931, 0x4951, 0x6911, 0x6111, 0x78F1,
+    0x90D1, 0xB0D1, 0x88D1, 0xB0D1, 0xA8B1, 0xD0B1, 0xC8B1, 0xE0B0,
+    0xE0B0, 0xE0B0, 0xE8AE, 0xE0AE, 0xE0AC, 0xE0AC, 0xC8AE, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0xE165, 0xE965, 0xE106, 0xE106, 0xE0E7, 0xE8E7,
+    0xE0C8, 0xE8AA, 0x986B, 0x0000, 0xC8AE, 0xE0AE, 0xE0AE, 0xE8AE,
+    0xE0AE, 0xE0B0, 0xE8AE, 0xC8B1, 0xC8B1, 0xC8B1, 0xB0B1, 0xB0D1,
+    0x90D1, 0x0000, 0x6111, 0x78F1, 0x6111, 0x6911, 0x4931, 0x0000,
+    0x0000, 0x2991, 0x3191, 0x3191, 0x2042, 0x2212, 0x0000, 0x12B4,
+    0x1A53, 0x1AB4, 0x12B4, 0x1356, 0x0000, 0x0B33, 0x0000, 0x09EE,
+    0x1AB4, 0x12B4, 0x0000, 0x0000, 0x190B, 0x1A53, 0x2212, 0x2212,
+    0x3191, 0x0000, 0x3191, 0x4931, 0x4931, 0x6111, 0x6111, 0x78F1,
+    0x78F1, 0x90D1, 0x90D1, 0xA8D1, 0xB0B1, 0xC8B1, 0xD0B1, 0x988B,
+    0x1842, 0xE0B0, 0xE0B0, 0xE0AE, 0xE8AE, 0xE0AE, 0xE0AC, 0xE8AC,
+    0xC88A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x90C4, 0xE9C5, 0xE165, 0xE945, 0xE108, 0xE0E7,
+    0xE0C8, 0xE0A8, 0xE8C8, 0xE0AA, 0x0000, 0x0000, 0xE0AC, 0xE0AC,
+    0x0000, 0x0000, 0x986B, 0xE8B0, 0xC8B1, 0xE0B0, 0xC8B1, 0xC8B1,
+    0xB0D1, 0x588B, 0x0000, 0x0000, 0x6111, 0x608B, 0x0000, 0x6111,
+    0x4931, 0x0000, 0x0000, 0x3191, 0x3191, 0x2212, 0x190B, 0x0000,
+    0x2212, 0x1A53, 0x1A53, 0x1AB4, 0x1A53, 0x0000, 0x09EE, 0x09EE,
+    0x1A53, 0x1AB4, 0x190B, 0x0000, 0x210B, 0x2212, 0x210B, 0x0000,
+    0x3191, 0x1842, 0x0000, 0x0000, 0x4931, 0x6911, 0x6111, 0x78F1,
+    0x78D1, 0x90D1, 0x608B, 0x0000, 0x1842, 0xB0D1, 0xD0B1, 0x1842,
+    0x0000, 0xD0AE, 0xE0AE, 0xE0B0, 0xE8AE, 0xE0AE, 0xE0AC, 0xE0AC,
+    0xE8AA, 0xE0AA, 0x90C4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0xEA85, 0xE9C5, 0xE9C5, 0xE945, 0xE165,
+    0xE0E7, 0xE108, 0xE0A8, 0xE8AA, 0xE0AA, 0xA08B, 0x5084, 0xE8AE,
+    0xC88E, 0x0000, 0x0000, 0xC8AE, 0xE0B0, 0xE0B0, 0xE0B0, 0xE0B0,
+    0xD0B1, 0xD0B1, 0x1842, 0x0000, 0x0000, 0x608B, 0x78F1, 0x0000,
+    0x0000, 0x6111, 0x4931, 0x0000, 0x3191, 0x4931, 0x3191, 0x0000,
+    0x0000, 0x2212, 0x21F2, 0x1A53, 0x2212, 0x1A53, 0x0000, 0x210B,
+    0x1A53, 0x1AB4, 0x1A53, 0x1842, 0x210B, 0x2212, 0x190B, 0x0000,
+    0x3191, 0x4931, 0x0000, 0x0000, 0x0000, 0x6111, 0x6111, 0x78F1,
+    0x78F1, 0x90D1, 0x90D1, 0xA8D1, 0x0000, 0x0000, 0x90D1, 0xE0B0,
+    0x988B, 0x0000, 0xE0B0, 0xE0B0, 0xE0AE, 0xE0AE, 0xE8AE, 0xE0AE,
+    0xE0AC, 0xE108, 0xE0AA, 0xE8AA, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x5084, 0xE9C5, 0xE9C5, 0xE145, 0xE965,
+    0xE106, 0xE106, 0xE0C8, 0xE8C8, 0xE0A8, 0xE0AA, 0xE0AA, 0xC88A,
+    0xE8AC, 0xE0AE, 0x0000, 0x0000, 0xE0AE, 0xE0B0, 0xE0B0, 0xE0B0,
+    0xC8AE, 0x1842, 0xB0D1, 0x608B, 0x0000, 0x0000, 0x0000, 0x78D1,
+    0x6111, 0x0000, 0x0000, 0x4931, 0x4951, 0x4931, 0x3191, 0x3191,
+    0x0000, 0x0000, 0x3191, 0x2212, 0x2991, 0x2212, 0x2212, 0x0000,
+    0x0000, 0x21F2, 0x2212, 0x2212, 0x3191, 0x21F2, 0x190B, 0x0000,
+    0x0000, 0x3191, 0x2042, 0x0000, 0x0000, 0x0000, 0x4931, 0x4951,
+    0x2042, 0x90D1, 0x90F1, 0x90D1, 0xA8D1, 0xA08B, 0x0000, 0xC8B1,
+    0xC8B1, 0xC88E, 0xD0AE, 0xE0B0, 0xE0AE, 0xE8AE, 0xE0AC, 0xE0AE,
+    0xE0AC, 0xE8AC, 0xE0AA, 0xE0AA, 0xE0A8, 0x5884, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x5064, 0xEA85, 0xE9C5, 0xE9C5,
+    0xE165, 0xE965, 0xE106, 0xE108, 0xE0A8, 0xC0C6, 0xE0C8, 0xE8AA,
+    0xE0AA, 0xE8AA, 0xE8AC, 0x1842, 0x986B, 0xE0B0, 0xE0B0, 0xE0B0,
+    0xE0B0, 0xE0B0, 0xC8B1, 0xD0B1, 0xB0D1, 0x78F1, 0x90D1, 0x78D1,
+    0x78F1, 0x90F1, 0x190B, 0x0000, 0x0000, 0x5131, 0x4931, 0x4931,
+    0x190B, 0x0000, 0x0000, 0x3191, 0x3191, 0x2212, 0x3191, 0x2212,
+    0x0000, 0x0000, 0x09EE, 0x2212, 0x3191, 0x2212, 0x0000, 0x0000,
+    0x0000, 0x4931, 0x3191, 0x210B, 0x190B, 0x608B, 0x190B, 0x6111,
+    0x6111, 0x90F1, 0x90D1, 0xA8D1, 0x90D1, 0xB0B1, 0xA8D1, 0x608B,
+    0xC8B1, 0xD0B1, 0x986B, 0xE0B0, 0xE0B0, 0xC8B1, 0xE0AE, 0xE0AE,
+    0xE0AC, 0xE8AC, 0xE0AA, 0xE0AA, 0xE0C8, 0xE8AA, 0x5884, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5884, 0xF285, 0xF285,
+    0xE9C5, 0xE9C5, 0xE106, 0xE106, 0xE0E7, 0xE0E7, 0x5884, 0x0000,
+    0xE8C8, 0xE0AC, 0xE0AA, 0xE0AC, 0xE8AC, 0xE0AE, 0xE0AE, 0xE0B0,
+    0x986B, 0x0000, 0xC8B1, 0xE8B0, 0xA8D1, 0x78D1, 0x588B, 0x78F1,
+    0xA06B, 0x90D1, 0x78F1, 0x78F1, 0x6111, 0x190B, 0x0000, 0x6111,
+    0x4931, 0x2042, 0x0000, 0x0000, 0x3191, 0x3191, 0x2991, 0x3191,
+    0x3191, 0x0000, 0x0000, 0x0000, 0x3191, 0x2991, 0x2042, 0x0000,
+    0x190B, 0x4931, 0x3191, 0x4951, 0x5131, 0x4951, 0x608B, 0x6111,
+    0x6911, 0x78F1, 0x78D1, 0x1842, 0x0000, 0xB0D1, 0xB0B1, 0xC8B1,
+    0xC8B1, 0xE8B0, 0xC8B1, 0xE0B0, 0xE0B0, 0x988B, 0x0000, 0xC88E,
+    0xE8AC, 0xE0AC, 0xE8AA, 0xE0AA, 0xE0C8, 0xE0AA, 0xE8A8, 0x1842,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xEA85,
+    0xE9C5, 0xF285, 0xE1A6, 0xE965, 0xE126, 0xE906, 0x90C4, 0xC0C6,
+    0xE0C8, 0xE0AA, 0xE0AA, 0xE8AC, 0xE0AC, 0xE0AE, 0xE0AE, 0xE8AE,
+    0xE0AE, 0xA06B, 0xC8B1, 0xC8AE, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x78F1, 0x90D1, 0x78F1, 0x90D1, 0x78D1, 0x78F1,
+    0x6111, 0x6911, 0x0000, 0x0000, 0x0000, 0x4951, 0x3191, 0x4931,
+    0x3191, 0x4951, 0x0000, 0x0000, 0x0000, 0x4931, 0x3191, 0x4951,
+    0x3191, 0x5131, 0x190B, 0x5151, 0x4931, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x190B, 0x78D1, 0x608B, 0x1842, 0xB0D1, 0xC8B1,
+    0xC8B1, 0xE0B0, 0xE0B0, 0xE0B0, 0xE0B0, 0xE0B0, 0xC8B1, 0xA06B,
+    0x5084, 0xE0AE, 0xE8AC, 0xE0AC, 0xE0AA, 0xE0AA, 0xE8C8, 0xE108,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0xEA65, 0xF285, 0xE9C5, 0xE9C5, 0xE145, 0xE145, 0xE108, 0xE0E7,
+    0xC0C6, 0xE0C8, 0xE0A8, 0xE8AA, 0xE0AA, 0xE0AC, 0xE0AC, 0xE8AE,
+    0xC8AE, 0xE0AE, 0xE0AE, 0xC88E, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0xB0D1, 0x88D1, 0x0000, 0x0000, 0x1842,
+    0x6911, 0x78F1, 0x608B, 0x0000, 0x0000, 0x0000, 0x4931, 0x4931,
+    0x3191, 0x4951, 0x3191, 0x0000, 0x0000, 0x0000, 0x190B, 0x4931,
+    0x3191, 0x210B, 0x0000, 0x0000, 0x4951, 0x6911, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x608B, 0xA8D1, 0xD0B1,
+    0xA8B1, 0xC8B1, 0xD0B1, 0xE0B0, 0xE0B0, 0xE0B0, 0xE0AE, 0xE8AE,
+    0xE0AE, 0xC88A, 0xE0AC, 0xE0AC, 0xE8AA, 0xE0AA, 0xE0C8, 0xE0C8,
+    0xE8A8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0xF365, 0xEA85, 0xEA85, 0xE9C5, 0xE9C5, 0xE945, 0xE165,
+    0xE0E7, 0xE108, 0xE0A8, 0xE8AA, 0xC0C6, 0xE0AC, 0xE0AA, 0xE0AC,
+    0xE8AC, 0xE0AC, 0xC8AE, 0xE0B0, 0xE8AE, 0xA06B, 0x1842, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0xA8D1, 0xB0D1, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x608B, 0x608B, 0x0000, 0x0000, 0x0000, 0x6111,
+    0x4931, 0x6911, 0x4951, 0x5131, 0x0000, 0x0000, 0x0000, 0x4951,
+    0x4931, 0x0000, 0x0000, 0x0000, 0x0000, 0x6111, 0x6911, 0x1842,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x1842, 0xB0B1, 0xA8D1, 0xC8B1,
+    0xB0B1, 0x78F1, 0xC8B1, 0xE0B0, 0xE0B0, 0xE0B0, 0xE0AE, 0xE0B0,
+    0xE0AE, 0xE0AE, 0xE8AC, 0xE0AC, 0xE0AA, 0xE0AC, 0xE8AA, 0xE0A8,
+    0xE0C8, 0xD127, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0xCA64, 0xF265, 0xE9C5, 0xE9C5, 0xE145, 0xE165,
+    0xE106, 0xE106, 0xE8E7, 0xE0E7, 0xC8AA, 0x0000, 0xC88A, 0xE0AA,
+    0xE0AA, 0xE8AC, 0xE0AC, 0xE0AE, 0x0000, 0xC8AE, 0xC8B1, 0xE0B0,
+    0xE0B0, 0xE0B0, 0xC8B1, 0xD0B1, 0xC8B1, 0xC8B1, 0x988B, 0x0000,
+    0x0000, 0x0000, 0x608B, 0x90D1, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x608B, 0x6111, 0x4931, 0x6111, 0x608B, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x6111, 0x190B, 0x0000, 0x0000, 0x0000, 0x6911, 0x78F1,
+    0x78F1, 0x90D1, 0x90D1, 0x90F1, 0x90D1, 0xA8D1, 0xB0D1, 0xA8B1,
+    0x0000, 0x90D1, 0xC8B1, 0xE0B0, 0xE0B0, 0xE0B0, 0xC8AE, 0x0000,
+    0xA08B, 0xE0AE, 0xE8AC, 0xE0AC, 0xE0AA, 0xE0AC, 0xE8A8, 0xE0AA,
+    0xE0C8, 0xE0E7, 0x90C4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0xCA64, 0xEA65, 0xF285, 0xE9C5, 0xE9C5,
+    0xE165, 0xE165, 0xE106, 0xE906, 0xE0E7, 0xE108, 0xE0C8, 0xE0AA,
+    0xE8AA, 0xE0AC, 0xE8AC, 0xE8AE, 0x1842, 0x0000, 0x0000, 0x0000,
+    0x588B, 0xD0B1, 0xC88E, 0xC8AE, 0xC8B1, 0xE0B0, 0xD0B1, 0xB0B1,
+    0x0000, 0x0000, 0x1842, 0xB0D1, 0x90D1, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x78F1, 0x78D1, 0x6111, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x6111, 0x78F1, 0x1842, 0x0000, 0x0000, 0x78D1,
+    0x78F1, 0x90F1, 0x90D1, 0xB0B1, 0x78F1, 0x78D1, 0x1842, 0x0000,
+    0x0000, 0x0000, 0x0000, 0xE0B0, 0xE0B0, 0xE0B0, 0xE0B0, 0xE0B0,
+    0xE0AE, 0xE0AE, 0xE0AE, 0xE8AE, 0xE0AC, 0xE0AC, 0xE0AA, 0xE8AA,
+    0xE0C8, 0xE108, 0xE8E7, 0x5884, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x90C4, 0xFB65, 0xEA85, 0xF285,
+    0xE9C5, 0xE9C5, 0xE145, 0xE145, 0xE106, 0xE0E7, 0xE0C8, 0xE8C8,
+    0xE0A8, 0xE0AA, 0xE0AA, 0xE8AC, 0xC88A, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x988B, 0x988B, 0xC8B1,
+    0xB0B1, 0x0000, 0x588B, 0xB0D1, 0xB0B1, 0x588B, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x190B, 0x608B, 0x2042, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x608B, 0x78F1, 0x78D1, 0x1842, 0x0000,
+    0x78F1, 0x90D1, 0x90D1, 0x608B, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x988B, 0xE8B0, 0xE0AE, 0xE0B0,
+    0xE8AE, 0xE0AE, 0xE0AC, 0xE0AC, 0xE8AC, 0xE0AC, 0xE0AA, 0xE0AA,
+    0xE8C8, 0xE0A8, 0xE0C8, 0xE0E7, 0x5884, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3242, 0xFB65, 0xF365,
+    0xEA85, 0xEA85, 0xE9C5, 0xE9C5, 0xE906, 0xE106, 0xE108, 0xE0E7,
+    0xE0C8, 0xE8AA, 0xE0A8, 0xE8AA, 0xE8AA, 0x1842, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xC8AE, 0xB0B1, 0x988B,
+    0xC8B1, 0xC8B1, 0xB0B1, 0xC8B1, 0xB0D1, 0xC8B1, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x90F1, 0x88D1, 0x90D1,
+    0x78F1, 0xB0D1, 0x88D1, 0x90D1, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE0B0, 0xE0B0,
+    0xE0AE, 0xE0AE, 0xE0AE, 0xE8AE, 0xE0AC, 0xE0AC, 0xE0AA, 0xE8AA,
+    0xE0C8, 0xE0AA, 0xE0A8, 0xE8E7, 0xE8E7, 0x1842, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF365,
+    0xF265, 0xF285, 0xE9C5, 0xE1C5, 0x90C4, 0x0000, 0x0000, 0xE906,
+    0xC0C6, 0x0000, 0x0000, 0xC0C6, 0xE0C8, 0xE0AA, 0xC88E, 0xE8AC,
+    0xE0AC, 0xC8AE, 0x986B, 0x5884, 0x0000, 0x0000, 0x988B, 0xD0B1,
+    0xE0B0, 0xE0B0, 0xC8B1, 0xC8B1, 0xD0B1, 0xC8B1, 0x986B, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x608B, 0x90D1,
+    0x90F1, 0xA8D1, 0xB0B1, 0xA8D1, 0x90D1, 0x5884, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x1842, 0xA08B, 0xC88E, 0xE8AE, 0xA8D1, 0xE0B0,
+    0xE8AE, 0xC88E, 0x1842, 0x0000, 0x608B, 0xE8AC, 0x588B, 0x0000,
+    0x988B, 0xE8A8, 0xE0C8, 0xE8E7, 0xE0E7, 0xE106, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0xF365, 0xF365, 0xF285, 0xEA85, 0xE9C5, 0x0000, 0x0000, 0x0000,
+    0xE106, 0xE906, 0x5884, 0xC0C6, 0xE0C8, 0xE0AA, 0xE0AA, 0xE8AC,
+    0xE0AA, 0xE0AC, 0xE0AC, 0xE8AE, 0xE0AE, 0xE0AE, 0xE8AE, 0xE0B0,
+    0xE0B0, 0xE0B0, 0xE0B0, 0xE0B0, 0xC8B1, 0xC8B1, 0xB0B1, 0xB0D1,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x78D1,
+    0x1842, 0xB0D1, 0xA8B1, 0xC8B1, 0xB0D1, 0xC8B1, 0xC8B1, 0xD0B1,
+    0xC88E, 0xC8B1, 0xE0B0, 0xE0B0, 0xE0B0, 0xE0B0, 0xE0B0, 0xE0B0,
+    0xE0AE, 0xE0AE, 0xE8AE, 0x988B, 0x0000, 0xC88E, 0xE8AA, 0x988B,
+    0x0000, 0x0000, 0xC0C6, 0xE0E7, 0xE0E7, 0xE926, 0xE106, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0xF365, 0xFB65, 0xF365, 0xF285, 0xE1A6, 0x0000, 0x0000,
+    0x0000, 0xC165, 0xE106, 0xE126, 0xE8E7, 0xE0E7, 0xE0C8, 0xE0A8,
+    0xE8C8, 0xE0AA, 0xE0AA, 0xE0AC, 0xE8AC, 0xE0AE, 0xE0AC, 0xE0AE,
+    0xE8AE, 0xE0B0, 0xE0AE, 0xE0B0, 0xE0B0, 0xE0B0, 0x588B, 0xC8B1,
+    0x1842, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x608B, 0xB0B1, 0x0000, 0xD0B1, 0xA8D1, 0xC8B1, 0xD0B1, 0xC8B1,
+    0xC8B1, 0xE0B0, 0xC8B1, 0xE8B0, 0xE0B0, 0xE0B0, 0xE0AE, 0xE0B0,
+    0xE0AE, 0xE8AE, 0xE0AC, 0xE0AE, 0xE0AC, 0xE8AC, 0xE0AA, 0xE0AA,
+    0x0000, 0x0000, 0x0000, 0x1842, 0xE8E7, 0xE106, 0xE906, 0xC0C6,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x9AA3, 0xFC85, 0xF365, 0xFB65, 0xC165, 0x0000,
+    0x0000, 0x0000, 0x5084, 0xE965, 0xE126, 0xE106, 0xE0E7, 0xE8E7,
+    0x98C4, 0x90E4, 0xE0AA, 0xE0AC, 0xE0AA, 0xE8AC, 0xE0AC, 0xE0AE,
+    0xE0AE, 0xE8AE, 0xE0AE, 0xE0B0, 0xE0AE, 0xE8B0, 0x986B, 0xC8B1,
+    0xE0B0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0xD0B1, 0x988B, 0x608B, 0xC8B1, 0xC8B1, 0xE0B0,
+    0xC8B1, 0xE0B0, 0xE0B0, 0xE0B0, 0xE0B0, 0xE0B0, 0xE0B0, 0xE0B0,
+    0xE0AE, 0xE8AE, 0xC8AE, 0xE0AE, 0xE0AC, 0xE8AC, 0xE0AA, 0xE0AC,
+    0xC0C6, 0x0000, 0x0000, 0x0000, 0x0000, 0xE106, 0xE906, 0xE165,
+    0x90E4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x5084, 0xFB65, 0xFB65, 0xEA85, 0xC165,
+    0x0000, 0x0000, 0x0000, 0xE906, 0xE165, 0xE165, 0xE108, 0x90C4,
+    0x0000, 0x0000, 0x988B, 0xE8AA, 0xE8A8, 0xE0AA, 0xE0AA, 0xE0AC,
+    0xC8AE, 0xE8AE, 0xE0AC, 0xE0AE, 0xE8AE, 0xE0B0, 0xE0AE, 0x0000,
+    0xC8B1, 0xC88E, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0xA8D1, 0xB0B1, 0x0000, 0xC8B1, 0xE0B0,
+    0xC8B1, 0xE8B0, 0xE0B0, 0xE0B0, 0xC8AE, 0xE0B0, 0xE0AE, 0xE8AE,
+    0xE0AE, 0xE0AE, 0xC88E, 0x0000, 0x0000, 0x988B, 0xE8AA, 0xE0AA,
+    0xE8A8, 0xE0AA, 0x0000, 0x0000, 0x0000, 0x5084, 0xE108, 0xE965,
+    0xE145, 0x1842, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFC85, 0xF365, 0xFB65,
+    0x90E4, 0x0000, 0x0000, 0x0000, 0xE1A6, 0xE9C5, 0xE165, 0xE906,
+    0x0000, 0x0000, 0x90C4, 0xE0E7, 0xE0C8, 0xE8AA, 0x98C4, 0x90E4,
+    0xE0AA, 0xE0AC, 0xE0AC, 0xE8AE, 0x0000, 0xC88E, 0xE0AE, 0xE8AE,
+    0x988B, 0xE8B0, 0x2042, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x1842, 0xE8B0, 0x1842, 0x986B,
+    0xE0B0, 0xC8B1, 0x1842, 0xE0B0, 0xE0B0, 0xE0B0, 0xE8AE, 0xC8AE,
+    0x986B, 0xE8AE, 0xE0AE, 0xE8AE, 0x988B, 0x0000, 0x0000, 0x986B,
+    0xE0AA, 0xE8AA, 0xE8C8, 0x0000, 0x0000, 0x0000, 0x1842, 0xE145,
+    0xE965, 0xE9C5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCB84, 0xF485,
+    0xF365, 0x9AA3, 0x0000, 0x0000, 0x0000, 0xE9A6, 0xE165, 0xE145,
+    0xE906, 0x90E4, 0x5084, 0xE8E7, 0xE8C8, 0xE0A8, 0x988B, 0x0000,
+    0xC88A, 0xE8AA, 0xE0AA, 0x5084, 0x0000, 0xA08B, 0xE0AC, 0xE8AE,
+    0xE0AE, 0xE0AE, 0xC88E, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xC8B1, 0xE0B0,
+    0xE8AE, 0xE0B0, 0xE0AE, 0x588B, 0x0000, 0x608B, 0xE8AE, 0xE0AE,
+    0xC8AE, 0x0000, 0x986B, 0xE8AC, 0xE0AC, 0xE8AC, 0x1842, 0x90E4,
+    0xE8A8, 0xE0AA, 0xE8C8, 0xE0A8, 0x0000, 0x0000, 0x0000, 0x90E4,
+    0xD127, 0xE945, 0xC185, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCB84,
+    0xFC85, 0xCA64, 0x9AC3, 0x90E4, 0x0000, 0x0000, 0x0000, 0xE9C5,
+    0xE1A6, 0xE165, 0xE906, 0xE165, 0xE106, 0xE906, 0x98E4, 0x0000,
+    0x5084, 0xE0AA, 0xE8AA, 0x0000, 0x0000, 0xC88E, 0xE0AC, 0xE0AC,
+    0xE8AC, 0x988B, 0xE8AE, 0x986B, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x988B,
+    0xE0B0, 0xC8B1, 0xE8AE, 0xE0B0, 0xE0AE, 0x986B, 0x0000, 0x0000,
+    0xE8AE, 0xE8AE, 0x1842, 0x0000, 0x90E4, 0xE0AC, 0xE8AA, 0xE0AA,
+    0xC88A, 0xE0C8, 0xE0A8, 0xE8E7, 0x98E4, 0x0000, 0x0000, 0x0000,
+    0x90C4, 0xE165, 0xE9C5, 0xC165, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x5064, 0xFD85, 0xFB65, 0x5084, 0xCA64, 0x0000, 0x0000, 0x0000,
+    0xC965, 0xE9C5, 0xE165, 0xE945, 0xE106, 0xE126, 0x90E4, 0xC0C6,
+    0xE8A8, 0xE0E7, 0xE0C8, 0xE8A8, 0x988B, 0xE0AA, 0xE8AA, 0xE0AC,
+    0x5084, 0x0000, 0xE8AC, 0xE0AC, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0xE0B0, 0xE8AE, 0x0000, 0x588B, 0xE8AE, 0xE0AE, 0xE0AC,
+    0x0000, 0xE0AE, 0xE8AC, 0xE0AC, 0xC88E, 0x0000, 0x5084, 0xE8AA,
+    0xE8C8, 0xE0A8, 0xE0C8, 0xE0E7, 0xE8A8, 0x0000, 0x0000, 0x0000,
+    0x90E4, 0x90C4, 0xC185, 0xE9C5, 0x1842, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0xFD65, 0xFD85, 0x5084, 0x9AA3, 0xF365, 0xF285,
+    0x0000, 0xEA85, 0xE9C5, 0xE9C5, 0xE1A6, 0xE9C5, 0xE165, 0xE965,
+    0xE106, 0xE126, 0xE0E7, 0x0000, 0xC88A, 0xE8AA, 0xE0C8, 0xC88A,
+    0x0000, 0x0000, 0xE0AA, 0xE8AC, 0x5884, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x5084, 0xE8AE, 0xE0AE, 0x0000, 0x0000, 0xE0AA,
+    0xE0AC, 0xE8AE, 0xE8AC, 0x5084, 0xC88A, 0xE108, 0xE0AA, 0xE0AA,
+    0xE8C8, 0xE0AA, 0xE0A8, 0xE0E7, 0xE8E7, 0xE108, 0x0000, 0x5884,
+    0x98E4, 0xC165, 0x1842, 0xE9C5, 0xF1C5, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0xFC85, 0xFC65, 0xF365, 0x0000, 0x9AA3,
+    0xF285, 0xF365, 0xEA85, 0x5064, 0x0000, 0x98E4, 0x0000, 0xE945,
+    0xE165, 0xE145, 0xC0C6, 0x0000, 0x0000, 0xC88A, 0xE8C8, 0x5084,
+    0x0000, 0x5884, 0xE8C8, 0xE0AA, 0x986B, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x988B, 0xE8AE, 0xE8AC, 0x0000,
+    0x0000, 0x5084, 0xE8AA, 0xE0AA, 0x0000, 0x0000, 0xC88A, 0xE0AA,
+    0xE8C8, 0xE0A8, 0x5084, 0x5884, 0x0000, 0x1842, 0xE908, 0xE906,
+    0xC0C6, 0x90E4, 0x0000, 0x5884, 0xE9C5, 0xCA64, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x9AA3, 0xFD65, 0xFC85, 0x0000,
+    0x0000, 0x9AC3, 0xF365, 0x9AA3, 0x0000, 0x0000, 0x0000, 0x0000,
+    0xE165, 0xE9C5, 0xE165, 0x0000, 0x0000, 0xE906, 0xE8E7, 0x0000,
+    0x0000, 0x1842, 0xE0A8, 0xE0AA, 0xE0C8, 0xC8AA, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE8AC, 0xE0AC, 0xC88A,
+    0xE8AC, 0x5084, 0x0000, 0x0000, 0xE0AA, 0xE8AC, 0x0000, 0x0000,
+    0xE0A8, 0xE0E7, 0xE8C8, 0x0000, 0x0000, 0x0000, 0x0000, 0x90C4,
+    0xE965, 0xC165, 0x0000, 0x0000, 0x90C4, 0xF285, 0x90E4, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFD85, 0xFD85,
+    0x0000, 0xF465, 0xF365, 0x90C4, 0x0000, 0x0000, 0x0000, 0x0000,
+    0xC985, 0xE9C5, 0xE145, 0x90E4, 0x0000, 0xE945, 0xC0C6, 0x0000,
+    0x0000, 0x0000, 0xC88A, 0xE0C8, 0xE0C8, 0xE8A8, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE0AC,
+    0xE0AA, 0xC88A, 0xC8AE, 0x1842, 0x0000, 0x0000, 0xE8C8, 0xE8A8,
+    0x0000, 0x5084, 0xE8C8, 0xE0E7, 0xC0C6, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x90C4, 0xE965, 0xC165, 0x0000, 0xF285, 0xEA85, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFD65,
+    0xFD85, 0xFD65, 0xFC85, 0xFC85, 0x5064, 0x0000, 0x0000, 0x0000,
+    0x0000, 0xEA85, 0xF265, 0xF285, 0x5084, 0xE9C5, 0xE165, 0x0000,
+    0x0000, 0x0000, 0xE8E7, 0xE126, 0xE0E7, 0xE108, 0xC0C6, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0xC88A, 0xE108, 0xE0AA, 0xE8AA, 0xE0A8, 0x0000, 0x0000, 0x0000,
+    0xE0C8, 0xE108, 0x0000, 0xE108, 0xE0E7, 0xE945, 0x90C4, 0x0000,
+    0x0000, 0x0000, 0x0000, 0xE1C5, 0xE9C5, 0xF285, 0xF265, 0xF365,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x9AA3, 0xFE85, 0xF565, 0x9AA3, 0xFC85, 0xFC85, 0xCB84, 0xCA64,
+    0xCA64, 0xF365, 0xEA65, 0x0000, 0xE9C5, 0xE9C5, 0xC165, 0x0000,
+    0x0000, 0x0000, 0x90E4, 0xE906, 0xE106, 0xE126, 0xE0E7, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0xE8C8, 0xE0A8, 0xE0C8, 0xE0A8, 0x988B, 0x0000,
+    0x0000, 0x0000, 0xC0C6, 0xE108, 0xE906, 0x90E4, 0xC0C6, 0xE945,
+    0xC0C6, 0x90E4, 0x90C4, 0xE9C5, 0xE9C5, 0x1842, 0xCA64, 0xFB65,
+    0x90E4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0xFE65, 0xFD85, 0xCB84, 0xFD85, 0xCB84, 0xF365,
+    0x9AA3, 0xFC85, 0xFB65, 0x0000, 0x5064, 0xF365, 0xF285, 0xEA85,
+    0xE9C5, 0xE9C5, 0xE145, 0xE165, 0xE945, 0xE165, 0xE906, 0x90E4,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0xC0C6, 0xE0A8, 0xE0E7, 0xE0C8, 0xE8E7,
+    0xE0C8, 0xD127, 0xC0C6, 0xD127, 0xE906, 0xE165, 0xE106, 0x0000,
+    0xE145, 0xE9C5, 0x90C4, 0xE9C5, 0xE9C5, 0xF285, 0xCA64, 0xF365,
+    0xFB65, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0xF665, 0xFD65, 0x0000, 0x9AA3, 0x3242,
+    0x9AA3, 0xFC85, 0xFB65, 0x62A3, 0x0000, 0xF365, 0xF285, 0xF265,
+    0xEA85, 0xF265, 0xE9C5, 0xE1C5, 0xE145, 0xE9C5, 0xE165, 0xE145,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE8E7, 0xE0C8, 0xE0E7,
+    0xE0E7, 0xE906, 0xE108, 0xE106, 0xE126, 0xE165, 0xE945, 0xE1A6,
+    0x0000, 0x5084, 0xE9C5, 0xCA84, 0xC165, 0x98E4, 0x90C4, 0x5884,
+    0xFB65, 0xF365, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x62A3, 0xFE65, 0xFD85, 0xFD65,
+    0xCC84, 0xF565, 0xFC85, 0xF465, 0x0000, 0xFC85, 0xFB65, 0xCA64,
+    0xC185, 0xCA64, 0xC165, 0xEA85, 0xE9C5, 0xF285, 0xE9C5, 0xF1C5,
+    0x1842, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5084, 0xE106,
+    0xE106, 0xE965, 0xE106, 0xE165, 0xC0C6, 0xC0C6, 0xC165, 0xC165,
+    0xE9C5, 0xE9C5, 0x0000, 0xEA85, 0xF285, 0xFB65, 0x90C4, 0xF365,
+    0xFB65, 0xFC85, 0x1842, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFD65, 0xFE85,
+    0xF565, 0xFE65, 0xFD65, 0x5084, 0x9AA3, 0xFC85, 0xFC85, 0xF365,
+    0xCA64, 0xCA64, 0xF265, 0xF365, 0xF285, 0xEA65, 0xE9C5, 0xE9C5,
+    0x90C4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0xC0C6, 0xE165, 0xE106, 0xE965, 0xE145, 0xE9C5, 0xE165, 0xC165,
+    0x90E4, 0xE9C5, 0xE9C5, 0xC165, 0xC185, 0x90C4, 0xF285, 0xFB65,
+    0xF365, 0xFC85, 0xCB84, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x62A3,
+    0xFE85, 0xFF25, 0xCC84, 0x9AA3, 0x5084, 0xFD65, 0xFD85, 0x9AC3,
+    0x90C4, 0xFC65, 0xF365, 0xFC85, 0xF365, 0xF365, 0xF265, 0xEA85,
+    0xE9C5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0xE165, 0xE9C5, 0xE145, 0xE9C5, 0xE1C5, 0xE9C5,
+    0xE9C5, 0xF285, 0xC965, 0x5084, 0xF285, 0xFB65, 0x90C4, 0x62A3,
+    0xCA64, 0xF465, 0xFC85, 0x3222, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0xFE65, 0xFE65, 0x0000, 0x9CE5, 0xCC64, 0xFD65, 0xFD85,
+    0x9AA3, 0xFD85, 0xF465, 0xFC85, 0xF365, 0xFC65, 0xF365, 0xF365,
+    0xF285, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0xE1A6, 0xE9C5, 0xE9C5, 0xEA85,
+    0xE9C5, 0xEA65, 0xF285, 0xEA65, 0x90C4, 0xCB84, 0xFB65, 0xCA64,
+    0x90E4, 0x9AA3, 0xFC85, 0xFC85, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x1842, 0xF725, 0xFE65, 0xFE65, 0xF665, 0xFE65,
+    0xCC64, 0xFE85, 0xFD65, 0xF585, 0xFC65, 0xFD85, 0xF465, 0xFC85,
+    0xF365, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE9C5, 0xEA65,
+    0xF285, 0xF365, 0xF265, 0xF365, 0xF365, 0xFC85, 0xF365, 0xF465,
+    0xFC85, 0xF465, 0xFC85, 0xF565, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0xCB84, 0xFF25, 0xFE65, 0xFE65,
+    0xF665, 0xFE65, 0xFD65, 0xFD85, 0xF565, 0xFD85, 0xFC65, 0xF485,
+    0xFC65, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0xC165, 0xF365, 0xF285, 0xF365, 0xF365, 0xF365, 0xF365, 0xFC85,
+    0xF365, 0xFC65, 0xF485, 0xFD65, 0x62A3, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCD65, 0xF725,
+    0xFE65, 0xF725, 0xFE65, 0xFE85, 0xF565, 0xFE65, 0xFD85, 0xFD65,
+    0xFC85, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x90C4, 0xF365, 0xF365, 0xFC85, 0xF465, 0xFC85,
+    0xF465, 0xFD85, 0xFD65, 0xFD85, 0xCB84, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x9CE5, 0xF725, 0xFE65, 0xF725, 0xFE65, 0xFE65, 0xFD65, 0xFD85,
+    0x62A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x5064, 0xFC85, 0xFC85, 0xFC65,
+    0xF485, 0xFD65, 0xFD85, 0xFD65, 0x9AA3, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x3222, 0xFE65, 0xFE65, 0xFE85, 0xFD85, 0x9AA3,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9AA3,
+    0xCC84, 0xFD65, 0xFD85, 0xCD85, 0x5084, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000 },
+  { 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x34C8, 0x152A, 0x150A,
+    0x152A, 0x34C8, 0x3A22, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3A42, 0x4DA8,
+    0x2D49, 0x2D69, 0x3CC8, 0x34C8, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3CC8, 0x04EA, 0x04EA,
+    0x04EA, 0x04EA, 0x04EA, 0x2D69, 0x34C8, 0x3222, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x62A3, 0x6CA6, 0x55A8,
+    0x152A, 0x04EA, 0x04EA, 0x04EA, 0x150A, 0x55A8, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x150A, 0x04EA, 0x04EA,
+    0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x152A,
+    0x3CC8, 0x3222, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x3A42, 0x9CE5, 0x6E28, 0x2D49, 0x2D49,
+    0x152A, 0x150A, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x2D69,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x150A, 0x04EA, 0x04EA,
+    0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA,
+    0x04EA, 0x04EA, 0x04EA, 0x2D49, 0x64A6, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x9CE5, 0xAEC7, 0x8667, 0x8667, 0x6E08, 0x6E28,
+    0x4DA8, 0x55A8, 0x2D69, 0x150A, 0x04EA, 0x04EA, 0x04EA, 0x04EA,
+    0x04EA, 0x55A8, 0x0000, 0x0000, 0x0000, 0x3A42, 0x04EA, 0x04EA,
+    0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA,
+    0x04EA, 0x04EA, 0x04EA, 0x150A, 0x152A, 0x2D49, 0x2D69, 0xA4E5,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0xCD65, 0xA6C7, 0xA6C7, 0xAEA7, 0xA6C7, 0x8667, 0x8667,
+    0x6E08, 0x4DA8, 0x2D49, 0x2D69, 0x150A, 0x152A, 0x04EA, 0x04EA,
+    0x04EA, 0x04EA, 0x04EA, 0x3A22, 0x0000, 0x0000, 0x150A, 0x04EA,
+    0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA,
+    0x04EA, 0x04EA, 0x04EA, 0x152A, 0x150A, 0x55A8, 0x4DA8, 0x6E08,
+    0x6628, 0x8667, 0x9CE5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0xCD65, 0xFF25, 0xCF26, 0xCF26, 0xCF26, 0xD726, 0xA6C7, 0xAEA7,
+    0x8667, 0x8667, 0x6E28, 0x6E28, 0x4DA8, 0x55A8, 0x2D49, 0x0D2A,
+    0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x6CA6, 0x0000, 0x1842, 0x152A,
+    0x04EA, 0x04EA, 0x150A, 0x0000, 0x2D69, 0x04EA, 0x04EA, 0x04EA,
+    0x04EA, 0x04EA, 0x04EA, 0x150A, 0x152A, 0x2D49, 0x3569, 0x55A8,
+    0x6E28, 0x8667, 0x8667, 0xA6A7, 0xA6C7, 0xD565, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFC65,
+    0xFE85, 0xF725, 0xF725, 0xF725, 0xCF26, 0xFF25, 0xCF26, 0xCF26,
+    0xA6A7, 0xA6C7, 0x8667, 0x8667, 0x6E08, 0x6E28, 0x2D49, 0x2D49,
+    0x152A, 0x6CA6, 0x0000, 0x04EA, 0x04EA, 0x2D49, 0x1842, 0x34C8,
+    0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x3CC8, 0x4DA8, 0x2D49, 0x04EA,
+    0x04EA, 0x55A8, 0x3242, 0x2D49, 0x6CA6, 0x6E08, 0x4DA8, 0x6E28,
+    0x6608, 0x8667, 0x8667, 0xA6C7, 0xA6A7, 0xD726, 0xCF46, 0xF725,
+    0xCC64, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF365, 0xFE65,
+    0xFE65, 0xF725, 0xF725, 0xFF25, 0xF725, 0xF725, 0xF725, 0xFF25,
+    0xCF26, 0xD726, 0xA6A7, 0xA6C7, 0x8667, 0x9CE5, 0x6E08, 0x6E28,
+    0x55A8, 0x4DA8, 0x64A6, 0x6CA6, 0x04EA, 0x04EA, 0x152A, 0x6CA6,
+    0x152A, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x150A, 0x04EA, 0x0000,
+    0x2D69, 0x04EA, 0x3CC8, 0x0000, 0x6CA6, 0x6E28, 0x0000, 0x9CE5,
+    0x6E08, 0x8667, 0x8667, 0xA6C7, 0xA6A7, 0xD726, 0xCF26, 0xD726,
+    0xCF26, 0xF725, 0xFE65, 0xCB84, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCA64, 0xFC65, 0xFD85,
+    0xF565, 0xFE85, 0xFE65, 0xFE65, 0xF665, 0xF725, 0xFE65, 0xF725,
+    0xCF26, 0xFF25, 0x62A3, 0x0000, 0xCD65, 0xCD65, 0x0000, 0x8667,
+    0x6E28, 0x6E28, 0x9AA3, 0x2D49, 0x152A, 0x150A, 0x04EA, 0x04EA,
+    0x6CA6, 0x2D69, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x0000, 0x3CC8,
+    0x04EA, 0x04EA, 0x04EA, 0x2D49, 0x0000, 0x3222, 0x6E28, 0x0000,
+    0x0000, 0x8667, 0x8667, 0xA6A7, 0x9CE5, 0xCF26, 0xCF26, 0xF725,
+    0xFF25, 0xF725, 0xF725, 0xF725, 0xFE65, 0xFE85, 0x9AC3, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x90C4, 0xFC65, 0xF485, 0xFC65,
+    0xF485, 0xFD65, 0xFD65, 0xFE65, 0xFE85, 0xF725, 0xFD65, 0xCD65,
+    0xF725, 0xFF25, 0xFE85, 0x0000, 0xCB64, 0xD686, 0x0000, 0x1842,
+    0x8667, 0x8667, 0x6E08, 0x6E28, 0x1842, 0x6E28, 0x150A, 0x152A,
+    0x04EA, 0x4DA8, 0x150A, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x55A8,
+    0x0000, 0x6AA3, 0x04EA, 0x0D2A, 0x150A, 0x2D69, 0x55A8, 0x4DA8,
+    0xA4E5, 0x0000, 0x9CE5, 0x9CE5, 0xAEC7, 0xCF26, 0xCC64, 0xCD65,
+    0xD746, 0xF725, 0xF725, 0xFF25, 0xFE65, 0xFE65, 0xF565, 0xFE65,
+    0xFC65, 0x1842, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x1842, 0xF285, 0xFB65, 0xF365, 0xF365,
+    0xF365, 0xFC65, 0xFC85, 0xF565, 0xFD85, 0xFE65, 0xF365, 0xFC65,
+    0xF685, 0xFD65, 0xCC64, 0xFD85, 0x0000, 0xFE65, 0xCE86, 0xCD65,
+    0xA6C7, 0xA6A7, 0x8667, 0x8667, 0x0000, 0x0000, 0x64A6, 0x2D49,
+    0x152A, 0x150A, 0x34C8, 0x2D69, 0x04EA, 0x04EA, 0x04EA, 0x04EA,
+    0x150A, 0x55A8, 0x6CA6, 0x2D69, 0x150A, 0x2D69, 0x2D49, 0x55A8,
+    0x4DA8, 0x8667, 0x9CE5, 0x9CE5, 0x0000, 0xCF26, 0xCF26, 0xFF25,
+    0x0000, 0x9CE5, 0xF725, 0xF725, 0xFE65, 0xF725, 0xF665, 0xFE65,
+    0xFD85, 0xFD65, 0xF485, 0xCA64, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0xC165, 0xE9C5, 0xF285, 0xEA65, 0xFB65,
+    0xF365, 0xF485, 0xFC65, 0xF485, 0xFC65, 0xFD85, 0x5864, 0x62A3,
+    0xFE85, 0xFF25, 0x9AC3, 0x9AA3, 0xCB64, 0x9CE5, 0xF725, 0xFF25,
+    0xCF26, 0xD726, 0xA6C7, 0xA6A7, 0x8667, 0xA6C7, 0xA4E5, 0x55A8,
+    0x2D69, 0x2D49, 0x152A, 0x55A8, 0x2D49, 0x04EA, 0x04EA, 0x04EA,
+    0x04EA, 0x04EA, 0x152A, 0x55A8, 0x150A, 0x2D69, 0x6CA6, 0x64A6,
+    0x9CE5, 0x8667, 0x6E28, 0xAEA7, 0xA6C7, 0x0000, 0xD666, 0xCC64,
+    0xCE86, 0xFF25, 0xCE86, 0xFE65, 0x5064, 0xFE85, 0xFD65, 0xFD65,
+    0xFD85, 0xFD65, 0xFC85, 0xF465, 0xF365, 0xF285, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0xE0E8, 0xE165, 0xE9C5, 0xE9C5, 0xEA85,
+    0xF265, 0xEA85, 0xF265, 0xF365, 0xEA85, 0xCA64, 0xF365, 0xFB65,
+    0xFD65, 0xCD85, 0xCC64, 0xF365, 0x1842, 0xFF25, 0xF725, 0xF725,
+    0xD686, 0xCC64, 0x9AA3, 0xCE86, 0xA6C7, 0xA6C7, 0x9CE5, 0x6E08,
+    0x4DA8, 0x55A8, 0x2D49, 0x152A, 0x34C8, 0x4DA8, 0x04EA, 0x04EA,
+    0x04EA, 0x04EA, 0x04EA, 0x34C8, 0x6CA6, 0x2D49, 0x2D49, 0x6E28,
+    0x9CE5, 0x8667, 0x8667, 0xA6C7, 0x9AA3, 0xCF26, 0xD726, 0xF725,
+    0xCD65, 0x0000, 0xFE85, 0xF725, 0xFD65, 0xCA64, 0xFD85, 0x1842,
+    0xCC64, 0xFD85, 0xF465, 0xFC85, 0xF365, 0xF365, 0xF285, 0xEA85,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0xE906, 0xE106, 0xE165, 0xE145, 0xE9C5,
+    0xE9C5, 0xEA85, 0xF285, 0xE1A6, 0xE1A6, 0xF285, 0x90C4, 0xFC65,
+    0xF485, 0xFD65, 0x0000, 0xF485, 0xFD65, 0xFE65, 0xFE65, 0xFD65,
+    0xFE65, 0xFE85, 0xCC64, 0x9CE5, 0xCE66, 0xD726, 0xA6C7, 0x6AA3,
+    0x9CE5, 0x6E28, 0x55A8, 0x4DA8, 0x2D49, 0xA4E5, 0x3A42, 0x2D49,
+    0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x6CA6, 0x0000, 0x152A, 0x4DA8,
+    0x0000, 0x0000, 0x0000, 0xA2A3, 0x8667, 0x0000, 0xCD85, 0xD686,
+    0xCF26, 0xFF25, 0x0000, 0x0000, 0xFE65, 0xFE65, 0xF565, 0xFD65,
+    0xFD85, 0xF465, 0xFC85, 0xF465, 0xF365, 0xFB65, 0xEA85, 0xF265,
+    0xE9C5, 0xE9C5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0xE108, 0xE0E7, 0xE106, 0xE106, 0xE165,
+    0xE165, 0xE9C5, 0xE1A6, 0xE9C5, 0xE1A6, 0xF285, 0xF285, 0xF365,
+    0xF365, 0xFC85, 0x0000, 0x0000, 0xF465, 0xFE85, 0xFD65, 0xCC64,
+    0x0000, 0xF585, 0x0000, 0x0000, 0x0000, 0x9CE5, 0xA6C7, 0xD666,
+    0x0000, 0xA6C7, 0x6608, 0x6E28, 0x4DA8, 0x6E08, 0x1842, 0x0000,
+    0x34C8, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x2D49, 0x0000, 0x2D49,
+    0x55A8, 0x8667, 0x9CE5, 0xA6C7, 0xA6A7, 0xCF46, 0xCD65, 0xFF25,
+    0x62A3, 0xF725, 0xF725, 0xFE65, 0x0000, 0xF565, 0xFE65, 0xFE85,
+    0xFD65, 0xF485, 0xFB65, 0xF365, 0xEA65, 0xF365, 0xF285, 0xEA85,
+    0xE9C5, 0xF285, 0xE9C5, 0xE1A6, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0xE0AA, 0xE0C8, 0xE108, 0xE8E7, 0xE106,
+    0xE106, 0xE165, 0xE965, 0xE1A6, 0xE145, 0xE1C5, 0xE9C5, 0xF265,
+    0xF285, 0xF365, 0x0000, 0x0000, 0xF465, 0xFD85, 0xCB84, 0xF365,
+    0xFC65, 0xCB84, 0xF665, 0xFD85, 0xFD65, 0xCC84, 0xCC64, 0xD726,
+    0xD666, 0x0000, 0xA6C7, 0x8667, 0x6E08, 0x6E28, 0x6CA6, 0x0000,
+    0x0000, 0x0000, 0x152A, 0x04EA, 0x04EA, 0x150A, 0x152A, 0x2D49,
+    0x3569, 0x55A8, 0x4DA8, 0x8667, 0xA2A3, 0x9CE5, 0xA6C7, 0xD726,
+    0xCD65, 0xCC84, 0xCC64, 0xFE85, 0xFE65, 0xFC65, 0x5064, 0xFD85,
+    0xFD85, 0xFC65, 0xCA64, 0x0000, 0x0000, 0x0000, 0x0000, 0xEA85,
+    0xE9C5, 0xE9C5, 0xE145, 0xE145, 0xE106, 0xE108, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0xC8AA, 0x90E4, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0xA06B, 0xC88A, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0xE0AA, 0xE8C8, 0xE0C8, 0xE0A8, 0xE0C8,
+    0xE8A8, 0xE0E7, 0xE0C8, 0x0000, 0x0000, 0x0000, 0x0000, 0xD127,
+    0xE9C5, 0xF285, 0xE1A6, 0x0000, 0xF365, 0xFC85, 0xF365, 0xCA64,
+    0xFC65, 0xF585, 0xFD65, 0xFE85, 0xCB64, 0xFD85, 0xF725, 0xF725,
+    0xCF26, 0xCF26, 0xA6C7, 0xA6A7, 0x8667, 0x8667, 0x9CE5, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x6CA6, 0x04EA, 0x04EA, 0x152A, 0x2D49,
+    0x2D49, 0x6628, 0x6CA6, 0x8667, 0x8667, 0xA6A7, 0xA6C7, 0xCD85,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCD65, 0xFE65, 0xF585,
+    0xFD65, 0xCB84, 0x0000, 0xFC85, 0xF285, 0x0000, 0x0000, 0x0000,
+    0x1842, 0xE9C5, 0xE145, 0xE165, 0xE926, 0xE106, 0xE0E7, 0xE108,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE0AC, 0xE8AC, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0xE0AC, 0xE0AE, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0xE0AC, 0xE8AA, 0xE0AC, 0xE0AA, 0xE0AA,
+    0xE8A8, 0xE0C8, 0xE0C8, 0x0000, 0x0000, 0x0000, 0x0000, 0xE106,
+    0xE945, 0x0000, 0xE1A6, 0xEA85, 0xF285, 0xFB65, 0x90C4, 0x0000,
+    0x0000, 0x0000, 0x1842, 0x9AA3, 0xFD65, 0xFE65, 0xFE85, 0xF725,
+    0xFD65, 0xCD65, 0xD686, 0xD726, 0xA6A7, 0xA6C7, 0x8667, 0x6CA6,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2D49, 0x04EA, 0x152A,
+    0x2D49, 0x6E28, 0x0000, 0x0000, 0x0000, 0x0000, 0x6AA3, 0xD726,
+    0xCF26, 0x3222, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFC85,
+    0xFD65, 0xFD85, 0xF365, 0x0000, 0x0000, 0xF365, 0xF265, 0x0000,
+    0x0000, 0x0000, 0x5084, 0xE945, 0xE108, 0xD127, 0xE8E7, 0xE0E7,
+    0xE0C8, 0xE0AA, 0x0000, 0x0000, 0x0000, 0x0000, 0x986B, 0xE8AC,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x1842, 0xE8AE, 0x988B, 0x0000,
+    0x0000, 0x0000, 0x0000, 0xC88E, 0xE8AC, 0xE0AC, 0xE8AA, 0xE0AA,
+    0xE0AA, 0xE0AA, 0xE8AA, 0x0000, 0x0000, 0x0000, 0x0000, 0xE108,
+    0xE106, 0x5084, 0x0000, 0xE9C5, 0xE9C5, 0xF285, 0xE1A6, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFE85, 0xFE85, 0xCC64,
+    0x0000, 0x0000, 0x0000, 0x0000, 0xCE86, 0xCF26, 0xA6A7, 0xA6C7,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x34C8, 0x152A,
+    0x150A, 0x4DA8, 0x6628, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0xFF25, 0xF725, 0x9AA3, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0xF585, 0xFC65, 0xFC85, 0xC165, 0x0000, 0x0000, 0xF285,
+    0xE9C5, 0x988B, 0x0000, 0x0000, 0x1842, 0xE108, 0xE8AA, 0x986B,
+    0xE0C8, 0xE8AA, 0xE0AA, 0x986B, 0x0000, 0x0000, 0x0000, 0x0000,
+    0xE8AE, 0xC8AE, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD0B1, 0xC8B1, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x986B, 0xE0AE, 0xE0AE, 0xE8AC, 0xE0AE,
+    0xE0AC, 0xE0AC, 0xE8AC, 0x0000, 0x0000, 0x0000, 0x988B, 0xE108,
+    0xE0A8, 0x0000, 0x0000, 0xE108, 0xE165, 0xE9C5, 0xE9C5, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x90C4, 0xFD65, 0xCC64, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFE65, 0xD726, 0xCF26,
+    0x6AA3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x150A, 0x2D69, 0x2D49, 0x6E28, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x5864, 0xD585, 0xD585, 0xF725, 0xFF25, 0x9AA3, 0x0000, 0x0000,
+    0x5084, 0x5884, 0xFB65, 0xFC85, 0xF365, 0xF365, 0x90C4, 0x0000,
+    0x0000, 0xC965, 0xE165, 0xE108, 0x0000, 0x0000, 0x0000, 0xE8AA,
+    0xE0A8, 0xC88A, 0xC8AE, 0xE0AA, 0xE8AA, 0x0000, 0x0000, 0x0000,
+    0x0000, 0xA8D1, 0xC88E, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xC8AE, 0x986B,
+    0x0000, 0x0000, 0x0000, 0x1842, 0xE8AE, 0xE8AE, 0xE8AE, 0xE0AE,
+    0xC8AE, 0xE0AE, 0xE8AC, 0x0000, 0x0000, 0x0000, 0xC88A, 0xE0AA,
+    0x988B, 0x0000, 0x0000, 0xC0C6, 0xE906, 0xE165, 0xE145, 0xD127,
+    0x0000, 0x5884, 0x1842, 0x0000, 0xC985, 0xFC85, 0xFC65, 0xF485,
+    0xF365, 0x5064, 0x0000, 0x0000, 0x0000, 0x0000, 0xD686, 0xD746,
+    0xA6A7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x4DA8, 0x2D49, 0x4DA8, 0x6E28, 0x0000, 0x0000, 0x0000,
+    0x9CE5, 0xCD85, 0xCB84, 0x3222, 0x0000, 0xFE65, 0xFE65, 0xF665,
+    0xFD85, 0xFD65, 0xF485, 0xFC65, 0xF365, 0xF365, 0xF285, 0xF285,
+    0xE1C6, 0x0000, 0xE106, 0xE165, 0xE906, 0xE106, 0xE0C8, 0x0000,
+    0x0000, 0xC88A, 0xE0AA, 0xE8AC, 0xE0AC, 0xE0AC, 0xE0AC, 0x0000,
+    0x0000, 0x0000, 0x0000, 0xE8AE, 0xA08B, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x986B, 0xC8B1,
+    0x0000, 0x0000, 0x0000, 0x0000, 0xE0B0, 0xE0B0, 0xE0B0, 0xE0B0,
+    0xE0AE, 0xE0B0, 0xC8AE, 0x0000, 0x0000, 0xE0AC, 0xE8AC, 0xE0AC,
+    0xE8AA, 0x588B, 0x0000, 0xE0AA, 0xE0E7, 0xE926, 0xE106, 0xE145,
+    0xE145, 0xE9C5, 0xE9C5, 0xEA85, 0xF265, 0xF365, 0xFB65, 0x0000,
+    0xCB84, 0xFD85, 0xFD85, 0x9AA3, 0x0000, 0x0000, 0x1822, 0xF725,
+    0xD726, 0xCE86, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x6CA6, 0x4DA8, 0x55A8, 0x6E28, 0x6AA3, 0x0000,
+    0xCD65, 0xD686, 0x0000, 0x0000, 0x0000, 0x0000, 0xFD65, 0xFE65,
+    0xFD65, 0xF585, 0xFC65, 0xF485, 0xF365, 0xCA64, 0x1842, 0xC965,
+    0xE1A6, 0xE9C5, 0xE965, 0xE145, 0xC88A, 0x5084, 0xE8C8, 0xE0C8,
+    0xE8A8, 0xE0AC, 0x0000, 0x0000, 0xE0AC, 0xE0AC, 0xE8AC, 0xE0AE,
+    0xC8AE, 0x0000, 0x0000, 0x0000, 0xA8B1, 0xC8B1, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD0B1,
+    0x988B, 0x0000, 0x0000, 0x0000, 0xB0B1, 0xE0B0, 0xE0B0, 0xE0B0,
+    0xE0B0, 0xE0B0, 0x0000, 0x0000, 0xC8AE, 0xE8AE, 0xE0AC, 0xE0AC,
+    0x986B, 0xE8AC, 0xE0AA, 0xE0AA, 0xE8C8, 0xE0A8, 0xE0C8, 0xE0A8,
+    0xD127, 0xE965, 0xE145, 0xE9C5, 0xE9C5, 0xEA85, 0xF285, 0xC165,
+    0x0000, 0x0000, 0x0000, 0x9AA3, 0xFC85, 0x62A3, 0x0000, 0xCC84,
+    0xF725, 0xF725, 0xCD65, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x9CE5, 0x4DA8, 0x6E28, 0x6E28, 0xCD65,
+    0x3222, 0xCE86, 0x0000, 0x0000, 0x0000, 0x0000, 0xFC65, 0xF725,
+    0xFE85, 0xF565, 0xCB84, 0xFC85, 0xF465, 0xFC85, 0xFB65, 0xF285,
+    0x0000, 0x0000, 0x1842, 0xE165, 0xE906, 0xC88A, 0x0000, 0x0000,
+    0x988B, 0xE0AA, 0xE0AA, 0xE0AC, 0xE8AC, 0xC88E, 0xE0AE, 0xE0AE,
+    0xE8AE, 0xE8B0, 0x608B, 0x0000, 0x0000, 0x1842, 0xC8B1, 0x608B,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x588B,
+    0xB0D1, 0x0000, 0x0000, 0x0000, 0x1842, 0xE8B0, 0xC8B1, 0xE0B0,
+    0xE0B0, 0xE0B0, 0x1842, 0xE0B0, 0xE0B0, 0xE0B0, 0xE8AE, 0xC8B1,
+    0x0000, 0x0000, 0xE0AC, 0xE0AC, 0xE8AA, 0x988B, 0x0000, 0x0000,
+    0xE0AA, 0xE106, 0xE906, 0xE165, 0xE145, 0xE1A6, 0xF285, 0xF365,
+    0xF365, 0x0000, 0x0000, 0x0000, 0x0000, 0xCB84, 0xFC65, 0x0000,
+    0xFE65, 0xF725, 0xFF25, 0xCC84, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x6AA3, 0x4DA8, 0x4DA8, 0x8E67,
+    0x8667, 0xA6A7, 0x9CE5, 0x0000, 0x0000, 0x0000, 0x0000, 0xFE65,
+    0xFE65, 0xFE65, 0xCC64, 0xFC85, 0x0000, 0xC165, 0xF365, 0xFB65,
+    0xEA85, 0xE9C5, 0x5064, 0x0000, 0x98E4, 0xE906, 0xE0E7, 0xE0AA,
+    0x0000, 0x0000, 0x0000, 0xE0AC, 0xE8AC, 0xE0AC, 0xC8AE, 0xE0AE,
+    0xE8AE, 0xE0B0, 0xC8B1, 0xE0B0, 0x0000, 0x0000, 0x0000, 0xA8B1,
+    0xA8D1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x90D1, 0x90D1, 0x0000, 0x0000, 0x0000, 0xC8B1, 0xB0D1, 0xA8D1,
+    0xC8B1, 0xE8B0, 0xC8B1, 0xE0B0, 0xE0B0, 0xE0B0, 0xE0AE, 0x5884,
+    0x0000, 0x1842, 0xD08E, 0xE8AC, 0xE0AC, 0xC88A, 0x0000, 0x588B,
+    0xE8C8, 0xE0E7, 0xE0E7, 0xE906, 0xC0C6, 0xC0C6, 0xE108, 0xE9C5,
+    0xEA85, 0xF365, 0xF285, 0x0000, 0x0000, 0x0000, 0x0000, 0xF485,
+    0xCB84, 0xFE65, 0xF725, 0xF725, 0x5864, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4DA8, 0x6E28,
+    0x8667, 0xA6A7, 0xA6C7, 0x3222, 0x0000, 0x0000, 0x0000, 0x62A3,
+    0xFE65, 0xFE85, 0xFD65, 0xFC85, 0x5084, 0x0000, 0x0000, 0xC165,
+    0xF285, 0xF285, 0xE9C5, 0xE9C5, 0xC0C6, 0x986B, 0xE0E7, 0xE108,
+    0xE0C8, 0xE0AA, 0xE8AA, 0xA06B, 0x1842, 0xE0AE, 0xE8AE, 0x608B,
+    0x1842, 0xE0B0, 0xE0B0, 0xE0B0, 0xC8B1, 0xB0D1, 0x0000, 0x0000,
+    0x608B, 0xD0B1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x1842, 0xB0D1, 0x1842, 0x0000, 0x0000, 0x90D1, 0xA8B1, 0xB0D1,
+    0xA8B1, 0xC8B1, 0xD0B1, 0x78F1, 0xA8B1, 0xE0B0, 0xE0B0, 0x0000,
+    0x1842, 0xE0B0, 0xE8AE, 0xE0AE, 0xE0AC, 0xE8AE, 0x0000, 0x988B,
+    0xE0AA, 0xE0AA, 0xE8A8, 0xE8E7, 0x5084, 0x0000, 0x0000, 0xD127,
+    0xE1A6, 0xF285, 0xEA65, 0xF365, 0x0000, 0x0000, 0x0000, 0x0000,
+    0xCB84, 0xFE65, 0xFE65, 0xFF25, 0xF745, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6E08,
+    0x6E28, 0xA6A7, 0xA6C7, 0xD726, 0x1822, 0x0000, 0x0000, 0x0000,
+    0x0000, 0xFE85, 0xFD65, 0xFD65, 0xFC85, 0xF365, 0x5064, 0x0000,
+    0x0000, 0xC985, 0xE9C5, 0xE9C5, 0xE145, 0xE106, 0xE8E7, 0xE0E7,
+    0xE0C8, 0xE0AA, 0xE8C8, 0xE0AA, 0xE0AC, 0xE0AE, 0xE8AC, 0xE0AE,
+    0xE0AE, 0x0000, 0x0000, 0x588B, 0xE8B0, 0xE0B0, 0xC8B1, 0x0000,
+    0x0000, 0x0000, 0x88D1, 0x78F1, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x78D1, 0x78F1, 0x0000, 0x0000, 0x0000, 0x90D1, 0xB0D1,
+    0xA8B1, 0xB0D1, 0x588B, 0x0000, 0x0000, 0xD0B1, 0xC8B1, 0xC8B1,
+    0xC8B1, 0xE8B0, 0xE0AE, 0xE0B0, 0xC88E, 0xE8AE, 0xE0AC, 0xE0AE,
+    0xE0AC, 0xE8AC, 0xE0C8, 0xE0A8, 0x5084, 0x0000, 0x0000, 0x1842,
+    0xE908, 0xE9C5, 0xE9C5, 0xF285, 0xF285, 0x0000, 0x0000, 0x0000,
+    0x0000, 0xCA64, 0xF565, 0xFE85, 0xFE65, 0xF725, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x6628, 0x8667, 0xA6A7, 0xCF26, 0xCF46, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0xFC65, 0xFE65, 0xF585, 0xFD65, 0xFC85, 0xF465,
+    0xF285, 0xEA85, 0xC0C6, 0xE9C5, 0xE145, 0xE965, 0xE106, 0xE108,
+    0xE0C8, 0xE0AA, 0xE8AA, 0xE0AC, 0xE0AC, 0xE0AE, 0xE8AE, 0xE0AE,
+    0xE0AE, 0xE8B0, 0xC8B1, 0x0000, 0x0000, 0x608B, 0xC8B1, 0xC8B1,
+    0xB0B1, 0x0000, 0x0000, 0x78F1, 0x90D1, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x78F1, 0x4931, 0x0000, 0x0000, 0x78F1, 0x88F1,
+    0x90D1, 0xB0B1, 0x0000, 0x0000, 0x0000, 0xA8D1, 0xB0D1, 0xC8B1,
+    0xC8B1, 0xE0B0, 0xE0B0, 0xE0B0, 0xE0B0, 0xE0B0, 0xE0AE, 0xE0AE,
+    0xE0AC, 0xE8AE, 0xE0AC, 0xE0AC, 0xE0AA, 0x0000, 0xC88A, 0xE108,
+    0xE906, 0xE165, 0xE145, 0xE9C5, 0xE9C5, 0x9AA3, 0x0000, 0x0000,
+    0x0000, 0x0000, 0xCB84, 0xFE65, 0xFE65, 0xF725, 0xCE66, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x8667, 0x8667, 0xA6A7, 0xAEC7, 0xCF26, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0xFE65, 0xFD65, 0xFD65, 0xFC85, 0xF465,
+    0xF365, 0xF365, 0xE9C5, 0xE9C5, 0xE145, 0xE165, 0xE906, 0xE108,
+    0xE0C8, 0xE0A8, 0xE0C8, 0xE8AA, 0xE0AA, 0xE0AC, 0xE0AC, 0xE8AE,
+    0xE0AE, 0xE0B0, 0xE0AE, 0xE0B0, 0x588B, 0x0000, 0x0000, 0xD0B1,
+    0xA8B1, 0xB0D1, 0x190B, 0x0000, 0x0000, 0x78D1, 0x190B, 0x0000,
+    0x0000, 0x0000, 0x210B, 0x6111, 0x0000, 0x0000, 0x210B, 0x78F1,
+    0x78D1, 0x78F1, 0x6111, 0x0000, 0x0000, 0x78D1, 0x90D1, 0xB0D1,
+    0xA8D1, 0xD0B1, 0xC8B1, 0xC8B1, 0xC8B1, 0xE8B0, 0xE0AE, 0xE0B0,
+    0xE0AE, 0xE8AE, 0xE0AC, 0xE0AC, 0xE0AA, 0xE8AA, 0xE0A8, 0xE0C8,
+    0xE0A8, 0xE906, 0xE126, 0xE165, 0xE145, 0xE9C5, 0xE1A6, 0x0000,
+    0x0000, 0x0000, 0x0000, 0xFB85, 0xFD85, 0xF665, 0xFE65, 0xFC65,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x6CA6, 0xA6A7, 0xA6C7, 0xCF26, 0xCF26, 0xCD85,
+    0x0000, 0x0000, 0x0000, 0xF465, 0xFD85, 0xFC65, 0x0000, 0xCA64,
+    0xF365, 0xF365, 0xF285, 0xEA85, 0xE9C5, 0xE9C5, 0xE126, 0xE106,
+    0xE8E7, 0xE0E7, 0xE0A8, 0xE0AA, 0xE8AC, 0xE0AE, 0xE0AC, 0xE0AE,
+    0xE8AE, 0xE0B0, 0xE0B0, 0xE0B0, 0xE0B0, 0xE8B0, 0x1842, 0x0000,
+    0xA8D1, 0x90F1, 0x608B, 0x90D1, 0x0000, 0x0000, 0x4951, 0x6911,
+    0x0000, 0x0000, 0x0000, 0x6111, 0x4931, 0x0000, 0x0000, 0x6111,
+    0x6911, 0x0000, 0x6111, 0x78F1, 0x0000, 0x4931, 0x88F1, 0x90D1,
+    0x90D1, 0xA8D1, 0xB0B1, 0xC8B1, 0xC8B1, 0xE0B0, 0xE0B0, 0xE0B0,
+    0xE0B0, 0xE0B0, 0xE0AE, 0xE0AE, 0xE8AC, 0xE0AC, 0xE0AA, 0xE0AA,
+    0xE8C8, 0xE0E7, 0xE0E7, 0xE106, 0xC0C6, 0xD127, 0xE9C5, 0xF265,
+    0x1842, 0x0000, 0x0000, 0x0000, 0xFC85, 0xFD65, 0xF665, 0xFE85,
+    0x9AA3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x3222, 0x8667, 0xAEC7, 0xA6C7, 0xD726,
+    0xCF26, 0xFD65, 0x0000, 0x0000, 0xFC65, 0xF685, 0xC165, 0x0000,
+    0x0000, 0x0000, 0xE1A6, 0xF285, 0xE9C5, 0xE1A6, 0xE108, 0xE108,
+    0xE0A8, 0xC88A, 0x90E4, 0x1842, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x608B, 0xE8B0, 0xE0B0, 0xE0B0, 0xC8B1, 0xC8B1,
+    0x90D1, 0xB0D1, 0x0000, 0x0000, 0x78F1, 0x4931, 0x0000, 0x0000,
+    0x4931, 0x190B, 0x0000, 0x210B, 0x4951, 0x0000, 0x0000, 0x190B,
+    0x5131, 0x4951, 0x0000, 0x4931, 0x6911, 0x608B, 0x6111, 0x78F1,
+    0x78F1, 0x90D1, 0x90D1, 0x78F1, 0x1842, 0x0000, 0x0000, 0x0000,
+    0x1842, 0xA08B, 0xA06B, 0xC8B1, 0xC8B1, 0xE8AE, 0xE0AC, 0xE8AC,
+    0xE0AA, 0xE0AA, 0xE0C8, 0xE8A8, 0x0000, 0x0000, 0x0000, 0xE1A6,
+    0xE9C5, 0x90E4, 0x0000, 0x0000, 0xF285, 0xF485, 0xFC65, 0xFD85,
+    0xF665, 0x1842, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA6A7, 0xA6C7, 0xD726,
+    0xCF26, 0xF725, 0xF725, 0xF725, 0xFD65, 0xFE85, 0xF565, 0xFD85,
+    0xFC65, 0xF485, 0xFB65, 0xF365, 0xF285, 0xE9C5, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1842, 0xB0B1, 0xC8B1,
+    0xB0D1, 0xB0D1, 0x90D1, 0x1842, 0x0000, 0x78F1, 0x6911, 0x0000,
+    0x0000, 0x4931, 0x3191, 0x0000, 0x3191, 0x4951, 0x0000, 0x0000,
+    0x3191, 0x4931, 0x190B, 0x0000, 0x210B, 0x6111, 0x6111, 0x6111,
+    0x6911, 0x78F1, 0x190B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x1842, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0xC88A, 0xE0AA, 0xE8AA, 0xE0A8, 0xE108, 0xE108, 0xE165,
+    0xE145, 0xF285, 0xE1A6, 0xF265, 0xF365, 0xF485, 0xFC65, 0xFD85,
+    0xFD65, 0xFE65, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCD65, 0xD746,
+    0xCF26, 0xF725, 0xCF26, 0xFF25, 0xFE65, 0xFE65, 0xF565, 0xFD65,
+    0xFC85, 0xF465, 0xF365, 0xF365, 0xF285, 0xF265, 0xE145, 0xE108,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0xA8D1, 0x88D1, 0x90D1, 0x78F1, 0x0000, 0x190B, 0x6911,
+    0x190B, 0x0000, 0x2042, 0x3191, 0x2991, 0x3191, 0x1842, 0x0000,
+    0x210B, 0x3191, 0x3191, 0x0000, 0x1842, 0x4931, 0x3191, 0x4951,
+    0x5131, 0x190B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0xE8AA, 0xE8AA, 0xE8C8, 0xE0C8, 0xE0A8, 0xE0E7,
+    0xE906, 0xE165, 0xE165, 0xF285, 0xEA65, 0xF365, 0xFB65, 0xF485,
+    0xFC65, 0xFD85, 0xCC64, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCD65,
+    0xA6C7, 0xF725, 0xF725, 0xFF25, 0xF725, 0xF725, 0xF665, 0xFE65,
+    0xFD85, 0xFC65, 0xF365, 0xF365, 0xEA85, 0xF285, 0xE1A6, 0xE9C5,
+    0xE965, 0xA06B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x78F1, 0x78D1, 0x78F1, 0x6111, 0x0000,
+    0x4931, 0x4931, 0x0000, 0x3191, 0x3191, 0x3191, 0x2991, 0x2212,
+    0x0000, 0x2212, 0x3191, 0x2212, 0x0000, 0x3191, 0x3191, 0x4931,
+    0x2991, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0xC88E, 0xE0AC, 0xE0AA, 0xE8AC, 0xE0C8, 0xE0E7,
+    0xE0E7, 0xE106, 0xE145, 0xE9C5, 0xE9C5, 0xF285, 0xEA65, 0xF365,
+    0xFC85, 0xFD65, 0xF585, 0xCB84, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x5864, 0xD746, 0xCF26, 0xF725, 0xFF25, 0xF725, 0xFE65, 0xFE65,
+    0xFD65, 0xF585, 0xCA64, 0x0000, 0xC165, 0xFB65, 0xE9C5, 0xE9C5,
+    0xE145, 0xE165, 0xE0E7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6111, 0x6111, 0x6111,
+    0x4931, 0x190B, 0x3191, 0x2042, 0x3191, 0x2212, 0x2991, 0x2212,
+    0x21F2, 0x2042, 0x2212, 0x2212, 0x0000, 0x21F2, 0x3191, 0x2991,
+    0x09EE, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x2042, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x608B, 0xE8AE, 0xE0AC, 0xE8AC, 0xE0AA, 0xE0AA,
+    0xE0C8, 0x988B, 0x5884, 0xE945, 0xE165, 0xE9C5, 0xE9C5, 0xF285,
+    0xF365, 0xF465, 0xFC85, 0xFD65, 0x1842, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0xD666, 0xF725, 0xF725, 0xF725, 0xF725, 0xF725,
+    0xFE65, 0xFE85, 0xFD65, 0xF485, 0xF265, 0xF365, 0xEA85, 0xF285,
+    0xE9C5, 0xE9A6, 0xE108, 0xE108, 0xE8C8, 0x1842, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6911,
+    0x4931, 0x4931, 0x3191, 0x2212, 0x3191, 0x3242, 0x21F2, 0x1A53,
+    0x2212, 0x3A42, 0x1A53, 0x12B4, 0x210B, 0x12B4, 0x21F2, 0x1A53,
+    0x2212, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1842, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x608B, 0xE0B0, 0xC8AE, 0xE0AE, 0xE0AC, 0xE0AC,
+    0xE8C8, 0xE108, 0xE0AA, 0xD127, 0xE106, 0xE1A6, 0xE9C5, 0xF265,
+    0xEA85, 0xFB65, 0xF365, 0xF465, 0xFC85, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0xCD65, 0xCF46, 0xFF25, 0xF725, 0xF725,
+    0xFD65, 0xCB84, 0xFD65, 0xFD85, 0xF465, 0xF365, 0xF285, 0xF265,
+    0xE9C5, 0xE1C5, 0xE145, 0xE108, 0xE0C8, 0xE8E7, 0xE0A8, 0xC88A,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x190B, 0x6111,
+    0x4951, 0x4931, 0x3191, 0x3191, 0x3191, 0x2212, 0x1842, 0x1A53,
+    0x1A53, 0x12B4, 0x2042, 0x12B4, 0x1AB4, 0x12B4, 0x1A53, 0x1AB4,
+    0x1A53, 0x1A53, 0x2212, 0x210B, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0xA06B, 0xE0B0, 0xE0AE, 0xA8D1, 0xD08E, 0xE0AC,
+    0xE8AA, 0xE0AA, 0xE0C8, 0xE0A8, 0xE8E7, 0xE106, 0xE165, 0xE1A6,
+    0xD127, 0xF285, 0xF285, 0xF365, 0xFC85, 0xCA64, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF725, 0xF725, 0xF725,
+    0xFE85, 0xCC84, 0x9AA3, 0xF365, 0xFC65, 0xFC85, 0xF365, 0xF365,
+    0xEA65, 0xF285, 0xE165, 0xE965, 0xE106, 0xE108, 0xE8A8, 0x1842,
+    0xE8AA, 0xE8AC, 0x608B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x1842, 0x78F1, 0x90D1, 0x78F1, 0x6111,
+    0x5131, 0x4931, 0x3191, 0x190B, 0x3191, 0x2212, 0x2212, 0x1AB4,
+    0x1A53, 0x12B4, 0x1AB4, 0x0B56, 0x1AB4, 0x1356, 0x0B56, 0x210B,
+    0x12B4, 0x12B4, 0x1A53, 0x1A53, 0x21F2, 0x2212, 0x3191, 0x210B,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x1842, 0xA8D1, 0xE0B0, 0xA8B1, 0xE0B0, 0xE8AE, 0xE0AE,
+    0xE0AC, 0xE0AC, 0xE8AA, 0xE0AA, 0xE0C8, 0xE108, 0xE106, 0xE965,
+    0xE906, 0x90E4, 0xE1A6, 0xF365, 0xF365, 0xF465, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCC64, 0xF725,
+    0xFF25, 0xF725, 0xFD65, 0xCA64, 0x0000, 0xCA64, 0xF365, 0xF365,
+    0xF285, 0xF265, 0xE9C5, 0xE145, 0x1842, 0xE106, 0xE8C8, 0xE0AA,
+    0x0000, 0x5084, 0xE8AA, 0xE0AC, 0xE8AE, 0xE0B0, 0xE0AE, 0xE0B0,
+    0xC8B1, 0xA8D1, 0xB0B1, 0xA8D1, 0xB0B1, 0x88D1, 0x78F1, 0x6111,
+    0x0000, 0x4931, 0x3191, 0x3191, 0x3191, 0x2212, 0x2212, 0x1A53,
+    0x12B4, 0x12B4, 0x1AB4, 0x0B56, 0x1356, 0x1356, 0x1356, 0x0B56,
+    0x1356, 0x1356, 0x12B4, 0x1AB4, 0x210B, 0x09EE, 0x2212, 0x2212,
+    0x3191, 0x3191, 0x2991, 0x4931, 0x210B, 0x190B, 0x210B, 0x78D1,
+    0x78F1, 0xB0B1, 0xB0D1, 0xC8B1, 0x0000, 0x0000, 0xE8AE, 0xE0AE,
+    0xE0AE, 0x986B, 0xE8AA, 0xE0AA, 0xE8C8, 0xE0A8, 0xE0C8, 0xE106,
+    0x0000, 0x988B, 0xC965, 0xE9C5, 0xF285, 0xF365, 0xE1A6, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0xFE65, 0xF725, 0xFE65, 0xFE65, 0xFD85, 0xCB84, 0xF465, 0xFC85,
+    0xF365, 0x9AA3, 0xF285, 0xE9C5, 0x5884, 0x0000, 0xC0C6, 0xE0E7,
+    0xE0C8, 0xE108, 0xE0AA, 0xE8AC, 0xE0AC, 0xE0AE, 0xE8AE, 0xE0B0,
+    0xE0B0, 0xE0B0, 0xB0B1, 0x78F1, 0xB0D1, 0x90D1, 0x0000, 0x0000,
+    0x0000, 0x1842, 0x5131, 0x4931, 0x3191, 0x2212, 0x2212, 0x09EE,
+    0x0000, 0x1356, 0x0B56, 0x1356, 0x1356, 0x0BF8, 0x0BD8, 0x0000,
+    0x0BF8, 0x0BD8, 0x1356, 0x0B56, 0x1AB4, 0x0333, 0x0000, 0x0000,
+    0x0000, 0x2212, 0x3191, 0x4951, 0x3191, 0x6111, 0x6111, 0x90D1,
+    0x88D1, 0xB0D1, 0xA8B1, 0xD0B1, 0xC8B1, 0xE0B0, 0xA8D1, 0xE0B0,
+    0xE8AE, 0x588B, 0x0000, 0x988B, 0xE8AA, 0xE0AA, 0xC88A, 0xE0E7,
+    0xE8E7, 0xE1A6, 0x90C4, 0xE9C5, 0xEA85, 0xF365, 0xF285, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0xCB84, 0xF665, 0xFE65, 0xFD65, 0xF485, 0xFC65,
+    0xF365, 0x90C4, 0xF285, 0xF285, 0xE0E8, 0x0000, 0x0000, 0x5084,
+    0xE8C8, 0xE0A8, 0xE0C8, 0xE0AA, 0x5884, 0x0000, 0xE8AE, 0xE0AE,
+    0xC88E, 0xE0B0, 0xC8B1, 0xC8B1, 0x988B, 0xB0B1, 0x0000, 0x0000,
+    0x0000, 0x6111, 0x4931, 0x4951, 0x3191, 0x3191, 0x3191, 0x2212,
+    0x0000, 0x1842, 0x12B4, 0x1356, 0x1356, 0x0BD8, 0x0BF8, 0x0479,
+    0x0000, 0x0000, 0x0BD8, 0x0BF8, 0x1356, 0x1356, 0x12B4, 0x1AB4,
+    0x210B, 0x0000, 0x0000, 0x3191, 0x2991, 0x3191, 0x4931, 0x6911,
+    0x78F1, 0x0000, 0x90D1, 0xA8D1, 0x0000, 0xD0B1, 0xC8B1, 0xE0B0,
+    0xE8AE, 0xE0B0, 0x0000, 0x0000, 0x0000, 0xE0AC, 0xE0A8, 0xE0AA,
+    0xC88A, 0xE926, 0xE106, 0xE165, 0xE9C5, 0xF285, 0x986B, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9AA3, 0xF485, 0xFD65,
+    0xFB65, 0xF365, 0xEA85, 0xF285, 0xE9C5, 0xD927, 0x90C4, 0x5884,
+    0x5084, 0xE8E7, 0xE0C8, 0xE8AC, 0x0000, 0x0000, 0x986B, 0xE0AE,
+    0xC8AE, 0x0000, 0xE0B0, 0xE8B0, 0xC8B1, 0xD0B1, 0x608B, 0x0000,
+    0x1842, 0x78F1, 0x6911, 0x1842, 0x210B, 0x4931, 0x3191, 0x2212,
+    0x0000, 0x0000, 0x09EE, 0x1356, 0x1356, 0x0BD8, 0x0BD8, 0x0479,
+    0x0C99, 0x0000, 0x0000, 0x09EE, 0x0BF8, 0x0BD8, 0x1356, 0x0000,
+    0x12B4, 0x1AB4, 0x2212, 0x0000, 0x0000, 0x4951, 0x4931, 0x6111,
+    0x6111, 0x6111, 0x0000, 0xB0B1, 0xA8D1, 0x0000, 0x0000, 0x1842,
+    0xE0B0, 0xE0B0, 0xE8AE, 0x0000, 0x0000, 0x0000, 0xC88E, 0xE0AA,
+    0xE0C8, 0xE108, 0xE108, 0xE906, 0xE108, 0x988B, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x1842, 0x98C4, 0xC185, 0xE9A6, 0xE1A6, 0xD127, 0xE965,
+    0xE108, 0xE108, 0xE0C8, 0xE0AA, 0x5084, 0xD08E, 0x0000, 0xE8AE,
+    0xE0AE, 0xE0B0, 0x0000, 0xA8D1, 0xC8B1, 0xC8B1, 0xB0B1, 0x90D1,
+    0x1842, 0x90F1, 0x4931, 0x0000, 0x0000, 0x3191, 0x2991, 0x3191,
+    0x0000, 0x0000, 0x0000, 0x1A73, 0x0B56, 0x0BD8, 0x0BF8, 0x0C79,
+    0x0479, 0x0C79, 0x0000, 0x0000, 0x0000, 0x0479, 0x0BD8, 0x0BF8,
+    0x09EE, 0x0000, 0x210B, 0x1A53, 0x09EE, 0x2042, 0x3191, 0x4951,
+    0x4931, 0x6911, 0x0000, 0x0000, 0x90F1, 0xB0D1, 0x986B, 0xB0D1,
+    0x588B, 0xD08E, 0xE0AE, 0xE0B0, 0xC8AE, 0xC88E, 0xD0AE, 0xC88E,
+    0xC88A, 0xC8AE, 0x5884, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x2042, 0x1842, 0x0000, 0x1842, 0xE108, 0xC88E, 0xE0AC,
+    0xE8AC, 0xE0B0, 0xE0B0, 0xE0B0, 0x988B, 0xE0B0, 0xD0B1, 0xC8B1,
+    0xA8B1, 0xB0D1, 0x6911, 0x0000, 0x0000, 0x0000, 0x3191, 0x3191,
+    0x3191, 0x0000, 0x0000, 0x0000, 0x09EE, 0x0BF8, 0x0BD8, 0x0479,
+    0x0C79, 0x0479, 0x0C79, 0x0000, 0x0000, 0x0000, 0x0000, 0x0479,
+    0x0BF8, 0x0BD8, 0x0000, 0x0000, 0x0000, 0x1A73, 0x2991, 0x3191,
+    0x3191, 0x6111, 0x4931, 0x4931, 0x78F1, 0xB0B1, 0xA8D1, 0xB0D1,
+    0x90D1, 0xD0B1, 0x1842, 0x0000, 0x0000, 0x608B, 0x1842, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x5884, 0xE8AA, 0xE8C8, 0xE0AC,
+    0xE0AC, 0xE8AE, 0xE0AE, 0xE0B0, 0xE0B0, 0xE0B0, 0xC8B1, 0xC8B1,
+    0xA8B1, 0xB0D1, 0x90D1, 0x78F1, 0x0000, 0x0000, 0x2991, 0x4931,
+    0x3191, 0x0000, 0x0000, 0x0000, 0x0000, 0x1A53, 0x0B56, 0x0BF8,
+    0x0BD8, 0x0C99, 0x0479, 0x0C79, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0333, 0x0BD8, 0x1356, 0x210B, 0x0000, 0x09EE, 0x2212, 0x2212,
+    0x3191, 0x4931, 0x4931, 0x6911, 0x6111, 0x90D1, 0x90F1, 0xB0D1,
+    0xA8B1, 0xB0D1, 0xC8B1, 0xE0B0, 0x5884, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0xE8C8, 0xE108, 0xE0A8, 0xE0AA,
+    0xE0AA, 0xE8AC, 0xE0AC, 0xE8AE, 0xC8AE, 0xE0B0, 0xE0B0, 0xE0B0,
+    0xC8B1, 0xD0B1, 0xB0D1, 0x90D1, 0x78D1, 0x78F1, 0x4951, 0x4931,
+    0x3191, 0x3191, 0x0000, 0x0000, 0x0000, 0x0000, 0x09EE, 0x0BF8,
+    0x0BD8, 0x0479, 0x0C79, 0x0479, 0x0C79, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0BF8, 0x0BD8, 0x1356, 0x0333, 0x1A53, 0x2212,
+    0x3191, 0x2991, 0x3191, 0x4931, 0x6111, 0x78F1, 0x78F1, 0x90D1,
+    0xA8B1, 0xD0B1, 0xC8B1, 0xE0B0, 0xE0B0, 0xE0B0, 0xC8B1, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0xC0C6, 0xE106, 0xE108, 0xE0C8, 0xE0A8,
+    0xE8C8, 0xE0AC, 0xE0AC, 0xE0AE, 0xC8B1, 0x0000, 0xE8AE, 0xE0B0,
+    0xC8B1, 0xC8B1, 0xA8B1, 0xB0D1, 0x90D1, 0x88D1, 0x6111, 0x6111,
+    0x4951, 0x4931, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0A0E,
+    0x1356, 0x0BD8, 0x0BF8, 0x0C79, 0x0479, 0x0C79, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x09EE, 0x1356, 0x1356, 0x1A53, 0x1A53,
+    0x2212, 0x2212, 0x3191, 0x4931, 0x4931, 0x6911, 0x6111, 0x1842,
+    0x6911, 0xB0D1, 0xA8B1, 0xD0B1, 0xC8B1, 0xE0B0, 0xE8AE, 0xE0B0,
+    0xE0AE, 0x988B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0xE1A6, 0xE145, 0xE965, 0xE0E7, 0xE0E7,
+    0xE0A8, 0xE8AA, 0xE0AA, 0xE8AC, 0xC8AE, 0xC88E, 0xE0AE, 0xE0B0,
+    0xB0D1, 0xE0B0, 0xD0B1, 0x1842, 0x90D1, 0xB0D1, 0x78D1, 0x78F1,
+    0x6111, 0x6911, 0x190B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x1AB4, 0x1356, 0x0B56, 0x0BD8, 0x0BD8, 0x0C79, 0x0479, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1356, 0x1AB4, 0x12B4,
+    0x2212, 0x2212, 0x2991, 0x0000, 0x3191, 0x6111, 0x4931, 0x78F1,
+    0x78F1, 0x90D1, 0x90D1, 0xC8B1, 0xC8B1, 0xE0B0, 0xE0B0, 0xE0B0,
+    0xE0AE, 0xE0AE, 0xE0AC, 0xE8AE, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x5084, 0xF285, 0xE9C5, 0xE965, 0xE106, 0xE0E7,
+    0xE0C8, 0xE8A8, 0xE0C8, 0xE0AC, 0xE0AC, 0xE8AE, 0xE0AE, 0xC8B1,
+    0xE0B0, 0xA8B1, 0xC8B1, 0xD0B1, 0x0000, 0xA8D1, 0x90D1, 0x90D1,
+    0x78F1, 0x6111, 0x4931, 0x4951, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x12B4, 0x12B4, 0x1356, 0x1356, 0x0BF8, 0x0BD8, 0x0BF8,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0B33, 0x12B4, 0x1AB4,
+    0x1A53, 0x2212, 0x3191, 0x3191, 0x0000, 0x4931, 0x4931, 0x4931,
+    0x6911, 0x78F1, 0x90D1, 0x90F1, 0xA8D1, 0xC8B1, 0xD0B1, 0xE0B0,
+    0xC8B1, 0xE0B0, 0xE8AE, 0xE0AC, 0xE0AC, 0xE0AC, 0x5884, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0xCA64, 0xF365, 0xE9C5, 0xE9C5, 0xE145, 0xE165,
+    0xE8E7, 0xE108, 0xE0A8, 0xE0AC, 0xE0AA, 0xE8AC, 0xE0AC, 0xE8AE,
+    0xC8B1, 0xE0B0, 0x988B, 0xE0B0, 0xD0B1, 0xC8B1, 0xA8B1, 0xB0D1,
+    0x90D1, 0x78F1, 0x608B, 0x6911, 0x4951, 0x4931, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x1AB4, 0x12B4, 0x1AB4, 0x0B56, 0x1356, 0x0BD8,
+    0x0BF8, 0x0000, 0x0000, 0x0000, 0x0000, 0x09EE, 0x1356, 0x12B4,
+    0x1A53, 0x1A53, 0x2212, 0x2212, 0x3191, 0x4931, 0x4931, 0x6111,
+    0x6111, 0x78F1, 0x78D1, 0xB0D1, 0x90D1, 0xC8B1, 0xC8B1, 0xC8B1,
+    0xE0B0, 0xC8AE, 0xE0AE, 0xE8AE, 0xE0AC, 0xE0AC, 0xE0AA, 0xE8AA,
+    0xC88A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0xF365, 0xF365, 0xF285, 0xF285, 0xE9C5, 0xE145,
+    0xE106, 0xE106, 0xE0C8, 0xE0C8, 0x90C4, 0x608B, 0xE8AA, 0xE0AE,
+    0x0000, 0xE0B0, 0xE0AE, 0xC8B1, 0xE0B0, 0xE0B0, 0xB0D1, 0xA8B1,
+    0xB0D1, 0x88D1, 0x0000, 0x0000, 0x4931, 0x6111, 0x3191, 0x190B,
+    0x0000, 0x0000, 0x0000, 0x1A73, 0x1A53, 0x1AB4, 0x12B4, 0x1356,
+    0x1356, 0x0BD8, 0x0000, 0x0000, 0x0000, 0x0000, 0x12B4, 0x1AB4,
+    0x12B4, 0x0000, 0x0000, 0x2212, 0x3191, 0x4931, 0x3191, 0x4931,
+    0x6911, 0x78F1, 0x78F1, 0x90D1, 0x78F1, 0x0000, 0xB0B1, 0xC8B1,
+    0x0000, 0xC8B1, 0xE8AE, 0xE0AE, 0xE8AC, 0xE0AC, 0xE0AA, 0xE0AA,
+    0xE8C8, 0xE0A8, 0xE0C8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0xF485, 0xFC65, 0xF365, 0xF365, 0xF285, 0xEA85,
+    0xE945, 0xE165, 0xE106, 0xE108, 0xE0C8, 0xE8AA, 0xE0AC, 0xE0AC,
+    0xE0AC, 0xE0B0, 0xE8AE, 0xE0B0, 0xE0B0, 0xE0B0, 0xC8B1, 0xD0B1,
+    0xA8B1, 0xB0D1, 0x90F1, 0x608B, 0x0000, 0x0000, 0x4931, 0x4931,
+    0x3191, 0x0000, 0x0000, 0x0000, 0x2212, 0x1AB4, 0x12B4, 0x1AB4,
+    0x12B4, 0x1356, 0x1356, 0x0000, 0x0000, 0x0000, 0x12B4, 0x12B4,
+    0x1A53, 0x0000, 0x0000, 0x0000, 0x3191, 0x2212, 0x4931, 0x4951,
+    0x4931, 0x78D1, 0x78F1, 0x90F1, 0x90D1, 0x78D1, 0xA8D1, 0xD0B1,
+    0xA8B1, 0xA8D1, 0xE0B0, 0xE0B0, 0xE0AE, 0xE8AE, 0xE0AC, 0xE0AC,
+    0xE0AA, 0xE8AA, 0xE0A8, 0xE108, 0xE108, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0xFC65, 0xFD85, 0xF465, 0xF365, 0xF285, 0xEA65,
+    0xE9C5, 0xE9C5, 0xE108, 0xE106, 0xE0E7, 0xE0E7, 0xE8C8, 0xE0AA,
+    0xE0AA, 0xE0AC, 0xE8AC, 0xE0AE, 0xE0AE, 0xE0B0, 0xE0B0, 0xE0B0,
+    0xC8B1, 0xC8B1, 0xB0B1, 0xA8D1, 0x90D1, 0x0000, 0x0000, 0x0000,
+    0x4931, 0x4951, 0x1842, 0x0000, 0x3191, 0x2212, 0x2212, 0x1A53,
+    0x1A53, 0x12B4, 0x1A53, 0x1AB4, 0x12B4, 0x0000, 0x0000, 0x1AB4,
+    0x1A53, 0x09EE, 0x0000, 0x0000, 0x3191, 0x3191, 0x3191, 0x4931,
+    0x4931, 0x6911, 0x6111, 0x78F1, 0x90D1, 0xB0D1, 0xA8D1, 0xC8B1,
+    0xD0B1, 0xE0B0, 0xE0B0, 0xE0B0, 0xE0AE, 0xE8AE, 0xE0AC, 0xE0AC,
+    0xE0AA, 0xE8AA, 0xE0A8, 0xE0C8, 0xE0E7, 0xE906, 0xE108, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0xFD65, 0xF585, 0xFC65, 0xFC85, 0xF365, 0xF365,
+    0xEA85, 0xF285, 0xD127, 0x0000, 0xE108, 0xE906, 0xE0E7, 0xE0A8,
+    0xE0C8, 0xE8AC, 0xE0AC, 0xE0AE, 0xE8AE, 0xE0B0, 0xE0B0, 0xE0B0,
+    0xC8B1, 0x0000, 0x90F1, 0xC8B1, 0x90D1, 0xB0B1, 0x78F1, 0x0000,
+    0x0000, 0x5151, 0x4931, 0x4931, 0x210B, 0x2212, 0x0000, 0x21F2,
+    0x2212, 0x1A53, 0x2212, 0x12B4, 0x0000, 0x1AB4, 0x0000, 0x09EE,
+    0x2212, 0x1A53, 0x0000, 0x0000, 0x190B, 0x3191, 0x3191, 0x4951,
+    0x4931, 0x0000, 0x4931, 0x78F1, 0x90D1, 0xA8D1, 0xB0B1, 0xC8B1,
+    0xC8B1, 0xC8B1, 0xE0B0, 0xE0B0, 0xE0AE, 0xE0B0, 0xE8AE, 0xC8AE,
+    0x1842, 0xE8AC, 0xE0AA, 0xE0A8, 0xE0C8, 0xE926, 0xE106, 0xE145,
+    0xE165, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0xCB84, 0xFE85, 0xFD65, 0xF565, 0xFC85, 0xF465,
+    0xF365, 0xFB65, 0xE9C5, 0xE1A6, 0x0000, 0x0000, 0xE0E7, 0xE0AA,
+    0x0000, 0x0000, 0xC88A, 0xE0AC, 0xE8AC, 0xE0AE, 0xE0AE, 0xE0B0,
+    0xE0B0, 0x988B, 0x0000, 0x0000, 0xB0D1, 0x78D1, 0x0000, 0x88D1,
+    0x78F1, 0x0000, 0x1842, 0x6911, 0x4931, 0x4951, 0x210B, 0x0000,
+    0x3191, 0x2212, 0x2991, 0x2212, 0x21F2, 0x0000, 0x2212, 0x3191,
+    0x2212, 0x21F2, 0x190B, 0x0000, 0x210B, 0x3191, 0x190B, 0x0000,
+    0x5131, 0x1842, 0x0000, 0x0000, 0x78F1, 0x90D1, 0x90F1, 0xB0D1,
+    0xB0B1, 0xC8B1, 0x988B, 0x0000, 0x5884, 0xE8AE, 0xE8AE, 0x5084,
+    0x0000, 0xC88E, 0xE8AA, 0xE0AA, 0xE8C8, 0xE0E7, 0xE0E7, 0xE145,
+    0xE965, 0xE9C5, 0xC165, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0xF725, 0xFE65, 0xF685, 0xFD65, 0xFD85,
+    0xF465, 0xFC85, 0xEA65, 0xF285, 0xE9C5, 0xC985, 0x588B, 0xE106,
+    0xE8AA, 0x0000, 0x0000, 0xC8AE, 0xE0AA, 0xE0AC, 0xE0AC, 0xE8AE,
+    0xE0AE, 0xE8B0, 0x1842, 0x0000, 0x0000, 0x78D1, 0xB0D1, 0x0000,
+    0x0000, 0x90D1, 0x78F1, 0x0000, 0x6111, 0x6911, 0x4951, 0x0000,
+    0x0000, 0x4931, 0x3191, 0x2991, 0x3191, 0x21F2, 0x0000, 0x210B,
+    0x2991, 0x2212, 0x3191, 0x2042, 0x0A0E, 0x4931, 0x210B, 0x0000,
+    0x4951, 0x4931, 0x0000, 0x0000, 0x0000, 0x88D1, 0xB0D1, 0xA8B1,
+    0xB0D1, 0xC8B1, 0xC8B1, 0xE0B0, 0x0000, 0x0000, 0xC88E, 0xE8AE,
+    0x988B, 0x0000, 0xE0AC, 0xE0AA, 0xE8C8, 0xE108, 0xE0E7, 0xE106,
+    0xE145, 0xE9C5, 0xE9C5, 0xEA85, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x9AA3, 0xFE65, 0xFE65, 0xFD65, 0xFD85,
+    0xF465, 0xFC85, 0xF365, 0xF365, 0xF265, 0xEA85, 0xE145, 0xD127,
+    0xE906, 0xE108, 0x0000, 0x0000, 0xE0AA, 0xE0AA, 0xE0AA, 0xE8AC,
+    0xC8AE, 0x1842, 0xE8AE, 0x588B, 0x0000, 0x0000, 0x0000, 0xC8B1,
+    0x90D1, 0x0000, 0x0000, 0x90D1, 0x78F1, 0x78F1, 0x6111, 0x4931,
+    0x0000, 0x0000, 0x3191, 0x4931, 0x3191, 0x2991, 0x3191, 0x0000,
+    0x0000, 0x3191, 0x3191, 0x2991, 0x3191, 0x4951, 0x210B, 0x0000,
+    0x0000, 0x6111, 0x1842, 0x0000, 0x0000, 0x0000, 0x90D1, 0x90F1,
+    0x2042, 0xD0B1, 0xC8B1, 0xE0B0, 0xE0B0, 0xA8D1, 0x0000, 0xE8AE,
+    0xE0AC, 0xC88E, 0xC8AE, 0xE8AA, 0xE0A8, 0xE8C8, 0xE0A8, 0xE0E7,
+    0xE106, 0xE965, 0xE165, 0xF285, 0xEA65, 0x90C4, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x9AA3, 0xF725, 0xFE65, 0xFE85,
+    0xFD65, 0xF585, 0xFC65, 0xFC85, 0xF365, 0xCA84, 0xE1A6, 0xE9C5,
+    0xE165, 0xE108, 0xE906, 0x5884, 0x986B, 0xE0AA, 0xE0AA, 0xE8AC,
+    0xE0AC, 0xE0AE, 0xE8AE, 0xE0B0, 0xC8B1, 0xB0D1, 0xC8B1, 0xA8B1,
+    0xD0B1, 0xC8B1, 0x608B, 0x0000, 0x0000, 0x78F1, 0x78D1, 0x78F1,
+    0x608B, 0x0000, 0x0000, 0x5151, 0x4931, 0x4951, 0x4931, 0x4951,
+    0x0000, 0x0000, 0x3191, 0x5131, 0x4951, 0x4931, 0x0000, 0x0000,
+    0x0000, 0x6111, 0x6111, 0x608B, 0x588B, 0x608B, 0x608B, 0xA8B1,
+    0xB0D1, 0xC8B1, 0xC8B1, 0xE0B0, 0xE0B0, 0xE0B0, 0xE0B0, 0x986B,
+    0xE0AE, 0xE8AE, 0xC8AE, 0xE0AC, 0xE0AA, 0xE8AC, 0xE0C8, 0xE0E7,
+    0xE106, 0xE145, 0xE165, 0xE9C5, 0xE9C5, 0xFB65, 0x5884, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3222, 0xFE85, 0xF725,
+    0xFE65, 0xFE65, 0xFC65, 0xF465, 0xF365, 0xF365, 0x5884, 0x0000,
+    0xE9C5, 0xE9C5, 0xE145, 0xE106, 0xE8E7, 0xE108, 0xE0C8, 0xE0AA,
+    0xC88A, 0x0000, 0xE0AC, 0xE8AE, 0xC8AE, 0xC8AE, 0x986B, 0xC8AE,
+    0xB0B1, 0xC8B1, 0xC8B1, 0xD0B1, 0xA8D1, 0x608B, 0x0000, 0x90D1,
+    0x78F1, 0x1842, 0x0000, 0x0000, 0x6111, 0x6111, 0x4931, 0x4931,
+    0x5151, 0x0000, 0x0000, 0x0000, 0x4931, 0x6911, 0x190B, 0x0000,
+    0x4951, 0x6911, 0x6111, 0x78F1, 0x78D1, 0x90D1, 0x78F1, 0x90D1,
+    0xB0D1, 0xC8B1, 0xC8B1, 0x1842, 0x0000, 0xE8B0, 0xE8AE, 0xE0B0,
+    0xE0AE, 0xE0AE, 0xE0AC, 0xE8AC, 0xE0AA, 0x988B, 0x0000, 0xE8AA,
+    0xE0E7, 0xE106, 0xE165, 0xE9C5, 0xE9C5, 0xF285, 0xEA65, 0x1842,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF725,
+    0xFE65, 0xF725, 0xF685, 0xFD65, 0xFC85, 0xF485, 0xC165, 0xCA64,
+    0xF285, 0xEA85, 0xE9C5, 0xE9C5, 0xE106, 0xE906, 0xE0E7, 0xE0E7,
+    0xE0C8, 0xC88A, 0xE8AC, 0xE0AC, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0xB0D1, 0xE0B0, 0xA8B1, 0xD0B1, 0xA8D1, 0xB0D1,
+    0x90D1, 0x90D1, 0x0000, 0x0000, 0x0000, 0x78F1, 0x6111, 0x6111,
+    0x6111, 0x6911, 0x0000, 0x0000, 0x0000, 0x6111, 0x6111, 0x6111,
+    0x6911, 0x78F1, 0x4931, 0x78D1, 0x78F1, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x588B, 0xD0B1, 0x988B, 0x1842, 0xE0B0, 0xE0B0,
+    0xE0AE, 0xE8AE, 0xE0AC, 0xE0AC, 0xE0AA, 0xE108, 0xE8AA, 0xC88A,
+    0x90E4, 0xE106, 0xE145, 0xE9C5, 0xE9C5, 0xEA65, 0xF285, 0xFB65,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0xFE65, 0xF725, 0xFE65, 0xFE65, 0xFD65, 0xFD65, 0xF485, 0xF365,
+    0xF265, 0xF365, 0xE9C5, 0xE9C5, 0xE145, 0xE165, 0xE106, 0xE108,
+    0xE0C8, 0xE8AA, 0xE0A8, 0xC8AE, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0xE0B0, 0xC8B1, 0x0000, 0x0000, 0x5884,
+    0xA8B1, 0xB0D1, 0x78D1, 0x0000, 0x0000, 0x0000, 0x78F1, 0x78D1,
+    0x78F1, 0x78D1, 0x6111, 0x0000, 0x0000, 0x0000, 0x4931, 0x78F1,
+    0x6111, 0x190B, 0x0000, 0x0000, 0x78F1, 0x90D1, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA08B, 0xE8AE, 0xE0B0,
+    0xC8B1, 0xE8AE, 0xE0AC, 0xE0AC, 0xE0AA, 0xE8AA, 0xE0A8, 0xE0C8,
+    0xE0A8, 0xD127, 0xE906, 0xE165, 0xE165, 0xE9C5, 0xE9C5, 0xF285,
+    0xEA65, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0xF725, 0xF725, 0xF725, 0xFE65, 0xFE65, 0xFD85, 0xF565,
+    0xFC85, 0xFC65, 0xF365, 0xEA85, 0xD127, 0xE9C5, 0xE965, 0xE165,
+    0xE106, 0xE108, 0xE0AA, 0xE8C8, 0xE8AA, 0xC88A, 0x5084, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0xE0B0, 0xE0B0, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x90D1, 0x78F1, 0x0000, 0x0000, 0x0000, 0x90F1,
+    0x90D1, 0x88F1, 0x90D1, 0x78D1, 0x0000, 0x0000, 0x0000, 0x6111,
+    0x78F1, 0x0000, 0x0000, 0x0000, 0x0000, 0xB0B1, 0xB0D1, 0x1842,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x588B, 0xE0B0, 0xE0B0, 0xE0B0,
+    0xE8AE, 0xC88E, 0xE0AC, 0xE0AC, 0xE8AA, 0xE0AC, 0xE0AA, 0xE0AA,
+    0xE8C8, 0xE108, 0xE106, 0xE165, 0xE145, 0xE9C5, 0xE9C5, 0xEA65,
+    0xF285, 0xF365, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0xCD65, 0xF725, 0xFE85, 0xFE65, 0xFD65, 0xFD65,
+    0xF485, 0xFC65, 0xF365, 0xF365, 0xF285, 0x0000, 0xD127, 0xE9C5,
+    0xE145, 0xE106, 0xE0E7, 0xE108, 0x0000, 0xE8AA, 0xE0AA, 0xE0AA,
+    0xE0AC, 0xE8AE, 0xE0AC, 0xE0AE, 0xE0AE, 0xE0B0, 0xA8D1, 0x0000,
+    0x0000, 0x0000, 0xA06B, 0xC8B1, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x90D1, 0xA8D1, 0x90D1, 0x90F1, 0x78F1, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x88D1, 0x608B, 0x0000, 0x0000, 0x0000, 0x90D1, 0xC8B1,
+    0xB0D1, 0xC8B1, 0xC8B1, 0xE0B0, 0xC8B1, 0xE8B0, 0xE0AE, 0xE0B0,
+    0x0000, 0xC8AE, 0xE8AC, 0xE0AC, 0xE0AC, 0xE0AC, 0xE8AA, 0x0000,
+    0xC88A, 0xE0E7, 0xE0E7, 0xE106, 0xE965, 0xE9C5, 0xE9C5, 0xEA85,
+    0xEA85, 0xF365, 0xC165, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0xCD65, 0xF725, 0xF725, 0xFE65, 0xFE85,
+    0xFD65, 0xF585, 0xFC65, 0xFC85, 0xF365, 0xF365, 0xEA65, 0xF285,
+    0xE9C5, 0xE9C5, 0xE165, 0xE906, 0x1842, 0x0000, 0x0000, 0x0000,
+    0x988B, 0xE8AC, 0xC88E, 0xE0AE, 0xE0AE, 0xE8AE, 0xE0AE, 0xD0B1,
+    0x0000, 0x0000, 0x588B, 0xE0B0, 0xD0B1, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0xA8D1, 0xB0B1, 0xA8D1, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x90D1, 0xB0D1, 0x1842, 0x0000, 0x0000, 0xB0B1,
+    0xA8D1, 0xE0B0, 0xC8B1, 0xE0B0, 0xB0B1, 0xB0D1, 0x1842, 0x0000,
+    0x0000, 0x0000, 0x0000, 0xE0AE, 0xE0AC, 0xE0AC, 0xE8AA, 0xE0AA,
+    0xE0C8, 0xE108, 0xE0E7, 0xE106, 0xE145, 0xE9C5, 0xE9C5, 0xF265,
+    0xEA85, 0xFB65, 0xFB65, 0x62A3, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x9AA3, 0xF725, 0xFF25, 0xF725,
+    0xFE85, 0xFE65, 0xFD65, 0xF565, 0xFC85, 0xF465, 0xF365, 0xFB65,
+    0xEA85, 0xF265, 0xE145, 0xE165, 0xE0A8, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xC8AE, 0xC88E, 0xE8AE,
+    0xC8AE, 0x0000, 0x986B, 0xE8B0, 0xE0B0, 0x988B, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x588B, 0x90D1, 0x608B, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x988B, 0xB0B1, 0xC8B1, 0x1842, 0x0000,
+    0xD0B1, 0xD0B1, 0xC8B1, 0x988B, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0xA06B, 0xE0AC, 0xE8AA, 0xE0AA,
+    0xE0C8, 0xE0E7, 0xE8E7, 0xE106, 0xE106, 0xE165, 0xE965, 0xE9C5,
+    0xEA85, 0xF365, 0xF365, 0xFC65, 0x5084, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3222, 0xF725, 0xF725,
+    0xF725, 0xF725, 0xFE65, 0xFE85, 0xF465, 0xFC85, 0xF465, 0xFC85,
+    0xF265, 0xF365, 0xF285, 0xE9C5, 0xE965, 0x1842, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xC88E, 0xC8AE, 0x986B,
+    0xE0AC, 0xE8AE, 0xC8AE, 0xE0B0, 0xE0AE, 0xE8B0, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xC8B1, 0xC8B1, 0xE0B0,
+    0xA8B1, 0xE0B0, 0xE0B0, 0xC8B1, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE8AA, 0xE0AA,
+    0xE0C8, 0xE108, 0xE0E7, 0xE926, 0xE106, 0xE145, 0xE1A6, 0xE9C5,
+    0xF285, 0xF365, 0xF365, 0xFC65, 0xFC85, 0x5884, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFF25,
+    0xF725, 0xF725, 0xFE65, 0xFE65, 0xCB84, 0x0000, 0x0000, 0xFC65,
+    0xEA85, 0x0000, 0x0000, 0xD127, 0xE9C5, 0xE9C5, 0xE0E8, 0xE165,
+    0xE108, 0xE108, 0x986B, 0x608B, 0x0000, 0x0000, 0xC88A, 0xE8AC,
+    0xE0AC, 0xE0AC, 0xE0AC, 0xE8AE, 0xE0AE, 0xE0AE, 0xC8AE, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x988B, 0xD0B1,
+    0xE0B0, 0xE0B0, 0xE0B0, 0xE0B0, 0xC8B1, 0x588B, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x1842, 0xA06B, 0xD0AE, 0xE8AC, 0xC88E, 0xE0AA,
+    0xE0C8, 0xE8AA, 0x5084, 0x0000, 0x90C4, 0xE965, 0x90C4, 0x0000,
+    0xD927, 0xF285, 0xEA85, 0xF365, 0xFB65, 0xF465, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0xD686, 0xF725, 0xF725, 0xF725, 0xFE65, 0x0000, 0x0000, 0x0000,
+    0xFC85, 0xFC85, 0x5064, 0xEA85, 0xF265, 0xEA85, 0xE9C5, 0xE9C5,
+    0xE165, 0xE965, 0xE106, 0xE106, 0xE0E7, 0xE108, 0xE8C8, 0xE0AA,
+    0xE0AA, 0xE108, 0xE0AC, 0xE8AC, 0xE0AC, 0xE0AE, 0xE8AE, 0xC8B1,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xB0B1,
+    0x588B, 0xE0B0, 0xE0B0, 0xE0B0, 0xE0B0, 0xE0B0, 0xE0AE, 0xE0B0,
+    0xE0AE, 0xE8AE, 0xE0AC, 0xE0AC, 0xE0AC, 0xE108, 0xE8AA, 0xE0AA,
+    0xE0C8, 0xE108, 0xE0C8, 0xC88A, 0x0000, 0xE108, 0xE145, 0xC0C6,
+    0x0000, 0x0000, 0xE9C5, 0xFB65, 0xF365, 0xF465, 0xFC85, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0xCE66, 0xCF26, 0xFF25, 0xF725, 0xFD65, 0x0000, 0x0000,
+    0x0000, 0xF365, 0xFC85, 0xF465, 0xF365, 0xFB65, 0xEA85, 0xF265,
+    0xE9C5, 0xE9C5, 0xE145, 0xE165, 0xE106, 0xE106, 0xE0C8, 0xE8C8,
+    0xE0A8, 0xE0AA, 0xE0C8, 0xE8AA, 0xE0AA, 0xE0AC, 0x986B, 0xE8AE,
+    0x5084, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0xA08B, 0xC8B1, 0x0000, 0xE0B0, 0xE8AE, 0xE0AE, 0xE0AE, 0xE0AE,
+    0xE8AC, 0xE0AE, 0xE0AC, 0xE0AC, 0xE8AA, 0xE0AA, 0xE0A8, 0xE0AA,
+    0xE8C8, 0xE0E7, 0xE0A8, 0xE0E7, 0xE906, 0xE165, 0xE165, 0xE1A6,
+    0x0000, 0x0000, 0x0000, 0x5884, 0xFB65, 0xF485, 0xFC85, 0xF365,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x9CE5, 0xF725, 0xF725, 0xFF25, 0xCC84, 0x0000,
+    0x0000, 0x0000, 0x90C4, 0xF585, 0xFC65, 0xFC85, 0xF365, 0xFB65,
+    0x988B, 0x90C4, 0xE9C5, 0xE9C5, 0xE165, 0xE165, 0xE106, 0xE906,
+    0xE0E7, 0xE108, 0xE0C8, 0xE0AA, 0xE8AA, 0xE0AC, 0xC88E, 0xE0AC,
+    0xE8AC, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0xE8AE, 0x988B, 0x986B, 0xE0AE, 0xE0AE, 0xE8AE,
+    0xE0AC, 0xE0AE, 0xE0AC, 0xE8AC, 0xE0AA, 0xE0AC, 0xE0AA, 0xE8AA,
+    0xE0C8, 0xE108, 0xE0AA, 0xE126, 0xE906, 0xE145, 0xE145, 0xE9C5,
+    0xD127, 0x0000, 0x0000, 0x0000, 0x0000, 0xF485, 0xFC65, 0xFD85,
+    0x9AA3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x3222, 0xD746, 0xF725, 0xD726, 0xCC64,
+    0x0000, 0x0000, 0x0000, 0xFC65, 0xF585, 0xFD65, 0xFC85, 0x9AA3,
+    0x0000, 0x0000, 0xD127, 0xF285, 0xE9C5, 0xE1C5, 0xE145, 0xE145,
+    0xE108, 0xE906, 0xE0E7, 0xE0E7, 0xE0AA, 0xE8C8, 0xE0C8, 0x0000,
+    0xE0AA, 0xE0AC, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0xE8AE, 0xC88E, 0x0000, 0xE0AC, 0xE0AC,
+    0xE8AC, 0xE0AC, 0xE0AA, 0xE0AC, 0xE8AC, 0xE0AA, 0xE0C8, 0xE0A8,
+    0xE8C8, 0xE0E7, 0xE0A8, 0x0000, 0x0000, 0xC0C6, 0xE165, 0xE9C5,
+    0xE9C5, 0xF285, 0x0000, 0x0000, 0x0000, 0x5064, 0xFC85, 0xFD85,
+    0xFD65, 0x1842, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCF26, 0xCF46, 0xF725,
+    0xCB84, 0x0000, 0x0000, 0x0000, 0xFD65, 0xFE65, 0xFD85, 0xFC85,
+    0x0000, 0x0000, 0xC165, 0xF365, 0xF265, 0xF285, 0x90E4, 0x986B,
+    0xE165, 0xE165, 0xE906, 0xE108, 0x0000, 0xD127, 0xE8C8, 0xE108,
+    0xC88A, 0xE8AA, 0x1842, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x5084, 0xE8AE, 0x5884, 0xC88E,
+    0xE0AC, 0xE8AC, 0x1842, 0xE0AC, 0xE0AA, 0xE8AA, 0xE0C8, 0xE0AC,
+    0xC0C6, 0xE108, 0xE0E7, 0xE106, 0xC0C6, 0x0000, 0x0000, 0xD127,
+    0xE9C5, 0xF265, 0xF285, 0x0000, 0x0000, 0x0000, 0x5084, 0xFD65,
+    0xFD65, 0xFE85, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCD65, 0xCF26,
+    0xD726, 0xCC64, 0x0000, 0x0000, 0x0000, 0xFD85, 0xFD65, 0xF585,
+    0xFC65, 0xCA64, 0xC165, 0xFC85, 0xF365, 0xF365, 0xC165, 0x0000,
+    0xE1A6, 0xE9C5, 0xE165, 0x90E4, 0x0000, 0xC0C6, 0xE8E7, 0xE0E7,
+    0xE8A8, 0xE0C8, 0xE0A8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE0AC, 0xE8AC,
+    0xE0AA, 0xE0AA, 0xE0AA, 0x988B, 0x0000, 0xA06B, 0xE0C8, 0xE8A8,
+    0xC88A, 0x0000, 0xC8AA, 0xE106, 0xE126, 0xE165, 0x1842, 0x98C4,
+    0xE9A6, 0xF285, 0xEA85, 0xF365, 0x0000, 0x0000, 0x0000, 0x9AA3,
+    0xFC85, 0xFE85, 0xF465, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD565,
+    0xA6C7, 0xCD85, 0xCC84, 0x9AA3, 0x0000, 0x0000, 0x1822, 0xFE65,
+    0xFE85, 0xF565, 0xFC85, 0xFD65, 0xFC85, 0xFC85, 0x90C4, 0x0000,
+    0x5084, 0xF285, 0xE9C5, 0x0000, 0x0000, 0xE108, 0xE145, 0xE165,
+    0xE108, 0xC0C6, 0xE0C8, 0xC0C6, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xC88A,
+    0xE8AA, 0xE0AC, 0xE0AA, 0xE0AA, 0xE8C8, 0xC88A, 0x0000, 0x0000,
+    0xE0E7, 0xE906, 0x1842, 0x0000, 0x988B, 0xE9C5, 0xE1A6, 0xE9C5,
+    0xE1A6, 0xCA64, 0xF285, 0xF365, 0xE1A6, 0x0000, 0x0000, 0x0000,
+    0xCB84, 0xFD65, 0xFE85, 0xCC64, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x62A3, 0xD726, 0xCE86, 0x62A3, 0xD565, 0x0000, 0x0000, 0x0000,
+    0xCC64, 0xFE85, 0xFD65, 0xFD65, 0xFD85, 0xF465, 0xCA64, 0xF285,
+    0xF365, 0xF365, 0xF265, 0xEA85, 0xC165, 0xE9C5, 0xE1A6, 0xE165,
+    0x90C4, 0x0000, 0xE108, 0xE906, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0xE0AA, 0xE8C8, 0x0000, 0x90E4, 0xE0E7, 0xE8A8, 0xE108,
+    0x0000, 0xE106, 0xE126, 0xE165, 0xE108, 0x0000, 0x588B, 0xE9C5,
+    0xE9C5, 0xF285, 0xF265, 0xF365, 0xF365, 0x0000, 0x0000, 0x0000,
+    0xCA64, 0xCB84, 0xCD85, 0xFE65, 0x5064, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0xA6C7, 0xD726, 0x62A3, 0x9CE5, 0xF665, 0xFD65,
+    0x0000, 0xFE65, 0xFE65, 0xF665, 0xFE65, 0xFE85, 0xFD65, 0xF585,
+    0xFC65, 0xFC85, 0xF365, 0x0000, 0xEA85, 0xF365, 0xF285, 0xE1A6,
+    0x0000, 0x0000, 0xE945, 0xE965, 0x90C4, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x5084, 0xE8E7, 0xE0C8, 0x0000, 0x0000, 0xE108,
+    0xE106, 0xE165, 0xE906, 0x5084, 0xE108, 0xE9C5, 0xE9C5, 0xEA65,
+    0xE9C5, 0xF365, 0xF285, 0xF365, 0xFB65, 0xFC85, 0x0000, 0x5084,
+    0xCA64, 0xFB65, 0x5864, 0xFE65, 0xFE85, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0xCD65, 0xA6C7, 0xA6A7, 0x0000, 0xD464,
+    0xCE86, 0xFF25, 0xF725, 0x62A3, 0x0000, 0x9AA3, 0x0000, 0xFC85,
+    0xFD65, 0xFD85, 0xCB84, 0x0000, 0x0000, 0xF265, 0xEA85, 0x5064,
+    0x0000, 0x5884, 0xE9C5, 0xE9C5, 0xD127, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0xC0C6, 0xE108, 0xE8E7, 0x1842,
+    0x0000, 0x5884, 0xE108, 0xE965, 0x0000, 0x0000, 0xD127, 0xF285,
+    0xEA65, 0xF285, 0x90C4, 0x90C4, 0x0000, 0x5884, 0xFC85, 0xFD85,
+    0xCB84, 0xCA64, 0x0000, 0x9AA3, 0xFE85, 0xFD65, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0xCB64, 0xA6C7, 0xA6C7, 0x0000,
+    0x0000, 0x9CE5, 0xF725, 0x9CE5, 0x0000, 0x0000, 0x0000, 0x0000,
+    0xFD65, 0xFE65, 0xF585, 0x0000, 0x0000, 0xFC65, 0xFB65, 0x0000,
+    0x0000, 0x1842, 0xEA85, 0xF285, 0xE9C5, 0xE1C6, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE108, 0xE108, 0xD127,
+    0xE906, 0x5084, 0x0000, 0x0000, 0xE1A6, 0xE9C5, 0x0000, 0x0000,
+    0xF285, 0xF365, 0xFB65, 0x0000, 0x0000, 0x0000, 0x0000, 0x9AA3,
+    0xF565, 0xFC85, 0x0000, 0x0000, 0xCC64, 0xF725, 0xCB84, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8667, 0xA6C7,
+    0x0000, 0xD686, 0xD726, 0x9AA3, 0x0000, 0x0000, 0x0000, 0x0000,
+    0xFC65, 0xFE85, 0xF565, 0xCA64, 0x0000, 0xFD65, 0xF365, 0x0000,
+    0x0000, 0x0000, 0xF285, 0xF365, 0xF265, 0xEA85, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1842, 0xE945,
+    0xE145, 0xD127, 0xE965, 0x5084, 0x0000, 0x0000, 0xE9A6, 0xF285,
+    0x0000, 0x90C4, 0xF365, 0xF365, 0xF285, 0x0000, 0x0000, 0x0000,
+    0x0000, 0xCB84, 0xFD85, 0xF465, 0x0000, 0xFE85, 0xF725, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8667,
+    0x8667, 0xA6A7, 0xA6C7, 0xD686, 0x6AA3, 0x0000, 0x0000, 0x0000,
+    0x1822, 0xF725, 0xFE65, 0xFE85, 0x90C4, 0xF665, 0xFC85, 0x0000,
+    0x0000, 0x0000, 0xF365, 0xFC85, 0xF365, 0xFB65, 0xE1A6, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0xD127, 0xEA65, 0xE9C5, 0xF285, 0xE1A6, 0x0000, 0x0000, 0x0000,
+    0xEA85, 0xF365, 0x0000, 0xFC65, 0xF485, 0xFD65, 0xC165, 0x0000,
+    0x0000, 0x0000, 0x0000, 0xFE65, 0xFE65, 0xFE65, 0xF725, 0xFE65,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x64A6, 0x8667, 0x8667, 0x9CE5, 0xAEC7, 0xD726, 0xCE66, 0xCD65,
+    0xFC85, 0xF725, 0xFE65, 0x0000, 0xFE65, 0xFE65, 0xCC64, 0x0000,
+    0x0000, 0x0000, 0xEA85, 0xFC65, 0xF485, 0xFC65, 0xF365, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0xE1A6, 0xF285, 0xEA85, 0xF265, 0xE1A6, 0x0000,
+    0x0000, 0x0000, 0xF285, 0xF485, 0xFC65, 0xCA64, 0xCB84, 0xF585,
+    0xCB84, 0xCB84, 0xCB84, 0xFE65, 0xFE65, 0x5064, 0xFE85, 0xF725,
+    0x9AA3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x6E08, 0x8667, 0x9CE5, 0xA6C7, 0xCD65, 0xCE86,
+    0xCB84, 0xFF25, 0xF725, 0x0000, 0x62A3, 0xF725, 0xF725, 0xFE65,
+    0xFD85, 0xFD65, 0xF585, 0xFD65, 0xFD85, 0xFD65, 0xF485, 0xCA64,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0xE1A6, 0xF285, 0xF365, 0xFB65, 0xF365,
+    0xEA65, 0xFB65, 0xF365, 0xF365, 0xF485, 0xFD65, 0xFC85, 0x0000,
+    0xF565, 0xFE85, 0x9AA3, 0xFD65, 0xFE65, 0xFF25, 0xCD65, 0xF725,
+    0xD746, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x6E28, 0x6E08, 0x0000, 0x9CE5, 0x62A3,
+    0x9CE5, 0xD726, 0xD726, 0x9AA3, 0x0000, 0xF725, 0xF725, 0xFF25,
+    0xF725, 0xFE85, 0xFE65, 0xFE65, 0xF565, 0xFE65, 0xFD65, 0xF485,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF365, 0xFB65, 0xF465,
+    0xF365, 0xFC85, 0xFC65, 0xF485, 0xFC65, 0xF585, 0xFD65, 0xFE85,
+    0x0000, 0x62A3, 0xFE65, 0xFE65, 0xCC64, 0x9AA3, 0xCB84, 0x3242,
+    0xCF26, 0xD686, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x6AA3, 0x6E08, 0x8667, 0x8667,
+    0x8667, 0xA6C7, 0xA6A7, 0xCE86, 0x0000, 0xF725, 0xCF26, 0xFD85,
+    0xCC64, 0xFD85, 0xCC64, 0xF725, 0xFE65, 0xF725, 0xFE65, 0xFE85,
+    0x5884, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x90C4, 0xF465,
+    0xFC85, 0xFD65, 0xF485, 0xFD65, 0xF365, 0xCB84, 0xFC85, 0xCC64,
+    0xF665, 0xFD65, 0x0000, 0xFE85, 0xFF25, 0xF725, 0xCB64, 0xFE65,
+    0xCF46, 0xFF25, 0x5064, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4DA8, 0x6E28,
+    0x6E08, 0x8667, 0x8667, 0x3222, 0x9CE5, 0xD686, 0xA6C7, 0xD666,
+    0xCD65, 0xCD85, 0xD726, 0xF725, 0xF725, 0xFF25, 0xFE65, 0xFE65,
+    0xCB84, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0xCB84, 0xF565, 0xFC85, 0xFD65, 0xF585, 0xFE65, 0xFD65, 0xF365,
+    0xCB84, 0xFE85, 0xFE65, 0xCC64, 0xCD65, 0xCB84, 0xCE86, 0xF725,
+    0xCF26, 0xD726, 0xCE86, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x34C8,
+    0x2D49, 0x6E28, 0x9CE5, 0x9CE5, 0x6AA3, 0xA6A7, 0xA6C7, 0x9CE5,
+    0x9AA3, 0xCF26, 0xD746, 0xF725, 0xF725, 0xF725, 0xF725, 0xF725,
+    0xFD65, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0xFC65, 0xF685, 0xFD65, 0xFE65, 0xFE65, 0xFE65,
+    0xFE65, 0xF725, 0xFC85, 0x62A3, 0xF725, 0xFF25, 0xCB84, 0x9AA3,
+    0xCD65, 0xCF26, 0xD726, 0x62A3, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x55A8, 0x2D49, 0x0000, 0xA4E5, 0x8667, 0x6628, 0xAEC7,
+    0x9CE5, 0xA6A7, 0xA6C7, 0xD726, 0xCF26, 0xFF25, 0xCF26, 0xF725,
+    0xFE65, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0xFD65, 0xFE65, 0xFE65, 0xF725,
+    0xFE65, 0xF725, 0xF725, 0xF725, 0x9AA3, 0xFE85, 0xCF26, 0xCD65,
+    0xCB84, 0x9CE5, 0xA6C7, 0xAEA7, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x2042, 0x2D49, 0x4DA8, 0x8667, 0x6E08, 0x8667,
+    0x9CE5, 0xA6C7, 0xAEA7, 0xA6C7, 0xA6A7, 0xCF26, 0xCF26, 0xCF26,
+    0xCF26, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFE65, 0xFF25,
+    0xF725, 0xF725, 0xF725, 0xFF25, 0xF725, 0xF725, 0xD686, 0xCF26,
+    0xCF26, 0xD726, 0xA6A7, 0xA6C7, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x6CA6, 0x2D69, 0x2D49, 0x4DA8,
+    0x55A8, 0x6E28, 0x6E28, 0x8667, 0x8667, 0xA6A7, 0xA6C7, 0xA6A7,
+    0xAEC7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0xFC65, 0xF725, 0xCF26, 0xF725, 0xD726, 0xF725, 0xCF26, 0xCF26,
+    0xD686, 0xCF26, 0xA6A7, 0xA6C7, 0x9AA3, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x55A8, 0x2D49,
+    0x2D49, 0x4DA8, 0x4DA8, 0x6E28, 0x6E08, 0x8667, 0x8667, 0xA6C7,
+    0xCD85, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0xCB64, 0xF725, 0xCF26, 0xF725, 0xD726, 0xCF26,
+    0xA6C7, 0xD726, 0xA6A7, 0xAEC7, 0x9CE5, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x6CA6, 0x2D69, 0x2D49, 0x55A8, 0x4DA8, 0x6E28, 0x55A8, 0x8667,
+    0x6AA3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x62A3, 0xD726, 0xA6C7, 0xCF26,
+    0xA6A7, 0xA6C7, 0x8667, 0x8667, 0x6CA6, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x3A22, 0x4DA8, 0x4DA8, 0x6E08, 0x6E28, 0x64A6,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9CE5,
+    0xD565, 0xA6C7, 0xA6A7, 0xAEC7, 0x3222, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000 },
+  { 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x34C8, 0x04EA, 0x04EA,
+    0x04EA, 0x34C8, 0x3A42, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3A22, 0x34C8,
+    0x04EA, 0x152A, 0x04EA, 0x34C8, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3CC8, 0x04EA, 0x04EA,
+    0x04EA, 0x04EA, 0x04EA, 0x152A, 0x150A, 0x34C8, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3CC8, 0x3CC8, 0x152A,
+    0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x2D49, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x04EA, 0x04EA, 0x04EA,
+    0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA,
+    0x150A, 0x3242, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x3A22, 0x34C8, 0x04EA, 0x04EA, 0x04EA,
+    0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x150A, 0x04EA, 0x04EA,
+    0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA,
+    0x04EA, 0x04EA, 0x04EA, 0x152A, 0x34C8, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x6CA6, 0x150A, 0x04EA, 0x04EA, 0x04EA, 0x04EA,
+    0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA,
+    0x04EA, 0x152A, 0x0000, 0x0000, 0x0000, 0x04EA, 0x04EA, 0x04EA,
+    0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA,
+    0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x3CC8,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x4DA8, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA,
+    0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA,
+    0x04EA, 0x04EA, 0x04EA, 0x3A42, 0x0000, 0x0000, 0x04EA, 0x04EA,
+    0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA,
+    0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA,
+    0x04EA, 0x04EA, 0x34C8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x6CA6, 0x2D49, 0x152A, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA,
+    0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA,
+    0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x150A, 0x0000, 0x09EE, 0x04EA,
+    0x04EA, 0x04EA, 0x04EA, 0x0000, 0x152A, 0x04EA, 0x04EA, 0x04EA,
+    0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA,
+    0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x55A8, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9CE5,
+    0x55A8, 0x4DA8, 0x2D69, 0x150A, 0x152A, 0x04EA, 0x04EA, 0x04EA,
+    0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA,
+    0x04EA, 0x3CC8, 0x0000, 0x04EA, 0x04EA, 0x150A, 0x1842, 0x3CC8,
+    0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x150A, 0x2D69, 0x150A, 0x04EA,
+    0x04EA, 0x34C8, 0x3A42, 0x04EA, 0x34C8, 0x2D49, 0x04EA, 0x04EA,
+    0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x152A,
+    0x64A6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD565, 0x8667,
+    0x6E08, 0x6E28, 0x4DA8, 0x55A8, 0x2D69, 0x2D49, 0x152A, 0x150A,
+    0x04EA, 0x04EA, 0x152A, 0x2D49, 0x04EA, 0x6CA6, 0x04EA, 0x04EA,
+    0x04EA, 0x152A, 0x3CC8, 0x34C8, 0x04EA, 0x04EA, 0x04EA, 0x3CC8,
+    0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x0000,
+    0x04EA, 0x04EA, 0x152A, 0x0000, 0x150A, 0x2D69, 0x0000, 0x2D49,
+    0x04EA, 0x04EA, 0x04EA, 0x152A, 0x04EA, 0x04EA, 0x04EA, 0x04EA,
+    0x150A, 0x2D69, 0x3549, 0xA4E5, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCC84, 0xA6C7, 0xA6A7,
+    0xA6C7, 0xAEA7, 0x6628, 0x6E08, 0x4DA8, 0x55A8, 0x2D49, 0x2D69,
+    0x150A, 0x152A, 0x6AA3, 0x0000, 0x34C8, 0x55A8, 0x0000, 0x150A,
+    0x04EA, 0x2D69, 0x34C8, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA,
+    0x150A, 0x152A, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x0000, 0x34C8,
+    0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x0000, 0x3A22, 0x152A, 0x0000,
+    0x0000, 0x150A, 0x04EA, 0x152A, 0x6CA6, 0x150A, 0x04EA, 0x152A,
+    0x150A, 0x2D69, 0x2D49, 0x4DA8, 0x4DA8, 0x8687, 0x9AA3, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0xCB64, 0xF725, 0xD726, 0xCF26,
+    0xCF26, 0xD726, 0xA6C7, 0xAEA7, 0x8667, 0x8667, 0x6E28, 0x6E28,
+    0x2D49, 0x2D69, 0x2D49, 0x0000, 0x6CA6, 0x2D69, 0x0000, 0x2042,
+    0x04EA, 0x04EA, 0x04EA, 0x150A, 0x1842, 0x55A8, 0x04EA, 0x04EA,
+    0x04EA, 0x152A, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x150A,
+    0x0000, 0x34C8, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA,
+    0x3CC8, 0x0000, 0x152A, 0x6CA6, 0x04EA, 0x04EA, 0x6CA6, 0x64A6,
+    0x150A, 0x2D69, 0x2D49, 0x55A8, 0x4DA8, 0x8667, 0x8667, 0xAEC7,
+    0xA6C7, 0x1822, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x5884, 0xFE85, 0xFF25, 0xFF25, 0xF725,
+    0xCF26, 0xF725, 0xD726, 0xCF26, 0xA6A7, 0xA6C7, 0x9CE5, 0x8667,
+    0x4DA8, 0x6E08, 0x6CA6, 0x6E28, 0x0000, 0x2D49, 0x0D0A, 0x55A8,
+    0x04EA, 0x04EA, 0x04EA, 0x152A, 0x0000, 0x0000, 0x150A, 0x04EA,
+    0x04EA, 0x04EA, 0x04EA, 0x150A, 0x04EA, 0x04EA, 0x04EA, 0x04EA,
+    0x04EA, 0x2D69, 0x34C8, 0x150A, 0x04EA, 0x04EA, 0x04EA, 0x04EA,
+    0x04EA, 0x04EA, 0x6CA6, 0x4DA8, 0x0000, 0x2D69, 0x04EA, 0x150A,
+    0x0000, 0xA4E5, 0x2D49, 0x4DA8, 0x6628, 0x8667, 0x8667, 0xA6A7,
+    0xA6C7, 0xD726, 0xCF26, 0xCC64, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0xF365, 0xFE65, 0xF725, 0xFE65, 0xF725,
+    0xF725, 0xFF25, 0xF725, 0xF725, 0xD726, 0xD746, 0x3242, 0x9AA3,
+    0x8667, 0x8667, 0x64A6, 0x6CA6, 0x6CA6, 0x9CE5, 0x150A, 0x152A,
+    0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x150A, 0x55A8, 0x34C8, 0x04EA,
+    0x04EA, 0x04EA, 0x04EA, 0x152A, 0x04EA, 0x04EA, 0x04EA, 0x04EA,
+    0x04EA, 0x04EA, 0x04EA, 0x152A, 0x04EA, 0x04EA, 0x150A, 0x3CC8,
+    0x34C8, 0x152A, 0x04EA, 0x04EA, 0x04EA, 0x0000, 0x150A, 0x6CA6,
+    0x34C8, 0x2D69, 0x6CA6, 0x6E28, 0x5864, 0x8667, 0x8667, 0xAEC7,
+    0xA6C7, 0xD726, 0xCF26, 0xF725, 0xFF25, 0xFD65, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0xF465, 0xFD85, 0xFD65, 0xFD85, 0xF665,
+    0xFE65, 0xF725, 0xFE65, 0xF725, 0xCE86, 0xCD65, 0xD686, 0xCD65,
+    0xA6C7, 0xA6A7, 0x9CE5, 0xA4E5, 0x5864, 0x4DA8, 0x2D69, 0x2D69,
+    0x34C8, 0x6CA6, 0x6AA3, 0x150A, 0x04EA, 0x2D69, 0x150A, 0x04EA,
+    0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x152A, 0x3CC8, 0x04EA, 0x04EA,
+    0x04EA, 0x04EA, 0x04EA, 0x34C8, 0x3CC8, 0x04EA, 0x04EA, 0x2D49,
+    0x34C8, 0x55A8, 0x04EA, 0x2D69, 0x6CA6, 0x04EA, 0x04EA, 0x0D0A,
+    0x6CA6, 0x0000, 0x55A8, 0x4DA8, 0x6628, 0x9CE5, 0xD585, 0x5864,
+    0xA6A7, 0xCF26, 0xCF26, 0xF725, 0xFF25, 0xF725, 0xF725, 0xF685,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0xFC65, 0xF485, 0xFD65, 0xFD85, 0xFD65,
+    0xF565, 0xFE65, 0xFE85, 0xF465, 0xFC65, 0xFE85, 0x9AA3, 0xFF25,
+    0xCF26, 0xD726, 0x0000, 0xA6A7, 0x8667, 0x8667, 0x6E28, 0x6E28,
+    0x2D49, 0x4DA8, 0x6CA6, 0x6CA6, 0x2D69, 0x04EA, 0x04EA, 0x34C8,
+    0x2D49, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x6CA6, 0x3242, 0x04EA,
+    0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x150A, 0x0000, 0x04EA, 0x04EA,
+    0x0000, 0x0000, 0x0000, 0x3CC8, 0x34C8, 0x0000, 0x3CC8, 0x2D69,
+    0x150A, 0x2D69, 0x0000, 0x0000, 0x55A8, 0x8667, 0x8667, 0xAEC7,
+    0xA6A7, 0xD726, 0xCF26, 0xF725, 0xF725, 0xFF25, 0xFE65, 0xFE65,
+    0xF665, 0xFD65, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0xF365, 0xF365, 0xFC85, 0xF365, 0xFC65,
+    0xF485, 0xFD65, 0xFD85, 0xFE65, 0xF565, 0xFE85, 0xFE65, 0xF725,
+    0xF725, 0xF725, 0x0000, 0x0000, 0xA6A7, 0xA6C7, 0x8667, 0x8667,
+    0x0000, 0x6E08, 0x0000, 0x0000, 0x0000, 0x64A6, 0x04EA, 0x150A,
+    0x0000, 0x152A, 0x04EA, 0x04EA, 0x04EA, 0x150A, 0x1842, 0x0000,
+    0x34C8, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x150A, 0x0000, 0x04EA,
+    0x04EA, 0x3569, 0x2D49, 0x2D69, 0x34C8, 0x2D49, 0x2D69, 0x2D49,
+    0x6AA3, 0x55A8, 0x2D49, 0x6628, 0x0000, 0xA6A7, 0x8667, 0xA6C7,
+    0xA6A7, 0xFE65, 0xCE86, 0xFE65, 0xFE65, 0xFF25, 0xF725, 0xF725,
+    0xF665, 0xFE65, 0xFD85, 0xF465, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0xF285, 0xF265, 0xF365, 0xF365, 0xF365,
+    0xF365, 0xFC85, 0xF465, 0xFC85, 0xF465, 0xFE65, 0xFE65, 0xFE65,
+    0xF725, 0xFF25, 0x0000, 0x0000, 0xCF26, 0xCF26, 0xD585, 0xCD65,
+    0x8667, 0x9CE5, 0x6E08, 0x6E28, 0x6CA6, 0x9CE5, 0x6CA6, 0x04EA,
+    0x2D69, 0x0000, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x3CC8, 0x0000,
+    0x0000, 0x0000, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA,
+    0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x3CC8, 0x6CA6, 0x04EA, 0x152A,
+    0x6CA6, 0x64A6, 0x6CA6, 0x4DA8, 0x4DA8, 0x8667, 0x5864, 0xAEC7,
+    0xA6C7, 0xD726, 0xCC64, 0x0000, 0x0000, 0x0000, 0x0000, 0xFE85,
+    0xFD65, 0xFD65, 0xF485, 0xFC65, 0xF485, 0xF365, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0xD127, 0x90C4, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0xA06B, 0xC88A, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0xE1C6, 0xE9C5, 0xE9C5, 0xE9C5, 0xEA85,
+    0xF285, 0xF365, 0xF265, 0x0000, 0x0000, 0x0000, 0x0000, 0xF365,
+    0xFD85, 0xF665, 0xFD65, 0x0000, 0xFE85, 0xF725, 0xCE66, 0xCC64,
+    0xA6C7, 0xA6C7, 0x8667, 0x6E08, 0x64A6, 0x6E28, 0x2D49, 0x150A,
+    0x04EA, 0x04EA, 0x152A, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x3CC8, 0x04EA, 0x04EA, 0x04EA, 0x04EA,
+    0x04EA, 0x2D69, 0x34C8, 0x55A8, 0x04EA, 0x0D0A, 0x04EA, 0x4DA8,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD565, 0x8667, 0xA6C7,
+    0xA6C7, 0xCD65, 0x0000, 0xFF25, 0xFE85, 0x0000, 0x0000, 0x0000,
+    0x5064, 0xF585, 0xFC65, 0xF485, 0xFC65, 0xFC85, 0xF365, 0xF285,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE1C6, 0xE106, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0xE0C8, 0xE108, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0xE106, 0xE965, 0xE1A6, 0xE145, 0xE1C5,
+    0xE9C5, 0xF265, 0xEA85, 0x0000, 0x0000, 0x0000, 0x0000, 0xFC65,
+    0xFD85, 0x0000, 0xF565, 0xFE65, 0xFE65, 0xFF45, 0xA2A3, 0x0000,
+    0x0000, 0x0000, 0x1842, 0x6CA6, 0x8667, 0x8667, 0x55A8, 0x4DA8,
+    0x4DA8, 0xA4E5, 0x150A, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x34C8,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x150A, 0x04EA, 0x04EA,
+    0x04EA, 0x2D69, 0x0000, 0x0000, 0x0000, 0x0000, 0x6AA3, 0x150A,
+    0x152A, 0x3222, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xAEC7,
+    0xA6C7, 0xD726, 0xD666, 0x0000, 0x0000, 0xFE65, 0xFE65, 0x1842,
+    0x0000, 0x0000, 0x90C4, 0xFC85, 0xF365, 0xF265, 0xF285, 0xEA65,
+    0xF285, 0xE1A6, 0x0000, 0x0000, 0x0000, 0x0000, 0xC88A, 0xE106,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x1842, 0xE8C8, 0x988B, 0x0000,
+    0x0000, 0x0000, 0x0000, 0xE8AC, 0xE0E7, 0xE106, 0xE106, 0xE965,
+    0xE108, 0xE9C5, 0xE165, 0x0000, 0x0000, 0x0000, 0x0000, 0xF365,
+    0xF365, 0x90C4, 0x0000, 0xFD85, 0xFD85, 0xFE65, 0xFD65, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA6C7, 0x6628, 0x9CE5,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x34C8, 0x04EA, 0x04EA, 0x2D49,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3CC8, 0x04EA,
+    0x04EA, 0x04EA, 0x2D69, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x2D49, 0x150A, 0x64A6, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0xCF26, 0xCF46, 0xF725, 0xCB84, 0x0000, 0x0000, 0xFD65,
+    0xFD85, 0xCA64, 0x0000, 0x0000, 0x1842, 0xF365, 0xF285, 0xC165,
+    0xE9C5, 0xEA85, 0xE9C5, 0xC0C6, 0x0000, 0x0000, 0x0000, 0x0000,
+    0xE8AA, 0xD127, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE108, 0xE0AC, 0x0000,
+    0x0000, 0x0000, 0x0000, 0xC88A, 0xE0C8, 0xE108, 0xE8E7, 0xE108,
+    0xE108, 0xE165, 0xE106, 0x0000, 0x0000, 0x0000, 0xC165, 0xF365,
+    0xF265, 0x0000, 0x0000, 0xF365, 0xFD65, 0xFE85, 0xFD65, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x9AA3, 0xD746, 0xD565, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4DA8, 0x04EA, 0x04EA,
+    0x6AA3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x04EA, 0x04EA, 0x04EA, 0x150A, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x3242, 0x6CA6, 0x34C8, 0x2D49, 0x2D69, 0xA2A3, 0x0000, 0x0000,
+    0x98C4, 0x3242, 0xD686, 0xFF25, 0xF725, 0xF725, 0x9AA3, 0x0000,
+    0x0000, 0xCB84, 0xFC85, 0xFB65, 0x0000, 0x0000, 0x0000, 0xE9C5,
+    0xE9C5, 0xD127, 0xE0E8, 0xE165, 0xE106, 0x0000, 0x0000, 0x0000,
+    0x0000, 0xC8AE, 0xE0AA, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xC88E, 0x988B,
+    0x0000, 0x0000, 0x0000, 0x1842, 0xE8A8, 0xE8AA, 0xE8C8, 0xE0AA,
+    0xE0A8, 0xE0E7, 0xE8C8, 0x0000, 0x0000, 0x0000, 0xE108, 0xE9C5,
+    0xC165, 0x0000, 0x0000, 0xE1A6, 0xF385, 0xFC85, 0xF465, 0xF365,
+    0x0000, 0x62A3, 0x1842, 0x0000, 0xD384, 0xFF25, 0xCF46, 0xCE66,
+    0xCD65, 0x3242, 0x0000, 0x0000, 0x0000, 0x0000, 0x150A, 0x04EA,
+    0x04EA, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0D0A, 0x04EA, 0x04EA, 0x04EA, 0x0000, 0x0000, 0x0000,
+    0x6CA6, 0x4DA8, 0x6CA6, 0x3222, 0x0000, 0x6E28, 0x6608, 0x8667,
+    0x8667, 0xD726, 0xCF26, 0xCF46, 0xF725, 0xFF25, 0xF725, 0xF725,
+    0xF465, 0x0000, 0xFC85, 0xF485, 0xF365, 0xFC85, 0xE9A6, 0x0000,
+    0x0000, 0xD127, 0xE145, 0xE165, 0xE108, 0xE106, 0xE8C8, 0x0000,
+    0x0000, 0x0000, 0x0000, 0xE8AC, 0x986B, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA8D1, 0xE0AE,
+    0x0000, 0x0000, 0x0000, 0x0000, 0xE0AC, 0xE8AC, 0xE0AA, 0xE0AC,
+    0xE0AA, 0xE8AA, 0xE0AA, 0x0000, 0x0000, 0xE108, 0xE106, 0xE165,
+    0xE945, 0x90C4, 0x0000, 0xEA85, 0xF265, 0xF485, 0xFC65, 0xF485,
+    0xFC65, 0xFE65, 0xFE65, 0xF725, 0xFE65, 0xF725, 0xD686, 0x0000,
+    0xCD65, 0xD686, 0xA6C7, 0xA2A3, 0x0000, 0x0000, 0x2042, 0x2D49,
+    0x04EA, 0x2D69, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x152A, 0x04EA, 0x04EA, 0x04EA, 0x6AA3, 0x0000,
+    0x34C8, 0x55A8, 0x0000, 0x0000, 0x0000, 0x0000, 0x9CE5, 0x6E28,
+    0x8667, 0xA6A7, 0xAEC7, 0xCF26, 0xD666, 0xCD65, 0x1842, 0xCB84,
+    0xFD85, 0xFE65, 0xFC65, 0xFC85, 0xEA65, 0x5084, 0xF285, 0xF265,
+    0xE9C5, 0xE1A6, 0x0000, 0x0000, 0xE106, 0xE926, 0xE0C8, 0xE0A8,
+    0xC8AE, 0x0000, 0x0000, 0x0000, 0xC88E, 0xE8AE, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE0AE,
+    0xC8AE, 0x0000, 0x0000, 0x0000, 0xC88E, 0xE8AE, 0xE0AC, 0xE0AC,
+    0xE8AA, 0xE0AC, 0x0000, 0x0000, 0xC8AE, 0xE0A8, 0xE8C8, 0xE108,
+    0xC88A, 0xE165, 0xE145, 0xE9C5, 0xE9C5, 0xEA85, 0xF285, 0xEA65,
+    0xF285, 0xF465, 0xFC85, 0xFE65, 0xF665, 0xF725, 0xF725, 0xCB84,
+    0x0000, 0x0000, 0x0000, 0x9AA3, 0x9CE5, 0xA2A3, 0x0000, 0x9CE5,
+    0x0D2A, 0x152A, 0x3CC8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x4DA8, 0x04EA, 0x04EA, 0x04EA, 0x55A8,
+    0x3222, 0x2D49, 0x0000, 0x0000, 0x0000, 0x0000, 0x9CE5, 0x6E28,
+    0x8667, 0xA6C7, 0xCD65, 0xCF26, 0xD726, 0xF725, 0xF725, 0xFE85,
+    0x0000, 0x0000, 0x5064, 0xFD85, 0xFC85, 0xCA64, 0x0000, 0x0000,
+    0xC165, 0xE9C5, 0xE165, 0xE145, 0xE108, 0xE108, 0xE8E7, 0xE0C8,
+    0xE8AA, 0xE108, 0x986B, 0x0000, 0x0000, 0x5884, 0xE0AE, 0xA08B,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x78D1,
+    0xC8B1, 0x0000, 0x0000, 0x0000, 0x588B, 0xE0B0, 0xE0AE, 0xE8AE,
+    0xE0AC, 0xE8AE, 0x5084, 0xE0AC, 0xE8AA, 0xE0AA, 0xE0C8, 0xE108,
+    0x0000, 0x0000, 0xE108, 0xE145, 0xE965, 0x986B, 0x0000, 0x0000,
+    0xEA65, 0xFC85, 0xF465, 0xFD85, 0xFD65, 0xFD65, 0xFE85, 0xF725,
+    0xFF25, 0x0000, 0x0000, 0x0000, 0x0000, 0xCC64, 0x8667, 0x0000,
+    0x6E28, 0x55A8, 0x0D0A, 0x6CA6, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x6AA3, 0x04EA, 0x04EA, 0x04EA,
+    0x152A, 0x4DA8, 0x6CA6, 0x0000, 0x0000, 0x0000, 0x0000, 0x6E28,
+    0x6E08, 0xA6C7, 0xCD65, 0xD686, 0x0000, 0xCB64, 0xF725, 0xFF25,
+    0xFE85, 0xFE65, 0x90C4, 0x0000, 0xD127, 0xFC65, 0xEA85, 0xF265,
+    0x1842, 0x0000, 0x0000, 0xE945, 0xE106, 0xE0E7, 0xE0C8, 0xE8C8,
+    0xE0A8, 0xE0AA, 0xE0AC, 0xE8AC, 0x0000, 0x0000, 0x0000, 0xC8B1,
+    0xC8AE, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0xC8B1, 0xC8B1, 0x0000, 0x0000, 0x0000, 0xE0B0, 0xE8AE, 0xC8B1,
+    0xE0AE, 0xE8AE, 0xE0AC, 0xE0AE, 0xE0AC, 0xE8AC, 0xE0AA, 0x5084,
+    0x0000, 0x1842, 0xE8A8, 0xE8E7, 0xE106, 0xD127, 0x0000, 0x90E4,
+    0xE9C5, 0xF285, 0xF285, 0xF365, 0xCA64, 0xF265, 0xF485, 0xFD65,
+    0xFE85, 0xF725, 0xFD65, 0x0000, 0x0000, 0x0000, 0x0000, 0xCD65,
+    0x9CE5, 0x6628, 0x2D49, 0x2D69, 0x3A22, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x04EA, 0x04EA,
+    0x04EA, 0x04EA, 0x150A, 0x3222, 0x0000, 0x0000, 0x0000, 0x62A3,
+    0x6E28, 0x8667, 0xA6A7, 0xCE86, 0x62A3, 0x0000, 0x0000, 0xCB84,
+    0xFE65, 0xFE65, 0xFD85, 0xFD85, 0xCA64, 0x9AA3, 0xF365, 0xEA65,
+    0xF285, 0xEA85, 0xE945, 0xA08B, 0x1842, 0xE106, 0xE8C8, 0x986B,
+    0x1842, 0xE8AC, 0xE0AA, 0xE0AC, 0xE8AC, 0xC8B1, 0x0000, 0x0000,
+    0x608B, 0xE8B0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x1842, 0xC8B1, 0x588B, 0x0000, 0x0000, 0xC8B1, 0xE0B0, 0xE0B0,
+    0xE0B0, 0xE0B0, 0xE8AE, 0xA8D1, 0xC88E, 0xE8AE, 0xE8AC, 0x0000,
+    0x1842, 0xE0AC, 0xE0AA, 0xE0C8, 0xE8C8, 0xE106, 0x0000, 0xC0C6,
+    0xE145, 0xEA65, 0xF285, 0xFB65, 0x90C4, 0x0000, 0x0000, 0xF365,
+    0xFD65, 0xFE65, 0xFE65, 0xF725, 0x0000, 0x0000, 0x0000, 0x0000,
+    0xA4E5, 0x8667, 0x6E28, 0x4DA8, 0x2D69, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x152A,
+    0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x2042, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x8667, 0x8667, 0xAEC7, 0xA6A7, 0xD686, 0x90C4, 0x0000,
+    0x0000, 0xCB84, 0xFD65, 0xFD85, 0xFC65, 0xF485, 0xF365, 0xFB65,
+    0xEA65, 0xE1A6, 0xE965, 0xE145, 0xE106, 0xE108, 0xE0C8, 0xE8C8,
+    0xE0AA, 0x0000, 0x0000, 0x986B, 0xE8AC, 0xE0AE, 0xE0AE, 0x0000,
+    0x0000, 0x0000, 0xC8B1, 0xA8D1, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0xB0B1, 0xA8D1, 0x0000, 0x0000, 0x0000, 0xD0B1, 0xE0B0,
+    0xC8B1, 0xE0B0, 0x986B, 0x0000, 0x1842, 0xE8B0, 0xE8AE, 0xE0AE,
+    0xE0AE, 0xE8AC, 0xE0AA, 0xE0AA, 0xE0AA, 0xE8C8, 0xE0A8, 0xE108,
+    0xE106, 0xE165, 0xE965, 0xE9C5, 0x5084, 0x0000, 0x0000, 0x5884,
+    0xFB65, 0xFD85, 0xF565, 0xFE85, 0xFE65, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x9CE5, 0x8667, 0x6608, 0x4DA8, 0x4DA8, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x150A, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x8667, 0xA6A7, 0xA6C7, 0xCF26, 0xF725, 0xF725,
+    0xFF25, 0xCE86, 0xCB84, 0xF565, 0xFD85, 0xFD65, 0xF365, 0xF365,
+    0xF285, 0xEA85, 0xE9C5, 0xE965, 0xE106, 0xE106, 0xE0E7, 0xE8C8,
+    0xE0A8, 0xE108, 0xE8AC, 0x0000, 0x0000, 0x988B, 0xE0AE, 0xE0B0,
+    0xD0B1, 0x0000, 0x0000, 0x88D1, 0xD0B1, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0xA8D1, 0x78D1, 0x0000, 0x0000, 0xB0D1, 0xC8B1,
+    0xC8B1, 0xC8B1, 0x0000, 0x0000, 0x0000, 0xE0B0, 0xE0B0, 0xE0B0,
+    0xE0AE, 0xE0AE, 0xE8AE, 0xE0AC, 0xE0AC, 0xE108, 0xE0AA, 0xE8A8,
+    0xE0C8, 0xE126, 0xE106, 0xE945, 0xE145, 0x0000, 0xD127, 0xF365,
+    0xF365, 0xFD85, 0xFD65, 0xFE65, 0xFE65, 0xCB84, 0x0000, 0x0000,
+    0x0000, 0x0000, 0xCC64, 0xAEC7, 0x8667, 0x6E08, 0x6E28, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x2D69, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x8667, 0xAEC7, 0xD726, 0xCF26, 0xF725,
+    0xF725, 0xFF25, 0xFE65, 0xFE65, 0xF565, 0xFC65, 0xF365, 0xF365,
+    0xF285, 0xEA65, 0xE1A6, 0xE965, 0xE106, 0xE106, 0xE0C8, 0xE8C8,
+    0xE0A8, 0xE0AA, 0xE0AA, 0xE8AC, 0x988B, 0x0000, 0x0000, 0xE0B0,
+    0xE0B0, 0xE0B0, 0x588B, 0x0000, 0x0000, 0xB0B1, 0x588B, 0x0000,
+    0x0000, 0x0000, 0x78F1, 0x90D1, 0x0000, 0x0000, 0x608B, 0xB0D1,
+    0xA8B1, 0xB0D1, 0x88D1, 0x0000, 0x0000, 0xB0D1, 0xC8B1, 0xE0B0,
+    0xE0B0, 0xE0B0, 0xE8AE, 0xE0AE, 0xE0AC, 0xE8AC, 0xE0AA, 0xE0AA,
+    0xE0A8, 0xE8C8, 0xE0A8, 0xE106, 0xE126, 0xE965, 0xE1A6, 0xF285,
+    0xEA85, 0xF365, 0xF365, 0xFC65, 0xFD85, 0xFE65, 0xF465, 0x0000,
+    0x0000, 0x0000, 0x0000, 0xCE86, 0xA6C7, 0x8667, 0x6E08, 0x9CE5,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x6CA6, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x4DA8,
+    0x0000, 0x0000, 0x0000, 0xCD65, 0x8667, 0xCE86, 0x0000, 0xCD65,
+    0xFE65, 0xF725, 0xFE65, 0xF665, 0xFD85, 0xFD65, 0xF485, 0xFC65,
+    0xEA85, 0xF285, 0xE9C5, 0xE9C5, 0xE108, 0xE106, 0xE0E7, 0xE0AA,
+    0xE8C8, 0xE0AC, 0xE0AA, 0xE0AC, 0xE8AC, 0xE8AE, 0x1842, 0x0000,
+    0xE0B0, 0xD0B1, 0x988B, 0xC8B1, 0x0000, 0x0000, 0x90D1, 0xA8D1,
+    0x0000, 0x0000, 0x0000, 0x90D1, 0x6111, 0x0000, 0x0000, 0x90F1,
+    0x90D1, 0x0000, 0xA8B1, 0xB0D1, 0x0000, 0x90D1, 0xC8B1, 0xC8B1,
+    0xC8B1, 0xE0B0, 0xE0B0, 0xE0B0, 0xE0AE, 0xE0B0, 0xE0AE, 0xE8AC,
+    0xE0AA, 0xE0AC, 0xE0C8, 0xE8E7, 0xE0E7, 0xE106, 0xE145, 0xE9C5,
+    0xE9C5, 0xEA85, 0xFB65, 0xF365, 0xCA64, 0xCB84, 0xFD65, 0xFE85,
+    0x5864, 0x0000, 0x0000, 0x0000, 0xCE66, 0xD746, 0x8667, 0x8667,
+    0x9AA3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x3242, 0x04EA, 0x04EA, 0x04EA, 0x04EA,
+    0x150A, 0x6E28, 0x0000, 0x0000, 0x8667, 0xAEC7, 0x9AA3, 0x0000,
+    0x0000, 0x0000, 0xFD65, 0xFE85, 0xFD65, 0xFC65, 0xF365, 0xF365,
+    0xF285, 0xE1A6, 0x986B, 0x5084, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0xA08B, 0xE8AC, 0xE0AC, 0xE0AE, 0xE0AE, 0xE0B0,
+    0xA8B1, 0xE8B0, 0x0000, 0x0000, 0xA8D1, 0x78D1, 0x0000, 0x0000,
+    0x78F1, 0x588B, 0x0000, 0x608B, 0x6111, 0x0000, 0x0000, 0x4931,
+    0x78F1, 0x78D1, 0x0000, 0x78F1, 0x90D1, 0x608B, 0xB0D1, 0xA8B1,
+    0xB0D1, 0xC8B1, 0xC8B1, 0x90D1, 0x1842, 0x0000, 0x0000, 0x0000,
+    0x2042, 0xD0AE, 0xC88A, 0xE0AC, 0xE8AA, 0xE0C8, 0xE0E7, 0xE106,
+    0xE965, 0xE9C5, 0xE9C5, 0xE1A6, 0x0000, 0x0000, 0x0000, 0xF485,
+    0xFD85, 0xCA64, 0x0000, 0x0000, 0xFD65, 0xCF46, 0xA6A7, 0xA6C7,
+    0x8667, 0x1822, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x152A, 0x04EA, 0x04EA,
+    0x04EA, 0x2D49, 0x2D49, 0x4DA8, 0x6E28, 0xA6A7, 0xA6C7, 0xCF26,
+    0xCF26, 0xF725, 0xFF25, 0xF725, 0xFE65, 0xFE85, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1842, 0xC8B1, 0xE0B0,
+    0xE0B0, 0xE8B0, 0xD0B1, 0x1842, 0x0000, 0xC8B1, 0xB0B1, 0x0000,
+    0x0000, 0x78F1, 0x6111, 0x0000, 0x4931, 0x6911, 0x0000, 0x0000,
+    0x6111, 0x78F1, 0x2991, 0x0000, 0x4951, 0x90D1, 0x90D1, 0xA8D1,
+    0xB0B1, 0xB0D1, 0x608B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x1842, 0x1842, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0xD127, 0xE145, 0xF265, 0xF285, 0xF365, 0xF365, 0xF465,
+    0xFD65, 0xFE85, 0xFD65, 0xFD65, 0xF725, 0xF725, 0xD726, 0xCF26,
+    0xAEC7, 0xA6C7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x150A, 0x04EA,
+    0x04EA, 0x152A, 0x150A, 0x55A8, 0x55A8, 0x8667, 0x8667, 0xA6C7,
+    0xD726, 0xF725, 0xFF25, 0xF725, 0xFE65, 0xFE65, 0xFD65, 0xF485,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x1842, 0xE090, 0xC8B1, 0xD0B1, 0xA8D1, 0x0000, 0x608B, 0x90D1,
+    0x588B, 0x0000, 0x1842, 0x6911, 0x4931, 0x6111, 0x2042, 0x0000,
+    0x190B, 0x6911, 0x4951, 0x0000, 0x1842, 0x6911, 0x6111, 0x78F1,
+    0x78D1, 0x608B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0xE908, 0xE165, 0xE9C5, 0xF285, 0xEA65, 0xF365,
+    0xFC85, 0xFD65, 0xFD85, 0xF665, 0xFE65, 0xF725, 0xF725, 0xF725,
+    0xD726, 0xA6C7, 0x9CE5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4DA8,
+    0x04EA, 0x04EA, 0x152A, 0x2D49, 0x2D49, 0x6E28, 0x8667, 0xA6A7,
+    0xA6C7, 0xF725, 0xFE65, 0xF725, 0xF725, 0xFE65, 0xF485, 0xFD65,
+    0xFC85, 0x9AC3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0xB0B1, 0xB0D1, 0xB0D1, 0x90D1, 0x0000,
+    0x78D1, 0x78F1, 0x0000, 0x4951, 0x4931, 0x4951, 0x4931, 0x3191,
+    0x0000, 0x4951, 0x4931, 0x3191, 0x0000, 0x4951, 0x4931, 0x6111,
+    0x4951, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0xE0AA, 0xE906, 0xE106, 0xE1A6, 0xE9C5, 0xEA85,
+    0xF365, 0xFC65, 0xF485, 0xFD65, 0xFD65, 0xFF25, 0xF725, 0xF725,
+    0xCF26, 0xD726, 0xA6C7, 0xCC64, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x3A22, 0x04EA, 0x04EA, 0x152A, 0x2D49, 0x55A8, 0x6E28, 0x8667,
+    0xA6C7, 0xD726, 0xCD65, 0x0000, 0xCB84, 0xF725, 0xFE65, 0xFD65,
+    0xFC85, 0xF465, 0xF365, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x90D1, 0x88D1, 0x90F1,
+    0x78F1, 0x608B, 0x6111, 0x190B, 0x3191, 0x4931, 0x3191, 0x3191,
+    0x3191, 0x1842, 0x3191, 0x3191, 0x0000, 0x3191, 0x2991, 0x4931,
+    0x3191, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x2042, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0xA08B, 0xE0E7, 0xE8E7, 0xE165, 0xE106, 0xE9C5,
+    0xF285, 0xC165, 0x5084, 0xFC85, 0xFC85, 0xFE65, 0xF665, 0xF725,
+    0xF725, 0xFF25, 0xCF26, 0xCF26, 0x1842, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x150A, 0x152A, 0x150A, 0x55A8, 0x4DA8, 0x6608,
+    0x8667, 0xCF26, 0xCF46, 0xF725, 0xFD65, 0xF725, 0xFE65, 0xFE65,
+    0xFD85, 0xFD65, 0xF365, 0xF285, 0xF285, 0x5884, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x90D1,
+    0x78F1, 0x78F1, 0x4931, 0x5151, 0x4931, 0x190B, 0x3191, 0x3191,
+    0x3191, 0x190B, 0x21F2, 0x2212, 0x210B, 0x2212, 0x2991, 0x3191,
+    0x3191, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1842, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x988B, 0xE0AA, 0xE8AA, 0xE108, 0xE106, 0xE145,
+    0xE9C5, 0xEA85, 0xE1A6, 0xF265, 0xF485, 0xFD65, 0xFD65, 0xFE65,
+    0xFE65, 0xF725, 0xF725, 0xFF25, 0xD686, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x6CA6, 0x04EA, 0x2D69, 0x2D49, 0x4DA8,
+    0x6E28, 0xD464, 0xA6C7, 0xCF26, 0xD726, 0xF725, 0xFE65, 0xFE65,
+    0xFD65, 0xF585, 0xFC65, 0xF365, 0xF285, 0xEA65, 0xE1A6, 0xC185,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x588B, 0x90D1,
+    0x78F1, 0x78D1, 0x4931, 0x4951, 0x3191, 0x4931, 0x2042, 0x3191,
+    0x2991, 0x2212, 0x2042, 0x2212, 0x2212, 0x1A53, 0x21F2, 0x2212,
+    0x3191, 0x2212, 0x2991, 0x210B, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0xB0B1, 0xE8AA, 0xE0A8, 0xC8AE, 0xE0A8, 0xE906,
+    0xE126, 0xE9C5, 0xE9C5, 0xEA85, 0xF365, 0xFC85, 0xF465, 0xFD85,
+    0xF365, 0xF725, 0xFE65, 0xF725, 0xCF26, 0xCD65, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x150A, 0x2D69, 0x4DA8,
+    0x4DA8, 0xD565, 0xCB84, 0xCD65, 0xCE86, 0xF725, 0xF725, 0xF725,
+    0xFE65, 0xFE65, 0xFD85, 0xF465, 0xFB65, 0xFB65, 0xF285, 0x1842,
+    0xE108, 0xE108, 0x988B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x608B, 0xA8B1, 0xD0B1, 0xA8D1, 0xB0D1,
+    0x90D1, 0x90F1, 0x6111, 0x210B, 0x3191, 0x4931, 0x3191, 0x21F2,
+    0x2212, 0x1A53, 0x1A53, 0x12B4, 0x1A53, 0x1AB4, 0x12B4, 0x190B,
+    0x1A53, 0x1A53, 0x2212, 0x2212, 0x3191, 0x4931, 0x3191, 0x210B,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x1842, 0xC8B1, 0xE0AE, 0xC88E, 0xE0AC, 0xE8C8, 0xE0E7,
+    0xE0E7, 0xE145, 0xE145, 0xF285, 0xF265, 0xF365, 0xF365, 0xFC85,
+    0xFC65, 0x62A3, 0xFD85, 0xF725, 0xF725, 0xFF25, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6CA6, 0x2D69,
+    0x2D49, 0x6E28, 0x8667, 0x9CE5, 0x0000, 0xFC65, 0xD746, 0xF725,
+    0xFE65, 0xFE65, 0xFD65, 0xF465, 0x1842, 0xFC85, 0xF265, 0xE1A6,
+    0x0000, 0x5084, 0xE908, 0xE0E7, 0xE8C8, 0xE0AA, 0xE0AA, 0xE0AC,
+    0xE8AE, 0xE0AE, 0xC8B1, 0xE0B0, 0xC8B1, 0xC8B1, 0xB0B1, 0x88D1,
+    0x0000, 0x6111, 0x6111, 0x6911, 0x2991, 0x4951, 0x3191, 0x2212,
+    0x2212, 0x1A53, 0x1A53, 0x12B4, 0x1AB4, 0x1356, 0x12B4, 0x1356,
+    0x12B4, 0x1356, 0x1A53, 0x1A53, 0x09EE, 0x09EE, 0x3191, 0x5131,
+    0x4951, 0x6911, 0x4931, 0x6111, 0x190B, 0x608B, 0x608B, 0xB0D1,
+    0xB0D1, 0xE0B0, 0xE8AE, 0xE0AE, 0x0000, 0x0000, 0xE0AA, 0xE0AA,
+    0xE8A8, 0xC88A, 0xE108, 0xE165, 0xE9C5, 0xEA85, 0xF285, 0xF365,
+    0x0000, 0xCA64, 0xCB84, 0xFD65, 0xFE85, 0xF725, 0xCC64, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x55A8, 0x4DA8, 0x6628, 0x8667, 0xA6C7, 0xCD65, 0xCF26, 0xF725,
+    0xFE65, 0xCB84, 0xFE65, 0xFE85, 0x90E4, 0x0000, 0xE1A6, 0xF365,
+    0xE9C5, 0xE9C5, 0xE965, 0xE106, 0xE0C8, 0xE108, 0xE0AA, 0xE8AC,
+    0xE0AC, 0xE8AE, 0xC8B1, 0x88D1, 0xE8B0, 0xD0B1, 0x0000, 0x0000,
+    0x0000, 0x190B, 0x78F1, 0x6911, 0x4931, 0x4931, 0x3191, 0x3191,
+    0x0000, 0x12B4, 0x1AB4, 0x1356, 0x0B56, 0x1356, 0x1356, 0x0000,
+    0x1356, 0x0B56, 0x1356, 0x1356, 0x12B4, 0x1AD4, 0x0000, 0x0000,
+    0x0000, 0x4931, 0x4951, 0x6111, 0x4931, 0x90D1, 0xA8D1, 0xC8B1,
+    0xC8B1, 0xE0B0, 0xE0B0, 0xE0B0, 0xE0AE, 0xE8AE, 0xC88E, 0xE0AC,
+    0xE8C8, 0x588B, 0x0000, 0xC0C6, 0xE145, 0xE9C5, 0xD127, 0xFB65,
+    0xF365, 0xFC85, 0x986B, 0xF565, 0xFE65, 0xF725, 0xFE65, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x6CA6, 0x6E08, 0x8667, 0xA6C7, 0xA6A7, 0xD726,
+    0xCE86, 0xCB64, 0xFD85, 0xFE65, 0xFC65, 0x0000, 0x0000, 0x5084,
+    0xF285, 0xF265, 0xE145, 0xE165, 0x5084, 0x0000, 0xE8A8, 0xE8AA,
+    0xC8AE, 0xE0AC, 0xE0AC, 0xE0B0, 0xA8B1, 0xD0B1, 0x0000, 0x0000,
+    0x0000, 0x88D1, 0x78F1, 0x78F1, 0x4931, 0x4931, 0x3191, 0x3191,
+    0x0000, 0x1842, 0x1A73, 0x1AB4, 0x0B56, 0x1356, 0x1356, 0x0BD8,
+    0x0000, 0x0000, 0x1356, 0x0B56, 0x1356, 0x1AB4, 0x1A53, 0x1A53,
+    0x190B, 0x0000, 0x0000, 0x5131, 0x4951, 0x4931, 0x78F1, 0xB0D1,
+    0xB0B1, 0x0000, 0xC8B1, 0xD0B1, 0x0000, 0xE0B0, 0xE0AC, 0xE8AC,
+    0xE0AA, 0xE0AA, 0x0000, 0x0000, 0x0000, 0xE165, 0xE945, 0xE1A6,
+    0xE1C6, 0xF365, 0xFB65, 0xFD85, 0xF585, 0xFE65, 0xCB84, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x64A6, 0xCD65, 0xD726,
+    0xCE66, 0xF685, 0xFD65, 0xF725, 0xFE85, 0xFB65, 0x98C4, 0x5884,
+    0x588B, 0xF385, 0xE9C5, 0xE1A6, 0x0000, 0x0000, 0xC88A, 0xE0C8,
+    0xE8AA, 0x0000, 0xE0AC, 0xE0AE, 0xE8AE, 0xE0B0, 0x608B, 0x0000,
+    0x1842, 0xB0D1, 0x90D1, 0x210B, 0x190B, 0x6911, 0x4951, 0x5131,
+    0x0000, 0x0000, 0x09EE, 0x12B4, 0x1AB4, 0x0BF8, 0x0BD8, 0x0479,
+    0x0C79, 0x0000, 0x0000, 0x0B33, 0x0BF8, 0x0BD8, 0x0B56, 0x0000,
+    0x1A53, 0x2212, 0x2212, 0x0000, 0x0000, 0x6111, 0x6111, 0x90D1,
+    0x88F1, 0x90D1, 0x0000, 0xC8B1, 0xE8B0, 0x0000, 0x0000, 0x5084,
+    0xE0AC, 0xE0AC, 0xE0AA, 0x0000, 0x0000, 0x0000, 0xE0E8, 0xE9C5,
+    0xE9C5, 0xEA85, 0xF265, 0xF485, 0xFC65, 0xCA64, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x1842, 0xA2A3, 0xCB84, 0xFC85, 0xFC85, 0xF365, 0xFC65,
+    0xF365, 0xF365, 0xF285, 0xE9C5, 0x586B, 0xD127, 0x0000, 0xE0AA,
+    0xE8C8, 0xE0AC, 0x0000, 0xC88E, 0xE0AE, 0xE0B0, 0xE0B0, 0xC8B1,
+    0x1842, 0xD0B1, 0x90D1, 0x0000, 0x0000, 0x4951, 0x4931, 0x4951,
+    0x1842, 0x0000, 0x0000, 0x1A53, 0x1AB4, 0x1356, 0x0B56, 0x0BF8,
+    0x0C79, 0x0479, 0x0000, 0x0000, 0x0000, 0x0C79, 0x1356, 0x0B56,
+    0x09EE, 0x0000, 0x210B, 0x2212, 0x3191, 0x2042, 0x4931, 0x6111,
+    0x78F1, 0x90D1, 0x0000, 0x0000, 0xD0B1, 0xE0B0, 0xA8D1, 0xD0B1,
+    0x986B, 0xE8AE, 0xE0AA, 0xE0AA, 0xC8AE, 0xE8AC, 0xE0AA, 0xE108,
+    0xD127, 0xE1A6, 0x90E4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x1842, 0x5884, 0x0000, 0x1842, 0xE1A6, 0xD127, 0xE108,
+    0xE8C8, 0xE0AA, 0xE0AA, 0xE8AC, 0x988B, 0xE0AE, 0xE0B0, 0xE0B0,
+    0xE0B0, 0xE8B0, 0x90D1, 0x0000, 0x0000, 0x0000, 0x6111, 0x6911,
+    0x3191, 0x0000, 0x0000, 0x0000, 0x1A53, 0x0B56, 0x1356, 0x0BD8,
+    0x0C79, 0x0479, 0x0C79, 0x0000, 0x0000, 0x0000, 0x0000, 0x0BF8,
+    0x0B56, 0x1356, 0x0000, 0x0000, 0x0000, 0x3191, 0x4951, 0x6111,
+    0x6111, 0x90D1, 0x6111, 0x78D1, 0xA8D1, 0xE0B0, 0xE0B0, 0xE0B0,
+    0xC88E, 0xE8B0, 0x2042, 0x0000, 0x0000, 0x608B, 0x1842, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x608B, 0xF285, 0xE945, 0xE106,
+    0xE8E7, 0xE0E7, 0xE0C8, 0xE0AA, 0xE8AA, 0xE0AE, 0xE0AE, 0xE0B0,
+    0xE0B0, 0xE0B0, 0xC8B1, 0xA8D1, 0x0000, 0x0000, 0x6111, 0x6111,
+    0x4931, 0x0000, 0x0000, 0x0000, 0x0000, 0x1A53, 0x1AB4, 0x0B56,
+    0x0BF8, 0x0C79, 0x0479, 0x0C79, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0B33, 0x0B56, 0x1AB4, 0x210B, 0x0000, 0x09EE, 0x3191, 0x4931,
+    0x4951, 0x6911, 0x78F1, 0x90D1, 0xA8D1, 0xD0B1, 0xC8B1, 0xE0B0,
+    0xE0B0, 0xE0B0, 0xE8AE, 0xE0AE, 0x5084, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0xF285, 0xF365, 0xE9C5, 0xE9C5,
+    0xE126, 0xE106, 0xE8E7, 0xE0A8, 0xC8AE, 0xE0AC, 0xE8AC, 0xE0AE,
+    0xE0AE, 0xE0B0, 0xE8B0, 0xC8B1, 0xA8B1, 0xB0D1, 0x6911, 0x78F1,
+    0x6111, 0x5131, 0x0000, 0x0000, 0x0000, 0x0000, 0x1A53, 0x0B56,
+    0x1356, 0x0BD8, 0x0C79, 0x0479, 0x0C79, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0B56, 0x1356, 0x12B4, 0x1A53, 0x3191, 0x3191,
+    0x2991, 0x6111, 0x6111, 0x78F1, 0x90D1, 0xB0D1, 0xA8B1, 0xC8B1,
+    0xE0B0, 0xE0B0, 0xE0AE, 0xE0AE, 0xE8AC, 0xE0AC, 0xE8AC, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0xCA64, 0xF365, 0xF365, 0xF285, 0xEA65,
+    0xE145, 0xE165, 0xE8E7, 0xE0E7, 0xE0AA, 0x0000, 0xE0AA, 0xE8AE,
+    0xE0AE, 0xE0B0, 0xC8B1, 0xE0B0, 0xC8B1, 0xC8B1, 0xB0B1, 0x88D1,
+    0x78F1, 0x6111, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1A53,
+    0x12B4, 0x1356, 0x1356, 0x0BF8, 0x0479, 0x0C79, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x09EE, 0x12B4, 0x1AB4, 0x2212, 0x2212,
+    0x3191, 0x4931, 0x4931, 0x6911, 0x78F1, 0x90D1, 0xB0D1, 0x1842,
+    0xB0B1, 0xE0B0, 0xE0B0, 0xE0B0, 0xE8AE, 0xE0AE, 0xE0AA, 0xE0AA,
+    0xE8C8, 0xC88A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0xFD85, 0xF465, 0xFC85, 0xF365, 0xF365,
+    0xE9C5, 0xE9C5, 0xE165, 0xE906, 0xE0AA, 0xE108, 0xE0AA, 0xE8AC,
+    0xC8AE, 0xE0AE, 0xE8AE, 0x1842, 0xC8B1, 0xE8B0, 0xC8B1, 0xB0D1,
+    0x90D1, 0x90D1, 0x608B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x1A53, 0x12B4, 0x1356, 0x0BF8, 0x0BD8, 0x0479, 0x0C79, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0B56, 0x1A53, 0x2212,
+    0x3191, 0x4951, 0x4931, 0x0000, 0x6111, 0x90F1, 0x90D1, 0xA8B1,
+    0xB0D1, 0xC8B1, 0xC8B1, 0xE0B0, 0xE0AE, 0xE0AE, 0xE0AC, 0xE8AC,
+    0xE0AA, 0xE0AA, 0xE0E7, 0xE108, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0xC165, 0xFE85, 0xFD65, 0xF565, 0xF365, 0xFB65,
+    0xEA85, 0xF265, 0xE145, 0xE108, 0xE106, 0xE0E7, 0xE8C8, 0xE0AC,
+    0xE0AA, 0xC8AE, 0xE8AC, 0xE0AE, 0x0000, 0xC8B1, 0xC8B1, 0xC8B1,
+    0xB0B1, 0xA8D1, 0x78D1, 0x78F1, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x1A53, 0x1A53, 0x12B4, 0x0B56, 0x1356, 0x1356, 0x0BD8,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0B33, 0x1A53, 0x2212,
+    0x3191, 0x3191, 0x2991, 0x4931, 0x0000, 0x6911, 0x78F1, 0x90D1,
+    0xB0D1, 0xC8B1, 0xC8B1, 0xC8B1, 0xE8AE, 0xE0B0, 0xC8B1, 0xE8AC,
+    0xE0AA, 0xE0AA, 0xE0A8, 0xE8E7, 0xE106, 0xE165, 0x5084, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0xCD65, 0xF725, 0xFE65, 0xFE65, 0xFD85, 0xF485,
+    0xFB65, 0xF365, 0xF285, 0xE1A6, 0xE108, 0xE106, 0xE0E7, 0xE0C8,
+    0xE8AA, 0xE0AC, 0xA8D1, 0xE8AE, 0xE0AE, 0xE0B0, 0xE0B0, 0xE0B0,
+    0xD0B1, 0xC8B1, 0x6111, 0x90D1, 0x78D1, 0x6911, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x2212, 0x1A53, 0x1A53, 0x1356, 0x1356, 0x0B56,
+    0x1356, 0x0000, 0x0000, 0x0000, 0x0000, 0x09EE, 0x12B4, 0x1A53,
+    0x2212, 0x2212, 0x3191, 0x4931, 0x4931, 0x6111, 0x78F1, 0x90F1,
+    0x90D1, 0xA8B1, 0xB0D1, 0xE0B0, 0xC8B1, 0xE0B0, 0xE0AE, 0xE0AE,
+    0xE8AC, 0xC88E, 0xE0AA, 0xE0C8, 0xE0E7, 0xE906, 0xE165, 0xE9C5,
+    0xD927, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0xCE86, 0xF725, 0xFE65, 0xFE65, 0xFD65, 0xFD85,
+    0xF465, 0xFC85, 0xEA65, 0xF285, 0x90C4, 0x90C4, 0xE906, 0xE108,
+    0x0000, 0xE0AA, 0xE0AA, 0xE8AC, 0xE0AC, 0xE0AE, 0xE0AE, 0xE0B0,
+    0xC8B1, 0xC8B1, 0x0000, 0x0000, 0x6111, 0x90F1, 0x6111, 0x190B,
+    0x0000, 0x0000, 0x0000, 0x2212, 0x2212, 0x1A53, 0x1A53, 0x1AB4,
+    0x12B4, 0x1356, 0x0000, 0x0000, 0x0000, 0x0000, 0x1A53, 0x1A53,
+    0x21F2, 0x0000, 0x0000, 0x3191, 0x4931, 0x6911, 0x6111, 0x90F1,
+    0x90D1, 0xB0D1, 0xA8D1, 0xC8B1, 0xB0B1, 0x0000, 0xE8AE, 0xE0AE,
+    0x0000, 0xE0AE, 0xE0AA, 0xE8AA, 0xE0C8, 0xE108, 0xE106, 0xE165,
+    0xE9C5, 0xF285, 0xEA65, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0xD726, 0xF725, 0xF725, 0xF725, 0xFE65, 0xF665,
+    0xFD85, 0xFD65, 0xF365, 0xF365, 0xF285, 0xF285, 0xE145, 0xE165,
+    0xE0E7, 0xE108, 0xE8AA, 0xE0AA, 0xE0AC, 0xE0AE, 0xE8AE, 0xE0B0,
+    0xE0B0, 0xE0B0, 0xD0B1, 0x78D1, 0x0000, 0x0000, 0x78F1, 0x78D1,
+    0x6111, 0x0000, 0x0000, 0x0000, 0x3191, 0x2212, 0x21F2, 0x1A53,
+    0x1A53, 0x1AB4, 0x12B4, 0x0000, 0x0000, 0x0000, 0x1A53, 0x1A53,
+    0x2212, 0x0000, 0x0000, 0x0000, 0x3191, 0x6111, 0x6111, 0x78F1,
+    0x88D1, 0xB0D1, 0xA8D1, 0xD0B1, 0xC8B1, 0x90D1, 0xC8B1, 0xE0B0,
+    0xC88E, 0xC8AE, 0xE0AC, 0xE0AA, 0xE8A8, 0xE108, 0xE0E7, 0xE165,
+    0xE145, 0xF265, 0xEA85, 0xFB65, 0xF365, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0xA6C7, 0xCF26, 0xCF26, 0xFF25, 0xFE65, 0xFE65,
+    0xF565, 0xFD65, 0xF365, 0xFC85, 0xF365, 0xF265, 0xE9C5, 0xE1C5,
+    0xE106, 0xE106, 0xE8C8, 0xE0C8, 0xE0A8, 0xE0AC, 0xE8AC, 0xE0AE,
+    0xE0AE, 0xE0B0, 0xE0B0, 0xE0B0, 0xC8B1, 0x0000, 0x0000, 0x0000,
+    0x78F1, 0x78D1, 0x1842, 0x0000, 0x3191, 0x3191, 0x2991, 0x3191,
+    0x3191, 0x2212, 0x2212, 0x1A53, 0x1A53, 0x0000, 0x0000, 0x21F2,
+    0x3191, 0x2991, 0x0000, 0x0000, 0x3191, 0x6111, 0x4931, 0x78F1,
+    0x78F1, 0x90D1, 0x90D1, 0xD0B1, 0xC8B1, 0xE0B0, 0xE0B0, 0xE0B0,
+    0xE8AE, 0xE0AE, 0xE0AC, 0xE8AA, 0xE0C8, 0xE0C8, 0xE0A8, 0xE906,
+    0xE126, 0xE9C5, 0xE9C5, 0xEA85, 0xF365, 0xFC85, 0xF365, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0xCD65, 0xA6C7, 0xCF26, 0xF725, 0xF725, 0xF725,
+    0xFE65, 0xFE65, 0xF365, 0x0000, 0xF365, 0xFC85, 0xEA85, 0xF285,
+    0xE1A6, 0xE945, 0xE108, 0xE108, 0xE0C8, 0xE0AA, 0xE0AA, 0xE8AC,
+    0xE0AC, 0x0000, 0xC88E, 0xE8B0, 0xC8B1, 0xE0B0, 0xB0D1, 0x0000,
+    0x0000, 0x78D1, 0x78F1, 0x6111, 0x210B, 0x4951, 0x0000, 0x4931,
+    0x3191, 0x3191, 0x2991, 0x21F2, 0x0000, 0x2212, 0x0000, 0x3191,
+    0x3191, 0x2212, 0x0000, 0x0000, 0x3191, 0x6111, 0x6111, 0x78D1,
+    0x78F1, 0x0000, 0x88D1, 0xC8B1, 0xC8B1, 0xE0B0, 0xE0B0, 0xE0B0,
+    0xE8AE, 0xE0B0, 0xE0AC, 0xE0AC, 0xE0AA, 0xE8AA, 0xE0C8, 0xD08E,
+    0x1842, 0xE145, 0xE9C5, 0xEA85, 0xF265, 0xF485, 0xFC65, 0xF585,
+    0xFC65, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x9CE5, 0x8667, 0xAEC7, 0xCF26, 0xD726, 0xF725,
+    0xF725, 0xF725, 0xFE65, 0xFD65, 0x0000, 0x0000, 0xF365, 0xF265,
+    0x0000, 0x0000, 0xE0AC, 0xE145, 0xE8E7, 0xE0E7, 0xE0C8, 0xE0AA,
+    0xE8AA, 0x986B, 0x0000, 0x0000, 0xC8B1, 0xA8D1, 0x0000, 0xD0B1,
+    0xA8B1, 0x0000, 0x1842, 0x90D1, 0x78F1, 0x6111, 0x3191, 0x0000,
+    0x4931, 0x4951, 0x3191, 0x3191, 0x3191, 0x0000, 0x3191, 0x2991,
+    0x3191, 0x4931, 0x210B, 0x0000, 0x190B, 0x6911, 0x3191, 0x0000,
+    0x6111, 0x190B, 0x0000, 0x2042, 0xB0D1, 0xC8B1, 0xD0B1, 0xE0B0,
+    0xE0AE, 0xE8AE, 0xA8D1, 0x0000, 0x588B, 0xE8AC, 0xE0A8, 0x5884,
+    0x0000, 0xD127, 0xE965, 0xE9C5, 0xEA85, 0xF365, 0xFB65, 0xF465,
+    0xFC85, 0xFE65, 0xCB84, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x6E08, 0x8667, 0xA6C7, 0xA6A7, 0xCF46,
+    0xF725, 0xF725, 0xFF25, 0xF725, 0xFD85, 0xCB84, 0x90C4, 0xF465,
+    0xF285, 0x0000, 0x0000, 0xE108, 0xE165, 0xE106, 0xE8E7, 0xE0C8,
+    0xE8AA, 0xE108, 0x1842, 0x0000, 0x0000, 0xB0B1, 0xE0B0, 0x0000,
+    0x0000, 0xC8B1, 0xB0D1, 0x0000, 0x90F1, 0x90D1, 0x78F1, 0x0000,
+    0x0000, 0x6111, 0x5131, 0x4951, 0x4931, 0x4951, 0x0000, 0x210B,
+    0x3191, 0x4931, 0x4951, 0x1842, 0x3191, 0x6111, 0x4931, 0x0000,
+    0x6111, 0x90D1, 0x0000, 0x0000, 0x0000, 0xC8B1, 0xC8B1, 0xE0B0,
+    0xE0B0, 0xE0B0, 0xE0AE, 0xE8AE, 0x0000, 0x0000, 0xC8AE, 0xE0C8,
+    0xC88A, 0x0000, 0xE145, 0xE9C5, 0xE9C5, 0xF365, 0xF365, 0xFC65,
+    0xF485, 0xFD65, 0xFE65, 0xF665, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x9AA3, 0x4DA8, 0x8E67, 0x8667, 0xA6C7,
+    0xD726, 0xF725, 0xF725, 0xFF25, 0xFE65, 0xFE65, 0xF565, 0xF365,
+    0xFB65, 0xF365, 0x0000, 0x0000, 0xE1A6, 0xE165, 0xE906, 0xE0E7,
+    0xE0C8, 0x5084, 0xE8AA, 0x986B, 0x0000, 0x0000, 0x0000, 0xE8B0,
+    0xC8B1, 0x0000, 0x0000, 0xC8B1, 0xA8D1, 0xB0B1, 0x90D1, 0x88F1,
+    0x0000, 0x0000, 0x6111, 0x6111, 0x4931, 0x6911, 0x4951, 0x0000,
+    0x0000, 0x4931, 0x4951, 0x6911, 0x4931, 0x6111, 0x210B, 0x0000,
+    0x0000, 0x90F1, 0x190B, 0x0000, 0x0000, 0x0000, 0xD0B1, 0xC8B1,
+    0x1842, 0xE8B0, 0xE8AE, 0xE0AE, 0xE0AC, 0xC8AE, 0x0000, 0xE8AA,
+    0xE0A8, 0xD127, 0xE108, 0xE965, 0xE9C5, 0xEA85, 0xF265, 0xF365,
+    0xF485, 0xFD65, 0xFD85, 0xFE65, 0xF665, 0x62A3, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x9AA3, 0x6E28, 0x6608, 0x8667,
+    0xA6C7, 0xD726, 0xCF26, 0xF725, 0xF725, 0xF485, 0xFD65, 0xFE65,
+    0xFC85, 0xF365, 0xFB65, 0x5084, 0xC165, 0xF285, 0xE165, 0xE145,
+    0xE108, 0xE108, 0xE8C8, 0xE0AA, 0xE0AC, 0xC88E, 0xE8AE, 0xC8B1,
+    0xE0AE, 0xE8B0, 0x988B, 0x0000, 0x0000, 0xB0B1, 0xA8D1, 0xB0B1,
+    0x78F1, 0x0000, 0x0000, 0x90D1, 0x78F1, 0x78F1, 0x6111, 0x6111,
+    0x0000, 0x0000, 0x4931, 0x78D1, 0x6111, 0x78F1, 0x0000, 0x0000,
+    0x0000, 0x90D1, 0xB0D1, 0x588B, 0x78D1, 0x78F1, 0x90D1, 0xE0B0,
+    0xC8B1, 0xE0B0, 0xE0AE, 0xE0AE, 0xE8AC, 0xE0AC, 0xE8AA, 0x988B,
+    0xE0A8, 0xE108, 0xC8AE, 0xE145, 0xE965, 0xE1A6, 0xEA65, 0xFB65,
+    0xF365, 0xF485, 0xFD65, 0xFE65, 0xFE65, 0xFF25, 0x62A3, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3222, 0x2D69, 0x6E28,
+    0x8667, 0xAEA7, 0xA6C7, 0xD726, 0xCF26, 0xFE65, 0x90C4, 0x0000,
+    0xFD65, 0xFD85, 0xFC65, 0xF485, 0xF365, 0xF265, 0xE9C5, 0xE9C5,
+    0xE0AC, 0x0000, 0xE0E7, 0xE0E7, 0xE0AA, 0xC88E, 0xC88A, 0xC8AE,
+    0xD0AE, 0xE0AE, 0xE8AE, 0xE0B0, 0xE0B0, 0x986B, 0x1842, 0xD0B1,
+    0xA8D1, 0x1842, 0x0000, 0x0000, 0x90D1, 0x90D1, 0x78F1, 0x90D1,
+    0x78F1, 0x0000, 0x0000, 0x1842, 0x78F1, 0x90D1, 0x608B, 0x0000,
+    0x78F1, 0x90D1, 0xB0D1, 0xA8B1, 0xB0D1, 0xC8B1, 0xA8B1, 0xD0B1,
+    0xE0B0, 0xE0B0, 0xE0AE, 0x5884, 0x0000, 0xE8AC, 0xE0AA, 0xE0AA,
+    0xE0C8, 0xE8E7, 0xE0E7, 0xE106, 0xE165, 0xC165, 0x0000, 0xF285,
+    0xF365, 0xFC85, 0xFC65, 0xF585, 0xFD65, 0xFE85, 0xFE65, 0x1822,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4DA8,
+    0x4DA8, 0x8667, 0x8667, 0xD726, 0xCF26, 0xF725, 0xCB84, 0xCD65,
+    0xFE65, 0xF685, 0xFD65, 0xFD85, 0xF465, 0xFC85, 0xF365, 0xF285,
+    0xE9C5, 0xD127, 0xE108, 0xE108, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0xC8B1, 0xE8AE, 0xC8B1, 0xE0B0, 0xE0B0, 0xE0B0,
+    0xC8B1, 0xD0B1, 0x0000, 0x0000, 0x0000, 0xA8B1, 0xB0D1, 0xA8D1,
+    0x90D1, 0x90F1, 0x0000, 0x0000, 0x0000, 0x88D1, 0x90D1, 0xB0D1,
+    0xA8B1, 0xB0D1, 0x88D1, 0xD0B1, 0xA8D1, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x608B, 0xE0B0, 0xC88E, 0x1842, 0xE8AC, 0xE0AA,
+    0xE0C8, 0xE108, 0xE0E7, 0xE906, 0xE165, 0xE9C5, 0xE1C6, 0xE1A6,
+    0x986B, 0xFC65, 0xF485, 0xFD65, 0xFD65, 0xFE65, 0xFE85, 0xF725,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x2D49, 0x4DA8, 0x6E28, 0x8667, 0xAEC7, 0xD726, 0xCF26, 0xFE65,
+    0xFD65, 0xF725, 0xFE65, 0xFE65, 0xF565, 0xFC85, 0xF365, 0xF365,
+    0xF265, 0xEA85, 0xE1A6, 0xE108, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0xE8AC, 0xE0AC, 0x0000, 0x0000, 0x588B,
+    0xC8B1, 0xE8B0, 0xA8B1, 0x0000, 0x0000, 0x0000, 0xA8D1, 0xB0B1,
+    0xA8D1, 0xB0B1, 0x90D1, 0x0000, 0x0000, 0x0000, 0x88F1, 0xB0D1,
+    0xA8B1, 0x608B, 0x0000, 0x0000, 0xB0D1, 0xC8B1, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x986B, 0xE8AA, 0xE0AA,
+    0xE8AA, 0xE0C8, 0xE0A8, 0xE106, 0xE926, 0xE165, 0xE1A6, 0xF285,
+    0xEA85, 0xF265, 0xF365, 0xFC85, 0xF565, 0xFE85, 0xFE65, 0xF725,
+    0xFE65, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x4DA8, 0x4DA8, 0x6E08, 0x8667, 0xA6C7, 0xA6A7, 0xCF26,
+    0xD746, 0xF725, 0xF725, 0xF725, 0xF465, 0xFD85, 0xFD65, 0xFC85,
+    0xF365, 0xEA65, 0xF285, 0xEA85, 0xE945, 0xD927, 0x5084, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0xE0AA, 0xE8AE, 0x0000, 0x0000,
+    0x0000, 0x0000, 0xC8AE, 0xB0B1, 0x0000, 0x0000, 0x0000, 0xC8B1,
+    0xC8B1, 0xC8B1, 0xD0B1, 0xA8D1, 0x0000, 0x0000, 0x0000, 0x90D1,
+    0xA8D1, 0x0000, 0x0000, 0x0000, 0x0000, 0xC8B1, 0xE8B0, 0x608B,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x588B, 0xE0AE, 0xE0AC, 0xE0AC,
+    0xE8AA, 0xC8AE, 0xE0E7, 0xE106, 0xE906, 0xE165, 0xE145, 0xEA65,
+    0xF285, 0xF365, 0xF365, 0xFC65, 0xF465, 0xFE65, 0xFE65, 0xF725,
+    0xF725, 0xFE65, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x6CA6, 0x4DA8, 0x55A8, 0x8667, 0x8667, 0xA6C7,
+    0xAEA7, 0xF725, 0xD726, 0xF725, 0xFD65, 0x0000, 0xCC84, 0xFD65,
+    0xF485, 0xFC65, 0xF365, 0xF285, 0x0000, 0xE1A6, 0xE145, 0xE165,
+    0xE106, 0xE108, 0xE8C8, 0xE0A8, 0xE0C8, 0xE0AA, 0xC88E, 0x0000,
+    0x0000, 0x0000, 0x988B, 0xE8B0, 0x0000, 0x0000, 0x0000, 0x0000,
+    0xA8B1, 0xE0B0, 0xC8B1, 0xD0B1, 0xA8D1, 0x0000, 0x0000, 0x0000,
+    0x0000, 0xC8B1, 0x90D1, 0x0000, 0x0000, 0x0000, 0xC8B1, 0xE8B0,
+    0xC8B1, 0xE0B0, 0xE0AE, 0xE8AE, 0xE0AC, 0xE0AC, 0xE0AA, 0xE8AC,
+    0x0000, 0xE0AA, 0xE0C8, 0xE0E7, 0xE906, 0xE165, 0xE108, 0x0000,
+    0xD127, 0xF365, 0xFB65, 0xF485, 0xFC65, 0xFD85, 0xF565, 0xFE85,
+    0xFE65, 0xF725, 0xCB64, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x6E28, 0x2D49, 0x4DA8, 0x6628, 0x8667,
+    0xA6A7, 0xCF26, 0xD726, 0xF725, 0xF725, 0xF725, 0xFE65, 0xFE85,
+    0xFD65, 0xFD85, 0xFC65, 0xFC85, 0x1842, 0x0000, 0x0000, 0x0000,
+    0x988B, 0xE1A6, 0xD127, 0xE108, 0xE0C8, 0xE0AA, 0xE8AA, 0xE8AC,
+    0x0000, 0x0000, 0x588B, 0xE0AE, 0xE0AE, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0xE0B0, 0xE0B0, 0xE8B0, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0xC8B1, 0xE0B0, 0x5084, 0x0000, 0x0000, 0xE0B0,
+    0xE8AE, 0xE0B0, 0xE0AE, 0xE8AE, 0xC88E, 0xC8AE, 0x1842, 0x0000,
+    0x0000, 0x0000, 0x0000, 0xE108, 0xE926, 0xE1A6, 0xE145, 0xE1C5,
+    0xE9C5, 0xF265, 0xF365, 0xFC85, 0xF465, 0xFD85, 0xFD65, 0xFE65,
+    0xFE65, 0xF725, 0xF745, 0x9AA3, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0xA2A3, 0x2D49, 0x2D69, 0x55A8,
+    0x6E28, 0xA6A7, 0xA6C7, 0xD726, 0xCF26, 0xFF25, 0xF725, 0xF725,
+    0xFE65, 0xFE65, 0xFD65, 0xFD65, 0xCB84, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE0AC, 0xC88A, 0xE0C8,
+    0xE0AA, 0x0000, 0xC88A, 0xE0AC, 0xE8AC, 0x988B, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x588B, 0xD08E, 0x588B, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x90D1, 0xE8AE, 0xE0B0, 0x588B, 0x0000,
+    0xE8AE, 0xE0AE, 0xE0AC, 0x988B, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0xC88A, 0xE965, 0xE165, 0xE9C5,
+    0xE9C5, 0xF285, 0xEA65, 0xF365, 0xFC85, 0xFD65, 0xF585, 0xFE65,
+    0xFE65, 0xF725, 0xF725, 0xF725, 0x62A3, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3A42, 0x150A, 0x2D49,
+    0x4DA8, 0x6E28, 0x8667, 0xA6A7, 0xA6C7, 0xCE66, 0xCF26, 0xF725,
+    0xFE65, 0xF725, 0xFE65, 0xFE85, 0xFD85, 0x1842, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE108, 0xE8AA, 0xC88A,
+    0xE0C8, 0xE108, 0xE0AA, 0xE0AA, 0xE8AA, 0xE0AC, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE0B0, 0xE0AE, 0xE8AE,
+    0xC8B1, 0xE0AE, 0xE0AE, 0xE0AE, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE145, 0xE9C5,
+    0xE9C5, 0xF365, 0xF365, 0xFC65, 0xF485, 0xFD65, 0xFD65, 0xFE65,
+    0xFE65, 0xF725, 0xF725, 0xFF25, 0xD746, 0x3222, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x150A,
+    0x152A, 0x4DA8, 0x55A8, 0x6E28, 0x9CE5, 0x0000, 0x1822, 0xD746,
+    0xFD65, 0x0000, 0x0000, 0xFC65, 0xFE85, 0xFE65, 0xFC65, 0xF465,
+    0xF365, 0xF285, 0xD127, 0x90C4, 0x0000, 0x0000, 0xD127, 0xE108,
+    0xE906, 0xE106, 0xE0C8, 0xE8C8, 0xE0A8, 0xE0AA, 0xE0AA, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xC8AE, 0xE8AE,
+    0xE0AC, 0xE0AE, 0xE8AC, 0xE0AC, 0xE0AC, 0x588B, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x5884, 0xC88A, 0xE108, 0xE965, 0xD127, 0xE9C5,
+    0xE9C5, 0xE1A6, 0x588B, 0x0000, 0xC985, 0xFD85, 0xCA64, 0x0000,
+    0xCC64, 0xF725, 0xF725, 0xF725, 0xD746, 0xCF26, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x3549, 0x2D69, 0x2D49, 0x4DA8, 0x6608, 0x0000, 0x0000, 0x0000,
+    0xCF46, 0xF725, 0x62A3, 0xFD65, 0xFE65, 0xF725, 0xFE65, 0xFE65,
+    0xF585, 0xFD65, 0xFC85, 0xF365, 0xEA85, 0xF365, 0xE9C5, 0xE9C5,
+    0xE945, 0xE165, 0xE126, 0xE106, 0xE8E7, 0xE108, 0xE0AA, 0xE8AC,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xC8AE,
+    0x588B, 0xE0AE, 0xE8AC, 0xE0AC, 0xE0AA, 0xE108, 0xE0AA, 0xE8AC,
+    0xE0AA, 0xE108, 0xE0E7, 0xE106, 0xE906, 0xE165, 0xE145, 0xE9C5,
+    0xE9C5, 0xF365, 0xEA65, 0xCA64, 0x0000, 0xFB65, 0xFD85, 0xCA64,
+    0x0000, 0x0000, 0xCD65, 0xF725, 0xF725, 0xFF25, 0xCE66, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x55A8, 0x04EA, 0x2D69, 0x2D49, 0x6E28, 0x0000, 0x0000,
+    0x0000, 0xAEC7, 0xCF26, 0xFF25, 0xF725, 0xF725, 0xFE65, 0xFE65,
+    0xFD65, 0xFD65, 0xF485, 0xFC65, 0xF365, 0xF365, 0xF285, 0xEA65,
+    0xE9C5, 0xE9C5, 0xE145, 0xE165, 0xE106, 0xE106, 0x988B, 0xE8C8,
+    0x5084, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0xA06B, 0xE8AC, 0x0000, 0xE0AA, 0xE0C8, 0xE0AA, 0xE8A8, 0xE0C8,
+    0xE0A8, 0xE0E7, 0xE8E7, 0xE106, 0xE126, 0xE165, 0xE945, 0xE9C5,
+    0xE9C5, 0xEA85, 0xEA85, 0xF365, 0xFB65, 0xF465, 0xFC85, 0xFD65,
+    0x0000, 0x0000, 0x0000, 0x5084, 0xF725, 0xFF25, 0xCF46, 0xCD65,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x6CA6, 0x152A, 0x150A, 0x2D69, 0x9CE5, 0x0000,
+    0x0000, 0x0000, 0x9AA3, 0xCF26, 0xCF26, 0xFF25, 0xF725, 0xF725,
+    0xCB84, 0x9AA3, 0xFE85, 0xF565, 0xFC85, 0xFD65, 0xF485, 0xF365,
+    0xF265, 0xF365, 0xF285, 0xF285, 0xE1A6, 0xE9C5, 0xD127, 0xE108,
+    0xE108, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0xE0AA, 0xD0AE, 0x986B, 0xE0AA, 0xE0C8, 0xE0E7,
+    0xE8E7, 0xE126, 0xE106, 0xE145, 0xE145, 0xE9C5, 0xE9C5, 0xEA85,
+    0xF265, 0xEA85, 0xF265, 0xF365, 0xF365, 0xFD85, 0xFD65, 0xFD85,
+    0xCC64, 0x0000, 0x0000, 0x0000, 0x0000, 0xF725, 0xD726, 0xCF26,
+    0xCB84, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x3222, 0x04EA, 0x152A, 0x150A, 0x9CE5,
+    0x0000, 0x0000, 0x0000, 0xAEC7, 0xA6C7, 0xD726, 0xCF26, 0xCC64,
+    0x0000, 0x0000, 0xCC64, 0xFE85, 0xFD65, 0xFD65, 0xF485, 0xFC65,
+    0xF365, 0xF365, 0xF285, 0xEA65, 0xE1A6, 0xF285, 0xE9C5, 0x0000,
+    0xE108, 0xE108, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0xE0AA, 0xE0AA, 0x0000, 0xE0A8, 0xE8E7,
+    0xE0E7, 0xE106, 0xE126, 0xE965, 0xE108, 0xE9C5, 0xE9C5, 0xEA85,
+    0xEA65, 0xF365, 0xF285, 0x0000, 0x0000, 0xCA64, 0xFC65, 0xF585,
+    0xFD65, 0xFE85, 0x0000, 0x0000, 0x0000, 0x62A3, 0xCF26, 0xCF26,
+    0xA6A7, 0x5864, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x152A, 0x04EA, 0x150A,
+    0x64A6, 0x0000, 0x0000, 0x0000, 0x8667, 0xA6A7, 0xA6C7, 0xCE86,
+    0x0000, 0x0000, 0xCB64, 0xF725, 0xFE85, 0xF725, 0xCA64, 0xCA64,
+    0xFD65, 0xFD85, 0xFC85, 0xF365, 0x0000, 0xCA64, 0xF285, 0xE9C5,
+    0xD127, 0xF1C5, 0x1842, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x5084, 0xE908, 0x5084, 0xC88A,
+    0xE906, 0xE108, 0x5084, 0xE165, 0xE145, 0xE9C5, 0xE9C5, 0xE9A6,
+    0xD127, 0xF365, 0xF365, 0xF485, 0xF265, 0x0000, 0x0000, 0xCB84,
+    0xFD65, 0xFF25, 0xFE85, 0x0000, 0x0000, 0x0000, 0x3222, 0xCF26,
+    0xAEC7, 0xA6C7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x150A, 0x04EA,
+    0x04EA, 0x6CA6, 0x0000, 0x0000, 0x0000, 0x8667, 0x8667, 0xA6C7,
+    0xA6C7, 0xD464, 0xCB84, 0xF725, 0xF725, 0xFF25, 0xCC64, 0x0000,
+    0xFC85, 0xF565, 0xFC85, 0xC165, 0x0000, 0xCA64, 0xF365, 0xF365,
+    0xF285, 0xF265, 0xE1A6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE108, 0xE165,
+    0xE108, 0xE145, 0xE165, 0xC0C6, 0x0000, 0xC0C6, 0xE9C5, 0xF285,
+    0xE1A6, 0x0000, 0xF285, 0xF465, 0xFC85, 0xF565, 0x5084, 0xCA64,
+    0xFD85, 0xFE65, 0xFE65, 0xFE65, 0x0000, 0x0000, 0x0000, 0x9CE5,
+    0xA6C7, 0xA6A7, 0x9CE5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4DA8,
+    0x04EA, 0x4DA8, 0x6CA6, 0x9AA3, 0x0000, 0x0000, 0x1822, 0x8667,
+    0x8667, 0xD686, 0xCE66, 0xCF26, 0xD746, 0xF725, 0xCB84, 0x0000,
+    0x90C4, 0xF725, 0xFE65, 0x0000, 0x0000, 0xF365, 0xFC85, 0xF465,
+    0xFB65, 0xCA64, 0xF285, 0xD127, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD127,
+    0xE165, 0xE1A6, 0xE1A6, 0xE9C5, 0xE9C5, 0xD127, 0x0000, 0x0000,
+    0xF285, 0xFB65, 0x5084, 0x0000, 0xCA64, 0xF565, 0xFD65, 0xFE85,
+    0xFC65, 0xFD85, 0xF725, 0xF725, 0xCC64, 0x0000, 0x0000, 0x0000,
+    0xD565, 0xD686, 0x8667, 0x9CE5, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x3A42, 0x04EA, 0x152A, 0x6AA3, 0x64A6, 0x0000, 0x0000, 0x0000,
+    0x9CE5, 0x8667, 0x8667, 0xAEC7, 0xA6A7, 0xD726, 0xCC64, 0xCD85,
+    0xFE65, 0xF725, 0xFE65, 0xFE65, 0xCB84, 0xFD65, 0xFD85, 0xF565,
+    0xC165, 0x0000, 0xFB65, 0xF365, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0xE9C5, 0xE1A6, 0x0000, 0x988B, 0xF285, 0xF285, 0xEA65,
+    0x0000, 0xF365, 0xF365, 0xFC85, 0xF365, 0x0000, 0x986B, 0xFD85,
+    0xFE65, 0xF725, 0xFE65, 0xF725, 0xFE65, 0x0000, 0x0000, 0x0000,
+    0xCC64, 0xCC84, 0x8667, 0x8667, 0x5064, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x04EA, 0x04EA, 0x62A3, 0x6CA6, 0x2D49, 0x6E08,
+    0x0000, 0x8667, 0x6628, 0x8667, 0x8667, 0xA6A7, 0xD686, 0xCF26,
+    0xCF26, 0xF725, 0xFE65, 0x0000, 0xFD65, 0xF725, 0xFE85, 0xF465,
+    0x0000, 0x0000, 0xFD85, 0xFD85, 0xA06B, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x90C4, 0xF365, 0xEA85, 0x0000, 0x0000, 0xFB65,
+    0xF365, 0xFC65, 0xFC85, 0x5064, 0xF365, 0xFE85, 0xF565, 0xFE65,
+    0xFD85, 0xFF25, 0xF725, 0xF725, 0xF725, 0xFF25, 0x0000, 0x62A3,
+    0xCC64, 0xD585, 0x5884, 0x8667, 0x6E28, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x2D69, 0x04EA, 0x4DA8, 0x0000, 0x6CA6,
+    0x34C8, 0x2D49, 0x2D69, 0x6AA3, 0x0000, 0xA2A3, 0x0000, 0xA6C7,
+    0xAEC7, 0xCF26, 0xCD65, 0x0000, 0x0000, 0xFD65, 0xFE85, 0x62A3,
+    0x0000, 0x3222, 0xFD65, 0xFD85, 0xCB84, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0xE9A6, 0xF365, 0xFB65, 0x1842,
+    0x0000, 0x90C4, 0xFC85, 0xFC85, 0x0000, 0x0000, 0xCC64, 0xFE85,
+    0xFE65, 0xF665, 0x9AA3, 0x9AA3, 0x0000, 0x3242, 0xD726, 0xCF26,
+    0xCD65, 0x9CE5, 0x0000, 0xA2A3, 0x4DA8, 0x6E28, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x34C8, 0x04EA, 0x0D2A, 0x0000,
+    0x0000, 0x6CA6, 0x150A, 0x9CE5, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x8667, 0xA6A7, 0xA6C7, 0x0000, 0x0000, 0xF725, 0xFE65, 0x0000,
+    0x0000, 0x1842, 0xFE65, 0xFE65, 0xFD85, 0xF465, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFB65, 0xF365, 0xF365,
+    0xFC85, 0x62A3, 0x0000, 0x0000, 0xF465, 0xFD65, 0x0000, 0x0000,
+    0xFE65, 0xFF25, 0xFF25, 0x0000, 0x0000, 0x0000, 0x0000, 0x9CE5,
+    0xA6C7, 0xCD85, 0x0000, 0x0000, 0xA4E5, 0x4DA8, 0x64A6, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x04EA, 0x04EA,
+    0x0000, 0x2D49, 0x04EA, 0x6CA6, 0x0000, 0x0000, 0x0000, 0x0000,
+    0xA4E5, 0x8667, 0x8667, 0x9CE5, 0x0000, 0xD746, 0xCE66, 0x0000,
+    0x0000, 0x0000, 0xFD65, 0xF725, 0xFE85, 0xF725, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1822, 0xFD85,
+    0xFC65, 0xCC84, 0xFC65, 0x5084, 0x0000, 0x0000, 0xFD85, 0xFE65,
+    0x0000, 0x9AA3, 0xFF25, 0xF725, 0xCD85, 0x0000, 0x0000, 0x0000,
+    0x0000, 0xCC64, 0x8667, 0x8667, 0x0000, 0x6E28, 0x2D49, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2D69,
+    0x04EA, 0x150A, 0x152A, 0x2D49, 0x6AA3, 0x0000, 0x0000, 0x0000,
+    0x1842, 0x4DA8, 0x6E28, 0x8667, 0x9AA3, 0xA6A7, 0xA6C7, 0x0000,
+    0x0000, 0x0000, 0xD686, 0xF725, 0xF725, 0xF725, 0xF465, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0xCC64, 0xFE85, 0xFD65, 0xFE65, 0xFD65, 0x0000, 0x0000, 0x0000,
+    0xFE65, 0xF725, 0x0000, 0xF725, 0xCF46, 0xFF25, 0xCB64, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x8E67, 0x4DA8, 0x6E28, 0x2D69, 0x4DA8,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x3CC8, 0x04EA, 0x04EA, 0x6CA6, 0x150A, 0x04EA, 0x152A, 0x4DA8,
+    0x6CA6, 0x2D49, 0x2D69, 0x0000, 0x55A8, 0x6E28, 0x9CE5, 0x0000,
+    0x0000, 0x0000, 0xCC64, 0xD726, 0xCF26, 0xF725, 0xD686, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0xFD65, 0xFE65, 0xFE65, 0xF725, 0xF465, 0x0000,
+    0x0000, 0x0000, 0xFD85, 0xF725, 0xCF26, 0xCC64, 0xCD85, 0xA6C7,
+    0xD565, 0x9CE5, 0x9CE5, 0x6E28, 0x6608, 0x3222, 0x2D69, 0x2D49,
+    0xA2A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x04EA, 0x152A, 0x34C8, 0x150A, 0x6CA6, 0x4DA8,
+    0x6CA6, 0x152A, 0x0D0A, 0x0000, 0x6AA3, 0x55A8, 0x4DA8, 0x6E08,
+    0x8667, 0xA6C7, 0xA6A7, 0xA6C7, 0xA6A7, 0xCF26, 0xCF46, 0xCC64,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0xFC65, 0xF725, 0xFF25, 0xF725, 0xF725,
+    0xFE65, 0xFE65, 0xCE86, 0xD666, 0xCF26, 0xCF26, 0xD686, 0x0000,
+    0xA6C7, 0x8667, 0xA2A3, 0x8667, 0x6608, 0x6E28, 0xA4E5, 0x2D69,
+    0x152A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x150A, 0x04EA, 0x0000, 0x34C8, 0x6AA3,
+    0x6CA6, 0x152A, 0x04EA, 0x6CA6, 0x0000, 0x2D49, 0x2D69, 0x4DA8,
+    0x55A8, 0x6E28, 0x6E08, 0x8667, 0x8667, 0xA6C7, 0xA6A7, 0xD686,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF725, 0xFF25, 0xF725,
+    0xCF26, 0xF725, 0xD726, 0xCF26, 0xA6A7, 0xCF26, 0xA6C7, 0xA6A7,
+    0x0000, 0xA2A3, 0x6628, 0x6E28, 0x9CE5, 0x6CA6, 0x64A6, 0x3222,
+    0x150A, 0x55A8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x6AA3, 0x04EA, 0x2D69, 0x2D49,
+    0x2D69, 0x150A, 0x04EA, 0x2D69, 0x0000, 0x2D49, 0x150A, 0x6E28,
+    0x64A6, 0x6E08, 0x9CE5, 0x6E28, 0x6E28, 0x8667, 0x8667, 0xA6C7,
+    0x5864, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9AA3, 0xF725,
+    0xCF26, 0xF725, 0xD726, 0xCF46, 0xCD65, 0xCC84, 0xD565, 0xCD65,
+    0x8667, 0xAEC7, 0x0000, 0x6E28, 0x4DA8, 0x4DA8, 0x6CA6, 0x55A8,
+    0x04EA, 0x150A, 0x3242, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x04EA, 0x04EA,
+    0x04EA, 0x04EA, 0x04EA, 0x3A22, 0x6CA6, 0x2D69, 0x04EA, 0x2D49,
+    0x34C8, 0x6CA6, 0x152A, 0x2D49, 0x2D69, 0x55A8, 0x4DA8, 0x6E28,
+    0xA4E5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0xCD65, 0xD726, 0xA6C7, 0xA6A7, 0xA6C7, 0xA6A7, 0x8667, 0x9CE5,
+    0x9CE5, 0x6E28, 0x4DA8, 0xA4E5, 0x64A6, 0x6CA6, 0x2D49, 0x150A,
+    0x04EA, 0x04EA, 0x34C8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x34C8,
+    0x04EA, 0x04EA, 0x34C8, 0x6CA6, 0x6AA3, 0x0D2A, 0x04EA, 0x6CA6,
+    0x6AA3, 0x04EA, 0x04EA, 0x150A, 0x152A, 0x2D49, 0x2D49, 0x4DA8,
+    0x6E28, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0xA6A7, 0xA6C7, 0x8667, 0xAEA7, 0x8667, 0x8667,
+    0x6628, 0x6E28, 0x9CE5, 0x6AA3, 0x2D49, 0x2D69, 0x6CA6, 0x62A3,
+    0x6CA6, 0x04EA, 0x04EA, 0x6AA3, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x150A, 0x04EA, 0x0000, 0x3CC8, 0x4DA8, 0x04EA, 0x152A,
+    0x6CA6, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x150A,
+    0x2D69, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x8667, 0x8667, 0x6E28, 0x6E08,
+    0x4DA8, 0x55A8, 0x2D49, 0x2D69, 0xA2A3, 0x4DA8, 0x04EA, 0x4DA8,
+    0x6CA6, 0x6CA6, 0x04EA, 0x2D69, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x2042, 0x04EA, 0x150A, 0x2D69, 0x04EA, 0x150A,
+    0x34C8, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA,
+    0x150A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6E28, 0x4DA8,
+    0x55A8, 0x55A8, 0x2D69, 0x2D49, 0x152A, 0x150A, 0x2D69, 0x2D49,
+    0x04EA, 0x152A, 0x04EA, 0x150A, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x34C8, 0x04EA, 0x04EA, 0x04EA,
+    0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA,
+    0x152A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x6CA6, 0x2D49, 0x152A, 0x150A, 0x152A, 0x150A, 0x04EA, 0x04EA,
+    0x152A, 0x04EA, 0x04EA, 0x04EA, 0x3CC8, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x34C8, 0x04EA,
+    0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA,
+    0x2D69, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x6CA6, 0x150A, 0x04EA, 0x04EA, 0x04EA, 0x04EA,
+    0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x34C8, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x3CC8, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x150A,
+    0x6AA3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x6AA3, 0x0D2A, 0x04EA, 0x04EA,
+    0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x34C8, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x3222, 0x3CC8, 0x04EA, 0x152A, 0x34C8, 0x6CA6,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6CA6,
+    0x2D49, 0x2D69, 0x150A, 0x2D69, 0x3A22, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000 },
+  { 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x34C8, 0x152A, 0x150A,
+    0x152A, 0x34C8, 0x3A22, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3A42, 0x4DA8,
+    0x2D49, 0x2D69, 0x3CC8, 0x34C8, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3CC8, 0x04EA, 0x04EA,
+    0x04EA, 0x04EA, 0x04EA, 0x2D69, 0x34C8, 0x3222, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x62A3, 0x6CA6, 0x55A8,
+    0x152A, 0x04EA, 0x04EA, 0x04EA, 0x150A, 0x55A8, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x150A, 0x04EA, 0x04EA,
+    0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x152A,
+    0x3CC8, 0x3222, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x3A42, 0x9CE5, 0x6E28, 0x2D49, 0x2D49,
+    0x152A, 0x150A, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x2D69,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x150A, 0x04EA, 0x04EA,
+    0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA,
+    0x04EA, 0x04EA, 0x04EA, 0x2D49, 0x64A6, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x9CE5, 0xAEC7, 0x8667, 0x8667, 0x6E08, 0x6E28,
+    0x4DA8, 0x55A8, 0x2D69, 0x150A, 0x04EA, 0x04EA, 0x04EA, 0x04EA,
+    0x04EA, 0x55A8, 0x0000, 0x0000, 0x0000, 0x3A42, 0x04EA, 0x04EA,
+    0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA,
+    0x04EA, 0x04EA, 0x04EA, 0x150A, 0x152A, 0x2D49, 0x2D69, 0xA4E5,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0xCD65, 0xA6C7, 0xA6C7, 0xAEA7, 0xA6C7, 0x8667, 0x8667,
+    0x6E08, 0x4DA8, 0x2D49, 0x2D69, 0x150A, 0x152A, 0x04EA, 0x04EA,
+    0x04EA, 0x04EA, 0x04EA, 0x3A22, 0x0000, 0x0000, 0x150A, 0x04EA,
+    0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA,
+    0x04EA, 0x04EA, 0x04EA, 0x152A, 0x150A, 0x55A8, 0x4DA8, 0x6E08,
+    0x6628, 0x8667, 0x9CE5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0xCD65, 0xFF25, 0xCF26, 0xCF26, 0xCF26, 0xD726, 0xA6C7, 0xAEA7,
+    0x8667, 0x8667, 0x6E28, 0x6E28, 0x4DA8, 0x55A8, 0x2D49, 0x0D2A,
+    0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x6CA6, 0x0000, 0x1842, 0x152A,
+    0x04EA, 0x04EA, 0x150A, 0x0000, 0x2D69, 0x04EA, 0x04EA, 0x04EA,
+    0x04EA, 0x04EA, 0x04EA, 0x150A, 0x152A, 0x2D49, 0x3569, 0x55A8,
+    0x6E28, 0x8667, 0x8667, 0xA6A7, 0xA6C7, 0xD565, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFC65,
+    0xFE85, 0xF725, 0xF725, 0xF725, 0xCF26, 0xFF25, 0xCF26, 0xCF26,
+    0xA6A7, 0xA6C7, 0x8667, 0x8667, 0x6E08, 0x6E28, 0x2D49, 0x2D49,
+    0x152A, 0x6CA6, 0x0000, 0x04EA, 0x04EA, 0x2D49, 0x1842, 0x34C8,
+    0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x3CC8, 0x4DA8, 0x2D49, 0x04EA,
+    0x04EA, 0x55A8, 0x3242, 0x2D49, 0x6CA6, 0x6E08, 0x4DA8, 0x6E28,
+    0x6608, 0x8667, 0x8667, 0xA6C7, 0xA6A7, 0xD726, 0xCF46, 0xF725,
+    0xCC64, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF365, 0xFE65,
+    0xFE65, 0xF725, 0xF725, 0xFF25, 0xF725, 0xF725, 0xF725, 0xFF25,
+    0xCF26, 0xD726, 0xA6A7, 0xA6C7, 0x8667, 0x9CE5, 0x6E08, 0x6E28,
+    0x55A8, 0x4DA8, 0x64A6, 0x6CA6, 0x04EA, 0x04EA, 0x152A, 0x6CA6,
+    0x152A, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x150A, 0x04EA, 0x0000,
+    0x2D69, 0x04EA, 0x3CC8, 0x0000, 0x6CA6, 0x6E28, 0x0000, 0x9CE5,
+    0x6E08, 0x8667, 0x8667, 0xA6C7, 0xA6A7, 0xD726, 0xCF26, 0xD726,
+    0xCF26, 0xF725, 0xFE65, 0xCB84, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCA64, 0xFC65, 0xFD85,
+    0xF565, 0xFE85, 0xFE65, 0xFE65, 0xF665, 0xF725, 0xFE65, 0xF725,
+    0xCF26, 0xFF25, 0x62A3, 0x0000, 0xCD65, 0xCD65, 0x0000, 0x8667,
+    0x6E28, 0x6E28, 0x9AA3, 0x2D49, 0x152A, 0x150A, 0x04EA, 0x04EA,
+    0x6CA6, 0x2D69, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x0000, 0x3CC8,
+    0x04EA, 0x04EA, 0x04EA, 0x2D49, 0x0000, 0x3222, 0x6E28, 0x0000,
+    0x0000, 0x8667, 0x8667, 0xA6A7, 0x9CE5, 0xCF26, 0xCF26, 0xF725,
+    0xFF25, 0xF725, 0xF725, 0xF725, 0xFE65, 0xFE85, 0x9AC3, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x90C4, 0xFC65, 0xF485, 0xFC65,
+    0xF485, 0xFD65, 0xFD65, 0xFE65, 0xFE85, 0xF725, 0xFD65, 0xCD65,
+    0xF725, 0xFF25, 0xFE85, 0x0000, 0xCB64, 0xD686, 0x0000, 0x1842,
+    0x8667, 0x8667, 0x6E08, 0x6E28, 0x1842, 0x6E28, 0x150A, 0x152A,
+    0x04EA, 0x4DA8, 0x150A, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x55A8,
+    0x0000, 0x6AA3, 0x04EA, 0x0D2A, 0x150A, 0x2D69, 0x55A8, 0x4DA8,
+    0xA4E5, 0x0000, 0x9CE5, 0x9CE5, 0xAEC7, 0xCF26, 0xCC64, 0xCD65,
+    0xD746, 0xF725, 0xF725, 0xFF25, 0xFE65, 0xFE65, 0xF565, 0xFE65,
+    0xFC65, 0x1842, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x1842, 0xF285, 0xFB65, 0xF365, 0xF365,
+    0xF365, 0xFC65, 0xFC85, 0xF565, 0xFD85, 0xFE65, 0xF365, 0xFC65,
+    0xF685, 0xFD65, 0xCC64, 0xFD85, 0x0000, 0xFE65, 0xCE86, 0xCD65,
+    0xA6C7, 0xA6A7, 0x8667, 0x8667, 0x0000, 0x0000, 0x64A6, 0x2D49,
+    0x152A, 0x150A, 0x34C8, 0x2D69, 0x04EA, 0x04EA, 0x04EA, 0x04EA,
+    0x150A, 0x55A8, 0x6CA6, 0x2D69, 0x150A, 0x2D69, 0x2D49, 0x55A8,
+    0x4DA8, 0x8667, 0x9CE5, 0x9CE5, 0x0000, 0xCF26, 0xCF26, 0xFF25,
+    0x0000, 0x9CE5, 0xF725, 0xF725, 0xFE65, 0xF725, 0xF665, 0xFE65,
+    0xFD85, 0xFD65, 0xF485, 0xCA64, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0xC165, 0xE9C5, 0xF285, 0xEA65, 0xFB65,
+    0xF365, 0xF485, 0xFC65, 0xF485, 0xFC65, 0xFD85, 0x5864, 0x62A3,
+    0xFE85, 0xFF25, 0x9AC3, 0x9AA3, 0xCB64, 0x9CE5, 0xF725, 0xFF25,
+    0xCF26, 0xD726, 0xA6C7, 0xA6A7, 0x8667, 0xA6C7, 0xA4E5, 0x55A8,
+    0x2D69, 0x2D49, 0x152A, 0x55A8, 0x2D49, 0x04EA, 0x04EA, 0x04EA,
+    0x04EA, 0x04EA, 0x152A, 0x55A8, 0x150A, 0x2D69, 0x6CA6, 0x64A6,
+    0x9CE5, 0x8667, 0x6E28, 0xAEA7, 0xA6C7, 0x0000, 0xD666, 0xCC64,
+    0xCE86, 0xFF25, 0xCE86, 0xFE65, 0x5064, 0xFE85, 0xFD65, 0xFD65,
+    0xFD85, 0xFD65, 0xFC85, 0xF465, 0xF365, 0xF285, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0xE0E8, 0xE165, 0xE9C5, 0xE9C5, 0xEA85,
+    0xF265, 0xEA85, 0xF265, 0xF365, 0xEA85, 0xCA64, 0xF365, 0xFB65,
+    0xFD65, 0xCD85, 0xCC64, 0xF365, 0x1842, 0xFF25, 0xF725, 0xF725,
+    0xD686, 0xCC64, 0x9AA3, 0xCE86, 0xA6C7, 0xA6C7, 0x9CE5, 0x6E08,
+    0x4DA8, 0x55A8, 0x2D49, 0x152A, 0x34C8, 0x4DA8, 0x04EA, 0x04EA,
+    0x04EA, 0x04EA, 0x04EA, 0x34C8, 0x6CA6, 0x2D49, 0x2D49, 0x6E28,
+    0x9CE5, 0x8667, 0x8667, 0xA6C7, 0x9AA3, 0xCF26, 0xD726, 0xF725,
+    0xCD65, 0x0000, 0xFE85, 0xF725, 0xFD65, 0xCA64, 0xFD85, 0x1842,
+    0xCC64, 0xFD85, 0xF465, 0xFC85, 0xF365, 0xF365, 0xF285, 0xEA85,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0xE906, 0xE106, 0xE165, 0xE145, 0xE9C5,
+    0xE9C5, 0xEA85, 0xF285, 0xE1A6, 0xE1A6, 0xF285, 0x90C4, 0xFC65,
+    0xF485, 0xFD65, 0x0000, 0xF485, 0xFD65, 0xFE65, 0xFE65, 0xFD65,
+    0xFE65, 0xFE85, 0xCC64, 0x9CE5, 0xCE66, 0xD726, 0xA6C7, 0x6AA3,
+    0x9CE5, 0x6E28, 0x55A8, 0x4DA8, 0x2D49, 0xA4E5, 0x3A42, 0x2D49,
+    0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x6CA6, 0x0000, 0x152A, 0x4DA8,
+    0x0000, 0x0000, 0x0000, 0xA2A3, 0x8667, 0x0000, 0xCD85, 0xD686,
+    0xCF26, 0xFF25, 0x0000, 0x0000, 0xFE65, 0xFE65, 0xF565, 0xFD65,
+    0xFD85, 0xF465, 0xFC85, 0xF465, 0xF365, 0xFB65, 0xEA85, 0xF265,
+    0xE9C5, 0xE9C5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0xE108, 0xE0E7, 0xE106, 0xE106, 0xE165,
+    0xE165, 0xE9C5, 0xE1A6, 0xE9C5, 0xE1A6, 0xF285, 0xF285, 0xF365,
+    0xF365, 0xFC85, 0x0000, 0x0000, 0xF465, 0xFE85, 0xFD65, 0xCC64,
+    0x0000, 0xF585, 0x0000, 0x0000, 0x0000, 0x9CE5, 0xA6C7, 0xD666,
+    0x0000, 0xA6C7, 0x6608, 0x6E28, 0x4DA8, 0x6E08, 0x1842, 0x0000,
+    0x34C8, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x2D49, 0x0000, 0x2D49,
+    0x55A8, 0x8667, 0x9CE5, 0xA6C7, 0xA6A7, 0xCF46, 0xCD65, 0xFF25,
+    0x62A3, 0xF725, 0xF725, 0xFE65, 0x0000, 0xF565, 0xFE65, 0xFE85,
+    0xFD65, 0xF485, 0xFB65, 0xF365, 0xEA65, 0xF365, 0xF285, 0xEA85,
+    0xE9C5, 0xF285, 0xE9C5, 0xE1A6, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0xE0AA, 0xE0C8, 0xE108, 0xE8E7, 0xE106,
+    0xE106, 0xE165, 0xE965, 0xE1A6, 0xE145, 0xE1C5, 0xE9C5, 0xF265,
+    0xF285, 0xF365, 0x0000, 0x0000, 0xF465, 0xFD85, 0xCB84, 0xF365,
+    0xFC65, 0xCB84, 0xF665, 0xFD85, 0xFD65, 0xCC84, 0xCC64, 0xD726,
+    0xD666, 0x0000, 0xA6C7, 0x8667, 0x6E08, 0x6E28, 0x6CA6, 0x0000,
+    0x0000, 0x0000, 0x152A, 0x04EA, 0x04EA, 0x150A, 0x152A, 0x2D49,
+    0x3569, 0x55A8, 0x4DA8, 0x8667, 0xA2A3, 0x9CE5, 0xA6C7, 0xD726,
+    0xCD65, 0xCC84, 0xCC64, 0xFE85, 0xFE65, 0xFC65, 0x5064, 0xFD85,
+    0xFD85, 0xFC65, 0xCA64, 0x0000, 0x0000, 0x0000, 0x0000, 0xEA85,
+    0xE9C5, 0xE9C5, 0xE145, 0xE145, 0xE106, 0xE108, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0xC8AA, 0x90E4, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0xA06B, 0xC88A, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0xE0AA, 0xE8C8, 0xE0C8, 0xE0A8, 0xE0C8,
+    0xE8A8, 0xE0E7, 0xE0C8, 0x0000, 0x0000, 0x0000, 0x0000, 0xD127,
+    0xE9C5, 0xF285, 0xE1A6, 0x0000, 0xF365, 0xFC85, 0xF365, 0xCA64,
+    0xFC65, 0xF585, 0xFD65, 0xFE85, 0xCB64, 0xFD85, 0xF725, 0xF725,
+    0xCF26, 0xCF26, 0xA6C7, 0xA6A7, 0x8667, 0x8667, 0x9CE5, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x6CA6, 0x04EA, 0x04EA, 0x152A, 0x2D49,
+    0x2D49, 0x6628, 0x6CA6, 0x8667, 0x8667, 0xA6A7, 0xA6C7, 0xCD85,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCD65, 0xFE65, 0xF585,
+    0xFD65, 0xCB84, 0x0000, 0xFC85, 0xF285, 0x0000, 0x0000, 0x0000,
+    0x1842, 0xE9C5, 0xE145, 0xE165, 0xE926, 0xE106, 0xE0E7, 0xE108,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE0AC, 0xE8AC, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0xE0AC, 0xE0AE, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0xE0AC, 0xE8AA, 0xE0AC, 0xE0AA, 0xE0AA,
+    0xE8A8, 0xE0C8, 0xE0C8, 0x0000, 0x0000, 0x0000, 0x0000, 0xE106,
+    0xE945, 0x0000, 0xE1A6, 0xEA85, 0xF285, 0xFB65, 0x90C4, 0x0000,
+    0x0000, 0x0000, 0x1842, 0x9AA3, 0xFD65, 0xFE65, 0xFE85, 0xF725,
+    0xFD65, 0xCD65, 0xD686, 0xD726, 0xA6A7, 0xA6C7, 0x8667, 0x6CA6,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2D49, 0x04EA, 0x152A,
+    0x2D49, 0x6E28, 0x0000, 0x0000, 0x0000, 0x0000, 0x6AA3, 0xD726,
+    0xCF26, 0x3222, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFC85,
+    0xFD65, 0xFD85, 0xF365, 0x0000, 0x0000, 0xF365, 0xF265, 0x0000,
+    0x0000, 0x0000, 0x5084, 0xE945, 0xE108, 0xD127, 0xE8E7, 0xE0E7,
+    0xE0C8, 0xE0AA, 0x0000, 0x0000, 0x0000, 0x0000, 0x986B, 0xE8AC,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x1842, 0xE8AE, 0x988B, 0x0000,
+    0x0000, 0x0000, 0x0000, 0xC88E, 0xE8AC, 0xE0AC, 0xE8AA, 0xE0AA,
+    0xE0AA, 0xE0AA, 0xE8AA, 0x0000, 0x0000, 0x0000, 0x0000, 0xE108,
+    0xE106, 0x5084, 0x0000, 0xE9C5, 0xE9C5, 0xF285, 0xE1A6, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFE85, 0xFE85, 0xCC64,
+    0x0000, 0x0000, 0x0000, 0x0000, 0xCE86, 0xCF26, 0xA6A7, 0xA6C7,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x34C8, 0x152A,
+    0x150A, 0x4DA8, 0x6628, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0xFF25, 0xF725, 0x9AA3, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0xF585, 0xFC65, 0xFC85, 0xC165, 0x0000, 0x0000, 0xF285,
+    0xE9C5, 0x988B, 0x0000, 0x0000, 0x1842, 0xE108, 0xE8AA, 0x986B,
+    0xE0C8, 0xE8AA, 0xE0AA, 0x986B, 0x0000, 0x0000, 0x0000, 0x0000,
+    0xE8AE, 0xC8AE, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD0B1, 0xC8B1, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x986B, 0xE0AE, 0xE0AE, 0xE8AC, 0xE0AE,
+    0xE0AC, 0xE0AC, 0xE8AC, 0x0000, 0x0000, 0x0000, 0x988B, 0xE108,
+    0xE0A8, 0x0000, 0x0000, 0xE108, 0xE165, 0xE9C5, 0xE9C5, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x90C4, 0xFD65, 0xCC64, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFE65, 0xD726, 0xCF26,
+    0x6AA3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x150A, 0x2D69, 0x2D49, 0x6E28, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x5864, 0xD585, 0xD585, 0xF725, 0xFF25, 0x9AA3, 0x0000, 0x0000,
+    0x5084, 0x5884, 0xFB65, 0xFC85, 0xF365, 0xF365, 0x90C4, 0x0000,
+    0x0000, 0xC965, 0xE165, 0xE108, 0x0000, 0x0000, 0x0000, 0xE8AA,
+    0xE0A8, 0xC88A, 0xC8AE, 0xE0AA, 0xE8AA, 0x0000, 0x0000, 0x0000,
+    0x0000, 0xA8D1, 0xC88E, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xC8AE, 0x986B,
+    0x0000, 0x0000, 0x0000, 0x1842, 0xE8AE, 0xE8AE, 0xE8AE, 0xE0AE,
+    0xC8AE, 0xE0AE, 0xE8AC, 0x0000, 0x0000, 0x0000, 0xC88A, 0xE0AA,
+    0x988B, 0x0000, 0x0000, 0xC0C6, 0xE906, 0xE165, 0xE145, 0xD127,
+    0x0000, 0x5884, 0x1842, 0x0000, 0xC985, 0xFC85, 0xFC65, 0xF485,
+    0xF365, 0x5064, 0x0000, 0x0000, 0x0000, 0x0000, 0xD686, 0xD746,
+    0xA6A7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x4DA8, 0x2D49, 0x4DA8, 0x6E28, 0x0000, 0x0000, 0x0000,
+    0x9CE5, 0xCD85, 0xCB84, 0x3222, 0x0000, 0xFE65, 0xFE65, 0xF665,
+    0xFD85, 0xFD65, 0xF485, 0xFC65, 0xF365, 0xF365, 0xF285, 0xF285,
+    0xE1C6, 0x0000, 0xE106, 0xE165, 0xE906, 0xE106, 0xE0C8, 0x0000,
+    0x0000, 0xC88A, 0xE0AA, 0xE8AC, 0xE0AC, 0xE0AC, 0xE0AC, 0x0000,
+    0x0000, 0x0000, 0x0000, 0xE8AE, 0xA08B, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x986B, 0xC8B1,
+    0x0000, 0x0000, 0x0000, 0x0000, 0xE0B0, 0xE0B0, 0xE0B0, 0xE0B0,
+    0xE0AE, 0xE0B0, 0xC8AE, 0x0000, 0x0000, 0xE0AC, 0xE8AC, 0xE0AC,
+    0xE8AA, 0x588B, 0x0000, 0xE0AA, 0xE0E7, 0xE926, 0xE106, 0xE145,
+    0xE145, 0xE9C5, 0xE9C5, 0xEA85, 0xF265, 0xF365, 0xFB65, 0x0000,
+    0xCB84, 0xFD85, 0xFD85, 0x9AA3, 0x0000, 0x0000, 0x1822, 0xF725,
+    0xD726, 0xCE86, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x6CA6, 0x4DA8, 0x55A8, 0x6E28, 0x6AA3, 0x0000,
+    0xCD65, 0xD686, 0x0000, 0x0000, 0x0000, 0x0000, 0xFD65, 0xFE65,
+    0xFD65, 0xF585, 0xFC65, 0xF485, 0xF365, 0xCA64, 0x1842, 0xC965,
+    0xE1A6, 0xE9C5, 0xE965, 0xE145, 0xC88A, 0x5084, 0xE8C8, 0xE0C8,
+    0xE8A8, 0xE0AC, 0x0000, 0x0000, 0xE0AC, 0xE0AC, 0xE8AC, 0xE0AE,
+    0xC8AE, 0x0000, 0x0000, 0x0000, 0xA8B1, 0xC8B1, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD0B1,
+    0x988B, 0x0000, 0x0000, 0x0000, 0xB0B1, 0xE0B0, 0xE0B0, 0xE0B0,
+    0xE0B0, 0xE0B0, 0x0000, 0x0000, 0xC8AE, 0xE8AE, 0xE0AC, 0xE0AC,
+    0x986B, 0xE8AC, 0xE0AA, 0xE0AA, 0xE8C8, 0xE0A8, 0xE0C8, 0xE0A8,
+    0xD127, 0xE965, 0xE145, 0xE9C5, 0xE9C5, 0xEA85, 0xF285, 0xC165,
+    0x0000, 0x0000, 0x0000, 0x9AA3, 0xFC85, 0x62A3, 0x0000, 0xCC84,
+    0xF725, 0xF725, 0xCD65, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x9CE5, 0x4DA8, 0x6E28, 0x6E28, 0xCD65,
+    0x3222, 0xCE86, 0x0000, 0x0000, 0x0000, 0x0000, 0xFC65, 0xF725,
+    0xFE85, 0xF565, 0xCB84, 0xFC85, 0xF465, 0xFC85, 0xFB65, 0xF285,
+    0x0000, 0x0000, 0x1842, 0xE165, 0xE906, 0xC88A, 0x0000, 0x0000,
+    0x988B, 0xE0AA, 0xE0AA, 0xE0AC, 0xE8AC, 0xC88E, 0xE0AE, 0xE0AE,
+    0xE8AE, 0xE8B0, 0x608B, 0x0000, 0x0000, 0x1842, 0xC8B1, 0x608B,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x588B,
+    0xB0D1, 0x0000, 0x0000, 0x0000, 0x1842, 0xE8B0, 0xC8B1, 0xE0B0,
+    0xE0B0, 0xE0B0, 0x1842, 0xE0B0, 0xE0B0, 0xE0B0, 0xE8AE, 0xC8B1,
+    0x0000, 0x0000, 0xE0AC, 0xE0AC, 0xE8AA, 0x988B, 0x0000, 0x0000,
+    0xE0AA, 0xE106, 0xE906, 0xE165, 0xE145, 0xE1A6, 0xF285, 0xF365,
+    0xF365, 0x0000, 0x0000, 0x0000, 0x0000, 0xCB84, 0xFC65, 0x0000,
+    0xFE65, 0xF725, 0xFF25, 0xCC84, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x6AA3, 0x4DA8, 0x4DA8, 0x8E67,
+    0x8667, 0xA6A7, 0x9CE5, 0x0000, 0x0000, 0x0000, 0x0000, 0xFE65,
+    0xFE65, 0xFE65, 0xCC64, 0xFC85, 0x0000, 0xC165, 0xF365, 0xFB65,
+    0xEA85, 0xE9C5, 0x5064, 0x0000, 0x98E4, 0xE906, 0xE0E7, 0xE0AA,
+    0x0000, 0x0000, 0x0000, 0xE0AC, 0xE8AC, 0xE0AC, 0xC8AE, 0xE0AE,
+    0xE8AE, 0xE0B0, 0xC8B1, 0xE0B0, 0x0000, 0x0000, 0x0000, 0xA8B1,
+    0xA8D1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x90D1, 0x90D1, 0x0000, 0x0000, 0x0000, 0xC8B1, 0xB0D1, 0xA8D1,
+    0xC8B1, 0xE8B0, 0xC8B1, 0xE0B0, 0xE0B0, 0xE0B0, 0xE0AE, 0x5884,
+    0x0000, 0x1842, 0xD08E, 0xE8AC, 0xE0AC, 0xC88A, 0x0000, 0x588B,
+    0xE8C8, 0xE0E7, 0xE0E7, 0xE906, 0xC0C6, 0xC0C6, 0xE108, 0xE9C5,
+    0xEA85, 0xF365, 0xF285, 0x0000, 0x0000, 0x0000, 0x0000, 0xF485,
+    0xCB84, 0xFE65, 0xF725, 0xF725, 0x5864, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4DA8, 0x6E28,
+    0x8667, 0xA6A7, 0xA6C7, 0x3222, 0x0000, 0x0000, 0x0000, 0x62A3,
+    0xFE65, 0xFE85, 0xFD65, 0xFC85, 0x5084, 0x0000, 0x0000, 0xC165,
+    0xF285, 0xF285, 0xE9C5, 0xE9C5, 0xC0C6, 0x986B, 0xE0E7, 0xE108,
+    0xE0C8, 0xE0AA, 0xE8AA, 0xA06B, 0x1842, 0xE0AE, 0xE8AE, 0x608B,
+    0x1842, 0xE0B0, 0xE0B0, 0xE0B0, 0xC8B1, 0xB0D1, 0x0000, 0x0000,
+    0x608B, 0xD0B1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x1842, 0xB0D1, 0x1842, 0x0000, 0x0000, 0x90D1, 0xA8B1, 0xB0D1,
+    0xA8B1, 0xC8B1, 0xD0B1, 0x78F1, 0xA8B1, 0xE0B0, 0xE0B0, 0x0000,
+    0x1842, 0xE0B0, 0xE8AE, 0xE0AE, 0xE0AC, 0xE8AE, 0x0000, 0x988B,
+    0xE0AA, 0xE0AA, 0xE8A8, 0xE8E7, 0x5084, 0x0000, 0x0000, 0xD127,
+    0xE1A6, 0xF285, 0xEA65, 0xF365, 0x0000, 0x0000, 0x0000, 0x0000,
+    0xCB84, 0xFE65, 0xFE65, 0xFF25, 0xF745, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6E08,
+    0x6E28, 0xA6A7, 0xA6C7, 0xD726, 0x1822, 0x0000, 0x0000, 0x0000,
+    0x0000, 0xFE85, 0xFD65, 0xFD65, 0xFC85, 0xF365, 0x5064, 0x0000,
+    0x0000, 0xC985, 0xE9C5, 0xE9C5, 0xE145, 0xE106, 0xE8E7, 0xE0E7,
+    0xE0C8, 0xE0AA, 0xE8C8, 0xE0AA, 0xE0AC, 0xE0AE, 0xE8AC, 0xE0AE,
+    0xE0AE, 0x0000, 0x0000, 0x588B, 0xE8B0, 0xE0B0, 0xC8B1, 0x0000,
+    0x0000, 0x0000, 0x88D1, 0x78F1, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x78D1, 0x78F1, 0x0000, 0x0000, 0x0000, 0x90D1, 0xB0D1,
+    0xA8B1, 0xB0D1, 0x588B, 0x0000, 0x0000, 0xD0B1, 0xC8B1, 0xC8B1,
+    0xC8B1, 0xE8B0, 0xE0AE, 0xE0B0, 0xC88E, 0xE8AE, 0xE0AC, 0xE0AE,
+    0xE0AC, 0xE8AC, 0xE0C8, 0xE0A8, 0x5084, 0x0000, 0x0000, 0x1842,
+    0xE908, 0xE9C5, 0xE9C5, 0xF285, 0xF285, 0x0000, 0x0000, 0x0000,
+    0x0000, 0xCA64, 0xF565, 0xFE85, 0xFE65, 0xF725, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x6628, 0x8667, 0xA6A7, 0xCF26, 0xCF46, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0xFC65, 0xFE65, 0xF585, 0xFD65, 0xFC85, 0xF465,
+    0xF285, 0xEA85, 0xC0C6, 0xE9C5, 0xE145, 0xE965, 0xE106, 0xE108,
+    0xE0C8, 0xE0AA, 0xE8AA, 0xE0AC, 0xE0AC, 0xE0AE, 0xE8AE, 0xE0AE,
+    0xE0AE, 0xE8B0, 0xC8B1, 0x0000, 0x0000, 0x608B, 0xC8B1, 0xC8B1,
+    0xB0B1, 0x0000, 0x0000, 0x78F1, 0x90D1, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x78F1, 0x4931, 0x0000, 0x0000, 0x78F1, 0x88F1,
+    0x90D1, 0xB0B1, 0x0000, 0x0000, 0x0000, 0xA8D1, 0xB0D1, 0xC8B1,
+    0xC8B1, 0xE0B0, 0xE0B0, 0xE0B0, 0xE0B0, 0xE0B0, 0xE0AE, 0xE0AE,
+    0xE0AC, 0xE8AE, 0xE0AC, 0xE0AC, 0xE0AA, 0x0000, 0xC88A, 0xE108,
+    0xE906, 0xE165, 0xE145, 0xE9C5, 0xE9C5, 0x9AA3, 0x0000, 0x0000,
+    0x0000, 0x0000, 0xCB84, 0xFE65, 0xFE65, 0xF725, 0xCE66, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x8667, 0x8667, 0xA6A7, 0xAEC7, 0xCF26, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0xFE65, 0xFD65, 0xFD65, 0xFC85, 0xF465,
+    0xF365, 0xF365, 0xE9C5, 0xE9C5, 0xE145, 0xE165, 0xE906, 0xE108,
+    0xE0C8, 0xE0A8, 0xE0C8, 0xE8AA, 0xE0AA, 0xE0AC, 0xE0AC, 0xE8AE,
+    0xE0AE, 0xE0B0, 0xE0AE, 0xE0B0, 0x588B, 0x0000, 0x0000, 0xD0B1,
+    0xA8B1, 0xB0D1, 0x190B, 0x0000, 0x0000, 0x78D1, 0x190B, 0x0000,
+    0x0000, 0x0000, 0x210B, 0x6111, 0x0000, 0x0000, 0x210B, 0x78F1,
+    0x78D1, 0x78F1, 0x6111, 0x0000, 0x0000, 0x78D1, 0x90D1, 0xB0D1,
+    0xA8D1, 0xD0B1, 0xC8B1, 0xC8B1, 0xC8B1, 0xE8B0, 0xE0AE, 0xE0B0,
+    0xE0AE, 0xE8AE, 0xE0AC, 0xE0AC, 0xE0AA, 0xE8AA, 0xE0A8, 0xE0C8,
+    0xE0A8, 0xE906, 0xE126, 0xE165, 0xE145, 0xE9C5, 0xE1A6, 0x0000,
+    0x0000, 0x0000, 0x0000, 0xFB85, 0xFD85, 0xF665, 0xFE65, 0xFC65,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x6CA6, 0xA6A7, 0xA6C7, 0xCF26, 0xCF26, 0xCD85,
+    0x0000, 0x0000, 0x0000, 0xF465, 0xFD85, 0xFC65, 0x0000, 0xCA64,
+    0xF365, 0xF365, 0xF285, 0xEA85, 0xE9C5, 0xE9C5, 0xE126, 0xE106,
+    0xE8E7, 0xE0E7, 0xE0A8, 0xE0AA, 0xE8AC, 0xE0AE, 0xE0AC, 0xE0AE,
+    0xE8AE, 0xE0B0, 0xE0B0, 0xE0B0, 0xE0B0, 0xE8B0, 0x1842, 0x0000,
+    0xA8D1, 0x90F1, 0x608B, 0x90D1, 0x0000, 0x0000, 0x4951, 0x6911,
+    0x0000, 0x0000, 0x0000, 0x6111, 0x4931, 0x0000, 0x0000, 0x6111,
+    0x6911, 0x0000, 0x6111, 0x78F1, 0x0000, 0x4931, 0x88F1, 0x90D1,
+    0x90D1, 0xA8D1, 0xB0B1, 0xC8B1, 0xC8B1, 0xE0B0, 0xE0B0, 0xE0B0,
+    0xE0B0, 0xE0B0, 0xE0AE, 0xE0AE, 0xE8AC, 0xE0AC, 0xE0AA, 0xE0AA,
+    0xE8C8, 0xE0E7, 0xE0E7, 0xE106, 0xC0C6, 0xD127, 0xE9C5, 0xF265,
+    0x1842, 0x0000, 0x0000, 0x0000, 0xFC85, 0xFD65, 0xF665, 0xFE85,
+    0x9AA3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x3222, 0x8667, 0xAEC7, 0xA6C7, 0xD726,
+    0xCF26, 0xFD65, 0x0000, 0x0000, 0xFC65, 0xF685, 0xC165, 0x0000,
+    0x0000, 0x0000, 0xE1A6, 0xF285, 0xE9C5, 0xE1A6, 0xE108, 0xE108,
+    0xE0A8, 0xC88A, 0x90E4, 0x1842, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x608B, 0xE8B0, 0xE0B0, 0xE0B0, 0xC8B1, 0xC8B1,
+    0x90D1, 0xB0D1, 0x0000, 0x0000, 0x78F1, 0x4931, 0x0000, 0x0000,
+    0x4931, 0x190B, 0x0000, 0x210B, 0x4951, 0x0000, 0x0000, 0x190B,
+    0x5131, 0x4951, 0x0000, 0x4931, 0x6911, 0x608B, 0x6111, 0x78F1,
+    0x78F1, 0x90D1, 0x90D1, 0x78F1, 0x1842, 0x0000, 0x0000, 0x0000,
+    0x1842, 0xA08B, 0xA06B, 0xC8B1, 0xC8B1, 0xE8AE, 0xE0AC, 0xE8AC,
+    0xE0AA, 0xE0AA, 0xE0C8, 0xE8A8, 0x0000, 0x0000, 0x0000, 0xE1A6,
+    0xE9C5, 0x90E4, 0x0000, 0x0000, 0xF285, 0xF485, 0xFC65, 0xFD85,
+    0xF665, 0x1842, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA6A7, 0xA6C7, 0xD726,
+    0xCF26, 0xF725, 0xF725, 0xF725, 0xFD65, 0xFE85, 0xF565, 0xFD85,
+    0xFC65, 0xF485, 0xFB65, 0xF365, 0xF285, 0xE9C5, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1842, 0xB0B1, 0xC8B1,
+    0xB0D1, 0xB0D1, 0x90D1, 0x1842, 0x0000, 0x78F1, 0x6911, 0x0000,
+    0x0000, 0x4931, 0x3191, 0x0000, 0x3191, 0x4951, 0x0000, 0x0000,
+    0x3191, 0x4931, 0x190B, 0x0000, 0x210B, 0x6111, 0x6111, 0x6111,
+    0x6911, 0x78F1, 0x190B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x1842, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0xC88A, 0xE0AA, 0xE8AA, 0xE0A8, 0xE108, 0xE108, 0xE165,
+    0xE145, 0xF285, 0xE1A6, 0xF265, 0xF365, 0xF485, 0xFC65, 0xFD85,
+    0xFD65, 0xFE65, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCD65, 0xD746,
+    0xCF26, 0xF725, 0xCF26, 0xFF25, 0xFE65, 0xFE65, 0xF565, 0xFD65,
+    0xFC85, 0xF465, 0xF365, 0xF365, 0xF285, 0xF265, 0xE145, 0xE108,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0xA8D1, 0x88D1, 0x90D1, 0x78F1, 0x0000, 0x190B, 0x6911,
+    0x190B, 0x0000, 0x2042, 0x3191, 0x2991, 0x3191, 0x1842, 0x0000,
+    0x210B, 0x3191, 0x3191, 0x0000, 0x1842, 0x4931, 0x3191, 0x4951,
+    0x5131, 0x190B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0xE8AA, 0xE8AA, 0xE8C8, 0xE0C8, 0xE0A8, 0xE0E7,
+    0xE906, 0xE165, 0xE165, 0xF285, 0xEA65, 0xF365, 0xFB65, 0xF485,
+    0xFC65, 0xFD85, 0xCC64, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCD65,
+    0xA6C7, 0xF725, 0xF725, 0xFF25, 0xF725, 0xF725, 0xF665, 0xFE65,
+    0xFD85, 0xFC65, 0xF365, 0xF365, 0xEA85, 0xF285, 0xE1A6, 0xE9C5,
+    0xE965, 0xA06B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x78F1, 0x78D1, 0x78F1, 0x6111, 0x0000,
+    0x4931, 0x4931, 0x0000, 0x3191, 0x3191, 0x3191, 0x2991, 0x2212,
+    0x0000, 0x2212, 0x3191, 0x2212, 0x0000, 0x3191, 0x3191, 0x4931,
+    0x2991, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0xC88E, 0xE0AC, 0xE0AA, 0xE8AC, 0xE0C8, 0xE0E7,
+    0xE0E7, 0xE106, 0xE145, 0xE9C5, 0xE9C5, 0xF285, 0xEA65, 0xF365,
+    0xFC85, 0xFD65, 0xF585, 0xCB84, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x5864, 0xD746, 0xCF26, 0xF725, 0xFF25, 0xF725, 0xFE65, 0xFE65,
+    0xFD65, 0xF585, 0xCA64, 0x0000, 0xC165, 0xFB65, 0xE9C5, 0xE9C5,
+    0xE145, 0xE165, 0xE0E7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6111, 0x6111, 0x6111,
+    0x4931, 0x190B, 0x3191, 0x2042, 0x3191, 0x2212, 0x2991, 0x2212,
+    0x21F2, 0x2042, 0x2212, 0x2212, 0x0000, 0x21F2, 0x3191, 0x2991,
+    0x09EE, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x2042, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x608B, 0xE8AE, 0xE0AC, 0xE8AC, 0xE0AA, 0xE0AA,
+    0xE0C8, 0x988B, 0x5884, 0xE945, 0xE165, 0xE9C5, 0xE9C5, 0xF285,
+    0xF365, 0xF465, 0xFC85, 0xFD65, 0x1842, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0xD666, 0xF725, 0xF725, 0xF725, 0xF725, 0xF725,
+    0xFE65, 0xFE85, 0xFD65, 0xF485, 0xF265, 0xF365, 0xEA85, 0xF285,
+    0xE9C5, 0xE9A6, 0xE108, 0xE108, 0xE8C8, 0x1842, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6911,
+    0x4931, 0x4931, 0x3191, 0x2212, 0x3191, 0x3242, 0x21F2, 0x1A53,
+    0x2212, 0x3A42, 0x1A53, 0x12B4, 0x210B, 0x12B4, 0x21F2, 0x1A53,
+    0x2212, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1842, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x608B, 0xE0B0, 0xC8AE, 0xE0AE, 0xE0AC, 0xE0AC,
+    0xE8C8, 0xE108, 0xE0AA, 0xD127, 0xE106, 0xE1A6, 0xE9C5, 0xF265,
+    0xEA85, 0xFB65, 0xF365, 0xF465, 0xFC85, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0xCD65, 0xCF46, 0xFF25, 0xF725, 0xF725,
+    0xFD65, 0xCB84, 0xFD65, 0xFD85, 0xF465, 0xF365, 0xF285, 0xF265,
+    0xE9C5, 0xE1C5, 0xE145, 0xE108, 0xE0C8, 0xE8E7, 0xE0A8, 0xC88A,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x190B, 0x6111,
+    0x4951, 0x4931, 0x3191, 0x3191, 0x3191, 0x2212, 0x1842, 0x1A53,
+    0x1A53, 0x12B4, 0x2042, 0x12B4, 0x1AB4, 0x12B4, 0x1A53, 0x1AB4,
+    0x1A53, 0x1A53, 0x2212, 0x210B, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0xA06B, 0xE0B0, 0xE0AE, 0xA8D1, 0xD08E, 0xE0AC,
+    0xE8AA, 0xE0AA, 0xE0C8, 0xE0A8, 0xE8E7, 0xE106, 0xE165, 0xE1A6,
+    0xD127, 0xF285, 0xF285, 0xF365, 0xFC85, 0xCA64, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF725, 0xF725, 0xF725,
+    0xFE85, 0xCC84, 0x9AA3, 0xF365, 0xFC65, 0xFC85, 0xF365, 0xF365,
+    0xEA65, 0xF285, 0xE165, 0xE965, 0xE106, 0xE108, 0xE8A8, 0x1842,
+    0xE8AA, 0xE8AC, 0x608B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x1842, 0x78F1, 0x90D1, 0x78F1, 0x6111,
+    0x5131, 0x4931, 0x3191, 0x190B, 0x3191, 0x2212, 0x2212, 0x1AB4,
+    0x1A53, 0x12B4, 0x1AB4, 0x0B56, 0x1AB4, 0x1356, 0x0B56, 0x210B,
+    0x12B4, 0x12B4, 0x1A53, 0x1A53, 0x21F2, 0x2212, 0x3191, 0x210B,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x1842, 0xA8D1, 0xE0B0, 0xA8B1, 0xE0B0, 0xE8AE, 0xE0AE,
+    0xE0AC, 0xE0AC, 0xE8AA, 0xE0AA, 0xE0C8, 0xE108, 0xE106, 0xE965,
+    0xE906, 0x90E4, 0xE1A6, 0xF365, 0xF365, 0xF465, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCC64, 0xF725,
+    0xFF25, 0xF725, 0xFD65, 0xCA64, 0x0000, 0xCA64, 0xF365, 0xF365,
+    0xF285, 0xF265, 0xE9C5, 0xE145, 0x1842, 0xE106, 0xE8C8, 0xE0AA,
+    0x0000, 0x5084, 0xE8AA, 0xE0AC, 0xE8AE, 0xE0B0, 0xE0AE, 0xE0B0,
+    0xC8B1, 0xA8D1, 0xB0B1, 0xA8D1, 0xB0B1, 0x88D1, 0x78F1, 0x6111,
+    0x0000, 0x4931, 0x3191, 0x3191, 0x3191, 0x2212, 0x2212, 0x1A53,
+    0x12B4, 0x12B4, 0x1AB4, 0x0B56, 0x1356, 0x1356, 0x1356, 0x0B56,
+    0x1356, 0x1356, 0x12B4, 0x1AB4, 0x210B, 0x09EE, 0x2212, 0x2212,
+    0x3191, 0x3191, 0x2991, 0x4931, 0x210B, 0x190B, 0x210B, 0x78D1,
+    0x78F1, 0xB0B1, 0xB0D1, 0xC8B1, 0x0000, 0x0000, 0xE8AE, 0xE0AE,
+    0xE0AE, 0x986B, 0xE8AA, 0xE0AA, 0xE8C8, 0xE0A8, 0xE0C8, 0xE106,
+    0x0000, 0x988B, 0xC965, 0xE9C5, 0xF285, 0xF365, 0xE1A6, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0xFE65, 0xF725, 0xFE65, 0xFE65, 0xFD85, 0xCB84, 0xF465, 0xFC85,
+    0xF365, 0x9AA3, 0xF285, 0xE9C5, 0x5884, 0x0000, 0xC0C6, 0xE0E7,
+    0xE0C8, 0xE108, 0xE0AA, 0xE8AC, 0xE0AC, 0xE0AE, 0xE8AE, 0xE0B0,
+    0xE0B0, 0xE0B0, 0xB0B1, 0x78F1, 0xB0D1, 0x90D1, 0x0000, 0x0000,
+    0x0000, 0x1842, 0x5131, 0x4931, 0x3191, 0x2212, 0x2212, 0x09EE,
+    0x0000, 0x1356, 0x0B56, 0x1356, 0x1356, 0x0BF8, 0x0BD8, 0x0000,
+    0x0BF8, 0x0BD8, 0x1356, 0x0B56, 0x1AB4, 0x0333, 0x0000, 0x0000,
+    0x0000, 0x2212, 0x3191, 0x4951, 0x3191, 0x6111, 0x6111, 0x90D1,
+    0x88D1, 0xB0D1, 0xA8B1, 0xD0B1, 0xC8B1, 0xE0B0, 0xA8D1, 0xE0B0,
+    0xE8AE, 0x588B, 0x0000, 0x988B, 0xE8AA, 0xE0AA, 0xC88A, 0xE0E7,
+    0xE8E7, 0xE1A6, 0x90C4, 0xE9C5, 0xEA85, 0xF365, 0xF285, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0xCB84, 0xF665, 0xFE65, 0xFD65, 0xF485, 0xFC65,
+    0xF365, 0x90C4, 0xF285, 0xF285, 0xE0E8, 0x0000, 0x0000, 0x5084,
+    0xE8C8, 0xE0A8, 0xE0C8, 0xE0AA, 0x5884, 0x0000, 0xE8AE, 0xE0AE,
+    0xC88E, 0xE0B0, 0xC8B1, 0xC8B1, 0x988B, 0xB0B1, 0x0000, 0x0000,
+    0x0000, 0x6111, 0x4931, 0x4951, 0x3191, 0x3191, 0x3191, 0x2212,
+    0x0000, 0x1842, 0x12B4, 0x1356, 0x1356, 0x0BD8, 0x0BF8, 0x0479,
+    0x0000, 0x0000, 0x0BD8, 0x0BF8, 0x1356, 0x1356, 0x12B4, 0x1AB4,
+    0x210B, 0x0000, 0x0000, 0x3191, 0x2991, 0x3191, 0x4931, 0x6911,
+    0x78F1, 0x0000, 0x90D1, 0xA8D1, 0x0000, 0xD0B1, 0xC8B1, 0xE0B0,
+    0xE8AE, 0xE0B0, 0x0000, 0x0000, 0x0000, 0xE0AC, 0xE0A8, 0xE0AA,
+    0xC88A, 0xE926, 0xE106, 0xE165, 0xE9C5, 0xF285, 0x986B, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9AA3, 0xF485, 0xFD65,
+    0xFB65, 0xF365, 0xEA85, 0xF285, 0xE9C5, 0xD927, 0x90C4, 0x5884,
+    0x5084, 0xE8E7, 0xE0C8, 0xE8AC, 0x0000, 0x0000, 0x986B, 0xE0AE,
+    0xC8AE, 0x0000, 0xE0B0, 0xE8B0, 0xC8B1, 0xD0B1, 0x608B, 0x0000,
+    0x1842, 0x78F1, 0x6911, 0x1842, 0x210B, 0x4931, 0x3191, 0x2212,
+    0x0000, 0x0000, 0x09EE, 0x1356, 0x1356, 0x0BD8, 0x0BD8, 0x0479,
+    0x0C99, 0x0000, 0x0000, 0x09EE, 0x0BF8, 0x0BD8, 0x1356, 0x0000,
+    0x12B4, 0x1AB4, 0x2212, 0x0000, 0x0000, 0x4951, 0x4931, 0x6111,
+    0x6111, 0x6111, 0x0000, 0xB0B1, 0xA8D1, 0x0000, 0x0000, 0x1842,
+    0xE0B0, 0xE0B0, 0xE8AE, 0x0000, 0x0000, 0x0000, 0xC88E, 0xE0AA,
+    0xE0C8, 0xE108, 0xE108, 0xE906, 0xE108, 0x988B, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x1842, 0x98C4, 0xC185, 0xE9A6, 0xE1A6, 0xD127, 0xE965,
+    0xE108, 0xE108, 0xE0C8, 0xE0AA, 0x5084, 0xD08E, 0x0000, 0xE8AE,
+    0xE0AE, 0xE0B0, 0x0000, 0xA8D1, 0xC8B1, 0xC8B1, 0xB0B1, 0x90D1,
+    0x1842, 0x90F1, 0x4931, 0x0000, 0x0000, 0x3191, 0x2991, 0x3191,
+    0x0000, 0x0000, 0x0000, 0x1A73, 0x0B56, 0x0BD8, 0x0BF8, 0x0C79,
+    0x0479, 0x0C79, 0x0000, 0x0000, 0x0000, 0x0479, 0x0BD8, 0x0BF8,
+    0x09EE, 0x0000, 0x210B, 0x1A53, 0x09EE, 0x2042, 0x3191, 0x4951,
+    0x4931, 0x6911, 0x0000, 0x0000, 0x90F1, 0xB0D1, 0x986B, 0xB0D1,
+    0x588B, 0xD08E, 0xE0AE, 0xE0B0, 0xC8AE, 0xC88E, 0xD0AE, 0xC88E,
+    0xC88A, 0xC8AE, 0x5884, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x2042, 0x1842, 0x0000, 0x1842, 0xE108, 0xC88E, 0xE0AC,
+    0xE8AC, 0xE0B0, 0xE0B0, 0xE0B0, 0x988B, 0xE0B0, 0xD0B1, 0xC8B1,
+    0xA8B1, 0xB0D1, 0x6911, 0x0000, 0x0000, 0x0000, 0x3191, 0x3191,
+    0x3191, 0x0000, 0x0000, 0x0000, 0x09EE, 0x0BF8, 0x0BD8, 0x0479,
+    0x0C79, 0x0479, 0x0C79, 0x0000, 0x0000, 0x0000, 0x0000, 0x0479,
+    0x0BF8, 0x0BD8, 0x0000, 0x0000, 0x0000, 0x1A73, 0x2991, 0x3191,
+    0x3191, 0x6111, 0x4931, 0x4931, 0x78F1, 0xB0B1, 0xA8D1, 0xB0D1,
+    0x90D1, 0xD0B1, 0x1842, 0x0000, 0x0000, 0x608B, 0x1842, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x5884, 0xE8AA, 0xE8C8, 0xE0AC,
+    0xE0AC, 0xE8AE, 0xE0AE, 0xE0B0, 0xE0B0, 0xE0B0, 0xC8B1, 0xC8B1,
+    0xA8B1, 0xB0D1, 0x90D1, 0x78F1, 0x0000, 0x0000, 0x2991, 0x4931,
+    0x3191, 0x0000, 0x0000, 0x0000, 0x0000, 0x1A53, 0x0B56, 0x0BF8,
+    0x0BD8, 0x0C99, 0x0479, 0x0C79, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0333, 0x0BD8, 0x1356, 0x210B, 0x0000, 0x09EE, 0x2212, 0x2212,
+    0x3191, 0x4931, 0x4931, 0x6911, 0x6111, 0x90D1, 0x90F1, 0xB0D1,
+    0xA8B1, 0xB0D1, 0xC8B1, 0xE0B0, 0x5884, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0xE8C8, 0xE108, 0xE0A8, 0xE0AA,
+    0xE0AA, 0xE8AC, 0xE0AC, 0xE8AE, 0xC8AE, 0xE0B0, 0xE0B0, 0xE0B0,
+    0xC8B1, 0xD0B1, 0xB0D1, 0x90D1, 0x78D1, 0x78F1, 0x4951, 0x4931,
+    0x3191, 0x3191, 0x0000, 0x0000, 0x0000, 0x0000, 0x09EE, 0x0BF8,
+    0x0BD8, 0x0479, 0x0C79, 0x0479, 0x0C79, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0BF8, 0x0BD8, 0x1356, 0x0333, 0x1A53, 0x2212,
+    0x3191, 0x2991, 0x3191, 0x4931, 0x6111, 0x78F1, 0x78F1, 0x90D1,
+    0xA8B1, 0xD0B1, 0xC8B1, 0xE0B0, 0xE0B0, 0xE0B0, 0xC8B1, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0xC0C6, 0xE106, 0xE108, 0xE0C8, 0xE0A8,
+    0xE8C8, 0xE0AC, 0xE0AC, 0xE0AE, 0xC8B1, 0x0000, 0xE8AE, 0xE0B0,
+    0xC8B1, 0xC8B1, 0xA8B1, 0xB0D1, 0x90D1, 0x88D1, 0x6111, 0x6111,
+    0x4951, 0x4931, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0A0E,
+    0x1356, 0x0BD8, 0x0BF8, 0x0C79, 0x0479, 0x0C79, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x09EE, 0x1356, 0x1356, 0x1A53, 0x1A53,
+    0x2212, 0x2212, 0x3191, 0x4931, 0x4931, 0x6911, 0x6111, 0x1842,
+    0x6911, 0xB0D1, 0xA8B1, 0xD0B1, 0xC8B1, 0xE0B0, 0xE8AE, 0xE0B0,
+    0xE0AE, 0x988B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0xE1A6, 0xE145, 0xE965, 0xE0E7, 0xE0E7,
+    0xE0A8, 0xE8AA, 0xE0AA, 0xE8AC, 0xC8AE, 0xC88E, 0xE0AE, 0xE0B0,
+    0xB0D1, 0xE0B0, 0xD0B1, 0x1842, 0x90D1, 0xB0D1, 0x78D1, 0x78F1,
+    0x6111, 0x6911, 0x190B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x1AB4, 0x1356, 0x0B56, 0x0BD8, 0x0BD8, 0x0C79, 0x0479, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1356, 0x1AB4, 0x12B4,
+    0x2212, 0x2212, 0x2991, 0x0000, 0x3191, 0x6111, 0x4931, 0x78F1,
+    0x78F1, 0x90D1, 0x90D1, 0xC8B1, 0xC8B1, 0xE0B0, 0xE0B0, 0xE0B0,
+    0xE0AE, 0xE0AE, 0xE0AC, 0xE8AE, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x5084, 0xF285, 0xE9C5, 0xE965, 0xE106, 0xE0E7,
+    0xE0C8, 0xE8A8, 0xE0C8, 0xE0AC, 0xE0AC, 0xE8AE, 0xE0AE, 0xC8B1,
+    0xE0B0, 0xA8B1, 0xC8B1, 0xD0B1, 0x0000, 0xA8D1, 0x90D1, 0x90D1,
+    0x78F1, 0x6111, 0x4931, 0x4951, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x12B4, 0x12B4, 0x1356, 0x1356, 0x0BF8, 0x0BD8, 0x0BF8,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0B33, 0x12B4, 0x1AB4,
+    0x1A53, 0x2212, 0x3191, 0x3191, 0x0000, 0x4931, 0x4931, 0x4931,
+    0x6911, 0x78F1, 0x90D1, 0x90F1, 0xA8D1, 0xC8B1, 0xD0B1, 0xE0B0,
+    0xC8B1, 0xE0B0, 0xE8AE, 0xE0AC, 0xE0AC, 0xE0AC, 0x5884, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0xCA64, 0xF365, 0xE9C5, 0xE9C5, 0xE145, 0xE165,
+    0xE8E7, 0xE108, 0xE0A8, 0xE0AC, 0xE0AA, 0xE8AC, 0xE0AC, 0xE8AE,
+    0xC8B1, 0xE0B0, 0x988B, 0xE0B0, 0xD0B1, 0xC8B1, 0xA8B1, 0xB0D1,
+    0x90D1, 0x78F1, 0x608B, 0x6911, 0x4951, 0x4931, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x1AB4, 0x12B4, 0x1AB4, 0x0B56, 0x1356, 0x0BD8,
+    0x0BF8, 0x0000, 0x0000, 0x0000, 0x0000, 0x09EE, 0x1356, 0x12B4,
+    0x1A53, 0x1A53, 0x2212, 0x2212, 0x3191, 0x4931, 0x4931, 0x6111,
+    0x6111, 0x78F1, 0x78D1, 0xB0D1, 0x90D1, 0xC8B1, 0xC8B1, 0xC8B1,
+    0xE0B0, 0xC8AE, 0xE0AE, 0xE8AE, 0xE0AC, 0xE0AC, 0xE0AA, 0xE8AA,
+    0xC88A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0xF365, 0xF365, 0xF285, 0xF285, 0xE9C5, 0xE145,
+    0xE106, 0xE106, 0xE0C8, 0xE0C8, 0x90C4, 0x608B, 0xE8AA, 0xE0AE,
+    0x0000, 0xE0B0, 0xE0AE, 0xC8B1, 0xE0B0, 0xE0B0, 0xB0D1, 0xA8B1,
+    0xB0D1, 0x88D1, 0x0000, 0x0000, 0x4931, 0x6111, 0x3191, 0x190B,
+    0x0000, 0x0000, 0x0000, 0x1A73, 0x1A53, 0x1AB4, 0x12B4, 0x1356,
+    0x1356, 0x0BD8, 0x0000, 0x0000, 0x0000, 0x0000, 0x12B4, 0x1AB4,
+    0x12B4, 0x0000, 0x0000, 0x2212, 0x3191, 0x4931, 0x3191, 0x4931,
+    0x6911, 0x78F1, 0x78F1, 0x90D1, 0x78F1, 0x0000, 0xB0B1, 0xC8B1,
+    0x0000, 0xC8B1, 0xE8AE, 0xE0AE, 0xE8AC, 0xE0AC, 0xE0AA, 0xE0AA,
+    0xE8C8, 0xE0A8, 0xE0C8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0xF485, 0xFC65, 0xF365, 0xF365, 0xF285, 0xEA85,
+    0xE945, 0xE165, 0xE106, 0xE108, 0xE0C8, 0xE8AA, 0xE0AC, 0xE0AC,
+    0xE0AC, 0xE0B0, 0xE8AE, 0xE0B0, 0xE0B0, 0xE0B0, 0xC8B1, 0xD0B1,
+    0xA8B1, 0xB0D1, 0x90F1, 0x608B, 0x0000, 0x0000, 0x4931, 0x4931,
+    0x3191, 0x0000, 0x0000, 0x0000, 0x2212, 0x1AB4, 0x12B4, 0x1AB4,
+    0x12B4, 0x1356, 0x1356, 0x0000, 0x0000, 0x0000, 0x12B4, 0x12B4,
+    0x1A53, 0x0000, 0x0000, 0x0000, 0x3191, 0x2212, 0x4931, 0x4951,
+    0x4931, 0x78D1, 0x78F1, 0x90F1, 0x90D1, 0x78D1, 0xA8D1, 0xD0B1,
+    0xA8B1, 0xA8D1, 0xE0B0, 0xE0B0, 0xE0AE, 0xE8AE, 0xE0AC, 0xE0AC,
+    0xE0AA, 0xE8AA, 0xE0A8, 0xE108, 0xE108, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0xFC65, 0xFD85, 0xF465, 0xF365, 0xF285, 0xEA65,
+    0xE9C5, 0xE9C5, 0xE108, 0xE106, 0xE0E7, 0xE0E7, 0xE8C8, 0xE0AA,
+    0xE0AA, 0xE0AC, 0xE8AC, 0xE0AE, 0xE0AE, 0xE0B0, 0xE0B0, 0xE0B0,
+    0xC8B1, 0xC8B1, 0xB0B1, 0xA8D1, 0x90D1, 0x0000, 0x0000, 0x0000,
+    0x4931, 0x4951, 0x1842, 0x0000, 0x3191, 0x2212, 0x2212, 0x1A53,
+    0x1A53, 0x12B4, 0x1A53, 0x1AB4, 0x12B4, 0x0000, 0x0000, 0x1AB4,
+    0x1A53, 0x09EE, 0x0000, 0x0000, 0x3191, 0x3191, 0x3191, 0x4931,
+    0x4931, 0x6911, 0x6111, 0x78F1, 0x90D1, 0xB0D1, 0xA8D1, 0xC8B1,
+    0xD0B1, 0xE0B0, 0xE0B0, 0xE0B0, 0xE0AE, 0xE8AE, 0xE0AC, 0xE0AC,
+    0xE0AA, 0xE8AA, 0xE0A8, 0xE0C8, 0xE0E7, 0xE906, 0xE108, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0xFD65, 0xF585, 0xFC65, 0xFC85, 0xF365, 0xF365,
+    0xEA85, 0xF285, 0xD127, 0x0000, 0xE108, 0xE906, 0xE0E7, 0xE0A8,
+    0xE0C8, 0xE8AC, 0xE0AC, 0xE0AE, 0xE8AE, 0xE0B0, 0xE0B0, 0xE0B0,
+    0xC8B1, 0x0000, 0x90F1, 0xC8B1, 0x90D1, 0xB0B1, 0x78F1, 0x0000,
+    0x0000, 0x5151, 0x4931, 0x4931, 0x210B, 0x2212, 0x0000, 0x21F2,
+    0x2212, 0x1A53, 0x2212, 0x12B4, 0x0000, 0x1AB4, 0x0000, 0x09EE,
+    0x2212, 0x1A53, 0x0000, 0x0000, 0x190B, 0x3191, 0x3191, 0x4951,
+    0x4931, 0x0000, 0x4931, 0x78F1, 0x90D1, 0xA8D1, 0xB0B1, 0xC8B1,
+    0xC8B1, 0xC8B1, 0xE0B0, 0xE0B0, 0xE0AE, 0xE0B0, 0xE8AE, 0xC8AE,
+    0x1842, 0xE8AC, 0xE0AA, 0xE0A8, 0xE0C8, 0xE926, 0xE106, 0xE145,
+    0xE165, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0xCB84, 0xFE85, 0xFD65, 0xF565, 0xFC85, 0xF465,
+    0xF365, 0xFB65, 0xE9C5, 0xE1A6, 0x0000, 0x0000, 0xE0E7, 0xE0AA,
+    0x0000, 0x0000, 0xC88A, 0xE0AC, 0xE8AC, 0xE0AE, 0xE0AE, 0xE0B0,
+    0xE0B0, 0x988B, 0x0000, 0x0000, 0xB0D1, 0x78D1, 0x0000, 0x88D1,
+    0x78F1, 0x0000, 0x1842, 0x6911, 0x4931, 0x4951, 0x210B, 0x0000,
+    0x3191, 0x2212, 0x2991, 0x2212, 0x21F2, 0x0000, 0x2212, 0x3191,
+    0x2212, 0x21F2, 0x190B, 0x0000, 0x210B, 0x3191, 0x190B, 0x0000,
+    0x5131, 0x1842, 0x0000, 0x0000, 0x78F1, 0x90D1, 0x90F1, 0xB0D1,
+    0xB0B1, 0xC8B1, 0x988B, 0x0000, 0x5884, 0xE8AE, 0xE8AE, 0x5084,
+    0x0000, 0xC88E, 0xE8AA, 0xE0AA, 0xE8C8, 0xE0E7, 0xE0E7, 0xE145,
+    0xE965, 0xE9C5, 0xC165, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0xF725, 0xFE65, 0xF685, 0xFD65, 0xFD85,
+    0xF465, 0xFC85, 0xEA65, 0xF285, 0xE9C5, 0xC985, 0x588B, 0xE106,
+    0xE8AA, 0x0000, 0x0000, 0xC8AE, 0xE0AA, 0xE0AC, 0xE0AC, 0xE8AE,
+    0xE0AE, 0xE8B0, 0x1842, 0x0000, 0x0000, 0x78D1, 0xB0D1, 0x0000,
+    0x0000, 0x90D1, 0x78F1, 0x0000, 0x6111, 0x6911, 0x4951, 0x0000,
+    0x0000, 0x4931, 0x3191, 0x2991, 0x3191, 0x21F2, 0x0000, 0x210B,
+    0x2991, 0x2212, 0x3191, 0x2042, 0x0A0E, 0x4931, 0x210B, 0x0000,
+    0x4951, 0x4931, 0x0000, 0x0000, 0x0000, 0x88D1, 0xB0D1, 0xA8B1,
+    0xB0D1, 0xC8B1, 0xC8B1, 0xE0B0, 0x0000, 0x0000, 0xC88E, 0xE8AE,
+    0x988B, 0x0000, 0xE0AC, 0xE0AA, 0xE8C8, 0xE108, 0xE0E7, 0xE106,
+    0xE145, 0xE9C5, 0xE9C5, 0xEA85, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x9AA3, 0xFE65, 0xFE65, 0xFD65, 0xFD85,
+    0xF465, 0xFC85, 0xF365, 0xF365, 0xF265, 0xEA85, 0xE145, 0xD127,
+    0xE906, 0xE108, 0x0000, 0x0000, 0xE0AA, 0xE0AA, 0xE0AA, 0xE8AC,
+    0xC8AE, 0x1842, 0xE8AE, 0x588B, 0x0000, 0x0000, 0x0000, 0xC8B1,
+    0x90D1, 0x0000, 0x0000, 0x90D1, 0x78F1, 0x78F1, 0x6111, 0x4931,
+    0x0000, 0x0000, 0x3191, 0x4931, 0x3191, 0x2991, 0x3191, 0x0000,
+    0x0000, 0x3191, 0x3191, 0x2991, 0x3191, 0x4951, 0x210B, 0x0000,
+    0x0000, 0x6111, 0x1842, 0x0000, 0x0000, 0x0000, 0x90D1, 0x90F1,
+    0x2042, 0xD0B1, 0xC8B1, 0xE0B0, 0xE0B0, 0xA8D1, 0x0000, 0xE8AE,
+    0xE0AC, 0xC88E, 0xC8AE, 0xE8AA, 0xE0A8, 0xE8C8, 0xE0A8, 0xE0E7,
+    0xE106, 0xE965, 0xE165, 0xF285, 0xEA65, 0x90C4, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x9AA3, 0xF725, 0xFE65, 0xFE85,
+    0xFD65, 0xF585, 0xFC65, 0xFC85, 0xF365, 0xCA84, 0xE1A6, 0xE9C5,
+    0xE165, 0xE108, 0xE906, 0x5884, 0x986B, 0xE0AA, 0xE0AA, 0xE8AC,
+    0xE0AC, 0xE0AE, 0xE8AE, 0xE0B0, 0xC8B1, 0xB0D1, 0xC8B1, 0xA8B1,
+    0xD0B1, 0xC8B1, 0x608B, 0x0000, 0x0000, 0x78F1, 0x78D1, 0x78F1,
+    0x608B, 0x0000, 0x0000, 0x5151, 0x4931, 0x4951, 0x4931, 0x4951,
+    0x0000, 0x0000, 0x3191, 0x5131, 0x4951, 0x4931, 0x0000, 0x0000,
+    0x0000, 0x6111, 0x6111, 0x608B, 0x588B, 0x608B, 0x608B, 0xA8B1,
+    0xB0D1, 0xC8B1, 0xC8B1, 0xE0B0, 0xE0B0, 0xE0B0, 0xE0B0, 0x986B,
+    0xE0AE, 0xE8AE, 0xC8AE, 0xE0AC, 0xE0AA, 0xE8AC, 0xE0C8, 0xE0E7,
+    0xE106, 0xE145, 0xE165, 0xE9C5, 0xE9C5, 0xFB65, 0x5884, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3222, 0xFE85, 0xF725,
+    0xFE65, 0xFE65, 0xFC65, 0xF465, 0xF365, 0xF365, 0x5884, 0x0000,
+    0xE9C5, 0xE9C5, 0xE145, 0xE106, 0xE8E7, 0xE108, 0xE0C8, 0xE0AA,
+    0xC88A, 0x0000, 0xE0AC, 0xE8AE, 0xC8AE, 0xC8AE, 0x986B, 0xC8AE,
+    0xB0B1, 0xC8B1, 0xC8B1, 0xD0B1, 0xA8D1, 0x608B, 0x0000, 0x90D1,
+    0x78F1, 0x1842, 0x0000, 0x0000, 0x6111, 0x6111, 0x4931, 0x4931,
+    0x5151, 0x0000, 0x0000, 0x0000, 0x4931, 0x6911, 0x190B, 0x0000,
+    0x4951, 0x6911, 0x6111, 0x78F1, 0x78D1, 0x90D1, 0x78F1, 0x90D1,
+    0xB0D1, 0xC8B1, 0xC8B1, 0x1842, 0x0000, 0xE8B0, 0xE8AE, 0xE0B0,
+    0xE0AE, 0xE0AE, 0xE0AC, 0xE8AC, 0xE0AA, 0x988B, 0x0000, 0xE8AA,
+    0xE0E7, 0xE106, 0xE165, 0xE9C5, 0xE9C5, 0xF285, 0xEA65, 0x1842,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF725,
+    0xFE65, 0xF725, 0xF685, 0xFD65, 0xFC85, 0xF485, 0xC165, 0xCA64,
+    0xF285, 0xEA85, 0xE9C5, 0xE9C5, 0xE106, 0xE906, 0xE0E7, 0xE0E7,
+    0xE0C8, 0xC88A, 0xE8AC, 0xE0AC, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0xB0D1, 0xE0B0, 0xA8B1, 0xD0B1, 0xA8D1, 0xB0D1,
+    0x90D1, 0x90D1, 0x0000, 0x0000, 0x0000, 0x78F1, 0x6111, 0x6111,
+    0x6111, 0x6911, 0x0000, 0x0000, 0x0000, 0x6111, 0x6111, 0x6111,
+    0x6911, 0x78F1, 0x4931, 0x78D1, 0x78F1, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x588B, 0xD0B1, 0x988B, 0x1842, 0xE0B0, 0xE0B0,
+    0xE0AE, 0xE8AE, 0xE0AC, 0xE0AC, 0xE0AA, 0xE108, 0xE8AA, 0xC88A,
+    0x90E4, 0xE106, 0xE145, 0xE9C5, 0xE9C5, 0xEA65, 0xF285, 0xFB65,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0xFE65, 0xF725, 0xFE65, 0xFE65, 0xFD65, 0xFD65, 0xF485, 0xF365,
+    0xF265, 0xF365, 0xE9C5, 0xE9C5, 0xE145, 0xE165, 0xE106, 0xE108,
+    0xE0C8, 0xE8AA, 0xE0A8, 0xC8AE, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0xE0B0, 0xC8B1, 0x0000, 0x0000, 0x5884,
+    0xA8B1, 0xB0D1, 0x78D1, 0x0000, 0x0000, 0x0000, 0x78F1, 0x78D1,
+    0x78F1, 0x78D1, 0x6111, 0x0000, 0x0000, 0x0000, 0x4931, 0x78F1,
+    0x6111, 0x190B, 0x0000, 0x0000, 0x78F1, 0x90D1, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA08B, 0xE8AE, 0xE0B0,
+    0xC8B1, 0xE8AE, 0xE0AC, 0xE0AC, 0xE0AA, 0xE8AA, 0xE0A8, 0xE0C8,
+    0xE0A8, 0xD127, 0xE906, 0xE165, 0xE165, 0xE9C5, 0xE9C5, 0xF285,
+    0xEA65, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0xF725, 0xF725, 0xF725, 0xFE65, 0xFE65, 0xFD85, 0xF565,
+    0xFC85, 0xFC65, 0xF365, 0xEA85, 0xD127, 0xE9C5, 0xE965, 0xE165,
+    0xE106, 0xE108, 0xE0AA, 0xE8C8, 0xE8AA, 0xC88A, 0x5084, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0xE0B0, 0xE0B0, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x90D1, 0x78F1, 0x0000, 0x0000, 0x0000, 0x90F1,
+    0x90D1, 0x88F1, 0x90D1, 0x78D1, 0x0000, 0x0000, 0x0000, 0x6111,
+    0x78F1, 0x0000, 0x0000, 0x0000, 0x0000, 0xB0B1, 0xB0D1, 0x1842,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x588B, 0xE0B0, 0xE0B0, 0xE0B0,
+    0xE8AE, 0xC88E, 0xE0AC, 0xE0AC, 0xE8AA, 0xE0AC, 0xE0AA, 0xE0AA,
+    0xE8C8, 0xE108, 0xE106, 0xE165, 0xE145, 0xE9C5, 0xE9C5, 0xEA65,
+    0xF285, 0xF365, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0xCD65, 0xF725, 0xFE85, 0xFE65, 0xFD65, 0xFD65,
+    0xF485, 0xFC65, 0xF365, 0xF365, 0xF285, 0x0000, 0xD127, 0xE9C5,
+    0xE145, 0xE106, 0xE0E7, 0xE108, 0x0000, 0xE8AA, 0xE0AA, 0xE0AA,
+    0xE0AC, 0xE8AE, 0xE0AC, 0xE0AE, 0xE0AE, 0xE0B0, 0xA8D1, 0x0000,
+    0x0000, 0x0000, 0xA06B, 0xC8B1, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x90D1, 0xA8D1, 0x90D1, 0x90F1, 0x78F1, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x88D1, 0x608B, 0x0000, 0x0000, 0x0000, 0x90D1, 0xC8B1,
+    0xB0D1, 0xC8B1, 0xC8B1, 0xE0B0, 0xC8B1, 0xE8B0, 0xE0AE, 0xE0B0,
+    0x0000, 0xC8AE, 0xE8AC, 0xE0AC, 0xE0AC, 0xE0AC, 0xE8AA, 0x0000,
+    0xC88A, 0xE0E7, 0xE0E7, 0xE106, 0xE965, 0xE9C5, 0xE9C5, 0xEA85,
+    0xEA85, 0xF365, 0xC165, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0xCD65, 0xF725, 0xF725, 0xFE65, 0xFE85,
+    0xFD65, 0xF585, 0xFC65, 0xFC85, 0xF365, 0xF365, 0xEA65, 0xF285,
+    0xE9C5, 0xE9C5, 0xE165, 0xE906, 0x1842, 0x0000, 0x0000, 0x0000,
+    0x988B, 0xE8AC, 0xC88E, 0xE0AE, 0xE0AE, 0xE8AE, 0xE0AE, 0xD0B1,
+    0x0000, 0x0000, 0x588B, 0xE0B0, 0xD0B1, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0xA8D1, 0xB0B1, 0xA8D1, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x90D1, 0xB0D1, 0x1842, 0x0000, 0x0000, 0xB0B1,
+    0xA8D1, 0xE0B0, 0xC8B1, 0xE0B0, 0xB0B1, 0xB0D1, 0x1842, 0x0000,
+    0x0000, 0x0000, 0x0000, 0xE0AE, 0xE0AC, 0xE0AC, 0xE8AA, 0xE0AA,
+    0xE0C8, 0xE108, 0xE0E7, 0xE106, 0xE145, 0xE9C5, 0xE9C5, 0xF265,
+    0xEA85, 0xFB65, 0xFB65, 0x62A3, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x9AA3, 0xF725, 0xFF25, 0xF725,
+    0xFE85, 0xFE65, 0xFD65, 0xF565, 0xFC85, 0xF465, 0xF365, 0xFB65,
+    0xEA85, 0xF265, 0xE145, 0xE165, 0xE0A8, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xC8AE, 0xC88E, 0xE8AE,
+    0xC8AE, 0x0000, 0x986B, 0xE8B0, 0xE0B0, 0x988B, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x588B, 0x90D1, 0x608B, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x988B, 0xB0B1, 0xC8B1, 0x1842, 0x0000,
+    0xD0B1, 0xD0B1, 0xC8B1, 0x988B, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0xA06B, 0xE0AC, 0xE8AA, 0xE0AA,
+    0xE0C8, 0xE0E7, 0xE8E7, 0xE106, 0xE106, 0xE165, 0xE965, 0xE9C5,
+    0xEA85, 0xF365, 0xF365, 0xFC65, 0x5084, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3222, 0xF725, 0xF725,
+    0xF725, 0xF725, 0xFE65, 0xFE85, 0xF465, 0xFC85, 0xF465, 0xFC85,
+    0xF265, 0xF365, 0xF285, 0xE9C5, 0xE965, 0x1842, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xC88E, 0xC8AE, 0x986B,
+    0xE0AC, 0xE8AE, 0xC8AE, 0xE0B0, 0xE0AE, 0xE8B0, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xC8B1, 0xC8B1, 0xE0B0,
+    0xA8B1, 0xE0B0, 0xE0B0, 0xC8B1, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE8AA, 0xE0AA,
+    0xE0C8, 0xE108, 0xE0E7, 0xE926, 0xE106, 0xE145, 0xE1A6, 0xE9C5,
+    0xF285, 0xF365, 0xF365, 0xFC65, 0xFC85, 0x5884, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFF25,
+    0xF725, 0xF725, 0xFE65, 0xFE65, 0xCB84, 0x0000, 0x0000, 0xFC65,
+    0xEA85, 0x0000, 0x0000, 0xD127, 0xE9C5, 0xE9C5, 0xE0E8, 0xE165,
+    0xE108, 0xE108, 0x986B, 0x608B, 0x0000, 0x0000, 0xC88A, 0xE8AC,
+    0xE0AC, 0xE0AC, 0xE0AC, 0xE8AE, 0xE0AE, 0xE0AE, 0xC8AE, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x988B, 0xD0B1,
+    0xE0B0, 0xE0B0, 0xE0B0, 0xE0B0, 0xC8B1, 0x588B, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x1842, 0xA06B, 0xD0AE, 0xE8AC, 0xC88E, 0xE0AA,
+    0xE0C8, 0xE8AA, 0x5084, 0x0000, 0x90C4, 0xE965, 0x90C4, 0x0000,
+    0xD927, 0xF285, 0xEA85, 0xF365, 0xFB65, 0xF465, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0xD686, 0xF725, 0xF725, 0xF725, 0xFE65, 0x0000, 0x0000, 0x0000,
+    0xFC85, 0xFC85, 0x5064, 0xEA85, 0xF265, 0xEA85, 0xE9C5, 0xE9C5,
+    0xE165, 0xE965, 0xE106, 0xE106, 0xE0E7, 0xE108, 0xE8C8, 0xE0AA,
+    0xE0AA, 0xE108, 0xE0AC, 0xE8AC, 0xE0AC, 0xE0AE, 0xE8AE, 0xC8B1,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xB0B1,
+    0x588B, 0xE0B0, 0xE0B0, 0xE0B0, 0xE0B0, 0xE0B0, 0xE0AE, 0xE0B0,
+    0xE0AE, 0xE8AE, 0xE0AC, 0xE0AC, 0xE0AC, 0xE108, 0xE8AA, 0xE0AA,
+    0xE0C8, 0xE108, 0xE0C8, 0xC88A, 0x0000, 0xE108, 0xE145, 0xC0C6,
+    0x0000, 0x0000, 0xE9C5, 0xFB65, 0xF365, 0xF465, 0xFC85, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0xCE66, 0xCF26, 0xFF25, 0xF725, 0xFD65, 0x0000, 0x0000,
+    0x0000, 0xF365, 0xFC85, 0xF465, 0xF365, 0xFB65, 0xEA85, 0xF265,
+    0xE9C5, 0xE9C5, 0xE145, 0xE165, 0xE106, 0xE106, 0xE0C8, 0xE8C8,
+    0xE0A8, 0xE0AA, 0xE0C8, 0xE8AA, 0xE0AA, 0xE0AC, 0x986B, 0xE8AE,
+    0x5084, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0xA08B, 0xC8B1, 0x0000, 0xE0B0, 0xE8AE, 0xE0AE, 0xE0AE, 0xE0AE,
+    0xE8AC, 0xE0AE, 0xE0AC, 0xE0AC, 0xE8AA, 0xE0AA, 0xE0A8, 0xE0AA,
+    0xE8C8, 0xE0E7, 0xE0A8, 0xE0E7, 0xE906, 0xE165, 0xE165, 0xE1A6,
+    0x0000, 0x0000, 0x0000, 0x5884, 0xFB65, 0xF485, 0xFC85, 0xF365,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x9CE5, 0xF725, 0xF725, 0xFF25, 0xCC84, 0x0000,
+    0x0000, 0x0000, 0x90C4, 0xF585, 0xFC65, 0xFC85, 0xF365, 0xFB65,
+    0x988B, 0x90C4, 0xE9C5, 0xE9C5, 0xE165, 0xE165, 0xE106, 0xE906,
+    0xE0E7, 0xE108, 0xE0C8, 0xE0AA, 0xE8AA, 0xE0AC, 0xC88E, 0xE0AC,
+    0xE8AC, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0xE8AE, 0x988B, 0x986B, 0xE0AE, 0xE0AE, 0xE8AE,
+    0xE0AC, 0xE0AE, 0xE0AC, 0xE8AC, 0xE0AA, 0xE0AC, 0xE0AA, 0xE8AA,
+    0xE0C8, 0xE108, 0xE0AA, 0xE126, 0xE906, 0xE145, 0xE145, 0xE9C5,
+    0xD127, 0x0000, 0x0000, 0x0000, 0x0000, 0xF485, 0xFC65, 0xFD85,
+    0x9AA3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x3222, 0xD746, 0xF725, 0xD726, 0xCC64,
+    0x0000, 0x0000, 0x0000, 0xFC65, 0xF585, 0xFD65, 0xFC85, 0x9AA3,
+    0x0000, 0x0000, 0xD127, 0xF285, 0xE9C5, 0xE1C5, 0xE145, 0xE145,
+    0xE108, 0xE906, 0xE0E7, 0xE0E7, 0xE0AA, 0xE8C8, 0xE0C8, 0x0000,
+    0xE0AA, 0xE0AC, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0xE8AE, 0xC88E, 0x0000, 0xE0AC, 0xE0AC,
+    0xE8AC, 0xE0AC, 0xE0AA, 0xE0AC, 0xE8AC, 0xE0AA, 0xE0C8, 0xE0A8,
+    0xE8C8, 0xE0E7, 0xE0A8, 0x0000, 0x0000, 0xC0C6, 0xE165, 0xE9C5,
+    0xE9C5, 0xF285, 0x0000, 0x0000, 0x0000, 0x5064, 0xFC85, 0xFD85,
+    0xFD65, 0x1842, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCF26, 0xCF46, 0xF725,
+    0xCB84, 0x0000, 0x0000, 0x0000, 0xFD65, 0xFE65, 0xFD85, 0xFC85,
+    0x0000, 0x0000, 0xC165, 0xF365, 0xF265, 0xF285, 0x90E4, 0x986B,
+    0xE165, 0xE165, 0xE906, 0xE108, 0x0000, 0xD127, 0xE8C8, 0xE108,
+    0xC88A, 0xE8AA, 0x1842, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x5084, 0xE8AE, 0x5884, 0xC88E,
+    0xE0AC, 0xE8AC, 0x1842, 0xE0AC, 0xE0AA, 0xE8AA, 0xE0C8, 0xE0AC,
+    0xC0C6, 0xE108, 0xE0E7, 0xE106, 0xC0C6, 0x0000, 0x0000, 0xD127,
+    0xE9C5, 0xF265, 0xF285, 0x0000, 0x0000, 0x0000, 0x5084, 0xFD65,
+    0xFD65, 0xFE85, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCD65, 0xCF26,
+    0xD726, 0xCC64, 0x0000, 0x0000, 0x0000, 0xFD85, 0xFD65, 0xF585,
+    0xFC65, 0xCA64, 0xC165, 0xFC85, 0xF365, 0xF365, 0xC165, 0x0000,
+    0xE1A6, 0xE9C5, 0xE165, 0x90E4, 0x0000, 0xC0C6, 0xE8E7, 0xE0E7,
+    0xE8A8, 0xE0C8, 0xE0A8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE0AC, 0xE8AC,
+    0xE0AA, 0xE0AA, 0xE0AA, 0x988B, 0x0000, 0xA06B, 0xE0C8, 0xE8A8,
+    0xC88A, 0x0000, 0xC8AA, 0xE106, 0xE126, 0xE165, 0x1842, 0x98C4,
+    0xE9A6, 0xF285, 0xEA85, 0xF365, 0x0000, 0x0000, 0x0000, 0x9AA3,
+    0xFC85, 0xFE85, 0xF465, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD565,
+    0xA6C7, 0xCD85, 0xCC84, 0x9AA3, 0x0000, 0x0000, 0x1822, 0xFE65,
+    0xFE85, 0xF565, 0xFC85, 0xFD65, 0xFC85, 0xFC85, 0x90C4, 0x0000,
+    0x5084, 0xF285, 0xE9C5, 0x0000, 0x0000, 0xE108, 0xE145, 0xE165,
+    0xE108, 0xC0C6, 0xE0C8, 0xC0C6, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xC88A,
+    0xE8AA, 0xE0AC, 0xE0AA, 0xE0AA, 0xE8C8, 0xC88A, 0x0000, 0x0000,
+    0xE0E7, 0xE906, 0x1842, 0x0000, 0x988B, 0xE9C5, 0xE1A6, 0xE9C5,
+    0xE1A6, 0xCA64, 0xF285, 0xF365, 0xE1A6, 0x0000, 0x0000, 0x0000,
+    0xCB84, 0xFD65, 0xFE85, 0xCC64, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x62A3, 0xD726, 0xCE86, 0x62A3, 0xD565, 0x0000, 0x0000, 0x0000,
+    0xCC64, 0xFE85, 0xFD65, 0xFD65, 0xFD85, 0xF465, 0xCA64, 0xF285,
+    0xF365, 0xF365, 0xF265, 0xEA85, 0xC165, 0xE9C5, 0xE1A6, 0xE165,
+    0x90C4, 0x0000, 0xE108, 0xE906, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0xE0AA, 0xE8C8, 0x0000, 0x90E4, 0xE0E7, 0xE8A8, 0xE108,
+    0x0000, 0xE106, 0xE126, 0xE165, 0xE108, 0x0000, 0x588B, 0xE9C5,
+    0xE9C5, 0xF285, 0xF265, 0xF365, 0xF365, 0x0000, 0x0000, 0x0000,
+    0xCA64, 0xCB84, 0xCD85, 0xFE65, 0x5064, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0xA6C7, 0xD726, 0x62A3, 0x9CE5, 0xF665, 0xFD65,
+    0x0000, 0xFE65, 0xFE65, 0xF665, 0xFE65, 0xFE85, 0xFD65, 0xF585,
+    0xFC65, 0xFC85, 0xF365, 0x0000, 0xEA85, 0xF365, 0xF285, 0xE1A6,
+    0x0000, 0x0000, 0xE945, 0xE965, 0x90C4, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x5084, 0xE8E7, 0xE0C8, 0x0000, 0x0000, 0xE108,
+    0xE106, 0xE165, 0xE906, 0x5084, 0xE108, 0xE9C5, 0xE9C5, 0xEA65,
+    0xE9C5, 0xF365, 0xF285, 0xF365, 0xFB65, 0xFC85, 0x0000, 0x5084,
+    0xCA64, 0xFB65, 0x5864, 0xFE65, 0xFE85, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0xCD65, 0xA6C7, 0xA6A7, 0x0000, 0xD464,
+    0xCE86, 0xFF25, 0xF725, 0x62A3, 0x0000, 0x9AA3, 0x0000, 0xFC85,
+    0xFD65, 0xFD85, 0xCB84, 0x0000, 0x0000, 0xF265, 0xEA85, 0x5064,
+    0x0000, 0x5884, 0xE9C5, 0xE9C5, 0xD127, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0xC0C6, 0xE108, 0xE8E7, 0x1842,
+    0x0000, 0x5884, 0xE108, 0xE965, 0x0000, 0x0000, 0xD127, 0xF285,
+    0xEA65, 0xF285, 0x90C4, 0x90C4, 0x0000, 0x5884, 0xFC85, 0xFD85,
+    0xCB84, 0xCA64, 0x0000, 0x9AA3, 0xFE85, 0xFD65, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0xCB64, 0xA6C7, 0xA6C7, 0x0000,
+    0x0000, 0x9CE5, 0xF725, 0x9CE5, 0x0000, 0x0000, 0x0000, 0x0000,
+    0xFD65, 0xFE65, 0xF585, 0x0000, 0x0000, 0xFC65, 0xFB65, 0x0000,
+    0x0000, 0x1842, 0xEA85, 0xF285, 0xE9C5, 0xE1C6, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE108, 0xE108, 0xD127,
+    0xE906, 0x5084, 0x0000, 0x0000, 0xE1A6, 0xE9C5, 0x0000, 0x0000,
+    0xF285, 0xF365, 0xFB65, 0x0000, 0x0000, 0x0000, 0x0000, 0x9AA3,
+    0xF565, 0xFC85, 0x0000, 0x0000, 0xCC64, 0xF725, 0xCB84, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8667, 0xA6C7,
+    0x0000, 0xD686, 0xD726, 0x9AA3, 0x0000, 0x0000, 0x0000, 0x0000,
+    0xFC65, 0xFE85, 0xF565, 0xCA64, 0x0000, 0xFD65, 0xF365, 0x0000,
+    0x0000, 0x0000, 0xF285, 0xF365, 0xF265, 0xEA85, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1842, 0xE945,
+    0xE145, 0xD127, 0xE965, 0x5084, 0x0000, 0x0000, 0xE9A6, 0xF285,
+    0x0000, 0x90C4, 0xF365, 0xF365, 0xF285, 0x0000, 0x0000, 0x0000,
+    0x0000, 0xCB84, 0xFD85, 0xF465, 0x0000, 0xFE85, 0xF725, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8667,
+    0x8667, 0xA6A7, 0xA6C7, 0xD686, 0x6AA3, 0x0000, 0x0000, 0x0000,
+    0x1822, 0xF725, 0xFE65, 0xFE85, 0x90C4, 0xF665, 0xFC85, 0x0000,
+    0x0000, 0x0000, 0xF365, 0xFC85, 0xF365, 0xFB65, 0xE1A6, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0xD127, 0xEA65, 0xE9C5, 0xF285, 0xE1A6, 0x0000, 0x0000, 0x0000,
+    0xEA85, 0xF365, 0x0000, 0xFC65, 0xF485, 0xFD65, 0xC165, 0x0000,
+    0x0000, 0x0000, 0x0000, 0xFE65, 0xFE65, 0xFE65, 0xF725, 0xFE65,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x64A6, 0x8667, 0x8667, 0x9CE5, 0xAEC7, 0xD726, 0xCE66, 0xCD65,
+    0xFC85, 0xF725, 0xFE65, 0x0000, 0xFE65, 0xFE65, 0xCC64, 0x0000,
+    0x0000, 0x0000, 0xEA85, 0xFC65, 0xF485, 0xFC65, 0xF365, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0xE1A6, 0xF285, 0xEA85, 0xF265, 0xE1A6, 0x0000,
+    0x0000, 0x0000, 0xF285, 0xF485, 0xFC65, 0xCA64, 0xCB84, 0xF585,
+    0xCB84, 0xCB84, 0xCB84, 0xFE65, 0xFE65, 0x5064, 0xFE85, 0xF725,
+    0x9AA3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x6E08, 0x8667, 0x9CE5, 0xA6C7, 0xCD65, 0xCE86,
+    0xCB84, 0xFF25, 0xF725, 0x0000, 0x62A3, 0xF725, 0xF725, 0xFE65,
+    0xFD85, 0xFD65, 0xF585, 0xFD65, 0xFD85, 0xFD65, 0xF485, 0xCA64,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0xE1A6, 0xF285, 0xF365, 0xFB65, 0xF365,
+    0xEA65, 0xFB65, 0xF365, 0xF365, 0xF485, 0xFD65, 0xFC85, 0x0000,
+    0xF565, 0xFE85, 0x9AA3, 0xFD65, 0xFE65, 0xFF25, 0xCD65, 0xF725,
+    0xD746, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x6E28, 0x6E08, 0x0000, 0x9CE5, 0x62A3,
+    0x9CE5, 0xD726, 0xD726, 0x9AA3, 0x0000, 0xF725, 0xF725, 0xFF25,
+    0xF725, 0xFE85, 0xFE65, 0xFE65, 0xF565, 0xFE65, 0xFD65, 0xF485,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF365, 0xFB65, 0xF465,
+    0xF365, 0xFC85, 0xFC65, 0xF485, 0xFC65, 0xF585, 0xFD65, 0xFE85,
+    0x0000, 0x62A3, 0xFE65, 0xFE65, 0xCC64, 0x9AA3, 0xCB84, 0x3242,
+    0xCF26, 0xD686, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x6AA3, 0x6E08, 0x8667, 0x8667,
+    0x8667, 0xA6C7, 0xA6A7, 0xCE86, 0x0000, 0xF725, 0xCF26, 0xFD85,
+    0xCC64, 0xFD85, 0xCC64, 0xF725, 0xFE65, 0xF725, 0xFE65, 0xFE85,
+    0x5884, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x90C4, 0xF465,
+    0xFC85, 0xFD65, 0xF485, 0xFD65, 0xF365, 0xCB84, 0xFC85, 0xCC64,
+    0xF665, 0xFD65, 0x0000, 0xFE85, 0xFF25, 0xF725, 0xCB64, 0xFE65,
+    0xCF46, 0xFF25, 0x5064, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4DA8, 0x6E28,
+    0x6E08, 0x8667, 0x8667, 0x3222, 0x9CE5, 0xD686, 0xA6C7, 0xD666,
+    0xCD65, 0xCD85, 0xD726, 0xF725, 0xF725, 0xFF25, 0xFE65, 0xFE65,
+    0xCB84, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0xCB84, 0xF565, 0xFC85, 0xFD65, 0xF585, 0xFE65, 0xFD65, 0xF365,
+    0xCB84, 0xFE85, 0xFE65, 0xCC64, 0xCD65, 0xCB84, 0xCE86, 0xF725,
+    0xCF26, 0xD726, 0xCE86, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x34C8,
+    0x2D49, 0x6E28, 0x9CE5, 0x9CE5, 0x6AA3, 0xA6A7, 0xA6C7, 0x9CE5,
+    0x9AA3, 0xCF26, 0xD746, 0xF725, 0xF725, 0xF725, 0xF725, 0xF725,
+    0xFD65, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0xFC65, 0xF685, 0xFD65, 0xFE65, 0xFE65, 0xFE65,
+    0xFE65, 0xF725, 0xFC85, 0x62A3, 0xF725, 0xFF25, 0xCB84, 0x9AA3,
+    0xCD65, 0xCF26, 0xD726, 0x62A3, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x55A8, 0x2D49, 0x0000, 0xA4E5, 0x8667, 0x6628, 0xAEC7,
+    0x9CE5, 0xA6A7, 0xA6C7, 0xD726, 0xCF26, 0xFF25, 0xCF26, 0xF725,
+    0xFE65, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0xFD65, 0xFE65, 0xFE65, 0xF725,
+    0xFE65, 0xF725, 0xF725, 0xF725, 0x9AA3, 0xFE85, 0xCF26, 0xCD65,
+    0xCB84, 0x9CE5, 0xA6C7, 0xAEA7, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x2042, 0x2D49, 0x4DA8, 0x8667, 0x6E08, 0x8667,
+    0x9CE5, 0xA6C7, 0xAEA7, 0xA6C7, 0xA6A7, 0xCF26, 0xCF26, 0xCF26,
+    0xCF26, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFE65, 0xFF25,
+    0xF725, 0xF725, 0xF725, 0xFF25, 0xF725, 0xF725, 0xD686, 0xCF26,
+    0xCF26, 0xD726, 0xA6A7, 0xA6C7, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x6CA6, 0x2D69, 0x2D49, 0x4DA8,
+    0x55A8, 0x6E28, 0x6E28, 0x8667, 0x8667, 0xA6A7, 0xA6C7, 0xA6A7,
+    0xAEC7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0xFC65, 0xF725, 0xCF26, 0xF725, 0xD726, 0xF725, 0xCF26, 0xCF26,
+    0xD686, 0xCF26, 0xA6A7, 0xA6C7, 0x9AA3, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x55A8, 0x2D49,
+    0x2D49, 0x4DA8, 0x4DA8, 0x6E28, 0x6E08, 0x8667, 0x8667, 0xA6C7,
+    0xCD85, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0xCB64, 0xF725, 0xCF26, 0xF725, 0xD726, 0xCF26,
+    0xA6C7, 0xD726, 0xA6A7, 0xAEC7, 0x9CE5, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x6CA6, 0x2D69, 0x2D49, 0x55A8, 0x4DA8, 0x6E28, 0x55A8, 0x8667,
+    0x6AA3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x62A3, 0xD726, 0xA6C7, 0xCF26,
+    0xA6A7, 0xA6C7, 0x8667, 0x8667, 0x6CA6, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x3A22, 0x4DA8, 0x4DA8, 0x6E08, 0x6E28, 0x64A6,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9CE5,
+    0xD565, 0xA6C7, 0xA6A7, 0xAEC7, 0x3222, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000 },
+  { 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x34C8, 0x6CA6, 0x6E28,
+    0x9CE5, 0x9CE5, 0x3222, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6AA3, 0xD585,
+    0xD686, 0xCF26, 0xA6A7, 0x64A6, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6CA6, 0x4DA8, 0x6E28,
+    0x6608, 0x8667, 0x8667, 0xAEC7, 0x9CE5, 0x3242, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6AA3, 0xCD65, 0xF725,
+    0xF725, 0xF725, 0xD726, 0xCF26, 0xD726, 0x9CE5, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4DA8, 0x55A8, 0x6E08,
+    0x6E28, 0x8667, 0x8667, 0xA6A7, 0xA6C7, 0xD726, 0xCF26, 0xCF26,
+    0xCD65, 0x3222, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x3A42, 0xCC64, 0xFE85, 0xFE65, 0xF725,
+    0xFF25, 0xF725, 0xF725, 0xF725, 0xD726, 0xCF26, 0xCF26, 0xCF26,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x55A8, 0x4DA8, 0x6E08,
+    0x6628, 0x8667, 0x8667, 0xA6A7, 0xA6C7, 0xD726, 0xCF26, 0xF725,
+    0xCF26, 0xFF25, 0xF725, 0xF745, 0x9AA3, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x9AA3, 0xFD85, 0xFD65, 0xF665, 0xFE65, 0xFE65,
+    0xFE65, 0xF725, 0xFF25, 0xF725, 0xF725, 0xF725, 0xD726, 0xF725,
+    0xCF26, 0xD666, 0x0000, 0x0000, 0x0000, 0x3222, 0x2D69, 0x55A8,
+    0x6E28, 0x8667, 0x8667, 0xA6A7, 0xAEC7, 0xCF26, 0xA6A7, 0xD726,
+    0xCF26, 0xF725, 0xFF25, 0xF725, 0xF725, 0xF725, 0xFE65, 0xCC64,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0xCB84, 0xFB65, 0xF485, 0xFC65, 0xFD85, 0xF565, 0xFE85,
+    0xFD65, 0xFE65, 0xF665, 0xF725, 0xF725, 0xFF25, 0xF725, 0xF725,
+    0xCF26, 0xD726, 0xA6C7, 0x3222, 0x0000, 0x0000, 0x6CA6, 0x6628,
+    0x6E08, 0x8667, 0x8667, 0xA6C7, 0xA6A7, 0xCF26, 0xD726, 0xCF26,
+    0xCF26, 0xF725, 0xFF25, 0xF725, 0xF725, 0xF725, 0xFE65, 0xF665,
+    0xFE65, 0xFE85, 0xCC64, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0xCA64, 0xF365, 0xF365, 0xFC85, 0xF465, 0xFD85, 0xFC65, 0xF585,
+    0xFD65, 0xFE65, 0xFE65, 0xFE65, 0xFE65, 0xF725, 0xF725, 0xF725,
+    0xFF25, 0xF725, 0xCF26, 0xD726, 0x9CE5, 0x0000, 0x1822, 0x6E28,
+    0x4DA8, 0x8E67, 0x8667, 0x0000, 0xA6C7, 0xD726, 0xA6A7, 0xCF26,
+    0xD726, 0xF725, 0xF725, 0xF725, 0xFF25, 0xF725, 0xFE65, 0xFE65,
+    0xFD65, 0xF685, 0xFD65, 0xFD65, 0xF485, 0xCB84, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xC165,
+    0xF285, 0xF265, 0xEA85, 0xF365, 0xF365, 0xFC65, 0xF365, 0xFC85,
+    0xF465, 0xFD85, 0xFD65, 0xFE85, 0xF565, 0xFE65, 0xFE65, 0xF725,
+    0xF725, 0xCC64, 0x0000, 0xF725, 0xCF46, 0xD726, 0x1822, 0x34C8,
+    0x6E28, 0x8667, 0x8667, 0xA6A7, 0x9CE5, 0xA6C7, 0xD666, 0xCF26,
+    0xCF26, 0xFE85, 0x3222, 0xF725, 0xCC64, 0xFE65, 0xFE65, 0xFE65,
+    0xF665, 0xFE85, 0xFD65, 0xFD85, 0xF465, 0xFD85, 0xF465, 0xFC85,
+    0x9AA3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xC0C6, 0xE9C5,
+    0xE9C5, 0xEA85, 0xF265, 0xEA85, 0xF265, 0xF365, 0xF365, 0xFC85,
+    0xF465, 0xFD85, 0xF465, 0xFD85, 0xFD65, 0x9CE5, 0xFE65, 0xFE65,
+    0xFE65, 0xF725, 0xCC64, 0x9CE5, 0xFF25, 0xF725, 0xD746, 0x64A6,
+    0x6CA6, 0x6608, 0x6E28, 0x8667, 0x8667, 0xA6A7, 0xAEC7, 0x0000,
+    0xD666, 0xF725, 0xCD65, 0x0000, 0xFD85, 0xCD65, 0x0000, 0x9CE5,
+    0xFD85, 0xFE65, 0xFD65, 0xFD85, 0xF465, 0xFC85, 0xF365, 0xF365,
+    0xF365, 0xFB65, 0xEA65, 0x90C4, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x90E4, 0xE906, 0xE965,
+    0xE145, 0xE9C5, 0xE1A6, 0xE9C5, 0xE9C5, 0xEA85, 0xF285, 0xF365,
+    0xF365, 0xFC85, 0x5064, 0x0000, 0xCB84, 0xCB84, 0x0000, 0xFD85,
+    0xFD85, 0xCC64, 0x9AA3, 0xF745, 0xF725, 0xFF25, 0xCF26, 0xF725,
+    0x9CE5, 0x6628, 0x6E08, 0x8667, 0x8667, 0xA6C7, 0x0000, 0x62A3,
+    0xD726, 0xF725, 0xF725, 0xF725, 0x0000, 0x3242, 0xFD65, 0x0000,
+    0x0000, 0xFE65, 0xFD85, 0xF565, 0xCB84, 0xFC85, 0xF465, 0xFC85,
+    0xF365, 0xF365, 0xF265, 0xF285, 0xE9C5, 0xF285, 0x5884, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x5084, 0xE126, 0xE108, 0xE106,
+    0xE906, 0xE165, 0xE145, 0xE1C5, 0xE9C5, 0xF285, 0xE9C5, 0x9AA3,
+    0xF265, 0xF365, 0xF285, 0x0000, 0x90C4, 0xFC85, 0x0000, 0x1842,
+    0xFD65, 0xFE65, 0xFE65, 0xFE65, 0x1842, 0xCD65, 0xFF25, 0xF725,
+    0xF725, 0xD686, 0x9CE5, 0x8667, 0x8667, 0xAEA7, 0xA6C7, 0xA6A7,
+    0x0000, 0x6AA3, 0xD726, 0xF725, 0xF725, 0xF725, 0xD686, 0xFE65,
+    0xCC64, 0x0000, 0xCC64, 0x9AA3, 0xFC85, 0xF485, 0x9AA3, 0xCA64,
+    0xFB65, 0xF365, 0xF285, 0xEA65, 0xE9C5, 0xE9C5, 0xE145, 0xE1A6,
+    0xE126, 0x1842, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x1842, 0xE8C8, 0xE8E7, 0xE0A8, 0xE8E7,
+    0xE0E7, 0xE106, 0xE126, 0xE965, 0xE145, 0xE9C5, 0xC0C6, 0xC185,
+    0xE9C5, 0xCA64, 0xC165, 0xCA64, 0x0000, 0xF365, 0xCB84, 0xCB84,
+    0xFC85, 0xFD85, 0xF565, 0xFD85, 0x0000, 0x0000, 0xCD65, 0xF725,
+    0xF725, 0xFF25, 0xCE86, 0x8667, 0x8667, 0xA6A7, 0xA6C7, 0xCF26,
+    0xD726, 0xCC64, 0x64A6, 0xF725, 0xFF25, 0xF725, 0xF725, 0xF725,
+    0xFE65, 0xFE85, 0x9AA3, 0xCB84, 0x0000, 0xF485, 0xFC65, 0xF485,
+    0x0000, 0x9AA3, 0xF285, 0xEA65, 0xE9C5, 0xEA85, 0xE9C5, 0xE9C5,
+    0xE965, 0xE165, 0xE906, 0x90C4, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x988B, 0xE0A8, 0xE8AA, 0xE0C8, 0xE0A8,
+    0xE0C8, 0xE108, 0xE8E7, 0xE126, 0xE906, 0xE945, 0x1842, 0x5084,
+    0xE9A6, 0xF285, 0x90E4, 0x98C4, 0x90E4, 0x9AA3, 0xF365, 0xF465,
+    0xFC85, 0xF565, 0xFC85, 0xFD65, 0xFC85, 0xCC64, 0xCB84, 0xF725,
+    0xF725, 0xF725, 0xFF25, 0xF725, 0x9CE5, 0xA6C7, 0xAEA7, 0xA6C7,
+    0xD726, 0xCF26, 0xCE66, 0xD686, 0xF725, 0xF725, 0xCC64, 0x9AA3,
+    0xCC84, 0xFE65, 0xFD65, 0xFD85, 0xFC65, 0x0000, 0xCB84, 0xCA64,
+    0xEA85, 0xF365, 0xCA64, 0xF265, 0x1842, 0xE9C5, 0xE945, 0xE165,
+    0xE145, 0xE165, 0xE108, 0xE8E7, 0xE0E7, 0xC88A, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0xC8AE, 0xE0AA, 0xE8AA, 0xE0A8, 0xE0AA,
+    0xE0C8, 0xE8A8, 0xE0C8, 0xE0E7, 0xC0C6, 0xC0C6, 0xE0E7, 0xC0C6,
+    0xE945, 0xE165, 0xC165, 0xC185, 0x1842, 0xF285, 0xF265, 0xF365,
+    0xF285, 0x9AA3, 0x90C4, 0xFC85, 0xFC85, 0xFD65, 0xF485, 0xFE65,
+    0xFE65, 0xF725, 0xFE65, 0xF725, 0xFD65, 0x9CE5, 0xA6A7, 0xCF26,
+    0xA6C7, 0xD726, 0xCF26, 0x6AA3, 0x9CE5, 0xF725, 0xF725, 0xCD85,
+    0xCC64, 0xCC84, 0xFD65, 0xFD85, 0x62A3, 0xFD65, 0xF485, 0xFC65,
+    0xCA64, 0x0000, 0xEA85, 0xF285, 0xE9C5, 0x90C4, 0xE965, 0x1842,
+    0xC165, 0xE965, 0xE126, 0xE106, 0xE0E7, 0xE8E7, 0xE0A8, 0xE0C8,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0xE0AC, 0xE8AC, 0xE0AC, 0xE0AA, 0xE0AC,
+    0xE8AA, 0xE0AA, 0xE0C8, 0xC88A, 0xC0C6, 0xE8E7, 0x5084, 0xE108,
+    0xE906, 0xE165, 0x0000, 0xE145, 0xE145, 0xE9C5, 0xE9C5, 0xCA64,
+    0xF285, 0xCB84, 0xC185, 0x9AA3, 0xF365, 0xFD65, 0xFD85, 0x62A3,
+    0xCC64, 0xFE65, 0xFE65, 0xF725, 0xF665, 0xCC84, 0x1842, 0xAEC7,
+    0xA6A7, 0xD726, 0xCF26, 0xFF25, 0xCD65, 0x0000, 0xF725, 0xF725,
+    0x0000, 0x0000, 0x0000, 0x62A3, 0xCB84, 0x0000, 0xCB84, 0xFB65,
+    0xFB65, 0xF365, 0x0000, 0x0000, 0xE9C5, 0xE9C5, 0xE145, 0xE165,
+    0xE106, 0xE106, 0xE8E7, 0xE0E7, 0xE0E7, 0xE0E7, 0xE8C8, 0xE0C8,
+    0xE0A8, 0xE0AA, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0xE8AE, 0xE0AC, 0xE0AE, 0xE0AC, 0xE8AC,
+    0xE0AA, 0xE0AC, 0xE0AA, 0xE8AA, 0xE0C8, 0xE0AA, 0xE0A8, 0xE8C8,
+    0xE0E7, 0xE108, 0x0000, 0x0000, 0xE106, 0xE165, 0xE945, 0xC185,
+    0x0000, 0xCA64, 0x0000, 0x0000, 0x0000, 0x62A3, 0xFC85, 0xFC65,
+    0x0000, 0xF585, 0xFD65, 0xFE85, 0xFE65, 0xF665, 0x1822, 0x0000,
+    0x64A6, 0xCF26, 0xCF26, 0xF725, 0xFF25, 0xF725, 0x0000, 0xF725,
+    0xF685, 0xFD65, 0xCC84, 0xFD65, 0xFC85, 0xFD65, 0xCB84, 0xFC85,
+    0x5084, 0xF365, 0xEA85, 0xCA64, 0x0000, 0xE1A6, 0xE9C5, 0xE9C5,
+    0xE965, 0xE106, 0xD127, 0xD127, 0xE8C8, 0xE108, 0xE0A8, 0xE0AA,
+    0xE0AA, 0xE108, 0xE8AA, 0xE0AC, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0xE0B0, 0xE0AE, 0xE0AE, 0xE8AE, 0xE0AE,
+    0xE0AC, 0xE0AE, 0xE8AC, 0xE0AC, 0xE0AA, 0xE108, 0xE0AA, 0xE8AA,
+    0xE0C8, 0xE108, 0x0000, 0x0000, 0xE108, 0xE945, 0xC0C6, 0xC185,
+    0xC165, 0x9AC3, 0xE9C5, 0xCA64, 0xCA64, 0x9AA3, 0x9AA3, 0xFC85,
+    0xF365, 0x0000, 0xFD65, 0xFE65, 0xFE65, 0xFE85, 0x9AA3, 0x0000,
+    0x0000, 0x0000, 0xD666, 0xD726, 0xCF26, 0xF725, 0xF725, 0xFF25,
+    0xFE65, 0xFE65, 0xF565, 0xFD85, 0x9AA3, 0x9AA3, 0xFC85, 0xFC85,
+    0xCA64, 0x9AA3, 0x90C4, 0xF285, 0xE9C5, 0xC165, 0x1842, 0xE965,
+    0xE145, 0xE106, 0x90E4, 0x0000, 0x0000, 0x0000, 0x0000, 0xE8AA,
+    0xE0C8, 0xE0AA, 0xE8AA, 0xE0AC, 0xE0AC, 0xE0AC, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x986B, 0x608B, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x608B, 0x988B, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0xE8B0, 0xE0AE, 0xE0B0, 0xE0AE, 0xE8AE,
+    0xE0AE, 0xE0AE, 0xC88E, 0x0000, 0x0000, 0x0000, 0x0000, 0xC0C6,
+    0xE8C8, 0xE0AA, 0xC88A, 0x0000, 0xE0C8, 0xE0E7, 0xE8E7, 0x90C4,
+    0xC0C6, 0xE165, 0xE945, 0xE9C5, 0x90E4, 0xCA64, 0xF285, 0xF365,
+    0xF365, 0xFC65, 0xF485, 0xFD65, 0xFD85, 0xF665, 0xFD65, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x64A6, 0xCF26, 0xF725, 0xF725, 0xF725,
+    0xFE65, 0xFE85, 0x9AA3, 0xCC64, 0xFD85, 0xF565, 0xFC85, 0xCB84,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xC185, 0xE9C5, 0xE1A6,
+    0xE965, 0xC0C6, 0x0000, 0xE108, 0xE8A8, 0x0000, 0x0000, 0x0000,
+    0x1842, 0xE0AC, 0xE0AC, 0xE0AC, 0xE8AC, 0xE0AE, 0xE0AC, 0xE8AC,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE0B0, 0xE0B0, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0xC8B1, 0xE0B0, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0xE0B0, 0xE0B0, 0xE0B0, 0xE0B0, 0xE0B0,
+    0xE0AE, 0xE0B0, 0xE0AE, 0x0000, 0x0000, 0x0000, 0x0000, 0xE0AC,
+    0xE8AA, 0x0000, 0xE0AA, 0xE0AA, 0xE0C8, 0xE8E7, 0x5884, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x90C4, 0xC165, 0xCA64, 0xF285, 0xEA65,
+    0xF285, 0xCA64, 0xF365, 0xF465, 0xFC85, 0xFD65, 0xFD85, 0x62A3,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFF25, 0xF725, 0xFF25,
+    0xF725, 0xCD65, 0x0000, 0x0000, 0x0000, 0x0000, 0x90C4, 0xFC85,
+    0xFB65, 0x5084, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE945,
+    0xE165, 0xE145, 0xE8E7, 0x0000, 0x0000, 0xE0C8, 0xE0A8, 0x0000,
+    0x0000, 0x0000, 0x5084, 0xE8AC, 0xC8AE, 0xC88A, 0xE8AC, 0xE0AE,
+    0xE0AE, 0xC8AE, 0x0000, 0x0000, 0x0000, 0x0000, 0x986B, 0xE8B0,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x1842, 0xD0B1, 0x588B, 0x0000,
+    0x0000, 0x0000, 0x0000, 0xB0D1, 0xE0B0, 0xE0B0, 0xE0B0, 0xE0B0,
+    0xE8AE, 0xE0B0, 0xC88E, 0x0000, 0x0000, 0x0000, 0x0000, 0xE0AC,
+    0xE0AC, 0x5884, 0x0000, 0xE8AA, 0xE0C8, 0xE0AA, 0xC0C6, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE9C5, 0xE9C5, 0xC165,
+    0x0000, 0x0000, 0x0000, 0x0000, 0xF365, 0xFC85, 0xF485, 0xFC65,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9AA3, 0xF725,
+    0xF725, 0xF725, 0xCD65, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0xFC85, 0xFB65, 0x62A3, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0xE165, 0xE126, 0xE906, 0x90C4, 0x0000, 0x0000, 0xE0AA,
+    0xE8AA, 0x988B, 0x0000, 0x0000, 0x0000, 0xE0AE, 0xE8AE, 0x90C4,
+    0xE0AE, 0xE0B0, 0xE8B0, 0x988B, 0x0000, 0x0000, 0x0000, 0x0000,
+    0xC88E, 0xB0D1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA8B1, 0xB0D1, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x986B, 0xC8B1, 0xE0B0, 0xE0B0, 0xE8B0,
+    0xC8AE, 0xE0B0, 0xE0B0, 0x0000, 0x0000, 0x0000, 0x988B, 0xE0AE,
+    0xE0AE, 0x0000, 0x0000, 0xC88A, 0xE8AA, 0xE108, 0xE8AA, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x5084, 0xE145, 0xC165, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF365, 0xFC85, 0xFD65,
+    0x3242, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0xFF45, 0xF725, 0xFE65, 0xFE65, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x5064, 0xCA64, 0xCA64, 0xFB65, 0xF285, 0x5084, 0x0000, 0x0000,
+    0x1842, 0x2042, 0xD927, 0xE106, 0xE8E7, 0xE0E7, 0x5084, 0x0000,
+    0x0000, 0xA08B, 0xE0AA, 0xE8AA, 0x0000, 0x0000, 0x0000, 0xC88E,
+    0xE0AE, 0x988B, 0xC88E, 0xE8B0, 0xE0B0, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x988B, 0xA8B1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA08B, 0x588B,
+    0x0000, 0x0000, 0x0000, 0x0000, 0xB0B1, 0xC8B1, 0xC8B1, 0xD0AE,
+    0xC88E, 0xE0B0, 0xC8B1, 0x0000, 0x0000, 0x0000, 0xC8AE, 0xE8B0,
+    0x90C4, 0x0000, 0x0000, 0x988B, 0xE8AC, 0xE0AC, 0xE8AA, 0xC88A,
+    0x0000, 0x5084, 0x0000, 0x0000, 0x90E4, 0xE906, 0xE906, 0xE126,
+    0xC0C6, 0x1842, 0x0000, 0x0000, 0x0000, 0x0000, 0xFB65, 0xFC85,
+    0xF485, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0xF725, 0xF725, 0xFF25, 0xFE85, 0x0000, 0x0000, 0x0000,
+    0x9AC3, 0xCB84, 0x98C4, 0x5084, 0x0000, 0xEA85, 0xE9C5, 0xE9C5,
+    0xE145, 0xE165, 0xE926, 0xE106, 0xE0E7, 0xE108, 0xE0C8, 0xE8AA,
+    0xC88A, 0x0000, 0xE0AA, 0xE0AC, 0xE0AC, 0xE8AE, 0xD08E, 0x0000,
+    0x0000, 0x988B, 0xE0B0, 0xE0B0, 0xC8B1, 0xE0B0, 0xC8B1, 0x0000,
+    0x0000, 0x0000, 0x0000, 0xB0D1, 0x608B, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x588B, 0x90D1,
+    0x0000, 0x0000, 0x0000, 0x0000, 0xB0B1, 0xC8B1, 0xA8D1, 0xB0B1,
+    0xC8B1, 0xD0B1, 0x988B, 0x0000, 0x0000, 0xC88E, 0xE0B0, 0xE0B0,
+    0xE0B0, 0x588B, 0x0000, 0xE8AE, 0xE0AE, 0xE0AE, 0xE0AC, 0xE8AC,
+    0xE0AA, 0xE0AC, 0xE0AA, 0xE8AA, 0xE0C8, 0xE108, 0xC88A, 0x0000,
+    0xC0C6, 0xE165, 0xE945, 0x5884, 0x0000, 0x0000, 0x1842, 0xF365,
+    0xF365, 0xFC65, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0xCD65, 0xFF25, 0xFE65, 0xFE65, 0x90C4, 0x0000,
+    0xCB84, 0xF365, 0x0000, 0x0000, 0x0000, 0x0000, 0xE1A6, 0xE9C5,
+    0xE165, 0xE945, 0xE106, 0xE126, 0xE0E7, 0xC0C6, 0x0000, 0x90E4,
+    0xE8A8, 0xE0AA, 0xE8AA, 0xE0AC, 0x988B, 0x1842, 0xE8AC, 0xE8AE,
+    0xE0AE, 0xC88E, 0x0000, 0x0000, 0xE0B0, 0xE0B0, 0xC8B1, 0xC8B1,
+    0x988B, 0x0000, 0x0000, 0x0000, 0xA06B, 0xA8D1, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x90D1,
+    0x608B, 0x0000, 0x0000, 0x0000, 0x988B, 0xB0B1, 0xA8D1, 0xB0B1,
+    0xA8D1, 0xD0B1, 0x0000, 0x0000, 0x986B, 0xE0B0, 0xC8B1, 0xE8B0,
+    0x988B, 0xE0B0, 0xE8AE, 0xE0B0, 0xE0AE, 0xE0AE, 0xC88E, 0xC88A,
+    0xC8AA, 0xE8AC, 0xE0AA, 0xE0AA, 0xE0C8, 0xE8A8, 0xE0C8, 0x90C4,
+    0x0000, 0x0000, 0x0000, 0x5884, 0xC185, 0x5884, 0x0000, 0xC165,
+    0xF285, 0xFB65, 0xCA64, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0xCC64, 0xFE65, 0xFE65, 0xFE85, 0x9CE5,
+    0x5084, 0xFC85, 0x0000, 0x0000, 0x0000, 0x0000, 0xC165, 0xEA85,
+    0xE9C5, 0xE9C5, 0xC0C6, 0xE106, 0xE0E7, 0xE108, 0xE8C8, 0xE8A8,
+    0x0000, 0x0000, 0x1842, 0xE0AC, 0xE8AC, 0x988B, 0x0000, 0x0000,
+    0x986B, 0xE0B0, 0xE0B0, 0xE8B0, 0xC8AE, 0xA8D1, 0xC8B1, 0xE8B0,
+    0xC8B1, 0xD0B1, 0x608B, 0x0000, 0x0000, 0x1842, 0x90D1, 0x608B,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x608B,
+    0x78D1, 0x0000, 0x0000, 0x0000, 0x1842, 0xA8D1, 0x90D1, 0xA8D1,
+    0x90D1, 0xB0D1, 0x1842, 0xB0B1, 0xA8D1, 0xD0B1, 0xC8B1, 0xA8B1,
+    0x0000, 0x0000, 0xC8AE, 0xE0B0, 0xE8B0, 0x588B, 0x0000, 0x0000,
+    0xC88E, 0xE0AE, 0xE8AC, 0xE0AC, 0xE0AA, 0xE0AA, 0xE8C8, 0xE0A8,
+    0xE8C8, 0x0000, 0x0000, 0x0000, 0x0000, 0x90C4, 0xC185, 0x0000,
+    0xE9C5, 0xF365, 0xF365, 0x9AA3, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x62A3, 0xFE65, 0xFD65, 0xFD85,
+    0xFC65, 0xCC84, 0x9AA3, 0x0000, 0x0000, 0x0000, 0x0000, 0xF285,
+    0xE9C5, 0xE1C5, 0xC165, 0xE106, 0x0000, 0x90E4, 0xE8A8, 0xE0C8,
+    0xE8A8, 0xE0AA, 0x5084, 0x0000, 0x608B, 0xE8AC, 0xE0AC, 0xE0AE,
+    0x0000, 0x0000, 0x0000, 0xE0B0, 0xE0B0, 0xE0B0, 0xC8B1, 0xC8B1,
+    0xD0B1, 0xC8B1, 0x988B, 0xB0B1, 0x0000, 0x0000, 0x0000, 0x78F1,
+    0x588B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x608B, 0x6111, 0x0000, 0x0000, 0x0000, 0x78D1, 0x78F1, 0x78D1,
+    0x90D1, 0x90F1, 0x90D1, 0xA8D1, 0xB0D1, 0xA8B1, 0xB0D1, 0x1842,
+    0x0000, 0x0000, 0xD0B1, 0xE0B0, 0xE0B0, 0x986B, 0x0000, 0x5884,
+    0xE8AE, 0xE0AE, 0xE8AC, 0xE0AC, 0x988B, 0x986B, 0xC88A, 0xE8AA,
+    0xE0C8, 0xE8C8, 0xC0C6, 0x0000, 0x0000, 0x0000, 0x0000, 0xC165,
+    0x90E4, 0xF285, 0xF265, 0xF365, 0x5084, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFE65, 0xFE85,
+    0xFD65, 0xFD85, 0xFC85, 0x1842, 0x0000, 0x0000, 0x0000, 0x5084,
+    0xE9C5, 0xE9C5, 0xE145, 0xE965, 0x5884, 0x0000, 0x0000, 0x90C4,
+    0xE0C8, 0xE0AA, 0xE8AA, 0xE8AC, 0x90C4, 0x90E4, 0xE0AC, 0xE0AE,
+    0xE8AE, 0xE0B0, 0xE0B0, 0x608B, 0x1842, 0xE8B0, 0xC8B1, 0x608B,
+    0x0000, 0xC8B1, 0xA8B1, 0xB0D1, 0x90D1, 0x78F1, 0x0000, 0x0000,
+    0x2042, 0x78D1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x1842, 0x6911, 0x1842, 0x0000, 0x0000, 0x6111, 0x78F1, 0x78D1,
+    0x78F1, 0x90D1, 0x78F1, 0x608B, 0x986B, 0xB0D1, 0xB0B1, 0x0000,
+    0x1842, 0xC8B1, 0xC8B1, 0xD0B1, 0xC8B1, 0xE0B0, 0x0000, 0x988B,
+    0xE0B0, 0xE0B0, 0xE0AE, 0xE8AE, 0x5084, 0x0000, 0x0000, 0xC88A,
+    0xE8AA, 0xE0AA, 0xE0C8, 0xE0E7, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x90C4, 0xE9C5, 0xE9C5, 0xF265, 0xF285, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFE65,
+    0xFD65, 0xF565, 0xFC85, 0xF465, 0x1842, 0x0000, 0x0000, 0x0000,
+    0x0000, 0xE9C5, 0xE945, 0xE165, 0xE106, 0xE8E7, 0x1842, 0x0000,
+    0x0000, 0x90E4, 0xE8A8, 0xE0AA, 0xE8AA, 0xE0AC, 0xE0AC, 0xE0AE,
+    0xE8AE, 0xC8AE, 0xE0AE, 0xE0B0, 0xE0B0, 0xE0B0, 0xC8B1, 0xC8B1,
+    0xB0B1, 0x0000, 0x0000, 0x588B, 0x90D1, 0xB0D1, 0x88D1, 0x0000,
+    0x0000, 0x0000, 0x608B, 0x4951, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x4931, 0x608B, 0x0000, 0x0000, 0x0000, 0x4951, 0x6111,
+    0x6911, 0x78F1, 0x190B, 0x0000, 0x0000, 0x90D1, 0x90D1, 0x90F1,
+    0x90D1, 0xA8D1, 0xB0D1, 0xC8B1, 0x986B, 0xD0B1, 0xC8B1, 0xC8B1,
+    0xE8B0, 0xE0B0, 0xE0AE, 0xE0B0, 0x1842, 0x0000, 0x0000, 0x1842,
+    0xD0AE, 0xE8AC, 0xE0A8, 0xE8AA, 0xE0C8, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x90C4, 0xE965, 0xE9C5, 0xE9C5, 0xEA85, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0xFD65, 0xFE85, 0xFD65, 0xF585, 0xFC85, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0xC165, 0xE9C5, 0xE165, 0xE945, 0xE108, 0xE0E7,
+    0xE8C8, 0xE108, 0x90E4, 0xE0AC, 0xE0AA, 0xE0AC, 0xE8AC, 0xE0AE,
+    0xE0AE, 0xE0B0, 0xE0B0, 0xE0B0, 0xE0B0, 0xE8B0, 0xC8B1, 0xC8B1,
+    0xC8B1, 0xD0B1, 0x90D1, 0x0000, 0x0000, 0x588B, 0x90F1, 0x90D1,
+    0x6911, 0x0000, 0x0000, 0x608B, 0x4951, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x4931, 0x608B, 0x0000, 0x0000, 0x4951, 0x6111,
+    0x4931, 0x6111, 0x0000, 0x0000, 0x0000, 0x78D1, 0x78F1, 0x90F1,
+    0x88D1, 0xB0D1, 0x90D1, 0xA8B1, 0xB0D1, 0xC8B1, 0xC8B1, 0xC8B1,
+    0xC8B1, 0xE0B0, 0xE0B0, 0xE8B0, 0xC88E, 0x0000, 0x988B, 0xE0AE,
+    0xE0AC, 0xE8AC, 0xE0AA, 0xE0AC, 0xE8A8, 0x988B, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x90C4, 0xE9C5, 0xE9C5, 0xEA65, 0xCA64, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0xF465, 0xFD85, 0xFD65, 0xF485, 0xFC65, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0xE9C5, 0xE145, 0xE165, 0xE108, 0xE0E7,
+    0xE0A8, 0xE0C8, 0xE8A8, 0xE0AA, 0xE0AA, 0xE0AC, 0xE8AC, 0xE0AE,
+    0xE0AE, 0xE0AE, 0xE8AE, 0xE0B0, 0xE0B0, 0xE0B0, 0xC8B1, 0xC8B1,
+    0xC8B1, 0xC8B1, 0xB0D1, 0xA8B1, 0x1842, 0x0000, 0x0000, 0x78F1,
+    0x78D1, 0x6911, 0x1842, 0x0000, 0x0000, 0x4931, 0x210B, 0x0000,
+    0x0000, 0x0000, 0x190B, 0x5151, 0x0000, 0x0000, 0x1842, 0x5131,
+    0x3191, 0x4951, 0x190B, 0x0000, 0x0000, 0x5131, 0x6111, 0x6911,
+    0x78F1, 0x78F1, 0x78D1, 0x90D1, 0x90F1, 0xA8D1, 0xB0B1, 0xC8B1,
+    0xC8B1, 0xC8B1, 0xD0B1, 0xE0B0, 0xE0B0, 0xE0B0, 0xE0AE, 0xE8AE,
+    0xE0AE, 0xE0AE, 0xE0AC, 0xE8AC, 0xE0AA, 0xE0AA, 0xC0C6, 0x0000,
+    0x0000, 0x0000, 0x0000, 0xC185, 0xE945, 0xE9C5, 0xE9C5, 0xC185,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x9AA3, 0xFD65, 0xF485, 0xFC65, 0xFC85, 0xCA64,
+    0x0000, 0x0000, 0x0000, 0xC185, 0xE165, 0xE106, 0x0000, 0xC0C6,
+    0xE0A8, 0xE108, 0xE8C8, 0xE0AA, 0xE0AA, 0xE0AC, 0xE8AC, 0xE0AE,
+    0xE0AE, 0xE0B0, 0xE0AE, 0xE0B0, 0xE8AE, 0xE0B0, 0xC8B1, 0xD0B1,
+    0xC8B1, 0xC8B1, 0xB0B1, 0xA8D1, 0x90D1, 0xB0D1, 0x0000, 0x0000,
+    0x78F1, 0x6111, 0x210B, 0x6111, 0x0000, 0x0000, 0x210B, 0x4931,
+    0x0000, 0x0000, 0x0000, 0x3191, 0x190B, 0x0000, 0x0000, 0x4951,
+    0x3191, 0x0000, 0x3191, 0x4931, 0x0000, 0x608B, 0x4931, 0x6111,
+    0x6111, 0x78F1, 0x78F1, 0x90D1, 0x78F1, 0x90D1, 0x88D1, 0xB0D1,
+    0xA8B1, 0xD0B1, 0xC8B1, 0xE0B0, 0xC8B1, 0xE0B0, 0xE0B0, 0xE0B0,
+    0xE0AE, 0xE0B0, 0xE0AE, 0xE8AE, 0x988B, 0xC0C6, 0xE0AA, 0xE8AA,
+    0x1842, 0x0000, 0x0000, 0x0000, 0xE106, 0xE965, 0xE145, 0xE9C5,
+    0x5084, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x5084, 0xFD85, 0xFD85, 0xFC65, 0xFC85,
+    0xF365, 0xCA64, 0x0000, 0x0000, 0xC165, 0xE9C5, 0x5084, 0x0000,
+    0x0000, 0x0000, 0xC88A, 0xE8C8, 0xE0AA, 0xE8AC, 0xE0AA, 0xE0AC,
+    0xC88E, 0xC8AE, 0x5884, 0x1842, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x5884, 0xB0B1, 0x90D1, 0x90F1, 0x78F1, 0x78D1,
+    0x588B, 0x6111, 0x0000, 0x0000, 0x4931, 0x608B, 0x0000, 0x0000,
+    0x3191, 0x190B, 0x0000, 0x210B, 0x3191, 0x0000, 0x0000, 0x190B,
+    0x3191, 0x3191, 0x0000, 0x3191, 0x3191, 0x190B, 0x3191, 0x4951,
+    0x4931, 0x6911, 0x4951, 0x608B, 0x1842, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x608B, 0x608B, 0x90D1, 0xB0D1, 0xC8B1, 0xD0B1, 0xE0B0,
+    0xE0B0, 0xE0B0, 0xE0AE, 0xC8AE, 0x0000, 0x0000, 0x0000, 0xE8AA,
+    0xE0A8, 0x90E4, 0x0000, 0x0000, 0xC0C6, 0xE906, 0xE106, 0xE165,
+    0xE9C5, 0x1842, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFD85, 0xF465, 0xFC85,
+    0xF365, 0xF365, 0xF265, 0xEA85, 0xE9C5, 0xE9C5, 0xE165, 0xE165,
+    0xE906, 0xE106, 0xE0C8, 0xE0A8, 0xE8C8, 0xE908, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1842, 0x78F1, 0x90D1,
+    0x78D1, 0x78F1, 0x6911, 0x1842, 0x0000, 0x4951, 0x3191, 0x0000,
+    0x0000, 0x3191, 0x3191, 0x0000, 0x09EE, 0x3191, 0x0000, 0x0000,
+    0x21F2, 0x2212, 0x210B, 0x0000, 0x190B, 0x2212, 0x3191, 0x4951,
+    0x3191, 0x4931, 0x2042, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x1842, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x988B, 0xE0B0, 0xE0B0, 0xE0AE, 0xE0AE, 0xE0AC, 0xE8AC,
+    0xE0AA, 0xE108, 0xC88A, 0xE0A8, 0xE0C8, 0xE926, 0xE106, 0xE145,
+    0xE965, 0xE9C5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCC64, 0xFC85,
+    0xF365, 0xF365, 0xF265, 0xEA85, 0xE9C5, 0xE9C5, 0xE145, 0xE145,
+    0xE106, 0xE126, 0xE8C8, 0xE0A8, 0xE0C8, 0xE0AA, 0xE8AA, 0xE0AA,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x6111, 0x4931, 0x4931, 0x4951, 0x0000, 0x190B, 0x3191,
+    0x210B, 0x0000, 0x1842, 0x2212, 0x2212, 0x21F2, 0x0000, 0x0000,
+    0x210B, 0x2212, 0x2212, 0x0000, 0x1842, 0x21F2, 0x3191, 0x3191,
+    0x3191, 0x190B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0xD0B1, 0xE8B0, 0xE0AE, 0xE8AE, 0xE0AC, 0xE0AE,
+    0xE0AC, 0xE8AC, 0xE0AA, 0xE0AA, 0xE0C8, 0xE8A8, 0xE0C8, 0xE106,
+    0xE106, 0xE965, 0xC185, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCB84,
+    0xF485, 0xFC65, 0xF365, 0xF365, 0xF285, 0xEA85, 0xE9C5, 0xE9C5,
+    0xE165, 0xE106, 0xE8E7, 0xE0E7, 0xE0C8, 0xE0AA, 0xC88A, 0xE8AC,
+    0xE8AC, 0xA08B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x4931, 0x4931, 0x4931, 0x3191, 0x0000,
+    0x2991, 0x2212, 0x0000, 0x3191, 0x2212, 0x1A53, 0x21F2, 0x3191,
+    0x0000, 0x12B4, 0x1A53, 0x2212, 0x0000, 0x1A53, 0x2212, 0x2212,
+    0x09EE, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0xA8B1, 0xE0B0, 0xE0B0, 0xC8B1, 0xE8AE, 0xE0AE,
+    0xE0AC, 0xE0AE, 0xE8AC, 0xE0AC, 0xE0AA, 0xE0AA, 0xE8C8, 0xE0E7,
+    0xE0E7, 0xE145, 0xE965, 0x90C4, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x1842, 0xFC65, 0xFB65, 0xF365, 0xF285, 0xEA65, 0xE9C5, 0xE9C5,
+    0xE145, 0xE165, 0x90C4, 0x0000, 0x90E4, 0xE8A8, 0xE0C8, 0xE8AA,
+    0xE0AA, 0xE0AC, 0xE0AC, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4931, 0x2991, 0x3191,
+    0x3191, 0x190B, 0x3191, 0x2042, 0x09EE, 0x1A73, 0x1A53, 0x12B4,
+    0x09EE, 0x2042, 0x1A53, 0x12B4, 0x0000, 0x1AB4, 0x1A53, 0x1A53,
+    0x210B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x5884, 0xE8B0, 0xE0B0, 0xE0B0, 0xE0AE, 0xE0B0,
+    0xE0AE, 0x988B, 0x1842, 0xE8AC, 0xE8AA, 0xE0AA, 0xE8A8, 0xE0C8,
+    0xE0A8, 0xE108, 0xE108, 0xE165, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0xF485, 0xFC65, 0xF365, 0xF365, 0xF285, 0xF285,
+    0xE1C6, 0xE1A6, 0xE165, 0xE106, 0xC0C6, 0xE108, 0xE8C8, 0xE0AA,
+    0xE0AA, 0xE8AC, 0xC88A, 0xC8AE, 0xE8AE, 0x2042, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4931,
+    0x2991, 0x21F2, 0x3191, 0x2212, 0x1A53, 0x3A42, 0x1AB4, 0x12B4,
+    0x1AB4, 0x190B, 0x1AB4, 0x0B56, 0x210B, 0x1356, 0x12B4, 0x1AB4,
+    0x09EE, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1842, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x608B, 0xC8B1, 0xA8D1, 0xE0B0, 0xE0B0, 0xE0B0,
+    0xE0AE, 0xE8B0, 0xC88E, 0xC8AE, 0xE0AC, 0xE0AC, 0xE0AA, 0xE8AA,
+    0xE0C8, 0xE108, 0xE0E7, 0xE106, 0xE906, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0xCA64, 0xF365, 0xFB65, 0xEA65, 0xF285,
+    0xE9C5, 0xC0C6, 0xE145, 0xE106, 0xE0E7, 0xE0E7, 0xE8C8, 0xE0A8,
+    0xE0C8, 0xE0AA, 0xE8AA, 0xE0AC, 0xC88E, 0xE0AE, 0xC8B1, 0x988B,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1842, 0x3191,
+    0x3191, 0x2212, 0x3191, 0x21F2, 0x2212, 0x12B4, 0x2042, 0x12B4,
+    0x1AB4, 0x0B56, 0x0000, 0x1356, 0x1356, 0x0B33, 0x12B4, 0x1356,
+    0x12B4, 0x1AB4, 0x1A53, 0x210B, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x608B, 0xB0B1, 0xA8D1, 0x986B, 0xD0B1, 0xE0B0,
+    0xE0B0, 0xE0B0, 0xE8AE, 0xE0AE, 0xE0AC, 0xE0AC, 0xE8AA, 0xE0AA,
+    0x988B, 0xE8A8, 0xE0C8, 0xE0E7, 0xE0E7, 0xC0C6, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFC65, 0xF365, 0xF285,
+    0xE9C5, 0xC185, 0x90C4, 0xC185, 0xE126, 0xE906, 0xE0E7, 0xE0A8,
+    0xE0C8, 0xE8AA, 0xE0AA, 0xE0AC, 0xE0AC, 0xE8AE, 0xE8AE, 0x1842,
+    0xD08E, 0xD0AE, 0x5884, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x1842, 0x608B, 0x4951, 0x4931, 0x4931,
+    0x3191, 0x2212, 0x21F2, 0x2042, 0x2212, 0x1AB4, 0x12B4, 0x1356,
+    0x12B4, 0x1356, 0x1356, 0x0BF8, 0x1356, 0x0BD8, 0x0B56, 0x2042,
+    0x12B4, 0x1356, 0x1356, 0x1356, 0x12B4, 0x1AB4, 0x2212, 0x1842,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x1842, 0x78D1, 0xB0D1, 0x588B, 0xC8B1, 0xC8B1, 0xE0B0,
+    0xE0B0, 0xE0B0, 0xE0B0, 0xE0B0, 0xE8AE, 0xE0AE, 0xE0AC, 0xE0AC,
+    0xE8AA, 0x5884, 0xE0A8, 0xE0C8, 0xE0E7, 0xE906, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9AA3, 0xF365,
+    0xF285, 0xF285, 0xE145, 0x90C4, 0x0000, 0xC0C6, 0xE0E7, 0xE8E7,
+    0xE0C8, 0xE0AA, 0xE0AA, 0xE8AA, 0x0000, 0xE0AE, 0xE0AC, 0xC88E,
+    0x0000, 0x1842, 0xE8B0, 0xE0B0, 0xC8B1, 0xC8B1, 0xB0D1, 0xA8B1,
+    0x90D1, 0x78F1, 0x78F1, 0x78D1, 0x6111, 0x6111, 0x4931, 0x4951,
+    0x0000, 0x3191, 0x3191, 0x2212, 0x2212, 0x12B4, 0x1A53, 0x1A53,
+    0x12B4, 0x1356, 0x1356, 0x0BD8, 0x0BD8, 0x0BF8, 0x1356, 0x0BD8,
+    0x0B56, 0x0B33, 0x1356, 0x1356, 0x190B, 0x210B, 0x1A53, 0x1A53,
+    0x2212, 0x2212, 0x09EE, 0x3191, 0x2042, 0x190B, 0x2042, 0x4931,
+    0x608B, 0x78F1, 0x78D1, 0x90D1, 0x0000, 0x0000, 0xB0D1, 0xC8B1,
+    0xC8B1, 0xA08B, 0xE0B0, 0xE0B0, 0xE0AE, 0xE8AE, 0xE0AC, 0xE0AC,
+    0x0000, 0x90C4, 0x988B, 0xE8A8, 0xE8C8, 0xE0E7, 0x90C4, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0xF285, 0xF365, 0xE9C5, 0xE9C5, 0xE165, 0xC0C6, 0xE126, 0xE906,
+    0xE0A8, 0x988B, 0xE8AA, 0xE8AA, 0x5084, 0x0000, 0x986B, 0xE8AE,
+    0xE0AE, 0xE0B0, 0xE0B0, 0xE0B0, 0xC8B1, 0xE8B0, 0xC8B1, 0xC8B1,
+    0xB0D1, 0xA8B1, 0x78F1, 0x608B, 0x6911, 0x6111, 0x0000, 0x0000,
+    0x0000, 0x2042, 0x3191, 0x21F2, 0x2212, 0x12B4, 0x1AD4, 0x09EE,
+    0x0000, 0x1356, 0x0B56, 0x0BD8, 0x0BD8, 0x0C99, 0x0BD8, 0x0000,
+    0x0BD8, 0x0499, 0x0BD8, 0x0BD8, 0x1356, 0x0B33, 0x0000, 0x0000,
+    0x0000, 0x1A53, 0x2212, 0x2212, 0x190B, 0x4951, 0x3191, 0x4931,
+    0x4931, 0x6111, 0x78F1, 0x90F1, 0x90D1, 0xB0B1, 0x988B, 0xC8B1,
+    0xD0B1, 0x588B, 0x0000, 0x608B, 0xE0B0, 0xE0B0, 0x986B, 0xE0AE,
+    0xE0AC, 0xE8AC, 0x5884, 0xE0AC, 0xE0C8, 0xE0A8, 0xE8C8, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x90C4, 0xE9C5, 0xE9C5, 0xE145, 0xE106, 0xE126,
+    0xC0C6, 0x90E4, 0xC88A, 0xE8AA, 0xC88A, 0x0000, 0x0000, 0x1842,
+    0xE8AE, 0xE0AE, 0xE0AE, 0xE0B0, 0x1842, 0x0000, 0xD0B1, 0xA8D1,
+    0xA08B, 0xA8B1, 0x90D1, 0x90F1, 0x588B, 0x6111, 0x0000, 0x0000,
+    0x0000, 0x3191, 0x3191, 0x2991, 0x3191, 0x1A53, 0x2212, 0x09EE,
+    0x0000, 0x0000, 0x1356, 0x0BF8, 0x0BD8, 0x0499, 0x0BD8, 0x0C79,
+    0x0000, 0x0000, 0x0BD8, 0x0499, 0x0BD8, 0x0BD8, 0x1356, 0x1356,
+    0x190B, 0x0000, 0x0000, 0x2212, 0x2212, 0x09EE, 0x3191, 0x3191,
+    0x3191, 0x0000, 0x4931, 0x6911, 0x0000, 0x90D1, 0x90F1, 0xA8D1,
+    0xB0B1, 0xC8B1, 0x0000, 0x0000, 0x0000, 0xE0B0, 0xE8AE, 0xC8AE,
+    0x986B, 0xE8AE, 0xE0AC, 0xE0AC, 0xE8AA, 0xE0AA, 0x90E4, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x90C4, 0xC185, 0xE965,
+    0xE108, 0xE108, 0xC88A, 0xE0A8, 0xE8C8, 0xC88A, 0x5884, 0x5884,
+    0x5084, 0xE0AE, 0xE8AE, 0xD0AE, 0x0000, 0x0000, 0x588B, 0xC8B1,
+    0x90D1, 0x0000, 0xB0D1, 0xA8D1, 0x90D1, 0x90D1, 0x2042, 0x0000,
+    0x0000, 0x4931, 0x3191, 0x2042, 0x1842, 0x2212, 0x2212, 0x1AB4,
+    0x0000, 0x0000, 0x09EE, 0x0BF8, 0x0BD8, 0x0C79, 0x0479, 0x0C79,
+    0x0479, 0x0000, 0x0000, 0x3A22, 0x0479, 0x0C99, 0x0BD8, 0x0000,
+    0x12D4, 0x1356, 0x09EE, 0x0000, 0x0000, 0x2212, 0x2991, 0x3191,
+    0x3191, 0x4931, 0x0000, 0x6111, 0x6911, 0x0000, 0x0000, 0x1842,
+    0x90D1, 0xC8B1, 0xC8B1, 0x0000, 0x0000, 0x0000, 0xC8AE, 0xE0B0,
+    0xE0AE, 0xE0AE, 0xE8AC, 0xE0AC, 0xE8AA, 0x986B, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x1842, 0x5884, 0x98E4, 0xC0C6, 0xC88A, 0xC88A, 0xE8AA,
+    0xC8AE, 0xE0AC, 0xE8AE, 0xE0AE, 0x5084, 0xB0D1, 0x0000, 0xC8B1,
+    0xC8B1, 0xD0B1, 0x0000, 0x986B, 0x90D1, 0x90F1, 0x78F1, 0x6111,
+    0x1842, 0x4931, 0x210B, 0x0000, 0x0000, 0x3191, 0x2212, 0x1A53,
+    0x0000, 0x0000, 0x0000, 0x09EE, 0x0BF8, 0x0479, 0x0BD8, 0x0499,
+    0x0C79, 0x0479, 0x0000, 0x0000, 0x0000, 0x0BD8, 0x0BD8, 0x0BF8,
+    0x210B, 0x0000, 0x210B, 0x12B4, 0x09EE, 0x2042, 0x2212, 0x2212,
+    0x3191, 0x3191, 0x0000, 0x0000, 0x4931, 0x6111, 0x608B, 0x6111,
+    0x190B, 0x78D1, 0xB0D1, 0xD0B1, 0x986B, 0xB0D1, 0x986B, 0xD0AE,
+    0x986B, 0xD0AE, 0x5084, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x2042, 0x1842, 0x0000, 0x1842, 0xE0B0, 0xA06B, 0xC8AE,
+    0xC8B1, 0xC8B1, 0xD0B1, 0xA8B1, 0x608B, 0xB0D1, 0x90D1, 0x78F1,
+    0x6111, 0x6911, 0x606B, 0x0000, 0x0000, 0x0000, 0x2212, 0x1A53,
+    0x0A0E, 0x0000, 0x0000, 0x0000, 0x09EE, 0x0BD8, 0x0BD8, 0x0479,
+    0x0C79, 0x0479, 0x0C79, 0x0000, 0x0000, 0x0000, 0x0000, 0x0499,
+    0x0BD8, 0x0BF8, 0x0000, 0x0000, 0x0000, 0x1AB4, 0x1A53, 0x1A53,
+    0x3191, 0x2212, 0x190B, 0x4931, 0x4931, 0x6911, 0x6111, 0x78F1,
+    0x608B, 0x90D1, 0x1842, 0x0000, 0x0000, 0x608B, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x5884, 0xE8B0, 0xE0AE, 0xE0B0,
+    0xE0B0, 0xE0B0, 0xC8B1, 0xC8B1, 0xB0D1, 0xA8B1, 0x90D1, 0x90F1,
+    0x78F1, 0x6111, 0x4931, 0x4931, 0x0000, 0x0000, 0x190B, 0x2212,
+    0x2212, 0x0000, 0x0000, 0x0000, 0x0000, 0x09EE, 0x0BF8, 0x0C79,
+    0x0C79, 0x0479, 0x0C79, 0x0479, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0B33, 0x0479, 0x0BD8, 0x2042, 0x0000, 0x09EE, 0x1A73, 0x1A53,
+    0x2212, 0x21F2, 0x3191, 0x3191, 0x3191, 0x4931, 0x4951, 0x6911,
+    0x78F1, 0x78D1, 0x90D1, 0xA8D1, 0x1842, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0xC88E, 0xE0AE, 0xE8AE, 0xE0B0,
+    0xE0B0, 0xE0B0, 0xC8B1, 0xD0B1, 0x988B, 0xA8B1, 0xB0D1, 0x90D1,
+    0x78F1, 0x78F1, 0x6111, 0x6911, 0x4931, 0x5151, 0x190B, 0x3191,
+    0x3191, 0x3191, 0x0000, 0x0000, 0x0000, 0x0000, 0x09EE, 0x0BD8,
+    0x0BD8, 0x0479, 0x0C79, 0x0479, 0x0C99, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0BD8, 0x0BF8, 0x1356, 0x0333, 0x1AB4, 0x12B4,
+    0x1A53, 0x1A53, 0x2212, 0x3191, 0x3191, 0x4931, 0x4931, 0x6111,
+    0x6111, 0x78F1, 0x90F1, 0x88D1, 0x90D1, 0xD0B1, 0xB0D1, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x988B, 0xE8AC, 0xE0AE, 0xE8AE, 0xE0AE,
+    0xE0AE, 0xE0B0, 0xC8B1, 0xE0B0, 0xA8B1, 0x0000, 0xB0D1, 0xA8B1,
+    0x90D1, 0x90F1, 0x6111, 0x6111, 0x4931, 0x4951, 0x3191, 0x3191,
+    0x3191, 0x2212, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x09EE,
+    0x0BF8, 0x0479, 0x0BD8, 0x0499, 0x0C79, 0x0479, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x210B, 0x0BD8, 0x0BD8, 0x12B4, 0x1AB4,
+    0x1A53, 0x1A53, 0x2212, 0x2212, 0x3191, 0x3191, 0x3191, 0x1842,
+    0x210B, 0x60F1, 0x78F1, 0x90D1, 0x90D1, 0xB0D1, 0xA8D1, 0xC8B1,
+    0xD0B1, 0x986B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0xE0AC, 0xE0AA, 0xE8AE, 0xE0AC, 0xE0AE,
+    0xE8AE, 0xE0B0, 0xE0B0, 0xE0B0, 0xA8B1, 0xB0D1, 0xA8B1, 0xD0B1,
+    0x78F1, 0xB0D1, 0x90D1, 0x1842, 0x6111, 0x6911, 0x4931, 0x4931,
+    0x3191, 0x2212, 0x210B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x12B4, 0x0BF8, 0x0BD8, 0x0C79, 0x0479, 0x0C79, 0x0479, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0BF8, 0x1356, 0x1356,
+    0x12B4, 0x12B4, 0x1A53, 0x0000, 0x3191, 0x2212, 0x3191, 0x4931,
+    0x4951, 0x4931, 0x6111, 0x78F1, 0x90D1, 0xB0B1, 0xA8D1, 0xC8B1,
+    0xC8B1, 0xE8B0, 0xC8B1, 0xE0B0, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x5084, 0xE8AA, 0xE8AA, 0xE0AC, 0xE0AC, 0xE0AE,
+    0xE8AE, 0xE0AE, 0xE0AE, 0xC8AE, 0xE0B0, 0xE0B0, 0xC8B1, 0xB0B1,
+    0xA8D1, 0x78D1, 0x90D1, 0x90F1, 0x0000, 0x6111, 0x4931, 0x4951,
+    0x3191, 0x4931, 0x3191, 0x2991, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0B33, 0x0B56, 0x0BF8, 0x0BF8, 0x0C79, 0x0BD8, 0x0BF8,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0B33, 0x0B56, 0x1356,
+    0x1AB4, 0x12B4, 0x2212, 0x21F2, 0x0000, 0x3191, 0x3191, 0x3191,
+    0x3191, 0x4931, 0x4951, 0x6111, 0x78F1, 0x90D1, 0x90D1, 0xB0D1,
+    0xA8D1, 0xD0B1, 0xC8B1, 0xE0B0, 0xE0B0, 0xE0B0, 0x1842, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0xC0C6, 0xE8A8, 0xE0C8, 0xE0AC, 0xE0AA, 0xE8AC,
+    0xE0AC, 0xE0AE, 0xE8AE, 0xE0B0, 0xC8B1, 0xE0B0, 0xC8B1, 0xD0B1,
+    0xA8B1, 0xD0B1, 0x588B, 0xB0D1, 0x90F1, 0x90D1, 0x6111, 0x6911,
+    0x4931, 0x4931, 0x190B, 0x3191, 0x3191, 0x2212, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x1AB4, 0x1356, 0x0B56, 0x0BF8, 0x0BD8, 0x0C79,
+    0x0BD8, 0x0000, 0x0000, 0x0000, 0x0000, 0x3242, 0x1356, 0x1356,
+    0x1A53, 0x0B33, 0x12B4, 0x1A53, 0x2212, 0x2991, 0x3191, 0x3191,
+    0x3191, 0x4951, 0x4931, 0x6111, 0x6111, 0x90F1, 0x90D1, 0x78D1,
+    0xA8D1, 0x78D1, 0xB0D1, 0xC8B1, 0xC8B1, 0xE0B0, 0xE0B0, 0xE0B0,
+    0xA06B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0xC0C6, 0xE0E7, 0xE0C8, 0xE0AA, 0xE8AA, 0xE0AC,
+    0xE0AC, 0xE0AE, 0xE8AC, 0xE0AE, 0x5084, 0x5884, 0xE8B0, 0xE0B0,
+    0x0000, 0xC8B1, 0xA8B1, 0x90D1, 0x90F1, 0x88D1, 0x78F1, 0x78F1,
+    0x6111, 0x6111, 0x0000, 0x0000, 0x210B, 0x3191, 0x2991, 0x210B,
+    0x0000, 0x0000, 0x0000, 0x12B4, 0x12B4, 0x1356, 0x1356, 0x0BD8,
+    0x0BF8, 0x0BD8, 0x0000, 0x0000, 0x0000, 0x0000, 0x1356, 0x0B56,
+    0x1AB4, 0x0000, 0x0000, 0x1A53, 0x2212, 0x2212, 0x3191, 0x3191,
+    0x3191, 0x4931, 0x4931, 0x6111, 0x210B, 0x0000, 0x78F1, 0x90D1,
+    0x0000, 0x90D1, 0xA8D1, 0xD0B1, 0xC8B1, 0xE0B0, 0xE0B0, 0xE0B0,
+    0xE8AE, 0xE0AE, 0xC8AE, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0xE906, 0xE106, 0xE0E7, 0xE108, 0xE0C8, 0xE8AA,
+    0xE0AA, 0xE0AC, 0xE0AC, 0xE8AE, 0xE0AE, 0xE0B0, 0xC8B1, 0xE0B0,
+    0xE8B0, 0xC88E, 0xC8B1, 0xC8B1, 0xB0D1, 0xA8D1, 0x90D1, 0x90D1,
+    0x78F1, 0x78D1, 0x6911, 0x190B, 0x0000, 0x0000, 0x3191, 0x2212,
+    0x3191, 0x0000, 0x0000, 0x0000, 0x1AB4, 0x1356, 0x0B56, 0x1356,
+    0x1356, 0x0BD8, 0x1356, 0x0000, 0x0000, 0x0000, 0x09EE, 0x1356,
+    0x12B4, 0x0000, 0x0000, 0x0000, 0x2212, 0x1A53, 0x2212, 0x2212,
+    0x3191, 0x4931, 0x4951, 0x6111, 0x6111, 0x608B, 0x6111, 0x90D1,
+    0x78D1, 0x78F1, 0xA8B1, 0xC8B1, 0xC8B1, 0xE0B0, 0xE0B0, 0xE0B0,
+    0xE0B0, 0xE0B0, 0xE0AE, 0xE8AE, 0xE0AC, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0xD127, 0xE126, 0xE0E7, 0xE8E7, 0xE0C8, 0xE0A8,
+    0xE0C8, 0xE8AC, 0xC88E, 0xE0AC, 0xE0AC, 0xE8AE, 0xE0AE, 0xE0B0,
+    0xE0B0, 0xE0B0, 0xC8B1, 0xC8B1, 0xA8D1, 0xB0B1, 0x90D1, 0x88F1,
+    0x90D1, 0x78F1, 0x6111, 0x6111, 0x4931, 0x0000, 0x0000, 0x0000,
+    0x3191, 0x2212, 0x1842, 0x0000, 0x2212, 0x1A53, 0x1A53, 0x1AB4,
+    0x12B4, 0x1356, 0x1AB4, 0x0333, 0x1AB4, 0x0000, 0x0000, 0x1356,
+    0x12B4, 0x09EE, 0x0000, 0x0000, 0x09EE, 0x2212, 0x3191, 0x3191,
+    0x3191, 0x3191, 0x3191, 0x4931, 0x4951, 0x6911, 0x6111, 0x78F1,
+    0x90D1, 0xB0D1, 0x88D1, 0xB0D1, 0xA8B1, 0xD0B1, 0xC8B1, 0xE0B0,
+    0xE0B0, 0xE0B0, 0xE8AE, 0xE0AE, 0xE0AC, 0xE0AC, 0xC8AE, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0xE165, 0xE965, 0xE106, 0xE106, 0xE0E7, 0xE8E7,
+    0xE0C8, 0xE8AA, 0x986B, 0x0000, 0xC8AE, 0xE0AE, 0xE0AE, 0xE8AE,
+    0xE0AE, 0xE0B0, 0xE8AE, 0xC8B1, 0xC8B1, 0xC8B1, 0xB0B1, 0xB0D1,
+    0x90D1, 0x0000, 0x6111, 0x78F1, 0x6111, 0x6911, 0x4931, 0x0000,
+    0x0000, 0x2991, 0x3191, 0x3191, 0x2042, 0x2212, 0x0000, 0x12B4,
+    0x1A53, 0x1AB4, 0x12B4, 0x1356, 0x0000, 0x0B33, 0x0000, 0x09EE,
+    0x1AB4, 0x12B4, 0x0000, 0x0000, 0x190B, 0x1A53, 0x2212, 0x2212,
+    0x3191, 0x0000, 0x3191, 0x4931, 0x4931, 0x6111, 0x6111, 0x78F1,
+    0x78F1, 0x90D1, 0x90D1, 0xA8D1, 0xB0B1, 0xC8B1, 0xD0B1, 0x988B,
+    0x1842, 0xE0B0, 0xE0B0, 0xE0AE, 0xE8AE, 0xE0AE, 0xE0AC, 0xE8AC,
+    0xC88A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x90C4, 0xE9C5, 0xE165, 0xE945, 0xE108, 0xE0E7,
+    0xE0C8, 0xE0A8, 0xE8C8, 0xE0AA, 0x0000, 0x0000, 0xE0AC, 0xE0AC,
+    0x0000, 0x0000, 0x986B, 0xE8B0, 0xC8B1, 0xE0B0, 0xC8B1, 0xC8B1,
+    0xB0D1, 0x588B, 0x0000, 0x0000, 0x6111, 0x608B, 0x0000, 0x6111,
+    0x4931, 0x0000, 0x0000, 0x3191, 0x3191, 0x2212, 0x190B, 0x0000,
+    0x2212, 0x1A53, 0x1A53, 0x1AB4, 0x1A53, 0x0000, 0x09EE, 0x09EE,
+    0x1A53, 0x1AB4, 0x190B, 0x0000, 0x210B, 0x2212, 0x210B, 0x0000,
+    0x3191, 0x1842, 0x0000, 0x0000, 0x4931, 0x6911, 0x6111, 0x78F1,
+    0x78D1, 0x90D1, 0x608B, 0x0000, 0x1842, 0xB0D1, 0xD0B1, 0x1842,
+    0x0000, 0xD0AE, 0xE0AE, 0xE0B0, 0xE8AE, 0xE0AE, 0xE0AC, 0xE0AC,
+    0xE8AA, 0xE0AA, 0x90C4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0xEA85, 0xE9C5, 0xE9C5, 0xE945, 0xE165,
+    0xE0E7, 0xE108, 0xE0A8, 0xE8AA, 0xE0AA, 0xA08B, 0x5084, 0xE8AE,
+    0xC88E, 0x0000, 0x0000, 0xC8AE, 0xE0B0, 0xE0B0, 0xE0B0, 0xE0B0,
+    0xD0B1, 0xD0B1, 0x1842, 0x0000, 0x0000, 0x608B, 0x78F1, 0x0000,
+    0x0000, 0x6111, 0x4931, 0x0000, 0x3191, 0x4931, 0x3191, 0x0000,
+    0x0000, 0x2212, 0x21F2, 0x1A53, 0x2212, 0x1A53, 0x0000, 0x210B,
+    0x1A53, 0x1AB4, 0x1A53, 0x1842, 0x210B, 0x2212, 0x190B, 0x0000,
+    0x3191, 0x4931, 0x0000, 0x0000, 0x0000, 0x6111, 0x6111, 0x78F1,
+    0x78F1, 0x90D1, 0x90D1, 0xA8D1, 0x0000, 0x0000, 0x90D1, 0xE0B0,
+    0x988B, 0x0000, 0xE0B0, 0xE0B0, 0xE0AE, 0xE0AE, 0xE8AE, 0xE0AE,
+    0xE0AC, 0xE108, 0xE0AA, 0xE8AA, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x5084, 0xE9C5, 0xE9C5, 0xE145, 0xE965,
+    0xE106, 0xE106, 0xE0C8, 0xE8C8, 0xE0A8, 0xE0AA, 0xE0AA, 0xC88A,
+    0xE8AC, 0xE0AE, 0x0000, 0x0000, 0xE0AE, 0xE0B0, 0xE0B0, 0xE0B0,
+    0xC8AE, 0x1842, 0xB0D1, 0x608B, 0x0000, 0x0000, 0x0000, 0x78D1,
+    0x6111, 0x0000, 0x0000, 0x4931, 0x4951, 0x4931, 0x3191, 0x3191,
+    0x0000, 0x0000, 0x3191, 0x2212, 0x2991, 0x2212, 0x2212, 0x0000,
+    0x0000, 0x21F2, 0x2212, 0x2212, 0x3191, 0x21F2, 0x190B, 0x0000,
+    0x0000, 0x3191, 0x2042, 0x0000, 0x0000, 0x0000, 0x4931, 0x4951,
+    0x2042, 0x90D1, 0x90F1, 0x90D1, 0xA8D1, 0xA08B, 0x0000, 0xC8B1,
+    0xC8B1, 0xC88E, 0xD0AE, 0xE0B0, 0xE0AE, 0xE8AE, 0xE0AC, 0xE0AE,
+    0xE0AC, 0xE8AC, 0xE0AA, 0xE0AA, 0xE0A8, 0x5884, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x5064, 0xEA85, 0xE9C5, 0xE9C5,
+    0xE165, 0xE965, 0xE106, 0xE108, 0xE0A8, 0xC0C6, 0xE0C8, 0xE8AA,
+    0xE0AA, 0xE8AA, 0xE8AC, 0x1842, 0x986B, 0xE0B0, 0xE0B0, 0xE0B0,
+    0xE0B0, 0xE0B0, 0xC8B1, 0xD0B1, 0xB0D1, 0x78F1, 0x90D1, 0x78D1,
+    0x78F1, 0x90F1, 0x190B, 0x0000, 0x0000, 0x5131, 0x4931, 0x4931,
+    0x190B, 0x0000, 0x0000, 0x3191, 0x3191, 0x2212, 0x3191, 0x2212,
+    0x0000, 0x0000, 0x09EE, 0x2212, 0x3191, 0x2212, 0x0000, 0x0000,
+    0x0000, 0x4931, 0x3191, 0x210B, 0x190B, 0x608B, 0x190B, 0x6111,
+    0x6111, 0x90F1, 0x90D1, 0xA8D1, 0x90D1, 0xB0B1, 0xA8D1, 0x608B,
+    0xC8B1, 0xD0B1, 0x986B, 0xE0B0, 0xE0B0, 0xC8B1, 0xE0AE, 0xE0AE,
+    0xE0AC, 0xE8AC, 0xE0AA, 0xE0AA, 0xE0C8, 0xE8AA, 0x5884, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5884, 0xF285, 0xF285,
+    0xE9C5, 0xE9C5, 0xE106, 0xE106, 0xE0E7, 0xE0E7, 0x5884, 0x0000,
+    0xE8C8, 0xE0AC, 0xE0AA, 0xE0AC, 0xE8AC, 0xE0AE, 0xE0AE, 0xE0B0,
+    0x986B, 0x0000, 0xC8B1, 0xE8B0, 0xA8D1, 0x78D1, 0x588B, 0x78F1,
+    0xA06B, 0x90D1, 0x78F1, 0x78F1, 0x6111, 0x190B, 0x0000, 0x6111,
+    0x4931, 0x2042, 0x0000, 0x0000, 0x3191, 0x3191, 0x2991, 0x3191,
+    0x3191, 0x0000, 0x0000, 0x0000, 0x3191, 0x2991, 0x2042, 0x0000,
+    0x190B, 0x4931, 0x3191, 0x4951, 0x5131, 0x4951, 0x608B, 0x6111,
+    0x6911, 0x78F1, 0x78D1, 0x1842, 0x0000, 0xB0D1, 0xB0B1, 0xC8B1,
+    0xC8B1, 0xE8B0, 0xC8B1, 0xE0B0, 0xE0B0, 0x988B, 0x0000, 0xC88E,
+    0xE8AC, 0xE0AC, 0xE8AA, 0xE0AA, 0xE0C8, 0xE0AA, 0xE8A8, 0x1842,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xEA85,
+    0xE9C5, 0xF285, 0xE1A6, 0xE965, 0xE126, 0xE906, 0x90C4, 0xC0C6,
+    0xE0C8, 0xE0AA, 0xE0AA, 0xE8AC, 0xE0AC, 0xE0AE, 0xE0AE, 0xE8AE,
+    0xE0AE, 0xA06B, 0xC8B1, 0xC8AE, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x78F1, 0x90D1, 0x78F1, 0x90D1, 0x78D1, 0x78F1,
+    0x6111, 0x6911, 0x0000, 0x0000, 0x0000, 0x4951, 0x3191, 0x4931,
+    0x3191, 0x4951, 0x0000, 0x0000, 0x0000, 0x4931, 0x3191, 0x4951,
+    0x3191, 0x5131, 0x190B, 0x5151, 0x4931, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x190B, 0x78D1, 0x608B, 0x1842, 0xB0D1, 0xC8B1,
+    0xC8B1, 0xE0B0, 0xE0B0, 0xE0B0, 0xE0B0, 0xE0B0, 0xC8B1, 0xA06B,
+    0x5084, 0xE0AE, 0xE8AC, 0xE0AC, 0xE0AA, 0xE0AA, 0xE8C8, 0xE108,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0xEA65, 0xF285, 0xE9C5, 0xE9C5, 0xE145, 0xE145, 0xE108, 0xE0E7,
+    0xC0C6, 0xE0C8, 0xE0A8, 0xE8AA, 0xE0AA, 0xE0AC, 0xE0AC, 0xE8AE,
+    0xC8AE, 0xE0AE, 0xE0AE, 0xC88E, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0xB0D1, 0x88D1, 0x0000, 0x0000, 0x1842,
+    0x6911, 0x78F1, 0x608B, 0x0000, 0x0000, 0x0000, 0x4931, 0x4931,
+    0x3191, 0x4951, 0x3191, 0x0000, 0x0000, 0x0000, 0x190B, 0x4931,
+    0x3191, 0x210B, 0x0000, 0x0000, 0x4951, 0x6911, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x608B, 0xA8D1, 0xD0B1,
+    0xA8B1, 0xC8B1, 0xD0B1, 0xE0B0, 0xE0B0, 0xE0B0, 0xE0AE, 0xE8AE,
+    0xE0AE, 0xC88A, 0xE0AC, 0xE0AC, 0xE8AA, 0xE0AA, 0xE0C8, 0xE0C8,
+    0xE8A8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0xF365, 0xEA85, 0xEA85, 0xE9C5, 0xE9C5, 0xE945, 0xE165,
+    0xE0E7, 0xE108, 0xE0A8, 0xE8AA, 0xC0C6, 0xE0AC, 0xE0AA, 0xE0AC,
+    0xE8AC, 0xE0AC, 0xC8AE, 0xE0B0, 0xE8AE, 0xA06B, 0x1842, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0xA8D1, 0xB0D1, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x608B, 0x608B, 0x0000, 0x0000, 0x0000, 0x6111,
+    0x4931, 0x6911, 0x4951, 0x5131, 0x0000, 0x0000, 0x0000, 0x4951,
+    0x4931, 0x0000, 0x0000, 0x0000, 0x0000, 0x6111, 0x6911, 0x1842,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x1842, 0xB0B1, 0xA8D1, 0xC8B1,
+    0xB0B1, 0x78F1, 0xC8B1, 0xE0B0, 0xE0B0, 0xE0B0, 0xE0AE, 0xE0B0,
+    0xE0AE, 0xE0AE, 0xE8AC, 0xE0AC, 0xE0AA, 0xE0AC, 0xE8AA, 0xE0A8,
+    0xE0C8, 0xD127, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0xCA64, 0xF265, 0xE9C5, 0xE9C5, 0xE145, 0xE165,
+    0xE106, 0xE106, 0xE8E7, 0xE0E7, 0xC8AA, 0x0000, 0xC88A, 0xE0AA,
+    0xE0AA, 0xE8AC, 0xE0AC, 0xE0AE, 0x0000, 0xC8AE, 0xC8B1, 0xE0B0,
+    0xE0B0, 0xE0B0, 0xC8B1, 0xD0B1, 0xC8B1, 0xC8B1, 0x988B, 0x0000,
+    0x0000, 0x0000, 0x608B, 0x90D1, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x608B, 0x6111, 0x4931, 0x6111, 0x608B, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x6111, 0x190B, 0x0000, 0x0000, 0x0000, 0x6911, 0x78F1,
+    0x78F1, 0x90D1, 0x90D1, 0x90F1, 0x90D1, 0xA8D1, 0xB0D1, 0xA8B1,
+    0x0000, 0x90D1, 0xC8B1, 0xE0B0, 0xE0B0, 0xE0B0, 0xC8AE, 0x0000,
+    0xA08B, 0xE0AE, 0xE8AC, 0xE0AC, 0xE0AA, 0xE0AC, 0xE8A8, 0xE0AA,
+    0xE0C8, 0xE0E7, 0x90C4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0xCA64, 0xEA65, 0xF285, 0xE9C5, 0xE9C5,
+    0xE165, 0xE165, 0xE106, 0xE906, 0xE0E7, 0xE108, 0xE0C8, 0xE0AA,
+    0xE8AA, 0xE0AC, 0xE8AC, 0xE8AE, 0x1842, 0x0000, 0x0000, 0x0000,
+    0x588B, 0xD0B1, 0xC88E, 0xC8AE, 0xC8B1, 0xE0B0, 0xD0B1, 0xB0B1,
+    0x0000, 0x0000, 0x1842, 0xB0D1, 0x90D1, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x78F1, 0x78D1, 0x6111, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x6111, 0x78F1, 0x1842, 0x0000, 0x0000, 0x78D1,
+    0x78F1, 0x90F1, 0x90D1, 0xB0B1, 0x78F1, 0x78D1, 0x1842, 0x0000,
+    0x0000, 0x0000, 0x0000, 0xE0B0, 0xE0B0, 0xE0B0, 0xE0B0, 0xE0B0,
+    0xE0AE, 0xE0AE, 0xE0AE, 0xE8AE, 0xE0AC, 0xE0AC, 0xE0AA, 0xE8AA,
+    0xE0C8, 0xE108, 0xE8E7, 0x5884, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x90C4, 0xFB65, 0xEA85, 0xF285,
+    0xE9C5, 0xE9C5, 0xE145, 0xE145, 0xE106, 0xE0E7, 0xE0C8, 0xE8C8,
+    0xE0A8, 0xE0AA, 0xE0AA, 0xE8AC, 0xC88A, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x988B, 0x988B, 0xC8B1,
+    0xB0B1, 0x0000, 0x588B, 0xB0D1, 0xB0B1, 0x588B, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x190B, 0x608B, 0x2042, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x608B, 0x78F1, 0x78D1, 0x1842, 0x0000,
+    0x78F1, 0x90D1, 0x90D1, 0x608B, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x988B, 0xE8B0, 0xE0AE, 0xE0B0,
+    0xE8AE, 0xE0AE, 0xE0AC, 0xE0AC, 0xE8AC, 0xE0AC, 0xE0AA, 0xE0AA,
+    0xE8C8, 0xE0A8, 0xE0C8, 0xE0E7, 0x5884, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3242, 0xFB65, 0xF365,
+    0xEA85, 0xEA85, 0xE9C5, 0xE9C5, 0xE906, 0xE106, 0xE108, 0xE0E7,
+    0xE0C8, 0xE8AA, 0xE0A8, 0xE8AA, 0xE8AA, 0x1842, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xC8AE, 0xB0B1, 0x988B,
+    0xC8B1, 0xC8B1, 0xB0B1, 0xC8B1, 0xB0D1, 0xC8B1, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x90F1, 0x88D1, 0x90D1,
+    0x78F1, 0xB0D1, 0x88D1, 0x90D1, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE0B0, 0xE0B0,
+    0xE0AE, 0xE0AE, 0xE0AE, 0xE8AE, 0xE0AC, 0xE0AC, 0xE0AA, 0xE8AA,
+    0xE0C8, 0xE0AA, 0xE0A8, 0xE8E7, 0xE8E7, 0x1842, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF365,
+    0xF265, 0xF285, 0xE9C5, 0xE1C5, 0x90C4, 0x0000, 0x0000, 0xE906,
+    0xC0C6, 0x0000, 0x0000, 0xC0C6, 0xE0C8, 0xE0AA, 0xC88E, 0xE8AC,
+    0xE0AC, 0xC8AE, 0x986B, 0x5884, 0x0000, 0x0000, 0x988B, 0xD0B1,
+    0xE0B0, 0xE0B0, 0xC8B1, 0xC8B1, 0xD0B1, 0xC8B1, 0x986B, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x608B, 0x90D1,
+    0x90F1, 0xA8D1, 0xB0B1, 0xA8D1, 0x90D1, 0x5884, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x1842, 0xA08B, 0xC88E, 0xE8AE, 0xA8D1, 0xE0B0,
+    0xE8AE, 0xC88E, 0x1842, 0x0000, 0x608B, 0xE8AC, 0x588B, 0x0000,
+    0x988B, 0xE8A8, 0xE0C8, 0xE8E7, 0xE0E7, 0xE106, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0xF365, 0xF365, 0xF285, 0xEA85, 0xE9C5, 0x0000, 0x0000, 0x0000,
+    0xE106, 0xE906, 0x5884, 0xC0C6, 0xE0C8, 0xE0AA, 0xE0AA, 0xE8AC,
+    0xE0AA, 0xE0AC, 0xE0AC, 0xE8AE, 0xE0AE, 0xE0AE, 0xE8AE, 0xE0B0,
+    0xE0B0, 0xE0B0, 0xE0B0, 0xE0B0, 0xC8B1, 0xC8B1, 0xB0B1, 0xB0D1,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x78D1,
+    0x1842, 0xB0D1, 0xA8B1, 0xC8B1, 0xB0D1, 0xC8B1, 0xC8B1, 0xD0B1,
+    0xC88E, 0xC8B1, 0xE0B0, 0xE0B0, 0xE0B0, 0xE0B0, 0xE0B0, 0xE0B0,
+    0xE0AE, 0xE0AE, 0xE8AE, 0x988B, 0x0000, 0xC88E, 0xE8AA, 0x988B,
+    0x0000, 0x0000, 0xC0C6, 0xE0E7, 0xE0E7, 0xE926, 0xE106, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0xF365, 0xFB65, 0xF365, 0xF285, 0xE1A6, 0x0000, 0x0000,
+    0x0000, 0xC165, 0xE106, 0xE126, 0xE8E7, 0xE0E7, 0xE0C8, 0xE0A8,
+    0xE8C8, 0xE0AA, 0xE0AA, 0xE0AC, 0xE8AC, 0xE0AE, 0xE0AC, 0xE0AE,
+    0xE8AE, 0xE0B0, 0xE0AE, 0xE0B0, 0xE0B0, 0xE0B0, 0x588B, 0xC8B1,
+    0x1842, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x608B, 0xB0B1, 0x0000, 0xD0B1, 0xA8D1, 0xC8B1, 0xD0B1, 0xC8B1,
+    0xC8B1, 0xE0B0, 0xC8B1, 0xE8B0, 0xE0B0, 0xE0B0, 0xE0AE, 0xE0B0,
+    0xE0AE, 0xE8AE, 0xE0AC, 0xE0AE, 0xE0AC, 0xE8AC, 0xE0AA, 0xE0AA,
+    0x0000, 0x0000, 0x0000, 0x1842, 0xE8E7, 0xE106, 0xE906, 0xC0C6,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x9AA3, 0xFC85, 0xF365, 0xFB65, 0xC165, 0x0000,
+    0x0000, 0x0000, 0x5084, 0xE965, 0xE126, 0xE106, 0xE0E7, 0xE8E7,
+    0x98C4, 0x90E4, 0xE0AA, 0xE0AC, 0xE0AA, 0xE8AC, 0xE0AC, 0xE0AE,
+    0xE0AE, 0xE8AE, 0xE0AE, 0xE0B0, 0xE0AE, 0xE8B0, 0x986B, 0xC8B1,
+    0xE0B0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0xD0B1, 0x988B, 0x608B, 0xC8B1, 0xC8B1, 0xE0B0,
+    0xC8B1, 0xE0B0, 0xE0B0, 0xE0B0, 0xE0B0, 0xE0B0, 0xE0B0, 0xE0B0,
+    0xE0AE, 0xE8AE, 0xC8AE, 0xE0AE, 0xE0AC, 0xE8AC, 0xE0AA, 0xE0AC,
+    0xC0C6, 0x0000, 0x0000, 0x0000, 0x0000, 0xE106, 0xE906, 0xE165,
+    0x90E4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x5084, 0xFB65, 0xFB65, 0xEA85, 0xC165,
+    0x0000, 0x0000, 0x0000, 0xE906, 0xE165, 0xE165, 0xE108, 0x90C4,
+    0x0000, 0x0000, 0x988B, 0xE8AA, 0xE8A8, 0xE0AA, 0xE0AA, 0xE0AC,
+    0xC8AE, 0xE8AE, 0xE0AC, 0xE0AE, 0xE8AE, 0xE0B0, 0xE0AE, 0x0000,
+    0xC8B1, 0xC88E, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0xA8D1, 0xB0B1, 0x0000, 0xC8B1, 0xE0B0,
+    0xC8B1, 0xE8B0, 0xE0B0, 0xE0B0, 0xC8AE, 0xE0B0, 0xE0AE, 0xE8AE,
+    0xE0AE, 0xE0AE, 0xC88E, 0x0000, 0x0000, 0x988B, 0xE8AA, 0xE0AA,
+    0xE8A8, 0xE0AA, 0x0000, 0x0000, 0x0000, 0x5084, 0xE108, 0xE965,
+    0xE145, 0x1842, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFC85, 0xF365, 0xFB65,
+    0x90E4, 0x0000, 0x0000, 0x0000, 0xE1A6, 0xE9C5, 0xE165, 0xE906,
+    0x0000, 0x0000, 0x90C4, 0xE0E7, 0xE0C8, 0xE8AA, 0x98C4, 0x90E4,
+    0xE0AA, 0xE0AC, 0xE0AC, 0xE8AE, 0x0000, 0xC88E, 0xE0AE, 0xE8AE,
+    0x988B, 0xE8B0, 0x2042, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x1842, 0xE8B0, 0x1842, 0x986B,
+    0xE0B0, 0xC8B1, 0x1842, 0xE0B0, 0xE0B0, 0xE0B0, 0xE8AE, 0xC8AE,
+    0x986B, 0xE8AE, 0xE0AE, 0xE8AE, 0x988B, 0x0000, 0x0000, 0x986B,
+    0xE0AA, 0xE8AA, 0xE8C8, 0x0000, 0x0000, 0x0000, 0x1842, 0xE145,
+    0xE965, 0xE9C5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCB84, 0xF485,
+    0xF365, 0x9AA3, 0x0000, 0x0000, 0x0000, 0xE9A6, 0xE165, 0xE145,
+    0xE906, 0x90E4, 0x5084, 0xE8E7, 0xE8C8, 0xE0A8, 0x988B, 0x0000,
+    0xC88A, 0xE8AA, 0xE0AA, 0x5084, 0x0000, 0xA08B, 0xE0AC, 0xE8AE,
+    0xE0AE, 0xE0AE, 0xC88E, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xC8B1, 0xE0B0,
+    0xE8AE, 0xE0B0, 0xE0AE, 0x588B, 0x0000, 0x608B, 0xE8AE, 0xE0AE,
+    0xC8AE, 0x0000, 0x986B, 0xE8AC, 0xE0AC, 0xE8AC, 0x1842, 0x90E4,
+    0xE8A8, 0xE0AA, 0xE8C8, 0xE0A8, 0x0000, 0x0000, 0x0000, 0x90E4,
+    0xD127, 0xE945, 0xC185, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCB84,
+    0xFC85, 0xCA64, 0x9AC3, 0x90E4, 0x0000, 0x0000, 0x0000, 0xE9C5,
+    0xE1A6, 0xE165, 0xE906, 0xE165, 0xE106, 0xE906, 0x98E4, 0x0000,
+    0x5084, 0xE0AA, 0xE8AA, 0x0000, 0x0000, 0xC88E, 0xE0AC, 0xE0AC,
+    0xE8AC, 0x988B, 0xE8AE, 0x986B, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x988B,
+    0xE0B0, 0xC8B1, 0xE8AE, 0xE0B0, 0xE0AE, 0x986B, 0x0000, 0x0000,
+    0xE8AE, 0xE8AE, 0x1842, 0x0000, 0x90E4, 0xE0AC, 0xE8AA, 0xE0AA,
+    0xC88A, 0xE0C8, 0xE0A8, 0xE8E7, 0x98E4, 0x0000, 0x0000, 0x0000,
+    0x90C4, 0xE165, 0xE9C5, 0xC165, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x5064, 0xFD85, 0xFB65, 0x5084, 0xCA64, 0x0000, 0x0000, 0x0000,
+    0xC965, 0xE9C5, 0xE165, 0xE945, 0xE106, 0xE126, 0x90E4, 0xC0C6,
+    0xE8A8, 0xE0E7, 0xE0C8, 0xE8A8, 0x988B, 0xE0AA, 0xE8AA, 0xE0AC,
+    0x5084, 0x0000, 0xE8AC, 0xE0AC, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0xE0B0, 0xE8AE, 0x0000, 0x588B, 0xE8AE, 0xE0AE, 0xE0AC,
+    0x0000, 0xE0AE, 0xE8AC, 0xE0AC, 0xC88E, 0x0000, 0x5084, 0xE8AA,
+    0xE8C8, 0xE0A8, 0xE0C8, 0xE0E7, 0xE8A8, 0x0000, 0x0000, 0x0000,
+    0x90E4, 0x90C4, 0xC185, 0xE9C5, 0x1842, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0xFD65, 0xFD85, 0x5084, 0x9AA3, 0xF365, 0xF285,
+    0x0000, 0xEA85, 0xE9C5, 0xE9C5, 0xE1A6, 0xE9C5, 0xE165, 0xE965,
+    0xE106, 0xE126, 0xE0E7, 0x0000, 0xC88A, 0xE8AA, 0xE0C8, 0xC88A,
+    0x0000, 0x0000, 0xE0AA, 0xE8AC, 0x5884, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x5084, 0xE8AE, 0xE0AE, 0x0000, 0x0000, 0xE0AA,
+    0xE0AC, 0xE8AE, 0xE8AC, 0x5084, 0xC88A, 0xE108, 0xE0AA, 0xE0AA,
+    0xE8C8, 0xE0AA, 0xE0A8, 0xE0E7, 0xE8E7, 0xE108, 0x0000, 0x5884,
+    0x98E4, 0xC165, 0x1842, 0xE9C5, 0xF1C5, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0xFC85, 0xFC65, 0xF365, 0x0000, 0x9AA3,
+    0xF285, 0xF365, 0xEA85, 0x5064, 0x0000, 0x98E4, 0x0000, 0xE945,
+    0xE165, 0xE145, 0xC0C6, 0x0000, 0x0000, 0xC88A, 0xE8C8, 0x5084,
+    0x0000, 0x5884, 0xE8C8, 0xE0AA, 0x986B, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x988B, 0xE8AE, 0xE8AC, 0x0000,
+    0x0000, 0x5084, 0xE8AA, 0xE0AA, 0x0000, 0x0000, 0xC88A, 0xE0AA,
+    0xE8C8, 0xE0A8, 0x5084, 0x5884, 0x0000, 0x1842, 0xE908, 0xE906,
+    0xC0C6, 0x90E4, 0x0000, 0x5884, 0xE9C5, 0xCA64, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x9AA3, 0xFD65, 0xFC85, 0x0000,
+    0x0000, 0x9AC3, 0xF365, 0x9AA3, 0x0000, 0x0000, 0x0000, 0x0000,
+    0xE165, 0xE9C5, 0xE165, 0x0000, 0x0000, 0xE906, 0xE8E7, 0x0000,
+    0x0000, 0x1842, 0xE0A8, 0xE0AA, 0xE0C8, 0xC8AA, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE8AC, 0xE0AC, 0xC88A,
+    0xE8AC, 0x5084, 0x0000, 0x0000, 0xE0AA, 0xE8AC, 0x0000, 0x0000,
+    0xE0A8, 0xE0E7, 0xE8C8, 0x0000, 0x0000, 0x0000, 0x0000, 0x90C4,
+    0xE965, 0xC165, 0x0000, 0x0000, 0x90C4, 0xF285, 0x90E4, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFD85, 0xFD85,
+    0x0000, 0xF465, 0xF365, 0x90C4, 0x0000, 0x0000, 0x0000, 0x0000,
+    0xC985, 0xE9C5, 0xE145, 0x90E4, 0x0000, 0xE945, 0xC0C6, 0x0000,
+    0x0000, 0x0000, 0xC88A, 0xE0C8, 0xE0C8, 0xE8A8, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE0AC,
+    0xE0AA, 0xC88A, 0xC8AE, 0x1842, 0x0000, 0x0000, 0xE8C8, 0xE8A8,
+    0x0000, 0x5084, 0xE8C8, 0xE0E7, 0xC0C6, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x90C4, 0xE965, 0xC165, 0x0000, 0xF285, 0xEA85, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFD65,
+    0xFD85, 0xFD65, 0xFC85, 0xFC85, 0x5064, 0x0000, 0x0000, 0x0000,
+    0x0000, 0xEA85, 0xF265, 0xF285, 0x5084, 0xE9C5, 0xE165, 0x0000,
+    0x0000, 0x0000, 0xE8E7, 0xE126, 0xE0E7, 0xE108, 0xC0C6, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0xC88A, 0xE108, 0xE0AA, 0xE8AA, 0xE0A8, 0x0000, 0x0000, 0x0000,
+    0xE0C8, 0xE108, 0x0000, 0xE108, 0xE0E7, 0xE945, 0x90C4, 0x0000,
+    0x0000, 0x0000, 0x0000, 0xE1C5, 0xE9C5, 0xF285, 0xF265, 0xF365,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x9AA3, 0xFE85, 0xF565, 0x9AA3, 0xFC85, 0xFC85, 0xCB84, 0xCA64,
+    0xCA64, 0xF365, 0xEA65, 0x0000, 0xE9C5, 0xE9C5, 0xC165, 0x0000,
+    0x0000, 0x0000, 0x90E4, 0xE906, 0xE106, 0xE126, 0xE0E7, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0xE8C8, 0xE0A8, 0xE0C8, 0xE0A8, 0x988B, 0x0000,
+    0x0000, 0x0000, 0xC0C6, 0xE108, 0xE906, 0x90E4, 0xC0C6, 0xE945,
+    0xC0C6, 0x90E4, 0x90C4, 0xE9C5, 0xE9C5, 0x1842, 0xCA64, 0xFB65,
+    0x90E4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0xFE65, 0xFD85, 0xCB84, 0xFD85, 0xCB84, 0xF365,
+    0x9AA3, 0xFC85, 0xFB65, 0x0000, 0x5064, 0xF365, 0xF285, 0xEA85,
+    0xE9C5, 0xE9C5, 0xE145, 0xE165, 0xE945, 0xE165, 0xE906, 0x90E4,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0xC0C6, 0xE0A8, 0xE0E7, 0xE0C8, 0xE8E7,
+    0xE0C8, 0xD127, 0xC0C6, 0xD127, 0xE906, 0xE165, 0xE106, 0x0000,
+    0xE145, 0xE9C5, 0x90C4, 0xE9C5, 0xE9C5, 0xF285, 0xCA64, 0xF365,
+    0xFB65, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0xF665, 0xFD65, 0x0000, 0x9AA3, 0x3242,
+    0x9AA3, 0xFC85, 0xFB65, 0x62A3, 0x0000, 0xF365, 0xF285, 0xF265,
+    0xEA85, 0xF265, 0xE9C5, 0xE1C5, 0xE145, 0xE9C5, 0xE165, 0xE145,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE8E7, 0xE0C8, 0xE0E7,
+    0xE0E7, 0xE906, 0xE108, 0xE106, 0xE126, 0xE165, 0xE945, 0xE1A6,
+    0x0000, 0x5084, 0xE9C5, 0xCA84, 0xC165, 0x98E4, 0x90C4, 0x5884,
+    0xFB65, 0xF365, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x62A3, 0xFE65, 0xFD85, 0xFD65,
+    0xCC84, 0xF565, 0xFC85, 0xF465, 0x0000, 0xFC85, 0xFB65, 0xCA64,
+    0xC185, 0xCA64, 0xC165, 0xEA85, 0xE9C5, 0xF285, 0xE9C5, 0xF1C5,
+    0x1842, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5084, 0xE106,
+    0xE106, 0xE965, 0xE106, 0xE165, 0xC0C6, 0xC0C6, 0xC165, 0xC165,
+    0xE9C5, 0xE9C5, 0x0000, 0xEA85, 0xF285, 0xFB65, 0x90C4, 0xF365,
+    0xFB65, 0xFC85, 0x1842, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFD65, 0xFE85,
+    0xF565, 0xFE65, 0xFD65, 0x5084, 0x9AA3, 0xFC85, 0xFC85, 0xF365,
+    0xCA64, 0xCA64, 0xF265, 0xF365, 0xF285, 0xEA65, 0xE9C5, 0xE9C5,
+    0x90C4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0xC0C6, 0xE165, 0xE106, 0xE965, 0xE145, 0xE9C5, 0xE165, 0xC165,
+    0x90E4, 0xE9C5, 0xE9C5, 0xC165, 0xC185, 0x90C4, 0xF285, 0xFB65,
+    0xF365, 0xFC85, 0xCB84, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x62A3,
+    0xFE85, 0xFF25, 0xCC84, 0x9AA3, 0x5084, 0xFD65, 0xFD85, 0x9AC3,
+    0x90C4, 0xFC65, 0xF365, 0xFC85, 0xF365, 0xF365, 0xF265, 0xEA85,
+    0xE9C5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0xE165, 0xE9C5, 0xE145, 0xE9C5, 0xE1C5, 0xE9C5,
+    0xE9C5, 0xF285, 0xC965, 0x5084, 0xF285, 0xFB65, 0x90C4, 0x62A3,
+    0xCA64, 0xF465, 0xFC85, 0x3222, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0xFE65, 0xFE65, 0x0000, 0x9CE5, 0xCC64, 0xFD65, 0xFD85,
+    0x9AA3, 0xFD85, 0xF465, 0xFC85, 0xF365, 0xFC65, 0xF365, 0xF365,
+    0xF285, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0xE1A6, 0xE9C5, 0xE9C5, 0xEA85,
+    0xE9C5, 0xEA65, 0xF285, 0xEA65, 0x90C4, 0xCB84, 0xFB65, 0xCA64,
+    0x90E4, 0x9AA3, 0xFC85, 0xFC85, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x1842, 0xF725, 0xFE65, 0xFE65, 0xF665, 0xFE65,
+    0xCC64, 0xFE85, 0xFD65, 0xF585, 0xFC65, 0xFD85, 0xF465, 0xFC85,
+    0xF365, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE9C5, 0xEA65,
+    0xF285, 0xF365, 0xF265, 0xF365, 0xF365, 0xFC85, 0xF365, 0xF465,
+    0xFC85, 0xF465, 0xFC85, 0xF565, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0xCB84, 0xFF25, 0xFE65, 0xFE65,
+    0xF665, 0xFE65, 0xFD65, 0xFD85, 0xF565, 0xFD85, 0xFC65, 0xF485,
+    0xFC65, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0xC165, 0xF365, 0xF285, 0xF365, 0xF365, 0xF365, 0xF365, 0xFC85,
+    0xF365, 0xFC65, 0xF485, 0xFD65, 0x62A3, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCD65, 0xF725,
+    0xFE65, 0xF725, 0xFE65, 0xFE85, 0xF565, 0xFE65, 0xFD85, 0xFD65,
+    0xFC85, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x90C4, 0xF365, 0xF365, 0xFC85, 0xF465, 0xFC85,
+    0xF465, 0xFD85, 0xFD65, 0xFD85, 0xCB84, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x9CE5, 0xF725, 0xFE65, 0xF725, 0xFE65, 0xFE65, 0xFD65, 0xFD85,
+    0x62A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x5064, 0xFC85, 0xFC85, 0xFC65,
+    0xF485, 0xFD65, 0xFD85, 0xFD65, 0x9AA3, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x3222, 0xFE65, 0xFE65, 0xFE85, 0xFD85, 0x9AA3,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9AA3,
+    0xCC84, 0xFD65, 0xFD85, 0xCD85, 0x5084, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000 },
+  { 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6AA3, 0x9CE5, 0xCD85,
+    0x9CE5, 0x6CA6, 0x1842, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2042, 0x9AA3,
+    0x9CE5, 0xD585, 0x9CE5, 0x6AA3, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x64A6, 0xA6A7, 0xCF26,
+    0xCF26, 0xFF25, 0xCE86, 0xD686, 0xA2A3, 0x3242, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3242, 0x9AA3, 0xCC64,
+    0xF565, 0xFE65, 0xFE65, 0xFE85, 0xD565, 0x64A6, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xAEC7, 0xA6A7, 0xD726,
+    0xCF26, 0xF725, 0xCF26, 0xFF25, 0xF725, 0xF725, 0xFE65, 0xFE65,
+    0xCB84, 0x1842, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x1842, 0xA2A3, 0xFC85, 0xFC65, 0xFD85,
+    0xF565, 0xFD85, 0xFD65, 0xFE85, 0xF665, 0xF725, 0xFE65, 0xCE66,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8667, 0xD726, 0xCF26,
+    0xCF26, 0xF725, 0xFF25, 0xF725, 0xF725, 0xF725, 0xFF25, 0xF725,
+    0xFE65, 0xFE65, 0xFD85, 0xFD65, 0x3242, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x5084, 0xF365, 0xF365, 0xFC65, 0xF485, 0xFC65,
+    0xF485, 0xFD65, 0xFD85, 0xFD65, 0xF565, 0xFE65, 0xFE65, 0xFF25,
+    0xFE85, 0xCD65, 0x0000, 0x0000, 0x0000, 0x3222, 0xA6C7, 0xD726,
+    0xCF26, 0xF725, 0xCF26, 0xFF25, 0xF725, 0xF725, 0xFE65, 0xFE65,
+    0xFE65, 0xFE65, 0xF565, 0xFD85, 0xFD65, 0xFD85, 0xCC64, 0x62A3,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x90C4, 0xE9C5, 0xF285, 0xEA85, 0xF365, 0xFB65, 0xF365,
+    0xF365, 0xFC65, 0xF485, 0xFD65, 0xFD85, 0xFD65, 0xF585, 0xFE65,
+    0xFE65, 0xFE65, 0xF665, 0x1842, 0x0000, 0x0000, 0x64A6, 0xCF26,
+    0xCF26, 0xF725, 0xD666, 0xF725, 0xF725, 0xFF25, 0xF725, 0xF725,
+    0xF665, 0xFE85, 0xFD65, 0xFD85, 0xF565, 0xFD85, 0xFC65, 0xF485,
+    0xFB65, 0xFC85, 0x62A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x90C4, 0xE1C5, 0xE9C5, 0xF265, 0xE9C5, 0xEA85, 0xF265, 0xF365,
+    0xF365, 0xFC85, 0xF365, 0xF465, 0xFC85, 0xFD65, 0xF585, 0xFD65,
+    0xFD65, 0xFE65, 0xFE85, 0xFF25, 0x9AA3, 0x0000, 0x0000, 0xAEC7,
+    0xCF26, 0xFF25, 0xCD65, 0x0000, 0x9CE5, 0xF725, 0xFE65, 0xF725,
+    0xFE65, 0xFE65, 0xFD65, 0xFD85, 0xFD65, 0xF585, 0xFC65, 0xF485,
+    0xF365, 0xFB65, 0xF365, 0xF365, 0xF265, 0x62A3, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x90C4,
+    0xE906, 0xE165, 0xE165, 0xE9C5, 0xE9C5, 0xE9C5, 0xE9C5, 0xEA85,
+    0xF265, 0xF365, 0xF365, 0xF365, 0xF365, 0xFC85, 0xFC65, 0xF585,
+    0xFD65, 0x62A3, 0x0000, 0xFE85, 0xFE65, 0xCD65, 0x0000, 0x62A3,
+    0xD686, 0xF725, 0xF725, 0xFF25, 0x64A6, 0xCC64, 0xCD65, 0xF725,
+    0xFE85, 0xD464, 0x1842, 0xFD85, 0x62A3, 0xCC64, 0xF485, 0xFC65,
+    0xF365, 0xFC85, 0xF365, 0xF365, 0xF265, 0xF285, 0xE9C5, 0xCA64,
+    0x5084, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x90E4, 0xE108,
+    0xE906, 0xE165, 0xE106, 0xE165, 0xE145, 0xE9C5, 0xE9C5, 0xEA65,
+    0xE9C5, 0xF285, 0xEA65, 0xF285, 0xCB84, 0x62A3, 0xF365, 0xFC65,
+    0xFC85, 0xFD65, 0x62A3, 0x62A3, 0xFD65, 0xFE65, 0xD686, 0x62A3,
+    0x62A3, 0xD726, 0xCF26, 0xFF25, 0xF725, 0xF725, 0xD686, 0x0000,
+    0xCC64, 0xFE65, 0x62A3, 0x0000, 0x9AA3, 0x9AA3, 0x0000, 0x62A3,
+    0xFB65, 0xFB65, 0xEA85, 0xF285, 0xEA65, 0xF285, 0xE9C5, 0xE9C5,
+    0xE1A6, 0xE9C5, 0xC165, 0x5084, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5884, 0xC88A, 0xE8C8,
+    0xE0C8, 0xE0E7, 0xE0E7, 0xE906, 0xE106, 0xE165, 0xC185, 0xE945,
+    0xE1A6, 0xE9C5, 0x1842, 0x0000, 0xC185, 0x62A3, 0x0000, 0xCB84,
+    0xFB65, 0x9AC3, 0x5884, 0xFD85, 0xFD65, 0xFD85, 0xFD65, 0xFE85,
+    0x62A3, 0x9CE5, 0xD746, 0xF725, 0xF725, 0xF725, 0x0000, 0x3222,
+    0xFE65, 0xFE65, 0xFE65, 0xFD85, 0x0000, 0x3242, 0xCB84, 0x0000,
+    0x0000, 0xF365, 0xFB65, 0xF365, 0x90C4, 0xCA84, 0xE9C5, 0xE9C5,
+    0xE1A6, 0xE9C5, 0xE145, 0xE165, 0xE926, 0xE906, 0x1842, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x5884, 0xE0AA, 0xE0A8, 0xE0AA,
+    0xE8C8, 0xE0E7, 0xE0E7, 0xE0E7, 0xE8E7, 0xE906, 0x90E4, 0x90C4,
+    0xE165, 0xE9C5, 0xC965, 0x0000, 0x5884, 0xCA64, 0x0000, 0x1842,
+    0xF365, 0xFC65, 0xF365, 0xD484, 0x1842, 0x9AA3, 0xF565, 0xFE85,
+    0xFD65, 0xCC64, 0x9CE5, 0xF725, 0xFF25, 0xF725, 0xF725, 0x9CE5,
+    0x0000, 0x3222, 0xFD65, 0xFE85, 0xFD65, 0xFD65, 0xCB84, 0xFC85,
+    0x9AA3, 0x0000, 0x9AA3, 0x90E4, 0xF285, 0xF265, 0x5084, 0x90C4,
+    0xE965, 0xE9C5, 0xE145, 0xE965, 0xE106, 0xE106, 0xE0E7, 0xE8E7,
+    0xC0C6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x1842, 0xC8AA, 0xE8AC, 0xE0AA, 0xE0AA,
+    0xE0C8, 0xE8AA, 0xE0A8, 0xE0C8, 0xE0A8, 0xE8E7, 0x5084, 0x90E4,
+    0xE906, 0x90E4, 0x5884, 0x98C4, 0x0000, 0xC185, 0xC165, 0x98E4,
+    0xF285, 0xF365, 0xF365, 0xFB65, 0x0000, 0x0000, 0xCB84, 0xFD65,
+    0xF585, 0xFE65, 0x9CE5, 0xA6C7, 0xF725, 0xFF25, 0xF725, 0xF725,
+    0xD686, 0x64A6, 0x62A3, 0xCD65, 0xFD85, 0xFD65, 0xF485, 0xFC65,
+    0xFC85, 0xFC85, 0x90C4, 0x62A3, 0x0000, 0xCA64, 0xE9C5, 0xE9C5,
+    0x0000, 0x5884, 0xE165, 0xE165, 0xE106, 0xE906, 0xE0E7, 0xE0E7,
+    0xE0C8, 0xE8A8, 0xE8C8, 0x5884, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x588B, 0xE0AC, 0xE0AC, 0xE0AC, 0xE8AC,
+    0xE0AA, 0xE108, 0xE0AA, 0xE0AA, 0xE8C8, 0xE8E7, 0x1842, 0x5884,
+    0xE0E7, 0xE906, 0x5884, 0x5884, 0x5884, 0x5064, 0xE1C5, 0xE9C5,
+    0xE9C5, 0xF285, 0xEA85, 0xFB65, 0xCA64, 0x9AA3, 0x62A3, 0xFC65,
+    0xF485, 0xFD65, 0xFD85, 0xCC64, 0x9CE5, 0xFF25, 0xF725, 0xF725,
+    0xFE65, 0xFE65, 0xCD65, 0xCC64, 0xCD85, 0xFD65, 0x9AA3, 0x62A3,
+    0x6AA3, 0xFB65, 0xF365, 0xF365, 0xF285, 0x0000, 0xC165, 0x90E4,
+    0x90C4, 0xE9A6, 0x90E4, 0xC185, 0x1842, 0xE906, 0xE8E7, 0xE0E7,
+    0xE8C8, 0xE0A8, 0xE0C8, 0xE0AA, 0xE8AA, 0x986B, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x988B, 0xE8AC, 0xE0AE, 0xE0AC, 0xE8AC,
+    0xE0AC, 0xE0AC, 0xE0AA, 0xE8AA, 0x986B, 0x90E4, 0xC0C6, 0x90C4,
+    0xE8C8, 0xC0C6, 0x90C4, 0x5884, 0x0000, 0xE965, 0xE145, 0xE965,
+    0xC165, 0x90E4, 0x5884, 0xCA64, 0xF285, 0xCA64, 0xCA64, 0xF365,
+    0xFC65, 0xF485, 0xFC65, 0xFD85, 0xCB84, 0x64A6, 0xF725, 0xF725,
+    0xF725, 0xFF25, 0xFE65, 0x3242, 0x62A3, 0xFD65, 0xD585, 0x9AC3,
+    0x9AA3, 0x9AC3, 0xFB65, 0xCA64, 0x5064, 0xF285, 0xE9C5, 0xE9C5,
+    0x90E4, 0x0000, 0xC165, 0xE965, 0xC0C6, 0x5884, 0xC0C6, 0x1842,
+    0x90C4, 0xE8AA, 0xE0C8, 0xE0AA, 0xE0AA, 0xE8AC, 0xE0AA, 0xC88A,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0xC8AE, 0xE0AE, 0xE8AE, 0xE0AE, 0xE0AE,
+    0xE0AC, 0xE8AE, 0xE8AC, 0x986B, 0x5884, 0xC0C6, 0x1842, 0xE0C8,
+    0xE8C8, 0xE0E7, 0x0000, 0xC0C6, 0xC0C6, 0xE106, 0xE906, 0x90E4,
+    0xC965, 0xC185, 0x5884, 0x5084, 0xC165, 0xF265, 0xF285, 0x5884,
+    0x9AA3, 0xF485, 0xFC65, 0xF585, 0xFC65, 0x62A3, 0x1842, 0xD686,
+    0xFF25, 0xFF25, 0xFE65, 0xFE65, 0x9AA3, 0x0000, 0xF465, 0xFC85,
+    0x0000, 0x0000, 0x0000, 0x5064, 0x90E4, 0x0000, 0x98C4, 0xC185,
+    0xE9C5, 0xE945, 0x0000, 0x0000, 0xE106, 0xE126, 0xE8E7, 0xE0E7,
+    0xE0C8, 0xE0E7, 0xE8A8, 0xE0AA, 0xE0AA, 0xE0AC, 0xE8AA, 0xE0AC,
+    0xE0AC, 0xC8AE, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0xC88E, 0xE8AE, 0xE0B0, 0xE0AE, 0xE0AE,
+    0xE8AE, 0xE0AE, 0xE0AC, 0xE0AC, 0xC88A, 0xE8AC, 0xE0AA, 0xE0AA,
+    0xE0AA, 0xE8C8, 0x0000, 0x0000, 0xC88A, 0xE0E7, 0xC0C6, 0x90E4,
+    0x0000, 0x90E4, 0x0000, 0x0000, 0x0000, 0x5884, 0xE9C5, 0xCA64,
+    0x0000, 0xFB65, 0xF365, 0xFC85, 0xF465, 0xCC84, 0x0000, 0x0000,
+    0x62A3, 0xF725, 0xF665, 0xFE65, 0xFE85, 0xFD65, 0x0000, 0xFD85,
+    0xFC85, 0x9AA3, 0x9AA3, 0xCA64, 0xCA64, 0xF285, 0xC185, 0xCA64,
+    0x1842, 0xE145, 0xE965, 0xC0C6, 0x0000, 0xC0C6, 0xE0E7, 0xE0E7,
+    0xE8C8, 0xC0C6, 0xC0C6, 0xC88A, 0x986B, 0xE0AC, 0xE0AC, 0xE8AC,
+    0xE0AC, 0xE0AE, 0xE8AE, 0xC8AE, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0xC8B1, 0xE0B0, 0xE0B0, 0xE0B0, 0xE0B0,
+    0xE0AE, 0xE0B0, 0xE8AE, 0xC88E, 0xC8AE, 0xE0AE, 0xC8AE, 0xE8AC,
+    0xE0AA, 0xE108, 0x0000, 0x0000, 0xC88A, 0xE908, 0x90C4, 0x98E4,
+    0x90C4, 0x90E4, 0xC8C6, 0x90C4, 0x98E4, 0x62A3, 0x5064, 0xF285,
+    0xC165, 0x0000, 0xF365, 0xFB65, 0xF365, 0xFC85, 0x3222, 0x0000,
+    0x0000, 0x0000, 0xD565, 0xFE65, 0xFE65, 0xFE65, 0xF565, 0xFD85,
+    0xFC65, 0xF485, 0xF365, 0xF365, 0x5864, 0x5884, 0xCA64, 0xE9C5,
+    0x90E4, 0x90C4, 0x5884, 0xC985, 0xE906, 0x90E4, 0x1842, 0xE8E7,
+    0xE0A8, 0xE8C8, 0x5084, 0x0000, 0x0000, 0x0000, 0x0000, 0xC88A,
+    0xE8AC, 0xE0AE, 0xE0AC, 0xE8AE, 0xE0AE, 0xC8AE, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x5084, 0x1842, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x2042, 0x5884, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0xD08E, 0xC8B1, 0xE8B0, 0xE0B0, 0xE0B0,
+    0xE0B0, 0xE0B0, 0xC8AE, 0x0000, 0x0000, 0x0000, 0x0000, 0x90C4,
+    0xE8AC, 0xE0AC, 0x988B, 0x0000, 0xC88A, 0xE8AA, 0xC0C6, 0x5084,
+    0x98E4, 0xC0C6, 0xE8E7, 0xE106, 0x5084, 0x98E4, 0xE945, 0xE9C5,
+    0xE9C5, 0xEA85, 0xE9C5, 0xEA85, 0xF265, 0xF365, 0xCB84, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x62A3, 0xF665, 0xFE85, 0xFD65, 0xFD85,
+    0xFC85, 0xCB84, 0x90C4, 0x9AA3, 0xF285, 0xCB84, 0xF285, 0x62A3,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x90C4, 0xE0E7, 0xE8E7,
+    0xE0C8, 0x90C4, 0x0000, 0xE8AA, 0xC0C6, 0x0000, 0x0000, 0x0000,
+    0x0000, 0xE0AC, 0xC8AE, 0xC88E, 0xE8AE, 0xE0B0, 0xE0B0, 0xB0D1,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xC8B1, 0xA8B1, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0xB0D1, 0xA8B1, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0xB0D1, 0xC8B1, 0xE0B0, 0xE0B0, 0xE0B0,
+    0xC8B1, 0xE0B0, 0xC8AE, 0x0000, 0x0000, 0x0000, 0x0000, 0xC88A,
+    0xE0AE, 0x0000, 0xC8AA, 0xE8AC, 0xC88A, 0xE8AC, 0x5884, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x5884, 0x90E4, 0xD127, 0xE106, 0xE945,
+    0x90E4, 0x90C4, 0xE1A6, 0xF285, 0xEA65, 0xFB65, 0xF365, 0x3242,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCD65, 0xFD65, 0xFD85,
+    0xFC65, 0x9AA3, 0x0000, 0x0000, 0x0000, 0x0000, 0x1842, 0xF285,
+    0xE1A6, 0x1842, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xC8C6,
+    0xE8C8, 0xE0A8, 0x988B, 0x0000, 0x0000, 0xC88A, 0xC88A, 0x0000,
+    0x0000, 0x0000, 0x1842, 0xD0AE, 0x988B, 0xA06B, 0xE0AE, 0xE0B0,
+    0xE0B0, 0x988B, 0x0000, 0x0000, 0x0000, 0x0000, 0x5884, 0xD0B1,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA8B1, 0x1842, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x608B, 0xD0B1, 0xC8B1, 0xC8B1, 0xD0B1,
+    0xA8D1, 0xC8B1, 0xA06B, 0x0000, 0x0000, 0x0000, 0x0000, 0xC8AE,
+    0xE8AE, 0x1842, 0x0000, 0xC88E, 0xE8AC, 0xE0AC, 0x90E4, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE8E7, 0xE0E7, 0x5084,
+    0x0000, 0x0000, 0x0000, 0x0000, 0xC965, 0xF285, 0xF285, 0xCA64,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3222, 0xFE65,
+    0xFD85, 0xFD85, 0x9AA3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0xCA64, 0xE9C5, 0x5084, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0xE108, 0xE0C8, 0xE8AA, 0x5084, 0x0000, 0x0000, 0xC88A,
+    0xE8AC, 0x5884, 0x0000, 0x0000, 0x0000, 0xC8AE, 0xD08E, 0x5884,
+    0xC8AE, 0xE0B0, 0xE0B0, 0x608B, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x986B, 0xA08B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x588B, 0xA06B, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x588B, 0xB0D1, 0xC8B1, 0xC8B1, 0xC88E,
+    0xA08B, 0xC8B1, 0xB0B1, 0x0000, 0x0000, 0x0000, 0x5084, 0xE0B0,
+    0xD0AE, 0x0000, 0x0000, 0x986B, 0xE0AE, 0xE8AE, 0xD0AE, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x1842, 0xE108, 0x90C4, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9AA3, 0xEA85, 0xF265,
+    0x1842, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0xD585, 0xFD65, 0xFC85, 0xCB84, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x1842, 0x90C4, 0x90C4, 0xE965, 0xE945, 0x5084, 0x0000, 0x0000,
+    0x1842, 0x2042, 0xC0C6, 0xE8AA, 0xE0AA, 0xE8AA, 0x1842, 0x0000,
+    0x0000, 0x588B, 0xD0AE, 0x986B, 0x0000, 0x0000, 0x0000, 0xA08B,
+    0xC8B1, 0x588B, 0xA06B, 0xC8B1, 0xC8B1, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x608B, 0x608B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x588B, 0x190B,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x90D1, 0xB0D1, 0xB0D1, 0x986B,
+    0xA08B, 0xC8B1, 0x986B, 0x0000, 0x0000, 0x0000, 0xA08B, 0xC8B1,
+    0x5884, 0x0000, 0x0000, 0x5884, 0xE8AE, 0xE0AE, 0xE0AC, 0x90C4,
+    0x0000, 0x1842, 0x0000, 0x0000, 0x5884, 0xE8AA, 0xE8C8, 0xC0C6,
+    0x90C4, 0x1842, 0x0000, 0x0000, 0x0000, 0x0000, 0xC985, 0xE9C5,
+    0xE9C5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0xFD85, 0xFC65, 0xF485, 0xFB65, 0x0000, 0x0000, 0x0000,
+    0x5884, 0x6AA3, 0x5884, 0x1842, 0x0000, 0xC185, 0xE126, 0xE906,
+    0xE0E7, 0xE108, 0xE0C8, 0xC88A, 0xC88A, 0xE0AC, 0xE8AA, 0xE0AC,
+    0xA08B, 0x0000, 0x986B, 0xE0AE, 0xE0AE, 0xE8B0, 0x988B, 0x0000,
+    0x0000, 0x608B, 0xC8B1, 0xC88E, 0xA08B, 0xD0B1, 0x90D1, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x78F1, 0x1842, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x190B, 0x6111,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x78D1, 0xB0D1, 0x90D1, 0x78F1,
+    0x88D1, 0xB0D1, 0x608B, 0x0000, 0x0000, 0x986B, 0xC8B1, 0xE0B0,
+    0xD0B1, 0x1842, 0x0000, 0xC8AE, 0xE0B0, 0xE0B0, 0xE0AE, 0xE8AE,
+    0xC88E, 0xE0AE, 0xE0AC, 0xE8AC, 0xC8AE, 0xE8AC, 0x986B, 0x0000,
+    0x98E4, 0xC0C6, 0xC0C6, 0x5084, 0x0000, 0x0000, 0x0000, 0xE9C5,
+    0xE9C5, 0x9AA3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x9AA3, 0xF485, 0xFC65, 0xF485, 0x1842, 0x0000,
+    0x98C4, 0x9AA3, 0x0000, 0x0000, 0x0000, 0x0000, 0x90E4, 0xE906,
+    0xE8E7, 0xE0E7, 0xE0C8, 0xE0A8, 0xC88A, 0x90E4, 0x0000, 0x5884,
+    0xC88A, 0xE8AE, 0xE0AC, 0xE8AE, 0x588B, 0x1842, 0xD0AE, 0xE0B0,
+    0xE0B0, 0x988B, 0x0000, 0x0000, 0xD08E, 0xC8B1, 0xA8D1, 0xB0B1,
+    0x588B, 0x0000, 0x0000, 0x0000, 0x608B, 0x78F1, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x608B,
+    0x190B, 0x0000, 0x0000, 0x0000, 0x210B, 0x90D1, 0x78F1, 0x90D1,
+    0x90D1, 0x88F1, 0x0000, 0x0000, 0x608B, 0xB0D1, 0xA8B1, 0xC8AE,
+    0x5884, 0xD0B1, 0xC8B1, 0xE0B0, 0xE0B0, 0xE0B0, 0x986B, 0x98E4,
+    0x986B, 0xE8AE, 0xE0AC, 0xE8AE, 0xE0AC, 0xE0AC, 0xE0AA, 0x5884,
+    0x0000, 0x0000, 0x0000, 0x5884, 0x90E4, 0x5884, 0x0000, 0x98C4,
+    0xE965, 0xE9C5, 0x90C4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x62A3, 0xFC65, 0xFC85, 0xFB65, 0x6AA3,
+    0x1842, 0xCA64, 0x0000, 0x0000, 0x0000, 0x0000, 0x90E4, 0xE106,
+    0xE0E7, 0xE8E7, 0x90E4, 0xE0A8, 0xE0C8, 0xE108, 0xE8AA, 0xC88A,
+    0x0000, 0x0000, 0x1842, 0xE8AE, 0xE8AE, 0x90E4, 0x0000, 0x0000,
+    0x5884, 0xE0B0, 0xC8B1, 0xE0B0, 0xA06B, 0x90E4, 0xA8D1, 0xD0B1,
+    0x90D1, 0xB0B1, 0x1842, 0x0000, 0x0000, 0x2042, 0x608B, 0x1842,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x210B,
+    0x608B, 0x0000, 0x0000, 0x0000, 0x1842, 0x78F1, 0x78D1, 0x78F1,
+    0x78D1, 0x78F1, 0x1842, 0x78F1, 0x90D1, 0xB0B1, 0xA8D1, 0xA06B,
+    0x0000, 0x0000, 0x988B, 0xE0B0, 0xC8B1, 0x5884, 0x0000, 0x0000,
+    0x988B, 0xE0B0, 0xE0AE, 0xE8AE, 0xE0AC, 0xC88A, 0xE0AC, 0xE0AC,
+    0xE8AA, 0x0000, 0x0000, 0x0000, 0x0000, 0x5884, 0x90E4, 0x0000,
+    0xC0C6, 0xE9A6, 0xE9C5, 0x5084, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x1842, 0xFC85, 0xF365, 0xFB65,
+    0xCA64, 0x9AA3, 0x5084, 0x0000, 0x0000, 0x0000, 0x0000, 0xE906,
+    0xE108, 0xE0E7, 0x90E4, 0xC0C6, 0x0000, 0x5884, 0xE8AA, 0xE0AC,
+    0xE8AC, 0xE0AC, 0x1842, 0x0000, 0x5884, 0xE0B0, 0xE8AE, 0xC88E,
+    0x0000, 0x0000, 0x0000, 0xC8B1, 0xC8B1, 0xC8B1, 0xA08B, 0xA8B1,
+    0xB0D1, 0x88D1, 0x608B, 0x78F1, 0x0000, 0x0000, 0x0000, 0x608B,
+    0x190B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x190B, 0x608B, 0x0000, 0x0000, 0x0000, 0x6911, 0x6111, 0x608B,
+    0x6111, 0x78D1, 0x78F1, 0x78D1, 0x90D1, 0x90F1, 0x90D1, 0x1842,
+    0x0000, 0x0000, 0xA08B, 0xC8B1, 0xC8B1, 0x608B, 0x0000, 0x1842,
+    0xE8B0, 0xE0B0, 0xE8AE, 0xE0B0, 0x5084, 0x608B, 0x988B, 0xD08E,
+    0xE0AC, 0xE8AC, 0x988B, 0x0000, 0x0000, 0x0000, 0x0000, 0x90C4,
+    0x5884, 0xE906, 0xE126, 0xE165, 0x1842, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFC65, 0xFC85,
+    0xF365, 0xFB65, 0xD284, 0x1842, 0x0000, 0x0000, 0x0000, 0x5084,
+    0xE106, 0xE106, 0xE8E7, 0xC8C6, 0x1842, 0x0000, 0x0000, 0x5084,
+    0xE8AC, 0xE0AE, 0xE0AC, 0xE8AE, 0x5884, 0x5884, 0xE0B0, 0xE0B0,
+    0xE0B0, 0xE0B0, 0xC8AE, 0x5884, 0x0000, 0xD0B1, 0xB0D1, 0x1842,
+    0x0000, 0x88D1, 0x90F1, 0x90D1, 0x78F1, 0x608B, 0x0000, 0x0000,
+    0x2042, 0x4931, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x5151, 0x1842, 0x0000, 0x0000, 0x608B, 0x4931, 0x4951,
+    0x6111, 0x6911, 0x6111, 0x210B, 0x190B, 0x88D1, 0x78D1, 0x0000,
+    0x0000, 0x78F1, 0xB0B1, 0xA8D1, 0xB0B1, 0xC8B1, 0x0000, 0x608B,
+    0xC8B1, 0xE0B0, 0xE0B0, 0xE8B0, 0x1842, 0x0000, 0x0000, 0x988B,
+    0xC8AE, 0xE0AE, 0xE8AC, 0xE8AC, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x5084, 0xE106, 0xE106, 0xE965, 0xE945, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF365,
+    0xF365, 0xF365, 0xF285, 0xEA65, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0xE106, 0xE8E7, 0xE0E7, 0xE0C8, 0x986B, 0x1842, 0x0000,
+    0x0000, 0x5884, 0xE8AC, 0xE8AE, 0xE0AE, 0xE0B0, 0xC8AE, 0xE0B0,
+    0xC88E, 0x988B, 0xD0B1, 0xC8B1, 0xC8B1, 0xD0B1, 0xA8B1, 0xB0D1,
+    0x88D1, 0x0000, 0x0000, 0x1842, 0x78F1, 0x78D1, 0x6911, 0x0000,
+    0x0000, 0x0000, 0x190B, 0x210B, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x190B, 0x210B, 0x0000, 0x0000, 0x0000, 0x4931, 0x4951,
+    0x5131, 0x6111, 0x2042, 0x0000, 0x0000, 0x78F1, 0x6111, 0x6111,
+    0x608B, 0x90D1, 0x90F1, 0x90D1, 0x588B, 0xB0D1, 0xB0D1, 0xA8B1,
+    0xC8B1, 0xE8B0, 0xC8B1, 0xE0B0, 0x1842, 0x0000, 0x0000, 0x1842,
+    0xA08B, 0xE8AE, 0xE0AC, 0xE8AC, 0xC88A, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x5084, 0xE8E7, 0xE106, 0xE126, 0xE906, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0xCB84, 0xFC85, 0xF365, 0xFB65, 0xE9C5, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x90E4, 0xE108, 0xE0A8, 0xE0AA, 0xE8AA, 0xE0AA,
+    0xD0AE, 0xC88A, 0x5084, 0xE0AC, 0xE8AE, 0xE0B0, 0xE0AE, 0xE0B0,
+    0xE0B0, 0xE0B0, 0xE0B0, 0xE0B0, 0xD0B1, 0xC8B1, 0xA8D1, 0xB0B1,
+    0xB0D1, 0xB0B1, 0x608B, 0x0000, 0x0000, 0x1842, 0x78F1, 0x6111,
+    0x608B, 0x0000, 0x0000, 0x210B, 0x190B, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x210B, 0x210B, 0x0000, 0x0000, 0x190B, 0x5151,
+    0x4931, 0x4951, 0x0000, 0x0000, 0x0000, 0x4931, 0x6111, 0x6111,
+    0x6111, 0x78D1, 0x78F1, 0x90F1, 0x90D1, 0xA8B1, 0xB0D1, 0xA8B1,
+    0xB0D1, 0xC8B1, 0xC8B1, 0xE0B0, 0xA06B, 0x0000, 0x588B, 0xC8AE,
+    0xE0AE, 0xE0B0, 0xE0AE, 0xE8AE, 0xE8AC, 0x5884, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x5084, 0xE108, 0xE0E7, 0xE165, 0xC0C6, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x9AA3, 0xF365, 0xF365, 0xF285, 0xEA65, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0xE0E7, 0xE8A8, 0xE0C8, 0xE0A8, 0xE0AA,
+    0xE8AA, 0xE0AC, 0xE0AC, 0xE0AC, 0xE8AC, 0xE0AE, 0xE0AE, 0xE0B0,
+    0xE0B0, 0xE0B0, 0xC8B1, 0xE0B0, 0xC8B1, 0xC8B1, 0xB0D1, 0xA8B1,
+    0xB0D1, 0xA8B1, 0x90D1, 0x90F1, 0x1842, 0x0000, 0x0000, 0x6111,
+    0x4931, 0x4951, 0x2042, 0x0000, 0x0000, 0x4931, 0x2042, 0x0000,
+    0x0000, 0x0000, 0x1842, 0x210B, 0x0000, 0x0000, 0x2042, 0x3191,
+    0x2991, 0x3191, 0x190B, 0x0000, 0x0000, 0x210B, 0x4951, 0x4931,
+    0x5151, 0x6111, 0x6911, 0x78F1, 0x78D1, 0x90D1, 0x90F1, 0xA8D1,
+    0xB0B1, 0xA8D1, 0xB0B1, 0xC8B1, 0xC8B1, 0xE0B0, 0xC8B1, 0xE8B0,
+    0xE0B0, 0xE0B0, 0xE0AE, 0xE0AE, 0xE8AC, 0xE0AC, 0x90E4, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x90C4, 0xE8C8, 0xE0E7, 0xE108, 0x90C4,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x5064, 0xF365, 0xF285, 0xF285, 0xE9C5, 0x90C4,
+    0x0000, 0x0000, 0x0000, 0x90E4, 0xE8E7, 0xC0C6, 0x0000, 0x90C4,
+    0x988B, 0xE0AA, 0xE8AC, 0xE0AC, 0xE0AC, 0xE0AE, 0xE8AE, 0xE0B0,
+    0xE0B0, 0xE0B0, 0xE0B0, 0xC8B1, 0xB0B1, 0xC8AE, 0xB0B1, 0xA8D1,
+    0xB0B1, 0xB0D1, 0x90F1, 0x90D1, 0x78D1, 0x78F1, 0x0000, 0x0000,
+    0x4951, 0x608B, 0x1842, 0x5131, 0x0000, 0x0000, 0x190B, 0x3191,
+    0x0000, 0x0000, 0x0000, 0x3191, 0x190B, 0x0000, 0x0000, 0x3191,
+    0x3191, 0x0000, 0x3191, 0x3191, 0x0000, 0x190B, 0x5151, 0x4931,
+    0x4931, 0x6111, 0x6111, 0x6111, 0x6111, 0x78F1, 0x78F1, 0x90D1,
+    0x90D1, 0xA8D1, 0xB0B1, 0xC8B1, 0xA8D1, 0xC8B1, 0xC8B1, 0xE0B0,
+    0xE0B0, 0xE0B0, 0xE0B0, 0xE8AE, 0x5884, 0x90E4, 0xE0AC, 0xE8AC,
+    0x0000, 0x0000, 0x0000, 0x0000, 0xC0C6, 0xE108, 0xE0E7, 0xE906,
+    0x5884, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x1842, 0xFA85, 0xF285, 0xE9C5, 0xE9C5,
+    0xE1A6, 0x90C4, 0x0000, 0x0000, 0x90E4, 0xE8E7, 0x1842, 0x0000,
+    0x0000, 0x0000, 0x986B, 0xE8AC, 0xE8AC, 0xC88A, 0xC8AA, 0xC8AE,
+    0x986B, 0x988B, 0x1842, 0x2042, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x1842, 0x78D1, 0x78F1, 0x78D1, 0x6911, 0x6111,
+    0x210B, 0x4931, 0x0000, 0x0000, 0x3191, 0x190B, 0x0000, 0x0000,
+    0x210B, 0x1842, 0x0000, 0x2042, 0x210B, 0x0000, 0x0000, 0x190B,
+    0x3191, 0x3191, 0x0000, 0x190B, 0x3191, 0x2042, 0x3191, 0x3191,
+    0x2991, 0x4951, 0x210B, 0x190B, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x5884, 0x2042, 0x608B, 0xA08B, 0xA8B1, 0xB0D1, 0xC8B1,
+    0xC88E, 0xE8B0, 0xE0B0, 0x988B, 0x0000, 0x0000, 0x0000, 0x986B,
+    0xE8AC, 0x5084, 0x0000, 0x0000, 0x98E4, 0xE8A8, 0xE0C8, 0xE0E7,
+    0xE8E7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF365, 0xEA65, 0xF285,
+    0xE9C5, 0xE9C5, 0xE165, 0xE145, 0xC0C6, 0xD127, 0xE8E7, 0xE0C8,
+    0xC8AA, 0xE0AA, 0xE0AA, 0xE8AC, 0xE0AC, 0xE8AE, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x608B, 0x6111,
+    0x6111, 0x6911, 0x4931, 0x2042, 0x0000, 0x4931, 0x3191, 0x0000,
+    0x0000, 0x0A0E, 0x210B, 0x0000, 0x190B, 0x09EE, 0x0000, 0x0000,
+    0x21F2, 0x1A53, 0x2042, 0x0000, 0x1842, 0x2212, 0x3191, 0x2212,
+    0x3191, 0x5131, 0x1842, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x588B, 0xE0B0, 0xE0B0, 0xE0B0, 0xE0B0, 0x988B, 0xC88E,
+    0xE8AE, 0xE8AE, 0x988B, 0x986B, 0xE0AA, 0xE0AA, 0xE8C8, 0xE0A8,
+    0xE0C8, 0xE106, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xC165, 0xF285,
+    0xE9C5, 0xE9C5, 0xE145, 0xE165, 0xE106, 0xE106, 0xE8E7, 0xE0C8,
+    0xE0C8, 0xE0AA, 0xE8A8, 0xE0AA, 0xE0AA, 0xE0AC, 0xE8AC, 0x988B,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x4931, 0x4931, 0x4951, 0x3191, 0x0000, 0x1842, 0x3191,
+    0x1842, 0x0000, 0x0000, 0x2212, 0x2212, 0x21F2, 0x0000, 0x0000,
+    0x2042, 0x1A53, 0x2212, 0x0000, 0x0000, 0x2212, 0x21F2, 0x2212,
+    0x3191, 0x1842, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0xB0B1, 0xE8B0, 0xC8B1, 0xE0B0, 0xE8AE, 0xE0B0,
+    0xE0AE, 0xE0AE, 0xE8AC, 0xE0AC, 0xE0AA, 0xE0AC, 0xE8C8, 0xE0AA,
+    0xE0A8, 0xE0E7, 0x90E4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x62A3,
+    0xF265, 0xEA85, 0xE9C5, 0xE9C5, 0xE165, 0xE145, 0xE8E7, 0xE0E7,
+    0xE0C8, 0xE0C8, 0xC88A, 0xE8AA, 0xE0AA, 0xE8AC, 0x988B, 0xE0AE,
+    0xE8AE, 0x608B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x608B, 0x3191, 0x4931, 0x3191, 0x0000,
+    0x3191, 0x2212, 0x0000, 0x09EE, 0x1A53, 0x1AB4, 0x1A53, 0x09EE,
+    0x0000, 0x1A53, 0x12D4, 0x09EE, 0x0000, 0x1AB4, 0x1A53, 0x1A53,
+    0x190B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x588B, 0xD0B1, 0xC8B1, 0x70D1, 0xE0B0, 0xE0B0,
+    0xE8AE, 0xE0AE, 0xE0AE, 0xE0AE, 0xE8AC, 0xE0AC, 0xE0AA, 0xE0AA,
+    0xE8C8, 0xE0AA, 0xE8A8, 0x5884, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x1842, 0xF285, 0xE9C5, 0xE9C5, 0xE145, 0xE145, 0xE108, 0xE8E7,
+    0xE0C8, 0xE0A8, 0x5084, 0x0000, 0x5884, 0xE8AC, 0xE8AC, 0xE0AC,
+    0xE0AE, 0xE0AE, 0xC8AE, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x190B, 0x3191, 0x3191,
+    0x09EE, 0x1842, 0x2212, 0x2042, 0x210B, 0x12B4, 0x12B4, 0x1AB4,
+    0x210B, 0x1842, 0x1AB4, 0x12B4, 0x0000, 0x1AB4, 0x12B4, 0x1AB4,
+    0x190B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x2042, 0xD0B1, 0xC8B1, 0xD0B1, 0xA8B1, 0xE0B0,
+    0xC8B1, 0x5884, 0x1842, 0xD0AE, 0xE8AE, 0xE0AE, 0xE8AC, 0xE0AC,
+    0xE0AA, 0xE0AA, 0xE8A8, 0xE0C8, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0xE9C5, 0xE9C5, 0xE1A6, 0xE1C6, 0xE106, 0xE906,
+    0xE0E7, 0xE108, 0xE0C8, 0xE8A8, 0x90E4, 0xE108, 0xE0AC, 0xE0AE,
+    0xE8AC, 0xE8AE, 0x986B, 0x988B, 0xE88E, 0x2042, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3191,
+    0x2212, 0x2212, 0x09EE, 0x120E, 0x09EE, 0x190B, 0x1AB4, 0x1356,
+    0x12B4, 0x2042, 0x1A53, 0x0B56, 0x2042, 0x0B33, 0x0B56, 0x1356,
+    0x210B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1842, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x1842, 0xB0B1, 0x588B, 0xD0B1, 0xC8B1, 0xE0B0,
+    0xE0B0, 0xE0B0, 0x988B, 0x986B, 0xE8AE, 0xE0AE, 0xE0AE, 0xE0AE,
+    0xE8AC, 0xE108, 0xE0AA, 0xE0AA, 0xC0C6, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x90E4, 0xE9C5, 0xE9C5, 0xE165, 0xE106,
+    0xC0C6, 0x5884, 0xE8C8, 0xE0A8, 0xE0C8, 0xE0AA, 0xE8AA, 0xE0AC,
+    0xE0AC, 0xE0AE, 0xE8AE, 0x986B, 0x988B, 0xE0B0, 0xB0B1, 0x5084,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1842, 0x3191,
+    0x3191, 0x2212, 0x2212, 0x09EE, 0x1A53, 0x1AB4, 0x0000, 0x12B4,
+    0x1356, 0x0B33, 0x0000, 0x0B56, 0x1356, 0x09EE, 0x1356, 0x1356,
+    0x1356, 0x12B4, 0x09EE, 0x2042, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x2042, 0x90F1, 0x90D1, 0x588B, 0xA08B, 0xC8B1,
+    0xC8B1, 0xE8B0, 0xE0B0, 0xE0B0, 0xE0AE, 0xE0B0, 0xE0AE, 0xE8AC,
+    0x5084, 0xE8AC, 0xE0AA, 0xE0AA, 0xE8C8, 0x5084, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE9C5, 0xE965, 0xE165,
+    0xE906, 0x90C4, 0x5884, 0x90E4, 0xC0C6, 0xE0AA, 0xE8AA, 0xE0AC,
+    0xE0AC, 0xE0AE, 0xE8AE, 0xE0AE, 0xE0AE, 0xE8B0, 0xD08E, 0x1842,
+    0x988B, 0xA06B, 0x2042, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x1842, 0x210B, 0x4931, 0x3191, 0x2991,
+    0x3191, 0x2212, 0x2212, 0x2042, 0x09EE, 0x1AB4, 0x12B4, 0x0B33,
+    0x1356, 0x0BF8, 0x1356, 0x0B56, 0x0BD8, 0x0BF8, 0x0BF8, 0x2042,
+    0x09EE, 0x0BD8, 0x1356, 0x1356, 0x12B4, 0x1AD4, 0x09EE, 0x1842,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x608B, 0x78D1, 0x190B, 0xB0D1, 0xA8B1, 0xC8B1,
+    0xC8B1, 0xE0B0, 0xC8B1, 0xE0B0, 0xE0B0, 0xE0B0, 0xE8AE, 0xE0AE,
+    0xA08B, 0x5884, 0x986B, 0xE0AC, 0xE0AA, 0xE8AA, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5084, 0xE945,
+    0xE106, 0xE126, 0xC0C6, 0x5084, 0x0000, 0x5884, 0xE8C8, 0xE8AA,
+    0xC88A, 0xE0AC, 0xE0AC, 0xC88A, 0x0000, 0xE0B0, 0xE0AE, 0x988B,
+    0x0000, 0x1842, 0xD0AE, 0xD0B1, 0xA8B1, 0xB0D1, 0x986B, 0x90D1,
+    0x588B, 0x608B, 0x608B, 0x6111, 0x4951, 0x4931, 0x210B, 0x190B,
+    0x0000, 0x210B, 0x2212, 0x1A53, 0x09EE, 0x12D4, 0x1AB4, 0x09EE,
+    0x1AB4, 0x0BF8, 0x0B56, 0x0BD8, 0x0BF8, 0x0B33, 0x0B33, 0x0BD8,
+    0x0B33, 0x09EE, 0x1356, 0x0BF8, 0x1842, 0x210B, 0x09EE, 0x1AD4,
+    0x1A53, 0x1A53, 0x190B, 0x210B, 0x2042, 0x1842, 0x2042, 0x190B,
+    0x210B, 0x4931, 0x6911, 0x6111, 0x0000, 0x0000, 0xA08B, 0xA8B1,
+    0xB0D1, 0x588B, 0xB0B1, 0xE0B0, 0xE0B0, 0xE0B0, 0xE8AE, 0xE0AE,
+    0x0000, 0x5084, 0x5884, 0xC88A, 0xE8AA, 0xE8AA, 0x5084, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0xC0C6, 0xE165, 0xE126, 0xE906, 0xC0C6, 0x90C4, 0xE0C8, 0xE8AA,
+    0xC88A, 0x5884, 0xE8AC, 0xE8AE, 0x1842, 0x0000, 0x5084, 0xE0B0,
+    0xD0AE, 0xC88E, 0xC8B1, 0xD0B1, 0x988B, 0xA8B1, 0xB0D1, 0xB0D1,
+    0x90D1, 0x90F1, 0x608B, 0x190B, 0x5131, 0x4931, 0x0000, 0x0000,
+    0x0000, 0x1842, 0x3191, 0x1A53, 0x1A53, 0x1AB4, 0x12B4, 0x210B,
+    0x0000, 0x1356, 0x0BF8, 0x0BD8, 0x0BD8, 0x0479, 0x0B33, 0x0000,
+    0x0B33, 0x0499, 0x0BD8, 0x0BF8, 0x0BF8, 0x09EE, 0x0000, 0x0000,
+    0x0000, 0x09EE, 0x1A53, 0x2212, 0x210B, 0x2212, 0x3191, 0x4931,
+    0x2991, 0x6911, 0x4951, 0x6111, 0x6111, 0x90D1, 0x5884, 0x90D1,
+    0xB0D1, 0x1842, 0x0000, 0x588B, 0xC8B1, 0xE8B0, 0x588B, 0xE0B0,
+    0xE8AE, 0xC88E, 0x1842, 0xC8AE, 0xE8AC, 0xE8AC, 0x988B, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x5084, 0xE906, 0xE8E7, 0xE0E7, 0xE0C8, 0xE0A8,
+    0x988B, 0x5884, 0xC88A, 0xE8AC, 0x988B, 0x0000, 0x0000, 0x1842,
+    0xE8AE, 0xE0B0, 0xC8B1, 0xD0B1, 0x1842, 0x0000, 0xB0B1, 0x988B,
+    0x608B, 0x90D1, 0x78F1, 0x6111, 0x1842, 0x4931, 0x0000, 0x0000,
+    0x0000, 0x3191, 0x3191, 0x2212, 0x2212, 0x12B4, 0x1AB4, 0x190B,
+    0x0000, 0x0000, 0x1356, 0x0BD8, 0x0BD8, 0x0C99, 0x0BD8, 0x0479,
+    0x0000, 0x0000, 0x0BD8, 0x0C99, 0x0BD8, 0x0BD8, 0x0B56, 0x1356,
+    0x2042, 0x0000, 0x0000, 0x09EE, 0x0A0E, 0x210B, 0x3191, 0x3191,
+    0x2991, 0x0000, 0x4931, 0x608B, 0x0000, 0x6911, 0x78F1, 0x90D1,
+    0x90D1, 0xA8D1, 0x0000, 0x0000, 0x0000, 0xB0D1, 0xC8B1, 0x986B,
+    0x608B, 0xE0B0, 0xE8AE, 0xE0AE, 0xE0AC, 0xE8AC, 0x5084, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5084, 0x90E4, 0xE8C8,
+    0xC88A, 0xC88A, 0x988B, 0xE0AC, 0xE8AC, 0xA06B, 0x2042, 0x1842,
+    0x1842, 0xE0B0, 0xE8B0, 0x988B, 0x0000, 0x0000, 0x5884, 0xB0D1,
+    0x588B, 0x0000, 0x90D1, 0x78F1, 0x6911, 0x6111, 0x2042, 0x0000,
+    0x0000, 0x4931, 0x3191, 0x1842, 0x2042, 0x1AB4, 0x1A53, 0x1A53,
+    0x0000, 0x0000, 0x190B, 0x0BD8, 0x0BD8, 0x0C79, 0x0479, 0x0C79,
+    0x0479, 0x0000, 0x0000, 0x210B, 0x0479, 0x0C99, 0x0BF8, 0x0000,
+    0x09EE, 0x1356, 0x190B, 0x0000, 0x0000, 0x21F2, 0x2212, 0x2212,
+    0x3191, 0x210B, 0x0000, 0x4951, 0x4931, 0x0000, 0x0000, 0x1842,
+    0x78D1, 0xB0D1, 0x90D1, 0x0000, 0x0000, 0x0000, 0x588B, 0xE0B0,
+    0xC8AE, 0xD08E, 0x988B, 0xD08E, 0x988B, 0x5884, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x1842, 0x2042, 0x5884, 0x608B, 0xA06B, 0x988B, 0xD08E,
+    0x988B, 0xC88E, 0xE8AE, 0xC8B1, 0x1842, 0x608B, 0x0000, 0xA08B,
+    0xA8B1, 0x90D1, 0x0000, 0x588B, 0x78F1, 0x78F1, 0x4931, 0x608B,
+    0x0000, 0x4931, 0x210B, 0x0000, 0x0000, 0x190B, 0x2212, 0x1AB4,
+    0x0000, 0x0000, 0x0000, 0x190B, 0x0BF8, 0x0C79, 0x0479, 0x0C79,
+    0x0479, 0x0C79, 0x0000, 0x0000, 0x0000, 0x0B33, 0x0479, 0x0C79,
+    0x1842, 0x0000, 0x2042, 0x0B33, 0x190B, 0x2042, 0x2212, 0x21F2,
+    0x3191, 0x3191, 0x0000, 0x0000, 0x4931, 0x6111, 0x2042, 0x608B,
+    0x1842, 0x608B, 0x90F1, 0x90D1, 0x608B, 0x588B, 0x608B, 0xA08B,
+    0x588B, 0xA08B, 0x1842, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x1842, 0x1842, 0x0000, 0x0000, 0xD08E, 0x588B, 0xA08B,
+    0xA8B1, 0xD0B1, 0xB0D1, 0x78D1, 0x1842, 0x78F1, 0x6111, 0x6911,
+    0x4951, 0x4931, 0x210B, 0x0000, 0x0000, 0x0000, 0x21F2, 0x1AB4,
+    0x190B, 0x0000, 0x0000, 0x0000, 0x210B, 0x0479, 0x0C79, 0x0479,
+    0x0C79, 0x0479, 0x0C79, 0x0000, 0x0000, 0x0000, 0x0000, 0x0479,
+    0x0C79, 0x0B33, 0x0000, 0x0000, 0x0000, 0x0333, 0x1AB4, 0x12B4,
+    0x2212, 0x2212, 0x210B, 0x190B, 0x3191, 0x4951, 0x4931, 0x6911,
+    0x210B, 0x4931, 0x0000, 0x0000, 0x0000, 0x1842, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x2042, 0xE8AE, 0xC8B1, 0xB0D1,
+    0xA8B1, 0xC8B1, 0xB0D1, 0xA8B1, 0x90D1, 0x90F1, 0x6111, 0x6111,
+    0x4931, 0x4951, 0x3191, 0x3191, 0x0000, 0x0000, 0x190B, 0x2212,
+    0x1A53, 0x0000, 0x0000, 0x0000, 0x0000, 0x210B, 0x0BD8, 0x0499,
+    0x0C79, 0x0479, 0x0C79, 0x0BD8, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x09EE, 0x0499, 0x0BD8, 0x2042, 0x0000, 0x210B, 0x12B4, 0x12B4,
+    0x1A53, 0x2212, 0x3191, 0x3191, 0x3191, 0x4931, 0x3191, 0x4931,
+    0x4931, 0x4951, 0x6911, 0x78F1, 0x1842, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x986B, 0xE0B0, 0xE0B0, 0xE0B0,
+    0xC8B1, 0xC8B1, 0xB0D1, 0xB0B1, 0x588B, 0x78F1, 0x90D1, 0x78F1,
+    0x6911, 0x6111, 0x5151, 0x4931, 0x3191, 0x4931, 0x190B, 0x2212,
+    0x21F2, 0x210B, 0x0000, 0x0000, 0x0000, 0x0000, 0x210B, 0x0499,
+    0x0BD8, 0x0C79, 0x0479, 0x0C79, 0x0333, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0BD8, 0x0C79, 0x0333, 0x3A42, 0x1356, 0x1356,
+    0x12B4, 0x12B4, 0x2212, 0x2212, 0x3191, 0x3191, 0x3191, 0x4931,
+    0x4931, 0x6111, 0x6111, 0x78F1, 0x78D1, 0xB0D1, 0xA06B, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x5884, 0xE8AE, 0xE0B0, 0xE0B0, 0xE0B0,
+    0xC8B1, 0xC8B1, 0xD0B1, 0xC8B1, 0x988B, 0x0000, 0x90D1, 0x78F1,
+    0x608B, 0x78D1, 0x588B, 0x4931, 0x4951, 0x4931, 0x3191, 0x3191,
+    0x3191, 0x3191, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x190B,
+    0x0BF8, 0x0C99, 0x0479, 0x0C79, 0x0479, 0x0BD8, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x2042, 0x0BD8, 0x0BF8, 0x0B56, 0x1356,
+    0x1AB4, 0x12B4, 0x09EE, 0x2212, 0x09EE, 0x3191, 0x3191, 0x0000,
+    0x210B, 0x6111, 0x4931, 0x6911, 0x78F1, 0x90D1, 0x90F1, 0xA8D1,
+    0xB0B1, 0x588B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0xC8AE, 0xE8AE, 0xE0B0, 0xE0B0, 0xE0B0,
+    0xE0B0, 0xE0B0, 0xC8B1, 0xD0B1, 0x608B, 0x588B, 0x90D1, 0xB0D1,
+    0x608B, 0x78F1, 0x6111, 0x2042, 0x4931, 0x4951, 0x3191, 0x4931,
+    0x3191, 0x2212, 0x2042, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x09EE, 0x0BD8, 0x0BD8, 0x0479, 0x0C79, 0x0499, 0x0B33, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1356, 0x1356, 0x0B56,
+    0x1AB4, 0x1356, 0x12B4, 0x0000, 0x09EE, 0x2212, 0x210B, 0x4951,
+    0x2991, 0x608B, 0x608B, 0x6111, 0x6111, 0x90D1, 0x88D1, 0xB0D1,
+    0xA8B1, 0xD0B1, 0xC8B1, 0xB0D1, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x1842, 0xE8AC, 0xE0AC, 0xE0AE, 0xE8AE, 0xE0B0,
+    0xC88E, 0xE0B0, 0xC8B1, 0x988B, 0xC8B1, 0xB0B1, 0x988B, 0x608B,
+    0x78D1, 0x608B, 0x6111, 0x78F1, 0x0000, 0x4931, 0x4931, 0x4951,
+    0x3191, 0x3191, 0x3191, 0x2212, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x09EE, 0x0B56, 0x0BF8, 0x0BD8, 0x0C99, 0x0BD8, 0x0333,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x09EE, 0x1356, 0x1356,
+    0x1356, 0x1356, 0x12B4, 0x1A53, 0x0000, 0x210B, 0x3191, 0x190B,
+    0x210B, 0x4931, 0x210B, 0x608B, 0x6111, 0x6111, 0x608B, 0x90F1,
+    0x988B, 0xB0B1, 0xB0D1, 0xC8B1, 0xC8B1, 0xC8B1, 0x1842, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x90E4, 0xE0AC, 0xE0AC, 0xE8AE, 0xE0AE, 0xE0AE,
+    0xE8AE, 0xC8B1, 0xE0B0, 0xB0B1, 0x988B, 0xC8B1, 0xB0B1, 0xB0D1,
+    0x608B, 0x90D1, 0x190B, 0x78F1, 0x6111, 0x6911, 0x4951, 0x4931,
+    0x3191, 0x4931, 0x2042, 0x2212, 0x2212, 0x3191, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x09EE, 0x0BD8, 0x0BF8, 0x0BD8, 0x0BD8, 0x0C79,
+    0x0333, 0x0000, 0x0000, 0x0000, 0x0000, 0x3A42, 0x0BF8, 0x0BD8,
+    0x0A0E, 0x09EE, 0x1AB4, 0x1AB4, 0x1A53, 0x09EE, 0x2212, 0x2212,
+    0x190B, 0x5131, 0x190B, 0x5131, 0x190B, 0x6111, 0x78F1, 0x608B,
+    0x78F1, 0x588B, 0x90D1, 0xC8B1, 0xB0B1, 0xC8B1, 0xC8B1, 0xE8B0,
+    0x608B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x986B, 0xE8AA, 0xE8AA, 0xE0AC, 0xE0AC, 0xE0AE,
+    0xE8AE, 0xE0B0, 0xE0AE, 0xE0B0, 0x1842, 0x1842, 0xD0B1, 0xB0D1,
+    0x0000, 0xA8B1, 0x90D1, 0x588B, 0x78F1, 0x78F1, 0x6111, 0x6911,
+    0x4931, 0x4931, 0x0000, 0x0000, 0x190B, 0x2212, 0x2212, 0x2042,
+    0x0000, 0x0000, 0x0000, 0x09EE, 0x1356, 0x0BF8, 0x1356, 0x0BD8,
+    0x0BF8, 0x0333, 0x0000, 0x0000, 0x0000, 0x0000, 0x0B33, 0x0BD8,
+    0x1AB4, 0x0000, 0x0000, 0x09EE, 0x1A73, 0x1A53, 0x2212, 0x21F2,
+    0x3191, 0x3191, 0x190B, 0x4931, 0x2042, 0x0000, 0x6911, 0x78F1,
+    0x0000, 0x608B, 0x90D1, 0xA8D1, 0xB0D1, 0xC8B1, 0xC8B1, 0xE0B0,
+    0xE0B0, 0xE0B0, 0x986B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0xC88A, 0xE8AA, 0xE0AA, 0xE0AC, 0xE0AC, 0xE8AE,
+    0xE0AE, 0xE0B0, 0xE0AE, 0xE0B0, 0xE0B0, 0xE8B0, 0x988B, 0xC8B1,
+    0xD0B1, 0x988B, 0x90D1, 0xA8D1, 0x90D1, 0x90D1, 0x78F1, 0x78F1,
+    0x6911, 0x4931, 0x5131, 0x190B, 0x0000, 0x0000, 0x210B, 0x2212,
+    0x09EE, 0x0000, 0x0000, 0x0000, 0x1A53, 0x1356, 0x1356, 0x0BF8,
+    0x0B56, 0x0BF8, 0x0B33, 0x0000, 0x0000, 0x0000, 0x09EE, 0x0BD8,
+    0x1356, 0x0000, 0x0000, 0x0000, 0x09EE, 0x1A53, 0x2212, 0x2212,
+    0x3191, 0x2212, 0x3191, 0x4931, 0x4931, 0x190B, 0x608B, 0x78F1,
+    0x608B, 0x588B, 0x90D1, 0xB0D1, 0xA8B1, 0xC8B1, 0xC8B1, 0xE8B0,
+    0xC8B1, 0xE0B0, 0xE0B0, 0xE0B0, 0xB0D1, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0xC0C6, 0xE0C8, 0xE0A8, 0xE0AA, 0xE8AA, 0xE0AC,
+    0xE0AC, 0xE0AC, 0x988B, 0xE8AE, 0xE0AE, 0xE0B0, 0xE0B0, 0xE0B0,
+    0xC8B1, 0xC8B1, 0xB0B1, 0xA8D1, 0x90D1, 0x90D1, 0x78F1, 0x78F1,
+    0x6111, 0x6111, 0x4931, 0x4931, 0x3191, 0x0000, 0x0000, 0x0000,
+    0x3191, 0x2212, 0x0000, 0x0000, 0x09EE, 0x0A0E, 0x12B4, 0x1356,
+    0x1356, 0x1356, 0x12B4, 0x09EE, 0x09EE, 0x0000, 0x0000, 0x1356,
+    0x1356, 0x210B, 0x0000, 0x0000, 0x190B, 0x1A73, 0x09EE, 0x2212,
+    0x3191, 0x3191, 0x3191, 0x3191, 0x3191, 0x4931, 0x4931, 0x6911,
+    0x6111, 0x78F1, 0x78F1, 0x90D1, 0x90D1, 0xA8D1, 0xB0D1, 0xC8B1,
+    0xC8B1, 0xE8B0, 0xE0B0, 0xE0B0, 0xE0AE, 0xE0B0, 0x986B, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0xC0C6, 0xE0E7, 0xE8A8, 0xE0AA, 0xE0AA, 0xE0AC,
+    0xE8AC, 0xE8AE, 0x588B, 0x0000, 0x988B, 0xE0B0, 0xE0B0, 0xE8B0,
+    0xC8B1, 0xC8B1, 0xB0D1, 0x88D1, 0xB0B1, 0xB0D1, 0x90F1, 0x90D1,
+    0x78F1, 0x0000, 0x190B, 0x6911, 0x190B, 0x4931, 0x3191, 0x0000,
+    0x0000, 0x210B, 0x2212, 0x09EE, 0x2042, 0x21F2, 0x0000, 0x12B4,
+    0x1AB4, 0x1356, 0x12B4, 0x0B33, 0x0000, 0x0333, 0x0000, 0x210B,
+    0x1AB4, 0x0333, 0x0000, 0x0000, 0x2042, 0x12B4, 0x2212, 0x2212,
+    0x3191, 0x0000, 0x210B, 0x4951, 0x3191, 0x4931, 0x4931, 0x6111,
+    0x6111, 0x78F1, 0x78F1, 0x88D1, 0x90D1, 0xB0D1, 0xA8B1, 0x588B,
+    0x0000, 0xE0B0, 0xE0B0, 0xE0B0, 0xE0B0, 0xE0B0, 0xE8AE, 0xE8AE,
+    0x988B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x5084, 0xE8E7, 0xE0C8, 0xE8A8, 0xE0C8, 0xE0AA,
+    0xE0AA, 0xE8AC, 0xE0AC, 0xC88A, 0x0000, 0x0000, 0xC8AE, 0xA8B1,
+    0x0000, 0x0000, 0x608B, 0xC8B1, 0xB0D1, 0xC8B1, 0xA8B1, 0xB0D1,
+    0x90D1, 0x190B, 0x0000, 0x0000, 0x190B, 0x210B, 0x0000, 0x4931,
+    0x210B, 0x0000, 0x0000, 0x3191, 0x2991, 0x3191, 0x1842, 0x0000,
+    0x1A73, 0x1AB4, 0x12B4, 0x1AB4, 0x1A53, 0x0000, 0x210B, 0x190B,
+    0x09EE, 0x1AB4, 0x2042, 0x0000, 0x1842, 0x1A53, 0x210B, 0x0000,
+    0x190B, 0x2042, 0x0000, 0x0000, 0x3191, 0x4931, 0x4951, 0x6911,
+    0x6111, 0x78F1, 0x1842, 0x0000, 0x2042, 0x78D1, 0xB0D1, 0x1842,
+    0x0000, 0x98C4, 0xD0B1, 0xE0B0, 0xE0B0, 0xE0B0, 0xE8AE, 0xE0AE,
+    0xE0AE, 0xE0AE, 0x5884, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0xE906, 0xE0E7, 0xE108, 0xE0A8, 0xE0AA,
+    0xE8AA, 0xE108, 0xE0AA, 0xE0AC, 0xE8AC, 0x608B, 0x1842, 0xE8B0,
+    0x988B, 0x0000, 0x0000, 0x986B, 0xD0B1, 0xC8B1, 0xC8B1, 0xB0D1,
+    0x90D1, 0xB0D1, 0x0000, 0x0000, 0x0000, 0x608B, 0x4931, 0x0000,
+    0x0000, 0x4931, 0x3191, 0x0000, 0x3191, 0x2212, 0x2212, 0x0000,
+    0x0000, 0x1A53, 0x1A53, 0x12B4, 0x1A53, 0x1A53, 0x0000, 0x210B,
+    0x1A53, 0x12B4, 0x1AB4, 0x1842, 0x210B, 0x1A53, 0x190B, 0x0000,
+    0x210B, 0x3191, 0x0000, 0x0000, 0x0000, 0x4951, 0x4931, 0x6111,
+    0x6111, 0x78D1, 0x78F1, 0x78D1, 0x0000, 0x0000, 0x608B, 0xC8B1,
+    0x5884, 0x0000, 0xC8AE, 0xE0B0, 0xE0B0, 0xE0B0, 0xE0B0, 0xE0B0,
+    0xE0AE, 0xE0AE, 0xE0AC, 0xE8AC, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x5084, 0xE926, 0xE106, 0xE0E7, 0xE8C8,
+    0xE0C8, 0xE0AA, 0xE0A8, 0xE8AA, 0xE0AA, 0xE0AC, 0xC8AE, 0x986B,
+    0xE8AE, 0xE0AE, 0x0000, 0x0000, 0xA8D1, 0xE8B0, 0xC8B1, 0xC8B1,
+    0x986B, 0x1842, 0x90D1, 0x2042, 0x0000, 0x0000, 0x0000, 0x4951,
+    0x190B, 0x0000, 0x0000, 0x5131, 0x3191, 0x3191, 0x2991, 0x3191,
+    0x0000, 0x0000, 0x0A0E, 0x2212, 0x21F2, 0x1A53, 0x09EE, 0x0000,
+    0x0000, 0x2212, 0x2212, 0x1A53, 0x2212, 0x21F2, 0x2042, 0x0000,
+    0x0000, 0x3191, 0x0000, 0x0000, 0x0000, 0x0000, 0x4931, 0x190B,
+    0x0000, 0x6911, 0x6111, 0x78F1, 0x90D1, 0x608B, 0x0000, 0xB0D1,
+    0xA8D1, 0xA06B, 0x988B, 0xE0B0, 0xC8B1, 0xE8B0, 0xE0AE, 0xE0B0,
+    0xE0AE, 0xE8AE, 0xE0AC, 0xE0AC, 0xE0AA, 0x1842, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x1842, 0xE165, 0xE906, 0xE108,
+    0xE0C8, 0xE0A8, 0xE0C8, 0xE8AA, 0xE0AA, 0xA06B, 0x988B, 0xE0AE,
+    0xC88A, 0xA08B, 0xE8AE, 0x1842, 0x5084, 0xE0B0, 0xE0B0, 0xE8B0,
+    0xC8B1, 0xC8B1, 0xB0B1, 0xA8D1, 0x608B, 0x608B, 0x608B, 0x608B,
+    0x6111, 0x6911, 0x1842, 0x0000, 0x0000, 0x606B, 0x2991, 0x3191,
+    0x2042, 0x0000, 0x0000, 0x2212, 0x2212, 0x21F2, 0x2212, 0x2212,
+    0x0000, 0x0000, 0x190B, 0x21F2, 0x2212, 0x2212, 0x0000, 0x0000,
+    0x0000, 0x3191, 0x3191, 0x2042, 0x1842, 0x210B, 0x1842, 0x6111,
+    0x608B, 0x6111, 0x6111, 0x78D1, 0x78F1, 0xB0D1, 0x90D1, 0x5884,
+    0xA8D1, 0x90D1, 0x588B, 0xE8B0, 0xC8B1, 0x986B, 0xE0B0, 0xE0B0,
+    0xE0AE, 0xE0B0, 0xE0AE, 0xE8AE, 0xE8AC, 0xE8AC, 0x1842, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1842, 0xE906, 0xE906,
+    0xE0E7, 0xE0E7, 0xE8C8, 0xE0C8, 0xE0A8, 0xC0C6, 0x1842, 0x0000,
+    0xE8AC, 0xE0AE, 0xE8AE, 0xE0AE, 0xC8AE, 0xE0B0, 0xE0B0, 0xE0B0,
+    0x588B, 0x0000, 0xB0B1, 0xC8B1, 0x988B, 0x608B, 0x1842, 0x608B,
+    0x608B, 0x78D1, 0x6111, 0x6911, 0x4931, 0x1842, 0x0000, 0x4951,
+    0x3191, 0x0000, 0x0000, 0x0000, 0x3191, 0x2212, 0x3191, 0x2212,
+    0x09EE, 0x0000, 0x0000, 0x0000, 0x3191, 0x2212, 0x1842, 0x0000,
+    0x210B, 0x3191, 0x3191, 0x3191, 0x190B, 0x4931, 0x210B, 0x4931,
+    0x4931, 0x6911, 0x6111, 0x1842, 0x0000, 0x90F1, 0x90D1, 0xB0D1,
+    0xB0D1, 0xC8B1, 0xB0B1, 0xC8B1, 0xC8B1, 0x608B, 0x0000, 0x988B,
+    0xE8AE, 0xE0B0, 0xE0AE, 0xE8AE, 0xE0AC, 0xE0AC, 0xE0AA, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE165,
+    0xE126, 0xE106, 0xE8E7, 0xE0E7, 0xE0A8, 0xE8AA, 0x5884, 0x90E4,
+    0xC88A, 0xE0AE, 0xE0AC, 0xE8AE, 0xE0AE, 0xE0B0, 0xE0B0, 0xE0B0,
+    0xE8B0, 0x588B, 0xA08B, 0x986B, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x608B, 0x78F1, 0x608B, 0x6111, 0x6111, 0x6911,
+    0x4951, 0x4931, 0x0000, 0x0000, 0x0000, 0x4951, 0x3191, 0x3191,
+    0x3191, 0x2991, 0x0000, 0x0000, 0x0000, 0x3191, 0x3191, 0x3191,
+    0x3191, 0x4931, 0x210B, 0x4951, 0x3191, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x1842, 0x608B, 0x190B, 0x0000, 0x90D1, 0xA8B1,
+    0xB0D1, 0xC8B1, 0xC8B1, 0xC8B1, 0xC8B1, 0xE8B0, 0x986B, 0x608B,
+    0x1842, 0xE0B0, 0xE0AE, 0xE8AE, 0xE0AC, 0xE0AE, 0xE0AC, 0xE8AC,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0xC165, 0xE965, 0xE108, 0xE0E7, 0xE0A8, 0xE8C8, 0xE0A8, 0xC0C6,
+    0x988B, 0xE8AC, 0xE0AC, 0xE0AC, 0xE0AC, 0xE8AE, 0xE0AE, 0xE0B0,
+    0xA8B1, 0xC8B1, 0xC8B1, 0x98E4, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x78D1, 0x78F1, 0x0000, 0x0000, 0x1842,
+    0x608B, 0x6111, 0x1842, 0x0000, 0x0000, 0x0000, 0x210B, 0x3191,
+    0x3191, 0x3191, 0x190B, 0x0000, 0x0000, 0x0000, 0x210B, 0x3191,
+    0x190B, 0x2042, 0x0000, 0x0000, 0x190B, 0x4931, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x210B, 0x90D1, 0xB0D1,
+    0x988B, 0xB0B1, 0xB0D1, 0xC8B1, 0xC8B1, 0xE0B0, 0xC8B1, 0xE8B0,
+    0xC88E, 0x90E4, 0xE8AE, 0xE0AE, 0xE0AC, 0xE8AC, 0xE0AC, 0xE0AC,
+    0xC88A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0xC185, 0xE165, 0xE106, 0xE8E7, 0xE108, 0xE0A8, 0xE0C8,
+    0xE0A8, 0xE8AC, 0xE0AA, 0xE8AC, 0x90E4, 0xC88E, 0xE0AE, 0xE0AE,
+    0xE8AE, 0xD0AE, 0x986B, 0xE0B0, 0xB0D1, 0x608B, 0x1842, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x90D1, 0x78F1, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x210B, 0x210B, 0x0000, 0x0000, 0x0000, 0x4951,
+    0x3191, 0x4931, 0x3191, 0x4951, 0x0000, 0x0000, 0x0000, 0x190B,
+    0x210B, 0x0000, 0x0000, 0x0000, 0x0000, 0x4931, 0x5131, 0x1842,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x1842, 0x78F1, 0x90D1, 0xA8D1,
+    0x90D1, 0x608B, 0xA8D1, 0xD0B1, 0xC8B1, 0xE0B0, 0xA8D1, 0xC8B1,
+    0xE0B0, 0xE0B0, 0xE0AE, 0xE8AE, 0xE0AE, 0xE0AE, 0xE0AC, 0xE8AC,
+    0xE0AA, 0xC88A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x90C4, 0xE965, 0xE106, 0xE906, 0xE0E7, 0xE0E7,
+    0xE0C8, 0xE8AA, 0xE0C8, 0xE0AA, 0x986B, 0x0000, 0x90E4, 0xE8AE,
+    0xE8AE, 0xE0B0, 0xE0AE, 0xA8B1, 0x0000, 0x988B, 0xB0B1, 0xC8B1,
+    0xC8B1, 0xD0B1, 0xA8D1, 0xB0B1, 0x88D1, 0xB0D1, 0x190B, 0x0000,
+    0x0000, 0x0000, 0x1842, 0x6911, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x190B, 0x5131, 0x4951, 0x4931, 0x210B, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x4951, 0x2042, 0x0000, 0x0000, 0x0000, 0x190B, 0x6911,
+    0x608B, 0x6111, 0x6111, 0x78F1, 0x78D1, 0x78F1, 0x90D1, 0x78F1,
+    0x0000, 0x608B, 0xB0B1, 0xC8B1, 0xC8B1, 0xE0B0, 0x988B, 0x0000,
+    0x608B, 0xE8B0, 0xE0AE, 0xE0AE, 0xE8AE, 0xE0AE, 0xE0AC, 0xE0AC,
+    0xE8AA, 0xE0AA, 0x5084, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x90E4, 0xE145, 0xE965, 0xE126, 0xE106,
+    0xE0E7, 0xE108, 0xE8A8, 0xE0AA, 0xE8AA, 0xD127, 0xC8AE, 0xE0AC,
+    0xE0AC, 0xE0AE, 0xE8AE, 0xE8B0, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x1842, 0x78D1, 0x988B, 0xA06B, 0xA8D1, 0xC8B1, 0x90D1, 0xA08B,
+    0x0000, 0x0000, 0x1842, 0x90F1, 0x608B, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x4931, 0x6911, 0x4951, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x4931, 0x6911, 0x1842, 0x0000, 0x0000, 0x4951,
+    0x4931, 0x78D1, 0x78F1, 0x78D1, 0x608B, 0x608B, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0xC8B1, 0xC8B1, 0xC8B1, 0xE0B0, 0xE0B0,
+    0xC8AE, 0xC88E, 0xE0B0, 0xE0B0, 0xE8AE, 0xE0AE, 0xE0AC, 0xE0AC,
+    0xE8AC, 0xE0AC, 0xE8AA, 0x5884, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x5884, 0xE1A6, 0xE906, 0xE126,
+    0xE108, 0xE0E7, 0xE8C8, 0xE0A8, 0xE0C8, 0xE0AA, 0xE8AA, 0xE0AC,
+    0xE0AC, 0xE0AC, 0xE8AC, 0xE0AE, 0x90C4, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x588B, 0x608B, 0xB0D1,
+    0x588B, 0x0000, 0x1842, 0x90D1, 0x90D1, 0x2042, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x1842, 0x210B, 0x1842, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x2042, 0x6911, 0x6111, 0x1842, 0x0000,
+    0x608B, 0x6911, 0x78F1, 0x1842, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x5884, 0xD0B1, 0xC8B1, 0xE8B0,
+    0xE0B0, 0xE0B0, 0xE0AE, 0xE0B0, 0xE0AE, 0xE8AE, 0xE0AC, 0xE0AC,
+    0xE0AC, 0xE8AC, 0xE0AA, 0xE0AA, 0x1842, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1842, 0xE1A6, 0xE965,
+    0xE106, 0xE106, 0xE0E7, 0xE8E7, 0xC0C6, 0xC0C6, 0xE0C8, 0xE0AA,
+    0xC0C6, 0xE0AC, 0xE8AC, 0xE8AE, 0xE8AC, 0x1842, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x986B, 0x608B, 0x588B,
+    0xB0D1, 0x90D1, 0x988B, 0xB0D1, 0x88D1, 0x90D1, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x78F1, 0x78D1, 0x78F1,
+    0x608B, 0x90D1, 0x78F1, 0x588B, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xC88E, 0xE0B0,
+    0xE0B0, 0xE0B0, 0xE0B0, 0xE0B0, 0xE0AE, 0xE8AE, 0xE0AC, 0xE0AE,
+    0xE0AC, 0xE8AC, 0xE0AA, 0xE8AA, 0xE8C8, 0x1842, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE9C5,
+    0xE965, 0xE165, 0xE106, 0xE106, 0x5884, 0x0000, 0x0000, 0xE8C8,
+    0x90E4, 0x0000, 0x0000, 0x588B, 0xE8AC, 0xE0AE, 0x986B, 0xD0AE,
+    0x986B, 0x988B, 0x5884, 0x1842, 0x0000, 0x0000, 0x608B, 0xA06B,
+    0xD0B1, 0xC8B1, 0xA8D1, 0xB0B1, 0xA8D1, 0xB0B1, 0x588B, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1842, 0x78F1,
+    0x78D1, 0x90D1, 0x78F1, 0x90D1, 0x608B, 0x1842, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x608B, 0xA08B, 0xB0D1, 0x588B, 0xD0B1,
+    0xE0B0, 0x986B, 0x1842, 0x0000, 0x5884, 0xE8AE, 0x5884, 0x0000,
+    0x608B, 0xE8AC, 0xE0AA, 0xE0AA, 0xE8C8, 0xE0A8, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0xC165, 0xE9C5, 0xE165, 0xE145, 0xC0C6, 0x0000, 0x0000, 0x0000,
+    0xE8C8, 0xE8AA, 0x1842, 0x986B, 0xE0AA, 0xE8AC, 0xE0AC, 0xE0AE,
+    0xE0AE, 0xE0B0, 0xE8AE, 0xE0B0, 0xE0B0, 0xE0B0, 0xE0AE, 0xE8AE,
+    0xC8B1, 0xE0B0, 0xC8B1, 0xC8B1, 0xB0D1, 0xA8B1, 0xA08B, 0x608B,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x608B,
+    0x1842, 0x78F1, 0x90D1, 0xA8D1, 0x90D1, 0xA8D1, 0x90D1, 0x90D1,
+    0x988B, 0xB0B1, 0xA8D1, 0xD0B1, 0xC8B1, 0xE0B0, 0xE0B0, 0xE0B0,
+    0xE0B0, 0xE0B0, 0xC88E, 0x98E4, 0x0000, 0x986B, 0xE8AE, 0x5084,
+    0x0000, 0x0000, 0x90E4, 0xE8AC, 0xE0AA, 0xE0AA, 0xC0C6, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0xC185, 0xE1A6, 0xE965, 0xE145, 0x90E4, 0x0000, 0x0000,
+    0x0000, 0x90C4, 0xE8C8, 0xE8AA, 0xE0AA, 0xE0AA, 0xE0AA, 0xE8AC,
+    0xE0AC, 0xE0AE, 0xE0AC, 0xE8AE, 0xE0AE, 0xE0B0, 0xE0AE, 0xE0B0,
+    0xE0B0, 0xE0B0, 0xC8B1, 0xC8B1, 0xC8B1, 0xD0B1, 0x1842, 0x90D1,
+    0x1842, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x2042, 0xA08B, 0x0000, 0xA8B1, 0x90D1, 0xA8D1, 0xB0D1, 0xA8B1,
+    0xB0D1, 0xC8B1, 0xB0B1, 0xC8B1, 0xC8B1, 0xE0B0, 0xC8B1, 0xE8B0,
+    0xE0B0, 0xE0B0, 0xE0AE, 0xE0B0, 0xE0AE, 0xE8AE, 0xE0AC, 0xC8AE,
+    0x0000, 0x0000, 0x0000, 0x1842, 0xE8AA, 0xE0AA, 0xE8A8, 0x90E4,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x5084, 0xE9C5, 0xE9A6, 0xE9C5, 0x5884, 0x0000,
+    0x0000, 0x0000, 0x1842, 0xE0C8, 0xE0A8, 0xE8AA, 0xE0AA, 0xE8AA,
+    0x5884, 0x5084, 0xE0AC, 0xE8AE, 0xE0AE, 0xE0B0, 0xE0AE, 0xE0B0,
+    0xE8AE, 0xE0B0, 0xE0B0, 0xE0B0, 0xE0B0, 0xE0B0, 0x608B, 0x988B,
+    0xB0D1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x90D1, 0x608B, 0x1842, 0xC8B1, 0xB0B1, 0xC8B1,
+    0xA8D1, 0xD0B1, 0xC8B1, 0xC8B1, 0xC8B1, 0xE0B0, 0xE0B0, 0xE0B0,
+    0xE0B0, 0xB0B1, 0x988B, 0xE0B0, 0xE0AE, 0xE0B0, 0xE0AE, 0xE8AE,
+    0x90C4, 0x0000, 0x0000, 0x0000, 0x0000, 0xE0AA, 0xE8C8, 0xE8A8,
+    0x5084, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x1842, 0xF1C5, 0xE9C5, 0xE165, 0x5084,
+    0x0000, 0x0000, 0x0000, 0xA06B, 0xE8C8, 0xE0A8, 0xC88A, 0x5084,
+    0x0000, 0x0000, 0x608B, 0xE8AC, 0xE0AC, 0xE0AE, 0xC8AE, 0xE8AE,
+    0x988B, 0xE8AE, 0xE0AE, 0xE0B0, 0xC88E, 0xE0B0, 0xC8B1, 0x0000,
+    0x988B, 0xA06B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x988B, 0x986B, 0x0000, 0xB0D1, 0xC8B1,
+    0xB0B1, 0xC8B1, 0xC8B1, 0xD0B1, 0x988B, 0xE0B0, 0xC8B1, 0xE8B0,
+    0xE0B0, 0xE0B0, 0x986B, 0x0000, 0x0000, 0x588B, 0xD0AE, 0xE8AE,
+    0xE0AC, 0xC88E, 0x0000, 0x0000, 0x0000, 0x1842, 0xE8C8, 0xE0A8,
+    0xE8C8, 0x1842, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF285, 0xE9C5, 0xE9C5,
+    0x5084, 0x0000, 0x0000, 0x0000, 0xC0C6, 0xE108, 0xE8A8, 0xC0C6,
+    0x0000, 0x0000, 0x5884, 0xE0AC, 0xE0AC, 0xE8AC, 0x5884, 0x5084,
+    0xE8AE, 0xE0AE, 0xE8AE, 0xC8AE, 0x0000, 0x90C4, 0xE8B0, 0x988B,
+    0x608B, 0xE8B0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x1842, 0xD0AE, 0x1842, 0x588B,
+    0xD0B1, 0x90D1, 0x1842, 0xC8B1, 0xC8B1, 0xE0B0, 0xE8B0, 0x986B,
+    0x5884, 0xE0B0, 0xE0B0, 0xE0B0, 0x608B, 0x0000, 0x0000, 0x90E4,
+    0xE0AC, 0xE0AC, 0xE8AA, 0x0000, 0x0000, 0x0000, 0x1842, 0xE0E7,
+    0xE8A8, 0xE108, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xC165, 0xF285,
+    0xE9C5, 0x90C4, 0x0000, 0x0000, 0x0000, 0xC0C6, 0xE0E7, 0xE0E7,
+    0xC0C6, 0x5084, 0x5884, 0xE8AA, 0xE8AA, 0xE0AC, 0x5084, 0x0000,
+    0xA08B, 0xE0AE, 0xE8AC, 0x5084, 0x0000, 0x608B, 0xE8AE, 0xE0B0,
+    0xC88E, 0xE0B0, 0x988B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x986B, 0xD0B1,
+    0xA8D1, 0xE0B0, 0xC8B1, 0x5884, 0x0000, 0x5884, 0xD0B1, 0xE0B0,
+    0x986B, 0x0000, 0x608B, 0xE8AE, 0xE0AE, 0xE0AE, 0x1842, 0x5884,
+    0xC88A, 0xE8AA, 0xE0AA, 0xC8AA, 0x0000, 0x0000, 0x0000, 0x5884,
+    0x988B, 0xE8E7, 0x90C4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x62A3,
+    0xF285, 0x62A3, 0x5884, 0x5884, 0x0000, 0x0000, 0x0000, 0xE126,
+    0xE0E7, 0xC88A, 0xC0C6, 0xE0A8, 0xE8C8, 0xE8AA, 0x5884, 0x0000,
+    0x1842, 0xE0AC, 0xE8AC, 0x0000, 0x0000, 0x986B, 0xE0AE, 0xE0B0,
+    0xD0AE, 0x588B, 0xD08E, 0x608B, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x588B,
+    0xD0B1, 0x988B, 0xC88E, 0xE0B0, 0xE0B0, 0x588B, 0x0000, 0x0000,
+    0xE8AE, 0xE8B0, 0x1842, 0x0000, 0x5084, 0xE8AE, 0xE0AE, 0xE8AE,
+    0x988B, 0x986B, 0xE0AC, 0xE8AC, 0x5884, 0x0000, 0x0000, 0x0000,
+    0x5884, 0xC0C6, 0xE8E7, 0x90E4, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x1842, 0xF285, 0xC965, 0x1842, 0x98C4, 0x0000, 0x0000, 0x0000,
+    0x5884, 0xE906, 0xE0E7, 0xE0E7, 0xE8C8, 0xE0E7, 0x5084, 0x98E4,
+    0xC88A, 0xE8AC, 0xE0AA, 0xE0AC, 0x5084, 0xC88A, 0xE8AC, 0xE8AE,
+    0x1842, 0x0000, 0xC8AE, 0xE8AE, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0xE0B0, 0xC8AE, 0x0000, 0x1842, 0xE8B0, 0xE0AE, 0xC88E,
+    0x0000, 0xE8AE, 0xE0AE, 0xE0AE, 0x988B, 0x0000, 0x1842, 0xD08E,
+    0xE8AC, 0xE0AC, 0xE0AA, 0xE8AA, 0xC88A, 0x0000, 0x0000, 0x0000,
+    0x5084, 0x5884, 0xC0C6, 0xE926, 0x1842, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0xF285, 0xF265, 0x1842, 0x3242, 0xC985, 0x90C4,
+    0x0000, 0xC185, 0xE126, 0xE106, 0xE0E7, 0xE108, 0xC88A, 0xE8AA,
+    0xE0C8, 0xE8AA, 0xC0C6, 0x0000, 0x986B, 0xE0AC, 0xE8AC, 0x988B,
+    0x0000, 0x0000, 0xE8AE, 0xE8AE, 0x1842, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x1842, 0xE0B0, 0xC88E, 0x0000, 0x0000, 0x988B,
+    0xE8AE, 0xE0B0, 0xE8AE, 0x1842, 0x988B, 0xE0AE, 0xE8AC, 0xE0AC,
+    0xC88A, 0xE0AC, 0xE0AA, 0xE8AC, 0xE8AA, 0xC88A, 0x0000, 0x1842,
+    0x5884, 0x98E4, 0x1842, 0xE126, 0xE906, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0xCA64, 0xF265, 0x9AA3, 0x0000, 0x5884,
+    0x90E4, 0xE9A6, 0xE165, 0x1842, 0x0000, 0x5884, 0x0000, 0xC8C6,
+    0xE0A8, 0xE8C8, 0x90C4, 0x0000, 0x0000, 0x988B, 0xC88A, 0x1842,
+    0x0000, 0x2042, 0xE8AC, 0xE0AE, 0x588B, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x5884, 0xD0AE, 0xC88E, 0x0000,
+    0x0000, 0x1842, 0xD0AE, 0xC88A, 0x0000, 0x0000, 0x608B, 0xE8AC,
+    0xE0AC, 0xE0AA, 0x1842, 0x1842, 0x0000, 0x2042, 0xE8C8, 0xE8A8,
+    0x90E4, 0x5084, 0x0000, 0x5884, 0xE906, 0xC0C6, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x5084, 0xFB65, 0xCA64, 0x0000,
+    0x0000, 0x5884, 0xE9C5, 0x5084, 0x0000, 0x0000, 0x0000, 0x0000,
+    0xE8E7, 0xE0E7, 0xC0C6, 0x0000, 0x0000, 0xE0C8, 0xC88A, 0x0000,
+    0x0000, 0x0000, 0xC8AE, 0xE8AA, 0xC88E, 0xA08B, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xC8AE, 0xC88A, 0x986B,
+    0xD0AE, 0x1842, 0x0000, 0x0000, 0xC88A, 0xC8AE, 0x0000, 0x0000,
+    0xC88A, 0xE0AC, 0xE8AA, 0x0000, 0x0000, 0x0000, 0x0000, 0x5884,
+    0xE8C8, 0x90C4, 0x0000, 0x0000, 0x5084, 0xE965, 0x5884, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFB65, 0xF365,
+    0x0000, 0x9AA3, 0xE9C5, 0x5084, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x98E4, 0xE906, 0xE0E7, 0x5084, 0x0000, 0xE8C8, 0x986B, 0x0000,
+    0x0000, 0x0000, 0xA08B, 0xC88E, 0xE8AA, 0xE0AC, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE0AE,
+    0xC88A, 0x988B, 0x988B, 0x1842, 0x0000, 0x0000, 0xD08A, 0xC88A,
+    0x0000, 0x5884, 0xE8AA, 0xE0AA, 0x90E4, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x5884, 0xE8E7, 0x90E4, 0x0000, 0xC165, 0xE965, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCB84,
+    0xF365, 0xFB65, 0xF285, 0xCA64, 0x1842, 0x0000, 0x0000, 0x0000,
+    0x0000, 0xE165, 0xE926, 0xE906, 0x1842, 0xD127, 0xC0C6, 0x0000,
+    0x0000, 0x0000, 0x986B, 0xE0AA, 0xE8AA, 0xE108, 0x90E4, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x90C4, 0xE8AE, 0xC8AE, 0xC8AE, 0xC88A, 0x0000, 0x0000, 0x0000,
+    0xC8AA, 0xC88A, 0x0000, 0xE0AA, 0xE8C8, 0xE8AA, 0x5084, 0x0000,
+    0x0000, 0x0000, 0x0000, 0xC0C6, 0xE106, 0xC165, 0xE965, 0xC165,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x5064, 0xFB65, 0xF285, 0x5084, 0xCA64, 0xF285, 0xC165, 0x90C4,
+    0x98E4, 0xE9C5, 0xC165, 0x0000, 0xD127, 0xE906, 0x90E4, 0x0000,
+    0x0000, 0x0000, 0x5884, 0xE8C8, 0xE0A8, 0xE0AA, 0xC88A, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0xC8AA, 0xE8AC, 0xE0AA, 0xE0AC, 0x5084, 0x0000,
+    0x0000, 0x0000, 0x98E4, 0xE8A8, 0xE0C8, 0x5084, 0x98C4, 0xE8C8,
+    0x90C4, 0x5884, 0x5884, 0xE906, 0xC0C6, 0x1842, 0xC0C6, 0xE965,
+    0x5084, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0xF365, 0xFB65, 0x98E4, 0xCB84, 0x90C4, 0x9AC3,
+    0x5884, 0xCA64, 0xE9C5, 0x0000, 0x1842, 0xE165, 0xE906, 0xE106,
+    0xC0C6, 0xC0C6, 0xC0C6, 0xE0E7, 0xE0C8, 0xE8A8, 0xE8C8, 0x5084,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x90C4, 0xE8AA, 0xE0AC, 0xE0AA, 0xE8AA,
+    0x988B, 0xC0C6, 0xA06B, 0x988B, 0xE0A8, 0xE0C8, 0xC0C6, 0x0000,
+    0xE0E7, 0xE926, 0x5884, 0xC0C6, 0xC0C6, 0xE106, 0x90E4, 0xE9C5,
+    0xE9A6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0xCB84, 0xCB84, 0x0000, 0x90C4, 0x1842,
+    0x5884, 0xF285, 0xE9C5, 0x5884, 0x0000, 0xE9A6, 0xE165, 0xE145,
+    0xE906, 0xE126, 0xE108, 0xE108, 0xE0E7, 0xE0E7, 0xE8C8, 0xC0C6,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xC88A, 0xE0AA, 0xE0AA,
+    0xE0C8, 0xE8AA, 0xE0A8, 0xE0C8, 0xE0A8, 0xE8C8, 0xE0A8, 0xE0E7,
+    0x0000, 0x1842, 0xE108, 0xD927, 0x5084, 0x5884, 0x5884, 0x1842,
+    0xF1C5, 0xC185, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x5084, 0xFC85, 0xCA64, 0xCB84,
+    0x9AA3, 0xF365, 0xF285, 0xCA64, 0x0000, 0xCA64, 0xE9C5, 0x90C4,
+    0x5884, 0x98E4, 0x5084, 0xE165, 0xE906, 0xE106, 0xE8E7, 0xE908,
+    0x1842, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1842, 0xE0AA,
+    0xE0C8, 0xE0AA, 0xE8A8, 0xE8C8, 0x90C4, 0x98E4, 0x90C4, 0x90E4,
+    0xE0E7, 0xC0C6, 0x0000, 0xC165, 0xE965, 0xE9A6, 0x5084, 0xC965,
+    0xE9C5, 0xF285, 0x1842, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCB84, 0xFC85,
+    0xFB65, 0xF365, 0xF265, 0x1842, 0x5884, 0x9AA3, 0xE9C5, 0xC185,
+    0x90C4, 0x98E4, 0xE945, 0xE165, 0xE145, 0xE965, 0xE106, 0xE106,
+    0x5084, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x5884, 0xE8C8, 0xE8C8, 0xE0A8, 0xE0C8, 0xE0E7, 0xE8E7, 0x90C4,
+    0x5084, 0xE906, 0xE926, 0x90E4, 0x90C4, 0x5884, 0xC0C6, 0xE9C5,
+    0xE9C5, 0xF285, 0xC165, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3222,
+    0xFC85, 0xFC65, 0x62A3, 0x6AA3, 0x1842, 0xCB84, 0xF285, 0x5884,
+    0x5084, 0xEA85, 0xE9C5, 0xE9C5, 0xE1A6, 0xE9C5, 0xE965, 0xE165,
+    0xC0C6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0xC0C6, 0xE0E7, 0xE0E7, 0xE906, 0xE0E7, 0xE126,
+    0xE106, 0xE945, 0x98E4, 0x1842, 0xE945, 0xE9C5, 0x5884, 0x5084,
+    0x90C4, 0xF285, 0xF285, 0x1842, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0xCC84, 0xFC65, 0x0000, 0x90C4, 0x9AC3, 0xFB65, 0xF285,
+    0x90C4, 0xF285, 0xEA65, 0xF285, 0xE9C5, 0xE1C5, 0xE1A6, 0xE9C5,
+    0xC165, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0xC0C6, 0xE106, 0xE108, 0xE926,
+    0xE106, 0xE165, 0xE106, 0xE965, 0x5084, 0xC185, 0xE9A6, 0x90E4,
+    0x5884, 0x5884, 0xF285, 0x9AA3, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0xFD85, 0xCB84, 0xCB84, 0xFC85, 0xCB84,
+    0x9AA3, 0xF365, 0xFB65, 0xF365, 0xEA65, 0xF285, 0xEA65, 0xF285,
+    0xE9C5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xC0C6, 0xE165,
+    0xE145, 0xE165, 0xE165, 0xE9C5, 0xE1A6, 0xE9C5, 0xC165, 0xCA64,
+    0xE9C5, 0xF265, 0xEA85, 0xFB65, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x62A3, 0xFD65, 0xF485, 0xFC65,
+    0xF365, 0xFC85, 0xF365, 0xF365, 0xF265, 0xF365, 0xEA85, 0xF265,
+    0xE9C5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x5084, 0xE945, 0xE165, 0xE9C5, 0xE9C5, 0xE9C5, 0xE1A6, 0xEA85,
+    0xE1A6, 0xF285, 0xEA85, 0xF365, 0x5864, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9AA3, 0xF585,
+    0xFC65, 0xFD85, 0xF465, 0xFC85, 0xF365, 0xFC85, 0xF365, 0xFB65,
+    0x9AA3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x5084, 0xE9C5, 0xE9C5, 0xEA65, 0xE9C5, 0xEA85,
+    0xF265, 0xF365, 0xF285, 0xFB65, 0x90E4, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x62A3, 0xFD85, 0xFC65, 0xFC85, 0xF465, 0xFC85, 0xF365, 0xF365,
+    0x5064, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x1842, 0xD264, 0xE9C5, 0xF285,
+    0xF285, 0xF365, 0xF265, 0xF365, 0x5084, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x1842, 0xCC84, 0xCC64, 0xD484, 0xCB84, 0x3222,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3242,
+    0xC165, 0xCB84, 0xF285, 0xD264, 0x1842, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000 } };
+
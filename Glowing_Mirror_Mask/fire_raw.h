@@ -0,0 +1,6153 @@
+// Fire animation by lilu330, licensed from 123RF.com for use in a single
+// not-for-sale project (Glowing Mirror Mask on Adafruit Learning System).
+
+#define IMG_WIDTH  48
+#define IMG_HEIGHT 128
+#define IMG_FRAMES 8
+#define IMG_DELAY  20
+
+const uint16_t frames[IMG_FRAMES][IMG_WIDTH * IMG_HEIGHT] = {
+  { 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x1020,
+    0x69A1, 0x9202, 0x2880, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xAA62,
+    0xDAE2, 0xE2E2, 0xD2A2, 0x2081, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x69A1, 0xE2E2,
+    0xDAE2, 0xDAE2, 0xDAE2, 0x8A02, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0xD2A2, 0xDAE2,
+    0xDAE2, 0xDAE2, 0xE2E2, 0xDAA2, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4121, 0xE2E2, 0xDAE2,
+    0xDAE2, 0xDAE2, 0xE2E2, 0xDAE2, 0x1041, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x61A1, 0xE2E2, 0xDAE2,
+    0xDAE2, 0xDAE2, 0xE2E2, 0xAA82, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x89E2, 0xE2E2, 0xDAE2,
+    0xDAE2, 0xDAE2, 0xD2A2, 0x1881, 0x0020, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xAA82, 0xE2E2, 0xDAE2,
+    0xDAE2, 0xDAA2, 0x2061, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xAA82, 0xDAE2, 0xDAE2,
+    0xDAE2, 0x5141, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x89E2, 0xE323, 0xE323,
+    0xCB22, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7A21, 0xE323, 0xDB23,
+    0x61A1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x61A1, 0xE323, 0xE361,
+    0x28A0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x40E2, 0xDB61, 0xC322,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1041, 0xE361, 0xAA82,
+    0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCB22, 0x8A82,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9282, 0x7A21,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x69C1, 0x7A21,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x28A0, 0x69C1,
+    0x0000, 0x0000, 0x0000, 0x7A21, 0xAA82, 0x2061, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5941,
+    0x0000, 0x0000, 0x18A1, 0xEBC1, 0xE361, 0x7221, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1861,
+    0x0000, 0x0000, 0x4121, 0xE3C1, 0xEBC1, 0xC302, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0000,
+    0x0020, 0x0000, 0x5161, 0xEBC1, 0xE3C1, 0xE361, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0020, 0x0000, 0x0020, 0x0000, 0x0020, 0x0000, 0x0020,
+    0x0000, 0x0000, 0x5141, 0xE3C1, 0xE3C1, 0xDB61, 0x0020, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0000, 0x0020, 0x0000,
+    0x0000, 0x0020, 0x5941, 0xEBC1, 0xE3C1, 0xC302, 0x0000, 0x0020,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0020, 0x0000, 0x0020, 0x0000, 0x0020, 0x0000, 0x0020, 0x0000,
+    0x0000, 0x0000, 0x4121, 0xE3C1, 0xE3C1, 0x9282, 0x0020, 0x0000,
+    0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0020, 0x0000, 0x0020, 0x0800, 0x0820, 0x0000, 0x0820, 0x0000,
+    0x0820, 0x0000, 0x1020, 0xEBC1, 0xE3C1, 0x5141, 0x0000, 0x0020,
+    0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,
+    0x0800, 0x0020, 0x0000, 0x0020, 0x0000, 0x0820, 0x0800, 0x0820,
+    0x0000, 0x0820, 0x0000, 0x4921, 0x69C1, 0x0020, 0x0800, 0x0020,
+    0x0000, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020,
+    0x0000, 0x0820, 0x0800, 0x0820, 0x0000, 0x0820, 0x0800, 0x0020,
+    0x0800, 0x0820, 0x0800, 0x0020, 0x0800, 0x0820, 0x0800, 0x0020,
+    0x0000, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000,
+    0x0020, 0x0800, 0x0020, 0x0800, 0x0820, 0x0800, 0x0020, 0x0800,
+    0x0820, 0x0800, 0x0020, 0x0800, 0x0820, 0x0800, 0x0820, 0x0000,
+    0x0820, 0x0000, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0000,
+    0x0820, 0x0800, 0x0820, 0x0800, 0x0820, 0x0820, 0x0000, 0x0820,
+    0x0820, 0x0820, 0x0820, 0x1020, 0x0820, 0x0800, 0x0820, 0x0800,
+    0x0020, 0x0000, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0000, 0x0020,
+    0x0800, 0x0820, 0x0800, 0x0820, 0x0800, 0x0820, 0x0820, 0x0820,
+    0x1020, 0x1020, 0x1020, 0x0820, 0x0820, 0x0820, 0x0820, 0x0000,
+    0x0820, 0x0800, 0x0820, 0x0000, 0x0020, 0x0000, 0x0020, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0820, 0x0800,
+    0x0820, 0x0000, 0x0820, 0x0820, 0x0820, 0x1020, 0x1020, 0x1020,
+    0x1020, 0x28A0, 0x1020, 0x1020, 0x1020, 0x1020, 0x0820, 0x0800,
+    0x0820, 0x0800, 0x0020, 0x0800, 0x0020, 0x0000, 0x0020, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0800, 0x0820,
+    0x0800, 0x0800, 0x0820, 0x1020, 0x1020, 0x1020, 0x1020, 0x1020,
+    0x1020, 0x7A21, 0x1841, 0x1020, 0x1020, 0x1020, 0x1020, 0x0820,
+    0x0820, 0x0020, 0x0800, 0x0820, 0x0800, 0x0020, 0x0000, 0x0020,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0800, 0x0820, 0x0800,
+    0x0820, 0x0820, 0x1020, 0x1020, 0x1020, 0x1020, 0x1841, 0x1041,
+    0x1841, 0x7A21, 0x69A1, 0x1841, 0x1020, 0x1020, 0x1020, 0x1020,
+    0x0820, 0x0800, 0x0820, 0x0000, 0x0820, 0x0000, 0x0020, 0x0000,
+    0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0020, 0x0000, 0x0820, 0x0000, 0x0820, 0x0800,
+    0x0820, 0x1020, 0x1020, 0x1020, 0x1020, 0x1841, 0x1841, 0x1041,
+    0x1841, 0x7A21, 0xB322, 0x1841, 0x1841, 0x1041, 0x1020, 0x1020,
+    0x1020, 0x0820, 0x0800, 0x0820, 0x0800, 0x0820, 0x0000, 0x0020,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0020, 0x0000, 0x0820, 0x0800, 0x0020, 0x0820,
+    0x0820, 0x1020, 0x1020, 0x1841, 0x1841, 0x1841, 0x1841, 0x1041,
+    0x1841, 0x82A1, 0xEC61, 0x2881, 0x1041, 0x1841, 0x1841, 0x1020,
+    0x1020, 0x1020, 0x0820, 0x0800, 0x0820, 0x0000, 0x0020, 0x0000,
+    0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0020, 0x0000, 0x0020, 0x0000, 0x0020, 0x0800, 0x0800, 0x0820,
+    0x1020, 0x1020, 0x1841, 0x1841, 0x1041, 0x2061, 0x2061, 0x1861,
+    0x1861, 0x9282, 0xEC81, 0x69A1, 0x2061, 0x1041, 0x1841, 0x1841,
+    0x1020, 0x1020, 0x0820, 0x0820, 0x0820, 0x0800, 0x0820, 0x0000,
+    0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0020, 0x0800, 0x0820, 0x0800, 0x0020, 0x0820, 0x1020,
+    0x1020, 0x1841, 0x1841, 0x1841, 0x1861, 0x2061, 0x2061, 0x1861,
+    0x2081, 0xA2E1, 0xECA1, 0x9AE1, 0x1841, 0x1861, 0x1841, 0x1841,
+    0x1841, 0x1020, 0x1020, 0x0820, 0x0800, 0x0820, 0x0000, 0x0020,
+    0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,
+    0x0000, 0x0020, 0x0800, 0x0020, 0x0800, 0x0820, 0x1020, 0x1020,
+    0x1841, 0x1841, 0x1041, 0x2061, 0x2061, 0x1861, 0x2061, 0x2081,
+    0x2061, 0xAB61, 0xECA1, 0xE441, 0x2081, 0x1861, 0x2061, 0x1841,
+    0x1841, 0x1041, 0x1020, 0x1020, 0x0820, 0x0800, 0x0820, 0x0800,
+    0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0020, 0x0000, 0x0820, 0x0800, 0x0020, 0x0820, 0x1020, 0x1020,
+    0x1841, 0x1841, 0x2061, 0x1861, 0x2081, 0x6A01, 0x38E2, 0x28A1,
+    0x2881, 0xCBA2, 0xF4C1, 0xF4C1, 0x5141, 0x2081, 0x1861, 0x1861,
+    0x1841, 0x1841, 0x1041, 0x1020, 0x0820, 0x0800, 0x0800, 0x0820,
+    0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0020, 0x0800, 0x0020, 0x0800, 0x0820, 0x1020, 0x1020, 0x1841,
+    0x1841, 0x1861, 0x2061, 0x2061, 0x61A1, 0xF4E1, 0x9AE1, 0x2881,
+    0x2081, 0xDC41, 0xF4C1, 0xF4C1, 0x9AE1, 0x2881, 0x2081, 0x1861,
+    0x2061, 0x1841, 0x1841, 0x1020, 0x0820, 0x0820, 0x0800, 0x0020,
+    0x0800, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000,
+    0x0020, 0x0000, 0x0820, 0x0800, 0x0820, 0x1020, 0x1020, 0x1841,
+    0x2061, 0x1861, 0x2081, 0x2881, 0xBC02, 0xF4C1, 0xDC21, 0x28A1,
+    0x30C1, 0xF4E1, 0xF4C1, 0xECC1, 0xCC01, 0x2081, 0x2061, 0x2081,
+    0x2061, 0x1861, 0x1841, 0x1020, 0x1020, 0x0820, 0x0800, 0x0800,
+    0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,
+    0x0000, 0x0020, 0x0800, 0x0820, 0x1020, 0x1020, 0x1841, 0x1841,
+    0x1861, 0x2061, 0x2061, 0x4121, 0xECC1, 0xF4C1, 0xF502, 0x4962,
+    0x4962, 0xF502, 0xF4C1, 0xF522, 0xECA1, 0x30A1, 0x2881, 0x2081,
+    0x2881, 0x1861, 0x1841, 0x1841, 0x1020, 0x1020, 0x0820, 0x0800,
+    0x0820, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000,
+    0x0820, 0x0000, 0x0820, 0x0820, 0x1020, 0x1020, 0x1841, 0x2061,
+    0x1861, 0x2881, 0x2881, 0x9AE1, 0xF522, 0xF502, 0xF502, 0x7242,
+    0x8281, 0xF502, 0xF502, 0xF502, 0xF521, 0x3102, 0x28A1, 0x28A1,
+    0x2061, 0x2061, 0x1861, 0x1841, 0x1020, 0x1020, 0x0820, 0x0800,
+    0x0020, 0x0800, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,
+    0x0000, 0x0820, 0x0800, 0x0820, 0x1020, 0x1841, 0x1841, 0x1861,
+    0x2061, 0x28A1, 0x28A1, 0xD4A3, 0xF521, 0xF501, 0xF521, 0xBBE2,
+    0xC401, 0xF521, 0xF521, 0xF521, 0xF521, 0x5162, 0x30C1, 0x30A1,
+    0x2881, 0x2081, 0x2061, 0x1041, 0x1841, 0x1020, 0x0820, 0x0820,
+    0x0800, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0800,
+    0x0820, 0x0800, 0x0020, 0x0820, 0x1020, 0x1841, 0x2061, 0x1861,
+    0x2881, 0x2881, 0x7A42, 0xF521, 0xF521, 0xF542, 0xF542, 0xF542,
+    0xED42, 0xF542, 0xF542, 0xF542, 0xED21, 0x6201, 0x30C2, 0x30C1,
+    0x28A1, 0x2061, 0x2081, 0x2061, 0x1041, 0x1020, 0x1020, 0x0820,
+    0x0800, 0x0800, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000,
+    0x0020, 0x0800, 0x0820, 0x1020, 0x1841, 0x1841, 0x1861, 0x2061,
+    0x28A1, 0x30C2, 0xD4C3, 0xF542, 0xF542, 0xF542, 0xED42, 0xF542,
+    0xF542, 0xF542, 0xF542, 0xF542, 0xF542, 0x7A62, 0x38E2, 0x30C1,
+    0x28A1, 0x2881, 0x2881, 0x1861, 0x1841, 0x1020, 0x1020, 0x0820,
+    0x0820, 0x0800, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0820,
+    0x0800, 0x0820, 0x0820, 0x1020, 0x1841, 0x1861, 0x2061, 0x2081,
+    0x2881, 0xB381, 0xF542, 0xF542, 0xF542, 0xF542, 0xF582, 0xF582,
+    0xF562, 0xED82, 0xF562, 0xF582, 0xED42, 0x7A81, 0x3902, 0x30E2,
+    0x30C1, 0x2881, 0x2081, 0x2061, 0x2061, 0x1041, 0x1020, 0x0820,
+    0x0800, 0x0800, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020,
+    0x0800, 0x0820, 0x1020, 0x1020, 0x1841, 0x1861, 0x2061, 0x2881,
+    0x6201, 0xED42, 0xF542, 0xF582, 0xED62, 0xF582, 0xF562, 0xF582,
+    0xF5A2, 0xF5A2, 0xF562, 0xF582, 0xFD82, 0x8323, 0x3922, 0x38E2,
+    0x30C1, 0x28A1, 0x2881, 0x2881, 0x1861, 0x1841, 0x1020, 0x1020,
+    0x0820, 0x0820, 0x0800, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0800,
+    0x0820, 0x0820, 0x1020, 0x1841, 0x1841, 0x2061, 0x2081, 0x28A1,
+    0xDCE1, 0xF542, 0xF582, 0xF582, 0xF562, 0xF5A2, 0xF5A2, 0xF5A2,
+    0xF5A2, 0xF5A2, 0xF5A2, 0xF5A2, 0xF5A2, 0x9323, 0x4122, 0x3902,
+    0x30E2, 0x30C1, 0x28A1, 0x2061, 0x2061, 0x1041, 0x1841, 0x1020,
+    0x0820, 0x0800, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0820,
+    0x0800, 0x0820, 0x1020, 0x1041, 0x2061, 0x1861, 0x2081, 0x6201,
+    0xF542, 0xF562, 0xF582, 0xF582, 0xF5A2, 0xF5A2, 0xF5C3, 0xF5C3,
+    0xF5C3, 0xF5C3, 0xF5C3, 0xF5C3, 0xF5A2, 0x9B23, 0x4942, 0x3922,
+    0x38E2, 0x30C1, 0x28A1, 0x2881, 0x1861, 0x1841, 0x1841, 0x1020,
+    0x0820, 0x0800, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0800,
+    0x0820, 0x0820, 0x1020, 0x1841, 0x2061, 0x2081, 0x2881, 0x9B81,
+    0xF582, 0xF582, 0xF5A2, 0xF5A2, 0xF604, 0xFDE4, 0xF5E3, 0xF5E3,
+    0xF5E3, 0xF5E3, 0xF5E3, 0xF5E3, 0xF5C3, 0x9323, 0x4962, 0x4122,
+    0x3902, 0x38E2, 0x28A1, 0x28A1, 0x2081, 0x2061, 0x1841, 0x1020,
+    0x0820, 0x0800, 0x0800, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0800,
+    0x0820, 0x0820, 0x1020, 0x1841, 0x1861, 0x2061, 0x2881, 0xB3E2,
+    0xF582, 0xF5A2, 0xF5A2, 0xF5C3, 0xF6A7, 0xFEE8, 0xFDE4, 0xF603,
+    0xF603, 0xF603, 0xF603, 0xF5E3, 0xF5E3, 0x9B81, 0x5162, 0x4122,
+    0x4142, 0x38E2, 0x30C1, 0x2881, 0x2881, 0x1861, 0x1841, 0x1020,
+    0x1020, 0x0820, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0800, 0x0820,
+    0x0820, 0x1020, 0x1020, 0x1841, 0x2061, 0x2081, 0x28A1, 0xCCA1,
+    0xFDA2, 0xF5A2, 0xF5C2, 0xF604, 0xFF08, 0xFF29, 0xF685, 0xF623,
+    0xF603, 0xFE23, 0xF603, 0xF603, 0xF5E3, 0xAC43, 0x51A2, 0x4962,
+    0x4122, 0x3902, 0x30C1, 0x30C1, 0x2081, 0x2061, 0x1041, 0x1020,
+    0x1020, 0x0820, 0x0800, 0x0800, 0x0020, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0800,
+    0x0820, 0x1020, 0x1841, 0x1841, 0x1861, 0x2881, 0x28A1, 0xDD02,
+    0xF5A2, 0xF5C2, 0xF5E2, 0xF6A7, 0xF708, 0xFF09, 0xFEA7, 0xF643,
+    0xF643, 0xF643, 0xFE03, 0xF623, 0xF603, 0xE5C2, 0x59A2, 0x4962,
+    0x4942, 0x3922, 0x38E2, 0x28A1, 0x2081, 0x2061, 0x1841, 0x1841,
+    0x1020, 0x0820, 0x0800, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0800, 0x0820,
+    0x0820, 0x1020, 0x1841, 0x1041, 0x2881, 0x2881, 0x30C1, 0xF582,
+    0xF5C2, 0xF5C2, 0xFE66, 0xFF08, 0xFF09, 0xF729, 0xF6A7, 0xF664,
+    0xFE44, 0xF664, 0xF643, 0xF644, 0xFE23, 0xF5E3, 0xAC43, 0x51A2,
+    0x4122, 0x3902, 0x38E2, 0x28C1, 0x28A1, 0x2061, 0x2061, 0x1041,
+    0x1020, 0x0820, 0x0800, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0800,
+    0x0820, 0x1020, 0x1841, 0x1861, 0x82A1, 0x4122, 0x3102, 0xF5C2,
+    0xF5E2, 0xF5E2, 0xFEE8, 0xF729, 0xFF09, 0xFF29, 0xFEE8, 0xF644,
+    0xF664, 0xF685, 0xFF08, 0xFF09, 0xF685, 0xF623, 0xFE03, 0x9BC3,
+    0x5162, 0x4142, 0x38E2, 0x30C1, 0x2881, 0x2081, 0x2061, 0x1841,
+    0x1020, 0x0820, 0x0820, 0x0800, 0x0020, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0820, 0x0800,
+    0x0820, 0x1020, 0x1841, 0x4981, 0xF5C2, 0xCCA1, 0x4121, 0xF5C2,
+    0xF5E2, 0xF602, 0xFF08, 0xFF09, 0xFF29, 0xFF09, 0xFF69, 0xF6A7,
+    0xF707, 0xFF69, 0xFF49, 0xFF69, 0xF6E8, 0xF643, 0xF623, 0xF603,
+    0x72A3, 0x4122, 0x3902, 0x30C1, 0x28A1, 0x2061, 0x2061, 0x1041,
+    0x1020, 0x0820, 0x0800, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0820, 0x0800,
+    0x0820, 0x1020, 0x1021, 0x4121, 0xD4E1, 0x9B81, 0x4161, 0xF5E2,
+    0xF602, 0xF602, 0xF6A7, 0xFF09, 0xF729, 0xFF49, 0xFF69, 0xFF49,
+    0xF769, 0xFF49, 0xFF69, 0xFF49, 0xFF69, 0xF684, 0xF643, 0xFE23,
+    0xE5A2, 0x59C2, 0x3902, 0x38E2, 0x28A1, 0x2081, 0x2061, 0x1041,
+    0x1020, 0x0820, 0x0800, 0x0820, 0x0800, 0x0020, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0800, 0x0820,
+    0x1020, 0x1020, 0x1841, 0x2061, 0x2081, 0x28A1, 0x5162, 0xFE02,
+    0xF602, 0xF602, 0xF685, 0xFF29, 0xFF49, 0xFF69, 0xFF49, 0xF769,
+    0xFF49, 0xFEE5, 0xF707, 0xFF69, 0xFF49, 0xF6A7, 0xF643, 0xF623,
+    0xF623, 0x9BA3, 0x3902, 0x30E2, 0x30A1, 0x2081, 0x2061, 0x1041,
+    0x1020, 0x0820, 0x0800, 0x0800, 0x0020, 0x0000, 0x0020, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0800, 0x0800,
+    0x1020, 0x1020, 0x1041, 0x2061, 0x28A1, 0x28A1, 0x4161, 0xF602,
+    0xF602, 0xF623, 0xF643, 0xF6E8, 0xFF69, 0xFF49, 0xFF69, 0xFF49,
+    0xF705, 0xF6C5, 0xFEE5, 0xFF69, 0xF749, 0xFF07, 0xFE64, 0xF643,
+    0xFE23, 0xE5C2, 0x4142, 0x38E2, 0x28A1, 0x2881, 0x1861, 0x1841,
+    0x1020, 0x1020, 0x0800, 0x0820, 0x0800, 0x0020, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0800, 0x0820, 0x0800,
+    0x1020, 0x1020, 0x1041, 0x2061, 0x28A1, 0x30C1, 0x3902, 0xFE22,
+    0xF623, 0xFE23, 0xF643, 0xF685, 0xFF49, 0xFF69, 0xFF49, 0xFF48,
+    0xF705, 0xF705, 0xFEE5, 0xFF49, 0xFF69, 0xF6E8, 0xF664, 0xF643,
+    0xF623, 0xFE03, 0x6201, 0x30C2, 0x28A1, 0x2081, 0x2061, 0x1041,
+    0x1020, 0x1020, 0x0800, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0800, 0x0800,
+    0x0820, 0x1020, 0x1841, 0x1861, 0x28A1, 0x30C1, 0x30C2, 0xE5A2,
+    0xF622, 0xF643, 0xF644, 0xF664, 0xF727, 0xFF49, 0xFF69, 0xFF47,
+    0xF705, 0xFF05, 0xF705, 0xFF49, 0xFF69, 0xF6E8, 0xFE83, 0xF664,
+    0xF643, 0xFE42, 0x7282, 0x38E2, 0x28A1, 0x2881, 0x1861, 0x1841,
+    0x1020, 0x1020, 0x0820, 0x0800, 0x0820, 0x0000, 0x0020, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0800, 0x0820, 0x0820,
+    0x1020, 0x1841, 0x1841, 0x1861, 0x28A1, 0x30C1, 0x38E2, 0xB443,
+    0xFE43, 0xF643, 0xF664, 0xFE84, 0xF6A4, 0xFF47, 0xFF89, 0xFF47,
+    0xF745, 0xFF45, 0xF705, 0xFF49, 0xFF49, 0xFF27, 0xF684, 0xF664,
+    0xF643, 0xF643, 0x6203, 0x30C2, 0x30C1, 0x2081, 0x2061, 0x1041,
+    0x1020, 0x1020, 0x0800, 0x0800, 0x0020, 0x0000, 0x0020, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0800, 0x0820,
+    0x1020, 0x1841, 0x1841, 0x1861, 0x2881, 0x30C1, 0x30E2, 0x6203,
+    0xF622, 0xF643, 0xF664, 0xF684, 0xFEA4, 0xF6C4, 0xFF48, 0xF748,
+    0xFF25, 0xFF45, 0xF726, 0xFF49, 0xFF48, 0xF6A4, 0xFE84, 0xF664,
+    0xFE43, 0xE622, 0x4122, 0x38E2, 0x30C1, 0x28A1, 0x2061, 0x1041,
+    0x1841, 0x1020, 0x1020, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0800, 0x0820, 0x0820,
+    0x1020, 0x1841, 0x1841, 0x2061, 0x28A1, 0x30C1, 0x30E2, 0x4922,
+    0xC4C2, 0xF663, 0xF683, 0xF684, 0xFEA4, 0xF6E5, 0xFF05, 0xFF47,
+    0xF745, 0xFF25, 0xFF47, 0xFF48, 0xF6E5, 0xF6A4, 0xF684, 0xFE63,
+    0xF664, 0xAC23, 0x4122, 0x30E2, 0x30C1, 0x2061, 0x2061, 0x1041,
+    0x1841, 0x1020, 0x0820, 0x0800, 0x0020, 0x0000, 0x0020, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0800, 0x0800, 0x0820,
+    0x1020, 0x1841, 0x1041, 0x2061, 0x28A1, 0x30C1, 0x30C2, 0x4122,
+    0x6201, 0xEE43, 0xF663, 0xF684, 0xFEC4, 0xF6E5, 0xFF05, 0xF725,
+    0xFF45, 0xFF25, 0xFF45, 0xF705, 0xFEE5, 0xF6C4, 0xFE84, 0xF683,
+    0xF643, 0x59A2, 0x4142, 0x38E2, 0x30C1, 0x28A1, 0x2061, 0x1041,
+    0x1020, 0x1020, 0x0800, 0x0820, 0x0800, 0x0020, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0800, 0x0820, 0x0820,
+    0x0820, 0x1841, 0x1041, 0x2061, 0x28A1, 0x30C1, 0x38E2, 0x4122,
+    0x5162, 0x8323, 0xF683, 0xFEA4, 0xF6C4, 0xFEE5, 0xF705, 0xFF45,
+    0xFF25, 0xFF45, 0xF725, 0xFF05, 0xF6E5, 0xF6A4, 0xFEA4, 0xEE63,
+    0x8303, 0x4962, 0x3902, 0x30E2, 0x30A1, 0x28A1, 0x1861, 0x1841,
+    0x1020, 0x1020, 0x0800, 0x0800, 0x0020, 0x0000, 0x0020, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0800, 0x0820,
+    0x1020, 0x1841, 0x1841, 0x1861, 0x28A1, 0x30C1, 0x38E2, 0x4122,
+    0x4962, 0x51A2, 0xAC23, 0xFEA4, 0xF6C4, 0xFEE5, 0xF705, 0xFF25,
+    0xF745, 0xFF25, 0xFF05, 0xF705, 0xFEE5, 0xFEC4, 0xFEC4, 0x9BC3,
+    0x51C2, 0x5162, 0x3922, 0x38E2, 0x30A1, 0x2081, 0x2061, 0x1041,
+    0x1020, 0x1020, 0x0800, 0x0820, 0x0800, 0x0020, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x0800, 0x0820,
+    0x1020, 0x1020, 0x1041, 0x2061, 0x28A1, 0x30C1, 0x4981, 0x4122,
+    0x5162, 0x51C2, 0x7282, 0xFEC3, 0xFEE4, 0xFF04, 0xF705, 0xFF06,
+    0xF726, 0xFF25, 0xF705, 0xFF04, 0xF6C5, 0xFEC4, 0xCD43, 0x6223,
+    0x51A2, 0x4962, 0x3902, 0x38E2, 0x28A1, 0x2081, 0x2061, 0x1041,
+    0x1020, 0x1020, 0x0800, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0800,
+    0x1020, 0x1020, 0x1841, 0x2061, 0x2081, 0x30C2, 0xE622, 0x4122,
+    0x4962, 0x51A2, 0x72A3, 0xFEC3, 0xF6C4, 0xFF04, 0xF705, 0xFF05,
+    0xF74C, 0xFF06, 0xF705, 0xFF04, 0xFEE5, 0xFEE4, 0x9BC3, 0x6223,
+    0x59C2, 0x5162, 0x3902, 0x38E2, 0x28A1, 0x2081, 0x2061, 0x1841,
+    0x1020, 0x0820, 0x0820, 0x0800, 0x0820, 0x0000, 0x0020, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0820, 0x0800,
+    0x1020, 0x1020, 0x1841, 0x2061, 0x2081, 0x6221, 0xFE82, 0x6201,
+    0x4962, 0x6223, 0xE5C2, 0xFEC3, 0xFF04, 0xFF04, 0xF705, 0xF705,
+    0xFFB0, 0xFF4A, 0xF705, 0xFF04, 0xFEE4, 0xF6C4, 0x8303, 0x6223,
+    0x51A2, 0x4122, 0x3902, 0x30E2, 0x30C1, 0x2081, 0x2061, 0x1041,
+    0x1020, 0x0820, 0x0800, 0x0800, 0x0020, 0x0000, 0x0020, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0820, 0x0800,
+    0x0820, 0x1020, 0x1041, 0x1861, 0x2061, 0x8B21, 0xF682, 0x8B83,
+    0x72A3, 0xF663, 0xFEC3, 0xF6C4, 0xF704, 0xFF04, 0xFF05, 0xF705,
+    0xF74C, 0xFF94, 0xFF48, 0xFF05, 0xFF04, 0xFEE4, 0x8B83, 0x51A2,
+    0x59C2, 0x4942, 0x3902, 0x30C1, 0x2881, 0x2081, 0x2061, 0x1041,
+    0x1020, 0x0820, 0x0820, 0x0800, 0x0820, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0800, 0x0820,
+    0x0820, 0x1020, 0x1841, 0x2061, 0x2081, 0xC4C2, 0xF682, 0xCD63,
+    0xE602, 0xF6C3, 0xFEC3, 0xF6C4, 0xFEC4, 0xFF04, 0xF705, 0xF705,
+    0xFF4C, 0xFF94, 0xFF53, 0xF705, 0xFEE4, 0xF6C4, 0xB503, 0x51A2,
+    0x4983, 0x4122, 0x3902, 0x30C1, 0x28A1, 0x2081, 0x2061, 0x1041,
+    0x1020, 0x0820, 0x0800, 0x0800, 0x0020, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0800,
+    0x0820, 0x1020, 0x1841, 0x1861, 0x2061, 0xDE02, 0xF6A2, 0xFEA2,
+    0xF6C3, 0xFEC3, 0xF6C4, 0xF704, 0xFF04, 0xFF05, 0xF705, 0xF705,
+    0xFF4C, 0xFF94, 0xFF94, 0xF74C, 0xFF04, 0xFF04, 0xFEE4, 0x7AC3,
+    0x4983, 0x4142, 0x3902, 0x30C1, 0x28A1, 0x2081, 0x2061, 0x1841,
+    0x1020, 0x0820, 0x0800, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0820, 0x0800,
+    0x0820, 0x1020, 0x1041, 0x2061, 0x4142, 0xFEC2, 0xFEC2, 0xFEC3,
+    0xF6C3, 0xFEC4, 0xF704, 0xFF04, 0xF705, 0xFF05, 0xF705, 0xFF06,
+    0xFF4C, 0xFF94, 0xF7B4, 0xFF94, 0xF726, 0xFF04, 0xF6E4, 0xD603,
+    0x51A2, 0x4122, 0x3902, 0x30C1, 0x2881, 0x2081, 0x2061, 0x1041,
+    0x1020, 0x0820, 0x0800, 0x0800, 0x0020, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0820, 0x0800,
+    0x0820, 0x1020, 0x1041, 0x1841, 0x6A82, 0xF6A2, 0xFEA2, 0xF6C3,
+    0xF6C3, 0xFF04, 0xFEE4, 0xF705, 0xFF05, 0xF705, 0xF726, 0xFF06,
+    0xF74E, 0xFFB4, 0xFF94, 0xFF94, 0xF74E, 0xFEE4, 0xF704, 0xFF04,
+    0xD563, 0x59C2, 0x3902, 0x38E2, 0x28A1, 0x2081, 0x2061, 0x1020,
+    0x1020, 0x0820, 0x0800, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0820,
+    0x1020, 0x1020, 0x1841, 0x2081, 0xAC63, 0xFEC2, 0xFEC3, 0xF6C3,
+    0xFF04, 0xFF04, 0xF6E4, 0xF705, 0xFF26, 0xFF06, 0xF726, 0xFF06,
+    0xFFB0, 0xF794, 0xFFB4, 0xFF94, 0xFFB4, 0xF726, 0xF6E4, 0xFF04,
+    0xF6E4, 0xD603, 0x51A2, 0x30C2, 0x2881, 0x2081, 0x2061, 0x1041,
+    0x1020, 0x0820, 0x0800, 0x0800, 0x0020, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0800,
+    0x1020, 0x1841, 0x1861, 0x1861, 0xDE02, 0xFEC3, 0xF704, 0xFEE4,
+    0xF704, 0xFEE4, 0xF705, 0xFF26, 0xF706, 0xFF26, 0xF726, 0xFF47,
+    0xF794, 0xFFB4, 0xFF94, 0xFFB4, 0xFF94, 0xFF4A, 0xF705, 0xF704,
+    0xFF04, 0xFF04, 0xE622, 0x59C1, 0x30A1, 0x18A1, 0x2061, 0x1841,
+    0x1020, 0x0820, 0x0800, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0820, 0x0820,
+    0x1020, 0x1080, 0x2081, 0x4981, 0xFEE3, 0xFF23, 0xFF04, 0xF6E4,
+    0xFF04, 0xF705, 0xFF06, 0xF726, 0xFF46, 0xFF46, 0xF747, 0xFFAF,
+    0xFF95, 0xFF95, 0xFFB5, 0xF795, 0xFFB5, 0xFF8D, 0xF705, 0xF705,
+    0xFF04, 0xFEE4, 0xF703, 0xDE02, 0x28C1, 0x1881, 0x1861, 0x1841,
+    0x1020, 0x0820, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0800, 0x0820,
+    0x1020, 0x0860, 0x1881, 0x8303, 0xFF23, 0xF703, 0xF6E4, 0xFF04,
+    0xF705, 0xFF06, 0xF726, 0xFF46, 0xFF47, 0xF76A, 0xFFB0, 0xFF95,
+    0xFFB5, 0xF795, 0xFFB5, 0xFF95, 0xFF95, 0xFFB0, 0xF726, 0xFF25,
+    0xF704, 0xFF04, 0xFF23, 0xFF23, 0x8323, 0x2081, 0x2061, 0x1841,
+    0x1020, 0x0820, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0820, 0x0820,
+    0x1841, 0x18A0, 0x1881, 0xBD23, 0xFF23, 0xFF23, 0xFF03, 0xFF45,
+    0xF745, 0xFF46, 0xFF4A, 0xFFB0, 0xFF95, 0xF7B5, 0xFF95, 0xFFB5,
+    0xFF95, 0xF7B5, 0xFF95, 0xFFB5, 0xFF95, 0xF7B0, 0xFF46, 0xF726,
+    0xFF45, 0xFF44, 0xF703, 0xF703, 0xCD63, 0x18A1, 0x2081, 0x1041,
+    0x1020, 0x0820, 0x0800, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x0020, 0x0840,
+    0x1080, 0x1080, 0x18C1, 0xE683, 0xF723, 0xF703, 0xF725, 0xFF45,
+    0xFF47, 0xF7B0, 0xFF95, 0xFFD5, 0xFF96, 0xFFB6, 0xFF96, 0xFFB6,
+    0xFF96, 0xFFB6, 0xFFB5, 0xFFB6, 0xFF95, 0xFFB0, 0xFF46, 0xF746,
+    0xFF45, 0xFF44, 0xF744, 0xFF23, 0xF703, 0x28E1, 0x2081, 0x1841,
+    0x1020, 0x0820, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0840, 0x0840,
+    0x1080, 0x2081, 0x3982, 0xFF23, 0xFF23, 0xFF44, 0xFF45, 0xFF46,
+    0xFFB0, 0xFFB5, 0xFFD5, 0xFFB5, 0xFFD6, 0xFFB6, 0xFFD6, 0xFFB6,
+    0xFFD6, 0xFFB6, 0xFFD6, 0xFFB6, 0xFFD5, 0xFFB0, 0xF747, 0xFF46,
+    0xFF46, 0xF725, 0xFF44, 0xF703, 0xFF23, 0x39C2, 0x1881, 0x1080,
+    0x0840, 0x0820, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x0020, 0x0820, 0x1080,
+    0x1080, 0x20C1, 0x6303, 0xF703, 0xF744, 0xFF44, 0xF745, 0xFFB0,
+    0xFFB4, 0xFFD5, 0xFF96, 0xFFD6, 0xFFB6, 0xFFD7, 0xFFB7, 0xFFD7,
+    0xFFB7, 0xFFD7, 0xFFB7, 0xFFD6, 0xFFD6, 0xFFB0, 0xFF48, 0xF747,
+    0xFF46, 0xFF45, 0xF744, 0xFF44, 0xFF23, 0x62A3, 0x20A1, 0x18A0,
+    0x0840, 0x0840, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0820, 0x0860, 0x1080,
+    0x18A0, 0x20C1, 0x9C43, 0xFF44, 0xFF44, 0xFF45, 0xF74A, 0xFFD5,
+    0xFFD5, 0xFFB6, 0xFFD6, 0xFFB7, 0xFFD7, 0xFFD7, 0xFFD7, 0xFFD8,
+    0xFFD8, 0xFFD8, 0xFFB7, 0xFFD7, 0xFFB6, 0xFFB0, 0xFF89, 0xF748,
+    0xFF47, 0xFF46, 0xF745, 0xFF44, 0xF744, 0x7364, 0x18A1, 0x18A0,
+    0x1060, 0x0040, 0x0020, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0840, 0x0840, 0x1060,
+    0x18A0, 0x18A1, 0xBDA5, 0xFF44, 0xF744, 0xFF65, 0xFFB0, 0xFFD5,
+    0xFFB5, 0xFFD6, 0xFFD7, 0xF7D7, 0xFFD8, 0xFFD8, 0xFFD8, 0xFFF8,
+    0xFFD8, 0xFFD8, 0xFFD8, 0xFFD7, 0xFFD7, 0xFFAF, 0xFF89, 0xFF88,
+    0xF788, 0xFF86, 0xFF65, 0xFF44, 0xFF44, 0x9C43, 0x20C1, 0x18A0,
+    0x1080, 0x0840, 0x0820, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0840, 0x0840, 0x1080,
+    0x18A0, 0x20C1, 0xEEA3, 0xFF44, 0xFF45, 0xF766, 0xFFD4, 0xFFD5,
+    0xFFB6, 0xFFD6, 0xF7D7, 0xFFD8, 0xFFD8, 0xFFD8, 0xFFD9, 0xFFD9,
+    0xFFF9, 0xFFD9, 0xFFD8, 0xFFD8, 0xFFD7, 0xFF8D, 0xFFAA, 0xF789,
+    0xFF88, 0xFF66, 0xF765, 0xFF65, 0xFF44, 0x9CC4, 0x18A1, 0x18A0,
+    0x1060, 0x0840, 0x0840, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0020, 0x0820, 0x0040, 0x1060, 0x1060,
+    0x18C1, 0x2922, 0xFF44, 0xF744, 0xFF65, 0xF78B, 0xFFB5, 0xFFD6,
+    0xFFB6, 0xFFD7, 0xFFD8, 0xFFD8, 0xFFF9, 0xFFDA, 0xFFFA, 0xFFDA,
+    0xFFFA, 0xFFDA, 0xFFB6, 0xFFD4, 0xFFB0, 0xFF8D, 0xF78C, 0xFFAA,
+    0xFF89, 0xFF88, 0xFF66, 0xFF85, 0xFF44, 0xC5C5, 0x20C1, 0x2081,
+    0x1080, 0x0840, 0x0840, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0020, 0x0820, 0x0020, 0x0840, 0x1080, 0x18A0,
+    0x20C1, 0x41E2, 0xFF64, 0xFF65, 0xFF86, 0xFF8D, 0xFFD5, 0xFFB6,
+    0xFFD7, 0xFFD7, 0xFFD8, 0xFFD9, 0xFFFA, 0xFFDB, 0xFFFB, 0xFFDB,
+    0xFFFB, 0xFFDB, 0xFFD6, 0xFFB2, 0xFFB0, 0xFFAF, 0xF78C, 0xFFAB,
+    0xFF89, 0xF788, 0xFF66, 0xFF86, 0xFF65, 0xD603, 0x20E1, 0x1080,
+    0x0880, 0x0840, 0x0840, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0020, 0x0820, 0x0840, 0x1080, 0x1080,
+    0x20C1, 0x4A62, 0xF765, 0xFF65, 0xFF66, 0xF7B0, 0xFFB6, 0xFFD6,
+    0xFFD7, 0xFFD8, 0xFFD9, 0xFFFA, 0xFFDB, 0xFFDC, 0xFFFC, 0xFFFD,
+    0xFFFD, 0xFFFC, 0xFFD7, 0xFFB2, 0xFFB0, 0xFFAF, 0xF78D, 0xFFAB,
+    0xFF8A, 0xFF89, 0xF787, 0xFF86, 0xFF65, 0xEEC5, 0x2901, 0x18A0,
+    0x1080, 0x0840, 0x0840, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0020, 0x0820, 0x0840, 0x0840, 0x1080, 0x18A0,
+    0x20C1, 0x62A3, 0xFF85, 0xFF66, 0xFF87, 0xFFB0, 0xFFD6, 0xFFD7,
+    0xFFD7, 0xFFD8, 0xFFD9, 0xFFFA, 0xFFDB, 0xFFFC, 0xFFFD, 0xFFFE,
+    0xFFFE, 0xFFFD, 0xFFD9, 0xF7D4, 0xFFB2, 0xFFB0, 0xFFCD, 0xF78C,
+    0xFF8A, 0xFF89, 0xF788, 0xFF86, 0xFF65, 0xF745, 0x20E1, 0x1080,
+    0x0880, 0x0840, 0x0840, 0x0020, 0x0820, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0020, 0x0840, 0x0840, 0x1060, 0x18A0,
+    0x18C1, 0x6303, 0xFF65, 0xFF66, 0xF787, 0xFFB0, 0xFFB6, 0xFFD7,
+    0xFFD7, 0xFFF8, 0xFFD9, 0xFFDA, 0xFFFC, 0xFFFD, 0xFFFE, 0xFFFE,
+    0xFFFE, 0xFFFD, 0xFFDB, 0xFFD5, 0xF7D2, 0xFFB0, 0xFFAF, 0xFF8C,
+    0xFF8B, 0xFF89, 0xFF88, 0xFF86, 0xFF66, 0xFF85, 0x3962, 0x20C1,
+    0x1080, 0x0840, 0x0840, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0020, 0x0020, 0x0840, 0x0840, 0x1080, 0x18A0,
+    0x20C1, 0x6B23, 0xFF86, 0xFF66, 0xFF88, 0xFFB0, 0xFFD6, 0xFFD7,
+    0xFFD7, 0xFFD8, 0xFFD9, 0xFFFB, 0xFFFC, 0xFFFD, 0xFFFE, 0xFFFE,
+    0xFFFE, 0xFFFD, 0xFFDC, 0xFFD5, 0xFFB2, 0xFFB0, 0xFFAF, 0xF78C,
+    0xFF8B, 0xFF89, 0xF788, 0xFF87, 0xFF86, 0xFF65, 0x39C2, 0x18C1,
+    0x1060, 0x0840, 0x0840, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0020, 0x0840, 0x0840, 0x1060, 0x18A0,
+    0x18A1, 0x5AA3, 0xFF66, 0xF787, 0xFF88, 0xFFAF, 0xFFD6, 0xFFD7,
+    0xF7D7, 0xFFD8, 0xFFF9, 0xFFDA, 0xFFDB, 0xFFFD, 0xFFFE, 0xFFFE,
+    0xFFFE, 0xFFFD, 0xFFFC, 0xFFD7, 0xFFB2, 0xFFB0, 0xFFAF, 0xFF8C,
+    0xFFAB, 0xFF8A, 0xFF88, 0xFF87, 0xFF86, 0xFF86, 0x5262, 0x18A0,
+    0x1080, 0x0840, 0x0840, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0020, 0x0020, 0x0840, 0x0840, 0x1080, 0x18A0,
+    0x20C1, 0x5262, 0xFF86, 0xFF87, 0xFF88, 0xFFAF, 0xFFD6, 0xFFD7,
+    0xFFD7, 0xFFD8, 0xFFD9, 0xFFFA, 0xFFDB, 0xFFFC, 0xFFFD, 0xFFFD,
+    0xFFFD, 0xFFFC, 0xFFDB, 0xFFD9, 0xFFD2, 0xFFB0, 0xFFAF, 0xFF8C,
+    0xFF8B, 0xF7AA, 0xFF88, 0xFF87, 0xF766, 0xFF86, 0x4A42, 0x10A0,
+    0x1060, 0x0840, 0x0840, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0020, 0x0840, 0x0840, 0x1080, 0x18A0,
+    0x18C1, 0x39C2, 0xFF66, 0xFF87, 0xF788, 0xFFAC, 0xFFD6, 0xFFD7,
+    0xFFD7, 0xFFD8, 0xFFF9, 0xFFDA, 0xFFFA, 0xFFDB, 0xFFDC, 0xFFFC,
+    0xFFFC, 0xFFDB, 0xFFFB, 0xFFDA, 0xF7D4, 0xFFAF, 0xFFAD, 0xFFCC,
+    0xFF8B, 0xFFAA, 0xFF88, 0xFF87, 0xFF87, 0xFF86, 0x5262, 0x18A0,
+    0x1080, 0x0840, 0x0840, 0x0820, 0x0020, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0020, 0x0820, 0x0840, 0x1080, 0x1060,
+    0x20C1, 0x2101, 0xF767, 0xFF87, 0xFFA8, 0xFFAA, 0xFFD6, 0xFFB7,
+    0xFFD7, 0xFFD8, 0xFFD8, 0xFFD9, 0xFFFA, 0xFFDA, 0xFFFB, 0xFFDB,
+    0xFFFB, 0xFFDA, 0xFFFA, 0xFFD9, 0xFFD7, 0xF7AF, 0xFFCD, 0xFFAC,
+    0xFFAB, 0xF78A, 0xFFA8, 0xFF88, 0xF787, 0xFF86, 0x39C2, 0x10A0,
+    0x1060, 0x0840, 0x0840, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0840, 0x0840, 0x1060,
+    0x10A0, 0x18A1, 0xC606, 0xFF87, 0xFFA8, 0xF7A8, 0xFFD4, 0xFFF6,
+    0xFFD7, 0xFFD7, 0xFFD8, 0xFFF9, 0xFFD9, 0xFFF9, 0xFFDA, 0xFFFA,
+    0xFFDA, 0xFFFA, 0xFFD9, 0xFFF9, 0xFFD8, 0xF7AF, 0xFFCD, 0xFFAC,
+    0xFF8A, 0xFFC9, 0xFFA8, 0xFFA7, 0xFF87, 0xFFA7, 0x3122, 0x10A0,
+    0x1080, 0x0820, 0x0840, 0x0820, 0x0020, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x0840, 0x0840, 0x1080,
+    0x18A0, 0x20C1, 0x9465, 0xFFA7, 0xFFA8, 0xFFA8, 0xFFB0, 0xFFD6,
+    0xFFF7, 0xFFD7, 0xFFD8, 0xFFD8, 0xFFD8, 0xFFF9, 0xFFD9, 0xFFF9,
+    0xFFD9, 0xFFF9, 0xFFD9, 0xFFF8, 0xFFD8, 0xF7B2, 0xFFCC, 0xFF8B,
+    0xFFAA, 0xF7C9, 0xFFA8, 0xFFA7, 0xF787, 0xE6E7, 0x1080, 0x1060,
+    0x0840, 0x0840, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0840, 0x0840, 0x1060,
+    0x18A0, 0x18C1, 0x4A42, 0xFF87, 0xF7A8, 0xFFA8, 0xFFAF, 0xFFF6,
+    0xFFD7, 0xF7F7, 0xFFD7, 0xFFD8, 0xFFD8, 0xFFF8, 0xFFD8, 0xFFF8,
+    0xFFD9, 0xFFF8, 0xFFD8, 0xFFF8, 0xFFD7, 0xFFD2, 0xFFAC, 0xFFCB,
+    0xFFAA, 0xFF89, 0xFFA8, 0xFFA7, 0xFF87, 0xB565, 0x18A0, 0x1080,
+    0x0840, 0x0840, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0820, 0x0840, 0x0840,
+    0x1080, 0x18A0, 0x20C1, 0xE6E6, 0xFFA8, 0xFFA8, 0xFFAA, 0xFFD6,
+    0xFFF6, 0xFFD6, 0xFFF7, 0xFFD7, 0xFFF8, 0xFFD8, 0xFFF8, 0xFFD8,
+    0xFFF8, 0xFFD8, 0xFFF8, 0xFFD7, 0xFFF7, 0xFFD4, 0xF7CB, 0xFF8A,
+    0xFFC9, 0xFFA8, 0xF7A8, 0xFFA8, 0xFF87, 0x6303, 0x1080, 0x1060,
+    0x0840, 0x0840, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0840, 0x0840,
+    0x1060, 0x18A0, 0x18A1, 0x8C45, 0xF7A8, 0xFFA8, 0xFFC9, 0xFFD2,
+    0xFFD6, 0xFFF6, 0xF7D7, 0xFFF7, 0xFFD7, 0xFFD7, 0xFFD5, 0xFFB0,
+    0xFFF7, 0xFFD7, 0xF7F7, 0xFFD7, 0xFFD7, 0xFFD5, 0xFF8A, 0xF7CA,
+    0xFFC9, 0xFFA8, 0xFFA8, 0xFFC7, 0xF747, 0x20C1, 0x1080, 0x0840,
+    0x0840, 0x0820, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x0840, 0x0840,
+    0x0840, 0x1080, 0x18A0, 0x3162, 0xF768, 0xFFA8, 0xFFC9, 0xFFAD,
+    0xFFF6, 0xFFD6, 0xFFF6, 0xFFD6, 0xFFF7, 0xFFD6, 0xFFCD, 0xFFAD,
+    0xFFB0, 0xF7F7, 0xFFD7, 0xFFF7, 0xFFD6, 0xFFD4, 0xF7CA, 0xFFC9,
+    0xFFA9, 0xFFA8, 0xF7A8, 0xFFA8, 0x9CA4, 0x1080, 0x1080, 0x0840,
+    0x0840, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0840,
+    0x0840, 0x1060, 0x18A0, 0x1080, 0x8C45, 0xF7A8, 0xFFC9, 0xFFA9,
+    0xFFD4, 0xFFF6, 0xFFD6, 0xFFF6, 0xFFD6, 0xFFAF, 0xFFAC, 0xC626,
+    0xDECB, 0xFFF6, 0xF7D7, 0xFFF6, 0xFFD6, 0xFFB2, 0xFFCA, 0xFFC9,
+    0xFFC9, 0xFFA8, 0xFFA8, 0xF768, 0x3122, 0x1080, 0x0840, 0x0840,
+    0x0020, 0x0820, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0820,
+    0x0840, 0x0840, 0x1080, 0x18A0, 0x2901, 0xD668, 0xFFC9, 0xFFC9,
+    0xFFAD, 0xFFF6, 0xFFD6, 0xFFF6, 0xFFD6, 0xFFCC, 0xEF4A, 0x5224,
+    0x9465, 0xFFB0, 0xFFD6, 0xFFF6, 0xFFD6, 0xFFAF, 0xFFC9, 0xF7C9,
+    0xFFA9, 0xFFC9, 0xFFA8, 0x7BC4, 0x0860, 0x0840, 0x0840, 0x0840,
+    0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,
+    0x0840, 0x0860, 0x0840, 0x1060, 0x10A0, 0x39C2, 0xE708, 0xFFC9,
+    0xFFC9, 0xFFB2, 0xFFF6, 0xFFD6, 0xFFD4, 0xFFCB, 0xAD69, 0x39E2,
+    0x6303, 0xFFCB, 0xFFB2, 0xFFF6, 0xFFB2, 0xFFCA, 0xFFA9, 0xFFC9,
+    0xFFC9, 0xFFC9, 0xB565, 0x18A0, 0x1080, 0x0840, 0x0840, 0x0820,
+    0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820,
+    0x0020, 0x0840, 0x0840, 0x1080, 0x1080, 0x18A0, 0x5262, 0xFFA8,
+    0xFFC9, 0xFFC9, 0xFFB0, 0xFFB4, 0xFFAC, 0xFFCA, 0x7BC4, 0x3162,
+    0x3982, 0xFFAA, 0xFFEA, 0xFFCB, 0xFFCA, 0xFFC9, 0xFFA9, 0xFFC9,
+    0xF7A9, 0xB545, 0x1080, 0x0880, 0x0840, 0x0840, 0x0020, 0x0820,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0820, 0x0020, 0x0840, 0x0840, 0x1060, 0x1080, 0x1080, 0x5A83,
+    0xEF68, 0xFFCA, 0xFFCA, 0xFFCA, 0xFFCA, 0xFFEA, 0x5262, 0x2922,
+    0x2902, 0xDEC8, 0xF7CA, 0xFFCA, 0xFFCA, 0xFFCA, 0xFFC9, 0xFFA9,
+    0x9465, 0x18A0, 0x1080, 0x0840, 0x0820, 0x0840, 0x0020, 0x0020,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,
+    0x0000, 0x0020, 0x0820, 0x0840, 0x0840, 0x1080, 0x1080, 0x18A0,
+    0x5262, 0xFFA9, 0xFFCA, 0xFFCA, 0xFFCA, 0xF7A9, 0x20E1, 0x2101,
+    0x2101, 0xB565, 0xFFCA, 0xFFCA, 0xFFCA, 0xFFC9, 0xDEC8, 0x4A42,
+    0x0860, 0x1080, 0x0840, 0x0840, 0x0020, 0x0820, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0820, 0x0020, 0x0840, 0x0860, 0x0840, 0x1060,
+    0x1060, 0x39C2, 0xD668, 0xFFCA, 0xFFEA, 0xB545, 0x18C1, 0x20C1,
+    0x20C1, 0x5AA3, 0xFFCA, 0xF7A9, 0xC5A5, 0x6B23, 0x18A0, 0x1080,
+    0x0860, 0x0840, 0x0820, 0x0840, 0x0820, 0x0020, 0x0020, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0020, 0x0020, 0x0820, 0x0840, 0x0820, 0x0840,
+    0x0860, 0x1080, 0x18A0, 0x83C4, 0xA4C4, 0x2922, 0x18A0, 0x10A0,
+    0x18A0, 0x18A0, 0x41E2, 0x2101, 0x1060, 0x1080, 0x1060, 0x0840,
+    0x0840, 0x0840, 0x0820, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0820, 0x0020, 0x0840,
+    0x0840, 0x0840, 0x0840, 0x1080, 0x1060, 0x1080, 0x1060, 0x1080,
+    0x1060, 0x1080, 0x1060, 0x1080, 0x0860, 0x0840, 0x0820, 0x0840,
+    0x0840, 0x0020, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0820, 0x0020,
+    0x0820, 0x0840, 0x0820, 0x0840, 0x0840, 0x0840, 0x0860, 0x0840,
+    0x0860, 0x1040, 0x0860, 0x0840, 0x0840, 0x0840, 0x0020, 0x0820,
+    0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820,
+    0x0020, 0x0820, 0x0020, 0x0020, 0x0840, 0x0820, 0x0040, 0x0820,
+    0x0840, 0x0820, 0x0840, 0x0020, 0x0820, 0x0020, 0x0820, 0x0020,
+    0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,
+    0x0000, 0x0020, 0x0000, 0x0020, 0x0820, 0x0020, 0x0820, 0x0020,
+    0x0820, 0x0020, 0x0820, 0x0020, 0x0820, 0x0020, 0x0000, 0x0020,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0000, 0x0020, 0x0000,
+    0x0020, 0x0000, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 },
+  { 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0800, 0x0020,
+    0x0020, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x69A1, 0xD2A2, 0xD282,
+    0xD2A2, 0xDAA2, 0x69C1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0xD2A2, 0xD2A2, 0xD282,
+    0xD2A2, 0xD282, 0xD2A2, 0x1021, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x91E2, 0xD2A2, 0xD282,
+    0xD2A2, 0xD282, 0xDAA2, 0x28A0, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1861, 0xB282, 0xD2A2,
+    0xD282, 0xD2A2, 0xD282, 0x2880, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2880,
+    0x30C1, 0xD2A2, 0xB282, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,
+    0x2081, 0xB262, 0x1861, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x4102, 0x1020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000,
+    0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020,
+    0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0000, 0x0820,
+    0x0000, 0x0020, 0x0000, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0800, 0x0020, 0x0000,
+    0x0020, 0x0800, 0x0020, 0x0000, 0x0020, 0x0000, 0x0020, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0020, 0x0800, 0x0020,
+    0x0800, 0x0020, 0x0800, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0020, 0x0000, 0x0020, 0x0800, 0x0820, 0x0020, 0x0800, 0x0820,
+    0x0000, 0x0820, 0x0000, 0x0820, 0x0000, 0x0020, 0x0000, 0x0020,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,
+    0x0000, 0x0020, 0x0800, 0x0020, 0x0800, 0x0820, 0x0000, 0x0820,
+    0x0800, 0x0820, 0x0800, 0x0820, 0x0800, 0x0020, 0x0000, 0x0020,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0020, 0x0800, 0x0020, 0x0800, 0x0820, 0x0800, 0x0020, 0x0800,
+    0x0820, 0x0820, 0x0800, 0x0820, 0x91E2, 0x30C1, 0x0020, 0x0000,
+    0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,
+    0x0000, 0x0020, 0x0800, 0x0800, 0x0820, 0x1020, 0x0820, 0x0820,
+    0x0820, 0x0820, 0x0820, 0x1041, 0xE323, 0xB282, 0x0820, 0x0000,
+    0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0820,
+    0x0800, 0x0820, 0x0000, 0x0820, 0x0820, 0x1020, 0x1020, 0x1020,
+    0x1020, 0x1020, 0x1020, 0x2881, 0xE361, 0xE323, 0x0000, 0x0020,
+    0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000,
+    0x0820, 0x0800, 0x0820, 0x0820, 0x1020, 0x1020, 0x1020, 0x1020,
+    0x1020, 0x1020, 0x1020, 0x0820, 0xC322, 0xE361, 0x0820, 0x0800,
+    0x0820, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0820,
+    0x0800, 0x0820, 0x0820, 0x1020, 0x1020, 0x1841, 0x1841, 0x1841,
+    0x1041, 0x1841, 0x1841, 0x1020, 0x69C1, 0x9282, 0x0820, 0x0000,
+    0x0820, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0800,
+    0x1020, 0x0820, 0x1020, 0x1020, 0x1041, 0x1841, 0x1841, 0x1841,
+    0x1041, 0x1841, 0x1841, 0x1841, 0x1020, 0x1020, 0x0820, 0x0020,
+    0x0800, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0800, 0x0820,
+    0x0820, 0x1020, 0x1020, 0x1841, 0x1841, 0x1841, 0x1861, 0x2061,
+    0x2061, 0x1861, 0x2061, 0x1041, 0x1841, 0x1020, 0x1020, 0x0820,
+    0x0800, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0820, 0x0800, 0x0800,
+    0x0820, 0x1020, 0x1041, 0x1841, 0x2061, 0x1861, 0x2061, 0x2081,
+    0x2081, 0x2061, 0x1861, 0x2061, 0x1841, 0x1841, 0x1020, 0x0820,
+    0x0000, 0x0820, 0x0800, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0820, 0x0820,
+    0x1020, 0x1020, 0x1841, 0x2061, 0x1861, 0x2881, 0x2061, 0x2081,
+    0x2881, 0x2081, 0x2861, 0x1861, 0x2061, 0x1841, 0x1041, 0x1020,
+    0x0820, 0x0800, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x0800, 0x0820, 0x0820,
+    0x1020, 0x1041, 0x2061, 0x2061, 0x2061, 0x2081, 0x28A1, 0x5141,
+    0x69A1, 0x28A1, 0x2061, 0x2081, 0x2061, 0x2061, 0x1041, 0x1020,
+    0x0820, 0x0820, 0x0800, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0020, 0x0000, 0x0820, 0x0800, 0x0820, 0x1020,
+    0x1041, 0x1841, 0x2061, 0x2081, 0x28A1, 0x2881, 0x30A1, 0xB322,
+    0x4962, 0x30C1, 0x28A1, 0x28A1, 0x2081, 0x2061, 0x1041, 0x1841,
+    0x1020, 0x0820, 0x0800, 0x0800, 0x0020, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0020, 0x0000, 0x0820, 0x0800, 0x0820, 0x1020,
+    0x1841, 0x1861, 0x2061, 0x28A1, 0x30A1, 0x30C1, 0x51C2, 0xCBA2,
+    0x38E2, 0x30C1, 0x28A1, 0x30A1, 0x28A1, 0x2081, 0x2061, 0x1841,
+    0x1020, 0x0820, 0x0800, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0020, 0x0800, 0x0820, 0x1020, 0x1020,
+    0x1841, 0x2061, 0x2081, 0x28A1, 0x30C1, 0x38E2, 0xB322, 0x9AE1,
+    0x3902, 0x38E2, 0x30E2, 0x30A1, 0x28A1, 0x2081, 0x2061, 0x1041,
+    0x1020, 0x0820, 0x0820, 0x0800, 0x0000, 0x0020, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0020, 0x0000, 0x0800, 0x0820, 0x1020, 0x1841,
+    0x2061, 0x2081, 0x28A1, 0x28A1, 0x30E2, 0x69A1, 0xEC23, 0x6A21,
+    0x3922, 0x3902, 0x38E2, 0x30E2, 0x30A1, 0x28A1, 0x2081, 0x2061,
+    0x1841, 0x1020, 0x0820, 0x0800, 0x0020, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0820, 0x0800, 0x1020, 0x1020, 0x1041,
+    0x2061, 0x2081, 0x30A1, 0x30C1, 0x3922, 0xCBA2, 0xEC23, 0x4122,
+    0x4142, 0x4122, 0x3902, 0x38E2, 0x30C1, 0x28C1, 0x2081, 0x2061,
+    0x1841, 0x1020, 0x0820, 0x0800, 0x0000, 0x0020, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0020, 0x0000, 0x0020, 0x0800, 0x1020, 0x1841, 0x2061,
+    0x2061, 0x28A1, 0x30C1, 0x30C2, 0x7242, 0xEC63, 0xB381, 0x4962,
+    0x5162, 0x5162, 0x4142, 0x3902, 0x38E2, 0x30C1, 0x28A1, 0x2061,
+    0x1041, 0x1841, 0x0820, 0x0820, 0x0800, 0x0020, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0020, 0x0800, 0x0820, 0x1020, 0x1841, 0x2061,
+    0x2081, 0x28A1, 0x38E2, 0x3922, 0xE441, 0xEC63, 0x9323, 0x51A2,
+    0x59C2, 0x4983, 0x4962, 0x4142, 0x3902, 0x38E2, 0x30A1, 0x2081,
+    0x1861, 0x1841, 0x1020, 0x0820, 0x0800, 0x0020, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0020, 0x0800, 0x0820, 0x1020, 0x1041, 0x2061,
+    0x2881, 0x30C1, 0x30E2, 0x8A82, 0xEC63, 0xF4C2, 0x9B23, 0x51A2,
+    0x59C2, 0x51C2, 0x9B23, 0x5162, 0x3902, 0x38E2, 0x30C1, 0x28A1,
+    0x1861, 0x1841, 0x1020, 0x0820, 0x0800, 0x0020, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0020, 0x0000, 0x0820, 0x0800, 0x0820, 0x1020, 0x2061, 0x2081,
+    0x28A1, 0x38E2, 0x5162, 0xEC63, 0xF4C2, 0xECC2, 0x9303, 0x6223,
+    0x6223, 0x6223, 0xECA2, 0xAB61, 0x4122, 0x3902, 0x30C1, 0x28A1,
+    0x1861, 0x1841, 0x1020, 0x0820, 0x0800, 0x0020, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0020, 0x0800, 0x0800, 0x0820, 0x1041, 0x2061, 0x2081,
+    0x28A1, 0x30E2, 0xB302, 0xECC2, 0xF4C2, 0xED03, 0xECA2, 0x72C3,
+    0x6223, 0x9323, 0xF503, 0xF4C2, 0x9B23, 0x3902, 0x38E2, 0x2881,
+    0x2081, 0x1841, 0x1020, 0x0820, 0x0820, 0x0800, 0x0020, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0020, 0x0000, 0x0820, 0x0800, 0x1020, 0x1041, 0x2061, 0x28A1,
+    0x30C1, 0x5162, 0xECA2, 0xECC2, 0xF503, 0xED03, 0xF503, 0xED44,
+    0xDD02, 0xF503, 0xED03, 0xF4C2, 0xECC2, 0x7A81, 0x30C2, 0x28A1,
+    0x2081, 0x2061, 0x1841, 0x1020, 0x0800, 0x0020, 0x0000, 0x0020,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0020, 0x0000, 0x0800, 0x1020, 0x1841, 0x1861, 0x28A1,
+    0x28A1, 0xAB61, 0xECC2, 0xF4C2, 0xED03, 0xF503, 0xED44, 0xED44,
+    0xF543, 0xF543, 0xF503, 0xED03, 0xF4C2, 0xECA2, 0x4962, 0x30C1,
+    0x28A1, 0x2061, 0x1841, 0x1020, 0x0820, 0x0000, 0x0020, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0020, 0x0000, 0x0820, 0x0820, 0x1020, 0x1841, 0x2061, 0x28A1,
+    0x4962, 0xECA2, 0xF4C2, 0xED03, 0xF503, 0xF543, 0xF583, 0xF583,
+    0xED83, 0xF583, 0xF543, 0xED03, 0xED03, 0xF4C2, 0xC382, 0x30C1,
+    0x2881, 0x1861, 0x1041, 0x1020, 0x0820, 0x0800, 0x0020, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0020, 0x0000, 0x0800, 0x0820, 0x1020, 0x1841, 0x1861, 0x2081,
+    0x9AE1, 0xECA2, 0xF4C2, 0xED03, 0xED43, 0xF583, 0xF5A3, 0xF605,
+    0xF605, 0xF583, 0xF583, 0xF543, 0xED03, 0xF4C2, 0xF4C2, 0x6A01,
+    0x28A1, 0x1861, 0x1841, 0x1020, 0x1020, 0x0820, 0x0000, 0x0020,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0020, 0x0800, 0x0820, 0x1020, 0x1841, 0x2081, 0x30C1,
+    0xE441, 0xF4C2, 0xED03, 0xF503, 0xF543, 0xF583, 0xF5C4, 0xF6A9,
+    0xF729, 0xF646, 0xF583, 0xF543, 0xED03, 0xECC2, 0xF4A2, 0xAB61,
+    0x2081, 0x2081, 0x1041, 0x1020, 0x0820, 0x0800, 0x0000, 0x0020,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0020, 0x0800, 0x0820, 0x1020, 0x1861, 0x2061, 0x7201,
+    0xECA2, 0xF4C2, 0xED03, 0xF543, 0xF583, 0xF5C4, 0xF6C9, 0xF729,
+    0xFF09, 0xFF29, 0xF646, 0xF563, 0xF543, 0xED03, 0xF4C2, 0xECA1,
+    0x38E2, 0x2081, 0x1841, 0x1020, 0x0820, 0x0800, 0x0820, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0020, 0x0000, 0x0820, 0x1020, 0x1020, 0x2061, 0x2081, 0xB381,
+    0xF4C2, 0xECC1, 0xF503, 0xF543, 0xF5A3, 0xF708, 0xFF09, 0xFF29,
+    0xF709, 0xFF29, 0xFF09, 0xF605, 0xF543, 0xED02, 0xECC2, 0xF4C1,
+    0x61A1, 0x2061, 0x1041, 0x1020, 0x0820, 0x0800, 0x0000, 0x0020,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0020, 0x0800, 0x0820, 0x1041, 0x1861, 0x30A1, 0xE4A1,
+    0xECC1, 0xF502, 0xF502, 0xF543, 0xF5E5, 0xF729, 0xFF09, 0xFF69,
+    0xFF49, 0xF729, 0xFF29, 0xF646, 0xF543, 0xF502, 0xF4C1, 0xF4E1,
+    0x9282, 0x2081, 0x1841, 0x1020, 0x0820, 0x0800, 0x0020, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0020, 0x0000, 0x0820, 0x1020, 0x1841, 0x1861, 0x69A1, 0xF4E1,
+    0xF4C1, 0xF502, 0xF502, 0xF563, 0xF6A7, 0xFF29, 0xFF49, 0xFF6A,
+    0xF749, 0xFF29, 0xFF09, 0xF6C9, 0xF543, 0xF502, 0xED02, 0xF4C1,
+    0x9AE1, 0x1861, 0x1041, 0x1020, 0x0820, 0x0800, 0x0020, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0020, 0x0000, 0x1020, 0x1841, 0x1841, 0x8A82, 0xECC1,
+    0xF4C1, 0xED02, 0xF542, 0xF5C4, 0xFEE8, 0xF729, 0xFF49, 0xFF69,
+    0xFF49, 0xF769, 0xFF09, 0xFF08, 0xF583, 0xF521, 0xF502, 0xF4C1,
+    0x9AE1, 0x2081, 0x1841, 0x1020, 0x0820, 0x0820, 0x0800, 0x0020,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0020, 0x0000, 0x0820, 0x1020, 0x1841, 0x2061, 0xB381, 0xF4C1,
+    0xECC1, 0xF502, 0xF563, 0xF6A7, 0xFF08, 0xF709, 0xFF69, 0xFF48,
+    0xF6E5, 0xF769, 0xFF09, 0xFF08, 0xF583, 0xED42, 0xF502, 0xECC1,
+    0x9AE1, 0x2061, 0x1021, 0x1020, 0x0820, 0x0000, 0x0020, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0020, 0x0800, 0x0820, 0x1041, 0x1841, 0xDC21, 0xECC1,
+    0xF502, 0xED02, 0xF646, 0xFF08, 0xF6E8, 0xFF29, 0xFF49, 0xFF27,
+    0xF684, 0xF6E8, 0xFF29, 0xFF08, 0xF5A3, 0xF542, 0xF502, 0xF4C1,
+    0x9AE1, 0x2081, 0x1841, 0x1020, 0x0820, 0x0820, 0x0800, 0x0020,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0020, 0x0000, 0x0820, 0x0820, 0x1841, 0x2881, 0xF4C1, 0xF4C1,
+    0xF502, 0xF563, 0xF6A9, 0xFEE8, 0xF708, 0xFF09, 0xFF29, 0xF685,
+    0xF684, 0xF664, 0xFEE8, 0xF6E8, 0xF5A3, 0xF543, 0xF502, 0xF502,
+    0x8A82, 0x2061, 0x1041, 0x1020, 0x0820, 0x0000, 0x0020, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0020, 0x0000, 0x0800, 0x0820, 0x1041, 0x30C2, 0xF4C1, 0xECC1,
+    0xF502, 0xF542, 0xF6A7, 0xF708, 0xFEE8, 0xFF09, 0xF685, 0xF684,
+    0xFE64, 0xF644, 0xF666, 0xF708, 0xF583, 0xF543, 0xF521, 0xF522,
+    0x8281, 0x2881, 0x1841, 0x1020, 0x0820, 0x0820, 0x0000, 0x0020,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0020, 0x0800, 0x0820, 0x1841, 0x4921, 0xF4E1, 0xF502,
+    0xF502, 0xF521, 0xF5C4, 0xF708, 0xFF09, 0xF6A7, 0xF624, 0xF664,
+    0xF644, 0xF624, 0xFDE4, 0xFEE8, 0xF583, 0xED43, 0xF521, 0xF502,
+    0x7A81, 0x2061, 0x1041, 0x1020, 0x0820, 0x0800, 0x0020, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0020, 0x0000, 0x0800, 0x0820, 0x0820, 0x4161, 0xECC1, 0xF502,
+    0xF502, 0xF542, 0xF583, 0xF6A9, 0xFEE8, 0xF646, 0xF624, 0xF625,
+    0xF645, 0xF624, 0xF5E3, 0xF6A7, 0xF583, 0xF543, 0xF521, 0xF522,
+    0x8281, 0x2081, 0x1841, 0x1020, 0x0820, 0x0820, 0x0000, 0x0020,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0020, 0x0800, 0x0820, 0x1020, 0x4981, 0xFD22, 0xF502,
+    0xF521, 0xF542, 0xF543, 0xF646, 0xF708, 0xF666, 0xF5E4, 0xF624,
+    0xF624, 0xF5E4, 0xF624, 0xFEA7, 0xF563, 0xF543, 0xED42, 0xF521,
+    0x7242, 0x2061, 0x1041, 0x1020, 0x0820, 0x0800, 0x0000, 0x0020,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0020, 0x0000, 0x0800, 0x0820, 0x0820, 0x3101, 0xF501, 0xED02,
+    0xF521, 0xF542, 0xF543, 0xF5C4, 0xFEE8, 0xF666, 0xF604, 0xF5E4,
+    0xFE04, 0xF5E4, 0xF6A7, 0xF666, 0xF583, 0xF563, 0xF542, 0xF521,
+    0x69C1, 0x2061, 0x1841, 0x1020, 0x0820, 0x0800, 0x0020, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0020, 0x0800, 0x0820, 0x1020, 0x2081, 0xFD21, 0xF521,
+    0xF542, 0xF542, 0xF583, 0xF5A3, 0xF6A7, 0xF666, 0xF5E4, 0xF604,
+    0xF5E4, 0xFE04, 0xF6A7, 0xF5C4, 0xF5A3, 0xF543, 0xF542, 0xF542,
+    0x4962, 0x1841, 0x1041, 0x1020, 0x0800, 0x0020, 0x0000, 0x0020,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0020, 0x0000, 0x0800, 0x0820, 0x1020, 0x1041, 0xD4A3, 0xED21,
+    0xF542, 0xF543, 0xF583, 0xF583, 0xF645, 0xF6A7, 0xFE04, 0xF5E4,
+    0xF604, 0xF604, 0xF5C3, 0xF5C3, 0xF5A3, 0xF583, 0xF543, 0xFD62,
+    0x38E2, 0x1861, 0x1841, 0x1020, 0x0820, 0x0800, 0x0020, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0020, 0x0000, 0x0820, 0x1020, 0x2061, 0xB381, 0xF562,
+    0xF542, 0xF543, 0xF583, 0xF5A3, 0xF5C3, 0xF6A9, 0xF604, 0xF5E4,
+    0xFE04, 0xF5E4, 0xF5C4, 0xF5A3, 0xF5A3, 0xF582, 0xF542, 0xD4A3,
+    0x2081, 0x1861, 0x1841, 0x1020, 0x0800, 0x0000, 0x0020, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0020, 0x0000, 0x0820, 0x1020, 0x1841, 0x7A81, 0xF542,
+    0xF542, 0xF582, 0xF583, 0xF5A3, 0xF5A3, 0xF645, 0xF604, 0xF5E4,
+    0xF604, 0xF5E3, 0xF5C3, 0xF5A3, 0xF5A3, 0xF562, 0xFD82, 0xBC02,
+    0x28A1, 0x2061, 0x1841, 0x1020, 0x0820, 0x0820, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0020, 0x0000, 0x0820, 0x0820, 0x1020, 0x1841, 0x3902, 0xF562,
+    0xF582, 0xF582, 0xF5A3, 0xF5A3, 0xF5C3, 0xF5C3, 0xF5E3, 0xFDE4,
+    0xF604, 0xF5E3, 0xF5C3, 0xF5A3, 0xF5A3, 0xF583, 0xF562, 0x7A81,
+    0x2081, 0x1861, 0x1841, 0x1020, 0x0800, 0x0020, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0020, 0x0000, 0x0800, 0x0820, 0x1020, 0x1041, 0x1861, 0xBBE2,
+    0xF582, 0xF562, 0xF5A3, 0xF5A3, 0xF5C3, 0xF5C3, 0xF5C4, 0xF604,
+    0xFDE4, 0xF5E3, 0xF5C3, 0xF5C3, 0xF5A3, 0xF582, 0xF563, 0x4142,
+    0x28A1, 0x2061, 0x1841, 0x1020, 0x0800, 0x0820, 0x0000, 0x0020,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0820, 0x0800, 0x0820, 0x1020, 0x2061, 0x2081, 0x5162,
+    0xF582, 0xF582, 0xF5A3, 0xF5C3, 0xF5C3, 0xF5C4, 0xF604, 0xFDE4,
+    0xF604, 0xF5E3, 0xF5C3, 0xDD02, 0x9323, 0x7242, 0x4122, 0x30C1,
+    0x2881, 0x2061, 0x1041, 0x1020, 0x0800, 0x0820, 0x0000, 0x0020,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,
+    0x0000, 0x0020, 0x0800, 0x0820, 0x1020, 0x1861, 0x2061, 0x28A1,
+    0x7A81, 0x9B81, 0x8303, 0xED84, 0xF5C3, 0xF5E3, 0xF5E4, 0xF604,
+    0xFE04, 0xF604, 0xF5E3, 0x9B23, 0x5162, 0x4102, 0x40E2, 0x30C1,
+    0x28A1, 0x1861, 0x1841, 0x1020, 0x1020, 0x0800, 0x0020, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0020, 0x0800, 0x0820, 0x0820, 0x1020, 0x2061, 0x2081, 0x2881,
+    0x30C1, 0x40E2, 0x4142, 0x9B23, 0xFDE3, 0xF5E3, 0xF604, 0xF604,
+    0xF604, 0xFDE4, 0xF5E3, 0x61A1, 0x4962, 0x40E2, 0x40E2, 0x30C1,
+    0x28A1, 0x1861, 0x1841, 0x1020, 0x0820, 0x0000, 0x0020, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0020, 0x0000, 0x0800, 0x1020, 0x1020, 0x1861, 0x2081, 0x28A1,
+    0x30C1, 0x40E2, 0x4122, 0x4942, 0xED84, 0xF604, 0xFDE4, 0xF604,
+    0xF604, 0xFE04, 0xDCC3, 0x4962, 0x5162, 0x40E2, 0x40E2, 0x30C1,
+    0x28A1, 0x1861, 0x1841, 0x1020, 0x0820, 0x0820, 0x0800, 0x0020,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,
+    0x0000, 0x0820, 0x0800, 0x1020, 0x1841, 0x1861, 0x2881, 0x28A1,
+    0x38E2, 0x4102, 0x4142, 0x5162, 0xCCA4, 0xFE04, 0xF5E4, 0xF604,
+    0xFDE4, 0xF604, 0xAC43, 0x4942, 0x4962, 0x40E2, 0x40E2, 0x30C1,
+    0x28A1, 0x1861, 0x1841, 0x1020, 0x0820, 0x0800, 0x0020, 0x0000,
+    0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000,
+    0x0020, 0x0000, 0x0800, 0x1020, 0x1841, 0x2061, 0x2081, 0x28C1,
+    0x38E2, 0x40E2, 0x4122, 0x4962, 0x9BA3, 0xF604, 0xF5E4, 0xF604,
+    0xFE04, 0xF604, 0xD4A4, 0x4962, 0x5162, 0x40E2, 0x40E2, 0x30C1,
+    0x28A1, 0x1861, 0x1841, 0x1020, 0x0820, 0x0820, 0x0800, 0x0020,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,
+    0x0800, 0x0820, 0x0820, 0x1020, 0x1841, 0x2061, 0x2081, 0x30A1,
+    0x30E2, 0x40E2, 0x4142, 0x5162, 0x9BC3, 0xFE04, 0xF624, 0xF624,
+    0xF624, 0xFDE4, 0xF5E4, 0x9323, 0x4962, 0x4122, 0x40E2, 0x30C1,
+    0x28A1, 0x2061, 0x2061, 0x1041, 0x1020, 0x0800, 0x0020, 0x0000,
+    0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,
+    0x0800, 0x0800, 0x0820, 0x1020, 0x1841, 0x1861, 0x2081, 0x30A1,
+    0x30E2, 0x40E2, 0x5162, 0x4962, 0x9BA3, 0xF623, 0xF604, 0xF624,
+    0xF604, 0xF624, 0xF623, 0xF603, 0x59C2, 0x4142, 0x40E2, 0x30C1,
+    0x2881, 0x2081, 0x2061, 0x1041, 0x1020, 0x0820, 0x0820, 0x0800,
+    0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000,
+    0x0820, 0x0800, 0x1020, 0x1020, 0x1841, 0x1861, 0x28A1, 0x30C1,
+    0x38E2, 0x4942, 0x4962, 0x5162, 0xAC43, 0xFE43, 0xF643, 0xFE43,
+    0xF664, 0xF643, 0xF623, 0xFE23, 0x9303, 0x4122, 0x40E2, 0x30E2,
+    0x28A1, 0x2061, 0x2061, 0x1041, 0x1020, 0x0820, 0x0800, 0x0820,
+    0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,
+    0x0800, 0x0800, 0x1020, 0x1841, 0x1861, 0x2081, 0x28A1, 0x30C1,
+    0x40E2, 0x4122, 0x5162, 0x51A2, 0xCD43, 0xF644, 0xF664, 0xF644,
+    0xFE64, 0xF664, 0xF643, 0xF663, 0xC4C2, 0x5162, 0x40E2, 0x38E2,
+    0x28A1, 0x2081, 0x2061, 0x1841, 0x1020, 0x0820, 0x0820, 0x0000,
+    0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0820,
+    0x0800, 0x0820, 0x1020, 0x1041, 0x2061, 0x2081, 0x28A1, 0x38E2,
+    0x40E2, 0x4142, 0x5162, 0x51A2, 0xF603, 0xF664, 0xFE64, 0xF664,
+    0xF644, 0xF664, 0xFE44, 0xF643, 0xEDE3, 0x4962, 0x4122, 0x30E2,
+    0x30C1, 0x2061, 0x2061, 0x1841, 0x1020, 0x0820, 0x0800, 0x0020,
+    0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020,
+    0x0800, 0x0820, 0x1020, 0x1841, 0x2061, 0x2081, 0x28A1, 0x38E2,
+    0x3902, 0x4962, 0x51A2, 0x8303, 0xF644, 0xF664, 0xFE84, 0xF684,
+    0xF684, 0xFE44, 0xF664, 0xF664, 0xFE64, 0x59C2, 0x4122, 0x38E2,
+    0x30C1, 0x28A1, 0x2061, 0x1041, 0x1020, 0x0820, 0x0820, 0x0800,
+    0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0800,
+    0x0820, 0x0820, 0x1020, 0x1841, 0x2061, 0x2081, 0x28A1, 0x38E2,
+    0x3902, 0x5162, 0x59C2, 0xC4C2, 0xF6A4, 0xF684, 0xFE84, 0xF684,
+    0xF684, 0xF684, 0xFE84, 0xF663, 0xF664, 0x72A3, 0x4122, 0x3902,
+    0x30C1, 0x28A1, 0x51C1, 0x2881, 0x1041, 0x1020, 0x0820, 0x0800,
+    0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000,
+    0x0800, 0x0820, 0x1020, 0x1841, 0x1861, 0x28A1, 0x30C1, 0x3902,
+    0x4122, 0x4962, 0x7242, 0xF663, 0xFE84, 0xF684, 0xF684, 0xF6A4,
+    0xFEA4, 0xF684, 0xF684, 0xFE84, 0xFE64, 0x8B83, 0x4142, 0x3902,
+    0x38E2, 0x28A1, 0x6A82, 0xA3C3, 0x1841, 0x1020, 0x0820, 0x0820,
+    0x0800, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x0000, 0x0820,
+    0x0800, 0x0820, 0x1020, 0x1841, 0x1861, 0x59C1, 0xB463, 0xC4C2,
+    0x8303, 0x51A2, 0xAC43, 0xFEA4, 0xF684, 0xF6A4, 0xFEA4, 0xF6C4,
+    0xFEC4, 0xF6C4, 0xF6A4, 0xFE84, 0xF684, 0xAC43, 0x4962, 0x4122,
+    0x30E2, 0x30A1, 0x9B81, 0xF602, 0x1861, 0x1020, 0x0820, 0x0800,
+    0x0800, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x0800,
+    0x0820, 0x1020, 0x1041, 0x1021, 0x2881, 0xDDA2, 0xFE62, 0xF642,
+    0xF683, 0xCD43, 0xF663, 0xF684, 0xF6A4, 0xFEC4, 0xF6C5, 0xFEE5,
+    0xF6C5, 0xFEE5, 0xF6A4, 0xF6A4, 0xFEA4, 0xC4C2, 0x5162, 0x4142,
+    0x3902, 0x28A1, 0xCD63, 0xFE42, 0x4981, 0x1020, 0x0820, 0x0800,
+    0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0800, 0x0820,
+    0x0820, 0x1020, 0x1041, 0x2061, 0x59C1, 0xFE62, 0xF662, 0xF662,
+    0xFE83, 0xF663, 0xF684, 0xFEA4, 0xF6C4, 0xFEE5, 0xF6C5, 0xFF09,
+    0xF705, 0xFEE5, 0xFEE5, 0xF6C4, 0xF6A4, 0xE5A2, 0x51A2, 0x4942,
+    0x3902, 0x51C1, 0xFE62, 0xFE62, 0x6A82, 0x0820, 0x0800, 0x0800,
+    0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0800,
+    0x0820, 0x1020, 0x1841, 0x1841, 0x6A82, 0xF642, 0xFE42, 0xF682,
+    0xF683, 0xF684, 0xF6A4, 0xFEC4, 0xF6E5, 0xFF05, 0xF707, 0xFFB0,
+    0xFF06, 0xF705, 0xF705, 0xFEE5, 0xFEC4, 0xFEA4, 0x6223, 0x4183,
+    0x4122, 0xAC43, 0xFE62, 0xFE62, 0x8B41, 0x1841, 0x1020, 0x0800,
+    0x0820, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0800,
+    0x1020, 0x1020, 0x1841, 0x1861, 0x72A2, 0xFE62, 0xFE82, 0xF682,
+    0xF683, 0xFEA4, 0xF6C4, 0xFEE5, 0xF705, 0xFF05, 0xF72E, 0xFFB2,
+    0xFF26, 0xF726, 0xF705, 0xFEC5, 0xFEE5, 0xF6C4, 0x8B63, 0x51A2,
+    0x6223, 0xF662, 0xFE82, 0xF662, 0xAC43, 0x1021, 0x1020, 0x0820,
+    0x0000, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0800, 0x0800,
+    0x0820, 0x1020, 0x1041, 0x1861, 0x6201, 0xF682, 0xF682, 0xFEA2,
+    0xF6A4, 0xF6A4, 0xFEC4, 0xF705, 0xF705, 0xFF47, 0xFFB4, 0xFF94,
+    0xF747, 0xFF06, 0xFF26, 0xF705, 0xFEC5, 0xFEE5, 0xD603, 0x72C3,
+    0xDE02, 0xFE82, 0xF682, 0xF6A2, 0xC4C2, 0x2061, 0x1841, 0x0820,
+    0x0800, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0820, 0x0800,
+    0x0820, 0x1020, 0x1841, 0x1861, 0x4981, 0xFEA2, 0xFEC2, 0xFEC3,
+    0xF6C3, 0xFEC4, 0xF6E5, 0xFF05, 0xF726, 0xFF4C, 0xFF95, 0xFFD4,
+    0xF78C, 0xFF46, 0xFF46, 0xF706, 0xFF05, 0xF6E5, 0xFEC5, 0xF6C4,
+    0xF6A4, 0xFEA2, 0xF682, 0xF682, 0xBCC2, 0x1881, 0x1021, 0x1020,
+    0x0800, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0800,
+    0x0820, 0x1020, 0x1861, 0x2061, 0x30A1, 0xEE43, 0xF6A2, 0xFEC3,
+    0xF6C4, 0xFEC5, 0xF705, 0xF726, 0xFF06, 0xF7AF, 0xFFD5, 0xFFB5,
+    0xFFD4, 0xFF69, 0xFF47, 0xF707, 0xFF26, 0xF705, 0xF6E5, 0xFEE5,
+    0xF6C4, 0xFEC3, 0xF6C2, 0xFEC2, 0xD563, 0x2081, 0x1080, 0x0840,
+    0x0820, 0x0820, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0800, 0x0820,
+    0x0820, 0x1841, 0x2061, 0x2081, 0x28E1, 0xC4C2, 0xFEC3, 0xFEC3,
+    0xF6C4, 0xFF05, 0xF705, 0xFF26, 0xFF46, 0xFFAF, 0xFFD5, 0xFFB5,
+    0xFFD5, 0xF7B2, 0xFF48, 0xFF47, 0xF707, 0xFF27, 0xF726, 0xFEC5,
+    0xF6E5, 0xF6C4, 0xFEC3, 0xF6A2, 0xCD43, 0x18C1, 0x1881, 0x1841,
+    0x0820, 0x0820, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0800,
+    0x1020, 0x1841, 0x1861, 0x2881, 0x28C1, 0x72A3, 0xFEC3, 0xF6C4,
+    0xFEE4, 0xF705, 0xFF26, 0xF747, 0xFF47, 0xFFAF, 0xFFB5, 0xFFD5,
+    0xFFB6, 0xFFD5, 0xFFD2, 0xF749, 0xFF47, 0xFF27, 0xF707, 0xFF06,
+    0xF705, 0xFEE5, 0xF6E4, 0xFEC3, 0xDE03, 0x28E1, 0x2081, 0x1080,
+    0x0840, 0x0840, 0x0820, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0800, 0x0820,
+    0x1020, 0x1841, 0x2061, 0x28A1, 0x30E2, 0x4922, 0xE622, 0xFF04,
+    0xF705, 0xFF26, 0xFF06, 0xF74A, 0xFF48, 0xFFB0, 0xFFD5, 0xFFD6,
+    0xFFB6, 0xFFD5, 0xFFB5, 0xFFB0, 0xF748, 0xFF48, 0xFF07, 0xF727,
+    0xFF26, 0xF705, 0xFEE4, 0xF6C4, 0xD603, 0x20C1, 0x18C1, 0x1880,
+    0x1080, 0x0840, 0x0020, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0800,
+    0x1020, 0x1841, 0x18A1, 0x30A1, 0x3101, 0x4122, 0x72A3, 0xD603,
+    0xF705, 0xFF26, 0xF747, 0xFFB0, 0xFF48, 0xFFB2, 0xFFB6, 0xFFD6,
+    0xFFB6, 0xFFD6, 0xFFB6, 0xFFD6, 0xFFB0, 0xF748, 0xFF48, 0xFF27,
+    0xF707, 0xFF05, 0xF705, 0xFF04, 0xDE03, 0x3122, 0x20C1, 0x18A0,
+    0x1080, 0x0840, 0x0840, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0800, 0x0820,
+    0x1020, 0x1841, 0x20A1, 0x28E1, 0x3902, 0x49A3, 0x59C2, 0x6284,
+    0xFF26, 0xFF46, 0xFF6A, 0xFF94, 0xFF6A, 0xFFD6, 0xFFB6, 0xFFD6,
+    0xFFB7, 0xFFD7, 0xFFB7, 0xFFD6, 0xFFB6, 0xFF4C, 0xF749, 0xFF48,
+    0xFF27, 0xF707, 0xF705, 0xFF05, 0xE6A3, 0x2902, 0x2101, 0x18C1,
+    0x18A0, 0x1060, 0x0840, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0800, 0x0820,
+    0x1020, 0x1861, 0x20A1, 0x28E1, 0x3902, 0x4183, 0x49E3, 0x8363,
+    0xFF26, 0xFF47, 0xF74C, 0xFFD5, 0xFF94, 0xFFB6, 0xFFD7, 0xFFB7,
+    0xFFD7, 0xF7D7, 0xFFD7, 0xFFD7, 0xFFD7, 0xFF94, 0xFF6A, 0xFF49,
+    0xF748, 0xFF27, 0xFF26, 0xFF05, 0xFF04, 0x5262, 0x2101, 0x20C1,
+    0x18A0, 0x1080, 0x0840, 0x0840, 0x0820, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0820, 0x0820,
+    0x1841, 0x2081, 0x18A1, 0x28E1, 0x3962, 0x4983, 0x5244, 0xB565,
+    0xFF46, 0xFF48, 0xFF8D, 0xFFB6, 0xFFD6, 0xFFB7, 0xFFD7, 0xFFD7,
+    0xFFD7, 0xFFD8, 0xFFD8, 0xFFD7, 0xFFD7, 0xF7B7, 0xFFB0, 0xFF4A,
+    0xF769, 0xFF48, 0xFF07, 0xF726, 0xF705, 0xA4A4, 0x2922, 0x20E1,
+    0x18A0, 0x1080, 0x0840, 0x0840, 0x0020, 0x0020, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x0820,
+    0x1080, 0x1881, 0x20C1, 0x28E1, 0x3162, 0x4183, 0x5204, 0xEEC5,
+    0xFF47, 0xFF48, 0xF78D, 0xFFD6, 0xFFB7, 0xFFD7, 0xFFD8, 0xFFD8,
+    0xFFD8, 0xFFD8, 0xFFD8, 0xFFD8, 0xFFD8, 0xFFD7, 0xFFD6, 0xFF6A,
+    0xFF4A, 0xF748, 0xFF47, 0xFF26, 0xFF26, 0xF724, 0x41E2, 0x2101,
+    0x20C1, 0x18A0, 0x1080, 0x0840, 0x0840, 0x0820, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x0820,
+    0x1841, 0x20A1, 0x18C1, 0x3122, 0x3982, 0x49A3, 0x8B83, 0xFF66,
+    0xFF48, 0xFF69, 0xFF8C, 0xFFD7, 0xFFD7, 0xFFD7, 0xFFD8, 0xFFD8,
+    0xFFD9, 0xFFD9, 0xFFF9, 0xFFD9, 0xFFD8, 0xFFD8, 0xFFD7, 0xF78D,
+    0xFF6A, 0xFF49, 0xFF48, 0xF747, 0xFF45, 0xFF44, 0x7BC4, 0x2922,
+    0x18C1, 0x1880, 0x1080, 0x0840, 0x0840, 0x0020, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0820,
+    0x1080, 0x2081, 0x28E1, 0x2922, 0x3982, 0x41E3, 0xB545, 0xFF47,
+    0xF748, 0xFF49, 0xFF8C, 0xFFD7, 0xFFD7, 0xFFD8, 0xFFF9, 0xFFD9,
+    0xFFFA, 0xFFDA, 0xFFFA, 0xFFDA, 0xFFF9, 0xFFD9, 0xFFD7, 0xF78D,
+    0xFF8C, 0xFF4A, 0xFF69, 0xFF47, 0xFF46, 0xFF45, 0xC5C5, 0x3122,
+    0x20C1, 0x18A0, 0x1080, 0x0840, 0x0840, 0x0020, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0820, 0x0820,
+    0x1080, 0x18A0, 0x28E1, 0x3122, 0x3982, 0x5A44, 0xF745, 0xFF47,
+    0xFF48, 0xFF49, 0xF78C, 0xFFD7, 0xFFD8, 0xFFD8, 0xFFF9, 0xFFDA,
+    0xFFFB, 0xFFDB, 0xFFFB, 0xFFDB, 0xFFFA, 0xFFD9, 0xFFD5, 0xFFAF,
+    0xFF8C, 0xFF8B, 0xF769, 0xFF48, 0xFF46, 0xF745, 0xEEC3, 0x2902,
+    0x2101, 0x20C1, 0x18A0, 0x1060, 0x0040, 0x0020, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0840,
+    0x1080, 0x1881, 0x28C1, 0x2922, 0x3982, 0xB503, 0xFF46, 0xFF47,
+    0xF788, 0xFFAA, 0xFF8D, 0xF7D7, 0xFFD8, 0xFFF9, 0xFFDA, 0xFFDB,
+    0xFFFC, 0xFFDC, 0xFFFC, 0xFFFC, 0xFFDB, 0xFFDA, 0xFFD5, 0xFFAF,
+    0xFF8D, 0xFF8C, 0xFF69, 0xFF48, 0xFF47, 0xFF45, 0xFF44, 0x3162,
+    0x2901, 0x20C1, 0x18A0, 0x1080, 0x0840, 0x0020, 0x0820, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0800, 0x0020, 0x1060,
+    0x1080, 0x2081, 0x28E1, 0x2922, 0x62A3, 0xF745, 0xFF86, 0xFF88,
+    0xFF89, 0xFFAA, 0xFFAF, 0xFFD8, 0xFFD8, 0xFFD9, 0xFFFA, 0xFFFC,
+    0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFDC, 0xFFDB, 0xFFD7, 0xFFB0,
+    0xF78D, 0xFF8C, 0xFF89, 0xF788, 0xF766, 0xFF65, 0xFF44, 0x3142,
+    0x2101, 0x18C1, 0x18A0, 0x1060, 0x0840, 0x0840, 0x0020, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0820, 0x0020, 0x0840,
+    0x1080, 0x1881, 0x28C1, 0x2922, 0xC5A5, 0xF765, 0xFF86, 0xFF88,
+    0xF789, 0xFF8B, 0xFFB0, 0xFFD8, 0xFFF9, 0xFFDA, 0xFFDB, 0xFFFC,
+    0xFFFD, 0xFFFE, 0xFFFE, 0xFFFE, 0xFFFD, 0xFFFB, 0xFFDA, 0xFFD2,
+    0xFFAF, 0xF78C, 0xFF8A, 0xFF89, 0xF787, 0xFF46, 0xFF45, 0x3162,
+    0x2901, 0x20C1, 0x18A0, 0x1080, 0x0840, 0x0840, 0x0020, 0x0020,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0820, 0x0860,
+    0x1080, 0x2081, 0x28E1, 0x3982, 0xFF64, 0xFF85, 0xFF66, 0xFF88,
+    0xFF89, 0xFFAB, 0xFFB2, 0xFFD8, 0xFFF9, 0xFFDA, 0xFFFB, 0xFFFC,
+    0xFFFE, 0xFFFE, 0xFFFE, 0xFFFE, 0xFFFD, 0xFFDB, 0xFFDA, 0xFFD5,
+    0xFFAF, 0xF78C, 0xFF8B, 0xFF89, 0xF788, 0xFF86, 0xE6A5, 0x3142,
+    0x2101, 0x18C1, 0x18A0, 0x1060, 0x0840, 0x0840, 0x0020, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0840,
+    0x1080, 0x10A0, 0x28C1, 0x6B64, 0xFF65, 0xFF65, 0xFF86, 0xF788,
+    0xFF89, 0xFF8B, 0xFFD6, 0xFFD8, 0xFFD9, 0xFFFA, 0xFFDB, 0xFFFC,
+    0xFFFE, 0xFFFE, 0xFFFE, 0xFFFE, 0xFFFD, 0xFFDB, 0xFFFA, 0xFFD8,
+    0xFFB0, 0xF78C, 0xFF8B, 0xFF89, 0xFF88, 0xFF86, 0xCE26, 0x3962,
+    0x2101, 0x20C1, 0x18A0, 0x1080, 0x0840, 0x0840, 0x0820, 0x0020,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0820, 0x0840,
+    0x1080, 0x18A0, 0x28E1, 0xBD03, 0xFF85, 0xFF86, 0xF766, 0xFF88,
+    0xFF89, 0xFFAF, 0xFFD7, 0xFFD8, 0xFFD8, 0xFFDA, 0xFFFB, 0xFFFC,
+    0xFFFD, 0xFFFD, 0xFFFE, 0xFFFD, 0xFFDC, 0xFFDB, 0xFFFA, 0xFFD9,
+    0xFFD5, 0xF78C, 0xFF8B, 0xFF89, 0xFF88, 0xF786, 0xB545, 0x3162,
+    0x20E1, 0x18C1, 0x18A0, 0x1080, 0x0840, 0x0840, 0x0020, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020,
+    0x1080, 0x1080, 0x18A1, 0xD603, 0xFF65, 0xFF86, 0xFF87, 0xF788,
+    0xFF8A, 0xFFB5, 0xFFD7, 0xFFD8, 0xFFF8, 0xFFD9, 0xFFFA, 0xFFDB,
+    0xFFDC, 0xFFFC, 0xFFDC, 0xFFFC, 0xFFFB, 0xFFDA, 0xFFF9, 0xFFD8,
+    0xFFD8, 0xFFAF, 0xFF8B, 0xFF89, 0xFF88, 0xFF86, 0x9465, 0x3122,
+    0x2101, 0x20C1, 0x18A0, 0x1080, 0x0840, 0x0020, 0x0820, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0820, 0x0840,
+    0x0840, 0x18A0, 0x20C1, 0xF745, 0xFF85, 0xFF66, 0xFF87, 0xFF88,
+    0xFFB0, 0xFFD6, 0xFFD7, 0xFFD7, 0xFFD8, 0xFFD9, 0xFFDA, 0xFFFA,
+    0xFFDB, 0xFFFB, 0xFFDB, 0xFFFB, 0xFFDB, 0xFFFA, 0xFFD9, 0xFFF8,
+    0xFFD7, 0xF7B2, 0xFFAA, 0xFF89, 0xF788, 0xFF87, 0x7364, 0x2922,
+    0x20E1, 0x18A0, 0x1080, 0x1060, 0x0040, 0x0020, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0840,
+    0x0840, 0x0860, 0x2922, 0xFF65, 0xFF65, 0xF766, 0xFF87, 0xFF88,
+    0xFFB2, 0xFFD6, 0xFFD7, 0xFFD7, 0xFFD8, 0xFFD8, 0xFFD9, 0xFFFA,
+    0xFFDA, 0xFFFA, 0xFFDA, 0xFFFA, 0xFFDA, 0xFFD9, 0xFFD8, 0xFFD8,
+    0xFFD7, 0xFFD6, 0xFFAA, 0xFF89, 0xFF88, 0xFF86, 0x5262, 0x2922,
+    0x20C1, 0x18A0, 0x1080, 0x0840, 0x0840, 0x0820, 0x0020, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0840,
+    0x0840, 0x1080, 0x4182, 0xFF85, 0xFF85, 0xFF66, 0xFF87, 0xFF88,
+    0xFFD5, 0xFFD6, 0xFFB7, 0xFFD7, 0xFFD7, 0xFFD8, 0xFFD8, 0xFFD9,
+    0xFFF9, 0xFFD9, 0xFFF9, 0xFFD9, 0xFFF9, 0xFFD8, 0xFFD8, 0xFFD7,
+    0xFFD7, 0xFFB6, 0xFF8B, 0xF788, 0xFF88, 0xF766, 0x3162, 0x20E1,
+    0x18C1, 0x18A0, 0x1080, 0x0840, 0x0840, 0x0020, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020,
+    0x0840, 0x0860, 0x39C2, 0xFF65, 0xFF65, 0xFF66, 0xF787, 0xFF88,
+    0xFFD5, 0xFFB6, 0xFFD6, 0xFFD7, 0xFFD7, 0xFFD8, 0xFFD8, 0xFFF8,
+    0xFFD8, 0xFFF9, 0xFFD9, 0xFFD8, 0xFFD8, 0xFFD8, 0xFFD7, 0xFFD7,
+    0xFFD7, 0xFFD6, 0xFF8A, 0xFF88, 0xFFA7, 0xCE26, 0x2922, 0x2901,
+    0x20C1, 0x18A0, 0x1080, 0x0840, 0x0840, 0x0020, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820,
+    0x0840, 0x0840, 0x3962, 0xFF85, 0xFF85, 0xFF66, 0xFF87, 0xFF89,
+    0xFFD6, 0xFFD6, 0xFFD6, 0xFFD7, 0xFFD7, 0xFFD7, 0xF7D7, 0xFFD8,
+    0xFFD8, 0xFFD8, 0xFFD8, 0xFFD8, 0xFFD8, 0xFFD7, 0xFFD7, 0xFFD7,
+    0xFFB6, 0xFFD5, 0xFF89, 0xF788, 0xFF87, 0x9CA4, 0x20E1, 0x20C1,
+    0x10A0, 0x1060, 0x0840, 0x0840, 0x0020, 0x0820, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,
+    0x0020, 0x0840, 0x18C1, 0xFF65, 0xFF66, 0xF766, 0xFF87, 0xFF88,
+    0xFFD5, 0xFFB5, 0xFFD6, 0xFFB6, 0xFFD6, 0xF7D7, 0xFFD7, 0xFFD7,
+    0xFFD7, 0xF7D7, 0xFFD7, 0xFFD7, 0xFFD7, 0xFFD7, 0xFFB7, 0xFFD6,
+    0xFFD6, 0xFFB2, 0xFFA8, 0xFF88, 0xFFA7, 0x6B23, 0x2901, 0x20C1,
+    0x18A0, 0x1080, 0x0840, 0x0840, 0x0020, 0x0000, 0x0020, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0820,
+    0x0020, 0x0840, 0x0840, 0xF745, 0xFF86, 0xFF87, 0xFF87, 0xFF87,
+    0xFFD4, 0xFFB5, 0xFFD5, 0xFFB6, 0xFFD6, 0xFFD6, 0xFFD7, 0xFFF7,
+    0xFFD7, 0xF7D7, 0xFFD7, 0xFFF7, 0xFFD7, 0xFFD7, 0xFFD6, 0xFFD6,
+    0xFFD6, 0xF7AF, 0xFF88, 0xFF87, 0xF767, 0x2902, 0x18C1, 0x10A0,
+    0x1060, 0x1080, 0x0820, 0x0840, 0x0020, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0020, 0x0020, 0x0840, 0xC626, 0xFF66, 0xF787, 0xFF87, 0xFF87,
+    0xF7B2, 0xFFD5, 0xFFB5, 0xFFD6, 0xFFD6, 0xFFD6, 0xFFB6, 0xFFD6,
+    0xFFF7, 0xFFD7, 0xFFD7, 0xFFD7, 0xFFD6, 0xFFD6, 0xFFB6, 0xFFD6,
+    0xFFD6, 0xFF8B, 0xFFA8, 0xFFA7, 0xCE26, 0x20C1, 0x18A0, 0x18A0,
+    0x1080, 0x0840, 0x0840, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0020, 0x0820, 0x0840, 0xA4C4, 0xFF87, 0xFF87, 0xFF87, 0xFF87,
+    0xFFB0, 0xFFD5, 0xFFD5, 0xFFB6, 0xFFD6, 0xFFD6, 0xFFD6, 0xFFF6,
+    0xFFD6, 0xFFF6, 0xFFD6, 0xFFF6, 0xFFD6, 0xFFF6, 0xFFD6, 0xFFD6,
+    0xFFB2, 0xFFA8, 0xF7A7, 0xFF87, 0x7BC4, 0x18C1, 0x18A0, 0x1060,
+    0x0840, 0x0840, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0020, 0x0000, 0x5AA3, 0xF787, 0xFF87, 0xFF87, 0xFFA7,
+    0xFFAD, 0xFFD5, 0xFFB5, 0xFFD6, 0xFFD6, 0xFFD6, 0xFFF6, 0xFFD6,
+    0xFFF6, 0xFFD6, 0xFFF6, 0xFFD6, 0xFFF6, 0xFFD6, 0xFFB6, 0xFFD6,
+    0xFFCD, 0xFFA8, 0xFFA7, 0xFFC7, 0x41E2, 0x18A0, 0x1060, 0x1080,
+    0x0840, 0x0840, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0820, 0x0020, 0x18A0, 0xFF86, 0xFF87, 0xFFA7, 0xFFA7,
+    0xFFA8, 0xFFD4, 0xFFD5, 0xFFD6, 0xFFD6, 0xFFB6, 0xF7D4, 0xFFCB,
+    0xFFB0, 0xFFB6, 0xFFD6, 0xFFB6, 0xFFD6, 0xFFB6, 0xFFD6, 0xFFB4,
+    0xF7A8, 0xFFA8, 0xFFA7, 0xC626, 0x1080, 0x0860, 0x1060, 0x0840,
+    0x0840, 0x0020, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0020, 0x8C65, 0xFF87, 0xF7A7, 0xFFA7,
+    0xFFA7, 0xFFAD, 0xFFB5, 0xFFD5, 0xFFF6, 0xFFD6, 0xF7AD, 0xFFC9,
+    0xFFC9, 0xFFB2, 0xFFB6, 0xFFD6, 0xFFB6, 0xFFD5, 0xFFF6, 0xFFAD,
+    0xFFA8, 0xFFA7, 0xFFC7, 0x7B84, 0x1060, 0x1080, 0x0840, 0x0840,
+    0x0820, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0020, 0x0020, 0x2901, 0xF767, 0xFFA7, 0xFFA7,
+    0xFFA7, 0xFFA8, 0xFFB0, 0xFFD5, 0xFFD5, 0xFFB2, 0xF7C9, 0xFFA8,
+    0xFFA9, 0xFFAC, 0xFFD6, 0xFFD6, 0xFFF6, 0xFFD6, 0xF7D2, 0xFFA8,
+    0xFFA8, 0xFFA8, 0xEF47, 0x18A1, 0x0860, 0x0840, 0x0840, 0x0040,
+    0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4A42, 0xF787, 0xFFA7,
+    0xFFA7, 0xF7A8, 0xFFA8, 0xFFCB, 0xFFAD, 0xFFC9, 0xF788, 0x83C4,
+    0xE728, 0xFFA9, 0xFFD5, 0xFFF6, 0xFFD6, 0xFFD5, 0xFFCB, 0xFFA8,
+    0xFFA8, 0xFFC8, 0x7B64, 0x1080, 0x0840, 0x0840, 0x0020, 0x0820,
+    0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0020, 0x6B23, 0xFFC7,
+    0xFFA8, 0xFFA8, 0xFFA8, 0xFFA8, 0xFFA8, 0xFFA8, 0xB545, 0x18C1,
+    0x7364, 0xFFC8, 0xFFB2, 0xFFF6, 0xFFD6, 0xFFAF, 0xFFA8, 0xFFA8,
+    0xFFA8, 0xCE68, 0x0860, 0x0840, 0x0020, 0x0020, 0x0820, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0000, 0x5242,
+    0xE728, 0xFFA8, 0xFFA8, 0xFFA8, 0xFFA8, 0xFFC8, 0x5262, 0x10A0,
+    0x18A1, 0xE728, 0xFFAF, 0xFFD6, 0xF7B0, 0xFFC9, 0xFFA8, 0xFFA8,
+    0xFFA8, 0x41E2, 0x0840, 0x0840, 0x0820, 0x0020, 0x0000, 0x0020,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000,
+    0x2901, 0xCE46, 0xFFA8, 0xFFC9, 0xFFC9, 0xE708, 0x0860, 0x1060,
+    0x1060, 0xA4C4, 0xFFC9, 0xFFCA, 0xFFC9, 0xFFC9, 0xFFA9, 0xF788,
+    0x6303, 0x0020, 0x0020, 0x0020, 0x0820, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0020, 0x0020, 0x5AA3, 0xD668, 0xFFC9, 0xA4C4, 0x0840, 0x0840,
+    0x0840, 0x4A42, 0xFFC9, 0xFFA9, 0xFFC9, 0xFFC9, 0xFFA8, 0x6B23,
+    0x0840, 0x0820, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,
+    0x0000, 0x0020, 0x0820, 0x0840, 0x5262, 0x41E2, 0x0820, 0x0040,
+    0x0820, 0x0840, 0xD688, 0xFFC9, 0xFFC9, 0xC5A5, 0x3142, 0x0020,
+    0x0020, 0x0000, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0020, 0x0000, 0x0020, 0x0000, 0x0020, 0x0820, 0x0020, 0x0820,
+    0x0020, 0x0820, 0x1080, 0x3982, 0x20C1, 0x0020, 0x0820, 0x0020,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0020, 0x0000, 0x0020, 0x0000, 0x0020, 0x0800, 0x0020,
+    0x0000, 0x0020, 0x0800, 0x0020, 0x0820, 0x0000, 0x0020, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0000, 0x0020, 0x0000,
+    0x0020, 0x0000, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0000,
+    0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 },
+  { 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x28A1,
+    0x28A0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x40E2, 0xD2A2,
+    0xDAA2, 0x1841, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xAA82, 0xD2A2,
+    0xD282, 0x61A1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x69A1, 0xD2A2,
+    0xD2A2, 0x91E2, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x28A0,
+    0x4121, 0x1020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000,
+    0x0020, 0x0000, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000,
+    0x0020, 0x0000, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0000, 0x0020,
+    0x0800, 0x0820, 0x0000, 0x0020, 0x0000, 0x0020, 0x0000, 0x0020,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0800, 0x0020,
+    0x0800, 0x0020, 0x0800, 0x0020, 0x0800, 0x0020, 0x0800, 0x0020,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0020, 0x0000, 0x0820, 0x0800, 0x0020, 0x0800, 0x0820,
+    0x0800, 0x0020, 0x0800, 0x0820, 0x0800, 0x0020, 0x0800, 0x0020,
+    0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0020, 0x0000, 0x0020, 0x0800, 0x0020, 0x0800, 0x0820, 0x1020,
+    0x0820, 0x0820, 0x0820, 0x0820, 0x0800, 0x0820, 0x0000, 0x0820,
+    0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0020, 0x0800, 0x0820, 0x0000, 0x0820, 0x1020, 0x1020,
+    0x1020, 0x1020, 0x1020, 0x1020, 0x0820, 0x1020, 0x0820, 0x0000,
+    0x0820, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0020, 0x0800, 0x0820, 0x0820, 0x0820, 0x1020, 0x1020, 0x1841,
+    0x1041, 0x1841, 0x1841, 0x1020, 0x1020, 0x1020, 0x0820, 0x0800,
+    0x0820, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000,
+    0x0020, 0x0800, 0x0820, 0x0820, 0x1020, 0x1841, 0x1841, 0x7A21,
+    0x9282, 0x69A1, 0x1861, 0x1041, 0x1841, 0x1020, 0x1020, 0x0820,
+    0x0800, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000,
+    0x0020, 0x0800, 0x0820, 0x1020, 0x1841, 0x1841, 0x1861, 0x2061,
+    0xB322, 0xE3C1, 0xBB22, 0x2081, 0x2061, 0x1041, 0x1020, 0x1020,
+    0x0820, 0x0800, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0800,
+    0x0820, 0x0820, 0x1020, 0x1841, 0x1841, 0x2061, 0x2081, 0x2061,
+    0x40E2, 0xEBE3, 0xE3E3, 0xAA62, 0x1861, 0x2061, 0x1041, 0x1020,
+    0x1020, 0x0800, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000,
+    0x0800, 0x1020, 0x1020, 0x1041, 0x2061, 0x2081, 0x2881, 0x20A1,
+    0x28A1, 0xCBA2, 0xEC23, 0xEC23, 0x69A1, 0x2081, 0x2061, 0x1841,
+    0x1020, 0x0820, 0x0820, 0x0800, 0x0020, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0820,
+    0x1020, 0x1020, 0x1841, 0x1861, 0x2881, 0x2881, 0x28A1, 0x30C1,
+    0x38E2, 0xB322, 0xEC43, 0xEC23, 0xCBA2, 0x28A1, 0x1861, 0x2061,
+    0x1041, 0x1020, 0x0800, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x0800,
+    0x1020, 0x1041, 0x1841, 0x2061, 0x28A1, 0x30C1, 0x30E2, 0x3902,
+    0x3902, 0xB322, 0xEC23, 0xEC23, 0xEC23, 0x7A21, 0x2081, 0x2061,
+    0x1841, 0x1020, 0x0820, 0x0820, 0x0800, 0x0020, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0820, 0x0820,
+    0x1020, 0x1841, 0x1861, 0x28A1, 0x30A1, 0x38E2, 0x3902, 0x4142,
+    0x4942, 0xCBA2, 0xEC63, 0xEC63, 0xEC23, 0xCB82, 0x28A1, 0x2081,
+    0x1861, 0x1841, 0x1020, 0x0800, 0x0000, 0x0020, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0800, 0x0820,
+    0x1020, 0x1841, 0x2081, 0x28A1, 0x30C1, 0x3902, 0x4122, 0x4962,
+    0x4962, 0xEC23, 0xEC63, 0xEC63, 0xF463, 0xEC43, 0x69A1, 0x28A1,
+    0x1861, 0x1841, 0x1020, 0x0820, 0x0800, 0x0020, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x0800, 0x1020,
+    0x1041, 0x2061, 0x2081, 0x30C1, 0x38E2, 0x4142, 0x5162, 0x59A2,
+    0x6223, 0xF4C2, 0xECC2, 0xECC2, 0xEC63, 0xEC63, 0xB302, 0x28A1,
+    0x2081, 0x1041, 0x1020, 0x0820, 0x0800, 0x0000, 0x0020, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0800, 0x1020,
+    0x1041, 0x2061, 0x28A1, 0x38E2, 0x3902, 0x4962, 0x51A2, 0x6223,
+    0x9323, 0xF503, 0xED03, 0xECC4, 0xF4C2, 0xEC83, 0xEC23, 0x38E2,
+    0x2881, 0x1861, 0x1841, 0x0820, 0x0800, 0x0820, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x0820, 0x1020,
+    0x1841, 0x2881, 0x28A1, 0x38E2, 0x4142, 0x59A2, 0x6223, 0x6223,
+    0xDCC3, 0xF503, 0xF503, 0xED03, 0xECC2, 0xF4C2, 0xEC63, 0x61A1,
+    0x2881, 0x1861, 0x1041, 0x1020, 0x0800, 0x0800, 0x0020, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0800, 0x0820, 0x1020,
+    0x2061, 0x2081, 0x30C1, 0x3902, 0x4962, 0x51A2, 0x6223, 0x9303,
+    0xF544, 0xED44, 0xF583, 0xF646, 0xED03, 0xF4C2, 0xF4C2, 0x9B01,
+    0x30A1, 0x2081, 0x1841, 0x1020, 0x0800, 0x0020, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x0820, 0x1841,
+    0x1861, 0x28A1, 0x30C1, 0x4922, 0x5162, 0x6223, 0x6A82, 0xDCC3,
+    0xF583, 0xF5C4, 0xF605, 0xFEC9, 0xF605, 0xED03, 0xECA2, 0xCB82,
+    0x28A1, 0x2081, 0x1041, 0x1020, 0x0820, 0x0800, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0800, 0x0820, 0x1041,
+    0x2061, 0x2881, 0x30E2, 0x4142, 0x51A2, 0x6223, 0xBBE2, 0xF5C4,
+    0xF5C4, 0xF5E5, 0xF6C9, 0xFEC9, 0xF6A9, 0xED03, 0xF4C2, 0xECA2,
+    0x30C1, 0x2881, 0x1841, 0x1020, 0x0820, 0x0000, 0x0020, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0020, 0x0800, 0x0820, 0x1020, 0x1041,
+    0x2061, 0x28A1, 0x38E2, 0x4142, 0x6223, 0xDCC3, 0xF583, 0xF5C4,
+    0xFE24, 0xFF08, 0xF709, 0xF6C9, 0xFEC9, 0xF5C4, 0xECC2, 0xECA2,
+    0x4962, 0x2061, 0x1861, 0x1020, 0x0820, 0x0800, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0800, 0x1020, 0x1841,
+    0x2081, 0x28C1, 0x3902, 0x51A2, 0xD4A3, 0xF543, 0xF5A3, 0xF604,
+    0xF6E8, 0xFF6A, 0xFF09, 0xFF29, 0xF6C9, 0xF646, 0xF503, 0xF4C2,
+    0x7A21, 0x28A1, 0x2061, 0x1020, 0x0820, 0x0800, 0x0020, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x0800, 0x1020, 0x1041,
+    0x2881, 0x28A1, 0x3922, 0xCC21, 0xF503, 0xF543, 0xF5C4, 0xFE66,
+    0xFF6A, 0xFF4A, 0xF729, 0xFF09, 0xF6C9, 0xF6A9, 0xF503, 0xECA2,
+    0x9AE1, 0x2081, 0x1861, 0x1841, 0x0820, 0x0800, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0800, 0x1020, 0x1841,
+    0x2061, 0x28A1, 0x7242, 0xECC2, 0xED03, 0xF543, 0xF5C4, 0xF6A7,
+    0xFF4A, 0xFF6A, 0xFF09, 0xF6A9, 0xF6C9, 0xF6A9, 0xF543, 0xF4C2,
+    0xB381, 0x28A1, 0x2061, 0x1841, 0x0820, 0x0800, 0x0020, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0020, 0x0800, 0x0820, 0x1020, 0x1041,
+    0x2081, 0x30A1, 0xCC21, 0xF502, 0xF502, 0xF543, 0xF5C4, 0xF6C7,
+    0xFF4A, 0xFF08, 0xF645, 0xF5E4, 0xF646, 0xF6C9, 0xF583, 0xECC1,
+    0xCB82, 0x2081, 0x1861, 0x1841, 0x0820, 0x0800, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0020, 0x0800, 0x0000, 0x1020, 0x1041,
+    0x2081, 0x5141, 0xF4C1, 0xED02, 0xF543, 0xF543, 0xF5C3, 0xF604,
+    0xF685, 0xF645, 0xF624, 0xF5E3, 0xF5A3, 0xFEA7, 0xF5C4, 0xF4C1,
+    0xCC21, 0x28A1, 0x2061, 0x1841, 0x0820, 0x0800, 0x0020, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x1020, 0x1841,
+    0x2081, 0x9282, 0xF4C1, 0xF502, 0xF563, 0xF543, 0xF5A3, 0xF604,
+    0xF624, 0xF624, 0xF5E4, 0xF5C3, 0xF583, 0xF583, 0xF5E5, 0xECC1,
+    0xC401, 0x2881, 0x1861, 0x1841, 0x0820, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0800, 0x1020, 0x1041,
+    0x2061, 0xAB81, 0xECC1, 0xF502, 0xED02, 0xF543, 0xF583, 0xF5C3,
+    0xFDE4, 0xF604, 0xF5E3, 0xF5A3, 0xF583, 0xF563, 0xF543, 0xF502,
+    0xCC21, 0x28A1, 0x1861, 0x1841, 0x0820, 0x0800, 0x0820, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0020, 0x0800, 0x0820, 0x1020, 0x1041,
+    0x2061, 0xCC21, 0xF4C1, 0xF502, 0xF502, 0xF543, 0xF583, 0xF5A3,
+    0xF5C3, 0xF5C4, 0xF5C3, 0xF5A3, 0xF583, 0xED63, 0xF502, 0xF502,
+    0xB3E2, 0x2061, 0x1861, 0x1841, 0x0820, 0x0000, 0x0820, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0800, 0x1020, 0x1041,
+    0x1841, 0xC401, 0xF4C1, 0xED02, 0xF502, 0xF563, 0xF583, 0xDCA3,
+    0xAC43, 0x9BC3, 0x9323, 0xBC02, 0xF543, 0xF563, 0xF502, 0xF502,
+    0xB381, 0x2081, 0x2061, 0x1841, 0x0820, 0x0800, 0x0020, 0x0000,
+    0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0020, 0x0800, 0x0820, 0x1020, 0x1841,
+    0x2061, 0xCC21, 0xF4C1, 0xF502, 0xF502, 0xED43, 0xAB81, 0x6223,
+    0x7242, 0x7242, 0x7A42, 0x9B23, 0xF543, 0xF542, 0xF502, 0xF502,
+    0x7A81, 0x2081, 0x1041, 0x1020, 0x0820, 0x0000, 0x0800, 0x0020,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0020, 0x0000, 0x0020, 0x0000, 0x0800, 0x1020, 0x1041,
+    0x1861, 0xAB61, 0xF502, 0xF502, 0xF502, 0xD462, 0x51A2, 0x6223,
+    0x6223, 0x6223, 0x6223, 0x9323, 0xF543, 0xF542, 0xF502, 0xFD22,
+    0x4121, 0x2081, 0x1841, 0x1020, 0x0820, 0x0800, 0x0020, 0x0000,
+    0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0020, 0x0000, 0x0820, 0x0800, 0x1020, 0x1841,
+    0x1861, 0x7A62, 0xF502, 0xF502, 0xF502, 0x7A81, 0x5162, 0x51C2,
+    0x59A2, 0x51C2, 0x59A2, 0x9323, 0xF563, 0xF542, 0xF502, 0xAB81,
+    0x2881, 0x2061, 0x1041, 0x1020, 0x0820, 0x0800, 0x0820, 0x0000,
+    0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0020, 0x0000, 0x0020, 0x0800, 0x0820, 0x1020, 0x1841,
+    0x1861, 0x30C2, 0xECA1, 0xF502, 0xDCC3, 0x4122, 0x4962, 0x59C2,
+    0x51A2, 0x59C2, 0x51A2, 0xAB61, 0xF563, 0xF542, 0xDCC3, 0x4122,
+    0x28A1, 0x2881, 0x1041, 0x1020, 0x0820, 0x0800, 0x0820, 0x0000,
+    0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0020, 0x0000, 0x0820, 0x0800, 0x0820, 0x1020, 0x1041,
+    0x2061, 0x2081, 0x6A21, 0xBC02, 0x69A1, 0x40E2, 0x4962, 0x4962,
+    0x5162, 0x4962, 0x5162, 0xBC02, 0xF563, 0xF503, 0x51A2, 0x30C1,
+    0x2881, 0x2081, 0x1041, 0x1020, 0x0820, 0x0800, 0x0800, 0x0020,
+    0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0020, 0x0000, 0x0020, 0x0800, 0x0800, 0x0820, 0x1020, 0x1841,
+    0x1861, 0x2081, 0x28A1, 0x30C1, 0x40E2, 0x40E2, 0x4142, 0x6201,
+    0x69A1, 0x4962, 0x4962, 0xDCC3, 0xF503, 0x7A62, 0x30E2, 0x30A1,
+    0x2881, 0x2081, 0x1841, 0x1020, 0x1020, 0x0820, 0x0820, 0x0800,
+    0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0020, 0x0000, 0x0820, 0x0800, 0x0820, 0x0820, 0x1020, 0x1841,
+    0x1861, 0x2881, 0x2881, 0x30C1, 0x38E2, 0x40E2, 0x4142, 0xBC02,
+    0x4962, 0x5162, 0x51A2, 0xE522, 0x6201, 0x40E2, 0x30E2, 0x30C1,
+    0x28A1, 0x2061, 0x1041, 0x1841, 0x1020, 0x0820, 0x0800, 0x0820,
+    0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,
+    0x0000, 0x0020, 0x0000, 0x0800, 0x0820, 0x0820, 0x1020, 0x1841,
+    0x2061, 0x2081, 0x28A1, 0x30C1, 0x30E2, 0x40E2, 0x51A2, 0xF563,
+    0x5162, 0x4122, 0x51C2, 0x5162, 0x4102, 0x40E2, 0x30C1, 0x28A1,
+    0x28A1, 0x2081, 0x2061, 0x1841, 0x1020, 0x0820, 0x0800, 0x0820,
+    0x0800, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0020, 0x0800, 0x0820, 0x0800, 0x0820, 0x1020, 0x1020, 0x1841,
+    0x1861, 0x2881, 0x28A1, 0x30C1, 0x38E2, 0x40E2, 0xAB81, 0xF582,
+    0x6223, 0x4122, 0x4122, 0x40E2, 0x4102, 0x40E2, 0x30C1, 0x28C1,
+    0x28A1, 0x2061, 0x1861, 0x1841, 0x1020, 0x1020, 0x0820, 0x0800,
+    0x0820, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0020, 0x0000, 0x0820, 0x0800, 0x0820, 0x1020, 0x1841, 0x1041,
+    0x2061, 0x2061, 0x28A1, 0x30C1, 0x30E2, 0x4122, 0xE542, 0xF582,
+    0x9B23, 0x4122, 0x4142, 0x4102, 0x40E2, 0x4102, 0x38E2, 0x28A1,
+    0x2881, 0x2081, 0x2061, 0x1841, 0x1020, 0x1020, 0x0820, 0x0820,
+    0x0800, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000,
+    0x0020, 0x0800, 0x0820, 0x0820, 0x1020, 0x1020, 0x1841, 0x2061,
+    0x1861, 0x28A1, 0x2881, 0x30C1, 0x38E2, 0x9B23, 0xF582, 0xF5A3,
+    0xE522, 0x4962, 0x4122, 0x4122, 0x40E2, 0x4102, 0x30E2, 0x28A1,
+    0x28A1, 0x2081, 0x2061, 0x1841, 0x1041, 0x1020, 0x1020, 0x0800,
+    0x0800, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000,
+    0x0020, 0x0800, 0x0800, 0x0820, 0x1020, 0x1841, 0x1041, 0x2061,
+    0x2081, 0x28A1, 0x28A1, 0x30C1, 0x38E2, 0xE522, 0xF5A2, 0xF5A2,
+    0xF5A2, 0x9B81, 0x4922, 0x4142, 0x4142, 0x40E2, 0x38E2, 0x30C1,
+    0x2881, 0x2081, 0x2081, 0x2061, 0x1841, 0x1020, 0x1020, 0x0820,
+    0x0800, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,
+    0x0800, 0x0820, 0x0820, 0x0820, 0x1020, 0x1841, 0x1841, 0x1861,
+    0x2881, 0x2881, 0x30C1, 0x38E2, 0x6221, 0xFDA2, 0xF5A2, 0xF5A2,
+    0xF5C3, 0xF5A2, 0x8B21, 0x4122, 0x4142, 0x40E2, 0x30E2, 0x30C1,
+    0x28A1, 0x28A1, 0x2081, 0x2061, 0x1841, 0x1041, 0x1020, 0x0820,
+    0x0800, 0x0800, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000,
+    0x0820, 0x0800, 0x0820, 0x1020, 0x1020, 0x1841, 0x1861, 0x2061,
+    0x28A1, 0x30A1, 0x30C1, 0x30E2, 0xBBE2, 0xF5C2, 0xF5C3, 0xF5E2,
+    0xF5E3, 0xF5E2, 0xF5E2, 0xBC02, 0x5162, 0x4942, 0x3902, 0x38E2,
+    0x30C1, 0x28A1, 0x2081, 0x1861, 0x2061, 0x1841, 0x1020, 0x0820,
+    0x0800, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000,
+    0x0020, 0x0800, 0x0820, 0x1020, 0x1841, 0x1841, 0x2061, 0x2081,
+    0x28A1, 0x30C1, 0x38E2, 0x3902, 0xE562, 0xF5C2, 0xF5E2, 0xFDE3,
+    0xF5E3, 0xF5E3, 0xF5E3, 0xF5E3, 0xDD02, 0x4962, 0x3902, 0x30E2,
+    0x30C1, 0x30A1, 0x28A1, 0x2081, 0x2061, 0x1041, 0x1020, 0x0820,
+    0x0820, 0x0800, 0x0800, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000,
+    0x0020, 0x0800, 0x0820, 0x1020, 0x1841, 0x1041, 0x2061, 0x2081,
+    0x30A1, 0x30C1, 0x30C2, 0x6201, 0xF5E2, 0xF5E2, 0xF5E2, 0xF603,
+    0xF603, 0xF5E3, 0xF603, 0xF603, 0xF602, 0xA3C3, 0x4142, 0x3902,
+    0x38E2, 0x30C1, 0x28A1, 0x2081, 0x2061, 0x1841, 0x1041, 0x1020,
+    0x0820, 0x0800, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0800, 0x0820,
+    0x0800, 0x0020, 0x0820, 0x1020, 0x1841, 0x2061, 0x2081, 0x2881,
+    0x30A1, 0x30E2, 0x3922, 0x9321, 0xF602, 0xF602, 0xFE02, 0xF603,
+    0xF603, 0xF5E3, 0xF603, 0xF603, 0xF602, 0xBCA2, 0x4122, 0x3902,
+    0x30E2, 0x30C1, 0x30A1, 0x2081, 0x2061, 0x1041, 0x1841, 0x1020,
+    0x0820, 0x0800, 0x0000, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000,
+    0x0800, 0x1020, 0x0820, 0x1020, 0x1041, 0x2061, 0x2081, 0x28A1,
+    0x30C1, 0x38E2, 0x3902, 0xAC23, 0xF603, 0xF602, 0xF603, 0xF623,
+    0xF603, 0xFE23, 0xF623, 0xF623, 0xFE02, 0x9BC3, 0x5162, 0x4142,
+    0x3902, 0x38E2, 0x9B81, 0x6221, 0x2881, 0x1861, 0x1841, 0x1020,
+    0x0820, 0x0800, 0x0820, 0x0000, 0x0820, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0820,
+    0x0800, 0x0820, 0x1020, 0x1841, 0x1041, 0x2061, 0x59C1, 0x6221,
+    0x38E2, 0x3902, 0x4142, 0xC4C2, 0xFE23, 0xF623, 0xF643, 0xF643,
+    0xFE43, 0xF643, 0xF643, 0xF622, 0xEE03, 0x6203, 0x4962, 0x4122,
+    0x3902, 0x72A2, 0xF5E2, 0x8B21, 0x2061, 0x1861, 0x1841, 0x1020,
+    0x1020, 0x0820, 0x0800, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0800,
+    0x0800, 0x0820, 0x1020, 0x1041, 0x1861, 0xAC43, 0xF5E2, 0xF5E2,
+    0xC4C2, 0x4122, 0x4122, 0xBCA2, 0xFE03, 0xF643, 0xF643, 0xF643,
+    0xFE64, 0xF664, 0xF664, 0xFE43, 0x8B83, 0x59C2, 0x51A2, 0x4962,
+    0x4122, 0x8B21, 0xFE02, 0x7282, 0x2081, 0x2061, 0x1041, 0x1020,
+    0x1020, 0x0820, 0x0820, 0x0800, 0x0020, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0800,
+    0x0820, 0x0820, 0x1020, 0x1841, 0x59C1, 0xF602, 0xF602, 0xF602,
+    0xF5E2, 0x9B81, 0x4962, 0xB443, 0xF643, 0xFE43, 0xF664, 0xF664,
+    0xF644, 0xFE64, 0xF644, 0xCD43, 0x6223, 0x6223, 0x51A2, 0x4962,
+    0x4122, 0x8323, 0xFE02, 0x51C1, 0x2881, 0x1861, 0x2061, 0x1841,
+    0x1020, 0x0820, 0x0800, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0820,
+    0x0800, 0x0820, 0x0820, 0x1021, 0x8B21, 0xF5E2, 0xF602, 0xF5E2,
+    0xFE02, 0xCD63, 0x4962, 0x8303, 0xF643, 0xFE44, 0xF664, 0xF683,
+    0xF684, 0xF684, 0xFEA4, 0xA3C3, 0x6223, 0x6223, 0x51A2, 0x59C2,
+    0x4962, 0x51A2, 0xE5A2, 0x38E2, 0x28A1, 0x2081, 0x2061, 0x1841,
+    0x1020, 0x0820, 0x0800, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0800,
+    0x1020, 0x1020, 0x1841, 0x1041, 0x9B81, 0xFE02, 0xF642, 0xF622,
+    0xF642, 0xE542, 0x4942, 0x51A2, 0xB443, 0xFE83, 0xF6A4, 0xF684,
+    0xFE84, 0xF684, 0xF684, 0xAC43, 0x6A82, 0x6203, 0x6223, 0x51A2,
+    0x5162, 0x4142, 0x3902, 0x30C1, 0x28A1, 0x2061, 0x2061, 0x1041,
+    0x1020, 0x0820, 0x0800, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0800,
+    0x0800, 0x1020, 0x1041, 0x1041, 0x9B61, 0xF622, 0xF622, 0xF622,
+    0xF642, 0xD563, 0x51A2, 0x6223, 0x72C3, 0xF684, 0xF684, 0xF6A4,
+    0xFEA4, 0xF6A4, 0xF6A4, 0xFEA4, 0xD563, 0x8323, 0x6223, 0x51C2,
+    0x4983, 0x4942, 0x3902, 0x30E2, 0x30A1, 0x2081, 0x2061, 0x1841,
+    0x1020, 0x0820, 0x0820, 0x0800, 0x0020, 0x0000, 0x0020, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0800, 0x0820,
+    0x0820, 0x1020, 0x1841, 0x1841, 0x8B21, 0xFE42, 0xCD63, 0xBCA2,
+    0xFE43, 0xAC43, 0x51A2, 0x6223, 0x9BC3, 0xFEA4, 0xFEA4, 0xF6C4,
+    0xFEE5, 0xF6C5, 0xFEC4, 0xF6C4, 0xF6A4, 0xFE84, 0xDDA2, 0xAC43,
+    0x8303, 0x4962, 0x3902, 0x38E2, 0x28A1, 0x2081, 0x2061, 0x1041,
+    0x1020, 0x0820, 0x0800, 0x0800, 0x0020, 0x0000, 0x0020, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0800, 0x0800,
+    0x0820, 0x1020, 0x1841, 0x1861, 0x6A82, 0xBCC2, 0x3902, 0x8303,
+    0xFE62, 0x8B21, 0x51A2, 0x6223, 0xCD43, 0xF6A4, 0xFEC4, 0xF6C5,
+    0xFF05, 0xF705, 0xFEE5, 0xF6C5, 0xFEC4, 0xF6A4, 0xF684, 0xFE83,
+    0xF683, 0xF643, 0xB443, 0x4142, 0x30A1, 0x28A1, 0x1861, 0x1841,
+    0x1841, 0x1020, 0x0820, 0x0820, 0x0800, 0x0020, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0820, 0x0800,
+    0x0820, 0x1020, 0x1841, 0x2061, 0x38E2, 0x30C1, 0x38E2, 0xC4C2,
+    0xEE43, 0x6201, 0x6223, 0x72C3, 0xFEA4, 0xFEC4, 0xFEE5, 0xF705,
+    0xF705, 0xFF05, 0xF705, 0xFF05, 0xFEE5, 0xF6C4, 0xF6A4, 0xF684,
+    0xFE63, 0xF683, 0xF642, 0xCD43, 0x3101, 0x2881, 0x1861, 0x1841,
+    0x1841, 0x1020, 0x0800, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0820, 0x0800,
+    0x0820, 0x1020, 0x1841, 0x1861, 0x2061, 0x28A1, 0x4122, 0xF643,
+    0xBCC2, 0x51A2, 0x6223, 0xCD43, 0xFEC4, 0xF6C5, 0xFF05, 0xF726,
+    0xFF06, 0xF726, 0xFF06, 0xF705, 0xFF05, 0xF6E5, 0xFEC4, 0xF6A4,
+    0xF683, 0xFE83, 0xF682, 0xFE62, 0x9B81, 0x2881, 0x2081, 0x2061,
+    0x1841, 0x1020, 0x0820, 0x0800, 0x0020, 0x0000, 0x0020, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0820, 0x0800,
+    0x0820, 0x1020, 0x1841, 0x2061, 0x28A1, 0x30C1, 0x8B21, 0xD563,
+    0x6223, 0x51A2, 0x8B83, 0xFEC4, 0xFEE5, 0xF705, 0xFF05, 0xF726,
+    0xFF46, 0xFF47, 0xFF46, 0xF706, 0xF705, 0xFF05, 0xFEE5, 0xF6A4,
+    0xF6A4, 0xF663, 0xF682, 0xF682, 0xE5A2, 0x28A1, 0x2061, 0x1861,
+    0x1841, 0x1020, 0x0820, 0x0800, 0x0000, 0x0020, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0820, 0x0800,
+    0x1020, 0x1020, 0x1041, 0x2061, 0x28A1, 0x38E2, 0x6223, 0x4183,
+    0x51A2, 0x6203, 0xDE02, 0xFEE5, 0xF6C5, 0xFF26, 0xF706, 0xFF46,
+    0xFF8D, 0xFFAF, 0xF746, 0xFF46, 0xFF26, 0xF705, 0xFEE5, 0xF6C4,
+    0xFEA4, 0xF6A4, 0xF683, 0xFE82, 0xFE82, 0x6221, 0x2081, 0x2061,
+    0x1841, 0x1020, 0x0820, 0x0800, 0x0820, 0x0000, 0x0020, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0800, 0x0820,
+    0x1020, 0x1041, 0x2061, 0x2081, 0x30A1, 0x30E2, 0x4942, 0x4983,
+    0x51C2, 0xD563, 0xFEE5, 0xFEE5, 0xF705, 0xFF06, 0xF746, 0xFF4A,
+    0xFFD4, 0xFFD4, 0xF78C, 0xFF46, 0xFF06, 0xF726, 0xF705, 0xFEC5,
+    0xF6C4, 0xFEA4, 0xF6A2, 0xF6C2, 0xF682, 0x9B61, 0x2061, 0x1861,
+    0x1041, 0x1020, 0x0820, 0x0800, 0x0820, 0x0000, 0x0020, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0000, 0x0800,
+    0x1020, 0x1041, 0x2061, 0x2081, 0x30C1, 0x3902, 0x4122, 0x4183,
+    0xAC43, 0xFEC5, 0xF6E5, 0xFF05, 0xF726, 0xFF46, 0xF747, 0xFFB2,
+    0xFFB5, 0xFFD5, 0xFFB4, 0xFF8D, 0xFF47, 0xF726, 0xFF05, 0xF6C5,
+    0xFEE5, 0xF6C4, 0xFEC3, 0xFEC2, 0xF682, 0xC4C2, 0x28A1, 0x1861,
+    0x1841, 0x1020, 0x0820, 0x0820, 0x0800, 0x0020, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0820, 0x0820,
+    0x1020, 0x1841, 0x2081, 0x28A1, 0x30C1, 0x3902, 0x49A3, 0xB443,
+    0xFEE4, 0xFEE5, 0xF705, 0xFF26, 0xF707, 0xFF47, 0xFFAF, 0xFFD5,
+    0xFFB5, 0xFFD5, 0xFFB5, 0xFFD5, 0xFF94, 0xFFB0, 0xF707, 0xF705,
+    0xFF05, 0xF6E5, 0xF6A4, 0xFEC3, 0xF6A2, 0xCD63, 0x2881, 0x1841,
+    0x1041, 0x1020, 0x0820, 0x0800, 0x0820, 0x0000, 0x0020, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0800, 0x0820,
+    0x1020, 0x1041, 0x20A1, 0x28A1, 0x30C2, 0x6223, 0xCD43, 0xF6C4,
+    0xFEC5, 0xF705, 0xFF26, 0xF727, 0xFF47, 0xFF4A, 0xFFB5, 0xFFD5,
+    0xFFB5, 0xFFD5, 0xFFB5, 0xFFD5, 0xF7B5, 0xFF95, 0xFFD2, 0xFF07,
+    0xF705, 0xFEE5, 0xF6C4, 0xFEC3, 0xFEC2, 0xE5A2, 0x28E1, 0x2081,
+    0x1841, 0x1020, 0x0820, 0x0820, 0x0800, 0x0020, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0820, 0x0820,
+    0x1020, 0x2061, 0x2081, 0x28E1, 0x59C1, 0xF683, 0xFEE4, 0xF6E5,
+    0xFF05, 0xF726, 0xFF07, 0xFF47, 0xF749, 0xFFB4, 0xFFD5, 0xFFB5,
+    0xFFD6, 0xFFB5, 0xFFD5, 0xFFB5, 0xFFD5, 0xFF95, 0xFF95, 0xF74E,
+    0xFF26, 0xF705, 0xFEE4, 0xF6C4, 0xF6C3, 0xE602, 0x20C1, 0x1881,
+    0x2061, 0x1041, 0x1020, 0x0800, 0x0020, 0x0000, 0x0020, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0820, 0x1020,
+    0x1841, 0x1881, 0x18C1, 0x28C1, 0xCD43, 0xF6C4, 0xFEE4, 0xF705,
+    0xFF26, 0xF707, 0xFF47, 0xF748, 0xFFB0, 0xFFB6, 0xFFB6, 0xFFD6,
+    0xFFB6, 0xFFD6, 0xFFB6, 0xFFD6, 0xFFD5, 0xFF95, 0xFFB5, 0xFF94,
+    0xF727, 0xFF05, 0xF705, 0xFF04, 0xFEC3, 0xDE03, 0x28E1, 0x18A1,
+    0x2081, 0x1841, 0x1020, 0x0820, 0x0800, 0x0020, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0820, 0x0820, 0x1020,
+    0x1841, 0x2081, 0x20C1, 0x59C1, 0xFEE3, 0xFF04, 0xF705, 0xFF26,
+    0xF707, 0xFF47, 0xFF48, 0xFF8D, 0xFFD6, 0xFFD6, 0xFFB6, 0xFFD7,
+    0xFFB7, 0xFFD7, 0xFFB7, 0xFFD6, 0xFFB6, 0xFFB6, 0xFF96, 0xFF95,
+    0xF74E, 0xF726, 0xFF05, 0xF6E4, 0xFF04, 0xCD43, 0x20C1, 0x18C1,
+    0x2081, 0x1041, 0x1020, 0x0820, 0x0800, 0x0020, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0820, 0x1020,
+    0x1080, 0x1881, 0x20C1, 0x9423, 0xFF04, 0xFEE4, 0xF705, 0xF726,
+    0xFF27, 0xFF48, 0xF74A, 0xFFB5, 0xFFD6, 0xFFB7, 0xFFD7, 0xFFB7,
+    0xFFD7, 0xFFD7, 0xFFD7, 0xFFB7, 0xFFD7, 0xFFB6, 0xFFB6, 0xFFB6,
+    0xFF94, 0xF727, 0xFF26, 0xFF05, 0xFF04, 0xB503, 0x3122, 0x28E1,
+    0x20A1, 0x1841, 0x0840, 0x0820, 0x0820, 0x0000, 0x0020, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x0820, 0x0840,
+    0x18A0, 0x20A1, 0x28E1, 0xDE03, 0xFF04, 0xF705, 0xFF26, 0xFF26,
+    0xF747, 0xFF48, 0xFFB0, 0xFFB6, 0xFFD7, 0xFFB7, 0xFFD7, 0xFFD8,
+    0xFFD8, 0xFFD8, 0xFFD7, 0xF7D7, 0xFFD7, 0xFFB7, 0xFFD6, 0xFF96,
+    0xFF95, 0xFF69, 0xF726, 0xF705, 0xFEE4, 0x8B63, 0x3101, 0x28E1,
+    0x1881, 0x1080, 0x1020, 0x0820, 0x0800, 0x0020, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0820, 0x0820, 0x0840,
+    0x1080, 0x18C1, 0x3982, 0xF703, 0xFF04, 0xF705, 0xFF26, 0xFF47,
+    0xF748, 0xFF4A, 0xFFB6, 0xFFD7, 0xFFB7, 0xFFD8, 0xFFD8, 0xFFD8,
+    0xFFD8, 0xFFD8, 0xFFD8, 0xFFD8, 0xFFD8, 0xFFD7, 0xFFB6, 0xFFD6,
+    0xFFD5, 0xFF4A, 0xFF46, 0xFF26, 0xFF25, 0x6223, 0x3921, 0x28E1,
+    0x20C1, 0x18A0, 0x0840, 0x0840, 0x0000, 0x0020, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0820, 0x0860, 0x1080,
+    0x18A0, 0x20C1, 0x62A3, 0xFF23, 0xFF44, 0xFF26, 0xF746, 0xFF48,
+    0xFF49, 0xFF8D, 0xFFD7, 0xFFD7, 0xFFD8, 0xFFD8, 0xFFD8, 0xFFD9,
+    0xFFD9, 0xFFF9, 0xFFD9, 0xFFD8, 0xFFD8, 0xFFD7, 0xFFD7, 0xFFD6,
+    0xFFB6, 0xF74C, 0xFF47, 0xFF46, 0xEEC5, 0x4183, 0x3162, 0x28C1,
+    0x18C1, 0x18A0, 0x1841, 0x0840, 0x0020, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0020, 0x0820, 0x0020, 0x0840, 0x1060,
+    0x18A0, 0x18C1, 0x7BC4, 0xF703, 0xFF44, 0xF745, 0xFF47, 0xFF48,
+    0xF749, 0xFFB0, 0xFFD7, 0xFFD8, 0xFFD8, 0xFFD9, 0xFFF9, 0xFFDA,
+    0xFFFA, 0xFFDA, 0xFFFA, 0xFFD9, 0xFFD8, 0xFFD8, 0xFFD7, 0xFFB7,
+    0xFFD6, 0xFF6A, 0xFF47, 0xFF66, 0xC5C5, 0x4983, 0x3962, 0x28E1,
+    0x20C1, 0x2081, 0x1080, 0x0820, 0x0020, 0x0020, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0840, 0x0840, 0x1080,
+    0x18A0, 0x28E1, 0x9C43, 0xFF44, 0xFF45, 0xFF46, 0xFF47, 0xFF48,
+    0xFF6A, 0xFFB0, 0xFFD7, 0xFFD8, 0xFFD9, 0xFFF9, 0xFFDA, 0xFFFB,
+    0xFFDB, 0xFFFB, 0xFFDA, 0xFFFA, 0xFFD9, 0xFFD8, 0xFFD8, 0xFFD7,
+    0xF7D4, 0xFF49, 0xFF48, 0xF746, 0xB503, 0x4183, 0x3162, 0x3122,
+    0x20C1, 0x1881, 0x1060, 0x0840, 0x0020, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0840, 0x0840, 0x1080,
+    0x1881, 0x20C1, 0xB4E3, 0xFF44, 0xF745, 0xFF46, 0xFF47, 0xFF69,
+    0xF74A, 0xFFB0, 0xFFD8, 0xFFD8, 0xFFF9, 0xFFDA, 0xFFDB, 0xFFFC,
+    0xFFDC, 0xFFFC, 0xFFFB, 0xFFDB, 0xFFFA, 0xFFD9, 0xFFD8, 0xFFD7,
+    0xFFD2, 0xFF89, 0xFF48, 0xFF67, 0x9465, 0x49E3, 0x3962, 0x2922,
+    0x20C1, 0x2081, 0x1080, 0x0820, 0x0840, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0020, 0x0820, 0x0840, 0x0840, 0x1080,
+    0x20C1, 0x2901, 0xB503, 0xFF44, 0xFF45, 0xFF46, 0xFF48, 0xFF89,
+    0xFFAB, 0xFFB0, 0xFFD8, 0xFFD9, 0xFFFA, 0xFFDB, 0xFFFC, 0xFFFD,
+    0xFFFD, 0xFFFD, 0xFFFD, 0xFFDB, 0xFFFA, 0xFFD9, 0xFFD8, 0xFFD8,
+    0xF7D2, 0xFF8A, 0xFF88, 0xF747, 0x9465, 0x41E3, 0x3162, 0x3122,
+    0x18C1, 0x2081, 0x1060, 0x0840, 0x0840, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0840, 0x0840, 0x1060,
+    0x20C1, 0x20E1, 0x9CC4, 0xFF44, 0xF765, 0xFF66, 0xFF88, 0xF789,
+    0xFFAB, 0xFFB0, 0xFFD8, 0xFFD9, 0xFFFA, 0xFFDB, 0xFFFD, 0xFFFE,
+    0xFFFE, 0xFFFE, 0xFFFD, 0xFFFC, 0xFFDB, 0xFFFA, 0xFFD8, 0xFFD8,
+    0xFFB2, 0xFFAA, 0xFF89, 0xFFA8, 0xA4C4, 0x49E3, 0x3962, 0x2922,
+    0x20C1, 0x18A0, 0x1060, 0x0840, 0x0020, 0x0020, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0840, 0x0840, 0x1080,
+    0x20C1, 0x2901, 0x9C43, 0xFF44, 0xFF65, 0xFF86, 0xFF88, 0xFF89,
+    0xF78B, 0xFFAF, 0xFFD8, 0xFFF9, 0xFFDA, 0xFFFC, 0xFFFD, 0xFFFE,
+    0xFFFE, 0xFFFE, 0xFFFD, 0xFFFC, 0xFFDB, 0xFFDA, 0xFFD8, 0xFFD8,
+    0xFFD4, 0xFF8A, 0xF789, 0xFF88, 0xDE45, 0x41E3, 0x3162, 0x3122,
+    0x18C1, 0x18A0, 0x1060, 0x0840, 0x0020, 0x0020, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0840, 0x0840, 0x1080,
+    0x20C1, 0x20E1, 0x6B64, 0xFF65, 0xFF65, 0xF766, 0xF788, 0xFFAA,
+    0xFF8B, 0xFF8D, 0xFFD8, 0xFFF9, 0xFFDA, 0xFFDC, 0xFFFD, 0xFFFE,
+    0xFFFE, 0xFFFE, 0xFFFD, 0xFFFC, 0xFFFB, 0xFFDA, 0xFFD8, 0xFFD8,
+    0xFFD6, 0xFF8B, 0xFF89, 0xFF88, 0xFF86, 0xA4C4, 0x3962, 0x2922,
+    0x20C1, 0x18A0, 0x1080, 0x0840, 0x0820, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0840, 0x0840, 0x1080,
+    0x20C1, 0x2901, 0x5262, 0xFF85, 0xFF86, 0xFF87, 0xFF88, 0xFF8A,
+    0xFFAB, 0xFFAD, 0xFFD8, 0xFFF9, 0xFFDA, 0xFFFB, 0xFFFC, 0xFFFD,
+    0xFFFE, 0xFFFD, 0xFFFD, 0xFFDC, 0xFFDB, 0xFFFA, 0xFFD8, 0xFFD8,
+    0xFFD7, 0xF78D, 0xFF89, 0xFF88, 0xF766, 0xFF65, 0x6303, 0x2101,
+    0x20C1, 0x10A0, 0x1060, 0x0840, 0x0020, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0840, 0x0840, 0x1080,
+    0x1080, 0x18C1, 0x3162, 0xFF65, 0xFF66, 0xFF87, 0xF788, 0xFFAA,
+    0xFF8B, 0xF7CD, 0xFFD8, 0xFFD8, 0xFFDA, 0xFFFB, 0xFFDB, 0xFFDC,
+    0xFFFD, 0xFFFD, 0xFFFC, 0xFFFB, 0xFFDA, 0xFFF9, 0xFFD8, 0xFFD8,
+    0xFFF7, 0xFFB0, 0xFF89, 0xFF88, 0xFF66, 0xFF86, 0x9C43, 0x2901,
+    0x18C1, 0x18A0, 0x1080, 0x0840, 0x0820, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x0840, 0x0840, 0x1080,
+    0x18A0, 0x20C1, 0x2101, 0xEEC5, 0xFF86, 0xFF87, 0xFF88, 0xFF89,
+    0xFF8B, 0xF78D, 0xFFD7, 0xFFD8, 0xFFF9, 0xFFDA, 0xFFFB, 0xFFDB,
+    0xFFFB, 0xFFDB, 0xFFFB, 0xFFDA, 0xFFF9, 0xFFD8, 0xFFD8, 0xFFF7,
+    0xFFD7, 0xFFB5, 0xFF8B, 0xF788, 0xFF86, 0xFF66, 0x9CC4, 0x20E1,
+    0x20C1, 0x10A0, 0x0840, 0x0840, 0x0020, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x0840, 0x1080,
+    0x1080, 0x18C1, 0x20E1, 0xCE26, 0xF786, 0xFF87, 0xFF88, 0xF789,
+    0xFF8B, 0xFFAF, 0xFFD7, 0xFFD8, 0xFFD8, 0xFFF9, 0xFFDA, 0xFFFA,
+    0xFFDB, 0xFFFA, 0xFFDA, 0xFFFA, 0xFFD9, 0xFFD8, 0xFFD8, 0xFFD7,
+    0xFFD6, 0xFFB6, 0xFFD4, 0xFF89, 0xFF86, 0xFF86, 0xA4C4, 0x2101,
+    0x2081, 0x1080, 0x1060, 0x0020, 0x0820, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0840, 0x0840,
+    0x18A0, 0x20C1, 0x2901, 0xB565, 0xFF86, 0xFF87, 0xFF88, 0xFF89,
+    0xFFAA, 0xFFB2, 0xF7D7, 0xFFD8, 0xFFD8, 0xFFF9, 0xFFD9, 0xFFF9,
+    0xFFDA, 0xFFFA, 0xFFD9, 0xFFF9, 0xFFD8, 0xFFD8, 0xFFD7, 0xFFD7,
+    0xFFB6, 0xFFD6, 0xFFB5, 0xFF8C, 0xF766, 0xFF86, 0x9423, 0x18C1,
+    0x1880, 0x1080, 0x0840, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0840, 0x0840,
+    0x1060, 0x10A0, 0x18A1, 0xA4C4, 0xF766, 0xFF87, 0xFF88, 0xF789,
+    0xFF8B, 0xFFD6, 0xFFD7, 0xFFD7, 0xFFD8, 0xFFD8, 0xFFD8, 0xFFF9,
+    0xFFD9, 0xFFD8, 0xFFD8, 0xFFF8, 0xFFD8, 0xFFD7, 0xFFD7, 0xFFB7,
+    0xFFD6, 0xFFB6, 0xFFD5, 0xFF8D, 0xFFA7, 0xFF86, 0x83C4, 0x20C1,
+    0x18A0, 0x1080, 0x0840, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0820, 0x0020, 0x0840,
+    0x1080, 0x18A0, 0x20C1, 0x9C43, 0xFF86, 0xFF87, 0xFF88, 0xFF88,
+    0xFFCD, 0xFFD6, 0xFFB6, 0xFFD7, 0xFFD7, 0xFFD8, 0xFFD8, 0xFFD8,
+    0xFFF8, 0xFFD8, 0xFFD8, 0xFFD8, 0xFFD7, 0xF7D7, 0xFFD7, 0xFFB6,
+    0xFFD6, 0xFFD5, 0xFFD5, 0xFF8C, 0xFF87, 0xF766, 0x5AA3, 0x1881,
+    0x1060, 0x0840, 0x0840, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0840,
+    0x0840, 0x0880, 0x1080, 0x7364, 0xFF86, 0xFF87, 0xF787, 0xFF88,
+    0xFFB0, 0xFFD6, 0xFFB6, 0xFFD6, 0xFFD7, 0xF7D7, 0xFFD7, 0xFFD7,
+    0xFFD7, 0xFFD7, 0xFFD7, 0xFFD7, 0xFFD7, 0xFFB7, 0xFFD6, 0xFFD6,
+    0xFFD6, 0xFFB5, 0xFFD5, 0xFF89, 0xFFA7, 0xFF86, 0x3162, 0x18A0,
+    0x1080, 0x1040, 0x0020, 0x0820, 0x0020, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x0840,
+    0x0840, 0x1080, 0x18A0, 0x62A3, 0xFF86, 0xFFA7, 0xFF87, 0xFF88,
+    0xFFB0, 0xFFD6, 0xFFB6, 0xFFD6, 0xFFB6, 0xFFD7, 0xFFD7, 0xFFD7,
+    0xF7D7, 0xFFD7, 0xFFD7, 0xFFF7, 0xF7D7, 0xFFD6, 0xFFD6, 0xFFF6,
+    0xFFD6, 0xFFB5, 0xFFB2, 0xFF87, 0xF787, 0xE6C6, 0x1881, 0x10A0,
+    0x0840, 0x0840, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,
+    0x0840, 0x0840, 0x0860, 0x39C2, 0xFF87, 0xF787, 0xFF87, 0xFF88,
+    0xFFB0, 0xFFD5, 0xFFB6, 0xFFD6, 0xFFB6, 0xFFD6, 0xFFD6, 0xFFD7,
+    0xFFD7, 0xFFD7, 0xFFD7, 0xFFD6, 0xFFD6, 0xFFD6, 0xFFB6, 0xFFD6,
+    0xFFB5, 0xFFD5, 0xFFCD, 0xFF87, 0xFF87, 0xA4C4, 0x18A0, 0x1080,
+    0x0840, 0x0840, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0820,
+    0x0020, 0x1040, 0x1080, 0x20C1, 0xFF86, 0xFF87, 0xFF87, 0xFFA7,
+    0xFFAF, 0xFFD5, 0xFFD5, 0xFFB6, 0xFFD6, 0xFFB6, 0xFFD6, 0xFFD6,
+    0xFFD6, 0xFFF6, 0xFFD6, 0xFFD6, 0xFFD6, 0xFFB6, 0xFFD6, 0xFFB5,
+    0xFFD5, 0xF7B4, 0xFF88, 0xFF87, 0xF787, 0x4A42, 0x1060, 0x0840,
+    0x0840, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,
+    0x0020, 0x0820, 0x0840, 0x0860, 0xC626, 0xFF87, 0xF7A7, 0xFFA7,
+    0xFFAB, 0xFFD6, 0xFFB5, 0xFFD6, 0xFFD6, 0xFFD6, 0xFFF6, 0xFFD6,
+    0xFFF6, 0xFFD6, 0xFFF6, 0xFFD6, 0xFFD6, 0xFFD5, 0xFFB5, 0xFFD5,
+    0xFFD5, 0xFFAD, 0xFFA7, 0xFFA7, 0xEEC6, 0x18A0, 0x1080, 0x0840,
+    0x0840, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0820, 0x0020, 0x0840, 0x0840, 0x9C65, 0xFFC7, 0xFFA7, 0xFFA7,
+    0xFFA8, 0xFFD4, 0xFFD6, 0xFFD5, 0xFFD6, 0xFFB6, 0xFFD5, 0xFFB2,
+    0xFFD4, 0xFFD6, 0xFFD6, 0xFFD6, 0xFFD6, 0xFFB6, 0xFFD6, 0xFFF6,
+    0xF7D4, 0xFFA8, 0xFFA7, 0xFFA7, 0x9423, 0x0860, 0x0840, 0x0020,
+    0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0020, 0x0800, 0x0020, 0x0840, 0x41E3, 0xFFA7, 0xF7A7, 0xFFA7,
+    0xFFA7, 0xFFAF, 0xFFF6, 0xFFD6, 0xFFD6, 0xFFD5, 0xF7AD, 0xFFC9,
+    0xFFAA, 0xFFB2, 0xFFB6, 0xFFD6, 0xFFB6, 0xFFD6, 0xFFB5, 0xFFD5,
+    0xFFCB, 0xFFA7, 0xFFC7, 0xF767, 0x2901, 0x0840, 0x0840, 0x0020,
+    0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0020, 0x0020, 0x0840, 0x0840, 0xEEE6, 0xFFA7, 0xFFA7,
+    0xFFA7, 0xFFC9, 0xFFD4, 0xFFD6, 0xFFD5, 0xF7B0, 0xFFA8, 0xEF48,
+    0xF788, 0xFFCB, 0xFFD4, 0xFFD6, 0xFFF6, 0xFFD6, 0xFFD5, 0xFFAF,
+    0xF7A8, 0xFFA7, 0xFFA7, 0x6B64, 0x0840, 0x0820, 0x0820, 0x0000,
+    0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x7364, 0xFFA7, 0xF7A7,
+    0xFFA7, 0xFFA8, 0xFFAF, 0xFFF6, 0xFFB2, 0xFFA9, 0xFFC9, 0x5AA3,
+    0xA4A4, 0xFFC9, 0xFFAC, 0xFFD5, 0xFFD5, 0xFFD6, 0xFFAF, 0xFFA8,
+    0xFFA8, 0xFFC8, 0x9465, 0x1080, 0x0840, 0x0840, 0x0000, 0x0020,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0020, 0x0020, 0x0020, 0x1040, 0xCE46, 0xFFA7,
+    0xFFA8, 0xFFA8, 0xFFA8, 0xFFCC, 0xFFC9, 0xFFA8, 0xC606, 0x20C1,
+    0x49E3, 0xFFC9, 0xFFC9, 0xFFCD, 0xFFB2, 0xFFCD, 0xFFA8, 0xF7A8,
+    0xFFA8, 0x9CA4, 0x0820, 0x0800, 0x0840, 0x0020, 0x0820, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x3182, 0xEF47,
+    0xFFA8, 0xFFA8, 0xFFA8, 0xFFA8, 0xFFA8, 0xFFC8, 0x83C4, 0x18C1,
+    0x18A1, 0xDEC8, 0xFFA8, 0xFFA8, 0xFFA8, 0xFFA8, 0xFFA8, 0xFFC8,
+    0x9465, 0x1060, 0x1020, 0x0840, 0x0820, 0x0020, 0x0000, 0x0020,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0840, 0x4182,
+    0xEF48, 0xFFC9, 0xFFC9, 0xFFA9, 0xFFC9, 0xFFA9, 0x2942, 0x1881,
+    0x2081, 0x9465, 0xFFC9, 0xFFC9, 0xFFC9, 0xFFC9, 0xF788, 0x7364,
+    0x0040, 0x0820, 0x0820, 0x0020, 0x0800, 0x0020, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0000, 0x0020,
+    0x2902, 0xC5A5, 0xFFC9, 0xFFC9, 0xFFC9, 0xCE26, 0x1041, 0x1841,
+    0x1021, 0x2902, 0xEF68, 0xFFC9, 0xFFC9, 0xCDC5, 0x39A2, 0x1020,
+    0x0820, 0x0020, 0x0820, 0x0000, 0x0020, 0x0000, 0x0020, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0800,
+    0x0820, 0x0020, 0x5262, 0xBD65, 0xDEC8, 0x5AA3, 0x1020, 0x1020,
+    0x1020, 0x1020, 0x41E2, 0x9465, 0x41C2, 0x0820, 0x0820, 0x0800,
+    0x0020, 0x0020, 0x0000, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000,
+    0x0020, 0x0000, 0x0820, 0x0800, 0x0820, 0x0820, 0x1020, 0x0820,
+    0x0820, 0x0820, 0x1020, 0x0820, 0x0820, 0x0820, 0x0800, 0x0020,
+    0x0800, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020,
+    0x0000, 0x0020, 0x0000, 0x0820, 0x0800, 0x0820, 0x0000, 0x0820,
+    0x0800, 0x0820, 0x0000, 0x0820, 0x0000, 0x0820, 0x0000, 0x0820,
+    0x0000, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,
+    0x0000, 0x0020, 0x0000, 0x0020, 0x0800, 0x0020, 0x0800, 0x0020,
+    0x0800, 0x0020, 0x0800, 0x0020, 0x0800, 0x0820, 0x0000, 0x0020,
+    0x0000, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0020, 0x0000, 0x0020, 0x0800, 0x0020, 0x0000, 0x0020, 0x0800,
+    0x0820, 0x0000, 0x0820, 0x0000, 0x0020, 0x0000, 0x0020, 0x0800,
+    0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0800, 0x0020, 0x0000,
+    0x0020, 0x0800, 0x0020, 0x0000, 0x0020, 0x0000, 0x0020, 0x0000,
+    0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0000, 0x0020, 0x0000,
+    0x0020, 0x0000, 0x0020, 0x0000, 0x0020, 0x0000, 0x0020, 0x0000,
+    0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0000, 0x0020, 0x0000,
+    0x0020, 0x0000, 0x0020, 0x0000, 0x0020, 0x0000, 0x0020, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000,
+    0x0020, 0x0000, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 },
+  { 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,
+    0x0000, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020,
+    0x0000, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0000, 0x0020,
+    0x0000, 0x0820, 0x0000, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0020, 0x0000, 0x0020, 0x0000, 0x0820, 0x0000, 0x0020,
+    0x0800, 0x0820, 0x0000, 0x0820, 0x0800, 0x0020, 0x0000, 0x0020,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0020, 0x0000, 0x0820, 0x0800, 0x0820, 0x0800,
+    0x0820, 0x0000, 0x0820, 0x0800, 0x0020, 0x0800, 0x0020, 0x0000,
+    0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0020, 0x0000, 0x0820, 0x0800, 0x1020, 0x0820,
+    0x0820, 0x0820, 0x0820, 0x0820, 0x0800, 0x0820, 0x0000, 0x0020,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,
+    0x0000, 0x0020, 0x0800, 0x0820, 0x0800, 0x0820, 0x0820, 0x1020,
+    0x0820, 0x0820, 0x0820, 0x1020, 0x0820, 0x0820, 0x0800, 0x0020,
+    0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0020, 0x0800, 0x0820, 0x0820, 0x0820, 0x1020, 0x1020, 0x1020,
+    0x1020, 0x1020, 0x1020, 0x1020, 0x0820, 0x0820, 0x0800, 0x0820,
+    0x0800, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000,
+    0x0820, 0x0800, 0x0820, 0x0820, 0x1020, 0x1020, 0x1041, 0x1841,
+    0x1841, 0x1841, 0x1041, 0x1841, 0x1020, 0x1020, 0x0820, 0x0800,
+    0x0820, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000,
+    0x0820, 0x0800, 0x0820, 0x1020, 0x1041, 0x1841, 0x1841, 0x1861,
+    0x2061, 0x2061, 0x1041, 0x1841, 0x1841, 0x1020, 0x1020, 0x0820,
+    0x0820, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820,
+    0x0800, 0x0820, 0x1020, 0x1841, 0x1841, 0x1861, 0x2061, 0x2081,
+    0x2081, 0x2861, 0x1861, 0x2061, 0x1841, 0x1041, 0x1020, 0x0820,
+    0x0800, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0800,
+    0x0820, 0x1020, 0x1020, 0x1041, 0x2061, 0x2061, 0x2081, 0x2881,
+    0x28A1, 0x2881, 0x2081, 0x28A1, 0x2061, 0x1841, 0x1841, 0x1020,
+    0x0820, 0x0800, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0800,
+    0x0820, 0x1020, 0x1841, 0x2061, 0x2081, 0x28A1, 0x2881, 0x30A1,
+    0x28C1, 0x5141, 0xB282, 0x5141, 0x2081, 0x1861, 0x1841, 0x1841,
+    0x1020, 0x0800, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0800,
+    0x1020, 0x1041, 0x2061, 0x2081, 0x28A1, 0x28A1, 0x30C1, 0x30E2,
+    0xAA62, 0xE383, 0xEB83, 0x38E2, 0x28A1, 0x2081, 0x2061, 0x1841,
+    0x1020, 0x0820, 0x0800, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0800, 0x0820,
+    0x1020, 0x1841, 0x2061, 0x2081, 0x28A1, 0x30C1, 0x3902, 0xBB22,
+    0xEBE3, 0xE3C3, 0xE383, 0x4142, 0x28A1, 0x28A1, 0x1861, 0x1841,
+    0x1041, 0x1020, 0x0800, 0x0800, 0x0020, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0800, 0x1020,
+    0x1020, 0x2061, 0x2061, 0x28A1, 0x30C1, 0x30E2, 0x8A82, 0xE3C3,
+    0xEBE3, 0xE3C3, 0xEBE3, 0x69C1, 0x38E2, 0x28A1, 0x2881, 0x1861,
+    0x1841, 0x1020, 0x0820, 0x0800, 0x0020, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0800, 0x0820, 0x1020,
+    0x1041, 0x2061, 0x2081, 0x30A1, 0x30E2, 0x5162, 0xEBE3, 0xEC24,
+    0xEC24, 0xE424, 0xEC24, 0x8A82, 0x3902, 0x28C1, 0x28A1, 0x2061,
+    0x1841, 0x1020, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0800, 0x0820, 0x1020,
+    0x1041, 0x2081, 0x2881, 0x30E2, 0x3902, 0xB322, 0xE424, 0xEC24,
+    0xEC24, 0xEC24, 0xEC24, 0xCBA2, 0x4142, 0x38E2, 0x28A1, 0x2081,
+    0x2061, 0x1841, 0x0820, 0x0820, 0x0800, 0x0020, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x0820, 0x1841,
+    0x2061, 0x2081, 0x30A1, 0x38E2, 0x6221, 0xEC24, 0xEC24, 0xEC84,
+    0xEC84, 0xEC84, 0xEC24, 0xE424, 0x51A2, 0x3902, 0x30C1, 0x28A1,
+    0x1861, 0x1841, 0x1020, 0x0800, 0x0020, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0800, 0x1020, 0x1841,
+    0x1861, 0x2881, 0x30C1, 0x3102, 0xCBA2, 0xEC24, 0xEC84, 0xEC84,
+    0xEC84, 0xEC84, 0xEC84, 0xEC63, 0x9282, 0x4942, 0x38E2, 0x2881,
+    0x2081, 0x1841, 0x1020, 0x0820, 0x0820, 0x0000, 0x0020, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0020, 0x0800, 0x0820, 0x1020, 0x1041,
+    0x2061, 0x28A1, 0x38E2, 0x7A42, 0xEC24, 0xEC84, 0xEC84, 0xECE4,
+    0xECE4, 0xF4C4, 0xECE4, 0xEC84, 0xCB82, 0x4122, 0x3902, 0x28A1,
+    0x2081, 0x1041, 0x1020, 0x0820, 0x0800, 0x0020, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0800, 0x1020, 0x1041,
+    0x2081, 0x28A1, 0x3902, 0xCB82, 0xEC63, 0xEC84, 0xECE4, 0xED25,
+    0xF505, 0xED05, 0xECE4, 0xF4E4, 0xEC63, 0x59C2, 0x4102, 0x30C1,
+    0x2081, 0x2061, 0x1020, 0x0820, 0x0820, 0x0000, 0x0020, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0020, 0x0800, 0x0820, 0x1020, 0x1841,
+    0x2881, 0x30C1, 0x69A1, 0xEC44, 0xEC84, 0xECE4, 0xF505, 0xED44,
+    0xF544, 0xED44, 0xF525, 0xECE4, 0xEC84, 0x7242, 0x4122, 0x30C2,
+    0x28A1, 0x2061, 0x1041, 0x0820, 0x0800, 0x0000, 0x0020, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0020, 0x0800, 0x0820, 0x1020, 0x1861,
+    0x2061, 0x30C1, 0x8A62, 0xEC63, 0xEC84, 0xECE4, 0xF544, 0xEDA6,
+    0xF5C4, 0xF5A6, 0xF544, 0xF525, 0xEC84, 0x9B23, 0x4142, 0x38E2,
+    0x28A1, 0x2061, 0x1841, 0x0820, 0x0800, 0x0020, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0020, 0x0000, 0x0820, 0x0820, 0x1841, 0x2061,
+    0x28A1, 0x30C1, 0xB322, 0xEC63, 0xF4E4, 0xED05, 0xF544, 0xF5C4,
+    0xF605, 0xF605, 0xED84, 0xED05, 0xECE4, 0xCB82, 0x4122, 0x30E2,
+    0x2881, 0x1861, 0x1841, 0x1020, 0x0800, 0x0020, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0020, 0x0000, 0x0800, 0x0820, 0x1841, 0x1861,
+    0x28A1, 0x30C2, 0xB322, 0xEC84, 0xECE4, 0xED05, 0xF5C4, 0xF5E5,
+    0xF645, 0xF5E5, 0xF5C4, 0xF544, 0xF4E4, 0xEC44, 0x4142, 0x38E2,
+    0x28A1, 0x2061, 0x1841, 0x1020, 0x0820, 0x0000, 0x0020, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0020, 0x0800, 0x0820, 0x1841, 0x2061,
+    0x28A1, 0x38E2, 0x9282, 0xECA4, 0xECE4, 0xF544, 0xF5C4, 0xF645,
+    0xF685, 0xF625, 0xF5C4, 0xF544, 0xECC4, 0xECC2, 0x51A2, 0x30C2,
+    0x30A1, 0x1861, 0x1841, 0x1020, 0x0820, 0x0000, 0x0020, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0020, 0x0000, 0x0800, 0x0820, 0x1841, 0x1861,
+    0x28A1, 0x30C2, 0x51A2, 0xEC84, 0xECE4, 0xF544, 0xF5A4, 0xF645,
+    0xF685, 0xF666, 0xF5C4, 0xF544, 0xF503, 0xF4C2, 0x6221, 0x38E2,
+    0x30C1, 0x1861, 0x1841, 0x0820, 0x0800, 0x0820, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0020, 0x0800, 0x0820, 0x1841, 0x2061,
+    0x28A1, 0x38E2, 0x4142, 0x9B23, 0xF4E4, 0xF544, 0xCCA4, 0x9CA4,
+    0xC5A5, 0xF645, 0xF5C4, 0xF544, 0xED03, 0xF4C2, 0x6201, 0x30C2,
+    0x28A1, 0x1861, 0x1841, 0x1020, 0x0820, 0x0000, 0x0020, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0020, 0x0800, 0x0820, 0x1841, 0x1861,
+    0x2881, 0x30C1, 0x4142, 0x51A2, 0xBBE2, 0xCCA4, 0x8B83, 0x9423,
+    0xA4C4, 0xDD85, 0xF5C4, 0xF564, 0xED03, 0xF4C2, 0x69A1, 0x38E2,
+    0x28A1, 0x2061, 0x1841, 0x1020, 0x0800, 0x0020, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0020, 0x0000, 0x0820, 0x0820, 0x1020, 0x2061,
+    0x28A1, 0x30C1, 0x3902, 0x5162, 0x6223, 0x7AC3, 0x8323, 0x8B83,
+    0x9C43, 0xAC43, 0xF583, 0xF544, 0xED03, 0xF4C2, 0x4942, 0x30E2,
+    0x2881, 0x1861, 0x1841, 0x0820, 0x0800, 0x0020, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0020, 0x0800, 0x0820, 0x1020, 0x1841,
+    0x2081, 0x30C1, 0x3902, 0x4962, 0x59A2, 0x6284, 0x72C3, 0x8B83,
+    0x8B83, 0x9BC3, 0xF583, 0xF543, 0xF503, 0xD462, 0x4122, 0x38E2,
+    0x28A1, 0x2061, 0x1841, 0x0820, 0x0820, 0x0000, 0x0020, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0020, 0x0000, 0x0820, 0x0820, 0x1020, 0x1841,
+    0x2081, 0x30A1, 0x3902, 0x5162, 0x51C2, 0x6223, 0x7AC3, 0x8323,
+    0x8323, 0x8303, 0xF544, 0xF503, 0xED03, 0x9323, 0x3902, 0x30C1,
+    0x2081, 0x2061, 0x1020, 0x0820, 0x0000, 0x0000, 0x0020, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0020, 0x0800, 0x0820, 0x1020, 0x1041,
+    0x2081, 0x30A1, 0x38E2, 0x4122, 0x51A2, 0x6223, 0x6223, 0x7AC3,
+    0x72C3, 0x72C3, 0xD4C3, 0xF503, 0xECA2, 0x5162, 0x3922, 0x30A1,
+    0x2081, 0x1841, 0x1020, 0x0820, 0x0800, 0x0020, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x0800, 0x1020, 0x1841,
+    0x1861, 0x28A1, 0x38E2, 0x3902, 0x5162, 0x59C2, 0x6223, 0x6223,
+    0x6284, 0x6223, 0xBC02, 0xECA2, 0x6223, 0x4122, 0x30E2, 0x30A1,
+    0x2081, 0x1841, 0x1020, 0x0820, 0x0000, 0x0000, 0x0020, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0800, 0x1020, 0x1841,
+    0x1861, 0x28A1, 0x30A1, 0x4962, 0x9323, 0xD462, 0x9B23, 0x6223,
+    0x6223, 0x6223, 0x6223, 0x6221, 0x5162, 0x3902, 0x30C1, 0x28A1,
+    0x2061, 0x1841, 0x1020, 0x0800, 0x0820, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0020, 0x0800, 0x0820, 0x1020, 0x1041,
+    0x2061, 0x28A1, 0x9282, 0xECA1, 0xF4C2, 0xECA2, 0xC401, 0x51A2,
+    0x51A2, 0x59C2, 0x51A2, 0x5162, 0x4142, 0x38E2, 0x30C1, 0x2061,
+    0x1861, 0x1841, 0x1020, 0x0800, 0x0020, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0020, 0x0800, 0x0800, 0x1020, 0x1041,
+    0x30E2, 0xC382, 0xEC81, 0xE4A1, 0xF4A2, 0xECC2, 0xECA2, 0x5162,
+    0x51C2, 0x5162, 0x4962, 0x4142, 0x40E2, 0x38E2, 0x30A1, 0x2081,
+    0x2061, 0x1020, 0x0820, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0020, 0x0000, 0x0820, 0x0800, 0x0820, 0x1861,
+    0xCC21, 0xEC61, 0xEC61, 0xECA1, 0xF4C2, 0xECA2, 0xE482, 0x4962,
+    0x4962, 0x5162, 0x4122, 0x4142, 0x38E2, 0x30C1, 0x2881, 0x2081,
+    0x1041, 0x1020, 0x0820, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0020, 0x0000, 0x0020, 0x0800, 0x0000, 0x0820, 0x7201,
+    0xEC61, 0xEC61, 0xECC1, 0xF4C1, 0xECC1, 0xF4C2, 0xB381, 0x4122,
+    0x4942, 0x4122, 0x4142, 0x4102, 0x38E2, 0x28A1, 0x2881, 0x1861,
+    0x1841, 0x1020, 0x0820, 0x0800, 0x0020, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0020, 0x0000, 0x0820, 0x0800, 0x0820, 0x1020, 0xB381,
+    0xEC61, 0xF4C1, 0xF646, 0xECC1, 0xF4C1, 0x9AE1, 0x38E2, 0x40E2,
+    0x3902, 0x40E2, 0x4102, 0x30E2, 0x30C1, 0x28A1, 0x2061, 0x2061,
+    0x1841, 0x1020, 0x0820, 0x0800, 0x0020, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0020, 0x0000, 0x0020, 0x0000, 0x0800, 0x0820, 0x0820, 0xAB61,
+    0xECA1, 0xF583, 0xF646, 0xF5C4, 0xF4C1, 0x7AA1, 0x4102, 0x40E2,
+    0x4102, 0x40E2, 0x38E2, 0x30C1, 0x28A1, 0x28A1, 0x2081, 0x2061,
+    0x1841, 0x1020, 0x0820, 0x0800, 0x0020, 0x0000, 0x0020, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0020, 0x0000, 0x0820, 0x0800, 0x0820, 0x0820, 0x1020, 0x69C1,
+    0xECA1, 0xFE05, 0xF646, 0xF646, 0xF4C1, 0x9AE1, 0x30C2, 0x30E2,
+    0x40E2, 0x30E2, 0x38E2, 0x30C1, 0x30C1, 0x2081, 0x1861, 0x1841,
+    0x1841, 0x1020, 0x0820, 0x0800, 0x0000, 0x0020, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,
+    0x0000, 0x0020, 0x0800, 0x0800, 0x0820, 0x0820, 0x1020, 0x1841,
+    0xE4A1, 0xF5E5, 0xFEC7, 0xF5C4, 0xF4C1, 0xD462, 0x38E2, 0x38E2,
+    0x30E2, 0x38E2, 0x30C1, 0x30A1, 0x2881, 0x2081, 0x2061, 0x1841,
+    0x1020, 0x1020, 0x0820, 0x0820, 0x0000, 0x0020, 0x0000, 0x0020,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000,
+    0x0820, 0x0000, 0x0820, 0x0820, 0x0820, 0x1020, 0x1020, 0x1841,
+    0xB381, 0xF502, 0xF5C4, 0xF502, 0xF502, 0xF4C1, 0x4962, 0x30E2,
+    0x30E2, 0x30C1, 0x30C1, 0x30A1, 0x28A1, 0x2061, 0x2061, 0x1041,
+    0x1020, 0x1020, 0x0820, 0x0800, 0x0820, 0x0000, 0x0020, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,
+    0x0800, 0x0020, 0x0800, 0x0820, 0x1020, 0x1020, 0x1041, 0x1041,
+    0x6201, 0xF4C1, 0xF4C1, 0xF502, 0xF502, 0xBC02, 0x7A21, 0x38E2,
+    0x38E2, 0x30C1, 0x30C1, 0x28A1, 0x2881, 0x2881, 0x1861, 0x1841,
+    0x1841, 0x1020, 0x0820, 0x0820, 0x0800, 0x0020, 0x0000, 0x0020,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020,
+    0x0800, 0x0820, 0x0820, 0x0820, 0x1020, 0x1020, 0x1841, 0x2061,
+    0x28A1, 0xECA1, 0xF502, 0xF502, 0xD442, 0x30C2, 0x30E2, 0x38E2,
+    0x30E2, 0x30C1, 0x30C1, 0x30A1, 0x28A1, 0x2081, 0x2061, 0x1861,
+    0x1841, 0x1020, 0x0820, 0x0800, 0x0800, 0x0020, 0x0000, 0x0020,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0000,
+    0x0820, 0x0800, 0x0820, 0x1020, 0x1020, 0x1841, 0x1841, 0x1861,
+    0x2061, 0x7A81, 0xF521, 0xF521, 0x7A42, 0x38E2, 0x30E2, 0x38E2,
+    0x38E2, 0x30C1, 0x30C1, 0x30A1, 0x28A1, 0x2061, 0x2081, 0x2061,
+    0x1041, 0x1020, 0x1020, 0x0820, 0x0820, 0x0800, 0x0820, 0x0000,
+    0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0820,
+    0x0800, 0x0820, 0x0820, 0x1020, 0x1841, 0x1841, 0x2061, 0x2081,
+    0x2081, 0x30A1, 0xBC02, 0xBC02, 0x30C2, 0x38E2, 0x38E2, 0x38E2,
+    0x30E2, 0x40E2, 0x30C1, 0x30C1, 0x30C1, 0x28A1, 0x2061, 0x1861,
+    0x1841, 0x1841, 0x1020, 0x0820, 0x0820, 0x0800, 0x0820, 0x0000,
+    0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0820,
+    0x0800, 0x0820, 0x1020, 0x1841, 0x1041, 0x2061, 0x2061, 0x2081,
+    0x28A1, 0x30A1, 0x30C1, 0x38E2, 0x30E2, 0x4102, 0x40E2, 0x3902,
+    0x40E2, 0x8281, 0xB381, 0x3922, 0x28A1, 0x2881, 0x2081, 0x2061,
+    0x2061, 0x1841, 0x1020, 0x0820, 0x0820, 0x0820, 0x0000, 0x0020,
+    0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0820, 0x0800,
+    0x0820, 0x1020, 0x1020, 0x1841, 0x2061, 0x1861, 0x2081, 0x28A1,
+    0x30A1, 0x30C1, 0x38E2, 0x3902, 0x3922, 0x3902, 0x4942, 0x4142,
+    0x3902, 0x6A21, 0xF542, 0xD4E1, 0x51A2, 0x28A1, 0x28A1, 0x2061,
+    0x2061, 0x1841, 0x1041, 0x1020, 0x0820, 0x1020, 0x0800, 0x0020,
+    0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0820, 0x0800,
+    0x0820, 0x1020, 0x1841, 0x1041, 0x2061, 0x2061, 0x28A1, 0x28C1,
+    0x30C1, 0x38E2, 0x4102, 0x3902, 0x4142, 0x4122, 0x4142, 0x4122,
+    0x4122, 0x6201, 0xF582, 0xF582, 0xF542, 0x7A42, 0x28A1, 0x2061,
+    0x2081, 0x2061, 0x1841, 0x1020, 0x0820, 0x0820, 0x0820, 0x0800,
+    0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0820, 0x0800, 0x0020,
+    0x0820, 0x1020, 0x1841, 0x1841, 0x2061, 0x2081, 0x2881, 0x30C1,
+    0x38E2, 0x3902, 0x3922, 0x4142, 0x4922, 0x4962, 0x5162, 0x4962,
+    0x5162, 0x9B23, 0xF5A2, 0xF5A2, 0xF582, 0xF582, 0x7242, 0x2881,
+    0x2061, 0x1861, 0x2061, 0x1041, 0x1020, 0x0820, 0x0800, 0x0820,
+    0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0800, 0x0800, 0x0820,
+    0x1020, 0x1020, 0x1041, 0x2061, 0x2081, 0x28A1, 0x28A1, 0x38E2,
+    0x38E2, 0x3902, 0x4142, 0x5162, 0x4962, 0x5162, 0x4962, 0x4962,
+    0x6201, 0xE542, 0xF5A2, 0xF5A2, 0xF5A2, 0xF5A2, 0xF582, 0x6A01,
+    0x2081, 0x2081, 0x2061, 0x1841, 0x1020, 0x0820, 0x0820, 0x0800,
+    0x0820, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0820, 0x0800, 0x0820,
+    0x1020, 0x1841, 0x1841, 0x1861, 0x2881, 0x28A1, 0x30C1, 0x38E2,
+    0x3902, 0x4142, 0x5162, 0x4962, 0x59A2, 0x51C2, 0x59A2, 0x8323,
+    0xE5A2, 0xF5E2, 0xF5C2, 0xF5C2, 0xF5C2, 0xF5A2, 0xF5A2, 0xE542,
+    0x4121, 0x2061, 0x1861, 0x1841, 0x1020, 0x1020, 0x0820, 0x0800,
+    0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0020, 0x0800, 0x0020, 0x0800, 0x0820,
+    0x1020, 0x3901, 0x1861, 0x2061, 0x28A1, 0x28C1, 0x38E2, 0x3902,
+    0x4122, 0x8303, 0xBCA2, 0xC4C2, 0xBCA2, 0xBCC2, 0xE5A2, 0xF5E3,
+    0xF603, 0xF603, 0xF5E2, 0xF5E2, 0xF5C2, 0xF5C2, 0xF5C2, 0xF5A2,
+    0xC402, 0x2081, 0x2061, 0x1041, 0x1841, 0x1020, 0x0820, 0x0820,
+    0x0800, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0020, 0x0800, 0x0820, 0x0820, 0x1020,
+    0x3921, 0x7282, 0x1861, 0x2061, 0x28A1, 0x30C1, 0x38E2, 0x3902,
+    0xB443, 0xF5E2, 0xFE03, 0xF603, 0xF603, 0xF623, 0xF603, 0xF623,
+    0xFE03, 0xF603, 0xF5E3, 0xF5E3, 0xF5E2, 0xF5E2, 0xF5C2, 0xF5C2,
+    0xF5A2, 0x51C1, 0x2061, 0x1861, 0x1841, 0x1020, 0x0820, 0x0800,
+    0x0000, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0800, 0x0820, 0x1020,
+    0x51C1, 0xE542, 0x6A21, 0x28C1, 0x30A1, 0x30E2, 0x3902, 0x9361,
+    0xF5E2, 0xF602, 0xF602, 0xFE23, 0xF603, 0xF643, 0xF643, 0xFE43,
+    0xF643, 0xF623, 0xF624, 0xF603, 0xF603, 0xF5E2, 0xF5E2, 0xF5C2,
+    0xFDC2, 0x9B81, 0x2081, 0x2061, 0x1841, 0x1020, 0x0820, 0x0800,
+    0x0020, 0x0800, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0020, 0x0000, 0x0820, 0x0800, 0x0820, 0x1020,
+    0x4921, 0xF5A1, 0xF5C2, 0xAC43, 0x30C1, 0x30E2, 0x59C1, 0xFDE2,
+    0xF622, 0xF623, 0xF623, 0xFE43, 0xF643, 0xF644, 0xF664, 0xFE44,
+    0xF664, 0xF6C9, 0xF643, 0xFE03, 0xF602, 0xF602, 0xF5E2, 0xF5E2,
+    0xF5C2, 0xCCA1, 0x1861, 0x1861, 0x1841, 0x1841, 0x1020, 0x0800,
+    0x0800, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0800, 0x0820, 0x1020,
+    0x1041, 0x7282, 0x7282, 0x2881, 0x30C1, 0x30E2, 0x9BA3, 0xF602,
+    0xF603, 0xF643, 0xF643, 0xFE64, 0xF644, 0xF683, 0xF663, 0xF6A7,
+    0xFF31, 0xF6C9, 0xFE64, 0xF643, 0xF623, 0xF623, 0xFE02, 0xF602,
+    0xF5E2, 0xCCA1, 0x2881, 0x2881, 0x1861, 0x1841, 0x1020, 0x0820,
+    0x0820, 0x0800, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0020, 0x0000, 0x0020, 0x0800, 0x0820, 0x0820, 0x1020,
+    0x1841, 0x2061, 0x2081, 0x2881, 0x30C1, 0x3902, 0xE5C2, 0xFE23,
+    0xF623, 0xFE43, 0xF664, 0xF644, 0xFEA9, 0xF6CD, 0xFF31, 0xFF53,
+    0xF733, 0xF684, 0xF664, 0xFE44, 0xF643, 0xF623, 0xF603, 0xF602,
+    0xF5E2, 0xAC43, 0x2881, 0x2061, 0x1861, 0x1841, 0x1020, 0x0820,
+    0x0800, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0020, 0x0000, 0x0020, 0x0800, 0x0800, 0x0820, 0x1020,
+    0x1041, 0x2061, 0x2081, 0x30A1, 0x30E2, 0x51A1, 0xF603, 0xF643,
+    0xFE43, 0xF664, 0xF684, 0xF72E, 0xFF74, 0xFF74, 0xF774, 0xFF74,
+    0xFEED, 0xF684, 0xFE84, 0xF644, 0xF664, 0xF643, 0xFE23, 0xF602,
+    0xFE22, 0x8B21, 0x2881, 0x2081, 0x2061, 0x1041, 0x1020, 0x0820,
+    0x0820, 0x0800, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0020, 0x0800, 0x0820, 0x0800, 0x1020, 0x1020,
+    0x1041, 0x2061, 0x28A1, 0x30A1, 0x30E2, 0x8323, 0xFE42, 0xFE43,
+    0xF664, 0xF664, 0xFF4E, 0xFF74, 0xFF74, 0xF774, 0xFF74, 0xFF74,
+    0xF6E8, 0xF6A4, 0xFE84, 0xF683, 0xF644, 0xF643, 0xF643, 0xF622,
+    0xF622, 0x6201, 0x28A1, 0x2081, 0x2061, 0x1041, 0x1020, 0x0820,
+    0x0800, 0x0800, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0020, 0x0000, 0x0820, 0x0800, 0x1020, 0x1020,
+    0x2061, 0x1861, 0x2881, 0x30C1, 0x30E2, 0x9BA3, 0xF643, 0xF643,
+    0xFE83, 0xF6C9, 0xF774, 0xFF74, 0xFF74, 0xF794, 0xFFB4, 0xFF74,
+    0xFEE8, 0xF6C4, 0xFEA4, 0xF684, 0xF683, 0xF663, 0xF643, 0xFE42,
+    0xE5C2, 0x38E2, 0x28A1, 0x2881, 0x1861, 0x1841, 0x1020, 0x0820,
+    0x0800, 0x0820, 0x0800, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0020, 0x0000, 0x0820, 0x0800, 0x0820, 0x1020, 0x1041,
+    0x1841, 0x2061, 0x28A1, 0x30C1, 0x38E2, 0xAC43, 0xFE63, 0xF664,
+    0xFE83, 0xFF31, 0xF774, 0xFF74, 0xFF74, 0xFF94, 0xFF94, 0xF7B4,
+    0xFF4C, 0xF6E5, 0xFEC4, 0xF6A4, 0xF663, 0xF683, 0xF643, 0xFE43,
+    0x9BA3, 0x30C2, 0x28A1, 0x2081, 0x2061, 0x1041, 0x1020, 0x1020,
+    0x0800, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0020, 0x0000, 0x0020, 0x0800, 0x0820, 0x1020, 0x1020,
+    0x2061, 0x2061, 0x28A1, 0x30A1, 0x3902, 0xAC43, 0xF643, 0xF663,
+    0xF684, 0xFF53, 0xF774, 0xFF74, 0xFFB4, 0xF794, 0xFFB4, 0xFF94,
+    0xFF94, 0xFF4C, 0xF6E5, 0xFEA4, 0xF684, 0xF683, 0xFE83, 0xF643,
+    0x49A3, 0x30E2, 0x30A1, 0x2081, 0x2061, 0x1841, 0x1020, 0x1020,
+    0x0800, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0020, 0x0800, 0x0820, 0x0820, 0x1020, 0x1020,
+    0x2061, 0x2081, 0x2881, 0x30C1, 0x3902, 0xA3C3, 0xFEA3, 0xF683,
+    0xF6A4, 0xFF53, 0xFF74, 0xFF94, 0xFF94, 0xF7B4, 0xFF94, 0xFFD4,
+    0xFF94, 0xF774, 0xFEE5, 0xF6C4, 0xF6A4, 0xF684, 0xFE83, 0xAC23,
+    0x4122, 0x30E2, 0x30C1, 0x2061, 0x1861, 0x1841, 0x1020, 0x1020,
+    0x0800, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0020, 0x0000, 0x0800, 0x0820, 0x1020, 0x1841,
+    0x1861, 0x2081, 0x2881, 0x30C1, 0x3902, 0x8B01, 0xF683, 0xF6A4,
+    0xFEA4, 0xF74E, 0xF774, 0xFF94, 0xFFB4, 0xFF94, 0xF794, 0xFFD4,
+    0xFFB4, 0xFF94, 0xF705, 0xFEE5, 0xFEC4, 0xF6A4, 0xFE83, 0x7282,
+    0x4142, 0x4102, 0x30C1, 0x28A1, 0x1861, 0x1841, 0x1020, 0x1020,
+    0x0820, 0x0800, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0020, 0x0000, 0x0820, 0x0800, 0x0820, 0x1020, 0x1841,
+    0x2061, 0x2081, 0x28A1, 0x38E2, 0x3902, 0x6223, 0xFEC2, 0xFEC4,
+    0xF6C4, 0xFEE5, 0xFF74, 0xFF94, 0xF794, 0xFFB4, 0xFFD4, 0xFFB4,
+    0xF794, 0xFFB0, 0xF705, 0xFEE5, 0xF6C4, 0xF6A4, 0xCD43, 0x51A2,
+    0x4122, 0x3902, 0x30C1, 0x28A1, 0x2061, 0x1041, 0x1020, 0x1020,
+    0x0800, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0020, 0x0000, 0x0820, 0x0800, 0x0820, 0x1020, 0x1841,
+    0x1861, 0x2081, 0x30A1, 0x38E2, 0x4122, 0x4161, 0xCD43, 0xF6A4,
+    0xF6C4, 0xFEE5, 0xF708, 0xFF94, 0xF7B4, 0xFF94, 0xFFB4, 0xFFD4,
+    0xFF94, 0xF74C, 0xFF26, 0xF705, 0xFEE5, 0xFEC4, 0x9C43, 0x59C2,
+    0x4142, 0x4102, 0x30C1, 0x2881, 0x2081, 0x1841, 0x1020, 0x1020,
+    0x0820, 0x0800, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0020, 0x0800, 0x0820, 0x0820, 0x1020, 0x1041,
+    0x2061, 0x2081, 0x30A1, 0x38E2, 0x4142, 0x4983, 0x8323, 0xFEE4,
+    0xFEE5, 0xF705, 0xFF05, 0xFF4A, 0xFF94, 0xFFB5, 0xF795, 0xFFD5,
+    0xFF95, 0xFF6A, 0xF726, 0xF705, 0xFEC5, 0xFEE5, 0x7B03, 0x51A2,
+    0x4983, 0x3902, 0x30E2, 0x30A1, 0x2081, 0x1841, 0x1020, 0x0820,
+    0x0800, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0020, 0x0000, 0x0820, 0x0800, 0x0820, 0x1020, 0x1041,
+    0x2061, 0x28A1, 0x30C1, 0x3902, 0x4122, 0x4183, 0x51A2, 0xB503,
+    0xFEC5, 0xF705, 0xFF26, 0xFF06, 0xF74E, 0xF7B5, 0xFF95, 0xFFD4,
+    0xFF94, 0xFF47, 0xF706, 0xFF26, 0xFF05, 0xFEE5, 0x8323, 0x51C2,
+    0x4983, 0x4942, 0x30E2, 0x30A1, 0x2081, 0x2061, 0x1020, 0x0820,
+    0x0820, 0x0800, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0020, 0x0800, 0x0820, 0x0820, 0x1020, 0x1041,
+    0x2061, 0x28A1, 0x30C1, 0x3902, 0x4981, 0x59C2, 0x6223, 0x72C3,
+    0xFF05, 0xFF26, 0xFF26, 0xFF47, 0xFF48, 0xFF94, 0xFFD5, 0xFFD5,
+    0xF7B2, 0xFF47, 0xF707, 0xFF26, 0xF726, 0xFF05, 0x8B63, 0x51A2,
+    0x4183, 0x4142, 0x3902, 0x30A1, 0x2081, 0x1861, 0x1841, 0x1020,
+    0x0800, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0020, 0x0800, 0x0820, 0x0820, 0x1020, 0x1841,
+    0x1881, 0x28A1, 0x38E2, 0x3902, 0x4983, 0x51A2, 0x5A23, 0x6284,
+    0xF6E5, 0xFF27, 0xF707, 0xFF47, 0xFF47, 0xF7B0, 0xFFB5, 0xFF95,
+    0xFFAF, 0xFF47, 0xF747, 0xFF27, 0xFF26, 0xFF05, 0xBD03, 0x5224,
+    0x59C2, 0x49A3, 0x3902, 0x30C1, 0x18A1, 0x2061, 0x1841, 0x1020,
+    0x0820, 0x0800, 0x0020, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0020, 0x0000, 0x0020, 0x0800, 0x0820, 0x1841, 0x1841,
+    0x20A1, 0x28E1, 0x30E2, 0x4942, 0x4983, 0x51C2, 0x6223, 0x7AC3,
+    0xFF26, 0xFF27, 0xFF47, 0xF748, 0xFF48, 0xFFAF, 0xFFB6, 0xFFB5,
+    0xFF8D, 0xF748, 0xFF48, 0xFF47, 0xF707, 0xFF26, 0xEEC5, 0x6264,
+    0x51A2, 0x4983, 0x3922, 0x28E1, 0x28A1, 0x1881, 0x1841, 0x1020,
+    0x0820, 0x0800, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0020, 0x0000, 0x0020, 0x0800, 0x0820, 0x1041, 0x2061,
+    0x1881, 0x28E1, 0x3921, 0x4122, 0x4983, 0x5224, 0x6284, 0x8C45,
+    0xFF27, 0xFF47, 0xF748, 0xFF48, 0xFF49, 0xFFB0, 0xFFB6, 0xFFB6,
+    0xF78D, 0xFF69, 0xFF48, 0xFF48, 0xF747, 0xFF07, 0xFF26, 0xA4C4,
+    0x4A03, 0x4983, 0x4942, 0x2922, 0x28E1, 0x2081, 0x1080, 0x1020,
+    0x0820, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0020, 0x0820, 0x1020, 0x1841, 0x2081,
+    0x20C1, 0x28E1, 0x3921, 0x3982, 0x4A03, 0x5224, 0x6A84, 0xE645,
+    0xFF47, 0xFF68, 0xF749, 0xFF69, 0xFF4A, 0xFFB5, 0xFFD6, 0xFFB6,
+    0xF78D, 0xFF4A, 0xFF69, 0xFF49, 0xF748, 0xFF47, 0xFF27, 0xEEC5,
+    0x72A3, 0x4183, 0x3982, 0x3921, 0x28E1, 0x1881, 0x18A0, 0x1020,
+    0x0820, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0820, 0x0020, 0x1020, 0x1841, 0x1881,
+    0x20C1, 0x28E1, 0x3162, 0x4983, 0x49E3, 0x5224, 0x8C45, 0xFF47,
+    0xF748, 0xFF69, 0xFF49, 0xF74A, 0xFFAF, 0xFFD7, 0xFFB7, 0xFFD7,
+    0xFFAF, 0xFF6A, 0xFF4A, 0xF769, 0xFF49, 0xFF48, 0xFF47, 0xFF26,
+    0xE6C5, 0x7AC3, 0x4983, 0x3921, 0x28E1, 0x18C1, 0x2081, 0x1841,
+    0x0840, 0x0820, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0020, 0x0800, 0x0840, 0x1020, 0x1080, 0x1881,
+    0x28E1, 0x3122, 0x3162, 0x4983, 0x5A44, 0x6284, 0xE6C6, 0xFF68,
+    0xFF49, 0xFF6A, 0xFF4A, 0xFF8D, 0xFFD6, 0xFFD7, 0xFFD7, 0xF7D7,
+    0xFFB2, 0xFF8C, 0xF78C, 0xFF6A, 0xFF49, 0xFF69, 0xF748, 0xFF47,
+    0xFF26, 0xF705, 0xC5A5, 0x3182, 0x28C1, 0x18C1, 0x2081, 0x1080,
+    0x0840, 0x0020, 0x0820, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0820, 0x0820, 0x0840, 0x1080, 0x18A1,
+    0x28E1, 0x3122, 0x3982, 0x4183, 0x5224, 0xC5A5, 0xF747, 0xFF49,
+    0xFF69, 0xF74A, 0xFFAF, 0xFFB7, 0xFFD8, 0xFFD8, 0xFFD8, 0xFFD8,
+    0xFFD6, 0xFF8D, 0xFF8D, 0xFF8C, 0xF76A, 0xFF49, 0xFF48, 0xFF47,
+    0xFF46, 0xFF45, 0xF745, 0x83E4, 0x3122, 0x28E1, 0x18A0, 0x1080,
+    0x0840, 0x0840, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0020, 0x0020, 0x0840, 0x0840, 0x18A0, 0x20C1,
+    0x28E1, 0x3122, 0x3982, 0x4A03, 0x83C4, 0xFF67, 0xFF48, 0xFF69,
+    0xFF4A, 0xFFAF, 0xFFD7, 0xFFD8, 0xFFD8, 0xFFD8, 0xFFD8, 0xFFD8,
+    0xFFD8, 0xFFB0, 0xFFAF, 0xF78D, 0xFF8C, 0xFF4A, 0xFF69, 0xF748,
+    0xFF47, 0xFF45, 0xFF25, 0xBDA5, 0x2922, 0x28C1, 0x1881, 0x1080,
+    0x0840, 0x0840, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0020, 0x0000, 0x0020, 0x0840, 0x0840, 0x18A0, 0x18C1,
+    0x28E1, 0x3162, 0x3982, 0x5224, 0xDEC6, 0xFF47, 0xFF69, 0xF78A,
+    0xFFAF, 0xFFD7, 0xFFD8, 0xFFD8, 0xFFD9, 0xFFF9, 0xFFD9, 0xFFFA,
+    0xFFD9, 0xFFD8, 0xFFB0, 0xFF8D, 0xFF8C, 0xF78C, 0xFF6A, 0xFF48,
+    0xFF47, 0xFF46, 0xFF45, 0xF724, 0x3962, 0x2101, 0x20C1, 0x18A0,
+    0x0840, 0x0840, 0x0820, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0020, 0x0820, 0x0840, 0x1060, 0x18A0, 0x18C1,
+    0x2901, 0x3162, 0x3982, 0x9465, 0xFF86, 0xFF48, 0xFF69, 0xFF8C,
+    0xFFD7, 0xFFD8, 0xFFD8, 0xFFD9, 0xFFDA, 0xFFFB, 0xFFDB, 0xFFFB,
+    0xFFDA, 0xFFFA, 0xFFD9, 0xFFD2, 0xFF8D, 0xF78C, 0xFF8A, 0xFF69,
+    0xFF48, 0xF766, 0xFF65, 0xFF44, 0x4A62, 0x20E1, 0x18C1, 0x18A0,
+    0x0840, 0x0840, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0020, 0x0000, 0x0820, 0x0840, 0x1080, 0x10A0, 0x20C1,
+    0x20E1, 0x3162, 0x49E3, 0xE705, 0xFF66, 0xFF88, 0xF78A, 0xFFD5,
+    0xFFD7, 0xFFD8, 0xFFF9, 0xFFDA, 0xFFFB, 0xFFDB, 0xFFDC, 0xFFFC,
+    0xFFFB, 0xFFDB, 0xFFDA, 0xFFD8, 0xFFD4, 0xFF8D, 0xFFAB, 0xFF89,
+    0xFF88, 0xFF66, 0xFF85, 0xFF44, 0x7384, 0x2101, 0x20C1, 0x18A0,
+    0x0840, 0x0840, 0x0820, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0020, 0x0820, 0x0860, 0x1080, 0x18A0, 0x20C1,
+    0x2101, 0x3962, 0x9C43, 0xFF86, 0xFF88, 0xFF89, 0xFFAF, 0xFFD7,
+    0xFFD8, 0xFFD8, 0xFFD9, 0xFFDB, 0xFFFC, 0xFFFC, 0xFFFD, 0xFFFD,
+    0xFFDC, 0xFFDB, 0xFFFA, 0xFFD9, 0xFFF8, 0xFFD4, 0xF78C, 0xFF8A,
+    0xFF89, 0xF766, 0xFF46, 0xF745, 0x9423, 0x20E1, 0x20C1, 0x10A0,
+    0x1060, 0x0840, 0x0020, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0020, 0x0020, 0x0820, 0x0840, 0x1060, 0x10A0, 0x20C1,
+    0x2101, 0x3142, 0xE6A5, 0xF766, 0xFF88, 0xFF89, 0xF7D4, 0xFFD7,
+    0xFFD8, 0xFFD9, 0xFFFA, 0xFFDB, 0xFFDC, 0xFFFD, 0xFFFE, 0xFFFE,
+    0xFFFD, 0xFFFC, 0xFFFB, 0xFFDA, 0xFFD8, 0xFFD7, 0xFF8D, 0xFFAA,
+    0xFF89, 0xFF88, 0xFF66, 0xFF85, 0xA4C4, 0x2901, 0x20C1, 0x18A0,
+    0x1080, 0x0840, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0820, 0x0020, 0x0860, 0x1080, 0x18A0, 0x20C1,
+    0x2901, 0x5262, 0xFF85, 0xFF66, 0xFF88, 0xFFAB, 0xFFD6, 0xFFD7,
+    0xFFD8, 0xFFD9, 0xFFDA, 0xFFFB, 0xFFFD, 0xFFFE, 0xFFFE, 0xFFFE,
+    0xFFFE, 0xFFFC, 0xFFDB, 0xFFDA, 0xFFF9, 0xFFD8, 0xFFB0, 0xFF8B,
+    0xFF89, 0xF788, 0xFF86, 0xFF65, 0xAD45, 0x20E1, 0x18C1, 0x18A0,
+    0x1080, 0x0820, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0020, 0x0020, 0x0020, 0x0840, 0x1060, 0x18A0, 0x20C1,
+    0x2101, 0x7BC4, 0xF766, 0xFF87, 0xFF88, 0xF78C, 0xFFD7, 0xFFD7,
+    0xFFD8, 0xFFD9, 0xFFFA, 0xFFDB, 0xFFFD, 0xFFFE, 0xFFFE, 0xFFFE,
+    0xFFFE, 0xFFFC, 0xFFDB, 0xFFFA, 0xFFD9, 0xFFD8, 0xFFD2, 0xFF8B,
+    0xFF89, 0xFF88, 0xFF87, 0xFF86, 0xC5C5, 0x2901, 0x18C1, 0x18A0,
+    0x1080, 0x0840, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0820, 0x0020, 0x0840, 0x1080, 0x18A0, 0x20C1,
+    0x2901, 0xA4C4, 0xFF86, 0xFF87, 0xFF88, 0xFF8B, 0xFFD7, 0xFFD7,
+    0xFFD8, 0xFFD9, 0xFFFA, 0xFFDB, 0xFFFC, 0xFFFD, 0xFFFE, 0xFFFE,
+    0xFFFD, 0xFFFC, 0xFFDB, 0xFFDA, 0xFFD8, 0xFFD8, 0xFFD2, 0xF78B,
+    0xFF89, 0xFF88, 0xF787, 0xFF86, 0xC5A5, 0x20E1, 0x18C1, 0x10A0,
+    0x1080, 0x0820, 0x0020, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0020, 0x0020, 0x0840, 0x1060, 0x18A0, 0x18C1,
+    0x2101, 0xAD45, 0xFF66, 0xFF87, 0xF789, 0xFF8A, 0xFFD5, 0xFFD7,
+    0xFFD8, 0xFFF9, 0xFFDA, 0xFFFA, 0xFFDB, 0xFFDC, 0xFFFD, 0xFFFD,
+    0xFFFC, 0xFFFB, 0xFFDA, 0xFFD9, 0xFFD8, 0xFFD8, 0xFFD4, 0xFFAB,
+    0xFF89, 0xFF88, 0xFF87, 0xFF86, 0xB565, 0x2901, 0x20C1, 0x1080,
+    0x0840, 0x0840, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0020, 0x0820, 0x0840, 0x0840, 0x1080, 0x20C1,
+    0x2101, 0xB565, 0xFF86, 0xFF87, 0xFF88, 0xFF8A, 0xFFB0, 0xFFF7,
+    0xFFD8, 0xFFD8, 0xFFD9, 0xFFFA, 0xFFDB, 0xFFFB, 0xFFDB, 0xFFFB,
+    0xFFDB, 0xFFFB, 0xFFDA, 0xFFF9, 0xFFD8, 0xFFD7, 0xFFD4, 0xFF8B,
+    0xF789, 0xFF88, 0xFF87, 0xF786, 0xA4A4, 0x18C1, 0x1080, 0x1080,
+    0x0840, 0x0840, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0020, 0x0000, 0x0020, 0x0840, 0x0840, 0x1060, 0x18A0,
+    0x18A1, 0xB503, 0xF787, 0xFF87, 0xFF88, 0xF7AA, 0xFFAC, 0xFFD7,
+    0xFFD7, 0xFFD8, 0xFFD8, 0xFFD9, 0xFFFA, 0xFFDA, 0xFFFB, 0xFFDB,
+    0xFFFA, 0xFFDA, 0xFFF9, 0xFFD8, 0xFFD8, 0xFFD7, 0xF7B2, 0xFFAA,
+    0xFF89, 0xFFA8, 0xFF87, 0xFF86, 0x9C43, 0x20C1, 0x18A0, 0x1080,
+    0x0840, 0x0840, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0020, 0x0840, 0x0840, 0x1080, 0x18A0,
+    0x20C1, 0x9465, 0xFFA7, 0xFF87, 0xFFA8, 0xFF89, 0xFF8A, 0xFFD4,
+    0xFFD7, 0xFFD8, 0xFFD8, 0xFFF9, 0xFFD9, 0xFFFA, 0xFFDA, 0xFFFA,
+    0xFFD9, 0xFFF9, 0xFFD8, 0xFFD8, 0xFFD7, 0xF7D7, 0xFFB2, 0xFFAA,
+    0xFF89, 0xF7A8, 0xFFA7, 0xFF87, 0x6303, 0x18C1, 0x1080, 0x1080,
+    0x0840, 0x0840, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0020, 0x0840, 0x0840, 0x1080, 0x1080,
+    0x18C1, 0x6303, 0xFF87, 0xFF87, 0xF7A8, 0xFF89, 0xFFAA, 0xFFAD,
+    0xF7F7, 0xFFD7, 0xFFD8, 0xFFD8, 0xFFF8, 0xFFD9, 0xFFF9, 0xFFD9,
+    0xFFF9, 0xFFD8, 0xFFF8, 0xFFD8, 0xFFD7, 0xFFD7, 0xFFB0, 0xFFAA,
+    0xFF89, 0xFFA8, 0xFFA7, 0xFFA7, 0x41E2, 0x18A0, 0x1060, 0x1080,
+    0x0840, 0x0020, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0820, 0x0020, 0x0840, 0x0840, 0x1080,
+    0x18A0, 0x3962, 0xFFA7, 0xFF87, 0xFFA8, 0xFFA8, 0xFF8A, 0xFFAB,
+    0xFFD4, 0xFFD7, 0xFFD7, 0xFFD8, 0xFFD8, 0xFFD8, 0xF7D4, 0xFFB0,
+    0xFFD5, 0xFFD8, 0xFFD8, 0xFFD7, 0xFFD7, 0xF7D7, 0xFFAF, 0xFFAA,
+    0xFFA8, 0xF7A8, 0xFFA7, 0xE707, 0x18A1, 0x1080, 0x1080, 0x0840,
+    0x0840, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0840, 0x0840, 0x1080,
+    0x1080, 0x18A1, 0xC626, 0xFFA7, 0xFFA8, 0xFFA8, 0xF7C9, 0xFF8A,
+    0xFFAF, 0xFFF7, 0xF7D7, 0xFFD7, 0xFFF8, 0xFFD6, 0xFFAF, 0xFFAF,
+    0xFFAF, 0xFFF6, 0xFFD7, 0xFFF7, 0xFFD6, 0xFFD6, 0xFFAF, 0xFFC9,
+    0xFFA8, 0xFFA8, 0xFFC7, 0xB565, 0x20C1, 0x18A0, 0x1080, 0x0840,
+    0x0840, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0840, 0x0840, 0x1060,
+    0x1080, 0x18A0, 0x6B23, 0xFFA7, 0xFFA8, 0xFFA8, 0xFFC9, 0xFFCA,
+    0xFFCB, 0xFFD4, 0xFFD6, 0xFFD7, 0xFFD7, 0xF7B0, 0xFFAD, 0xFFCD,
+    0xFFAD, 0xF7B0, 0xFFD7, 0xFFD7, 0xFFD6, 0xFFD6, 0xFFCC, 0xFFC9,
+    0xFFA8, 0xF7A8, 0xFFA7, 0x6303, 0x1080, 0x1060, 0x0840, 0x0840,
+    0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0840, 0x0840,
+    0x1080, 0x1080, 0x18A1, 0xC626, 0xFFA8, 0xFFA8, 0xFFA9, 0xF7C9,
+    0xFFAA, 0xFFAD, 0xFFD6, 0xFFD7, 0xFFD6, 0xFFAC, 0xFFCC, 0xAD49,
+    0xDECB, 0xF7CC, 0xFFB2, 0xFFF6, 0xFFD6, 0xFFD6, 0xFFC9, 0xFFC9,
+    0xFFA8, 0xFFA8, 0xEF07, 0x20C1, 0x1080, 0x1080, 0x0840, 0x0840,
+    0x0820, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0840, 0x0820,
+    0x0840, 0x1080, 0x18A0, 0x62A3, 0xFFC8, 0xFFA8, 0xFFC9, 0xFFC9,
+    0xFFA9, 0xFFCA, 0xFFB0, 0xFFD6, 0xFFD4, 0xF7CB, 0xDECB, 0x5224,
+    0x9445, 0xFFCB, 0xFFCB, 0xFFD2, 0xFFD6, 0xFFD2, 0xF7C9, 0xFFA9,
+    0xFFA8, 0xFFA8, 0x7BC4, 0x1080, 0x0880, 0x0840, 0x0840, 0x0020,
+    0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0840,
+    0x0840, 0x1080, 0x1060, 0x1080, 0xBDA5, 0xFFA8, 0xFFC9, 0xFFA9,
+    0xF7C9, 0xFFC9, 0xFFCB, 0xFFB0, 0xFFCD, 0xFFCB, 0xAD49, 0x49E3,
+    0x5224, 0xFFAA, 0xF7CA, 0xFFCB, 0xFFAF, 0xFFAD, 0xFFC9, 0xFFA8,
+    0xFFA8, 0xE6E6, 0x20C1, 0x1080, 0x1040, 0x0840, 0x0840, 0x0020,
+    0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0820,
+    0x0840, 0x0840, 0x1080, 0x18A0, 0x3162, 0xF768, 0xFFC9, 0xFFC9,
+    0xFFC9, 0xFFA9, 0xFFCA, 0xFFCA, 0xFFCA, 0xF7CA, 0x7BC4, 0x3982,
+    0x3982, 0xD668, 0xFFEA, 0xFFCA, 0xFFC9, 0xFFA9, 0xFFC9, 0xFFA9,
+    0xF7A8, 0x6303, 0x0860, 0x1060, 0x0840, 0x0840, 0x0020, 0x0820,
+    0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,
+    0x0840, 0x0840, 0x0840, 0x1060, 0x0860, 0x5AA3, 0xF788, 0xF7A9,
+    0xFFC9, 0xFFA9, 0xFFC9, 0xFFCA, 0xFFCA, 0xFFEA, 0x5262, 0x3162,
+    0x3142, 0xA4A4, 0xFFCA, 0xFFCA, 0xFFC9, 0xFFA9, 0xFFC9, 0xFFC9,
+    0xB565, 0x1080, 0x1080, 0x0840, 0x0840, 0x0820, 0x0020, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,
+    0x0820, 0x0840, 0x0820, 0x0840, 0x1080, 0x1080, 0x7364, 0xFFC9,
+    0xFFC9, 0xFFC9, 0xFFC9, 0xFFCA, 0xFFCA, 0xDEC8, 0x2902, 0x2922,
+    0x2922, 0x5262, 0xFFCA, 0xFFCA, 0xFFC9, 0xFFC9, 0xFFA9, 0xDEC8,
+    0x18A1, 0x1060, 0x0840, 0x0840, 0x0020, 0x0020, 0x0000, 0x0020,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0020, 0x0840, 0x0840, 0x0840, 0x1060, 0x0860, 0x6303,
+    0xE708, 0xFFC9, 0xFFCA, 0xFFEA, 0xFFA9, 0x7364, 0x2901, 0x18C1,
+    0x20C1, 0x18A1, 0xC606, 0xFFC9, 0xFFCA, 0xFFEA, 0xE6C8, 0x3162,
+    0x1080, 0x0840, 0x0840, 0x0840, 0x0820, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0020, 0x0000, 0x0820, 0x0840, 0x0840, 0x0840, 0x0840, 0x1080,
+    0x20C1, 0x7384, 0x9465, 0x6B03, 0x2101, 0x18A0, 0x18A0, 0x10A0,
+    0x18A0, 0x18A0, 0x41E2, 0xF7A9, 0xFFCA, 0xB545, 0x18C1, 0x0840,
+    0x0840, 0x0840, 0x0840, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0840, 0x0840, 0x0840,
+    0x0840, 0x1080, 0x1060, 0x1080, 0x1060, 0x18A0, 0x18A0, 0x18A0,
+    0x1080, 0x1060, 0x1080, 0x2922, 0x3122, 0x0860, 0x0840, 0x0820,
+    0x0840, 0x0820, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0020, 0x0000, 0x0820, 0x0020, 0x0820, 0x0840,
+    0x0840, 0x0840, 0x0840, 0x0860, 0x1080, 0x1060, 0x1080, 0x1060,
+    0x1080, 0x0840, 0x0840, 0x1060, 0x0840, 0x0840, 0x0840, 0x0820,
+    0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x0020,
+    0x0020, 0x0840, 0x0820, 0x0840, 0x0840, 0x0840, 0x0860, 0x0840,
+    0x0820, 0x0840, 0x0020, 0x0840, 0x0840, 0x0820, 0x0020, 0x0820,
+    0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020,
+    0x0820, 0x0020, 0x0820, 0x0020, 0x0840, 0x0840, 0x0820, 0x0840,
+    0x0020, 0x0020, 0x0820, 0x0020, 0x0820, 0x0020, 0x0000, 0x0020,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,
+    0x0000, 0x0020, 0x0020, 0x0820, 0x0020, 0x0820, 0x0020, 0x0820,
+    0x0020, 0x0820, 0x0020, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0000, 0x0020,
+    0x0000, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 },
+  { 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5141, 0x9202, 0x69A1,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x1861, 0xAA82, 0xDAE2, 0xDAE2, 0xE2E2,
+    0x69C1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x1020, 0xDAA2, 0xDAE2, 0xE2E2, 0xDAE2, 0xDAE2,
+    0xD282, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x69A1, 0xDAE2, 0xDAE2, 0xDAE2, 0xE2E2, 0xDAE2,
+    0xE2E2, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0xD2A2, 0xDAE2, 0xDAE2, 0xE2E2, 0xDAE2, 0xDAE2,
+    0xDAE2, 0x1861, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x1861, 0xE2E2, 0xDAE2, 0xDAE2, 0xDAE2, 0xD2A2, 0xDAE2,
+    0xE2E2, 0x2061, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x40E2, 0xDAE2, 0xDAE2, 0xAA82, 0x30C1, 0x0000, 0x1041,
+    0x91E2, 0x1020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x4121, 0xDAE2, 0xDAA2, 0x2061, 0x0020, 0x0000, 0x0000,
+    0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x40E2, 0xE323, 0x4121, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x1881, 0xAA82, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x30C1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x69A1,
+    0x8221, 0x28A0, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x69A1,
+    0xDB61, 0xE361, 0x4121, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3101,
+    0xDB61, 0xE361, 0xC322, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x1841,
+    0xE361, 0xE361, 0xDB61, 0x28A0, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0000, 0x0020, 0x0000,
+    0xE361, 0xDB61, 0xE361, 0x18A1, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0020, 0x0000, 0x0020, 0x0000, 0x0020, 0x0000, 0x0020, 0x0000,
+    0xCB22, 0xE3C1, 0xE361, 0x0020, 0x0000, 0x0000, 0x0020, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000,
+    0x0020, 0x0000, 0x0020, 0x0000, 0x0020, 0x0000, 0x0020, 0x0000,
+    0xAA62, 0xE3C1, 0x9282, 0x0820, 0x0000, 0x0020, 0x0000, 0x0020,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000,
+    0x0820, 0x0000, 0x0020, 0x0000, 0x0820, 0x0800, 0x0020, 0x0800,
+    0xB282, 0xE3C1, 0x4121, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020,
+    0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000,
+    0x0020, 0x0000, 0x0820, 0x0020, 0x0800, 0x0020, 0x0000, 0x0000,
+    0xAA82, 0xE361, 0x0820, 0x0800, 0x0820, 0x0000, 0x0020, 0x0000,
+    0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0000,
+    0x0820, 0x0800, 0x0020, 0x0820, 0x0800, 0x0820, 0x0000, 0x0820,
+    0xB322, 0x7A21, 0x0800, 0x0800, 0x0020, 0x0800, 0x0020, 0x0000,
+    0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0000, 0x0820,
+    0x0000, 0x0820, 0x0800, 0x0020, 0x0800, 0x0820, 0x0800, 0x0000,
+    0xCB22, 0x18A1, 0x0820, 0x0800, 0x0820, 0x0800, 0x0020, 0x0800,
+    0x0820, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0800, 0x0820,
+    0x0800, 0x28C1, 0x0820, 0x0800, 0x0820, 0x0820, 0x0820, 0x1020,
+    0x3922, 0x0820, 0x0820, 0x0800, 0x0820, 0x0800, 0x0820, 0x0800,
+    0x0020, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0800, 0x0020, 0x0800,
+    0x69A1, 0x7A21, 0x0820, 0x0820, 0x1020, 0x0820, 0x0820, 0x0820,
+    0x1020, 0x1020, 0x1020, 0x0820, 0x0820, 0x0020, 0x0800, 0x0820,
+    0x0800, 0x0820, 0x0000, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0020, 0x0000, 0x0020, 0x0000, 0x0820, 0x0800, 0x69C1,
+    0xEBC1, 0x1881, 0x0820, 0x1020, 0x1020, 0x1020, 0x1020, 0x1020,
+    0x1020, 0x1020, 0x1020, 0x1020, 0x0820, 0x0820, 0x0820, 0x0800,
+    0x0820, 0x0000, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x2880, 0xE3C1,
+    0xCB22, 0x1020, 0x1020, 0x1020, 0x1020, 0x1020, 0x1020, 0x1020,
+    0x1020, 0x1020, 0x1020, 0x1020, 0x1020, 0x0820, 0x0820, 0x0020,
+    0x0800, 0x0820, 0x0800, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0020, 0x0800, 0x0820, 0x0800, 0x0020, 0x69A1, 0xEC81,
+    0x9AE1, 0x1020, 0x1020, 0x1020, 0x1041, 0x1841, 0x1841, 0x2061,
+    0x1041, 0x1841, 0x1841, 0x1020, 0x1020, 0x1020, 0x0820, 0x0820,
+    0x0800, 0x0800, 0x0820, 0x0000, 0x0020, 0x0000, 0x0020, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0020, 0x0000, 0x0820, 0x0000, 0x0820, 0x5141, 0xEC61,
+    0xB322, 0x1020, 0x1020, 0x1841, 0x1841, 0x1041, 0x2081, 0x59C1,
+    0x1841, 0x1841, 0x1841, 0x1041, 0x1841, 0x1020, 0x1020, 0x0820,
+    0x0820, 0x0800, 0x0820, 0x0800, 0x0820, 0x0000, 0x0020, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,
+    0x0000, 0x0020, 0x0800, 0x0820, 0x0800, 0x0820, 0x1041, 0xE441,
+    0xCBA2, 0x1041, 0x1041, 0x1841, 0x1841, 0x2061, 0x9AE1, 0x5141,
+    0x1041, 0x1841, 0x1841, 0x1841, 0x1041, 0x1841, 0x1020, 0x1020,
+    0x1020, 0x0820, 0x0800, 0x0820, 0x0000, 0x0020, 0x0000, 0x0020,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,
+    0x0000, 0x0020, 0x0000, 0x0820, 0x0820, 0x0820, 0x1020, 0x61A1,
+    0xF461, 0x30C1, 0x1841, 0x1861, 0x1841, 0x7A21, 0xF481, 0x69A1,
+    0x1861, 0x2061, 0x1861, 0x2061, 0x1841, 0x1841, 0x1041, 0x1020,
+    0x1020, 0x0820, 0x0820, 0x0800, 0x0820, 0x0800, 0x0020, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000,
+    0x0020, 0x0800, 0x0820, 0x0800, 0x0820, 0x0820, 0x1020, 0x1841,
+    0x7A21, 0x9282, 0x1861, 0x2061, 0x5141, 0xEC81, 0xEC61, 0x9AE1,
+    0x2061, 0x2081, 0x2061, 0x1861, 0x2061, 0x1041, 0x1841, 0x1841,
+    0x1020, 0x1020, 0x0820, 0x0800, 0x0800, 0x0020, 0x0000, 0x0020,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,
+    0x0000, 0x0020, 0x0800, 0x0820, 0x0820, 0x1020, 0x1020, 0x1841,
+    0x1841, 0x1861, 0x1861, 0x28A1, 0xDC21, 0xECA1, 0xECA1, 0xEC61,
+    0x5162, 0x2061, 0x2081, 0x2881, 0x1861, 0x2061, 0x1841, 0x1041,
+    0x1841, 0x1020, 0x0820, 0x0820, 0x0800, 0x0820, 0x0800, 0x0020,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0800,
+    0x0820, 0x0000, 0x0820, 0x0820, 0x1020, 0x1020, 0x1841, 0x1841,
+    0x1861, 0x2061, 0x2081, 0xB381, 0xECA1, 0xEC81, 0xE4A1, 0xEC81,
+    0xEC61, 0x4962, 0x2081, 0x2061, 0x2081, 0x2061, 0x1861, 0x1841,
+    0x1841, 0x1020, 0x1020, 0x0820, 0x0800, 0x0800, 0x0020, 0x0000,
+    0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000,
+    0x0820, 0x0800, 0x0820, 0x0820, 0x1020, 0x1841, 0x1841, 0x1861,
+    0x1861, 0x2061, 0x7A01, 0xECC1, 0xF4C1, 0xECC1, 0xF4C1, 0xF4C1,
+    0xF4E1, 0xEC61, 0x6201, 0x28A1, 0x2881, 0x2081, 0x2061, 0x2061,
+    0x1041, 0x1841, 0x1020, 0x0820, 0x0820, 0x0820, 0x0800, 0x0820,
+    0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020,
+    0x0800, 0x0820, 0x0820, 0x1020, 0x1020, 0x1841, 0x1841, 0x2061,
+    0x2081, 0x4121, 0xECA1, 0xF4C1, 0xF4C1, 0xECC1, 0xF4C1, 0xECC1,
+    0xF4C1, 0xECC1, 0xF4C1, 0xAB61, 0x30E2, 0x2881, 0x2081, 0x1861,
+    0x2061, 0x1841, 0x1020, 0x1020, 0x0820, 0x0800, 0x0800, 0x0020,
+    0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020,
+    0x0800, 0x0800, 0x0820, 0x1020, 0x1841, 0x1841, 0x1861, 0x2081,
+    0x2081, 0xCC01, 0xECC1, 0xF4C1, 0xECC1, 0xF4C1, 0xECC1, 0xF4C1,
+    0xECC1, 0xF4C1, 0xECC1, 0xF4C1, 0xE441, 0x5141, 0x2081, 0x2881,
+    0x1861, 0x1841, 0x1841, 0x1020, 0x0820, 0x0820, 0x0800, 0x0820,
+    0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0800,
+    0x0820, 0x0820, 0x1020, 0x1020, 0x1841, 0x2061, 0x1861, 0x2081,
+    0x8281, 0xF4E1, 0xF4C1, 0xF502, 0xF502, 0xF502, 0xF543, 0xED02,
+    0xF502, 0xF502, 0xF502, 0xED02, 0xF502, 0xE4A1, 0x7242, 0x2061,
+    0x1861, 0x2061, 0x1841, 0x1020, 0x1020, 0x0820, 0x0800, 0x0000,
+    0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0800,
+    0x0800, 0x0820, 0x1020, 0x1841, 0x1041, 0x1861, 0x2061, 0x3902,
+    0xE4A1, 0xF502, 0xF502, 0xF502, 0xED01, 0xF583, 0xF6A7, 0xF645,
+    0xF543, 0xF521, 0xF501, 0xF521, 0xF502, 0xF502, 0xF522, 0x9AE1,
+    0x2081, 0x2061, 0x1841, 0x1841, 0x1020, 0x0820, 0x0800, 0x0820,
+    0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0800, 0x0820,
+    0x0800, 0x0820, 0x1020, 0x1841, 0x1861, 0x2061, 0x2081, 0xB381,
+    0xF521, 0xF521, 0xF501, 0xF521, 0xF501, 0xF5C4, 0xF6A7, 0xF6A7,
+    0xF6A7, 0xF5A3, 0xF542, 0xF521, 0xF501, 0xF521, 0xED01, 0xF502,
+    0x9AE1, 0x1841, 0x1861, 0x1841, 0x1020, 0x0820, 0x0800, 0x0820,
+    0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0800,
+    0x0820, 0x1020, 0x1020, 0x1841, 0x1861, 0x2061, 0x51C1, 0xED02,
+    0xF501, 0xF521, 0xF542, 0xED42, 0xF542, 0xF5E5, 0xFEA7, 0xF6A7,
+    0xF6A7, 0xF6A7, 0xF582, 0xF542, 0xF542, 0xF501, 0xF521, 0xF521,
+    0xF521, 0x7242, 0x2061, 0x1841, 0x1841, 0x1020, 0x0820, 0x0820,
+    0x0800, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0020, 0x0800, 0x0020, 0x0800, 0x0820,
+    0x0820, 0x1020, 0x1841, 0x1041, 0x2061, 0x2081, 0xC402, 0xF521,
+    0xF501, 0xF542, 0xF542, 0xED42, 0xF582, 0xF666, 0xFEE8, 0xF6E8,
+    0xFF08, 0xF6E8, 0xF645, 0xF542, 0xF542, 0xF542, 0xED42, 0xF501,
+    0xF521, 0xE481, 0x28A1, 0x1041, 0x1841, 0x1020, 0x0820, 0x0800,
+    0x0820, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0800, 0x0800,
+    0x0820, 0x1020, 0x1041, 0x1861, 0x2061, 0x51C1, 0xF501, 0xF542,
+    0xED42, 0xF582, 0xF562, 0xF582, 0xF5A3, 0xF6E8, 0xFF08, 0xF6E8,
+    0xFF08, 0xF6E8, 0xF666, 0xF562, 0xF582, 0xF582, 0xF542, 0xF542,
+    0xF542, 0xF521, 0x8B21, 0x2061, 0x1841, 0x1020, 0x0820, 0x0820,
+    0x0000, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0800, 0x0820, 0x0800,
+    0x1020, 0x1020, 0x1041, 0x2061, 0x2081, 0xCC21, 0xF542, 0xF542,
+    0xF582, 0xF562, 0xF582, 0xF5A2, 0xF645, 0xF6E8, 0xFEE8, 0xF708,
+    0xFEE8, 0xF708, 0xF645, 0xF582, 0xF5A2, 0xF582, 0xF562, 0xF542,
+    0xED42, 0xF542, 0xAB61, 0x1861, 0x1041, 0x1020, 0x1020, 0x0820,
+    0x0800, 0x0800, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0800, 0x0820,
+    0x1020, 0x1020, 0x1841, 0x1861, 0x4161, 0xF542, 0xED42, 0xF562,
+    0xF582, 0xF5A2, 0xF582, 0xF624, 0xF708, 0xFEE8, 0xF708, 0xFEE8,
+    0xF708, 0xFEE8, 0xF604, 0xF5A2, 0xF5A2, 0xF562, 0xF582, 0xF582,
+    0xF542, 0xF562, 0x9B81, 0x2061, 0x1841, 0x1041, 0x1020, 0x0820,
+    0x0800, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0800, 0x0820, 0x0820,
+    0x1020, 0x1841, 0x1841, 0x2061, 0x8B21, 0xF562, 0xF582, 0xF562,
+    0xF5A2, 0xF5A2, 0xF645, 0xFEE8, 0xF708, 0xFEE8, 0xFF29, 0xF709,
+    0xFF29, 0xFEE8, 0xF604, 0xF5E3, 0xF5C3, 0xF5A2, 0xF5A2, 0xF562,
+    0xF582, 0xED42, 0x4161, 0x2061, 0x1861, 0x1841, 0x1020, 0x0820,
+    0x0800, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0800, 0x0820,
+    0x1020, 0x1841, 0x1841, 0x2061, 0xC4A1, 0xF582, 0xF562, 0xF5A2,
+    0xF5A2, 0xF685, 0xF708, 0xFEE8, 0xF708, 0xFF09, 0xFF29, 0xFF09,
+    0xF729, 0xFF08, 0xF603, 0xF5E3, 0xF5E3, 0xFDC3, 0xF5A2, 0xF5A2,
+    0xF5A2, 0x9B81, 0x2881, 0x2881, 0x1861, 0x1841, 0x1020, 0x0820,
+    0x0820, 0x0800, 0x0020, 0x0800, 0x0020, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0020, 0x0000, 0x0820, 0x0800, 0x0820, 0x0820,
+    0x1020, 0x1841, 0x1861, 0x30A1, 0xFD82, 0xF5A1, 0xF5A2, 0xF5C2,
+    0xF604, 0xFF08, 0xF6E8, 0xFF29, 0xFF09, 0xFF29, 0xF709, 0xFF29,
+    0xFF09, 0xF708, 0xF623, 0xF5E3, 0xF603, 0xF5E2, 0xF5C2, 0xF5A2,
+    0xCCA1, 0x30C2, 0x2881, 0x2081, 0x1861, 0x1841, 0x1020, 0x1020,
+    0x0800, 0x0000, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0800, 0x0820, 0x0820,
+    0x1020, 0x1841, 0x1861, 0x4181, 0xF581, 0xF5A2, 0xF5C2, 0xF5A2,
+    0xF603, 0xF708, 0xFF09, 0xFF29, 0xF709, 0xFF29, 0xFF09, 0xFF29,
+    0xFF09, 0xF6A7, 0xF623, 0xFE23, 0xF603, 0xF5E2, 0xF5E2, 0xCCA1,
+    0x4942, 0x30C1, 0x28A1, 0x2881, 0x1861, 0x1841, 0x1020, 0x1020,
+    0x0800, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0020, 0x0000, 0x0820, 0x0800, 0x0820, 0x0820,
+    0x1020, 0x1841, 0x2061, 0x6A21, 0xF5A1, 0xF5C2, 0xF5C2, 0xF5E2,
+    0xF5E2, 0xF623, 0xFEA7, 0xFF29, 0xFF09, 0xF769, 0xFF49, 0xFF69,
+    0xFF49, 0xF6A7, 0xF664, 0xF643, 0xF623, 0xF5E3, 0xDD02, 0x51A2,
+    0x3902, 0x38E2, 0x28C1, 0x28A1, 0x2061, 0x1041, 0x1841, 0x1020,
+    0x0800, 0x0800, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0800, 0x0820, 0x1020,
+    0x1041, 0x1841, 0x1861, 0x51A1, 0xF5A2, 0xF5C2, 0xF5C2, 0xF5E2,
+    0xF602, 0xF5E3, 0xF623, 0xF664, 0xF685, 0xFF07, 0xFF48, 0xF769,
+    0xFF49, 0xFE84, 0xF664, 0xF643, 0xFE23, 0xD563, 0x6223, 0x4962,
+    0x4922, 0x30E2, 0x30C1, 0x28A1, 0x2061, 0x1841, 0x1841, 0x1020,
+    0x0820, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0020, 0x0000, 0x0820, 0x0800, 0x0820, 0x1020,
+    0x1841, 0x1841, 0x2081, 0x38E2, 0xFDC2, 0xF5C2, 0xF5E2, 0xF602,
+    0xF602, 0xF623, 0xF643, 0xFE64, 0xF684, 0xF684, 0xFE84, 0xF6C4,
+    0xFEE5, 0xF684, 0xF684, 0xF644, 0xE5A2, 0x6A82, 0x51A2, 0x4962,
+    0x4122, 0x38E2, 0x30C1, 0x2881, 0x2061, 0x1041, 0x1841, 0x1020,
+    0x0820, 0x0800, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0800, 0x0820, 0x1020,
+    0x1841, 0x1041, 0x2061, 0x2081, 0xCCA1, 0xF5E2, 0xF5E2, 0xF602,
+    0xFE23, 0xF643, 0xF644, 0xF683, 0xF684, 0xFEA4, 0xF6C4, 0xFEE5,
+    0xF6C4, 0xF6A4, 0xFE84, 0xF663, 0x8323, 0x6223, 0x59C2, 0x5162,
+    0x4142, 0x3902, 0x30C1, 0x2881, 0x2881, 0x1861, 0x1841, 0x1020,
+    0x0820, 0x0820, 0x0800, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0020, 0x0000, 0x0820, 0x0800, 0x0820, 0x1020,
+    0x1841, 0x1861, 0x2881, 0x28A1, 0x6201, 0xFE02, 0xF602, 0xF623,
+    0xFE23, 0xF643, 0xF664, 0xFE84, 0xF6A4, 0xF6C4, 0xFEC5, 0xF705,
+    0xFEE5, 0xF6C4, 0xFEA4, 0xCD43, 0x72A3, 0x6223, 0x51A2, 0x4983,
+    0x4142, 0x3902, 0x38E2, 0x28A1, 0x2081, 0x1861, 0x1841, 0x1020,
+    0x0820, 0x0800, 0x0800, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0020, 0x0000, 0x0820, 0x0800, 0x0820, 0x1020,
+    0x1041, 0x2061, 0x2061, 0x28A1, 0x28A1, 0x8303, 0xF602, 0xF622,
+    0xF643, 0xF644, 0xFE83, 0xF684, 0xF6A4, 0xFEC5, 0xF705, 0xFF05,
+    0xF705, 0xFEE5, 0xFEE4, 0x9BC3, 0x7AC3, 0x6223, 0x6223, 0x59C2,
+    0x4122, 0x4122, 0x8323, 0x28A1, 0x2081, 0x2061, 0x1841, 0x1020,
+    0x0820, 0x0800, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0820, 0x0820, 0x1020,
+    0x1841, 0x2061, 0x2081, 0x2881, 0x30C1, 0x3902, 0x59C2, 0x8B83,
+    0xAC43, 0xC4C2, 0xE5A2, 0xF6C4, 0xFEC4, 0xF705, 0xFF05, 0xFF45,
+    0xF705, 0xF705, 0xFEC4, 0x8B63, 0x72C3, 0x6223, 0x6223, 0x51A2,
+    0x4122, 0x59C1, 0xE5C2, 0x28A1, 0x2081, 0x2061, 0x1041, 0x1020,
+    0x0820, 0x0800, 0x0800, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0020, 0x0000, 0x0820, 0x0800, 0x0820, 0x1020,
+    0x1041, 0x2061, 0x2061, 0x28A1, 0x30C1, 0x3902, 0x4142, 0x59A2,
+    0x6223, 0x6A82, 0x72A3, 0xB503, 0xFEC5, 0xF705, 0xFF45, 0xF745,
+    0xFF45, 0xFF05, 0xFEE5, 0x8B83, 0x7AC3, 0x6A82, 0x6223, 0x59A2,
+    0x4142, 0x6201, 0xF622, 0x6A21, 0x2081, 0x2061, 0x1841, 0x1020,
+    0x0820, 0x0800, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0800, 0x0820, 0x1020,
+    0x1841, 0x2061, 0x2081, 0x28A1, 0x38E2, 0x3902, 0x4142, 0x59A2,
+    0x6223, 0x6A82, 0x7AC3, 0xAC43, 0xFEE5, 0xFF05, 0xFF45, 0xFF45,
+    0xFF45, 0xF705, 0xFEC5, 0x9423, 0x72C3, 0x6A82, 0x6223, 0x51A2,
+    0x4122, 0x8323, 0xFE22, 0x9BC3, 0x2061, 0x1861, 0x1841, 0x1020,
+    0x0820, 0x0800, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0800, 0x0820, 0x1020,
+    0x1841, 0x1861, 0x2081, 0x28A1, 0x38E2, 0x3902, 0x5162, 0x51A2,
+    0x6223, 0x6A82, 0x72A3, 0xB503, 0xFF05, 0xF706, 0xFF45, 0xFF46,
+    0xFF45, 0xF705, 0xFF05, 0xD563, 0x72C3, 0x7282, 0x6223, 0x51A2,
+    0x4962, 0x9BC3, 0xFE42, 0xE5A2, 0x2081, 0x2061, 0x1841, 0x1020,
+    0x0820, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0020, 0x0800, 0x0820, 0x0820, 0x1020,
+    0x1841, 0x2061, 0x2081, 0x2881, 0x38E2, 0x3902, 0x5162, 0x51C2,
+    0x6223, 0x7282, 0x72C3, 0xDE03, 0xFF05, 0xF726, 0xFF46, 0xFF46,
+    0xFF46, 0xF726, 0xF705, 0xFEE5, 0x9BA3, 0x6A82, 0x6223, 0x51A2,
+    0x5162, 0xC4C2, 0xF662, 0xF642, 0x30A1, 0x1861, 0x1041, 0x1020,
+    0x0820, 0x0800, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0020, 0x0800, 0x0800, 0x0820, 0x1020,
+    0x1041, 0x2061, 0x2081, 0x30A1, 0x30E2, 0x4142, 0x7282, 0x51A2,
+    0x6203, 0x6A82, 0x8303, 0xEEC5, 0xF705, 0xFF26, 0xFF46, 0xF746,
+    0xFF46, 0xFF06, 0xF705, 0xFEE5, 0xFEA4, 0x9BC3, 0x6223, 0x59A2,
+    0x51A2, 0xEE43, 0xF662, 0xFE62, 0x4981, 0x2061, 0x1841, 0x1020,
+    0x0820, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0020, 0x0000, 0x0820, 0x0000, 0x0820, 0x1020,
+    0x1841, 0x2061, 0x2081, 0x30A1, 0x30E2, 0xB463, 0x72C3, 0x59A2,
+    0x6223, 0x6284, 0xA3C3, 0xFF25, 0xF705, 0xFF26, 0xFF26, 0xF746,
+    0xFF4A, 0xFF26, 0xF705, 0xF705, 0xFEC5, 0xF6C4, 0xB503, 0x72A3,
+    0xC4C2, 0xF682, 0xFE82, 0xF662, 0x51A1, 0x1861, 0x1841, 0x1020,
+    0x0820, 0x0800, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0020, 0x0000, 0x0820, 0x0800, 0x0820, 0x1020,
+    0x1041, 0x2061, 0x2061, 0x28A1, 0x8323, 0xFE82, 0x51C2, 0x51A2,
+    0x6223, 0x72A3, 0xB503, 0xFF05, 0xF706, 0xFF26, 0xF726, 0xFF4A,
+    0xFFB0, 0xF706, 0xFF26, 0xF705, 0xFEC5, 0xF6E5, 0xFEC4, 0xF6A4,
+    0xFEA4, 0xF682, 0xF682, 0xFEA2, 0x59C1, 0x2061, 0x1041, 0x1020,
+    0x0820, 0x0800, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0820, 0x0820, 0x1020,
+    0x1841, 0x2061, 0x2081, 0x3901, 0xF643, 0xE602, 0x4183, 0x51C2,
+    0x6223, 0x72C3, 0xDE03, 0xFF05, 0xFF26, 0xF726, 0xFF46, 0xFF4C,
+    0xFF94, 0xF707, 0xF726, 0xFF05, 0xF705, 0xFEE5, 0xF6C4, 0xF6A4,
+    0xFEA4, 0xF6A2, 0xF682, 0xF682, 0x3101, 0x1841, 0x1841, 0x1020,
+    0x0820, 0x0800, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0800, 0x0820, 0x1020,
+    0x1841, 0x1861, 0x2881, 0x9381, 0xFE82, 0xD563, 0x51A2, 0x6223,
+    0x6284, 0x72C3, 0xF6E5, 0xF706, 0xFF26, 0xF746, 0xFF27, 0xF7B0,
+    0xFF95, 0xFF4A, 0xFF26, 0xF706, 0xFF05, 0xF705, 0xFEE5, 0xF6C4,
+    0xFEC3, 0xF6C2, 0xFEC2, 0xD563, 0x28A1, 0x2081, 0x1041, 0x1020,
+    0x0820, 0x0820, 0x0800, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0020, 0x0000, 0x0820, 0x0800, 0x0820, 0x1020,
+    0x1041, 0x20A1, 0x28A1, 0xE602, 0xFEC2, 0xBCC2, 0x51A2, 0x6223,
+    0x6A84, 0x9423, 0xFF26, 0xFF27, 0xFF07, 0xFF47, 0xF747, 0xFFB4,
+    0xFF95, 0xFFB0, 0xF727, 0xFF07, 0xF726, 0xF705, 0xFF05, 0xFEE5,
+    0xF6C4, 0xF6C3, 0xFEA2, 0x8321, 0x28A1, 0x1881, 0x1841, 0x1841,
+    0x0820, 0x0800, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0020, 0x0000, 0x0820, 0x0800, 0x0820, 0x1020,
+    0x1041, 0x1881, 0x51A1, 0xFEC2, 0xFEE3, 0xAC43, 0x51A2, 0x6223,
+    0x6264, 0xCE26, 0xF707, 0xFF27, 0xF747, 0xFF48, 0xFF4A, 0xF7B5,
+    0xFF95, 0xFFB4, 0xFF47, 0xF707, 0xFF07, 0xFF26, 0xF705, 0xF6E5,
+    0xFEE5, 0xFEC3, 0xE602, 0x4942, 0x28E1, 0x18A1, 0x2061, 0x1841,
+    0x1020, 0x0800, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0820, 0x1020, 0x1841,
+    0x2061, 0x1881, 0x72A2, 0xFEC2, 0xFEC3, 0x9423, 0x51A2, 0x6223,
+    0x8323, 0xFF26, 0xFF27, 0xFF47, 0xFF48, 0xF748, 0xFF8D, 0xFF95,
+    0xFFB5, 0xFF95, 0xF74C, 0xFF48, 0xFF47, 0xF748, 0xFF26, 0xF705,
+    0xFF05, 0xF704, 0x72A3, 0x3101, 0x28E1, 0x2081, 0x1881, 0x1841,
+    0x1020, 0x0820, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0820, 0x1020, 0x1841,
+    0x1881, 0x1881, 0x8303, 0xF6C3, 0xFF04, 0xB443, 0x5224, 0x6264,
+    0xB503, 0xF727, 0xFF47, 0xFF48, 0xFF49, 0xF769, 0xFFB2, 0xFFB6,
+    0xFFD6, 0xFFB6, 0xFFB2, 0xFF48, 0xF74C, 0xFF4C, 0xFF27, 0xF726,
+    0xFF05, 0xEEC5, 0x4983, 0x3162, 0x28E1, 0x20C1, 0x2081, 0x1080,
+    0x1020, 0x0840, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0020, 0x0820, 0x0840, 0x1020, 0x1060,
+    0x2081, 0x18C1, 0xBD23, 0xFF23, 0xFF04, 0xB503, 0x5224, 0x6264,
+    0xF6C5, 0xFF68, 0xFF48, 0xFF49, 0xFF6A, 0xF74A, 0xFFD5, 0xFFD6,
+    0xFFB6, 0xFFD6, 0xFFB6, 0xFFB0, 0xFFB6, 0xFF4C, 0xFF47, 0xF707,
+    0xFF26, 0xEEC5, 0x41C3, 0x3162, 0x2922, 0x28E1, 0x2081, 0x1080,
+    0x1020, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0820, 0x1020, 0x1080,
+    0x1881, 0x4A42, 0xF723, 0xFF03, 0xFF04, 0xDE45, 0x5224, 0xB503,
+    0xFF47, 0xFF48, 0xF749, 0xFF6A, 0xFF4A, 0xF7AF, 0xFFB7, 0xFFD7,
+    0xFFB7, 0xFFD7, 0xFFB7, 0xFFB6, 0xFFD6, 0xFF8D, 0xFF48, 0xFF47,
+    0xFF26, 0xFF26, 0x9C43, 0x39A2, 0x2922, 0x28E1, 0x20C1, 0x18A0,
+    0x0840, 0x0840, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0020, 0x0820, 0x0840, 0x1020, 0x1060,
+    0x2081, 0xA4C4, 0xFF23, 0xFF23, 0xF705, 0xFF26, 0xC5A5, 0xF747,
+    0xFF48, 0xFF69, 0xFF4A, 0xF76A, 0xFF8C, 0xFFD5, 0xFFD7, 0xFFD7,
+    0xFFD7, 0xF7D7, 0xFFB7, 0xFFD7, 0xFFB6, 0xFFB0, 0xFF49, 0xF748,
+    0xFF47, 0xFF45, 0xF6E5, 0x72C3, 0x3162, 0x28C1, 0x18C1, 0x18A0,
+    0x1041, 0x0840, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0840, 0x0840, 0x18A0,
+    0x18A1, 0xD603, 0xF703, 0xF703, 0xFF45, 0xFF46, 0xFF47, 0xF748,
+    0xFF69, 0xFF4A, 0xFF4A, 0xF78C, 0xFFB0, 0xFFD8, 0xFFD8, 0xFFD8,
+    0xFFD8, 0xFFD8, 0xFFD8, 0xFFD7, 0xFFD7, 0xFFD5, 0xFF8C, 0xF748,
+    0xFF47, 0xFF46, 0xFF45, 0xEEC5, 0x49E3, 0x3122, 0x20C1, 0x18A0,
+    0x1080, 0x0840, 0x0020, 0x0820, 0x0020, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0840, 0x0840, 0x18A0,
+    0x20C1, 0xDE23, 0xFF23, 0xFF44, 0xF745, 0xFF46, 0xFF47, 0xFF48,
+    0xF749, 0xFF4A, 0xFF8C, 0xFF8D, 0xFFD5, 0xFFD8, 0xFFD8, 0xFFD9,
+    0xFFF9, 0xFFD8, 0xFFD8, 0xFFD8, 0xFFD7, 0xFFD7, 0xFFB5, 0xF74A,
+    0xFF48, 0xFF47, 0xF745, 0xFF44, 0xC5A5, 0x2922, 0x20E1, 0x10A0,
+    0x1080, 0x0840, 0x0020, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0020, 0x0000, 0x0820, 0x0840, 0x1080, 0x1080,
+    0x18A1, 0xD603, 0xF703, 0xFF44, 0xF745, 0xFF46, 0xFF48, 0xFF69,
+    0xF74A, 0xFF8C, 0xFF8D, 0xF7B0, 0xFFF9, 0xFFD9, 0xFFFA, 0xFFDA,
+    0xFFFA, 0xFFDA, 0xFFD9, 0xFFD8, 0xFFD8, 0xFFD7, 0xFFD7, 0xFFD2,
+    0xFF48, 0xFF47, 0xFF46, 0xFF45, 0xFF44, 0x7384, 0x2901, 0x2081,
+    0x1080, 0x0840, 0x0840, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0020, 0x0820, 0x0860, 0x1080, 0x18A0,
+    0x20C1, 0xDE03, 0xFF44, 0xF744, 0xFF46, 0xFF86, 0xFF88, 0xF749,
+    0xFFAB, 0xFF8C, 0xFFAF, 0xFFD6, 0xFFD9, 0xFFDA, 0xFFFB, 0xFFDB,
+    0xFFFB, 0xFFDA, 0xFFFA, 0xFFD9, 0xFFD8, 0xFFD8, 0xFFD7, 0xFFD6,
+    0xFF8A, 0xF788, 0xFF66, 0xFF65, 0xF744, 0xE6A3, 0x20E1, 0x18C1,
+    0x1060, 0x0840, 0x0840, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0820, 0x0020, 0x0840, 0x1080, 0x1080,
+    0x18A1, 0xD603, 0xFF44, 0xF744, 0xFF46, 0xFF87, 0xF78C, 0xFFAA,
+    0xFF8C, 0xF78D, 0xFFB0, 0xFFD9, 0xFFFA, 0xFFDB, 0xFFDC, 0xFFFC,
+    0xFFDC, 0xFFFC, 0xFFFB, 0xFFDA, 0xFFD9, 0xFFD8, 0xFFD7, 0xFFD6,
+    0xFFB0, 0xFF88, 0xF766, 0xFF85, 0xFF44, 0xFF44, 0x41E2, 0x20C1,
+    0x1080, 0x0840, 0x0840, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0020, 0x0020, 0x0820, 0x0840, 0x1080, 0x18A0,
+    0x20C1, 0xC5C5, 0xFF44, 0xFF85, 0xFF66, 0xFF88, 0xFFD4, 0xFFB2,
+    0xF78C, 0xFFAF, 0xFFD4, 0xFFDA, 0xFFFB, 0xFFFC, 0xFFFD, 0xFFFD,
+    0xFFFD, 0xFFFD, 0xFFDC, 0xFFDA, 0xFFF9, 0xFFD8, 0xFFD7, 0xFFD7,
+    0xFFD5, 0xF789, 0xFF47, 0xFF66, 0xF765, 0xFF44, 0x6303, 0x18C1,
+    0x1880, 0x0840, 0x0840, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0840, 0x1080, 0x1880,
+    0x18C1, 0xAD45, 0xFF44, 0xF765, 0xF766, 0xFF8B, 0xFFD6, 0xFFB6,
+    0xFFD4, 0xF7B0, 0xFFD7, 0xFFFA, 0xFFDB, 0xFFFD, 0xFFFE, 0xFFFE,
+    0xFFFE, 0xFFFD, 0xFFFC, 0xFFDB, 0xFFDA, 0xFFD8, 0xFFD8, 0xFFD7,
+    0xFFD6, 0xFF8C, 0xFF88, 0xFF66, 0xFF85, 0xFF44, 0x83E4, 0x20C1,
+    0x18A0, 0x1060, 0x0840, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0020, 0x0820, 0x0020, 0x1040, 0x1080, 0x18A0,
+    0x20C1, 0xB503, 0xFF85, 0xFF86, 0xFF87, 0xFFAF, 0xFFD6, 0xFFB7,
+    0xFFD7, 0xFFD8, 0xFFD9, 0xFFFA, 0xFFDB, 0xFFFD, 0xFFFE, 0xFFFE,
+    0xFFFE, 0xFFFE, 0xFFFC, 0xFFDB, 0xFFFA, 0xFFD9, 0xFFD8, 0xFFD7,
+    0xFFD6, 0xFFAF, 0xF788, 0xFF66, 0xFF65, 0xFF65, 0x7BC4, 0x18C1,
+    0x10A0, 0x1060, 0x0840, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0020, 0x0840, 0x0840, 0x1060, 0x10A0,
+    0x18C1, 0x9423, 0xFF65, 0xFF66, 0xF787, 0xFFB0, 0xFFB6, 0xFFD7,
+    0xFFD7, 0xFFF8, 0xFFD9, 0xFFFA, 0xFFDB, 0xFFFD, 0xFFFE, 0xFFFE,
+    0xFFFE, 0xFFFD, 0xFFFC, 0xFFDB, 0xFFDA, 0xFFD8, 0xFFD8, 0xFFD7,
+    0xFFD6, 0xFFD2, 0xFF88, 0xFF87, 0xFF66, 0xFF85, 0x7384, 0x20C1,
+    0x1060, 0x1080, 0x0840, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0020, 0x0820, 0x0840, 0x0840, 0x1080, 0x18A0,
+    0x20C1, 0x83C4, 0xFF85, 0xFF86, 0xFF87, 0xFFB0, 0xFFD6, 0xFFB7,
+    0xFFD7, 0xFFD8, 0xFFD9, 0xFFFA, 0xFFDB, 0xFFFC, 0xFFFD, 0xFFFE,
+    0xFFFD, 0xFFFD, 0xFFFC, 0xFFDB, 0xFFDA, 0xFFD8, 0xFFD8, 0xFFD7,
+    0xFFD6, 0xF7D4, 0xFF88, 0xFF87, 0xF766, 0xFF65, 0x5AA3, 0x1080,
+    0x1060, 0x0840, 0x0840, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0020, 0x0020, 0x0820, 0x0840, 0x1060, 0x10A0,
+    0x18C1, 0x6303, 0xFF66, 0xFF66, 0xF787, 0xFFB0, 0xFFD6, 0xFFD6,
+    0xFFD7, 0xFFD8, 0xFFD8, 0xFFD9, 0xFFFA, 0xFFDB, 0xFFDC, 0xFFFD,
+    0xFFFC, 0xFFFC, 0xFFDB, 0xFFFA, 0xFFD9, 0xFFD8, 0xFFD8, 0xFFB7,
+    0xFFD6, 0xFFD4, 0xFFA8, 0xFF87, 0xFF66, 0xFF85, 0x41E2, 0x18A0,
+    0x1080, 0x0840, 0x0840, 0x0820, 0x0020, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0820, 0x0020, 0x0840, 0x0840, 0x1080,
+    0x20C1, 0x41E2, 0xFF86, 0xFFA7, 0xFF87, 0xFFAF, 0xFFD6, 0xFFB6,
+    0xFFD7, 0xFFD8, 0xFFD8, 0xFFD9, 0xFFFA, 0xFFDB, 0xFFFB, 0xFFDB,
+    0xFFFB, 0xFFDB, 0xFFFA, 0xFFD9, 0xFFF9, 0xFFD8, 0xFFD7, 0xFFD7,
+    0xFFB6, 0xFFD5, 0xFF88, 0xFF87, 0xFF66, 0xEF25, 0x20E1, 0x10A0,
+    0x1060, 0x0840, 0x0840, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0840, 0x0840, 0x1060,
+    0x10A0, 0x20E1, 0xF766, 0xFF87, 0xF788, 0xFFAD, 0xFFB6, 0xFFD6,
+    0xFFD7, 0xFFD7, 0xFFD8, 0xFFD8, 0xFFD9, 0xFFFA, 0xFFDA, 0xFFFA,
+    0xFFDA, 0xFFFA, 0xFFD9, 0xFFF9, 0xFFD8, 0xFFD8, 0xFFD7, 0xFFB7,
+    0xFFD6, 0xFFD2, 0xFF88, 0xFF87, 0xFF87, 0xC5C5, 0x20C1, 0x18A0,
+    0x1080, 0x0840, 0x0840, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0840, 0x0840, 0x1080,
+    0x18A0, 0x20C1, 0xCE26, 0xFFA7, 0xFFA7, 0xFF8B, 0xFFD6, 0xFFD6,
+    0xFFB7, 0xFFD7, 0xFFD8, 0xFFD8, 0xFFD8, 0xFFD9, 0xFFF9, 0xFFD9,
+    0xFFF9, 0xFFD9, 0xFFF9, 0xFFD8, 0xFFD8, 0xFFD7, 0xFFD7, 0xFFD6,
+    0xFFF6, 0xFFB0, 0xF7A8, 0xFF87, 0xFF87, 0x9423, 0x18C1, 0x1080,
+    0x1080, 0x0820, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0840, 0x0840, 0x1080,
+    0x1080, 0x18C1, 0x9445, 0xF787, 0xFFA7, 0xFFA8, 0xF7D4, 0xFFD6,
+    0xFFF6, 0xFFD7, 0xFFD7, 0xFFD8, 0xFFF8, 0xFFD8, 0xFFD9, 0xFFF9,
+    0xFFD9, 0xFFF9, 0xFFD8, 0xFFF8, 0xFFD8, 0xFFD7, 0xFFD7, 0xFFF6,
+    0xFFD6, 0xFFCD, 0xFFA8, 0xFFA7, 0xFFA7, 0x5262, 0x18A0, 0x1080,
+    0x0840, 0x0820, 0x0840, 0x0820, 0x0020, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x0020, 0x0840, 0x0840,
+    0x1080, 0x18A0, 0x5262, 0xFFA7, 0xFFA7, 0xFFA8, 0xFFB0, 0xFFD6,
+    0xFFF6, 0xFFD7, 0xFFF7, 0xFFD7, 0xFFD8, 0xFFD8, 0xFFD8, 0xFFD8,
+    0xFFF8, 0xFFD8, 0xFFD8, 0xFFF8, 0xFFD7, 0xFFD7, 0xFFF6, 0xFFD6,
+    0xFFD5, 0xFFC9, 0xF7A8, 0xFFA7, 0xEF47, 0x18A1, 0x1080, 0x1080,
+    0x0840, 0x0840, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0840, 0x0840,
+    0x0880, 0x1080, 0x18A1, 0xE707, 0xFFA7, 0xFFA8, 0xFFCC, 0xFFD6,
+    0xFFF6, 0xFFD6, 0xFFF6, 0xF7D7, 0xFFF7, 0xFFD7, 0xFFF8, 0xFFD7,
+    0xFFB0, 0xFFD5, 0xFFD7, 0xFFF7, 0xFFD7, 0xFFF6, 0xFFD6, 0xFFF6,
+    0xFFB0, 0xFFA8, 0xFFA8, 0xFFA7, 0xC5C5, 0x20C1, 0x1080, 0x1060,
+    0x0840, 0x0840, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x0820, 0x0840,
+    0x0840, 0x1080, 0x18A0, 0xA4C4, 0xFFC7, 0xFFA8, 0xFFCB, 0xFFD6,
+    0xFFD6, 0xFFD6, 0xFFF6, 0xFFD6, 0xFFD7, 0xFFD7, 0xFFF6, 0xFFAF,
+    0xFFAD, 0xFFD2, 0xFFD7, 0xF7F7, 0xFFD6, 0xFFF6, 0xFFD6, 0xFFD5,
+    0xFF8A, 0xFFA8, 0xFFA8, 0xF7A7, 0x7BC4, 0x10A0, 0x1060, 0x0840,
+    0x0840, 0x0020, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0840,
+    0x0840, 0x1080, 0x1080, 0x4A42, 0xFFA7, 0xFFA8, 0xF7C9, 0xFFD5,
+    0xFFD6, 0xFFF6, 0xFFD6, 0xFFF6, 0xFFD6, 0xFFD5, 0xFFAD, 0xFFCC,
+    0xFFAC, 0xF7AF, 0xFFB7, 0xFFD6, 0xFFF6, 0xFFD6, 0xFFD6, 0xFFAF,
+    0xFFC9, 0xFFA8, 0xFFC8, 0xEF07, 0x2901, 0x1080, 0x0840, 0x0820,
+    0x0840, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0820,
+    0x0840, 0x0840, 0x1080, 0x18A0, 0xE6E6, 0xFFA8, 0xFFA8, 0xFFD2,
+    0xFFD6, 0xFFF6, 0xFFD6, 0xFFF6, 0xFFD4, 0xFFAC, 0xFFCB, 0xCE68,
+    0xFFCB, 0xFFAC, 0xFFD6, 0xFFF6, 0xFFD6, 0xFFF6, 0xFFB2, 0xF7C9,
+    0xFFA8, 0xFFA8, 0xFFA8, 0x6B64, 0x1080, 0x1080, 0x0840, 0x0840,
+    0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,
+    0x0020, 0x0840, 0x0840, 0x0860, 0x7364, 0xFFA8, 0xF7A8, 0xFFCB,
+    0xFFD5, 0xFFD6, 0xFFD5, 0xFFB0, 0xFFCB, 0xFFCB, 0xD668, 0x41C3,
+    0xCE68, 0xFFCB, 0xFFD4, 0xFFD6, 0xFFD6, 0xFFD4, 0xFFCA, 0xFFA9,
+    0xFFC9, 0xFFC8, 0xCE26, 0x18A0, 0x1080, 0x0840, 0x0840, 0x0820,
+    0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0820,
+    0x0020, 0x0840, 0x0840, 0x1080, 0x18A0, 0xE6C8, 0xFFC9, 0xFFC9,
+    0xFFCA, 0xFFCB, 0xFFCA, 0xFFCA, 0xFFCA, 0xF7CA, 0xAD49, 0x3982,
+    0x83C4, 0xFFEB, 0xFFCD, 0xFFD6, 0xFFD2, 0xFFCB, 0xF7C9, 0xFFA9,
+    0xFFC9, 0xEF48, 0x2902, 0x0860, 0x0840, 0x0840, 0x0840, 0x0020,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0020, 0x0020, 0x0840, 0x0840, 0x0860, 0x4A62, 0xF788, 0xFFA9,
+    0xFFC9, 0xFFC9, 0xFFCA, 0xFFCA, 0xFFCA, 0xFFEA, 0x83C4, 0x3162,
+    0x39C2, 0xF789, 0xFFCA, 0xFFCA, 0xFFCA, 0xFFCA, 0xFFC9, 0xFFC9,
+    0xFFC9, 0x62A3, 0x1080, 0x0860, 0x0840, 0x0840, 0x0020, 0x0000,
+    0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,
+    0x0000, 0x0820, 0x0020, 0x0840, 0x0840, 0x1080, 0x9C65, 0xFFC9,
+    0xFFC9, 0xFFC9, 0xFFA9, 0xFFCA, 0xFFCA, 0xFFCA, 0x5AA3, 0x2902,
+    0x2922, 0xCE26, 0xFFCA, 0xFFCA, 0xFFCA, 0xFFC9, 0xFFC9, 0xF7A9,
+    0x7BC4, 0x0860, 0x0840, 0x0840, 0x0820, 0x0020, 0x0820, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0020, 0x0040, 0x0840, 0x0840, 0x1080, 0xAD45,
+    0xFFC9, 0xFFCA, 0xFFCA, 0xFFCA, 0xFFCA, 0xEF28, 0x2101, 0x20C1,
+    0x18C1, 0x7364, 0xFFCA, 0xFFCA, 0xFFCA, 0xFFCA, 0xFFC9, 0x83E4,
+    0x1080, 0x0840, 0x0840, 0x0840, 0x0820, 0x0020, 0x0020, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0020, 0x0000, 0x0820, 0x0020, 0x0840, 0x0840, 0x1080,
+    0x9C65, 0xF76A, 0xFFCA, 0xFFCA, 0xE728, 0x41E3, 0x1080, 0x18A0,
+    0x18A0, 0x20C1, 0xCE26, 0xFFEA, 0xFFCA, 0xCE68, 0x49C3, 0x0840,
+    0x0840, 0x0040, 0x0840, 0x0020, 0x0820, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0020, 0x0820, 0x0840,
+    0x0840, 0x1080, 0x3962, 0x3982, 0x10A0, 0x1080, 0x1060, 0x1080,
+    0x1060, 0x1080, 0x18A0, 0x41E2, 0x3962, 0x1080, 0x0840, 0x0020,
+    0x0840, 0x0840, 0x0820, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x0020, 0x0820,
+    0x0840, 0x0840, 0x0820, 0x0840, 0x0860, 0x0840, 0x0860, 0x0840,
+    0x1060, 0x0840, 0x0860, 0x0840, 0x1060, 0x0840, 0x0820, 0x0040,
+    0x0020, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,
+    0x0820, 0x0020, 0x0020, 0x0840, 0x0820, 0x0040, 0x0820, 0x0840,
+    0x0820, 0x0040, 0x0820, 0x0840, 0x0840, 0x0820, 0x0020, 0x0820,
+    0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000,
+    0x0020, 0x0000, 0x0820, 0x0020, 0x0820, 0x0020, 0x0820, 0x0020,
+    0x0820, 0x0020, 0x0820, 0x0020, 0x0820, 0x0020, 0x0020, 0x0000,
+    0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0020, 0x0000, 0x0820, 0x0020, 0x0820, 0x0020,
+    0x0820, 0x0020, 0x0820, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0000,
+    0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 },
+  { 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x1861, 0x91E2, 0x1041, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0820, 0xAA62, 0xD2A2, 0x5961, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x4121, 0xDAA2, 0xD2A2, 0x89E2, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x4121, 0xD2A2, 0x91E2, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x91E2, 0x8A02, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2061, 0x5141, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000,
+    0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000,
+    0x0020, 0x0000, 0x0020, 0x0000, 0x0020, 0x0000, 0x0020, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0000, 0x0020, 0x0800,
+    0x0020, 0x0000, 0x0020, 0x0000, 0x0020, 0x0000, 0x0020, 0x0000,
+    0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0000, 0x0820, 0x0800,
+    0x0020, 0x0000, 0x0020, 0x0800, 0x0020, 0x0000, 0x0020, 0x0000,
+    0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,
+    0x0000, 0x0020, 0x0000, 0x0020, 0x0000, 0x0820, 0x0000, 0x0820,
+    0x0000, 0x0820, 0x0000, 0x0820, 0x0000, 0x0820, 0x0800, 0x0020,
+    0x0000, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000,
+    0x0020, 0x0800, 0x0820, 0x0000, 0x0820, 0x0000, 0x0820, 0x0800,
+    0x0820, 0x0800, 0x0020, 0x0800, 0x0820, 0x0800, 0x0020, 0x0000,
+    0x0820, 0x0000, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020,
+    0x0000, 0x0020, 0x0800, 0x0020, 0x0800, 0x0820, 0x0800, 0x0820,
+    0x0820, 0x0820, 0x0820, 0x0800, 0x0820, 0x0000, 0x0820, 0x0800,
+    0x0820, 0x0800, 0x0020, 0x0000, 0x0820, 0x0000, 0x0020, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0800,
+    0x0820, 0x0800, 0x0020, 0x0800, 0x0820, 0x0820, 0x0820, 0x0820,
+    0x0820, 0x1020, 0x0820, 0x0820, 0x0820, 0x1020, 0x0820, 0x0800,
+    0x0820, 0x0800, 0x0020, 0x0000, 0x0020, 0x0000, 0x0020, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0000,
+    0x0820, 0x0800, 0x0820, 0x0820, 0x0820, 0x1020, 0x1020, 0x1020,
+    0x1020, 0x1020, 0x1020, 0x1020, 0x1020, 0x1020, 0x0820, 0x0820,
+    0x0820, 0x0800, 0x0820, 0x0000, 0x0820, 0x0000, 0x0820, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0820, 0x0800, 0x0820,
+    0x0820, 0x0820, 0x0820, 0x1020, 0x1020, 0x1020, 0x1020, 0x1841,
+    0x1841, 0x1041, 0x1841, 0x1841, 0x1841, 0x1020, 0x1020, 0x1020,
+    0x0820, 0x0820, 0x0800, 0x0820, 0x0000, 0x0820, 0x0000, 0x0020,
+    0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0820, 0x0800, 0x0820,
+    0x0820, 0x0820, 0x1020, 0x1020, 0x1841, 0x1841, 0x1841, 0x1041,
+    0x1841, 0x1841, 0x1841, 0x1041, 0x1841, 0x1841, 0x1841, 0x1020,
+    0x1020, 0x1020, 0x0820, 0x0820, 0x0820, 0x0800, 0x0020, 0x0000,
+    0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0020, 0x0000, 0x0020, 0x0800, 0x0820, 0x0800, 0x0820,
+    0x1020, 0x1020, 0x1020, 0x1041, 0x1841, 0x1841, 0x2061, 0x1861,
+    0x2061, 0x1861, 0x2061, 0x2061, 0x1861, 0x1841, 0x1841, 0x1041,
+    0x1841, 0x1020, 0x1020, 0x0820, 0x0820, 0x0820, 0x0800, 0x0020,
+    0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0020, 0x0000, 0x0020, 0x0800, 0x0820, 0x0820, 0x0820,
+    0x1020, 0x1841, 0x1841, 0x1841, 0x1861, 0x2061, 0x1861, 0x30A1,
+    0x38E2, 0x2881, 0x2081, 0x2081, 0x2061, 0x1861, 0x2061, 0x1841,
+    0x1841, 0x1041, 0x1020, 0x1020, 0x0820, 0x0800, 0x0820, 0x0800,
+    0x0020, 0x0800, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0020, 0x0000, 0x0820, 0x0800, 0x0820, 0x0820, 0x1020,
+    0x1841, 0x1841, 0x1041, 0x2061, 0x2081, 0x69A1, 0xCB22, 0xE383,
+    0xE383, 0xDB23, 0xAA82, 0x5141, 0x2081, 0x2061, 0x2081, 0x2061,
+    0x1861, 0x1841, 0x1841, 0x1020, 0x1020, 0x0820, 0x0800, 0x0800,
+    0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0020, 0x0000, 0x0820, 0x0800, 0x0820, 0x1020, 0x1020,
+    0x1841, 0x1041, 0x1861, 0x5141, 0xBB22, 0xE383, 0xE383, 0xE383,
+    0xE383, 0xE383, 0xE383, 0xE383, 0x9282, 0x30A1, 0x2081, 0x2081,
+    0x2061, 0x1861, 0x1841, 0x1841, 0x1020, 0x1020, 0x0820, 0x0800,
+    0x0820, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,
+    0x0000, 0x0820, 0x0800, 0x0820, 0x0820, 0x1020, 0x1020, 0x1841,
+    0x1041, 0x2061, 0x2081, 0x7A21, 0xEB83, 0xE383, 0xE383, 0xE383,
+    0xE383, 0xE383, 0xDB83, 0xE383, 0xE383, 0xAA62, 0x28A1, 0x20A1,
+    0x2061, 0x2081, 0x2061, 0x1041, 0x1841, 0x1020, 0x0820, 0x0820,
+    0x0800, 0x0800, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,
+    0x0000, 0x0820, 0x0800, 0x0800, 0x0820, 0x1020, 0x1041, 0x1841,
+    0x1861, 0x2081, 0x2081, 0x28A1, 0xE383, 0xE383, 0xE383, 0xE3C3,
+    0xE3E3, 0xEBC3, 0xE3E3, 0xE3C3, 0xEBE3, 0xE383, 0xAA82, 0x30A1,
+    0x2881, 0x2081, 0x2061, 0x1861, 0x1841, 0x1020, 0x1020, 0x0820,
+    0x0820, 0x0800, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,
+    0x0000, 0x0820, 0x0800, 0x0820, 0x1020, 0x1020, 0x1841, 0x1861,
+    0x2881, 0x28A1, 0x2881, 0x30C1, 0xC322, 0xEBC3, 0xE3E3, 0xEBC3,
+    0xE3E3, 0xE3C3, 0xE3E3, 0xEBC3, 0xE3E3, 0xE3C3, 0xE3E3, 0x7A21,
+    0x28A1, 0x2881, 0x2081, 0x2061, 0x1041, 0x1841, 0x1020, 0x0820,
+    0x0820, 0x0800, 0x0800, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000,
+    0x0820, 0x0000, 0x0820, 0x0820, 0x1020, 0x1841, 0x1861, 0x69A1,
+    0x38E2, 0x2881, 0x30C1, 0x30E2, 0xB322, 0xE3E3, 0xE3C3, 0xE424,
+    0xEC84, 0xEC24, 0xE424, 0xEC24, 0xEBE3, 0xE3C3, 0xE3E3, 0xEB83,
+    0x4121, 0x30A1, 0x28A1, 0x2081, 0x2061, 0x1041, 0x1020, 0x1020,
+    0x0820, 0x0800, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,
+    0x0000, 0x0820, 0x0820, 0x1020, 0x1020, 0x1841, 0x38E2, 0xE383,
+    0x69A1, 0x28C1, 0x38E2, 0x3921, 0xCBA2, 0xEC24, 0xEC24, 0xEC84,
+    0xF648, 0xEC84, 0xE424, 0xEC24, 0xE424, 0xEC24, 0xE424, 0xE3C3,
+    0xC302, 0x30E2, 0x28A1, 0x2081, 0x2061, 0x1861, 0x1841, 0x1020,
+    0x0820, 0x0800, 0x0800, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000,
+    0x0020, 0x0800, 0x0820, 0x1020, 0x1841, 0x1861, 0x89E2, 0xEBE3,
+    0x5141, 0x30C1, 0x30E2, 0x4122, 0xE3C3, 0xEC24, 0xE424, 0xECC6,
+    0xF628, 0xF5E8, 0xEC84, 0xEC63, 0xE424, 0xEC24, 0xEC24, 0xEC24,
+    0xEC23, 0x7A21, 0x30C1, 0x28A1, 0x2081, 0x2061, 0x1041, 0x1020,
+    0x1020, 0x0800, 0x0820, 0x0800, 0x0020, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0800,
+    0x0820, 0x0800, 0x1020, 0x1020, 0x1041, 0x2061, 0xCB22, 0xC322,
+    0x30C1, 0x30E2, 0x3902, 0x6A21, 0xEC24, 0xEC24, 0xEC63, 0xECE4,
+    0xF6A9, 0xF6A9, 0xF628, 0xECC4, 0xEC84, 0xEC63, 0xEC24, 0xEC24,
+    0xE423, 0xE3C3, 0x4962, 0x28A1, 0x2081, 0x2061, 0x1861, 0x1020,
+    0x1020, 0x0820, 0x0800, 0x0800, 0x0020, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020,
+    0x0800, 0x0820, 0x1020, 0x1020, 0x1041, 0x2881, 0xCBA2, 0x40E2,
+    0x30C1, 0x3902, 0x4122, 0x9AE1, 0xEC63, 0xEC84, 0xEC84, 0xED05,
+    0xF6A9, 0xF689, 0xFEA9, 0xF648, 0xED25, 0xEC84, 0xEC63, 0xEC63,
+    0xEC23, 0xEC23, 0xC322, 0x30C1, 0x2881, 0x2081, 0x2061, 0x1841,
+    0x1020, 0x0820, 0x0820, 0x0800, 0x0020, 0x0000, 0x0020, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0800,
+    0x0820, 0x0820, 0x1020, 0x1841, 0x1041, 0x2061, 0x28A1, 0x30A1,
+    0x30E2, 0x3902, 0x5162, 0xEC43, 0xEC84, 0xEC84, 0xF4E4, 0xED05,
+    0xFEA9, 0xF6A9, 0xF6A9, 0xF689, 0xFEA9, 0xF5C8, 0xED05, 0xEC63,
+    0xEC63, 0xE423, 0xEC23, 0x7201, 0x2881, 0x2081, 0x1861, 0x1841,
+    0x1020, 0x0820, 0x0800, 0x0800, 0x0020, 0x0000, 0x0020, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0820,
+    0x0800, 0x0820, 0x1020, 0x1041, 0x2061, 0x2061, 0x28A1, 0x30C1,
+    0x30E2, 0x4122, 0x9262, 0xEC84, 0xEC84, 0xECE4, 0xECC4, 0xF5A6,
+    0xF689, 0xF6A9, 0xF689, 0xFEA9, 0xF689, 0xF6A9, 0xF6A9, 0xF5A6,
+    0xEC63, 0xEC83, 0xEC23, 0xEBC3, 0x38E2, 0x2081, 0x2061, 0x1841,
+    0x1020, 0x1020, 0x0820, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0820,
+    0x0800, 0x0820, 0x1020, 0x1041, 0x2061, 0x2081, 0x30A1, 0x38E2,
+    0x3922, 0x5162, 0xEC23, 0xECA4, 0xECE4, 0xECC4, 0xF544, 0xF6C9,
+    0xFEC9, 0xF6C9, 0xF6C9, 0xF6C9, 0xFEC9, 0xF6A9, 0xF6A9, 0xF689,
+    0xECC4, 0xEC63, 0xEC63, 0xEC23, 0x7A01, 0x2081, 0x2081, 0x1841,
+    0x1041, 0x1020, 0x0820, 0x0800, 0x0800, 0x0020, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0800,
+    0x0800, 0x0820, 0x1020, 0x1841, 0x1861, 0x28A1, 0x30A1, 0x30E2,
+    0x3102, 0xB322, 0xEC84, 0xF4A2, 0xECE4, 0xED05, 0xF689, 0xFEC9,
+    0xF6C9, 0xF6C9, 0xF6C9, 0xFEC9, 0xF6C9, 0xF6C9, 0xF6A9, 0xFEA9,
+    0xF5A6, 0xEC63, 0xEC63, 0xEC23, 0xCBA2, 0x28A1, 0x2081, 0x2061,
+    0x1841, 0x1020, 0x0820, 0x0800, 0x0820, 0x0000, 0x0020, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0820,
+    0x0800, 0x1020, 0x1020, 0x1841, 0x2061, 0x28A1, 0x28A1, 0x38E2,
+    0x7A62, 0xEC63, 0xF4C2, 0xECE4, 0xED05, 0xF5A6, 0xF6C9, 0xFEC9,
+    0xFF29, 0xF709, 0xFF29, 0xF6A9, 0xF646, 0xF689, 0xFEA9, 0xF689,
+    0xF628, 0xEC84, 0xEC63, 0xEC63, 0xE423, 0x28A1, 0x2061, 0x1861,
+    0x1841, 0x1020, 0x0820, 0x0800, 0x0820, 0x0000, 0x0020, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0800,
+    0x0820, 0x1020, 0x1841, 0x1041, 0x2061, 0x28A1, 0x28A1, 0x4122,
+    0xEC23, 0xEC63, 0xECC2, 0xECC4, 0xF505, 0xF6A9, 0xF6C9, 0xFF29,
+    0xFF09, 0xF6A7, 0xF645, 0xF5E5, 0xF5C4, 0xF5C4, 0xF689, 0xF6A9,
+    0xFEA9, 0xECC2, 0xEC63, 0xF463, 0xEC43, 0x28A1, 0x2081, 0x2061,
+    0x1841, 0x1020, 0x1020, 0x0800, 0x0820, 0x0000, 0x0020, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0800, 0x0820,
+    0x0820, 0x1020, 0x1841, 0x2061, 0x2081, 0x2881, 0x30C1, 0x9AE1,
+    0xF483, 0xECC2, 0xF4A2, 0xED03, 0xF583, 0xF6C9, 0xF6C9, 0xFEA9,
+    0xF666, 0xF685, 0xF646, 0xF624, 0xF5A4, 0xF5C4, 0xF646, 0xFEA9,
+    0xF6A9, 0xECC4, 0xECA2, 0xEC63, 0xDC21, 0x2081, 0x2081, 0x2061,
+    0x1041, 0x1020, 0x1020, 0x0800, 0x0000, 0x0020, 0x0000, 0x0020,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0800,
+    0x0820, 0x1020, 0x1841, 0x1861, 0x2081, 0x2881, 0x30C2, 0xEC23,
+    0xEC63, 0xECC2, 0xECA2, 0xF503, 0xF5E5, 0xF6C9, 0xF646, 0xF624,
+    0xF685, 0xFE85, 0xF685, 0xF645, 0xF5E4, 0xF5C4, 0xF5C4, 0xF689,
+    0xF6A9, 0xF503, 0xF4C2, 0xEC83, 0xB381, 0x28A1, 0x2081, 0x2061,
+    0x1841, 0x1020, 0x1020, 0x0800, 0x0820, 0x0000, 0x0020, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0820, 0x0800,
+    0x0820, 0x1020, 0x1841, 0x2061, 0x2081, 0x28A1, 0x69A1, 0xEC83,
+    0xEC82, 0xECC2, 0xF503, 0xED03, 0xF646, 0xF5C4, 0xF5C4, 0xF624,
+    0xF685, 0xE6A5, 0xDE45, 0xFE45, 0xF5E4, 0xF5C4, 0xF583, 0xF628,
+    0xF6A9, 0xF503, 0xECA2, 0xE482, 0x8A82, 0x28A1, 0x2081, 0x2061,
+    0x1041, 0x1020, 0x1020, 0x0800, 0x0000, 0x0020, 0x0000, 0x0020,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0800,
+    0x0820, 0x1020, 0x1841, 0x1861, 0x2081, 0x2881, 0x8A62, 0xEC63,
+    0xECC2, 0xF4A2, 0xED03, 0xED03, 0xF583, 0xF583, 0xF5C4, 0xEE03,
+    0xB503, 0xB545, 0xB503, 0xA4C4, 0xDD85, 0xF5C4, 0xF583, 0xF5C4,
+    0xF6A9, 0xF503, 0xECC2, 0xF4C2, 0x69C1, 0x30A1, 0x2081, 0x2061,
+    0x1841, 0x1020, 0x1020, 0x0800, 0x0820, 0x0000, 0x0020, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0800,
+    0x1020, 0x1020, 0x1841, 0x1041, 0x2061, 0x28A1, 0xB381, 0xECA2,
+    0xECC2, 0xECA2, 0xF503, 0xED03, 0xF543, 0xF583, 0xED84, 0xAC43,
+    0x9443, 0xA4C4, 0xA4A4, 0x9423, 0x9BC3, 0xED84, 0xF583, 0xF563,
+    0xF605, 0xED03, 0xF4A2, 0xDC21, 0x30E2, 0x28A1, 0x2081, 0x1861,
+    0x1841, 0x1020, 0x0820, 0x0800, 0x0800, 0x0020, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0800,
+    0x0800, 0x1020, 0x1841, 0x1841, 0x1861, 0x2081, 0xCB82, 0xECC2,
+    0xECA2, 0xECC2, 0xF503, 0xF503, 0xF563, 0xF583, 0xAC43, 0x8B83,
+    0x9423, 0x9C43, 0x9423, 0x9BC3, 0x8B83, 0xBCC2, 0xF583, 0xF543,
+    0xED03, 0xF503, 0xF4C2, 0x9B01, 0x30C1, 0x30A1, 0x2081, 0x2061,
+    0x1841, 0x1020, 0x0820, 0x0800, 0x0820, 0x0000, 0x0020, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0820,
+    0x0800, 0x1020, 0x1020, 0x1041, 0x2061, 0x28A1, 0xCC21, 0xECA1,
+    0xF4A2, 0xECC2, 0xED03, 0xF503, 0xF543, 0xD4A3, 0x8323, 0x8B83,
+    0x8B83, 0x9BC3, 0x8B83, 0x8B83, 0x8303, 0xAC43, 0xF563, 0xF543,
+    0xF503, 0xED03, 0xECA1, 0x4962, 0x28A1, 0x28A1, 0x2061, 0x2061,
+    0x1041, 0x1020, 0x0820, 0x0800, 0x0820, 0x0000, 0x0020, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0800,
+    0x0800, 0x0820, 0x1020, 0x1841, 0x1861, 0x1861, 0xCBA2, 0xF4C1,
+    0xECC1, 0xF4C1, 0xF502, 0xF502, 0xF543, 0x8323, 0x72C3, 0x8303,
+    0x8323, 0x8B83, 0x8B83, 0x8303, 0x72C3, 0x9BC3, 0xF563, 0xF543,
+    0xF502, 0xF522, 0x9AE1, 0x38E2, 0x30C1, 0x2881, 0x2881, 0x1861,
+    0x1841, 0x1020, 0x0820, 0x0820, 0x0800, 0x0020, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0820,
+    0x0800, 0x0820, 0x1020, 0x1841, 0x1861, 0x2881, 0xB381, 0xF4C1,
+    0xECC1, 0xF4C1, 0xF502, 0xF502, 0xD4C3, 0x6223, 0x6A82, 0x72C3,
+    0x72C3, 0x8303, 0x8323, 0x7AC3, 0x72C3, 0x9B23, 0xF543, 0xF542,
+    0xF502, 0xD442, 0x4122, 0x30E2, 0x28A1, 0x28A1, 0x2061, 0x1041,
+    0x1841, 0x1020, 0x0820, 0x0800, 0x0020, 0x0000, 0x0020, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0820,
+    0x0800, 0x0820, 0x1020, 0x1841, 0x1041, 0x2061, 0x7A81, 0xECC1,
+    0xECC1, 0xF502, 0xF502, 0xF502, 0xB381, 0x6223, 0x6223, 0x7282,
+    0x72C3, 0x7AC3, 0x72C3, 0x6A82, 0x6284, 0x9B81, 0xF543, 0xF521,
+    0xF502, 0x6A21, 0x3902, 0x30C1, 0x28A1, 0x2081, 0x2061, 0x1841,
+    0x1020, 0x0820, 0x0800, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000,
+    0x0820, 0x0820, 0x1020, 0x1841, 0x1841, 0x2061, 0x4121, 0xF4E1,
+    0xF4C1, 0xF4C1, 0xF502, 0xED02, 0x9323, 0x51A2, 0x6223, 0x6223,
+    0x6223, 0x7A42, 0x6223, 0x6223, 0x6223, 0xAB81, 0xF542, 0xF521,
+    0x9303, 0x3902, 0x38E2, 0x30C1, 0x28A1, 0x2061, 0x1861, 0x1841,
+    0x1020, 0x0820, 0x0800, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020,
+    0x0800, 0x0820, 0x0820, 0x1020, 0x1841, 0x1861, 0x2061, 0x8A82,
+    0xF4C1, 0xECC1, 0xF502, 0xF502, 0x9B23, 0x59C2, 0x51A2, 0x6223,
+    0x6223, 0x6223, 0x6223, 0x6223, 0x51A2, 0xBC02, 0xF542, 0xB381,
+    0x4142, 0x3902, 0x30C1, 0x30A1, 0x2081, 0x2061, 0x1841, 0x1041,
+    0x1020, 0x0820, 0x0820, 0x0800, 0x0020, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0800,
+    0x0820, 0x0800, 0x0820, 0x1020, 0x1041, 0x1841, 0x2061, 0x28A1,
+    0xB381, 0xF4C1, 0xF502, 0xF502, 0xB402, 0x4962, 0x51A2, 0x59A2,
+    0x51C2, 0x59A2, 0x51C2, 0x59A2, 0x51C2, 0xDCC3, 0xD442, 0x4122,
+    0x3902, 0x38E2, 0x30C1, 0x28A1, 0x2061, 0x1861, 0x1841, 0x1020,
+    0x0820, 0x0820, 0x0800, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,
+    0x0800, 0x0800, 0x0820, 0x1020, 0x1841, 0x1041, 0x1861, 0x2081,
+    0x28A1, 0x9AE1, 0xF502, 0xF502, 0xF4C1, 0x5162, 0x4962, 0x5162,
+    0x4962, 0x59C2, 0x51A2, 0x5162, 0x51A2, 0xD462, 0x5162, 0x3922,
+    0x38E2, 0x30C1, 0x30A1, 0x28A1, 0x1861, 0x2061, 0x1841, 0x1020,
+    0x0820, 0x0800, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000,
+    0x0020, 0x0800, 0x0820, 0x0820, 0x1020, 0x1841, 0x2061, 0x2081,
+    0x2081, 0x30A1, 0x59C1, 0xD462, 0xF521, 0x9B61, 0x4122, 0x4962,
+    0x4962, 0x5162, 0x4962, 0x5162, 0x7242, 0x59C2, 0x3902, 0x30E2,
+    0x30C1, 0x30A1, 0x28A1, 0x2081, 0x2061, 0x1041, 0x1020, 0x1020,
+    0x0820, 0x0800, 0x0800, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,
+    0x0000, 0x0020, 0x0800, 0x0820, 0x1020, 0x1841, 0x1841, 0x1861,
+    0x2061, 0x28A1, 0x30A1, 0x30E2, 0x7A42, 0xBC02, 0x6201, 0x4942,
+    0x4122, 0x4142, 0x4122, 0x4942, 0x4142, 0x3902, 0x38E2, 0x38E2,
+    0x28A1, 0x28A1, 0x2081, 0x2061, 0x1841, 0x1841, 0x1020, 0x0820,
+    0x0000, 0x0820, 0x0800, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,
+    0x0800, 0x0820, 0x0800, 0x0020, 0x1020, 0x1020, 0x1841, 0x2061,
+    0x1861, 0x2081, 0x2881, 0x30A1, 0x30C1, 0x38E2, 0x4102, 0x40E2,
+    0x3922, 0x40E2, 0x4102, 0x38E2, 0x4102, 0x38E2, 0x30C1, 0x30C1,
+    0x28A1, 0x28A1, 0x2081, 0x2061, 0x1041, 0x1020, 0x1020, 0x0820,
+    0x0800, 0x0800, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0020, 0x0800, 0x0820, 0x0800, 0x0820, 0x1020, 0x1041, 0x1841,
+    0x2061, 0x2061, 0x28A1, 0x28C1, 0x30C1, 0x38E2, 0x38E2, 0x30E2,
+    0x40E2, 0x4102, 0x40E2, 0x30E2, 0x38E2, 0x30C1, 0x30C1, 0x30A1,
+    0x28A1, 0x2081, 0x2061, 0x1041, 0x1841, 0x1020, 0x1020, 0x0820,
+    0x0800, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,
+    0x0000, 0x0020, 0x0800, 0x0820, 0x0820, 0x1020, 0x1020, 0x1841,
+    0x2061, 0x2081, 0x2061, 0x28A1, 0x30A1, 0x30C1, 0x30C1, 0x30E2,
+    0x38E2, 0x38E2, 0x38E2, 0x30E2, 0x30C1, 0x30C1, 0x30A1, 0x28A1,
+    0x2081, 0x2061, 0x1861, 0x1841, 0x1020, 0x1020, 0x0820, 0x0800,
+    0x0000, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0020, 0x0000, 0x0020, 0x0800, 0x0820, 0x1020, 0x1020, 0x1841,
+    0x2061, 0x1861, 0x2061, 0x28A1, 0x28A1, 0x30A1, 0x30C1, 0x30C1,
+    0x30C1, 0x30C1, 0x30C1, 0x30C1, 0x30C1, 0x28A1, 0x2881, 0x4121,
+    0xD442, 0xCC21, 0x2081, 0x1841, 0x1020, 0x1020, 0x0820, 0x0000,
+    0x0820, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0020, 0x0800, 0x0820, 0x0820, 0x1020, 0x1020, 0x1841,
+    0x1841, 0x2061, 0x2081, 0x2061, 0x28A1, 0x6A01, 0xBC02, 0x51C1,
+    0x30C1, 0x30C1, 0x30C1, 0x30C1, 0x28A1, 0x28A1, 0x2881, 0x28A1,
+    0xCC01, 0xF542, 0x8281, 0x1041, 0x1020, 0x1020, 0x0800, 0x0020,
+    0x0800, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0020, 0x0000, 0x0820, 0x0800, 0x0820, 0x1020, 0x1020, 0x1041,
+    0x1841, 0x1861, 0x2061, 0x2061, 0xAB81, 0xF582, 0xFD82, 0x51C1,
+    0x30C1, 0x30C1, 0x30C1, 0x30C1, 0x30A1, 0x2881, 0x28A1, 0x2061,
+    0x4181, 0xF5A1, 0xC402, 0x1041, 0x1020, 0x0820, 0x0800, 0x0820,
+    0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0020, 0x0800, 0x0820, 0x0820, 0x1020, 0x1020, 0x1841,
+    0x1841, 0x2061, 0x2081, 0x8323, 0xF582, 0xF562, 0xF5A2, 0x4962,
+    0x30A1, 0x30C1, 0x30C1, 0x30C1, 0x28A1, 0x28A1, 0x28A1, 0x2061,
+    0x2061, 0xDCE1, 0xCCA1, 0x0820, 0x1020, 0x0820, 0x0800, 0x0000,
+    0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0020, 0x0000, 0x0820, 0x0800, 0x0820, 0x1020, 0x1020, 0x1041,
+    0x2061, 0x1861, 0x2881, 0xE542, 0xF5A2, 0xF5A2, 0xF5A2, 0x59C2,
+    0x30C1, 0x30C1, 0x30C1, 0x30C1, 0x30A1, 0x28A1, 0x2881, 0x2081,
+    0x1861, 0x9B81, 0xBC02, 0x1020, 0x1020, 0x0820, 0x0800, 0x0820,
+    0x0800, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,
+    0x0000, 0x0820, 0x0800, 0x0820, 0x0820, 0x1020, 0x1041, 0x1841,
+    0x2061, 0x2081, 0x4981, 0xFDC2, 0xF5C2, 0xF5C2, 0xF5C2, 0x6201,
+    0x30E2, 0x38E2, 0x30C1, 0x30C1, 0x30C1, 0x28A1, 0x28A1, 0x2081,
+    0x2061, 0x82A1, 0x8B21, 0x1020, 0x1020, 0x0820, 0x0800, 0x0000,
+    0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000,
+    0x0020, 0x0800, 0x0800, 0x0820, 0x1020, 0x1020, 0x1041, 0x2061,
+    0x2081, 0x2061, 0x6221, 0xF5C2, 0xF5C2, 0xF5C2, 0xF5C2, 0x82A1,
+    0x38E2, 0x30E2, 0x38E2, 0x38E2, 0x30C1, 0x28A1, 0x2881, 0x28A1,
+    0x2061, 0x6A21, 0x4121, 0x1841, 0x1020, 0x0820, 0x0820, 0x0800,
+    0x0020, 0x0800, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,
+    0x0800, 0x0820, 0x0800, 0x0820, 0x1020, 0x1041, 0x1841, 0x2061,
+    0x2081, 0x28A1, 0x7282, 0xF5E2, 0xF5E2, 0xF602, 0xF602, 0x9BA3,
+    0x3902, 0x3902, 0x4102, 0x40E2, 0x38E2, 0x30C1, 0x28C1, 0x28A1,
+    0x2061, 0x30A1, 0x1861, 0x1841, 0x1020, 0x1020, 0x0820, 0x0820,
+    0x0800, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020,
+    0x0000, 0x0800, 0x0820, 0x1020, 0x1841, 0x1841, 0x1861, 0x2081,
+    0x30C1, 0x3902, 0x8B21, 0xF602, 0xF602, 0xF602, 0xF602, 0xE5A2,
+    0x4942, 0x4122, 0x4142, 0x4942, 0x3902, 0x3922, 0x38E2, 0x28A1,
+    0x2881, 0x2081, 0x2061, 0x1841, 0x1020, 0x1020, 0x0820, 0x0820,
+    0x0800, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0800,
+    0x0820, 0x0800, 0x0820, 0x1020, 0x1841, 0x2061, 0x2081, 0x8B21,
+    0xE5C2, 0xF602, 0xF5E2, 0xFE23, 0xF623, 0xF603, 0xF643, 0xFE43,
+    0x8B21, 0x4183, 0x4962, 0x5162, 0x4122, 0x4122, 0x3902, 0x38E2,
+    0x30C1, 0x28A1, 0x2081, 0x2061, 0x1041, 0x1020, 0x0820, 0x0800,
+    0x0800, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0800,
+    0x0800, 0x0820, 0x1020, 0x1041, 0x2061, 0x1881, 0xAC43, 0xF5E2,
+    0xF622, 0xF642, 0xF622, 0xF643, 0xF643, 0xF643, 0xFE43, 0xF664,
+    0xF603, 0x72C3, 0x59C2, 0x51C2, 0x4983, 0x5162, 0x4142, 0x3902,
+    0x38E2, 0x30A1, 0x28A1, 0x1861, 0x1841, 0x1020, 0x0820, 0x0820,
+    0x0820, 0x0800, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0800,
+    0x0820, 0x0820, 0x1841, 0x1841, 0x2061, 0x8B41, 0xFE22, 0xF642,
+    0xF642, 0xF643, 0xF643, 0xF664, 0xFE85, 0xF6A7, 0xF663, 0xFE84,
+    0xF684, 0xF663, 0xBCA2, 0x8303, 0x6223, 0x6223, 0x6223, 0x6223,
+    0x3902, 0x30E2, 0x28A1, 0x2081, 0x2061, 0x1841, 0x1020, 0x0820,
+    0x0800, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0800,
+    0x0820, 0x1020, 0x1041, 0x2061, 0x4161, 0xF622, 0xF622, 0xF643,
+    0xF663, 0xF644, 0xF664, 0xF6A7, 0xFF33, 0xFF74, 0xF6C9, 0xF6A4,
+    0xF684, 0xFE84, 0xF684, 0xF684, 0xF684, 0xFE83, 0xF683, 0xFE64,
+    0xE602, 0x6A82, 0x30C1, 0x28A1, 0x2061, 0x1841, 0x1841, 0x1020,
+    0x0820, 0x0820, 0x0800, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x0800, 0x0820,
+    0x0820, 0x1041, 0x2061, 0x2081, 0xAC63, 0xFE62, 0xF662, 0xFE83,
+    0xF663, 0xF684, 0xFEA7, 0xFF53, 0xF774, 0xFF74, 0xF6CD, 0xFEE5,
+    0xFEC5, 0xF6E5, 0xFEC5, 0xF6A4, 0xF6A4, 0xF684, 0xF684, 0xFE83,
+    0xF663, 0xEE43, 0x6201, 0x28A1, 0x2061, 0x1861, 0x1841, 0x1020,
+    0x0820, 0x0800, 0x0800, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0800, 0x0820,
+    0x1020, 0x1841, 0x1881, 0x20C1, 0xF643, 0xF642, 0xF683, 0xF683,
+    0xF684, 0xF6A4, 0xFF31, 0xFF74, 0xF774, 0xFF74, 0xFF31, 0xF707,
+    0xF727, 0xF6E5, 0xFEC5, 0xF6E5, 0xFEC5, 0xFEC4, 0xF6A4, 0xF684,
+    0xF683, 0xFE83, 0xE5C2, 0x3901, 0x28A1, 0x2881, 0x1041, 0x1020,
+    0x0820, 0x0800, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x0800, 0x1020,
+    0x1041, 0x20A1, 0x1881, 0x6A21, 0xFEA2, 0xFE83, 0xF683, 0xF684,
+    0xF6A4, 0xFF09, 0xFF74, 0xFF74, 0xFF74, 0xFF95, 0xF7B5, 0xFF4C,
+    0xF707, 0xFF27, 0xF707, 0xFF27, 0xF707, 0xFEE5, 0xF6E5, 0xFEC4,
+    0xF6A4, 0xF684, 0xF682, 0x8B63, 0x28C1, 0x2081, 0x1861, 0x1841,
+    0x1020, 0x0820, 0x0000, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0800, 0x0820, 0x1020,
+    0x1041, 0x1881, 0x2881, 0x8B63, 0xF682, 0xF684, 0xF6A4, 0xFEC4,
+    0xF6C5, 0xFF53, 0xF774, 0xFFB5, 0xFF95, 0xFFB5, 0xFF95, 0xFF95,
+    0xF74E, 0xFF29, 0xF707, 0xFF27, 0xF707, 0xFF07, 0xF705, 0xFEE5,
+    0xF6C4, 0xFEA4, 0xFEA4, 0xE5A2, 0x30E2, 0x28A1, 0x20A1, 0x1841,
+    0x1020, 0x0820, 0x0800, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0840, 0x1020,
+    0x18A0, 0x2081, 0x28E1, 0xAC43, 0xFEC2, 0xFEC4, 0xF6C4, 0xFEE5,
+    0xF6E8, 0xFF95, 0xFFB5, 0xFF95, 0xFFB5, 0xFFB6, 0xFF96, 0xFFB6,
+    0xFF96, 0xF795, 0xFFB0, 0xF74E, 0xFF4A, 0xFF27, 0xF707, 0xF705,
+    0xFEE5, 0xF6C4, 0xFEA4, 0xF6A2, 0x6A82, 0x28A1, 0x1881, 0x2061,
+    0x1041, 0x0820, 0x0800, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0020, 0x0800, 0x0840, 0x0820, 0x1841,
+    0x1881, 0x18C1, 0x28C1, 0xAC23, 0xF6C3, 0xFEE5, 0xF6E5, 0xFF05,
+    0xF74C, 0xFF95, 0xFF95, 0xFFB6, 0xFF96, 0xFFD6, 0xFFB6, 0xFFD6,
+    0xFFB6, 0xFFD6, 0xFF96, 0xFFB6, 0xFFB6, 0xFFB0, 0xF6E8, 0xFF07,
+    0xF705, 0xFEE5, 0xFEE4, 0xFEC3, 0xAC43, 0x28E1, 0x28A1, 0x20A1,
+    0x1841, 0x1020, 0x0820, 0x0800, 0x0020, 0x0800, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0840, 0x1020, 0x1060,
+    0x2081, 0x28E1, 0x2922, 0x9C43, 0xFEE4, 0xFEE5, 0xF705, 0xFF07,
+    0xFF4C, 0xFFB6, 0xFFB6, 0xFF96, 0xFFD6, 0xFFB6, 0xFFD7, 0xFFB7,
+    0xFFD7, 0xFFB7, 0xFFD7, 0xFFB6, 0xFFB6, 0xFF96, 0xFF94, 0xF748,
+    0xFF27, 0xF705, 0xFEE5, 0xF6C4, 0xE602, 0x30C2, 0x2881, 0x1881,
+    0x1041, 0x1020, 0x0820, 0x0800, 0x0020, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0840, 0x0840, 0x18A0,
+    0x18C1, 0x28C1, 0x3101, 0x8303, 0xF6E5, 0xFF05, 0xF726, 0xFF07,
+    0xF74C, 0xFF96, 0xFFB6, 0xFFB7, 0xFFB7, 0xFFD7, 0xFFD7, 0xF7D7,
+    0xFFD7, 0xFFD7, 0xFFB7, 0xFFD7, 0xFFB6, 0xFFB6, 0xFFB5, 0xFFB0,
+    0xF707, 0xFF26, 0xF705, 0xFF04, 0xFEE3, 0x4981, 0x28E1, 0x2081,
+    0x2061, 0x1020, 0x0820, 0x0820, 0x0000, 0x0820, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x0820, 0x1841, 0x18A0,
+    0x20C1, 0x28E1, 0x3162, 0x5A44, 0xFF05, 0xFF26, 0xFF27, 0xFF48,
+    0xF74C, 0xFFB6, 0xFFB7, 0xFFB7, 0xFFD8, 0xFFD8, 0xFFD8, 0xFFD8,
+    0xFFD8, 0xFFD8, 0xFFD8, 0xFFD7, 0xFFD7, 0xFFD6, 0xFFB6, 0xFF95,
+    0xF769, 0xFF07, 0xF726, 0xFF04, 0xF6E4, 0x5AA3, 0x28C1, 0x1881,
+    0x2081, 0x1020, 0x0820, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0020, 0x0840, 0x0840, 0x1060, 0x18A0,
+    0x20C1, 0x2922, 0x3162, 0x4163, 0xDE45, 0xFF26, 0xFF47, 0xF769,
+    0xFF4A, 0xFFB6, 0xFFD7, 0xFFD8, 0xFFD8, 0xFFD8, 0xFFF9, 0xFFD9,
+    0xFFF9, 0xFFD9, 0xFFD8, 0xFFD8, 0xFFD7, 0xFFD7, 0xFFB6, 0xFFD5,
+    0xFF4C, 0xF747, 0xFF26, 0xFF05, 0xFF04, 0x6B23, 0x28E1, 0x20C1,
+    0x20A1, 0x1841, 0x0820, 0x0800, 0x0020, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0020, 0x0020, 0x0840, 0x0840, 0x1080, 0x18A0,
+    0x28E1, 0x3122, 0x3982, 0x49E3, 0xA4C4, 0xFF67, 0xFF48, 0xFF69,
+    0xFF4A, 0xFFB4, 0xFFD8, 0xFFD8, 0xFFD9, 0xFFF9, 0xFFDA, 0xFFFA,
+    0xFFDA, 0xFFF9, 0xFFD9, 0xFFD8, 0xFFD8, 0xFFD7, 0xFFD7, 0xFFD6,
+    0xFFB0, 0xF747, 0xFF46, 0xFF06, 0xF704, 0x7364, 0x2902, 0x18C1,
+    0x2081, 0x1041, 0x1020, 0x0800, 0x0020, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0020, 0x0840, 0x0840, 0x18A0, 0x20C1,
+    0x2101, 0x2922, 0x3982, 0x49E3, 0x6B07, 0xFF47, 0xFF69, 0xFF4A,
+    0xF78C, 0xFFB0, 0xFFD8, 0xFFF9, 0xFFD9, 0xFFFA, 0xFFDA, 0xFFFB,
+    0xFFDB, 0xFFFA, 0xFFDA, 0xFFF9, 0xFFD8, 0xFFD8, 0xFFB7, 0xFFD6,
+    0xFFD2, 0xFF48, 0xFF46, 0xFF45, 0xFF44, 0x7384, 0x3122, 0x28E1,
+    0x20A1, 0x1841, 0x0820, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0020, 0x0020, 0x0840, 0x0840, 0x18A0, 0x20C1,
+    0x2901, 0x3162, 0x3982, 0x4A03, 0x6A84, 0xD668, 0xFF69, 0xFF4A,
+    0xFF8C, 0xFFAF, 0xFFD8, 0xFFF9, 0xFFDA, 0xFFFB, 0xFFDB, 0xFFFC,
+    0xFFFC, 0xFFDB, 0xFFDA, 0xFFF9, 0xFFD9, 0xFFD8, 0xFFD7, 0xFFD7,
+    0xFFB0, 0xF748, 0xFF47, 0xFF46, 0xF744, 0x6303, 0x2922, 0x28C1,
+    0x1881, 0x1080, 0x1020, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0020, 0x0840, 0x0840, 0x18A0, 0x20C1,
+    0x2101, 0x3162, 0x4983, 0x5224, 0x6264, 0xA4C4, 0xF749, 0xFF8B,
+    0xFF8D, 0xFFAF, 0xFFD6, 0xFFFA, 0xFFDB, 0xFFDC, 0xFFFD, 0xFFFD,
+    0xFFFD, 0xFFFC, 0xFFFB, 0xFFDA, 0xFFF9, 0xFFD8, 0xF7D7, 0xFFD7,
+    0xFFB0, 0xFF88, 0xFF47, 0xFF46, 0xFF45, 0x62A3, 0x3122, 0x28E1,
+    0x2081, 0x1080, 0x1020, 0x0020, 0x0820, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0020, 0x0020, 0x0840, 0x0840, 0x18A0, 0x20C1,
+    0x2901, 0x3162, 0x4983, 0x5244, 0x6A84, 0x7307, 0xFF69, 0xFFAC,
+    0xFF8D, 0xFFB0, 0xFFD4, 0xFFDB, 0xFFFC, 0xFFFD, 0xFFFE, 0xFFFE,
+    0xFFFE, 0xFFFD, 0xFFDC, 0xFFDB, 0xFFF9, 0xFFD8, 0xFFD8, 0xFFD7,
+    0xFFAF, 0xF788, 0xFF88, 0xFF46, 0xFF45, 0x4163, 0x2922, 0x28E1,
+    0x1881, 0x1080, 0x1020, 0x0020, 0x0800, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0020, 0x0820, 0x1080, 0x10A0, 0x20C1,
+    0x2901, 0x3162, 0x41C2, 0x5224, 0x6284, 0x6B07, 0xDEC8, 0xFF8C,
+    0xF78D, 0xFFB0, 0xFFD2, 0xFFDB, 0xFFDC, 0xFFFD, 0xFFFE, 0xFFFE,
+    0xFFFE, 0xFFFD, 0xFFFC, 0xFFFB, 0xFFDA, 0xFFD8, 0xFFD7, 0xFFD7,
+    0xFF8B, 0xFF89, 0xFF88, 0xFF86, 0xEEC5, 0x39A2, 0x2922, 0x28E1,
+    0x2081, 0x1080, 0x1020, 0x0020, 0x0800, 0x0020, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0020, 0x0820, 0x0840, 0x1060, 0x18A0, 0x18C1,
+    0x2901, 0x3162, 0x3982, 0x4A03, 0x6A84, 0x7307, 0xD668, 0xFFAC,
+    0xFF8D, 0xFFB0, 0xFFB2, 0xFFFA, 0xFFFC, 0xFFFD, 0xFFFE, 0xFFFE,
+    0xFFFE, 0xFFFD, 0xFFDC, 0xFFDB, 0xFFFA, 0xFFD8, 0xFFD8, 0xFFD5,
+    0xFF8A, 0xFF89, 0xF788, 0xF766, 0xC5A5, 0x3182, 0x2922, 0x28E1,
+    0x2081, 0x1080, 0x0820, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0020, 0x0840, 0x0840, 0x18A0, 0x18C1,
+    0x2901, 0x3162, 0x3982, 0x49E3, 0x6A84, 0x6B07, 0xCE68, 0xF78C,
+    0xFFAD, 0xFFB0, 0xFFB2, 0xFFD8, 0xFFFC, 0xFFFD, 0xFFFE, 0xFFFE,
+    0xFFFE, 0xFFFD, 0xFFFC, 0xFFDB, 0xFFF9, 0xFFD8, 0xFFD8, 0xFFB0,
+    0xFFAB, 0xFF89, 0xFF88, 0xFF86, 0x9465, 0x3982, 0x3122, 0x18C1,
+    0x2081, 0x1080, 0x1020, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0020, 0x0820, 0x0840, 0x0840, 0x1080, 0x20C1,
+    0x2101, 0x3122, 0x3982, 0x49E3, 0x5A44, 0x7307, 0xF76A, 0xFFAC,
+    0xFFAD, 0xFFB0, 0xF7D2, 0xFFD8, 0xFFDB, 0xFFFC, 0xFFFD, 0xFFFD,
+    0xFFFD, 0xFFFC, 0xFFDB, 0xFFDA, 0xFFF9, 0xFFD8, 0xFFD8, 0xFF8D,
+    0xFF8B, 0xFF89, 0xF788, 0xFF87, 0x5AA3, 0x3162, 0x2922, 0x20C1,
+    0x1881, 0x1060, 0x0840, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0020, 0x0840, 0x0840, 0x1080, 0x20C1,
+    0x2901, 0x2922, 0x3982, 0x41E3, 0x6B07, 0xDEC8, 0xFFAA, 0xFF8C,
+    0xFFAD, 0xF7AF, 0xFFB0, 0xFFD8, 0xFFFB, 0xFFDB, 0xFFDC, 0xFFFC,
+    0xFFFC, 0xFFDB, 0xFFFB, 0xFFDA, 0xFFF9, 0xFFD8, 0xFFD4, 0xFF8C,
+    0xFFAB, 0xFF89, 0xFF88, 0xE707, 0x4983, 0x3962, 0x2101, 0x20C1,
+    0x18A0, 0x1080, 0x0840, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0020, 0x0840, 0x0840, 0x1080, 0x18A0,
+    0x20C1, 0x3122, 0x3162, 0x49E3, 0xCE46, 0xFF89, 0xFFAA, 0xFF8C,
+    0xFFAD, 0xFFAF, 0xFFD2, 0xFFD9, 0xFFFA, 0xFFDB, 0xFFFB, 0xFFDB,
+    0xFFFB, 0xFFDA, 0xFFFA, 0xFFD9, 0xFFD8, 0xFFD8, 0xFFB0, 0xF7CC,
+    0xFF8A, 0xFF89, 0xF788, 0xA4C4, 0x3982, 0x2922, 0x28C1, 0x18C1,
+    0x18A0, 0x1020, 0x0820, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0020, 0x0840, 0x0840, 0x1060, 0x18A0,
+    0x18C1, 0x2101, 0x3142, 0x5224, 0xFF88, 0xFF89, 0xF7AA, 0xFF8B,
+    0xFFCC, 0xFFB0, 0xF7D7, 0xFFD8, 0xFFD9, 0xFFFA, 0xFFDA, 0xFFFA,
+    0xFFDA, 0xFFFA, 0xFFD9, 0xFFD8, 0xFFD8, 0xFFD7, 0xFFCD, 0xFF8B,
+    0xFFAA, 0xFF89, 0xFFA8, 0x62A3, 0x3962, 0x2922, 0x28E1, 0x18A0,
+    0x1080, 0x0840, 0x0840, 0x0800, 0x0020, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0820, 0x0020, 0x0840, 0x0840, 0x1080,
+    0x20C1, 0x2901, 0x2922, 0x7B84, 0xFF88, 0xFF89, 0xFFAA, 0xFFAB,
+    0xFFB2, 0xFFD7, 0xFFD8, 0xFFD8, 0xFFF9, 0xFFD9, 0xFFF9, 0xFFD9,
+    0xFFF9, 0xFFD9, 0xFFF9, 0xFFD8, 0xFFD8, 0xFFD7, 0xF7CD, 0xFF8B,
+    0xFFAA, 0xFF89, 0xC626, 0x3162, 0x3162, 0x2901, 0x18C1, 0x2081,
+    0x1080, 0x0840, 0x0020, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0840, 0x0840, 0x1080,
+    0x1880, 0x18C1, 0x2922, 0x8C45, 0xFF88, 0xF789, 0xFF89, 0xFFB0,
+    0xFFD7, 0xFFD7, 0xFFD7, 0xFFD8, 0xFFF8, 0xFFD8, 0xFFF8, 0xFFD9,
+    0xFFF8, 0xFFD8, 0xFFF8, 0xFFD8, 0xFFD7, 0xFFD7, 0xFFD5, 0xFFAA,
+    0xFF8A, 0xFFC8, 0x7384, 0x39A2, 0x3122, 0x28E1, 0x20C1, 0x18A0,
+    0x0840, 0x0840, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x0020, 0x0860, 0x1080,
+    0x18A0, 0x20C1, 0x2901, 0x9C43, 0xFF88, 0xFF88, 0xFFAA, 0xFFD6,
+    0xFFB6, 0xFFD7, 0xFFD7, 0xFFF7, 0xFFD8, 0xFFD8, 0xFFF8, 0xFFD8,
+    0xFFF8, 0xFFD8, 0xFFF8, 0xFFD7, 0xFFD7, 0xFFD7, 0xFFD6, 0xF7AD,
+    0xFFC9, 0xC606, 0x3982, 0x3162, 0x2922, 0x20C1, 0x1880, 0x1080,
+    0x0840, 0x0840, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0840, 0x0840,
+    0x1080, 0x1080, 0x18C1, 0x7BC4, 0xFFA7, 0xFFA8, 0xF7CC, 0xFFD6,
+    0xFFD6, 0xFFD6, 0xFFF7, 0xFFD7, 0xFFD7, 0xFFD7, 0xFFF8, 0xFFB2,
+    0xFFD2, 0xFFD7, 0xFFF7, 0xFFD7, 0xFFF7, 0xFFD6, 0xFFD6, 0xFFB0,
+    0xFFC9, 0x9465, 0x3982, 0x2922, 0x28E1, 0x20C1, 0x18A0, 0x1080,
+    0x0860, 0x0820, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0820, 0x0840, 0x0840,
+    0x1080, 0x18A0, 0x20C1, 0x62A3, 0xFFC7, 0xFFA8, 0xFF8B, 0xFFF6,
+    0xFFD6, 0xFFF6, 0xFFD6, 0xFFF7, 0xFFD7, 0xFFF7, 0xF7D4, 0xFFAD,
+    0xFFAD, 0xFFD5, 0xFFD7, 0xF7F7, 0xFFD6, 0xFFF6, 0xFFD6, 0xFFB0,
+    0xFFC9, 0x6303, 0x3162, 0x20E1, 0x20C1, 0x10A0, 0x1080, 0x0840,
+    0x0840, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0840,
+    0x0840, 0x1080, 0x1080, 0x2902, 0xF788, 0xFFA8, 0xFFC9, 0xFFD4,
+    0xFFD6, 0xFFF6, 0xFFD6, 0xFFF6, 0xF7D7, 0xFFF6, 0xFFAD, 0xDECB,
+    0xFFAC, 0xFFAF, 0xFFD7, 0xFFF6, 0xFFD6, 0xFFF6, 0xFFF6, 0xFFAF,
+    0xFFC9, 0x62A3, 0x3122, 0x28E1, 0x20A1, 0x18A0, 0x0840, 0x0840,
+    0x0020, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0820,
+    0x0840, 0x0860, 0x1080, 0x18A0, 0xCE26, 0xFFA8, 0xFFA8, 0xFFB0,
+    0xFFD6, 0xFFD6, 0xFFF6, 0xFFD6, 0xFFF6, 0xFFB2, 0xEF6A, 0x6264,
+    0xEF2B, 0xFFCC, 0xFFD6, 0xFFF6, 0xFFD6, 0xFFF6, 0xFFD6, 0xFFCD,
+    0xFFC9, 0x4A42, 0x20E1, 0x18C1, 0x18A0, 0x1080, 0x0840, 0x0840,
+    0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x0020,
+    0x0840, 0x0840, 0x0880, 0x1080, 0x7BC4, 0xFFA8, 0xFFA8, 0xFFCB,
+    0xFFD5, 0xFFD6, 0xFFF6, 0xFFD6, 0xFFF6, 0xFFAC, 0xD668, 0x5224,
+    0xA4A4, 0xFFCB, 0xFFB0, 0xFFF6, 0xFFD6, 0xFFD6, 0xFFD5, 0xFFEA,
+    0xFFC9, 0x5262, 0x20C1, 0x18A0, 0x1080, 0x0840, 0x0840, 0x0020,
+    0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,
+    0x0820, 0x0840, 0x0840, 0x1080, 0x2901, 0xF768, 0xFFC9, 0xFFC9,
+    0xFFAF, 0xFFD6, 0xFFD6, 0xFFF6, 0xFFB2, 0xFFCB, 0xAD49, 0x4183,
+    0x6284, 0xFFEA, 0xFFCB, 0xFFF6, 0xFFD6, 0xFFF6, 0xFFB0, 0xFFC9,
+    0xFFA9, 0x39C2, 0x10A0, 0x1060, 0x0840, 0x0840, 0x0020, 0x0020,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0020, 0x0020, 0x0840, 0x0840, 0x0860, 0x7364, 0xFFA8, 0xF7A9,
+    0xFFC9, 0xFFD2, 0xFFD6, 0xFFF6, 0xFFAD, 0xFFCA, 0x9465, 0x3162,
+    0x3162, 0xDEC8, 0xFFCA, 0xFFAF, 0xFFD6, 0xFFD2, 0xFFCA, 0xFFC9,
+    0xF768, 0x20C1, 0x1060, 0x1080, 0x0840, 0x0020, 0x0820, 0x0000,
+    0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0020, 0x0820, 0x0020, 0x0840, 0x0840, 0x1080, 0xBD65, 0xFFC9,
+    0xFFC9, 0xFFCA, 0xFFAF, 0xFFAF, 0xFFCA, 0xF7CA, 0x7BC4, 0x2902,
+    0x2922, 0xB565, 0xFFCA, 0xFFCA, 0xFFCC, 0xFFCA, 0xFFC9, 0xFFA9,
+    0x7BC4, 0x0860, 0x0840, 0x0840, 0x0020, 0x0820, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0820, 0x0020, 0x0040, 0x0840, 0x18A1, 0xB545,
+    0xFFC9, 0xFFCA, 0xFFCA, 0xFFCA, 0xFFCA, 0xFFEA, 0x7384, 0x2901,
+    0x20E1, 0x6303, 0xFFCA, 0xFFCA, 0xFFCA, 0xFFEA, 0xFFC9, 0x83C4,
+    0x1080, 0x0840, 0x0840, 0x0840, 0x0020, 0x0000, 0x0020, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0020, 0x0820, 0x0840, 0x0840, 0x0860,
+    0x5262, 0xCDC5, 0xF7A9, 0xFFCA, 0xFFCA, 0xEF6A, 0x4A42, 0x20C1,
+    0x18C1, 0x20C1, 0xE6C8, 0xFFEA, 0xFFCA, 0xCE68, 0x39C2, 0x0840,
+    0x0840, 0x0840, 0x0820, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0820, 0x0020, 0x0840,
+    0x0860, 0x0840, 0x1060, 0x2101, 0x2901, 0x18A0, 0x10A0, 0x18A0,
+    0x18A0, 0x18A0, 0x2101, 0x62A3, 0x41E2, 0x1080, 0x0840, 0x0840,
+    0x0840, 0x0020, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0820, 0x0020,
+    0x0840, 0x0820, 0x1040, 0x0840, 0x0860, 0x0840, 0x1060, 0x0840,
+    0x0860, 0x0840, 0x1060, 0x0840, 0x0860, 0x0840, 0x0820, 0x0020,
+    0x0800, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020,
+    0x0820, 0x0000, 0x0020, 0x0840, 0x0820, 0x0840, 0x0020, 0x0840,
+    0x0820, 0x0840, 0x0020, 0x0840, 0x0840, 0x0820, 0x0020, 0x0820,
+    0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0020, 0x0820, 0x0020, 0x0820, 0x0020, 0x0800, 0x0020, 0x0820,
+    0x0020, 0x0820, 0x0020, 0x0820, 0x0020, 0x0000, 0x0020, 0x0000,
+    0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0000, 0x0020, 0x0820,
+    0x0020, 0x0000, 0x0020, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020,
+    0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 },
+  { 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0020, 0x5141, 0x0020, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0020, 0x40E2, 0xDAA2, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0xAA82, 0xD2A2, 0x0800, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0020, 0x91E2, 0xAA82, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0020, 0x0820, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0000, 0x0020,
+    0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0800, 0x0020, 0x0000,
+    0x0020, 0x0800, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,
+    0x0800, 0x0020, 0x0800, 0x0020, 0x0800, 0x0820, 0x0800, 0x0820,
+    0x0000, 0x0820, 0x0000, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020,
+    0x0000, 0x0820, 0x0800, 0x0820, 0x0820, 0x0820, 0x0820, 0x1020,
+    0x0820, 0x0820, 0x0000, 0x0820, 0x0800, 0x0820, 0x0000, 0x0020,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0800,
+    0x0020, 0x0800, 0x0820, 0x0820, 0x0820, 0x1020, 0x1020, 0x1020,
+    0x1020, 0x1020, 0x1020, 0x0820, 0x0820, 0x0000, 0x0020, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0800,
+    0x0820, 0x0820, 0x1020, 0x1020, 0x1841, 0x1841, 0x1041, 0x1841,
+    0x1841, 0x1841, 0x1020, 0x0820, 0x0820, 0x0800, 0x0820, 0x0000,
+    0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0820, 0x0800,
+    0x0820, 0x1020, 0x1841, 0x1041, 0x2061, 0x2061, 0x1861, 0x2061,
+    0x5161, 0x5141, 0x1841, 0x1020, 0x1020, 0x0820, 0x0820, 0x0000,
+    0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0800, 0x0800, 0x0820,
+    0x1020, 0x1041, 0x1841, 0x1861, 0x2081, 0x2081, 0x5141, 0xD2A2,
+    0xE2E2, 0x30A1, 0x2061, 0x1041, 0x1841, 0x1020, 0x1020, 0x0820,
+    0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0020, 0x0800, 0x0020, 0x0820, 0x1020,
+    0x1841, 0x2061, 0x1861, 0x2881, 0x2881, 0x91E2, 0xE343, 0xE323,
+    0xAA62, 0x20A1, 0x2061, 0x1861, 0x1841, 0x1841, 0x1020, 0x0820,
+    0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x0800, 0x0820, 0x1041,
+    0x2061, 0x1861, 0x2881, 0x28A1, 0x89E2, 0xDB23, 0xE323, 0xE343,
+    0x91E2, 0x30C1, 0x2881, 0x2881, 0x1861, 0x1841, 0x1020, 0x0820,
+    0x0820, 0x0800, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0020, 0x0000, 0x0820, 0x0820, 0x1020, 0x1841,
+    0x1861, 0x2881, 0x28A1, 0x69A1, 0xEB83, 0xE383, 0xE383, 0xE383,
+    0xAA82, 0x30E2, 0x28C1, 0x28A1, 0x2081, 0x2061, 0x1841, 0x1020,
+    0x0820, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0820, 0x0800, 0x0820, 0x1041, 0x1861,
+    0x2081, 0x28A1, 0x4962, 0xE383, 0xE383, 0xE383, 0xEBE3, 0xE383,
+    0xE383, 0x5162, 0x3902, 0x30C1, 0x2881, 0x2081, 0x2061, 0x1020,
+    0x0820, 0x0820, 0x0800, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0020, 0x0000, 0x0820, 0x1020, 0x1841, 0x2061,
+    0x28A1, 0x30C1, 0xB282, 0xE383, 0xE3C3, 0xF547, 0xECC6, 0xE3C3,
+    0xE3E3, 0xC302, 0x4962, 0x3902, 0x30C1, 0x28A1, 0x1861, 0x1841,
+    0x1020, 0x0800, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0020, 0x0000, 0x0800, 0x0820, 0x1841, 0x1861, 0x2081,
+    0x28A1, 0x3902, 0xE383, 0xE3C3, 0xECC6, 0xEDE8, 0xF5A6, 0xEC24,
+    0xE424, 0xEC24, 0xEBE3, 0xC302, 0xC322, 0x91E2, 0x2081, 0x1841,
+    0x1020, 0x0820, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0020, 0x0800, 0x1020, 0x1841, 0x2061, 0x28A1,
+    0x30E2, 0x7A21, 0xEBC3, 0xEC44, 0xF547, 0xF5E8, 0xEDC8, 0xED47,
+    0xEC84, 0xEC24, 0xEC24, 0xE3C3, 0xE383, 0xE383, 0xA262, 0x1861,
+    0x1041, 0x0820, 0x0800, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0020, 0x0800, 0x1020, 0x1841, 0x2081, 0x28A1,
+    0x30C2, 0x9AE1, 0xE424, 0xEC24, 0xED47, 0xF628, 0xF648, 0xF628,
+    0xF5E8, 0xED47, 0xECC6, 0xEC24, 0xE3E3, 0xE383, 0xEB83, 0x4121,
+    0x1841, 0x1020, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0020, 0x0800, 0x0820, 0x1020, 0x1041, 0x2081, 0x30A1,
+    0x3902, 0xBB22, 0xEC44, 0xEC84, 0xF5E8, 0xF648, 0xF628, 0xF648,
+    0xF628, 0xF648, 0xF5C8, 0xF5A6, 0xE3C3, 0xE383, 0xE383, 0x89E2,
+    0x1041, 0x0820, 0x0800, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0800, 0x0820, 0x1020, 0x1041, 0x2081, 0x30C1,
+    0x3102, 0xB302, 0xEC24, 0xECC6, 0xEDC8, 0xF648, 0xF5E5, 0xF5E8,
+    0xF628, 0xF648, 0xF5C8, 0xF5E8, 0xECC6, 0xEBE3, 0xE383, 0xC322,
+    0x1841, 0x1020, 0x0820, 0x0800, 0x0020, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0020, 0x0800, 0x0820, 0x1020, 0x2061, 0x28A1, 0x30C1,
+    0x4142, 0xB322, 0xF484, 0xECC6, 0xF5A6, 0xF5A6, 0xF646, 0xF605,
+    0xF5A6, 0xF5A6, 0xEDC8, 0xF5E8, 0xED47, 0xE3C3, 0xE383, 0xE383,
+    0x1841, 0x0820, 0x0800, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0820, 0x1020, 0x2061, 0x2081, 0x30C1,
+    0x3902, 0x9303, 0xEC84, 0xECE4, 0xED44, 0xF605, 0xF646, 0xF646,
+    0xF5A6, 0xED05, 0xF5A6, 0xF5E8, 0xF5A6, 0xE3E3, 0xE383, 0xE383,
+    0x38E2, 0x1020, 0x0820, 0x0800, 0x0020, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0020, 0x0800, 0x0820, 0x1020, 0x2061, 0x2081, 0x30C1,
+    0x4942, 0x9282, 0xEC84, 0xF4E4, 0xED44, 0xF5A6, 0xF646, 0xDD85,
+    0xCCA4, 0xF505, 0xECC6, 0xED47, 0xF5A6, 0xE3C3, 0xE3C3, 0xE383,
+    0x4121, 0x0820, 0x0800, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0800, 0x0820, 0x1020, 0x1861, 0x2081, 0x30C1,
+    0x3902, 0x51A2, 0xEC84, 0xECE4, 0xED05, 0xF5A6, 0xE5A5, 0x9423,
+    0x8B83, 0x9BC3, 0xEC84, 0xECA4, 0xF5A6, 0xE3C3, 0xEBE3, 0xE383,
+    0x4921, 0x1020, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0020, 0x0800, 0x0820, 0x1020, 0x1841, 0x2881, 0x30C1,
+    0x3902, 0x5162, 0xB381, 0xECE4, 0xF525, 0xED44, 0xAC43, 0x8B83,
+    0x8303, 0x72C3, 0xB381, 0xEC63, 0xEC84, 0xE3C3, 0xE3C3, 0xE383,
+    0x30E2, 0x1020, 0x0800, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0020, 0x0000, 0x0800, 0x1020, 0x1841, 0x2081, 0x30A1,
+    0x3902, 0x4962, 0x7242, 0xEC84, 0xECE4, 0xF505, 0x8323, 0x8303,
+    0x72C3, 0x7242, 0x7242, 0xEC24, 0xEC44, 0xE3C3, 0xEBE3, 0xE383,
+    0x2061, 0x1020, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0820, 0x0800, 0x1020, 0x1041, 0x2061, 0x28C1,
+    0x38E2, 0x4142, 0x5162, 0xB322, 0xF4E4, 0xCCA4, 0x72A3, 0x72C3,
+    0x7A42, 0x6223, 0x51A2, 0xCBA2, 0xEC24, 0xEBC3, 0xE3E3, 0xB322,
+    0x1041, 0x0820, 0x0800, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0800, 0x1020, 0x1841, 0x1861, 0x28A1,
+    0x30C1, 0x40E2, 0x4962, 0x51A2, 0xEC84, 0xB381, 0x6223, 0x6223,
+    0x6223, 0x51C2, 0x51A2, 0xB322, 0xEC23, 0xEBE3, 0xEBE3, 0x69A1,
+    0x1020, 0x0820, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0820, 0x0800, 0x1020, 0x1041, 0x2061, 0x28A1,
+    0x30C1, 0x40E2, 0x4142, 0x5162, 0xEC44, 0x7242, 0x6223, 0x6223,
+    0x51A2, 0x59A2, 0x4962, 0xB322, 0xEC23, 0xEC23, 0xDB61, 0x1861,
+    0x1020, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0020, 0x0800, 0x1020, 0x1841, 0x2061, 0x2081,
+    0x28A1, 0x38E2, 0x38E2, 0x69A1, 0xEC44, 0x51A2, 0x59C2, 0x51A2,
+    0x5162, 0x4962, 0x4142, 0x9AE1, 0xEC23, 0xEBE3, 0x5141, 0x1841,
+    0x1020, 0x0820, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0020, 0x0000, 0x0820, 0x0800, 0x1020, 0x1020, 0x1861, 0x2881,
+    0x28A1, 0x30C1, 0x40E2, 0x7A21, 0x9282, 0x4962, 0x4962, 0x5162,
+    0x4962, 0x4122, 0x40E2, 0xB322, 0xEC43, 0x9282, 0x1861, 0x1041,
+    0x1020, 0x0800, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0020, 0x0000, 0x0020, 0x0800, 0x0820, 0x1020, 0x1041, 0x2061,
+    0x28A1, 0x30C1, 0x30E2, 0x40E2, 0x40E2, 0x4142, 0x4122, 0x4142,
+    0x4142, 0x40E2, 0x40E2, 0xC322, 0xBB22, 0x28A1, 0x1861, 0x1841,
+    0x1020, 0x0800, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,
+    0x0000, 0x0820, 0x0800, 0x0820, 0x0820, 0x1020, 0x1041, 0x2061,
+    0x2081, 0x30A1, 0x30C1, 0x38E2, 0x40E2, 0x4102, 0x38E2, 0x4102,
+    0x40E2, 0x4102, 0x30C1, 0x9AE1, 0x28A1, 0x2061, 0x1041, 0x1020,
+    0x0820, 0x0800, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000,
+    0x0020, 0x0000, 0x0820, 0x0800, 0x0820, 0x1020, 0x1841, 0x2061,
+    0x2061, 0x28A1, 0x30C1, 0x30E2, 0x4102, 0x40E2, 0x3902, 0x40E2,
+    0x4102, 0x38E2, 0x30C1, 0x30A1, 0x2081, 0x2061, 0x1041, 0x1020,
+    0x0820, 0x0800, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,
+    0x0000, 0x0820, 0x0800, 0x0820, 0x1020, 0x1020, 0x1841, 0x2061,
+    0x2081, 0x28A1, 0x28A1, 0x30C1, 0x38E2, 0x40E2, 0x4102, 0x40E2,
+    0x30E2, 0x30C1, 0x30C1, 0x28A1, 0x2061, 0x1861, 0x1841, 0x1020,
+    0x0820, 0x0800, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,
+    0x0000, 0x0820, 0x0800, 0x0820, 0x1020, 0x1841, 0x1041, 0x2061,
+    0x2061, 0x28A1, 0x28C1, 0x30C1, 0x38E2, 0x38E2, 0x40E2, 0x30E2,
+    0x38E2, 0x30C1, 0x30A1, 0x28A1, 0x2081, 0x2061, 0x1041, 0x1020,
+    0x1020, 0x0820, 0x0800, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000,
+    0x0820, 0x0800, 0x0820, 0x1020, 0x1020, 0x1841, 0x1861, 0x2061,
+    0x2081, 0x28A1, 0x30C1, 0x5941, 0x4142, 0x38E2, 0x30E2, 0x38E2,
+    0x38E2, 0x30C1, 0x28A1, 0x28A1, 0x2061, 0x2061, 0x1841, 0x1041,
+    0x1020, 0x0820, 0x0800, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,
+    0x0800, 0x0800, 0x0820, 0x1020, 0x1841, 0x1041, 0x2061, 0x2081,
+    0x28A1, 0x28A1, 0x30A1, 0xCBA2, 0x4142, 0x38E2, 0x38E2, 0x38E2,
+    0x30E2, 0x30C1, 0x30A1, 0x28A1, 0x28A1, 0x2061, 0x1041, 0x1841,
+    0x1020, 0x0820, 0x0800, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0820,
+    0x0800, 0x0820, 0x0820, 0x1020, 0x1841, 0x1861, 0x2061, 0x2081,
+    0x28A1, 0x30A1, 0x7A21, 0xF4C2, 0x4122, 0x40E2, 0x38E2, 0x4102,
+    0x38E2, 0x30E2, 0x30C1, 0x30A1, 0x28A1, 0x2081, 0x2061, 0x1041,
+    0x1020, 0x0820, 0x0820, 0x0800, 0x0800, 0x0020, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020,
+    0x0800, 0x0820, 0x1020, 0x1020, 0x1841, 0x2061, 0x2061, 0x28A1,
+    0x28A1, 0x30E2, 0xDC41, 0xF4C2, 0x69A1, 0x3902, 0x4142, 0x4122,
+    0x3902, 0x30E2, 0x30C1, 0x30A1, 0x28A1, 0x2081, 0x2061, 0x1841,
+    0x1041, 0x1020, 0x0820, 0x0800, 0x0820, 0x0000, 0x0020, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0800,
+    0x0820, 0x0820, 0x1020, 0x1841, 0x1861, 0x2881, 0x2881, 0x28A1,
+    0x30C1, 0x7A21, 0xF4E1, 0xF4C1, 0x7A81, 0x4122, 0x4142, 0x4922,
+    0x4142, 0x3902, 0x38E2, 0x30C1, 0x28A1, 0x28A1, 0x2081, 0x2061,
+    0x1841, 0x1020, 0x1020, 0x0800, 0x0000, 0x0020, 0x0000, 0x0020,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020,
+    0x0800, 0x0820, 0x1020, 0x1841, 0x1861, 0x2061, 0x28A1, 0x30C1,
+    0x30C2, 0xBC02, 0xF4C1, 0xF502, 0xCC01, 0x5162, 0x4962, 0x4942,
+    0x4122, 0x4142, 0x3902, 0x38E2, 0x30C1, 0x28A1, 0x2881, 0x1861,
+    0x1841, 0x1841, 0x1020, 0x0800, 0x0820, 0x0000, 0x0020, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0820, 0x0800,
+    0x0820, 0x1020, 0x1020, 0x1841, 0x2061, 0x2081, 0x30A1, 0x30C1,
+    0x4962, 0xF522, 0xF502, 0xF502, 0xF502, 0x9323, 0x4962, 0x5162,
+    0x4962, 0x4122, 0x4942, 0x3902, 0x30C1, 0x28A1, 0x28A1, 0x2061,
+    0x1861, 0x1841, 0x1020, 0x0820, 0x0800, 0x0820, 0x0000, 0x0020,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0820, 0x0800,
+    0x0820, 0x1020, 0x1041, 0x2061, 0x2061, 0x28A1, 0x30C1, 0x30C2,
+    0x7242, 0xF502, 0xF502, 0xF521, 0xF542, 0xF542, 0xBC02, 0x7242,
+    0x5162, 0x4962, 0x4942, 0x3902, 0x38E2, 0x30C1, 0x2881, 0x2081,
+    0x2061, 0x1041, 0x1020, 0x0820, 0x0820, 0x0800, 0x0020, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0800, 0x0820,
+    0x0820, 0x1020, 0x1841, 0x1861, 0x2881, 0x2881, 0x30C1, 0x3902,
+    0x9B81, 0xF522, 0xF542, 0xF563, 0xF543, 0xF563, 0xF543, 0xF563,
+    0xDD02, 0x7B23, 0x4962, 0x4122, 0x3902, 0x30C1, 0x30A1, 0x2081,
+    0x2061, 0x1041, 0x1020, 0x1020, 0x0800, 0x0020, 0x0000, 0x0020,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0800, 0x0800,
+    0x0820, 0x1020, 0x1041, 0x2061, 0x28A1, 0x28A1, 0x30E2, 0x3902,
+    0xBC02, 0xF542, 0xED43, 0xF543, 0xF583, 0xF583, 0xF583, 0xF583,
+    0xF582, 0xF563, 0xBC02, 0x5162, 0x3902, 0x30E2, 0x7A42, 0x6221,
+    0x2061, 0x1841, 0x1841, 0x1020, 0x0820, 0x0800, 0x0020, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0820, 0x0800,
+    0x0820, 0x1841, 0x1041, 0x2061, 0x28A1, 0x30C1, 0x38E2, 0x4142,
+    0xD442, 0xF582, 0xF582, 0xF583, 0xF5A3, 0xF5A3, 0xF5A3, 0xF5A3,
+    0xF583, 0xF562, 0xF582, 0x9361, 0x4122, 0x3902, 0xB381, 0xC421,
+    0x2061, 0x1861, 0x1841, 0x1020, 0x0820, 0x0800, 0x0000, 0x0020,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0800, 0x0820,
+    0x1020, 0x1841, 0x1861, 0x2061, 0x28A1, 0x30C1, 0x3902, 0x4122,
+    0xD4A3, 0xF582, 0xF5A3, 0xF5A3, 0xF5C3, 0xF5C3, 0xF5C3, 0xF5C3,
+    0xF5A3, 0xF5A3, 0xF582, 0xF563, 0x59C2, 0x3902, 0x9B23, 0x9B81,
+    0x2081, 0x2061, 0x1841, 0x1020, 0x0820, 0x0800, 0x0020, 0x0000,
+    0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0820, 0x1020,
+    0x1020, 0x1841, 0x1861, 0x2881, 0x28A1, 0x38E2, 0x3902, 0x4942,
+    0xE522, 0xF5A3, 0xF5C3, 0xF5C3, 0xF5E3, 0xF5E3, 0xF5E3, 0xF5E3,
+    0xF5E3, 0xF5C3, 0xF5A3, 0xF582, 0xAB61, 0x3902, 0x4142, 0x30E2,
+    0x2881, 0x2061, 0x1041, 0x1020, 0x0820, 0x0800, 0x0820, 0x0000,
+    0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0800, 0x0820,
+    0x1020, 0x1841, 0x1861, 0x51C1, 0xBBE2, 0xB381, 0x4962, 0x4942,
+    0xD4E1, 0xF5A3, 0xF5E3, 0xF5E3, 0xF5E4, 0xFEA9, 0xF5E4, 0xF604,
+    0xF603, 0xF5E3, 0xF5C3, 0xF5A2, 0xE522, 0x4922, 0x30E2, 0x30C1,
+    0x28A1, 0x2061, 0x1841, 0x1020, 0x0820, 0x0820, 0x0800, 0x0020,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0820, 0x0800, 0x0820,
+    0x1020, 0x1841, 0x6A21, 0xF521, 0xF542, 0xF542, 0xBC02, 0x4962,
+    0xCCA1, 0xF5E3, 0xF5E3, 0xF603, 0xFEA9, 0xF6CD, 0xF643, 0xF623,
+    0xFE03, 0xF5E3, 0xF5E3, 0xF5A3, 0xF5A2, 0x4942, 0x3902, 0x30C1,
+    0x28A1, 0x1861, 0x1841, 0x1041, 0x0820, 0x0800, 0x0800, 0x0020,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0820, 0x0800, 0x0820,
+    0x0820, 0x28A1, 0xF501, 0xF542, 0xF542, 0xF582, 0xF582, 0x51A2,
+    0xAC43, 0xF5C3, 0xF603, 0xF603, 0xF6ED, 0xFF31, 0xFE64, 0xF664,
+    0xF643, 0xF603, 0xF5E3, 0xF5C3, 0xFDA2, 0x59C2, 0x3902, 0x30C1,
+    0x2881, 0x2081, 0x2061, 0x1841, 0x1020, 0x0820, 0x0820, 0x0000,
+    0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0800, 0x0820, 0x1020,
+    0x1041, 0x8B21, 0xFD62, 0xF542, 0xF582, 0xF562, 0xF5A2, 0x7B03,
+    0x9B81, 0xF603, 0xF623, 0xFE64, 0xFF31, 0xF733, 0xF684, 0xFE84,
+    0xF664, 0xF603, 0xF603, 0xF5C3, 0xF5C3, 0x51A2, 0x3902, 0x30E2,
+    0x30A1, 0x2081, 0x2061, 0x1041, 0x1020, 0x0820, 0x0800, 0x0020,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0800, 0x0820,
+    0x1021, 0xD4E1, 0xF581, 0xF562, 0xF582, 0xF5A2, 0xF5C2, 0xAC43,
+    0x72A3, 0xF623, 0xF643, 0xF644, 0xFF53, 0xFF74, 0xFEC5, 0xF684,
+    0xF664, 0xFE43, 0xF623, 0xF603, 0xE562, 0x5162, 0x3902, 0x38E2,
+    0x30A1, 0x2081, 0x2061, 0x1841, 0x1020, 0x0820, 0x0820, 0x0000,
+    0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0820, 0x0800, 0x1020,
+    0x3921, 0xF5A1, 0xF5A1, 0xF581, 0xF5A2, 0xF5C2, 0xF5C2, 0xBCC2,
+    0x6223, 0xCD63, 0xFE64, 0xF684, 0xFF33, 0xFF74, 0xFEE8, 0xF6A4,
+    0xF684, 0xF663, 0xF643, 0xF603, 0x9BA3, 0x4962, 0x4122, 0x30E2,
+    0x30A1, 0x2081, 0x2061, 0x1041, 0x1020, 0x0820, 0x0800, 0x0020,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0800, 0x0820,
+    0x6A82, 0xF581, 0xF5A1, 0xF581, 0xF5C2, 0xF5C2, 0xF5E2, 0xD4E1,
+    0x6203, 0xAC43, 0xF644, 0xF684, 0xFF31, 0xF774, 0xFF4C, 0xFEE5,
+    0xF6A4, 0xFE84, 0xF664, 0xFE23, 0x6A82, 0x5162, 0x4142, 0x38E2,
+    0x30A1, 0x2081, 0x2061, 0x1841, 0x1020, 0x0820, 0x0820, 0x0000,
+    0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0820, 0x0800, 0x1020,
+    0x8B41, 0xFDA1, 0xF581, 0xF5C2, 0xF5C2, 0xF5C2, 0x9BC3, 0xBCC2,
+    0x6A82, 0x8B83, 0xFE84, 0xFEC4, 0xFF4E, 0xFF94, 0xFFB0, 0xF6E5,
+    0xF6C4, 0xF684, 0xF664, 0xEDE3, 0x6203, 0x6223, 0x9BC3, 0x6A82,
+    0x30C1, 0x2881, 0x2061, 0x1041, 0x1020, 0x0820, 0x0800, 0x0020,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0800, 0x0800, 0x0820,
+    0x9381, 0xF5A1, 0xED81, 0x9BC3, 0xFDE2, 0x8323, 0x51A2, 0x8303,
+    0x6A82, 0x8303, 0xF684, 0xF6E5, 0xFF4A, 0xF7B4, 0xFF94, 0xFF07,
+    0xFEE5, 0xF684, 0xF684, 0xFE64, 0xAC43, 0xE5A2, 0xF602, 0xF5E2,
+    0xA3C3, 0x28A1, 0x1861, 0x1841, 0x1020, 0x0820, 0x0820, 0x0800,
+    0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0820, 0x0820, 0x1020,
+    0x9B81, 0xFDC2, 0x6221, 0x30C1, 0xAC43, 0x5162, 0x51A2, 0x6223,
+    0x7AC3, 0x8B83, 0xFEC4, 0xFEE5, 0xF707, 0xFFB4, 0xFF94, 0xF74C,
+    0xFEE5, 0xF6A4, 0xF684, 0xF664, 0xF643, 0xFE03, 0xF602, 0xF5E2,
+    0xF5E2, 0x8B21, 0x1841, 0x1041, 0x1020, 0x0820, 0x0800, 0x0020,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0800, 0x0820, 0x0820,
+    0x8B21, 0xED81, 0x2881, 0x38E2, 0x51C2, 0x4983, 0x51A2, 0x6223,
+    0x72C3, 0xAC23, 0xFEE5, 0xF6C5, 0xFF26, 0xF78D, 0xFFB4, 0xFF94,
+    0xF6E8, 0xFEE5, 0xF684, 0xFE84, 0xF664, 0xF643, 0xFE23, 0xF602,
+    0xF602, 0xFDC2, 0x4981, 0x1841, 0x1020, 0x0820, 0x0820, 0x0000,
+    0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0800, 0x0820, 0x1020,
+    0x6A21, 0xE562, 0x28A1, 0x38E2, 0x4122, 0x4983, 0x5244, 0x6A84,
+    0x72C3, 0xD563, 0xFEE5, 0xF6E5, 0xFF27, 0xF74A, 0xFFB4, 0xFF95,
+    0xFF53, 0xF6A7, 0xF6A4, 0xF684, 0xF664, 0xF643, 0xFE43, 0xF603,
+    0xF5E2, 0xF602, 0xCCA1, 0x1841, 0x0820, 0x0820, 0x0800, 0x0000,
+    0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0800, 0x0820, 0x1041,
+    0x20E1, 0xFDE2, 0x38E2, 0x3902, 0x4983, 0x51A2, 0x6223, 0x6284,
+    0x7B03, 0xF685, 0xF705, 0xFF07, 0xF727, 0xFF4A, 0xFFB5, 0xF795,
+    0xFF95, 0xFF31, 0xFEA7, 0xF685, 0xF684, 0xF685, 0xFEA9, 0xF642,
+    0xF622, 0xF622, 0xFE02, 0x59C1, 0x1020, 0x0820, 0x0800, 0x0020,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x0820, 0x1020, 0x1841,
+    0x2081, 0xC4C2, 0x51C1, 0x3902, 0x49A3, 0x59C2, 0x6223, 0x6284,
+    0xBD03, 0xFEC7, 0xF707, 0xFF27, 0xF707, 0xFF4E, 0xFF95, 0xFFB5,
+    0xF795, 0xFF74, 0xFF53, 0xF6A7, 0xF685, 0xF6ED, 0xFF33, 0xF6A7,
+    0xF622, 0xF622, 0xF622, 0x9BC3, 0x1021, 0x1020, 0x0800, 0x0020,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0820, 0x1020, 0x1080,
+    0x2081, 0x51C1, 0x8B83, 0x4122, 0x4983, 0x5A24, 0x6284, 0x72A3,
+    0xF666, 0xF6A7, 0xF708, 0xFEE8, 0xF708, 0xFF94, 0xFFB5, 0xF795,
+    0xFFB5, 0xFF95, 0xFF74, 0xFF74, 0xF72E, 0xFF53, 0xFF33, 0xFEED,
+    0xF643, 0xF642, 0xF622, 0xED62, 0x1841, 0x0860, 0x0820, 0x0800,
+    0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0840, 0x1020, 0x18A0,
+    0x2081, 0x28E1, 0x72A2, 0x3982, 0x51C2, 0x5A24, 0x6284, 0xC5C5,
+    0xFEA7, 0xFF08, 0xFEE8, 0xF729, 0xFF4C, 0xFFB6, 0xFF96, 0xFFB6,
+    0xFF95, 0xFF95, 0xFFB5, 0xF774, 0xFF74, 0xFF74, 0xF774, 0xFF4E,
+    0xF644, 0xF643, 0xF622, 0xF622, 0x18C1, 0x1020, 0x0800, 0x0000,
+    0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0820, 0x0020, 0x0820, 0x1080, 0x18A1,
+    0x20C1, 0x28E1, 0x3162, 0x4983, 0x49E3, 0x5224, 0x9423, 0xF6A7,
+    0xFEE8, 0xF708, 0xFF09, 0xFF09, 0xF774, 0xFFB6, 0xFF96, 0xFFB6,
+    0xFFB6, 0xFF95, 0xFFB5, 0xFF95, 0xF774, 0xFF74, 0xFF74, 0xFF4E,
+    0xF683, 0xF682, 0xFE62, 0xFE62, 0x4981, 0x1841, 0x0820, 0x0820,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0020, 0x0020, 0x0840, 0x0840, 0x1080, 0x2081,
+    0x28E1, 0x3122, 0x3162, 0x4983, 0x5244, 0x7B64, 0xFEC7, 0xFF08,
+    0xF6E8, 0xFF29, 0xFF09, 0xFF4C, 0xFFB7, 0xF7B7, 0xFFB7, 0xFFB6,
+    0xFFB6, 0xFF96, 0xFFB6, 0xFF95, 0xFF95, 0xF774, 0xFF74, 0xF74E,
+    0xF684, 0xFE83, 0xF642, 0xF642, 0x4161, 0x1080, 0x0820, 0x0820,
+    0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0020, 0x0840, 0x0840, 0x10A0, 0x20C1,
+    0x28E1, 0x2922, 0x3982, 0x49E3, 0x6264, 0xF666, 0xFF08, 0xF6E8,
+    0xFF29, 0xFF09, 0xF76A, 0xFF94, 0xFFB7, 0xF7B7, 0xFFB7, 0xFFB7,
+    0xFFB7, 0xFF96, 0xFFB6, 0xF7B5, 0xFF95, 0xFF74, 0xFF74, 0xFEED,
+    0xF684, 0xF683, 0xFE82, 0xFE82, 0x3962, 0x1080, 0x0840, 0x0840,
+    0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0820, 0x0020, 0x1060, 0x1080, 0x18A0, 0x20C1,
+    0x2101, 0x3962, 0x3982, 0x5224, 0xE665, 0xFF27, 0xFEE8, 0xFF29,
+    0xF709, 0xFF6A, 0xFF31, 0xFFB7, 0xF7D7, 0xFFB7, 0xFFB7, 0xFFB7,
+    0xF7B7, 0xFFB7, 0xFFB7, 0xFFB6, 0xFF95, 0xF795, 0xFF74, 0xF708,
+    0xF6A4, 0xFEA4, 0xF682, 0xF682, 0x18A1, 0x10A0, 0x0840, 0x0840,
+    0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0020, 0x0840, 0x0840, 0x1060, 0x18A0, 0x20C1,
+    0x2922, 0x3162, 0x49E3, 0xBDA5, 0xFF27, 0xF6E8, 0xFF29, 0xFF09,
+    0xFF4A, 0xF74C, 0xFFB7, 0xFFD8, 0xFFD8, 0xFFD8, 0xFFD8, 0xFFD8,
+    0xFFD8, 0xFFB7, 0xF7B7, 0xFFB6, 0xFFB6, 0xFF95, 0xFF4C, 0xFEC5,
+    0xF6E5, 0xFEA4, 0xF6C2, 0xD563, 0x20C1, 0x18A0, 0x1080, 0x0840,
+    0x0820, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0020, 0x0020, 0x0840, 0x0840, 0x1080, 0x18A0, 0x2901,
+    0x2922, 0x3982, 0x9C43, 0xFF05, 0xFF27, 0xF6E8, 0xFF29, 0xFF4A,
+    0xFF4C, 0xF774, 0xFFD8, 0xFFD8, 0xFFD8, 0xFFF9, 0xFFD8, 0xFFD8,
+    0xFFD8, 0xFFD8, 0xFFB7, 0xFFB7, 0xFFB6, 0xFF33, 0xF6E8, 0xFF27,
+    0xF6E5, 0xF6C4, 0xFEC3, 0x9423, 0x18A1, 0x18A0, 0x1060, 0x0840,
+    0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0020, 0x0020, 0x0820, 0x1080, 0x18A0, 0x20C1, 0x20E1,
+    0x2922, 0x41E3, 0xEEC5, 0xFF26, 0xF707, 0xFF29, 0xFF4A, 0xF74C,
+    0xFFB0, 0xFFD8, 0xFFD8, 0xFFF9, 0xFFDA, 0xFFFA, 0xFFDA, 0xFFFA,
+    0xFFD9, 0xFFD8, 0xFFD8, 0xFFB7, 0xFFB7, 0xF74E, 0xFEE8, 0xFF27,
+    0xF705, 0xFEE5, 0xFEE3, 0x49E3, 0x2901, 0x18A0, 0x1080, 0x0840,
+    0x0840, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0020, 0x0820, 0x0020, 0x0840, 0x1080, 0x18A0, 0x20C1, 0x2901,
+    0x3162, 0x6B23, 0xFF05, 0xFF27, 0xFF27, 0xFF09, 0xFF6A, 0xF74C,
+    0xFFB7, 0xFFD8, 0xFFD9, 0xFFFA, 0xFFDB, 0xFFFB, 0xFFDB, 0xFFFA,
+    0xFFDA, 0xFFF9, 0xFFD8, 0xFFD8, 0xFFB7, 0xF74E, 0xFF09, 0xFF07,
+    0xF726, 0xF705, 0xB503, 0x2902, 0x2101, 0x18A0, 0x1060, 0x0840,
+    0x0840, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0820, 0x0020, 0x0840, 0x1080, 0x18A0, 0x18C1, 0x28E1,
+    0x3162, 0x9423, 0xF705, 0xF727, 0xFF09, 0xFF6A, 0xF74C, 0xFFB2,
+    0xFFD8, 0xFFF9, 0xFFDA, 0xFFDB, 0xFFFC, 0xFFDC, 0xFFFC, 0xFFFB,
+    0xFFDB, 0xFFFA, 0xFFD8, 0xFFD8, 0xFFB7, 0xFFB0, 0xFF09, 0xF727,
+    0xFF26, 0xFF05, 0x62A3, 0x3122, 0x2101, 0x20C1, 0x1080, 0x0840,
+    0x0840, 0x0820, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0020, 0x0020, 0x0840, 0x0840, 0x1080, 0x18A0, 0x20C1, 0x2901,
+    0x3162, 0xA4C4, 0xFF26, 0xFF07, 0xFF48, 0xFF6A, 0xFF8D, 0xFFD7,
+    0xFFD8, 0xFFDA, 0xFFFB, 0xFFFC, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFDC,
+    0xFFDB, 0xFFFA, 0xFFD9, 0xFFD8, 0xFFD7, 0xF7B0, 0xFF69, 0xFF47,
+    0xF707, 0xC5A5, 0x3182, 0x2922, 0x2901, 0x18C1, 0x1080, 0x0840,
+    0x0840, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0020, 0x0840, 0x0840, 0x1080, 0x10A0, 0x20C1, 0x20E1,
+    0x3162, 0xAD45, 0xFF26, 0xFF47, 0xF748, 0xFF4A, 0xFFD2, 0xFFD8,
+    0xFFD8, 0xFFDA, 0xFFDB, 0xFFFC, 0xFFFE, 0xFFFE, 0xFFFE, 0xFFFD,
+    0xFFFC, 0xFFDA, 0xFFF9, 0xFFD8, 0xFFD7, 0xFFB0, 0xFF49, 0xFF68,
+    0xFF27, 0x9465, 0x3982, 0x2922, 0x2901, 0x20C1, 0x1080, 0x0840,
+    0x0840, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0820, 0x0840, 0x0840, 0x1080, 0x18A0, 0x20C1, 0x2101,
+    0x3962, 0xB565, 0xFF46, 0xFF47, 0xFF69, 0xFF6A, 0xFFD7, 0xFFD8,
+    0xFFD9, 0xFFDA, 0xFFFB, 0xFFFD, 0xFFFE, 0xFFFE, 0xFFFE, 0xFFFE,
+    0xFFFC, 0xFFDB, 0xFFD9, 0xFFD8, 0xFFD7, 0xFFD2, 0xF749, 0xFF48,
+    0xFF46, 0x7364, 0x3982, 0x2922, 0x2101, 0x20C1, 0x1080, 0x0840,
+    0x0840, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0020, 0x0840, 0x0840, 0x1080, 0x18A0, 0x18C1, 0x20E1,
+    0x3162, 0xB545, 0xF745, 0xFF47, 0xFF49, 0xFFB0, 0xFFD7, 0xFFD8,
+    0xFFD8, 0xFFDA, 0xFFDB, 0xFFFD, 0xFFFE, 0xFFFE, 0xFFFE, 0xFFFD,
+    0xFFFC, 0xFFFB, 0xFFD9, 0xFFD8, 0xFFD7, 0xFFD2, 0xFF49, 0xFF68,
+    0xFF46, 0x62C3, 0x3982, 0x2922, 0x2901, 0x18A0, 0x1080, 0x0840,
+    0x0840, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0820, 0x0840, 0x0840, 0x1080, 0x18A0, 0x20C1, 0x2101,
+    0x3962, 0xB503, 0xFF66, 0xFF47, 0xFF48, 0xFFB4, 0xFFD7, 0xFFD8,
+    0xFFD8, 0xFFD9, 0xFFDB, 0xFFFC, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFC,
+    0xFFDB, 0xFFDA, 0xFFF9, 0xFFD8, 0xFFD7, 0xFFB2, 0xFF69, 0xF748,
+    0xF766, 0x5224, 0x3982, 0x2922, 0x28E1, 0x10A0, 0x1080, 0x0840,
+    0x0840, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0020, 0x0840, 0x0840, 0x1080, 0x18A0, 0x20C1, 0x20E1,
+    0x2922, 0x9CA4, 0xFF65, 0xFF66, 0xFF48, 0xFFD4, 0xFFD6, 0xFFD7,
+    0xFFD8, 0xFFD9, 0xFFFA, 0xFFDB, 0xFFDC, 0xFFFC, 0xFFDC, 0xFFFC,
+    0xFFFB, 0xFFD9, 0xFFD8, 0xFFD8, 0xFFD7, 0xFF94, 0xFF89, 0xFF68,
+    0xFF86, 0x5224, 0x3962, 0x2922, 0x20C1, 0x18A0, 0x1080, 0x0840,
+    0x0840, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0020, 0x0820, 0x0840, 0x1080, 0x1060, 0x18A0, 0x2101,
+    0x3122, 0x83E4, 0xFF85, 0xFF66, 0xFF88, 0xFFD2, 0xFFD6, 0xFFB7,
+    0xFFD8, 0xFFD8, 0xFFD9, 0xFFFA, 0xFFDB, 0xFFFB, 0xFFDB, 0xFFFA,
+    0xFFDA, 0xFFF9, 0xFFD8, 0xFFD8, 0xFFD7, 0xFFB4, 0xF788, 0xFF87,
+    0xFF66, 0x5AA3, 0x3162, 0x20E1, 0x20C1, 0x18A0, 0x1080, 0x0840,
+    0x0840, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0020, 0x0840, 0x0840, 0x1080, 0x1080, 0x20C1,
+    0x2922, 0x6303, 0xFF65, 0xF766, 0xFF88, 0xFF8D, 0xFFD6, 0xFFD7,
+    0xFFD8, 0xFFD8, 0xFFD8, 0xFFD9, 0xFFFA, 0xFFDA, 0xFFFA, 0xFFD9,
+    0xFFD9, 0xFFD8, 0xFFD8, 0xFFD7, 0xFFD6, 0xFFD4, 0xFF88, 0xFF87,
+    0xFF86, 0x6B23, 0x2922, 0x2901, 0x20C1, 0x18A0, 0x1080, 0x0840,
+    0x0840, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0020, 0x0820, 0x0840, 0x0840, 0x1080, 0x18A0, 0x20C1,
+    0x2101, 0x41E2, 0xFF85, 0xFF66, 0xFF88, 0xFF89, 0xFFD5, 0xFFD7,
+    0xFFD7, 0xFFD8, 0xFFD8, 0xFFD8, 0xFFD8, 0xFFD9, 0xFFF9, 0xFFD9,
+    0xFFD8, 0xFFD8, 0xFFD7, 0xFFD7, 0xFFD6, 0xFFB4, 0xFF88, 0xF787,
+    0xFF66, 0x7364, 0x2922, 0x2101, 0x20C1, 0x10A0, 0x0840, 0x0840,
+    0x0020, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0020, 0x0840, 0x0840, 0x1080, 0x18A0, 0x18C1,
+    0x20E1, 0x2922, 0xE6A5, 0xFF66, 0xFF87, 0xF788, 0xFFB0, 0xFFB6,
+    0xFFD7, 0xFFD7, 0xFFD8, 0xFFD8, 0xFFD8, 0xFFF8, 0xFFD8, 0xFFD8,
+    0xFFD8, 0xFFD7, 0xFFB7, 0xFFD6, 0xFFB6, 0xFFD4, 0xFF88, 0xFF86,
+    0xFF86, 0x9C43, 0x2922, 0x20C1, 0x18A0, 0x1080, 0x0840, 0x0840,
+    0x0820, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0020, 0x0820, 0x0840, 0x0840, 0x1080, 0x18A0,
+    0x20C1, 0x2101, 0xB565, 0xFF86, 0xFF87, 0xFF88, 0xFF8B, 0xFFD6,
+    0xFFD6, 0xFFB7, 0xFFD7, 0xFFD7, 0xFFD7, 0xFFD8, 0xFFD7, 0xFFD7,
+    0xF7D7, 0xFFD7, 0xFFB6, 0xFFD6, 0xFFB6, 0xFFD4, 0xFF88, 0xF766,
+    0xFF66, 0xA4C4, 0x20E1, 0x18C1, 0x10A0, 0x1060, 0x0840, 0x0840,
+    0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0820, 0x0020, 0x0840, 0x0840, 0x1080, 0x10A0,
+    0x20C1, 0x20E1, 0x6B64, 0xFF66, 0xFF87, 0xFF88, 0xF788, 0xFFB0,
+    0xFFD6, 0xFFB6, 0xFFD7, 0xFFB7, 0xFFD7, 0xFFD2, 0xF7AD, 0xFFAC,
+    0xFFB0, 0xFFD6, 0xFFB6, 0xFFD6, 0xFFB6, 0xFFD4, 0xFF87, 0xFF86,
+    0xFF86, 0xB565, 0x20C1, 0x18A0, 0x1080, 0x0840, 0x0820, 0x0840,
+    0x0820, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0020, 0x0840, 0x0820, 0x1080, 0x1060,
+    0x18A0, 0x20C1, 0x3162, 0xFF66, 0xFFA7, 0xFF87, 0xFF88, 0xFF89,
+    0xFFD4, 0xFFB6, 0xFFD6, 0xFFB6, 0xF7B2, 0xFFAB, 0xFF8B, 0xFFAB,
+    0xF78B, 0xFF8D, 0xFFD6, 0xFFD5, 0xFFB5, 0xFFB2, 0xF787, 0xFF86,
+    0xFF66, 0xC5A5, 0x18C1, 0x10A0, 0x1060, 0x0840, 0x0840, 0x0020,
+    0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0840, 0x0840, 0x1080,
+    0x1080, 0x20C1, 0x18C1, 0xAD45, 0xFF86, 0xFF87, 0xF788, 0xFF88,
+    0xFFAC, 0xFFD5, 0xFFD6, 0xFFD6, 0xFF8C, 0xFF8A, 0xEF6A, 0x8C45,
+    0xFFAA, 0xFF89, 0xFFAD, 0xFFB5, 0xFFD5, 0xFFAF, 0xFF87, 0xFF86,
+    0xFF86, 0xCE26, 0x18A0, 0x1080, 0x0840, 0x0840, 0x0020, 0x0820,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0020, 0x0820, 0x0020, 0x0840, 0x0840,
+    0x1080, 0x18A0, 0x20C1, 0x62A3, 0xFFA7, 0xFF87, 0xFF87, 0xFF88,
+    0xFFA8, 0xFFAF, 0xFFD5, 0xFFB2, 0xFF89, 0xF789, 0xC5A5, 0x5224,
+    0xC5A5, 0xFF89, 0xFFC8, 0xFFAF, 0xF7D4, 0xFF89, 0xFF87, 0xF787,
+    0xFF66, 0xC626, 0x1080, 0x1060, 0x0840, 0x0840, 0x0020, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0840, 0x0840,
+    0x1060, 0x1080, 0x1880, 0x18C1, 0xDE45, 0xF787, 0xFF87, 0xFFA7,
+    0xF7A8, 0xFFA8, 0xFFD2, 0xFFAF, 0xFF89, 0xFF89, 0xA4C4, 0x49E3,
+    0x6B64, 0xFFA8, 0xFFA8, 0xF7A7, 0xFFA7, 0xFF87, 0xFF87, 0xFF87,
+    0xFF86, 0xCDC5, 0x1080, 0x0840, 0x0840, 0x0820, 0x0020, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0820, 0x0840,
+    0x0840, 0x1080, 0x1060, 0x18A0, 0x62A3, 0xFFA7, 0xFF87, 0xFFA7,
+    0xFFA7, 0xFFA8, 0xFFC9, 0xF78B, 0xFFA8, 0xFFA8, 0x8C65, 0x3982,
+    0x3982, 0xF768, 0xFFA8, 0xFFA7, 0xF787, 0xFF87, 0xFF87, 0xFF87,
+    0xF787, 0xA4C4, 0x0040, 0x0820, 0x0020, 0x0020, 0x0000, 0x0020,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x0020,
+    0x0840, 0x0840, 0x1080, 0x0860, 0x1080, 0x9465, 0xF787, 0xFFA7,
+    0xFFA7, 0xFFA8, 0xFFA8, 0xFFA8, 0xFFA8, 0xFFA8, 0x9465, 0x3162,
+    0x2902, 0xC626, 0xFF88, 0xFFA7, 0xFFA7, 0xFFA7, 0xFFA7, 0xFFA7,
+    0xFFA7, 0x5262, 0x0840, 0x0840, 0x0820, 0x0020, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020,
+    0x0840, 0x0840, 0x0840, 0x1080, 0x1060, 0x18A0, 0x9465, 0xFFC7,
+    0xFFA7, 0xFFA7, 0xFFA8, 0xFFA8, 0xFFA8, 0xFFA8, 0x7364, 0x20E1,
+    0x2101, 0xA4C4, 0xFFC7, 0xFFA7, 0xFFA7, 0xFFA7, 0xFFA7, 0xFFA7,
+    0x9CA4, 0x0840, 0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0020, 0x0840, 0x0840, 0x0840, 0x0840, 0x1080, 0x1060, 0x4A62,
+    0xBDA5, 0xF788, 0xFFA7, 0xFFA8, 0xFFC8, 0xFFA8, 0x41C2, 0x20C1,
+    0x18C1, 0x7364, 0xFFA7, 0xFFA7, 0xFFA7, 0xFFA7, 0xFFA7, 0x9C43,
+    0x0840, 0x0840, 0x0020, 0x0820, 0x0020, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0020, 0x0020, 0x0840, 0x0820, 0x0840, 0x0840, 0x1080, 0x1060,
+    0x1080, 0x3122, 0x6B23, 0x9465, 0x9445, 0x5AA3, 0x1880, 0x10A0,
+    0x18A0, 0x5262, 0xFFC7, 0xFFA7, 0xF747, 0xB545, 0x39E2, 0x0020,
+    0x0020, 0x0020, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0020, 0x0020, 0x0840, 0x0840, 0x0840, 0x0840,
+    0x1080, 0x1060, 0x1080, 0x1060, 0x1080, 0x1060, 0x1080, 0x1060,
+    0x1080, 0x1080, 0x18A0, 0x20C1, 0x1040, 0x0840, 0x0840, 0x0020,
+    0x0820, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0020, 0x0000, 0x0820, 0x0020, 0x0820, 0x0840, 0x0840,
+    0x0020, 0x0840, 0x0860, 0x1040, 0x0860, 0x0840, 0x0860, 0x1040,
+    0x0860, 0x0840, 0x0860, 0x0840, 0x0820, 0x0840, 0x0020, 0x0820,
+    0x0000, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x0020, 0x0820,
+    0x0020, 0x0840, 0x0020, 0x0840, 0x0820, 0x0840, 0x0020, 0x0840,
+    0x0820, 0x0840, 0x0840, 0x0020, 0x0820, 0x0020, 0x0000, 0x0020,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0020,
+    0x0820, 0x0020, 0x0820, 0x0020, 0x0820, 0x0020, 0x0820, 0x0020,
+    0x0820, 0x0020, 0x0820, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,
+    0x0000, 0x0020, 0x0820, 0x0020, 0x0820, 0x0020, 0x0820, 0x0020,
+    0x0820, 0x0000, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0000, 0x0020,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 },
+  { 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0000, 0x0020,
+    0x0000, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0820, 0x0000, 0x0020, 0x0000, 0x0820, 0x0800,
+    0x0020, 0x0000, 0x0020, 0x0000, 0x0020, 0x0000, 0x0020, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0020, 0x0000, 0x0820, 0x0000, 0x0820, 0x0000,
+    0x0820, 0x0000, 0x0820, 0x0000, 0x0820, 0x0800, 0x0020, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,
+    0x0000, 0x0020, 0x0800, 0x0820, 0x0000, 0x0820, 0x0800, 0x0820,
+    0x0000, 0x0820, 0x0800, 0x0820, 0x0020, 0x0000, 0x0020, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0020, 0x0000, 0x0820, 0x0800, 0x0820, 0x0820, 0x1020, 0x0820,
+    0x0820, 0x0820, 0x0820, 0x0820, 0x0820, 0x0800, 0x0820, 0x0000,
+    0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0800,
+    0x0820, 0x0000, 0x0820, 0x0820, 0x0820, 0x0820, 0x1020, 0x1020,
+    0x1020, 0x1020, 0x1020, 0x1020, 0x0820, 0x0800, 0x0820, 0x0000,
+    0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0800,
+    0x0020, 0x0800, 0x1020, 0x0820, 0x1020, 0x1020, 0x1020, 0x1020,
+    0x1841, 0x1020, 0x1020, 0x1020, 0x0820, 0x0820, 0x0820, 0x0000,
+    0x0820, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0820,
+    0x0800, 0x0820, 0x0820, 0x1020, 0x1841, 0x1041, 0x2061, 0xB282,
+    0xAA82, 0x38E2, 0x1841, 0x1020, 0x1020, 0x0820, 0x0820, 0x0800,
+    0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0800,
+    0x1020, 0x0820, 0x1020, 0x1041, 0x1841, 0x1861, 0x1861, 0xAA82,
+    0xE2E2, 0xDAA2, 0x1861, 0x1841, 0x1841, 0x1020, 0x0820, 0x0800,
+    0x0820, 0x0800, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0800, 0x0820,
+    0x0820, 0x1020, 0x1841, 0x1841, 0x1861, 0x2081, 0x20A1, 0xAA82,
+    0xE323, 0xE323, 0x5141, 0x1861, 0x1041, 0x1841, 0x1020, 0x0820,
+    0x0800, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0800, 0x0820, 0x0820,
+    0x0820, 0x1020, 0x1041, 0x2061, 0x2081, 0x1881, 0x30E2, 0xE323,
+    0xE323, 0xE323, 0x7A21, 0x18A1, 0x2061, 0x1841, 0x1020, 0x0820,
+    0x0820, 0x0800, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0800, 0x0820, 0x0820,
+    0x1020, 0x1041, 0x2061, 0x2081, 0x18A1, 0x28E1, 0x9282, 0xE323,
+    0xE323, 0xE323, 0x8A82, 0x1881, 0x18A1, 0x2061, 0x1041, 0x1020,
+    0x0820, 0x0800, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0800, 0x0820, 0x0820,
+    0x1020, 0x1841, 0x18A1, 0x1881, 0x28C1, 0x7221, 0xE383, 0xE383,
+    0xE383, 0xE383, 0xB282, 0x28E1, 0x20A1, 0x1881, 0x1841, 0x1020,
+    0x0820, 0x0820, 0x0800, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0820, 0x0820, 0x1020,
+    0x1841, 0x2061, 0x1881, 0x3921, 0xE323, 0xE383, 0xE383, 0xEBE3,
+    0xE3C3, 0xE383, 0x8A82, 0x28E1, 0x18C1, 0x1881, 0x2061, 0x1841,
+    0x0820, 0x0820, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0800, 0x0820, 0x1020,
+    0x1041, 0x20A1, 0x1881, 0x89E2, 0xE383, 0xE3E3, 0xE3C3, 0xE3E3,
+    0xEBC3, 0xE3E3, 0x9282, 0x3122, 0x28E1, 0x20A1, 0x1861, 0x1841,
+    0x1020, 0x0820, 0x0800, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0820, 0x1020, 0x1020,
+    0x1841, 0x1881, 0x20C1, 0xCB22, 0xEBE3, 0xE3C3, 0xEC44, 0xE424,
+    0xEC24, 0xE424, 0x6201, 0x3101, 0x28E1, 0x20C1, 0x1881, 0x1841,
+    0x1020, 0x0820, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0800, 0x0820, 0x1020,
+    0x1841, 0x1881, 0x18C1, 0xE383, 0xE3E3, 0xE3C3, 0xEC24, 0xEC63,
+    0xF463, 0xCBA2, 0x3982, 0x3921, 0x28E1, 0x20C1, 0x18A1, 0x1841,
+    0x1020, 0x0820, 0x0800, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0020, 0x0800, 0x0820, 0x0820, 0x1020,
+    0x1841, 0x2081, 0x38E2, 0xE383, 0xEBE3, 0xEC44, 0xE424, 0xEC84,
+    0xEC84, 0x8303, 0x4181, 0x3162, 0x28E1, 0x20C1, 0x1881, 0x1841,
+    0x1020, 0x0820, 0x0800, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x0800, 0x0820, 0x1020,
+    0x1041, 0x18A1, 0x3902, 0xEBC3, 0xE3C3, 0xEC24, 0xEC63, 0xECA4,
+    0xBC02, 0x5262, 0x4981, 0x3962, 0x28E1, 0x20C1, 0x1881, 0x1841,
+    0x1020, 0x0820, 0x0820, 0x0800, 0x0020, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0020, 0x0800, 0x0820, 0x0820, 0x1020,
+    0x1041, 0x2081, 0x3921, 0xEBE3, 0xE3C3, 0xEC44, 0xEC63, 0xD442,
+    0x4A62, 0x49E3, 0x3982, 0x3162, 0x28E1, 0x20C1, 0x2081, 0x1041,
+    0x1020, 0x0820, 0x0820, 0x0800, 0x0020, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x0800, 0x0820, 0x1020,
+    0x1861, 0x1881, 0x28E1, 0xE3E3, 0xE3C3, 0xEC23, 0xEC44, 0x7AC3,
+    0x49E3, 0x41E2, 0x3982, 0x3921, 0x28E1, 0x18C1, 0x20A1, 0x1841,
+    0x1020, 0x0820, 0x0800, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0820, 0x0820, 0x1020,
+    0x1841, 0x2081, 0x18A1, 0xEB83, 0xEBE3, 0xE423, 0xCBA2, 0x39C2,
+    0x41E2, 0x3982, 0x3162, 0x3122, 0x3921, 0x3121, 0x2081, 0x1041,
+    0x1020, 0x0820, 0x0800, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0800, 0x0820, 0x1020,
+    0x1841, 0x1861, 0x1881, 0xB322, 0xE3E3, 0xEC23, 0xBB22, 0x39A2,
+    0x3982, 0x3162, 0x3901, 0x6221, 0xE383, 0x69C1, 0x2061, 0x1841,
+    0x1020, 0x0820, 0x0800, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0820, 0x0800, 0x0820,
+    0x1020, 0x1841, 0x20A1, 0x69A1, 0xEBE3, 0xEC23, 0xB322, 0x3121,
+    0x3101, 0x3921, 0x3901, 0xE3C1, 0xEBC3, 0x7221, 0x1041, 0x1020,
+    0x0820, 0x0820, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x0800, 0x0820,
+    0x1020, 0x1041, 0x1881, 0x2881, 0xCBA2, 0xEBE3, 0xCBA2, 0x2922,
+    0x2922, 0x28E1, 0x61A1, 0xEBC3, 0xE3C1, 0xBB22, 0x1841, 0x1020,
+    0x0820, 0x0820, 0x0800, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0800, 0x0820, 0x0820,
+    0x1020, 0x1841, 0x1041, 0x2081, 0x69C1, 0xEBE3, 0xE3C3, 0x28E1,
+    0x28E1, 0x28E1, 0x7A21, 0xE3C1, 0xE3A1, 0xE3C1, 0x30A1, 0x0820,
+    0x0820, 0x0800, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0800, 0x0800,
+    0x0820, 0x1020, 0x1041, 0x2061, 0x1861, 0x8A82, 0xEBE3, 0x3921,
+    0x2081, 0x1881, 0x7201, 0xE3C1, 0xE3C1, 0xEBC1, 0x9282, 0x0820,
+    0x0800, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0820, 0x0800,
+    0x0820, 0x1020, 0x1020, 0x1841, 0x2061, 0x18A1, 0x69A1, 0x5161,
+    0x2081, 0x1861, 0x69C1, 0xEBC1, 0xE3C1, 0xE3A1, 0xE361, 0x0820,
+    0x0000, 0x0800, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0800,
+    0x0800, 0x0820, 0x1020, 0x1041, 0x1841, 0x2061, 0x1861, 0x2061,
+    0x1861, 0x1861, 0x2061, 0xE3C1, 0xE3A1, 0xE3C1, 0xEBC1, 0x3921,
+    0x0800, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0820,
+    0x0800, 0x0820, 0x0820, 0x1020, 0x1841, 0x1841, 0x1841, 0x2061,
+    0x1041, 0x1841, 0x1841, 0x7A21, 0xEBC1, 0xE3C1, 0xE3A1, 0x5141,
+    0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020,
+    0x0800, 0x0800, 0x0820, 0x1020, 0x1020, 0x1841, 0x1041, 0x1841,
+    0x1841, 0x1841, 0x1041, 0x1861, 0xDB61, 0xE3C1, 0xEBC1, 0x5941,
+    0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0800,
+    0x0820, 0x0800, 0x0820, 0x1020, 0x1020, 0x1020, 0x1020, 0x1041,
+    0x1841, 0x1841, 0x1020, 0x1020, 0x69C1, 0xEBC1, 0xE3C1, 0x28A1,
+    0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020,
+    0x0800, 0x0800, 0x0820, 0x1020, 0x1020, 0x1020, 0x1020, 0x1020,
+    0x1020, 0x1020, 0x1020, 0x1020, 0x0820, 0xCBA2, 0xEBC1, 0x1020,
+    0x0800, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0000, 0x0820,
+    0x0800, 0x0820, 0x0820, 0x0820, 0x1020, 0x1020, 0x1020, 0x1020,
+    0x1020, 0x1020, 0x1020, 0x1020, 0x1020, 0x9282, 0x9B01, 0x0020,
+    0x0000, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0800,
+    0x0820, 0x0820, 0x0820, 0x0820, 0x1020, 0x1020, 0x1020, 0x1020,
+    0x1020, 0x1020, 0x1020, 0x1020, 0x0820, 0x5141, 0x4921, 0x0820,
+    0x0800, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0020, 0x0800, 0x0820, 0x0000, 0x0820,
+    0x0800, 0x0820, 0x0820, 0x1020, 0x1020, 0x1020, 0x1020, 0x1841,
+    0x1841, 0x1020, 0x1020, 0x1020, 0x1020, 0x18A1, 0x0820, 0x0800,
+    0x0820, 0x0000, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0000, 0x0820, 0x0800,
+    0x0820, 0x0820, 0x1020, 0x1020, 0x1841, 0x1841, 0x1041, 0x1841,
+    0x1841, 0x1841, 0x1041, 0x1020, 0x1020, 0x1020, 0x0820, 0x0820,
+    0x0800, 0x0820, 0x0000, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0800, 0x0820, 0x0820,
+    0x0820, 0x1020, 0x1020, 0x2881, 0x7A21, 0x1821, 0x1041, 0x1841,
+    0x1841, 0x1841, 0x1041, 0x1841, 0x1020, 0x1020, 0x0820, 0x0820,
+    0x0800, 0x0820, 0x0800, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0020, 0x0000, 0x0020, 0x0800, 0x0820, 0x0800, 0x0820,
+    0x1020, 0x1020, 0x1041, 0x5141, 0xEC61, 0x7A21, 0x1841, 0x1841,
+    0x1841, 0x3922, 0x1841, 0x1041, 0x1841, 0x1020, 0x1020, 0x0820,
+    0x0820, 0x0800, 0x0820, 0x0800, 0x0020, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0020, 0x0000, 0x0820, 0x0800, 0x0820, 0x0820, 0x1020,
+    0x1020, 0x1841, 0x1041, 0x59C1, 0xEC61, 0xEC61, 0x28A1, 0x1861,
+    0x2061, 0x8281, 0x2081, 0x1041, 0x1841, 0x1841, 0x1020, 0x1020,
+    0x0820, 0x0800, 0x0800, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0020, 0x0000, 0x0020, 0x0800, 0x1020, 0x0820, 0x1020,
+    0x1041, 0x1841, 0x1041, 0x6201, 0xEC61, 0xEC81, 0x69A1, 0x2061,
+    0x2081, 0xA2E1, 0x38E2, 0x1861, 0x2061, 0x1841, 0x1041, 0x1020,
+    0x1020, 0x0820, 0x0820, 0x0800, 0x0820, 0x0000, 0x0020, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0020, 0x0000, 0x0820, 0x0800, 0x0820, 0x0820, 0x1020, 0x1841,
+    0x1841, 0x1041, 0x2061, 0x9B01, 0xECA1, 0xECA1, 0xAB61, 0x2061,
+    0x2061, 0xB381, 0x4121, 0x2061, 0x1861, 0x2061, 0x1041, 0x1841,
+    0x1020, 0x0820, 0x0820, 0x0800, 0x0820, 0x0000, 0x0020, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0020, 0x0000, 0x0820, 0x0800, 0x0820, 0x1020, 0x1020, 0x1841,
+    0x1041, 0x1861, 0x2061, 0xDC21, 0xECC1, 0xF4C1, 0xF4E1, 0x4981,
+    0x2081, 0xCC01, 0x5162, 0x2881, 0x2081, 0x1861, 0x2061, 0x1841,
+    0x1020, 0x1020, 0x0820, 0x0800, 0x0820, 0x0000, 0x0020, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0020, 0x0000, 0x0820, 0x0800, 0x0820, 0x1020, 0x1041, 0x1841,
+    0x2061, 0x1861, 0x7A21, 0xF4E1, 0xF4C1, 0xF4C1, 0xF4C1, 0xDC21,
+    0x6201, 0xE4A1, 0x61A1, 0x28A1, 0x2061, 0x2081, 0x2061, 0x1041,
+    0x1841, 0x1020, 0x0820, 0x0820, 0x0800, 0x0800, 0x0020, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0020, 0x0800, 0x0800, 0x0820, 0x0820, 0x1020, 0x1041, 0x2061,
+    0x1861, 0x28C1, 0xDC21, 0xF4C1, 0xECC1, 0xF4C1, 0xECC1, 0xF502,
+    0xF4C1, 0xF4E1, 0x7A42, 0x28A1, 0x28A1, 0x2881, 0x1861, 0x2061,
+    0x1841, 0x1020, 0x1020, 0x0820, 0x0800, 0x0020, 0x0000, 0x0020,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000,
+    0x0020, 0x0800, 0x0820, 0x0820, 0x1020, 0x1841, 0x1041, 0x2061,
+    0x28A1, 0xBC02, 0xF4C1, 0xF502, 0xF502, 0xF502, 0xF502, 0xF502,
+    0xF502, 0xED02, 0x9323, 0x30A1, 0x28A1, 0x28A1, 0x2081, 0x2061,
+    0x1041, 0x1841, 0x1020, 0x0820, 0x0800, 0x0000, 0x0020, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000,
+    0x0020, 0x0000, 0x0800, 0x0820, 0x1020, 0x1841, 0x1861, 0x1861,
+    0xAB61, 0xF502, 0xED02, 0xF501, 0xF521, 0xF501, 0xF521, 0xF501,
+    0xF521, 0xF521, 0xD462, 0x38E2, 0x30C1, 0x28A1, 0x2881, 0x2881,
+    0x1861, 0x1841, 0x1020, 0x0820, 0x0820, 0x0820, 0x0800, 0x0820,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,
+    0x0800, 0x0820, 0x0820, 0x1020, 0x1020, 0x1841, 0x2061, 0x9AE1,
+    0xF521, 0xF521, 0xF521, 0xF501, 0xF542, 0xF542, 0xF542, 0xED42,
+    0xF542, 0xF542, 0xF542, 0x4962, 0x30C2, 0x30C1, 0x28A1, 0x2061,
+    0x1861, 0x1841, 0x1841, 0x1020, 0x0820, 0x0800, 0x0020, 0x0000,
+    0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,
+    0x0800, 0x0800, 0x0820, 0x1020, 0x1041, 0x1041, 0x7A81, 0xF501,
+    0xED21, 0xF501, 0xF521, 0xF542, 0xED42, 0xF562, 0xF582, 0xF562,
+    0xF582, 0xF582, 0xF562, 0x9B23, 0x38E2, 0x30C1, 0x28A1, 0x2881,
+    0x2081, 0x2061, 0x1841, 0x1020, 0x0820, 0x0820, 0x0800, 0x0020,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000,
+    0x0820, 0x0800, 0x0820, 0x1020, 0x1841, 0x82A1, 0xF521, 0xF521,
+    0xF542, 0xF542, 0xF542, 0xF582, 0xED62, 0xF582, 0xF5A2, 0xF562,
+    0xF582, 0xED62, 0xF582, 0xDD02, 0x4122, 0x30E2, 0x30C1, 0x2881,
+    0x2081, 0x1861, 0x1841, 0x1020, 0x0820, 0x0800, 0x0800, 0x0020,
+    0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000,
+    0x0820, 0x0800, 0x0820, 0x1041, 0x4161, 0xED01, 0xF521, 0xF542,
+    0xED42, 0xF562, 0xF582, 0xF562, 0xF582, 0xF5A3, 0xF648, 0xF5A2,
+    0xF5A2, 0xF5A2, 0xF5A2, 0xF582, 0xC402, 0x3902, 0x38E2, 0x28A1,
+    0x2081, 0x2061, 0x1841, 0x1841, 0x1020, 0x0820, 0x0820, 0x0000,
+    0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020,
+    0x0800, 0x0820, 0x1020, 0x1841, 0xCC21, 0xF521, 0xF542, 0xF542,
+    0xF582, 0xF562, 0xF5A2, 0xF5A2, 0xF5A2, 0xF605, 0xFF31, 0xF5C3,
+    0xF5C3, 0xF5C3, 0xF5A2, 0xF5A2, 0xF5A2, 0x9361, 0x30E2, 0x30C1,
+    0x2881, 0x2081, 0x2061, 0x1041, 0x1020, 0x0820, 0x0800, 0x0800,
+    0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000,
+    0x0800, 0x0820, 0x0820, 0x4101, 0xF542, 0xED42, 0xF542, 0xF582,
+    0xF562, 0xF5A2, 0xF5A2, 0xF5C2, 0xF5C3, 0xF6CD, 0xFF53, 0xF648,
+    0xF5E3, 0xF5E3, 0xF5C3, 0xFDC3, 0xF5A2, 0xF582, 0x8B41, 0x30C1,
+    0x30A1, 0x2081, 0x2061, 0x1041, 0x1020, 0x0820, 0x0800, 0x0820,
+    0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0820,
+    0x0800, 0x0820, 0x1020, 0x82A1, 0xF562, 0xF582, 0xF562, 0xF582,
+    0xF5A2, 0xF5A2, 0xF5C2, 0xF5E3, 0xF5E4, 0xFF53, 0xFF53, 0xF6CD,
+    0xF603, 0xF5C3, 0xF5E3, 0xF5E2, 0xF5C2, 0xF5A2, 0xF5A2, 0x8B21,
+    0x28A1, 0x2881, 0x1861, 0x1841, 0x1020, 0x0820, 0x0800, 0x0020,
+    0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0800,
+    0x0000, 0x1020, 0x0820, 0xAB61, 0xF5A1, 0xF581, 0xF581, 0xF5A2,
+    0xF5A2, 0xF5C2, 0xF5E2, 0xF5E3, 0xF689, 0xF753, 0xFF33, 0xFF53,
+    0xF604, 0xF603, 0xF603, 0xF603, 0xFDE3, 0xF5C2, 0xF5C2, 0xF5A2,
+    0x82A1, 0x2881, 0x2081, 0x1841, 0x1020, 0x1020, 0x0820, 0x0800,
+    0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0820,
+    0x0800, 0x1020, 0x1041, 0xC402, 0xF5A1, 0xF5A1, 0xF5A2, 0xF5C2,
+    0xF5C2, 0xF5E2, 0xF5E2, 0xF603, 0xFF31, 0xF753, 0xFF33, 0xFF53,
+    0xF6C9, 0xF643, 0xF603, 0xF603, 0xF5E3, 0xF5E2, 0xF5C2, 0xF5C2,
+    0xF5A2, 0x6201, 0x2061, 0x1861, 0x1841, 0x1020, 0x0820, 0x0800,
+    0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0840,
+    0x8B21, 0xCCA1, 0x6A82, 0xB3E2, 0xF581, 0xF5A2, 0xF5C2, 0xF5C2,
+    0xF5E2, 0xF602, 0xF5E3, 0xF645, 0xFF33, 0xFF53, 0xF733, 0xFF53,
+    0xFF31, 0xF643, 0xFE43, 0xF603, 0xF603, 0xF602, 0xF5E2, 0xF5C2,
+    0xF5C2, 0xDCE1, 0x2081, 0x2061, 0x1841, 0x1020, 0x0820, 0x0820,
+    0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x9321,
+    0xF5A1, 0xF5A1, 0xCCA1, 0x8B21, 0xF5C2, 0xF5C2, 0xF5C2, 0xF5E2,
+    0xF5E2, 0xF602, 0xF623, 0xFEA9, 0xFF33, 0xF753, 0xFF33, 0xFF53,
+    0xFF33, 0xF685, 0xF664, 0xF643, 0xF603, 0xF602, 0xF5E2, 0xF5E2,
+    0xF5C2, 0xF5C2, 0x4121, 0x1841, 0x1841, 0x1020, 0x0820, 0x0800,
+    0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD4E1,
+    0xF581, 0xF5A1, 0xCCA1, 0x51A1, 0xF5C2, 0xF5C2, 0xF5E2, 0xF5E2,
+    0xF602, 0xF623, 0xF603, 0xF6ED, 0xFF33, 0xFF53, 0xFF74, 0xF774,
+    0xFF74, 0xFEA7, 0xF663, 0xF664, 0xFE43, 0xF623, 0xF602, 0xF602,
+    0xF5E2, 0xFDE2, 0x51C1, 0x2061, 0x1841, 0x1020, 0x0820, 0x0800,
+    0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0xED81,
+    0xF5A1, 0xF5A1, 0x9381, 0x2061, 0xE542, 0xF5E2, 0xF602, 0xF602,
+    0xF602, 0xF623, 0xF643, 0xFEED, 0xFF33, 0xFF74, 0xFF74, 0xF774,
+    0xFF74, 0xF6C9, 0xF684, 0xF664, 0xFE43, 0xF603, 0xF623, 0xF602,
+    0xF5E2, 0xF5E2, 0x3902, 0x1841, 0x1841, 0x1020, 0x0820, 0x0800,
+    0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0000, 0xED81,
+    0xFDC2, 0x8B21, 0x28A1, 0x1841, 0x8B21, 0xF5E2, 0xF5E2, 0xF602,
+    0xF623, 0xF643, 0xF644, 0xF74E, 0xFF53, 0xFF74, 0xF774, 0xFF94,
+    0xFF74, 0xFF09, 0xF684, 0xFE84, 0xF664, 0xF643, 0xFE23, 0xF602,
+    0xF602, 0xE542, 0x28A1, 0x2061, 0x1841, 0x1020, 0x1020, 0x0820,
+    0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0xCCC1,
+    0x9381, 0x0820, 0x1841, 0x2061, 0x30C1, 0xD563, 0xF602, 0xF642,
+    0xF643, 0xF643, 0xFE64, 0xF6CD, 0xFF74, 0xFF74, 0xFF94, 0xFFB4,
+    0xFF94, 0xF729, 0xF6A4, 0xF684, 0xF664, 0xFE44, 0xF643, 0xF623,
+    0xF602, 0x9B61, 0x2081, 0x1861, 0x1841, 0x1020, 0x1020, 0x0800,
+    0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x9B81,
+    0x8281, 0x1020, 0x1841, 0x1861, 0x2881, 0x4122, 0xCD63, 0xF622,
+    0xF643, 0xF644, 0xF683, 0xF6A7, 0xFF31, 0xF774, 0xFFB4, 0xFF94,
+    0xFFB4, 0xFF09, 0xF6C4, 0xFEA4, 0xF663, 0xF664, 0xFE43, 0xF642,
+    0xFE42, 0x4981, 0x28A1, 0x1861, 0x1841, 0x1020, 0x1020, 0x0800,
+    0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x4981,
+    0x9B81, 0x1020, 0x1041, 0x2061, 0x28A1, 0x30C1, 0x6223, 0xFE42,
+    0xF643, 0xFE83, 0xF684, 0xF6A4, 0xFEE5, 0xFF74, 0xFF94, 0xFF94,
+    0xF7B4, 0xFF26, 0xF6C5, 0xF6A4, 0xF684, 0xFE83, 0xF643, 0xF643,
+    0xBCA2, 0x30A1, 0x2881, 0x1861, 0x1841, 0x1020, 0x0820, 0x0800,
+    0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0000, 0x0820,
+    0xB443, 0x1020, 0x1841, 0x1861, 0x28A1, 0x30A1, 0x3902, 0xCD43,
+    0xF664, 0xF663, 0xFEA4, 0xF6C4, 0xF6E5, 0xFF4C, 0xFF94, 0xFFD4,
+    0xFFB0, 0xF705, 0xFEC5, 0xF6C4, 0xF684, 0xFE83, 0xF683, 0xFE43,
+    0x8323, 0x30C1, 0x28A1, 0x2061, 0x1841, 0x1020, 0x0820, 0x0820,
+    0x0800, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0820,
+    0x6A21, 0x28E1, 0x1041, 0x2061, 0x2881, 0x30C1, 0x3902, 0x9BC3,
+    0xFEA3, 0xFE84, 0xF6A4, 0xFEC4, 0xF705, 0xFF6A, 0xFF94, 0xFFB4,
+    0xFFAF, 0xF726, 0xF705, 0xFEC4, 0xF6A4, 0xF684, 0xF663, 0xF642,
+    0x4983, 0x30C1, 0x2881, 0x1861, 0x1041, 0x1020, 0x0820, 0x0800,
+    0x0820, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0820, 0x0000,
+    0x1020, 0x4981, 0x1841, 0x2061, 0x28A1, 0x30E2, 0x3902, 0x72A3,
+    0xFE63, 0xF6A4, 0xF6A4, 0xFEE5, 0xF705, 0xF729, 0xFF94, 0xFF94,
+    0xFF8D, 0xFF26, 0xF705, 0xFEE5, 0xF6C4, 0xFEA4, 0xFE83, 0xE622,
+    0x3902, 0x38E2, 0x2881, 0x2081, 0x1841, 0x1841, 0x0820, 0x0820,
+    0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0820,
+    0x0820, 0x2061, 0x1041, 0x2881, 0x28A1, 0x38E2, 0x4142, 0x6223,
+    0xFEC4, 0xFEA4, 0xFEC4, 0xF6E5, 0xFF05, 0xFF48, 0xFF94, 0xF794,
+    0xFFAF, 0xF726, 0xFF05, 0xF6E5, 0xFEC4, 0xF6A4, 0xF6A4, 0xCD43,
+    0x4122, 0x30C2, 0x28A1, 0x2061, 0x1841, 0x1020, 0x1020, 0x0800,
+    0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0800, 0x0800,
+    0x0820, 0x1020, 0x1041, 0x2081, 0x30A1, 0x30E2, 0x4122, 0x6203,
+    0xF6A4, 0xF6C4, 0xFEE5, 0xF6E5, 0xFF05, 0xF748, 0xFF94, 0xFF94,
+    0xFFB0, 0xF726, 0xFF05, 0xF705, 0xFEE5, 0xF6A4, 0xFEA4, 0xC4C2,
+    0x4142, 0x38E2, 0x30A1, 0x2081, 0x2061, 0x1020, 0x0820, 0x0820,
+    0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0800,
+    0x1020, 0x1841, 0x2061, 0x2081, 0x9B81, 0xAC43, 0x4142, 0x7282,
+    0xFEC3, 0xFEE4, 0xFEE5, 0xF705, 0xFF06, 0xF748, 0xFF94, 0xFFB4,
+    0xFF94, 0xF727, 0xFF26, 0xF705, 0xFEC5, 0xF6C4, 0xF6C3, 0xAC43,
+    0x4122, 0x3902, 0x28A1, 0x2081, 0x2061, 0x1020, 0x0820, 0x0800,
+    0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0800, 0x0820,
+    0x1020, 0x1041, 0x1861, 0x4161, 0xF682, 0xF682, 0x6223, 0xAC23,
+    0xF6C4, 0xFEE5, 0xF705, 0xFF06, 0xF726, 0xFF69, 0xFF94, 0xF7B4,
+    0xFF94, 0xFF4A, 0xFF26, 0xF706, 0xFF05, 0xF6E5, 0xFEE4, 0xC4C2,
+    0x4942, 0x3902, 0x30C1, 0x28A1, 0x2061, 0x1841, 0x0820, 0x0800,
+    0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0820, 0x0820,
+    0x1020, 0x1841, 0x1881, 0x5262, 0xFEC2, 0xFEC2, 0xFEC4, 0xF6C4,
+    0xFEE5, 0xF705, 0xFF05, 0xF706, 0xFF26, 0xFF8D, 0xFF95, 0xF795,
+    0xFFB5, 0xFFB2, 0xF726, 0xFF26, 0xF705, 0xF705, 0xFEC5, 0xB503,
+    0x4183, 0x3902, 0x30C1, 0x2881, 0x1881, 0x1841, 0x1020, 0x0820,
+    0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0840,
+    0x1020, 0x1080, 0x1881, 0x20C1, 0xCD43, 0xFEC3, 0xF6C4, 0xFEE4,
+    0xF705, 0xFF05, 0xF726, 0xFF27, 0xF749, 0xFFB5, 0xFF95, 0xF7B5,
+    0xFF95, 0xFF95, 0xFF4C, 0xF726, 0xFF26, 0xFF05, 0xFF04, 0xD603,
+    0x4983, 0x4142, 0x38E2, 0x28E1, 0x20A1, 0x1841, 0x1020, 0x0820,
+    0x0800, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x0020, 0x0840,
+    0x0840, 0x18A0, 0x20C1, 0x28E1, 0xA3C3, 0xFEE3, 0xFF04, 0xF705,
+    0xF705, 0xFF26, 0xFF07, 0xF748, 0xFFB4, 0xFF95, 0xFFB5, 0xFF95,
+    0xF7B5, 0xFF95, 0xFFB4, 0xF748, 0xFF07, 0xF726, 0xFF05, 0xEEC5,
+    0x51A2, 0x4122, 0x3101, 0x28E1, 0x2081, 0x1861, 0x1020, 0x0820,
+    0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x0840, 0x0840,
+    0x1080, 0x1881, 0x18C1, 0x28C1, 0x8363, 0xFF04, 0xFF05, 0xF705,
+    0xF726, 0xFF07, 0xF748, 0xFFD2, 0xFF95, 0xFF96, 0xFFB6, 0xFFB5,
+    0xFFB6, 0xFFB6, 0xFF95, 0xFFAF, 0xF707, 0xFF26, 0xFF26, 0xFF25,
+    0x8323, 0x4983, 0x3921, 0x28E1, 0x18C1, 0x2081, 0x1841, 0x0840,
+    0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0840, 0x0840,
+    0x1080, 0x2081, 0x28E1, 0x3122, 0xA4C4, 0xFF04, 0xFF05, 0xF726,
+    0xFF07, 0xFF47, 0xFFB0, 0xFFB6, 0xFFB6, 0xFF96, 0xFFD6, 0xFFB6,
+    0xFFD6, 0xFF96, 0xFFB6, 0xF795, 0xFF4A, 0xFF47, 0xF726, 0xFF26,
+    0xB4E3, 0x4183, 0x3162, 0x2922, 0x20C1, 0x1881, 0x1080, 0x0840,
+    0x0820, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0820, 0x1080,
+    0x18A0, 0x18C1, 0x28C1, 0x2902, 0xD603, 0xF705, 0xF706, 0xFF46,
+    0xFF47, 0xF7AF, 0xFFD5, 0xFFB6, 0xFFB6, 0xFFB6, 0xFFD6, 0xFFB7,
+    0xFFD6, 0xFFB6, 0xFFD6, 0xFFB6, 0xFFB2, 0xFF48, 0xFF47, 0xFF26,
+    0xFF05, 0x5244, 0x3962, 0x2922, 0x28E1, 0x2081, 0x1080, 0x0840,
+    0x0840, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x0840, 0x0840, 0x1080,
+    0x18A0, 0x20C1, 0x2922, 0x49E3, 0xF724, 0xFF45, 0xFF46, 0xFF47,
+    0xFF6C, 0xFFD5, 0xFFB6, 0xFFD6, 0xFFB7, 0xFFD7, 0xFFB7, 0xFFD7,
+    0xFFB7, 0xFFB7, 0xFFD7, 0xFFB6, 0xFFB6, 0xFF4A, 0xFF47, 0xF746,
+    0xFF45, 0x9423, 0x3982, 0x2922, 0x20E1, 0x20C1, 0x18A0, 0x0840,
+    0x0840, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0840, 0x0840, 0x1080,
+    0x2081, 0x20E1, 0x2922, 0x9423, 0xF725, 0xFF45, 0xFF46, 0xF748,
+    0xFF94, 0xFFD6, 0xFFB6, 0xFFD7, 0xFFD7, 0xFFD7, 0xFFD8, 0xF7D7,
+    0xFFD7, 0xFFD7, 0xFFB7, 0xFFD6, 0xFFD6, 0xFF8D, 0xFF48, 0xFF47,
+    0xFF46, 0xF705, 0x5A24, 0x3162, 0x2901, 0x20C1, 0x18A0, 0x1080,
+    0x0840, 0x0020, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0020, 0x0820, 0x0840, 0x1080, 0x18A0,
+    0x20C1, 0x2101, 0x3122, 0xE6A3, 0xFF45, 0xFF46, 0xFF47, 0xFFAF,
+    0xFFD6, 0xFFB6, 0xFFD7, 0xFFD7, 0xFFD8, 0xFFD8, 0xFFD8, 0xFFD8,
+    0xFFD8, 0xFFD8, 0xFFD8, 0xFFB7, 0xFFD6, 0xF74A, 0xFF49, 0xFF48,
+    0xFF46, 0xF745, 0xB545, 0x3162, 0x2922, 0x18C1, 0x1880, 0x1080,
+    0x0840, 0x0840, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0020, 0x0840, 0x0840, 0x1060, 0x18A0,
+    0x20C1, 0x20E1, 0x6303, 0xF744, 0xFF65, 0xF766, 0xF789, 0xFFD5,
+    0xFFB6, 0xFFD7, 0xFFD7, 0xFFD8, 0xFFD8, 0xFFF9, 0xFFD9, 0xFFF9,
+    0xFFD9, 0xFFD8, 0xFFD8, 0xFFD8, 0xFFB4, 0xFFAB, 0xFF89, 0xFF88,
+    0xFF47, 0xFF46, 0xFF45, 0x5262, 0x3122, 0x2101, 0x18A0, 0x1080,
+    0x0840, 0x0840, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0020, 0x0020, 0x0840, 0x0840, 0x1080, 0x18A0,
+    0x20C1, 0x3122, 0xB503, 0xFF45, 0xFF86, 0xFF87, 0xFFAF, 0xFFD6,
+    0xFFB7, 0xFFD7, 0xFFD8, 0xFFD8, 0xFFD9, 0xFFFA, 0xFFDA, 0xFFFA,
+    0xFFDA, 0xFFF9, 0xFFD9, 0xFFD8, 0xFFD5, 0xFF8C, 0xFF8A, 0xFF89,
+    0xF788, 0xFF86, 0xFF65, 0x9CA4, 0x2922, 0x20E1, 0x20C1, 0x1080,
+    0x0840, 0x0840, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0020, 0x0840, 0x0840, 0x1080, 0x1080,
+    0x18C1, 0x2922, 0xF704, 0xF765, 0xFF66, 0xFF88, 0xFFD4, 0xFFB6,
+    0xFFD7, 0xFFD8, 0xFFD8, 0xFFF9, 0xFFDA, 0xFFFB, 0xFFDB, 0xFFFB,
+    0xFFDB, 0xFFFA, 0xFFDA, 0xFFF9, 0xFFD8, 0xF78D, 0xFF8B, 0xFFAA,
+    0xFF88, 0xFF87, 0xFF86, 0xEEC5, 0x3162, 0x2901, 0x20C1, 0x18A0,
+    0x0840, 0x0840, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0820, 0x0840, 0x0840, 0x1080, 0x18A0,
+    0x2901, 0x5262, 0xFF85, 0xFF86, 0xF766, 0xFF8C, 0xFFD6, 0xFFB7,
+    0xFFD7, 0xFFD8, 0xFFF9, 0xFFDA, 0xFFFB, 0xFFFC, 0xFFDC, 0xFFFC,
+    0xFFDC, 0xFFDB, 0xFFFA, 0xFFD9, 0xFFF8, 0xFFB2, 0xFF8C, 0xFFAA,
+    0xFF89, 0xF788, 0xFF66, 0xFF65, 0x4A62, 0x20E1, 0x18C1, 0x18A0,
+    0x1080, 0x0820, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0020, 0x0840, 0x0840, 0x1060, 0x20C1,
+    0x2101, 0x6B64, 0xFF65, 0xFF66, 0xF788, 0xFFB0, 0xFFD6, 0xFFD7,
+    0xFFD8, 0xFFD8, 0xFFD9, 0xFFDA, 0xFFFC, 0xFFFD, 0xFFFD, 0xFFFE,
+    0xFFFD, 0xFFFC, 0xFFDB, 0xFFFA, 0xFFD9, 0xFFD7, 0xFF8D, 0xFFAB,
+    0xFF89, 0xFF88, 0xFF87, 0xFF85, 0x83C4, 0x2101, 0x20C1, 0x18A0,
+    0x1080, 0x0840, 0x0840, 0x0820, 0x0020, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0020, 0x0020, 0x0840, 0x0840, 0x1080, 0x18A0,
+    0x2901, 0x9C43, 0xFF86, 0xFF66, 0xFF88, 0xFFB0, 0xFFD6, 0xFFD7,
+    0xFFD8, 0xFFD8, 0xFFDA, 0xFFFB, 0xFFFC, 0xFFFD, 0xFFFE, 0xFFFE,
+    0xFFFE, 0xFFFD, 0xFFDB, 0xFFDA, 0xFFF9, 0xFFD8, 0xFFD4, 0xF78B,
+    0xFFAA, 0xFF89, 0xF787, 0xFF66, 0xB545, 0x2101, 0x18C1, 0x10A0,
+    0x1060, 0x0840, 0x0840, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x1080, 0x1060, 0x18C1,
+    0x20E1, 0xA4C4, 0xFF66, 0xF787, 0xFF88, 0xFFB0, 0xFFD6, 0xF7D7,
+    0xFFD8, 0xFFD9, 0xFFFA, 0xFFDB, 0xFFFD, 0xFFFE, 0xFFFE, 0xFFFE,
+    0xFFFE, 0xFFFD, 0xFFFB, 0xFFDA, 0xFFF9, 0xFFD8, 0xFFD7, 0xFFAF,
+    0xFFAA, 0xFF89, 0xFF88, 0xFF86, 0xE645, 0x2101, 0x20C1, 0x18A0,
+    0x1080, 0x0840, 0x0840, 0x0820, 0x0020, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0020, 0x0820, 0x0840, 0x1060, 0x1080, 0x20C1,
+    0x2101, 0xA4C4, 0xFF86, 0xFF87, 0xFF88, 0xFFAF, 0xFFD6, 0xFFD7,
+    0xFFD8, 0xFFD9, 0xFFDA, 0xFFFB, 0xFFFC, 0xFFFD, 0xFFFE, 0xFFFE,
+    0xFFFE, 0xFFFD, 0xFFDB, 0xFFDA, 0xFFF9, 0xFFD8, 0xFFD7, 0xFFD6,
+    0xFF8B, 0xFF89, 0xF788, 0xFF87, 0xEF25, 0x20E1, 0x18C1, 0x18A0,
+    0x1080, 0x0840, 0x0840, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0020, 0x0020, 0x0840, 0x0840, 0x1080, 0x10A0,
+    0x20E1, 0xA4A4, 0xFF87, 0xF788, 0xFF89, 0xFFAC, 0xFFD7, 0xF7D7,
+    0xFFD8, 0xFFF9, 0xFFD9, 0xFFDB, 0xFFFC, 0xFFFD, 0xFFFD, 0xFFFD,
+    0xFFFD, 0xFFFC, 0xFFDB, 0xFFFA, 0xFFD9, 0xFFD8, 0xFFD7, 0xFFF7,
+    0xFFB0, 0xFF89, 0xFF88, 0xFF87, 0xFF86, 0x3122, 0x20C1, 0x18A0,
+    0x1080, 0x0860, 0x0820, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0820, 0x0840, 0x0840, 0x1080, 0x18A0,
+    0x20C1, 0xA4C4, 0xFF87, 0xFFA7, 0xFFA8, 0xFFAA, 0xFFD6, 0xFFD7,
+    0xFFD8, 0xFFD8, 0xFFD9, 0xFFDA, 0xFFFB, 0xFFFC, 0xFFDC, 0xFFFD,
+    0xFFFC, 0xFFDB, 0xFFDA, 0xFFFA, 0xFFD9, 0xFFD8, 0xFFD7, 0xFFD7,
+    0xFFD6, 0xF78A, 0xFF88, 0xFF87, 0xF787, 0x3982, 0x18C1, 0x1880,
+    0x1080, 0x0840, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0020, 0x0840, 0x0840, 0x1080, 0x1880,
+    0x18C1, 0x7BC4, 0xF787, 0xFF88, 0xFFA8, 0xF78A, 0xFFD4, 0xFFD7,
+    0xFFD8, 0xFFF8, 0xFFD9, 0xFFFA, 0xFFDA, 0xFFFB, 0xFFDB, 0xFFFB,
+    0xFFDB, 0xFFFB, 0xFFDA, 0xFFF9, 0xFFD9, 0xFFD8, 0xFFD7, 0xFFF7,
+    0xFFD6, 0xFFCD, 0xFFA8, 0xFFA7, 0xFFA7, 0x4182, 0x18A0, 0x1080,
+    0x0840, 0x0840, 0x0020, 0x0820, 0x0020, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0820, 0x0840, 0x0840, 0x1080, 0x18A0,
+    0x20C1, 0x6B23, 0xFFA7, 0xFFA8, 0xFFA8, 0xFF8A, 0xFFB0, 0xFFF7,
+    0xF7D7, 0xFFD8, 0xFFD8, 0xFFF9, 0xFFDA, 0xFFFA, 0xFFD6, 0xFFB6,
+    0xFFDA, 0xFFFA, 0xFFD9, 0xFFF9, 0xFFD8, 0xFFD8, 0xFFD7, 0xFFF6,
+    0xFFD6, 0xFFCD, 0xFFA8, 0xF7A7, 0xFF87, 0x3182, 0x1080, 0x1080,
+    0x0840, 0x0840, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0840, 0x1060, 0x18A0,
+    0x18C1, 0x39C2, 0xF7A7, 0xFFA8, 0xFFA8, 0xFFAA, 0xF7AD, 0xFFF7,
+    0xFFD7, 0xFFF8, 0xFFD8, 0xFFF9, 0xFFD9, 0xFFD4, 0xF7B2, 0xFFB2,
+    0xFFD4, 0xFFF9, 0xFFD9, 0xFFF8, 0xFFD8, 0xFFF7, 0xFFD7, 0xFFF6,
+    0xFFD6, 0xFFCC, 0xFFA8, 0xFFA8, 0xFFC7, 0x3122, 0x18A0, 0x1080,
+    0x0840, 0x0840, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0020, 0x0820, 0x0020, 0x0840, 0x0840, 0x1080,
+    0x18A0, 0x20C1, 0xEF07, 0xFFA8, 0xFFA8, 0xFFAA, 0xFF8A, 0xFFD4,
+    0xFFD7, 0xFFF7, 0xFFD8, 0xFFF8, 0xFFD6, 0xF7B0, 0xFFB0, 0xFFB0,
+    0xFFB0, 0xF7D4, 0xFFD8, 0xFFF8, 0xFFD8, 0xFFF7, 0xFFD7, 0xFFF6,
+    0xFFD6, 0xFFAA, 0xFFA8, 0xF7A8, 0xF787, 0x18A1, 0x0860, 0x1060,
+    0x0840, 0x0840, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0840, 0x0840, 0x1060,
+    0x18A0, 0x18A1, 0x9CA4, 0xFFA8, 0xFFA8, 0xF7C9, 0xFFAA, 0xFFAD,
+    0xFFF7, 0xFFD7, 0xF7D7, 0xFFF8, 0xFFB0, 0xFFAF, 0xFFAF, 0xAD49,
+    0xF74E, 0xFFAF, 0xFFD7, 0xFFF8, 0xFFD7, 0xFFF7, 0xFFD6, 0xFFD6,
+    0xFFB0, 0xFFC9, 0xFFA8, 0xFFC8, 0xEF07, 0x18A0, 0x1080, 0x0840,
+    0x0840, 0x0020, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0820, 0x0840, 0x1060,
+    0x1080, 0x18A0, 0x49E3, 0xFFC8, 0xFFC9, 0xFFC9, 0xFFCA, 0xFFCB,
+    0xFFB4, 0xFFD7, 0xF7F7, 0xFFD4, 0xFFAD, 0xFFAD, 0xE72B, 0x6B07,
+    0xAD49, 0xFFCD, 0xFFD2, 0xFFD7, 0xFFF7, 0xFFD7, 0xFFF6, 0xFFD6,
+    0xF7CB, 0xFFC9, 0xFFA8, 0xFFA8, 0xC626, 0x1080, 0x0860, 0x0840,
+    0x0840, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0840, 0x0840,
+    0x1080, 0x1080, 0x18A1, 0xC626, 0xFFA9, 0xFFC9, 0xF7CA, 0xFFCB,
+    0xFFCD, 0xFFD7, 0xFFF7, 0xFFAD, 0xFFCD, 0xFFCD, 0xAD69, 0x7307,
+    0x6B07, 0xF78D, 0xFFAD, 0xFFF7, 0xFFD7, 0xFFF7, 0xFFD6, 0xFFB0,
+    0xFFA9, 0xFFC9, 0xFFA8, 0xFFC8, 0x9465, 0x1080, 0x0840, 0x0840,
+    0x0020, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x0020, 0x0840,
+    0x1080, 0x1060, 0x18A0, 0x62A3, 0xFFC9, 0xFFC9, 0xFFCA, 0xFFCA,
+    0xFFCB, 0xFFD2, 0xFFD4, 0xF7AC, 0xFFAC, 0xFFCC, 0x8C45, 0x6284,
+    0x6284, 0xE6CB, 0xFFCC, 0xFFD4, 0xFFD7, 0xFFD6, 0xFFF6, 0xFFCB,
+    0xF7CA, 0xFFC9, 0xFFA9, 0xF788, 0x3162, 0x0860, 0x0840, 0x0840,
+    0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0840,
+    0x0840, 0x1080, 0x10A0, 0x1080, 0xA4A4, 0xF7C9, 0xFFCA, 0xFFCA,
+    0xFFCB, 0xFFCB, 0xFFAD, 0xFFCB, 0xFFCC, 0xFFCC, 0x6284, 0x5224,
+    0x5224, 0xAD49, 0xFFCB, 0xFFB2, 0xFFF6, 0xFFD6, 0xFFCD, 0xFFCA,
+    0xFFCA, 0xFFC9, 0xFFC9, 0x83C4, 0x1080, 0x0840, 0x0840, 0x0820,
+    0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x0020,
+    0x0840, 0x0840, 0x1080, 0x18A0, 0x20C1, 0x7B84, 0xF76A, 0xFFCA,
+    0xFFCB, 0xFFCB, 0xFFCB, 0xF7CB, 0xFFCB, 0xE72B, 0x41E3, 0x49E3,
+    0x39E2, 0x9465, 0xFFCB, 0xFFCC, 0xFFB2, 0xFFCD, 0xFFCB, 0xFFCA,
+    0xFFCA, 0xFFC9, 0x9CA4, 0x0860, 0x0840, 0x0840, 0x0840, 0x0020,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,
+    0x0840, 0x0840, 0x0840, 0x1080, 0x18A0, 0x10A0, 0x3162, 0x7BC4,
+    0xDEC8, 0xFFCB, 0xFFCB, 0xFFCB, 0xFFCB, 0xB569, 0x39A2, 0x3982,
+    0x3982, 0x6303, 0xF7CB, 0xFFCB, 0xFFCB, 0xFFCB, 0xFFCA, 0xFFCA,
+    0xF76A, 0x7B84, 0x1060, 0x1080, 0x0840, 0x0840, 0x0020, 0x0820,
+    0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0820,
+    0x0020, 0x0840, 0x0840, 0x1040, 0x1080, 0x18A0, 0x18A0, 0x18C1,
+    0x20C1, 0x5262, 0xA4C4, 0xEF2B, 0xFFCB, 0x7364, 0x2922, 0x3162,
+    0x2922, 0x3962, 0xCE26, 0xFFCB, 0xFFCA, 0xFFCA, 0xEF6A, 0x9445,
+    0x20E1, 0x0880, 0x1060, 0x0840, 0x0840, 0x0020, 0x0820, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0020, 0x0840, 0x0860, 0x0840, 0x1060, 0x1080, 0x18A0,
+    0x18A0, 0x20C1, 0x18C1, 0x2901, 0x5262, 0x2922, 0x2901, 0x2101,
+    0x2901, 0x2101, 0x2101, 0x49E3, 0x62A3, 0x41E2, 0x20C1, 0x1080,
+    0x1060, 0x1080, 0x0840, 0x0840, 0x0820, 0x0020, 0x0020, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,
+    0x0000, 0x0020, 0x0820, 0x0840, 0x0840, 0x0840, 0x1080, 0x1060,
+    0x1080, 0x18A0, 0x18A0, 0x10A0, 0x20C1, 0x20C1, 0x20C1, 0x18C1,
+    0x20C1, 0x20C1, 0x20C1, 0x10A0, 0x18A0, 0x18A0, 0x1060, 0x1080,
+    0x0840, 0x0840, 0x0840, 0x0020, 0x0820, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0020, 0x0000, 0x0820, 0x0020, 0x0840, 0x0840, 0x0840,
+    0x1080, 0x1060, 0x1080, 0x18A0, 0x18A0, 0x10A0, 0x18A0, 0x18A0,
+    0x18A0, 0x10A0, 0x18A0, 0x1060, 0x1080, 0x1060, 0x1080, 0x0840,
+    0x0840, 0x0840, 0x0820, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0820, 0x0840, 0x0820,
+    0x0840, 0x0860, 0x1080, 0x1060, 0x1080, 0x1060, 0x1080, 0x1060,
+    0x1080, 0x1060, 0x1080, 0x1060, 0x0840, 0x0860, 0x0840, 0x0820,
+    0x0020, 0x0820, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x0020, 0x0020, 0x0840,
+    0x0820, 0x0840, 0x0860, 0x1040, 0x0860, 0x0840, 0x0860, 0x1040,
+    0x0860, 0x0840, 0x0860, 0x0840, 0x0820, 0x0840, 0x0840, 0x0020,
+    0x0820, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0820,
+    0x0020, 0x0820, 0x0840, 0x0840, 0x0020, 0x0840, 0x0820, 0x0840,
+    0x0020, 0x0840, 0x0820, 0x0840, 0x0020, 0x0020, 0x0820, 0x0000,
+    0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000,
+    0x0020, 0x0820, 0x0020, 0x0820, 0x0020, 0x0820, 0x0020, 0x0820,
+    0x0020, 0x0820, 0x0020, 0x0820, 0x0020, 0x0020, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0000, 0x0020,
+    0x0000, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0000,
+    0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 } };
@@ -0,0 +1,115 @@
+#!/usr/bin/env python3
+"""Convert a Glowing Mirror Mask animation header to changed-pixel runs.
+
+Takes a header with raw frames (IMG_WIDTH/IMG_HEIGHT/IMG_FRAMES/IMG_DELAY
+defines and a 'const uint16_t frames[][]' array of RGB565 pixels) and writes
+one where each frame is stored as only the runs of pixels that differ from
+the frame before it, which is also all the sketch needs to send to the
+screen.
+
+Usage: frames2spans.py fire_raw.h > fire.h
+"""
+
+import re
+import sys
+
+# Unchanged pixels this short between two changed runs are sent anyway;
+# starting a new run costs an address window (11 bytes) on the SPI bus
+MERGE_GAP = 4
+
+NAMES = ('IMG_WIDTH', 'IMG_HEIGHT', 'IMG_FRAMES', 'IMG_DELAY')
+
+
+def runs(prev, cur, width, height):
+    """Yield (x, y, pixels) for each run of changed pixels"""
+    for y in range(height):
+        row = range(y * width, (y + 1) * width)
+        changed = [x for x, i in enumerate(row) if prev[i] != cur[i]]
+        if not changed:
+            continue
+        start = end = changed[0]
+        for x in changed[1:] + [None]:
+            if x is not None and x - end - 1 <= MERGE_GAP:
+                end = x
+                continue
+            yield start, y, cur[y * width + start:y * width + end + 1]
+            if x is not None:
+                start = end = x
+
+
+def swap(pixel):
+    """RGB565 to big-endian, the order the display wants on the wire"""
+    return ((pixel & 0xFF) << 8) | (pixel >> 8)
+
+
+def parse(text):
+    """Return (defines, frames) from a raw frames header"""
+    define = {}
+    for name in NAMES:
+        define[name] = int(re.search(name + r'\s+(\d+)', text).group(1))
+    width, height = define['IMG_WIDTH'], define['IMG_HEIGHT']
+    count = define['IMG_FRAMES']
+    if width > 256 or height > 256:
+        sys.exit('images up to 256x256 only')  # x and y share a word
+
+    body = text[text.index('frames['):]
+    pixels = [int(v, 16) for v in re.findall(r'0x[0-9A-Fa-f]{4}', body)]
+    size = width * height
+    if len(pixels) != size * count:
+        sys.exit(f'expected {size * count} pixels, found {len(pixels)}')
+    return define, [pixels[i * size:(i + 1) * size] for i in range(count)]
+
+
+def encode(frames, width, height):
+    """Return (offsets, words): the run lists and where each one starts"""
+    # List N changes frame N-1 into frame N; the extra list at the end
+    # draws frame 0 onto the black screen at startup
+    lists = [(frames[i - 1], frames[i]) for i in range(len(frames))]
+    lists.append(([0] * (width * height), frames[0]))
+
+    words, offsets = [], []
+    for prev, cur in lists:
+        offsets.append(len(words))
+        for x, y, run in runs(prev, cur, width, height):
+            words += [(y << 8) | x, len(run)] + [swap(p) for p in run]
+    offsets.append(len(words))
+    return offsets, words
+
+
+def emit(text, define, offsets, words):
+    """Print the generated header"""
+    # Keep the artwork credit comment at the top, if any
+    credit = []
+    for line in text.splitlines():
+        if not line.startswith('//'):
+            break
+        credit.append(line)
+    if credit:
+        print('\n'.join(credit) + '\n')
+    for name in NAMES:
+        print(f'#define {name:<10} {define[name]}')
+    print('''
+// Generated by frames2spans.py. Each frame is stored as the runs of pixels
+// that changed since the frame before: (y << 8) | x, length, then that
+// many big-endian RGB565 pixels. Runs frameSpans[N] up to frameSpans[N + 1]
+// turn frame N-1 into frame N (frame 0 follows the last frame), and the
+// list at frameSpans[IMG_FRAMES] draws frame 0 onto a black screen.''')
+    print('const uint32_t frameSpans[IMG_FRAMES + 2] = {')
+    print('  ' + ', '.join(str(o) for o in offsets) + ' };')
+    print()
+    print('const uint16_t spans[] = {')
+    for i in range(0, len(words), 8):
+        line = ', '.join(f'0x{w:04X}' for w in words[i:i + 8])
+        print('  ' + line + (',' if i + 8 < len(words) else ' };'))
+
+
+def main():
+    with open(sys.argv[1], encoding='utf-8') as source:
+        text = source.read()
+    define, frames = parse(text)
+    offsets, words = encode(frames, define['IMG_WIDTH'], define['IMG_HEIGHT'])
+    emit(text, define, offsets, words)
+
+
+if __name__ == '__main__':
+    main()
@@ -281,54 +281,149 @@ uint8_t *lights_for_group(const char *group_number)
 }
 
 
-void update_light(uint8_t light_number, boolean on_off, uint8_t brightness)
+// Requests to the bridge go over their own connection, kept open between
+// updates, so they don't disturb MQTT. Each request is formatted into
+// hue_request and sent with a single write.
+WiFiClient hue_client;
+char hue_request[256];
+
+boolean hue_connect()
 {
-  if (!client.connect(hue_ip, 80)) {
-    return;
-  } 
+  if (hue_client.connected()) {
+    return true;
+  }
+  hue_client.stop();
+  return hue_client.connect(hue_ip, 80);
+}
 
-  log("Turning light ");
-  log(light_number);
+
+// Send "PUT /api/<user>/<resource>" setting on/off and brightness. Doesn't
+// wait for the response, so several can be in flight (pipelined) at once.
+// Brightness is left out when turning off: the bridge answers that with
+// an error, as a light that's off has no brightness to set.
+boolean hue_put(const char *resource, boolean on_off, uint8_t brightness)
+{
+  char content[32];
+  int content_length = on_off ? sprintf(content, "{\"on\":true,\"bri\":%d}", brightness)
+                              : sprintf(content, "{\"on\":false}");
+
+  int length = snprintf(hue_request, sizeof(hue_request),
+                        "PUT /api/" HUE_USER "/%s HTTP/1.1\r\n"
+                        "Host: %s\r\n"
+                        "Content-Type: application/json\r\n"
+                        "User-Agent: FeatherM0Sender\r\n"
+                        "Content-Length: %d\r\n"
+                        "\r\n"
+                        "%s",
+                        resource, hue_ip, content_length, content);
+  if (length >= (int)sizeof(hue_request)) {
+    return false;
+  }
+
+  log("PUT ");
+  log(resource);
   logln(on_off ? " on" : " off");
 
-  log("PUT /api/");
-  log(HUE_USER);
-  log("/lights/");
-  log(light_number);
-  logln("/state HTTP/1.1");
+  return hue_client.write((const uint8_t *)hue_request, length) == (size_t)length;
+}
 
-  char content[32];
-  sprintf(content, "{\"on\":%s,\"bri\":%d}", on_off ? "true" : "false", brightness);
 
-  client.print("PUT /api/");
-  client.print(HUE_USER);
-  client.print("/lights/");
-  client.print(light_number);
-  client.println("/state HTTP/1.1");
+// Read one response, consuming its body so the connection can be reused.
+// Returns true if the bridge accepted the request. The bridge answers
+// 200 even when a command fails, with an "error" object in the body.
+boolean hue_response()
+{
+  char line[64];
+  size_t n = hue_client.readBytesUntil('\n', line, sizeof(line) - 1);
+  line[n] = 0;
+  boolean ok = (strncmp(line, "HTTP/1.1 200", 12) == 0);
+
+  long content_length = -1;
+  while ((n = hue_client.readBytesUntil('\n', line, sizeof(line) - 1)) > 1) {
+    line[n] = 0;
+    if (strncasecmp(line, "Content-Length:", 15) == 0) {
+      content_length = atol(line + 15);
+    }
+  }
+  if (n == 0 || content_length < 0) {
+    // Timed out, or no length so we can't find the next response
+    hue_client.stop();
+    return false;
+  }
 
-  client.print("Host: ");
-  client.println(hue_ip);
+  // Look for "error" anywhere in the body as it's read, a chunk at a
+  // time; 'matched' carries a partial match from one chunk to the next.
+  static const char error_key[] = "\"error\"";
+  uint8_t matched = 0;
+  boolean error = false;
+  long remaining = content_length;
+  while (remaining > 0 && (n = hue_client.readBytes(line, min(remaining, (long)sizeof(line)))) > 0) {
+    remaining -= n;
+    for (size_t i = 0; i < n && !error; i++) {
+      if (line[i] == error_key[matched]) {
+        matched++;
+      } else {
+        matched = (line[i] == '"') ? 1 : 0;
+      }
+      error = (matched == sizeof(error_key) - 1);
+    }
+  }
+  if (remaining > 0) {
+    hue_client.stop();
+    return false;
+  }
+  return ok && !error;
+}
 
-  client.println("Connection: close");
 
-  client.print("Content-Type: ");
-  client.println("application/json");
-  client.println("User-Agent: FeatherM0Sender");
-  client.print("Content-Length: ");
-  client.println(strlen(content));
-  client.println();
+// Set every light in the room with one request to the group's action
+boolean update_group(const char *group_number, boolean on_off, uint8_t brightness)
+{
+  char resource[24];
+  sprintf(resource, "groups/%s/action", group_number);
+  if (!hue_connect() || !hue_put(resource, on_off, brightness)) {
+    hue_client.stop();
+    return false;
+  }
+  return hue_response();
+}
 
-  client.println(content);
-  client.stop();
+
+// Set lights individually, sending all the requests over one connection
+// before reading any of the responses. Every response is read, even after
+// one reports an error, so none is left for the next request to mistake
+// for its own.
+void update_lights(uint8_t *light_numbers, boolean on_off, uint8_t brightness)
+{
+  uint8_t num_lights = light_numbers[0];
+  uint8_t sent = 0;
+  char resource[24];
+
+  if (!hue_connect()) {
+    return;
+  }
+  for (int i = 0; i < num_lights; i++) {
+    sprintf(resource, "lights/%d/state", light_numbers[i+1]);
+    if (!hue_put(resource, on_off, brightness)) {
+      // Part of a request may have gone out; start afresh next time
+      hue_client.stop();
+      return;
+    }
+    sent++;
+  }
+  for (int i = 0; i < sent && hue_client.connected(); i++) {
+    hue_response();
+  }
 }
 
 
 void update_all_lights(uint8_t *light_numbers, boolean on_off, uint8_t brightness)
 {
   if (light_numbers != NULL) {
-    uint8_t num_lights = light_numbers[0];
-    for (int i = 0; i < num_lights; i++) {
-      update_light(light_numbers[i+1], on_off, brightness);
+    // All lights get the same state, so one group action does it. Fall
+    // back to per-light requests if the bridge didn't take it.
+    if (!update_group(ROOM_ID, on_off, brightness)) {
+      update_lights(light_numbers, on_off, brightness);
     }
   }
 }
@@ -0,0 +1,13 @@
+#pragma once
+#include "Arduino.h"
+
+#define NEO_GRB     0
+#define NEO_KHZ800  0
+
+class Adafruit_NeoPixel {
+ public:
+  Adafruit_NeoPixel(int, int, int) { }
+  void begin() { }
+  void show() { }
+  void setPixelColor(int, int, int, int) { }
+};
@@ -0,0 +1,15 @@
+#pragma once
+#include "Arduino.h"
+
+#define SSD1306_SWITCHCAPVCC 2
+
+class Adafruit_SSD1306 : public Print {
+ public:
+  Adafruit_SSD1306(int) { }
+  bool begin(int, int) { return true; }
+  void display() { }
+  void clearDisplay() { }
+  void setTextSize(int) { }
+  void setTextColor(int) { }
+  void setCursor(int, int) { }
+};
@@ -0,0 +1,37 @@
+// Just enough of Arduino for Hue_Controller.ino on a PC
+#pragma once
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <time.h>
+
+typedef uint8_t byte;
+typedef bool    boolean;
+
+#define F(s) (s)
+#define INPUT_PULLUP 2
+#define WHITE 1
+#define A1 15
+#define A5 19
+
+template <class A, class B> static A min(A a, B b) { return (a < (A)b) ? a : (A)b; }
+template <class A, class B> static A max(A a, B b) { return (a > (A)b) ? a : (A)b; }
+
+static inline void pinMode(int, int) { }
+static inline int  digitalRead(int) { return 1; }
+static inline int  analogRead(int) { return 0; }
+
+static inline void delay(uint32_t ms) {
+  struct timespec t = { (time_t)(ms / 1000), (long)(ms % 1000) * 1000000L };
+  nanosleep(&t, NULL);
+}
+
+// Adafruit_GFX's print()/println(), going nowhere
+class Print {
+ public:
+  template <class T> size_t print(T) { return 1; }
+  template <class T> size_t println(T) { return 1; }
+  size_t println() { return 1; }
+};
@@ -0,0 +1,24 @@
+// ArduinoJson 5's interface, enough to compile; the test doesn't parse
+#pragma once
+#include "Arduino.h"
+
+class JsonVariant {
+ public:
+  bool         success() const { return false; }
+  size_t       size() const { return 0; }
+  JsonVariant &operator[](int) { return *this; }
+  JsonVariant &operator[](const char *) { return *this; }
+  operator long() const { return 0; }
+  operator const char *() const { return ""; }
+};
+typedef JsonVariant JsonObject;
+typedef JsonVariant JsonArray;
+
+class DynamicJsonBuffer {
+ public:
+  DynamicJsonBuffer(size_t) { }
+  template <class S> JsonArray  &parseArray(S &) { return none; }
+  template <class S> JsonObject &parseObject(S &) { return none; }
+ private:
+  JsonVariant none;
+};
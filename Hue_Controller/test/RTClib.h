@@ -0,0 +1,26 @@
+#pragma once
+#include "Arduino.h"
+
+class DateTime {
+ public:
+  DateTime(int y, int mo, int d, int h, int mi, int s) :
+    y(y), mo(mo), d(d), h(h), mi(mi), s(s) { }
+  DateTime(const char *, const char *) : y(2019), mo(1), d(1), h(0), mi(0), s(0) { }
+  int  year() const { return y; }
+  int  month() const { return mo; }
+  int  day() const { return d; }
+  int  hour() const { return h; }
+  int  minute() const { return mi; }
+  int  second() const { return s; }
+  long secondstime() const { return (h * 60L + mi) * 60 + s; }
+ private:
+  int y, mo, d, h, mi, s;
+};
+
+class RTC_DS3231 {
+ public:
+  bool     begin() { return true; }
+  bool     lostPower() { return false; }
+  void     adjust(const DateTime &) { }
+  DateTime now() { return DateTime(2019, 1, 1, 12, 0, 0); }
+};
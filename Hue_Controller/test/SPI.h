@@ -0,0 +1,2 @@
+// Nothing from here is needed on a PC
+#pragma once
@@ -0,0 +1,110 @@
+// WiFi101 on a PC. WiFiClient is a real TCP socket (to hue_bridge.py),
+// charged what the WINC1500 takes to open a connection and to hand it a
+// write, and counting both.
+#pragma once
+#include "Arduino.h"
+#include <unistd.h>
+#include <poll.h>
+#include <arpa/inet.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+
+#define WL_IDLE_STATUS 0
+#define WL_CONNECTED   3
+
+extern int    bridgePort;
+extern double connectMs, writeMs;
+extern long   connects, writes;
+
+static inline void sleepMs(double ms) {
+  struct timespec t = { (time_t)(ms / 1000), (long)(ms * 1e6) % 1000000000L };
+  nanosleep(&t, NULL);
+}
+
+class WiFiClient : public Print {
+ public:
+  WiFiClient() : fd(-1) { }
+
+  int connect(const char *ip, int) {
+    stop();
+    sleepMs(connectMs);
+    connects++;
+    fd = socket(AF_INET, SOCK_STREAM, 0);
+    int one = 1;
+    setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof one);
+    sockaddr_in a;
+    memset(&a, 0, sizeof a);
+    a.sin_family = AF_INET;
+    a.sin_port   = htons(bridgePort);
+    inet_pton(AF_INET, ip, &a.sin_addr);
+    if (::connect(fd, (sockaddr *)&a, sizeof a)) stop();
+    return fd >= 0;
+  }
+  int connectSSL(const char *, int) { return 0; }
+
+  // Open until the bridge has closed its end and everything's been read
+  uint8_t connected() {
+    if (fd < 0) return 0;
+    char c;
+    return recv(fd, &c, 1, MSG_PEEK | MSG_DONTWAIT) != 0;
+  }
+  void stop() {
+    if (fd >= 0) close(fd);
+    fd = -1;
+  }
+  int available() {
+    char buf[256];
+    if (fd < 0) return 0;
+    ssize_t n = recv(fd, buf, sizeof buf, MSG_PEEK | MSG_DONTWAIT);
+    return (n > 0) ? n : 0;
+  }
+
+  size_t write(const uint8_t *b, size_t n) {
+    sleepMs(writeMs);
+    writes++;
+    return ((fd < 0) || (send(fd, b, n, MSG_NOSIGNAL) != (ssize_t)n)) ? 0 : n;
+  }
+  size_t print(const char *s) { return write((const uint8_t *)s, strlen(s)); }
+  size_t print(int v) {
+    char b[16];
+    sprintf(b, "%d", v);
+    return print(b);
+  }
+  size_t println(const char *s) { return print(s) + print("\r\n"); }
+  size_t println(int v) { return print(v) + print("\r\n"); }
+  size_t println() { return print("\r\n"); }
+
+  // Stream, with its one second timeout
+  int read() {
+    uint8_t c;
+    pollfd  p = { fd, POLLIN, 0 };
+    if ((fd < 0) || (poll(&p, 1, 1000) <= 0)) return -1;
+    return (recv(fd, &c, 1, 0) == 1) ? c : -1;
+  }
+  size_t readBytes(char *b, size_t n) {
+    size_t i = 0;
+    for (int c; (i < n) && ((c = read()) >= 0); ) b[i++] = c;
+    return i;
+  }
+  size_t readBytesUntil(char t, char *b, size_t n) {
+    size_t i = 0;
+    for (int c; (i < n) && ((c = read()) >= 0) && (c != t); ) b[i++] = c;
+    return i;
+  }
+  bool find(const char *s) {
+    size_t m = 0, n = strlen(s);
+    for (int c; (m < n) && ((c = read()) >= 0); ) m = (c == s[m]) ? m + 1 : (c == s[0]);
+    return m == n;
+  }
+
+ private:
+  int fd;
+};
+
+class WiFiClass {
+ public:
+  void setPins(int, int, int, int) { }
+  int  begin(const char *, const char *) { return WL_CONNECTED; }
+};
+
+static WiFiClass WiFi;
@@ -0,0 +1,80 @@
+"""
+A stand-in Hue bridge for hue_test.cpp: HTTP/1.1 with keep-alive, taking
+a couple of milliseconds over each command as the real one does.
+
+Lights 1-50 and group 4 exist. Like the bridge, it answers 200 even when a
+command fails, with an "error" object in the body: for a light or group
+that isn't there, and for a brightness sent along with "on": false.
+
+Usage:
+    python3 hue_bridge.py [port] [ms per command]
+
+Port 0 (the default) picks a free one. The port is printed on the first
+line of output once the bridge is listening.
+"""
+
+import json
+import sys
+import time
+from http.server import BaseHTTPRequestHandler, ThreadingHTTPServer
+
+LIGHTS = range(1, 51)
+GROUPS = ('4',)
+
+
+def results(path, state):
+    """The bridge's reply to setting 'state' on 'path'."""
+    parts = path.split('/')     # '', 'api', user, 'lights', n, 'state'
+    kind, number = parts[3], parts[4]
+    if ((kind == 'lights' and int(number) not in LIGHTS) or
+            (kind == 'groups' and number not in GROUPS)):
+        return [{'error': {'type': 3, 'address': '/%s/%s' % (kind, number),
+                           'description': 'resource not available'}}]
+    reply = []
+    for key, value in state.items():
+        address = '/%s/%s/%s/%s' % (kind, number, parts[5], key)
+        if key == 'bri' and not state.get('on', True):
+            reply.append({'error': {'type': 201, 'address': address,
+                                    'description': 'parameter, bri, is not '
+                                                   'modifiable. Device is set to off.'}})
+        else:
+            reply.append({'success': {address: value}})
+    return reply
+
+
+class Bridge(BaseHTTPRequestHandler):
+    protocol_version = 'HTTP/1.1'
+    disable_nagle_algorithm = True
+    delay = 0.002
+
+    def log_message(self, *args):
+        pass
+
+    def do_PUT(self):
+        body = self.rfile.read(int(self.headers.get('Content-Length', 0)))
+        time.sleep(self.delay)
+        out = json.dumps(results(self.path, json.loads(body))).encode()
+        self.send_response(200)
+        self.send_header('Content-Type', 'application/json')
+        self.send_header('Content-Length', str(len(out)))
+        self.end_headers()
+        self.wfile.write(out)
+
+
+class Server(ThreadingHTTPServer):
+    def handle_error(self, request, client_address):
+        pass    # The old sketch code hangs up without reading the reply
+
+
+def main():
+    """Command-line entry point."""
+    port = int(sys.argv[1]) if len(sys.argv) > 1 else 0
+    if len(sys.argv) > 2:
+        Bridge.delay = float(sys.argv[2]) / 1000
+    server = Server(('127.0.0.1', port), Bridge)
+    print(server.server_address[1], flush=True)
+    server.serve_forever()
+
+
+if __name__ == '__main__':
+    main()
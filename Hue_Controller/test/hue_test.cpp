@@ -0,0 +1,168 @@
+// Host test for the bridge requests in Hue_Controller.ino. Runs on a PC,
+// not the board; the headers next to this file stand in for the libraries,
+// with WiFiClient a real socket charged what the WINC1500 takes (20 ms to
+// open a connection, 0.5 ms a write).
+//
+// hue_bridge.py is started as the bridge. First the responses must stay
+// in step with the requests over the kept-alive connection: after
+// pipelined per-light requests where one light isn't there, nothing may be
+// left unread for the next request to take as its own. Switching off must
+// take the one group action, not fall back to a request per light. Then
+// switching the room on is timed with 1, 10 and 50 lights three ways: the
+// old request per light on a new connection each, the group action, and
+// per-light requests pipelined on one connection.
+//
+//   g++ -O2 -I. -o hue_test hue_test.cpp
+//   ./hue_test
+//
+// Needs python3 on the path. Exits nonzero on failure.
+
+#include <signal.h>
+#include <sys/wait.h>
+#include <chrono>
+#include "Arduino.h"
+#include "WiFi101.h"
+#include "RTClib.h"
+
+int    bridgePort;
+double connectMs = 20, writeMs = 0.5;
+long   connects, writes;
+
+// What the Arduino IDE would generate
+void init_log();
+void log(const char *msg);
+void log(const int i);
+void logln(const char *msg);
+const char *fetch_hue_ip();
+boolean fetch_sunrise_sunset(long *sunrise, long *sunset);
+boolean update_sunrise_sunset();
+uint8_t *lights_for_group(const char *group_number);
+boolean hue_connect();
+boolean hue_put(const char *resource, boolean on_off, uint8_t brightness);
+boolean hue_response();
+boolean update_group(const char *group_number, boolean on_off, uint8_t brightness);
+void update_lights(uint8_t *light_numbers, boolean on_off, uint8_t brightness);
+void update_all_lights(uint8_t *light_numbers, boolean on_off, uint8_t brightness);
+boolean is_between(DateTime *now, DateTime *start, DateTime *end);
+void MQTT_connect();
+void ping_if_time(DateTime now);
+
+// log() and friends ignore their argument unless TRACE is defined
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#include "../Hue_Controller.ino"
+#pragma GCC diagnostic pop
+
+static int failures = 0;
+
+static void check(bool ok, const char *what) {
+  if (!ok) { printf("FAIL: %s\n", what); failures++; }
+}
+
+// The sketch before it kept a connection to the bridge: a new one for
+// every light, the request sent in a dozen small writes, no response read
+void old_update_light(uint8_t light_number, boolean on_off, uint8_t brightness)
+{
+  if (!client.connect(hue_ip, 80)) {
+    return;
+  }
+
+  char content[32];
+  sprintf(content, "{\"on\":%s,\"bri\":%d}", on_off ? "true" : "false", brightness);
+
+  client.print("PUT /api/");
+  client.print(HUE_USER);
+  client.print("/lights/");
+  client.print(light_number);
+  client.println("/state HTTP/1.1");
+
+  client.print("Host: ");
+  client.println(hue_ip);
+
+  client.println("Connection: close");
+
+  client.print("Content-Type: ");
+  client.println("application/json");
+  client.println("User-Agent: FeatherM0Sender");
+  client.print("Content-Length: ");
+  client.println(strlen(content));
+  client.println();
+
+  client.println(content);
+  client.stop();
+}
+
+static double msSince(std::chrono::steady_clock::time_point start) {
+  return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+// Start hue_bridge.py and read back the port it's listening on
+static pid_t startBridge() {
+  int fds[2];
+  if (pipe(fds)) return -1;
+  pid_t pid = fork();
+  if (pid == 0) {
+    dup2(fds[1], 1);
+    close(fds[0]);
+    execlp("python3", "python3", "hue_bridge.py", "0", "2", (char *)NULL);
+    _exit(127);
+  }
+  close(fds[1]);
+  FILE *f = fdopen(fds[0], "r");
+  if (fscanf(f, "%d", &bridgePort) != 1) bridgePort = 0;
+  fclose(f);
+  return pid;
+}
+
+int main(void) {
+  pid_t bridge = startBridge();
+  if (!bridgePort) {
+    printf("couldn't start hue_bridge.py\n");
+    return 1;
+  }
+  hue_ip = "127.0.0.1";
+
+  // Light 99 isn't there, so its response is an error
+  uint8_t some[] = { 5, 1, 2, 99, 3, 4 };
+  update_lights(some, true, 100);
+  delay(50);
+  check(hue_client.available() == 0, "every pipelined response read");
+  check(!update_group("9", true, 100), "next request gets its own (error) reply");
+  check(update_group("4", true, 100), "and the one after");
+
+  // Switching off is one group action
+  uint8_t room[51];
+  room[0] = 50;
+  for (int i = 1; i <= 50; i++) room[i] = i;
+  writes = 0;
+  update_all_lights(room, false, 0);
+  check(writes == 1, "switching off takes the group action");
+
+  printf("lights  new connection per light  group action  pipelined\n");
+  const int counts[] = { 1, 10, 50 };
+  for (int c = 0; c < 3; c++) {
+    room[0] = counts[c];
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (int i = 0; i < counts[c]; i++) old_update_light(room[i + 1], true, 100);
+    double old = msSince(start);
+
+    hue_client.stop();
+    start = std::chrono::steady_clock::now();
+    check(update_group(ROOM_ID, true, 100), "group action");
+    double group = msSince(start);
+
+    start = std::chrono::steady_clock::now();
+    update_lights(room, true, 100);
+    double pipelined = msSince(start);
+    check(hue_client.available() == 0, "pipelined responses all read");
+
+    printf("%4d %18.0f ms %15.0f ms %9.0f ms\n", counts[c], old, group, pipelined);
+    if (counts[c] > 1) check(group < old / 2, "group action beats a connection per light");
+  }
+  printf("(the old way never waited for a response, so its times are a lower bound)\n");
+
+  kill(bridge, SIGTERM);
+  waitpid(bridge, NULL, 0);
+  printf("%s\n", failures ? "FAILED" : "responses kept in step");
+  return failures ? 1 : 0;
+}
@@ -0,0 +1,8 @@
+#pragma once
+
+#define WIFI_SSID   "test"
+#define WIFI_PASS   "test"
+#define AIO_USER    "test"
+#define AIO_KEY     "test"
+#define DARKSKY_KEY "test"
+#define HUE_USER    "testuser"
@@ -121,3 +121,9 @@ int AppleRewindSignal[] = {
 	906, 214,
 	66, 0};
 
+// The codes to look for, and what to print when one's heard
+IRcode IRcodes[] = {
+  { "PLAY",    ApplePlaySignal,    sizeof(ApplePlaySignal) / sizeof(int) / 2 },
+  { "REWIND",  AppleRewindSignal,  sizeof(AppleRewindSignal) / sizeof(int) / 2 },
+  { "FORWARD", AppleForwardSignal, sizeof(AppleForwardSignal) / sizeof(int) / 2 },
+};
@@ -8,24 +8,23 @@
  check out learn.adafruit.com  for more tutorials! 
  */
 
-// We need to use the 'raw' pin reading methods
-// because timing is very important here and the digitalRead()
-// procedure is slower!
+// The receiver is read in the background (see ircapture.h): an
+// interrupt on each change of the pin notes the time from Timer1, which
+// runs free at 4 microseconds a tick, so nothing here has to wait on it.
+// We read the pin the 'raw' way in the interrupt since digitalRead() is
+// slower!
 //uint8_t IRpin = 2;
 // Digital pin #2 is the same as Pin D2 see
 // http://arduino.cc/en/Hacking/PinMapping168 for the 'raw' pin mapping
 #define IRpin_PIN      PIND
 #define IRpin          2
+#define US_PER_TICK    (64 / (F_CPU / 1000000L))  // Timer1 at clk/64
 
-// the maximum pulse we'll listen for - 65 milliseconds is a long time
+// the maximum pulse we'll listen for - 65 milliseconds is a long time,
+// and once the line's been quiet that long the signal is over
 #define MAXPULSE 65000
 #define NUMPULSES 50
 
-// what our timing resolution should be, larger is better
-// as its more 'precise' - but too large and you wont get
-// accurate timing
-#define RESOLUTION 20 
-
 // What percent we will allow in variation to match the same code
 #define FUZZINESS 20
 
@@ -33,138 +32,88 @@
 uint16_t pulses[NUMPULSES][2];  // pair is high and low pulse 
 uint8_t currentpulse = 0; // index for pulses we're storing
 
+// the same, as ON, OFF pairs in 10's of microseconds like the stored codes
+int heard[NUMPULSES * 2];
+
+#include "ircapture.h"
+#include "irindex.h"
 #include "ircommander.h"
 
+IRCapture ir;
+IRindex codeIndex;
+
 void setup(void) {
   Serial.begin(9600);
+  irIndexBegin(&codeIndex, IRcodes, sizeof(IRcodes) / sizeof(IRcodes[0]));
+
+  ircap_begin(&ir, US_PER_TICK);
+  TCCR1A = 0;                          // Timer1 counts freely,
+  TCCR1B = _BV(CS11) | _BV(CS10);      // at clk/64
+  pinMode(IRpin, INPUT);
+  attachInterrupt(digitalPinToInterrupt(IRpin), irEdge, CHANGE);
   Serial.println("Ready to decode IR!");
 }
 
+// The pin changed: note when, and end the signal if it stays quiet
+void irEdge(void) {
+  uint16_t t = TCNT1;
+  ircap_edge(&ir, t, (IRpin_PIN >> IRpin) & 1);
+  OCR1A  = t + MAXPULSE / US_PER_TICK;
+  TIFR1  = _BV(OCF1A);                 // Clear any old match
+  TIMSK1 |= _BV(OCIE1A);
+}
+
+ISR(TIMER1_COMPA_vect) {
+  TIMSK1 &= ~_BV(OCIE1A);
+  ircap_gap(&ir);
+}
+
 void loop(void) {
   int numberpulses;
   
   numberpulses = listenForIR();
+  if (!numberpulses) {
+    return;  // nothing yet - free to do other things here
+  }
   
   Serial.print("Heard ");
   Serial.print(numberpulses);
   Serial.println("-pulse long IR signal");
-  if (IRcompare(numberpulses, ApplePlaySignal,sizeof(ApplePlaySignal)/4)) {
-    Serial.println("PLAY");
-  }
-    if (IRcompare(numberpulses, AppleRewindSignal,sizeof(AppleRewindSignal)/4)) {
-    Serial.println("REWIND");
-  }
-    if (IRcompare(numberpulses, AppleForwardSignal,sizeof(AppleForwardSignal)/4)) {
-    Serial.println("FORWARD");
-  }
-  delay(500);
-}
 
-//KGO: added size of compare sample. Only compare the minimum of the two
-boolean IRcompare(int numpulses, int Signal[], int refsize) {
-  int count = min(numpulses,refsize);
-  Serial.print("count set to: ");
-  Serial.println(count);
-  for (int i=0; i< count-1; i++) {
-    int oncode = pulses[i][1] * RESOLUTION / 10;
-    int offcode = pulses[i+1][0] * RESOLUTION / 10;
-    
-#ifdef DEBUG    
-    Serial.print(oncode); // the ON signal we heard
-    Serial.print(" - ");
-    Serial.print(Signal[i*2 + 0]); // the ON signal we want 
-#endif   
-    
-    // check to make sure the error is less than FUZZINESS percent
-    if ( abs(oncode - Signal[i*2 + 0]) <= (Signal[i*2 + 0] * FUZZINESS / 100)) {
-#ifdef DEBUG
-      Serial.print(" (ok)");
-#endif
-    } else {
-#ifdef DEBUG
-      Serial.print(" (x)");
-#endif
-      // we didn't match perfectly, return a false match
-      return false;
-    }
-    
-    
-#ifdef DEBUG
-    Serial.print("  \t"); // tab
-    Serial.print(offcode); // the OFF signal we heard
-    Serial.print(" - ");
-    Serial.print(Signal[i*2 + 1]); // the OFF signal we want 
-#endif    
-    
-    if ( abs(offcode - Signal[i*2 + 1]) <= (Signal[i*2 + 1] * FUZZINESS / 100)) {
-#ifdef DEBUG
-      Serial.print(" (ok)");
-#endif
-    } else {
-#ifdef DEBUG
-      Serial.print(" (x)");
-#endif
-      // we didn't match perfectly, return a false match
-      return false;
-    }
-    
+  // Look it up by its signature (see irindex.h), falling back to a fuzzy
+  // compare against each code in turn if that doesn't find it
+  int code = irLookup(&codeIndex, heard, toSignal(numberpulses));
+  if (code >= 0) {
+    Serial.println(IRcodes[code].name);
+  }
 #ifdef DEBUG
-    Serial.println();
+  Serial.print("index hits: "); Serial.print(codeIndex.hits);
+  Serial.print(", fallbacks: "); Serial.println(codeIndex.fallbacks);
 #endif
+}
+
+// Turn the pulses heard into ON, OFF pairs like the stored codes: each ON
+// is followed by the next pulse's OFF. Returns the number of pairs.
+int toSignal(int numpulses) {
+  for (int i = 0; i < numpulses; i++) {
+    heard[i*2 + 0] = pulses[i][1] / 10;
+    heard[i*2 + 1] = (i + 1 < numpulses) ? pulses[i+1][0] / 10 : 0;
   }
-  // Everything matched!
-  return true;
+  return numpulses;
 }
 
+// Any complete signal heard since last time? Returns its length in
+// pulses, now in pulses[], or 0 if not
 int listenForIR(void) {
-  currentpulse = 0;
-  
-  while (1) {
-    uint16_t highpulse, lowpulse;  // temporary storage timing
-    highpulse = lowpulse = 0; // start out with no pulse length
-  
-//  while (digitalRead(IRpin)) { // this is too slow!
-    while (IRpin_PIN & (1 << IRpin)) {
-       // pin is still HIGH
-
-       // count off another few microseconds
-       highpulse++;
-       delayMicroseconds(RESOLUTION);
-
-       // If the pulse is too long, we 'timed out' - either nothing
-       // was received or the code is finished, so print what
-       // we've grabbed so far, and then reset
-       
-       // KGO: Added check for end of receive buffer
-       if (((highpulse >= MAXPULSE) && (currentpulse != 0))|| currentpulse == NUMPULSES) {
-         return currentpulse;
-       }
-    }
-    // we didn't time out so lets stash the reading
-    pulses[currentpulse][0] = highpulse;
-  
-    // same as above
-    while (! (IRpin_PIN & _BV(IRpin))) {
-       // pin is still LOW
-       lowpulse++;
-       delayMicroseconds(RESOLUTION);
-        // KGO: Added check for end of receive buffer
-        if (((lowpulse >= MAXPULSE)  && (currentpulse != 0))|| currentpulse == NUMPULSES) {
-         return currentpulse;
-       }
-    }
-    pulses[currentpulse][1] = lowpulse;
-
-    // we read one high-low pulse successfully, continue!
-    currentpulse++;
-  }
+  currentpulse = ircap_read(&ir, pulses, NUMPULSES);
+  return currentpulse;
 }
 void printpulses(void) {
   Serial.println("\n\r\n\rReceived: \n\rOFF \tON");
   for (uint8_t i = 0; i < currentpulse; i++) {
-    Serial.print(pulses[i][0] * RESOLUTION, DEC);
+    Serial.print(pulses[i][0], DEC);
     Serial.print(" usec, ");
-    Serial.print(pulses[i][1] * RESOLUTION, DEC);
+    Serial.print(pulses[i][1], DEC);
     Serial.println(" usec");
   }
   
@@ -173,13 +122,13 @@ void printpulses(void) {
   Serial.println("// ON, OFF (in 10's of microseconds)");
   for (uint8_t i = 0; i < currentpulse-1; i++) {
     Serial.print("\t"); // tab
-    Serial.print(pulses[i][1] * RESOLUTION / 10, DEC);
+    Serial.print(pulses[i][1] / 10, DEC);
     Serial.print(", ");
-    Serial.print(pulses[i+1][0] * RESOLUTION / 10, DEC);
+    Serial.print(pulses[i+1][0] / 10, DEC);
     Serial.println(",");
   }
   Serial.print("\t"); // tab
-  Serial.print(pulses[currentpulse-1][1] * RESOLUTION / 10, DEC);
+  Serial.print(pulses[currentpulse-1][1] / 10, DEC);
   Serial.print(", 0};");
 }
 
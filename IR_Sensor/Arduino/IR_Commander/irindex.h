@@ -0,0 +1,192 @@
+// Indexed matching of received IR signals against stored codes
+//
+// Comparing a received signal pulse by pulse against every stored code
+// gets slower with each button added. Instead each stored code is reduced
+// to a 32-bit signature, kept in a small hash table, and a received signal
+// is looked up with one pass over its pulses however many codes there are:
+//
+//  - NEC frames (9 ms mark, 4.5 ms space, then 32 bits; Apple remotes use
+//    these too) are decoded, and the 32-bit code word is the signature.
+//  - Anything else is quantized: each mark and space is rounded to a
+//    multiple of the frame's basic unit, and the first IR_SIG_PAIRS pairs
+//    hashed. A hit is checked by comparing the rest of the pulses the
+//    same way, which allows for more jitter than the fuzzy compare.
+//
+// A pulse right on a rounding boundary can give a different signature, so
+// a miss falls back to the fuzzy compare against every code, as before.
+//
+// Signals are ON, OFF pairs in 10s of microseconds, as in ircommander.h.
+
+#ifndef IR_INDEX_H
+#define IR_INDEX_H
+
+#include <stdint.h>
+#include <stdlib.h>
+
+#ifndef FUZZINESS
+#define FUZZINESS 20         // percent variation allowed by the fuzzy compare
+#endif
+#ifndef IR_INDEX_SIZE
+#define IR_INDEX_SIZE 8      // hash slots, power of 2, 2x the codes or more
+#endif
+#define IR_SIG_PAIRS 16      // pairs hashed for non-NEC signals
+
+enum { IR_EMPTY, IR_NEC, IR_QUANT };
+
+typedef struct {
+  const char *name;
+  const int  *signal;
+  int         pairs;
+} IRcode;
+
+typedef struct {
+  uint32_t sig;
+  int16_t  code;             // index into the code list
+  uint8_t  kind;             // IR_EMPTY, IR_NEC or IR_QUANT
+} IRslot;
+
+typedef struct {
+  const IRcode *codes;
+  int           numCodes;
+  IRslot        slot[IR_INDEX_SIZE];
+  uint16_t      hits, fallbacks;  // lookups answered each way
+} IRindex;
+
+// The original check: every pair, up to the shorter of the two signals,
+// within FUZZINESS percent (the last pair's OFF is where they end)
+static bool irFuzzyMatch(const int *heard, int heardPairs,
+                         const int *ref, int refPairs) {
+  int count = (heardPairs < refPairs) ? heardPairs : refPairs;
+  for (int i = 0; i < (count - 1) * 2; i++) {
+    if (abs(heard[i] - ref[i]) > (long)ref[i] * FUZZINESS / 100) return false;
+  }
+  return true;
+}
+
+// NEC: leader, 32 bits LSB first as 0.56 ms marks followed by 0.56 ms (0)
+// or 1.69 ms (1) spaces, then a stop mark. True if that's what it is.
+static bool irDecodeNEC(const int *s, int pairs, uint32_t *word) {
+  if (pairs < 34) return false;
+  if (s[0] < 700 || s[0] > 1100 || s[1] < 350 || s[1] > 550) return false;
+  uint32_t w = 0;
+  for (int i = 1; i <= 32; i++) {
+    int on = s[i * 2], off = s[i * 2 + 1];
+    if (on < 30 || on > 100 || off < 25 || off > 250) return false;
+    if (off > 112) w |= (uint32_t)1 << (i - 1);
+  }
+  if (s[66] < 30 || s[66] > 100) return false;
+  *word = w;
+  return true;
+}
+
+// A signal's basic unit: the average of its short marks and short spaces
+// (within 1.5x the shortest), so a receiver that stretches marks and
+// shrinks spaces doesn't shift it. Looks at the first n pairs.
+static int irUnit(const int *s, int n) {
+  int minMark = 0x7FFF, minSpace = 0x7FFF, i;
+  long markSum = 0, spaceSum = 0;
+  int marks = 0, spaces = 0;
+
+  for (i = 0; i < n * 2; i++) {
+    if (s[i] <= 0) continue;
+    if (i & 1) { if (s[i] < minSpace) minSpace = s[i]; }
+    else       { if (s[i] < minMark)  minMark  = s[i]; }
+  }
+  for (i = 0; i < n * 2; i++) {
+    if (s[i] <= 0) continue;
+    if ((i & 1) && (s[i] * 2 < minSpace * 3)) { spaceSum += s[i]; spaces++; }
+    if (!(i & 1) && (s[i] * 2 < minMark * 3)) { markSum  += s[i]; marks++;  }
+  }
+  long unit = marks ? markSum / marks : 1;
+  if (spaces) unit = (unit + spaceSum / spaces) / 2;
+  return (unit < 1) ? 1 : unit;
+}
+
+// A mark or space rounded to a multiple of the unit
+static uint8_t irQuant(int d, int unit) {
+  long q = (d + unit / 2) / unit;
+  return (q > 255) ? 255 : q;
+}
+
+// Hash the first IR_SIG_PAIRS pairs, rounded to the unit
+static uint32_t irQuantize(const int *s, int pairs) {
+  int n = (pairs < IR_SIG_PAIRS) ? pairs : IR_SIG_PAIRS;
+  int unit = irUnit(s, n);
+  uint32_t h = 2166136261UL;               // FNV-1a
+  for (int i = 0; i < n * 2; i++) h = (h ^ irQuant(s[i], unit)) * 16777619UL;
+  return (h ^ n) * 16777619UL;
+}
+
+// Do two signals round to the same units all along? (Pairs as compared by
+// irFuzzyMatch: up to the shorter signal, except the last OFF.)
+static bool irQuantMatch(const int *heard, int heardPairs,
+                         const int *ref, int refPairs) {
+  int count = (heardPairs < refPairs) ? heardPairs : refPairs;
+  int n = (count < IR_SIG_PAIRS) ? count : IR_SIG_PAIRS;
+  int hu = irUnit(heard, n), ru = irUnit(ref, n);
+  for (int i = 0; i < (count - 1) * 2; i++) {
+    if (irQuant(heard[i], hu) != irQuant(ref[i], ru)) return false;
+  }
+  return true;
+}
+
+static uint8_t irSignature(const int *s, int pairs, uint32_t *sig) {
+  if (irDecodeNEC(s, pairs, sig)) return IR_NEC;
+  if (pairs < 2) return IR_EMPTY;
+  *sig = irQuantize(s, pairs);
+  return IR_QUANT;
+}
+
+// Index 'numCodes' codes; returns how many went in (the table may fill,
+// or two codes may be the same, leaving those to the fallback)
+static int irIndexBegin(IRindex *ix, const IRcode *codes, int numCodes) {
+  int added = 0;
+  ix->codes = codes;
+  ix->numCodes = numCodes;
+  ix->hits = ix->fallbacks = 0;
+  for (int i = 0; i < IR_INDEX_SIZE; i++) ix->slot[i].kind = IR_EMPTY;
+  for (int c = 0; c < numCodes; c++) {
+    uint32_t sig;
+    uint8_t kind = irSignature(codes[c].signal, codes[c].pairs, &sig);
+    if (kind == IR_EMPTY) continue;
+    for (int i = 0; i < IR_INDEX_SIZE; i++) {  // linear probing
+      IRslot *s = &ix->slot[(sig + i) & (IR_INDEX_SIZE - 1)];
+      if (s->kind == IR_EMPTY) {
+        s->sig = sig; s->kind = kind; s->code = c;
+        added++;
+        break;
+      }
+      if (s->sig == sig && s->kind == kind) break;  // duplicate
+    }
+  }
+  return added;
+}
+
+// Which code a received signal is; -1 if none
+static int irLookup(IRindex *ix, const int *heard, int pairs) {
+  uint32_t sig;
+  uint8_t kind = irSignature(heard, pairs, &sig);
+  if (kind != IR_EMPTY) {
+    for (int i = 0; i < IR_INDEX_SIZE; i++) {
+      const IRslot *s = &ix->slot[(sig + i) & (IR_INDEX_SIZE - 1)];
+      if (s->kind == IR_EMPTY) break;
+      if (s->sig != sig || s->kind != kind) continue;
+      const IRcode *c = &ix->codes[s->code];
+      if (kind == IR_NEC ||
+          irQuantMatch(heard, pairs, c->signal, c->pairs)) {
+        ix->hits++;
+        return s->code;
+      }
+      break;
+    }
+  }
+  ix->fallbacks++;
+  for (int c = 0; c < ix->numCodes; c++) {
+    if (irFuzzyMatch(heard, pairs, ix->codes[c].signal, ix->codes[c].pairs)) {
+      return c;
+    }
+  }
+  return -1;
+}
+
+#endif // IR_INDEX_H
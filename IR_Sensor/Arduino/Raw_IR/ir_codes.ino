@@ -10,80 +10,70 @@
  for more tutorials! 
  */
  
-// We need to use the 'raw' pin reading methods
-// because timing is very important here and the digitalRead()
-// procedure is slower!
+// The receiver is read in the background (see ircapture.h): an
+// interrupt on each change of the pin notes the time from Timer1, which
+// runs free at 4 microseconds a tick, so timing doesn't depend on how
+// long a loop takes. We read the pin the 'raw' way in the interrupt
+// since digitalRead() is slower!
 //uint8_t IRpin = 2;
 // Digital pin #2 is the same as Pin D2 see
 // http://arduino.cc/en/Hacking/PinMapping168 for the 'raw' pin mapping
 #define IRpin_PIN      PIND
 #define IRpin          2
+#define US_PER_TICK    (64 / (F_CPU / 1000000L))  // Timer1 at clk/64
  
-// the maximum pulse we'll listen for - 65 milliseconds is a long time
+// the maximum pulse we'll listen for - 65 milliseconds is a long time,
+// and once the line's been quiet that long the signal is over
 #define MAXPULSE 65000
  
-// what our timing resolution should be, larger is better
-// as its more 'precise' - but too large and you wont get
-// accurate timing
-#define RESOLUTION 20 
- 
 // we will store up to 100 pulse pairs (this is -a lot-)
 uint16_t pulses[100][2];  // pair is high and low pulse 
 uint8_t currentpulse = 0; // index for pulses we're storing
+
+#include "ircapture.h"
+
+IRCapture ir;
  
 void setup(void) {
   Serial.begin(9600);
+
+  ircap_begin(&ir, US_PER_TICK);
+  TCCR1A = 0;                          // Timer1 counts freely,
+  TCCR1B = _BV(CS11) | _BV(CS10);      // at clk/64
+  pinMode(IRpin, INPUT);
+  attachInterrupt(digitalPinToInterrupt(IRpin), irEdge, CHANGE);
   Serial.println("Ready to decode IR!");
 }
+
+// The pin changed: note when, and end the signal if it stays quiet
+void irEdge(void) {
+  uint16_t t = TCNT1;
+  ircap_edge(&ir, t, (IRpin_PIN >> IRpin) & 1);
+  OCR1A  = t + MAXPULSE / US_PER_TICK;
+  TIFR1  = _BV(OCF1A);                 // Clear any old match
+  TIMSK1 |= _BV(OCIE1A);
+}
+
+ISR(TIMER1_COMPA_vect) {
+  TIMSK1 &= ~_BV(OCIE1A);
+  ircap_gap(&ir);
+}
  
 void loop(void) {
-  uint16_t highpulse, lowpulse;  // temporary storage timing
-  highpulse = lowpulse = 0; // start out with no pulse length
-  
-  
-//  while (digitalRead(IRpin)) { // this is too slow!
-    while (IRpin_PIN & (1 << IRpin)) {
-     // pin is still HIGH
- 
-     // count off another few microseconds
-     highpulse++;
-     delayMicroseconds(RESOLUTION);
- 
-     // If the pulse is too long, we 'timed out' - either nothing
-     // was received or the code is finished, so print what
-     // we've grabbed so far, and then reset
-     if ((highpulse >= MAXPULSE) && (currentpulse != 0)) {
-       printpulses();
-       currentpulse=0;
-       return;
-     }
-  }
-  // we didn't time out so lets stash the reading
-  pulses[currentpulse][0] = highpulse;
-  
-  // same as above
-  while (! (IRpin_PIN & _BV(IRpin))) {
-     // pin is still LOW
-     lowpulse++;
-     delayMicroseconds(RESOLUTION);
-     if ((lowpulse >= MAXPULSE)  && (currentpulse != 0)) {
-       printpulses();
-       currentpulse=0;
-       return;
-     }
+  // print each signal once it's over - the rest of the time we're
+  // free to do other things
+  currentpulse = ircap_read(&ir, pulses, 100);
+  if (currentpulse) {
+    printpulses();
   }
-  pulses[currentpulse][1] = lowpulse;
- 
-  // we read one high-low pulse successfully, continue!
-  currentpulse++;
 }
- 
+
 void printpulses(void) {
   Serial.println("\n\r\n\rReceived: \n\rOFF \tON");
   for (uint8_t i = 0; i < currentpulse; i++) {
-    Serial.print(pulses[i][0] * RESOLUTION, DEC);
+    Serial.print(pulses[i][0], DEC);
     Serial.print(" usec, ");
-    Serial.print(pulses[i][1] * RESOLUTION, DEC);
+    Serial.print(pulses[i][1], DEC);
     Serial.println(" usec");
   }
   
@@ -93,18 +83,18 @@ void printpulses(void) {
   for (uint8_t i = 0; i < currentpulse-1; i++) {
     //Serial.print("\t"); // tab
     Serial.print("pulseIR(");
-    Serial.print(pulses[i][1] * RESOLUTION , DEC);
+    Serial.print(pulses[i][1], DEC);
     Serial.print(");");
     Serial.println("");
     //Serial.print("\t");
     Serial.print("delayMicroseconds(");
-    Serial.print(pulses[i+1][0] * RESOLUTION , DEC);
+    Serial.print(pulses[i+1][0], DEC);
     Serial.println(");");
  
   }
   //Serial.print("\t"); // tab
   Serial.print("pulseIR(");
-  Serial.print(pulses[currentpulse-1][1] * RESOLUTION, DEC);
+  Serial.print(pulses[currentpulse-1][1], DEC);
   Serial.print(");");
  
 }
@@ -0,0 +1,125 @@
+// Background IR capture
+//
+// Instead of the sketch sitting in a loop counting off delays while the
+// receiver pin is high or low, an interrupt on each edge of the pin calls
+// ircap_edge() with a timer reading, and a timer compare interrupt calls
+// ircap_gap() once the line has been quiet for the gap that ends a signal.
+// Both just queue an entry; the sketch calls ircap_read() from loop() to
+// put the queued edges together into pulses, and gets the whole signal
+// once it's over. In between it's free to do other things.
+//
+// Nothing here touches pins or timers -- the sketch supplies those -- so
+// the same code can be fed made-up edge streams on a PC to check it.
+//
+// The receiver's output is low while it sees IR, so each pulse is the
+// time the line was high (OFF) and then low (ON), in microseconds, the
+// same way round as the sketches have always printed them.
+
+#ifndef _IRCAPTURE_H_
+#define _IRCAPTURE_H_
+
+#include <stdint.h>
+
+#define IRCAP_RING 64             // Queued edges, must be a power of 2
+#define IRCAP_END  2              // Queue entry: the gap after a signal
+
+typedef struct {
+  uint16_t t;                     // Timer ticks (IRCAP_END: overflows so far)
+  uint8_t  level;                 // Line level after the edge, or IRCAP_END
+} IRCapEdge;
+
+typedef struct {
+  // Shared with the interrupts
+  volatile uint8_t  head, tail;   // head written by interrupts, tail by loop
+  volatile uint8_t  overflows;    // Edges lost to a full queue
+  volatile IRCapEdge ring[IRCAP_RING];
+  // Loop side only: the signal being put together
+  uint8_t  usPerTick;
+  uint16_t last;                  // When the line last changed
+  uint8_t  level;                 // What it changed to
+  uint8_t  count;                 // Pulses so far
+  uint8_t  inSignal, full;
+  uint8_t  seenOverflows;         // As of the last gap
+} IRCapture;
+
+static void ircap_begin(IRCapture *c, uint8_t usPerTick) {
+  c->head = c->tail = 0;
+  c->overflows = c->seenOverflows = 0;
+  c->usPerTick = usPerTick;
+  c->level = 1;                   // Idle: no IR, line high
+  c->count = 0;
+  c->inSignal = c->full = 0;
+}
+
+static void ircap_push(IRCapture *c, uint16_t t, uint8_t level) {
+  uint8_t next = (c->head + 1) & (IRCAP_RING - 1);
+  if(next == c->tail) {
+    c->overflows++;
+    return;
+  }
+  c->ring[c->head].t     = t;
+  c->ring[c->head].level = level;
+  c->head = next;                 // Publish only after the entry is written
+}
+
+// Interrupt: the line changed at timer reading 't' and is now 'level'
+static void ircap_edge(IRCapture *c, uint16_t t, uint8_t level) {
+  ircap_push(c, t, level);
+}
+
+// Interrupt: no edges for the gap time; whatever came before is a signal.
+// Carries the overflow count, so the loop can tell if this signal lost
+// edges even if the next one has already lost some too.
+static void ircap_gap(IRCapture *c) {
+  ircap_push(c, c->overflows, IRCAP_END);
+}
+
+// Time from the last edge to 't', in microseconds
+static uint16_t ircap_since(IRCapture *c, uint16_t t) {
+  uint32_t us = (uint32_t)(uint16_t)(t - c->last) * c->usPerTick;
+  return (us > 0xFFFF) ? 0xFFFF : us;
+}
+
+// Main loop: take in the queued edges, building the signal in pulses[][2]
+// (OFF, ON). Returns the number of pulses when a signal has ended -- they
+// stay put until the next call -- or 0 if there's nothing new yet. Signals
+// with more than 'max' pulses are cut short; any that lost edges to a full
+// queue are dropped.
+static uint8_t ircap_read(IRCapture *c, uint16_t pulses[][2], uint8_t max) {
+  while(c->tail != c->head) {
+    IRCapEdge e;
+    e.t     = c->ring[c->tail].t;
+    e.level = c->ring[c->tail].level;
+    c->tail = (c->tail + 1) & (IRCAP_RING - 1);
+
+    if(e.level == IRCAP_END) {
+      uint8_t n = c->count;
+      uint8_t ok = c->inSignal && n && ((uint8_t)e.t == c->seenOverflows);
+      c->seenOverflows = e.t;
+      c->count = 0;
+      c->inSignal = c->full = 0;
+      c->level = 1;
+      if(ok) return n;
+      continue;
+    }
+    if(e.level == c->level) continue;     // Missed the edge between; skip
+    if(!c->inSignal) {
+      if(e.level == 0) {                  // IR on: a signal starts
+        c->inSignal = 1;
+        pulses[0][0] = 0;                 // (no telling how long it was idle)
+      }
+    } else if(!c->full) {
+      if(e.level == 0) {                  // End of OFF, start of the next ON
+        pulses[c->count][0] = ircap_since(c, e.t);
+      } else {                            // End of ON; that's one pulse
+        pulses[c->count][1] = ircap_since(c, e.t);
+        if(++c->count >= max) c->full = 1;
+      }
+    }
+    c->last  = e.t;
+    c->level = e.level;
+  }
+  return 0;
+}
+
+#endif // _IRCAPTURE_H_
@@ -0,0 +1,210 @@
+// Host test for ircapture.h (the same file in IR_Commander and Raw_IR).
+// Runs on a PC, not the board.
+//
+// NEC remote frames, some with repeat codes after them, are turned into
+// the edges and gap timeouts the interrupts would see: each edge read
+// from a 4 us timer a little late, more so when the millis() interrupt is
+// running. ircap_read() is called from a "loop" every so often, and every
+// signal it puts together must be one that was sent, split at the gaps,
+// with each OFF and ON within a few microseconds. A loop slow enough to
+// overflow the edge queue may miss signals, but never get one wrong. The
+// old way, counting off 20 us delays while the pin holds, is measured the
+// same way for comparison.
+//
+//   g++ -O2 -o ircapture_test ircapture_test.cpp
+//   ./ircapture_test
+//
+// Exits nonzero on failure.
+
+#include <stdio.h>
+#include <math.h>
+#include <vector>
+#include <random>
+#include <algorithm>
+#include "IR_Commander/ircapture.h"
+
+#define GAP_US    65000          // Quiet time that ends a signal
+#define T0_PERIOD 1024.0         // The millis() interrupt, us
+#define T0_LENGTH 5.6
+
+static std::mt19937 rng(3);
+
+static double random01() { return std::uniform_real_distribution<double>(0, 1)(rng); }
+
+// A signal as (OFF, ON) pulses in microseconds, the first OFF unused
+typedef std::vector<std::pair<double, double> > Signal;
+
+static Signal nec(uint32_t w, int repeats) {
+  Signal s(1, std::make_pair(0.0, 9000.0));
+  double off = 4500;
+  for (int i = 0; i < 32; i++) {
+    s.push_back(std::make_pair(off, 560.0));
+    off = ((w >> i) & 1) ? 1690 : 560;
+  }
+  s.push_back(std::make_pair(off, 560.0));
+  for (int r = 0; r < repeats; r++) {
+    s.push_back(std::make_pair(r ? 96000.0 - 11810 : 40000.0, 9000.0));
+    s.push_back(std::make_pair(2250.0, 560.0));
+  }
+  return s;
+}
+
+// When the edge interrupt reads the timer: after any millis() interrupt
+// in progress and the current instruction, plus the time to get there
+static double interruptAt(double t) {
+  double phase = fmod(t, T0_PERIOD);
+  double wait  = (phase < T0_LENGTH) ? T0_LENGTH - phase : 0;
+  return t + wait + random01() * 0.25 + 4.4;
+}
+
+typedef struct {
+  int    sent, got, wrong, lost;  // Signals, and edges lost to a full queue
+  double sum, sum2, worst;        // Pulse timing error, us
+  int    n;
+} Result;
+
+static void error(Result *r, double e) {
+  r->sum  += e;
+  r->sum2 += e * e;
+  r->worst = std::max(r->worst, fabs(e));
+  r->n++;
+}
+
+static double mean(const Result &r) { return r.sum / r.n; }
+static double sd(const Result &r) { return sqrt(r.sum2 / r.n - mean(r) * mean(r)); }
+
+// 'count' remote presses, ircap_read() every 'pollUs'
+static Result run(int count, double pollUs, uint8_t maxPulses, bool late) {
+  struct Event { double t; int kind; };   // Line level after an edge, or IRCAP_END
+  static uint16_t pulses[200][2];
+  Result   r = {};
+  IRCapture cap;
+  std::vector<Signal> frames;             // What was sent, split at the gaps
+  std::vector<Event>  edges, events;
+  double   t = 50000;
+
+  ircap_begin(&cap, 4);
+  for (int k = 0; k < count; k++) {
+    Signal s = nec(rng(), k % 3);
+    for (size_t i = 0; i < s.size(); i++) {
+      if (i && (s[i].first >= GAP_US)) frames.push_back(Signal());
+      if (!i) frames.push_back(Signal());
+      frames.back().push_back(s[i]);
+      if (i) t += s[i].first;
+      Event on = { t, 0 };
+      edges.push_back(on);
+      t += s[i].second;
+      Event off = { t, 1 };
+      edges.push_back(off);
+    }
+    t += 100000 + random01() * 200000;
+  }
+  // The gap compare fires GAP_US after the last edge it saw
+  for (size_t i = 0; i < edges.size(); i++) {
+    Event e = { late ? interruptAt(edges[i].t) : edges[i].t, edges[i].kind };
+    events.push_back(e);
+    if ((i + 1 == edges.size()) || (edges[i + 1].t > e.t + GAP_US)) {
+      Event gap = { e.t + GAP_US, IRCAP_END };
+      events.push_back(gap);
+    }
+  }
+
+  size_t next = 0, frame = 0;
+  for (double now = 0; (next < events.size()) || (now < t); now += pollUs) {
+    while ((next < events.size()) && (events[next].t <= now)) {
+      Event e = events[next++];
+      if (e.kind == IRCAP_END) ircap_gap(&cap);
+      else ircap_edge(&cap, (uint16_t)(uint32_t)(e.t / 4), e.kind);
+    }
+    uint8_t n = ircap_read(&cap, pulses, maxPulses);
+    if (!n) continue;
+    r.got++;
+    // The next frame sent that it matches; those skipped were dropped
+    bool found = false;
+    for (; !found && (frame < frames.size()); frame++) {
+      const Signal &f = frames[frame];
+      if (std::min<size_t>(f.size(), maxPulses) != n) continue;
+      double worst = 0;
+      for (size_t i = 0; i < n; i++) {
+        if (i) worst = std::max(worst, fabs(pulses[i][0] - f[i].first));
+        worst = std::max(worst, fabs(pulses[i][1] - f[i].second));
+      }
+      if (worst > 20) continue;
+      for (size_t i = 0; i < n; i++) {
+        if (i) error(&r, pulses[i][0] - f[i].first);
+        error(&r, pulses[i][1] - f[i].second);
+      }
+      found = true;
+    }
+    r.wrong += !found;
+  }
+  r.sent = frames.size();
+  r.lost = cap.overflows;
+  return r;
+}
+
+// The old way: count passes of a delayMicroseconds(20) loop (a little over
+// 20 us each, longer when the millis() interrupt lands) while the pin holds
+static Result busyPoll(int count) {
+  const double pass = 20 + 10 / 16.0;
+  Result r = {};
+  for (int k = 0; k < count; k++) {
+    Signal s = nec(rng(), 0);
+    double t = random01() * 1e6;
+    for (size_t i = 0; i < s.size(); i++) {
+      for (int on = i ? 0 : 1; on < 2; on++) {
+        double d = on ? s[i].second : s[i].first, at = t;
+        int passes = 0;
+        while (at < t + d) {
+          at += pass + ((fmod(at, T0_PERIOD) + pass > T0_PERIOD) ? T0_LENGTH : 0);
+          passes++;
+        }
+        t += d;
+        error(&r, passes * 20.0 - d);
+      }
+    }
+  }
+  return r;
+}
+
+static int failures = 0;
+
+static void check(bool ok, const char *what) {
+  if (!ok) { printf("FAIL: %s\n", what); failures++; }
+}
+
+int main(void) {
+  Result old = busyPoll(300);
+  printf("busy-poll (old):          error mean %+6.1f us, sd %5.1f us, max %5.1f us\n",
+         mean(old), sd(old), old.worst);
+
+  Result r = run(300, 500, 100, true);
+  printf("interrupts, 0.5 ms loop:  error mean %+6.1f us, sd %5.1f us, max %5.1f us; "
+         "%d/%d signals, %d wrong, %d edges lost\n",
+         mean(r), sd(r), r.worst, r.got, r.sent, r.wrong, r.lost);
+  check(r.got == r.sent && r.wrong == 0 && r.lost == 0, "every signal, 0.5 ms loop");
+  check(r.worst <= 8, "pulses timed to within 8 us");
+  check(r.worst < old.worst, "better than busy-polling");
+
+  r = run(300, 20000, 100, true);
+  printf("interrupts, 20 ms loop:   %d/%d signals, %d wrong, %d edges lost\n",
+         r.got, r.sent, r.wrong, r.lost);
+  check(r.got == r.sent && r.wrong == 0 && r.lost == 0, "every signal, 20 ms loop");
+
+  r = run(100, 120000, 100, true);
+  printf("interrupts, 120 ms loop:  %d/%d signals, %d wrong, %d edges lost\n",
+         r.got, r.sent, r.wrong, r.lost);
+  check(r.wrong == 0, "signals dropped, not garbled, with a full queue");
+  check(r.lost > 0 && r.got < r.sent, "a full queue noticed");
+
+  r = run(300, 1000, 20, false);
+  printf("cut to 20 pulses:         %d/%d signals, %d wrong\n", r.got, r.sent, r.wrong);
+  check(r.got == r.sent && r.wrong == 0, "long signals cut short");
+
+  r = run(300, 1000, 100, false);
+  printf("no interrupt latency:     error mean %+6.1f us, max %5.1f us (4 us ticks)\n",
+         mean(r), r.worst);
+  check(r.worst <= 4, "timer resolution only");
+
+  return failures ? 1 : 0;
+}
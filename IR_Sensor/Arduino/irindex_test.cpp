@@ -0,0 +1,187 @@
+// Host test for IR_Commander/irindex.h. Runs on a PC, not the board.
+//
+// The three Apple codes from ircommander.h, plus 200 NEC, 50 Sony and 50
+// RC5 codes, are indexed. Each is then "received" 20 times the way the
+// sketch records it: marks stretched and spaces shrunk by the receiver,
+// random jitter, 20 us ticks. 1000 signals from remotes that aren't
+// stored are mixed in. Every stored code must come back as itself and
+// never as another, no more strangers may match than with the old
+// pulse-by-pulse compare, and nearly all stored codes should be found by
+// the index without the fallback.
+//
+//   g++ -O2 -o irindex_test irindex_test.cpp
+//   ./irindex_test [jitter_us [bias_us]]
+//
+// Exits nonzero on failure.
+
+#include <stdio.h>
+#include <stdint.h>
+#include <vector>
+#include <set>
+#include <random>
+#include <chrono>
+#include <algorithm>
+#define IR_INDEX_SIZE 1024
+#include "IR_Commander/irindex.h"
+#include "IR_Commander/ircommander.h"
+
+typedef std::vector<int> Wave;   // Mark, space, ... in microseconds, ending with a mark
+
+static std::mt19937 rng(1);
+
+static Wave nec(uint32_t w) {
+  Wave v = { 9000, 4500 };
+  for (int i = 0; i < 32; i++) {
+    v.push_back(560);
+    v.push_back(((w >> i) & 1) ? 1690 : 560);
+  }
+  v.push_back(560);
+  v.push_back(40000);            // Then a repeat frame
+  v.push_back(9000);
+  v.push_back(2250);
+  v.push_back(560);
+  return v;
+}
+
+static Wave sony(uint32_t w) {
+  Wave v = { 2400 };
+  for (int i = 0; i < 12; i++) {
+    v.push_back(600);
+    v.push_back(((w >> i) & 1) ? 1200 : 600);
+  }
+  return v;
+}
+
+// 14 Manchester bits, 889 us halves; a 1 is a space then a mark
+static Wave rc5(uint32_t w) {
+  std::vector<int> half;
+  for (int i = 13; i >= 0; i--) {
+    int b = (i >= 12) ? 1 : (w >> i) & 1;
+    half.push_back(!b);
+    half.push_back(b);
+  }
+  Wave v;
+  int level = -1, len = 0;
+  for (size_t i = 0; i < half.size(); i++) {
+    if (half[i] == level) {
+      len += 889;
+      continue;
+    }
+    if ((level == 1) || ((level == 0) && !v.empty())) v.push_back(len);
+    level = half[i];
+    len   = 889;
+  }
+  v.push_back(len);
+  if (v.size() % 2 == 0) v.pop_back();
+  return v;
+}
+
+// What the sketch would record: ON, OFF pairs in 10s of us, the last OFF 0
+static std::vector<int> record(const Wave &w, double bias, double jitter) {
+  std::normal_distribution<double> noise(0, jitter);
+  std::vector<int> s;
+  for (size_t i = 0; i < w.size(); i++) {
+    double d = w[i] + ((i & 1) ? -bias : bias) + noise(rng);
+    if (d < 40) d = 40;
+    s.push_back((int)(d / 20) * 2);
+  }
+  s.push_back(0);
+  return s;
+}
+
+// The same signal again, from one recorded in 10s of us
+static Wave wave(const int *signal, int pairs) {
+  Wave w;
+  for (int i = 0; i < pairs * 2 - 1; i++) w.push_back(signal[i] * 10);
+  return w;
+}
+
+static int failures = 0;
+
+static void check(bool ok, const char *what) {
+  if (!ok) { printf("FAIL: %s\n", what); failures++; }
+}
+
+int main(int argc, char **argv) {
+  double jitter = (argc > 1) ? atof(argv[1]) : 40;
+  double bias   = (argc > 2) ? atof(argv[2]) : 60;
+  int    apple  = sizeof(IRcodes) / sizeof(IRcodes[0]);
+
+  // Every code different, stored or not
+  std::set<uint32_t> used;
+  struct Fresh {
+    std::set<uint32_t> *used;
+    uint32_t operator()(uint32_t mask, uint32_t tag) {
+      uint32_t v;
+      do v = rng() & mask; while (!used->insert(v | tag).second);
+      return v;
+    }
+  } fresh = { &used };
+
+  std::vector<Wave> waves;
+  std::vector<std::vector<int> > signals;
+  std::vector<IRcode> codes(IRcodes, IRcodes + apple);
+  for (int i = 0; i < apple; i++) waves.push_back(wave(IRcodes[i].signal, IRcodes[i].pairs));
+  for (int i = 0; i < 200; i++) waves.push_back(nec(fresh(~0u, 0)));
+  for (int i = 0; i < 50; i++) waves.push_back(sony(fresh(0xFFF, 1 << 20)));
+  for (int i = 0; i < 50; i++) waves.push_back(rc5(fresh(0xFFF, 2 << 20)));
+  signals.reserve(waves.size());
+  for (size_t i = apple; i < waves.size(); i++) {
+    signals.push_back(record(waves[i], bias, jitter));
+    IRcode c = { "", &signals.back()[0], (int)signals.back().size() / 2 };
+    codes.push_back(c);
+  }
+
+  static IRindex ix;
+  int added = irIndexBegin(&ix, &codes[0], codes.size());
+  check(added == (int)codes.size(), "every code indexed");
+
+  // The Apple codes as recorded already, so no receiver bias on those
+  std::vector<std::pair<int, std::vector<int> > > heard;
+  for (int r = 0; r < 20; r++) {
+    for (size_t i = 0; i < codes.size(); i++) {
+      heard.push_back(std::make_pair((int)i, record(waves[i], ((int)i < apple) ? 0 : bias, jitter)));
+    }
+  }
+  for (int r = 0; r < 1000; r++) {
+    Wave w = (r % 2) ? nec(fresh(~0u, 0)) : sony(fresh(0xFFF, 1 << 20));
+    heard.push_back(std::make_pair(-1, record(w, bias, jitter)));
+  }
+  std::shuffle(heard.begin(), heard.end(), rng);
+
+  int right[2] = { 0 }, wrong[2] = { 0 }, missed[2] = { 0 }, strangers[2] = { 0 };
+  double ns[2];
+  for (int indexed = 0; indexed < 2; indexed++) {
+    std::chrono::steady_clock::time_point t0 = std::chrono::steady_clock::now();
+    for (size_t h = 0; h < heard.size(); h++) {
+      const int *s = &heard[h].second[0];
+      int pairs = heard[h].second.size() / 2, got = -1;
+      if (indexed) {
+        got = irLookup(&ix, s, pairs);
+      } else {
+        for (size_t c = 0; (c < codes.size()) && (got < 0); c++) {
+          if (irFuzzyMatch(s, pairs, codes[c].signal, codes[c].pairs)) got = c;
+        }
+      }
+      if (heard[h].first < 0) strangers[indexed] += (got >= 0);
+      else if (got == heard[h].first) right[indexed]++;
+      else if (got < 0) missed[indexed]++;
+      else wrong[indexed]++;
+    }
+    ns[indexed] = std::chrono::duration<double, std::nano>(
+                    std::chrono::steady_clock::now() - t0).count() / heard.size();
+    printf("%s %5.0f ns a lookup; stored codes %d right, %d wrong, %d missed; "
+           "%d/1000 strangers matched\n", indexed ? "indexed: " : "one by one:",
+           ns[indexed], right[indexed], wrong[indexed], missed[indexed], strangers[indexed]);
+  }
+  // Strangers always fall back
+  int stored = codes.size() * 20;
+  printf("%d codes, %.0f us jitter, %.0f us bias: %.1f%% of stored codes found "
+         "by the index\n", (int)codes.size(), jitter, bias, 100.0 * ix.hits / stored);
+
+  check(wrong[1] == 0, "no code taken for another");
+  check(missed[1] * 100 <= stored, "stored codes found");
+  check(strangers[1] <= strangers[0], "no more strangers matched than before");
+  check(ix.hits * 100 >= stored * 95, "stored codes found by the index");
+  return failures ? 1 : 0;
+}
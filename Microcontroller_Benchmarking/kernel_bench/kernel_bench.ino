@@ -0,0 +1,130 @@
+/* Kernel benchmark for Arduinos and compatibles.
+ *
+ * Dhrystone (see ../dhrystone21) is a synthetic integer benchmark that
+ * says little about how a board handles the code in this repository.
+ * This sketch instead times the inner loops of several real projects --
+ * eye rendering, PDM audio, ray casting, FFT, NeoPixel palettes, NMEA
+ * parsing; see kernels.h -- and reports each as one line of JSON:
+ *
+ *   {"board":"samd51","mhz":120,"kernel":"fft","size":1024,
+ *    "iters":2048,"us":231402,"ns_per_iter":112989,"check":"5e0c11a3"}
+ *
+ * 'check' is a running checksum of each kernel's output and should match
+ * across boards with the same 'size' (floating-point kernels may differ
+ * in the last bits on boards without an FPU). Results are repeated every
+ * few seconds so a serial logger can be attached at any time.
+ *
+ * The same files also build and run on a Linux (or macOS) host, for
+ * comparing against device numbers:
+ *
+ *   g++ -O2 -x c++ kernel_bench.ino -x none kernels.cpp -o kernel_bench
+ *   ./kernel_bench
+ */
+
+#include "kernels.h"
+
+#define MIN_RUN_US  200000UL // Each kernel runs at least this long
+#define CHECK_ITERS 64       // Iterations folded into 'check'
+
+#ifdef ARDUINO
+
+#if defined(__AVR__)
+ #define BOARD "avr"
+#elif defined(__SAMD51__)
+ #define BOARD "samd51"
+#elif defined(__SAMD21G18A__) || defined(__SAMD21E18A__)
+ #define BOARD "samd21"
+#elif defined(ESP32)
+ #define BOARD "esp32"
+#elif defined(ESP8266)
+ #define BOARD "esp8266"
+#elif defined(NRF52)
+ #define BOARD "nrf52"
+#else
+ #define BOARD "unknown"
+#endif
+
+#define elapsedMicros() micros()
+
+#else // Host build -------------------------------------------------------
+
+#include <stdio.h>
+#include <chrono>
+
+#define BOARD "host"
+#define F_CPU 0 // Not meaningful on host
+
+static uint32_t elapsedMicros(void) {
+  static const auto start = std::chrono::steady_clock::now();
+  return std::chrono::duration_cast<std::chrono::microseconds>(
+    std::chrono::steady_clock::now() - start).count();
+}
+
+#endif // ARDUINO
+
+// Checksum a fixed number of iterations from a fresh setup(), then run
+// kernel k for at least MIN_RUN_US, doubling the iteration count until
+// it does, so fast and slow kernels both get a stable reading.
+static void bench(const Kernel &k) {
+  uint32_t iters = 1, us, check = 0, sink = 0, i;
+
+  k.setup();
+  for(i=0; i<CHECK_ITERS; i++) check = check * 33 + k.run(i);
+
+  for(;;) {
+    uint32_t t = elapsedMicros();
+    for(i=0; i<iters; i++) sink += k.run(i); // 'sink' keeps calls live
+    us = elapsedMicros() - t;
+    if((us >= MIN_RUN_US) || (iters >= 0x40000000UL)) break;
+    iters *= 2;
+  }
+
+  uint32_t nsPerIter = (uint32_t)((uint64_t)us * 1000 / iters);
+  (void)sink;
+#ifdef ARDUINO
+  Serial.print(F("{\"board\":\"" BOARD "\",\"mhz\":"));
+  Serial.print(F_CPU / 1000000UL);
+  Serial.print(F(",\"kernel\":\""));
+  Serial.print(k.name);
+  Serial.print(F("\",\"size\":"));
+  Serial.print(k.size);
+  Serial.print(F(",\"iters\":"));
+  Serial.print(iters);
+  Serial.print(F(",\"us\":"));
+  Serial.print(us);
+  Serial.print(F(",\"ns_per_iter\":"));
+  Serial.print(nsPerIter);
+  Serial.print(F(",\"check\":\""));
+  Serial.print(check, HEX);
+  Serial.println(F("\"}"));
+#else
+  printf("{\"board\":\"" BOARD "\",\"mhz\":%d,\"kernel\":\"%s\",\"size\":%u,"
+    "\"iters\":%lu,\"us\":%lu,\"ns_per_iter\":%lu,\"check\":\"%lx\"}\n",
+    F_CPU, k.name, k.size, (unsigned long)iters, (unsigned long)us,
+    (unsigned long)nsPerIter, (unsigned long)check);
+  fflush(stdout);
+#endif
+}
+
+#ifdef ARDUINO
+
+void setup() {
+  Serial.begin(115200);
+  while(!Serial) {
+    ; // Wait for serial port to connect. Needed for native USB port only
+  }
+}
+
+void loop() {
+  for(uint8_t i=0; i<numKernels; i++) bench(kernels[i]);
+  delay(5000);
+}
+
+#else
+
+int main(void) {
+  for(uint8_t i=0; i<numKernels; i++) bench(kernels[i]);
+  return 0;
+}
+
+#endif
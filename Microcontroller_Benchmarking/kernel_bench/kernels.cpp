@@ -0,0 +1,534 @@
+/* Workload kernels for kernel_bench -- see kernels.h for the list and
+ * where each one comes from. Loops are kept as close as practical to the
+ * originals; only the I/O (DMA, SPI, SD, FastLED.show()) is stripped out.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "kernels.h"
+#include "spectrum.h"
+
+#if defined(__AVR__)
+ #include <avr/pgmspace.h>
+#else
+ #define PROGMEM
+ #define strcpy_P(d, s) strcpy(d, s)
+#endif
+
+// Cheap deterministic pseudorandom source for synthetic data (xorshift32).
+// Each setup function reseeds so results don't depend on kernel order.
+static uint32_t rngState;
+static uint32_t rng(void) {
+  rngState ^= rngState << 13;
+  rngState ^= rngState >> 17;
+  rngState ^= rngState << 5;
+  return rngState;
+}
+
+// EYE_COLUMN ---------------------------------------------------------------
+// Per-column render loop from M4_Eyes.ino, with tables from tablegen.cpp.
+// Eye is fully open (no eyelid spans) and centered over the polar map.
+
+#define EYE_MAP_RADIUS (EYE_SIZE / 2 + EYE_SIZE / 8)
+#define TEX_W          ((EYE_SIZE >= 128) ? 64 : 8)
+#define TEX_H          (TEX_W / 2)
+
+static uint8_t  displace[(EYE_SIZE/2) * (EYE_SIZE/2)];
+static uint8_t  polarAngle[EYE_MAP_RADIUS * EYE_MAP_RADIUS];
+static int8_t   polarDist[EYE_MAP_RADIUS * EYE_MAP_RADIUS];
+static uint16_t texture[TEX_W * TEX_H]; // Shared by sclera and iris
+static uint16_t renderBuf[EYE_SIZE];
+
+static void eyeSetup(void) {
+  rngState = 0x12345678;
+  const int   mapRadius  = EYE_MAP_RADIUS;
+  const float eyeRadius  = EYE_SIZE / 2,
+              eyeRadius2 = eyeRadius * eyeRadius,
+              mapRadius2 = (float)mapRadius * mapRadius,
+              iRad       = mapRadius / 2.0,
+              irisRadius2 = iRad * iRad;
+  int         x, y;
+  float       dx, dy, d2, d, h, a, pa;
+
+  uint8_t *ptr = displace;
+  for(y=0; y<(EYE_SIZE/2); y++) {
+    dy  = (float)y + 0.5;
+    dy *= dy;
+    for(x=0; x<(EYE_SIZE/2); x++) {
+      dx = (float)x + 0.5;
+      d2 = dx * dx + dy;
+      if(d2 <= eyeRadius2) {
+        d      = sqrt(d2);
+        h      = sqrt(eyeRadius2 - d2);
+        a      = atan2(d, h);
+        pa     = a / M_PI_2 * mapRadius;
+        dx    /= d;
+        *ptr++ = (uint8_t)(dx * pa) - x;
+      } else {
+        *ptr++ = 255;
+      }
+    }
+  }
+
+  uint8_t *anglePtr = polarAngle;
+  int8_t  *distPtr  = polarDist;
+  for(y=0; y<mapRadius; y++) {
+    dy = (float)y + 0.5;
+    for(x=0; x<mapRadius; x++) {
+      dx = (float)x + 0.5;
+      d2 = dx * dx + dy * dy;
+      if(d2 > mapRadius2) {
+        *anglePtr++ = 0;
+        *distPtr++  = -128;
+      } else {
+        *anglePtr++ = (uint8_t)((M_PI_2 - atan2(dy, dx)) * 512.0 / M_PI);
+        d = sqrt(d2);
+        if(d2 > irisRadius2) {
+          *distPtr++ = (int8_t)((mapRadius - d) / (mapRadius - iRad) * 127.0);
+        } else {
+          *distPtr++ = (int8_t)((iRad - d) / iRad * -127.0) - 1;
+        }
+      }
+    }
+  }
+
+  for(x=0; x<TEX_W * TEX_H; x++) texture[x] = rng();
+}
+
+static uint32_t eyeColumn(uint32_t iter) {
+  const int mapRadius        = EYE_MAP_RADIUS,
+            mapDiameter      = mapRadius * 2,
+            xPositionOverMap = mapRadius - EYE_SIZE / 2,
+            yPositionOverMap = mapRadius - EYE_SIZE / 2,
+            iPupilFactor     = TEX_H * 256 * 2; // pupilFactor = 0.5
+  const uint16_t eyelidColor = 0, backColor = 0x1234, pupilColor = 0;
+  int        x   = iter % EYE_SIZE, xx = xPositionOverMap + x, y;
+  uint16_t  *ptr = renderBuf;
+  uint8_t   *displaceX, *displaceY;
+  int8_t     xmul;
+  int        doff;
+
+  if(x < (EYE_SIZE/2)) {
+    displaceX = &displace[ (EYE_SIZE/2 - 1) - x       ];
+    displaceY = &displace[((EYE_SIZE/2 - 1) - x) * (EYE_SIZE/2)];
+    xmul      = -1;
+  } else {
+    displaceX = &displace[ x - (EYE_SIZE/2)       ];
+    displaceY = &displace[(x - (EYE_SIZE/2)) * (EYE_SIZE/2)];
+    xmul      =  1;
+  }
+
+  for(y=0; y<EYE_SIZE; y++) {
+    int yy = yPositionOverMap + y;
+    int dx, dy;
+
+    if(y < (EYE_SIZE/2)) {
+      doff = (EYE_SIZE/2 - 1) - y;
+      dy   = -displaceY[doff];
+    } else {
+      doff = y - (EYE_SIZE/2);
+      dy   =  displaceY[doff];
+    }
+    dx = displaceX[doff * (EYE_SIZE/2)];
+    if(dx < 255) {
+      dx *= xmul;
+      int mx = xx + dx;
+      int my = yy + dy;
+      if((mx >= 0) && (mx < mapDiameter) && (my >= 0) && (my < mapDiameter)) {
+        int angle, dist, moff;
+        if(my >= mapRadius) {
+          if(mx >= mapRadius) { // Quadrant 1
+            mx   -= mapRadius;
+            my   -= mapRadius;
+            moff  = my * mapRadius + mx;
+            angle = polarAngle[moff];
+            dist  = polarDist[moff];
+          } else {              // Quadrant 2
+            mx    = mapRadius - 1 - mx;
+            my   -= mapRadius;
+            angle = polarAngle[mx * mapRadius + my] + 768;
+            dist  = polarDist[ my * mapRadius + mx];
+          }
+        } else {
+          if(mx < mapRadius) {  // Quadrant 3
+            mx    = mapRadius - 1 - mx;
+            my    = mapRadius - 1 - my;
+            moff  = my * mapRadius + mx;
+            angle = polarAngle[moff] + 512;
+            dist  = polarDist[ moff];
+          } else {              // Quadrant 4
+            mx   -= mapRadius;
+            my    = mapRadius - 1 - my;
+            angle = polarAngle[mx * mapRadius + my] + 256;
+            dist  = polarDist[ my * mapRadius + mx];
+          }
+        }
+        if(dist >= 0) { // Sclera
+          angle = (angle + (int)(iter >> 4)) & 1023;
+          int tx = (long)angle * TEX_W / 1024;
+          int ty = dist  * TEX_H / 128;
+          *ptr++ = texture[ty * TEX_W + tx];
+        } else if(dist > -128) { // Iris or pupil
+          int ty = (long)dist * iPupilFactor / -32768;
+          if(ty >= TEX_H) {
+            *ptr++ = pupilColor;
+          } else {
+            angle = angle & 1023;
+            int tx = (long)angle * TEX_W / 1024;
+            *ptr++ = texture[ty * TEX_W + tx];
+          }
+        } else {
+          *ptr++ = backColor;
+        }
+      } else {
+        *ptr++ = backColor;
+      }
+    } else {
+      *ptr++ = eyelidColor;
+    }
+  }
+
+  uint32_t sum = 0;
+  for(y=0; y<EYE_SIZE; y++) sum = sum * 31 + renderBuf[y];
+  return sum;
+}
+
+// PDM_SINC -----------------------------------------------------------------
+// From pdmvoice.cpp PDM_SERCOM_HANDLER(): two 32-bit PDM words in, one
+// 16-bit-ish sample out. The original unrolls the bit tests by hand so
+// each compiles to a constant add; the loop form here is what the
+// compiler sees with -O2/-O3 unrolling, and is what a port would write.
+
+static const uint16_t sincfilter[64] = { 0, 2, 9, 21, 39, 63, 94, 132, 179, 236, 302, 379, 467, 565, 674, 792, 920, 1055, 1196, 1341, 1487, 1633, 1776, 1913, 2042, 2159, 2263, 2352, 2422, 2474, 2506, 2516, 2506, 2474, 2422, 2352, 2263, 2159, 2042, 1913, 1776, 1633, 1487, 1341, 1196, 1055, 920, 792, 674, 565, 467, 379, 302, 236, 179, 132, 94, 63, 39, 21, 9, 2, 0, 0 };
+
+static uint32_t pdmWords[PDM_WORDS];
+
+static void pdmSetup(void) {
+  rngState = 0x12345678;
+  for(uint8_t i=0; i<PDM_WORDS; i++) pdmWords[i] = rng();
+}
+
+static inline uint32_t sincWord(uint32_t sample, const uint16_t *filter) {
+  uint32_t sum = 0;
+  for(uint8_t bit=0; bit<32; bit++) {
+    if(sample & ((uint32_t)1 << bit)) sum += filter[bit];
+  }
+  return sum;
+}
+
+static uint32_t pdmDecimate(uint32_t iter) {
+  uint32_t check = 0;
+  (void)iter;
+  for(uint8_t i=0; i<PDM_WORDS; i+=2) {
+    uint32_t sum = sincWord(pdmWords[i], &sincfilter[0]) +
+                   sincWord(pdmWords[i + 1], &sincfilter[32]);
+    check += sum;
+  }
+  return check;
+}
+
+// RAYCAST ------------------------------------------------------------------
+// DDA ray cast for one screen column, from MinotaurMaze.ino loop().
+// Heading advances a little each 128-column frame so rays vary.
+
+#define FOV (90.0 * (M_PI / 180.0))
+
+static const uint32_t worldMap[] = {
+ 0b11111111111111111111111111111111,
+ 0b10000000000000100000000001000001,
+ 0b10000000000000101111011111011101,
+ 0b10000000000000001000001000000101,
+ 0b10000000000000111011101010111101,
+ 0b10000010100000100010000010000101,
+ 0b10000010100000111111111010101101,
+ 0b10000011100000100000000000100001,
+ 0b10000000000000111011101110111101,
+ 0b10000000000000100010000010001001,
+ 0b10000000000000111111111111101111,
+ 0b10000000000000000000000000000001,
+ 0b11111011111011100111111011111111,
+ 0b10000000001010000001000000000001,
+ 0b10100000101010000001001001001001,
+ 0b10101010101000000000000000000001,
+ 0b10101010101000000000000000000001,
+ 0b10100000101010000001001001001001,
+ 0b10000000001010000001000000000001,
+ 0b11111011111011100111111011111111,
+ 0b10000000000000000000000000000001,
+ 0b10000010100000000111000010101001,
+ 0b10001000001000000111000001010101,
+ 0b10000000000000000111000000000001,
+ 0b10010000000100000000000011111101,
+ 0b10000001000000000000000010000101,
+ 0b10010000000100000011111010100101,
+ 0b10000000000000000010001010000001,
+ 0b10001000001000000010101010000101,
+ 0b10000010100000000010101011111101,
+ 0b10000000000000000000100000000001,
+ 0b11111111111111111111111111111111,
+};
+#define MAPHEIGHT (sizeof worldMap / sizeof worldMap[0])
+#define isBitSet(X,Y) (worldMap[MAPHEIGHT-1-(Y)] & (0x80000000>>(X)))
+
+static float posX = 16.0, posY = MAPHEIGHT / 2.0,
+             planeX, planeY, planeDX, planeDY; // Image plane left edge & span
+
+static void raycastSetup(void) { }
+
+static uint32_t raycastColumn(uint32_t iter) {
+  uint8_t col = iter & 127;
+  if(!col) { // New frame: recompute image plane
+    float heading = (float)(iter >> 7) * 0.05;
+    planeX  = cos(heading + FOV / 2.0);
+    planeY  = sin(heading + FOV / 2.0);
+    planeDX = cos(heading - FOV / 2.0) - planeX;
+    planeDY = sin(heading - FOV / 2.0) - planeY;
+  }
+
+  int8_t   stepX, stepY;
+  uint8_t  mapX, mapY, side;
+  uint16_t wallPixels;
+  float    frac, rayDirX, rayDirY, sideDistX, sideDistY,
+           deltaDistX, deltaDistY, perpWallDist;
+
+  frac       = ((float)col + 0.5) / 128.0;
+  rayDirX    = planeX + planeDX * frac;
+  rayDirY    = planeY + planeDY * frac;
+  mapX       = (uint8_t)posX;
+  mapY       = (uint8_t)posY;
+  deltaDistX = (rayDirX != 0.0) ? fabs(1 / rayDirX) : 0.0;
+  deltaDistY = (rayDirY != 0.0) ? fabs(1 / rayDirY) : 0.0;
+
+  if(rayDirX < 0) {
+    stepX     = -1;
+    sideDistX = (posX - mapX) * deltaDistX;
+  } else {
+    stepX     = 1;
+    sideDistX = (mapX + 1.0 - posX) * deltaDistX;
+  } if (rayDirY < 0) {
+    stepY     = -1;
+    sideDistY = (posY - mapY) * deltaDistY;
+  } else {
+    stepY     = 1;
+    sideDistY = (mapY + 1.0 - posY) * deltaDistY;
+  }
+
+  do {
+    if(sideDistX < sideDistY) {
+      sideDistX += deltaDistX;
+      mapX      += stepX;
+      side       = 0;
+    } else {
+      sideDistY += deltaDistY;
+      mapY      += stepY;
+      side       = 1;
+    }
+  } while(!isBitSet(mapX, mapY));
+
+  perpWallDist = side ? ((mapY - posY + (1 - stepY) / 2) / rayDirY) :
+                        ((mapX - posX + (1 - stepX) / 2) / rayDirX);
+
+  wallPixels = (int)(128.0 / perpWallDist);
+  if(wallPixels >= 128) wallPixels = 128;
+
+  return ((uint32_t)mapX << 24) | ((uint32_t)mapY << 16) |
+         (side << 8) | wallPixels;
+}
+
+// FFT ----------------------------------------------------------------------
+// One Piccolo_Scalable frame: Hann window, real FFT, fold to columns.
+
+static Spectrum<FFT_SIZE, FFT_COLS> spectrum;
+static int16_t                      audio[FFT_SIZE];
+
+static void fftSetup(void) {
+  rngState = 0x12345678;
+  spectrum.begin();
+  for(uint16_t i=0; i<FFT_SIZE; i++) {
+    // Two tones plus noise, scaled like the sketch's 10-bit ADC input
+    audio[i] = (int16_t)(200.0 * sin(2.0 * M_PI * 5.3 * i / FFT_SIZE) +
+                         100.0 * sin(2.0 * M_PI * 40.7 * i / FFT_SIZE)) +
+               (int16_t)(rng() & 63) - 32;
+    audio[i] <<= 5;
+  }
+}
+
+static uint32_t fftFrame(uint32_t iter) {
+  (void)iter;
+  memcpy(spectrum.samples, audio, sizeof audio);
+  spectrum.process();
+  uint32_t sum = 0;
+  for(uint8_t c=0; c<FFT_COLS; c++) sum = sum * 31 + spectrum.columns[c];
+  return sum;
+}
+
+// PALETTE ------------------------------------------------------------------
+// colorwaves() from simple_strand_palettes.ino, with the FastLED helpers it
+// leans on (sin16, scale8, beatsin88, ColorFromPalette, nblend) written
+// out portably. Each iteration is one frame 20 ms after the previous.
+
+typedef struct { uint8_t r, g, b; } RGB;
+
+static RGB      leds[NUM_LEDS];
+static RGB      palette[16];
+static uint16_t sPseudotime, sHue16;
+
+static inline uint8_t scale8(uint8_t i, uint8_t scale) {
+  return ((uint16_t)i * (1 + (uint16_t)scale)) >> 8;
+}
+
+static int16_t sin16(uint16_t theta) {
+  static const uint16_t base[]  = { 0, 6393, 12539, 18204, 23170, 27245, 30273, 32137 };
+  static const uint8_t  slope[] = { 49, 48, 44, 38, 31, 23, 14, 4 };
+  uint16_t offset = (theta & 0x3FFF) >> 3; // 0..2047
+  if(theta & 0x4000) offset = 2047 - offset;
+  uint8_t  section    = offset / 256;
+  uint8_t  secoffset8 = (uint8_t)offset / 2;
+  int16_t  y          = (uint16_t)slope[section] * secoffset8 + base[section];
+  return (theta & 0x8000) ? -y : y;
+}
+
+static uint16_t beatsin88(uint16_t bpm88, uint16_t lo, uint16_t hi, uint32_t ms) {
+  uint16_t beat = (ms * bpm88 * 280) >> 16;
+  uint16_t s    = sin16(beat) + 32768;
+  return lo + (uint16_t)(((uint32_t)s * (hi - lo)) >> 16);
+}
+
+static RGB colorFromPalette(uint8_t index, uint8_t brightness) {
+  uint8_t hi4 = index >> 4, lo4 = index & 0x0F;
+  RGB     c   = palette[hi4];
+  if(lo4) { // Linear blend toward next entry
+    const RGB &n  = palette[(hi4 + 1) & 15];
+    uint8_t    f2 = lo4 << 4, f1 = 255 - f2;
+    c.r = scale8(c.r, f1) + scale8(n.r, f2);
+    c.g = scale8(c.g, f1) + scale8(n.g, f2);
+    c.b = scale8(c.b, f1) + scale8(n.b, f2);
+  }
+  c.r = scale8(c.r, brightness);
+  c.g = scale8(c.g, brightness);
+  c.b = scale8(c.b, brightness);
+  return c;
+}
+
+static void paletteSetup(void) {
+  rngState = 0x12345678;
+  for(uint8_t i=0; i<16; i++) {
+    uint32_t r = rng();
+    palette[i].r = r;
+    palette[i].g = r >> 8;
+    palette[i].b = r >> 16;
+  }
+  memset(leds, 0, sizeof leds);
+  sPseudotime = sHue16 = 0;
+}
+
+static uint32_t paletteFrame(uint32_t iter) {
+  const uint16_t deltams = 20;
+  uint32_t       ms      = iter * deltams;
+
+  uint8_t  brightdepth          = beatsin88(341, 96, 224, ms);
+  uint16_t brightnessthetainc16 = beatsin88(203, (25 * 256), (40 * 256), ms);
+  uint8_t  msmultiplier         = beatsin88(147, 23, 60, ms);
+  uint16_t hue16                = sHue16;
+  uint16_t hueinc16             = beatsin88(113, 300, 1500, ms);
+
+  sPseudotime += deltams * msmultiplier;
+  sHue16      += deltams * beatsin88(400, 5, 9, ms);
+  uint16_t brightnesstheta16 = sPseudotime;
+
+  for(uint16_t i=0; i<NUM_LEDS; i++) {
+    hue16 += hueinc16;
+    uint8_t  hue8;
+    uint16_t h16_128 = hue16 >> 7;
+    if(h16_128 & 0x100) hue8 = 255 - (h16_128 >> 1);
+    else                hue8 = h16_128 >> 1;
+
+    brightnesstheta16 += brightnessthetainc16;
+    uint16_t b16   = sin16(brightnesstheta16) + 32768;
+    uint16_t bri16 = (uint32_t)((uint32_t)b16 * (uint32_t)b16) / 65536;
+    uint8_t  bri8  = (uint32_t)(((uint32_t)bri16) * brightdepth) / 65536;
+    bri8 += (255 - brightdepth);
+
+    RGB newcolor = colorFromPalette(scale8(hue8, 240), bri8);
+    RGB &led     = leds[(NUM_LEDS - 1) - i];
+    // nblend(led, newcolor, 128)
+    led.r = ((uint16_t)led.r + newcolor.r) >> 1;
+    led.g = ((uint16_t)led.g + newcolor.g) >> 1;
+    led.b = ((uint16_t)led.b + newcolor.b) >> 1;
+  }
+
+  return ((uint32_t)leds[0].r << 16) | ((uint32_t)leds[NUM_LEDS / 2].g << 8) |
+         leds[NUM_LEDS - 1].b;
+}
+
+// NMEA ---------------------------------------------------------------------
+// Checksum test and RMC field extraction as done in SD_GPSLogger.ino,
+// extended to pull time, position and speed out like the other loggers.
+
+static const char nmea0[] PROGMEM = "$GPRMC,194509.000,A,4042.6142,N,07400.4168,W,2.03,221.11,160412,,,A*77\r\n";
+static const char nmea1[] PROGMEM = "$GPRMC,194510.000,A,4042.6148,N,07400.4175,W,1.97,219.86,160412,,,A*72\r\n";
+static const char nmea2[] PROGMEM = "$GPRMC,194511.000,A,4042.6153,N,07400.4182,W,2.12,220.48,160412,,,A*77\r\n";
+static const char nmea3[] PROGMEM = "$GPRMC,194512.000,V,4042.6159,N,07400.4190,W,0.00,0.00,160412,,,N*68\r\n";
+static const char * const nmeaList[] = { nmea0, nmea1, nmea2, nmea3 };
+static char nmeaBuf[90];
+
+static void nmeaSetup(void) { }
+
+static uint8_t parseHex(char c) {
+  if(c < '0')  return 0;
+  if(c <= '9') return c - '0';
+  if(c < 'A')  return 0;
+  if(c <= 'F') return (c - 'A') + 10;
+  return 0;
+}
+
+// Parse "ddmm.mmmm" style field to fixed-point minutes * 10000
+static int32_t parseCoord(const char *p) {
+  int32_t v = 0;
+  for(; *p && (*p != ','); p++) {
+    if((*p >= '0') && (*p <= '9')) v = v * 10 + (*p - '0');
+  }
+  return v;
+}
+
+static uint32_t nmeaSentence(uint32_t iter) {
+  strcpy_P(nmeaBuf, nmeaList[iter & 3]);
+  uint8_t len = strlen(nmeaBuf) - 1; // Index of '\n'
+
+  if(nmeaBuf[len - 4] != '*') return 0;
+  uint8_t sum = parseHex(nmeaBuf[len - 3]) * 16;
+  sum += parseHex(nmeaBuf[len - 2]);
+  for(uint8_t i=1; i < (len - 4); i++) sum ^= nmeaBuf[i];
+  if(sum) return 1; // Checksum mismatch
+
+  if(!strstr(nmeaBuf, "GPRMC")) return 2;
+  char    *p = strchr(nmeaBuf, ',') + 1;          // Time
+  uint32_t t = parseCoord(p);
+  p = strchr(p, ',') + 1;                         // Status
+  bool fix = (p[0] == 'A');
+  p = strchr(p, ',') + 1;                         // Latitude
+  int32_t lat = parseCoord(p);
+  p = strchr(p, ',') + 1;                         // N/S
+  if(p[0] == 'S') lat = -lat;
+  p = strchr(p, ',') + 1;                         // Longitude
+  int32_t lon = parseCoord(p);
+  p = strchr(p, ',') + 1;                         // E/W
+  if(p[0] == 'W') lon = -lon;
+  p = strchr(p, ',') + 1;                         // Speed
+  int32_t speed = parseCoord(p);
+
+  return t ^ (uint32_t)lat ^ ((uint32_t)lon << 1) ^ (uint32_t)speed ^ fix;
+}
+
+// --------------------------------------------------------------------------
+
+const Kernel kernels[] = {
+  { "eye_column", EYE_SIZE, eyeSetup,     eyeColumn     },
+  { "pdm_sinc",   PDM_WORDS, pdmSetup,    pdmDecimate   },
+  { "raycast",    128,      raycastSetup, raycastColumn },
+  { "fft",        FFT_SIZE, fftSetup,     fftFrame      },
+  { "palette",    NUM_LEDS, paletteSetup, paletteFrame  },
+  { "nmea",       1,        nmeaSetup,    nmeaSentence  },
+};
+const uint8_t numKernels = sizeof kernels / sizeof kernels[0];
@@ -0,0 +1,55 @@
+/* Workload kernels for kernel_bench.
+ *
+ * Each kernel is a trimmed-down, self-contained copy of the inner loop of
+ * a project elsewhere in this repository, fed with synthetic data so it
+ * runs without the original hardware:
+ *
+ *   eye_column  M4_Eyes: render one display column through the
+ *               displacement + polar angle/distance maps
+ *   pdm_sinc    M4_Eyes pdmvoice.cpp: 64-tap sinc decimation of PDM words
+ *   raycast     Hallowing_Minotaur_Maze: DDA ray cast for one column
+ *   fft         Tiny_Music_Visualizer (Piccolo_Scalable): window + FFT +
+ *               column fold, one frame
+ *   palette     simple_strand_palettes colorwaves(): one frame of
+ *               palette lookup and blend across the whole strand
+ *   nmea        SD_GPSLogger: checksum-check and parse one RMC sentence
+ *
+ * Nothing in kernels.h/.cpp depends on the Arduino core, so the same code
+ * builds on a Linux host for comparison (see kernel_bench.ino).
+ */
+
+#ifndef _KERNELS_H_
+#define _KERNELS_H_
+
+#include <stdint.h>
+
+// Problem sizes scale with available RAM. The same board always runs the
+// same sizes, and sizes are reported alongside results, so numbers are
+// comparable between host and device runs that use the same settings.
+#if defined(__AVR__)
+ #define EYE_SIZE   16  // Display width/height, pixels
+ #define FFT_SIZE   64  // Samples per FFT frame
+ #define NUM_LEDS   60  // Strand length for palette kernel
+#elif defined(__SAMD21G18A__) || defined(__SAMD21E18A__)
+ #define EYE_SIZE  128
+ #define FFT_SIZE  512
+ #define NUM_LEDS  400
+#else
+ #define EYE_SIZE  240  // Matches M4_Eyes DISPLAY_SIZE
+ #define FFT_SIZE 1024
+ #define NUM_LEDS  400  // Matches simple_strand_palettes
+#endif
+#define PDM_WORDS   32  // 32-bit PDM words per pdm_sinc iteration (16 samples)
+#define FFT_COLS     8  // Output columns for fft kernel
+
+typedef struct {
+  const char *name;            // Short identifier used in results
+  uint16_t    size;            // Problem size, for reporting
+  void      (*setup)(void);    // Build tables & reset state
+  uint32_t  (*run)(uint32_t);  // One iteration; returns a checksum
+} Kernel;
+
+extern const Kernel  kernels[];
+extern const uint8_t numKernels;
+
+#endif // _KERNELS_H_
@@ -0,0 +1,266 @@
+/*
+Portable fixed-point spectrum engine for PICCOLO-style visualizers.
+
+Replaces elm-chan's AVR-only ffft library (fixed at FFT_N = 128 and an
+8-column hand-tuned colData table) with a templated real-input FFT that
+works for any power-of-two size from 64 to 2048 samples, applies a Hann
+window, and folds the resulting N/2 bins down to 8..64 display columns
+using a logarithmic bin map that's computed at compile time.
+
+On SAMD21 (M0) and SAMD51 (M4) boards the CMSIS-DSP q15 real FFT is used
+when available; everywhere else (AVR, host builds) a plain C++ radix-2
+FFT is used.  Both produce the same magnitude scale, |X[k]| / N: a sine
+of amplitude A reads as about A/4 in its peak bin once Hann windowed.
+Keep samples within +/-16384 for headroom (e.g. 10-bit ADC value - 512,
+shifted left 5 bits).
+
+Usage:
+  Spectrum<128, 8> spectrum; // 128-sample FFT, 8 output columns
+  spectrum.begin();          // Builds window & twiddle tables
+  // Fill spectrum.samples[0..127] with signed audio, then...
+  spectrum.process();        // spectrum.bins[] and spectrum.columns[] valid
+
+Written by Adafruit Industries.  Distributed under the BSD license --
+see license.txt for more information.
+*/
+
+#ifndef _SPECTRUM_H_
+#define _SPECTRUM_H_
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#if defined(__AVR__)
+ #include <avr/pgmspace.h>
+ #define SPECTRUM_PROGMEM   PROGMEM
+ #define spectrumRead16(a)  pgm_read_word(a)
+#else
+ #define SPECTRUM_PROGMEM
+ #define spectrumRead16(a)  (*(const uint16_t *)(a))
+#endif
+
+// CMSIS-DSP backend is opt-out: #define SPECTRUM_NO_CMSIS before
+// including this file to force the portable FFT on ARM boards.
+#if !defined(SPECTRUM_NO_CMSIS) && \
+    (defined(ARM_MATH_CM4) || defined(ARM_MATH_CM0PLUS))
+ #include <arm_math.h>
+ #define SPECTRUM_CMSIS
+#endif
+
+namespace spectrum_detail {
+
+// Compile-time helpers for the log-frequency column map --------------------
+// (C++11 constexpr: single return statement, recursion instead of loops.)
+
+constexpr uint8_t ilog2(uint32_t n) {
+  return (n <= 1) ? 0 : 1 + ilog2(n >> 1);
+}
+
+// Taylor series for e^x, good to well under 1 part in 10^6 for 0 <= x < 8
+constexpr double expTerm(double x, int n, double term, double sum) {
+  return (n > 40) ? sum : expTerm(x, n + 1, term * x / n, sum + term * x / n);
+}
+constexpr double cexp(double x) { return expTerm(x, 1, 1.0, 1.0); }
+
+// Ideal (unrounded) lower edge of column c: bins 1 through N/2-1 are
+// divided into 'cols' equal-width bands on a log2 scale.
+constexpr double rawEdge(uint16_t n, uint8_t cols, uint8_t c) {
+  return cexp(0.6931471805599453 * (double)ilog2(n / 2) * c / cols);
+}
+
+// Rounded edges, forced to advance at least one bin per column so the
+// lowest (narrowest) columns never come out empty.  Walks upward from
+// column 1 carrying the previous edge along, rather than recursing on
+// c-1 twice (which would be exponential at compile time).
+constexpr uint16_t nextEdge(uint16_t prev, uint16_t raw) {
+  return (raw > prev) ? raw : prev + 1;
+}
+constexpr uint16_t edgeWalk(uint16_t n, uint8_t cols, uint8_t c,
+  uint8_t target, uint16_t prev) {
+  return (c > target) ? prev : edgeWalk(n, cols, c + 1, target,
+    nextEdge(prev, (uint16_t)(rawEdge(n, cols, c) + 0.5)));
+}
+constexpr uint16_t binEdge(uint16_t n, uint8_t cols, uint8_t c) {
+  return edgeWalk(n, cols, 1, c, 1);
+}
+
+// Minimal C++11 stand-in for std::index_sequence (not available on AVR)
+template<uint8_t... I> struct Seq { };
+template<uint8_t N, uint8_t... I> struct MakeSeq : MakeSeq<N - 1, N - 1, I...> { };
+template<uint8_t... I> struct MakeSeq<0, I...> { typedef Seq<I...> type; };
+
+template<uint16_t N, uint8_t COLS, typename S> struct EdgeTable;
+template<uint16_t N, uint8_t COLS, uint8_t... I>
+struct EdgeTable<N, COLS, Seq<I...> > {
+  static const uint16_t edge[sizeof...(I)];
+};
+template<uint16_t N, uint8_t COLS, uint8_t... I>
+const uint16_t EdgeTable<N, COLS, Seq<I...> >::edge[sizeof...(I)]
+  SPECTRUM_PROGMEM = { binEdge(N, COLS, I)... };
+
+// Integer square root, 32-bit in, 16-bit out
+inline uint16_t isqrt32(uint32_t n) {
+  uint32_t root = 0, bit = 1UL << 30;
+  while(bit > n) bit >>= 2;
+  while(bit) {
+    if(n >= root + bit) {
+      n   -= root + bit;
+      root = (root >> 1) + bit;
+    } else {
+      root >>= 1;
+    }
+    bit >>= 2;
+  }
+  return (uint16_t)root;
+}
+
+} // namespace spectrum_detail
+
+template<uint16_t N, uint8_t COLS>
+class Spectrum {
+ public:
+  static_assert((N >= 64) && (N <= 2048) && !(N & (N - 1)),
+    "Spectrum: N must be a power of two from 64 to 2048");
+  static_assert((COLS >= 1) && (COLS <= 64),
+    "Spectrum: COLS must be from 1 to 64");
+  static_assert(spectrum_detail::binEdge(N, COLS, COLS) <= N / 2,
+    "Spectrum: too many columns for this FFT size");
+
+  int16_t  samples[N];     // Caller fills this with signed audio
+  uint16_t bins[N / 2];    // Magnitude of each FFT bin (0 = DC)
+  uint16_t columns[COLS];  // Bins folded down to log-spaced columns
+
+  void begin(void) {
+    // Hann window; symmetric, so only the first half is stored
+    for(uint16_t i=0; i<N/2; i++) {
+      window[i] = (int16_t)(32767.0 *
+        (0.5 - 0.5 * cos(2.0 * M_PI * i / (N - 1))) + 0.5);
+    }
+#ifdef SPECTRUM_CMSIS
+    arm_rfft_init_q15(&rfft, N, 0, 1);
+#else
+    // Quarter-wave sine table: sine[i] = sin(2*pi*i/N), i = 0 to N/4
+    for(uint16_t i=0; i<=N/4; i++) {
+      sine[i] = (int16_t)(32767.0 * sin(2.0 * M_PI * i / N) + 0.5);
+    }
+#endif
+  }
+
+  // First and one-past-last FFT bin folded into column c
+  static uint16_t firstBin(uint8_t c) {
+    return spectrumRead16(&Edges::edge[c]);
+  }
+  static uint16_t lastBin(uint8_t c) {
+    return spectrumRead16(&Edges::edge[c + 1]);
+  }
+
+  // Window 'samples', FFT, and fill 'bins' and 'columns'.
+  // 'samples' is overwritten in the process.
+  void process(void) {
+    uint16_t i;
+
+    for(i=0; i<N/2; i++) {
+      samples[i]         = ((int32_t)samples[i]         * window[i]) >> 15;
+      samples[N - 1 - i] = ((int32_t)samples[N - 1 - i] * window[i]) >> 15;
+    }
+
+#ifdef SPECTRUM_CMSIS
+    // arm_rfft_q15 output is scaled down by N/2, and arm_cmplx_mag_q15
+    // returns 2.14 format (another halving), so this matches the
+    // portable path's 1/N scale with no further adjustment.
+    arm_rfft_q15(&rfft, samples, cmsisOut);
+    arm_cmplx_mag_q15(cmsisOut, (q15_t *)bins, N / 2);
+#else
+    realFFT();
+#endif
+
+    // Fold bins down to columns (mean magnitude across each band)
+    for(uint8_t c=0; c<COLS; c++) {
+      uint16_t lo = firstBin(c), hi = lastBin(c);
+      uint32_t sum = 0;
+      for(i=lo; i<hi; i++) sum += bins[i];
+      columns[c] = sum / (hi - lo);
+    }
+  }
+
+ private:
+  typedef spectrum_detail::EdgeTable<N, COLS,
+    typename spectrum_detail::MakeSeq<COLS + 1>::type> Edges;
+
+  int16_t window[N / 2];
+#ifdef SPECTRUM_CMSIS
+  arm_rfft_instance_q15 rfft;
+  q15_t                 cmsisOut[N * 2];
+#else
+  int16_t sine[N / 4 + 1];
+
+  // cos & sin of 2*pi*k/N, for 0 <= k < N/2
+  inline int16_t cosN(uint16_t k) const {
+    return (k <= N/4) ? sine[N/4 - k] : -sine[k - N/4];
+  }
+  inline int16_t sinN(uint16_t k) const {
+    return (k <= N/4) ? sine[k] : sine[N/2 - k];
+  }
+
+  // N-point real FFT done as an N/2-point complex FFT (even samples as
+  // real part, odd samples as imaginary -- which is exactly how they're
+  // already laid out in memory) followed by a split step.  Each butterfly
+  // stage halves its output so nothing can overflow 16 bits.
+  void realFFT(void) {
+    const uint16_t M = N / 2;
+    int16_t       *z = samples; // z[2k] = real, z[2k+1] = imaginary
+    uint16_t       i, j, k, len, half, step;
+
+    // Bit-reverse reorder
+    for(i=1, j=0; i<M; i++) {
+      uint16_t bit = M >> 1;
+      for(; j & bit; bit >>= 1) j ^= bit;
+      j ^= bit;
+      if(i < j) {
+        int16_t t;
+        t = z[2*i];   z[2*i]   = z[2*j];   z[2*j]   = t;
+        t = z[2*i+1]; z[2*i+1] = z[2*j+1]; z[2*j+1] = t;
+      }
+    }
+
+    // Radix-2 decimation-in-time butterflies
+    for(len=2, step=N/2; len<=M; len<<=1, step>>=1) {
+      half = len >> 1;
+      for(i=0; i<M; i+=len) {
+        for(j=0, k=0; j<half; j++, k+=step) {
+          int32_t wr = cosN(k), wi = sinN(k);
+          int16_t *a = &z[2*(i+j)], *b = &z[2*(i+j+half)];
+          // b * e^(-i*theta)
+          int32_t vr = (b[0] * wr + b[1] * wi) >> 15,
+                  vi = (b[1] * wr - b[0] * wi) >> 15;
+          b[0] = (a[0] - vr) >> 1;
+          b[1] = (a[1] - vi) >> 1;
+          a[0] = (a[0] + vr) >> 1;
+          a[1] = (a[1] + vi) >> 1;
+        }
+      }
+    }
+
+    // Split complex result into N/2 real-FFT bins.  For k in 1..M-1:
+    //   X[k] = (Z[k] + Z*[M-k]) / 2 - i * W^k * (Z[k] - Z*[M-k]) / 2
+    // Done in increasing k, but bins[] is separate from z so Z stays intact.
+    bins[0] = abs(z[0] + z[1]) >> 1;
+    for(k=1; k<M; k++) {
+      int32_t ar = z[2*k],            ai = z[2*k+1],
+              br = z[2*(M-k)],        bi = -z[2*(M-k)+1],
+              er = (ar + br) >> 1,    ei = (ai + bi) >> 1, // Even part
+              or_ = (ar - br) >> 1,   oi = (ai - bi) >> 1, // Odd part
+              wr = cosN(k),           wi = sinN(k);
+      // -i * W^k = -i * (wr - i*wi) = -wi - i*wr
+      int32_t tr = (-or_ * wi + oi * wr) >> 15,
+              ti = (-or_ * wr - oi * wi) >> 15;
+      int32_t xr = (er + tr) >> 1, xi = (ei + ti) >> 1;
+      bins[k] = spectrum_detail::isqrt32((uint32_t)(xr * xr + xi * xi));
+    }
+  }
+#endif
+};
+
+#endif // _SPECTRUM_H_
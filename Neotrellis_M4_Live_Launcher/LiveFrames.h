@@ -0,0 +1,66 @@
+/* Message framing from the Live script to the Live Launcher
+
+   Each message is
+     type, length, data[length]
+   COBS-encoded (so it contains no 0 bytes) and followed by a single 0.
+   A frame is only acted on once it has all arrived, its length matches,
+   and the 0 after it is seen, so a message split across USB packets is
+   simply waited for, and after a lost or garbled byte the parser is back
+   in step at the next 0. Messages:
+
+     'C'  96 bytes    all pad colors: R, G, B for pads 0-31
+     'D'  4 * n bytes n changed pads: pad, R, G, B each
+     'B'  3 bytes     clip status: track (x), state, clip (y)
+
+   live_frames.py, next to this sketch, builds these on the Live side.
+*/
+
+#ifndef LIVE_FRAMES_H
+#define LIVE_FRAMES_H
+
+#include <stdint.h>
+
+#define LIVE_MAX_DATA  128                    // 'D' for all 32 pads
+#define LIVE_MAX_FRAME (LIVE_MAX_DATA + 2 + 2) // + type/length + COBS overhead
+
+typedef struct {
+  uint8_t buf[LIVE_MAX_FRAME]; // encoded frame so far, decoded in place
+  uint8_t len;
+  bool    overflow;            // frame too long; skip to the next 0
+  uint8_t type;                // last message received
+  uint8_t length;
+  const uint8_t *data;
+} LiveParser;
+
+// Undo COBS in place; returns the decoded length, or -1 if malformed
+static int liveCobsDecode(uint8_t *buf, int n) {
+  int in = 0, out = 0;
+  while (in < n) {
+    uint8_t code = buf[in++];
+    if (code == 0 || in + code - 1 > n) return -1;
+    for (uint8_t i = 1; i < code; i++) buf[out++] = buf[in++];
+    if (code < 0xFF && in < n) buf[out++] = 0;
+  }
+  return out;
+}
+
+// Take in one received byte. Returns true when it completes a valid
+// message, which is then in p->type, p->length and p->data.
+static bool liveFeed(LiveParser *p, uint8_t c) {
+  if (c != 0) {
+    if (p->len < LIVE_MAX_FRAME) p->buf[p->len++] = c;
+    else p->overflow = true;
+    return false;
+  }
+  // End of frame
+  int n = p->overflow ? -1 : liveCobsDecode(p->buf, p->len);
+  p->len = 0;
+  p->overflow = false;
+  if (n < 2 || p->buf[1] != n - 2) return false;
+  p->type   = p->buf[0];
+  p->length = p->buf[1];
+  p->data   = &p->buf[2];
+  return true;
+}
+
+#endif
@@ -1,26 +1,28 @@
 /* Live Launcher - Ableton Live controller for Adafruit Neotrellis M4
     by Collin Cunningham for Adafruit Industries
     https://www.adafruit.com/product/3938
+
+    Live sends pad colors and clip status as framed messages (see
+    LiveFrames.h); pad presses go back as single bytes, 0-31.
 */
 
 #include <Adafruit_NeoTrellisM4.h>
+#include "LiveFrames.h"
 
 #define WIDTH      8
 #define HEIGHT     4
 #define N_BUTTONS  WIDTH*HEIGHT
 #define NEO_PIN 10
 #define NUM_KEYS 32
-#define SERIAL_TIMEOUT 1000  //time before giving up on incoming serial data
-#define COLOR_DATA_LENGTH 98   //number of total bytes to expect in incoming color data 
-//4 bytes per color * 32 buttons = 128 bytes + 2 header bytes = 130 bytes total
-#define BUTTON_DATA_LENGTH 5  //clip playing status message for each button
+#define SERIAL_CHUNK 64  //bytes taken from serial at a time
 #define PULSE_DURATION 350  //length of 'now playing' pulse
 
-unsigned long readTime; //time we start reading serial buffer
 unsigned long lastPulseTime;
 bool pulseOn = false;
-uint8_t packetbuffer[COLOR_DATA_LENGTH]; //store incoming serial data
+LiveParser parser;
 uint8_t colors[96];
+uint32_t shown[N_BUTTONS];   //color each pad was last set to
+bool repaint = false;        //colors, playing or pulse changed since last paint
 
 Adafruit_NeoTrellisM4 trellis = Adafruit_NeoTrellisM4();
 
@@ -45,17 +47,17 @@ void setup() {
   //  while (!Serial) {}
 
   trellis.begin();
+  trellis.autoUpdateNeoPixels(false);  //one show() per loop, in paintPads()
   trellis.setBrightness(255);
   trellis.fill(0);
+  trellis.show();
 }
 
 
 void loop() {
   unsigned long startTime = millis();
 
-  if (Serial.available() >= BUTTON_DATA_LENGTH) {
-    parseData();
-  }
+  readSerial();
 
   //send press events to Live via serial
   trellis.tick();
@@ -71,93 +73,107 @@ void loop() {
     }
   }
 
+  //flash any clip which is playing
   if ((startTime - lastPulseTime) >= PULSE_DURATION) {
-
-    //flash any clip which is playing
-    if (pulseOn) {
-      for (uint8_t i = 0; i < N_BUTTONS; i++) {
-          setPixelWithColorsIndex(i, false);
-      }
-    }
-    else {
-      for (uint8_t i = 0; i < N_BUTTONS; i++) {
-        if (playing[i]) {
-          setPixelWithColorsIndex(i, true);
-        }
-        else setPixelWithColorsIndex(i, false);
-      }
-    }
     pulseOn = !pulseOn;
     lastPulseTime = millis();
+    repaint = true;
   }
+
+  paintPads();
 }
 
-void parseData() {
+//take everything waiting on serial and act on each complete message;
+//a message cut short stays in the parser until the rest arrives
+void readSerial() {
+  uint8_t chunk[SERIAL_CHUNK];
+  int n;
+
+  while ((n = Serial.available()) > 0) {
+    if (n > SERIAL_CHUNK) n = SERIAL_CHUNK;
+    n = Serial.readBytes((char *)chunk, n);
+    for (int i = 0; i < n; i++) {
+      if (liveFeed(&parser, chunk[i])) {
+        handleMessage(parser.type, parser.data, parser.length);
+      }
+    }
+  }
+}
 
-  //check for ! start char
-  if (Serial.read() == '!') {
-    uint8_t id = Serial.read();
+void handleMessage(uint8_t id, const uint8_t *data, uint8_t length) {
 
-    //check for Color data
-    if (id == 'C') {
-      for (int i = 0; i < 96; i++) {
-        colors[i] = Serial.read();
-      }
+  //all pad colors
+  if (id == 'C' && length == 96) {
+    memcpy(colors, data, 96);
+    repaint = true;
+  }
 
-      //color button leds
-      for (int i = 0; i < N_BUTTONS; i++) {
-        setPixelWithColorsIndex(i, false);
+  //changed pad colors only: pad, R, G, B for each
+  else if (id == 'D' && (length % 4) == 0) {
+    for (uint8_t i = 0; i < length; i += 4) {
+      uint8_t pad = data[i];
+      if (pad < N_BUTTONS) {
+        memcpy(&colors[pad * 3], &data[i + 1], 3);
       }
     }
+    repaint = true;
+  }
 
-    //check for clip status data
-    else if (id == 'B') {
-      uint8_t x = Serial.read();
-      uint8_t state = Serial.read();
-      uint8_t y = Serial.read();
-
-      if (state == 0) { //if state is 0, all clips in track are stopped
-        for (int i = 0; i < HEIGHT; i++) {
-          uint8_t index = i * WIDTH + x;
-          playing[index] = state;
-        }
-      }
+  //clip status
+  else if (id == 'B' && length == 3) {
+    uint8_t x = data[0];
+    uint8_t state = data[1];
+    uint8_t y = data[2];
+    if (x >= WIDTH || y >= HEIGHT) return;
+
+    //a track plays one clip at a time; state 0 means all are stopped
+    for (int i = 0; i < HEIGHT; i++) {
+      uint8_t index = i * WIDTH + x;
+      playing[index] = 0;
+    }
+    //save playing state
+    uint8_t index = y * WIDTH + x;
+    playing[index] = state;
+    repaint = true;
+  }
+}
 
-      else {  //all other clips in track should stop
-        for (int i = 0; i < HEIGHT; i++) {
-          uint8_t index = i * WIDTH + x;
-          playing[index] = 0;
-        }
-        //save playing state
-        uint8_t index = y * WIDTH + x;
-        playing[index] = state;
-      }
+//set only the pads whose color changed, then show them all at once
+void paintPads() {
+  if (!repaint) return;
+  repaint = false;
+
+  bool changed = false;
+  for (uint8_t i = 0; i < N_BUTTONS; i++) {
+    uint32_t color = colorWithColorsIndex(i, pulseOn && playing[i]);
+    if (color != shown[i]) {
+      trellis.setPixelColor(i, color);
+      shown[i] = color;
+      changed = true;
     }
   }
+  if (changed) trellis.show();
 }
 
-void setPixelWithColorsIndex(int i, bool dimmed) {
+uint32_t colorWithColorsIndex(int i, bool dimmed) {
 
   uint8_t red = colors[i * 3];
   uint8_t green = colors[i * 3 + 1];
   uint8_t blue = colors[i * 3 + 2];
   if (dimmed) {
-    setPixelWithGamma(i, red / 2, green / 2, blue / 2);
+    return colorWithGamma(red / 2, green / 2, blue / 2);
   }
   else {
-    setPixelWithGamma(i, red, green, blue);
+    return colorWithGamma(red, green, blue);
   }
-
 }
 
-void setPixelWithGamma(int pixelNumber, uint8_t red, uint8_t green, uint8_t blue) {
-
-  uint32_t color = trellis.Color(
-                     pgm_read_byte(&gamma8[red]),
-                     pgm_read_byte(&gamma8[green]),
-                     pgm_read_byte(&gamma8[blue]));
+uint32_t colorWithGamma(uint8_t red, uint8_t green, uint8_t blue) {
 
-  trellis.setPixelColor(pixelNumber, color);
+  return trellis.Color(
+           pgm_read_byte(&gamma8[red]),
+           pgm_read_byte(&gamma8[green]),
+           pgm_read_byte(&gamma8[blue]));
 }
 
 const uint8_t PROGMEM gamma8[] = {
@@ -0,0 +1,53 @@
+"""Build Live Launcher messages for the Neotrellis M4 (see LiveFrames.h).
+
+Each message is type, length, data, COBS-encoded and ended with a 0 byte.
+Send only what changed where possible: colors() for the first update and
+scene changes, color_changes() for a few pads, clip_status() for clips.
+"""
+
+
+def cobs_encode(data):
+    """COBS-encode bytes so the result holds no zeros"""
+    out = bytearray([0])
+    code_at, code = 0, 1
+    for b in data:
+        if b == 0:
+            out[code_at] = code
+            code_at, code = len(out), 1
+            out.append(0)
+            continue
+        out.append(b)
+        code += 1
+        if code == 0xFF:
+            out[code_at] = code
+            code_at, code = len(out), 1
+            out.append(0)
+    out[code_at] = code
+    return bytes(out)
+
+
+def frame(kind, data):
+    """One message on the wire: COBS(type, length, data) then 0"""
+    data = bytes(data)
+    if len(data) > 128:
+        raise ValueError('message data is limited to 128 bytes')
+    return cobs_encode(bytes([ord(kind), len(data)]) + data) + b'\x00'
+
+
+def colors(rgb):
+    """All 32 pads: rgb is a list of 32 (r, g, b) tuples"""
+    return frame('C', [c for pad in rgb for c in pad])
+
+
+def color_changes(old, new):
+    """Only the pads whose color differs between two lists of 32 (r, g, b)"""
+    data = []
+    for pad, (a, b) in enumerate(zip(old, new)):
+        if a != b:
+            data += [pad] + list(b)
+    return frame('D', data) if data else b''
+
+
+def clip_status(track, state, clip):
+    """A clip started (state nonzero) or the track's clips stopped (0)"""
+    return frame('B', [track, state, clip])
@@ -0,0 +1,64 @@
+// Adafruit_NeoTrellisM4 stand-in for liveframes_test.cpp, with just enough
+// of Arduino for the sketch. Serial hands out the bytes of 'rx' up to
+// 'rxAvail', as if that much had arrived over USB. The trellis keeps the
+// pixels set and the pixels last shown, and counts both.
+#pragma once
+#include <stdint.h>
+#include <string.h>
+#include <vector>
+
+#define PROGMEM
+#define pgm_read_byte(p) (*(const uint8_t *)(p))
+typedef uint8_t byte;
+typedef bool    boolean;
+
+extern unsigned long fakeMillis;
+static unsigned long millis() { return fakeMillis; }
+
+extern std::vector<uint8_t> rx;
+extern size_t rxPos, rxAvail;
+
+struct SerialStub {
+  void   begin(long) { }
+  int    available() { return rxAvail - rxPos; }
+  size_t readBytes(char *buf, int n) {
+    memcpy(buf, &rx[rxPos], n);
+    rxPos += n;
+    return n;
+  }
+  void   write(uint8_t) { }
+};
+extern SerialStub Serial;
+
+enum { KEY_JUST_PRESSED = 1, KEY_JUST_RELEASED = 2 };
+union keypadEvent { struct { uint8_t KEY, EVENT; } bit; };
+#define makeKeymap(x) ((byte *)x)
+struct Adafruit_Keypad {
+  Adafruit_Keypad(byte *, byte *, byte *, int, int) { }
+};
+
+struct Adafruit_NeoTrellisM4 {
+  uint32_t px[32], showing[32];
+  bool     autoUpdate = true;
+  long     sets = 0, shows = 0;
+
+  void begin() { }
+  void setBrightness(int) { }
+  void tick() { }
+  bool available() { return false; }
+  keypadEvent read() { return keypadEvent(); }
+  void autoUpdateNeoPixels(bool on) { autoUpdate = on; }
+  void fill(uint32_t c) { for (int i = 0; i < 32; i++) px[i] = c; }
+  static uint32_t Color(uint8_t r, uint8_t g, uint8_t b) {
+    return (uint32_t)r << 16 | (uint32_t)g << 8 | b;
+  }
+  void setPixelColor(int i, uint32_t c) {
+    px[i] = c;
+    sets++;
+    if (autoUpdate) show();
+  }
+  void show() {
+    memcpy(showing, px, sizeof px);
+    shows++;
+  }
+};
@@ -0,0 +1,91 @@
+// Host test for the Live Launcher sketch. Runs on a PC, not the board;
+// Adafruit_NeoTrellisM4.h next to this file stands in for the trellis
+// and Serial.
+//
+// Feeds the sketch the messages make_stream.py builds with live_frames.py,
+// in random fragments of 1 to 64 bytes (one USB packet) per loop(), so
+// messages arrive split at any point. At each checkpoint the colors must
+// match what was sent, and the pads must show them (dimmed where a clip is
+// playing and the pulse is on) -- nothing left unpainted.
+//
+//   python3 make_stream.py
+//   g++ -O2 -I. -o liveframes_test liveframes_test.cpp
+//   ./liveframes_test
+//
+// Exits nonzero on failure.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <utility>
+#include "Adafruit_NeoTrellisM4.h"
+
+unsigned long fakeMillis = 0;
+std::vector<uint8_t> rx;
+size_t rxPos = 0, rxAvail = 0;
+SerialStub Serial;
+
+// What the Arduino IDE would generate
+void readSerial(); void handleMessage(uint8_t, const uint8_t *, uint8_t);
+void paintPads(); uint32_t colorWithColorsIndex(int, bool);
+uint32_t colorWithGamma(uint8_t, uint8_t, uint8_t);
+
+#include "../Neotrellis_M4_Live_Launcher.ino"
+
+static int failures = 0;
+
+static void check(bool ok, const char *what, size_t cp) {
+  if (!ok) { printf("FAIL: %s at checkpoint %u\n", what, (unsigned)cp); failures++; }
+}
+
+int main(void) {
+  FILE *f = fopen("stream.bin", "rb");
+  FILE *e = fopen("expect.txt", "r");
+  if (!f || !e) {
+    printf("run make_stream.py first\n");
+    return 1;
+  }
+  int c;
+  while ((c = fgetc(f)) != EOF) rx.push_back(c);
+  fclose(f);
+
+  std::vector<std::pair<size_t, std::vector<int> > > cps;
+  char line[4096];
+  while (fgets(line, sizeof line, e)) {
+    char *p = line;
+    std::vector<int> v;
+    size_t at = strtoul(p, &p, 10);
+    for (int i = 0; i < 96; i++) v.push_back(strtol(p, &p, 10));
+    cps.push_back(std::make_pair(at, v));
+  }
+  fclose(e);
+
+  srand(41);
+  setup();
+  size_t cp = 0;
+  long   loops = 0;
+  while (rxPos < rx.size()) {
+    // A random fragment, mostly small, up to one USB packet; stop at the
+    // next checkpoint so the state there can be looked at
+    rxAvail += 1 + rand() % ((rand() % 4) ? 8 : 64);
+    if (rxAvail > rx.size()) rxAvail = rx.size();
+    if ((cp < cps.size()) && (rxAvail > cps[cp].first)) rxAvail = cps[cp].first;
+    fakeMillis += rand() % 3;
+    loop();
+    loops++;
+    while ((cp < cps.size()) && (rxPos >= cps[cp].first)) {
+      bool same = true, painted = true;
+      for (int i = 0; i < 96; i++) same &= (colors[i] == cps[cp].second[i]);
+      for (int i = 0; i < N_BUTTONS; i++)
+        painted &= (trellis.showing[i] == colorWithColorsIndex(i, pulseOn && playing[i]));
+      check(same, "colors", cp);
+      check(painted, "pads shown", cp);
+      cp++;
+    }
+  }
+  check(cp == cps.size(), "all checkpoints reached", cp);
+  check(trellis.shows <= loops + 1, "at most one show() per loop", cp);
+
+  printf("%u bytes in %ld loops, %u checkpoints, %ld setPixelColor, %ld show\n",
+         (unsigned)rx.size(), loops, (unsigned)cp, trellis.sets, trellis.shows);
+  return failures ? 1 : 0;
+}
@@ -0,0 +1,60 @@
+"""Write stream.bin and expect.txt for liveframes_test.cpp.
+
+stream.bin is 3000 random messages from live_frames.py: full color
+updates, changed pads, clip status, and now and then a truncated frame or
+a run of garbage ended by a 0. Every 100 messages expect.txt gets a line:
+the stream offset, then the 96 color bytes the pads should hold there.
+"""
+import os
+import random
+import sys
+
+sys.path.insert(0, os.path.join(os.path.dirname(os.path.abspath(__file__)), '..'))
+import live_frames as lf  # pylint: disable=wrong-import-position
+
+
+def rand_color():
+    return tuple(random.choice([0, 0, 1, 255, random.randrange(256)]) for _ in range(3))
+
+
+def main():
+    random.seed(7)
+    out = bytearray()
+    expect = []
+    cols = [(0, 0, 0)] * 32
+    out += lf.colors(cols)
+    for step in range(3000):
+        r = random.random()
+        if r < 0.2:
+            cols = [rand_color() for _ in range(32)]
+            out += lf.colors(cols)
+        elif r < 0.7:
+            new = list(cols)
+            for _ in range(random.randrange(1, 33)):
+                new[random.randrange(32)] = rand_color()
+            out += lf.color_changes(cols, new)
+            cols = new
+        elif r < 0.9:
+            out += lf.clip_status(random.randrange(8), random.choice([0, 1, 2]),
+                                  random.randrange(4))
+        else:
+            # Must be dropped without losing step with what follows
+            if random.random() < 0.5:
+                out += lf.colors(cols)[:random.randrange(1, 90)] + b'\x00'
+            else:
+                garbage = bytes(random.randrange(1, 256) for _ in range(random.randrange(300)))
+                out += garbage + b'\x00'
+            out += lf.colors(cols)
+        if step % 100 == 99:
+            expect.append((len(out), [c for pad in cols for c in pad]))
+
+    with open('stream.bin', 'wb') as f:
+        f.write(out)
+    with open('expect.txt', 'w', encoding='ascii') as f:
+        for n, c in expect:
+            f.write(f"{n} {' '.join(map(str, c))}\n")
+    print(len(out), 'bytes,', len(expect), 'checkpoints')
+
+
+if __name__ == '__main__':
+    main()
@@ -3,9 +3,21 @@
 // this is a generic logger that does checksum testing so the data written should be always good
 // Assumes a sirf III chipset logger attached to pin 2 and 3
 
-#include <SD.h>
+// Sentences are collected in a 512-byte buffer and written to the card a
+// whole sector at a time (see SectorLog.h). Writing + flushing every
+// sentence instead costs a sector read-modify-write plus directory/FAT
+// updates per line. The buffer is synced to the card every SYNC_INTERVAL
+// seconds, and optionally right away if the supply voltage sags (battery
+// dying or being unplugged). Each sync trims the file to the data logged,
+// so a reset or pulled card never leaves stale sectors at its end.
+
+#include <SdFat.h>
 #include <avr/sleep.h>
+#include <EEPROM.h>
 #include "GPSconfig.h"
+#include "nmea.h"
+#include "track.h"
+#include "SectorLog.h"
 
 // If using Arduino IDE prior to 1.0,
 // make sure to install newsoftserial from Mikal Hart
@@ -20,6 +32,15 @@
 #define SLEEPDELAY 0    /* power-down time in seconds. Max 65535. Ignored if TURNOFFGPS == 0 */
 #define TURNOFFGPS 0    /* set to 1 to enable powerdown of arduino and GPS. Ignored if SLEEPDELAY == 0 */
 #define LOG_RMC_FIXONLY 0  /* set to 1 to only log to SD when GPD has a fix */
+#define LOG_BINARY 0       /* set to 1 to log compact binary tracks (see track.h) instead of NMEA text */
+#define TRACK_SESSION_ADDR 0 /* EEPROM byte counting binary log files, for track.h's session byte */
+
+// SD write buffering
+#define PREALLOCATE   (4UL << 20) /* where to look for contiguous space per log file, bytes */
+#define SYNC_INTERVAL 30         /* max seconds of data held in RAM */
+#define LOW_VCC_MV    0          /* sync immediately below this supply voltage (mV), 0 = off.
+                                    Try 3400 on a 3xAA pack; USB sits at 4.4-4.7V */
+#define STATS_ON_SYNC 1          /* set to 1 to print write-amplification stats on each sync */
 
 // what to log
 #define LOG_RMC 1 // RMC-Recommended Minimum Specific GNSS Data, message 103,04
@@ -52,19 +73,20 @@ uint8_t bufferidx = 0;
 bool fix = false; // current fix data
 bool gotGPRMC;    //true if current data is a GPRMC strinng
 uint8_t i;
+SdFat SD;
 File logfile;
+NmeaParser gps;          // checks each sentence as it arrives
+uint8_t sentence = NMEA_NONE; // result for the sentence in buffer
 
-// read a Hex value and return the decimal equivalent
-uint8_t parseHex(char c) {
-  if (c < '0')
-    return 0;
-  if (c <= '9')
-    return c - '0';
-  if (c < 'A')
-    return 0;
-  if (c <= 'F')
-    return (c - 'A')+10;
-}
+SectorLog<File> sectorLog;       // pending log data, bytes and sectors written
+uint32_t lastSync = 0;           // millis() at last sync
+uint32_t lastVccCheck = 0;       // millis() at last supply voltage check
+
+#if (LOG_BINARY == 1)
+TrackEncoder track;
+uint32_t fixCount = 0;     // fixes encoded
+uint32_t encodeMicros = 0; // total time spent encoding (parsing is done as bytes arrive)
+#endif
 
 // blink out an error code
 void error(uint8_t errno) {
@@ -111,7 +133,11 @@ void setup() {
     error(1);
   }
 
+#if (LOG_BINARY == 1)
+  strcpy(buffer, "GPSLOG00.TRK");
+#else
   strcpy(buffer, "GPSLOG00.TXT");
+#endif
   for (i = 0; i < 100; i++) {
     buffer[6] = '0' + i/10;
     buffer[7] = '0' + i%10;
@@ -121,12 +147,31 @@ void setup() {
     }
   }
 
-  logfile = SD.open(buffer, FILE_WRITE);
+  logfile = SD.open(buffer, O_RDWR | O_CREAT | O_TRUNC);
   if( ! logfile ) {
     Serial.print("Couldnt create "); Serial.println(buffer);
     error(3);
   }
+  // Pre-allocating starts the file on a contiguous run of free clusters.
+  // It's only a hint: the first sync (just below) trims the file back to
+  // its data, and it then grows a cluster at a time as usual -- normally
+  // straight on into that run. Not fatal if the card is too full.
+  if (!logfile.preAllocate(PREALLOCATE)) {
+    Serial.println(F("Preallocate failed"));
+  }
   Serial.print("Writing to "); Serial.println(buffer);
+
+  sectorLog.begin(&logfile);
+#if (LOG_BINARY == 1)
+  // A different session byte for every file, so keyframes left on the
+  // card by an older one can't pass as this one's (see track.h)
+  uint8_t session = EEPROM.read(TRACK_SESSION_ADDR) + 1;
+  EEPROM.write(TRACK_SESSION_ADDR, session);
+  track.begin(session);
+  uint8_t header[6];
+  logBytes(header, trackHeader(header, session));
+#endif
+  if (!sectorLog.sync()) error(4);
   
   // connect to the GPS at the desired rate
   gpsSerial.begin(GPSRATE);
@@ -190,7 +235,7 @@ void setup() {
 void loop() {
   //Serial.println(Serial.available(), DEC);
   char c;
-  uint8_t sum;
+  uint8_t result;
 
   // read one 'line'
   if (gpsSerial.available()) {
@@ -203,8 +248,11 @@ void loop() {
     if (bufferidx == 0) {
       while (c != '$')
         c = gpsSerial.read(); // wait till we get a $
+      sentence = NMEA_NONE;
     }
     buffer[bufferidx] = c;
+    // checksum and RMC fields are worked out as the characters arrive
+    if ((result = gps.feed(c)) != NMEA_NONE) sentence = result;
 
 #if ARDUINO >= 100
     //Serial.write(c);
@@ -216,42 +264,20 @@ void loop() {
       //Serial.print(buffer);
       buffer[bufferidx+1] = 0; // terminate it
 
-      if (buffer[bufferidx-4] != '*') {
-        // no checksum?
-        Serial.print('*');
-        bufferidx = 0;
-        return;
-      }
-      // get checksum
-      sum = parseHex(buffer[bufferidx-3]) * 16;
-      sum += parseHex(buffer[bufferidx-2]);
-
-      // check checksum
-      for (i=1; i < (bufferidx-4); i++) {
-        sum ^= buffer[i];
-      }
-      if (sum != 0) {
-        //putstring_nl("Cxsum mismatch");
+      if (sentence != NMEA_RMC && sentence != NMEA_GGA &&
+          sentence != NMEA_OTHER) {
+        //putstring_nl("Cxsum mismatch or no checksum");
         Serial.print('~');
         bufferidx = 0;
         return;
       }
       // got good data!
 
-      gotGPRMC = strstr(buffer, "GPRMC");
+      gotGPRMC = (sentence == NMEA_RMC);
       if (gotGPRMC) {
         // find out if we got a fix
-        char *p = buffer;
-        p = strchr(p, ',')+1;
-        p = strchr(p, ',')+1;       // skip to 3rd item
-        
-        if (p[0] == 'V') {
-          digitalWrite(led1Pin, LOW);
-          fix = false;
-        } else {
-          digitalWrite(led1Pin, HIGH);
-          fix = true;
-        }
+        fix = gps.rmc.fix;
+        digitalWrite(led1Pin, fix ? HIGH : LOW);
       }
       if (LOG_RMC_FIXONLY) {
         if (!fix) {
@@ -272,14 +298,19 @@ void loop() {
 
         digitalWrite(led2Pin, HIGH);      // Turn on LED 2 (indicates write to SD)
 
-        logfile.write((uint8_t *) buffer, bufferidx);    //write the string to the SD file
-        logfile.flush();
-        /*
-        if( != bufferidx) {
-           putstring_nl("can't write!");
-           error(4);
+#if (LOG_BINARY == 1)
+        uint32_t t = micros();
+        TrackFix trackFix;
+        if (trackFromRMC(gps.rmc, &trackFix)) {
+          uint8_t record[TRACK_MAX_RECORD];
+          uint8_t len = track.encode(trackFix, record);
+          encodeMicros += micros() - t;
+          fixCount++;
+          logBytes(record, len);    //queue the encoded fix for the SD file
         }
-        */
+#else
+        logBytes((uint8_t *) buffer, bufferidx);    //queue the string for the SD file
+#endif
 
         digitalWrite(led2Pin, LOW);    //turn off LED2 (write to SD is finished)
 
@@ -289,6 +320,7 @@ void loop() {
           
           if ((TURNOFFGPS) && (SLEEPDELAY)) {      // turn off GPS module? 
           
+            syncLog();                     //don't leave data in RAM while asleep
             digitalWrite(powerPin, HIGH);  //turn off GPS
 
             delay(100);  //wait for serial monitor write to finish
@@ -309,9 +341,87 @@ void loop() {
        bufferidx = 0;
     }
   } else {
+    // Idle: see if it's time for a periodic or low-voltage sync
+    if ((millis() - lastSync) >= (SYNC_INTERVAL * 1000UL)) {
+      syncLog();
+    }
+#if LOW_VCC_MV
+    else if ((millis() - lastVccCheck) >= 1000) {
+      lastVccCheck = millis();
+      if (sectorLog.pending() && (readVoltage() < LOW_VCC_MV)) syncLog();
+    }
+#endif
+  }
+
+}
 
+// Queue data for the SD file
+void logBytes(const uint8_t *data, uint16_t len) {
+  if (!sectorLog.write(data, len)) {
+    Serial.println(F("can't write!"));
+    error(4);
   }
+}
+
+// Push any partial sector to the card, trim the file and update the
+// directory entry
+void syncLog() {
+  lastSync = millis();
+  if (!sectorLog.pending()) return;
+  if (!sectorLog.sync()) {
+    Serial.println(F("can't sync!"));
+    error(4);
+  }
+#if STATS_ON_SYNC
+  // Data sectors only; each sync also rewrites the directory entry, and
+  // the FAT when the file has grown into another cluster
+  Serial.print(F("\r\nsync "));
+  Serial.print(sectorLog.syncs);
+  Serial.print(F(": "));
+  Serial.print(sectorLog.bytesLogged);
+  Serial.print(F(" bytes, "));
+  Serial.print(sectorLog.sectorWrites);
+  Serial.print(F(" sector writes, WA "));
+  Serial.println((float)sectorLog.sectorWrites * SECTOR_SIZE / sectorLog.bytesLogged);
+#if (LOG_BINARY == 1)
+  if (fixCount) {
+    Serial.print(F("binary: "));
+    Serial.print(fixCount);
+    Serial.print(F(" fixes, "));
+    Serial.print((float)sectorLog.bytesLogged / fixCount);
+    Serial.print(F(" bytes/fix, "));
+    Serial.print(encodeMicros / fixCount);
+    Serial.println(F(" us/fix"));
+  }
+#endif
+#endif
+}
 
+// Battery monitoring idea adapted from JeeLabs article:
+// jeelabs.org/2012/05/04/measuring-vcc-via-the-bandgap/
+// Code from Adafruit TimeSquare project.
+uint16_t readVoltage() {
+  int      i, prev;
+  uint8_t  count;
+  uint16_t mV;
+
+  // Select AVcc voltage reference + Bandgap (1.1V) input
+  ADMUX  = _BV(REFS0) |
+           _BV(MUX3)  | _BV(MUX2) | _BV(MUX1);
+  ADCSRA = _BV(ADEN)  |                          // Enable ADC
+           _BV(ADPS2) | _BV(ADPS1) | _BV(ADPS0); // 1/128 prescaler (125 KHz)
+  // First bandgap readings are garbage as voltages stabilize; take
+  // repeated readings until four concurrent readings agree within 10 mV.
+  for(prev=9999, count=0; count<4; ) {
+    for(ADCSRA |= _BV(ADSC); ADCSRA & _BV(ADSC); ); // Start, await ADC conv.
+    i  = ADC;                                       // Result
+    mV = i ? (1100L * 1023 / i) : 0;                // Scale to millivolts
+    if(abs((int)mV - prev) <= 10) count++;   // +1 stable reading
+    else                          count = 0; // too much change, start over
+    prev = mV;
+  }
+  ADCSRA = 0; // ADC off
+  return mV;
 }
 
 void sleep_sec(uint16_t x) {
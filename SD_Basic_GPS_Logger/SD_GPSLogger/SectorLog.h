@@ -0,0 +1,85 @@
+// Sector-aligned log writer
+//
+// Collects log data in a 512-byte buffer and writes it to the file a
+// whole sector at a time, so the card never has to read, modify and
+// rewrite a sector for a short write. sync() pushes out any partial
+// sector; that leaves the file off a sector boundary, so the next write
+// is cut short to end exactly on one and alignment is regained.
+//
+// sync() also truncates the file to the data written so far. A
+// pre-allocated file is as long as its allocation, and otherwise a reset,
+// a pulled card or a flat battery would leave the unused tail -- stale
+// sectors from whatever was on the card before -- reading as log data.
+//
+// Works with any file class that has write(buf, n), truncate(length) and
+// sync(): SdFat's File on the logger, a stand-in on a PC.
+
+#ifndef SECTOR_LOG_H
+#define SECTOR_LOG_H
+
+#include <stdint.h>
+#include <string.h>
+
+#define SECTOR_SIZE 512
+
+template <class FileT>
+class SectorLog {
+ public:
+  void begin(FileT *f) {
+    file = f;
+    len = 0;
+    room = SECTOR_SIZE;
+    length = 0;
+    bytesLogged = sectorWrites = 0;
+    syncs = 0;
+  }
+
+  // Append data, writing each time a sector fills. False if a write failed.
+  bool write(const uint8_t *data, uint16_t n) {
+    bytesLogged += n;
+    while (n) {
+      uint16_t part = room - len;
+      if (part > n) part = n;
+      memcpy(&buf[len], data, part);
+      len  += part;
+      data += part;
+      n    -= part;
+      if (len == room && !writeBuf()) return false;
+    }
+    return true;
+  }
+
+  // Write any partial sector, trim the file to the data and update the
+  // directory entry. False if any of that failed.
+  bool sync() {
+    if (len && !writeBuf()) return false;
+    syncs++;
+    return file->truncate(length) && file->sync();
+  }
+
+  uint16_t pending() const { return len; }
+
+  // What was asked for vs. the write() calls made to the file, each of at
+  // most a sector (not counting the directory and FAT updates of sync())
+  uint32_t bytesLogged, sectorWrites;
+  uint16_t syncs;
+
+ private:
+  bool writeBuf() {
+    if ((size_t)file->write(buf, len) != len) return false;
+    sectorWrites++;
+    length += len;
+    room -= len;
+    if (!room) room = SECTOR_SIZE;
+    len = 0;
+    return true;
+  }
+
+  FileT   *file;
+  uint8_t  buf[SECTOR_SIZE];
+  uint16_t len;        // bytes in buf
+  uint16_t room;       // bytes until the file is sector-aligned again
+  uint32_t length;     // bytes written to the file
+};
+
+#endif // SECTOR_LOG_H
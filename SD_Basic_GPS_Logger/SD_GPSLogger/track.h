@@ -0,0 +1,155 @@
+// Compact binary GPS track format
+//
+// Text NMEA logging spends about 70 bytes per fix. This packs each RMC fix
+// into a fixed-point record (time, lat, lon, speed) and stores only the
+// change from the previous fix as zigzag varints, which is typically
+// 4-6 bytes per fix at 1 Hz.
+//
+// File layout:
+//   "GTRK" <version> <session>           file header (6 bytes)
+//   then a stream of records:
+//   <dt> <dlat> <dlon> <dspeed>          delta record, dt >= 1 seconds
+//   0x00 0xA5 <session> <time> <lat> <lon> <speed> <crc>
+//                                        keyframe, absolute values
+//
+// All fields but session and crc are LEB128 varints; deltas and lat/lon
+// are zigzag-encoded so small negative numbers stay small. A keyframe
+// starts every file and is repeated every TRACK_KEY_INTERVAL fixes (or
+// after a gap that won't fit a delta) so a decoder can resync after a
+// damaged sector.
+//
+// session is a byte that differs from one file to the next, and crc is a
+// CRC-8 of the keyframe from session to speed. Sectors left over from an
+// older file, or random data, fail one or the other, so a decoder can
+// tell where this file's track really ends rather than decoding whatever
+// follows it on the card as more fixes. Delta records have no check of
+// their own: what follows a damaged sector or the end of the track is
+// decoded as fixes until the next keyframe, and no further.
+//
+// Units:
+//   time   seconds since 2000-01-01 00:00:00 UTC
+//   lat    1/10000 arc-minute, + north (NMEA's native ddmm.mmmm resolution)
+//   lon    1/10000 arc-minute, + east
+//   speed  1/100 knot
+//
+// track2gpx.py (one directory up) decodes these files to GPX or CSV.
+
+#ifndef _TRACK_H_
+#define _TRACK_H_
+
+#include <stdint.h>
+#include <string.h>
+#include "nmea.h"
+
+#define TRACK_VERSION      2
+#define TRACK_KEY_INTERVAL 256 // Fixes between keyframes
+#define TRACK_MAX_RECORD   24  // Worst-case bytes per encoded record
+
+typedef struct {
+  uint32_t time;  // Seconds since 2000-01-01
+  int32_t  lat;   // 1/10000 arc-minute
+  int32_t  lon;   // 1/10000 arc-minute
+  uint16_t speed; // 1/100 knot
+} TrackFix;
+
+// Write the 6-byte file header to 'out', return its length
+static inline uint8_t trackHeader(uint8_t *out, uint8_t session) {
+  memcpy(out, "GTRK", 4);
+  out[4] = TRACK_VERSION;
+  out[5] = session;
+  return 6;
+}
+
+// CRC-8, polynomial 0x07
+static inline uint8_t trackCrc(const uint8_t *data, uint8_t len) {
+  uint8_t crc = 0;
+  while (len--) {
+    crc ^= *data++;
+    for (uint8_t b = 0; b < 8; b++) crc = (crc & 0x80) ? (crc << 1) ^ 0x07 : crc << 1;
+  }
+  return crc;
+}
+
+static inline uint8_t trackPutVarint(uint8_t *out, uint32_t v) {
+  uint8_t n = 0;
+  while (v >= 0x80) {
+    out[n++] = (v & 0x7F) | 0x80;
+    v >>= 7;
+  }
+  out[n++] = v;
+  return n;
+}
+
+static inline uint32_t trackZigzag(int32_t v) {
+  return ((uint32_t)v << 1) ^ (uint32_t)(v >> 31);
+}
+
+class TrackEncoder {
+ public:
+  TrackEncoder() : session(0), count(0) { }
+
+  // Session byte for this file's keyframes (the one in its header)
+  void begin(uint8_t s) { session = s; count = 0; }
+
+  // Force the next fix to be written as a keyframe
+  void reset() { count = 0; }
+
+  // Encode one fix into 'out' (at least TRACK_MAX_RECORD bytes),
+  // returning the number of bytes used.
+  uint8_t encode(const TrackFix &fix, uint8_t *out) {
+    uint8_t n = 0;
+    int32_t dt = fix.time - prev.time;
+    if ((count == 0) || (dt < 1) || (dt > 0xFFFF)) {
+      out[n++] = 0x00;
+      out[n++] = 0xA5;
+      out[n++] = session;
+      n += trackPutVarint(&out[n], fix.time);
+      n += trackPutVarint(&out[n], trackZigzag(fix.lat));
+      n += trackPutVarint(&out[n], trackZigzag(fix.lon));
+      n += trackPutVarint(&out[n], fix.speed);
+      out[n] = trackCrc(&out[2], n - 2);
+      n++;
+    } else {
+      n += trackPutVarint(&out[n], dt);
+      n += trackPutVarint(&out[n], trackZigzag(fix.lat - prev.lat));
+      n += trackPutVarint(&out[n], trackZigzag(fix.lon - prev.lon));
+      n += trackPutVarint(&out[n], trackZigzag((int32_t)fix.speed - prev.speed));
+    }
+    prev = fix;
+    if (++count >= TRACK_KEY_INTERVAL) count = 0;
+    return n;
+  }
+
+ private:
+  TrackFix prev;
+  uint8_t  session;
+  uint16_t count; // Fixes since last keyframe
+};
+
+// RMC conversion -----------------------------------------------------------
+
+// Days from 2000-01-01 to the given date (year 2000-2099)
+static inline uint16_t trackDays(uint8_t yy, uint8_t mm, uint8_t dd) {
+  static const uint16_t monthDays[] = {
+    0, 31, 59, 90, 120, 151, 181, 212, 243, 273, 304, 334 };
+  if ((mm < 1) || (mm > 12)) return 0;
+  uint16_t days = yy * 365 + (yy + 3) / 4 + monthDays[mm - 1] + dd - 1;
+  if ((mm > 2) && !(yy & 3)) days++; // Past Feb 29 in a leap year
+  return days;
+}
+
+// Convert a parsed RMC sentence (see nmea.h) to a track fix.
+// Returns false if the receiver doesn't have a fix or the date is unset.
+static inline bool trackFromRMC(const NmeaRMC &rmc, TrackFix *fix) {
+  if (!rmc.fix || !rmc.date) return false;
+  uint32_t hms = rmc.time / 1000;
+  fix->time  = (uint32_t)trackDays(rmc.date % 100, (rmc.date / 100) % 100,
+                 rmc.date / 10000) * 86400UL +
+               (hms / 10000) * 3600UL + ((hms / 100) % 100) * 60 + hms % 100;
+  fix->lat   = rmc.lat;   // Same units as NmeaRMC
+  fix->lon   = rmc.lon;
+  fix->speed = rmc.speed;
+  return true;
+}
+
+#endif // _TRACK_H_
@@ -0,0 +1,184 @@
+// Host test for SD_GPSLogger/SectorLog.h. Runs on a PC, not the board.
+//
+// The SD card is stood in for by a file on the PC plus a count of what a
+// real card would have to program: every sector a write touches (a write
+// that covers only part of a sector is a read-modify-write), and on each
+// sync the directory entry and, when clusters were added or freed, a FAT
+// sector. An hour of 1 Hz RMC sentences is logged the old way (write and
+// flush every sentence) and through SectorLog, and the counts compared.
+//
+// It also pulls the power at random points: the file as the directory
+// entry describes it must then hold only logged data -- a prefix of what
+// was sent, never the stale contents the card held before.
+//
+//   g++ -O2 -o sectorlog_test sectorlog_test.cpp
+//   ./sectorlog_test
+//
+// Exits nonzero on failure.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+#include "SD_GPSLogger/SectorLog.h"
+
+#define CLUSTER_SIZE (64 * SECTOR_SIZE)   // 32K, usual for 4-32GB cards
+#define CARD_SIZE    (1UL << 20)
+
+// SdFat File stand-in: the card's contents live in a temporary file
+class CardFile {
+ public:
+  CardFile() {
+    img = tmpfile();
+    std::vector<uint8_t> stale(CARD_SIZE, 'X');   // an old file's leftovers
+    fwrite(&stale[0], 1, stale.size(), img);
+    pos = size = dirSize = 0;
+    clusters = dirClusters = 0;
+    programs = partials = dirty = 0;
+  }
+  ~CardFile() { fclose(img); }
+
+  bool preAllocate(uint32_t length) {
+    size = length;
+    clusters = (length + CLUSTER_SIZE - 1) / CLUSTER_SIZE;
+    dirty = 1;
+    return sync();
+  }
+
+  size_t write(const void *buf, size_t n) {
+    if (pos + n > CARD_SIZE) return 0;
+    fseek(img, pos, SEEK_SET);
+    fwrite(buf, 1, n, img);
+    for (uint32_t s = pos / SECTOR_SIZE; s <= (pos + n - 1) / SECTOR_SIZE; s++) {
+      programs++;
+      if (s * SECTOR_SIZE < pos || (s + 1) * SECTOR_SIZE > pos + n) partials++;
+    }
+    pos += n;
+    if (pos > size) size = pos;
+    while ((uint64_t)clusters * CLUSTER_SIZE < size) clusters++;
+    dirty = 1;
+    return n;
+  }
+
+  bool truncate(uint32_t length) {
+    if (length > size) return false;
+    if (length < size) {
+      size = length;
+      clusters = (length + CLUSTER_SIZE - 1) / CLUSTER_SIZE;
+      dirty = 1;
+    }
+    if (pos > size) pos = size;
+    return true;
+  }
+
+  bool sync() {
+    if (!dirty) return true;
+    programs++;                               // directory entry
+    if (clusters != dirClusters) programs++;  // FAT
+    dirSize = size;
+    dirClusters = clusters;
+    dirty = 0;
+    return true;
+  }
+  bool flush() { return sync(); }
+
+  // What a reader would find if the power went now
+  std::vector<uint8_t> contents() {
+    std::vector<uint8_t> v(dirSize);
+    fseek(img, 0, SEEK_SET);
+    if (dirSize) fread(&v[0], 1, dirSize, img);
+    return v;
+  }
+
+  uint32_t programs, partials;
+
+ private:
+  FILE    *img;
+  uint32_t pos, size, dirSize;  // dirSize is what the directory entry says
+  uint32_t clusters, dirClusters;
+  uint8_t  dirty;
+};
+
+static int failures = 0;
+
+static void check(bool ok, const char *what) {
+  if (!ok) { printf("FAIL: %s\n", what); failures++; }
+}
+
+// One RMC sentence a second, about 70 bytes each
+static int sentence(char *buf, int sec) {
+  return sprintf(buf, "$GPRMC,%02d%02d%02d.000,A,4042.%04d,N,07400.%04d,W,0.%02d,%03d.12,190326,,,A*5C\r\n",
+                 sec / 3600 % 24, sec / 60 % 60, sec % 60, (sec * 7) % 10000,
+                 (sec * 13) % 10000, sec % 100, sec % 360);
+}
+
+// True if what's on the card is exactly the first part of what was logged
+static bool isPrefix(CardFile &card, const std::vector<uint8_t> &sent) {
+  std::vector<uint8_t> got = card.contents();
+  return got.size() <= sent.size() &&
+         (got.empty() || !memcmp(&got[0], &sent[0], got.size()));
+}
+
+int main(void) {
+  const int seconds = 3600, syncEvery = 30;
+  char line[100];
+
+  // Before: write and flush each sentence
+  CardFile before;
+  uint32_t bytes = 0;
+  for (int t = 0; t < seconds; t++) {
+    int n = sentence(line, t);
+    before.write(line, n);
+    before.flush();
+    bytes += n;
+  }
+  printf("write+flush per line: %6u bytes, %5u sectors programmed (%u partial), WA %.1f\n",
+         bytes, before.programs, before.partials,
+         (double)before.programs * SECTOR_SIZE / bytes);
+
+  // After: SectorLog on a pre-allocated file, syncing every 30 s
+  CardFile after;
+  static SectorLog<CardFile> log;
+  std::vector<uint8_t> sent;
+  after.preAllocate(CARD_SIZE);
+  log.begin(&after);
+  check(log.sync() && after.contents().empty(), "first sync trims the preallocation");
+  for (int t = 0; t < seconds; t++) {
+    int n = sentence(line, t);
+    check(log.write((uint8_t *)line, n), "write");
+    sent.insert(sent.end(), line, line + n);
+    if (t % syncEvery == syncEvery - 1) check(log.sync(), "sync");
+    check(isPrefix(after, sent), "card holds only logged data");
+  }
+  check(log.sync(), "final sync");
+  check(after.contents() == sent, "all data on the card after the last sync");
+  check(log.bytesLogged == bytes, "bytes logged");
+  printf("SectorLog, %2d s sync:  %6u bytes, %5u sectors programmed (%u partial), WA %.1f\n",
+         syncEvery, log.bytesLogged, after.programs, after.partials,
+         (double)after.programs * SECTOR_SIZE / log.bytesLogged);
+  check(after.programs * 10 < before.programs, "at least 10x fewer sectors programmed");
+
+  // Power pulled at random points: never anything but logged data, and at
+  // most what came in since the last sync missing
+  srand(28);
+  for (int trial = 0; trial < 200; trial++) {
+    CardFile card;
+    static SectorLog<CardFile> l;
+    int stop = rand() % seconds;
+    size_t atSync = 0;
+    sent.clear();
+    card.preAllocate(CARD_SIZE);
+    l.begin(&card);
+    l.sync();
+    for (int t = 0; t < stop; t++) {
+      int n = sentence(line, t);
+      l.write((uint8_t *)line, n);
+      sent.insert(sent.end(), line, line + n);
+      if (rand() % syncEvery == 0) { l.sync(); atSync = sent.size(); }
+    }
+    check(isPrefix(card, sent) && card.contents().size() >= atSync,
+          "power cut leaves only logged data");
+  }
+
+  return failures ? 1 : 0;
+}
@@ -0,0 +1,162 @@
+"""
+Decode binary GPS track files (GPSLOGxx.TRK) written by SD_GPSLogger with
+LOG_BINARY set to 1, and export them as GPX or CSV.
+
+Usage:
+    python3 track2gpx.py GPSLOG00.TRK > track.gpx
+    python3 track2gpx.py --csv GPSLOG00.TRK > track.csv
+
+See SD_GPSLogger/track.h for a description of the format.
+"""
+
+import sys
+from datetime import datetime, timedelta
+
+EPOCH = datetime(2000, 1, 1)
+KEYFRAME = b'\x00\xa5'
+VERSION = 2         # TRACK_VERSION in track.h
+HEADER_LEN = 6
+
+
+class ForeignData(Exception):
+    """A keyframe from another file, or not a keyframe at all."""
+
+
+def read_varint(data, pos):
+    """Return (value, new position) for the LEB128 varint at data[pos]."""
+    value = 0
+    shift = 0
+    while True:
+        if pos >= len(data):
+            raise EOFError
+        byte = data[pos]
+        pos += 1
+        value |= (byte & 0x7F) << shift
+        if not byte & 0x80:
+            return value, pos
+        shift += 7
+        if shift > 35:
+            raise ValueError('varint too long')
+
+
+def unzigzag(value):
+    """Undo zigzag encoding of a signed integer."""
+    return (value >> 1) ^ -(value & 1)
+
+
+def crc8(data):
+    """CRC-8, polynomial 0x07, as trackCrc() in track.h."""
+    crc = 0
+    for byte in data:
+        crc ^= byte
+        for _ in range(8):
+            crc = ((crc << 1) ^ 0x07 if crc & 0x80 else crc << 1) & 0xFF
+    return crc
+
+
+def read_keyframe(data, pos, session):
+    """Return (fix, new position) for the keyframe at data[pos].
+
+    Raises ForeignData if it isn't one of this file's keyframes (wrong
+    session or CRC): from there on the data is left over from something else.
+    """
+    pos += 2
+    if pos >= len(data):
+        raise EOFError
+    if data[pos] != session:
+        raise ForeignData
+    checked = pos
+    time, pos = read_varint(data, pos + 1)
+    lat, pos = read_varint(data, pos)
+    lon, pos = read_varint(data, pos)
+    speed, pos = read_varint(data, pos)
+    if pos >= len(data):
+        raise EOFError
+    if crc8(data[checked:pos]) != data[pos]:
+        raise ForeignData
+    return (time, unzigzag(lat), unzigzag(lon), speed), pos + 1
+
+
+def read_delta(data, pos, prev):
+    """Return (fix, new position) for the delta record at data[pos]."""
+    delta_t, pos = read_varint(data, pos)
+    if not 1 <= delta_t <= 0xFFFF:  # Never written as a delta
+        raise ValueError
+    dlat, pos = read_varint(data, pos)
+    dlon, pos = read_varint(data, pos)
+    dspeed, pos = read_varint(data, pos)
+    return (prev[0] + delta_t, prev[1] + unzigzag(dlat),
+            prev[2] + unzigzag(dlon), prev[3] + unzigzag(dspeed)), pos
+
+
+def decode(data):
+    """Yield (time, lat, lon, speed) tuples in native units from a file."""
+    if data[:4] != b'GTRK' or len(data) < HEADER_LEN:
+        raise ValueError('not a GTRK track file')
+    if data[4] != VERSION:
+        raise ValueError('unsupported track version %d' % data[4])
+    session, pos = data[5], HEADER_LEN
+    marker = KEYFRAME + bytes([session])
+    prev = None
+    while pos < len(data):
+        start = pos
+        try:
+            if data[pos:pos + 2] == KEYFRAME:
+                prev, pos = read_keyframe(data, pos, session)
+            elif prev is None:
+                raise ValueError
+            else:
+                prev, pos = read_delta(data, pos, prev)
+        except (EOFError, ForeignData):
+            return
+        except ValueError:
+            # Damaged: resync at the next keyframe
+            pos = data.find(marker, start + 1)
+            if pos < 0:
+                return
+            prev = None
+            continue
+        yield prev
+
+
+def to_degrees(value):
+    """1/10000 arc-minute units to decimal degrees."""
+    return value / 600000.0
+
+
+def main():
+    """Command-line entry point."""
+    args = sys.argv[1:]
+    csv = '--csv' in args
+    args = [a for a in args if a != '--csv']
+    if len(args) != 1:
+        sys.exit(__doc__)
+    with open(args[0], 'rb') as infile:
+        data = infile.read()
+    fixes = list(decode(data))
+
+    out = sys.stdout
+    if csv:
+        out.write('time,lat,lon,speed_knots\n')
+        for time, lat, lon, speed in fixes:
+            out.write('%s,%.7f,%.7f,%.2f\n' % (
+                (EPOCH + timedelta(seconds=time)).isoformat() + 'Z',
+                to_degrees(lat), to_degrees(lon), speed / 100.0))
+    else:
+        out.write('<?xml version="1.0" encoding="UTF-8"?>\n'
+                  '<gpx version="1.0" creator="track2gpx.py" '
+                  'xmlns="http://www.topografix.com/GPX/1/0">\n'
+                  '<trk><trkseg>\n')
+        for time, lat, lon, speed in fixes:
+            out.write('<trkpt lat="%.7f" lon="%.7f"><time>%s</time>'
+                      '<speed>%.2f</speed></trkpt>\n' % (
+                          to_degrees(lat), to_degrees(lon),
+                          (EPOCH + timedelta(seconds=time)).isoformat() + 'Z',
+                          speed * 0.514444 / 100.0))  # GPX speed is m/s
+        out.write('</trkseg></trk>\n</gpx>\n')
+    sys.stderr.write('%d fixes, %.2f bytes/fix\n' % (
+        len(fixes), (len(data) - HEADER_LEN) / max(len(fixes), 1)))
+
+
+if __name__ == '__main__':
+    main()
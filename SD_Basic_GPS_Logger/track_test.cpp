@@ -0,0 +1,166 @@
+// Host round-trip test for SD_GPSLogger/track.h and track2gpx.py. Runs on a
+// PC, not the board.
+//
+// A few hours of made-up 1 Hz fixes -- both hemispheres, standing still,
+// dropouts, a clock step backwards and a gap too long for a delta -- are
+// encoded with TrackEncoder into a file laid out as the logger writes it.
+// track2gpx.py --csv decodes it and every row must come back exactly as
+// encoded. Then the file is damaged the ways a card does it. Delta records
+// carry no check of their own, so after a garbled sector the decoder can
+// print made-up fixes until the next keyframe, but from there on it must be
+// exact again. An older file's track left after the end may likewise add
+// made-up fixes only up to its first keyframe, where the session byte
+// stops the decoder.
+//
+//   g++ -O2 -o track_test track_test.cpp
+//   ./track_test
+//
+// Needs python3 on the path. Exits nonzero on failure.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <vector>
+#include "SD_GPSLogger/track.h"
+
+static int failures = 0;
+
+static void check(bool ok, const char *what) {
+  if (!ok && (failures++ < 10)) printf("FAIL: %s\n", what);
+}
+
+static bool sameFix(const TrackFix &a, const TrackFix &b) {
+  return (a.time == b.time) && (a.lat == b.lat) && (a.lon == b.lon) &&
+         (a.speed == b.speed);
+}
+
+// A drive wandering about from (lat, lon), 'n' fixes long
+static std::vector<TrackFix> makeTrack(int32_t lat, int32_t lon, uint32_t time, int n) {
+  std::vector<TrackFix> fixes;
+  int32_t  vlat = 40, vlon = -25;
+  uint16_t speed = 0;
+  for (int i = 0; i < n; i++) {
+    int r = rand() % 1000;
+    if (r < 5) {
+      time += 2 + rand() % 30;         // Lost the fix for a while
+    } else if (r < 6) {
+      time += 70000 + rand() % 10000;  // Too long for a delta
+    } else if (r < 7) {
+      time -= 5;                       // Clock stepped back
+    } else {
+      time++;
+    }
+    if (rand() % 100 < 20) speed = 0;  // Stopped at the lights
+    else speed = (uint16_t)(abs(vlat) + abs(vlon)) * 3 + rand() % 50;
+    vlat += rand() % 11 - 5;
+    vlon += rand() % 11 - 5;
+    if (speed) {
+      lat += vlat;
+      lon += vlon;
+    }
+    TrackFix f = { time, lat, lon, speed };
+    fixes.push_back(f);
+  }
+  return fixes;
+}
+
+// The file as the logger writes it, and where each fix's record starts
+static std::vector<uint8_t> encodeTrack(const std::vector<TrackFix> &fixes, uint8_t session,
+                                        std::vector<size_t> *starts = NULL) {
+  std::vector<uint8_t> out(6);
+  TrackEncoder enc;
+  uint8_t record[TRACK_MAX_RECORD];
+  trackHeader(&out[0], session);
+  enc.begin(session);
+  for (size_t i = 0; i < fixes.size(); i++) {
+    uint8_t n = enc.encode(fixes[i], record);
+    if (starts) starts->push_back(out.size());
+    out.insert(out.end(), record, record + n);
+  }
+  return out;
+}
+
+// Whether got[from..from+n) is fixes[at..at+n)
+static bool sameRun(const std::vector<TrackFix> &got, size_t from,
+                    const std::vector<TrackFix> &fixes, size_t at, size_t n) {
+  if ((from + n > got.size()) || (at + n > fixes.size())) return false;
+  for (size_t i = 0; i < n; i++) {
+    if (!sameFix(got[from + i], fixes[at + i])) return false;
+  }
+  return true;
+}
+
+// Run track2gpx.py --csv on 'data' and read the fixes back in track.h units
+static std::vector<TrackFix> decode(const std::vector<uint8_t> &data) {
+  std::vector<TrackFix> fixes;
+  FILE *f = fopen("track_test.trk", "wb");
+  fwrite(&data[0], 1, data.size(), f);
+  fclose(f);
+  FILE *p = popen("python3 track2gpx.py --csv track_test.trk 2>/dev/null", "r");
+  if (!p) return fixes;
+  char line[128];
+  while (fgets(line, sizeof(line), p)) {
+    int    yy, mm, dd, h, m, s;
+    double lat, lon, knots;
+    if (sscanf(line, "%d-%d-%dT%d:%d:%dZ,%lf,%lf,%lf", &yy, &mm, &dd, &h, &m, &s,
+               &lat, &lon, &knots) != 9) continue;
+    TrackFix fix;
+    fix.time  = trackDays(yy - 2000, mm, dd) * 86400UL + h * 3600UL + m * 60 + s;
+    fix.lat   = (int32_t)lround(lat * 600000.0);
+    fix.lon   = (int32_t)lround(lon * 600000.0);
+    fix.speed = (uint16_t)lround(knots * 100.0);
+    fixes.push_back(fix);
+  }
+  pclose(p);
+  remove("track_test.trk");
+  return fixes;
+}
+
+int main(void) {
+  srand(1);
+  // 2019-06-01, around 40.7N 74.0W, and a second one south-east
+  std::vector<TrackFix> fixes = makeTrack(24420000, -44400000, 612662400UL, 3 * 3600);
+  std::vector<TrackFix> south = makeTrack(-20280000, 9060000, 613000000UL, 3600);
+  fixes.insert(fixes.end(), south.begin(), south.end());
+  std::vector<size_t>  starts;
+  std::vector<uint8_t> file = encodeTrack(fixes, 7, &starts);
+
+  std::vector<TrackFix> got = decode(file);
+  check((got.size() == fixes.size()) && sameRun(got, 0, fixes, 0, fixes.size()),
+        "every fix comes back as encoded");
+  printf("%u fixes in %u bytes, %.2f bytes/fix\n", (unsigned)fixes.size(),
+         (unsigned)file.size(), (file.size() - 6.0) / fixes.size());
+
+  // A garbled sector partway in: fixes before it are fine, fixes from the
+  // first keyframe after it are fine, and in between no more than a
+  // sector's worth of records can be made up
+  std::vector<uint8_t> bad = file;
+  size_t lo = 40 * 512, hi = 41 * 512, first = 0, next = 0;
+  for (size_t i = lo; i < hi; i++) bad[i] = rand();
+  while (starts[first + 1] <= lo) first++;
+  next = first + 1;
+  while ((starts[next] < hi) || (file[starts[next]] != 0x00)) next++;
+  got = decode(bad);
+  size_t tail = fixes.size() - next;
+  check(sameRun(got, 0, fixes, 0, first), "fixes before a garbled sector");
+  check(sameRun(got, got.size() - tail, fixes, next, tail),
+        "decoding is exact again from the next keyframe");
+  check(got.size() - first - tail <= (next - first) + 512 / 4,
+        "made-up fixes only up to the next keyframe");
+  printf("garbled sector: lost %u fixes, %u printed wrong\n",
+         (unsigned)(next - first), (unsigned)(got.size() - first - tail));
+
+  // Last time this card held a longer track from session 6
+  std::vector<uint8_t> old = encodeTrack(makeTrack(24420000, -44400000, 600000000UL, 4 * 3600), 6);
+  std::vector<uint8_t> card = file;
+  card.insert(card.end(), old.begin() + file.size(), old.end());
+  got = decode(card);
+  check(sameRun(got, 0, fixes, 0, fixes.size()), "this track before an older one");
+  check(got.size() - fixes.size() <= TRACK_KEY_INTERVAL,
+        "an older track stops the decoder at its first keyframe");
+  printf("older track after the end: %u of its fixes decoded\n",
+         (unsigned)(got.size() - fixes.size()));
+
+  printf("%s\n", failures ? "FAILED" : "every track decodes as encoded");
+  return failures ? 1 : 0;
+}
@@ -0,0 +1,197 @@
+/*
+PICCOLO is a tiny Arduino-based audio visualizer.  This version replaces
+elm-chan's AVR-only ffft library with the portable spectrum.h engine, so
+the FFT size and column count are adjustable and it also runs on M0/M4
+boards (using CMSIS-DSP there when available).
+Hardware requirements:
+ - Most Arduino or Arduino-compatible boards (ATmega 328P or better),
+   or SAMD21/SAMD51-based boards.
+ - Adafruit Bicolor LED Matrix with I2C Backpack (ID: 902)
+ - Adafruit Electret Microphone Amplifier (ID: 1063)
+ - Optional: battery for portable use (else power through USB)
+Connections:
+ - 3.3V to mic amp+ and Arduino AREF pin <-- important! (AVR only)
+ - GND to mic amp-
+ - Analog pin 0 to mic amp output
+ - +5V, GND, SDA (or analog 4) and SCL (analog 5) to I2C Matrix backpack
+Written by Adafruit Industries.  Distributed under the BSD license --
+see license.txt for more information.  This paragraph must be included
+in any redistribution.
+*/
+
+#include <Wire.h>
+#include <Adafruit_GFX.h>
+#include <Adafruit_LEDBackpack.h>
+#include "spectrum.h"
+
+// FFT size may be any power of two from 64 to 2048.  128 is the most an
+// ATmega328P has RAM for; M0/M4 boards can go much higher.  Frequency
+// resolution is (sample rate / FFT_N) Hz per bin.
+#ifdef __AVR__
+ #define FFT_N 128
+#else
+ #define FFT_N 512
+#endif
+#define COLS         8    // Output columns (8..64); matrix shows 8
+#define SAMPLE_RATE  9615 // Hz; matches the AVR free-run ADC rate
+#define NOISE_FLOOR  32   // Subtracted from each column
+
+// Microphone connects to Analog Pin 0.  Corresponding ADC channel number
+// varies among boards...it's ADC0 on Uno and Mega, ADC7 on Leonardo.
+// Other boards may require different settings; refer to datasheet.
+#ifdef __AVR_ATmega32U4__
+ #define ADC_CHANNEL 7
+#else
+ #define ADC_CHANNEL 0
+#endif
+
+Spectrum<FFT_N, COLS> spectrum;
+volatile uint16_t     samplePos = 0; // Buffer position counter
+
+byte
+  peak[COLS],   // Peak level of each column; used for falling dots
+  dotCount = 0, // Frame counter for delaying dot-falling speed
+  colCount = 0; // Frame counter for storing past column data
+int
+  col[COLS][10],   // Column levels for the prior 10 frames
+  minLvlAvg[COLS], // For dynamic adjustment of low & high ends of graph,
+  maxLvlAvg[COLS]; // pseudo rolling averages for the prior few frames.
+
+Adafruit_BicolorMatrix matrix = Adafruit_BicolorMatrix();
+
+void setup() {
+  uint8_t i;
+
+  memset(peak, 0, sizeof(peak));
+  memset(col , 0, sizeof(col));
+
+  for(i=0; i<COLS; i++) {
+    minLvlAvg[i] = 0;
+    maxLvlAvg[i] = 512;
+  }
+
+  spectrum.begin();
+  matrix.begin(0x70);
+
+#ifdef __AVR__
+  // Init ADC free-run mode; f = ( 16MHz/prescaler ) / 13 cycles/conversion
+  ADMUX  = ADC_CHANNEL; // Channel sel, right-adj, use AREF pin
+  ADCSRA = _BV(ADEN)  | // ADC enable
+           _BV(ADSC)  | // ADC start
+           _BV(ADATE) | // Auto trigger
+           _BV(ADIE)  | // Interrupt enable
+           _BV(ADPS2) | _BV(ADPS1) | _BV(ADPS0); // 128:1 / 13 = 9615 Hz
+  ADCSRB = 0;                // Free run mode, no high MUX bit
+  DIDR0  = 1 << ADC_CHANNEL; // Turn off digital input for ADC pin
+  TIMSK0 = 0;                // Timer0 off
+
+  sei(); // Enable interrupts
+#endif
+}
+
+// Convert a 10-bit ADC reading to a signed FFT input sample
+static inline int16_t toSample(int16_t sample) {
+  static const int16_t noiseThreshold = 4;
+  return ((sample > (512-noiseThreshold)) &&
+          (sample < (512+noiseThreshold))) ? 0 :
+    (sample - 512) << 5; // -16384 to +16352
+}
+
+#ifndef __AVR__
+// No free-running ADC interrupt here; pace analogRead() with micros()
+static void captureSamples(void) {
+  uint32_t t = micros();
+  for(samplePos=0; samplePos<FFT_N; samplePos++) {
+    while((micros() - t) < (1000000UL / SAMPLE_RATE));
+    t += 1000000UL / SAMPLE_RATE;
+    spectrum.samples[samplePos] = toSample(analogRead(A0));
+  }
+}
+#endif
+
+void loop() {
+  uint8_t  i, x, c;
+  uint16_t minLvl, maxLvl;
+  int      level, y;
+
+#ifdef __AVR__
+  while(ADCSRA & _BV(ADIE)); // Wait for audio sampling to finish
+  spectrum.process();        // Window, FFT and fold to columns
+  samplePos = 0;             // Reset sample counter
+  ADCSRA |= _BV(ADIE);       // Resume sampling interrupt
+#else
+  captureSamples();
+  spectrum.process();
+#endif
+
+  // Fill background w/colors, then idle parts of columns will erase
+  matrix.fillRect(0, 0, 8, 3, LED_RED);    // Upper section
+  matrix.fillRect(0, 3, 8, 2, LED_YELLOW); // Mid
+  matrix.fillRect(0, 5, 8, 3, LED_GREEN);  // Lower section
+
+  for(x=0; x<COLS; x++) {
+    col[x][colCount] = (spectrum.columns[x] > NOISE_FLOOR) ?
+      spectrum.columns[x] - NOISE_FLOOR : 0;
+    minLvl = maxLvl = col[x][0];
+    for(i=1; i<10; i++) { // Get range of prior 10 frames
+      if(col[x][i] < minLvl)      minLvl = col[x][i];
+      else if(col[x][i] > maxLvl) maxLvl = col[x][i];
+    }
+    // minLvl and maxLvl indicate the extents of the FFT output, used
+    // for vertically scaling the output graph (so it looks interesting
+    // regardless of volume level).  If they're too close together though
+    // (e.g. at very low volume levels) the graph becomes super coarse
+    // and 'jumpy'...so keep some minimum distance between them (this
+    // also lets the graph go to zero when no sound is playing):
+    if((maxLvl - minLvl) < 8) maxLvl = minLvl + 8;
+    minLvlAvg[x] = (minLvlAvg[x] * 7 + minLvl) >> 3; // Dampen min/max levels
+    maxLvlAvg[x] = (maxLvlAvg[x] * 7 + maxLvl) >> 3; // (fake rolling average)
+
+    // Second fixed-point scale based on dynamic min/max levels:
+    level = 10L * (col[x][colCount] - minLvlAvg[x]) /
+      (long)(maxLvlAvg[x] - minLvlAvg[x]);
+
+    // Clip output and convert to byte:
+    if(level < 0L)      c = 0;
+    else if(level > 10) c = 10; // Allow dot to go a couple pixels off top
+    else                c = (uint8_t)level;
+
+    if(c > peak[x]) peak[x] = c; // Keep dot on top
+
+    if(x >= 8) continue; // Matrix only shows the first 8 columns
+
+    if(peak[x] <= 0) { // Empty column?
+      matrix.drawLine(x, 0, x, 7, LED_OFF);
+      continue;
+    } else if(c < 8) { // Partial column?
+      matrix.drawLine(x, 0, x, 7 - c, LED_OFF);
+    }
+
+    // The 'peak' dot color varies, but doesn't necessarily match
+    // the three screen regions...yellow has a little extra influence.
+    y = 8 - peak[x];
+    if(y < 2)      matrix.drawPixel(x, y, LED_RED);
+    else if(y < 6) matrix.drawPixel(x, y, LED_YELLOW);
+    else           matrix.drawPixel(x, y, LED_GREEN);
+  }
+
+  matrix.writeDisplay();
+
+  // Every third frame, make the peak pixels drop by 1:
+  if(++dotCount >= 3) {
+    dotCount = 0;
+    for(x=0; x<COLS; x++) {
+      if(peak[x] > 0) peak[x]--;
+    }
+  }
+
+  if(++colCount >= 10) colCount = 0;
+}
+
+#ifdef __AVR__
+ISR(ADC_vect) { // Audio-sampling interrupt
+  spectrum.samples[samplePos] = toSample(ADC); // 0-1023 in
+
+  if(++samplePos >= FFT_N) ADCSRA &= ~_BV(ADIE); // Buffer full, interrupt off
+}
+#endif
@@ -0,0 +1,79 @@
+// Host test for Piccolo_Scalable/spectrum.h. Runs on a PC, not the board.
+//
+// For each FFT size it feeds windowed test signals (two sines plus noise)
+// through Spectrum::process() and compares every bin with a
+// double-precision DFT of the same windowed samples, checks the column
+// map covers the bins in order, and times a frame.
+//
+//   g++ -O2 -o spectrum_test spectrum_test.cpp
+//   ./spectrum_test
+//
+// Exits nonzero if any bin is off by more than MAX_ERROR.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "Piccolo_Scalable/spectrum.h"
+
+#define MAX_ERROR 16   // LSBs, against peaks of about 2000
+
+static int failures = 0;
+
+template <uint16_t N, uint8_t C> static void check(void) {
+  static Spectrum<N, C> s;
+  static double x[N];
+  double maxErr = 0, peak = 0;
+
+  s.begin();
+  srand(N);
+  for(int trial = 0; trial < 20; trial++) {
+    for(int i = 0; i < N; i++) {
+      double v = 8000 * sin(2 * M_PI * (trial * 3 + 5.3) * i / N) +
+                 3000 * sin(2 * M_PI * (N / 5.0 + trial) * i / N) +
+                 (rand() % 2000 - 1000);
+      s.samples[i] = (int16_t)v;
+      double w = 0.5 - 0.5 * cos(2 * M_PI * (i < N / 2 ? i : N - 1 - i) / (N - 1));
+      x[i] = s.samples[i] * w;
+    }
+    s.process();
+    for(int k = 0; k < N / 2; k++) {
+      double re = 0, im = 0;
+      for(int n = 0; n < N; n++) {
+        re += x[n] * cos(2 * M_PI * k * n / N);
+        im -= x[n] * sin(2 * M_PI * k * n / N);
+      }
+      double m = sqrt(re * re + im * im) / N;
+      if(fabs(m - s.bins[k]) > maxErr) maxErr = fabs(m - s.bins[k]);
+      if(m > peak) peak = m;
+    }
+  }
+
+  bool mapOk = true;                         // columns tile the bins in order
+  for(int c = 0; c < C; c++) {
+    if(s.lastBin(c) <= s.firstBin(c)) mapOk = false;
+    if(c && s.firstBin(c) < s.lastBin(c - 1)) mapOk = false;
+  }
+
+  const int frames = 2000;
+  clock_t t0 = clock();
+  for(int f = 0; f < frames; f++) {
+    for(int i = 0; i < N; i++) s.samples[i] = (i * 37 + f) % 4000 - 2000;
+    s.process();
+  }
+  double us = (double)(clock() - t0) * 1e6 / CLOCKS_PER_SEC / frames;
+
+  bool ok = mapOk && (maxErr <= MAX_ERROR);
+  printf("N=%4d columns=%2d  max error %4.1f (peak %4.0f)  %7.2f us/frame  %s\n",
+         N, C, maxErr, peak, us, ok ? "ok" : (mapOk ? "FAIL" : "FAIL (column map)"));
+  if(!ok) failures++;
+}
+
+int main(void) {
+  check<64, 8>();
+  check<128, 8>();
+  check<256, 16>();
+  check<512, 32>();
+  check<1024, 64>();
+  check<2048, 64>();
+  return failures ? 1 : 0;
+}
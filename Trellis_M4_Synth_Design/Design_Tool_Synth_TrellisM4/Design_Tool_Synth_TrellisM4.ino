@@ -4,11 +4,35 @@
 // row 1 square, hard attack, moderate release, flanger effect
 // row 2 sawtooth, hard attack, soft release, chorus effect
 // row 3 triangle, medium attack, long release ADSR, multi tap delay
+//
+// each row has VOICES_PER_ROW voices, so chords work; see VoiceAlloc.h for
+// which voice a key gets when they're all busy
 
 #include <Audio.h>
 #include <Adafruit_NeoTrellisM4.h>
+#include "VoiceAlloc.h"
+
+#define ROWS           4
+#define VOICES_PER_ROW 3               // polyphony per row, 1 to 4
+#define STEAL_POLICY   STEAL_QUIETEST  // or STEAL_OLDEST
+#define CPU_BUDGET     70.0            // percent; fewer voices past this
+#define STATS_MS       2000            // how often to print usage
+
+#if VOICES_PER_ROW > MAX_ROW_VOICES
+#error "each row's voices go into one AudioMixer4, so 4 at most"
+#endif
 
 Adafruit_NeoTrellisM4 trellis = Adafruit_NeoTrellisM4();
+
+// Each row's first voice, wave0 -> env0 and so on, is in the design tool
+// code below. The rest are patched in setup() into the same row's voices
+// mixer. They're declared first so the audio library updates them before
+// the mixers and effects they feed.
+#if VOICES_PER_ROW > 1
+AudioSynthWaveform       moreWaves[ROWS][VOICES_PER_ROW - 1];
+AudioEffectEnvelope      moreEnvs[ROWS][VOICES_PER_ROW - 1];
+#endif
+
 // Paste your Audio System Design Tool code below this line:
 // GUItool: begin automatically generated code
 AudioSynthWaveform       wave0;          //xy=453.84613037109375,254.61540985107422
@@ -19,6 +43,10 @@ AudioEffectEnvelope      env0;           //xy=602.8461303710938,254.615409851074
 AudioEffectEnvelope      env1;           //xy=602.8461303710938,294.6154098510742
 AudioEffectEnvelope      env2;           //xy=602.8461303710938,354.6154098510742
 AudioEffectEnvelope      env3;           //xy=602.8461303710938,404.6154098510742
+AudioMixer4              voices0;        //xy=668.8461303710938,254.61540985107422
+AudioMixer4              voices1;        //xy=668.8461303710938,294.6154098510742
+AudioMixer4              voices2;        //xy=668.8461303710938,354.6154098510742
+AudioMixer4              voices3;        //xy=668.8461303710938,404.6154098510742
 AudioEffectChorus        chorus1;        //xy=734.6796264648438,333.14093017578125
 AudioEffectFlange        flange1;        //xy=737.7564392089844,284.6794891357422
 AudioEffectDelay         delay1;         //xy=880.7692260742188,582.3077392578125
@@ -30,27 +58,40 @@ AudioConnection          patchCord1(wave0, env0);
 AudioConnection          patchCord2(wave1, env1);
 AudioConnection          patchCord3(wave2, env2);
 AudioConnection          patchCord4(wave3, env3);
-AudioConnection          patchCord5(env0, 0, mixer1, 0);
-AudioConnection          patchCord6(env1, flange1);
-AudioConnection          patchCord7(env2, chorus1);
-AudioConnection          patchCord8(env3, delay1);
-AudioConnection          patchCord9(env3, 0, mixer1, 3);
-AudioConnection          patchCord10(chorus1, 0, mixer1, 2);
-AudioConnection          patchCord11(flange1, 0, mixer1, 1);
-AudioConnection          patchCord12(delay1, 0, mixerLeft, 1);
-AudioConnection          patchCord13(delay1, 1, mixerLeft, 2);
-AudioConnection          patchCord14(delay1, 2, mixerRight, 1);
-AudioConnection          patchCord15(delay1, 3, mixerRight, 2);
-AudioConnection          patchCord16(mixer1, 0, mixerLeft, 0);
-AudioConnection          patchCord17(mixer1, 0, mixerRight, 0);
-AudioConnection          patchCord18(mixerLeft, 0, audioOut, 0);
-AudioConnection          patchCord19(mixerRight, 0, audioOut, 1);
+AudioConnection          patchCord5(env0, 0, voices0, 0);
+AudioConnection          patchCord6(env1, 0, voices1, 0);
+AudioConnection          patchCord7(env2, 0, voices2, 0);
+AudioConnection          patchCord8(env3, 0, voices3, 0);
+AudioConnection          patchCord9(voices0, 0, mixer1, 0);
+AudioConnection          patchCord10(voices1, flange1);
+AudioConnection          patchCord11(voices2, chorus1);
+AudioConnection          patchCord12(voices3, delay1);
+AudioConnection          patchCord13(voices3, 0, mixer1, 3);
+AudioConnection          patchCord14(chorus1, 0, mixer1, 2);
+AudioConnection          patchCord15(flange1, 0, mixer1, 1);
+AudioConnection          patchCord16(delay1, 0, mixerLeft, 1);
+AudioConnection          patchCord17(delay1, 1, mixerLeft, 2);
+AudioConnection          patchCord18(delay1, 2, mixerRight, 1);
+AudioConnection          patchCord19(delay1, 3, mixerRight, 2);
+AudioConnection          patchCord20(mixer1, 0, mixerLeft, 0);
+AudioConnection          patchCord21(mixer1, 0, mixerRight, 0);
+AudioConnection          patchCord22(mixerLeft, 0, audioOut, 0);
+AudioConnection          patchCord23(mixerRight, 0, audioOut, 1);
 // GUItool: end automatically generated code
 
-AudioSynthWaveform *waves[4] = {
-&wave0, &wave1, &wave2, &wave3,
+AudioSynthWaveform *waves[ROWS] = {
+  &wave0, &wave1, &wave2, &wave3,
+};
+AudioEffectEnvelope *envs[ROWS] = {
+  &env0, &env1, &env2, &env3,
+};
+AudioMixer4 *voiceMixers[ROWS] = {
+  &voices0, &voices1, &voices2, &voices3,
 };
-short wave_type[4] = {
+// every voice, the design tool's first
+AudioSynthWaveform  *voiceWave[ROWS][VOICES_PER_ROW];
+AudioEffectEnvelope *voiceEnv[ROWS][VOICES_PER_ROW];
+short wave_type[ROWS] = {
   WAVEFORM_SINE,
   WAVEFORM_SQUARE,
   WAVEFORM_SAWTOOTH,
@@ -58,9 +99,17 @@ short wave_type[4] = {
 };
 float cmaj_low[8] = { 130.81, 146.83, 164.81, 174.61, 196.00, 220.00, 246.94, 261.63 };
 float cmaj_high[8] = { 261.6, 293.7, 329.6, 349.2, 392.0, 440.0, 493.9, 523.3 };
-AudioEffectEnvelope *envs[4] = {
-  &env0, &env1, &env2, &env3,
+float wave_level[ROWS] = { 0.85, 0.4, 0.6, 0.4 };
+// attack, hold, decay, sustain, release, for pleasing sound :-)
+float env_settings[ROWS][5] = {
+  { 300,  2, 30, 0.6, 1200 },
+  {  10,  2, 30, 0.6,  400 },
+  {  10, 20, 30, 0.6, 1000 },
+  {  10,  2, 30, 0.6,  600 },
 };
+
+VoiceAlloc voices;
+uint32_t lastStats;
 int n_chorus = 5;
 #define CHORUS_DELAY_LENGTH (400*AUDIO_BLOCK_SAMPLES)
 short chorusDelayline[CHORUS_DELAY_LENGTH];
@@ -75,51 +124,58 @@ void setup(){
   trellis.begin();
   trellis.setBrightness(255);
 
-  AudioMemory(120);
+  // each sounding voice holds a block until its row's mixer takes it
+  AudioMemory(120 + ROWS * VOICES_PER_ROW);
 
-  //Initialize the waveform nodes
-  wave0.begin(0.85, 50, WAVEFORM_SINE);
-  wave1.begin(0.4, 50, WAVEFORM_SQUARE);
-  wave2.begin(0.6, 50, WAVEFORM_SAWTOOTH);
-  wave3.begin(0.4, 50, WAVEFORM_TRIANGLE);
+  voicesBegin(&voices, ROWS, VOICES_PER_ROW, STEAL_POLICY);
+  for (int row = 0; row < ROWS; row++) {
+    float *e = env_settings[row];
+    for (int v = 0; v < VOICES_PER_ROW; v++) {
+      voiceWave[row][v] = waves[row];
+      voiceEnv[row][v] = envs[row];
+#if VOICES_PER_ROW > 1
+      if (v > 0) {
+        voiceWave[row][v] = &moreWaves[row][v - 1];
+        voiceEnv[row][v] = &moreEnvs[row][v - 1];
+        new AudioConnection(*voiceWave[row][v], *voiceEnv[row][v]);
+        new AudioConnection(*voiceEnv[row][v], 0, *voiceMixers[row], v);
+      }
+#endif
+      // silent until played: a waveform at 0 amplitude sends nothing, and
+      // an envelope with nothing coming in does no work, so idle voices
+      // cost next to no CPU
+      voiceWave[row][v]->begin(0, 50, wave_type[row]);
+      voiceEnv[row][v]->attack(e[0]);
+      voiceEnv[row][v]->hold(e[1]);
+      voiceEnv[row][v]->decay(e[2]);
+      voiceEnv[row][v]->sustain(e[3]);
+      voiceEnv[row][v]->release(e[4]);
+      // a row's voices can peak together (the same key again, octaves,
+      // notes starting at once), so each gets 1/VOICES_PER_ROW and a full
+      // chord at wave_level can't clip the row's mixer
+      voiceMixers[row]->gain(v, 1.0 / VOICES_PER_ROW);
+    }
+    // free a voice once its envelope has had time to finish (plus a block)
+    voices.releaseMs[row] = e[4] + 5;
+  }
+
+  // with more voices in each row, leave mixer1 headroom for all four rows
+  // at once, and make it up in the output mixers
+  for (int row = 0; row < ROWS; row++) {
+    mixer1.gain(row, 0.5);
+  }
 
   // reduce the gain on some channels, so half of the channels
   // are "positioned" to the left, half to the right, but all
   // are heard at least partially on both ears
-  mixerLeft.gain(0, 0.3);
+  mixerLeft.gain(0, 0.6);
   mixerLeft.gain(1, 0.1);
   mixerLeft.gain(2, 0.5);
 
-  mixerRight.gain(0, 0.3);
+  mixerRight.gain(0, 0.6);
   mixerRight.gain(1, 0.5);
   mixerRight.gain(2, 0.1);
 
-
-  // set envelope parameters, for pleasing sound :-)
-  env0.attack(300);
-  env0.hold(2);
-  env0.decay(30);
-  env0.sustain(0.6);
-  env0.release(1200);
-
-  env1.attack(10);
-  env1.hold(2);
-  env1.decay(30);
-  env1.sustain(0.6);
-  env1.release(400);
-
-  env2.attack(10);
-  env2.hold(20);
-  env2.decay(30);
-  env2.sustain(0.6);
-  env2.release(1000);
-
-  env3.attack(10);
-  env3.hold(2);
-  env3.decay(30);
-  env3.sustain(0.6);
-  env3.release(600);
-
   // set delay parameters
   delay1.delay(0, 110);
   delay1.delay(1, 660);
@@ -136,22 +192,73 @@ void setup(){
   // Initialize processor and memory measurements
   AudioProcessorUsageMaxReset();
   AudioMemoryUsageMaxReset();
+  lastStats = millis();
 }
 
 void noteOn(int num){
-  int voice = num/8;
+  int row = num/8;
   float *scale;
-  if(voice == 0 || voice == 1) scale = cmaj_low;
+  if(row == 0 || row == 1) scale = cmaj_low;
   else scale = cmaj_high;
+  int8_t stolen;
+  uint8_t v = voiceNoteOn(&voices, row, num, millis(), &stolen);
+  // a stolen voice's envelope fades the old note out over a few ms before
+  // the new attack, rather than cutting it off with a click
   AudioNoInterrupts();
-  waves[voice]->frequency(scale[num%8]);
-  envs[voice]->noteOn();
+  voiceWave[row][v]->frequency(scale[num%8]);
+  voiceWave[row][v]->amplitude(wave_level[row]);
+  voiceEnv[row][v]->noteOn();
   AudioInterrupts();
 }
 
 void noteOff(int num){
-  int voice = num/8;
-  envs[voice]->noteOff();
+  int row = num/8;
+  int8_t v = voiceNoteOff(&voices, row, num, millis());
+  if (v >= 0) voiceEnv[row][v]->noteOff();   // else it was stolen already
+}
+
+// A voice's release is over; stop its oscillator
+void voiceFreed(uint8_t row, uint8_t v){
+  voiceWave[row][v]->amplitude(0);
+}
+
+// Print CPU and memory use, and set how many voices can sound at once from
+// what each one costs: the busiest voice's CPU, and what the rest (effects,
+// mixers, output) used at the peak, should together stay under CPU_BUDGET
+void usageStats(){
+  float perVoice = 0;
+  for (int row = 0; row < ROWS; row++) {
+    for (int v = 0; v < VOICES_PER_ROW; v++) {
+      float u = voiceWave[row][v]->processorUsageMax() +
+                voiceEnv[row][v]->processorUsageMax();
+      if (u > perVoice) perVoice = u;
+      voiceWave[row][v]->processorUsageMaxReset();
+      voiceEnv[row][v]->processorUsageMaxReset();
+    }
+  }
+  float cpuMax = AudioProcessorUsageMax();
+  if (perVoice > 0 && voices.peak > 0) {
+    float rest = cpuMax - voices.peak * perVoice;
+    int fit = (CPU_BUDGET - rest) / perVoice;
+    voices.limit = constrain(fit, ROWS, ROWS * VOICES_PER_ROW);
+  }
+
+  Serial.print("voices "); Serial.print(voices.sounding);
+  Serial.print(" (peak "); Serial.print(voices.peak);
+  Serial.print(", limit "); Serial.print(voices.limit);
+  Serial.print(" of "); Serial.print(ROWS * VOICES_PER_ROW);
+  Serial.print("), notes "); Serial.print(voices.notes);
+  Serial.print(", stolen "); Serial.print(voices.steals);
+  Serial.print(" | CPU "); Serial.print(AudioProcessorUsage());
+  Serial.print("% (max "); Serial.print(cpuMax);
+  Serial.print("%), per voice "); Serial.print(perVoice);
+  Serial.print("% | blocks "); Serial.print(AudioMemoryUsage());
+  Serial.print(" (max "); Serial.print(AudioMemoryUsageMax());
+  Serial.print(" of "); Serial.print(120 + ROWS * VOICES_PER_ROW);
+  Serial.println(")");
+
+  voiceStatsReset(&voices);
+  AudioProcessorUsageMaxReset();
 }
 
 void loop() {
@@ -170,6 +277,11 @@ void loop() {
         trellis.setPixelColor(keyindex, 0);
       }
    }
+  voicesTick(&voices, millis(), voiceFreed);
+  if (millis() - lastStats >= STATS_MS) {
+    lastStats = millis();
+    usageStats();
+  }
   delay(10);
 }
 
@@ -0,0 +1,161 @@
+// Voice allocation for the Trellis M4 synth
+//
+// Each row of keys has its own sound -- waveform, envelope and effect --
+// and its own pool of voices. A key press takes a free voice from its
+// row if there is one, otherwise it steals one:
+//
+//   STEAL_QUIETEST  a voice that's been let go and is furthest through
+//                   its release, or if none, the one held longest
+//   STEAL_OLDEST    the one started longest ago, held or not
+//
+// A key pressed again while its note is still sounding gets the same
+// voice back, and a released voice is free again once its release time
+// is up. There's also a limit on voices sounding across all rows, which
+// the sketch lowers if the audio CPU gets too busy: past it a row steals
+// from itself rather than start another voice (a row with nothing
+// sounding always gets one).
+//
+// Nothing here touches the audio library -- the sketch starts and stops
+// the envelopes -- so the same code can replay key presses on a PC.
+
+#ifndef VOICE_ALLOC_H
+#define VOICE_ALLOC_H
+
+#include <stdint.h>
+
+#define MAX_ROWS        4
+#define MAX_ROW_VOICES  4    // each row's voices go into one AudioMixer4
+#define NO_KEY          -1
+
+enum { VOICE_FREE, VOICE_HELD, VOICE_RELEASED };
+enum { STEAL_OLDEST, STEAL_QUIETEST };
+
+typedef struct {
+  uint8_t  state;
+  int8_t   key;              // key playing on it, NO_KEY if none
+  uint32_t onAt, offAt;      // millis() of note on and off
+} Voice;
+
+typedef void (*VoiceFreed)(uint8_t row, uint8_t v);
+
+typedef struct {
+  Voice    voice[MAX_ROWS][MAX_ROW_VOICES];
+  uint16_t releaseMs[MAX_ROWS];
+  uint8_t  rows, perRow, policy;
+  uint8_t  limit;            // voices allowed to sound at once, all rows
+  uint8_t  sounding;         // held or still releasing
+  uint8_t  peak;             // most sounding at once since voiceStatsReset()
+  uint32_t notes, steals;
+} VoiceAlloc;
+
+static void voicesBegin(VoiceAlloc *a, uint8_t rows, uint8_t perRow,
+                        uint8_t policy) {
+  a->rows   = rows;
+  a->perRow = perRow;
+  a->policy = policy;
+  a->limit  = rows * perRow;
+  a->sounding = a->peak = 0;
+  a->notes  = a->steals = 0;
+  for (uint8_t r = 0; r < rows; r++) {
+    a->releaseMs[r] = 0;
+    for (uint8_t v = 0; v < perRow; v++) {
+      a->voice[r][v].state = VOICE_FREE;
+      a->voice[r][v].key   = NO_KEY;
+    }
+  }
+}
+
+// The voice to steal in a row (one that's sounding; there may be free
+// ones past the voice limit)
+static uint8_t voiceToSteal(VoiceAlloc *a, uint8_t row, uint32_t now) {
+  Voice *vs = a->voice[row];
+  int8_t best = -1;
+  if (a->policy == STEAL_QUIETEST) {
+    // furthest through its release, as a fraction (x256) of the release
+    int32_t bestDone = -1;
+    for (uint8_t v = 0; v < a->perRow; v++) {
+      if (vs[v].state != VOICE_RELEASED) continue;
+      uint32_t rel = a->releaseMs[row] ? a->releaseMs[row] : 1;
+      uint32_t done = (now - vs[v].offAt) * 256 / rel;
+      if ((int32_t)done > bestDone) { bestDone = done; best = v; }
+    }
+    if (best >= 0) return best;
+  }
+  for (uint8_t v = 0; v < a->perRow; v++) {
+    if (vs[v].state == VOICE_FREE) continue;
+    if (best < 0 || (int32_t)(vs[v].onAt - vs[best].onAt) < 0) best = v;
+  }
+  return best;
+}
+
+// A key went down in 'row'. Returns the voice to play it on; *stolen is
+// the key that voice was playing, or NO_KEY.
+static uint8_t voiceNoteOn(VoiceAlloc *a, uint8_t row, int8_t key,
+                           uint32_t now, int8_t *stolen) {
+  Voice *vs = a->voice[row];
+  uint8_t v, rowSounding = 0;
+  int8_t found = -1;
+
+  *stolen = NO_KEY;
+  a->notes++;
+  for (v = 0; v < a->perRow; v++) {           // still sounding? reuse it
+    if (vs[v].state != VOICE_FREE && vs[v].key == key) break;
+  }
+  if (v == a->perRow) {
+    for (v = 0; v < a->perRow; v++) {
+      if (vs[v].state != VOICE_FREE) rowSounding++;
+      else if (found < 0) found = v;
+    }
+    if (found >= 0 && (a->sounding < a->limit || !rowSounding)) {
+      v = found;
+    } else {
+      v = voiceToSteal(a, row, now);
+      *stolen = vs[v].key;
+      a->steals++;
+    }
+  }
+  if (vs[v].state == VOICE_FREE) {
+    if (++a->sounding > a->peak) a->peak = a->sounding;
+  }
+  vs[v].state = VOICE_HELD;
+  vs[v].key   = key;
+  vs[v].onAt  = now;
+  return v;
+}
+
+// A key came up. Returns its voice, to release, or -1 if it doesn't have
+// one any more (stolen).
+static int8_t voiceNoteOff(VoiceAlloc *a, uint8_t row, int8_t key,
+                           uint32_t now) {
+  Voice *vs = a->voice[row];
+  for (uint8_t v = 0; v < a->perRow; v++) {
+    if (vs[v].state == VOICE_HELD && vs[v].key == key) {
+      vs[v].state = VOICE_RELEASED;
+      vs[v].offAt = now;
+      return v;
+    }
+  }
+  return -1;
+}
+
+// Free voices whose release is over, calling freed(row, voice) for each
+// so the sketch can stop its oscillator
+static void voicesTick(VoiceAlloc *a, uint32_t now, VoiceFreed freed) {
+  for (uint8_t r = 0; r < a->rows; r++) {
+    for (uint8_t v = 0; v < a->perRow; v++) {
+      Voice *vc = &a->voice[r][v];
+      if (vc->state != VOICE_RELEASED) continue;
+      if (now - vc->offAt < a->releaseMs[r]) continue;
+      vc->state = VOICE_FREE;
+      vc->key   = NO_KEY;
+      a->sounding--;
+      if (freed) freed(r, v);
+    }
+  }
+}
+
+static void voiceStatsReset(VoiceAlloc *a) {
+  a->peak = a->sounding;
+}
+
+#endif // VOICE_ALLOC_H
@@ -0,0 +1,283 @@
+// Host test for Design_Tool_Synth_TrellisM4/VoiceAlloc.h. Runs on a PC,
+// not the board.
+//
+// Key presses and releases are replayed through VoiceAlloc.h, and every
+// decision -- which voice a key gets, which key it took the voice from,
+// which voices are freed when -- is checked against a separately written
+// model of the rules. First some scripted cases: a chord bigger than the
+// row, reusing the voice furthest into its release, a key pressed again
+// while it's still sounding, release timing, resetting the peak count, the
+// voice limit and the STEAL_OLDEST policy. Then 400 random runs of 3000
+// events, 1-4 voices a row, both policies, some across the millis() wrap.
+// Last, for comparison, how often each policy cuts off a key that's still
+// held in legato playing.
+//
+//   g++ -O2 -Wall -Wextra -o voicealloc_test voicealloc_test.cpp
+//   ./voicealloc_test
+//
+// Exits nonzero on failure.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <vector>
+#include <set>
+#include <utility>
+#include <algorithm>
+#include "Design_Tool_Synth_TrellisM4/VoiceAlloc.h"
+
+static int failures = 0;
+
+static void check(bool ok, const char *what) {
+  if (!ok && (failures++ < 10)) printf("FAIL: %s\n", what);
+}
+
+// The rules, written out the long way
+struct ModelVoice {
+  int      state, key;
+  uint32_t on, off;
+  ModelVoice() : state(VOICE_FREE), key(NO_KEY), on(0), off(0) { }
+};
+
+struct Model {
+  int        rows, per, policy, limit;
+  long       releaseMs[MAX_ROWS];
+  ModelVoice v[MAX_ROWS][MAX_ROW_VOICES];
+
+  int sounding() const {
+    int n = 0;
+    for (int r = 0; r < rows; r++)
+      for (int i = 0; i < per; i++) n += (v[r][i].state != VOICE_FREE);
+    return n;
+  }
+
+  // How far through its release a voice is, in 256ths
+  long released(int r, int i, uint32_t now) const {
+    return (uint32_t)(now - v[r][i].off) * 256ul / std::max(1L, releaseMs[r]);
+  }
+
+  // The voice a key should get, and whether it's taken from another key:
+  // its own voice if it's still sounding, else the first free one (unless
+  // that would go past the limit and the row already has one sounding),
+  // else with STEAL_QUIETEST the one furthest into its release, else the
+  // one pressed longest ago
+  int choose(int r, int key, uint32_t now, bool *steal) {
+    std::vector<int> free, busy, releasing;
+    *steal = false;
+    for (int i = 0; i < per; i++) {
+      if ((v[r][i].state != VOICE_FREE) && (v[r][i].key == key)) return i;
+    }
+    for (int i = 0; i < per; i++) {
+      if (v[r][i].state == VOICE_FREE) {
+        free.push_back(i);
+      } else {
+        busy.push_back(i);
+        if (v[r][i].state == VOICE_RELEASED) releasing.push_back(i);
+      }
+    }
+    if (!free.empty() && ((sounding() < limit) || busy.empty())) return free[0];
+    *steal = true;
+    int best = -1;
+    if ((policy == STEAL_QUIETEST) && !releasing.empty()) {
+      for (size_t j = 0; j < releasing.size(); j++) {
+        int i = releasing[j];
+        if ((best < 0) || (released(r, i, now) > released(r, best, now))) best = i;
+      }
+      return best;
+    }
+    for (size_t j = 0; j < busy.size(); j++) {
+      int i = busy[j];
+      if ((best < 0) || ((int32_t)(v[r][i].on - v[r][best].on) < 0)) best = i;
+    }
+    return best;
+  }
+};
+
+static std::set<std::pair<int, int> > freed;
+
+static void onFreed(uint8_t row, uint8_t v) { freed.insert(std::make_pair(row, v)); }
+
+// VoiceAlloc and the model side by side
+struct Run {
+  VoiceAlloc a;
+  Model      m;
+  long       cutHeld;                     // Steals from a key still held
+  std::set<int> held, stolenHeld;
+
+  Run(int rows, int per, int policy) : cutHeld(0) {
+    voicesBegin(&a, rows, per, policy);
+    m.rows   = rows;
+    m.per    = per;
+    m.policy = policy;
+    m.limit  = rows * per;
+    for (int r = 0; r < rows; r++) a.releaseMs[r] = m.releaseMs[r] = 200 + 300 * r;
+  }
+
+  void setLimit(int n) { a.limit = m.limit = n; }
+
+  void press(int key, uint32_t now) {
+    int    r = key / 8;
+    bool   steal;
+    int    want = m.choose(r, key, now, &steal);
+    int    wantStolen = steal ? m.v[r][want].key : NO_KEY;
+    int8_t stolen;
+    int    got = voiceNoteOn(&a, r, key, now, &stolen);
+    check(got == want, "voice for a key");
+    check(stolen == wantStolen, "key stolen from");
+    if ((stolen != NO_KEY) && held.count(stolen)) {
+      cutHeld++;
+      held.erase(stolen);
+      stolenHeld.insert(stolen);
+    }
+    m.v[r][want].state = VOICE_HELD;
+    m.v[r][want].key   = key;
+    m.v[r][want].on    = now;
+    held.insert(key);
+    stolenHeld.erase(key);
+  }
+
+  void release(int key, uint32_t now) {
+    int r = key / 8, want = -1;
+    for (int i = 0; i < m.per; i++) {
+      if ((m.v[r][i].state == VOICE_HELD) && (m.v[r][i].key == key)) want = i;
+    }
+    check(voiceNoteOff(&a, r, key, now) == want, "voice released");
+    check((want < 0) == (stolenHeld.count(key) > 0), "no voice only if stolen");
+    if (want >= 0) {
+      m.v[r][want].state = VOICE_RELEASED;
+      m.v[r][want].off   = now;
+    }
+    held.erase(key);
+    stolenHeld.erase(key);
+  }
+
+  void tick(uint32_t now) {
+    std::set<std::pair<int, int> > want;
+    for (int r = 0; r < m.rows; r++) {
+      for (int i = 0; i < m.per; i++) {
+        ModelVoice &x = m.v[r][i];
+        if ((x.state == VOICE_RELEASED) && ((uint32_t)(now - x.off) >= (uint32_t)m.releaseMs[r])) {
+          want.insert(std::make_pair(r, i));
+          x = ModelVoice();
+        }
+      }
+    }
+    freed.clear();
+    voicesTick(&a, now, onFreed);
+    check(freed == want, "voices freed");
+    check(a.sounding == m.sounding(), "voices sounding");
+    for (std::set<int>::iterator k = held.begin(); k != held.end(); ++k) {
+      int r = *k / 8, n = 0;
+      for (int i = 0; i < m.per; i++) {
+        n += (a.voice[r][i].state == VOICE_HELD) && (a.voice[r][i].key == *k);
+      }
+      check(n == 1, "each held key on one voice");
+    }
+  }
+};
+
+static void scripted() {
+  Run t(4, 3, STEAL_QUIETEST);
+
+  // A 4-note chord in a 3-voice row takes the oldest
+  t.press(0, 0); t.press(2, 10); t.press(4, 20); t.tick(25);
+  t.press(7, 30); t.tick(35);
+  check(t.stolenHeld.count(0), "4-note chord takes key 0's voice");
+
+  // Let go of 2, then 4: a new key gets 2's voice, furthest into release
+  t.release(2, 100); t.release(4, 150); t.tick(160);
+  t.press(1, 170); t.tick(175);
+  check(t.a.voice[0][1].key == 1, "released voice reused");
+
+  // Key 4 again while it's releasing gets its own voice back
+  long steals = t.a.steals;
+  t.press(4, 180); t.tick(185);
+  check(t.a.steals == steals && t.a.voice[0][2].key == 4, "key pressed again keeps its voice");
+
+  // Row 0 has a 200 ms release
+  t.release(7, 200); t.release(1, 200); t.release(4, 200); t.release(0, 200);
+  t.tick(399);
+  check(t.a.sounding == 3, "still releasing at 399 ms");
+  t.tick(400);
+  check(t.a.sounding == 0 && freed.size() == 3, "all freed at 400 ms");
+
+  // The peak stays until reset, then counts up again from what's sounding
+  check(t.a.peak == 3, "peak of 3 voices kept after they're freed");
+  voiceStatsReset(&t.a);
+  check(t.a.peak == 0, "peak reset to what's sounding");
+
+  // With a limit of 2, an empty row still gets a voice, then steals from
+  // itself
+  t.setLimit(2);
+  t.press(8, 500); t.press(9, 510); t.tick(511);
+  t.press(16, 520); t.tick(521);
+  check(t.a.sounding == 3, "empty row gets a voice past the limit");
+  check(t.a.peak == 3, "peak counts up again after a reset");
+  t.press(17, 530); t.tick(531);
+  check(t.stolenHeld.count(16), "row past the limit steals from itself");
+
+  // STEAL_OLDEST takes the oldest even with another one releasing
+  Run o(1, 2, STEAL_OLDEST);
+  o.press(0, 0); o.press(1, 10); o.release(1, 20); o.press(2, 30); o.tick(31);
+  check(o.stolenHeld.count(0), "STEAL_OLDEST takes key 0, not released key 1");
+}
+
+// Mostly one row, keys held and let go at random, now and then a new limit
+static void randomRuns() {
+  srand(1);
+  for (int run = 0; run < 400; run++) {
+    int  per = 1 + run % 4, policy = (run / 4) % 2;
+    Run  t(4, per, policy);
+    std::vector<int> down;
+    long now = 1000000L * (run % 3) + ((run % 7) ? 0 : 4294960000L); // Some wrap
+    for (int e = 0; e < 3000; e++) {
+      now += rand() % 60;
+      if (rand() % 200 == 0) t.setLimit(4 + rand() % (4 * per - 3));
+      if (!down.empty() && (rand() % 2)) {
+        int i = rand() % down.size();
+        t.release(down[i], now);
+        down.erase(down.begin() + i);
+      } else if (down.size() < 32) {
+        int k;
+        do k = (rand() % 4 < 3) ? rand() % 8 : rand() % 32;
+        while (std::count(down.begin(), down.end(), k));
+        t.press(k, now);
+        down.push_back(k);
+      }
+      if (rand() % 3 == 0) t.tick(now);
+    }
+  }
+}
+
+// One row of 3 voices, two to four keys down at a time
+static long legato(int policy) {
+  Run t(1, 3, policy);
+  std::vector<int> down;
+  uint32_t now = 0;
+  srand(7);
+  for (int e = 0; e < 100000; e++) {
+    now += 20 + rand() % 120;
+    if (down.size() > 1 + (size_t)(rand() % 3)) {
+      int i = rand() % down.size();
+      t.release(down[i], now);
+      down.erase(down.begin() + i);
+    } else {
+      int k;
+      do k = rand() % 8; while (std::count(down.begin(), down.end(), k));
+      t.press(k, now);
+      down.push_back(k);
+    }
+    t.tick(now);
+  }
+  return t.cutHeld;
+}
+
+int main(void) {
+  scripted();
+  randomRuns();
+  long quietest = legato(STEAL_QUIETEST), oldest = legato(STEAL_OLDEST);
+  printf("legato, 3 voices: a held key cut off %ld times with STEAL_QUIETEST, "
+         "%ld with STEAL_OLDEST\n", quietest, oldest);
+  check(quietest < oldest, "STEAL_QUIETEST cuts off fewer held keys");
+  printf("%s\n", failures ? "FAILED" : "every decision matches");
+  return failures ? 1 : 0;
+}
@@ -17,14 +17,15 @@
 
 #include <Wire.h>           // For I2C communication
 #include "data.h"           // Flame animation data
+#include "flame.h"          // and its decoder
 #include <avr/power.h>      // Peripheral control and
 #include <avr/sleep.h>      // sleep to minimize current draw
 
 #define I2C_ADDR 0x74       // I2C address of Charlieplex matrix
 
-uint8_t        page = 0;    // Front/back buffer control
-const uint8_t *ptr  = anim; // Current pointer into animation data
-uint8_t        img[9 * 16]; // Buffer for rendering image
+uint8_t        page  = 0;        // Front/back buffer control
+FlameDecoder   flame = { 0, 0 }; // Current position in animation data
+uint8_t        img[9 * 16];      // Buffer for rendering image
 
 // UTILITY FUNCTIONS -------------------------------------------------------
 
@@ -100,8 +101,6 @@ void setup() {
 // LOOP FUNCTION - RUNS EVERY FRAME ----------------------------------------
 
 void loop() {
-  uint8_t  a, x1, y1, x2, y2, x, y;
-
   power_twi_enable();
   // Datasheet recommends that I2C should be re-initialized after enable,
   // but Wire.begin() is slow.  Seems to work OK without.
@@ -115,22 +114,10 @@ void loop() {
 
   page ^= 1; // Flip front/back buffer index
 
-  // Then render NEXT frame.  Start by getting bounding rect for new frame:
-  a = pgm_read_byte(ptr++);     // New frame X1/Y1
-  if(a >= 0x90) {               // EOD marker? (valid X1 never exceeds 8)
-    ptr = anim;                 // Reset animation data pointer to start
-    a   = pgm_read_byte(ptr++); // and take first value
-  }
-  x1 = a >> 4;                  // X1 = high 4 bits
-  y1 = a & 0x0F;                // Y1 = low 4 bits
-  a  = pgm_read_byte(ptr++);    // New frame X2/Y2
-  x2 = a >> 4;                  // X2 = high 4 bits
-  y2 = a & 0x0F;                // Y2 = low 4 bits
-
-  // Read rectangle of data from anim[] into portion of img[] buffer
-  for(x=x1; x<=x2; x++) { // Column-major
-    for(y=y1; y<=y2; y++) img[(x << 4) + y] = pgm_read_byte(ptr++);
-  }
+  // Then render NEXT frame: apply its changes from the prior frame to
+  // img[] (wraps around to the start after the last frame).  Worst case
+  // is a few hundred 4-bit codes, well inside the ~32 ms frame time.
+  flameDecode(&flame, anim, ANIM_FRAMES, ANIM_LOOP, img);
 
   // Write img[] to matrix (not actually displayed until next pass)
   pageSelect(page);    // Select background buffer
@@ -1,1929 +1,1235 @@
 // Data derived from Free Stock Video by user 'dietolog' on Videezy.com
+// Packed by flamepack from 269 frames; see flame.h for the format.
+
+#define ANIM_FRAMES 269
+#define ANIM_LOOP   162 // Nibble offset of second frame
 
 const uint8_t PROGMEM anim[] = {
-  0X00, 0X8F, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X04, 0X0E, 0X19, 0X22, 0X22, 0X17, 0X09, 0X01, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X0D, 0X40, 0X99, 0XF2, 0XFF, 0XFF, 0XF4, 0X91, 0X38, 0X0B, 0X01,
-  0X00, 0X00, 0X00, 0X16, 0X6B, 0XC6, 0XE5, 0XDB, 0XCF, 0XBC, 0X93, 0X4B,
-  0X13, 0X01, 0X00, 0X00, 0X00, 0X00, 0X01, 0X48, 0XB4, 0XC8, 0XBC, 0XBA,
-  0XB8, 0XAD, 0X8A, 0X42, 0X0E, 0X01, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X0C, 0X40, 0X9D, 0XF4, 0XFF, 0XFF, 0XFF, 0XDB, 0X70, 0X24, 0X06, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X01, 0X09, 0X19, 0X26, 0X2C, 0X29,
-  0X1D, 0X0F, 0X05, 0X01, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X11, 0X6D, 0X00, 0X00, 0X00, 0X00, 0X00, 0X04, 0X0E, 0X19,
-  0X22, 0X22, 0X18, 0X0A, 0X02, 0X00, 0X00, 0X0E, 0X41, 0X99, 0XF2, 0XFF,
-  0XFF, 0XF7, 0X95, 0X3A, 0X0C, 0X01, 0X1A, 0X72, 0XC8, 0XE7, 0XDD, 0XD1,
-  0XBC, 0X93, 0X4D, 0X14, 0X02, 0X00, 0X00, 0X3F, 0XAF, 0XCF, 0XC8, 0XBF,
-  0XBC, 0XAF, 0X8C, 0X45, 0X10, 0X01, 0X00, 0X00, 0X00, 0X07, 0X34, 0X8A,
-  0XE7, 0XFF, 0XFF, 0XFF, 0XE0, 0X73, 0X26, 0X07, 0X01, 0X00, 0X00, 0X00,
-  0X00, 0X06, 0X13, 0X1E, 0X24, 0X22, 0X19, 0X0E, 0X04, 0X01, 0X10, 0X6C,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X03, 0X0D, 0X1A, 0X24, 0X24, 0X19,
-  0X0B, 0X00, 0X00, 0X00, 0X0E, 0X41, 0X99, 0XF2, 0XFF, 0XFF, 0XFC, 0X9D,
-  0X3D, 0X0E, 0X00, 0X1E, 0X7A, 0XCD, 0XEA, 0XE0, 0XD1, 0XBF, 0X97, 0X51,
-  0X17, 0X02, 0X00, 0X00, 0X33, 0XA1, 0XD4, 0XD4, 0XC8, 0XC1, 0XB6, 0X91,
-  0X4B, 0X12, 0X01, 0X00, 0X00, 0X00, 0X03, 0X24, 0X73, 0XD6, 0XFF, 0XFF,
-  0XFF, 0XE5, 0X7A, 0X29, 0X07, 0X00, 0X00, 0X00, 0X00, 0X00, 0X03, 0X0C,
-  0X15, 0X1C, 0X1C, 0X15, 0X0C, 0X04, 0X11, 0X6C, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X03, 0X0E, 0X1B, 0X25, 0X27, 0X1C, 0X0C, 0X00, 0X00, 0X0F, 0X42,
-  0X99, 0XF2, 0XFF, 0XFF, 0XFF, 0XA5, 0X42, 0X0F, 0X21, 0X84, 0XD1, 0XEA,
-  0XE2, 0XD4, 0XC3, 0X9D, 0X57, 0X19, 0X03, 0X00, 0X23, 0X8D, 0XD6, 0XE0,
-  0XD6, 0XCD, 0XBC, 0X99, 0X53, 0X15, 0X01, 0X00, 0X00, 0X01, 0X16, 0X58,
-  0XB6, 0XFF, 0XFF, 0XFF, 0XEA, 0X83, 0X2C, 0X08, 0X00, 0X00, 0X00, 0X00,
-  0X01, 0X06, 0X0E, 0X14, 0X15, 0X12, 0X0B, 0X04, 0X11, 0X6D, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X03, 0X0E, 0X1C, 0X28, 0X29, 0X1E, 0X0E, 0X03, 0X00,
-  0X00, 0X0F, 0X40, 0X97, 0XF2, 0XFF, 0XFF, 0XFF, 0XAF, 0X48, 0X11, 0X02,
-  0X21, 0X8D, 0XD8, 0XED, 0XE5, 0XD8, 0XC6, 0XA3, 0X5E, 0X1D, 0X03, 0X00,
-  0X00, 0X15, 0X72, 0XCD, 0XED, 0XE7, 0XDB, 0XC8, 0XA3, 0X5C, 0X1A, 0X02,
-  0X00, 0X00, 0X00, 0X00, 0X0B, 0X3E, 0X97, 0XED, 0XFF, 0XFF, 0XED, 0X8A,
-  0X32, 0X09, 0X01, 0X00, 0X00, 0X00, 0X00, 0X00, 0X03, 0X09, 0X0E, 0X11,
-  0X0F, 0X0A, 0X04, 0X01, 0X11, 0X6C, 0X00, 0X00, 0X00, 0X00, 0X00, 0X03,
-  0X0E, 0X1D, 0X29, 0X2D, 0X21, 0X10, 0X00, 0X00, 0X0E, 0X3E, 0X95, 0XF2,
-  0XFF, 0XFF, 0XFF, 0XBC, 0X50, 0X14, 0X1C, 0X95, 0XE0, 0XF2, 0XEA, 0XDD,
-  0XCD, 0XA9, 0X65, 0X21, 0X05, 0X00, 0X0C, 0X58, 0XBF, 0XF7, 0XFA, 0XE7,
-  0XD4, 0XAD, 0X65, 0X1E, 0X03, 0X00, 0X00, 0X00, 0X04, 0X2A, 0X7C, 0XD6,
-  0XFF, 0XFF, 0XF2, 0X93, 0X35, 0X0A, 0X00, 0X00, 0X00, 0X00, 0X00, 0X01,
-  0X06, 0X0B, 0X0E, 0X0E, 0X0A, 0X04, 0X11, 0X6D, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X02, 0X0C, 0X1A, 0X28, 0X2C, 0X23, 0X11, 0X04, 0X00, 0X00, 0X0B,
-  0X35, 0X86, 0XEA, 0XFF, 0XFF, 0XFF, 0XC8, 0X59, 0X18, 0X03, 0X13, 0X8F,
-  0XE2, 0XF7, 0XF2, 0XE2, 0XD1, 0XAF, 0X6D, 0X26, 0X06, 0X00, 0X00, 0X06,
-  0X45, 0XAD, 0XFA, 0XFF, 0XEF, 0XD8, 0XB4, 0X6E, 0X22, 0X03, 0X00, 0X00,
-  0X00, 0X00, 0X02, 0X1D, 0X67, 0XC6, 0XFF, 0XFF, 0XFA, 0X9B, 0X3B, 0X0C,
-  0X01, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X04, 0X0A, 0X0E, 0X0E, 0X0A,
-  0X04, 0X01, 0X11, 0X6D, 0X00, 0X00, 0X00, 0X00, 0X00, 0X01, 0X08, 0X15,
-  0X21, 0X28, 0X21, 0X12, 0X05, 0X00, 0X00, 0X07, 0X2A, 0X73, 0XD8, 0XFF,
-  0XFF, 0XFF, 0XD6, 0X65, 0X1D, 0X04, 0X0A, 0X7C, 0XDB, 0XFA, 0XFA, 0XEA,
-  0XD8, 0XB6, 0X75, 0X2C, 0X07, 0X00, 0X00, 0X03, 0X3B, 0XA5, 0XFA, 0XFF,
-  0XF2, 0XDB, 0XB8, 0X73, 0X25, 0X04, 0X00, 0X00, 0X00, 0X00, 0X01, 0X18,
-  0X61, 0XCA, 0XFF, 0XFF, 0XFF, 0XA5, 0X3F, 0X0C, 0X01, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X05, 0X0C, 0X11, 0X12, 0X0D, 0X06, 0X01, 0X11, 0X6D,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X04, 0X0D, 0X18, 0X1F, 0X1C, 0X10,
-  0X05, 0X00, 0X00, 0X02, 0X19, 0X54, 0XB4, 0XFF, 0XFF, 0XFF, 0XE2, 0X75,
-  0X24, 0X05, 0X04, 0X57, 0XBF, 0XF4, 0XFF, 0XFA, 0XE5, 0XC1, 0X83, 0X33,
-  0X09, 0X00, 0X00, 0X02, 0X3D, 0XAF, 0XFA, 0XFF, 0XEA, 0XD6, 0XB6, 0X75,
-  0X28, 0X04, 0X00, 0X00, 0X00, 0X00, 0X01, 0X1C, 0X6D, 0XDD, 0XFF, 0XFF,
-  0XFF, 0XAD, 0X3F, 0X0C, 0X01, 0X00, 0X00, 0X00, 0X00, 0X00, 0X01, 0X0A,
-  0X15, 0X1C, 0X1B, 0X12, 0X08, 0X01, 0X11, 0X6D, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X01, 0X05, 0X0D, 0X14, 0X15, 0X0E, 0X04, 0X00, 0X00, 0X00,
-  0X0A, 0X33, 0X83, 0XDD, 0XFF, 0XFF, 0XEA, 0X81, 0X2B, 0X06, 0X01, 0X2D,
-  0X8C, 0XE2, 0XFF, 0XFF, 0XF7, 0XD1, 0X8F, 0X3B, 0X0C, 0X00, 0X00, 0X01,
-  0X4C, 0XD1, 0XFF, 0XEF, 0XDB, 0XCD, 0XB2, 0X73, 0X27, 0X04, 0X00, 0X00,
-  0X00, 0X00, 0X04, 0X2D, 0X93, 0XFF, 0XFF, 0XFF, 0XFF, 0XA7, 0X3B, 0X0A,
-  0X01, 0X00, 0X00, 0X00, 0X00, 0X00, 0X05, 0X18, 0X2B, 0X34, 0X2F, 0X1D,
-  0X0B, 0X02, 0X11, 0X6D, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X01,
-  0X05, 0X0A, 0X0D, 0X0A, 0X04, 0X00, 0X00, 0X00, 0X01, 0X15, 0X4F, 0XA1,
-  0XE7, 0XFF, 0XE5, 0X88, 0X32, 0X08, 0X00, 0X0D, 0X4B, 0XB4, 0XFF, 0XFF,
-  0XFF, 0XEA, 0XA1, 0X46, 0X0E, 0X01, 0X00, 0X01, 0X5F, 0XFF, 0XFA, 0XDB,
-  0XCD, 0XC6, 0XAF, 0X72, 0X26, 0X04, 0X00, 0X00, 0X00, 0X00, 0X0F, 0X55,
-  0XD1, 0XFF, 0XFF, 0XFF, 0XEF, 0X8A, 0X2E, 0X07, 0X01, 0X00, 0X00, 0X00,
-  0X00, 0X02, 0X16, 0X3D, 0X5B, 0X64, 0X51, 0X2F, 0X10, 0X03, 0X11, 0X6D,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X01, 0X04, 0X07, 0X07,
-  0X03, 0X00, 0X00, 0X00, 0X00, 0X04, 0X24, 0X65, 0XAF, 0XE0, 0XD6, 0X8C,
-  0X38, 0X09, 0X00, 0X01, 0X1A, 0X6E, 0XE5, 0XFF, 0XFF, 0XFF, 0XBF, 0X55,
-  0X12, 0X01, 0X00, 0X00, 0X57, 0XFF, 0XF4, 0XD1, 0XCA, 0XC6, 0XAF, 0X72,
-  0X25, 0X04, 0X00, 0X00, 0X00, 0X03, 0X2E, 0X99, 0XFC, 0XFF, 0XFF, 0XFA,
-  0XBF, 0X65, 0X1D, 0X04, 0X00, 0X00, 0X00, 0X00, 0X00, 0X0F, 0X40, 0X81,
-  0XA7, 0XA7, 0X81, 0X44, 0X17, 0X04, 0X12, 0X7D, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X01, 0X03, 0X04, 0X02, 0X00, 0X00, 0X00, 0X00,
-  0X0A, 0X34, 0X77, 0XB2, 0XBF, 0X8A, 0X3B, 0X0B, 0X00, 0X04, 0X31, 0XA1,
-  0XFF, 0XFF, 0XFF, 0XE0, 0X68, 0X18, 0X01, 0X00, 0X2A, 0XC6, 0XF2, 0XDD,
-  0XD1, 0XC6, 0XAD, 0X70, 0X24, 0X03, 0X00, 0X00, 0X11, 0X6E, 0XD4, 0XFF,
-  0XFA, 0XEA, 0XCF, 0X99, 0X4A, 0X11, 0X02, 0X00, 0X00, 0X00, 0X0A, 0X3B,
-  0X8C, 0XD6, 0XF7, 0XE7, 0XA9, 0X55, 0X1B, 0X05, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X01, 0X04, 0X04, 0X02, 0X01, 0X00, 0X00, 0X12, 0X7D, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X01, 0X03, 0X02, 0X00, 0X00,
-  0X00, 0X00, 0X01, 0X17, 0X4B, 0X86, 0XA5, 0X84, 0X3F, 0X0D, 0X00, 0X00,
-  0X0E, 0X5B, 0XE5, 0XFF, 0XFF, 0XFA, 0X81, 0X1F, 0X02, 0X00, 0X09, 0X6A,
-  0XE0, 0XF7, 0XE2, 0XCD, 0XB2, 0X70, 0X24, 0X03, 0X00, 0X00, 0X24, 0XBA,
-  0XE2, 0XDB, 0XD6, 0XCF, 0XB8, 0X86, 0X39, 0X0B, 0X01, 0X00, 0X00, 0X04,
-  0X2E, 0X81, 0XE0, 0XFF, 0XFF, 0XFF, 0XC3, 0X5F, 0X1E, 0X05, 0X00, 0X00,
-  0X00, 0X00, 0X03, 0X0C, 0X12, 0X0F, 0X08, 0X03, 0X01, 0X00, 0X12, 0X7E,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X02, 0X02,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X09, 0X2F, 0X68, 0X91, 0X81, 0X41,
-  0X0F, 0X01, 0X00, 0X00, 0X02, 0X30, 0XB2, 0XFF, 0XFF, 0XFF, 0X99, 0X29,
-  0X03, 0X00, 0X00, 0X01, 0X2D, 0XB8, 0XFF, 0XF7, 0XD8, 0XB4, 0X72, 0X24,
-  0X03, 0X00, 0X00, 0X00, 0X24, 0XD8, 0XD8, 0XC3, 0XC6, 0XC6, 0XB2, 0X7D,
-  0X33, 0X08, 0X00, 0X00, 0X00, 0X01, 0X16, 0X5E, 0XBC, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XCA, 0X61, 0X1E, 0X05, 0X00, 0X00, 0X00, 0X00, 0X03, 0X0F, 0X1F,
-  0X25, 0X1C, 0X0F, 0X05, 0X01, 0X00, 0X00, 0X12, 0X7D, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X01, 0X01, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X04, 0X21, 0X57, 0X84, 0X7D, 0X45, 0X11, 0X00, 0X00, 0X00,
-  0X1C, 0X8D, 0XFF, 0XFF, 0XFF, 0XAB, 0X31, 0X05, 0X00, 0X00, 0X14, 0X93,
-  0XFF, 0XFF, 0XE2, 0XB8, 0X73, 0X25, 0X04, 0X00, 0X00, 0X1A, 0XCF, 0XD8,
-  0XBC, 0XC1, 0XC1, 0XAF, 0X7A, 0X31, 0X08, 0X00, 0X00, 0X03, 0X2E, 0X84,
-  0XD8, 0XFF, 0XFF, 0XFF, 0XFF, 0XCA, 0X61, 0X1E, 0X05, 0X00, 0X00, 0X00,
-  0X09, 0X1C, 0X2E, 0X30, 0X21, 0X11, 0X06, 0X01, 0X00, 0X22, 0X7D, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X03, 0X1D, 0X4F, 0X7D, 0X7D, 0X48, 0X13, 0X00,
-  0X00, 0X00, 0X18, 0X86, 0XFF, 0XFF, 0XFF, 0XB6, 0X35, 0X06, 0X00, 0X00,
-  0X10, 0X8C, 0XFF, 0XFF, 0XE5, 0XBA, 0X75, 0X27, 0X04, 0X00, 0X00, 0X1A,
-  0XCA, 0XD8, 0XBF, 0XC3, 0XC3, 0XAF, 0X7D, 0X33, 0X09, 0X01, 0X00, 0X05,
-  0X3A, 0X8D, 0XDD, 0XFF, 0XFF, 0XFF, 0XFF, 0XC1, 0X58, 0X1A, 0X04, 0X00,
-  0X00, 0X01, 0X0A, 0X1B, 0X28, 0X26, 0X18, 0X0B, 0X03, 0X01, 0X00, 0X22,
-  0X7E, 0X00, 0X00, 0X00, 0X00, 0X00, 0X03, 0X1E, 0X50, 0X7F, 0X7D, 0X4D,
-  0X17, 0X02, 0X00, 0X00, 0X00, 0X1E, 0X91, 0XFF, 0XFF, 0XFF, 0XBA, 0X3A,
-  0X07, 0X00, 0X00, 0X00, 0X18, 0X9D, 0XFF, 0XFF, 0XE5, 0XBA, 0X77, 0X29,
-  0X05, 0X00, 0X00, 0X00, 0X26, 0XDB, 0XDB, 0XC6, 0XCA, 0XCA, 0XB6, 0X84,
-  0X3C, 0X0E, 0X01, 0X00, 0X00, 0X04, 0X31, 0X7C, 0XCD, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XAF, 0X4F, 0X17, 0X03, 0X00, 0X00, 0X00, 0X00, 0X05, 0X0E, 0X15,
-  0X13, 0X0B, 0X04, 0X01, 0X00, 0X00, 0X00, 0X12, 0X7E, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X01, 0X02, 0X01, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X06, 0X24, 0X5B, 0X8A, 0X88, 0X55, 0X1B, 0X03, 0X00,
-  0X00, 0X02, 0X2B, 0XA9, 0XFF, 0XFF, 0XFF, 0XBA, 0X3B, 0X08, 0X00, 0X00,
-  0X01, 0X2C, 0XB8, 0XFF, 0XFF, 0XE2, 0XBC, 0X7A, 0X2D, 0X06, 0X00, 0X00,
-  0X00, 0X33, 0XEA, 0XEA, 0XD8, 0XDB, 0XD8, 0XC8, 0X99, 0X4F, 0X15, 0X03,
-  0X00, 0X00, 0X02, 0X1A, 0X54, 0X9D, 0XE0, 0XFF, 0XFF, 0XE0, 0X93, 0X42,
-  0X14, 0X03, 0X00, 0X00, 0X00, 0X00, 0X00, 0X03, 0X06, 0X05, 0X03, 0X01,
-  0X00, 0X00, 0X00, 0X00, 0X12, 0X7D, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X02, 0X02, 0X00, 0X00, 0X00, 0X00, 0X00, 0X0C,
-  0X33, 0X70, 0X9D, 0X97, 0X5E, 0X20, 0X00, 0X00, 0X07, 0X47, 0XD1, 0XFF,
-  0XFF, 0XFF, 0XAF, 0X3A, 0X09, 0X00, 0X05, 0X57, 0XE2, 0XFF, 0XFA, 0XDD,
-  0XBC, 0X7F, 0X31, 0X07, 0X00, 0X00, 0X2F, 0XD1, 0XF4, 0XFC, 0XFF, 0XFF,
-  0XF2, 0XC3, 0X70, 0X24, 0X06, 0X00, 0X00, 0X05, 0X21, 0X54, 0X8F, 0XB8,
-  0XBF, 0XA3, 0X6D, 0X33, 0X0F, 0X02, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X12, 0X6E, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X01, 0X03, 0X03, 0X01, 0X00, 0X00, 0X00,
-  0X00, 0X02, 0X17, 0X4A, 0X8C, 0XB6, 0XA5, 0X65, 0X22, 0X04, 0X00, 0X00,
-  0X15, 0X70, 0XF7, 0XFF, 0XFF, 0XFF, 0XA3, 0X37, 0X09, 0X00, 0X00, 0X16,
-  0XA7, 0XFF, 0XFF, 0XF7, 0XE0, 0XC3, 0X8A, 0X3A, 0X0A, 0X00, 0X00, 0X00,
-  0X19, 0X7C, 0XCF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XA1, 0X3A, 0X0A, 0X01,
-  0X00, 0X00, 0X00, 0X04, 0X17, 0X39, 0X58, 0X64, 0X58, 0X3F, 0X21, 0X0B,
-  0X02, 0X00, 0X12, 0X6D, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X02, 0X05, 0X04, 0X00, 0X00, 0X00, 0X00, 0X05, 0X24, 0X61, 0XA5,
-  0XC8, 0XAD, 0X68, 0X24, 0X00, 0X02, 0X29, 0X99, 0XFF, 0XFF, 0XFF, 0XFF,
-  0X99, 0X33, 0X09, 0X00, 0X2C, 0XF7, 0XFF, 0XFF, 0XFF, 0XEA, 0XCD, 0X93,
-  0X42, 0X0D, 0X00, 0X00, 0X09, 0X37, 0X7D, 0XE2, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XC8, 0X4C, 0X0F, 0X01, 0X00, 0X00, 0X00, 0X02, 0X0E, 0X1F, 0X2A, 0X2B,
-  0X22, 0X15, 0X08, 0X01, 0X12, 0X6D, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X01, 0X03, 0X06, 0X05, 0X00, 0X00, 0X00, 0X00, 0X09, 0X2F,
-  0X72, 0XB6, 0XD4, 0XAF, 0X65, 0X21, 0X00, 0X06, 0X3A, 0XB4, 0XFF, 0XFF,
-  0XFF, 0XFC, 0X8F, 0X31, 0X08, 0X00, 0X37, 0XFF, 0XFF, 0XFF, 0XFF, 0XF2,
-  0XD1, 0X99, 0X47, 0X0F, 0X00, 0X00, 0X04, 0X1B, 0X51, 0XB4, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XD1, 0X55, 0X11, 0X01, 0X00, 0X00, 0X00, 0X00, 0X05, 0X11,
-  0X1C, 0X20, 0X1C, 0X13, 0X08, 0X01, 0X12, 0X6E, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X01, 0X03, 0X06, 0X04, 0X01, 0X00, 0X00, 0X00,
-  0X00, 0X0A, 0X32, 0X75, 0XB8, 0XD1, 0XA9, 0X5E, 0X1E, 0X03, 0X00, 0X08,
-  0X3E, 0XB8, 0XFF, 0XFF, 0XFF, 0XFA, 0X8A, 0X2D, 0X07, 0X00, 0X00, 0X40,
-  0XFF, 0XFF, 0XFF, 0XFA, 0XE5, 0XCA, 0X91, 0X42, 0X0D, 0X00, 0X00, 0X00,
-  0X03, 0X1C, 0X59, 0XC3, 0XFF, 0XFF, 0XFF, 0XFF, 0XC6, 0X4D, 0X0F, 0X01,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X0A, 0X1E, 0X31, 0X37, 0X30, 0X1F, 0X0D,
-  0X02, 0X00, 0X12, 0X6E, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X02, 0X04, 0X03, 0X01, 0X00, 0X00, 0X00, 0X00, 0X05, 0X22, 0X5B,
-  0X9B, 0XB8, 0X99, 0X54, 0X18, 0X02, 0X00, 0X03, 0X29, 0X8F, 0XFF, 0XFF,
-  0XFF, 0XFF, 0X8D, 0X29, 0X05, 0X00, 0X00, 0X40, 0XEA, 0XFF, 0XFC, 0XE2,
-  0XD4, 0XBC, 0X84, 0X35, 0X08, 0X00, 0X00, 0X00, 0X13, 0X51, 0XB2, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XD6, 0X7C, 0X29, 0X06, 0X00, 0X00, 0X00, 0X00, 0X01,
-  0X12, 0X40, 0X7A, 0X9F, 0X9F, 0X7D, 0X47, 0X19, 0X05, 0X00, 0X11, 0X7E,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X02,
-  0X02, 0X01, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X0A, 0X2F, 0X65, 0X8F,
-  0X83, 0X46, 0X12, 0X01, 0X00, 0X00, 0X00, 0X08, 0X41, 0XC1, 0XFF, 0XFF,
-  0XFF, 0X9F, 0X2A, 0X03, 0X00, 0X00, 0X00, 0X12, 0X67, 0XD8, 0XFF, 0XED,
-  0XD1, 0XB4, 0X78, 0X2A, 0X05, 0X00, 0X00, 0X00, 0X04, 0X78, 0XE5, 0XE7,
-  0XDB, 0XD4, 0XCF, 0XBA, 0X8C, 0X40, 0X0E, 0X01, 0X00, 0X00, 0X00, 0X00,
-  0X0C, 0X39, 0X86, 0XE0, 0XFF, 0XFF, 0XFF, 0XD8, 0X75, 0X29, 0X08, 0X01,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X03, 0X0C, 0X12, 0X12, 0X0C, 0X06, 0X02,
-  0X00, 0X00, 0X11, 0X7E, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X01, 0X02, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X01, 0X15, 0X41, 0X70, 0X73, 0X3F, 0X0E, 0X01, 0X00, 0X00, 0X00, 0X00,
-  0X12, 0X6D, 0XF4, 0XFF, 0XFF, 0XAF, 0X2C, 0X03, 0X00, 0X00, 0X00, 0X00,
-  0X19, 0X84, 0XFC, 0XFF, 0XDD, 0XB6, 0X77, 0X26, 0X03, 0X00, 0X00, 0X00,
-  0X05, 0X73, 0XE0, 0XCD, 0XB4, 0XB4, 0XB6, 0XA7, 0X77, 0X2F, 0X07, 0X00,
-  0X00, 0X00, 0X02, 0X21, 0X59, 0XA5, 0XEA, 0XFF, 0XFF, 0XFF, 0XFF, 0XC8,
-  0X72, 0X2C, 0X0B, 0X01, 0X00, 0X00, 0X00, 0X03, 0X11, 0X2E, 0X50, 0X62,
-  0X5E, 0X45, 0X25, 0X0E, 0X03, 0X00, 0X21, 0X7E, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X11, 0X3E, 0X73, 0X78, 0X3F, 0X0D, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X06, 0X4D, 0XDD, 0XFF, 0XFF, 0XAF, 0X29, 0X02, 0X00, 0X00,
-  0X00, 0X00, 0X04, 0X4F, 0XE2, 0XFF, 0XE5, 0XB6, 0X77, 0X24, 0X02, 0X00,
-  0X00, 0X00, 0X00, 0X29, 0XA7, 0XCA, 0XAF, 0XAD, 0XAF, 0XA3, 0X72, 0X29,
-  0X05, 0X00, 0X00, 0X00, 0X03, 0X47, 0X91, 0XC3, 0XE2, 0XED, 0XED, 0XE5,
-  0XCD, 0X97, 0X53, 0X22, 0X0B, 0X02, 0X00, 0X00, 0X03, 0X12, 0X34, 0X65,
-  0X95, 0XB4, 0XAF, 0X8F, 0X58, 0X25, 0X0A, 0X01, 0X11, 0X8E, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X01, 0X04, 0X03, 0X01,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X01, 0X1D, 0X5B, 0X95, 0X8F, 0X46,
-  0X0D, 0X00, 0X00, 0X00, 0X00, 0X00, 0X05, 0X53, 0XEA, 0XFF, 0XFF, 0X9B,
-  0X21, 0X01, 0X00, 0X00, 0X00, 0X00, 0X01, 0X3B, 0XD6, 0XFF, 0XD6, 0XB2,
-  0X7A, 0X24, 0X02, 0X00, 0X00, 0X00, 0X00, 0X0B, 0X7C, 0XC3, 0XAB, 0XA7,
-  0XAB, 0XA1, 0X73, 0X29, 0X04, 0X00, 0X00, 0X00, 0X00, 0X25, 0X8A, 0XB8,
-  0XD1, 0XD8, 0XD8, 0XD1, 0XB6, 0X81, 0X3F, 0X18, 0X08, 0X02, 0X00, 0X00,
-  0X03, 0X16, 0X3F, 0X78, 0XAF, 0XD6, 0XDD, 0XC1, 0X84, 0X3F, 0X12, 0X03,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X01, 0X02, 0X02, 0X01, 0X00, 0X00,
-  0X00, 0X00, 0X12, 0X8E, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X01, 0X05, 0X09, 0X06, 0X01, 0X00, 0X00, 0X00, 0X00, 0X00, 0X08, 0X41,
-  0X95, 0XCD, 0XAD, 0X4D, 0X0E, 0X01, 0X00, 0X00, 0X00, 0X0C, 0X7C, 0XFF,
-  0XFF, 0XF4, 0X7C, 0X18, 0X00, 0X00, 0X00, 0X00, 0X01, 0X46, 0XDD, 0XED,
-  0XC1, 0XAB, 0X78, 0X25, 0X02, 0X00, 0X00, 0X00, 0X03, 0X65, 0XB4, 0XA1,
-  0XA3, 0XA7, 0XA3, 0X78, 0X2B, 0X05, 0X00, 0X00, 0X00, 0X05, 0X53, 0XA3,
-  0XCA, 0XD4, 0XD4, 0XCD, 0XB4, 0X7D, 0X3D, 0X15, 0X07, 0X02, 0X00, 0X00,
-  0X0B, 0X31, 0X6D, 0XA9, 0XD4, 0XE2, 0XCF, 0X99, 0X50, 0X1A, 0X04, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X02, 0X03, 0X02, 0X01, 0X00, 0X00, 0X00,
-  0X12, 0X8E, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X01, 0X07, 0X10,
-  0X13, 0X0A, 0X01, 0X00, 0X00, 0X00, 0X00, 0X01, 0X24, 0X81, 0XDD, 0XFF,
-  0XC1, 0X4F, 0X0E, 0X01, 0X00, 0X00, 0X00, 0X2A, 0XC3, 0XFF, 0XFF, 0XCA,
-  0X64, 0X12, 0X00, 0X00, 0X00, 0X00, 0X04, 0X68, 0XD8, 0XC6, 0XB2, 0XA7,
-  0X77, 0X25, 0X02, 0X00, 0X00, 0X00, 0X00, 0X51, 0XA5, 0X99, 0XA1, 0XA7,
-  0XA3, 0X7C, 0X30, 0X06, 0X00, 0X00, 0X00, 0X00, 0X15, 0X72, 0XC3, 0XDD,
-  0XDD, 0XD4, 0XBC, 0X88, 0X45, 0X18, 0X08, 0X02, 0X00, 0X00, 0X01, 0X15,
-  0X48, 0X88, 0XBC, 0XD4, 0XCA, 0X9B, 0X55, 0X1D, 0X05, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X01, 0X02, 0X02, 0X01, 0X00, 0X00, 0X00, 0X13, 0X8E,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X01, 0X09, 0X17, 0X22, 0X1E, 0X0E, 0X02,
-  0X00, 0X00, 0X00, 0X10, 0X61, 0XD8, 0XFF, 0XFF, 0XBF, 0X48, 0X0C, 0X01,
-  0X00, 0X08, 0X70, 0XFA, 0XFF, 0XE2, 0XAD, 0X53, 0X0E, 0X00, 0X00, 0X00,
-  0X0F, 0X8F, 0XBA, 0XAB, 0XAB, 0XA5, 0X75, 0X24, 0X02, 0X00, 0X00, 0X00,
-  0X31, 0X99, 0X9D, 0XA3, 0XA9, 0XA5, 0X7F, 0X33, 0X07, 0X00, 0X00, 0X00,
-  0X01, 0X31, 0X9F, 0XE2, 0XEF, 0XE5, 0XCD, 0X99, 0X53, 0X20, 0X0B, 0X03,
-  0X00, 0X00, 0X03, 0X21, 0X59, 0X8F, 0XAD, 0XAD, 0X8A, 0X4D, 0X1A, 0X05,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X01, 0X00, 0X00, 0X00, 0X00,
-  0X13, 0X8E, 0X00, 0X00, 0X00, 0X00, 0X00, 0X08, 0X1C, 0X2E, 0X35, 0X29,
-  0X11, 0X03, 0X00, 0X00, 0X05, 0X3F, 0XB4, 0XFF, 0XFF, 0XFF, 0XAF, 0X3E,
-  0X0B, 0X01, 0X00, 0X31, 0XBA, 0XF4, 0XE2, 0XC8, 0X9B, 0X47, 0X0B, 0X00,
-  0X00, 0X00, 0X27, 0X9F, 0X9F, 0XA3, 0XA9, 0XA1, 0X72, 0X24, 0X02, 0X00,
-  0X00, 0X00, 0X13, 0X86, 0XAF, 0XAB, 0XAB, 0XA7, 0X84, 0X3A, 0X08, 0X00,
-  0X00, 0X00, 0X00, 0X0A, 0X5E, 0XCA, 0XFF, 0XFF, 0XE5, 0XB6, 0X6B, 0X2F,
-  0X0F, 0X03, 0X00, 0X00, 0X00, 0X07, 0X29, 0X58, 0X7A, 0X7F, 0X67, 0X39,
-  0X12, 0X03, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X13, 0X7E, 0X00, 0X00, 0X00, 0X00, 0X05, 0X1A, 0X33, 0X45,
-  0X47, 0X33, 0X14, 0X03, 0X00, 0X01, 0X23, 0X83, 0XF4, 0XFF, 0XFF, 0XFF,
-  0X9B, 0X35, 0X09, 0X01, 0X0A, 0X75, 0XD4, 0XD6, 0XC8, 0XB8, 0X91, 0X41,
-  0X0A, 0X00, 0X00, 0X00, 0X3D, 0X9D, 0X97, 0XA1, 0XA7, 0XA1, 0X73, 0X25,
-  0X03, 0X00, 0X00, 0X00, 0X05, 0X62, 0XC3, 0XC3, 0XB8, 0XAD, 0X8D, 0X44,
-  0X0C, 0X00, 0X00, 0X00, 0X00, 0X01, 0X24, 0X8C, 0XED, 0XFF, 0XFF, 0XDD,
-  0X8F, 0X42, 0X14, 0X03, 0X00, 0X00, 0X00, 0X00, 0X0A, 0X24, 0X3D, 0X45,
-  0X39, 0X1E, 0X09, 0X01, 0X13, 0X7E, 0X00, 0X00, 0X00, 0X02, 0X12, 0X32,
-  0X4D, 0X5E, 0X58, 0X3B, 0X18, 0X04, 0X00, 0X0E, 0X55, 0XC3, 0XFF, 0XFF,
-  0XFF, 0XF4, 0X8A, 0X2F, 0X08, 0X01, 0X33, 0XA7, 0XC6, 0XBF, 0XBA, 0XB2,
-  0X8C, 0X3E, 0X0A, 0X00, 0X00, 0X00, 0X45, 0XA1, 0X9D, 0XA3, 0XA7, 0XA3,
-  0X77, 0X29, 0X04, 0X00, 0X00, 0X00, 0X01, 0X37, 0XB8, 0XE7, 0XD6, 0XC1,
-  0X9D, 0X57, 0X15, 0X01, 0X00, 0X00, 0X00, 0X00, 0X06, 0X3E, 0X9F, 0XEA,
-  0XFF, 0XEF, 0XA7, 0X4C, 0X15, 0X03, 0X00, 0X00, 0X00, 0X00, 0X00, 0X06,
-  0X0F, 0X13, 0X0F, 0X07, 0X02, 0X00, 0X12, 0X7E, 0X00, 0X00, 0X00, 0X00,
-  0X09, 0X25, 0X4B, 0X68, 0X75, 0X6A, 0X44, 0X1D, 0X06, 0X00, 0X03, 0X2D,
-  0X88, 0XEA, 0XFF, 0XFF, 0XFF, 0XE5, 0X7C, 0X2A, 0X08, 0X01, 0X05, 0X70,
-  0XAF, 0XB4, 0XB4, 0XB4, 0XAF, 0X8A, 0X3F, 0X0B, 0X00, 0X00, 0X00, 0X01,
-  0X37, 0XA5, 0XB6, 0XAB, 0XAD, 0XA7, 0X81, 0X33, 0X06, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X13, 0X78, 0XEA, 0XFF, 0XEF, 0XCA, 0X81, 0X2D, 0X07, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X0E, 0X41, 0X86, 0XAD, 0XAF, 0X83, 0X3E,
-  0X11, 0X02, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X01, 0X01,
-  0X00, 0X00, 0X00, 0X12, 0X7F, 0X00, 0X00, 0X00, 0X03, 0X14, 0X37, 0X5C,
-  0X77, 0X81, 0X70, 0X4A, 0X22, 0X09, 0X01, 0X00, 0X12, 0X51, 0XAB, 0XFA,
-  0XFF, 0XFF, 0XFF, 0XE0, 0X7C, 0X30, 0X0C, 0X01, 0X00, 0X12, 0X99, 0XB2,
-  0XA9, 0XAD, 0XB4, 0XAF, 0X8D, 0X42, 0X0E, 0X01, 0X00, 0X00, 0X00, 0X00,
-  0X21, 0X97, 0XD1, 0XC3, 0XBA, 0XAF, 0X8C, 0X3E, 0X09, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X04, 0X3B, 0XB2, 0XFF, 0XFF, 0XFF, 0XBF, 0X55, 0X13,
-  0X01, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X01, 0X11, 0X33, 0X4F, 0X59,
-  0X4B, 0X28, 0X0C, 0X01, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X12, 0X6E, 0X00, 0X00, 0X00,
-  0X04, 0X13, 0X2E, 0X4B, 0X61, 0X6A, 0X5F, 0X44, 0X24, 0X0C, 0X03, 0X21,
-  0X61, 0XB4, 0XF7, 0XFF, 0XFF, 0XFF, 0XFC, 0X9F, 0X4A, 0X18, 0X05, 0X25,
-  0XAF, 0XBC, 0XAD, 0XB4, 0XBC, 0XB6, 0X95, 0X4F, 0X15, 0X02, 0X00, 0X00,
-  0X00, 0X18, 0X81, 0XDD, 0XE5, 0XCF, 0XBC, 0X97, 0X4B, 0X0E, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X01, 0X1D, 0X7A, 0XED, 0XFF, 0XFF, 0XEA, 0X75, 0X1E,
-  0X03, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X03, 0X12, 0X24, 0X31, 0X30,
-  0X1E, 0X0A, 0X01, 0X12, 0X6F, 0X00, 0X00, 0X00, 0X00, 0X03, 0X0C, 0X1A,
-  0X29, 0X34, 0X3A, 0X31, 0X21, 0X0F, 0X03, 0X01, 0X10, 0X3A, 0X7C, 0XCF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XE7, 0X84, 0X3A, 0X10, 0X02, 0X27, 0XBA, 0XD6,
-  0XC8, 0XCA, 0XCF, 0XCA, 0XAD, 0X68, 0X24, 0X06, 0X00, 0X00, 0X00, 0X00,
-  0X18, 0X7D, 0XE7, 0XF2, 0XDD, 0XC8, 0XA3, 0X59, 0X14, 0X01, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X17, 0X72, 0XEF, 0XFF, 0XFF, 0XF2, 0X7A, 0X1E,
-  0X03, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X02, 0X12, 0X29, 0X3A,
-  0X39, 0X25, 0X0E, 0X02, 0X00, 0X12, 0X6F, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X02, 0X09, 0X15, 0X23, 0X29, 0X24, 0X15, 0X05, 0X00, 0X00, 0X05,
-  0X1E, 0X55, 0XAB, 0XFF, 0XFF, 0XFF, 0XFF, 0XB4, 0X54, 0X1A, 0X04, 0X05,
-  0X5F, 0XBA, 0XE7, 0XFC, 0XFF, 0XF2, 0XD1, 0X86, 0X34, 0X0B, 0X01, 0X00,
-  0X00, 0X01, 0X2B, 0XA5, 0XEF, 0XE5, 0XD1, 0XC8, 0XA9, 0X62, 0X19, 0X01,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X02, 0X2A, 0XA5, 0XFF, 0XFF, 0XFF, 0XDD,
-  0X67, 0X18, 0X02, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X0D, 0X33,
-  0X5E, 0X72, 0X64, 0X3A, 0X14, 0X03, 0X00, 0X12, 0X7F, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X01, 0X09, 0X1E, 0X38, 0X45, 0X3C, 0X22, 0X09, 0X00,
-  0X00, 0X00, 0X03, 0X24, 0X78, 0XED, 0XFF, 0XFF, 0XFF, 0XA7, 0X42, 0X12,
-  0X03, 0X00, 0X09, 0X4F, 0XBC, 0XFF, 0XFF, 0XFC, 0XD6, 0X88, 0X33, 0X09,
-  0X00, 0X00, 0X00, 0X00, 0X2F, 0XD8, 0XED, 0XCD, 0XC6, 0XC3, 0XAB, 0X62,
-  0X18, 0X01, 0X00, 0X00, 0X00, 0X00, 0X00, 0X08, 0X54, 0XE0, 0XFF, 0XFF,
-  0XF7, 0XAF, 0X4D, 0X0F, 0X01, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X04,
-  0X2B, 0X73, 0XAD, 0XBA, 0X99, 0X58, 0X1E, 0X05, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X01, 0X00, 0X00, 0X00, 0X00, 0X13,
-  0X7F, 0X00, 0X00, 0X00, 0X00, 0X00, 0X03, 0X15, 0X37, 0X58, 0X62, 0X4D,
-  0X28, 0X09, 0X00, 0X00, 0X01, 0X24, 0X88, 0XFC, 0XFF, 0XFF, 0XF2, 0X7C,
-  0X29, 0X08, 0X01, 0X01, 0X2D, 0XA7, 0XFF, 0XFF, 0XE5, 0XC3, 0X7D, 0X2A,
-  0X05, 0X00, 0X00, 0X00, 0X1D, 0XCF, 0XCD, 0XB4, 0XB8, 0XBA, 0XA3, 0X5B,
-  0X15, 0X01, 0X00, 0X00, 0X00, 0X00, 0X15, 0X83, 0XF4, 0XFF, 0XEA, 0XC8,
-  0X8D, 0X38, 0X09, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X15, 0X64, 0XC8,
-  0XFF, 0XFF, 0XD4, 0X7A, 0X2D, 0X09, 0X01, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X05, 0X09, 0X08, 0X05, 0X02, 0X00, 0X00, 0X13, 0X7F, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X01, 0X10, 0X2F, 0X4D, 0X58, 0X44, 0X20, 0X06, 0X00,
-  0X00, 0X00, 0X15, 0X67, 0XE5, 0XFF, 0XFF, 0XED, 0X72, 0X21, 0X05, 0X00,
-  0X00, 0X13, 0X7C, 0XED, 0XFC, 0XE0, 0XC1, 0X7D, 0X29, 0X04, 0X00, 0X00,
-  0X00, 0X17, 0XAD, 0XB2, 0XA5, 0XAD, 0XB4, 0XA1, 0X59, 0X14, 0X01, 0X00,
-  0X00, 0X00, 0X02, 0X3C, 0XB4, 0XDB, 0XCF, 0XC6, 0XB2, 0X7C, 0X2F, 0X07,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X09, 0X4B, 0XBF, 0XFF, 0XFF, 0XFF, 0XEF,
-  0X91, 0X3C, 0X0F, 0X02, 0X00, 0X00, 0X00, 0X00, 0X01, 0X0C, 0X1D, 0X24,
-  0X20, 0X13, 0X07, 0X01, 0X00, 0X13, 0X7F, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X04, 0X14, 0X29, 0X34, 0X2A, 0X13, 0X03, 0X00, 0X00, 0X00, 0X06,
-  0X3B, 0XA5, 0XFF, 0XFF, 0XF4, 0X7F, 0X25, 0X06, 0X00, 0X00, 0X06, 0X4D,
-  0XCF, 0XFF, 0XF2, 0XCA, 0X86, 0X2D, 0X04, 0X00, 0X00, 0X00, 0X14, 0X8A,
-  0XB2, 0XA5, 0XA9, 0XAD, 0X9F, 0X59, 0X15, 0X01, 0X00, 0X00, 0X00, 0X11,
-  0X7C, 0XB4, 0XB2, 0XB2, 0XB6, 0XA7, 0X75, 0X2B, 0X06, 0X00, 0X00, 0X00,
-  0X00, 0X03, 0X32, 0X99, 0XF7, 0XFF, 0XFF, 0XFF, 0XE2, 0X8D, 0X44, 0X16,
-  0X03, 0X00, 0X00, 0X00, 0X01, 0X0F, 0X2E, 0X48, 0X51, 0X45, 0X2A, 0X12,
-  0X04, 0X00, 0X13, 0X7F, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X03,
-  0X0B, 0X14, 0X14, 0X0A, 0X01, 0X00, 0X00, 0X00, 0X00, 0X14, 0X58, 0XB4,
-  0XF7, 0XEA, 0X8A, 0X2E, 0X07, 0X00, 0X00, 0X00, 0X20, 0X91, 0XFF, 0XFF,
-  0XEF, 0XA1, 0X3B, 0X05, 0X00, 0X00, 0X00, 0X0A, 0X61, 0XB6, 0XB6, 0XAD,
-  0XAD, 0X9F, 0X5C, 0X16, 0X01, 0X00, 0X00, 0X00, 0X38, 0X97, 0X99, 0X99,
-  0XA3, 0XAB, 0XA1, 0X6E, 0X28, 0X06, 0X00, 0X00, 0X00, 0X01, 0X1C, 0X72,
-  0XC8, 0XF2, 0XFF, 0XFC, 0XEA, 0XB8, 0X77, 0X3F, 0X1A, 0X05, 0X00, 0X00,
-  0X00, 0X0D, 0X33, 0X65, 0X86, 0X8D, 0X7A, 0X50, 0X24, 0X0B, 0X01, 0X13,
-  0X8F, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X01, 0X06, 0X0A,
-  0X06, 0X01, 0X00, 0X00, 0X00, 0X00, 0X01, 0X1C, 0X5E, 0XA9, 0XC6, 0X8D,
-  0X37, 0X09, 0X00, 0X00, 0X00, 0X03, 0X3D, 0XCA, 0XFF, 0XFF, 0XD8, 0X57,
-  0X0A, 0X00, 0X00, 0X00, 0X00, 0X23, 0X97, 0XD6, 0XC1, 0XB4, 0XA3, 0X64,
-  0X18, 0X01, 0X00, 0X00, 0X00, 0X34, 0X8F, 0X91, 0X91, 0X9D, 0XA7, 0X9D,
-  0X6A, 0X24, 0X05, 0X00, 0X00, 0X00, 0X0D, 0X4F, 0X9B, 0XC3, 0XCD, 0XD1,
-  0XCF, 0XB8, 0X88, 0X51, 0X2D, 0X17, 0X06, 0X00, 0X00, 0X0C, 0X34, 0X73,
-  0XB2, 0XD8, 0XDD, 0XC3, 0X8C, 0X4A, 0X19, 0X04, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X01, 0X02, 0X01, 0X01, 0X00, 0X00, 0X00, 0X00, 0X13, 0X8F, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X04, 0X0A, 0X07, 0X01,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X07, 0X39, 0X8C, 0XC1, 0X9B, 0X41, 0X0C,
-  0X01, 0X00, 0X00, 0X00, 0X0D, 0X7F, 0XFF, 0XFF, 0XFA, 0X70, 0X0F, 0X00,
-  0X00, 0X00, 0X00, 0X03, 0X4A, 0XD6, 0XE7, 0XC3, 0XAB, 0X6D, 0X1C, 0X01,
-  0X00, 0X00, 0X00, 0X0D, 0X6B, 0XA3, 0X97, 0X9D, 0XA7, 0X9D, 0X6B, 0X23,
-  0X04, 0X00, 0X00, 0X00, 0X24, 0X78, 0X97, 0XA7, 0XAF, 0XB8, 0XB6, 0XA1,
-  0X6D, 0X38, 0X1A, 0X0E, 0X06, 0X00, 0X09, 0X2E, 0X6E, 0XB4, 0XEA, 0XFF,
-  0XFF, 0XFF, 0XC6, 0X72, 0X2C, 0X07, 0X00, 0X00, 0X00, 0X00, 0X03, 0X08,
-  0X0D, 0X0C, 0X07, 0X02, 0X00, 0X00, 0X00, 0X13, 0X8F, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X02, 0X0C, 0X13, 0X0D, 0X03, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X08, 0X4C, 0XB6, 0XEF, 0XB6, 0X4C, 0X10, 0X01, 0X00,
-  0X00, 0X00, 0X05, 0X73, 0XFF, 0XFF, 0XEF, 0X62, 0X0D, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X22, 0XC8, 0XF7, 0XC8, 0XAD, 0X6E, 0X1B, 0X01, 0X00, 0X00,
-  0X00, 0X00, 0X34, 0XA7, 0XA3, 0X9F, 0XA9, 0XA1, 0X6E, 0X24, 0X03, 0X00,
-  0X00, 0X00, 0X0D, 0X75, 0X93, 0X9F, 0XA9, 0XB6, 0XB4, 0X9F, 0X6A, 0X32,
-  0X15, 0X0B, 0X05, 0X00, 0X0D, 0X3A, 0X7D, 0XBC, 0XEF, 0XFF, 0XFF, 0XFF,
-  0XCF, 0X7A, 0X30, 0X08, 0X00, 0X00, 0X00, 0X01, 0X06, 0X0D, 0X13, 0X12,
-  0X0C, 0X04, 0X00, 0X00, 0X00, 0X13, 0X8F, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X03, 0X13, 0X27, 0X29, 0X18, 0X05, 0X00, 0X00, 0X00, 0X00,
-  0X01, 0X2E, 0XAB, 0XFF, 0XFF, 0XBC, 0X48, 0X10, 0X01, 0X00, 0X00, 0X00,
-  0X1A, 0XC8, 0XFF, 0XFF, 0XB8, 0X44, 0X07, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X44, 0XE0, 0XD4, 0XBA, 0XA9, 0X65, 0X17, 0X01, 0X00, 0X00, 0X00, 0X00,
-  0X3B, 0XA5, 0X9B, 0X9F, 0XAB, 0XA3, 0X6E, 0X24, 0X03, 0X00, 0X00, 0X00,
-  0X02, 0X4D, 0X95, 0XAF, 0XBC, 0XC6, 0XC3, 0XAF, 0X7C, 0X41, 0X1F, 0X0F,
-  0X04, 0X00, 0X02, 0X18, 0X4D, 0X8D, 0XC3, 0XE5, 0XED, 0XD6, 0X9D, 0X57,
-  0X1E, 0X04, 0X00, 0X00, 0X00, 0X00, 0X01, 0X03, 0X05, 0X05, 0X03, 0X00,
-  0X00, 0X00, 0X00, 0X13, 0X8F, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X04,
-  0X1B, 0X3C, 0X50, 0X45, 0X24, 0X08, 0X00, 0X00, 0X00, 0X00, 0X1E, 0X9B,
-  0XFF, 0XFF, 0XFF, 0XA1, 0X39, 0X0D, 0X01, 0X00, 0X00, 0X09, 0X88, 0XFF,
-  0XFF, 0XDD, 0X8F, 0X33, 0X05, 0X00, 0X00, 0X00, 0X00, 0X14, 0XA3, 0XC3,
-  0XAF, 0XB4, 0XA5, 0X5F, 0X14, 0X01, 0X00, 0X00, 0X00, 0X03, 0X6A, 0X9D,
-  0X9D, 0XA7, 0XAF, 0XA7, 0X75, 0X28, 0X03, 0X00, 0X00, 0X00, 0X00, 0X14,
-  0X64, 0XB8, 0XE7, 0XF7, 0XF7, 0XE5, 0XB4, 0X6E, 0X37, 0X13, 0X03, 0X00,
-  0X00, 0X01, 0X0C, 0X29, 0X50, 0X6E, 0X78, 0X6B, 0X4A, 0X24, 0X0A, 0X01,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X13, 0X7F, 0X00, 0X00, 0X00, 0X00, 0X00, 0X02, 0X18, 0X40, 0X67,
-  0X72, 0X57, 0X2D, 0X0A, 0X00, 0X00, 0X00, 0X0E, 0X6E, 0XFA, 0XFF, 0XFF,
-  0XF7, 0X81, 0X2B, 0X09, 0X01, 0X00, 0X03, 0X54, 0XE5, 0XFF, 0XE2, 0XC6,
-  0X83, 0X2B, 0X04, 0X00, 0X00, 0X00, 0X03, 0X6E, 0XB8, 0XA5, 0XAD, 0XB6,
-  0XA3, 0X5F, 0X15, 0X01, 0X00, 0X00, 0X00, 0X03, 0X4F, 0XA9, 0XC8, 0XCA,
-  0XC8, 0XB6, 0X86, 0X34, 0X07, 0X00, 0X00, 0X00, 0X00, 0X00, 0X11, 0X50,
-  0XA9, 0XF4, 0XFF, 0XFF, 0XE7, 0X8F, 0X3E, 0X10, 0X02, 0X00, 0X00, 0X00,
-  0X00, 0X01, 0X08, 0X14, 0X1C, 0X1A, 0X13, 0X09, 0X03, 0X00, 0X13, 0X7F,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X0D, 0X33, 0X65, 0X8A, 0X8A, 0X64, 0X32,
-  0X0B, 0X00, 0X00, 0X03, 0X38, 0XBA, 0XFF, 0XFF, 0XFF, 0XDD, 0X65, 0X21,
-  0X06, 0X01, 0X00, 0X21, 0XA5, 0XED, 0XE5, 0XD4, 0XBC, 0X7C, 0X28, 0X04,
-  0X00, 0X00, 0X00, 0X0D, 0XA5, 0XBA, 0XAD, 0XB6, 0XBA, 0XA9, 0X65, 0X17,
-  0X01, 0X00, 0X00, 0X00, 0X00, 0X13, 0X6D, 0XD8, 0XFF, 0XFC, 0XDD, 0XA5,
-  0X4B, 0X0E, 0X01, 0X00, 0X00, 0X00, 0X00, 0X00, 0X0D, 0X40, 0X8D, 0XCD,
-  0XE0, 0XC6, 0X7F, 0X34, 0X0D, 0X01, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X01, 0X03, 0X03, 0X03, 0X01, 0X00, 0X00, 0X13, 0X7F, 0X00, 0X00, 0X00,
-  0X00, 0X03, 0X1E, 0X50, 0X88, 0XAB, 0X9F, 0X70, 0X35, 0X0C, 0X00, 0X00,
-  0X10, 0X67, 0XED, 0XFF, 0XFF, 0XFF, 0XC1, 0X53, 0X18, 0X04, 0X00, 0X03,
-  0X58, 0XCD, 0XE0, 0XD6, 0XCD, 0XB8, 0X78, 0X26, 0X04, 0X00, 0X00, 0X00,
-  0X08, 0X83, 0XCD, 0XC6, 0XC1, 0XC1, 0XAD, 0X6B, 0X19, 0X01, 0X00, 0X00,
-  0X00, 0X00, 0X01, 0X29, 0XA3, 0XFF, 0XFF, 0XFF, 0XCF, 0X65, 0X18, 0X02,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X12, 0X46, 0X81, 0XA1, 0X9B, 0X6B,
-  0X2E, 0X0A, 0X01, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X13, 0X6F, 0X00, 0X00, 0X00, 0X00, 0X09, 0X31,
-  0X6E, 0XAB, 0XC8, 0XB2, 0X78, 0X39, 0X0D, 0X00, 0X01, 0X21, 0X8D, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XA7, 0X42, 0X12, 0X03, 0X00, 0X04, 0X7C, 0XDD, 0XD4,
-  0XCD, 0XCA, 0XB8, 0X75, 0X24, 0X03, 0X00, 0X00, 0X00, 0X01, 0X46, 0XC8,
-  0XE2, 0XCD, 0XC6, 0XAF, 0X6D, 0X1A, 0X01, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X0D, 0X6B, 0XF7, 0XFF, 0XFF, 0XE0, 0X70, 0X1C, 0X03, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X06, 0X2D, 0X68, 0X91, 0X95, 0X6B, 0X2F, 0X0B, 0X01,
-  0X03, 0X7E, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X01,
-  0X01, 0X00, 0X00, 0X00, 0X00, 0X00, 0X0E, 0X3E, 0X83, 0XBF, 0XDB, 0XBF,
-  0X7C, 0X39, 0X00, 0X01, 0X29, 0X9D, 0XFF, 0XFF, 0XFF, 0XFA, 0X95, 0X38,
-  0X0C, 0X01, 0X01, 0X72, 0XD8, 0XCD, 0XC6, 0XC6, 0XB4, 0X72, 0X21, 0X02,
-  0X00, 0X00, 0X00, 0X29, 0XB8, 0XE0, 0XC8, 0XC1, 0XAD, 0X68, 0X18, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X08, 0X6A, 0XFA, 0XFF, 0XFF, 0XC8, 0X5F, 0X15,
-  0X01, 0X00, 0X00, 0X00, 0X00, 0X00, 0X08, 0X3E, 0X8C, 0XBC, 0XBA, 0X83,
-  0X39, 0X0D, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X01, 0X01,
-  0X01, 0X00, 0X13, 0X7F, 0X00, 0X00, 0X00, 0X00, 0X09, 0X33, 0X75, 0XB4,
-  0XD1, 0XB8, 0X75, 0X33, 0X0B, 0X00, 0X00, 0X17, 0X7F, 0XFA, 0XFF, 0XFF,
-  0XF4, 0X8F, 0X32, 0X0A, 0X01, 0X00, 0X00, 0X42, 0XC3, 0XCD, 0XC1, 0XC1,
-  0XB2, 0X6D, 0X1C, 0X01, 0X00, 0X00, 0X00, 0X00, 0X3A, 0XBF, 0XBC, 0XB6,
-  0XB8, 0XA7, 0X5F, 0X13, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X1F, 0XAF,
-  0XFF, 0XFF, 0XDB, 0XA1, 0X47, 0X0C, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X01, 0X29, 0X8A, 0XE2, 0XFF, 0XED, 0X9B, 0X41, 0X0F, 0X01, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X02, 0X07, 0X09, 0X07, 0X03, 0X01, 0X00, 0X03,
-  0X7F, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X01,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X01, 0X1A, 0X50, 0X8D, 0XB2, 0XA3,
-  0X67, 0X2A, 0X08, 0X00, 0X00, 0X04, 0X45, 0XCD, 0XFF, 0XFF, 0XFF, 0X95,
-  0X32, 0X09, 0X01, 0X00, 0X00, 0X18, 0X9B, 0XDD, 0XCF, 0XC6, 0XAF, 0X6D,
-  0X1B, 0X01, 0X00, 0X00, 0X00, 0X01, 0X68, 0XAF, 0XA3, 0XAD, 0XB6, 0XA3,
-  0X59, 0X11, 0X00, 0X00, 0X00, 0X00, 0X00, 0X08, 0X70, 0XE2, 0XEA, 0XDB,
-  0XC3, 0X8D, 0X3B, 0X09, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X1B, 0X77,
-  0XE5, 0XFF, 0XFF, 0XFF, 0XA5, 0X44, 0X10, 0X01, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X02, 0X0E, 0X17, 0X17, 0X0E, 0X06, 0X01, 0X00, 0X03, 0X7F, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X09, 0X32, 0X6A, 0X93, 0X8D, 0X59, 0X22,
-  0X06, 0X00, 0X00, 0X00, 0X1C, 0X93, 0XFF, 0XFF, 0XFF, 0XA1, 0X34, 0X08,
-  0X01, 0X00, 0X00, 0X06, 0X6D, 0XE7, 0XE7, 0XCD, 0XB4, 0X6D, 0X1A, 0X01,
-  0X00, 0X00, 0X00, 0X03, 0X73, 0XAD, 0XA3, 0XAF, 0XB6, 0XA1, 0X57, 0X10,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X31, 0XA9, 0XD6, 0XD1, 0XCD, 0XBC, 0X88,
-  0X37, 0X08, 0X00, 0X00, 0X00, 0X00, 0X00, 0X0A, 0X4B, 0XB8, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XA5, 0X42, 0X0F, 0X01, 0X00, 0X00, 0X00, 0X00, 0X01, 0X0B,
-  0X1C, 0X24, 0X1E, 0X11, 0X06, 0X01, 0X00, 0X13, 0X7F, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X03, 0X1F, 0X50, 0X7A, 0X78, 0X4B, 0X1B, 0X04, 0X00, 0X00,
-  0X00, 0X0A, 0X68, 0XF4, 0XFF, 0XFF, 0XAB, 0X37, 0X08, 0X00, 0X00, 0X00,
-  0X01, 0X47, 0XE0, 0XFF, 0XDB, 0XB6, 0X6D, 0X19, 0X01, 0X00, 0X00, 0X00,
-  0X03, 0X67, 0XBA, 0XAB, 0XAF, 0XB6, 0XA1, 0X55, 0X10, 0X00, 0X00, 0X00,
-  0X00, 0X04, 0X64, 0XBA, 0XC8, 0XC8, 0XC8, 0XBA, 0X84, 0X34, 0X07, 0X00,
-  0X00, 0X00, 0X00, 0X01, 0X1E, 0X70, 0XD8, 0XFF, 0XFF, 0XFF, 0XFF, 0XA1,
-  0X40, 0X0F, 0X01, 0X00, 0X00, 0X00, 0X00, 0X03, 0X12, 0X24, 0X2A, 0X21,
-  0X12, 0X06, 0X01, 0X00, 0X13, 0X7F, 0X00, 0X00, 0X00, 0X00, 0X00, 0X01,
-  0X14, 0X3E, 0X67, 0X6A, 0X41, 0X16, 0X03, 0X00, 0X00, 0X00, 0X03, 0X4A,
-  0XDB, 0XFF, 0XFF, 0XB4, 0X39, 0X08, 0X00, 0X00, 0X00, 0X00, 0X2C, 0XCD,
-  0XFF, 0XEA, 0XBA, 0X6E, 0X18, 0X01, 0X00, 0X00, 0X00, 0X01, 0X53, 0XC1,
-  0XB6, 0XB2, 0XB6, 0XA3, 0X54, 0X0F, 0X00, 0X00, 0X00, 0X00, 0X08, 0X83,
-  0XBF, 0XC1, 0XC6, 0XC8, 0XBA, 0X83, 0X32, 0X07, 0X00, 0X00, 0X00, 0X00,
-  0X04, 0X2E, 0X86, 0XEA, 0XFF, 0XFF, 0XFF, 0XFF, 0XA1, 0X40, 0X0F, 0X01,
-  0X00, 0X00, 0X00, 0X00, 0X06, 0X17, 0X2A, 0X30, 0X26, 0X15, 0X07, 0X01,
-  0X00, 0X13, 0X7F, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X0F, 0X37, 0X5F,
-  0X65, 0X3D, 0X13, 0X02, 0X00, 0X00, 0X00, 0X01, 0X38, 0XCA, 0XFF, 0XFF,
-  0XB6, 0X37, 0X07, 0X00, 0X00, 0X00, 0X00, 0X1B, 0XBA, 0XFF, 0XF4, 0XBF,
-  0X6E, 0X18, 0X00, 0X00, 0X00, 0X00, 0X00, 0X3D, 0XC6, 0XC1, 0XB6, 0XB8,
-  0XA3, 0X54, 0X0E, 0X00, 0X00, 0X00, 0X00, 0X0A, 0X93, 0XBF, 0XBF, 0XC3,
-  0XC6, 0XB8, 0X81, 0X30, 0X06, 0X00, 0X00, 0X00, 0X00, 0X07, 0X3B, 0X97,
-  0XF2, 0XFF, 0XFF, 0XFF, 0XFC, 0XA1, 0X41, 0X0F, 0X01, 0X00, 0X00, 0X00,
-  0X00, 0X09, 0X1C, 0X33, 0X39, 0X2D, 0X19, 0X09, 0X01, 0X00, 0X13, 0X7E,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X0E, 0X37, 0X62, 0X67, 0X3C, 0X13,
-  0X00, 0X00, 0X00, 0X00, 0X2D, 0XBF, 0XFF, 0XFF, 0XB4, 0X34, 0X06, 0X00,
-  0X00, 0X00, 0X10, 0XA7, 0XFF, 0XFA, 0XC1, 0X70, 0X17, 0X00, 0X00, 0X00,
-  0X00, 0X29, 0XC1, 0XCD, 0XB6, 0XB8, 0XA5, 0X54, 0X0E, 0X00, 0X00, 0X00,
-  0X05, 0X8D, 0XC3, 0XBF, 0XC3, 0XC6, 0XB8, 0X81, 0X2F, 0X05, 0X00, 0X00,
-  0X00, 0X08, 0X3D, 0X99, 0XF4, 0XFF, 0XFF, 0XFF, 0XFA, 0X9F, 0X42, 0X10,
-  0X00, 0X00, 0X00, 0X01, 0X0A, 0X1E, 0X37, 0X3E, 0X34, 0X1F, 0X0B, 0X02,
-  0X13, 0X7D, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X11, 0X40, 0X6E, 0X70,
-  0X40, 0X00, 0X00, 0X00, 0X00, 0X2E, 0XC6, 0XFF, 0XFF, 0XA9, 0X2E, 0X05,
-  0X00, 0X00, 0X0C, 0XA1, 0XFF, 0XF7, 0XBF, 0X6D, 0X17, 0X00, 0X00, 0X00,
-  0X1B, 0XBA, 0XCF, 0XB6, 0XB8, 0XA5, 0X54, 0X0E, 0X00, 0X00, 0X01, 0X75,
-  0XC8, 0XBF, 0XC3, 0XC6, 0XB8, 0X83, 0X2E, 0X05, 0X00, 0X00, 0X05, 0X37,
-  0X93, 0XF2, 0XFF, 0XFF, 0XFF, 0XFA, 0XA1, 0X44, 0X00, 0X00, 0X00, 0X00,
-  0X08, 0X1D, 0X37, 0X41, 0X39, 0X22, 0X0D, 0X13, 0X7F, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X01, 0X1B, 0X55, 0X86, 0X83, 0X48, 0X15, 0X03, 0X00, 0X00,
-  0X00, 0X01, 0X3C, 0XE0, 0XFF, 0XFF, 0X99, 0X27, 0X03, 0X00, 0X00, 0X00,
-  0X00, 0X0D, 0XAB, 0XFF, 0XEA, 0XB8, 0X6B, 0X15, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X15, 0XB4, 0XCA, 0XB6, 0XB6, 0XA5, 0X54, 0X0D, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X51, 0XC8, 0XC3, 0XC6, 0XC8, 0XBA, 0X83, 0X2F, 0X05, 0X00,
-  0X00, 0X00, 0X00, 0X02, 0X27, 0X83, 0XE5, 0XFF, 0XFF, 0XFF, 0XFA, 0X9F,
-  0X44, 0X11, 0X01, 0X00, 0X00, 0X00, 0X00, 0X06, 0X18, 0X32, 0X3E, 0X39,
-  0X23, 0X0E, 0X03, 0X00, 0X04, 0X7E, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X01, 0X01, 0X01, 0X00, 0X00, 0X00, 0X00, 0X03, 0X2F, 0X75,
-  0XA5, 0X97, 0X50, 0X17, 0X00, 0X00, 0X03, 0X5B, 0XFC, 0XFF, 0XFC, 0X84,
-  0X1F, 0X02, 0X00, 0X00, 0X14, 0XC3, 0XFF, 0XD8, 0XB4, 0X68, 0X13, 0X00,
-  0X00, 0X00, 0X15, 0XB4, 0XBF, 0XB4, 0XB8, 0XA3, 0X53, 0X0C, 0X00, 0X00,
-  0X00, 0X30, 0XBC, 0XCA, 0XCA, 0XCA, 0XBA, 0X83, 0X2F, 0X05, 0X00, 0X00,
-  0X00, 0X15, 0X67, 0XD4, 0XFF, 0XFF, 0XFF, 0XFA, 0X9F, 0X42, 0X10, 0X00,
-  0X00, 0X00, 0X03, 0X12, 0X29, 0X38, 0X33, 0X21, 0X0D, 0X03, 0X04, 0X7E,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X01, 0X02, 0X03, 0X01, 0X00,
-  0X00, 0X00, 0X00, 0X0D, 0X4C, 0X9B, 0XC6, 0XA7, 0X58, 0X1A, 0X00, 0X00,
-  0X0B, 0X8A, 0XFF, 0XFF, 0XE7, 0X72, 0X19, 0X02, 0X00, 0X00, 0X26, 0XD8,
-  0XEF, 0XC8, 0XAD, 0X62, 0X12, 0X00, 0X00, 0X00, 0X19, 0XB2, 0XB2, 0XAF,
-  0XB6, 0XA3, 0X53, 0X0C, 0X00, 0X00, 0X00, 0X17, 0XA3, 0XD4, 0XD4, 0XCD,
-  0XBC, 0X84, 0X31, 0X05, 0X00, 0X00, 0X00, 0X08, 0X47, 0XB2, 0XFF, 0XFF,
-  0XFF, 0XFA, 0X9F, 0X41, 0X0F, 0X00, 0X00, 0X00, 0X01, 0X0A, 0X1C, 0X2B,
-  0X29, 0X1C, 0X0B, 0X02, 0X04, 0X7E, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X03, 0X05, 0X04, 0X02, 0X00, 0X00, 0X00, 0X01, 0X22, 0X73, 0XC3,
-  0XE2, 0XB4, 0X5E, 0X1C, 0X00, 0X00, 0X22, 0XC1, 0XFF, 0XFF, 0XCF, 0X61,
-  0X14, 0X01, 0X00, 0X00, 0X48, 0XE0, 0XD4, 0XBF, 0XA9, 0X5F, 0X11, 0X00,
-  0X00, 0X00, 0X1C, 0XAF, 0XA7, 0XAD, 0XB4, 0XA1, 0X53, 0X0C, 0X00, 0X00,
-  0X00, 0X07, 0X78, 0XD8, 0XDD, 0XD4, 0XBF, 0X88, 0X33, 0X06, 0X00, 0X00,
-  0X00, 0X01, 0X28, 0X86, 0XEA, 0XFF, 0XFF, 0XF7, 0X9B, 0X3F, 0X0E, 0X00,
-  0X00, 0X00, 0X00, 0X04, 0X12, 0X1D, 0X1E, 0X14, 0X08, 0X02, 0X04, 0X7F,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X01, 0X05, 0X07, 0X05, 0X02, 0X00,
-  0X00, 0X00, 0X00, 0X07, 0X3F, 0X99, 0XE2, 0XF2, 0XBA, 0X5F, 0X1E, 0X04,
-  0X00, 0X02, 0X4D, 0XEA, 0XFF, 0XFF, 0XBC, 0X58, 0X12, 0X01, 0X00, 0X00,
-  0X03, 0X73, 0XD4, 0XC1, 0XB8, 0XA5, 0X5B, 0X0F, 0X00, 0X00, 0X00, 0X00,
-  0X1E, 0XAB, 0XA5, 0XAD, 0XB4, 0X9F, 0X51, 0X0C, 0X00, 0X00, 0X00, 0X00,
-  0X01, 0X4C, 0XD1, 0XEF, 0XE0, 0XC3, 0X8D, 0X35, 0X07, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X10, 0X5C, 0XC1, 0XFF, 0XFF, 0XEF, 0X95, 0X3C, 0X0D, 0X01,
-  0X00, 0X00, 0X00, 0X00, 0X01, 0X09, 0X12, 0X13, 0X0E, 0X06, 0X01, 0X00,
-  0X04, 0X7E, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X03, 0X07, 0X08, 0X05,
-  0X02, 0X00, 0X00, 0X00, 0X14, 0X5C, 0XB8, 0XF4, 0XFA, 0XBC, 0X61, 0X1E,
-  0X00, 0X0A, 0X81, 0XFF, 0XFF, 0XF2, 0XB2, 0X51, 0X10, 0X01, 0X00, 0X0C,
-  0X97, 0XC3, 0XB6, 0XB6, 0XA3, 0X55, 0X0E, 0X00, 0X00, 0X00, 0X1A, 0XA7,
-  0XAD, 0XAF, 0XB2, 0X9F, 0X50, 0X0B, 0X00, 0X00, 0X00, 0X00, 0X2A, 0XBC,
-  0XFC, 0XED, 0XCA, 0X91, 0X39, 0X07, 0X00, 0X00, 0X00, 0X00, 0X05, 0X3C,
-  0X9D, 0XE7, 0XFF, 0XE2, 0X8C, 0X37, 0X0C, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X04, 0X09, 0X0B, 0X08, 0X03, 0X01, 0X04, 0X7E, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X01, 0X04, 0X08, 0X09, 0X06, 0X02, 0X00, 0X00, 0X02, 0X27, 0X7A,
-  0XD1, 0XFF, 0XFF, 0XBC, 0X61, 0X1E, 0X00, 0X23, 0XAF, 0XFF, 0XFF, 0XE5,
-  0XAB, 0X4D, 0X0F, 0X01, 0X00, 0X21, 0XB2, 0XB6, 0XB2, 0XB6, 0XA1, 0X54,
-  0X0D, 0X00, 0X00, 0X00, 0X17, 0XA7, 0XBA, 0XB4, 0XB4, 0X9F, 0X50, 0X0B,
-  0X00, 0X00, 0X00, 0X00, 0X15, 0X9D, 0XFF, 0XFF, 0XD8, 0X9B, 0X3F, 0X0A,
-  0X00, 0X00, 0X00, 0X00, 0X01, 0X21, 0X72, 0XC1, 0XE2, 0XCD, 0X83, 0X32,
-  0X0A, 0X00, 0X00, 0X00, 0X00, 0X00, 0X01, 0X04, 0X05, 0X04, 0X02, 0X00,
-  0X04, 0X7F, 0X00, 0X00, 0X00, 0X00, 0X00, 0X01, 0X06, 0X0A, 0X0A, 0X06,
-  0X02, 0X00, 0X00, 0X00, 0X08, 0X3D, 0X95, 0XE7, 0XFF, 0XFF, 0XBF, 0X61,
-  0X1E, 0X04, 0X03, 0X4C, 0XD1, 0XFF, 0XFF, 0XE0, 0XA5, 0X4A, 0X0E, 0X01,
-  0X00, 0X00, 0X45, 0XBC, 0XAD, 0XB2, 0XB6, 0X9F, 0X53, 0X0D, 0X00, 0X00,
-  0X00, 0X00, 0X11, 0XA1, 0XD1, 0XBF, 0XB8, 0XA1, 0X51, 0X0C, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X07, 0X6E, 0XF7, 0XFF, 0XF4, 0XB2, 0X50, 0X0F, 0X01,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X0B, 0X42, 0X8C, 0XB4, 0XA9, 0X6E, 0X2A,
-  0X08, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X01, 0X01, 0X00,
-  0X00, 0X00, 0X04, 0X7E, 0X00, 0X00, 0X00, 0X00, 0X00, 0X03, 0X08, 0X0D,
-  0X0C, 0X07, 0X02, 0X00, 0X00, 0X14, 0X54, 0XB2, 0XFC, 0XFF, 0XFF, 0XC1,
-  0X5F, 0X1E, 0X0E, 0X7A, 0XE7, 0XFF, 0XFA, 0XDD, 0X9F, 0X46, 0X0D, 0X01,
-  0X00, 0X6A, 0XC6, 0XAF, 0XB6, 0XB6, 0XA3, 0X53, 0X0E, 0X00, 0X00, 0X00,
-  0X08, 0X8A, 0XEF, 0XD8, 0XC1, 0XA7, 0X59, 0X0E, 0X00, 0X00, 0X00, 0X00,
-  0X01, 0X39, 0XCD, 0XFF, 0XFF, 0XDD, 0X6D, 0X1A, 0X02, 0X00, 0X00, 0X00,
-  0X00, 0X01, 0X1B, 0X4D, 0X75, 0X7C, 0X55, 0X21, 0X06, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X03, 0X6E, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X01, 0X06, 0X0D, 0X12, 0X11, 0X0A, 0X04, 0X00, 0X00,
-  0X02, 0X22, 0X6D, 0XD4, 0XFF, 0XFF, 0XFF, 0XC3, 0X61, 0X1F, 0X00, 0X26,
-  0XA1, 0XF2, 0XFF, 0XF4, 0XD8, 0X9B, 0X42, 0X0C, 0X01, 0X00, 0X01, 0X72,
-  0XD6, 0XB8, 0XBA, 0XBC, 0XA5, 0X57, 0X10, 0X00, 0X00, 0X00, 0X00, 0X02,
-  0X58, 0XFA, 0XFF, 0XD8, 0XB4, 0X65, 0X13, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X11, 0X81, 0XFF, 0XFF, 0XFF, 0X97, 0X2B, 0X05, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X05, 0X21, 0X3F, 0X4C, 0X3C, 0X18, 0X04, 0X03, 0X6F,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X02, 0X0B, 0X15, 0X1C, 0X19, 0X0F, 0X06,
-  0X01, 0X00, 0X00, 0X07, 0X37, 0X91, 0XF4, 0XFF, 0XFF, 0XFF, 0XC6, 0X5F,
-  0X20, 0X05, 0X00, 0X44, 0XC6, 0XF4, 0XF7, 0XED, 0XD4, 0X95, 0X3F, 0X0B,
-  0X00, 0X00, 0X00, 0X00, 0X53, 0XE5, 0XCD, 0XC1, 0XC3, 0XAB, 0X5B, 0X11,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X27, 0XD1, 0XFF, 0XFC, 0XC6, 0X72,
-  0X18, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X02, 0X3F, 0XCA, 0XFF,
-  0XFF, 0XB8, 0X3B, 0X07, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X0B, 0X20, 0X30, 0X2B, 0X13, 0X03, 0X00, 0X04, 0X6F, 0X00, 0X00, 0X00,
-  0X00, 0X05, 0X11, 0X1F, 0X27, 0X23, 0X15, 0X08, 0X01, 0X00, 0X0C, 0X46,
-  0XA9, 0XFF, 0XFF, 0XFF, 0XFF, 0XBC, 0X5B, 0X1E, 0X04, 0X4B, 0XDB, 0XF2,
-  0XEF, 0XE5, 0XCF, 0X95, 0X3D, 0X0A, 0X00, 0X00, 0X00, 0X27, 0XD8, 0XE5,
-  0XC8, 0XC3, 0XAF, 0X5F, 0X12, 0X00, 0X00, 0X00, 0X00, 0X00, 0X0C, 0XA1,
-  0XFF, 0XFF, 0XD6, 0X7C, 0X1B, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X20, 0XA1, 0XFF, 0XFF, 0XC3, 0X40, 0X08, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X05, 0X1A, 0X2E, 0X2D, 0X15, 0X03, 0X00, 0X04, 0X6F, 0X00,
-  0X00, 0X00, 0X00, 0X05, 0X12, 0X21, 0X28, 0X23, 0X15, 0X07, 0X01, 0X00,
-  0X0A, 0X44, 0XA9, 0XFF, 0XFF, 0XFF, 0XFF, 0XB6, 0X54, 0X19, 0X03, 0X34,
-  0XD6, 0XEF, 0XED, 0XE5, 0XCD, 0X93, 0X3B, 0X09, 0X00, 0X00, 0X00, 0X18,
-  0XCD, 0XE2, 0XC6, 0XC3, 0XAB, 0X5C, 0X11, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X0A, 0XA7, 0XFF, 0XFF, 0XC8, 0X73, 0X17, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X2B, 0XC6, 0XFF, 0XFF, 0XAD, 0X30, 0X05, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X0F, 0X34, 0X51, 0X47, 0X1E, 0X05, 0X00, 0X04,
-  0X7F, 0X00, 0X00, 0X00, 0X00, 0X00, 0X05, 0X0C, 0X10, 0X0E, 0X07, 0X02,
-  0X00, 0X00, 0X01, 0X1D, 0X65, 0XC6, 0XFF, 0XFF, 0XFF, 0XA9, 0X46, 0X10,
-  0X01, 0X15, 0X97, 0XEF, 0XFF, 0XF4, 0XD8, 0X9B, 0X3F, 0X09, 0X00, 0X00,
-  0X00, 0X37, 0XDD, 0XBC, 0XB6, 0XBC, 0XA5, 0X55, 0X0E, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X3D, 0XF7, 0XFA, 0XCD, 0XAD, 0X5C, 0X0F, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X10, 0XA3, 0XFF, 0XFF, 0XDD, 0X62, 0X12, 0X01, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X11, 0X54, 0X99, 0XAB, 0X78, 0X2F, 0X09,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X01, 0X01, 0X00,
-  0X00, 0X03, 0X7F, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X11, 0X3F, 0X7C, 0XA9,
-  0XA7, 0X70, 0X29, 0X07, 0X00, 0X00, 0X01, 0X2D, 0XA1, 0XFF, 0XFF, 0XFF,
-  0XCF, 0X61, 0X15, 0X01, 0X00, 0X00, 0X01, 0X62, 0XCD, 0XC3, 0XBF, 0XBC,
-  0XA5, 0X55, 0X0E, 0X00, 0X00, 0X00, 0X00, 0X00, 0X34, 0XC6, 0XC3, 0XB8,
-  0XB6, 0X9D, 0X4B, 0X0A, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X1D, 0XB4,
-  0XFF, 0XFF, 0XD6, 0X8D, 0X33, 0X06, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X01, 0X2A, 0X8F, 0XEA, 0XFF, 0XEA, 0X8C, 0X34, 0X0B, 0X01, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X02, 0X0A, 0X0F, 0X0C, 0X06, 0X01, 0X00, 0X13,
-  0X7E, 0X00, 0X00, 0X00, 0X00, 0X00, 0X03, 0X17, 0X33, 0X42, 0X35, 0X15,
-  0X03, 0X00, 0X00, 0X00, 0X19, 0X7A, 0XF2, 0XFF, 0XFF, 0XA1, 0X2E, 0X05,
-  0X00, 0X00, 0X11, 0X83, 0XF7, 0XFF, 0XDD, 0XB4, 0X61, 0X10, 0X00, 0X00,
-  0X00, 0X0A, 0XA7, 0XBF, 0XAF, 0XB6, 0XB6, 0X9B, 0X45, 0X08, 0X00, 0X00,
-  0X00, 0X00, 0X2F, 0XB4, 0XE7, 0XDD, 0XCF, 0XB6, 0X73, 0X21, 0X02, 0X00,
-  0X00, 0X00, 0X00, 0X06, 0X44, 0XB4, 0XFF, 0XFF, 0XFF, 0XE2, 0X7F, 0X31,
-  0X0B, 0X00, 0X00, 0X00, 0X00, 0X00, 0X0A, 0X1E, 0X30, 0X33, 0X24, 0X10,
-  0X03, 0X13, 0X7E, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X01, 0X0D, 0X1C,
-  0X1E, 0X0F, 0X02, 0X00, 0X00, 0X00, 0X00, 0X18, 0X7C, 0XEA, 0XFF, 0XC1,
-  0X41, 0X08, 0X00, 0X00, 0X00, 0X14, 0X9F, 0XFF, 0XFF, 0XDB, 0X75, 0X15,
-  0X00, 0X00, 0X00, 0X01, 0X47, 0XD4, 0XDB, 0XC3, 0XBC, 0X9F, 0X46, 0X08,
-  0X00, 0X00, 0X00, 0X08, 0X9B, 0XD1, 0XC8, 0XC6, 0XC3, 0XAF, 0X68, 0X1C,
-  0X01, 0X00, 0X00, 0X00, 0X04, 0X38, 0XA1, 0XFF, 0XFF, 0XFF, 0XFF, 0XC6,
-  0X6A, 0X2A, 0X0B, 0X00, 0X00, 0X00, 0X00, 0X0C, 0X29, 0X4B, 0X5F, 0X5C,
-  0X40, 0X1B, 0X06, 0X13, 0X7E, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X06, 0X15, 0X1C, 0X0F, 0X02, 0X00, 0X00, 0X00, 0X00, 0X05, 0X4D, 0XC3,
-  0XFF, 0XCA, 0X4B, 0X0A, 0X00, 0X00, 0X00, 0X01, 0X53, 0XFF, 0XFF, 0XF2,
-  0X81, 0X19, 0X00, 0X00, 0X00, 0X00, 0X0E, 0XA7, 0XFF, 0XD6, 0XC1, 0XA1,
-  0X4A, 0X08, 0X00, 0X00, 0X00, 0X04, 0XA1, 0XDB, 0XBC, 0XC3, 0XC3, 0XAB,
-  0X67, 0X1A, 0X01, 0X00, 0X00, 0X00, 0X11, 0X62, 0XCF, 0XFF, 0XFF, 0XFF,
-  0XFC, 0XAD, 0X59, 0X23, 0X0A, 0X00, 0X00, 0X00, 0X05, 0X1C, 0X45, 0X6E,
-  0X83, 0X7C, 0X54, 0X25, 0X08, 0X13, 0X7F, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X0B, 0X1E, 0X25, 0X13, 0X03, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X05, 0X53, 0XD6, 0XFF, 0XD1, 0X4B, 0X0A, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X47, 0XFF, 0XFF, 0XED, 0X7F, 0X18, 0X00, 0X00, 0X00, 0X00, 0X00, 0X05,
-  0X8D, 0XFF, 0XD6, 0XBF, 0XA3, 0X4A, 0X08, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X73, 0XE0, 0XBC, 0XBF, 0XC1, 0XAB, 0X67, 0X1A, 0X01, 0X00, 0X00, 0X00,
-  0X00, 0X10, 0X67, 0XD4, 0XFF, 0XFF, 0XFF, 0XF4, 0XA7, 0X54, 0X21, 0X0A,
-  0X01, 0X00, 0X00, 0X00, 0X06, 0X21, 0X4D, 0X78, 0X8D, 0X84, 0X5E, 0X29,
-  0X09, 0X01, 0X14, 0X7F, 0X00, 0X00, 0X00, 0X00, 0X00, 0X04, 0X1C, 0X38,
-  0X39, 0X1A, 0X04, 0X00, 0X00, 0X00, 0X00, 0X11, 0X88, 0XFF, 0XFF, 0XC6,
-  0X3F, 0X07, 0X00, 0X00, 0X00, 0X03, 0X73, 0XFF, 0XFF, 0XD4, 0X72, 0X15,
-  0X00, 0X00, 0X00, 0X00, 0X08, 0XA1, 0XED, 0XC6, 0XBA, 0XA1, 0X47, 0X08,
-  0X00, 0X00, 0X00, 0X00, 0X5B, 0XD8, 0XBC, 0XBF, 0XBF, 0XAD, 0X68, 0X1A,
-  0X01, 0X00, 0X00, 0X00, 0X06, 0X4A, 0XBA, 0XFF, 0XFF, 0XFF, 0XFA, 0XAD,
-  0X59, 0X23, 0X09, 0X01, 0X00, 0X00, 0X03, 0X17, 0X3D, 0X65, 0X7C, 0X77,
-  0X54, 0X25, 0X08, 0X00, 0X14, 0X7E, 0X00, 0X00, 0X00, 0X00, 0X01, 0X17,
-  0X44, 0X61, 0X53, 0X24, 0X06, 0X00, 0X00, 0X02, 0X46, 0XE2, 0XFF, 0XFF,
-  0XA7, 0X2E, 0X05, 0X00, 0X00, 0X17, 0XC8, 0XFF, 0XED, 0XBA, 0X64, 0X11,
-  0X00, 0X00, 0X00, 0X1F, 0XC3, 0XC8, 0XB6, 0XB6, 0X9D, 0X45, 0X07, 0X00,
-  0X00, 0X00, 0X42, 0XC8, 0XCA, 0XC6, 0XC1, 0XAF, 0X6D, 0X1D, 0X01, 0X00,
-  0X00, 0X00, 0X1F, 0X81, 0XED, 0XFF, 0XFF, 0XFF, 0XC6, 0X6A, 0X28, 0X0A,
-  0X00, 0X00, 0X00, 0X07, 0X1E, 0X3D, 0X51, 0X51, 0X3A, 0X18, 0X05, 0X14,
-  0X7F, 0X00, 0X00, 0X00, 0X00, 0X11, 0X48, 0X81, 0X95, 0X6E, 0X2C, 0X07,
-  0X00, 0X00, 0X00, 0X24, 0XB6, 0XFF, 0XFF, 0XF2, 0X78, 0X1C, 0X02, 0X00,
-  0X00, 0X03, 0X70, 0XFA, 0XEA, 0XCA, 0XA9, 0X57, 0X0D, 0X00, 0X00, 0X00,
-  0X00, 0X57, 0XC3, 0XAD, 0XB4, 0XB6, 0X9B, 0X44, 0X07, 0X00, 0X00, 0X00,
-  0X00, 0X1A, 0X9F, 0XE5, 0XE2, 0XD4, 0XBA, 0X78, 0X23, 0X02, 0X00, 0X00,
-  0X00, 0X00, 0X04, 0X37, 0X99, 0XF7, 0XFF, 0XFF, 0XDD, 0X78, 0X2A, 0X08,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X06, 0X14, 0X22, 0X24, 0X1A, 0X0A, 0X02,
-  0X00, 0X03, 0X7E, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X01,
-  0X01, 0X01, 0X00, 0X00, 0X00, 0X00, 0X00, 0X0C, 0X42, 0X8D, 0XC8, 0XC6,
-  0X84, 0X32, 0X09, 0X00, 0X00, 0X12, 0X88, 0XFF, 0XFF, 0XFF, 0XC3, 0X54,
-  0X0F, 0X01, 0X00, 0X00, 0X33, 0XC8, 0XD8, 0XC6, 0XBC, 0XA1, 0X4C, 0X0A,
-  0X00, 0X00, 0X00, 0X01, 0X68, 0XC8, 0XB8, 0XB8, 0XB6, 0X9B, 0X44, 0X07,
-  0X00, 0X00, 0X00, 0X00, 0X02, 0X47, 0XD1, 0XFF, 0XFF, 0XD6, 0X8F, 0X31,
-  0X05, 0X00, 0X00, 0X00, 0X00, 0X00, 0X06, 0X35, 0X8C, 0XD6, 0XF2, 0XCA,
-  0X73, 0X25, 0X06, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X01, 0X06, 0X08,
-  0X06, 0X02, 0X00, 0X03, 0X7F, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X01,
-  0X03, 0X06, 0X06, 0X03, 0X01, 0X00, 0X00, 0X00, 0X00, 0X06, 0X33, 0X86,
-  0XD8, 0XFF, 0XE7, 0X8F, 0X34, 0X09, 0X01, 0X00, 0X06, 0X57, 0XE2, 0XFF,
-  0XFF, 0XEF, 0X9F, 0X3C, 0X08, 0X00, 0X00, 0X00, 0X03, 0X93, 0XD4, 0XBC,
-  0XBC, 0XBA, 0X9D, 0X46, 0X09, 0X00, 0X00, 0X00, 0X00, 0X00, 0X33, 0XC8,
-  0XE5, 0XCA, 0XBF, 0X9F, 0X47, 0X08, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X0C, 0X73, 0XFC, 0XFF, 0XFF, 0XBA, 0X4A, 0X0C, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X07, 0X33, 0X77, 0XA1, 0X97, 0X5B, 0X1C, 0X04, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X03, 0X6E, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X03, 0X09, 0X0D,
-  0X0A, 0X05, 0X01, 0X00, 0X00, 0X01, 0X18, 0X5C, 0XBC, 0XFF, 0XFF, 0XEF,
-  0X8D, 0X33, 0X09, 0X00, 0X1D, 0X95, 0XFC, 0XFF, 0XFF, 0XD6, 0X8D, 0X31,
-  0X05, 0X00, 0X00, 0X05, 0XAB, 0XD8, 0XB6, 0XBA, 0XBA, 0X9B, 0X44, 0X08,
-  0X00, 0X00, 0X00, 0X00, 0X0E, 0X97, 0XFF, 0XED, 0XCA, 0XA3, 0X4C, 0X09,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X01, 0X30, 0XC1, 0XFF, 0XFF, 0XDD, 0X62,
-  0X13, 0X01, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X12, 0X41, 0X6D, 0X73,
-  0X4A, 0X17, 0X03, 0X03, 0X6F, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X05,
-  0X0C, 0X0E, 0X0C, 0X05, 0X01, 0X00, 0X00, 0X00, 0X02, 0X21, 0X6E, 0XCF,
-  0XFF, 0XFF, 0XED, 0X88, 0X2E, 0X08, 0X00, 0X00, 0X2B, 0XA9, 0XFF, 0XFF,
-  0XF4, 0XCF, 0X86, 0X2D, 0X04, 0X00, 0X00, 0X00, 0X04, 0XA1, 0XD8, 0XB8,
-  0XB8, 0XB8, 0X99, 0X41, 0X07, 0X00, 0X00, 0X00, 0X00, 0X00, 0X08, 0X88,
-  0XFF, 0XF2, 0XCA, 0XA3, 0X4C, 0X09, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X28, 0XB8, 0XFF, 0XFF, 0XE5, 0X68, 0X15, 0X01, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X10, 0X3D, 0X67, 0X6D, 0X45, 0X15, 0X03, 0X00,
-  0X03, 0X6D, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X04, 0X09, 0X0B, 0X09,
-  0X03, 0X00, 0X00, 0X02, 0X1E, 0X65, 0XBF, 0XFF, 0XFF, 0XE0, 0X81, 0X2C,
-  0X00, 0X29, 0XA1, 0XFC, 0XFF, 0XF4, 0XCF, 0X86, 0X2E, 0X05, 0X00, 0X08,
-  0XB2, 0XCA, 0XB4, 0XB8, 0XB6, 0X95, 0X40, 0X08, 0X00, 0X00, 0X00, 0X13,
-  0XA9, 0XFF, 0XE0, 0XC3, 0X9F, 0X4A, 0X09, 0X00, 0X00, 0X00, 0X00, 0X02,
-  0X40, 0XD8, 0XFF, 0XFF, 0XDD, 0X62, 0X15, 0X01, 0X00, 0X00, 0X00, 0X00,
-  0X01, 0X1A, 0X4C, 0X73, 0X75, 0X47, 0X16, 0X03, 0X6E, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X01, 0X05, 0X06, 0X05, 0X02, 0X00, 0X00, 0X00, 0X00,
-  0X11, 0X4B, 0X9D, 0XE0, 0XFA, 0XD4, 0X7A, 0X29, 0X07, 0X00, 0X18, 0X84,
-  0XF2, 0XFF, 0XFF, 0XD8, 0X8D, 0X33, 0X07, 0X00, 0X00, 0X0D, 0XB4, 0XC1,
-  0XB2, 0XB6, 0XB4, 0X93, 0X3F, 0X08, 0X00, 0X00, 0X00, 0X00, 0X30, 0XC8,
-  0XE7, 0XCD, 0XBA, 0X99, 0X46, 0X08, 0X00, 0X00, 0X00, 0X00, 0X00, 0X0A,
-  0X6E, 0XFA, 0XFF, 0XFF, 0XC8, 0X57, 0X11, 0X01, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X06, 0X2F, 0X6B, 0X8F, 0X88, 0X4F, 0X19, 0X03, 0X03, 0X7E, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X01, 0X01, 0X01, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X05, 0X29, 0X68, 0XA7, 0XC8, 0XAF, 0X65, 0X22, 0X05, 0X00,
-  0X09, 0X57, 0XD4, 0XFF, 0XFF, 0XEF, 0XA3, 0X40, 0X0B, 0X01, 0X00, 0X0F,
-  0XA1, 0XC3, 0XB8, 0XB8, 0XB4, 0X93, 0X40, 0X08, 0X00, 0X00, 0X00, 0X05,
-  0X72, 0XD1, 0XC6, 0XBC, 0XB4, 0X93, 0X3F, 0X07, 0X00, 0X00, 0X00, 0X00,
-  0X01, 0X30, 0XB8, 0XFF, 0XFF, 0XF4, 0XA5, 0X42, 0X0C, 0X01, 0X00, 0X00,
-  0X00, 0X00, 0X01, 0X1B, 0X5E, 0XA1, 0XBC, 0XA1, 0X5C, 0X1D, 0X04, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X01, 0X01, 0X00, 0X00, 0X03,
-  0X7E, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X07, 0X29, 0X55, 0X75, 0X72, 0X47, 0X18,
-  0X03, 0X00, 0X00, 0X1D, 0X84, 0XF7, 0XFF, 0XFF, 0XD1, 0X5F, 0X15, 0X02,
-  0X00, 0X07, 0X6B, 0XD1, 0XD6, 0XC8, 0XB8, 0X95, 0X42, 0X08, 0X00, 0X00,
-  0X00, 0X26, 0XB8, 0XB6, 0XAD, 0XB4, 0XB2, 0X8C, 0X38, 0X06, 0X00, 0X00,
-  0X00, 0X00, 0X1A, 0X8C, 0XFA, 0XFF, 0XF2, 0XCA, 0X81, 0X2B, 0X05, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X15, 0X59, 0XB4, 0XEF, 0XF7, 0XC6, 0X6B, 0X22,
-  0X05, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X03, 0X06, 0X06, 0X04, 0X01,
-  0X00, 0X13, 0X7E, 0X00, 0X00, 0X00, 0X00, 0X00, 0X03, 0X13, 0X29, 0X33,
-  0X28, 0X0F, 0X02, 0X00, 0X00, 0X01, 0X21, 0X83, 0XF2, 0XFF, 0XFF, 0X91,
-  0X29, 0X04, 0X00, 0X00, 0X1F, 0X9D, 0XFF, 0XFC, 0XD6, 0XA7, 0X4F, 0X0B,
-  0X00, 0X00, 0X00, 0X3F, 0XC3, 0XB6, 0XAF, 0XB4, 0XAF, 0X8A, 0X35, 0X05,
-  0X00, 0X00, 0X00, 0X12, 0X7A, 0XD6, 0XEA, 0XE0, 0XD1, 0XAF, 0X67, 0X1C,
-  0X02, 0X00, 0X00, 0X00, 0X01, 0X16, 0X5C, 0XC3, 0XFF, 0XFF, 0XFF, 0XD8,
-  0X6E, 0X24, 0X06, 0X00, 0X00, 0X00, 0X00, 0X01, 0X08, 0X13, 0X1A, 0X17,
-  0X0E, 0X05, 0X01, 0X13, 0X7E, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X01,
-  0X08, 0X13, 0X16, 0X0B, 0X01, 0X00, 0X00, 0X00, 0X01, 0X21, 0X7D, 0XDB,
-  0XFA, 0XAD, 0X3B, 0X08, 0X00, 0X00, 0X01, 0X2E, 0XC1, 0XFF, 0XFF, 0XD1,
-  0X67, 0X10, 0X00, 0X00, 0X00, 0X0E, 0X88, 0XE2, 0XCF, 0XBC, 0XB4, 0X8D,
-  0X37, 0X05, 0X00, 0X00, 0X00, 0X4A, 0XCF, 0XD1, 0XCA, 0XC6, 0XC1, 0XA3,
-  0X59, 0X15, 0X01, 0X00, 0X00, 0X00, 0X11, 0X51, 0XB6, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XC3, 0X61, 0X20, 0X06, 0X00, 0X00, 0X00, 0X01, 0X0C, 0X23, 0X3B,
-  0X44, 0X39, 0X20, 0X0B, 0X02, 0X13, 0X7E, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X03, 0X0C, 0X12, 0X0A, 0X02, 0X00, 0X00, 0X00, 0X00, 0X06,
-  0X45, 0XA9, 0XE5, 0XB6, 0X47, 0X0B, 0X00, 0X00, 0X00, 0X07, 0X6B, 0XFF,
-  0XFF, 0XF2, 0X7C, 0X16, 0X00, 0X00, 0X00, 0X00, 0X34, 0XD4, 0XF7, 0XCD,
-  0XB8, 0X91, 0X39, 0X05, 0X00, 0X00, 0X00, 0X40, 0XE7, 0XC8, 0XBA, 0XBC,
-  0XBA, 0X9D, 0X51, 0X11, 0X00, 0X00, 0X00, 0X05, 0X32, 0X8A, 0XE7, 0XFF,
-  0XFF, 0XFF, 0XEF, 0X9D, 0X4C, 0X19, 0X05, 0X00, 0X00, 0X00, 0X09, 0X23,
-  0X47, 0X65, 0X6D, 0X58, 0X32, 0X10, 0X03, 0X13, 0X7E, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X03, 0X0E, 0X14, 0X0D, 0X02, 0X00, 0X00, 0X00,
-  0X00, 0X05, 0X45, 0XAD, 0XF2, 0XC6, 0X53, 0X0E, 0X01, 0X00, 0X00, 0X04,
-  0X61, 0XFF, 0XFF, 0XF4, 0X7D, 0X18, 0X00, 0X00, 0X00, 0X00, 0X23, 0XC6,
-  0XFC, 0XCF, 0XB8, 0X8F, 0X38, 0X05, 0X00, 0X00, 0X00, 0X2B, 0XDB, 0XC6,
-  0XB4, 0XBA, 0XB6, 0X99, 0X4D, 0X0E, 0X00, 0X00, 0X00, 0X06, 0X3F, 0X99,
-  0XED, 0XFF, 0XFF, 0XFF, 0XDD, 0X8C, 0X40, 0X14, 0X04, 0X00, 0X00, 0X01,
-  0X0E, 0X2E, 0X55, 0X73, 0X75, 0X5C, 0X32, 0X0F, 0X02, 0X13, 0X7E, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X08, 0X16, 0X1C, 0X10, 0X03, 0X00,
-  0X00, 0X00, 0X00, 0X13, 0X6A, 0XDB, 0XFF, 0XD4, 0X58, 0X11, 0X01, 0X00,
-  0X00, 0X10, 0X97, 0XFF, 0XFF, 0XE0, 0X72, 0X17, 0X00, 0X00, 0X00, 0X01,
-  0X42, 0XDB, 0XE0, 0XC1, 0XB6, 0X8D, 0X35, 0X05, 0X00, 0X00, 0X00, 0X30,
-  0XD1, 0XBF, 0XB6, 0XBA, 0XB8, 0X99, 0X4D, 0X0E, 0X00, 0X00, 0X00, 0X03,
-  0X29, 0X7F, 0XDB, 0XFF, 0XFF, 0XFF, 0XE5, 0X91, 0X41, 0X13, 0X03, 0X00,
-  0X00, 0X00, 0X07, 0X1E, 0X3E, 0X55, 0X57, 0X42, 0X21, 0X09, 0X01, 0X13,
-  0X7E, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X03, 0X10, 0X20, 0X24, 0X14,
-  0X04, 0X00, 0X00, 0X00, 0X03, 0X37, 0XA5, 0XFF, 0XFF, 0XDB, 0X5E, 0X14,
-  0X02, 0X00, 0X02, 0X46, 0XE2, 0XFF, 0XFF, 0XD1, 0X6A, 0X16, 0X00, 0X00,
-  0X00, 0X0E, 0X95, 0XDB, 0XC3, 0XBA, 0XB4, 0X8C, 0X35, 0X05, 0X00, 0X00,
-  0X00, 0X2B, 0XB2, 0XCF, 0XCF, 0XCA, 0XC1, 0XA1, 0X55, 0X11, 0X00, 0X00,
-  0X00, 0X00, 0X09, 0X3C, 0X95, 0XEF, 0XFF, 0XFF, 0XF7, 0XA3, 0X46, 0X11,
-  0X02, 0X00, 0X00, 0X00, 0X00, 0X06, 0X15, 0X23, 0X25, 0X1B, 0X0D, 0X03,
-  0X00, 0X13, 0X7E, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X06, 0X15, 0X26,
-  0X28, 0X17, 0X05, 0X00, 0X00, 0X00, 0X10, 0X5B, 0XD1, 0XFF, 0XFF, 0XE2,
-  0X64, 0X17, 0X02, 0X00, 0X17, 0X8D, 0XFF, 0XFF, 0XFF, 0XCD, 0X6A, 0X18,
-  0X01, 0X00, 0X00, 0X3C, 0XE5, 0XD8, 0XBF, 0XC1, 0XBA, 0X91, 0X3A, 0X06,
-  0X00, 0X00, 0X00, 0X0C, 0X61, 0XCF, 0XFF, 0XFA, 0XE2, 0XBA, 0X6A, 0X1B,
-  0X02, 0X00, 0X00, 0X00, 0X00, 0X09, 0X38, 0X88, 0XD4, 0XF2, 0XDD, 0X95,
-  0X3E, 0X0E, 0X01, 0X00, 0X00, 0X00, 0X00, 0X00, 0X01, 0X05, 0X07, 0X05,
-  0X02, 0X01, 0X00, 0X13, 0X7E, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X09,
-  0X1A, 0X2B, 0X2B, 0X1A, 0X07, 0X00, 0X00, 0X01, 0X20, 0X7A, 0XED, 0XFF,
-  0XFF, 0XE5, 0X68, 0X1A, 0X03, 0X03, 0X3B, 0XC1, 0XFF, 0XFF, 0XFF, 0XCD,
-  0X6A, 0X1A, 0X01, 0X00, 0X00, 0X4C, 0XFF, 0XF2, 0XD1, 0XCD, 0XC3, 0X9B,
-  0X41, 0X08, 0X00, 0X00, 0X00, 0X01, 0X1D, 0X81, 0XFA, 0XFF, 0XFF, 0XEF,
-  0X97, 0X33, 0X07, 0X00, 0X00, 0X00, 0X00, 0X00, 0X09, 0X31, 0X6B, 0X93,
-  0X93, 0X68, 0X2C, 0X09, 0X01, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X13, 0X6F, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X02, 0X0E, 0X24, 0X35, 0X33, 0X1E, 0X09, 0X01, 0X00, 0X00, 0X05, 0X35,
-  0XA1, 0XFF, 0XFF, 0XFF, 0XE5, 0X6A, 0X1C, 0X03, 0X00, 0X0B, 0X6D, 0XED,
-  0XFF, 0XFF, 0XFF, 0XC8, 0X6B, 0X1E, 0X02, 0X00, 0X00, 0X00, 0X2A, 0XE7,
-  0XFF, 0XFC, 0XE5, 0XCF, 0XA5, 0X4D, 0X0B, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X03, 0X31, 0XA7, 0XFF, 0XFF, 0XFF, 0XD6, 0X59, 0X11, 0X01, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X09, 0X26, 0X41, 0X4A, 0X3B, 0X1B, 0X06, 0X00,
-  0X00, 0X13, 0X6E, 0X00, 0X00, 0X00, 0X00, 0X00, 0X08, 0X1D, 0X3A, 0X4B,
-  0X42, 0X28, 0X0C, 0X00, 0X00, 0X13, 0X5E, 0XDB, 0XFF, 0XFF, 0XFF, 0XDB,
-  0X64, 0X1C, 0X03, 0X15, 0XBC, 0XFF, 0XFF, 0XFF, 0XF4, 0XBF, 0X6A, 0X1F,
-  0X03, 0X00, 0X00, 0X0B, 0X7D, 0XFA, 0XFF, 0XFF, 0XE5, 0XB4, 0X5B, 0X10,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X09, 0X4D, 0XCA, 0XFF, 0XFF, 0XF4, 0X7C,
-  0X1C, 0X02, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X08, 0X17, 0X1F, 0X1C,
-  0X10, 0X04, 0X00, 0X13, 0X6E, 0X00, 0X00, 0X00, 0X00, 0X05, 0X1C, 0X41,
-  0X67, 0X70, 0X5B, 0X32, 0X0F, 0X00, 0X06, 0X39, 0XA9, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XB6, 0X4C, 0X14, 0X02, 0X1C, 0XFF, 0XFF, 0XFF, 0XF4, 0XDD, 0XB6,
-  0X64, 0X1E, 0X03, 0X00, 0X00, 0X01, 0X2A, 0XB4, 0XFF, 0XFF, 0XFF, 0XC8,
-  0X6A, 0X16, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X1B, 0X77, 0XDD, 0XFF,
-  0XEF, 0X86, 0X24, 0X03, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X01, 0X06,
-  0X0B, 0X0C, 0X09, 0X02, 0X00, 0X13, 0X6E, 0X00, 0X00, 0X00, 0X05, 0X21,
-  0X51, 0X86, 0XA9, 0XA1, 0X72, 0X38, 0X0F, 0X02, 0X28, 0X86, 0XFA, 0XFF,
-  0XFF, 0XFF, 0XE7, 0X7C, 0X2F, 0X0A, 0X01, 0X22, 0XFF, 0XFF, 0XEF, 0XDB,
-  0XCF, 0XAB, 0X5C, 0X19, 0X02, 0X00, 0X00, 0X00, 0X0B, 0X6D, 0XFF, 0XFF,
-  0XFF, 0XE2, 0X7A, 0X1C, 0X01, 0X00, 0X00, 0X00, 0X00, 0X00, 0X07, 0X42,
-  0X9B, 0XD4, 0XD1, 0X84, 0X29, 0X04, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X01, 0X03, 0X05, 0X04, 0X02, 0X00, 0X03, 0X6E, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X01, 0X02, 0X01, 0X01, 0X00, 0X00, 0X00, 0X04,
-  0X20, 0X58, 0X9D, 0XD4, 0XE5, 0XBF, 0X78, 0X33, 0X0C, 0X11, 0X6D, 0XD4,
-  0XFF, 0XFF, 0XFF, 0XF7, 0XAB, 0X53, 0X1A, 0X04, 0X00, 0X26, 0XDD, 0XFF,
-  0XDB, 0XCD, 0XC6, 0XA1, 0X54, 0X15, 0X01, 0X00, 0X00, 0X00, 0X04, 0X4C,
-  0XE5, 0XFF, 0XFF, 0XEF, 0X86, 0X22, 0X01, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X03, 0X2D, 0X7C, 0XB6, 0XBF, 0X83, 0X2D, 0X05, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X01, 0X03, 0X03, 0X01, 0X00, 0X03, 0X6F, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X02, 0X03, 0X03, 0X02, 0X01, 0X00, 0X00,
-  0X00, 0X01, 0X10, 0X3C, 0X81, 0XC8, 0XF2, 0XEF, 0XB6, 0X64, 0X23, 0X06,
-  0X00, 0X2E, 0X95, 0XE2, 0XFF, 0XFF, 0XFC, 0XD6, 0X8F, 0X3F, 0X0F, 0X02,
-  0X00, 0X00, 0X3B, 0XD1, 0XE7, 0XCD, 0XC6, 0XBF, 0X99, 0X4D, 0X12, 0X01,
-  0X00, 0X00, 0X00, 0X00, 0X07, 0X59, 0XEF, 0XFF, 0XFF, 0XED, 0X83, 0X21,
-  0X01, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X05, 0X35, 0X83, 0XBF, 0XCA,
-  0X8A, 0X33, 0X07, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X01, 0X03, 0X04, 0X02, 0X00, 0X00, 0X02, 0X6E, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X01, 0X01, 0X01, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X0C, 0X33, 0X73, 0XAF, 0XCF, 0XC6, 0X8D, 0X44, 0X13, 0X02, 0X01, 0X28,
-  0X7F, 0XD8, 0XFF, 0XFF, 0XFC, 0XD8, 0X8F, 0X3B, 0X0C, 0X01, 0X00, 0X03,
-  0X75, 0XE2, 0XCF, 0XBC, 0XC1, 0XBC, 0X95, 0X48, 0X10, 0X01, 0X00, 0X00,
-  0X00, 0X00, 0X1C, 0X91, 0XFF, 0XFF, 0XFF, 0XD1, 0X73, 0X1D, 0X01, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X13, 0X5C, 0XB6, 0XF4, 0XF4, 0XA1, 0X3C,
-  0X0A, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X02, 0X06, 0X09,
-  0X08, 0X04, 0X00, 0X02, 0X6E, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X01, 0X12, 0X3B,
-  0X68, 0X84, 0X83, 0X5E, 0X29, 0X09, 0X01, 0X00, 0X0A, 0X40, 0XA5, 0XFC,
-  0XFF, 0XFF, 0XFA, 0XA9, 0X45, 0X0D, 0X01, 0X00, 0X08, 0XA1, 0XEF, 0XCA,
-  0XBF, 0XC3, 0XBC, 0X97, 0X48, 0X0E, 0X00, 0X00, 0X00, 0X00, 0X09, 0X51,
-  0XD1, 0XFF, 0XFF, 0XE5, 0XB6, 0X64, 0X18, 0X01, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X05, 0X39, 0XA9, 0XFF, 0XFF, 0XFF, 0XBC, 0X45, 0X0D, 0X01, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X03, 0X0F, 0X1B, 0X21, 0X19, 0X0B, 0X02,
-  0X12, 0X6E, 0X00, 0X00, 0X00, 0X00, 0X00, 0X09, 0X23, 0X3C, 0X47, 0X3C,
-  0X1E, 0X07, 0X00, 0X00, 0X00, 0X05, 0X33, 0X9D, 0XFF, 0XFF, 0XFF, 0XDB,
-  0X5F, 0X12, 0X01, 0X00, 0X00, 0X37, 0XBA, 0XE5, 0XDD, 0XD1, 0XC6, 0XA3,
-  0X4F, 0X0D, 0X00, 0X00, 0X00, 0X00, 0X1E, 0X99, 0XF2, 0XF4, 0XE0, 0XD1,
-  0XAB, 0X5C, 0X15, 0X01, 0X00, 0X00, 0X00, 0X00, 0X01, 0X1E, 0X81, 0XFF,
-  0XFF, 0XFF, 0XFF, 0X9D, 0X33, 0X09, 0X01, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X04, 0X20, 0X4A, 0X70, 0X75, 0X54, 0X25, 0X08, 0X13, 0X7F, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X02, 0X12, 0X23, 0X29, 0X1C, 0X07, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X19, 0X7C, 0XEF, 0XFF, 0XFF, 0X8C, 0X22, 0X02, 0X00, 0X00,
-  0X00, 0X11, 0X88, 0XFF, 0XFF, 0XE5, 0XBC, 0X65, 0X11, 0X00, 0X00, 0X00,
-  0X00, 0X03, 0XA3, 0XFF, 0XD4, 0XCA, 0XC8, 0XAF, 0X5F, 0X13, 0X01, 0X00,
-  0X00, 0X00, 0X00, 0X06, 0X4D, 0XD8, 0XFF, 0XFF, 0XFF, 0XCA, 0X5F, 0X18,
-  0X02, 0X00, 0X00, 0X00, 0X00, 0X00, 0X02, 0X23, 0X6D, 0XC6, 0XFF, 0XFC,
-  0XB4, 0X54, 0X15, 0X02, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X02,
-  0X05, 0X05, 0X03, 0X01, 0X00, 0X13, 0X7F, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X08, 0X1E, 0X2E, 0X24, 0X0C, 0X01, 0X00, 0X00, 0X00, 0X00, 0X01,
-  0X2C, 0XAF, 0XFF, 0XFF, 0XAB, 0X2F, 0X04, 0X00, 0X00, 0X00, 0X00, 0X0F,
-  0XAD, 0XFF, 0XFF, 0XCF, 0X77, 0X17, 0X00, 0X00, 0X00, 0X00, 0X00, 0X0E,
-  0XD4, 0XE2, 0XC6, 0XC6, 0XB4, 0X64, 0X13, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X03, 0X64, 0XEF, 0XFF, 0XFF, 0XE7, 0XA7, 0X4B, 0X0F, 0X01, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X0E, 0X53, 0XC3, 0XFF, 0XFF, 0XFF, 0XCF, 0X62, 0X1C,
-  0X03, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X05, 0X11, 0X1A, 0X1A, 0X10,
-  0X05, 0X00, 0X14, 0X7F, 0X00, 0X00, 0X00, 0X00, 0X03, 0X24, 0X4D, 0X5E,
-  0X40, 0X14, 0X02, 0X00, 0X00, 0X00, 0X05, 0X64, 0XFA, 0XFF, 0XFF, 0X8D,
-  0X21, 0X02, 0X00, 0X00, 0X00, 0X1A, 0XD4, 0XFF, 0XE0, 0XB8, 0X6B, 0X13,
-  0X00, 0X00, 0X00, 0X00, 0X05, 0XB2, 0XCF, 0XBA, 0XBC, 0XAB, 0X5F, 0X12,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X39, 0XD4, 0XFF, 0XFF, 0XE2, 0XA7, 0X4B,
-  0X0E, 0X00, 0X00, 0X00, 0X00, 0X00, 0X08, 0X44, 0XA9, 0XFF, 0XFF, 0XFF,
-  0XBF, 0X57, 0X16, 0X02, 0X00, 0X00, 0X00, 0X00, 0X00, 0X03, 0X0C, 0X14,
-  0X13, 0X0B, 0X03, 0X00, 0X04, 0X7F, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X01, 0X01, 0X01, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X13, 0X54, 0XA1,
-  0XCA, 0XB4, 0X65, 0X1C, 0X03, 0X00, 0X00, 0X12, 0X93, 0XFF, 0XFF, 0XFA,
-  0XB2, 0X48, 0X0B, 0X00, 0X00, 0X00, 0X17, 0XBC, 0XCD, 0XBF, 0XBA, 0XA5,
-  0X55, 0X0D, 0X00, 0X00, 0X00, 0X00, 0X0F, 0XA7, 0XD8, 0XC8, 0XC1, 0XAB,
-  0X5E, 0X12, 0X00, 0X00, 0X00, 0X00, 0X00, 0X07, 0X61, 0XEA, 0XFF, 0XFF,
-  0XDD, 0X6E, 0X1B, 0X02, 0X00, 0X00, 0X00, 0X00, 0X00, 0X06, 0X2C, 0X6D,
-  0XA5, 0XB2, 0X7F, 0X34, 0X09, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X01, 0X00, 0X00, 0X00, 0X03, 0X7E, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X04, 0X0D, 0X14, 0X14, 0X0C, 0X04, 0X01, 0X00, 0X00, 0X0A, 0X40,
-  0X9F, 0XF7, 0XFF, 0XFF, 0XDB, 0X6D, 0X1E, 0X04, 0X01, 0X4C, 0XC8, 0XEF,
-  0XED, 0XDB, 0XBF, 0X7A, 0X25, 0X03, 0X00, 0X00, 0X01, 0X61, 0XD8, 0XC6,
-  0XBA, 0XB8, 0X9F, 0X4C, 0X0A, 0X00, 0X00, 0X00, 0X00, 0X00, 0X2B, 0XC6,
-  0XFF, 0XFF, 0XCA, 0X72, 0X18, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X02,
-  0X31, 0XA5, 0XFF, 0XFF, 0XBC, 0X40, 0X09, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X06, 0X19, 0X2B, 0X28, 0X11, 0X02, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X03, 0X6E, 0X00, 0X00,
-  0X00, 0X01, 0X0D, 0X23, 0X3D, 0X47, 0X3E, 0X24, 0X0C, 0X02, 0X00, 0X17,
-  0X5B, 0XBF, 0XFF, 0XFF, 0XFF, 0XFF, 0XB4, 0X55, 0X19, 0X04, 0X08, 0XC3,
-  0XF7, 0XCA, 0XC8, 0XC6, 0XAB, 0X65, 0X1A, 0X01, 0X00, 0X00, 0X00, 0X0A,
-  0X8A, 0XFF, 0XF2, 0XC8, 0XA5, 0X4C, 0X0A, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X26, 0XC8, 0XFF, 0XFF, 0XA9, 0X29, 0X01, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X1C, 0X73, 0XC1, 0XB4, 0X4D, 0X0C, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X04, 0X09, 0X06, 0X01, 0X03, 0X6E,
-  0X00, 0X00, 0X02, 0X10, 0X2F, 0X58, 0X78, 0X81, 0X6A, 0X3C, 0X14, 0X04,
-  0X03, 0X54, 0XAD, 0XF2, 0XFF, 0XFF, 0XF2, 0XC3, 0X7A, 0X3A, 0X13, 0X04,
-  0X01, 0X70, 0XF7, 0XCA, 0XBF, 0XBC, 0XA3, 0X5C, 0X15, 0X01, 0X00, 0X00,
-  0X00, 0X00, 0X31, 0XEF, 0XFF, 0XDB, 0XA9, 0X4F, 0X0A, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X05, 0X70, 0XFF, 0XFF, 0XD1, 0X39, 0X02, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X05, 0X3E, 0X8C, 0X9D, 0X50, 0X0E, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X01, 0X04, 0X04, 0X01,
-  0X03, 0X5E, 0X00, 0X00, 0X04, 0X17, 0X3A, 0X62, 0X7C, 0X7F, 0X67, 0X38,
-  0X12, 0X03, 0X05, 0X65, 0XB8, 0XED, 0XFF, 0XFA, 0XE2, 0XB8, 0X73, 0X38,
-  0X13, 0X04, 0X01, 0X6A, 0XED, 0XC3, 0XB8, 0XB8, 0XA1, 0X58, 0X14, 0X01,
-  0X00, 0X00, 0X00, 0X00, 0X39, 0XFC, 0XFF, 0XD4, 0XA3, 0X4C, 0X0A, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X08, 0X8A, 0XFF, 0XFF, 0XCD, 0X39, 0X03,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X0A, 0X4C, 0X9B, 0XA5, 0X54,
-  0X0F, 0X01, 0X03, 0X6E, 0X00, 0X00, 0X01, 0X09, 0X1C, 0X35, 0X48, 0X48,
-  0X34, 0X1A, 0X08, 0X01, 0X04, 0X3E, 0X8D, 0XDD, 0XFF, 0XFF, 0XFF, 0XE2,
-  0X99, 0X46, 0X14, 0X03, 0X0C, 0XB6, 0XD6, 0XB4, 0XBA, 0XBA, 0XA1, 0X59,
-  0X15, 0X01, 0X00, 0X00, 0X00, 0X08, 0X93, 0XFF, 0XE5, 0XBF, 0X9D, 0X47,
-  0X0A, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X35, 0XE7, 0XFF, 0XFF, 0XAB,
-  0X2D, 0X02, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X01, 0X2C, 0X86, 0XCF,
-  0XBA, 0X58, 0X11, 0X01, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X04, 0X07, 0X05, 0X01, 0X03, 0X6E, 0X00, 0X00, 0X00, 0X00, 0X03, 0X0A,
-  0X11, 0X11, 0X0C, 0X05, 0X01, 0X00, 0X00, 0X0C, 0X3B, 0X86, 0XD8, 0XFF,
-  0XFF, 0XF7, 0XA3, 0X42, 0X0E, 0X01, 0X2A, 0XC6, 0XD4, 0XD1, 0XD1, 0XC8,
-  0XAD, 0X65, 0X1C, 0X02, 0X00, 0X00, 0X03, 0X62, 0XE7, 0XDB, 0XC1, 0XB8,
-  0X97, 0X44, 0X0A, 0X00, 0X00, 0X00, 0X00, 0X00, 0X1D, 0XB6, 0XFF, 0XFF,
-  0XEF, 0X83, 0X21, 0X01, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X1C, 0X7C,
-  0XE2, 0XFF, 0XCD, 0X58, 0X11, 0X01, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X06, 0X0D, 0X0F, 0X08, 0X01, 0X03, 0X6E, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X01, 0X01, 0X01, 0X00, 0X00, 0X00, 0X00, 0X00, 0X05, 0X24,
-  0X5E, 0X9D, 0XC1, 0XB6, 0X78, 0X2E, 0X08, 0X00, 0X0D, 0X59, 0XBC, 0XFF,
-  0XFF, 0XFA, 0XD1, 0X83, 0X29, 0X04, 0X00, 0X00, 0X2E, 0XE2, 0XE2, 0XC3,
-  0XC3, 0XBC, 0X97, 0X44, 0X0A, 0X00, 0X00, 0X00, 0X00, 0X0E, 0X7F, 0XFF,
-  0XFF, 0XFF, 0XC8, 0X6B, 0X1A, 0X01, 0X00, 0X00, 0X00, 0X00, 0X00, 0X0E,
-  0X61, 0XE2, 0XFF, 0XFF, 0XCF, 0X50, 0X0E, 0X01, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X08, 0X16, 0X21, 0X1C, 0X0C, 0X02, 0X03, 0X6E, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X03, 0X1E, 0X50, 0X78, 0X81, 0X5E, 0X26, 0X07, 0X00, 0X00, 0X0E,
-  0X5C, 0XDB, 0XFF, 0XFF, 0XFA, 0XA3, 0X38, 0X07, 0X00, 0X00, 0X25, 0XEF,
-  0XEF, 0XCF, 0XC8, 0XC1, 0X9B, 0X44, 0X09, 0X00, 0X00, 0X00, 0X02, 0X3D,
-  0XCD, 0XFF, 0XFF, 0XE7, 0XB6, 0X5F, 0X14, 0X01, 0X00, 0X00, 0X00, 0X00,
-  0X03, 0X34, 0XB4, 0XFF, 0XFF, 0XFF, 0XBA, 0X3F, 0X0A, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X07, 0X1D, 0X35, 0X3E, 0X2D, 0X11, 0X03, 0X13, 0X6D,
-  0X00, 0X00, 0X00, 0X00, 0X11, 0X41, 0X72, 0X83, 0X65, 0X2A, 0X08, 0X00,
-  0X02, 0X32, 0XB2, 0XFF, 0XFF, 0XFF, 0XA5, 0X37, 0X06, 0X00, 0X0A, 0XAB,
-  0XF4, 0XDD, 0XCD, 0XC1, 0X9B, 0X41, 0X08, 0X00, 0X00, 0X03, 0X5E, 0XE7,
-  0XFF, 0XF2, 0XD8, 0XAD, 0X57, 0X11, 0X00, 0X00, 0X00, 0X00, 0X0B, 0X55,
-  0XDD, 0XFF, 0XFF, 0XFF, 0X9F, 0X31, 0X07, 0X00, 0X00, 0X00, 0X00, 0X01,
-  0X10, 0X33, 0X51, 0X55, 0X39, 0X14, 0X03, 0X6E, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X01, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X01,
-  0X1E, 0X5F, 0X99, 0XA9, 0X7D, 0X33, 0X09, 0X00, 0X00, 0X02, 0X3B, 0XCA,
-  0XFF, 0XFF, 0XEA, 0X8D, 0X2A, 0X04, 0X00, 0X00, 0X04, 0X9B, 0XEF, 0XD1,
-  0XC6, 0XBC, 0X97, 0X3E, 0X07, 0X00, 0X00, 0X00, 0X01, 0X48, 0XD8, 0XFF,
-  0XEF, 0XD4, 0XAB, 0X55, 0X0F, 0X00, 0X00, 0X00, 0X00, 0X00, 0X08, 0X4F,
-  0XD6, 0XFF, 0XFF, 0XFF, 0X97, 0X2C, 0X06, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X01, 0X10, 0X33, 0X53, 0X58, 0X3A, 0X13, 0X02, 0X03, 0X6E, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X01, 0X03, 0X03, 0X01, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X0C, 0X47, 0X9B, 0XD1, 0XD1, 0X91, 0X39, 0X0A, 0X01, 0X00, 0X0A,
-  0X70, 0XF2, 0XFF, 0XFA, 0XCA, 0X78, 0X1F, 0X02, 0X00, 0X00, 0X05, 0XAB,
-  0XE2, 0XBC, 0XBA, 0XB8, 0X93, 0X3B, 0X06, 0X00, 0X00, 0X00, 0X00, 0X20,
-  0XAF, 0XFF, 0XFC, 0XD8, 0XAD, 0X55, 0X0F, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X02, 0X2F, 0XA9, 0XFF, 0XFF, 0XFF, 0X9F, 0X2F, 0X06, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X08, 0X23, 0X41, 0X4A, 0X32, 0X11, 0X02, 0X03, 0X6E,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X02, 0X08, 0X0A, 0X08, 0X03, 0X01, 0X00,
-  0X00, 0X00, 0X06, 0X37, 0X8F, 0XE0, 0XFF, 0XED, 0X97, 0X3A, 0X0A, 0X01,
-  0X01, 0X37, 0XBC, 0XFA, 0XEF, 0XD8, 0XB2, 0X62, 0X17, 0X01, 0X00, 0X00,
-  0X06, 0XA9, 0XD6, 0XB8, 0XB8, 0XB4, 0X8D, 0X37, 0X05, 0X00, 0X00, 0X00,
-  0X00, 0X08, 0X75, 0XFF, 0XFF, 0XE7, 0XB2, 0X59, 0X10, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X12, 0X6D, 0XEF, 0XFF, 0XFF, 0XAB, 0X34, 0X07, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X02, 0X12, 0X29, 0X34, 0X27, 0X0E, 0X01,
-  0X03, 0X6D, 0X00, 0X00, 0X00, 0X00, 0X03, 0X0D, 0X15, 0X15, 0X0E, 0X06,
-  0X01, 0X00, 0X02, 0X29, 0X7D, 0XDB, 0XFF, 0XFF, 0XF2, 0X95, 0X37, 0X0A,
-  0X0A, 0X93, 0XD8, 0XD8, 0XD1, 0XC3, 0XA1, 0X53, 0X11, 0X00, 0X00, 0X04,
-  0X7C, 0XDD, 0XC6, 0XBA, 0XB4, 0X8A, 0X33, 0X05, 0X00, 0X00, 0X00, 0X01,
-  0X3C, 0XDD, 0XFF, 0XFC, 0XBF, 0X5F, 0X11, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X03, 0X3D, 0XB8, 0XFF, 0XFF, 0XB4, 0X3C, 0X08, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X07, 0X17, 0X23, 0X1C, 0X0B, 0X03, 0X6D, 0X00, 0X00, 0X00,
-  0X01, 0X0A, 0X18, 0X22, 0X1E, 0X13, 0X07, 0X01, 0X00, 0X12, 0X57, 0XB4,
-  0XFC, 0XFF, 0XFF, 0XEA, 0X8C, 0X33, 0X09, 0X1C, 0XC8, 0XCF, 0XC3, 0XC3,
-  0XBC, 0X99, 0X4B, 0X0E, 0X00, 0X00, 0X01, 0X55, 0XE2, 0XD6, 0XBC, 0XB2,
-  0X86, 0X32, 0X05, 0X00, 0X00, 0X00, 0X00, 0X1E, 0XBA, 0XFF, 0XFF, 0XCF,
-  0X67, 0X13, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X22, 0X8C, 0XF4, 0XFF,
-  0XB6, 0X41, 0X09, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X02, 0X0C, 0X16,
-  0X15, 0X09, 0X03, 0X6D, 0X00, 0X00, 0X00, 0X04, 0X11, 0X22, 0X2B, 0X26,
-  0X18, 0X09, 0X02, 0X02, 0X23, 0X72, 0XCD, 0XFF, 0XFF, 0XFF, 0XDD, 0X81,
-  0X2D, 0X09, 0X2D, 0XDB, 0XC8, 0XBF, 0XBF, 0XB6, 0X91, 0X42, 0X0B, 0X00,
-  0X00, 0X01, 0X4B, 0XE5, 0XE2, 0XC1, 0XB2, 0X84, 0X2F, 0X04, 0X00, 0X00,
-  0X00, 0X00, 0X14, 0XA1, 0XFF, 0XFF, 0XDB, 0X6D, 0X15, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X15, 0X70, 0XD6, 0XFA, 0XB4, 0X44, 0X0A, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X06, 0X0E, 0X10, 0X07, 0X03, 0X6D, 0X00,
-  0X00, 0X01, 0X09, 0X1C, 0X33, 0X3E, 0X33, 0X1F, 0X0C, 0X03, 0X05, 0X38,
-  0X8F, 0XE2, 0XFF, 0XFF, 0XFC, 0XCD, 0X75, 0X29, 0X08, 0X38, 0XDD, 0XBF,
-  0XB6, 0XBC, 0XB2, 0X8C, 0X3D, 0X09, 0X00, 0X00, 0X00, 0X3D, 0XDD, 0XED,
-  0XC6, 0XB2, 0X84, 0X2F, 0X04, 0X00, 0X00, 0X00, 0X00, 0X0C, 0X86, 0XFF,
-  0XFF, 0XE7, 0X75, 0X17, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X0C, 0X58,
-  0XBA, 0XED, 0XB6, 0X48, 0X0C, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X03, 0X0B, 0X0E, 0X07, 0X03, 0X6E, 0X00, 0X00, 0X02, 0X0E, 0X24, 0X3D,
-  0X45, 0X38, 0X21, 0X0C, 0X03, 0X00, 0X0A, 0X4B, 0XA3, 0XE7, 0XFF, 0XFF,
-  0XF2, 0XC6, 0X73, 0X29, 0X08, 0X01, 0X39, 0XD8, 0XBC, 0XB4, 0XB8, 0XAF,
-  0X8A, 0X3C, 0X08, 0X00, 0X00, 0X00, 0X00, 0X33, 0XD8, 0XF7, 0XCA, 0XB4,
-  0X84, 0X2E, 0X04, 0X00, 0X00, 0X00, 0X00, 0X00, 0X08, 0X77, 0XFF, 0XFF,
-  0XED, 0X77, 0X18, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X09, 0X50,
-  0XB6, 0XEF, 0XBC, 0X4D, 0X0D, 0X01, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X03, 0X0C, 0X0F, 0X08, 0X01, 0X03, 0X6E, 0X00, 0X00, 0X01, 0X0A,
-  0X1E, 0X33, 0X3B, 0X31, 0X1D, 0X0B, 0X02, 0X00, 0X07, 0X3F, 0X95, 0XE2,
-  0XFF, 0XFF, 0XFA, 0XCD, 0X77, 0X2A, 0X08, 0X01, 0X31, 0XD8, 0XBF, 0XB4,
-  0XB8, 0XB2, 0X8C, 0X3E, 0X09, 0X00, 0X00, 0X00, 0X00, 0X33, 0XD8, 0XEF,
-  0XC6, 0XB2, 0X84, 0X2F, 0X04, 0X00, 0X00, 0X00, 0X00, 0X00, 0X09, 0X81,
-  0XFF, 0XFF, 0XE5, 0X72, 0X17, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X0C, 0X5C, 0XCA, 0XFF, 0XC6, 0X50, 0X0E, 0X01, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X06, 0X11, 0X14, 0X0B, 0X02, 0X03, 0X6E, 0X00, 0X00,
-  0X00, 0X06, 0X15, 0X27, 0X31, 0X29, 0X1A, 0X0A, 0X02, 0X00, 0X03, 0X2B,
-  0X7D, 0XD1, 0XFF, 0XFF, 0XFF, 0XD4, 0X7C, 0X2B, 0X08, 0X01, 0X30, 0XD6,
-  0XBF, 0XB6, 0XBA, 0XB2, 0X8D, 0X40, 0X0A, 0X00, 0X00, 0X00, 0X01, 0X45,
-  0XE0, 0XE5, 0XBF, 0XAF, 0X84, 0X2F, 0X04, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X11, 0X9B, 0XFF, 0XFF, 0XD8, 0X6A, 0X15, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X14, 0X72, 0XE5, 0XFF, 0XCA, 0X50, 0X0E, 0X01, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X01, 0X0A, 0X17, 0X1B, 0X0E, 0X03, 0X03, 0X6D,
-  0X00, 0X00, 0X00, 0X04, 0X10, 0X21, 0X2B, 0X26, 0X18, 0X09, 0X02, 0X02,
-  0X21, 0X70, 0XC6, 0XFF, 0XFF, 0XFF, 0XD8, 0X7F, 0X2D, 0X08, 0X34, 0XD1,
-  0XC1, 0XBA, 0XBC, 0XB2, 0X8F, 0X41, 0X0A, 0X00, 0X00, 0X02, 0X5B, 0XE5,
-  0XD8, 0XBC, 0XAD, 0X81, 0X2D, 0X04, 0X00, 0X00, 0X00, 0X00, 0X1B, 0XB2,
-  0XFF, 0XFF, 0XCF, 0X64, 0X13, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X1D,
-  0X83, 0XF2, 0XFF, 0XC8, 0X4D, 0X0E, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X01, 0X0D, 0X1C, 0X1F, 0X10, 0X03, 0X6D, 0X00, 0X00, 0X00, 0X02, 0X0C,
-  0X1B, 0X24, 0X21, 0X15, 0X08, 0X02, 0X01, 0X1A, 0X62, 0XBA, 0XFA, 0XFF,
-  0XFF, 0XDB, 0X83, 0X2F, 0X09, 0X38, 0XCD, 0XC3, 0XBC, 0XBF, 0XB4, 0X91,
-  0X42, 0X0A, 0X00, 0X00, 0X04, 0X6D, 0XE7, 0XD1, 0XBA, 0XAD, 0X81, 0X2B,
-  0X03, 0X00, 0X00, 0X00, 0X00, 0X27, 0XC6, 0XFF, 0XFF, 0XC6, 0X5E, 0X10,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X01, 0X27, 0X95, 0XFF, 0XFF, 0XC3, 0X47,
-  0X0C, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X03, 0X12, 0X23, 0X24, 0X11,
-  0X03, 0X6E, 0X00, 0X00, 0X00, 0X00, 0X06, 0X10, 0X18, 0X17, 0X0F, 0X06,
-  0X01, 0X00, 0X00, 0X0E, 0X48, 0X9D, 0XE7, 0XFF, 0XFF, 0XE2, 0X88, 0X2F,
-  0X08, 0X01, 0X2D, 0XC1, 0XCD, 0XC8, 0XC6, 0XBA, 0X95, 0X47, 0X0C, 0X00,
-  0X00, 0X00, 0X07, 0X84, 0XE2, 0XC6, 0XB8, 0XAD, 0X7F, 0X29, 0X03, 0X00,
-  0X00, 0X00, 0X00, 0X01, 0X3E, 0XE5, 0XFF, 0XFA, 0XB4, 0X53, 0X0D, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X03, 0X3F, 0XBF, 0XFF, 0XFF, 0XB4, 0X3B,
-  0X08, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X08, 0X1E, 0X31, 0X2B,
-  0X12, 0X03, 0X03, 0X6E, 0X00, 0X00, 0X00, 0X00, 0X01, 0X06, 0X0C, 0X0C,
-  0X08, 0X03, 0X01, 0X00, 0X00, 0X04, 0X28, 0X70, 0XBC, 0XF2, 0XFF, 0XE0,
-  0X88, 0X30, 0X08, 0X00, 0X1A, 0X9F, 0XD6, 0XDD, 0XD4, 0XC3, 0X9F, 0X4F,
-  0X0E, 0X00, 0X00, 0X00, 0X0F, 0XA9, 0XD6, 0XB8, 0XB6, 0XAD, 0X7D, 0X28,
-  0X02, 0X00, 0X00, 0X00, 0X00, 0X05, 0X6B, 0XFF, 0XFF, 0XE2, 0XA3, 0X47,
-  0X09, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X0E, 0X6E, 0XF4, 0XFF, 0XFF,
-  0X95, 0X29, 0X05, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X02, 0X15, 0X33,
-  0X44, 0X33, 0X13, 0X02, 0X03, 0X6D, 0X00, 0X00, 0X00, 0X00, 0X00, 0X01,
-  0X04, 0X05, 0X03, 0X01, 0X00, 0X00, 0X00, 0X12, 0X45, 0X8D, 0XCD, 0XE2,
-  0XCD, 0X7F, 0X2C, 0X07, 0X0E, 0X77, 0XD1, 0XEF, 0XE7, 0XD4, 0XA9, 0X58,
-  0X13, 0X01, 0X00, 0X21, 0XC8, 0XC6, 0XB2, 0XB6, 0XAB, 0X78, 0X24, 0X02,
-  0X00, 0X00, 0X00, 0X14, 0XA3, 0XFF, 0XFC, 0XCD, 0X95, 0X3C, 0X06, 0X00,
-  0X00, 0X00, 0X00, 0X01, 0X28, 0XA9, 0XFF, 0XFF, 0XF4, 0X75, 0X1B, 0X02,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X09, 0X29, 0X4C, 0X54, 0X35, 0X11, 0X03,
-  0X6E, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X01, 0X02, 0X01, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X08, 0X2C, 0X68, 0XA5, 0XC3, 0XB8, 0X75, 0X29, 0X07,
-  0X00, 0X09, 0X5B, 0XC6, 0XFC, 0XFC, 0XE2, 0XB8, 0X64, 0X18, 0X02, 0X00,
-  0X00, 0X39, 0XD8, 0XBC, 0XB2, 0XB6, 0XAB, 0X77, 0X22, 0X02, 0X00, 0X00,
-  0X00, 0X00, 0X30, 0XCD, 0XFF, 0XE5, 0XC1, 0X8C, 0X33, 0X04, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X04, 0X4A, 0XDB, 0XFF, 0XFF, 0XD8, 0X59, 0X11, 0X01,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X01, 0X15, 0X3E, 0X5F, 0X5C, 0X33, 0X0E,
-  0X01, 0X03, 0X6D, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X01, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X05, 0X20, 0X54, 0X8C, 0XAD, 0XA5, 0X6D, 0X29,
-  0X07, 0X0A, 0X54, 0XBF, 0XFF, 0XFF, 0XF2, 0XC6, 0X6E, 0X1E, 0X03, 0X00,
-  0X5B, 0XDB, 0XB8, 0XB4, 0XB6, 0XAB, 0X73, 0X21, 0X02, 0X00, 0X00, 0X02,
-  0X4F, 0XE2, 0XFC, 0XD6, 0XB8, 0X83, 0X2C, 0X03, 0X00, 0X00, 0X00, 0X00,
-  0X0C, 0X67, 0XF2, 0XFF, 0XFF, 0XC6, 0X4B, 0X0D, 0X01, 0X00, 0X00, 0X00,
-  0X00, 0X03, 0X1E, 0X48, 0X64, 0X57, 0X2C, 0X0A, 0X02, 0X6E, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X04, 0X1A, 0X47, 0X78, 0X99, 0X99, 0X6B, 0X2D, 0X09, 0X01,
-  0X00, 0X0F, 0X58, 0XBA, 0XFF, 0XFF, 0XFF, 0XD1, 0X78, 0X24, 0X04, 0X00,
-  0X00, 0X02, 0X84, 0XDB, 0XB6, 0XB4, 0XB6, 0XA9, 0X72, 0X21, 0X02, 0X00,
-  0X00, 0X00, 0X00, 0X06, 0X67, 0XEA, 0XF7, 0XD1, 0XB6, 0X7D, 0X28, 0X03,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X12, 0X77, 0XFA, 0XFF, 0XFF, 0XBA,
-  0X44, 0X0B, 0X01, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X04, 0X21, 0X46,
-  0X59, 0X4C, 0X24, 0X08, 0X01, 0X12, 0X6E, 0X00, 0X00, 0X00, 0X02, 0X13,
-  0X39, 0X65, 0X88, 0X8F, 0X6B, 0X31, 0X0C, 0X01, 0X00, 0X11, 0X54, 0XB2,
-  0XFC, 0XFF, 0XFF, 0XE2, 0X88, 0X2E, 0X07, 0X00, 0X00, 0X08, 0XA9, 0XDD,
-  0XBA, 0XB6, 0XB6, 0XA9, 0X72, 0X22, 0X02, 0X00, 0X00, 0X00, 0X00, 0X0C,
-  0X7A, 0XF2, 0XF2, 0XCD, 0XB4, 0X7A, 0X26, 0X02, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X18, 0X83, 0XFF, 0XFF, 0XFF, 0XB4, 0X3F, 0X0A, 0X01, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X05, 0X22, 0X44, 0X54, 0X45, 0X20, 0X07,
-  0X00, 0X12, 0X6D, 0X00, 0X00, 0X00, 0X00, 0X09, 0X24, 0X4F, 0X73, 0X83,
-  0X6B, 0X35, 0X0E, 0X00, 0X0A, 0X3D, 0X95, 0XF2, 0XFF, 0XFF, 0XF4, 0X9B,
-  0X39, 0X0A, 0X01, 0X0D, 0XB2, 0XDD, 0XC3, 0XBF, 0XBA, 0XAB, 0X77, 0X25,
-  0X03, 0X00, 0X00, 0X00, 0X18, 0X95, 0XF4, 0XE7, 0XC8, 0XAF, 0X78, 0X25,
-  0X02, 0X00, 0X00, 0X00, 0X00, 0X01, 0X25, 0X9B, 0XFF, 0XFF, 0XFF, 0XA9,
-  0X3A, 0X08, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X09, 0X2A, 0X4C, 0X5B,
-  0X47, 0X1F, 0X07, 0X12, 0X6E, 0X00, 0X00, 0X00, 0X00, 0X02, 0X13, 0X33,
-  0X5B, 0X73, 0X68, 0X3B, 0X11, 0X02, 0X00, 0X02, 0X1D, 0X67, 0XCF, 0XFF,
-  0XFF, 0XFF, 0XB4, 0X47, 0X0E, 0X01, 0X00, 0X08, 0X91, 0XD8, 0XD1, 0XCA,
-  0XC1, 0XB2, 0X7D, 0X2A, 0X03, 0X00, 0X00, 0X00, 0X01, 0X30, 0XB6, 0XEA,
-  0XD4, 0XBF, 0XAD, 0X78, 0X25, 0X02, 0X00, 0X00, 0X00, 0X00, 0X00, 0X04,
-  0X41, 0XC6, 0XFF, 0XFF, 0XFA, 0X97, 0X31, 0X06, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X01, 0X15, 0X41, 0X67, 0X72, 0X53, 0X23, 0X07, 0X00, 0X12,
-  0X6E, 0X00, 0X00, 0X00, 0X00, 0X00, 0X07, 0X20, 0X46, 0X67, 0X68, 0X40,
-  0X15, 0X03, 0X00, 0X00, 0X07, 0X37, 0X97, 0XFA, 0XFF, 0XFF, 0XCA, 0X54,
-  0X11, 0X01, 0X00, 0X02, 0X4C, 0XB8, 0XE0, 0XDD, 0XCA, 0XB6, 0X86, 0X30,
-  0X04, 0X00, 0X00, 0X00, 0X02, 0X57, 0XD1, 0XD4, 0XC3, 0XBA, 0XAD, 0X78,
-  0X25, 0X02, 0X00, 0X00, 0X00, 0X00, 0X00, 0X12, 0X70, 0XEF, 0XFF, 0XFF,
-  0XE0, 0X81, 0X27, 0X04, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X06, 0X2E,
-  0X68, 0X91, 0X93, 0X65, 0X29, 0X08, 0X01, 0X12, 0X7D, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X02, 0X17, 0X3E, 0X65, 0X6D, 0X46, 0X17, 0X00, 0X00, 0X01,
-  0X1A, 0X6E, 0XE5, 0XFF, 0XFF, 0XCF, 0X55, 0X11, 0X01, 0X00, 0X1E, 0X88,
-  0XE2, 0XED, 0XD4, 0XBA, 0X88, 0X32, 0X04, 0X00, 0X00, 0X03, 0X7D, 0XDB,
-  0XBF, 0XB6, 0XB6, 0XA9, 0X77, 0X24, 0X02, 0X00, 0X00, 0X00, 0X02, 0X2F,
-  0XA7, 0XFF, 0XFF, 0XF7, 0XC6, 0X70, 0X20, 0X03, 0X00, 0X00, 0X00, 0X00,
-  0X01, 0X16, 0X53, 0X97, 0XB8, 0XAD, 0X72, 0X2C, 0X09, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X01, 0X01, 0X00, 0X00, 0X13, 0X7C, 0X00,
-  0X00, 0X00, 0X00, 0X02, 0X18, 0X46, 0X72, 0X77, 0X48, 0X00, 0X00, 0X12,
-  0X64, 0XE2, 0XFF, 0XFF, 0XC3, 0X4C, 0X0E, 0X0E, 0X6E, 0XE0, 0XF2, 0XD4,
-  0XBA, 0X84, 0X2F, 0X04, 0X00, 0X8C, 0XD6, 0XB4, 0XB2, 0XB4, 0XA9, 0X73,
-  0X23, 0X02, 0X00, 0X08, 0X50, 0XC6, 0XFF, 0XFF, 0XEA, 0XBA, 0X68, 0X1D,
-  0X03, 0X00, 0X00, 0X04, 0X28, 0X6E, 0XAF, 0XCA, 0XB8, 0X73, 0X2C, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X01, 0X01, 0X01, 0X00, 0X12, 0X6D, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X04, 0X22, 0X57, 0X81, 0X7F, 0X4B, 0X16, 0X00,
-  0X00, 0X00, 0X14, 0X72, 0XF2, 0XFF, 0XFF, 0XB4, 0X42, 0X0A, 0X00, 0X00,
-  0X0C, 0X6E, 0XE2, 0XEA, 0XCD, 0XB4, 0X7F, 0X2C, 0X03, 0X00, 0X00, 0X04,
-  0X8F, 0XCF, 0XAF, 0XB2, 0XB4, 0XA7, 0X70, 0X21, 0X02, 0X00, 0X00, 0X00,
-  0X0D, 0X5F, 0XCF, 0XFF, 0XFF, 0XE5, 0XB8, 0X67, 0X1C, 0X03, 0X00, 0X00,
-  0X00, 0X00, 0X07, 0X2F, 0X77, 0XB4, 0XCA, 0XB4, 0X72, 0X2A, 0X08, 0X12,
-  0X6D, 0X00, 0X00, 0X00, 0X00, 0X00, 0X08, 0X30, 0X6A, 0X91, 0X88, 0X4C,
-  0X15, 0X00, 0X00, 0X00, 0X1E, 0X8A, 0XFF, 0XFF, 0XFF, 0XA3, 0X3A, 0X08,
-  0X00, 0X00, 0X0F, 0X7D, 0XE5, 0XE0, 0XC6, 0XAF, 0X7C, 0X29, 0X03, 0X00,
-  0X00, 0X06, 0X93, 0XC8, 0XAB, 0XAF, 0XB2, 0XA5, 0X6E, 0X1F, 0X02, 0X00,
-  0X00, 0X00, 0X0E, 0X61, 0XCF, 0XFF, 0XFF, 0XE7, 0XBA, 0X68, 0X1C, 0X03,
-  0X00, 0X00, 0X00, 0X00, 0X07, 0X2E, 0X72, 0XAD, 0XC3, 0XB2, 0X70, 0X2A,
-  0X08, 0X13, 0X7C, 0X00, 0X00, 0X00, 0X00, 0X0F, 0X40, 0X7C, 0XA1, 0X8F,
-  0X4D, 0X00, 0X01, 0X2C, 0XA5, 0XFF, 0XFF, 0XF4, 0X97, 0X33, 0X07, 0X15,
-  0X8F, 0XE0, 0XD4, 0XBC, 0XAB, 0X7A, 0X26, 0X03, 0X00, 0X91, 0XC3, 0XAB,
-  0XAF, 0XB2, 0XA5, 0X6E, 0X1F, 0X02, 0X00, 0X0B, 0X58, 0XC8, 0XFF, 0XFF,
-  0XED, 0XBC, 0X6B, 0X1E, 0X03, 0X00, 0X00, 0X05, 0X28, 0X68, 0XA5, 0XBC,
-  0XAB, 0X6D, 0X2A, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X01, 0X01, 0X00,
-  0X00, 0X02, 0X7D, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X01, 0X01, 0X00, 0X00, 0X00, 0X00, 0X00, 0X01, 0X17, 0X4F, 0X8C, 0XAD,
-  0X97, 0X50, 0X17, 0X00, 0X00, 0X03, 0X3C, 0XBC, 0XFF, 0XFF, 0XEA, 0X8C,
-  0X2F, 0X06, 0X00, 0X00, 0X1D, 0X9B, 0XD8, 0XC8, 0XBA, 0XA9, 0X77, 0X25,
-  0X03, 0X00, 0X00, 0X04, 0X86, 0XC1, 0XAD, 0XAF, 0XB2, 0XA5, 0X6E, 0X20,
-  0X02, 0X00, 0X00, 0X00, 0X07, 0X48, 0XBC, 0XFF, 0XFF, 0XEF, 0XC1, 0X6E,
-  0X20, 0X03, 0X00, 0X00, 0X00, 0X00, 0X03, 0X21, 0X5E, 0X9B, 0XB6, 0XA7,
-  0X6D, 0X2A, 0X08, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X01,
-  0X00, 0X00, 0X00, 0X02, 0X7D, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X01, 0X01, 0X01, 0X00, 0X00, 0X00, 0X00, 0X00, 0X02, 0X1F, 0X5C,
-  0X9B, 0XBA, 0X9D, 0X54, 0X18, 0X00, 0X00, 0X06, 0X4B, 0XCD, 0XFF, 0XFF,
-  0XE2, 0X86, 0X2B, 0X06, 0X00, 0X00, 0X24, 0XA3, 0XD1, 0XC1, 0XB6, 0XA9,
-  0X77, 0X25, 0X03, 0X00, 0X00, 0X03, 0X78, 0XBF, 0XAF, 0XAF, 0XB2, 0XA5,
-  0X70, 0X21, 0X02, 0X00, 0X00, 0X00, 0X04, 0X3C, 0XB2, 0XFF, 0XFF, 0XF2,
-  0XC3, 0X72, 0X21, 0X04, 0X00, 0X00, 0X00, 0X00, 0X02, 0X1C, 0X57, 0X95,
-  0XB2, 0XA5, 0X6D, 0X2B, 0X09, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X02, 0X6D, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X01, 0X02, 0X01, 0X00, 0X00, 0X00, 0X00, 0X00, 0X04,
-  0X27, 0X68, 0XA7, 0XC3, 0XA3, 0X55, 0X18, 0X00, 0X00, 0X09, 0X58, 0XD6,
-  0XFF, 0XFF, 0XDB, 0X81, 0X29, 0X05, 0X00, 0X00, 0X2A, 0XA9, 0XCD, 0XBA,
-  0XB4, 0XA9, 0X75, 0X24, 0X03, 0X00, 0X00, 0X02, 0X6A, 0XBC, 0XB2, 0XAF,
-  0XB2, 0XA5, 0X72, 0X21, 0X02, 0X00, 0X00, 0X00, 0X02, 0X33, 0XA7, 0XFF,
-  0XFF, 0XF4, 0XC6, 0X73, 0X23, 0X04, 0X00, 0X00, 0X00, 0X00, 0X01, 0X18,
-  0X51, 0X91, 0XAD, 0XA3, 0X6B, 0X2A, 0X08, 0X03, 0X6E, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X01, 0X02, 0X01, 0X01, 0X00, 0X00, 0X00, 0X00,
-  0X07, 0X30, 0X75, 0XB4, 0XCD, 0XA5, 0X55, 0X17, 0X03, 0X00, 0X0D, 0X67,
-  0XE2, 0XFF, 0XFF, 0XD1, 0X7C, 0X27, 0X04, 0X00, 0X00, 0X32, 0XAD, 0XC6,
-  0XB8, 0XB2, 0XA7, 0X73, 0X24, 0X03, 0X00, 0X00, 0X00, 0X64, 0XBC, 0XB4,
-  0XAF, 0XB2, 0XA5, 0X70, 0X21, 0X02, 0X00, 0X00, 0X00, 0X01, 0X30, 0XA3,
-  0XFF, 0XFF, 0XF7, 0XCA, 0X77, 0X25, 0X05, 0X00, 0X00, 0X00, 0X00, 0X01,
-  0X17, 0X4F, 0X8C, 0XA7, 0X9D, 0X67, 0X28, 0X08, 0X00, 0X03, 0X6D, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X02, 0X03, 0X02, 0X01, 0X00, 0X00,
-  0X00, 0X0B, 0X3B, 0X83, 0XBF, 0XD1, 0XA5, 0X53, 0X17, 0X00, 0X14, 0X78,
-  0XED, 0XFF, 0XFC, 0XCA, 0X75, 0X24, 0X04, 0X00, 0X3D, 0XB4, 0XBF, 0XB4,
-  0XB2, 0XA5, 0X70, 0X22, 0X02, 0X00, 0X00, 0X61, 0XBC, 0XB4, 0XB2, 0XB2,
-  0XA5, 0X6E, 0X21, 0X02, 0X00, 0X00, 0X01, 0X2D, 0XA1, 0XFF, 0XFF, 0XFA,
-  0XCF, 0X7D, 0X28, 0X06, 0X00, 0X00, 0X00, 0X01, 0X15, 0X4A, 0X84, 0X9D,
-  0X91, 0X5E, 0X24, 0X07, 0X02, 0X6D, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X01, 0X02, 0X03, 0X02, 0X00, 0X00, 0X00, 0X00, 0X00, 0X10, 0X45,
-  0X8D, 0XC6, 0XD1, 0XA1, 0X4F, 0X15, 0X00, 0X00, 0X1D, 0X8A, 0XF7, 0XFF,
-  0XF7, 0XC3, 0X6E, 0X21, 0X04, 0X00, 0X01, 0X4A, 0XB6, 0XB8, 0XB2, 0XAF,
-  0XA3, 0X6D, 0X21, 0X02, 0X00, 0X00, 0X02, 0X61, 0XBA, 0XB8, 0XB2, 0XB2,
-  0XA5, 0X6D, 0X20, 0X02, 0X00, 0X00, 0X00, 0X01, 0X2B, 0X9D, 0XFF, 0XFF,
-  0XFF, 0XD4, 0X81, 0X2A, 0X06, 0X00, 0X00, 0X00, 0X00, 0X01, 0X13, 0X44,
-  0X7A, 0X91, 0X86, 0X57, 0X21, 0X06, 0X02, 0X6E, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X01, 0X02, 0X02, 0X01, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X01, 0X14, 0X4B, 0X93, 0XC8, 0XCF, 0X9B, 0X4A, 0X13, 0X02, 0X00, 0X01,
-  0X26, 0X97, 0XFA, 0XFF, 0XF2, 0XBF, 0X6B, 0X20, 0X03, 0X00, 0X00, 0X02,
-  0X58, 0XB6, 0XB6, 0XAF, 0XAF, 0XA3, 0X6A, 0X1F, 0X02, 0X00, 0X00, 0X00,
-  0X03, 0X65, 0XBA, 0XB8, 0XB4, 0XB2, 0XA3, 0X6B, 0X1F, 0X02, 0X00, 0X00,
-  0X00, 0X00, 0X01, 0X2B, 0X9D, 0XFF, 0XFF, 0XFF, 0XD8, 0X83, 0X2C, 0X07,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X01, 0X12, 0X41, 0X73, 0X8A, 0X7D, 0X50,
-  0X1E, 0X06, 0X00, 0X02, 0X6D, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X01, 0X01, 0X02, 0X01, 0X00, 0X00, 0X00, 0X00, 0X01, 0X15, 0X4C, 0X91,
-  0XC1, 0XC6, 0X91, 0X41, 0X10, 0X00, 0X01, 0X2A, 0X9D, 0XFC, 0XFF, 0XF2,
-  0XBF, 0X6D, 0X20, 0X04, 0X00, 0X03, 0X62, 0XB8, 0XB4, 0XAF, 0XAF, 0XA3,
-  0X68, 0X1E, 0X02, 0X00, 0X00, 0X05, 0X6E, 0XBC, 0XB6, 0XB2, 0XB2, 0XA3,
-  0X68, 0X1E, 0X02, 0X00, 0X00, 0X00, 0X02, 0X31, 0XA3, 0XFF, 0XFF, 0XFF,
-  0XD8, 0X83, 0X2D, 0X07, 0X00, 0X00, 0X00, 0X00, 0X01, 0X13, 0X44, 0X73,
-  0X86, 0X7A, 0X4C, 0X1C, 0X05, 0X02, 0X6E, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X01, 0X01, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X11, 0X44, 0X84, 0XAF, 0XB2, 0X81, 0X3A, 0X0E, 0X01, 0X00, 0X01, 0X28,
-  0X97, 0XFA, 0XFF, 0XF7, 0XC6, 0X70, 0X21, 0X04, 0X00, 0X00, 0X04, 0X64,
-  0XBA, 0XBA, 0XB2, 0XAF, 0XA1, 0X67, 0X1D, 0X02, 0X00, 0X00, 0X00, 0X09,
-  0X81, 0XBA, 0XB2, 0XB2, 0XB2, 0XA1, 0X67, 0X1C, 0X01, 0X00, 0X00, 0X00,
-  0X00, 0X04, 0X3F, 0XB4, 0XFF, 0XFF, 0XFF, 0XD1, 0X7D, 0X29, 0X07, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X02, 0X19, 0X4C, 0X7C, 0X8C, 0X7A, 0X4B, 0X1B,
-  0X05, 0X00, 0X02, 0X6D, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X0C, 0X37, 0X6E, 0X99,
-  0X9D, 0X70, 0X32, 0X0B, 0X00, 0X01, 0X21, 0X8A, 0XF4, 0XFF, 0XFF, 0XCF,
-  0X77, 0X25, 0X05, 0X00, 0X05, 0X61, 0XBF, 0XBF, 0XB6, 0XB2, 0XA1, 0X64,
-  0X1C, 0X02, 0X00, 0X00, 0X13, 0X97, 0XB6, 0XAD, 0XAF, 0XAF, 0X9F, 0X62,
-  0X1A, 0X01, 0X00, 0X00, 0X00, 0X0A, 0X55, 0XC8, 0XFF, 0XFF, 0XFA, 0XCA,
-  0X75, 0X26, 0X06, 0X00, 0X00, 0X00, 0X00, 0X04, 0X23, 0X59, 0X86, 0X91,
-  0X7D, 0X4A, 0X1A, 0X04, 0X12, 0X6D, 0X00, 0X00, 0X00, 0X00, 0X06, 0X28,
-  0X59, 0X7D, 0X83, 0X5F, 0X29, 0X09, 0X00, 0X00, 0X17, 0X73, 0XE7, 0XFF,
-  0XFF, 0XDD, 0X7F, 0X29, 0X06, 0X00, 0X04, 0X57, 0XC1, 0XCA, 0XBC, 0XB4,
-  0XA3, 0X64, 0X1B, 0X02, 0X00, 0X00, 0X23, 0XAB, 0XB2, 0XA9, 0XAD, 0XAF,
-  0X9D, 0X5F, 0X18, 0X01, 0X00, 0X00, 0X00, 0X17, 0X73, 0XDB, 0XFF, 0XFF,
-  0XEF, 0XC1, 0X6D, 0X22, 0X05, 0X00, 0X00, 0X00, 0X00, 0X0A, 0X32, 0X6D,
-  0X95, 0X9B, 0X81, 0X4A, 0X1A, 0X04, 0X12, 0X6E, 0X00, 0X00, 0X00, 0X00,
-  0X02, 0X19, 0X41, 0X64, 0X6B, 0X50, 0X23, 0X07, 0X00, 0X00, 0X00, 0X0C,
-  0X58, 0XD1, 0XFF, 0XFF, 0XED, 0X8C, 0X2F, 0X07, 0X00, 0X00, 0X03, 0X47,
-  0XBF, 0XD8, 0XC8, 0XB8, 0XA3, 0X64, 0X1B, 0X02, 0X00, 0X00, 0X00, 0X38,
-  0XB8, 0XAB, 0XA7, 0XAD, 0XAD, 0X9B, 0X5B, 0X16, 0X01, 0X00, 0X00, 0X00,
-  0X02, 0X2E, 0X93, 0XEA, 0XFF, 0XFC, 0XE7, 0XB6, 0X64, 0X1E, 0X04, 0X00,
-  0X00, 0X00, 0X00, 0X01, 0X13, 0X44, 0X83, 0XA7, 0XA9, 0X88, 0X4C, 0X1A,
-  0X04, 0X00, 0X12, 0X7D, 0X00, 0X00, 0X00, 0X00, 0X00, 0X0E, 0X2D, 0X4B,
-  0X55, 0X41, 0X1D, 0X06, 0X00, 0X00, 0X05, 0X3D, 0XB2, 0XFF, 0XFF, 0XFA,
-  0X99, 0X35, 0X09, 0X00, 0X01, 0X34, 0XB4, 0XE7, 0XD6, 0XBF, 0XA5, 0X65,
-  0X1C, 0X02, 0X00, 0X00, 0X44, 0XBC, 0XAD, 0XA5, 0XAF, 0XAD, 0X99, 0X59,
-  0X15, 0X01, 0X00, 0X00, 0X08, 0X47, 0XAB, 0XEF, 0XFC, 0XF2, 0XDD, 0XAD,
-  0X5B, 0X1A, 0X03, 0X00, 0X00, 0X00, 0X04, 0X1F, 0X58, 0X99, 0XBC, 0XBA,
-  0X95, 0X51, 0X1B, 0X05, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X01,
-  0X00, 0X00, 0X00, 0X00, 0X12, 0X7D, 0X00, 0X00, 0X00, 0X00, 0X00, 0X06,
-  0X1C, 0X35, 0X44, 0X38, 0X19, 0X05, 0X00, 0X00, 0X01, 0X25, 0X8C, 0XF7,
-  0XFF, 0XFF, 0XA9, 0X3E, 0X0A, 0X01, 0X00, 0X20, 0X9B, 0XF2, 0XE7, 0XC8,
-  0XA9, 0X6A, 0X1E, 0X02, 0X00, 0X00, 0X41, 0XBF, 0XAF, 0XA7, 0XAF, 0XAF,
-  0X9B, 0X58, 0X15, 0X01, 0X00, 0X00, 0X11, 0X62, 0XBC, 0XEF, 0XF2, 0XE7,
-  0XD1, 0XA1, 0X51, 0X15, 0X02, 0X00, 0X00, 0X00, 0X09, 0X2F, 0X70, 0XB4,
-  0XD6, 0XD1, 0XA7, 0X5B, 0X1E, 0X05, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X01, 0X02, 0X01, 0X00, 0X00, 0X00, 0X12, 0X7D, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X02, 0X10, 0X25, 0X33, 0X2E, 0X16, 0X05, 0X00, 0X00, 0X00, 0X13,
-  0X67, 0XDD, 0XFF, 0XFF, 0XB8, 0X47, 0X0D, 0X01, 0X00, 0X10, 0X7A, 0XEF,
-  0XFA, 0XD6, 0XB2, 0X70, 0X20, 0X02, 0X00, 0X00, 0X31, 0XB6, 0XBA, 0XA9,
-  0XAF, 0XAF, 0X9B, 0X58, 0X15, 0X01, 0X00, 0X00, 0X1C, 0X7A, 0XC8, 0XE7,
-  0XE7, 0XDB, 0XC6, 0X95, 0X47, 0X11, 0X02, 0X00, 0X00, 0X01, 0X11, 0X40,
-  0X8A, 0XCF, 0XEF, 0XEA, 0XB8, 0X64, 0X22, 0X06, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X01, 0X04, 0X04, 0X03, 0X01, 0X00, 0X00, 0X12, 0X7D, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X0A, 0X1C, 0X2A, 0X29, 0X15, 0X05, 0X00, 0X00,
-  0X00, 0X08, 0X4C, 0XBF, 0XFF, 0XFF, 0XC3, 0X50, 0X0F, 0X01, 0X00, 0X06,
-  0X5B, 0XE2, 0XFF, 0XE2, 0XBA, 0X77, 0X24, 0X02, 0X00, 0X00, 0X1E, 0XA5,
-  0XC6, 0XAF, 0XAF, 0XB2, 0X9D, 0X5B, 0X16, 0X01, 0X00, 0X00, 0X24, 0X8D,
-  0XCD, 0XDD, 0XDB, 0XD4, 0XBF, 0X8F, 0X41, 0X0E, 0X01, 0X00, 0X00, 0X02,
-  0X1A, 0X53, 0XA1, 0XE7, 0XFF, 0XFC, 0XC8, 0X6E, 0X25, 0X07, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X03, 0X07, 0X08, 0X06, 0X03, 0X01, 0X00, 0X12, 0X7E,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X06, 0X17, 0X25, 0X26, 0X15, 0X05,
-  0X00, 0X00, 0X00, 0X00, 0X04, 0X3A, 0XA9, 0XFF, 0XFF, 0XCA, 0X57, 0X11,
-  0X01, 0X00, 0X00, 0X02, 0X42, 0XD1, 0XFF, 0XED, 0XBF, 0X7C, 0X27, 0X03,
-  0X00, 0X00, 0X00, 0X10, 0X8D, 0XCA, 0XB4, 0XB2, 0XAF, 0X9D, 0X5C, 0X17,
-  0X01, 0X00, 0X00, 0X00, 0X24, 0X99, 0XCA, 0XD6, 0XD4, 0XCD, 0XBA, 0X8A,
-  0X3E, 0X0C, 0X01, 0X00, 0X00, 0X00, 0X04, 0X21, 0X62, 0XB4, 0XF7, 0XFF,
-  0XFF, 0XD6, 0X77, 0X29, 0X08, 0X01, 0X00, 0X00, 0X00, 0X00, 0X01, 0X06,
-  0X0C, 0X0E, 0X0A, 0X05, 0X02, 0X00, 0X00, 0X12, 0X7D, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X06, 0X17, 0X27, 0X29, 0X17, 0X05, 0X00, 0X00, 0X00,
-  0X02, 0X33, 0XA3, 0XFF, 0XFF, 0XD1, 0X5B, 0X13, 0X01, 0X00, 0X01, 0X35,
-  0XC8, 0XFF, 0XEF, 0XC1, 0X81, 0X29, 0X03, 0X00, 0X00, 0X09, 0X7D, 0XCD,
-  0XB6, 0XB2, 0XAF, 0X9F, 0X5F, 0X17, 0X01, 0X00, 0X00, 0X1D, 0X97, 0XC8,
-  0XD1, 0XCF, 0XC8, 0XB8, 0X8A, 0X3D, 0X0C, 0X01, 0X00, 0X00, 0X04, 0X23,
-  0X67, 0XBA, 0XFC, 0XFF, 0XFF, 0XE0, 0X7F, 0X2D, 0X09, 0X00, 0X00, 0X00,
-  0X00, 0X01, 0X08, 0X10, 0X12, 0X0E, 0X08, 0X03, 0X00, 0X12, 0X7D, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X09, 0X1E, 0X31, 0X31, 0X1B, 0X07, 0X00,
-  0X00, 0X00, 0X03, 0X3A, 0XB2, 0XFF, 0XFF, 0XD4, 0X5B, 0X13, 0X01, 0X00,
-  0X01, 0X39, 0XCA, 0XFF, 0XEA, 0XBF, 0X81, 0X2A, 0X03, 0X00, 0X00, 0X07,
-  0X78, 0XC8, 0XB2, 0XAF, 0XAF, 0X9F, 0X62, 0X19, 0X01, 0X00, 0X00, 0X12,
-  0X86, 0XC6, 0XD1, 0XCF, 0XC8, 0XB8, 0X8D, 0X40, 0X0C, 0X01, 0X00, 0X00,
-  0X02, 0X1C, 0X5C, 0XAF, 0XF4, 0XFF, 0XFF, 0XE5, 0X83, 0X31, 0X0A, 0X00,
-  0X00, 0X00, 0X00, 0X01, 0X07, 0X10, 0X13, 0X0F, 0X09, 0X03, 0X01, 0X12,
-  0X7E, 0X00, 0X00, 0X00, 0X00, 0X00, 0X01, 0X12, 0X31, 0X46, 0X42, 0X24,
-  0X09, 0X01, 0X00, 0X00, 0X00, 0X08, 0X53, 0XD6, 0XFF, 0XFF, 0XCD, 0X53,
-  0X10, 0X01, 0X00, 0X00, 0X03, 0X4C, 0XDB, 0XFF, 0XDB, 0XB8, 0X7F, 0X29,
-  0X03, 0X00, 0X00, 0X00, 0X07, 0X81, 0XC1, 0XAB, 0XAD, 0XAF, 0XA1, 0X65,
-  0X1B, 0X01, 0X00, 0X00, 0X00, 0X06, 0X5E, 0XB8, 0XDB, 0XDB, 0XD1, 0XBF,
-  0X93, 0X47, 0X0F, 0X01, 0X00, 0X00, 0X00, 0X00, 0X0E, 0X40, 0X8F, 0XDD,
-  0XFF, 0XFF, 0XE2, 0X88, 0X33, 0X0B, 0X01, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X03, 0X0A, 0X0E, 0X0C, 0X07, 0X03, 0X01, 0X00, 0X12, 0X7D, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X08, 0X2C, 0X57, 0X6D, 0X5C, 0X2E, 0X0B, 0X00, 0X00,
-  0X00, 0X1E, 0X8C, 0XFF, 0XFF, 0XFF, 0XAF, 0X41, 0X0B, 0X01, 0X00, 0X0C,
-  0X7A, 0XE7, 0XE2, 0XC6, 0XAF, 0X7A, 0X28, 0X03, 0X00, 0X00, 0X08, 0X93,
-  0XB6, 0XA3, 0XAB, 0XAF, 0XA3, 0X6B, 0X1E, 0X02, 0X00, 0X00, 0X01, 0X29,
-  0X91, 0XE0, 0XEF, 0XE5, 0XCF, 0XA3, 0X54, 0X14, 0X02, 0X00, 0X00, 0X00,
-  0X02, 0X1C, 0X59, 0XA9, 0XE5, 0XF2, 0XD4, 0X86, 0X34, 0X0B, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X03, 0X06, 0X06, 0X04, 0X01, 0X00, 0X12, 0X7D,
-  0X00, 0X00, 0X00, 0X00, 0X03, 0X24, 0X61, 0X95, 0XA5, 0X7F, 0X3B, 0X0E,
-  0X00, 0X00, 0X09, 0X58, 0XDB, 0XFF, 0XFF, 0XE5, 0X86, 0X2B, 0X05, 0X00,
-  0X00, 0X2E, 0XAF, 0XD4, 0XC3, 0XB8, 0XA9, 0X75, 0X24, 0X02, 0X00, 0X00,
-  0X05, 0X83, 0XBC, 0XAD, 0XAF, 0XB2, 0XA5, 0X70, 0X21, 0X02, 0X00, 0X00,
-  0X00, 0X06, 0X46, 0XBA, 0XFF, 0XFF, 0XEF, 0XC1, 0X6E, 0X21, 0X04, 0X00,
-  0X00, 0X00, 0X00, 0X03, 0X21, 0X5F, 0X9F, 0XBF, 0XB4, 0X78, 0X32, 0X0A,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X01, 0X01, 0X01, 0X00, 0X00,
-  0X02, 0X7D, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X02, 0X04, 0X03,
-  0X02, 0X01, 0X00, 0X00, 0X00, 0X01, 0X1C, 0X5F, 0XAF, 0XE0, 0XDD, 0X9B,
-  0X45, 0X10, 0X00, 0X02, 0X33, 0XAB, 0XFF, 0XFF, 0XED, 0XB8, 0X65, 0X1A,
-  0X02, 0X00, 0X03, 0X6D, 0XBF, 0XB2, 0XB2, 0XB2, 0XA7, 0X70, 0X21, 0X02,
-  0X00, 0X00, 0X01, 0X3B, 0XB4, 0XCF, 0XC1, 0XBA, 0XAB, 0X78, 0X27, 0X03,
-  0X00, 0X00, 0X00, 0X00, 0X0D, 0X5E, 0XD8, 0XFF, 0XFF, 0XEF, 0X97, 0X38,
-  0X09, 0X01, 0X00, 0X00, 0X00, 0X00, 0X03, 0X20, 0X51, 0X77, 0X7D, 0X5E,
-  0X29, 0X09, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X02, 0X6E, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X05, 0X0D,
-  0X11, 0X0D, 0X07, 0X02, 0X00, 0X00, 0X00, 0X01, 0X16, 0X58, 0XB4, 0XFC,
-  0XFF, 0XFA, 0XA7, 0X47, 0X11, 0X02, 0X00, 0X17, 0X7F, 0XDB, 0XEF, 0XE2,
-  0XCA, 0X9F, 0X4F, 0X10, 0X01, 0X00, 0X00, 0X03, 0X84, 0XBF, 0XA5, 0XAB,
-  0XB2, 0XA5, 0X6E, 0X20, 0X02, 0X00, 0X00, 0X00, 0X00, 0X0A, 0X70, 0XE5,
-  0XEA, 0XCD, 0XB6, 0X83, 0X2E, 0X03, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X18, 0X7A, 0XF2, 0XFF, 0XFF, 0XCA, 0X57, 0X12, 0X01, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X04, 0X1C, 0X3A, 0X48, 0X3F, 0X21, 0X08, 0X01, 0X02,
-  0X6D, 0X00, 0X00, 0X00, 0X00, 0X00, 0X07, 0X15, 0X23, 0X26, 0X1D, 0X0E,
-  0X04, 0X00, 0X00, 0X0C, 0X46, 0XA3, 0XF7, 0XFF, 0XFF, 0XF4, 0X99, 0X41,
-  0X10, 0X01, 0X48, 0XB4, 0XD1, 0XCF, 0XC6, 0XB8, 0X8F, 0X41, 0X0B, 0X00,
-  0X00, 0X01, 0X59, 0XC1, 0XB2, 0XAD, 0XAF, 0XA5, 0X6D, 0X1E, 0X02, 0X00,
-  0X00, 0X00, 0X00, 0X2E, 0XBC, 0XFF, 0XEF, 0XC6, 0X8D, 0X35, 0X05, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X03, 0X34, 0XAB, 0XFF, 0XFF, 0XE7, 0X70, 0X1A,
-  0X03, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X07, 0X1A, 0X29, 0X2B, 0X1A,
-  0X07, 0X02, 0X6E, 0X00, 0X00, 0X00, 0X00, 0X04, 0X15, 0X2C, 0X3D, 0X3C,
-  0X2A, 0X14, 0X05, 0X01, 0X00, 0X02, 0X25, 0X78, 0XD6, 0XFF, 0XFF, 0XFF,
-  0XDB, 0X86, 0X38, 0X0E, 0X02, 0X03, 0X72, 0XBF, 0XBC, 0XBA, 0XBA, 0XAF,
-  0X86, 0X39, 0X08, 0X00, 0X00, 0X00, 0X00, 0X34, 0XBC, 0XC1, 0XAF, 0XAF,
-  0XA3, 0X6D, 0X1E, 0X02, 0X00, 0X00, 0X00, 0X00, 0X00, 0X13, 0X93, 0XFF,
-  0XFF, 0XD4, 0X97, 0X3C, 0X06, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X1A, 0X7D, 0XED, 0XFF, 0XF2, 0X7F, 0X22, 0X03, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X02, 0X0E, 0X1C, 0X21, 0X16, 0X07, 0X01, 0X02, 0X6E,
-  0X00, 0X00, 0X00, 0X01, 0X09, 0X1E, 0X37, 0X46, 0X42, 0X2C, 0X14, 0X05,
-  0X01, 0X00, 0X06, 0X37, 0X8F, 0XE5, 0XFF, 0XFF, 0XFA, 0XCA, 0X7A, 0X32,
-  0X0C, 0X01, 0X05, 0X81, 0XB8, 0XB2, 0XB4, 0XB6, 0XA9, 0X7F, 0X34, 0X07,
-  0X00, 0X00, 0X00, 0X00, 0X30, 0XB8, 0XC1, 0XAF, 0XAD, 0XA3, 0X68, 0X1C,
-  0X02, 0X00, 0X00, 0X00, 0X00, 0X00, 0X10, 0X8C, 0XFF, 0XFF, 0XD6, 0X97,
-  0X3C, 0X06, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X17, 0X77, 0XE5,
-  0XFF, 0XF4, 0X84, 0X25, 0X04, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X01, 0X0C, 0X19, 0X1F, 0X15, 0X07, 0X01, 0X02, 0X6E, 0X00, 0X00, 0X00,
-  0X00, 0X07, 0X18, 0X2E, 0X39, 0X33, 0X21, 0X0D, 0X03, 0X00, 0X00, 0X05,
-  0X33, 0X88, 0XE0, 0XFF, 0XFF, 0XFF, 0XD1, 0X7A, 0X30, 0X0B, 0X01, 0X09,
-  0X81, 0XB4, 0XB4, 0XB4, 0XB4, 0XA9, 0X7D, 0X33, 0X07, 0X00, 0X00, 0X00,
-  0X01, 0X4C, 0XBC, 0XB4, 0XAB, 0XAB, 0X9F, 0X64, 0X1A, 0X01, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X24, 0XB2, 0XFF, 0XFC, 0XCD, 0X8F, 0X37, 0X06, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X01, 0X29, 0X95, 0XFC, 0XFF, 0XF4, 0X83,
-  0X24, 0X04, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X04, 0X11, 0X1E,
-  0X23, 0X17, 0X07, 0X01, 0X02, 0X6D, 0X00, 0X00, 0X00, 0X00, 0X01, 0X0A,
-  0X15, 0X1C, 0X19, 0X0F, 0X06, 0X01, 0X00, 0X01, 0X1A, 0X5E, 0XB6, 0XFC,
-  0XFF, 0XFF, 0XD8, 0X7C, 0X2D, 0X09, 0X0A, 0X6A, 0XB6, 0XC8, 0XC1, 0XBC,
-  0XAD, 0X7F, 0X34, 0X08, 0X00, 0X00, 0X0D, 0X8C, 0XB4, 0XA5, 0XA7, 0XA9,
-  0X9D, 0X5F, 0X18, 0X01, 0X00, 0X00, 0X00, 0X06, 0X5E, 0XE2, 0XFF, 0XE5,
-  0XBF, 0X86, 0X32, 0X05, 0X00, 0X00, 0X00, 0X00, 0X00, 0X0B, 0X53, 0XCA,
-  0XFF, 0XFF, 0XF2, 0X7C, 0X22, 0X04, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X0A, 0X19, 0X26, 0X28, 0X19, 0X08, 0X02, 0X6E, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X01, 0X05, 0X07, 0X07, 0X04, 0X02, 0X00, 0X00, 0X00, 0X00, 0X05,
-  0X29, 0X72, 0XBF, 0XED, 0XF2, 0XC3, 0X6E, 0X25, 0X06, 0X00, 0X05, 0X42,
-  0XA9, 0XE2, 0XE5, 0XD6, 0XBF, 0X8D, 0X3E, 0X0B, 0X00, 0X00, 0X00, 0X3C,
-  0XBC, 0XAD, 0XA3, 0XAB, 0XAD, 0X9B, 0X5F, 0X18, 0X01, 0X00, 0X00, 0X00,
-  0X01, 0X2A, 0XA3, 0XF7, 0XF2, 0XD8, 0XBA, 0X7F, 0X2E, 0X05, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X02, 0X24, 0X81, 0XF2, 0XFF, 0XFF, 0XED, 0X77, 0X20,
-  0X04, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X03, 0X0F, 0X20, 0X2B, 0X29,
-  0X19, 0X08, 0X01, 0X01, 0X6D, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X01, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X0C, 0X35,
-  0X73, 0XA3, 0XAD, 0X91, 0X53, 0X1B, 0X04, 0X00, 0X02, 0X24, 0X81, 0XE0,
-  0XFF, 0XFC, 0XE0, 0XA7, 0X53, 0X13, 0X01, 0X00, 0X02, 0X6E, 0XD1, 0XBC,
-  0XAF, 0XB2, 0XB2, 0X9F, 0X61, 0X1A, 0X01, 0X00, 0X00, 0X00, 0X0E, 0X61,
-  0XCF, 0XFA, 0XEA, 0XD4, 0XB8, 0X7C, 0X2C, 0X05, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X09, 0X3F, 0XA9, 0XFF, 0XFF, 0XFF, 0XE7, 0X70, 0X1E, 0X03, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X06, 0X14, 0X25, 0X30, 0X2B, 0X18, 0X07,
-  0X01, 0X6D, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X01, 0X13, 0X3B, 0X5F, 0X6E,
-  0X62, 0X3B, 0X14, 0X03, 0X00, 0X00, 0X0F, 0X50, 0XBA, 0XFF, 0XFF, 0XFF,
-  0XCF, 0X6D, 0X1E, 0X03, 0X00, 0X06, 0X73, 0XD1, 0XD4, 0XC6, 0XBC, 0XB8,
-  0XA3, 0X64, 0X1C, 0X02, 0X00, 0X00, 0X01, 0X2E, 0X91, 0XE2, 0XF4, 0XE2,
-  0XD1, 0XB4, 0X77, 0X2A, 0X05, 0X00, 0X00, 0X00, 0X00, 0X01, 0X16, 0X5C,
-  0XCF, 0XFF, 0XFF, 0XFF, 0XDD, 0X67, 0X1A, 0X03, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X01, 0X09, 0X1B, 0X2D, 0X35, 0X2F, 0X1A, 0X08, 0X11, 0X6C, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X07, 0X1F, 0X3C, 0X4C, 0X4A, 0X2F, 0X11, 0X00,
-  0X00, 0X05, 0X2E, 0X8C, 0XF4, 0XFF, 0XFF, 0XEA, 0X81, 0X26, 0X05, 0X06,
-  0X57, 0XBC, 0XE5, 0XD8, 0XC8, 0XBC, 0XA5, 0X67, 0X1C, 0X02, 0X00, 0X06,
-  0X54, 0XB8, 0XED, 0XEA, 0XD8, 0XCA, 0XAF, 0X72, 0X28, 0X04, 0X00, 0X00,
-  0X00, 0X04, 0X27, 0X7C, 0XED, 0XFF, 0XFF, 0XFF, 0XD1, 0X5B, 0X17, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X02, 0X10, 0X25, 0X39, 0X40, 0X34, 0X1C, 0X11,
-  0X6D, 0X00, 0X00, 0X00, 0X00, 0X00, 0X03, 0X17, 0X31, 0X41, 0X42, 0X2C,
-  0X11, 0X03, 0X00, 0X00, 0X02, 0X1F, 0X73, 0XE5, 0XFF, 0XFF, 0XF2, 0X8A,
-  0X2A, 0X05, 0X00, 0X04, 0X3E, 0XA3, 0XE5, 0XE2, 0XCF, 0XBC, 0XA7, 0X67,
-  0X1D, 0X02, 0X00, 0X00, 0X0A, 0X77, 0XD1, 0XE7, 0XDB, 0XCF, 0XC3, 0XAB,
-  0X6E, 0X24, 0X04, 0X00, 0X00, 0X00, 0X00, 0X0A, 0X3A, 0X99, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XC1, 0X50, 0X13, 0X02, 0X00, 0X00, 0X00, 0X00, 0X00, 0X06,
-  0X1A, 0X33, 0X48, 0X4D, 0X3C, 0X1E, 0X08, 0X11, 0X6D, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X03, 0X16, 0X32, 0X45, 0X46, 0X30, 0X12, 0X03, 0X00, 0X00,
-  0X01, 0X19, 0X6B, 0XDD, 0XFF, 0XFF, 0XF2, 0X8A, 0X2B, 0X06, 0X00, 0X02,
-  0X2C, 0X8F, 0XE0, 0XE5, 0XCD, 0XBC, 0XA5, 0X65, 0X1C, 0X02, 0X00, 0X00,
-  0X0C, 0X88, 0XDB, 0XDD, 0XCF, 0XC6, 0XBF, 0XA7, 0X68, 0X21, 0X03, 0X00,
-  0X00, 0X00, 0X01, 0X11, 0X4B, 0XB2, 0XFF, 0XFF, 0XFF, 0XFF, 0XAB, 0X44,
-  0X0F, 0X01, 0X00, 0X00, 0X00, 0X00, 0X01, 0X0C, 0X26, 0X46, 0X5C, 0X5F,
-  0X47, 0X23, 0X09, 0X11, 0X6D, 0X00, 0X00, 0X00, 0X00, 0X00, 0X02, 0X16,
-  0X33, 0X47, 0X4A, 0X32, 0X13, 0X03, 0X00, 0X00, 0X00, 0X15, 0X64, 0XD8,
-  0XFF, 0XFF, 0XEF, 0X8A, 0X2B, 0X06, 0X00, 0X01, 0X1E, 0X7F, 0XDB, 0XE2,
-  0XCD, 0XBA, 0XA1, 0X62, 0X1A, 0X01, 0X00, 0X00, 0X0C, 0X95, 0XDB, 0XCA,
-  0XBF, 0XBA, 0XB6, 0XA1, 0X62, 0X1C, 0X02, 0X00, 0X00, 0X00, 0X02, 0X1E,
-  0X68, 0XD4, 0XFF, 0XFF, 0XFF, 0XED, 0X8A, 0X33, 0X09, 0X01, 0X00, 0X00,
-  0X00, 0X00, 0X03, 0X18, 0X3F, 0X65, 0X7D, 0X7A, 0X55, 0X27, 0X0A, 0X11,
-  0X6D, 0X00, 0X00, 0X00, 0X00, 0X00, 0X02, 0X16, 0X35, 0X4B, 0X4D, 0X34,
-  0X14, 0X03, 0X00, 0X00, 0X00, 0X11, 0X5E, 0XD4, 0XFF, 0XFF, 0XED, 0X88,
-  0X2B, 0X06, 0X00, 0X00, 0X11, 0X6B, 0XD4, 0XE2, 0XCA, 0XB8, 0X9F, 0X5E,
-  0X18, 0X01, 0X00, 0X00, 0X0A, 0X99, 0XD4, 0XB8, 0XAF, 0XB4, 0XAF, 0X9B,
-  0X59, 0X17, 0X01, 0X00, 0X00, 0X00, 0X07, 0X33, 0X8C, 0XED, 0XFF, 0XFF,
-  0XFF, 0XC8, 0X6D, 0X23, 0X05, 0X00, 0X00, 0X00, 0X00, 0X00, 0X0B, 0X2D,
-  0X62, 0X8F, 0XA5, 0X97, 0X61, 0X29, 0X09, 0X11, 0X6D, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X03, 0X1B, 0X3F, 0X55, 0X57, 0X3C, 0X17, 0X04, 0X00, 0X00,
-  0X00, 0X12, 0X65, 0XDB, 0XFF, 0XFF, 0XE5, 0X83, 0X29, 0X06, 0X00, 0X00,
-  0X0D, 0X67, 0XCF, 0XDB, 0XC3, 0XB4, 0X9B, 0X5B, 0X16, 0X01, 0X00, 0X00,
-  0X07, 0X8D, 0XC6, 0XAB, 0XA9, 0XAD, 0XAB, 0X95, 0X55, 0X14, 0X01, 0X00,
-  0X00, 0X00, 0X0A, 0X40, 0X9F, 0XEF, 0XFF, 0XFF, 0XEA, 0XB6, 0X5F, 0X1C,
-  0X04, 0X00, 0X00, 0X00, 0X00, 0X01, 0X12, 0X3D, 0X78, 0XA5, 0XB4, 0X9D,
-  0X62, 0X27, 0X08, 0X11, 0X6E, 0X00, 0X00, 0X00, 0X00, 0X00, 0X07, 0X29,
-  0X51, 0X6A, 0X68, 0X44, 0X1A, 0X05, 0X00, 0X00, 0X00, 0X00, 0X1C, 0X7C,
-  0XED, 0XFF, 0XFF, 0XDB, 0X7A, 0X25, 0X05, 0X00, 0X00, 0X00, 0X10, 0X72,
-  0XCD, 0XCD, 0XBA, 0XAF, 0X99, 0X58, 0X15, 0X01, 0X00, 0X00, 0X00, 0X05,
-  0X7C, 0XBA, 0XA9, 0XA7, 0XAB, 0XAB, 0X95, 0X53, 0X14, 0X01, 0X00, 0X00,
-  0X00, 0X00, 0X07, 0X39, 0X97, 0XE7, 0XFF, 0XFF, 0XE7, 0XB6, 0X5F, 0X1B,
-  0X03, 0X00, 0X00, 0X00, 0X00, 0X00, 0X01, 0X11, 0X3B, 0X75, 0X9F, 0XAD,
-  0X95, 0X5B, 0X23, 0X07, 0X00, 0X11, 0X6D, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X0F, 0X3A, 0X67, 0X7F, 0X78, 0X4D, 0X1D, 0X05, 0X00, 0X00, 0X03, 0X30,
-  0X9D, 0XFC, 0XFF, 0XFF, 0XCA, 0X6D, 0X21, 0X04, 0X00, 0X00, 0X1C, 0X88,
-  0XC8, 0XBF, 0XB2, 0XAB, 0X99, 0X57, 0X14, 0X01, 0X00, 0X00, 0X04, 0X6D,
-  0XB2, 0XA9, 0XA7, 0XAB, 0XAB, 0X95, 0X53, 0X14, 0X01, 0X00, 0X00, 0X00,
-  0X03, 0X2A, 0X84, 0XE2, 0XFF, 0XFF, 0XEF, 0XBA, 0X64, 0X1D, 0X04, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X0C, 0X31, 0X65, 0X8F, 0X9D, 0X88, 0X53, 0X1F,
-  0X06, 0X11, 0X6D, 0X00, 0X00, 0X00, 0X00, 0X02, 0X1A, 0X4C, 0X7C, 0X91,
-  0X83, 0X51, 0X1E, 0X05, 0X00, 0X00, 0X08, 0X48, 0XB8, 0XFF, 0XFF, 0XF7,
-  0XBF, 0X64, 0X1C, 0X03, 0X00, 0X01, 0X2E, 0X9B, 0XBF, 0XB4, 0XAD, 0XAB,
-  0X95, 0X51, 0X13, 0X01, 0X00, 0X00, 0X03, 0X5F, 0XAD, 0XAF, 0XAB, 0XAD,
-  0XA9, 0X95, 0X53, 0X13, 0X01, 0X00, 0X00, 0X00, 0X01, 0X1E, 0X73, 0XD6,
-  0XFF, 0XFF, 0XF7, 0XC3, 0X6B, 0X20, 0X05, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X07, 0X25, 0X55, 0X7C, 0X8A, 0X77, 0X47, 0X1A, 0X05, 0X11, 0X6D, 0X00,
-  0X00, 0X00, 0X00, 0X04, 0X22, 0X58, 0X86, 0X99, 0X88, 0X51, 0X1D, 0X05,
-  0X00, 0X00, 0X10, 0X5E, 0XC8, 0XFF, 0XFF, 0XED, 0XB6, 0X5E, 0X1A, 0X03,
-  0X00, 0X02, 0X41, 0XA5, 0XB8, 0XAD, 0XAD, 0XA9, 0X93, 0X4F, 0X12, 0X01,
-  0X00, 0X00, 0X03, 0X55, 0XAB, 0XB6, 0XAF, 0XAF, 0XAB, 0X95, 0X51, 0X13,
-  0X01, 0X00, 0X00, 0X00, 0X00, 0X17, 0X65, 0XCF, 0XFF, 0XFF, 0XFF, 0XCD,
-  0X72, 0X24, 0X06, 0X00, 0X00, 0X00, 0X00, 0X00, 0X04, 0X1E, 0X48, 0X6B,
-  0X78, 0X6A, 0X3F, 0X17, 0X04, 0X11, 0X6C, 0X00, 0X00, 0X00, 0X00, 0X06,
-  0X25, 0X5B, 0X88, 0X97, 0X84, 0X4F, 0X1C, 0X00, 0X00, 0X14, 0X67, 0XCF,
-  0XFF, 0XFF, 0XEF, 0XB6, 0X5C, 0X19, 0X03, 0X03, 0X4D, 0XA7, 0XB4, 0XAF,
-  0XAD, 0XA9, 0X93, 0X4F, 0X12, 0X01, 0X00, 0X03, 0X50, 0XA9, 0XBA, 0XB4,
-  0XB2, 0XAD, 0X95, 0X53, 0X13, 0X01, 0X00, 0X00, 0X00, 0X13, 0X5C, 0XC8,
-  0XFF, 0XFF, 0XFF, 0XD4, 0X77, 0X26, 0X06, 0X00, 0X00, 0X00, 0X00, 0X03,
-  0X1A, 0X41, 0X61, 0X6D, 0X5F, 0X3A, 0X15, 0X12, 0X6C, 0X00, 0X00, 0X00,
-  0X06, 0X24, 0X58, 0X83, 0X93, 0X83, 0X4D, 0X1B, 0X00, 0X16, 0X68, 0XD1,
-  0XFF, 0XFF, 0XF2, 0XB8, 0X5E, 0X1A, 0X03, 0X54, 0XAB, 0XB6, 0XAD, 0XAF,
-  0XA9, 0X93, 0X4F, 0X12, 0X01, 0X00, 0X4D, 0XAB, 0XBF, 0XB6, 0XB2, 0XAD,
-  0X95, 0X53, 0X14, 0X01, 0X00, 0X00, 0X11, 0X59, 0XC6, 0XFF, 0XFF, 0XFF,
-  0XDD, 0X7C, 0X29, 0X07, 0X00, 0X00, 0X00, 0X03, 0X19, 0X3D, 0X59, 0X64,
-  0X59, 0X37, 0X14, 0X11, 0X6D, 0X00, 0X00, 0X00, 0X00, 0X05, 0X23, 0X57,
-  0X83, 0X95, 0X83, 0X4F, 0X1C, 0X05, 0X00, 0X00, 0X17, 0X68, 0XCF, 0XFF,
-  0XFF, 0XF2, 0XB8, 0X5C, 0X18, 0X03, 0X00, 0X04, 0X57, 0XAD, 0XB6, 0XAF,
-  0XAF, 0XAB, 0X93, 0X50, 0X12, 0X01, 0X00, 0X00, 0X04, 0X51, 0XAD, 0XBF,
-  0XB6, 0XB4, 0XAD, 0X97, 0X53, 0X14, 0X01, 0X00, 0X00, 0X00, 0X00, 0X11,
-  0X59, 0XC6, 0XFF, 0XFF, 0XFF, 0XDD, 0X7F, 0X2A, 0X07, 0X01, 0X00, 0X00,
-  0X00, 0X00, 0X03, 0X18, 0X3B, 0X57, 0X61, 0X55, 0X34, 0X14, 0X04, 0X11,
-  0X6D, 0X00, 0X00, 0X00, 0X00, 0X04, 0X1E, 0X4D, 0X78, 0X8C, 0X7C, 0X4B,
-  0X1B, 0X04, 0X00, 0X00, 0X12, 0X5E, 0XC8, 0XFF, 0XFF, 0XF4, 0XBC, 0X62,
-  0X1B, 0X03, 0X00, 0X03, 0X51, 0XAB, 0XBA, 0XB2, 0XAF, 0XAB, 0X93, 0X51,
-  0X12, 0X01, 0X00, 0X00, 0X04, 0X55, 0XAF, 0XBF, 0XB6, 0XB4, 0XAD, 0X95,
-  0X53, 0X14, 0X01, 0X00, 0X00, 0X00, 0X00, 0X13, 0X5F, 0XCA, 0XFF, 0XFF,
-  0XFF, 0XDB, 0X7C, 0X29, 0X07, 0X00, 0X00, 0X00, 0X00, 0X00, 0X03, 0X1A,
-  0X3F, 0X5C, 0X67, 0X58, 0X35, 0X14, 0X04, 0X11, 0X6D, 0X00, 0X00, 0X00,
-  0X00, 0X02, 0X16, 0X40, 0X6A, 0X7D, 0X72, 0X46, 0X1A, 0X04, 0X00, 0X00,
-  0X0D, 0X4F, 0XBA, 0XFF, 0XFF, 0XFF, 0XC6, 0X67, 0X1E, 0X04, 0X00, 0X03,
-  0X46, 0XA9, 0XC3, 0XB8, 0XB4, 0XAD, 0X95, 0X50, 0X12, 0X01, 0X00, 0X00,
-  0X07, 0X6B, 0XB4, 0XB8, 0XB2, 0XB2, 0XAD, 0X95, 0X51, 0X13, 0X01, 0X00,
-  0X00, 0X00, 0X01, 0X1D, 0X72, 0XDB, 0XFF, 0XFF, 0XFF, 0XD4, 0X77, 0X27,
-  0X06, 0X00, 0X00, 0X00, 0X00, 0X00, 0X06, 0X22, 0X48, 0X65, 0X6D, 0X5C,
-  0X37, 0X14, 0X03, 0X11, 0X6D, 0X00, 0X00, 0X00, 0X00, 0X01, 0X0F, 0X34,
-  0X5C, 0X72, 0X6B, 0X45, 0X1A, 0X05, 0X00, 0X00, 0X07, 0X3E, 0XA7, 0XFF,
-  0XFF, 0XFF, 0XCF, 0X6E, 0X21, 0X04, 0X00, 0X02, 0X38, 0XA1, 0XCA, 0XBF,
-  0XB8, 0XAF, 0X95, 0X53, 0X13, 0X01, 0X00, 0X00, 0X09, 0X7A, 0XB8, 0XB4,
-  0XAF, 0XAF, 0XAD, 0X95, 0X51, 0X13, 0X01, 0X00, 0X00, 0X00, 0X02, 0X26,
-  0X7F, 0XE2, 0XFF, 0XFF, 0XFF, 0XCF, 0X73, 0X24, 0X06, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X09, 0X29, 0X53, 0X6E, 0X75, 0X61, 0X38, 0X14, 0X03, 0X11,
-  0X6B, 0X00, 0X00, 0X00, 0X00, 0X00, 0X0C, 0X30, 0X58, 0X6E, 0X6A, 0X44,
-  0X00, 0X00, 0X05, 0X35, 0X9D, 0XFC, 0XFF, 0XFF, 0XD4, 0X70, 0X21, 0X01,
-  0X30, 0X9B, 0XCD, 0XC3, 0XB8, 0XB2, 0X97, 0X53, 0X13, 0X01, 0X0C, 0X88,
-  0XBA, 0XB2, 0XAD, 0XB2, 0XAD, 0X93, 0X50, 0X13, 0X01, 0X00, 0X04, 0X2E,
-  0X88, 0XE7, 0XFF, 0XFF, 0XFF, 0XCD, 0X70, 0X24, 0X00, 0X00, 0X00, 0X00,
-  0X0C, 0X2D, 0X57, 0X72, 0X77, 0X61, 0X38, 0X11, 0X6C, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X0B, 0X2F, 0X58, 0X6E, 0X6B, 0X46, 0X1B, 0X00, 0X00, 0X03,
-  0X31, 0X97, 0XFC, 0XFF, 0XFF, 0XD4, 0X72, 0X22, 0X04, 0X01, 0X29, 0X97,
-  0XCF, 0XC6, 0XBA, 0XB2, 0X97, 0X54, 0X14, 0X01, 0X00, 0X0A, 0X86, 0XBC,
-  0XB4, 0XAD, 0XB2, 0XAD, 0X95, 0X53, 0X14, 0X01, 0X00, 0X00, 0X04, 0X2D,
-  0X88, 0XE7, 0XFF, 0XFF, 0XFF, 0XCF, 0X73, 0X26, 0X06, 0X00, 0X00, 0X00,
-  0X00, 0X0B, 0X2B, 0X55, 0X70, 0X75, 0X61, 0X38, 0X14, 0X12, 0X6B, 0X00,
-  0X00, 0X00, 0X00, 0X0B, 0X2F, 0X57, 0X6E, 0X6B, 0X46, 0X00, 0X03, 0X30,
-  0X95, 0XFC, 0XFF, 0XFF, 0XD4, 0X72, 0X22, 0X28, 0X95, 0XD1, 0XC6, 0XB8,
-  0XAF, 0X97, 0X54, 0X14, 0X01, 0X84, 0XBC, 0XB4, 0XAD, 0XAF, 0XAD, 0X95,
-  0X53, 0X14, 0X01, 0X04, 0X2D, 0X88, 0XE5, 0XFF, 0XFF, 0XFF, 0XCF, 0X73,
-  0X26, 0X00, 0X00, 0X00, 0X0B, 0X2B, 0X55, 0X72, 0X75, 0X61, 0X39, 0X11,
-  0X6D, 0X00, 0X00, 0X00, 0X00, 0X00, 0X0A, 0X2B, 0X53, 0X6B, 0X6A, 0X44,
-  0X1A, 0X05, 0X00, 0X00, 0X03, 0X2C, 0X91, 0XFA, 0XFF, 0XFF, 0XD8, 0X75,
-  0X24, 0X05, 0X00, 0X00, 0X24, 0X91, 0XD1, 0XC8, 0XBC, 0XB2, 0X97, 0X55,
-  0X14, 0X01, 0X00, 0X00, 0X09, 0X86, 0XBC, 0XB2, 0XAD, 0XAF, 0XAD, 0X95,
-  0X53, 0X14, 0X01, 0X00, 0X00, 0X00, 0X04, 0X30, 0X8C, 0XEA, 0XFF, 0XFF,
-  0XFF, 0XCD, 0X70, 0X24, 0X06, 0X00, 0X00, 0X00, 0X00, 0X00, 0X0C, 0X30,
-  0X5C, 0X78, 0X7C, 0X65, 0X3A, 0X15, 0X04, 0X12, 0X6C, 0X00, 0X00, 0X00,
-  0X00, 0X09, 0X29, 0X4F, 0X67, 0X65, 0X42, 0X1A, 0X00, 0X02, 0X29, 0X8D,
-  0XF7, 0XFF, 0XFF, 0XDD, 0X78, 0X25, 0X05, 0X21, 0X8D, 0XD4, 0XCA, 0XBC,
-  0XB4, 0X99, 0X55, 0X14, 0X01, 0X00, 0X88, 0XBC, 0XAF, 0XAB, 0XAF, 0XAD,
-  0X95, 0X51, 0X13, 0X01, 0X00, 0X05, 0X33, 0X91, 0XEA, 0XFF, 0XFF, 0XFC,
-  0XC8, 0X6D, 0X22, 0X05, 0X00, 0X00, 0X01, 0X0E, 0X33, 0X61, 0X7F, 0X83,
-  0X6B, 0X3D, 0X15, 0X12, 0X6D, 0X00, 0X00, 0X00, 0X00, 0X07, 0X24, 0X4A,
-  0X5F, 0X5F, 0X40, 0X19, 0X04, 0X00, 0X01, 0X25, 0X86, 0XF2, 0XFF, 0XFF,
-  0XE0, 0X7C, 0X27, 0X06, 0X00, 0X1E, 0X88, 0XD4, 0XCD, 0XBF, 0XB4, 0X99,
-  0X57, 0X15, 0X01, 0X00, 0X00, 0X8A, 0XBC, 0XAD, 0XA9, 0XAF, 0XAD, 0X95,
-  0X51, 0X13, 0X01, 0X00, 0X00, 0X06, 0X37, 0X97, 0XEF, 0XFF, 0XFF, 0XF7,
-  0XC1, 0X6A, 0X21, 0X05, 0X00, 0X00, 0X00, 0X01, 0X10, 0X39, 0X6A, 0X88,
-  0X8A, 0X70, 0X40, 0X16, 0X04, 0X11, 0X6C, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X05, 0X1F, 0X41, 0X57, 0X58, 0X3B, 0X17, 0X00, 0X00, 0X01, 0X20, 0X7C,
-  0XEA, 0XFF, 0XFF, 0XE7, 0X81, 0X2A, 0X06, 0X00, 0X1A, 0X83, 0XD4, 0XD1,
-  0XC1, 0XB4, 0X99, 0X57, 0X14, 0X01, 0X00, 0X0A, 0X8F, 0XBC, 0XA9, 0XA7,
-  0XAD, 0XAB, 0X93, 0X4F, 0X12, 0X01, 0X00, 0X00, 0X08, 0X3F, 0XA3, 0XF2,
-  0XFF, 0XFF, 0XED, 0XB8, 0X61, 0X1D, 0X04, 0X00, 0X00, 0X00, 0X02, 0X15,
-  0X42, 0X77, 0X93, 0X95, 0X78, 0X42, 0X17, 0X11, 0X6C, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X03, 0X19, 0X38, 0X4C, 0X4F, 0X35, 0X15, 0X00, 0X00, 0X01,
-  0X1A, 0X70, 0XE0, 0XFF, 0XFF, 0XED, 0X88, 0X2D, 0X07, 0X00, 0X15, 0X7A,
-  0XD4, 0XD8, 0XC6, 0XB6, 0X9B, 0X58, 0X15, 0X01, 0X00, 0X0C, 0X93, 0XBA,
-  0XA7, 0XA7, 0XAD, 0XA9, 0X91, 0X4D, 0X12, 0X01, 0X00, 0X00, 0X0C, 0X4B,
-  0XAD, 0XF4, 0XFF, 0XFC, 0XE5, 0XAF, 0X5B, 0X1A, 0X04, 0X00, 0X00, 0X00,
-  0X03, 0X1B, 0X4D, 0X84, 0XA1, 0XA1, 0X7F, 0X45, 0X17, 0X11, 0X6D, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X02, 0X14, 0X2F, 0X42, 0X45, 0X31, 0X13, 0X03,
-  0X00, 0X00, 0X00, 0X15, 0X64, 0XD6, 0XFF, 0XFF, 0XF2, 0X8D, 0X30, 0X07,
-  0X00, 0X00, 0X12, 0X72, 0XD4, 0XDD, 0XCA, 0XB8, 0X9B, 0X57, 0X15, 0X01,
-  0X00, 0X00, 0X0E, 0X9B, 0XB8, 0XA5, 0XA7, 0XAD, 0XA9, 0X91, 0X4B, 0X10,
-  0X01, 0X00, 0X00, 0X00, 0X12, 0X59, 0XBA, 0XF7, 0XFF, 0XF7, 0XDD, 0XA7,
-  0X53, 0X17, 0X03, 0X00, 0X00, 0X00, 0X00, 0X05, 0X23, 0X5B, 0X93, 0XAD,
-  0XA9, 0X83, 0X46, 0X17, 0X04, 0X11, 0X6C, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X01, 0X0F, 0X25, 0X38, 0X3C, 0X2B, 0X11, 0X00, 0X00, 0X00, 0X11, 0X58,
-  0XCA, 0XFF, 0XFF, 0XF4, 0X93, 0X33, 0X08, 0X00, 0X0F, 0X6A, 0XD4, 0XE5,
-  0XCF, 0XBA, 0X9D, 0X58, 0X14, 0X01, 0X00, 0X12, 0XA1, 0XBA, 0XA5, 0XA5,
-  0XAB, 0XA9, 0X8F, 0X4A, 0X10, 0X01, 0X00, 0X01, 0X1A, 0X6A, 0XC6, 0XF4,
-  0XFC, 0XEF, 0XD8, 0XA1, 0X4D, 0X14, 0X03, 0X00, 0X00, 0X00, 0X09, 0X2C,
-  0X68, 0X9F, 0XB8, 0XAF, 0X86, 0X46, 0X17, 0X11, 0X7D, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X01, 0X0C, 0X1F, 0X31, 0X35, 0X27, 0X10, 0X03, 0X00, 0X00,
-  0X00, 0X0D, 0X4F, 0XBC, 0XFF, 0XFF, 0XFA, 0X97, 0X34, 0X09, 0X01, 0X00,
-  0X0D, 0X64, 0XD1, 0XEA, 0XD4, 0XBC, 0X9D, 0X57, 0X14, 0X01, 0X00, 0X00,
-  0X14, 0XA3, 0XB8, 0XA5, 0XA5, 0XAB, 0XA9, 0X8D, 0X47, 0X0F, 0X01, 0X00,
-  0X00, 0X02, 0X22, 0X77, 0XCD, 0XF2, 0XF7, 0XEA, 0XD1, 0X9B, 0X48, 0X13,
-  0X02, 0X00, 0X00, 0X00, 0X00, 0X0C, 0X34, 0X72, 0XA9, 0XBF, 0XB6, 0X88,
-  0X46, 0X17, 0X04, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X01,
-  0X00, 0X00, 0X00, 0X00, 0X11, 0X7C, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X0A, 0X1C, 0X2C, 0X31, 0X24, 0X0F, 0X00, 0X00, 0X00, 0X0C, 0X4C, 0XB6,
-  0XFF, 0XFF, 0XFA, 0X99, 0X37, 0X09, 0X00, 0X0C, 0X62, 0XD1, 0XED, 0XD8,
-  0XBF, 0X9D, 0X57, 0X14, 0X01, 0X00, 0X19, 0XA5, 0XB6, 0XA3, 0XA5, 0XAB,
-  0XA7, 0X8C, 0X45, 0X0E, 0X01, 0X00, 0X03, 0X2A, 0X81, 0XD4, 0XF4, 0XF4,
-  0XE7, 0XCF, 0X97, 0X46, 0X11, 0X02, 0X00, 0X00, 0X01, 0X10, 0X3B, 0X7A,
-  0XAD, 0XC1, 0XB6, 0X86, 0X44, 0X15, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X01, 0X01, 0X00, 0X00, 0X00, 0X11, 0X6D, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X09, 0X1B, 0X2A, 0X30, 0X24, 0X0F, 0X03, 0X00, 0X00, 0X00,
-  0X0C, 0X4C, 0XB8, 0XFF, 0XFF, 0XFA, 0X9B, 0X38, 0X0A, 0X01, 0X00, 0X0E,
-  0X65, 0XD1, 0XED, 0XD6, 0XBF, 0X9D, 0X57, 0X14, 0X01, 0X00, 0X00, 0X1C,
-  0XA7, 0XB6, 0XA3, 0XA5, 0XAB, 0XA7, 0X8A, 0X44, 0X0E, 0X01, 0X00, 0X00,
-  0X03, 0X2D, 0X84, 0XD4, 0XF2, 0XF2, 0XE7, 0XCD, 0X95, 0X45, 0X11, 0X02,
-  0X00, 0X00, 0X00, 0X01, 0X11, 0X3D, 0X7C, 0XAD, 0XBF, 0XB2, 0X83, 0X41,
-  0X15, 0X03, 0X11, 0X7C, 0X00, 0X00, 0X00, 0X00, 0X00, 0X01, 0X0B, 0X1D,
-  0X2D, 0X32, 0X24, 0X0F, 0X00, 0X00, 0X00, 0X10, 0X54, 0XC1, 0XFF, 0XFF,
-  0XFA, 0X99, 0X37, 0X0A, 0X00, 0X12, 0X6E, 0XD6, 0XE7, 0XD4, 0XBC, 0X9B,
-  0X55, 0X14, 0X01, 0X00, 0X21, 0XA9, 0XB4, 0XA3, 0XA5, 0XAB, 0XA7, 0X8A,
-  0X44, 0X0E, 0X01, 0X00, 0X03, 0X2A, 0X81, 0XD1, 0XF4, 0XF4, 0XEA, 0XCF,
-  0X97, 0X46, 0X12, 0X02, 0X00, 0X00, 0X01, 0X0F, 0X3A, 0X77, 0XA5, 0XB6,
-  0XAB, 0X7C, 0X3E, 0X13, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X11, 0X6C, 0X00, 0X00, 0X00, 0X00, 0X00, 0X01,
-  0X0E, 0X23, 0X33, 0X37, 0X28, 0X10, 0X00, 0X00, 0X00, 0X17, 0X62, 0XCF,
-  0XFF, 0XFF, 0XFA, 0X97, 0X37, 0X0A, 0X00, 0X19, 0X7C, 0XD8, 0XE2, 0XCF,
-  0XB8, 0X99, 0X54, 0X14, 0X01, 0X00, 0X24, 0XAD, 0XB2, 0XA1, 0XA5, 0XAB,
-  0XA7, 0X8A, 0X44, 0X0E, 0X01, 0X00, 0X02, 0X22, 0X75, 0XCA, 0XF4, 0XFC,
-  0XF2, 0XD6, 0X9B, 0X4A, 0X14, 0X03, 0X00, 0X00, 0X00, 0X0B, 0X30, 0X68,
-  0X95, 0XA7, 0X9D, 0X72, 0X39, 0X12, 0X11, 0X6C, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X03, 0X14, 0X2A, 0X3C, 0X3E, 0X2C, 0X12, 0X00, 0X00, 0X02, 0X21,
-  0X77, 0XE2, 0XFF, 0XFF, 0XF7, 0X95, 0X35, 0X0A, 0X01, 0X26, 0X8F, 0XD8,
-  0XD8, 0XC8, 0XB6, 0X97, 0X53, 0X14, 0X01, 0X00, 0X25, 0XAB, 0XB2, 0XA5,
-  0XA7, 0XAB, 0XA7, 0X8A, 0X44, 0X0E, 0X01, 0X00, 0X01, 0X17, 0X64, 0XC1,
-  0XF7, 0XFF, 0XFA, 0XE0, 0XA5, 0X50, 0X16, 0X03, 0X00, 0X00, 0X00, 0X07,
-  0X25, 0X57, 0X83, 0X95, 0X8C, 0X68, 0X34, 0X11, 0X11, 0X6D, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X06, 0X1A, 0X33, 0X44, 0X45, 0X30, 0X14, 0X04, 0X00,
-  0X00, 0X04, 0X2D, 0X8A, 0XF2, 0XFF, 0XFF, 0XF7, 0X91, 0X34, 0X0A, 0X01,
-  0X03, 0X34, 0X9D, 0XD6, 0XD1, 0XC3, 0XB6, 0X97, 0X53, 0X14, 0X01, 0X00,
-  0X00, 0X21, 0XA3, 0XB4, 0XA9, 0XAB, 0XAD, 0XA7, 0X8C, 0X46, 0X0F, 0X01,
-  0X00, 0X00, 0X00, 0X0E, 0X50, 0XB2, 0XF7, 0XFF, 0XFF, 0XED, 0XAF, 0X58,
-  0X1A, 0X04, 0X00, 0X00, 0X00, 0X00, 0X03, 0X1A, 0X45, 0X6E, 0X81, 0X7C,
-  0X5C, 0X30, 0X10, 0X03, 0X11, 0X6D, 0X00, 0X00, 0X00, 0X00, 0X00, 0X09,
-  0X22, 0X3E, 0X50, 0X4F, 0X37, 0X17, 0X04, 0X00, 0X00, 0X08, 0X3C, 0X9F,
-  0XFC, 0XFF, 0XFF, 0XF2, 0X8F, 0X33, 0X0A, 0X01, 0X04, 0X45, 0XA9, 0XD1,
-  0XCA, 0XBF, 0XB4, 0X95, 0X53, 0X14, 0X01, 0X00, 0X00, 0X18, 0X95, 0XB8,
-  0XAF, 0XAD, 0XAF, 0XA9, 0X8D, 0X4A, 0X10, 0X01, 0X00, 0X00, 0X00, 0X07,
-  0X39, 0X9B, 0XF2, 0XFF, 0XFF, 0XFC, 0XC1, 0X64, 0X1E, 0X05, 0X00, 0X00,
-  0X00, 0X00, 0X01, 0X10, 0X33, 0X58, 0X6B, 0X6A, 0X50, 0X2B, 0X0E, 0X02,
-  0X11, 0X6D, 0X00, 0X00, 0X00, 0X00, 0X01, 0X0D, 0X2A, 0X48, 0X5B, 0X58,
-  0X3C, 0X19, 0X05, 0X00, 0X00, 0X0E, 0X4A, 0XAF, 0XFF, 0XFF, 0XFF, 0XEF,
-  0X8C, 0X33, 0X0A, 0X01, 0X07, 0X55, 0XB4, 0XCA, 0XC3, 0XBC, 0XB2, 0X97,
-  0X54, 0X15, 0X01, 0X00, 0X00, 0X10, 0X7F, 0XBA, 0XB8, 0XB2, 0XB2, 0XAB,
-  0X91, 0X4C, 0X11, 0X01, 0X00, 0X00, 0X00, 0X02, 0X26, 0X81, 0XE5, 0XFF,
-  0XFF, 0XFF, 0XCF, 0X6E, 0X23, 0X06, 0X00, 0X00, 0X00, 0X00, 0X00, 0X09,
-  0X24, 0X45, 0X58, 0X59, 0X47, 0X27, 0X0E, 0X02, 0X11, 0X6D, 0X00, 0X00,
-  0X00, 0X00, 0X01, 0X11, 0X31, 0X51, 0X65, 0X62, 0X42, 0X1D, 0X06, 0X00,
-  0X00, 0X12, 0X54, 0XBC, 0XFF, 0XFF, 0XFF, 0XED, 0X8C, 0X33, 0X0A, 0X01,
-  0X08, 0X61, 0XB6, 0XC8, 0XBF, 0XBA, 0XB2, 0X99, 0X57, 0X17, 0X02, 0X00,
-  0X00, 0X09, 0X6A, 0XB8, 0XC1, 0XB8, 0XB6, 0XAF, 0X93, 0X50, 0X13, 0X01,
-  0X00, 0X00, 0X00, 0X01, 0X19, 0X6A, 0XD6, 0XFF, 0XFF, 0XFF, 0XDD, 0X7A,
-  0X28, 0X07, 0X01, 0X00, 0X00, 0X00, 0X00, 0X05, 0X1B, 0X38, 0X4A, 0X4D,
-  0X3F, 0X24, 0X0C, 0X02, 0X11, 0X6D, 0X00, 0X00, 0X00, 0X00, 0X02, 0X13,
-  0X37, 0X59, 0X6E, 0X6A, 0X4A, 0X21, 0X07, 0X00, 0X01, 0X15, 0X5C, 0XC3,
-  0XFF, 0XFF, 0XFF, 0XED, 0X8C, 0X35, 0X0B, 0X01, 0X07, 0X67, 0XB8, 0XC3,
-  0XBC, 0XBA, 0XB4, 0X99, 0X59, 0X18, 0X02, 0X00, 0X00, 0X04, 0X53, 0XB4,
-  0XC8, 0XBC, 0XB8, 0XB2, 0X97, 0X55, 0X15, 0X01, 0X00, 0X00, 0X00, 0X00,
-  0X0F, 0X55, 0XC3, 0XFF, 0XFF, 0XFF, 0XE7, 0X83, 0X2D, 0X08, 0X01, 0X00,
-  0X00, 0X00, 0X00, 0X02, 0X14, 0X2D, 0X40, 0X45, 0X3A, 0X22, 0X0C, 0X02,
-  0X11, 0X6E, 0X00, 0X00, 0X00, 0X00, 0X02, 0X13, 0X35, 0X5B, 0X70, 0X6E,
-  0X4F, 0X24, 0X09, 0X01, 0X00, 0X00, 0X13, 0X58, 0XBF, 0XFF, 0XFF, 0XFF,
-  0XF2, 0X93, 0X3B, 0X0D, 0X01, 0X00, 0X04, 0X5C, 0XB6, 0XC3, 0XBC, 0XBA,
-  0XB6, 0X9D, 0X5E, 0X1C, 0X03, 0X00, 0X00, 0X00, 0X02, 0X40, 0XAB, 0XCA,
-  0XBF, 0XBA, 0XB4, 0X99, 0X59, 0X17, 0X01, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X0A, 0X4B, 0XBA, 0XFF, 0XFF, 0XFF, 0XED, 0X88, 0X2F, 0X08, 0X01, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X01, 0X12, 0X2B, 0X40, 0X46, 0X3C, 0X24, 0X0D,
-  0X02, 0X00, 0X11, 0X6D, 0X00, 0X00, 0X00, 0X00, 0X01, 0X0F, 0X2F, 0X54,
-  0X6B, 0X6D, 0X51, 0X28, 0X0A, 0X00, 0X00, 0X0E, 0X4C, 0XAF, 0XFF, 0XFF,
-  0XFF, 0XFA, 0XA1, 0X44, 0X10, 0X02, 0X01, 0X4B, 0XAF, 0XC6, 0XBF, 0XBC,
-  0XB6, 0XA1, 0X65, 0X20, 0X03, 0X00, 0X00, 0X01, 0X38, 0XA7, 0XCA, 0XBC,
-  0XBA, 0XB4, 0X9B, 0X5E, 0X1A, 0X02, 0X00, 0X00, 0X00, 0X00, 0X09, 0X4A,
-  0XBA, 0XFF, 0XFF, 0XFF, 0XEA, 0X88, 0X30, 0X08, 0X01, 0X00, 0X00, 0X00,
-  0X00, 0X01, 0X14, 0X32, 0X48, 0X4F, 0X42, 0X28, 0X0F, 0X03, 0X11, 0X6D,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X09, 0X24, 0X48, 0X62, 0X6A, 0X53, 0X2B,
-  0X0C, 0X00, 0X00, 0X06, 0X38, 0X97, 0XF7, 0XFF, 0XFF, 0XFF, 0XB4, 0X50,
-  0X15, 0X03, 0X00, 0X2C, 0X9D, 0XCA, 0XC6, 0XC1, 0XBA, 0XA5, 0X6B, 0X24,
-  0X05, 0X00, 0X00, 0X00, 0X31, 0XA5, 0XC3, 0XB8, 0XB6, 0XB4, 0X9D, 0X61,
-  0X1C, 0X02, 0X00, 0X00, 0X00, 0X00, 0X0A, 0X50, 0XC3, 0XFF, 0XFF, 0XFF,
-  0XE0, 0X83, 0X2E, 0X08, 0X01, 0X00, 0X00, 0X00, 0X00, 0X03, 0X1A, 0X40,
-  0X5B, 0X61, 0X53, 0X31, 0X12, 0X03, 0X12, 0X6E, 0X00, 0X00, 0X00, 0X00,
-  0X03, 0X16, 0X35, 0X51, 0X5E, 0X50, 0X2D, 0X0E, 0X02, 0X00, 0X01, 0X1E,
-  0X70, 0XDD, 0XFF, 0XFF, 0XFF, 0XCD, 0X61, 0X1D, 0X04, 0X00, 0X12, 0X7A,
-  0XCA, 0XD1, 0XCA, 0XBF, 0XAB, 0X75, 0X2A, 0X06, 0X00, 0X00, 0X00, 0X2C,
-  0XA9, 0XB8, 0XAD, 0XB2, 0XB4, 0X9F, 0X64, 0X1D, 0X02, 0X00, 0X00, 0X00,
-  0X00, 0X10, 0X65, 0XD6, 0XFF, 0XFF, 0XFC, 0XCD, 0X77, 0X28, 0X07, 0X01,
-  0X00, 0X00, 0X00, 0X00, 0X07, 0X2A, 0X5E, 0X7D, 0X83, 0X6B, 0X3E, 0X17,
-  0X04, 0X00, 0X12, 0X6D, 0X00, 0X00, 0X00, 0X00, 0X00, 0X09, 0X21, 0X3C,
-  0X4C, 0X47, 0X2D, 0X10, 0X00, 0X00, 0X09, 0X42, 0XAB, 0XFF, 0XFF, 0XFF,
-  0XE7, 0X78, 0X28, 0X07, 0X03, 0X44, 0XB6, 0XE0, 0XD8, 0XCA, 0XB4, 0X7F,
-  0X33, 0X08, 0X00, 0X00, 0X21, 0XAB, 0XAD, 0XA5, 0XAF, 0XB2, 0X9F, 0X68,
-  0X1F, 0X03, 0X00, 0X00, 0X00, 0X1B, 0X83, 0XE5, 0XFF, 0XF7, 0XE2, 0XB6,
-  0X67, 0X20, 0X05, 0X00, 0X00, 0X00, 0X00, 0X12, 0X48, 0X8C, 0XB2, 0XAF,
-  0X8F, 0X51, 0X1D, 0X05, 0X12, 0X7E, 0X00, 0X00, 0X00, 0X00, 0X00, 0X01,
-  0X0E, 0X24, 0X38, 0X3B, 0X2A, 0X11, 0X03, 0X00, 0X00, 0X01, 0X1B, 0X6D,
-  0XDD, 0XFF, 0XFF, 0XFA, 0X93, 0X35, 0X0A, 0X01, 0X00, 0X17, 0X84, 0XE5,
-  0XF2, 0XDB, 0XBF, 0X8C, 0X3B, 0X0A, 0X00, 0X00, 0X00, 0X13, 0X9F, 0XAB,
-  0XA3, 0XAB, 0XAF, 0XA1, 0X6A, 0X21, 0X03, 0X00, 0X00, 0X00, 0X01, 0X34,
-  0XA5, 0XE2, 0XE7, 0XDB, 0XC8, 0X9F, 0X54, 0X18, 0X03, 0X00, 0X00, 0X00,
-  0X00, 0X05, 0X2E, 0X7C, 0XC8, 0XED, 0XE5, 0XB6, 0X65, 0X24, 0X07, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X01, 0X03, 0X03, 0X02, 0X01, 0X00, 0X00,
-  0X00, 0X12, 0X7E, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X03, 0X0F, 0X1F,
-  0X29, 0X22, 0X10, 0X03, 0X00, 0X00, 0X00, 0X03, 0X2F, 0X8F, 0XF4, 0XFF,
-  0XFF, 0XB2, 0X46, 0X0F, 0X01, 0X00, 0X02, 0X3D, 0XBF, 0XFF, 0XFC, 0XD6,
-  0X9F, 0X47, 0X0E, 0X00, 0X00, 0X00, 0X05, 0X72, 0XB6, 0XAB, 0XAD, 0XB2,
-  0XA3, 0X6D, 0X22, 0X03, 0X00, 0X00, 0X00, 0X05, 0X61, 0XBA, 0XCA, 0XC6,
-  0XC3, 0XB6, 0X8D, 0X45, 0X10, 0X01, 0X00, 0X00, 0X00, 0X01, 0X1A, 0X65,
-  0XC1, 0XFF, 0XFF, 0XFF, 0XDB, 0X78, 0X2B, 0X08, 0X01, 0X00, 0X00, 0X00,
-  0X00, 0X02, 0X0B, 0X11, 0X10, 0X09, 0X04, 0X01, 0X00, 0X00, 0X12, 0X7E,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X03, 0X0C, 0X15, 0X17, 0X0D,
-  0X03, 0X00, 0X00, 0X00, 0X00, 0X0A, 0X44, 0XA5, 0XFA, 0XFF, 0XC3, 0X58,
-  0X15, 0X02, 0X00, 0X00, 0X0D, 0X72, 0XF7, 0XFF, 0XFC, 0XBC, 0X59, 0X13,
-  0X01, 0X00, 0X00, 0X00, 0X33, 0XB2, 0XC8, 0XB6, 0XB4, 0XA7, 0X70, 0X24,
-  0X03, 0X00, 0X00, 0X00, 0X0A, 0X8C, 0XB2, 0XAD, 0XB2, 0XB8, 0XAB, 0X83,
-  0X3A, 0X0B, 0X01, 0X00, 0X00, 0X00, 0X0A, 0X4C, 0XAD, 0XF7, 0XFF, 0XFF,
-  0XFF, 0XE7, 0X83, 0X2F, 0X0A, 0X01, 0X00, 0X00, 0X00, 0X03, 0X12, 0X29,
-  0X35, 0X2D, 0X1C, 0X0C, 0X03, 0X00, 0X00, 0X12, 0X7E, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X02, 0X07, 0X0C, 0X09, 0X02, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X12, 0X54, 0XAD, 0XE5, 0XC3, 0X64, 0X1A, 0X02, 0X00,
-  0X00, 0X00, 0X24, 0XAB, 0XFF, 0XFF, 0XED, 0X7A, 0X1D, 0X02, 0X00, 0X00,
-  0X00, 0X0A, 0X7A, 0XE5, 0XD8, 0XBF, 0XAB, 0X78, 0X29, 0X04, 0X00, 0X00,
-  0X00, 0X07, 0X88, 0XAF, 0XA3, 0XAB, 0XAF, 0XA7, 0X7C, 0X33, 0X08, 0X00,
-  0X00, 0X00, 0X01, 0X2F, 0X8D, 0XD8, 0XF7, 0XFF, 0XFF, 0XFF, 0XD1, 0X7C,
-  0X30, 0X0B, 0X01, 0X00, 0X00, 0X02, 0X15, 0X3D, 0X64, 0X73, 0X61, 0X3E,
-  0X1C, 0X08, 0X01, 0X00, 0X12, 0X7E, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X01, 0X05, 0X05, 0X02, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X01, 0X1C, 0X61, 0XA7, 0XAD, 0X68, 0X1E, 0X03, 0X00, 0X00, 0X00, 0X04,
-  0X4C, 0XE2, 0XFF, 0XFF, 0XAB, 0X30, 0X04, 0X00, 0X00, 0X00, 0X00, 0X33,
-  0XCA, 0XFF, 0XDB, 0XB8, 0X81, 0X2C, 0X04, 0X00, 0X00, 0X00, 0X02, 0X59,
-  0XBC, 0XAD, 0XAB, 0XB2, 0XA5, 0X77, 0X2D, 0X06, 0X00, 0X00, 0X00, 0X07,
-  0X6E, 0XB4, 0XCF, 0XDB, 0XE0, 0XE2, 0XD6, 0XAB, 0X68, 0X2B, 0X0B, 0X01,
-  0X00, 0X02, 0X17, 0X46, 0X7F, 0XAD, 0XBA, 0X9F, 0X6A, 0X32, 0X0E, 0X02,
-  0X00, 0X12, 0X8E, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X01, 0X03, 0X01, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X05, 0X2C,
-  0X6E, 0X8F, 0X65, 0X21, 0X03, 0X00, 0X00, 0X00, 0X00, 0X16, 0X8D, 0XFF,
-  0XFF, 0XDD, 0X48, 0X08, 0X00, 0X00, 0X00, 0X00, 0X0A, 0X81, 0XFF, 0XFF,
-  0XCF, 0X8C, 0X32, 0X05, 0X00, 0X00, 0X00, 0X00, 0X27, 0XB6, 0XCA, 0XB2,
-  0XB2, 0XA5, 0X77, 0X2B, 0X05, 0X00, 0X00, 0X00, 0X0C, 0X97, 0XB8, 0XB8,
-  0XC3, 0XCD, 0XC8, 0XB6, 0X8C, 0X51, 0X24, 0X0A, 0X01, 0X00, 0X0E, 0X3F,
-  0X7F, 0XBC, 0XE7, 0XF4, 0XD4, 0X91, 0X47, 0X15, 0X04, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X02, 0X04, 0X04, 0X01, 0X00, 0X00, 0X00, 0X00, 0X00, 0X12,
-  0X8E, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X01, 0X01, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X10, 0X41, 0X6E,
-  0X5C, 0X24, 0X04, 0X00, 0X00, 0X00, 0X00, 0X03, 0X46, 0XDB, 0XFF, 0XFC,
-  0X6A, 0X0F, 0X00, 0X00, 0X00, 0X00, 0X01, 0X3E, 0XEA, 0XFF, 0XF2, 0X9B,
-  0X39, 0X06, 0X00, 0X00, 0X00, 0X00, 0X0A, 0X8C, 0XE7, 0XC6, 0XB6, 0XA7,
-  0X77, 0X2A, 0X05, 0X00, 0X00, 0X00, 0X09, 0X95, 0XBA, 0XAB, 0XB6, 0XBF,
-  0XBA, 0XA5, 0X75, 0X3F, 0X1D, 0X09, 0X01, 0X02, 0X2A, 0X6D, 0XAF, 0XE5,
-  0XFF, 0XFF, 0XFC, 0XB6, 0X5B, 0X1D, 0X05, 0X00, 0X00, 0X00, 0X00, 0X03,
-  0X0A, 0X0E, 0X0C, 0X05, 0X01, 0X00, 0X00, 0X00, 0X00, 0X12, 0X8D, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X05, 0X27, 0X55, 0X54, 0X24, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X1F, 0XA1, 0XFF, 0XFF, 0X88, 0X17, 0X00, 0X00,
-  0X00, 0X00, 0X17, 0XB4, 0XFF, 0XFF, 0XB4, 0X40, 0X07, 0X00, 0X00, 0X00,
-  0X02, 0X58, 0XEF, 0XE2, 0XBC, 0XAB, 0X77, 0X29, 0X05, 0X00, 0X00, 0X04,
-  0X77, 0XC6, 0XAD, 0XB4, 0XB8, 0XB4, 0X9B, 0X65, 0X33, 0X17, 0X08, 0X06,
-  0X50, 0X91, 0XCA, 0XF7, 0XFF, 0XFF, 0XFF, 0XCF, 0X67, 0X21, 0X06, 0X00,
-  0X00, 0X03, 0X0B, 0X15, 0X1C, 0X17, 0X0A, 0X02, 0X00, 0X00, 0X00, 0X12,
-  0X8E, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X02, 0X1C, 0X48,
-  0X50, 0X25, 0X05, 0X00, 0X00, 0X00, 0X00, 0X00, 0X11, 0X7F, 0XFF, 0XFF,
-  0X97, 0X1E, 0X01, 0X00, 0X00, 0X00, 0X00, 0X0A, 0X91, 0XFF, 0XFF, 0XC1,
-  0X45, 0X08, 0X00, 0X00, 0X00, 0X00, 0X00, 0X39, 0XE7, 0XF7, 0XC6, 0XAD,
-  0X78, 0X29, 0X04, 0X00, 0X00, 0X00, 0X01, 0X59, 0XCD, 0XB4, 0XB2, 0XB8,
-  0XB4, 0X95, 0X5F, 0X30, 0X15, 0X07, 0X01, 0X09, 0X6D, 0XA7, 0XD4, 0XFA,
-  0XFF, 0XFF, 0XFF, 0XD1, 0X68, 0X21, 0X06, 0X00, 0X00, 0X01, 0X07, 0X13,
-  0X20, 0X24, 0X1D, 0X0D, 0X02, 0X00, 0X00, 0X00, 0X00, 0X22, 0X8E, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X01, 0X19, 0X45, 0X50, 0X28, 0X06,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X0F, 0X7A, 0XFF, 0XFF, 0XA1, 0X23, 0X01,
-  0X00, 0X00, 0X00, 0X00, 0X08, 0X8C, 0XFF, 0XFF, 0XC6, 0X47, 0X09, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X32, 0XE5, 0XFC, 0XC8, 0XAD, 0X78, 0X2A, 0X05,
-  0X00, 0X00, 0X00, 0X01, 0X53, 0XCF, 0XB8, 0XB4, 0XBA, 0XB4, 0X99, 0X67,
-  0X37, 0X18, 0X08, 0X01, 0X08, 0X6D, 0XA5, 0XD1, 0XFA, 0XFF, 0XFF, 0XFF,
-  0XC3, 0X5E, 0X1C, 0X05, 0X00, 0X00, 0X01, 0X06, 0X10, 0X1B, 0X1F, 0X17,
-  0X09, 0X01, 0X00, 0X00, 0X00, 0X00, 0X22, 0X8E, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X02, 0X1E, 0X4B, 0X54, 0X2B, 0X07, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X15, 0X8C, 0XFF, 0XFF, 0XA1, 0X24, 0X02, 0X00, 0X00, 0X00,
-  0X00, 0X0C, 0XA1, 0XFF, 0XFF, 0XC1, 0X46, 0X09, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X3C, 0XED, 0XF4, 0XC6, 0XAF, 0X7A, 0X2B, 0X05, 0X00, 0X00, 0X00,
-  0X01, 0X5B, 0XD4, 0XB8, 0XB8, 0XBF, 0XBC, 0XA5, 0X75, 0X41, 0X1C, 0X08,
-  0X01, 0X05, 0X59, 0X97, 0XCA, 0XF7, 0XFF, 0XFF, 0XF7, 0XA7, 0X4B, 0X14,
-  0X03, 0X00, 0X00, 0X00, 0X03, 0X0A, 0X11, 0X13, 0X0D, 0X04, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X22, 0X8E, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X07, 0X2E, 0X5B, 0X5E, 0X32, 0X09, 0X00, 0X00, 0X00, 0X00, 0X01, 0X30,
-  0XC1, 0XFF, 0XFF, 0X99, 0X24, 0X02, 0X00, 0X00, 0X00, 0X00, 0X23, 0XD6,
-  0XFF, 0XFF, 0XB2, 0X42, 0X0A, 0X00, 0X00, 0X00, 0X00, 0X02, 0X65, 0XFA,
-  0XE0, 0XBF, 0XAF, 0X7C, 0X2F, 0X06, 0X00, 0X00, 0X00, 0X02, 0X78, 0XD8,
-  0XBF, 0XC6, 0XCF, 0XD1, 0XC3, 0X99, 0X59, 0X23, 0X08, 0X01, 0X02, 0X32,
-  0X6B, 0XA3, 0XD4, 0XEF, 0XEA, 0XB8, 0X6E, 0X2D, 0X0B, 0X01, 0X00, 0X00,
-  0X00, 0X00, 0X02, 0X04, 0X05, 0X02, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X12, 0X8E, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X01, 0X01, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X01, 0X13, 0X45,
-  0X70, 0X6A, 0X38, 0X0A, 0X00, 0X00, 0X00, 0X00, 0X07, 0X5F, 0XF7, 0XFF,
-  0XFF, 0X8D, 0X21, 0X03, 0X00, 0X00, 0X00, 0X02, 0X55, 0XFF, 0XFF, 0XF7,
-  0XA3, 0X40, 0X0B, 0X00, 0X00, 0X00, 0X00, 0X0C, 0X9D, 0XF2, 0XCD, 0XC1,
-  0XB2, 0X83, 0X35, 0X08, 0X00, 0X00, 0X00, 0X02, 0X84, 0XDB, 0XD4, 0XE5,
-  0XF4, 0XFA, 0XF7, 0XC8, 0X6E, 0X26, 0X07, 0X00, 0X00, 0X0C, 0X2F, 0X5E,
-  0X88, 0XA1, 0X97, 0X6D, 0X39, 0X14, 0X04, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X22, 0X7E,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X06, 0X29, 0X62, 0X84, 0X75, 0X3D,
-  0X0C, 0X00, 0X00, 0X00, 0X00, 0X26, 0XB2, 0XFF, 0XFF, 0XFF, 0X81, 0X21,
-  0X03, 0X00, 0X00, 0X00, 0X15, 0XAF, 0XFF, 0XFF, 0XE5, 0X9B, 0X42, 0X0D,
-  0X00, 0X00, 0X00, 0X00, 0X39, 0XDB, 0XD8, 0XC8, 0XC8, 0XBA, 0X8D, 0X45,
-  0X10, 0X01, 0X00, 0X00, 0X01, 0X54, 0XB2, 0XE7, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XDD, 0X6D, 0X21, 0X05, 0X00, 0X00, 0X00, 0X06, 0X18, 0X2F, 0X3D, 0X37,
-  0X22, 0X0E, 0X04, 0X01, 0X00, 0X00, 0X22, 0X7E, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X01, 0X10, 0X3C, 0X75, 0X91, 0X7C, 0X41, 0X0E, 0X00, 0X00, 0X00,
-  0X09, 0X5C, 0XEF, 0XFF, 0XFF, 0XFC, 0X81, 0X24, 0X04, 0X00, 0X00, 0X02,
-  0X53, 0XF7, 0XFF, 0XFF, 0XDD, 0XA1, 0X4B, 0X11, 0X01, 0X00, 0X00, 0X01,
-  0X77, 0XFF, 0XE5, 0XE0, 0XE5, 0XDB, 0XB6, 0X6E, 0X26, 0X07, 0X00, 0X00,
-  0X00, 0X0E, 0X46, 0X91, 0XDB, 0XFF, 0XFF, 0XF2, 0XA5, 0X51, 0X18, 0X04,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X03, 0X07, 0X06, 0X03, 0X01, 0X00, 0X00,
-  0X00, 0X00, 0X13, 0X7F, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X01, 0X02, 0X01, 0X00, 0X00, 0X00, 0X00, 0X00, 0X03, 0X1C, 0X51,
-  0X8C, 0XA1, 0X84, 0X45, 0X10, 0X01, 0X00, 0X00, 0X1F, 0X95, 0XFF, 0XFF,
-  0XFF, 0XF7, 0X7A, 0X25, 0X05, 0X00, 0X00, 0X18, 0XAB, 0XFF, 0XFF, 0XFC,
-  0XE0, 0XA9, 0X57, 0X17, 0X01, 0X00, 0X00, 0X00, 0X65, 0XF7, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XB6, 0X4C, 0X10, 0X01, 0X00, 0X00, 0X00, 0X0A, 0X2D,
-  0X62, 0X8C, 0X97, 0X83, 0X58, 0X2C, 0X0F, 0X02, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X12,
-  0X6E, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X02,
-  0X03, 0X01, 0X00, 0X00, 0X00, 0X00, 0X00, 0X07, 0X29, 0X68, 0XA3, 0XAF,
-  0X8C, 0X48, 0X11, 0X00, 0X00, 0X04, 0X39, 0XC1, 0XFF, 0XFF, 0XFF, 0XED,
-  0X75, 0X24, 0X05, 0X00, 0X00, 0X44, 0XFF, 0XFF, 0XFF, 0XFF, 0XEA, 0XB4,
-  0X64, 0X1E, 0X03, 0X00, 0X00, 0X00, 0X2E, 0X95, 0XF4, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XED, 0X6D, 0X18, 0X02, 0X00, 0X00, 0X00, 0X00, 0X06, 0X17, 0X2D,
-  0X38, 0X33, 0X25, 0X15, 0X08, 0X01, 0X00, 0X13, 0X6E, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X01, 0X03, 0X04, 0X02, 0X00, 0X00, 0X00,
-  0X01, 0X11, 0X40, 0X8A, 0XC3, 0XC3, 0X93, 0X4A, 0X10, 0X00, 0X0C, 0X59,
-  0XEA, 0XFF, 0XFF, 0XFF, 0XDD, 0X67, 0X21, 0X04, 0X00, 0X65, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFC, 0XC6, 0X73, 0X27, 0X04, 0X00, 0X00, 0X0D, 0X42, 0X9D,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XF2, 0X77, 0X1D, 0X02, 0X00, 0X00, 0X00, 0X00,
-  0X02, 0X09, 0X0E, 0X10, 0X0D, 0X09, 0X04, 0X01, 0X00, 0X13, 0X6D, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X03, 0X06, 0X05, 0X00, 0X00,
-  0X00, 0X03, 0X20, 0X5E, 0XAD, 0XE0, 0XD4, 0X97, 0X47, 0X01, 0X1E, 0X8A,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XCA, 0X5C, 0X1D, 0X04, 0X72, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XE0, 0X84, 0X2F, 0X05, 0X00, 0X03, 0X1A, 0X57, 0XB2, 0XFC,
-  0XFF, 0XFF, 0XE0, 0X73, 0X1F, 0X03, 0X00, 0X00, 0X00, 0X00, 0X01, 0X03,
-  0X04, 0X04, 0X03, 0X02, 0X00, 0X13, 0X6E, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X01, 0X06, 0X09, 0X07, 0X03, 0X00, 0X00, 0X00, 0X0A, 0X35,
-  0X83, 0XD6, 0XFC, 0XE2, 0X99, 0X44, 0X0E, 0X04, 0X39, 0XBA, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XB6, 0X51, 0X19, 0X03, 0X00, 0X64, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XF2, 0X93, 0X34, 0X06, 0X00, 0X00, 0X00, 0X09, 0X31, 0X7A, 0XC6,
-  0XF4, 0XFC, 0XC8, 0X6D, 0X1F, 0X03, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X01, 0X02, 0X02, 0X01, 0X00, 0X00, 0X13, 0X6F, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X04, 0X0A, 0X0D, 0X09, 0X03, 0X00, 0X00, 0X00,
-  0X01, 0X16, 0X53, 0XAB, 0XFA, 0XFF, 0XEA, 0X93, 0X3E, 0X0C, 0X00, 0X0E,
-  0X62, 0XE7, 0XFF, 0XFF, 0XFF, 0XFF, 0XA1, 0X47, 0X14, 0X02, 0X00, 0X00,
-  0X58, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFC, 0X9B, 0X35, 0X06, 0X00, 0X00,
-  0X00, 0X00, 0X03, 0X1D, 0X5B, 0XA3, 0XD4, 0XE2, 0XB8, 0X65, 0X1E, 0X03,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X01, 0X01, 0X01,
-  0X00, 0X00, 0X00, 0X13, 0X5E, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X01,
-  0X07, 0X0E, 0X10, 0X0B, 0X03, 0X00, 0X00, 0X03, 0X21, 0X6A, 0XCA, 0XFF,
-  0XFF, 0XEA, 0X8D, 0X38, 0X0A, 0X17, 0X84, 0XFC, 0XFF, 0XFF, 0XFF, 0XF4,
-  0X93, 0X40, 0X11, 0X01, 0X00, 0X4A, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFA,
-  0X97, 0X32, 0X05, 0X00, 0X00, 0X00, 0X01, 0X16, 0X51, 0X9B, 0XCF, 0XDD,
-  0XB6, 0X64, 0X1D, 0X03, 0X00, 0X13, 0X5E, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X03, 0X0A, 0X12, 0X12, 0X0B, 0X03, 0X00, 0X00, 0X06, 0X2F, 0X81,
-  0XE5, 0XFF, 0XFF, 0XE7, 0X83, 0X30, 0X07, 0X23, 0XA3, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XE7, 0X86, 0X38, 0X0D, 0X01, 0X00, 0X4C, 0XFC, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XF2, 0X8A, 0X29, 0X03, 0X00, 0X00, 0X00, 0X01, 0X16, 0X53, 0X9F,
-  0XD6, 0XE2, 0XB4, 0X61, 0X1B, 0X03, 0X00, 0X13, 0X6E, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X04, 0X0C, 0X13, 0X13, 0X0B, 0X03, 0X00, 0X00, 0X09,
-  0X39, 0X91, 0XF2, 0XFF, 0XFF, 0XDD, 0X78, 0X28, 0X05, 0X2F, 0XB8, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XDD, 0X7A, 0X31, 0X0A, 0X00, 0X00, 0X50, 0XFA, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XE2, 0X78, 0X21, 0X02, 0X00, 0X00, 0X00, 0X01, 0X18,
-  0X5B, 0XAD, 0XE5, 0XEA, 0XB8, 0X5F, 0X1A, 0X03, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X01, 0X02, 0X02, 0X01, 0X00, 0X00, 0X12, 0X6E, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X04, 0X0C, 0X13, 0X11, 0X09, 0X02,
-  0X00, 0X00, 0X00, 0X0C, 0X3E, 0X95, 0XF2, 0XFF, 0XFF, 0XD1, 0X6B, 0X1F,
-  0X03, 0X01, 0X38, 0XBC, 0XFF, 0XFF, 0XFF, 0XFF, 0XD1, 0X70, 0X29, 0X07,
-  0X00, 0X00, 0X01, 0X6B, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XC6, 0X61, 0X17,
-  0X01, 0X00, 0X00, 0X00, 0X00, 0X03, 0X25, 0X75, 0XCF, 0XFF, 0XFF, 0XBC,
-  0X5B, 0X17, 0X02, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X01, 0X03,
-  0X04, 0X04, 0X02, 0X01, 0X00, 0X12, 0X6E, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X03, 0X0A, 0X0F, 0X0E, 0X07, 0X01, 0X00, 0X00, 0X00, 0X0A,
-  0X3A, 0X8D, 0XE7, 0XFF, 0XFF, 0XBF, 0X5C, 0X18, 0X02, 0X01, 0X37, 0XAF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XCA, 0X67, 0X22, 0X05, 0X00, 0X00, 0X05, 0X9F,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XEF, 0XA7, 0X4C, 0X0F, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X09, 0X41, 0XA7, 0XFF, 0XFF, 0XFF, 0XC3, 0X55, 0X15, 0X02, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X01, 0X05, 0X08, 0X08, 0X07, 0X03, 0X01,
-  0X00, 0X12, 0X6E, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X02, 0X07,
-  0X0C, 0X0B, 0X05, 0X01, 0X00, 0X00, 0X00, 0X08, 0X31, 0X7D, 0XD1, 0XFF,
-  0XFC, 0XAF, 0X51, 0X14, 0X01, 0X02, 0X2E, 0X9B, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XCA, 0X62, 0X1E, 0X04, 0X00, 0X00, 0X10, 0XE2, 0XFF, 0XFF, 0XFF, 0XFC,
-  0XD6, 0X93, 0X3D, 0X0A, 0X00, 0X00, 0X00, 0X00, 0X01, 0X1C, 0X70, 0XE7,
-  0XFF, 0XFF, 0XFF, 0XC1, 0X4D, 0X12, 0X02, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X01, 0X07, 0X0E, 0X11, 0X0F, 0X0B, 0X05, 0X01, 0X00, 0X12, 0X6D, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X01, 0X05, 0X09, 0X09, 0X04, 0X00,
-  0X00, 0X00, 0X06, 0X29, 0X72, 0XC3, 0XF7, 0XED, 0XA3, 0X4A, 0X10, 0X02,
-  0X25, 0X8C, 0XFF, 0XFF, 0XFF, 0XFF, 0XC8, 0X5C, 0X1A, 0X03, 0X00, 0X29,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XEA, 0XC6, 0X84, 0X33, 0X08, 0X00, 0X00, 0X00,
-  0X07, 0X3C, 0XAB, 0XFF, 0XFF, 0XFF, 0XFF, 0XB6, 0X45, 0X0F, 0X01, 0X00,
-  0X00, 0X00, 0X00, 0X04, 0X11, 0X1A, 0X1C, 0X16, 0X0E, 0X05, 0X01, 0X22,
-  0X6D, 0X00, 0X00, 0X00, 0X05, 0X29, 0X72, 0XC1, 0XF4, 0XE7, 0X9B, 0X42,
-  0X0E, 0X01, 0X22, 0X88, 0XFF, 0XFF, 0XFF, 0XFF, 0XBC, 0X55, 0X16, 0X02,
-  0X00, 0X47, 0XFF, 0XFF, 0XFF, 0XF7, 0XE0, 0XBC, 0X7A, 0X2C, 0X06, 0X00,
-  0X00, 0X00, 0X13, 0X5C, 0XD4, 0XFF, 0XFF, 0XFF, 0XFF, 0XAB, 0X3F, 0X0E,
-  0X01, 0X00, 0X00, 0X00, 0X01, 0X0A, 0X19, 0X22, 0X21, 0X19, 0X0E, 0X05,
-  0X01, 0X12, 0X6D, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X02, 0X07,
-  0X0B, 0X0A, 0X04, 0X00, 0X00, 0X00, 0X08, 0X31, 0X7D, 0XCF, 0XFC, 0XE5,
-  0X95, 0X3F, 0X0D, 0X02, 0X29, 0X95, 0XFF, 0XFF, 0XFF, 0XFF, 0XB2, 0X4D,
-  0X13, 0X01, 0X00, 0X5C, 0XFF, 0XFF, 0XFF, 0XED, 0XDB, 0XB8, 0X75, 0X2A,
-  0X05, 0X00, 0X00, 0X01, 0X17, 0X64, 0XDB, 0XFF, 0XFF, 0XFF, 0XFF, 0XA9,
-  0X3E, 0X0D, 0X01, 0X00, 0X00, 0X00, 0X01, 0X0C, 0X19, 0X21, 0X20, 0X18,
-  0X0D, 0X05, 0X01, 0X12, 0X6E, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X03, 0X09, 0X0D, 0X0B, 0X04, 0X00, 0X00, 0X00, 0X00, 0X0B, 0X3A, 0X8C,
-  0XDD, 0XFF, 0XE5, 0X8D, 0X3A, 0X0A, 0X00, 0X03, 0X2F, 0X9F, 0XFF, 0XFF,
-  0XFF, 0XFC, 0XA3, 0X45, 0X10, 0X01, 0X00, 0X00, 0X6D, 0XFF, 0XFF, 0XFA,
-  0XE7, 0XD8, 0XB6, 0X70, 0X27, 0X05, 0X00, 0X00, 0X00, 0X01, 0X1C, 0X6E,
-  0XE5, 0XFF, 0XFF, 0XFF, 0XFF, 0XA3, 0X3C, 0X0D, 0X01, 0X00, 0X00, 0X00,
-  0X00, 0X02, 0X0D, 0X1A, 0X21, 0X1E, 0X15, 0X0C, 0X04, 0X01, 0X00, 0X11,
-  0X6D, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X01, 0X06, 0X0D, 0X10,
-  0X0C, 0X04, 0X00, 0X00, 0X00, 0X01, 0X16, 0X54, 0XAD, 0XFA, 0XFF, 0XE5,
-  0X88, 0X33, 0X09, 0X00, 0X09, 0X4C, 0XC8, 0XFF, 0XFF, 0XFF, 0XED, 0X93,
-  0X3E, 0X0E, 0X01, 0X00, 0X01, 0X86, 0XFF, 0XFF, 0XFC, 0XEA, 0XDB, 0XB6,
-  0X72, 0X27, 0X05, 0X00, 0X00, 0X00, 0X01, 0X17, 0X61, 0XD1, 0XFF, 0XFF,
-  0XFF, 0XFF, 0X9D, 0X3B, 0X0C, 0X01, 0X00, 0X00, 0X00, 0X00, 0X01, 0X08,
-  0X10, 0X15, 0X13, 0X0F, 0X08, 0X03, 0X00, 0X11, 0X6D, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X02, 0X09, 0X10, 0X12, 0X0D, 0X04, 0X00, 0X00,
-  0X00, 0X03, 0X22, 0X6B, 0XC8, 0XFF, 0XFF, 0XE2, 0X83, 0X2F, 0X08, 0X00,
-  0X13, 0X68, 0XE2, 0XFF, 0XFF, 0XFF, 0XE0, 0X8A, 0X39, 0X0C, 0X01, 0X00,
-  0X02, 0X81, 0XFF, 0XFF, 0XFF, 0XF2, 0XE0, 0XB8, 0X73, 0X28, 0X05, 0X00,
-  0X00, 0X00, 0X00, 0X10, 0X4F, 0XB8, 0XFF, 0XFF, 0XFF, 0XFA, 0X99, 0X3A,
-  0X0D, 0X01, 0X00, 0X00, 0X00, 0X00, 0X00, 0X04, 0X0A, 0X0E, 0X0D, 0X0A,
-  0X06, 0X02, 0X00, 0X11, 0X6D, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X04, 0X0C, 0X13, 0X13, 0X0C, 0X04, 0X00, 0X00, 0X00, 0X09, 0X33, 0X83,
-  0XDD, 0XFF, 0XFF, 0XDD, 0X7A, 0X2A, 0X07, 0X01, 0X27, 0X8C, 0XF4, 0XFF,
-  0XFF, 0XFF, 0XD4, 0X83, 0X34, 0X0B, 0X01, 0X00, 0X04, 0X88, 0XFF, 0XFF,
-  0XFF, 0XF7, 0XE5, 0XBC, 0X77, 0X29, 0X06, 0X00, 0X00, 0X00, 0X00, 0X0C,
-  0X44, 0XA1, 0XF7, 0XFF, 0XFF, 0XEF, 0X8F, 0X39, 0X0C, 0X01, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X02, 0X06, 0X08, 0X08, 0X07, 0X04, 0X02, 0X00, 0X11,
-  0X6D, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X01, 0X06, 0X0E, 0X15, 0X14,
-  0X0C, 0X04, 0X00, 0X00, 0X01, 0X11, 0X45, 0X9D, 0XF2, 0XFF, 0XFF, 0XDB,
-  0X73, 0X27, 0X06, 0X03, 0X44, 0XB4, 0XFF, 0XFF, 0XFF, 0XFC, 0XCA, 0X7D,
-  0X33, 0X0B, 0X01, 0X00, 0X05, 0X75, 0XF4, 0XFF, 0XFF, 0XFF, 0XF4, 0XC6,
-  0X7C, 0X2D, 0X07, 0X00, 0X00, 0X00, 0X00, 0X06, 0X31, 0X83, 0XD4, 0XFF,
-  0XFF, 0XDB, 0X88, 0X35, 0X0C, 0X01, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X02, 0X04, 0X04, 0X04, 0X03, 0X01, 0X00, 0X11, 0X6D, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X02, 0X08, 0X10, 0X16, 0X14, 0X0C, 0X03, 0X00, 0X00,
-  0X02, 0X1A, 0X55, 0XAF, 0XFC, 0XFF, 0XFF, 0XD6, 0X70, 0X25, 0X06, 0X06,
-  0X67, 0XD6, 0XFF, 0XFF, 0XFF, 0XFA, 0XC6, 0X7A, 0X32, 0X0B, 0X01, 0X00,
-  0X05, 0X62, 0XDD, 0XFF, 0XFF, 0XFF, 0XFF, 0XD4, 0X84, 0X32, 0X08, 0X00,
-  0X00, 0X00, 0X00, 0X03, 0X23, 0X6A, 0XB4, 0XE2, 0XED, 0XCA, 0X7F, 0X34,
-  0X0C, 0X01, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X01, 0X02, 0X02,
-  0X02, 0X01, 0X00, 0X11, 0X6D, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X02,
-  0X08, 0X10, 0X15, 0X13, 0X0B, 0X03, 0X00, 0X00, 0X04, 0X1E, 0X5E, 0XB8,
-  0XFF, 0XFF, 0XFF, 0XD4, 0X6E, 0X24, 0X05, 0X0A, 0X7F, 0XE7, 0XFF, 0XFF,
-  0XFF, 0XF7, 0XC3, 0X7A, 0X33, 0X0C, 0X01, 0X00, 0X05, 0X54, 0XCF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XE0, 0X8C, 0X34, 0X09, 0X00, 0X00, 0X00, 0X00, 0X01,
-  0X1A, 0X58, 0X9D, 0XCD, 0XDB, 0XBF, 0X7C, 0X33, 0X0C, 0X01, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X01, 0X01, 0X02, 0X02, 0X01, 0X00, 0X11,
-  0X6C, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X02, 0X07, 0X0E, 0X13, 0X11,
-  0X0A, 0X00, 0X00, 0X05, 0X21, 0X61, 0XB6, 0XFF, 0XFF, 0XFF, 0XCF, 0X6A,
-  0X22, 0X11, 0X8D, 0XED, 0XFF, 0XFF, 0XFF, 0XF7, 0XC3, 0X7A, 0X33, 0X0C,
-  0X01, 0X07, 0X57, 0XCF, 0XFF, 0XFF, 0XFF, 0XFF, 0XE5, 0X8D, 0X38, 0X0A,
-  0X00, 0X00, 0X00, 0X01, 0X1A, 0X54, 0X95, 0XC3, 0XD1, 0XB6, 0X77, 0X33,
-  0X0C, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X01, 0X01, 0X01,
-  0X01, 0X10, 0X6D, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X03, 0X09, 0X11,
-  0X17, 0X18, 0X12, 0X09, 0X02, 0X00, 0X00, 0X04, 0X18, 0X46, 0X8D, 0XE0,
-  0XFF, 0XFF, 0XFF, 0XBC, 0X5C, 0X1C, 0X04, 0X01, 0X34, 0XAB, 0XE5, 0XFF,
-  0XFF, 0XFA, 0XE7, 0XB6, 0X70, 0X2D, 0X0A, 0X01, 0X00, 0X00, 0X09, 0X55,
-  0XCD, 0XFF, 0XFF, 0XFF, 0XFF, 0XE7, 0X8A, 0X34, 0X0A, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X01, 0X18, 0X4C, 0X86, 0XAF, 0XBF, 0XA7, 0X6B, 0X2E, 0X0A,
-  0X01, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X01,
-  0X01, 0X01, 0X00, 0X10, 0X6D, 0X00, 0X00, 0X00, 0X00, 0X00, 0X01, 0X07,
-  0X0F, 0X18, 0X1C, 0X1B, 0X12, 0X08, 0X02, 0X00, 0X01, 0X08, 0X25, 0X5C,
-  0XA7, 0XF2, 0XFF, 0XFF, 0XFC, 0XA9, 0X4F, 0X16, 0X03, 0X03, 0X50, 0XBF,
-  0XE2, 0XF4, 0XF7, 0XEF, 0XDB, 0XAD, 0X65, 0X26, 0X08, 0X00, 0X00, 0X00,
-  0X0D, 0X5B, 0XCF, 0XFF, 0XFF, 0XFF, 0XFF, 0XDB, 0X81, 0X2F, 0X08, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X02, 0X1C, 0X50, 0X88, 0XB4, 0XC1, 0XA5, 0X6A,
-  0X2B, 0X0A, 0X01, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X01, 0X01, 0X01, 0X01, 0X00, 0X10, 0X6D, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X02, 0X09, 0X13, 0X1C, 0X21, 0X1E, 0X13, 0X07, 0X01, 0X00, 0X00, 0X09,
-  0X2C, 0X6B, 0XBA, 0XFC, 0XFF, 0XFF, 0XF4, 0X99, 0X42, 0X12, 0X02, 0X04,
-  0X65, 0XCA, 0XE5, 0XED, 0XED, 0XE5, 0XD1, 0XA5, 0X5C, 0X21, 0X06, 0X00,
-  0X00, 0X00, 0X16, 0X6B, 0XD8, 0XFF, 0XFF, 0XFF, 0XFF, 0XC8, 0X73, 0X28,
-  0X06, 0X00, 0X00, 0X00, 0X00, 0X00, 0X05, 0X27, 0X62, 0X9D, 0XC6, 0XD1,
-  0XAF, 0X6B, 0X2A, 0X09, 0X01, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X01, 0X01, 0X02, 0X02, 0X01, 0X00, 0X10, 0X6D, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X02, 0X09, 0X13, 0X1D, 0X23, 0X1F, 0X13, 0X07, 0X01, 0X00,
-  0X00, 0X07, 0X29, 0X6A, 0XBC, 0XFF, 0XFF, 0XFF, 0XED, 0X8F, 0X3C, 0X0E,
-  0X01, 0X05, 0X65, 0XC8, 0XE2, 0XEA, 0XE5, 0XDD, 0XCD, 0X9D, 0X57, 0X1D,
-  0X05, 0X00, 0X00, 0X01, 0X22, 0X7D, 0XDD, 0XFF, 0XFF, 0XFF, 0XE7, 0XB6,
-  0X65, 0X21, 0X05, 0X00, 0X00, 0X00, 0X00, 0X00, 0X0B, 0X39, 0X7F, 0XBF,
-  0XE7, 0XEA, 0XBF, 0X72, 0X2B, 0X09, 0X01, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X01, 0X03, 0X04, 0X04, 0X03, 0X01, 0X00, 0X10, 0X6C, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X01, 0X08, 0X13, 0X1E, 0X23, 0X20, 0X13, 0X07,
-  0X00, 0X00, 0X04, 0X21, 0X62, 0XB8, 0XFC, 0XFF, 0XFF, 0XEA, 0X88, 0X37,
-  0X0C, 0X04, 0X54, 0XB4, 0XDD, 0XE5, 0XE0, 0XD8, 0XC6, 0X99, 0X50, 0X18,
-  0X04, 0X00, 0X02, 0X35, 0X99, 0XE2, 0XF7, 0XF2, 0XE7, 0XD4, 0XA5, 0X58,
-  0X1A, 0X03, 0X00, 0X00, 0X00, 0X01, 0X16, 0X53, 0XA3, 0XE2, 0XFF, 0XFF,
-  0XCA, 0X73, 0X2A, 0X08, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X02, 0X05,
-  0X08, 0X09, 0X08, 0X05, 0X02, 0X10, 0X6C, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X01, 0X07, 0X12, 0X1E, 0X24, 0X21, 0X14, 0X07, 0X00, 0X00, 0X02, 0X1A,
-  0X5B, 0XB4, 0XFC, 0XFF, 0XFF, 0XE7, 0X84, 0X32, 0X0A, 0X03, 0X3E, 0X9F,
-  0XDB, 0XE7, 0XDD, 0XD4, 0XBF, 0X95, 0X4C, 0X15, 0X03, 0X00, 0X04, 0X4A,
-  0XAD, 0XDB, 0XE0, 0XDB, 0XD6, 0XC6, 0X99, 0X4F, 0X15, 0X02, 0X00, 0X00,
-  0X00, 0X04, 0X25, 0X6E, 0XC6, 0XFF, 0XFF, 0XFF, 0XD6, 0X75, 0X29, 0X08,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X01, 0X07, 0X0D, 0X11, 0X11, 0X0D, 0X07,
-  0X03, 0X10, 0X6C, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X06, 0X11, 0X1E,
-  0X25, 0X23, 0X15, 0X08, 0X00, 0X00, 0X01, 0X14, 0X50, 0XAD, 0XFC, 0XFF,
-  0XFF, 0XEA, 0X83, 0X2F, 0X09, 0X02, 0X29, 0X86, 0XD4, 0XE2, 0XD8, 0XCD,
-  0XBA, 0X91, 0X47, 0X13, 0X02, 0X00, 0X04, 0X53, 0XB6, 0XD1, 0XCD, 0XC6,
-  0XC3, 0XB6, 0X8F, 0X47, 0X12, 0X01, 0X00, 0X00, 0X00, 0X09, 0X37, 0X8A,
-  0XE2, 0XFF, 0XFF, 0XFF, 0XDB, 0X73, 0X27, 0X07, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X05, 0X0F, 0X18, 0X1D, 0X1C, 0X15, 0X0B, 0X04, 0XFF, };
+  0X0E, 0X06, 0X47, 0X78, 0X19, 0X82, 0X28, 0X22, 0X81, 0X77, 0X21, 0X04,
+  0X76, 0X84, 0X08, 0X99, 0XF7, 0X99, 0XF5, 0X89, 0X18, 0X38, 0X74, 0X10,
+  0X27, 0XF8, 0X6B, 0X8C, 0X68, 0XE5, 0X8D, 0XB8, 0XCF, 0X8B, 0XC8, 0X93,
+  0X84, 0XB7, 0XC1, 0X03, 0X18, 0X48, 0X8B, 0X48, 0XC8, 0X8B, 0XC8, 0XBA,
+  0X8B, 0X88, 0XAD, 0X88, 0XA8, 0X42, 0X77, 0X10, 0X57, 0X58, 0X40, 0X89,
+  0XDF, 0X59, 0X99, 0X8D, 0XB8, 0X70, 0X82, 0X46, 0X06, 0X17, 0X28, 0X19,
+  0X82, 0X68, 0X2C, 0X82, 0X98, 0X1D, 0X78, 0X51, 0X0F, 0X0E, 0X0B, 0X11,
+  0X10, 0X41, 0X10, 0X33, 0X42, 0X10, 0X34, 0X70, 0X22, 0X22, 0X01, 0X21,
+  0X10, 0X4F, 0X2D, 0X70, 0X75, 0X54, 0X22, 0X32, 0X06, 0XDF, 0X5F, 0XCF,
+  0X60, 0X25, 0X32, 0X11, 0X05, 0X9B, 0XEF, 0X1F, 0X1F, 0X0C, 0X99, 0X0F,
+  0X0E, 0X06, 0X99, 0X12, 0X21, 0X10, 0XB5, 0X71, 0X32, 0X03, 0X47, 0X15,
+  0X33, 0X00, 0X34, 0X43, 0X04, 0X9F, 0X5F, 0X75, 0X75, 0X72, 0X57, 0X05,
+  0X62, 0X06, 0XCF, 0X98, 0X73, 0XFA, 0X02, 0X57, 0X03, 0X08, 0XBF, 0X0F,
+  0X2F, 0X1E, 0XCA, 0X0F, 0X0E, 0X07, 0X11, 0X13, 0X31, 0X05, 0X11, 0X03,
+  0X37, 0X15, 0X10, 0X33, 0X73, 0X40, 0X02, 0X34, 0X66, 0X21, 0X04, 0XF9,
+  0XFD, 0X27, 0X57, 0X77, 0X56, 0X71, 0X71, 0X30, 0X6A, 0XF7, 0X85, 0X88,
+  0XB6, 0X02, 0X57, 0X23, 0X10, 0X7A, 0XEF, 0X0F, 0X1F, 0X0B, 0X90, 0XF0,
+  0XE0, 0X81, 0X32, 0X22, 0X10, 0X5A, 0XA0, 0X37, 0X36, 0X21, 0X03, 0X72,
+  0X70, 0X33, 0X43, 0X67, 0X04, 0X05, 0XF7, 0X87, 0X2F, 0X27, 0X67, 0XA7,
+  0X77, 0X57, 0X37, 0X25, 0X10, 0X59, 0XF4, 0X83, 0XE8, 0X97, 0XFB, 0X01,
+  0X37, 0X06, 0X10, 0X79, 0XBD, 0XEC, 0XB9, 0X0F, 0X0E, 0X08, 0X11, 0X43,
+  0X20, 0X59, 0XAA, 0X03, 0X76, 0X71, 0X30, 0X3D, 0X71, 0X71, 0X55, 0X57,
+  0X06, 0X70, 0X42, 0X04, 0XF2, 0X85, 0X8F, 0X77, 0X37, 0XC7, 0X57, 0X57,
+  0X37, 0X24, 0X10, 0X6F, 0X0F, 0XD8, 0X7C, 0X8D, 0X60, 0X15, 0X72, 0X31,
+  0X08, 0XAB, 0XBB, 0X90, 0XF0, 0XE0, 0X69, 0XAB, 0X99, 0X21, 0X10, 0X4B,
+  0XF2, 0XF8, 0XF1, 0X02, 0X75, 0X72, 0X41, 0X02, 0XF2, 0XE2, 0X57, 0X15,
+  0X46, 0X71, 0X51, 0X04, 0XEF, 0XCF, 0XB3, 0X57, 0X14, 0X70, 0X72, 0X40,
+  0X7A, 0XF6, 0XFE, 0XF9, 0X01, 0X71, 0X71, 0X62, 0X08, 0X9A, 0X90, 0XF0,
+  0XE0, 0X69, 0XCD, 0XF0, 0XCA, 0X11, 0X04, 0XCF, 0X4F, 0XCF, 0XB0, 0X27,
+  0X77, 0X55, 0X10, 0X2F, 0X2F, 0XCF, 0X03, 0X71, 0X71, 0X70, 0X70, 0X71,
+  0X61, 0X04, 0XBF, 0X3F, 0X10, 0X13, 0X34, 0X53, 0X10, 0X69, 0XDE, 0X40,
+  0X15, 0X73, 0X40, 0XA1, 0X23, 0X43, 0X20, 0XF0, 0XE0, 0X69, 0XCF, 0X1F,
+  0X2F, 0X2D, 0XA0, 0X5D, 0XFA, 0X85, 0X48, 0XB4, 0X02, 0X75, 0X79, 0X70,
+  0X10, 0X2E, 0X85, 0X78, 0XBF, 0XE5, 0X79, 0X76, 0X74, 0X77, 0X70, 0X20,
+  0X49, 0X27, 0X30, 0X1F, 0X1D, 0XA2, 0X30, 0X84, 0X75, 0X7C, 0X02, 0X71,
+  0X0A, 0X15, 0X72, 0X74, 0X72, 0X52, 0X0F, 0X0E, 0X07, 0XBF, 0X1F, 0X4F,
+  0X4F, 0X0A, 0X90, 0X4A, 0XF8, 0X83, 0X38, 0X83, 0X8D, 0XD0, 0X17, 0X17,
+  0X57, 0X01, 0X02, 0XB8, 0X2D, 0X88, 0XCF, 0XB0, 0X05, 0X7B, 0X79, 0X75,
+  0X71, 0X30, 0X49, 0X78, 0X8D, 0X15, 0XF9, 0XF8, 0XF2, 0XCA, 0X90, 0X73,
+  0X7A, 0X89, 0X38, 0XFF, 0X02, 0XEC, 0XA0, 0X84, 0X77, 0X7F, 0X83, 0X47,
+  0XD7, 0X43, 0X10, 0XF0, 0XE0, 0X79, 0XCF, 0X1F, 0X3F, 0X1C, 0X06, 0XF2,
+  0X81, 0X58, 0X4F, 0X8A, 0X18, 0XE7, 0X00, 0XD7, 0X07, 0X02, 0X02, 0X98,
+  0X0D, 0X84, 0XB8, 0XB4, 0X01, 0X71, 0X8E, 0XA7, 0XB7, 0X42, 0X10, 0X47,
+  0XC8, 0XFF, 0XDF, 0XDF, 0X7F, 0X0B, 0X99, 0X07, 0X74, 0X85, 0X58, 0XD1,
+  0X02, 0XF9, 0X88, 0XAF, 0X6B, 0X07, 0X27, 0XA8, 0X3D, 0X85, 0XB8, 0X64,
+  0X85, 0X17, 0XB5, 0X10, 0XF0, 0XE0, 0X89, 0XCE, 0XEB, 0X90, 0X59, 0XFA,
+  0X82, 0X48, 0X65, 0X8A, 0XF8, 0XE0, 0XF8, 0X46, 0X10, 0X3F, 0X58, 0X1A,
+  0X86, 0XE8, 0XE5, 0X01, 0X7E, 0X8B, 0XF7, 0X84, 0X04, 0X9F, 0X10, 0X0E,
+  0XF3, 0XB0, 0X29, 0X06, 0X38, 0X2E, 0X89, 0X98, 0XFC, 0X01, 0XD8, 0XBF,
+  0X86, 0X5F, 0XAB, 0X90, 0X67, 0X68, 0X40, 0X88, 0X18, 0XA7, 0X8A, 0X78,
+  0X81, 0X7E, 0X70, 0X10, 0XF0, 0XE0, 0X99, 0XBC, 0XB9, 0X06, 0XC8, 0X0A,
+  0X83, 0X48, 0X77, 0X8B, 0X28, 0XBF, 0XA3, 0X20, 0X39, 0XFF, 0X83, 0X18,
+  0XA1, 0X02, 0X8E, 0X07, 0XC6, 0X05, 0X82, 0XA8, 0XC6, 0XA7, 0X57, 0X00,
+  0X0A, 0XA9, 0X90, 0X57, 0X78, 0X6E, 0X8D, 0X43, 0XDF, 0XE8, 0XCF, 0X89,
+  0X98, 0X4A, 0XF5, 0XA0, 0X67, 0X38, 0X3B, 0X88, 0XC8, 0XD6, 0X8F, 0X78,
+  0XE7, 0X8A, 0X97, 0XA4, 0X10, 0X81, 0X44, 0X21, 0X0F, 0X0E, 0X0A, 0X9A,
+  0X90, 0X8F, 0X28, 0X17, 0X84, 0XB8, 0X86, 0X8A, 0X5E, 0X42, 0X04, 0XC8,
+  0X0E, 0X85, 0XB8, 0XE5, 0X01, 0X8F, 0XA8, 0X81, 0X70, 0X10, 0X48, 0X09,
+  0X86, 0XAF, 0XB8, 0XF7, 0X7A, 0X70, 0X50, 0X87, 0XC8, 0XBA, 0X77, 0X8D,
+  0XB8, 0XD6, 0X8C, 0XF8, 0XB8, 0XFC, 0XFA, 0XE9, 0X05, 0X48, 0X2E, 0X88,
+  0X18, 0XE0, 0X8F, 0XF7, 0X18, 0XFF, 0X8C, 0X37, 0X33, 0X08, 0X37, 0X47,
+  0X77, 0X46, 0X21, 0X0F, 0X0E, 0X0B, 0X99, 0X08, 0X9F, 0X78, 0X2F, 0X86,
+  0X8F, 0XDB, 0X22, 0X10, 0X4F, 0X58, 0X30, 0X8B, 0X20, 0X15, 0X89, 0X97,
+  0X31, 0X04, 0XF1, 0X82, 0XD8, 0XB8, 0X71, 0X7E, 0X74, 0X22, 0X08, 0X8D,
+  0X8F, 0X38, 0XC3, 0XF9, 0XF2, 0XEF, 0X2E, 0XB9, 0X04, 0X17, 0XB8, 0X5E,
+  0X8B, 0XC8, 0XFF, 0X02, 0X70, 0X20, 0X83, 0X75, 0X7C, 0X7C, 0X76, 0X70,
+  0X20, 0XF0, 0XE0, 0XC9, 0X90, 0X8D, 0XF7, 0XFA, 0XF6, 0XC4, 0X20, 0X5A,
+  0XFD, 0X88, 0XD0, 0X27, 0XB7, 0X12, 0X04, 0X98, 0X14, 0X89, 0X30, 0X07,
+  0X17, 0X34, 0X11, 0X10, 0X5F, 0X3F, 0X20, 0X0F, 0X0D, 0XDB, 0XBA, 0X06,
+  0X28, 0X2E, 0X88, 0X48, 0XD8, 0X0E, 0X67, 0X67, 0X87, 0X45, 0X21, 0X0F,
+  0X0E, 0X0E, 0X08, 0X9C, 0XF1, 0XF0, 0X00, 0X32, 0X06, 0XCF, 0X00, 0X27,
+  0X44, 0X10, 0X5C, 0XF0, 0X01, 0X32, 0X22, 0X07, 0XD0, 0X03, 0X22, 0X00,
+  0X32, 0X11, 0X04, 0X27, 0X57, 0X25, 0X03, 0XF2, 0XF2, 0XC9, 0X05, 0X11,
+  0X9E, 0XF3, 0XF2, 0XEB, 0X0F, 0X0E, 0X0E, 0X09, 0X11, 0X20, 0X05, 0X41,
+  0X05, 0X67, 0X40, 0X24, 0X51, 0X05, 0X71, 0X7A, 0X03, 0X22, 0X10, 0X57,
+  0X57, 0XA3, 0X70, 0X70, 0X70, 0X70, 0X70, 0X72, 0X50, 0X59, 0XF2, 0XFA,
+  0XF9, 0X03, 0XFB, 0XF2, 0XB9, 0X05, 0X9D, 0XF6, 0XFC, 0XFC, 0XF6, 0XF0,
+  0XA9, 0X0F, 0X0E, 0X0D, 0X11, 0X07, 0X36, 0X74, 0X74, 0X74, 0X71, 0X41,
+  0X04, 0X27, 0X68, 0XA9, 0X03, 0X11, 0X04, 0X17, 0XD8, 0XB8, 0X01, 0XB2,
+  0X34, 0X10, 0X57, 0X67, 0X87, 0X87, 0XB7, 0XA7, 0X77, 0XB7, 0XE7, 0XC7,
+  0X02, 0X04, 0XA8, 0X1A, 0X85, 0X48, 0X9D, 0X8E, 0X00, 0X18, 0XE0, 0X89,
+  0X3F, 0X6B, 0X07, 0XDF, 0X4F, 0X8F, 0X7F, 0X1B, 0X90, 0XF0, 0XE0, 0XC1,
+  0X09, 0X67, 0X87, 0XE7, 0XC7, 0X87, 0X25, 0X05, 0X58, 0X47, 0X8D, 0X10,
+  0X2F, 0X49, 0X10, 0X44, 0X85, 0X78, 0XE2, 0X00, 0XDD, 0X00, 0X54, 0X10,
+  0X5C, 0X8D, 0X17, 0X38, 0XFC, 0X8F, 0XF8, 0XFF, 0X8F, 0X28, 0XC3, 0X87,
+  0X07, 0X83, 0X04, 0XAF, 0XE8, 0X21, 0X85, 0X48, 0X8F, 0X8B, 0X88, 0XBF,
+  0X8A, 0X38, 0X6D, 0XF8, 0XD9, 0X07, 0XBE, 0XDB, 0X90, 0XF0, 0XE0, 0XB1,
+  0X11, 0X07, 0X27, 0X48, 0X4A, 0X88, 0XC8, 0XB6, 0X77, 0X70, 0X21, 0X04,
+  0X77, 0X87, 0X08, 0XF7, 0X02, 0XF5, 0XB0, 0X57, 0XA8, 0XA7, 0X8F, 0XF0,
+  0X0B, 0X37, 0X07, 0X47, 0X23, 0X05, 0XFF, 0X87, 0XC8, 0XCF, 0X30, 0X17,
+  0X68, 0XFF, 0X8A, 0X17, 0XF4, 0X10, 0X4D, 0X80, 0X48, 0X17, 0X83, 0X98,
+  0X58, 0X86, 0X48, 0X58, 0X83, 0XFF, 0XBC, 0X0F, 0X0E, 0X0B, 0X12, 0X10,
+  0X73, 0X76, 0X86, 0X18, 0XA5, 0X7B, 0X71, 0X32, 0X04, 0X27, 0XD8, 0X99,
+  0X71, 0X02, 0XF3, 0XC0, 0X57, 0XF8, 0XF7, 0X01, 0X71, 0X73, 0X73, 0X72,
+  0X71, 0X30, 0X5F, 0X98, 0X37, 0X87, 0XD8, 0XE2, 0X03, 0X8C, 0X87, 0XB5,
+  0X06, 0XCF, 0XE8, 0X0E, 0X81, 0XF8, 0X2A, 0X82, 0XB8, 0X22, 0XF5, 0XB9,
+  0X0F, 0X0E, 0X0A, 0X11, 0X11, 0X07, 0X47, 0X47, 0XA7, 0XA7, 0X52, 0XBB,
+  0X04, 0X47, 0XA8, 0XB4, 0X02, 0XBF, 0X3A, 0X90, 0X47, 0X47, 0X10, 0X27,
+  0X14, 0X65, 0X20, 0X5D, 0X81, 0XB8, 0X51, 0X8B, 0X40, 0X37, 0X27, 0X22,
+  0X07, 0XAF, 0X2F, 0X7F, 0X7F, 0X4E, 0XA0, 0XF0, 0XE0, 0XD9, 0X07, 0X13,
+  0X32, 0XBE, 0XF0, 0XB9, 0X03, 0X24, 0X40, 0X2A, 0XDC, 0X90, 0X47, 0X20,
+  0X2D, 0XF6, 0XF0, 0XF1, 0XDA, 0X05, 0X91, 0X71, 0X78, 0X03, 0XF4, 0XF1,
+  0XA0, 0X85, 0X76, 0X7E, 0X83, 0X77, 0XD7, 0X55, 0X10, 0XF0, 0XE0, 0XA9,
+  0X9A, 0X90, 0X7D, 0XF9, 0X85, 0XB8, 0X9B, 0X8B, 0X8F, 0X9F, 0X3E, 0X90,
+  0X3D, 0XFE, 0X88, 0XF0, 0X25, 0X3C, 0XA0, 0X5F, 0XE0, 0X0B, 0X8E, 0X2F,
+  0XAF, 0X7F, 0X6F, 0X6D, 0X05, 0X79, 0X85, 0X18, 0XB2, 0X8F, 0XF0, 0X28,
+  0XD6, 0X87, 0XC8, 0X29, 0XF2, 0X90, 0X51, 0X7B, 0X84, 0X08, 0X7A, 0X89,
+  0XF8, 0X9F, 0X87, 0XD8, 0X47, 0X75, 0X30, 0XF0, 0XE0, 0XBA, 0XA9, 0X07,
+  0XD8, 0X0A, 0X82, 0XF8, 0X65, 0X88, 0XFF, 0XFF, 0X7E, 0X90, 0X3B, 0X80,
+  0X88, 0X41, 0X8C, 0X10, 0X27, 0XB1, 0XA0, 0X48, 0X12, 0X86, 0X78, 0XD8,
+  0X37, 0X4B, 0XF1, 0XF5, 0XF4, 0XB0, 0X44, 0X87, 0X88, 0XE5, 0X8E, 0X78,
+  0XDB, 0X8D, 0X48, 0XCF, 0X8B, 0XA8, 0X8C, 0X84, 0X08, 0X0E, 0XD0, 0X57,
+  0X58, 0X39, 0X88, 0X68, 0XE0, 0X8F, 0XF8, 0XFF, 0X8F, 0XF8, 0XD8, 0X87,
+  0X57, 0X93, 0X10, 0X63, 0X75, 0X7B, 0X7B, 0X75, 0X62, 0X0F, 0X0E, 0X0C,
+  0X90, 0X09, 0X07, 0XF2, 0X81, 0X58, 0X41, 0X87, 0X0F, 0X9F, 0X0C, 0X05,
+  0XF1, 0X81, 0X28, 0X6D, 0XF4, 0X01, 0X79, 0X20, 0X5F, 0XB8, 0X19, 0X88,
+  0X4B, 0X7B, 0X75, 0X29, 0XCA, 0X04, 0X1D, 0XD8, 0XCD, 0X8B, 0X48, 0XB4,
+  0X8B, 0X6F, 0XCF, 0XEF, 0XAF, 0X09, 0X03, 0X28, 0X21, 0X85, 0X98, 0XA5,
+  0X8E, 0XA8, 0XFF, 0X02, 0XF9, 0XB3, 0X30, 0X53, 0X7A, 0X82, 0XE8, 0X50,
+  0X86, 0X28, 0X5E, 0X84, 0X58, 0X25, 0X75, 0X30, 0XF0, 0XE0, 0XE0, 0X89,
+  0XCB, 0X35, 0X00, 0X99, 0X05, 0XF5, 0X84, 0XD8, 0XDD, 0X02, 0XB9, 0X05,
+  0XFE, 0X84, 0XF8, 0XE2, 0X00, 0X71, 0X01, 0XA9, 0X04, 0XD8, 0X29, 0X8A,
+  0X7B, 0XDF, 0X0F, 0X0C, 0XDE, 0XA0, 0X41, 0X84, 0X78, 0X91, 0X8C, 0X3F,
+  0X1F, 0XBF, 0XB8, 0XE5, 0X8C, 0XD8, 0X97, 0X85, 0X3F, 0X30, 0X01, 0X03,
+  0X37, 0X88, 0X34, 0X86, 0X58, 0X95, 0X8B, 0X48, 0XAF, 0X88, 0XF8, 0X58,
+  0X82, 0X57, 0X01, 0X0F, 0X0E, 0X0B, 0X13, 0X11, 0X07, 0X17, 0X58, 0X5B,
+  0X89, 0X58, 0X8F, 0X70, 0X07, 0X96, 0X76, 0X01, 0XFD, 0XF1, 0X90, 0X5B,
+  0XFD, 0XF5, 0X00, 0XF8, 0XC3, 0X07, 0X80, 0XB8, 0X7C, 0XF0, 0XCE, 0XCA,
+  0X10, 0X09, 0X04, 0XB8, 0X25, 0XF0, 0XF4, 0XFA, 0XFE, 0XFE, 0XFD, 0X8B,
+  0X6F, 0XFF, 0XDF, 0X3B, 0X05, 0X47, 0X47, 0XC8, 0XAF, 0X8D, 0X68, 0XDD,
+  0X8C, 0X18, 0X84, 0X83, 0XF7, 0X12, 0X07, 0X12, 0X21, 0X0F, 0X0E, 0X0A,
+  0X14, 0X53, 0X08, 0X70, 0X84, 0X18, 0X95, 0X8C, 0XD8, 0XAD, 0X70, 0X11,
+  0X05, 0X70, 0X87, 0XC7, 0XE0, 0X0F, 0X48, 0X7C, 0XF2, 0X90, 0X67, 0X47,
+  0X0F, 0XBF, 0XEF, 0X0A, 0X10, 0X6F, 0X18, 0X65, 0XF8, 0XF3, 0XCC, 0X25,
+  0X21, 0X05, 0X80, 0X58, 0X53, 0XFE, 0XF0, 0XCC, 0XCA, 0XCA, 0XB9, 0X04,
+  0XBF, 0X4F, 0X7F, 0X4E, 0XA5, 0X77, 0X7E, 0X7A, 0X71, 0X10, 0X79, 0X00,
+  0X11, 0X10, 0XF0, 0XE0, 0X91, 0X67, 0X47, 0X34, 0X07, 0X18, 0X24, 0X88,
+  0X18, 0XDD, 0X8F, 0XF7, 0XD2, 0X07, 0X82, 0XA8, 0XC3, 0X01, 0X8C, 0XA8,
+  0X64, 0XE0, 0X63, 0X86, 0X8D, 0X8C, 0X6F, 0X8C, 0X90, 0X7B, 0XFD, 0XF8,
+  0XF1, 0XA0, 0X14, 0X51, 0X05, 0XD8, 0X15, 0X87, 0X2F, 0X07, 0X27, 0X27,
+  0X07, 0X17, 0X47, 0X13, 0X10, 0X5F, 0X38, 0X15, 0X84, 0X88, 0X88, 0X8B,
+  0XCF, 0X7D, 0X25, 0X31, 0X08, 0X99, 0X0F, 0X0E, 0X08, 0X17, 0X17, 0X97,
+  0XB7, 0X44, 0X10, 0X67, 0X88, 0X61, 0X8D, 0X88, 0XFF, 0X00, 0XAF, 0X0A,
+  0X05, 0X71, 0X87, 0X08, 0XFA, 0X00, 0X8E, 0X28, 0XAD, 0XFA, 0XC0, 0X67,
+  0X48, 0X8F, 0X8B, 0XA8, 0XAB, 0XF0, 0XAA, 0X90, 0X78, 0X31, 0XF5, 0X42,
+  0X22, 0X33, 0X10, 0X6F, 0XD8, 0X31, 0X89, 0XF5, 0X7B, 0X7A, 0X7A, 0X7A,
+  0X77, 0X71, 0X31, 0X04, 0X9F, 0XB8, 0X21, 0X85, 0X98, 0X8F, 0X8A, 0XD8,
+  0XAD, 0XFA, 0XF1, 0XB0, 0X99, 0XA9, 0X90, 0XF0, 0XE0, 0X87, 0X07, 0XC8,
+  0X2E, 0X7C, 0X74, 0X31, 0X05, 0X58, 0X3F, 0X8B, 0X48, 0XFF, 0X01, 0XF9,
+  0XF3, 0X90, 0X58, 0X31, 0X8B, 0XAE, 0X8E, 0X28, 0XC8, 0XFB, 0XF5, 0XB0,
+  0X68, 0X27, 0X79, 0X89, 0XFF, 0X1A, 0XCB, 0X08, 0X81, 0X3F, 0XC7, 0XB7,
+  0X12, 0X25, 0X70, 0X10, 0X69, 0X80, 0XA8, 0X5E, 0X8C, 0XA7, 0X98, 0XFF,
+  0X8E, 0X58, 0XB6, 0X86, 0XB7, 0X84, 0X06, 0XB8, 0X07, 0X82, 0X98, 0X58,
+  0X87, 0XA8, 0X7F, 0X86, 0X7F, 0XDF, 0X1A, 0X0A, 0X90, 0XF0, 0XE0, 0X75,
+  0X7B, 0X83, 0X38, 0X45, 0X7B, 0X73, 0X30, 0X51, 0X82, 0X38, 0X83, 0X8F,
+  0X40, 0X2F, 0XDF, 0X2A, 0X04, 0X73, 0X87, 0X58, 0XD4, 0X8D, 0X68, 0XC8,
+  0XF9, 0XF3, 0XE9, 0X06, 0X7F, 0XAF, 0X1A, 0XA0, 0X01, 0X11, 0X06, 0XF7,
+  0X86, 0X27, 0XD8, 0XC3, 0X76, 0X67, 0X27, 0X34, 0X07, 0XF2, 0X82, 0X48,
+  0X8C, 0XFB, 0X00, 0X8F, 0XF8, 0XDD, 0X88, 0XF7, 0XC5, 0X07, 0XF0, 0X80,
+  0XA8, 0X24, 0X83, 0XD8, 0X45, 0X83, 0X98, 0X1E, 0XF2, 0XA0, 0XF0, 0XE0,
+  0X62, 0X76, 0X83, 0X28, 0X4D, 0X85, 0XE7, 0XA7, 0X14, 0X10, 0X47, 0X68,
+  0X55, 0X8C, 0X37, 0X40, 0X1F, 0X4F, 0XAE, 0X90, 0X48, 0X33, 0X8A, 0X7F,
+  0X78, 0XBF, 0XF7, 0XED, 0XB0, 0X77, 0X14, 0X62, 0X00, 0X24, 0X41, 0X06,
+  0XC8, 0X37, 0XF4, 0X8E, 0X78, 0XD6, 0X7D, 0X79, 0X7C, 0X72, 0X10, 0X69,
+  0X80, 0X68, 0X3E, 0X89, 0XFF, 0XE0, 0X07, 0XB8, 0XA7, 0X73, 0X10, 0X8F,
+  0X38, 0X06, 0X80, 0XF8, 0X13, 0X80, 0XF8, 0X07, 0XF0, 0X90, 0XF0, 0XE0,
+  0X67, 0X07, 0XC8, 0X4B, 0X86, 0X88, 0X75, 0X7B, 0X72, 0X52, 0X03, 0X38,
+  0X2D, 0X88, 0X88, 0XEA, 0X02, 0XF8, 0XF7, 0XD0, 0X45, 0X87, 0X07, 0X1F,
+  0XBF, 0X4E, 0XBA, 0X11, 0X05, 0X1F, 0X74, 0X8B, 0X67, 0X16, 0X47, 0X37,
+  0X32, 0X06, 0X98, 0X13, 0X87, 0X83, 0X8F, 0XF8, 0XEF, 0X8C, 0XA8, 0X81,
+  0X82, 0XD6, 0X07, 0XE8, 0X0E, 0X84, 0X18, 0X86, 0X8A, 0XD8, 0XAF, 0X88,
+  0X3F, 0X7C, 0X90, 0X8E, 0XF8, 0XFB, 0XF7, 0XF0, 0XA0, 0XF0, 0XE0, 0X53,
+  0X74, 0X7B, 0X7A, 0X78, 0X75, 0X66, 0X53, 0X10, 0X27, 0X88, 0X51, 0X8A,
+  0XB7, 0X90, 0X2D, 0X00, 0X64, 0X03, 0X76, 0X89, 0X93, 0XF4, 0XF0, 0X01,
+  0X33, 0X31, 0X04, 0X9F, 0XFF, 0X78, 0XD1, 0X8C, 0X37, 0X67, 0X17, 0X47,
+  0X43, 0X07, 0XF8, 0X83, 0XB8, 0XB2, 0X00, 0X79, 0X8F, 0XF8, 0XBF, 0X85,
+  0X57, 0X51, 0X07, 0XF6, 0X81, 0X18, 0X33, 0X84, 0XF8, 0X59, 0X84, 0XBF,
+  0XFD, 0X90, 0XA9, 0X90, 0XF0, 0XE0, 0X51, 0X9F, 0X2F, 0XAF, 0XF8, 0X6A,
+  0XFA, 0XE2, 0X30, 0X23, 0X78, 0X79, 0X72, 0XB0, 0X28, 0XFC, 0X89, 0XF8,
+  0X4A, 0X75, 0X40, 0X27, 0XC7, 0XF7, 0X34, 0X70, 0X71, 0X70, 0X71, 0X76,
+  0X70, 0X10, 0X5F, 0X2F, 0XF7, 0X58, 0XE5, 0X7E, 0X76, 0X74, 0X76, 0X50,
+  0X7B, 0X81, 0XD8, 0X7A, 0XFB, 0X01, 0X8E, 0XA8, 0X75, 0X74, 0X20, 0X79,
+  0XF7, 0X81, 0X28, 0X24, 0X83, 0X18, 0X30, 0XF3, 0XA0, 0XF0, 0XE0, 0X5C,
+  0XF9, 0X80, 0XC8, 0X1A, 0X82, 0X98, 0X34, 0X83, 0XAF, 0XCB, 0X32, 0X01,
+  0XAF, 0XA8, 0X3A, 0X87, 0XC8, 0XCF, 0X02, 0X38, 0XE7, 0X88, 0X48, 0X3A,
+  0X74, 0X20, 0X12, 0X74, 0X8D, 0X68, 0XC8, 0X7F, 0X7C, 0X7D, 0X8A, 0XD8,
+  0X68, 0X78, 0X40, 0X6C, 0X73, 0X76, 0X77, 0X75, 0X75, 0X77, 0X61, 0X06,
+  0X9E, 0XF1, 0X20, 0X17, 0X15, 0X0A, 0X90, 0X05, 0X72, 0X72, 0X70, 0X41,
+  0X0F, 0X0E, 0X06, 0XBF, 0X58, 0X02, 0X80, 0X98, 0X15, 0X82, 0X3F, 0X13,
+  0X62, 0X01, 0X9F, 0X98, 0X05, 0X81, 0XE8, 0X55, 0X8A, 0XB0, 0X28, 0XFF,
+  0X8B, 0X48, 0X54, 0X73, 0X20, 0X18, 0X05, 0X85, 0XF8, 0XBA, 0X8E, 0X78,
+  0XFC, 0X8F, 0XF8, 0XF2, 0X8D, 0X18, 0X86, 0X79, 0X51, 0X03, 0X17, 0XC8,
+  0XA5, 0X71, 0XF6, 0XF5, 0X00, 0X67, 0X25, 0X07, 0X27, 0XC8, 0XA5, 0X79,
+  0X01, 0XFE, 0XFC, 0XE9, 0X08, 0X74, 0X83, 0X38, 0X5E, 0X87, 0X28, 0X64,
+  0X7E, 0X61, 0X0F, 0X0E, 0X08, 0X90, 0X07, 0X27, 0XE8, 0X45, 0X83, 0XC7,
+  0X64, 0X03, 0XD8, 0X03, 0X82, 0X48, 0X78, 0XFB, 0X02, 0XF6, 0XFB, 0XF1,
+  0X90, 0X1D, 0X80, 0X98, 0X4F, 0X8B, 0XC3, 0X00, 0X73, 0X52, 0X9A, 0X90,
+  0X39, 0X48, 0XD8, 0XA8, 0XCD, 0XF4, 0XD2, 0X00, 0X90, 0X76, 0X85, 0X48,
+  0XE0, 0X01, 0XF1, 0X8A, 0XF8, 0X4D, 0XF2, 0X90, 0X74, 0X82, 0XB8, 0X73,
+  0X8A, 0XD8, 0XBA, 0X89, 0X98, 0X58, 0X73, 0X20, 0XB1, 0X0F, 0X0E, 0X08,
+  0X27, 0X58, 0X37, 0X85, 0X88, 0X62, 0X7A, 0X60, 0X5A, 0X00, 0X79, 0X78,
+  0X01, 0XF6, 0X87, 0XC8, 0X29, 0XF3, 0XA0, 0X2F, 0X18, 0X2D, 0XFE, 0X01,
+  0X8E, 0X5F, 0XCF, 0X4F, 0X2C, 0X05, 0XFB, 0XF2, 0X8C, 0XD8, 0XB4, 0XF7,
+  0XF2, 0XF1, 0XF0, 0XB0, 0X77, 0X68, 0X83, 0X7D, 0X00, 0XFE, 0X8C, 0X88,
+  0X8D, 0XFE, 0XE9, 0X07, 0X7A, 0X86, 0X48, 0XC8, 0X8F, 0XF8, 0XFF, 0X8D,
+  0X48, 0X7A, 0X78, 0X41, 0X08, 0X57, 0X27, 0X05, 0X20, 0XF0, 0XE0, 0X8A,
+  0XDF, 0X1F, 0X4F, 0X3F, 0X2F, 0X1B, 0X04, 0X9F, 0X88, 0X67, 0X8E, 0X50,
+  0X1D, 0XF3, 0XF1, 0XB9, 0X02, 0X98, 0X13, 0X87, 0XCF, 0XBB, 0XDA, 0X00,
+  0X99, 0X05, 0XE8, 0XAD, 0X8B, 0X2F, 0X8F, 0X4E, 0XAA, 0X90, 0X62, 0X83,
+  0XC8, 0XB4, 0X8D, 0XB8, 0XCF, 0X8C, 0X6F, 0XFF, 0XAF, 0X2A, 0X07, 0X72,
+  0X84, 0XB8, 0XBF, 0X8F, 0XF0, 0X18, 0XEF, 0X89, 0X17, 0X86, 0X10, 0X61,
+  0X75, 0X81, 0XD8, 0X24, 0X82, 0X07, 0X75, 0X10, 0XF0, 0XE0, 0X89, 0XF5,
+  0X81, 0X48, 0X29, 0X83, 0X48, 0X2A, 0XF6, 0XB0, 0X5F, 0X88, 0X3B, 0X8A,
+  0X50, 0X17, 0X07, 0X64, 0X10, 0X4F, 0X68, 0X4D, 0X8C, 0XF3, 0X7B, 0X72,
+  0X72, 0X40, 0X6B, 0X88, 0XA0, 0X1C, 0XF0, 0XA0, 0X01, 0X06, 0X78, 0X87,
+  0XC0, 0X08, 0XB2, 0X8B, 0X2F, 0X9F, 0X4F, 0X0C, 0X90, 0X63, 0X83, 0X28,
+  0X99, 0X8F, 0X70, 0X2F, 0X6C, 0X71, 0X70, 0X10, 0X51, 0X77, 0X82, 0XE8,
+  0X48, 0X85, 0X18, 0X45, 0X82, 0XA7, 0X43, 0X0F, 0X0E, 0X09, 0XCF, 0XA8,
+  0X0B, 0X81, 0X4F, 0XFF, 0X2A, 0X05, 0XE8, 0X14, 0X85, 0X88, 0XB4, 0XF1,
+  0XF3, 0X74, 0X72, 0X10, 0X4E, 0X82, 0X08, 0X91, 0X00, 0X76, 0X8E, 0XF8,
+  0XA1, 0X77, 0X10, 0X5F, 0X38, 0X61, 0X47, 0XA4, 0X01, 0X31, 0X06, 0X83,
+  0X88, 0X97, 0X89, 0X98, 0X99, 0XF8, 0XF4, 0XEF, 0X0B, 0X06, 0X18, 0X1C,
+  0X87, 0X28, 0XC8, 0XD0, 0X0B, 0XFE, 0X8B, 0X8F, 0XFD, 0X42, 0X05, 0X75,
+  0X83, 0X38, 0X65, 0X88, 0X68, 0X8D, 0X87, 0XA8, 0X50, 0X7B, 0X70, 0X10,
+  0XF0, 0XE0, 0XAB, 0XF3, 0XF7, 0XF3, 0XC0, 0X7F, 0XC8, 0X1C, 0X85, 0XE8,
+  0XA9, 0X8C, 0X63, 0X72, 0X20, 0X58, 0X03, 0X83, 0XD8, 0XCA, 0X00, 0X79,
+  0X8D, 0X88, 0X57, 0X50, 0X5F, 0X38, 0X23, 0X89, 0X78, 0XD6, 0X7D, 0X70,
+  0X47, 0X12, 0X06, 0XCF, 0X1F, 0X1F, 0X1E, 0XCC, 0XCC, 0X90, 0X57, 0X58,
+  0X4F, 0X89, 0XBD, 0X8C, 0XD8, 0XD1, 0X8C, 0XF8, 0XB8, 0X88, 0X88, 0X51,
+  0XFB, 0XB1, 0X04, 0X75, 0X83, 0X48, 0X73, 0X8B, 0X28, 0XD8, 0X8D, 0XD8,
+  0XC3, 0X88, 0XC8, 0X4A, 0X77, 0X30, 0X71, 0X21, 0X10, 0XF0, 0XE0, 0XB9,
+  0XA0, 0X01, 0X07, 0X9F, 0XE8, 0X39, 0X88, 0XCD, 0X77, 0X73, 0X31, 0X04,
+  0XB8, 0X0D, 0X87, 0XF0, 0X18, 0XFA, 0X87, 0X05, 0X06, 0X80, 0X38, 0X4A,
+  0X00, 0X8E, 0X77, 0X87, 0X17, 0X24, 0X06, 0X80, 0XD8, 0X6B, 0X7B, 0X60,
+  0X21, 0X99, 0X05, 0X82, 0X48, 0X78, 0XC8, 0XA7, 0X8A, 0XF8, 0XB8, 0X8B,
+  0X68, 0XA1, 0X86, 0XD8, 0X38, 0XFC, 0XF2, 0X04, 0X72, 0X82, 0XE8, 0X6E,
+  0X8B, 0X48, 0XEA, 0X8F, 0XF8, 0XFF, 0X8F, 0XF8, 0XC6, 0X87, 0X27, 0XC3,
+  0X06, 0X37, 0X07, 0X47, 0X46, 0X20, 0XF0, 0XE0, 0XB2, 0X71, 0X72, 0X62,
+  0X07, 0X17, 0XC8, 0XB6, 0X8E, 0XF8, 0XB6, 0X74, 0X40, 0X6F, 0X1F, 0X50,
+  0X1F, 0X4F, 0X7A, 0X06, 0XB8, 0X22, 0XF7, 0X79, 0X52, 0X19, 0X06, 0XF6,
+  0X83, 0X44, 0X75, 0X22, 0X43, 0X19, 0X05, 0X80, 0XDB, 0XCF, 0X1E, 0XAA,
+  0XAB, 0XED, 0XB9, 0X03, 0X47, 0X57, 0X87, 0X15, 0X02, 0X72, 0X71, 0X41,
+  0X05, 0X13, 0X56, 0X65, 0X20, 0XF0, 0XE0, 0XA3, 0X7A, 0X82, 0X77, 0XF7,
+  0X42, 0X06, 0X18, 0X2E, 0X8A, 0XB8, 0XFF, 0X79, 0X6C, 0X07, 0X7E, 0X8C,
+  0X80, 0X18, 0XB8, 0X84, 0X4E, 0X07, 0X84, 0X48, 0XE0, 0X8D, 0X4F, 0X7C,
+  0XF2, 0XC0, 0X77, 0X0A, 0XF1, 0X00, 0X22, 0X08, 0XF4, 0X84, 0XD2, 0X79,
+  0X7C, 0X79, 0X78, 0X79, 0X7B, 0X78, 0X73, 0X49, 0X03, 0XF4, 0X81, 0X88,
+  0X4D, 0X88, 0XD8, 0XC3, 0X8E, 0X5F, 0XB8, 0XD6, 0X89, 0XD8, 0X57, 0XFB,
+  0XC0, 0X59, 0XDF, 0X3F, 0X7F, 0X6F, 0X2C, 0X0F, 0X0E, 0X09, 0X48, 0X1B,
+  0X83, 0XC8, 0X50, 0X84, 0X57, 0X53, 0X06, 0X81, 0XE8, 0X9B, 0X8F, 0XF0,
+  0X18, 0XA1, 0XF8, 0XB0, 0X57, 0X28, 0X88, 0X8F, 0XF0, 0X08, 0XDD, 0X88,
+  0XFF, 0XAA, 0X06, 0X7D, 0X8A, 0X38, 0XC3, 0X8A, 0XFE, 0XCE, 0XB0, 0X63,
+  0X86, 0XAF, 0X12, 0X71, 0X44, 0X70, 0X40, 0X6A, 0X81, 0X48, 0X64, 0X72,
+  0X8E, 0X78, 0XF7, 0X8F, 0X78, 0XE5, 0X8B, 0X48, 0X6E, 0X83, 0X74, 0X90,
+  0X3A, 0X80, 0X18, 0X0C, 0X82, 0X98, 0X50, 0X86, 0XE8, 0X78, 0X86, 0XB8,
+  0X4A, 0X82, 0X4F, 0XDB, 0X06, 0X9B, 0XDD, 0XB0, 0XF0, 0XE0, 0X82, 0X7D,
+  0X84, 0X08, 0X67, 0X87, 0X27, 0XB7, 0X22, 0X05, 0X77, 0X86, 0XE8, 0XFA,
+  0X01, 0XF1, 0X88, 0X1F, 0X7C, 0X04, 0X38, 0X54, 0X8E, 0X50, 0X08, 0XE2,
+  0X8C, 0X6F, 0X5F, 0X19, 0X05, 0X38, 0X6E, 0X7E, 0X8A, 0X5A, 0X2A, 0X00,
+  0X10, 0X78, 0X4F, 0X75, 0X8C, 0X88, 0XCA, 0X8C, 0X87, 0X87, 0XA7, 0X54,
+  0X06, 0XFD, 0X81, 0X18, 0X50, 0X8A, 0X9B, 0X71, 0X8F, 0XF8, 0XE7, 0X88,
+  0XF7, 0X0B, 0X90, 0X49, 0XF5, 0X80, 0X18, 0X08, 0X81, 0X48, 0X1C, 0X81,
+  0XA8, 0X13, 0X80, 0X9F, 0X09, 0X0F, 0X0E, 0X08, 0X74, 0X83, 0X38, 0X65,
+  0X88, 0XA8, 0X8A, 0X76, 0X51, 0X04, 0X38, 0X38, 0X8B, 0XA5, 0X01, 0X8D,
+  0XD8, 0X65, 0XF3, 0XB0, 0X48, 0X21, 0X8A, 0X57, 0X18, 0XE5, 0XF7, 0XF3,
+  0XF0, 0XB0, 0X67, 0X38, 0XA5, 0X27, 0X17, 0X24, 0X66, 0X20, 0X6B, 0X81,
+  0X38, 0X6D, 0X79, 0X8F, 0XF8, 0XFC, 0X8D, 0XD8, 0XA5, 0X84, 0XB7, 0X01,
+  0X06, 0XFA, 0X80, 0XD8, 0X40, 0X88, 0XD8, 0XCD, 0X8E, 0X08, 0XC6, 0XF9,
+  0XF3, 0XB9, 0X06, 0X9F, 0X1F, 0XC8, 0X03, 0X80, 0X3F, 0X9F, 0X1B, 0X0F,
+  0X0E, 0X07, 0X37, 0XA8, 0X50, 0X88, 0X88, 0XAB, 0X7E, 0X75, 0X31, 0X04,
+  0X76, 0X86, 0X78, 0XED, 0X02, 0X8C, 0X1F, 0XBF, 0X2A, 0X90, 0X23, 0X85,
+  0X88, 0XCD, 0XF6, 0XF8, 0XF0, 0XCC, 0XA0, 0X6D, 0X88, 0X37, 0XC8, 0XC6,
+  0X74, 0X70, 0X46, 0X20, 0X7F, 0XB8, 0X29, 0X8A, 0X30, 0X03, 0X8F, 0XF8,
+  0XCF, 0X86, 0X57, 0X31, 0X07, 0XF6, 0X81, 0X28, 0X46, 0X88, 0X18, 0XA1,
+  0X89, 0XBF, 0XDE, 0XB0, 0X99, 0XBB, 0XB9, 0X0F, 0X0E, 0X07, 0X67, 0XC8,
+  0X6E, 0X8A, 0XB8, 0XC8, 0X7C, 0X71, 0X41, 0X03, 0X17, 0XA8, 0X8D, 0X7B,
+  0X02, 0X8A, 0X7F, 0XAE, 0X90, 0X31, 0X87, 0XC7, 0X9F, 0X5F, 0X2B, 0X00,
+  0XBA, 0X90, 0X5F, 0X08, 0X46, 0XD8, 0XE2, 0X75, 0X52, 0X21, 0X07, 0X98,
+  0X0D, 0X86, 0XBF, 0X10, 0X17, 0XA7, 0X44, 0X10, 0X8F, 0X58, 0X2D, 0X86,
+  0X8F, 0X9E, 0X00, 0X11, 0X0F, 0X0B, 0X11, 0X08, 0X57, 0X67, 0XE7, 0XD7,
+  0XC7, 0X64, 0X06, 0X71, 0X79, 0X02, 0XDF, 0XBF, 0X3E, 0XA0, 0X3B, 0XF3,
+  0XDF, 0X0F, 0X0C, 0XCB, 0XB9, 0X05, 0X98, 0X29, 0XF9, 0XAD, 0XDA, 0XDA,
+  0X90, 0X7D, 0X93, 0X01, 0X8C, 0X8F, 0XAF, 0X0A, 0X08, 0X27, 0XA8, 0X8C,
+  0X8B, 0XC8, 0XBA, 0X88, 0X37, 0X32, 0X0B, 0X11, 0X10, 0XF0, 0XE0, 0X7D,
+  0XF4, 0XF7, 0XF4, 0XF3, 0XF0, 0XF0, 0XEA, 0X03, 0X9F, 0XB8, 0X7F, 0XD0,
+  0X1E, 0XEE, 0XA0, 0X49, 0X84, 0X2F, 0XE0, 0X0D, 0XDA, 0XDD, 0X90, 0X67,
+  0XA7, 0X08, 0XBC, 0XFB, 0XF2, 0XEF, 0X2D, 0X08, 0X81, 0XF8, 0XAF, 0X50,
+  0X08, 0XDB, 0X8A, 0X18, 0X47, 0XF2, 0X90, 0X71, 0X82, 0X98, 0X8A, 0X8E,
+  0X28, 0XFF, 0X8E, 0XD8, 0X9B, 0X71, 0X20, 0X92, 0X70, 0X71, 0X62, 0X10,
+  0XF0, 0XB9, 0X09, 0XF1, 0X81, 0XA8, 0X50, 0X88, 0XD8, 0XB2, 0XFE, 0XF7,
+  0XF2, 0XB0, 0X4F, 0XC8, 0X45, 0X8C, 0XD0, 0X17, 0X46, 0X00, 0X90, 0X58,
+  0X18, 0X89, 0XB7, 0X97, 0X75, 0XB0, 0X09, 0X06, 0X18, 0X68, 0XF9, 0X8A,
+  0X3F, 0X2A, 0XCE, 0XA0, 0X77, 0X18, 0X70, 0X8E, 0X2F, 0XE8, 0XDB, 0X8C,
+  0X3F, 0XDF, 0X5B, 0X08, 0X81, 0XB8, 0X77, 0X8E, 0X58, 0XFF, 0X00, 0X7B,
+  0X73, 0X31, 0X08, 0X27, 0X57, 0X97, 0X77, 0X03, 0X0F, 0X0C, 0X90, 0X89,
+  0XFA, 0X83, 0X28, 0X6A, 0X89, 0X3F, 0XFF, 0X7F, 0X1A, 0X04, 0XC8, 0X1C,
+  0X89, 0X30, 0X27, 0X52, 0X90, 0X5F, 0XB8, 0X6D, 0X73, 0X8E, 0X77, 0X05,
+  0X00, 0X90, 0X62, 0X74, 0XA0, 0X02, 0X00, 0XAA, 0X90, 0X78, 0X31, 0X8A,
+  0X9F, 0X58, 0XD1, 0XF7, 0XF0, 0XDC, 0X90, 0X77, 0X38, 0X4B, 0X8B, 0X88,
+  0XFF, 0X03, 0XA9, 0X07, 0X17, 0X27, 0X77, 0X67, 0X03, 0X0F, 0X0E, 0X08,
+  0XEF, 0XC8, 0X50, 0X87, 0XAF, 0XEF, 0X7F, 0X0A, 0X05, 0XFB, 0X86, 0X8F,
+  0X40, 0X17, 0X33, 0X00, 0X90, 0X4D, 0X84, 0X7F, 0X08, 0XFF, 0X77, 0X20,
+  0X09, 0X07, 0XF5, 0X76, 0X71, 0X02, 0XA0, 0X74, 0X86, 0X47, 0XAF, 0X7F,
+  0X2D, 0XAC, 0XB9, 0X06, 0X17, 0XD8, 0X70, 0X8D, 0X80, 0X3C, 0XA0, 0X82,
+  0X70, 0X71, 0X63, 0X10, 0XF0, 0XE0, 0X8A, 0XF4, 0XFB, 0XFC, 0XF7, 0XF3,
+  0XD9, 0X05, 0XF0, 0X84, 0XA8, 0XDB, 0X01, 0X72, 0X20, 0X69, 0X82, 0XCF,
+  0XC0, 0X07, 0X84, 0X19, 0X06, 0XAF, 0XD7, 0X07, 0X43, 0X00, 0X29, 0X90,
+  0X64, 0X88, 0X35, 0XF0, 0XA0, 0X19, 0XA0, 0X73, 0X79, 0X7F, 0X7B, 0X0E,
+  0X35, 0X66, 0X53, 0X10, 0XF0, 0XE0, 0X89, 0XDF, 0X0F, 0X1D, 0XCB, 0X90,
+  0X5A, 0XFB, 0XFA, 0X01, 0X2A, 0X90, 0X6F, 0XAF, 0XC0, 0X07, 0X35, 0X01,
+  0X90, 0X59, 0XFF, 0X57, 0X44, 0X20, 0X19, 0X06, 0X27, 0X90, 0X0A, 0XBA,
+  0XAA, 0XA9, 0X06, 0X37, 0X67, 0XA7, 0X10, 0X2B, 0X00, 0X10, 0X83, 0X57,
+  0X27, 0X27, 0X04, 0X20, 0XF0, 0XE0, 0X99, 0X00, 0X32, 0X90, 0X79, 0XF4,
+  0XF4, 0X01, 0XAB, 0X90, 0X6F, 0X4F, 0XC0, 0X06, 0X22, 0X90, 0X7F, 0XDD,
+  0X75, 0X01, 0X20, 0X8D, 0XE4, 0X04, 0X99, 0X06, 0X12, 0X22, 0X02, 0XAA,
+  0X11, 0X06, 0X11, 0X24, 0X57, 0X06, 0X21, 0X0F, 0X0E, 0X09, 0X37, 0X27,
+  0X57, 0X24, 0X08, 0X17, 0X00, 0X1F, 0X4E, 0X90, 0X6C, 0XE0, 0X0B, 0XAB,
+  0X08, 0XF7, 0XF0, 0X20, 0XBC, 0X87, 0X55, 0X03, 0X29, 0X07, 0XBE, 0XEA,
+  0X03, 0X22, 0X07, 0X9A, 0X90, 0X03, 0X53, 0X20, 0XF0, 0XE0, 0X81, 0X73,
+  0X7E, 0X88, 0X67, 0XC7, 0X12, 0X10, 0X51, 0X77, 0X8E, 0X00, 0X1F, 0X9F,
+  0X0A, 0X06, 0X17, 0X30, 0X0F, 0X6F, 0X0A, 0XA0, 0X7E, 0XED, 0X00, 0XA0,
+  0X19, 0X06, 0X98, 0X51, 0X00, 0X43, 0X22, 0X00, 0X10, 0X7B, 0XF9, 0XF9,
+  0XF6, 0X03, 0XA0, 0X01, 0X07, 0XAD, 0XDB, 0X00, 0X11, 0X10, 0XF0, 0XB1,
+  0X11, 0X08, 0X27, 0XD8, 0X75, 0X8A, 0X57, 0XD7, 0X12, 0X06, 0X28, 0X5B,
+  0X8F, 0XC0, 0X0B, 0XFE, 0XF1, 0X90, 0X67, 0X08, 0XC3, 0X00, 0XFB, 0XCB,
+  0XA0, 0X9F, 0X4A, 0X2A, 0X99, 0X07, 0X83, 0X0F, 0X57, 0X04, 0X20, 0XAA,
+  0XFB, 0X86, 0X7F, 0XA0, 0X4A, 0X90, 0X7B, 0XEF, 0X2E, 0XEA, 0X90, 0XF0,
+  0XA1, 0X12, 0X09, 0X73, 0X84, 0XC8, 0X9B, 0X8C, 0X67, 0X97, 0X13, 0X06,
+  0X71, 0X88, 0XA3, 0X00, 0XFE, 0XFB, 0XE0, 0X77, 0XB7, 0XEF, 0X9F, 0X9F,
+  0X0E, 0X90, 0X74, 0XAF, 0X6D, 0XA0, 0XA8, 0X17, 0X8A, 0X37, 0X37, 0X33,
+  0X21, 0X20, 0X8F, 0X68, 0X47, 0X8B, 0X20, 0X49, 0X90, 0X7A, 0XF1, 0XF6,
+  0XF6, 0XF3, 0XDA, 0X90, 0XF0, 0XA2, 0X31, 0X10, 0X71, 0X7E, 0X87, 0X38,
+  0XC3, 0X8E, 0X27, 0X66, 0X20, 0X68, 0X22, 0X8C, 0X10, 0X18, 0XCF, 0XFA,
+  0XD9, 0X06, 0X84, 0X87, 0X18, 0XD4, 0XF2, 0XCB, 0X90, 0X73, 0XBF, 0X4A,
+  0XAA, 0X09, 0XF9, 0X87, 0X84, 0X72, 0X70, 0X34, 0X21, 0X07, 0XF0, 0X82,
+  0X88, 0X86, 0XFE, 0X01, 0XBC, 0XA9, 0X07, 0X9E, 0XF3, 0XF7, 0XF4, 0XF1,
+  0XB0, 0XF0, 0X91, 0X22, 0X10, 0X86, 0X83, 0XF8, 0X99, 0X8E, 0X27, 0X96,
+  0X12, 0X10, 0X42, 0X84, 0XD8, 0XEA, 0X01, 0XFC, 0XF2, 0XA0, 0X63, 0X87,
+  0X3F, 0X5F, 0XCF, 0X0C, 0XCA, 0X07, 0X2C, 0XA0, 0X1A, 0XA0, 0X8E, 0X84,
+  0XCF, 0X07, 0XB7, 0X54, 0X52, 0X10, 0X79, 0X81, 0X08, 0X5C, 0X8C, 0X10,
+  0X1F, 0X1E, 0XB9, 0X08, 0XBF, 0X2F, 0X4F, 0X4E, 0XA9, 0X0F, 0X09, 0X22,
+  0X10, 0X97, 0X68, 0X5C, 0X8B, 0X87, 0XB7, 0X12, 0X20, 0X67, 0X18, 0X81,
+  0X7E, 0X00, 0XF6, 0XF3, 0XF0, 0XA0, 0X67, 0X28, 0X97, 0XFA, 0XF4, 0XAA,
+  0XE9, 0X07, 0XCC, 0X71, 0X2A, 0X00, 0X99, 0X07, 0X98, 0X2A, 0XFE, 0X76,
+  0X76, 0X70, 0X44, 0X09, 0XF4, 0X83, 0XC8, 0X9D, 0X8E, 0X70, 0X0F, 0X6F,
+  0X2D, 0X90, 0X89, 0XDF, 0X2F, 0X1E, 0XB0, 0XF0, 0X81, 0X11, 0X11, 0X07,
+  0X27, 0XC8, 0X7A, 0X8D, 0X17, 0X45, 0X08, 0X82, 0X38, 0XAF, 0X01, 0XF6,
+  0XF0, 0XC9, 0X06, 0X7E, 0X8B, 0X2F, 0X6C, 0X00, 0XA9, 0X90, 0X7B, 0X00,
+  0X76, 0X52, 0X0B, 0XFE, 0X89, 0XD3, 0X7B, 0X77, 0X73, 0X63, 0X08, 0XC8,
+  0X21, 0X87, 0X28, 0XC1, 0X8E, 0X2F, 0XEF, 0X2D, 0XA0, 0X9B, 0XDE, 0XC9,
+  0X90, 0XF0, 0X92, 0X21, 0X08, 0X67, 0XF8, 0X95, 0X7F, 0X01, 0X30, 0X63,
+  0X84, 0XC8, 0XD1, 0X01, 0XDE, 0XB9, 0X06, 0X84, 0X57, 0X3F, 0X20, 0X1A,
+  0X90, 0X8E, 0XE8, 0XD1, 0X74, 0X42, 0X11, 0X08, 0XF7, 0X86, 0XEF, 0X10,
+  0X08, 0XF4, 0X8B, 0X27, 0XA5, 0X10, 0X79, 0XFF, 0X84, 0X28, 0X8C, 0X8B,
+  0X48, 0XA9, 0XFE, 0XF1, 0XA9, 0X08, 0X9C, 0XCB, 0XA0, 0XF0, 0X82, 0X23,
+  0X21, 0X07, 0X75, 0X85, 0X48, 0XB2, 0X7E, 0X01, 0X2A, 0X05, 0X74, 0X87,
+  0XA7, 0XF0, 0X0D, 0XBE, 0XC9, 0X06, 0X86, 0XA7, 0X32, 0X40, 0X04, 0X00,
+  0X10, 0X7F, 0X28, 0X8A, 0X8E, 0XF8, 0XD8, 0X72, 0X67, 0X12, 0X08, 0XE8,
+  0X39, 0X8C, 0XD0, 0X07, 0X48, 0XDD, 0X86, 0XD7, 0X41, 0X08, 0XF3, 0X81,
+  0XB8, 0X4D, 0X87, 0X58, 0X7C, 0X85, 0X5F, 0X2A, 0X0B, 0X99, 0X0F, 0X07,
+  0X13, 0X55, 0X53, 0X20, 0X52, 0X77, 0X86, 0XD8, 0XD4, 0X30, 0X12, 0X21,
+  0X04, 0X82, 0X68, 0XA1, 0X74, 0X00, 0XED, 0XCC, 0X90, 0X51, 0X71, 0X79,
+  0X72, 0X46, 0X24, 0X20, 0X7E, 0X85, 0X87, 0X48, 0XFF, 0X8D, 0X87, 0X67,
+  0X55, 0X08, 0X98, 0X11, 0X88, 0X10, 0X18, 0XFF, 0X89, 0X77, 0XA3, 0X08,
+  0X9F, 0XF8, 0X21, 0X83, 0XF8, 0X4C, 0X83, 0XCF, 0X2A, 0X0F, 0X07, 0X15,
+  0X71, 0X73, 0X71, 0X52, 0X10, 0X45, 0X7E, 0X89, 0X18, 0XF4, 0X02, 0X3A,
+  0X11, 0X03, 0X84, 0X48, 0XC6, 0X2F, 0X1F, 0X0C, 0XEB, 0X99, 0X04, 0X98,
+  0X53, 0X78, 0X7E, 0X70, 0X70, 0X64, 0X10, 0X7A, 0X82, 0X78, 0XD1, 0X00,
+  0X8F, 0XC7, 0XB7, 0X65, 0X09, 0XF8, 0X83, 0XF8, 0XCA, 0X01, 0X8B, 0X87,
+  0X92, 0X09, 0XDF, 0XF8, 0X20, 0X83, 0X0F, 0XAD, 0X90, 0XF0, 0X73, 0X67,
+  0X37, 0X47, 0X36, 0X20, 0X55, 0X78, 0X8A, 0X97, 0X40, 0X2F, 0X3C, 0XA9,
+  0X03, 0X70, 0X7E, 0XAF, 0X1F, 0X1D, 0X00, 0XA9, 0X06, 0X82, 0X7F, 0X68,
+  0XE5, 0X70, 0X00, 0X44, 0X10, 0X88, 0X0C, 0X8A, 0X10, 0X03, 0X79, 0X73,
+  0X30, 0X9A, 0X82, 0X08, 0XA1, 0X01, 0X74, 0X51, 0X0A, 0XEE, 0XA2, 0X20,
+  0XF0, 0X81, 0X21, 0X01, 0X90, 0X5A, 0XA0, 0X4E, 0XF0, 0XD9, 0X03, 0X83,
+  0X4D, 0XBA, 0X00, 0XAA, 0XA9, 0X06, 0XF8, 0XF4, 0XBA, 0X00, 0XCB, 0X90,
+  0X8A, 0X60, 0X1F, 0X7F, 0X2C, 0X0A, 0X74, 0X8C, 0X60, 0X1F, 0XFF, 0X9B,
+  0X0A, 0X73, 0X83, 0X48, 0X51, 0X84, 0X77, 0X22, 0X0F, 0X07, 0XDF, 0X6F,
+  0XE8, 0X10, 0XFE, 0XF7, 0XD9, 0X04, 0XF2, 0X81, 0XD8, 0X65, 0X8C, 0X60,
+  0X2F, 0X6F, 0X7F, 0X2A, 0X03, 0X81, 0X58, 0X97, 0X00, 0X7B, 0X78, 0X74,
+  0X71, 0X40, 0X78, 0X37, 0X79, 0X8B, 0XCF, 0X9F, 0X0E, 0XF0, 0XB0, 0X88,
+  0X3D, 0X8F, 0X7D, 0X8C, 0XD8, 0XAD, 0X85, 0XCF, 0X10, 0X97, 0X98, 0XA3,
+  0X8F, 0XF0, 0X08, 0XDD, 0X86, 0X28, 0X12, 0XC0, 0X97, 0XA8, 0X54, 0X89,
+  0X98, 0XAB, 0X87, 0X87, 0XA4, 0X0C, 0X11, 0X0F, 0X08, 0XDF, 0X5F, 0X9F,
+  0X7F, 0X0A, 0X05, 0X98, 0X00, 0X81, 0X18, 0X3F, 0X87, 0XC8, 0XA9, 0X8A,
+  0X78, 0X70, 0X82, 0X9F, 0X29, 0X03, 0XFD, 0X82, 0XD8, 0XA1, 0X00, 0X74,
+  0X8F, 0XF8, 0XCF, 0X86, 0X17, 0X51, 0X04, 0X18, 0X62, 0XF9, 0X70, 0X72,
+  0X0B, 0X83, 0X48, 0XC6, 0X8C, 0X38, 0XB8, 0X8B, 0X6F, 0X9F, 0XAD, 0X08,
+  0X81, 0XD8, 0XB4, 0X8F, 0XF0, 0X08, 0XD6, 0X88, 0XD8, 0X33, 0XF5, 0X90,
+  0X71, 0X82, 0XA8, 0X8F, 0X8E, 0XA8, 0XFF, 0X8E, 0XA7, 0XD5, 0X21, 0X08,
+  0X27, 0X37, 0X87, 0X45, 0X10, 0XF0, 0XE0, 0X7F, 0XA8, 0X03, 0X81, 0X78,
+  0X33, 0X84, 0X28, 0X35, 0XFD, 0XC0, 0X49, 0X80, 0X08, 0X19, 0X87, 0XAF,
+  0X60, 0X08, 0XFF, 0X8A, 0X18, 0X2E, 0X40, 0X49, 0X81, 0X18, 0X83, 0X8F,
+  0X78, 0XFF, 0X8D, 0XD7, 0X87, 0X52, 0X06, 0X73, 0X8A, 0X7F, 0X0F, 0XDA,
+  0X00, 0XAE, 0XA0, 0X78, 0X2F, 0X8B, 0X48, 0XE7, 0X8D, 0XD8, 0XCF, 0X8B,
+  0X68, 0X73, 0XFB, 0XC0, 0X76, 0X84, 0X48, 0XB4, 0X8F, 0XF7, 0XE0, 0X0F,
+  0X1F, 0X6B, 0X09, 0X73, 0X81, 0XE8, 0X30, 0X83, 0X38, 0X24, 0X73, 0X20,
+  0XF0, 0XE0, 0X8B, 0XFF, 0X80, 0XD8, 0X1C, 0X81, 0XEE, 0X90, 0X68, 0X00,
+  0X81, 0X88, 0X7C, 0XFE, 0X00, 0X8C, 0X17, 0XC3, 0X05, 0XFA, 0X81, 0X48,
+  0X9F, 0X00, 0X8F, 0XF8, 0XDB, 0X7D, 0X50, 0X6F, 0X28, 0X47, 0X7E, 0X8D,
+  0XB7, 0X66, 0X41, 0X07, 0X71, 0X89, 0XB8, 0XD1, 0X8C, 0X88, 0XC6, 0XF5,
+  0XF0, 0XF4, 0XD9, 0X06, 0X48, 0X38, 0X8A, 0X18, 0XFF, 0X02, 0X8C, 0X6F,
+  0XEF, 0X00, 0X87, 0X58, 0X29, 0X84, 0XB8, 0X5F, 0X85, 0XC8, 0X40, 0X74,
+  0X30, 0XF0, 0XE0, 0X99, 0XF0, 0XF0, 0XA0, 0X9F, 0XC8, 0X4D, 0X8C, 0X30,
+  0X07, 0X27, 0X32, 0X06, 0XFC, 0X85, 0X30, 0X18, 0XF2, 0X75, 0X40, 0X69,
+  0X80, 0XE8, 0XA7, 0X8F, 0XF7, 0XC5, 0X24, 0X07, 0XC6, 0X73, 0XF5, 0XB0,
+  0X0C, 0X9A, 0X07, 0X76, 0X86, 0X28, 0XCF, 0X02, 0XB8, 0XAD, 0XFA, 0XF0,
+  0X90, 0X65, 0X79, 0X84, 0X58, 0X6E, 0X88, 0X38, 0X7C, 0X7D, 0X73, 0X20,
+  0XF0, 0XE0, 0XA5, 0X72, 0X72, 0X41, 0X08, 0X67, 0XC0, 0X07, 0X00, 0X89,
+  0XF5, 0X01, 0XDA, 0X90, 0X7F, 0X28, 0X8D, 0X01, 0XA2, 0X08, 0XC8, 0X73,
+  0X50, 0X0C, 0XA0, 0XA9, 0X55, 0X02, 0XF1, 0XED, 0XA0, 0X71, 0X57, 0X17,
+  0X37, 0X37, 0X17, 0X34, 0X11, 0X0F, 0X0E, 0X09, 0X47, 0XA8, 0X38, 0X7D,
+  0X70, 0X10, 0X77, 0X58, 0X88, 0X8F, 0XF0, 0X0F, 0X4F, 0X5B, 0X06, 0X38,
+  0X73, 0X01, 0X8D, 0X4F, 0X6B, 0X07, 0X37, 0XDF, 0XBF, 0X9D, 0XAB, 0X08,
+  0X85, 0XBF, 0X10, 0X1A, 0X21, 0X08, 0XF3, 0X84, 0XA8, 0XBA, 0X02, 0X66,
+  0X52, 0X90, 0X6B, 0XF3, 0XF9, 0XFC, 0XFA, 0XF6, 0XF3, 0XC9, 0X90, 0XF0,
+  0XE0, 0X81, 0X7C, 0X84, 0X48, 0X61, 0X85, 0X37, 0X32, 0X06, 0X28, 0X46,
+  0X8E, 0X20, 0X18, 0XA7, 0XFA, 0XA0, 0X67, 0XD8, 0XC8, 0X00, 0XFB, 0X8B,
+  0XAF, 0X7C, 0X07, 0X81, 0XF8, 0XC3, 0X8C, 0X8F, 0X9C, 0XCA, 0X90, 0X78,
+  0X42, 0XF9, 0X77, 0X70, 0X22, 0X53, 0X07, 0XE8, 0X1F, 0X88, 0X1F, 0XB0,
+  0X15, 0X8C, 0X67, 0XA5, 0X10, 0X6B, 0XF9, 0X81, 0XE8, 0X3D, 0X85, 0X18,
+  0X51, 0X83, 0XAF, 0X6B, 0X0F, 0X0E, 0X08, 0X79, 0X84, 0X88, 0X81, 0X89,
+  0X58, 0X6E, 0X71, 0X10, 0X68, 0X24, 0X8B, 0X68, 0XFF, 0X00, 0XF6, 0X87,
+  0X8F, 0XBB, 0X05, 0X38, 0X70, 0X8F, 0XAF, 0XE8, 0XCA, 0XFA, 0XF6, 0XC0,
+  0X78, 0X57, 0X00, 0X8A, 0XDA, 0X00, 0XA9, 0X08, 0X81, 0XA8, 0X9F, 0X8E,
+  0X58, 0XE2, 0X7C, 0X74, 0X74, 0X61, 0X07, 0X80, 0X48, 0X37, 0X89, 0X9F,
+  0X10, 0X18, 0XDD, 0X77, 0X2A, 0X90, 0X6F, 0X08, 0X06, 0X81, 0X48, 0X22,
+  0X82, 0X48, 0X1A, 0XF7, 0XB0, 0XF0, 0XA1, 0X11, 0X08, 0X75, 0X84, 0X28,
+  0X8D, 0X8C, 0X88, 0XC6, 0X7F, 0X62, 0X05, 0X7B, 0X88, 0X88, 0XFF, 0X01,
+  0X8C, 0X38, 0X54, 0XF6, 0X90, 0X58, 0X33, 0X8C, 0X88, 0XD8, 0X8C, 0X6F,
+  0X7F, 0X1F, 0X4B, 0X06, 0X17, 0XA5, 0X74, 0X40, 0XB8, 0X02, 0X84, 0X7F,
+  0XD8, 0XFF, 0X8F, 0XF8, 0XD6, 0X88, 0XF7, 0X73, 0X07, 0XC8, 0X06, 0X83,
+  0X58, 0X8C, 0X8D, 0X6F, 0X6F, 0XCD, 0XDA, 0X08, 0XEF, 0XC8, 0X06, 0X80,
+  0X8F, 0XDF, 0X1A, 0X0F, 0X08, 0X13, 0X55, 0X21, 0X06, 0X68, 0X33, 0X88,
+  0X68, 0XD8, 0X8F, 0XF8, 0XE7, 0X74, 0X20, 0X01, 0X03, 0X68, 0X57, 0X8E,
+  0X20, 0X1F, 0X98, 0X9F, 0X83, 0XCF, 0X09, 0X04, 0X38, 0X93, 0X75, 0X8B,
+  0XCF, 0X3A, 0XCE, 0X90, 0X69, 0X83, 0X30, 0X08, 0XE5, 0X7B, 0X72, 0X43,
+  0X10, 0X7A, 0X80, 0XC8, 0X73, 0XB0, 0X08, 0XFF, 0X8B, 0XA8, 0X4A, 0X70,
+  0X08, 0XE8, 0X07, 0X83, 0X38, 0X77, 0X8A, 0X18, 0X97, 0X85, 0XBF, 0X2A,
+  0X09, 0X9E, 0XF1, 0XEA, 0X0F, 0X08, 0X26, 0X70, 0X42, 0X06, 0X17, 0XB8,
+  0X5C, 0X8B, 0XC8, 0XFF, 0X00, 0X71, 0XA9, 0X05, 0X81, 0XD8, 0X95, 0X8F,
+  0XC0, 0X18, 0XD6, 0XFB, 0XF4, 0XB0, 0X52, 0X8A, 0XB4, 0XEA, 0X00, 0XAA,
+  0X90, 0X78, 0X0E, 0X89, 0X78, 0XFF, 0X8E, 0XD7, 0X44, 0X51, 0X08, 0XF4,
+  0X83, 0X08, 0XC1, 0X01, 0X8D, 0XD8, 0X62, 0X70, 0X10, 0X8F, 0X08, 0X12,
+  0X84, 0X18, 0X6D, 0X87, 0X3F, 0XAD, 0X90, 0XF0, 0X82, 0X31, 0X20, 0X71,
+  0X72, 0X7B, 0X7C, 0X01, 0XAD, 0XD9, 0X90, 0X37, 0X77, 0XD3, 0X00, 0XF4,
+  0XF0, 0XF0, 0XC9, 0X05, 0X9F, 0X30, 0X02, 0XAA, 0XAB, 0X90, 0X7E, 0XF8,
+  0X00, 0X50, 0XC9, 0XF1, 0XF2, 0X01, 0X71, 0X62, 0X0A, 0XAC, 0XEE, 0XDA,
+  0X0F, 0X08, 0X9B, 0XBB, 0XA0, 0X7B, 0XF2, 0XF9, 0X01, 0XF6, 0XF0, 0XA0,
+  0X5A, 0XF1, 0XB0, 0X31, 0X10, 0X54, 0X7A, 0XF7, 0XC0, 0X0A, 0XC9, 0X10,
+  0X77, 0X48, 0XA9, 0X00, 0XFB, 0XF0, 0XCA, 0X09, 0X28, 0X40, 0X8D, 0X80,
+  0X1F, 0X1E, 0X0A, 0X17, 0X37, 0X87, 0X57, 0X12, 0X10, 0XF0, 0X8B, 0XCD,
+  0XC9, 0X90, 0X5A, 0XF6, 0X84, 0XB8, 0X9D, 0X8E, 0X0D, 0XF5, 0XF0, 0XB9,
+  0X04, 0XFA, 0X88, 0X4F, 0X30, 0X07, 0X47, 0X27, 0X05, 0X20, 0X55, 0X2F,
+  0X2A, 0XAA, 0XA9, 0X08, 0X83, 0X08, 0XC8, 0X8E, 0X7F, 0XCF, 0X2E, 0XC9,
+  0X08, 0X71, 0X86, 0XE8, 0XFA, 0X01, 0XFE, 0XF4, 0XC0, 0X95, 0X7E, 0X86,
+  0XB8, 0X8F, 0X7C, 0X71, 0X30, 0XF0, 0X89, 0XCD, 0XCA, 0X07, 0XF5, 0X82,
+  0X98, 0X68, 0X8A, 0X78, 0XC8, 0X8A, 0XFF, 0XEF, 0X0A, 0X04, 0XF8, 0X85,
+  0X78, 0XD4, 0X01, 0X8E, 0XF7, 0XF7, 0X64, 0X10, 0X42, 0XFC, 0X26, 0X20,
+  0X11, 0X07, 0X58, 0X72, 0X72, 0X8C, 0X6F, 0XAE, 0XEF, 0X09, 0X07, 0X18,
+  0X30, 0X8B, 0X85, 0X00, 0XF4, 0X8A, 0X5F, 0XED, 0X08, 0X17, 0XE8, 0X5E,
+  0X8A, 0X18, 0XBC, 0X8A, 0X17, 0X64, 0X10, 0XB1, 0X10, 0XF0, 0X99, 0X99,
+  0X08, 0XD8, 0X07, 0X82, 0X98, 0X55, 0X87, 0X58, 0X72, 0X84, 0X7F, 0X3A,
+  0X04, 0XF2, 0X81, 0XD8, 0X84, 0XF1, 0X00, 0X79, 0X8D, 0X18, 0X5F, 0X73,
+  0X10, 0X4F, 0X18, 0X6B, 0X77, 0X8D, 0X67, 0X94, 0X22, 0X07, 0X82, 0X68,
+  0XB8, 0X8B, 0X68, 0XAD, 0XF1, 0XAF, 0X0F, 0X09, 0X07, 0X81, 0XA8, 0X8C,
+  0X8F, 0XA0, 0X0F, 0X68, 0XCA, 0X88, 0X18, 0X2B, 0XF0, 0X90, 0X77, 0XD8,
+  0X59, 0X8B, 0X48, 0XEF, 0X8F, 0X78, 0XC6, 0X78, 0X51, 0X09, 0X36, 0X53,
+  0X10, 0XF0, 0XE0, 0X7F, 0X08, 0X03, 0X81, 0X38, 0X29, 0X83, 0X38, 0X28,
+  0XF2, 0X90, 0X58, 0X01, 0X82, 0X18, 0X83, 0XF6, 0X00, 0X8F, 0XF8, 0X91,
+  0X7D, 0X20, 0X4F, 0X08, 0X1F, 0X89, 0XD8, 0XFF, 0X8F, 0XC8, 0XD6, 0X7B,
+  0X76, 0X30, 0X68, 0X3F, 0X74, 0X00, 0X20, 0X0B, 0XAB, 0X90, 0X67, 0XB8,
+  0X7A, 0X8D, 0X6F, 0X98, 0XE0, 0X8D, 0X18, 0XAF, 0X86, 0X7F, 0X8B, 0X06,
+  0X17, 0XF8, 0X5C, 0X8C, 0X38, 0XFF, 0X79, 0X71, 0X7B, 0X32, 0X10, 0X71,
+  0X71, 0X79, 0X7D, 0X7A, 0X73, 0X41, 0X0F, 0X0E, 0X08, 0XBF, 0XB8, 0X08,
+  0X81, 0X3F, 0XBC, 0X90, 0X59, 0X80, 0X18, 0X21, 0X87, 0XD8, 0XDB, 0XD8,
+  0XAD, 0X7B, 0X40, 0X58, 0X01, 0X82, 0XE8, 0XC1, 0X38, 0XFF, 0X8D, 0X18,
+  0X67, 0X50, 0X68, 0X0E, 0X88, 0X88, 0XE2, 0X8C, 0XF7, 0X15, 0X32, 0X07,
+  0X84, 0XA8, 0XCF, 0XD8, 0XCA, 0X8C, 0X6F, 0X9F, 0X5F, 0X7F, 0X09, 0X06,
+  0X79, 0X85, 0X18, 0XB6, 0X8F, 0XF0, 0X2F, 0XEF, 0X6C, 0X07, 0X17, 0X48,
+  0X23, 0X83, 0XB8, 0X44, 0X83, 0X97, 0XB6, 0X10, 0XF0, 0XE0, 0X99, 0XDF,
+  0X0C, 0X91, 0X06, 0X98, 0X06, 0X84, 0X58, 0XA9, 0XFE, 0X72, 0X75, 0X30,
+  0X59, 0X80, 0X78, 0X6B, 0X01, 0X8F, 0X27, 0XE6, 0X06, 0XF7, 0X83, 0X4F,
+  0X78, 0XF7, 0X7A, 0X44, 0X20, 0X7F, 0X38, 0XE7, 0XF2, 0XF9, 0XF3, 0XF0,
+  0XEF, 0X1C, 0X90, 0X55, 0X83, 0X28, 0X8A, 0X8E, 0X70, 0X2F, 0X98, 0X9D,
+  0XFE, 0XF0, 0X90, 0X67, 0X18, 0X23, 0X84, 0X78, 0X65, 0X86, 0XD8, 0X58,
+  0X7B, 0X51, 0X0F, 0X0E, 0X0B, 0X22, 0X30, 0X89, 0X00, 0X47, 0X67, 0X97,
+  0X53, 0X10, 0X5B, 0XF3, 0X01, 0X21, 0X20, 0X7F, 0XAF, 0X75, 0X20, 0X0A,
+  0X90, 0X7F, 0XEF, 0X5A, 0XEA, 0XCC, 0XCB, 0X06, 0X17, 0X67, 0X86, 0X02,
+  0XFB, 0XFA, 0XF5, 0XD9, 0X05, 0X15, 0X74, 0X77, 0X77, 0X71, 0X40, 0X09,
+  0X90, 0XF0, 0XE0, 0XA5, 0X71, 0X71, 0X31, 0X07, 0X77, 0X86, 0XA8, 0XDB,
+  0X76, 0X77, 0X53, 0X06, 0X75, 0X89, 0X70, 0X1F, 0XDF, 0X49, 0X06, 0X18,
+  0X42, 0X7E, 0X8E, 0X0F, 0X7A, 0XAB, 0X07, 0X5F, 0X3F, 0X02, 0X00, 0X20,
+  0X9B, 0XFF, 0X87, 0XFF, 0XB0, 0X27, 0X15, 0X19, 0X90, 0X59, 0XF0, 0XF9,
+  0X83, 0XE8, 0X55, 0X85, 0X78, 0X42, 0XFA, 0XE9, 0X0F, 0X0E, 0X09, 0X37,
+  0X17, 0X37, 0X14, 0X10, 0X63, 0X83, 0X78, 0XA5, 0X8F, 0XF0, 0X07, 0X06,
+  0X31, 0X04, 0X28, 0X46, 0X8E, 0X20, 0X1F, 0X8F, 0X19, 0X06, 0X76, 0X89,
+  0X50, 0X08, 0XC3, 0XF0, 0XA9, 0X08, 0XD8, 0XB2, 0X79, 0X8C, 0XF7, 0X97,
+  0X27, 0X17, 0X13, 0X06, 0XB8, 0X09, 0X83, 0XC8, 0X95, 0XF9, 0X01, 0X7B,
+  0X7B, 0X5A, 0X90, 0X6F, 0X08, 0X06, 0X81, 0X58, 0X23, 0X82, 0X58, 0X1B,
+  0XFD, 0XE9, 0X0F, 0X0E, 0X09, 0X35, 0X64, 0X31, 0X06, 0X76, 0X85, 0XB8,
+  0XD1, 0X01, 0X70, 0X63, 0X05, 0X7E, 0X88, 0XD8, 0XFF, 0X01, 0XC0, 0X02,
+  0X10, 0X58, 0X3C, 0X8E, 0X5B, 0XC7, 0X06, 0X55, 0X10, 0X68, 0X0C, 0X86,
+  0X10, 0X08, 0XFF, 0X8F, 0XA8, 0XE2, 0X8B, 0XA7, 0XE7, 0X32, 0X06, 0XF2,
+  0X80, 0X98, 0X38, 0X88, 0X88, 0XD4, 0XF6, 0X8D, 0XDF, 0X7F, 0X1B, 0X90,
+  0X7E, 0XFD, 0X80, 0X58, 0X07, 0XFF, 0XF4, 0XA0, 0XF0, 0XE0, 0X93, 0X55,
+  0X33, 0X20, 0X51, 0X79, 0X87, 0XA8, 0XED, 0X01, 0X34, 0X31, 0X03, 0X38,
+  0X3B, 0X8C, 0X10, 0X42, 0X06, 0X79, 0X8F, 0XF8, 0XF2, 0X7B, 0X75, 0X72,
+  0X73, 0X70, 0X20, 0X6F, 0X48, 0X1D, 0X88, 0X1D, 0X58, 0XFF, 0X8E, 0XF8,
+  0X97, 0X83, 0X35, 0X07, 0XF2, 0X80, 0X98, 0X31, 0X86, 0XB8, 0X93, 0X89,
+  0X38, 0X68, 0XFB, 0XD0, 0X99, 0XDF, 0X0D, 0XA9, 0X0F, 0X0E, 0X08, 0X25,
+  0X73, 0X73, 0X71, 0X42, 0X10, 0X44, 0X7E, 0X8A, 0X17, 0XB0, 0X22, 0X20,
+  0X47, 0X18, 0X6D, 0X8E, 0XD0, 0X2D, 0X14, 0X10, 0X58, 0X2A, 0X8E, 0X77,
+  0X68, 0XFC, 0X8E, 0X57, 0X57, 0X37, 0X53, 0X06, 0X98, 0X03, 0X83, 0X18,
+  0XA7, 0X01, 0X79, 0X8D, 0X68, 0X59, 0X73, 0X10, 0X7F, 0X28, 0X09, 0X82,
+  0X68, 0X41, 0X84, 0XA8, 0X3B, 0XFA, 0XB9, 0X0F, 0X0E, 0X08, 0X67, 0X87,
+  0XF7, 0XF7, 0X87, 0X33, 0X05, 0X77, 0X85, 0XE8, 0XDB, 0X02, 0XF3, 0XE0,
+  0X57, 0X38, 0XBC, 0X7B, 0X01, 0XF4, 0XF2, 0X91, 0X10, 0X58, 0X0B, 0X87,
+  0XDD, 0X38, 0XFF, 0X7F, 0X78, 0X77, 0X50, 0X7B, 0X80, 0X98, 0X4D, 0X8C,
+  0XA0, 0X18, 0XF4, 0X87, 0XC7, 0X41, 0X08, 0XF2, 0X80, 0X88, 0X17, 0X81,
+  0XF8, 0X1C, 0XF4, 0XA0, 0XF0, 0XE0, 0X75, 0X7D, 0X84, 0X18, 0X67, 0X87,
+  0X08, 0X5B, 0X73, 0X30, 0X46, 0X83, 0X98, 0XA9, 0X8F, 0XF0, 0X28, 0XB6,
+  0X84, 0XCF, 0X19, 0X03, 0X70, 0X8F, 0XF0, 0X1F, 0X48, 0XDD, 0XF2, 0XE9,
+  0X06, 0XF3, 0X82, 0XA8, 0XB4, 0X01, 0X8F, 0XF7, 0XD7, 0X86, 0X08, 0XF2,
+  0X81, 0XB8, 0X77, 0X8D, 0XD0, 0X0D, 0X73, 0X71, 0X10, 0X9F, 0X0F, 0XAF,
+  0XDF, 0X9F, 0X0A, 0X0F, 0X0E, 0X06, 0X58, 0X21, 0X85, 0X18, 0X86, 0X8A,
+  0X98, 0XA1, 0X87, 0X26, 0X04, 0X28, 0X28, 0X88, 0X68, 0XFA, 0X02, 0X8E,
+  0X78, 0X7C, 0X82, 0XFF, 0X39, 0X03, 0X60, 0X1F, 0X98, 0XDB, 0XF7, 0XF4,
+  0XF1, 0XD9, 0X05, 0X98, 0X0B, 0X86, 0XD0, 0X28, 0XE2, 0X79, 0X61, 0X08,
+  0XFD, 0X84, 0X28, 0X9B, 0X8D, 0X48, 0XD1, 0XA5, 0X10, 0X99, 0XDF, 0X1F,
+  0X0D, 0X0F, 0X09, 0X12, 0X11, 0X06, 0X48, 0X20, 0X85, 0X88, 0X9D, 0X8D,
+  0X48, 0XE5, 0X8B, 0XF6, 0XDB, 0X03, 0X78, 0X86, 0XD8, 0XD4, 0X50, 0X1F,
+  0X18, 0XAB, 0X85, 0X3F, 0XEE, 0X90, 0X34, 0X8D, 0XD0, 0X0F, 0XDF, 0X7F,
+  0X2F, 0X3F, 0X1C, 0X90, 0X6F, 0X08, 0X4C, 0X8E, 0X50, 0X17, 0X67, 0X56,
+  0X09, 0XCF, 0XE8, 0X7C, 0X8B, 0X6F, 0XB9, 0X41, 0X0A, 0X9A, 0XA9, 0X90,
+  0XF0, 0X82, 0X21, 0X10, 0X61, 0X75, 0X83, 0XC8, 0X81, 0X8C, 0X88, 0XF2,
+  0X73, 0XF2, 0XFD, 0XF9, 0XE9, 0X02, 0X82, 0XE8, 0X95, 0X77, 0X01, 0XB8,
+  0XD6, 0X88, 0XFF, 0XDF, 0X4A, 0X04, 0X7E, 0XF5, 0X8E, 0X7F, 0X7F, 0X0F,
+  0X0F, 0X1F, 0X0B, 0X07, 0X37, 0X67, 0X30, 0X1A, 0XB9, 0X09, 0X27, 0X17,
+  0X07, 0X27, 0X47, 0X06, 0X20, 0XD1, 0X10, 0XF0, 0X89, 0XAA, 0XA9, 0X05,
+  0X9C, 0XF2, 0XF7, 0X8A, 0XF8, 0XCF, 0X8C, 0X68, 0X8D, 0X84, 0X4F, 0X9C,
+  0X02, 0X1E, 0XFF, 0XF3, 0X02, 0X20, 0X0C, 0XB9, 0X03, 0X38, 0X75, 0X7A,
+  0X8C, 0XFF, 0XAD, 0XBC, 0XDA, 0X07, 0X7E, 0X89, 0X17, 0X90, 0X18, 0XD1,
+  0XF9, 0XC0, 0X97, 0X78, 0X5C, 0X8B, 0X68, 0XF4, 0X8F, 0X48, 0XA1, 0X72,
+  0X30, 0XA2, 0X56, 0X42, 0X0F, 0X08, 0X99, 0X90, 0X8F, 0X48, 0X12, 0X83,
+  0XB8, 0X68, 0X88, 0X48, 0X83, 0X85, 0XE8, 0X29, 0XF3, 0X90, 0X29, 0X80,
+  0XA8, 0X40, 0X8A, 0X5B, 0X00, 0X38, 0XFA, 0X8A, 0X97, 0X31, 0X04, 0X58,
+  0XA1, 0X76, 0XD3, 0X20, 0X02, 0X00, 0XA9, 0X05, 0X72, 0X85, 0X18, 0XD1,
+  0X01, 0X8E, 0X58, 0XB6, 0XF8, 0XD0, 0X85, 0X83, 0X98, 0XA9, 0X8F, 0XF7,
+  0X47, 0X48, 0XBC, 0X72, 0X31, 0X08, 0X37, 0X67, 0XE8, 0X21, 0X7A, 0X70,
+  0X20, 0XF0, 0XE0, 0X59, 0XFB, 0X80, 0X98, 0X23, 0X83, 0XC8, 0X47, 0X83,
+  0XCF, 0X4A, 0X90, 0X3F, 0X38, 0X05, 0X83, 0X38, 0X9D, 0X01, 0X58, 0XDB,
+  0X85, 0XF5, 0X04, 0XF1, 0X83, 0X78, 0XBA, 0X8E, 0X58, 0XDD, 0X77, 0X73,
+  0X75, 0X70, 0X90, 0X67, 0XE8, 0X99, 0X8F, 0X2F, 0X48, 0XE0, 0XFD, 0XF4,
+  0XF1, 0XB0, 0X71, 0X81, 0XE8, 0X81, 0X8F, 0XF0, 0X28, 0X9D, 0XFB, 0XC0,
+  0X84, 0X82, 0X08, 0X4A, 0X87, 0X08, 0X75, 0X85, 0X48, 0X25, 0X60, 0XF0,
+  0XE0, 0X7F, 0X28, 0X02, 0X81, 0X28, 0X23, 0XFC, 0XA0, 0X6D, 0X80, 0X08,
+  0X19, 0X87, 0XCF, 0X90, 0X08, 0XFF, 0X88, 0XC7, 0X91, 0X04, 0X80, 0X08,
+  0X11, 0X88, 0X88, 0XFF, 0X8F, 0XF8, 0XE5, 0X8B, 0XC7, 0XF4, 0X06, 0X80,
+  0X37, 0X37, 0X68, 0XD4, 0XFF, 0XF2, 0X43, 0XA0, 0X75, 0X84, 0XD8, 0XD8,
+  0X02, 0X8C, 0XA8, 0X5F, 0X81, 0X8F, 0X09, 0X06, 0X28, 0X23, 0X86, 0XD8,
+  0XC6, 0X8F, 0XF8, 0XFC, 0X8B, 0X48, 0X54, 0X76, 0X20, 0X92, 0X55, 0X31,
+  0X0F, 0X0E, 0X08, 0XAF, 0X3D, 0X57, 0X15, 0X10, 0X68, 0X01, 0X82, 0XC8,
+  0XAF, 0X01, 0X8A, 0XB7, 0X62, 0X05, 0XFA, 0X80, 0XF8, 0XAD, 0X00, 0X8F,
+  0XF7, 0XC7, 0XB6, 0X06, 0XB8, 0X0E, 0X8D, 0X47, 0X7C, 0XA5, 0X50, 0X09,
+  0X06, 0XB8, 0X64, 0X8E, 0XF0, 0X18, 0XE7, 0X8A, 0X7F, 0XDF, 0X29, 0X07,
+  0X75, 0X85, 0X38, 0XC3, 0X8F, 0XF0, 0X03, 0X8C, 0XF7, 0X77, 0X01, 0X08,
+  0X57, 0X87, 0XE7, 0XE7, 0X64, 0X0F, 0X0E, 0X08, 0X38, 0X24, 0X84, 0XD8,
+  0X5E, 0X84, 0X07, 0X11, 0X06, 0X48, 0X64, 0X8F, 0XA0, 0X18, 0X8D, 0XF7,
+  0XA0, 0X67, 0X48, 0XD4, 0X00, 0X8E, 0X08, 0XB8, 0XF5, 0XC0, 0X7F, 0X28,
+  0XB2, 0XFC, 0XF5, 0XF3, 0XF2, 0XD9, 0X07, 0XB8, 0X39, 0X8D, 0X40, 0X1D,
+  0X01, 0X99, 0X07, 0XEF, 0X88, 0XA9, 0X02, 0XF9, 0XF4, 0XE9, 0X08, 0XAD,
+  0XEF, 0X0D, 0XA0, 0XF0, 0X91, 0X11, 0X09, 0X7C, 0X85, 0X48, 0XA1, 0X8C,
+  0XA8, 0XB4, 0X86, 0X57, 0X11, 0X05, 0X7B, 0X89, 0X38, 0XFF, 0X5D, 0X8B,
+  0X28, 0X48, 0XFF, 0XA0, 0X58, 0X17, 0X8B, 0XCF, 0X08, 0XBF, 0X8B, 0XAF,
+  0XCF, 0XFE, 0X07, 0X73, 0XF4, 0X72, 0X77, 0X50, 0X09, 0X09, 0X80, 0X78,
+  0X61, 0XFE, 0X00, 0X8F, 0XF8, 0XDD, 0X86, 0XE7, 0X62, 0X07, 0XF1, 0X80,
+  0X68, 0X2C, 0X86, 0XD8, 0XA5, 0X8B, 0X28, 0X7F, 0X83, 0X4F, 0X6A, 0X08,
+  0XBF, 0X5F, 0XDF, 0XBF, 0X4B, 0X0F, 0X07, 0X47, 0X67, 0XC7, 0XC7, 0X44,
+  0X10, 0X57, 0X38, 0X40, 0X89, 0XF8, 0XF7, 0X8F, 0XF8, 0XFF, 0X8D, 0XB7,
+  0X12, 0X10, 0X31, 0X84, 0XC8, 0XC8, 0X8E, 0XFF, 0XB8, 0XDB, 0X8B, 0XF8,
+  0X7A, 0X82, 0X5F, 0X10, 0X51, 0X86, 0X18, 0XD8, 0XF0, 0XDA, 0XEF, 0X2B,
+  0X07, 0XF8, 0X82, 0XBF, 0XB8, 0XFF, 0X8F, 0XF8, 0XCA, 0X7D, 0X60, 0X8F,
+  0X08, 0X02, 0X83, 0X18, 0XA5, 0X00, 0X8F, 0XF8, 0XBC, 0X84, 0X07, 0X00,
+  0X8E, 0X80, 0X08, 0X06, 0X81, 0X98, 0X2B, 0X82, 0X88, 0X11, 0XF0, 0X0C,
+  0X90, 0XF0, 0X51, 0X76, 0X82, 0X38, 0X3D, 0X84, 0X78, 0X3E, 0X82, 0X47,
+  0X11, 0X04, 0X81, 0X78, 0X5B, 0X8B, 0XF8, 0XFF, 0X71, 0X01, 0X8B, 0X48,
+  0X55, 0XD0, 0X47, 0X08, 0XC3, 0X8F, 0X78, 0XCA, 0X8C, 0X8F, 0XEF, 0XDF,
+  0XEF, 0X4A, 0X05, 0X98, 0X0A, 0X88, 0XA8, 0XFF, 0X8F, 0X27, 0X96, 0X0A,
+  0X80, 0X08, 0X26, 0X8C, 0X80, 0X08, 0XFF, 0X8A, 0X97, 0XA1, 0X08, 0XA8,
+  0X00, 0X81, 0XC8, 0X73, 0X8C, 0X1F, 0X17, 0X63, 0X0A, 0XE8, 0X00, 0X80,
+  0X48, 0X09, 0XF4, 0X90, 0XF0, 0X42, 0X78, 0X82, 0XF8, 0X58, 0X87, 0X88,
+  0X81, 0X86, 0XA8, 0X3C, 0X71, 0X20, 0X33, 0X85, 0X48, 0XAD, 0X8F, 0X20,
+  0X1F, 0X68, 0XC3, 0X87, 0XA8, 0X3A, 0XE0, 0X4F, 0X08, 0X70, 0X01, 0XF2,
+  0XF3, 0XF1, 0XF2, 0XD0, 0X7F, 0X38, 0X31, 0XF9, 0X76, 0X7C, 0X43, 0X0A,
+  0X80, 0X58, 0X70, 0X01, 0X8D, 0X17, 0X91, 0X0A, 0X80, 0X58, 0X3E, 0X88,
+  0XC8, 0X9D, 0X32, 0X0C, 0XBD, 0XA0, 0XF0, 0X42, 0X70, 0X74, 0X73, 0X4A,
+  0XBC, 0XA9, 0X03, 0X27, 0XA7, 0X4D, 0X00, 0XDF, 0X9F, 0X4F, 0X0A, 0X06,
+  0XEF, 0X3F, 0X0F, 0X0C, 0XAC, 0X90, 0X87, 0X17, 0X60, 0X0F, 0X0E, 0XB0,
+  0XA3, 0X88, 0XA0, 0X1C, 0X00, 0X10, 0XA5, 0X77, 0X78, 0X71, 0X41, 0X10,
+  0XF0, 0X4B, 0XF7, 0X81, 0XC8, 0X35, 0X84, 0X88, 0X48, 0X83, 0X48, 0X1A,
+  0XF3, 0XA0, 0X39, 0X83, 0XE8, 0X8D, 0XF9, 0X00, 0X58, 0XFF, 0X8E, 0X28,
+  0X99, 0X77, 0X19, 0X03, 0X74, 0X8B, 0X68, 0XD6, 0XF8, 0X22, 0X00, 0X11,
+  0X07, 0X71, 0X89, 0X33, 0X8E, 0X5F, 0XEE, 0XD0, 0XA8, 0X35, 0X8E, 0X70,
+  0X18, 0XAB, 0XF5, 0X90, 0X91, 0X82, 0XC8, 0X86, 0X8C, 0XF7, 0XE4, 0X20,
+  0XC3, 0X31, 0X0F, 0X04, 0X9F, 0X28, 0X03, 0X80, 0XA8, 0X11, 0X81, 0X18,
+  0X0C, 0XFE, 0XF0, 0X90, 0X3C, 0X80, 0XC8, 0X3B, 0X88, 0X68, 0XD8, 0X01,
+  0X7E, 0X73, 0XCE, 0XA0, 0X38, 0X2A, 0X79, 0XA8, 0XD1, 0X8D, 0X17, 0X77,
+  0X57, 0X57, 0X01, 0X05, 0X38, 0X62, 0X8E, 0X78, 0XDB, 0X8C, 0X1F, 0X0E,
+  0XB0, 0X98, 0X1D, 0X8B, 0X68, 0XFF, 0X00, 0XF9, 0X88, 0X3F, 0X59, 0X09,
+  0X81, 0XC8, 0X7C, 0X8E, 0X28, 0XFF, 0X7C, 0X0D, 0X67, 0X27, 0X13, 0X0F,
+  0X06, 0XBF, 0X3F, 0X9F, 0X9F, 0X4D, 0X90, 0X5F, 0X58, 0X05, 0X82, 0X48,
+  0X5E, 0X89, 0XD8, 0XC1, 0X8B, 0X68, 0X78, 0XFD, 0XE9, 0X03, 0X80, 0XD8,
+  0X59, 0X8B, 0XC8, 0XFF, 0X8F, 0XF8, 0XFA, 0X8D, 0X18, 0X83, 0X76, 0X20,
+  0X58, 0X2E, 0X8E, 0X2D, 0X8C, 0X32, 0X40, 0XA7, 0X78, 0X7F, 0X8F, 0XF0,
+  0X18, 0XC8, 0X86, 0XBF, 0X00, 0X97, 0X78, 0X61, 0X8E, 0X28, 0XFF, 0X00,
+  0X2F, 0X1B, 0X0A, 0X71, 0X79, 0X7D, 0X76, 0X41, 0X0F, 0X08, 0X99, 0X90,
+  0X8D, 0X80, 0X38, 0X1E, 0X85, 0X08, 0X78, 0X88, 0X18, 0X5E, 0XF1, 0X90,
+  0X4F, 0X68, 0X0E, 0X85, 0XC8, 0XDB, 0X00, 0X58, 0XFA, 0X8A, 0X37, 0X83,
+  0X05, 0XF2, 0X76, 0X76, 0X75, 0X55, 0X40, 0X09, 0X06, 0X28, 0X3D, 0X8C,
+  0XD0, 0X18, 0XE7, 0XFB, 0XF5, 0XE0, 0X83, 0X83, 0X48, 0XB4, 0X8F, 0XF0,
+  0X1F, 0XEF, 0XAC, 0X90, 0X87, 0X07, 0XE8, 0X35, 0X83, 0XE7, 0XA5, 0X10,
+  0XF0, 0XE0, 0X6B, 0XF6, 0XF8, 0XE2, 0X70, 0X41, 0X05, 0XF5, 0X83, 0X28,
+  0XB2, 0X01, 0X52, 0X99, 0X05, 0X80, 0XA8, 0XAB, 0X57, 0X75, 0X01, 0XB9,
+  0X06, 0X18, 0X5E, 0X8E, 0X70, 0X0F, 0X6F, 0X8F, 0X2F, 0X1B, 0X90, 0X77,
+  0X18, 0X55, 0X8D, 0XD0, 0X28, 0X9F, 0XF7, 0XB0, 0X81, 0X72, 0X7F, 0X85,
+  0X18, 0X55, 0X75, 0X30, 0XF0, 0XA1, 0X09, 0X17, 0X68, 0X5F, 0X89, 0X98,
+  0XA9, 0X87, 0XD7, 0X21, 0X06, 0X72, 0X8C, 0XA0, 0X1F, 0XE8, 0X8D, 0XF6,
+  0XA0, 0X5E, 0XF9, 0XDF, 0X5F, 0X0D, 0XCB, 0X90, 0X6A, 0XFF, 0XF8, 0X00,
+  0XBC, 0XAA, 0XA0, 0X8B, 0XEF, 0X00, 0X2F, 0X1D, 0X90, 0XB2, 0X31, 0X99,
+  0X0F, 0X08, 0X13, 0X21, 0X08, 0X74, 0X84, 0X78, 0X9B, 0X8D, 0X18, 0XD1,
+  0X7D, 0X61, 0X10, 0X47, 0X18, 0X70, 0X8F, 0X20, 0X0D, 0X8C, 0XAF, 0XEF,
+  0X4A, 0X05, 0X17, 0X9F, 0X6F, 0XEF, 0X5C, 0XCB, 0X90, 0X69, 0X82, 0X08,
+  0XAF, 0X00, 0X76, 0X42, 0X0A, 0XE8, 0X2F, 0X8A, 0X90, 0X27, 0X13, 0X09,
+  0X9F, 0X1F, 0X9F, 0XBF, 0X7F, 0X1A, 0X0F, 0X07, 0X27, 0X07, 0X05, 0X21,
+  0X06, 0X68, 0X37, 0X88, 0XF8, 0XE0, 0X8F, 0XF8, 0XED, 0X61, 0X05, 0X18,
+  0X37, 0X8B, 0XC7, 0X1F, 0X98, 0XD8, 0X8B, 0X2F, 0XFF, 0X19, 0X05, 0X1A,
+  0XF5, 0XCA, 0XCE, 0XC9, 0X07, 0X80, 0X88, 0X75, 0X00, 0X37, 0X85, 0X41,
+  0X08, 0XA8, 0X12, 0X86, 0XDF, 0X90, 0X17, 0X55, 0X10, 0X9E, 0XFA, 0X82,
+  0X9F, 0XFF, 0X4B, 0X90, 0XF0, 0X63, 0X74, 0X76, 0X74, 0X63, 0X06, 0X28,
+  0X29, 0X87, 0XD8, 0XDB, 0X8F, 0XF0, 0X05, 0XAB, 0X05, 0X72, 0X89, 0X38,
+  0XD8, 0X8D, 0X88, 0XD1, 0XFE, 0XFA, 0XF8, 0XE9, 0X05, 0XA8, 0X7C, 0X70,
+  0X77, 0X20, 0X0B, 0XC0, 0X8F, 0X08, 0X3C, 0X8D, 0XD0, 0X07, 0XE7, 0X66,
+  0X10, 0X9F, 0X88, 0X3D, 0X8B, 0X80, 0X17, 0X27, 0X11, 0X09, 0XAF, 0X4F,
+  0XBF, 0XAF, 0X4B, 0X0F, 0X05, 0X17, 0X07, 0X47, 0X67, 0X25, 0X10, 0X67,
+  0X98, 0X57, 0X8B, 0X48, 0XFC, 0X01, 0XF1, 0XF2, 0XC9, 0X04, 0X7B, 0X8C,
+  0X8F, 0X2F, 0XEF, 0X7F, 0X0F, 0X1F, 0X1B, 0X06, 0XB8, 0X55, 0X57, 0X92,
+  0XAC, 0X90, 0X89, 0X81, 0XE8, 0XBA, 0X00, 0X37, 0X97, 0X12, 0X09, 0XB8,
+  0X22, 0X88, 0XCF, 0X40, 0X02, 0X51, 0X0A, 0XDF, 0X4F, 0X6F, 0X0A, 0X0F,
+  0X05, 0X37, 0X07, 0X37, 0X27, 0X15, 0X21, 0X04, 0X27, 0XA8, 0X72, 0X8C,
+  0XD3, 0X01, 0XF6, 0XF4, 0XE0, 0X57, 0XA7, 0XCF, 0X0C, 0XCE, 0XF1, 0XF2,
+  0XB0, 0X7F, 0X33, 0X75, 0X50, 0X0A, 0XB9, 0X08, 0XF3, 0X8A, 0X10, 0X17,
+  0X56, 0X20, 0XAF, 0X68, 0X70, 0X8D, 0X6D, 0XA3, 0X10, 0XAA, 0XEF, 0X1D,
+  0XA0, 0XF0, 0X41, 0X57, 0X47, 0XA7, 0XC7, 0X67, 0X03, 0X10, 0X43, 0X7E,
+  0X88, 0XF7, 0XE0, 0X1B, 0XF9, 0XF5, 0XC9, 0X04, 0X74, 0X2F, 0X2F, 0X2B,
+  0XCD, 0XDA, 0X06, 0X9F, 0X7F, 0X17, 0X45, 0X0C, 0XF1, 0X88, 0X60, 0X17,
+  0X57, 0X12, 0X0A, 0XF2, 0X85, 0X88, 0XBA, 0XF6, 0X24, 0X20, 0XBB, 0XBA,
+  0X0F, 0X04, 0X15, 0X71, 0X73, 0X70, 0X52, 0X06, 0X57, 0XC7, 0XD5, 0X01,
+  0XF3, 0XF0, 0XA0, 0X61, 0XDB, 0XAC, 0XBA, 0X99, 0X07, 0XF3, 0XD7, 0X34,
+  0X20, 0X09, 0X09, 0XCF, 0X80, 0X16, 0X21, 0X0A, 0XBF, 0X1C, 0X26, 0X51,
+  0X10, 0XB1, 0X11, 0X0F, 0X04, 0X9C, 0XEF, 0X3F, 0X3F, 0X0C, 0X99, 0X04,
+  0XBF, 0X5F, 0X7D, 0X01, 0X71, 0X70, 0X41, 0X05, 0XF1, 0X00, 0X30, 0X13,
+  0X22, 0X10, 0X9F, 0X1C, 0XA0, 0X01, 0X09, 0X17, 0X30, 0X1F, 0X1D, 0X90,
+  0XA3, 0X75, 0X7D, 0X79, 0X73, 0X31, 0X0B, 0X35, 0X53, 0X10, 0XF0, 0X49,
+  0XCF, 0X2F, 0X5F, 0X3F, 0X1B, 0X90, 0X5C, 0XFD, 0X87, 0XDF, 0XA0, 0X15,
+  0X70, 0X51, 0X05, 0X9A, 0X00, 0X22, 0X00, 0X12, 0X10, 0X61, 0X7B, 0X71,
+  0XF3, 0XF0, 0XB0, 0XB7, 0X18, 0X9B, 0X01, 0XF6, 0XF1, 0XA0, 0XA7, 0X17,
+  0XF8, 0XE5, 0X00, 0X40, 0XC1, 0X46, 0X70, 0X31, 0X0F, 0X05, 0XAD, 0XEE,
+  0XBA, 0X90, 0X59, 0XF3, 0XF6, 0XF4, 0X02, 0X43, 0X20, 0X54, 0XD2, 0X42,
+  0X00, 0X21, 0X07, 0X17, 0XF5, 0XF6, 0XBA, 0XBA, 0X09, 0X73, 0X8B, 0X20,
+  0X1F, 0X2E, 0XA0, 0XA7, 0X27, 0XA7, 0X60, 0X0A, 0XB0, 0XC3, 0X54, 0X20,
+  0XF0, 0X5A, 0XCE, 0XF0, 0XDB, 0X90, 0X59, 0XF0, 0XF7, 0XF5, 0XD0, 0X13,
+  0X42, 0X10, 0X44, 0XC2, 0X23, 0X22, 0X10, 0X72, 0X7B, 0X2F, 0X0A, 0X01,
+  0XA9, 0X08, 0X75, 0X7D, 0X01, 0XF2, 0XEB, 0X09, 0X17, 0X37, 0XB7, 0X60,
+  0X0D, 0XEA, 0X0A, 0X25, 0X70, 0X51, 0X0F, 0X05, 0XAE, 0XF4, 0XF5, 0XF3,
+  0XEA, 0X90, 0X49, 0XF5, 0X84, 0X88, 0X9D, 0XFC, 0X01, 0X70, 0X50, 0X09,
+  0X04, 0XF4, 0XF5, 0X73, 0X75, 0X70, 0X64, 0X52, 0X06, 0X38, 0X84, 0XDF,
+  0X4A, 0X00, 0XAA, 0X08, 0X18, 0X3E, 0X8E, 0X50, 0X0D, 0XFB, 0XF4, 0XB0,
+  0X92, 0X83, 0XF8, 0XBF, 0X01, 0XF8, 0XF5, 0XC9, 0X09, 0X57, 0X57, 0X77,
+  0X01, 0X0F, 0X06, 0XDF, 0X3F, 0X5F, 0X4F, 0X0B, 0X06, 0XF3, 0X82, 0X88,
+  0X70, 0X8B, 0XCF, 0X60, 0X0A, 0X00, 0X10, 0X09, 0X03, 0XFC, 0X89, 0XF7,
+  0X27, 0XE7, 0X77, 0X27, 0X37, 0X12, 0X06, 0X71, 0X8A, 0X9F, 0X5F, 0X7A,
+  0X00, 0XA9, 0X90, 0X74, 0X86, 0XB8, 0XFF, 0X00, 0X8E, 0X2F, 0XAF, 0X5C,
+  0X09, 0X74, 0X86, 0XE8, 0XF4, 0X01, 0X89, 0X5F, 0XBB, 0X09, 0X27, 0X67,
+  0XE7, 0XC7, 0X11, 0X90, 0XF0, 0X69, 0XDF, 0X1F, 0X0D, 0XA9, 0X05, 0XCF,
+  0XF8, 0X45, 0X88, 0XD8, 0XCD, 0X8E, 0X2F, 0XCF, 0X2C, 0X90, 0X4F, 0X58,
+  0X77, 0XD7, 0XB7, 0XC7, 0XA7, 0X37, 0X25, 0X10, 0X57, 0XB8, 0XC8, 0XF9,
+  0XE0, 0X0A, 0XDC, 0X08, 0X78, 0X8A, 0X30, 0X0B, 0XFE, 0XF7, 0XF4, 0XB0,
+  0X81, 0X82, 0X88, 0XA9, 0X74, 0X00, 0XF4, 0X87, 0X5F, 0X7B, 0X09, 0X70,
+  0X7D, 0X84, 0XC7, 0X92, 0XA0, 0XF0, 0X79, 0XBB, 0XA9, 0X07, 0XF3, 0X82,
+  0XC8, 0X68, 0X8A, 0X58, 0XC3, 0XFE, 0XF3, 0XB0, 0X5D, 0X85, 0XBF, 0X47,
+  0X67, 0XE7, 0X77, 0X87, 0X55, 0X10, 0X58, 0X39, 0X79, 0XF3, 0X02, 0X9A,
+  0X08, 0X83, 0X08, 0XCD, 0X00, 0X8E, 0X5F, 0X5F, 0X2F, 0X2A, 0X08, 0X38,
+  0X4A, 0X8D, 0XB0, 0X18, 0XD8, 0X85, 0X9F, 0X39, 0X08, 0X17, 0X57, 0XE7,
+  0XC7, 0X1A, 0XB9, 0X0F, 0X08, 0X99, 0X90, 0X8B, 0XF5, 0XFD, 0X88, 0XCF,
+  0XFF, 0XCF, 0X10, 0X61, 0XF0, 0XF0, 0X33, 0X79, 0X77, 0X73, 0X61, 0X05,
+  0X85, 0XB3, 0XC2, 0X01, 0XC9, 0X07, 0X28, 0X4F, 0X7E, 0XBF, 0X8F, 0X2F,
+  0X2F, 0X09, 0X08, 0X71, 0X86, 0X78, 0XF2, 0X01, 0XFB, 0XF7, 0XC0, 0X92,
+  0X72, 0X73, 0X5D, 0XF0, 0XC0, 0XF0, 0X99, 0X09, 0X9E, 0XF6, 0XFD, 0XFD,
+  0XF5, 0XA4, 0X21, 0X03, 0X54, 0XD0, 0X17, 0X67, 0X47, 0X36, 0X10, 0X42,
+  0X88, 0X40, 0X0A, 0X01, 0XA9, 0X08, 0X48, 0X67, 0X71, 0XDD, 0XAE, 0XC0,
+  0X96, 0X79, 0X71, 0X01, 0XF5, 0XF0, 0XA0, 0X91, 0X3A, 0XF4, 0XF4, 0XF1,
+  0XA0, 0XF0, 0XE0, 0X5A, 0XF0, 0XF7, 0XFC, 0XFA, 0XF3, 0X00, 0X43, 0X04,
+  0X2C, 0XF1, 0XB0, 0X17, 0XA7, 0X97, 0X33, 0X04, 0X68, 0XA9, 0X24, 0X20,
+  0X21, 0X07, 0X67, 0XC7, 0X1D, 0XCA, 0XBA, 0X90, 0X86, 0X75, 0X50, 0X1E,
+  0XD9, 0X09, 0X11, 0XAD, 0XF0, 0XC9, 0X90, 0XF0, 0XE0, 0X5A, 0XF3, 0XFE,
+  0XFF, 0XFE, 0XF5, 0X00, 0X42, 0X04, 0XF0, 0X83, 0XD8, 0X95, 0XF3, 0X01,
+  0X7B, 0X7C, 0X74, 0X31, 0X03, 0X57, 0X20, 0X07, 0X27, 0X24, 0X25, 0X31,
+  0X06, 0X75, 0X89, 0X52, 0XF4, 0XDD, 0XA9, 0X08, 0X17, 0X68, 0X9B, 0X02,
+  0XF4, 0XDA, 0X90, 0X84, 0X71, 0X71, 0X70, 0X29, 0X0F, 0X0E, 0X06, 0XF0,
+  0XFA, 0X83, 0X38, 0X5B, 0XF9, 0XB6, 0X31, 0X03, 0XF1, 0X81, 0XD8, 0X67,
+  0X8C, 0XF0, 0X17, 0X48, 0XB4, 0X77, 0X40, 0X4D, 0X89, 0X1D, 0X77, 0X74,
+  0X70, 0X70, 0X65, 0X06, 0X18, 0X30, 0X8B, 0X6F, 0X3F, 0XCF, 0X2A, 0X0A,
+  0X38, 0X41, 0X8C, 0X60, 0X1D, 0XFB, 0XF2, 0XA0, 0X81, 0X75, 0X84, 0X18,
+  0X67, 0X87, 0X27, 0X54, 0X0F, 0X0E, 0X06, 0XAF, 0X5F, 0XCF, 0XEF, 0X50,
+  0X05, 0X41, 0X03, 0XAF, 0XF8, 0X37, 0X89, 0X7D, 0X01, 0X7F, 0X76, 0X30,
+  0X4E, 0X84, 0XC8, 0XB8, 0X78, 0X7C, 0X72, 0X47, 0X26, 0X10, 0X51, 0X85,
+  0X78, 0XD1, 0XFF, 0XFA, 0XD0, 0XB7, 0X78, 0X70, 0X8E, 0XF0, 0X18, 0XE0,
+  0XFF, 0XF3, 0XA0, 0X85, 0X82, 0XE8, 0X68, 0X89, 0X18, 0X93, 0X7B, 0X61,
+  0X10, 0XF0, 0XE0, 0X7D, 0XF2, 0XF1, 0XA5, 0X62, 0X05, 0XE8, 0X1A, 0X86,
+  0XEF, 0XE0, 0X15, 0X10, 0X5A, 0X81, 0XE8, 0X88, 0X27, 0X97, 0X34, 0X22,
+  0X06, 0X18, 0X7D, 0X73, 0XFE, 0XF6, 0XCC, 0X99, 0X07, 0X28, 0X2F, 0X8A,
+  0X77, 0X90, 0X0F, 0X18, 0XC6, 0XFA, 0XF0, 0X90, 0X71, 0X79, 0X85, 0X38,
+  0X97, 0X8B, 0X88, 0XAD, 0X76, 0X31, 0X0B, 0X11, 0X0F, 0X0E, 0X08, 0X17,
+  0X17, 0X67, 0X32, 0X06, 0X9F, 0X1F, 0X3B, 0X01, 0XF5, 0XF2, 0XB0, 0X5F,
+  0X98, 0X6E, 0XA5, 0X01, 0XCB, 0X07, 0X78, 0XDF, 0X4C, 0XA0, 0X0C, 0X90,
+  0X76, 0X85, 0X08, 0XC6, 0X01, 0XF6, 0XF5, 0XF1, 0XB0, 0X83, 0X7B, 0X86,
+  0XE8, 0XAF, 0X7B, 0X74, 0X10, 0XC1, 0X0F, 0X0E, 0X07, 0X27, 0X37, 0XA7,
+  0X87, 0X13, 0X90, 0X62, 0X77, 0X79, 0X01, 0XF8, 0XF3, 0XC9, 0X04, 0XA0,
+  0X02, 0XF1, 0XF0, 0XED, 0XB9, 0X05, 0X13, 0XF0, 0XD0, 0X1A, 0XBA, 0X07,
+  0X57, 0X87, 0X20, 0X1D, 0XA9, 0X90, 0X83, 0X70, 0X72, 0X50, 0X0C, 0X9A,
+  0X90, 0XF0, 0XE0, 0X74, 0X77, 0X7C, 0X79, 0X72, 0X19, 0X06, 0X73, 0X88,
+  0XA7, 0X60, 0X1F, 0XAF, 0X1A, 0X05, 0X37, 0X83, 0XF3, 0XF0, 0XDB, 0XB0,
+  0X62, 0X4F, 0X0C, 0XBA, 0XAA, 0XA0, 0X71, 0X20, 0X22, 0X21, 0X0A, 0X9D,
+  0XF0, 0XF0, 0XAA, 0X0F, 0X0E, 0X07, 0X70, 0X79, 0X7B, 0X79, 0X70, 0X10,
+  0X61, 0X77, 0X8A, 0X50, 0X1F, 0X4F, 0X5F, 0X09, 0X05, 0X67, 0XBD, 0XF5,
+  0XF3, 0XCA, 0XB0, 0X7A, 0XD0, 0XDB, 0XF2, 0XF0, 0X01, 0X62, 0X32, 0X08,
+  0XAE, 0XF3, 0XF1, 0XF0, 0XF0, 0XB0, 0XE9, 0X0F, 0X0A, 0X11, 0X08, 0X17,
+  0X17, 0X87, 0X97, 0X57, 0X13, 0X20, 0X52, 0X79, 0X8B, 0XC0, 0X1F, 0X3F,
+  0X4C, 0X90, 0X57, 0X17, 0X5F, 0X1F, 0X5A, 0XAB, 0X90, 0X6A, 0XF4, 0XA2,
+  0X03, 0X10, 0X7C, 0XF9, 0XF5, 0X01, 0X25, 0X32, 0X08, 0XAF, 0X0F, 0X3F,
+  0X3E, 0XC0, 0XD9, 0X0F, 0X09, 0X10, 0XA1, 0X71, 0X76, 0X78, 0X76, 0X64,
+  0X10, 0X53, 0X78, 0X7A, 0X01, 0XF1, 0XEC, 0X06, 0X70, 0X71, 0XF0, 0XF0,
+  0XC0, 0X99, 0XF7, 0XA2, 0X02, 0X21, 0X07, 0XBF, 0X5F, 0X30, 0X13, 0X24,
+  0X11, 0X07, 0X9D, 0XF0, 0XEC, 0XA0, 0X01, 0X10, 0XB9, 0X0F, 0X0A, 0X10,
+  0X92, 0X71, 0X75, 0X75, 0X72, 0X61, 0X06, 0X37, 0X67, 0X20, 0X1F, 0X0D,
+  0XA9, 0X05, 0X66, 0XCF, 0X0A, 0X00, 0XA9, 0X06, 0X9F, 0X7B, 0X30, 0X22,
+  0X08, 0XAF, 0X2F, 0X40, 0X12, 0X31, 0X20, 0X89, 0XCE, 0XCD, 0XAA, 0X99,
+  0X0F, 0X0C, 0X10, 0X73, 0X72, 0X76, 0X76, 0X73, 0X20, 0X09, 0X05, 0X47,
+  0X87, 0X50, 0X1F, 0X3D, 0XA9, 0X05, 0X71, 0X4F, 0X0A, 0XAA, 0XA0, 0X8E,
+  0X00, 0X20, 0X2A, 0X08, 0X9B, 0XC0, 0X13, 0X44, 0X21, 0X08, 0X9A, 0XDE,
+  0XEC, 0XA0, 0X09, 0X0F, 0X09, 0X11, 0X10, 0X84, 0X74, 0X77, 0X74, 0X40,
+  0X0A, 0X06, 0X70, 0X7A, 0X74, 0X00, 0XBF, 0X0F, 0X0B, 0X06, 0X74, 0X70,
+  0XF0, 0XC0, 0X0A, 0XBA, 0X90, 0X6B, 0X01, 0X30, 0X1A, 0X09, 0XBA, 0X01,
+  0X35, 0X63, 0X10, 0X8A, 0XDF, 0X1F, 0X3F, 0X5F, 0X2C, 0X90, 0XF0, 0X81,
+  0X02, 0X90, 0X75, 0X73, 0X73, 0X70, 0X00, 0XCC, 0XA0, 0X57, 0X27, 0XB7,
+  0X30, 0X0D, 0XF0, 0XF0, 0XB0, 0X51, 0X76, 0X2F, 0X0A, 0XBA, 0XB9, 0X08,
+  0XA4, 0X02, 0X99, 0X08, 0XAC, 0X01, 0X55, 0X42, 0X09, 0XAE, 0XF3, 0XF5,
+  0XF4, 0XF0, 0XB9, 0X0F, 0X0A, 0X99, 0X07, 0X14, 0X66, 0X2A, 0XED, 0XA9,
+  0X03, 0X17, 0X27, 0X63, 0X00, 0XDC, 0XB9, 0X90, 0X41, 0X77, 0X00, 0XAB,
+  0X01, 0XBA, 0X06, 0X14, 0X01, 0X20, 0X0A, 0XA9, 0X0D, 0X42, 0X21, 0X08,
+  0X9B, 0XF0, 0XF0, 0XF2, 0XF0, 0XB0, 0XF0, 0X99, 0X0A, 0X11, 0XAF, 0X0F,
+  0X2F, 0X3F, 0X2B, 0X05, 0X46, 0X20, 0X22, 0X00, 0X10, 0X41, 0X73, 0X2A,
+  0X02, 0XA9, 0X06, 0X27, 0X22, 0XAA, 0X01, 0XB9, 0X07, 0X16, 0X60, 0X41,
+  0X09, 0X13, 0X00, 0XCB, 0XCA, 0X90, 0XF0, 0X89, 0X00, 0X99, 0X07, 0X9C,
+  0XF1, 0XF6, 0XFB, 0XFD, 0XF9, 0XF0, 0XA9, 0X04, 0XAE, 0XA0, 0X05, 0X70,
+  0X31, 0X05, 0X12, 0X26, 0X30, 0X0A, 0X99, 0X06, 0X47, 0XCA, 0XC0, 0X1A,
+  0X9A, 0X90, 0X62, 0X77, 0X7A, 0X02, 0XF0, 0XEC, 0X08, 0X16, 0X71, 0X72,
+  0X60, 0X09, 0X90, 0XF0, 0X99, 0X90, 0X9D, 0XF6, 0XFF, 0XFF, 0XFE, 0XFA,
+  0XF1, 0XB0, 0X5F, 0X0F, 0X6E, 0X00, 0X71, 0X72, 0X70, 0X41, 0X04, 0X1B,
+  0X55, 0X43, 0X00, 0XB9, 0X06, 0X73, 0X7F, 0XCD, 0XBB, 0XAD, 0XA0, 0X76,
+  0X7F, 0X7D, 0X01, 0XDF, 0X0F, 0X1B, 0X90, 0X72, 0X73, 0X76, 0X73, 0X53,
+  0X99, 0X90, 0XF0, 0XE0, 0X6E, 0XF8, 0XFE, 0X87, 0XD8, 0X83, 0XFA, 0XF2,
+  0XA0, 0X49, 0XF3, 0X87, 0X3F, 0X60, 0X17, 0X77, 0X14, 0X10, 0X49, 0XF3,
+  0X27, 0X46, 0X22, 0X00, 0X90, 0X67, 0X97, 0XDC, 0XCA, 0X00, 0XAB, 0XA0,
+  0X77, 0X68, 0X73, 0X7C, 0X01, 0XF4, 0XF2, 0XF1, 0XC9, 0X07, 0X67, 0X87,
+  0XD7, 0X87, 0X34, 0X0F, 0X0E, 0X06, 0XCF, 0X88, 0X41, 0X86, 0X48, 0X6B,
+  0XF8, 0XEA, 0X90, 0X4F, 0X48, 0X58, 0XFF, 0X01, 0X79, 0X76, 0X61, 0X04,
+  0X9F, 0X9A, 0X77, 0X75, 0X40, 0X97, 0XE7, 0X6F, 0X0A, 0X00, 0XAA, 0XCA,
+  0X06, 0X28, 0X2E, 0X89, 0X37, 0X80, 0X0B, 0XF1, 0XF4, 0XF2, 0XC9, 0X06,
+  0X17, 0X27, 0XB7, 0XF7, 0XB7, 0X77, 0X02, 0X0F, 0X0E, 0X06, 0XAF, 0X4F,
+  0XD8, 0X4B, 0XFF, 0XF8, 0XE9, 0X05, 0XF0, 0X83, 0XD8, 0XB2, 0X01, 0X76,
+  0X76, 0X62, 0X04, 0XAF, 0XCF, 0X47, 0X87, 0X77, 0X02, 0X11, 0X06, 0X75,
+  0X42, 0XA2, 0X00, 0XAA, 0X90, 0X66, 0X84, 0X78, 0XAB, 0X5B, 0XF3, 0XF3,
+  0XF2, 0XF2, 0XC9, 0X06, 0X37, 0X57, 0XD7, 0XF7, 0XE7, 0XA7, 0X65, 0X11,
+  0X0A, 0X10, 0XF0, 0XE0, 0X7F, 0X1F, 0XAF, 0XFF, 0XAF, 0X2C, 0X90, 0X5C,
+  0X82, 0X58, 0X8C, 0XF1, 0X00, 0X57, 0X97, 0X21, 0X10, 0X39, 0XFD, 0X89,
+  0XB7, 0X47, 0XA7, 0X24, 0X52, 0X06, 0XB3, 0X22, 0X00, 0X22, 0X90, 0X77,
+  0X28, 0X62, 0X7A, 0X00, 0XF3, 0XF4, 0XF5, 0XF5, 0XF3, 0XD9, 0X06, 0X57,
+  0X98, 0X70, 0X8B, 0X48, 0XD6, 0X8D, 0X17, 0XB7, 0X33, 0X0A, 0X11, 0X10,
+  0XF0, 0XE0, 0X7C, 0XF5, 0XF9, 0XFA, 0XF3, 0XB0, 0X69, 0XFB, 0X86, 0X78,
+  0XDD, 0X01, 0X78, 0X72, 0X30, 0X5F, 0X98, 0X7A, 0XB7, 0XC7, 0X77, 0X26,
+  0X20, 0X6F, 0X9F, 0X27, 0X42, 0X0B, 0X74, 0X87, 0XA7, 0X5F, 0X1F, 0X4F,
+  0X5F, 0X4F, 0X5F, 0X3C, 0X06, 0X17, 0X17, 0XA8, 0X8A, 0X8C, 0XF8, 0XEF,
+  0X8E, 0XA7, 0XA7, 0X24, 0X10, 0X81, 0X32, 0X21, 0X0F, 0X0E, 0X07, 0XAE,
+  0XF2, 0XF2, 0XD9, 0X07, 0XF4, 0X84, 0XC8, 0XBF, 0X01, 0X74, 0X72, 0X20,
+  0X5F, 0X38, 0X5B, 0XF6, 0X57, 0X57, 0X17, 0X04, 0X06, 0XFC, 0XFA, 0X75,
+  0X60, 0X03, 0X23, 0X10, 0X67, 0X17, 0XC5, 0XF3, 0XF5, 0XF0, 0XF0, 0XEE,
+  0XB9, 0X05, 0X17, 0X27, 0XC8, 0XA1, 0X8E, 0X77, 0X97, 0XB7, 0X97, 0X33,
+  0X10, 0X82, 0X34, 0X32, 0X10, 0XF0, 0XE0, 0X8C, 0XDD, 0XB0, 0X8C, 0XFB,
+  0XFF, 0X01, 0X70, 0X70, 0X20, 0X5C, 0X84, 0X2F, 0XA0, 0X07, 0X45, 0X53,
+  0X10, 0X5F, 0X78, 0X8D, 0X45, 0X3B, 0X00, 0X11, 0X07, 0X75, 0XBF, 0X0F,
+  0X0F, 0X0D, 0XDB, 0XA0, 0X62, 0X70, 0X78, 0X7C, 0X79, 0X00, 0X37, 0X77,
+  0X24, 0X11, 0X06, 0X13, 0X56, 0X42, 0X10, 0XF0, 0XE0, 0XA2, 0X32, 0X07,
+  0XAF, 0X0E, 0X01, 0X70, 0X42, 0X05, 0X9F, 0X6F, 0X20, 0X02, 0X25, 0X20,
+  0X6F, 0X0F, 0X93, 0X20, 0X12, 0X30, 0X7F, 0X0A, 0XAD, 0XDD, 0XA0, 0X09,
+  0X08, 0X25, 0X65, 0X01, 0X73, 0X71, 0X41, 0X08, 0X24, 0X44, 0X31, 0X0F,
+  0X0E, 0X08, 0X37, 0X07, 0X37, 0X14, 0X20, 0X61, 0X70, 0X78, 0X01, 0X30,
+  0X84, 0X20, 0X0D, 0XA0, 0X01, 0X06, 0XAD, 0XDC, 0XB0, 0X13, 0X20, 0X6F,
+  0X4F, 0XAA, 0X03, 0X33, 0X07, 0XAF, 0X0F, 0X4F, 0X4F, 0X10, 0X15, 0X44,
+  0X10, 0X89, 0X00, 0X11, 0X10, 0X01, 0X0F, 0X0E, 0X07, 0X17, 0X27, 0XC7,
+  0XE7, 0XA7, 0X22, 0X10, 0X55, 0X85, 0X38, 0XD6, 0X01, 0XF0, 0XF1, 0XB0,
+  0X52, 0X7C, 0X7A, 0X00, 0XF8, 0XF0, 0XA9, 0X07, 0X72, 0XF0, 0XF0, 0XA0,
+  0X02, 0X32, 0X06, 0XF5, 0X85, 0XEF, 0X77, 0X37, 0X57, 0X27, 0X06, 0X70,
+  0X30, 0X6A, 0XF7, 0X84, 0X08, 0X8F, 0X8D, 0XD0, 0X1B, 0X52, 0X10, 0X79,
+  0XCE, 0XDB, 0XA0, 0XF0, 0XE0, 0X77, 0X08, 0X2C, 0X85, 0X78, 0X6D, 0X85,
+  0XC7, 0X32, 0X06, 0X7F, 0X88, 0XC8, 0XFF, 0X01, 0X8A, 0XFF, 0XBD, 0X05,
+  0X72, 0X87, 0XA7, 0X58, 0XE2, 0XFE, 0XF2, 0XD9, 0X06, 0X17, 0XBF, 0X4F,
+  0X1A, 0X00, 0X26, 0X31, 0X05, 0XD8, 0X29, 0X89, 0X15, 0X7D, 0X7D, 0X79,
+  0X79, 0X76, 0X51, 0X06, 0XF5, 0X81, 0XC8, 0X59, 0X8A, 0X98, 0XE5, 0XF6,
+  0XF7, 0XA1, 0X09, 0XBF, 0X0F, 0X1E, 0XBA, 0X90, 0XF0, 0XE0, 0X63, 0X82,
+  0X48, 0X61, 0X89, 0X58, 0XA5, 0X87, 0XF7, 0X63, 0X05, 0X72, 0X85, 0X88,
+  0XDB, 0X01, 0X8E, 0X58, 0X86, 0XFF, 0XE9, 0X04, 0X82, 0XE8, 0XAF, 0XFC,
+  0X8C, 0X3F, 0X7E, 0XDC, 0X90, 0X5B, 0XF9, 0X67, 0X34, 0X32, 0X53, 0X06,
+  0X98, 0X06, 0X84, 0X68, 0XBA, 0X79, 0X8F, 0XF8, 0XEF, 0X8C, 0X18, 0X6E,
+  0X76, 0X20, 0X6A, 0X80, 0X38, 0X21, 0X85, 0XF8, 0X9F, 0X8B, 0XF8, 0XB4,
+  0XF7, 0XA9, 0X09, 0XBD, 0XDB, 0X90, 0XF0, 0X82, 0X43, 0X21, 0X06, 0X18,
+  0X1C, 0X85, 0XF8, 0XAF, 0X8E, 0X08, 0XDD, 0X89, 0XB7, 0X32, 0X04, 0X28,
+  0X33, 0X8A, 0XB8, 0XFF, 0X00, 0XFB, 0X8B, 0X88, 0X65, 0XFA, 0XB0, 0X43,
+  0X86, 0XD7, 0X98, 0XB2, 0XFA, 0XEA, 0XDB, 0X06, 0XC8, 0X3B, 0XF1, 0X8C,
+  0XF7, 0XB7, 0X16, 0X71, 0X61, 0X06, 0XE8, 0X0D, 0X85, 0XE8, 0XD8, 0X00,
+  0X79, 0X8E, 0XF8, 0X97, 0X83, 0X85, 0X10, 0X6B, 0X80, 0X38, 0X20, 0X85,
+  0X18, 0X77, 0X87, 0XD8, 0X5E, 0XF2, 0X90, 0XA9, 0X99, 0X0F, 0X07, 0X57,
+  0X47, 0X67, 0X35, 0X10, 0X51, 0X7E, 0X85, 0X88, 0XB4, 0X8F, 0XC8, 0XFF,
+  0X8F, 0XA7, 0X52, 0X11, 0X03, 0X7E, 0X87, 0XF8, 0XDB, 0XF9, 0X8E, 0X28,
+  0XCA, 0X89, 0XFF, 0XFF, 0X39, 0X05, 0X88, 0X40, 0X0F, 0X6F, 0X00, 0X0A,
+  0XA9, 0X06, 0X98, 0X0A, 0X87, 0X07, 0XF8, 0XEA, 0X7C, 0X74, 0X74, 0X70,
+  0X08, 0XF6, 0X81, 0X88, 0X7A, 0XF6, 0X00, 0X79, 0X8C, 0XA8, 0X57, 0X72,
+  0X08, 0XB8, 0X04, 0X81, 0XC8, 0X3A, 0X84, 0X88, 0X3F, 0XF1, 0X90, 0XF0,
+  0X67, 0X07, 0X97, 0XF7, 0XE7, 0X97, 0X02, 0X05, 0X74, 0X84, 0X68, 0XA3,
+  0X8F, 0X73, 0X00, 0XEF, 0X7E, 0X90, 0X31, 0X84, 0X88, 0XB4, 0XF3, 0X8C,
+  0XF8, 0XC6, 0XFB, 0XF9, 0XF7, 0XD9, 0X04, 0XA8, 0X59, 0X27, 0X62, 0XB0,
+  0X09, 0XA0, 0X7F, 0X38, 0X2E, 0X8B, 0XC7, 0XE8, 0XEF, 0X79, 0X73, 0X70,
+  0X20, 0X8F, 0XE8, 0X34, 0X8A, 0XB0, 0X18, 0XE7, 0X87, 0X07, 0X12, 0X08,
+  0XCF, 0XE8, 0X1A, 0X82, 0X9F, 0XDF, 0X09, 0X0F, 0X05, 0X47, 0X78, 0X2C,
+  0X83, 0XD7, 0XF7, 0X66, 0X11, 0X03, 0X28, 0X25, 0X87, 0X88, 0XD6, 0X71,
+  0X01, 0X8D, 0XBF, 0XCF, 0X2A, 0X03, 0X28, 0X72, 0X74, 0XFE, 0XFE, 0XF5,
+  0XF2, 0XF2, 0XF1, 0XB0, 0X59, 0X83, 0X4D, 0X78, 0X20, 0X0A, 0X0A, 0X81,
+  0X38, 0X93, 0X00, 0X79, 0X77, 0X73, 0X70, 0X10, 0X8B, 0X81, 0XA8, 0X7D,
+  0XFB, 0X00, 0X74, 0X78, 0X71, 0X0A, 0XDF, 0X5F, 0X6F, 0X3C, 0X0F, 0X04,
+  0X15, 0X72, 0X74, 0X72, 0X62, 0X06, 0X47, 0XB8, 0X8F, 0X78, 0X01, 0XDF,
+  0XAF, 0X5E, 0XA9, 0X02, 0X27, 0X8F, 0X0F, 0X3E, 0XCE, 0XF0, 0XD9, 0X06,
+  0XCC, 0X01, 0XA0, 0X0D, 0XA0, 0X8B, 0XF0, 0X01, 0X20, 0XCB, 0XEF, 0X10,
+  0X02, 0X53, 0X10, 0X99, 0XAB, 0XA9, 0X0F, 0X04, 0X9A, 0XEF, 0X2F, 0X6F,
+  0X8F, 0X4F, 0X0A, 0X90, 0X39, 0XCF, 0X0D, 0X01, 0X57, 0X00, 0X0A, 0X90,
+  0X34, 0X00, 0XC2, 0X00, 0XA0, 0X0A, 0X90, 0X61, 0X84, 0XC4, 0XF6, 0XCA,
+  0XCC, 0XA9, 0X07, 0X7D, 0X8B, 0X20, 0X0B, 0XF2, 0XF1, 0XD0, 0X91, 0X7B,
+  0X89, 0X58, 0XFC, 0X01, 0X99, 0X0A, 0X35, 0X54, 0X20, 0XF0, 0X5E, 0XF7,
+  0X81, 0X58, 0X1C, 0X81, 0X9F, 0XBF, 0X0A, 0X04, 0XC8, 0X1A, 0X85, 0XE8,
+  0XB6, 0XB0, 0X17, 0X02, 0XBA, 0X03, 0X18, 0X6A, 0X27, 0XD7, 0X67, 0X14,
+  0X21, 0X10, 0X57, 0X58, 0X8C, 0XF1, 0XF8, 0XCA, 0XAD, 0XA0, 0X76, 0X85,
+  0XE8, 0XE2, 0X00, 0X8E, 0X5F, 0X7F, 0X2D, 0X90, 0X87, 0X38, 0X53, 0X8C,
+  0XA3, 0X00, 0XAF, 0X0A, 0X0A, 0X67, 0X17, 0X15, 0X21, 0X0F, 0X05, 0X9F,
+  0X2F, 0X9F, 0XEF, 0XBF, 0X4C, 0X90, 0X49, 0XFE, 0X82, 0X98, 0X72, 0X8B,
+  0XFF, 0XBF, 0X6F, 0XEF, 0X7F, 0X1B, 0X90, 0X2D, 0X84, 0X2F, 0X68, 0XE2,
+  0X8E, 0X58, 0XD6, 0X7B, 0X77, 0X73, 0X30, 0X58, 0X3C, 0X8B, 0XCF, 0X0A,
+  0X44, 0XA0, 0X81, 0X82, 0XA8, 0XA3, 0X7E, 0XF6, 0XF6, 0XDF, 0X0C, 0X08,
+  0X28, 0X24, 0X88, 0X18, 0XF2, 0X01, 0XDD, 0XA0, 0X93, 0X57, 0X05, 0X10,
+  0XF0, 0X69, 0XDF, 0X0E, 0XCA, 0X06, 0XD8, 0X0C, 0X83, 0X58, 0X73, 0X8A,
+  0X38, 0XAD, 0X89, 0X18, 0X53, 0XF3, 0XA0, 0X3B, 0X82, 0X48, 0X81, 0XA8,
+  0XFF, 0X8F, 0XC8, 0XE0, 0X8A, 0X77, 0XE7, 0X11, 0X03, 0X28, 0X6E, 0X7E,
+  0X78, 0X75, 0X70, 0X54, 0X22, 0X06, 0X76, 0X86, 0X18, 0XCF, 0X3F, 0X1C,
+  0XAB, 0XA0, 0X87, 0X08, 0X3F, 0X8A, 0X97, 0X60, 0X1E, 0XF0, 0XA9, 0X08,
+  0X35, 0X55, 0X29, 0X90, 0XF0, 0X99, 0X09, 0XF4, 0X81, 0X38, 0X3B, 0X85,
+  0XF8, 0X6E, 0X86, 0X28, 0X3B, 0XF0, 0X90, 0X3A, 0XFE, 0X85, 0X08, 0XBA,
+  0X00, 0X38, 0XFF, 0X8C, 0XF8, 0X6D, 0X74, 0X20, 0X34, 0X50, 0X08, 0XD4,
+  0X8C, 0X67, 0X36, 0X43, 0X21, 0X04, 0X18, 0X2E, 0X89, 0X17, 0XCE, 0XF1,
+  0XBC, 0XDA, 0X07, 0X17, 0X68, 0X5C, 0X8C, 0XF0, 0X2F, 0X3F, 0X2C, 0X08,
+  0X13, 0X70, 0X71, 0X54, 0X21, 0X0F, 0X0E, 0X05, 0X9F, 0X58, 0X1F, 0X83,
+  0XC8, 0X4C, 0X84, 0XAF, 0X5B, 0X05, 0XF3, 0X82, 0XE8, 0X8C, 0XF4, 0X01,
+  0X8E, 0XA7, 0XD7, 0X12, 0X04, 0X85, 0X7F, 0XE7, 0XA7, 0XB7, 0X54, 0X23,
+  0X06, 0X58, 0X54, 0X8B, 0X87, 0X4F, 0X3F, 0X3F, 0X0D, 0XDA, 0X90, 0X63,
+  0X7A, 0X87, 0XC8, 0XED, 0X02, 0XF5, 0XF5, 0XB0, 0X81, 0X70, 0X73, 0X75,
+  0X74, 0X52, 0X0F, 0X0E, 0X06, 0XCF, 0X1F, 0X4F, 0X4F, 0X1B, 0X06, 0XBF,
+  0X88, 0X73, 0XF8, 0X01, 0X71, 0X72, 0X40, 0X4A, 0X83, 0XE8, 0XA3, 0X00,
+  0X73, 0X70, 0X00, 0X20, 0X01, 0X05, 0X48, 0X77, 0X8D, 0X1E, 0XF8, 0XF2,
+  0XF0, 0XCC, 0XC0, 0X76, 0X7C, 0X89, 0X97, 0XB0, 0X2F, 0X9F, 0X4C, 0X90,
+  0X74, 0X73, 0X77, 0X78, 0X76, 0X71, 0X20, 0XF0, 0XE0, 0X79, 0X14, 0X44,
+  0X10, 0X59, 0XEF, 0X1F, 0X10, 0X31, 0X10, 0X3A, 0XFB, 0XFD, 0XD3, 0XA0,
+  0X0A, 0XA9, 0X05, 0X27, 0XA7, 0X3F, 0X3F, 0X5F, 0X2C, 0XCE, 0XB9, 0X05,
+  0X17, 0X07, 0XA8, 0XB2, 0X03, 0XFF, 0XF5, 0XC9, 0X06, 0X16, 0X75, 0X7C,
+  0X7D, 0X7B, 0X74, 0X51, 0X0F, 0X0E, 0X06, 0X90, 0X01, 0X24, 0X21, 0X05,
+  0X9C, 0XF0, 0XD0, 0X1B, 0X06, 0X9F, 0X7F, 0X9D, 0XB0, 0X0A, 0XCB, 0XA9,
+  0X05, 0X76, 0X00, 0XFC, 0XF9, 0XF5, 0XF2, 0XEE, 0XD9, 0X05, 0X17, 0X68,
+  0X68, 0X8D, 0X40, 0X2F, 0XB8, 0X8A, 0XFA, 0XE0, 0X72, 0X75, 0X83, 0XF8,
+  0X65, 0X87, 0XD8, 0X7A, 0X77, 0X41, 0X0F, 0X0E, 0X08, 0X24, 0X32, 0X10,
+  0X6C, 0XEC, 0X01, 0XAA, 0X05, 0X9F, 0X6F, 0XDF, 0X00, 0X0B, 0XAA, 0XCA,
+  0X05, 0XA4, 0XF0, 0XFB, 0XF9, 0XEF, 0X0E, 0XF2, 0XD9, 0X05, 0X57, 0XE8,
+  0X8C, 0X8E, 0XD0, 0X28, 0XC8, 0X86, 0XDF, 0X9C, 0X90, 0X67, 0X17, 0XE8,
+  0X62, 0X88, 0XF8, 0XA5, 0X89, 0X77, 0X52, 0X90, 0XF0, 0XE0, 0X61, 0X57,
+  0X37, 0X37, 0X37, 0X13, 0X10, 0X51, 0X70, 0X70, 0X01, 0XF1, 0XDA, 0X05,
+  0XCC, 0XDF, 0X0F, 0X0C, 0XCB, 0XA0, 0X5B, 0XF5, 0XF7, 0XF6, 0XEF, 0X0C,
+  0XEC, 0XB0, 0X63, 0X76, 0X7C, 0X20, 0X1F, 0XEF, 0XBF, 0X7F, 0X09, 0X06,
+  0X17, 0X07, 0X97, 0XF7, 0XF7, 0X86, 0X1A, 0X90, 0XF0, 0XE0, 0X64, 0X77,
+  0X7B, 0X7E, 0X7A, 0X71, 0X31, 0X05, 0X73, 0X87, 0XC7, 0XB0, 0X1F, 0X3F,
+  0X2C, 0X90, 0X43, 0X74, 0XAF, 0X7F, 0X2D, 0XAB, 0X90, 0X5A, 0XFA, 0XF5,
+  0XAA, 0XA0, 0X1A, 0X07, 0XBF, 0X0F, 0X1F, 0X10, 0X1B, 0X01, 0X99, 0X07,
+  0X9A, 0XBE, 0XF0, 0XF1, 0XF0, 0XC9, 0X90, 0XF0, 0XE0, 0X67, 0X17, 0XA7,
+  0XF7, 0XE7, 0X97, 0X23, 0X05, 0X37, 0XD8, 0X9D, 0X78, 0X01, 0XFA, 0XF6,
+  0XC9, 0X04, 0X75, 0X7F, 0XDF, 0X7F, 0X1C, 0X00, 0X99, 0X05, 0X9F, 0X8F,
+  0X10, 0XDC, 0XF8, 0XFC, 0XD0, 0X17, 0X14, 0X52, 0X10, 0X69, 0XDF, 0X3F,
+  0X9F, 0X9F, 0X9F, 0X6F, 0X1C, 0X90, 0XF0, 0XE0, 0X52, 0X74, 0X7B, 0X7E,
+  0X7B, 0X74, 0X41, 0X05, 0X58, 0X48, 0X8B, 0X83, 0X00, 0XF1, 0XF4, 0XF2,
+  0XD9, 0X03, 0X17, 0XB7, 0XCF, 0X2F, 0X4D, 0X00, 0XCE, 0X90, 0X59, 0XF7,
+  0XD6, 0X42, 0XA0, 0X19, 0X06, 0XAF, 0X5F, 0XAF, 0X50, 0X17, 0X17, 0X27,
+  0X03, 0X10, 0X7D, 0XF5, 0XF9, 0XFC, 0XFC, 0XFA, 0XF5, 0XD9, 0X0F, 0X0E,
+  0X05, 0X27, 0X17, 0X57, 0X37, 0X15, 0X00, 0X90, 0X57, 0X17, 0XF7, 0X90,
+  0X1F, 0X3F, 0X2E, 0XA0, 0X41, 0X7C, 0X73, 0XF0, 0XF0, 0X00, 0XAA, 0XA9,
+  0X06, 0XF3, 0XA7, 0X04, 0X22, 0X00, 0XA0, 0X79, 0XF0, 0XF7, 0XF0, 0X01,
+  0X71, 0X73, 0X70, 0X41, 0X07, 0XBF, 0X0F, 0X6F, 0XAF, 0XBF, 0X6F, 0X1B,
+  0X90, 0XF0, 0XE0, 0X52, 0X33, 0X2A, 0XCA, 0X90, 0X54, 0X72, 0X70, 0X01,
+  0X20, 0X0A, 0X90, 0X41, 0X75, 0X2C, 0X20, 0XBD, 0XA4, 0X53, 0X20, 0X02,
+  0X08, 0XCF, 0X2F, 0X00, 0X27, 0X05, 0X20, 0X89, 0XCF, 0X0F, 0X3F, 0X4F,
+  0X4D, 0XA0, 0XF0, 0XE0, 0X69, 0XBD, 0XC9, 0XA9, 0X05, 0X21, 0X20, 0X13,
+  0X22, 0X10, 0X57, 0X04, 0X2A, 0X20, 0XAB, 0X25, 0X20, 0X31, 0X07, 0XAB,
+  0XA0, 0X27, 0X25, 0X31, 0X08, 0X9C, 0XF1, 0XF2, 0XEB, 0X90, 0XF0, 0XE0,
+  0X59, 0X99, 0X00, 0X20, 0X02, 0X10, 0X51, 0X00, 0XA0, 0X3A, 0XA0, 0X41,
+  0X32, 0X00, 0X20, 0X02, 0X00, 0X10, 0X61, 0X42, 0X01, 0X20, 0X02, 0X0E,
+  0X01, 0X31, 0X00, 0X10, 0X79, 0XAA, 0XBC, 0XB0, 0XF0, 0XE0, 0X59, 0XDF,
+  0X3F, 0X4F, 0X2F, 0X0C, 0X99, 0X04, 0XDF, 0X3F, 0X00, 0X12, 0X46, 0X30,
+  0X49, 0XEA, 0X43, 0X02, 0X10, 0X74, 0X20, 0X3A, 0X09, 0X26, 0X40, 0X2A,
+  0XB9, 0X00, 0X90, 0X72, 0X45, 0X63, 0X10, 0XF0, 0XE0, 0X5A, 0XF1, 0XF6,
+  0XF7, 0XF8, 0XF3, 0XD9, 0X05, 0XDF, 0X8F, 0X70, 0X17, 0X47, 0X35, 0X31,
+  0X04, 0XF4, 0XA7, 0X26, 0X52, 0X29, 0X06, 0X37, 0XF5, 0XF0, 0XCA, 0X01,
+  0XA9, 0X06, 0X17, 0X37, 0XC7, 0XA0, 0X2F, 0X0D, 0XA9, 0X07, 0X37, 0X17,
+  0X27, 0X26, 0X42, 0X00, 0X90, 0XF0, 0XE0, 0X59, 0XF0, 0XF5, 0XF7, 0XF4,
+  0XF0, 0X90, 0X01, 0X04, 0XEF, 0XAF, 0XC0, 0X27, 0X27, 0X03, 0X04, 0X9F,
+  0X7F, 0X17, 0X07, 0X04, 0X20, 0X03, 0X10, 0X52, 0X78, 0X4C, 0XBB, 0X0A,
+  0X17, 0X27, 0X67, 0X00, 0X2D, 0XCB, 0X08, 0X37, 0X07, 0X47, 0X27, 0X15,
+  0X10, 0XF0, 0XE0, 0X59, 0XBC, 0XCC, 0X99, 0X06, 0XAF, 0X2F, 0X3B, 0X01,
+  0X52, 0X05, 0X9F, 0X1E, 0X34, 0X00, 0X32, 0X07, 0X37, 0X72, 0XAA, 0X30,
+  0X0A, 0X90, 0X72, 0X71, 0X72, 0X50, 0X2A, 0XB0, 0X93, 0X44, 0X42, 0X0F,
+  0X0E, 0X06, 0X99, 0X01, 0X12, 0X10, 0X5A, 0XCE, 0X03, 0X21, 0X05, 0XF0,
+  0XC2, 0X32, 0X01, 0X11, 0X05, 0XAA, 0X22, 0X02, 0X23, 0X10, 0X79, 0X04,
+  0X23, 0X20, 0X89, 0XAA, 0XAA, 0X0F, 0X0E, 0X08, 0X90, 0XA9, 0XA0, 0XB9,
+  0XA2, 0X00, 0XAB, 0X09, 0XA0, 0X2B, 0X0D, 0XA0, 0XE0, 0X22, 0X01, 0X10,
+  0XF0, 0XE0, 0X69, 0XCC, 0XB9, 0XA9, 0X06, 0XCC, 0XA0, 0X14, 0X32, 0X10,
+  0X39, 0XCC, 0X00, 0X24, 0X30, 0X01, 0X06, 0X92, 0X00, 0XA0, 0XD3, 0X45,
+  0X02, 0XAB, 0XA0, 0X81, 0X57, 0X06, 0X70, 0X41, 0X11, 0X0F, 0X0E, 0X06,
+  0X9A, 0XCC, 0XDA, 0X06, 0X9B, 0XCB, 0X01, 0X53, 0X10, 0X5B, 0XC3, 0X20,
+  0X02, 0X20, 0X82, 0X00, 0XBA, 0X02, 0XA9, 0X06, 0X13, 0X50, 0X2B, 0XDB,
+  0XA9, 0X06, 0X12, 0X35, 0X70, 0X70, 0X63, 0X0F, 0X0E, 0X06, 0XAD, 0XDF,
+  0X1E, 0XA9, 0X90, 0X49, 0XCF, 0X0D, 0X01, 0X34, 0X21, 0X04, 0XBD, 0X00,
+  0X33, 0X01, 0X21, 0X06, 0X20, 0X0A, 0XA0, 0XB1, 0X46, 0X50, 0X1D, 0XF0,
+  0XB9, 0X08, 0X26, 0X72, 0X72, 0X70, 0X53, 0X10, 0XF0, 0XE0, 0X6A, 0XDF,
+  0X2F, 0X1F, 0X0D, 0XA0, 0X6D, 0XF3, 0XF1, 0X01, 0X70, 0X53, 0X05, 0XCD,
+  0X00, 0X42, 0X02, 0X90, 0X51, 0X50, 0X0C, 0XAA, 0XAA, 0XA9, 0X06, 0X27,
+  0X17, 0X53, 0X01, 0XF3, 0XF2, 0XF2, 0XC9, 0X06, 0X15, 0X72, 0X76, 0X74,
+  0X74, 0X71, 0X21, 0X0F, 0X0E, 0X06, 0XAE, 0XF2, 0XF4, 0XF2, 0XEA, 0X06,
+  0XEF, 0X5F, 0X30, 0X16, 0X70, 0X31, 0X04, 0XDF, 0X20, 0X07, 0X05, 0X22,
+  0X11, 0X05, 0X24, 0XAA, 0X01, 0XAA, 0XA0, 0X74, 0X75, 0X73, 0X20, 0X0B,
+  0XF1, 0XF2, 0XEB, 0X07, 0X16, 0X74, 0X76, 0X77, 0X75, 0X70, 0X30, 0XF0,
+  0XE0, 0X69, 0XDF, 0X2F, 0X3F, 0X3C, 0XA9, 0X04, 0X9D, 0XF5, 0XF3, 0X01,
+  0X55, 0X30, 0X5B, 0XF1, 0X00, 0X54, 0X20, 0X09, 0X06, 0X27, 0X1A, 0XA0,
+  0X3A, 0XA0, 0X66, 0X77, 0X76, 0X30, 0X0D, 0XF1, 0XF1, 0XF1, 0XB9, 0X06,
+  0X27, 0X17, 0X77, 0X87, 0X57, 0X14, 0X10, 0XF0, 0XE0, 0X69, 0XDF, 0X3F,
+  0X3F, 0X2E, 0XA0, 0X6C, 0XF5, 0XF5, 0X01, 0X26, 0X31, 0X04, 0XBF, 0X10,
+  0X07, 0X15, 0X22, 0X19, 0X05, 0X46, 0X20, 0X0A, 0XA0, 0X0A, 0X90, 0X61,
+  0X71, 0X7A, 0X75, 0XBB, 0XF1, 0XDE, 0XEB, 0X07, 0X47, 0X27, 0X67, 0X57,
+  0X46, 0X30, 0XF0, 0XE0, 0X7B, 0XEF, 0X0F, 0X0C, 0X90, 0X6C, 0XF2, 0XF7,
+  0X01, 0X64, 0X11, 0X10, 0X3A, 0XEB, 0X55, 0X20, 0X09, 0X06, 0X22, 0XA0,
+  0X3A, 0XB9, 0X05, 0X17, 0X17, 0X67, 0X0A, 0XDD, 0XF0, 0XED, 0X99, 0X06,
+  0X37, 0X17, 0X37, 0X37, 0X07, 0X02, 0X0D, 0X10, 0XF0, 0XE0, 0X69, 0XAB,
+  0XDC, 0XB9, 0X06, 0X9B, 0XE0, 0X22, 0X30, 0X59, 0XA0, 0X03, 0X43, 0X08,
+  0X52, 0XAA, 0X01, 0XA9, 0XA9, 0X05, 0X17, 0X17, 0X37, 0X02, 0XBB, 0XAC,
+  0XAA, 0X06, 0X14, 0X70, 0X71, 0X42, 0X00, 0XAA, 0XA0, 0XA1, 0X0F, 0X0E,
+  0X07, 0X99, 0XA9, 0X0A, 0X20, 0X22, 0X11, 0X04, 0X23, 0X01, 0XA0, 0X93,
+  0X20, 0X4A, 0X90, 0X73, 0X30, 0X0A, 0XA0, 0X0A, 0XA9, 0X08, 0X12, 0X20,
+  0X0A, 0XCB, 0XB0, 0X09, 0X0F, 0X0E, 0X06, 0X12, 0X23, 0X20, 0X84, 0X71,
+  0X72, 0X02, 0XA9, 0X05, 0X47, 0X25, 0XEA, 0XBA, 0XA0, 0X65, 0X2A, 0X0D,
+  0XBB, 0XB2, 0X23, 0X22, 0X11, 0X07, 0XAB, 0XDF, 0X1F, 0X2F, 0X0F, 0X0B,
+  0XA0, 0XA9, 0X90, 0XF0, 0XE0, 0X73, 0X66, 0X54, 0X10, 0X67, 0X07, 0X77,
+  0X70, 0X2A, 0X06, 0X70, 0X77, 0X2D, 0XDC, 0XA9, 0X06, 0X34, 0XAA, 0X0B,
+  0X9F, 0X1F, 0X5F, 0X00, 0X07, 0X17, 0X17, 0X04, 0X42, 0X10, 0X59, 0XCF,
+  0X3F, 0X8F, 0X9F, 0X8F, 0X7F, 0X3D, 0X90, 0XF0, 0XE0, 0X62, 0X67, 0X07,
+  0X27, 0X04, 0X20, 0X52, 0X73, 0X7E, 0X7C, 0X01, 0XBA, 0XA0, 0X41, 0X76,
+  0X7C, 0X00, 0XF3, 0XF0, 0XAA, 0X90, 0X61, 0XA0, 0X04, 0X20, 0XA9, 0XF4,
+  0XFA, 0XF2, 0X33, 0X71, 0X73, 0X73, 0X62, 0X07, 0XCF, 0X4F, 0XAF, 0XBF,
+  0XBF, 0XAF, 0X3D, 0X90, 0XF0, 0XE0, 0X63, 0X67, 0X27, 0X17, 0X04, 0X21,
+  0X04, 0X27, 0X57, 0XC7, 0X90, 0X2C, 0X90, 0X42, 0X77, 0X77, 0XAF, 0X0D,
+  0X09, 0XCF, 0X12, 0X44, 0X20, 0X02, 0X21, 0X05, 0X9F, 0X2F, 0XDF, 0X80,
+  0X15, 0X76, 0X73, 0X71, 0X41, 0X06, 0XCF, 0X4F, 0XBF, 0XEF, 0XDF, 0X9F,
+  0X5C, 0X90, 0XF0, 0XE0, 0X63, 0X71, 0X74, 0X75, 0X73, 0X70, 0X30, 0X54,
+  0X78, 0X7E, 0X73, 0X01, 0XDA, 0X90, 0X41, 0X7A, 0X75, 0XDF, 0X0C, 0XAA,
+  0X07, 0XF2, 0XF7, 0X46, 0X22, 0X21, 0X41, 0X06, 0XF0, 0X83, 0X98, 0X9B,
+  0XD0, 0X17, 0X87, 0XB7, 0X54, 0X10, 0X6A, 0XF3, 0XFB, 0XFF, 0XFF, 0XFB,
+  0XF5, 0XDA, 0X90, 0XF0, 0XE0, 0X51, 0X47, 0X17, 0X37, 0X47, 0X25, 0X21,
+  0X04, 0X67, 0X77, 0X93, 0X01, 0XBB, 0X05, 0X37, 0X97, 0X4F, 0X0F, 0X0B,
+  0XA2, 0X11, 0X05, 0XF1, 0XFF, 0X27, 0X25, 0X32, 0X42, 0X10, 0X6D, 0XFC,
+  0X88, 0X1F, 0X60, 0X13, 0X77, 0X73, 0X51, 0X06, 0X9F, 0X0F, 0X8F, 0XCF,
+  0XCF, 0XAF, 0X2C, 0X0F, 0X0E, 0X06, 0X47, 0X07, 0X27, 0X37, 0X36, 0X41,
+  0X04, 0X47, 0X37, 0X60, 0X2A, 0X06, 0X17, 0X52, 0XAC, 0XA0, 0X02, 0X32,
+  0X10, 0X4F, 0X0F, 0XEA, 0X72, 0X64, 0X42, 0X42, 0X06, 0X9F, 0X68, 0X6A,
+  0XF8, 0X02, 0X77, 0X75, 0X51, 0X10, 0X6C, 0XF2, 0XF6, 0XF7, 0XF5, 0XF1,
+  0XBA, 0X0F, 0X0E, 0X05, 0X12, 0X67, 0X17, 0X27, 0X17, 0X14, 0X10, 0X31,
+  0X37, 0X17, 0X00, 0X42, 0X10, 0X39, 0X62, 0XDB, 0X00, 0X20, 0X02, 0X10,
+  0X5D, 0X85, 0X3C, 0X70, 0X42, 0X34, 0X52, 0X06, 0X9F, 0X3F, 0XEF, 0XC0,
+  0X27, 0X37, 0X25, 0X10, 0X7B, 0XF0, 0XF4, 0XF3, 0XF1, 0XDA, 0X0F, 0X0E,
+  0X07, 0XA2, 0X24, 0X53, 0X21, 0X02, 0X9A, 0XCC, 0X02, 0X57, 0X06, 0X20,
+  0X3B, 0XF4, 0XA0, 0X22, 0X45, 0X41, 0X04, 0XAF, 0XCF, 0X22, 0X32, 0X22,
+  0X42, 0X07, 0XDF, 0X3F, 0X20, 0X26, 0X52, 0X08, 0X9A, 0XA0, 0X01, 0X22,
+  0X10, 0XF0, 0XE0, 0X59, 0XCE, 0XF0, 0XD9, 0X24, 0X10, 0X4D, 0XF5, 0XF9,
+  0X02, 0X71, 0X77, 0X72, 0X31, 0X02, 0XBF, 0XAF, 0X03, 0X32, 0X00, 0X47,
+  0X04, 0X05, 0X9F, 0X1C, 0X00, 0XB0, 0X12, 0X53, 0X10, 0X69, 0X90, 0X3B,
+  0X00, 0X10, 0X92, 0X70, 0X71, 0X72, 0X64, 0X21, 0X0F, 0X0E, 0X05, 0X9E,
+  0XF4, 0XF5, 0XF2, 0XB2, 0X32, 0X04, 0XF1, 0XFD, 0X89, 0X7F, 0X10, 0X15,
+  0X7C, 0X75, 0X51, 0X02, 0X98, 0X2C, 0XFB, 0X47, 0X05, 0X44, 0X64, 0X20,
+  0X49, 0XF0, 0XAF, 0X0C, 0XC0, 0X02, 0X32, 0X07, 0X16, 0X72, 0X02, 0XF3,
+  0XDA, 0X08, 0X26, 0X77, 0X7C, 0X7B, 0X7A, 0X72, 0X30, 0XF0, 0XE0, 0X6E,
+  0XF7, 0XFC, 0XFA, 0XF5, 0XB2, 0X21, 0X03, 0XD8, 0X1E, 0X87, 0X08, 0XDD,
+  0X02, 0X8C, 0XD7, 0XA7, 0X11, 0X03, 0X81, 0X28, 0X7A, 0X00, 0X74, 0X72,
+  0X56, 0X73, 0X61, 0X05, 0XD4, 0XF4, 0XF4, 0XC0, 0X02, 0X31, 0X07, 0X67,
+  0XE7, 0XC0, 0X1B, 0XFC, 0XF5, 0XE9, 0X07, 0X47, 0X98, 0X5E, 0X87, 0XD8,
+  0X83, 0X86, 0XB7, 0X65, 0X10, 0XF0, 0XE0, 0X6B, 0XF6, 0XFD, 0XFE, 0XFB,
+  0XF2, 0X00, 0X20, 0X49, 0XFE, 0X84, 0X28, 0XAB, 0X02, 0X8E, 0X78, 0X78,
+  0X74, 0X30, 0X3F, 0X88, 0X44, 0XFD, 0X78, 0X77, 0X74, 0X72, 0X73, 0X72,
+  0X20, 0X5F, 0X42, 0XF4, 0XF1, 0XBA, 0X00, 0X42, 0X10, 0X67, 0X48, 0X83,
+  0X78, 0X00, 0XF1, 0X8E, 0X28, 0XB6, 0XF9, 0XF1, 0XA9, 0X06, 0X74, 0X84,
+  0X88, 0X8C, 0X8B, 0X28, 0XAF, 0X88, 0XF7, 0XC6, 0X10, 0XF0, 0XE0, 0X7F,
+  0X1F, 0XC8, 0X24, 0XFD, 0XF5, 0XB1, 0X10, 0X4F, 0X18, 0X1B, 0X86, 0XD8,
+  0XDD, 0X01, 0X7C, 0X89, 0X37, 0X63, 0X10, 0X2B, 0X81, 0X78, 0X84, 0X58,
+  0XF2, 0X7A, 0X74, 0X76, 0X71, 0X20, 0X5F, 0X7F, 0X5A, 0XAC, 0XB2, 0X22,
+  0X06, 0X18, 0X34, 0X8A, 0X5B, 0X8E, 0X78, 0XDB, 0X8C, 0X88, 0X9F, 0XFC,
+  0XF1, 0XA0, 0X65, 0X82, 0XE8, 0X7C, 0X8C, 0X88, 0XED, 0X8E, 0X58, 0XB6,
+  0X7D, 0X70, 0X20, 0X81, 0X33, 0X21, 0X0F, 0X0E, 0X07, 0X9F, 0X4F, 0XE8,
+  0X1F, 0XFB, 0XF1, 0X90, 0X59, 0X80, 0X38, 0X2F, 0X88, 0XFF, 0X40, 0X05,
+  0X8B, 0X27, 0XA5, 0X04, 0XFE, 0X83, 0XD8, 0XBF, 0X76, 0X8F, 0XC8, 0XD6,
+  0X7C, 0X75, 0X40, 0X5F, 0X78, 0X72, 0X74, 0X71, 0X23, 0X23, 0X10, 0X64,
+  0X86, 0X17, 0XE8, 0XCA, 0X8C, 0X68, 0XC3, 0XFB, 0XFB, 0XF8, 0XF1, 0XA0,
+  0X51, 0X7E, 0X86, 0X58, 0XC1, 0X8F, 0XF7, 0XB8, 0XFF, 0X8D, 0XB7, 0XC7,
+  0X01, 0X10, 0X62, 0X73, 0X77, 0X76, 0X70, 0X31, 0X0F, 0X0E, 0X08, 0XBF,
+  0X5F, 0XCF, 0XDF, 0X4B, 0X06, 0XB8, 0X0A, 0X84, 0X48, 0XA5, 0XD0, 0X07,
+  0XA7, 0XB6, 0X10, 0X3A, 0X80, 0XD8, 0X72, 0XF1, 0X38, 0XFC, 0X8B, 0XC7,
+  0XB5, 0X10, 0X4D, 0X83, 0X3C, 0X8C, 0X87, 0X22, 0X43, 0X20, 0X65, 0X88,
+  0XCF, 0X18, 0XAD, 0XFD, 0XF4, 0XF4, 0XF3, 0XF4, 0XD0, 0X67, 0X28, 0X4C,
+  0X8A, 0XD8, 0XF7, 0X02, 0X75, 0X74, 0X42, 0X06, 0X37, 0X98, 0X29, 0X83,
+  0X58, 0X2D, 0X7C, 0X71, 0X20, 0XF0, 0XE0, 0X9B, 0XF3, 0XF7, 0XF4, 0XC9,
+  0X06, 0XF3, 0X81, 0X28, 0X54, 0X8A, 0XD8, 0XE5, 0X00, 0X75, 0X50, 0X5F,
+  0X68, 0X24, 0X8A, 0XB0, 0X03, 0X8E, 0XD8, 0X7A, 0X73, 0X10, 0X58, 0X0A,
+  0X87, 0XA8, 0XE5, 0X8D, 0X87, 0X44, 0X71, 0X51, 0X05, 0XBC, 0XBF, 0X3F,
+  0X0F, 0X2C, 0XF0, 0XF0, 0XB9, 0X04, 0X18, 0X2F, 0X88, 0XD8, 0XD8, 0X03,
+  0XFF, 0XF0, 0X11, 0X05, 0X27, 0XB8, 0X3D, 0X86, 0X48, 0X73, 0X86, 0X18,
+  0X3E, 0X79, 0X51, 0X0F, 0X0E, 0X0A, 0XAE, 0XF0, 0XC0, 0X8F, 0XA8, 0X1C,
+  0X86, 0X18, 0XA7, 0XFF, 0X44, 0X10, 0X58, 0X04, 0X84, 0XC8, 0XE2, 0X00,
+  0X7B, 0X8A, 0XB7, 0XC2, 0X05, 0XF3, 0X83, 0X38, 0XCA, 0X8F, 0XF8, 0XDB,
+  0X76, 0X72, 0X30, 0X6D, 0X85, 0X97, 0X67, 0X30, 0X03, 0XAD, 0XEA, 0X05,
+  0X68, 0X6E, 0X8B, 0X4F, 0X28, 0XDB, 0X8E, 0X08, 0XE2, 0X8D, 0X68, 0XAB,
+  0XFD, 0XD0, 0X52, 0X7E, 0X84, 0X68, 0X7F, 0X8A, 0XD8, 0XBA, 0X89, 0XF8,
+  0X6A, 0X7F, 0X61, 0X0F, 0X0E, 0X0B, 0X9C, 0XA9, 0X07, 0X98, 0X05, 0X82,
+  0XC8, 0X6E, 0X88, 0XFB, 0X30, 0X6C, 0X81, 0X68, 0X8D, 0X01, 0X8D, 0XD8,
+  0X48, 0X40, 0X68, 0X0A, 0X88, 0X10, 0X08, 0XFF, 0X8C, 0XF7, 0X46, 0X10,
+  0X5A, 0X82, 0X7E, 0X8C, 0XA7, 0X00, 0X2A, 0X90, 0X55, 0X89, 0X74, 0X8B,
+  0X88, 0XC3, 0XFC, 0X8C, 0X88, 0XB6, 0X88, 0XC8, 0X51, 0XF0, 0X90, 0X47,
+  0X58, 0X3F, 0X87, 0XF8, 0XBC, 0X8E, 0X78, 0XF4, 0X8D, 0X48, 0X91, 0X7E,
+  0X70, 0X20, 0X72, 0X44, 0X10, 0XF0, 0XE0, 0XC9, 0XA0, 0X9D, 0X81, 0X08,
+  0X41, 0X86, 0XEF, 0X23, 0X10, 0X6F, 0XC8, 0X46, 0X8D, 0XB0, 0X08, 0XFC,
+  0X86, 0XA7, 0X00, 0X6F, 0X28, 0X3E, 0XFE, 0X00, 0X8F, 0X27, 0X87, 0X01,
+  0X06, 0X80, 0XA8, 0X8C, 0X8E, 0X77, 0XD4, 0X20, 0X09, 0X06, 0XBA, 0X2F,
+  0X6F, 0X6F, 0X7F, 0X7F, 0XA8, 0X75, 0XFB, 0XF0, 0X90, 0X32, 0X82, 0XA8,
+  0X6D, 0X8A, 0XF8, 0XE5, 0X8F, 0XF7, 0X48, 0XFC, 0X8B, 0X67, 0XD7, 0X11,
+  0X06, 0X37, 0X17, 0X37, 0X14, 0X10, 0XF0, 0XE0, 0XD9, 0X0A, 0XF4, 0X82,
+  0X78, 0X55, 0XF1, 0X08, 0XB8, 0X1F, 0X8A, 0X10, 0X03, 0X88, 0X87, 0X10,
+  0X69, 0X81, 0X78, 0XB4, 0X00, 0X76, 0X8B, 0X47, 0X01, 0X06, 0XF1, 0X85,
+  0X87, 0X18, 0XE2, 0X64, 0X00, 0X90, 0X6D, 0X87, 0X77, 0X52, 0XAF, 0X0E,
+  0XF3, 0XF9, 0XF5, 0XE9, 0X03, 0X48, 0X50, 0X89, 0X18, 0XCA, 0X7B, 0X01,
+  0X38, 0XCF, 0X75, 0X41, 0X05, 0X37, 0X17, 0X47, 0X77, 0X45, 0X10, 0XF0,
+  0XE0, 0XE9, 0X09, 0XBF, 0X4F, 0X6C, 0X11, 0X07, 0XF7, 0X87, 0XF0, 0X17,
+  0X87, 0X01, 0X06, 0XF6, 0X89, 0X10, 0X17, 0X65, 0X10, 0X6A, 0X83, 0X9F,
+  0X17, 0XE7, 0X32, 0X10, 0X09, 0X05, 0XB8, 0X59, 0X70, 0X70, 0XA0, 0X1E,
+  0XEB, 0XA9, 0X03, 0X38, 0X6D, 0X7F, 0X73, 0X30, 0X22, 0X10, 0X61, 0X47,
+  0X17, 0X47, 0X16, 0X30, 0XF0, 0XE0, 0XE0, 0XA9, 0XBB, 0X00, 0X31, 0X07,
+  0XAD, 0X01, 0X73, 0X50, 0X7A, 0XD0, 0X15, 0X21, 0X07, 0XF0, 0XA5, 0X20,
+  0X11, 0X10, 0X6E, 0X24, 0X22, 0X00, 0X47, 0X17, 0X03, 0X10, 0X39, 0X00,
+  0XAB, 0X03, 0XF7, 0XF3, 0XD9, 0X05, 0X9B, 0XDD, 0XEC, 0X90, 0XF0, 0XE0,
+  0XE0, 0XA1, 0X56, 0X43, 0X10, 0X76, 0X7B, 0X02, 0X11, 0X06, 0X47, 0XE0,
+  0X1D, 0X90, 0X87, 0X37, 0X1F, 0X1A, 0X22, 0X10, 0X77, 0X15, 0X00, 0X45,
+  0X71, 0X75, 0X77, 0X73, 0X40, 0X4B, 0XFD, 0XF7, 0XF0, 0XB0, 0X1F, 0X18,
+  0XA7, 0XFC, 0XF1, 0XA0, 0X49, 0XBE, 0XF3, 0XF5, 0XF3, 0XD9, 0X0F, 0X0E,
+  0X0E, 0X0A, 0X57, 0X97, 0X97, 0X37, 0X02, 0X06, 0X18, 0X30, 0X8C, 0X10,
+  0X1F, 0X10, 0X88, 0X23, 0X8D, 0X60, 0X1F, 0X8C, 0X10, 0X62, 0X86, 0X57,
+  0X6F, 0XDF, 0X00, 0X02, 0X41, 0X05, 0X18, 0X78, 0X47, 0X07, 0X77, 0X97,
+  0XE8, 0XC3, 0X89, 0X98, 0X59, 0X70, 0X04, 0XB8, 0X32, 0X86, 0XB8, 0XA3,
+  0X8D, 0X4F, 0X9F, 0XE8, 0XB8, 0X86, 0XE8, 0X2D, 0XF2, 0XA0, 0X5B, 0XF1,
+  0XF6, 0XF7, 0XF4, 0XC0, 0XF0, 0XE0, 0XD1, 0X10, 0X81, 0X75, 0X84, 0X57,
+  0XE7, 0X56, 0X10, 0X66, 0X85, 0XF8, 0XF7, 0X01, 0XF5, 0XB1, 0X05, 0X28,
+  0X55, 0X8F, 0XF0, 0X0F, 0X1F, 0X8A, 0X10, 0X67, 0X38, 0X9D, 0XF1, 0XFC,
+  0X23, 0X70, 0X62, 0X06, 0X75, 0X37, 0XE8, 0XE5, 0X8F, 0X48, 0XFA, 0X8F,
+  0X78, 0XC8, 0X7E, 0X39, 0X90, 0X2A, 0X80, 0XC8, 0X2F, 0X85, 0XE8, 0X88,
+  0X8A, 0X18, 0X97, 0X86, 0XD8, 0X39, 0X81, 0X4F, 0X09, 0X06, 0XAC, 0XDA,
+  0X0F, 0X0E, 0X0E, 0X09, 0X57, 0XF8, 0X62, 0X7D, 0X74, 0X52, 0X06, 0X82,
+  0X68, 0XB2, 0X71, 0X01, 0XF5, 0X07, 0X7C, 0X8A, 0XF0, 0X1F, 0XBF, 0X12,
+  0X20, 0X68, 0X39, 0X8D, 0XB8, 0XD8, 0XD7, 0X07, 0X17, 0X37, 0X97, 0X11,
+  0X04, 0X98, 0X54, 0X8B, 0X27, 0XC8, 0XFF, 0X74, 0X57, 0X17, 0XE9, 0XDA,
+  0X04, 0XF5, 0X80, 0X68, 0X18, 0X82, 0XF8, 0X3D, 0X83, 0X78, 0X22, 0X80,
+  0XEF, 0X9B, 0X0F, 0X0E, 0X0E, 0X08, 0X17, 0X37, 0XC7, 0XC7, 0X67, 0X04,
+  0X20, 0X57, 0X28, 0X5C, 0X8E, 0XF0, 0X1B, 0X00, 0X31, 0X04, 0X28, 0X53,
+  0X8F, 0X70, 0X1F, 0X16, 0X72, 0X41, 0X04, 0X18, 0X77, 0X8F, 0XF7, 0X68,
+  0XE0, 0X8E, 0X58, 0XDB, 0X8B, 0X68, 0X6E, 0X7F, 0X60, 0X49, 0X80, 0XE8,
+  0X46, 0X89, 0X18, 0XDB, 0X01, 0XF6, 0X8A, 0X58, 0X51, 0XF2, 0X90, 0X5E,
+  0X80, 0X08, 0X03, 0X80, 0X78, 0X06, 0X80, 0X3F, 0X6C, 0X90, 0XF0, 0XE0,
+  0XC1, 0X10, 0X82, 0X75, 0X7E, 0X88, 0XC7, 0X97, 0X14, 0X21, 0X04, 0X7F,
+  0X89, 0X57, 0X90, 0X1D, 0XF0, 0X11, 0X04, 0X7F, 0X8A, 0XB7, 0X10, 0X0B,
+  0X37, 0X17, 0X56, 0X06, 0XFB, 0XF1, 0X8F, 0XF8, 0XFF, 0X8F, 0XF8, 0XFF,
+  0X8F, 0XF8, 0XB6, 0X84, 0XC7, 0X21, 0X04, 0XF7, 0X80, 0XA8, 0X2D, 0X86,
+  0X28, 0X8C, 0X89, 0X78, 0X83, 0X85, 0X88, 0X2C, 0XF2, 0XA0, 0X7B, 0XF0,
+  0XEB, 0X90, 0XF0, 0XE0, 0XC1, 0X10, 0X84, 0X76, 0X86, 0X88, 0XA3, 0X77,
+  0X71, 0X31, 0X04, 0X48, 0X39, 0X8C, 0X10, 0X2F, 0X3D, 0X90, 0X58, 0X44,
+  0X8F, 0XF0, 0X13, 0X73, 0X74, 0X76, 0X70, 0X20, 0X49, 0X82, 0XE8, 0X95,
+  0XF4, 0X03, 0X8E, 0XD8, 0X6D, 0X71, 0X10, 0X5F, 0X38, 0X06, 0X81, 0X78,
+  0X2D, 0X83, 0X88, 0X33, 0X82, 0X58, 0X15, 0XF0, 0X90, 0XF0, 0XE0, 0XB1,
+  0X11, 0X10, 0X61, 0X73, 0X84, 0X08, 0X8A, 0X8C, 0X37, 0XD7, 0X02, 0X90,
+  0X47, 0X18, 0X59, 0X8E, 0XA0, 0X2F, 0X9F, 0X7B, 0X90, 0X48, 0X65, 0X03,
+  0X7B, 0X7B, 0X78, 0X72, 0X10, 0X58, 0X0D, 0X84, 0X28, 0X9D, 0X03, 0X57,
+  0X35, 0X07, 0XEF, 0XE8, 0X09, 0X80, 0XE8, 0X10, 0X80, 0XDF, 0X5C, 0X0F,
+  0X0E, 0X0B, 0X23, 0X10, 0X72, 0X78, 0X85, 0XE8, 0XAD, 0X8E, 0X07, 0XA4,
+  0XB0, 0X41, 0X7B, 0X88, 0XA7, 0XE0, 0X2F, 0XCF, 0X4C, 0X05, 0X76, 0X03,
+  0X38, 0XE0, 0X7A, 0X71, 0X10, 0X5F, 0X38, 0X1A, 0X85, 0X78, 0XB2, 0XB0,
+  0X1F, 0XBC, 0X21, 0X07, 0XAF, 0X1F, 0X4F, 0X5F, 0X2E, 0XA9, 0X0F, 0X0E,
+  0X0A, 0X13, 0X32, 0X10, 0X67, 0X07, 0XE8, 0X83, 0X8D, 0X68, 0XFC, 0X77,
+  0X2B, 0XA0, 0X33, 0X83, 0X98, 0XBA, 0X03, 0XFD, 0XF4, 0XC9, 0X04, 0XF7,
+  0X04, 0X7B, 0X78, 0X51, 0X05, 0XBF, 0XA8, 0X31, 0X87, 0XA8, 0XC6, 0XF4,
+  0XB8, 0XC8, 0XE0, 0XA9, 0XBB, 0XA9, 0X90, 0XF0, 0XE0, 0XA3, 0X44, 0X20,
+  0X61, 0X75, 0X85, 0X38, 0XAB, 0X8F, 0XA3, 0X71, 0XEE, 0XA9, 0X02, 0X73,
+  0X86, 0X28, 0XE7, 0X03, 0XFE, 0XF3, 0XD9, 0X04, 0XF5, 0X04, 0X73, 0X71,
+  0X10, 0X7E, 0XFD, 0X85, 0XB8, 0XA3, 0X8D, 0X48, 0XE2, 0XF9, 0XF1, 0X90,
+  0XB9, 0X99, 0X0F, 0X0E, 0X09, 0X13, 0X43, 0X20, 0X62, 0X74, 0X86, 0XA8,
+  0XCA, 0X50, 0X1E, 0XEA, 0X03, 0X72, 0X88, 0X47, 0XE0, 0X2F, 0X4F, 0X7F,
+  0X0B, 0X90, 0X4F, 0X70, 0X4A, 0XCB, 0X90, 0X6A, 0XF0, 0XF3, 0XF1, 0XDD,
+  0XA9, 0X90, 0XF0, 0XE0, 0X92, 0X34, 0X20, 0X73, 0X77, 0X88, 0X18, 0XE5,
+  0X01, 0XBF, 0X3F, 0X1B, 0X03, 0X75, 0X8A, 0X33, 0X02, 0XF6, 0XF6, 0XF1,
+  0XC0, 0X52, 0XB0, 0X3F, 0X1F, 0X6F, 0X2A, 0X08, 0X24, 0X70, 0X5A, 0XBA,
+  0X0F, 0X0E, 0X09, 0X12, 0X11, 0X07, 0X37, 0X37, 0X97, 0X60, 0X1F, 0X3F,
+  0X4F, 0X1A, 0X03, 0X75, 0X7E, 0X03, 0XF3, 0XF5, 0XF0, 0XB9, 0X04, 0X4A,
+  0X03, 0XF9, 0XFB, 0XF1, 0X90, 0X72, 0X71, 0X77, 0X78, 0X71, 0X4A, 0X90,
+  0XB1, 0X11, 0X0F, 0X0E, 0X0C, 0XAA, 0X90, 0X53, 0X54, 0X02, 0XF5, 0XF6,
+  0XF2, 0XA0, 0X21, 0X72, 0X40, 0X3F, 0X5F, 0X3F, 0X1B, 0X04, 0X18, 0X6B,
+  0X50, 0X38, 0XC6, 0X86, 0X1F, 0X39, 0X06, 0X27, 0X68, 0X75, 0X8C, 0XF8,
+  0XFF, 0X7E, 0X4C, 0XB9, 0X09, 0X12, 0X22, 0X11, 0X0F, 0X0E, 0X09, 0X9A,
+  0XCB, 0XA9, 0X05, 0XAC, 0XF1, 0XF4, 0X01, 0XFB, 0XF8, 0XF0, 0X90, 0X39,
+  0XF6, 0X03, 0XF0, 0XF2, 0XF0, 0XA0, 0X44, 0X89, 0XF0, 0X3F, 0X98, 0XA7,
+  0XFE, 0XF1, 0X90, 0X66, 0X84, 0X18, 0XA7, 0X8F, 0XF0, 0X17, 0X0E, 0XA0,
+  0X91, 0X45, 0X43, 0X10, 0XF0, 0XE0, 0X99, 0XBB, 0XBA, 0X06, 0XAF, 0X2F,
+  0X9F, 0XF0, 0X0B, 0XF9, 0XF4, 0XC9, 0X02, 0X1F, 0X2F, 0XD0, 0X4D, 0XC9,
+  0X04, 0X74, 0X8E, 0X20, 0X2B, 0X8D, 0X6F, 0XDF, 0X8D, 0X06, 0X17, 0XC8,
+  0X70, 0X8E, 0X70, 0X2A, 0XF1, 0XB0, 0X81, 0X67, 0X27, 0X27, 0X04, 0X20,
+  0XF0, 0XE0, 0X99, 0XAB, 0XA9, 0X06, 0XAF, 0X1F, 0X4F, 0X7F, 0X1F, 0X8F,
+  0X5F, 0X0C, 0X04, 0XF2, 0XF8, 0X03, 0XAE, 0XC9, 0X04, 0X82, 0X98, 0XFF,
+  0X02, 0XFB, 0XF9, 0XF8, 0XF3, 0XA0, 0X66, 0X83, 0XC8, 0XAB, 0X8F, 0XF0,
+  0X2F, 0X4F, 0X1B, 0X90, 0X73, 0X73, 0X75, 0X74, 0X70, 0X30, 0XF0, 0XE0,
+  0XE0, 0X69, 0X01, 0XAB, 0XEF, 0X1F, 0X1A, 0X03, 0X9B, 0XC0, 0X3F, 0X5F,
+  0X0C, 0X90, 0X48, 0X47, 0X02, 0XF1, 0XF3, 0XF3, 0XF3, 0XF0, 0XA0, 0X67,
+  0X58, 0X5C, 0X8D, 0X40, 0X3F, 0X4E, 0X90, 0X71, 0X67, 0X17, 0X15, 0X30,
+  0XF0, 0XE0, 0X91, 0X22, 0X10, 0X73, 0X71, 0X74, 0X77, 0X71, 0XAE, 0XB9,
+  0X03, 0X17, 0X07, 0X60, 0X3F, 0X3F, 0X1B, 0X90, 0X47, 0XE0, 0X2F, 0X3D,
+  0XCD, 0XA9, 0X05, 0X14, 0X71, 0X70, 0X03, 0XA9, 0X90, 0X82, 0X00, 0X99,
+  0X99, 0X0F, 0X0E, 0X09, 0X12, 0X21, 0X00, 0X90, 0X53, 0X72, 0X78, 0X77,
+  0X30, 0X0F, 0X1D, 0XB9, 0X02, 0X16, 0X73, 0X02, 0XBF, 0X8F, 0X1B, 0X05,
+  0X7A, 0X01, 0XDE, 0XBA, 0XDB, 0X07, 0X57, 0X37, 0X30, 0X3E, 0XA0, 0X81,
+  0X11, 0X00, 0XAB, 0X99, 0X0F, 0X0E, 0X08, 0X13, 0X43, 0X10, 0X61, 0X74,
+  0X85, 0X48, 0XAD, 0X8F, 0XA0, 0X1D, 0XF0, 0X90, 0X36, 0X84, 0XC8, 0XC8,
+  0X02, 0XF8, 0XF9, 0XF0, 0XA0, 0X41, 0X88, 0X60, 0X12, 0X33, 0X00, 0X20,
+  0X8D, 0XF6, 0XFD, 0X03, 0XE9, 0X90, 0X79, 0XDF, 0X3F, 0X5F, 0X4E, 0XC9,
+  0X90, 0XF0, 0XE0, 0X81, 0X33, 0X21, 0X06, 0X27, 0X58, 0X6B, 0X8C, 0X85,
+  0X00, 0XBD, 0XC9, 0X03, 0X73, 0X86, 0X88, 0XE2, 0X02, 0XF6, 0XF2, 0XDA,
+  0X04, 0X1D, 0X01, 0X37, 0X15, 0X21, 0X10, 0X69, 0XF0, 0XFB, 0X8B, 0X80,
+  0X2D, 0XC9, 0X10, 0X79, 0XCE, 0XF0, 0XED, 0XA9, 0X0F, 0X0E, 0X08, 0X23,
+  0X31, 0X90, 0X66, 0X7A, 0X88, 0X37, 0XE0, 0X1D, 0XF2, 0XD9, 0X02, 0X17,
+  0XD8, 0X8C, 0X7B, 0X02, 0XF5, 0XF0, 0XD9, 0X04, 0X27, 0X00, 0X25, 0X54,
+  0X41, 0X10, 0X6C, 0XF4, 0X8A, 0X1F, 0X10, 0X1F, 0X4F, 0X39, 0X90, 0X8A,
+  0XCE, 0XDB, 0XA0, 0XF0, 0XE0, 0X71, 0X22, 0X21, 0X06, 0X17, 0X17, 0XB8,
+  0X9D, 0X7E, 0X01, 0XAF, 0X0B, 0X90, 0X22, 0X84, 0X48, 0XB4, 0X74, 0X01,
+  0XBF, 0X3E, 0X90, 0X51, 0XFC, 0XF4, 0X01, 0X71, 0X78, 0X73, 0X54, 0X10,
+  0X6E, 0XFC, 0X88, 0X38, 0XD4, 0X01, 0XFD, 0XF0, 0XC0, 0X9A, 0XCC, 0XCB,
+  0X99, 0X0F, 0X0E, 0X07, 0X12, 0X21, 0X01, 0X90, 0X41, 0X72, 0X79, 0X7B,
+  0X73, 0X01, 0XDB, 0XA0, 0X33, 0X86, 0X78, 0XD6, 0X02, 0XAC, 0XB9, 0X06,
+  0XFC, 0X8D, 0XD0, 0X27, 0X47, 0X77, 0X15, 0X10, 0X6B, 0XF7, 0X86, 0XA8,
+  0XB4, 0X8E, 0X2F, 0XBF, 0XAF, 0X29, 0X0A, 0XAB, 0XAA, 0X90, 0XF0, 0XE0,
+  0XA9, 0X99, 0X05, 0X24, 0X72, 0X72, 0X30, 0X1A, 0XA9, 0X90, 0X24, 0X87,
+  0XF7, 0XA0, 0X2B, 0XB0, 0X01, 0X10, 0X5F, 0X7F, 0X70, 0X37, 0X57, 0X12,
+  0X10, 0X6A, 0XF2, 0XFB, 0X89, 0XDF, 0XEF, 0XBF, 0X4B, 0X90, 0XC9, 0X0F,
+  0X0E, 0X08, 0X9A, 0XAA, 0X90, 0X51, 0X33, 0XA0, 0X2D, 0XCA, 0X03, 0X70,
+  0X77, 0X60, 0XC2, 0X30, 0X45, 0X14, 0X10, 0X8C, 0XF1, 0XF3, 0XF3, 0XF2,
+  0XD0, 0XC9, 0X00, 0X99, 0X0F, 0X0E, 0X06, 0X37, 0X07, 0X37, 0X25, 0X19,
+  0X90, 0X34, 0X7C, 0X84, 0X68, 0X8D, 0X8E, 0X00, 0X2F, 0XCF, 0X7E, 0X90,
+  0X11, 0X83, 0X48, 0XAB, 0XF1, 0X01, 0XDF, 0X9F, 0X6F, 0X3E, 0XA0, 0X42,
+  0XAA, 0X03, 0X2B, 0XC0, 0X8A, 0XF1, 0XF8, 0XFD, 0XFB, 0XF8, 0XF5, 0XDA,
+  0X0B, 0X90, 0XF0, 0XE0, 0X51, 0X46, 0X70, 0X53, 0X00, 0X90, 0X31, 0X47,
+  0X67, 0XF8, 0XA7, 0X7B, 0X01, 0XBF, 0XCF, 0X6E, 0X90, 0X12, 0X85, 0X07,
+  0XDB, 0XF4, 0XF1, 0XF4, 0XF5, 0XF2, 0XF4, 0XF0, 0XA9, 0X03, 0X46, 0X20,
+  0X3F, 0X5F, 0X2D, 0XA0, 0X61, 0X44, 0X25, 0X2A, 0X9B, 0X0C, 0X10, 0XF0,
+  0XE0, 0X51, 0X24, 0X45, 0X31, 0X99, 0X02, 0X91, 0X70, 0X78, 0X7C, 0X73,
+  0X01, 0XF1, 0XF9, 0XF6, 0XC9, 0X01, 0X17, 0XE7, 0X43, 0XF0, 0XF3, 0XF3,
+  0XF3, 0XF1, 0XF2, 0XDA, 0X04, 0X72, 0X79, 0X72, 0X03, 0XFC, 0XF7, 0XF0,
+  0XA0, 0X63, 0X74, 0X7B, 0X7E, 0X7B, 0X79, 0X73, 0X19, 0X90, 0XA1, 0X00,
+  0X11, 0X0F, 0X0E, 0X08, 0X12, 0X10, 0X6A, 0XB9, 0X23, 0X01, 0XF0, 0XF3,
+  0XEC, 0X90, 0X11, 0X00, 0XAB, 0XBF, 0X1F, 0X1C, 0XF1, 0XDC, 0X90, 0X31,
+  0X75, 0X7B, 0X50, 0X28, 0XE7, 0XFB, 0XF7, 0XF0, 0X90, 0X66, 0X7B, 0X87,
+  0XF8, 0XBF, 0X8E, 0X78, 0XEA, 0X79, 0X70, 0X10, 0XA1, 0X23, 0X21, 0X0F,
+  0X0E, 0X05, 0X99, 0X00, 0X10, 0X01, 0X06, 0XBF, 0X1F, 0X1C, 0XB0, 0X1B,
+  0XF0, 0XDA, 0X02, 0X9F, 0XAF, 0XDD, 0XDD, 0XDF, 0X0C, 0XF0, 0XD9, 0X03,
+  0X17, 0XC8, 0X99, 0X5F, 0X1F, 0X68, 0XE7, 0XFC, 0XFA, 0XF6, 0XF0, 0XA0,
+  0X51, 0X74, 0X85, 0X38, 0XA3, 0X8E, 0X28, 0XFF, 0X7E, 0X74, 0X19, 0X90,
+  0X82, 0X45, 0X54, 0X21, 0X0F, 0X0E, 0X06, 0X99, 0X00, 0X11, 0X10, 0X5A,
+  0XF0, 0XF0, 0XC0, 0X2B, 0XCD, 0XA0, 0X29, 0XFF, 0XFE, 0XA2, 0XBC, 0XF0,
+  0XCC, 0XB9, 0X03, 0X27, 0XE7, 0XDF, 0X08, 0XE0, 0X8D, 0XBF, 0XAF, 0X7F,
+  0X5F, 0X2D, 0X90, 0X53, 0X78, 0X86, 0XE8, 0XC6, 0X8F, 0XF0, 0X17, 0X52,
+  0X90, 0X81, 0X57, 0X17, 0X27, 0X15, 0X21, 0X0F, 0X0E, 0X05, 0X99, 0X90,
+  0X01, 0X21, 0X10, 0X49, 0XEF, 0X4F, 0X00, 0X23, 0X9B, 0X90, 0X29, 0XFE,
+  0X88, 0X6F, 0X0D, 0XDF, 0X0D, 0XCD, 0XA9, 0X04, 0X72, 0X72, 0XF3, 0XFC,
+  0XFE, 0XFC, 0XF9, 0XF3, 0XF1, 0XB9, 0X05, 0X57, 0XB8, 0X8A, 0X8E, 0X20,
+  0X25, 0XAA, 0X90, 0X74, 0X71, 0X74, 0X75, 0X74, 0X71, 0X41, 0X0F, 0X0E,
+  0X06, 0XAB, 0XDB, 0X92, 0X10, 0X49, 0XF0, 0XF9, 0XFD, 0XF3, 0X01, 0X73,
+  0X77, 0X72, 0X20, 0X2A, 0XFC, 0X86, 0XBF, 0X73, 0X32, 0X22, 0X40, 0X09,
+  0X03, 0XBF, 0X4A, 0XF2, 0XFA, 0XF5, 0XF4, 0XF2, 0XDD, 0XC0, 0X63, 0X72,
+  0X7C, 0X7B, 0X03, 0XBB, 0X99, 0X05, 0X14, 0X73, 0X77, 0X78, 0X76, 0X71,
+  0X41, 0X10, 0XF0 };
 
-// 23086 bytes
+// 14703 bytes
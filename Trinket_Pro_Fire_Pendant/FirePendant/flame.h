@@ -0,0 +1,73 @@
+// Decoder for the packed flame animation in data.h. Shared with the
+// flamepack encoder (one directory up), which checks every frame decodes
+// back exactly before writing data.h.
+//
+// Each frame is stored as its changes from the frame before, one pixel
+// at a time in img[] order (column-major, 9 x 16), as a stream of 4-bit
+// codes packed two per byte, high nibble first:
+//
+//   0 n     n < 15: next n+1 pixels unchanged. n = 15: rest of frame unchanged
+//   1-6     add 1-6 to pixel
+//   7 n     add 7+n to pixel
+//   8 h l   set pixel to 0xhl
+//   9-14    subtract 1-6 from pixel
+//   15 n    subtract 7+n from pixel
+//
+// A frame also ends after its 144th pixel. The first frame is relative to
+// a blank image, and the animation ends with an extra frame that changes
+// the last frame back into the first; playback then loops to the second.
+
+#ifndef _FLAME_H_
+#define _FLAME_H_
+
+#define FLAME_PIXELS (9 * 16)
+
+typedef struct {
+  uint16_t nibble; // Read position in animation data
+  uint16_t frame;  // Frame about to be decoded
+} FlameDecoder;
+
+static uint8_t flameNibble(FlameDecoder *d, const uint8_t *data) {
+  uint8_t b = pgm_read_byte(&data[d->nibble >> 1]);
+  return (d->nibble++ & 1) ? (b & 0x0F) : (b >> 4);
+}
+
+// Apply the next frame's changes to img[]. 'frames' and 'loop' are
+// ANIM_FRAMES and ANIM_LOOP from data.h.
+static void flameDecode(FlameDecoder *d, const uint8_t *data,
+  uint16_t frames, uint16_t loop, uint8_t *img) {
+  uint8_t i = 0, n, v;
+
+  if(d->frame > frames) { // Past the wrap-around frame, back to the second
+    d->frame  = 1;
+    d->nibble = loop;
+  }
+  d->frame++;
+
+  while(i < FLAME_PIXELS) {
+    n = flameNibble(d, data);
+    switch(n) {
+     case 0:                                 // Skip unchanged pixels
+      n = flameNibble(d, data);
+      if(n == 15) return;
+      i += n + 1;
+      break;
+     case 8:                                 // Literal
+      v       = flameNibble(d, data) << 4;
+      img[i++] = v | flameNibble(d, data);
+      break;
+     case 7:                                 // Larger step up
+      img[i++] += 7 + flameNibble(d, data);
+      break;
+     case 15:                                // Larger step down
+      img[i++] -= 7 + flameNibble(d, data);
+      break;
+     default:                                // Small step, 1-6 or 9-14
+      if(n & 8) img[i++] -= n & 7;
+      else      img[i++] += n;
+      break;
+    }
+  }
+}
+
+#endif // _FLAME_H_
@@ -0,0 +1,177 @@
+// Flame pendant animation packer. Runs on the host, not the Trinket.
+//
+// Reads the data.h written by convert.py (in frames.zip): per frame, a
+// bounding rectangle and raw pixel bytes. Writes a data.h in the packed
+// delta format that FirePendant/flame.h decodes. Before writing, it decodes
+// the packed data with that same decoder, twice through the loop, and
+// checks every frame matches exactly.
+//
+//   g++ -O2 -o flamepack flamepack.cpp
+//   python convert.py frames/*.png > rect.h
+//   ./flamepack rect.h > FirePendant/data.h
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <vector>
+
+#define pgm_read_byte(p) (*(const uint8_t *)(p))
+#include "FirePendant/flame.h"
+
+typedef std::vector<uint8_t> Frame;
+
+// Pull every 0xNN byte following the opening brace of the array, and
+// any comment lines at the top of the file (credits) to carry over
+static std::vector<uint8_t> readBytes(const char *filename, std::string &credits) {
+  std::vector<uint8_t> bytes;
+  FILE *f = fopen(filename, "r");
+  if(!f) {
+    perror(filename);
+    exit(1);
+  }
+  char line[256];
+  while(fgets(line, sizeof line, f) && !strncmp(line, "//", 2)) credits += line;
+  fseek(f, 0, SEEK_SET);
+  int c, inArray = 0;
+  while((c = fgetc(f)) != EOF) {
+    if(c == '{') inArray = 1;
+    if(c == '}') break;
+    if(inArray && c == '0') {
+      int x = fgetc(f);
+      unsigned v;
+      if(((x == 'x') || (x == 'X')) && (fscanf(f, "%2x", &v) == 1)) {
+        bytes.push_back(v);
+      }
+    }
+  }
+  fclose(f);
+  return bytes;
+}
+
+// Play the rectangle format exactly as the old sketch did
+static std::vector<Frame> unpackRects(const std::vector<uint8_t> &in) {
+  std::vector<Frame> frames;
+  Frame img(FLAME_PIXELS, 0);
+  size_t p = 0;
+  while((p + 1 < in.size()) && (in[p] < 0x90)) {
+    uint8_t x1 = in[p] >> 4, y1 = in[p] & 0x0F;
+    uint8_t x2 = in[p + 1] >> 4, y2 = in[p + 1] & 0x0F;
+    p += 2;
+    for(uint8_t x = x1; x <= x2; x++) {
+      for(uint8_t y = y1; y <= y2; y++) {
+        if(p >= in.size()) {
+          fprintf(stderr, "Truncated animation data\n");
+          exit(1);
+        }
+        img[(x << 4) + y] = in[p++];
+      }
+    }
+    frames.push_back(img);
+  }
+  return frames;
+}
+
+// Append the codes turning 'prev' into 'cur'
+static void packFrame(const Frame &prev, const Frame &cur,
+  std::vector<uint8_t> &nibbles) {
+  int i = 0;
+  while(i < FLAME_PIXELS) {
+    if(cur[i] == prev[i]) {
+      int j = i;
+      while((j < FLAME_PIXELS) && (cur[j] == prev[j])) j++;
+      if(j == FLAME_PIXELS) { // Rest of frame unchanged
+        nibbles.push_back(0);
+        nibbles.push_back(15);
+        return;
+      }
+      for(int run = j - i; run > 0; run -= 15) {
+        nibbles.push_back(0);
+        nibbles.push_back((run > 15 ? 15 : run) - 1);
+      }
+      i = j;
+      continue;
+    }
+    int d = (int8_t)(cur[i] - prev[i]);
+    if((d >= 1) && (d <= 6)) {
+      nibbles.push_back(d);
+    } else if((d <= -1) && (d >= -6)) {
+      nibbles.push_back(8 - d);
+    } else if((d >= 7) && (d <= 22)) {
+      nibbles.push_back(7);
+      nibbles.push_back(d - 7);
+    } else if((d <= -7) && (d >= -22)) {
+      nibbles.push_back(15);
+      nibbles.push_back(-d - 7);
+    } else {
+      nibbles.push_back(8);
+      nibbles.push_back(cur[i] >> 4);
+      nibbles.push_back(cur[i] & 0x0F);
+    }
+    i++;
+  }
+}
+
+int main(int argc, char *argv[]) {
+  if(argc != 2) {
+    fprintf(stderr, "Usage: %s rect.h > data.h\n", argv[0]);
+    return 1;
+  }
+
+  std::string          credits;
+  std::vector<uint8_t> rects = readBytes(argv[1], credits);
+  std::vector<Frame>   frames = unpackRects(rects);
+  if(frames.empty()) {
+    fprintf(stderr, "No frames found in %s\n", argv[1]);
+    return 1;
+  }
+  uint16_t count = frames.size();
+
+  // First frame against blank, the rest in order, then back to the first
+  std::vector<uint8_t> nibbles;
+  packFrame(Frame(FLAME_PIXELS, 0), frames[0], nibbles);
+  uint32_t loop = nibbles.size(), maxNibbles = 0;
+  for(uint16_t f = 1; f <= count; f++) {
+    size_t start = nibbles.size();
+    packFrame(frames[f - 1], frames[f % count], nibbles);
+    if(nibbles.size() - start > maxNibbles) maxNibbles = nibbles.size() - start;
+  }
+  if(nibbles.size() > 0xFFFF) {
+    fprintf(stderr, "Animation too long for 16-bit nibble offsets\n");
+    return 1;
+  }
+
+  std::vector<uint8_t> packed((nibbles.size() + 1) / 2, 0);
+  for(size_t n = 0; n < nibbles.size(); n++) {
+    packed[n >> 1] |= (n & 1) ? nibbles[n] : (nibbles[n] << 4);
+  }
+
+  // Round trip through the sketch's decoder, twice around the loop
+  FlameDecoder d = { 0, 0 };
+  uint8_t      img[FLAME_PIXELS] = { 0 };
+  for(uint32_t f = 0; f < 2u * count; f++) {
+    flameDecode(&d, packed.data(), count, loop, img);
+    if(memcmp(img, frames[f % count].data(), FLAME_PIXELS)) {
+      fprintf(stderr, "Round trip mismatch at frame %u\n", f);
+      return 1;
+    }
+  }
+
+  printf("%s", credits.c_str());
+  printf("// Packed by flamepack from %u frames; see flame.h for the format.\n\n", count);
+  printf("#define ANIM_FRAMES %u\n", count);
+  printf("#define ANIM_LOOP   %u // Nibble offset of second frame\n\n", (unsigned)loop);
+  printf("const uint8_t PROGMEM anim[] = {");
+  for(size_t n = 0; n < packed.size(); n++) {
+    printf("%s0X%02X%s", (n % 12) ? " " : "\n  ", packed[n],
+      (n + 1 < packed.size()) ? "," : "");
+  }
+  printf(" };\n\n// %u bytes\n", (unsigned)packed.size());
+
+  fprintf(stderr, "%u frames: %u bytes as rectangles, %u bytes packed (%.2f:1)\n",
+    count, (unsigned)rects.size(), (unsigned)packed.size(),
+    (double)rects.size() / packed.size());
+  fprintf(stderr, "Round trip OK. Most codes in one frame: %u nibbles\n", maxNibbles);
+  return 0;
+}
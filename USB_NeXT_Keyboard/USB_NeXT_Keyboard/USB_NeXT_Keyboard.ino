@@ -10,10 +10,15 @@
 
 #include "wsksymdef.h"
 #include "nextkeyboard.h"
+#include "nextbus.h"
 
 // the timing per bit, 50microseconds
 #define TIMING 50
 
+// how often to ask the keyboard for keys, in milliseconds. The protocol
+// runs from a timer interrupt now, so polling costs the loop nothing
+#define POLL_MS 5
+
 // pick which pins you want to use
 #define KEYBOARDOUT 3
 #define KEYBOARDIN 2
@@ -21,17 +26,19 @@
 // comment to speed things up, uncomment for help!
 //#define DEBUG 
 
-// speed up reads by caching the 'raw' pin ports
+// speed up reads and writes by caching the 'raw' pin ports
 volatile uint8_t *misoportreg;
 uint8_t misopin;
-// our little macro
+volatile uint8_t *mosiportreg;
+uint8_t mosipin;
+// our little macros
 #define readkbd() ((*misoportreg) & misopin)
+#define writekbd(x) do { if (x) *mosiportreg |= mosipin; \
+                         else *mosiportreg &= ~mosipin; } while (0)
 
 // debugging/activity LED
 #define LED 13
 
-#define NEXT_KMBUS_IDLE 0x200600
-
 // NeXT Keyboard Defines
 // modifiers
 #define NEXT_KB_CONTROL 0x1000
@@ -42,58 +49,27 @@ uint8_t misopin;
 #define NEXT_KB_SHIFT_LEFT 0x2000
 #define NEXT_KB_SHIFT_RIGHT 0x4000
 
-// special command for setting LEDs
-void setLEDs(bool leftLED, bool rightLED) {
-  digitalWrite(KEYBOARDOUT, LOW);
-  delayMicroseconds(TIMING *9);
-  digitalWrite(KEYBOARDOUT, HIGH);  
-  delayMicroseconds(TIMING *3);
-  digitalWrite(KEYBOARDOUT, LOW);
-  delayMicroseconds(TIMING);
-
-  if (leftLED)
-      digitalWrite(KEYBOARDOUT, HIGH);
-  else 
-      digitalWrite(KEYBOARDOUT, LOW);
-  delayMicroseconds(TIMING);
-
-  if (rightLED)
-      digitalWrite(KEYBOARDOUT, HIGH);
-  else 
-      digitalWrite(KEYBOARDOUT, LOW);
-  delayMicroseconds(TIMING);
-  digitalWrite(KEYBOARDOUT, LOW);
-  delayMicroseconds(TIMING *7);
-  digitalWrite(KEYBOARDOUT, HIGH);
-}
+// the protocol engine, driven by Timer1 and the data pin interrupt
+NextBus bus;
+bool    shiftLEDs = false;   // what we last asked the keyboard LEDs to show
+#ifdef DEBUG
+uint32_t worstLatency = 0;   // longest wait from response to USB, in us
+#endif
 
-void query() {
-  // query the keyboard for data
-  digitalWrite(KEYBOARDOUT, LOW);
-  delayMicroseconds(TIMING *5);
-  digitalWrite(KEYBOARDOUT, HIGH);  
-  delayMicroseconds(TIMING );  
-  digitalWrite(KEYBOARDOUT, LOW);
-  delayMicroseconds(TIMING *3);
-  digitalWrite(KEYBOARDOUT, HIGH); 
+// every bit time: sample the keyboard, drive the next output level
+ISR(TIMER1_COMPA_vect) {
+  writekbd(nextbus_tick(&bus, readkbd()));
 }
 
-void nextreset() {
-  // reset the keyboard
-  digitalWrite(KEYBOARDOUT, LOW);
-  delayMicroseconds(TIMING);
-  digitalWrite(KEYBOARDOUT, HIGH);  
-  delayMicroseconds(TIMING*4);  
-  digitalWrite(KEYBOARDOUT, LOW);
-  delayMicroseconds(TIMING);
-  digitalWrite(KEYBOARDOUT, HIGH);
-  delayMicroseconds(TIMING*6);
-  digitalWrite(KEYBOARDOUT, LOW);
-  delayMicroseconds(TIMING*10);  
-  digitalWrite(KEYBOARDOUT, HIGH);
+// falling edge on the keyboard data line
+void startBit() {
+  if (nextbus_edge(&bus)) {
+    // start of a response or a bit within it; sample mid-bit from here
+    TCNT1 = OCR1A / 2;
+    TIFR1 = _BV(OCF1A);
+  }
 }
 
-
 void setup() {
   // set up pin directions
   pinMode(KEYBOARDOUT, OUTPUT);
@@ -102,20 +78,28 @@ void setup() {
   
   misoportreg = portInputRegister(digitalPinToPort(KEYBOARDIN));
   misopin = digitalPinToBitMask(KEYBOARDIN);
-  
-  // according to http://cfile7.uf.tistory.com/image/14448E464F410BF22380BB
-  query();
-  delay(5);
-  nextreset();
-  delay(8);
-  
-  query();
-  delay(5);
-  nextreset();
-  delay(8);
-  
+  mosiportreg = portOutputRegister(digitalPinToPort(KEYBOARDOUT));
+  mosipin = digitalPinToBitMask(KEYBOARDOUT);
+  digitalWrite(KEYBOARDOUT, HIGH);
+
   Keyboard.begin();
 
+  // the engine starts with query/reset twice, according to
+  // http://cfile7.uf.tistory.com/image/14448E464F410BF22380BB
+  // then polls every POLL_MS
+  nextbus_begin(&bus, POLL_MS * 1000 / TIMING);
+  attachInterrupt(digitalPinToInterrupt(KEYBOARDIN), startBit, FALLING);
+
+  // Timer1 in CTC mode, no prescaler, interrupt every TIMING microseconds
+  noInterrupts();
+  TCCR1A = 0;
+  TCCR1B = _BV(WGM12) | _BV(CS10);
+  TCNT1  = 0;
+  OCR1A  = (F_CPU / 1000000) * TIMING - 1;
+  TIFR1  = _BV(OCF1A);
+  TIMSK1 = _BV(OCIE1A);
+  interrupts();
+
 #ifdef DEBUG
   while (!Serial)
   Serial.begin(57600);
@@ -123,35 +107,35 @@ void setup() {
 #endif
 }
 
-uint32_t getresponse() {
-  // bitbang timing, read 22 bits 50 microseconds apart
-  cli();
-  while ( readkbd() );
-  delayMicroseconds(TIMING/2);
-  uint32_t data = 0;
-  for (uint8_t i=0; i < 22; i++) {
-      if (readkbd())
-        data |= ((uint32_t)1 << i);
-      delayMicroseconds(TIMING);
-  }
-  sei();
-  return data;
-
-}
-
 void loop() {
-  digitalWrite(LED, LOW);
-  delay(20);
-  uint32_t resp;
-  query();
-  resp = getresponse();
+  NextEvent event;
+
+  // idle responses never make it into the queue
+  if (!nextbus_read(&bus, &event)) {
+    digitalWrite(LED, LOW);
+    return;
+  }
 
-  // check for a 'idle' response, we'll do nothing
-  if (resp == NEXT_KMBUS_IDLE) return;
-  
   // turn on the LED when we get real resposes!
   digitalWrite(LED, HIGH);
+  handleResponse(event.data);
+
+#ifdef DEBUG
+  // time from the last response bit to the USB report going out; add up to
+  // POLL_MS plus ~1.6 ms of query and response for the whole keypress
+  noInterrupts();
+  uint16_t now = bus.tick;
+  interrupts();
+  uint32_t latency = (uint32_t)(uint16_t)(now - event.tick) * TIMING;
+  if (latency > worstLatency) worstLatency = latency;
+  Serial.print("latency: "); Serial.print(latency);
+  Serial.print(" us, worst: "); Serial.print(worstLatency);
+  Serial.print(" us, lost: "); Serial.print(bus.overflows);
+  Serial.print(", timeouts: "); Serial.println(bus.timeouts);
+#endif
+}
 
+void handleResponse(uint32_t resp) {
   // keycode is the lower 7 bits
   uint8_t keycode = resp & 0xFF;
   keycode /= 2;
@@ -180,11 +164,11 @@ void loop() {
   }
   boolean shiftPressed = (resp & (NEXT_KB_SHIFT_LEFT|NEXT_KB_SHIFT_RIGHT)) != 0;
   
-  // turn on shift LEDs if shift is held down
-  if (shiftPressed)
-    setLEDs(true, true);
-  else
-    setLEDs(false, false);
+  // turn on shift LEDs if shift is held down (sent with the next query)
+  if (shiftPressed != shiftLEDs) {
+    shiftLEDs = shiftPressed;
+    nextbus_setLEDs(&bus, shiftPressed, shiftPressed);
+  }
     
   if (resp & NEXT_KB_COMMAND_LEFT)
     Keyboard.press(KEY_LEFT_GUI);
@@ -0,0 +1,215 @@
+// NeXT keyboard bus engine
+//
+// Runs the keyboard protocol in the background, one 50 microsecond bit time
+// per call to nextbus_tick() from a timer interrupt: sends the reset, query
+// and LED commands, waits for the keyboard's 22-bit response and samples it
+// mid-bit, then queues every non-idle response for the main loop to turn
+// into USB keypresses. Nothing here touches pins or timers -- the sketch
+// supplies those -- so the same code can be fed recorded bit streams on a
+// PC to check it.
+//
+// The sketch's pin interrupt calls nextbus_edge() on each falling edge of
+// the keyboard's data line. When that's the start of a response, or a bit
+// boundary within one, it returns nonzero and the timer should be restarted
+// so the next tick lands half a bit time later, mid-bit. Resyncing on every
+// edge keeps keyboard clock error and interrupt latency from adding up over
+// the 22 bits.
+
+#ifndef _NEXTBUS_H_
+#define _NEXTBUS_H_
+
+#include <stdint.h>
+
+#define NEXT_KMBUS_IDLE  0x200600 // Response when no key has changed
+#define NEXT_BITS        22       // Bits per response
+#define NEXT_TIMEOUT     100      // Bit times to wait for a response (5 ms)
+#define NEXT_GAP         20       // Bit times between LED command and query
+#define NEXT_FIFO_SIZE   16       // Queued responses, must be a power of 2
+#define NEXT_MAX_SEGS    40       // Longest command sequence, in segments
+
+#define NEXT_LEDS_PENDING 0x04    // nextbus.leds: send at next poll
+#define NEXT_LEDS_LEFT    0x02
+#define NEXT_LEDS_RIGHT   0x01
+
+enum { NEXT_IDLE, NEXT_SEND, NEXT_WAIT, NEXT_RECEIVE };
+
+typedef struct {
+  uint32_t data;                  // Raw 22-bit response
+  uint16_t tick;                  // nextbus.tick when it finished arriving
+} NextEvent;
+
+typedef struct {
+  // Interrupt side only
+  uint8_t  state;
+  uint8_t  seg[NEXT_MAX_SEGS];    // Output: bit 7 = level, 6-0 = bit times
+  uint8_t  numSegs, segIdx, segLeft, level;
+  uint8_t  query;                 // A response follows the current send
+  uint16_t count;                 // Bit times left to idle or wait
+  uint16_t pollTicks;             // Bit times between queries
+  uint8_t  bit;                   // Response bits received so far
+  uint32_t data;
+  // Shared with the main loop
+  volatile uint16_t tick;         // Free-running bit time counter
+  volatile uint8_t  leds;         // NEXT_LEDS_* bits, written by loop
+  volatile uint8_t  head, tail;   // head written by interrupt, tail by loop
+  volatile uint8_t  overflows;    // Responses lost to a full queue
+  volatile uint8_t  timeouts;     // Queries the keyboard didn't answer
+  volatile NextEvent fifo[NEXT_FIFO_SIZE];
+} NextBus;
+
+// Add 'ticks' bit times at 'level' to the command being built
+static void nextbus_append(NextBus *b, uint8_t level, uint16_t ticks) {
+  while(ticks && (b->numSegs < NEXT_MAX_SEGS)) {
+    uint8_t n = (ticks > 127) ? 127 : ticks;
+    b->seg[b->numSegs++] = (level ? 0x80 : 0) | n;
+    ticks -= n;
+  }
+}
+
+// These are the same waveforms the sketch used to bit-bang with
+// delayMicroseconds(); each leaves the line high when done
+static void nextbus_appendQuery(NextBus *b) {
+  nextbus_append(b, 0, 5);
+  nextbus_append(b, 1, 1);
+  nextbus_append(b, 0, 3);
+}
+
+static void nextbus_appendReset(NextBus *b) {
+  nextbus_append(b, 0, 1);
+  nextbus_append(b, 1, 4);
+  nextbus_append(b, 0, 1);
+  nextbus_append(b, 1, 6);
+  nextbus_append(b, 0, 10);
+}
+
+static void nextbus_appendLEDs(NextBus *b, uint8_t leds) {
+  nextbus_append(b, 0, 9);
+  nextbus_append(b, 1, 3);
+  nextbus_append(b, 0, 1);
+  nextbus_append(b, leds & NEXT_LEDS_LEFT, 1);
+  nextbus_append(b, leds & NEXT_LEDS_RIGHT, 1);
+  nextbus_append(b, 0, 7);
+}
+
+// Start over, sending the power-up sequence (query, reset, twice) and
+// then polling the keyboard every 'pollTicks' bit times
+static void nextbus_begin(NextBus *b, uint16_t pollTicks) {
+  uint8_t i;
+  b->numSegs = b->segIdx = b->segLeft = 0;
+  b->level   = 1;
+  b->query   = 0;
+  b->bit     = 0;
+  b->data    = 0;
+  b->leds    = 0;
+  b->head    = b->tail = 0;
+  b->tick    = 0;
+  b->overflows = b->timeouts = 0;
+  b->pollTicks = pollTicks ? pollTicks : 1;
+  for(i=0; i<2; i++) {
+    nextbus_appendQuery(b);
+    nextbus_append(b, 1, 100);    // 5 ms
+    nextbus_appendReset(b);
+    nextbus_append(b, 1, 160);    // 8 ms
+  }
+  b->state = NEXT_SEND;
+}
+
+// Call once per bit time. 'in' is the keyboard data line (sampled mid-bit
+// while receiving); returns the level to drive on the line to the keyboard.
+static uint8_t nextbus_tick(NextBus *b, uint8_t in) {
+  b->tick++;
+
+  switch(b->state) {
+   case NEXT_RECEIVE:
+    if(in) b->data |= (uint32_t)1 << b->bit;
+    if(++b->bit >= NEXT_BITS) {
+      if(b->data != NEXT_KMBUS_IDLE) {
+        uint8_t next = (b->head + 1) & (NEXT_FIFO_SIZE - 1);
+        if(next == b->tail) {
+          b->overflows++;
+        } else {
+          b->fifo[b->head].data = b->data;
+          b->fifo[b->head].tick = b->tick;
+          b->head = next;         // Publish only after the entry is written
+        }
+      }
+      b->state = NEXT_IDLE;
+      b->count = b->pollTicks;
+    }
+    return 1;
+
+   case NEXT_WAIT:
+    if(!--b->count) {
+      b->timeouts++;
+      b->state = NEXT_IDLE;
+      b->count = b->pollTicks;
+    }
+    return 1;
+
+   case NEXT_IDLE:
+    if(--b->count) return 1;
+    // Time to poll: update LEDs first if the loop asked, then query
+    b->numSegs = b->segIdx = b->segLeft = 0;
+    if(b->leds & NEXT_LEDS_PENDING) {
+      uint8_t leds = b->leds;
+      b->leds = leds & ~NEXT_LEDS_PENDING;
+      nextbus_appendLEDs(b, leds);
+      nextbus_append(b, 1, NEXT_GAP);
+    }
+    nextbus_appendQuery(b);
+    b->query = 1;
+    b->state = NEXT_SEND;
+    // Fall through - start sending on this tick
+
+   case NEXT_SEND:
+    if(!b->segLeft) {
+      if(b->segIdx >= b->numSegs) { // Finished; line goes high
+        if(b->query) {
+          b->state = NEXT_WAIT;
+          b->count = NEXT_TIMEOUT;
+        } else {
+          b->state = NEXT_IDLE;
+          b->count = b->pollTicks;
+        }
+        b->level = 1;
+        return 1;
+      }
+      uint8_t s  = b->seg[b->segIdx++];
+      b->level   = s >> 7;
+      b->segLeft = s & 0x7F;
+    }
+    b->segLeft--;
+    return b->level;
+  }
+  return 1;
+}
+
+// Call on each falling edge of the keyboard data line. Returns 1 if it's
+// part of a response; the next tick must then come half a bit later.
+static uint8_t nextbus_edge(NextBus *b) {
+  if(b->state == NEXT_RECEIVE) return 1; // Bit boundary, resync
+  if(b->state != NEXT_WAIT) return 0;
+  b->state = NEXT_RECEIVE;
+  b->bit   = 0;
+  b->data  = 0;
+  return 1;
+}
+
+// Main loop: set the keyboard LEDs at the next poll
+static void nextbus_setLEDs(NextBus *b, uint8_t left, uint8_t right) {
+  b->leds = NEXT_LEDS_PENDING | (left ? NEXT_LEDS_LEFT : 0) |
+            (right ? NEXT_LEDS_RIGHT : 0);
+}
+
+// Main loop: take the oldest queued response, if any. Lock-free; the
+// interrupt only writes 'head' and the loop only writes 'tail'.
+static uint8_t nextbus_read(NextBus *b, NextEvent *e) {
+  uint8_t t = b->tail;
+  if(t == b->head) return 0;
+  e->data = b->fifo[t].data;
+  e->tick = b->fifo[t].tick;
+  b->tail = (t + 1) & (NEXT_FIFO_SIZE - 1);
+  return 1;
+}
+
+#endif // _NEXTBUS_H_
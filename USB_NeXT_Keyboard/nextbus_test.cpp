@@ -0,0 +1,204 @@
+// Host test for USB_NeXT_Keyboard/nextbus.h. Runs on a PC, not the board.
+//
+// A simulated keyboard watches the line the engine drives, recognises the
+// reset, query and LED commands by their segment lengths, and answers each
+// query 10-100 us later with a 22-bit response: the next queued key event,
+// or the idle response. Time runs in 1 us steps. The engine's timer tick
+// comes every 50 us, the pin interrupt reaches nextbus_edge() after a
+// random latency, and the keyboard's own bit clock is off by a random
+// amount for each response. A minute of random keypresses, with bursts,
+// must come out of nextbus_read() complete, in order and unchanged.
+//
+//   g++ -O2 -o nextbus_test nextbus_test.cpp
+//   ./nextbus_test
+//
+// Exits nonzero on failure.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <vector>
+#include <deque>
+#include <utility>
+#include "USB_NeXT_Keyboard/nextbus.h"
+
+#define BIT_US 50
+
+typedef std::vector<std::pair<int, long> > Segments; // level, microseconds
+
+// The keyboard end of the line
+struct Keyboard {
+  std::deque<std::pair<uint32_t, long> > keys;  // Events waiting to be sent
+  Segments hist;                                // Recent host segments
+  int      lastHost, leds, resets, queries, ledCmds, clockPct;
+  long     lastEdge, respStart;
+  uint32_t resp;
+  double   period;
+
+  Keyboard(int clockPct) : lastHost(1), leds(-1), resets(0), queries(0),
+    ledCmds(0), clockPct(clockPct), lastEdge(0), respStart(-1), resp(0),
+    period(BIT_US) { }
+
+  // The host's output level at time t
+  void host(int level, long t) {
+    if (level == lastHost) return;
+    hist.push_back(std::make_pair(lastHost, t - lastEdge));
+    if (hist.size() > 6) hist.erase(hist.begin());
+    lastEdge = t;
+    lastHost = level;
+    if (level) command(t);
+  }
+
+  // True if the last host segments are 'pat', in bit times
+  bool ends(const int (*pat)[2], size_t n) {
+    if (hist.size() < n) return false;
+    size_t o = hist.size() - n;
+    for (size_t i = 0; i < n; i++)
+      if (hist[o + i].first != pat[i][0] ||
+          labs(hist[o + i].second - pat[i][1] * BIT_US) > 5) return false;
+    return true;
+  }
+
+  void command(long t) {
+    static const int query[][2] = { {0, 5}, {1, 1}, {0, 3} };
+    static const int reset[][2] = { {0, 1}, {1, 4}, {0, 1}, {1, 6}, {0, 10} };
+    if (ends(query, 3)) {
+      queries++;
+      resp = keys.empty() ? NEXT_KMBUS_IDLE : keys.front().first;
+      respStart = t + 10 + rand() % 90;
+      period = BIT_US * (1 + (rand() % (2 * clockPct + 1) - clockPct) / 100.0);
+      return;
+    }
+    if (ends(reset, 5)) {
+      resets++;
+      return;
+    }
+    // LED command: L9 H3, then 10 data bits whose segments merge by level
+    for (size_t i = 0; i + 1 < hist.size(); i++) {
+      if (hist[i].first || labs(hist[i].second - 9 * BIT_US) > 5 ||
+          !hist[i + 1].first || labs(hist[i + 1].second - 3 * BIT_US) > 5) continue;
+      std::vector<int> bits;
+      for (size_t j = i + 2; j < hist.size(); j++)
+        for (int k = 0; k < (hist[j].second + BIT_US / 2) / BIT_US; k++)
+          bits.push_back(hist[j].first);
+      if (bits.size() == 10) {
+        leds = bits[1] * 2 + bits[2];
+        ledCmds++;
+      }
+      hist.clear();
+      return;
+    }
+  }
+
+  // The keyboard's output level at time t
+  int line(long t) {
+    if (respStart < 0 || t < respStart) return 1;
+    long b = (long)((t - respStart) / period);
+    if (b >= NEXT_BITS) {
+      if (resp != NEXT_KMBUS_IDLE) keys.pop_front();
+      respStart = -1;
+      return 1;
+    }
+    return (resp >> b) & 1;
+  }
+};
+
+typedef struct {
+  int    keys, decoded, wrong, queries, resets, timeouts, overflows, ledCmds;
+  double avgMs, maxMs;        // Keypress to loop()
+} Result;
+
+// One minute of typing; pollUs is the query interval, latencyUs the
+// longest pin interrupt latency
+static Result run(int clockPct, int latencyUs, long pollUs) {
+  Result   r = {};
+  NextBus  bus;
+  Keyboard kbd(clockPct);
+  std::deque<std::pair<uint32_t, long> > expect;
+  long     nextTick = BIT_US, edgeAt = -1, nextKey = 40000, sum = 0, max = 0;
+  int      lastIn = 1, out = 1;
+  uint32_t seq = 0;
+
+  srand(39);
+  nextbus_begin(&bus, pollUs / BIT_US);
+  for (long t = 0; t < 60L * 1000000; t++) {
+    if ((t == nextKey) && (t < 59L * 1000000)) { // Last second drains
+      // Make and break codes with the shift modifier on alternate keys
+      uint32_t code = ((seq & 0x7F) << 1) | 0x400 | ((seq & 1) ? 0x2000 : 0);
+      seq++;
+      kbd.keys.push_back(std::make_pair(code, t));
+      expect.push_back(std::make_pair(code, t));
+      nextKey = t + 2000 + rand() % 60000;
+      if (seq % 50 == 0) nextKey = t + 300; // Bursts
+    }
+    int in = kbd.line(t);
+    if (lastIn && !in) edgeAt = t + rand() % (latencyUs + 1);
+    lastIn = in;
+    if (edgeAt == t) {
+      edgeAt = -1;
+      if (nextbus_edge(&bus)) nextTick = t + BIT_US / 2; // Timer restarted
+    }
+    if (t == nextTick) {
+      out = nextbus_tick(&bus, in);
+      nextTick = t + BIT_US;
+    }
+    kbd.host(out, t);
+    if (t % 200 == 0) { // loop()
+      NextEvent e;
+      while (nextbus_read(&bus, &e)) {
+        r.decoded++;
+        if (expect.empty() || (expect.front().first != e.data)) {
+          r.wrong++;
+          continue;
+        }
+        long l = t - expect.front().second;
+        sum += l;
+        if (l > max) max = l;
+        expect.pop_front();
+        uint8_t shift = (e.data & 0x2000) != 0;
+        nextbus_setLEDs(&bus, shift, shift);
+      }
+    }
+  }
+  r.keys      = seq;
+  r.queries   = kbd.queries;
+  r.resets    = kbd.resets;
+  r.ledCmds   = kbd.ledCmds;
+  r.timeouts  = bus.timeouts;
+  r.overflows = bus.overflows;
+  r.avgMs     = r.decoded ? sum / 1000.0 / r.decoded : 0;
+  r.maxMs     = max / 1000.0;
+  return r;
+}
+
+static int failures = 0;
+
+static void check(bool ok, const char *what) {
+  if (!ok) { printf("FAIL: %s\n", what); failures++; }
+}
+
+int main(void) {
+  static const struct { int clockPct, latencyUs; } cases[] = {
+    { 0, 0 }, { 1, 15 }, { 2, 8 }
+  };
+  for (size_t i = 0; i < sizeof cases / sizeof cases[0]; i++) {
+    Result r = run(cases[i].clockPct, cases[i].latencyUs, 5000);
+    printf("+/-%d%% clock, 0-%2d us latency: %d/%d decoded, %d wrong, "
+           "%d timeouts, %d lost, %d LED commands; press to loop() "
+           "avg %.1f ms, max %.1f ms\n",
+           cases[i].clockPct, cases[i].latencyUs, r.decoded, r.keys, r.wrong,
+           r.timeouts, r.overflows, r.ledCmds, r.avgMs, r.maxMs);
+    check(r.decoded == r.keys, "every key decoded");
+    check(r.wrong == 0, "no wrong codes");
+    check(r.timeouts == 0 && r.overflows == 0, "no timeouts or lost responses");
+    check(r.resets == 2, "power-up resets");
+    check(r.ledCmds > 0, "LED commands sent");
+  }
+
+  // The old sketch's ~22.6 ms query interval, for comparison
+  Result r = run(1, 15, 22600);
+  printf("22.6 ms polling:                 %d/%d decoded; press to loop() "
+         "avg %.1f ms, max %.1f ms\n", r.decoded, r.keys, r.avgMs, r.maxMs);
+  check(r.decoded == r.keys && r.wrong == 0, "slow polling still decodes");
+
+  return failures ? 1 : 0;
+}
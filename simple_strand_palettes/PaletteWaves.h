@@ -0,0 +1,146 @@
+// Palette color waves
+//
+// Same animation as Mark Kriegsman's colorwaves() from ColorWavesWithPalettes,
+// restructured so the per-pixel work is table lookups and 8-bit math:
+//
+//  - The palette is expanded to a 256-entry table (hue fold and the
+//    scale8(index, 240) already applied) only when the palette changes,
+//    instead of a ColorFromPalette() interpolation per pixel per frame.
+//  - The squared-sine brightness curve is a 257-entry table walked by the
+//    same 16-bit phase accumulator, interpolated on the low byte, so there's
+//    no sin16() or 32-bit multiply per pixel.
+//
+// Output matches colorwaves() to within a couple of brightness steps. Set
+// 'dither' to spread the fractional part of each pixel's brightness over
+// successive frames rather than truncating it.
+//
+//   PaletteWaves waves;
+//   ...
+//   waves.draw(leds, NUM_LEDS, currentPalette);
+//   FastLED.show();
+//
+// The expanded palette costs 768 bytes of RAM; on small AVRs (ATmega328P,
+// 32u4) there isn't room for it beside a long strand, so there the palette
+// is still interpolated per pixel and only the brightness table is used.
+
+#ifndef _PALETTEWAVES_H_
+#define _PALETTEWAVES_H_
+
+#include <FastLED.h>
+
+#ifndef PALETTEWAVES_LUT
+ #if defined(__AVR__) && (RAMEND < 0x1000)
+  #define PALETTEWAVES_LUT 0
+ #else
+  #define PALETTEWAVES_LUT 1
+ #endif
+#endif
+
+class PaletteWaves {
+ public:
+  bool dither;
+
+  PaletteWaves() : dither(false), pseudotime(0), lastMillis(0), hue16(0),
+                   frame(0), lutValid(false) {
+    // Brightness curve: ((sin + 1) / 2)^2, top byte, one extra entry so
+    // interpolation never reads past the end
+    for (uint16_t i = 0; i <= 256; i++) {
+      uint32_t b16 = (uint16_t)(sin16(i << 8) + 32768);
+      wave[i] = (b16 * b16) >> 24;
+    }
+  }
+
+  // Draw one frame of waves into 'ledarray', blending 50/50 with what's
+  // already there
+  void draw(CRGB *ledarray, uint16_t numleds, const CRGBPalette16 &palette) {
+#if PALETTEWAVES_LUT
+    if (!lutValid || !(palette == cached)) {
+      cached = palette;
+      for (uint16_t h = 0; h < 256; h++) {
+        lut[h] = ColorFromPalette(palette, scale8(h, 240), 255);
+      }
+      lutValid = true;
+    }
+#endif
+
+    // Per-frame parameters, as in colorwaves()
+    uint8_t  brightdepth = beatsin88(341, 96, 224);
+    uint16_t brightnessthetainc16 = beatsin88(203, (25 * 256), (40 * 256));
+    uint8_t  msmultiplier = beatsin88(147, 23, 60);
+    uint16_t hueinc16 = beatsin88(113, 300, 1500);
+    uint16_t hue = hue16;
+
+    uint16_t ms = millis();
+    uint16_t deltams = ms - lastMillis;
+    lastMillis = ms;
+    pseudotime += deltams * msmultiplier;
+    hue16 += deltams * beatsin88(400, 5, 9);
+    uint16_t theta = pseudotime;
+
+    // Fraction added before truncating brightness: 0 for plain rounding
+    // down, or stepping through 0, 1/2, 1/4, 3/4, ... when dithering
+    uint8_t bias = 0;
+    if (dither) {
+      frame++;
+      for (uint8_t b = 0; b < 8; b++) {
+        if (frame & (1 << b)) bias |= 0x80 >> b;
+      }
+    }
+    uint8_t floor8 = 255 - brightdepth;
+
+    CRGB *led = &ledarray[numleds - 1];
+    for (uint16_t i = 0; i < numleds; i++, led--) {
+      hue += hueinc16;
+      uint16_t h16_128 = hue >> 7;
+      uint8_t  hue8 = (h16_128 & 0x100) ? 255 - (h16_128 >> 1) : h16_128 >> 1;
+
+      theta += brightnessthetainc16;
+      uint8_t a = theta >> 8, frac = theta & 0xFF;
+      int16_t  step = (int16_t)wave[a + 1] - wave[a];
+      uint16_t w16 = (wave[a] << 8) + step * frac;
+      // (w16 * brightdepth) >> 8 with 8x8 multiplies
+      uint16_t b16 = (w16 >> 8) * brightdepth + (((w16 & 0xFF) * brightdepth) >> 8);
+      uint8_t  bri8 = ((b16 + bias) >> 8) + floor8;
+
+#if PALETTEWAVES_LUT
+      CRGB newcolor = lut[hue8];
+      scale(newcolor, bri8);
+#else
+      CRGB newcolor = ColorFromPalette(palette, scale8(hue8, 240), bri8);
+#endif
+      nblend(*led, newcolor, 128);
+    }
+  }
+
+ private:
+  uint16_t pseudotime, lastMillis, hue16;
+  uint8_t  frame;
+  uint8_t  wave[257];
+#if PALETTEWAVES_LUT
+  CRGBPalette16 cached;
+  CRGB          lut[256];
+#endif
+  bool          lutValid;
+
+  // The brightness step of ColorFromPalette(), so the table gives the
+  // same result as interpolating at that brightness
+  static void scale(CRGB &c, uint8_t brightness) {
+    if (brightness == 255) return;
+    if (!brightness) {
+      c = CRGB::Black;
+      return;
+    }
+    brightness++;
+#if !(FASTLED_SCALE8_FIXED == 1)
+    if (c.r) c.r = scale8(c.r, brightness) + 1;
+    if (c.g) c.g = scale8(c.g, brightness) + 1;
+    if (c.b) c.b = scale8(c.b, brightness) + 1;
+#else
+    if (c.r) c.r = scale8(c.r, brightness);
+    if (c.g) c.g = scale8(c.g, brightness);
+    if (c.b) c.b = scale8(c.b, brightness);
+#endif
+  }
+};
+
+#endif // _PALETTEWAVES_H_
@@ -1,5 +1,6 @@
 
 #include "FastLED.h"
+#include "PaletteWaves.h"
 
 // ColorWavesWithPalettes
 // Animated shifting color waves, with several cross-fading color palettes.
@@ -56,58 +57,9 @@ CRGBPalette16 gTargetPalette( gGradientPalettes[0] );
 
 
 
-// This function draws color waves with an ever-changing,
-// widely-varying set of parameters, using a color palette.
-void colorwaves( CRGB* ledarray, uint16_t numleds, CRGBPalette16& palette) 
-{
-  static uint16_t sPseudotime = 0;
-  static uint16_t sLastMillis = 0;
-  static uint16_t sHue16 = 0;
- 
-  uint8_t sat8 = beatsin88( 87, 220, 250);
-  uint8_t brightdepth = beatsin88( 341, 96, 224);
-  uint16_t brightnessthetainc16 = beatsin88( 203, (25 * 256), (40 * 256));
-  uint8_t msmultiplier = beatsin88(147, 23, 60);
-
-  uint16_t hue16 = sHue16;//gHue * 256;
-  uint16_t hueinc16 = beatsin88(113, 300, 1500);
-  
-  uint16_t ms = millis();
-  uint16_t deltams = ms - sLastMillis ;
-  sLastMillis  = ms;
-  sPseudotime += deltams * msmultiplier;
-  sHue16 += deltams * beatsin88( 400, 5,9);
-  uint16_t brightnesstheta16 = sPseudotime;
-  
-  for( uint16_t i = 0 ; i < numleds; i++) {
-    hue16 += hueinc16;
-    uint8_t hue8 = hue16 / 256;
-    uint16_t h16_128 = hue16 >> 7;
-    if( h16_128 & 0x100) {
-      hue8 = 255 - (h16_128 >> 1);
-    } else {
-      hue8 = h16_128 >> 1;
-    }
-
-    brightnesstheta16  += brightnessthetainc16;
-    uint16_t b16 = sin16( brightnesstheta16  ) + 32768;
-
-    uint16_t bri16 = (uint32_t)((uint32_t)b16 * (uint32_t)b16) / 65536;
-    uint8_t bri8 = (uint32_t)(((uint32_t)bri16) * brightdepth) / 65536;
-    bri8 += (255 - brightdepth);
-    
-    uint8_t index = hue8;
-    //index = triwave8( index);
-    index = scale8( index, 240);
-
-    CRGB newcolor = ColorFromPalette( palette, index, bri8);
-
-    uint16_t pixelnumber = i;
-    pixelnumber = (numleds-1) - pixelnumber;
-    
-    nblend( ledarray[pixelnumber], newcolor, 128);
-  }
-}
+// Color waves with an ever-changing, widely-varying set of parameters,
+// drawn from a color palette (see PaletteWaves.h)
+PaletteWaves waves;
 
 // Alternate rendering function just scrolls the current palette 
 // across the defined LED strip.
@@ -668,7 +620,7 @@ const uint8_t gGradientPaletteCount =
     nblendPaletteTowardPalette( gCurrentPalette, gTargetPalette, 16);
   }
   
-  colorwaves( leds, NUM_LEDS, gCurrentPalette);
+  waves.draw( leds, NUM_LEDS, gCurrentPalette);
 
   FastLED.show();
   FastLED.delay(20);
@@ -0,0 +1,59 @@
+// FastLED stand-in for palettewaves_test.cpp: the lib8tion routines
+// colorwaves() uses, following their C versions (FASTLED_SCALE8_FIXED 1)
+#pragma once
+#include <stdint.h>
+#include <string.h>
+#define FASTLED_SCALE8_FIXED 1
+extern uint32_t fakeMillis;
+inline uint32_t millis() { return fakeMillis; }
+typedef uint16_t accum88;
+inline uint8_t scale8(uint8_t i, uint8_t s) { return ((uint16_t)i * (1 + (uint16_t)s)) >> 8; }
+inline uint16_t scale16(uint16_t i, uint16_t s) { return ((uint32_t)i * (1 + (uint32_t)s)) >> 16; }
+inline int16_t sin16(uint16_t theta) {
+  static const uint16_t base[] = { 0, 6393, 12539, 18204, 23170, 27245, 30273, 32137 };
+  static const uint8_t slope[] = { 49, 48, 44, 38, 31, 23, 14, 4 };
+  uint16_t offset = (theta & 0x3FFF) >> 3;
+  if (theta & 0x4000) offset = 2047 - offset;
+  uint8_t section = offset / 256;
+  uint16_t b = base[section]; uint8_t m = slope[section];
+  uint8_t secoffset8 = (uint8_t)(offset) / 2;
+  uint16_t mx = m * secoffset8;
+  int16_t y = mx + b;
+  if (theta & 0x8000) y = -y;
+  return y;
+}
+inline uint16_t beat88(accum88 bpm88) { return ((millis()) * bpm88 * 280) >> 16; }
+inline uint16_t beatsin88(accum88 bpm88, uint16_t lo, uint16_t hi) {
+  uint16_t beatsin = sin16(beat88(bpm88)) + 32768;
+  return lo + scale16(beatsin, hi - lo);
+}
+struct CRGB { uint8_t r, g, b; CRGB() {} CRGB(uint8_t r, uint8_t g, uint8_t b) : r(r), g(g), b(b) {} enum { Black = 0 }; CRGB(int) : r(0), g(0), b(0) {} };
+struct CRGBPalette16 { CRGB entries[16]; bool operator==(const CRGBPalette16 &o) const { return !memcmp(entries, o.entries, sizeof entries); } };
+inline CRGB ColorFromPalette(const CRGBPalette16 &pal, uint8_t index, uint8_t brightness = 255) {
+  uint8_t hi4 = index >> 4, lo4 = index & 0x0F;
+  const CRGB *entry = &pal.entries[hi4];
+  uint8_t r1 = entry->r, g1 = entry->g, b1 = entry->b;
+  if (lo4) {
+    entry = (hi4 == 15) ? &pal.entries[0] : entry + 1;
+    uint8_t f2 = lo4 << 4, f1 = 255 - f2;
+    r1 = scale8(r1, f1) + scale8(entry->r, f2);
+    g1 = scale8(g1, f1) + scale8(entry->g, f2);
+    b1 = scale8(b1, f1) + scale8(entry->b, f2);
+  }
+  if (brightness != 255) {
+    if (brightness) {
+      ++brightness;
+      if (r1) r1 = scale8(r1, brightness);
+      if (g1) g1 = scale8(g1, brightness);
+      if (b1) b1 = scale8(b1, brightness);
+    } else r1 = g1 = b1 = 0;
+  }
+  return CRGB(r1, g1, b1);
+}
+inline CRGB &nblend(CRGB &e, const CRGB &o, uint8_t amt) {
+  uint8_t keep = 255 - amt;
+  e.r = scale8(e.r, keep) + scale8(o.r, amt);
+  e.g = scale8(e.g, keep) + scale8(o.g, amt);
+  e.b = scale8(e.b, keep) + scale8(o.b, amt);
+  return e;
+}
@@ -0,0 +1,138 @@
+// Host test for PaletteWaves.h (Glowing_Mirror_Mask has a copy of the same
+// file). Runs on a PC, not the board; FastLED.h next to this file stands
+// in for the library.
+//
+// Draws 3000 frames of 400 LEDs with both the original colorwaves() and
+// PaletteWaves, with the palette changing as it goes, and compares every
+// channel; then times a frame of each at several strand lengths.
+//
+//   g++ -O2 -I. -o palettewaves_test palettewaves_test.cpp
+//   ./palettewaves_test
+//
+// Add -DPALETTEWAVES_LUT=0 to test the small-AVR build. Exits nonzero if
+// any channel is off by more than MAX_DIFF.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "FastLED.h"
+
+uint32_t fakeMillis = 0;
+
+#include "../PaletteWaves.h"
+
+#define MAX_DIFF 2
+
+// Original colorwaves(), apart from the unused sat8 and its statics moved
+// out here so each comparison can start it afresh
+static uint16_t sPseudotime, sLastMillis, sHue16;
+
+void colorwaves( CRGB* ledarray, uint16_t numleds, CRGBPalette16& palette)
+{
+
+  uint8_t brightdepth = beatsin88( 341, 96, 224);
+  uint16_t brightnessthetainc16 = beatsin88( 203, (25 * 256), (40 * 256));
+  uint8_t msmultiplier = beatsin88(147, 23, 60);
+
+  uint16_t hue16 = sHue16;//gHue * 256;
+  uint16_t hueinc16 = beatsin88(113, 300, 1500);
+
+  uint16_t ms = millis();
+  uint16_t deltams = ms - sLastMillis ;
+  sLastMillis  = ms;
+  sPseudotime += deltams * msmultiplier;
+  sHue16 += deltams * beatsin88( 400, 5,9);
+  uint16_t brightnesstheta16 = sPseudotime;
+
+  for( uint16_t i = 0 ; i < numleds; i++) {
+    hue16 += hueinc16;
+    uint8_t hue8 = hue16 / 256;
+    uint16_t h16_128 = hue16 >> 7;
+    if( h16_128 & 0x100) {
+      hue8 = 255 - (h16_128 >> 1);
+    } else {
+      hue8 = h16_128 >> 1;
+    }
+
+    brightnesstheta16  += brightnessthetainc16;
+    uint16_t b16 = sin16( brightnesstheta16  ) + 32768;
+
+    uint16_t bri16 = (uint32_t)((uint32_t)b16 * (uint32_t)b16) / 65536;
+    uint8_t bri8 = (uint32_t)(((uint32_t)bri16) * brightdepth) / 65536;
+    bri8 += (255 - brightdepth);
+
+    uint8_t index = hue8;
+    index = scale8( index, 240);
+
+    CRGB newcolor = ColorFromPalette( palette, index, bri8);
+
+    uint16_t pixelnumber = i;
+    pixelnumber = (numleds-1) - pixelnumber;
+
+    nblend( ledarray[pixelnumber], newcolor, 128);
+  }
+}
+
+static CRGB a[2000], b[2000];
+
+// Largest and mean channel difference over 3000 frames
+static int compare(bool dither) {
+  CRGBPalette16 pal;
+  PaletteWaves waves;
+  waves.dither = dither;
+  int maxDiff = 0;
+  long sum = 0, n = 0;
+
+  srand(36);
+  sPseudotime = sLastMillis = sHue16 = 0;
+  for (int i = 0; i < 400; i++) a[i] = b[i] = CRGB(0, 0, 0);
+  fakeMillis = 20000;
+  for (int f = 0; f < 3000; f++) {
+    fakeMillis += 21;
+    if (f % 200 == 0) {
+      for (int i = 0; i < 16; i++) pal.entries[i] = CRGB(rand(), rand(), rand());
+    } else if (f % 5 == 0) {
+      pal.entries[f % 16].g ^= 3;
+    }
+    colorwaves(a, 400, pal);
+    waves.draw(b, 400, pal);
+    for (int i = 0; i < 400; i++) {
+      int d[3] = { abs(a[i].r - b[i].r), abs(a[i].g - b[i].g), abs(a[i].b - b[i].b) };
+      for (int c = 0; c < 3; c++) {
+        if (d[c] > maxDiff) maxDiff = d[c];
+        sum += d[c];
+        n++;
+      }
+    }
+  }
+  printf("dither %-3s  max channel difference %d, mean %.2f\n",
+         dither ? "on" : "off", maxDiff, (double)sum / n);
+  return maxDiff;
+}
+
+int main(void) {
+  int failures = 0;
+  if (compare(false) > MAX_DIFF) failures++;
+  if (compare(true) > MAX_DIFF) failures++;
+
+  CRGBPalette16 pal;
+  for (int i = 0; i < 16; i++) pal.entries[i] = CRGB(i * 16, 255 - i * 16, i * 7);
+  PaletteWaves waves;
+  printf("%6s %14s %16s\n", "LEDs", "colorwaves us", "PaletteWaves us");
+  static const int sizes[] = { 100, 250, 500, 1000, 2000 };
+  for (unsigned s = 0; s < sizeof sizes / sizeof sizes[0]; s++) {
+    int leds = sizes[s], frames = 4000000 / leds;
+    double us[2];
+    for (int pass = 0; pass < 2; pass++) {
+      clock_t t0 = clock();
+      for (int f = 0; f < frames; f++) {
+        fakeMillis += 20;
+        if (pass == 0) colorwaves(a, leds, pal);
+        else waves.draw(b, leds, pal);
+      }
+      us[pass] = (double)(clock() - t0) * 1e6 / CLOCKS_PER_SEC / frames;
+    }
+    printf("%6d %14.2f %16.2f\n", leds, us[0], us[1]);
+  }
+  return failures ? 1 : 0;
+}